@@ -0,0 +1,223 @@
+#include "chibi.h"
+#include <sys/resource.h>
+
+bool mem_report;
+
+static char *kind_names[] = {"Token",       "Node",     "Type",
+                             "Member",      "Var",      "scope",
+                             "Initializer", "Function", "code",
+                             "other"};
+
+static char *type_names[] = {"void", "_Bool", "char",  "short",
+                             "int",  "long",  "enum",  "pointer",
+                             "array", "struct", "function"};
+
+static long alloc_count[PHASE_DONE + 1][ALLOC_NKINDS];
+static long alloc_bytes[PHASE_DONE + 1][ALLOC_NKINDS];
+
+// With -fmem-report, every Type is remembered so that structurally
+// identical ones can be counted at the end.
+static Type **types;
+static long num_types;
+static long types_cap;
+
+void *allocate(AllocKind kind, long size) {
+  void *p = calloc(1, size);
+  if (!mem_report)
+    return p;
+
+  alloc_count[current_phase][kind]++;
+  alloc_bytes[current_phase][kind] += size;
+
+  if (kind == ALLOC_TYPE) {
+    if (num_types == types_cap) {
+      types_cap = types_cap ? types_cap * 2 : 1024;
+      types = realloc(types, types_cap * sizeof(Type *));
+    }
+    types[num_types++] = p;
+  }
+  return p;
+}
+
+// Like realloc(), for memory that is freed or resized again, such as the
+// arrays that the back end keeps while it works on a function. Each call
+// counts with the full new size.
+void *reallocate(AllocKind kind, void *p, long size) {
+  p = realloc(p, size);
+  if (mem_report) {
+    alloc_count[current_phase][kind]++;
+    alloc_bytes[current_phase][kind] += size;
+  }
+  return p;
+}
+
+static char *format_bytes(long n) {
+  char *buf = malloc(30);
+  if (n < 10 * 1024)
+    sprintf(buf, "%ld", n);
+  else if (n < 10 * 1024 * 1024)
+    sprintf(buf, "%ldK", n / 1024);
+  else
+    sprintf(buf, "%ldM", n / 1024 / 1024);
+  return buf;
+}
+
+static bool same_type(Type *x, Type *y) {
+  return x->kind == y->kind && x->size == y->size && x->align == y->align &&
+         x->is_incomplete == y->is_incomplete && x->base == y->base &&
+         x->array_len == y->array_len && x->members == y->members &&
+         x->return_ty == y->return_ty;
+}
+
+static long hash_type(Type *ty) {
+  long h = ty->kind;
+  h = h * 31 + ty->size;
+  h = h * 31 + ty->array_len;
+  h = h * 31 + (((long)ty->base >> 4) & 0xffffff);
+  h = h * 31 + (((long)ty->members >> 4) & 0xffffff);
+  return h & 0x7fffffff;
+}
+
+// A Type is a duplicate if an identical one, down to the pointers to its
+// base type and members, was allocated before it. pointer_to() and
+// array_of() create a new Type on every call, so these add up quickly.
+static void print_duplicate_types(void) {
+  long cap = 16;
+  while (cap < num_types * 2)
+    cap *= 2;
+  Type **buckets = calloc(cap, sizeof(Type *));
+  long *dups = calloc(cap, sizeof(long));
+  long total = 0;
+
+  for (long i = 0; i < num_types; i++) {
+    Type *ty = types[i];
+    long h = hash_type(ty) & (cap - 1);
+    while (buckets[h] && !same_type(buckets[h], ty))
+      h = (h + 1) & (cap - 1);
+    if (buckets[h]) {
+      dups[h]++;
+      total++;
+    } else {
+      buckets[h] = ty;
+    }
+  }
+
+  fprintf(stderr, "\n%ld of %ld Types are duplicates (%s bytes)\n", total,
+          num_types, format_bytes(total * sizeof(Type)));
+
+  for (int i = 0; i < 5; i++) {
+    long max = 0;
+    for (long j = 1; j < cap; j++)
+      if (dups[j] > dups[max])
+        max = j;
+    if (dups[max] == 0)
+      break;
+
+    Type *ty = buckets[max];
+    fprintf(stderr, " %8ld x %s", dups[max], type_names[ty->kind]);
+    if (ty->base)
+      fprintf(stderr, " %s %s", ty->kind == TY_PTR ? "to" : "of",
+              type_names[ty->base->kind]);
+    fprintf(stderr, " (%d bytes)\n", ty->size);
+    dups[max] = 0;
+  }
+}
+
+static long count_byte_inits(Var *var) {
+  long n = 0;
+  for (Initializer *init = var->initializer; init; init = init->next)
+    if (!init->label && init->sz == 1)
+      n++;
+  return n;
+}
+
+// Inserts var into the list of worst offenders, which is sorted by the
+// number of single-byte initializers and holds at most 5 entries.
+static void rank_var(Var **worst, Var *var) {
+  long n = count_byte_inits(var);
+  if (n < 256)
+    return;
+
+  int i = 5;
+  while (i > 0 && (!worst[i - 1] || count_byte_inits(worst[i - 1]) < n))
+    i--;
+  if (i == 5)
+    return;
+
+  for (int j = 4; j > i; j--)
+    worst[j] = worst[j - 1];
+  worst[i] = var;
+}
+
+static void count_initializers(VarList *globals, long *count, long *bytes,
+                               Var **worst) {
+  for (VarList *vl = globals; vl; vl = vl->next) {
+    for (Initializer *init = vl->var->initializer; init; init = init->next) {
+      (*count)++;
+      if (!init->label && init->sz == 1)
+        (*bytes)++;
+    }
+    rank_var(worst, vl->var);
+  }
+}
+
+// Global initializers are lists with one element per scalar, and char
+// arrays and padding get one element per byte.
+static void print_initializers(Program *prog) {
+  long count = 0;
+  long bytes = 0;
+  Var *worst[5] = {};
+
+  count_initializers(prog->globals, &count, &bytes, worst);
+  for (Function *fn = prog->fns; fn; fn = fn->next)
+    count_initializers(fn->globals, &count, &bytes, worst);
+
+  fprintf(stderr, "\n%ld Initializers, %ld of them for a single byte\n",
+          count, bytes);
+
+  for (int i = 0; i < 5 && worst[i]; i++)
+    fprintf(stderr, " %-24s %8ld single-byte initializers\n", worst[i]->name,
+            count_byte_inits(worst[i]));
+}
+
+void print_mem_report(Program *prog) {
+  fprintf(stderr, "Memory allocated by kind\n");
+  fprintf(stderr, " %-14s %10s %10s\n", "kind", "count", "bytes");
+
+  long total_count = 0;
+  long total_bytes = 0;
+  for (int k = 0; k < ALLOC_NKINDS; k++) {
+    long count = 0;
+    long bytes = 0;
+    for (int p = 0; p <= PHASE_DONE; p++) {
+      count += alloc_count[p][k];
+      bytes += alloc_bytes[p][k];
+    }
+    fprintf(stderr, " %-14s %10ld %10s\n", kind_names[k], count,
+            format_bytes(bytes));
+    total_count += count;
+    total_bytes += bytes;
+  }
+  fprintf(stderr, " %-14s %10ld %10s\n", "TOTAL", total_count,
+          format_bytes(total_bytes));
+
+  fprintf(stderr, "\nMemory allocated by phase\n");
+  fprintf(stderr, " %-14s %10s %10s\n", "phase", "count", "bytes");
+  for (int p = 0; p < PHASE_DONE; p++) {
+    long count = 0;
+    long bytes = 0;
+    for (int k = 0; k < ALLOC_NKINDS; k++) {
+      count += alloc_count[p][k];
+      bytes += alloc_bytes[p][k];
+    }
+    fprintf(stderr, " %-14s %10ld %10s\n", phase_names[p], count,
+            format_bytes(bytes));
+  }
+
+  struct rusage ru;
+  getrusage(RUSAGE_SELF, &ru);
+  fprintf(stderr, "\nPeak RSS: %s\n", format_bytes(ru.ru_maxrss * 1024));
+
+  print_duplicate_types();
+  print_initializers(prog);
+}
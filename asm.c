@@ -0,0 +1,227 @@
+#include "chibi.h"
+
+static char *reg64[] = {"rax", "rcx", "rdx", "rbx", "rsp", "rbp",
+                        "rsi", "rdi", "r8",  "r9",  "r10", "r11",
+                        "r12", "r13", "r14", "r15"};
+static char *reg32[] = {"eax",  "ecx",  "edx",  "ebx",  "esp",  "ebp",
+                        "esi",  "edi",  "r8d",  "r9d",  "r10d", "r11d",
+                        "r12d", "r13d", "r14d", "r15d"};
+static char *reg16[] = {"ax",   "cx",   "dx",   "bx",   "sp",   "bp",
+                        "si",   "di",   "r8w",  "r9w",  "r10w", "r11w",
+                        "r12w", "r13w", "r14w", "r15w"};
+static char *reg8[] = {"al",   "cl",   "dl",   "bl",   "spl",  "bpl",
+                       "sil",  "dil",  "r8b",  "r9b",  "r10b", "r11b",
+                       "r12b", "r13b", "r14b", "r15b"};
+
+static char *mnemonics[] = {
+    "",     "mov ", "movsx ", "movzx ", "lea ", "push ", "pop ",  "add ",
+    "sub ", "imul ", "cqo",   "idiv ",  "imul ", "and ", "or ",   "xor ",
+    "shl ", "sar ", "not ",   "cmp ",   "set",   "jmp ", "j",     "call ",
+    "ret",  ".long ", ".p2align 4,,10",
+};
+
+static char *cc_names[] = {"o", "no", "b", "ae", "e", "ne", "be", "a",
+                           "s", "ns", "p", "np", "l", "ge", "le", "g"};
+
+static char *ptr_names[] = {"", "byte ptr ", "word ptr ", "", "dword ptr ",
+                            "", "",          "",          "qword ptr "};
+
+// Fixed strings are kept padded to 16 bytes, so that appending one takes
+// two word stores whatever its length. The sink always has room for the
+// padding, which is overwritten by whatever comes next.
+typedef struct {
+  long word[2];
+  int len;
+} Name;
+
+static Name reg_text[4][16];
+static Name mnemonic_text[I_ALIGN + 1];
+static Name set_text[16];
+static Name jcc_text[16];
+static Name ptr_text[9];
+static Name int_text[1024];
+static Name movsxd_text;
+static Name movabs_text;
+static bool names_ready;
+
+static void set_name(Name *name, char *s1, char *s2) {
+  memset(name, 0, sizeof(Name));
+  int len1 = strlen(s1);
+  int len2 = strlen(s2);
+  memcpy((char *)name->word, s1, len1);
+  memcpy((char *)name->word + len1, s2, len2);
+  name->len = len1 + len2;
+}
+
+static void init_names(void) {
+  for (int i = 0; i < 16; i++) {
+    set_name(&reg_text[0][i], reg8[i], "");
+    set_name(&reg_text[1][i], reg16[i], "");
+    set_name(&reg_text[2][i], reg32[i], "");
+    set_name(&reg_text[3][i], reg64[i], "");
+    set_name(&set_text[i], "  set", cc_names[i]);
+    set_name(&jcc_text[i], "  j", cc_names[i]);
+  }
+  for (int i = 0; i <= I_ALIGN; i++)
+    set_name(&mnemonic_text[i], "  ", mnemonics[i]);
+  for (int i = 0; i <= 8; i++)
+    set_name(&ptr_text[i], ptr_names[i], "");
+  for (int i = 0; i < 1024; i++) {
+    char buf[8];
+    sprintf(buf, "%d", i);
+    set_name(&int_text[i], buf, "");
+  }
+  set_name(&movsxd_text, "  movsxd ", "");
+  set_name(&movabs_text, "  movabs ", "");
+  names_ready = true;
+}
+
+// An instruction is printed straight into the sink's buffer after room for
+// it has been reserved once. These append routines return the position
+// after what they wrote.
+
+static char *put_name(char *p, Name *name) {
+  long *q = (long *)p;
+  q[0] = name->word[0];
+  q[1] = name->word[1];
+  return p + name->len;
+}
+
+static char *put_str(char *p, char *s) {
+  int len = strlen(s);
+  memcpy(p, s, len);
+  return p + len;
+}
+
+static char *put_int(char *p, long val) {
+  // Small numbers such as stack offsets are by far the most common, and
+  // they are looked up instead of being divided by ten digit by digit.
+  if (val > -1024 && val < 1024) {
+    if (val >= 0)
+      return put_name(p, &int_text[val]);
+    *p = '-';
+    return put_name(p + 1, &int_text[-val]);
+  }
+  return write_int(p, val);
+}
+
+static int size_index[] = {0, 0, 1, 0, 2, 0, 0, 0, 3};
+
+// Virtual registers only appear in dumps of code before register
+// allocation, where they are numbered from v0 and their lower parts are
+// named like those of r8.
+static char *put_reg(char *p, int reg, int size) {
+  if (reg >= VREG) {
+    *p++ = 'v';
+    p = put_int(p, reg - VREG);
+    if (size < 8)
+      *p++ = "bwd"[size / 2];
+    return p;
+  }
+  return put_name(p, &reg_text[size_index[size]][reg]);
+}
+
+static char *put_operand(char *p, Code *code, Inst *inst, Operand *op) {
+  switch (op->kind) {
+  case OP_REG:
+    return put_reg(p, op->reg, op->size);
+  case OP_IMM:
+    return put_int(p, op->val);
+  case OP_MEM:
+    if (inst->kind != I_LEA)
+      p = put_name(p, &ptr_text[op->size]);
+    *p++ = '[';
+    if (op->sym) {
+      p = put_str(p, "rip+");
+      p = put_str(p, op->sym);
+    } else {
+      p = put_reg(p, op->reg, 8);
+    }
+    if (op->scale) {
+      *p++ = '+';
+      p = put_reg(p, op->index, 8);
+      *p++ = '*';
+      *p++ = '0' + op->scale;
+    }
+    if (op->val > 0)
+      *p++ = '+';
+    if (op->val)
+      p = put_int(p, op->val);
+    *p++ = ']';
+    return p;
+  case OP_LABEL:
+    if (inst->kind != I_LEA)
+      return put_str(p, code->labels[op->val]);
+    p = put_str(p, "[rip+");
+    p = put_str(p, code->labels[op->val]);
+    *p++ = ']';
+    return p;
+  case OP_SYM:
+    return put_str(p, op->sym);
+  }
+  return p;
+}
+
+// Returns an upper bound of the length of a symbol or label operand.
+static long name_len(Code *code, Operand *op) {
+  if (op->kind == OP_LABEL)
+    return strlen(code->labels[op->val]);
+  if (op->sym)
+    return strlen(op->sym);
+  return 0;
+}
+
+static void print_inst(Sink *out, Code *code, Inst *inst) {
+  // Everything but symbols and labels fits in 128 bytes with padding.
+  long n = 128;
+  if (inst->dst.kind >= OP_MEM || inst->src.kind >= OP_MEM)
+    n += name_len(code, &inst->dst) + name_len(code, &inst->src);
+  if (out->len + n > out->cap)
+    sink_reserve(out, n);
+  char *p = out->buf + out->len;
+
+  if (inst->kind == I_LABEL) {
+    p = put_str(p, code->labels[inst->dst.val]);
+    *p++ = ':';
+    *p++ = '\n';
+    out->len = p - out->buf;
+    return;
+  }
+
+  if (inst->kind == I_JCC) {
+    p = put_name(p, &jcc_text[inst->cc]);
+    *p++ = ' ';
+  } else if (inst->kind == I_SETCC) {
+    p = put_name(p, &set_text[inst->cc]);
+    *p++ = ' ';
+  } else if (inst->kind == I_MOVSX && inst->src.size == 4) {
+    p = put_name(p, &movsxd_text);
+  } else if (inst->kind == I_MOV && inst->src.kind == OP_IMM &&
+             inst->src.val != (int)inst->src.val) {
+    p = put_name(p, &movabs_text);
+  } else {
+    p = put_name(p, &mnemonic_text[inst->kind]);
+  }
+
+  if (inst->dst.kind != OP_NONE)
+    p = put_operand(p, code, inst, &inst->dst);
+  if (inst->kind == I_ENTRY) {
+    *p++ = '-';
+    p = put_operand(p, code, inst, &inst->src);
+  } else if (inst->src.kind != OP_NONE) {
+    *p++ = ',';
+    *p++ = ' ';
+    p = put_operand(p, code, inst, &inst->src);
+  }
+  *p++ = '\n';
+  out->len = p - out->buf;
+}
+
+void print_insts(Sink *out, Code *code, int start, int end) {
+  if (!names_ready)
+    init_names();
+  for (int i = start; i < end; i++)
+    print_inst(out, code, &code->insts[i]);
+}
+
+void print_code(Sink *out, Code *code) { print_insts(out, code, 0, code->len); }
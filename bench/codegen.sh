@@ -0,0 +1,66 @@
+#!/bin/bash
+#
+# Measures how fast the code generated by ccc runs, compared to gcc.
+#
+# $ ./bench/codegen.sh [<kernel>...]
+#
+# Every kernel in bench/kernels is compiled with ccc and with gcc -O0 and
+# -O1, checked to print the same result under all three, and run $RUNS
+# times. The fastest run is reported along with the instructions it
+# retired and the size of the kernel's own code.
+
+cd "$(dirname "$0")/.."
+
+CCC=${CCC:-./ccc}
+TMP=tmp-bench
+RUNS=${RUNS:-5}
+
+mkdir -p $TMP
+gcc -O2 -o $TMP/perfrun bench/perfrun.c || exit 1
+
+kernels="$*"
+[ -z "$kernels" ] && kernels=$(ls bench/kernels/*.c | xargs -n1 basename | sed 's/\.c$//')
+
+text_size() {
+  size "$1" | awk 'NR == 2 { print $1 }'
+}
+
+printf "%-8s %-8s %10s %8s %14s %8s\n" kernel compiler seconds "vs -O0" \
+       instructions text
+
+status=0
+
+for k in $kernels; do
+  src=bench/kernels/$k.c
+  base=$TMP/$k
+
+  $CCC $src > $base.ccc.s || exit 1
+  gcc -c -o $base.ccc.o $base.ccc.s 2>/dev/null || exit 1
+  gcc -w -O0 -c -o $base.O0.o $src || exit 1
+  gcc -w -O1 -c -o $base.O1.o $src || exit 1
+
+  expected=""
+  O0=""
+  for cc in O0 ccc O1; do
+    gcc -static -o $base.$cc $base.$cc.o 2>/dev/null || exit 1
+
+    out=$($base.$cc)
+    [ -z "$expected" ] && expected=$out
+    if [ "$out" != "$expected" ]; then
+      echo "$k: $cc printed '$out', expected '$expected'"
+      status=1
+      continue
+    fi
+
+    read secs insns < <($TMP/perfrun $RUNS $base.$cc)
+    [ $cc = O0 ] && O0=$secs
+    name=$cc
+    [ $cc != ccc ] && name=gcc-$cc
+
+    printf "%-8s %-8s %10s %7.2fx %14s %8s\n" $k $name $secs \
+           $(awk -v a=$secs -v b=$O0 'BEGIN { print a / b }') $insns \
+           $(text_size $base.$cc.o)
+  done
+done
+
+exit $status
@@ -0,0 +1,163 @@
+// Generates large synthetic C programs for measuring compiler throughput.
+//
+// $ gen <kind> <scale>
+//
+// The output only depends on the arguments, so that timings of the same
+// input can be compared across compiler versions.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static unsigned long seed = 1;
+
+static int rnd(int n) {
+  seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+  return (seed >> 33) % n;
+}
+
+static char *vars[] = {"a", "b", "c", "i", "j", "n"};
+
+static void gen_expr(int depth) {
+  if (depth == 0) {
+    if (rnd(2))
+      printf("%s", vars[rnd(6)]);
+    else
+      printf("%d", rnd(1000));
+    return;
+  }
+
+  static char *ops[] = {"+", "-", "*", "&", "|", "^", "<", "==", "&&", "||"};
+  printf("(");
+  gen_expr(depth - 1);
+  printf(" %s ", ops[rnd(10)]);
+  gen_expr(rnd(depth));
+  printf(")");
+}
+
+static void gen_prelude(void) {
+  printf("int printf();\n\n");
+}
+
+// Many small functions with loops, branches and calls to earlier ones.
+static void gen_functions(int scale) {
+  gen_prelude();
+  for (int f = 0; f < scale; f++) {
+    printf("int f%d(int a, int b) {\n", f);
+    printf("  int c = a * %d + b;\n", rnd(100));
+    printf("  int n = 0;\n");
+    printf("  for (int i = 0; i < %d; i++) {\n", rnd(10) + 1);
+    printf("    int j = i * c;\n");
+    printf("    if (j > %d)\n", rnd(50));
+    printf("      n = n + j - a;\n");
+    printf("    else\n");
+    printf("      n = n ^ b;\n");
+    printf("  }\n");
+    if (f > 0)
+      printf("  n = n + f%d(a - 1, n);\n", rnd(f));
+    printf("  return n;\n");
+    printf("}\n\n");
+  }
+  printf("int main() {\n  printf(\"%%d\\n\", f%d(1, 2));\n  return 0;\n}\n",
+         scale - 1);
+}
+
+// Functions made of long, deeply nested expressions.
+static void gen_exprs(int scale) {
+  gen_prelude();
+  for (int f = 0; f < scale; f++) {
+    printf("int e%d(int a, int b, int c) {\n", f);
+    printf("  int i = a + 1;\n  int j = b - 1;\n  int n = c;\n");
+    for (int s = 0; s < 8; s++) {
+      printf("  n = ");
+      gen_expr(12);
+      printf(";\n");
+    }
+    printf("  return n;\n}\n\n");
+  }
+  printf("int main() {\n  printf(\"%%d\\n\", e0(1, 2, 3));\n  return 0;\n}\n");
+}
+
+// Huge initialized arrays of scalars, strings and structs.
+static void gen_inits(int scale) {
+  gen_prelude();
+  printf("struct P { char tag; int x; long y; };\n\n");
+  for (int g = 0; g < scale; g++) {
+    printf("int t%d[] = {", g);
+    for (int i = 0; i < 1000; i++)
+      printf("%s%d", i ? ", " : "", rnd(100000));
+    printf("};\n");
+
+    printf("char s%d[] = \"", g);
+    for (int i = 0; i < 1000; i++)
+      putchar('a' + rnd(26));
+    printf("\";\n");
+
+    printf("struct P p%d[] = {", g);
+    for (int i = 0; i < 100; i++)
+      printf("%s{%d, %d, %d}", i ? ", " : "", 'a' + rnd(26), rnd(1000),
+             rnd(1000000));
+    printf("};\n\n");
+  }
+  printf("int main() {\n  printf(\"%%d\\n\", t0[1] + s0[2] + p0[3].x);\n"
+         "  return 0;\n}\n");
+}
+
+// Many global variables and functions that read and write them.
+static void gen_globals(int scale) {
+  gen_prelude();
+  static char *types[] = {"char", "short", "int", "long"};
+  for (int g = 0; g < scale * 10; g++)
+    printf("%s g%d;\n", types[rnd(4)], g);
+  printf("\n");
+
+  for (int f = 0; f < scale; f++) {
+    printf("long u%d() {\n", f);
+    for (int i = 0; i < 10; i++) {
+      int x = rnd(scale * 10);
+      int y = rnd(scale * 10);
+      printf("  g%d = g%d + g%d;\n", f * 10 + i, x, y);
+    }
+    printf("  return g%d;\n}\n\n", f * 10);
+  }
+  printf("int main() {\n  printf(\"%%ld\\n\", u0());\n  return 0;\n}\n");
+}
+
+// Functions with long switch statements, as in bytecode interpreters.
+static void gen_switch(int scale) {
+  gen_prelude();
+  for (int f = 0; f < scale; f++) {
+    printf("int s%d(int op, int x) {\n  switch (op) {\n", f);
+    int v = 0;
+    for (int c = 0; c < 500; c++) {
+      v += 1 + rnd(3);
+      printf("  case %d:\n    return x * %d + %d;\n", v, rnd(100), rnd(100));
+    }
+    printf("  default:\n    return -1;\n  }\n}\n\n");
+  }
+  printf("int main() {\n  printf(\"%%d\\n\", s0(5, 7));\n  return 0;\n}\n");
+}
+
+int main(int argc, char **argv) {
+  if (argc != 3) {
+    fprintf(stderr, "usage: %s <kind> <scale>\n", argv[0]);
+    return 1;
+  }
+
+  int scale = atoi(argv[2]);
+  if (!strcmp(argv[1], "functions"))
+    gen_functions(scale);
+  else if (!strcmp(argv[1], "exprs"))
+    gen_exprs(scale);
+  else if (!strcmp(argv[1], "inits"))
+    gen_inits(scale);
+  else if (!strcmp(argv[1], "globals"))
+    gen_globals(scale);
+  else if (!strcmp(argv[1], "switch"))
+    gen_switch(scale);
+  else {
+    fprintf(stderr, "%s: unknown kind: %s\n", argv[0], argv[1]);
+    return 1;
+  }
+  return 0;
+}
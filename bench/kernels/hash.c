@@ -0,0 +1,60 @@
+// Inserts and looks up keys in an open-addressing hash table keyed by
+// FNV-1a hashes.
+
+int printf();
+
+long keys[65536];
+int used[65536];
+long seed;
+
+long rand31() {
+  seed = (seed * 1103515245 + 12345) & 2147483647;
+  return seed;
+}
+
+long hash(long key) {
+  long h = 2166136261;
+  for (int i = 0; i < 8; i++) {
+    h = ((h ^ (key & 255)) * 16777619) & 4294967295;
+    key = key >> 8;
+  }
+  return h;
+}
+
+int insert(long key) {
+  long i = hash(key) & 65535;
+  while (used[i]) {
+    if (keys[i] == key)
+      return 0;
+    i = (i + 1) & 65535;
+  }
+  used[i] = 1;
+  keys[i] = key;
+  return 1;
+}
+
+int lookup(long key) {
+  long i = hash(key) & 65535;
+  while (used[i]) {
+    if (keys[i] == key)
+      return 1;
+    i = (i + 1) & 65535;
+  }
+  return 0;
+}
+
+int main() {
+  long inserted = 0;
+  long found = 0;
+  seed = 42;
+  for (int i = 0; i < 40000; i++)
+    inserted += insert(rand31() & 262143);
+
+  for (int k = 0; k < 20; k++) {
+    seed = k;
+    for (int i = 0; i < 100000; i++)
+      found += lookup(rand31() & 262143);
+  }
+  printf("%ld %ld\n", inserted, found);
+  return 0;
+}
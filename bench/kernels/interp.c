@@ -0,0 +1,90 @@
+// Runs a bytecode program on a switch-dispatched stack machine.
+
+int printf();
+
+typedef enum {
+  OP_PUSH,
+  OP_LOAD,
+  OP_STORE,
+  OP_ADD,
+  OP_SUB,
+  OP_MUL,
+  OP_AND,
+  OP_LT,
+  OP_JZ,
+  OP_JMP,
+  OP_HALT,
+} Op;
+
+long code[] = {
+    // i = 0; acc = 0
+    OP_PUSH, 0, OP_STORE, 0, OP_PUSH, 0, OP_STORE, 1,
+    // loop: if (!(i < 3000000)) goto end
+    OP_LOAD, 0, OP_PUSH, 3000000, OP_LT, OP_JZ, 44,
+    // acc = (acc + i * 7) & 0xffffff
+    OP_LOAD, 1, OP_LOAD, 0, OP_PUSH, 7, OP_MUL, OP_ADD, OP_PUSH, 16777215,
+    OP_AND, OP_STORE, 1,
+    // i = i + 1
+    OP_LOAD, 0, OP_PUSH, 1, OP_ADD, OP_STORE, 0,
+    // acc = acc - 1
+    OP_LOAD, 1, OP_PUSH, 1, OP_SUB, OP_STORE, 1, OP_JMP,
+    // end
+    8, OP_LOAD, 1, OP_HALT,
+};
+
+long run(long *code) {
+  long stack[64];
+  long vars[8];
+  int sp = 0;
+  int pc = 0;
+
+  for (;;) {
+    switch (code[pc++]) {
+    case OP_PUSH:
+      stack[sp++] = code[pc++];
+      break;
+    case OP_LOAD:
+      stack[sp++] = vars[code[pc++]];
+      break;
+    case OP_STORE:
+      vars[code[pc++]] = stack[--sp];
+      break;
+    case OP_ADD:
+      sp--;
+      stack[sp - 1] = stack[sp - 1] + stack[sp];
+      break;
+    case OP_SUB:
+      sp--;
+      stack[sp - 1] = stack[sp - 1] - stack[sp];
+      break;
+    case OP_MUL:
+      sp--;
+      stack[sp - 1] = stack[sp - 1] * stack[sp];
+      break;
+    case OP_AND:
+      sp--;
+      stack[sp - 1] = stack[sp - 1] & stack[sp];
+      break;
+    case OP_LT:
+      sp--;
+      stack[sp - 1] = stack[sp - 1] < stack[sp];
+      break;
+    case OP_JZ:
+      if (stack[--sp] == 0)
+        pc = code[pc];
+      else
+        pc++;
+      break;
+    case OP_JMP:
+      pc = code[pc];
+      break;
+    case OP_HALT:
+      return stack[sp - 1];
+    }
+  }
+}
+
+int main() {
+  printf("%ld\n", run(code));
+  return 0;
+}
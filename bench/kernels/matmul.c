@@ -0,0 +1,33 @@
+// Multiplies square matrices with the naive triple loop.
+
+int printf();
+
+long a[150][150];
+long b[150][150];
+long c[150][150];
+
+int main() {
+  int n = 150;
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      a[i][j] = i + j;
+      b[i][j] = i - j;
+    }
+  }
+
+  long sum = 0;
+  for (int k = 0; k < 3; k++) {
+    for (int i = 0; i < n; i++) {
+      for (int j = 0; j < n; j++) {
+        long s = 0;
+        for (int l = 0; l < n; l++)
+          s += a[i][l] * b[l][j];
+        c[i][j] = s;
+      }
+    }
+    sum += c[k][n - 1 - k];
+    a[k][k] = a[k][k] + 1;
+  }
+  printf("%ld\n", sum);
+  return 0;
+}
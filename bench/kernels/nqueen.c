@@ -0,0 +1,43 @@
+// Counts the solutions of the 10-queens problem with the same search as
+// examples/nqueen.c.
+
+int printf();
+
+int conflict(int (*board)[10], int row, int col) {
+  for (int i = 0; i < row; i++) {
+    if (board[i][col])
+      return 1;
+    int j = row - i;
+    if (0 < col - j + 1 && board[i][col - j])
+      return 1;
+    if (col + j < 10 && board[i][col + j])
+      return 1;
+  }
+  return 0;
+}
+
+int solve(int (*board)[10], int row) {
+  if (row > 9)
+    return 1;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    if (!conflict(board, row, i)) {
+      board[row][i] = 1;
+      n += solve(board, row + 1);
+      board[row][i] = 0;
+    }
+  }
+  return n;
+}
+
+int main() {
+  int board[100];
+  long total = 0;
+  for (int k = 0; k < 4; k++) {
+    for (int i = 0; i < 100; i++)
+      board[i] = 0;
+    total += solve(board, 0);
+  }
+  printf("%ld\n", total);
+  return 0;
+}
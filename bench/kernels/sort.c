@@ -0,0 +1,56 @@
+// Quicksorts an array of pseudo-random numbers several times.
+
+int printf();
+
+long data[200000];
+long seed;
+
+long rand31() {
+  seed = (seed * 1103515245 + 12345) & 2147483647;
+  return seed;
+}
+
+void quicksort(long *a, int lo, int hi) {
+  while (lo < hi) {
+    long pivot = a[(lo + hi) / 2];
+    int i = lo;
+    int j = hi;
+    while (i <= j) {
+      while (a[i] < pivot)
+        i++;
+      while (a[j] > pivot)
+        j--;
+      if (i <= j) {
+        long t = a[i];
+        a[i] = a[j];
+        a[j] = t;
+        i++;
+        j--;
+      }
+    }
+    if (j - lo < hi - i) {
+      quicksort(a, lo, j);
+      lo = i;
+    } else {
+      quicksort(a, i, hi);
+      hi = j;
+    }
+  }
+}
+
+int main() {
+  int n = 200000;
+  long sum = 0;
+  seed = 1;
+  for (int k = 0; k < 5; k++) {
+    for (int i = 0; i < n; i++)
+      data[i] = rand31();
+    quicksort(data, 0, n - 1);
+    for (int i = 1; i < n; i++)
+      if (data[i - 1] > data[i])
+        return 1;
+    sum += data[n / 2] + data[n / 7];
+  }
+  printf("%ld\n", sum);
+  return 0;
+}
@@ -0,0 +1,86 @@
+// Builds a text out of pseudo-random words, then counts words, measures
+// them, searches for a pattern and reverses the text in place.
+
+int printf();
+
+char text[1000000];
+long seed;
+
+long rand31() {
+  seed = (seed * 1103515245 + 12345) & 2147483647;
+  return seed;
+}
+
+int length(char *s) {
+  int n = 0;
+  while (s[n])
+    n++;
+  return n;
+}
+
+int count_words(char *s, int *hist) {
+  int n = 0;
+  while (*s) {
+    while (*s == ' ')
+      s++;
+    if (!*s)
+      break;
+    int len = 0;
+    while (*s && *s != ' ') {
+      s++;
+      len++;
+    }
+    hist[len]++;
+    n++;
+  }
+  return n;
+}
+
+int count_matches(char *s, char *pat) {
+  int n = 0;
+  for (; *s; s++) {
+    int i = 0;
+    while (pat[i] && s[i] == pat[i])
+      i++;
+    if (!pat[i])
+      n++;
+  }
+  return n;
+}
+
+void reverse(char *s, int len) {
+  int i = 0;
+  int j = len - 1;
+  while (i < j) {
+    char c = s[i];
+    s[i++] = s[j];
+    s[j--] = c;
+  }
+}
+
+int main() {
+  long sum = 0;
+  seed = 7;
+  for (int k = 0; k < 5; k++) {
+    int len = 0;
+    while (len < 999000) {
+      int wlen = 1 + (rand31() >> 8 & 7);
+      for (int i = 0; i < wlen; i++)
+        text[len++] = 'a' + (rand31() >> 8 & 3);
+      text[len++] = ' ';
+    }
+    text[len] = 0;
+
+    int hist[16];
+    for (int i = 0; i < 16; i++)
+      hist[i] = 0;
+
+    sum += count_words(text, hist);
+    sum += hist[3] * 3 + hist[8];
+    sum += count_matches(text, "abca");
+    reverse(text, length(text));
+    sum += count_matches(text, "acba");
+  }
+  printf("%ld\n", sum);
+  return 0;
+}
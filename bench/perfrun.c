@@ -0,0 +1,107 @@
+// Runs a program several times and prints the wall time of the fastest
+// run in seconds and the number of user-space instructions it retired.
+// The instruction count is printed as "-" where perf_event_open is not
+// available.
+//
+// $ perfrun <runs> <program> [<args>...]
+
+#include <linux/perf_event.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+static long now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000000000L + ts.tv_nsec;
+}
+
+// Opens a counter of instructions retired by pid, which starts counting
+// when pid calls execve().
+static int open_counter(pid_t pid) {
+  struct perf_event_attr attr = {0};
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.size = sizeof(attr);
+  attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+  attr.disabled = 1;
+  attr.enable_on_exec = 1;
+  attr.inherit = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  return syscall(SYS_perf_event_open, &attr, pid, -1, -1, 0);
+}
+
+// Runs argv once. The child waits on a pipe until the counter is
+// attached, so that no instruction of the program goes uncounted.
+static int run(char **argv, long *ns, long *insns) {
+  int fds[2];
+  if (pipe(fds) < 0)
+    return -1;
+
+  pid_t pid = fork();
+  if (pid == 0) {
+    char c;
+    close(fds[1]);
+    if (read(fds[0], &c, 1) != 1)
+      _exit(127);
+    freopen("/dev/null", "w", stdout);
+    execvp(argv[0], argv);
+    perror(argv[0]);
+    _exit(127);
+  }
+
+  close(fds[0]);
+  int fd = open_counter(pid);
+  long start = now_ns();
+  write(fds[1], "x", 1);
+  close(fds[1]);
+
+  int status;
+  waitpid(pid, &status, 0);
+  *ns = now_ns() - start;
+
+  *insns = -1;
+  if (fd >= 0) {
+    long long count;
+    if (read(fd, &count, sizeof(count)) == sizeof(count))
+      *insns = count;
+    close(fd);
+  }
+
+  if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+    return -1;
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  if (argc < 3) {
+    fprintf(stderr, "usage: %s <runs> <program> [<args>...]\n", argv[0]);
+    return 1;
+  }
+
+  int runs = atoi(argv[1]);
+  long best_ns = -1;
+  long best_insns = -1;
+
+  for (int i = 0; i < runs; i++) {
+    long ns, insns;
+    if (run(argv + 2, &ns, &insns) < 0) {
+      fprintf(stderr, "%s: failed\n", argv[2]);
+      return 1;
+    }
+    if (best_ns < 0 || ns < best_ns) {
+      best_ns = ns;
+      best_insns = insns;
+    }
+  }
+
+  printf("%ld.%06ld ", best_ns / 1000000000, best_ns / 1000 % 1000000);
+  if (best_insns < 0)
+    printf("-\n");
+  else
+    printf("%ld\n", best_insns);
+  return 0;
+}
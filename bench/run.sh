@@ -0,0 +1,89 @@
+#!/bin/bash
+#
+# Measures how fast ccc compiles large synthetic inputs.
+#
+# $ ./bench/run.sh        # compare against bench/baseline
+# $ ./bench/run.sh -u     # overwrite bench/baseline with this run
+#
+# Each input is compiled $RUNS times and the fastest run is reported, as
+# timed by -ftime-report. A run more than $THRESHOLD percent slower than
+# the baseline is reported as a regression and makes the script fail.
+
+cd "$(dirname "$0")/.."
+
+CCC=${CCC:-./ccc}
+TMP=tmp-bench
+RUNS=${RUNS:-5}
+THRESHOLD=${THRESHOLD:-15}
+BASELINE=bench/baseline
+
+# kind:scale pairs passed to bench/gen.
+INPUTS="functions:2000 exprs:200 inits:200 globals:500 switch:100"
+
+update=0
+[ "$1" = -u ] && update=1
+
+mkdir -p $TMP
+gcc -O2 -o $TMP/gen bench/gen.c || exit 1
+
+# Prints the value in the given column of the line of the report starting
+# with the given label.
+field() {
+  awk -v label="$2" -v col="$3" '$1 == label { print $col; exit }' "$1"
+}
+
+printf "%-10s %8s %9s %12s %12s %12s %9s %8s\n" input KB seconds \
+       tokens/s nodes/s lines/s baseline change
+
+status=0
+new_baseline=""
+
+for input in $INPUTS; do
+  kind=${input%:*}
+  scale=${input#*:}
+  src=$TMP/$kind.c
+  $TMP/gen $kind $scale > $src
+
+  best=""
+  for i in $(seq $RUNS); do
+    if ! $CCC -ftime-report $src > $TMP/$kind.s 2> $TMP/$kind.report; then
+      cat $TMP/$kind.report
+      exit 1
+    fi
+    t=$(field $TMP/$kind.report TOTAL 2)
+    best=$(awk -v a="$best" -v b="$t" 'BEGIN { print (a == "" || b < a) ? b : a }')
+  done
+
+  tokens=$(field $TMP/$kind.report tokens 2)
+  nodes=$(field $TMP/$kind.report nodes 2)
+  lines=$(wc -l < $TMP/$kind.s)
+  kb=$(( $(wc -c < $src) / 1024 ))
+  base=$(awk -v input="$input" '$1 == input { print $2 }' $BASELINE 2>/dev/null)
+  new_baseline="$new_baseline$input $best"$'\n'
+
+  awk -v input=$kind -v kb=$kb -v t=$best -v tokens=$tokens -v nodes=$nodes \
+      -v lines=$lines -v base="$base" -v threshold=$THRESHOLD '
+    BEGIN {
+      printf "%-10s %8d %9.3f %12d %12d %12d", input, kb, t,
+             tokens / t, nodes / t, lines / t
+      if (base == "") {
+        printf " %9s %8s\n", "-", "-"
+        exit 0
+      }
+      change = (t - base) / base * 100
+      printf " %9.3f %+7.1f%%", base, change
+      if (change > threshold) {
+        printf "  REGRESSION\n"
+        exit 1
+      }
+      printf "\n"
+    }' || status=1
+done
+
+if [ $update = 1 ]; then
+  printf "%s" "$new_baseline" > $BASELINE
+  echo "updated $BASELINE"
+  exit 0
+fi
+
+exit $status
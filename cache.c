@@ -0,0 +1,62 @@
+#include "chibi.h"
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Directory holding the assembly of previously compiled functions, or NULL
+// if the cache is disabled.
+char *cache_dir;
+
+// A cache entry is named after a hash of its key. The file starts with the
+// length of the key and the key itself, so that a hash collision is
+// detected as a miss instead of splicing in the wrong function.
+static char *cache_path(char *key) {
+  long hash = 2166136261;
+  long len = strlen(key);
+  for (char *p = key; *p; p++)
+    hash = ((hash ^ (*p & 255)) * 16777619) & 0xffffffff;
+
+  char *path = malloc(strlen(cache_dir) + 40);
+  sprintf(path, "%s/%08lx-%lx.s", cache_dir, hash, len);
+  return path;
+}
+
+char *cache_load(char *key) {
+  FILE *fp = fopen(cache_path(key), "r");
+  if (!fp)
+    return NULL;
+
+  fseek(fp, 0, SEEK_END);
+  long size = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+
+  char *buf = malloc(size + 1);
+  size = fread(buf, 1, size, fp);
+  buf[size] = '\0';
+  fclose(fp);
+
+  char *p = buf;
+  long len = strtol(buf, &p, 10);
+  if (*p != '\n' || len != strlen(key) || p + 1 + len > buf + size ||
+      memcmp(p + 1, key, len))
+    return NULL;
+  return p + 1 + len;
+}
+
+// Storing is best effort: a cache that cannot be written to only costs
+// the next compilation its hits.
+void cache_store(char *key, char *buf, long len) {
+  mkdir(cache_dir, 0777);
+
+  char *path = cache_path(key);
+  char *tmp = malloc(strlen(path) + 20);
+  sprintf(tmp, "%s.%d", path, getpid());
+
+  FILE *fp = fopen(tmp, "w");
+  if (!fp)
+    return;
+  fprintf(fp, "%ld\n", strlen(key));
+  fwrite(key, 1, strlen(key), fp);
+  fwrite(buf, 1, len, fp);
+  fclose(fp);
+  rename(tmp, path);
+}
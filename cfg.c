@@ -0,0 +1,103 @@
+#include "chibi.h"
+
+// Control-flow graphs.
+//
+// The instructions of a function are split into basic blocks, runs of
+// instructions that are only entered at the top and only left at the
+// bottom. A block starts at a label or after a jump and ends before the
+// next one. Jumps to label 1, where the epilogue is added after register
+// allocation, leave the function and have no successor.
+//
+// The entries of a jump table follow the indirect jump that uses them in
+// a block of their own. The jump's successors are the targets of the
+// entries, and the table itself has neither successors nor predecessors.
+
+static bool ends_block(InstKind kind) {
+  return kind == I_JMP || kind == I_JCC || kind == I_RET;
+}
+
+bool is_table(CFG *cfg, Code *code, int b) {
+  Block *bb = &cfg->blocks[b];
+  int i = bb->start;
+  while (i < bb->end && code->insts[i].kind == I_LABEL)
+    i++;
+  return i < bb->end && code->insts[i].kind == I_ENTRY;
+}
+
+static void add_edge(CFG *cfg, int from, int to) {
+  Block *bb = &cfg->blocks[from];
+  for (int i = 0; i < bb->nsuccs; i++)
+    if (bb->succs[i] == to)
+      return;
+  bb->succs = reallocate(ALLOC_CODE, bb->succs, sizeof(int) * (bb->nsuccs + 1));
+  bb->succs[bb->nsuccs++] = to;
+
+  Block *succ = &cfg->blocks[to];
+  succ->preds = reallocate(ALLOC_CODE, succ->preds,
+                           sizeof(int) * (succ->npreds + 1));
+  succ->preds[succ->npreds++] = from;
+}
+
+static void add_label_edge(CFG *cfg, int from, int label) {
+  if (label != 1)
+    add_edge(cfg, from, cfg->label_block[label]);
+}
+
+CFG *build_cfg(Code *code) {
+  CFG *cfg = allocate(ALLOC_CODE, sizeof(CFG));
+  cfg->label_block = reallocate(ALLOC_CODE, NULL, sizeof(int) * code->nlabels);
+  for (int i = 0; i < code->nlabels; i++)
+    cfg->label_block[i] = -1;
+
+  // Consecutive labels start a single block.
+  int n = 0;
+  for (int i = 0; i < code->len; i++) {
+    InstKind kind = code->insts[i].kind;
+    if (i == 0 || (kind == I_LABEL && code->insts[i - 1].kind != I_LABEL) ||
+        ends_block(code->insts[i - 1].kind))
+      n++;
+  }
+
+  cfg->blocks = allocate(ALLOC_CODE, sizeof(Block) * n);
+  cfg->nblocks = 0;
+  for (int i = 0; i < code->len; i++) {
+    Inst *inst = &code->insts[i];
+    if (i == 0 || (inst->kind == I_LABEL && inst[-1].kind != I_LABEL) ||
+        ends_block(inst[-1].kind))
+      cfg->blocks[cfg->nblocks++].start = i;
+    cfg->blocks[cfg->nblocks - 1].end = i + 1;
+    if (inst->kind == I_LABEL)
+      cfg->label_block[inst->dst.val] = cfg->nblocks - 1;
+  }
+
+  for (int b = 0; b < cfg->nblocks; b++) {
+    Block *bb = &cfg->blocks[b];
+    if (is_table(cfg, code, b))
+      continue;
+
+    Inst *last = &code->insts[bb->end - 1];
+    if (last->kind == I_JMP && last->dst.kind == OP_REG) {
+      Block *table = &cfg->blocks[b + 1];
+      for (int i = table->start; i < table->end; i++)
+        if (code->insts[i].kind == I_ENTRY)
+          add_label_edge(cfg, b, code->insts[i].dst.val);
+      continue;
+    }
+
+    if (last->kind == I_JMP || last->kind == I_JCC)
+      add_label_edge(cfg, b, last->dst.val);
+    if (last->kind != I_JMP && last->kind != I_RET && b + 1 < cfg->nblocks)
+      add_edge(cfg, b, b + 1);
+  }
+  return cfg;
+}
+
+void free_cfg(CFG *cfg) {
+  for (int b = 0; b < cfg->nblocks; b++) {
+    free(cfg->blocks[b].succs);
+    free(cfg->blocks[b].preds);
+  }
+  free(cfg->blocks);
+  free(cfg->label_block);
+  free(cfg);
+}
@@ -9,10 +9,53 @@
 #include <stdlib.h>
 #include <string.h>
 #include <strings.h>
+#include <time.h>
 
 typedef struct Type Type;
 typedef struct Member Member;
 typedef struct Initializer Initializer;
+typedef struct Program Program;
+
+// main.c
+
+typedef enum {
+  PHASE_READ,
+  PHASE_TOKENIZE,
+  PHASE_PARSE,
+  PHASE_LAYOUT,
+  PHASE_EMIT_DATA,
+  PHASE_EMIT_TEXT,
+  PHASE_DONE,
+} Phase;
+
+extern char *phase_names[];
+extern Phase current_phase;
+extern bool time_report;
+
+long now_ns(void);
+void enter_phase(Phase phase);
+
+// alloc.c
+
+typedef enum {
+  ALLOC_TOKEN,
+  ALLOC_NODE,
+  ALLOC_TYPE,
+  ALLOC_MEMBER,
+  ALLOC_VAR,
+  ALLOC_SCOPE,
+  ALLOC_INITIALIZER,
+  ALLOC_FUNCTION,
+  ALLOC_CODE, // Instructions and the arrays of the back end
+  ALLOC_OTHER,
+  ALLOC_NKINDS,
+} AllocKind;
+
+extern bool mem_report;
+
+void *allocate(AllocKind kind, long size);
+void *reallocate(AllocKind kind, void *p, long size);
+void print_mem_report(Program *prog);
 
 // tokenize.c
 
@@ -28,7 +71,7 @@ typedef struct Token Token;
 struct Token {
   TokenKind kind;
   Token *next;
-  int val;
+  long val;
   Type *ty;
   char *str;
   int len;
@@ -65,6 +108,13 @@ struct Var {
 
   bool is_static;
   Initializer *initializer;
+
+  // Set by promote_vars(). A local variable in a register has no stack
+  // slot and is held by virtual register reg instead.
+  int uses;
+  bool addr_taken;
+  bool in_reg;
+  int reg;
 };
 
 typedef struct VarList VarList;
@@ -191,13 +241,26 @@ struct Function {
 
   Node *node;
   VarList *locals;
+  VarList *globals;
   int stack_size;
+  int nlabels;
+
+  char *cache_key;
+  char *cached_asm;
+
+  // -ftime-report
+  long parse_ns;
+  long gen_ns;
+  long num_nodes;
+  long num_insns;
 };
 
-typedef struct {
+struct Program {
   VarList *globals;
   Function *fns;
-} Program;
+};
+
+extern long num_nodes;
 
 Program *program(void);
 
@@ -253,6 +316,288 @@ Type *enum_type(void);
 Type *struct_type(void);
 void add_type(Node *node);
 
+// sink.c
+
+// An output sink collects bytes in a large buffer. It hands them to a file
+// descriptor whenever the buffer fills up, keeps them all in memory if it
+// has no file descriptor, or writes them into an mmap'd file.
+typedef struct {
+  char *buf;
+  long len;
+  long cap;
+  int fd;
+  bool mapped;
+} Sink;
+
+Sink *new_fd_sink(int fd);
+Sink *new_mem_sink(void);
+Sink *new_file_sink(char *path);
+void sink_reserve(Sink *s, long n);
+void sink_write(Sink *s, char *p, long len);
+void sink_str(Sink *s, char *str);
+void sink_char(Sink *s, int c);
+void sink_int(Sink *s, long val);
+char *write_int(char *p, long val);
+void sink_le(Sink *s, long val, int size);
+void sink_align(Sink *s, int align);
+void sink_close(Sink *s);
+
+// asm.c
+
+// Registers are numbered as in the instruction encoding.
+typedef enum {
+  RAX,
+  RCX,
+  RDX,
+  RBX,
+  RSP,
+  RBP,
+  RSI,
+  RDI,
+  R8,
+  R9,
+  R10,
+  R11,
+  R12,
+  R13,
+  R14,
+  R15,
+
+  // Registers from here on are virtual. Code generation uses as many as
+  // it likes and the register allocator maps them to the ones above.
+  VREG,
+} Reg;
+
+// Condition codes are numbered as in the encoding of jcc and setcc.
+typedef enum {
+  CC_E = 4,
+  CC_NE = 5,
+  CC_A = 7,
+  CC_L = 12,
+  CC_GE = 13,
+  CC_LE = 14,
+  CC_G = 15,
+} CondCode;
+
+typedef enum {
+  OP_NONE,
+  OP_REG,   // reg
+  OP_IMM,   // val
+  OP_MEM,   // [reg+index*scale+val], or [rip+sym+val] if sym is set.
+            // There is no index if scale is 0.
+  OP_LABEL, // Local label number val, or [rip+label] for lea
+  OP_SYM,   // Symbol sym
+} OperandKind;
+
+typedef struct {
+  OperandKind kind;
+  int size;
+  int reg;
+  int index;
+  int scale;
+  long val;
+  char *sym;
+} Operand;
+
+typedef enum {
+  I_LABEL,
+  I_MOV,
+  I_MOVSX,
+  I_MOVZX,
+  I_LEA,
+  I_PUSH,
+  I_POP,
+  I_ADD,
+  I_SUB,
+  I_IMUL,
+  I_CQO,
+  I_IDIV,
+  I_IMULH, // rdx:rax = rax * dst
+  I_AND,
+  I_OR,
+  I_XOR,
+  I_SHL,
+  I_SAR,
+  I_NOT,
+  I_CMP,
+  I_SETCC,
+  I_JMP,
+  I_JCC,
+  I_CALL,
+  I_RET,
+  I_ENTRY, // Jump table entry: the offset of label dst from label src
+  I_ALIGN, // Padding to the next 16 bytes, unless that is more than 10
+} InstKind;
+
+typedef struct {
+  InstKind kind;
+  CondCode cc;
+  Operand dst;
+  Operand src;
+} Inst;
+
+// The instructions of one function. Local labels are referred to by
+// number and named only when printed.
+typedef struct {
+  Inst *insts;
+  int len;
+  int cap;
+  char **labels;
+  int nlabels;
+  int labels_cap;
+  int nregs;
+  int nvars; // Virtual registers from VREG on that hold variables
+  int args;  // Bitmap of the registers holding arguments on entry
+} Code;
+
+void print_insts(Sink *out, Code *code, int start, int end);
+void print_code(Sink *out, Code *code);
+
+// cfg.c
+
+// A basic block is the run of instructions from start to end.
+typedef struct {
+  int start;
+  int end;
+  int *succs;
+  int nsuccs;
+  int *preds;
+  int npreds;
+} Block;
+
+typedef struct {
+  Block *blocks;
+  int nblocks;
+  int *label_block; // The block each label starts, or -1
+} CFG;
+
+CFG *build_cfg(Code *code);
+void free_cfg(CFG *cfg);
+bool is_table(CFG *cfg, Code *code, int b);
+
+// opt.c
+
+extern int opt_level;
+extern bool dump_code;
+
+void run_passes(Code *code, char *funcname);
+
+// jump.c
+
+void optimize_jumps(Code *code);
+
+// peephole.c
+
+void peephole(Code *code);
+
+// licm.c
+
+void hoist_invariants(Code *code);
+
+// regalloc.c
+
+int alloc_regs(Code *code, int frame_size, bool *used);
+
+// elf.c
+
+typedef enum {
+  SEC_UNDEF,
+  SEC_TEXT,
+  SEC_DATA,
+  SEC_BSS,
+} SectionKind;
+
+typedef enum {
+  R_X86_64_64 = 1,
+  R_X86_64_PC32 = 2,
+  R_X86_64_PLT32 = 4,
+} RelocType;
+
+typedef struct {
+  char *name;
+  SectionKind sec;
+  long offset;
+  long size;
+  bool is_global;
+  int index;
+} Symbol;
+
+typedef struct {
+  SectionKind sec;
+  long offset;
+  RelocType type;
+  char *sym;
+  long addend;
+} Reloc;
+
+// Machine code and data of a translation unit, with symbols and
+// relocations referring to symbols by name.
+typedef struct {
+  Sink *text;
+  Sink *data;
+  long bss_size;
+  int data_align;
+  int bss_align;
+
+  Symbol **syms;
+  int nsyms;
+  int syms_cap;
+  Symbol **map;
+  int map_cap;
+
+  Reloc *relocs;
+  int nrelocs;
+  int relocs_cap;
+} Object;
+
+Object *new_object(void);
+Symbol *find_symbol(Object *obj, char *name);
+Symbol *obj_symbol(Object *obj, char *name, SectionKind sec, bool is_global);
+void obj_reloc(Object *obj, SectionKind sec, long offset, RelocType type,
+               char *sym, long addend);
+void obj_add_globals(Object *obj, VarList *globals);
+void write_object(Object *obj, Sink *out);
+
+// promote.c
+
+void promote_vars(Function *fn);
+
+// inline.c
+
+extern bool no_inline;
+
+bool may_inline(Token *begin, Token *end);
+Function *find_inline(char *name);
+void inline_function(Function *fn, Token *begin, Token *end);
+
+// encode.c
+
+void encode_code(Object *obj, Code *code);
+void align_text(Object *obj);
+
+// jit.c
+
+void jit_add_library(char *name);
+void run_object(Object *obj, int argc, char **argv);
+
+// worker.c
+
+int start_worker(int *fd);
+void finish_worker(Sink *s, int fd);
+char *wait_worker(int pid, int fd, long *len);
+
 // codegen.c
 
-void codegen(Program *prog);
\ No newline at end of file
+extern long num_insns;
+extern int codegen_jobs;
+extern bool omit_frame_pointer;
+
+void codegen(Program *prog, Sink *out);
+Object *codegen_object(Program *prog);
+
+// cache.c
+
+extern char *cache_dir;
+
+char *cache_load(char *key);
+void cache_store(char *key, char *buf, long len);
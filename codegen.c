@@ -1,281 +1,849 @@
 #include "chibi.h"
 
-static char *argreg1[] = {"dil", "sil", "dl", "cl", "r8b", "r9b"};
-static char *argreg2[] = {"di", "si", "dx", "cx", "r8w", "r9w"};
-static char *argreg4[] = {"edi", "esi", "edx", "ecx", "r8d", "r9d"};
-static char *argreg8[] = {"rdi", "rsi", "rdx", "rcx", "r8", "r9"};
-
-static int labelseq = 1;
-static int brkseq;
-static int contseq;
+static int argreg[] = {RDI, RSI, RDX, RCX, R8, R9};
+
+// Output goes to out as assembly, or to obj as machine code.
+static Sink *out;
+static Object *obj;
+long num_insns;
+static Code *code;
+static int brk_label;
+static int cont_label;
 static char *funcname;
 
-static void gen(Node *node);
+static int gen_expr(Node *node);
+static int gen_value(Node *node);
+static void gen_stmt(Node *node);
+
+static int add_label(char *name) {
+  if (code->nlabels == code->labels_cap) {
+    code->labels_cap *= 2;
+    code->labels = reallocate(ALLOC_CODE, code->labels,
+                              sizeof(char *) * code->labels_cap);
+  }
+  code->labels[code->nlabels] = name;
+  return code->nlabels++;
+}
+
+static int new_label(char *kind) {
+  char *name = malloc(strlen(kind) + strlen(funcname) + 20);
+  sprintf(name, ".L.%s.%s.%d", kind, funcname, code->nlabels);
+  return add_label(name);
+}
+
+// Labels of goto statements are created on first use, which may come
+// before the label itself.
+static int goto_label(char *label_name) {
+  char *name = malloc(strlen(label_name) + strlen(funcname) + 20);
+  sprintf(name, ".L.label.%s.%s", funcname, label_name);
+  for (int i = 1; i < code->nlabels; i++)
+    if (!strcmp(code->labels[i], name))
+      return i;
+  return add_label(name);
+}
+
+static Inst *new_inst(InstKind kind) {
+  if (code->len == code->cap) {
+    code->cap *= 2;
+    code->insts = reallocate(ALLOC_CODE, code->insts, sizeof(Inst) * code->cap);
+  }
+  Inst *inst = &code->insts[code->len++];
+  inst->kind = kind;
+  inst->dst.kind = OP_NONE;
+  inst->dst.sym = NULL;
+  inst->src.kind = OP_NONE;
+  inst->src.sym = NULL;
+  return inst;
+}
+
+static void set_reg(Operand *op, int reg, int size) {
+  op->kind = OP_REG;
+  op->reg = reg;
+  op->size = size;
+  op->sym = NULL;
+}
+
+static void set_imm(Operand *op, long val) {
+  op->kind = OP_IMM;
+  op->val = val;
+  op->size = 8;
+  op->sym = NULL;
+}
+
+static void set_mem(Operand *op, int base, long disp, int size) {
+  op->kind = OP_MEM;
+  op->reg = base;
+  op->scale = 0;
+  op->val = disp;
+  op->size = size;
+  op->sym = NULL;
+}
+
+// cqo, ret
+static void emit(InstKind kind) { new_inst(kind); }
+
+// push rax, not rax, idiv rdi
+static void emit_r(InstKind kind, int reg) {
+  set_reg(&new_inst(kind)->dst, reg, 8);
+}
+
+// push 1
+static void emit_i(InstKind kind, long imm) {
+  set_imm(&new_inst(kind)->dst, imm);
+}
 
-static void gen_addr(Node *node) {
+// push [rsp]
+static void emit_m(InstKind kind, int base, long disp) {
+  set_mem(&new_inst(kind)->dst, base, disp, 8);
+}
+
+// add rax, rdi
+static void emit_rr(InstKind kind, int dst, int src, int size) {
+  Inst *inst = new_inst(kind);
+  set_reg(&inst->dst, dst, size);
+  set_reg(&inst->src, src, size);
+}
+
+// add rax, 8
+static void emit_ri(InstKind kind, int dst, long imm) {
+  Inst *inst = new_inst(kind);
+  set_reg(&inst->dst, dst, 8);
+  set_imm(&inst->src, imm);
+}
+
+// movsx rax, dword ptr [rax]
+static void emit_rm(InstKind kind, int dst, int dsize, int base, long disp,
+                    int msize) {
+  Inst *inst = new_inst(kind);
+  set_reg(&inst->dst, dst, dsize);
+  set_mem(&inst->src, base, disp, msize);
+}
+
+// mov [rax], edi
+static void emit_mr(InstKind kind, int base, long disp, int src, int size) {
+  Inst *inst = new_inst(kind);
+  set_mem(&inst->dst, base, disp, size);
+  set_reg(&inst->src, src, size);
+}
+
+// mov dword ptr [rax], 0
+static void emit_mi(InstKind kind, int base, long disp, long imm, int size) {
+  Inst *inst = new_inst(kind);
+  set_mem(&inst->dst, base, disp, size);
+  set_imm(&inst->src, imm);
+}
+
+// movsx rax, al
+static void emit_ext(InstKind kind, int dst, int src, int src_size) {
+  Inst *inst = new_inst(kind);
+  set_reg(&inst->dst, dst, 8);
+  set_reg(&inst->src, src, src_size);
+}
+
+static void emit_setcc(CondCode cc, int reg) {
+  Inst *inst = new_inst(I_SETCC);
+  inst->cc = cc;
+  set_reg(&inst->dst, reg, 1);
+}
+
+static void emit_jmp(int label) {
+  Inst *inst = new_inst(I_JMP);
+  inst->dst.kind = OP_LABEL;
+  inst->dst.val = label;
+}
+
+static void emit_jcc(CondCode cc, int label) {
+  Inst *inst = new_inst(I_JCC);
+  inst->cc = cc;
+  inst->dst.kind = OP_LABEL;
+  inst->dst.val = label;
+}
+
+static void emit_call(char *sym) {
+  Inst *inst = new_inst(I_CALL);
+  inst->dst.kind = OP_SYM;
+  inst->dst.sym = sym;
+}
+
+static void emit_label(int label) {
+  Inst *inst = new_inst(I_LABEL);
+  inst->dst.kind = OP_LABEL;
+  inst->dst.val = label;
+}
+
+static int new_reg(void) { return code->nregs++; }
+
+// Compares a value with zero and leaves the result in the flags.
+static void test_zero(int reg) { emit_ri(I_CMP, reg, 0); }
+
+static bool is_reg_var(Node *node) {
+  return node->kind == ND_VAR && node->var->in_reg;
+}
+
+// Makes a memory operand that refers to an lvalue. Variables and their
+// members are addressed relative to rbp or rip, and everything else
+// relative to a register holding a pointer.
+static void gen_mem(Node *node, Operand *mem) {
   switch (node->kind) {
   case ND_VAR: {
     if (node->init)
-      gen(node->init);
+      gen_stmt(node->init);
 
     Var *var = node->var;
+    if (var->in_reg)
+      error_tok(node->tok, "variable in a register has no address");
     if (var->is_local) {
-      printf("  lea rax, [rbp-%d]\n", var->offset);
-      printf("  push rax\n");
-    } else {
-      printf("  push offset %s\n", var->name);
+      set_mem(mem, RBP, -var->offset, 8);
+      return;
     }
+    set_mem(mem, 0, 0, 8);
+    mem->sym = var->name;
     return;
   }
   case ND_DEREF:
-    gen(node->lhs);
+    set_mem(mem, gen_value(node->lhs), 0, 8);
     return;
   case ND_MEMBER:
-    gen_addr(node->lhs);
-    printf("  pop rax\n");
-    printf("  add rax, %d\n", node->member->offset);
-    printf("  push rax\n");
+    gen_mem(node->lhs, mem);
+    mem->val += node->member->offset;
     return;
   }
 
   error_tok(node->tok, "not an lvalue");
 }
 
-static void gen_lval(Node *node) {
+static int copy(int reg) {
+  int tmp = new_reg();
+  emit_rr(I_MOV, tmp, reg, 8);
+  return tmp;
+}
+
+// Returns a register holding the address of an lvalue.
+static int gen_addr(Node *node) {
+  Operand mem;
+  gen_mem(node, &mem);
+  if (!mem.sym && !mem.val)
+    return copy(mem.reg);
+
+  Inst *inst = new_inst(I_LEA);
+  set_reg(&inst->dst, new_reg(), 8);
+  memcpy(&inst->src, &mem, sizeof(Operand));
+  return inst->dst.reg;
+}
+
+// An lvalue is a memory operand, or a register operand for a variable in
+// a register.
+static void gen_lval(Node *node, Operand *lval) {
   if (node->ty->kind == TY_ARRAY)
     error_tok(node->tok, "not an lvalue");
-  gen_addr(node);
+  if (!is_reg_var(node)) {
+    gen_mem(node, lval);
+    return;
+  }
+  if (node->init)
+    gen_stmt(node->init);
+  set_reg(lval, node->var->reg, 8);
 }
 
-static void load(Type *ty) {
-  printf("  pop rax\n");
-  if (ty->size == 1)
-    printf("  movsx rax, byte ptr [rax]\n");
-  else if (ty->size == 2)
-    printf("  movsx rax, word ptr [rax]\n");
-  else if (ty->size == 4)
-    printf("  movsxd rax, dword ptr [rax]\n");
-  else {
-    assert(ty->size == 8);
-    printf("  mov rax, [rax]\n");
-  }
-  printf("  push rax\n");
+static int load(Type *ty, Operand *mem) {
+  Inst *inst = new_inst(ty->size == 8 ? I_MOV : I_MOVSX);
+  set_reg(&inst->dst, new_reg(), 8);
+  memcpy(&inst->src, mem, sizeof(Operand));
+  inst->src.size = ty->size;
+  return inst->dst.reg;
+}
+
+static void to_bool(int reg) {
+  test_zero(reg);
+  emit_setcc(CC_NE, reg);
+  emit_ext(I_MOVZX, reg, reg, 1);
 }
 
-static void store(Type *ty) {
-  printf("  pop rdi\n");
-  printf("  pop rax\n");
+static int store(Type *ty, Operand *mem, int reg) {
+  if (ty->kind == TY_BOOL)
+    to_bool(reg);
+
+  assert(ty->size == 1 || ty->size == 2 || ty->size == 4 || ty->size == 8);
+  Inst *inst = new_inst(I_MOV);
+  memcpy(&inst->dst, mem, sizeof(Operand));
+  inst->dst.size = ty->size;
+  set_reg(&inst->src, reg, ty->size);
+  return reg;
+}
 
+static int truncate(Type *ty, int reg) {
   if (ty->kind == TY_BOOL) {
-    printf("  cmp rdi, 0\n");
-    printf("  setne dil\n");
-    printf("  movzb rdi, dil\n");
+    test_zero(reg);
+    emit_setcc(CC_NE, reg);
   }
 
-  if (ty->size == 1)
-    printf("  mov [rax], dil\n");
-  else if (ty->size == 2)
-    printf("  mov [rax], di\n");
-  else if (ty->size == 4)
-    printf("  mov [rax], edi\n");
-  else {
-    assert(ty->size == 8);
-    printf("  mov [rax], rdi\n");
+  if (ty->size < 8)
+    emit_ext(I_MOVSX, reg, reg, ty->size);
+  return reg;
+}
+
+// A variable in a register holds its value sign-extended to 64 bits, as
+// it would be after loading it from memory.
+static int load_lval(Node *node, Operand *lval) {
+  if (lval->kind == OP_REG)
+    return copy(lval->reg);
+  return load(node->ty, lval);
+}
+
+static int store_lval(Node *node, Operand *lval, int reg) {
+  if (lval->kind == OP_REG) {
+    truncate(node->ty, reg);
+    emit_rr(I_MOV, lval->reg, reg, 8);
+    return reg;
   }
+  return store(node->ty, lval, reg);
+}
 
-  printf("  push rdi\n");
+static void inc(Type *ty, int reg) {
+  emit_ri(I_ADD, reg, ty->base ? ty->base->size : 1);
 }
 
-static void truncate(Type *ty) {
-  printf("  pop rax\n");
+static void dec(Type *ty, int reg) {
+  emit_ri(I_SUB, reg, ty->base ? ty->base->size : 1);
+}
 
-  if (ty->kind == TY_BOOL) {
-    printf("  cmp rax, 0\n");
-    printf("  setne al\n");
+// op lhs, rhs
+static void emit_op(InstKind kind, int lhs, Operand *rhs) {
+  Inst *inst = new_inst(kind);
+  set_reg(&inst->dst, lhs, 8);
+  memcpy(&inst->src, rhs, sizeof(Operand));
+}
+
+// The result goes to a new register so that the operands need not live
+// past the comparison.
+static int gen_compare(CondCode cc, int lhs, Operand *rhs) {
+  int reg = new_reg();
+  emit_op(I_CMP, lhs, rhs);
+  emit_setcc(cc, reg);
+  emit_ext(I_MOVZX, reg, reg, 1);
+  return reg;
+}
+
+// shl lhs, cl
+static void gen_shift(InstKind kind, int lhs, Operand *rhs) {
+  Inst *inst;
+  if (rhs->kind == OP_IMM) {
+    inst = new_inst(kind);
+    set_imm(&inst->src, rhs->val & 63);
+  } else {
+    emit_rr(I_MOV, RCX, rhs->reg, 8);
+    inst = new_inst(kind);
+    set_reg(&inst->src, RCX, 1);
   }
+  set_reg(&inst->dst, lhs, 8);
+}
+
+// idiv leaves the quotient in rax.
+static void gen_div(int lhs, int rhs) {
+  emit_rr(I_MOV, RAX, lhs, 8);
+  emit(I_CQO);
+  emit_r(I_IDIV, rhs);
+  emit_rr(I_MOV, lhs, RAX, 8);
+}
 
-  if (ty->size == 1)
-    printf("  movsx rax, al\n");
-  else if (ty->size == 2)
-    printf("  movsx rax, ax\n");
-  else if (ty->size == 4)
-    printf("  movsxd rax, eax\n");
-  printf("  push rax\n");
+// Returns k if val is 2^k, or -1.
+static int log2_of(long val) {
+  for (int k = 0; k < 63; k++)
+    if (val == 1L << k)
+      return k;
+  return -1;
 }
 
-static void inc(Type *ty) {
-  printf("  pop rax\n");
-  printf("  add rax, %d\n", ty->base ? ty->base->size : 1);
-  printf("  push rax\n");
+// Returns m - 2^64 for the 64-bit multiplier m = 2^(63+l) / d + 1, where
+// 2^(l-1) < d < 2^l, and sets *shift to l - 1. The high half of n * m
+// shifted right by l - 1 is then n / d for any n >= 0, and one more for
+// n < 0 [Granlund and Montgomery, 1994].
+static long div_magic(long d, int *shift) {
+  int l = 0;
+  while (1L << l < d)
+    l++;
+  *shift = l - 1;
+
+  // 2^(63+l) / d is at least 2^63 and less than 2^64, so the long
+  // division only keeps the low 63 bits of the quotient.
+  long q = 0;
+  long r = 1;
+  for (int i = 0; i < 63 + l; i++) {
+    r *= 2;
+    q = (q & ((1L << 62) - 1)) * 2;
+    if (r >= d) {
+      q++;
+      r -= d;
+    }
+  }
+  return q + 1 - (1L << 62) - (1L << 62);
 }
 
-static void dec(Type *ty) {
-  printf("  pop rax\n");
-  printf("  sub rax, %d\n", ty->base ? ty->base->size : 1);
-  printf("  push rax\n");
+// Divides a register by a nonzero constant, rounding toward zero as idiv
+// does, but without idiv.
+static void gen_div_imm(int reg, long d) {
+  long ad = d < 0 ? -d : d;
+  int k = log2_of(ad);
+
+  if (k > 0) {
+    // A negative dividend is biased by d - 1 so that the shift rounds it
+    // toward zero.
+    int bias = new_reg();
+    emit_rr(I_MOV, bias, reg, 8);
+    emit_ri(I_SAR, bias, 63);
+    emit_ri(I_AND, bias, ad - 1);
+    emit_rr(I_ADD, reg, bias, 8);
+    emit_ri(I_SAR, reg, k);
+  } else if (k < 0) {
+    int shift;
+    emit_ri(I_MOV, RAX, div_magic(ad, &shift));
+    emit_r(I_IMULH, reg);
+    emit_rr(I_ADD, RDX, reg, 8);
+    if (shift)
+      emit_ri(I_SAR, RDX, shift);
+    emit_ri(I_SAR, reg, 63);
+    emit_rr(I_SUB, RDX, reg, 8);
+    emit_rr(I_MOV, reg, RDX, 8);
+  }
+
+  if (d < 0)
+    emit_ri(I_IMUL, reg, -1);
 }
 
-static void gen_binary(Node *node) {
-  printf("  pop rdi\n");
-  printf("  pop rax\n");
+static int to_reg(Operand *op) {
+  if (op->kind == OP_REG)
+    return op->reg;
+  int reg = new_reg();
+  emit_ri(I_MOV, reg, op->val);
+  return reg;
+}
 
+static bool is_ptr_arith(Node *node) {
+  switch (node->kind) {
+  case ND_PTR_ADD:
+  case ND_PTR_ADD_EQ:
+  case ND_PTR_SUB:
+  case ND_PTR_SUB_EQ:
+    return true;
+  }
+  return false;
+}
+
+// Multiplies a register by a constant. Factors of 3, 5 and 9 are taken
+// with lea and powers of two with shl, which are quicker than imul.
+static void gen_mul_imm(int reg, long val) {
+  int shift = 0;
+  while (val > 0 && !(val & (1L << shift)))
+    shift++;
+  long m = val > 0 ? val >> shift : 0;
+  if (m != 1 && m != 3 && m != 5 && m != 9) {
+    emit_ri(I_IMUL, reg, val);
+    return;
+  }
+
+  if (m > 1) {
+    Inst *inst = new_inst(I_LEA);
+    set_reg(&inst->dst, reg, 8);
+    set_mem(&inst->src, reg, 0, 8);
+    inst->src.index = reg;
+    inst->src.scale = m - 1;
+  }
+  if (shift)
+    emit_ri(I_SHL, reg, shift);
+}
+
+// Evaluates the right-hand side of a binary operator, scaled by the size
+// of the pointee for pointer arithmetic. A constant that fits in 32 bits
+// becomes an immediate, which every instruction but idiv can take.
+static void gen_rhs(Node *node, Operand *op) {
+  long scale = is_ptr_arith(node) ? node->ty->base->size : 1;
+  Node *rhs = node->rhs;
+  if (rhs->kind == ND_NUM && rhs->val * scale == (int)(rhs->val * scale)) {
+    set_imm(op, rhs->val * scale);
+    return;
+  }
+
+  int reg = gen_value(rhs);
+  if (scale != 1) {
+    reg = copy(reg);
+    gen_mul_imm(reg, scale);
+  }
+  set_reg(op, reg, 8);
+}
+
+// Every value is used once, so the result goes to the register of the
+// left-hand side unless it is a comparison. The right-hand side is only
+// read.
+static int gen_binary(Node *node, int lhs, Operand *rhs) {
   switch (node->kind) {
   case ND_ADD:
   case ND_ADD_EQ:
-    printf("  add rax, rdi\n");
-    break;
   case ND_PTR_ADD:
   case ND_PTR_ADD_EQ:
-    printf("  imul rdi, %d\n", node->ty->base->size);
-    printf("  add rax, rdi\n");
+    emit_op(I_ADD, lhs, rhs);
     break;
   case ND_SUB:
   case ND_SUB_EQ:
-    printf("  sub rax, rdi\n");
-    break;
   case ND_PTR_SUB:
   case ND_PTR_SUB_EQ:
-    printf("  imul rdi, %d\n", node->ty->base->size);
-    printf("  sub rax, rdi\n");
+    emit_op(I_SUB, lhs, rhs);
     break;
-  case ND_PTR_DIFF:
-    printf("  sub rax, rdi\n");
-    printf("  cqo\n");
-    printf("  mov rdi, %d\n", node->lhs->ty->base->size);
-    printf("  idiv rdi\n");
+  case ND_PTR_DIFF: {
+    // The difference is a multiple of the size, so a shift divides it
+    // exactly if the size is a power of two.
+    emit_op(I_SUB, lhs, rhs);
+    int size = node->lhs->ty->base->size;
+    int shift = log2_of(size);
+    if (shift > 0) {
+      emit_ri(I_SAR, lhs, shift);
+    } else if (shift < 0) {
+      gen_div_imm(lhs, size);
+    }
     break;
+  }
   case ND_MUL:
   case ND_MUL_EQ:
-    printf("  imul rax, rdi\n");
+    if (rhs->kind == OP_IMM)
+      gen_mul_imm(lhs, rhs->val);
+    else
+      emit_op(I_IMUL, lhs, rhs);
     break;
   case ND_DIV:
   case ND_DIV_EQ:
-    printf("  cqo\n");
-    printf("  idiv rdi\n");
+    if (rhs->kind == OP_IMM && rhs->val)
+      gen_div_imm(lhs, rhs->val);
+    else
+      gen_div(lhs, to_reg(rhs));
     break;
   case ND_BITAND:
   case ND_BITAND_EQ:
-    printf("  and rax, rdi\n");
+    emit_op(I_AND, lhs, rhs);
     break;
   case ND_BITOR:
   case ND_BITOR_EQ:
-    printf("  or rax, rdi\n");
+    emit_op(I_OR, lhs, rhs);
     break;
   case ND_BITXOR:
   case ND_BITXOR_EQ:
-    printf("  xor rax, rdi\n");
+    emit_op(I_XOR, lhs, rhs);
     break;
   case ND_SHL:
   case ND_SHL_EQ:
-    printf("  mov cl, dil\n");
-    printf("  shl rax, cl\n");
+    gen_shift(I_SHL, lhs, rhs);
     break;
   case ND_SHR:
   case ND_SHR_EQ:
-    printf("  mov cl, dil\n");
-    printf("  sar rax, cl\n");
+    gen_shift(I_SAR, lhs, rhs);
     break;
   case ND_EQ:
-    printf("  cmp rax, rdi\n");
-    printf("  sete al\n");
-    printf("  movzb rax, al\n");
-    break;
+    return gen_compare(CC_E, lhs, rhs);
   case ND_NE:
-    printf("  cmp rax, rdi\n");
-    printf("  setne al\n");
-    printf("  movzb rax, al\n");
-    break;
+    return gen_compare(CC_NE, lhs, rhs);
   case ND_LT:
-    printf("  cmp rax, rdi\n");
-    printf("  setl al\n");
-    printf("  movzb rax, al\n");
-    break;
+    return gen_compare(CC_L, lhs, rhs);
   case ND_LE:
-    printf("  cmp rax, rdi\n");
-    printf("  setle al\n");
-    printf("  movzb rax, al\n");
-    break;
+    return gen_compare(CC_LE, lhs, rhs);
   }
+  return lhs;
+}
 
-  printf("  push rax\n");
+// ++x or --x
+static int gen_pre_inc(Node *node, bool is_inc) {
+  Operand lval;
+  gen_lval(node->lhs, &lval);
+  int reg = load_lval(node->lhs, &lval);
+  if (is_inc)
+    inc(node->ty, reg);
+  else
+    dec(node->ty, reg);
+  return store_lval(node->lhs, &lval, reg);
 }
 
-static void gen(Node *node) {
+// x++ or x--. The old value is got back by undoing the change on the
+// stored one, except for a _Bool, whose stored value is 0 or 1 whatever
+// the old one was.
+static int gen_post_inc(Node *node, bool is_inc) {
+  Operand lval;
+  gen_lval(node->lhs, &lval);
+  int reg = load_lval(node->lhs, &lval);
+  int old = node->ty->kind == TY_BOOL ? copy(reg) : -1;
+  if (is_inc)
+    inc(node->ty, reg);
+  else
+    dec(node->ty, reg);
+  store_lval(node->lhs, &lval, reg);
+  if (old >= 0)
+    return old;
+  if (is_inc)
+    dec(node->ty, reg);
+  else
+    inc(node->ty, reg);
+  return reg;
+}
+
+// The condition code of a comparison operator, or -1.
+static int compare_cc(NodeKind kind) {
+  switch (kind) {
+  case ND_EQ:
+    return CC_E;
+  case ND_NE:
+    return CC_NE;
+  case ND_LT:
+    return CC_L;
+  case ND_LE:
+    return CC_LE;
+  }
+  return -1;
+}
+
+// Evaluates an expression and jumps to label if it compares to zero as cc
+// says, that is, if it is false for CC_E and true for CC_NE. Comparisons
+// set the flags for the jump themselves instead of producing 0 or 1 first,
+// and the logical operators only jump.
+static void gen_branch(Node *node, CondCode cc, int label) {
   switch (node->kind) {
-  case ND_NULL:
-    return;
   case ND_NUM:
-    if (node->val == (int)node->val) {
-      printf("  push %ld\n", node->val);
-    } else {
-      printf("  movabs rax, %ld\n", node->val);
-      printf("  push rax\n");
+    if ((node->val != 0) == (cc == CC_NE))
+      emit_jmp(label);
+    return;
+  case ND_NOT:
+    gen_branch(node->lhs, cc == CC_E ? CC_NE : CC_E, label);
+    return;
+  case ND_LOGAND:
+  case ND_LOGOR: {
+    // Jumps on a && b if it is false or on a || b if it is true only need
+    // the operands to jump to the same place.
+    CondCode short_cc = node->kind == ND_LOGAND ? CC_E : CC_NE;
+    if (cc == short_cc) {
+      gen_branch(node->lhs, cc, label);
+      gen_branch(node->rhs, cc, label);
+      return;
     }
+    int skip = new_label("skip");
+    gen_branch(node->lhs, short_cc, skip);
+    gen_branch(node->rhs, cc, label);
+    emit_label(skip);
     return;
-  case ND_EXPR_STMT:
-    gen(node->lhs);
-    printf("  add rsp, 8\n");
+  }
+  }
+
+  int cmp = compare_cc(node->kind);
+  if (cmp < 0) {
+    test_zero(gen_value(node));
+    emit_jcc(cc, label);
     return;
-  case ND_VAR:
-    if (node->init)
-      gen(node->init);
-    gen_addr(node);
-    if (node->ty->kind != TY_ARRAY)
-      load(node->ty);
+  }
+
+  // The parser turns a > b into b < a, which often puts a constant on the
+  // left. The operands are swapped back so that it becomes an immediate.
+  int lhs;
+  Operand rhs;
+  Node *num = node->lhs;
+  if (num->kind == ND_NUM && num->val == (int)num->val) {
+    lhs = gen_expr(node->rhs);
+    set_imm(&rhs, num->val);
+    if (cmp == CC_L)
+      cmp = CC_G;
+    else if (cmp == CC_LE)
+      cmp = CC_GE;
+  } else {
+    lhs = gen_expr(node->lhs);
+    gen_rhs(node, &rhs);
+  }
+  emit_op(I_CMP, lhs, &rhs);
+
+  // Flipping the lowest bit negates a condition code.
+  emit_jcc(cc == CC_NE ? cmp : cmp ^ 1, label);
+}
+
+// Returns the cases of a switch statement in order of their values. They
+// are linked in reverse order of appearance, which is usually descending.
+static Node **sort_cases(Node *list, int n) {
+  Node **cases = malloc(sizeof(Node *) * n);
+  int i = n;
+  for (Node *c = list; c; c = c->case_next)
+    cases[--i] = c;
+
+  for (i = 1; i < n; i++) {
+    Node *c = cases[i];
+    int j = i;
+    for (; j > 0 && cases[j - 1]->val > c->val; j--)
+      cases[j] = cases[j - 1];
+    cases[j] = c;
+  }
+  return cases;
+}
+
+// A switch dispatches through a jump table if the case values are dense
+// enough, that is, if there are at least min_table_cases of them and the
+// table has no more than max_table_ratio entries per case.
+static int min_table_cases = 4;
+static int max_table_ratio = 3;
+
+// Cases are compared one by one if there are no more than this many.
+static int max_linear_cases = 3;
+
+// Like emit_ri, but an immediate that does not fit in 32 bits is loaded
+// into a register first, since only mov can take a 64-bit one.
+static void emit_ri_wide(InstKind kind, int dst, long imm) {
+  if (imm == (int)imm) {
+    emit_ri(kind, dst, imm);
     return;
-  case ND_MEMBER:
-    gen_addr(node);
-    if (node->ty->kind != TY_ARRAY)
-      load(node->ty);
+  }
+  int tmp = new_reg();
+  emit_ri(I_MOV, tmp, imm);
+  emit_rr(kind, dst, tmp, 8);
+}
+
+// The table follows the indirect jump and holds the offsets of the case
+// labels from the table itself, so it needs no relocations.
+static void gen_jump_table(int reg, Node **cases, int n, int dflt) {
+  long lo = cases[0]->val;
+  long range = cases[n - 1]->val - lo + 1;
+  int table = new_label("table");
+
+  // Values below the lowest case wrap around to large unsigned numbers,
+  // so a single comparison checks both bounds.
+  int idx = copy(reg);
+  if (lo)
+    emit_ri_wide(I_SUB, idx, lo);
+  emit_ri(I_CMP, idx, range - 1);
+  emit_jcc(CC_A, dflt);
+
+  int base = new_reg();
+  Inst *inst = new_inst(I_LEA);
+  set_reg(&inst->dst, base, 8);
+  inst->src.kind = OP_LABEL;
+  inst->src.val = table;
+  emit_ri(I_SHL, idx, 2);
+  emit_rr(I_ADD, idx, base, 8);
+  emit_rm(I_MOVSX, idx, 8, idx, 0, 4);
+  emit_rr(I_ADD, idx, base, 8);
+  emit_r(I_JMP, idx);
+
+  emit_label(table);
+  int i = 0;
+  for (long val = lo; val < lo + range; val++) {
+    inst = new_inst(I_ENTRY);
+    inst->dst.kind = OP_LABEL;
+    inst->dst.val = dflt;
+    inst->src.kind = OP_LABEL;
+    inst->src.val = table;
+    if (cases[i]->val == val)
+      inst->dst.val = cases[i++]->case_label;
+  }
+}
+
+// Jumps to the case whose value is in reg, or to dflt if there is none.
+// The cases are sorted. Dense runs of them go through jump tables, and
+// others are split in half by a comparison with the middle one.
+static void gen_dispatch(int reg, Node **cases, int n, int dflt) {
+  if (n >= min_table_cases &&
+      cases[n - 1]->val - cases[0]->val < (long)n * max_table_ratio) {
+    gen_jump_table(reg, cases, n, dflt);
     return;
-  case ND_ASSIGN:
-    gen_lval(node->lhs);
-    gen(node->rhs);
-    store(node->ty);
+  }
+
+  if (n <= max_linear_cases) {
+    for (int i = 0; i < n; i++) {
+      emit_ri_wide(I_CMP, reg, cases[i]->val);
+      emit_jcc(CC_E, cases[i]->case_label);
+    }
+    emit_jmp(dflt);
     return;
+  }
+
+  int mid = n / 2;
+  int upper = new_label("upper");
+  emit_ri_wide(I_CMP, reg, cases[mid]->val);
+  emit_jcc(CC_E, cases[mid]->case_label);
+  emit_jcc(CC_G, upper);
+  gen_dispatch(reg, cases, mid, dflt);
+  emit_label(upper);
+  gen_dispatch(reg, cases + mid + 1, n - mid - 1, dflt);
+}
+
+static int gen_funcall(Node *node) {
+  if (!strcmp(node->funcname, "__builtin_va_start")) {
+    int ap = gen_expr(node->args);
+    int tmp = new_reg();
+    emit_rm(I_MOV, tmp, 4, RBP, -8, 4);
+    emit_mr(I_MOV, ap, 0, tmp, 4);
+    emit_mi(I_MOV, ap, 4, 48, 4);
+    emit_rm(I_LEA, tmp, 8, RBP, 16, 8);
+    emit_mr(I_MOV, ap, 8, tmp, 8);
+    emit_rm(I_LEA, tmp, 8, RBP, -56, 8);
+    emit_mr(I_MOV, ap, 16, tmp, 8);
+    return ap;
+  }
+
+  int args[6];
+  int nargs = 0;
+  for (Node *arg = node->args; arg; arg = arg->next)
+    args[nargs++] = gen_value(arg);
+
+  for (int i = 0; i < nargs; i++)
+    emit_rr(I_MOV, argreg[i], args[i], 8);
+
+  // Values live in registers or in the frame, so nothing is ever pushed
+  // and rsp stays where the prologue put it. The frame size is a multiple
+  // of 16, so rsp is aligned as the ABI requires at every call. al holds
+  // the number of vector registers used by variadic arguments.
+  emit_ri(I_MOV, RAX, 0);
+  emit_call(node->funcname);
+
+  int reg = new_reg();
+  if (node->ty->kind == TY_BOOL)
+    emit_ext(I_MOVZX, reg, RAX, 1);
+  else
+    emit_rr(I_MOV, reg, RAX, 8);
+  return reg;
+}
+
+// Returns the register that holds the value of an expression.
+static int gen_expr(Node *node) {
+  switch (node->kind) {
+  case ND_NUM: {
+    int reg = new_reg();
+    emit_ri(I_MOV, reg, node->val);
+    return reg;
+  }
+  case ND_VAR:
+  case ND_MEMBER:
+  case ND_DEREF: {
+    if (node->kind == ND_DEREF && node->ty->kind == TY_ARRAY)
+      return gen_expr(node->lhs);
+    if (node->ty->kind == TY_ARRAY)
+      return gen_addr(node);
+    Operand lval;
+    gen_lval(node, &lval);
+    return load_lval(node, &lval);
+  }
+  case ND_ASSIGN: {
+    Operand lval;
+    gen_lval(node->lhs, &lval);
+    return store_lval(node->lhs, &lval, gen_expr(node->rhs));
+  }
   case ND_TERNARY: {
-    int seq = labelseq++;
-    gen(node->cond);
-    printf("  pop rax\n");
-    printf("  cmp rax, 0\n");
-    printf("  je .L.else.%d\n", seq);
-    gen(node->then);
-    printf("  jmp .L.end.%d\n", seq);
-    printf(".L.else.%d:\n", seq);
-    gen(node->els);
-    printf(".L.end.%d:\n", seq);
-    return;
+    int els = new_label("else");
+    int end = new_label("end");
+    int reg = new_reg();
+    gen_branch(node->cond, CC_E, els);
+    emit_rr(I_MOV, reg, gen_value(node->then), 8);
+    emit_jmp(end);
+    emit_label(els);
+    emit_rr(I_MOV, reg, gen_value(node->els), 8);
+    emit_label(end);
+    return reg;
   }
   case ND_PRE_INC:
-    gen_lval(node->lhs);
-    printf("  push [rsp]\n");
-    load(node->ty);
-    inc(node->ty);
-    store(node->ty);
-    return;
+    return gen_pre_inc(node, true);
   case ND_PRE_DEC:
-    gen_lval(node->lhs);
-    printf("  push [rsp]\n");
-    load(node->ty);
-    dec(node->ty);
-    store(node->ty);
-    return;
+    return gen_pre_inc(node, false);
   case ND_POST_INC:
-    gen_lval(node->lhs);
-    printf("  push [rsp]\n");
-    load(node->ty);
-    inc(node->ty);
-    store(node->ty);
-    dec(node->ty);
-    return;
+    return gen_post_inc(node, true);
   case ND_POST_DEC:
-    gen_lval(node->lhs);
-    printf("  push [rsp]\n");
-    load(node->ty);
-    dec(node->ty);
-    store(node->ty);
-    inc(node->ty);
-    return;
+    return gen_post_inc(node, false);
   case ND_ADD_EQ:
   case ND_PTR_ADD_EQ:
   case ND_SUB_EQ:
@@ -286,368 +854,782 @@ static void gen(Node *node) {
   case ND_SHR_EQ:
   case ND_BITAND_EQ:
   case ND_BITOR_EQ:
-  case ND_BITXOR_EQ:
-    gen_lval(node->lhs);
-    printf("  push [rsp]\n");
-    load(node->lhs->ty);
-    gen(node->rhs);
-    gen_binary(node);
-    store(node->ty);
-    return;
+  case ND_BITXOR_EQ: {
+    // The variable is read right before it is written, so that the
+    // peephole pass can turn the three into a single instruction.
+    Operand lval;
+    Operand rhs;
+    gen_lval(node->lhs, &lval);
+    gen_rhs(node, &rhs);
+    int reg = load_lval(node->lhs, &lval);
+    reg = gen_binary(node, reg, &rhs);
+    return store_lval(node->lhs, &lval, reg);
+  }
   case ND_COMMA:
-    gen(node->lhs);
-    gen(node->rhs);
-    return;
+    gen_stmt(node->lhs);
+    return gen_expr(node->rhs);
   case ND_ADDR:
-    gen_addr(node->lhs);
-    return;
-  case ND_DEREF:
-    gen(node->lhs);
-    if (node->ty->kind != TY_ARRAY)
-      load(node->ty);
-    return;
-  case ND_NOT:
-    gen(node->lhs);
-    printf("  pop rax\n");
-    printf("  cmp rax, 0\n");
-    printf("  sete al\n");
-    printf("  movzb rax, al\n");
-    printf("  push rax\n");
-    return;
-  case ND_BITNOT:
-    gen(node->lhs);
-    printf("  pop rax\n");
-    printf("  not rax\n");
-    printf("  push rax\n");
-    return;
+    return gen_addr(node->lhs);
+  case ND_NOT: {
+    int reg = gen_expr(node->lhs);
+    test_zero(reg);
+    emit_setcc(CC_E, reg);
+    emit_ext(I_MOVZX, reg, reg, 1);
+    return reg;
+  }
+  case ND_BITNOT: {
+    int reg = gen_expr(node->lhs);
+    emit_r(I_NOT, reg);
+    return reg;
+  }
   case ND_LOGAND: {
-    int seq = labelseq++;
-    gen(node->lhs);
-    printf("  pop rax\n");
-    printf("  cmp rax, 0\n");
-    printf("  je .L.false.%d\n", seq);
-    gen(node->rhs);
-    printf("  pop rax\n");
-    printf("  cmp rax, 0\n");
-    printf("  je .L.false.%d\n", seq);
-    printf("  push 1\n");
-    printf("  jmp .L.end.%d\n", seq);
-    printf(".L.false.%d:\n", seq);
-    printf("  push 0\n");
-    printf(".L.end.%d:\n", seq);
-    return;
+    int f = new_label("false");
+    int end = new_label("end");
+    int reg = new_reg();
+    gen_branch(node->lhs, CC_E, f);
+    gen_branch(node->rhs, CC_E, f);
+    emit_ri(I_MOV, reg, 1);
+    emit_jmp(end);
+    emit_label(f);
+    emit_ri(I_MOV, reg, 0);
+    emit_label(end);
+    return reg;
   }
   case ND_LOGOR: {
-    int seq = labelseq++;
-    gen(node->lhs);
-    printf("  pop rax\n");
-    printf("  cmp rax, 0\n");
-    printf("  jne .L.true.%d\n", seq);
-    gen(node->rhs);
-    printf("  pop rax\n");
-    printf("  cmp rax, 0\n");
-    printf("  jne .L.true.%d\n", seq);
-    printf("  push 0\n");
-    printf("  jmp .L.end.%d\n", seq);
-    printf(".L.true.%d:\n", seq);
-    printf("  push 1\n");
-    printf(".L.end.%d:\n", seq);
-    return;
+    int t = new_label("true");
+    int end = new_label("end");
+    int reg = new_reg();
+    gen_branch(node->lhs, CC_NE, t);
+    gen_branch(node->rhs, CC_NE, t);
+    emit_ri(I_MOV, reg, 0);
+    emit_jmp(end);
+    emit_label(t);
+    emit_ri(I_MOV, reg, 1);
+    emit_label(end);
+    return reg;
   }
+  case ND_STMT_EXPR: {
+    Node *n = node->body;
+    for (; n->next; n = n->next)
+      gen_stmt(n);
+    return gen_expr(n);
+  }
+  case ND_FUNCALL:
+    return gen_funcall(node);
+  case ND_CAST:
+    return truncate(node->ty, gen_expr(node->lhs));
+  }
+
+  int lhs = gen_expr(node->lhs);
+  Operand rhs;
+  gen_rhs(node, &rhs);
+  return gen_binary(node, lhs, &rhs);
+}
+
+// Returns a register holding the value of an expression like gen_expr(),
+// except that the caller must not modify it. This saves copying variables
+// that live in registers.
+static int gen_value(Node *node) {
+  if (is_reg_var(node) && !node->init)
+    return node->var->reg;
+  return gen_expr(node);
+}
+
+// A condition is copied if it has at most this many nodes and defines no
+// labels.
+static int max_copy_nodes = 24;
+
+static bool can_copy(Node *node, int *budget) {
+  for (; node; node = node->next) {
+    if (--*budget < 0 || node->kind == ND_LABEL || node->kind == ND_SWITCH ||
+        node->kind == ND_CASE)
+      return false;
+    if (!can_copy(node->lhs, budget) || !can_copy(node->rhs, budget) ||
+        !can_copy(node->cond, budget) || !can_copy(node->then, budget) ||
+        !can_copy(node->els, budget) || !can_copy(node->init, budget) ||
+        !can_copy(node->inc, budget) || !can_copy(node->body, budget) ||
+        !can_copy(node->args, budget))
+      return false;
+  }
+  return true;
+}
+
+// Loops are rotated so that the only jump an iteration takes is the one
+// back to its beginning, with the condition tested at the end:
+//
+//   if (!cond) goto break;        goto test;
+//   begin: body;                  begin: body;
+//   continue: inc;          or    continue: inc;
+//   if (cond) goto begin;         test: if (cond) goto begin;
+//   break:                        break:
+//
+// The condition is copied to the top if it can be. Otherwise the loop is
+// entered at the test. A loop without a condition ends with a jump.
+static void gen_loop(Node *cond, Node *then, Node *inc) {
+  int begin = new_label("begin");
+  int test = 0;
+  int budget = max_copy_nodes;
+  if (cond && can_copy(cond, &budget)) {
+    gen_branch(cond, CC_E, brk_label);
+  } else if (cond) {
+    test = new_label("test");
+    emit_jmp(test);
+  }
+
+  emit_label(begin);
+  gen_stmt(then);
+  emit_label(cont_label);
+  if (inc)
+    gen_stmt(inc);
+  if (test)
+    emit_label(test);
+  if (cond)
+    gen_branch(cond, CC_NE, begin);
+  else
+    emit_jmp(begin);
+  emit_label(brk_label);
+}
+
+static void gen_stmt(Node *node) {
+  switch (node->kind) {
+  case ND_NULL:
+    return;
+  case ND_EXPR_STMT:
+    // Nothing needs the old value of x++ here.
+    if (node->lhs->kind == ND_POST_INC)
+      gen_pre_inc(node->lhs, true);
+    else if (node->lhs->kind == ND_POST_DEC)
+      gen_pre_inc(node->lhs, false);
+    else
+      gen_value(node->lhs);
+    return;
   case ND_IF: {
-    int seq = labelseq++;
     if (node->els) {
-      gen(node->cond);
-      printf("  pop rax\n");
-      printf("  cmp rax, 0\n");
-      printf("  je .L.else.%d\n", seq);
-      gen(node->then);
-      printf("  jmp .L.end.%d\n", seq);
-      printf(".L.else.%d:\n", seq);
-      gen(node->els);
-      printf(".L.end.%d:\n", seq);
+      int els = new_label("else");
+      int end = new_label("end");
+      gen_branch(node->cond, CC_E, els);
+      gen_stmt(node->then);
+      emit_jmp(end);
+      emit_label(els);
+      gen_stmt(node->els);
+      emit_label(end);
     } else {
-      gen(node->cond);
-      printf("  pop rax\n");
-      printf("  cmp rax, 0\n");
-      printf("  je .L.end.%d\n", seq);
-      gen(node->then);
-      printf(".L.end.%d:\n", seq);
+      int end = new_label("end");
+      gen_branch(node->cond, CC_E, end);
+      gen_stmt(node->then);
+      emit_label(end);
     }
     return;
   }
   case ND_WHILE: {
-    int seq = labelseq++;
-    int brk = brkseq;
-    int cont = contseq;
-    brkseq = contseq = seq;
-
-    printf(".L.continue.%d:\n", seq);
-    gen(node->cond);
-    printf("  pop rax\n");
-    printf("  cmp rax, 0\n");
-    printf("  je .L.break.%d\n", seq);
-    gen(node->then);
-    printf("  jmp .L.continue.%d\n", seq);
-    printf(".L.break.%d:\n", seq);
-
-    brkseq = brk;
-    contseq = cont;
+    int brk = brk_label;
+    int cont = cont_label;
+    cont_label = new_label("continue");
+    brk_label = new_label("break");
+    gen_loop(node->cond, node->then, NULL);
+    brk_label = brk;
+    cont_label = cont;
     return;
   }
   case ND_FOR: {
-    int seq = labelseq++;
-    int brk = brkseq;
-    int cont = contseq;
-    brkseq = contseq = seq;
-
+    int brk = brk_label;
+    int cont = cont_label;
+    cont_label = new_label("continue");
+    brk_label = new_label("break");
     if (node->init)
-      gen(node->init);
-    printf(".L.begin.%d:\n", seq);
-    if (node->cond) {
-      gen(node->cond);
-      printf("  pop rax\n");
-      printf("  cmp rax, 0\n");
-      printf("  je .L.break.%d\n", seq);
-    }
-    gen(node->then);
-    printf(".L.continue.%d:\n", seq);
-    if (node->inc)
-      gen(node->inc);
-    printf("  jmp .L.begin.%d\n", seq);
-    printf(".L.break.%d:\n", seq);
-
-    brkseq = brk;
-    contseq = cont;
+      gen_stmt(node->init);
+    gen_loop(node->cond, node->then, node->inc);
+    brk_label = brk;
+    cont_label = cont;
     return;
   }
   case ND_DO: {
-    int seq = labelseq++;
-    int brk = brkseq;
-    int cont = contseq;
-    brkseq = contseq = seq;
+    int brk = brk_label;
+    int cont = cont_label;
+    int begin = new_label("begin");
+    cont_label = new_label("continue");
+    brk_label = new_label("break");
 
-    printf(".L.begin.%d:\n", seq);
-    gen(node->then);
-    printf(".L.continue.%d:\n", seq);
-    gen(node->cond);
-    printf("  pop rax\n");
-    printf("  cmp rax, 0\n");
-    printf("  jne .L.begin.%d\n", seq);
-    printf(".L.break.%d:\n", seq);
+    emit_label(begin);
+    gen_stmt(node->then);
+    emit_label(cont_label);
+    gen_branch(node->cond, CC_NE, begin);
+    emit_label(brk_label);
 
-    brkseq = brk;
-    contseq = cont;
+    brk_label = brk;
+    cont_label = cont;
     return;
   }
   case ND_SWITCH: {
-    int seq = labelseq++;
-    int brk = brkseq;
-    brkseq = seq;
-    node->case_label = seq;
+    int brk = brk_label;
+    brk_label = new_label("break");
+    node->case_label = brk_label;
 
-    gen(node->cond);
-    printf("  pop rax\n");
+    int reg = gen_value(node->cond);
 
+    int ncases = 0;
     for (Node *n = node->case_next; n; n = n->case_next) {
-      n->case_label = labelseq++;
-      n->case_end_label = seq;
-      printf("  cmp rax, %ld\n", n->val);
-      printf("  je .L.case.%d\n", n->case_label);
+      n->case_label = new_label("case");
+      n->case_end_label = brk_label;
+      ncases++;
     }
 
+    int dflt = brk_label;
     if (node->default_case) {
-      int i = labelseq++;
-      node->default_case->case_end_label = seq;
-      node->default_case->case_label = i;
-      printf("  jmp .L.case.%d\n", i);
+      node->default_case->case_end_label = brk_label;
+      node->default_case->case_label = new_label("case");
+      dflt = node->default_case->case_label;
     }
 
-    printf("  jmp .L.break.%d\n", seq);
-    gen(node->then);
-    printf(".L.break.%d:\n", seq);
+    Node **cases = sort_cases(node->case_next, ncases);
+    gen_dispatch(reg, cases, ncases, dflt);
+    free(cases);
+    gen_stmt(node->then);
+    emit_label(brk_label);
 
-    brkseq = brk;
+    brk_label = brk;
     return;
   }
   case ND_CASE:
-    printf(".L.case.%d:\n", node->case_label);
-    gen(node->lhs);
+    emit_label(node->case_label);
+    gen_stmt(node->lhs);
     return;
   case ND_BLOCK:
-  case ND_STMT_EXPR:
     for (Node *n = node->body; n; n = n->next)
-      gen(n);
+      gen_stmt(n);
     return;
   case ND_BREAK:
-    if (brkseq == 0)
+    if (brk_label == 0)
       error_tok(node->tok, "stray break");
-    printf("  jmp .L.break.%d\n", brkseq);
+    emit_jmp(brk_label);
     return;
   case ND_CONTINUE:
-    if (contseq == 0)
+    if (cont_label == 0)
       error_tok(node->tok, "stray continue");
-    printf("  jmp .L.continue.%d\n", contseq);
+    emit_jmp(cont_label);
     return;
   case ND_GOTO:
-    printf("  jmp .L.label.%s.%s\n", funcname, node->label_name);
+    emit_jmp(goto_label(node->label_name));
     return;
   case ND_LABEL:
-    printf(".L.label.%s.%s:\n", funcname, node->label_name);
-    gen(node->lhs);
-    return;
-  case ND_FUNCALL: {
-    if (!strcmp(node->funcname, "__builtin_va_start")) {
-      printf("  pop rax\n");
-      printf("  mov edi, dword ptr [rbp-8]\n");
-      printf("  mov dword ptr [rax], 0\n");
-      printf("  mov dword ptr [rax+4], 0\n");
-      printf("  mov qword ptr [rax+8], rdi\n");
-      printf("  mov qword ptr [rax+16], 0\n");
-      return;
-    }
-
-    int nargs = 0;
-    for (Node *arg = node->args; arg; arg = arg->next) {
-      gen(arg);
-      nargs++;
-    }
-
-    for (int i = nargs - 1; i >= 0; i--)
-      printf("  pop %s\n", argreg8[i]);
-
-    int seq = labelseq++;
-    printf("  mov rax, rsp\n");
-    printf("  and rax, 15\n");
-    printf("  jnz .L.call.%d\n", seq);
-    printf("  mov rax, 0\n");
-    printf("  call %s\n", node->funcname);
-    printf("  jmp .L.end.%d\n", seq);
-    printf(".L.call.%d:\n", seq);
-    printf("  sub rsp, 8\n");
-    printf("  mov rax, 0\n");
-    printf("  call %s\n", node->funcname);
-    printf("  add rsp, 8\n");
-    printf(".L.end.%d:\n", seq);
-    if (node->ty->kind == TY_BOOL)
-      printf("  movzb rax, al\n");
-    printf("  push rax\n");
+    emit_label(goto_label(node->label_name));
+    gen_stmt(node->lhs);
     return;
-  }
   case ND_RETURN:
-    if (node->lhs) {
-      gen(node->lhs);
-      printf("  pop rax\n");
-    }
-    printf("  jmp .L.return.%s\n", funcname);
-    return;
-  case ND_CAST:
-    gen(node->lhs);
-    truncate(node->ty);
+    if (node->lhs)
+      emit_rr(I_MOV, RAX, gen_value(node->lhs), 8);
+    emit_jmp(1);
     return;
   }
 
-  gen(node->lhs);
-  gen(node->rhs);
+  gen_expr(node);
+}
+
+static void emit_line(char *s1, char *s2) {
+  sink_str(out, s1);
+  sink_str(out, s2);
+  sink_char(out, '\n');
+}
 
-  gen_binary(node);
+static void emit_directive(char *name, long val) {
+  sink_str(out, name);
+  sink_int(out, val);
+  sink_char(out, '\n');
 }
 
-static void emit_data(Program *prog) {
-  for (VarList *vl = prog->globals; vl; vl = vl->next)
+static void emit_data(VarList *globals) {
+  if (obj) {
+    obj_add_globals(obj, globals);
+    return;
+  }
+
+  for (VarList *vl = globals; vl; vl = vl->next)
     if (!vl->var->is_static)
-      printf(".global %s\n", vl->var->name);
+      emit_line(".global ", vl->var->name);
 
-  printf(".bss\n");
+  sink_str(out, ".bss\n");
 
-  for (VarList *vl = prog->globals; vl; vl = vl->next) {
+  for (VarList *vl = globals; vl; vl = vl->next) {
     Var *var = vl->var;
     if (var->initializer)
       continue;
 
-    printf(".align %d\n", var->ty->align);
-    printf("%s:\n", var->name);
-    printf("  .zero %d\n", var->ty->size);
+    emit_directive(".align ", var->ty->align);
+    emit_line(var->name, ":");
+    emit_directive("  .zero ", var->ty->size);
   }
 
-  printf(".data\n");
+  sink_str(out, ".data\n");
 
-  for (VarList *vl = prog->globals; vl; vl = vl->next) {
+  for (VarList *vl = globals; vl; vl = vl->next) {
     Var *var = vl->var;
     if (!var->initializer)
       continue;
 
-    printf(".align %d\n", var->ty->align);
-    printf("%s:\n", var->name);
+    emit_directive(".align ", var->ty->align);
+    emit_line(var->name, ":");
 
     for (Initializer *init = var->initializer; init; init = init->next) {
-      if (init->label)
-        printf("  .quad %s%+ld\n", init->label, init->addend);
-      else if (init->sz == 1)
-        printf("  .byte %ld\n", init->val);
-      else
-        printf("  .%dbyte %ld\n", init->sz, init->val);
+      if (init->label) {
+        sink_str(out, "  .quad ");
+        sink_str(out, init->label);
+        if (init->addend >= 0)
+          sink_char(out, '+');
+        emit_directive("", init->addend);
+      } else if (init->sz == 1) {
+        emit_directive("  .byte ", init->val);
+      } else {
+        sink_str(out, "  .");
+        sink_int(out, init->sz);
+        emit_directive("byte ", init->val);
+      }
     }
   }
 }
 
-static void load_arg(Var *var, int idx) {
-  int sz = var->ty->size;
-  if (sz == 1)
-    printf("  mov [rbp-%d], %s\n", var->offset, argreg1[idx]);
-  else if (sz == 2)
-    printf("  mov [rbp-%d], %s\n", var->offset, argreg2[idx]);
-  else if (sz == 4)
-    printf("  mov [rbp-%d], %s\n", var->offset, argreg4[idx]);
-  else {
-    assert(sz == 8);
-    printf("  mov [rbp-%d], %s\n", var->offset, argreg8[idx]);
+static void new_code(void) {
+  code = allocate(ALLOC_CODE, sizeof(Code));
+  code->cap = 1024;
+  code->insts = reallocate(ALLOC_CODE, NULL, sizeof(Inst) * code->cap);
+  code->labels_cap = 64;
+  code->labels =
+      reallocate(ALLOC_CODE, NULL, sizeof(char *) * code->labels_cap);
+}
+
+static int callee_saved[] = {RBX, R12, R13, R14, R15};
+
+// The System V ABI leaves this many bytes below rsp alone, even for signal
+// handlers, so a function that makes no calls can keep its frame there
+// without moving rsp.
+static int red_zone = 128;
+
+bool omit_frame_pointer;
+
+static bool is_leaf(Code *code) {
+  for (int i = 0; i < code->len; i++)
+    if (code->insts[i].kind == I_CALL)
+      return false;
+  return true;
+}
+
+// Makes frame slots relative to rsp, which is below rbp by delta, for a
+// function without a frame pointer.
+static void rebase_frame(int delta) {
+  for (int i = 0; i < code->len; i++) {
+    Operand *ops[2];
+    ops[0] = &code->insts[i].dst;
+    ops[1] = &code->insts[i].src;
+    for (int j = 0; j < 2; j++) {
+      if (ops[j]->kind == OP_MEM && !ops[j]->sym && ops[j]->reg == RBP) {
+        ops[j]->reg = RSP;
+        ops[j]->val += delta;
+      }
+    }
   }
 }
 
-static void emit_text(Program *prog) {
-  printf(".text\n");
-
-  for (Function *fn = prog->fns; fn; fn = fn->next) {
-    if (!fn->is_static)
-      printf(".global %s\n", fn->name);
-    printf("%s:\n", fn->name);
-    funcname = fn->name;
-
-    printf("  push rbp\n");
-    printf("  mov rbp, rsp\n");
-    printf("  sub rsp, %d\n", fn->stack_size);
-
-    if (fn->has_varargs) {
-      int n = 0;
-      for (VarList *vl = fn->params; vl; vl = vl->next)
-        n++;
-
-      printf("mov dword ptr [rbp-8], %d\n", n * 8);
-      printf("mov [rbp-16], r9\n");
-      printf("mov [rbp-24], r8\n");
-      printf("mov [rbp-32], rcx\n");
-      printf("mov [rbp-40], rdx\n");
-      printf("mov [rbp-48], rsi\n");
-      printf("mov [rbp-56], rdi\n");
+// Emits the prologue in front of the instructions generated so far. It
+// saves the callee-saved registers regs to their frame slots and lowers
+// rsp by size.
+static void emit_prologue(bool use_fp, int size, int *regs, int *slots,
+                          int n) {
+  int len = code->len;
+  if (use_fp) {
+    emit_r(I_PUSH, RBP);
+    emit_rr(I_MOV, RBP, RSP, 8);
+  }
+  if (size)
+    emit_ri(I_SUB, RSP, size);
+  for (int i = 0; i < n; i++) {
+    if (use_fp)
+      emit_mr(I_MOV, RBP, -slots[i], regs[i], 8);
+    else
+      emit_mr(I_MOV, RSP, size - slots[i], regs[i], 8);
+  }
+
+  int k = code->len - len;
+  Inst *tmp = reallocate(ALLOC_CODE, NULL, sizeof(Inst) * k);
+  memcpy(tmp, code->insts + len, sizeof(Inst) * k);
+  memmove(code->insts + k, code->insts, sizeof(Inst) * len);
+  memcpy(code->insts, tmp, sizeof(Inst) * k);
+  free(tmp);
+}
+
+// Puts I_ALIGN in front of the labels that jumps further down go back
+// to, which are where loops begin, so that an iteration starts at the
+// beginning of a 16-byte block of the instruction fetch.
+static void align_loops(void) {
+  bool *seen = allocate(ALLOC_CODE, sizeof(bool) * code->nlabels);
+  bool *align = allocate(ALLOC_CODE, sizeof(bool) * code->nlabels);
+  int n = 0;
+  for (int i = 0; i < code->len; i++) {
+    Inst *inst = &code->insts[i];
+    if (inst->kind == I_LABEL) {
+      seen[inst->dst.val] = true;
+    } else if ((inst->kind == I_JMP || inst->kind == I_JCC) &&
+               inst->dst.kind == OP_LABEL && seen[inst->dst.val] &&
+               !align[inst->dst.val]) {
+      align[inst->dst.val] = true;
+      n++;
     }
+  }
+
+  if (n) {
+    while (code->cap < code->len + n)
+      code->cap *= 2;
+    code->insts = reallocate(ALLOC_CODE, code->insts, sizeof(Inst) * code->cap);
 
-    int i = 0;
+    // Instructions move up by the number of labels aligned before them.
+    int j = code->len + n;
+    for (int i = code->len - 1; j > i + 1; i--) {
+      Inst *inst = &code->insts[i];
+      memcpy(&code->insts[--j], inst, sizeof(Inst));
+      if (inst->kind != I_LABEL || !align[inst->dst.val])
+        continue;
+      j--;
+      code->insts[j].kind = I_ALIGN;
+      code->insts[j].dst.kind = OP_NONE;
+      code->insts[j].src.kind = OP_NONE;
+    }
+    code->len += n;
+  }
+  free(seen);
+  free(align);
+}
+
+static void gen_function(Function *fn) {
+  funcname = fn->name;
+
+  // Instructions are buffered per function, reusing the same arrays.
+  // Label 0 means "none", and label 1 is where return statements jump to.
+  code->len = 0;
+  code->nlabels = 1;
+  code->nregs = VREG;
+  code->args = 0;
+  for (VarList *vl = fn->locals; vl; vl = vl->next)
+    if (vl->var->in_reg)
+      vl->var->reg = new_reg();
+  code->nvars = code->nregs - VREG;
+  char *ret = malloc(strlen(funcname) + 20);
+  sprintf(ret, ".L.return.%s", funcname);
+  add_label(ret);
+
+  if (fn->has_varargs) {
+    int n = 0;
     for (VarList *vl = fn->params; vl; vl = vl->next)
-      load_arg(vl->var, i++);
+      n++;
+
+    emit_mi(I_MOV, RBP, -8, n * 8, 4);
+    emit_mr(I_MOV, RBP, -16, R9, 8);
+    emit_mr(I_MOV, RBP, -24, R8, 8);
+    emit_mr(I_MOV, RBP, -32, RCX, 8);
+    emit_mr(I_MOV, RBP, -40, RDX, 8);
+    emit_mr(I_MOV, RBP, -48, RSI, 8);
+    emit_mr(I_MOV, RBP, -56, RDI, 8);
+  }
+
+  int i = 0;
+  for (VarList *vl = fn->params; vl; vl = vl->next) {
+    Var *var = vl->var;
+    int reg = argreg[i++];
+    code->args |= 1 << reg;
+    if (!var->in_reg) {
+      emit_mr(I_MOV, RBP, -var->offset, reg, var->ty->size);
+      continue;
+    }
+    emit_rr(I_MOV, var->reg, reg, 8);
+    if (var->ty->size < 8)
+      emit_ext(I_MOVSX, var->reg, var->reg, var->ty->size);
+  }
+
+  for (Node *node = fn->node; node; node = node->next)
+    gen_stmt(node);
+
+  // The frame holds the local variables, then spilled values, then the
+  // callee-saved registers that the function uses.
+  bool used[VREG];
+  memset(used, 0, sizeof(used));
+  run_passes(code, fn->name);
+  int frame_size = alloc_regs(code, fn->stack_size, used);
+
+  int regs[5];
+  int slots[5];
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    if (used[callee_saved[i]]) {
+      frame_size += 8;
+      regs[n] = callee_saved[i];
+      slots[n++] = frame_size;
+    }
+  }
+
+  emit_label(1);
+  for (int i = 0; i < n; i++)
+    emit_rm(I_MOV, regs[i], 8, RBP, -slots[i], 8);
+
+  // A leaf function keeps a small frame in the red zone, and one without
+  // a frame needs no prologue at all. Otherwise rsp is lowered so that it
+  // is 16-byte aligned at calls. Variadic functions find their arguments
+  // through rbp, so they always have a frame pointer.
+  bool leaf = is_leaf(code);
+  bool use_fp = !omit_frame_pointer || fn->has_varargs;
+  if (leaf && frame_size == 0 && !fn->has_varargs)
+    use_fp = false;
+
+  int size = 0;
+  if (!leaf || frame_size > red_zone) {
+    if (use_fp)
+      size = align_to(frame_size, 16);
+    else
+      size = align_to(frame_size + 8, 16) - 8;
+  }
+
+  if (!use_fp) {
+    rebase_frame(size);
+    if (size)
+      emit_ri(I_ADD, RSP, size);
+  } else {
+    if (size)
+      emit_rr(I_MOV, RSP, RBP, 8);
+    emit_r(I_POP, RBP);
+  }
+  emit(I_RET);
+  emit_prologue(use_fp, size, regs, slots, n);
+  align_loops();
+
+  for (int i = 0; i < code->len; i++)
+    if (code->insts[i].kind != I_LABEL && code->insts[i].kind != I_ALIGN)
+      num_insns++;
+}
+
+static void emit_function(Function *fn) {
+  if (fn->globals)
+    emit_data(fn->globals);
+  gen_function(fn);
+
+  if (obj) {
+    align_text(obj);
+    Symbol *sym = obj_symbol(obj, fn->name, SEC_TEXT, !fn->is_static);
+    encode_code(obj, code);
+    sym->size = obj->text->len - sym->offset;
+    return;
+  }
+
+  sink_str(out, ".text\n.p2align 4\n");
+  if (!fn->is_static)
+    emit_line(".global ", fn->name);
+  emit_line(fn->name, ":");
+  print_code(out, code);
+}
+
+
+// Each function is emitted as a self-contained chunk of assembly together
+// with its own data, so that chunks can be cached and spliced in by later
+// compilations.
+static void emit_text_fn(Function *fn) {
+  if (fn->cached_asm) {
+    sink_str(out, fn->cached_asm);
+    return;
+  }
+
+  if (!fn->cache_key) {
+    long start = time_report ? now_ns() : 0;
+    long insns = num_insns;
+    emit_function(fn);
+    if (time_report) {
+      fn->gen_ns = now_ns() - start;
+      fn->num_insns = num_insns - insns;
+    }
+    return;
+  }
+
+  Sink *file = out;
+  out = new_mem_sink();
+  emit_function(fn);
+  sink_write(file, out->buf, out->len);
+  cache_store(fn->cache_key, out->buf, out->len);
+  free(out->buf);
+  free(out);
+  out = file;
+}
 
-    for (Node *node = fn->node; node; node = node->next)
-      gen(node);
+// With more than one job, functions are generated by worker processes.
+// They are handed out in chunks of chunk_size functions in turn, and each
+// worker sends back one record per function:
+//
+//   gen_ns, num_insns, len, len bytes of assembly or machine code
+//   nrelocs, and per relocation: offset, type, addend, NUL-terminated symbol
+//
+// where relocations are only present for machine code. Labels are already
+// unique per function, so the parent can splice the records together in
+// source order and the output is the same as from a single job.
+int codegen_jobs = 1;
+static int chunk_size = 16;
 
-    printf(".L.return.%s:\n", funcname);
-    printf("  mov rsp, rbp\n");
-    printf("  pop rbp\n");
-    printf("  ret\n");
+// A worker inherits the output buffered so far and must leave it alone.
+static void run_worker(Function **fns, int nfns, int worker, int fd) {
+  Sink *msg = new_mem_sink();
+  if (obj)
+    obj = new_object();
+
+  for (int i = worker * chunk_size; i < nfns;
+       i += codegen_jobs * chunk_size) {
+    for (int j = i; j < nfns && j < i + chunk_size; j++) {
+      Function *fn = fns[j];
+      if (fn->cached_asm)
+        continue;
+
+      long start = time_report ? now_ns() : 0;
+      long insns = num_insns;
+
+      Sink *text = obj ? obj->text : new_mem_sink();
+      long text_start = text->len;
+      long reloc_start = obj ? obj->nrelocs : 0;
+
+      if (obj) {
+        gen_function(fn);
+        encode_code(obj, code);
+      } else {
+        out = text;
+        emit_function(fn);
+        if (fn->cache_key)
+          cache_store(fn->cache_key, text->buf, text->len);
+      }
+
+      sink_le(msg, time_report ? now_ns() - start : 0, 8);
+      sink_le(msg, num_insns - insns, 8);
+      sink_le(msg, text->len - text_start, 8);
+      sink_write(msg, text->buf + text_start, text->len - text_start);
+      if (!obj)
+        continue;
+
+      sink_le(msg, obj->nrelocs - reloc_start, 8);
+      for (int k = reloc_start; k < obj->nrelocs; k++) {
+        Reloc *rel = &obj->relocs[k];
+        sink_le(msg, rel->offset - text_start, 8);
+        sink_le(msg, rel->type, 8);
+        sink_le(msg, rel->addend, 8);
+        sink_write(msg, rel->sym, strlen(rel->sym) + 1);
+      }
+    }
+  }
+  finish_worker(msg, fd);
+}
+
+typedef struct {
+  int pid;
+  int fd;
+  char *buf;
+  long pos;
+} Worker;
+
+static long take_long(Worker *w) {
+  long val = *(long *)(w->buf + w->pos);
+  w->pos += 8;
+  return val;
+}
+
+static void splice_function(Function *fn, Worker *w) {
+  if (!w->buf) {
+    long len;
+    w->buf = wait_worker(w->pid, w->fd, &len);
+  }
+
+  long gen_ns = take_long(w);
+  long insns = take_long(w);
+  long len = take_long(w);
+  char *buf = w->buf + w->pos;
+  w->pos += len;
+
+  num_insns += insns;
+  if (time_report) {
+    fn->gen_ns = gen_ns;
+    fn->num_insns = insns;
+  }
+
+  if (!obj) {
+    sink_write(out, buf, len);
+    return;
+  }
+
+  if (fn->globals)
+    emit_data(fn->globals);
+  align_text(obj);
+  Symbol *sym = obj_symbol(obj, fn->name, SEC_TEXT, !fn->is_static);
+  sink_write(obj->text, buf, len);
+  sym->size = len;
+
+  long nrelocs = take_long(w);
+  for (int i = 0; i < nrelocs; i++) {
+    long offset = take_long(w);
+    long type = take_long(w);
+    long addend = take_long(w);
+    char *name = w->buf + w->pos;
+    w->pos += strlen(name) + 1;
+    obj_reloc(obj, SEC_TEXT, sym->offset + offset, type, name, addend);
   }
 }
 
-void codegen(Program *prog) {
-  printf(".intel_syntax noprefix\n");
-  emit_data(prog);
+static void emit_text(Program *prog) {
+  int nfns = 0;
+  for (Function *fn = prog->fns; fn; fn = fn->next)
+    nfns++;
+
+  if (codegen_jobs <= 1 || nfns <= chunk_size) {
+    for (Function *fn = prog->fns; fn; fn = fn->next)
+      emit_text_fn(fn);
+    return;
+  }
+
+  Function **fns = malloc(sizeof(Function *) * nfns);
+  int i = 0;
+  for (Function *fn = prog->fns; fn; fn = fn->next)
+    fns[i++] = fn;
+
+  int nchunks = (nfns + chunk_size - 1) / chunk_size;
+  if (codegen_jobs > nchunks)
+    codegen_jobs = nchunks;
+
+  Worker *workers = calloc(codegen_jobs, sizeof(Worker));
+  for (int i = 0; i < codegen_jobs; i++) {
+    Worker *w = &workers[i];
+    w->pid = start_worker(&w->fd);
+    if (w->pid == 0)
+      run_worker(fns, nfns, i, w->fd);
+  }
+
+  for (int i = 0; i < nfns; i++) {
+    int chunk = i / chunk_size;
+    Worker *w = &workers[chunk - chunk / codegen_jobs * codegen_jobs];
+    if (fns[i]->cached_asm)
+      sink_str(out, fns[i]->cached_asm);
+    else
+      splice_function(fns[i], w);
+  }
+}
+
+void codegen(Program *prog, Sink *sink) {
+  out = sink;
+  new_code();
+  sink_str(out, ".intel_syntax noprefix\n");
+
+  enter_phase(PHASE_EMIT_DATA);
+  emit_data(prog->globals);
+
+  enter_phase(PHASE_EMIT_TEXT);
+  emit_text(prog);
+}
+
+// Encodes the program into machine code. The codegen cache holds assembly,
+// so it must not be enabled.
+Object *codegen_object(Program *prog) {
+  obj = new_object();
+  new_code();
+
+  enter_phase(PHASE_EMIT_DATA);
+  emit_data(prog->globals);
+
+  enter_phase(PHASE_EMIT_TEXT);
   emit_text(prog);
-}
\ No newline at end of file
+  return obj;
+}
@@ -0,0 +1,320 @@
+#include "chibi.h"
+
+// Section header indices of the object file.
+typedef enum {
+  SHN_TEXT = 1,
+  SHN_DATA,
+  SHN_BSS,
+  SHN_RELA_TEXT,
+  SHN_RELA_DATA,
+  SHN_SYMTAB,
+  SHN_STRTAB,
+  SHN_NOTE,
+  SHN_SHSTRTAB,
+  SHN_NUM,
+} SectionIndex;
+
+static char *section_names[] = {
+    "",           ".text",   ".data",           ".bss",     ".rela.text",
+    ".rela.data", ".symtab", ".strtab", ".note.GNU-stack", ".shstrtab",
+};
+
+Object *new_object(void) {
+  Object *obj = calloc(1, sizeof(Object));
+  obj->text = new_mem_sink();
+  obj->data = new_mem_sink();
+  obj->data_align = 1;
+  obj->bss_align = 1;
+  obj->map_cap = 1024;
+  obj->map = calloc(obj->map_cap, sizeof(Symbol *));
+  return obj;
+}
+
+static long hash_name(char *name) {
+  long hash = 2166136261;
+  for (char *p = name; *p; p++)
+    hash = ((hash ^ (*p & 255)) * 16777619) & 0xffffffff;
+  return hash;
+}
+
+// Returns the slot of the symbol table's hash map in which name is stored
+// or would be stored.
+static long find_slot(Object *obj, char *name) {
+  long i = hash_name(name) & (obj->map_cap - 1);
+  while (obj->map[i] && strcmp(obj->map[i]->name, name))
+    i = (i + 1) & (obj->map_cap - 1);
+  return i;
+}
+
+Symbol *find_symbol(Object *obj, char *name) {
+  return obj->map[find_slot(obj, name)];
+}
+
+static Symbol *add_symbol(Object *obj, char *name) {
+  if (obj->nsyms * 2 >= obj->map_cap) {
+    obj->map_cap *= 2;
+    obj->map = calloc(obj->map_cap, sizeof(Symbol *));
+    for (int i = 0; i < obj->nsyms; i++)
+      obj->map[find_slot(obj, obj->syms[i]->name)] = obj->syms[i];
+  }
+
+  if (obj->nsyms == obj->syms_cap) {
+    obj->syms_cap = obj->syms_cap ? obj->syms_cap * 2 : 256;
+    obj->syms = realloc(obj->syms, sizeof(Symbol *) * obj->syms_cap);
+  }
+
+  Symbol *sym = calloc(1, sizeof(Symbol));
+  sym->name = name;
+  obj->syms[obj->nsyms++] = sym;
+  obj->map[find_slot(obj, name)] = sym;
+  return sym;
+}
+
+static long section_size(Object *obj, SectionKind sec) {
+  if (sec == SEC_TEXT)
+    return obj->text->len;
+  if (sec == SEC_DATA)
+    return obj->data->len;
+  return obj->bss_size;
+}
+
+// Defines a symbol at the current end of a section.
+Symbol *obj_symbol(Object *obj, char *name, SectionKind sec, bool is_global) {
+  Symbol *sym = find_symbol(obj, name);
+  if (!sym)
+    sym = add_symbol(obj, name);
+  else if (sym->sec != SEC_UNDEF)
+    error("%s: symbol defined twice", name);
+
+  sym->sec = sec;
+  sym->offset = section_size(obj, sec);
+  sym->is_global = is_global;
+  return sym;
+}
+
+void obj_reloc(Object *obj, SectionKind sec, long offset, RelocType type,
+               char *sym, long addend) {
+  if (obj->nrelocs == obj->relocs_cap) {
+    obj->relocs_cap = obj->relocs_cap ? obj->relocs_cap * 2 : 256;
+    obj->relocs = realloc(obj->relocs, sizeof(Reloc) * obj->relocs_cap);
+  }
+  Reloc *rel = &obj->relocs[obj->nrelocs++];
+  rel->sec = sec;
+  rel->offset = offset;
+  rel->type = type;
+  rel->sym = sym;
+  rel->addend = addend;
+}
+
+void obj_add_globals(Object *obj, VarList *globals) {
+  for (VarList *vl = globals; vl; vl = vl->next) {
+    Var *var = vl->var;
+    int align = var->ty->align;
+
+    if (!var->initializer) {
+      if (obj->bss_align < align)
+        obj->bss_align = align;
+      obj->bss_size = align_to(obj->bss_size, align);
+      Symbol *sym = obj_symbol(obj, var->name, SEC_BSS, !var->is_static);
+      sym->size = var->ty->size;
+      obj->bss_size += var->ty->size;
+      continue;
+    }
+
+    if (obj->data_align < align)
+      obj->data_align = align;
+    sink_align(obj->data, align);
+    Symbol *sym = obj_symbol(obj, var->name, SEC_DATA, !var->is_static);
+    sym->size = var->ty->size;
+
+    for (Initializer *init = var->initializer; init; init = init->next) {
+      if (init->label) {
+        obj_reloc(obj, SEC_DATA, obj->data->len, R_X86_64_64, init->label,
+                  init->addend);
+        sink_le(obj->data, 0, 8);
+      } else {
+        sink_le(obj->data, init->val, init->sz);
+      }
+    }
+  }
+}
+
+// Symbols that are referred to but not defined are undefined globals.
+static void add_undefined_symbols(Object *obj) {
+  for (int i = 0; i < obj->nrelocs; i++) {
+    char *name = obj->relocs[i].sym;
+    if (!find_symbol(obj, name))
+      add_symbol(obj, name)->is_global = true;
+  }
+}
+
+static int section_index(SectionKind sec) {
+  if (sec == SEC_TEXT)
+    return SHN_TEXT;
+  if (sec == SEC_DATA)
+    return SHN_DATA;
+  if (sec == SEC_BSS)
+    return SHN_BSS;
+  return 0;
+}
+
+// Writes an Elf64_Sym. Local symbols must precede global ones.
+static void write_symbols(Object *obj, Sink *symtab, Sink *strtab,
+                          bool global) {
+  for (int i = 0; i < obj->nsyms; i++) {
+    Symbol *sym = obj->syms[i];
+    if (sym->is_global != global)
+      continue;
+
+    int type = 0;
+    if (sym->sec == SEC_TEXT)
+      type = 2;
+    else if (sym->sec != SEC_UNDEF)
+      type = 1;
+
+    sym->index = symtab->len / 24;
+    sink_le(symtab, strtab->len, 4);
+    sink_le(symtab, (global ? 1 : 0) << 4 | type, 1);
+    sink_le(symtab, 0, 1);
+    sink_le(symtab, section_index(sym->sec), 2);
+    sink_le(symtab, sym->offset, 8);
+    sink_le(symtab, sym->size, 8);
+    sink_write(strtab, sym->name, strlen(sym->name) + 1);
+  }
+}
+
+// Writes the Elf64_Rela entries of a section.
+static void write_relocs(Object *obj, Sink *rela, SectionKind sec) {
+  for (int i = 0; i < obj->nrelocs; i++) {
+    Reloc *rel = &obj->relocs[i];
+    if (rel->sec != sec)
+      continue;
+    sink_le(rela, rel->offset, 8);
+    sink_le(rela, rel->type, 4);
+    sink_le(rela, find_symbol(obj, rel->sym)->index, 4);
+    sink_le(rela, rel->addend, 8);
+  }
+}
+
+static void write_section_header(Sink *out, int name, int type, int flags,
+                                 long offset, long size) {
+  sink_le(out, name, 4);
+  sink_le(out, type, 4);
+  sink_le(out, flags, 8);
+  sink_le(out, 0, 8);
+  sink_le(out, offset, 8);
+  sink_le(out, size, 8);
+}
+
+static void write_section_tail(Sink *out, int link, int info, int align,
+                               int entsize) {
+  sink_le(out, link, 4);
+  sink_le(out, info, 4);
+  sink_le(out, align, 8);
+  sink_le(out, entsize, 8);
+}
+
+// Writes a relocatable ELF64 object file. Its contents come first, each
+// aligned to 8 bytes, and the section headers last.
+void write_object(Object *obj, Sink *out) {
+  add_undefined_symbols(obj);
+
+  Sink *symtab = new_mem_sink();
+  Sink *strtab = new_mem_sink();
+  sink_le(symtab, 0, 24);
+  sink_char(strtab, 0);
+  write_symbols(obj, symtab, strtab, false);
+  int first_global = symtab->len / 24;
+  write_symbols(obj, symtab, strtab, true);
+
+  Sink *rela_text = new_mem_sink();
+  Sink *rela_data = new_mem_sink();
+  write_relocs(obj, rela_text, SEC_TEXT);
+  write_relocs(obj, rela_data, SEC_DATA);
+
+  Sink *shstrtab = new_mem_sink();
+  int name[SHN_NUM];
+  for (int i = 0; i < SHN_NUM; i++) {
+    name[i] = shstrtab->len;
+    sink_write(shstrtab, section_names[i], strlen(section_names[i]) + 1);
+  }
+
+  Sink *contents[SHN_NUM];
+  contents[0] = NULL;
+  contents[SHN_TEXT] = obj->text;
+  contents[SHN_DATA] = obj->data;
+  contents[SHN_BSS] = NULL;
+  contents[SHN_RELA_TEXT] = rela_text;
+  contents[SHN_RELA_DATA] = rela_data;
+  contents[SHN_SYMTAB] = symtab;
+  contents[SHN_STRTAB] = strtab;
+  contents[SHN_NOTE] = NULL;
+  contents[SHN_SHSTRTAB] = shstrtab;
+
+  long offset[SHN_NUM];
+  long off = 64;
+  for (int i = 0; i < SHN_NUM; i++) {
+    off = align_to(off, 8);
+    offset[i] = off;
+    if (contents[i])
+      off += contents[i]->len;
+  }
+  long shoff = align_to(off, 8);
+
+  // ELF header
+  sink_char(out, 0x7f);
+  sink_write(out, "ELF", 3);
+  sink_char(out, 2); // ELFCLASS64
+  sink_char(out, 1); // ELFDATA2LSB
+  sink_char(out, 1); // EV_CURRENT
+  sink_le(out, 0, 9);
+  sink_le(out, 1, 2);  // ET_REL
+  sink_le(out, 62, 2); // EM_X86_64
+  sink_le(out, 1, 4);
+  sink_le(out, 0, 8);
+  sink_le(out, 0, 8);
+  sink_le(out, shoff, 8);
+  sink_le(out, 0, 4);
+  sink_le(out, 64, 2);
+  sink_le(out, 0, 2);
+  sink_le(out, 0, 2);
+  sink_le(out, 64, 2);
+  sink_le(out, SHN_NUM, 2);
+  sink_le(out, SHN_SHSTRTAB, 2);
+
+  for (int i = 0; i < SHN_NUM; i++) {
+    sink_align(out, 8);
+    if (contents[i])
+      sink_write(out, contents[i]->buf, contents[i]->len);
+  }
+  sink_align(out, 8);
+
+  // Section headers
+  sink_le(out, 0, 64);
+  write_section_header(out, name[SHN_TEXT], 1, 6, offset[SHN_TEXT],
+                       obj->text->len);
+  write_section_tail(out, 0, 0, 16, 0);
+  write_section_header(out, name[SHN_DATA], 1, 3, offset[SHN_DATA],
+                       obj->data->len);
+  write_section_tail(out, 0, 0, obj->data_align, 0);
+  write_section_header(out, name[SHN_BSS], 8, 3, offset[SHN_BSS],
+                       obj->bss_size);
+  write_section_tail(out, 0, 0, obj->bss_align, 0);
+  write_section_header(out, name[SHN_RELA_TEXT], 4, 0x40,
+                       offset[SHN_RELA_TEXT], rela_text->len);
+  write_section_tail(out, SHN_SYMTAB, SHN_TEXT, 8, 24);
+  write_section_header(out, name[SHN_RELA_DATA], 4, 0x40,
+                       offset[SHN_RELA_DATA], rela_data->len);
+  write_section_tail(out, SHN_SYMTAB, SHN_DATA, 8, 24);
+  write_section_header(out, name[SHN_SYMTAB], 2, 0, offset[SHN_SYMTAB],
+                       symtab->len);
+  write_section_tail(out, SHN_STRTAB, first_global, 8, 24);
+  write_section_header(out, name[SHN_STRTAB], 3, 0, offset[SHN_STRTAB],
+                       strtab->len);
+  write_section_tail(out, 0, 0, 1, 0);
+  write_section_header(out, name[SHN_NOTE], 1, 0, offset[SHN_NOTE], 0);
+  write_section_tail(out, 0, 0, 1, 0);
+  write_section_header(out, name[SHN_SHSTRTAB], 3, 0, offset[SHN_SHSTRTAB],
+                       shstrtab->len);
+  write_section_tail(out, 0, 0, 1, 0);
+}
@@ -0,0 +1,489 @@
+#include "chibi.h"
+
+// A relocation within the bytes of one instruction, recorded before the
+// final position of the instruction is known.
+typedef struct {
+  int inst;
+  long offset;
+  RelocType type;
+  char *sym;
+  long addend;
+} Fixup;
+
+// Instructions other than jumps are encoded once into buf. start[i] is
+// where instruction i begins there.
+static Sink *buf;
+static long *start;
+static int cur;
+
+static Fixup *fixups;
+static int nfixups;
+static int fixups_cap;
+
+static void put(int c) { sink_char(buf, c); }
+
+static void put_imm(long val, int size) { sink_le(buf, val, size); }
+
+static bool is_int8(long val) { return val == (char)val; }
+
+static bool is_int32(long val) { return val == (int)val; }
+
+static void add_fixup(RelocType type, char *sym, long addend) {
+  if (nfixups == fixups_cap) {
+    fixups_cap = fixups_cap ? fixups_cap * 2 : 64;
+    fixups = reallocate(ALLOC_CODE, fixups, sizeof(Fixup) * fixups_cap);
+  }
+  Fixup *f = &fixups[nfixups++];
+  f->inst = cur;
+  f->offset = buf->len;
+  f->type = type;
+  f->sym = sym;
+  f->addend = addend;
+}
+
+static void prefix(int size) {
+  if (size == 2)
+    put(0x66);
+}
+
+static int rex_w(int size) { return size == 8 ? 0x48 : 0; }
+
+// spl, bpl, sil and dil can only be encoded with a REX prefix, without
+// which the same numbers mean ah, ch, dh and bh.
+static int byte_rex(Operand *op) {
+  if (op->kind == OP_REG && op->size == 1 && op->reg >= 4 && op->reg < 8)
+    return 0x40;
+  return 0;
+}
+
+// Encodes the REX prefix, opcode, ModRM byte, SIB byte and displacement
+// of an instruction. reg is the register or opcode extension in the reg
+// field and rm is a register or memory operand. imm_len is the number of
+// immediate bytes that follow, which a RIP-relative displacement has to
+// account for.
+static void encode_rm(int rex, int opcode, int reg, Operand *rm,
+                      int imm_len) {
+  if (reg & 8)
+    rex |= 0x44;
+  if ((rm->kind == OP_REG || (rm->kind == OP_MEM && !rm->sym)) &&
+      (rm->reg & 8))
+    rex |= 0x41;
+  if (rm->kind == OP_MEM && rm->scale && (rm->index & 8))
+    rex |= 0x42;
+  if (rex)
+    put(rex);
+
+  if (opcode > 0xff)
+    put(opcode >> 8);
+  put(opcode & 0xff);
+
+  if (rm->kind == OP_REG) {
+    put(0xc0 | (reg & 7) << 3 | (rm->reg & 7));
+    return;
+  }
+
+  // A local label is not known yet, and its displacement is filled in
+  // along with those of jumps.
+  if (rm->sym || rm->kind == OP_LABEL) {
+    put(0x05 | (reg & 7) << 3);
+    if (rm->sym)
+      add_fixup(R_X86_64_PC32, rm->sym, rm->val - 4 - imm_len);
+    put_imm(0, 4);
+    return;
+  }
+
+  int base = rm->reg & 7;
+  long disp = rm->val;
+  int mod = 2;
+  if (disp == 0 && base != 5)
+    mod = 0;
+  else if (is_int8(disp))
+    mod = 1;
+
+  // A SIB byte follows for an index, or for a base of rsp or r12, whose
+  // number in the ModRM byte means that there is one.
+  if (rm->scale) {
+    int ss = rm->scale == 1 ? 0 : rm->scale == 2 ? 1 : rm->scale == 4 ? 2 : 3;
+    put(mod << 6 | (reg & 7) << 3 | 4);
+    put(ss << 6 | (rm->index & 7) << 3 | base);
+  } else {
+    put(mod << 6 | (reg & 7) << 3 | base);
+    if (base == 4)
+      put(0x24);
+  }
+  if (mod == 1)
+    put_imm(disp, 1);
+  else if (mod == 2)
+    put_imm(disp, 4);
+}
+
+// add, or, and, sub, xor and cmp share their encodings and differ only in
+// an opcode extension.
+static void encode_alu(int ext, Operand *dst, Operand *src) {
+  int size = dst->size;
+  prefix(size);
+
+  if (src->kind == OP_IMM) {
+    int imm_len = size < 4 ? size : 4;
+    int opcode = size == 1 ? 0x80 : 0x81;
+    if (size > 1 && is_int8(src->val)) {
+      imm_len = 1;
+      opcode = 0x83;
+    }
+    encode_rm(rex_w(size) | byte_rex(dst), opcode, ext, dst, imm_len);
+    put_imm(src->val, imm_len);
+    return;
+  }
+
+  int byte = size == 1 ? 0 : 1;
+  if (src->kind == OP_REG)
+    encode_rm(rex_w(size) | byte_rex(dst) | byte_rex(src), ext * 8 + byte,
+              src->reg, dst, 0);
+  else
+    encode_rm(rex_w(size) | byte_rex(dst), ext * 8 + 2 + byte, dst->reg, src,
+              0);
+}
+
+static void encode_mov(Operand *dst, Operand *src) {
+  int size = dst->size;
+
+  if (src->kind == OP_IMM && dst->kind == OP_REG) {
+    long val = src->val;
+    int r = dst->reg;
+
+    // Writing a 32-bit register clears the upper half, so this is the
+    // shortest form for all values that fit in 32 bits unsigned.
+    if (size == 8 && !(val >= 0 && val <= 0xffffffff)) {
+      if (is_int32(val)) {
+        encode_rm(0x48, 0xc7, 0, dst, 4);
+        put_imm(val, 4);
+      } else {
+        put(0x48 | (r >= 8 ? 1 : 0));
+        put(0xb8 + (r & 7));
+        put_imm(val, 8);
+      }
+      return;
+    }
+
+    prefix(size);
+    if (r >= 8 || byte_rex(dst))
+      put(0x40 | (r >= 8 ? 1 : 0));
+    put((size == 1 ? 0xb0 : 0xb8) + (r & 7));
+    put_imm(val, size < 4 ? size : 4);
+    return;
+  }
+
+  prefix(size);
+  if (src->kind == OP_IMM) {
+    int imm_len = size < 4 ? size : 4;
+    encode_rm(rex_w(size), size == 1 ? 0xc6 : 0xc7, 0, dst, imm_len);
+    put_imm(src->val, imm_len);
+    return;
+  }
+
+  int byte = size == 1 ? 0 : 1;
+  if (src->kind == OP_REG)
+    encode_rm(rex_w(size) | byte_rex(dst) | byte_rex(src), 0x88 + byte,
+              src->reg, dst, 0);
+  else
+    encode_rm(rex_w(size) | byte_rex(dst), 0x8a + byte, dst->reg, src, 0);
+}
+
+static void encode_shift(int ext, Operand *dst, Operand *src) {
+  int size = dst->size;
+  prefix(size);
+
+  int byte = size == 1 ? 0 : 1;
+  if (src->kind == OP_REG) {
+    encode_rm(rex_w(size) | byte_rex(dst), 0xd2 + byte, ext, dst, 0);
+    return;
+  }
+  encode_rm(rex_w(size) | byte_rex(dst), 0xc0 + byte, ext, dst, 1);
+  put_imm(src->val, 1);
+}
+
+// Unary instructions of the 0xf6/0xf7 group: not, neg, mul, imul, div and
+// idiv.
+static void encode_unary(int ext, Operand *op) {
+  int size = op->size;
+  prefix(size);
+  encode_rm(rex_w(size) | byte_rex(op), size == 1 ? 0xf6 : 0xf7, ext, op, 0);
+}
+
+static void encode_inst(Inst *inst) {
+  Operand *dst = &inst->dst;
+  Operand *src = &inst->src;
+
+  switch (inst->kind) {
+  case I_LABEL:
+  case I_JCC:
+  case I_ALIGN:
+    return;
+  case I_JMP:
+    if (dst->kind != OP_LABEL)
+      encode_rm(0, 0xff, 4, dst, 0);
+    return;
+  case I_MOV:
+    encode_mov(dst, src);
+    return;
+  case I_MOVSX:
+  case I_MOVZX: {
+    int opcode = inst->kind == I_MOVSX ? 0x0fbe : 0x0fb6;
+    if (src->size == 2)
+      opcode++;
+    if (inst->kind == I_MOVSX && src->size == 4)
+      opcode = 0x63;
+    encode_rm(rex_w(dst->size) | byte_rex(src), opcode, dst->reg, src, 0);
+    return;
+  }
+  case I_LEA:
+    encode_rm(rex_w(dst->size), 0x8d, dst->reg, src, 0);
+    return;
+  case I_PUSH:
+    if (dst->kind == OP_REG) {
+      if (dst->reg >= 8)
+        put(0x41);
+      put(0x50 + (dst->reg & 7));
+    } else if (dst->kind == OP_IMM) {
+      if (is_int8(dst->val)) {
+        put(0x6a);
+        put_imm(dst->val, 1);
+      } else {
+        put(0x68);
+        put_imm(dst->val, 4);
+      }
+    } else {
+      encode_rm(0, 0xff, 6, dst, 0);
+    }
+    return;
+  case I_POP:
+    if (dst->kind == OP_REG) {
+      if (dst->reg >= 8)
+        put(0x41);
+      put(0x58 + (dst->reg & 7));
+    } else {
+      encode_rm(0, 0x8f, 0, dst, 0);
+    }
+    return;
+  case I_ADD:
+    encode_alu(0, dst, src);
+    return;
+  case I_OR:
+    encode_alu(1, dst, src);
+    return;
+  case I_AND:
+    encode_alu(4, dst, src);
+    return;
+  case I_SUB:
+    encode_alu(5, dst, src);
+    return;
+  case I_XOR:
+    encode_alu(6, dst, src);
+    return;
+  case I_CMP:
+    encode_alu(7, dst, src);
+    return;
+  case I_IMUL:
+    if (src->kind == OP_IMM) {
+      bool short_imm = is_int8(src->val);
+      encode_rm(rex_w(dst->size), short_imm ? 0x6b : 0x69, dst->reg, dst,
+                short_imm ? 1 : 4);
+      put_imm(src->val, short_imm ? 1 : 4);
+      return;
+    }
+    encode_rm(rex_w(dst->size), 0x0faf, dst->reg, src, 0);
+    return;
+  case I_CQO:
+    put(0x48);
+    put(0x99);
+    return;
+  case I_IDIV:
+    encode_unary(7, dst);
+    return;
+  case I_IMULH:
+    encode_unary(5, dst);
+    return;
+  case I_NOT:
+    encode_unary(2, dst);
+    return;
+  case I_SHL:
+    encode_shift(4, dst, src);
+    return;
+  case I_SAR:
+    encode_shift(7, dst, src);
+    return;
+  case I_SETCC:
+    encode_rm(byte_rex(dst), 0x0f90 + inst->cc, 0, dst, 0);
+    return;
+  case I_CALL:
+    put(0xe8);
+    add_fixup(R_X86_64_PLT32, dst->sym, -4);
+    put_imm(0, 4);
+    return;
+  case I_RET:
+    put(0xc3);
+    return;
+  case I_ENTRY:
+    put_imm(0, 4);
+    return;
+  }
+  error("cannot encode instruction %d", inst->kind);
+}
+
+static bool is_jump(Inst *inst) {
+  return (inst->kind == I_JMP || inst->kind == I_JCC) &&
+         inst->dst.kind == OP_LABEL;
+}
+
+// Instructions that end with a 32-bit offset between labels, or between a
+// label and the next instruction.
+static bool refers_label(Inst *inst) {
+  return inst->kind == I_ENTRY ||
+         (inst->kind == I_LEA && inst->src.kind == OP_LABEL);
+}
+
+static int jump_size(Inst *inst, bool near) {
+  if (!near)
+    return 2;
+  return inst->kind == I_JMP ? 5 : 6;
+}
+
+// The bytes that I_ALIGN adds at pc, relative to the start of the
+// function, which is itself aligned.
+static int padding(long pc) {
+  int n = align_to(pc, 16) - pc;
+  return n > 10 ? 0 : n;
+}
+
+// The recommended nops of 1 to 8 bytes. Longer ones have more 0x66
+// prefixes.
+static long nops[] = {
+    0,
+    0x90,
+    0x9066,
+    0x001f0f,
+    0x00401f0f,
+    0x0000441f0f,
+    0x0000441f0f66,
+    0x000000801f0f,
+    0x00000000841f0f,
+};
+
+static void put_nops(Sink *s, int n) {
+  for (; n > 8; n--)
+    sink_char(s, 0x66);
+  sink_le(s, nops[n], n);
+}
+
+// Pads the text section so that the next function starts on 16 bytes.
+void align_text(Object *obj) {
+  int n = align_to(obj->text->len, 16) - obj->text->len;
+  while (n > 10) {
+    put_nops(obj->text, 8);
+    n -= 8;
+  }
+  put_nops(obj->text, n);
+}
+
+// Appends the machine code of a function to the text section.
+//
+// Jumps are first assumed to reach their targets with an 8-bit
+// displacement. Those that turn out not to are widened to 32 bits, which
+// moves later code and may push other jumps out of range, so this is
+// repeated until nothing changes. Since jumps only ever grow, it ends,
+// even though the padding before loops may shrink as code moves.
+void encode_code(Object *obj, Code *code) {
+  int n = code->len;
+  if (!buf)
+    buf = new_mem_sink();
+  buf->len = 0;
+  nfixups = 0;
+  start = reallocate(ALLOC_CODE, start, sizeof(long) * (n + 1));
+
+  for (cur = 0; cur < n; cur++) {
+    start[cur] = buf->len;
+    encode_inst(&code->insts[cur]);
+  }
+  start[n] = buf->len;
+
+  long *pos = allocate(ALLOC_CODE, sizeof(long) * (n + 1));
+  long *label_pos = allocate(ALLOC_CODE, sizeof(long) * code->nlabels);
+  bool *near = allocate(ALLOC_CODE, sizeof(bool) * n);
+
+  for (;;) {
+    long pc = 0;
+    for (int i = 0; i < n; i++) {
+      Inst *inst = &code->insts[i];
+      pos[i] = pc;
+      if (inst->kind == I_LABEL)
+        label_pos[inst->dst.val] = pc;
+      if (is_jump(inst))
+        pc += jump_size(inst, near[i]);
+      else if (inst->kind == I_ALIGN)
+        pc += padding(pc);
+      else
+        pc += start[i + 1] - start[i];
+    }
+    pos[n] = pc;
+
+    bool changed = false;
+    for (int i = 0; i < n; i++) {
+      Inst *inst = &code->insts[i];
+      if (!is_jump(inst) || near[i])
+        continue;
+      if (!is_int8(label_pos[inst->dst.val] - pos[i] - 2)) {
+        near[i] = true;
+        changed = true;
+      }
+    }
+    if (!changed)
+      break;
+  }
+
+  Sink *text = obj->text;
+  long base = text->len;
+  for (int i = 0; i < n; i++) {
+    Inst *inst = &code->insts[i];
+    if (inst->kind == I_ALIGN) {
+      put_nops(text, pos[i + 1] - pos[i]);
+      continue;
+    }
+    if (refers_label(inst)) {
+      long val;
+      if (inst->kind == I_ENTRY)
+        val = label_pos[inst->dst.val] - label_pos[inst->src.val];
+      else
+        val = label_pos[inst->src.val] - pos[i + 1];
+      sink_write(text, buf->buf + start[i], start[i + 1] - start[i] - 4);
+      sink_le(text, val, 4);
+      continue;
+    }
+    if (!is_jump(inst)) {
+      sink_write(text, buf->buf + start[i], start[i + 1] - start[i]);
+      continue;
+    }
+
+    long disp = label_pos[inst->dst.val] - pos[i] - jump_size(inst, near[i]);
+    if (!near[i]) {
+      sink_char(text, inst->kind == I_JMP ? 0xeb : 0x70 + inst->cc);
+      sink_le(text, disp, 1);
+    } else if (inst->kind == I_JMP) {
+      sink_char(text, 0xe9);
+      sink_le(text, disp, 4);
+    } else {
+      sink_char(text, 0x0f);
+      sink_char(text, 0x80 + inst->cc);
+      sink_le(text, disp, 4);
+    }
+  }
+
+  for (int i = 0; i < nfixups; i++) {
+    Fixup *f = &fixups[i];
+    long offset = base + pos[f->inst] + f->offset - start[f->inst];
+    obj_reloc(obj, SEC_TEXT, offset, f->type, f->sym, f->addend);
+  }
+
+  free(pos);
+  free(label_pos);
+  free(near);
+}
@@ -0,0 +1,384 @@
+#include "chibi.h"
+
+// Inlining of small functions.
+//
+// A call to a small function defined earlier in the file is replaced by a
+// copy of the function's body, which saves the call and the moves around
+// it and lets the rest of the compiler see both sides at once. The copy
+// has its own local variables in the caller's frame. The arguments are
+// assigned to the copies of the parameters, and return statements store
+// the returned value and jump to the end of the copy:
+//
+//   f(a, b)  =>  ({ x = a; y = b; ...; ret = ...; goto 1; ...; 1: ; ret; })
+//
+// Functions are processed in the order they are defined, so the body of a
+// callee has already had its own calls inlined when it is copied, and a
+// function is never copied into itself.
+
+bool no_inline;
+
+// A function is inlined if its definition is at most max_tokens tokens
+// long and its body is at most max_nodes nodes after calls in it have been
+// inlined. The first limit is checked before the body is parsed, so that
+// the body of a function whose code comes from the cache is only parsed
+// when the function may be inlined.
+static int max_tokens = 80;
+static int max_nodes = 40;
+
+static Function **candidates;
+static int ncandidates;
+
+// Local variables of the callee and their copies in the caller.
+static Var **old_vars;
+static Var **new_vars;
+static int nvars;
+
+// The function that calls are inlined into.
+static Function *caller;
+
+// The type of the call being inlined, the variable that holds its value
+// once one is needed, and the label that returns jump to.
+static Type *ret_ty;
+static Var *ret_var;
+static char *join_label;
+static bool jumps_to_join;
+static int nsites;
+
+// The switch statement whose cases are being copied and its copy.
+static Node *old_switch;
+static Node *new_switch;
+
+bool may_inline(Token *begin, Token *end) {
+  if (no_inline)
+    return false;
+  int n = 0;
+  for (Token *t = begin; t != end; t = t->next)
+    if (++n > max_tokens)
+      return false;
+  return true;
+}
+
+Function *find_inline(char *name) {
+  for (int i = 0; i < ncandidates; i++)
+    if (!strcmp(candidates[i]->name, name))
+      return candidates[i];
+  return NULL;
+}
+
+static Node *new_node(NodeKind kind, Token *tok) {
+  num_nodes++;
+  Node *node = allocate(ALLOC_NODE, sizeof(Node));
+  node->kind = kind;
+  node->tok = tok;
+  return node;
+}
+
+static Node *new_var_node(Var *var, Token *tok) {
+  Node *node = new_node(ND_VAR, tok);
+  node->var = var;
+  node->ty = var->ty;
+  return node;
+}
+
+static Node *new_expr_stmt(Node *expr) {
+  Node *node = new_node(ND_EXPR_STMT, expr->tok);
+  node->lhs = expr;
+  return node;
+}
+
+static Node *new_assign(Var *var, Node *rhs) {
+  Node *node = new_node(ND_ASSIGN, rhs->tok);
+  node->lhs = new_var_node(var, rhs->tok);
+  node->rhs = rhs;
+  node->ty = var->ty;
+  return new_expr_stmt(node);
+}
+
+static Var *new_local(char *name, Type *ty) {
+  Var *var = allocate(ALLOC_VAR, sizeof(Var));
+  var->name = name;
+  var->ty = ty;
+  var->is_local = true;
+
+  VarList *vl = allocate(ALLOC_VAR, sizeof(VarList));
+  vl->var = var;
+  vl->next = caller->locals;
+  caller->locals = vl;
+  return var;
+}
+
+static Var *return_var(void) {
+  if (!ret_var)
+    ret_var = new_local("ret", ret_ty);
+  return ret_var;
+}
+
+static Var *copy_var(Var *var) {
+  for (int i = 0; i < nvars; i++)
+    if (old_vars[i] == var)
+      return new_vars[i];
+  return var;
+}
+
+// Labels are named after the call site they were copied to, which keeps
+// them apart from the caller's labels, which are identifiers, and from
+// those of other copies.
+static char *copy_label(char *name) {
+  char *buf = malloc(strlen(name) + 20);
+  sprintf(buf, "%s.%d", name, nsites);
+  return buf;
+}
+
+static Node *copy_node(Node *node);
+
+static Node *copy_list(Node *node) {
+  Node head = {};
+  Node *cur = &head;
+  for (Node *n = node; n; n = n->next) {
+    cur->next = copy_node(n);
+    cur = cur->next;
+  }
+  return head.next;
+}
+
+static Node *copy_return(Node *node, bool is_last) {
+  Node *val = NULL;
+  if (node->lhs && ret_ty->kind != TY_VOID)
+    val = new_assign(return_var(), copy_node(node->lhs));
+  else if (node->lhs)
+    val = new_expr_stmt(copy_node(node->lhs));
+
+  if (is_last)
+    return val ? val : new_node(ND_NULL, node->tok);
+
+  Node *jump = new_node(ND_GOTO, node->tok);
+  jump->label_name = join_label;
+  jumps_to_join = true;
+  if (!val)
+    return jump;
+
+  Node *block = new_node(ND_BLOCK, node->tok);
+  block->body = val;
+  val->next = jump;
+  return block;
+}
+
+static Node *copy_node(Node *node) {
+  if (!node)
+    return NULL;
+  if (node->kind == ND_RETURN)
+    return copy_return(node, false);
+
+  Node *copy = new_node(node->kind, node->tok);
+  memcpy(copy, node, sizeof(Node));
+  copy->next = NULL;
+  if (node->var && node->var->is_local)
+    copy->var = copy_var(node->var);
+  if (node->label_name)
+    copy->label_name = copy_label(node->label_name);
+
+  Node *sw = old_switch;
+  Node *sw_copy = new_switch;
+  if (node->kind == ND_SWITCH) {
+    old_switch = node;
+    new_switch = copy;
+    copy->case_next = NULL;
+    copy->default_case = NULL;
+  }
+
+  copy->lhs = copy_node(node->lhs);
+  copy->rhs = copy_node(node->rhs);
+  copy->cond = copy_node(node->cond);
+  copy->then = copy_node(node->then);
+  copy->els = copy_node(node->els);
+  copy->init = copy_node(node->init);
+  copy->inc = copy_node(node->inc);
+  copy->body = copy_list(node->body);
+  copy->args = copy_list(node->args);
+
+  old_switch = sw;
+  new_switch = sw_copy;
+
+  // Cases are linked to their switch in the same order as by the parser.
+  if (node->kind == ND_CASE) {
+    if (node == old_switch->default_case) {
+      new_switch->default_case = copy;
+    } else {
+      copy->case_next = new_switch->case_next;
+      new_switch->case_next = copy;
+    }
+  }
+  return copy;
+}
+
+static Node *new_cast(Node *expr, Type *ty) {
+  Node *node = new_node(ND_CAST, expr->tok);
+  node->lhs = expr;
+  node->ty = ty;
+  return node;
+}
+
+static Node *inline_call(Node *call, Function *callee) {
+  nsites++;
+  nvars = 0;
+  for (VarList *vl = callee->locals; vl; vl = vl->next)
+    nvars++;
+  old_vars = calloc(nvars, sizeof(Var *));
+  new_vars = calloc(nvars, sizeof(Var *));
+
+  int i = 0;
+  for (VarList *vl = callee->locals; vl; vl = vl->next) {
+    old_vars[i] = vl->var;
+    new_vars[i++] = new_local(vl->var->name, vl->var->ty);
+  }
+
+  ret_ty = call->ty;
+  ret_var = NULL;
+  join_label = malloc(20);
+  sprintf(join_label, "%d", nsites);
+  jumps_to_join = false;
+
+  Node head = {};
+  Node *cur = &head;
+  VarList *param = callee->params;
+  Node *arg = call->args;
+  while (arg) {
+    Node *next = arg->next;
+    arg->next = NULL;
+    cur->next = new_assign(copy_var(param->var), arg);
+    cur = cur->next;
+    param = param->next;
+    arg = next;
+  }
+
+  // A value returned at the very end, with no other returns, is the value
+  // of the copy itself.
+  Node *val = NULL;
+  for (Node *n = callee->node; n; n = n->next) {
+    if (n->next || n->kind != ND_RETURN) {
+      cur->next = copy_node(n);
+      cur = cur->next;
+    } else if (n->lhs && ret_ty->kind != TY_VOID && !jumps_to_join) {
+      val = new_cast(copy_node(n->lhs), ret_ty);
+    } else {
+      cur->next = copy_return(n, true);
+      cur = cur->next;
+    }
+  }
+
+  if (jumps_to_join) {
+    Node *label = new_node(ND_LABEL, call->tok);
+    label->label_name = join_label;
+    label->lhs = new_node(ND_NULL, call->tok);
+    cur->next = label;
+    cur = cur->next;
+  }
+
+  if (!val && ret_var) {
+    val = new_var_node(ret_var, call->tok);
+  } else if (!val) {
+    val = new_node(ND_NUM, call->tok);
+    val->ty = ret_ty;
+  }
+  cur->next = val;
+
+  Node *node = new_node(ND_STMT_EXPR, call->tok);
+  node->body = head.next;
+  node->ty = ret_ty;
+
+  free(old_vars);
+  free(new_vars);
+  return node;
+}
+
+static bool can_inline(Node *call, Function *callee) {
+  if (call->ty->kind == TY_STRUCT)
+    return false;
+
+  VarList *param = callee->params;
+  for (Node *arg = call->args; arg; arg = arg->next) {
+    if (!param)
+      return false;
+    param = param->next;
+  }
+  return !param;
+}
+
+static void inline_calls(Node *node) {
+  for (; node; node = node->next) {
+    inline_calls(node->lhs);
+    inline_calls(node->rhs);
+    inline_calls(node->cond);
+    inline_calls(node->then);
+    inline_calls(node->els);
+    inline_calls(node->init);
+    inline_calls(node->inc);
+    inline_calls(node->body);
+    inline_calls(node->args);
+
+    if (node->kind != ND_FUNCALL)
+      continue;
+    Function *callee = find_inline(node->funcname);
+    if (!callee || !can_inline(node, callee))
+      continue;
+
+    Node *next = node->next;
+    memcpy(node, inline_call(node, callee), sizeof(Node));
+    node->next = next;
+  }
+}
+
+static int count_nodes(Node *node) {
+  int n = 0;
+  for (; node; node = node->next) {
+    n += 1 + count_nodes(node->lhs) + count_nodes(node->rhs) +
+         count_nodes(node->cond) + count_nodes(node->then) +
+         count_nodes(node->els) + count_nodes(node->init) +
+         count_nodes(node->inc) + count_nodes(node->body) +
+         count_nodes(node->args);
+    if (n > max_nodes)
+      return n;
+  }
+  return n;
+}
+
+static bool calls(Node *node, char *name) {
+  for (; node; node = node->next) {
+    if (node->kind == ND_FUNCALL && !strcmp(node->funcname, name))
+      return true;
+    if (calls(node->lhs, name) || calls(node->rhs, name) ||
+        calls(node->cond, name) || calls(node->then, name) ||
+        calls(node->els, name) || calls(node->init, name) ||
+        calls(node->inc, name) || calls(node->body, name) ||
+        calls(node->args, name))
+      return true;
+  }
+  return false;
+}
+
+static bool is_candidate(Function *fn) {
+  if (fn->has_varargs || count_nodes(fn->node) > max_nodes ||
+      calls(fn->node, fn->name))
+    return false;
+  for (VarList *vl = fn->params; vl; vl = vl->next)
+    if (vl->var->ty->kind == TY_STRUCT)
+      return false;
+  return true;
+}
+
+// Inlines the calls in a function definition spanning tokens from begin to
+// end, and then makes the function itself available for inlining if it
+// qualifies.
+void inline_function(Function *fn, Token *begin, Token *end) {
+  if (no_inline)
+    return;
+
+  caller = fn;
+  nsites = 0;
+  inline_calls(fn->node);
+
+  if (!may_inline(begin, end) || !is_candidate(fn))
+    return;
+  candidates = realloc(candidates, sizeof(Function *) * (ncandidates + 1));
+  candidates[ncandidates++] = fn;
+}
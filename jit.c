@@ -0,0 +1,133 @@
+#include "chibi.h"
+#include <dlfcn.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+// Shared libraries that undefined symbols are looked up in, in order.
+static void **libs;
+static int nlibs;
+
+static void *open_lib(char *name) {
+  void *handle = dlopen(name, RTLD_NOW | RTLD_GLOBAL);
+  if (!handle)
+    error("%s", dlerror());
+  libs = realloc(libs, sizeof(void *) * (nlibs + 1));
+  libs[nlibs++] = handle;
+  return handle;
+}
+
+// Loads a shared library for -run. A name without a slash is short for
+// lib<name>.so as with the linker's -l.
+void jit_add_library(char *name) {
+  if (strchr(name, '/')) {
+    open_lib(name);
+    return;
+  }
+  char *path = malloc(strlen(name) + 7);
+  sprintf(path, "lib%s.so", name);
+  open_lib(path);
+}
+
+static long resolve(Object *obj, char *name, char **base) {
+  Symbol *sym = find_symbol(obj, name);
+  if (sym && sym->sec != SEC_UNDEF)
+    return (long)base[sym->sec] + sym->offset;
+
+  for (int i = 0; i < nlibs; i++) {
+    void *addr = dlsym(libs[i], name);
+    if (addr)
+      return (long)addr;
+  }
+  error("undefined symbol: %s", name);
+}
+
+// Code refers to data and functions in shared libraries with 32-bit
+// displacements, so the program has to be loaded within 2GB of them. The
+// kernel is asked for an address just below the C library, where
+// dlopen() has put the other libraries too.
+static char *map_near(long addr, long size) {
+  for (long dist = 256 << 20; dist < 2147483648; dist *= 2) {
+    long hint = (addr - dist) & -4096;
+    char *p = mmap((void *)hint, size, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+    if (p != MAP_FAILED)
+      return p;
+  }
+  error("cannot map memory for the program");
+}
+
+// The compiler cannot call through a function pointer when it compiles
+// itself, so the program is entered from the comparison callback of a
+// one-element bsearch(). This stub receives a pointer to argc and argv,
+// calls main and passes its return value to the C library's exit(),
+// which also flushes the library's output buffers.
+static long add_entry_stub(Object *obj) {
+  Sink *text = obj->text;
+  long start = text->len;
+
+  sink_le(text, 0x08ec8348, 4);   // sub rsp, 8
+  sink_le(text, 0x08778b48, 4);   // mov rsi, [rdi+8]
+  sink_le(text, 0x3f8b, 2);       // mov edi, [rdi]
+  sink_le(text, 0xc031, 2);       // xor eax, eax
+  sink_char(text, 0xe8);          // call main
+  obj_reloc(obj, SEC_TEXT, text->len, R_X86_64_PLT32, "main", -4);
+  sink_le(text, 0, 4);
+  sink_le(text, 0xc789, 2);       // mov edi, eax
+  sink_char(text, 0xe8);          // call exit
+  obj_reloc(obj, SEC_TEXT, text->len, R_X86_64_PLT32, "exit", -4);
+  sink_le(text, 0, 4);
+  return start;
+}
+
+// Loads the program into memory, resolves its relocations and runs its
+// main function. This does not return.
+void run_object(Object *obj, int argc, char **argv) {
+  void *libc = open_lib("libc.so.6");
+  if (!find_symbol(obj, "main"))
+    error("main is not defined");
+
+  // The C library was not initialized the usual way, so it does not know
+  // the environment yet.
+  char ***env = dlsym(libc, "environ");
+  *env = environ;
+
+  long stub = add_entry_stub(obj);
+
+  long text_size = align_to(obj->text->len, 4096);
+  long data_size = align_to(obj->data->len, 16);
+  long size = text_size + data_size + obj->bss_size;
+  char *mem = map_near((long)dlsym(libc, "exit"), size);
+
+  char *base[4];
+  base[SEC_UNDEF] = NULL;
+  base[SEC_TEXT] = mem;
+  base[SEC_DATA] = mem + text_size;
+  base[SEC_BSS] = mem + text_size + data_size;
+  memcpy(base[SEC_TEXT], obj->text->buf, obj->text->len);
+  memcpy(base[SEC_DATA], obj->data->buf, obj->data->len);
+
+  for (int i = 0; i < obj->nrelocs; i++) {
+    Reloc *rel = &obj->relocs[i];
+    char *loc = base[rel->sec] + rel->offset;
+    long val = resolve(obj, rel->sym, base) + rel->addend;
+
+    if (rel->type == R_X86_64_64) {
+      *(long *)loc = val;
+      continue;
+    }
+
+    val = val - (long)loc;
+    if (val != (int)val)
+      error("%s: relocation out of range", rel->sym);
+    *(int *)loc = val;
+  }
+
+  if (mprotect(mem, text_size, PROT_READ | PROT_EXEC))
+    error("mprotect failed: %s", strerror(errno));
+
+  long args[2];
+  args[0] = argc;
+  args[1] = (long)argv;
+  bsearch(args, args, 1, sizeof(args), (void *)(mem + stub));
+  error("main returned from the entry stub");
+}
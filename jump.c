@@ -0,0 +1,191 @@
+#include "chibi.h"
+
+// Jump optimization.
+//
+// Code generation lays out statements the way they are written, which
+// leaves jumps to jumps, jumps to the very next instruction, code after a
+// return that nothing jumps to, and labels that nothing refers to. Labels
+// also end the window of the peephole pass, so removing the ones that are
+// not needed lets it see further. This pass repeats the following until
+// nothing changes:
+//
+//   jmp L1 ... L1: jmp L2           =>  jmp L2 ... L1: jmp L2
+//   jmp L; L:                       =>  L:
+//   cmp a, b; je L; L:              =>  L:
+//   je L1; jmp L2; L1:              =>  jne L2; L1:
+//   blocks that cannot be reached   =>
+//   labels that nothing refers to   =>
+
+static Code *code;
+
+// The index of each label instruction, or -1 for labels that are not in
+// the code, such as the return label that is only added later.
+static int *label_pos;
+
+static void find_labels(void) {
+  for (int i = 0; i < code->nlabels; i++)
+    label_pos[i] = -1;
+  for (int i = 0; i < code->len; i++)
+    if (code->insts[i].kind == I_LABEL)
+      label_pos[code->insts[i].dst.val] = i;
+}
+
+static bool is_label_jump(Inst *inst) {
+  return (inst->kind == I_JMP || inst->kind == I_JCC) &&
+         inst->dst.kind == OP_LABEL;
+}
+
+// Follows a chain of labels that are only followed by unconditional
+// jumps. A chain that loops ends where it started.
+static int final_target(int label) {
+  int target = label;
+  for (int n = 0; n < code->nlabels; n++) {
+    if (label_pos[target] < 0)
+      return target;
+    int i = label_pos[target];
+    while (i < code->len && code->insts[i].kind == I_LABEL)
+      i++;
+    if (i == code->len || code->insts[i].kind != I_JMP ||
+        code->insts[i].dst.kind != OP_LABEL)
+      return target;
+    target = code->insts[i].dst.val;
+    if (target == label)
+      return label;
+  }
+  return label;
+}
+
+static bool thread_jumps(void) {
+  bool changed = false;
+  for (int i = 0; i < code->len; i++) {
+    Inst *inst = &code->insts[i];
+    if (!is_label_jump(inst) && inst->kind != I_ENTRY)
+      continue;
+    int target = final_target(inst->dst.val);
+    if (target != inst->dst.val) {
+      inst->dst.val = target;
+      changed = true;
+    }
+  }
+  return changed;
+}
+
+// Is label the position right after instruction i, with only labels in
+// between? The end of the code is where label 1 goes.
+static bool falls_to(int i, int label) {
+  for (i++; i < code->len && code->insts[i].kind == I_LABEL; i++)
+    if (code->insts[i].dst.val == label)
+      return true;
+  return i == code->len && label == 1;
+}
+
+static bool remove_unreachable(void) {
+  if (code->len == 0)
+    return false;
+
+  CFG *cfg = build_cfg(code);
+  bool *reached = allocate(ALLOC_CODE, sizeof(bool) * cfg->nblocks);
+  int *stack = reallocate(ALLOC_CODE, NULL, sizeof(int) * cfg->nblocks);
+  int sp = 0;
+  reached[0] = true;
+  stack[sp++] = 0;
+  while (sp > 0) {
+    Block *bb = &cfg->blocks[stack[--sp]];
+    for (int i = 0; i < bb->nsuccs; i++) {
+      int s = bb->succs[i];
+      if (!reached[s]) {
+        reached[s] = true;
+        stack[sp++] = s;
+      }
+    }
+  }
+
+  // A jump table stays with the jump that uses it.
+  for (int b = 1; b < cfg->nblocks; b++)
+    if (reached[b - 1] && is_table(cfg, code, b))
+      reached[b] = true;
+
+  int len = 0;
+  for (int b = 0; b < cfg->nblocks; b++) {
+    if (!reached[b])
+      continue;
+    for (int i = cfg->blocks[b].start; i < cfg->blocks[b].end; i++)
+      memcpy(&code->insts[len++], &code->insts[i], sizeof(Inst));
+  }
+
+  bool changed = len < code->len;
+  code->len = len;
+  free(reached);
+  free(stack);
+  free_cfg(cfg);
+  return changed;
+}
+
+static bool remove_jumps(void) {
+  int len = 0;
+  for (int i = 0; i < code->len; i++) {
+    Inst *inst = &code->insts[i];
+    if (is_label_jump(inst) && falls_to(i, inst->dst.val)) {
+      // Nothing else uses the flags that the jump would have tested.
+      if (inst->kind == I_JCC && len > 0 &&
+          code->insts[len - 1].kind == I_CMP)
+        len--;
+      continue;
+    }
+
+    if (inst->kind == I_JCC && inst->dst.kind == OP_LABEL &&
+        i + 1 < code->len && is_label_jump(&inst[1]) &&
+        inst[1].kind == I_JMP && falls_to(i + 1, inst->dst.val)) {
+      inst->cc = inst->cc ^ 1;
+      inst->dst.val = inst[1].dst.val;
+      memcpy(&code->insts[len++], inst, sizeof(Inst));
+      i++;
+      continue;
+    }
+    memcpy(&code->insts[len++], inst, sizeof(Inst));
+  }
+
+  bool changed = len < code->len;
+  code->len = len;
+  return changed;
+}
+
+static bool remove_labels(void) {
+  int *refs = allocate(ALLOC_CODE, sizeof(int) * code->nlabels);
+  for (int i = 0; i < code->len; i++) {
+    Inst *inst = &code->insts[i];
+    if (inst->kind != I_LABEL && inst->dst.kind == OP_LABEL)
+      refs[inst->dst.val]++;
+    if (inst->src.kind == OP_LABEL)
+      refs[inst->src.val]++;
+  }
+
+  int len = 0;
+  for (int i = 0; i < code->len; i++) {
+    Inst *inst = &code->insts[i];
+    if (inst->kind == I_LABEL && !refs[inst->dst.val])
+      continue;
+    memcpy(&code->insts[len++], inst, sizeof(Inst));
+  }
+
+  bool changed = len < code->len;
+  code->len = len;
+  free(refs);
+  return changed;
+}
+
+void optimize_jumps(Code *c) {
+  code = c;
+  label_pos = reallocate(ALLOC_CODE, NULL, sizeof(int) * code->nlabels);
+
+  for (;;) {
+    find_labels();
+    bool changed = thread_jumps();
+    changed = remove_unreachable() || changed;
+    changed = remove_jumps() || changed;
+    changed = remove_labels() || changed;
+    if (!changed)
+      break;
+  }
+  free(label_pos);
+}
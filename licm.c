@@ -0,0 +1,773 @@
+#include "chibi.h"
+
+// Loop-invariant code motion.
+//
+// A loop often computes the same value on every iteration, such as the
+// address of the row of an array that an outer loop selects, or a global
+// that nothing in the loop stores to. This pass computes such values once,
+// before the loop is entered.
+//
+// A jump to a block that dominates it closes a loop. The loop's header is
+// the block jumped to, and its body is every block that reaches the jump
+// without passing through the header. Values are moved to the end of the
+// preheader, the single block outside the loop that leads to the header
+// and nowhere else. A block that ends with the conditional jump guarding
+// a rotated loop and falls through to the header will do too, in which
+// case values go after the jump. Loops without either are left alone.
+//
+// Only temporaries are moved, along with all the instructions that write
+// them. Those must all be in one block of the loop and must not read
+// anything that changes in it:
+//
+//   - immediates and addresses of symbols and labels,
+//   - registers that nothing in the loop writes, or temporaries that are
+//     moved out of it,
+//   - globals and stack slots that nothing in the loop may store to.
+//
+// Loads through pointers are never moved, since the pointer may only be
+// valid when the loop runs or when a condition in it holds. Loads of
+// globals and stack slots cannot fault.
+//
+// A moved value takes a register throughout the loop, and the register
+// allocator keeps it alive around the loop's jumps back. Values only move
+// while the loop leaves registers free, the most expensive first. A value
+// moved out of a loop that is nested in another may move again out of the
+// outer one, so the pass repeats as long as values move into loops.
+
+static Code *code;
+static CFG *cfg;
+
+// The block of each instruction.
+static int *inst_block;
+
+// Immediate dominator of each block, -1 for blocks that cannot be reached,
+// and the postorder numbers that the dominator computation works with.
+static int *idom;
+static int *postorder;
+
+// Is the address of any stack slot taken? If not, nothing but the
+// function's own instructions can store to its stack slots.
+static bool frame_escapes;
+
+// The loop being processed, the instructions from its header to its last
+// block, and what it may store to.
+static bool *in_loop;
+static int loop_start;
+static int loop_end;
+static bool has_call;
+static bool stores_anywhere;
+static char **stored_syms;
+static int nstored_syms;
+static long *stored_slots; // Pairs of start and end offsets from rbp
+static int nstored_slots;
+
+// The first and last instruction that mentions each virtual register. A
+// temporary that is mentioned outside the loop stays where it is.
+static int *first_use;
+static int *last_use;
+
+// The block each virtual register is written in inside the loop, -1 if
+// none, or -2 if more than one or if that block does not lead back to the
+// header, and the last instruction writing it. The registers written are
+// listed in written.
+static int *written_in;
+static int *last_write;
+static int *written;
+static int nwritten;
+
+// For each temporary written in the loop, whether it is invariant, the
+// number of instructions it saves if it moves, whether instructions that
+// stay in the loop read it, and whether it moves.
+static bool *invariant;
+static int *cost;
+static bool *used_in_loop;
+static bool *hoisted;
+
+// The loop each temporary was last counted in by free_regs().
+static int *seen_in;
+static int nloops;
+
+// The temporary whose instructions are being checked.
+static int cur_temp;
+
+// The preheader each instruction moves to, or -1 if it stays.
+static int *moves_to;
+
+// The moved instructions are built here and swapped with the code's own
+// array, which is then reused.
+static Inst *insts;
+static int insts_cap;
+
+static int intersect(int a, int b) {
+  while (a != b) {
+    while (postorder[a] < postorder[b])
+      a = idom[a];
+    while (postorder[b] < postorder[a])
+      b = idom[b];
+  }
+  return a;
+}
+
+// Computes immediate dominators by iterating in reverse postorder until
+// nothing changes, as described by Cooper, Harvey and Kennedy.
+static void find_dominators(void) {
+  int n = cfg->nblocks;
+  idom = reallocate(ALLOC_CODE, NULL, sizeof(int) * n);
+  postorder = reallocate(ALLOC_CODE, NULL, sizeof(int) * n);
+  int *order = reallocate(ALLOC_CODE, NULL, sizeof(int) * n);
+  int *stack = reallocate(ALLOC_CODE, NULL, sizeof(int) * n);
+  int *next = allocate(ALLOC_CODE, sizeof(int) * n);
+  bool *seen = allocate(ALLOC_CODE, sizeof(bool) * n);
+  for (int b = 0; b < n; b++) {
+    idom[b] = -1;
+    postorder[b] = -1;
+  }
+
+  int norder = 0;
+  int sp = 0;
+  stack[sp++] = 0;
+  seen[0] = true;
+  while (sp > 0) {
+    Block *bb = &cfg->blocks[stack[sp - 1]];
+    int i = next[stack[sp - 1]]++;
+    if (i == bb->nsuccs) {
+      postorder[stack[sp - 1]] = norder;
+      order[norder++] = stack[--sp];
+      continue;
+    }
+    int s = bb->succs[i];
+    if (!seen[s]) {
+      seen[s] = true;
+      stack[sp++] = s;
+    }
+  }
+
+  idom[0] = 0;
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    for (int i = norder - 2; i >= 0; i--) {
+      int b = order[i];
+      Block *bb = &cfg->blocks[b];
+      int d = -1;
+      for (int j = 0; j < bb->npreds; j++) {
+        int p = bb->preds[j];
+        if (idom[p] < 0)
+          continue;
+        d = d < 0 ? p : intersect(p, d);
+      }
+      if (idom[b] != d) {
+        idom[b] = d;
+        changed = true;
+      }
+    }
+  }
+
+  free(order);
+  free(stack);
+  free(next);
+  free(seen);
+}
+
+// A block's dominators are its ancestors in the depth-first search, so
+// they come later in postorder.
+static bool dominates(int a, int b) {
+  if (idom[b] < 0)
+    return false;
+  while (postorder[b] < postorder[a])
+    b = idom[b];
+  return a == b;
+}
+
+// Instructions that only read their first operand.
+static bool reads_dst(InstKind kind) {
+  return kind == I_CMP || kind == I_IDIV || kind == I_IMULH ||
+         kind == I_PUSH || kind == I_JMP;
+}
+
+// Instructions that do nothing but compute their first operand from their
+// operands. setcc also reads the flags, so it is not one of them.
+static bool is_pure(InstKind kind) {
+  switch (kind) {
+  case I_MOV:
+  case I_MOVSX:
+  case I_MOVZX:
+  case I_LEA:
+  case I_ADD:
+  case I_SUB:
+  case I_IMUL:
+  case I_AND:
+  case I_OR:
+  case I_XOR:
+  case I_SHL:
+  case I_SAR:
+  case I_NOT:
+    return true;
+  }
+  return false;
+}
+
+static bool is_overwrite(InstKind kind) {
+  return kind == I_MOV || kind == I_MOVSX || kind == I_MOVZX || kind == I_LEA;
+}
+
+static bool is_temp(int reg) { return reg >= VREG + code->nvars; }
+
+static int written_reg(Inst *inst) {
+  if (inst->dst.kind == OP_REG && inst->dst.reg >= VREG &&
+      !reads_dst(inst->kind))
+    return inst->dst.reg;
+  return -1;
+}
+
+// Appends the virtual registers an operand mentions to regs.
+static void add_reg(int *regs, int *n, Operand *op) {
+  if ((op->kind == OP_REG || (op->kind == OP_MEM && !op->sym)) &&
+      op->reg >= VREG)
+    regs[(*n)++] = op->reg;
+  if (op->kind == OP_MEM && op->scale && op->index >= VREG)
+    regs[(*n)++] = op->index;
+}
+
+static void add_use(Operand *op, int i) {
+  int regs[2];
+  int n = 0;
+  add_reg(regs, &n, op);
+  for (int j = 0; j < n; j++) {
+    if (first_use[regs[j]] < 0)
+      first_use[regs[j]] = i;
+    last_use[regs[j]] = i;
+  }
+}
+
+static void add_store(Operand *op) {
+  if (op->sym && !op->scale) {
+    stored_syms = reallocate(ALLOC_CODE, stored_syms,
+                             sizeof(char *) * (nstored_syms + 1));
+    stored_syms[nstored_syms++] = op->sym;
+    return;
+  }
+  if (op->reg == RBP && !op->scale) {
+    stored_slots = reallocate(ALLOC_CODE, stored_slots,
+                              sizeof(long) * (nstored_slots + 1) * 2);
+    stored_slots[nstored_slots * 2] = op->val;
+    stored_slots[nstored_slots * 2 + 1] = op->val + op->size;
+    nstored_slots++;
+    return;
+  }
+  stores_anywhere = true;
+}
+
+// Finds what the loop writes. Blocks between the header and the last
+// block that are not part of the loop, such as those that return from
+// inside it, are taken to be part of it here.
+static void scan_loop(void) {
+  has_call = false;
+  stores_anywhere = false;
+  nstored_syms = 0;
+  nstored_slots = 0;
+  nwritten = 0;
+
+  for (int i = loop_start; i < loop_end; i++) {
+    Inst *inst = &code->insts[i];
+    if (inst->kind == I_CALL) {
+      has_call = true;
+      stores_anywhere = true;
+    }
+    if (inst->dst.kind == OP_MEM && !reads_dst(inst->kind))
+      add_store(&inst->dst);
+
+    int r = written_reg(inst);
+    if (r < 0)
+      continue;
+    int b = in_loop[inst_block[i]] ? inst_block[i] : -2;
+    if (written_in[r] == -1) {
+      written_in[r] = b;
+      written[nwritten++] = r;
+    } else if (written_in[r] != b) {
+      written_in[r] = -2;
+    }
+    last_write[r] = i;
+  }
+}
+
+// May the loop store to the memory that a load reads?
+static bool may_be_stored(Operand *mem) {
+  if (mem->sym) {
+    if (stores_anywhere)
+      return true;
+    for (int i = 0; i < nstored_syms; i++)
+      if (!strcmp(stored_syms[i], mem->sym))
+        return true;
+    return false;
+  }
+
+  if (stores_anywhere && frame_escapes)
+    return true;
+  for (int i = 0; i < nstored_slots; i++)
+    if (stored_slots[i * 2] < mem->val + mem->size &&
+        mem->val < stored_slots[i * 2 + 1])
+      return true;
+  return false;
+}
+
+// Does a register read by instruction i keep its value throughout the
+// loop? A temporary moved out of the loop must be computed before i.
+static bool invariant_reg(int reg, int i) {
+  if (reg == cur_temp)
+    return true;
+  if (reg < VREG)
+    return reg == RBP;
+  if (written_in[reg] == -1)
+    return true;
+  return invariant[reg] && last_write[reg] < i;
+}
+
+static bool invariant_operand(Inst *inst, Operand *op, int i) {
+  switch (op->kind) {
+  case OP_IMM:
+  case OP_LABEL:
+  case OP_SYM:
+    return true;
+  case OP_REG:
+    return invariant_reg(op->reg, i);
+  case OP_MEM:
+    if (op->scale && !invariant_reg(op->index, i))
+      return false;
+    if (inst->kind == I_LEA)
+      return op->sym || invariant_reg(op->reg, i);
+    if (op->scale || (!op->sym && op->reg != RBP))
+      return false;
+    return !may_be_stored(op);
+  }
+  return false;
+}
+
+// Can the instructions writing temporary t in block b be moved out of the
+// loop? The first of them must not read t, and nothing else may read t
+// before the last of them.
+static bool is_invariant(int t, int b) {
+  Block *bb = &cfg->blocks[b];
+  bool seen = false;
+  cur_temp = t;
+  for (int i = bb->start; i <= last_write[t]; i++) {
+    Inst *inst = &code->insts[i];
+    int regs[4];
+    int n = 0;
+    add_reg(regs, &n, &inst->dst);
+    add_reg(regs, &n, &inst->src);
+
+    if (written_reg(inst) != t) {
+      for (int j = 0; j < n; j++)
+        if (regs[j] == t)
+          return false;
+      continue;
+    }
+
+    if (!is_pure(inst->kind) || moves_to[i] >= 0)
+      return false;
+    if (inst->src.kind != OP_NONE && !invariant_operand(inst, &inst->src, i))
+      return false;
+    if (!seen) {
+      if (!is_overwrite(inst->kind))
+        return false;
+      for (int j = 1; j < n; j++)
+        if (regs[j] == t)
+          return false;
+    }
+    seen = true;
+  }
+  return seen;
+}
+
+// Returns the number of registers that are free throughout the loop, out
+// of the 12 that the register allocator hands out, or the 5 callee-saved
+// ones among them if the loop makes calls. Each variable takes one for the
+// whole function, and temporaries take one from their first to their last
+// mention, or throughout the loop if they are computed before it.
+static int free_regs(void) {
+  int len = loop_end - loop_start;
+  int *live = allocate(ALLOC_CODE, sizeof(int) * (len + 1));
+  nloops++;
+  for (int i = loop_start; i < loop_end; i++) {
+    int regs[4];
+    int n = 0;
+    add_reg(regs, &n, &code->insts[i].dst);
+    add_reg(regs, &n, &code->insts[i].src);
+    for (int j = 0; j < n; j++) {
+      int r = regs[j];
+      if (!is_temp(r) || seen_in[r] == nloops)
+        continue;
+      seen_in[r] = nloops;
+      if (first_use[r] < loop_start) {
+        live[0]++;
+      } else {
+        live[i - loop_start]++;
+        if (last_use[r] < loop_end)
+          live[last_use[r] - loop_start]--;
+      }
+    }
+  }
+
+  int max = 0;
+  int n = 0;
+  for (int i = 0; i < len; i++) {
+    n += live[i];
+    if (n > max)
+      max = n;
+  }
+  free(live);
+  return (has_call ? 5 : 12) - code->nvars - max;
+}
+
+// Picks the values read in the loop that move out of it. A value that is
+// moved takes a register throughout the loop, so the ones that are the
+// most expensive to compute move first, as long as registers are free.
+// Loads and wide immediates count as two instructions and moves of other
+// immediates as none, since those fit in the instructions that use them.
+// What a value is computed from moves along with it.
+static void select_values(void) {
+  for (int i = loop_start; i < loop_end; i++) {
+    Inst *inst = &code->insts[i];
+    int t = written_reg(inst);
+    int regs[4];
+    int n = 0;
+    add_reg(regs, &n, &inst->dst);
+    add_reg(regs, &n, &inst->src);
+
+    if (t < 0 || !invariant[t]) {
+      for (int j = 0; j < n; j++)
+        if (invariant[regs[j]])
+          used_in_loop[regs[j]] = true;
+      continue;
+    }
+
+    if (inst->src.kind == OP_MEM && inst->kind != I_LEA)
+      cost[t] += 2;
+    else if (inst->kind != I_MOV || inst->src.kind != OP_IMM)
+      cost[t]++;
+    else if (inst->src.val != (int)inst->src.val)
+      cost[t] += 2;
+    for (int j = 0; j < n; j++)
+      if (regs[j] != t && invariant[regs[j]])
+        cost[t] += cost[regs[j]];
+  }
+
+  int budget = free_regs();
+  while (budget > 0) {
+    int best = -1;
+    for (int i = 0; i < nwritten; i++) {
+      int t = written[i];
+      if (invariant[t] && used_in_loop[t] && !hoisted[t] && cost[t] > 0 &&
+          (best < 0 || cost[t] > cost[best]))
+        best = t;
+    }
+    if (best < 0)
+      break;
+    hoisted[best] = true;
+    budget--;
+  }
+}
+
+// Returns the block that values computed before the loop with the given
+// header go to, or -1 if there is none.
+static int find_preheader(int header) {
+  Block *hb = &cfg->blocks[header];
+  int pre = -1;
+  for (int i = 0; i < hb->npreds; i++) {
+    int p = hb->preds[i];
+    if (in_loop[p])
+      continue;
+    if (pre >= 0)
+      return -1;
+    pre = p;
+  }
+  if (pre < 0)
+    return -1;
+  Inst *last = &code->insts[cfg->blocks[pre].end - 1];
+  if (cfg->blocks[pre].nsuccs == 2 && last->kind == I_JCC && pre + 1 == header)
+    return pre;
+  if (cfg->blocks[pre].nsuccs != 1)
+    return -1;
+  if (last->kind == I_JMP && last->dst.kind != OP_LABEL)
+    return -1;
+  return pre;
+}
+
+// Marks the instructions that move out of the loop with the given header.
+// Returns true if there are any.
+static bool process_loop(int header) {
+  int pre = find_preheader(header);
+  if (pre < 0)
+    return false;
+  scan_loop();
+
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    for (int i = 0; i < nwritten; i++) {
+      int t = written[i];
+      if (!is_temp(t) || invariant[t] || written_in[t] < 0 ||
+          first_use[t] < loop_start || last_use[t] >= loop_end ||
+          !is_invariant(t, written_in[t]))
+        continue;
+      invariant[t] = true;
+      changed = true;
+    }
+  }
+
+  select_values();
+
+  bool found = false;
+  for (int i = loop_end - 1; i >= loop_start; i--) {
+    Inst *inst = &code->insts[i];
+    int t = written_reg(inst);
+    if (t < 0 || !hoisted[t])
+      continue;
+    moves_to[i] = pre;
+    found = true;
+
+    int regs[2];
+    int n = 0;
+    add_reg(regs, &n, &inst->src);
+    for (int j = 0; j < n; j++)
+      if (invariant[regs[j]])
+        hoisted[regs[j]] = true;
+  }
+
+  for (int i = 0; i < nwritten; i++) {
+    int r = written[i];
+    written_in[r] = -1;
+    invariant[r] = false;
+    cost[r] = 0;
+    used_in_loop[r] = false;
+    hoisted[r] = false;
+  }
+  return found;
+}
+
+// Collects the blocks of the loop closed by jumps from latches to header.
+// Returns the number of blocks, or 0 if the loop is not laid out between
+// its header and its last latch, which the register allocator relies on.
+static int find_loop(int header, int *stack) {
+  int n = cfg->nblocks;
+  for (int b = 0; b < n; b++)
+    in_loop[b] = false;
+  in_loop[header] = true;
+
+  int sp = 0;
+  int last = -1;
+  Block *hb = &cfg->blocks[header];
+  for (int i = 0; i < hb->npreds; i++) {
+    int p = hb->preds[i];
+    if (!dominates(header, p))
+      continue;
+    if (p > last)
+      last = p;
+    if (!in_loop[p]) {
+      in_loop[p] = true;
+      stack[sp++] = p;
+    }
+  }
+  if (last < 0)
+    return 0;
+
+  while (sp > 0) {
+    Block *bb = &cfg->blocks[stack[--sp]];
+    for (int i = 0; i < bb->npreds; i++) {
+      int p = bb->preds[i];
+      if (in_loop[p] || idom[p] < 0)
+        continue;
+      in_loop[p] = true;
+      stack[sp++] = p;
+    }
+  }
+
+  int size = 0;
+  for (int b = 0; b < n; b++) {
+    if (!in_loop[b])
+      continue;
+    if (b < header || b > last)
+      return 0;
+    size++;
+  }
+  loop_start = hb->start;
+  loop_end = cfg->blocks[last].end;
+  return size;
+}
+
+static bool is_header(int b) {
+  Block *bb = &cfg->blocks[b];
+  for (int i = 0; i < bb->npreds; i++)
+    if (idom[bb->preds[i]] >= 0 && dominates(b, bb->preds[i]))
+      return true;
+  return false;
+}
+
+// Moves the marked instructions to the end of their preheaders, before
+// the unconditional jump that ends a preheader if there is one.
+static void move_insts(void) {
+  // The instructions moving to each block are chained in order.
+  int *first = reallocate(ALLOC_CODE, NULL, sizeof(int) * cfg->nblocks);
+  int *last = reallocate(ALLOC_CODE, NULL, sizeof(int) * cfg->nblocks);
+  int *next = reallocate(ALLOC_CODE, NULL, sizeof(int) * code->len);
+  for (int b = 0; b < cfg->nblocks; b++)
+    first[b] = -1;
+  for (int i = 0; i < code->len; i++) {
+    int b = moves_to[i];
+    if (b < 0)
+      continue;
+    next[i] = -1;
+    if (first[b] < 0)
+      first[b] = i;
+    else
+      next[last[b]] = i;
+    last[b] = i;
+  }
+
+  if (insts_cap < code->len) {
+    insts_cap = code->cap;
+    insts = reallocate(ALLOC_CODE, insts, sizeof(Inst) * insts_cap);
+  }
+  int len = 0;
+  for (int b = 0; b < cfg->nblocks; b++) {
+    Block *bb = &cfg->blocks[b];
+    int end = bb->end;
+    if (first[b] >= 0 && code->insts[end - 1].kind == I_JMP)
+      end--;
+    for (int i = bb->start; i < end; i++)
+      if (moves_to[i] < 0)
+        memcpy(&insts[len++], &code->insts[i], sizeof(Inst));
+    for (int i = first[b]; i >= 0; i = next[i])
+      memcpy(&insts[len++], &code->insts[i], sizeof(Inst));
+    if (end < bb->end)
+      memcpy(&insts[len++], &code->insts[end], sizeof(Inst));
+  }
+
+  Inst *tmp = code->insts;
+  int tmp_cap = code->cap;
+  code->insts = insts;
+  code->cap = insts_cap;
+  insts = tmp;
+  insts_cap = tmp_cap;
+  free(first);
+  free(last);
+  free(next);
+}
+
+// Moves values out of the loops found in the current code. Inner loops
+// are processed first, and an instruction only moves out of one loop at
+// a time. Returns true if anything moved to a block that is itself in a
+// loop.
+static bool hoist(void) {
+  cfg = build_cfg(code);
+  find_dominators();
+
+  int n = cfg->nblocks;
+  inst_block = reallocate(ALLOC_CODE, NULL, sizeof(int) * code->len);
+  for (int b = 0; b < n; b++)
+    for (int i = cfg->blocks[b].start; i < cfg->blocks[b].end; i++)
+      inst_block[i] = b;
+  moves_to = reallocate(ALLOC_CODE, NULL, sizeof(int) * code->len);
+  for (int i = 0; i < code->len; i++)
+    moves_to[i] = -1;
+  for (int r = 0; r < code->nregs; r++)
+    first_use[r] = -1;
+  for (int i = 0; i < code->len; i++) {
+    add_use(&code->insts[i].dst, i);
+    add_use(&code->insts[i].src, i);
+  }
+
+  in_loop = reallocate(ALLOC_CODE, NULL, sizeof(bool) * n);
+  bool *in_any_loop = allocate(ALLOC_CODE, sizeof(bool) * n);
+  int *stack = reallocate(ALLOC_CODE, NULL, sizeof(int) * n);
+  int *headers = reallocate(ALLOC_CODE, NULL, sizeof(int) * n);
+  int *sizes = reallocate(ALLOC_CODE, NULL, sizeof(int) * n);
+  int nheaders = 0;
+  for (int b = 0; b < n; b++) {
+    if (idom[b] < 0 || !is_header(b))
+      continue;
+    int size = find_loop(b, stack);
+    if (size == 0)
+      continue;
+    for (int i = 0; i < n; i++)
+      if (in_loop[i])
+        in_any_loop[i] = true;
+
+    int i = nheaders++;
+    for (; i > 0 && sizes[i - 1] > size; i--) {
+      headers[i] = headers[i - 1];
+      sizes[i] = sizes[i - 1];
+    }
+    headers[i] = b;
+    sizes[i] = size;
+  }
+
+  bool found = false;
+  for (int i = 0; i < nheaders; i++) {
+    find_loop(headers[i], stack);
+    found = process_loop(headers[i]) || found;
+  }
+
+  // Values moved to a block in another loop may move again.
+  bool again = false;
+  for (int i = 0; i < code->len; i++)
+    if (moves_to[i] >= 0 && in_any_loop[moves_to[i]])
+      again = true;
+  if (found)
+    move_insts();
+
+  free(in_loop);
+  free(in_any_loop);
+  free(stack);
+  free(headers);
+  free(sizes);
+  free(inst_block);
+  free(moves_to);
+  free(idom);
+  free(postorder);
+  free_cfg(cfg);
+  return again;
+}
+
+void hoist_invariants(Code *c) {
+  code = c;
+  if (code->len == 0)
+    return;
+
+  frame_escapes = false;
+  for (int i = 0; i < code->len; i++) {
+    Inst *inst = &code->insts[i];
+    if (inst->kind == I_LEA && inst->src.kind == OP_MEM && !inst->src.sym &&
+        inst->src.reg == RBP)
+      frame_escapes = true;
+  }
+
+  int n = code->nregs;
+  first_use = reallocate(ALLOC_CODE, NULL, sizeof(int) * n);
+  last_use = reallocate(ALLOC_CODE, NULL, sizeof(int) * n);
+  written_in = reallocate(ALLOC_CODE, NULL, sizeof(int) * n);
+  last_write = reallocate(ALLOC_CODE, NULL, sizeof(int) * n);
+  invariant = allocate(ALLOC_CODE, sizeof(bool) * n);
+  cost = allocate(ALLOC_CODE, sizeof(int) * n);
+  used_in_loop = allocate(ALLOC_CODE, sizeof(bool) * n);
+  hoisted = allocate(ALLOC_CODE, sizeof(bool) * n);
+  written = reallocate(ALLOC_CODE, NULL, sizeof(int) * n);
+  seen_in = allocate(ALLOC_CODE, sizeof(int) * n);
+  for (int r = 0; r < n; r++)
+    written_in[r] = -1;
+
+  while (hoist())
+    ;
+
+  free(first_use);
+  free(last_use);
+  free(written_in);
+  free(last_write);
+  free(invariant);
+  free(cost);
+  free(used_in_loop);
+  free(hoisted);
+  free(written);
+  free(seen_in);
+}
@@ -1,5 +1,46 @@
 #include "chibi.h"
 
+bool time_report;
+static int time_report_fns;
+static char *output_path;
+static bool opt_c;
+static bool opt_run;
+static int run_argc;
+static char **run_argv;
+
+char *phase_names[] = {"read_file",    "tokenize",  "parse",
+                       "stack layout", "emit_data", "emit_text"};
+
+static long phase_wall[PHASE_DONE];
+static long phase_cpu[PHASE_DONE];
+Phase current_phase = PHASE_DONE;
+static long phase_wall_start;
+static long phase_cpu_start;
+
+static long clock_ns(int clock) {
+  struct timespec ts;
+  clock_gettime(clock, &ts);
+  return ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+long now_ns(void) { return clock_ns(CLOCK_MONOTONIC); }
+
+// Charges the time spent since the last call to the phase that was running
+// and starts timing the given one.
+void enter_phase(Phase phase) {
+  long wall = now_ns();
+  long cpu = clock_ns(CLOCK_PROCESS_CPUTIME_ID);
+
+  if (current_phase != PHASE_DONE) {
+    phase_wall[current_phase] += wall - phase_wall_start;
+    phase_cpu[current_phase] += cpu - phase_cpu_start;
+  }
+
+  current_phase = phase;
+  phase_wall_start = wall;
+  phase_cpu_start = cpu;
+}
+
 static char *read_file(char *path) {
   FILE *fp = fopen(path, "r");
   if (!fp)
@@ -17,19 +58,231 @@ static char *read_file(char *path) {
   return buf;
 }
 
-int main(int argc, char **argv) {
-  if (argc != 2)
+static char *format_secs(long ns) {
+  char *buf = malloc(30);
+  long us = ns / 1000;
+  sprintf(buf, "%ld.%06ld", us / 1000000, us - us / 1000000 * 1000000);
+  return buf;
+}
+
+static void print_count(char *name, long count, long ns) {
+  if (ns == 0)
+    ns = 1;
+  fprintf(stderr, " %-14s %10ld %12ld/s\n", name, count,
+          count * 1000000000 / ns);
+}
+
+static void print_slowest_functions(Program *prog) {
+  int nfns = 0;
+  for (Function *fn = prog->fns; fn; fn = fn->next)
+    nfns++;
+
+  // Insertion sort by total time, slowest first.
+  Function **fns = calloc(nfns, sizeof(Function *));
+  int n = 0;
+  for (Function *fn = prog->fns; fn; fn = fn->next) {
+    long t = fn->parse_ns + fn->gen_ns;
+    int i = n++;
+    for (; i > 0 && fns[i - 1]->parse_ns + fns[i - 1]->gen_ns < t; i--)
+      fns[i] = fns[i - 1];
+    fns[i] = fn;
+  }
+
+  fprintf(stderr, "\nSlowest functions (seconds)\n");
+  fprintf(stderr, " %-24s %11s %11s", "function", "parse", "codegen");
+  fprintf(stderr, " %8s %8s\n", "nodes", "insns");
+
+  for (int i = 0; i < n && i < time_report_fns; i++) {
+    Function *fn = fns[i];
+    fprintf(stderr, " %-24s %11s %11s", fn->name, format_secs(fn->parse_ns),
+            format_secs(fn->gen_ns));
+    fprintf(stderr, " %8ld %8ld\n", fn->num_nodes, fn->num_insns);
+  }
+}
+
+static void print_time_report(Program *prog, long num_tokens) {
+  fprintf(stderr, "Execution times (seconds)\n");
+  fprintf(stderr, " %-14s %11s %11s\n", "phase", "wall", "cpu");
+
+  long wall = 0;
+  long cpu = 0;
+  for (int i = 0; i < PHASE_DONE; i++) {
+    fprintf(stderr, " %-14s %11s %11s\n", phase_names[i],
+            format_secs(phase_wall[i]), format_secs(phase_cpu[i]));
+    wall += phase_wall[i];
+    cpu += phase_cpu[i];
+  }
+  fprintf(stderr, " %-14s %11s %11s\n", "TOTAL", format_secs(wall),
+          format_secs(cpu));
+
+  int nfns = 0;
+  for (Function *fn = prog->fns; fn; fn = fn->next)
+    nfns++;
+
+  fprintf(stderr, "\n %-14s %10s %14s\n", "count", "total", "rate");
+  print_count("tokens", num_tokens, phase_wall[PHASE_TOKENIZE]);
+  print_count("nodes", num_nodes, phase_wall[PHASE_PARSE]);
+  print_count("functions", nfns, phase_wall[PHASE_PARSE]);
+  print_count("instructions", num_insns, phase_wall[PHASE_EMIT_TEXT]);
+
+  if (time_report_fns > 0)
+    print_slowest_functions(prog);
+}
+
+static void parse_args(int argc, char **argv) {
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-ftime-report")) {
+      time_report = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fmem-report")) {
+      mem_report = true;
+      continue;
+    }
+
+    if (!strncmp(argv[i], "-ftime-report=", 14)) {
+      time_report = true;
+      time_report_fns = strtol(argv[i] + 14, NULL, 10);
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-c")) {
+      opt_c = true;
+      continue;
+    }
+
+    // Arguments after the file name are passed to the program.
+    if (!strcmp(argv[i], "-run")) {
+      if (++i == argc)
+        error("-run: missing file name");
+      opt_run = true;
+      filename = argv[i];
+      run_argc = argc - i;
+      run_argv = argv + i;
+      break;
+    }
+
+    if (!strncmp(argv[i], "-l", 2)) {
+      jit_add_library(argv[i] + 2);
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-o")) {
+      if (++i == argc)
+        error("-o: missing output file name");
+      output_path = argv[i];
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fomit-frame-pointer")) {
+      omit_frame_pointer = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fno-inline")) {
+      no_inline = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-O")) {
+      opt_level = 1;
+      continue;
+    }
+
+    if (!strncmp(argv[i], "-O", 2)) {
+      char *end;
+      opt_level = strtol(argv[i] + 2, &end, 10);
+      if (*end || opt_level < 0)
+        error("invalid optimization level: %s", argv[i]);
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fdump-code")) {
+      dump_code = true;
+      continue;
+    }
+
+    if (!strncmp(argv[i], "-fcodegen-jobs=", 15)) {
+      codegen_jobs = strtol(argv[i] + 15, NULL, 10);
+      continue;
+    }
+
+    if (!strncmp(argv[i], "-fcodegen-cache=", 16)) {
+      cache_dir = argv[i] + 16;
+      continue;
+    }
+
+    if (argv[i][0] == '-' && argv[i][1] != '\0')
+      error("unknown argument: %s", argv[i]);
+
+    if (filename)
+      error("%s: invalid number of arguments", argv[0]);
+    filename = argv[i];
+  }
+
+  if (!filename)
     error("%s: invalid number of arguments", argv[0]);
 
-  filename = argv[1];
-  user_input = read_file(argv[1]);
+  // The codegen cache stores assembly, which object files cannot use.
+  if (opt_c || opt_run)
+    cache_dir = NULL;
+
+  // Dumps come from the functions that are compiled, one at a time.
+  if (dump_code) {
+    cache_dir = NULL;
+    codegen_jobs = 1;
+  }
+
+  // Memory that worker processes allocate would not be counted.
+  if (mem_report)
+    codegen_jobs = 1;
+
+  if (opt_level == 0)
+    no_inline = true;
+}
+
+// Returns the name of the object file for a source file, which is the
+// source file name with its directory stripped and .c replaced with .o.
+static char *object_path(char *path) {
+  char *base = strrchr(path, '/');
+  base = base ? base + 1 : path;
+
+  int len = strlen(base);
+  if (len > 2 && !strcmp(base + len - 2, ".c"))
+    len -= 2;
+
+  char *buf = malloc(len + 3);
+  sprintf(buf, "%.*s.o", len, base);
+  return buf;
+}
+
+int main(int argc, char **argv) {
+  parse_args(argc, argv);
+
+  enter_phase(PHASE_READ);
+  user_input = read_file(filename);
+
+  enter_phase(PHASE_TOKENIZE);
   token = tokenize();
+
+  long num_tokens = 0;
+  if (time_report)
+    for (Token *tok = token; tok; tok = tok->next)
+      num_tokens++;
+
+  enter_phase(PHASE_PARSE);
   Program *prog = program();
 
+  enter_phase(PHASE_LAYOUT);
   for (Function *fn = prog->fns; fn; fn = fn->next) {
+    promote_vars(fn);
+
     int offset = fn->has_varargs ? 56 : 0;
     for (VarList *vl = fn->locals; vl; vl = vl->next) {
       Var *var = vl->var;
+      if (var->in_reg)
+        continue;
       offset = align_to(offset, var->ty->align);
       offset += var->ty->size;
       var->offset = offset;
@@ -37,7 +290,31 @@ int main(int argc, char **argv) {
     fn->stack_size = align_to(offset, 8);
   }
 
-  codegen(prog);
+  if (opt_run) {
+    Object *obj = codegen_object(prog);
+    enter_phase(PHASE_DONE);
+    if (time_report)
+      print_time_report(prog, num_tokens);
+    if (mem_report)
+      print_mem_report(prog);
+    run_object(obj, run_argc, run_argv);
+  }
+
+  if (opt_c) {
+    Object *obj = codegen_object(prog);
+    Sink *out = new_file_sink(output_path ? output_path : object_path(filename));
+    write_object(obj, out);
+    sink_close(out);
+  } else {
+    Sink *out = output_path ? new_file_sink(output_path) : new_fd_sink(1);
+    codegen(prog, out);
+    sink_close(out);
+  }
+  enter_phase(PHASE_DONE);
 
+  if (time_report)
+    print_time_report(prog, num_tokens);
+  if (mem_report)
+    print_mem_report(prog);
   return 0;
 }
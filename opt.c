@@ -0,0 +1,93 @@
+#include "chibi.h"
+
+// The pass manager.
+//
+// Code generation selects x86 instructions on virtual registers, and that
+// code is what the optimization passes work on before register allocation
+// assigns physical registers to it. Each pass is run from an optimization
+// level on, in the order they are listed, and -O selects the level.
+
+int opt_level = 1;
+
+// -fdump-code prints the code of each function to stderr as it comes out
+// of code generation and after each pass, split into basic blocks.
+bool dump_code;
+
+typedef enum {
+  PASS_JUMP,
+  PASS_PEEPHOLE,
+  PASS_LICM,
+} PassKind;
+
+typedef struct {
+  PassKind kind;
+  char *name;
+  int level;
+} Pass;
+
+static Pass passes[] = {
+    {PASS_JUMP, "jump", 1},
+    {PASS_PEEPHOLE, "peephole", 1},
+    {PASS_LICM, "licm", 1},
+};
+
+static void run_pass(Pass *pass, Code *code) {
+  switch (pass->kind) {
+  case PASS_JUMP:
+    optimize_jumps(code);
+    return;
+  case PASS_PEEPHOLE:
+    peephole(code);
+    return;
+  case PASS_LICM:
+    hoist_invariants(code);
+    return;
+  }
+}
+
+static void dump(Code *code, char *funcname, char *after) {
+  Sink *out = new_mem_sink();
+  sink_str(out, "# ");
+  sink_str(out, funcname);
+  sink_str(out, " after ");
+  sink_str(out, after);
+  sink_char(out, '\n');
+
+  CFG *cfg = build_cfg(code);
+  for (int b = 0; b < cfg->nblocks; b++) {
+    Block *bb = &cfg->blocks[b];
+    sink_str(out, "# block ");
+    sink_int(out, b);
+    sink_str(out, " preds");
+    for (int i = 0; i < bb->npreds; i++) {
+      sink_char(out, ' ');
+      sink_int(out, bb->preds[i]);
+    }
+    sink_str(out, " succs");
+    for (int i = 0; i < bb->nsuccs; i++) {
+      sink_char(out, ' ');
+      sink_int(out, bb->succs[i]);
+    }
+    sink_char(out, '\n');
+    print_insts(out, code, bb->start, bb->end);
+  }
+  free_cfg(cfg);
+
+  fwrite(out->buf, 1, out->len, stderr);
+  free(out->buf);
+  free(out);
+}
+
+void run_passes(Code *code, char *funcname) {
+  if (dump_code)
+    dump(code, funcname, "codegen");
+
+  int npasses = sizeof(passes) / sizeof(*passes);
+  for (int i = 0; i < npasses; i++) {
+    if (passes[i].level > opt_level)
+      continue;
+    run_pass(&passes[i], code);
+    if (dump_code)
+      dump(code, funcname, passes[i].name);
+  }
+}
@@ -25,6 +25,8 @@ typedef struct {
   TagScope *tag_scope;
 } Scope;
 
+long num_nodes;
+
 static VarList *locals;
 
 static VarList *globals;
@@ -35,8 +37,10 @@ static int scope_depth;
 
 static Node *current_switch;
 
+static Function *current_fn;
+
 static Scope *enter_scope(void) {
-  Scope *sc = calloc(1, sizeof(Scope));
+  Scope *sc = allocate(ALLOC_SCOPE, sizeof(Scope));
   sc->var_scope = var_scope;
   sc->tag_scope = tag_scope;
   scope_depth++;
@@ -64,7 +68,8 @@ static TagScope *find_tag(Token *tok) {
 }
 
 static Node *new_node(NodeKind kind, Token *tok) {
-  Node *node = calloc(1, sizeof(Node));
+  num_nodes++;
+  Node *node = allocate(ALLOC_NODE, sizeof(Node));
   node->kind = kind;
   node->tok = tok;
   return node;
@@ -97,7 +102,7 @@ static Node *new_var_node(Var *var, Token *tok) {
 }
 
 static VarScope *push_scope(char *name) {
-  VarScope *sc = calloc(1, sizeof(VarScope));
+  VarScope *sc = allocate(ALLOC_SCOPE, sizeof(VarScope));
   sc->name = name;
   sc->next = var_scope;
   sc->depth = scope_depth;
@@ -106,7 +111,7 @@ static VarScope *push_scope(char *name) {
 }
 
 static Var *new_var(char *name, Type *ty, bool is_local) {
-  Var *var = calloc(1, sizeof(Var));
+  Var *var = allocate(ALLOC_VAR, sizeof(Var));
   var->name = name;
   var->ty = ty;
   var->is_local = is_local;
@@ -117,7 +122,7 @@ static Var *new_lvar(char *name, Type *ty) {
   Var *var = new_var(name, ty, true);
   push_scope(name)->var = var;
 
-  VarList *vl = calloc(1, sizeof(VarList));
+  VarList *vl = allocate(ALLOC_VAR, sizeof(VarList));
   vl->var = var;
   vl->next = locals;
   locals = vl;
@@ -130,7 +135,7 @@ static Var *new_gvar(char *name, Type *ty, bool is_static, bool emit) {
   push_scope(name)->var = var;
 
   if (emit) {
-    VarList *vl = calloc(1, sizeof(VarList));
+    VarList *vl = allocate(ALLOC_VAR, sizeof(VarList));
     vl->var = var;
     vl->next = globals;
     globals = vl;
@@ -147,11 +152,16 @@ static Type *find_typedef(Token *tok) {
   return NULL;
 }
 
+// Labels of data defined inside a function are numbered per function so
+// that the code generated for one function does not depend on the others.
 static char *new_label(void) {
   static int cnt = 0;
-  char buf[20];
-  sprintf(buf, ".L.data.%d", cnt++);
-  return strndup(buf, 20);
+  char *buf = malloc(40 + (current_fn ? strlen(current_fn->name) : 0));
+  if (current_fn)
+    sprintf(buf, ".L.data.%s.%d", current_fn->name, current_fn->nlabels++);
+  else
+    sprintf(buf, ".L.data.%d", cnt++);
+  return buf;
 }
 
 typedef enum {
@@ -231,7 +241,7 @@ Program *program(void) {
     global_var();
   }
 
-  Program *prog = calloc(1, sizeof(Program));
+  Program *prog = allocate(ALLOC_OTHER, sizeof(Program));
   prog->globals = globals;
   prog->fns = head.next;
   return prog;
@@ -356,7 +366,7 @@ static Type *declarator(Type *ty, char **name) {
     ty = pointer_to(ty);
 
   if (consume("(")) {
-    Type *placeholder = calloc(1, sizeof(Type));
+    Type *placeholder = allocate(ALLOC_TYPE, sizeof(Type));
     Type *new_ty = declarator(placeholder, name);
     expect(")");
     memcpy(placeholder, type_suffix(ty), sizeof(Type));
@@ -372,7 +382,7 @@ static Type *abstract_declarator(Type *ty) {
     ty = pointer_to(ty);
 
   if (consume("(")) {
-    Type *placeholder = calloc(1, sizeof(Type));
+    Type *placeholder = allocate(ALLOC_TYPE, sizeof(Type));
     Type *new_ty = abstract_declarator(placeholder);
     expect(")");
     memcpy(placeholder, type_suffix(ty), sizeof(Type));
@@ -410,7 +420,7 @@ static Type *type_name(void) {
 }
 
 static void push_tag_scope(Token *tok, Type *ty) {
-  TagScope *sc = calloc(1, sizeof(TagScope));
+  TagScope *sc = allocate(ALLOC_SCOPE, sizeof(TagScope));
   sc->next = tag_scope;
   sc->name = strndup(tok->str, tok->len);
   sc->depth = scope_depth;
@@ -546,7 +556,7 @@ static Member *struct_member(void) {
   ty = type_suffix(ty);
   expect(";");
 
-  Member *mem = calloc(1, sizeof(Member));
+  Member *mem = allocate(ALLOC_MEMBER, sizeof(Member));
   mem->name = name;
   mem->ty = ty;
   mem->tok = tok;
@@ -562,7 +572,7 @@ static VarList *read_func_param(void) {
   if (ty->kind == TY_ARRAY)
     ty = pointer_to(ty->base);
 
-  VarList *vl = calloc(1, sizeof(VarList));
+  VarList *vl = allocate(ALLOC_VAR, sizeof(VarList));
   vl->var = new_lvar(name, ty);
   return vl;
 }
@@ -593,9 +603,137 @@ static void read_func_params(Function *fn) {
   }
 }
 
+typedef struct Layout Layout;
+struct Layout {
+  Layout *next;
+  Type *ty;
+  int id;
+};
+
+// Prints everything about a type that code generation depends on. Each
+// type is spelled out once; later references to it, including recursive
+// ones, print its number.
+static void print_layout(FILE *fp, Type *ty, Layout **seen) {
+  for (Layout *l = *seen; l; l = l->next) {
+    if (l->ty == ty) {
+      fprintf(fp, "#%d", l->id);
+      return;
+    }
+  }
+
+  Layout *l = allocate(ALLOC_OTHER, sizeof(Layout));
+  l->ty = ty;
+  l->id = *seen ? (*seen)->id + 1 : 0;
+  l->next = *seen;
+  *seen = l;
+
+  fprintf(fp, "(%d %d %d", ty->kind, ty->size, ty->align);
+  fprintf(fp, " %d %d", ty->array_len, ty->is_incomplete);
+  if (ty->base)
+    print_layout(fp, ty->base, seen);
+  if (ty->return_ty)
+    print_layout(fp, ty->return_ty, seen);
+  for (Member *mem = ty->members; mem; mem = mem->next) {
+    fprintf(fp, " %s@%d", mem->name, mem->offset);
+    print_layout(fp, mem->ty, seen);
+  }
+  fprintf(fp, ")");
+}
+
+typedef struct Ident Ident;
+struct Ident {
+  Ident *next;
+  Token *tok;
+};
+
+static bool seen_ident(Ident **seen, Token *tok) {
+  for (Ident *id = *seen; id; id = id->next)
+    if (id->tok->len == tok->len && !strncmp(id->tok->str, tok->str, tok->len))
+      return true;
+
+  Ident *id = allocate(ALLOC_OTHER, sizeof(Ident));
+  id->tok = tok;
+  id->next = *seen;
+  *seen = id;
+  return false;
+}
+
+// Returns the cache key of a function definition spanning tokens from begin
+// to end. The key consists of the tokens themselves followed by what each
+// identifier in them refers to in the enclosing scope, so a change to a
+// global, a typedef or a struct used by the function invalidates its entry.
+static char *fingerprint(Token *begin, Token *end) {
+  char *buf;
+  size_t buflen;
+  FILE *fp = open_memstream(&buf, &buflen);
+  Layout *seen = NULL;
+  Ident *idents = NULL;
+
+  // Bump the version whenever codegen changes the assembly it emits.
+  fprintf(fp, "ccc-codegen-19 %d %d\n", omit_frame_pointer, opt_level);
+  for (Token *t = begin; t != end->next; t = t->next)
+    fprintf(fp, " %.*s", t->len, t->str);
+  fprintf(fp, "\n");
+
+  for (Token *t = begin; t != end->next; t = t->next) {
+    if (t->kind != TK_IDENT || seen_ident(&idents, t))
+      continue;
+
+    fprintf(fp, "%.*s:", t->len, t->str);
+
+    VarScope *sc = find_var(t);
+    if (!sc) {
+      fprintf(fp, " ?");
+    } else if (sc->var && sc->var->is_local) {
+      fprintf(fp, " local");
+    } else if (sc->var) {
+      fprintf(fp, " var %d ", sc->var->is_static);
+      print_layout(fp, sc->var->ty, &seen);
+
+      // The code of an inlined function becomes part of the caller's.
+      Function *callee = NULL;
+      if (sc->var->ty->kind == TY_FUNC)
+        callee = find_inline(strndup(t->str, t->len));
+      if (callee)
+        fprintf(fp, " inline {%s}", callee->cache_key);
+    } else if (sc->type_def) {
+      fprintf(fp, " typedef ");
+      print_layout(fp, sc->type_def, &seen);
+    } else if (sc->enum_ty) {
+      fprintf(fp, " enum %d", sc->enum_val);
+    }
+
+    TagScope *tag = find_tag(t);
+    if (tag) {
+      fprintf(fp, " tag ");
+      print_layout(fp, tag->ty, &seen);
+    }
+    fprintf(fp, "\n");
+  }
+
+  fclose(fp);
+  return buf;
+}
+
+// Returns the closing brace of the function body starting at the current
+// token.
+static Token *body_end(void) {
+  int depth = 0;
+  for (Token *t = token; t->kind != TK_EOF; t = t->next) {
+    if (t->kind != TK_RESERVED || t->len != 1)
+      continue;
+    if (*t->str == '{')
+      depth++;
+    else if (*t->str == '}' && --depth == 0)
+      return t;
+  }
+  error_tok(token, "unclosed function body");
+}
+
 static Function *function(void) {
   locals = NULL;
 
+  Token *begin = token;
   StorageClass sclass;
   Type *ty = basetype(&sclass);
   char *name = NULL;
@@ -603,7 +741,7 @@ static Function *function(void) {
 
   new_gvar(name, func_type(ty), false, false);
 
-  Function *fn = calloc(1, sizeof(Function));
+  Function *fn = allocate(ALLOC_FUNCTION, sizeof(Function));
   fn->name = name;
   fn->is_static = (sclass == STATIC);
   expect("(");
@@ -616,6 +754,25 @@ static Function *function(void) {
     return NULL;
   }
 
+  if (cache_dir) {
+    Token *end = body_end();
+    fn->cache_key = fingerprint(begin, end);
+    fn->cached_asm = cache_load(fn->cache_key);
+
+    // Callers need the body of a function that may be inlined, so it is
+    // parsed even if its code is cached.
+    if (fn->cached_asm && !may_inline(begin, end->next)) {
+      token = end->next;
+      leave_scope(sc);
+      return fn;
+    }
+  }
+
+  VarList *outer_globals = globals;
+  current_fn = fn;
+  long start = time_report ? now_ns() : 0;
+  long nodes = num_nodes;
+
   Node head = {};
   Node *cur = &head;
   expect("{");
@@ -624,14 +781,31 @@ static Function *function(void) {
     cur = cur->next;
   }
   leave_scope(sc);
+  current_fn = NULL;
 
   fn->node = head.next;
   fn->locals = locals;
+  inline_function(fn, begin, token);
+  if (time_report) {
+    fn->parse_ns = now_ns() - start;
+    fn->num_nodes = num_nodes - nodes;
+  }
+
+  // Static local variables and string literals are emitted along with the
+  // function that defines them.
+  if (globals != outer_globals) {
+    fn->globals = globals;
+    VarList *vl = globals;
+    while (vl->next != outer_globals)
+      vl = vl->next;
+    vl->next = NULL;
+    globals = outer_globals;
+  }
   return fn;
 }
 
 static Initializer *new_init_val(Initializer *cur, int sz, int val) {
-  Initializer *init = calloc(1, sizeof(Initializer));
+  Initializer *init = allocate(ALLOC_INITIALIZER, sizeof(Initializer));
   init->sz = sz;
   init->val = val;
   cur->next = init;
@@ -639,7 +813,7 @@ static Initializer *new_init_val(Initializer *cur, int sz, int val) {
 }
 
 static Initializer *new_init_label(Initializer *cur, char *label, long addend) {
-  Initializer *init = calloc(1, sizeof(Initializer));
+  Initializer *init = allocate(ALLOC_INITIALIZER, sizeof(Initializer));
   init->label = label;
   init->addend = addend;
   cur->next = init;
@@ -1038,6 +1212,7 @@ static Node *stmt2(void) {
     Node *node = new_node(ND_SWITCH, tok);
     expect("(");
     node->cond = expr();
+    add_type(node->cond);
     expect(")");
 
     Node *sw = current_switch;
@@ -1050,10 +1225,17 @@ static Node *stmt2(void) {
   if (tok = consume("case")) {
     if (!current_switch)
       error_tok(tok, "stray case");
-    int val = const_expr();
+    // Case values are converted to the type of the controlling expression,
+    // which is at least int after the usual promotions.
+    long val = const_expr();
+    if (current_switch->cond->ty->size < 8)
+      val = (int)val;
     expect(":");
 
     Node *node = new_unary(ND_CASE, stmt(), tok);
+    for (Node *n = current_switch->case_next; n; n = n->case_next)
+      if (n->val == val)
+        error_tok(tok, "duplicate case value");
     node->val = val;
     node->case_next = current_switch->case_next;
     current_switch->case_next = node;
@@ -0,0 +1,445 @@
+#include "chibi.h"
+
+// Peephole optimization.
+//
+// Code generation evaluates every subexpression into a register of its
+// own, so values are often moved to another register only to be used
+// once, or computed into a copy that is then moved back. Before register
+// allocation, this pass looks at a small window at the end of the
+// instructions kept so far each time it takes another one, and rewrites
+// the window as long as one of the rules below applies to it.
+
+typedef enum {
+  RULE_SELF_MOV, // mov r, r               =>
+  RULE_DEAD,     // add t, 1               =>  (t is not used again)
+  RULE_FORWARD,  // mov t, r; cmp t, s     =>  cmp r, s
+                 // lea t, [r+8]; mov s, [t]  =>  mov s, [r+8]
+  RULE_EXT_IMM,  // mov r, 5; movsx r, r   =>  mov r, 5
+  RULE_FOLD,     // mov t, r; add t, s; mov r, t  =>  add r, s
+                 // movsx t, [m]; add t, s; mov [m], t  =>  add [m], s
+  RULE_SCALE,    // shl t, 2; add r, t     =>  lea r, [r+t*4]
+} RuleKind;
+
+// A rule is tried if the kinds of the last len instructions are as listed,
+// where -1 matches any kind.
+typedef struct {
+  RuleKind kind;
+  int len;
+  int insts[3];
+} Rule;
+
+static Rule rules[] = {
+    {RULE_SELF_MOV, 1, {I_MOV}},
+    {RULE_DEAD, 1, {-1}},
+    {RULE_FORWARD, 2, {I_MOV, -1}},
+    {RULE_FORWARD, 2, {I_LEA, -1}},
+    {RULE_EXT_IMM, 2, {I_MOV, I_MOVSX}},
+    {RULE_EXT_IMM, 2, {I_MOV, I_MOVZX}},
+    {RULE_FOLD, 3, {I_MOV, -1, I_MOV}},
+    {RULE_FOLD, 3, {I_MOVSX, -1, I_MOV}},
+    {RULE_SCALE, 2, {I_SHL, I_ADD}},
+};
+
+static Code *code;
+
+// The instructions kept so far are code->insts[0..len), and cur is the
+// index of the one taken last. last[r] is the index of the last
+// instruction that mentions virtual register r.
+static int len;
+static int cur;
+static int *last;
+
+// Returns true if a register holds no value that is needed after the
+// instruction taken last. Variables may be needed on the next iteration of
+// a loop, so only temporaries ever die.
+static bool dies(int reg) {
+  return reg >= VREG + code->nvars && last[reg] <= cur;
+}
+
+static bool mentions(Operand *op, int reg) {
+  if (op->kind == OP_REG)
+    return op->reg == reg;
+  if (op->kind != OP_MEM)
+    return false;
+  return (!op->sym && op->reg == reg) || (op->scale && op->index == reg);
+}
+
+// Instructions that only read their first operand.
+static bool reads_dst(InstKind kind) {
+  return kind == I_CMP || kind == I_IDIV || kind == I_IMULH ||
+         kind == I_PUSH || kind == I_JMP;
+}
+
+static bool writes(Inst *inst, int reg) {
+  return inst->dst.kind == OP_REG && inst->dst.reg == reg &&
+         !reads_dst(inst->kind);
+}
+
+static bool reads(Inst *inst, int reg) {
+  if (mentions(&inst->src, reg))
+    return true;
+  if (inst->dst.kind == OP_MEM)
+    return mentions(&inst->dst, reg);
+  return mentions(&inst->dst, reg) && reads_dst(inst->kind);
+}
+
+static void rename_operand(Operand *op, int from, int to) {
+  if (op->kind == OP_MEM && op->scale && op->index == from)
+    op->index = to;
+  if ((op->kind == OP_REG || (op->kind == OP_MEM && !op->sym)) &&
+      op->reg == from)
+    op->reg = to;
+}
+
+static void rename_reg(Inst *inst, int from, int to) {
+  rename_operand(&inst->dst, from, to);
+  rename_operand(&inst->src, from, to);
+}
+
+// Instructions that do nothing but write their first operand.
+static bool is_pure(InstKind kind) {
+  switch (kind) {
+  case I_MOV:
+  case I_MOVSX:
+  case I_MOVZX:
+  case I_LEA:
+  case I_ADD:
+  case I_SUB:
+  case I_IMUL:
+  case I_AND:
+  case I_OR:
+  case I_XOR:
+  case I_SHL:
+  case I_SAR:
+  case I_NOT:
+  case I_SETCC:
+    return true;
+  }
+  return false;
+}
+
+// Instructions that write their first operand without reading it.
+static bool is_overwrite(InstKind kind) {
+  return kind == I_MOV || kind == I_MOVSX || kind == I_MOVZX || kind == I_LEA;
+}
+
+// Instructions that compute a new value from their first operand and
+// write it back.
+static bool is_update(InstKind kind) {
+  return is_pure(kind) && kind != I_MOV && kind != I_LEA &&
+         kind != I_SETCC;
+}
+
+// Instructions that can read their second operand from memory.
+static bool takes_mem_src(InstKind kind) {
+  return kind == I_MOV || kind == I_ADD || kind == I_SUB || kind == I_AND ||
+         kind == I_OR || kind == I_XOR || kind == I_CMP || kind == I_IMUL;
+}
+
+// Instructions that can update their first operand in memory.
+static bool takes_mem_dst(InstKind kind) {
+  return kind == I_ADD || kind == I_SUB || kind == I_AND || kind == I_OR ||
+         kind == I_XOR || kind == I_NOT || kind == I_SHL || kind == I_SAR;
+}
+
+static bool same_operand(Operand *a, Operand *b) {
+  if (a->kind != b->kind || a->reg != b->reg)
+    return false;
+  if (a->kind == OP_REG)
+    return true;
+  if (a->val != b->val || a->sym != b->sym || a->scale != b->scale)
+    return false;
+  return !a->scale || a->index == b->index;
+}
+
+static void extend_reg(int reg) {
+  if (reg >= VREG && last[reg] < cur)
+    last[reg] = cur;
+}
+
+// Makes the registers an operand mentions live until the instruction
+// taken last, to which the operand has been moved.
+static void extend_use(Operand *op) {
+  if (mentions(op, op->reg))
+    extend_reg(op->reg);
+  if (op->kind == OP_MEM && op->scale)
+    extend_reg(op->index);
+}
+
+// [base+index*scale]
+static void set_mem_index(Operand *op, int base, int index, int scale) {
+  op->kind = OP_MEM;
+  op->size = 8;
+  op->reg = base;
+  op->index = index;
+  op->scale = scale;
+  op->val = 0;
+  op->sym = NULL;
+}
+
+static bool fits_size(long val, int size) {
+  if (size == 1)
+    return val == (char)val;
+  if (size == 2)
+    return val == (short)val;
+  return val == (int)val;
+}
+
+static long extend(InstKind kind, long val, int size) {
+  if (kind == I_MOVZX)
+    return size == 1 ? val & 255 : val & 65535;
+  if (size == 1)
+    return (char)val;
+  if (size == 2)
+    return (short)val;
+  return (int)val;
+}
+
+// Is the instruction mov t, x for a temporary t? An address such as that
+// of lea t, [t+8] may mention t itself, which keeps its old value once
+// the lea is gone.
+static bool is_temp_mov(Inst *inst) {
+  if (inst->dst.kind != OP_REG || inst->dst.size != 8 ||
+      inst->dst.reg < VREG + code->nvars || inst->src.kind == OP_NONE)
+    return false;
+  return inst->kind == I_LEA || !mentions(&inst->src, inst->dst.reg);
+}
+
+// Replaces the register t that an instruction reads with a memory operand.
+static bool forward_mem(Operand *mem, Inst *inst, int t) {
+  if (!takes_mem_src(inst->kind))
+    return false;
+
+  Operand *op = NULL;
+  if (inst->src.kind == OP_REG && inst->src.reg == t &&
+      inst->src.size == 8 && inst->dst.kind == OP_REG &&
+      inst->dst.reg != t)
+    op = &inst->src;
+  else if (inst->kind == I_CMP && inst->dst.kind == OP_REG &&
+           inst->dst.reg == t && inst->src.kind != OP_MEM &&
+           !mentions(&inst->src, t))
+    op = &inst->dst;
+  if (!op)
+    return false;
+
+  memcpy(op, mem, sizeof(Operand));
+  extend_use(op);
+  return true;
+}
+
+// Replaces the base register t of a memory operand with the address that
+// lea t, addr computed, or turns mov r, t into lea r, addr.
+static bool forward_addr(Operand *addr, Inst *inst, int t) {
+  if (addr->kind != OP_MEM)
+    return false;
+
+  if (inst->kind == I_MOV && inst->dst.kind == OP_REG &&
+      inst->dst.reg != t && inst->src.kind == OP_REG &&
+      inst->src.reg == t && inst->src.size == 8) {
+    inst->kind = I_LEA;
+    memcpy(&inst->src, addr, sizeof(Operand));
+    extend_use(&inst->src);
+    return true;
+  }
+
+  Operand *op = &inst->src;
+  Operand *other = &inst->dst;
+  if (inst->dst.kind == OP_MEM) {
+    op = &inst->dst;
+    other = &inst->src;
+  }
+  if (op->kind != OP_MEM || op->sym || op->reg != t || mentions(other, t))
+    return false;
+  if (op->scale && (addr->scale || addr->sym || op->index == t))
+    return false;
+  long disp = addr->val + op->val;
+  if (disp != (int)disp)
+    return false;
+
+  int size = op->size;
+  if (op->scale) {
+    int index = op->index;
+    int scale = op->scale;
+    memcpy(op, addr, sizeof(Operand));
+    op->index = index;
+    op->scale = scale;
+  } else {
+    memcpy(op, addr, sizeof(Operand));
+  }
+  op->val = disp;
+  op->size = size;
+  extend_use(op);
+  return true;
+}
+
+static bool forward(Inst *mov, Inst *inst) {
+  int t = mov->dst.reg;
+  if (!reads(inst, t))
+    return false;
+
+  // An instruction that writes t without reading it ends the old value
+  // of t as well.
+  if (writes(inst, t)) {
+    if (!is_overwrite(inst->kind) || mov->kind != I_MOV ||
+        mov->src.kind != OP_REG)
+      return false;
+    rename_operand(&inst->src, t, mov->src.reg);
+    extend_reg(mov->src.reg);
+    return true;
+  }
+  if (!dies(t))
+    return false;
+
+  if (mov->kind == I_LEA)
+    return forward_addr(&mov->src, inst, t);
+
+  if (mov->src.kind == OP_MEM)
+    return forward_mem(&mov->src, inst, t);
+
+  if (mov->src.kind == OP_IMM) {
+    // An immediate can only be moved, and only if it fits.
+    long val = mov->src.val;
+    if (inst->kind != I_MOV || inst->src.kind != OP_REG ||
+        mentions(&inst->dst, t))
+      return false;
+    if (!(inst->dst.kind == OP_REG && inst->dst.size == 8) &&
+        !fits_size(val, inst->dst.size))
+      return false;
+    inst->src.kind = OP_IMM;
+    inst->src.val = val;
+    return true;
+  }
+
+  int r = mov->src.reg;
+  rename_reg(inst, t, r);
+  extend_reg(r);
+  return true;
+}
+
+static bool fold(Inst *load, Inst *op, Inst *back) {
+  int t = load->dst.reg;
+  if (!is_update(op->kind) || op->dst.kind != OP_REG || op->dst.reg != t ||
+      !same_operand(&back->dst, &load->src) || back->src.kind != OP_REG ||
+      back->src.reg != t || !dies(t))
+    return false;
+
+  if (load->src.kind == OP_REG) {
+    if (load->kind != I_MOV || back->dst.size != 8)
+      return false;
+    rename_reg(op, t, load->src.reg);
+    return true;
+  }
+
+  // The low bytes of the result only depend on the low bytes of the
+  // operands, so the update can be done in memory at the variable's own
+  // size.
+  int size = back->dst.size;
+  if (load->src.kind != OP_MEM || load->src.size != size ||
+      !takes_mem_dst(op->kind) || op->src.kind == OP_MEM ||
+      mentions(&op->src, t))
+    return false;
+  if (op->src.kind == OP_IMM && !fits_size(op->src.val, size))
+    return false;
+
+  memcpy(&op->dst, &back->dst, sizeof(Operand));
+  if (op->src.kind == OP_REG && op->kind != I_SHL && op->kind != I_SAR)
+    op->src.size = size;
+  return true;
+}
+
+static bool apply(RuleKind kind, Inst *w) {
+  switch (kind) {
+  case RULE_SELF_MOV:
+    if (w->dst.kind != OP_REG || w->src.kind != OP_REG ||
+        w->dst.reg != w->src.reg || w->dst.size != 8)
+      return false;
+    len--;
+    return true;
+  case RULE_DEAD:
+    if (w->dst.kind != OP_REG || !dies(w->dst.reg) || !is_pure(w->kind))
+      return false;
+    len--;
+    return true;
+  case RULE_FORWARD:
+    if (!is_temp_mov(&w[0]) || !forward(&w[0], &w[1]))
+      return false;
+    memcpy(&w[0], &w[1], sizeof(Inst));
+    len--;
+    return true;
+  case RULE_EXT_IMM:
+    if (w[0].dst.kind != OP_REG || w[0].src.kind != OP_IMM ||
+        w[1].dst.kind != OP_REG || w[1].dst.size != 8 ||
+        w[1].src.kind != OP_REG || w[1].dst.reg != w[0].dst.reg ||
+        w[1].src.reg != w[0].dst.reg)
+      return false;
+    w[0].src.val = extend(w[1].kind, w[0].src.val, w[1].src.size);
+    len--;
+    return true;
+  case RULE_FOLD:
+    if (!is_temp_mov(&w[0]) || !fold(&w[0], &w[1], &w[2]))
+      return false;
+    memcpy(&w[0], &w[1], sizeof(Inst));
+    len -= 2;
+    return true;
+  case RULE_SCALE: {
+    int t = w[0].dst.reg;
+    int r = w[1].dst.reg;
+    if (w[0].dst.kind != OP_REG || w[0].dst.size != 8 ||
+        w[0].src.kind != OP_IMM || w[0].src.val < 1 || w[0].src.val > 3 ||
+        w[1].dst.kind != OP_REG || w[1].dst.size != 8 || r == t ||
+        w[1].src.kind != OP_REG || w[1].src.reg != t || !dies(t))
+      return false;
+    int scale = 1 << w[0].src.val;
+    w[0].kind = I_LEA;
+    set_mem_index(&w[0].src, r, t, scale);
+    w[0].dst.reg = r;
+    len--;
+    return true;
+  }
+  }
+  return false;
+}
+
+static bool apply_rules(void) {
+  int nrules = sizeof(rules) / sizeof(*rules);
+  for (int i = 0; i < nrules; i++) {
+    Rule *rule = &rules[i];
+    if (rule->len > len)
+      continue;
+
+    Inst *w = code->insts + len - rule->len;
+    int j = 0;
+    while (j < rule->len && (rule->insts[j] < 0 || w[j].kind == rule->insts[j]))
+      j++;
+    if (j == rule->len && apply(rule->kind, w))
+      return true;
+  }
+  return false;
+}
+
+static void add_use(Operand *op, int i) {
+  if (mentions(op, op->reg) && op->reg >= VREG)
+    last[op->reg] = i;
+  if (op->kind == OP_MEM && op->scale && op->index >= VREG)
+    last[op->index] = i;
+}
+
+void peephole(Code *c) {
+  code = c;
+  last = allocate(ALLOC_CODE, sizeof(int) * code->nregs);
+  for (int i = 0; i < code->len; i++) {
+    add_use(&code->insts[i].dst, i);
+    add_use(&code->insts[i].src, i);
+  }
+
+  len = 0;
+  for (cur = 0; cur < code->len; cur++) {
+    if (len < cur)
+      memcpy(&code->insts[len], &code->insts[cur], sizeof(Inst));
+    len++;
+    while (apply_rules())
+      ;
+  }
+  code->len = len;
+  free(last);
+}
@@ -0,0 +1,70 @@
+#include "chibi.h"
+
+// Promotion of local variables to registers.
+//
+// A scalar variable whose address is never taken can only be accessed by
+// name, so it does not need a stack slot and can be kept in a register for
+// the whole function. There are only so many registers that survive
+// calls, so the variables that are used most often get them, where a use
+// inside a loop counts for more than one outside.
+
+// As many as there are callee-saved registers.
+static int max_promoted = 5;
+
+// Uses inside loops are weighted by this much per level of nesting, up to
+// max_weight.
+static int loop_weight = 8;
+static int max_weight = 4096;
+
+static void count_uses(Node *node, int weight) {
+  if (!node)
+    return;
+
+  if (node->kind == ND_VAR && node->var->is_local)
+    node->var->uses += weight;
+  if (node->kind == ND_ADDR && node->lhs->kind == ND_VAR)
+    node->lhs->var->addr_taken = true;
+
+  count_uses(node->init, weight);
+  if ((node->kind == ND_WHILE || node->kind == ND_FOR ||
+       node->kind == ND_DO) &&
+      weight < max_weight)
+    weight *= loop_weight;
+
+  count_uses(node->lhs, weight);
+  count_uses(node->rhs, weight);
+  count_uses(node->cond, weight);
+  count_uses(node->then, weight);
+  count_uses(node->els, weight);
+  count_uses(node->inc, weight);
+
+  for (Node *n = node->body; n; n = n->next)
+    count_uses(n, weight);
+  for (Node *n = node->args; n; n = n->next)
+    count_uses(n, weight);
+}
+
+static bool is_promotable(Var *var) {
+  TypeKind k = var->ty->kind;
+  return !var->addr_taken && var->uses > 0 && k != TY_ARRAY &&
+         k != TY_STRUCT;
+}
+
+// Decides which local variables of a function live in registers.
+void promote_vars(Function *fn) {
+  for (Node *node = fn->node; node; node = node->next)
+    count_uses(node, 1);
+
+  for (int i = 0; i < max_promoted; i++) {
+    Var *best = NULL;
+    for (VarList *vl = fn->locals; vl; vl = vl->next) {
+      Var *var = vl->var;
+      if (!var->in_reg && is_promotable(var) &&
+          (!best || var->uses > best->uses))
+        best = var;
+    }
+    if (!best)
+      return;
+    best->in_reg = true;
+  }
+}
@@ -0,0 +1,535 @@
+#include "chibi.h"
+
+// Linear-scan register allocation.
+//
+// Code generation hands out a fresh virtual register for every value it
+// computes. The live range of a virtual register is taken to be the
+// interval from the first to the last instruction that mentions it, which
+// is exact for the temporaries of expression trees. Variables may be live
+// across loops, so theirs cover the whole function instead. Intervals are
+// visited in order of their starts and given any free register that
+// nothing overwrites in between, or else a stack slot.
+
+// Registers handed out, in order of preference. The callee-saved ones come
+// last because the function has to save them, but they are the only ones
+// that survive calls. rax and rdx are not handed out. They are needed for
+// division and return values anyway, and they are used to move spilled
+// values in and out of their stack slots.
+static int pool[] = {RSI, RDI, R8, R9, R10, R11, RCX, RBX, R12, R13, R14, R15};
+
+typedef struct {
+  int start;
+  int end;
+  int clobbered; // Registers overwritten between start and end
+  int reg;       // Physical register, or -1 if spilled
+  int slot;      // Offset of the stack slot below rbp if spilled
+} Interval;
+
+static Interval *intervals;
+
+// The registers each instruction overwrites, and the number of
+// instructions before each one that overwrite any.
+static int *clobbers;
+static int *nclobbers;
+static int clobbers_cap;
+
+// The rewritten instructions are built here and swapped with the code's
+// own array, which is then reused for the next function.
+static Inst *insts;
+static int insts_cap;
+static int len;
+
+// The caller-saved registers.
+static int clobbered_regs_call(void) {
+  return 1 << RAX | 1 << RCX | 1 << RDX | 1 << RSI | 1 << RDI | 1 << R8 |
+         1 << R9 | 1 << R10 | 1 << R11;
+}
+
+// Returns a bitmap of the physical registers an instruction overwrites.
+static int clobbered_regs(Inst *inst) {
+  switch (inst->kind) {
+  case I_CQO:
+    return 1 << RDX;
+  case I_IDIV:
+  case I_IMULH:
+    return 1 << RAX | 1 << RDX;
+  case I_CALL:
+    return clobbered_regs_call();
+  case I_CMP:
+  case I_PUSH:
+    return 0;
+  }
+  if (inst->dst.kind == OP_REG && inst->dst.reg < VREG)
+    return 1 << inst->dst.reg;
+  return 0;
+}
+
+static bool is_virtual(Operand *op) {
+  if (op->kind == OP_REG)
+    return op->reg >= VREG;
+  return op->kind == OP_MEM && !op->sym && op->reg >= VREG;
+}
+
+static bool has_virtual_index(Operand *op) {
+  return op->kind == OP_MEM && op->scale && op->index >= VREG;
+}
+
+static void add_use(int reg, int i, int *order, int *norder) {
+  Interval *it = &intervals[reg];
+  if (it->start < 0) {
+    it->start = i;
+    order[(*norder)++] = reg;
+  }
+  if (it->end < i)
+    it->end = i;
+}
+
+static void add_uses(Operand *op, int i, int *order, int *norder) {
+  if (is_virtual(op))
+    add_use(op->reg, i, order, norder);
+  if (has_virtual_index(op))
+    add_use(op->index, i, order, norder);
+}
+
+// A temporary that is computed before a loop and used in it, as when the
+// computation was moved out of the loop, is needed on every iteration. Its
+// interval is extended to the jump back to the start of the loop, which
+// may in turn extend it over an outer loop.
+static void extend_over_loops(Code *code) {
+  int *label_pos = reallocate(ALLOC_CODE, NULL, sizeof(int) * code->nlabels);
+  for (int i = 0; i < code->nlabels; i++)
+    label_pos[i] = -1;
+  for (int i = 0; i < code->len; i++)
+    if (code->insts[i].kind == I_LABEL)
+      label_pos[code->insts[i].dst.val] = i;
+
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    for (int j = 0; j < code->len; j++) {
+      Inst *inst = &code->insts[j];
+      if ((inst->kind != I_JMP && inst->kind != I_JCC &&
+           inst->kind != I_ENTRY) ||
+          inst->dst.kind != OP_LABEL)
+        continue;
+      int i = label_pos[inst->dst.val];
+      if (i < 0 || i > j)
+        continue;
+      for (int r = VREG + code->nvars; r < code->nregs; r++) {
+        Interval *it = &intervals[r];
+        if (it->start >= 0 && it->start < i && i <= it->end &&
+            it->end < j) {
+          it->end = j;
+          changed = true;
+        }
+      }
+    }
+  }
+  free(label_pos);
+}
+
+// Finds the registers that lose their value between the start of an
+// interval and its end. An instruction reads its operands before it
+// writes, so whatever happens at either end does not matter.
+static void find_clobbers(Interval *it) {
+  it->clobbered = 0;
+  if (it->end <= it->start + 1 ||
+      nclobbers[it->end] == nclobbers[it->start + 1])
+    return;
+
+  int call = clobbered_regs_call();
+  for (int i = it->start + 1; i < it->end; i++) {
+    it->clobbered |= clobbers[i];
+    if ((it->clobbered & call) == call)
+      return;
+  }
+}
+
+static bool fits(int r, Interval *it) { return !((it->clobbered >> r) & 1); }
+
+static bool in_pool(int reg) {
+  int npool = sizeof(pool) / sizeof(*pool);
+  for (int i = 0; i < npool; i++)
+    if (pool[i] == reg)
+      return true;
+  return false;
+}
+
+// A variable that is a parameter is copied from its argument register at
+// the start of the function. It prefers to stay in that register, which
+// makes the copy go away, unless the register is one of those that are not
+// handed out.
+static int *find_hints(Code *code) {
+  int *hints = reallocate(ALLOC_CODE, NULL, sizeof(int) * (code->nvars + 1));
+  for (int i = 0; i < code->nvars; i++)
+    hints[i] = -1;
+
+  for (int i = 0; i < code->len; i++) {
+    Inst *inst = &code->insts[i];
+    if (inst->kind != I_MOV && inst->kind != I_MOVSX)
+      break;
+    int v = inst->dst.reg - VREG;
+    if (inst->dst.kind == OP_REG && v >= 0 && v < code->nvars &&
+        inst->src.kind == OP_REG && inst->src.reg < VREG &&
+        ((code->args >> inst->src.reg) & 1) && in_pool(inst->src.reg))
+      hints[v] = inst->src.reg;
+  }
+  return hints;
+}
+
+static int spill(Interval *it, int frame_size) {
+  it->reg = -1;
+  it->slot = frame_size + 8;
+  return it->slot;
+}
+
+static int linear_scan(Code *code, int frame_size, bool *used) {
+  int npool = sizeof(pool) / sizeof(*pool);
+  int nregs = code->nregs;
+
+  intervals = allocate(ALLOC_CODE, sizeof(Interval) * nregs);
+  for (int i = VREG; i < nregs; i++)
+    intervals[i].start = -1;
+
+  // Variables come first, and they must not take the registers that still
+  // hold the arguments until those are moved to their own registers.
+  int *order = reallocate(ALLOC_CODE, NULL, sizeof(int) * nregs);
+  int norder = 0;
+  for (int i = VREG; i < VREG + code->nvars; i++) {
+    intervals[i].start = 0;
+    intervals[i].end = code->len;
+    order[norder++] = i;
+  }
+  for (int i = 0; i < code->len; i++) {
+    add_uses(&code->insts[i].dst, i, order, &norder);
+    add_uses(&code->insts[i].src, i, order, &norder);
+  }
+  extend_over_loops(code);
+
+  if (clobbers_cap < code->len + 1) {
+    clobbers_cap = code->len + 1;
+    clobbers = reallocate(ALLOC_CODE, clobbers, sizeof(int) * clobbers_cap);
+    nclobbers = reallocate(ALLOC_CODE, nclobbers, sizeof(int) * clobbers_cap);
+  }
+  nclobbers[0] = 0;
+  for (int i = 0; i < code->len; i++) {
+    clobbers[i] = clobbered_regs(&code->insts[i]);
+    nclobbers[i + 1] = nclobbers[i] + (clobbers[i] != 0);
+  }
+
+  bool busy[VREG];
+  memset(busy, 0, sizeof(busy));
+  int *active = reallocate(ALLOC_CODE, NULL, sizeof(int) * npool);
+  int nactive = 0;
+  int *hints = find_hints(code);
+
+  for (int i = 0; i < norder; i++) {
+    int v = order[i];
+    Interval *it = &intervals[v];
+
+    // Intervals that end where this one starts may share its register.
+    int n = 0;
+    for (int j = 0; j < nactive; j++) {
+      if (intervals[active[j]].end <= it->start)
+        busy[intervals[active[j]].reg] = false;
+      else
+        active[n++] = active[j];
+    }
+    nactive = n;
+
+    find_clobbers(it);
+    int hint = -1;
+    if (v < VREG + code->nvars) {
+      hint = hints[v - VREG];
+      if (hint >= 0)
+        it->clobbered |= code->args & ~(1 << hint);
+      else
+        it->clobbered |= code->args;
+    }
+
+    it->reg = -1;
+    if (hint >= 0 && !busy[hint] && fits(hint, it))
+      it->reg = hint;
+    for (int p = 0; p < npool && it->reg < 0; p++) {
+      if (!busy[pool[p]] && fits(pool[p], it)) {
+        it->reg = pool[p];
+        break;
+      }
+    }
+
+    if (it->reg >= 0) {
+      busy[it->reg] = true;
+      used[it->reg] = true;
+      active[nactive++] = v;
+      continue;
+    }
+
+    // Out of registers. The interval that ends last goes to memory, which
+    // frees a register for the longest time. Variables are kept, since
+    // they are used throughout the function.
+    int victim = -1;
+    for (int j = 0; j < nactive; j++) {
+      Interval *a = &intervals[active[j]];
+      if (active[j] >= VREG + code->nvars && a->end > it->end &&
+          fits(a->reg, it) &&
+          (victim < 0 || a->end > intervals[active[victim]].end))
+        victim = j;
+    }
+
+    if (victim < 0) {
+      frame_size = spill(it, frame_size);
+      continue;
+    }
+    Interval *a = &intervals[active[victim]];
+    it->reg = a->reg;
+    frame_size = spill(a, frame_size);
+    active[victim] = v;
+  }
+
+  free(order);
+  free(active);
+  free(hints);
+  return frame_size;
+}
+
+static Inst *add_inst(Inst *inst) {
+  if (len == insts_cap) {
+    insts_cap *= 2;
+    insts = reallocate(ALLOC_CODE, insts, sizeof(Inst) * insts_cap);
+  }
+  Inst *dst = &insts[len++];
+  memcpy(dst, inst, sizeof(Inst));
+  return dst;
+}
+
+static void add_mov(Operand *dst, Operand *src) {
+  Inst inst;
+  inst.kind = I_MOV;
+  memcpy(&inst.dst, dst, sizeof(Operand));
+  memcpy(&inst.src, src, sizeof(Operand));
+  add_inst(&inst);
+}
+
+static void set_reg(Operand *op, int reg, int size) {
+  op->kind = OP_REG;
+  op->reg = reg;
+  op->size = size;
+  op->sym = NULL;
+}
+
+static void set_slot(Operand *op, int slot, int size) {
+  op->kind = OP_MEM;
+  op->reg = RBP;
+  op->scale = 0;
+  op->val = -slot;
+  op->size = size;
+  op->sym = NULL;
+}
+
+static bool operand_uses(Operand *op, int reg) {
+  if (op->kind == OP_MEM && op->scale && op->index == reg)
+    return true;
+  return (op->kind == OP_REG || op->kind == OP_MEM) && !op->sym &&
+         op->reg == reg;
+}
+
+static bool uses_reg(Inst *inst, int reg) {
+  return operand_uses(&inst->dst, reg) || operand_uses(&inst->src, reg);
+}
+
+// Returns rax or rdx, whichever the instruction does not use yet.
+static int scratch(Inst *inst) {
+  if (!uses_reg(inst, RAX))
+    return RAX;
+  assert(!uses_reg(inst, RDX));
+  return RDX;
+}
+
+// Replaces virtual registers by physical ones or by stack slots.
+static void map_base(Inst *inst, Operand *op) {
+  if (!is_virtual(op))
+    return;
+
+  Interval *it = &intervals[op->reg];
+  if (it->reg >= 0) {
+    op->reg = it->reg;
+    return;
+  }
+
+  if (op->kind == OP_REG) {
+    set_slot(op, it->slot, op->size);
+    return;
+  }
+
+  // A spilled address is loaded before the instruction uses it.
+  Operand reg;
+  Operand slot;
+  set_reg(&reg, scratch(inst), 8);
+  set_slot(&slot, it->slot, 8);
+  add_mov(&reg, &slot);
+  op->reg = reg.reg;
+}
+
+// A spilled index is loaded and added to the base, so that the address
+// only takes one scratch register.
+static void map_index(Inst *inst, Operand *op) {
+  Interval *it = &intervals[op->index];
+  if (it->reg >= 0) {
+    op->index = it->reg;
+    return;
+  }
+
+  Inst lea;
+  lea.kind = I_LEA;
+  set_reg(&lea.dst, scratch(inst), 8);
+  set_slot(&lea.src, it->slot, 8);
+  add_mov(&lea.dst, &lea.src);
+  memcpy(&lea.src, op, sizeof(Operand));
+  lea.src.index = lea.dst.reg;
+  lea.src.val = 0;
+  add_inst(&lea);
+  op->reg = lea.dst.reg;
+  op->scale = 0;
+}
+
+// An address whose base and index are both spilled is computed in one
+// scratch register, since the instruction may already use the other one.
+// This changes the flags, which is fine because the instructions that
+// read them, jcc and setcc, directly follow the ones that set them and
+// have no such addresses.
+static void map_both(Inst *inst, Operand *op) {
+  Inst calc;
+  set_reg(&calc.dst, scratch(inst), 8);
+  set_slot(&calc.src, intervals[op->index].slot, 8);
+  add_mov(&calc.dst, &calc.src);
+
+  if (op->scale > 1) {
+    calc.kind = I_SHL;
+    calc.src.kind = OP_IMM;
+    calc.src.val = op->scale == 2 ? 1 : op->scale == 4 ? 2 : 3;
+    add_inst(&calc);
+  }
+
+  calc.kind = I_ADD;
+  set_slot(&calc.src, intervals[op->reg].slot, 8);
+  add_inst(&calc);
+  op->reg = calc.dst.reg;
+  op->scale = 0;
+}
+
+static void map_operand(Inst *inst, Operand *op) {
+  if (is_virtual(op) && intervals[op->reg].reg < 0 &&
+      has_virtual_index(op) && intervals[op->index].reg < 0) {
+    map_both(inst, op);
+    return;
+  }
+  map_base(inst, op);
+  if (has_virtual_index(op))
+    map_index(inst, op);
+}
+
+// These instructions need a register as their destination.
+static bool needs_reg_dst(InstKind kind) {
+  return kind == I_LEA || kind == I_MOVSX || kind == I_MOVZX ||
+         kind == I_IMUL;
+}
+
+static bool is_spilled(Operand *op) {
+  if (has_virtual_index(op) && intervals[op->index].reg < 0)
+    return true;
+  return is_virtual(op) && intervals[op->reg].reg < 0;
+}
+
+static void rewrite(Inst *orig) {
+  // Most instructions only need their registers renamed.
+  if (!is_spilled(&orig->dst) && !is_spilled(&orig->src)) {
+    Inst *inst = add_inst(orig);
+    if (is_virtual(&inst->dst))
+      inst->dst.reg = intervals[inst->dst.reg].reg;
+    if (is_virtual(&inst->src))
+      inst->src.reg = intervals[inst->src.reg].reg;
+    if (has_virtual_index(&inst->dst))
+      inst->dst.index = intervals[inst->dst.index].reg;
+    if (has_virtual_index(&inst->src))
+      inst->src.index = intervals[inst->src.index].reg;
+
+    if (inst->kind == I_MOV && inst->dst.kind == OP_REG &&
+        inst->src.kind == OP_REG && inst->dst.reg == inst->src.reg &&
+        inst->dst.size == 8)
+      len--;
+    return;
+  }
+
+  Inst inst;
+  memcpy(&inst, orig, sizeof(Inst));
+  if (inst.dst.kind == OP_MEM)
+    map_operand(&inst, &inst.dst);
+  if (inst.src.kind == OP_MEM)
+    map_operand(&inst, &inst.src);
+  if (inst.dst.kind == OP_REG)
+    map_operand(&inst, &inst.dst);
+  if (inst.src.kind == OP_REG)
+    map_operand(&inst, &inst.src);
+
+  Operand *dst = &inst.dst;
+  Operand *src = &inst.src;
+
+  if (needs_reg_dst(inst.kind) && dst->kind == OP_MEM) {
+    // The source is read before the destination is written, so unless the
+    // destination is read too, it can take the scratch register that a
+    // spilled address was loaded into when both are taken.
+    int reg;
+    if (inst.kind != I_IMUL && uses_reg(&inst, RAX) && uses_reg(&inst, RDX))
+      reg = uses_reg(orig, RAX) ? RDX : RAX;
+    else
+      reg = scratch(&inst);
+
+    Operand mem;
+    memcpy(&mem, dst, sizeof(Operand));
+    set_reg(dst, reg, mem.size);
+    if (inst.kind == I_IMUL)
+      add_mov(dst, &mem);
+    add_inst(&inst);
+    add_mov(&mem, dst);
+    return;
+  }
+
+  // There are no instructions with two memory operands, and immediates
+  // wider than 32 bits can only be moved into registers.
+  if ((dst->kind == OP_MEM && src->kind == OP_MEM) ||
+      (dst->kind == OP_MEM && src->kind == OP_IMM &&
+       src->val != (int)src->val)) {
+    Operand reg;
+    set_reg(&reg, scratch(&inst), src->kind == OP_IMM ? 8 : src->size);
+    add_mov(&reg, src);
+    memcpy(src, &reg, sizeof(Operand));
+  }
+  add_inst(&inst);
+}
+
+// Assigns physical registers to the virtual registers of a function, whose
+// frame is frame_size bytes so far. Returns the frame size including the
+// slots of spilled values. The registers that were assigned are marked in
+// used.
+int alloc_regs(Code *code, int frame_size, bool *used) {
+  frame_size = linear_scan(code, frame_size, used);
+
+  if (!insts) {
+    insts_cap = 1024;
+    insts = reallocate(ALLOC_CODE, NULL, sizeof(Inst) * insts_cap);
+  }
+  len = 0;
+  for (int i = 0; i < code->len; i++)
+    rewrite(&code->insts[i]);
+
+  Inst *tmp = code->insts;
+  int tmp_cap = code->cap;
+  code->insts = insts;
+  code->cap = insts_cap;
+  code->len = len;
+  insts = tmp;
+  insts_cap = tmp_cap;
+
+  free(intervals);
+  return frame_size;
+}
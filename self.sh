@@ -8,6 +8,17 @@ expand() {
     file=$1
     cat <<EOF > $TMP/$1
 typedef struct FILE FILE;
+typedef long size_t;
+struct timespec {
+  long tv_sec;
+  long tv_nsec;
+};
+struct rusage {
+  long ru_utime[2];
+  long ru_stime[2];
+  long ru_maxrss;
+  long ru_rest[13];
+};
 extern FILE *stdout;
 extern FILE *stderr;
 
@@ -29,6 +40,43 @@ char *strndup(char *p, long n);
 int isspace(int c);
 char *strstr(char *haystack, char *needle);
 long strtol(char *nptr, char **endptr, int base);
+int memcmp(char *s1, char *s2, long n);
+int fprintf(FILE *fp, char *fmt, ...);
+int fputs(char *s, FILE *fp);
+long fwrite(void *ptr, long size, long nmemb, FILE *stream);
+int fclose(FILE *fp);
+int fseek(FILE *fp, long offset, int whence);
+long ftell(FILE *fp);
+FILE *open_memstream(char **ptr, size_t *sizeloc);
+int rename(char *oldpath, char *newpath);
+int mkdir(char *pathname, int mode);
+int getpid(void);
+int clock_gettime(int clockid, struct timespec *tp);
+int getrusage(int who, struct rusage *usage);
+void *realloc(void *ptr, long size);
+void free(void *ptr);
+void *memset(void *s, int c, long n);
+int open(char *pathname, int flags, ...);
+int close(int fd);
+long write(int fd, void *buf, long count);
+int ftruncate(int fd, long length);
+void *mmap(void *addr, long length, int prot, int flags, int fd, long offset);
+int munmap(void *addr, long length);
+void *mremap(void *old_address, long old_size, long new_size, int flags);
+int mprotect(void *addr, long len, int prot);
+void *dlopen(char *filename, int flags);
+void *dlsym(void *handle, char *symbol);
+char *dlerror(void);
+char *strchr(char *s, int c);
+void *bsearch(void *key, void *base, long nmemb, long size, void *compar);
+extern char **environ;
+int pipe(int *pipefd);
+int fork(void);
+int waitpid(int pid, int *wstatus, int options);
+long read(int fd, void *buf, long count);
+void _exit(int status);
+void exit(int status);
+void *memmove(void *dest, void *src, long n);
 
 typedef struct {
   int gp_offset;
@@ -39,10 +87,6 @@ typedef struct {
 
 typedef __va_elem va_list[1];
 
-static void va_start(__va_elem *ap) {
-  __builtin_va_start(ap);
-}
-
 static void va_end(__va_elem *ap) {}
 EOF
 
@@ -52,10 +96,20 @@ EOF
     sed -i 's/\berrno\b/*__errno_location()/g' $TMP/$1
     sed -i 's/\btrue\b/1/g; s/\bfalse\b/0/g;' $TMP/$1
     sed -i 's/\bNULL\b/0/g' $TMP/$1
+    sed -i 's/\bva_start(\(\w*\), \w*)/__builtin_va_start(\1)/g' $TMP/$1
     sed -i 's/INT_MAX/2147483647/g' $TMP/$1
+    sed -i 's/\bSEEK_SET\b/0/g; s/\bSEEK_END\b/2/g' $TMP/$1
+    sed -i 's/\bCLOCK_MONOTONIC\b/1/g; s/\bCLOCK_PROCESS_CPUTIME_ID\b/2/g' $TMP/$1
+    sed -i 's/\bRUSAGE_SELF\b/0/g' $TMP/$1
+    sed -i 's/\bO_RDWR\b/2/g; s/\bO_CREAT\b/64/g; s/\bO_TRUNC\b/512/g' $TMP/$1
+    sed -i 's/\bPROT_READ\b/1/g; s/\bPROT_WRITE\b/2/g; s/\bMAP_SHARED\b/1/g' $TMP/$1
+    sed -i 's/\bMREMAP_MAYMOVE\b/1/g' $TMP/$1
+    sed -i 's/\bMAP_FAILED\b/(void *)-1/g' $TMP/$1
+    sed -i 's/\bPROT_EXEC\b/4/g; s/\bMAP_PRIVATE\b/2/g; s/\bMAP_ANONYMOUS\b/32/g' $TMP/$1
+    sed -i 's/\bMAP_FIXED_NOREPLACE\b/1048576/g' $TMP/$1
+    sed -i 's/\bRTLD_NOW\b/2/g; s/\bRTLD_GLOBAL\b/256/g' $TMP/$1
 
-    ./ccc $TMP/$1 > $TMP/${1%.c}.s
-    gcc -c -o $TMP/${1%.c}.o $TMP/${1%.c}.s
+    ./ccc -c -o $TMP/${1%.c}.o $TMP/$1
 }
 
 cp *.c $TMP
@@ -68,5 +122,21 @@ expand type.c
 expand parse.c
 expand codegen.c
 expand tokenize.c
+expand cache.c
+expand alloc.c
+expand sink.c
+expand asm.c
+expand elf.c
+expand encode.c
+expand jit.c
+expand worker.c
+expand regalloc.c
+expand promote.c
+expand inline.c
+expand cfg.c
+expand opt.c
+expand jump.c
+expand peephole.c
+expand licm.c
 
 gcc -static -o ccc-gen2 $TMP/*.o
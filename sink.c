@@ -0,0 +1,157 @@
+#include "chibi.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+// Sinks flushing to a file descriptor hand it this much at a time.
+static long fd_sink_size = 1024 * 1024;
+
+// Mapped files start out this large. The file is sparse until written to,
+// and growing it costs more than mapping address space that goes unused.
+static long file_sink_size = 64 * 1024 * 1024;
+
+static Sink *new_sink(int fd, long cap) {
+  Sink *s = calloc(1, sizeof(Sink));
+  s->fd = fd;
+  s->cap = cap;
+  s->buf = malloc(cap);
+  return s;
+}
+
+Sink *new_fd_sink(int fd) { return new_sink(fd, fd_sink_size); }
+
+Sink *new_mem_sink(void) { return new_sink(-1, 4096); }
+
+// The output file is mapped into memory and grown as needed, so emitting
+// into it is a plain memory copy and no write() is ever issued.
+Sink *new_file_sink(char *path) {
+  int fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0)
+    error("cannot open %s: %s", path, strerror(errno));
+
+  Sink *s = calloc(1, sizeof(Sink));
+  s->fd = fd;
+  s->mapped = true;
+  return s;
+}
+
+static void write_all(int fd, char *p, long len) {
+  while (len > 0) {
+    long n = write(fd, p, len);
+    if (n < 0)
+      error("write failed: %s", strerror(errno));
+    p += n;
+    len -= n;
+  }
+}
+
+static void remap(Sink *s, long cap) {
+  if (ftruncate(s->fd, cap))
+    error("ftruncate failed: %s", strerror(errno));
+
+  if (s->buf)
+    s->buf = mremap(s->buf, s->cap, cap, MREMAP_MAYMOVE);
+  else
+    s->buf = mmap(NULL, cap, PROT_READ | PROT_WRITE, MAP_SHARED, s->fd, 0);
+  if (s->buf == MAP_FAILED)
+    error("mmap failed: %s", strerror(errno));
+  s->cap = cap;
+}
+
+// Makes room for at least n more bytes.
+void sink_reserve(Sink *s, long n) {
+  if (s->len + n <= s->cap)
+    return;
+
+  if (s->fd >= 0 && !s->mapped) {
+    write_all(s->fd, s->buf, s->len);
+    s->len = 0;
+    if (n <= s->cap)
+      return;
+  }
+
+  long cap = s->cap ? s->cap : file_sink_size;
+  while (cap < s->len + n)
+    cap *= 2;
+
+  if (s->mapped) {
+    remap(s, cap);
+    return;
+  }
+  s->buf = realloc(s->buf, cap);
+  s->cap = cap;
+}
+
+void sink_write(Sink *s, char *p, long len) {
+  sink_reserve(s, len);
+  memcpy(s->buf + s->len, p, len);
+  s->len += len;
+}
+
+void sink_str(Sink *s, char *str) { sink_write(s, str, strlen(str)); }
+
+void sink_char(Sink *s, int c) {
+  if (s->len == s->cap)
+    sink_reserve(s, 1);
+  s->buf[s->len++] = c;
+}
+
+// Writes val in decimal to p, which must have room for 20 characters, and
+// returns the position after it.
+char *write_int(char *p, long val) {
+  char buf[24];
+  int i = 24;
+  long v = val < 0 ? -val : val;
+
+  // Digits are produced from the lowest one. The most negative long has
+  // no positive counterpart, but its digits come out right anyway because
+  // the quotient and remainder of a negative number are negated too.
+  do {
+    long q = v / 10;
+    long d = v - q * 10;
+    buf[--i] = '0' + (d < 0 ? -d : d);
+    v = q < 0 ? -q : q;
+  } while (v);
+
+  if (val < 0)
+    *p++ = '-';
+  memcpy(p, buf + i, 24 - i);
+  return p + 24 - i;
+}
+
+void sink_int(Sink *s, long val) {
+  sink_reserve(s, 24);
+  s->len = write_int(s->buf + s->len, val) - s->buf;
+}
+
+// Appends the low size bytes of val in little-endian order.
+void sink_le(Sink *s, long val, int size) {
+  sink_reserve(s, size);
+  for (int i = 0; i < size; i++) {
+    s->buf[s->len++] = val;
+    val >>= 8;
+  }
+}
+
+// Pads with zero bytes up to a multiple of align.
+void sink_align(Sink *s, int align) {
+  while (s->len - s->len / align * align)
+    sink_char(s, 0);
+}
+
+void sink_close(Sink *s) {
+  if (s->fd < 0)
+    return;
+
+  if (!s->mapped) {
+    write_all(s->fd, s->buf, s->len);
+    s->len = 0;
+    return;
+  }
+
+  if (s->buf)
+    munmap(s->buf, s->cap);
+  if (ftruncate(s->fd, s->len))
+    error("ftruncate failed: %s", strerror(errno));
+  close(s->fd);
+}
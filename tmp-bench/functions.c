@@ -0,0 +1,28005 @@
+int printf();
+
+int f0(int a, int b) {
+  int c = a * 74 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  return n;
+}
+
+int f1(int a, int b) {
+  int c = a * 70 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f0(a - 1, n);
+  return n;
+}
+
+int f2(int a, int b) {
+  int c = a * 2 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1(a - 1, n);
+  return n;
+}
+
+int f3(int a, int b) {
+  int c = a * 2 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f2(a - 1, n);
+  return n;
+}
+
+int f4(int a, int b) {
+  int c = a * 12 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f0(a - 1, n);
+  return n;
+}
+
+int f5(int a, int b) {
+  int c = a * 65 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1(a - 1, n);
+  return n;
+}
+
+int f6(int a, int b) {
+  int c = a * 10 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f0(a - 1, n);
+  return n;
+}
+
+int f7(int a, int b) {
+  int c = a * 72 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 18)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f0(a - 1, n);
+  return n;
+}
+
+int f8(int a, int b) {
+  int c = a * 38 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 25)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f6(a - 1, n);
+  return n;
+}
+
+int f9(int a, int b) {
+  int c = a * 82 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 8)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f4(a - 1, n);
+  return n;
+}
+
+int f10(int a, int b) {
+  int c = a * 89 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f0(a - 1, n);
+  return n;
+}
+
+int f11(int a, int b) {
+  int c = a * 80 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 34)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f3(a - 1, n);
+  return n;
+}
+
+int f12(int a, int b) {
+  int c = a * 1 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f6(a - 1, n);
+  return n;
+}
+
+int f13(int a, int b) {
+  int c = a * 44 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f11(a - 1, n);
+  return n;
+}
+
+int f14(int a, int b) {
+  int c = a * 0 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f9(a - 1, n);
+  return n;
+}
+
+int f15(int a, int b) {
+  int c = a * 30 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f3(a - 1, n);
+  return n;
+}
+
+int f16(int a, int b) {
+  int c = a * 41 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f3(a - 1, n);
+  return n;
+}
+
+int f17(int a, int b) {
+  int c = a * 56 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f12(a - 1, n);
+  return n;
+}
+
+int f18(int a, int b) {
+  int c = a * 41 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 8)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f11(a - 1, n);
+  return n;
+}
+
+int f19(int a, int b) {
+  int c = a * 88 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f2(a - 1, n);
+  return n;
+}
+
+int f20(int a, int b) {
+  int c = a * 25 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f19(a - 1, n);
+  return n;
+}
+
+int f21(int a, int b) {
+  int c = a * 78 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f5(a - 1, n);
+  return n;
+}
+
+int f22(int a, int b) {
+  int c = a * 31 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 42)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f4(a - 1, n);
+  return n;
+}
+
+int f23(int a, int b) {
+  int c = a * 8 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 34)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f11(a - 1, n);
+  return n;
+}
+
+int f24(int a, int b) {
+  int c = a * 38 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f3(a - 1, n);
+  return n;
+}
+
+int f25(int a, int b) {
+  int c = a * 40 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f15(a - 1, n);
+  return n;
+}
+
+int f26(int a, int b) {
+  int c = a * 86 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f18(a - 1, n);
+  return n;
+}
+
+int f27(int a, int b) {
+  int c = a * 99 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f22(a - 1, n);
+  return n;
+}
+
+int f28(int a, int b) {
+  int c = a * 48 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1(a - 1, n);
+  return n;
+}
+
+int f29(int a, int b) {
+  int c = a * 69 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 34)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f27(a - 1, n);
+  return n;
+}
+
+int f30(int a, int b) {
+  int c = a * 0 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1(a - 1, n);
+  return n;
+}
+
+int f31(int a, int b) {
+  int c = a * 97 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 19)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f16(a - 1, n);
+  return n;
+}
+
+int f32(int a, int b) {
+  int c = a * 28 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 4)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f4(a - 1, n);
+  return n;
+}
+
+int f33(int a, int b) {
+  int c = a * 81 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f2(a - 1, n);
+  return n;
+}
+
+int f34(int a, int b) {
+  int c = a * 50 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f3(a - 1, n);
+  return n;
+}
+
+int f35(int a, int b) {
+  int c = a * 19 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 18)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f17(a - 1, n);
+  return n;
+}
+
+int f36(int a, int b) {
+  int c = a * 53 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f20(a - 1, n);
+  return n;
+}
+
+int f37(int a, int b) {
+  int c = a * 86 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1(a - 1, n);
+  return n;
+}
+
+int f38(int a, int b) {
+  int c = a * 25 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 25)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f30(a - 1, n);
+  return n;
+}
+
+int f39(int a, int b) {
+  int c = a * 65 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f24(a - 1, n);
+  return n;
+}
+
+int f40(int a, int b) {
+  int c = a * 27 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 3)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f18(a - 1, n);
+  return n;
+}
+
+int f41(int a, int b) {
+  int c = a * 98 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f16(a - 1, n);
+  return n;
+}
+
+int f42(int a, int b) {
+  int c = a * 79 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f12(a - 1, n);
+  return n;
+}
+
+int f43(int a, int b) {
+  int c = a * 97 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f26(a - 1, n);
+  return n;
+}
+
+int f44(int a, int b) {
+  int c = a * 82 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f35(a - 1, n);
+  return n;
+}
+
+int f45(int a, int b) {
+  int c = a * 3 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f4(a - 1, n);
+  return n;
+}
+
+int f46(int a, int b) {
+  int c = a * 49 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f42(a - 1, n);
+  return n;
+}
+
+int f47(int a, int b) {
+  int c = a * 91 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f43(a - 1, n);
+  return n;
+}
+
+int f48(int a, int b) {
+  int c = a * 1 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f16(a - 1, n);
+  return n;
+}
+
+int f49(int a, int b) {
+  int c = a * 81 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f29(a - 1, n);
+  return n;
+}
+
+int f50(int a, int b) {
+  int c = a * 73 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f6(a - 1, n);
+  return n;
+}
+
+int f51(int a, int b) {
+  int c = a * 98 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f30(a - 1, n);
+  return n;
+}
+
+int f52(int a, int b) {
+  int c = a * 93 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f4(a - 1, n);
+  return n;
+}
+
+int f53(int a, int b) {
+  int c = a * 37 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f27(a - 1, n);
+  return n;
+}
+
+int f54(int a, int b) {
+  int c = a * 61 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 19)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f12(a - 1, n);
+  return n;
+}
+
+int f55(int a, int b) {
+  int c = a * 58 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f22(a - 1, n);
+  return n;
+}
+
+int f56(int a, int b) {
+  int c = a * 48 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f33(a - 1, n);
+  return n;
+}
+
+int f57(int a, int b) {
+  int c = a * 56 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 3)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f35(a - 1, n);
+  return n;
+}
+
+int f58(int a, int b) {
+  int c = a * 86 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f20(a - 1, n);
+  return n;
+}
+
+int f59(int a, int b) {
+  int c = a * 48 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f2(a - 1, n);
+  return n;
+}
+
+int f60(int a, int b) {
+  int c = a * 49 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 24)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f17(a - 1, n);
+  return n;
+}
+
+int f61(int a, int b) {
+  int c = a * 83 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f38(a - 1, n);
+  return n;
+}
+
+int f62(int a, int b) {
+  int c = a * 43 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f41(a - 1, n);
+  return n;
+}
+
+int f63(int a, int b) {
+  int c = a * 12 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 27)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f12(a - 1, n);
+  return n;
+}
+
+int f64(int a, int b) {
+  int c = a * 69 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f59(a - 1, n);
+  return n;
+}
+
+int f65(int a, int b) {
+  int c = a * 74 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f25(a - 1, n);
+  return n;
+}
+
+int f66(int a, int b) {
+  int c = a * 72 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 27)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f53(a - 1, n);
+  return n;
+}
+
+int f67(int a, int b) {
+  int c = a * 76 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f15(a - 1, n);
+  return n;
+}
+
+int f68(int a, int b) {
+  int c = a * 86 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f58(a - 1, n);
+  return n;
+}
+
+int f69(int a, int b) {
+  int c = a * 2 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f50(a - 1, n);
+  return n;
+}
+
+int f70(int a, int b) {
+  int c = a * 92 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f8(a - 1, n);
+  return n;
+}
+
+int f71(int a, int b) {
+  int c = a * 71 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 4)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f52(a - 1, n);
+  return n;
+}
+
+int f72(int a, int b) {
+  int c = a * 59 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f68(a - 1, n);
+  return n;
+}
+
+int f73(int a, int b) {
+  int c = a * 85 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f47(a - 1, n);
+  return n;
+}
+
+int f74(int a, int b) {
+  int c = a * 70 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f52(a - 1, n);
+  return n;
+}
+
+int f75(int a, int b) {
+  int c = a * 73 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f45(a - 1, n);
+  return n;
+}
+
+int f76(int a, int b) {
+  int c = a * 32 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f52(a - 1, n);
+  return n;
+}
+
+int f77(int a, int b) {
+  int c = a * 48 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 42)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f11(a - 1, n);
+  return n;
+}
+
+int f78(int a, int b) {
+  int c = a * 65 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 3)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f57(a - 1, n);
+  return n;
+}
+
+int f79(int a, int b) {
+  int c = a * 33 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f59(a - 1, n);
+  return n;
+}
+
+int f80(int a, int b) {
+  int c = a * 59 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 43)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f63(a - 1, n);
+  return n;
+}
+
+int f81(int a, int b) {
+  int c = a * 87 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f33(a - 1, n);
+  return n;
+}
+
+int f82(int a, int b) {
+  int c = a * 84 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f61(a - 1, n);
+  return n;
+}
+
+int f83(int a, int b) {
+  int c = a * 80 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f44(a - 1, n);
+  return n;
+}
+
+int f84(int a, int b) {
+  int c = a * 36 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f36(a - 1, n);
+  return n;
+}
+
+int f85(int a, int b) {
+  int c = a * 58 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f48(a - 1, n);
+  return n;
+}
+
+int f86(int a, int b) {
+  int c = a * 11 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f25(a - 1, n);
+  return n;
+}
+
+int f87(int a, int b) {
+  int c = a * 78 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f39(a - 1, n);
+  return n;
+}
+
+int f88(int a, int b) {
+  int c = a * 59 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f43(a - 1, n);
+  return n;
+}
+
+int f89(int a, int b) {
+  int c = a * 39 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f9(a - 1, n);
+  return n;
+}
+
+int f90(int a, int b) {
+  int c = a * 50 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 10)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f21(a - 1, n);
+  return n;
+}
+
+int f91(int a, int b) {
+  int c = a * 86 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f5(a - 1, n);
+  return n;
+}
+
+int f92(int a, int b) {
+  int c = a * 65 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f26(a - 1, n);
+  return n;
+}
+
+int f93(int a, int b) {
+  int c = a * 67 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f18(a - 1, n);
+  return n;
+}
+
+int f94(int a, int b) {
+  int c = a * 80 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f65(a - 1, n);
+  return n;
+}
+
+int f95(int a, int b) {
+  int c = a * 63 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 3)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f9(a - 1, n);
+  return n;
+}
+
+int f96(int a, int b) {
+  int c = a * 19 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f75(a - 1, n);
+  return n;
+}
+
+int f97(int a, int b) {
+  int c = a * 46 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f15(a - 1, n);
+  return n;
+}
+
+int f98(int a, int b) {
+  int c = a * 56 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f14(a - 1, n);
+  return n;
+}
+
+int f99(int a, int b) {
+  int c = a * 58 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f3(a - 1, n);
+  return n;
+}
+
+int f100(int a, int b) {
+  int c = a * 12 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f84(a - 1, n);
+  return n;
+}
+
+int f101(int a, int b) {
+  int c = a * 76 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f26(a - 1, n);
+  return n;
+}
+
+int f102(int a, int b) {
+  int c = a * 51 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f49(a - 1, n);
+  return n;
+}
+
+int f103(int a, int b) {
+  int c = a * 35 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 43)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f11(a - 1, n);
+  return n;
+}
+
+int f104(int a, int b) {
+  int c = a * 16 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f90(a - 1, n);
+  return n;
+}
+
+int f105(int a, int b) {
+  int c = a * 22 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f36(a - 1, n);
+  return n;
+}
+
+int f106(int a, int b) {
+  int c = a * 51 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f63(a - 1, n);
+  return n;
+}
+
+int f107(int a, int b) {
+  int c = a * 63 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f92(a - 1, n);
+  return n;
+}
+
+int f108(int a, int b) {
+  int c = a * 45 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f78(a - 1, n);
+  return n;
+}
+
+int f109(int a, int b) {
+  int c = a * 35 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f80(a - 1, n);
+  return n;
+}
+
+int f110(int a, int b) {
+  int c = a * 8 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f53(a - 1, n);
+  return n;
+}
+
+int f111(int a, int b) {
+  int c = a * 61 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f99(a - 1, n);
+  return n;
+}
+
+int f112(int a, int b) {
+  int c = a * 56 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f33(a - 1, n);
+  return n;
+}
+
+int f113(int a, int b) {
+  int c = a * 72 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 42)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f19(a - 1, n);
+  return n;
+}
+
+int f114(int a, int b) {
+  int c = a * 46 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f90(a - 1, n);
+  return n;
+}
+
+int f115(int a, int b) {
+  int c = a * 32 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 27)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f84(a - 1, n);
+  return n;
+}
+
+int f116(int a, int b) {
+  int c = a * 65 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f83(a - 1, n);
+  return n;
+}
+
+int f117(int a, int b) {
+  int c = a * 33 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f113(a - 1, n);
+  return n;
+}
+
+int f118(int a, int b) {
+  int c = a * 17 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f46(a - 1, n);
+  return n;
+}
+
+int f119(int a, int b) {
+  int c = a * 0 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f29(a - 1, n);
+  return n;
+}
+
+int f120(int a, int b) {
+  int c = a * 62 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f66(a - 1, n);
+  return n;
+}
+
+int f121(int a, int b) {
+  int c = a * 36 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1(a - 1, n);
+  return n;
+}
+
+int f122(int a, int b) {
+  int c = a * 61 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f77(a - 1, n);
+  return n;
+}
+
+int f123(int a, int b) {
+  int c = a * 98 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f104(a - 1, n);
+  return n;
+}
+
+int f124(int a, int b) {
+  int c = a * 17 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 42)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f31(a - 1, n);
+  return n;
+}
+
+int f125(int a, int b) {
+  int c = a * 29 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f43(a - 1, n);
+  return n;
+}
+
+int f126(int a, int b) {
+  int c = a * 53 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 25)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f56(a - 1, n);
+  return n;
+}
+
+int f127(int a, int b) {
+  int c = a * 27 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f90(a - 1, n);
+  return n;
+}
+
+int f128(int a, int b) {
+  int c = a * 22 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 10)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f88(a - 1, n);
+  return n;
+}
+
+int f129(int a, int b) {
+  int c = a * 23 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f43(a - 1, n);
+  return n;
+}
+
+int f130(int a, int b) {
+  int c = a * 33 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f47(a - 1, n);
+  return n;
+}
+
+int f131(int a, int b) {
+  int c = a * 63 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f47(a - 1, n);
+  return n;
+}
+
+int f132(int a, int b) {
+  int c = a * 72 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f96(a - 1, n);
+  return n;
+}
+
+int f133(int a, int b) {
+  int c = a * 93 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f97(a - 1, n);
+  return n;
+}
+
+int f134(int a, int b) {
+  int c = a * 59 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 43)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f95(a - 1, n);
+  return n;
+}
+
+int f135(int a, int b) {
+  int c = a * 59 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f117(a - 1, n);
+  return n;
+}
+
+int f136(int a, int b) {
+  int c = a * 86 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f49(a - 1, n);
+  return n;
+}
+
+int f137(int a, int b) {
+  int c = a * 21 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f62(a - 1, n);
+  return n;
+}
+
+int f138(int a, int b) {
+  int c = a * 3 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f68(a - 1, n);
+  return n;
+}
+
+int f139(int a, int b) {
+  int c = a * 41 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 8)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f113(a - 1, n);
+  return n;
+}
+
+int f140(int a, int b) {
+  int c = a * 43 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 24)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f0(a - 1, n);
+  return n;
+}
+
+int f141(int a, int b) {
+  int c = a * 89 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f43(a - 1, n);
+  return n;
+}
+
+int f142(int a, int b) {
+  int c = a * 68 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f27(a - 1, n);
+  return n;
+}
+
+int f143(int a, int b) {
+  int c = a * 75 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f33(a - 1, n);
+  return n;
+}
+
+int f144(int a, int b) {
+  int c = a * 16 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f93(a - 1, n);
+  return n;
+}
+
+int f145(int a, int b) {
+  int c = a * 79 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f54(a - 1, n);
+  return n;
+}
+
+int f146(int a, int b) {
+  int c = a * 34 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f85(a - 1, n);
+  return n;
+}
+
+int f147(int a, int b) {
+  int c = a * 34 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f64(a - 1, n);
+  return n;
+}
+
+int f148(int a, int b) {
+  int c = a * 64 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1(a - 1, n);
+  return n;
+}
+
+int f149(int a, int b) {
+  int c = a * 64 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 8)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f41(a - 1, n);
+  return n;
+}
+
+int f150(int a, int b) {
+  int c = a * 66 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f15(a - 1, n);
+  return n;
+}
+
+int f151(int a, int b) {
+  int c = a * 60 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f126(a - 1, n);
+  return n;
+}
+
+int f152(int a, int b) {
+  int c = a * 35 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f105(a - 1, n);
+  return n;
+}
+
+int f153(int a, int b) {
+  int c = a * 13 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f46(a - 1, n);
+  return n;
+}
+
+int f154(int a, int b) {
+  int c = a * 27 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f115(a - 1, n);
+  return n;
+}
+
+int f155(int a, int b) {
+  int c = a * 9 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f22(a - 1, n);
+  return n;
+}
+
+int f156(int a, int b) {
+  int c = a * 88 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f99(a - 1, n);
+  return n;
+}
+
+int f157(int a, int b) {
+  int c = a * 16 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f32(a - 1, n);
+  return n;
+}
+
+int f158(int a, int b) {
+  int c = a * 45 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f92(a - 1, n);
+  return n;
+}
+
+int f159(int a, int b) {
+  int c = a * 9 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 27)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f126(a - 1, n);
+  return n;
+}
+
+int f160(int a, int b) {
+  int c = a * 24 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f79(a - 1, n);
+  return n;
+}
+
+int f161(int a, int b) {
+  int c = a * 87 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f139(a - 1, n);
+  return n;
+}
+
+int f162(int a, int b) {
+  int c = a * 32 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f5(a - 1, n);
+  return n;
+}
+
+int f163(int a, int b) {
+  int c = a * 44 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f135(a - 1, n);
+  return n;
+}
+
+int f164(int a, int b) {
+  int c = a * 51 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f79(a - 1, n);
+  return n;
+}
+
+int f165(int a, int b) {
+  int c = a * 59 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f117(a - 1, n);
+  return n;
+}
+
+int f166(int a, int b) {
+  int c = a * 84 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f157(a - 1, n);
+  return n;
+}
+
+int f167(int a, int b) {
+  int c = a * 43 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 24)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f113(a - 1, n);
+  return n;
+}
+
+int f168(int a, int b) {
+  int c = a * 22 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f9(a - 1, n);
+  return n;
+}
+
+int f169(int a, int b) {
+  int c = a * 79 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f62(a - 1, n);
+  return n;
+}
+
+int f170(int a, int b) {
+  int c = a * 0 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 4)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f73(a - 1, n);
+  return n;
+}
+
+int f171(int a, int b) {
+  int c = a * 92 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f24(a - 1, n);
+  return n;
+}
+
+int f172(int a, int b) {
+  int c = a * 97 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f144(a - 1, n);
+  return n;
+}
+
+int f173(int a, int b) {
+  int c = a * 13 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f142(a - 1, n);
+  return n;
+}
+
+int f174(int a, int b) {
+  int c = a * 72 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f7(a - 1, n);
+  return n;
+}
+
+int f175(int a, int b) {
+  int c = a * 38 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 19)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f19(a - 1, n);
+  return n;
+}
+
+int f176(int a, int b) {
+  int c = a * 49 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f85(a - 1, n);
+  return n;
+}
+
+int f177(int a, int b) {
+  int c = a * 99 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f153(a - 1, n);
+  return n;
+}
+
+int f178(int a, int b) {
+  int c = a * 44 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f16(a - 1, n);
+  return n;
+}
+
+int f179(int a, int b) {
+  int c = a * 98 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f119(a - 1, n);
+  return n;
+}
+
+int f180(int a, int b) {
+  int c = a * 66 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f124(a - 1, n);
+  return n;
+}
+
+int f181(int a, int b) {
+  int c = a * 18 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 3)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f43(a - 1, n);
+  return n;
+}
+
+int f182(int a, int b) {
+  int c = a * 97 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f77(a - 1, n);
+  return n;
+}
+
+int f183(int a, int b) {
+  int c = a * 37 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 3)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f65(a - 1, n);
+  return n;
+}
+
+int f184(int a, int b) {
+  int c = a * 84 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f165(a - 1, n);
+  return n;
+}
+
+int f185(int a, int b) {
+  int c = a * 42 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f177(a - 1, n);
+  return n;
+}
+
+int f186(int a, int b) {
+  int c = a * 11 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f53(a - 1, n);
+  return n;
+}
+
+int f187(int a, int b) {
+  int c = a * 56 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f23(a - 1, n);
+  return n;
+}
+
+int f188(int a, int b) {
+  int c = a * 82 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f121(a - 1, n);
+  return n;
+}
+
+int f189(int a, int b) {
+  int c = a * 39 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1(a - 1, n);
+  return n;
+}
+
+int f190(int a, int b) {
+  int c = a * 15 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f75(a - 1, n);
+  return n;
+}
+
+int f191(int a, int b) {
+  int c = a * 42 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f71(a - 1, n);
+  return n;
+}
+
+int f192(int a, int b) {
+  int c = a * 87 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f169(a - 1, n);
+  return n;
+}
+
+int f193(int a, int b) {
+  int c = a * 74 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 25)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f142(a - 1, n);
+  return n;
+}
+
+int f194(int a, int b) {
+  int c = a * 72 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f95(a - 1, n);
+  return n;
+}
+
+int f195(int a, int b) {
+  int c = a * 91 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f30(a - 1, n);
+  return n;
+}
+
+int f196(int a, int b) {
+  int c = a * 77 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f86(a - 1, n);
+  return n;
+}
+
+int f197(int a, int b) {
+  int c = a * 6 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f140(a - 1, n);
+  return n;
+}
+
+int f198(int a, int b) {
+  int c = a * 22 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f71(a - 1, n);
+  return n;
+}
+
+int f199(int a, int b) {
+  int c = a * 52 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f21(a - 1, n);
+  return n;
+}
+
+int f200(int a, int b) {
+  int c = a * 46 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f101(a - 1, n);
+  return n;
+}
+
+int f201(int a, int b) {
+  int c = a * 90 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f61(a - 1, n);
+  return n;
+}
+
+int f202(int a, int b) {
+  int c = a * 17 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f32(a - 1, n);
+  return n;
+}
+
+int f203(int a, int b) {
+  int c = a * 99 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f68(a - 1, n);
+  return n;
+}
+
+int f204(int a, int b) {
+  int c = a * 34 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f176(a - 1, n);
+  return n;
+}
+
+int f205(int a, int b) {
+  int c = a * 73 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f8(a - 1, n);
+  return n;
+}
+
+int f206(int a, int b) {
+  int c = a * 99 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f25(a - 1, n);
+  return n;
+}
+
+int f207(int a, int b) {
+  int c = a * 40 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f8(a - 1, n);
+  return n;
+}
+
+int f208(int a, int b) {
+  int c = a * 67 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 24)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f120(a - 1, n);
+  return n;
+}
+
+int f209(int a, int b) {
+  int c = a * 88 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f200(a - 1, n);
+  return n;
+}
+
+int f210(int a, int b) {
+  int c = a * 80 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f109(a - 1, n);
+  return n;
+}
+
+int f211(int a, int b) {
+  int c = a * 69 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f123(a - 1, n);
+  return n;
+}
+
+int f212(int a, int b) {
+  int c = a * 93 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 25)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f146(a - 1, n);
+  return n;
+}
+
+int f213(int a, int b) {
+  int c = a * 33 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f142(a - 1, n);
+  return n;
+}
+
+int f214(int a, int b) {
+  int c = a * 34 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f87(a - 1, n);
+  return n;
+}
+
+int f215(int a, int b) {
+  int c = a * 26 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f41(a - 1, n);
+  return n;
+}
+
+int f216(int a, int b) {
+  int c = a * 31 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f110(a - 1, n);
+  return n;
+}
+
+int f217(int a, int b) {
+  int c = a * 96 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f66(a - 1, n);
+  return n;
+}
+
+int f218(int a, int b) {
+  int c = a * 4 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f170(a - 1, n);
+  return n;
+}
+
+int f219(int a, int b) {
+  int c = a * 96 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f197(a - 1, n);
+  return n;
+}
+
+int f220(int a, int b) {
+  int c = a * 69 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f201(a - 1, n);
+  return n;
+}
+
+int f221(int a, int b) {
+  int c = a * 21 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f181(a - 1, n);
+  return n;
+}
+
+int f222(int a, int b) {
+  int c = a * 60 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f52(a - 1, n);
+  return n;
+}
+
+int f223(int a, int b) {
+  int c = a * 53 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f133(a - 1, n);
+  return n;
+}
+
+int f224(int a, int b) {
+  int c = a * 66 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f102(a - 1, n);
+  return n;
+}
+
+int f225(int a, int b) {
+  int c = a * 58 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f105(a - 1, n);
+  return n;
+}
+
+int f226(int a, int b) {
+  int c = a * 82 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f27(a - 1, n);
+  return n;
+}
+
+int f227(int a, int b) {
+  int c = a * 22 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f53(a - 1, n);
+  return n;
+}
+
+int f228(int a, int b) {
+  int c = a * 79 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f146(a - 1, n);
+  return n;
+}
+
+int f229(int a, int b) {
+  int c = a * 14 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f182(a - 1, n);
+  return n;
+}
+
+int f230(int a, int b) {
+  int c = a * 33 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f105(a - 1, n);
+  return n;
+}
+
+int f231(int a, int b) {
+  int c = a * 65 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 25)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f119(a - 1, n);
+  return n;
+}
+
+int f232(int a, int b) {
+  int c = a * 58 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f201(a - 1, n);
+  return n;
+}
+
+int f233(int a, int b) {
+  int c = a * 92 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 19)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f40(a - 1, n);
+  return n;
+}
+
+int f234(int a, int b) {
+  int c = a * 30 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f85(a - 1, n);
+  return n;
+}
+
+int f235(int a, int b) {
+  int c = a * 44 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f195(a - 1, n);
+  return n;
+}
+
+int f236(int a, int b) {
+  int c = a * 65 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f95(a - 1, n);
+  return n;
+}
+
+int f237(int a, int b) {
+  int c = a * 75 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f83(a - 1, n);
+  return n;
+}
+
+int f238(int a, int b) {
+  int c = a * 31 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f160(a - 1, n);
+  return n;
+}
+
+int f239(int a, int b) {
+  int c = a * 77 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f66(a - 1, n);
+  return n;
+}
+
+int f240(int a, int b) {
+  int c = a * 83 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f75(a - 1, n);
+  return n;
+}
+
+int f241(int a, int b) {
+  int c = a * 51 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f65(a - 1, n);
+  return n;
+}
+
+int f242(int a, int b) {
+  int c = a * 88 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 34)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f120(a - 1, n);
+  return n;
+}
+
+int f243(int a, int b) {
+  int c = a * 79 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 18)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f26(a - 1, n);
+  return n;
+}
+
+int f244(int a, int b) {
+  int c = a * 65 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 24)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f64(a - 1, n);
+  return n;
+}
+
+int f245(int a, int b) {
+  int c = a * 60 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f209(a - 1, n);
+  return n;
+}
+
+int f246(int a, int b) {
+  int c = a * 87 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f196(a - 1, n);
+  return n;
+}
+
+int f247(int a, int b) {
+  int c = a * 60 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f104(a - 1, n);
+  return n;
+}
+
+int f248(int a, int b) {
+  int c = a * 27 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 27)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f12(a - 1, n);
+  return n;
+}
+
+int f249(int a, int b) {
+  int c = a * 9 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f120(a - 1, n);
+  return n;
+}
+
+int f250(int a, int b) {
+  int c = a * 15 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f220(a - 1, n);
+  return n;
+}
+
+int f251(int a, int b) {
+  int c = a * 91 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 25)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f48(a - 1, n);
+  return n;
+}
+
+int f252(int a, int b) {
+  int c = a * 63 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f159(a - 1, n);
+  return n;
+}
+
+int f253(int a, int b) {
+  int c = a * 17 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f72(a - 1, n);
+  return n;
+}
+
+int f254(int a, int b) {
+  int c = a * 15 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f64(a - 1, n);
+  return n;
+}
+
+int f255(int a, int b) {
+  int c = a * 40 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f101(a - 1, n);
+  return n;
+}
+
+int f256(int a, int b) {
+  int c = a * 49 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f83(a - 1, n);
+  return n;
+}
+
+int f257(int a, int b) {
+  int c = a * 16 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f173(a - 1, n);
+  return n;
+}
+
+int f258(int a, int b) {
+  int c = a * 1 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f127(a - 1, n);
+  return n;
+}
+
+int f259(int a, int b) {
+  int c = a * 34 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f123(a - 1, n);
+  return n;
+}
+
+int f260(int a, int b) {
+  int c = a * 55 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f174(a - 1, n);
+  return n;
+}
+
+int f261(int a, int b) {
+  int c = a * 60 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f212(a - 1, n);
+  return n;
+}
+
+int f262(int a, int b) {
+  int c = a * 77 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f120(a - 1, n);
+  return n;
+}
+
+int f263(int a, int b) {
+  int c = a * 46 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f167(a - 1, n);
+  return n;
+}
+
+int f264(int a, int b) {
+  int c = a * 27 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f170(a - 1, n);
+  return n;
+}
+
+int f265(int a, int b) {
+  int c = a * 11 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f88(a - 1, n);
+  return n;
+}
+
+int f266(int a, int b) {
+  int c = a * 87 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 36)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f24(a - 1, n);
+  return n;
+}
+
+int f267(int a, int b) {
+  int c = a * 9 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 19)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f26(a - 1, n);
+  return n;
+}
+
+int f268(int a, int b) {
+  int c = a * 71 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f28(a - 1, n);
+  return n;
+}
+
+int f269(int a, int b) {
+  int c = a * 53 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f261(a - 1, n);
+  return n;
+}
+
+int f270(int a, int b) {
+  int c = a * 47 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f121(a - 1, n);
+  return n;
+}
+
+int f271(int a, int b) {
+  int c = a * 32 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f171(a - 1, n);
+  return n;
+}
+
+int f272(int a, int b) {
+  int c = a * 23 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f271(a - 1, n);
+  return n;
+}
+
+int f273(int a, int b) {
+  int c = a * 18 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f119(a - 1, n);
+  return n;
+}
+
+int f274(int a, int b) {
+  int c = a * 93 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f126(a - 1, n);
+  return n;
+}
+
+int f275(int a, int b) {
+  int c = a * 25 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f131(a - 1, n);
+  return n;
+}
+
+int f276(int a, int b) {
+  int c = a * 68 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 42)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f47(a - 1, n);
+  return n;
+}
+
+int f277(int a, int b) {
+  int c = a * 14 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f77(a - 1, n);
+  return n;
+}
+
+int f278(int a, int b) {
+  int c = a * 56 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 43)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f33(a - 1, n);
+  return n;
+}
+
+int f279(int a, int b) {
+  int c = a * 36 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f194(a - 1, n);
+  return n;
+}
+
+int f280(int a, int b) {
+  int c = a * 40 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 42)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f275(a - 1, n);
+  return n;
+}
+
+int f281(int a, int b) {
+  int c = a * 88 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f220(a - 1, n);
+  return n;
+}
+
+int f282(int a, int b) {
+  int c = a * 26 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f184(a - 1, n);
+  return n;
+}
+
+int f283(int a, int b) {
+  int c = a * 92 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 25)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f41(a - 1, n);
+  return n;
+}
+
+int f284(int a, int b) {
+  int c = a * 58 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f202(a - 1, n);
+  return n;
+}
+
+int f285(int a, int b) {
+  int c = a * 7 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f162(a - 1, n);
+  return n;
+}
+
+int f286(int a, int b) {
+  int c = a * 67 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f209(a - 1, n);
+  return n;
+}
+
+int f287(int a, int b) {
+  int c = a * 64 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f115(a - 1, n);
+  return n;
+}
+
+int f288(int a, int b) {
+  int c = a * 63 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 3)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f196(a - 1, n);
+  return n;
+}
+
+int f289(int a, int b) {
+  int c = a * 47 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f88(a - 1, n);
+  return n;
+}
+
+int f290(int a, int b) {
+  int c = a * 18 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f279(a - 1, n);
+  return n;
+}
+
+int f291(int a, int b) {
+  int c = a * 71 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f167(a - 1, n);
+  return n;
+}
+
+int f292(int a, int b) {
+  int c = a * 89 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 27)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f287(a - 1, n);
+  return n;
+}
+
+int f293(int a, int b) {
+  int c = a * 37 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f94(a - 1, n);
+  return n;
+}
+
+int f294(int a, int b) {
+  int c = a * 36 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f114(a - 1, n);
+  return n;
+}
+
+int f295(int a, int b) {
+  int c = a * 63 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f286(a - 1, n);
+  return n;
+}
+
+int f296(int a, int b) {
+  int c = a * 92 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f66(a - 1, n);
+  return n;
+}
+
+int f297(int a, int b) {
+  int c = a * 32 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f30(a - 1, n);
+  return n;
+}
+
+int f298(int a, int b) {
+  int c = a * 48 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f192(a - 1, n);
+  return n;
+}
+
+int f299(int a, int b) {
+  int c = a * 60 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 25)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f28(a - 1, n);
+  return n;
+}
+
+int f300(int a, int b) {
+  int c = a * 84 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f229(a - 1, n);
+  return n;
+}
+
+int f301(int a, int b) {
+  int c = a * 1 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f257(a - 1, n);
+  return n;
+}
+
+int f302(int a, int b) {
+  int c = a * 3 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 42)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f65(a - 1, n);
+  return n;
+}
+
+int f303(int a, int b) {
+  int c = a * 11 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f134(a - 1, n);
+  return n;
+}
+
+int f304(int a, int b) {
+  int c = a * 66 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 4)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f142(a - 1, n);
+  return n;
+}
+
+int f305(int a, int b) {
+  int c = a * 54 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f50(a - 1, n);
+  return n;
+}
+
+int f306(int a, int b) {
+  int c = a * 76 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 18)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f248(a - 1, n);
+  return n;
+}
+
+int f307(int a, int b) {
+  int c = a * 8 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f301(a - 1, n);
+  return n;
+}
+
+int f308(int a, int b) {
+  int c = a * 58 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f103(a - 1, n);
+  return n;
+}
+
+int f309(int a, int b) {
+  int c = a * 34 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f15(a - 1, n);
+  return n;
+}
+
+int f310(int a, int b) {
+  int c = a * 29 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f85(a - 1, n);
+  return n;
+}
+
+int f311(int a, int b) {
+  int c = a * 52 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f267(a - 1, n);
+  return n;
+}
+
+int f312(int a, int b) {
+  int c = a * 1 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f160(a - 1, n);
+  return n;
+}
+
+int f313(int a, int b) {
+  int c = a * 68 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f63(a - 1, n);
+  return n;
+}
+
+int f314(int a, int b) {
+  int c = a * 53 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f240(a - 1, n);
+  return n;
+}
+
+int f315(int a, int b) {
+  int c = a * 62 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 42)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f216(a - 1, n);
+  return n;
+}
+
+int f316(int a, int b) {
+  int c = a * 63 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f124(a - 1, n);
+  return n;
+}
+
+int f317(int a, int b) {
+  int c = a * 86 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f55(a - 1, n);
+  return n;
+}
+
+int f318(int a, int b) {
+  int c = a * 69 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f86(a - 1, n);
+  return n;
+}
+
+int f319(int a, int b) {
+  int c = a * 72 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 3)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f190(a - 1, n);
+  return n;
+}
+
+int f320(int a, int b) {
+  int c = a * 81 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f283(a - 1, n);
+  return n;
+}
+
+int f321(int a, int b) {
+  int c = a * 67 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f105(a - 1, n);
+  return n;
+}
+
+int f322(int a, int b) {
+  int c = a * 21 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f27(a - 1, n);
+  return n;
+}
+
+int f323(int a, int b) {
+  int c = a * 78 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f29(a - 1, n);
+  return n;
+}
+
+int f324(int a, int b) {
+  int c = a * 52 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f176(a - 1, n);
+  return n;
+}
+
+int f325(int a, int b) {
+  int c = a * 31 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f49(a - 1, n);
+  return n;
+}
+
+int f326(int a, int b) {
+  int c = a * 20 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f94(a - 1, n);
+  return n;
+}
+
+int f327(int a, int b) {
+  int c = a * 54 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f118(a - 1, n);
+  return n;
+}
+
+int f328(int a, int b) {
+  int c = a * 98 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f18(a - 1, n);
+  return n;
+}
+
+int f329(int a, int b) {
+  int c = a * 48 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f72(a - 1, n);
+  return n;
+}
+
+int f330(int a, int b) {
+  int c = a * 34 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f169(a - 1, n);
+  return n;
+}
+
+int f331(int a, int b) {
+  int c = a * 95 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f297(a - 1, n);
+  return n;
+}
+
+int f332(int a, int b) {
+  int c = a * 17 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f44(a - 1, n);
+  return n;
+}
+
+int f333(int a, int b) {
+  int c = a * 86 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f320(a - 1, n);
+  return n;
+}
+
+int f334(int a, int b) {
+  int c = a * 7 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f314(a - 1, n);
+  return n;
+}
+
+int f335(int a, int b) {
+  int c = a * 33 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f118(a - 1, n);
+  return n;
+}
+
+int f336(int a, int b) {
+  int c = a * 10 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f14(a - 1, n);
+  return n;
+}
+
+int f337(int a, int b) {
+  int c = a * 10 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 18)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f290(a - 1, n);
+  return n;
+}
+
+int f338(int a, int b) {
+  int c = a * 61 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 10)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f5(a - 1, n);
+  return n;
+}
+
+int f339(int a, int b) {
+  int c = a * 56 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 3)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f266(a - 1, n);
+  return n;
+}
+
+int f340(int a, int b) {
+  int c = a * 90 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f147(a - 1, n);
+  return n;
+}
+
+int f341(int a, int b) {
+  int c = a * 97 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 27)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f256(a - 1, n);
+  return n;
+}
+
+int f342(int a, int b) {
+  int c = a * 67 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f81(a - 1, n);
+  return n;
+}
+
+int f343(int a, int b) {
+  int c = a * 58 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f42(a - 1, n);
+  return n;
+}
+
+int f344(int a, int b) {
+  int c = a * 10 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 36)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f337(a - 1, n);
+  return n;
+}
+
+int f345(int a, int b) {
+  int c = a * 21 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f72(a - 1, n);
+  return n;
+}
+
+int f346(int a, int b) {
+  int c = a * 60 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f190(a - 1, n);
+  return n;
+}
+
+int f347(int a, int b) {
+  int c = a * 12 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 27)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f321(a - 1, n);
+  return n;
+}
+
+int f348(int a, int b) {
+  int c = a * 75 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f239(a - 1, n);
+  return n;
+}
+
+int f349(int a, int b) {
+  int c = a * 28 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 8)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f84(a - 1, n);
+  return n;
+}
+
+int f350(int a, int b) {
+  int c = a * 92 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 43)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f313(a - 1, n);
+  return n;
+}
+
+int f351(int a, int b) {
+  int c = a * 74 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 43)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f146(a - 1, n);
+  return n;
+}
+
+int f352(int a, int b) {
+  int c = a * 26 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f256(a - 1, n);
+  return n;
+}
+
+int f353(int a, int b) {
+  int c = a * 90 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f217(a - 1, n);
+  return n;
+}
+
+int f354(int a, int b) {
+  int c = a * 80 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 43)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f71(a - 1, n);
+  return n;
+}
+
+int f355(int a, int b) {
+  int c = a * 9 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f240(a - 1, n);
+  return n;
+}
+
+int f356(int a, int b) {
+  int c = a * 92 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 36)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f98(a - 1, n);
+  return n;
+}
+
+int f357(int a, int b) {
+  int c = a * 71 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f74(a - 1, n);
+  return n;
+}
+
+int f358(int a, int b) {
+  int c = a * 14 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f316(a - 1, n);
+  return n;
+}
+
+int f359(int a, int b) {
+  int c = a * 90 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 24)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f309(a - 1, n);
+  return n;
+}
+
+int f360(int a, int b) {
+  int c = a * 74 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f134(a - 1, n);
+  return n;
+}
+
+int f361(int a, int b) {
+  int c = a * 76 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 25)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f30(a - 1, n);
+  return n;
+}
+
+int f362(int a, int b) {
+  int c = a * 85 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f304(a - 1, n);
+  return n;
+}
+
+int f363(int a, int b) {
+  int c = a * 92 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f85(a - 1, n);
+  return n;
+}
+
+int f364(int a, int b) {
+  int c = a * 19 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 19)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f211(a - 1, n);
+  return n;
+}
+
+int f365(int a, int b) {
+  int c = a * 62 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f325(a - 1, n);
+  return n;
+}
+
+int f366(int a, int b) {
+  int c = a * 72 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f85(a - 1, n);
+  return n;
+}
+
+int f367(int a, int b) {
+  int c = a * 59 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f247(a - 1, n);
+  return n;
+}
+
+int f368(int a, int b) {
+  int c = a * 83 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f237(a - 1, n);
+  return n;
+}
+
+int f369(int a, int b) {
+  int c = a * 70 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f148(a - 1, n);
+  return n;
+}
+
+int f370(int a, int b) {
+  int c = a * 42 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f41(a - 1, n);
+  return n;
+}
+
+int f371(int a, int b) {
+  int c = a * 22 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f340(a - 1, n);
+  return n;
+}
+
+int f372(int a, int b) {
+  int c = a * 35 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f353(a - 1, n);
+  return n;
+}
+
+int f373(int a, int b) {
+  int c = a * 28 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f257(a - 1, n);
+  return n;
+}
+
+int f374(int a, int b) {
+  int c = a * 24 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 34)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f69(a - 1, n);
+  return n;
+}
+
+int f375(int a, int b) {
+  int c = a * 69 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f152(a - 1, n);
+  return n;
+}
+
+int f376(int a, int b) {
+  int c = a * 46 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f194(a - 1, n);
+  return n;
+}
+
+int f377(int a, int b) {
+  int c = a * 23 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f364(a - 1, n);
+  return n;
+}
+
+int f378(int a, int b) {
+  int c = a * 77 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 43)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f196(a - 1, n);
+  return n;
+}
+
+int f379(int a, int b) {
+  int c = a * 42 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f211(a - 1, n);
+  return n;
+}
+
+int f380(int a, int b) {
+  int c = a * 57 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f153(a - 1, n);
+  return n;
+}
+
+int f381(int a, int b) {
+  int c = a * 73 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f351(a - 1, n);
+  return n;
+}
+
+int f382(int a, int b) {
+  int c = a * 96 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f330(a - 1, n);
+  return n;
+}
+
+int f383(int a, int b) {
+  int c = a * 55 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f241(a - 1, n);
+  return n;
+}
+
+int f384(int a, int b) {
+  int c = a * 3 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f359(a - 1, n);
+  return n;
+}
+
+int f385(int a, int b) {
+  int c = a * 36 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 18)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f221(a - 1, n);
+  return n;
+}
+
+int f386(int a, int b) {
+  int c = a * 18 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 4)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f115(a - 1, n);
+  return n;
+}
+
+int f387(int a, int b) {
+  int c = a * 48 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f202(a - 1, n);
+  return n;
+}
+
+int f388(int a, int b) {
+  int c = a * 14 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f363(a - 1, n);
+  return n;
+}
+
+int f389(int a, int b) {
+  int c = a * 88 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 18)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f327(a - 1, n);
+  return n;
+}
+
+int f390(int a, int b) {
+  int c = a * 36 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f35(a - 1, n);
+  return n;
+}
+
+int f391(int a, int b) {
+  int c = a * 36 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f266(a - 1, n);
+  return n;
+}
+
+int f392(int a, int b) {
+  int c = a * 35 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f93(a - 1, n);
+  return n;
+}
+
+int f393(int a, int b) {
+  int c = a * 30 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f64(a - 1, n);
+  return n;
+}
+
+int f394(int a, int b) {
+  int c = a * 15 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f187(a - 1, n);
+  return n;
+}
+
+int f395(int a, int b) {
+  int c = a * 13 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 8)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f323(a - 1, n);
+  return n;
+}
+
+int f396(int a, int b) {
+  int c = a * 83 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f206(a - 1, n);
+  return n;
+}
+
+int f397(int a, int b) {
+  int c = a * 25 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 27)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f250(a - 1, n);
+  return n;
+}
+
+int f398(int a, int b) {
+  int c = a * 52 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f224(a - 1, n);
+  return n;
+}
+
+int f399(int a, int b) {
+  int c = a * 32 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f91(a - 1, n);
+  return n;
+}
+
+int f400(int a, int b) {
+  int c = a * 39 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f52(a - 1, n);
+  return n;
+}
+
+int f401(int a, int b) {
+  int c = a * 26 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f322(a - 1, n);
+  return n;
+}
+
+int f402(int a, int b) {
+  int c = a * 36 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f239(a - 1, n);
+  return n;
+}
+
+int f403(int a, int b) {
+  int c = a * 89 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f185(a - 1, n);
+  return n;
+}
+
+int f404(int a, int b) {
+  int c = a * 55 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f69(a - 1, n);
+  return n;
+}
+
+int f405(int a, int b) {
+  int c = a * 7 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f44(a - 1, n);
+  return n;
+}
+
+int f406(int a, int b) {
+  int c = a * 93 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f177(a - 1, n);
+  return n;
+}
+
+int f407(int a, int b) {
+  int c = a * 78 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f169(a - 1, n);
+  return n;
+}
+
+int f408(int a, int b) {
+  int c = a * 11 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f387(a - 1, n);
+  return n;
+}
+
+int f409(int a, int b) {
+  int c = a * 96 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f191(a - 1, n);
+  return n;
+}
+
+int f410(int a, int b) {
+  int c = a * 85 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f359(a - 1, n);
+  return n;
+}
+
+int f411(int a, int b) {
+  int c = a * 42 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f197(a - 1, n);
+  return n;
+}
+
+int f412(int a, int b) {
+  int c = a * 49 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f41(a - 1, n);
+  return n;
+}
+
+int f413(int a, int b) {
+  int c = a * 92 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f65(a - 1, n);
+  return n;
+}
+
+int f414(int a, int b) {
+  int c = a * 65 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 43)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f410(a - 1, n);
+  return n;
+}
+
+int f415(int a, int b) {
+  int c = a * 5 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f102(a - 1, n);
+  return n;
+}
+
+int f416(int a, int b) {
+  int c = a * 50 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 8)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f302(a - 1, n);
+  return n;
+}
+
+int f417(int a, int b) {
+  int c = a * 36 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f123(a - 1, n);
+  return n;
+}
+
+int f418(int a, int b) {
+  int c = a * 12 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f202(a - 1, n);
+  return n;
+}
+
+int f419(int a, int b) {
+  int c = a * 63 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f102(a - 1, n);
+  return n;
+}
+
+int f420(int a, int b) {
+  int c = a * 54 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f130(a - 1, n);
+  return n;
+}
+
+int f421(int a, int b) {
+  int c = a * 31 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f304(a - 1, n);
+  return n;
+}
+
+int f422(int a, int b) {
+  int c = a * 55 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f233(a - 1, n);
+  return n;
+}
+
+int f423(int a, int b) {
+  int c = a * 18 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f289(a - 1, n);
+  return n;
+}
+
+int f424(int a, int b) {
+  int c = a * 62 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 27)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f343(a - 1, n);
+  return n;
+}
+
+int f425(int a, int b) {
+  int c = a * 69 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f238(a - 1, n);
+  return n;
+}
+
+int f426(int a, int b) {
+  int c = a * 3 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f267(a - 1, n);
+  return n;
+}
+
+int f427(int a, int b) {
+  int c = a * 96 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f333(a - 1, n);
+  return n;
+}
+
+int f428(int a, int b) {
+  int c = a * 88 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 36)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f278(a - 1, n);
+  return n;
+}
+
+int f429(int a, int b) {
+  int c = a * 93 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f356(a - 1, n);
+  return n;
+}
+
+int f430(int a, int b) {
+  int c = a * 70 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 43)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f113(a - 1, n);
+  return n;
+}
+
+int f431(int a, int b) {
+  int c = a * 59 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f143(a - 1, n);
+  return n;
+}
+
+int f432(int a, int b) {
+  int c = a * 17 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 10)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f101(a - 1, n);
+  return n;
+}
+
+int f433(int a, int b) {
+  int c = a * 22 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f79(a - 1, n);
+  return n;
+}
+
+int f434(int a, int b) {
+  int c = a * 51 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 42)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f277(a - 1, n);
+  return n;
+}
+
+int f435(int a, int b) {
+  int c = a * 4 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f161(a - 1, n);
+  return n;
+}
+
+int f436(int a, int b) {
+  int c = a * 7 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f210(a - 1, n);
+  return n;
+}
+
+int f437(int a, int b) {
+  int c = a * 35 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f209(a - 1, n);
+  return n;
+}
+
+int f438(int a, int b) {
+  int c = a * 10 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 34)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f98(a - 1, n);
+  return n;
+}
+
+int f439(int a, int b) {
+  int c = a * 84 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 19)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f349(a - 1, n);
+  return n;
+}
+
+int f440(int a, int b) {
+  int c = a * 2 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f388(a - 1, n);
+  return n;
+}
+
+int f441(int a, int b) {
+  int c = a * 0 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f207(a - 1, n);
+  return n;
+}
+
+int f442(int a, int b) {
+  int c = a * 75 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f109(a - 1, n);
+  return n;
+}
+
+int f443(int a, int b) {
+  int c = a * 87 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f361(a - 1, n);
+  return n;
+}
+
+int f444(int a, int b) {
+  int c = a * 82 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f108(a - 1, n);
+  return n;
+}
+
+int f445(int a, int b) {
+  int c = a * 85 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f107(a - 1, n);
+  return n;
+}
+
+int f446(int a, int b) {
+  int c = a * 6 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f67(a - 1, n);
+  return n;
+}
+
+int f447(int a, int b) {
+  int c = a * 52 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f85(a - 1, n);
+  return n;
+}
+
+int f448(int a, int b) {
+  int c = a * 13 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f317(a - 1, n);
+  return n;
+}
+
+int f449(int a, int b) {
+  int c = a * 95 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f153(a - 1, n);
+  return n;
+}
+
+int f450(int a, int b) {
+  int c = a * 8 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f272(a - 1, n);
+  return n;
+}
+
+int f451(int a, int b) {
+  int c = a * 5 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f57(a - 1, n);
+  return n;
+}
+
+int f452(int a, int b) {
+  int c = a * 60 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f236(a - 1, n);
+  return n;
+}
+
+int f453(int a, int b) {
+  int c = a * 41 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f65(a - 1, n);
+  return n;
+}
+
+int f454(int a, int b) {
+  int c = a * 14 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f27(a - 1, n);
+  return n;
+}
+
+int f455(int a, int b) {
+  int c = a * 97 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f270(a - 1, n);
+  return n;
+}
+
+int f456(int a, int b) {
+  int c = a * 1 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f205(a - 1, n);
+  return n;
+}
+
+int f457(int a, int b) {
+  int c = a * 67 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f230(a - 1, n);
+  return n;
+}
+
+int f458(int a, int b) {
+  int c = a * 90 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f434(a - 1, n);
+  return n;
+}
+
+int f459(int a, int b) {
+  int c = a * 3 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f60(a - 1, n);
+  return n;
+}
+
+int f460(int a, int b) {
+  int c = a * 24 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f326(a - 1, n);
+  return n;
+}
+
+int f461(int a, int b) {
+  int c = a * 69 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f342(a - 1, n);
+  return n;
+}
+
+int f462(int a, int b) {
+  int c = a * 9 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f348(a - 1, n);
+  return n;
+}
+
+int f463(int a, int b) {
+  int c = a * 74 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f385(a - 1, n);
+  return n;
+}
+
+int f464(int a, int b) {
+  int c = a * 37 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f269(a - 1, n);
+  return n;
+}
+
+int f465(int a, int b) {
+  int c = a * 67 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f253(a - 1, n);
+  return n;
+}
+
+int f466(int a, int b) {
+  int c = a * 37 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f170(a - 1, n);
+  return n;
+}
+
+int f467(int a, int b) {
+  int c = a * 65 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f379(a - 1, n);
+  return n;
+}
+
+int f468(int a, int b) {
+  int c = a * 73 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f397(a - 1, n);
+  return n;
+}
+
+int f469(int a, int b) {
+  int c = a * 29 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f376(a - 1, n);
+  return n;
+}
+
+int f470(int a, int b) {
+  int c = a * 10 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f199(a - 1, n);
+  return n;
+}
+
+int f471(int a, int b) {
+  int c = a * 13 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 36)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f290(a - 1, n);
+  return n;
+}
+
+int f472(int a, int b) {
+  int c = a * 38 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f322(a - 1, n);
+  return n;
+}
+
+int f473(int a, int b) {
+  int c = a * 90 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 19)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f190(a - 1, n);
+  return n;
+}
+
+int f474(int a, int b) {
+  int c = a * 71 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 24)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f165(a - 1, n);
+  return n;
+}
+
+int f475(int a, int b) {
+  int c = a * 81 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f29(a - 1, n);
+  return n;
+}
+
+int f476(int a, int b) {
+  int c = a * 5 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f120(a - 1, n);
+  return n;
+}
+
+int f477(int a, int b) {
+  int c = a * 18 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f173(a - 1, n);
+  return n;
+}
+
+int f478(int a, int b) {
+  int c = a * 91 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f163(a - 1, n);
+  return n;
+}
+
+int f479(int a, int b) {
+  int c = a * 63 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f467(a - 1, n);
+  return n;
+}
+
+int f480(int a, int b) {
+  int c = a * 65 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f68(a - 1, n);
+  return n;
+}
+
+int f481(int a, int b) {
+  int c = a * 39 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f129(a - 1, n);
+  return n;
+}
+
+int f482(int a, int b) {
+  int c = a * 65 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f320(a - 1, n);
+  return n;
+}
+
+int f483(int a, int b) {
+  int c = a * 66 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f285(a - 1, n);
+  return n;
+}
+
+int f484(int a, int b) {
+  int c = a * 36 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f19(a - 1, n);
+  return n;
+}
+
+int f485(int a, int b) {
+  int c = a * 98 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f148(a - 1, n);
+  return n;
+}
+
+int f486(int a, int b) {
+  int c = a * 75 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 42)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f140(a - 1, n);
+  return n;
+}
+
+int f487(int a, int b) {
+  int c = a * 72 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f141(a - 1, n);
+  return n;
+}
+
+int f488(int a, int b) {
+  int c = a * 57 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f109(a - 1, n);
+  return n;
+}
+
+int f489(int a, int b) {
+  int c = a * 65 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f100(a - 1, n);
+  return n;
+}
+
+int f490(int a, int b) {
+  int c = a * 21 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f304(a - 1, n);
+  return n;
+}
+
+int f491(int a, int b) {
+  int c = a * 12 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 27)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f414(a - 1, n);
+  return n;
+}
+
+int f492(int a, int b) {
+  int c = a * 94 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f485(a - 1, n);
+  return n;
+}
+
+int f493(int a, int b) {
+  int c = a * 25 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f173(a - 1, n);
+  return n;
+}
+
+int f494(int a, int b) {
+  int c = a * 30 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 27)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f174(a - 1, n);
+  return n;
+}
+
+int f495(int a, int b) {
+  int c = a * 54 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f353(a - 1, n);
+  return n;
+}
+
+int f496(int a, int b) {
+  int c = a * 80 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 25)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f131(a - 1, n);
+  return n;
+}
+
+int f497(int a, int b) {
+  int c = a * 93 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f141(a - 1, n);
+  return n;
+}
+
+int f498(int a, int b) {
+  int c = a * 46 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 10)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f454(a - 1, n);
+  return n;
+}
+
+int f499(int a, int b) {
+  int c = a * 30 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f247(a - 1, n);
+  return n;
+}
+
+int f500(int a, int b) {
+  int c = a * 41 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 19)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f495(a - 1, n);
+  return n;
+}
+
+int f501(int a, int b) {
+  int c = a * 57 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f166(a - 1, n);
+  return n;
+}
+
+int f502(int a, int b) {
+  int c = a * 21 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f210(a - 1, n);
+  return n;
+}
+
+int f503(int a, int b) {
+  int c = a * 98 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f345(a - 1, n);
+  return n;
+}
+
+int f504(int a, int b) {
+  int c = a * 14 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 27)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f471(a - 1, n);
+  return n;
+}
+
+int f505(int a, int b) {
+  int c = a * 65 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f354(a - 1, n);
+  return n;
+}
+
+int f506(int a, int b) {
+  int c = a * 59 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f87(a - 1, n);
+  return n;
+}
+
+int f507(int a, int b) {
+  int c = a * 62 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f357(a - 1, n);
+  return n;
+}
+
+int f508(int a, int b) {
+  int c = a * 76 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f444(a - 1, n);
+  return n;
+}
+
+int f509(int a, int b) {
+  int c = a * 23 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f337(a - 1, n);
+  return n;
+}
+
+int f510(int a, int b) {
+  int c = a * 20 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 24)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f266(a - 1, n);
+  return n;
+}
+
+int f511(int a, int b) {
+  int c = a * 17 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f492(a - 1, n);
+  return n;
+}
+
+int f512(int a, int b) {
+  int c = a * 57 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f65(a - 1, n);
+  return n;
+}
+
+int f513(int a, int b) {
+  int c = a * 44 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f321(a - 1, n);
+  return n;
+}
+
+int f514(int a, int b) {
+  int c = a * 92 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 8)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f88(a - 1, n);
+  return n;
+}
+
+int f515(int a, int b) {
+  int c = a * 4 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f362(a - 1, n);
+  return n;
+}
+
+int f516(int a, int b) {
+  int c = a * 94 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f85(a - 1, n);
+  return n;
+}
+
+int f517(int a, int b) {
+  int c = a * 72 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f215(a - 1, n);
+  return n;
+}
+
+int f518(int a, int b) {
+  int c = a * 68 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f199(a - 1, n);
+  return n;
+}
+
+int f519(int a, int b) {
+  int c = a * 0 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f372(a - 1, n);
+  return n;
+}
+
+int f520(int a, int b) {
+  int c = a * 33 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f397(a - 1, n);
+  return n;
+}
+
+int f521(int a, int b) {
+  int c = a * 4 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f420(a - 1, n);
+  return n;
+}
+
+int f522(int a, int b) {
+  int c = a * 15 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f333(a - 1, n);
+  return n;
+}
+
+int f523(int a, int b) {
+  int c = a * 46 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f429(a - 1, n);
+  return n;
+}
+
+int f524(int a, int b) {
+  int c = a * 13 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 4)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f332(a - 1, n);
+  return n;
+}
+
+int f525(int a, int b) {
+  int c = a * 41 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 10)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f45(a - 1, n);
+  return n;
+}
+
+int f526(int a, int b) {
+  int c = a * 50 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f316(a - 1, n);
+  return n;
+}
+
+int f527(int a, int b) {
+  int c = a * 34 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f309(a - 1, n);
+  return n;
+}
+
+int f528(int a, int b) {
+  int c = a * 74 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f136(a - 1, n);
+  return n;
+}
+
+int f529(int a, int b) {
+  int c = a * 38 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f214(a - 1, n);
+  return n;
+}
+
+int f530(int a, int b) {
+  int c = a * 12 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f386(a - 1, n);
+  return n;
+}
+
+int f531(int a, int b) {
+  int c = a * 83 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f462(a - 1, n);
+  return n;
+}
+
+int f532(int a, int b) {
+  int c = a * 17 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 18)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f502(a - 1, n);
+  return n;
+}
+
+int f533(int a, int b) {
+  int c = a * 97 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 4)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f13(a - 1, n);
+  return n;
+}
+
+int f534(int a, int b) {
+  int c = a * 53 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f420(a - 1, n);
+  return n;
+}
+
+int f535(int a, int b) {
+  int c = a * 98 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f350(a - 1, n);
+  return n;
+}
+
+int f536(int a, int b) {
+  int c = a * 78 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f535(a - 1, n);
+  return n;
+}
+
+int f537(int a, int b) {
+  int c = a * 38 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f356(a - 1, n);
+  return n;
+}
+
+int f538(int a, int b) {
+  int c = a * 83 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f480(a - 1, n);
+  return n;
+}
+
+int f539(int a, int b) {
+  int c = a * 34 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 4)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f144(a - 1, n);
+  return n;
+}
+
+int f540(int a, int b) {
+  int c = a * 24 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f373(a - 1, n);
+  return n;
+}
+
+int f541(int a, int b) {
+  int c = a * 34 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f51(a - 1, n);
+  return n;
+}
+
+int f542(int a, int b) {
+  int c = a * 80 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f155(a - 1, n);
+  return n;
+}
+
+int f543(int a, int b) {
+  int c = a * 18 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f87(a - 1, n);
+  return n;
+}
+
+int f544(int a, int b) {
+  int c = a * 63 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f184(a - 1, n);
+  return n;
+}
+
+int f545(int a, int b) {
+  int c = a * 17 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 10)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f419(a - 1, n);
+  return n;
+}
+
+int f546(int a, int b) {
+  int c = a * 15 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 18)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f44(a - 1, n);
+  return n;
+}
+
+int f547(int a, int b) {
+  int c = a * 25 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f411(a - 1, n);
+  return n;
+}
+
+int f548(int a, int b) {
+  int c = a * 94 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f468(a - 1, n);
+  return n;
+}
+
+int f549(int a, int b) {
+  int c = a * 56 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f245(a - 1, n);
+  return n;
+}
+
+int f550(int a, int b) {
+  int c = a * 64 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f369(a - 1, n);
+  return n;
+}
+
+int f551(int a, int b) {
+  int c = a * 50 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f351(a - 1, n);
+  return n;
+}
+
+int f552(int a, int b) {
+  int c = a * 4 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f379(a - 1, n);
+  return n;
+}
+
+int f553(int a, int b) {
+  int c = a * 76 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f394(a - 1, n);
+  return n;
+}
+
+int f554(int a, int b) {
+  int c = a * 33 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f211(a - 1, n);
+  return n;
+}
+
+int f555(int a, int b) {
+  int c = a * 90 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f486(a - 1, n);
+  return n;
+}
+
+int f556(int a, int b) {
+  int c = a * 64 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f39(a - 1, n);
+  return n;
+}
+
+int f557(int a, int b) {
+  int c = a * 54 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f275(a - 1, n);
+  return n;
+}
+
+int f558(int a, int b) {
+  int c = a * 22 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f20(a - 1, n);
+  return n;
+}
+
+int f559(int a, int b) {
+  int c = a * 29 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f34(a - 1, n);
+  return n;
+}
+
+int f560(int a, int b) {
+  int c = a * 7 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 8)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f262(a - 1, n);
+  return n;
+}
+
+int f561(int a, int b) {
+  int c = a * 88 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f492(a - 1, n);
+  return n;
+}
+
+int f562(int a, int b) {
+  int c = a * 43 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f330(a - 1, n);
+  return n;
+}
+
+int f563(int a, int b) {
+  int c = a * 61 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f217(a - 1, n);
+  return n;
+}
+
+int f564(int a, int b) {
+  int c = a * 96 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f82(a - 1, n);
+  return n;
+}
+
+int f565(int a, int b) {
+  int c = a * 76 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f314(a - 1, n);
+  return n;
+}
+
+int f566(int a, int b) {
+  int c = a * 26 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f243(a - 1, n);
+  return n;
+}
+
+int f567(int a, int b) {
+  int c = a * 37 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f517(a - 1, n);
+  return n;
+}
+
+int f568(int a, int b) {
+  int c = a * 65 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f45(a - 1, n);
+  return n;
+}
+
+int f569(int a, int b) {
+  int c = a * 98 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f171(a - 1, n);
+  return n;
+}
+
+int f570(int a, int b) {
+  int c = a * 48 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f2(a - 1, n);
+  return n;
+}
+
+int f571(int a, int b) {
+  int c = a * 51 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f512(a - 1, n);
+  return n;
+}
+
+int f572(int a, int b) {
+  int c = a * 86 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f225(a - 1, n);
+  return n;
+}
+
+int f573(int a, int b) {
+  int c = a * 48 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 18)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f103(a - 1, n);
+  return n;
+}
+
+int f574(int a, int b) {
+  int c = a * 92 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f54(a - 1, n);
+  return n;
+}
+
+int f575(int a, int b) {
+  int c = a * 72 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 8)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f421(a - 1, n);
+  return n;
+}
+
+int f576(int a, int b) {
+  int c = a * 92 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 8)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f377(a - 1, n);
+  return n;
+}
+
+int f577(int a, int b) {
+  int c = a * 17 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f332(a - 1, n);
+  return n;
+}
+
+int f578(int a, int b) {
+  int c = a * 52 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f256(a - 1, n);
+  return n;
+}
+
+int f579(int a, int b) {
+  int c = a * 47 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f61(a - 1, n);
+  return n;
+}
+
+int f580(int a, int b) {
+  int c = a * 45 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f486(a - 1, n);
+  return n;
+}
+
+int f581(int a, int b) {
+  int c = a * 13 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f273(a - 1, n);
+  return n;
+}
+
+int f582(int a, int b) {
+  int c = a * 65 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f160(a - 1, n);
+  return n;
+}
+
+int f583(int a, int b) {
+  int c = a * 98 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f508(a - 1, n);
+  return n;
+}
+
+int f584(int a, int b) {
+  int c = a * 55 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f396(a - 1, n);
+  return n;
+}
+
+int f585(int a, int b) {
+  int c = a * 34 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f525(a - 1, n);
+  return n;
+}
+
+int f586(int a, int b) {
+  int c = a * 37 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f100(a - 1, n);
+  return n;
+}
+
+int f587(int a, int b) {
+  int c = a * 14 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 10)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f585(a - 1, n);
+  return n;
+}
+
+int f588(int a, int b) {
+  int c = a * 96 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f575(a - 1, n);
+  return n;
+}
+
+int f589(int a, int b) {
+  int c = a * 76 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 25)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f566(a - 1, n);
+  return n;
+}
+
+int f590(int a, int b) {
+  int c = a * 69 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 25)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f175(a - 1, n);
+  return n;
+}
+
+int f591(int a, int b) {
+  int c = a * 9 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 34)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f515(a - 1, n);
+  return n;
+}
+
+int f592(int a, int b) {
+  int c = a * 67 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f385(a - 1, n);
+  return n;
+}
+
+int f593(int a, int b) {
+  int c = a * 65 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f258(a - 1, n);
+  return n;
+}
+
+int f594(int a, int b) {
+  int c = a * 1 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f203(a - 1, n);
+  return n;
+}
+
+int f595(int a, int b) {
+  int c = a * 81 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f319(a - 1, n);
+  return n;
+}
+
+int f596(int a, int b) {
+  int c = a * 94 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 4)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f528(a - 1, n);
+  return n;
+}
+
+int f597(int a, int b) {
+  int c = a * 99 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f452(a - 1, n);
+  return n;
+}
+
+int f598(int a, int b) {
+  int c = a * 51 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f141(a - 1, n);
+  return n;
+}
+
+int f599(int a, int b) {
+  int c = a * 96 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 42)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f407(a - 1, n);
+  return n;
+}
+
+int f600(int a, int b) {
+  int c = a * 34 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f27(a - 1, n);
+  return n;
+}
+
+int f601(int a, int b) {
+  int c = a * 19 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f64(a - 1, n);
+  return n;
+}
+
+int f602(int a, int b) {
+  int c = a * 23 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f344(a - 1, n);
+  return n;
+}
+
+int f603(int a, int b) {
+  int c = a * 48 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f602(a - 1, n);
+  return n;
+}
+
+int f604(int a, int b) {
+  int c = a * 86 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f469(a - 1, n);
+  return n;
+}
+
+int f605(int a, int b) {
+  int c = a * 82 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f203(a - 1, n);
+  return n;
+}
+
+int f606(int a, int b) {
+  int c = a * 35 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 34)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f187(a - 1, n);
+  return n;
+}
+
+int f607(int a, int b) {
+  int c = a * 32 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f218(a - 1, n);
+  return n;
+}
+
+int f608(int a, int b) {
+  int c = a * 99 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f63(a - 1, n);
+  return n;
+}
+
+int f609(int a, int b) {
+  int c = a * 33 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f479(a - 1, n);
+  return n;
+}
+
+int f610(int a, int b) {
+  int c = a * 86 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f530(a - 1, n);
+  return n;
+}
+
+int f611(int a, int b) {
+  int c = a * 94 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 36)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f447(a - 1, n);
+  return n;
+}
+
+int f612(int a, int b) {
+  int c = a * 97 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 36)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f301(a - 1, n);
+  return n;
+}
+
+int f613(int a, int b) {
+  int c = a * 39 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 27)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f574(a - 1, n);
+  return n;
+}
+
+int f614(int a, int b) {
+  int c = a * 73 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f587(a - 1, n);
+  return n;
+}
+
+int f615(int a, int b) {
+  int c = a * 0 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f277(a - 1, n);
+  return n;
+}
+
+int f616(int a, int b) {
+  int c = a * 83 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f298(a - 1, n);
+  return n;
+}
+
+int f617(int a, int b) {
+  int c = a * 56 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 4)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f566(a - 1, n);
+  return n;
+}
+
+int f618(int a, int b) {
+  int c = a * 61 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f319(a - 1, n);
+  return n;
+}
+
+int f619(int a, int b) {
+  int c = a * 56 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f355(a - 1, n);
+  return n;
+}
+
+int f620(int a, int b) {
+  int c = a * 97 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f387(a - 1, n);
+  return n;
+}
+
+int f621(int a, int b) {
+  int c = a * 63 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f180(a - 1, n);
+  return n;
+}
+
+int f622(int a, int b) {
+  int c = a * 75 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f226(a - 1, n);
+  return n;
+}
+
+int f623(int a, int b) {
+  int c = a * 76 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f27(a - 1, n);
+  return n;
+}
+
+int f624(int a, int b) {
+  int c = a * 39 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f73(a - 1, n);
+  return n;
+}
+
+int f625(int a, int b) {
+  int c = a * 20 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 36)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f382(a - 1, n);
+  return n;
+}
+
+int f626(int a, int b) {
+  int c = a * 42 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f242(a - 1, n);
+  return n;
+}
+
+int f627(int a, int b) {
+  int c = a * 18 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f445(a - 1, n);
+  return n;
+}
+
+int f628(int a, int b) {
+  int c = a * 26 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 3)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f257(a - 1, n);
+  return n;
+}
+
+int f629(int a, int b) {
+  int c = a * 92 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f443(a - 1, n);
+  return n;
+}
+
+int f630(int a, int b) {
+  int c = a * 12 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f629(a - 1, n);
+  return n;
+}
+
+int f631(int a, int b) {
+  int c = a * 47 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f108(a - 1, n);
+  return n;
+}
+
+int f632(int a, int b) {
+  int c = a * 32 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f160(a - 1, n);
+  return n;
+}
+
+int f633(int a, int b) {
+  int c = a * 21 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f283(a - 1, n);
+  return n;
+}
+
+int f634(int a, int b) {
+  int c = a * 10 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f128(a - 1, n);
+  return n;
+}
+
+int f635(int a, int b) {
+  int c = a * 1 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f203(a - 1, n);
+  return n;
+}
+
+int f636(int a, int b) {
+  int c = a * 83 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f452(a - 1, n);
+  return n;
+}
+
+int f637(int a, int b) {
+  int c = a * 41 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f506(a - 1, n);
+  return n;
+}
+
+int f638(int a, int b) {
+  int c = a * 92 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f247(a - 1, n);
+  return n;
+}
+
+int f639(int a, int b) {
+  int c = a * 72 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f462(a - 1, n);
+  return n;
+}
+
+int f640(int a, int b) {
+  int c = a * 8 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 43)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f11(a - 1, n);
+  return n;
+}
+
+int f641(int a, int b) {
+  int c = a * 27 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f615(a - 1, n);
+  return n;
+}
+
+int f642(int a, int b) {
+  int c = a * 90 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 27)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f517(a - 1, n);
+  return n;
+}
+
+int f643(int a, int b) {
+  int c = a * 73 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f193(a - 1, n);
+  return n;
+}
+
+int f644(int a, int b) {
+  int c = a * 41 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f38(a - 1, n);
+  return n;
+}
+
+int f645(int a, int b) {
+  int c = a * 18 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 25)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f267(a - 1, n);
+  return n;
+}
+
+int f646(int a, int b) {
+  int c = a * 97 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f381(a - 1, n);
+  return n;
+}
+
+int f647(int a, int b) {
+  int c = a * 95 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f279(a - 1, n);
+  return n;
+}
+
+int f648(int a, int b) {
+  int c = a * 59 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 25)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f277(a - 1, n);
+  return n;
+}
+
+int f649(int a, int b) {
+  int c = a * 80 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f612(a - 1, n);
+  return n;
+}
+
+int f650(int a, int b) {
+  int c = a * 48 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 24)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f72(a - 1, n);
+  return n;
+}
+
+int f651(int a, int b) {
+  int c = a * 58 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f383(a - 1, n);
+  return n;
+}
+
+int f652(int a, int b) {
+  int c = a * 72 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f614(a - 1, n);
+  return n;
+}
+
+int f653(int a, int b) {
+  int c = a * 39 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f161(a - 1, n);
+  return n;
+}
+
+int f654(int a, int b) {
+  int c = a * 57 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1(a - 1, n);
+  return n;
+}
+
+int f655(int a, int b) {
+  int c = a * 72 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f528(a - 1, n);
+  return n;
+}
+
+int f656(int a, int b) {
+  int c = a * 64 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 25)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f534(a - 1, n);
+  return n;
+}
+
+int f657(int a, int b) {
+  int c = a * 0 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f481(a - 1, n);
+  return n;
+}
+
+int f658(int a, int b) {
+  int c = a * 16 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f174(a - 1, n);
+  return n;
+}
+
+int f659(int a, int b) {
+  int c = a * 70 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 3)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f320(a - 1, n);
+  return n;
+}
+
+int f660(int a, int b) {
+  int c = a * 26 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f426(a - 1, n);
+  return n;
+}
+
+int f661(int a, int b) {
+  int c = a * 10 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f514(a - 1, n);
+  return n;
+}
+
+int f662(int a, int b) {
+  int c = a * 31 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f291(a - 1, n);
+  return n;
+}
+
+int f663(int a, int b) {
+  int c = a * 33 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f389(a - 1, n);
+  return n;
+}
+
+int f664(int a, int b) {
+  int c = a * 12 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f360(a - 1, n);
+  return n;
+}
+
+int f665(int a, int b) {
+  int c = a * 25 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f420(a - 1, n);
+  return n;
+}
+
+int f666(int a, int b) {
+  int c = a * 6 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 34)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f556(a - 1, n);
+  return n;
+}
+
+int f667(int a, int b) {
+  int c = a * 33 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1(a - 1, n);
+  return n;
+}
+
+int f668(int a, int b) {
+  int c = a * 48 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f608(a - 1, n);
+  return n;
+}
+
+int f669(int a, int b) {
+  int c = a * 63 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f572(a - 1, n);
+  return n;
+}
+
+int f670(int a, int b) {
+  int c = a * 96 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f468(a - 1, n);
+  return n;
+}
+
+int f671(int a, int b) {
+  int c = a * 28 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f120(a - 1, n);
+  return n;
+}
+
+int f672(int a, int b) {
+  int c = a * 22 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f621(a - 1, n);
+  return n;
+}
+
+int f673(int a, int b) {
+  int c = a * 90 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f56(a - 1, n);
+  return n;
+}
+
+int f674(int a, int b) {
+  int c = a * 90 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 10)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f30(a - 1, n);
+  return n;
+}
+
+int f675(int a, int b) {
+  int c = a * 96 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f439(a - 1, n);
+  return n;
+}
+
+int f676(int a, int b) {
+  int c = a * 79 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f352(a - 1, n);
+  return n;
+}
+
+int f677(int a, int b) {
+  int c = a * 68 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f192(a - 1, n);
+  return n;
+}
+
+int f678(int a, int b) {
+  int c = a * 62 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 24)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f348(a - 1, n);
+  return n;
+}
+
+int f679(int a, int b) {
+  int c = a * 23 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f386(a - 1, n);
+  return n;
+}
+
+int f680(int a, int b) {
+  int c = a * 19 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 42)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f83(a - 1, n);
+  return n;
+}
+
+int f681(int a, int b) {
+  int c = a * 39 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 4)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f459(a - 1, n);
+  return n;
+}
+
+int f682(int a, int b) {
+  int c = a * 80 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f358(a - 1, n);
+  return n;
+}
+
+int f683(int a, int b) {
+  int c = a * 35 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f450(a - 1, n);
+  return n;
+}
+
+int f684(int a, int b) {
+  int c = a * 62 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f186(a - 1, n);
+  return n;
+}
+
+int f685(int a, int b) {
+  int c = a * 19 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f40(a - 1, n);
+  return n;
+}
+
+int f686(int a, int b) {
+  int c = a * 75 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 18)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f5(a - 1, n);
+  return n;
+}
+
+int f687(int a, int b) {
+  int c = a * 20 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f572(a - 1, n);
+  return n;
+}
+
+int f688(int a, int b) {
+  int c = a * 36 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f59(a - 1, n);
+  return n;
+}
+
+int f689(int a, int b) {
+  int c = a * 66 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f467(a - 1, n);
+  return n;
+}
+
+int f690(int a, int b) {
+  int c = a * 95 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f506(a - 1, n);
+  return n;
+}
+
+int f691(int a, int b) {
+  int c = a * 12 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f244(a - 1, n);
+  return n;
+}
+
+int f692(int a, int b) {
+  int c = a * 75 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f644(a - 1, n);
+  return n;
+}
+
+int f693(int a, int b) {
+  int c = a * 98 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 18)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f109(a - 1, n);
+  return n;
+}
+
+int f694(int a, int b) {
+  int c = a * 81 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f244(a - 1, n);
+  return n;
+}
+
+int f695(int a, int b) {
+  int c = a * 76 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f65(a - 1, n);
+  return n;
+}
+
+int f696(int a, int b) {
+  int c = a * 92 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f231(a - 1, n);
+  return n;
+}
+
+int f697(int a, int b) {
+  int c = a * 95 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 43)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f200(a - 1, n);
+  return n;
+}
+
+int f698(int a, int b) {
+  int c = a * 65 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f294(a - 1, n);
+  return n;
+}
+
+int f699(int a, int b) {
+  int c = a * 98 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f356(a - 1, n);
+  return n;
+}
+
+int f700(int a, int b) {
+  int c = a * 65 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f145(a - 1, n);
+  return n;
+}
+
+int f701(int a, int b) {
+  int c = a * 52 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f357(a - 1, n);
+  return n;
+}
+
+int f702(int a, int b) {
+  int c = a * 78 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f367(a - 1, n);
+  return n;
+}
+
+int f703(int a, int b) {
+  int c = a * 87 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 8)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f179(a - 1, n);
+  return n;
+}
+
+int f704(int a, int b) {
+  int c = a * 99 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 24)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f636(a - 1, n);
+  return n;
+}
+
+int f705(int a, int b) {
+  int c = a * 24 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f273(a - 1, n);
+  return n;
+}
+
+int f706(int a, int b) {
+  int c = a * 24 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f17(a - 1, n);
+  return n;
+}
+
+int f707(int a, int b) {
+  int c = a * 46 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f468(a - 1, n);
+  return n;
+}
+
+int f708(int a, int b) {
+  int c = a * 68 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f665(a - 1, n);
+  return n;
+}
+
+int f709(int a, int b) {
+  int c = a * 84 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f31(a - 1, n);
+  return n;
+}
+
+int f710(int a, int b) {
+  int c = a * 83 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f486(a - 1, n);
+  return n;
+}
+
+int f711(int a, int b) {
+  int c = a * 56 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f201(a - 1, n);
+  return n;
+}
+
+int f712(int a, int b) {
+  int c = a * 81 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f664(a - 1, n);
+  return n;
+}
+
+int f713(int a, int b) {
+  int c = a * 4 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f621(a - 1, n);
+  return n;
+}
+
+int f714(int a, int b) {
+  int c = a * 80 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 18)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f159(a - 1, n);
+  return n;
+}
+
+int f715(int a, int b) {
+  int c = a * 53 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f87(a - 1, n);
+  return n;
+}
+
+int f716(int a, int b) {
+  int c = a * 75 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f633(a - 1, n);
+  return n;
+}
+
+int f717(int a, int b) {
+  int c = a * 6 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f438(a - 1, n);
+  return n;
+}
+
+int f718(int a, int b) {
+  int c = a * 27 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f580(a - 1, n);
+  return n;
+}
+
+int f719(int a, int b) {
+  int c = a * 2 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f580(a - 1, n);
+  return n;
+}
+
+int f720(int a, int b) {
+  int c = a * 62 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f436(a - 1, n);
+  return n;
+}
+
+int f721(int a, int b) {
+  int c = a * 70 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f601(a - 1, n);
+  return n;
+}
+
+int f722(int a, int b) {
+  int c = a * 17 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 4)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f717(a - 1, n);
+  return n;
+}
+
+int f723(int a, int b) {
+  int c = a * 2 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f258(a - 1, n);
+  return n;
+}
+
+int f724(int a, int b) {
+  int c = a * 26 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f40(a - 1, n);
+  return n;
+}
+
+int f725(int a, int b) {
+  int c = a * 82 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f188(a - 1, n);
+  return n;
+}
+
+int f726(int a, int b) {
+  int c = a * 30 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f357(a - 1, n);
+  return n;
+}
+
+int f727(int a, int b) {
+  int c = a * 27 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f524(a - 1, n);
+  return n;
+}
+
+int f728(int a, int b) {
+  int c = a * 39 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f623(a - 1, n);
+  return n;
+}
+
+int f729(int a, int b) {
+  int c = a * 98 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f542(a - 1, n);
+  return n;
+}
+
+int f730(int a, int b) {
+  int c = a * 8 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f541(a - 1, n);
+  return n;
+}
+
+int f731(int a, int b) {
+  int c = a * 96 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f627(a - 1, n);
+  return n;
+}
+
+int f732(int a, int b) {
+  int c = a * 7 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f472(a - 1, n);
+  return n;
+}
+
+int f733(int a, int b) {
+  int c = a * 62 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 8)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f417(a - 1, n);
+  return n;
+}
+
+int f734(int a, int b) {
+  int c = a * 46 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f521(a - 1, n);
+  return n;
+}
+
+int f735(int a, int b) {
+  int c = a * 4 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f292(a - 1, n);
+  return n;
+}
+
+int f736(int a, int b) {
+  int c = a * 64 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 4)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f570(a - 1, n);
+  return n;
+}
+
+int f737(int a, int b) {
+  int c = a * 5 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f481(a - 1, n);
+  return n;
+}
+
+int f738(int a, int b) {
+  int c = a * 55 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f357(a - 1, n);
+  return n;
+}
+
+int f739(int a, int b) {
+  int c = a * 68 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 27)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f464(a - 1, n);
+  return n;
+}
+
+int f740(int a, int b) {
+  int c = a * 15 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f114(a - 1, n);
+  return n;
+}
+
+int f741(int a, int b) {
+  int c = a * 10 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f164(a - 1, n);
+  return n;
+}
+
+int f742(int a, int b) {
+  int c = a * 49 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f257(a - 1, n);
+  return n;
+}
+
+int f743(int a, int b) {
+  int c = a * 42 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f331(a - 1, n);
+  return n;
+}
+
+int f744(int a, int b) {
+  int c = a * 52 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f656(a - 1, n);
+  return n;
+}
+
+int f745(int a, int b) {
+  int c = a * 13 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f615(a - 1, n);
+  return n;
+}
+
+int f746(int a, int b) {
+  int c = a * 30 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f436(a - 1, n);
+  return n;
+}
+
+int f747(int a, int b) {
+  int c = a * 56 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f463(a - 1, n);
+  return n;
+}
+
+int f748(int a, int b) {
+  int c = a * 68 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f190(a - 1, n);
+  return n;
+}
+
+int f749(int a, int b) {
+  int c = a * 46 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f675(a - 1, n);
+  return n;
+}
+
+int f750(int a, int b) {
+  int c = a * 61 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f218(a - 1, n);
+  return n;
+}
+
+int f751(int a, int b) {
+  int c = a * 31 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f540(a - 1, n);
+  return n;
+}
+
+int f752(int a, int b) {
+  int c = a * 32 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 34)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f297(a - 1, n);
+  return n;
+}
+
+int f753(int a, int b) {
+  int c = a * 81 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f215(a - 1, n);
+  return n;
+}
+
+int f754(int a, int b) {
+  int c = a * 70 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f396(a - 1, n);
+  return n;
+}
+
+int f755(int a, int b) {
+  int c = a * 65 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f77(a - 1, n);
+  return n;
+}
+
+int f756(int a, int b) {
+  int c = a * 99 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f50(a - 1, n);
+  return n;
+}
+
+int f757(int a, int b) {
+  int c = a * 5 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f753(a - 1, n);
+  return n;
+}
+
+int f758(int a, int b) {
+  int c = a * 89 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f259(a - 1, n);
+  return n;
+}
+
+int f759(int a, int b) {
+  int c = a * 8 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f75(a - 1, n);
+  return n;
+}
+
+int f760(int a, int b) {
+  int c = a * 93 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f94(a - 1, n);
+  return n;
+}
+
+int f761(int a, int b) {
+  int c = a * 93 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f85(a - 1, n);
+  return n;
+}
+
+int f762(int a, int b) {
+  int c = a * 93 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f687(a - 1, n);
+  return n;
+}
+
+int f763(int a, int b) {
+  int c = a * 34 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f318(a - 1, n);
+  return n;
+}
+
+int f764(int a, int b) {
+  int c = a * 56 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f699(a - 1, n);
+  return n;
+}
+
+int f765(int a, int b) {
+  int c = a * 58 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f703(a - 1, n);
+  return n;
+}
+
+int f766(int a, int b) {
+  int c = a * 51 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f759(a - 1, n);
+  return n;
+}
+
+int f767(int a, int b) {
+  int c = a * 47 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f603(a - 1, n);
+  return n;
+}
+
+int f768(int a, int b) {
+  int c = a * 64 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 36)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f241(a - 1, n);
+  return n;
+}
+
+int f769(int a, int b) {
+  int c = a * 27 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f54(a - 1, n);
+  return n;
+}
+
+int f770(int a, int b) {
+  int c = a * 43 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f52(a - 1, n);
+  return n;
+}
+
+int f771(int a, int b) {
+  int c = a * 88 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f74(a - 1, n);
+  return n;
+}
+
+int f772(int a, int b) {
+  int c = a * 1 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1(a - 1, n);
+  return n;
+}
+
+int f773(int a, int b) {
+  int c = a * 12 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f46(a - 1, n);
+  return n;
+}
+
+int f774(int a, int b) {
+  int c = a * 5 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 42)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f753(a - 1, n);
+  return n;
+}
+
+int f775(int a, int b) {
+  int c = a * 72 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f687(a - 1, n);
+  return n;
+}
+
+int f776(int a, int b) {
+  int c = a * 70 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f576(a - 1, n);
+  return n;
+}
+
+int f777(int a, int b) {
+  int c = a * 83 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f88(a - 1, n);
+  return n;
+}
+
+int f778(int a, int b) {
+  int c = a * 40 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f701(a - 1, n);
+  return n;
+}
+
+int f779(int a, int b) {
+  int c = a * 20 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 19)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f444(a - 1, n);
+  return n;
+}
+
+int f780(int a, int b) {
+  int c = a * 66 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f59(a - 1, n);
+  return n;
+}
+
+int f781(int a, int b) {
+  int c = a * 68 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f611(a - 1, n);
+  return n;
+}
+
+int f782(int a, int b) {
+  int c = a * 2 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f618(a - 1, n);
+  return n;
+}
+
+int f783(int a, int b) {
+  int c = a * 88 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f387(a - 1, n);
+  return n;
+}
+
+int f784(int a, int b) {
+  int c = a * 11 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f25(a - 1, n);
+  return n;
+}
+
+int f785(int a, int b) {
+  int c = a * 74 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f399(a - 1, n);
+  return n;
+}
+
+int f786(int a, int b) {
+  int c = a * 51 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f726(a - 1, n);
+  return n;
+}
+
+int f787(int a, int b) {
+  int c = a * 3 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f19(a - 1, n);
+  return n;
+}
+
+int f788(int a, int b) {
+  int c = a * 42 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f128(a - 1, n);
+  return n;
+}
+
+int f789(int a, int b) {
+  int c = a * 72 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 34)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f628(a - 1, n);
+  return n;
+}
+
+int f790(int a, int b) {
+  int c = a * 62 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f523(a - 1, n);
+  return n;
+}
+
+int f791(int a, int b) {
+  int c = a * 24 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 8)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f103(a - 1, n);
+  return n;
+}
+
+int f792(int a, int b) {
+  int c = a * 90 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f481(a - 1, n);
+  return n;
+}
+
+int f793(int a, int b) {
+  int c = a * 34 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f114(a - 1, n);
+  return n;
+}
+
+int f794(int a, int b) {
+  int c = a * 53 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f51(a - 1, n);
+  return n;
+}
+
+int f795(int a, int b) {
+  int c = a * 2 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f81(a - 1, n);
+  return n;
+}
+
+int f796(int a, int b) {
+  int c = a * 31 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f49(a - 1, n);
+  return n;
+}
+
+int f797(int a, int b) {
+  int c = a * 1 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f594(a - 1, n);
+  return n;
+}
+
+int f798(int a, int b) {
+  int c = a * 54 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 18)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f318(a - 1, n);
+  return n;
+}
+
+int f799(int a, int b) {
+  int c = a * 99 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f437(a - 1, n);
+  return n;
+}
+
+int f800(int a, int b) {
+  int c = a * 20 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f505(a - 1, n);
+  return n;
+}
+
+int f801(int a, int b) {
+  int c = a * 44 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f605(a - 1, n);
+  return n;
+}
+
+int f802(int a, int b) {
+  int c = a * 36 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 8)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f660(a - 1, n);
+  return n;
+}
+
+int f803(int a, int b) {
+  int c = a * 82 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f740(a - 1, n);
+  return n;
+}
+
+int f804(int a, int b) {
+  int c = a * 55 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f465(a - 1, n);
+  return n;
+}
+
+int f805(int a, int b) {
+  int c = a * 20 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 8)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f41(a - 1, n);
+  return n;
+}
+
+int f806(int a, int b) {
+  int c = a * 45 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 19)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f399(a - 1, n);
+  return n;
+}
+
+int f807(int a, int b) {
+  int c = a * 47 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f297(a - 1, n);
+  return n;
+}
+
+int f808(int a, int b) {
+  int c = a * 54 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f553(a - 1, n);
+  return n;
+}
+
+int f809(int a, int b) {
+  int c = a * 88 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f122(a - 1, n);
+  return n;
+}
+
+int f810(int a, int b) {
+  int c = a * 58 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f729(a - 1, n);
+  return n;
+}
+
+int f811(int a, int b) {
+  int c = a * 55 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f784(a - 1, n);
+  return n;
+}
+
+int f812(int a, int b) {
+  int c = a * 25 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f479(a - 1, n);
+  return n;
+}
+
+int f813(int a, int b) {
+  int c = a * 3 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f59(a - 1, n);
+  return n;
+}
+
+int f814(int a, int b) {
+  int c = a * 29 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f0(a - 1, n);
+  return n;
+}
+
+int f815(int a, int b) {
+  int c = a * 37 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f168(a - 1, n);
+  return n;
+}
+
+int f816(int a, int b) {
+  int c = a * 51 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f416(a - 1, n);
+  return n;
+}
+
+int f817(int a, int b) {
+  int c = a * 4 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f704(a - 1, n);
+  return n;
+}
+
+int f818(int a, int b) {
+  int c = a * 41 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f764(a - 1, n);
+  return n;
+}
+
+int f819(int a, int b) {
+  int c = a * 27 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f751(a - 1, n);
+  return n;
+}
+
+int f820(int a, int b) {
+  int c = a * 77 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f206(a - 1, n);
+  return n;
+}
+
+int f821(int a, int b) {
+  int c = a * 96 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f5(a - 1, n);
+  return n;
+}
+
+int f822(int a, int b) {
+  int c = a * 27 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f70(a - 1, n);
+  return n;
+}
+
+int f823(int a, int b) {
+  int c = a * 47 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f775(a - 1, n);
+  return n;
+}
+
+int f824(int a, int b) {
+  int c = a * 77 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 34)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f405(a - 1, n);
+  return n;
+}
+
+int f825(int a, int b) {
+  int c = a * 94 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f743(a - 1, n);
+  return n;
+}
+
+int f826(int a, int b) {
+  int c = a * 93 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f766(a - 1, n);
+  return n;
+}
+
+int f827(int a, int b) {
+  int c = a * 72 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f68(a - 1, n);
+  return n;
+}
+
+int f828(int a, int b) {
+  int c = a * 6 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f503(a - 1, n);
+  return n;
+}
+
+int f829(int a, int b) {
+  int c = a * 32 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f270(a - 1, n);
+  return n;
+}
+
+int f830(int a, int b) {
+  int c = a * 2 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 24)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f53(a - 1, n);
+  return n;
+}
+
+int f831(int a, int b) {
+  int c = a * 66 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f187(a - 1, n);
+  return n;
+}
+
+int f832(int a, int b) {
+  int c = a * 33 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f240(a - 1, n);
+  return n;
+}
+
+int f833(int a, int b) {
+  int c = a * 12 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 3)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f696(a - 1, n);
+  return n;
+}
+
+int f834(int a, int b) {
+  int c = a * 78 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f713(a - 1, n);
+  return n;
+}
+
+int f835(int a, int b) {
+  int c = a * 54 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f486(a - 1, n);
+  return n;
+}
+
+int f836(int a, int b) {
+  int c = a * 31 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 10)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f803(a - 1, n);
+  return n;
+}
+
+int f837(int a, int b) {
+  int c = a * 15 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f374(a - 1, n);
+  return n;
+}
+
+int f838(int a, int b) {
+  int c = a * 64 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f688(a - 1, n);
+  return n;
+}
+
+int f839(int a, int b) {
+  int c = a * 97 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f666(a - 1, n);
+  return n;
+}
+
+int f840(int a, int b) {
+  int c = a * 52 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f534(a - 1, n);
+  return n;
+}
+
+int f841(int a, int b) {
+  int c = a * 99 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f642(a - 1, n);
+  return n;
+}
+
+int f842(int a, int b) {
+  int c = a * 17 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 8)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f657(a - 1, n);
+  return n;
+}
+
+int f843(int a, int b) {
+  int c = a * 10 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f214(a - 1, n);
+  return n;
+}
+
+int f844(int a, int b) {
+  int c = a * 65 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f568(a - 1, n);
+  return n;
+}
+
+int f845(int a, int b) {
+  int c = a * 97 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f821(a - 1, n);
+  return n;
+}
+
+int f846(int a, int b) {
+  int c = a * 61 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 27)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f790(a - 1, n);
+  return n;
+}
+
+int f847(int a, int b) {
+  int c = a * 89 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f315(a - 1, n);
+  return n;
+}
+
+int f848(int a, int b) {
+  int c = a * 89 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f386(a - 1, n);
+  return n;
+}
+
+int f849(int a, int b) {
+  int c = a * 80 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f450(a - 1, n);
+  return n;
+}
+
+int f850(int a, int b) {
+  int c = a * 54 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 19)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f60(a - 1, n);
+  return n;
+}
+
+int f851(int a, int b) {
+  int c = a * 60 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f610(a - 1, n);
+  return n;
+}
+
+int f852(int a, int b) {
+  int c = a * 3 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f382(a - 1, n);
+  return n;
+}
+
+int f853(int a, int b) {
+  int c = a * 19 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f330(a - 1, n);
+  return n;
+}
+
+int f854(int a, int b) {
+  int c = a * 37 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f198(a - 1, n);
+  return n;
+}
+
+int f855(int a, int b) {
+  int c = a * 71 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f846(a - 1, n);
+  return n;
+}
+
+int f856(int a, int b) {
+  int c = a * 52 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f497(a - 1, n);
+  return n;
+}
+
+int f857(int a, int b) {
+  int c = a * 5 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f745(a - 1, n);
+  return n;
+}
+
+int f858(int a, int b) {
+  int c = a * 31 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 19)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f137(a - 1, n);
+  return n;
+}
+
+int f859(int a, int b) {
+  int c = a * 35 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f588(a - 1, n);
+  return n;
+}
+
+int f860(int a, int b) {
+  int c = a * 38 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f727(a - 1, n);
+  return n;
+}
+
+int f861(int a, int b) {
+  int c = a * 88 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f20(a - 1, n);
+  return n;
+}
+
+int f862(int a, int b) {
+  int c = a * 62 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f678(a - 1, n);
+  return n;
+}
+
+int f863(int a, int b) {
+  int c = a * 82 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f474(a - 1, n);
+  return n;
+}
+
+int f864(int a, int b) {
+  int c = a * 48 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f257(a - 1, n);
+  return n;
+}
+
+int f865(int a, int b) {
+  int c = a * 30 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 10)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f371(a - 1, n);
+  return n;
+}
+
+int f866(int a, int b) {
+  int c = a * 0 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f220(a - 1, n);
+  return n;
+}
+
+int f867(int a, int b) {
+  int c = a * 87 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f725(a - 1, n);
+  return n;
+}
+
+int f868(int a, int b) {
+  int c = a * 55 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 3)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f842(a - 1, n);
+  return n;
+}
+
+int f869(int a, int b) {
+  int c = a * 96 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 24)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f754(a - 1, n);
+  return n;
+}
+
+int f870(int a, int b) {
+  int c = a * 39 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f339(a - 1, n);
+  return n;
+}
+
+int f871(int a, int b) {
+  int c = a * 44 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f598(a - 1, n);
+  return n;
+}
+
+int f872(int a, int b) {
+  int c = a * 5 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f265(a - 1, n);
+  return n;
+}
+
+int f873(int a, int b) {
+  int c = a * 69 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f277(a - 1, n);
+  return n;
+}
+
+int f874(int a, int b) {
+  int c = a * 4 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 8)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f541(a - 1, n);
+  return n;
+}
+
+int f875(int a, int b) {
+  int c = a * 28 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f212(a - 1, n);
+  return n;
+}
+
+int f876(int a, int b) {
+  int c = a * 60 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f256(a - 1, n);
+  return n;
+}
+
+int f877(int a, int b) {
+  int c = a * 4 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f88(a - 1, n);
+  return n;
+}
+
+int f878(int a, int b) {
+  int c = a * 34 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f672(a - 1, n);
+  return n;
+}
+
+int f879(int a, int b) {
+  int c = a * 62 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f758(a - 1, n);
+  return n;
+}
+
+int f880(int a, int b) {
+  int c = a * 30 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f606(a - 1, n);
+  return n;
+}
+
+int f881(int a, int b) {
+  int c = a * 62 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f602(a - 1, n);
+  return n;
+}
+
+int f882(int a, int b) {
+  int c = a * 66 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 34)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f526(a - 1, n);
+  return n;
+}
+
+int f883(int a, int b) {
+  int c = a * 31 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f411(a - 1, n);
+  return n;
+}
+
+int f884(int a, int b) {
+  int c = a * 84 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f812(a - 1, n);
+  return n;
+}
+
+int f885(int a, int b) {
+  int c = a * 43 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f483(a - 1, n);
+  return n;
+}
+
+int f886(int a, int b) {
+  int c = a * 57 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 36)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f628(a - 1, n);
+  return n;
+}
+
+int f887(int a, int b) {
+  int c = a * 75 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f189(a - 1, n);
+  return n;
+}
+
+int f888(int a, int b) {
+  int c = a * 4 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f150(a - 1, n);
+  return n;
+}
+
+int f889(int a, int b) {
+  int c = a * 68 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f575(a - 1, n);
+  return n;
+}
+
+int f890(int a, int b) {
+  int c = a * 13 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f53(a - 1, n);
+  return n;
+}
+
+int f891(int a, int b) {
+  int c = a * 62 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f663(a - 1, n);
+  return n;
+}
+
+int f892(int a, int b) {
+  int c = a * 61 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f245(a - 1, n);
+  return n;
+}
+
+int f893(int a, int b) {
+  int c = a * 11 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f467(a - 1, n);
+  return n;
+}
+
+int f894(int a, int b) {
+  int c = a * 64 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 36)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f86(a - 1, n);
+  return n;
+}
+
+int f895(int a, int b) {
+  int c = a * 36 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f761(a - 1, n);
+  return n;
+}
+
+int f896(int a, int b) {
+  int c = a * 31 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f31(a - 1, n);
+  return n;
+}
+
+int f897(int a, int b) {
+  int c = a * 42 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 36)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f329(a - 1, n);
+  return n;
+}
+
+int f898(int a, int b) {
+  int c = a * 1 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 10)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f483(a - 1, n);
+  return n;
+}
+
+int f899(int a, int b) {
+  int c = a * 4 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f707(a - 1, n);
+  return n;
+}
+
+int f900(int a, int b) {
+  int c = a * 18 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 25)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f298(a - 1, n);
+  return n;
+}
+
+int f901(int a, int b) {
+  int c = a * 16 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f317(a - 1, n);
+  return n;
+}
+
+int f902(int a, int b) {
+  int c = a * 41 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f258(a - 1, n);
+  return n;
+}
+
+int f903(int a, int b) {
+  int c = a * 1 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f550(a - 1, n);
+  return n;
+}
+
+int f904(int a, int b) {
+  int c = a * 22 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f250(a - 1, n);
+  return n;
+}
+
+int f905(int a, int b) {
+  int c = a * 4 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f428(a - 1, n);
+  return n;
+}
+
+int f906(int a, int b) {
+  int c = a * 22 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f475(a - 1, n);
+  return n;
+}
+
+int f907(int a, int b) {
+  int c = a * 70 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f39(a - 1, n);
+  return n;
+}
+
+int f908(int a, int b) {
+  int c = a * 25 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f463(a - 1, n);
+  return n;
+}
+
+int f909(int a, int b) {
+  int c = a * 47 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f206(a - 1, n);
+  return n;
+}
+
+int f910(int a, int b) {
+  int c = a * 45 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f511(a - 1, n);
+  return n;
+}
+
+int f911(int a, int b) {
+  int c = a * 32 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f240(a - 1, n);
+  return n;
+}
+
+int f912(int a, int b) {
+  int c = a * 76 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f269(a - 1, n);
+  return n;
+}
+
+int f913(int a, int b) {
+  int c = a * 95 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f214(a - 1, n);
+  return n;
+}
+
+int f914(int a, int b) {
+  int c = a * 38 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f537(a - 1, n);
+  return n;
+}
+
+int f915(int a, int b) {
+  int c = a * 5 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 8)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f712(a - 1, n);
+  return n;
+}
+
+int f916(int a, int b) {
+  int c = a * 22 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f714(a - 1, n);
+  return n;
+}
+
+int f917(int a, int b) {
+  int c = a * 54 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f830(a - 1, n);
+  return n;
+}
+
+int f918(int a, int b) {
+  int c = a * 96 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f547(a - 1, n);
+  return n;
+}
+
+int f919(int a, int b) {
+  int c = a * 81 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 43)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f315(a - 1, n);
+  return n;
+}
+
+int f920(int a, int b) {
+  int c = a * 71 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f535(a - 1, n);
+  return n;
+}
+
+int f921(int a, int b) {
+  int c = a * 53 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f780(a - 1, n);
+  return n;
+}
+
+int f922(int a, int b) {
+  int c = a * 56 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f885(a - 1, n);
+  return n;
+}
+
+int f923(int a, int b) {
+  int c = a * 60 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f138(a - 1, n);
+  return n;
+}
+
+int f924(int a, int b) {
+  int c = a * 53 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f417(a - 1, n);
+  return n;
+}
+
+int f925(int a, int b) {
+  int c = a * 70 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f570(a - 1, n);
+  return n;
+}
+
+int f926(int a, int b) {
+  int c = a * 41 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 4)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f528(a - 1, n);
+  return n;
+}
+
+int f927(int a, int b) {
+  int c = a * 24 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f330(a - 1, n);
+  return n;
+}
+
+int f928(int a, int b) {
+  int c = a * 27 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f263(a - 1, n);
+  return n;
+}
+
+int f929(int a, int b) {
+  int c = a * 19 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 10)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f514(a - 1, n);
+  return n;
+}
+
+int f930(int a, int b) {
+  int c = a * 53 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f289(a - 1, n);
+  return n;
+}
+
+int f931(int a, int b) {
+  int c = a * 50 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f346(a - 1, n);
+  return n;
+}
+
+int f932(int a, int b) {
+  int c = a * 68 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f891(a - 1, n);
+  return n;
+}
+
+int f933(int a, int b) {
+  int c = a * 48 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f387(a - 1, n);
+  return n;
+}
+
+int f934(int a, int b) {
+  int c = a * 5 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f904(a - 1, n);
+  return n;
+}
+
+int f935(int a, int b) {
+  int c = a * 99 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f685(a - 1, n);
+  return n;
+}
+
+int f936(int a, int b) {
+  int c = a * 86 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f425(a - 1, n);
+  return n;
+}
+
+int f937(int a, int b) {
+  int c = a * 66 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 3)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f70(a - 1, n);
+  return n;
+}
+
+int f938(int a, int b) {
+  int c = a * 97 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f696(a - 1, n);
+  return n;
+}
+
+int f939(int a, int b) {
+  int c = a * 63 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f368(a - 1, n);
+  return n;
+}
+
+int f940(int a, int b) {
+  int c = a * 66 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f277(a - 1, n);
+  return n;
+}
+
+int f941(int a, int b) {
+  int c = a * 79 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f573(a - 1, n);
+  return n;
+}
+
+int f942(int a, int b) {
+  int c = a * 73 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f882(a - 1, n);
+  return n;
+}
+
+int f943(int a, int b) {
+  int c = a * 94 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f168(a - 1, n);
+  return n;
+}
+
+int f944(int a, int b) {
+  int c = a * 2 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 10)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f800(a - 1, n);
+  return n;
+}
+
+int f945(int a, int b) {
+  int c = a * 50 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f69(a - 1, n);
+  return n;
+}
+
+int f946(int a, int b) {
+  int c = a * 83 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f789(a - 1, n);
+  return n;
+}
+
+int f947(int a, int b) {
+  int c = a * 59 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f324(a - 1, n);
+  return n;
+}
+
+int f948(int a, int b) {
+  int c = a * 33 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 27)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f492(a - 1, n);
+  return n;
+}
+
+int f949(int a, int b) {
+  int c = a * 57 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f114(a - 1, n);
+  return n;
+}
+
+int f950(int a, int b) {
+  int c = a * 12 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f857(a - 1, n);
+  return n;
+}
+
+int f951(int a, int b) {
+  int c = a * 26 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f696(a - 1, n);
+  return n;
+}
+
+int f952(int a, int b) {
+  int c = a * 46 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 36)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f882(a - 1, n);
+  return n;
+}
+
+int f953(int a, int b) {
+  int c = a * 96 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f246(a - 1, n);
+  return n;
+}
+
+int f954(int a, int b) {
+  int c = a * 69 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 19)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f809(a - 1, n);
+  return n;
+}
+
+int f955(int a, int b) {
+  int c = a * 79 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f23(a - 1, n);
+  return n;
+}
+
+int f956(int a, int b) {
+  int c = a * 34 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f820(a - 1, n);
+  return n;
+}
+
+int f957(int a, int b) {
+  int c = a * 97 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f520(a - 1, n);
+  return n;
+}
+
+int f958(int a, int b) {
+  int c = a * 26 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f481(a - 1, n);
+  return n;
+}
+
+int f959(int a, int b) {
+  int c = a * 65 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f769(a - 1, n);
+  return n;
+}
+
+int f960(int a, int b) {
+  int c = a * 79 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f577(a - 1, n);
+  return n;
+}
+
+int f961(int a, int b) {
+  int c = a * 44 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f341(a - 1, n);
+  return n;
+}
+
+int f962(int a, int b) {
+  int c = a * 27 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f473(a - 1, n);
+  return n;
+}
+
+int f963(int a, int b) {
+  int c = a * 27 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 36)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f334(a - 1, n);
+  return n;
+}
+
+int f964(int a, int b) {
+  int c = a * 62 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 19)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f153(a - 1, n);
+  return n;
+}
+
+int f965(int a, int b) {
+  int c = a * 47 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f358(a - 1, n);
+  return n;
+}
+
+int f966(int a, int b) {
+  int c = a * 72 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1(a - 1, n);
+  return n;
+}
+
+int f967(int a, int b) {
+  int c = a * 7 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f658(a - 1, n);
+  return n;
+}
+
+int f968(int a, int b) {
+  int c = a * 78 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f311(a - 1, n);
+  return n;
+}
+
+int f969(int a, int b) {
+  int c = a * 1 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f738(a - 1, n);
+  return n;
+}
+
+int f970(int a, int b) {
+  int c = a * 15 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 18)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f659(a - 1, n);
+  return n;
+}
+
+int f971(int a, int b) {
+  int c = a * 61 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f399(a - 1, n);
+  return n;
+}
+
+int f972(int a, int b) {
+  int c = a * 23 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f351(a - 1, n);
+  return n;
+}
+
+int f973(int a, int b) {
+  int c = a * 7 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f549(a - 1, n);
+  return n;
+}
+
+int f974(int a, int b) {
+  int c = a * 13 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f208(a - 1, n);
+  return n;
+}
+
+int f975(int a, int b) {
+  int c = a * 2 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f403(a - 1, n);
+  return n;
+}
+
+int f976(int a, int b) {
+  int c = a * 90 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 25)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f374(a - 1, n);
+  return n;
+}
+
+int f977(int a, int b) {
+  int c = a * 10 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 8)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f98(a - 1, n);
+  return n;
+}
+
+int f978(int a, int b) {
+  int c = a * 23 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 8)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f881(a - 1, n);
+  return n;
+}
+
+int f979(int a, int b) {
+  int c = a * 3 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f736(a - 1, n);
+  return n;
+}
+
+int f980(int a, int b) {
+  int c = a * 52 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f440(a - 1, n);
+  return n;
+}
+
+int f981(int a, int b) {
+  int c = a * 28 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f37(a - 1, n);
+  return n;
+}
+
+int f982(int a, int b) {
+  int c = a * 97 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f524(a - 1, n);
+  return n;
+}
+
+int f983(int a, int b) {
+  int c = a * 46 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f532(a - 1, n);
+  return n;
+}
+
+int f984(int a, int b) {
+  int c = a * 35 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f829(a - 1, n);
+  return n;
+}
+
+int f985(int a, int b) {
+  int c = a * 54 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f648(a - 1, n);
+  return n;
+}
+
+int f986(int a, int b) {
+  int c = a * 35 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f523(a - 1, n);
+  return n;
+}
+
+int f987(int a, int b) {
+  int c = a * 72 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f981(a - 1, n);
+  return n;
+}
+
+int f988(int a, int b) {
+  int c = a * 83 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f77(a - 1, n);
+  return n;
+}
+
+int f989(int a, int b) {
+  int c = a * 71 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f670(a - 1, n);
+  return n;
+}
+
+int f990(int a, int b) {
+  int c = a * 79 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f153(a - 1, n);
+  return n;
+}
+
+int f991(int a, int b) {
+  int c = a * 19 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f100(a - 1, n);
+  return n;
+}
+
+int f992(int a, int b) {
+  int c = a * 8 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f640(a - 1, n);
+  return n;
+}
+
+int f993(int a, int b) {
+  int c = a * 98 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 10)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f454(a - 1, n);
+  return n;
+}
+
+int f994(int a, int b) {
+  int c = a * 98 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 4)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f156(a - 1, n);
+  return n;
+}
+
+int f995(int a, int b) {
+  int c = a * 95 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 36)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f556(a - 1, n);
+  return n;
+}
+
+int f996(int a, int b) {
+  int c = a * 3 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f244(a - 1, n);
+  return n;
+}
+
+int f997(int a, int b) {
+  int c = a * 41 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f651(a - 1, n);
+  return n;
+}
+
+int f998(int a, int b) {
+  int c = a * 17 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f384(a - 1, n);
+  return n;
+}
+
+int f999(int a, int b) {
+  int c = a * 27 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 43)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f450(a - 1, n);
+  return n;
+}
+
+int f1000(int a, int b) {
+  int c = a * 11 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f50(a - 1, n);
+  return n;
+}
+
+int f1001(int a, int b) {
+  int c = a * 43 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f619(a - 1, n);
+  return n;
+}
+
+int f1002(int a, int b) {
+  int c = a * 99 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f334(a - 1, n);
+  return n;
+}
+
+int f1003(int a, int b) {
+  int c = a * 97 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f488(a - 1, n);
+  return n;
+}
+
+int f1004(int a, int b) {
+  int c = a * 29 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f325(a - 1, n);
+  return n;
+}
+
+int f1005(int a, int b) {
+  int c = a * 33 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f698(a - 1, n);
+  return n;
+}
+
+int f1006(int a, int b) {
+  int c = a * 48 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f825(a - 1, n);
+  return n;
+}
+
+int f1007(int a, int b) {
+  int c = a * 59 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f787(a - 1, n);
+  return n;
+}
+
+int f1008(int a, int b) {
+  int c = a * 28 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f916(a - 1, n);
+  return n;
+}
+
+int f1009(int a, int b) {
+  int c = a * 97 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f965(a - 1, n);
+  return n;
+}
+
+int f1010(int a, int b) {
+  int c = a * 61 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f355(a - 1, n);
+  return n;
+}
+
+int f1011(int a, int b) {
+  int c = a * 29 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f148(a - 1, n);
+  return n;
+}
+
+int f1012(int a, int b) {
+  int c = a * 58 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f237(a - 1, n);
+  return n;
+}
+
+int f1013(int a, int b) {
+  int c = a * 40 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f215(a - 1, n);
+  return n;
+}
+
+int f1014(int a, int b) {
+  int c = a * 50 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 18)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f424(a - 1, n);
+  return n;
+}
+
+int f1015(int a, int b) {
+  int c = a * 90 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f302(a - 1, n);
+  return n;
+}
+
+int f1016(int a, int b) {
+  int c = a * 30 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f474(a - 1, n);
+  return n;
+}
+
+int f1017(int a, int b) {
+  int c = a * 72 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f637(a - 1, n);
+  return n;
+}
+
+int f1018(int a, int b) {
+  int c = a * 42 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f31(a - 1, n);
+  return n;
+}
+
+int f1019(int a, int b) {
+  int c = a * 52 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 4)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f458(a - 1, n);
+  return n;
+}
+
+int f1020(int a, int b) {
+  int c = a * 21 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 18)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f517(a - 1, n);
+  return n;
+}
+
+int f1021(int a, int b) {
+  int c = a * 3 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 8)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f227(a - 1, n);
+  return n;
+}
+
+int f1022(int a, int b) {
+  int c = a * 7 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f170(a - 1, n);
+  return n;
+}
+
+int f1023(int a, int b) {
+  int c = a * 85 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f188(a - 1, n);
+  return n;
+}
+
+int f1024(int a, int b) {
+  int c = a * 5 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f702(a - 1, n);
+  return n;
+}
+
+int f1025(int a, int b) {
+  int c = a * 19 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f435(a - 1, n);
+  return n;
+}
+
+int f1026(int a, int b) {
+  int c = a * 77 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f146(a - 1, n);
+  return n;
+}
+
+int f1027(int a, int b) {
+  int c = a * 35 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 18)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f257(a - 1, n);
+  return n;
+}
+
+int f1028(int a, int b) {
+  int c = a * 84 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 25)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f268(a - 1, n);
+  return n;
+}
+
+int f1029(int a, int b) {
+  int c = a * 37 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f54(a - 1, n);
+  return n;
+}
+
+int f1030(int a, int b) {
+  int c = a * 57 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f449(a - 1, n);
+  return n;
+}
+
+int f1031(int a, int b) {
+  int c = a * 73 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f151(a - 1, n);
+  return n;
+}
+
+int f1032(int a, int b) {
+  int c = a * 72 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 42)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f870(a - 1, n);
+  return n;
+}
+
+int f1033(int a, int b) {
+  int c = a * 53 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f948(a - 1, n);
+  return n;
+}
+
+int f1034(int a, int b) {
+  int c = a * 59 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 42)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1017(a - 1, n);
+  return n;
+}
+
+int f1035(int a, int b) {
+  int c = a * 18 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f590(a - 1, n);
+  return n;
+}
+
+int f1036(int a, int b) {
+  int c = a * 88 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f408(a - 1, n);
+  return n;
+}
+
+int f1037(int a, int b) {
+  int c = a * 30 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 4)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f117(a - 1, n);
+  return n;
+}
+
+int f1038(int a, int b) {
+  int c = a * 5 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f585(a - 1, n);
+  return n;
+}
+
+int f1039(int a, int b) {
+  int c = a * 94 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f867(a - 1, n);
+  return n;
+}
+
+int f1040(int a, int b) {
+  int c = a * 74 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f572(a - 1, n);
+  return n;
+}
+
+int f1041(int a, int b) {
+  int c = a * 57 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f695(a - 1, n);
+  return n;
+}
+
+int f1042(int a, int b) {
+  int c = a * 76 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f947(a - 1, n);
+  return n;
+}
+
+int f1043(int a, int b) {
+  int c = a * 3 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 4)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f107(a - 1, n);
+  return n;
+}
+
+int f1044(int a, int b) {
+  int c = a * 13 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f181(a - 1, n);
+  return n;
+}
+
+int f1045(int a, int b) {
+  int c = a * 54 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f8(a - 1, n);
+  return n;
+}
+
+int f1046(int a, int b) {
+  int c = a * 19 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f288(a - 1, n);
+  return n;
+}
+
+int f1047(int a, int b) {
+  int c = a * 99 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f917(a - 1, n);
+  return n;
+}
+
+int f1048(int a, int b) {
+  int c = a * 18 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f588(a - 1, n);
+  return n;
+}
+
+int f1049(int a, int b) {
+  int c = a * 52 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f320(a - 1, n);
+  return n;
+}
+
+int f1050(int a, int b) {
+  int c = a * 40 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f822(a - 1, n);
+  return n;
+}
+
+int f1051(int a, int b) {
+  int c = a * 92 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f808(a - 1, n);
+  return n;
+}
+
+int f1052(int a, int b) {
+  int c = a * 55 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f765(a - 1, n);
+  return n;
+}
+
+int f1053(int a, int b) {
+  int c = a * 21 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 19)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f282(a - 1, n);
+  return n;
+}
+
+int f1054(int a, int b) {
+  int c = a * 58 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 42)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f710(a - 1, n);
+  return n;
+}
+
+int f1055(int a, int b) {
+  int c = a * 34 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f161(a - 1, n);
+  return n;
+}
+
+int f1056(int a, int b) {
+  int c = a * 42 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f577(a - 1, n);
+  return n;
+}
+
+int f1057(int a, int b) {
+  int c = a * 2 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f356(a - 1, n);
+  return n;
+}
+
+int f1058(int a, int b) {
+  int c = a * 9 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f771(a - 1, n);
+  return n;
+}
+
+int f1059(int a, int b) {
+  int c = a * 49 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f98(a - 1, n);
+  return n;
+}
+
+int f1060(int a, int b) {
+  int c = a * 69 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 8)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f292(a - 1, n);
+  return n;
+}
+
+int f1061(int a, int b) {
+  int c = a * 64 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f773(a - 1, n);
+  return n;
+}
+
+int f1062(int a, int b) {
+  int c = a * 52 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f600(a - 1, n);
+  return n;
+}
+
+int f1063(int a, int b) {
+  int c = a * 62 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 36)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f935(a - 1, n);
+  return n;
+}
+
+int f1064(int a, int b) {
+  int c = a * 42 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f853(a - 1, n);
+  return n;
+}
+
+int f1065(int a, int b) {
+  int c = a * 74 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f70(a - 1, n);
+  return n;
+}
+
+int f1066(int a, int b) {
+  int c = a * 87 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f556(a - 1, n);
+  return n;
+}
+
+int f1067(int a, int b) {
+  int c = a * 26 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f399(a - 1, n);
+  return n;
+}
+
+int f1068(int a, int b) {
+  int c = a * 25 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f600(a - 1, n);
+  return n;
+}
+
+int f1069(int a, int b) {
+  int c = a * 98 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f733(a - 1, n);
+  return n;
+}
+
+int f1070(int a, int b) {
+  int c = a * 54 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 10)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f868(a - 1, n);
+  return n;
+}
+
+int f1071(int a, int b) {
+  int c = a * 19 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f338(a - 1, n);
+  return n;
+}
+
+int f1072(int a, int b) {
+  int c = a * 95 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f983(a - 1, n);
+  return n;
+}
+
+int f1073(int a, int b) {
+  int c = a * 65 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 36)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1066(a - 1, n);
+  return n;
+}
+
+int f1074(int a, int b) {
+  int c = a * 11 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f422(a - 1, n);
+  return n;
+}
+
+int f1075(int a, int b) {
+  int c = a * 95 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f735(a - 1, n);
+  return n;
+}
+
+int f1076(int a, int b) {
+  int c = a * 54 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f489(a - 1, n);
+  return n;
+}
+
+int f1077(int a, int b) {
+  int c = a * 18 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f735(a - 1, n);
+  return n;
+}
+
+int f1078(int a, int b) {
+  int c = a * 13 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f348(a - 1, n);
+  return n;
+}
+
+int f1079(int a, int b) {
+  int c = a * 30 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f895(a - 1, n);
+  return n;
+}
+
+int f1080(int a, int b) {
+  int c = a * 39 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f584(a - 1, n);
+  return n;
+}
+
+int f1081(int a, int b) {
+  int c = a * 56 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f141(a - 1, n);
+  return n;
+}
+
+int f1082(int a, int b) {
+  int c = a * 5 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f191(a - 1, n);
+  return n;
+}
+
+int f1083(int a, int b) {
+  int c = a * 69 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 8)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f268(a - 1, n);
+  return n;
+}
+
+int f1084(int a, int b) {
+  int c = a * 8 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 3)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f34(a - 1, n);
+  return n;
+}
+
+int f1085(int a, int b) {
+  int c = a * 11 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 18)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f470(a - 1, n);
+  return n;
+}
+
+int f1086(int a, int b) {
+  int c = a * 80 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f97(a - 1, n);
+  return n;
+}
+
+int f1087(int a, int b) {
+  int c = a * 21 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f344(a - 1, n);
+  return n;
+}
+
+int f1088(int a, int b) {
+  int c = a * 19 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 27)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f474(a - 1, n);
+  return n;
+}
+
+int f1089(int a, int b) {
+  int c = a * 16 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f33(a - 1, n);
+  return n;
+}
+
+int f1090(int a, int b) {
+  int c = a * 83 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f983(a - 1, n);
+  return n;
+}
+
+int f1091(int a, int b) {
+  int c = a * 84 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f893(a - 1, n);
+  return n;
+}
+
+int f1092(int a, int b) {
+  int c = a * 18 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f701(a - 1, n);
+  return n;
+}
+
+int f1093(int a, int b) {
+  int c = a * 52 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f476(a - 1, n);
+  return n;
+}
+
+int f1094(int a, int b) {
+  int c = a * 55 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1051(a - 1, n);
+  return n;
+}
+
+int f1095(int a, int b) {
+  int c = a * 21 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1015(a - 1, n);
+  return n;
+}
+
+int f1096(int a, int b) {
+  int c = a * 54 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 4)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f489(a - 1, n);
+  return n;
+}
+
+int f1097(int a, int b) {
+  int c = a * 0 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f465(a - 1, n);
+  return n;
+}
+
+int f1098(int a, int b) {
+  int c = a * 60 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 18)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f884(a - 1, n);
+  return n;
+}
+
+int f1099(int a, int b) {
+  int c = a * 51 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f811(a - 1, n);
+  return n;
+}
+
+int f1100(int a, int b) {
+  int c = a * 20 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1017(a - 1, n);
+  return n;
+}
+
+int f1101(int a, int b) {
+  int c = a * 46 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 19)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1065(a - 1, n);
+  return n;
+}
+
+int f1102(int a, int b) {
+  int c = a * 17 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f881(a - 1, n);
+  return n;
+}
+
+int f1103(int a, int b) {
+  int c = a * 30 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f64(a - 1, n);
+  return n;
+}
+
+int f1104(int a, int b) {
+  int c = a * 46 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f987(a - 1, n);
+  return n;
+}
+
+int f1105(int a, int b) {
+  int c = a * 46 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f425(a - 1, n);
+  return n;
+}
+
+int f1106(int a, int b) {
+  int c = a * 65 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f498(a - 1, n);
+  return n;
+}
+
+int f1107(int a, int b) {
+  int c = a * 72 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f876(a - 1, n);
+  return n;
+}
+
+int f1108(int a, int b) {
+  int c = a * 15 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 8)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f587(a - 1, n);
+  return n;
+}
+
+int f1109(int a, int b) {
+  int c = a * 25 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f275(a - 1, n);
+  return n;
+}
+
+int f1110(int a, int b) {
+  int c = a * 46 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f676(a - 1, n);
+  return n;
+}
+
+int f1111(int a, int b) {
+  int c = a * 11 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f713(a - 1, n);
+  return n;
+}
+
+int f1112(int a, int b) {
+  int c = a * 99 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f534(a - 1, n);
+  return n;
+}
+
+int f1113(int a, int b) {
+  int c = a * 48 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f17(a - 1, n);
+  return n;
+}
+
+int f1114(int a, int b) {
+  int c = a * 2 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 19)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f329(a - 1, n);
+  return n;
+}
+
+int f1115(int a, int b) {
+  int c = a * 8 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f256(a - 1, n);
+  return n;
+}
+
+int f1116(int a, int b) {
+  int c = a * 39 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f170(a - 1, n);
+  return n;
+}
+
+int f1117(int a, int b) {
+  int c = a * 44 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f139(a - 1, n);
+  return n;
+}
+
+int f1118(int a, int b) {
+  int c = a * 13 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f257(a - 1, n);
+  return n;
+}
+
+int f1119(int a, int b) {
+  int c = a * 90 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f51(a - 1, n);
+  return n;
+}
+
+int f1120(int a, int b) {
+  int c = a * 43 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f961(a - 1, n);
+  return n;
+}
+
+int f1121(int a, int b) {
+  int c = a * 99 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f637(a - 1, n);
+  return n;
+}
+
+int f1122(int a, int b) {
+  int c = a * 72 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f429(a - 1, n);
+  return n;
+}
+
+int f1123(int a, int b) {
+  int c = a * 45 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f403(a - 1, n);
+  return n;
+}
+
+int f1124(int a, int b) {
+  int c = a * 50 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f487(a - 1, n);
+  return n;
+}
+
+int f1125(int a, int b) {
+  int c = a * 54 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 34)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f626(a - 1, n);
+  return n;
+}
+
+int f1126(int a, int b) {
+  int c = a * 20 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f100(a - 1, n);
+  return n;
+}
+
+int f1127(int a, int b) {
+  int c = a * 46 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f518(a - 1, n);
+  return n;
+}
+
+int f1128(int a, int b) {
+  int c = a * 27 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f45(a - 1, n);
+  return n;
+}
+
+int f1129(int a, int b) {
+  int c = a * 84 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 42)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1057(a - 1, n);
+  return n;
+}
+
+int f1130(int a, int b) {
+  int c = a * 89 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f104(a - 1, n);
+  return n;
+}
+
+int f1131(int a, int b) {
+  int c = a * 98 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 19)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f205(a - 1, n);
+  return n;
+}
+
+int f1132(int a, int b) {
+  int c = a * 22 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1012(a - 1, n);
+  return n;
+}
+
+int f1133(int a, int b) {
+  int c = a * 33 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f523(a - 1, n);
+  return n;
+}
+
+int f1134(int a, int b) {
+  int c = a * 63 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f158(a - 1, n);
+  return n;
+}
+
+int f1135(int a, int b) {
+  int c = a * 97 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 10)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f468(a - 1, n);
+  return n;
+}
+
+int f1136(int a, int b) {
+  int c = a * 71 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 19)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f198(a - 1, n);
+  return n;
+}
+
+int f1137(int a, int b) {
+  int c = a * 56 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 42)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f299(a - 1, n);
+  return n;
+}
+
+int f1138(int a, int b) {
+  int c = a * 90 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f496(a - 1, n);
+  return n;
+}
+
+int f1139(int a, int b) {
+  int c = a * 36 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 10)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f122(a - 1, n);
+  return n;
+}
+
+int f1140(int a, int b) {
+  int c = a * 43 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f2(a - 1, n);
+  return n;
+}
+
+int f1141(int a, int b) {
+  int c = a * 95 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f35(a - 1, n);
+  return n;
+}
+
+int f1142(int a, int b) {
+  int c = a * 99 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 43)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f906(a - 1, n);
+  return n;
+}
+
+int f1143(int a, int b) {
+  int c = a * 11 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f506(a - 1, n);
+  return n;
+}
+
+int f1144(int a, int b) {
+  int c = a * 66 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f374(a - 1, n);
+  return n;
+}
+
+int f1145(int a, int b) {
+  int c = a * 39 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1058(a - 1, n);
+  return n;
+}
+
+int f1146(int a, int b) {
+  int c = a * 45 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 36)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f773(a - 1, n);
+  return n;
+}
+
+int f1147(int a, int b) {
+  int c = a * 98 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f975(a - 1, n);
+  return n;
+}
+
+int f1148(int a, int b) {
+  int c = a * 34 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f287(a - 1, n);
+  return n;
+}
+
+int f1149(int a, int b) {
+  int c = a * 97 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f633(a - 1, n);
+  return n;
+}
+
+int f1150(int a, int b) {
+  int c = a * 12 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f774(a - 1, n);
+  return n;
+}
+
+int f1151(int a, int b) {
+  int c = a * 80 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f38(a - 1, n);
+  return n;
+}
+
+int f1152(int a, int b) {
+  int c = a * 43 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f763(a - 1, n);
+  return n;
+}
+
+int f1153(int a, int b) {
+  int c = a * 35 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f794(a - 1, n);
+  return n;
+}
+
+int f1154(int a, int b) {
+  int c = a * 71 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f93(a - 1, n);
+  return n;
+}
+
+int f1155(int a, int b) {
+  int c = a * 15 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 36)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f740(a - 1, n);
+  return n;
+}
+
+int f1156(int a, int b) {
+  int c = a * 91 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f73(a - 1, n);
+  return n;
+}
+
+int f1157(int a, int b) {
+  int c = a * 16 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 8)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f238(a - 1, n);
+  return n;
+}
+
+int f1158(int a, int b) {
+  int c = a * 14 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 19)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f455(a - 1, n);
+  return n;
+}
+
+int f1159(int a, int b) {
+  int c = a * 61 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f832(a - 1, n);
+  return n;
+}
+
+int f1160(int a, int b) {
+  int c = a * 43 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f880(a - 1, n);
+  return n;
+}
+
+int f1161(int a, int b) {
+  int c = a * 97 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f525(a - 1, n);
+  return n;
+}
+
+int f1162(int a, int b) {
+  int c = a * 83 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f286(a - 1, n);
+  return n;
+}
+
+int f1163(int a, int b) {
+  int c = a * 47 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f773(a - 1, n);
+  return n;
+}
+
+int f1164(int a, int b) {
+  int c = a * 72 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f465(a - 1, n);
+  return n;
+}
+
+int f1165(int a, int b) {
+  int c = a * 12 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f214(a - 1, n);
+  return n;
+}
+
+int f1166(int a, int b) {
+  int c = a * 84 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 25)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1084(a - 1, n);
+  return n;
+}
+
+int f1167(int a, int b) {
+  int c = a * 53 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f18(a - 1, n);
+  return n;
+}
+
+int f1168(int a, int b) {
+  int c = a * 59 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f370(a - 1, n);
+  return n;
+}
+
+int f1169(int a, int b) {
+  int c = a * 13 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f636(a - 1, n);
+  return n;
+}
+
+int f1170(int a, int b) {
+  int c = a * 7 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f127(a - 1, n);
+  return n;
+}
+
+int f1171(int a, int b) {
+  int c = a * 46 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f305(a - 1, n);
+  return n;
+}
+
+int f1172(int a, int b) {
+  int c = a * 77 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f128(a - 1, n);
+  return n;
+}
+
+int f1173(int a, int b) {
+  int c = a * 90 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f82(a - 1, n);
+  return n;
+}
+
+int f1174(int a, int b) {
+  int c = a * 41 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f537(a - 1, n);
+  return n;
+}
+
+int f1175(int a, int b) {
+  int c = a * 88 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f742(a - 1, n);
+  return n;
+}
+
+int f1176(int a, int b) {
+  int c = a * 60 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f76(a - 1, n);
+  return n;
+}
+
+int f1177(int a, int b) {
+  int c = a * 48 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f295(a - 1, n);
+  return n;
+}
+
+int f1178(int a, int b) {
+  int c = a * 93 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f793(a - 1, n);
+  return n;
+}
+
+int f1179(int a, int b) {
+  int c = a * 8 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 18)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1166(a - 1, n);
+  return n;
+}
+
+int f1180(int a, int b) {
+  int c = a * 63 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f665(a - 1, n);
+  return n;
+}
+
+int f1181(int a, int b) {
+  int c = a * 31 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f616(a - 1, n);
+  return n;
+}
+
+int f1182(int a, int b) {
+  int c = a * 65 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1128(a - 1, n);
+  return n;
+}
+
+int f1183(int a, int b) {
+  int c = a * 35 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f212(a - 1, n);
+  return n;
+}
+
+int f1184(int a, int b) {
+  int c = a * 82 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 36)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f916(a - 1, n);
+  return n;
+}
+
+int f1185(int a, int b) {
+  int c = a * 91 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 36)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f70(a - 1, n);
+  return n;
+}
+
+int f1186(int a, int b) {
+  int c = a * 10 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f938(a - 1, n);
+  return n;
+}
+
+int f1187(int a, int b) {
+  int c = a * 13 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f729(a - 1, n);
+  return n;
+}
+
+int f1188(int a, int b) {
+  int c = a * 71 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f276(a - 1, n);
+  return n;
+}
+
+int f1189(int a, int b) {
+  int c = a * 5 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1072(a - 1, n);
+  return n;
+}
+
+int f1190(int a, int b) {
+  int c = a * 44 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f89(a - 1, n);
+  return n;
+}
+
+int f1191(int a, int b) {
+  int c = a * 38 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f662(a - 1, n);
+  return n;
+}
+
+int f1192(int a, int b) {
+  int c = a * 29 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 3)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f674(a - 1, n);
+  return n;
+}
+
+int f1193(int a, int b) {
+  int c = a * 96 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f657(a - 1, n);
+  return n;
+}
+
+int f1194(int a, int b) {
+  int c = a * 31 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f423(a - 1, n);
+  return n;
+}
+
+int f1195(int a, int b) {
+  int c = a * 78 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 24)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f338(a - 1, n);
+  return n;
+}
+
+int f1196(int a, int b) {
+  int c = a * 46 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f542(a - 1, n);
+  return n;
+}
+
+int f1197(int a, int b) {
+  int c = a * 14 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f763(a - 1, n);
+  return n;
+}
+
+int f1198(int a, int b) {
+  int c = a * 77 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f979(a - 1, n);
+  return n;
+}
+
+int f1199(int a, int b) {
+  int c = a * 5 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f814(a - 1, n);
+  return n;
+}
+
+int f1200(int a, int b) {
+  int c = a * 1 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1152(a - 1, n);
+  return n;
+}
+
+int f1201(int a, int b) {
+  int c = a * 20 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f200(a - 1, n);
+  return n;
+}
+
+int f1202(int a, int b) {
+  int c = a * 84 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 34)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f753(a - 1, n);
+  return n;
+}
+
+int f1203(int a, int b) {
+  int c = a * 88 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1163(a - 1, n);
+  return n;
+}
+
+int f1204(int a, int b) {
+  int c = a * 29 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 3)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f561(a - 1, n);
+  return n;
+}
+
+int f1205(int a, int b) {
+  int c = a * 61 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 25)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f769(a - 1, n);
+  return n;
+}
+
+int f1206(int a, int b) {
+  int c = a * 77 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f69(a - 1, n);
+  return n;
+}
+
+int f1207(int a, int b) {
+  int c = a * 65 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f556(a - 1, n);
+  return n;
+}
+
+int f1208(int a, int b) {
+  int c = a * 88 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f893(a - 1, n);
+  return n;
+}
+
+int f1209(int a, int b) {
+  int c = a * 61 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f729(a - 1, n);
+  return n;
+}
+
+int f1210(int a, int b) {
+  int c = a * 43 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f495(a - 1, n);
+  return n;
+}
+
+int f1211(int a, int b) {
+  int c = a * 44 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f92(a - 1, n);
+  return n;
+}
+
+int f1212(int a, int b) {
+  int c = a * 74 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f879(a - 1, n);
+  return n;
+}
+
+int f1213(int a, int b) {
+  int c = a * 79 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1165(a - 1, n);
+  return n;
+}
+
+int f1214(int a, int b) {
+  int c = a * 96 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f247(a - 1, n);
+  return n;
+}
+
+int f1215(int a, int b) {
+  int c = a * 73 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 18)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f819(a - 1, n);
+  return n;
+}
+
+int f1216(int a, int b) {
+  int c = a * 89 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f230(a - 1, n);
+  return n;
+}
+
+int f1217(int a, int b) {
+  int c = a * 80 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f430(a - 1, n);
+  return n;
+}
+
+int f1218(int a, int b) {
+  int c = a * 79 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 4)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f335(a - 1, n);
+  return n;
+}
+
+int f1219(int a, int b) {
+  int c = a * 51 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f69(a - 1, n);
+  return n;
+}
+
+int f1220(int a, int b) {
+  int c = a * 33 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f815(a - 1, n);
+  return n;
+}
+
+int f1221(int a, int b) {
+  int c = a * 45 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f299(a - 1, n);
+  return n;
+}
+
+int f1222(int a, int b) {
+  int c = a * 22 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f421(a - 1, n);
+  return n;
+}
+
+int f1223(int a, int b) {
+  int c = a * 12 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1117(a - 1, n);
+  return n;
+}
+
+int f1224(int a, int b) {
+  int c = a * 38 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f501(a - 1, n);
+  return n;
+}
+
+int f1225(int a, int b) {
+  int c = a * 35 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f437(a - 1, n);
+  return n;
+}
+
+int f1226(int a, int b) {
+  int c = a * 62 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 36)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f19(a - 1, n);
+  return n;
+}
+
+int f1227(int a, int b) {
+  int c = a * 14 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 27)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f429(a - 1, n);
+  return n;
+}
+
+int f1228(int a, int b) {
+  int c = a * 42 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f13(a - 1, n);
+  return n;
+}
+
+int f1229(int a, int b) {
+  int c = a * 17 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 42)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f117(a - 1, n);
+  return n;
+}
+
+int f1230(int a, int b) {
+  int c = a * 64 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f45(a - 1, n);
+  return n;
+}
+
+int f1231(int a, int b) {
+  int c = a * 41 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 24)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f451(a - 1, n);
+  return n;
+}
+
+int f1232(int a, int b) {
+  int c = a * 49 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f381(a - 1, n);
+  return n;
+}
+
+int f1233(int a, int b) {
+  int c = a * 38 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f230(a - 1, n);
+  return n;
+}
+
+int f1234(int a, int b) {
+  int c = a * 36 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f559(a - 1, n);
+  return n;
+}
+
+int f1235(int a, int b) {
+  int c = a * 42 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 36)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1119(a - 1, n);
+  return n;
+}
+
+int f1236(int a, int b) {
+  int c = a * 86 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f899(a - 1, n);
+  return n;
+}
+
+int f1237(int a, int b) {
+  int c = a * 23 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f43(a - 1, n);
+  return n;
+}
+
+int f1238(int a, int b) {
+  int c = a * 57 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f747(a - 1, n);
+  return n;
+}
+
+int f1239(int a, int b) {
+  int c = a * 12 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f224(a - 1, n);
+  return n;
+}
+
+int f1240(int a, int b) {
+  int c = a * 9 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f839(a - 1, n);
+  return n;
+}
+
+int f1241(int a, int b) {
+  int c = a * 77 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 25)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f279(a - 1, n);
+  return n;
+}
+
+int f1242(int a, int b) {
+  int c = a * 77 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f77(a - 1, n);
+  return n;
+}
+
+int f1243(int a, int b) {
+  int c = a * 14 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1178(a - 1, n);
+  return n;
+}
+
+int f1244(int a, int b) {
+  int c = a * 53 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f285(a - 1, n);
+  return n;
+}
+
+int f1245(int a, int b) {
+  int c = a * 54 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f313(a - 1, n);
+  return n;
+}
+
+int f1246(int a, int b) {
+  int c = a * 91 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f502(a - 1, n);
+  return n;
+}
+
+int f1247(int a, int b) {
+  int c = a * 22 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f323(a - 1, n);
+  return n;
+}
+
+int f1248(int a, int b) {
+  int c = a * 19 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f80(a - 1, n);
+  return n;
+}
+
+int f1249(int a, int b) {
+  int c = a * 47 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f103(a - 1, n);
+  return n;
+}
+
+int f1250(int a, int b) {
+  int c = a * 39 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f323(a - 1, n);
+  return n;
+}
+
+int f1251(int a, int b) {
+  int c = a * 46 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f803(a - 1, n);
+  return n;
+}
+
+int f1252(int a, int b) {
+  int c = a * 30 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f450(a - 1, n);
+  return n;
+}
+
+int f1253(int a, int b) {
+  int c = a * 82 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f669(a - 1, n);
+  return n;
+}
+
+int f1254(int a, int b) {
+  int c = a * 44 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f382(a - 1, n);
+  return n;
+}
+
+int f1255(int a, int b) {
+  int c = a * 87 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f153(a - 1, n);
+  return n;
+}
+
+int f1256(int a, int b) {
+  int c = a * 42 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 27)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f293(a - 1, n);
+  return n;
+}
+
+int f1257(int a, int b) {
+  int c = a * 96 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f686(a - 1, n);
+  return n;
+}
+
+int f1258(int a, int b) {
+  int c = a * 63 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 25)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f336(a - 1, n);
+  return n;
+}
+
+int f1259(int a, int b) {
+  int c = a * 61 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f802(a - 1, n);
+  return n;
+}
+
+int f1260(int a, int b) {
+  int c = a * 86 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1004(a - 1, n);
+  return n;
+}
+
+int f1261(int a, int b) {
+  int c = a * 15 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f143(a - 1, n);
+  return n;
+}
+
+int f1262(int a, int b) {
+  int c = a * 23 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f358(a - 1, n);
+  return n;
+}
+
+int f1263(int a, int b) {
+  int c = a * 16 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f917(a - 1, n);
+  return n;
+}
+
+int f1264(int a, int b) {
+  int c = a * 38 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f288(a - 1, n);
+  return n;
+}
+
+int f1265(int a, int b) {
+  int c = a * 27 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f783(a - 1, n);
+  return n;
+}
+
+int f1266(int a, int b) {
+  int c = a * 74 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f782(a - 1, n);
+  return n;
+}
+
+int f1267(int a, int b) {
+  int c = a * 21 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f446(a - 1, n);
+  return n;
+}
+
+int f1268(int a, int b) {
+  int c = a * 62 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f535(a - 1, n);
+  return n;
+}
+
+int f1269(int a, int b) {
+  int c = a * 46 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f779(a - 1, n);
+  return n;
+}
+
+int f1270(int a, int b) {
+  int c = a * 85 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f306(a - 1, n);
+  return n;
+}
+
+int f1271(int a, int b) {
+  int c = a * 13 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f401(a - 1, n);
+  return n;
+}
+
+int f1272(int a, int b) {
+  int c = a * 83 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 34)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f325(a - 1, n);
+  return n;
+}
+
+int f1273(int a, int b) {
+  int c = a * 76 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1055(a - 1, n);
+  return n;
+}
+
+int f1274(int a, int b) {
+  int c = a * 12 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f427(a - 1, n);
+  return n;
+}
+
+int f1275(int a, int b) {
+  int c = a * 99 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1103(a - 1, n);
+  return n;
+}
+
+int f1276(int a, int b) {
+  int c = a * 2 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f25(a - 1, n);
+  return n;
+}
+
+int f1277(int a, int b) {
+  int c = a * 78 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f386(a - 1, n);
+  return n;
+}
+
+int f1278(int a, int b) {
+  int c = a * 61 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f950(a - 1, n);
+  return n;
+}
+
+int f1279(int a, int b) {
+  int c = a * 80 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f942(a - 1, n);
+  return n;
+}
+
+int f1280(int a, int b) {
+  int c = a * 12 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1024(a - 1, n);
+  return n;
+}
+
+int f1281(int a, int b) {
+  int c = a * 53 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1077(a - 1, n);
+  return n;
+}
+
+int f1282(int a, int b) {
+  int c = a * 9 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f859(a - 1, n);
+  return n;
+}
+
+int f1283(int a, int b) {
+  int c = a * 86 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 25)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1151(a - 1, n);
+  return n;
+}
+
+int f1284(int a, int b) {
+  int c = a * 76 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f190(a - 1, n);
+  return n;
+}
+
+int f1285(int a, int b) {
+  int c = a * 5 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f368(a - 1, n);
+  return n;
+}
+
+int f1286(int a, int b) {
+  int c = a * 55 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 42)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f12(a - 1, n);
+  return n;
+}
+
+int f1287(int a, int b) {
+  int c = a * 52 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f892(a - 1, n);
+  return n;
+}
+
+int f1288(int a, int b) {
+  int c = a * 93 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f625(a - 1, n);
+  return n;
+}
+
+int f1289(int a, int b) {
+  int c = a * 13 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f749(a - 1, n);
+  return n;
+}
+
+int f1290(int a, int b) {
+  int c = a * 76 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f324(a - 1, n);
+  return n;
+}
+
+int f1291(int a, int b) {
+  int c = a * 66 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f100(a - 1, n);
+  return n;
+}
+
+int f1292(int a, int b) {
+  int c = a * 57 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f927(a - 1, n);
+  return n;
+}
+
+int f1293(int a, int b) {
+  int c = a * 31 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1161(a - 1, n);
+  return n;
+}
+
+int f1294(int a, int b) {
+  int c = a * 29 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f190(a - 1, n);
+  return n;
+}
+
+int f1295(int a, int b) {
+  int c = a * 71 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1177(a - 1, n);
+  return n;
+}
+
+int f1296(int a, int b) {
+  int c = a * 73 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f922(a - 1, n);
+  return n;
+}
+
+int f1297(int a, int b) {
+  int c = a * 36 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1235(a - 1, n);
+  return n;
+}
+
+int f1298(int a, int b) {
+  int c = a * 73 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1192(a - 1, n);
+  return n;
+}
+
+int f1299(int a, int b) {
+  int c = a * 53 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f697(a - 1, n);
+  return n;
+}
+
+int f1300(int a, int b) {
+  int c = a * 77 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 27)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f257(a - 1, n);
+  return n;
+}
+
+int f1301(int a, int b) {
+  int c = a * 33 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f663(a - 1, n);
+  return n;
+}
+
+int f1302(int a, int b) {
+  int c = a * 60 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f183(a - 1, n);
+  return n;
+}
+
+int f1303(int a, int b) {
+  int c = a * 81 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 10)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f585(a - 1, n);
+  return n;
+}
+
+int f1304(int a, int b) {
+  int c = a * 64 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f401(a - 1, n);
+  return n;
+}
+
+int f1305(int a, int b) {
+  int c = a * 4 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f922(a - 1, n);
+  return n;
+}
+
+int f1306(int a, int b) {
+  int c = a * 66 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f206(a - 1, n);
+  return n;
+}
+
+int f1307(int a, int b) {
+  int c = a * 0 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f991(a - 1, n);
+  return n;
+}
+
+int f1308(int a, int b) {
+  int c = a * 40 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 27)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f597(a - 1, n);
+  return n;
+}
+
+int f1309(int a, int b) {
+  int c = a * 83 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1181(a - 1, n);
+  return n;
+}
+
+int f1310(int a, int b) {
+  int c = a * 83 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f233(a - 1, n);
+  return n;
+}
+
+int f1311(int a, int b) {
+  int c = a * 13 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 19)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f756(a - 1, n);
+  return n;
+}
+
+int f1312(int a, int b) {
+  int c = a * 95 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f427(a - 1, n);
+  return n;
+}
+
+int f1313(int a, int b) {
+  int c = a * 41 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f553(a - 1, n);
+  return n;
+}
+
+int f1314(int a, int b) {
+  int c = a * 14 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f580(a - 1, n);
+  return n;
+}
+
+int f1315(int a, int b) {
+  int c = a * 94 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 8)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f329(a - 1, n);
+  return n;
+}
+
+int f1316(int a, int b) {
+  int c = a * 78 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 10)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f642(a - 1, n);
+  return n;
+}
+
+int f1317(int a, int b) {
+  int c = a * 70 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f102(a - 1, n);
+  return n;
+}
+
+int f1318(int a, int b) {
+  int c = a * 75 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f345(a - 1, n);
+  return n;
+}
+
+int f1319(int a, int b) {
+  int c = a * 33 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1283(a - 1, n);
+  return n;
+}
+
+int f1320(int a, int b) {
+  int c = a * 12 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f737(a - 1, n);
+  return n;
+}
+
+int f1321(int a, int b) {
+  int c = a * 84 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f42(a - 1, n);
+  return n;
+}
+
+int f1322(int a, int b) {
+  int c = a * 87 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f95(a - 1, n);
+  return n;
+}
+
+int f1323(int a, int b) {
+  int c = a * 89 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1007(a - 1, n);
+  return n;
+}
+
+int f1324(int a, int b) {
+  int c = a * 78 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 43)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f103(a - 1, n);
+  return n;
+}
+
+int f1325(int a, int b) {
+  int c = a * 50 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f821(a - 1, n);
+  return n;
+}
+
+int f1326(int a, int b) {
+  int c = a * 70 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f713(a - 1, n);
+  return n;
+}
+
+int f1327(int a, int b) {
+  int c = a * 71 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 42)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f512(a - 1, n);
+  return n;
+}
+
+int f1328(int a, int b) {
+  int c = a * 51 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f869(a - 1, n);
+  return n;
+}
+
+int f1329(int a, int b) {
+  int c = a * 24 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f768(a - 1, n);
+  return n;
+}
+
+int f1330(int a, int b) {
+  int c = a * 92 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f543(a - 1, n);
+  return n;
+}
+
+int f1331(int a, int b) {
+  int c = a * 59 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f611(a - 1, n);
+  return n;
+}
+
+int f1332(int a, int b) {
+  int c = a * 14 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1062(a - 1, n);
+  return n;
+}
+
+int f1333(int a, int b) {
+  int c = a * 14 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 25)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1070(a - 1, n);
+  return n;
+}
+
+int f1334(int a, int b) {
+  int c = a * 54 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f51(a - 1, n);
+  return n;
+}
+
+int f1335(int a, int b) {
+  int c = a * 54 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 19)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1260(a - 1, n);
+  return n;
+}
+
+int f1336(int a, int b) {
+  int c = a * 57 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f953(a - 1, n);
+  return n;
+}
+
+int f1337(int a, int b) {
+  int c = a * 16 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f212(a - 1, n);
+  return n;
+}
+
+int f1338(int a, int b) {
+  int c = a * 52 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 3)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1240(a - 1, n);
+  return n;
+}
+
+int f1339(int a, int b) {
+  int c = a * 91 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f804(a - 1, n);
+  return n;
+}
+
+int f1340(int a, int b) {
+  int c = a * 6 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1293(a - 1, n);
+  return n;
+}
+
+int f1341(int a, int b) {
+  int c = a * 11 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 3)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f672(a - 1, n);
+  return n;
+}
+
+int f1342(int a, int b) {
+  int c = a * 14 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f302(a - 1, n);
+  return n;
+}
+
+int f1343(int a, int b) {
+  int c = a * 70 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1022(a - 1, n);
+  return n;
+}
+
+int f1344(int a, int b) {
+  int c = a * 94 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f528(a - 1, n);
+  return n;
+}
+
+int f1345(int a, int b) {
+  int c = a * 7 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f562(a - 1, n);
+  return n;
+}
+
+int f1346(int a, int b) {
+  int c = a * 53 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 24)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1143(a - 1, n);
+  return n;
+}
+
+int f1347(int a, int b) {
+  int c = a * 16 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f364(a - 1, n);
+  return n;
+}
+
+int f1348(int a, int b) {
+  int c = a * 78 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1094(a - 1, n);
+  return n;
+}
+
+int f1349(int a, int b) {
+  int c = a * 88 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f241(a - 1, n);
+  return n;
+}
+
+int f1350(int a, int b) {
+  int c = a * 44 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 42)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f45(a - 1, n);
+  return n;
+}
+
+int f1351(int a, int b) {
+  int c = a * 83 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f500(a - 1, n);
+  return n;
+}
+
+int f1352(int a, int b) {
+  int c = a * 0 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f103(a - 1, n);
+  return n;
+}
+
+int f1353(int a, int b) {
+  int c = a * 43 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f753(a - 1, n);
+  return n;
+}
+
+int f1354(int a, int b) {
+  int c = a * 68 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1236(a - 1, n);
+  return n;
+}
+
+int f1355(int a, int b) {
+  int c = a * 57 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f93(a - 1, n);
+  return n;
+}
+
+int f1356(int a, int b) {
+  int c = a * 38 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f539(a - 1, n);
+  return n;
+}
+
+int f1357(int a, int b) {
+  int c = a * 42 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 4)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f595(a - 1, n);
+  return n;
+}
+
+int f1358(int a, int b) {
+  int c = a * 75 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f764(a - 1, n);
+  return n;
+}
+
+int f1359(int a, int b) {
+  int c = a * 43 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f975(a - 1, n);
+  return n;
+}
+
+int f1360(int a, int b) {
+  int c = a * 65 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1014(a - 1, n);
+  return n;
+}
+
+int f1361(int a, int b) {
+  int c = a * 61 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 19)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f675(a - 1, n);
+  return n;
+}
+
+int f1362(int a, int b) {
+  int c = a * 93 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 10)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f182(a - 1, n);
+  return n;
+}
+
+int f1363(int a, int b) {
+  int c = a * 90 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f512(a - 1, n);
+  return n;
+}
+
+int f1364(int a, int b) {
+  int c = a * 43 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1288(a - 1, n);
+  return n;
+}
+
+int f1365(int a, int b) {
+  int c = a * 8 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 43)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f971(a - 1, n);
+  return n;
+}
+
+int f1366(int a, int b) {
+  int c = a * 56 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 25)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f915(a - 1, n);
+  return n;
+}
+
+int f1367(int a, int b) {
+  int c = a * 31 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f182(a - 1, n);
+  return n;
+}
+
+int f1368(int a, int b) {
+  int c = a * 72 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f724(a - 1, n);
+  return n;
+}
+
+int f1369(int a, int b) {
+  int c = a * 19 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f535(a - 1, n);
+  return n;
+}
+
+int f1370(int a, int b) {
+  int c = a * 84 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f211(a - 1, n);
+  return n;
+}
+
+int f1371(int a, int b) {
+  int c = a * 67 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f557(a - 1, n);
+  return n;
+}
+
+int f1372(int a, int b) {
+  int c = a * 35 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 10)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f284(a - 1, n);
+  return n;
+}
+
+int f1373(int a, int b) {
+  int c = a * 47 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1349(a - 1, n);
+  return n;
+}
+
+int f1374(int a, int b) {
+  int c = a * 25 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f586(a - 1, n);
+  return n;
+}
+
+int f1375(int a, int b) {
+  int c = a * 7 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f545(a - 1, n);
+  return n;
+}
+
+int f1376(int a, int b) {
+  int c = a * 42 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 25)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f185(a - 1, n);
+  return n;
+}
+
+int f1377(int a, int b) {
+  int c = a * 69 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 34)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f596(a - 1, n);
+  return n;
+}
+
+int f1378(int a, int b) {
+  int c = a * 92 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f141(a - 1, n);
+  return n;
+}
+
+int f1379(int a, int b) {
+  int c = a * 39 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f916(a - 1, n);
+  return n;
+}
+
+int f1380(int a, int b) {
+  int c = a * 61 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f498(a - 1, n);
+  return n;
+}
+
+int f1381(int a, int b) {
+  int c = a * 78 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1307(a - 1, n);
+  return n;
+}
+
+int f1382(int a, int b) {
+  int c = a * 46 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1289(a - 1, n);
+  return n;
+}
+
+int f1383(int a, int b) {
+  int c = a * 17 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 24)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1247(a - 1, n);
+  return n;
+}
+
+int f1384(int a, int b) {
+  int c = a * 83 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 43)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1183(a - 1, n);
+  return n;
+}
+
+int f1385(int a, int b) {
+  int c = a * 28 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f46(a - 1, n);
+  return n;
+}
+
+int f1386(int a, int b) {
+  int c = a * 64 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1205(a - 1, n);
+  return n;
+}
+
+int f1387(int a, int b) {
+  int c = a * 49 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f697(a - 1, n);
+  return n;
+}
+
+int f1388(int a, int b) {
+  int c = a * 74 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f953(a - 1, n);
+  return n;
+}
+
+int f1389(int a, int b) {
+  int c = a * 86 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f921(a - 1, n);
+  return n;
+}
+
+int f1390(int a, int b) {
+  int c = a * 40 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f665(a - 1, n);
+  return n;
+}
+
+int f1391(int a, int b) {
+  int c = a * 48 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f451(a - 1, n);
+  return n;
+}
+
+int f1392(int a, int b) {
+  int c = a * 19 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f796(a - 1, n);
+  return n;
+}
+
+int f1393(int a, int b) {
+  int c = a * 50 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f279(a - 1, n);
+  return n;
+}
+
+int f1394(int a, int b) {
+  int c = a * 33 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f595(a - 1, n);
+  return n;
+}
+
+int f1395(int a, int b) {
+  int c = a * 53 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f936(a - 1, n);
+  return n;
+}
+
+int f1396(int a, int b) {
+  int c = a * 13 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 36)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f299(a - 1, n);
+  return n;
+}
+
+int f1397(int a, int b) {
+  int c = a * 99 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1044(a - 1, n);
+  return n;
+}
+
+int f1398(int a, int b) {
+  int c = a * 64 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f428(a - 1, n);
+  return n;
+}
+
+int f1399(int a, int b) {
+  int c = a * 46 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f464(a - 1, n);
+  return n;
+}
+
+int f1400(int a, int b) {
+  int c = a * 90 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1387(a - 1, n);
+  return n;
+}
+
+int f1401(int a, int b) {
+  int c = a * 28 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1181(a - 1, n);
+  return n;
+}
+
+int f1402(int a, int b) {
+  int c = a * 35 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f118(a - 1, n);
+  return n;
+}
+
+int f1403(int a, int b) {
+  int c = a * 68 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 24)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f788(a - 1, n);
+  return n;
+}
+
+int f1404(int a, int b) {
+  int c = a * 0 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 36)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1011(a - 1, n);
+  return n;
+}
+
+int f1405(int a, int b) {
+  int c = a * 96 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f408(a - 1, n);
+  return n;
+}
+
+int f1406(int a, int b) {
+  int c = a * 68 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1298(a - 1, n);
+  return n;
+}
+
+int f1407(int a, int b) {
+  int c = a * 4 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f970(a - 1, n);
+  return n;
+}
+
+int f1408(int a, int b) {
+  int c = a * 17 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1402(a - 1, n);
+  return n;
+}
+
+int f1409(int a, int b) {
+  int c = a * 12 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1347(a - 1, n);
+  return n;
+}
+
+int f1410(int a, int b) {
+  int c = a * 8 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f681(a - 1, n);
+  return n;
+}
+
+int f1411(int a, int b) {
+  int c = a * 16 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f164(a - 1, n);
+  return n;
+}
+
+int f1412(int a, int b) {
+  int c = a * 26 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f186(a - 1, n);
+  return n;
+}
+
+int f1413(int a, int b) {
+  int c = a * 1 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f359(a - 1, n);
+  return n;
+}
+
+int f1414(int a, int b) {
+  int c = a * 30 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 34)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f779(a - 1, n);
+  return n;
+}
+
+int f1415(int a, int b) {
+  int c = a * 36 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f356(a - 1, n);
+  return n;
+}
+
+int f1416(int a, int b) {
+  int c = a * 72 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f815(a - 1, n);
+  return n;
+}
+
+int f1417(int a, int b) {
+  int c = a * 68 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1397(a - 1, n);
+  return n;
+}
+
+int f1418(int a, int b) {
+  int c = a * 50 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f578(a - 1, n);
+  return n;
+}
+
+int f1419(int a, int b) {
+  int c = a * 61 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 24)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f682(a - 1, n);
+  return n;
+}
+
+int f1420(int a, int b) {
+  int c = a * 55 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f416(a - 1, n);
+  return n;
+}
+
+int f1421(int a, int b) {
+  int c = a * 40 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f983(a - 1, n);
+  return n;
+}
+
+int f1422(int a, int b) {
+  int c = a * 70 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f399(a - 1, n);
+  return n;
+}
+
+int f1423(int a, int b) {
+  int c = a * 22 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f851(a - 1, n);
+  return n;
+}
+
+int f1424(int a, int b) {
+  int c = a * 83 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f976(a - 1, n);
+  return n;
+}
+
+int f1425(int a, int b) {
+  int c = a * 97 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 18)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1161(a - 1, n);
+  return n;
+}
+
+int f1426(int a, int b) {
+  int c = a * 29 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f575(a - 1, n);
+  return n;
+}
+
+int f1427(int a, int b) {
+  int c = a * 78 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f481(a - 1, n);
+  return n;
+}
+
+int f1428(int a, int b) {
+  int c = a * 98 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f100(a - 1, n);
+  return n;
+}
+
+int f1429(int a, int b) {
+  int c = a * 92 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1266(a - 1, n);
+  return n;
+}
+
+int f1430(int a, int b) {
+  int c = a * 39 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f512(a - 1, n);
+  return n;
+}
+
+int f1431(int a, int b) {
+  int c = a * 15 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f490(a - 1, n);
+  return n;
+}
+
+int f1432(int a, int b) {
+  int c = a * 60 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f592(a - 1, n);
+  return n;
+}
+
+int f1433(int a, int b) {
+  int c = a * 34 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1151(a - 1, n);
+  return n;
+}
+
+int f1434(int a, int b) {
+  int c = a * 70 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f540(a - 1, n);
+  return n;
+}
+
+int f1435(int a, int b) {
+  int c = a * 53 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f412(a - 1, n);
+  return n;
+}
+
+int f1436(int a, int b) {
+  int c = a * 0 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f79(a - 1, n);
+  return n;
+}
+
+int f1437(int a, int b) {
+  int c = a * 28 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f776(a - 1, n);
+  return n;
+}
+
+int f1438(int a, int b) {
+  int c = a * 6 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1403(a - 1, n);
+  return n;
+}
+
+int f1439(int a, int b) {
+  int c = a * 79 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f660(a - 1, n);
+  return n;
+}
+
+int f1440(int a, int b) {
+  int c = a * 90 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f720(a - 1, n);
+  return n;
+}
+
+int f1441(int a, int b) {
+  int c = a * 78 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1229(a - 1, n);
+  return n;
+}
+
+int f1442(int a, int b) {
+  int c = a * 52 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f373(a - 1, n);
+  return n;
+}
+
+int f1443(int a, int b) {
+  int c = a * 37 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f565(a - 1, n);
+  return n;
+}
+
+int f1444(int a, int b) {
+  int c = a * 27 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 19)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1325(a - 1, n);
+  return n;
+}
+
+int f1445(int a, int b) {
+  int c = a * 20 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f295(a - 1, n);
+  return n;
+}
+
+int f1446(int a, int b) {
+  int c = a * 4 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f248(a - 1, n);
+  return n;
+}
+
+int f1447(int a, int b) {
+  int c = a * 26 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f401(a - 1, n);
+  return n;
+}
+
+int f1448(int a, int b) {
+  int c = a * 82 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f951(a - 1, n);
+  return n;
+}
+
+int f1449(int a, int b) {
+  int c = a * 94 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f170(a - 1, n);
+  return n;
+}
+
+int f1450(int a, int b) {
+  int c = a * 10 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f664(a - 1, n);
+  return n;
+}
+
+int f1451(int a, int b) {
+  int c = a * 77 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 4)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1093(a - 1, n);
+  return n;
+}
+
+int f1452(int a, int b) {
+  int c = a * 48 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f774(a - 1, n);
+  return n;
+}
+
+int f1453(int a, int b) {
+  int c = a * 75 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f794(a - 1, n);
+  return n;
+}
+
+int f1454(int a, int b) {
+  int c = a * 90 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f474(a - 1, n);
+  return n;
+}
+
+int f1455(int a, int b) {
+  int c = a * 6 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 34)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1349(a - 1, n);
+  return n;
+}
+
+int f1456(int a, int b) {
+  int c = a * 1 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f787(a - 1, n);
+  return n;
+}
+
+int f1457(int a, int b) {
+  int c = a * 25 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f823(a - 1, n);
+  return n;
+}
+
+int f1458(int a, int b) {
+  int c = a * 89 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f639(a - 1, n);
+  return n;
+}
+
+int f1459(int a, int b) {
+  int c = a * 84 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f191(a - 1, n);
+  return n;
+}
+
+int f1460(int a, int b) {
+  int c = a * 33 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f32(a - 1, n);
+  return n;
+}
+
+int f1461(int a, int b) {
+  int c = a * 2 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1258(a - 1, n);
+  return n;
+}
+
+int f1462(int a, int b) {
+  int c = a * 90 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 27)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1082(a - 1, n);
+  return n;
+}
+
+int f1463(int a, int b) {
+  int c = a * 67 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f370(a - 1, n);
+  return n;
+}
+
+int f1464(int a, int b) {
+  int c = a * 67 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 24)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f82(a - 1, n);
+  return n;
+}
+
+int f1465(int a, int b) {
+  int c = a * 92 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f495(a - 1, n);
+  return n;
+}
+
+int f1466(int a, int b) {
+  int c = a * 31 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1205(a - 1, n);
+  return n;
+}
+
+int f1467(int a, int b) {
+  int c = a * 95 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1072(a - 1, n);
+  return n;
+}
+
+int f1468(int a, int b) {
+  int c = a * 54 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 24)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f962(a - 1, n);
+  return n;
+}
+
+int f1469(int a, int b) {
+  int c = a * 19 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 10)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1077(a - 1, n);
+  return n;
+}
+
+int f1470(int a, int b) {
+  int c = a * 49 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1398(a - 1, n);
+  return n;
+}
+
+int f1471(int a, int b) {
+  int c = a * 83 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 24)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1002(a - 1, n);
+  return n;
+}
+
+int f1472(int a, int b) {
+  int c = a * 62 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f580(a - 1, n);
+  return n;
+}
+
+int f1473(int a, int b) {
+  int c = a * 56 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1225(a - 1, n);
+  return n;
+}
+
+int f1474(int a, int b) {
+  int c = a * 24 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f25(a - 1, n);
+  return n;
+}
+
+int f1475(int a, int b) {
+  int c = a * 67 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1058(a - 1, n);
+  return n;
+}
+
+int f1476(int a, int b) {
+  int c = a * 38 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f533(a - 1, n);
+  return n;
+}
+
+int f1477(int a, int b) {
+  int c = a * 43 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 3)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1423(a - 1, n);
+  return n;
+}
+
+int f1478(int a, int b) {
+  int c = a * 47 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f976(a - 1, n);
+  return n;
+}
+
+int f1479(int a, int b) {
+  int c = a * 52 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1185(a - 1, n);
+  return n;
+}
+
+int f1480(int a, int b) {
+  int c = a * 50 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f707(a - 1, n);
+  return n;
+}
+
+int f1481(int a, int b) {
+  int c = a * 4 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f821(a - 1, n);
+  return n;
+}
+
+int f1482(int a, int b) {
+  int c = a * 23 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f634(a - 1, n);
+  return n;
+}
+
+int f1483(int a, int b) {
+  int c = a * 38 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 8)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1333(a - 1, n);
+  return n;
+}
+
+int f1484(int a, int b) {
+  int c = a * 84 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1342(a - 1, n);
+  return n;
+}
+
+int f1485(int a, int b) {
+  int c = a * 3 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f578(a - 1, n);
+  return n;
+}
+
+int f1486(int a, int b) {
+  int c = a * 29 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f162(a - 1, n);
+  return n;
+}
+
+int f1487(int a, int b) {
+  int c = a * 52 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 8)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f563(a - 1, n);
+  return n;
+}
+
+int f1488(int a, int b) {
+  int c = a * 95 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f467(a - 1, n);
+  return n;
+}
+
+int f1489(int a, int b) {
+  int c = a * 44 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 3)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f154(a - 1, n);
+  return n;
+}
+
+int f1490(int a, int b) {
+  int c = a * 83 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f581(a - 1, n);
+  return n;
+}
+
+int f1491(int a, int b) {
+  int c = a * 37 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f24(a - 1, n);
+  return n;
+}
+
+int f1492(int a, int b) {
+  int c = a * 81 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1208(a - 1, n);
+  return n;
+}
+
+int f1493(int a, int b) {
+  int c = a * 44 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 27)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1471(a - 1, n);
+  return n;
+}
+
+int f1494(int a, int b) {
+  int c = a * 19 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f203(a - 1, n);
+  return n;
+}
+
+int f1495(int a, int b) {
+  int c = a * 71 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f965(a - 1, n);
+  return n;
+}
+
+int f1496(int a, int b) {
+  int c = a * 78 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1319(a - 1, n);
+  return n;
+}
+
+int f1497(int a, int b) {
+  int c = a * 48 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 10)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1340(a - 1, n);
+  return n;
+}
+
+int f1498(int a, int b) {
+  int c = a * 28 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1437(a - 1, n);
+  return n;
+}
+
+int f1499(int a, int b) {
+  int c = a * 36 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f77(a - 1, n);
+  return n;
+}
+
+int f1500(int a, int b) {
+  int c = a * 19 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f760(a - 1, n);
+  return n;
+}
+
+int f1501(int a, int b) {
+  int c = a * 18 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 24)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f703(a - 1, n);
+  return n;
+}
+
+int f1502(int a, int b) {
+  int c = a * 34 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f24(a - 1, n);
+  return n;
+}
+
+int f1503(int a, int b) {
+  int c = a * 38 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 34)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f274(a - 1, n);
+  return n;
+}
+
+int f1504(int a, int b) {
+  int c = a * 31 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 27)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f742(a - 1, n);
+  return n;
+}
+
+int f1505(int a, int b) {
+  int c = a * 24 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 10)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f15(a - 1, n);
+  return n;
+}
+
+int f1506(int a, int b) {
+  int c = a * 53 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1180(a - 1, n);
+  return n;
+}
+
+int f1507(int a, int b) {
+  int c = a * 60 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1247(a - 1, n);
+  return n;
+}
+
+int f1508(int a, int b) {
+  int c = a * 22 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f272(a - 1, n);
+  return n;
+}
+
+int f1509(int a, int b) {
+  int c = a * 69 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f813(a - 1, n);
+  return n;
+}
+
+int f1510(int a, int b) {
+  int c = a * 65 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f453(a - 1, n);
+  return n;
+}
+
+int f1511(int a, int b) {
+  int c = a * 34 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f872(a - 1, n);
+  return n;
+}
+
+int f1512(int a, int b) {
+  int c = a * 19 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f196(a - 1, n);
+  return n;
+}
+
+int f1513(int a, int b) {
+  int c = a * 95 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 19)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f19(a - 1, n);
+  return n;
+}
+
+int f1514(int a, int b) {
+  int c = a * 51 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f721(a - 1, n);
+  return n;
+}
+
+int f1515(int a, int b) {
+  int c = a * 3 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f18(a - 1, n);
+  return n;
+}
+
+int f1516(int a, int b) {
+  int c = a * 73 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f254(a - 1, n);
+  return n;
+}
+
+int f1517(int a, int b) {
+  int c = a * 4 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f130(a - 1, n);
+  return n;
+}
+
+int f1518(int a, int b) {
+  int c = a * 83 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f21(a - 1, n);
+  return n;
+}
+
+int f1519(int a, int b) {
+  int c = a * 43 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1203(a - 1, n);
+  return n;
+}
+
+int f1520(int a, int b) {
+  int c = a * 44 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f310(a - 1, n);
+  return n;
+}
+
+int f1521(int a, int b) {
+  int c = a * 61 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 24)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f827(a - 1, n);
+  return n;
+}
+
+int f1522(int a, int b) {
+  int c = a * 24 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1433(a - 1, n);
+  return n;
+}
+
+int f1523(int a, int b) {
+  int c = a * 76 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f647(a - 1, n);
+  return n;
+}
+
+int f1524(int a, int b) {
+  int c = a * 30 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1473(a - 1, n);
+  return n;
+}
+
+int f1525(int a, int b) {
+  int c = a * 0 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f769(a - 1, n);
+  return n;
+}
+
+int f1526(int a, int b) {
+  int c = a * 17 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f107(a - 1, n);
+  return n;
+}
+
+int f1527(int a, int b) {
+  int c = a * 95 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f135(a - 1, n);
+  return n;
+}
+
+int f1528(int a, int b) {
+  int c = a * 41 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f113(a - 1, n);
+  return n;
+}
+
+int f1529(int a, int b) {
+  int c = a * 90 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f301(a - 1, n);
+  return n;
+}
+
+int f1530(int a, int b) {
+  int c = a * 22 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1227(a - 1, n);
+  return n;
+}
+
+int f1531(int a, int b) {
+  int c = a * 24 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f829(a - 1, n);
+  return n;
+}
+
+int f1532(int a, int b) {
+  int c = a * 89 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f289(a - 1, n);
+  return n;
+}
+
+int f1533(int a, int b) {
+  int c = a * 83 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 18)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1395(a - 1, n);
+  return n;
+}
+
+int f1534(int a, int b) {
+  int c = a * 83 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f384(a - 1, n);
+  return n;
+}
+
+int f1535(int a, int b) {
+  int c = a * 8 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1334(a - 1, n);
+  return n;
+}
+
+int f1536(int a, int b) {
+  int c = a * 90 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 19)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f275(a - 1, n);
+  return n;
+}
+
+int f1537(int a, int b) {
+  int c = a * 6 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f133(a - 1, n);
+  return n;
+}
+
+int f1538(int a, int b) {
+  int c = a * 27 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f635(a - 1, n);
+  return n;
+}
+
+int f1539(int a, int b) {
+  int c = a * 17 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f100(a - 1, n);
+  return n;
+}
+
+int f1540(int a, int b) {
+  int c = a * 23 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f955(a - 1, n);
+  return n;
+}
+
+int f1541(int a, int b) {
+  int c = a * 27 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1252(a - 1, n);
+  return n;
+}
+
+int f1542(int a, int b) {
+  int c = a * 1 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1020(a - 1, n);
+  return n;
+}
+
+int f1543(int a, int b) {
+  int c = a * 87 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 34)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f665(a - 1, n);
+  return n;
+}
+
+int f1544(int a, int b) {
+  int c = a * 39 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f27(a - 1, n);
+  return n;
+}
+
+int f1545(int a, int b) {
+  int c = a * 93 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f381(a - 1, n);
+  return n;
+}
+
+int f1546(int a, int b) {
+  int c = a * 94 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 3)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f104(a - 1, n);
+  return n;
+}
+
+int f1547(int a, int b) {
+  int c = a * 53 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1488(a - 1, n);
+  return n;
+}
+
+int f1548(int a, int b) {
+  int c = a * 46 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f516(a - 1, n);
+  return n;
+}
+
+int f1549(int a, int b) {
+  int c = a * 11 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f991(a - 1, n);
+  return n;
+}
+
+int f1550(int a, int b) {
+  int c = a * 73 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f842(a - 1, n);
+  return n;
+}
+
+int f1551(int a, int b) {
+  int c = a * 93 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1412(a - 1, n);
+  return n;
+}
+
+int f1552(int a, int b) {
+  int c = a * 23 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 43)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f142(a - 1, n);
+  return n;
+}
+
+int f1553(int a, int b) {
+  int c = a * 37 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 42)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f834(a - 1, n);
+  return n;
+}
+
+int f1554(int a, int b) {
+  int c = a * 4 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f626(a - 1, n);
+  return n;
+}
+
+int f1555(int a, int b) {
+  int c = a * 3 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 25)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f251(a - 1, n);
+  return n;
+}
+
+int f1556(int a, int b) {
+  int c = a * 94 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f588(a - 1, n);
+  return n;
+}
+
+int f1557(int a, int b) {
+  int c = a * 9 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1414(a - 1, n);
+  return n;
+}
+
+int f1558(int a, int b) {
+  int c = a * 88 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1334(a - 1, n);
+  return n;
+}
+
+int f1559(int a, int b) {
+  int c = a * 37 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1013(a - 1, n);
+  return n;
+}
+
+int f1560(int a, int b) {
+  int c = a * 6 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f147(a - 1, n);
+  return n;
+}
+
+int f1561(int a, int b) {
+  int c = a * 40 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f423(a - 1, n);
+  return n;
+}
+
+int f1562(int a, int b) {
+  int c = a * 43 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f120(a - 1, n);
+  return n;
+}
+
+int f1563(int a, int b) {
+  int c = a * 45 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f455(a - 1, n);
+  return n;
+}
+
+int f1564(int a, int b) {
+  int c = a * 1 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1051(a - 1, n);
+  return n;
+}
+
+int f1565(int a, int b) {
+  int c = a * 47 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f916(a - 1, n);
+  return n;
+}
+
+int f1566(int a, int b) {
+  int c = a * 98 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f852(a - 1, n);
+  return n;
+}
+
+int f1567(int a, int b) {
+  int c = a * 14 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 8)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f330(a - 1, n);
+  return n;
+}
+
+int f1568(int a, int b) {
+  int c = a * 46 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1136(a - 1, n);
+  return n;
+}
+
+int f1569(int a, int b) {
+  int c = a * 92 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f562(a - 1, n);
+  return n;
+}
+
+int f1570(int a, int b) {
+  int c = a * 40 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1352(a - 1, n);
+  return n;
+}
+
+int f1571(int a, int b) {
+  int c = a * 37 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f681(a - 1, n);
+  return n;
+}
+
+int f1572(int a, int b) {
+  int c = a * 13 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 8)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1174(a - 1, n);
+  return n;
+}
+
+int f1573(int a, int b) {
+  int c = a * 71 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f696(a - 1, n);
+  return n;
+}
+
+int f1574(int a, int b) {
+  int c = a * 80 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1068(a - 1, n);
+  return n;
+}
+
+int f1575(int a, int b) {
+  int c = a * 47 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1361(a - 1, n);
+  return n;
+}
+
+int f1576(int a, int b) {
+  int c = a * 93 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f383(a - 1, n);
+  return n;
+}
+
+int f1577(int a, int b) {
+  int c = a * 12 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f360(a - 1, n);
+  return n;
+}
+
+int f1578(int a, int b) {
+  int c = a * 0 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1357(a - 1, n);
+  return n;
+}
+
+int f1579(int a, int b) {
+  int c = a * 29 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f399(a - 1, n);
+  return n;
+}
+
+int f1580(int a, int b) {
+  int c = a * 77 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1111(a - 1, n);
+  return n;
+}
+
+int f1581(int a, int b) {
+  int c = a * 23 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f321(a - 1, n);
+  return n;
+}
+
+int f1582(int a, int b) {
+  int c = a * 88 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1366(a - 1, n);
+  return n;
+}
+
+int f1583(int a, int b) {
+  int c = a * 30 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1292(a - 1, n);
+  return n;
+}
+
+int f1584(int a, int b) {
+  int c = a * 27 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 27)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f788(a - 1, n);
+  return n;
+}
+
+int f1585(int a, int b) {
+  int c = a * 27 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f549(a - 1, n);
+  return n;
+}
+
+int f1586(int a, int b) {
+  int c = a * 65 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f141(a - 1, n);
+  return n;
+}
+
+int f1587(int a, int b) {
+  int c = a * 89 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 10)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f970(a - 1, n);
+  return n;
+}
+
+int f1588(int a, int b) {
+  int c = a * 58 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 43)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f942(a - 1, n);
+  return n;
+}
+
+int f1589(int a, int b) {
+  int c = a * 95 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1054(a - 1, n);
+  return n;
+}
+
+int f1590(int a, int b) {
+  int c = a * 60 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f412(a - 1, n);
+  return n;
+}
+
+int f1591(int a, int b) {
+  int c = a * 54 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f499(a - 1, n);
+  return n;
+}
+
+int f1592(int a, int b) {
+  int c = a * 82 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1002(a - 1, n);
+  return n;
+}
+
+int f1593(int a, int b) {
+  int c = a * 11 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f861(a - 1, n);
+  return n;
+}
+
+int f1594(int a, int b) {
+  int c = a * 67 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 36)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1456(a - 1, n);
+  return n;
+}
+
+int f1595(int a, int b) {
+  int c = a * 67 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f308(a - 1, n);
+  return n;
+}
+
+int f1596(int a, int b) {
+  int c = a * 94 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f67(a - 1, n);
+  return n;
+}
+
+int f1597(int a, int b) {
+  int c = a * 23 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f84(a - 1, n);
+  return n;
+}
+
+int f1598(int a, int b) {
+  int c = a * 64 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f206(a - 1, n);
+  return n;
+}
+
+int f1599(int a, int b) {
+  int c = a * 59 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f876(a - 1, n);
+  return n;
+}
+
+int f1600(int a, int b) {
+  int c = a * 12 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1580(a - 1, n);
+  return n;
+}
+
+int f1601(int a, int b) {
+  int c = a * 88 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1387(a - 1, n);
+  return n;
+}
+
+int f1602(int a, int b) {
+  int c = a * 27 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1252(a - 1, n);
+  return n;
+}
+
+int f1603(int a, int b) {
+  int c = a * 99 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f207(a - 1, n);
+  return n;
+}
+
+int f1604(int a, int b) {
+  int c = a * 93 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f576(a - 1, n);
+  return n;
+}
+
+int f1605(int a, int b) {
+  int c = a * 90 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 10)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1127(a - 1, n);
+  return n;
+}
+
+int f1606(int a, int b) {
+  int c = a * 58 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1312(a - 1, n);
+  return n;
+}
+
+int f1607(int a, int b) {
+  int c = a * 86 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1029(a - 1, n);
+  return n;
+}
+
+int f1608(int a, int b) {
+  int c = a * 87 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 43)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f387(a - 1, n);
+  return n;
+}
+
+int f1609(int a, int b) {
+  int c = a * 86 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1363(a - 1, n);
+  return n;
+}
+
+int f1610(int a, int b) {
+  int c = a * 19 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f725(a - 1, n);
+  return n;
+}
+
+int f1611(int a, int b) {
+  int c = a * 84 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f78(a - 1, n);
+  return n;
+}
+
+int f1612(int a, int b) {
+  int c = a * 73 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 34)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1045(a - 1, n);
+  return n;
+}
+
+int f1613(int a, int b) {
+  int c = a * 74 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 42)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1035(a - 1, n);
+  return n;
+}
+
+int f1614(int a, int b) {
+  int c = a * 76 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 42)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f666(a - 1, n);
+  return n;
+}
+
+int f1615(int a, int b) {
+  int c = a * 65 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 42)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1384(a - 1, n);
+  return n;
+}
+
+int f1616(int a, int b) {
+  int c = a * 54 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1214(a - 1, n);
+  return n;
+}
+
+int f1617(int a, int b) {
+  int c = a * 38 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f602(a - 1, n);
+  return n;
+}
+
+int f1618(int a, int b) {
+  int c = a * 72 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1156(a - 1, n);
+  return n;
+}
+
+int f1619(int a, int b) {
+  int c = a * 13 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1568(a - 1, n);
+  return n;
+}
+
+int f1620(int a, int b) {
+  int c = a * 30 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f484(a - 1, n);
+  return n;
+}
+
+int f1621(int a, int b) {
+  int c = a * 31 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1197(a - 1, n);
+  return n;
+}
+
+int f1622(int a, int b) {
+  int c = a * 66 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 3)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1164(a - 1, n);
+  return n;
+}
+
+int f1623(int a, int b) {
+  int c = a * 9 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f344(a - 1, n);
+  return n;
+}
+
+int f1624(int a, int b) {
+  int c = a * 10 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1213(a - 1, n);
+  return n;
+}
+
+int f1625(int a, int b) {
+  int c = a * 31 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f227(a - 1, n);
+  return n;
+}
+
+int f1626(int a, int b) {
+  int c = a * 77 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f107(a - 1, n);
+  return n;
+}
+
+int f1627(int a, int b) {
+  int c = a * 56 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f652(a - 1, n);
+  return n;
+}
+
+int f1628(int a, int b) {
+  int c = a * 63 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1508(a - 1, n);
+  return n;
+}
+
+int f1629(int a, int b) {
+  int c = a * 40 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 34)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f11(a - 1, n);
+  return n;
+}
+
+int f1630(int a, int b) {
+  int c = a * 39 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1259(a - 1, n);
+  return n;
+}
+
+int f1631(int a, int b) {
+  int c = a * 11 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 10)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1153(a - 1, n);
+  return n;
+}
+
+int f1632(int a, int b) {
+  int c = a * 87 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1603(a - 1, n);
+  return n;
+}
+
+int f1633(int a, int b) {
+  int c = a * 40 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 25)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f307(a - 1, n);
+  return n;
+}
+
+int f1634(int a, int b) {
+  int c = a * 57 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f416(a - 1, n);
+  return n;
+}
+
+int f1635(int a, int b) {
+  int c = a * 87 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1045(a - 1, n);
+  return n;
+}
+
+int f1636(int a, int b) {
+  int c = a * 2 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1141(a - 1, n);
+  return n;
+}
+
+int f1637(int a, int b) {
+  int c = a * 82 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1409(a - 1, n);
+  return n;
+}
+
+int f1638(int a, int b) {
+  int c = a * 66 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1558(a - 1, n);
+  return n;
+}
+
+int f1639(int a, int b) {
+  int c = a * 72 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f612(a - 1, n);
+  return n;
+}
+
+int f1640(int a, int b) {
+  int c = a * 55 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f897(a - 1, n);
+  return n;
+}
+
+int f1641(int a, int b) {
+  int c = a * 82 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f736(a - 1, n);
+  return n;
+}
+
+int f1642(int a, int b) {
+  int c = a * 17 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f636(a - 1, n);
+  return n;
+}
+
+int f1643(int a, int b) {
+  int c = a * 26 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1381(a - 1, n);
+  return n;
+}
+
+int f1644(int a, int b) {
+  int c = a * 10 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f113(a - 1, n);
+  return n;
+}
+
+int f1645(int a, int b) {
+  int c = a * 26 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 4)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f482(a - 1, n);
+  return n;
+}
+
+int f1646(int a, int b) {
+  int c = a * 11 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1033(a - 1, n);
+  return n;
+}
+
+int f1647(int a, int b) {
+  int c = a * 4 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f396(a - 1, n);
+  return n;
+}
+
+int f1648(int a, int b) {
+  int c = a * 16 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f154(a - 1, n);
+  return n;
+}
+
+int f1649(int a, int b) {
+  int c = a * 17 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 24)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f655(a - 1, n);
+  return n;
+}
+
+int f1650(int a, int b) {
+  int c = a * 49 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f85(a - 1, n);
+  return n;
+}
+
+int f1651(int a, int b) {
+  int c = a * 73 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1204(a - 1, n);
+  return n;
+}
+
+int f1652(int a, int b) {
+  int c = a * 16 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f25(a - 1, n);
+  return n;
+}
+
+int f1653(int a, int b) {
+  int c = a * 60 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f287(a - 1, n);
+  return n;
+}
+
+int f1654(int a, int b) {
+  int c = a * 27 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f523(a - 1, n);
+  return n;
+}
+
+int f1655(int a, int b) {
+  int c = a * 84 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1034(a - 1, n);
+  return n;
+}
+
+int f1656(int a, int b) {
+  int c = a * 44 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1309(a - 1, n);
+  return n;
+}
+
+int f1657(int a, int b) {
+  int c = a * 68 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1554(a - 1, n);
+  return n;
+}
+
+int f1658(int a, int b) {
+  int c = a * 93 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1155(a - 1, n);
+  return n;
+}
+
+int f1659(int a, int b) {
+  int c = a * 81 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 18)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f142(a - 1, n);
+  return n;
+}
+
+int f1660(int a, int b) {
+  int c = a * 0 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f340(a - 1, n);
+  return n;
+}
+
+int f1661(int a, int b) {
+  int c = a * 40 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f988(a - 1, n);
+  return n;
+}
+
+int f1662(int a, int b) {
+  int c = a * 17 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f353(a - 1, n);
+  return n;
+}
+
+int f1663(int a, int b) {
+  int c = a * 36 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f344(a - 1, n);
+  return n;
+}
+
+int f1664(int a, int b) {
+  int c = a * 28 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f374(a - 1, n);
+  return n;
+}
+
+int f1665(int a, int b) {
+  int c = a * 92 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f43(a - 1, n);
+  return n;
+}
+
+int f1666(int a, int b) {
+  int c = a * 68 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f212(a - 1, n);
+  return n;
+}
+
+int f1667(int a, int b) {
+  int c = a * 81 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f11(a - 1, n);
+  return n;
+}
+
+int f1668(int a, int b) {
+  int c = a * 97 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1146(a - 1, n);
+  return n;
+}
+
+int f1669(int a, int b) {
+  int c = a * 61 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 10)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f617(a - 1, n);
+  return n;
+}
+
+int f1670(int a, int b) {
+  int c = a * 31 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 34)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f546(a - 1, n);
+  return n;
+}
+
+int f1671(int a, int b) {
+  int c = a * 68 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f72(a - 1, n);
+  return n;
+}
+
+int f1672(int a, int b) {
+  int c = a * 79 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f386(a - 1, n);
+  return n;
+}
+
+int f1673(int a, int b) {
+  int c = a * 92 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1581(a - 1, n);
+  return n;
+}
+
+int f1674(int a, int b) {
+  int c = a * 37 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 4)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1592(a - 1, n);
+  return n;
+}
+
+int f1675(int a, int b) {
+  int c = a * 37 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f342(a - 1, n);
+  return n;
+}
+
+int f1676(int a, int b) {
+  int c = a * 55 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 18)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1553(a - 1, n);
+  return n;
+}
+
+int f1677(int a, int b) {
+  int c = a * 89 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f135(a - 1, n);
+  return n;
+}
+
+int f1678(int a, int b) {
+  int c = a * 85 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 18)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f700(a - 1, n);
+  return n;
+}
+
+int f1679(int a, int b) {
+  int c = a * 26 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 43)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f15(a - 1, n);
+  return n;
+}
+
+int f1680(int a, int b) {
+  int c = a * 43 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1136(a - 1, n);
+  return n;
+}
+
+int f1681(int a, int b) {
+  int c = a * 92 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f601(a - 1, n);
+  return n;
+}
+
+int f1682(int a, int b) {
+  int c = a * 70 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f312(a - 1, n);
+  return n;
+}
+
+int f1683(int a, int b) {
+  int c = a * 59 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1185(a - 1, n);
+  return n;
+}
+
+int f1684(int a, int b) {
+  int c = a * 1 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f789(a - 1, n);
+  return n;
+}
+
+int f1685(int a, int b) {
+  int c = a * 45 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f865(a - 1, n);
+  return n;
+}
+
+int f1686(int a, int b) {
+  int c = a * 82 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f452(a - 1, n);
+  return n;
+}
+
+int f1687(int a, int b) {
+  int c = a * 88 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f347(a - 1, n);
+  return n;
+}
+
+int f1688(int a, int b) {
+  int c = a * 13 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 36)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f286(a - 1, n);
+  return n;
+}
+
+int f1689(int a, int b) {
+  int c = a * 94 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1612(a - 1, n);
+  return n;
+}
+
+int f1690(int a, int b) {
+  int c = a * 62 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1153(a - 1, n);
+  return n;
+}
+
+int f1691(int a, int b) {
+  int c = a * 22 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 19)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f47(a - 1, n);
+  return n;
+}
+
+int f1692(int a, int b) {
+  int c = a * 85 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1145(a - 1, n);
+  return n;
+}
+
+int f1693(int a, int b) {
+  int c = a * 23 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f15(a - 1, n);
+  return n;
+}
+
+int f1694(int a, int b) {
+  int c = a * 96 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f84(a - 1, n);
+  return n;
+}
+
+int f1695(int a, int b) {
+  int c = a * 74 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1625(a - 1, n);
+  return n;
+}
+
+int f1696(int a, int b) {
+  int c = a * 61 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 34)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1140(a - 1, n);
+  return n;
+}
+
+int f1697(int a, int b) {
+  int c = a * 54 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1348(a - 1, n);
+  return n;
+}
+
+int f1698(int a, int b) {
+  int c = a * 7 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f478(a - 1, n);
+  return n;
+}
+
+int f1699(int a, int b) {
+  int c = a * 4 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1369(a - 1, n);
+  return n;
+}
+
+int f1700(int a, int b) {
+  int c = a * 2 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 34)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1114(a - 1, n);
+  return n;
+}
+
+int f1701(int a, int b) {
+  int c = a * 80 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1400(a - 1, n);
+  return n;
+}
+
+int f1702(int a, int b) {
+  int c = a * 86 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1025(a - 1, n);
+  return n;
+}
+
+int f1703(int a, int b) {
+  int c = a * 6 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1511(a - 1, n);
+  return n;
+}
+
+int f1704(int a, int b) {
+  int c = a * 27 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f940(a - 1, n);
+  return n;
+}
+
+int f1705(int a, int b) {
+  int c = a * 48 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f9(a - 1, n);
+  return n;
+}
+
+int f1706(int a, int b) {
+  int c = a * 2 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1231(a - 1, n);
+  return n;
+}
+
+int f1707(int a, int b) {
+  int c = a * 3 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f768(a - 1, n);
+  return n;
+}
+
+int f1708(int a, int b) {
+  int c = a * 99 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f740(a - 1, n);
+  return n;
+}
+
+int f1709(int a, int b) {
+  int c = a * 70 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1526(a - 1, n);
+  return n;
+}
+
+int f1710(int a, int b) {
+  int c = a * 14 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f674(a - 1, n);
+  return n;
+}
+
+int f1711(int a, int b) {
+  int c = a * 48 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f228(a - 1, n);
+  return n;
+}
+
+int f1712(int a, int b) {
+  int c = a * 34 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 10)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f356(a - 1, n);
+  return n;
+}
+
+int f1713(int a, int b) {
+  int c = a * 96 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 27)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1293(a - 1, n);
+  return n;
+}
+
+int f1714(int a, int b) {
+  int c = a * 19 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1273(a - 1, n);
+  return n;
+}
+
+int f1715(int a, int b) {
+  int c = a * 46 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1575(a - 1, n);
+  return n;
+}
+
+int f1716(int a, int b) {
+  int c = a * 22 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f415(a - 1, n);
+  return n;
+}
+
+int f1717(int a, int b) {
+  int c = a * 64 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1315(a - 1, n);
+  return n;
+}
+
+int f1718(int a, int b) {
+  int c = a * 9 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1359(a - 1, n);
+  return n;
+}
+
+int f1719(int a, int b) {
+  int c = a * 29 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 4)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f305(a - 1, n);
+  return n;
+}
+
+int f1720(int a, int b) {
+  int c = a * 90 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1452(a - 1, n);
+  return n;
+}
+
+int f1721(int a, int b) {
+  int c = a * 35 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f204(a - 1, n);
+  return n;
+}
+
+int f1722(int a, int b) {
+  int c = a * 77 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f444(a - 1, n);
+  return n;
+}
+
+int f1723(int a, int b) {
+  int c = a * 62 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1099(a - 1, n);
+  return n;
+}
+
+int f1724(int a, int b) {
+  int c = a * 14 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1332(a - 1, n);
+  return n;
+}
+
+int f1725(int a, int b) {
+  int c = a * 99 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1499(a - 1, n);
+  return n;
+}
+
+int f1726(int a, int b) {
+  int c = a * 76 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1116(a - 1, n);
+  return n;
+}
+
+int f1727(int a, int b) {
+  int c = a * 87 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 19)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f737(a - 1, n);
+  return n;
+}
+
+int f1728(int a, int b) {
+  int c = a * 11 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1077(a - 1, n);
+  return n;
+}
+
+int f1729(int a, int b) {
+  int c = a * 39 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 43)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1357(a - 1, n);
+  return n;
+}
+
+int f1730(int a, int b) {
+  int c = a * 91 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 24)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f509(a - 1, n);
+  return n;
+}
+
+int f1731(int a, int b) {
+  int c = a * 66 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1391(a - 1, n);
+  return n;
+}
+
+int f1732(int a, int b) {
+  int c = a * 36 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f509(a - 1, n);
+  return n;
+}
+
+int f1733(int a, int b) {
+  int c = a * 13 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1180(a - 1, n);
+  return n;
+}
+
+int f1734(int a, int b) {
+  int c = a * 46 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f532(a - 1, n);
+  return n;
+}
+
+int f1735(int a, int b) {
+  int c = a * 47 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1653(a - 1, n);
+  return n;
+}
+
+int f1736(int a, int b) {
+  int c = a * 32 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f451(a - 1, n);
+  return n;
+}
+
+int f1737(int a, int b) {
+  int c = a * 42 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1245(a - 1, n);
+  return n;
+}
+
+int f1738(int a, int b) {
+  int c = a * 65 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 4)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1088(a - 1, n);
+  return n;
+}
+
+int f1739(int a, int b) {
+  int c = a * 80 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1106(a - 1, n);
+  return n;
+}
+
+int f1740(int a, int b) {
+  int c = a * 77 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1324(a - 1, n);
+  return n;
+}
+
+int f1741(int a, int b) {
+  int c = a * 54 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 8)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1602(a - 1, n);
+  return n;
+}
+
+int f1742(int a, int b) {
+  int c = a * 23 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f191(a - 1, n);
+  return n;
+}
+
+int f1743(int a, int b) {
+  int c = a * 13 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1154(a - 1, n);
+  return n;
+}
+
+int f1744(int a, int b) {
+  int c = a * 84 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f402(a - 1, n);
+  return n;
+}
+
+int f1745(int a, int b) {
+  int c = a * 98 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1404(a - 1, n);
+  return n;
+}
+
+int f1746(int a, int b) {
+  int c = a * 42 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1711(a - 1, n);
+  return n;
+}
+
+int f1747(int a, int b) {
+  int c = a * 9 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1423(a - 1, n);
+  return n;
+}
+
+int f1748(int a, int b) {
+  int c = a * 1 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1093(a - 1, n);
+  return n;
+}
+
+int f1749(int a, int b) {
+  int c = a * 32 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1587(a - 1, n);
+  return n;
+}
+
+int f1750(int a, int b) {
+  int c = a * 73 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 43)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f473(a - 1, n);
+  return n;
+}
+
+int f1751(int a, int b) {
+  int c = a * 36 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f963(a - 1, n);
+  return n;
+}
+
+int f1752(int a, int b) {
+  int c = a * 21 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1656(a - 1, n);
+  return n;
+}
+
+int f1753(int a, int b) {
+  int c = a * 77 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f795(a - 1, n);
+  return n;
+}
+
+int f1754(int a, int b) {
+  int c = a * 11 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 43)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f229(a - 1, n);
+  return n;
+}
+
+int f1755(int a, int b) {
+  int c = a * 76 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f432(a - 1, n);
+  return n;
+}
+
+int f1756(int a, int b) {
+  int c = a * 17 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1454(a - 1, n);
+  return n;
+}
+
+int f1757(int a, int b) {
+  int c = a * 17 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f124(a - 1, n);
+  return n;
+}
+
+int f1758(int a, int b) {
+  int c = a * 77 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f785(a - 1, n);
+  return n;
+}
+
+int f1759(int a, int b) {
+  int c = a * 21 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f795(a - 1, n);
+  return n;
+}
+
+int f1760(int a, int b) {
+  int c = a * 74 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1306(a - 1, n);
+  return n;
+}
+
+int f1761(int a, int b) {
+  int c = a * 89 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1464(a - 1, n);
+  return n;
+}
+
+int f1762(int a, int b) {
+  int c = a * 46 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f580(a - 1, n);
+  return n;
+}
+
+int f1763(int a, int b) {
+  int c = a * 66 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 24)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f16(a - 1, n);
+  return n;
+}
+
+int f1764(int a, int b) {
+  int c = a * 29 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1039(a - 1, n);
+  return n;
+}
+
+int f1765(int a, int b) {
+  int c = a * 46 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f719(a - 1, n);
+  return n;
+}
+
+int f1766(int a, int b) {
+  int c = a * 53 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1465(a - 1, n);
+  return n;
+}
+
+int f1767(int a, int b) {
+  int c = a * 45 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f243(a - 1, n);
+  return n;
+}
+
+int f1768(int a, int b) {
+  int c = a * 85 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 18)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1633(a - 1, n);
+  return n;
+}
+
+int f1769(int a, int b) {
+  int c = a * 97 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1180(a - 1, n);
+  return n;
+}
+
+int f1770(int a, int b) {
+  int c = a * 66 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1303(a - 1, n);
+  return n;
+}
+
+int f1771(int a, int b) {
+  int c = a * 80 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f947(a - 1, n);
+  return n;
+}
+
+int f1772(int a, int b) {
+  int c = a * 73 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f131(a - 1, n);
+  return n;
+}
+
+int f1773(int a, int b) {
+  int c = a * 0 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f805(a - 1, n);
+  return n;
+}
+
+int f1774(int a, int b) {
+  int c = a * 6 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f701(a - 1, n);
+  return n;
+}
+
+int f1775(int a, int b) {
+  int c = a * 12 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 18)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1539(a - 1, n);
+  return n;
+}
+
+int f1776(int a, int b) {
+  int c = a * 32 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f401(a - 1, n);
+  return n;
+}
+
+int f1777(int a, int b) {
+  int c = a * 45 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1093(a - 1, n);
+  return n;
+}
+
+int f1778(int a, int b) {
+  int c = a * 99 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1721(a - 1, n);
+  return n;
+}
+
+int f1779(int a, int b) {
+  int c = a * 86 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 34)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1601(a - 1, n);
+  return n;
+}
+
+int f1780(int a, int b) {
+  int c = a * 37 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f759(a - 1, n);
+  return n;
+}
+
+int f1781(int a, int b) {
+  int c = a * 77 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1227(a - 1, n);
+  return n;
+}
+
+int f1782(int a, int b) {
+  int c = a * 76 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1207(a - 1, n);
+  return n;
+}
+
+int f1783(int a, int b) {
+  int c = a * 35 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f60(a - 1, n);
+  return n;
+}
+
+int f1784(int a, int b) {
+  int c = a * 15 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1393(a - 1, n);
+  return n;
+}
+
+int f1785(int a, int b) {
+  int c = a * 1 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1424(a - 1, n);
+  return n;
+}
+
+int f1786(int a, int b) {
+  int c = a * 93 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1396(a - 1, n);
+  return n;
+}
+
+int f1787(int a, int b) {
+  int c = a * 62 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 42)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f12(a - 1, n);
+  return n;
+}
+
+int f1788(int a, int b) {
+  int c = a * 52 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f498(a - 1, n);
+  return n;
+}
+
+int f1789(int a, int b) {
+  int c = a * 5 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1153(a - 1, n);
+  return n;
+}
+
+int f1790(int a, int b) {
+  int c = a * 99 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 3)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f693(a - 1, n);
+  return n;
+}
+
+int f1791(int a, int b) {
+  int c = a * 37 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f291(a - 1, n);
+  return n;
+}
+
+int f1792(int a, int b) {
+  int c = a * 70 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1359(a - 1, n);
+  return n;
+}
+
+int f1793(int a, int b) {
+  int c = a * 25 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 42)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1612(a - 1, n);
+  return n;
+}
+
+int f1794(int a, int b) {
+  int c = a * 94 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1366(a - 1, n);
+  return n;
+}
+
+int f1795(int a, int b) {
+  int c = a * 45 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1517(a - 1, n);
+  return n;
+}
+
+int f1796(int a, int b) {
+  int c = a * 71 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1421(a - 1, n);
+  return n;
+}
+
+int f1797(int a, int b) {
+  int c = a * 16 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1691(a - 1, n);
+  return n;
+}
+
+int f1798(int a, int b) {
+  int c = a * 33 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f212(a - 1, n);
+  return n;
+}
+
+int f1799(int a, int b) {
+  int c = a * 48 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1014(a - 1, n);
+  return n;
+}
+
+int f1800(int a, int b) {
+  int c = a * 60 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1238(a - 1, n);
+  return n;
+}
+
+int f1801(int a, int b) {
+  int c = a * 74 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 32)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f675(a - 1, n);
+  return n;
+}
+
+int f1802(int a, int b) {
+  int c = a * 49 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1421(a - 1, n);
+  return n;
+}
+
+int f1803(int a, int b) {
+  int c = a * 1 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1419(a - 1, n);
+  return n;
+}
+
+int f1804(int a, int b) {
+  int c = a * 22 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f808(a - 1, n);
+  return n;
+}
+
+int f1805(int a, int b) {
+  int c = a * 13 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1641(a - 1, n);
+  return n;
+}
+
+int f1806(int a, int b) {
+  int c = a * 83 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 42)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1576(a - 1, n);
+  return n;
+}
+
+int f1807(int a, int b) {
+  int c = a * 54 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 34)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1004(a - 1, n);
+  return n;
+}
+
+int f1808(int a, int b) {
+  int c = a * 37 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 8)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f497(a - 1, n);
+  return n;
+}
+
+int f1809(int a, int b) {
+  int c = a * 10 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f466(a - 1, n);
+  return n;
+}
+
+int f1810(int a, int b) {
+  int c = a * 88 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1540(a - 1, n);
+  return n;
+}
+
+int f1811(int a, int b) {
+  int c = a * 60 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f833(a - 1, n);
+  return n;
+}
+
+int f1812(int a, int b) {
+  int c = a * 89 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 42)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f190(a - 1, n);
+  return n;
+}
+
+int f1813(int a, int b) {
+  int c = a * 11 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1274(a - 1, n);
+  return n;
+}
+
+int f1814(int a, int b) {
+  int c = a * 90 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1655(a - 1, n);
+  return n;
+}
+
+int f1815(int a, int b) {
+  int c = a * 61 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f349(a - 1, n);
+  return n;
+}
+
+int f1816(int a, int b) {
+  int c = a * 6 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f451(a - 1, n);
+  return n;
+}
+
+int f1817(int a, int b) {
+  int c = a * 0 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f85(a - 1, n);
+  return n;
+}
+
+int f1818(int a, int b) {
+  int c = a * 19 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f516(a - 1, n);
+  return n;
+}
+
+int f1819(int a, int b) {
+  int c = a * 44 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 42)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f669(a - 1, n);
+  return n;
+}
+
+int f1820(int a, int b) {
+  int c = a * 0 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f563(a - 1, n);
+  return n;
+}
+
+int f1821(int a, int b) {
+  int c = a * 46 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1292(a - 1, n);
+  return n;
+}
+
+int f1822(int a, int b) {
+  int c = a * 18 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1739(a - 1, n);
+  return n;
+}
+
+int f1823(int a, int b) {
+  int c = a * 75 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f127(a - 1, n);
+  return n;
+}
+
+int f1824(int a, int b) {
+  int c = a * 93 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 34)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f458(a - 1, n);
+  return n;
+}
+
+int f1825(int a, int b) {
+  int c = a * 9 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1473(a - 1, n);
+  return n;
+}
+
+int f1826(int a, int b) {
+  int c = a * 2 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1001(a - 1, n);
+  return n;
+}
+
+int f1827(int a, int b) {
+  int c = a * 67 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f114(a - 1, n);
+  return n;
+}
+
+int f1828(int a, int b) {
+  int c = a * 32 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f773(a - 1, n);
+  return n;
+}
+
+int f1829(int a, int b) {
+  int c = a * 54 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f29(a - 1, n);
+  return n;
+}
+
+int f1830(int a, int b) {
+  int c = a * 65 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f533(a - 1, n);
+  return n;
+}
+
+int f1831(int a, int b) {
+  int c = a * 14 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1151(a - 1, n);
+  return n;
+}
+
+int f1832(int a, int b) {
+  int c = a * 83 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 4)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1665(a - 1, n);
+  return n;
+}
+
+int f1833(int a, int b) {
+  int c = a * 52 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 18)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1441(a - 1, n);
+  return n;
+}
+
+int f1834(int a, int b) {
+  int c = a * 44 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 34)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f282(a - 1, n);
+  return n;
+}
+
+int f1835(int a, int b) {
+  int c = a * 54 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 24)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f119(a - 1, n);
+  return n;
+}
+
+int f1836(int a, int b) {
+  int c = a * 2 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 27)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f417(a - 1, n);
+  return n;
+}
+
+int f1837(int a, int b) {
+  int c = a * 49 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 34)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f969(a - 1, n);
+  return n;
+}
+
+int f1838(int a, int b) {
+  int c = a * 77 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 8)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1163(a - 1, n);
+  return n;
+}
+
+int f1839(int a, int b) {
+  int c = a * 46 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1232(a - 1, n);
+  return n;
+}
+
+int f1840(int a, int b) {
+  int c = a * 66 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1006(a - 1, n);
+  return n;
+}
+
+int f1841(int a, int b) {
+  int c = a * 18 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f547(a - 1, n);
+  return n;
+}
+
+int f1842(int a, int b) {
+  int c = a * 37 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 42)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1488(a - 1, n);
+  return n;
+}
+
+int f1843(int a, int b) {
+  int c = a * 8 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1568(a - 1, n);
+  return n;
+}
+
+int f1844(int a, int b) {
+  int c = a * 93 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f799(a - 1, n);
+  return n;
+}
+
+int f1845(int a, int b) {
+  int c = a * 23 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f610(a - 1, n);
+  return n;
+}
+
+int f1846(int a, int b) {
+  int c = a * 97 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f247(a - 1, n);
+  return n;
+}
+
+int f1847(int a, int b) {
+  int c = a * 95 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 18)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f647(a - 1, n);
+  return n;
+}
+
+int f1848(int a, int b) {
+  int c = a * 39 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 36)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f140(a - 1, n);
+  return n;
+}
+
+int f1849(int a, int b) {
+  int c = a * 2 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f657(a - 1, n);
+  return n;
+}
+
+int f1850(int a, int b) {
+  int c = a * 67 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1251(a - 1, n);
+  return n;
+}
+
+int f1851(int a, int b) {
+  int c = a * 93 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 24)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f224(a - 1, n);
+  return n;
+}
+
+int f1852(int a, int b) {
+  int c = a * 78 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1013(a - 1, n);
+  return n;
+}
+
+int f1853(int a, int b) {
+  int c = a * 44 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1187(a - 1, n);
+  return n;
+}
+
+int f1854(int a, int b) {
+  int c = a * 76 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1839(a - 1, n);
+  return n;
+}
+
+int f1855(int a, int b) {
+  int c = a * 54 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f895(a - 1, n);
+  return n;
+}
+
+int f1856(int a, int b) {
+  int c = a * 33 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 24)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f713(a - 1, n);
+  return n;
+}
+
+int f1857(int a, int b) {
+  int c = a * 81 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f641(a - 1, n);
+  return n;
+}
+
+int f1858(int a, int b) {
+  int c = a * 18 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1263(a - 1, n);
+  return n;
+}
+
+int f1859(int a, int b) {
+  int c = a * 24 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f625(a - 1, n);
+  return n;
+}
+
+int f1860(int a, int b) {
+  int c = a * 98 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1197(a - 1, n);
+  return n;
+}
+
+int f1861(int a, int b) {
+  int c = a * 76 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f279(a - 1, n);
+  return n;
+}
+
+int f1862(int a, int b) {
+  int c = a * 14 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 19)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1531(a - 1, n);
+  return n;
+}
+
+int f1863(int a, int b) {
+  int c = a * 76 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1156(a - 1, n);
+  return n;
+}
+
+int f1864(int a, int b) {
+  int c = a * 17 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 3)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1782(a - 1, n);
+  return n;
+}
+
+int f1865(int a, int b) {
+  int c = a * 96 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f890(a - 1, n);
+  return n;
+}
+
+int f1866(int a, int b) {
+  int c = a * 83 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1524(a - 1, n);
+  return n;
+}
+
+int f1867(int a, int b) {
+  int c = a * 89 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f29(a - 1, n);
+  return n;
+}
+
+int f1868(int a, int b) {
+  int c = a * 40 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f377(a - 1, n);
+  return n;
+}
+
+int f1869(int a, int b) {
+  int c = a * 5 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1415(a - 1, n);
+  return n;
+}
+
+int f1870(int a, int b) {
+  int c = a * 40 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 19)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f292(a - 1, n);
+  return n;
+}
+
+int f1871(int a, int b) {
+  int c = a * 42 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1368(a - 1, n);
+  return n;
+}
+
+int f1872(int a, int b) {
+  int c = a * 12 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 10)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f827(a - 1, n);
+  return n;
+}
+
+int f1873(int a, int b) {
+  int c = a * 49 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1280(a - 1, n);
+  return n;
+}
+
+int f1874(int a, int b) {
+  int c = a * 19 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1117(a - 1, n);
+  return n;
+}
+
+int f1875(int a, int b) {
+  int c = a * 35 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 36)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f607(a - 1, n);
+  return n;
+}
+
+int f1876(int a, int b) {
+  int c = a * 10 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f720(a - 1, n);
+  return n;
+}
+
+int f1877(int a, int b) {
+  int c = a * 74 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f16(a - 1, n);
+  return n;
+}
+
+int f1878(int a, int b) {
+  int c = a * 9 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1272(a - 1, n);
+  return n;
+}
+
+int f1879(int a, int b) {
+  int c = a * 7 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1452(a - 1, n);
+  return n;
+}
+
+int f1880(int a, int b) {
+  int c = a * 42 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 22)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f307(a - 1, n);
+  return n;
+}
+
+int f1881(int a, int b) {
+  int c = a * 50 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f539(a - 1, n);
+  return n;
+}
+
+int f1882(int a, int b) {
+  int c = a * 45 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f121(a - 1, n);
+  return n;
+}
+
+int f1883(int a, int b) {
+  int c = a * 32 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1215(a - 1, n);
+  return n;
+}
+
+int f1884(int a, int b) {
+  int c = a * 29 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f547(a - 1, n);
+  return n;
+}
+
+int f1885(int a, int b) {
+  int c = a * 65 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f335(a - 1, n);
+  return n;
+}
+
+int f1886(int a, int b) {
+  int c = a * 31 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f821(a - 1, n);
+  return n;
+}
+
+int f1887(int a, int b) {
+  int c = a * 19 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f421(a - 1, n);
+  return n;
+}
+
+int f1888(int a, int b) {
+  int c = a * 37 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 45)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f920(a - 1, n);
+  return n;
+}
+
+int f1889(int a, int b) {
+  int c = a * 69 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f672(a - 1, n);
+  return n;
+}
+
+int f1890(int a, int b) {
+  int c = a * 22 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1120(a - 1, n);
+  return n;
+}
+
+int f1891(int a, int b) {
+  int c = a * 67 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1294(a - 1, n);
+  return n;
+}
+
+int f1892(int a, int b) {
+  int c = a * 7 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 25)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1234(a - 1, n);
+  return n;
+}
+
+int f1893(int a, int b) {
+  int c = a * 84 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1164(a - 1, n);
+  return n;
+}
+
+int f1894(int a, int b) {
+  int c = a * 75 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f494(a - 1, n);
+  return n;
+}
+
+int f1895(int a, int b) {
+  int c = a * 8 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1156(a - 1, n);
+  return n;
+}
+
+int f1896(int a, int b) {
+  int c = a * 52 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f343(a - 1, n);
+  return n;
+}
+
+int f1897(int a, int b) {
+  int c = a * 37 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1042(a - 1, n);
+  return n;
+}
+
+int f1898(int a, int b) {
+  int c = a * 30 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 2)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f140(a - 1, n);
+  return n;
+}
+
+int f1899(int a, int b) {
+  int c = a * 67 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 8)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f651(a - 1, n);
+  return n;
+}
+
+int f1900(int a, int b) {
+  int c = a * 23 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1050(a - 1, n);
+  return n;
+}
+
+int f1901(int a, int b) {
+  int c = a * 11 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f209(a - 1, n);
+  return n;
+}
+
+int f1902(int a, int b) {
+  int c = a * 10 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f572(a - 1, n);
+  return n;
+}
+
+int f1903(int a, int b) {
+  int c = a * 53 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f667(a - 1, n);
+  return n;
+}
+
+int f1904(int a, int b) {
+  int c = a * 76 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 16)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f200(a - 1, n);
+  return n;
+}
+
+int f1905(int a, int b) {
+  int c = a * 14 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 48)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f332(a - 1, n);
+  return n;
+}
+
+int f1906(int a, int b) {
+  int c = a * 4 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f554(a - 1, n);
+  return n;
+}
+
+int f1907(int a, int b) {
+  int c = a * 33 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f833(a - 1, n);
+  return n;
+}
+
+int f1908(int a, int b) {
+  int c = a * 74 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 28)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f900(a - 1, n);
+  return n;
+}
+
+int f1909(int a, int b) {
+  int c = a * 20 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 8)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f587(a - 1, n);
+  return n;
+}
+
+int f1910(int a, int b) {
+  int c = a * 22 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1667(a - 1, n);
+  return n;
+}
+
+int f1911(int a, int b) {
+  int c = a * 73 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 25)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f716(a - 1, n);
+  return n;
+}
+
+int f1912(int a, int b) {
+  int c = a * 38 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 36)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1584(a - 1, n);
+  return n;
+}
+
+int f1913(int a, int b) {
+  int c = a * 66 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f518(a - 1, n);
+  return n;
+}
+
+int f1914(int a, int b) {
+  int c = a * 78 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 39)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1038(a - 1, n);
+  return n;
+}
+
+int f1915(int a, int b) {
+  int c = a * 72 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 3)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f346(a - 1, n);
+  return n;
+}
+
+int f1916(int a, int b) {
+  int c = a * 65 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 43)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1032(a - 1, n);
+  return n;
+}
+
+int f1917(int a, int b) {
+  int c = a * 45 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f969(a - 1, n);
+  return n;
+}
+
+int f1918(int a, int b) {
+  int c = a * 5 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1440(a - 1, n);
+  return n;
+}
+
+int f1919(int a, int b) {
+  int c = a * 66 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 27)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f223(a - 1, n);
+  return n;
+}
+
+int f1920(int a, int b) {
+  int c = a * 37 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1225(a - 1, n);
+  return n;
+}
+
+int f1921(int a, int b) {
+  int c = a * 51 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f81(a - 1, n);
+  return n;
+}
+
+int f1922(int a, int b) {
+  int c = a * 19 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1612(a - 1, n);
+  return n;
+}
+
+int f1923(int a, int b) {
+  int c = a * 20 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f826(a - 1, n);
+  return n;
+}
+
+int f1924(int a, int b) {
+  int c = a * 19 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 41)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f636(a - 1, n);
+  return n;
+}
+
+int f1925(int a, int b) {
+  int c = a * 80 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 11)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f592(a - 1, n);
+  return n;
+}
+
+int f1926(int a, int b) {
+  int c = a * 54 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f133(a - 1, n);
+  return n;
+}
+
+int f1927(int a, int b) {
+  int c = a * 15 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1012(a - 1, n);
+  return n;
+}
+
+int f1928(int a, int b) {
+  int c = a * 99 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 47)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1035(a - 1, n);
+  return n;
+}
+
+int f1929(int a, int b) {
+  int c = a * 59 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 30)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f246(a - 1, n);
+  return n;
+}
+
+int f1930(int a, int b) {
+  int c = a * 61 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1484(a - 1, n);
+  return n;
+}
+
+int f1931(int a, int b) {
+  int c = a * 19 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1814(a - 1, n);
+  return n;
+}
+
+int f1932(int a, int b) {
+  int c = a * 92 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1003(a - 1, n);
+  return n;
+}
+
+int f1933(int a, int b) {
+  int c = a * 61 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 14)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1156(a - 1, n);
+  return n;
+}
+
+int f1934(int a, int b) {
+  int c = a * 13 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 20)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f303(a - 1, n);
+  return n;
+}
+
+int f1935(int a, int b) {
+  int c = a * 97 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 49)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f13(a - 1, n);
+  return n;
+}
+
+int f1936(int a, int b) {
+  int c = a * 0 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 27)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1757(a - 1, n);
+  return n;
+}
+
+int f1937(int a, int b) {
+  int c = a * 88 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 42)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1736(a - 1, n);
+  return n;
+}
+
+int f1938(int a, int b) {
+  int c = a * 80 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1854(a - 1, n);
+  return n;
+}
+
+int f1939(int a, int b) {
+  int c = a * 83 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1036(a - 1, n);
+  return n;
+}
+
+int f1940(int a, int b) {
+  int c = a * 10 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1718(a - 1, n);
+  return n;
+}
+
+int f1941(int a, int b) {
+  int c = a * 15 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 35)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f964(a - 1, n);
+  return n;
+}
+
+int f1942(int a, int b) {
+  int c = a * 98 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1874(a - 1, n);
+  return n;
+}
+
+int f1943(int a, int b) {
+  int c = a * 78 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f25(a - 1, n);
+  return n;
+}
+
+int f1944(int a, int b) {
+  int c = a * 5 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 24)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1367(a - 1, n);
+  return n;
+}
+
+int f1945(int a, int b) {
+  int c = a * 82 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 3)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1097(a - 1, n);
+  return n;
+}
+
+int f1946(int a, int b) {
+  int c = a * 19 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 25)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f937(a - 1, n);
+  return n;
+}
+
+int f1947(int a, int b) {
+  int c = a * 92 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 25)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1930(a - 1, n);
+  return n;
+}
+
+int f1948(int a, int b) {
+  int c = a * 42 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f273(a - 1, n);
+  return n;
+}
+
+int f1949(int a, int b) {
+  int c = a * 94 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f597(a - 1, n);
+  return n;
+}
+
+int f1950(int a, int b) {
+  int c = a * 14 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f513(a - 1, n);
+  return n;
+}
+
+int f1951(int a, int b) {
+  int c = a * 10 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1526(a - 1, n);
+  return n;
+}
+
+int f1952(int a, int b) {
+  int c = a * 12 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 27)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1019(a - 1, n);
+  return n;
+}
+
+int f1953(int a, int b) {
+  int c = a * 44 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1314(a - 1, n);
+  return n;
+}
+
+int f1954(int a, int b) {
+  int c = a * 67 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1177(a - 1, n);
+  return n;
+}
+
+int f1955(int a, int b) {
+  int c = a * 2 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 3)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1930(a - 1, n);
+  return n;
+}
+
+int f1956(int a, int b) {
+  int c = a * 37 + b;
+  int n = 0;
+  for (int i = 0; i < 3; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1923(a - 1, n);
+  return n;
+}
+
+int f1957(int a, int b) {
+  int c = a * 23 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 46)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f525(a - 1, n);
+  return n;
+}
+
+int f1958(int a, int b) {
+  int c = a * 46 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 25)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f689(a - 1, n);
+  return n;
+}
+
+int f1959(int a, int b) {
+  int c = a * 60 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1149(a - 1, n);
+  return n;
+}
+
+int f1960(int a, int b) {
+  int c = a * 91 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 18)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f658(a - 1, n);
+  return n;
+}
+
+int f1961(int a, int b) {
+  int c = a * 14 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f766(a - 1, n);
+  return n;
+}
+
+int f1962(int a, int b) {
+  int c = a * 42 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 13)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1163(a - 1, n);
+  return n;
+}
+
+int f1963(int a, int b) {
+  int c = a * 99 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 6)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f898(a - 1, n);
+  return n;
+}
+
+int f1964(int a, int b) {
+  int c = a * 87 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 5)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1369(a - 1, n);
+  return n;
+}
+
+int f1965(int a, int b) {
+  int c = a * 23 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1614(a - 1, n);
+  return n;
+}
+
+int f1966(int a, int b) {
+  int c = a * 66 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1131(a - 1, n);
+  return n;
+}
+
+int f1967(int a, int b) {
+  int c = a * 7 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 12)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f301(a - 1, n);
+  return n;
+}
+
+int f1968(int a, int b) {
+  int c = a * 43 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 33)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f829(a - 1, n);
+  return n;
+}
+
+int f1969(int a, int b) {
+  int c = a * 22 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 43)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f230(a - 1, n);
+  return n;
+}
+
+int f1970(int a, int b) {
+  int c = a * 4 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 17)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1129(a - 1, n);
+  return n;
+}
+
+int f1971(int a, int b) {
+  int c = a * 10 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 15)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1110(a - 1, n);
+  return n;
+}
+
+int f1972(int a, int b) {
+  int c = a * 79 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1681(a - 1, n);
+  return n;
+}
+
+int f1973(int a, int b) {
+  int c = a * 34 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f5(a - 1, n);
+  return n;
+}
+
+int f1974(int a, int b) {
+  int c = a * 17 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f215(a - 1, n);
+  return n;
+}
+
+int f1975(int a, int b) {
+  int c = a * 38 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 21)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f11(a - 1, n);
+  return n;
+}
+
+int f1976(int a, int b) {
+  int c = a * 14 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1413(a - 1, n);
+  return n;
+}
+
+int f1977(int a, int b) {
+  int c = a * 76 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 31)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1913(a - 1, n);
+  return n;
+}
+
+int f1978(int a, int b) {
+  int c = a * 81 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 18)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f306(a - 1, n);
+  return n;
+}
+
+int f1979(int a, int b) {
+  int c = a * 63 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 1)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1031(a - 1, n);
+  return n;
+}
+
+int f1980(int a, int b) {
+  int c = a * 99 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 24)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1195(a - 1, n);
+  return n;
+}
+
+int f1981(int a, int b) {
+  int c = a * 61 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 29)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1819(a - 1, n);
+  return n;
+}
+
+int f1982(int a, int b) {
+  int c = a * 3 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 7)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f378(a - 1, n);
+  return n;
+}
+
+int f1983(int a, int b) {
+  int c = a * 15 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f390(a - 1, n);
+  return n;
+}
+
+int f1984(int a, int b) {
+  int c = a * 72 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f852(a - 1, n);
+  return n;
+}
+
+int f1985(int a, int b) {
+  int c = a * 46 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 26)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f746(a - 1, n);
+  return n;
+}
+
+int f1986(int a, int b) {
+  int c = a * 64 + b;
+  int n = 0;
+  for (int i = 0; i < 1; i++) {
+    int j = i * c;
+    if (j > 23)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f118(a - 1, n);
+  return n;
+}
+
+int f1987(int a, int b) {
+  int c = a * 81 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 44)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1720(a - 1, n);
+  return n;
+}
+
+int f1988(int a, int b) {
+  int c = a * 29 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 40)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f385(a - 1, n);
+  return n;
+}
+
+int f1989(int a, int b) {
+  int c = a * 20 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f320(a - 1, n);
+  return n;
+}
+
+int f1990(int a, int b) {
+  int c = a * 56 + b;
+  int n = 0;
+  for (int i = 0; i < 7; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1819(a - 1, n);
+  return n;
+}
+
+int f1991(int a, int b) {
+  int c = a * 85 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 37)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1441(a - 1, n);
+  return n;
+}
+
+int f1992(int a, int b) {
+  int c = a * 27 + b;
+  int n = 0;
+  for (int i = 0; i < 4; i++) {
+    int j = i * c;
+    if (j > 27)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f655(a - 1, n);
+  return n;
+}
+
+int f1993(int a, int b) {
+  int c = a * 51 + b;
+  int n = 0;
+  for (int i = 0; i < 10; i++) {
+    int j = i * c;
+    if (j > 24)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1190(a - 1, n);
+  return n;
+}
+
+int f1994(int a, int b) {
+  int c = a * 24 + b;
+  int n = 0;
+  for (int i = 0; i < 6; i++) {
+    int j = i * c;
+    if (j > 10)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f677(a - 1, n);
+  return n;
+}
+
+int f1995(int a, int b) {
+  int c = a * 81 + b;
+  int n = 0;
+  for (int i = 0; i < 9; i++) {
+    int j = i * c;
+    if (j > 25)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1300(a - 1, n);
+  return n;
+}
+
+int f1996(int a, int b) {
+  int c = a * 94 + b;
+  int n = 0;
+  for (int i = 0; i < 2; i++) {
+    int j = i * c;
+    if (j > 34)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1320(a - 1, n);
+  return n;
+}
+
+int f1997(int a, int b) {
+  int c = a * 33 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 38)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f316(a - 1, n);
+  return n;
+}
+
+int f1998(int a, int b) {
+  int c = a * 44 + b;
+  int n = 0;
+  for (int i = 0; i < 8; i++) {
+    int j = i * c;
+    if (j > 0)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f240(a - 1, n);
+  return n;
+}
+
+int f1999(int a, int b) {
+  int c = a * 19 + b;
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    int j = i * c;
+    if (j > 9)
+      n = n + j - a;
+    else
+      n = n ^ b;
+  }
+  n = n + f1617(a - 1, n);
+  return n;
+}
+
+int main() {
+  printf("%d\n", f1999(1, 2));
+  return 0;
+}
@@ -0,0 +1,12007 @@
+int printf();
+
+int g0;
+short g1;
+char g2;
+int g3;
+int g4;
+long g5;
+int g6;
+int g7;
+short g8;
+int g9;
+long g10;
+int g11;
+char g12;
+char g13;
+int g14;
+char g15;
+int g16;
+long g17;
+char g18;
+short g19;
+long g20;
+short g21;
+int g22;
+int g23;
+short g24;
+char g25;
+char g26;
+char g27;
+short g28;
+char g29;
+long g30;
+int g31;
+char g32;
+short g33;
+int g34;
+int g35;
+int g36;
+int g37;
+char g38;
+short g39;
+long g40;
+char g41;
+int g42;
+char g43;
+short g44;
+int g45;
+char g46;
+short g47;
+long g48;
+int g49;
+int g50;
+char g51;
+char g52;
+int g53;
+short g54;
+char g55;
+int g56;
+long g57;
+long g58;
+int g59;
+short g60;
+int g61;
+char g62;
+short g63;
+long g64;
+long g65;
+long g66;
+char g67;
+int g68;
+long g69;
+int g70;
+short g71;
+short g72;
+char g73;
+long g74;
+char g75;
+short g76;
+int g77;
+long g78;
+short g79;
+short g80;
+long g81;
+long g82;
+int g83;
+int g84;
+short g85;
+char g86;
+long g87;
+char g88;
+int g89;
+int g90;
+char g91;
+long g92;
+int g93;
+short g94;
+int g95;
+short g96;
+char g97;
+long g98;
+char g99;
+short g100;
+char g101;
+int g102;
+int g103;
+int g104;
+short g105;
+char g106;
+long g107;
+int g108;
+char g109;
+int g110;
+char g111;
+long g112;
+short g113;
+short g114;
+short g115;
+long g116;
+char g117;
+short g118;
+char g119;
+int g120;
+char g121;
+long g122;
+short g123;
+long g124;
+short g125;
+int g126;
+char g127;
+int g128;
+char g129;
+char g130;
+short g131;
+char g132;
+long g133;
+int g134;
+int g135;
+int g136;
+long g137;
+long g138;
+long g139;
+int g140;
+char g141;
+int g142;
+short g143;
+short g144;
+short g145;
+char g146;
+int g147;
+long g148;
+int g149;
+short g150;
+short g151;
+short g152;
+short g153;
+int g154;
+short g155;
+short g156;
+short g157;
+int g158;
+long g159;
+char g160;
+short g161;
+int g162;
+int g163;
+int g164;
+short g165;
+int g166;
+long g167;
+short g168;
+short g169;
+int g170;
+short g171;
+char g172;
+char g173;
+short g174;
+int g175;
+char g176;
+short g177;
+long g178;
+long g179;
+short g180;
+char g181;
+short g182;
+short g183;
+int g184;
+int g185;
+int g186;
+long g187;
+short g188;
+int g189;
+char g190;
+short g191;
+char g192;
+int g193;
+char g194;
+short g195;
+char g196;
+short g197;
+char g198;
+short g199;
+short g200;
+char g201;
+int g202;
+int g203;
+int g204;
+long g205;
+int g206;
+short g207;
+long g208;
+char g209;
+char g210;
+short g211;
+short g212;
+short g213;
+int g214;
+short g215;
+char g216;
+short g217;
+int g218;
+int g219;
+char g220;
+short g221;
+int g222;
+char g223;
+short g224;
+short g225;
+short g226;
+char g227;
+long g228;
+long g229;
+int g230;
+int g231;
+short g232;
+char g233;
+int g234;
+char g235;
+long g236;
+long g237;
+short g238;
+short g239;
+int g240;
+int g241;
+short g242;
+long g243;
+short g244;
+long g245;
+long g246;
+long g247;
+short g248;
+short g249;
+long g250;
+char g251;
+short g252;
+long g253;
+int g254;
+short g255;
+int g256;
+short g257;
+long g258;
+int g259;
+char g260;
+int g261;
+long g262;
+char g263;
+int g264;
+short g265;
+short g266;
+char g267;
+short g268;
+short g269;
+char g270;
+int g271;
+short g272;
+char g273;
+int g274;
+int g275;
+char g276;
+long g277;
+char g278;
+char g279;
+int g280;
+long g281;
+int g282;
+long g283;
+short g284;
+char g285;
+long g286;
+long g287;
+char g288;
+short g289;
+char g290;
+short g291;
+short g292;
+int g293;
+short g294;
+int g295;
+short g296;
+long g297;
+int g298;
+short g299;
+int g300;
+long g301;
+short g302;
+char g303;
+short g304;
+long g305;
+char g306;
+char g307;
+short g308;
+int g309;
+long g310;
+short g311;
+long g312;
+short g313;
+long g314;
+short g315;
+long g316;
+int g317;
+int g318;
+long g319;
+long g320;
+long g321;
+long g322;
+long g323;
+char g324;
+short g325;
+int g326;
+char g327;
+long g328;
+int g329;
+short g330;
+char g331;
+char g332;
+long g333;
+int g334;
+char g335;
+short g336;
+int g337;
+char g338;
+int g339;
+int g340;
+int g341;
+long g342;
+long g343;
+short g344;
+long g345;
+long g346;
+int g347;
+long g348;
+short g349;
+long g350;
+long g351;
+long g352;
+long g353;
+long g354;
+long g355;
+long g356;
+int g357;
+short g358;
+int g359;
+short g360;
+char g361;
+long g362;
+int g363;
+long g364;
+short g365;
+char g366;
+short g367;
+long g368;
+long g369;
+int g370;
+long g371;
+char g372;
+char g373;
+long g374;
+char g375;
+long g376;
+long g377;
+long g378;
+long g379;
+int g380;
+short g381;
+short g382;
+long g383;
+short g384;
+short g385;
+long g386;
+int g387;
+short g388;
+long g389;
+int g390;
+char g391;
+long g392;
+char g393;
+int g394;
+int g395;
+long g396;
+short g397;
+short g398;
+char g399;
+char g400;
+char g401;
+char g402;
+char g403;
+char g404;
+short g405;
+long g406;
+long g407;
+short g408;
+short g409;
+long g410;
+long g411;
+long g412;
+short g413;
+short g414;
+char g415;
+long g416;
+char g417;
+int g418;
+int g419;
+int g420;
+short g421;
+long g422;
+long g423;
+char g424;
+long g425;
+short g426;
+long g427;
+int g428;
+short g429;
+long g430;
+short g431;
+short g432;
+short g433;
+int g434;
+long g435;
+short g436;
+short g437;
+char g438;
+char g439;
+long g440;
+short g441;
+long g442;
+short g443;
+char g444;
+short g445;
+short g446;
+char g447;
+int g448;
+long g449;
+short g450;
+char g451;
+int g452;
+int g453;
+char g454;
+int g455;
+int g456;
+long g457;
+char g458;
+char g459;
+int g460;
+short g461;
+char g462;
+short g463;
+long g464;
+short g465;
+long g466;
+short g467;
+int g468;
+short g469;
+long g470;
+short g471;
+char g472;
+char g473;
+int g474;
+char g475;
+long g476;
+char g477;
+int g478;
+int g479;
+int g480;
+char g481;
+int g482;
+char g483;
+int g484;
+short g485;
+short g486;
+short g487;
+short g488;
+short g489;
+long g490;
+int g491;
+short g492;
+short g493;
+short g494;
+short g495;
+char g496;
+char g497;
+long g498;
+short g499;
+char g500;
+short g501;
+char g502;
+short g503;
+long g504;
+short g505;
+int g506;
+long g507;
+char g508;
+long g509;
+short g510;
+int g511;
+short g512;
+int g513;
+char g514;
+long g515;
+char g516;
+long g517;
+int g518;
+short g519;
+long g520;
+long g521;
+long g522;
+long g523;
+int g524;
+int g525;
+long g526;
+char g527;
+long g528;
+int g529;
+char g530;
+short g531;
+char g532;
+long g533;
+char g534;
+long g535;
+long g536;
+short g537;
+long g538;
+long g539;
+char g540;
+int g541;
+short g542;
+int g543;
+int g544;
+int g545;
+short g546;
+short g547;
+long g548;
+int g549;
+int g550;
+long g551;
+int g552;
+int g553;
+int g554;
+short g555;
+long g556;
+char g557;
+short g558;
+long g559;
+char g560;
+int g561;
+char g562;
+short g563;
+char g564;
+char g565;
+long g566;
+char g567;
+char g568;
+long g569;
+long g570;
+long g571;
+int g572;
+char g573;
+short g574;
+char g575;
+char g576;
+long g577;
+short g578;
+long g579;
+int g580;
+long g581;
+char g582;
+int g583;
+short g584;
+short g585;
+long g586;
+int g587;
+char g588;
+short g589;
+short g590;
+char g591;
+char g592;
+long g593;
+short g594;
+char g595;
+int g596;
+int g597;
+short g598;
+int g599;
+int g600;
+long g601;
+short g602;
+char g603;
+int g604;
+char g605;
+long g606;
+long g607;
+int g608;
+char g609;
+short g610;
+short g611;
+long g612;
+int g613;
+short g614;
+long g615;
+int g616;
+long g617;
+short g618;
+short g619;
+short g620;
+long g621;
+long g622;
+char g623;
+int g624;
+int g625;
+long g626;
+char g627;
+char g628;
+long g629;
+long g630;
+short g631;
+char g632;
+short g633;
+char g634;
+short g635;
+int g636;
+short g637;
+int g638;
+char g639;
+short g640;
+short g641;
+long g642;
+long g643;
+int g644;
+long g645;
+long g646;
+char g647;
+int g648;
+char g649;
+short g650;
+char g651;
+char g652;
+long g653;
+short g654;
+long g655;
+char g656;
+long g657;
+long g658;
+long g659;
+long g660;
+short g661;
+int g662;
+char g663;
+int g664;
+char g665;
+short g666;
+long g667;
+short g668;
+int g669;
+short g670;
+int g671;
+long g672;
+long g673;
+short g674;
+long g675;
+long g676;
+short g677;
+long g678;
+char g679;
+short g680;
+int g681;
+short g682;
+char g683;
+long g684;
+char g685;
+long g686;
+short g687;
+long g688;
+short g689;
+char g690;
+short g691;
+char g692;
+short g693;
+char g694;
+char g695;
+long g696;
+char g697;
+long g698;
+int g699;
+char g700;
+long g701;
+long g702;
+short g703;
+char g704;
+long g705;
+short g706;
+long g707;
+long g708;
+long g709;
+short g710;
+char g711;
+int g712;
+int g713;
+int g714;
+int g715;
+char g716;
+long g717;
+short g718;
+int g719;
+short g720;
+long g721;
+char g722;
+int g723;
+int g724;
+long g725;
+int g726;
+short g727;
+int g728;
+char g729;
+short g730;
+short g731;
+int g732;
+long g733;
+int g734;
+char g735;
+long g736;
+char g737;
+short g738;
+int g739;
+int g740;
+char g741;
+char g742;
+long g743;
+long g744;
+short g745;
+long g746;
+char g747;
+long g748;
+long g749;
+long g750;
+int g751;
+short g752;
+long g753;
+short g754;
+long g755;
+char g756;
+char g757;
+short g758;
+long g759;
+char g760;
+int g761;
+long g762;
+int g763;
+char g764;
+short g765;
+int g766;
+long g767;
+short g768;
+char g769;
+short g770;
+int g771;
+long g772;
+short g773;
+long g774;
+char g775;
+short g776;
+short g777;
+long g778;
+long g779;
+long g780;
+char g781;
+short g782;
+short g783;
+char g784;
+int g785;
+int g786;
+int g787;
+short g788;
+long g789;
+long g790;
+int g791;
+short g792;
+long g793;
+long g794;
+char g795;
+char g796;
+char g797;
+short g798;
+int g799;
+short g800;
+long g801;
+short g802;
+int g803;
+long g804;
+int g805;
+short g806;
+short g807;
+long g808;
+int g809;
+int g810;
+long g811;
+char g812;
+long g813;
+short g814;
+int g815;
+short g816;
+long g817;
+char g818;
+short g819;
+char g820;
+long g821;
+short g822;
+long g823;
+int g824;
+int g825;
+short g826;
+char g827;
+int g828;
+short g829;
+short g830;
+long g831;
+int g832;
+char g833;
+char g834;
+char g835;
+char g836;
+char g837;
+short g838;
+char g839;
+short g840;
+long g841;
+long g842;
+short g843;
+short g844;
+long g845;
+long g846;
+short g847;
+short g848;
+long g849;
+int g850;
+short g851;
+char g852;
+long g853;
+short g854;
+int g855;
+long g856;
+char g857;
+short g858;
+int g859;
+short g860;
+long g861;
+char g862;
+long g863;
+char g864;
+int g865;
+int g866;
+char g867;
+long g868;
+int g869;
+int g870;
+char g871;
+char g872;
+short g873;
+char g874;
+char g875;
+int g876;
+int g877;
+short g878;
+short g879;
+int g880;
+char g881;
+short g882;
+short g883;
+int g884;
+short g885;
+short g886;
+char g887;
+short g888;
+short g889;
+char g890;
+short g891;
+long g892;
+short g893;
+char g894;
+int g895;
+int g896;
+char g897;
+int g898;
+int g899;
+long g900;
+long g901;
+char g902;
+int g903;
+long g904;
+int g905;
+short g906;
+int g907;
+int g908;
+int g909;
+short g910;
+long g911;
+short g912;
+short g913;
+int g914;
+int g915;
+int g916;
+short g917;
+long g918;
+short g919;
+long g920;
+int g921;
+short g922;
+short g923;
+int g924;
+long g925;
+short g926;
+int g927;
+int g928;
+long g929;
+short g930;
+char g931;
+long g932;
+short g933;
+int g934;
+int g935;
+int g936;
+int g937;
+short g938;
+char g939;
+short g940;
+int g941;
+char g942;
+short g943;
+int g944;
+long g945;
+long g946;
+long g947;
+short g948;
+int g949;
+long g950;
+long g951;
+int g952;
+int g953;
+int g954;
+short g955;
+long g956;
+int g957;
+short g958;
+long g959;
+int g960;
+int g961;
+long g962;
+long g963;
+short g964;
+short g965;
+int g966;
+char g967;
+char g968;
+int g969;
+char g970;
+long g971;
+char g972;
+char g973;
+int g974;
+short g975;
+int g976;
+char g977;
+char g978;
+char g979;
+long g980;
+char g981;
+long g982;
+long g983;
+short g984;
+long g985;
+char g986;
+char g987;
+long g988;
+short g989;
+int g990;
+long g991;
+char g992;
+long g993;
+char g994;
+short g995;
+int g996;
+long g997;
+long g998;
+long g999;
+int g1000;
+int g1001;
+char g1002;
+long g1003;
+short g1004;
+long g1005;
+long g1006;
+long g1007;
+long g1008;
+int g1009;
+long g1010;
+short g1011;
+long g1012;
+long g1013;
+long g1014;
+long g1015;
+long g1016;
+int g1017;
+int g1018;
+char g1019;
+char g1020;
+char g1021;
+char g1022;
+short g1023;
+long g1024;
+long g1025;
+long g1026;
+char g1027;
+char g1028;
+int g1029;
+long g1030;
+short g1031;
+long g1032;
+short g1033;
+short g1034;
+int g1035;
+short g1036;
+char g1037;
+int g1038;
+long g1039;
+long g1040;
+short g1041;
+int g1042;
+char g1043;
+int g1044;
+int g1045;
+char g1046;
+short g1047;
+char g1048;
+int g1049;
+char g1050;
+int g1051;
+char g1052;
+int g1053;
+int g1054;
+long g1055;
+int g1056;
+short g1057;
+int g1058;
+long g1059;
+char g1060;
+int g1061;
+char g1062;
+long g1063;
+char g1064;
+char g1065;
+int g1066;
+short g1067;
+int g1068;
+short g1069;
+int g1070;
+long g1071;
+short g1072;
+long g1073;
+char g1074;
+short g1075;
+int g1076;
+char g1077;
+int g1078;
+long g1079;
+char g1080;
+long g1081;
+long g1082;
+char g1083;
+char g1084;
+short g1085;
+short g1086;
+long g1087;
+char g1088;
+int g1089;
+long g1090;
+int g1091;
+int g1092;
+long g1093;
+char g1094;
+short g1095;
+int g1096;
+char g1097;
+char g1098;
+short g1099;
+short g1100;
+int g1101;
+short g1102;
+char g1103;
+long g1104;
+int g1105;
+long g1106;
+int g1107;
+short g1108;
+long g1109;
+short g1110;
+char g1111;
+long g1112;
+long g1113;
+long g1114;
+char g1115;
+short g1116;
+short g1117;
+long g1118;
+char g1119;
+short g1120;
+int g1121;
+long g1122;
+char g1123;
+char g1124;
+long g1125;
+int g1126;
+int g1127;
+char g1128;
+short g1129;
+char g1130;
+char g1131;
+short g1132;
+long g1133;
+short g1134;
+int g1135;
+char g1136;
+long g1137;
+int g1138;
+long g1139;
+long g1140;
+long g1141;
+short g1142;
+long g1143;
+char g1144;
+int g1145;
+long g1146;
+char g1147;
+char g1148;
+short g1149;
+long g1150;
+long g1151;
+short g1152;
+short g1153;
+char g1154;
+long g1155;
+char g1156;
+char g1157;
+short g1158;
+int g1159;
+int g1160;
+char g1161;
+long g1162;
+long g1163;
+short g1164;
+short g1165;
+short g1166;
+short g1167;
+short g1168;
+long g1169;
+long g1170;
+short g1171;
+long g1172;
+long g1173;
+short g1174;
+char g1175;
+char g1176;
+short g1177;
+int g1178;
+long g1179;
+char g1180;
+short g1181;
+int g1182;
+char g1183;
+short g1184;
+long g1185;
+int g1186;
+char g1187;
+char g1188;
+short g1189;
+char g1190;
+char g1191;
+char g1192;
+char g1193;
+char g1194;
+char g1195;
+long g1196;
+long g1197;
+int g1198;
+char g1199;
+short g1200;
+int g1201;
+short g1202;
+short g1203;
+char g1204;
+char g1205;
+short g1206;
+long g1207;
+long g1208;
+char g1209;
+short g1210;
+long g1211;
+char g1212;
+long g1213;
+short g1214;
+int g1215;
+long g1216;
+char g1217;
+int g1218;
+int g1219;
+short g1220;
+long g1221;
+char g1222;
+char g1223;
+short g1224;
+char g1225;
+char g1226;
+char g1227;
+int g1228;
+char g1229;
+char g1230;
+int g1231;
+long g1232;
+short g1233;
+long g1234;
+int g1235;
+int g1236;
+char g1237;
+int g1238;
+short g1239;
+int g1240;
+short g1241;
+long g1242;
+char g1243;
+int g1244;
+long g1245;
+char g1246;
+short g1247;
+char g1248;
+long g1249;
+char g1250;
+char g1251;
+long g1252;
+short g1253;
+int g1254;
+short g1255;
+short g1256;
+short g1257;
+char g1258;
+int g1259;
+char g1260;
+int g1261;
+char g1262;
+long g1263;
+int g1264;
+long g1265;
+char g1266;
+int g1267;
+short g1268;
+long g1269;
+int g1270;
+short g1271;
+int g1272;
+short g1273;
+char g1274;
+char g1275;
+int g1276;
+short g1277;
+short g1278;
+short g1279;
+char g1280;
+int g1281;
+long g1282;
+long g1283;
+int g1284;
+int g1285;
+short g1286;
+short g1287;
+long g1288;
+long g1289;
+short g1290;
+int g1291;
+int g1292;
+short g1293;
+char g1294;
+char g1295;
+long g1296;
+int g1297;
+char g1298;
+long g1299;
+long g1300;
+int g1301;
+char g1302;
+char g1303;
+long g1304;
+long g1305;
+char g1306;
+int g1307;
+int g1308;
+short g1309;
+long g1310;
+int g1311;
+char g1312;
+char g1313;
+int g1314;
+char g1315;
+long g1316;
+long g1317;
+short g1318;
+int g1319;
+char g1320;
+int g1321;
+long g1322;
+long g1323;
+char g1324;
+short g1325;
+char g1326;
+short g1327;
+int g1328;
+short g1329;
+char g1330;
+int g1331;
+long g1332;
+int g1333;
+short g1334;
+long g1335;
+char g1336;
+char g1337;
+int g1338;
+short g1339;
+char g1340;
+short g1341;
+long g1342;
+int g1343;
+long g1344;
+short g1345;
+int g1346;
+int g1347;
+long g1348;
+int g1349;
+short g1350;
+short g1351;
+short g1352;
+int g1353;
+long g1354;
+char g1355;
+short g1356;
+long g1357;
+int g1358;
+int g1359;
+long g1360;
+char g1361;
+long g1362;
+short g1363;
+long g1364;
+short g1365;
+long g1366;
+long g1367;
+int g1368;
+short g1369;
+long g1370;
+int g1371;
+long g1372;
+int g1373;
+char g1374;
+int g1375;
+long g1376;
+char g1377;
+short g1378;
+short g1379;
+short g1380;
+int g1381;
+short g1382;
+char g1383;
+short g1384;
+long g1385;
+int g1386;
+char g1387;
+long g1388;
+short g1389;
+int g1390;
+long g1391;
+int g1392;
+char g1393;
+long g1394;
+char g1395;
+short g1396;
+char g1397;
+int g1398;
+char g1399;
+long g1400;
+long g1401;
+short g1402;
+int g1403;
+int g1404;
+long g1405;
+char g1406;
+int g1407;
+char g1408;
+int g1409;
+char g1410;
+int g1411;
+char g1412;
+long g1413;
+long g1414;
+char g1415;
+long g1416;
+long g1417;
+short g1418;
+short g1419;
+int g1420;
+char g1421;
+short g1422;
+char g1423;
+long g1424;
+char g1425;
+int g1426;
+long g1427;
+char g1428;
+short g1429;
+char g1430;
+int g1431;
+long g1432;
+short g1433;
+int g1434;
+int g1435;
+int g1436;
+int g1437;
+short g1438;
+int g1439;
+short g1440;
+short g1441;
+int g1442;
+char g1443;
+long g1444;
+long g1445;
+short g1446;
+short g1447;
+long g1448;
+long g1449;
+char g1450;
+char g1451;
+char g1452;
+long g1453;
+long g1454;
+long g1455;
+int g1456;
+long g1457;
+long g1458;
+int g1459;
+char g1460;
+char g1461;
+int g1462;
+char g1463;
+char g1464;
+long g1465;
+short g1466;
+long g1467;
+short g1468;
+char g1469;
+char g1470;
+long g1471;
+char g1472;
+int g1473;
+short g1474;
+int g1475;
+long g1476;
+long g1477;
+short g1478;
+int g1479;
+char g1480;
+short g1481;
+long g1482;
+int g1483;
+char g1484;
+short g1485;
+short g1486;
+long g1487;
+int g1488;
+int g1489;
+short g1490;
+char g1491;
+char g1492;
+int g1493;
+int g1494;
+char g1495;
+char g1496;
+char g1497;
+long g1498;
+short g1499;
+char g1500;
+long g1501;
+int g1502;
+int g1503;
+long g1504;
+char g1505;
+int g1506;
+long g1507;
+char g1508;
+char g1509;
+short g1510;
+short g1511;
+int g1512;
+long g1513;
+int g1514;
+int g1515;
+short g1516;
+long g1517;
+long g1518;
+short g1519;
+short g1520;
+long g1521;
+short g1522;
+short g1523;
+short g1524;
+char g1525;
+int g1526;
+char g1527;
+long g1528;
+short g1529;
+int g1530;
+long g1531;
+int g1532;
+int g1533;
+short g1534;
+long g1535;
+int g1536;
+long g1537;
+long g1538;
+char g1539;
+short g1540;
+int g1541;
+short g1542;
+int g1543;
+long g1544;
+char g1545;
+long g1546;
+char g1547;
+char g1548;
+long g1549;
+long g1550;
+int g1551;
+int g1552;
+short g1553;
+long g1554;
+char g1555;
+int g1556;
+int g1557;
+short g1558;
+char g1559;
+int g1560;
+char g1561;
+short g1562;
+char g1563;
+int g1564;
+long g1565;
+long g1566;
+long g1567;
+int g1568;
+char g1569;
+short g1570;
+int g1571;
+long g1572;
+short g1573;
+int g1574;
+long g1575;
+short g1576;
+long g1577;
+short g1578;
+short g1579;
+short g1580;
+int g1581;
+short g1582;
+long g1583;
+short g1584;
+int g1585;
+int g1586;
+short g1587;
+int g1588;
+short g1589;
+int g1590;
+char g1591;
+char g1592;
+char g1593;
+char g1594;
+char g1595;
+long g1596;
+long g1597;
+int g1598;
+long g1599;
+int g1600;
+short g1601;
+char g1602;
+int g1603;
+long g1604;
+char g1605;
+char g1606;
+char g1607;
+short g1608;
+short g1609;
+long g1610;
+short g1611;
+long g1612;
+long g1613;
+char g1614;
+long g1615;
+int g1616;
+char g1617;
+short g1618;
+long g1619;
+char g1620;
+long g1621;
+short g1622;
+short g1623;
+int g1624;
+long g1625;
+short g1626;
+int g1627;
+int g1628;
+short g1629;
+char g1630;
+long g1631;
+int g1632;
+char g1633;
+long g1634;
+char g1635;
+int g1636;
+char g1637;
+short g1638;
+short g1639;
+char g1640;
+short g1641;
+short g1642;
+int g1643;
+int g1644;
+short g1645;
+long g1646;
+short g1647;
+long g1648;
+int g1649;
+short g1650;
+char g1651;
+int g1652;
+long g1653;
+int g1654;
+short g1655;
+char g1656;
+long g1657;
+int g1658;
+short g1659;
+short g1660;
+char g1661;
+char g1662;
+int g1663;
+char g1664;
+int g1665;
+int g1666;
+char g1667;
+char g1668;
+int g1669;
+char g1670;
+char g1671;
+int g1672;
+long g1673;
+int g1674;
+long g1675;
+long g1676;
+long g1677;
+long g1678;
+int g1679;
+long g1680;
+short g1681;
+int g1682;
+long g1683;
+short g1684;
+int g1685;
+char g1686;
+long g1687;
+int g1688;
+short g1689;
+short g1690;
+int g1691;
+int g1692;
+long g1693;
+char g1694;
+int g1695;
+long g1696;
+long g1697;
+long g1698;
+short g1699;
+int g1700;
+int g1701;
+short g1702;
+long g1703;
+long g1704;
+int g1705;
+long g1706;
+char g1707;
+short g1708;
+short g1709;
+short g1710;
+char g1711;
+long g1712;
+char g1713;
+int g1714;
+short g1715;
+int g1716;
+short g1717;
+long g1718;
+int g1719;
+char g1720;
+long g1721;
+short g1722;
+long g1723;
+int g1724;
+int g1725;
+long g1726;
+short g1727;
+char g1728;
+int g1729;
+short g1730;
+int g1731;
+short g1732;
+char g1733;
+long g1734;
+long g1735;
+int g1736;
+int g1737;
+short g1738;
+char g1739;
+int g1740;
+short g1741;
+char g1742;
+long g1743;
+int g1744;
+long g1745;
+int g1746;
+long g1747;
+short g1748;
+long g1749;
+char g1750;
+int g1751;
+int g1752;
+char g1753;
+char g1754;
+char g1755;
+char g1756;
+short g1757;
+char g1758;
+int g1759;
+long g1760;
+char g1761;
+char g1762;
+char g1763;
+short g1764;
+int g1765;
+char g1766;
+long g1767;
+int g1768;
+short g1769;
+long g1770;
+long g1771;
+char g1772;
+int g1773;
+int g1774;
+int g1775;
+long g1776;
+int g1777;
+char g1778;
+short g1779;
+short g1780;
+long g1781;
+int g1782;
+int g1783;
+char g1784;
+int g1785;
+long g1786;
+char g1787;
+int g1788;
+char g1789;
+int g1790;
+short g1791;
+char g1792;
+short g1793;
+short g1794;
+long g1795;
+short g1796;
+short g1797;
+long g1798;
+char g1799;
+int g1800;
+short g1801;
+int g1802;
+short g1803;
+int g1804;
+char g1805;
+short g1806;
+char g1807;
+short g1808;
+long g1809;
+char g1810;
+short g1811;
+short g1812;
+short g1813;
+short g1814;
+int g1815;
+long g1816;
+short g1817;
+long g1818;
+short g1819;
+int g1820;
+char g1821;
+char g1822;
+short g1823;
+short g1824;
+short g1825;
+short g1826;
+long g1827;
+long g1828;
+short g1829;
+short g1830;
+int g1831;
+int g1832;
+int g1833;
+int g1834;
+long g1835;
+char g1836;
+char g1837;
+int g1838;
+char g1839;
+int g1840;
+char g1841;
+int g1842;
+short g1843;
+long g1844;
+int g1845;
+short g1846;
+short g1847;
+int g1848;
+long g1849;
+char g1850;
+int g1851;
+short g1852;
+char g1853;
+short g1854;
+short g1855;
+char g1856;
+long g1857;
+short g1858;
+long g1859;
+long g1860;
+int g1861;
+short g1862;
+short g1863;
+long g1864;
+long g1865;
+char g1866;
+short g1867;
+long g1868;
+int g1869;
+long g1870;
+short g1871;
+char g1872;
+char g1873;
+short g1874;
+short g1875;
+short g1876;
+short g1877;
+long g1878;
+int g1879;
+int g1880;
+int g1881;
+long g1882;
+short g1883;
+char g1884;
+int g1885;
+int g1886;
+int g1887;
+short g1888;
+short g1889;
+int g1890;
+int g1891;
+int g1892;
+short g1893;
+char g1894;
+long g1895;
+char g1896;
+char g1897;
+long g1898;
+short g1899;
+short g1900;
+char g1901;
+int g1902;
+short g1903;
+long g1904;
+long g1905;
+char g1906;
+int g1907;
+long g1908;
+short g1909;
+int g1910;
+long g1911;
+short g1912;
+short g1913;
+long g1914;
+long g1915;
+char g1916;
+char g1917;
+char g1918;
+short g1919;
+short g1920;
+short g1921;
+char g1922;
+long g1923;
+int g1924;
+short g1925;
+int g1926;
+short g1927;
+long g1928;
+int g1929;
+char g1930;
+int g1931;
+long g1932;
+long g1933;
+char g1934;
+char g1935;
+long g1936;
+char g1937;
+long g1938;
+int g1939;
+int g1940;
+short g1941;
+int g1942;
+long g1943;
+int g1944;
+char g1945;
+char g1946;
+char g1947;
+short g1948;
+int g1949;
+int g1950;
+short g1951;
+char g1952;
+int g1953;
+short g1954;
+short g1955;
+short g1956;
+long g1957;
+long g1958;
+short g1959;
+short g1960;
+long g1961;
+char g1962;
+char g1963;
+long g1964;
+short g1965;
+short g1966;
+int g1967;
+char g1968;
+char g1969;
+short g1970;
+short g1971;
+long g1972;
+long g1973;
+int g1974;
+int g1975;
+long g1976;
+long g1977;
+int g1978;
+int g1979;
+short g1980;
+char g1981;
+int g1982;
+char g1983;
+long g1984;
+short g1985;
+long g1986;
+short g1987;
+char g1988;
+char g1989;
+char g1990;
+int g1991;
+int g1992;
+char g1993;
+char g1994;
+int g1995;
+short g1996;
+short g1997;
+char g1998;
+short g1999;
+long g2000;
+long g2001;
+long g2002;
+short g2003;
+char g2004;
+int g2005;
+long g2006;
+short g2007;
+long g2008;
+int g2009;
+int g2010;
+int g2011;
+short g2012;
+short g2013;
+int g2014;
+int g2015;
+char g2016;
+short g2017;
+long g2018;
+short g2019;
+short g2020;
+char g2021;
+int g2022;
+long g2023;
+short g2024;
+char g2025;
+long g2026;
+int g2027;
+int g2028;
+short g2029;
+char g2030;
+char g2031;
+long g2032;
+char g2033;
+char g2034;
+long g2035;
+int g2036;
+char g2037;
+long g2038;
+char g2039;
+char g2040;
+int g2041;
+char g2042;
+short g2043;
+char g2044;
+short g2045;
+long g2046;
+short g2047;
+short g2048;
+char g2049;
+short g2050;
+char g2051;
+int g2052;
+short g2053;
+int g2054;
+char g2055;
+short g2056;
+char g2057;
+int g2058;
+char g2059;
+char g2060;
+short g2061;
+short g2062;
+int g2063;
+int g2064;
+long g2065;
+short g2066;
+char g2067;
+int g2068;
+char g2069;
+short g2070;
+char g2071;
+short g2072;
+long g2073;
+long g2074;
+char g2075;
+short g2076;
+long g2077;
+short g2078;
+short g2079;
+int g2080;
+int g2081;
+short g2082;
+char g2083;
+long g2084;
+char g2085;
+int g2086;
+long g2087;
+char g2088;
+long g2089;
+long g2090;
+int g2091;
+int g2092;
+char g2093;
+long g2094;
+short g2095;
+char g2096;
+int g2097;
+char g2098;
+short g2099;
+short g2100;
+char g2101;
+int g2102;
+int g2103;
+int g2104;
+long g2105;
+char g2106;
+int g2107;
+short g2108;
+int g2109;
+char g2110;
+int g2111;
+int g2112;
+short g2113;
+char g2114;
+int g2115;
+short g2116;
+short g2117;
+char g2118;
+char g2119;
+long g2120;
+short g2121;
+int g2122;
+long g2123;
+long g2124;
+long g2125;
+short g2126;
+short g2127;
+char g2128;
+int g2129;
+int g2130;
+short g2131;
+char g2132;
+char g2133;
+int g2134;
+short g2135;
+short g2136;
+long g2137;
+char g2138;
+int g2139;
+short g2140;
+short g2141;
+long g2142;
+int g2143;
+long g2144;
+short g2145;
+long g2146;
+int g2147;
+short g2148;
+short g2149;
+long g2150;
+long g2151;
+long g2152;
+long g2153;
+int g2154;
+int g2155;
+short g2156;
+char g2157;
+char g2158;
+char g2159;
+short g2160;
+int g2161;
+short g2162;
+int g2163;
+int g2164;
+long g2165;
+short g2166;
+char g2167;
+short g2168;
+char g2169;
+short g2170;
+int g2171;
+char g2172;
+char g2173;
+char g2174;
+long g2175;
+int g2176;
+long g2177;
+char g2178;
+short g2179;
+int g2180;
+int g2181;
+long g2182;
+long g2183;
+char g2184;
+int g2185;
+int g2186;
+short g2187;
+long g2188;
+long g2189;
+char g2190;
+int g2191;
+char g2192;
+char g2193;
+char g2194;
+char g2195;
+int g2196;
+short g2197;
+long g2198;
+char g2199;
+char g2200;
+char g2201;
+short g2202;
+int g2203;
+long g2204;
+char g2205;
+int g2206;
+char g2207;
+short g2208;
+int g2209;
+long g2210;
+char g2211;
+char g2212;
+long g2213;
+char g2214;
+short g2215;
+char g2216;
+int g2217;
+short g2218;
+int g2219;
+long g2220;
+long g2221;
+short g2222;
+char g2223;
+int g2224;
+char g2225;
+long g2226;
+int g2227;
+int g2228;
+int g2229;
+short g2230;
+int g2231;
+short g2232;
+int g2233;
+char g2234;
+short g2235;
+short g2236;
+int g2237;
+char g2238;
+long g2239;
+int g2240;
+char g2241;
+int g2242;
+char g2243;
+char g2244;
+long g2245;
+int g2246;
+long g2247;
+long g2248;
+char g2249;
+int g2250;
+short g2251;
+short g2252;
+long g2253;
+char g2254;
+char g2255;
+long g2256;
+short g2257;
+int g2258;
+char g2259;
+char g2260;
+long g2261;
+char g2262;
+int g2263;
+short g2264;
+short g2265;
+short g2266;
+short g2267;
+int g2268;
+int g2269;
+char g2270;
+short g2271;
+long g2272;
+short g2273;
+short g2274;
+int g2275;
+long g2276;
+short g2277;
+char g2278;
+char g2279;
+long g2280;
+short g2281;
+char g2282;
+long g2283;
+char g2284;
+int g2285;
+char g2286;
+int g2287;
+char g2288;
+char g2289;
+short g2290;
+char g2291;
+int g2292;
+char g2293;
+long g2294;
+char g2295;
+long g2296;
+short g2297;
+int g2298;
+char g2299;
+char g2300;
+int g2301;
+char g2302;
+char g2303;
+int g2304;
+char g2305;
+short g2306;
+short g2307;
+long g2308;
+long g2309;
+char g2310;
+char g2311;
+long g2312;
+short g2313;
+char g2314;
+long g2315;
+long g2316;
+short g2317;
+short g2318;
+short g2319;
+short g2320;
+int g2321;
+int g2322;
+short g2323;
+int g2324;
+long g2325;
+short g2326;
+short g2327;
+char g2328;
+long g2329;
+char g2330;
+int g2331;
+short g2332;
+short g2333;
+int g2334;
+long g2335;
+short g2336;
+char g2337;
+char g2338;
+int g2339;
+char g2340;
+short g2341;
+int g2342;
+short g2343;
+int g2344;
+char g2345;
+char g2346;
+int g2347;
+char g2348;
+int g2349;
+int g2350;
+char g2351;
+int g2352;
+short g2353;
+long g2354;
+char g2355;
+short g2356;
+short g2357;
+short g2358;
+short g2359;
+int g2360;
+long g2361;
+long g2362;
+short g2363;
+char g2364;
+int g2365;
+char g2366;
+long g2367;
+short g2368;
+short g2369;
+short g2370;
+short g2371;
+char g2372;
+short g2373;
+char g2374;
+short g2375;
+int g2376;
+long g2377;
+short g2378;
+short g2379;
+short g2380;
+short g2381;
+short g2382;
+int g2383;
+int g2384;
+char g2385;
+char g2386;
+long g2387;
+long g2388;
+long g2389;
+short g2390;
+long g2391;
+short g2392;
+long g2393;
+short g2394;
+char g2395;
+long g2396;
+char g2397;
+char g2398;
+int g2399;
+long g2400;
+int g2401;
+long g2402;
+long g2403;
+char g2404;
+int g2405;
+int g2406;
+long g2407;
+long g2408;
+int g2409;
+int g2410;
+char g2411;
+char g2412;
+int g2413;
+int g2414;
+int g2415;
+char g2416;
+long g2417;
+short g2418;
+int g2419;
+short g2420;
+short g2421;
+char g2422;
+long g2423;
+short g2424;
+char g2425;
+long g2426;
+char g2427;
+short g2428;
+int g2429;
+long g2430;
+long g2431;
+long g2432;
+char g2433;
+long g2434;
+short g2435;
+short g2436;
+int g2437;
+char g2438;
+int g2439;
+int g2440;
+int g2441;
+int g2442;
+int g2443;
+long g2444;
+char g2445;
+short g2446;
+short g2447;
+long g2448;
+int g2449;
+short g2450;
+long g2451;
+short g2452;
+long g2453;
+long g2454;
+short g2455;
+long g2456;
+short g2457;
+long g2458;
+char g2459;
+char g2460;
+long g2461;
+int g2462;
+long g2463;
+char g2464;
+long g2465;
+int g2466;
+char g2467;
+long g2468;
+int g2469;
+long g2470;
+short g2471;
+short g2472;
+int g2473;
+short g2474;
+char g2475;
+char g2476;
+char g2477;
+char g2478;
+short g2479;
+char g2480;
+long g2481;
+long g2482;
+long g2483;
+char g2484;
+int g2485;
+short g2486;
+long g2487;
+long g2488;
+long g2489;
+char g2490;
+char g2491;
+char g2492;
+int g2493;
+long g2494;
+long g2495;
+long g2496;
+short g2497;
+short g2498;
+char g2499;
+long g2500;
+int g2501;
+long g2502;
+int g2503;
+short g2504;
+char g2505;
+int g2506;
+int g2507;
+long g2508;
+char g2509;
+short g2510;
+int g2511;
+long g2512;
+short g2513;
+short g2514;
+char g2515;
+long g2516;
+int g2517;
+int g2518;
+char g2519;
+long g2520;
+long g2521;
+long g2522;
+long g2523;
+int g2524;
+char g2525;
+char g2526;
+char g2527;
+long g2528;
+int g2529;
+char g2530;
+short g2531;
+short g2532;
+long g2533;
+short g2534;
+int g2535;
+char g2536;
+short g2537;
+char g2538;
+short g2539;
+int g2540;
+long g2541;
+int g2542;
+long g2543;
+int g2544;
+short g2545;
+char g2546;
+short g2547;
+int g2548;
+long g2549;
+short g2550;
+char g2551;
+long g2552;
+int g2553;
+short g2554;
+char g2555;
+char g2556;
+int g2557;
+long g2558;
+char g2559;
+long g2560;
+short g2561;
+long g2562;
+long g2563;
+char g2564;
+short g2565;
+long g2566;
+int g2567;
+short g2568;
+short g2569;
+short g2570;
+short g2571;
+int g2572;
+char g2573;
+long g2574;
+short g2575;
+char g2576;
+long g2577;
+int g2578;
+int g2579;
+long g2580;
+long g2581;
+int g2582;
+short g2583;
+short g2584;
+long g2585;
+long g2586;
+long g2587;
+int g2588;
+char g2589;
+short g2590;
+long g2591;
+short g2592;
+long g2593;
+short g2594;
+char g2595;
+char g2596;
+int g2597;
+short g2598;
+char g2599;
+int g2600;
+char g2601;
+int g2602;
+int g2603;
+long g2604;
+short g2605;
+int g2606;
+char g2607;
+long g2608;
+long g2609;
+int g2610;
+long g2611;
+short g2612;
+char g2613;
+int g2614;
+short g2615;
+short g2616;
+long g2617;
+long g2618;
+char g2619;
+int g2620;
+int g2621;
+short g2622;
+char g2623;
+int g2624;
+short g2625;
+int g2626;
+char g2627;
+int g2628;
+long g2629;
+long g2630;
+char g2631;
+int g2632;
+long g2633;
+int g2634;
+int g2635;
+short g2636;
+short g2637;
+long g2638;
+int g2639;
+char g2640;
+char g2641;
+int g2642;
+int g2643;
+long g2644;
+short g2645;
+char g2646;
+long g2647;
+int g2648;
+long g2649;
+long g2650;
+short g2651;
+short g2652;
+char g2653;
+long g2654;
+char g2655;
+int g2656;
+short g2657;
+char g2658;
+short g2659;
+char g2660;
+long g2661;
+char g2662;
+int g2663;
+long g2664;
+char g2665;
+char g2666;
+short g2667;
+short g2668;
+short g2669;
+long g2670;
+char g2671;
+long g2672;
+short g2673;
+char g2674;
+long g2675;
+short g2676;
+long g2677;
+short g2678;
+char g2679;
+char g2680;
+long g2681;
+int g2682;
+char g2683;
+short g2684;
+short g2685;
+char g2686;
+int g2687;
+short g2688;
+char g2689;
+short g2690;
+int g2691;
+short g2692;
+long g2693;
+char g2694;
+int g2695;
+char g2696;
+char g2697;
+int g2698;
+char g2699;
+int g2700;
+char g2701;
+long g2702;
+long g2703;
+short g2704;
+char g2705;
+char g2706;
+char g2707;
+long g2708;
+int g2709;
+int g2710;
+int g2711;
+long g2712;
+int g2713;
+int g2714;
+long g2715;
+int g2716;
+char g2717;
+long g2718;
+long g2719;
+int g2720;
+char g2721;
+long g2722;
+long g2723;
+int g2724;
+char g2725;
+short g2726;
+char g2727;
+char g2728;
+int g2729;
+int g2730;
+long g2731;
+short g2732;
+long g2733;
+long g2734;
+int g2735;
+short g2736;
+int g2737;
+int g2738;
+long g2739;
+int g2740;
+int g2741;
+short g2742;
+long g2743;
+short g2744;
+char g2745;
+long g2746;
+char g2747;
+char g2748;
+short g2749;
+int g2750;
+char g2751;
+long g2752;
+int g2753;
+long g2754;
+int g2755;
+int g2756;
+char g2757;
+long g2758;
+long g2759;
+char g2760;
+long g2761;
+int g2762;
+char g2763;
+long g2764;
+int g2765;
+int g2766;
+long g2767;
+char g2768;
+int g2769;
+char g2770;
+int g2771;
+int g2772;
+char g2773;
+short g2774;
+short g2775;
+int g2776;
+char g2777;
+char g2778;
+char g2779;
+int g2780;
+int g2781;
+int g2782;
+char g2783;
+long g2784;
+short g2785;
+long g2786;
+long g2787;
+short g2788;
+short g2789;
+short g2790;
+short g2791;
+short g2792;
+short g2793;
+int g2794;
+int g2795;
+int g2796;
+char g2797;
+long g2798;
+short g2799;
+long g2800;
+long g2801;
+short g2802;
+char g2803;
+char g2804;
+long g2805;
+int g2806;
+int g2807;
+int g2808;
+long g2809;
+short g2810;
+long g2811;
+int g2812;
+char g2813;
+long g2814;
+long g2815;
+int g2816;
+char g2817;
+char g2818;
+char g2819;
+char g2820;
+int g2821;
+char g2822;
+char g2823;
+int g2824;
+int g2825;
+long g2826;
+int g2827;
+long g2828;
+short g2829;
+int g2830;
+char g2831;
+long g2832;
+long g2833;
+short g2834;
+char g2835;
+int g2836;
+short g2837;
+short g2838;
+long g2839;
+long g2840;
+long g2841;
+int g2842;
+char g2843;
+short g2844;
+char g2845;
+short g2846;
+short g2847;
+int g2848;
+char g2849;
+char g2850;
+char g2851;
+long g2852;
+int g2853;
+int g2854;
+char g2855;
+short g2856;
+int g2857;
+short g2858;
+short g2859;
+int g2860;
+long g2861;
+int g2862;
+long g2863;
+long g2864;
+long g2865;
+short g2866;
+int g2867;
+int g2868;
+short g2869;
+char g2870;
+long g2871;
+short g2872;
+short g2873;
+int g2874;
+int g2875;
+short g2876;
+long g2877;
+int g2878;
+int g2879;
+int g2880;
+long g2881;
+char g2882;
+int g2883;
+short g2884;
+long g2885;
+int g2886;
+short g2887;
+short g2888;
+int g2889;
+short g2890;
+int g2891;
+char g2892;
+short g2893;
+char g2894;
+int g2895;
+short g2896;
+char g2897;
+char g2898;
+int g2899;
+short g2900;
+char g2901;
+char g2902;
+int g2903;
+long g2904;
+char g2905;
+short g2906;
+long g2907;
+short g2908;
+char g2909;
+int g2910;
+long g2911;
+char g2912;
+int g2913;
+long g2914;
+int g2915;
+long g2916;
+short g2917;
+short g2918;
+char g2919;
+char g2920;
+int g2921;
+long g2922;
+char g2923;
+short g2924;
+short g2925;
+long g2926;
+long g2927;
+short g2928;
+int g2929;
+char g2930;
+int g2931;
+char g2932;
+char g2933;
+int g2934;
+int g2935;
+short g2936;
+long g2937;
+long g2938;
+char g2939;
+long g2940;
+long g2941;
+short g2942;
+char g2943;
+int g2944;
+char g2945;
+int g2946;
+short g2947;
+int g2948;
+long g2949;
+short g2950;
+long g2951;
+char g2952;
+short g2953;
+short g2954;
+char g2955;
+int g2956;
+long g2957;
+long g2958;
+long g2959;
+char g2960;
+short g2961;
+int g2962;
+int g2963;
+long g2964;
+short g2965;
+int g2966;
+short g2967;
+int g2968;
+int g2969;
+short g2970;
+int g2971;
+char g2972;
+short g2973;
+short g2974;
+char g2975;
+char g2976;
+long g2977;
+char g2978;
+short g2979;
+char g2980;
+long g2981;
+short g2982;
+int g2983;
+char g2984;
+char g2985;
+int g2986;
+char g2987;
+short g2988;
+short g2989;
+short g2990;
+char g2991;
+char g2992;
+long g2993;
+int g2994;
+int g2995;
+long g2996;
+long g2997;
+long g2998;
+short g2999;
+long g3000;
+int g3001;
+char g3002;
+long g3003;
+short g3004;
+int g3005;
+short g3006;
+char g3007;
+int g3008;
+int g3009;
+short g3010;
+short g3011;
+char g3012;
+char g3013;
+long g3014;
+int g3015;
+int g3016;
+char g3017;
+char g3018;
+short g3019;
+long g3020;
+long g3021;
+short g3022;
+long g3023;
+long g3024;
+int g3025;
+int g3026;
+short g3027;
+int g3028;
+int g3029;
+short g3030;
+short g3031;
+int g3032;
+int g3033;
+long g3034;
+char g3035;
+int g3036;
+char g3037;
+long g3038;
+short g3039;
+int g3040;
+int g3041;
+int g3042;
+short g3043;
+long g3044;
+short g3045;
+short g3046;
+short g3047;
+char g3048;
+int g3049;
+long g3050;
+int g3051;
+int g3052;
+long g3053;
+char g3054;
+char g3055;
+char g3056;
+short g3057;
+long g3058;
+int g3059;
+int g3060;
+long g3061;
+char g3062;
+long g3063;
+short g3064;
+char g3065;
+long g3066;
+long g3067;
+short g3068;
+char g3069;
+long g3070;
+char g3071;
+char g3072;
+char g3073;
+short g3074;
+long g3075;
+char g3076;
+int g3077;
+int g3078;
+long g3079;
+short g3080;
+short g3081;
+int g3082;
+char g3083;
+long g3084;
+char g3085;
+char g3086;
+short g3087;
+short g3088;
+char g3089;
+short g3090;
+char g3091;
+int g3092;
+short g3093;
+short g3094;
+short g3095;
+char g3096;
+char g3097;
+long g3098;
+char g3099;
+short g3100;
+short g3101;
+int g3102;
+int g3103;
+int g3104;
+short g3105;
+char g3106;
+long g3107;
+short g3108;
+char g3109;
+short g3110;
+char g3111;
+long g3112;
+long g3113;
+long g3114;
+char g3115;
+char g3116;
+long g3117;
+int g3118;
+int g3119;
+short g3120;
+long g3121;
+long g3122;
+char g3123;
+long g3124;
+char g3125;
+char g3126;
+int g3127;
+char g3128;
+short g3129;
+char g3130;
+char g3131;
+char g3132;
+long g3133;
+int g3134;
+long g3135;
+long g3136;
+int g3137;
+short g3138;
+int g3139;
+short g3140;
+long g3141;
+char g3142;
+long g3143;
+int g3144;
+char g3145;
+char g3146;
+long g3147;
+long g3148;
+short g3149;
+short g3150;
+int g3151;
+short g3152;
+int g3153;
+char g3154;
+char g3155;
+short g3156;
+int g3157;
+long g3158;
+int g3159;
+short g3160;
+long g3161;
+short g3162;
+char g3163;
+short g3164;
+char g3165;
+short g3166;
+int g3167;
+long g3168;
+short g3169;
+short g3170;
+int g3171;
+char g3172;
+short g3173;
+int g3174;
+short g3175;
+char g3176;
+int g3177;
+short g3178;
+int g3179;
+int g3180;
+char g3181;
+char g3182;
+long g3183;
+short g3184;
+char g3185;
+short g3186;
+short g3187;
+long g3188;
+short g3189;
+short g3190;
+int g3191;
+long g3192;
+int g3193;
+int g3194;
+long g3195;
+short g3196;
+int g3197;
+short g3198;
+char g3199;
+int g3200;
+long g3201;
+short g3202;
+char g3203;
+char g3204;
+short g3205;
+char g3206;
+char g3207;
+char g3208;
+int g3209;
+int g3210;
+int g3211;
+int g3212;
+char g3213;
+int g3214;
+long g3215;
+char g3216;
+long g3217;
+short g3218;
+char g3219;
+int g3220;
+int g3221;
+long g3222;
+short g3223;
+int g3224;
+long g3225;
+short g3226;
+long g3227;
+short g3228;
+long g3229;
+int g3230;
+int g3231;
+long g3232;
+long g3233;
+short g3234;
+char g3235;
+char g3236;
+long g3237;
+long g3238;
+int g3239;
+char g3240;
+short g3241;
+short g3242;
+long g3243;
+short g3244;
+char g3245;
+short g3246;
+short g3247;
+long g3248;
+int g3249;
+long g3250;
+long g3251;
+char g3252;
+short g3253;
+char g3254;
+short g3255;
+short g3256;
+long g3257;
+char g3258;
+short g3259;
+int g3260;
+short g3261;
+short g3262;
+long g3263;
+int g3264;
+short g3265;
+char g3266;
+char g3267;
+short g3268;
+char g3269;
+long g3270;
+short g3271;
+char g3272;
+long g3273;
+char g3274;
+long g3275;
+long g3276;
+long g3277;
+int g3278;
+short g3279;
+short g3280;
+long g3281;
+int g3282;
+char g3283;
+int g3284;
+long g3285;
+long g3286;
+long g3287;
+int g3288;
+short g3289;
+int g3290;
+long g3291;
+short g3292;
+short g3293;
+int g3294;
+short g3295;
+char g3296;
+int g3297;
+short g3298;
+int g3299;
+int g3300;
+long g3301;
+char g3302;
+short g3303;
+short g3304;
+short g3305;
+char g3306;
+char g3307;
+int g3308;
+int g3309;
+int g3310;
+int g3311;
+int g3312;
+int g3313;
+long g3314;
+char g3315;
+short g3316;
+char g3317;
+short g3318;
+int g3319;
+char g3320;
+char g3321;
+long g3322;
+int g3323;
+short g3324;
+int g3325;
+short g3326;
+short g3327;
+long g3328;
+char g3329;
+char g3330;
+char g3331;
+int g3332;
+short g3333;
+int g3334;
+int g3335;
+int g3336;
+int g3337;
+long g3338;
+int g3339;
+int g3340;
+char g3341;
+short g3342;
+long g3343;
+short g3344;
+int g3345;
+long g3346;
+long g3347;
+char g3348;
+long g3349;
+long g3350;
+char g3351;
+int g3352;
+char g3353;
+char g3354;
+short g3355;
+short g3356;
+int g3357;
+short g3358;
+char g3359;
+short g3360;
+long g3361;
+int g3362;
+long g3363;
+short g3364;
+int g3365;
+int g3366;
+short g3367;
+char g3368;
+int g3369;
+short g3370;
+int g3371;
+char g3372;
+int g3373;
+long g3374;
+short g3375;
+long g3376;
+char g3377;
+char g3378;
+short g3379;
+char g3380;
+short g3381;
+short g3382;
+short g3383;
+char g3384;
+short g3385;
+char g3386;
+short g3387;
+int g3388;
+long g3389;
+long g3390;
+short g3391;
+short g3392;
+long g3393;
+int g3394;
+char g3395;
+int g3396;
+short g3397;
+long g3398;
+int g3399;
+long g3400;
+long g3401;
+char g3402;
+char g3403;
+int g3404;
+short g3405;
+int g3406;
+long g3407;
+char g3408;
+char g3409;
+int g3410;
+long g3411;
+long g3412;
+long g3413;
+long g3414;
+short g3415;
+char g3416;
+int g3417;
+int g3418;
+long g3419;
+int g3420;
+int g3421;
+long g3422;
+char g3423;
+long g3424;
+long g3425;
+short g3426;
+short g3427;
+int g3428;
+int g3429;
+short g3430;
+long g3431;
+long g3432;
+short g3433;
+short g3434;
+long g3435;
+long g3436;
+char g3437;
+short g3438;
+int g3439;
+long g3440;
+short g3441;
+long g3442;
+char g3443;
+char g3444;
+short g3445;
+char g3446;
+int g3447;
+char g3448;
+char g3449;
+char g3450;
+int g3451;
+long g3452;
+char g3453;
+char g3454;
+char g3455;
+long g3456;
+short g3457;
+short g3458;
+int g3459;
+char g3460;
+char g3461;
+long g3462;
+char g3463;
+long g3464;
+char g3465;
+int g3466;
+long g3467;
+char g3468;
+long g3469;
+int g3470;
+long g3471;
+char g3472;
+long g3473;
+int g3474;
+char g3475;
+short g3476;
+char g3477;
+char g3478;
+long g3479;
+char g3480;
+int g3481;
+long g3482;
+char g3483;
+long g3484;
+short g3485;
+long g3486;
+short g3487;
+char g3488;
+long g3489;
+short g3490;
+short g3491;
+int g3492;
+char g3493;
+long g3494;
+char g3495;
+char g3496;
+int g3497;
+long g3498;
+char g3499;
+int g3500;
+char g3501;
+char g3502;
+char g3503;
+char g3504;
+int g3505;
+char g3506;
+char g3507;
+int g3508;
+short g3509;
+long g3510;
+int g3511;
+char g3512;
+int g3513;
+char g3514;
+int g3515;
+char g3516;
+short g3517;
+long g3518;
+int g3519;
+char g3520;
+char g3521;
+int g3522;
+int g3523;
+char g3524;
+int g3525;
+int g3526;
+int g3527;
+short g3528;
+int g3529;
+int g3530;
+long g3531;
+long g3532;
+short g3533;
+long g3534;
+char g3535;
+char g3536;
+char g3537;
+char g3538;
+long g3539;
+long g3540;
+short g3541;
+short g3542;
+short g3543;
+char g3544;
+char g3545;
+char g3546;
+long g3547;
+char g3548;
+short g3549;
+char g3550;
+char g3551;
+long g3552;
+long g3553;
+int g3554;
+char g3555;
+int g3556;
+long g3557;
+int g3558;
+short g3559;
+char g3560;
+char g3561;
+short g3562;
+int g3563;
+char g3564;
+long g3565;
+short g3566;
+short g3567;
+int g3568;
+int g3569;
+short g3570;
+long g3571;
+long g3572;
+int g3573;
+long g3574;
+char g3575;
+long g3576;
+int g3577;
+int g3578;
+char g3579;
+long g3580;
+char g3581;
+int g3582;
+long g3583;
+long g3584;
+long g3585;
+long g3586;
+int g3587;
+long g3588;
+char g3589;
+long g3590;
+short g3591;
+short g3592;
+int g3593;
+short g3594;
+char g3595;
+short g3596;
+short g3597;
+long g3598;
+int g3599;
+long g3600;
+short g3601;
+int g3602;
+char g3603;
+char g3604;
+short g3605;
+short g3606;
+short g3607;
+int g3608;
+long g3609;
+char g3610;
+short g3611;
+char g3612;
+long g3613;
+int g3614;
+int g3615;
+short g3616;
+int g3617;
+int g3618;
+char g3619;
+char g3620;
+int g3621;
+int g3622;
+int g3623;
+short g3624;
+long g3625;
+long g3626;
+int g3627;
+long g3628;
+int g3629;
+int g3630;
+short g3631;
+short g3632;
+short g3633;
+long g3634;
+long g3635;
+char g3636;
+int g3637;
+char g3638;
+short g3639;
+long g3640;
+short g3641;
+short g3642;
+char g3643;
+short g3644;
+int g3645;
+short g3646;
+char g3647;
+int g3648;
+char g3649;
+short g3650;
+long g3651;
+long g3652;
+long g3653;
+long g3654;
+int g3655;
+int g3656;
+char g3657;
+short g3658;
+short g3659;
+int g3660;
+char g3661;
+int g3662;
+int g3663;
+long g3664;
+char g3665;
+int g3666;
+int g3667;
+char g3668;
+char g3669;
+int g3670;
+char g3671;
+char g3672;
+char g3673;
+short g3674;
+short g3675;
+short g3676;
+long g3677;
+long g3678;
+long g3679;
+long g3680;
+int g3681;
+long g3682;
+short g3683;
+short g3684;
+long g3685;
+char g3686;
+char g3687;
+short g3688;
+long g3689;
+short g3690;
+char g3691;
+short g3692;
+short g3693;
+int g3694;
+short g3695;
+int g3696;
+long g3697;
+short g3698;
+int g3699;
+int g3700;
+long g3701;
+short g3702;
+short g3703;
+long g3704;
+int g3705;
+char g3706;
+char g3707;
+long g3708;
+char g3709;
+char g3710;
+long g3711;
+int g3712;
+int g3713;
+long g3714;
+long g3715;
+long g3716;
+int g3717;
+short g3718;
+short g3719;
+int g3720;
+short g3721;
+short g3722;
+int g3723;
+long g3724;
+char g3725;
+long g3726;
+char g3727;
+int g3728;
+char g3729;
+long g3730;
+char g3731;
+long g3732;
+int g3733;
+short g3734;
+short g3735;
+char g3736;
+char g3737;
+char g3738;
+long g3739;
+short g3740;
+long g3741;
+long g3742;
+int g3743;
+char g3744;
+short g3745;
+short g3746;
+int g3747;
+long g3748;
+long g3749;
+int g3750;
+short g3751;
+char g3752;
+long g3753;
+char g3754;
+long g3755;
+char g3756;
+char g3757;
+char g3758;
+int g3759;
+char g3760;
+char g3761;
+short g3762;
+long g3763;
+char g3764;
+long g3765;
+short g3766;
+short g3767;
+int g3768;
+short g3769;
+char g3770;
+int g3771;
+long g3772;
+short g3773;
+short g3774;
+int g3775;
+int g3776;
+int g3777;
+char g3778;
+int g3779;
+int g3780;
+int g3781;
+char g3782;
+long g3783;
+long g3784;
+short g3785;
+long g3786;
+long g3787;
+short g3788;
+short g3789;
+long g3790;
+short g3791;
+short g3792;
+short g3793;
+char g3794;
+short g3795;
+long g3796;
+long g3797;
+char g3798;
+char g3799;
+long g3800;
+short g3801;
+long g3802;
+int g3803;
+long g3804;
+long g3805;
+int g3806;
+int g3807;
+long g3808;
+int g3809;
+int g3810;
+char g3811;
+char g3812;
+int g3813;
+long g3814;
+short g3815;
+char g3816;
+long g3817;
+short g3818;
+long g3819;
+short g3820;
+int g3821;
+long g3822;
+int g3823;
+short g3824;
+short g3825;
+char g3826;
+short g3827;
+int g3828;
+long g3829;
+long g3830;
+int g3831;
+long g3832;
+short g3833;
+long g3834;
+short g3835;
+int g3836;
+char g3837;
+long g3838;
+long g3839;
+short g3840;
+int g3841;
+short g3842;
+char g3843;
+short g3844;
+long g3845;
+int g3846;
+long g3847;
+char g3848;
+long g3849;
+long g3850;
+long g3851;
+char g3852;
+int g3853;
+int g3854;
+int g3855;
+short g3856;
+long g3857;
+short g3858;
+long g3859;
+long g3860;
+short g3861;
+int g3862;
+char g3863;
+char g3864;
+int g3865;
+short g3866;
+long g3867;
+char g3868;
+long g3869;
+char g3870;
+int g3871;
+long g3872;
+long g3873;
+long g3874;
+short g3875;
+char g3876;
+char g3877;
+long g3878;
+long g3879;
+short g3880;
+char g3881;
+long g3882;
+short g3883;
+int g3884;
+char g3885;
+char g3886;
+long g3887;
+int g3888;
+char g3889;
+long g3890;
+long g3891;
+char g3892;
+short g3893;
+long g3894;
+short g3895;
+short g3896;
+char g3897;
+int g3898;
+int g3899;
+long g3900;
+long g3901;
+int g3902;
+int g3903;
+int g3904;
+long g3905;
+int g3906;
+int g3907;
+char g3908;
+int g3909;
+char g3910;
+long g3911;
+short g3912;
+char g3913;
+short g3914;
+long g3915;
+long g3916;
+short g3917;
+char g3918;
+char g3919;
+int g3920;
+char g3921;
+char g3922;
+char g3923;
+char g3924;
+short g3925;
+int g3926;
+short g3927;
+int g3928;
+char g3929;
+int g3930;
+int g3931;
+short g3932;
+int g3933;
+long g3934;
+long g3935;
+long g3936;
+long g3937;
+short g3938;
+int g3939;
+short g3940;
+long g3941;
+short g3942;
+long g3943;
+int g3944;
+long g3945;
+long g3946;
+char g3947;
+short g3948;
+long g3949;
+char g3950;
+long g3951;
+char g3952;
+short g3953;
+short g3954;
+long g3955;
+short g3956;
+int g3957;
+int g3958;
+long g3959;
+short g3960;
+int g3961;
+long g3962;
+long g3963;
+long g3964;
+long g3965;
+char g3966;
+char g3967;
+char g3968;
+long g3969;
+char g3970;
+int g3971;
+int g3972;
+int g3973;
+long g3974;
+int g3975;
+long g3976;
+char g3977;
+char g3978;
+long g3979;
+long g3980;
+int g3981;
+short g3982;
+long g3983;
+int g3984;
+char g3985;
+char g3986;
+short g3987;
+short g3988;
+short g3989;
+char g3990;
+short g3991;
+int g3992;
+int g3993;
+int g3994;
+long g3995;
+int g3996;
+long g3997;
+int g3998;
+long g3999;
+short g4000;
+char g4001;
+int g4002;
+long g4003;
+short g4004;
+char g4005;
+int g4006;
+long g4007;
+int g4008;
+long g4009;
+int g4010;
+short g4011;
+short g4012;
+char g4013;
+short g4014;
+short g4015;
+int g4016;
+char g4017;
+short g4018;
+short g4019;
+int g4020;
+short g4021;
+char g4022;
+char g4023;
+int g4024;
+short g4025;
+long g4026;
+long g4027;
+short g4028;
+int g4029;
+short g4030;
+char g4031;
+long g4032;
+long g4033;
+char g4034;
+short g4035;
+int g4036;
+char g4037;
+int g4038;
+short g4039;
+char g4040;
+short g4041;
+long g4042;
+short g4043;
+char g4044;
+int g4045;
+short g4046;
+int g4047;
+char g4048;
+int g4049;
+short g4050;
+char g4051;
+long g4052;
+char g4053;
+long g4054;
+int g4055;
+long g4056;
+char g4057;
+int g4058;
+int g4059;
+char g4060;
+long g4061;
+short g4062;
+int g4063;
+int g4064;
+long g4065;
+int g4066;
+char g4067;
+int g4068;
+short g4069;
+long g4070;
+int g4071;
+long g4072;
+long g4073;
+long g4074;
+char g4075;
+long g4076;
+int g4077;
+char g4078;
+short g4079;
+short g4080;
+char g4081;
+short g4082;
+long g4083;
+char g4084;
+int g4085;
+short g4086;
+long g4087;
+char g4088;
+long g4089;
+char g4090;
+short g4091;
+short g4092;
+long g4093;
+char g4094;
+short g4095;
+char g4096;
+long g4097;
+int g4098;
+long g4099;
+int g4100;
+long g4101;
+short g4102;
+short g4103;
+char g4104;
+int g4105;
+int g4106;
+long g4107;
+char g4108;
+char g4109;
+char g4110;
+char g4111;
+int g4112;
+long g4113;
+char g4114;
+short g4115;
+long g4116;
+long g4117;
+long g4118;
+short g4119;
+short g4120;
+char g4121;
+long g4122;
+short g4123;
+char g4124;
+short g4125;
+int g4126;
+char g4127;
+char g4128;
+char g4129;
+int g4130;
+short g4131;
+int g4132;
+char g4133;
+int g4134;
+long g4135;
+short g4136;
+char g4137;
+long g4138;
+int g4139;
+short g4140;
+long g4141;
+short g4142;
+char g4143;
+int g4144;
+int g4145;
+char g4146;
+int g4147;
+int g4148;
+int g4149;
+short g4150;
+short g4151;
+short g4152;
+char g4153;
+long g4154;
+int g4155;
+short g4156;
+int g4157;
+int g4158;
+int g4159;
+char g4160;
+char g4161;
+char g4162;
+short g4163;
+short g4164;
+int g4165;
+int g4166;
+char g4167;
+int g4168;
+char g4169;
+long g4170;
+long g4171;
+long g4172;
+int g4173;
+int g4174;
+short g4175;
+short g4176;
+long g4177;
+short g4178;
+int g4179;
+int g4180;
+char g4181;
+char g4182;
+long g4183;
+short g4184;
+int g4185;
+int g4186;
+long g4187;
+char g4188;
+long g4189;
+long g4190;
+int g4191;
+short g4192;
+long g4193;
+char g4194;
+char g4195;
+short g4196;
+long g4197;
+int g4198;
+char g4199;
+long g4200;
+char g4201;
+int g4202;
+char g4203;
+char g4204;
+short g4205;
+char g4206;
+long g4207;
+int g4208;
+char g4209;
+short g4210;
+short g4211;
+long g4212;
+long g4213;
+short g4214;
+int g4215;
+int g4216;
+char g4217;
+int g4218;
+int g4219;
+int g4220;
+long g4221;
+char g4222;
+int g4223;
+long g4224;
+long g4225;
+short g4226;
+int g4227;
+short g4228;
+char g4229;
+long g4230;
+short g4231;
+int g4232;
+long g4233;
+short g4234;
+short g4235;
+char g4236;
+char g4237;
+int g4238;
+short g4239;
+char g4240;
+char g4241;
+char g4242;
+char g4243;
+short g4244;
+short g4245;
+short g4246;
+char g4247;
+long g4248;
+short g4249;
+char g4250;
+int g4251;
+char g4252;
+int g4253;
+short g4254;
+int g4255;
+long g4256;
+char g4257;
+short g4258;
+int g4259;
+short g4260;
+char g4261;
+char g4262;
+long g4263;
+char g4264;
+int g4265;
+char g4266;
+int g4267;
+char g4268;
+char g4269;
+char g4270;
+short g4271;
+int g4272;
+short g4273;
+char g4274;
+int g4275;
+long g4276;
+int g4277;
+long g4278;
+int g4279;
+int g4280;
+char g4281;
+char g4282;
+long g4283;
+short g4284;
+int g4285;
+char g4286;
+long g4287;
+long g4288;
+long g4289;
+long g4290;
+short g4291;
+long g4292;
+int g4293;
+int g4294;
+long g4295;
+long g4296;
+long g4297;
+int g4298;
+long g4299;
+long g4300;
+int g4301;
+char g4302;
+int g4303;
+long g4304;
+char g4305;
+short g4306;
+int g4307;
+short g4308;
+int g4309;
+char g4310;
+short g4311;
+char g4312;
+char g4313;
+int g4314;
+int g4315;
+long g4316;
+char g4317;
+int g4318;
+long g4319;
+short g4320;
+long g4321;
+char g4322;
+char g4323;
+char g4324;
+char g4325;
+int g4326;
+short g4327;
+char g4328;
+short g4329;
+short g4330;
+short g4331;
+int g4332;
+char g4333;
+int g4334;
+char g4335;
+int g4336;
+short g4337;
+int g4338;
+long g4339;
+short g4340;
+char g4341;
+short g4342;
+char g4343;
+short g4344;
+short g4345;
+short g4346;
+short g4347;
+int g4348;
+int g4349;
+long g4350;
+long g4351;
+long g4352;
+short g4353;
+int g4354;
+char g4355;
+char g4356;
+char g4357;
+int g4358;
+long g4359;
+char g4360;
+char g4361;
+short g4362;
+char g4363;
+int g4364;
+char g4365;
+short g4366;
+int g4367;
+int g4368;
+long g4369;
+short g4370;
+char g4371;
+short g4372;
+short g4373;
+int g4374;
+long g4375;
+char g4376;
+long g4377;
+short g4378;
+short g4379;
+int g4380;
+int g4381;
+int g4382;
+int g4383;
+int g4384;
+int g4385;
+short g4386;
+char g4387;
+short g4388;
+char g4389;
+long g4390;
+char g4391;
+short g4392;
+char g4393;
+int g4394;
+long g4395;
+short g4396;
+short g4397;
+long g4398;
+char g4399;
+int g4400;
+int g4401;
+short g4402;
+int g4403;
+long g4404;
+long g4405;
+long g4406;
+short g4407;
+char g4408;
+short g4409;
+short g4410;
+int g4411;
+long g4412;
+int g4413;
+long g4414;
+int g4415;
+long g4416;
+short g4417;
+long g4418;
+int g4419;
+short g4420;
+long g4421;
+int g4422;
+short g4423;
+long g4424;
+char g4425;
+char g4426;
+char g4427;
+int g4428;
+long g4429;
+char g4430;
+long g4431;
+long g4432;
+int g4433;
+long g4434;
+short g4435;
+int g4436;
+long g4437;
+long g4438;
+int g4439;
+short g4440;
+char g4441;
+int g4442;
+long g4443;
+int g4444;
+short g4445;
+short g4446;
+long g4447;
+char g4448;
+char g4449;
+int g4450;
+char g4451;
+short g4452;
+int g4453;
+short g4454;
+int g4455;
+int g4456;
+long g4457;
+short g4458;
+char g4459;
+int g4460;
+long g4461;
+int g4462;
+long g4463;
+int g4464;
+short g4465;
+int g4466;
+char g4467;
+int g4468;
+int g4469;
+long g4470;
+short g4471;
+short g4472;
+short g4473;
+short g4474;
+int g4475;
+char g4476;
+short g4477;
+short g4478;
+long g4479;
+long g4480;
+long g4481;
+short g4482;
+long g4483;
+long g4484;
+long g4485;
+long g4486;
+char g4487;
+long g4488;
+char g4489;
+short g4490;
+short g4491;
+long g4492;
+char g4493;
+long g4494;
+int g4495;
+short g4496;
+long g4497;
+long g4498;
+int g4499;
+long g4500;
+char g4501;
+long g4502;
+char g4503;
+long g4504;
+int g4505;
+char g4506;
+int g4507;
+int g4508;
+long g4509;
+short g4510;
+long g4511;
+short g4512;
+short g4513;
+short g4514;
+char g4515;
+short g4516;
+char g4517;
+char g4518;
+short g4519;
+long g4520;
+short g4521;
+char g4522;
+int g4523;
+long g4524;
+long g4525;
+int g4526;
+int g4527;
+long g4528;
+char g4529;
+char g4530;
+short g4531;
+short g4532;
+long g4533;
+int g4534;
+long g4535;
+long g4536;
+int g4537;
+int g4538;
+short g4539;
+int g4540;
+int g4541;
+long g4542;
+long g4543;
+short g4544;
+long g4545;
+int g4546;
+char g4547;
+short g4548;
+char g4549;
+short g4550;
+int g4551;
+short g4552;
+short g4553;
+int g4554;
+char g4555;
+char g4556;
+char g4557;
+char g4558;
+long g4559;
+long g4560;
+short g4561;
+int g4562;
+long g4563;
+long g4564;
+char g4565;
+short g4566;
+long g4567;
+char g4568;
+long g4569;
+char g4570;
+long g4571;
+char g4572;
+long g4573;
+int g4574;
+int g4575;
+short g4576;
+short g4577;
+int g4578;
+long g4579;
+long g4580;
+long g4581;
+char g4582;
+short g4583;
+char g4584;
+int g4585;
+short g4586;
+int g4587;
+int g4588;
+short g4589;
+char g4590;
+int g4591;
+int g4592;
+int g4593;
+long g4594;
+short g4595;
+char g4596;
+int g4597;
+short g4598;
+char g4599;
+char g4600;
+char g4601;
+int g4602;
+char g4603;
+short g4604;
+char g4605;
+char g4606;
+long g4607;
+char g4608;
+short g4609;
+long g4610;
+long g4611;
+long g4612;
+long g4613;
+long g4614;
+long g4615;
+int g4616;
+short g4617;
+long g4618;
+long g4619;
+int g4620;
+char g4621;
+int g4622;
+long g4623;
+short g4624;
+char g4625;
+short g4626;
+char g4627;
+char g4628;
+char g4629;
+int g4630;
+int g4631;
+int g4632;
+long g4633;
+short g4634;
+short g4635;
+int g4636;
+short g4637;
+char g4638;
+long g4639;
+char g4640;
+int g4641;
+char g4642;
+short g4643;
+short g4644;
+char g4645;
+int g4646;
+long g4647;
+char g4648;
+char g4649;
+int g4650;
+long g4651;
+long g4652;
+char g4653;
+long g4654;
+char g4655;
+char g4656;
+short g4657;
+short g4658;
+char g4659;
+short g4660;
+int g4661;
+int g4662;
+char g4663;
+int g4664;
+short g4665;
+char g4666;
+short g4667;
+short g4668;
+char g4669;
+char g4670;
+long g4671;
+int g4672;
+short g4673;
+int g4674;
+short g4675;
+char g4676;
+int g4677;
+int g4678;
+long g4679;
+long g4680;
+long g4681;
+long g4682;
+int g4683;
+char g4684;
+int g4685;
+long g4686;
+short g4687;
+int g4688;
+long g4689;
+char g4690;
+int g4691;
+char g4692;
+short g4693;
+char g4694;
+short g4695;
+long g4696;
+short g4697;
+short g4698;
+char g4699;
+char g4700;
+char g4701;
+char g4702;
+char g4703;
+char g4704;
+char g4705;
+char g4706;
+char g4707;
+short g4708;
+long g4709;
+long g4710;
+short g4711;
+short g4712;
+long g4713;
+short g4714;
+char g4715;
+char g4716;
+char g4717;
+short g4718;
+long g4719;
+long g4720;
+char g4721;
+short g4722;
+long g4723;
+long g4724;
+short g4725;
+int g4726;
+short g4727;
+long g4728;
+long g4729;
+char g4730;
+long g4731;
+short g4732;
+char g4733;
+long g4734;
+int g4735;
+short g4736;
+int g4737;
+char g4738;
+long g4739;
+char g4740;
+int g4741;
+short g4742;
+int g4743;
+short g4744;
+long g4745;
+char g4746;
+short g4747;
+char g4748;
+int g4749;
+short g4750;
+long g4751;
+long g4752;
+long g4753;
+char g4754;
+short g4755;
+long g4756;
+char g4757;
+short g4758;
+char g4759;
+short g4760;
+int g4761;
+short g4762;
+int g4763;
+int g4764;
+short g4765;
+char g4766;
+short g4767;
+int g4768;
+long g4769;
+int g4770;
+char g4771;
+int g4772;
+long g4773;
+short g4774;
+long g4775;
+long g4776;
+short g4777;
+long g4778;
+int g4779;
+short g4780;
+char g4781;
+char g4782;
+int g4783;
+short g4784;
+char g4785;
+int g4786;
+int g4787;
+char g4788;
+char g4789;
+short g4790;
+short g4791;
+short g4792;
+char g4793;
+short g4794;
+short g4795;
+int g4796;
+char g4797;
+short g4798;
+short g4799;
+long g4800;
+long g4801;
+char g4802;
+char g4803;
+char g4804;
+int g4805;
+char g4806;
+char g4807;
+char g4808;
+char g4809;
+short g4810;
+char g4811;
+short g4812;
+char g4813;
+short g4814;
+short g4815;
+int g4816;
+long g4817;
+short g4818;
+short g4819;
+int g4820;
+long g4821;
+int g4822;
+short g4823;
+short g4824;
+int g4825;
+long g4826;
+short g4827;
+short g4828;
+int g4829;
+short g4830;
+char g4831;
+char g4832;
+char g4833;
+short g4834;
+short g4835;
+char g4836;
+long g4837;
+char g4838;
+long g4839;
+int g4840;
+char g4841;
+long g4842;
+char g4843;
+short g4844;
+long g4845;
+int g4846;
+int g4847;
+int g4848;
+short g4849;
+long g4850;
+long g4851;
+int g4852;
+char g4853;
+char g4854;
+char g4855;
+long g4856;
+char g4857;
+long g4858;
+short g4859;
+long g4860;
+char g4861;
+short g4862;
+short g4863;
+char g4864;
+int g4865;
+int g4866;
+char g4867;
+long g4868;
+char g4869;
+int g4870;
+long g4871;
+char g4872;
+int g4873;
+short g4874;
+long g4875;
+int g4876;
+short g4877;
+char g4878;
+short g4879;
+char g4880;
+int g4881;
+long g4882;
+short g4883;
+char g4884;
+short g4885;
+long g4886;
+int g4887;
+long g4888;
+int g4889;
+long g4890;
+char g4891;
+int g4892;
+short g4893;
+int g4894;
+int g4895;
+int g4896;
+long g4897;
+short g4898;
+long g4899;
+short g4900;
+char g4901;
+int g4902;
+int g4903;
+short g4904;
+int g4905;
+short g4906;
+int g4907;
+char g4908;
+short g4909;
+short g4910;
+int g4911;
+short g4912;
+long g4913;
+short g4914;
+short g4915;
+int g4916;
+int g4917;
+int g4918;
+char g4919;
+long g4920;
+char g4921;
+short g4922;
+short g4923;
+int g4924;
+int g4925;
+char g4926;
+short g4927;
+int g4928;
+short g4929;
+short g4930;
+int g4931;
+int g4932;
+char g4933;
+long g4934;
+char g4935;
+char g4936;
+char g4937;
+long g4938;
+int g4939;
+long g4940;
+int g4941;
+short g4942;
+int g4943;
+int g4944;
+char g4945;
+long g4946;
+long g4947;
+int g4948;
+char g4949;
+int g4950;
+short g4951;
+long g4952;
+short g4953;
+long g4954;
+char g4955;
+int g4956;
+long g4957;
+long g4958;
+short g4959;
+short g4960;
+int g4961;
+long g4962;
+short g4963;
+short g4964;
+short g4965;
+long g4966;
+short g4967;
+char g4968;
+long g4969;
+short g4970;
+int g4971;
+long g4972;
+char g4973;
+char g4974;
+short g4975;
+short g4976;
+long g4977;
+short g4978;
+int g4979;
+short g4980;
+int g4981;
+short g4982;
+long g4983;
+short g4984;
+long g4985;
+char g4986;
+int g4987;
+int g4988;
+char g4989;
+short g4990;
+long g4991;
+long g4992;
+char g4993;
+char g4994;
+long g4995;
+char g4996;
+short g4997;
+long g4998;
+long g4999;
+
+long u0() {
+  g0 = g3143 + g4065;
+  g1 = g1573 + g3046;
+  g2 = g4790 + g2148;
+  g3 = g3144 + g4530;
+  g4 = g230 + g85;
+  g5 = g802 + g782;
+  g6 = g2245 + g80;
+  g7 = g2575 + g2144;
+  g8 = g562 + g1902;
+  g9 = g1890 + g3187;
+  return g0;
+}
+
+long u1() {
+  g10 = g2532 + g3341;
+  g11 = g3788 + g3642;
+  g12 = g3225 + g2327;
+  g13 = g4013 + g2696;
+  g14 = g832 + g2335;
+  g15 = g3172 + g4263;
+  g16 = g2017 + g75;
+  g17 = g2598 + g2661;
+  g18 = g3565 + g81;
+  g19 = g2099 + g3686;
+  return g10;
+}
+
+long u2() {
+  g20 = g1177 + g3063;
+  g21 = g844 + g315;
+  g22 = g4499 + g3835;
+  g23 = g2804 + g4723;
+  g24 = g1192 + g3459;
+  g25 = g4878 + g1116;
+  g26 = g263 + g2101;
+  g27 = g2302 + g1738;
+  g28 = g2350 + g250;
+  g29 = g4504 + g2527;
+  return g20;
+}
+
+long u3() {
+  g30 = g3831 + g4537;
+  g31 = g2093 + g4174;
+  g32 = g2388 + g3576;
+  g33 = g2730 + g2221;
+  g34 = g3403 + g4594;
+  g35 = g1338 + g362;
+  g36 = g4856 + g3085;
+  g37 = g2799 + g1646;
+  g38 = g1313 + g316;
+  g39 = g1891 + g2785;
+  return g30;
+}
+
+long u4() {
+  g40 = g1956 + g770;
+  g41 = g2156 + g1813;
+  g42 = g4377 + g3589;
+  g43 = g2989 + g2583;
+  g44 = g170 + g2934;
+  g45 = g701 + g1776;
+  g46 = g1037 + g4349;
+  g47 = g3418 + g212;
+  g48 = g1259 + g2279;
+  g49 = g3527 + g2999;
+  return g40;
+}
+
+long u5() {
+  g50 = g2995 + g3472;
+  g51 = g4578 + g902;
+  g52 = g2023 + g2401;
+  g53 = g2797 + g4278;
+  g54 = g3754 + g1959;
+  g55 = g4563 + g861;
+  g56 = g184 + g4956;
+  g57 = g62 + g4180;
+  g58 = g1388 + g1431;
+  g59 = g3713 + g4812;
+  return g50;
+}
+
+long u6() {
+  g60 = g4256 + g4161;
+  g61 = g4064 + g2853;
+  g62 = g1419 + g3321;
+  g63 = g965 + g109;
+  g64 = g1444 + g3766;
+  g65 = g2967 + g3186;
+  g66 = g2005 + g225;
+  g67 = g800 + g4676;
+  g68 = g3011 + g2789;
+  g69 = g2346 + g5;
+  return g60;
+}
+
+long u7() {
+  g70 = g3160 + g1749;
+  g71 = g4808 + g1655;
+  g72 = g663 + g1292;
+  g73 = g2628 + g1852;
+  g74 = g2444 + g3647;
+  g75 = g4920 + g393;
+  g76 = g291 + g3321;
+  g77 = g3025 + g1713;
+  g78 = g4998 + g3616;
+  g79 = g1944 + g4176;
+  return g70;
+}
+
+long u8() {
+  g80 = g3629 + g51;
+  g81 = g554 + g1266;
+  g82 = g1923 + g4459;
+  g83 = g2678 + g4957;
+  g84 = g4205 + g1532;
+  g85 = g4771 + g931;
+  g86 = g139 + g3201;
+  g87 = g2983 + g4129;
+  g88 = g4328 + g3121;
+  g89 = g4020 + g1971;
+  return g80;
+}
+
+long u9() {
+  g90 = g240 + g1564;
+  g91 = g3682 + g1973;
+  g92 = g1367 + g1099;
+  g93 = g3490 + g2636;
+  g94 = g1342 + g245;
+  g95 = g4089 + g1873;
+  g96 = g3771 + g2978;
+  g97 = g734 + g153;
+  g98 = g3202 + g1178;
+  g99 = g3822 + g1677;
+  return g90;
+}
+
+long u10() {
+  g100 = g1334 + g3527;
+  g101 = g3557 + g4633;
+  g102 = g874 + g1259;
+  g103 = g3850 + g4060;
+  g104 = g1325 + g426;
+  g105 = g1859 + g1881;
+  g106 = g179 + g410;
+  g107 = g1854 + g2564;
+  g108 = g2895 + g4898;
+  g109 = g3937 + g2304;
+  return g100;
+}
+
+long u11() {
+  g110 = g3203 + g3389;
+  g111 = g2942 + g466;
+  g112 = g2755 + g4198;
+  g113 = g2416 + g3800;
+  g114 = g1070 + g4230;
+  g115 = g1032 + g1540;
+  g116 = g4950 + g927;
+  g117 = g1401 + g783;
+  g118 = g4057 + g3616;
+  g119 = g4901 + g3483;
+  return g110;
+}
+
+long u12() {
+  g120 = g3754 + g288;
+  g121 = g2993 + g3813;
+  g122 = g565 + g1019;
+  g123 = g2817 + g4595;
+  g124 = g3086 + g2838;
+  g125 = g203 + g2641;
+  g126 = g777 + g2598;
+  g127 = g4927 + g3914;
+  g128 = g842 + g2999;
+  g129 = g4886 + g2594;
+  return g120;
+}
+
+long u13() {
+  g130 = g2723 + g808;
+  g131 = g209 + g678;
+  g132 = g3544 + g4160;
+  g133 = g1594 + g2670;
+  g134 = g4968 + g1299;
+  g135 = g4408 + g2475;
+  g136 = g251 + g856;
+  g137 = g4247 + g4733;
+  g138 = g806 + g4046;
+  g139 = g930 + g912;
+  return g130;
+}
+
+long u14() {
+  g140 = g2182 + g4663;
+  g141 = g3537 + g1584;
+  g142 = g3469 + g3009;
+  g143 = g3029 + g3687;
+  g144 = g1875 + g1440;
+  g145 = g3049 + g889;
+  g146 = g3341 + g722;
+  g147 = g4556 + g2078;
+  g148 = g2152 + g4043;
+  g149 = g1411 + g4650;
+  return g140;
+}
+
+long u15() {
+  g150 = g3727 + g4799;
+  g151 = g2546 + g4470;
+  g152 = g3865 + g4341;
+  g153 = g1029 + g4771;
+  g154 = g1801 + g1292;
+  g155 = g3021 + g1251;
+  g156 = g3008 + g4672;
+  g157 = g2469 + g1024;
+  g158 = g2963 + g4609;
+  g159 = g1024 + g4792;
+  return g150;
+}
+
+long u16() {
+  g160 = g1577 + g1762;
+  g161 = g4283 + g1659;
+  g162 = g3826 + g3933;
+  g163 = g2346 + g3714;
+  g164 = g4479 + g1215;
+  g165 = g2682 + g1114;
+  g166 = g636 + g2775;
+  g167 = g310 + g4154;
+  g168 = g4953 + g1611;
+  g169 = g4245 + g1154;
+  return g160;
+}
+
+long u17() {
+  g170 = g4710 + g4019;
+  g171 = g3170 + g157;
+  g172 = g1696 + g1123;
+  g173 = g4257 + g416;
+  g174 = g2457 + g506;
+  g175 = g2411 + g4852;
+  g176 = g1867 + g2353;
+  g177 = g4930 + g2791;
+  g178 = g420 + g213;
+  g179 = g246 + g2906;
+  return g170;
+}
+
+long u18() {
+  g180 = g2047 + g4199;
+  g181 = g1253 + g2511;
+  g182 = g364 + g4303;
+  g183 = g937 + g3314;
+  g184 = g534 + g4179;
+  g185 = g1458 + g2170;
+  g186 = g4402 + g1232;
+  g187 = g3524 + g94;
+  g188 = g4207 + g4005;
+  g189 = g1168 + g7;
+  return g180;
+}
+
+long u19() {
+  g190 = g3288 + g2121;
+  g191 = g3217 + g4853;
+  g192 = g4713 + g124;
+  g193 = g767 + g4516;
+  g194 = g2596 + g2694;
+  g195 = g2355 + g1078;
+  g196 = g4690 + g1712;
+  g197 = g1818 + g1588;
+  g198 = g44 + g1590;
+  g199 = g390 + g144;
+  return g190;
+}
+
+long u20() {
+  g200 = g2298 + g4592;
+  g201 = g1395 + g1983;
+  g202 = g4576 + g4052;
+  g203 = g4720 + g2800;
+  g204 = g4989 + g2481;
+  g205 = g1895 + g3443;
+  g206 = g3090 + g2350;
+  g207 = g4359 + g768;
+  g208 = g1406 + g3255;
+  g209 = g2332 + g1457;
+  return g200;
+}
+
+long u21() {
+  g210 = g4206 + g98;
+  g211 = g543 + g1038;
+  g212 = g3375 + g4051;
+  g213 = g3279 + g2142;
+  g214 = g3103 + g4254;
+  g215 = g4124 + g1775;
+  g216 = g2171 + g1479;
+  g217 = g4090 + g1443;
+  g218 = g2673 + g3394;
+  g219 = g2312 + g4965;
+  return g210;
+}
+
+long u22() {
+  g220 = g611 + g1947;
+  g221 = g2214 + g3761;
+  g222 = g152 + g469;
+  g223 = g3472 + g2893;
+  g224 = g3748 + g3360;
+  g225 = g4550 + g1090;
+  g226 = g1999 + g2722;
+  g227 = g1755 + g3343;
+  g228 = g4413 + g3639;
+  g229 = g3188 + g3408;
+  return g220;
+}
+
+long u23() {
+  g230 = g4453 + g3293;
+  g231 = g4826 + g2856;
+  g232 = g222 + g975;
+  g233 = g991 + g1031;
+  g234 = g792 + g3820;
+  g235 = g1494 + g3572;
+  g236 = g4285 + g4216;
+  g237 = g1004 + g919;
+  g238 = g2720 + g672;
+  g239 = g3099 + g2884;
+  return g230;
+}
+
+long u24() {
+  g240 = g3729 + g1911;
+  g241 = g4051 + g4067;
+  g242 = g452 + g2570;
+  g243 = g3763 + g2535;
+  g244 = g2906 + g2610;
+  g245 = g4516 + g1747;
+  g246 = g2015 + g1302;
+  g247 = g3876 + g4025;
+  g248 = g4962 + g4650;
+  g249 = g1440 + g1507;
+  return g240;
+}
+
+long u25() {
+  g250 = g312 + g878;
+  g251 = g1295 + g2342;
+  g252 = g960 + g3075;
+  g253 = g969 + g3469;
+  g254 = g3309 + g684;
+  g255 = g805 + g3192;
+  g256 = g416 + g3367;
+  g257 = g3803 + g4639;
+  g258 = g521 + g4591;
+  g259 = g1810 + g3761;
+  return g250;
+}
+
+long u26() {
+  g260 = g2687 + g1366;
+  g261 = g38 + g878;
+  g262 = g2712 + g4547;
+  g263 = g930 + g3046;
+  g264 = g2823 + g1163;
+  g265 = g3377 + g1617;
+  g266 = g2758 + g3774;
+  g267 = g2747 + g4683;
+  g268 = g998 + g4093;
+  g269 = g4223 + g1128;
+  return g260;
+}
+
+long u27() {
+  g270 = g4986 + g4887;
+  g271 = g1451 + g1364;
+  g272 = g272 + g3781;
+  g273 = g205 + g4749;
+  g274 = g4700 + g889;
+  g275 = g471 + g3374;
+  g276 = g501 + g2370;
+  g277 = g3725 + g4086;
+  g278 = g2586 + g2902;
+  g279 = g4008 + g2940;
+  return g270;
+}
+
+long u28() {
+  g280 = g4171 + g1557;
+  g281 = g1575 + g1748;
+  g282 = g2514 + g3695;
+  g283 = g815 + g2719;
+  g284 = g3092 + g3594;
+  g285 = g1964 + g1150;
+  g286 = g4323 + g4239;
+  g287 = g735 + g3333;
+  g288 = g2230 + g4720;
+  g289 = g2251 + g4753;
+  return g280;
+}
+
+long u29() {
+  g290 = g1187 + g1301;
+  g291 = g4786 + g3013;
+  g292 = g211 + g1586;
+  g293 = g3251 + g2299;
+  g294 = g3141 + g4585;
+  g295 = g2107 + g1664;
+  g296 = g1837 + g685;
+  g297 = g3104 + g2946;
+  g298 = g1113 + g3945;
+  g299 = g4551 + g2790;
+  return g290;
+}
+
+long u30() {
+  g300 = g368 + g1773;
+  g301 = g187 + g2428;
+  g302 = g835 + g832;
+  g303 = g2687 + g135;
+  g304 = g4119 + g382;
+  g305 = g4332 + g2168;
+  g306 = g913 + g3724;
+  g307 = g2195 + g2700;
+  g308 = g4609 + g2486;
+  g309 = g3543 + g2996;
+  return g300;
+}
+
+long u31() {
+  g310 = g2738 + g1773;
+  g311 = g3103 + g4968;
+  g312 = g2478 + g3321;
+  g313 = g4188 + g1004;
+  g314 = g2892 + g4190;
+  g315 = g3691 + g1017;
+  g316 = g1371 + g2311;
+  g317 = g4682 + g612;
+  g318 = g3428 + g3829;
+  g319 = g745 + g4008;
+  return g310;
+}
+
+long u32() {
+  g320 = g501 + g4562;
+  g321 = g971 + g4416;
+  g322 = g4265 + g4373;
+  g323 = g3306 + g4626;
+  g324 = g2471 + g3201;
+  g325 = g3554 + g901;
+  g326 = g817 + g2040;
+  g327 = g4740 + g1830;
+  g328 = g2608 + g3484;
+  g329 = g3061 + g4336;
+  return g320;
+}
+
+long u33() {
+  g330 = g3195 + g1689;
+  g331 = g781 + g1272;
+  g332 = g2105 + g1561;
+  g333 = g3591 + g4168;
+  g334 = g4141 + g2382;
+  g335 = g3415 + g3450;
+  g336 = g1559 + g3972;
+  g337 = g2512 + g2261;
+  g338 = g1478 + g4424;
+  g339 = g58 + g1655;
+  return g330;
+}
+
+long u34() {
+  g340 = g2114 + g2138;
+  g341 = g4236 + g140;
+  g342 = g4510 + g1155;
+  g343 = g1019 + g3870;
+  g344 = g3987 + g4341;
+  g345 = g3779 + g2322;
+  g346 = g198 + g1263;
+  g347 = g2839 + g783;
+  g348 = g4635 + g3916;
+  g349 = g128 + g2297;
+  return g340;
+}
+
+long u35() {
+  g350 = g328 + g1818;
+  g351 = g2711 + g2629;
+  g352 = g4436 + g3317;
+  g353 = g17 + g3178;
+  g354 = g2086 + g3570;
+  g355 = g4673 + g1198;
+  g356 = g2606 + g4149;
+  g357 = g192 + g3092;
+  g358 = g1270 + g939;
+  g359 = g4464 + g3339;
+  return g350;
+}
+
+long u36() {
+  g360 = g2096 + g2248;
+  g361 = g272 + g2615;
+  g362 = g1689 + g3089;
+  g363 = g1051 + g3560;
+  g364 = g3559 + g1741;
+  g365 = g640 + g34;
+  g366 = g1919 + g3437;
+  g367 = g299 + g1970;
+  g368 = g1669 + g1832;
+  g369 = g2270 + g1553;
+  return g360;
+}
+
+long u37() {
+  g370 = g3368 + g3364;
+  g371 = g4122 + g4900;
+  g372 = g3360 + g222;
+  g373 = g2435 + g2828;
+  g374 = g3571 + g633;
+  g375 = g3649 + g3906;
+  g376 = g1010 + g2279;
+  g377 = g1489 + g2479;
+  g378 = g4254 + g1683;
+  g379 = g4746 + g3590;
+  return g370;
+}
+
+long u38() {
+  g380 = g1068 + g272;
+  g381 = g4000 + g1278;
+  g382 = g4494 + g1065;
+  g383 = g3994 + g252;
+  g384 = g4968 + g4789;
+  g385 = g1677 + g3537;
+  g386 = g3296 + g3023;
+  g387 = g827 + g2227;
+  g388 = g3438 + g1469;
+  g389 = g2277 + g620;
+  return g380;
+}
+
+long u39() {
+  g390 = g3748 + g1047;
+  g391 = g2890 + g3004;
+  g392 = g4126 + g502;
+  g393 = g1372 + g3326;
+  g394 = g1271 + g2630;
+  g395 = g1370 + g4382;
+  g396 = g1303 + g33;
+  g397 = g1343 + g4494;
+  g398 = g4374 + g2244;
+  g399 = g958 + g3810;
+  return g390;
+}
+
+long u40() {
+  g400 = g2802 + g1996;
+  g401 = g4414 + g3377;
+  g402 = g4222 + g1904;
+  g403 = g3794 + g2148;
+  g404 = g4190 + g4085;
+  g405 = g2638 + g2275;
+  g406 = g630 + g1699;
+  g407 = g1114 + g690;
+  g408 = g1538 + g791;
+  g409 = g1420 + g2906;
+  return g400;
+}
+
+long u41() {
+  g410 = g2513 + g2884;
+  g411 = g3469 + g1301;
+  g412 = g2454 + g2779;
+  g413 = g4379 + g2925;
+  g414 = g1498 + g3351;
+  g415 = g2436 + g4389;
+  g416 = g3442 + g3382;
+  g417 = g3483 + g884;
+  g418 = g3391 + g4120;
+  g419 = g3436 + g4733;
+  return g410;
+}
+
+long u42() {
+  g420 = g2535 + g3729;
+  g421 = g3552 + g2702;
+  g422 = g4323 + g3702;
+  g423 = g2122 + g190;
+  g424 = g558 + g1477;
+  g425 = g610 + g2067;
+  g426 = g2068 + g3501;
+  g427 = g269 + g2867;
+  g428 = g4463 + g3974;
+  g429 = g1698 + g4892;
+  return g420;
+}
+
+long u43() {
+  g430 = g4164 + g163;
+  g431 = g4805 + g3631;
+  g432 = g977 + g4288;
+  g433 = g3469 + g1995;
+  g434 = g3303 + g4541;
+  g435 = g2046 + g1354;
+  g436 = g869 + g3374;
+  g437 = g1302 + g4719;
+  g438 = g3382 + g3010;
+  g439 = g1886 + g1949;
+  return g430;
+}
+
+long u44() {
+  g440 = g2403 + g4735;
+  g441 = g4268 + g4083;
+  g442 = g345 + g1524;
+  g443 = g4918 + g1062;
+  g444 = g3584 + g1722;
+  g445 = g884 + g856;
+  g446 = g1259 + g1137;
+  g447 = g4034 + g924;
+  g448 = g4269 + g3565;
+  g449 = g4757 + g4867;
+  return g440;
+}
+
+long u45() {
+  g450 = g1355 + g1115;
+  g451 = g1333 + g4938;
+  g452 = g4270 + g4389;
+  g453 = g1705 + g543;
+  g454 = g4068 + g3953;
+  g455 = g4128 + g2147;
+  g456 = g1242 + g4344;
+  g457 = g350 + g4652;
+  g458 = g2497 + g3878;
+  g459 = g2458 + g2550;
+  return g450;
+}
+
+long u46() {
+  g460 = g1692 + g1363;
+  g461 = g4587 + g4504;
+  g462 = g2216 + g2456;
+  g463 = g2449 + g1123;
+  g464 = g746 + g2114;
+  g465 = g4126 + g3038;
+  g466 = g791 + g3958;
+  g467 = g2779 + g2284;
+  g468 = g2509 + g2322;
+  g469 = g542 + g1303;
+  return g460;
+}
+
+long u47() {
+  g470 = g4234 + g3116;
+  g471 = g1493 + g1229;
+  g472 = g1634 + g1141;
+  g473 = g518 + g1452;
+  g474 = g2771 + g1758;
+  g475 = g1972 + g4395;
+  g476 = g311 + g2355;
+  g477 = g4499 + g1744;
+  g478 = g2953 + g503;
+  g479 = g1586 + g3183;
+  return g470;
+}
+
+long u48() {
+  g480 = g4873 + g3421;
+  g481 = g1611 + g837;
+  g482 = g1096 + g3112;
+  g483 = g4737 + g2681;
+  g484 = g629 + g1480;
+  g485 = g3328 + g1344;
+  g486 = g1873 + g1677;
+  g487 = g2251 + g1119;
+  g488 = g3638 + g3435;
+  g489 = g4555 + g1271;
+  return g480;
+}
+
+long u49() {
+  g490 = g3752 + g3240;
+  g491 = g3640 + g778;
+  g492 = g4930 + g3016;
+  g493 = g3839 + g3648;
+  g494 = g1713 + g3310;
+  g495 = g2604 + g2928;
+  g496 = g760 + g3938;
+  g497 = g1439 + g3736;
+  g498 = g3247 + g1957;
+  g499 = g3080 + g1519;
+  return g490;
+}
+
+long u50() {
+  g500 = g1415 + g3238;
+  g501 = g3760 + g4618;
+  g502 = g1406 + g3774;
+  g503 = g100 + g4134;
+  g504 = g2278 + g4923;
+  g505 = g36 + g2538;
+  g506 = g1223 + g4184;
+  g507 = g4183 + g331;
+  g508 = g3437 + g3977;
+  g509 = g1990 + g3024;
+  return g500;
+}
+
+long u51() {
+  g510 = g1409 + g3360;
+  g511 = g2610 + g2653;
+  g512 = g1145 + g1262;
+  g513 = g2774 + g1860;
+  g514 = g4025 + g4133;
+  g515 = g2045 + g822;
+  g516 = g3592 + g1691;
+  g517 = g3544 + g3469;
+  g518 = g2842 + g4052;
+  g519 = g1975 + g3565;
+  return g510;
+}
+
+long u52() {
+  g520 = g1808 + g2737;
+  g521 = g3933 + g834;
+  g522 = g2636 + g214;
+  g523 = g2260 + g4419;
+  g524 = g2581 + g4929;
+  g525 = g1988 + g1395;
+  g526 = g881 + g4319;
+  g527 = g1422 + g3651;
+  g528 = g747 + g1029;
+  g529 = g659 + g1703;
+  return g520;
+}
+
+long u53() {
+  g530 = g3382 + g648;
+  g531 = g3018 + g4573;
+  g532 = g3564 + g2696;
+  g533 = g3418 + g4504;
+  g534 = g620 + g3448;
+  g535 = g943 + g2783;
+  g536 = g812 + g1309;
+  g537 = g2645 + g3143;
+  g538 = g2140 + g4470;
+  g539 = g397 + g1044;
+  return g530;
+}
+
+long u54() {
+  g540 = g1836 + g4648;
+  g541 = g110 + g161;
+  g542 = g3740 + g374;
+  g543 = g819 + g424;
+  g544 = g1666 + g2371;
+  g545 = g3007 + g1376;
+  g546 = g1702 + g2300;
+  g547 = g4528 + g3530;
+  g548 = g4285 + g2180;
+  g549 = g793 + g4400;
+  return g540;
+}
+
+long u55() {
+  g550 = g2578 + g2814;
+  g551 = g4944 + g4117;
+  g552 = g3975 + g1331;
+  g553 = g2769 + g4395;
+  g554 = g3435 + g4039;
+  g555 = g3089 + g2241;
+  g556 = g4923 + g3926;
+  g557 = g2169 + g2590;
+  g558 = g1146 + g4528;
+  g559 = g1892 + g322;
+  return g550;
+}
+
+long u56() {
+  g560 = g579 + g1151;
+  g561 = g3147 + g2824;
+  g562 = g3115 + g3435;
+  g563 = g2060 + g289;
+  g564 = g2561 + g964;
+  g565 = g1829 + g4183;
+  g566 = g3290 + g2168;
+  g567 = g1010 + g1783;
+  g568 = g746 + g3938;
+  g569 = g1058 + g3308;
+  return g560;
+}
+
+long u57() {
+  g570 = g3654 + g3111;
+  g571 = g789 + g1890;
+  g572 = g1973 + g4219;
+  g573 = g1299 + g1206;
+  g574 = g4633 + g4387;
+  g575 = g3479 + g2827;
+  g576 = g2233 + g3002;
+  g577 = g3281 + g3817;
+  g578 = g3316 + g1647;
+  g579 = g3142 + g3223;
+  return g570;
+}
+
+long u58() {
+  g580 = g4650 + g2156;
+  g581 = g4655 + g1727;
+  g582 = g2323 + g1151;
+  g583 = g2991 + g1001;
+  g584 = g831 + g1482;
+  g585 = g3748 + g387;
+  g586 = g2908 + g1634;
+  g587 = g3506 + g4739;
+  g588 = g4155 + g4623;
+  g589 = g2875 + g1193;
+  return g580;
+}
+
+long u59() {
+  g590 = g3105 + g2428;
+  g591 = g476 + g1294;
+  g592 = g4849 + g3;
+  g593 = g122 + g4653;
+  g594 = g2165 + g2798;
+  g595 = g2294 + g3946;
+  g596 = g1944 + g1223;
+  g597 = g416 + g4111;
+  g598 = g1598 + g906;
+  g599 = g4237 + g1473;
+  return g590;
+}
+
+long u60() {
+  g600 = g3133 + g3083;
+  g601 = g3942 + g3393;
+  g602 = g3696 + g380;
+  g603 = g4423 + g3423;
+  g604 = g3203 + g1643;
+  g605 = g1942 + g1737;
+  g606 = g4095 + g2442;
+  g607 = g326 + g4;
+  g608 = g1433 + g3101;
+  g609 = g494 + g503;
+  return g600;
+}
+
+long u61() {
+  g610 = g2149 + g4825;
+  g611 = g1516 + g1594;
+  g612 = g4293 + g4117;
+  g613 = g516 + g4809;
+  g614 = g1501 + g1721;
+  g615 = g3007 + g4388;
+  g616 = g374 + g1712;
+  g617 = g2756 + g637;
+  g618 = g1048 + g1457;
+  g619 = g1888 + g3606;
+  return g610;
+}
+
+long u62() {
+  g620 = g1460 + g650;
+  g621 = g2307 + g4840;
+  g622 = g3708 + g3195;
+  g623 = g16 + g643;
+  g624 = g820 + g262;
+  g625 = g772 + g2545;
+  g626 = g4494 + g441;
+  g627 = g3540 + g3901;
+  g628 = g3526 + g2707;
+  g629 = g3487 + g647;
+  return g620;
+}
+
+long u63() {
+  g630 = g2778 + g1181;
+  g631 = g2216 + g3298;
+  g632 = g3954 + g1257;
+  g633 = g2690 + g2414;
+  g634 = g3703 + g958;
+  g635 = g8 + g346;
+  g636 = g131 + g2817;
+  g637 = g4432 + g2692;
+  g638 = g1952 + g1423;
+  g639 = g3192 + g4340;
+  return g630;
+}
+
+long u64() {
+  g640 = g4967 + g80;
+  g641 = g1122 + g2237;
+  g642 = g3149 + g2999;
+  g643 = g3177 + g113;
+  g644 = g3624 + g3758;
+  g645 = g94 + g4071;
+  g646 = g830 + g987;
+  g647 = g1502 + g580;
+  g648 = g4607 + g3937;
+  g649 = g2600 + g2947;
+  return g640;
+}
+
+long u65() {
+  g650 = g4584 + g2980;
+  g651 = g2561 + g3693;
+  g652 = g959 + g583;
+  g653 = g3383 + g4012;
+  g654 = g1211 + g1082;
+  g655 = g4683 + g3700;
+  g656 = g2868 + g4433;
+  g657 = g451 + g29;
+  g658 = g3403 + g635;
+  g659 = g579 + g3677;
+  return g650;
+}
+
+long u66() {
+  g660 = g3772 + g3715;
+  g661 = g2731 + g4823;
+  g662 = g4693 + g4615;
+  g663 = g443 + g1088;
+  g664 = g3020 + g322;
+  g665 = g4362 + g2830;
+  g666 = g107 + g2799;
+  g667 = g4366 + g4627;
+  g668 = g2602 + g1477;
+  g669 = g1324 + g1027;
+  return g660;
+}
+
+long u67() {
+  g670 = g2444 + g1697;
+  g671 = g2904 + g4565;
+  g672 = g3028 + g457;
+  g673 = g2713 + g4089;
+  g674 = g936 + g710;
+  g675 = g3088 + g4958;
+  g676 = g1834 + g1593;
+  g677 = g1694 + g2895;
+  g678 = g176 + g2080;
+  g679 = g1370 + g4360;
+  return g670;
+}
+
+long u68() {
+  g680 = g990 + g870;
+  g681 = g1752 + g2354;
+  g682 = g1505 + g1551;
+  g683 = g3149 + g4882;
+  g684 = g567 + g1467;
+  g685 = g3794 + g4411;
+  g686 = g294 + g2907;
+  g687 = g3230 + g4867;
+  g688 = g1744 + g1436;
+  g689 = g4228 + g2167;
+  return g680;
+}
+
+long u69() {
+  g690 = g1185 + g3640;
+  g691 = g1193 + g2894;
+  g692 = g3125 + g4759;
+  g693 = g4903 + g1623;
+  g694 = g1455 + g3331;
+  g695 = g2323 + g1164;
+  g696 = g3607 + g2707;
+  g697 = g1048 + g3159;
+  g698 = g4179 + g3546;
+  g699 = g4349 + g4012;
+  return g690;
+}
+
+long u70() {
+  g700 = g1237 + g2165;
+  g701 = g4780 + g88;
+  g702 = g570 + g438;
+  g703 = g788 + g3627;
+  g704 = g1909 + g262;
+  g705 = g4848 + g2399;
+  g706 = g483 + g597;
+  g707 = g1222 + g3993;
+  g708 = g4638 + g2002;
+  g709 = g3492 + g2690;
+  return g700;
+}
+
+long u71() {
+  g710 = g4124 + g1610;
+  g711 = g4392 + g1258;
+  g712 = g4176 + g3211;
+  g713 = g234 + g4786;
+  g714 = g3760 + g1989;
+  g715 = g1520 + g2587;
+  g716 = g4324 + g43;
+  g717 = g1819 + g4386;
+  g718 = g4913 + g309;
+  g719 = g3264 + g2719;
+  return g710;
+}
+
+long u72() {
+  g720 = g1022 + g3200;
+  g721 = g1965 + g784;
+  g722 = g973 + g2770;
+  g723 = g586 + g773;
+  g724 = g4938 + g34;
+  g725 = g325 + g3374;
+  g726 = g4450 + g592;
+  g727 = g4860 + g376;
+  g728 = g2272 + g242;
+  g729 = g3594 + g1765;
+  return g720;
+}
+
+long u73() {
+  g730 = g4411 + g492;
+  g731 = g294 + g954;
+  g732 = g2029 + g2457;
+  g733 = g4942 + g4838;
+  g734 = g206 + g1950;
+  g735 = g38 + g3372;
+  g736 = g2563 + g4730;
+  g737 = g2476 + g1413;
+  g738 = g511 + g812;
+  g739 = g1282 + g3530;
+  return g730;
+}
+
+long u74() {
+  g740 = g2728 + g4306;
+  g741 = g3484 + g3031;
+  g742 = g4903 + g926;
+  g743 = g4867 + g4166;
+  g744 = g4896 + g3053;
+  g745 = g1936 + g4209;
+  g746 = g1355 + g4931;
+  g747 = g4469 + g4510;
+  g748 = g2730 + g314;
+  g749 = g4933 + g3931;
+  return g740;
+}
+
+long u75() {
+  g750 = g4448 + g2189;
+  g751 = g4102 + g2277;
+  g752 = g3468 + g2333;
+  g753 = g3643 + g3356;
+  g754 = g4050 + g3831;
+  g755 = g1994 + g163;
+  g756 = g3853 + g4567;
+  g757 = g4060 + g4340;
+  g758 = g55 + g1834;
+  g759 = g192 + g1139;
+  return g750;
+}
+
+long u76() {
+  g760 = g3785 + g2195;
+  g761 = g2299 + g3511;
+  g762 = g4071 + g4610;
+  g763 = g2905 + g4587;
+  g764 = g2984 + g4205;
+  g765 = g3595 + g4040;
+  g766 = g4376 + g4025;
+  g767 = g2744 + g4857;
+  g768 = g3993 + g3407;
+  g769 = g602 + g887;
+  return g760;
+}
+
+long u77() {
+  g770 = g3653 + g3731;
+  g771 = g2640 + g4702;
+  g772 = g2546 + g2316;
+  g773 = g3805 + g782;
+  g774 = g4487 + g841;
+  g775 = g2045 + g2466;
+  g776 = g1073 + g3359;
+  g777 = g3642 + g4472;
+  g778 = g893 + g4097;
+  g779 = g1630 + g4055;
+  return g770;
+}
+
+long u78() {
+  g780 = g1545 + g579;
+  g781 = g97 + g4282;
+  g782 = g1603 + g2772;
+  g783 = g4910 + g2217;
+  g784 = g289 + g2881;
+  g785 = g1452 + g726;
+  g786 = g1521 + g3946;
+  g787 = g4826 + g2210;
+  g788 = g4415 + g4506;
+  g789 = g3109 + g2626;
+  return g780;
+}
+
+long u79() {
+  g790 = g1357 + g4604;
+  g791 = g352 + g611;
+  g792 = g453 + g4466;
+  g793 = g1115 + g3104;
+  g794 = g1291 + g3516;
+  g795 = g4967 + g3416;
+  g796 = g544 + g246;
+  g797 = g4138 + g2017;
+  g798 = g880 + g3124;
+  g799 = g3168 + g2549;
+  return g790;
+}
+
+long u80() {
+  g800 = g4136 + g3816;
+  g801 = g2235 + g4173;
+  g802 = g4063 + g4964;
+  g803 = g411 + g3616;
+  g804 = g2945 + g2973;
+  g805 = g965 + g960;
+  g806 = g4643 + g1729;
+  g807 = g199 + g4527;
+  g808 = g916 + g4317;
+  g809 = g2427 + g1484;
+  return g800;
+}
+
+long u81() {
+  g810 = g55 + g1772;
+  g811 = g2469 + g2144;
+  g812 = g930 + g959;
+  g813 = g117 + g968;
+  g814 = g3494 + g1114;
+  g815 = g2226 + g1293;
+  g816 = g4042 + g465;
+  g817 = g679 + g4281;
+  g818 = g1813 + g2468;
+  g819 = g1019 + g100;
+  return g810;
+}
+
+long u82() {
+  g820 = g2928 + g4283;
+  g821 = g4840 + g3840;
+  g822 = g1023 + g4781;
+  g823 = g1373 + g2617;
+  g824 = g2991 + g4031;
+  g825 = g4773 + g136;
+  g826 = g4151 + g296;
+  g827 = g3613 + g2228;
+  g828 = g3064 + g3021;
+  g829 = g4142 + g1092;
+  return g820;
+}
+
+long u83() {
+  g830 = g1818 + g3287;
+  g831 = g2198 + g3468;
+  g832 = g353 + g1214;
+  g833 = g4692 + g2081;
+  g834 = g2387 + g4564;
+  g835 = g1693 + g3697;
+  g836 = g2397 + g1415;
+  g837 = g846 + g3861;
+  g838 = g1268 + g4310;
+  g839 = g680 + g3831;
+  return g830;
+}
+
+long u84() {
+  g840 = g1406 + g1784;
+  g841 = g1916 + g368;
+  g842 = g1845 + g3341;
+  g843 = g2774 + g79;
+  g844 = g2476 + g145;
+  g845 = g4898 + g2092;
+  g846 = g2167 + g1729;
+  g847 = g4868 + g1937;
+  g848 = g4995 + g754;
+  g849 = g1100 + g937;
+  return g840;
+}
+
+long u85() {
+  g850 = g2029 + g4852;
+  g851 = g3842 + g2355;
+  g852 = g585 + g1068;
+  g853 = g2337 + g4989;
+  g854 = g424 + g2128;
+  g855 = g2692 + g3585;
+  g856 = g1584 + g4718;
+  g857 = g722 + g3626;
+  g858 = g3284 + g2193;
+  g859 = g40 + g2843;
+  return g850;
+}
+
+long u86() {
+  g860 = g4816 + g3385;
+  g861 = g1456 + g92;
+  g862 = g2457 + g2465;
+  g863 = g2535 + g670;
+  g864 = g4845 + g1721;
+  g865 = g870 + g1859;
+  g866 = g1670 + g3141;
+  g867 = g229 + g801;
+  g868 = g4578 + g2598;
+  g869 = g1021 + g3045;
+  return g860;
+}
+
+long u87() {
+  g870 = g2933 + g378;
+  g871 = g4885 + g4782;
+  g872 = g2638 + g4226;
+  g873 = g3978 + g2888;
+  g874 = g3805 + g111;
+  g875 = g3987 + g1613;
+  g876 = g4313 + g4336;
+  g877 = g4630 + g694;
+  g878 = g1421 + g4811;
+  g879 = g2558 + g3362;
+  return g870;
+}
+
+long u88() {
+  g880 = g4082 + g4385;
+  g881 = g3963 + g3522;
+  g882 = g4655 + g769;
+  g883 = g2351 + g85;
+  g884 = g1339 + g3662;
+  g885 = g1665 + g1923;
+  g886 = g728 + g2088;
+  g887 = g2107 + g2496;
+  g888 = g1161 + g3990;
+  g889 = g3728 + g2774;
+  return g880;
+}
+
+long u89() {
+  g890 = g3060 + g1415;
+  g891 = g435 + g4861;
+  g892 = g4885 + g2984;
+  g893 = g2628 + g2254;
+  g894 = g340 + g4461;
+  g895 = g3942 + g1107;
+  g896 = g2030 + g2512;
+  g897 = g4002 + g1504;
+  g898 = g424 + g1909;
+  g899 = g2603 + g3502;
+  return g890;
+}
+
+long u90() {
+  g900 = g4745 + g3234;
+  g901 = g1614 + g3480;
+  g902 = g1802 + g76;
+  g903 = g1323 + g2986;
+  g904 = g2335 + g2482;
+  g905 = g1023 + g6;
+  g906 = g126 + g3347;
+  g907 = g2893 + g27;
+  g908 = g2448 + g28;
+  g909 = g4860 + g3748;
+  return g900;
+}
+
+long u91() {
+  g910 = g4792 + g3487;
+  g911 = g3069 + g4902;
+  g912 = g4459 + g3983;
+  g913 = g517 + g3903;
+  g914 = g3835 + g4848;
+  g915 = g500 + g4999;
+  g916 = g3555 + g3061;
+  g917 = g1428 + g3570;
+  g918 = g4243 + g2857;
+  g919 = g2166 + g2014;
+  return g910;
+}
+
+long u92() {
+  g920 = g781 + g4879;
+  g921 = g1584 + g2048;
+  g922 = g1524 + g3207;
+  g923 = g63 + g2834;
+  g924 = g1654 + g2910;
+  g925 = g1580 + g4196;
+  g926 = g4073 + g3227;
+  g927 = g3062 + g319;
+  g928 = g1506 + g315;
+  g929 = g1079 + g2046;
+  return g920;
+}
+
+long u93() {
+  g930 = g4987 + g4956;
+  g931 = g3020 + g4322;
+  g932 = g2652 + g4926;
+  g933 = g4751 + g64;
+  g934 = g1377 + g4521;
+  g935 = g4005 + g4509;
+  g936 = g3906 + g1807;
+  g937 = g543 + g329;
+  g938 = g465 + g3854;
+  g939 = g258 + g1990;
+  return g930;
+}
+
+long u94() {
+  g940 = g3184 + g3402;
+  g941 = g3532 + g4935;
+  g942 = g3924 + g3798;
+  g943 = g2968 + g77;
+  g944 = g290 + g3359;
+  g945 = g1570 + g3662;
+  g946 = g1141 + g1090;
+  g947 = g4750 + g4514;
+  g948 = g626 + g738;
+  g949 = g1028 + g1099;
+  return g940;
+}
+
+long u95() {
+  g950 = g2620 + g16;
+  g951 = g599 + g2076;
+  g952 = g2429 + g1872;
+  g953 = g802 + g4287;
+  g954 = g3432 + g4069;
+  g955 = g4357 + g1911;
+  g956 = g3399 + g2871;
+  g957 = g3973 + g2739;
+  g958 = g2755 + g2243;
+  g959 = g1896 + g4591;
+  return g950;
+}
+
+long u96() {
+  g960 = g2234 + g1174;
+  g961 = g2889 + g4866;
+  g962 = g178 + g4448;
+  g963 = g3500 + g4536;
+  g964 = g2866 + g1631;
+  g965 = g1861 + g1013;
+  g966 = g1593 + g2844;
+  g967 = g973 + g3146;
+  g968 = g1855 + g4649;
+  g969 = g4560 + g2747;
+  return g960;
+}
+
+long u97() {
+  g970 = g208 + g2900;
+  g971 = g1393 + g932;
+  g972 = g4047 + g1833;
+  g973 = g3003 + g3142;
+  g974 = g1978 + g1290;
+  g975 = g2618 + g1665;
+  g976 = g2411 + g1754;
+  g977 = g3158 + g680;
+  g978 = g1728 + g4979;
+  g979 = g3548 + g577;
+  return g970;
+}
+
+long u98() {
+  g980 = g4094 + g1081;
+  g981 = g1024 + g854;
+  g982 = g4427 + g4158;
+  g983 = g3327 + g1823;
+  g984 = g4351 + g2512;
+  g985 = g1727 + g2313;
+  g986 = g2864 + g982;
+  g987 = g645 + g4384;
+  g988 = g4541 + g670;
+  g989 = g418 + g2798;
+  return g980;
+}
+
+long u99() {
+  g990 = g4603 + g1838;
+  g991 = g4139 + g4442;
+  g992 = g2021 + g2391;
+  g993 = g4657 + g4309;
+  g994 = g1402 + g4450;
+  g995 = g3494 + g1201;
+  g996 = g4103 + g2967;
+  g997 = g3017 + g2632;
+  g998 = g3893 + g3899;
+  g999 = g1738 + g2573;
+  return g990;
+}
+
+long u100() {
+  g1000 = g327 + g1493;
+  g1001 = g1223 + g1936;
+  g1002 = g111 + g3499;
+  g1003 = g3772 + g4221;
+  g1004 = g142 + g2349;
+  g1005 = g4600 + g377;
+  g1006 = g2059 + g4815;
+  g1007 = g863 + g2911;
+  g1008 = g496 + g1793;
+  g1009 = g3395 + g2876;
+  return g1000;
+}
+
+long u101() {
+  g1010 = g225 + g82;
+  g1011 = g1512 + g1017;
+  g1012 = g478 + g2767;
+  g1013 = g2490 + g3717;
+  g1014 = g1759 + g1552;
+  g1015 = g4062 + g677;
+  g1016 = g1446 + g1962;
+  g1017 = g417 + g1021;
+  g1018 = g1574 + g3409;
+  g1019 = g363 + g2774;
+  return g1010;
+}
+
+long u102() {
+  g1020 = g1795 + g911;
+  g1021 = g386 + g489;
+  g1022 = g144 + g2828;
+  g1023 = g4606 + g3546;
+  g1024 = g1931 + g1417;
+  g1025 = g4250 + g4066;
+  g1026 = g2392 + g4524;
+  g1027 = g138 + g329;
+  g1028 = g4719 + g4376;
+  g1029 = g2071 + g3946;
+  return g1020;
+}
+
+long u103() {
+  g1030 = g4844 + g1628;
+  g1031 = g2789 + g3453;
+  g1032 = g521 + g1167;
+  g1033 = g2251 + g1445;
+  g1034 = g4181 + g1291;
+  g1035 = g4097 + g2485;
+  g1036 = g2353 + g1018;
+  g1037 = g4209 + g3697;
+  g1038 = g1444 + g3802;
+  g1039 = g4313 + g4966;
+  return g1030;
+}
+
+long u104() {
+  g1040 = g1861 + g4091;
+  g1041 = g2163 + g3980;
+  g1042 = g1752 + g1028;
+  g1043 = g4615 + g273;
+  g1044 = g2183 + g1271;
+  g1045 = g3163 + g3200;
+  g1046 = g626 + g0;
+  g1047 = g1801 + g1806;
+  g1048 = g1136 + g2516;
+  g1049 = g2723 + g3912;
+  return g1040;
+}
+
+long u105() {
+  g1050 = g3259 + g4918;
+  g1051 = g3989 + g2632;
+  g1052 = g768 + g3729;
+  g1053 = g3273 + g4745;
+  g1054 = g2356 + g1276;
+  g1055 = g1406 + g4299;
+  g1056 = g313 + g248;
+  g1057 = g2817 + g786;
+  g1058 = g2909 + g1834;
+  g1059 = g403 + g2237;
+  return g1050;
+}
+
+long u106() {
+  g1060 = g4998 + g611;
+  g1061 = g3899 + g2077;
+  g1062 = g2495 + g3182;
+  g1063 = g3362 + g2676;
+  g1064 = g3246 + g3540;
+  g1065 = g4049 + g935;
+  g1066 = g3120 + g716;
+  g1067 = g2152 + g415;
+  g1068 = g1967 + g4387;
+  g1069 = g4369 + g701;
+  return g1060;
+}
+
+long u107() {
+  g1070 = g3022 + g1288;
+  g1071 = g2519 + g1693;
+  g1072 = g916 + g750;
+  g1073 = g2564 + g1462;
+  g1074 = g2358 + g42;
+  g1075 = g3832 + g4852;
+  g1076 = g2673 + g2333;
+  g1077 = g2606 + g4305;
+  g1078 = g1207 + g4976;
+  g1079 = g2878 + g1299;
+  return g1070;
+}
+
+long u108() {
+  g1080 = g4621 + g353;
+  g1081 = g4743 + g4337;
+  g1082 = g276 + g2213;
+  g1083 = g2644 + g4670;
+  g1084 = g2452 + g4967;
+  g1085 = g3823 + g25;
+  g1086 = g2602 + g4142;
+  g1087 = g910 + g3794;
+  g1088 = g2359 + g3941;
+  g1089 = g2568 + g1545;
+  return g1080;
+}
+
+long u109() {
+  g1090 = g2403 + g4471;
+  g1091 = g172 + g71;
+  g1092 = g17 + g778;
+  g1093 = g4585 + g3416;
+  g1094 = g161 + g3865;
+  g1095 = g4381 + g4333;
+  g1096 = g4165 + g4701;
+  g1097 = g1010 + g3448;
+  g1098 = g1458 + g2687;
+  g1099 = g393 + g460;
+  return g1090;
+}
+
+long u110() {
+  g1100 = g3724 + g2666;
+  g1101 = g3438 + g974;
+  g1102 = g1155 + g3632;
+  g1103 = g3376 + g249;
+  g1104 = g1359 + g1705;
+  g1105 = g4753 + g2101;
+  g1106 = g1900 + g1131;
+  g1107 = g2564 + g3122;
+  g1108 = g4046 + g4473;
+  g1109 = g3716 + g4313;
+  return g1100;
+}
+
+long u111() {
+  g1110 = g1539 + g1499;
+  g1111 = g4336 + g1483;
+  g1112 = g652 + g4292;
+  g1113 = g970 + g3054;
+  g1114 = g4383 + g4584;
+  g1115 = g843 + g537;
+  g1116 = g3213 + g958;
+  g1117 = g593 + g510;
+  g1118 = g1674 + g4659;
+  g1119 = g4832 + g288;
+  return g1110;
+}
+
+long u112() {
+  g1120 = g1289 + g2426;
+  g1121 = g2070 + g2760;
+  g1122 = g2260 + g1833;
+  g1123 = g4045 + g4089;
+  g1124 = g304 + g242;
+  g1125 = g4318 + g3311;
+  g1126 = g3939 + g4001;
+  g1127 = g4305 + g1590;
+  g1128 = g3347 + g4678;
+  g1129 = g2941 + g161;
+  return g1120;
+}
+
+long u113() {
+  g1130 = g2917 + g2911;
+  g1131 = g84 + g1906;
+  g1132 = g863 + g600;
+  g1133 = g1315 + g3900;
+  g1134 = g2745 + g4666;
+  g1135 = g2515 + g4719;
+  g1136 = g1544 + g1895;
+  g1137 = g1168 + g2944;
+  g1138 = g1710 + g242;
+  g1139 = g1978 + g4500;
+  return g1130;
+}
+
+long u114() {
+  g1140 = g2686 + g4094;
+  g1141 = g163 + g3546;
+  g1142 = g3940 + g2605;
+  g1143 = g3465 + g1218;
+  g1144 = g4347 + g1085;
+  g1145 = g175 + g3375;
+  g1146 = g3507 + g4859;
+  g1147 = g4401 + g1693;
+  g1148 = g619 + g4134;
+  g1149 = g266 + g4109;
+  return g1140;
+}
+
+long u115() {
+  g1150 = g2431 + g2646;
+  g1151 = g3173 + g4102;
+  g1152 = g3783 + g3071;
+  g1153 = g4207 + g3467;
+  g1154 = g4885 + g365;
+  g1155 = g3240 + g2232;
+  g1156 = g4025 + g1915;
+  g1157 = g105 + g3954;
+  g1158 = g1157 + g3350;
+  g1159 = g2673 + g3965;
+  return g1150;
+}
+
+long u116() {
+  g1160 = g2696 + g2831;
+  g1161 = g2083 + g1514;
+  g1162 = g2606 + g2120;
+  g1163 = g1606 + g3183;
+  g1164 = g2474 + g654;
+  g1165 = g3561 + g4352;
+  g1166 = g4164 + g2718;
+  g1167 = g2178 + g3044;
+  g1168 = g320 + g1134;
+  g1169 = g54 + g4154;
+  return g1160;
+}
+
+long u117() {
+  g1170 = g532 + g2874;
+  g1171 = g4494 + g1702;
+  g1172 = g2931 + g4427;
+  g1173 = g661 + g3149;
+  g1174 = g4940 + g2084;
+  g1175 = g4522 + g2377;
+  g1176 = g1921 + g4358;
+  g1177 = g3659 + g3146;
+  g1178 = g3361 + g338;
+  g1179 = g1151 + g2066;
+  return g1170;
+}
+
+long u118() {
+  g1180 = g3908 + g261;
+  g1181 = g4126 + g2418;
+  g1182 = g197 + g962;
+  g1183 = g932 + g4337;
+  g1184 = g4460 + g2292;
+  g1185 = g242 + g2908;
+  g1186 = g277 + g3141;
+  g1187 = g3697 + g193;
+  g1188 = g4148 + g4578;
+  g1189 = g1655 + g2323;
+  return g1180;
+}
+
+long u119() {
+  g1190 = g1915 + g2166;
+  g1191 = g1530 + g4397;
+  g1192 = g210 + g4697;
+  g1193 = g1477 + g1995;
+  g1194 = g2697 + g4318;
+  g1195 = g3897 + g2239;
+  g1196 = g596 + g586;
+  g1197 = g3180 + g802;
+  g1198 = g4644 + g2241;
+  g1199 = g3552 + g267;
+  return g1190;
+}
+
+long u120() {
+  g1200 = g2625 + g2688;
+  g1201 = g3651 + g3193;
+  g1202 = g1131 + g2774;
+  g1203 = g2636 + g4878;
+  g1204 = g4916 + g3967;
+  g1205 = g2849 + g1644;
+  g1206 = g2409 + g4301;
+  g1207 = g1738 + g1476;
+  g1208 = g4588 + g4246;
+  g1209 = g3965 + g1254;
+  return g1200;
+}
+
+long u121() {
+  g1210 = g4611 + g1090;
+  g1211 = g4640 + g1733;
+  g1212 = g431 + g2624;
+  g1213 = g3513 + g4881;
+  g1214 = g4731 + g421;
+  g1215 = g4443 + g3518;
+  g1216 = g333 + g1591;
+  g1217 = g2085 + g1224;
+  g1218 = g4893 + g3815;
+  g1219 = g3743 + g198;
+  return g1210;
+}
+
+long u122() {
+  g1220 = g780 + g3652;
+  g1221 = g2617 + g2676;
+  g1222 = g1265 + g2829;
+  g1223 = g1270 + g4314;
+  g1224 = g1223 + g4419;
+  g1225 = g3973 + g776;
+  g1226 = g4967 + g2767;
+  g1227 = g1940 + g1817;
+  g1228 = g2550 + g4853;
+  g1229 = g4302 + g4996;
+  return g1220;
+}
+
+long u123() {
+  g1230 = g4417 + g4083;
+  g1231 = g4735 + g2983;
+  g1232 = g298 + g2911;
+  g1233 = g3292 + g1089;
+  g1234 = g2244 + g2621;
+  g1235 = g1888 + g940;
+  g1236 = g1874 + g1800;
+  g1237 = g3961 + g1705;
+  g1238 = g3323 + g1546;
+  g1239 = g4423 + g40;
+  return g1230;
+}
+
+long u124() {
+  g1240 = g3649 + g3269;
+  g1241 = g1842 + g2842;
+  g1242 = g4767 + g2802;
+  g1243 = g3913 + g2812;
+  g1244 = g2752 + g810;
+  g1245 = g3987 + g4449;
+  g1246 = g2591 + g1851;
+  g1247 = g2728 + g4319;
+  g1248 = g1208 + g3926;
+  g1249 = g1663 + g3135;
+  return g1240;
+}
+
+long u125() {
+  g1250 = g1636 + g2686;
+  g1251 = g3732 + g2610;
+  g1252 = g26 + g541;
+  g1253 = g4500 + g1974;
+  g1254 = g4670 + g3633;
+  g1255 = g1928 + g209;
+  g1256 = g779 + g4700;
+  g1257 = g2102 + g1607;
+  g1258 = g841 + g2171;
+  g1259 = g2284 + g2542;
+  return g1250;
+}
+
+long u126() {
+  g1260 = g1023 + g3322;
+  g1261 = g2747 + g4150;
+  g1262 = g3927 + g1763;
+  g1263 = g944 + g4045;
+  g1264 = g2748 + g3557;
+  g1265 = g1497 + g32;
+  g1266 = g3579 + g2940;
+  g1267 = g3633 + g3329;
+  g1268 = g3650 + g2149;
+  g1269 = g2207 + g3965;
+  return g1260;
+}
+
+long u127() {
+  g1270 = g1954 + g170;
+  g1271 = g4430 + g4931;
+  g1272 = g3077 + g2728;
+  g1273 = g4769 + g1519;
+  g1274 = g1905 + g137;
+  g1275 = g3565 + g3737;
+  g1276 = g1047 + g4745;
+  g1277 = g2936 + g4669;
+  g1278 = g3645 + g2029;
+  g1279 = g2077 + g822;
+  return g1270;
+}
+
+long u128() {
+  g1280 = g4695 + g4662;
+  g1281 = g1210 + g367;
+  g1282 = g992 + g206;
+  g1283 = g884 + g707;
+  g1284 = g17 + g1825;
+  g1285 = g3778 + g2284;
+  g1286 = g432 + g4970;
+  g1287 = g2764 + g4475;
+  g1288 = g460 + g2673;
+  g1289 = g3162 + g2908;
+  return g1280;
+}
+
+long u129() {
+  g1290 = g498 + g1713;
+  g1291 = g3741 + g3652;
+  g1292 = g711 + g463;
+  g1293 = g4951 + g3937;
+  g1294 = g1401 + g4588;
+  g1295 = g823 + g3430;
+  g1296 = g3943 + g1202;
+  g1297 = g4724 + g4067;
+  g1298 = g82 + g2658;
+  g1299 = g144 + g4523;
+  return g1290;
+}
+
+long u130() {
+  g1300 = g1654 + g1017;
+  g1301 = g3950 + g2211;
+  g1302 = g3937 + g1031;
+  g1303 = g626 + g110;
+  g1304 = g4245 + g3085;
+  g1305 = g3682 + g2553;
+  g1306 = g3530 + g3680;
+  g1307 = g4365 + g2676;
+  g1308 = g1221 + g4516;
+  g1309 = g1920 + g714;
+  return g1300;
+}
+
+long u131() {
+  g1310 = g1262 + g2098;
+  g1311 = g2052 + g2304;
+  g1312 = g3791 + g1179;
+  g1313 = g3412 + g3033;
+  g1314 = g3797 + g441;
+  g1315 = g46 + g4574;
+  g1316 = g2703 + g2328;
+  g1317 = g1732 + g2920;
+  g1318 = g3147 + g4808;
+  g1319 = g3950 + g3922;
+  return g1310;
+}
+
+long u132() {
+  g1320 = g2806 + g2487;
+  g1321 = g4407 + g173;
+  g1322 = g3917 + g2075;
+  g1323 = g2738 + g38;
+  g1324 = g716 + g1536;
+  g1325 = g976 + g3566;
+  g1326 = g318 + g2088;
+  g1327 = g147 + g578;
+  g1328 = g1643 + g3589;
+  g1329 = g836 + g4072;
+  return g1320;
+}
+
+long u133() {
+  g1330 = g3689 + g2353;
+  g1331 = g321 + g765;
+  g1332 = g4635 + g1793;
+  g1333 = g808 + g1445;
+  g1334 = g3598 + g3812;
+  g1335 = g573 + g1805;
+  g1336 = g4838 + g2929;
+  g1337 = g1676 + g4066;
+  g1338 = g3147 + g3377;
+  g1339 = g4000 + g237;
+  return g1330;
+}
+
+long u134() {
+  g1340 = g899 + g247;
+  g1341 = g705 + g4751;
+  g1342 = g3688 + g396;
+  g1343 = g1845 + g1819;
+  g1344 = g4259 + g2880;
+  g1345 = g1672 + g1620;
+  g1346 = g1425 + g3181;
+  g1347 = g420 + g2919;
+  g1348 = g1183 + g2341;
+  g1349 = g1108 + g1980;
+  return g1340;
+}
+
+long u135() {
+  g1350 = g2615 + g4861;
+  g1351 = g1342 + g154;
+  g1352 = g4013 + g2250;
+  g1353 = g3831 + g1015;
+  g1354 = g2241 + g1963;
+  g1355 = g1355 + g1199;
+  g1356 = g2788 + g1297;
+  g1357 = g43 + g2759;
+  g1358 = g3972 + g4980;
+  g1359 = g2359 + g3661;
+  return g1350;
+}
+
+long u136() {
+  g1360 = g3118 + g2926;
+  g1361 = g3564 + g4419;
+  g1362 = g4350 + g946;
+  g1363 = g109 + g2092;
+  g1364 = g3000 + g2751;
+  g1365 = g755 + g661;
+  g1366 = g4131 + g2414;
+  g1367 = g223 + g3213;
+  g1368 = g3570 + g1270;
+  g1369 = g1129 + g3497;
+  return g1360;
+}
+
+long u137() {
+  g1370 = g3190 + g4999;
+  g1371 = g3983 + g1600;
+  g1372 = g3897 + g177;
+  g1373 = g3677 + g3888;
+  g1374 = g1328 + g1892;
+  g1375 = g2136 + g1680;
+  g1376 = g2278 + g1296;
+  g1377 = g2048 + g383;
+  g1378 = g1125 + g3721;
+  g1379 = g1082 + g3110;
+  return g1370;
+}
+
+long u138() {
+  g1380 = g3792 + g3887;
+  g1381 = g578 + g515;
+  g1382 = g2348 + g1035;
+  g1383 = g1772 + g298;
+  g1384 = g3934 + g2005;
+  g1385 = g2056 + g1378;
+  g1386 = g1174 + g3021;
+  g1387 = g4361 + g1605;
+  g1388 = g3477 + g874;
+  g1389 = g3023 + g4982;
+  return g1380;
+}
+
+long u139() {
+  g1390 = g1181 + g1003;
+  g1391 = g422 + g3319;
+  g1392 = g3335 + g875;
+  g1393 = g2781 + g2292;
+  g1394 = g2546 + g1975;
+  g1395 = g4323 + g4342;
+  g1396 = g873 + g1894;
+  g1397 = g3217 + g2294;
+  g1398 = g251 + g937;
+  g1399 = g3504 + g2414;
+  return g1390;
+}
+
+long u140() {
+  g1400 = g1063 + g2183;
+  g1401 = g513 + g2110;
+  g1402 = g608 + g438;
+  g1403 = g2044 + g3712;
+  g1404 = g1766 + g2627;
+  g1405 = g4027 + g4844;
+  g1406 = g3030 + g3255;
+  g1407 = g3363 + g67;
+  g1408 = g2219 + g4923;
+  g1409 = g2597 + g2802;
+  return g1400;
+}
+
+long u141() {
+  g1410 = g1514 + g4203;
+  g1411 = g3775 + g4837;
+  g1412 = g2082 + g440;
+  g1413 = g603 + g2023;
+  g1414 = g2557 + g1246;
+  g1415 = g4070 + g3946;
+  g1416 = g1283 + g1675;
+  g1417 = g2631 + g1160;
+  g1418 = g2173 + g206;
+  g1419 = g1570 + g3591;
+  return g1410;
+}
+
+long u142() {
+  g1420 = g4783 + g1918;
+  g1421 = g538 + g314;
+  g1422 = g3515 + g4957;
+  g1423 = g3017 + g142;
+  g1424 = g604 + g4263;
+  g1425 = g795 + g2799;
+  g1426 = g3681 + g6;
+  g1427 = g256 + g2387;
+  g1428 = g1783 + g1605;
+  g1429 = g1505 + g523;
+  return g1420;
+}
+
+long u143() {
+  g1430 = g3621 + g2237;
+  g1431 = g1589 + g3866;
+  g1432 = g440 + g3479;
+  g1433 = g2287 + g3007;
+  g1434 = g151 + g1412;
+  g1435 = g1421 + g2743;
+  g1436 = g2796 + g83;
+  g1437 = g797 + g3622;
+  g1438 = g2956 + g4593;
+  g1439 = g1017 + g3904;
+  return g1430;
+}
+
+long u144() {
+  g1440 = g3458 + g1267;
+  g1441 = g3659 + g1710;
+  g1442 = g4436 + g3765;
+  g1443 = g1956 + g3679;
+  g1444 = g348 + g44;
+  g1445 = g4441 + g4634;
+  g1446 = g4540 + g3571;
+  g1447 = g354 + g3117;
+  g1448 = g4097 + g3540;
+  g1449 = g3347 + g4338;
+  return g1440;
+}
+
+long u145() {
+  g1450 = g1591 + g1971;
+  g1451 = g1236 + g1514;
+  g1452 = g100 + g1309;
+  g1453 = g2653 + g1576;
+  g1454 = g43 + g3231;
+  g1455 = g1503 + g981;
+  g1456 = g324 + g4568;
+  g1457 = g1784 + g3763;
+  g1458 = g3494 + g251;
+  g1459 = g3899 + g1599;
+  return g1450;
+}
+
+long u146() {
+  g1460 = g1420 + g4974;
+  g1461 = g2375 + g861;
+  g1462 = g3213 + g1479;
+  g1463 = g4482 + g203;
+  g1464 = g510 + g3357;
+  g1465 = g1972 + g1415;
+  g1466 = g1067 + g2037;
+  g1467 = g876 + g2772;
+  g1468 = g383 + g1000;
+  g1469 = g1820 + g1446;
+  return g1460;
+}
+
+long u147() {
+  g1470 = g214 + g3176;
+  g1471 = g4206 + g3664;
+  g1472 = g1040 + g2823;
+  g1473 = g4462 + g4281;
+  g1474 = g1896 + g1144;
+  g1475 = g2886 + g4529;
+  g1476 = g509 + g3890;
+  g1477 = g3257 + g2520;
+  g1478 = g4809 + g4800;
+  g1479 = g4626 + g2256;
+  return g1470;
+}
+
+long u148() {
+  g1480 = g2736 + g3409;
+  g1481 = g1619 + g2285;
+  g1482 = g3467 + g387;
+  g1483 = g3985 + g2127;
+  g1484 = g4723 + g1127;
+  g1485 = g223 + g2951;
+  g1486 = g4379 + g3324;
+  g1487 = g4143 + g4224;
+  g1488 = g3645 + g3360;
+  g1489 = g2345 + g1781;
+  return g1480;
+}
+
+long u149() {
+  g1490 = g4838 + g275;
+  g1491 = g430 + g3894;
+  g1492 = g1951 + g784;
+  g1493 = g3012 + g4233;
+  g1494 = g414 + g938;
+  g1495 = g723 + g1544;
+  g1496 = g4237 + g450;
+  g1497 = g1630 + g1819;
+  g1498 = g4204 + g4259;
+  g1499 = g2730 + g4628;
+  return g1490;
+}
+
+long u150() {
+  g1500 = g832 + g3446;
+  g1501 = g1476 + g961;
+  g1502 = g3471 + g122;
+  g1503 = g4116 + g1514;
+  g1504 = g1028 + g1014;
+  g1505 = g450 + g3621;
+  g1506 = g1229 + g830;
+  g1507 = g322 + g2158;
+  g1508 = g4948 + g2118;
+  g1509 = g3327 + g2211;
+  return g1500;
+}
+
+long u151() {
+  g1510 = g2945 + g1196;
+  g1511 = g4355 + g3098;
+  g1512 = g685 + g1585;
+  g1513 = g3094 + g4775;
+  g1514 = g4686 + g71;
+  g1515 = g4013 + g2720;
+  g1516 = g3694 + g4537;
+  g1517 = g3154 + g1851;
+  g1518 = g1434 + g4771;
+  g1519 = g1358 + g2143;
+  return g1510;
+}
+
+long u152() {
+  g1520 = g2154 + g4410;
+  g1521 = g2922 + g4436;
+  g1522 = g307 + g2896;
+  g1523 = g4476 + g4751;
+  g1524 = g2075 + g2202;
+  g1525 = g165 + g56;
+  g1526 = g4344 + g3925;
+  g1527 = g3968 + g3266;
+  g1528 = g935 + g3429;
+  g1529 = g2518 + g2838;
+  return g1520;
+}
+
+long u153() {
+  g1530 = g2054 + g1774;
+  g1531 = g1069 + g1322;
+  g1532 = g2132 + g2602;
+  g1533 = g4887 + g4989;
+  g1534 = g3198 + g952;
+  g1535 = g3682 + g2724;
+  g1536 = g3959 + g1925;
+  g1537 = g3700 + g2192;
+  g1538 = g3787 + g980;
+  g1539 = g83 + g12;
+  return g1530;
+}
+
+long u154() {
+  g1540 = g2784 + g310;
+  g1541 = g34 + g558;
+  g1542 = g4992 + g112;
+  g1543 = g2155 + g2579;
+  g1544 = g2528 + g4204;
+  g1545 = g2556 + g4342;
+  g1546 = g1528 + g2591;
+  g1547 = g1568 + g2682;
+  g1548 = g2021 + g1027;
+  g1549 = g2309 + g740;
+  return g1540;
+}
+
+long u155() {
+  g1550 = g2377 + g3145;
+  g1551 = g3991 + g136;
+  g1552 = g2522 + g2415;
+  g1553 = g4905 + g1678;
+  g1554 = g4468 + g800;
+  g1555 = g2140 + g1412;
+  g1556 = g197 + g2456;
+  g1557 = g3146 + g1734;
+  g1558 = g920 + g263;
+  g1559 = g467 + g1962;
+  return g1550;
+}
+
+long u156() {
+  g1560 = g3486 + g4165;
+  g1561 = g4658 + g4054;
+  g1562 = g3126 + g3135;
+  g1563 = g3279 + g3929;
+  g1564 = g1290 + g4006;
+  g1565 = g4986 + g2584;
+  g1566 = g4483 + g2691;
+  g1567 = g2600 + g730;
+  g1568 = g419 + g4801;
+  g1569 = g2769 + g526;
+  return g1560;
+}
+
+long u157() {
+  g1570 = g3604 + g3134;
+  g1571 = g972 + g4755;
+  g1572 = g2804 + g275;
+  g1573 = g4957 + g3197;
+  g1574 = g1836 + g2853;
+  g1575 = g4931 + g4504;
+  g1576 = g2132 + g1671;
+  g1577 = g1343 + g1633;
+  g1578 = g1138 + g573;
+  g1579 = g2978 + g1875;
+  return g1570;
+}
+
+long u158() {
+  g1580 = g2937 + g4664;
+  g1581 = g2022 + g3654;
+  g1582 = g1900 + g3198;
+  g1583 = g2469 + g4280;
+  g1584 = g3736 + g48;
+  g1585 = g3236 + g1466;
+  g1586 = g4077 + g3709;
+  g1587 = g768 + g1544;
+  g1588 = g1744 + g24;
+  g1589 = g2122 + g366;
+  return g1580;
+}
+
+long u159() {
+  g1590 = g793 + g4199;
+  g1591 = g1498 + g4804;
+  g1592 = g722 + g2445;
+  g1593 = g3303 + g3462;
+  g1594 = g1897 + g978;
+  g1595 = g4153 + g4824;
+  g1596 = g1966 + g311;
+  g1597 = g3456 + g1;
+  g1598 = g1264 + g1597;
+  g1599 = g2299 + g3421;
+  return g1590;
+}
+
+long u160() {
+  g1600 = g3952 + g1680;
+  g1601 = g1576 + g1916;
+  g1602 = g3275 + g1899;
+  g1603 = g2988 + g1607;
+  g1604 = g3074 + g3937;
+  g1605 = g2993 + g587;
+  g1606 = g3516 + g204;
+  g1607 = g234 + g1037;
+  g1608 = g3185 + g503;
+  g1609 = g687 + g4134;
+  return g1600;
+}
+
+long u161() {
+  g1610 = g760 + g1350;
+  g1611 = g297 + g1278;
+  g1612 = g1750 + g3350;
+  g1613 = g4331 + g3667;
+  g1614 = g2293 + g1939;
+  g1615 = g528 + g3011;
+  g1616 = g4993 + g4452;
+  g1617 = g1537 + g1253;
+  g1618 = g4138 + g1251;
+  g1619 = g3098 + g4279;
+  return g1610;
+}
+
+long u162() {
+  g1620 = g3328 + g3181;
+  g1621 = g889 + g4876;
+  g1622 = g4493 + g3767;
+  g1623 = g2018 + g4655;
+  g1624 = g2269 + g492;
+  g1625 = g3610 + g3748;
+  g1626 = g1343 + g1466;
+  g1627 = g1362 + g3558;
+  g1628 = g4511 + g4980;
+  g1629 = g4615 + g3030;
+  return g1620;
+}
+
+long u163() {
+  g1630 = g3896 + g1153;
+  g1631 = g1559 + g3941;
+  g1632 = g3526 + g811;
+  g1633 = g2240 + g2156;
+  g1634 = g486 + g4570;
+  g1635 = g1604 + g3473;
+  g1636 = g738 + g4520;
+  g1637 = g4379 + g4739;
+  g1638 = g3021 + g3252;
+  g1639 = g227 + g1842;
+  return g1630;
+}
+
+long u164() {
+  g1640 = g584 + g2535;
+  g1641 = g1622 + g2453;
+  g1642 = g4029 + g2950;
+  g1643 = g3899 + g1234;
+  g1644 = g4799 + g3486;
+  g1645 = g1300 + g4205;
+  g1646 = g2438 + g747;
+  g1647 = g4167 + g513;
+  g1648 = g3040 + g2371;
+  g1649 = g2375 + g88;
+  return g1640;
+}
+
+long u165() {
+  g1650 = g3368 + g4837;
+  g1651 = g778 + g4738;
+  g1652 = g3502 + g3387;
+  g1653 = g3069 + g1586;
+  g1654 = g3210 + g2121;
+  g1655 = g1296 + g268;
+  g1656 = g1464 + g3725;
+  g1657 = g1553 + g3826;
+  g1658 = g442 + g2476;
+  g1659 = g2105 + g853;
+  return g1650;
+}
+
+long u166() {
+  g1660 = g4960 + g4288;
+  g1661 = g3587 + g2277;
+  g1662 = g4888 + g4205;
+  g1663 = g3815 + g3505;
+  g1664 = g2987 + g150;
+  g1665 = g1263 + g4823;
+  g1666 = g452 + g3380;
+  g1667 = g3744 + g1699;
+  g1668 = g805 + g4186;
+  g1669 = g1334 + g4457;
+  return g1660;
+}
+
+long u167() {
+  g1670 = g2335 + g2439;
+  g1671 = g4178 + g4832;
+  g1672 = g3418 + g2196;
+  g1673 = g4039 + g4043;
+  g1674 = g1416 + g4234;
+  g1675 = g1257 + g145;
+  g1676 = g3680 + g3221;
+  g1677 = g3618 + g4190;
+  g1678 = g4907 + g3336;
+  g1679 = g3338 + g4185;
+  return g1670;
+}
+
+long u168() {
+  g1680 = g2625 + g1730;
+  g1681 = g2718 + g672;
+  g1682 = g817 + g184;
+  g1683 = g1105 + g3186;
+  g1684 = g992 + g2835;
+  g1685 = g1004 + g4765;
+  g1686 = g3620 + g2631;
+  g1687 = g1831 + g1284;
+  g1688 = g3171 + g1490;
+  g1689 = g2453 + g1209;
+  return g1680;
+}
+
+long u169() {
+  g1690 = g1829 + g1984;
+  g1691 = g3473 + g537;
+  g1692 = g2576 + g4089;
+  g1693 = g3845 + g228;
+  g1694 = g4253 + g1364;
+  g1695 = g685 + g1340;
+  g1696 = g2624 + g2554;
+  g1697 = g4487 + g3509;
+  g1698 = g1157 + g9;
+  g1699 = g3646 + g3116;
+  return g1690;
+}
+
+long u170() {
+  g1700 = g709 + g3332;
+  g1701 = g4247 + g1856;
+  g1702 = g2360 + g3540;
+  g1703 = g3305 + g1156;
+  g1704 = g1607 + g55;
+  g1705 = g998 + g1049;
+  g1706 = g3921 + g2858;
+  g1707 = g3960 + g2774;
+  g1708 = g3809 + g2146;
+  g1709 = g2194 + g1721;
+  return g1700;
+}
+
+long u171() {
+  g1710 = g4367 + g3734;
+  g1711 = g4404 + g1808;
+  g1712 = g2975 + g1094;
+  g1713 = g2798 + g1886;
+  g1714 = g3588 + g2483;
+  g1715 = g3394 + g4212;
+  g1716 = g4125 + g3688;
+  g1717 = g4156 + g1232;
+  g1718 = g4580 + g3208;
+  g1719 = g2399 + g3942;
+  return g1710;
+}
+
+long u172() {
+  g1720 = g1645 + g3461;
+  g1721 = g3587 + g2786;
+  g1722 = g844 + g1571;
+  g1723 = g1136 + g4954;
+  g1724 = g3776 + g4264;
+  g1725 = g3633 + g1332;
+  g1726 = g2490 + g2088;
+  g1727 = g1608 + g1369;
+  g1728 = g4131 + g1200;
+  g1729 = g1048 + g1600;
+  return g1720;
+}
+
+long u173() {
+  g1730 = g2538 + g926;
+  g1731 = g1600 + g3711;
+  g1732 = g3151 + g1456;
+  g1733 = g4370 + g1572;
+  g1734 = g2359 + g161;
+  g1735 = g3962 + g2634;
+  g1736 = g4854 + g3698;
+  g1737 = g1766 + g3435;
+  g1738 = g2705 + g3604;
+  g1739 = g1246 + g685;
+  return g1730;
+}
+
+long u174() {
+  g1740 = g253 + g679;
+  g1741 = g3042 + g682;
+  g1742 = g684 + g1842;
+  g1743 = g3384 + g26;
+  g1744 = g1596 + g1773;
+  g1745 = g4857 + g1614;
+  g1746 = g4388 + g3483;
+  g1747 = g797 + g100;
+  g1748 = g2552 + g3160;
+  g1749 = g989 + g1024;
+  return g1740;
+}
+
+long u175() {
+  g1750 = g1330 + g4264;
+  g1751 = g121 + g215;
+  g1752 = g1143 + g4688;
+  g1753 = g1269 + g3853;
+  g1754 = g1902 + g4711;
+  g1755 = g2989 + g3197;
+  g1756 = g1574 + g2248;
+  g1757 = g1841 + g4530;
+  g1758 = g391 + g2486;
+  g1759 = g550 + g4705;
+  return g1750;
+}
+
+long u176() {
+  g1760 = g2403 + g4351;
+  g1761 = g2931 + g4025;
+  g1762 = g3585 + g1636;
+  g1763 = g1641 + g2465;
+  g1764 = g4917 + g922;
+  g1765 = g2742 + g3193;
+  g1766 = g4524 + g2193;
+  g1767 = g2522 + g4212;
+  g1768 = g4423 + g2846;
+  g1769 = g4220 + g2547;
+  return g1760;
+}
+
+long u177() {
+  g1770 = g3300 + g971;
+  g1771 = g45 + g4168;
+  g1772 = g3061 + g3010;
+  g1773 = g3824 + g42;
+  g1774 = g4288 + g2148;
+  g1775 = g4834 + g928;
+  g1776 = g555 + g679;
+  g1777 = g1553 + g4353;
+  g1778 = g4599 + g1762;
+  g1779 = g3225 + g4003;
+  return g1770;
+}
+
+long u178() {
+  g1780 = g4914 + g1381;
+  g1781 = g3207 + g4159;
+  g1782 = g3052 + g4638;
+  g1783 = g1371 + g3001;
+  g1784 = g3542 + g2618;
+  g1785 = g1611 + g3021;
+  g1786 = g2538 + g1845;
+  g1787 = g4492 + g4008;
+  g1788 = g2484 + g1730;
+  g1789 = g59 + g237;
+  return g1780;
+}
+
+long u179() {
+  g1790 = g4183 + g2698;
+  g1791 = g2990 + g3729;
+  g1792 = g2685 + g366;
+  g1793 = g291 + g297;
+  g1794 = g870 + g1042;
+  g1795 = g335 + g2618;
+  g1796 = g1381 + g1056;
+  g1797 = g864 + g1907;
+  g1798 = g759 + g2593;
+  g1799 = g4905 + g4571;
+  return g1790;
+}
+
+long u180() {
+  g1800 = g4697 + g2529;
+  g1801 = g4732 + g1574;
+  g1802 = g118 + g784;
+  g1803 = g4713 + g5;
+  g1804 = g4020 + g1781;
+  g1805 = g2728 + g1798;
+  g1806 = g4320 + g4170;
+  g1807 = g2648 + g4891;
+  g1808 = g4013 + g690;
+  g1809 = g695 + g126;
+  return g1800;
+}
+
+long u181() {
+  g1810 = g4755 + g2130;
+  g1811 = g1059 + g4443;
+  g1812 = g3750 + g3419;
+  g1813 = g3562 + g2074;
+  g1814 = g43 + g234;
+  g1815 = g3914 + g423;
+  g1816 = g3987 + g4698;
+  g1817 = g1239 + g354;
+  g1818 = g4651 + g3983;
+  g1819 = g1570 + g3670;
+  return g1810;
+}
+
+long u182() {
+  g1820 = g3599 + g1496;
+  g1821 = g4970 + g3429;
+  g1822 = g3656 + g3098;
+  g1823 = g267 + g832;
+  g1824 = g3455 + g2811;
+  g1825 = g2145 + g4689;
+  g1826 = g1335 + g957;
+  g1827 = g1300 + g2506;
+  g1828 = g4744 + g4917;
+  g1829 = g4832 + g2430;
+  return g1820;
+}
+
+long u183() {
+  g1830 = g4095 + g3768;
+  g1831 = g1065 + g4955;
+  g1832 = g3618 + g2820;
+  g1833 = g1933 + g3822;
+  g1834 = g637 + g471;
+  g1835 = g1664 + g3964;
+  g1836 = g3208 + g2770;
+  g1837 = g2293 + g1168;
+  g1838 = g3932 + g3263;
+  g1839 = g4492 + g2751;
+  return g1830;
+}
+
+long u184() {
+  g1840 = g100 + g1933;
+  g1841 = g2918 + g878;
+  g1842 = g1574 + g500;
+  g1843 = g3465 + g993;
+  g1844 = g281 + g713;
+  g1845 = g3216 + g3014;
+  g1846 = g895 + g4621;
+  g1847 = g3555 + g1103;
+  g1848 = g1732 + g4944;
+  g1849 = g1715 + g4678;
+  return g1840;
+}
+
+long u185() {
+  g1850 = g3891 + g4907;
+  g1851 = g1806 + g278;
+  g1852 = g4158 + g3286;
+  g1853 = g173 + g3129;
+  g1854 = g3432 + g2910;
+  g1855 = g120 + g2349;
+  g1856 = g1486 + g4332;
+  g1857 = g10 + g907;
+  g1858 = g1030 + g3796;
+  g1859 = g635 + g4645;
+  return g1850;
+}
+
+long u186() {
+  g1860 = g97 + g1630;
+  g1861 = g2156 + g4103;
+  g1862 = g261 + g4485;
+  g1863 = g424 + g2691;
+  g1864 = g792 + g179;
+  g1865 = g3885 + g1016;
+  g1866 = g4258 + g3501;
+  g1867 = g4860 + g2560;
+  g1868 = g1140 + g3905;
+  g1869 = g4707 + g4523;
+  return g1860;
+}
+
+long u187() {
+  g1870 = g3334 + g1353;
+  g1871 = g2537 + g3113;
+  g1872 = g145 + g2458;
+  g1873 = g1186 + g2558;
+  g1874 = g2164 + g2836;
+  g1875 = g3100 + g3705;
+  g1876 = g3016 + g3356;
+  g1877 = g4642 + g1358;
+  g1878 = g1247 + g1960;
+  g1879 = g2735 + g302;
+  return g1870;
+}
+
+long u188() {
+  g1880 = g2389 + g3672;
+  g1881 = g3984 + g2474;
+  g1882 = g1119 + g1733;
+  g1883 = g1627 + g4665;
+  g1884 = g3311 + g2894;
+  g1885 = g2601 + g1384;
+  g1886 = g2975 + g2574;
+  g1887 = g581 + g198;
+  g1888 = g2896 + g3293;
+  g1889 = g2376 + g3521;
+  return g1880;
+}
+
+long u189() {
+  g1890 = g3894 + g177;
+  g1891 = g4202 + g2431;
+  g1892 = g1225 + g4811;
+  g1893 = g4391 + g3785;
+  g1894 = g3131 + g969;
+  g1895 = g2550 + g170;
+  g1896 = g530 + g92;
+  g1897 = g1603 + g4622;
+  g1898 = g3911 + g4181;
+  g1899 = g2008 + g4402;
+  return g1890;
+}
+
+long u190() {
+  g1900 = g3573 + g3557;
+  g1901 = g2518 + g2107;
+  g1902 = g4473 + g3487;
+  g1903 = g2157 + g3586;
+  g1904 = g4229 + g2576;
+  g1905 = g431 + g95;
+  g1906 = g2421 + g4552;
+  g1907 = g3527 + g927;
+  g1908 = g1238 + g3144;
+  g1909 = g1812 + g1752;
+  return g1900;
+}
+
+long u191() {
+  g1910 = g4582 + g904;
+  g1911 = g1609 + g1304;
+  g1912 = g4246 + g4551;
+  g1913 = g204 + g2336;
+  g1914 = g597 + g1010;
+  g1915 = g1207 + g754;
+  g1916 = g4386 + g2092;
+  g1917 = g3245 + g1826;
+  g1918 = g144 + g827;
+  g1919 = g4890 + g3541;
+  return g1910;
+}
+
+long u192() {
+  g1920 = g1977 + g528;
+  g1921 = g1849 + g2763;
+  g1922 = g56 + g4515;
+  g1923 = g1585 + g3074;
+  g1924 = g3940 + g4912;
+  g1925 = g3790 + g2338;
+  g1926 = g4224 + g1278;
+  g1927 = g764 + g3837;
+  g1928 = g1373 + g987;
+  g1929 = g3551 + g4637;
+  return g1920;
+}
+
+long u193() {
+  g1930 = g2773 + g2993;
+  g1931 = g4410 + g1275;
+  g1932 = g1198 + g2498;
+  g1933 = g2267 + g1228;
+  g1934 = g184 + g1026;
+  g1935 = g2675 + g492;
+  g1936 = g608 + g4103;
+  g1937 = g602 + g4601;
+  g1938 = g2224 + g389;
+  g1939 = g1864 + g819;
+  return g1930;
+}
+
+long u194() {
+  g1940 = g2134 + g3767;
+  g1941 = g472 + g1567;
+  g1942 = g902 + g3128;
+  g1943 = g3679 + g3592;
+  g1944 = g2875 + g2280;
+  g1945 = g3369 + g722;
+  g1946 = g4302 + g4107;
+  g1947 = g137 + g1110;
+  g1948 = g2312 + g3238;
+  g1949 = g3496 + g2318;
+  return g1940;
+}
+
+long u195() {
+  g1950 = g2053 + g1825;
+  g1951 = g607 + g1723;
+  g1952 = g198 + g4489;
+  g1953 = g3065 + g3829;
+  g1954 = g532 + g1918;
+  g1955 = g2606 + g2669;
+  g1956 = g1096 + g4179;
+  g1957 = g3262 + g4494;
+  g1958 = g4629 + g2366;
+  g1959 = g3177 + g3463;
+  return g1950;
+}
+
+long u196() {
+  g1960 = g4317 + g644;
+  g1961 = g304 + g408;
+  g1962 = g3715 + g4102;
+  g1963 = g1173 + g2985;
+  g1964 = g2156 + g4841;
+  g1965 = g3039 + g2049;
+  g1966 = g3524 + g3929;
+  g1967 = g3221 + g3322;
+  g1968 = g2090 + g1164;
+  g1969 = g1105 + g348;
+  return g1960;
+}
+
+long u197() {
+  g1970 = g3290 + g3802;
+  g1971 = g2649 + g3747;
+  g1972 = g1070 + g1501;
+  g1973 = g1266 + g2656;
+  g1974 = g2044 + g4143;
+  g1975 = g1464 + g2012;
+  g1976 = g2730 + g2816;
+  g1977 = g3397 + g1019;
+  g1978 = g1428 + g3031;
+  g1979 = g2419 + g389;
+  return g1970;
+}
+
+long u198() {
+  g1980 = g811 + g4911;
+  g1981 = g1739 + g1036;
+  g1982 = g4885 + g2914;
+  g1983 = g791 + g3841;
+  g1984 = g64 + g2058;
+  g1985 = g3399 + g4096;
+  g1986 = g3104 + g3565;
+  g1987 = g3037 + g3199;
+  g1988 = g1210 + g3607;
+  g1989 = g615 + g4193;
+  return g1980;
+}
+
+long u199() {
+  g1990 = g3278 + g478;
+  g1991 = g3219 + g383;
+  g1992 = g408 + g4088;
+  g1993 = g2473 + g541;
+  g1994 = g1862 + g4775;
+  g1995 = g516 + g4288;
+  g1996 = g895 + g3742;
+  g1997 = g2634 + g374;
+  g1998 = g1114 + g1009;
+  g1999 = g4378 + g3972;
+  return g1990;
+}
+
+long u200() {
+  g2000 = g4554 + g1278;
+  g2001 = g96 + g4454;
+  g2002 = g3299 + g1344;
+  g2003 = g1724 + g3757;
+  g2004 = g1117 + g3114;
+  g2005 = g3853 + g3825;
+  g2006 = g4157 + g4697;
+  g2007 = g4625 + g3826;
+  g2008 = g2182 + g3575;
+  g2009 = g2980 + g2659;
+  return g2000;
+}
+
+long u201() {
+  g2010 = g2248 + g3224;
+  g2011 = g3483 + g223;
+  g2012 = g348 + g1291;
+  g2013 = g3340 + g1236;
+  g2014 = g1749 + g4277;
+  g2015 = g638 + g1378;
+  g2016 = g2806 + g1746;
+  g2017 = g4384 + g1894;
+  g2018 = g1341 + g981;
+  g2019 = g471 + g3899;
+  return g2010;
+}
+
+long u202() {
+  g2020 = g3120 + g3089;
+  g2021 = g341 + g3370;
+  g2022 = g1058 + g4746;
+  g2023 = g2078 + g1927;
+  g2024 = g2674 + g3298;
+  g2025 = g4241 + g325;
+  g2026 = g2151 + g564;
+  g2027 = g61 + g852;
+  g2028 = g2325 + g3727;
+  g2029 = g4096 + g431;
+  return g2020;
+}
+
+long u203() {
+  g2030 = g1983 + g1467;
+  g2031 = g338 + g1001;
+  g2032 = g2648 + g3055;
+  g2033 = g336 + g1195;
+  g2034 = g4406 + g1544;
+  g2035 = g2015 + g2579;
+  g2036 = g1025 + g623;
+  g2037 = g2137 + g3685;
+  g2038 = g1012 + g2121;
+  g2039 = g3909 + g2343;
+  return g2030;
+}
+
+long u204() {
+  g2040 = g2508 + g3998;
+  g2041 = g3020 + g3734;
+  g2042 = g3874 + g4129;
+  g2043 = g4472 + g3722;
+  g2044 = g4921 + g1946;
+  g2045 = g495 + g4118;
+  g2046 = g22 + g2742;
+  g2047 = g4128 + g3148;
+  g2048 = g4880 + g426;
+  g2049 = g107 + g594;
+  return g2040;
+}
+
+long u205() {
+  g2050 = g2157 + g3485;
+  g2051 = g568 + g243;
+  g2052 = g3299 + g1503;
+  g2053 = g4817 + g1852;
+  g2054 = g21 + g3507;
+  g2055 = g3428 + g921;
+  g2056 = g4366 + g3057;
+  g2057 = g3932 + g2863;
+  g2058 = g2208 + g4163;
+  g2059 = g4696 + g4788;
+  return g2050;
+}
+
+long u206() {
+  g2060 = g1180 + g2821;
+  g2061 = g3499 + g1855;
+  g2062 = g371 + g2614;
+  g2063 = g4882 + g3085;
+  g2064 = g491 + g1315;
+  g2065 = g3375 + g2591;
+  g2066 = g1668 + g1012;
+  g2067 = g604 + g1743;
+  g2068 = g3745 + g1051;
+  g2069 = g1385 + g4323;
+  return g2060;
+}
+
+long u207() {
+  g2070 = g1167 + g381;
+  g2071 = g991 + g2629;
+  g2072 = g2759 + g575;
+  g2073 = g1564 + g2285;
+  g2074 = g1582 + g3997;
+  g2075 = g3333 + g1288;
+  g2076 = g3469 + g497;
+  g2077 = g3643 + g386;
+  g2078 = g1130 + g3069;
+  g2079 = g1955 + g2799;
+  return g2070;
+}
+
+long u208() {
+  g2080 = g603 + g2657;
+  g2081 = g3273 + g4678;
+  g2082 = g1228 + g362;
+  g2083 = g2261 + g2640;
+  g2084 = g4938 + g1126;
+  g2085 = g2970 + g1180;
+  g2086 = g2825 + g1629;
+  g2087 = g3727 + g4874;
+  g2088 = g2193 + g774;
+  g2089 = g2404 + g2917;
+  return g2080;
+}
+
+long u209() {
+  g2090 = g3699 + g2397;
+  g2091 = g4107 + g2039;
+  g2092 = g3898 + g4767;
+  g2093 = g2306 + g1500;
+  g2094 = g3117 + g1605;
+  g2095 = g1663 + g77;
+  g2096 = g1537 + g4414;
+  g2097 = g4109 + g3231;
+  g2098 = g3939 + g4624;
+  g2099 = g1062 + g3887;
+  return g2090;
+}
+
+long u210() {
+  g2100 = g2737 + g62;
+  g2101 = g4733 + g776;
+  g2102 = g2212 + g2049;
+  g2103 = g4919 + g4675;
+  g2104 = g2436 + g3672;
+  g2105 = g4627 + g324;
+  g2106 = g2110 + g2385;
+  g2107 = g4902 + g885;
+  g2108 = g3070 + g2645;
+  g2109 = g998 + g1457;
+  return g2100;
+}
+
+long u211() {
+  g2110 = g1965 + g1386;
+  g2111 = g4601 + g2124;
+  g2112 = g2847 + g1525;
+  g2113 = g3105 + g3523;
+  g2114 = g2000 + g4701;
+  g2115 = g2360 + g39;
+  g2116 = g1270 + g3563;
+  g2117 = g3881 + g4257;
+  g2118 = g3463 + g2787;
+  g2119 = g1784 + g2962;
+  return g2110;
+}
+
+long u212() {
+  g2120 = g4142 + g352;
+  g2121 = g877 + g2183;
+  g2122 = g4991 + g418;
+  g2123 = g1202 + g3594;
+  g2124 = g653 + g4436;
+  g2125 = g3254 + g4482;
+  g2126 = g2602 + g1978;
+  g2127 = g4059 + g902;
+  g2128 = g369 + g2872;
+  g2129 = g3235 + g2087;
+  return g2120;
+}
+
+long u213() {
+  g2130 = g2265 + g3393;
+  g2131 = g3761 + g1074;
+  g2132 = g2288 + g4988;
+  g2133 = g3425 + g4240;
+  g2134 = g1102 + g3334;
+  g2135 = g3710 + g1217;
+  g2136 = g60 + g3592;
+  g2137 = g64 + g2996;
+  g2138 = g2802 + g2812;
+  g2139 = g2979 + g847;
+  return g2130;
+}
+
+long u214() {
+  g2140 = g1300 + g1329;
+  g2141 = g119 + g850;
+  g2142 = g1507 + g1695;
+  g2143 = g1575 + g4015;
+  g2144 = g1064 + g3116;
+  g2145 = g1525 + g983;
+  g2146 = g2944 + g4400;
+  g2147 = g4810 + g1046;
+  g2148 = g3837 + g4777;
+  g2149 = g4271 + g312;
+  return g2140;
+}
+
+long u215() {
+  g2150 = g1501 + g1373;
+  g2151 = g2293 + g4283;
+  g2152 = g3886 + g3805;
+  g2153 = g4754 + g4245;
+  g2154 = g761 + g864;
+  g2155 = g623 + g1113;
+  g2156 = g2649 + g2207;
+  g2157 = g863 + g3268;
+  g2158 = g3883 + g2346;
+  g2159 = g136 + g1658;
+  return g2150;
+}
+
+long u216() {
+  g2160 = g1167 + g1355;
+  g2161 = g506 + g1275;
+  g2162 = g4878 + g2228;
+  g2163 = g3072 + g3147;
+  g2164 = g4690 + g532;
+  g2165 = g3761 + g3545;
+  g2166 = g3741 + g3811;
+  g2167 = g1985 + g4690;
+  g2168 = g707 + g556;
+  g2169 = g4828 + g2410;
+  return g2160;
+}
+
+long u217() {
+  g2170 = g4007 + g3140;
+  g2171 = g1239 + g3861;
+  g2172 = g3892 + g3856;
+  g2173 = g445 + g3006;
+  g2174 = g3949 + g1702;
+  g2175 = g2922 + g2551;
+  g2176 = g1903 + g3313;
+  g2177 = g1701 + g465;
+  g2178 = g2788 + g733;
+  g2179 = g2291 + g4534;
+  return g2170;
+}
+
+long u218() {
+  g2180 = g3895 + g931;
+  g2181 = g1447 + g2173;
+  g2182 = g3805 + g751;
+  g2183 = g4532 + g4751;
+  g2184 = g4838 + g1313;
+  g2185 = g3745 + g4225;
+  g2186 = g529 + g630;
+  g2187 = g3365 + g4131;
+  g2188 = g3323 + g1702;
+  g2189 = g3274 + g3063;
+  return g2180;
+}
+
+long u219() {
+  g2190 = g1409 + g2568;
+  g2191 = g93 + g3596;
+  g2192 = g4089 + g2607;
+  g2193 = g1523 + g2410;
+  g2194 = g4052 + g848;
+  g2195 = g3261 + g4819;
+  g2196 = g1644 + g1768;
+  g2197 = g4617 + g722;
+  g2198 = g3440 + g1931;
+  g2199 = g3540 + g187;
+  return g2190;
+}
+
+long u220() {
+  g2200 = g1467 + g4897;
+  g2201 = g4280 + g2125;
+  g2202 = g4625 + g1913;
+  g2203 = g3733 + g4324;
+  g2204 = g2975 + g3179;
+  g2205 = g4162 + g4589;
+  g2206 = g3297 + g4891;
+  g2207 = g733 + g1155;
+  g2208 = g1052 + g3320;
+  g2209 = g4812 + g447;
+  return g2200;
+}
+
+long u221() {
+  g2210 = g4928 + g1159;
+  g2211 = g4651 + g1762;
+  g2212 = g3000 + g1210;
+  g2213 = g4241 + g399;
+  g2214 = g1992 + g2364;
+  g2215 = g3297 + g4157;
+  g2216 = g606 + g3754;
+  g2217 = g1270 + g2771;
+  g2218 = g2762 + g1341;
+  g2219 = g3107 + g593;
+  return g2210;
+}
+
+long u222() {
+  g2220 = g3751 + g356;
+  g2221 = g1854 + g2913;
+  g2222 = g1984 + g3996;
+  g2223 = g34 + g650;
+  g2224 = g2605 + g4914;
+  g2225 = g1586 + g4487;
+  g2226 = g3686 + g2814;
+  g2227 = g1949 + g290;
+  g2228 = g4977 + g1037;
+  g2229 = g4004 + g1462;
+  return g2220;
+}
+
+long u223() {
+  g2230 = g3370 + g2070;
+  g2231 = g2516 + g4514;
+  g2232 = g1349 + g3836;
+  g2233 = g972 + g2308;
+  g2234 = g2599 + g4350;
+  g2235 = g3950 + g4796;
+  g2236 = g3041 + g3510;
+  g2237 = g869 + g3010;
+  g2238 = g2179 + g1514;
+  g2239 = g987 + g1926;
+  return g2230;
+}
+
+long u224() {
+  g2240 = g4641 + g4548;
+  g2241 = g1068 + g986;
+  g2242 = g4727 + g2075;
+  g2243 = g316 + g2726;
+  g2244 = g4152 + g3176;
+  g2245 = g355 + g1051;
+  g2246 = g3694 + g1762;
+  g2247 = g2238 + g2701;
+  g2248 = g2449 + g2514;
+  g2249 = g1911 + g1244;
+  return g2240;
+}
+
+long u225() {
+  g2250 = g3327 + g2711;
+  g2251 = g4409 + g104;
+  g2252 = g2474 + g4036;
+  g2253 = g1305 + g1918;
+  g2254 = g3347 + g277;
+  g2255 = g4372 + g4091;
+  g2256 = g3079 + g835;
+  g2257 = g1817 + g4561;
+  g2258 = g4993 + g2231;
+  g2259 = g4906 + g3855;
+  return g2250;
+}
+
+long u226() {
+  g2260 = g3967 + g1812;
+  g2261 = g4402 + g4237;
+  g2262 = g4724 + g2250;
+  g2263 = g2514 + g1656;
+  g2264 = g3860 + g798;
+  g2265 = g1389 + g3479;
+  g2266 = g4786 + g1427;
+  g2267 = g3771 + g2623;
+  g2268 = g3641 + g4101;
+  g2269 = g3361 + g4731;
+  return g2260;
+}
+
+long u227() {
+  g2270 = g2998 + g2522;
+  g2271 = g571 + g2412;
+  g2272 = g3334 + g2975;
+  g2273 = g898 + g1358;
+  g2274 = g4502 + g422;
+  g2275 = g2140 + g1257;
+  g2276 = g4060 + g3794;
+  g2277 = g2150 + g4160;
+  g2278 = g1210 + g4118;
+  g2279 = g3244 + g4816;
+  return g2270;
+}
+
+long u228() {
+  g2280 = g1895 + g3805;
+  g2281 = g4675 + g3495;
+  g2282 = g3013 + g623;
+  g2283 = g2362 + g4547;
+  g2284 = g2398 + g1486;
+  g2285 = g1757 + g3978;
+  g2286 = g1068 + g371;
+  g2287 = g2126 + g2552;
+  g2288 = g1635 + g2471;
+  g2289 = g1971 + g2242;
+  return g2280;
+}
+
+long u229() {
+  g2290 = g2331 + g4789;
+  g2291 = g4062 + g3756;
+  g2292 = g3608 + g3488;
+  g2293 = g2271 + g2565;
+  g2294 = g1589 + g2530;
+  g2295 = g390 + g209;
+  g2296 = g168 + g3851;
+  g2297 = g276 + g852;
+  g2298 = g4939 + g1374;
+  g2299 = g3121 + g1412;
+  return g2290;
+}
+
+long u230() {
+  g2300 = g764 + g2034;
+  g2301 = g1270 + g1283;
+  g2302 = g1264 + g1184;
+  g2303 = g1358 + g2460;
+  g2304 = g2123 + g3433;
+  g2305 = g2152 + g966;
+  g2306 = g918 + g73;
+  g2307 = g1452 + g981;
+  g2308 = g266 + g539;
+  g2309 = g856 + g4475;
+  return g2300;
+}
+
+long u231() {
+  g2310 = g3141 + g105;
+  g2311 = g4396 + g1019;
+  g2312 = g659 + g1403;
+  g2313 = g3337 + g2210;
+  g2314 = g659 + g2161;
+  g2315 = g4453 + g2700;
+  g2316 = g464 + g4869;
+  g2317 = g801 + g1875;
+  g2318 = g2360 + g880;
+  g2319 = g4900 + g1572;
+  return g2310;
+}
+
+long u232() {
+  g2320 = g3557 + g419;
+  g2321 = g494 + g4354;
+  g2322 = g3101 + g2067;
+  g2323 = g2598 + g4173;
+  g2324 = g1743 + g2536;
+  g2325 = g4419 + g4795;
+  g2326 = g4986 + g1381;
+  g2327 = g3449 + g601;
+  g2328 = g1850 + g2915;
+  g2329 = g4492 + g3860;
+  return g2320;
+}
+
+long u233() {
+  g2330 = g4726 + g4355;
+  g2331 = g3352 + g4319;
+  g2332 = g3783 + g186;
+  g2333 = g81 + g731;
+  g2334 = g2686 + g2871;
+  g2335 = g169 + g1254;
+  g2336 = g3352 + g67;
+  g2337 = g1187 + g46;
+  g2338 = g448 + g4794;
+  g2339 = g487 + g2252;
+  return g2330;
+}
+
+long u234() {
+  g2340 = g3637 + g2110;
+  g2341 = g4564 + g3627;
+  g2342 = g4961 + g1905;
+  g2343 = g4788 + g1875;
+  g2344 = g3003 + g4566;
+  g2345 = g2240 + g3833;
+  g2346 = g3146 + g2068;
+  g2347 = g505 + g2475;
+  g2348 = g1441 + g3999;
+  g2349 = g4030 + g3095;
+  return g2340;
+}
+
+long u235() {
+  g2350 = g1355 + g1839;
+  g2351 = g4830 + g4055;
+  g2352 = g600 + g1338;
+  g2353 = g469 + g2718;
+  g2354 = g3960 + g4223;
+  g2355 = g4468 + g1297;
+  g2356 = g127 + g3781;
+  g2357 = g2755 + g3837;
+  g2358 = g4982 + g4856;
+  g2359 = g79 + g1919;
+  return g2350;
+}
+
+long u236() {
+  g2360 = g4307 + g3366;
+  g2361 = g2179 + g3204;
+  g2362 = g4423 + g4344;
+  g2363 = g2505 + g802;
+  g2364 = g4469 + g3980;
+  g2365 = g1125 + g4619;
+  g2366 = g1492 + g2774;
+  g2367 = g1976 + g3742;
+  g2368 = g1572 + g2276;
+  g2369 = g4562 + g4408;
+  return g2360;
+}
+
+long u237() {
+  g2370 = g4461 + g2027;
+  g2371 = g2842 + g4292;
+  g2372 = g4891 + g3810;
+  g2373 = g1515 + g1325;
+  g2374 = g2656 + g3562;
+  g2375 = g849 + g3002;
+  g2376 = g4225 + g4982;
+  g2377 = g1458 + g1172;
+  g2378 = g4418 + g1692;
+  g2379 = g59 + g3836;
+  return g2370;
+}
+
+long u238() {
+  g2380 = g2708 + g77;
+  g2381 = g1446 + g1505;
+  g2382 = g2607 + g842;
+  g2383 = g2669 + g4111;
+  g2384 = g2760 + g4319;
+  g2385 = g4143 + g2435;
+  g2386 = g1119 + g1813;
+  g2387 = g1594 + g1847;
+  g2388 = g1859 + g141;
+  g2389 = g2338 + g4082;
+  return g2380;
+}
+
+long u239() {
+  g2390 = g1375 + g239;
+  g2391 = g4934 + g278;
+  g2392 = g3266 + g3309;
+  g2393 = g2739 + g4838;
+  g2394 = g2591 + g1595;
+  g2395 = g3273 + g3591;
+  g2396 = g3941 + g3579;
+  g2397 = g125 + g4573;
+  g2398 = g1 + g657;
+  g2399 = g3231 + g2568;
+  return g2390;
+}
+
+long u240() {
+  g2400 = g814 + g3393;
+  g2401 = g3721 + g3529;
+  g2402 = g4538 + g4901;
+  g2403 = g725 + g4996;
+  g2404 = g3559 + g3787;
+  g2405 = g3703 + g1265;
+  g2406 = g230 + g1852;
+  g2407 = g231 + g793;
+  g2408 = g2237 + g2801;
+  g2409 = g2047 + g198;
+  return g2400;
+}
+
+long u241() {
+  g2410 = g4992 + g3905;
+  g2411 = g4048 + g1094;
+  g2412 = g2515 + g508;
+  g2413 = g1868 + g4945;
+  g2414 = g3242 + g2560;
+  g2415 = g1238 + g758;
+  g2416 = g2639 + g2124;
+  g2417 = g258 + g4102;
+  g2418 = g2321 + g53;
+  g2419 = g77 + g1115;
+  return g2410;
+}
+
+long u242() {
+  g2420 = g882 + g2223;
+  g2421 = g4590 + g4769;
+  g2422 = g4764 + g4191;
+  g2423 = g4823 + g640;
+  g2424 = g1096 + g702;
+  g2425 = g2828 + g424;
+  g2426 = g2244 + g861;
+  g2427 = g3087 + g3125;
+  g2428 = g1401 + g4108;
+  g2429 = g2406 + g386;
+  return g2420;
+}
+
+long u243() {
+  g2430 = g907 + g1786;
+  g2431 = g1623 + g4371;
+  g2432 = g2940 + g4321;
+  g2433 = g839 + g1420;
+  g2434 = g3269 + g4206;
+  g2435 = g4108 + g2703;
+  g2436 = g2863 + g516;
+  g2437 = g243 + g372;
+  g2438 = g4588 + g4382;
+  g2439 = g2545 + g837;
+  return g2430;
+}
+
+long u244() {
+  g2440 = g2733 + g4206;
+  g2441 = g240 + g4272;
+  g2442 = g4577 + g4037;
+  g2443 = g1425 + g1601;
+  g2444 = g2976 + g4042;
+  g2445 = g2497 + g4642;
+  g2446 = g474 + g1550;
+  g2447 = g983 + g4953;
+  g2448 = g375 + g4993;
+  g2449 = g3164 + g104;
+  return g2440;
+}
+
+long u245() {
+  g2450 = g482 + g2670;
+  g2451 = g1862 + g4641;
+  g2452 = g3618 + g2942;
+  g2453 = g2546 + g2392;
+  g2454 = g4648 + g3109;
+  g2455 = g158 + g1531;
+  g2456 = g2698 + g3254;
+  g2457 = g2155 + g2004;
+  g2458 = g4810 + g719;
+  g2459 = g732 + g4800;
+  return g2450;
+}
+
+long u246() {
+  g2460 = g69 + g633;
+  g2461 = g2943 + g3717;
+  g2462 = g614 + g1303;
+  g2463 = g4793 + g841;
+  g2464 = g3669 + g391;
+  g2465 = g2179 + g4246;
+  g2466 = g2965 + g1320;
+  g2467 = g3851 + g4087;
+  g2468 = g4100 + g2152;
+  g2469 = g2451 + g1869;
+  return g2460;
+}
+
+long u247() {
+  g2470 = g2143 + g2115;
+  g2471 = g3767 + g1893;
+  g2472 = g690 + g1842;
+  g2473 = g1657 + g4397;
+  g2474 = g1780 + g490;
+  g2475 = g369 + g4221;
+  g2476 = g1180 + g1153;
+  g2477 = g4643 + g3484;
+  g2478 = g1432 + g1309;
+  g2479 = g3467 + g814;
+  return g2470;
+}
+
+long u248() {
+  g2480 = g4507 + g1807;
+  g2481 = g1134 + g2658;
+  g2482 = g869 + g1835;
+  g2483 = g2151 + g4728;
+  g2484 = g96 + g921;
+  g2485 = g4941 + g2949;
+  g2486 = g619 + g763;
+  g2487 = g603 + g3008;
+  g2488 = g4665 + g4482;
+  g2489 = g3013 + g4543;
+  return g2480;
+}
+
+long u249() {
+  g2490 = g236 + g3555;
+  g2491 = g470 + g2701;
+  g2492 = g44 + g3653;
+  g2493 = g1187 + g1175;
+  g2494 = g4323 + g3708;
+  g2495 = g1531 + g997;
+  g2496 = g1094 + g1168;
+  g2497 = g3140 + g1633;
+  g2498 = g2891 + g2826;
+  g2499 = g2915 + g1595;
+  return g2490;
+}
+
+long u250() {
+  g2500 = g3418 + g2481;
+  g2501 = g3401 + g860;
+  g2502 = g371 + g521;
+  g2503 = g553 + g1098;
+  g2504 = g2912 + g2929;
+  g2505 = g1979 + g4212;
+  g2506 = g4258 + g4497;
+  g2507 = g4780 + g3058;
+  g2508 = g3504 + g2329;
+  g2509 = g2277 + g620;
+  return g2500;
+}
+
+long u251() {
+  g2510 = g4132 + g1586;
+  g2511 = g5 + g126;
+  g2512 = g2613 + g949;
+  g2513 = g1134 + g1559;
+  g2514 = g4817 + g4500;
+  g2515 = g2606 + g24;
+  g2516 = g4081 + g1280;
+  g2517 = g3237 + g3192;
+  g2518 = g1891 + g1671;
+  g2519 = g1187 + g1967;
+  return g2510;
+}
+
+long u252() {
+  g2520 = g2675 + g3111;
+  g2521 = g788 + g1044;
+  g2522 = g1639 + g286;
+  g2523 = g4756 + g4541;
+  g2524 = g3017 + g959;
+  g2525 = g4186 + g857;
+  g2526 = g1288 + g2738;
+  g2527 = g605 + g4364;
+  g2528 = g4301 + g582;
+  g2529 = g2244 + g4892;
+  return g2520;
+}
+
+long u253() {
+  g2530 = g339 + g2995;
+  g2531 = g4823 + g2346;
+  g2532 = g4099 + g2032;
+  g2533 = g4132 + g4318;
+  g2534 = g48 + g4743;
+  g2535 = g1621 + g510;
+  g2536 = g3920 + g504;
+  g2537 = g2979 + g2579;
+  g2538 = g2676 + g1807;
+  g2539 = g2277 + g924;
+  return g2530;
+}
+
+long u254() {
+  g2540 = g1731 + g864;
+  g2541 = g4212 + g1903;
+  g2542 = g253 + g625;
+  g2543 = g2974 + g1729;
+  g2544 = g2164 + g3986;
+  g2545 = g4469 + g1489;
+  g2546 = g2348 + g3869;
+  g2547 = g4899 + g254;
+  g2548 = g2969 + g489;
+  g2549 = g3042 + g1456;
+  return g2540;
+}
+
+long u255() {
+  g2550 = g3445 + g2661;
+  g2551 = g470 + g3758;
+  g2552 = g4653 + g215;
+  g2553 = g3469 + g3816;
+  g2554 = g4978 + g3474;
+  g2555 = g1878 + g3982;
+  g2556 = g1477 + g202;
+  g2557 = g4891 + g110;
+  g2558 = g210 + g4870;
+  g2559 = g3528 + g2110;
+  return g2550;
+}
+
+long u256() {
+  g2560 = g615 + g4212;
+  g2561 = g452 + g1184;
+  g2562 = g3247 + g4258;
+  g2563 = g4339 + g3335;
+  g2564 = g1067 + g1029;
+  g2565 = g2959 + g2780;
+  g2566 = g3358 + g4647;
+  g2567 = g2505 + g4783;
+  g2568 = g1702 + g3888;
+  g2569 = g4180 + g1450;
+  return g2560;
+}
+
+long u257() {
+  g2570 = g1782 + g3105;
+  g2571 = g646 + g4756;
+  g2572 = g1256 + g1036;
+  g2573 = g1796 + g900;
+  g2574 = g4412 + g4276;
+  g2575 = g3949 + g1439;
+  g2576 = g4027 + g370;
+  g2577 = g1406 + g42;
+  g2578 = g4050 + g3147;
+  g2579 = g1041 + g2092;
+  return g2570;
+}
+
+long u258() {
+  g2580 = g4067 + g699;
+  g2581 = g2618 + g2579;
+  g2582 = g4098 + g717;
+  g2583 = g1359 + g2753;
+  g2584 = g1918 + g2302;
+  g2585 = g3179 + g1135;
+  g2586 = g4206 + g2463;
+  g2587 = g4938 + g3527;
+  g2588 = g252 + g1188;
+  g2589 = g2751 + g520;
+  return g2580;
+}
+
+long u259() {
+  g2590 = g3091 + g589;
+  g2591 = g3514 + g1156;
+  g2592 = g3073 + g1705;
+  g2593 = g4484 + g3012;
+  g2594 = g3952 + g2752;
+  g2595 = g2337 + g3316;
+  g2596 = g17 + g510;
+  g2597 = g1219 + g140;
+  g2598 = g4890 + g3056;
+  g2599 = g4551 + g2709;
+  return g2590;
+}
+
+long u260() {
+  g2600 = g4625 + g4724;
+  g2601 = g4508 + g468;
+  g2602 = g3493 + g766;
+  g2603 = g4187 + g4157;
+  g2604 = g2477 + g3298;
+  g2605 = g1215 + g3001;
+  g2606 = g692 + g4527;
+  g2607 = g3032 + g1180;
+  g2608 = g3154 + g1498;
+  g2609 = g2505 + g3966;
+  return g2600;
+}
+
+long u261() {
+  g2610 = g2618 + g348;
+  g2611 = g1900 + g4156;
+  g2612 = g3501 + g41;
+  g2613 = g4327 + g1080;
+  g2614 = g3369 + g2079;
+  g2615 = g593 + g634;
+  g2616 = g3868 + g2107;
+  g2617 = g4549 + g3343;
+  g2618 = g973 + g52;
+  g2619 = g4509 + g3252;
+  return g2610;
+}
+
+long u262() {
+  g2620 = g4558 + g3668;
+  g2621 = g172 + g4201;
+  g2622 = g3147 + g1847;
+  g2623 = g4010 + g2986;
+  g2624 = g2126 + g3391;
+  g2625 = g4127 + g3746;
+  g2626 = g1154 + g4640;
+  g2627 = g4585 + g3699;
+  g2628 = g1321 + g811;
+  g2629 = g3332 + g4453;
+  return g2620;
+}
+
+long u263() {
+  g2630 = g1588 + g3798;
+  g2631 = g3738 + g1135;
+  g2632 = g149 + g676;
+  g2633 = g3207 + g3763;
+  g2634 = g2001 + g2725;
+  g2635 = g2799 + g1508;
+  g2636 = g2754 + g4606;
+  g2637 = g455 + g1620;
+  g2638 = g3730 + g1773;
+  g2639 = g1029 + g1307;
+  return g2630;
+}
+
+long u264() {
+  g2640 = g4784 + g1319;
+  g2641 = g3506 + g1300;
+  g2642 = g1796 + g3965;
+  g2643 = g940 + g1622;
+  g2644 = g768 + g4504;
+  g2645 = g4319 + g1344;
+  g2646 = g3456 + g4397;
+  g2647 = g669 + g1075;
+  g2648 = g4978 + g352;
+  g2649 = g470 + g2970;
+  return g2640;
+}
+
+long u265() {
+  g2650 = g2794 + g3863;
+  g2651 = g2955 + g2831;
+  g2652 = g2349 + g2822;
+  g2653 = g806 + g2044;
+  g2654 = g1110 + g1000;
+  g2655 = g2370 + g3991;
+  g2656 = g2699 + g1300;
+  g2657 = g3191 + g3914;
+  g2658 = g4362 + g1581;
+  g2659 = g4082 + g1329;
+  return g2650;
+}
+
+long u266() {
+  g2660 = g898 + g1752;
+  g2661 = g2539 + g1775;
+  g2662 = g1333 + g620;
+  g2663 = g2803 + g3667;
+  g2664 = g472 + g369;
+  g2665 = g4444 + g27;
+  g2666 = g3027 + g607;
+  g2667 = g3643 + g759;
+  g2668 = g1189 + g988;
+  g2669 = g4455 + g4492;
+  return g2660;
+}
+
+long u267() {
+  g2670 = g2899 + g2759;
+  g2671 = g4567 + g2429;
+  g2672 = g3070 + g786;
+  g2673 = g4371 + g4171;
+  g2674 = g866 + g1176;
+  g2675 = g1949 + g3919;
+  g2676 = g4730 + g1049;
+  g2677 = g471 + g4730;
+  g2678 = g4344 + g1574;
+  g2679 = g3924 + g4768;
+  return g2670;
+}
+
+long u268() {
+  g2680 = g1374 + g1667;
+  g2681 = g2544 + g2311;
+  g2682 = g4355 + g658;
+  g2683 = g2262 + g47;
+  g2684 = g1553 + g1777;
+  g2685 = g2347 + g2794;
+  g2686 = g4640 + g4187;
+  g2687 = g4831 + g3466;
+  g2688 = g4315 + g64;
+  g2689 = g4865 + g1453;
+  return g2680;
+}
+
+long u269() {
+  g2690 = g4167 + g994;
+  g2691 = g1595 + g2995;
+  g2692 = g575 + g1251;
+  g2693 = g949 + g2601;
+  g2694 = g3810 + g553;
+  g2695 = g1649 + g3260;
+  g2696 = g1789 + g3489;
+  g2697 = g4809 + g2101;
+  g2698 = g123 + g108;
+  g2699 = g2533 + g137;
+  return g2690;
+}
+
+long u270() {
+  g2700 = g1366 + g4460;
+  g2701 = g1900 + g1559;
+  g2702 = g1424 + g3697;
+  g2703 = g4807 + g4825;
+  g2704 = g235 + g1694;
+  g2705 = g1721 + g2402;
+  g2706 = g4136 + g348;
+  g2707 = g4475 + g1483;
+  g2708 = g866 + g2386;
+  g2709 = g1886 + g132;
+  return g2700;
+}
+
+long u271() {
+  g2710 = g2754 + g337;
+  g2711 = g1140 + g3959;
+  g2712 = g3499 + g3941;
+  g2713 = g4390 + g3648;
+  g2714 = g2815 + g2073;
+  g2715 = g70 + g3963;
+  g2716 = g3972 + g183;
+  g2717 = g297 + g3823;
+  g2718 = g641 + g40;
+  g2719 = g320 + g4413;
+  return g2710;
+}
+
+long u272() {
+  g2720 = g4946 + g143;
+  g2721 = g377 + g4651;
+  g2722 = g3097 + g1855;
+  g2723 = g2872 + g1628;
+  g2724 = g1950 + g1757;
+  g2725 = g726 + g1403;
+  g2726 = g198 + g3943;
+  g2727 = g283 + g3620;
+  g2728 = g4778 + g4148;
+  g2729 = g2381 + g3982;
+  return g2720;
+}
+
+long u273() {
+  g2730 = g4567 + g2881;
+  g2731 = g2245 + g2843;
+  g2732 = g2210 + g4842;
+  g2733 = g1594 + g1300;
+  g2734 = g1721 + g2214;
+  g2735 = g3302 + g4133;
+  g2736 = g269 + g4132;
+  g2737 = g2479 + g3864;
+  g2738 = g3627 + g1612;
+  g2739 = g414 + g2787;
+  return g2730;
+}
+
+long u274() {
+  g2740 = g532 + g544;
+  g2741 = g3562 + g4863;
+  g2742 = g2212 + g656;
+  g2743 = g675 + g4419;
+  g2744 = g2215 + g4363;
+  g2745 = g619 + g630;
+  g2746 = g519 + g4812;
+  g2747 = g132 + g3454;
+  g2748 = g4740 + g2444;
+  g2749 = g2183 + g1853;
+  return g2740;
+}
+
+long u275() {
+  g2750 = g2312 + g3908;
+  g2751 = g527 + g1438;
+  g2752 = g289 + g2565;
+  g2753 = g2995 + g2255;
+  g2754 = g51 + g3473;
+  g2755 = g108 + g444;
+  g2756 = g810 + g4413;
+  g2757 = g3884 + g645;
+  g2758 = g2834 + g752;
+  g2759 = g1732 + g1684;
+  return g2750;
+}
+
+long u276() {
+  g2760 = g2112 + g2717;
+  g2761 = g2737 + g2071;
+  g2762 = g2603 + g1489;
+  g2763 = g478 + g3765;
+  g2764 = g3136 + g533;
+  g2765 = g3158 + g578;
+  g2766 = g4282 + g2141;
+  g2767 = g557 + g3090;
+  g2768 = g1844 + g2212;
+  g2769 = g2635 + g2716;
+  return g2760;
+}
+
+long u277() {
+  g2770 = g2187 + g443;
+  g2771 = g1617 + g1087;
+  g2772 = g4402 + g3270;
+  g2773 = g2451 + g1235;
+  g2774 = g544 + g4395;
+  g2775 = g2973 + g2725;
+  g2776 = g3307 + g2705;
+  g2777 = g2795 + g4291;
+  g2778 = g1302 + g243;
+  g2779 = g1965 + g3405;
+  return g2770;
+}
+
+long u278() {
+  g2780 = g3115 + g1602;
+  g2781 = g2413 + g4568;
+  g2782 = g919 + g4240;
+  g2783 = g2761 + g1;
+  g2784 = g4605 + g680;
+  g2785 = g2572 + g1424;
+  g2786 = g575 + g2944;
+  g2787 = g4975 + g1963;
+  g2788 = g3879 + g4441;
+  g2789 = g1267 + g4431;
+  return g2780;
+}
+
+long u279() {
+  g2790 = g4675 + g387;
+  g2791 = g3320 + g3736;
+  g2792 = g429 + g1731;
+  g2793 = g2917 + g3924;
+  g2794 = g3136 + g4584;
+  g2795 = g429 + g1043;
+  g2796 = g3965 + g3062;
+  g2797 = g182 + g327;
+  g2798 = g4438 + g3514;
+  g2799 = g520 + g2549;
+  return g2790;
+}
+
+long u280() {
+  g2800 = g982 + g366;
+  g2801 = g2786 + g1020;
+  g2802 = g3807 + g3629;
+  g2803 = g4976 + g2293;
+  g2804 = g1701 + g714;
+  g2805 = g4911 + g1320;
+  g2806 = g4864 + g2766;
+  g2807 = g3556 + g4971;
+  g2808 = g2524 + g4373;
+  g2809 = g1492 + g1221;
+  return g2800;
+}
+
+long u281() {
+  g2810 = g1838 + g2121;
+  g2811 = g4774 + g4046;
+  g2812 = g1254 + g3595;
+  g2813 = g2051 + g1025;
+  g2814 = g2297 + g172;
+  g2815 = g3774 + g200;
+  g2816 = g3238 + g1394;
+  g2817 = g1090 + g657;
+  g2818 = g1181 + g4197;
+  g2819 = g4381 + g118;
+  return g2810;
+}
+
+long u282() {
+  g2820 = g4359 + g1804;
+  g2821 = g3372 + g2568;
+  g2822 = g1165 + g418;
+  g2823 = g1257 + g1565;
+  g2824 = g4091 + g3160;
+  g2825 = g154 + g2209;
+  g2826 = g1324 + g4638;
+  g2827 = g4754 + g3322;
+  g2828 = g4230 + g1834;
+  g2829 = g378 + g747;
+  return g2820;
+}
+
+long u283() {
+  g2830 = g2629 + g2687;
+  g2831 = g3940 + g4827;
+  g2832 = g1752 + g47;
+  g2833 = g243 + g865;
+  g2834 = g1553 + g4793;
+  g2835 = g3739 + g1578;
+  g2836 = g4669 + g2028;
+  g2837 = g4034 + g1686;
+  g2838 = g147 + g139;
+  g2839 = g2001 + g3764;
+  return g2830;
+}
+
+long u284() {
+  g2840 = g924 + g1128;
+  g2841 = g2299 + g4202;
+  g2842 = g3757 + g3822;
+  g2843 = g2769 + g3129;
+  g2844 = g3175 + g670;
+  g2845 = g248 + g4725;
+  g2846 = g3812 + g3755;
+  g2847 = g4374 + g590;
+  g2848 = g4406 + g2292;
+  g2849 = g445 + g2481;
+  return g2840;
+}
+
+long u285() {
+  g2850 = g3537 + g730;
+  g2851 = g3889 + g823;
+  g2852 = g3224 + g3141;
+  g2853 = g530 + g2153;
+  g2854 = g3826 + g4358;
+  g2855 = g632 + g325;
+  g2856 = g4452 + g296;
+  g2857 = g906 + g4472;
+  g2858 = g172 + g2713;
+  g2859 = g2680 + g1428;
+  return g2850;
+}
+
+long u286() {
+  g2860 = g2016 + g3561;
+  g2861 = g110 + g4605;
+  g2862 = g1629 + g4850;
+  g2863 = g2109 + g4459;
+  g2864 = g4936 + g302;
+  g2865 = g525 + g1617;
+  g2866 = g1710 + g1748;
+  g2867 = g3324 + g4536;
+  g2868 = g4909 + g3352;
+  g2869 = g1618 + g3092;
+  return g2860;
+}
+
+long u287() {
+  g2870 = g3540 + g3089;
+  g2871 = g316 + g1569;
+  g2872 = g2718 + g1950;
+  g2873 = g4294 + g2727;
+  g2874 = g3035 + g4441;
+  g2875 = g1763 + g2954;
+  g2876 = g1705 + g1587;
+  g2877 = g2497 + g4735;
+  g2878 = g1454 + g4207;
+  g2879 = g4440 + g2727;
+  return g2870;
+}
+
+long u288() {
+  g2880 = g1926 + g4344;
+  g2881 = g4059 + g397;
+  g2882 = g1150 + g3554;
+  g2883 = g1004 + g1048;
+  g2884 = g360 + g3925;
+  g2885 = g1696 + g98;
+  g2886 = g2985 + g2837;
+  g2887 = g3259 + g2681;
+  g2888 = g162 + g1876;
+  g2889 = g983 + g973;
+  return g2880;
+}
+
+long u289() {
+  g2890 = g3994 + g4323;
+  g2891 = g2884 + g519;
+  g2892 = g936 + g2302;
+  g2893 = g100 + g748;
+  g2894 = g761 + g3112;
+  g2895 = g2372 + g1920;
+  g2896 = g1891 + g879;
+  g2897 = g3342 + g4229;
+  g2898 = g955 + g230;
+  g2899 = g1520 + g4214;
+  return g2890;
+}
+
+long u290() {
+  g2900 = g4635 + g4564;
+  g2901 = g652 + g3083;
+  g2902 = g3029 + g2037;
+  g2903 = g2900 + g454;
+  g2904 = g459 + g2272;
+  g2905 = g3364 + g3537;
+  g2906 = g3257 + g844;
+  g2907 = g3281 + g2005;
+  g2908 = g948 + g3529;
+  g2909 = g4116 + g953;
+  return g2900;
+}
+
+long u291() {
+  g2910 = g559 + g2151;
+  g2911 = g776 + g3250;
+  g2912 = g4345 + g4351;
+  g2913 = g3100 + g4539;
+  g2914 = g1436 + g3258;
+  g2915 = g1816 + g1561;
+  g2916 = g3422 + g193;
+  g2917 = g1293 + g1884;
+  g2918 = g4310 + g4633;
+  g2919 = g553 + g4087;
+  return g2910;
+}
+
+long u292() {
+  g2920 = g4024 + g5;
+  g2921 = g3732 + g3814;
+  g2922 = g661 + g2939;
+  g2923 = g3862 + g1531;
+  g2924 = g4920 + g231;
+  g2925 = g3115 + g4888;
+  g2926 = g203 + g834;
+  g2927 = g4841 + g2453;
+  g2928 = g4998 + g2502;
+  g2929 = g3417 + g4451;
+  return g2920;
+}
+
+long u293() {
+  g2930 = g1055 + g2160;
+  g2931 = g1032 + g845;
+  g2932 = g4561 + g804;
+  g2933 = g4095 + g3157;
+  g2934 = g3071 + g2262;
+  g2935 = g1158 + g1087;
+  g2936 = g2806 + g3454;
+  g2937 = g2187 + g551;
+  g2938 = g1096 + g2153;
+  g2939 = g340 + g730;
+  return g2930;
+}
+
+long u294() {
+  g2940 = g3230 + g174;
+  g2941 = g1119 + g215;
+  g2942 = g4233 + g3701;
+  g2943 = g3322 + g1248;
+  g2944 = g885 + g831;
+  g2945 = g4233 + g3303;
+  g2946 = g2905 + g3590;
+  g2947 = g569 + g3047;
+  g2948 = g2583 + g4791;
+  g2949 = g4242 + g22;
+  return g2940;
+}
+
+long u295() {
+  g2950 = g1756 + g2634;
+  g2951 = g2845 + g1412;
+  g2952 = g2007 + g3228;
+  g2953 = g373 + g4266;
+  g2954 = g4684 + g3118;
+  g2955 = g944 + g4891;
+  g2956 = g3678 + g4174;
+  g2957 = g3062 + g3336;
+  g2958 = g1834 + g901;
+  g2959 = g2845 + g3633;
+  return g2950;
+}
+
+long u296() {
+  g2960 = g1301 + g3991;
+  g2961 = g340 + g741;
+  g2962 = g3242 + g1148;
+  g2963 = g1732 + g2687;
+  g2964 = g3124 + g1203;
+  g2965 = g4793 + g1208;
+  g2966 = g4237 + g1181;
+  g2967 = g3262 + g429;
+  g2968 = g2607 + g2697;
+  g2969 = g556 + g4917;
+  return g2960;
+}
+
+long u297() {
+  g2970 = g3246 + g3394;
+  g2971 = g2810 + g1001;
+  g2972 = g3381 + g661;
+  g2973 = g4083 + g4374;
+  g2974 = g2216 + g427;
+  g2975 = g1393 + g2005;
+  g2976 = g3115 + g1887;
+  g2977 = g3386 + g74;
+  g2978 = g3536 + g1078;
+  g2979 = g4655 + g3134;
+  return g2970;
+}
+
+long u298() {
+  g2980 = g896 + g2963;
+  g2981 = g4527 + g691;
+  g2982 = g2059 + g2212;
+  g2983 = g4836 + g1305;
+  g2984 = g1223 + g4600;
+  g2985 = g199 + g1090;
+  g2986 = g4575 + g271;
+  g2987 = g4063 + g2313;
+  g2988 = g4244 + g3223;
+  g2989 = g3276 + g1003;
+  return g2980;
+}
+
+long u299() {
+  g2990 = g3176 + g580;
+  g2991 = g4971 + g3323;
+  g2992 = g2828 + g1442;
+  g2993 = g4785 + g513;
+  g2994 = g4247 + g4006;
+  g2995 = g121 + g3536;
+  g2996 = g4390 + g1187;
+  g2997 = g4956 + g471;
+  g2998 = g4587 + g3996;
+  g2999 = g4637 + g4418;
+  return g2990;
+}
+
+long u300() {
+  g3000 = g3991 + g711;
+  g3001 = g4672 + g2348;
+  g3002 = g1975 + g1093;
+  g3003 = g3199 + g1838;
+  g3004 = g1012 + g1397;
+  g3005 = g3054 + g3472;
+  g3006 = g552 + g510;
+  g3007 = g3918 + g1005;
+  g3008 = g2275 + g180;
+  g3009 = g1594 + g2767;
+  return g3000;
+}
+
+long u301() {
+  g3010 = g540 + g2881;
+  g3011 = g3163 + g4776;
+  g3012 = g1208 + g4986;
+  g3013 = g4352 + g601;
+  g3014 = g2248 + g931;
+  g3015 = g2302 + g4514;
+  g3016 = g2411 + g1463;
+  g3017 = g4261 + g2990;
+  g3018 = g1369 + g1131;
+  g3019 = g2108 + g3622;
+  return g3010;
+}
+
+long u302() {
+  g3020 = g4782 + g4449;
+  g3021 = g4434 + g3339;
+  g3022 = g1905 + g1521;
+  g3023 = g1066 + g1719;
+  g3024 = g263 + g3849;
+  g3025 = g3195 + g2377;
+  g3026 = g546 + g4296;
+  g3027 = g48 + g2666;
+  g3028 = g212 + g2189;
+  g3029 = g3486 + g169;
+  return g3020;
+}
+
+long u303() {
+  g3030 = g3641 + g4684;
+  g3031 = g2565 + g25;
+  g3032 = g4518 + g3237;
+  g3033 = g2671 + g679;
+  g3034 = g4714 + g3943;
+  g3035 = g717 + g462;
+  g3036 = g2498 + g3870;
+  g3037 = g4178 + g906;
+  g3038 = g3394 + g1529;
+  g3039 = g833 + g1401;
+  return g3030;
+}
+
+long u304() {
+  g3040 = g557 + g1453;
+  g3041 = g4618 + g3638;
+  g3042 = g4529 + g1520;
+  g3043 = g748 + g3180;
+  g3044 = g1969 + g3326;
+  g3045 = g2703 + g747;
+  g3046 = g510 + g2941;
+  g3047 = g4819 + g4226;
+  g3048 = g1609 + g1302;
+  g3049 = g3157 + g4853;
+  return g3040;
+}
+
+long u305() {
+  g3050 = g4494 + g2039;
+  g3051 = g1009 + g4209;
+  g3052 = g460 + g3160;
+  g3053 = g4528 + g3981;
+  g3054 = g2116 + g240;
+  g3055 = g1851 + g961;
+  g3056 = g817 + g1501;
+  g3057 = g4381 + g490;
+  g3058 = g1384 + g4313;
+  g3059 = g2778 + g258;
+  return g3050;
+}
+
+long u306() {
+  g3060 = g2445 + g2914;
+  g3061 = g1674 + g521;
+  g3062 = g3085 + g3146;
+  g3063 = g822 + g4128;
+  g3064 = g2894 + g1379;
+  g3065 = g2924 + g1526;
+  g3066 = g3154 + g1278;
+  g3067 = g3584 + g4970;
+  g3068 = g3785 + g4692;
+  g3069 = g3727 + g3343;
+  return g3060;
+}
+
+long u307() {
+  g3070 = g2483 + g109;
+  g3071 = g1671 + g234;
+  g3072 = g4719 + g971;
+  g3073 = g2351 + g4708;
+  g3074 = g821 + g2117;
+  g3075 = g408 + g729;
+  g3076 = g137 + g193;
+  g3077 = g3143 + g2801;
+  g3078 = g454 + g574;
+  g3079 = g4028 + g4458;
+  return g3070;
+}
+
+long u308() {
+  g3080 = g1113 + g1396;
+  g3081 = g174 + g2457;
+  g3082 = g4244 + g4820;
+  g3083 = g2273 + g3661;
+  g3084 = g3579 + g184;
+  g3085 = g203 + g2876;
+  g3086 = g990 + g1020;
+  g3087 = g2017 + g3647;
+  g3088 = g4892 + g652;
+  g3089 = g641 + g4560;
+  return g3080;
+}
+
+long u309() {
+  g3090 = g3680 + g2672;
+  g3091 = g4067 + g4838;
+  g3092 = g1526 + g1866;
+  g3093 = g4943 + g894;
+  g3094 = g435 + g2170;
+  g3095 = g3749 + g1616;
+  g3096 = g2702 + g2826;
+  g3097 = g2569 + g2814;
+  g3098 = g4880 + g250;
+  g3099 = g3974 + g2225;
+  return g3090;
+}
+
+long u310() {
+  g3100 = g1352 + g2312;
+  g3101 = g271 + g2764;
+  g3102 = g3984 + g1237;
+  g3103 = g357 + g3027;
+  g3104 = g2712 + g908;
+  g3105 = g4354 + g2257;
+  g3106 = g3240 + g1274;
+  g3107 = g3512 + g2675;
+  g3108 = g2875 + g1277;
+  g3109 = g3908 + g4741;
+  return g3100;
+}
+
+long u311() {
+  g3110 = g1879 + g3856;
+  g3111 = g2781 + g3234;
+  g3112 = g1909 + g3858;
+  g3113 = g3447 + g496;
+  g3114 = g3330 + g4601;
+  g3115 = g542 + g3254;
+  g3116 = g4579 + g2860;
+  g3117 = g2495 + g3726;
+  g3118 = g4011 + g1621;
+  g3119 = g1546 + g153;
+  return g3110;
+}
+
+long u312() {
+  g3120 = g4 + g1983;
+  g3121 = g2995 + g729;
+  g3122 = g1067 + g2483;
+  g3123 = g1668 + g969;
+  g3124 = g255 + g1163;
+  g3125 = g3802 + g4762;
+  g3126 = g2955 + g2803;
+  g3127 = g2920 + g2811;
+  g3128 = g1092 + g4432;
+  g3129 = g1664 + g3687;
+  return g3120;
+}
+
+long u313() {
+  g3130 = g816 + g4492;
+  g3131 = g240 + g4905;
+  g3132 = g2647 + g1548;
+  g3133 = g2501 + g3333;
+  g3134 = g1627 + g3509;
+  g3135 = g4864 + g226;
+  g3136 = g3366 + g4439;
+  g3137 = g2074 + g4610;
+  g3138 = g3749 + g853;
+  g3139 = g866 + g4220;
+  return g3130;
+}
+
+long u314() {
+  g3140 = g2275 + g3226;
+  g3141 = g4923 + g1952;
+  g3142 = g3436 + g3889;
+  g3143 = g474 + g2470;
+  g3144 = g1490 + g4557;
+  g3145 = g1830 + g2342;
+  g3146 = g4530 + g513;
+  g3147 = g986 + g3869;
+  g3148 = g4295 + g4686;
+  g3149 = g913 + g4372;
+  return g3140;
+}
+
+long u315() {
+  g3150 = g3233 + g2183;
+  g3151 = g976 + g3036;
+  g3152 = g818 + g162;
+  g3153 = g1440 + g3175;
+  g3154 = g1995 + g3979;
+  g3155 = g1101 + g2029;
+  g3156 = g4435 + g3179;
+  g3157 = g2004 + g2774;
+  g3158 = g4485 + g3203;
+  g3159 = g4778 + g1877;
+  return g3150;
+}
+
+long u316() {
+  g3160 = g4457 + g1790;
+  g3161 = g367 + g2166;
+  g3162 = g2505 + g3222;
+  g3163 = g3306 + g1479;
+  g3164 = g1365 + g997;
+  g3165 = g3780 + g2822;
+  g3166 = g3610 + g4100;
+  g3167 = g2424 + g847;
+  g3168 = g3400 + g3424;
+  g3169 = g4010 + g631;
+  return g3160;
+}
+
+long u317() {
+  g3170 = g246 + g1521;
+  g3171 = g493 + g196;
+  g3172 = g1236 + g726;
+  g3173 = g4880 + g1794;
+  g3174 = g3599 + g214;
+  g3175 = g1974 + g3835;
+  g3176 = g2463 + g4166;
+  g3177 = g1596 + g616;
+  g3178 = g493 + g2052;
+  g3179 = g3704 + g4512;
+  return g3170;
+}
+
+long u318() {
+  g3180 = g4966 + g4847;
+  g3181 = g901 + g2967;
+  g3182 = g360 + g1165;
+  g3183 = g3677 + g4452;
+  g3184 = g4784 + g4681;
+  g3185 = g1237 + g1601;
+  g3186 = g981 + g2459;
+  g3187 = g4428 + g2210;
+  g3188 = g3593 + g502;
+  g3189 = g162 + g69;
+  return g3180;
+}
+
+long u319() {
+  g3190 = g637 + g2203;
+  g3191 = g3013 + g3125;
+  g3192 = g1426 + g3502;
+  g3193 = g3496 + g1180;
+  g3194 = g937 + g4579;
+  g3195 = g4233 + g3276;
+  g3196 = g2201 + g3868;
+  g3197 = g2078 + g3812;
+  g3198 = g4203 + g2238;
+  g3199 = g2560 + g1596;
+  return g3190;
+}
+
+long u320() {
+  g3200 = g2426 + g3765;
+  g3201 = g2151 + g3772;
+  g3202 = g1600 + g3462;
+  g3203 = g2507 + g467;
+  g3204 = g849 + g2033;
+  g3205 = g771 + g943;
+  g3206 = g672 + g3718;
+  g3207 = g523 + g3098;
+  g3208 = g4827 + g2342;
+  g3209 = g1825 + g3986;
+  return g3200;
+}
+
+long u321() {
+  g3210 = g904 + g4280;
+  g3211 = g4545 + g780;
+  g3212 = g298 + g1560;
+  g3213 = g1098 + g759;
+  g3214 = g2419 + g1197;
+  g3215 = g1880 + g1552;
+  g3216 = g4583 + g162;
+  g3217 = g1488 + g4754;
+  g3218 = g4342 + g861;
+  g3219 = g191 + g732;
+  return g3210;
+}
+
+long u322() {
+  g3220 = g1755 + g3115;
+  g3221 = g4366 + g4623;
+  g3222 = g493 + g20;
+  g3223 = g2233 + g739;
+  g3224 = g3254 + g3160;
+  g3225 = g97 + g4341;
+  g3226 = g3338 + g1136;
+  g3227 = g4510 + g1673;
+  g3228 = g1593 + g1940;
+  g3229 = g2938 + g651;
+  return g3220;
+}
+
+long u323() {
+  g3230 = g4568 + g4901;
+  g3231 = g965 + g4870;
+  g3232 = g2019 + g104;
+  g3233 = g2793 + g3756;
+  g3234 = g4889 + g3227;
+  g3235 = g3295 + g3677;
+  g3236 = g883 + g4400;
+  g3237 = g2936 + g1774;
+  g3238 = g2899 + g3103;
+  g3239 = g3713 + g1226;
+  return g3230;
+}
+
+long u324() {
+  g3240 = g1972 + g534;
+  g3241 = g799 + g4034;
+  g3242 = g4601 + g1736;
+  g3243 = g3735 + g5;
+  g3244 = g4579 + g520;
+  g3245 = g1847 + g3076;
+  g3246 = g1196 + g3229;
+  g3247 = g4170 + g1665;
+  g3248 = g321 + g4047;
+  g3249 = g4368 + g649;
+  return g3240;
+}
+
+long u325() {
+  g3250 = g3494 + g765;
+  g3251 = g2152 + g1135;
+  g3252 = g3455 + g1730;
+  g3253 = g3520 + g686;
+  g3254 = g2909 + g2273;
+  g3255 = g4335 + g4571;
+  g3256 = g2299 + g2597;
+  g3257 = g3520 + g2850;
+  g3258 = g1438 + g3865;
+  g3259 = g2230 + g27;
+  return g3250;
+}
+
+long u326() {
+  g3260 = g4020 + g30;
+  g3261 = g4706 + g3433;
+  g3262 = g3682 + g3048;
+  g3263 = g2799 + g2483;
+  g3264 = g3782 + g1589;
+  g3265 = g1845 + g4434;
+  g3266 = g1018 + g1761;
+  g3267 = g266 + g3076;
+  g3268 = g958 + g4426;
+  g3269 = g400 + g1243;
+  return g3260;
+}
+
+long u327() {
+  g3270 = g2595 + g3710;
+  g3271 = g4198 + g3337;
+  g3272 = g3112 + g4181;
+  g3273 = g3776 + g1732;
+  g3274 = g4232 + g252;
+  g3275 = g4791 + g853;
+  g3276 = g4057 + g565;
+  g3277 = g642 + g4792;
+  g3278 = g4288 + g4868;
+  g3279 = g580 + g3787;
+  return g3270;
+}
+
+long u328() {
+  g3280 = g1934 + g1723;
+  g3281 = g2146 + g4777;
+  g3282 = g2748 + g4304;
+  g3283 = g756 + g2086;
+  g3284 = g4200 + g2623;
+  g3285 = g2578 + g228;
+  g3286 = g2498 + g221;
+  g3287 = g1356 + g160;
+  g3288 = g2750 + g4908;
+  g3289 = g218 + g3610;
+  return g3280;
+}
+
+long u329() {
+  g3290 = g403 + g3134;
+  g3291 = g3053 + g1431;
+  g3292 = g1654 + g1410;
+  g3293 = g4582 + g569;
+  g3294 = g4757 + g2842;
+  g3295 = g4970 + g3723;
+  g3296 = g1072 + g2604;
+  g3297 = g3116 + g3376;
+  g3298 = g1301 + g898;
+  g3299 = g3364 + g4970;
+  return g3290;
+}
+
+long u330() {
+  g3300 = g2290 + g895;
+  g3301 = g4481 + g4678;
+  g3302 = g568 + g4873;
+  g3303 = g4991 + g3820;
+  g3304 = g1563 + g3146;
+  g3305 = g4518 + g4350;
+  g3306 = g4612 + g3089;
+  g3307 = g2879 + g1754;
+  g3308 = g3898 + g2373;
+  g3309 = g2652 + g1260;
+  return g3300;
+}
+
+long u331() {
+  g3310 = g3998 + g33;
+  g3311 = g2144 + g3515;
+  g3312 = g1438 + g3806;
+  g3313 = g3960 + g1624;
+  g3314 = g445 + g974;
+  g3315 = g1073 + g49;
+  g3316 = g2539 + g2131;
+  g3317 = g1012 + g1915;
+  g3318 = g4160 + g2501;
+  g3319 = g4116 + g35;
+  return g3310;
+}
+
+long u332() {
+  g3320 = g1012 + g2490;
+  g3321 = g31 + g2283;
+  g3322 = g4588 + g893;
+  g3323 = g2981 + g2928;
+  g3324 = g4303 + g4879;
+  g3325 = g4235 + g1290;
+  g3326 = g3517 + g2949;
+  g3327 = g1049 + g208;
+  g3328 = g1397 + g1201;
+  g3329 = g1748 + g4620;
+  return g3320;
+}
+
+long u333() {
+  g3330 = g2212 + g2335;
+  g3331 = g4811 + g2886;
+  g3332 = g1193 + g2253;
+  g3333 = g3086 + g2723;
+  g3334 = g1552 + g3751;
+  g3335 = g4849 + g1500;
+  g3336 = g3156 + g2810;
+  g3337 = g2371 + g2652;
+  g3338 = g1642 + g2968;
+  g3339 = g3267 + g4939;
+  return g3330;
+}
+
+long u334() {
+  g3340 = g1824 + g2774;
+  g3341 = g1797 + g3896;
+  g3342 = g4559 + g2361;
+  g3343 = g2826 + g3160;
+  g3344 = g1497 + g161;
+  g3345 = g4521 + g875;
+  g3346 = g4467 + g3388;
+  g3347 = g1786 + g77;
+  g3348 = g865 + g4199;
+  g3349 = g1195 + g2245;
+  return g3340;
+}
+
+long u335() {
+  g3350 = g1822 + g4862;
+  g3351 = g372 + g580;
+  g3352 = g2411 + g157;
+  g3353 = g2022 + g261;
+  g3354 = g2075 + g1760;
+  g3355 = g1376 + g430;
+  g3356 = g4249 + g1276;
+  g3357 = g360 + g4447;
+  g3358 = g12 + g815;
+  g3359 = g614 + g1464;
+  return g3350;
+}
+
+long u336() {
+  g3360 = g4353 + g2168;
+  g3361 = g3272 + g470;
+  g3362 = g1500 + g2815;
+  g3363 = g4021 + g933;
+  g3364 = g2395 + g1740;
+  g3365 = g4812 + g1899;
+  g3366 = g3774 + g4833;
+  g3367 = g4878 + g4867;
+  g3368 = g2485 + g4891;
+  g3369 = g2205 + g902;
+  return g3360;
+}
+
+long u337() {
+  g3370 = g2054 + g3907;
+  g3371 = g3142 + g226;
+  g3372 = g1824 + g3258;
+  g3373 = g997 + g2693;
+  g3374 = g4803 + g2243;
+  g3375 = g2681 + g2486;
+  g3376 = g406 + g1676;
+  g3377 = g3958 + g825;
+  g3378 = g4821 + g3061;
+  g3379 = g3211 + g3911;
+  return g3370;
+}
+
+long u338() {
+  g3380 = g270 + g3154;
+  g3381 = g272 + g3293;
+  g3382 = g3851 + g3649;
+  g3383 = g3468 + g3630;
+  g3384 = g1535 + g2553;
+  g3385 = g4111 + g4985;
+  g3386 = g16 + g2505;
+  g3387 = g1702 + g873;
+  g3388 = g2875 + g3598;
+  g3389 = g3060 + g4743;
+  return g3380;
+}
+
+long u339() {
+  g3390 = g1863 + g4075;
+  g3391 = g1993 + g4849;
+  g3392 = g1783 + g4036;
+  g3393 = g2399 + g748;
+  g3394 = g3460 + g1325;
+  g3395 = g27 + g1939;
+  g3396 = g2875 + g1992;
+  g3397 = g2384 + g728;
+  g3398 = g3155 + g1504;
+  g3399 = g1807 + g3716;
+  return g3390;
+}
+
+long u340() {
+  g3400 = g4069 + g3175;
+  g3401 = g2303 + g4870;
+  g3402 = g1173 + g3539;
+  g3403 = g3335 + g970;
+  g3404 = g193 + g4678;
+  g3405 = g384 + g310;
+  g3406 = g3311 + g1119;
+  g3407 = g4408 + g4966;
+  g3408 = g3021 + g3605;
+  g3409 = g2937 + g3301;
+  return g3400;
+}
+
+long u341() {
+  g3410 = g4009 + g1817;
+  g3411 = g1282 + g2793;
+  g3412 = g2458 + g4860;
+  g3413 = g2042 + g3363;
+  g3414 = g4787 + g1884;
+  g3415 = g4885 + g2152;
+  g3416 = g3507 + g50;
+  g3417 = g1051 + g1451;
+  g3418 = g3759 + g402;
+  g3419 = g4989 + g4956;
+  return g3410;
+}
+
+long u342() {
+  g3420 = g2791 + g874;
+  g3421 = g1936 + g4326;
+  g3422 = g44 + g1010;
+  g3423 = g1786 + g4637;
+  g3424 = g2250 + g4040;
+  g3425 = g3036 + g1528;
+  g3426 = g701 + g647;
+  g3427 = g3978 + g4176;
+  g3428 = g285 + g2479;
+  g3429 = g1761 + g4948;
+  return g3420;
+}
+
+long u343() {
+  g3430 = g4390 + g4087;
+  g3431 = g1012 + g567;
+  g3432 = g4974 + g2075;
+  g3433 = g2742 + g3813;
+  g3434 = g695 + g2493;
+  g3435 = g3697 + g155;
+  g3436 = g3295 + g547;
+  g3437 = g1062 + g891;
+  g3438 = g4710 + g2253;
+  g3439 = g586 + g4969;
+  return g3430;
+}
+
+long u344() {
+  g3440 = g4549 + g2395;
+  g3441 = g2460 + g520;
+  g3442 = g770 + g1460;
+  g3443 = g1656 + g2900;
+  g3444 = g1403 + g2833;
+  g3445 = g2754 + g4692;
+  g3446 = g640 + g2170;
+  g3447 = g375 + g4216;
+  g3448 = g1275 + g1882;
+  g3449 = g1211 + g4023;
+  return g3440;
+}
+
+long u345() {
+  g3450 = g3483 + g1791;
+  g3451 = g2626 + g2484;
+  g3452 = g2827 + g426;
+  g3453 = g419 + g2011;
+  g3454 = g948 + g592;
+  g3455 = g4502 + g1773;
+  g3456 = g2925 + g2708;
+  g3457 = g1153 + g1951;
+  g3458 = g4712 + g894;
+  g3459 = g4905 + g852;
+  return g3450;
+}
+
+long u346() {
+  g3460 = g2437 + g4354;
+  g3461 = g293 + g700;
+  g3462 = g27 + g2697;
+  g3463 = g2779 + g1620;
+  g3464 = g2651 + g3816;
+  g3465 = g1432 + g462;
+  g3466 = g3150 + g4125;
+  g3467 = g881 + g2619;
+  g3468 = g867 + g338;
+  g3469 = g876 + g1862;
+  return g3460;
+}
+
+long u347() {
+  g3470 = g3418 + g503;
+  g3471 = g4111 + g804;
+  g3472 = g1107 + g1362;
+  g3473 = g3506 + g1212;
+  g3474 = g3514 + g1297;
+  g3475 = g4571 + g463;
+  g3476 = g3903 + g3769;
+  g3477 = g3360 + g1434;
+  g3478 = g735 + g4499;
+  g3479 = g3822 + g392;
+  return g3470;
+}
+
+long u348() {
+  g3480 = g4098 + g1988;
+  g3481 = g4080 + g1817;
+  g3482 = g4074 + g2310;
+  g3483 = g1779 + g4809;
+  g3484 = g4545 + g2668;
+  g3485 = g720 + g1114;
+  g3486 = g2399 + g3409;
+  g3487 = g4410 + g4464;
+  g3488 = g2266 + g2034;
+  g3489 = g3929 + g563;
+  return g3480;
+}
+
+long u349() {
+  g3490 = g2377 + g1994;
+  g3491 = g3433 + g1773;
+  g3492 = g1543 + g1022;
+  g3493 = g2774 + g3336;
+  g3494 = g4708 + g613;
+  g3495 = g1314 + g2861;
+  g3496 = g713 + g63;
+  g3497 = g4739 + g3713;
+  g3498 = g531 + g3681;
+  g3499 = g4116 + g2694;
+  return g3490;
+}
+
+long u350() {
+  g3500 = g799 + g1076;
+  g3501 = g4540 + g3929;
+  g3502 = g3552 + g2122;
+  g3503 = g2288 + g1284;
+  g3504 = g414 + g3406;
+  g3505 = g694 + g4226;
+  g3506 = g468 + g3501;
+  g3507 = g209 + g1574;
+  g3508 = g3689 + g2477;
+  g3509 = g296 + g2959;
+  return g3500;
+}
+
+long u351() {
+  g3510 = g431 + g1373;
+  g3511 = g4017 + g3420;
+  g3512 = g372 + g151;
+  g3513 = g2950 + g1340;
+  g3514 = g3397 + g4006;
+  g3515 = g2135 + g898;
+  g3516 = g525 + g952;
+  g3517 = g135 + g4986;
+  g3518 = g2577 + g1764;
+  g3519 = g3433 + g3340;
+  return g3510;
+}
+
+long u352() {
+  g3520 = g713 + g3553;
+  g3521 = g3241 + g1715;
+  g3522 = g796 + g1244;
+  g3523 = g479 + g343;
+  g3524 = g4237 + g131;
+  g3525 = g1656 + g3260;
+  g3526 = g1848 + g205;
+  g3527 = g3692 + g4537;
+  g3528 = g2377 + g2386;
+  g3529 = g4815 + g3531;
+  return g3520;
+}
+
+long u353() {
+  g3530 = g3861 + g2823;
+  g3531 = g4277 + g1135;
+  g3532 = g1867 + g3802;
+  g3533 = g4803 + g309;
+  g3534 = g180 + g1881;
+  g3535 = g3515 + g3907;
+  g3536 = g755 + g4178;
+  g3537 = g1035 + g3886;
+  g3538 = g2783 + g3967;
+  g3539 = g427 + g3819;
+  return g3530;
+}
+
+long u354() {
+  g3540 = g1129 + g3611;
+  g3541 = g1321 + g1718;
+  g3542 = g2081 + g419;
+  g3543 = g2704 + g1698;
+  g3544 = g1667 + g1428;
+  g3545 = g4208 + g390;
+  g3546 = g4612 + g981;
+  g3547 = g1010 + g2974;
+  g3548 = g1953 + g4624;
+  g3549 = g2101 + g2648;
+  return g3540;
+}
+
+long u355() {
+  g3550 = g1053 + g3702;
+  g3551 = g3444 + g4252;
+  g3552 = g3790 + g215;
+  g3553 = g3595 + g697;
+  g3554 = g4672 + g4432;
+  g3555 = g2832 + g788;
+  g3556 = g595 + g1332;
+  g3557 = g103 + g4866;
+  g3558 = g2150 + g1677;
+  g3559 = g3067 + g853;
+  return g3550;
+}
+
+long u356() {
+  g3560 = g3734 + g119;
+  g3561 = g4922 + g515;
+  g3562 = g656 + g288;
+  g3563 = g1905 + g3542;
+  g3564 = g4865 + g2607;
+  g3565 = g1670 + g3460;
+  g3566 = g2168 + g1897;
+  g3567 = g1004 + g4673;
+  g3568 = g3543 + g2874;
+  g3569 = g2816 + g3232;
+  return g3560;
+}
+
+long u357() {
+  g3570 = g3347 + g582;
+  g3571 = g4501 + g3449;
+  g3572 = g4608 + g4428;
+  g3573 = g3161 + g1434;
+  g3574 = g934 + g1691;
+  g3575 = g2566 + g2553;
+  g3576 = g3736 + g2994;
+  g3577 = g1954 + g4913;
+  g3578 = g1834 + g1020;
+  g3579 = g4202 + g4239;
+  return g3570;
+}
+
+long u358() {
+  g3580 = g1760 + g1786;
+  g3581 = g2387 + g1787;
+  g3582 = g1380 + g3106;
+  g3583 = g4980 + g3602;
+  g3584 = g3273 + g4675;
+  g3585 = g4823 + g4314;
+  g3586 = g4759 + g1976;
+  g3587 = g4366 + g1532;
+  g3588 = g4584 + g2055;
+  g3589 = g2962 + g3030;
+  return g3580;
+}
+
+long u359() {
+  g3590 = g62 + g3322;
+  g3591 = g3120 + g1338;
+  g3592 = g4042 + g4565;
+  g3593 = g3620 + g3646;
+  g3594 = g3645 + g214;
+  g3595 = g3454 + g4473;
+  g3596 = g2455 + g4125;
+  g3597 = g586 + g2969;
+  g3598 = g3620 + g4641;
+  g3599 = g4032 + g1639;
+  return g3590;
+}
+
+long u360() {
+  g3600 = g3784 + g4541;
+  g3601 = g4121 + g2860;
+  g3602 = g2504 + g2051;
+  g3603 = g4263 + g558;
+  g3604 = g437 + g4546;
+  g3605 = g642 + g4950;
+  g3606 = g1931 + g2364;
+  g3607 = g2212 + g4197;
+  g3608 = g1055 + g2551;
+  g3609 = g1479 + g2651;
+  return g3600;
+}
+
+long u361() {
+  g3610 = g2949 + g4374;
+  g3611 = g926 + g3903;
+  g3612 = g4563 + g3761;
+  g3613 = g1334 + g3752;
+  g3614 = g588 + g3238;
+  g3615 = g1343 + g2981;
+  g3616 = g490 + g3882;
+  g3617 = g344 + g81;
+  g3618 = g201 + g3539;
+  g3619 = g1726 + g3605;
+  return g3610;
+}
+
+long u362() {
+  g3620 = g3578 + g3948;
+  g3621 = g2925 + g1003;
+  g3622 = g3219 + g2415;
+  g3623 = g4755 + g4692;
+  g3624 = g7 + g3026;
+  g3625 = g1592 + g1419;
+  g3626 = g4116 + g1129;
+  g3627 = g4485 + g4669;
+  g3628 = g1519 + g333;
+  g3629 = g3876 + g502;
+  return g3620;
+}
+
+long u363() {
+  g3630 = g3163 + g1730;
+  g3631 = g2303 + g790;
+  g3632 = g1929 + g1278;
+  g3633 = g4635 + g4939;
+  g3634 = g3625 + g3463;
+  g3635 = g3384 + g4176;
+  g3636 = g3361 + g4182;
+  g3637 = g1705 + g4446;
+  g3638 = g778 + g1183;
+  g3639 = g2287 + g3865;
+  return g3630;
+}
+
+long u364() {
+  g3640 = g3399 + g1281;
+  g3641 = g2678 + g199;
+  g3642 = g2458 + g4780;
+  g3643 = g4625 + g878;
+  g3644 = g4588 + g2153;
+  g3645 = g1777 + g982;
+  g3646 = g2936 + g4063;
+  g3647 = g28 + g2260;
+  g3648 = g4242 + g4424;
+  g3649 = g1013 + g821;
+  return g3640;
+}
+
+long u365() {
+  g3650 = g2682 + g982;
+  g3651 = g3574 + g3724;
+  g3652 = g2240 + g4209;
+  g3653 = g2721 + g1788;
+  g3654 = g330 + g2141;
+  g3655 = g4665 + g2833;
+  g3656 = g3213 + g1668;
+  g3657 = g2837 + g4009;
+  g3658 = g1954 + g2631;
+  g3659 = g4540 + g2406;
+  return g3650;
+}
+
+long u366() {
+  g3660 = g3510 + g1575;
+  g3661 = g974 + g2028;
+  g3662 = g3960 + g2274;
+  g3663 = g1301 + g3444;
+  g3664 = g4871 + g595;
+  g3665 = g22 + g4370;
+  g3666 = g1283 + g3948;
+  g3667 = g1517 + g2633;
+  g3668 = g3794 + g2823;
+  g3669 = g2122 + g1677;
+  return g3660;
+}
+
+long u367() {
+  g3670 = g4238 + g2084;
+  g3671 = g1630 + g2491;
+  g3672 = g2715 + g3116;
+  g3673 = g2395 + g2091;
+  g3674 = g2840 + g459;
+  g3675 = g4242 + g4250;
+  g3676 = g4117 + g3280;
+  g3677 = g3083 + g3867;
+  g3678 = g2386 + g1597;
+  g3679 = g4173 + g3529;
+  return g3670;
+}
+
+long u368() {
+  g3680 = g4209 + g335;
+  g3681 = g3253 + g3448;
+  g3682 = g4447 + g96;
+  g3683 = g3798 + g578;
+  g3684 = g2012 + g1933;
+  g3685 = g3082 + g1516;
+  g3686 = g1014 + g3594;
+  g3687 = g2793 + g1727;
+  g3688 = g2597 + g2125;
+  g3689 = g325 + g3895;
+  return g3680;
+}
+
+long u369() {
+  g3690 = g4737 + g1306;
+  g3691 = g3289 + g2532;
+  g3692 = g4773 + g3523;
+  g3693 = g1931 + g1679;
+  g3694 = g4828 + g3942;
+  g3695 = g198 + g713;
+  g3696 = g1126 + g1371;
+  g3697 = g825 + g1064;
+  g3698 = g4763 + g127;
+  g3699 = g2717 + g908;
+  return g3690;
+}
+
+long u370() {
+  g3700 = g4457 + g4365;
+  g3701 = g3532 + g1269;
+  g3702 = g2269 + g4285;
+  g3703 = g1556 + g4557;
+  g3704 = g2922 + g12;
+  g3705 = g3486 + g1459;
+  g3706 = g474 + g1440;
+  g3707 = g3369 + g2247;
+  g3708 = g1934 + g2291;
+  g3709 = g2640 + g517;
+  return g3700;
+}
+
+long u371() {
+  g3710 = g3249 + g4688;
+  g3711 = g1302 + g2936;
+  g3712 = g4454 + g1276;
+  g3713 = g3704 + g961;
+  g3714 = g4400 + g4827;
+  g3715 = g275 + g3648;
+  g3716 = g1454 + g1889;
+  g3717 = g387 + g1960;
+  g3718 = g3129 + g2104;
+  g3719 = g1188 + g153;
+  return g3710;
+}
+
+long u372() {
+  g3720 = g1065 + g1201;
+  g3721 = g2485 + g905;
+  g3722 = g2618 + g4762;
+  g3723 = g4525 + g2542;
+  g3724 = g1322 + g1405;
+  g3725 = g3231 + g1152;
+  g3726 = g1907 + g4351;
+  g3727 = g2731 + g2956;
+  g3728 = g721 + g1413;
+  g3729 = g4044 + g4972;
+  return g3720;
+}
+
+long u373() {
+  g3730 = g425 + g2925;
+  g3731 = g4449 + g2143;
+  g3732 = g2601 + g1406;
+  g3733 = g4251 + g484;
+  g3734 = g2850 + g1693;
+  g3735 = g4565 + g4993;
+  g3736 = g1909 + g3963;
+  g3737 = g188 + g1068;
+  g3738 = g755 + g1706;
+  g3739 = g2343 + g1111;
+  return g3730;
+}
+
+long u374() {
+  g3740 = g3855 + g2062;
+  g3741 = g4072 + g2996;
+  g3742 = g2720 + g1588;
+  g3743 = g2800 + g1112;
+  g3744 = g1857 + g3510;
+  g3745 = g526 + g2427;
+  g3746 = g4412 + g2990;
+  g3747 = g588 + g4758;
+  g3748 = g63 + g4853;
+  g3749 = g2834 + g4562;
+  return g3740;
+}
+
+long u375() {
+  g3750 = g594 + g2680;
+  g3751 = g4094 + g2777;
+  g3752 = g1975 + g1739;
+  g3753 = g1886 + g2442;
+  g3754 = g1563 + g1325;
+  g3755 = g3605 + g3082;
+  g3756 = g3339 + g2053;
+  g3757 = g1223 + g451;
+  g3758 = g2699 + g1562;
+  g3759 = g1438 + g1313;
+  return g3750;
+}
+
+long u376() {
+  g3760 = g1795 + g1021;
+  g3761 = g1158 + g3166;
+  g3762 = g1647 + g3819;
+  g3763 = g740 + g1178;
+  g3764 = g4501 + g3573;
+  g3765 = g3968 + g3940;
+  g3766 = g3263 + g2251;
+  g3767 = g4265 + g3635;
+  g3768 = g1396 + g3236;
+  g3769 = g3870 + g571;
+  return g3760;
+}
+
+long u377() {
+  g3770 = g1894 + g4599;
+  g3771 = g363 + g2699;
+  g3772 = g562 + g2924;
+  g3773 = g1968 + g990;
+  g3774 = g2939 + g1120;
+  g3775 = g380 + g2976;
+  g3776 = g1056 + g3710;
+  g3777 = g1215 + g1269;
+  g3778 = g390 + g4862;
+  g3779 = g9 + g1616;
+  return g3770;
+}
+
+long u378() {
+  g3780 = g902 + g1000;
+  g3781 = g466 + g4134;
+  g3782 = g3149 + g2398;
+  g3783 = g2486 + g4175;
+  g3784 = g1176 + g1908;
+  g3785 = g700 + g4734;
+  g3786 = g3886 + g1370;
+  g3787 = g646 + g4051;
+  g3788 = g2486 + g2014;
+  g3789 = g8 + g4747;
+  return g3780;
+}
+
+long u379() {
+  g3790 = g4378 + g1764;
+  g3791 = g1013 + g4446;
+  g3792 = g1526 + g4640;
+  g3793 = g2849 + g274;
+  g3794 = g3856 + g866;
+  g3795 = g2597 + g199;
+  g3796 = g198 + g3466;
+  g3797 = g2648 + g3953;
+  g3798 = g3052 + g4849;
+  g3799 = g2617 + g4843;
+  return g3790;
+}
+
+long u380() {
+  g3800 = g3054 + g103;
+  g3801 = g2876 + g1950;
+  g3802 = g4683 + g3024;
+  g3803 = g4501 + g1464;
+  g3804 = g1484 + g2423;
+  g3805 = g2465 + g3433;
+  g3806 = g1080 + g67;
+  g3807 = g3183 + g2931;
+  g3808 = g1210 + g4838;
+  g3809 = g2548 + g1985;
+  return g3800;
+}
+
+long u381() {
+  g3810 = g4889 + g574;
+  g3811 = g3374 + g256;
+  g3812 = g3117 + g4223;
+  g3813 = g2842 + g3849;
+  g3814 = g2060 + g1076;
+  g3815 = g4308 + g2121;
+  g3816 = g499 + g1748;
+  g3817 = g4757 + g302;
+  g3818 = g3342 + g3051;
+  g3819 = g3404 + g3105;
+  return g3810;
+}
+
+long u382() {
+  g3820 = g4505 + g1005;
+  g3821 = g3464 + g1601;
+  g3822 = g1008 + g2308;
+  g3823 = g4352 + g475;
+  g3824 = g3997 + g3289;
+  g3825 = g2087 + g698;
+  g3826 = g4799 + g4552;
+  g3827 = g1349 + g4425;
+  g3828 = g677 + g3518;
+  g3829 = g109 + g4640;
+  return g3820;
+}
+
+long u383() {
+  g3830 = g1021 + g4385;
+  g3831 = g4595 + g2834;
+  g3832 = g411 + g1804;
+  g3833 = g55 + g3520;
+  g3834 = g3977 + g2823;
+  g3835 = g4391 + g532;
+  g3836 = g2358 + g3807;
+  g3837 = g4537 + g477;
+  g3838 = g1262 + g1903;
+  g3839 = g1704 + g1174;
+  return g3830;
+}
+
+long u384() {
+  g3840 = g2828 + g114;
+  g3841 = g3520 + g401;
+  g3842 = g3052 + g3987;
+  g3843 = g4705 + g3401;
+  g3844 = g2152 + g4216;
+  g3845 = g1496 + g2182;
+  g3846 = g2200 + g3002;
+  g3847 = g2503 + g3074;
+  g3848 = g4679 + g3740;
+  g3849 = g3125 + g1879;
+  return g3840;
+}
+
+long u385() {
+  g3850 = g1872 + g4122;
+  g3851 = g3817 + g1038;
+  g3852 = g4736 + g243;
+  g3853 = g349 + g3674;
+  g3854 = g3769 + g4737;
+  g3855 = g344 + g3943;
+  g3856 = g2009 + g3562;
+  g3857 = g3066 + g1812;
+  g3858 = g1276 + g656;
+  g3859 = g4583 + g2175;
+  return g3850;
+}
+
+long u386() {
+  g3860 = g4156 + g284;
+  g3861 = g1783 + g4420;
+  g3862 = g3454 + g3321;
+  g3863 = g3188 + g3266;
+  g3864 = g2281 + g1291;
+  g3865 = g4879 + g2240;
+  g3866 = g202 + g1454;
+  g3867 = g894 + g969;
+  g3868 = g1327 + g216;
+  g3869 = g2620 + g4770;
+  return g3860;
+}
+
+long u387() {
+  g3870 = g4006 + g1278;
+  g3871 = g4409 + g2880;
+  g3872 = g1828 + g1466;
+  g3873 = g2230 + g1965;
+  g3874 = g1835 + g811;
+  g3875 = g4004 + g4945;
+  g3876 = g2217 + g2893;
+  g3877 = g91 + g2153;
+  g3878 = g4573 + g37;
+  g3879 = g1721 + g2582;
+  return g3870;
+}
+
+long u388() {
+  g3880 = g258 + g2241;
+  g3881 = g3514 + g451;
+  g3882 = g602 + g3106;
+  g3883 = g4645 + g1703;
+  g3884 = g4226 + g4581;
+  g3885 = g4935 + g2833;
+  g3886 = g4975 + g2660;
+  g3887 = g3157 + g569;
+  g3888 = g1061 + g3413;
+  g3889 = g4892 + g3257;
+  return g3880;
+}
+
+long u389() {
+  g3890 = g4573 + g3868;
+  g3891 = g1219 + g4745;
+  g3892 = g1179 + g870;
+  g3893 = g2743 + g1497;
+  g3894 = g4486 + g4706;
+  g3895 = g2080 + g3713;
+  g3896 = g4639 + g3185;
+  g3897 = g2320 + g1107;
+  g3898 = g2521 + g1649;
+  g3899 = g4867 + g1576;
+  return g3890;
+}
+
+long u390() {
+  g3900 = g2086 + g1957;
+  g3901 = g3056 + g981;
+  g3902 = g83 + g380;
+  g3903 = g3718 + g1184;
+  g3904 = g745 + g3226;
+  g3905 = g4408 + g447;
+  g3906 = g1546 + g3156;
+  g3907 = g2561 + g1181;
+  g3908 = g748 + g1117;
+  g3909 = g306 + g879;
+  return g3900;
+}
+
+long u391() {
+  g3910 = g2775 + g1637;
+  g3911 = g896 + g3307;
+  g3912 = g3219 + g394;
+  g3913 = g2371 + g304;
+  g3914 = g916 + g1696;
+  g3915 = g2695 + g1847;
+  g3916 = g608 + g1024;
+  g3917 = g1764 + g2768;
+  g3918 = g4002 + g4998;
+  g3919 = g4532 + g197;
+  return g3910;
+}
+
+long u392() {
+  g3920 = g3785 + g2995;
+  g3921 = g274 + g3767;
+  g3922 = g84 + g3881;
+  g3923 = g2608 + g2394;
+  g3924 = g1875 + g2798;
+  g3925 = g4495 + g4180;
+  g3926 = g755 + g4838;
+  g3927 = g3451 + g3358;
+  g3928 = g2122 + g3878;
+  g3929 = g1923 + g2136;
+  return g3920;
+}
+
+long u393() {
+  g3930 = g2835 + g4814;
+  g3931 = g4680 + g4343;
+  g3932 = g4703 + g40;
+  g3933 = g4378 + g4247;
+  g3934 = g1426 + g4507;
+  g3935 = g1744 + g4715;
+  g3936 = g4990 + g3095;
+  g3937 = g554 + g3890;
+  g3938 = g640 + g2952;
+  g3939 = g328 + g537;
+  return g3930;
+}
+
+long u394() {
+  g3940 = g713 + g335;
+  g3941 = g3711 + g4589;
+  g3942 = g3174 + g2722;
+  g3943 = g4772 + g643;
+  g3944 = g4119 + g628;
+  g3945 = g4486 + g4215;
+  g3946 = g3809 + g4017;
+  g3947 = g2294 + g4000;
+  g3948 = g3402 + g1287;
+  g3949 = g4911 + g2028;
+  return g3940;
+}
+
+long u395() {
+  g3950 = g3501 + g4644;
+  g3951 = g26 + g1347;
+  g3952 = g1645 + g171;
+  g3953 = g2103 + g3550;
+  g3954 = g2348 + g4938;
+  g3955 = g2098 + g1805;
+  g3956 = g3931 + g753;
+  g3957 = g2753 + g2034;
+  g3958 = g3217 + g3146;
+  g3959 = g188 + g564;
+  return g3950;
+}
+
+long u396() {
+  g3960 = g352 + g308;
+  g3961 = g957 + g954;
+  g3962 = g30 + g3627;
+  g3963 = g1387 + g1196;
+  g3964 = g4698 + g3109;
+  g3965 = g4938 + g2870;
+  g3966 = g886 + g1947;
+  g3967 = g2518 + g116;
+  g3968 = g2815 + g1884;
+  g3969 = g2417 + g2941;
+  return g3960;
+}
+
+long u397() {
+  g3970 = g3699 + g2160;
+  g3971 = g1496 + g1119;
+  g3972 = g2739 + g1128;
+  g3973 = g176 + g14;
+  g3974 = g1985 + g3375;
+  g3975 = g4637 + g4231;
+  g3976 = g3893 + g939;
+  g3977 = g4170 + g4318;
+  g3978 = g1098 + g908;
+  g3979 = g4053 + g1484;
+  return g3970;
+}
+
+long u398() {
+  g3980 = g1064 + g2368;
+  g3981 = g2941 + g2351;
+  g3982 = g477 + g2864;
+  g3983 = g4129 + g2565;
+  g3984 = g499 + g2685;
+  g3985 = g1081 + g3453;
+  g3986 = g3747 + g2782;
+  g3987 = g7 + g35;
+  g3988 = g3228 + g1169;
+  g3989 = g4297 + g1959;
+  return g3980;
+}
+
+long u399() {
+  g3990 = g345 + g1856;
+  g3991 = g3827 + g2765;
+  g3992 = g1551 + g3464;
+  g3993 = g3529 + g1153;
+  g3994 = g3170 + g174;
+  g3995 = g4714 + g66;
+  g3996 = g3508 + g3586;
+  g3997 = g4038 + g484;
+  g3998 = g346 + g3401;
+  g3999 = g638 + g2684;
+  return g3990;
+}
+
+long u400() {
+  g4000 = g995 + g195;
+  g4001 = g850 + g2836;
+  g4002 = g4288 + g933;
+  g4003 = g678 + g4150;
+  g4004 = g4043 + g3316;
+  g4005 = g4760 + g1431;
+  g4006 = g1515 + g1373;
+  g4007 = g3436 + g4460;
+  g4008 = g632 + g4218;
+  g4009 = g1402 + g78;
+  return g4000;
+}
+
+long u401() {
+  g4010 = g3949 + g1416;
+  g4011 = g3504 + g791;
+  g4012 = g1688 + g307;
+  g4013 = g596 + g230;
+  g4014 = g4017 + g3616;
+  g4015 = g3531 + g2001;
+  g4016 = g394 + g4774;
+  g4017 = g4916 + g343;
+  g4018 = g3573 + g4643;
+  g4019 = g560 + g1594;
+  return g4010;
+}
+
+long u402() {
+  g4020 = g4651 + g2066;
+  g4021 = g3611 + g4719;
+  g4022 = g2561 + g136;
+  g4023 = g1751 + g1743;
+  g4024 = g363 + g2557;
+  g4025 = g395 + g3002;
+  g4026 = g2985 + g1440;
+  g4027 = g193 + g1947;
+  g4028 = g50 + g4585;
+  g4029 = g1359 + g4431;
+  return g4020;
+}
+
+long u403() {
+  g4030 = g2245 + g4775;
+  g4031 = g2046 + g1844;
+  g4032 = g4667 + g3223;
+  g4033 = g435 + g4200;
+  g4034 = g3325 + g1189;
+  g4035 = g4823 + g1036;
+  g4036 = g1635 + g1743;
+  g4037 = g2881 + g3533;
+  g4038 = g4630 + g2419;
+  g4039 = g701 + g3689;
+  return g4030;
+}
+
+long u404() {
+  g4040 = g1550 + g3021;
+  g4041 = g460 + g3438;
+  g4042 = g4512 + g2024;
+  g4043 = g3482 + g2366;
+  g4044 = g2042 + g1035;
+  g4045 = g731 + g3940;
+  g4046 = g959 + g3170;
+  g4047 = g3250 + g3731;
+  g4048 = g3858 + g564;
+  g4049 = g1776 + g3792;
+  return g4040;
+}
+
+long u405() {
+  g4050 = g4299 + g4795;
+  g4051 = g4849 + g1863;
+  g4052 = g1473 + g4052;
+  g4053 = g4505 + g1080;
+  g4054 = g702 + g605;
+  g4055 = g4077 + g3923;
+  g4056 = g3121 + g2852;
+  g4057 = g3345 + g804;
+  g4058 = g542 + g1787;
+  g4059 = g4180 + g2701;
+  return g4050;
+}
+
+long u406() {
+  g4060 = g3472 + g3176;
+  g4061 = g4429 + g2798;
+  g4062 = g1027 + g1467;
+  g4063 = g2474 + g55;
+  g4064 = g1811 + g1352;
+  g4065 = g825 + g901;
+  g4066 = g2205 + g2731;
+  g4067 = g85 + g4093;
+  g4068 = g2234 + g2030;
+  g4069 = g367 + g2965;
+  return g4060;
+}
+
+long u407() {
+  g4070 = g1417 + g2362;
+  g4071 = g1220 + g519;
+  g4072 = g347 + g347;
+  g4073 = g3715 + g2912;
+  g4074 = g244 + g4508;
+  g4075 = g4480 + g500;
+  g4076 = g292 + g3560;
+  g4077 = g855 + g2013;
+  g4078 = g1355 + g4671;
+  g4079 = g763 + g1253;
+  return g4070;
+}
+
+long u408() {
+  g4080 = g945 + g3163;
+  g4081 = g2097 + g475;
+  g4082 = g3167 + g3142;
+  g4083 = g1144 + g3542;
+  g4084 = g1003 + g3200;
+  g4085 = g1555 + g3950;
+  g4086 = g2074 + g411;
+  g4087 = g2769 + g434;
+  g4088 = g102 + g767;
+  g4089 = g3401 + g4667;
+  return g4080;
+}
+
+long u409() {
+  g4090 = g1318 + g3104;
+  g4091 = g1619 + g2974;
+  g4092 = g2131 + g958;
+  g4093 = g2633 + g860;
+  g4094 = g2591 + g4417;
+  g4095 = g3259 + g2354;
+  g4096 = g2079 + g1733;
+  g4097 = g3637 + g338;
+  g4098 = g3631 + g157;
+  g4099 = g3306 + g1867;
+  return g4090;
+}
+
+long u410() {
+  g4100 = g2930 + g887;
+  g4101 = g2858 + g684;
+  g4102 = g3633 + g701;
+  g4103 = g2526 + g1930;
+  g4104 = g2098 + g4719;
+  g4105 = g1001 + g2291;
+  g4106 = g1786 + g3712;
+  g4107 = g341 + g2761;
+  g4108 = g2294 + g1339;
+  g4109 = g3554 + g1406;
+  return g4100;
+}
+
+long u411() {
+  g4110 = g878 + g676;
+  g4111 = g2684 + g241;
+  g4112 = g2400 + g4303;
+  g4113 = g4752 + g463;
+  g4114 = g452 + g3896;
+  g4115 = g76 + g2511;
+  g4116 = g3080 + g1246;
+  g4117 = g2005 + g223;
+  g4118 = g2652 + g3735;
+  g4119 = g220 + g1528;
+  return g4110;
+}
+
+long u412() {
+  g4120 = g4195 + g1847;
+  g4121 = g4745 + g4961;
+  g4122 = g2680 + g3413;
+  g4123 = g4305 + g859;
+  g4124 = g183 + g1656;
+  g4125 = g285 + g3182;
+  g4126 = g4120 + g4195;
+  g4127 = g547 + g3294;
+  g4128 = g249 + g3303;
+  g4129 = g2469 + g413;
+  return g4120;
+}
+
+long u413() {
+  g4130 = g3554 + g1403;
+  g4131 = g2396 + g4534;
+  g4132 = g2257 + g239;
+  g4133 = g1785 + g1687;
+  g4134 = g728 + g1455;
+  g4135 = g2210 + g4517;
+  g4136 = g2313 + g3287;
+  g4137 = g3240 + g3784;
+  g4138 = g2957 + g3488;
+  g4139 = g1235 + g292;
+  return g4130;
+}
+
+long u414() {
+  g4140 = g1330 + g1345;
+  g4141 = g1953 + g2618;
+  g4142 = g1574 + g551;
+  g4143 = g4433 + g1180;
+  g4144 = g2500 + g4457;
+  g4145 = g4437 + g2166;
+  g4146 = g3821 + g2682;
+  g4147 = g146 + g1098;
+  g4148 = g932 + g4148;
+  g4149 = g1702 + g943;
+  return g4140;
+}
+
+long u415() {
+  g4150 = g1754 + g1118;
+  g4151 = g1264 + g1229;
+  g4152 = g4542 + g3937;
+  g4153 = g3704 + g3776;
+  g4154 = g4660 + g750;
+  g4155 = g2130 + g4500;
+  g4156 = g3904 + g4859;
+  g4157 = g3004 + g1574;
+  g4158 = g3005 + g2254;
+  g4159 = g1688 + g1659;
+  return g4150;
+}
+
+long u416() {
+  g4160 = g2068 + g3739;
+  g4161 = g2530 + g2389;
+  g4162 = g1546 + g4317;
+  g4163 = g1157 + g117;
+  g4164 = g504 + g596;
+  g4165 = g751 + g1756;
+  g4166 = g4575 + g2668;
+  g4167 = g242 + g2810;
+  g4168 = g4625 + g3083;
+  g4169 = g2308 + g3214;
+  return g4160;
+}
+
+long u417() {
+  g4170 = g1507 + g794;
+  g4171 = g4088 + g1619;
+  g4172 = g2345 + g945;
+  g4173 = g119 + g2917;
+  g4174 = g2225 + g2808;
+  g4175 = g2118 + g2437;
+  g4176 = g4771 + g4165;
+  g4177 = g4192 + g3430;
+  g4178 = g3035 + g1091;
+  g4179 = g3423 + g187;
+  return g4170;
+}
+
+long u418() {
+  g4180 = g1319 + g2367;
+  g4181 = g107 + g2741;
+  g4182 = g3871 + g641;
+  g4183 = g4971 + g2007;
+  g4184 = g1185 + g838;
+  g4185 = g3542 + g4475;
+  g4186 = g4291 + g3720;
+  g4187 = g3671 + g4921;
+  g4188 = g3807 + g154;
+  g4189 = g2279 + g2892;
+  return g4180;
+}
+
+long u419() {
+  g4190 = g792 + g3279;
+  g4191 = g4386 + g1959;
+  g4192 = g4841 + g3318;
+  g4193 = g4405 + g2639;
+  g4194 = g3207 + g3547;
+  g4195 = g2342 + g4236;
+  g4196 = g2253 + g2191;
+  g4197 = g4490 + g959;
+  g4198 = g2035 + g2324;
+  g4199 = g4636 + g2736;
+  return g4190;
+}
+
+long u420() {
+  g4200 = g4661 + g3273;
+  g4201 = g4658 + g2024;
+  g4202 = g1002 + g1964;
+  g4203 = g3823 + g2583;
+  g4204 = g318 + g4584;
+  g4205 = g708 + g1901;
+  g4206 = g184 + g4916;
+  g4207 = g1867 + g1325;
+  g4208 = g595 + g4658;
+  g4209 = g2018 + g466;
+  return g4200;
+}
+
+long u421() {
+  g4210 = g2444 + g1815;
+  g4211 = g1836 + g3640;
+  g4212 = g835 + g2894;
+  g4213 = g2062 + g317;
+  g4214 = g2314 + g1813;
+  g4215 = g4596 + g3274;
+  g4216 = g2727 + g841;
+  g4217 = g3915 + g2062;
+  g4218 = g2769 + g3731;
+  g4219 = g1480 + g4562;
+  return g4210;
+}
+
+long u422() {
+  g4220 = g2170 + g1368;
+  g4221 = g4020 + g3696;
+  g4222 = g2034 + g4821;
+  g4223 = g3812 + g2727;
+  g4224 = g473 + g996;
+  g4225 = g3367 + g381;
+  g4226 = g3641 + g425;
+  g4227 = g3519 + g4197;
+  g4228 = g3400 + g2373;
+  g4229 = g1750 + g4015;
+  return g4220;
+}
+
+long u423() {
+  g4230 = g671 + g2394;
+  g4231 = g2342 + g2476;
+  g4232 = g4480 + g3453;
+  g4233 = g3869 + g4461;
+  g4234 = g2562 + g2142;
+  g4235 = g361 + g2954;
+  g4236 = g2423 + g1140;
+  g4237 = g2243 + g3974;
+  g4238 = g3195 + g1143;
+  g4239 = g641 + g3127;
+  return g4230;
+}
+
+long u424() {
+  g4240 = g1786 + g481;
+  g4241 = g829 + g2994;
+  g4242 = g75 + g3047;
+  g4243 = g2508 + g448;
+  g4244 = g2255 + g4012;
+  g4245 = g4254 + g821;
+  g4246 = g914 + g2695;
+  g4247 = g3577 + g2466;
+  g4248 = g3674 + g4570;
+  g4249 = g3921 + g2161;
+  return g4240;
+}
+
+long u425() {
+  g4250 = g3468 + g1975;
+  g4251 = g4739 + g3745;
+  g4252 = g193 + g3095;
+  g4253 = g1861 + g3019;
+  g4254 = g4323 + g3375;
+  g4255 = g1707 + g972;
+  g4256 = g407 + g3826;
+  g4257 = g601 + g4986;
+  g4258 = g4698 + g3050;
+  g4259 = g2119 + g4666;
+  return g4250;
+}
+
+long u426() {
+  g4260 = g4237 + g2693;
+  g4261 = g933 + g2872;
+  g4262 = g3692 + g3890;
+  g4263 = g4187 + g3964;
+  g4264 = g3701 + g2277;
+  g4265 = g4842 + g1912;
+  g4266 = g4334 + g1424;
+  g4267 = g918 + g1187;
+  g4268 = g4782 + g2790;
+  g4269 = g38 + g4211;
+  return g4260;
+}
+
+long u427() {
+  g4270 = g4880 + g1665;
+  g4271 = g3951 + g2048;
+  g4272 = g3172 + g2824;
+  g4273 = g3476 + g3695;
+  g4274 = g2706 + g3586;
+  g4275 = g2181 + g996;
+  g4276 = g3822 + g4380;
+  g4277 = g4276 + g251;
+  g4278 = g115 + g4263;
+  g4279 = g2635 + g2038;
+  return g4270;
+}
+
+long u428() {
+  g4280 = g4044 + g1986;
+  g4281 = g3064 + g2226;
+  g4282 = g3529 + g2190;
+  g4283 = g383 + g1745;
+  g4284 = g3824 + g4408;
+  g4285 = g3370 + g2590;
+  g4286 = g629 + g3686;
+  g4287 = g2464 + g582;
+  g4288 = g2531 + g1170;
+  g4289 = g920 + g4257;
+  return g4280;
+}
+
+long u429() {
+  g4290 = g4160 + g4994;
+  g4291 = g1506 + g785;
+  g4292 = g253 + g2618;
+  g4293 = g1938 + g4922;
+  g4294 = g1944 + g897;
+  g4295 = g2150 + g3830;
+  g4296 = g1100 + g3260;
+  g4297 = g3793 + g1487;
+  g4298 = g840 + g933;
+  g4299 = g566 + g4424;
+  return g4290;
+}
+
+long u430() {
+  g4300 = g2010 + g4178;
+  g4301 = g2537 + g2539;
+  g4302 = g1512 + g2792;
+  g4303 = g2145 + g2903;
+  g4304 = g1886 + g1982;
+  g4305 = g3369 + g2601;
+  g4306 = g1063 + g2001;
+  g4307 = g1423 + g1715;
+  g4308 = g3788 + g4657;
+  g4309 = g424 + g477;
+  return g4300;
+}
+
+long u431() {
+  g4310 = g654 + g1139;
+  g4311 = g4077 + g400;
+  g4312 = g2990 + g3181;
+  g4313 = g2531 + g1177;
+  g4314 = g777 + g2738;
+  g4315 = g2431 + g2026;
+  g4316 = g2118 + g1058;
+  g4317 = g1893 + g4770;
+  g4318 = g1283 + g1323;
+  g4319 = g1908 + g3148;
+  return g4310;
+}
+
+long u432() {
+  g4320 = g244 + g4766;
+  g4321 = g151 + g133;
+  g4322 = g1775 + g3576;
+  g4323 = g4773 + g2687;
+  g4324 = g4172 + g2578;
+  g4325 = g1648 + g1721;
+  g4326 = g2345 + g1957;
+  g4327 = g3273 + g2951;
+  g4328 = g1535 + g1052;
+  g4329 = g4798 + g3597;
+  return g4320;
+}
+
+long u433() {
+  g4330 = g982 + g4320;
+  g4331 = g3772 + g3387;
+  g4332 = g1795 + g1960;
+  g4333 = g4302 + g2339;
+  g4334 = g1421 + g2013;
+  g4335 = g2811 + g4895;
+  g4336 = g2293 + g713;
+  g4337 = g1153 + g100;
+  g4338 = g1776 + g686;
+  g4339 = g4541 + g4271;
+  return g4330;
+}
+
+long u434() {
+  g4340 = g892 + g2228;
+  g4341 = g2222 + g3440;
+  g4342 = g4354 + g460;
+  g4343 = g2576 + g1257;
+  g4344 = g4770 + g3317;
+  g4345 = g468 + g2957;
+  g4346 = g2382 + g1262;
+  g4347 = g3687 + g3788;
+  g4348 = g4936 + g871;
+  g4349 = g1727 + g3959;
+  return g4340;
+}
+
+long u435() {
+  g4350 = g2717 + g244;
+  g4351 = g2357 + g284;
+  g4352 = g2748 + g2798;
+  g4353 = g4552 + g2761;
+  g4354 = g1223 + g1834;
+  g4355 = g856 + g2327;
+  g4356 = g3663 + g230;
+  g4357 = g1268 + g2395;
+  g4358 = g1167 + g3182;
+  g4359 = g2476 + g3152;
+  return g4350;
+}
+
+long u436() {
+  g4360 = g399 + g3870;
+  g4361 = g3210 + g3515;
+  g4362 = g2455 + g1781;
+  g4363 = g4967 + g424;
+  g4364 = g2920 + g1827;
+  g4365 = g1155 + g4294;
+  g4366 = g4822 + g608;
+  g4367 = g857 + g2826;
+  g4368 = g76 + g3316;
+  g4369 = g3423 + g3862;
+  return g4360;
+}
+
+long u437() {
+  g4370 = g1765 + g3486;
+  g4371 = g4476 + g4355;
+  g4372 = g578 + g3150;
+  g4373 = g2711 + g3235;
+  g4374 = g2316 + g780;
+  g4375 = g1987 + g2304;
+  g4376 = g1167 + g4876;
+  g4377 = g3056 + g1045;
+  g4378 = g2364 + g1752;
+  g4379 = g3126 + g2035;
+  return g4370;
+}
+
+long u438() {
+  g4380 = g539 + g578;
+  g4381 = g476 + g4503;
+  g4382 = g358 + g2201;
+  g4383 = g275 + g3278;
+  g4384 = g1666 + g570;
+  g4385 = g2145 + g265;
+  g4386 = g2561 + g2264;
+  g4387 = g3424 + g1643;
+  g4388 = g2243 + g1363;
+  g4389 = g346 + g3407;
+  return g4380;
+}
+
+long u439() {
+  g4390 = g2610 + g4107;
+  g4391 = g2300 + g601;
+  g4392 = g2156 + g1940;
+  g4393 = g4316 + g3891;
+  g4394 = g1258 + g4576;
+  g4395 = g4951 + g661;
+  g4396 = g368 + g4522;
+  g4397 = g3357 + g4242;
+  g4398 = g2924 + g3815;
+  g4399 = g2139 + g1766;
+  return g4390;
+}
+
+long u440() {
+  g4400 = g1654 + g4451;
+  g4401 = g4696 + g4651;
+  g4402 = g4752 + g4556;
+  g4403 = g1502 + g4776;
+  g4404 = g3247 + g303;
+  g4405 = g144 + g4699;
+  g4406 = g4285 + g4998;
+  g4407 = g4724 + g762;
+  g4408 = g1880 + g2001;
+  g4409 = g954 + g592;
+  return g4400;
+}
+
+long u441() {
+  g4410 = g783 + g4757;
+  g4411 = g2790 + g4441;
+  g4412 = g4019 + g2531;
+  g4413 = g3263 + g1195;
+  g4414 = g458 + g4395;
+  g4415 = g1793 + g1397;
+  g4416 = g2325 + g1691;
+  g4417 = g3488 + g2920;
+  g4418 = g4568 + g3403;
+  g4419 = g672 + g1017;
+  return g4410;
+}
+
+long u442() {
+  g4420 = g14 + g2775;
+  g4421 = g66 + g972;
+  g4422 = g3143 + g3975;
+  g4423 = g3671 + g1122;
+  g4424 = g2407 + g4182;
+  g4425 = g4253 + g1277;
+  g4426 = g770 + g2074;
+  g4427 = g3310 + g2456;
+  g4428 = g1681 + g2452;
+  g4429 = g3338 + g2373;
+  return g4420;
+}
+
+long u443() {
+  g4430 = g3796 + g4746;
+  g4431 = g4577 + g2492;
+  g4432 = g2511 + g3385;
+  g4433 = g1651 + g1522;
+  g4434 = g1845 + g3966;
+  g4435 = g1284 + g3243;
+  g4436 = g231 + g316;
+  g4437 = g51 + g3088;
+  g4438 = g1719 + g1862;
+  g4439 = g854 + g3139;
+  return g4430;
+}
+
+long u444() {
+  g4440 = g2443 + g2725;
+  g4441 = g2031 + g680;
+  g4442 = g4887 + g4452;
+  g4443 = g140 + g4615;
+  g4444 = g2710 + g2974;
+  g4445 = g3789 + g3172;
+  g4446 = g178 + g373;
+  g4447 = g187 + g2830;
+  g4448 = g2316 + g1605;
+  g4449 = g1593 + g1171;
+  return g4440;
+}
+
+long u445() {
+  g4450 = g3911 + g4958;
+  g4451 = g2257 + g2120;
+  g4452 = g2370 + g3620;
+  g4453 = g1919 + g3262;
+  g4454 = g2393 + g2499;
+  g4455 = g3337 + g4853;
+  g4456 = g3456 + g2523;
+  g4457 = g813 + g3685;
+  g4458 = g219 + g3696;
+  g4459 = g2492 + g2173;
+  return g4450;
+}
+
+long u446() {
+  g4460 = g4626 + g3639;
+  g4461 = g3678 + g589;
+  g4462 = g3330 + g2385;
+  g4463 = g386 + g3086;
+  g4464 = g3649 + g3288;
+  g4465 = g4572 + g1976;
+  g4466 = g679 + g884;
+  g4467 = g4589 + g1409;
+  g4468 = g1539 + g3077;
+  g4469 = g918 + g2168;
+  return g4460;
+}
+
+long u447() {
+  g4470 = g1085 + g226;
+  g4471 = g294 + g1349;
+  g4472 = g736 + g4997;
+  g4473 = g20 + g2482;
+  g4474 = g523 + g2413;
+  g4475 = g1647 + g757;
+  g4476 = g2974 + g1734;
+  g4477 = g1440 + g2909;
+  g4478 = g1874 + g1218;
+  g4479 = g3762 + g488;
+  return g4470;
+}
+
+long u448() {
+  g4480 = g1790 + g446;
+  g4481 = g3596 + g163;
+  g4482 = g485 + g3852;
+  g4483 = g1015 + g3754;
+  g4484 = g1908 + g4506;
+  g4485 = g4299 + g1334;
+  g4486 = g4784 + g4222;
+  g4487 = g2677 + g439;
+  g4488 = g2509 + g4120;
+  g4489 = g2966 + g4586;
+  return g4480;
+}
+
+long u449() {
+  g4490 = g985 + g3940;
+  g4491 = g1744 + g4110;
+  g4492 = g4991 + g4657;
+  g4493 = g2044 + g310;
+  g4494 = g636 + g1000;
+  g4495 = g1531 + g4366;
+  g4496 = g359 + g4729;
+  g4497 = g1171 + g4267;
+  g4498 = g2583 + g309;
+  g4499 = g864 + g2621;
+  return g4490;
+}
+
+long u450() {
+  g4500 = g4117 + g4118;
+  g4501 = g4789 + g2129;
+  g4502 = g2979 + g2711;
+  g4503 = g4093 + g3735;
+  g4504 = g639 + g3880;
+  g4505 = g1704 + g1319;
+  g4506 = g4974 + g1586;
+  g4507 = g4729 + g3304;
+  g4508 = g3639 + g4278;
+  g4509 = g2896 + g1309;
+  return g4500;
+}
+
+long u451() {
+  g4510 = g174 + g4231;
+  g4511 = g990 + g1708;
+  g4512 = g1160 + g2508;
+  g4513 = g4455 + g4511;
+  g4514 = g1720 + g1674;
+  g4515 = g3454 + g4594;
+  g4516 = g654 + g631;
+  g4517 = g4930 + g2057;
+  g4518 = g1282 + g4625;
+  g4519 = g235 + g2039;
+  return g4510;
+}
+
+long u452() {
+  g4520 = g3087 + g1476;
+  g4521 = g731 + g2089;
+  g4522 = g3092 + g1840;
+  g4523 = g3406 + g4612;
+  g4524 = g2623 + g189;
+  g4525 = g455 + g974;
+  g4526 = g2084 + g4481;
+  g4527 = g1575 + g3125;
+  g4528 = g1507 + g2644;
+  g4529 = g880 + g2505;
+  return g4520;
+}
+
+long u453() {
+  g4530 = g1356 + g1442;
+  g4531 = g81 + g831;
+  g4532 = g1222 + g2436;
+  g4533 = g4743 + g2426;
+  g4534 = g4187 + g318;
+  g4535 = g2851 + g495;
+  g4536 = g3655 + g3723;
+  g4537 = g4632 + g606;
+  g4538 = g1756 + g4581;
+  g4539 = g2118 + g2795;
+  return g4530;
+}
+
+long u454() {
+  g4540 = g540 + g3889;
+  g4541 = g3969 + g1216;
+  g4542 = g944 + g1497;
+  g4543 = g4952 + g494;
+  g4544 = g3849 + g4897;
+  g4545 = g1866 + g1832;
+  g4546 = g4874 + g709;
+  g4547 = g687 + g4206;
+  g4548 = g2909 + g632;
+  g4549 = g1751 + g4071;
+  return g4540;
+}
+
+long u455() {
+  g4550 = g794 + g301;
+  g4551 = g3147 + g2117;
+  g4552 = g1123 + g3898;
+  g4553 = g2798 + g4289;
+  g4554 = g780 + g1615;
+  g4555 = g2651 + g3829;
+  g4556 = g4989 + g3625;
+  g4557 = g2035 + g1723;
+  g4558 = g2427 + g4360;
+  g4559 = g2313 + g4537;
+  return g4550;
+}
+
+long u456() {
+  g4560 = g4942 + g4103;
+  g4561 = g2018 + g4097;
+  g4562 = g4680 + g4662;
+  g4563 = g413 + g4416;
+  g4564 = g632 + g2217;
+  g4565 = g3608 + g4521;
+  g4566 = g1849 + g2806;
+  g4567 = g2536 + g351;
+  g4568 = g2293 + g1665;
+  g4569 = g2100 + g4266;
+  return g4560;
+}
+
+long u457() {
+  g4570 = g2778 + g249;
+  g4571 = g3533 + g1743;
+  g4572 = g3848 + g4703;
+  g4573 = g1020 + g1206;
+  g4574 = g2430 + g2921;
+  g4575 = g3435 + g1555;
+  g4576 = g3454 + g4664;
+  g4577 = g1519 + g4517;
+  g4578 = g1391 + g4507;
+  g4579 = g4909 + g4142;
+  return g4570;
+}
+
+long u458() {
+  g4580 = g2370 + g2476;
+  g4581 = g632 + g806;
+  g4582 = g898 + g4503;
+  g4583 = g4875 + g125;
+  g4584 = g4800 + g3342;
+  g4585 = g626 + g2047;
+  g4586 = g531 + g4595;
+  g4587 = g3784 + g3942;
+  g4588 = g3744 + g845;
+  g4589 = g4423 + g2939;
+  return g4580;
+}
+
+long u459() {
+  g4590 = g2309 + g2795;
+  g4591 = g4897 + g3614;
+  g4592 = g1354 + g2442;
+  g4593 = g290 + g4447;
+  g4594 = g1975 + g939;
+  g4595 = g507 + g3346;
+  g4596 = g4936 + g4858;
+  g4597 = g4706 + g527;
+  g4598 = g2763 + g4442;
+  g4599 = g512 + g3725;
+  return g4590;
+}
+
+long u460() {
+  g4600 = g1096 + g541;
+  g4601 = g27 + g391;
+  g4602 = g3631 + g1516;
+  g4603 = g4624 + g4531;
+  g4604 = g165 + g66;
+  g4605 = g1669 + g3819;
+  g4606 = g589 + g340;
+  g4607 = g4126 + g3210;
+  g4608 = g1964 + g3227;
+  g4609 = g1668 + g3471;
+  return g4600;
+}
+
+long u461() {
+  g4610 = g97 + g646;
+  g4611 = g1540 + g3942;
+  g4612 = g1217 + g1109;
+  g4613 = g593 + g1645;
+  g4614 = g1592 + g1673;
+  g4615 = g2056 + g2267;
+  g4616 = g2492 + g1394;
+  g4617 = g3389 + g378;
+  g4618 = g4845 + g3164;
+  g4619 = g336 + g4416;
+  return g4610;
+}
+
+long u462() {
+  g4620 = g273 + g3045;
+  g4621 = g637 + g2900;
+  g4622 = g1742 + g1488;
+  g4623 = g15 + g3888;
+  g4624 = g1575 + g138;
+  g4625 = g1601 + g4323;
+  g4626 = g710 + g1679;
+  g4627 = g94 + g2874;
+  g4628 = g2778 + g94;
+  g4629 = g4322 + g2777;
+  return g4620;
+}
+
+long u463() {
+  g4630 = g4314 + g252;
+  g4631 = g4705 + g2821;
+  g4632 = g1046 + g1394;
+  g4633 = g1584 + g3369;
+  g4634 = g419 + g1466;
+  g4635 = g1107 + g4167;
+  g4636 = g1790 + g519;
+  g4637 = g4750 + g1912;
+  g4638 = g4630 + g4165;
+  g4639 = g2105 + g1062;
+  return g4630;
+}
+
+long u464() {
+  g4640 = g1303 + g3540;
+  g4641 = g2309 + g4718;
+  g4642 = g3687 + g2638;
+  g4643 = g3445 + g2958;
+  g4644 = g4065 + g1983;
+  g4645 = g4154 + g212;
+  g4646 = g2064 + g4227;
+  g4647 = g1190 + g231;
+  g4648 = g3605 + g1842;
+  g4649 = g2674 + g1944;
+  return g4640;
+}
+
+long u465() {
+  g4650 = g3967 + g631;
+  g4651 = g2936 + g3045;
+  g4652 = g1303 + g136;
+  g4653 = g2599 + g3573;
+  g4654 = g4047 + g4127;
+  g4655 = g3778 + g4070;
+  g4656 = g3909 + g4715;
+  g4657 = g3658 + g2995;
+  g4658 = g3299 + g2878;
+  g4659 = g2212 + g2361;
+  return g4650;
+}
+
+long u466() {
+  g4660 = g427 + g3111;
+  g4661 = g4754 + g807;
+  g4662 = g4884 + g4760;
+  g4663 = g4044 + g3697;
+  g4664 = g340 + g1025;
+  g4665 = g1025 + g4998;
+  g4666 = g4936 + g1955;
+  g4667 = g3661 + g4989;
+  g4668 = g3994 + g2430;
+  g4669 = g3214 + g871;
+  return g4660;
+}
+
+long u467() {
+  g4670 = g2146 + g3262;
+  g4671 = g4848 + g2674;
+  g4672 = g2749 + g114;
+  g4673 = g4195 + g4956;
+  g4674 = g440 + g756;
+  g4675 = g2114 + g2921;
+  g4676 = g4262 + g3468;
+  g4677 = g1527 + g4153;
+  g4678 = g4926 + g529;
+  g4679 = g3718 + g1306;
+  return g4670;
+}
+
+long u468() {
+  g4680 = g2295 + g2157;
+  g4681 = g1264 + g1872;
+  g4682 = g440 + g2595;
+  g4683 = g664 + g1772;
+  g4684 = g1290 + g2528;
+  g4685 = g4903 + g619;
+  g4686 = g310 + g2970;
+  g4687 = g1638 + g1889;
+  g4688 = g1958 + g2577;
+  g4689 = g4430 + g1118;
+  return g4680;
+}
+
+long u469() {
+  g4690 = g2215 + g3288;
+  g4691 = g445 + g3158;
+  g4692 = g2228 + g3140;
+  g4693 = g2418 + g2465;
+  g4694 = g3680 + g3420;
+  g4695 = g1548 + g3746;
+  g4696 = g1936 + g4987;
+  g4697 = g1713 + g1600;
+  g4698 = g3683 + g2334;
+  g4699 = g3864 + g239;
+  return g4690;
+}
+
+long u470() {
+  g4700 = g4142 + g1380;
+  g4701 = g1216 + g2739;
+  g4702 = g2621 + g250;
+  g4703 = g2257 + g2396;
+  g4704 = g872 + g2132;
+  g4705 = g506 + g4063;
+  g4706 = g1375 + g2037;
+  g4707 = g3384 + g3004;
+  g4708 = g1328 + g3959;
+  g4709 = g946 + g2516;
+  return g4700;
+}
+
+long u471() {
+  g4710 = g4719 + g109;
+  g4711 = g2587 + g536;
+  g4712 = g1496 + g2723;
+  g4713 = g1179 + g2184;
+  g4714 = g3465 + g2306;
+  g4715 = g4644 + g321;
+  g4716 = g49 + g1011;
+  g4717 = g353 + g1701;
+  g4718 = g2727 + g1681;
+  g4719 = g1814 + g3891;
+  return g4710;
+}
+
+long u472() {
+  g4720 = g2024 + g639;
+  g4721 = g4561 + g1689;
+  g4722 = g4819 + g3645;
+  g4723 = g1283 + g599;
+  g4724 = g1947 + g4245;
+  g4725 = g732 + g1222;
+  g4726 = g847 + g3086;
+  g4727 = g4760 + g429;
+  g4728 = g653 + g4775;
+  g4729 = g659 + g591;
+  return g4720;
+}
+
+long u473() {
+  g4730 = g2456 + g1150;
+  g4731 = g2768 + g134;
+  g4732 = g3663 + g566;
+  g4733 = g3474 + g3022;
+  g4734 = g1746 + g3038;
+  g4735 = g1605 + g2988;
+  g4736 = g2717 + g2274;
+  g4737 = g2140 + g3546;
+  g4738 = g669 + g1445;
+  g4739 = g1432 + g1859;
+  return g4730;
+}
+
+long u474() {
+  g4740 = g3281 + g2038;
+  g4741 = g119 + g685;
+  g4742 = g2523 + g1470;
+  g4743 = g3898 + g509;
+  g4744 = g4460 + g2476;
+  g4745 = g1859 + g3512;
+  g4746 = g3692 + g3580;
+  g4747 = g865 + g888;
+  g4748 = g2387 + g2879;
+  g4749 = g1250 + g3761;
+  return g4740;
+}
+
+long u475() {
+  g4750 = g4900 + g936;
+  g4751 = g2902 + g1834;
+  g4752 = g3068 + g3967;
+  g4753 = g1735 + g405;
+  g4754 = g4541 + g900;
+  g4755 = g4403 + g3120;
+  g4756 = g903 + g3751;
+  g4757 = g2489 + g5;
+  g4758 = g1009 + g476;
+  g4759 = g1439 + g2713;
+  return g4750;
+}
+
+long u476() {
+  g4760 = g152 + g2516;
+  g4761 = g2728 + g445;
+  g4762 = g471 + g4283;
+  g4763 = g2307 + g1847;
+  g4764 = g64 + g40;
+  g4765 = g4171 + g3739;
+  g4766 = g930 + g72;
+  g4767 = g4167 + g3244;
+  g4768 = g3926 + g4784;
+  g4769 = g3958 + g3036;
+  return g4760;
+}
+
+long u477() {
+  g4770 = g686 + g2648;
+  g4771 = g1931 + g210;
+  g4772 = g2999 + g4474;
+  g4773 = g2531 + g3908;
+  g4774 = g3795 + g1175;
+  g4775 = g746 + g2075;
+  g4776 = g1439 + g526;
+  g4777 = g4415 + g4205;
+  g4778 = g3605 + g781;
+  g4779 = g1343 + g2378;
+  return g4770;
+}
+
+long u478() {
+  g4780 = g4372 + g2866;
+  g4781 = g188 + g871;
+  g4782 = g381 + g179;
+  g4783 = g3268 + g862;
+  g4784 = g4167 + g3569;
+  g4785 = g2132 + g1511;
+  g4786 = g240 + g3394;
+  g4787 = g1980 + g3505;
+  g4788 = g4453 + g1657;
+  g4789 = g2566 + g310;
+  return g4780;
+}
+
+long u479() {
+  g4790 = g3332 + g1520;
+  g4791 = g4215 + g438;
+  g4792 = g4013 + g4680;
+  g4793 = g46 + g4761;
+  g4794 = g4304 + g2866;
+  g4795 = g4596 + g1303;
+  g4796 = g704 + g4797;
+  g4797 = g4066 + g981;
+  g4798 = g1531 + g3581;
+  g4799 = g4837 + g1728;
+  return g4790;
+}
+
+long u480() {
+  g4800 = g1647 + g1707;
+  g4801 = g469 + g1216;
+  g4802 = g602 + g4519;
+  g4803 = g1143 + g1626;
+  g4804 = g941 + g3330;
+  g4805 = g3091 + g3911;
+  g4806 = g2696 + g4634;
+  g4807 = g73 + g419;
+  g4808 = g285 + g62;
+  g4809 = g1535 + g3632;
+  return g4800;
+}
+
+long u481() {
+  g4810 = g4721 + g1360;
+  g4811 = g3912 + g4550;
+  g4812 = g2790 + g4938;
+  g4813 = g3479 + g2572;
+  g4814 = g3125 + g2240;
+  g4815 = g2425 + g31;
+  g4816 = g1857 + g3559;
+  g4817 = g1109 + g1641;
+  g4818 = g996 + g663;
+  g4819 = g1786 + g348;
+  return g4810;
+}
+
+long u482() {
+  g4820 = g2645 + g4245;
+  g4821 = g1148 + g2641;
+  g4822 = g1836 + g3171;
+  g4823 = g2036 + g2080;
+  g4824 = g71 + g2512;
+  g4825 = g2488 + g4302;
+  g4826 = g4222 + g3558;
+  g4827 = g589 + g2584;
+  g4828 = g2080 + g3959;
+  g4829 = g1413 + g4662;
+  return g4820;
+}
+
+long u483() {
+  g4830 = g2049 + g1479;
+  g4831 = g4961 + g1424;
+  g4832 = g1809 + g2767;
+  g4833 = g4413 + g4677;
+  g4834 = g3128 + g4017;
+  g4835 = g3116 + g1497;
+  g4836 = g4375 + g4187;
+  g4837 = g3563 + g647;
+  g4838 = g2808 + g1669;
+  g4839 = g632 + g2304;
+  return g4830;
+}
+
+long u484() {
+  g4840 = g3776 + g3378;
+  g4841 = g4331 + g3079;
+  g4842 = g759 + g1347;
+  g4843 = g2395 + g2642;
+  g4844 = g1795 + g1416;
+  g4845 = g2350 + g601;
+  g4846 = g4872 + g2252;
+  g4847 = g1347 + g1801;
+  g4848 = g200 + g3368;
+  g4849 = g4776 + g3990;
+  return g4840;
+}
+
+long u485() {
+  g4850 = g1737 + g954;
+  g4851 = g1210 + g3829;
+  g4852 = g1666 + g3009;
+  g4853 = g1785 + g4014;
+  g4854 = g353 + g4832;
+  g4855 = g2856 + g2660;
+  g4856 = g4066 + g367;
+  g4857 = g2034 + g2900;
+  g4858 = g4581 + g806;
+  g4859 = g2958 + g2211;
+  return g4850;
+}
+
+long u486() {
+  g4860 = g4797 + g2647;
+  g4861 = g566 + g4873;
+  g4862 = g3140 + g2789;
+  g4863 = g1219 + g3579;
+  g4864 = g2024 + g2615;
+  g4865 = g1149 + g767;
+  g4866 = g3001 + g4758;
+  g4867 = g1156 + g420;
+  g4868 = g2152 + g1563;
+  g4869 = g2597 + g2116;
+  return g4860;
+}
+
+long u487() {
+  g4870 = g2008 + g3955;
+  g4871 = g3930 + g1689;
+  g4872 = g2805 + g2892;
+  g4873 = g1836 + g450;
+  g4874 = g2937 + g3411;
+  g4875 = g334 + g3041;
+  g4876 = g2865 + g4608;
+  g4877 = g403 + g2083;
+  g4878 = g1430 + g3457;
+  g4879 = g3742 + g41;
+  return g4870;
+}
+
+long u488() {
+  g4880 = g890 + g4449;
+  g4881 = g3058 + g17;
+  g4882 = g2418 + g3295;
+  g4883 = g3634 + g4666;
+  g4884 = g2387 + g1629;
+  g4885 = g1399 + g3764;
+  g4886 = g3499 + g3082;
+  g4887 = g68 + g2207;
+  g4888 = g2913 + g2826;
+  g4889 = g3299 + g910;
+  return g4880;
+}
+
+long u489() {
+  g4890 = g4594 + g1976;
+  g4891 = g3920 + g2814;
+  g4892 = g1416 + g4670;
+  g4893 = g805 + g4490;
+  g4894 = g397 + g2075;
+  g4895 = g1157 + g3197;
+  g4896 = g3851 + g3700;
+  g4897 = g3700 + g3397;
+  g4898 = g3968 + g4296;
+  g4899 = g1355 + g590;
+  return g4890;
+}
+
+long u490() {
+  g4900 = g1700 + g614;
+  g4901 = g3563 + g2207;
+  g4902 = g3519 + g748;
+  g4903 = g895 + g1053;
+  g4904 = g989 + g4631;
+  g4905 = g605 + g4815;
+  g4906 = g1200 + g3761;
+  g4907 = g1614 + g3757;
+  g4908 = g4958 + g2748;
+  g4909 = g2529 + g3515;
+  return g4900;
+}
+
+long u491() {
+  g4910 = g2796 + g37;
+  g4911 = g69 + g2825;
+  g4912 = g3483 + g3169;
+  g4913 = g44 + g4712;
+  g4914 = g1106 + g2390;
+  g4915 = g2358 + g4045;
+  g4916 = g2963 + g3541;
+  g4917 = g1502 + g4686;
+  g4918 = g4996 + g3672;
+  g4919 = g4080 + g3237;
+  return g4910;
+}
+
+long u492() {
+  g4920 = g4917 + g2642;
+  g4921 = g4688 + g4874;
+  g4922 = g4868 + g1677;
+  g4923 = g1712 + g558;
+  g4924 = g4710 + g4979;
+  g4925 = g2043 + g3452;
+  g4926 = g1416 + g635;
+  g4927 = g3228 + g4105;
+  g4928 = g606 + g4217;
+  g4929 = g2376 + g769;
+  return g4920;
+}
+
+long u493() {
+  g4930 = g1097 + g4747;
+  g4931 = g1162 + g1602;
+  g4932 = g3443 + g3974;
+  g4933 = g4425 + g1734;
+  g4934 = g1639 + g999;
+  g4935 = g2815 + g3169;
+  g4936 = g1675 + g78;
+  g4937 = g4240 + g1384;
+  g4938 = g4377 + g2027;
+  g4939 = g1334 + g3822;
+  return g4930;
+}
+
+long u494() {
+  g4940 = g2517 + g894;
+  g4941 = g1955 + g3143;
+  g4942 = g3911 + g52;
+  g4943 = g4194 + g1384;
+  g4944 = g3122 + g3836;
+  g4945 = g1317 + g4170;
+  g4946 = g3742 + g3413;
+  g4947 = g2065 + g1813;
+  g4948 = g1448 + g2632;
+  g4949 = g1042 + g3497;
+  return g4940;
+}
+
+long u495() {
+  g4950 = g3720 + g1957;
+  g4951 = g3898 + g1056;
+  g4952 = g4632 + g345;
+  g4953 = g3112 + g798;
+  g4954 = g1732 + g1228;
+  g4955 = g3682 + g495;
+  g4956 = g4407 + g4956;
+  g4957 = g298 + g1322;
+  g4958 = g22 + g282;
+  g4959 = g4205 + g48;
+  return g4950;
+}
+
+long u496() {
+  g4960 = g1823 + g4869;
+  g4961 = g2706 + g2989;
+  g4962 = g2387 + g4852;
+  g4963 = g706 + g822;
+  g4964 = g1690 + g2767;
+  g4965 = g869 + g1204;
+  g4966 = g434 + g1565;
+  g4967 = g55 + g2055;
+  g4968 = g4720 + g3849;
+  g4969 = g1719 + g3162;
+  return g4960;
+}
+
+long u497() {
+  g4970 = g4753 + g4117;
+  g4971 = g207 + g2090;
+  g4972 = g3458 + g1900;
+  g4973 = g136 + g4231;
+  g4974 = g3598 + g1246;
+  g4975 = g2118 + g2259;
+  g4976 = g771 + g934;
+  g4977 = g1308 + g3103;
+  g4978 = g3709 + g965;
+  g4979 = g4181 + g4369;
+  return g4970;
+}
+
+long u498() {
+  g4980 = g3565 + g4799;
+  g4981 = g2243 + g3560;
+  g4982 = g749 + g436;
+  g4983 = g4521 + g2886;
+  g4984 = g277 + g856;
+  g4985 = g3530 + g2856;
+  g4986 = g3365 + g4121;
+  g4987 = g42 + g81;
+  g4988 = g4887 + g2665;
+  g4989 = g46 + g4295;
+  return g4980;
+}
+
+long u499() {
+  g4990 = g4656 + g245;
+  g4991 = g2701 + g201;
+  g4992 = g1569 + g2751;
+  g4993 = g3475 + g2499;
+  g4994 = g214 + g4526;
+  g4995 = g3048 + g344;
+  g4996 = g1832 + g4874;
+  g4997 = g2400 + g3239;
+  g4998 = g484 + g791;
+  g4999 = g2564 + g2926;
+  return g4990;
+}
+
+int main() {
+  printf("%ld\n", u0());
+  return 0;
+}
@@ -0,0 +1,42637 @@
+.intel_syntax noprefix
+.global g4999
+.global g4998
+.global g4997
+.global g4996
+.global g4995
+.global g4994
+.global g4993
+.global g4992
+.global g4991
+.global g4990
+.global g4989
+.global g4988
+.global g4987
+.global g4986
+.global g4985
+.global g4984
+.global g4983
+.global g4982
+.global g4981
+.global g4980
+.global g4979
+.global g4978
+.global g4977
+.global g4976
+.global g4975
+.global g4974
+.global g4973
+.global g4972
+.global g4971
+.global g4970
+.global g4969
+.global g4968
+.global g4967
+.global g4966
+.global g4965
+.global g4964
+.global g4963
+.global g4962
+.global g4961
+.global g4960
+.global g4959
+.global g4958
+.global g4957
+.global g4956
+.global g4955
+.global g4954
+.global g4953
+.global g4952
+.global g4951
+.global g4950
+.global g4949
+.global g4948
+.global g4947
+.global g4946
+.global g4945
+.global g4944
+.global g4943
+.global g4942
+.global g4941
+.global g4940
+.global g4939
+.global g4938
+.global g4937
+.global g4936
+.global g4935
+.global g4934
+.global g4933
+.global g4932
+.global g4931
+.global g4930
+.global g4929
+.global g4928
+.global g4927
+.global g4926
+.global g4925
+.global g4924
+.global g4923
+.global g4922
+.global g4921
+.global g4920
+.global g4919
+.global g4918
+.global g4917
+.global g4916
+.global g4915
+.global g4914
+.global g4913
+.global g4912
+.global g4911
+.global g4910
+.global g4909
+.global g4908
+.global g4907
+.global g4906
+.global g4905
+.global g4904
+.global g4903
+.global g4902
+.global g4901
+.global g4900
+.global g4899
+.global g4898
+.global g4897
+.global g4896
+.global g4895
+.global g4894
+.global g4893
+.global g4892
+.global g4891
+.global g4890
+.global g4889
+.global g4888
+.global g4887
+.global g4886
+.global g4885
+.global g4884
+.global g4883
+.global g4882
+.global g4881
+.global g4880
+.global g4879
+.global g4878
+.global g4877
+.global g4876
+.global g4875
+.global g4874
+.global g4873
+.global g4872
+.global g4871
+.global g4870
+.global g4869
+.global g4868
+.global g4867
+.global g4866
+.global g4865
+.global g4864
+.global g4863
+.global g4862
+.global g4861
+.global g4860
+.global g4859
+.global g4858
+.global g4857
+.global g4856
+.global g4855
+.global g4854
+.global g4853
+.global g4852
+.global g4851
+.global g4850
+.global g4849
+.global g4848
+.global g4847
+.global g4846
+.global g4845
+.global g4844
+.global g4843
+.global g4842
+.global g4841
+.global g4840
+.global g4839
+.global g4838
+.global g4837
+.global g4836
+.global g4835
+.global g4834
+.global g4833
+.global g4832
+.global g4831
+.global g4830
+.global g4829
+.global g4828
+.global g4827
+.global g4826
+.global g4825
+.global g4824
+.global g4823
+.global g4822
+.global g4821
+.global g4820
+.global g4819
+.global g4818
+.global g4817
+.global g4816
+.global g4815
+.global g4814
+.global g4813
+.global g4812
+.global g4811
+.global g4810
+.global g4809
+.global g4808
+.global g4807
+.global g4806
+.global g4805
+.global g4804
+.global g4803
+.global g4802
+.global g4801
+.global g4800
+.global g4799
+.global g4798
+.global g4797
+.global g4796
+.global g4795
+.global g4794
+.global g4793
+.global g4792
+.global g4791
+.global g4790
+.global g4789
+.global g4788
+.global g4787
+.global g4786
+.global g4785
+.global g4784
+.global g4783
+.global g4782
+.global g4781
+.global g4780
+.global g4779
+.global g4778
+.global g4777
+.global g4776
+.global g4775
+.global g4774
+.global g4773
+.global g4772
+.global g4771
+.global g4770
+.global g4769
+.global g4768
+.global g4767
+.global g4766
+.global g4765
+.global g4764
+.global g4763
+.global g4762
+.global g4761
+.global g4760
+.global g4759
+.global g4758
+.global g4757
+.global g4756
+.global g4755
+.global g4754
+.global g4753
+.global g4752
+.global g4751
+.global g4750
+.global g4749
+.global g4748
+.global g4747
+.global g4746
+.global g4745
+.global g4744
+.global g4743
+.global g4742
+.global g4741
+.global g4740
+.global g4739
+.global g4738
+.global g4737
+.global g4736
+.global g4735
+.global g4734
+.global g4733
+.global g4732
+.global g4731
+.global g4730
+.global g4729
+.global g4728
+.global g4727
+.global g4726
+.global g4725
+.global g4724
+.global g4723
+.global g4722
+.global g4721
+.global g4720
+.global g4719
+.global g4718
+.global g4717
+.global g4716
+.global g4715
+.global g4714
+.global g4713
+.global g4712
+.global g4711
+.global g4710
+.global g4709
+.global g4708
+.global g4707
+.global g4706
+.global g4705
+.global g4704
+.global g4703
+.global g4702
+.global g4701
+.global g4700
+.global g4699
+.global g4698
+.global g4697
+.global g4696
+.global g4695
+.global g4694
+.global g4693
+.global g4692
+.global g4691
+.global g4690
+.global g4689
+.global g4688
+.global g4687
+.global g4686
+.global g4685
+.global g4684
+.global g4683
+.global g4682
+.global g4681
+.global g4680
+.global g4679
+.global g4678
+.global g4677
+.global g4676
+.global g4675
+.global g4674
+.global g4673
+.global g4672
+.global g4671
+.global g4670
+.global g4669
+.global g4668
+.global g4667
+.global g4666
+.global g4665
+.global g4664
+.global g4663
+.global g4662
+.global g4661
+.global g4660
+.global g4659
+.global g4658
+.global g4657
+.global g4656
+.global g4655
+.global g4654
+.global g4653
+.global g4652
+.global g4651
+.global g4650
+.global g4649
+.global g4648
+.global g4647
+.global g4646
+.global g4645
+.global g4644
+.global g4643
+.global g4642
+.global g4641
+.global g4640
+.global g4639
+.global g4638
+.global g4637
+.global g4636
+.global g4635
+.global g4634
+.global g4633
+.global g4632
+.global g4631
+.global g4630
+.global g4629
+.global g4628
+.global g4627
+.global g4626
+.global g4625
+.global g4624
+.global g4623
+.global g4622
+.global g4621
+.global g4620
+.global g4619
+.global g4618
+.global g4617
+.global g4616
+.global g4615
+.global g4614
+.global g4613
+.global g4612
+.global g4611
+.global g4610
+.global g4609
+.global g4608
+.global g4607
+.global g4606
+.global g4605
+.global g4604
+.global g4603
+.global g4602
+.global g4601
+.global g4600
+.global g4599
+.global g4598
+.global g4597
+.global g4596
+.global g4595
+.global g4594
+.global g4593
+.global g4592
+.global g4591
+.global g4590
+.global g4589
+.global g4588
+.global g4587
+.global g4586
+.global g4585
+.global g4584
+.global g4583
+.global g4582
+.global g4581
+.global g4580
+.global g4579
+.global g4578
+.global g4577
+.global g4576
+.global g4575
+.global g4574
+.global g4573
+.global g4572
+.global g4571
+.global g4570
+.global g4569
+.global g4568
+.global g4567
+.global g4566
+.global g4565
+.global g4564
+.global g4563
+.global g4562
+.global g4561
+.global g4560
+.global g4559
+.global g4558
+.global g4557
+.global g4556
+.global g4555
+.global g4554
+.global g4553
+.global g4552
+.global g4551
+.global g4550
+.global g4549
+.global g4548
+.global g4547
+.global g4546
+.global g4545
+.global g4544
+.global g4543
+.global g4542
+.global g4541
+.global g4540
+.global g4539
+.global g4538
+.global g4537
+.global g4536
+.global g4535
+.global g4534
+.global g4533
+.global g4532
+.global g4531
+.global g4530
+.global g4529
+.global g4528
+.global g4527
+.global g4526
+.global g4525
+.global g4524
+.global g4523
+.global g4522
+.global g4521
+.global g4520
+.global g4519
+.global g4518
+.global g4517
+.global g4516
+.global g4515
+.global g4514
+.global g4513
+.global g4512
+.global g4511
+.global g4510
+.global g4509
+.global g4508
+.global g4507
+.global g4506
+.global g4505
+.global g4504
+.global g4503
+.global g4502
+.global g4501
+.global g4500
+.global g4499
+.global g4498
+.global g4497
+.global g4496
+.global g4495
+.global g4494
+.global g4493
+.global g4492
+.global g4491
+.global g4490
+.global g4489
+.global g4488
+.global g4487
+.global g4486
+.global g4485
+.global g4484
+.global g4483
+.global g4482
+.global g4481
+.global g4480
+.global g4479
+.global g4478
+.global g4477
+.global g4476
+.global g4475
+.global g4474
+.global g4473
+.global g4472
+.global g4471
+.global g4470
+.global g4469
+.global g4468
+.global g4467
+.global g4466
+.global g4465
+.global g4464
+.global g4463
+.global g4462
+.global g4461
+.global g4460
+.global g4459
+.global g4458
+.global g4457
+.global g4456
+.global g4455
+.global g4454
+.global g4453
+.global g4452
+.global g4451
+.global g4450
+.global g4449
+.global g4448
+.global g4447
+.global g4446
+.global g4445
+.global g4444
+.global g4443
+.global g4442
+.global g4441
+.global g4440
+.global g4439
+.global g4438
+.global g4437
+.global g4436
+.global g4435
+.global g4434
+.global g4433
+.global g4432
+.global g4431
+.global g4430
+.global g4429
+.global g4428
+.global g4427
+.global g4426
+.global g4425
+.global g4424
+.global g4423
+.global g4422
+.global g4421
+.global g4420
+.global g4419
+.global g4418
+.global g4417
+.global g4416
+.global g4415
+.global g4414
+.global g4413
+.global g4412
+.global g4411
+.global g4410
+.global g4409
+.global g4408
+.global g4407
+.global g4406
+.global g4405
+.global g4404
+.global g4403
+.global g4402
+.global g4401
+.global g4400
+.global g4399
+.global g4398
+.global g4397
+.global g4396
+.global g4395
+.global g4394
+.global g4393
+.global g4392
+.global g4391
+.global g4390
+.global g4389
+.global g4388
+.global g4387
+.global g4386
+.global g4385
+.global g4384
+.global g4383
+.global g4382
+.global g4381
+.global g4380
+.global g4379
+.global g4378
+.global g4377
+.global g4376
+.global g4375
+.global g4374
+.global g4373
+.global g4372
+.global g4371
+.global g4370
+.global g4369
+.global g4368
+.global g4367
+.global g4366
+.global g4365
+.global g4364
+.global g4363
+.global g4362
+.global g4361
+.global g4360
+.global g4359
+.global g4358
+.global g4357
+.global g4356
+.global g4355
+.global g4354
+.global g4353
+.global g4352
+.global g4351
+.global g4350
+.global g4349
+.global g4348
+.global g4347
+.global g4346
+.global g4345
+.global g4344
+.global g4343
+.global g4342
+.global g4341
+.global g4340
+.global g4339
+.global g4338
+.global g4337
+.global g4336
+.global g4335
+.global g4334
+.global g4333
+.global g4332
+.global g4331
+.global g4330
+.global g4329
+.global g4328
+.global g4327
+.global g4326
+.global g4325
+.global g4324
+.global g4323
+.global g4322
+.global g4321
+.global g4320
+.global g4319
+.global g4318
+.global g4317
+.global g4316
+.global g4315
+.global g4314
+.global g4313
+.global g4312
+.global g4311
+.global g4310
+.global g4309
+.global g4308
+.global g4307
+.global g4306
+.global g4305
+.global g4304
+.global g4303
+.global g4302
+.global g4301
+.global g4300
+.global g4299
+.global g4298
+.global g4297
+.global g4296
+.global g4295
+.global g4294
+.global g4293
+.global g4292
+.global g4291
+.global g4290
+.global g4289
+.global g4288
+.global g4287
+.global g4286
+.global g4285
+.global g4284
+.global g4283
+.global g4282
+.global g4281
+.global g4280
+.global g4279
+.global g4278
+.global g4277
+.global g4276
+.global g4275
+.global g4274
+.global g4273
+.global g4272
+.global g4271
+.global g4270
+.global g4269
+.global g4268
+.global g4267
+.global g4266
+.global g4265
+.global g4264
+.global g4263
+.global g4262
+.global g4261
+.global g4260
+.global g4259
+.global g4258
+.global g4257
+.global g4256
+.global g4255
+.global g4254
+.global g4253
+.global g4252
+.global g4251
+.global g4250
+.global g4249
+.global g4248
+.global g4247
+.global g4246
+.global g4245
+.global g4244
+.global g4243
+.global g4242
+.global g4241
+.global g4240
+.global g4239
+.global g4238
+.global g4237
+.global g4236
+.global g4235
+.global g4234
+.global g4233
+.global g4232
+.global g4231
+.global g4230
+.global g4229
+.global g4228
+.global g4227
+.global g4226
+.global g4225
+.global g4224
+.global g4223
+.global g4222
+.global g4221
+.global g4220
+.global g4219
+.global g4218
+.global g4217
+.global g4216
+.global g4215
+.global g4214
+.global g4213
+.global g4212
+.global g4211
+.global g4210
+.global g4209
+.global g4208
+.global g4207
+.global g4206
+.global g4205
+.global g4204
+.global g4203
+.global g4202
+.global g4201
+.global g4200
+.global g4199
+.global g4198
+.global g4197
+.global g4196
+.global g4195
+.global g4194
+.global g4193
+.global g4192
+.global g4191
+.global g4190
+.global g4189
+.global g4188
+.global g4187
+.global g4186
+.global g4185
+.global g4184
+.global g4183
+.global g4182
+.global g4181
+.global g4180
+.global g4179
+.global g4178
+.global g4177
+.global g4176
+.global g4175
+.global g4174
+.global g4173
+.global g4172
+.global g4171
+.global g4170
+.global g4169
+.global g4168
+.global g4167
+.global g4166
+.global g4165
+.global g4164
+.global g4163
+.global g4162
+.global g4161
+.global g4160
+.global g4159
+.global g4158
+.global g4157
+.global g4156
+.global g4155
+.global g4154
+.global g4153
+.global g4152
+.global g4151
+.global g4150
+.global g4149
+.global g4148
+.global g4147
+.global g4146
+.global g4145
+.global g4144
+.global g4143
+.global g4142
+.global g4141
+.global g4140
+.global g4139
+.global g4138
+.global g4137
+.global g4136
+.global g4135
+.global g4134
+.global g4133
+.global g4132
+.global g4131
+.global g4130
+.global g4129
+.global g4128
+.global g4127
+.global g4126
+.global g4125
+.global g4124
+.global g4123
+.global g4122
+.global g4121
+.global g4120
+.global g4119
+.global g4118
+.global g4117
+.global g4116
+.global g4115
+.global g4114
+.global g4113
+.global g4112
+.global g4111
+.global g4110
+.global g4109
+.global g4108
+.global g4107
+.global g4106
+.global g4105
+.global g4104
+.global g4103
+.global g4102
+.global g4101
+.global g4100
+.global g4099
+.global g4098
+.global g4097
+.global g4096
+.global g4095
+.global g4094
+.global g4093
+.global g4092
+.global g4091
+.global g4090
+.global g4089
+.global g4088
+.global g4087
+.global g4086
+.global g4085
+.global g4084
+.global g4083
+.global g4082
+.global g4081
+.global g4080
+.global g4079
+.global g4078
+.global g4077
+.global g4076
+.global g4075
+.global g4074
+.global g4073
+.global g4072
+.global g4071
+.global g4070
+.global g4069
+.global g4068
+.global g4067
+.global g4066
+.global g4065
+.global g4064
+.global g4063
+.global g4062
+.global g4061
+.global g4060
+.global g4059
+.global g4058
+.global g4057
+.global g4056
+.global g4055
+.global g4054
+.global g4053
+.global g4052
+.global g4051
+.global g4050
+.global g4049
+.global g4048
+.global g4047
+.global g4046
+.global g4045
+.global g4044
+.global g4043
+.global g4042
+.global g4041
+.global g4040
+.global g4039
+.global g4038
+.global g4037
+.global g4036
+.global g4035
+.global g4034
+.global g4033
+.global g4032
+.global g4031
+.global g4030
+.global g4029
+.global g4028
+.global g4027
+.global g4026
+.global g4025
+.global g4024
+.global g4023
+.global g4022
+.global g4021
+.global g4020
+.global g4019
+.global g4018
+.global g4017
+.global g4016
+.global g4015
+.global g4014
+.global g4013
+.global g4012
+.global g4011
+.global g4010
+.global g4009
+.global g4008
+.global g4007
+.global g4006
+.global g4005
+.global g4004
+.global g4003
+.global g4002
+.global g4001
+.global g4000
+.global g3999
+.global g3998
+.global g3997
+.global g3996
+.global g3995
+.global g3994
+.global g3993
+.global g3992
+.global g3991
+.global g3990
+.global g3989
+.global g3988
+.global g3987
+.global g3986
+.global g3985
+.global g3984
+.global g3983
+.global g3982
+.global g3981
+.global g3980
+.global g3979
+.global g3978
+.global g3977
+.global g3976
+.global g3975
+.global g3974
+.global g3973
+.global g3972
+.global g3971
+.global g3970
+.global g3969
+.global g3968
+.global g3967
+.global g3966
+.global g3965
+.global g3964
+.global g3963
+.global g3962
+.global g3961
+.global g3960
+.global g3959
+.global g3958
+.global g3957
+.global g3956
+.global g3955
+.global g3954
+.global g3953
+.global g3952
+.global g3951
+.global g3950
+.global g3949
+.global g3948
+.global g3947
+.global g3946
+.global g3945
+.global g3944
+.global g3943
+.global g3942
+.global g3941
+.global g3940
+.global g3939
+.global g3938
+.global g3937
+.global g3936
+.global g3935
+.global g3934
+.global g3933
+.global g3932
+.global g3931
+.global g3930
+.global g3929
+.global g3928
+.global g3927
+.global g3926
+.global g3925
+.global g3924
+.global g3923
+.global g3922
+.global g3921
+.global g3920
+.global g3919
+.global g3918
+.global g3917
+.global g3916
+.global g3915
+.global g3914
+.global g3913
+.global g3912
+.global g3911
+.global g3910
+.global g3909
+.global g3908
+.global g3907
+.global g3906
+.global g3905
+.global g3904
+.global g3903
+.global g3902
+.global g3901
+.global g3900
+.global g3899
+.global g3898
+.global g3897
+.global g3896
+.global g3895
+.global g3894
+.global g3893
+.global g3892
+.global g3891
+.global g3890
+.global g3889
+.global g3888
+.global g3887
+.global g3886
+.global g3885
+.global g3884
+.global g3883
+.global g3882
+.global g3881
+.global g3880
+.global g3879
+.global g3878
+.global g3877
+.global g3876
+.global g3875
+.global g3874
+.global g3873
+.global g3872
+.global g3871
+.global g3870
+.global g3869
+.global g3868
+.global g3867
+.global g3866
+.global g3865
+.global g3864
+.global g3863
+.global g3862
+.global g3861
+.global g3860
+.global g3859
+.global g3858
+.global g3857
+.global g3856
+.global g3855
+.global g3854
+.global g3853
+.global g3852
+.global g3851
+.global g3850
+.global g3849
+.global g3848
+.global g3847
+.global g3846
+.global g3845
+.global g3844
+.global g3843
+.global g3842
+.global g3841
+.global g3840
+.global g3839
+.global g3838
+.global g3837
+.global g3836
+.global g3835
+.global g3834
+.global g3833
+.global g3832
+.global g3831
+.global g3830
+.global g3829
+.global g3828
+.global g3827
+.global g3826
+.global g3825
+.global g3824
+.global g3823
+.global g3822
+.global g3821
+.global g3820
+.global g3819
+.global g3818
+.global g3817
+.global g3816
+.global g3815
+.global g3814
+.global g3813
+.global g3812
+.global g3811
+.global g3810
+.global g3809
+.global g3808
+.global g3807
+.global g3806
+.global g3805
+.global g3804
+.global g3803
+.global g3802
+.global g3801
+.global g3800
+.global g3799
+.global g3798
+.global g3797
+.global g3796
+.global g3795
+.global g3794
+.global g3793
+.global g3792
+.global g3791
+.global g3790
+.global g3789
+.global g3788
+.global g3787
+.global g3786
+.global g3785
+.global g3784
+.global g3783
+.global g3782
+.global g3781
+.global g3780
+.global g3779
+.global g3778
+.global g3777
+.global g3776
+.global g3775
+.global g3774
+.global g3773
+.global g3772
+.global g3771
+.global g3770
+.global g3769
+.global g3768
+.global g3767
+.global g3766
+.global g3765
+.global g3764
+.global g3763
+.global g3762
+.global g3761
+.global g3760
+.global g3759
+.global g3758
+.global g3757
+.global g3756
+.global g3755
+.global g3754
+.global g3753
+.global g3752
+.global g3751
+.global g3750
+.global g3749
+.global g3748
+.global g3747
+.global g3746
+.global g3745
+.global g3744
+.global g3743
+.global g3742
+.global g3741
+.global g3740
+.global g3739
+.global g3738
+.global g3737
+.global g3736
+.global g3735
+.global g3734
+.global g3733
+.global g3732
+.global g3731
+.global g3730
+.global g3729
+.global g3728
+.global g3727
+.global g3726
+.global g3725
+.global g3724
+.global g3723
+.global g3722
+.global g3721
+.global g3720
+.global g3719
+.global g3718
+.global g3717
+.global g3716
+.global g3715
+.global g3714
+.global g3713
+.global g3712
+.global g3711
+.global g3710
+.global g3709
+.global g3708
+.global g3707
+.global g3706
+.global g3705
+.global g3704
+.global g3703
+.global g3702
+.global g3701
+.global g3700
+.global g3699
+.global g3698
+.global g3697
+.global g3696
+.global g3695
+.global g3694
+.global g3693
+.global g3692
+.global g3691
+.global g3690
+.global g3689
+.global g3688
+.global g3687
+.global g3686
+.global g3685
+.global g3684
+.global g3683
+.global g3682
+.global g3681
+.global g3680
+.global g3679
+.global g3678
+.global g3677
+.global g3676
+.global g3675
+.global g3674
+.global g3673
+.global g3672
+.global g3671
+.global g3670
+.global g3669
+.global g3668
+.global g3667
+.global g3666
+.global g3665
+.global g3664
+.global g3663
+.global g3662
+.global g3661
+.global g3660
+.global g3659
+.global g3658
+.global g3657
+.global g3656
+.global g3655
+.global g3654
+.global g3653
+.global g3652
+.global g3651
+.global g3650
+.global g3649
+.global g3648
+.global g3647
+.global g3646
+.global g3645
+.global g3644
+.global g3643
+.global g3642
+.global g3641
+.global g3640
+.global g3639
+.global g3638
+.global g3637
+.global g3636
+.global g3635
+.global g3634
+.global g3633
+.global g3632
+.global g3631
+.global g3630
+.global g3629
+.global g3628
+.global g3627
+.global g3626
+.global g3625
+.global g3624
+.global g3623
+.global g3622
+.global g3621
+.global g3620
+.global g3619
+.global g3618
+.global g3617
+.global g3616
+.global g3615
+.global g3614
+.global g3613
+.global g3612
+.global g3611
+.global g3610
+.global g3609
+.global g3608
+.global g3607
+.global g3606
+.global g3605
+.global g3604
+.global g3603
+.global g3602
+.global g3601
+.global g3600
+.global g3599
+.global g3598
+.global g3597
+.global g3596
+.global g3595
+.global g3594
+.global g3593
+.global g3592
+.global g3591
+.global g3590
+.global g3589
+.global g3588
+.global g3587
+.global g3586
+.global g3585
+.global g3584
+.global g3583
+.global g3582
+.global g3581
+.global g3580
+.global g3579
+.global g3578
+.global g3577
+.global g3576
+.global g3575
+.global g3574
+.global g3573
+.global g3572
+.global g3571
+.global g3570
+.global g3569
+.global g3568
+.global g3567
+.global g3566
+.global g3565
+.global g3564
+.global g3563
+.global g3562
+.global g3561
+.global g3560
+.global g3559
+.global g3558
+.global g3557
+.global g3556
+.global g3555
+.global g3554
+.global g3553
+.global g3552
+.global g3551
+.global g3550
+.global g3549
+.global g3548
+.global g3547
+.global g3546
+.global g3545
+.global g3544
+.global g3543
+.global g3542
+.global g3541
+.global g3540
+.global g3539
+.global g3538
+.global g3537
+.global g3536
+.global g3535
+.global g3534
+.global g3533
+.global g3532
+.global g3531
+.global g3530
+.global g3529
+.global g3528
+.global g3527
+.global g3526
+.global g3525
+.global g3524
+.global g3523
+.global g3522
+.global g3521
+.global g3520
+.global g3519
+.global g3518
+.global g3517
+.global g3516
+.global g3515
+.global g3514
+.global g3513
+.global g3512
+.global g3511
+.global g3510
+.global g3509
+.global g3508
+.global g3507
+.global g3506
+.global g3505
+.global g3504
+.global g3503
+.global g3502
+.global g3501
+.global g3500
+.global g3499
+.global g3498
+.global g3497
+.global g3496
+.global g3495
+.global g3494
+.global g3493
+.global g3492
+.global g3491
+.global g3490
+.global g3489
+.global g3488
+.global g3487
+.global g3486
+.global g3485
+.global g3484
+.global g3483
+.global g3482
+.global g3481
+.global g3480
+.global g3479
+.global g3478
+.global g3477
+.global g3476
+.global g3475
+.global g3474
+.global g3473
+.global g3472
+.global g3471
+.global g3470
+.global g3469
+.global g3468
+.global g3467
+.global g3466
+.global g3465
+.global g3464
+.global g3463
+.global g3462
+.global g3461
+.global g3460
+.global g3459
+.global g3458
+.global g3457
+.global g3456
+.global g3455
+.global g3454
+.global g3453
+.global g3452
+.global g3451
+.global g3450
+.global g3449
+.global g3448
+.global g3447
+.global g3446
+.global g3445
+.global g3444
+.global g3443
+.global g3442
+.global g3441
+.global g3440
+.global g3439
+.global g3438
+.global g3437
+.global g3436
+.global g3435
+.global g3434
+.global g3433
+.global g3432
+.global g3431
+.global g3430
+.global g3429
+.global g3428
+.global g3427
+.global g3426
+.global g3425
+.global g3424
+.global g3423
+.global g3422
+.global g3421
+.global g3420
+.global g3419
+.global g3418
+.global g3417
+.global g3416
+.global g3415
+.global g3414
+.global g3413
+.global g3412
+.global g3411
+.global g3410
+.global g3409
+.global g3408
+.global g3407
+.global g3406
+.global g3405
+.global g3404
+.global g3403
+.global g3402
+.global g3401
+.global g3400
+.global g3399
+.global g3398
+.global g3397
+.global g3396
+.global g3395
+.global g3394
+.global g3393
+.global g3392
+.global g3391
+.global g3390
+.global g3389
+.global g3388
+.global g3387
+.global g3386
+.global g3385
+.global g3384
+.global g3383
+.global g3382
+.global g3381
+.global g3380
+.global g3379
+.global g3378
+.global g3377
+.global g3376
+.global g3375
+.global g3374
+.global g3373
+.global g3372
+.global g3371
+.global g3370
+.global g3369
+.global g3368
+.global g3367
+.global g3366
+.global g3365
+.global g3364
+.global g3363
+.global g3362
+.global g3361
+.global g3360
+.global g3359
+.global g3358
+.global g3357
+.global g3356
+.global g3355
+.global g3354
+.global g3353
+.global g3352
+.global g3351
+.global g3350
+.global g3349
+.global g3348
+.global g3347
+.global g3346
+.global g3345
+.global g3344
+.global g3343
+.global g3342
+.global g3341
+.global g3340
+.global g3339
+.global g3338
+.global g3337
+.global g3336
+.global g3335
+.global g3334
+.global g3333
+.global g3332
+.global g3331
+.global g3330
+.global g3329
+.global g3328
+.global g3327
+.global g3326
+.global g3325
+.global g3324
+.global g3323
+.global g3322
+.global g3321
+.global g3320
+.global g3319
+.global g3318
+.global g3317
+.global g3316
+.global g3315
+.global g3314
+.global g3313
+.global g3312
+.global g3311
+.global g3310
+.global g3309
+.global g3308
+.global g3307
+.global g3306
+.global g3305
+.global g3304
+.global g3303
+.global g3302
+.global g3301
+.global g3300
+.global g3299
+.global g3298
+.global g3297
+.global g3296
+.global g3295
+.global g3294
+.global g3293
+.global g3292
+.global g3291
+.global g3290
+.global g3289
+.global g3288
+.global g3287
+.global g3286
+.global g3285
+.global g3284
+.global g3283
+.global g3282
+.global g3281
+.global g3280
+.global g3279
+.global g3278
+.global g3277
+.global g3276
+.global g3275
+.global g3274
+.global g3273
+.global g3272
+.global g3271
+.global g3270
+.global g3269
+.global g3268
+.global g3267
+.global g3266
+.global g3265
+.global g3264
+.global g3263
+.global g3262
+.global g3261
+.global g3260
+.global g3259
+.global g3258
+.global g3257
+.global g3256
+.global g3255
+.global g3254
+.global g3253
+.global g3252
+.global g3251
+.global g3250
+.global g3249
+.global g3248
+.global g3247
+.global g3246
+.global g3245
+.global g3244
+.global g3243
+.global g3242
+.global g3241
+.global g3240
+.global g3239
+.global g3238
+.global g3237
+.global g3236
+.global g3235
+.global g3234
+.global g3233
+.global g3232
+.global g3231
+.global g3230
+.global g3229
+.global g3228
+.global g3227
+.global g3226
+.global g3225
+.global g3224
+.global g3223
+.global g3222
+.global g3221
+.global g3220
+.global g3219
+.global g3218
+.global g3217
+.global g3216
+.global g3215
+.global g3214
+.global g3213
+.global g3212
+.global g3211
+.global g3210
+.global g3209
+.global g3208
+.global g3207
+.global g3206
+.global g3205
+.global g3204
+.global g3203
+.global g3202
+.global g3201
+.global g3200
+.global g3199
+.global g3198
+.global g3197
+.global g3196
+.global g3195
+.global g3194
+.global g3193
+.global g3192
+.global g3191
+.global g3190
+.global g3189
+.global g3188
+.global g3187
+.global g3186
+.global g3185
+.global g3184
+.global g3183
+.global g3182
+.global g3181
+.global g3180
+.global g3179
+.global g3178
+.global g3177
+.global g3176
+.global g3175
+.global g3174
+.global g3173
+.global g3172
+.global g3171
+.global g3170
+.global g3169
+.global g3168
+.global g3167
+.global g3166
+.global g3165
+.global g3164
+.global g3163
+.global g3162
+.global g3161
+.global g3160
+.global g3159
+.global g3158
+.global g3157
+.global g3156
+.global g3155
+.global g3154
+.global g3153
+.global g3152
+.global g3151
+.global g3150
+.global g3149
+.global g3148
+.global g3147
+.global g3146
+.global g3145
+.global g3144
+.global g3143
+.global g3142
+.global g3141
+.global g3140
+.global g3139
+.global g3138
+.global g3137
+.global g3136
+.global g3135
+.global g3134
+.global g3133
+.global g3132
+.global g3131
+.global g3130
+.global g3129
+.global g3128
+.global g3127
+.global g3126
+.global g3125
+.global g3124
+.global g3123
+.global g3122
+.global g3121
+.global g3120
+.global g3119
+.global g3118
+.global g3117
+.global g3116
+.global g3115
+.global g3114
+.global g3113
+.global g3112
+.global g3111
+.global g3110
+.global g3109
+.global g3108
+.global g3107
+.global g3106
+.global g3105
+.global g3104
+.global g3103
+.global g3102
+.global g3101
+.global g3100
+.global g3099
+.global g3098
+.global g3097
+.global g3096
+.global g3095
+.global g3094
+.global g3093
+.global g3092
+.global g3091
+.global g3090
+.global g3089
+.global g3088
+.global g3087
+.global g3086
+.global g3085
+.global g3084
+.global g3083
+.global g3082
+.global g3081
+.global g3080
+.global g3079
+.global g3078
+.global g3077
+.global g3076
+.global g3075
+.global g3074
+.global g3073
+.global g3072
+.global g3071
+.global g3070
+.global g3069
+.global g3068
+.global g3067
+.global g3066
+.global g3065
+.global g3064
+.global g3063
+.global g3062
+.global g3061
+.global g3060
+.global g3059
+.global g3058
+.global g3057
+.global g3056
+.global g3055
+.global g3054
+.global g3053
+.global g3052
+.global g3051
+.global g3050
+.global g3049
+.global g3048
+.global g3047
+.global g3046
+.global g3045
+.global g3044
+.global g3043
+.global g3042
+.global g3041
+.global g3040
+.global g3039
+.global g3038
+.global g3037
+.global g3036
+.global g3035
+.global g3034
+.global g3033
+.global g3032
+.global g3031
+.global g3030
+.global g3029
+.global g3028
+.global g3027
+.global g3026
+.global g3025
+.global g3024
+.global g3023
+.global g3022
+.global g3021
+.global g3020
+.global g3019
+.global g3018
+.global g3017
+.global g3016
+.global g3015
+.global g3014
+.global g3013
+.global g3012
+.global g3011
+.global g3010
+.global g3009
+.global g3008
+.global g3007
+.global g3006
+.global g3005
+.global g3004
+.global g3003
+.global g3002
+.global g3001
+.global g3000
+.global g2999
+.global g2998
+.global g2997
+.global g2996
+.global g2995
+.global g2994
+.global g2993
+.global g2992
+.global g2991
+.global g2990
+.global g2989
+.global g2988
+.global g2987
+.global g2986
+.global g2985
+.global g2984
+.global g2983
+.global g2982
+.global g2981
+.global g2980
+.global g2979
+.global g2978
+.global g2977
+.global g2976
+.global g2975
+.global g2974
+.global g2973
+.global g2972
+.global g2971
+.global g2970
+.global g2969
+.global g2968
+.global g2967
+.global g2966
+.global g2965
+.global g2964
+.global g2963
+.global g2962
+.global g2961
+.global g2960
+.global g2959
+.global g2958
+.global g2957
+.global g2956
+.global g2955
+.global g2954
+.global g2953
+.global g2952
+.global g2951
+.global g2950
+.global g2949
+.global g2948
+.global g2947
+.global g2946
+.global g2945
+.global g2944
+.global g2943
+.global g2942
+.global g2941
+.global g2940
+.global g2939
+.global g2938
+.global g2937
+.global g2936
+.global g2935
+.global g2934
+.global g2933
+.global g2932
+.global g2931
+.global g2930
+.global g2929
+.global g2928
+.global g2927
+.global g2926
+.global g2925
+.global g2924
+.global g2923
+.global g2922
+.global g2921
+.global g2920
+.global g2919
+.global g2918
+.global g2917
+.global g2916
+.global g2915
+.global g2914
+.global g2913
+.global g2912
+.global g2911
+.global g2910
+.global g2909
+.global g2908
+.global g2907
+.global g2906
+.global g2905
+.global g2904
+.global g2903
+.global g2902
+.global g2901
+.global g2900
+.global g2899
+.global g2898
+.global g2897
+.global g2896
+.global g2895
+.global g2894
+.global g2893
+.global g2892
+.global g2891
+.global g2890
+.global g2889
+.global g2888
+.global g2887
+.global g2886
+.global g2885
+.global g2884
+.global g2883
+.global g2882
+.global g2881
+.global g2880
+.global g2879
+.global g2878
+.global g2877
+.global g2876
+.global g2875
+.global g2874
+.global g2873
+.global g2872
+.global g2871
+.global g2870
+.global g2869
+.global g2868
+.global g2867
+.global g2866
+.global g2865
+.global g2864
+.global g2863
+.global g2862
+.global g2861
+.global g2860
+.global g2859
+.global g2858
+.global g2857
+.global g2856
+.global g2855
+.global g2854
+.global g2853
+.global g2852
+.global g2851
+.global g2850
+.global g2849
+.global g2848
+.global g2847
+.global g2846
+.global g2845
+.global g2844
+.global g2843
+.global g2842
+.global g2841
+.global g2840
+.global g2839
+.global g2838
+.global g2837
+.global g2836
+.global g2835
+.global g2834
+.global g2833
+.global g2832
+.global g2831
+.global g2830
+.global g2829
+.global g2828
+.global g2827
+.global g2826
+.global g2825
+.global g2824
+.global g2823
+.global g2822
+.global g2821
+.global g2820
+.global g2819
+.global g2818
+.global g2817
+.global g2816
+.global g2815
+.global g2814
+.global g2813
+.global g2812
+.global g2811
+.global g2810
+.global g2809
+.global g2808
+.global g2807
+.global g2806
+.global g2805
+.global g2804
+.global g2803
+.global g2802
+.global g2801
+.global g2800
+.global g2799
+.global g2798
+.global g2797
+.global g2796
+.global g2795
+.global g2794
+.global g2793
+.global g2792
+.global g2791
+.global g2790
+.global g2789
+.global g2788
+.global g2787
+.global g2786
+.global g2785
+.global g2784
+.global g2783
+.global g2782
+.global g2781
+.global g2780
+.global g2779
+.global g2778
+.global g2777
+.global g2776
+.global g2775
+.global g2774
+.global g2773
+.global g2772
+.global g2771
+.global g2770
+.global g2769
+.global g2768
+.global g2767
+.global g2766
+.global g2765
+.global g2764
+.global g2763
+.global g2762
+.global g2761
+.global g2760
+.global g2759
+.global g2758
+.global g2757
+.global g2756
+.global g2755
+.global g2754
+.global g2753
+.global g2752
+.global g2751
+.global g2750
+.global g2749
+.global g2748
+.global g2747
+.global g2746
+.global g2745
+.global g2744
+.global g2743
+.global g2742
+.global g2741
+.global g2740
+.global g2739
+.global g2738
+.global g2737
+.global g2736
+.global g2735
+.global g2734
+.global g2733
+.global g2732
+.global g2731
+.global g2730
+.global g2729
+.global g2728
+.global g2727
+.global g2726
+.global g2725
+.global g2724
+.global g2723
+.global g2722
+.global g2721
+.global g2720
+.global g2719
+.global g2718
+.global g2717
+.global g2716
+.global g2715
+.global g2714
+.global g2713
+.global g2712
+.global g2711
+.global g2710
+.global g2709
+.global g2708
+.global g2707
+.global g2706
+.global g2705
+.global g2704
+.global g2703
+.global g2702
+.global g2701
+.global g2700
+.global g2699
+.global g2698
+.global g2697
+.global g2696
+.global g2695
+.global g2694
+.global g2693
+.global g2692
+.global g2691
+.global g2690
+.global g2689
+.global g2688
+.global g2687
+.global g2686
+.global g2685
+.global g2684
+.global g2683
+.global g2682
+.global g2681
+.global g2680
+.global g2679
+.global g2678
+.global g2677
+.global g2676
+.global g2675
+.global g2674
+.global g2673
+.global g2672
+.global g2671
+.global g2670
+.global g2669
+.global g2668
+.global g2667
+.global g2666
+.global g2665
+.global g2664
+.global g2663
+.global g2662
+.global g2661
+.global g2660
+.global g2659
+.global g2658
+.global g2657
+.global g2656
+.global g2655
+.global g2654
+.global g2653
+.global g2652
+.global g2651
+.global g2650
+.global g2649
+.global g2648
+.global g2647
+.global g2646
+.global g2645
+.global g2644
+.global g2643
+.global g2642
+.global g2641
+.global g2640
+.global g2639
+.global g2638
+.global g2637
+.global g2636
+.global g2635
+.global g2634
+.global g2633
+.global g2632
+.global g2631
+.global g2630
+.global g2629
+.global g2628
+.global g2627
+.global g2626
+.global g2625
+.global g2624
+.global g2623
+.global g2622
+.global g2621
+.global g2620
+.global g2619
+.global g2618
+.global g2617
+.global g2616
+.global g2615
+.global g2614
+.global g2613
+.global g2612
+.global g2611
+.global g2610
+.global g2609
+.global g2608
+.global g2607
+.global g2606
+.global g2605
+.global g2604
+.global g2603
+.global g2602
+.global g2601
+.global g2600
+.global g2599
+.global g2598
+.global g2597
+.global g2596
+.global g2595
+.global g2594
+.global g2593
+.global g2592
+.global g2591
+.global g2590
+.global g2589
+.global g2588
+.global g2587
+.global g2586
+.global g2585
+.global g2584
+.global g2583
+.global g2582
+.global g2581
+.global g2580
+.global g2579
+.global g2578
+.global g2577
+.global g2576
+.global g2575
+.global g2574
+.global g2573
+.global g2572
+.global g2571
+.global g2570
+.global g2569
+.global g2568
+.global g2567
+.global g2566
+.global g2565
+.global g2564
+.global g2563
+.global g2562
+.global g2561
+.global g2560
+.global g2559
+.global g2558
+.global g2557
+.global g2556
+.global g2555
+.global g2554
+.global g2553
+.global g2552
+.global g2551
+.global g2550
+.global g2549
+.global g2548
+.global g2547
+.global g2546
+.global g2545
+.global g2544
+.global g2543
+.global g2542
+.global g2541
+.global g2540
+.global g2539
+.global g2538
+.global g2537
+.global g2536
+.global g2535
+.global g2534
+.global g2533
+.global g2532
+.global g2531
+.global g2530
+.global g2529
+.global g2528
+.global g2527
+.global g2526
+.global g2525
+.global g2524
+.global g2523
+.global g2522
+.global g2521
+.global g2520
+.global g2519
+.global g2518
+.global g2517
+.global g2516
+.global g2515
+.global g2514
+.global g2513
+.global g2512
+.global g2511
+.global g2510
+.global g2509
+.global g2508
+.global g2507
+.global g2506
+.global g2505
+.global g2504
+.global g2503
+.global g2502
+.global g2501
+.global g2500
+.global g2499
+.global g2498
+.global g2497
+.global g2496
+.global g2495
+.global g2494
+.global g2493
+.global g2492
+.global g2491
+.global g2490
+.global g2489
+.global g2488
+.global g2487
+.global g2486
+.global g2485
+.global g2484
+.global g2483
+.global g2482
+.global g2481
+.global g2480
+.global g2479
+.global g2478
+.global g2477
+.global g2476
+.global g2475
+.global g2474
+.global g2473
+.global g2472
+.global g2471
+.global g2470
+.global g2469
+.global g2468
+.global g2467
+.global g2466
+.global g2465
+.global g2464
+.global g2463
+.global g2462
+.global g2461
+.global g2460
+.global g2459
+.global g2458
+.global g2457
+.global g2456
+.global g2455
+.global g2454
+.global g2453
+.global g2452
+.global g2451
+.global g2450
+.global g2449
+.global g2448
+.global g2447
+.global g2446
+.global g2445
+.global g2444
+.global g2443
+.global g2442
+.global g2441
+.global g2440
+.global g2439
+.global g2438
+.global g2437
+.global g2436
+.global g2435
+.global g2434
+.global g2433
+.global g2432
+.global g2431
+.global g2430
+.global g2429
+.global g2428
+.global g2427
+.global g2426
+.global g2425
+.global g2424
+.global g2423
+.global g2422
+.global g2421
+.global g2420
+.global g2419
+.global g2418
+.global g2417
+.global g2416
+.global g2415
+.global g2414
+.global g2413
+.global g2412
+.global g2411
+.global g2410
+.global g2409
+.global g2408
+.global g2407
+.global g2406
+.global g2405
+.global g2404
+.global g2403
+.global g2402
+.global g2401
+.global g2400
+.global g2399
+.global g2398
+.global g2397
+.global g2396
+.global g2395
+.global g2394
+.global g2393
+.global g2392
+.global g2391
+.global g2390
+.global g2389
+.global g2388
+.global g2387
+.global g2386
+.global g2385
+.global g2384
+.global g2383
+.global g2382
+.global g2381
+.global g2380
+.global g2379
+.global g2378
+.global g2377
+.global g2376
+.global g2375
+.global g2374
+.global g2373
+.global g2372
+.global g2371
+.global g2370
+.global g2369
+.global g2368
+.global g2367
+.global g2366
+.global g2365
+.global g2364
+.global g2363
+.global g2362
+.global g2361
+.global g2360
+.global g2359
+.global g2358
+.global g2357
+.global g2356
+.global g2355
+.global g2354
+.global g2353
+.global g2352
+.global g2351
+.global g2350
+.global g2349
+.global g2348
+.global g2347
+.global g2346
+.global g2345
+.global g2344
+.global g2343
+.global g2342
+.global g2341
+.global g2340
+.global g2339
+.global g2338
+.global g2337
+.global g2336
+.global g2335
+.global g2334
+.global g2333
+.global g2332
+.global g2331
+.global g2330
+.global g2329
+.global g2328
+.global g2327
+.global g2326
+.global g2325
+.global g2324
+.global g2323
+.global g2322
+.global g2321
+.global g2320
+.global g2319
+.global g2318
+.global g2317
+.global g2316
+.global g2315
+.global g2314
+.global g2313
+.global g2312
+.global g2311
+.global g2310
+.global g2309
+.global g2308
+.global g2307
+.global g2306
+.global g2305
+.global g2304
+.global g2303
+.global g2302
+.global g2301
+.global g2300
+.global g2299
+.global g2298
+.global g2297
+.global g2296
+.global g2295
+.global g2294
+.global g2293
+.global g2292
+.global g2291
+.global g2290
+.global g2289
+.global g2288
+.global g2287
+.global g2286
+.global g2285
+.global g2284
+.global g2283
+.global g2282
+.global g2281
+.global g2280
+.global g2279
+.global g2278
+.global g2277
+.global g2276
+.global g2275
+.global g2274
+.global g2273
+.global g2272
+.global g2271
+.global g2270
+.global g2269
+.global g2268
+.global g2267
+.global g2266
+.global g2265
+.global g2264
+.global g2263
+.global g2262
+.global g2261
+.global g2260
+.global g2259
+.global g2258
+.global g2257
+.global g2256
+.global g2255
+.global g2254
+.global g2253
+.global g2252
+.global g2251
+.global g2250
+.global g2249
+.global g2248
+.global g2247
+.global g2246
+.global g2245
+.global g2244
+.global g2243
+.global g2242
+.global g2241
+.global g2240
+.global g2239
+.global g2238
+.global g2237
+.global g2236
+.global g2235
+.global g2234
+.global g2233
+.global g2232
+.global g2231
+.global g2230
+.global g2229
+.global g2228
+.global g2227
+.global g2226
+.global g2225
+.global g2224
+.global g2223
+.global g2222
+.global g2221
+.global g2220
+.global g2219
+.global g2218
+.global g2217
+.global g2216
+.global g2215
+.global g2214
+.global g2213
+.global g2212
+.global g2211
+.global g2210
+.global g2209
+.global g2208
+.global g2207
+.global g2206
+.global g2205
+.global g2204
+.global g2203
+.global g2202
+.global g2201
+.global g2200
+.global g2199
+.global g2198
+.global g2197
+.global g2196
+.global g2195
+.global g2194
+.global g2193
+.global g2192
+.global g2191
+.global g2190
+.global g2189
+.global g2188
+.global g2187
+.global g2186
+.global g2185
+.global g2184
+.global g2183
+.global g2182
+.global g2181
+.global g2180
+.global g2179
+.global g2178
+.global g2177
+.global g2176
+.global g2175
+.global g2174
+.global g2173
+.global g2172
+.global g2171
+.global g2170
+.global g2169
+.global g2168
+.global g2167
+.global g2166
+.global g2165
+.global g2164
+.global g2163
+.global g2162
+.global g2161
+.global g2160
+.global g2159
+.global g2158
+.global g2157
+.global g2156
+.global g2155
+.global g2154
+.global g2153
+.global g2152
+.global g2151
+.global g2150
+.global g2149
+.global g2148
+.global g2147
+.global g2146
+.global g2145
+.global g2144
+.global g2143
+.global g2142
+.global g2141
+.global g2140
+.global g2139
+.global g2138
+.global g2137
+.global g2136
+.global g2135
+.global g2134
+.global g2133
+.global g2132
+.global g2131
+.global g2130
+.global g2129
+.global g2128
+.global g2127
+.global g2126
+.global g2125
+.global g2124
+.global g2123
+.global g2122
+.global g2121
+.global g2120
+.global g2119
+.global g2118
+.global g2117
+.global g2116
+.global g2115
+.global g2114
+.global g2113
+.global g2112
+.global g2111
+.global g2110
+.global g2109
+.global g2108
+.global g2107
+.global g2106
+.global g2105
+.global g2104
+.global g2103
+.global g2102
+.global g2101
+.global g2100
+.global g2099
+.global g2098
+.global g2097
+.global g2096
+.global g2095
+.global g2094
+.global g2093
+.global g2092
+.global g2091
+.global g2090
+.global g2089
+.global g2088
+.global g2087
+.global g2086
+.global g2085
+.global g2084
+.global g2083
+.global g2082
+.global g2081
+.global g2080
+.global g2079
+.global g2078
+.global g2077
+.global g2076
+.global g2075
+.global g2074
+.global g2073
+.global g2072
+.global g2071
+.global g2070
+.global g2069
+.global g2068
+.global g2067
+.global g2066
+.global g2065
+.global g2064
+.global g2063
+.global g2062
+.global g2061
+.global g2060
+.global g2059
+.global g2058
+.global g2057
+.global g2056
+.global g2055
+.global g2054
+.global g2053
+.global g2052
+.global g2051
+.global g2050
+.global g2049
+.global g2048
+.global g2047
+.global g2046
+.global g2045
+.global g2044
+.global g2043
+.global g2042
+.global g2041
+.global g2040
+.global g2039
+.global g2038
+.global g2037
+.global g2036
+.global g2035
+.global g2034
+.global g2033
+.global g2032
+.global g2031
+.global g2030
+.global g2029
+.global g2028
+.global g2027
+.global g2026
+.global g2025
+.global g2024
+.global g2023
+.global g2022
+.global g2021
+.global g2020
+.global g2019
+.global g2018
+.global g2017
+.global g2016
+.global g2015
+.global g2014
+.global g2013
+.global g2012
+.global g2011
+.global g2010
+.global g2009
+.global g2008
+.global g2007
+.global g2006
+.global g2005
+.global g2004
+.global g2003
+.global g2002
+.global g2001
+.global g2000
+.global g1999
+.global g1998
+.global g1997
+.global g1996
+.global g1995
+.global g1994
+.global g1993
+.global g1992
+.global g1991
+.global g1990
+.global g1989
+.global g1988
+.global g1987
+.global g1986
+.global g1985
+.global g1984
+.global g1983
+.global g1982
+.global g1981
+.global g1980
+.global g1979
+.global g1978
+.global g1977
+.global g1976
+.global g1975
+.global g1974
+.global g1973
+.global g1972
+.global g1971
+.global g1970
+.global g1969
+.global g1968
+.global g1967
+.global g1966
+.global g1965
+.global g1964
+.global g1963
+.global g1962
+.global g1961
+.global g1960
+.global g1959
+.global g1958
+.global g1957
+.global g1956
+.global g1955
+.global g1954
+.global g1953
+.global g1952
+.global g1951
+.global g1950
+.global g1949
+.global g1948
+.global g1947
+.global g1946
+.global g1945
+.global g1944
+.global g1943
+.global g1942
+.global g1941
+.global g1940
+.global g1939
+.global g1938
+.global g1937
+.global g1936
+.global g1935
+.global g1934
+.global g1933
+.global g1932
+.global g1931
+.global g1930
+.global g1929
+.global g1928
+.global g1927
+.global g1926
+.global g1925
+.global g1924
+.global g1923
+.global g1922
+.global g1921
+.global g1920
+.global g1919
+.global g1918
+.global g1917
+.global g1916
+.global g1915
+.global g1914
+.global g1913
+.global g1912
+.global g1911
+.global g1910
+.global g1909
+.global g1908
+.global g1907
+.global g1906
+.global g1905
+.global g1904
+.global g1903
+.global g1902
+.global g1901
+.global g1900
+.global g1899
+.global g1898
+.global g1897
+.global g1896
+.global g1895
+.global g1894
+.global g1893
+.global g1892
+.global g1891
+.global g1890
+.global g1889
+.global g1888
+.global g1887
+.global g1886
+.global g1885
+.global g1884
+.global g1883
+.global g1882
+.global g1881
+.global g1880
+.global g1879
+.global g1878
+.global g1877
+.global g1876
+.global g1875
+.global g1874
+.global g1873
+.global g1872
+.global g1871
+.global g1870
+.global g1869
+.global g1868
+.global g1867
+.global g1866
+.global g1865
+.global g1864
+.global g1863
+.global g1862
+.global g1861
+.global g1860
+.global g1859
+.global g1858
+.global g1857
+.global g1856
+.global g1855
+.global g1854
+.global g1853
+.global g1852
+.global g1851
+.global g1850
+.global g1849
+.global g1848
+.global g1847
+.global g1846
+.global g1845
+.global g1844
+.global g1843
+.global g1842
+.global g1841
+.global g1840
+.global g1839
+.global g1838
+.global g1837
+.global g1836
+.global g1835
+.global g1834
+.global g1833
+.global g1832
+.global g1831
+.global g1830
+.global g1829
+.global g1828
+.global g1827
+.global g1826
+.global g1825
+.global g1824
+.global g1823
+.global g1822
+.global g1821
+.global g1820
+.global g1819
+.global g1818
+.global g1817
+.global g1816
+.global g1815
+.global g1814
+.global g1813
+.global g1812
+.global g1811
+.global g1810
+.global g1809
+.global g1808
+.global g1807
+.global g1806
+.global g1805
+.global g1804
+.global g1803
+.global g1802
+.global g1801
+.global g1800
+.global g1799
+.global g1798
+.global g1797
+.global g1796
+.global g1795
+.global g1794
+.global g1793
+.global g1792
+.global g1791
+.global g1790
+.global g1789
+.global g1788
+.global g1787
+.global g1786
+.global g1785
+.global g1784
+.global g1783
+.global g1782
+.global g1781
+.global g1780
+.global g1779
+.global g1778
+.global g1777
+.global g1776
+.global g1775
+.global g1774
+.global g1773
+.global g1772
+.global g1771
+.global g1770
+.global g1769
+.global g1768
+.global g1767
+.global g1766
+.global g1765
+.global g1764
+.global g1763
+.global g1762
+.global g1761
+.global g1760
+.global g1759
+.global g1758
+.global g1757
+.global g1756
+.global g1755
+.global g1754
+.global g1753
+.global g1752
+.global g1751
+.global g1750
+.global g1749
+.global g1748
+.global g1747
+.global g1746
+.global g1745
+.global g1744
+.global g1743
+.global g1742
+.global g1741
+.global g1740
+.global g1739
+.global g1738
+.global g1737
+.global g1736
+.global g1735
+.global g1734
+.global g1733
+.global g1732
+.global g1731
+.global g1730
+.global g1729
+.global g1728
+.global g1727
+.global g1726
+.global g1725
+.global g1724
+.global g1723
+.global g1722
+.global g1721
+.global g1720
+.global g1719
+.global g1718
+.global g1717
+.global g1716
+.global g1715
+.global g1714
+.global g1713
+.global g1712
+.global g1711
+.global g1710
+.global g1709
+.global g1708
+.global g1707
+.global g1706
+.global g1705
+.global g1704
+.global g1703
+.global g1702
+.global g1701
+.global g1700
+.global g1699
+.global g1698
+.global g1697
+.global g1696
+.global g1695
+.global g1694
+.global g1693
+.global g1692
+.global g1691
+.global g1690
+.global g1689
+.global g1688
+.global g1687
+.global g1686
+.global g1685
+.global g1684
+.global g1683
+.global g1682
+.global g1681
+.global g1680
+.global g1679
+.global g1678
+.global g1677
+.global g1676
+.global g1675
+.global g1674
+.global g1673
+.global g1672
+.global g1671
+.global g1670
+.global g1669
+.global g1668
+.global g1667
+.global g1666
+.global g1665
+.global g1664
+.global g1663
+.global g1662
+.global g1661
+.global g1660
+.global g1659
+.global g1658
+.global g1657
+.global g1656
+.global g1655
+.global g1654
+.global g1653
+.global g1652
+.global g1651
+.global g1650
+.global g1649
+.global g1648
+.global g1647
+.global g1646
+.global g1645
+.global g1644
+.global g1643
+.global g1642
+.global g1641
+.global g1640
+.global g1639
+.global g1638
+.global g1637
+.global g1636
+.global g1635
+.global g1634
+.global g1633
+.global g1632
+.global g1631
+.global g1630
+.global g1629
+.global g1628
+.global g1627
+.global g1626
+.global g1625
+.global g1624
+.global g1623
+.global g1622
+.global g1621
+.global g1620
+.global g1619
+.global g1618
+.global g1617
+.global g1616
+.global g1615
+.global g1614
+.global g1613
+.global g1612
+.global g1611
+.global g1610
+.global g1609
+.global g1608
+.global g1607
+.global g1606
+.global g1605
+.global g1604
+.global g1603
+.global g1602
+.global g1601
+.global g1600
+.global g1599
+.global g1598
+.global g1597
+.global g1596
+.global g1595
+.global g1594
+.global g1593
+.global g1592
+.global g1591
+.global g1590
+.global g1589
+.global g1588
+.global g1587
+.global g1586
+.global g1585
+.global g1584
+.global g1583
+.global g1582
+.global g1581
+.global g1580
+.global g1579
+.global g1578
+.global g1577
+.global g1576
+.global g1575
+.global g1574
+.global g1573
+.global g1572
+.global g1571
+.global g1570
+.global g1569
+.global g1568
+.global g1567
+.global g1566
+.global g1565
+.global g1564
+.global g1563
+.global g1562
+.global g1561
+.global g1560
+.global g1559
+.global g1558
+.global g1557
+.global g1556
+.global g1555
+.global g1554
+.global g1553
+.global g1552
+.global g1551
+.global g1550
+.global g1549
+.global g1548
+.global g1547
+.global g1546
+.global g1545
+.global g1544
+.global g1543
+.global g1542
+.global g1541
+.global g1540
+.global g1539
+.global g1538
+.global g1537
+.global g1536
+.global g1535
+.global g1534
+.global g1533
+.global g1532
+.global g1531
+.global g1530
+.global g1529
+.global g1528
+.global g1527
+.global g1526
+.global g1525
+.global g1524
+.global g1523
+.global g1522
+.global g1521
+.global g1520
+.global g1519
+.global g1518
+.global g1517
+.global g1516
+.global g1515
+.global g1514
+.global g1513
+.global g1512
+.global g1511
+.global g1510
+.global g1509
+.global g1508
+.global g1507
+.global g1506
+.global g1505
+.global g1504
+.global g1503
+.global g1502
+.global g1501
+.global g1500
+.global g1499
+.global g1498
+.global g1497
+.global g1496
+.global g1495
+.global g1494
+.global g1493
+.global g1492
+.global g1491
+.global g1490
+.global g1489
+.global g1488
+.global g1487
+.global g1486
+.global g1485
+.global g1484
+.global g1483
+.global g1482
+.global g1481
+.global g1480
+.global g1479
+.global g1478
+.global g1477
+.global g1476
+.global g1475
+.global g1474
+.global g1473
+.global g1472
+.global g1471
+.global g1470
+.global g1469
+.global g1468
+.global g1467
+.global g1466
+.global g1465
+.global g1464
+.global g1463
+.global g1462
+.global g1461
+.global g1460
+.global g1459
+.global g1458
+.global g1457
+.global g1456
+.global g1455
+.global g1454
+.global g1453
+.global g1452
+.global g1451
+.global g1450
+.global g1449
+.global g1448
+.global g1447
+.global g1446
+.global g1445
+.global g1444
+.global g1443
+.global g1442
+.global g1441
+.global g1440
+.global g1439
+.global g1438
+.global g1437
+.global g1436
+.global g1435
+.global g1434
+.global g1433
+.global g1432
+.global g1431
+.global g1430
+.global g1429
+.global g1428
+.global g1427
+.global g1426
+.global g1425
+.global g1424
+.global g1423
+.global g1422
+.global g1421
+.global g1420
+.global g1419
+.global g1418
+.global g1417
+.global g1416
+.global g1415
+.global g1414
+.global g1413
+.global g1412
+.global g1411
+.global g1410
+.global g1409
+.global g1408
+.global g1407
+.global g1406
+.global g1405
+.global g1404
+.global g1403
+.global g1402
+.global g1401
+.global g1400
+.global g1399
+.global g1398
+.global g1397
+.global g1396
+.global g1395
+.global g1394
+.global g1393
+.global g1392
+.global g1391
+.global g1390
+.global g1389
+.global g1388
+.global g1387
+.global g1386
+.global g1385
+.global g1384
+.global g1383
+.global g1382
+.global g1381
+.global g1380
+.global g1379
+.global g1378
+.global g1377
+.global g1376
+.global g1375
+.global g1374
+.global g1373
+.global g1372
+.global g1371
+.global g1370
+.global g1369
+.global g1368
+.global g1367
+.global g1366
+.global g1365
+.global g1364
+.global g1363
+.global g1362
+.global g1361
+.global g1360
+.global g1359
+.global g1358
+.global g1357
+.global g1356
+.global g1355
+.global g1354
+.global g1353
+.global g1352
+.global g1351
+.global g1350
+.global g1349
+.global g1348
+.global g1347
+.global g1346
+.global g1345
+.global g1344
+.global g1343
+.global g1342
+.global g1341
+.global g1340
+.global g1339
+.global g1338
+.global g1337
+.global g1336
+.global g1335
+.global g1334
+.global g1333
+.global g1332
+.global g1331
+.global g1330
+.global g1329
+.global g1328
+.global g1327
+.global g1326
+.global g1325
+.global g1324
+.global g1323
+.global g1322
+.global g1321
+.global g1320
+.global g1319
+.global g1318
+.global g1317
+.global g1316
+.global g1315
+.global g1314
+.global g1313
+.global g1312
+.global g1311
+.global g1310
+.global g1309
+.global g1308
+.global g1307
+.global g1306
+.global g1305
+.global g1304
+.global g1303
+.global g1302
+.global g1301
+.global g1300
+.global g1299
+.global g1298
+.global g1297
+.global g1296
+.global g1295
+.global g1294
+.global g1293
+.global g1292
+.global g1291
+.global g1290
+.global g1289
+.global g1288
+.global g1287
+.global g1286
+.global g1285
+.global g1284
+.global g1283
+.global g1282
+.global g1281
+.global g1280
+.global g1279
+.global g1278
+.global g1277
+.global g1276
+.global g1275
+.global g1274
+.global g1273
+.global g1272
+.global g1271
+.global g1270
+.global g1269
+.global g1268
+.global g1267
+.global g1266
+.global g1265
+.global g1264
+.global g1263
+.global g1262
+.global g1261
+.global g1260
+.global g1259
+.global g1258
+.global g1257
+.global g1256
+.global g1255
+.global g1254
+.global g1253
+.global g1252
+.global g1251
+.global g1250
+.global g1249
+.global g1248
+.global g1247
+.global g1246
+.global g1245
+.global g1244
+.global g1243
+.global g1242
+.global g1241
+.global g1240
+.global g1239
+.global g1238
+.global g1237
+.global g1236
+.global g1235
+.global g1234
+.global g1233
+.global g1232
+.global g1231
+.global g1230
+.global g1229
+.global g1228
+.global g1227
+.global g1226
+.global g1225
+.global g1224
+.global g1223
+.global g1222
+.global g1221
+.global g1220
+.global g1219
+.global g1218
+.global g1217
+.global g1216
+.global g1215
+.global g1214
+.global g1213
+.global g1212
+.global g1211
+.global g1210
+.global g1209
+.global g1208
+.global g1207
+.global g1206
+.global g1205
+.global g1204
+.global g1203
+.global g1202
+.global g1201
+.global g1200
+.global g1199
+.global g1198
+.global g1197
+.global g1196
+.global g1195
+.global g1194
+.global g1193
+.global g1192
+.global g1191
+.global g1190
+.global g1189
+.global g1188
+.global g1187
+.global g1186
+.global g1185
+.global g1184
+.global g1183
+.global g1182
+.global g1181
+.global g1180
+.global g1179
+.global g1178
+.global g1177
+.global g1176
+.global g1175
+.global g1174
+.global g1173
+.global g1172
+.global g1171
+.global g1170
+.global g1169
+.global g1168
+.global g1167
+.global g1166
+.global g1165
+.global g1164
+.global g1163
+.global g1162
+.global g1161
+.global g1160
+.global g1159
+.global g1158
+.global g1157
+.global g1156
+.global g1155
+.global g1154
+.global g1153
+.global g1152
+.global g1151
+.global g1150
+.global g1149
+.global g1148
+.global g1147
+.global g1146
+.global g1145
+.global g1144
+.global g1143
+.global g1142
+.global g1141
+.global g1140
+.global g1139
+.global g1138
+.global g1137
+.global g1136
+.global g1135
+.global g1134
+.global g1133
+.global g1132
+.global g1131
+.global g1130
+.global g1129
+.global g1128
+.global g1127
+.global g1126
+.global g1125
+.global g1124
+.global g1123
+.global g1122
+.global g1121
+.global g1120
+.global g1119
+.global g1118
+.global g1117
+.global g1116
+.global g1115
+.global g1114
+.global g1113
+.global g1112
+.global g1111
+.global g1110
+.global g1109
+.global g1108
+.global g1107
+.global g1106
+.global g1105
+.global g1104
+.global g1103
+.global g1102
+.global g1101
+.global g1100
+.global g1099
+.global g1098
+.global g1097
+.global g1096
+.global g1095
+.global g1094
+.global g1093
+.global g1092
+.global g1091
+.global g1090
+.global g1089
+.global g1088
+.global g1087
+.global g1086
+.global g1085
+.global g1084
+.global g1083
+.global g1082
+.global g1081
+.global g1080
+.global g1079
+.global g1078
+.global g1077
+.global g1076
+.global g1075
+.global g1074
+.global g1073
+.global g1072
+.global g1071
+.global g1070
+.global g1069
+.global g1068
+.global g1067
+.global g1066
+.global g1065
+.global g1064
+.global g1063
+.global g1062
+.global g1061
+.global g1060
+.global g1059
+.global g1058
+.global g1057
+.global g1056
+.global g1055
+.global g1054
+.global g1053
+.global g1052
+.global g1051
+.global g1050
+.global g1049
+.global g1048
+.global g1047
+.global g1046
+.global g1045
+.global g1044
+.global g1043
+.global g1042
+.global g1041
+.global g1040
+.global g1039
+.global g1038
+.global g1037
+.global g1036
+.global g1035
+.global g1034
+.global g1033
+.global g1032
+.global g1031
+.global g1030
+.global g1029
+.global g1028
+.global g1027
+.global g1026
+.global g1025
+.global g1024
+.global g1023
+.global g1022
+.global g1021
+.global g1020
+.global g1019
+.global g1018
+.global g1017
+.global g1016
+.global g1015
+.global g1014
+.global g1013
+.global g1012
+.global g1011
+.global g1010
+.global g1009
+.global g1008
+.global g1007
+.global g1006
+.global g1005
+.global g1004
+.global g1003
+.global g1002
+.global g1001
+.global g1000
+.global g999
+.global g998
+.global g997
+.global g996
+.global g995
+.global g994
+.global g993
+.global g992
+.global g991
+.global g990
+.global g989
+.global g988
+.global g987
+.global g986
+.global g985
+.global g984
+.global g983
+.global g982
+.global g981
+.global g980
+.global g979
+.global g978
+.global g977
+.global g976
+.global g975
+.global g974
+.global g973
+.global g972
+.global g971
+.global g970
+.global g969
+.global g968
+.global g967
+.global g966
+.global g965
+.global g964
+.global g963
+.global g962
+.global g961
+.global g960
+.global g959
+.global g958
+.global g957
+.global g956
+.global g955
+.global g954
+.global g953
+.global g952
+.global g951
+.global g950
+.global g949
+.global g948
+.global g947
+.global g946
+.global g945
+.global g944
+.global g943
+.global g942
+.global g941
+.global g940
+.global g939
+.global g938
+.global g937
+.global g936
+.global g935
+.global g934
+.global g933
+.global g932
+.global g931
+.global g930
+.global g929
+.global g928
+.global g927
+.global g926
+.global g925
+.global g924
+.global g923
+.global g922
+.global g921
+.global g920
+.global g919
+.global g918
+.global g917
+.global g916
+.global g915
+.global g914
+.global g913
+.global g912
+.global g911
+.global g910
+.global g909
+.global g908
+.global g907
+.global g906
+.global g905
+.global g904
+.global g903
+.global g902
+.global g901
+.global g900
+.global g899
+.global g898
+.global g897
+.global g896
+.global g895
+.global g894
+.global g893
+.global g892
+.global g891
+.global g890
+.global g889
+.global g888
+.global g887
+.global g886
+.global g885
+.global g884
+.global g883
+.global g882
+.global g881
+.global g880
+.global g879
+.global g878
+.global g877
+.global g876
+.global g875
+.global g874
+.global g873
+.global g872
+.global g871
+.global g870
+.global g869
+.global g868
+.global g867
+.global g866
+.global g865
+.global g864
+.global g863
+.global g862
+.global g861
+.global g860
+.global g859
+.global g858
+.global g857
+.global g856
+.global g855
+.global g854
+.global g853
+.global g852
+.global g851
+.global g850
+.global g849
+.global g848
+.global g847
+.global g846
+.global g845
+.global g844
+.global g843
+.global g842
+.global g841
+.global g840
+.global g839
+.global g838
+.global g837
+.global g836
+.global g835
+.global g834
+.global g833
+.global g832
+.global g831
+.global g830
+.global g829
+.global g828
+.global g827
+.global g826
+.global g825
+.global g824
+.global g823
+.global g822
+.global g821
+.global g820
+.global g819
+.global g818
+.global g817
+.global g816
+.global g815
+.global g814
+.global g813
+.global g812
+.global g811
+.global g810
+.global g809
+.global g808
+.global g807
+.global g806
+.global g805
+.global g804
+.global g803
+.global g802
+.global g801
+.global g800
+.global g799
+.global g798
+.global g797
+.global g796
+.global g795
+.global g794
+.global g793
+.global g792
+.global g791
+.global g790
+.global g789
+.global g788
+.global g787
+.global g786
+.global g785
+.global g784
+.global g783
+.global g782
+.global g781
+.global g780
+.global g779
+.global g778
+.global g777
+.global g776
+.global g775
+.global g774
+.global g773
+.global g772
+.global g771
+.global g770
+.global g769
+.global g768
+.global g767
+.global g766
+.global g765
+.global g764
+.global g763
+.global g762
+.global g761
+.global g760
+.global g759
+.global g758
+.global g757
+.global g756
+.global g755
+.global g754
+.global g753
+.global g752
+.global g751
+.global g750
+.global g749
+.global g748
+.global g747
+.global g746
+.global g745
+.global g744
+.global g743
+.global g742
+.global g741
+.global g740
+.global g739
+.global g738
+.global g737
+.global g736
+.global g735
+.global g734
+.global g733
+.global g732
+.global g731
+.global g730
+.global g729
+.global g728
+.global g727
+.global g726
+.global g725
+.global g724
+.global g723
+.global g722
+.global g721
+.global g720
+.global g719
+.global g718
+.global g717
+.global g716
+.global g715
+.global g714
+.global g713
+.global g712
+.global g711
+.global g710
+.global g709
+.global g708
+.global g707
+.global g706
+.global g705
+.global g704
+.global g703
+.global g702
+.global g701
+.global g700
+.global g699
+.global g698
+.global g697
+.global g696
+.global g695
+.global g694
+.global g693
+.global g692
+.global g691
+.global g690
+.global g689
+.global g688
+.global g687
+.global g686
+.global g685
+.global g684
+.global g683
+.global g682
+.global g681
+.global g680
+.global g679
+.global g678
+.global g677
+.global g676
+.global g675
+.global g674
+.global g673
+.global g672
+.global g671
+.global g670
+.global g669
+.global g668
+.global g667
+.global g666
+.global g665
+.global g664
+.global g663
+.global g662
+.global g661
+.global g660
+.global g659
+.global g658
+.global g657
+.global g656
+.global g655
+.global g654
+.global g653
+.global g652
+.global g651
+.global g650
+.global g649
+.global g648
+.global g647
+.global g646
+.global g645
+.global g644
+.global g643
+.global g642
+.global g641
+.global g640
+.global g639
+.global g638
+.global g637
+.global g636
+.global g635
+.global g634
+.global g633
+.global g632
+.global g631
+.global g630
+.global g629
+.global g628
+.global g627
+.global g626
+.global g625
+.global g624
+.global g623
+.global g622
+.global g621
+.global g620
+.global g619
+.global g618
+.global g617
+.global g616
+.global g615
+.global g614
+.global g613
+.global g612
+.global g611
+.global g610
+.global g609
+.global g608
+.global g607
+.global g606
+.global g605
+.global g604
+.global g603
+.global g602
+.global g601
+.global g600
+.global g599
+.global g598
+.global g597
+.global g596
+.global g595
+.global g594
+.global g593
+.global g592
+.global g591
+.global g590
+.global g589
+.global g588
+.global g587
+.global g586
+.global g585
+.global g584
+.global g583
+.global g582
+.global g581
+.global g580
+.global g579
+.global g578
+.global g577
+.global g576
+.global g575
+.global g574
+.global g573
+.global g572
+.global g571
+.global g570
+.global g569
+.global g568
+.global g567
+.global g566
+.global g565
+.global g564
+.global g563
+.global g562
+.global g561
+.global g560
+.global g559
+.global g558
+.global g557
+.global g556
+.global g555
+.global g554
+.global g553
+.global g552
+.global g551
+.global g550
+.global g549
+.global g548
+.global g547
+.global g546
+.global g545
+.global g544
+.global g543
+.global g542
+.global g541
+.global g540
+.global g539
+.global g538
+.global g537
+.global g536
+.global g535
+.global g534
+.global g533
+.global g532
+.global g531
+.global g530
+.global g529
+.global g528
+.global g527
+.global g526
+.global g525
+.global g524
+.global g523
+.global g522
+.global g521
+.global g520
+.global g519
+.global g518
+.global g517
+.global g516
+.global g515
+.global g514
+.global g513
+.global g512
+.global g511
+.global g510
+.global g509
+.global g508
+.global g507
+.global g506
+.global g505
+.global g504
+.global g503
+.global g502
+.global g501
+.global g500
+.global g499
+.global g498
+.global g497
+.global g496
+.global g495
+.global g494
+.global g493
+.global g492
+.global g491
+.global g490
+.global g489
+.global g488
+.global g487
+.global g486
+.global g485
+.global g484
+.global g483
+.global g482
+.global g481
+.global g480
+.global g479
+.global g478
+.global g477
+.global g476
+.global g475
+.global g474
+.global g473
+.global g472
+.global g471
+.global g470
+.global g469
+.global g468
+.global g467
+.global g466
+.global g465
+.global g464
+.global g463
+.global g462
+.global g461
+.global g460
+.global g459
+.global g458
+.global g457
+.global g456
+.global g455
+.global g454
+.global g453
+.global g452
+.global g451
+.global g450
+.global g449
+.global g448
+.global g447
+.global g446
+.global g445
+.global g444
+.global g443
+.global g442
+.global g441
+.global g440
+.global g439
+.global g438
+.global g437
+.global g436
+.global g435
+.global g434
+.global g433
+.global g432
+.global g431
+.global g430
+.global g429
+.global g428
+.global g427
+.global g426
+.global g425
+.global g424
+.global g423
+.global g422
+.global g421
+.global g420
+.global g419
+.global g418
+.global g417
+.global g416
+.global g415
+.global g414
+.global g413
+.global g412
+.global g411
+.global g410
+.global g409
+.global g408
+.global g407
+.global g406
+.global g405
+.global g404
+.global g403
+.global g402
+.global g401
+.global g400
+.global g399
+.global g398
+.global g397
+.global g396
+.global g395
+.global g394
+.global g393
+.global g392
+.global g391
+.global g390
+.global g389
+.global g388
+.global g387
+.global g386
+.global g385
+.global g384
+.global g383
+.global g382
+.global g381
+.global g380
+.global g379
+.global g378
+.global g377
+.global g376
+.global g375
+.global g374
+.global g373
+.global g372
+.global g371
+.global g370
+.global g369
+.global g368
+.global g367
+.global g366
+.global g365
+.global g364
+.global g363
+.global g362
+.global g361
+.global g360
+.global g359
+.global g358
+.global g357
+.global g356
+.global g355
+.global g354
+.global g353
+.global g352
+.global g351
+.global g350
+.global g349
+.global g348
+.global g347
+.global g346
+.global g345
+.global g344
+.global g343
+.global g342
+.global g341
+.global g340
+.global g339
+.global g338
+.global g337
+.global g336
+.global g335
+.global g334
+.global g333
+.global g332
+.global g331
+.global g330
+.global g329
+.global g328
+.global g327
+.global g326
+.global g325
+.global g324
+.global g323
+.global g322
+.global g321
+.global g320
+.global g319
+.global g318
+.global g317
+.global g316
+.global g315
+.global g314
+.global g313
+.global g312
+.global g311
+.global g310
+.global g309
+.global g308
+.global g307
+.global g306
+.global g305
+.global g304
+.global g303
+.global g302
+.global g301
+.global g300
+.global g299
+.global g298
+.global g297
+.global g296
+.global g295
+.global g294
+.global g293
+.global g292
+.global g291
+.global g290
+.global g289
+.global g288
+.global g287
+.global g286
+.global g285
+.global g284
+.global g283
+.global g282
+.global g281
+.global g280
+.global g279
+.global g278
+.global g277
+.global g276
+.global g275
+.global g274
+.global g273
+.global g272
+.global g271
+.global g270
+.global g269
+.global g268
+.global g267
+.global g266
+.global g265
+.global g264
+.global g263
+.global g262
+.global g261
+.global g260
+.global g259
+.global g258
+.global g257
+.global g256
+.global g255
+.global g254
+.global g253
+.global g252
+.global g251
+.global g250
+.global g249
+.global g248
+.global g247
+.global g246
+.global g245
+.global g244
+.global g243
+.global g242
+.global g241
+.global g240
+.global g239
+.global g238
+.global g237
+.global g236
+.global g235
+.global g234
+.global g233
+.global g232
+.global g231
+.global g230
+.global g229
+.global g228
+.global g227
+.global g226
+.global g225
+.global g224
+.global g223
+.global g222
+.global g221
+.global g220
+.global g219
+.global g218
+.global g217
+.global g216
+.global g215
+.global g214
+.global g213
+.global g212
+.global g211
+.global g210
+.global g209
+.global g208
+.global g207
+.global g206
+.global g205
+.global g204
+.global g203
+.global g202
+.global g201
+.global g200
+.global g199
+.global g198
+.global g197
+.global g196
+.global g195
+.global g194
+.global g193
+.global g192
+.global g191
+.global g190
+.global g189
+.global g188
+.global g187
+.global g186
+.global g185
+.global g184
+.global g183
+.global g182
+.global g181
+.global g180
+.global g179
+.global g178
+.global g177
+.global g176
+.global g175
+.global g174
+.global g173
+.global g172
+.global g171
+.global g170
+.global g169
+.global g168
+.global g167
+.global g166
+.global g165
+.global g164
+.global g163
+.global g162
+.global g161
+.global g160
+.global g159
+.global g158
+.global g157
+.global g156
+.global g155
+.global g154
+.global g153
+.global g152
+.global g151
+.global g150
+.global g149
+.global g148
+.global g147
+.global g146
+.global g145
+.global g144
+.global g143
+.global g142
+.global g141
+.global g140
+.global g139
+.global g138
+.global g137
+.global g136
+.global g135
+.global g134
+.global g133
+.global g132
+.global g131
+.global g130
+.global g129
+.global g128
+.global g127
+.global g126
+.global g125
+.global g124
+.global g123
+.global g122
+.global g121
+.global g120
+.global g119
+.global g118
+.global g117
+.global g116
+.global g115
+.global g114
+.global g113
+.global g112
+.global g111
+.global g110
+.global g109
+.global g108
+.global g107
+.global g106
+.global g105
+.global g104
+.global g103
+.global g102
+.global g101
+.global g100
+.global g99
+.global g98
+.global g97
+.global g96
+.global g95
+.global g94
+.global g93
+.global g92
+.global g91
+.global g90
+.global g89
+.global g88
+.global g87
+.global g86
+.global g85
+.global g84
+.global g83
+.global g82
+.global g81
+.global g80
+.global g79
+.global g78
+.global g77
+.global g76
+.global g75
+.global g74
+.global g73
+.global g72
+.global g71
+.global g70
+.global g69
+.global g68
+.global g67
+.global g66
+.global g65
+.global g64
+.global g63
+.global g62
+.global g61
+.global g60
+.global g59
+.global g58
+.global g57
+.global g56
+.global g55
+.global g54
+.global g53
+.global g52
+.global g51
+.global g50
+.global g49
+.global g48
+.global g47
+.global g46
+.global g45
+.global g44
+.global g43
+.global g42
+.global g41
+.global g40
+.global g39
+.global g38
+.global g37
+.global g36
+.global g35
+.global g34
+.global g33
+.global g32
+.global g31
+.global g30
+.global g29
+.global g28
+.global g27
+.global g26
+.global g25
+.global g24
+.global g23
+.global g22
+.global g21
+.global g20
+.global g19
+.global g18
+.global g17
+.global g16
+.global g15
+.global g14
+.global g13
+.global g12
+.global g11
+.global g10
+.global g9
+.global g8
+.global g7
+.global g6
+.global g5
+.global g4
+.global g3
+.global g2
+.global g1
+.global g0
+.bss
+.align 8
+g4999:
+  .zero 8
+.align 8
+g4998:
+  .zero 8
+.align 2
+g4997:
+  .zero 2
+.align 1
+g4996:
+  .zero 1
+.align 8
+g4995:
+  .zero 8
+.align 1
+g4994:
+  .zero 1
+.align 1
+g4993:
+  .zero 1
+.align 8
+g4992:
+  .zero 8
+.align 8
+g4991:
+  .zero 8
+.align 2
+g4990:
+  .zero 2
+.align 1
+g4989:
+  .zero 1
+.align 4
+g4988:
+  .zero 4
+.align 4
+g4987:
+  .zero 4
+.align 1
+g4986:
+  .zero 1
+.align 8
+g4985:
+  .zero 8
+.align 2
+g4984:
+  .zero 2
+.align 8
+g4983:
+  .zero 8
+.align 2
+g4982:
+  .zero 2
+.align 4
+g4981:
+  .zero 4
+.align 2
+g4980:
+  .zero 2
+.align 4
+g4979:
+  .zero 4
+.align 2
+g4978:
+  .zero 2
+.align 8
+g4977:
+  .zero 8
+.align 2
+g4976:
+  .zero 2
+.align 2
+g4975:
+  .zero 2
+.align 1
+g4974:
+  .zero 1
+.align 1
+g4973:
+  .zero 1
+.align 8
+g4972:
+  .zero 8
+.align 4
+g4971:
+  .zero 4
+.align 2
+g4970:
+  .zero 2
+.align 8
+g4969:
+  .zero 8
+.align 1
+g4968:
+  .zero 1
+.align 2
+g4967:
+  .zero 2
+.align 8
+g4966:
+  .zero 8
+.align 2
+g4965:
+  .zero 2
+.align 2
+g4964:
+  .zero 2
+.align 2
+g4963:
+  .zero 2
+.align 8
+g4962:
+  .zero 8
+.align 4
+g4961:
+  .zero 4
+.align 2
+g4960:
+  .zero 2
+.align 2
+g4959:
+  .zero 2
+.align 8
+g4958:
+  .zero 8
+.align 8
+g4957:
+  .zero 8
+.align 4
+g4956:
+  .zero 4
+.align 1
+g4955:
+  .zero 1
+.align 8
+g4954:
+  .zero 8
+.align 2
+g4953:
+  .zero 2
+.align 8
+g4952:
+  .zero 8
+.align 2
+g4951:
+  .zero 2
+.align 4
+g4950:
+  .zero 4
+.align 1
+g4949:
+  .zero 1
+.align 4
+g4948:
+  .zero 4
+.align 8
+g4947:
+  .zero 8
+.align 8
+g4946:
+  .zero 8
+.align 1
+g4945:
+  .zero 1
+.align 4
+g4944:
+  .zero 4
+.align 4
+g4943:
+  .zero 4
+.align 2
+g4942:
+  .zero 2
+.align 4
+g4941:
+  .zero 4
+.align 8
+g4940:
+  .zero 8
+.align 4
+g4939:
+  .zero 4
+.align 8
+g4938:
+  .zero 8
+.align 1
+g4937:
+  .zero 1
+.align 1
+g4936:
+  .zero 1
+.align 1
+g4935:
+  .zero 1
+.align 8
+g4934:
+  .zero 8
+.align 1
+g4933:
+  .zero 1
+.align 4
+g4932:
+  .zero 4
+.align 4
+g4931:
+  .zero 4
+.align 2
+g4930:
+  .zero 2
+.align 2
+g4929:
+  .zero 2
+.align 4
+g4928:
+  .zero 4
+.align 2
+g4927:
+  .zero 2
+.align 1
+g4926:
+  .zero 1
+.align 4
+g4925:
+  .zero 4
+.align 4
+g4924:
+  .zero 4
+.align 2
+g4923:
+  .zero 2
+.align 2
+g4922:
+  .zero 2
+.align 1
+g4921:
+  .zero 1
+.align 8
+g4920:
+  .zero 8
+.align 1
+g4919:
+  .zero 1
+.align 4
+g4918:
+  .zero 4
+.align 4
+g4917:
+  .zero 4
+.align 4
+g4916:
+  .zero 4
+.align 2
+g4915:
+  .zero 2
+.align 2
+g4914:
+  .zero 2
+.align 8
+g4913:
+  .zero 8
+.align 2
+g4912:
+  .zero 2
+.align 4
+g4911:
+  .zero 4
+.align 2
+g4910:
+  .zero 2
+.align 2
+g4909:
+  .zero 2
+.align 1
+g4908:
+  .zero 1
+.align 4
+g4907:
+  .zero 4
+.align 2
+g4906:
+  .zero 2
+.align 4
+g4905:
+  .zero 4
+.align 2
+g4904:
+  .zero 2
+.align 4
+g4903:
+  .zero 4
+.align 4
+g4902:
+  .zero 4
+.align 1
+g4901:
+  .zero 1
+.align 2
+g4900:
+  .zero 2
+.align 8
+g4899:
+  .zero 8
+.align 2
+g4898:
+  .zero 2
+.align 8
+g4897:
+  .zero 8
+.align 4
+g4896:
+  .zero 4
+.align 4
+g4895:
+  .zero 4
+.align 4
+g4894:
+  .zero 4
+.align 2
+g4893:
+  .zero 2
+.align 4
+g4892:
+  .zero 4
+.align 1
+g4891:
+  .zero 1
+.align 8
+g4890:
+  .zero 8
+.align 4
+g4889:
+  .zero 4
+.align 8
+g4888:
+  .zero 8
+.align 4
+g4887:
+  .zero 4
+.align 8
+g4886:
+  .zero 8
+.align 2
+g4885:
+  .zero 2
+.align 1
+g4884:
+  .zero 1
+.align 2
+g4883:
+  .zero 2
+.align 8
+g4882:
+  .zero 8
+.align 4
+g4881:
+  .zero 4
+.align 1
+g4880:
+  .zero 1
+.align 2
+g4879:
+  .zero 2
+.align 1
+g4878:
+  .zero 1
+.align 2
+g4877:
+  .zero 2
+.align 4
+g4876:
+  .zero 4
+.align 8
+g4875:
+  .zero 8
+.align 2
+g4874:
+  .zero 2
+.align 4
+g4873:
+  .zero 4
+.align 1
+g4872:
+  .zero 1
+.align 8
+g4871:
+  .zero 8
+.align 4
+g4870:
+  .zero 4
+.align 1
+g4869:
+  .zero 1
+.align 8
+g4868:
+  .zero 8
+.align 1
+g4867:
+  .zero 1
+.align 4
+g4866:
+  .zero 4
+.align 4
+g4865:
+  .zero 4
+.align 1
+g4864:
+  .zero 1
+.align 2
+g4863:
+  .zero 2
+.align 2
+g4862:
+  .zero 2
+.align 1
+g4861:
+  .zero 1
+.align 8
+g4860:
+  .zero 8
+.align 2
+g4859:
+  .zero 2
+.align 8
+g4858:
+  .zero 8
+.align 1
+g4857:
+  .zero 1
+.align 8
+g4856:
+  .zero 8
+.align 1
+g4855:
+  .zero 1
+.align 1
+g4854:
+  .zero 1
+.align 1
+g4853:
+  .zero 1
+.align 4
+g4852:
+  .zero 4
+.align 8
+g4851:
+  .zero 8
+.align 8
+g4850:
+  .zero 8
+.align 2
+g4849:
+  .zero 2
+.align 4
+g4848:
+  .zero 4
+.align 4
+g4847:
+  .zero 4
+.align 4
+g4846:
+  .zero 4
+.align 8
+g4845:
+  .zero 8
+.align 2
+g4844:
+  .zero 2
+.align 1
+g4843:
+  .zero 1
+.align 8
+g4842:
+  .zero 8
+.align 1
+g4841:
+  .zero 1
+.align 4
+g4840:
+  .zero 4
+.align 8
+g4839:
+  .zero 8
+.align 1
+g4838:
+  .zero 1
+.align 8
+g4837:
+  .zero 8
+.align 1
+g4836:
+  .zero 1
+.align 2
+g4835:
+  .zero 2
+.align 2
+g4834:
+  .zero 2
+.align 1
+g4833:
+  .zero 1
+.align 1
+g4832:
+  .zero 1
+.align 1
+g4831:
+  .zero 1
+.align 2
+g4830:
+  .zero 2
+.align 4
+g4829:
+  .zero 4
+.align 2
+g4828:
+  .zero 2
+.align 2
+g4827:
+  .zero 2
+.align 8
+g4826:
+  .zero 8
+.align 4
+g4825:
+  .zero 4
+.align 2
+g4824:
+  .zero 2
+.align 2
+g4823:
+  .zero 2
+.align 4
+g4822:
+  .zero 4
+.align 8
+g4821:
+  .zero 8
+.align 4
+g4820:
+  .zero 4
+.align 2
+g4819:
+  .zero 2
+.align 2
+g4818:
+  .zero 2
+.align 8
+g4817:
+  .zero 8
+.align 4
+g4816:
+  .zero 4
+.align 2
+g4815:
+  .zero 2
+.align 2
+g4814:
+  .zero 2
+.align 1
+g4813:
+  .zero 1
+.align 2
+g4812:
+  .zero 2
+.align 1
+g4811:
+  .zero 1
+.align 2
+g4810:
+  .zero 2
+.align 1
+g4809:
+  .zero 1
+.align 1
+g4808:
+  .zero 1
+.align 1
+g4807:
+  .zero 1
+.align 1
+g4806:
+  .zero 1
+.align 4
+g4805:
+  .zero 4
+.align 1
+g4804:
+  .zero 1
+.align 1
+g4803:
+  .zero 1
+.align 1
+g4802:
+  .zero 1
+.align 8
+g4801:
+  .zero 8
+.align 8
+g4800:
+  .zero 8
+.align 2
+g4799:
+  .zero 2
+.align 2
+g4798:
+  .zero 2
+.align 1
+g4797:
+  .zero 1
+.align 4
+g4796:
+  .zero 4
+.align 2
+g4795:
+  .zero 2
+.align 2
+g4794:
+  .zero 2
+.align 1
+g4793:
+  .zero 1
+.align 2
+g4792:
+  .zero 2
+.align 2
+g4791:
+  .zero 2
+.align 2
+g4790:
+  .zero 2
+.align 1
+g4789:
+  .zero 1
+.align 1
+g4788:
+  .zero 1
+.align 4
+g4787:
+  .zero 4
+.align 4
+g4786:
+  .zero 4
+.align 1
+g4785:
+  .zero 1
+.align 2
+g4784:
+  .zero 2
+.align 4
+g4783:
+  .zero 4
+.align 1
+g4782:
+  .zero 1
+.align 1
+g4781:
+  .zero 1
+.align 2
+g4780:
+  .zero 2
+.align 4
+g4779:
+  .zero 4
+.align 8
+g4778:
+  .zero 8
+.align 2
+g4777:
+  .zero 2
+.align 8
+g4776:
+  .zero 8
+.align 8
+g4775:
+  .zero 8
+.align 2
+g4774:
+  .zero 2
+.align 8
+g4773:
+  .zero 8
+.align 4
+g4772:
+  .zero 4
+.align 1
+g4771:
+  .zero 1
+.align 4
+g4770:
+  .zero 4
+.align 8
+g4769:
+  .zero 8
+.align 4
+g4768:
+  .zero 4
+.align 2
+g4767:
+  .zero 2
+.align 1
+g4766:
+  .zero 1
+.align 2
+g4765:
+  .zero 2
+.align 4
+g4764:
+  .zero 4
+.align 4
+g4763:
+  .zero 4
+.align 2
+g4762:
+  .zero 2
+.align 4
+g4761:
+  .zero 4
+.align 2
+g4760:
+  .zero 2
+.align 1
+g4759:
+  .zero 1
+.align 2
+g4758:
+  .zero 2
+.align 1
+g4757:
+  .zero 1
+.align 8
+g4756:
+  .zero 8
+.align 2
+g4755:
+  .zero 2
+.align 1
+g4754:
+  .zero 1
+.align 8
+g4753:
+  .zero 8
+.align 8
+g4752:
+  .zero 8
+.align 8
+g4751:
+  .zero 8
+.align 2
+g4750:
+  .zero 2
+.align 4
+g4749:
+  .zero 4
+.align 1
+g4748:
+  .zero 1
+.align 2
+g4747:
+  .zero 2
+.align 1
+g4746:
+  .zero 1
+.align 8
+g4745:
+  .zero 8
+.align 2
+g4744:
+  .zero 2
+.align 4
+g4743:
+  .zero 4
+.align 2
+g4742:
+  .zero 2
+.align 4
+g4741:
+  .zero 4
+.align 1
+g4740:
+  .zero 1
+.align 8
+g4739:
+  .zero 8
+.align 1
+g4738:
+  .zero 1
+.align 4
+g4737:
+  .zero 4
+.align 2
+g4736:
+  .zero 2
+.align 4
+g4735:
+  .zero 4
+.align 8
+g4734:
+  .zero 8
+.align 1
+g4733:
+  .zero 1
+.align 2
+g4732:
+  .zero 2
+.align 8
+g4731:
+  .zero 8
+.align 1
+g4730:
+  .zero 1
+.align 8
+g4729:
+  .zero 8
+.align 8
+g4728:
+  .zero 8
+.align 2
+g4727:
+  .zero 2
+.align 4
+g4726:
+  .zero 4
+.align 2
+g4725:
+  .zero 2
+.align 8
+g4724:
+  .zero 8
+.align 8
+g4723:
+  .zero 8
+.align 2
+g4722:
+  .zero 2
+.align 1
+g4721:
+  .zero 1
+.align 8
+g4720:
+  .zero 8
+.align 8
+g4719:
+  .zero 8
+.align 2
+g4718:
+  .zero 2
+.align 1
+g4717:
+  .zero 1
+.align 1
+g4716:
+  .zero 1
+.align 1
+g4715:
+  .zero 1
+.align 2
+g4714:
+  .zero 2
+.align 8
+g4713:
+  .zero 8
+.align 2
+g4712:
+  .zero 2
+.align 2
+g4711:
+  .zero 2
+.align 8
+g4710:
+  .zero 8
+.align 8
+g4709:
+  .zero 8
+.align 2
+g4708:
+  .zero 2
+.align 1
+g4707:
+  .zero 1
+.align 1
+g4706:
+  .zero 1
+.align 1
+g4705:
+  .zero 1
+.align 1
+g4704:
+  .zero 1
+.align 1
+g4703:
+  .zero 1
+.align 1
+g4702:
+  .zero 1
+.align 1
+g4701:
+  .zero 1
+.align 1
+g4700:
+  .zero 1
+.align 1
+g4699:
+  .zero 1
+.align 2
+g4698:
+  .zero 2
+.align 2
+g4697:
+  .zero 2
+.align 8
+g4696:
+  .zero 8
+.align 2
+g4695:
+  .zero 2
+.align 1
+g4694:
+  .zero 1
+.align 2
+g4693:
+  .zero 2
+.align 1
+g4692:
+  .zero 1
+.align 4
+g4691:
+  .zero 4
+.align 1
+g4690:
+  .zero 1
+.align 8
+g4689:
+  .zero 8
+.align 4
+g4688:
+  .zero 4
+.align 2
+g4687:
+  .zero 2
+.align 8
+g4686:
+  .zero 8
+.align 4
+g4685:
+  .zero 4
+.align 1
+g4684:
+  .zero 1
+.align 4
+g4683:
+  .zero 4
+.align 8
+g4682:
+  .zero 8
+.align 8
+g4681:
+  .zero 8
+.align 8
+g4680:
+  .zero 8
+.align 8
+g4679:
+  .zero 8
+.align 4
+g4678:
+  .zero 4
+.align 4
+g4677:
+  .zero 4
+.align 1
+g4676:
+  .zero 1
+.align 2
+g4675:
+  .zero 2
+.align 4
+g4674:
+  .zero 4
+.align 2
+g4673:
+  .zero 2
+.align 4
+g4672:
+  .zero 4
+.align 8
+g4671:
+  .zero 8
+.align 1
+g4670:
+  .zero 1
+.align 1
+g4669:
+  .zero 1
+.align 2
+g4668:
+  .zero 2
+.align 2
+g4667:
+  .zero 2
+.align 1
+g4666:
+  .zero 1
+.align 2
+g4665:
+  .zero 2
+.align 4
+g4664:
+  .zero 4
+.align 1
+g4663:
+  .zero 1
+.align 4
+g4662:
+  .zero 4
+.align 4
+g4661:
+  .zero 4
+.align 2
+g4660:
+  .zero 2
+.align 1
+g4659:
+  .zero 1
+.align 2
+g4658:
+  .zero 2
+.align 2
+g4657:
+  .zero 2
+.align 1
+g4656:
+  .zero 1
+.align 1
+g4655:
+  .zero 1
+.align 8
+g4654:
+  .zero 8
+.align 1
+g4653:
+  .zero 1
+.align 8
+g4652:
+  .zero 8
+.align 8
+g4651:
+  .zero 8
+.align 4
+g4650:
+  .zero 4
+.align 1
+g4649:
+  .zero 1
+.align 1
+g4648:
+  .zero 1
+.align 8
+g4647:
+  .zero 8
+.align 4
+g4646:
+  .zero 4
+.align 1
+g4645:
+  .zero 1
+.align 2
+g4644:
+  .zero 2
+.align 2
+g4643:
+  .zero 2
+.align 1
+g4642:
+  .zero 1
+.align 4
+g4641:
+  .zero 4
+.align 1
+g4640:
+  .zero 1
+.align 8
+g4639:
+  .zero 8
+.align 1
+g4638:
+  .zero 1
+.align 2
+g4637:
+  .zero 2
+.align 4
+g4636:
+  .zero 4
+.align 2
+g4635:
+  .zero 2
+.align 2
+g4634:
+  .zero 2
+.align 8
+g4633:
+  .zero 8
+.align 4
+g4632:
+  .zero 4
+.align 4
+g4631:
+  .zero 4
+.align 4
+g4630:
+  .zero 4
+.align 1
+g4629:
+  .zero 1
+.align 1
+g4628:
+  .zero 1
+.align 1
+g4627:
+  .zero 1
+.align 2
+g4626:
+  .zero 2
+.align 1
+g4625:
+  .zero 1
+.align 2
+g4624:
+  .zero 2
+.align 8
+g4623:
+  .zero 8
+.align 4
+g4622:
+  .zero 4
+.align 1
+g4621:
+  .zero 1
+.align 4
+g4620:
+  .zero 4
+.align 8
+g4619:
+  .zero 8
+.align 8
+g4618:
+  .zero 8
+.align 2
+g4617:
+  .zero 2
+.align 4
+g4616:
+  .zero 4
+.align 8
+g4615:
+  .zero 8
+.align 8
+g4614:
+  .zero 8
+.align 8
+g4613:
+  .zero 8
+.align 8
+g4612:
+  .zero 8
+.align 8
+g4611:
+  .zero 8
+.align 8
+g4610:
+  .zero 8
+.align 2
+g4609:
+  .zero 2
+.align 1
+g4608:
+  .zero 1
+.align 8
+g4607:
+  .zero 8
+.align 1
+g4606:
+  .zero 1
+.align 1
+g4605:
+  .zero 1
+.align 2
+g4604:
+  .zero 2
+.align 1
+g4603:
+  .zero 1
+.align 4
+g4602:
+  .zero 4
+.align 1
+g4601:
+  .zero 1
+.align 1
+g4600:
+  .zero 1
+.align 1
+g4599:
+  .zero 1
+.align 2
+g4598:
+  .zero 2
+.align 4
+g4597:
+  .zero 4
+.align 1
+g4596:
+  .zero 1
+.align 2
+g4595:
+  .zero 2
+.align 8
+g4594:
+  .zero 8
+.align 4
+g4593:
+  .zero 4
+.align 4
+g4592:
+  .zero 4
+.align 4
+g4591:
+  .zero 4
+.align 1
+g4590:
+  .zero 1
+.align 2
+g4589:
+  .zero 2
+.align 4
+g4588:
+  .zero 4
+.align 4
+g4587:
+  .zero 4
+.align 2
+g4586:
+  .zero 2
+.align 4
+g4585:
+  .zero 4
+.align 1
+g4584:
+  .zero 1
+.align 2
+g4583:
+  .zero 2
+.align 1
+g4582:
+  .zero 1
+.align 8
+g4581:
+  .zero 8
+.align 8
+g4580:
+  .zero 8
+.align 8
+g4579:
+  .zero 8
+.align 4
+g4578:
+  .zero 4
+.align 2
+g4577:
+  .zero 2
+.align 2
+g4576:
+  .zero 2
+.align 4
+g4575:
+  .zero 4
+.align 4
+g4574:
+  .zero 4
+.align 8
+g4573:
+  .zero 8
+.align 1
+g4572:
+  .zero 1
+.align 8
+g4571:
+  .zero 8
+.align 1
+g4570:
+  .zero 1
+.align 8
+g4569:
+  .zero 8
+.align 1
+g4568:
+  .zero 1
+.align 8
+g4567:
+  .zero 8
+.align 2
+g4566:
+  .zero 2
+.align 1
+g4565:
+  .zero 1
+.align 8
+g4564:
+  .zero 8
+.align 8
+g4563:
+  .zero 8
+.align 4
+g4562:
+  .zero 4
+.align 2
+g4561:
+  .zero 2
+.align 8
+g4560:
+  .zero 8
+.align 8
+g4559:
+  .zero 8
+.align 1
+g4558:
+  .zero 1
+.align 1
+g4557:
+  .zero 1
+.align 1
+g4556:
+  .zero 1
+.align 1
+g4555:
+  .zero 1
+.align 4
+g4554:
+  .zero 4
+.align 2
+g4553:
+  .zero 2
+.align 2
+g4552:
+  .zero 2
+.align 4
+g4551:
+  .zero 4
+.align 2
+g4550:
+  .zero 2
+.align 1
+g4549:
+  .zero 1
+.align 2
+g4548:
+  .zero 2
+.align 1
+g4547:
+  .zero 1
+.align 4
+g4546:
+  .zero 4
+.align 8
+g4545:
+  .zero 8
+.align 2
+g4544:
+  .zero 2
+.align 8
+g4543:
+  .zero 8
+.align 8
+g4542:
+  .zero 8
+.align 4
+g4541:
+  .zero 4
+.align 4
+g4540:
+  .zero 4
+.align 2
+g4539:
+  .zero 2
+.align 4
+g4538:
+  .zero 4
+.align 4
+g4537:
+  .zero 4
+.align 8
+g4536:
+  .zero 8
+.align 8
+g4535:
+  .zero 8
+.align 4
+g4534:
+  .zero 4
+.align 8
+g4533:
+  .zero 8
+.align 2
+g4532:
+  .zero 2
+.align 2
+g4531:
+  .zero 2
+.align 1
+g4530:
+  .zero 1
+.align 1
+g4529:
+  .zero 1
+.align 8
+g4528:
+  .zero 8
+.align 4
+g4527:
+  .zero 4
+.align 4
+g4526:
+  .zero 4
+.align 8
+g4525:
+  .zero 8
+.align 8
+g4524:
+  .zero 8
+.align 4
+g4523:
+  .zero 4
+.align 1
+g4522:
+  .zero 1
+.align 2
+g4521:
+  .zero 2
+.align 8
+g4520:
+  .zero 8
+.align 2
+g4519:
+  .zero 2
+.align 1
+g4518:
+  .zero 1
+.align 1
+g4517:
+  .zero 1
+.align 2
+g4516:
+  .zero 2
+.align 1
+g4515:
+  .zero 1
+.align 2
+g4514:
+  .zero 2
+.align 2
+g4513:
+  .zero 2
+.align 2
+g4512:
+  .zero 2
+.align 8
+g4511:
+  .zero 8
+.align 2
+g4510:
+  .zero 2
+.align 8
+g4509:
+  .zero 8
+.align 4
+g4508:
+  .zero 4
+.align 4
+g4507:
+  .zero 4
+.align 1
+g4506:
+  .zero 1
+.align 4
+g4505:
+  .zero 4
+.align 8
+g4504:
+  .zero 8
+.align 1
+g4503:
+  .zero 1
+.align 8
+g4502:
+  .zero 8
+.align 1
+g4501:
+  .zero 1
+.align 8
+g4500:
+  .zero 8
+.align 4
+g4499:
+  .zero 4
+.align 8
+g4498:
+  .zero 8
+.align 8
+g4497:
+  .zero 8
+.align 2
+g4496:
+  .zero 2
+.align 4
+g4495:
+  .zero 4
+.align 8
+g4494:
+  .zero 8
+.align 1
+g4493:
+  .zero 1
+.align 8
+g4492:
+  .zero 8
+.align 2
+g4491:
+  .zero 2
+.align 2
+g4490:
+  .zero 2
+.align 1
+g4489:
+  .zero 1
+.align 8
+g4488:
+  .zero 8
+.align 1
+g4487:
+  .zero 1
+.align 8
+g4486:
+  .zero 8
+.align 8
+g4485:
+  .zero 8
+.align 8
+g4484:
+  .zero 8
+.align 8
+g4483:
+  .zero 8
+.align 2
+g4482:
+  .zero 2
+.align 8
+g4481:
+  .zero 8
+.align 8
+g4480:
+  .zero 8
+.align 8
+g4479:
+  .zero 8
+.align 2
+g4478:
+  .zero 2
+.align 2
+g4477:
+  .zero 2
+.align 1
+g4476:
+  .zero 1
+.align 4
+g4475:
+  .zero 4
+.align 2
+g4474:
+  .zero 2
+.align 2
+g4473:
+  .zero 2
+.align 2
+g4472:
+  .zero 2
+.align 2
+g4471:
+  .zero 2
+.align 8
+g4470:
+  .zero 8
+.align 4
+g4469:
+  .zero 4
+.align 4
+g4468:
+  .zero 4
+.align 1
+g4467:
+  .zero 1
+.align 4
+g4466:
+  .zero 4
+.align 2
+g4465:
+  .zero 2
+.align 4
+g4464:
+  .zero 4
+.align 8
+g4463:
+  .zero 8
+.align 4
+g4462:
+  .zero 4
+.align 8
+g4461:
+  .zero 8
+.align 4
+g4460:
+  .zero 4
+.align 1
+g4459:
+  .zero 1
+.align 2
+g4458:
+  .zero 2
+.align 8
+g4457:
+  .zero 8
+.align 4
+g4456:
+  .zero 4
+.align 4
+g4455:
+  .zero 4
+.align 2
+g4454:
+  .zero 2
+.align 4
+g4453:
+  .zero 4
+.align 2
+g4452:
+  .zero 2
+.align 1
+g4451:
+  .zero 1
+.align 4
+g4450:
+  .zero 4
+.align 1
+g4449:
+  .zero 1
+.align 1
+g4448:
+  .zero 1
+.align 8
+g4447:
+  .zero 8
+.align 2
+g4446:
+  .zero 2
+.align 2
+g4445:
+  .zero 2
+.align 4
+g4444:
+  .zero 4
+.align 8
+g4443:
+  .zero 8
+.align 4
+g4442:
+  .zero 4
+.align 1
+g4441:
+  .zero 1
+.align 2
+g4440:
+  .zero 2
+.align 4
+g4439:
+  .zero 4
+.align 8
+g4438:
+  .zero 8
+.align 8
+g4437:
+  .zero 8
+.align 4
+g4436:
+  .zero 4
+.align 2
+g4435:
+  .zero 2
+.align 8
+g4434:
+  .zero 8
+.align 4
+g4433:
+  .zero 4
+.align 8
+g4432:
+  .zero 8
+.align 8
+g4431:
+  .zero 8
+.align 1
+g4430:
+  .zero 1
+.align 8
+g4429:
+  .zero 8
+.align 4
+g4428:
+  .zero 4
+.align 1
+g4427:
+  .zero 1
+.align 1
+g4426:
+  .zero 1
+.align 1
+g4425:
+  .zero 1
+.align 8
+g4424:
+  .zero 8
+.align 2
+g4423:
+  .zero 2
+.align 4
+g4422:
+  .zero 4
+.align 8
+g4421:
+  .zero 8
+.align 2
+g4420:
+  .zero 2
+.align 4
+g4419:
+  .zero 4
+.align 8
+g4418:
+  .zero 8
+.align 2
+g4417:
+  .zero 2
+.align 8
+g4416:
+  .zero 8
+.align 4
+g4415:
+  .zero 4
+.align 8
+g4414:
+  .zero 8
+.align 4
+g4413:
+  .zero 4
+.align 8
+g4412:
+  .zero 8
+.align 4
+g4411:
+  .zero 4
+.align 2
+g4410:
+  .zero 2
+.align 2
+g4409:
+  .zero 2
+.align 1
+g4408:
+  .zero 1
+.align 2
+g4407:
+  .zero 2
+.align 8
+g4406:
+  .zero 8
+.align 8
+g4405:
+  .zero 8
+.align 8
+g4404:
+  .zero 8
+.align 4
+g4403:
+  .zero 4
+.align 2
+g4402:
+  .zero 2
+.align 4
+g4401:
+  .zero 4
+.align 4
+g4400:
+  .zero 4
+.align 1
+g4399:
+  .zero 1
+.align 8
+g4398:
+  .zero 8
+.align 2
+g4397:
+  .zero 2
+.align 2
+g4396:
+  .zero 2
+.align 8
+g4395:
+  .zero 8
+.align 4
+g4394:
+  .zero 4
+.align 1
+g4393:
+  .zero 1
+.align 2
+g4392:
+  .zero 2
+.align 1
+g4391:
+  .zero 1
+.align 8
+g4390:
+  .zero 8
+.align 1
+g4389:
+  .zero 1
+.align 2
+g4388:
+  .zero 2
+.align 1
+g4387:
+  .zero 1
+.align 2
+g4386:
+  .zero 2
+.align 4
+g4385:
+  .zero 4
+.align 4
+g4384:
+  .zero 4
+.align 4
+g4383:
+  .zero 4
+.align 4
+g4382:
+  .zero 4
+.align 4
+g4381:
+  .zero 4
+.align 4
+g4380:
+  .zero 4
+.align 2
+g4379:
+  .zero 2
+.align 2
+g4378:
+  .zero 2
+.align 8
+g4377:
+  .zero 8
+.align 1
+g4376:
+  .zero 1
+.align 8
+g4375:
+  .zero 8
+.align 4
+g4374:
+  .zero 4
+.align 2
+g4373:
+  .zero 2
+.align 2
+g4372:
+  .zero 2
+.align 1
+g4371:
+  .zero 1
+.align 2
+g4370:
+  .zero 2
+.align 8
+g4369:
+  .zero 8
+.align 4
+g4368:
+  .zero 4
+.align 4
+g4367:
+  .zero 4
+.align 2
+g4366:
+  .zero 2
+.align 1
+g4365:
+  .zero 1
+.align 4
+g4364:
+  .zero 4
+.align 1
+g4363:
+  .zero 1
+.align 2
+g4362:
+  .zero 2
+.align 1
+g4361:
+  .zero 1
+.align 1
+g4360:
+  .zero 1
+.align 8
+g4359:
+  .zero 8
+.align 4
+g4358:
+  .zero 4
+.align 1
+g4357:
+  .zero 1
+.align 1
+g4356:
+  .zero 1
+.align 1
+g4355:
+  .zero 1
+.align 4
+g4354:
+  .zero 4
+.align 2
+g4353:
+  .zero 2
+.align 8
+g4352:
+  .zero 8
+.align 8
+g4351:
+  .zero 8
+.align 8
+g4350:
+  .zero 8
+.align 4
+g4349:
+  .zero 4
+.align 4
+g4348:
+  .zero 4
+.align 2
+g4347:
+  .zero 2
+.align 2
+g4346:
+  .zero 2
+.align 2
+g4345:
+  .zero 2
+.align 2
+g4344:
+  .zero 2
+.align 1
+g4343:
+  .zero 1
+.align 2
+g4342:
+  .zero 2
+.align 1
+g4341:
+  .zero 1
+.align 2
+g4340:
+  .zero 2
+.align 8
+g4339:
+  .zero 8
+.align 4
+g4338:
+  .zero 4
+.align 2
+g4337:
+  .zero 2
+.align 4
+g4336:
+  .zero 4
+.align 1
+g4335:
+  .zero 1
+.align 4
+g4334:
+  .zero 4
+.align 1
+g4333:
+  .zero 1
+.align 4
+g4332:
+  .zero 4
+.align 2
+g4331:
+  .zero 2
+.align 2
+g4330:
+  .zero 2
+.align 2
+g4329:
+  .zero 2
+.align 1
+g4328:
+  .zero 1
+.align 2
+g4327:
+  .zero 2
+.align 4
+g4326:
+  .zero 4
+.align 1
+g4325:
+  .zero 1
+.align 1
+g4324:
+  .zero 1
+.align 1
+g4323:
+  .zero 1
+.align 1
+g4322:
+  .zero 1
+.align 8
+g4321:
+  .zero 8
+.align 2
+g4320:
+  .zero 2
+.align 8
+g4319:
+  .zero 8
+.align 4
+g4318:
+  .zero 4
+.align 1
+g4317:
+  .zero 1
+.align 8
+g4316:
+  .zero 8
+.align 4
+g4315:
+  .zero 4
+.align 4
+g4314:
+  .zero 4
+.align 1
+g4313:
+  .zero 1
+.align 1
+g4312:
+  .zero 1
+.align 2
+g4311:
+  .zero 2
+.align 1
+g4310:
+  .zero 1
+.align 4
+g4309:
+  .zero 4
+.align 2
+g4308:
+  .zero 2
+.align 4
+g4307:
+  .zero 4
+.align 2
+g4306:
+  .zero 2
+.align 1
+g4305:
+  .zero 1
+.align 8
+g4304:
+  .zero 8
+.align 4
+g4303:
+  .zero 4
+.align 1
+g4302:
+  .zero 1
+.align 4
+g4301:
+  .zero 4
+.align 8
+g4300:
+  .zero 8
+.align 8
+g4299:
+  .zero 8
+.align 4
+g4298:
+  .zero 4
+.align 8
+g4297:
+  .zero 8
+.align 8
+g4296:
+  .zero 8
+.align 8
+g4295:
+  .zero 8
+.align 4
+g4294:
+  .zero 4
+.align 4
+g4293:
+  .zero 4
+.align 8
+g4292:
+  .zero 8
+.align 2
+g4291:
+  .zero 2
+.align 8
+g4290:
+  .zero 8
+.align 8
+g4289:
+  .zero 8
+.align 8
+g4288:
+  .zero 8
+.align 8
+g4287:
+  .zero 8
+.align 1
+g4286:
+  .zero 1
+.align 4
+g4285:
+  .zero 4
+.align 2
+g4284:
+  .zero 2
+.align 8
+g4283:
+  .zero 8
+.align 1
+g4282:
+  .zero 1
+.align 1
+g4281:
+  .zero 1
+.align 4
+g4280:
+  .zero 4
+.align 4
+g4279:
+  .zero 4
+.align 8
+g4278:
+  .zero 8
+.align 4
+g4277:
+  .zero 4
+.align 8
+g4276:
+  .zero 8
+.align 4
+g4275:
+  .zero 4
+.align 1
+g4274:
+  .zero 1
+.align 2
+g4273:
+  .zero 2
+.align 4
+g4272:
+  .zero 4
+.align 2
+g4271:
+  .zero 2
+.align 1
+g4270:
+  .zero 1
+.align 1
+g4269:
+  .zero 1
+.align 1
+g4268:
+  .zero 1
+.align 4
+g4267:
+  .zero 4
+.align 1
+g4266:
+  .zero 1
+.align 4
+g4265:
+  .zero 4
+.align 1
+g4264:
+  .zero 1
+.align 8
+g4263:
+  .zero 8
+.align 1
+g4262:
+  .zero 1
+.align 1
+g4261:
+  .zero 1
+.align 2
+g4260:
+  .zero 2
+.align 4
+g4259:
+  .zero 4
+.align 2
+g4258:
+  .zero 2
+.align 1
+g4257:
+  .zero 1
+.align 8
+g4256:
+  .zero 8
+.align 4
+g4255:
+  .zero 4
+.align 2
+g4254:
+  .zero 2
+.align 4
+g4253:
+  .zero 4
+.align 1
+g4252:
+  .zero 1
+.align 4
+g4251:
+  .zero 4
+.align 1
+g4250:
+  .zero 1
+.align 2
+g4249:
+  .zero 2
+.align 8
+g4248:
+  .zero 8
+.align 1
+g4247:
+  .zero 1
+.align 2
+g4246:
+  .zero 2
+.align 2
+g4245:
+  .zero 2
+.align 2
+g4244:
+  .zero 2
+.align 1
+g4243:
+  .zero 1
+.align 1
+g4242:
+  .zero 1
+.align 1
+g4241:
+  .zero 1
+.align 1
+g4240:
+  .zero 1
+.align 2
+g4239:
+  .zero 2
+.align 4
+g4238:
+  .zero 4
+.align 1
+g4237:
+  .zero 1
+.align 1
+g4236:
+  .zero 1
+.align 2
+g4235:
+  .zero 2
+.align 2
+g4234:
+  .zero 2
+.align 8
+g4233:
+  .zero 8
+.align 4
+g4232:
+  .zero 4
+.align 2
+g4231:
+  .zero 2
+.align 8
+g4230:
+  .zero 8
+.align 1
+g4229:
+  .zero 1
+.align 2
+g4228:
+  .zero 2
+.align 4
+g4227:
+  .zero 4
+.align 2
+g4226:
+  .zero 2
+.align 8
+g4225:
+  .zero 8
+.align 8
+g4224:
+  .zero 8
+.align 4
+g4223:
+  .zero 4
+.align 1
+g4222:
+  .zero 1
+.align 8
+g4221:
+  .zero 8
+.align 4
+g4220:
+  .zero 4
+.align 4
+g4219:
+  .zero 4
+.align 4
+g4218:
+  .zero 4
+.align 1
+g4217:
+  .zero 1
+.align 4
+g4216:
+  .zero 4
+.align 4
+g4215:
+  .zero 4
+.align 2
+g4214:
+  .zero 2
+.align 8
+g4213:
+  .zero 8
+.align 8
+g4212:
+  .zero 8
+.align 2
+g4211:
+  .zero 2
+.align 2
+g4210:
+  .zero 2
+.align 1
+g4209:
+  .zero 1
+.align 4
+g4208:
+  .zero 4
+.align 8
+g4207:
+  .zero 8
+.align 1
+g4206:
+  .zero 1
+.align 2
+g4205:
+  .zero 2
+.align 1
+g4204:
+  .zero 1
+.align 1
+g4203:
+  .zero 1
+.align 4
+g4202:
+  .zero 4
+.align 1
+g4201:
+  .zero 1
+.align 8
+g4200:
+  .zero 8
+.align 1
+g4199:
+  .zero 1
+.align 4
+g4198:
+  .zero 4
+.align 8
+g4197:
+  .zero 8
+.align 2
+g4196:
+  .zero 2
+.align 1
+g4195:
+  .zero 1
+.align 1
+g4194:
+  .zero 1
+.align 8
+g4193:
+  .zero 8
+.align 2
+g4192:
+  .zero 2
+.align 4
+g4191:
+  .zero 4
+.align 8
+g4190:
+  .zero 8
+.align 8
+g4189:
+  .zero 8
+.align 1
+g4188:
+  .zero 1
+.align 8
+g4187:
+  .zero 8
+.align 4
+g4186:
+  .zero 4
+.align 4
+g4185:
+  .zero 4
+.align 2
+g4184:
+  .zero 2
+.align 8
+g4183:
+  .zero 8
+.align 1
+g4182:
+  .zero 1
+.align 1
+g4181:
+  .zero 1
+.align 4
+g4180:
+  .zero 4
+.align 4
+g4179:
+  .zero 4
+.align 2
+g4178:
+  .zero 2
+.align 8
+g4177:
+  .zero 8
+.align 2
+g4176:
+  .zero 2
+.align 2
+g4175:
+  .zero 2
+.align 4
+g4174:
+  .zero 4
+.align 4
+g4173:
+  .zero 4
+.align 8
+g4172:
+  .zero 8
+.align 8
+g4171:
+  .zero 8
+.align 8
+g4170:
+  .zero 8
+.align 1
+g4169:
+  .zero 1
+.align 4
+g4168:
+  .zero 4
+.align 1
+g4167:
+  .zero 1
+.align 4
+g4166:
+  .zero 4
+.align 4
+g4165:
+  .zero 4
+.align 2
+g4164:
+  .zero 2
+.align 2
+g4163:
+  .zero 2
+.align 1
+g4162:
+  .zero 1
+.align 1
+g4161:
+  .zero 1
+.align 1
+g4160:
+  .zero 1
+.align 4
+g4159:
+  .zero 4
+.align 4
+g4158:
+  .zero 4
+.align 4
+g4157:
+  .zero 4
+.align 2
+g4156:
+  .zero 2
+.align 4
+g4155:
+  .zero 4
+.align 8
+g4154:
+  .zero 8
+.align 1
+g4153:
+  .zero 1
+.align 2
+g4152:
+  .zero 2
+.align 2
+g4151:
+  .zero 2
+.align 2
+g4150:
+  .zero 2
+.align 4
+g4149:
+  .zero 4
+.align 4
+g4148:
+  .zero 4
+.align 4
+g4147:
+  .zero 4
+.align 1
+g4146:
+  .zero 1
+.align 4
+g4145:
+  .zero 4
+.align 4
+g4144:
+  .zero 4
+.align 1
+g4143:
+  .zero 1
+.align 2
+g4142:
+  .zero 2
+.align 8
+g4141:
+  .zero 8
+.align 2
+g4140:
+  .zero 2
+.align 4
+g4139:
+  .zero 4
+.align 8
+g4138:
+  .zero 8
+.align 1
+g4137:
+  .zero 1
+.align 2
+g4136:
+  .zero 2
+.align 8
+g4135:
+  .zero 8
+.align 4
+g4134:
+  .zero 4
+.align 1
+g4133:
+  .zero 1
+.align 4
+g4132:
+  .zero 4
+.align 2
+g4131:
+  .zero 2
+.align 4
+g4130:
+  .zero 4
+.align 1
+g4129:
+  .zero 1
+.align 1
+g4128:
+  .zero 1
+.align 1
+g4127:
+  .zero 1
+.align 4
+g4126:
+  .zero 4
+.align 2
+g4125:
+  .zero 2
+.align 1
+g4124:
+  .zero 1
+.align 2
+g4123:
+  .zero 2
+.align 8
+g4122:
+  .zero 8
+.align 1
+g4121:
+  .zero 1
+.align 2
+g4120:
+  .zero 2
+.align 2
+g4119:
+  .zero 2
+.align 8
+g4118:
+  .zero 8
+.align 8
+g4117:
+  .zero 8
+.align 8
+g4116:
+  .zero 8
+.align 2
+g4115:
+  .zero 2
+.align 1
+g4114:
+  .zero 1
+.align 8
+g4113:
+  .zero 8
+.align 4
+g4112:
+  .zero 4
+.align 1
+g4111:
+  .zero 1
+.align 1
+g4110:
+  .zero 1
+.align 1
+g4109:
+  .zero 1
+.align 1
+g4108:
+  .zero 1
+.align 8
+g4107:
+  .zero 8
+.align 4
+g4106:
+  .zero 4
+.align 4
+g4105:
+  .zero 4
+.align 1
+g4104:
+  .zero 1
+.align 2
+g4103:
+  .zero 2
+.align 2
+g4102:
+  .zero 2
+.align 8
+g4101:
+  .zero 8
+.align 4
+g4100:
+  .zero 4
+.align 8
+g4099:
+  .zero 8
+.align 4
+g4098:
+  .zero 4
+.align 8
+g4097:
+  .zero 8
+.align 1
+g4096:
+  .zero 1
+.align 2
+g4095:
+  .zero 2
+.align 1
+g4094:
+  .zero 1
+.align 8
+g4093:
+  .zero 8
+.align 2
+g4092:
+  .zero 2
+.align 2
+g4091:
+  .zero 2
+.align 1
+g4090:
+  .zero 1
+.align 8
+g4089:
+  .zero 8
+.align 1
+g4088:
+  .zero 1
+.align 8
+g4087:
+  .zero 8
+.align 2
+g4086:
+  .zero 2
+.align 4
+g4085:
+  .zero 4
+.align 1
+g4084:
+  .zero 1
+.align 8
+g4083:
+  .zero 8
+.align 2
+g4082:
+  .zero 2
+.align 1
+g4081:
+  .zero 1
+.align 2
+g4080:
+  .zero 2
+.align 2
+g4079:
+  .zero 2
+.align 1
+g4078:
+  .zero 1
+.align 4
+g4077:
+  .zero 4
+.align 8
+g4076:
+  .zero 8
+.align 1
+g4075:
+  .zero 1
+.align 8
+g4074:
+  .zero 8
+.align 8
+g4073:
+  .zero 8
+.align 8
+g4072:
+  .zero 8
+.align 4
+g4071:
+  .zero 4
+.align 8
+g4070:
+  .zero 8
+.align 2
+g4069:
+  .zero 2
+.align 4
+g4068:
+  .zero 4
+.align 1
+g4067:
+  .zero 1
+.align 4
+g4066:
+  .zero 4
+.align 8
+g4065:
+  .zero 8
+.align 4
+g4064:
+  .zero 4
+.align 4
+g4063:
+  .zero 4
+.align 2
+g4062:
+  .zero 2
+.align 8
+g4061:
+  .zero 8
+.align 1
+g4060:
+  .zero 1
+.align 4
+g4059:
+  .zero 4
+.align 4
+g4058:
+  .zero 4
+.align 1
+g4057:
+  .zero 1
+.align 8
+g4056:
+  .zero 8
+.align 4
+g4055:
+  .zero 4
+.align 8
+g4054:
+  .zero 8
+.align 1
+g4053:
+  .zero 1
+.align 8
+g4052:
+  .zero 8
+.align 1
+g4051:
+  .zero 1
+.align 2
+g4050:
+  .zero 2
+.align 4
+g4049:
+  .zero 4
+.align 1
+g4048:
+  .zero 1
+.align 4
+g4047:
+  .zero 4
+.align 2
+g4046:
+  .zero 2
+.align 4
+g4045:
+  .zero 4
+.align 1
+g4044:
+  .zero 1
+.align 2
+g4043:
+  .zero 2
+.align 8
+g4042:
+  .zero 8
+.align 2
+g4041:
+  .zero 2
+.align 1
+g4040:
+  .zero 1
+.align 2
+g4039:
+  .zero 2
+.align 4
+g4038:
+  .zero 4
+.align 1
+g4037:
+  .zero 1
+.align 4
+g4036:
+  .zero 4
+.align 2
+g4035:
+  .zero 2
+.align 1
+g4034:
+  .zero 1
+.align 8
+g4033:
+  .zero 8
+.align 8
+g4032:
+  .zero 8
+.align 1
+g4031:
+  .zero 1
+.align 2
+g4030:
+  .zero 2
+.align 4
+g4029:
+  .zero 4
+.align 2
+g4028:
+  .zero 2
+.align 8
+g4027:
+  .zero 8
+.align 8
+g4026:
+  .zero 8
+.align 2
+g4025:
+  .zero 2
+.align 4
+g4024:
+  .zero 4
+.align 1
+g4023:
+  .zero 1
+.align 1
+g4022:
+  .zero 1
+.align 2
+g4021:
+  .zero 2
+.align 4
+g4020:
+  .zero 4
+.align 2
+g4019:
+  .zero 2
+.align 2
+g4018:
+  .zero 2
+.align 1
+g4017:
+  .zero 1
+.align 4
+g4016:
+  .zero 4
+.align 2
+g4015:
+  .zero 2
+.align 2
+g4014:
+  .zero 2
+.align 1
+g4013:
+  .zero 1
+.align 2
+g4012:
+  .zero 2
+.align 2
+g4011:
+  .zero 2
+.align 4
+g4010:
+  .zero 4
+.align 8
+g4009:
+  .zero 8
+.align 4
+g4008:
+  .zero 4
+.align 8
+g4007:
+  .zero 8
+.align 4
+g4006:
+  .zero 4
+.align 1
+g4005:
+  .zero 1
+.align 2
+g4004:
+  .zero 2
+.align 8
+g4003:
+  .zero 8
+.align 4
+g4002:
+  .zero 4
+.align 1
+g4001:
+  .zero 1
+.align 2
+g4000:
+  .zero 2
+.align 8
+g3999:
+  .zero 8
+.align 4
+g3998:
+  .zero 4
+.align 8
+g3997:
+  .zero 8
+.align 4
+g3996:
+  .zero 4
+.align 8
+g3995:
+  .zero 8
+.align 4
+g3994:
+  .zero 4
+.align 4
+g3993:
+  .zero 4
+.align 4
+g3992:
+  .zero 4
+.align 2
+g3991:
+  .zero 2
+.align 1
+g3990:
+  .zero 1
+.align 2
+g3989:
+  .zero 2
+.align 2
+g3988:
+  .zero 2
+.align 2
+g3987:
+  .zero 2
+.align 1
+g3986:
+  .zero 1
+.align 1
+g3985:
+  .zero 1
+.align 4
+g3984:
+  .zero 4
+.align 8
+g3983:
+  .zero 8
+.align 2
+g3982:
+  .zero 2
+.align 4
+g3981:
+  .zero 4
+.align 8
+g3980:
+  .zero 8
+.align 8
+g3979:
+  .zero 8
+.align 1
+g3978:
+  .zero 1
+.align 1
+g3977:
+  .zero 1
+.align 8
+g3976:
+  .zero 8
+.align 4
+g3975:
+  .zero 4
+.align 8
+g3974:
+  .zero 8
+.align 4
+g3973:
+  .zero 4
+.align 4
+g3972:
+  .zero 4
+.align 4
+g3971:
+  .zero 4
+.align 1
+g3970:
+  .zero 1
+.align 8
+g3969:
+  .zero 8
+.align 1
+g3968:
+  .zero 1
+.align 1
+g3967:
+  .zero 1
+.align 1
+g3966:
+  .zero 1
+.align 8
+g3965:
+  .zero 8
+.align 8
+g3964:
+  .zero 8
+.align 8
+g3963:
+  .zero 8
+.align 8
+g3962:
+  .zero 8
+.align 4
+g3961:
+  .zero 4
+.align 2
+g3960:
+  .zero 2
+.align 8
+g3959:
+  .zero 8
+.align 4
+g3958:
+  .zero 4
+.align 4
+g3957:
+  .zero 4
+.align 2
+g3956:
+  .zero 2
+.align 8
+g3955:
+  .zero 8
+.align 2
+g3954:
+  .zero 2
+.align 2
+g3953:
+  .zero 2
+.align 1
+g3952:
+  .zero 1
+.align 8
+g3951:
+  .zero 8
+.align 1
+g3950:
+  .zero 1
+.align 8
+g3949:
+  .zero 8
+.align 2
+g3948:
+  .zero 2
+.align 1
+g3947:
+  .zero 1
+.align 8
+g3946:
+  .zero 8
+.align 8
+g3945:
+  .zero 8
+.align 4
+g3944:
+  .zero 4
+.align 8
+g3943:
+  .zero 8
+.align 2
+g3942:
+  .zero 2
+.align 8
+g3941:
+  .zero 8
+.align 2
+g3940:
+  .zero 2
+.align 4
+g3939:
+  .zero 4
+.align 2
+g3938:
+  .zero 2
+.align 8
+g3937:
+  .zero 8
+.align 8
+g3936:
+  .zero 8
+.align 8
+g3935:
+  .zero 8
+.align 8
+g3934:
+  .zero 8
+.align 4
+g3933:
+  .zero 4
+.align 2
+g3932:
+  .zero 2
+.align 4
+g3931:
+  .zero 4
+.align 4
+g3930:
+  .zero 4
+.align 1
+g3929:
+  .zero 1
+.align 4
+g3928:
+  .zero 4
+.align 2
+g3927:
+  .zero 2
+.align 4
+g3926:
+  .zero 4
+.align 2
+g3925:
+  .zero 2
+.align 1
+g3924:
+  .zero 1
+.align 1
+g3923:
+  .zero 1
+.align 1
+g3922:
+  .zero 1
+.align 1
+g3921:
+  .zero 1
+.align 4
+g3920:
+  .zero 4
+.align 1
+g3919:
+  .zero 1
+.align 1
+g3918:
+  .zero 1
+.align 2
+g3917:
+  .zero 2
+.align 8
+g3916:
+  .zero 8
+.align 8
+g3915:
+  .zero 8
+.align 2
+g3914:
+  .zero 2
+.align 1
+g3913:
+  .zero 1
+.align 2
+g3912:
+  .zero 2
+.align 8
+g3911:
+  .zero 8
+.align 1
+g3910:
+  .zero 1
+.align 4
+g3909:
+  .zero 4
+.align 1
+g3908:
+  .zero 1
+.align 4
+g3907:
+  .zero 4
+.align 4
+g3906:
+  .zero 4
+.align 8
+g3905:
+  .zero 8
+.align 4
+g3904:
+  .zero 4
+.align 4
+g3903:
+  .zero 4
+.align 4
+g3902:
+  .zero 4
+.align 8
+g3901:
+  .zero 8
+.align 8
+g3900:
+  .zero 8
+.align 4
+g3899:
+  .zero 4
+.align 4
+g3898:
+  .zero 4
+.align 1
+g3897:
+  .zero 1
+.align 2
+g3896:
+  .zero 2
+.align 2
+g3895:
+  .zero 2
+.align 8
+g3894:
+  .zero 8
+.align 2
+g3893:
+  .zero 2
+.align 1
+g3892:
+  .zero 1
+.align 8
+g3891:
+  .zero 8
+.align 8
+g3890:
+  .zero 8
+.align 1
+g3889:
+  .zero 1
+.align 4
+g3888:
+  .zero 4
+.align 8
+g3887:
+  .zero 8
+.align 1
+g3886:
+  .zero 1
+.align 1
+g3885:
+  .zero 1
+.align 4
+g3884:
+  .zero 4
+.align 2
+g3883:
+  .zero 2
+.align 8
+g3882:
+  .zero 8
+.align 1
+g3881:
+  .zero 1
+.align 2
+g3880:
+  .zero 2
+.align 8
+g3879:
+  .zero 8
+.align 8
+g3878:
+  .zero 8
+.align 1
+g3877:
+  .zero 1
+.align 1
+g3876:
+  .zero 1
+.align 2
+g3875:
+  .zero 2
+.align 8
+g3874:
+  .zero 8
+.align 8
+g3873:
+  .zero 8
+.align 8
+g3872:
+  .zero 8
+.align 4
+g3871:
+  .zero 4
+.align 1
+g3870:
+  .zero 1
+.align 8
+g3869:
+  .zero 8
+.align 1
+g3868:
+  .zero 1
+.align 8
+g3867:
+  .zero 8
+.align 2
+g3866:
+  .zero 2
+.align 4
+g3865:
+  .zero 4
+.align 1
+g3864:
+  .zero 1
+.align 1
+g3863:
+  .zero 1
+.align 4
+g3862:
+  .zero 4
+.align 2
+g3861:
+  .zero 2
+.align 8
+g3860:
+  .zero 8
+.align 8
+g3859:
+  .zero 8
+.align 2
+g3858:
+  .zero 2
+.align 8
+g3857:
+  .zero 8
+.align 2
+g3856:
+  .zero 2
+.align 4
+g3855:
+  .zero 4
+.align 4
+g3854:
+  .zero 4
+.align 4
+g3853:
+  .zero 4
+.align 1
+g3852:
+  .zero 1
+.align 8
+g3851:
+  .zero 8
+.align 8
+g3850:
+  .zero 8
+.align 8
+g3849:
+  .zero 8
+.align 1
+g3848:
+  .zero 1
+.align 8
+g3847:
+  .zero 8
+.align 4
+g3846:
+  .zero 4
+.align 8
+g3845:
+  .zero 8
+.align 2
+g3844:
+  .zero 2
+.align 1
+g3843:
+  .zero 1
+.align 2
+g3842:
+  .zero 2
+.align 4
+g3841:
+  .zero 4
+.align 2
+g3840:
+  .zero 2
+.align 8
+g3839:
+  .zero 8
+.align 8
+g3838:
+  .zero 8
+.align 1
+g3837:
+  .zero 1
+.align 4
+g3836:
+  .zero 4
+.align 2
+g3835:
+  .zero 2
+.align 8
+g3834:
+  .zero 8
+.align 2
+g3833:
+  .zero 2
+.align 8
+g3832:
+  .zero 8
+.align 4
+g3831:
+  .zero 4
+.align 8
+g3830:
+  .zero 8
+.align 8
+g3829:
+  .zero 8
+.align 4
+g3828:
+  .zero 4
+.align 2
+g3827:
+  .zero 2
+.align 1
+g3826:
+  .zero 1
+.align 2
+g3825:
+  .zero 2
+.align 2
+g3824:
+  .zero 2
+.align 4
+g3823:
+  .zero 4
+.align 8
+g3822:
+  .zero 8
+.align 4
+g3821:
+  .zero 4
+.align 2
+g3820:
+  .zero 2
+.align 8
+g3819:
+  .zero 8
+.align 2
+g3818:
+  .zero 2
+.align 8
+g3817:
+  .zero 8
+.align 1
+g3816:
+  .zero 1
+.align 2
+g3815:
+  .zero 2
+.align 8
+g3814:
+  .zero 8
+.align 4
+g3813:
+  .zero 4
+.align 1
+g3812:
+  .zero 1
+.align 1
+g3811:
+  .zero 1
+.align 4
+g3810:
+  .zero 4
+.align 4
+g3809:
+  .zero 4
+.align 8
+g3808:
+  .zero 8
+.align 4
+g3807:
+  .zero 4
+.align 4
+g3806:
+  .zero 4
+.align 8
+g3805:
+  .zero 8
+.align 8
+g3804:
+  .zero 8
+.align 4
+g3803:
+  .zero 4
+.align 8
+g3802:
+  .zero 8
+.align 2
+g3801:
+  .zero 2
+.align 8
+g3800:
+  .zero 8
+.align 1
+g3799:
+  .zero 1
+.align 1
+g3798:
+  .zero 1
+.align 8
+g3797:
+  .zero 8
+.align 8
+g3796:
+  .zero 8
+.align 2
+g3795:
+  .zero 2
+.align 1
+g3794:
+  .zero 1
+.align 2
+g3793:
+  .zero 2
+.align 2
+g3792:
+  .zero 2
+.align 2
+g3791:
+  .zero 2
+.align 8
+g3790:
+  .zero 8
+.align 2
+g3789:
+  .zero 2
+.align 2
+g3788:
+  .zero 2
+.align 8
+g3787:
+  .zero 8
+.align 8
+g3786:
+  .zero 8
+.align 2
+g3785:
+  .zero 2
+.align 8
+g3784:
+  .zero 8
+.align 8
+g3783:
+  .zero 8
+.align 1
+g3782:
+  .zero 1
+.align 4
+g3781:
+  .zero 4
+.align 4
+g3780:
+  .zero 4
+.align 4
+g3779:
+  .zero 4
+.align 1
+g3778:
+  .zero 1
+.align 4
+g3777:
+  .zero 4
+.align 4
+g3776:
+  .zero 4
+.align 4
+g3775:
+  .zero 4
+.align 2
+g3774:
+  .zero 2
+.align 2
+g3773:
+  .zero 2
+.align 8
+g3772:
+  .zero 8
+.align 4
+g3771:
+  .zero 4
+.align 1
+g3770:
+  .zero 1
+.align 2
+g3769:
+  .zero 2
+.align 4
+g3768:
+  .zero 4
+.align 2
+g3767:
+  .zero 2
+.align 2
+g3766:
+  .zero 2
+.align 8
+g3765:
+  .zero 8
+.align 1
+g3764:
+  .zero 1
+.align 8
+g3763:
+  .zero 8
+.align 2
+g3762:
+  .zero 2
+.align 1
+g3761:
+  .zero 1
+.align 1
+g3760:
+  .zero 1
+.align 4
+g3759:
+  .zero 4
+.align 1
+g3758:
+  .zero 1
+.align 1
+g3757:
+  .zero 1
+.align 1
+g3756:
+  .zero 1
+.align 8
+g3755:
+  .zero 8
+.align 1
+g3754:
+  .zero 1
+.align 8
+g3753:
+  .zero 8
+.align 1
+g3752:
+  .zero 1
+.align 2
+g3751:
+  .zero 2
+.align 4
+g3750:
+  .zero 4
+.align 8
+g3749:
+  .zero 8
+.align 8
+g3748:
+  .zero 8
+.align 4
+g3747:
+  .zero 4
+.align 2
+g3746:
+  .zero 2
+.align 2
+g3745:
+  .zero 2
+.align 1
+g3744:
+  .zero 1
+.align 4
+g3743:
+  .zero 4
+.align 8
+g3742:
+  .zero 8
+.align 8
+g3741:
+  .zero 8
+.align 2
+g3740:
+  .zero 2
+.align 8
+g3739:
+  .zero 8
+.align 1
+g3738:
+  .zero 1
+.align 1
+g3737:
+  .zero 1
+.align 1
+g3736:
+  .zero 1
+.align 2
+g3735:
+  .zero 2
+.align 2
+g3734:
+  .zero 2
+.align 4
+g3733:
+  .zero 4
+.align 8
+g3732:
+  .zero 8
+.align 1
+g3731:
+  .zero 1
+.align 8
+g3730:
+  .zero 8
+.align 1
+g3729:
+  .zero 1
+.align 4
+g3728:
+  .zero 4
+.align 1
+g3727:
+  .zero 1
+.align 8
+g3726:
+  .zero 8
+.align 1
+g3725:
+  .zero 1
+.align 8
+g3724:
+  .zero 8
+.align 4
+g3723:
+  .zero 4
+.align 2
+g3722:
+  .zero 2
+.align 2
+g3721:
+  .zero 2
+.align 4
+g3720:
+  .zero 4
+.align 2
+g3719:
+  .zero 2
+.align 2
+g3718:
+  .zero 2
+.align 4
+g3717:
+  .zero 4
+.align 8
+g3716:
+  .zero 8
+.align 8
+g3715:
+  .zero 8
+.align 8
+g3714:
+  .zero 8
+.align 4
+g3713:
+  .zero 4
+.align 4
+g3712:
+  .zero 4
+.align 8
+g3711:
+  .zero 8
+.align 1
+g3710:
+  .zero 1
+.align 1
+g3709:
+  .zero 1
+.align 8
+g3708:
+  .zero 8
+.align 1
+g3707:
+  .zero 1
+.align 1
+g3706:
+  .zero 1
+.align 4
+g3705:
+  .zero 4
+.align 8
+g3704:
+  .zero 8
+.align 2
+g3703:
+  .zero 2
+.align 2
+g3702:
+  .zero 2
+.align 8
+g3701:
+  .zero 8
+.align 4
+g3700:
+  .zero 4
+.align 4
+g3699:
+  .zero 4
+.align 2
+g3698:
+  .zero 2
+.align 8
+g3697:
+  .zero 8
+.align 4
+g3696:
+  .zero 4
+.align 2
+g3695:
+  .zero 2
+.align 4
+g3694:
+  .zero 4
+.align 2
+g3693:
+  .zero 2
+.align 2
+g3692:
+  .zero 2
+.align 1
+g3691:
+  .zero 1
+.align 2
+g3690:
+  .zero 2
+.align 8
+g3689:
+  .zero 8
+.align 2
+g3688:
+  .zero 2
+.align 1
+g3687:
+  .zero 1
+.align 1
+g3686:
+  .zero 1
+.align 8
+g3685:
+  .zero 8
+.align 2
+g3684:
+  .zero 2
+.align 2
+g3683:
+  .zero 2
+.align 8
+g3682:
+  .zero 8
+.align 4
+g3681:
+  .zero 4
+.align 8
+g3680:
+  .zero 8
+.align 8
+g3679:
+  .zero 8
+.align 8
+g3678:
+  .zero 8
+.align 8
+g3677:
+  .zero 8
+.align 2
+g3676:
+  .zero 2
+.align 2
+g3675:
+  .zero 2
+.align 2
+g3674:
+  .zero 2
+.align 1
+g3673:
+  .zero 1
+.align 1
+g3672:
+  .zero 1
+.align 1
+g3671:
+  .zero 1
+.align 4
+g3670:
+  .zero 4
+.align 1
+g3669:
+  .zero 1
+.align 1
+g3668:
+  .zero 1
+.align 4
+g3667:
+  .zero 4
+.align 4
+g3666:
+  .zero 4
+.align 1
+g3665:
+  .zero 1
+.align 8
+g3664:
+  .zero 8
+.align 4
+g3663:
+  .zero 4
+.align 4
+g3662:
+  .zero 4
+.align 1
+g3661:
+  .zero 1
+.align 4
+g3660:
+  .zero 4
+.align 2
+g3659:
+  .zero 2
+.align 2
+g3658:
+  .zero 2
+.align 1
+g3657:
+  .zero 1
+.align 4
+g3656:
+  .zero 4
+.align 4
+g3655:
+  .zero 4
+.align 8
+g3654:
+  .zero 8
+.align 8
+g3653:
+  .zero 8
+.align 8
+g3652:
+  .zero 8
+.align 8
+g3651:
+  .zero 8
+.align 2
+g3650:
+  .zero 2
+.align 1
+g3649:
+  .zero 1
+.align 4
+g3648:
+  .zero 4
+.align 1
+g3647:
+  .zero 1
+.align 2
+g3646:
+  .zero 2
+.align 4
+g3645:
+  .zero 4
+.align 2
+g3644:
+  .zero 2
+.align 1
+g3643:
+  .zero 1
+.align 2
+g3642:
+  .zero 2
+.align 2
+g3641:
+  .zero 2
+.align 8
+g3640:
+  .zero 8
+.align 2
+g3639:
+  .zero 2
+.align 1
+g3638:
+  .zero 1
+.align 4
+g3637:
+  .zero 4
+.align 1
+g3636:
+  .zero 1
+.align 8
+g3635:
+  .zero 8
+.align 8
+g3634:
+  .zero 8
+.align 2
+g3633:
+  .zero 2
+.align 2
+g3632:
+  .zero 2
+.align 2
+g3631:
+  .zero 2
+.align 4
+g3630:
+  .zero 4
+.align 4
+g3629:
+  .zero 4
+.align 8
+g3628:
+  .zero 8
+.align 4
+g3627:
+  .zero 4
+.align 8
+g3626:
+  .zero 8
+.align 8
+g3625:
+  .zero 8
+.align 2
+g3624:
+  .zero 2
+.align 4
+g3623:
+  .zero 4
+.align 4
+g3622:
+  .zero 4
+.align 4
+g3621:
+  .zero 4
+.align 1
+g3620:
+  .zero 1
+.align 1
+g3619:
+  .zero 1
+.align 4
+g3618:
+  .zero 4
+.align 4
+g3617:
+  .zero 4
+.align 2
+g3616:
+  .zero 2
+.align 4
+g3615:
+  .zero 4
+.align 4
+g3614:
+  .zero 4
+.align 8
+g3613:
+  .zero 8
+.align 1
+g3612:
+  .zero 1
+.align 2
+g3611:
+  .zero 2
+.align 1
+g3610:
+  .zero 1
+.align 8
+g3609:
+  .zero 8
+.align 4
+g3608:
+  .zero 4
+.align 2
+g3607:
+  .zero 2
+.align 2
+g3606:
+  .zero 2
+.align 2
+g3605:
+  .zero 2
+.align 1
+g3604:
+  .zero 1
+.align 1
+g3603:
+  .zero 1
+.align 4
+g3602:
+  .zero 4
+.align 2
+g3601:
+  .zero 2
+.align 8
+g3600:
+  .zero 8
+.align 4
+g3599:
+  .zero 4
+.align 8
+g3598:
+  .zero 8
+.align 2
+g3597:
+  .zero 2
+.align 2
+g3596:
+  .zero 2
+.align 1
+g3595:
+  .zero 1
+.align 2
+g3594:
+  .zero 2
+.align 4
+g3593:
+  .zero 4
+.align 2
+g3592:
+  .zero 2
+.align 2
+g3591:
+  .zero 2
+.align 8
+g3590:
+  .zero 8
+.align 1
+g3589:
+  .zero 1
+.align 8
+g3588:
+  .zero 8
+.align 4
+g3587:
+  .zero 4
+.align 8
+g3586:
+  .zero 8
+.align 8
+g3585:
+  .zero 8
+.align 8
+g3584:
+  .zero 8
+.align 8
+g3583:
+  .zero 8
+.align 4
+g3582:
+  .zero 4
+.align 1
+g3581:
+  .zero 1
+.align 8
+g3580:
+  .zero 8
+.align 1
+g3579:
+  .zero 1
+.align 4
+g3578:
+  .zero 4
+.align 4
+g3577:
+  .zero 4
+.align 8
+g3576:
+  .zero 8
+.align 1
+g3575:
+  .zero 1
+.align 8
+g3574:
+  .zero 8
+.align 4
+g3573:
+  .zero 4
+.align 8
+g3572:
+  .zero 8
+.align 8
+g3571:
+  .zero 8
+.align 2
+g3570:
+  .zero 2
+.align 4
+g3569:
+  .zero 4
+.align 4
+g3568:
+  .zero 4
+.align 2
+g3567:
+  .zero 2
+.align 2
+g3566:
+  .zero 2
+.align 8
+g3565:
+  .zero 8
+.align 1
+g3564:
+  .zero 1
+.align 4
+g3563:
+  .zero 4
+.align 2
+g3562:
+  .zero 2
+.align 1
+g3561:
+  .zero 1
+.align 1
+g3560:
+  .zero 1
+.align 2
+g3559:
+  .zero 2
+.align 4
+g3558:
+  .zero 4
+.align 8
+g3557:
+  .zero 8
+.align 4
+g3556:
+  .zero 4
+.align 1
+g3555:
+  .zero 1
+.align 4
+g3554:
+  .zero 4
+.align 8
+g3553:
+  .zero 8
+.align 8
+g3552:
+  .zero 8
+.align 1
+g3551:
+  .zero 1
+.align 1
+g3550:
+  .zero 1
+.align 2
+g3549:
+  .zero 2
+.align 1
+g3548:
+  .zero 1
+.align 8
+g3547:
+  .zero 8
+.align 1
+g3546:
+  .zero 1
+.align 1
+g3545:
+  .zero 1
+.align 1
+g3544:
+  .zero 1
+.align 2
+g3543:
+  .zero 2
+.align 2
+g3542:
+  .zero 2
+.align 2
+g3541:
+  .zero 2
+.align 8
+g3540:
+  .zero 8
+.align 8
+g3539:
+  .zero 8
+.align 1
+g3538:
+  .zero 1
+.align 1
+g3537:
+  .zero 1
+.align 1
+g3536:
+  .zero 1
+.align 1
+g3535:
+  .zero 1
+.align 8
+g3534:
+  .zero 8
+.align 2
+g3533:
+  .zero 2
+.align 8
+g3532:
+  .zero 8
+.align 8
+g3531:
+  .zero 8
+.align 4
+g3530:
+  .zero 4
+.align 4
+g3529:
+  .zero 4
+.align 2
+g3528:
+  .zero 2
+.align 4
+g3527:
+  .zero 4
+.align 4
+g3526:
+  .zero 4
+.align 4
+g3525:
+  .zero 4
+.align 1
+g3524:
+  .zero 1
+.align 4
+g3523:
+  .zero 4
+.align 4
+g3522:
+  .zero 4
+.align 1
+g3521:
+  .zero 1
+.align 1
+g3520:
+  .zero 1
+.align 4
+g3519:
+  .zero 4
+.align 8
+g3518:
+  .zero 8
+.align 2
+g3517:
+  .zero 2
+.align 1
+g3516:
+  .zero 1
+.align 4
+g3515:
+  .zero 4
+.align 1
+g3514:
+  .zero 1
+.align 4
+g3513:
+  .zero 4
+.align 1
+g3512:
+  .zero 1
+.align 4
+g3511:
+  .zero 4
+.align 8
+g3510:
+  .zero 8
+.align 2
+g3509:
+  .zero 2
+.align 4
+g3508:
+  .zero 4
+.align 1
+g3507:
+  .zero 1
+.align 1
+g3506:
+  .zero 1
+.align 4
+g3505:
+  .zero 4
+.align 1
+g3504:
+  .zero 1
+.align 1
+g3503:
+  .zero 1
+.align 1
+g3502:
+  .zero 1
+.align 1
+g3501:
+  .zero 1
+.align 4
+g3500:
+  .zero 4
+.align 1
+g3499:
+  .zero 1
+.align 8
+g3498:
+  .zero 8
+.align 4
+g3497:
+  .zero 4
+.align 1
+g3496:
+  .zero 1
+.align 1
+g3495:
+  .zero 1
+.align 8
+g3494:
+  .zero 8
+.align 1
+g3493:
+  .zero 1
+.align 4
+g3492:
+  .zero 4
+.align 2
+g3491:
+  .zero 2
+.align 2
+g3490:
+  .zero 2
+.align 8
+g3489:
+  .zero 8
+.align 1
+g3488:
+  .zero 1
+.align 2
+g3487:
+  .zero 2
+.align 8
+g3486:
+  .zero 8
+.align 2
+g3485:
+  .zero 2
+.align 8
+g3484:
+  .zero 8
+.align 1
+g3483:
+  .zero 1
+.align 8
+g3482:
+  .zero 8
+.align 4
+g3481:
+  .zero 4
+.align 1
+g3480:
+  .zero 1
+.align 8
+g3479:
+  .zero 8
+.align 1
+g3478:
+  .zero 1
+.align 1
+g3477:
+  .zero 1
+.align 2
+g3476:
+  .zero 2
+.align 1
+g3475:
+  .zero 1
+.align 4
+g3474:
+  .zero 4
+.align 8
+g3473:
+  .zero 8
+.align 1
+g3472:
+  .zero 1
+.align 8
+g3471:
+  .zero 8
+.align 4
+g3470:
+  .zero 4
+.align 8
+g3469:
+  .zero 8
+.align 1
+g3468:
+  .zero 1
+.align 8
+g3467:
+  .zero 8
+.align 4
+g3466:
+  .zero 4
+.align 1
+g3465:
+  .zero 1
+.align 8
+g3464:
+  .zero 8
+.align 1
+g3463:
+  .zero 1
+.align 8
+g3462:
+  .zero 8
+.align 1
+g3461:
+  .zero 1
+.align 1
+g3460:
+  .zero 1
+.align 4
+g3459:
+  .zero 4
+.align 2
+g3458:
+  .zero 2
+.align 2
+g3457:
+  .zero 2
+.align 8
+g3456:
+  .zero 8
+.align 1
+g3455:
+  .zero 1
+.align 1
+g3454:
+  .zero 1
+.align 1
+g3453:
+  .zero 1
+.align 8
+g3452:
+  .zero 8
+.align 4
+g3451:
+  .zero 4
+.align 1
+g3450:
+  .zero 1
+.align 1
+g3449:
+  .zero 1
+.align 1
+g3448:
+  .zero 1
+.align 4
+g3447:
+  .zero 4
+.align 1
+g3446:
+  .zero 1
+.align 2
+g3445:
+  .zero 2
+.align 1
+g3444:
+  .zero 1
+.align 1
+g3443:
+  .zero 1
+.align 8
+g3442:
+  .zero 8
+.align 2
+g3441:
+  .zero 2
+.align 8
+g3440:
+  .zero 8
+.align 4
+g3439:
+  .zero 4
+.align 2
+g3438:
+  .zero 2
+.align 1
+g3437:
+  .zero 1
+.align 8
+g3436:
+  .zero 8
+.align 8
+g3435:
+  .zero 8
+.align 2
+g3434:
+  .zero 2
+.align 2
+g3433:
+  .zero 2
+.align 8
+g3432:
+  .zero 8
+.align 8
+g3431:
+  .zero 8
+.align 2
+g3430:
+  .zero 2
+.align 4
+g3429:
+  .zero 4
+.align 4
+g3428:
+  .zero 4
+.align 2
+g3427:
+  .zero 2
+.align 2
+g3426:
+  .zero 2
+.align 8
+g3425:
+  .zero 8
+.align 8
+g3424:
+  .zero 8
+.align 1
+g3423:
+  .zero 1
+.align 8
+g3422:
+  .zero 8
+.align 4
+g3421:
+  .zero 4
+.align 4
+g3420:
+  .zero 4
+.align 8
+g3419:
+  .zero 8
+.align 4
+g3418:
+  .zero 4
+.align 4
+g3417:
+  .zero 4
+.align 1
+g3416:
+  .zero 1
+.align 2
+g3415:
+  .zero 2
+.align 8
+g3414:
+  .zero 8
+.align 8
+g3413:
+  .zero 8
+.align 8
+g3412:
+  .zero 8
+.align 8
+g3411:
+  .zero 8
+.align 4
+g3410:
+  .zero 4
+.align 1
+g3409:
+  .zero 1
+.align 1
+g3408:
+  .zero 1
+.align 8
+g3407:
+  .zero 8
+.align 4
+g3406:
+  .zero 4
+.align 2
+g3405:
+  .zero 2
+.align 4
+g3404:
+  .zero 4
+.align 1
+g3403:
+  .zero 1
+.align 1
+g3402:
+  .zero 1
+.align 8
+g3401:
+  .zero 8
+.align 8
+g3400:
+  .zero 8
+.align 4
+g3399:
+  .zero 4
+.align 8
+g3398:
+  .zero 8
+.align 2
+g3397:
+  .zero 2
+.align 4
+g3396:
+  .zero 4
+.align 1
+g3395:
+  .zero 1
+.align 4
+g3394:
+  .zero 4
+.align 8
+g3393:
+  .zero 8
+.align 2
+g3392:
+  .zero 2
+.align 2
+g3391:
+  .zero 2
+.align 8
+g3390:
+  .zero 8
+.align 8
+g3389:
+  .zero 8
+.align 4
+g3388:
+  .zero 4
+.align 2
+g3387:
+  .zero 2
+.align 1
+g3386:
+  .zero 1
+.align 2
+g3385:
+  .zero 2
+.align 1
+g3384:
+  .zero 1
+.align 2
+g3383:
+  .zero 2
+.align 2
+g3382:
+  .zero 2
+.align 2
+g3381:
+  .zero 2
+.align 1
+g3380:
+  .zero 1
+.align 2
+g3379:
+  .zero 2
+.align 1
+g3378:
+  .zero 1
+.align 1
+g3377:
+  .zero 1
+.align 8
+g3376:
+  .zero 8
+.align 2
+g3375:
+  .zero 2
+.align 8
+g3374:
+  .zero 8
+.align 4
+g3373:
+  .zero 4
+.align 1
+g3372:
+  .zero 1
+.align 4
+g3371:
+  .zero 4
+.align 2
+g3370:
+  .zero 2
+.align 4
+g3369:
+  .zero 4
+.align 1
+g3368:
+  .zero 1
+.align 2
+g3367:
+  .zero 2
+.align 4
+g3366:
+  .zero 4
+.align 4
+g3365:
+  .zero 4
+.align 2
+g3364:
+  .zero 2
+.align 8
+g3363:
+  .zero 8
+.align 4
+g3362:
+  .zero 4
+.align 8
+g3361:
+  .zero 8
+.align 2
+g3360:
+  .zero 2
+.align 1
+g3359:
+  .zero 1
+.align 2
+g3358:
+  .zero 2
+.align 4
+g3357:
+  .zero 4
+.align 2
+g3356:
+  .zero 2
+.align 2
+g3355:
+  .zero 2
+.align 1
+g3354:
+  .zero 1
+.align 1
+g3353:
+  .zero 1
+.align 4
+g3352:
+  .zero 4
+.align 1
+g3351:
+  .zero 1
+.align 8
+g3350:
+  .zero 8
+.align 8
+g3349:
+  .zero 8
+.align 1
+g3348:
+  .zero 1
+.align 8
+g3347:
+  .zero 8
+.align 8
+g3346:
+  .zero 8
+.align 4
+g3345:
+  .zero 4
+.align 2
+g3344:
+  .zero 2
+.align 8
+g3343:
+  .zero 8
+.align 2
+g3342:
+  .zero 2
+.align 1
+g3341:
+  .zero 1
+.align 4
+g3340:
+  .zero 4
+.align 4
+g3339:
+  .zero 4
+.align 8
+g3338:
+  .zero 8
+.align 4
+g3337:
+  .zero 4
+.align 4
+g3336:
+  .zero 4
+.align 4
+g3335:
+  .zero 4
+.align 4
+g3334:
+  .zero 4
+.align 2
+g3333:
+  .zero 2
+.align 4
+g3332:
+  .zero 4
+.align 1
+g3331:
+  .zero 1
+.align 1
+g3330:
+  .zero 1
+.align 1
+g3329:
+  .zero 1
+.align 8
+g3328:
+  .zero 8
+.align 2
+g3327:
+  .zero 2
+.align 2
+g3326:
+  .zero 2
+.align 4
+g3325:
+  .zero 4
+.align 2
+g3324:
+  .zero 2
+.align 4
+g3323:
+  .zero 4
+.align 8
+g3322:
+  .zero 8
+.align 1
+g3321:
+  .zero 1
+.align 1
+g3320:
+  .zero 1
+.align 4
+g3319:
+  .zero 4
+.align 2
+g3318:
+  .zero 2
+.align 1
+g3317:
+  .zero 1
+.align 2
+g3316:
+  .zero 2
+.align 1
+g3315:
+  .zero 1
+.align 8
+g3314:
+  .zero 8
+.align 4
+g3313:
+  .zero 4
+.align 4
+g3312:
+  .zero 4
+.align 4
+g3311:
+  .zero 4
+.align 4
+g3310:
+  .zero 4
+.align 4
+g3309:
+  .zero 4
+.align 4
+g3308:
+  .zero 4
+.align 1
+g3307:
+  .zero 1
+.align 1
+g3306:
+  .zero 1
+.align 2
+g3305:
+  .zero 2
+.align 2
+g3304:
+  .zero 2
+.align 2
+g3303:
+  .zero 2
+.align 1
+g3302:
+  .zero 1
+.align 8
+g3301:
+  .zero 8
+.align 4
+g3300:
+  .zero 4
+.align 4
+g3299:
+  .zero 4
+.align 2
+g3298:
+  .zero 2
+.align 4
+g3297:
+  .zero 4
+.align 1
+g3296:
+  .zero 1
+.align 2
+g3295:
+  .zero 2
+.align 4
+g3294:
+  .zero 4
+.align 2
+g3293:
+  .zero 2
+.align 2
+g3292:
+  .zero 2
+.align 8
+g3291:
+  .zero 8
+.align 4
+g3290:
+  .zero 4
+.align 2
+g3289:
+  .zero 2
+.align 4
+g3288:
+  .zero 4
+.align 8
+g3287:
+  .zero 8
+.align 8
+g3286:
+  .zero 8
+.align 8
+g3285:
+  .zero 8
+.align 4
+g3284:
+  .zero 4
+.align 1
+g3283:
+  .zero 1
+.align 4
+g3282:
+  .zero 4
+.align 8
+g3281:
+  .zero 8
+.align 2
+g3280:
+  .zero 2
+.align 2
+g3279:
+  .zero 2
+.align 4
+g3278:
+  .zero 4
+.align 8
+g3277:
+  .zero 8
+.align 8
+g3276:
+  .zero 8
+.align 8
+g3275:
+  .zero 8
+.align 1
+g3274:
+  .zero 1
+.align 8
+g3273:
+  .zero 8
+.align 1
+g3272:
+  .zero 1
+.align 2
+g3271:
+  .zero 2
+.align 8
+g3270:
+  .zero 8
+.align 1
+g3269:
+  .zero 1
+.align 2
+g3268:
+  .zero 2
+.align 1
+g3267:
+  .zero 1
+.align 1
+g3266:
+  .zero 1
+.align 2
+g3265:
+  .zero 2
+.align 4
+g3264:
+  .zero 4
+.align 8
+g3263:
+  .zero 8
+.align 2
+g3262:
+  .zero 2
+.align 2
+g3261:
+  .zero 2
+.align 4
+g3260:
+  .zero 4
+.align 2
+g3259:
+  .zero 2
+.align 1
+g3258:
+  .zero 1
+.align 8
+g3257:
+  .zero 8
+.align 2
+g3256:
+  .zero 2
+.align 2
+g3255:
+  .zero 2
+.align 1
+g3254:
+  .zero 1
+.align 2
+g3253:
+  .zero 2
+.align 1
+g3252:
+  .zero 1
+.align 8
+g3251:
+  .zero 8
+.align 8
+g3250:
+  .zero 8
+.align 4
+g3249:
+  .zero 4
+.align 8
+g3248:
+  .zero 8
+.align 2
+g3247:
+  .zero 2
+.align 2
+g3246:
+  .zero 2
+.align 1
+g3245:
+  .zero 1
+.align 2
+g3244:
+  .zero 2
+.align 8
+g3243:
+  .zero 8
+.align 2
+g3242:
+  .zero 2
+.align 2
+g3241:
+  .zero 2
+.align 1
+g3240:
+  .zero 1
+.align 4
+g3239:
+  .zero 4
+.align 8
+g3238:
+  .zero 8
+.align 8
+g3237:
+  .zero 8
+.align 1
+g3236:
+  .zero 1
+.align 1
+g3235:
+  .zero 1
+.align 2
+g3234:
+  .zero 2
+.align 8
+g3233:
+  .zero 8
+.align 8
+g3232:
+  .zero 8
+.align 4
+g3231:
+  .zero 4
+.align 4
+g3230:
+  .zero 4
+.align 8
+g3229:
+  .zero 8
+.align 2
+g3228:
+  .zero 2
+.align 8
+g3227:
+  .zero 8
+.align 2
+g3226:
+  .zero 2
+.align 8
+g3225:
+  .zero 8
+.align 4
+g3224:
+  .zero 4
+.align 2
+g3223:
+  .zero 2
+.align 8
+g3222:
+  .zero 8
+.align 4
+g3221:
+  .zero 4
+.align 4
+g3220:
+  .zero 4
+.align 1
+g3219:
+  .zero 1
+.align 2
+g3218:
+  .zero 2
+.align 8
+g3217:
+  .zero 8
+.align 1
+g3216:
+  .zero 1
+.align 8
+g3215:
+  .zero 8
+.align 4
+g3214:
+  .zero 4
+.align 1
+g3213:
+  .zero 1
+.align 4
+g3212:
+  .zero 4
+.align 4
+g3211:
+  .zero 4
+.align 4
+g3210:
+  .zero 4
+.align 4
+g3209:
+  .zero 4
+.align 1
+g3208:
+  .zero 1
+.align 1
+g3207:
+  .zero 1
+.align 1
+g3206:
+  .zero 1
+.align 2
+g3205:
+  .zero 2
+.align 1
+g3204:
+  .zero 1
+.align 1
+g3203:
+  .zero 1
+.align 2
+g3202:
+  .zero 2
+.align 8
+g3201:
+  .zero 8
+.align 4
+g3200:
+  .zero 4
+.align 1
+g3199:
+  .zero 1
+.align 2
+g3198:
+  .zero 2
+.align 4
+g3197:
+  .zero 4
+.align 2
+g3196:
+  .zero 2
+.align 8
+g3195:
+  .zero 8
+.align 4
+g3194:
+  .zero 4
+.align 4
+g3193:
+  .zero 4
+.align 8
+g3192:
+  .zero 8
+.align 4
+g3191:
+  .zero 4
+.align 2
+g3190:
+  .zero 2
+.align 2
+g3189:
+  .zero 2
+.align 8
+g3188:
+  .zero 8
+.align 2
+g3187:
+  .zero 2
+.align 2
+g3186:
+  .zero 2
+.align 1
+g3185:
+  .zero 1
+.align 2
+g3184:
+  .zero 2
+.align 8
+g3183:
+  .zero 8
+.align 1
+g3182:
+  .zero 1
+.align 1
+g3181:
+  .zero 1
+.align 4
+g3180:
+  .zero 4
+.align 4
+g3179:
+  .zero 4
+.align 2
+g3178:
+  .zero 2
+.align 4
+g3177:
+  .zero 4
+.align 1
+g3176:
+  .zero 1
+.align 2
+g3175:
+  .zero 2
+.align 4
+g3174:
+  .zero 4
+.align 2
+g3173:
+  .zero 2
+.align 1
+g3172:
+  .zero 1
+.align 4
+g3171:
+  .zero 4
+.align 2
+g3170:
+  .zero 2
+.align 2
+g3169:
+  .zero 2
+.align 8
+g3168:
+  .zero 8
+.align 4
+g3167:
+  .zero 4
+.align 2
+g3166:
+  .zero 2
+.align 1
+g3165:
+  .zero 1
+.align 2
+g3164:
+  .zero 2
+.align 1
+g3163:
+  .zero 1
+.align 2
+g3162:
+  .zero 2
+.align 8
+g3161:
+  .zero 8
+.align 2
+g3160:
+  .zero 2
+.align 4
+g3159:
+  .zero 4
+.align 8
+g3158:
+  .zero 8
+.align 4
+g3157:
+  .zero 4
+.align 2
+g3156:
+  .zero 2
+.align 1
+g3155:
+  .zero 1
+.align 1
+g3154:
+  .zero 1
+.align 4
+g3153:
+  .zero 4
+.align 2
+g3152:
+  .zero 2
+.align 4
+g3151:
+  .zero 4
+.align 2
+g3150:
+  .zero 2
+.align 2
+g3149:
+  .zero 2
+.align 8
+g3148:
+  .zero 8
+.align 8
+g3147:
+  .zero 8
+.align 1
+g3146:
+  .zero 1
+.align 1
+g3145:
+  .zero 1
+.align 4
+g3144:
+  .zero 4
+.align 8
+g3143:
+  .zero 8
+.align 1
+g3142:
+  .zero 1
+.align 8
+g3141:
+  .zero 8
+.align 2
+g3140:
+  .zero 2
+.align 4
+g3139:
+  .zero 4
+.align 2
+g3138:
+  .zero 2
+.align 4
+g3137:
+  .zero 4
+.align 8
+g3136:
+  .zero 8
+.align 8
+g3135:
+  .zero 8
+.align 4
+g3134:
+  .zero 4
+.align 8
+g3133:
+  .zero 8
+.align 1
+g3132:
+  .zero 1
+.align 1
+g3131:
+  .zero 1
+.align 1
+g3130:
+  .zero 1
+.align 2
+g3129:
+  .zero 2
+.align 1
+g3128:
+  .zero 1
+.align 4
+g3127:
+  .zero 4
+.align 1
+g3126:
+  .zero 1
+.align 1
+g3125:
+  .zero 1
+.align 8
+g3124:
+  .zero 8
+.align 1
+g3123:
+  .zero 1
+.align 8
+g3122:
+  .zero 8
+.align 8
+g3121:
+  .zero 8
+.align 2
+g3120:
+  .zero 2
+.align 4
+g3119:
+  .zero 4
+.align 4
+g3118:
+  .zero 4
+.align 8
+g3117:
+  .zero 8
+.align 1
+g3116:
+  .zero 1
+.align 1
+g3115:
+  .zero 1
+.align 8
+g3114:
+  .zero 8
+.align 8
+g3113:
+  .zero 8
+.align 8
+g3112:
+  .zero 8
+.align 1
+g3111:
+  .zero 1
+.align 2
+g3110:
+  .zero 2
+.align 1
+g3109:
+  .zero 1
+.align 2
+g3108:
+  .zero 2
+.align 8
+g3107:
+  .zero 8
+.align 1
+g3106:
+  .zero 1
+.align 2
+g3105:
+  .zero 2
+.align 4
+g3104:
+  .zero 4
+.align 4
+g3103:
+  .zero 4
+.align 4
+g3102:
+  .zero 4
+.align 2
+g3101:
+  .zero 2
+.align 2
+g3100:
+  .zero 2
+.align 1
+g3099:
+  .zero 1
+.align 8
+g3098:
+  .zero 8
+.align 1
+g3097:
+  .zero 1
+.align 1
+g3096:
+  .zero 1
+.align 2
+g3095:
+  .zero 2
+.align 2
+g3094:
+  .zero 2
+.align 2
+g3093:
+  .zero 2
+.align 4
+g3092:
+  .zero 4
+.align 1
+g3091:
+  .zero 1
+.align 2
+g3090:
+  .zero 2
+.align 1
+g3089:
+  .zero 1
+.align 2
+g3088:
+  .zero 2
+.align 2
+g3087:
+  .zero 2
+.align 1
+g3086:
+  .zero 1
+.align 1
+g3085:
+  .zero 1
+.align 8
+g3084:
+  .zero 8
+.align 1
+g3083:
+  .zero 1
+.align 4
+g3082:
+  .zero 4
+.align 2
+g3081:
+  .zero 2
+.align 2
+g3080:
+  .zero 2
+.align 8
+g3079:
+  .zero 8
+.align 4
+g3078:
+  .zero 4
+.align 4
+g3077:
+  .zero 4
+.align 1
+g3076:
+  .zero 1
+.align 8
+g3075:
+  .zero 8
+.align 2
+g3074:
+  .zero 2
+.align 1
+g3073:
+  .zero 1
+.align 1
+g3072:
+  .zero 1
+.align 1
+g3071:
+  .zero 1
+.align 8
+g3070:
+  .zero 8
+.align 1
+g3069:
+  .zero 1
+.align 2
+g3068:
+  .zero 2
+.align 8
+g3067:
+  .zero 8
+.align 8
+g3066:
+  .zero 8
+.align 1
+g3065:
+  .zero 1
+.align 2
+g3064:
+  .zero 2
+.align 8
+g3063:
+  .zero 8
+.align 1
+g3062:
+  .zero 1
+.align 8
+g3061:
+  .zero 8
+.align 4
+g3060:
+  .zero 4
+.align 4
+g3059:
+  .zero 4
+.align 8
+g3058:
+  .zero 8
+.align 2
+g3057:
+  .zero 2
+.align 1
+g3056:
+  .zero 1
+.align 1
+g3055:
+  .zero 1
+.align 1
+g3054:
+  .zero 1
+.align 8
+g3053:
+  .zero 8
+.align 4
+g3052:
+  .zero 4
+.align 4
+g3051:
+  .zero 4
+.align 8
+g3050:
+  .zero 8
+.align 4
+g3049:
+  .zero 4
+.align 1
+g3048:
+  .zero 1
+.align 2
+g3047:
+  .zero 2
+.align 2
+g3046:
+  .zero 2
+.align 2
+g3045:
+  .zero 2
+.align 8
+g3044:
+  .zero 8
+.align 2
+g3043:
+  .zero 2
+.align 4
+g3042:
+  .zero 4
+.align 4
+g3041:
+  .zero 4
+.align 4
+g3040:
+  .zero 4
+.align 2
+g3039:
+  .zero 2
+.align 8
+g3038:
+  .zero 8
+.align 1
+g3037:
+  .zero 1
+.align 4
+g3036:
+  .zero 4
+.align 1
+g3035:
+  .zero 1
+.align 8
+g3034:
+  .zero 8
+.align 4
+g3033:
+  .zero 4
+.align 4
+g3032:
+  .zero 4
+.align 2
+g3031:
+  .zero 2
+.align 2
+g3030:
+  .zero 2
+.align 4
+g3029:
+  .zero 4
+.align 4
+g3028:
+  .zero 4
+.align 2
+g3027:
+  .zero 2
+.align 4
+g3026:
+  .zero 4
+.align 4
+g3025:
+  .zero 4
+.align 8
+g3024:
+  .zero 8
+.align 8
+g3023:
+  .zero 8
+.align 2
+g3022:
+  .zero 2
+.align 8
+g3021:
+  .zero 8
+.align 8
+g3020:
+  .zero 8
+.align 2
+g3019:
+  .zero 2
+.align 1
+g3018:
+  .zero 1
+.align 1
+g3017:
+  .zero 1
+.align 4
+g3016:
+  .zero 4
+.align 4
+g3015:
+  .zero 4
+.align 8
+g3014:
+  .zero 8
+.align 1
+g3013:
+  .zero 1
+.align 1
+g3012:
+  .zero 1
+.align 2
+g3011:
+  .zero 2
+.align 2
+g3010:
+  .zero 2
+.align 4
+g3009:
+  .zero 4
+.align 4
+g3008:
+  .zero 4
+.align 1
+g3007:
+  .zero 1
+.align 2
+g3006:
+  .zero 2
+.align 4
+g3005:
+  .zero 4
+.align 2
+g3004:
+  .zero 2
+.align 8
+g3003:
+  .zero 8
+.align 1
+g3002:
+  .zero 1
+.align 4
+g3001:
+  .zero 4
+.align 8
+g3000:
+  .zero 8
+.align 2
+g2999:
+  .zero 2
+.align 8
+g2998:
+  .zero 8
+.align 8
+g2997:
+  .zero 8
+.align 8
+g2996:
+  .zero 8
+.align 4
+g2995:
+  .zero 4
+.align 4
+g2994:
+  .zero 4
+.align 8
+g2993:
+  .zero 8
+.align 1
+g2992:
+  .zero 1
+.align 1
+g2991:
+  .zero 1
+.align 2
+g2990:
+  .zero 2
+.align 2
+g2989:
+  .zero 2
+.align 2
+g2988:
+  .zero 2
+.align 1
+g2987:
+  .zero 1
+.align 4
+g2986:
+  .zero 4
+.align 1
+g2985:
+  .zero 1
+.align 1
+g2984:
+  .zero 1
+.align 4
+g2983:
+  .zero 4
+.align 2
+g2982:
+  .zero 2
+.align 8
+g2981:
+  .zero 8
+.align 1
+g2980:
+  .zero 1
+.align 2
+g2979:
+  .zero 2
+.align 1
+g2978:
+  .zero 1
+.align 8
+g2977:
+  .zero 8
+.align 1
+g2976:
+  .zero 1
+.align 1
+g2975:
+  .zero 1
+.align 2
+g2974:
+  .zero 2
+.align 2
+g2973:
+  .zero 2
+.align 1
+g2972:
+  .zero 1
+.align 4
+g2971:
+  .zero 4
+.align 2
+g2970:
+  .zero 2
+.align 4
+g2969:
+  .zero 4
+.align 4
+g2968:
+  .zero 4
+.align 2
+g2967:
+  .zero 2
+.align 4
+g2966:
+  .zero 4
+.align 2
+g2965:
+  .zero 2
+.align 8
+g2964:
+  .zero 8
+.align 4
+g2963:
+  .zero 4
+.align 4
+g2962:
+  .zero 4
+.align 2
+g2961:
+  .zero 2
+.align 1
+g2960:
+  .zero 1
+.align 8
+g2959:
+  .zero 8
+.align 8
+g2958:
+  .zero 8
+.align 8
+g2957:
+  .zero 8
+.align 4
+g2956:
+  .zero 4
+.align 1
+g2955:
+  .zero 1
+.align 2
+g2954:
+  .zero 2
+.align 2
+g2953:
+  .zero 2
+.align 1
+g2952:
+  .zero 1
+.align 8
+g2951:
+  .zero 8
+.align 2
+g2950:
+  .zero 2
+.align 8
+g2949:
+  .zero 8
+.align 4
+g2948:
+  .zero 4
+.align 2
+g2947:
+  .zero 2
+.align 4
+g2946:
+  .zero 4
+.align 1
+g2945:
+  .zero 1
+.align 4
+g2944:
+  .zero 4
+.align 1
+g2943:
+  .zero 1
+.align 2
+g2942:
+  .zero 2
+.align 8
+g2941:
+  .zero 8
+.align 8
+g2940:
+  .zero 8
+.align 1
+g2939:
+  .zero 1
+.align 8
+g2938:
+  .zero 8
+.align 8
+g2937:
+  .zero 8
+.align 2
+g2936:
+  .zero 2
+.align 4
+g2935:
+  .zero 4
+.align 4
+g2934:
+  .zero 4
+.align 1
+g2933:
+  .zero 1
+.align 1
+g2932:
+  .zero 1
+.align 4
+g2931:
+  .zero 4
+.align 1
+g2930:
+  .zero 1
+.align 4
+g2929:
+  .zero 4
+.align 2
+g2928:
+  .zero 2
+.align 8
+g2927:
+  .zero 8
+.align 8
+g2926:
+  .zero 8
+.align 2
+g2925:
+  .zero 2
+.align 2
+g2924:
+  .zero 2
+.align 1
+g2923:
+  .zero 1
+.align 8
+g2922:
+  .zero 8
+.align 4
+g2921:
+  .zero 4
+.align 1
+g2920:
+  .zero 1
+.align 1
+g2919:
+  .zero 1
+.align 2
+g2918:
+  .zero 2
+.align 2
+g2917:
+  .zero 2
+.align 8
+g2916:
+  .zero 8
+.align 4
+g2915:
+  .zero 4
+.align 8
+g2914:
+  .zero 8
+.align 4
+g2913:
+  .zero 4
+.align 1
+g2912:
+  .zero 1
+.align 8
+g2911:
+  .zero 8
+.align 4
+g2910:
+  .zero 4
+.align 1
+g2909:
+  .zero 1
+.align 2
+g2908:
+  .zero 2
+.align 8
+g2907:
+  .zero 8
+.align 2
+g2906:
+  .zero 2
+.align 1
+g2905:
+  .zero 1
+.align 8
+g2904:
+  .zero 8
+.align 4
+g2903:
+  .zero 4
+.align 1
+g2902:
+  .zero 1
+.align 1
+g2901:
+  .zero 1
+.align 2
+g2900:
+  .zero 2
+.align 4
+g2899:
+  .zero 4
+.align 1
+g2898:
+  .zero 1
+.align 1
+g2897:
+  .zero 1
+.align 2
+g2896:
+  .zero 2
+.align 4
+g2895:
+  .zero 4
+.align 1
+g2894:
+  .zero 1
+.align 2
+g2893:
+  .zero 2
+.align 1
+g2892:
+  .zero 1
+.align 4
+g2891:
+  .zero 4
+.align 2
+g2890:
+  .zero 2
+.align 4
+g2889:
+  .zero 4
+.align 2
+g2888:
+  .zero 2
+.align 2
+g2887:
+  .zero 2
+.align 4
+g2886:
+  .zero 4
+.align 8
+g2885:
+  .zero 8
+.align 2
+g2884:
+  .zero 2
+.align 4
+g2883:
+  .zero 4
+.align 1
+g2882:
+  .zero 1
+.align 8
+g2881:
+  .zero 8
+.align 4
+g2880:
+  .zero 4
+.align 4
+g2879:
+  .zero 4
+.align 4
+g2878:
+  .zero 4
+.align 8
+g2877:
+  .zero 8
+.align 2
+g2876:
+  .zero 2
+.align 4
+g2875:
+  .zero 4
+.align 4
+g2874:
+  .zero 4
+.align 2
+g2873:
+  .zero 2
+.align 2
+g2872:
+  .zero 2
+.align 8
+g2871:
+  .zero 8
+.align 1
+g2870:
+  .zero 1
+.align 2
+g2869:
+  .zero 2
+.align 4
+g2868:
+  .zero 4
+.align 4
+g2867:
+  .zero 4
+.align 2
+g2866:
+  .zero 2
+.align 8
+g2865:
+  .zero 8
+.align 8
+g2864:
+  .zero 8
+.align 8
+g2863:
+  .zero 8
+.align 4
+g2862:
+  .zero 4
+.align 8
+g2861:
+  .zero 8
+.align 4
+g2860:
+  .zero 4
+.align 2
+g2859:
+  .zero 2
+.align 2
+g2858:
+  .zero 2
+.align 4
+g2857:
+  .zero 4
+.align 2
+g2856:
+  .zero 2
+.align 1
+g2855:
+  .zero 1
+.align 4
+g2854:
+  .zero 4
+.align 4
+g2853:
+  .zero 4
+.align 8
+g2852:
+  .zero 8
+.align 1
+g2851:
+  .zero 1
+.align 1
+g2850:
+  .zero 1
+.align 1
+g2849:
+  .zero 1
+.align 4
+g2848:
+  .zero 4
+.align 2
+g2847:
+  .zero 2
+.align 2
+g2846:
+  .zero 2
+.align 1
+g2845:
+  .zero 1
+.align 2
+g2844:
+  .zero 2
+.align 1
+g2843:
+  .zero 1
+.align 4
+g2842:
+  .zero 4
+.align 8
+g2841:
+  .zero 8
+.align 8
+g2840:
+  .zero 8
+.align 8
+g2839:
+  .zero 8
+.align 2
+g2838:
+  .zero 2
+.align 2
+g2837:
+  .zero 2
+.align 4
+g2836:
+  .zero 4
+.align 1
+g2835:
+  .zero 1
+.align 2
+g2834:
+  .zero 2
+.align 8
+g2833:
+  .zero 8
+.align 8
+g2832:
+  .zero 8
+.align 1
+g2831:
+  .zero 1
+.align 4
+g2830:
+  .zero 4
+.align 2
+g2829:
+  .zero 2
+.align 8
+g2828:
+  .zero 8
+.align 4
+g2827:
+  .zero 4
+.align 8
+g2826:
+  .zero 8
+.align 4
+g2825:
+  .zero 4
+.align 4
+g2824:
+  .zero 4
+.align 1
+g2823:
+  .zero 1
+.align 1
+g2822:
+  .zero 1
+.align 4
+g2821:
+  .zero 4
+.align 1
+g2820:
+  .zero 1
+.align 1
+g2819:
+  .zero 1
+.align 1
+g2818:
+  .zero 1
+.align 1
+g2817:
+  .zero 1
+.align 4
+g2816:
+  .zero 4
+.align 8
+g2815:
+  .zero 8
+.align 8
+g2814:
+  .zero 8
+.align 1
+g2813:
+  .zero 1
+.align 4
+g2812:
+  .zero 4
+.align 8
+g2811:
+  .zero 8
+.align 2
+g2810:
+  .zero 2
+.align 8
+g2809:
+  .zero 8
+.align 4
+g2808:
+  .zero 4
+.align 4
+g2807:
+  .zero 4
+.align 4
+g2806:
+  .zero 4
+.align 8
+g2805:
+  .zero 8
+.align 1
+g2804:
+  .zero 1
+.align 1
+g2803:
+  .zero 1
+.align 2
+g2802:
+  .zero 2
+.align 8
+g2801:
+  .zero 8
+.align 8
+g2800:
+  .zero 8
+.align 2
+g2799:
+  .zero 2
+.align 8
+g2798:
+  .zero 8
+.align 1
+g2797:
+  .zero 1
+.align 4
+g2796:
+  .zero 4
+.align 4
+g2795:
+  .zero 4
+.align 4
+g2794:
+  .zero 4
+.align 2
+g2793:
+  .zero 2
+.align 2
+g2792:
+  .zero 2
+.align 2
+g2791:
+  .zero 2
+.align 2
+g2790:
+  .zero 2
+.align 2
+g2789:
+  .zero 2
+.align 2
+g2788:
+  .zero 2
+.align 8
+g2787:
+  .zero 8
+.align 8
+g2786:
+  .zero 8
+.align 2
+g2785:
+  .zero 2
+.align 8
+g2784:
+  .zero 8
+.align 1
+g2783:
+  .zero 1
+.align 4
+g2782:
+  .zero 4
+.align 4
+g2781:
+  .zero 4
+.align 4
+g2780:
+  .zero 4
+.align 1
+g2779:
+  .zero 1
+.align 1
+g2778:
+  .zero 1
+.align 1
+g2777:
+  .zero 1
+.align 4
+g2776:
+  .zero 4
+.align 2
+g2775:
+  .zero 2
+.align 2
+g2774:
+  .zero 2
+.align 1
+g2773:
+  .zero 1
+.align 4
+g2772:
+  .zero 4
+.align 4
+g2771:
+  .zero 4
+.align 1
+g2770:
+  .zero 1
+.align 4
+g2769:
+  .zero 4
+.align 1
+g2768:
+  .zero 1
+.align 8
+g2767:
+  .zero 8
+.align 4
+g2766:
+  .zero 4
+.align 4
+g2765:
+  .zero 4
+.align 8
+g2764:
+  .zero 8
+.align 1
+g2763:
+  .zero 1
+.align 4
+g2762:
+  .zero 4
+.align 8
+g2761:
+  .zero 8
+.align 1
+g2760:
+  .zero 1
+.align 8
+g2759:
+  .zero 8
+.align 8
+g2758:
+  .zero 8
+.align 1
+g2757:
+  .zero 1
+.align 4
+g2756:
+  .zero 4
+.align 4
+g2755:
+  .zero 4
+.align 8
+g2754:
+  .zero 8
+.align 4
+g2753:
+  .zero 4
+.align 8
+g2752:
+  .zero 8
+.align 1
+g2751:
+  .zero 1
+.align 4
+g2750:
+  .zero 4
+.align 2
+g2749:
+  .zero 2
+.align 1
+g2748:
+  .zero 1
+.align 1
+g2747:
+  .zero 1
+.align 8
+g2746:
+  .zero 8
+.align 1
+g2745:
+  .zero 1
+.align 2
+g2744:
+  .zero 2
+.align 8
+g2743:
+  .zero 8
+.align 2
+g2742:
+  .zero 2
+.align 4
+g2741:
+  .zero 4
+.align 4
+g2740:
+  .zero 4
+.align 8
+g2739:
+  .zero 8
+.align 4
+g2738:
+  .zero 4
+.align 4
+g2737:
+  .zero 4
+.align 2
+g2736:
+  .zero 2
+.align 4
+g2735:
+  .zero 4
+.align 8
+g2734:
+  .zero 8
+.align 8
+g2733:
+  .zero 8
+.align 2
+g2732:
+  .zero 2
+.align 8
+g2731:
+  .zero 8
+.align 4
+g2730:
+  .zero 4
+.align 4
+g2729:
+  .zero 4
+.align 1
+g2728:
+  .zero 1
+.align 1
+g2727:
+  .zero 1
+.align 2
+g2726:
+  .zero 2
+.align 1
+g2725:
+  .zero 1
+.align 4
+g2724:
+  .zero 4
+.align 8
+g2723:
+  .zero 8
+.align 8
+g2722:
+  .zero 8
+.align 1
+g2721:
+  .zero 1
+.align 4
+g2720:
+  .zero 4
+.align 8
+g2719:
+  .zero 8
+.align 8
+g2718:
+  .zero 8
+.align 1
+g2717:
+  .zero 1
+.align 4
+g2716:
+  .zero 4
+.align 8
+g2715:
+  .zero 8
+.align 4
+g2714:
+  .zero 4
+.align 4
+g2713:
+  .zero 4
+.align 8
+g2712:
+  .zero 8
+.align 4
+g2711:
+  .zero 4
+.align 4
+g2710:
+  .zero 4
+.align 4
+g2709:
+  .zero 4
+.align 8
+g2708:
+  .zero 8
+.align 1
+g2707:
+  .zero 1
+.align 1
+g2706:
+  .zero 1
+.align 1
+g2705:
+  .zero 1
+.align 2
+g2704:
+  .zero 2
+.align 8
+g2703:
+  .zero 8
+.align 8
+g2702:
+  .zero 8
+.align 1
+g2701:
+  .zero 1
+.align 4
+g2700:
+  .zero 4
+.align 1
+g2699:
+  .zero 1
+.align 4
+g2698:
+  .zero 4
+.align 1
+g2697:
+  .zero 1
+.align 1
+g2696:
+  .zero 1
+.align 4
+g2695:
+  .zero 4
+.align 1
+g2694:
+  .zero 1
+.align 8
+g2693:
+  .zero 8
+.align 2
+g2692:
+  .zero 2
+.align 4
+g2691:
+  .zero 4
+.align 2
+g2690:
+  .zero 2
+.align 1
+g2689:
+  .zero 1
+.align 2
+g2688:
+  .zero 2
+.align 4
+g2687:
+  .zero 4
+.align 1
+g2686:
+  .zero 1
+.align 2
+g2685:
+  .zero 2
+.align 2
+g2684:
+  .zero 2
+.align 1
+g2683:
+  .zero 1
+.align 4
+g2682:
+  .zero 4
+.align 8
+g2681:
+  .zero 8
+.align 1
+g2680:
+  .zero 1
+.align 1
+g2679:
+  .zero 1
+.align 2
+g2678:
+  .zero 2
+.align 8
+g2677:
+  .zero 8
+.align 2
+g2676:
+  .zero 2
+.align 8
+g2675:
+  .zero 8
+.align 1
+g2674:
+  .zero 1
+.align 2
+g2673:
+  .zero 2
+.align 8
+g2672:
+  .zero 8
+.align 1
+g2671:
+  .zero 1
+.align 8
+g2670:
+  .zero 8
+.align 2
+g2669:
+  .zero 2
+.align 2
+g2668:
+  .zero 2
+.align 2
+g2667:
+  .zero 2
+.align 1
+g2666:
+  .zero 1
+.align 1
+g2665:
+  .zero 1
+.align 8
+g2664:
+  .zero 8
+.align 4
+g2663:
+  .zero 4
+.align 1
+g2662:
+  .zero 1
+.align 8
+g2661:
+  .zero 8
+.align 1
+g2660:
+  .zero 1
+.align 2
+g2659:
+  .zero 2
+.align 1
+g2658:
+  .zero 1
+.align 2
+g2657:
+  .zero 2
+.align 4
+g2656:
+  .zero 4
+.align 1
+g2655:
+  .zero 1
+.align 8
+g2654:
+  .zero 8
+.align 1
+g2653:
+  .zero 1
+.align 2
+g2652:
+  .zero 2
+.align 2
+g2651:
+  .zero 2
+.align 8
+g2650:
+  .zero 8
+.align 8
+g2649:
+  .zero 8
+.align 4
+g2648:
+  .zero 4
+.align 8
+g2647:
+  .zero 8
+.align 1
+g2646:
+  .zero 1
+.align 2
+g2645:
+  .zero 2
+.align 8
+g2644:
+  .zero 8
+.align 4
+g2643:
+  .zero 4
+.align 4
+g2642:
+  .zero 4
+.align 1
+g2641:
+  .zero 1
+.align 1
+g2640:
+  .zero 1
+.align 4
+g2639:
+  .zero 4
+.align 8
+g2638:
+  .zero 8
+.align 2
+g2637:
+  .zero 2
+.align 2
+g2636:
+  .zero 2
+.align 4
+g2635:
+  .zero 4
+.align 4
+g2634:
+  .zero 4
+.align 8
+g2633:
+  .zero 8
+.align 4
+g2632:
+  .zero 4
+.align 1
+g2631:
+  .zero 1
+.align 8
+g2630:
+  .zero 8
+.align 8
+g2629:
+  .zero 8
+.align 4
+g2628:
+  .zero 4
+.align 1
+g2627:
+  .zero 1
+.align 4
+g2626:
+  .zero 4
+.align 2
+g2625:
+  .zero 2
+.align 4
+g2624:
+  .zero 4
+.align 1
+g2623:
+  .zero 1
+.align 2
+g2622:
+  .zero 2
+.align 4
+g2621:
+  .zero 4
+.align 4
+g2620:
+  .zero 4
+.align 1
+g2619:
+  .zero 1
+.align 8
+g2618:
+  .zero 8
+.align 8
+g2617:
+  .zero 8
+.align 2
+g2616:
+  .zero 2
+.align 2
+g2615:
+  .zero 2
+.align 4
+g2614:
+  .zero 4
+.align 1
+g2613:
+  .zero 1
+.align 2
+g2612:
+  .zero 2
+.align 8
+g2611:
+  .zero 8
+.align 4
+g2610:
+  .zero 4
+.align 8
+g2609:
+  .zero 8
+.align 8
+g2608:
+  .zero 8
+.align 1
+g2607:
+  .zero 1
+.align 4
+g2606:
+  .zero 4
+.align 2
+g2605:
+  .zero 2
+.align 8
+g2604:
+  .zero 8
+.align 4
+g2603:
+  .zero 4
+.align 4
+g2602:
+  .zero 4
+.align 1
+g2601:
+  .zero 1
+.align 4
+g2600:
+  .zero 4
+.align 1
+g2599:
+  .zero 1
+.align 2
+g2598:
+  .zero 2
+.align 4
+g2597:
+  .zero 4
+.align 1
+g2596:
+  .zero 1
+.align 1
+g2595:
+  .zero 1
+.align 2
+g2594:
+  .zero 2
+.align 8
+g2593:
+  .zero 8
+.align 2
+g2592:
+  .zero 2
+.align 8
+g2591:
+  .zero 8
+.align 2
+g2590:
+  .zero 2
+.align 1
+g2589:
+  .zero 1
+.align 4
+g2588:
+  .zero 4
+.align 8
+g2587:
+  .zero 8
+.align 8
+g2586:
+  .zero 8
+.align 8
+g2585:
+  .zero 8
+.align 2
+g2584:
+  .zero 2
+.align 2
+g2583:
+  .zero 2
+.align 4
+g2582:
+  .zero 4
+.align 8
+g2581:
+  .zero 8
+.align 8
+g2580:
+  .zero 8
+.align 4
+g2579:
+  .zero 4
+.align 4
+g2578:
+  .zero 4
+.align 8
+g2577:
+  .zero 8
+.align 1
+g2576:
+  .zero 1
+.align 2
+g2575:
+  .zero 2
+.align 8
+g2574:
+  .zero 8
+.align 1
+g2573:
+  .zero 1
+.align 4
+g2572:
+  .zero 4
+.align 2
+g2571:
+  .zero 2
+.align 2
+g2570:
+  .zero 2
+.align 2
+g2569:
+  .zero 2
+.align 2
+g2568:
+  .zero 2
+.align 4
+g2567:
+  .zero 4
+.align 8
+g2566:
+  .zero 8
+.align 2
+g2565:
+  .zero 2
+.align 1
+g2564:
+  .zero 1
+.align 8
+g2563:
+  .zero 8
+.align 8
+g2562:
+  .zero 8
+.align 2
+g2561:
+  .zero 2
+.align 8
+g2560:
+  .zero 8
+.align 1
+g2559:
+  .zero 1
+.align 8
+g2558:
+  .zero 8
+.align 4
+g2557:
+  .zero 4
+.align 1
+g2556:
+  .zero 1
+.align 1
+g2555:
+  .zero 1
+.align 2
+g2554:
+  .zero 2
+.align 4
+g2553:
+  .zero 4
+.align 8
+g2552:
+  .zero 8
+.align 1
+g2551:
+  .zero 1
+.align 2
+g2550:
+  .zero 2
+.align 8
+g2549:
+  .zero 8
+.align 4
+g2548:
+  .zero 4
+.align 2
+g2547:
+  .zero 2
+.align 1
+g2546:
+  .zero 1
+.align 2
+g2545:
+  .zero 2
+.align 4
+g2544:
+  .zero 4
+.align 8
+g2543:
+  .zero 8
+.align 4
+g2542:
+  .zero 4
+.align 8
+g2541:
+  .zero 8
+.align 4
+g2540:
+  .zero 4
+.align 2
+g2539:
+  .zero 2
+.align 1
+g2538:
+  .zero 1
+.align 2
+g2537:
+  .zero 2
+.align 1
+g2536:
+  .zero 1
+.align 4
+g2535:
+  .zero 4
+.align 2
+g2534:
+  .zero 2
+.align 8
+g2533:
+  .zero 8
+.align 2
+g2532:
+  .zero 2
+.align 2
+g2531:
+  .zero 2
+.align 1
+g2530:
+  .zero 1
+.align 4
+g2529:
+  .zero 4
+.align 8
+g2528:
+  .zero 8
+.align 1
+g2527:
+  .zero 1
+.align 1
+g2526:
+  .zero 1
+.align 1
+g2525:
+  .zero 1
+.align 4
+g2524:
+  .zero 4
+.align 8
+g2523:
+  .zero 8
+.align 8
+g2522:
+  .zero 8
+.align 8
+g2521:
+  .zero 8
+.align 8
+g2520:
+  .zero 8
+.align 1
+g2519:
+  .zero 1
+.align 4
+g2518:
+  .zero 4
+.align 4
+g2517:
+  .zero 4
+.align 8
+g2516:
+  .zero 8
+.align 1
+g2515:
+  .zero 1
+.align 2
+g2514:
+  .zero 2
+.align 2
+g2513:
+  .zero 2
+.align 8
+g2512:
+  .zero 8
+.align 4
+g2511:
+  .zero 4
+.align 2
+g2510:
+  .zero 2
+.align 1
+g2509:
+  .zero 1
+.align 8
+g2508:
+  .zero 8
+.align 4
+g2507:
+  .zero 4
+.align 4
+g2506:
+  .zero 4
+.align 1
+g2505:
+  .zero 1
+.align 2
+g2504:
+  .zero 2
+.align 4
+g2503:
+  .zero 4
+.align 8
+g2502:
+  .zero 8
+.align 4
+g2501:
+  .zero 4
+.align 8
+g2500:
+  .zero 8
+.align 1
+g2499:
+  .zero 1
+.align 2
+g2498:
+  .zero 2
+.align 2
+g2497:
+  .zero 2
+.align 8
+g2496:
+  .zero 8
+.align 8
+g2495:
+  .zero 8
+.align 8
+g2494:
+  .zero 8
+.align 4
+g2493:
+  .zero 4
+.align 1
+g2492:
+  .zero 1
+.align 1
+g2491:
+  .zero 1
+.align 1
+g2490:
+  .zero 1
+.align 8
+g2489:
+  .zero 8
+.align 8
+g2488:
+  .zero 8
+.align 8
+g2487:
+  .zero 8
+.align 2
+g2486:
+  .zero 2
+.align 4
+g2485:
+  .zero 4
+.align 1
+g2484:
+  .zero 1
+.align 8
+g2483:
+  .zero 8
+.align 8
+g2482:
+  .zero 8
+.align 8
+g2481:
+  .zero 8
+.align 1
+g2480:
+  .zero 1
+.align 2
+g2479:
+  .zero 2
+.align 1
+g2478:
+  .zero 1
+.align 1
+g2477:
+  .zero 1
+.align 1
+g2476:
+  .zero 1
+.align 1
+g2475:
+  .zero 1
+.align 2
+g2474:
+  .zero 2
+.align 4
+g2473:
+  .zero 4
+.align 2
+g2472:
+  .zero 2
+.align 2
+g2471:
+  .zero 2
+.align 8
+g2470:
+  .zero 8
+.align 4
+g2469:
+  .zero 4
+.align 8
+g2468:
+  .zero 8
+.align 1
+g2467:
+  .zero 1
+.align 4
+g2466:
+  .zero 4
+.align 8
+g2465:
+  .zero 8
+.align 1
+g2464:
+  .zero 1
+.align 8
+g2463:
+  .zero 8
+.align 4
+g2462:
+  .zero 4
+.align 8
+g2461:
+  .zero 8
+.align 1
+g2460:
+  .zero 1
+.align 1
+g2459:
+  .zero 1
+.align 8
+g2458:
+  .zero 8
+.align 2
+g2457:
+  .zero 2
+.align 8
+g2456:
+  .zero 8
+.align 2
+g2455:
+  .zero 2
+.align 8
+g2454:
+  .zero 8
+.align 8
+g2453:
+  .zero 8
+.align 2
+g2452:
+  .zero 2
+.align 8
+g2451:
+  .zero 8
+.align 2
+g2450:
+  .zero 2
+.align 4
+g2449:
+  .zero 4
+.align 8
+g2448:
+  .zero 8
+.align 2
+g2447:
+  .zero 2
+.align 2
+g2446:
+  .zero 2
+.align 1
+g2445:
+  .zero 1
+.align 8
+g2444:
+  .zero 8
+.align 4
+g2443:
+  .zero 4
+.align 4
+g2442:
+  .zero 4
+.align 4
+g2441:
+  .zero 4
+.align 4
+g2440:
+  .zero 4
+.align 4
+g2439:
+  .zero 4
+.align 1
+g2438:
+  .zero 1
+.align 4
+g2437:
+  .zero 4
+.align 2
+g2436:
+  .zero 2
+.align 2
+g2435:
+  .zero 2
+.align 8
+g2434:
+  .zero 8
+.align 1
+g2433:
+  .zero 1
+.align 8
+g2432:
+  .zero 8
+.align 8
+g2431:
+  .zero 8
+.align 8
+g2430:
+  .zero 8
+.align 4
+g2429:
+  .zero 4
+.align 2
+g2428:
+  .zero 2
+.align 1
+g2427:
+  .zero 1
+.align 8
+g2426:
+  .zero 8
+.align 1
+g2425:
+  .zero 1
+.align 2
+g2424:
+  .zero 2
+.align 8
+g2423:
+  .zero 8
+.align 1
+g2422:
+  .zero 1
+.align 2
+g2421:
+  .zero 2
+.align 2
+g2420:
+  .zero 2
+.align 4
+g2419:
+  .zero 4
+.align 2
+g2418:
+  .zero 2
+.align 8
+g2417:
+  .zero 8
+.align 1
+g2416:
+  .zero 1
+.align 4
+g2415:
+  .zero 4
+.align 4
+g2414:
+  .zero 4
+.align 4
+g2413:
+  .zero 4
+.align 1
+g2412:
+  .zero 1
+.align 1
+g2411:
+  .zero 1
+.align 4
+g2410:
+  .zero 4
+.align 4
+g2409:
+  .zero 4
+.align 8
+g2408:
+  .zero 8
+.align 8
+g2407:
+  .zero 8
+.align 4
+g2406:
+  .zero 4
+.align 4
+g2405:
+  .zero 4
+.align 1
+g2404:
+  .zero 1
+.align 8
+g2403:
+  .zero 8
+.align 8
+g2402:
+  .zero 8
+.align 4
+g2401:
+  .zero 4
+.align 8
+g2400:
+  .zero 8
+.align 4
+g2399:
+  .zero 4
+.align 1
+g2398:
+  .zero 1
+.align 1
+g2397:
+  .zero 1
+.align 8
+g2396:
+  .zero 8
+.align 1
+g2395:
+  .zero 1
+.align 2
+g2394:
+  .zero 2
+.align 8
+g2393:
+  .zero 8
+.align 2
+g2392:
+  .zero 2
+.align 8
+g2391:
+  .zero 8
+.align 2
+g2390:
+  .zero 2
+.align 8
+g2389:
+  .zero 8
+.align 8
+g2388:
+  .zero 8
+.align 8
+g2387:
+  .zero 8
+.align 1
+g2386:
+  .zero 1
+.align 1
+g2385:
+  .zero 1
+.align 4
+g2384:
+  .zero 4
+.align 4
+g2383:
+  .zero 4
+.align 2
+g2382:
+  .zero 2
+.align 2
+g2381:
+  .zero 2
+.align 2
+g2380:
+  .zero 2
+.align 2
+g2379:
+  .zero 2
+.align 2
+g2378:
+  .zero 2
+.align 8
+g2377:
+  .zero 8
+.align 4
+g2376:
+  .zero 4
+.align 2
+g2375:
+  .zero 2
+.align 1
+g2374:
+  .zero 1
+.align 2
+g2373:
+  .zero 2
+.align 1
+g2372:
+  .zero 1
+.align 2
+g2371:
+  .zero 2
+.align 2
+g2370:
+  .zero 2
+.align 2
+g2369:
+  .zero 2
+.align 2
+g2368:
+  .zero 2
+.align 8
+g2367:
+  .zero 8
+.align 1
+g2366:
+  .zero 1
+.align 4
+g2365:
+  .zero 4
+.align 1
+g2364:
+  .zero 1
+.align 2
+g2363:
+  .zero 2
+.align 8
+g2362:
+  .zero 8
+.align 8
+g2361:
+  .zero 8
+.align 4
+g2360:
+  .zero 4
+.align 2
+g2359:
+  .zero 2
+.align 2
+g2358:
+  .zero 2
+.align 2
+g2357:
+  .zero 2
+.align 2
+g2356:
+  .zero 2
+.align 1
+g2355:
+  .zero 1
+.align 8
+g2354:
+  .zero 8
+.align 2
+g2353:
+  .zero 2
+.align 4
+g2352:
+  .zero 4
+.align 1
+g2351:
+  .zero 1
+.align 4
+g2350:
+  .zero 4
+.align 4
+g2349:
+  .zero 4
+.align 1
+g2348:
+  .zero 1
+.align 4
+g2347:
+  .zero 4
+.align 1
+g2346:
+  .zero 1
+.align 1
+g2345:
+  .zero 1
+.align 4
+g2344:
+  .zero 4
+.align 2
+g2343:
+  .zero 2
+.align 4
+g2342:
+  .zero 4
+.align 2
+g2341:
+  .zero 2
+.align 1
+g2340:
+  .zero 1
+.align 4
+g2339:
+  .zero 4
+.align 1
+g2338:
+  .zero 1
+.align 1
+g2337:
+  .zero 1
+.align 2
+g2336:
+  .zero 2
+.align 8
+g2335:
+  .zero 8
+.align 4
+g2334:
+  .zero 4
+.align 2
+g2333:
+  .zero 2
+.align 2
+g2332:
+  .zero 2
+.align 4
+g2331:
+  .zero 4
+.align 1
+g2330:
+  .zero 1
+.align 8
+g2329:
+  .zero 8
+.align 1
+g2328:
+  .zero 1
+.align 2
+g2327:
+  .zero 2
+.align 2
+g2326:
+  .zero 2
+.align 8
+g2325:
+  .zero 8
+.align 4
+g2324:
+  .zero 4
+.align 2
+g2323:
+  .zero 2
+.align 4
+g2322:
+  .zero 4
+.align 4
+g2321:
+  .zero 4
+.align 2
+g2320:
+  .zero 2
+.align 2
+g2319:
+  .zero 2
+.align 2
+g2318:
+  .zero 2
+.align 2
+g2317:
+  .zero 2
+.align 8
+g2316:
+  .zero 8
+.align 8
+g2315:
+  .zero 8
+.align 1
+g2314:
+  .zero 1
+.align 2
+g2313:
+  .zero 2
+.align 8
+g2312:
+  .zero 8
+.align 1
+g2311:
+  .zero 1
+.align 1
+g2310:
+  .zero 1
+.align 8
+g2309:
+  .zero 8
+.align 8
+g2308:
+  .zero 8
+.align 2
+g2307:
+  .zero 2
+.align 2
+g2306:
+  .zero 2
+.align 1
+g2305:
+  .zero 1
+.align 4
+g2304:
+  .zero 4
+.align 1
+g2303:
+  .zero 1
+.align 1
+g2302:
+  .zero 1
+.align 4
+g2301:
+  .zero 4
+.align 1
+g2300:
+  .zero 1
+.align 1
+g2299:
+  .zero 1
+.align 4
+g2298:
+  .zero 4
+.align 2
+g2297:
+  .zero 2
+.align 8
+g2296:
+  .zero 8
+.align 1
+g2295:
+  .zero 1
+.align 8
+g2294:
+  .zero 8
+.align 1
+g2293:
+  .zero 1
+.align 4
+g2292:
+  .zero 4
+.align 1
+g2291:
+  .zero 1
+.align 2
+g2290:
+  .zero 2
+.align 1
+g2289:
+  .zero 1
+.align 1
+g2288:
+  .zero 1
+.align 4
+g2287:
+  .zero 4
+.align 1
+g2286:
+  .zero 1
+.align 4
+g2285:
+  .zero 4
+.align 1
+g2284:
+  .zero 1
+.align 8
+g2283:
+  .zero 8
+.align 1
+g2282:
+  .zero 1
+.align 2
+g2281:
+  .zero 2
+.align 8
+g2280:
+  .zero 8
+.align 1
+g2279:
+  .zero 1
+.align 1
+g2278:
+  .zero 1
+.align 2
+g2277:
+  .zero 2
+.align 8
+g2276:
+  .zero 8
+.align 4
+g2275:
+  .zero 4
+.align 2
+g2274:
+  .zero 2
+.align 2
+g2273:
+  .zero 2
+.align 8
+g2272:
+  .zero 8
+.align 2
+g2271:
+  .zero 2
+.align 1
+g2270:
+  .zero 1
+.align 4
+g2269:
+  .zero 4
+.align 4
+g2268:
+  .zero 4
+.align 2
+g2267:
+  .zero 2
+.align 2
+g2266:
+  .zero 2
+.align 2
+g2265:
+  .zero 2
+.align 2
+g2264:
+  .zero 2
+.align 4
+g2263:
+  .zero 4
+.align 1
+g2262:
+  .zero 1
+.align 8
+g2261:
+  .zero 8
+.align 1
+g2260:
+  .zero 1
+.align 1
+g2259:
+  .zero 1
+.align 4
+g2258:
+  .zero 4
+.align 2
+g2257:
+  .zero 2
+.align 8
+g2256:
+  .zero 8
+.align 1
+g2255:
+  .zero 1
+.align 1
+g2254:
+  .zero 1
+.align 8
+g2253:
+  .zero 8
+.align 2
+g2252:
+  .zero 2
+.align 2
+g2251:
+  .zero 2
+.align 4
+g2250:
+  .zero 4
+.align 1
+g2249:
+  .zero 1
+.align 8
+g2248:
+  .zero 8
+.align 8
+g2247:
+  .zero 8
+.align 4
+g2246:
+  .zero 4
+.align 8
+g2245:
+  .zero 8
+.align 1
+g2244:
+  .zero 1
+.align 1
+g2243:
+  .zero 1
+.align 4
+g2242:
+  .zero 4
+.align 1
+g2241:
+  .zero 1
+.align 4
+g2240:
+  .zero 4
+.align 8
+g2239:
+  .zero 8
+.align 1
+g2238:
+  .zero 1
+.align 4
+g2237:
+  .zero 4
+.align 2
+g2236:
+  .zero 2
+.align 2
+g2235:
+  .zero 2
+.align 1
+g2234:
+  .zero 1
+.align 4
+g2233:
+  .zero 4
+.align 2
+g2232:
+  .zero 2
+.align 4
+g2231:
+  .zero 4
+.align 2
+g2230:
+  .zero 2
+.align 4
+g2229:
+  .zero 4
+.align 4
+g2228:
+  .zero 4
+.align 4
+g2227:
+  .zero 4
+.align 8
+g2226:
+  .zero 8
+.align 1
+g2225:
+  .zero 1
+.align 4
+g2224:
+  .zero 4
+.align 1
+g2223:
+  .zero 1
+.align 2
+g2222:
+  .zero 2
+.align 8
+g2221:
+  .zero 8
+.align 8
+g2220:
+  .zero 8
+.align 4
+g2219:
+  .zero 4
+.align 2
+g2218:
+  .zero 2
+.align 4
+g2217:
+  .zero 4
+.align 1
+g2216:
+  .zero 1
+.align 2
+g2215:
+  .zero 2
+.align 1
+g2214:
+  .zero 1
+.align 8
+g2213:
+  .zero 8
+.align 1
+g2212:
+  .zero 1
+.align 1
+g2211:
+  .zero 1
+.align 8
+g2210:
+  .zero 8
+.align 4
+g2209:
+  .zero 4
+.align 2
+g2208:
+  .zero 2
+.align 1
+g2207:
+  .zero 1
+.align 4
+g2206:
+  .zero 4
+.align 1
+g2205:
+  .zero 1
+.align 8
+g2204:
+  .zero 8
+.align 4
+g2203:
+  .zero 4
+.align 2
+g2202:
+  .zero 2
+.align 1
+g2201:
+  .zero 1
+.align 1
+g2200:
+  .zero 1
+.align 1
+g2199:
+  .zero 1
+.align 8
+g2198:
+  .zero 8
+.align 2
+g2197:
+  .zero 2
+.align 4
+g2196:
+  .zero 4
+.align 1
+g2195:
+  .zero 1
+.align 1
+g2194:
+  .zero 1
+.align 1
+g2193:
+  .zero 1
+.align 1
+g2192:
+  .zero 1
+.align 4
+g2191:
+  .zero 4
+.align 1
+g2190:
+  .zero 1
+.align 8
+g2189:
+  .zero 8
+.align 8
+g2188:
+  .zero 8
+.align 2
+g2187:
+  .zero 2
+.align 4
+g2186:
+  .zero 4
+.align 4
+g2185:
+  .zero 4
+.align 1
+g2184:
+  .zero 1
+.align 8
+g2183:
+  .zero 8
+.align 8
+g2182:
+  .zero 8
+.align 4
+g2181:
+  .zero 4
+.align 4
+g2180:
+  .zero 4
+.align 2
+g2179:
+  .zero 2
+.align 1
+g2178:
+  .zero 1
+.align 8
+g2177:
+  .zero 8
+.align 4
+g2176:
+  .zero 4
+.align 8
+g2175:
+  .zero 8
+.align 1
+g2174:
+  .zero 1
+.align 1
+g2173:
+  .zero 1
+.align 1
+g2172:
+  .zero 1
+.align 4
+g2171:
+  .zero 4
+.align 2
+g2170:
+  .zero 2
+.align 1
+g2169:
+  .zero 1
+.align 2
+g2168:
+  .zero 2
+.align 1
+g2167:
+  .zero 1
+.align 2
+g2166:
+  .zero 2
+.align 8
+g2165:
+  .zero 8
+.align 4
+g2164:
+  .zero 4
+.align 4
+g2163:
+  .zero 4
+.align 2
+g2162:
+  .zero 2
+.align 4
+g2161:
+  .zero 4
+.align 2
+g2160:
+  .zero 2
+.align 1
+g2159:
+  .zero 1
+.align 1
+g2158:
+  .zero 1
+.align 1
+g2157:
+  .zero 1
+.align 2
+g2156:
+  .zero 2
+.align 4
+g2155:
+  .zero 4
+.align 4
+g2154:
+  .zero 4
+.align 8
+g2153:
+  .zero 8
+.align 8
+g2152:
+  .zero 8
+.align 8
+g2151:
+  .zero 8
+.align 8
+g2150:
+  .zero 8
+.align 2
+g2149:
+  .zero 2
+.align 2
+g2148:
+  .zero 2
+.align 4
+g2147:
+  .zero 4
+.align 8
+g2146:
+  .zero 8
+.align 2
+g2145:
+  .zero 2
+.align 8
+g2144:
+  .zero 8
+.align 4
+g2143:
+  .zero 4
+.align 8
+g2142:
+  .zero 8
+.align 2
+g2141:
+  .zero 2
+.align 2
+g2140:
+  .zero 2
+.align 4
+g2139:
+  .zero 4
+.align 1
+g2138:
+  .zero 1
+.align 8
+g2137:
+  .zero 8
+.align 2
+g2136:
+  .zero 2
+.align 2
+g2135:
+  .zero 2
+.align 4
+g2134:
+  .zero 4
+.align 1
+g2133:
+  .zero 1
+.align 1
+g2132:
+  .zero 1
+.align 2
+g2131:
+  .zero 2
+.align 4
+g2130:
+  .zero 4
+.align 4
+g2129:
+  .zero 4
+.align 1
+g2128:
+  .zero 1
+.align 2
+g2127:
+  .zero 2
+.align 2
+g2126:
+  .zero 2
+.align 8
+g2125:
+  .zero 8
+.align 8
+g2124:
+  .zero 8
+.align 8
+g2123:
+  .zero 8
+.align 4
+g2122:
+  .zero 4
+.align 2
+g2121:
+  .zero 2
+.align 8
+g2120:
+  .zero 8
+.align 1
+g2119:
+  .zero 1
+.align 1
+g2118:
+  .zero 1
+.align 2
+g2117:
+  .zero 2
+.align 2
+g2116:
+  .zero 2
+.align 4
+g2115:
+  .zero 4
+.align 1
+g2114:
+  .zero 1
+.align 2
+g2113:
+  .zero 2
+.align 4
+g2112:
+  .zero 4
+.align 4
+g2111:
+  .zero 4
+.align 1
+g2110:
+  .zero 1
+.align 4
+g2109:
+  .zero 4
+.align 2
+g2108:
+  .zero 2
+.align 4
+g2107:
+  .zero 4
+.align 1
+g2106:
+  .zero 1
+.align 8
+g2105:
+  .zero 8
+.align 4
+g2104:
+  .zero 4
+.align 4
+g2103:
+  .zero 4
+.align 4
+g2102:
+  .zero 4
+.align 1
+g2101:
+  .zero 1
+.align 2
+g2100:
+  .zero 2
+.align 2
+g2099:
+  .zero 2
+.align 1
+g2098:
+  .zero 1
+.align 4
+g2097:
+  .zero 4
+.align 1
+g2096:
+  .zero 1
+.align 2
+g2095:
+  .zero 2
+.align 8
+g2094:
+  .zero 8
+.align 1
+g2093:
+  .zero 1
+.align 4
+g2092:
+  .zero 4
+.align 4
+g2091:
+  .zero 4
+.align 8
+g2090:
+  .zero 8
+.align 8
+g2089:
+  .zero 8
+.align 1
+g2088:
+  .zero 1
+.align 8
+g2087:
+  .zero 8
+.align 4
+g2086:
+  .zero 4
+.align 1
+g2085:
+  .zero 1
+.align 8
+g2084:
+  .zero 8
+.align 1
+g2083:
+  .zero 1
+.align 2
+g2082:
+  .zero 2
+.align 4
+g2081:
+  .zero 4
+.align 4
+g2080:
+  .zero 4
+.align 2
+g2079:
+  .zero 2
+.align 2
+g2078:
+  .zero 2
+.align 8
+g2077:
+  .zero 8
+.align 2
+g2076:
+  .zero 2
+.align 1
+g2075:
+  .zero 1
+.align 8
+g2074:
+  .zero 8
+.align 8
+g2073:
+  .zero 8
+.align 2
+g2072:
+  .zero 2
+.align 1
+g2071:
+  .zero 1
+.align 2
+g2070:
+  .zero 2
+.align 1
+g2069:
+  .zero 1
+.align 4
+g2068:
+  .zero 4
+.align 1
+g2067:
+  .zero 1
+.align 2
+g2066:
+  .zero 2
+.align 8
+g2065:
+  .zero 8
+.align 4
+g2064:
+  .zero 4
+.align 4
+g2063:
+  .zero 4
+.align 2
+g2062:
+  .zero 2
+.align 2
+g2061:
+  .zero 2
+.align 1
+g2060:
+  .zero 1
+.align 1
+g2059:
+  .zero 1
+.align 4
+g2058:
+  .zero 4
+.align 1
+g2057:
+  .zero 1
+.align 2
+g2056:
+  .zero 2
+.align 1
+g2055:
+  .zero 1
+.align 4
+g2054:
+  .zero 4
+.align 2
+g2053:
+  .zero 2
+.align 4
+g2052:
+  .zero 4
+.align 1
+g2051:
+  .zero 1
+.align 2
+g2050:
+  .zero 2
+.align 1
+g2049:
+  .zero 1
+.align 2
+g2048:
+  .zero 2
+.align 2
+g2047:
+  .zero 2
+.align 8
+g2046:
+  .zero 8
+.align 2
+g2045:
+  .zero 2
+.align 1
+g2044:
+  .zero 1
+.align 2
+g2043:
+  .zero 2
+.align 1
+g2042:
+  .zero 1
+.align 4
+g2041:
+  .zero 4
+.align 1
+g2040:
+  .zero 1
+.align 1
+g2039:
+  .zero 1
+.align 8
+g2038:
+  .zero 8
+.align 1
+g2037:
+  .zero 1
+.align 4
+g2036:
+  .zero 4
+.align 8
+g2035:
+  .zero 8
+.align 1
+g2034:
+  .zero 1
+.align 1
+g2033:
+  .zero 1
+.align 8
+g2032:
+  .zero 8
+.align 1
+g2031:
+  .zero 1
+.align 1
+g2030:
+  .zero 1
+.align 2
+g2029:
+  .zero 2
+.align 4
+g2028:
+  .zero 4
+.align 4
+g2027:
+  .zero 4
+.align 8
+g2026:
+  .zero 8
+.align 1
+g2025:
+  .zero 1
+.align 2
+g2024:
+  .zero 2
+.align 8
+g2023:
+  .zero 8
+.align 4
+g2022:
+  .zero 4
+.align 1
+g2021:
+  .zero 1
+.align 2
+g2020:
+  .zero 2
+.align 2
+g2019:
+  .zero 2
+.align 8
+g2018:
+  .zero 8
+.align 2
+g2017:
+  .zero 2
+.align 1
+g2016:
+  .zero 1
+.align 4
+g2015:
+  .zero 4
+.align 4
+g2014:
+  .zero 4
+.align 2
+g2013:
+  .zero 2
+.align 2
+g2012:
+  .zero 2
+.align 4
+g2011:
+  .zero 4
+.align 4
+g2010:
+  .zero 4
+.align 4
+g2009:
+  .zero 4
+.align 8
+g2008:
+  .zero 8
+.align 2
+g2007:
+  .zero 2
+.align 8
+g2006:
+  .zero 8
+.align 4
+g2005:
+  .zero 4
+.align 1
+g2004:
+  .zero 1
+.align 2
+g2003:
+  .zero 2
+.align 8
+g2002:
+  .zero 8
+.align 8
+g2001:
+  .zero 8
+.align 8
+g2000:
+  .zero 8
+.align 2
+g1999:
+  .zero 2
+.align 1
+g1998:
+  .zero 1
+.align 2
+g1997:
+  .zero 2
+.align 2
+g1996:
+  .zero 2
+.align 4
+g1995:
+  .zero 4
+.align 1
+g1994:
+  .zero 1
+.align 1
+g1993:
+  .zero 1
+.align 4
+g1992:
+  .zero 4
+.align 4
+g1991:
+  .zero 4
+.align 1
+g1990:
+  .zero 1
+.align 1
+g1989:
+  .zero 1
+.align 1
+g1988:
+  .zero 1
+.align 2
+g1987:
+  .zero 2
+.align 8
+g1986:
+  .zero 8
+.align 2
+g1985:
+  .zero 2
+.align 8
+g1984:
+  .zero 8
+.align 1
+g1983:
+  .zero 1
+.align 4
+g1982:
+  .zero 4
+.align 1
+g1981:
+  .zero 1
+.align 2
+g1980:
+  .zero 2
+.align 4
+g1979:
+  .zero 4
+.align 4
+g1978:
+  .zero 4
+.align 8
+g1977:
+  .zero 8
+.align 8
+g1976:
+  .zero 8
+.align 4
+g1975:
+  .zero 4
+.align 4
+g1974:
+  .zero 4
+.align 8
+g1973:
+  .zero 8
+.align 8
+g1972:
+  .zero 8
+.align 2
+g1971:
+  .zero 2
+.align 2
+g1970:
+  .zero 2
+.align 1
+g1969:
+  .zero 1
+.align 1
+g1968:
+  .zero 1
+.align 4
+g1967:
+  .zero 4
+.align 2
+g1966:
+  .zero 2
+.align 2
+g1965:
+  .zero 2
+.align 8
+g1964:
+  .zero 8
+.align 1
+g1963:
+  .zero 1
+.align 1
+g1962:
+  .zero 1
+.align 8
+g1961:
+  .zero 8
+.align 2
+g1960:
+  .zero 2
+.align 2
+g1959:
+  .zero 2
+.align 8
+g1958:
+  .zero 8
+.align 8
+g1957:
+  .zero 8
+.align 2
+g1956:
+  .zero 2
+.align 2
+g1955:
+  .zero 2
+.align 2
+g1954:
+  .zero 2
+.align 4
+g1953:
+  .zero 4
+.align 1
+g1952:
+  .zero 1
+.align 2
+g1951:
+  .zero 2
+.align 4
+g1950:
+  .zero 4
+.align 4
+g1949:
+  .zero 4
+.align 2
+g1948:
+  .zero 2
+.align 1
+g1947:
+  .zero 1
+.align 1
+g1946:
+  .zero 1
+.align 1
+g1945:
+  .zero 1
+.align 4
+g1944:
+  .zero 4
+.align 8
+g1943:
+  .zero 8
+.align 4
+g1942:
+  .zero 4
+.align 2
+g1941:
+  .zero 2
+.align 4
+g1940:
+  .zero 4
+.align 4
+g1939:
+  .zero 4
+.align 8
+g1938:
+  .zero 8
+.align 1
+g1937:
+  .zero 1
+.align 8
+g1936:
+  .zero 8
+.align 1
+g1935:
+  .zero 1
+.align 1
+g1934:
+  .zero 1
+.align 8
+g1933:
+  .zero 8
+.align 8
+g1932:
+  .zero 8
+.align 4
+g1931:
+  .zero 4
+.align 1
+g1930:
+  .zero 1
+.align 4
+g1929:
+  .zero 4
+.align 8
+g1928:
+  .zero 8
+.align 2
+g1927:
+  .zero 2
+.align 4
+g1926:
+  .zero 4
+.align 2
+g1925:
+  .zero 2
+.align 4
+g1924:
+  .zero 4
+.align 8
+g1923:
+  .zero 8
+.align 1
+g1922:
+  .zero 1
+.align 2
+g1921:
+  .zero 2
+.align 2
+g1920:
+  .zero 2
+.align 2
+g1919:
+  .zero 2
+.align 1
+g1918:
+  .zero 1
+.align 1
+g1917:
+  .zero 1
+.align 1
+g1916:
+  .zero 1
+.align 8
+g1915:
+  .zero 8
+.align 8
+g1914:
+  .zero 8
+.align 2
+g1913:
+  .zero 2
+.align 2
+g1912:
+  .zero 2
+.align 8
+g1911:
+  .zero 8
+.align 4
+g1910:
+  .zero 4
+.align 2
+g1909:
+  .zero 2
+.align 8
+g1908:
+  .zero 8
+.align 4
+g1907:
+  .zero 4
+.align 1
+g1906:
+  .zero 1
+.align 8
+g1905:
+  .zero 8
+.align 8
+g1904:
+  .zero 8
+.align 2
+g1903:
+  .zero 2
+.align 4
+g1902:
+  .zero 4
+.align 1
+g1901:
+  .zero 1
+.align 2
+g1900:
+  .zero 2
+.align 2
+g1899:
+  .zero 2
+.align 8
+g1898:
+  .zero 8
+.align 1
+g1897:
+  .zero 1
+.align 1
+g1896:
+  .zero 1
+.align 8
+g1895:
+  .zero 8
+.align 1
+g1894:
+  .zero 1
+.align 2
+g1893:
+  .zero 2
+.align 4
+g1892:
+  .zero 4
+.align 4
+g1891:
+  .zero 4
+.align 4
+g1890:
+  .zero 4
+.align 2
+g1889:
+  .zero 2
+.align 2
+g1888:
+  .zero 2
+.align 4
+g1887:
+  .zero 4
+.align 4
+g1886:
+  .zero 4
+.align 4
+g1885:
+  .zero 4
+.align 1
+g1884:
+  .zero 1
+.align 2
+g1883:
+  .zero 2
+.align 8
+g1882:
+  .zero 8
+.align 4
+g1881:
+  .zero 4
+.align 4
+g1880:
+  .zero 4
+.align 4
+g1879:
+  .zero 4
+.align 8
+g1878:
+  .zero 8
+.align 2
+g1877:
+  .zero 2
+.align 2
+g1876:
+  .zero 2
+.align 2
+g1875:
+  .zero 2
+.align 2
+g1874:
+  .zero 2
+.align 1
+g1873:
+  .zero 1
+.align 1
+g1872:
+  .zero 1
+.align 2
+g1871:
+  .zero 2
+.align 8
+g1870:
+  .zero 8
+.align 4
+g1869:
+  .zero 4
+.align 8
+g1868:
+  .zero 8
+.align 2
+g1867:
+  .zero 2
+.align 1
+g1866:
+  .zero 1
+.align 8
+g1865:
+  .zero 8
+.align 8
+g1864:
+  .zero 8
+.align 2
+g1863:
+  .zero 2
+.align 2
+g1862:
+  .zero 2
+.align 4
+g1861:
+  .zero 4
+.align 8
+g1860:
+  .zero 8
+.align 8
+g1859:
+  .zero 8
+.align 2
+g1858:
+  .zero 2
+.align 8
+g1857:
+  .zero 8
+.align 1
+g1856:
+  .zero 1
+.align 2
+g1855:
+  .zero 2
+.align 2
+g1854:
+  .zero 2
+.align 1
+g1853:
+  .zero 1
+.align 2
+g1852:
+  .zero 2
+.align 4
+g1851:
+  .zero 4
+.align 1
+g1850:
+  .zero 1
+.align 8
+g1849:
+  .zero 8
+.align 4
+g1848:
+  .zero 4
+.align 2
+g1847:
+  .zero 2
+.align 2
+g1846:
+  .zero 2
+.align 4
+g1845:
+  .zero 4
+.align 8
+g1844:
+  .zero 8
+.align 2
+g1843:
+  .zero 2
+.align 4
+g1842:
+  .zero 4
+.align 1
+g1841:
+  .zero 1
+.align 4
+g1840:
+  .zero 4
+.align 1
+g1839:
+  .zero 1
+.align 4
+g1838:
+  .zero 4
+.align 1
+g1837:
+  .zero 1
+.align 1
+g1836:
+  .zero 1
+.align 8
+g1835:
+  .zero 8
+.align 4
+g1834:
+  .zero 4
+.align 4
+g1833:
+  .zero 4
+.align 4
+g1832:
+  .zero 4
+.align 4
+g1831:
+  .zero 4
+.align 2
+g1830:
+  .zero 2
+.align 2
+g1829:
+  .zero 2
+.align 8
+g1828:
+  .zero 8
+.align 8
+g1827:
+  .zero 8
+.align 2
+g1826:
+  .zero 2
+.align 2
+g1825:
+  .zero 2
+.align 2
+g1824:
+  .zero 2
+.align 2
+g1823:
+  .zero 2
+.align 1
+g1822:
+  .zero 1
+.align 1
+g1821:
+  .zero 1
+.align 4
+g1820:
+  .zero 4
+.align 2
+g1819:
+  .zero 2
+.align 8
+g1818:
+  .zero 8
+.align 2
+g1817:
+  .zero 2
+.align 8
+g1816:
+  .zero 8
+.align 4
+g1815:
+  .zero 4
+.align 2
+g1814:
+  .zero 2
+.align 2
+g1813:
+  .zero 2
+.align 2
+g1812:
+  .zero 2
+.align 2
+g1811:
+  .zero 2
+.align 1
+g1810:
+  .zero 1
+.align 8
+g1809:
+  .zero 8
+.align 2
+g1808:
+  .zero 2
+.align 1
+g1807:
+  .zero 1
+.align 2
+g1806:
+  .zero 2
+.align 1
+g1805:
+  .zero 1
+.align 4
+g1804:
+  .zero 4
+.align 2
+g1803:
+  .zero 2
+.align 4
+g1802:
+  .zero 4
+.align 2
+g1801:
+  .zero 2
+.align 4
+g1800:
+  .zero 4
+.align 1
+g1799:
+  .zero 1
+.align 8
+g1798:
+  .zero 8
+.align 2
+g1797:
+  .zero 2
+.align 2
+g1796:
+  .zero 2
+.align 8
+g1795:
+  .zero 8
+.align 2
+g1794:
+  .zero 2
+.align 2
+g1793:
+  .zero 2
+.align 1
+g1792:
+  .zero 1
+.align 2
+g1791:
+  .zero 2
+.align 4
+g1790:
+  .zero 4
+.align 1
+g1789:
+  .zero 1
+.align 4
+g1788:
+  .zero 4
+.align 1
+g1787:
+  .zero 1
+.align 8
+g1786:
+  .zero 8
+.align 4
+g1785:
+  .zero 4
+.align 1
+g1784:
+  .zero 1
+.align 4
+g1783:
+  .zero 4
+.align 4
+g1782:
+  .zero 4
+.align 8
+g1781:
+  .zero 8
+.align 2
+g1780:
+  .zero 2
+.align 2
+g1779:
+  .zero 2
+.align 1
+g1778:
+  .zero 1
+.align 4
+g1777:
+  .zero 4
+.align 8
+g1776:
+  .zero 8
+.align 4
+g1775:
+  .zero 4
+.align 4
+g1774:
+  .zero 4
+.align 4
+g1773:
+  .zero 4
+.align 1
+g1772:
+  .zero 1
+.align 8
+g1771:
+  .zero 8
+.align 8
+g1770:
+  .zero 8
+.align 2
+g1769:
+  .zero 2
+.align 4
+g1768:
+  .zero 4
+.align 8
+g1767:
+  .zero 8
+.align 1
+g1766:
+  .zero 1
+.align 4
+g1765:
+  .zero 4
+.align 2
+g1764:
+  .zero 2
+.align 1
+g1763:
+  .zero 1
+.align 1
+g1762:
+  .zero 1
+.align 1
+g1761:
+  .zero 1
+.align 8
+g1760:
+  .zero 8
+.align 4
+g1759:
+  .zero 4
+.align 1
+g1758:
+  .zero 1
+.align 2
+g1757:
+  .zero 2
+.align 1
+g1756:
+  .zero 1
+.align 1
+g1755:
+  .zero 1
+.align 1
+g1754:
+  .zero 1
+.align 1
+g1753:
+  .zero 1
+.align 4
+g1752:
+  .zero 4
+.align 4
+g1751:
+  .zero 4
+.align 1
+g1750:
+  .zero 1
+.align 8
+g1749:
+  .zero 8
+.align 2
+g1748:
+  .zero 2
+.align 8
+g1747:
+  .zero 8
+.align 4
+g1746:
+  .zero 4
+.align 8
+g1745:
+  .zero 8
+.align 4
+g1744:
+  .zero 4
+.align 8
+g1743:
+  .zero 8
+.align 1
+g1742:
+  .zero 1
+.align 2
+g1741:
+  .zero 2
+.align 4
+g1740:
+  .zero 4
+.align 1
+g1739:
+  .zero 1
+.align 2
+g1738:
+  .zero 2
+.align 4
+g1737:
+  .zero 4
+.align 4
+g1736:
+  .zero 4
+.align 8
+g1735:
+  .zero 8
+.align 8
+g1734:
+  .zero 8
+.align 1
+g1733:
+  .zero 1
+.align 2
+g1732:
+  .zero 2
+.align 4
+g1731:
+  .zero 4
+.align 2
+g1730:
+  .zero 2
+.align 4
+g1729:
+  .zero 4
+.align 1
+g1728:
+  .zero 1
+.align 2
+g1727:
+  .zero 2
+.align 8
+g1726:
+  .zero 8
+.align 4
+g1725:
+  .zero 4
+.align 4
+g1724:
+  .zero 4
+.align 8
+g1723:
+  .zero 8
+.align 2
+g1722:
+  .zero 2
+.align 8
+g1721:
+  .zero 8
+.align 1
+g1720:
+  .zero 1
+.align 4
+g1719:
+  .zero 4
+.align 8
+g1718:
+  .zero 8
+.align 2
+g1717:
+  .zero 2
+.align 4
+g1716:
+  .zero 4
+.align 2
+g1715:
+  .zero 2
+.align 4
+g1714:
+  .zero 4
+.align 1
+g1713:
+  .zero 1
+.align 8
+g1712:
+  .zero 8
+.align 1
+g1711:
+  .zero 1
+.align 2
+g1710:
+  .zero 2
+.align 2
+g1709:
+  .zero 2
+.align 2
+g1708:
+  .zero 2
+.align 1
+g1707:
+  .zero 1
+.align 8
+g1706:
+  .zero 8
+.align 4
+g1705:
+  .zero 4
+.align 8
+g1704:
+  .zero 8
+.align 8
+g1703:
+  .zero 8
+.align 2
+g1702:
+  .zero 2
+.align 4
+g1701:
+  .zero 4
+.align 4
+g1700:
+  .zero 4
+.align 2
+g1699:
+  .zero 2
+.align 8
+g1698:
+  .zero 8
+.align 8
+g1697:
+  .zero 8
+.align 8
+g1696:
+  .zero 8
+.align 4
+g1695:
+  .zero 4
+.align 1
+g1694:
+  .zero 1
+.align 8
+g1693:
+  .zero 8
+.align 4
+g1692:
+  .zero 4
+.align 4
+g1691:
+  .zero 4
+.align 2
+g1690:
+  .zero 2
+.align 2
+g1689:
+  .zero 2
+.align 4
+g1688:
+  .zero 4
+.align 8
+g1687:
+  .zero 8
+.align 1
+g1686:
+  .zero 1
+.align 4
+g1685:
+  .zero 4
+.align 2
+g1684:
+  .zero 2
+.align 8
+g1683:
+  .zero 8
+.align 4
+g1682:
+  .zero 4
+.align 2
+g1681:
+  .zero 2
+.align 8
+g1680:
+  .zero 8
+.align 4
+g1679:
+  .zero 4
+.align 8
+g1678:
+  .zero 8
+.align 8
+g1677:
+  .zero 8
+.align 8
+g1676:
+  .zero 8
+.align 8
+g1675:
+  .zero 8
+.align 4
+g1674:
+  .zero 4
+.align 8
+g1673:
+  .zero 8
+.align 4
+g1672:
+  .zero 4
+.align 1
+g1671:
+  .zero 1
+.align 1
+g1670:
+  .zero 1
+.align 4
+g1669:
+  .zero 4
+.align 1
+g1668:
+  .zero 1
+.align 1
+g1667:
+  .zero 1
+.align 4
+g1666:
+  .zero 4
+.align 4
+g1665:
+  .zero 4
+.align 1
+g1664:
+  .zero 1
+.align 4
+g1663:
+  .zero 4
+.align 1
+g1662:
+  .zero 1
+.align 1
+g1661:
+  .zero 1
+.align 2
+g1660:
+  .zero 2
+.align 2
+g1659:
+  .zero 2
+.align 4
+g1658:
+  .zero 4
+.align 8
+g1657:
+  .zero 8
+.align 1
+g1656:
+  .zero 1
+.align 2
+g1655:
+  .zero 2
+.align 4
+g1654:
+  .zero 4
+.align 8
+g1653:
+  .zero 8
+.align 4
+g1652:
+  .zero 4
+.align 1
+g1651:
+  .zero 1
+.align 2
+g1650:
+  .zero 2
+.align 4
+g1649:
+  .zero 4
+.align 8
+g1648:
+  .zero 8
+.align 2
+g1647:
+  .zero 2
+.align 8
+g1646:
+  .zero 8
+.align 2
+g1645:
+  .zero 2
+.align 4
+g1644:
+  .zero 4
+.align 4
+g1643:
+  .zero 4
+.align 2
+g1642:
+  .zero 2
+.align 2
+g1641:
+  .zero 2
+.align 1
+g1640:
+  .zero 1
+.align 2
+g1639:
+  .zero 2
+.align 2
+g1638:
+  .zero 2
+.align 1
+g1637:
+  .zero 1
+.align 4
+g1636:
+  .zero 4
+.align 1
+g1635:
+  .zero 1
+.align 8
+g1634:
+  .zero 8
+.align 1
+g1633:
+  .zero 1
+.align 4
+g1632:
+  .zero 4
+.align 8
+g1631:
+  .zero 8
+.align 1
+g1630:
+  .zero 1
+.align 2
+g1629:
+  .zero 2
+.align 4
+g1628:
+  .zero 4
+.align 4
+g1627:
+  .zero 4
+.align 2
+g1626:
+  .zero 2
+.align 8
+g1625:
+  .zero 8
+.align 4
+g1624:
+  .zero 4
+.align 2
+g1623:
+  .zero 2
+.align 2
+g1622:
+  .zero 2
+.align 8
+g1621:
+  .zero 8
+.align 1
+g1620:
+  .zero 1
+.align 8
+g1619:
+  .zero 8
+.align 2
+g1618:
+  .zero 2
+.align 1
+g1617:
+  .zero 1
+.align 4
+g1616:
+  .zero 4
+.align 8
+g1615:
+  .zero 8
+.align 1
+g1614:
+  .zero 1
+.align 8
+g1613:
+  .zero 8
+.align 8
+g1612:
+  .zero 8
+.align 2
+g1611:
+  .zero 2
+.align 8
+g1610:
+  .zero 8
+.align 2
+g1609:
+  .zero 2
+.align 2
+g1608:
+  .zero 2
+.align 1
+g1607:
+  .zero 1
+.align 1
+g1606:
+  .zero 1
+.align 1
+g1605:
+  .zero 1
+.align 8
+g1604:
+  .zero 8
+.align 4
+g1603:
+  .zero 4
+.align 1
+g1602:
+  .zero 1
+.align 2
+g1601:
+  .zero 2
+.align 4
+g1600:
+  .zero 4
+.align 8
+g1599:
+  .zero 8
+.align 4
+g1598:
+  .zero 4
+.align 8
+g1597:
+  .zero 8
+.align 8
+g1596:
+  .zero 8
+.align 1
+g1595:
+  .zero 1
+.align 1
+g1594:
+  .zero 1
+.align 1
+g1593:
+  .zero 1
+.align 1
+g1592:
+  .zero 1
+.align 1
+g1591:
+  .zero 1
+.align 4
+g1590:
+  .zero 4
+.align 2
+g1589:
+  .zero 2
+.align 4
+g1588:
+  .zero 4
+.align 2
+g1587:
+  .zero 2
+.align 4
+g1586:
+  .zero 4
+.align 4
+g1585:
+  .zero 4
+.align 2
+g1584:
+  .zero 2
+.align 8
+g1583:
+  .zero 8
+.align 2
+g1582:
+  .zero 2
+.align 4
+g1581:
+  .zero 4
+.align 2
+g1580:
+  .zero 2
+.align 2
+g1579:
+  .zero 2
+.align 2
+g1578:
+  .zero 2
+.align 8
+g1577:
+  .zero 8
+.align 2
+g1576:
+  .zero 2
+.align 8
+g1575:
+  .zero 8
+.align 4
+g1574:
+  .zero 4
+.align 2
+g1573:
+  .zero 2
+.align 8
+g1572:
+  .zero 8
+.align 4
+g1571:
+  .zero 4
+.align 2
+g1570:
+  .zero 2
+.align 1
+g1569:
+  .zero 1
+.align 4
+g1568:
+  .zero 4
+.align 8
+g1567:
+  .zero 8
+.align 8
+g1566:
+  .zero 8
+.align 8
+g1565:
+  .zero 8
+.align 4
+g1564:
+  .zero 4
+.align 1
+g1563:
+  .zero 1
+.align 2
+g1562:
+  .zero 2
+.align 1
+g1561:
+  .zero 1
+.align 4
+g1560:
+  .zero 4
+.align 1
+g1559:
+  .zero 1
+.align 2
+g1558:
+  .zero 2
+.align 4
+g1557:
+  .zero 4
+.align 4
+g1556:
+  .zero 4
+.align 1
+g1555:
+  .zero 1
+.align 8
+g1554:
+  .zero 8
+.align 2
+g1553:
+  .zero 2
+.align 4
+g1552:
+  .zero 4
+.align 4
+g1551:
+  .zero 4
+.align 8
+g1550:
+  .zero 8
+.align 8
+g1549:
+  .zero 8
+.align 1
+g1548:
+  .zero 1
+.align 1
+g1547:
+  .zero 1
+.align 8
+g1546:
+  .zero 8
+.align 1
+g1545:
+  .zero 1
+.align 8
+g1544:
+  .zero 8
+.align 4
+g1543:
+  .zero 4
+.align 2
+g1542:
+  .zero 2
+.align 4
+g1541:
+  .zero 4
+.align 2
+g1540:
+  .zero 2
+.align 1
+g1539:
+  .zero 1
+.align 8
+g1538:
+  .zero 8
+.align 8
+g1537:
+  .zero 8
+.align 4
+g1536:
+  .zero 4
+.align 8
+g1535:
+  .zero 8
+.align 2
+g1534:
+  .zero 2
+.align 4
+g1533:
+  .zero 4
+.align 4
+g1532:
+  .zero 4
+.align 8
+g1531:
+  .zero 8
+.align 4
+g1530:
+  .zero 4
+.align 2
+g1529:
+  .zero 2
+.align 8
+g1528:
+  .zero 8
+.align 1
+g1527:
+  .zero 1
+.align 4
+g1526:
+  .zero 4
+.align 1
+g1525:
+  .zero 1
+.align 2
+g1524:
+  .zero 2
+.align 2
+g1523:
+  .zero 2
+.align 2
+g1522:
+  .zero 2
+.align 8
+g1521:
+  .zero 8
+.align 2
+g1520:
+  .zero 2
+.align 2
+g1519:
+  .zero 2
+.align 8
+g1518:
+  .zero 8
+.align 8
+g1517:
+  .zero 8
+.align 2
+g1516:
+  .zero 2
+.align 4
+g1515:
+  .zero 4
+.align 4
+g1514:
+  .zero 4
+.align 8
+g1513:
+  .zero 8
+.align 4
+g1512:
+  .zero 4
+.align 2
+g1511:
+  .zero 2
+.align 2
+g1510:
+  .zero 2
+.align 1
+g1509:
+  .zero 1
+.align 1
+g1508:
+  .zero 1
+.align 8
+g1507:
+  .zero 8
+.align 4
+g1506:
+  .zero 4
+.align 1
+g1505:
+  .zero 1
+.align 8
+g1504:
+  .zero 8
+.align 4
+g1503:
+  .zero 4
+.align 4
+g1502:
+  .zero 4
+.align 8
+g1501:
+  .zero 8
+.align 1
+g1500:
+  .zero 1
+.align 2
+g1499:
+  .zero 2
+.align 8
+g1498:
+  .zero 8
+.align 1
+g1497:
+  .zero 1
+.align 1
+g1496:
+  .zero 1
+.align 1
+g1495:
+  .zero 1
+.align 4
+g1494:
+  .zero 4
+.align 4
+g1493:
+  .zero 4
+.align 1
+g1492:
+  .zero 1
+.align 1
+g1491:
+  .zero 1
+.align 2
+g1490:
+  .zero 2
+.align 4
+g1489:
+  .zero 4
+.align 4
+g1488:
+  .zero 4
+.align 8
+g1487:
+  .zero 8
+.align 2
+g1486:
+  .zero 2
+.align 2
+g1485:
+  .zero 2
+.align 1
+g1484:
+  .zero 1
+.align 4
+g1483:
+  .zero 4
+.align 8
+g1482:
+  .zero 8
+.align 2
+g1481:
+  .zero 2
+.align 1
+g1480:
+  .zero 1
+.align 4
+g1479:
+  .zero 4
+.align 2
+g1478:
+  .zero 2
+.align 8
+g1477:
+  .zero 8
+.align 8
+g1476:
+  .zero 8
+.align 4
+g1475:
+  .zero 4
+.align 2
+g1474:
+  .zero 2
+.align 4
+g1473:
+  .zero 4
+.align 1
+g1472:
+  .zero 1
+.align 8
+g1471:
+  .zero 8
+.align 1
+g1470:
+  .zero 1
+.align 1
+g1469:
+  .zero 1
+.align 2
+g1468:
+  .zero 2
+.align 8
+g1467:
+  .zero 8
+.align 2
+g1466:
+  .zero 2
+.align 8
+g1465:
+  .zero 8
+.align 1
+g1464:
+  .zero 1
+.align 1
+g1463:
+  .zero 1
+.align 4
+g1462:
+  .zero 4
+.align 1
+g1461:
+  .zero 1
+.align 1
+g1460:
+  .zero 1
+.align 4
+g1459:
+  .zero 4
+.align 8
+g1458:
+  .zero 8
+.align 8
+g1457:
+  .zero 8
+.align 4
+g1456:
+  .zero 4
+.align 8
+g1455:
+  .zero 8
+.align 8
+g1454:
+  .zero 8
+.align 8
+g1453:
+  .zero 8
+.align 1
+g1452:
+  .zero 1
+.align 1
+g1451:
+  .zero 1
+.align 1
+g1450:
+  .zero 1
+.align 8
+g1449:
+  .zero 8
+.align 8
+g1448:
+  .zero 8
+.align 2
+g1447:
+  .zero 2
+.align 2
+g1446:
+  .zero 2
+.align 8
+g1445:
+  .zero 8
+.align 8
+g1444:
+  .zero 8
+.align 1
+g1443:
+  .zero 1
+.align 4
+g1442:
+  .zero 4
+.align 2
+g1441:
+  .zero 2
+.align 2
+g1440:
+  .zero 2
+.align 4
+g1439:
+  .zero 4
+.align 2
+g1438:
+  .zero 2
+.align 4
+g1437:
+  .zero 4
+.align 4
+g1436:
+  .zero 4
+.align 4
+g1435:
+  .zero 4
+.align 4
+g1434:
+  .zero 4
+.align 2
+g1433:
+  .zero 2
+.align 8
+g1432:
+  .zero 8
+.align 4
+g1431:
+  .zero 4
+.align 1
+g1430:
+  .zero 1
+.align 2
+g1429:
+  .zero 2
+.align 1
+g1428:
+  .zero 1
+.align 8
+g1427:
+  .zero 8
+.align 4
+g1426:
+  .zero 4
+.align 1
+g1425:
+  .zero 1
+.align 8
+g1424:
+  .zero 8
+.align 1
+g1423:
+  .zero 1
+.align 2
+g1422:
+  .zero 2
+.align 1
+g1421:
+  .zero 1
+.align 4
+g1420:
+  .zero 4
+.align 2
+g1419:
+  .zero 2
+.align 2
+g1418:
+  .zero 2
+.align 8
+g1417:
+  .zero 8
+.align 8
+g1416:
+  .zero 8
+.align 1
+g1415:
+  .zero 1
+.align 8
+g1414:
+  .zero 8
+.align 8
+g1413:
+  .zero 8
+.align 1
+g1412:
+  .zero 1
+.align 4
+g1411:
+  .zero 4
+.align 1
+g1410:
+  .zero 1
+.align 4
+g1409:
+  .zero 4
+.align 1
+g1408:
+  .zero 1
+.align 4
+g1407:
+  .zero 4
+.align 1
+g1406:
+  .zero 1
+.align 8
+g1405:
+  .zero 8
+.align 4
+g1404:
+  .zero 4
+.align 4
+g1403:
+  .zero 4
+.align 2
+g1402:
+  .zero 2
+.align 8
+g1401:
+  .zero 8
+.align 8
+g1400:
+  .zero 8
+.align 1
+g1399:
+  .zero 1
+.align 4
+g1398:
+  .zero 4
+.align 1
+g1397:
+  .zero 1
+.align 2
+g1396:
+  .zero 2
+.align 1
+g1395:
+  .zero 1
+.align 8
+g1394:
+  .zero 8
+.align 1
+g1393:
+  .zero 1
+.align 4
+g1392:
+  .zero 4
+.align 8
+g1391:
+  .zero 8
+.align 4
+g1390:
+  .zero 4
+.align 2
+g1389:
+  .zero 2
+.align 8
+g1388:
+  .zero 8
+.align 1
+g1387:
+  .zero 1
+.align 4
+g1386:
+  .zero 4
+.align 8
+g1385:
+  .zero 8
+.align 2
+g1384:
+  .zero 2
+.align 1
+g1383:
+  .zero 1
+.align 2
+g1382:
+  .zero 2
+.align 4
+g1381:
+  .zero 4
+.align 2
+g1380:
+  .zero 2
+.align 2
+g1379:
+  .zero 2
+.align 2
+g1378:
+  .zero 2
+.align 1
+g1377:
+  .zero 1
+.align 8
+g1376:
+  .zero 8
+.align 4
+g1375:
+  .zero 4
+.align 1
+g1374:
+  .zero 1
+.align 4
+g1373:
+  .zero 4
+.align 8
+g1372:
+  .zero 8
+.align 4
+g1371:
+  .zero 4
+.align 8
+g1370:
+  .zero 8
+.align 2
+g1369:
+  .zero 2
+.align 4
+g1368:
+  .zero 4
+.align 8
+g1367:
+  .zero 8
+.align 8
+g1366:
+  .zero 8
+.align 2
+g1365:
+  .zero 2
+.align 8
+g1364:
+  .zero 8
+.align 2
+g1363:
+  .zero 2
+.align 8
+g1362:
+  .zero 8
+.align 1
+g1361:
+  .zero 1
+.align 8
+g1360:
+  .zero 8
+.align 4
+g1359:
+  .zero 4
+.align 4
+g1358:
+  .zero 4
+.align 8
+g1357:
+  .zero 8
+.align 2
+g1356:
+  .zero 2
+.align 1
+g1355:
+  .zero 1
+.align 8
+g1354:
+  .zero 8
+.align 4
+g1353:
+  .zero 4
+.align 2
+g1352:
+  .zero 2
+.align 2
+g1351:
+  .zero 2
+.align 2
+g1350:
+  .zero 2
+.align 4
+g1349:
+  .zero 4
+.align 8
+g1348:
+  .zero 8
+.align 4
+g1347:
+  .zero 4
+.align 4
+g1346:
+  .zero 4
+.align 2
+g1345:
+  .zero 2
+.align 8
+g1344:
+  .zero 8
+.align 4
+g1343:
+  .zero 4
+.align 8
+g1342:
+  .zero 8
+.align 2
+g1341:
+  .zero 2
+.align 1
+g1340:
+  .zero 1
+.align 2
+g1339:
+  .zero 2
+.align 4
+g1338:
+  .zero 4
+.align 1
+g1337:
+  .zero 1
+.align 1
+g1336:
+  .zero 1
+.align 8
+g1335:
+  .zero 8
+.align 2
+g1334:
+  .zero 2
+.align 4
+g1333:
+  .zero 4
+.align 8
+g1332:
+  .zero 8
+.align 4
+g1331:
+  .zero 4
+.align 1
+g1330:
+  .zero 1
+.align 2
+g1329:
+  .zero 2
+.align 4
+g1328:
+  .zero 4
+.align 2
+g1327:
+  .zero 2
+.align 1
+g1326:
+  .zero 1
+.align 2
+g1325:
+  .zero 2
+.align 1
+g1324:
+  .zero 1
+.align 8
+g1323:
+  .zero 8
+.align 8
+g1322:
+  .zero 8
+.align 4
+g1321:
+  .zero 4
+.align 1
+g1320:
+  .zero 1
+.align 4
+g1319:
+  .zero 4
+.align 2
+g1318:
+  .zero 2
+.align 8
+g1317:
+  .zero 8
+.align 8
+g1316:
+  .zero 8
+.align 1
+g1315:
+  .zero 1
+.align 4
+g1314:
+  .zero 4
+.align 1
+g1313:
+  .zero 1
+.align 1
+g1312:
+  .zero 1
+.align 4
+g1311:
+  .zero 4
+.align 8
+g1310:
+  .zero 8
+.align 2
+g1309:
+  .zero 2
+.align 4
+g1308:
+  .zero 4
+.align 4
+g1307:
+  .zero 4
+.align 1
+g1306:
+  .zero 1
+.align 8
+g1305:
+  .zero 8
+.align 8
+g1304:
+  .zero 8
+.align 1
+g1303:
+  .zero 1
+.align 1
+g1302:
+  .zero 1
+.align 4
+g1301:
+  .zero 4
+.align 8
+g1300:
+  .zero 8
+.align 8
+g1299:
+  .zero 8
+.align 1
+g1298:
+  .zero 1
+.align 4
+g1297:
+  .zero 4
+.align 8
+g1296:
+  .zero 8
+.align 1
+g1295:
+  .zero 1
+.align 1
+g1294:
+  .zero 1
+.align 2
+g1293:
+  .zero 2
+.align 4
+g1292:
+  .zero 4
+.align 4
+g1291:
+  .zero 4
+.align 2
+g1290:
+  .zero 2
+.align 8
+g1289:
+  .zero 8
+.align 8
+g1288:
+  .zero 8
+.align 2
+g1287:
+  .zero 2
+.align 2
+g1286:
+  .zero 2
+.align 4
+g1285:
+  .zero 4
+.align 4
+g1284:
+  .zero 4
+.align 8
+g1283:
+  .zero 8
+.align 8
+g1282:
+  .zero 8
+.align 4
+g1281:
+  .zero 4
+.align 1
+g1280:
+  .zero 1
+.align 2
+g1279:
+  .zero 2
+.align 2
+g1278:
+  .zero 2
+.align 2
+g1277:
+  .zero 2
+.align 4
+g1276:
+  .zero 4
+.align 1
+g1275:
+  .zero 1
+.align 1
+g1274:
+  .zero 1
+.align 2
+g1273:
+  .zero 2
+.align 4
+g1272:
+  .zero 4
+.align 2
+g1271:
+  .zero 2
+.align 4
+g1270:
+  .zero 4
+.align 8
+g1269:
+  .zero 8
+.align 2
+g1268:
+  .zero 2
+.align 4
+g1267:
+  .zero 4
+.align 1
+g1266:
+  .zero 1
+.align 8
+g1265:
+  .zero 8
+.align 4
+g1264:
+  .zero 4
+.align 8
+g1263:
+  .zero 8
+.align 1
+g1262:
+  .zero 1
+.align 4
+g1261:
+  .zero 4
+.align 1
+g1260:
+  .zero 1
+.align 4
+g1259:
+  .zero 4
+.align 1
+g1258:
+  .zero 1
+.align 2
+g1257:
+  .zero 2
+.align 2
+g1256:
+  .zero 2
+.align 2
+g1255:
+  .zero 2
+.align 4
+g1254:
+  .zero 4
+.align 2
+g1253:
+  .zero 2
+.align 8
+g1252:
+  .zero 8
+.align 1
+g1251:
+  .zero 1
+.align 1
+g1250:
+  .zero 1
+.align 8
+g1249:
+  .zero 8
+.align 1
+g1248:
+  .zero 1
+.align 2
+g1247:
+  .zero 2
+.align 1
+g1246:
+  .zero 1
+.align 8
+g1245:
+  .zero 8
+.align 4
+g1244:
+  .zero 4
+.align 1
+g1243:
+  .zero 1
+.align 8
+g1242:
+  .zero 8
+.align 2
+g1241:
+  .zero 2
+.align 4
+g1240:
+  .zero 4
+.align 2
+g1239:
+  .zero 2
+.align 4
+g1238:
+  .zero 4
+.align 1
+g1237:
+  .zero 1
+.align 4
+g1236:
+  .zero 4
+.align 4
+g1235:
+  .zero 4
+.align 8
+g1234:
+  .zero 8
+.align 2
+g1233:
+  .zero 2
+.align 8
+g1232:
+  .zero 8
+.align 4
+g1231:
+  .zero 4
+.align 1
+g1230:
+  .zero 1
+.align 1
+g1229:
+  .zero 1
+.align 4
+g1228:
+  .zero 4
+.align 1
+g1227:
+  .zero 1
+.align 1
+g1226:
+  .zero 1
+.align 1
+g1225:
+  .zero 1
+.align 2
+g1224:
+  .zero 2
+.align 1
+g1223:
+  .zero 1
+.align 1
+g1222:
+  .zero 1
+.align 8
+g1221:
+  .zero 8
+.align 2
+g1220:
+  .zero 2
+.align 4
+g1219:
+  .zero 4
+.align 4
+g1218:
+  .zero 4
+.align 1
+g1217:
+  .zero 1
+.align 8
+g1216:
+  .zero 8
+.align 4
+g1215:
+  .zero 4
+.align 2
+g1214:
+  .zero 2
+.align 8
+g1213:
+  .zero 8
+.align 1
+g1212:
+  .zero 1
+.align 8
+g1211:
+  .zero 8
+.align 2
+g1210:
+  .zero 2
+.align 1
+g1209:
+  .zero 1
+.align 8
+g1208:
+  .zero 8
+.align 8
+g1207:
+  .zero 8
+.align 2
+g1206:
+  .zero 2
+.align 1
+g1205:
+  .zero 1
+.align 1
+g1204:
+  .zero 1
+.align 2
+g1203:
+  .zero 2
+.align 2
+g1202:
+  .zero 2
+.align 4
+g1201:
+  .zero 4
+.align 2
+g1200:
+  .zero 2
+.align 1
+g1199:
+  .zero 1
+.align 4
+g1198:
+  .zero 4
+.align 8
+g1197:
+  .zero 8
+.align 8
+g1196:
+  .zero 8
+.align 1
+g1195:
+  .zero 1
+.align 1
+g1194:
+  .zero 1
+.align 1
+g1193:
+  .zero 1
+.align 1
+g1192:
+  .zero 1
+.align 1
+g1191:
+  .zero 1
+.align 1
+g1190:
+  .zero 1
+.align 2
+g1189:
+  .zero 2
+.align 1
+g1188:
+  .zero 1
+.align 1
+g1187:
+  .zero 1
+.align 4
+g1186:
+  .zero 4
+.align 8
+g1185:
+  .zero 8
+.align 2
+g1184:
+  .zero 2
+.align 1
+g1183:
+  .zero 1
+.align 4
+g1182:
+  .zero 4
+.align 2
+g1181:
+  .zero 2
+.align 1
+g1180:
+  .zero 1
+.align 8
+g1179:
+  .zero 8
+.align 4
+g1178:
+  .zero 4
+.align 2
+g1177:
+  .zero 2
+.align 1
+g1176:
+  .zero 1
+.align 1
+g1175:
+  .zero 1
+.align 2
+g1174:
+  .zero 2
+.align 8
+g1173:
+  .zero 8
+.align 8
+g1172:
+  .zero 8
+.align 2
+g1171:
+  .zero 2
+.align 8
+g1170:
+  .zero 8
+.align 8
+g1169:
+  .zero 8
+.align 2
+g1168:
+  .zero 2
+.align 2
+g1167:
+  .zero 2
+.align 2
+g1166:
+  .zero 2
+.align 2
+g1165:
+  .zero 2
+.align 2
+g1164:
+  .zero 2
+.align 8
+g1163:
+  .zero 8
+.align 8
+g1162:
+  .zero 8
+.align 1
+g1161:
+  .zero 1
+.align 4
+g1160:
+  .zero 4
+.align 4
+g1159:
+  .zero 4
+.align 2
+g1158:
+  .zero 2
+.align 1
+g1157:
+  .zero 1
+.align 1
+g1156:
+  .zero 1
+.align 8
+g1155:
+  .zero 8
+.align 1
+g1154:
+  .zero 1
+.align 2
+g1153:
+  .zero 2
+.align 2
+g1152:
+  .zero 2
+.align 8
+g1151:
+  .zero 8
+.align 8
+g1150:
+  .zero 8
+.align 2
+g1149:
+  .zero 2
+.align 1
+g1148:
+  .zero 1
+.align 1
+g1147:
+  .zero 1
+.align 8
+g1146:
+  .zero 8
+.align 4
+g1145:
+  .zero 4
+.align 1
+g1144:
+  .zero 1
+.align 8
+g1143:
+  .zero 8
+.align 2
+g1142:
+  .zero 2
+.align 8
+g1141:
+  .zero 8
+.align 8
+g1140:
+  .zero 8
+.align 8
+g1139:
+  .zero 8
+.align 4
+g1138:
+  .zero 4
+.align 8
+g1137:
+  .zero 8
+.align 1
+g1136:
+  .zero 1
+.align 4
+g1135:
+  .zero 4
+.align 2
+g1134:
+  .zero 2
+.align 8
+g1133:
+  .zero 8
+.align 2
+g1132:
+  .zero 2
+.align 1
+g1131:
+  .zero 1
+.align 1
+g1130:
+  .zero 1
+.align 2
+g1129:
+  .zero 2
+.align 1
+g1128:
+  .zero 1
+.align 4
+g1127:
+  .zero 4
+.align 4
+g1126:
+  .zero 4
+.align 8
+g1125:
+  .zero 8
+.align 1
+g1124:
+  .zero 1
+.align 1
+g1123:
+  .zero 1
+.align 8
+g1122:
+  .zero 8
+.align 4
+g1121:
+  .zero 4
+.align 2
+g1120:
+  .zero 2
+.align 1
+g1119:
+  .zero 1
+.align 8
+g1118:
+  .zero 8
+.align 2
+g1117:
+  .zero 2
+.align 2
+g1116:
+  .zero 2
+.align 1
+g1115:
+  .zero 1
+.align 8
+g1114:
+  .zero 8
+.align 8
+g1113:
+  .zero 8
+.align 8
+g1112:
+  .zero 8
+.align 1
+g1111:
+  .zero 1
+.align 2
+g1110:
+  .zero 2
+.align 8
+g1109:
+  .zero 8
+.align 2
+g1108:
+  .zero 2
+.align 4
+g1107:
+  .zero 4
+.align 8
+g1106:
+  .zero 8
+.align 4
+g1105:
+  .zero 4
+.align 8
+g1104:
+  .zero 8
+.align 1
+g1103:
+  .zero 1
+.align 2
+g1102:
+  .zero 2
+.align 4
+g1101:
+  .zero 4
+.align 2
+g1100:
+  .zero 2
+.align 2
+g1099:
+  .zero 2
+.align 1
+g1098:
+  .zero 1
+.align 1
+g1097:
+  .zero 1
+.align 4
+g1096:
+  .zero 4
+.align 2
+g1095:
+  .zero 2
+.align 1
+g1094:
+  .zero 1
+.align 8
+g1093:
+  .zero 8
+.align 4
+g1092:
+  .zero 4
+.align 4
+g1091:
+  .zero 4
+.align 8
+g1090:
+  .zero 8
+.align 4
+g1089:
+  .zero 4
+.align 1
+g1088:
+  .zero 1
+.align 8
+g1087:
+  .zero 8
+.align 2
+g1086:
+  .zero 2
+.align 2
+g1085:
+  .zero 2
+.align 1
+g1084:
+  .zero 1
+.align 1
+g1083:
+  .zero 1
+.align 8
+g1082:
+  .zero 8
+.align 8
+g1081:
+  .zero 8
+.align 1
+g1080:
+  .zero 1
+.align 8
+g1079:
+  .zero 8
+.align 4
+g1078:
+  .zero 4
+.align 1
+g1077:
+  .zero 1
+.align 4
+g1076:
+  .zero 4
+.align 2
+g1075:
+  .zero 2
+.align 1
+g1074:
+  .zero 1
+.align 8
+g1073:
+  .zero 8
+.align 2
+g1072:
+  .zero 2
+.align 8
+g1071:
+  .zero 8
+.align 4
+g1070:
+  .zero 4
+.align 2
+g1069:
+  .zero 2
+.align 4
+g1068:
+  .zero 4
+.align 2
+g1067:
+  .zero 2
+.align 4
+g1066:
+  .zero 4
+.align 1
+g1065:
+  .zero 1
+.align 1
+g1064:
+  .zero 1
+.align 8
+g1063:
+  .zero 8
+.align 1
+g1062:
+  .zero 1
+.align 4
+g1061:
+  .zero 4
+.align 1
+g1060:
+  .zero 1
+.align 8
+g1059:
+  .zero 8
+.align 4
+g1058:
+  .zero 4
+.align 2
+g1057:
+  .zero 2
+.align 4
+g1056:
+  .zero 4
+.align 8
+g1055:
+  .zero 8
+.align 4
+g1054:
+  .zero 4
+.align 4
+g1053:
+  .zero 4
+.align 1
+g1052:
+  .zero 1
+.align 4
+g1051:
+  .zero 4
+.align 1
+g1050:
+  .zero 1
+.align 4
+g1049:
+  .zero 4
+.align 1
+g1048:
+  .zero 1
+.align 2
+g1047:
+  .zero 2
+.align 1
+g1046:
+  .zero 1
+.align 4
+g1045:
+  .zero 4
+.align 4
+g1044:
+  .zero 4
+.align 1
+g1043:
+  .zero 1
+.align 4
+g1042:
+  .zero 4
+.align 2
+g1041:
+  .zero 2
+.align 8
+g1040:
+  .zero 8
+.align 8
+g1039:
+  .zero 8
+.align 4
+g1038:
+  .zero 4
+.align 1
+g1037:
+  .zero 1
+.align 2
+g1036:
+  .zero 2
+.align 4
+g1035:
+  .zero 4
+.align 2
+g1034:
+  .zero 2
+.align 2
+g1033:
+  .zero 2
+.align 8
+g1032:
+  .zero 8
+.align 2
+g1031:
+  .zero 2
+.align 8
+g1030:
+  .zero 8
+.align 4
+g1029:
+  .zero 4
+.align 1
+g1028:
+  .zero 1
+.align 1
+g1027:
+  .zero 1
+.align 8
+g1026:
+  .zero 8
+.align 8
+g1025:
+  .zero 8
+.align 8
+g1024:
+  .zero 8
+.align 2
+g1023:
+  .zero 2
+.align 1
+g1022:
+  .zero 1
+.align 1
+g1021:
+  .zero 1
+.align 1
+g1020:
+  .zero 1
+.align 1
+g1019:
+  .zero 1
+.align 4
+g1018:
+  .zero 4
+.align 4
+g1017:
+  .zero 4
+.align 8
+g1016:
+  .zero 8
+.align 8
+g1015:
+  .zero 8
+.align 8
+g1014:
+  .zero 8
+.align 8
+g1013:
+  .zero 8
+.align 8
+g1012:
+  .zero 8
+.align 2
+g1011:
+  .zero 2
+.align 8
+g1010:
+  .zero 8
+.align 4
+g1009:
+  .zero 4
+.align 8
+g1008:
+  .zero 8
+.align 8
+g1007:
+  .zero 8
+.align 8
+g1006:
+  .zero 8
+.align 8
+g1005:
+  .zero 8
+.align 2
+g1004:
+  .zero 2
+.align 8
+g1003:
+  .zero 8
+.align 1
+g1002:
+  .zero 1
+.align 4
+g1001:
+  .zero 4
+.align 4
+g1000:
+  .zero 4
+.align 8
+g999:
+  .zero 8
+.align 8
+g998:
+  .zero 8
+.align 8
+g997:
+  .zero 8
+.align 4
+g996:
+  .zero 4
+.align 2
+g995:
+  .zero 2
+.align 1
+g994:
+  .zero 1
+.align 8
+g993:
+  .zero 8
+.align 1
+g992:
+  .zero 1
+.align 8
+g991:
+  .zero 8
+.align 4
+g990:
+  .zero 4
+.align 2
+g989:
+  .zero 2
+.align 8
+g988:
+  .zero 8
+.align 1
+g987:
+  .zero 1
+.align 1
+g986:
+  .zero 1
+.align 8
+g985:
+  .zero 8
+.align 2
+g984:
+  .zero 2
+.align 8
+g983:
+  .zero 8
+.align 8
+g982:
+  .zero 8
+.align 1
+g981:
+  .zero 1
+.align 8
+g980:
+  .zero 8
+.align 1
+g979:
+  .zero 1
+.align 1
+g978:
+  .zero 1
+.align 1
+g977:
+  .zero 1
+.align 4
+g976:
+  .zero 4
+.align 2
+g975:
+  .zero 2
+.align 4
+g974:
+  .zero 4
+.align 1
+g973:
+  .zero 1
+.align 1
+g972:
+  .zero 1
+.align 8
+g971:
+  .zero 8
+.align 1
+g970:
+  .zero 1
+.align 4
+g969:
+  .zero 4
+.align 1
+g968:
+  .zero 1
+.align 1
+g967:
+  .zero 1
+.align 4
+g966:
+  .zero 4
+.align 2
+g965:
+  .zero 2
+.align 2
+g964:
+  .zero 2
+.align 8
+g963:
+  .zero 8
+.align 8
+g962:
+  .zero 8
+.align 4
+g961:
+  .zero 4
+.align 4
+g960:
+  .zero 4
+.align 8
+g959:
+  .zero 8
+.align 2
+g958:
+  .zero 2
+.align 4
+g957:
+  .zero 4
+.align 8
+g956:
+  .zero 8
+.align 2
+g955:
+  .zero 2
+.align 4
+g954:
+  .zero 4
+.align 4
+g953:
+  .zero 4
+.align 4
+g952:
+  .zero 4
+.align 8
+g951:
+  .zero 8
+.align 8
+g950:
+  .zero 8
+.align 4
+g949:
+  .zero 4
+.align 2
+g948:
+  .zero 2
+.align 8
+g947:
+  .zero 8
+.align 8
+g946:
+  .zero 8
+.align 8
+g945:
+  .zero 8
+.align 4
+g944:
+  .zero 4
+.align 2
+g943:
+  .zero 2
+.align 1
+g942:
+  .zero 1
+.align 4
+g941:
+  .zero 4
+.align 2
+g940:
+  .zero 2
+.align 1
+g939:
+  .zero 1
+.align 2
+g938:
+  .zero 2
+.align 4
+g937:
+  .zero 4
+.align 4
+g936:
+  .zero 4
+.align 4
+g935:
+  .zero 4
+.align 4
+g934:
+  .zero 4
+.align 2
+g933:
+  .zero 2
+.align 8
+g932:
+  .zero 8
+.align 1
+g931:
+  .zero 1
+.align 2
+g930:
+  .zero 2
+.align 8
+g929:
+  .zero 8
+.align 4
+g928:
+  .zero 4
+.align 4
+g927:
+  .zero 4
+.align 2
+g926:
+  .zero 2
+.align 8
+g925:
+  .zero 8
+.align 4
+g924:
+  .zero 4
+.align 2
+g923:
+  .zero 2
+.align 2
+g922:
+  .zero 2
+.align 4
+g921:
+  .zero 4
+.align 8
+g920:
+  .zero 8
+.align 2
+g919:
+  .zero 2
+.align 8
+g918:
+  .zero 8
+.align 2
+g917:
+  .zero 2
+.align 4
+g916:
+  .zero 4
+.align 4
+g915:
+  .zero 4
+.align 4
+g914:
+  .zero 4
+.align 2
+g913:
+  .zero 2
+.align 2
+g912:
+  .zero 2
+.align 8
+g911:
+  .zero 8
+.align 2
+g910:
+  .zero 2
+.align 4
+g909:
+  .zero 4
+.align 4
+g908:
+  .zero 4
+.align 4
+g907:
+  .zero 4
+.align 2
+g906:
+  .zero 2
+.align 4
+g905:
+  .zero 4
+.align 8
+g904:
+  .zero 8
+.align 4
+g903:
+  .zero 4
+.align 1
+g902:
+  .zero 1
+.align 8
+g901:
+  .zero 8
+.align 8
+g900:
+  .zero 8
+.align 4
+g899:
+  .zero 4
+.align 4
+g898:
+  .zero 4
+.align 1
+g897:
+  .zero 1
+.align 4
+g896:
+  .zero 4
+.align 4
+g895:
+  .zero 4
+.align 1
+g894:
+  .zero 1
+.align 2
+g893:
+  .zero 2
+.align 8
+g892:
+  .zero 8
+.align 2
+g891:
+  .zero 2
+.align 1
+g890:
+  .zero 1
+.align 2
+g889:
+  .zero 2
+.align 2
+g888:
+  .zero 2
+.align 1
+g887:
+  .zero 1
+.align 2
+g886:
+  .zero 2
+.align 2
+g885:
+  .zero 2
+.align 4
+g884:
+  .zero 4
+.align 2
+g883:
+  .zero 2
+.align 2
+g882:
+  .zero 2
+.align 1
+g881:
+  .zero 1
+.align 4
+g880:
+  .zero 4
+.align 2
+g879:
+  .zero 2
+.align 2
+g878:
+  .zero 2
+.align 4
+g877:
+  .zero 4
+.align 4
+g876:
+  .zero 4
+.align 1
+g875:
+  .zero 1
+.align 1
+g874:
+  .zero 1
+.align 2
+g873:
+  .zero 2
+.align 1
+g872:
+  .zero 1
+.align 1
+g871:
+  .zero 1
+.align 4
+g870:
+  .zero 4
+.align 4
+g869:
+  .zero 4
+.align 8
+g868:
+  .zero 8
+.align 1
+g867:
+  .zero 1
+.align 4
+g866:
+  .zero 4
+.align 4
+g865:
+  .zero 4
+.align 1
+g864:
+  .zero 1
+.align 8
+g863:
+  .zero 8
+.align 1
+g862:
+  .zero 1
+.align 8
+g861:
+  .zero 8
+.align 2
+g860:
+  .zero 2
+.align 4
+g859:
+  .zero 4
+.align 2
+g858:
+  .zero 2
+.align 1
+g857:
+  .zero 1
+.align 8
+g856:
+  .zero 8
+.align 4
+g855:
+  .zero 4
+.align 2
+g854:
+  .zero 2
+.align 8
+g853:
+  .zero 8
+.align 1
+g852:
+  .zero 1
+.align 2
+g851:
+  .zero 2
+.align 4
+g850:
+  .zero 4
+.align 8
+g849:
+  .zero 8
+.align 2
+g848:
+  .zero 2
+.align 2
+g847:
+  .zero 2
+.align 8
+g846:
+  .zero 8
+.align 8
+g845:
+  .zero 8
+.align 2
+g844:
+  .zero 2
+.align 2
+g843:
+  .zero 2
+.align 8
+g842:
+  .zero 8
+.align 8
+g841:
+  .zero 8
+.align 2
+g840:
+  .zero 2
+.align 1
+g839:
+  .zero 1
+.align 2
+g838:
+  .zero 2
+.align 1
+g837:
+  .zero 1
+.align 1
+g836:
+  .zero 1
+.align 1
+g835:
+  .zero 1
+.align 1
+g834:
+  .zero 1
+.align 1
+g833:
+  .zero 1
+.align 4
+g832:
+  .zero 4
+.align 8
+g831:
+  .zero 8
+.align 2
+g830:
+  .zero 2
+.align 2
+g829:
+  .zero 2
+.align 4
+g828:
+  .zero 4
+.align 1
+g827:
+  .zero 1
+.align 2
+g826:
+  .zero 2
+.align 4
+g825:
+  .zero 4
+.align 4
+g824:
+  .zero 4
+.align 8
+g823:
+  .zero 8
+.align 2
+g822:
+  .zero 2
+.align 8
+g821:
+  .zero 8
+.align 1
+g820:
+  .zero 1
+.align 2
+g819:
+  .zero 2
+.align 1
+g818:
+  .zero 1
+.align 8
+g817:
+  .zero 8
+.align 2
+g816:
+  .zero 2
+.align 4
+g815:
+  .zero 4
+.align 2
+g814:
+  .zero 2
+.align 8
+g813:
+  .zero 8
+.align 1
+g812:
+  .zero 1
+.align 8
+g811:
+  .zero 8
+.align 4
+g810:
+  .zero 4
+.align 4
+g809:
+  .zero 4
+.align 8
+g808:
+  .zero 8
+.align 2
+g807:
+  .zero 2
+.align 2
+g806:
+  .zero 2
+.align 4
+g805:
+  .zero 4
+.align 8
+g804:
+  .zero 8
+.align 4
+g803:
+  .zero 4
+.align 2
+g802:
+  .zero 2
+.align 8
+g801:
+  .zero 8
+.align 2
+g800:
+  .zero 2
+.align 4
+g799:
+  .zero 4
+.align 2
+g798:
+  .zero 2
+.align 1
+g797:
+  .zero 1
+.align 1
+g796:
+  .zero 1
+.align 1
+g795:
+  .zero 1
+.align 8
+g794:
+  .zero 8
+.align 8
+g793:
+  .zero 8
+.align 2
+g792:
+  .zero 2
+.align 4
+g791:
+  .zero 4
+.align 8
+g790:
+  .zero 8
+.align 8
+g789:
+  .zero 8
+.align 2
+g788:
+  .zero 2
+.align 4
+g787:
+  .zero 4
+.align 4
+g786:
+  .zero 4
+.align 4
+g785:
+  .zero 4
+.align 1
+g784:
+  .zero 1
+.align 2
+g783:
+  .zero 2
+.align 2
+g782:
+  .zero 2
+.align 1
+g781:
+  .zero 1
+.align 8
+g780:
+  .zero 8
+.align 8
+g779:
+  .zero 8
+.align 8
+g778:
+  .zero 8
+.align 2
+g777:
+  .zero 2
+.align 2
+g776:
+  .zero 2
+.align 1
+g775:
+  .zero 1
+.align 8
+g774:
+  .zero 8
+.align 2
+g773:
+  .zero 2
+.align 8
+g772:
+  .zero 8
+.align 4
+g771:
+  .zero 4
+.align 2
+g770:
+  .zero 2
+.align 1
+g769:
+  .zero 1
+.align 2
+g768:
+  .zero 2
+.align 8
+g767:
+  .zero 8
+.align 4
+g766:
+  .zero 4
+.align 2
+g765:
+  .zero 2
+.align 1
+g764:
+  .zero 1
+.align 4
+g763:
+  .zero 4
+.align 8
+g762:
+  .zero 8
+.align 4
+g761:
+  .zero 4
+.align 1
+g760:
+  .zero 1
+.align 8
+g759:
+  .zero 8
+.align 2
+g758:
+  .zero 2
+.align 1
+g757:
+  .zero 1
+.align 1
+g756:
+  .zero 1
+.align 8
+g755:
+  .zero 8
+.align 2
+g754:
+  .zero 2
+.align 8
+g753:
+  .zero 8
+.align 2
+g752:
+  .zero 2
+.align 4
+g751:
+  .zero 4
+.align 8
+g750:
+  .zero 8
+.align 8
+g749:
+  .zero 8
+.align 8
+g748:
+  .zero 8
+.align 1
+g747:
+  .zero 1
+.align 8
+g746:
+  .zero 8
+.align 2
+g745:
+  .zero 2
+.align 8
+g744:
+  .zero 8
+.align 8
+g743:
+  .zero 8
+.align 1
+g742:
+  .zero 1
+.align 1
+g741:
+  .zero 1
+.align 4
+g740:
+  .zero 4
+.align 4
+g739:
+  .zero 4
+.align 2
+g738:
+  .zero 2
+.align 1
+g737:
+  .zero 1
+.align 8
+g736:
+  .zero 8
+.align 1
+g735:
+  .zero 1
+.align 4
+g734:
+  .zero 4
+.align 8
+g733:
+  .zero 8
+.align 4
+g732:
+  .zero 4
+.align 2
+g731:
+  .zero 2
+.align 2
+g730:
+  .zero 2
+.align 1
+g729:
+  .zero 1
+.align 4
+g728:
+  .zero 4
+.align 2
+g727:
+  .zero 2
+.align 4
+g726:
+  .zero 4
+.align 8
+g725:
+  .zero 8
+.align 4
+g724:
+  .zero 4
+.align 4
+g723:
+  .zero 4
+.align 1
+g722:
+  .zero 1
+.align 8
+g721:
+  .zero 8
+.align 2
+g720:
+  .zero 2
+.align 4
+g719:
+  .zero 4
+.align 2
+g718:
+  .zero 2
+.align 8
+g717:
+  .zero 8
+.align 1
+g716:
+  .zero 1
+.align 4
+g715:
+  .zero 4
+.align 4
+g714:
+  .zero 4
+.align 4
+g713:
+  .zero 4
+.align 4
+g712:
+  .zero 4
+.align 1
+g711:
+  .zero 1
+.align 2
+g710:
+  .zero 2
+.align 8
+g709:
+  .zero 8
+.align 8
+g708:
+  .zero 8
+.align 8
+g707:
+  .zero 8
+.align 2
+g706:
+  .zero 2
+.align 8
+g705:
+  .zero 8
+.align 1
+g704:
+  .zero 1
+.align 2
+g703:
+  .zero 2
+.align 8
+g702:
+  .zero 8
+.align 8
+g701:
+  .zero 8
+.align 1
+g700:
+  .zero 1
+.align 4
+g699:
+  .zero 4
+.align 8
+g698:
+  .zero 8
+.align 1
+g697:
+  .zero 1
+.align 8
+g696:
+  .zero 8
+.align 1
+g695:
+  .zero 1
+.align 1
+g694:
+  .zero 1
+.align 2
+g693:
+  .zero 2
+.align 1
+g692:
+  .zero 1
+.align 2
+g691:
+  .zero 2
+.align 1
+g690:
+  .zero 1
+.align 2
+g689:
+  .zero 2
+.align 8
+g688:
+  .zero 8
+.align 2
+g687:
+  .zero 2
+.align 8
+g686:
+  .zero 8
+.align 1
+g685:
+  .zero 1
+.align 8
+g684:
+  .zero 8
+.align 1
+g683:
+  .zero 1
+.align 2
+g682:
+  .zero 2
+.align 4
+g681:
+  .zero 4
+.align 2
+g680:
+  .zero 2
+.align 1
+g679:
+  .zero 1
+.align 8
+g678:
+  .zero 8
+.align 2
+g677:
+  .zero 2
+.align 8
+g676:
+  .zero 8
+.align 8
+g675:
+  .zero 8
+.align 2
+g674:
+  .zero 2
+.align 8
+g673:
+  .zero 8
+.align 8
+g672:
+  .zero 8
+.align 4
+g671:
+  .zero 4
+.align 2
+g670:
+  .zero 2
+.align 4
+g669:
+  .zero 4
+.align 2
+g668:
+  .zero 2
+.align 8
+g667:
+  .zero 8
+.align 2
+g666:
+  .zero 2
+.align 1
+g665:
+  .zero 1
+.align 4
+g664:
+  .zero 4
+.align 1
+g663:
+  .zero 1
+.align 4
+g662:
+  .zero 4
+.align 2
+g661:
+  .zero 2
+.align 8
+g660:
+  .zero 8
+.align 8
+g659:
+  .zero 8
+.align 8
+g658:
+  .zero 8
+.align 8
+g657:
+  .zero 8
+.align 1
+g656:
+  .zero 1
+.align 8
+g655:
+  .zero 8
+.align 2
+g654:
+  .zero 2
+.align 8
+g653:
+  .zero 8
+.align 1
+g652:
+  .zero 1
+.align 1
+g651:
+  .zero 1
+.align 2
+g650:
+  .zero 2
+.align 1
+g649:
+  .zero 1
+.align 4
+g648:
+  .zero 4
+.align 1
+g647:
+  .zero 1
+.align 8
+g646:
+  .zero 8
+.align 8
+g645:
+  .zero 8
+.align 4
+g644:
+  .zero 4
+.align 8
+g643:
+  .zero 8
+.align 8
+g642:
+  .zero 8
+.align 2
+g641:
+  .zero 2
+.align 2
+g640:
+  .zero 2
+.align 1
+g639:
+  .zero 1
+.align 4
+g638:
+  .zero 4
+.align 2
+g637:
+  .zero 2
+.align 4
+g636:
+  .zero 4
+.align 2
+g635:
+  .zero 2
+.align 1
+g634:
+  .zero 1
+.align 2
+g633:
+  .zero 2
+.align 1
+g632:
+  .zero 1
+.align 2
+g631:
+  .zero 2
+.align 8
+g630:
+  .zero 8
+.align 8
+g629:
+  .zero 8
+.align 1
+g628:
+  .zero 1
+.align 1
+g627:
+  .zero 1
+.align 8
+g626:
+  .zero 8
+.align 4
+g625:
+  .zero 4
+.align 4
+g624:
+  .zero 4
+.align 1
+g623:
+  .zero 1
+.align 8
+g622:
+  .zero 8
+.align 8
+g621:
+  .zero 8
+.align 2
+g620:
+  .zero 2
+.align 2
+g619:
+  .zero 2
+.align 2
+g618:
+  .zero 2
+.align 8
+g617:
+  .zero 8
+.align 4
+g616:
+  .zero 4
+.align 8
+g615:
+  .zero 8
+.align 2
+g614:
+  .zero 2
+.align 4
+g613:
+  .zero 4
+.align 8
+g612:
+  .zero 8
+.align 2
+g611:
+  .zero 2
+.align 2
+g610:
+  .zero 2
+.align 1
+g609:
+  .zero 1
+.align 4
+g608:
+  .zero 4
+.align 8
+g607:
+  .zero 8
+.align 8
+g606:
+  .zero 8
+.align 1
+g605:
+  .zero 1
+.align 4
+g604:
+  .zero 4
+.align 1
+g603:
+  .zero 1
+.align 2
+g602:
+  .zero 2
+.align 8
+g601:
+  .zero 8
+.align 4
+g600:
+  .zero 4
+.align 4
+g599:
+  .zero 4
+.align 2
+g598:
+  .zero 2
+.align 4
+g597:
+  .zero 4
+.align 4
+g596:
+  .zero 4
+.align 1
+g595:
+  .zero 1
+.align 2
+g594:
+  .zero 2
+.align 8
+g593:
+  .zero 8
+.align 1
+g592:
+  .zero 1
+.align 1
+g591:
+  .zero 1
+.align 2
+g590:
+  .zero 2
+.align 2
+g589:
+  .zero 2
+.align 1
+g588:
+  .zero 1
+.align 4
+g587:
+  .zero 4
+.align 8
+g586:
+  .zero 8
+.align 2
+g585:
+  .zero 2
+.align 2
+g584:
+  .zero 2
+.align 4
+g583:
+  .zero 4
+.align 1
+g582:
+  .zero 1
+.align 8
+g581:
+  .zero 8
+.align 4
+g580:
+  .zero 4
+.align 8
+g579:
+  .zero 8
+.align 2
+g578:
+  .zero 2
+.align 8
+g577:
+  .zero 8
+.align 1
+g576:
+  .zero 1
+.align 1
+g575:
+  .zero 1
+.align 2
+g574:
+  .zero 2
+.align 1
+g573:
+  .zero 1
+.align 4
+g572:
+  .zero 4
+.align 8
+g571:
+  .zero 8
+.align 8
+g570:
+  .zero 8
+.align 8
+g569:
+  .zero 8
+.align 1
+g568:
+  .zero 1
+.align 1
+g567:
+  .zero 1
+.align 8
+g566:
+  .zero 8
+.align 1
+g565:
+  .zero 1
+.align 1
+g564:
+  .zero 1
+.align 2
+g563:
+  .zero 2
+.align 1
+g562:
+  .zero 1
+.align 4
+g561:
+  .zero 4
+.align 1
+g560:
+  .zero 1
+.align 8
+g559:
+  .zero 8
+.align 2
+g558:
+  .zero 2
+.align 1
+g557:
+  .zero 1
+.align 8
+g556:
+  .zero 8
+.align 2
+g555:
+  .zero 2
+.align 4
+g554:
+  .zero 4
+.align 4
+g553:
+  .zero 4
+.align 4
+g552:
+  .zero 4
+.align 8
+g551:
+  .zero 8
+.align 4
+g550:
+  .zero 4
+.align 4
+g549:
+  .zero 4
+.align 8
+g548:
+  .zero 8
+.align 2
+g547:
+  .zero 2
+.align 2
+g546:
+  .zero 2
+.align 4
+g545:
+  .zero 4
+.align 4
+g544:
+  .zero 4
+.align 4
+g543:
+  .zero 4
+.align 2
+g542:
+  .zero 2
+.align 4
+g541:
+  .zero 4
+.align 1
+g540:
+  .zero 1
+.align 8
+g539:
+  .zero 8
+.align 8
+g538:
+  .zero 8
+.align 2
+g537:
+  .zero 2
+.align 8
+g536:
+  .zero 8
+.align 8
+g535:
+  .zero 8
+.align 1
+g534:
+  .zero 1
+.align 8
+g533:
+  .zero 8
+.align 1
+g532:
+  .zero 1
+.align 2
+g531:
+  .zero 2
+.align 1
+g530:
+  .zero 1
+.align 4
+g529:
+  .zero 4
+.align 8
+g528:
+  .zero 8
+.align 1
+g527:
+  .zero 1
+.align 8
+g526:
+  .zero 8
+.align 4
+g525:
+  .zero 4
+.align 4
+g524:
+  .zero 4
+.align 8
+g523:
+  .zero 8
+.align 8
+g522:
+  .zero 8
+.align 8
+g521:
+  .zero 8
+.align 8
+g520:
+  .zero 8
+.align 2
+g519:
+  .zero 2
+.align 4
+g518:
+  .zero 4
+.align 8
+g517:
+  .zero 8
+.align 1
+g516:
+  .zero 1
+.align 8
+g515:
+  .zero 8
+.align 1
+g514:
+  .zero 1
+.align 4
+g513:
+  .zero 4
+.align 2
+g512:
+  .zero 2
+.align 4
+g511:
+  .zero 4
+.align 2
+g510:
+  .zero 2
+.align 8
+g509:
+  .zero 8
+.align 1
+g508:
+  .zero 1
+.align 8
+g507:
+  .zero 8
+.align 4
+g506:
+  .zero 4
+.align 2
+g505:
+  .zero 2
+.align 8
+g504:
+  .zero 8
+.align 2
+g503:
+  .zero 2
+.align 1
+g502:
+  .zero 1
+.align 2
+g501:
+  .zero 2
+.align 1
+g500:
+  .zero 1
+.align 2
+g499:
+  .zero 2
+.align 8
+g498:
+  .zero 8
+.align 1
+g497:
+  .zero 1
+.align 1
+g496:
+  .zero 1
+.align 2
+g495:
+  .zero 2
+.align 2
+g494:
+  .zero 2
+.align 2
+g493:
+  .zero 2
+.align 2
+g492:
+  .zero 2
+.align 4
+g491:
+  .zero 4
+.align 8
+g490:
+  .zero 8
+.align 2
+g489:
+  .zero 2
+.align 2
+g488:
+  .zero 2
+.align 2
+g487:
+  .zero 2
+.align 2
+g486:
+  .zero 2
+.align 2
+g485:
+  .zero 2
+.align 4
+g484:
+  .zero 4
+.align 1
+g483:
+  .zero 1
+.align 4
+g482:
+  .zero 4
+.align 1
+g481:
+  .zero 1
+.align 4
+g480:
+  .zero 4
+.align 4
+g479:
+  .zero 4
+.align 4
+g478:
+  .zero 4
+.align 1
+g477:
+  .zero 1
+.align 8
+g476:
+  .zero 8
+.align 1
+g475:
+  .zero 1
+.align 4
+g474:
+  .zero 4
+.align 1
+g473:
+  .zero 1
+.align 1
+g472:
+  .zero 1
+.align 2
+g471:
+  .zero 2
+.align 8
+g470:
+  .zero 8
+.align 2
+g469:
+  .zero 2
+.align 4
+g468:
+  .zero 4
+.align 2
+g467:
+  .zero 2
+.align 8
+g466:
+  .zero 8
+.align 2
+g465:
+  .zero 2
+.align 8
+g464:
+  .zero 8
+.align 2
+g463:
+  .zero 2
+.align 1
+g462:
+  .zero 1
+.align 2
+g461:
+  .zero 2
+.align 4
+g460:
+  .zero 4
+.align 1
+g459:
+  .zero 1
+.align 1
+g458:
+  .zero 1
+.align 8
+g457:
+  .zero 8
+.align 4
+g456:
+  .zero 4
+.align 4
+g455:
+  .zero 4
+.align 1
+g454:
+  .zero 1
+.align 4
+g453:
+  .zero 4
+.align 4
+g452:
+  .zero 4
+.align 1
+g451:
+  .zero 1
+.align 2
+g450:
+  .zero 2
+.align 8
+g449:
+  .zero 8
+.align 4
+g448:
+  .zero 4
+.align 1
+g447:
+  .zero 1
+.align 2
+g446:
+  .zero 2
+.align 2
+g445:
+  .zero 2
+.align 1
+g444:
+  .zero 1
+.align 2
+g443:
+  .zero 2
+.align 8
+g442:
+  .zero 8
+.align 2
+g441:
+  .zero 2
+.align 8
+g440:
+  .zero 8
+.align 1
+g439:
+  .zero 1
+.align 1
+g438:
+  .zero 1
+.align 2
+g437:
+  .zero 2
+.align 2
+g436:
+  .zero 2
+.align 8
+g435:
+  .zero 8
+.align 4
+g434:
+  .zero 4
+.align 2
+g433:
+  .zero 2
+.align 2
+g432:
+  .zero 2
+.align 2
+g431:
+  .zero 2
+.align 8
+g430:
+  .zero 8
+.align 2
+g429:
+  .zero 2
+.align 4
+g428:
+  .zero 4
+.align 8
+g427:
+  .zero 8
+.align 2
+g426:
+  .zero 2
+.align 8
+g425:
+  .zero 8
+.align 1
+g424:
+  .zero 1
+.align 8
+g423:
+  .zero 8
+.align 8
+g422:
+  .zero 8
+.align 2
+g421:
+  .zero 2
+.align 4
+g420:
+  .zero 4
+.align 4
+g419:
+  .zero 4
+.align 4
+g418:
+  .zero 4
+.align 1
+g417:
+  .zero 1
+.align 8
+g416:
+  .zero 8
+.align 1
+g415:
+  .zero 1
+.align 2
+g414:
+  .zero 2
+.align 2
+g413:
+  .zero 2
+.align 8
+g412:
+  .zero 8
+.align 8
+g411:
+  .zero 8
+.align 8
+g410:
+  .zero 8
+.align 2
+g409:
+  .zero 2
+.align 2
+g408:
+  .zero 2
+.align 8
+g407:
+  .zero 8
+.align 8
+g406:
+  .zero 8
+.align 2
+g405:
+  .zero 2
+.align 1
+g404:
+  .zero 1
+.align 1
+g403:
+  .zero 1
+.align 1
+g402:
+  .zero 1
+.align 1
+g401:
+  .zero 1
+.align 1
+g400:
+  .zero 1
+.align 1
+g399:
+  .zero 1
+.align 2
+g398:
+  .zero 2
+.align 2
+g397:
+  .zero 2
+.align 8
+g396:
+  .zero 8
+.align 4
+g395:
+  .zero 4
+.align 4
+g394:
+  .zero 4
+.align 1
+g393:
+  .zero 1
+.align 8
+g392:
+  .zero 8
+.align 1
+g391:
+  .zero 1
+.align 4
+g390:
+  .zero 4
+.align 8
+g389:
+  .zero 8
+.align 2
+g388:
+  .zero 2
+.align 4
+g387:
+  .zero 4
+.align 8
+g386:
+  .zero 8
+.align 2
+g385:
+  .zero 2
+.align 2
+g384:
+  .zero 2
+.align 8
+g383:
+  .zero 8
+.align 2
+g382:
+  .zero 2
+.align 2
+g381:
+  .zero 2
+.align 4
+g380:
+  .zero 4
+.align 8
+g379:
+  .zero 8
+.align 8
+g378:
+  .zero 8
+.align 8
+g377:
+  .zero 8
+.align 8
+g376:
+  .zero 8
+.align 1
+g375:
+  .zero 1
+.align 8
+g374:
+  .zero 8
+.align 1
+g373:
+  .zero 1
+.align 1
+g372:
+  .zero 1
+.align 8
+g371:
+  .zero 8
+.align 4
+g370:
+  .zero 4
+.align 8
+g369:
+  .zero 8
+.align 8
+g368:
+  .zero 8
+.align 2
+g367:
+  .zero 2
+.align 1
+g366:
+  .zero 1
+.align 2
+g365:
+  .zero 2
+.align 8
+g364:
+  .zero 8
+.align 4
+g363:
+  .zero 4
+.align 8
+g362:
+  .zero 8
+.align 1
+g361:
+  .zero 1
+.align 2
+g360:
+  .zero 2
+.align 4
+g359:
+  .zero 4
+.align 2
+g358:
+  .zero 2
+.align 4
+g357:
+  .zero 4
+.align 8
+g356:
+  .zero 8
+.align 8
+g355:
+  .zero 8
+.align 8
+g354:
+  .zero 8
+.align 8
+g353:
+  .zero 8
+.align 8
+g352:
+  .zero 8
+.align 8
+g351:
+  .zero 8
+.align 8
+g350:
+  .zero 8
+.align 2
+g349:
+  .zero 2
+.align 8
+g348:
+  .zero 8
+.align 4
+g347:
+  .zero 4
+.align 8
+g346:
+  .zero 8
+.align 8
+g345:
+  .zero 8
+.align 2
+g344:
+  .zero 2
+.align 8
+g343:
+  .zero 8
+.align 8
+g342:
+  .zero 8
+.align 4
+g341:
+  .zero 4
+.align 4
+g340:
+  .zero 4
+.align 4
+g339:
+  .zero 4
+.align 1
+g338:
+  .zero 1
+.align 4
+g337:
+  .zero 4
+.align 2
+g336:
+  .zero 2
+.align 1
+g335:
+  .zero 1
+.align 4
+g334:
+  .zero 4
+.align 8
+g333:
+  .zero 8
+.align 1
+g332:
+  .zero 1
+.align 1
+g331:
+  .zero 1
+.align 2
+g330:
+  .zero 2
+.align 4
+g329:
+  .zero 4
+.align 8
+g328:
+  .zero 8
+.align 1
+g327:
+  .zero 1
+.align 4
+g326:
+  .zero 4
+.align 2
+g325:
+  .zero 2
+.align 1
+g324:
+  .zero 1
+.align 8
+g323:
+  .zero 8
+.align 8
+g322:
+  .zero 8
+.align 8
+g321:
+  .zero 8
+.align 8
+g320:
+  .zero 8
+.align 8
+g319:
+  .zero 8
+.align 4
+g318:
+  .zero 4
+.align 4
+g317:
+  .zero 4
+.align 8
+g316:
+  .zero 8
+.align 2
+g315:
+  .zero 2
+.align 8
+g314:
+  .zero 8
+.align 2
+g313:
+  .zero 2
+.align 8
+g312:
+  .zero 8
+.align 2
+g311:
+  .zero 2
+.align 8
+g310:
+  .zero 8
+.align 4
+g309:
+  .zero 4
+.align 2
+g308:
+  .zero 2
+.align 1
+g307:
+  .zero 1
+.align 1
+g306:
+  .zero 1
+.align 8
+g305:
+  .zero 8
+.align 2
+g304:
+  .zero 2
+.align 1
+g303:
+  .zero 1
+.align 2
+g302:
+  .zero 2
+.align 8
+g301:
+  .zero 8
+.align 4
+g300:
+  .zero 4
+.align 2
+g299:
+  .zero 2
+.align 4
+g298:
+  .zero 4
+.align 8
+g297:
+  .zero 8
+.align 2
+g296:
+  .zero 2
+.align 4
+g295:
+  .zero 4
+.align 2
+g294:
+  .zero 2
+.align 4
+g293:
+  .zero 4
+.align 2
+g292:
+  .zero 2
+.align 2
+g291:
+  .zero 2
+.align 1
+g290:
+  .zero 1
+.align 2
+g289:
+  .zero 2
+.align 1
+g288:
+  .zero 1
+.align 8
+g287:
+  .zero 8
+.align 8
+g286:
+  .zero 8
+.align 1
+g285:
+  .zero 1
+.align 2
+g284:
+  .zero 2
+.align 8
+g283:
+  .zero 8
+.align 4
+g282:
+  .zero 4
+.align 8
+g281:
+  .zero 8
+.align 4
+g280:
+  .zero 4
+.align 1
+g279:
+  .zero 1
+.align 1
+g278:
+  .zero 1
+.align 8
+g277:
+  .zero 8
+.align 1
+g276:
+  .zero 1
+.align 4
+g275:
+  .zero 4
+.align 4
+g274:
+  .zero 4
+.align 1
+g273:
+  .zero 1
+.align 2
+g272:
+  .zero 2
+.align 4
+g271:
+  .zero 4
+.align 1
+g270:
+  .zero 1
+.align 2
+g269:
+  .zero 2
+.align 2
+g268:
+  .zero 2
+.align 1
+g267:
+  .zero 1
+.align 2
+g266:
+  .zero 2
+.align 2
+g265:
+  .zero 2
+.align 4
+g264:
+  .zero 4
+.align 1
+g263:
+  .zero 1
+.align 8
+g262:
+  .zero 8
+.align 4
+g261:
+  .zero 4
+.align 1
+g260:
+  .zero 1
+.align 4
+g259:
+  .zero 4
+.align 8
+g258:
+  .zero 8
+.align 2
+g257:
+  .zero 2
+.align 4
+g256:
+  .zero 4
+.align 2
+g255:
+  .zero 2
+.align 4
+g254:
+  .zero 4
+.align 8
+g253:
+  .zero 8
+.align 2
+g252:
+  .zero 2
+.align 1
+g251:
+  .zero 1
+.align 8
+g250:
+  .zero 8
+.align 2
+g249:
+  .zero 2
+.align 2
+g248:
+  .zero 2
+.align 8
+g247:
+  .zero 8
+.align 8
+g246:
+  .zero 8
+.align 8
+g245:
+  .zero 8
+.align 2
+g244:
+  .zero 2
+.align 8
+g243:
+  .zero 8
+.align 2
+g242:
+  .zero 2
+.align 4
+g241:
+  .zero 4
+.align 4
+g240:
+  .zero 4
+.align 2
+g239:
+  .zero 2
+.align 2
+g238:
+  .zero 2
+.align 8
+g237:
+  .zero 8
+.align 8
+g236:
+  .zero 8
+.align 1
+g235:
+  .zero 1
+.align 4
+g234:
+  .zero 4
+.align 1
+g233:
+  .zero 1
+.align 2
+g232:
+  .zero 2
+.align 4
+g231:
+  .zero 4
+.align 4
+g230:
+  .zero 4
+.align 8
+g229:
+  .zero 8
+.align 8
+g228:
+  .zero 8
+.align 1
+g227:
+  .zero 1
+.align 2
+g226:
+  .zero 2
+.align 2
+g225:
+  .zero 2
+.align 2
+g224:
+  .zero 2
+.align 1
+g223:
+  .zero 1
+.align 4
+g222:
+  .zero 4
+.align 2
+g221:
+  .zero 2
+.align 1
+g220:
+  .zero 1
+.align 4
+g219:
+  .zero 4
+.align 4
+g218:
+  .zero 4
+.align 2
+g217:
+  .zero 2
+.align 1
+g216:
+  .zero 1
+.align 2
+g215:
+  .zero 2
+.align 4
+g214:
+  .zero 4
+.align 2
+g213:
+  .zero 2
+.align 2
+g212:
+  .zero 2
+.align 2
+g211:
+  .zero 2
+.align 1
+g210:
+  .zero 1
+.align 1
+g209:
+  .zero 1
+.align 8
+g208:
+  .zero 8
+.align 2
+g207:
+  .zero 2
+.align 4
+g206:
+  .zero 4
+.align 8
+g205:
+  .zero 8
+.align 4
+g204:
+  .zero 4
+.align 4
+g203:
+  .zero 4
+.align 4
+g202:
+  .zero 4
+.align 1
+g201:
+  .zero 1
+.align 2
+g200:
+  .zero 2
+.align 2
+g199:
+  .zero 2
+.align 1
+g198:
+  .zero 1
+.align 2
+g197:
+  .zero 2
+.align 1
+g196:
+  .zero 1
+.align 2
+g195:
+  .zero 2
+.align 1
+g194:
+  .zero 1
+.align 4
+g193:
+  .zero 4
+.align 1
+g192:
+  .zero 1
+.align 2
+g191:
+  .zero 2
+.align 1
+g190:
+  .zero 1
+.align 4
+g189:
+  .zero 4
+.align 2
+g188:
+  .zero 2
+.align 8
+g187:
+  .zero 8
+.align 4
+g186:
+  .zero 4
+.align 4
+g185:
+  .zero 4
+.align 4
+g184:
+  .zero 4
+.align 2
+g183:
+  .zero 2
+.align 2
+g182:
+  .zero 2
+.align 1
+g181:
+  .zero 1
+.align 2
+g180:
+  .zero 2
+.align 8
+g179:
+  .zero 8
+.align 8
+g178:
+  .zero 8
+.align 2
+g177:
+  .zero 2
+.align 1
+g176:
+  .zero 1
+.align 4
+g175:
+  .zero 4
+.align 2
+g174:
+  .zero 2
+.align 1
+g173:
+  .zero 1
+.align 1
+g172:
+  .zero 1
+.align 2
+g171:
+  .zero 2
+.align 4
+g170:
+  .zero 4
+.align 2
+g169:
+  .zero 2
+.align 2
+g168:
+  .zero 2
+.align 8
+g167:
+  .zero 8
+.align 4
+g166:
+  .zero 4
+.align 2
+g165:
+  .zero 2
+.align 4
+g164:
+  .zero 4
+.align 4
+g163:
+  .zero 4
+.align 4
+g162:
+  .zero 4
+.align 2
+g161:
+  .zero 2
+.align 1
+g160:
+  .zero 1
+.align 8
+g159:
+  .zero 8
+.align 4
+g158:
+  .zero 4
+.align 2
+g157:
+  .zero 2
+.align 2
+g156:
+  .zero 2
+.align 2
+g155:
+  .zero 2
+.align 4
+g154:
+  .zero 4
+.align 2
+g153:
+  .zero 2
+.align 2
+g152:
+  .zero 2
+.align 2
+g151:
+  .zero 2
+.align 2
+g150:
+  .zero 2
+.align 4
+g149:
+  .zero 4
+.align 8
+g148:
+  .zero 8
+.align 4
+g147:
+  .zero 4
+.align 1
+g146:
+  .zero 1
+.align 2
+g145:
+  .zero 2
+.align 2
+g144:
+  .zero 2
+.align 2
+g143:
+  .zero 2
+.align 4
+g142:
+  .zero 4
+.align 1
+g141:
+  .zero 1
+.align 4
+g140:
+  .zero 4
+.align 8
+g139:
+  .zero 8
+.align 8
+g138:
+  .zero 8
+.align 8
+g137:
+  .zero 8
+.align 4
+g136:
+  .zero 4
+.align 4
+g135:
+  .zero 4
+.align 4
+g134:
+  .zero 4
+.align 8
+g133:
+  .zero 8
+.align 1
+g132:
+  .zero 1
+.align 2
+g131:
+  .zero 2
+.align 1
+g130:
+  .zero 1
+.align 1
+g129:
+  .zero 1
+.align 4
+g128:
+  .zero 4
+.align 1
+g127:
+  .zero 1
+.align 4
+g126:
+  .zero 4
+.align 2
+g125:
+  .zero 2
+.align 8
+g124:
+  .zero 8
+.align 2
+g123:
+  .zero 2
+.align 8
+g122:
+  .zero 8
+.align 1
+g121:
+  .zero 1
+.align 4
+g120:
+  .zero 4
+.align 1
+g119:
+  .zero 1
+.align 2
+g118:
+  .zero 2
+.align 1
+g117:
+  .zero 1
+.align 8
+g116:
+  .zero 8
+.align 2
+g115:
+  .zero 2
+.align 2
+g114:
+  .zero 2
+.align 2
+g113:
+  .zero 2
+.align 8
+g112:
+  .zero 8
+.align 1
+g111:
+  .zero 1
+.align 4
+g110:
+  .zero 4
+.align 1
+g109:
+  .zero 1
+.align 4
+g108:
+  .zero 4
+.align 8
+g107:
+  .zero 8
+.align 1
+g106:
+  .zero 1
+.align 2
+g105:
+  .zero 2
+.align 4
+g104:
+  .zero 4
+.align 4
+g103:
+  .zero 4
+.align 4
+g102:
+  .zero 4
+.align 1
+g101:
+  .zero 1
+.align 2
+g100:
+  .zero 2
+.align 1
+g99:
+  .zero 1
+.align 8
+g98:
+  .zero 8
+.align 1
+g97:
+  .zero 1
+.align 2
+g96:
+  .zero 2
+.align 4
+g95:
+  .zero 4
+.align 2
+g94:
+  .zero 2
+.align 4
+g93:
+  .zero 4
+.align 8
+g92:
+  .zero 8
+.align 1
+g91:
+  .zero 1
+.align 4
+g90:
+  .zero 4
+.align 4
+g89:
+  .zero 4
+.align 1
+g88:
+  .zero 1
+.align 8
+g87:
+  .zero 8
+.align 1
+g86:
+  .zero 1
+.align 2
+g85:
+  .zero 2
+.align 4
+g84:
+  .zero 4
+.align 4
+g83:
+  .zero 4
+.align 8
+g82:
+  .zero 8
+.align 8
+g81:
+  .zero 8
+.align 2
+g80:
+  .zero 2
+.align 2
+g79:
+  .zero 2
+.align 8
+g78:
+  .zero 8
+.align 4
+g77:
+  .zero 4
+.align 2
+g76:
+  .zero 2
+.align 1
+g75:
+  .zero 1
+.align 8
+g74:
+  .zero 8
+.align 1
+g73:
+  .zero 1
+.align 2
+g72:
+  .zero 2
+.align 2
+g71:
+  .zero 2
+.align 4
+g70:
+  .zero 4
+.align 8
+g69:
+  .zero 8
+.align 4
+g68:
+  .zero 4
+.align 1
+g67:
+  .zero 1
+.align 8
+g66:
+  .zero 8
+.align 8
+g65:
+  .zero 8
+.align 8
+g64:
+  .zero 8
+.align 2
+g63:
+  .zero 2
+.align 1
+g62:
+  .zero 1
+.align 4
+g61:
+  .zero 4
+.align 2
+g60:
+  .zero 2
+.align 4
+g59:
+  .zero 4
+.align 8
+g58:
+  .zero 8
+.align 8
+g57:
+  .zero 8
+.align 4
+g56:
+  .zero 4
+.align 1
+g55:
+  .zero 1
+.align 2
+g54:
+  .zero 2
+.align 4
+g53:
+  .zero 4
+.align 1
+g52:
+  .zero 1
+.align 1
+g51:
+  .zero 1
+.align 4
+g50:
+  .zero 4
+.align 4
+g49:
+  .zero 4
+.align 8
+g48:
+  .zero 8
+.align 2
+g47:
+  .zero 2
+.align 1
+g46:
+  .zero 1
+.align 4
+g45:
+  .zero 4
+.align 2
+g44:
+  .zero 2
+.align 1
+g43:
+  .zero 1
+.align 4
+g42:
+  .zero 4
+.align 1
+g41:
+  .zero 1
+.align 8
+g40:
+  .zero 8
+.align 2
+g39:
+  .zero 2
+.align 1
+g38:
+  .zero 1
+.align 4
+g37:
+  .zero 4
+.align 4
+g36:
+  .zero 4
+.align 4
+g35:
+  .zero 4
+.align 4
+g34:
+  .zero 4
+.align 2
+g33:
+  .zero 2
+.align 1
+g32:
+  .zero 1
+.align 4
+g31:
+  .zero 4
+.align 8
+g30:
+  .zero 8
+.align 1
+g29:
+  .zero 1
+.align 2
+g28:
+  .zero 2
+.align 1
+g27:
+  .zero 1
+.align 1
+g26:
+  .zero 1
+.align 1
+g25:
+  .zero 1
+.align 2
+g24:
+  .zero 2
+.align 4
+g23:
+  .zero 4
+.align 4
+g22:
+  .zero 4
+.align 2
+g21:
+  .zero 2
+.align 8
+g20:
+  .zero 8
+.align 2
+g19:
+  .zero 2
+.align 1
+g18:
+  .zero 1
+.align 8
+g17:
+  .zero 8
+.align 4
+g16:
+  .zero 4
+.align 1
+g15:
+  .zero 1
+.align 4
+g14:
+  .zero 4
+.align 1
+g13:
+  .zero 1
+.align 1
+g12:
+  .zero 1
+.align 4
+g11:
+  .zero 4
+.align 8
+g10:
+  .zero 8
+.align 4
+g9:
+  .zero 4
+.align 2
+g8:
+  .zero 2
+.align 4
+g7:
+  .zero 4
+.align 4
+g6:
+  .zero 4
+.align 8
+g5:
+  .zero 8
+.align 4
+g4:
+  .zero 4
+.align 4
+g3:
+  .zero 4
+.align 1
+g2:
+  .zero 1
+.align 2
+g1:
+  .zero 2
+.align 4
+g0:
+  .zero 4
+.data
+.text
+.p2align 4
+.global u0
+u0:
+  mov rsi, qword ptr [rip+g3143]
+  add rsi, qword ptr [rip+g4065]
+  mov dword ptr [rip+g0], esi
+  movsx rsi, word ptr [rip+g1573]
+  movsx rdi, word ptr [rip+g3046]
+  add rsi, rdi
+  mov word ptr [rip+g1], si
+  movsx rsi, word ptr [rip+g4790]
+  movsx rdi, word ptr [rip+g2148]
+  add rsi, rdi
+  mov byte ptr [rip+g2], sil
+  movsxd rsi, dword ptr [rip+g3144]
+  movsx rdi, byte ptr [rip+g4530]
+  add rsi, rdi
+  mov dword ptr [rip+g3], esi
+  movsxd rsi, dword ptr [rip+g230]
+  movsx rdi, word ptr [rip+g85]
+  add rsi, rdi
+  mov dword ptr [rip+g4], esi
+  movsx rsi, word ptr [rip+g802]
+  movsx rdi, word ptr [rip+g782]
+  add rsi, rdi
+  mov qword ptr [rip+g5], rsi
+  mov rsi, qword ptr [rip+g2245]
+  movsx rdi, word ptr [rip+g80]
+  add rsi, rdi
+  mov dword ptr [rip+g6], esi
+  movsx rsi, word ptr [rip+g2575]
+  add rsi, qword ptr [rip+g2144]
+  mov dword ptr [rip+g7], esi
+  movsx rsi, byte ptr [rip+g562]
+  movsxd rdi, dword ptr [rip+g1902]
+  add rsi, rdi
+  mov word ptr [rip+g8], si
+  movsxd rsi, dword ptr [rip+g1890]
+  movsx rdi, word ptr [rip+g3187]
+  add rsi, rdi
+  mov dword ptr [rip+g9], esi
+  movsxd rsi, dword ptr [rip+g0]
+  mov rax, rsi
+.L.return.u0:
+  ret
+.text
+.p2align 4
+.global u1
+u1:
+  movsx rsi, word ptr [rip+g2532]
+  movsx rdi, byte ptr [rip+g3341]
+  add rsi, rdi
+  mov qword ptr [rip+g10], rsi
+  movsx rsi, word ptr [rip+g3788]
+  movsx rdi, word ptr [rip+g3642]
+  add rsi, rdi
+  mov dword ptr [rip+g11], esi
+  mov rsi, qword ptr [rip+g3225]
+  movsx rdi, word ptr [rip+g2327]
+  add rsi, rdi
+  mov byte ptr [rip+g12], sil
+  movsx rsi, byte ptr [rip+g4013]
+  movsx rdi, byte ptr [rip+g2696]
+  add rsi, rdi
+  mov byte ptr [rip+g13], sil
+  movsxd rsi, dword ptr [rip+g832]
+  add rsi, qword ptr [rip+g2335]
+  mov dword ptr [rip+g14], esi
+  movsx rsi, byte ptr [rip+g3172]
+  add rsi, qword ptr [rip+g4263]
+  mov byte ptr [rip+g15], sil
+  movsx rsi, word ptr [rip+g2017]
+  movsx rdi, byte ptr [rip+g75]
+  add rsi, rdi
+  mov dword ptr [rip+g16], esi
+  movsx rsi, word ptr [rip+g2598]
+  add rsi, qword ptr [rip+g2661]
+  mov qword ptr [rip+g17], rsi
+  mov rsi, qword ptr [rip+g3565]
+  add rsi, qword ptr [rip+g81]
+  mov byte ptr [rip+g18], sil
+  movsx rsi, word ptr [rip+g2099]
+  movsx rdi, byte ptr [rip+g3686]
+  add rsi, rdi
+  mov word ptr [rip+g19], si
+  mov rax, qword ptr [rip+g10]
+.L.return.u1:
+  ret
+.text
+.p2align 4
+.global u2
+u2:
+  movsx rsi, word ptr [rip+g1177]
+  add rsi, qword ptr [rip+g3063]
+  mov qword ptr [rip+g20], rsi
+  movsx rsi, word ptr [rip+g844]
+  movsx rdi, word ptr [rip+g315]
+  add rsi, rdi
+  mov word ptr [rip+g21], si
+  movsxd rsi, dword ptr [rip+g4499]
+  movsx rdi, word ptr [rip+g3835]
+  add rsi, rdi
+  mov dword ptr [rip+g22], esi
+  movsx rsi, byte ptr [rip+g2804]
+  add rsi, qword ptr [rip+g4723]
+  mov dword ptr [rip+g23], esi
+  movsx rsi, byte ptr [rip+g1192]
+  movsxd rdi, dword ptr [rip+g3459]
+  add rsi, rdi
+  mov word ptr [rip+g24], si
+  movsx rsi, byte ptr [rip+g4878]
+  movsx rdi, word ptr [rip+g1116]
+  add rsi, rdi
+  mov byte ptr [rip+g25], sil
+  movsx rsi, byte ptr [rip+g263]
+  movsx rdi, byte ptr [rip+g2101]
+  add rsi, rdi
+  mov byte ptr [rip+g26], sil
+  movsx rsi, byte ptr [rip+g2302]
+  movsx rdi, word ptr [rip+g1738]
+  add rsi, rdi
+  mov byte ptr [rip+g27], sil
+  movsxd rsi, dword ptr [rip+g2350]
+  add rsi, qword ptr [rip+g250]
+  mov word ptr [rip+g28], si
+  mov rsi, qword ptr [rip+g4504]
+  movsx rdi, byte ptr [rip+g2527]
+  add rsi, rdi
+  mov byte ptr [rip+g29], sil
+  mov rax, qword ptr [rip+g20]
+.L.return.u2:
+  ret
+.text
+.p2align 4
+.global u3
+u3:
+  movsxd rsi, dword ptr [rip+g3831]
+  movsxd rdi, dword ptr [rip+g4537]
+  add rsi, rdi
+  mov qword ptr [rip+g30], rsi
+  movsx rsi, byte ptr [rip+g2093]
+  movsxd rdi, dword ptr [rip+g4174]
+  add rsi, rdi
+  mov dword ptr [rip+g31], esi
+  mov rsi, qword ptr [rip+g2388]
+  add rsi, qword ptr [rip+g3576]
+  mov byte ptr [rip+g32], sil
+  movsxd rsi, dword ptr [rip+g2730]
+  add rsi, qword ptr [rip+g2221]
+  mov word ptr [rip+g33], si
+  movsx rsi, byte ptr [rip+g3403]
+  add rsi, qword ptr [rip+g4594]
+  mov dword ptr [rip+g34], esi
+  movsxd rsi, dword ptr [rip+g1338]
+  add rsi, qword ptr [rip+g362]
+  mov dword ptr [rip+g35], esi
+  mov rsi, qword ptr [rip+g4856]
+  movsx rdi, byte ptr [rip+g3085]
+  add rsi, rdi
+  mov dword ptr [rip+g36], esi
+  movsx rsi, word ptr [rip+g2799]
+  add rsi, qword ptr [rip+g1646]
+  mov dword ptr [rip+g37], esi
+  movsx rsi, byte ptr [rip+g1313]
+  add rsi, qword ptr [rip+g316]
+  mov byte ptr [rip+g38], sil
+  movsxd rsi, dword ptr [rip+g1891]
+  movsx rdi, word ptr [rip+g2785]
+  add rsi, rdi
+  mov word ptr [rip+g39], si
+  mov rax, qword ptr [rip+g30]
+.L.return.u3:
+  ret
+.text
+.p2align 4
+.global u4
+u4:
+  movsx rsi, word ptr [rip+g1956]
+  movsx rdi, word ptr [rip+g770]
+  add rsi, rdi
+  mov qword ptr [rip+g40], rsi
+  movsx rsi, word ptr [rip+g2156]
+  movsx rdi, word ptr [rip+g1813]
+  add rsi, rdi
+  mov byte ptr [rip+g41], sil
+  mov rsi, qword ptr [rip+g4377]
+  movsx rdi, byte ptr [rip+g3589]
+  add rsi, rdi
+  mov dword ptr [rip+g42], esi
+  movsx rsi, word ptr [rip+g2989]
+  movsx rdi, word ptr [rip+g2583]
+  add rsi, rdi
+  mov byte ptr [rip+g43], sil
+  movsxd rsi, dword ptr [rip+g170]
+  movsxd rdi, dword ptr [rip+g2934]
+  add rsi, rdi
+  mov word ptr [rip+g44], si
+  mov rsi, qword ptr [rip+g701]
+  add rsi, qword ptr [rip+g1776]
+  mov dword ptr [rip+g45], esi
+  movsx rsi, byte ptr [rip+g1037]
+  movsxd rdi, dword ptr [rip+g4349]
+  add rsi, rdi
+  mov byte ptr [rip+g46], sil
+  movsxd rsi, dword ptr [rip+g3418]
+  movsx rdi, word ptr [rip+g212]
+  add rsi, rdi
+  mov word ptr [rip+g47], si
+  movsxd rsi, dword ptr [rip+g1259]
+  movsx rdi, byte ptr [rip+g2279]
+  add rsi, rdi
+  mov qword ptr [rip+g48], rsi
+  movsxd rsi, dword ptr [rip+g3527]
+  movsx rdi, word ptr [rip+g2999]
+  add rsi, rdi
+  mov dword ptr [rip+g49], esi
+  mov rax, qword ptr [rip+g40]
+.L.return.u4:
+  ret
+.text
+.p2align 4
+.global u5
+u5:
+  movsxd rsi, dword ptr [rip+g2995]
+  movsx rdi, byte ptr [rip+g3472]
+  add rsi, rdi
+  mov dword ptr [rip+g50], esi
+  movsxd rsi, dword ptr [rip+g4578]
+  movsx rdi, byte ptr [rip+g902]
+  add rsi, rdi
+  mov byte ptr [rip+g51], sil
+  mov rsi, qword ptr [rip+g2023]
+  movsxd rdi, dword ptr [rip+g2401]
+  add rsi, rdi
+  mov byte ptr [rip+g52], sil
+  movsx rsi, byte ptr [rip+g2797]
+  add rsi, qword ptr [rip+g4278]
+  mov dword ptr [rip+g53], esi
+  movsx rsi, byte ptr [rip+g3754]
+  movsx rdi, word ptr [rip+g1959]
+  add rsi, rdi
+  mov word ptr [rip+g54], si
+  mov rsi, qword ptr [rip+g4563]
+  add rsi, qword ptr [rip+g861]
+  mov byte ptr [rip+g55], sil
+  movsxd rsi, dword ptr [rip+g184]
+  movsxd rdi, dword ptr [rip+g4956]
+  add rsi, rdi
+  mov dword ptr [rip+g56], esi
+  movsx rsi, byte ptr [rip+g62]
+  movsxd rdi, dword ptr [rip+g4180]
+  add rsi, rdi
+  mov qword ptr [rip+g57], rsi
+  mov rsi, qword ptr [rip+g1388]
+  movsxd rdi, dword ptr [rip+g1431]
+  add rsi, rdi
+  mov qword ptr [rip+g58], rsi
+  movsxd rsi, dword ptr [rip+g3713]
+  movsx rdi, word ptr [rip+g4812]
+  add rsi, rdi
+  mov dword ptr [rip+g59], esi
+  movsxd rsi, dword ptr [rip+g50]
+  mov rax, rsi
+.L.return.u5:
+  ret
+.text
+.p2align 4
+.global u6
+u6:
+  mov rsi, qword ptr [rip+g4256]
+  movsx rdi, byte ptr [rip+g4161]
+  add rsi, rdi
+  mov word ptr [rip+g60], si
+  movsxd rsi, dword ptr [rip+g4064]
+  movsxd rdi, dword ptr [rip+g2853]
+  add rsi, rdi
+  mov dword ptr [rip+g61], esi
+  movsx rsi, word ptr [rip+g1419]
+  movsx rdi, byte ptr [rip+g3321]
+  add rsi, rdi
+  mov byte ptr [rip+g62], sil
+  movsx rsi, word ptr [rip+g965]
+  movsx rdi, byte ptr [rip+g109]
+  add rsi, rdi
+  mov word ptr [rip+g63], si
+  mov rsi, qword ptr [rip+g1444]
+  movsx rdi, word ptr [rip+g3766]
+  add rsi, rdi
+  mov qword ptr [rip+g64], rsi
+  movsx rsi, word ptr [rip+g2967]
+  movsx rdi, word ptr [rip+g3186]
+  add rsi, rdi
+  mov qword ptr [rip+g65], rsi
+  movsxd rsi, dword ptr [rip+g2005]
+  movsx rdi, word ptr [rip+g225]
+  add rsi, rdi
+  mov qword ptr [rip+g66], rsi
+  movsx rsi, word ptr [rip+g800]
+  movsx rdi, byte ptr [rip+g4676]
+  add rsi, rdi
+  mov byte ptr [rip+g67], sil
+  movsx rsi, word ptr [rip+g3011]
+  movsx rdi, word ptr [rip+g2789]
+  add rsi, rdi
+  mov dword ptr [rip+g68], esi
+  movsx rsi, byte ptr [rip+g2346]
+  add rsi, qword ptr [rip+g5]
+  mov qword ptr [rip+g69], rsi
+  movsx rsi, word ptr [rip+g60]
+  mov rax, rsi
+.L.return.u6:
+  ret
+.text
+.p2align 4
+.global u7
+u7:
+  movsx rsi, word ptr [rip+g3160]
+  add rsi, qword ptr [rip+g1749]
+  mov dword ptr [rip+g70], esi
+  movsx rsi, byte ptr [rip+g4808]
+  movsx rdi, word ptr [rip+g1655]
+  add rsi, rdi
+  mov word ptr [rip+g71], si
+  movsx rsi, byte ptr [rip+g663]
+  movsxd rdi, dword ptr [rip+g1292]
+  add rsi, rdi
+  mov word ptr [rip+g72], si
+  movsxd rsi, dword ptr [rip+g2628]
+  movsx rdi, word ptr [rip+g1852]
+  add rsi, rdi
+  mov byte ptr [rip+g73], sil
+  mov rsi, qword ptr [rip+g2444]
+  movsx rdi, byte ptr [rip+g3647]
+  add rsi, rdi
+  mov qword ptr [rip+g74], rsi
+  mov rsi, qword ptr [rip+g4920]
+  movsx rdi, byte ptr [rip+g393]
+  add rsi, rdi
+  mov byte ptr [rip+g75], sil
+  movsx rsi, word ptr [rip+g291]
+  movsx rdi, byte ptr [rip+g3321]
+  add rsi, rdi
+  mov word ptr [rip+g76], si
+  movsxd rsi, dword ptr [rip+g3025]
+  movsx rdi, byte ptr [rip+g1713]
+  add rsi, rdi
+  mov dword ptr [rip+g77], esi
+  mov rsi, qword ptr [rip+g4998]
+  movsx rdi, word ptr [rip+g3616]
+  add rsi, rdi
+  mov qword ptr [rip+g78], rsi
+  movsxd rsi, dword ptr [rip+g1944]
+  movsx rdi, word ptr [rip+g4176]
+  add rsi, rdi
+  mov word ptr [rip+g79], si
+  movsxd rsi, dword ptr [rip+g70]
+  mov rax, rsi
+.L.return.u7:
+  ret
+.text
+.p2align 4
+.global u8
+u8:
+  movsxd rsi, dword ptr [rip+g3629]
+  movsx rdi, byte ptr [rip+g51]
+  add rsi, rdi
+  mov word ptr [rip+g80], si
+  movsxd rsi, dword ptr [rip+g554]
+  movsx rdi, byte ptr [rip+g1266]
+  add rsi, rdi
+  mov qword ptr [rip+g81], rsi
+  mov rsi, qword ptr [rip+g1923]
+  movsx rdi, byte ptr [rip+g4459]
+  add rsi, rdi
+  mov qword ptr [rip+g82], rsi
+  movsx rsi, word ptr [rip+g2678]
+  add rsi, qword ptr [rip+g4957]
+  mov dword ptr [rip+g83], esi
+  movsx rsi, word ptr [rip+g4205]
+  movsxd rdi, dword ptr [rip+g1532]
+  add rsi, rdi
+  mov dword ptr [rip+g84], esi
+  movsx rsi, byte ptr [rip+g4771]
+  movsx rdi, byte ptr [rip+g931]
+  add rsi, rdi
+  mov word ptr [rip+g85], si
+  mov rsi, qword ptr [rip+g139]
+  add rsi, qword ptr [rip+g3201]
+  mov byte ptr [rip+g86], sil
+  movsxd rsi, dword ptr [rip+g2983]
+  movsx rdi, byte ptr [rip+g4129]
+  add rsi, rdi
+  mov qword ptr [rip+g87], rsi
+  movsx rsi, byte ptr [rip+g4328]
+  add rsi, qword ptr [rip+g3121]
+  mov byte ptr [rip+g88], sil
+  movsxd rsi, dword ptr [rip+g4020]
+  movsx rdi, word ptr [rip+g1971]
+  add rsi, rdi
+  mov dword ptr [rip+g89], esi
+  movsx rsi, word ptr [rip+g80]
+  mov rax, rsi
+.L.return.u8:
+  ret
+.text
+.p2align 4
+.global u9
+u9:
+  movsxd rsi, dword ptr [rip+g240]
+  movsxd rdi, dword ptr [rip+g1564]
+  add rsi, rdi
+  mov dword ptr [rip+g90], esi
+  mov rsi, qword ptr [rip+g3682]
+  add rsi, qword ptr [rip+g1973]
+  mov byte ptr [rip+g91], sil
+  mov rsi, qword ptr [rip+g1367]
+  movsx rdi, word ptr [rip+g1099]
+  add rsi, rdi
+  mov qword ptr [rip+g92], rsi
+  movsx rsi, word ptr [rip+g3490]
+  movsx rdi, word ptr [rip+g2636]
+  add rsi, rdi
+  mov dword ptr [rip+g93], esi
+  mov rsi, qword ptr [rip+g1342]
+  add rsi, qword ptr [rip+g245]
+  mov word ptr [rip+g94], si
+  mov rsi, qword ptr [rip+g4089]
+  movsx rdi, byte ptr [rip+g1873]
+  add rsi, rdi
+  mov dword ptr [rip+g95], esi
+  movsxd rsi, dword ptr [rip+g3771]
+  movsx rdi, byte ptr [rip+g2978]
+  add rsi, rdi
+  mov word ptr [rip+g96], si
+  movsxd rsi, dword ptr [rip+g734]
+  movsx rdi, word ptr [rip+g153]
+  add rsi, rdi
+  mov byte ptr [rip+g97], sil
+  movsx rsi, word ptr [rip+g3202]
+  movsxd rdi, dword ptr [rip+g1178]
+  add rsi, rdi
+  mov qword ptr [rip+g98], rsi
+  mov rsi, qword ptr [rip+g3822]
+  add rsi, qword ptr [rip+g1677]
+  mov byte ptr [rip+g99], sil
+  movsxd rsi, dword ptr [rip+g90]
+  mov rax, rsi
+.L.return.u9:
+  ret
+.text
+.p2align 4
+.global u10
+u10:
+  movsx rsi, word ptr [rip+g1334]
+  movsxd rdi, dword ptr [rip+g3527]
+  add rsi, rdi
+  mov word ptr [rip+g100], si
+  mov rsi, qword ptr [rip+g3557]
+  add rsi, qword ptr [rip+g4633]
+  mov byte ptr [rip+g101], sil
+  movsx rsi, byte ptr [rip+g874]
+  movsxd rdi, dword ptr [rip+g1259]
+  add rsi, rdi
+  mov dword ptr [rip+g102], esi
+  mov rsi, qword ptr [rip+g3850]
+  movsx rdi, byte ptr [rip+g4060]
+  add rsi, rdi
+  mov dword ptr [rip+g103], esi
+  movsx rsi, word ptr [rip+g1325]
+  movsx rdi, word ptr [rip+g426]
+  add rsi, rdi
+  mov dword ptr [rip+g104], esi
+  mov rsi, qword ptr [rip+g1859]
+  movsxd rdi, dword ptr [rip+g1881]
+  add rsi, rdi
+  mov word ptr [rip+g105], si
+  mov rsi, qword ptr [rip+g179]
+  add rsi, qword ptr [rip+g410]
+  mov byte ptr [rip+g106], sil
+  movsx rsi, word ptr [rip+g1854]
+  movsx rdi, byte ptr [rip+g2564]
+  add rsi, rdi
+  mov qword ptr [rip+g107], rsi
+  movsxd rsi, dword ptr [rip+g2895]
+  movsx rdi, word ptr [rip+g4898]
+  add rsi, rdi
+  mov dword ptr [rip+g108], esi
+  mov rsi, qword ptr [rip+g3937]
+  movsxd rdi, dword ptr [rip+g2304]
+  add rsi, rdi
+  mov byte ptr [rip+g109], sil
+  movsx rsi, word ptr [rip+g100]
+  mov rax, rsi
+.L.return.u10:
+  ret
+.text
+.p2align 4
+.global u11
+u11:
+  movsx rsi, byte ptr [rip+g3203]
+  add rsi, qword ptr [rip+g3389]
+  mov dword ptr [rip+g110], esi
+  movsx rsi, word ptr [rip+g2942]
+  add rsi, qword ptr [rip+g466]
+  mov byte ptr [rip+g111], sil
+  movsxd rsi, dword ptr [rip+g2755]
+  movsxd rdi, dword ptr [rip+g4198]
+  add rsi, rdi
+  mov qword ptr [rip+g112], rsi
+  movsx rsi, byte ptr [rip+g2416]
+  add rsi, qword ptr [rip+g3800]
+  mov word ptr [rip+g113], si
+  movsxd rsi, dword ptr [rip+g1070]
+  add rsi, qword ptr [rip+g4230]
+  mov word ptr [rip+g114], si
+  mov rsi, qword ptr [rip+g1032]
+  movsx rdi, word ptr [rip+g1540]
+  add rsi, rdi
+  mov word ptr [rip+g115], si
+  movsxd rsi, dword ptr [rip+g4950]
+  movsxd rdi, dword ptr [rip+g927]
+  add rsi, rdi
+  mov qword ptr [rip+g116], rsi
+  mov rsi, qword ptr [rip+g1401]
+  movsx rdi, word ptr [rip+g783]
+  add rsi, rdi
+  mov byte ptr [rip+g117], sil
+  movsx rsi, byte ptr [rip+g4057]
+  movsx rdi, word ptr [rip+g3616]
+  add rsi, rdi
+  mov word ptr [rip+g118], si
+  movsx rsi, byte ptr [rip+g4901]
+  movsx rdi, byte ptr [rip+g3483]
+  add rsi, rdi
+  mov byte ptr [rip+g119], sil
+  movsxd rsi, dword ptr [rip+g110]
+  mov rax, rsi
+.L.return.u11:
+  ret
+.text
+.p2align 4
+.global u12
+u12:
+  movsx rsi, byte ptr [rip+g3754]
+  movsx rdi, byte ptr [rip+g288]
+  add rsi, rdi
+  mov dword ptr [rip+g120], esi
+  mov rsi, qword ptr [rip+g2993]
+  movsxd rdi, dword ptr [rip+g3813]
+  add rsi, rdi
+  mov byte ptr [rip+g121], sil
+  movsx rsi, byte ptr [rip+g565]
+  movsx rdi, byte ptr [rip+g1019]
+  add rsi, rdi
+  mov qword ptr [rip+g122], rsi
+  movsx rsi, byte ptr [rip+g2817]
+  movsx rdi, word ptr [rip+g4595]
+  add rsi, rdi
+  mov word ptr [rip+g123], si
+  movsx rsi, byte ptr [rip+g3086]
+  movsx rdi, word ptr [rip+g2838]
+  add rsi, rdi
+  mov qword ptr [rip+g124], rsi
+  movsxd rsi, dword ptr [rip+g203]
+  movsx rdi, byte ptr [rip+g2641]
+  add rsi, rdi
+  mov word ptr [rip+g125], si
+  movsx rsi, word ptr [rip+g777]
+  movsx rdi, word ptr [rip+g2598]
+  add rsi, rdi
+  mov dword ptr [rip+g126], esi
+  movsx rsi, word ptr [rip+g4927]
+  movsx rdi, word ptr [rip+g3914]
+  add rsi, rdi
+  mov byte ptr [rip+g127], sil
+  mov rsi, qword ptr [rip+g842]
+  movsx rdi, word ptr [rip+g2999]
+  add rsi, rdi
+  mov dword ptr [rip+g128], esi
+  mov rsi, qword ptr [rip+g4886]
+  movsx rdi, word ptr [rip+g2594]
+  add rsi, rdi
+  mov byte ptr [rip+g129], sil
+  movsxd rsi, dword ptr [rip+g120]
+  mov rax, rsi
+.L.return.u12:
+  ret
+.text
+.p2align 4
+.global u13
+u13:
+  mov rsi, qword ptr [rip+g2723]
+  add rsi, qword ptr [rip+g808]
+  mov byte ptr [rip+g130], sil
+  movsx rsi, byte ptr [rip+g209]
+  add rsi, qword ptr [rip+g678]
+  mov word ptr [rip+g131], si
+  movsx rsi, byte ptr [rip+g3544]
+  movsx rdi, byte ptr [rip+g4160]
+  add rsi, rdi
+  mov byte ptr [rip+g132], sil
+  movsx rsi, byte ptr [rip+g1594]
+  add rsi, qword ptr [rip+g2670]
+  mov qword ptr [rip+g133], rsi
+  movsx rsi, byte ptr [rip+g4968]
+  add rsi, qword ptr [rip+g1299]
+  mov dword ptr [rip+g134], esi
+  movsx rsi, byte ptr [rip+g4408]
+  movsx rdi, byte ptr [rip+g2475]
+  add rsi, rdi
+  mov dword ptr [rip+g135], esi
+  movsx rsi, byte ptr [rip+g251]
+  add rsi, qword ptr [rip+g856]
+  mov dword ptr [rip+g136], esi
+  movsx rsi, byte ptr [rip+g4247]
+  movsx rdi, byte ptr [rip+g4733]
+  add rsi, rdi
+  mov qword ptr [rip+g137], rsi
+  movsx rsi, word ptr [rip+g806]
+  movsx rdi, word ptr [rip+g4046]
+  add rsi, rdi
+  mov qword ptr [rip+g138], rsi
+  movsx rsi, word ptr [rip+g930]
+  movsx rdi, word ptr [rip+g912]
+  add rsi, rdi
+  mov qword ptr [rip+g139], rsi
+  movsx rsi, byte ptr [rip+g130]
+  mov rax, rsi
+.L.return.u13:
+  ret
+.text
+.p2align 4
+.global u14
+u14:
+  mov rsi, qword ptr [rip+g2182]
+  movsx rdi, byte ptr [rip+g4663]
+  add rsi, rdi
+  mov dword ptr [rip+g140], esi
+  movsx rsi, byte ptr [rip+g3537]
+  movsx rdi, word ptr [rip+g1584]
+  add rsi, rdi
+  mov byte ptr [rip+g141], sil
+  mov rsi, qword ptr [rip+g3469]
+  movsxd rdi, dword ptr [rip+g3009]
+  add rsi, rdi
+  mov dword ptr [rip+g142], esi
+  movsxd rsi, dword ptr [rip+g3029]
+  movsx rdi, byte ptr [rip+g3687]
+  add rsi, rdi
+  mov word ptr [rip+g143], si
+  movsx rsi, word ptr [rip+g1875]
+  movsx rdi, word ptr [rip+g1440]
+  add rsi, rdi
+  mov word ptr [rip+g144], si
+  movsxd rsi, dword ptr [rip+g3049]
+  movsx rdi, word ptr [rip+g889]
+  add rsi, rdi
+  mov word ptr [rip+g145], si
+  movsx rsi, byte ptr [rip+g3341]
+  movsx rdi, byte ptr [rip+g722]
+  add rsi, rdi
+  mov byte ptr [rip+g146], sil
+  movsx rsi, byte ptr [rip+g4556]
+  movsx rdi, word ptr [rip+g2078]
+  add rsi, rdi
+  mov dword ptr [rip+g147], esi
+  mov rsi, qword ptr [rip+g2152]
+  movsx rdi, word ptr [rip+g4043]
+  add rsi, rdi
+  mov qword ptr [rip+g148], rsi
+  movsxd rsi, dword ptr [rip+g1411]
+  movsxd rdi, dword ptr [rip+g4650]
+  add rsi, rdi
+  mov dword ptr [rip+g149], esi
+  movsxd rsi, dword ptr [rip+g140]
+  mov rax, rsi
+.L.return.u14:
+  ret
+.text
+.p2align 4
+.global u15
+u15:
+  movsx rsi, byte ptr [rip+g3727]
+  movsx rdi, word ptr [rip+g4799]
+  add rsi, rdi
+  mov word ptr [rip+g150], si
+  movsx rsi, byte ptr [rip+g2546]
+  add rsi, qword ptr [rip+g4470]
+  mov word ptr [rip+g151], si
+  movsxd rsi, dword ptr [rip+g3865]
+  movsx rdi, byte ptr [rip+g4341]
+  add rsi, rdi
+  mov word ptr [rip+g152], si
+  movsxd rsi, dword ptr [rip+g1029]
+  movsx rdi, byte ptr [rip+g4771]
+  add rsi, rdi
+  mov word ptr [rip+g153], si
+  movsx rsi, word ptr [rip+g1801]
+  movsxd rdi, dword ptr [rip+g1292]
+  add rsi, rdi
+  mov dword ptr [rip+g154], esi
+  mov rsi, qword ptr [rip+g3021]
+  movsx rdi, byte ptr [rip+g1251]
+  add rsi, rdi
+  mov word ptr [rip+g155], si
+  movsxd rsi, dword ptr [rip+g3008]
+  movsxd rdi, dword ptr [rip+g4672]
+  add rsi, rdi
+  mov word ptr [rip+g156], si
+  movsxd rsi, dword ptr [rip+g2469]
+  add rsi, qword ptr [rip+g1024]
+  mov word ptr [rip+g157], si
+  movsxd rsi, dword ptr [rip+g2963]
+  movsx rdi, word ptr [rip+g4609]
+  add rsi, rdi
+  mov dword ptr [rip+g158], esi
+  mov rsi, qword ptr [rip+g1024]
+  movsx rdi, word ptr [rip+g4792]
+  add rsi, rdi
+  mov qword ptr [rip+g159], rsi
+  movsx rsi, word ptr [rip+g150]
+  mov rax, rsi
+.L.return.u15:
+  ret
+.text
+.p2align 4
+.global u16
+u16:
+  mov rsi, qword ptr [rip+g1577]
+  movsx rdi, byte ptr [rip+g1762]
+  add rsi, rdi
+  mov byte ptr [rip+g160], sil
+  mov rsi, qword ptr [rip+g4283]
+  movsx rdi, word ptr [rip+g1659]
+  add rsi, rdi
+  mov word ptr [rip+g161], si
+  movsx rsi, byte ptr [rip+g3826]
+  movsxd rdi, dword ptr [rip+g3933]
+  add rsi, rdi
+  mov dword ptr [rip+g162], esi
+  movsx rsi, byte ptr [rip+g2346]
+  add rsi, qword ptr [rip+g3714]
+  mov dword ptr [rip+g163], esi
+  mov rsi, qword ptr [rip+g4479]
+  movsxd rdi, dword ptr [rip+g1215]
+  add rsi, rdi
+  mov dword ptr [rip+g164], esi
+  movsxd rsi, dword ptr [rip+g2682]
+  add rsi, qword ptr [rip+g1114]
+  mov word ptr [rip+g165], si
+  movsxd rsi, dword ptr [rip+g636]
+  movsx rdi, word ptr [rip+g2775]
+  add rsi, rdi
+  mov dword ptr [rip+g166], esi
+  mov rsi, qword ptr [rip+g310]
+  add rsi, qword ptr [rip+g4154]
+  mov qword ptr [rip+g167], rsi
+  movsx rsi, word ptr [rip+g4953]
+  movsx rdi, word ptr [rip+g1611]
+  add rsi, rdi
+  mov word ptr [rip+g168], si
+  movsx rsi, word ptr [rip+g4245]
+  movsx rdi, byte ptr [rip+g1154]
+  add rsi, rdi
+  mov word ptr [rip+g169], si
+  movsx rsi, byte ptr [rip+g160]
+  mov rax, rsi
+.L.return.u16:
+  ret
+.text
+.p2align 4
+.global u17
+u17:
+  mov rsi, qword ptr [rip+g4710]
+  movsx rdi, word ptr [rip+g4019]
+  add rsi, rdi
+  mov dword ptr [rip+g170], esi
+  movsx rsi, word ptr [rip+g3170]
+  movsx rdi, word ptr [rip+g157]
+  add rsi, rdi
+  mov word ptr [rip+g171], si
+  mov rsi, qword ptr [rip+g1696]
+  movsx rdi, byte ptr [rip+g1123]
+  add rsi, rdi
+  mov byte ptr [rip+g172], sil
+  movsx rsi, byte ptr [rip+g4257]
+  add rsi, qword ptr [rip+g416]
+  mov byte ptr [rip+g173], sil
+  movsx rsi, word ptr [rip+g2457]
+  movsxd rdi, dword ptr [rip+g506]
+  add rsi, rdi
+  mov word ptr [rip+g174], si
+  movsx rsi, byte ptr [rip+g2411]
+  movsxd rdi, dword ptr [rip+g4852]
+  add rsi, rdi
+  mov dword ptr [rip+g175], esi
+  movsx rsi, word ptr [rip+g1867]
+  movsx rdi, word ptr [rip+g2353]
+  add rsi, rdi
+  mov byte ptr [rip+g176], sil
+  movsx rsi, word ptr [rip+g4930]
+  movsx rdi, word ptr [rip+g2791]
+  add rsi, rdi
+  mov word ptr [rip+g177], si
+  movsxd rsi, dword ptr [rip+g420]
+  movsx rdi, word ptr [rip+g213]
+  add rsi, rdi
+  mov qword ptr [rip+g178], rsi
+  mov rsi, qword ptr [rip+g246]
+  movsx rdi, word ptr [rip+g2906]
+  add rsi, rdi
+  mov qword ptr [rip+g179], rsi
+  movsxd rsi, dword ptr [rip+g170]
+  mov rax, rsi
+.L.return.u17:
+  ret
+.text
+.p2align 4
+.global u18
+u18:
+  movsx rsi, word ptr [rip+g2047]
+  movsx rdi, byte ptr [rip+g4199]
+  add rsi, rdi
+  mov word ptr [rip+g180], si
+  movsx rsi, word ptr [rip+g1253]
+  movsxd rdi, dword ptr [rip+g2511]
+  add rsi, rdi
+  mov byte ptr [rip+g181], sil
+  mov rsi, qword ptr [rip+g364]
+  movsxd rdi, dword ptr [rip+g4303]
+  add rsi, rdi
+  mov word ptr [rip+g182], si
+  movsxd rsi, dword ptr [rip+g937]
+  add rsi, qword ptr [rip+g3314]
+  mov word ptr [rip+g183], si
+  movsx rsi, byte ptr [rip+g534]
+  movsxd rdi, dword ptr [rip+g4179]
+  add rsi, rdi
+  mov dword ptr [rip+g184], esi
+  mov rsi, qword ptr [rip+g1458]
+  movsx rdi, word ptr [rip+g2170]
+  add rsi, rdi
+  mov dword ptr [rip+g185], esi
+  movsx rsi, word ptr [rip+g4402]
+  add rsi, qword ptr [rip+g1232]
+  mov dword ptr [rip+g186], esi
+  movsx rsi, byte ptr [rip+g3524]
+  movsx rdi, word ptr [rip+g94]
+  add rsi, rdi
+  mov qword ptr [rip+g187], rsi
+  mov rsi, qword ptr [rip+g4207]
+  movsx rdi, byte ptr [rip+g4005]
+  add rsi, rdi
+  mov word ptr [rip+g188], si
+  movsx rsi, word ptr [rip+g1168]
+  movsxd rdi, dword ptr [rip+g7]
+  add rsi, rdi
+  mov dword ptr [rip+g189], esi
+  movsx rsi, word ptr [rip+g180]
+  mov rax, rsi
+.L.return.u18:
+  ret
+.text
+.p2align 4
+.global u19
+u19:
+  movsxd rsi, dword ptr [rip+g3288]
+  movsx rdi, word ptr [rip+g2121]
+  add rsi, rdi
+  mov byte ptr [rip+g190], sil
+  mov rsi, qword ptr [rip+g3217]
+  movsx rdi, byte ptr [rip+g4853]
+  add rsi, rdi
+  mov word ptr [rip+g191], si
+  mov rsi, qword ptr [rip+g4713]
+  add rsi, qword ptr [rip+g124]
+  mov byte ptr [rip+g192], sil
+  mov rsi, qword ptr [rip+g767]
+  movsx rdi, word ptr [rip+g4516]
+  add rsi, rdi
+  mov dword ptr [rip+g193], esi
+  movsx rsi, byte ptr [rip+g2596]
+  movsx rdi, byte ptr [rip+g2694]
+  add rsi, rdi
+  mov byte ptr [rip+g194], sil
+  movsx rsi, byte ptr [rip+g2355]
+  movsxd rdi, dword ptr [rip+g1078]
+  add rsi, rdi
+  mov word ptr [rip+g195], si
+  movsx rsi, byte ptr [rip+g4690]
+  add rsi, qword ptr [rip+g1712]
+  mov byte ptr [rip+g196], sil
+  mov rsi, qword ptr [rip+g1818]
+  movsxd rdi, dword ptr [rip+g1588]
+  add rsi, rdi
+  mov word ptr [rip+g197], si
+  movsx rsi, word ptr [rip+g44]
+  movsxd rdi, dword ptr [rip+g1590]
+  add rsi, rdi
+  mov byte ptr [rip+g198], sil
+  movsxd rsi, dword ptr [rip+g390]
+  movsx rdi, word ptr [rip+g144]
+  add rsi, rdi
+  mov word ptr [rip+g199], si
+  movsx rsi, byte ptr [rip+g190]
+  mov rax, rsi
+.L.return.u19:
+  ret
+.text
+.p2align 4
+.global u20
+u20:
+  movsxd rsi, dword ptr [rip+g2298]
+  movsxd rdi, dword ptr [rip+g4592]
+  add rsi, rdi
+  mov word ptr [rip+g200], si
+  movsx rsi, byte ptr [rip+g1395]
+  movsx rdi, byte ptr [rip+g1983]
+  add rsi, rdi
+  mov byte ptr [rip+g201], sil
+  movsx rsi, word ptr [rip+g4576]
+  add rsi, qword ptr [rip+g4052]
+  mov dword ptr [rip+g202], esi
+  mov rsi, qword ptr [rip+g4720]
+  add rsi, qword ptr [rip+g2800]
+  mov dword ptr [rip+g203], esi
+  movsx rsi, byte ptr [rip+g4989]
+  add rsi, qword ptr [rip+g2481]
+  mov dword ptr [rip+g204], esi
+  mov rsi, qword ptr [rip+g1895]
+  movsx rdi, byte ptr [rip+g3443]
+  add rsi, rdi
+  mov qword ptr [rip+g205], rsi
+  movsx rsi, word ptr [rip+g3090]
+  movsxd rdi, dword ptr [rip+g2350]
+  add rsi, rdi
+  mov dword ptr [rip+g206], esi
+  mov rsi, qword ptr [rip+g4359]
+  movsx rdi, word ptr [rip+g768]
+  add rsi, rdi
+  mov word ptr [rip+g207], si
+  movsx rsi, byte ptr [rip+g1406]
+  movsx rdi, word ptr [rip+g3255]
+  add rsi, rdi
+  mov qword ptr [rip+g208], rsi
+  movsx rsi, word ptr [rip+g2332]
+  add rsi, qword ptr [rip+g1457]
+  mov byte ptr [rip+g209], sil
+  movsx rsi, word ptr [rip+g200]
+  mov rax, rsi
+.L.return.u20:
+  ret
+.text
+.p2align 4
+.global u21
+u21:
+  movsx rsi, byte ptr [rip+g4206]
+  add rsi, qword ptr [rip+g98]
+  mov byte ptr [rip+g210], sil
+  movsxd rsi, dword ptr [rip+g543]
+  movsxd rdi, dword ptr [rip+g1038]
+  add rsi, rdi
+  mov word ptr [rip+g211], si
+  movsx rsi, word ptr [rip+g3375]
+  movsx rdi, byte ptr [rip+g4051]
+  add rsi, rdi
+  mov word ptr [rip+g212], si
+  movsx rsi, word ptr [rip+g3279]
+  add rsi, qword ptr [rip+g2142]
+  mov word ptr [rip+g213], si
+  movsxd rsi, dword ptr [rip+g3103]
+  movsx rdi, word ptr [rip+g4254]
+  add rsi, rdi
+  mov dword ptr [rip+g214], esi
+  movsx rsi, byte ptr [rip+g4124]
+  movsxd rdi, dword ptr [rip+g1775]
+  add rsi, rdi
+  mov word ptr [rip+g215], si
+  movsxd rsi, dword ptr [rip+g2171]
+  movsxd rdi, dword ptr [rip+g1479]
+  add rsi, rdi
+  mov byte ptr [rip+g216], sil
+  movsx rsi, byte ptr [rip+g4090]
+  movsx rdi, byte ptr [rip+g1443]
+  add rsi, rdi
+  mov word ptr [rip+g217], si
+  movsx rsi, word ptr [rip+g2673]
+  movsxd rdi, dword ptr [rip+g3394]
+  add rsi, rdi
+  mov dword ptr [rip+g218], esi
+  mov rsi, qword ptr [rip+g2312]
+  movsx rdi, word ptr [rip+g4965]
+  add rsi, rdi
+  mov dword ptr [rip+g219], esi
+  movsx rsi, byte ptr [rip+g210]
+  mov rax, rsi
+.L.return.u21:
+  ret
+.text
+.p2align 4
+.global u22
+u22:
+  movsx rsi, word ptr [rip+g611]
+  movsx rdi, byte ptr [rip+g1947]
+  add rsi, rdi
+  mov byte ptr [rip+g220], sil
+  movsx rsi, byte ptr [rip+g2214]
+  movsx rdi, byte ptr [rip+g3761]
+  add rsi, rdi
+  mov word ptr [rip+g221], si
+  movsx rsi, word ptr [rip+g152]
+  movsx rdi, word ptr [rip+g469]
+  add rsi, rdi
+  mov dword ptr [rip+g222], esi
+  movsx rsi, byte ptr [rip+g3472]
+  movsx rdi, word ptr [rip+g2893]
+  add rsi, rdi
+  mov byte ptr [rip+g223], sil
+  mov rsi, qword ptr [rip+g3748]
+  movsx rdi, word ptr [rip+g3360]
+  add rsi, rdi
+  mov word ptr [rip+g224], si
+  movsx rsi, word ptr [rip+g4550]
+  add rsi, qword ptr [rip+g1090]
+  mov word ptr [rip+g225], si
+  movsx rsi, word ptr [rip+g1999]
+  add rsi, qword ptr [rip+g2722]
+  mov word ptr [rip+g226], si
+  movsx rsi, byte ptr [rip+g1755]
+  add rsi, qword ptr [rip+g3343]
+  mov byte ptr [rip+g227], sil
+  movsxd rsi, dword ptr [rip+g4413]
+  movsx rdi, word ptr [rip+g3639]
+  add rsi, rdi
+  mov qword ptr [rip+g228], rsi
+  mov rsi, qword ptr [rip+g3188]
+  movsx rdi, byte ptr [rip+g3408]
+  add rsi, rdi
+  mov qword ptr [rip+g229], rsi
+  movsx rsi, byte ptr [rip+g220]
+  mov rax, rsi
+.L.return.u22:
+  ret
+.text
+.p2align 4
+.global u23
+u23:
+  movsxd rsi, dword ptr [rip+g4453]
+  movsx rdi, word ptr [rip+g3293]
+  add rsi, rdi
+  mov dword ptr [rip+g230], esi
+  mov rsi, qword ptr [rip+g4826]
+  movsx rdi, word ptr [rip+g2856]
+  add rsi, rdi
+  mov dword ptr [rip+g231], esi
+  movsxd rsi, dword ptr [rip+g222]
+  movsx rdi, word ptr [rip+g975]
+  add rsi, rdi
+  mov word ptr [rip+g232], si
+  mov rsi, qword ptr [rip+g991]
+  movsx rdi, word ptr [rip+g1031]
+  add rsi, rdi
+  mov byte ptr [rip+g233], sil
+  movsx rsi, word ptr [rip+g792]
+  movsx rdi, word ptr [rip+g3820]
+  add rsi, rdi
+  mov dword ptr [rip+g234], esi
+  movsxd rsi, dword ptr [rip+g1494]
+  add rsi, qword ptr [rip+g3572]
+  mov byte ptr [rip+g235], sil
+  movsxd rsi, dword ptr [rip+g4285]
+  movsxd rdi, dword ptr [rip+g4216]
+  add rsi, rdi
+  mov qword ptr [rip+g236], rsi
+  movsx rsi, word ptr [rip+g1004]
+  movsx rdi, word ptr [rip+g919]
+  add rsi, rdi
+  mov qword ptr [rip+g237], rsi
+  movsxd rsi, dword ptr [rip+g2720]
+  add rsi, qword ptr [rip+g672]
+  mov word ptr [rip+g238], si
+  movsx rsi, byte ptr [rip+g3099]
+  movsx rdi, word ptr [rip+g2884]
+  add rsi, rdi
+  mov word ptr [rip+g239], si
+  movsxd rsi, dword ptr [rip+g230]
+  mov rax, rsi
+.L.return.u23:
+  ret
+.text
+.p2align 4
+.global u24
+u24:
+  movsx rsi, byte ptr [rip+g3729]
+  add rsi, qword ptr [rip+g1911]
+  mov dword ptr [rip+g240], esi
+  movsx rsi, byte ptr [rip+g4051]
+  movsx rdi, byte ptr [rip+g4067]
+  add rsi, rdi
+  mov dword ptr [rip+g241], esi
+  movsxd rsi, dword ptr [rip+g452]
+  movsx rdi, word ptr [rip+g2570]
+  add rsi, rdi
+  mov word ptr [rip+g242], si
+  mov rsi, qword ptr [rip+g3763]
+  movsxd rdi, dword ptr [rip+g2535]
+  add rsi, rdi
+  mov qword ptr [rip+g243], rsi
+  movsx rsi, word ptr [rip+g2906]
+  movsxd rdi, dword ptr [rip+g2610]
+  add rsi, rdi
+  mov word ptr [rip+g244], si
+  movsx rsi, word ptr [rip+g4516]
+  add rsi, qword ptr [rip+g1747]
+  mov qword ptr [rip+g245], rsi
+  movsxd rsi, dword ptr [rip+g2015]
+  movsx rdi, byte ptr [rip+g1302]
+  add rsi, rdi
+  mov qword ptr [rip+g246], rsi
+  movsx rsi, byte ptr [rip+g3876]
+  movsx rdi, word ptr [rip+g4025]
+  add rsi, rdi
+  mov qword ptr [rip+g247], rsi
+  mov rsi, qword ptr [rip+g4962]
+  movsxd rdi, dword ptr [rip+g4650]
+  add rsi, rdi
+  mov word ptr [rip+g248], si
+  movsx rsi, word ptr [rip+g1440]
+  add rsi, qword ptr [rip+g1507]
+  mov word ptr [rip+g249], si
+  movsxd rsi, dword ptr [rip+g240]
+  mov rax, rsi
+.L.return.u24:
+  ret
+.text
+.p2align 4
+.global u25
+u25:
+  mov rsi, qword ptr [rip+g312]
+  movsx rdi, word ptr [rip+g878]
+  add rsi, rdi
+  mov qword ptr [rip+g250], rsi
+  movsx rsi, byte ptr [rip+g1295]
+  movsxd rdi, dword ptr [rip+g2342]
+  add rsi, rdi
+  mov byte ptr [rip+g251], sil
+  movsxd rsi, dword ptr [rip+g960]
+  add rsi, qword ptr [rip+g3075]
+  mov word ptr [rip+g252], si
+  movsxd rsi, dword ptr [rip+g969]
+  add rsi, qword ptr [rip+g3469]
+  mov qword ptr [rip+g253], rsi
+  movsxd rsi, dword ptr [rip+g3309]
+  add rsi, qword ptr [rip+g684]
+  mov dword ptr [rip+g254], esi
+  movsxd rsi, dword ptr [rip+g805]
+  add rsi, qword ptr [rip+g3192]
+  mov word ptr [rip+g255], si
+  mov rsi, qword ptr [rip+g416]
+  movsx rdi, word ptr [rip+g3367]
+  add rsi, rdi
+  mov dword ptr [rip+g256], esi
+  movsxd rsi, dword ptr [rip+g3803]
+  add rsi, qword ptr [rip+g4639]
+  mov word ptr [rip+g257], si
+  mov rsi, qword ptr [rip+g521]
+  movsxd rdi, dword ptr [rip+g4591]
+  add rsi, rdi
+  mov qword ptr [rip+g258], rsi
+  movsx rsi, byte ptr [rip+g1810]
+  movsx rdi, byte ptr [rip+g3761]
+  add rsi, rdi
+  mov dword ptr [rip+g259], esi
+  mov rax, qword ptr [rip+g250]
+.L.return.u25:
+  ret
+.text
+.p2align 4
+.global u26
+u26:
+  movsxd rsi, dword ptr [rip+g2687]
+  add rsi, qword ptr [rip+g1366]
+  mov byte ptr [rip+g260], sil
+  movsx rsi, byte ptr [rip+g38]
+  movsx rdi, word ptr [rip+g878]
+  add rsi, rdi
+  mov dword ptr [rip+g261], esi
+  mov rsi, qword ptr [rip+g2712]
+  movsx rdi, byte ptr [rip+g4547]
+  add rsi, rdi
+  mov qword ptr [rip+g262], rsi
+  movsx rsi, word ptr [rip+g930]
+  movsx rdi, word ptr [rip+g3046]
+  add rsi, rdi
+  mov byte ptr [rip+g263], sil
+  movsx rsi, byte ptr [rip+g2823]
+  add rsi, qword ptr [rip+g1163]
+  mov dword ptr [rip+g264], esi
+  movsx rsi, byte ptr [rip+g3377]
+  movsx rdi, byte ptr [rip+g1617]
+  add rsi, rdi
+  mov word ptr [rip+g265], si
+  mov rsi, qword ptr [rip+g2758]
+  movsx rdi, word ptr [rip+g3774]
+  add rsi, rdi
+  mov word ptr [rip+g266], si
+  movsx rsi, byte ptr [rip+g2747]
+  movsxd rdi, dword ptr [rip+g4683]
+  add rsi, rdi
+  mov byte ptr [rip+g267], sil
+  mov rsi, qword ptr [rip+g998]
+  add rsi, qword ptr [rip+g4093]
+  mov word ptr [rip+g268], si
+  movsxd rsi, dword ptr [rip+g4223]
+  movsx rdi, byte ptr [rip+g1128]
+  add rsi, rdi
+  mov word ptr [rip+g269], si
+  movsx rsi, byte ptr [rip+g260]
+  mov rax, rsi
+.L.return.u26:
+  ret
+.text
+.p2align 4
+.global u27
+u27:
+  movsx rsi, byte ptr [rip+g4986]
+  movsxd rdi, dword ptr [rip+g4887]
+  add rsi, rdi
+  mov byte ptr [rip+g270], sil
+  movsx rsi, byte ptr [rip+g1451]
+  add rsi, qword ptr [rip+g1364]
+  mov dword ptr [rip+g271], esi
+  movsx rsi, word ptr [rip+g272]
+  movsxd rdi, dword ptr [rip+g3781]
+  add rsi, rdi
+  mov word ptr [rip+g272], si
+  mov rsi, qword ptr [rip+g205]
+  movsxd rdi, dword ptr [rip+g4749]
+  add rsi, rdi
+  mov byte ptr [rip+g273], sil
+  movsx rsi, byte ptr [rip+g4700]
+  movsx rdi, word ptr [rip+g889]
+  add rsi, rdi
+  mov dword ptr [rip+g274], esi
+  movsx rsi, word ptr [rip+g471]
+  add rsi, qword ptr [rip+g3374]
+  mov dword ptr [rip+g275], esi
+  movsx rsi, word ptr [rip+g501]
+  movsx rdi, word ptr [rip+g2370]
+  add rsi, rdi
+  mov byte ptr [rip+g276], sil
+  movsx rsi, byte ptr [rip+g3725]
+  movsx rdi, word ptr [rip+g4086]
+  add rsi, rdi
+  mov qword ptr [rip+g277], rsi
+  mov rsi, qword ptr [rip+g2586]
+  movsx rdi, byte ptr [rip+g2902]
+  add rsi, rdi
+  mov byte ptr [rip+g278], sil
+  movsxd rsi, dword ptr [rip+g4008]
+  add rsi, qword ptr [rip+g2940]
+  mov byte ptr [rip+g279], sil
+  movsx rsi, byte ptr [rip+g270]
+  mov rax, rsi
+.L.return.u27:
+  ret
+.text
+.p2align 4
+.global u28
+u28:
+  mov rsi, qword ptr [rip+g4171]
+  movsxd rdi, dword ptr [rip+g1557]
+  add rsi, rdi
+  mov dword ptr [rip+g280], esi
+  mov rsi, qword ptr [rip+g1575]
+  movsx rdi, word ptr [rip+g1748]
+  add rsi, rdi
+  mov qword ptr [rip+g281], rsi
+  movsx rsi, word ptr [rip+g2514]
+  movsx rdi, word ptr [rip+g3695]
+  add rsi, rdi
+  mov dword ptr [rip+g282], esi
+  movsxd rsi, dword ptr [rip+g815]
+  add rsi, qword ptr [rip+g2719]
+  mov qword ptr [rip+g283], rsi
+  movsxd rsi, dword ptr [rip+g3092]
+  movsx rdi, word ptr [rip+g3594]
+  add rsi, rdi
+  mov word ptr [rip+g284], si
+  mov rsi, qword ptr [rip+g1964]
+  add rsi, qword ptr [rip+g1150]
+  mov byte ptr [rip+g285], sil
+  movsx rsi, byte ptr [rip+g4323]
+  movsx rdi, word ptr [rip+g4239]
+  add rsi, rdi
+  mov qword ptr [rip+g286], rsi
+  movsx rsi, byte ptr [rip+g735]
+  movsx rdi, word ptr [rip+g3333]
+  add rsi, rdi
+  mov qword ptr [rip+g287], rsi
+  movsx rsi, word ptr [rip+g2230]
+  add rsi, qword ptr [rip+g4720]
+  mov byte ptr [rip+g288], sil
+  movsx rsi, word ptr [rip+g2251]
+  add rsi, qword ptr [rip+g4753]
+  mov word ptr [rip+g289], si
+  movsxd rsi, dword ptr [rip+g280]
+  mov rax, rsi
+.L.return.u28:
+  ret
+.text
+.p2align 4
+.global u29
+u29:
+  movsx rsi, byte ptr [rip+g1187]
+  movsxd rdi, dword ptr [rip+g1301]
+  add rsi, rdi
+  mov byte ptr [rip+g290], sil
+  movsxd rsi, dword ptr [rip+g4786]
+  movsx rdi, byte ptr [rip+g3013]
+  add rsi, rdi
+  mov word ptr [rip+g291], si
+  movsx rsi, word ptr [rip+g211]
+  movsxd rdi, dword ptr [rip+g1586]
+  add rsi, rdi
+  mov word ptr [rip+g292], si
+  mov rsi, qword ptr [rip+g3251]
+  movsx rdi, byte ptr [rip+g2299]
+  add rsi, rdi
+  mov dword ptr [rip+g293], esi
+  mov rsi, qword ptr [rip+g3141]
+  movsxd rdi, dword ptr [rip+g4585]
+  add rsi, rdi
+  mov word ptr [rip+g294], si
+  movsxd rsi, dword ptr [rip+g2107]
+  movsx rdi, byte ptr [rip+g1664]
+  add rsi, rdi
+  mov dword ptr [rip+g295], esi
+  movsx rsi, byte ptr [rip+g1837]
+  movsx rdi, byte ptr [rip+g685]
+  add rsi, rdi
+  mov word ptr [rip+g296], si
+  movsxd rsi, dword ptr [rip+g3104]
+  movsxd rdi, dword ptr [rip+g2946]
+  add rsi, rdi
+  mov qword ptr [rip+g297], rsi
+  mov rsi, qword ptr [rip+g1113]
+  add rsi, qword ptr [rip+g3945]
+  mov dword ptr [rip+g298], esi
+  movsxd rsi, dword ptr [rip+g4551]
+  movsx rdi, word ptr [rip+g2790]
+  add rsi, rdi
+  mov word ptr [rip+g299], si
+  movsx rsi, byte ptr [rip+g290]
+  mov rax, rsi
+.L.return.u29:
+  ret
+.text
+.p2align 4
+.global u30
+u30:
+  mov rsi, qword ptr [rip+g368]
+  movsxd rdi, dword ptr [rip+g1773]
+  add rsi, rdi
+  mov dword ptr [rip+g300], esi
+  mov rsi, qword ptr [rip+g187]
+  movsx rdi, word ptr [rip+g2428]
+  add rsi, rdi
+  mov qword ptr [rip+g301], rsi
+  movsx rsi, byte ptr [rip+g835]
+  movsxd rdi, dword ptr [rip+g832]
+  add rsi, rdi
+  mov word ptr [rip+g302], si
+  movsxd rsi, dword ptr [rip+g2687]
+  movsxd rdi, dword ptr [rip+g135]
+  add rsi, rdi
+  mov byte ptr [rip+g303], sil
+  movsx rsi, word ptr [rip+g4119]
+  movsx rdi, word ptr [rip+g382]
+  add rsi, rdi
+  mov word ptr [rip+g304], si
+  movsxd rsi, dword ptr [rip+g4332]
+  movsx rdi, word ptr [rip+g2168]
+  add rsi, rdi
+  mov qword ptr [rip+g305], rsi
+  movsx rsi, word ptr [rip+g913]
+  add rsi, qword ptr [rip+g3724]
+  mov byte ptr [rip+g306], sil
+  movsx rsi, byte ptr [rip+g2195]
+  movsxd rdi, dword ptr [rip+g2700]
+  add rsi, rdi
+  mov byte ptr [rip+g307], sil
+  movsx rsi, word ptr [rip+g4609]
+  movsx rdi, word ptr [rip+g2486]
+  add rsi, rdi
+  mov word ptr [rip+g308], si
+  movsx rsi, word ptr [rip+g3543]
+  add rsi, qword ptr [rip+g2996]
+  mov dword ptr [rip+g309], esi
+  movsxd rsi, dword ptr [rip+g300]
+  mov rax, rsi
+.L.return.u30:
+  ret
+.text
+.p2align 4
+.global u31
+u31:
+  movsxd rsi, dword ptr [rip+g2738]
+  movsxd rdi, dword ptr [rip+g1773]
+  add rsi, rdi
+  mov qword ptr [rip+g310], rsi
+  movsxd rsi, dword ptr [rip+g3103]
+  movsx rdi, byte ptr [rip+g4968]
+  add rsi, rdi
+  mov word ptr [rip+g311], si
+  movsx rsi, byte ptr [rip+g2478]
+  movsx rdi, byte ptr [rip+g3321]
+  add rsi, rdi
+  mov qword ptr [rip+g312], rsi
+  movsx rsi, byte ptr [rip+g4188]
+  movsx rdi, word ptr [rip+g1004]
+  add rsi, rdi
+  mov word ptr [rip+g313], si
+  movsx rsi, byte ptr [rip+g2892]
+  add rsi, qword ptr [rip+g4190]
+  mov qword ptr [rip+g314], rsi
+  movsx rsi, byte ptr [rip+g3691]
+  movsxd rdi, dword ptr [rip+g1017]
+  add rsi, rdi
+  mov word ptr [rip+g315], si
+  movsxd rsi, dword ptr [rip+g1371]
+  movsx rdi, byte ptr [rip+g2311]
+  add rsi, rdi
+  mov qword ptr [rip+g316], rsi
+  mov rsi, qword ptr [rip+g4682]
+  add rsi, qword ptr [rip+g612]
+  mov dword ptr [rip+g317], esi
+  movsxd rsi, dword ptr [rip+g3428]
+  add rsi, qword ptr [rip+g3829]
+  mov dword ptr [rip+g318], esi
+  movsx rsi, word ptr [rip+g745]
+  movsxd rdi, dword ptr [rip+g4008]
+  add rsi, rdi
+  mov qword ptr [rip+g319], rsi
+  mov rax, qword ptr [rip+g310]
+.L.return.u31:
+  ret
+.text
+.p2align 4
+.global u32
+u32:
+  movsx rsi, word ptr [rip+g501]
+  movsxd rdi, dword ptr [rip+g4562]
+  add rsi, rdi
+  mov qword ptr [rip+g320], rsi
+  mov rsi, qword ptr [rip+g971]
+  add rsi, qword ptr [rip+g4416]
+  mov qword ptr [rip+g321], rsi
+  movsxd rsi, dword ptr [rip+g4265]
+  movsx rdi, word ptr [rip+g4373]
+  add rsi, rdi
+  mov qword ptr [rip+g322], rsi
+  movsx rsi, byte ptr [rip+g3306]
+  movsx rdi, word ptr [rip+g4626]
+  add rsi, rdi
+  mov qword ptr [rip+g323], rsi
+  movsx rsi, word ptr [rip+g2471]
+  add rsi, qword ptr [rip+g3201]
+  mov byte ptr [rip+g324], sil
+  movsxd rsi, dword ptr [rip+g3554]
+  add rsi, qword ptr [rip+g901]
+  mov word ptr [rip+g325], si
+  mov rsi, qword ptr [rip+g817]
+  movsx rdi, byte ptr [rip+g2040]
+  add rsi, rdi
+  mov dword ptr [rip+g326], esi
+  movsx rsi, byte ptr [rip+g4740]
+  movsx rdi, word ptr [rip+g1830]
+  add rsi, rdi
+  mov byte ptr [rip+g327], sil
+  mov rsi, qword ptr [rip+g2608]
+  add rsi, qword ptr [rip+g3484]
+  mov qword ptr [rip+g328], rsi
+  mov rsi, qword ptr [rip+g3061]
+  movsxd rdi, dword ptr [rip+g4336]
+  add rsi, rdi
+  mov dword ptr [rip+g329], esi
+  mov rax, qword ptr [rip+g320]
+.L.return.u32:
+  ret
+.text
+.p2align 4
+.global u33
+u33:
+  mov rsi, qword ptr [rip+g3195]
+  movsx rdi, word ptr [rip+g1689]
+  add rsi, rdi
+  mov word ptr [rip+g330], si
+  movsx rsi, byte ptr [rip+g781]
+  movsxd rdi, dword ptr [rip+g1272]
+  add rsi, rdi
+  mov byte ptr [rip+g331], sil
+  mov rsi, qword ptr [rip+g2105]
+  movsx rdi, byte ptr [rip+g1561]
+  add rsi, rdi
+  mov byte ptr [rip+g332], sil
+  movsx rsi, word ptr [rip+g3591]
+  movsxd rdi, dword ptr [rip+g4168]
+  add rsi, rdi
+  mov qword ptr [rip+g333], rsi
+  mov rsi, qword ptr [rip+g4141]
+  movsx rdi, word ptr [rip+g2382]
+  add rsi, rdi
+  mov dword ptr [rip+g334], esi
+  movsx rsi, word ptr [rip+g3415]
+  movsx rdi, byte ptr [rip+g3450]
+  add rsi, rdi
+  mov byte ptr [rip+g335], sil
+  movsx rsi, byte ptr [rip+g1559]
+  movsxd rdi, dword ptr [rip+g3972]
+  add rsi, rdi
+  mov word ptr [rip+g336], si
+  mov rsi, qword ptr [rip+g2512]
+  add rsi, qword ptr [rip+g2261]
+  mov dword ptr [rip+g337], esi
+  movsx rsi, word ptr [rip+g1478]
+  add rsi, qword ptr [rip+g4424]
+  mov byte ptr [rip+g338], sil
+  mov rsi, qword ptr [rip+g58]
+  movsx rdi, word ptr [rip+g1655]
+  add rsi, rdi
+  mov dword ptr [rip+g339], esi
+  movsx rsi, word ptr [rip+g330]
+  mov rax, rsi
+.L.return.u33:
+  ret
+.text
+.p2align 4
+.global u34
+u34:
+  movsx rsi, byte ptr [rip+g2114]
+  movsx rdi, byte ptr [rip+g2138]
+  add rsi, rdi
+  mov dword ptr [rip+g340], esi
+  movsx rsi, byte ptr [rip+g4236]
+  movsxd rdi, dword ptr [rip+g140]
+  add rsi, rdi
+  mov dword ptr [rip+g341], esi
+  movsx rsi, word ptr [rip+g4510]
+  add rsi, qword ptr [rip+g1155]
+  mov qword ptr [rip+g342], rsi
+  movsx rsi, byte ptr [rip+g1019]
+  movsx rdi, byte ptr [rip+g3870]
+  add rsi, rdi
+  mov qword ptr [rip+g343], rsi
+  movsx rsi, word ptr [rip+g3987]
+  movsx rdi, byte ptr [rip+g4341]
+  add rsi, rdi
+  mov word ptr [rip+g344], si
+  movsxd rsi, dword ptr [rip+g3779]
+  movsxd rdi, dword ptr [rip+g2322]
+  add rsi, rdi
+  mov qword ptr [rip+g345], rsi
+  movsx rsi, byte ptr [rip+g198]
+  add rsi, qword ptr [rip+g1263]
+  mov qword ptr [rip+g346], rsi
+  mov rsi, qword ptr [rip+g2839]
+  movsx rdi, word ptr [rip+g783]
+  add rsi, rdi
+  mov dword ptr [rip+g347], esi
+  movsx rsi, word ptr [rip+g4635]
+  add rsi, qword ptr [rip+g3916]
+  mov qword ptr [rip+g348], rsi
+  movsxd rsi, dword ptr [rip+g128]
+  movsx rdi, word ptr [rip+g2297]
+  add rsi, rdi
+  mov word ptr [rip+g349], si
+  movsxd rsi, dword ptr [rip+g340]
+  mov rax, rsi
+.L.return.u34:
+  ret
+.text
+.p2align 4
+.global u35
+u35:
+  mov rsi, qword ptr [rip+g328]
+  add rsi, qword ptr [rip+g1818]
+  mov qword ptr [rip+g350], rsi
+  movsxd rsi, dword ptr [rip+g2711]
+  add rsi, qword ptr [rip+g2629]
+  mov qword ptr [rip+g351], rsi
+  movsxd rsi, dword ptr [rip+g4436]
+  movsx rdi, byte ptr [rip+g3317]
+  add rsi, rdi
+  mov qword ptr [rip+g352], rsi
+  mov rsi, qword ptr [rip+g17]
+  movsx rdi, word ptr [rip+g3178]
+  add rsi, rdi
+  mov qword ptr [rip+g353], rsi
+  movsxd rsi, dword ptr [rip+g2086]
+  movsx rdi, word ptr [rip+g3570]
+  add rsi, rdi
+  mov qword ptr [rip+g354], rsi
+  movsx rsi, word ptr [rip+g4673]
+  movsxd rdi, dword ptr [rip+g1198]
+  add rsi, rdi
+  mov qword ptr [rip+g355], rsi
+  movsxd rsi, dword ptr [rip+g2606]
+  movsxd rdi, dword ptr [rip+g4149]
+  add rsi, rdi
+  mov qword ptr [rip+g356], rsi
+  movsx rsi, byte ptr [rip+g192]
+  movsxd rdi, dword ptr [rip+g3092]
+  add rsi, rdi
+  mov dword ptr [rip+g357], esi
+  movsxd rsi, dword ptr [rip+g1270]
+  movsx rdi, byte ptr [rip+g939]
+  add rsi, rdi
+  mov word ptr [rip+g358], si
+  movsxd rsi, dword ptr [rip+g4464]
+  movsxd rdi, dword ptr [rip+g3339]
+  add rsi, rdi
+  mov dword ptr [rip+g359], esi
+  mov rax, qword ptr [rip+g350]
+.L.return.u35:
+  ret
+.text
+.p2align 4
+.global u36
+u36:
+  movsx rsi, byte ptr [rip+g2096]
+  add rsi, qword ptr [rip+g2248]
+  mov word ptr [rip+g360], si
+  movsx rsi, word ptr [rip+g272]
+  movsx rdi, word ptr [rip+g2615]
+  add rsi, rdi
+  mov byte ptr [rip+g361], sil
+  movsx rsi, word ptr [rip+g1689]
+  movsx rdi, byte ptr [rip+g3089]
+  add rsi, rdi
+  mov qword ptr [rip+g362], rsi
+  movsxd rsi, dword ptr [rip+g1051]
+  movsx rdi, byte ptr [rip+g3560]
+  add rsi, rdi
+  mov dword ptr [rip+g363], esi
+  movsx rsi, word ptr [rip+g3559]
+  movsx rdi, word ptr [rip+g1741]
+  add rsi, rdi
+  mov qword ptr [rip+g364], rsi
+  movsx rsi, word ptr [rip+g640]
+  movsxd rdi, dword ptr [rip+g34]
+  add rsi, rdi
+  mov word ptr [rip+g365], si
+  movsx rsi, word ptr [rip+g1919]
+  movsx rdi, byte ptr [rip+g3437]
+  add rsi, rdi
+  mov byte ptr [rip+g366], sil
+  movsx rsi, word ptr [rip+g299]
+  movsx rdi, word ptr [rip+g1970]
+  add rsi, rdi
+  mov word ptr [rip+g367], si
+  movsxd rsi, dword ptr [rip+g1669]
+  movsxd rdi, dword ptr [rip+g1832]
+  add rsi, rdi
+  mov qword ptr [rip+g368], rsi
+  movsx rsi, byte ptr [rip+g2270]
+  movsx rdi, word ptr [rip+g1553]
+  add rsi, rdi
+  mov qword ptr [rip+g369], rsi
+  movsx rsi, word ptr [rip+g360]
+  mov rax, rsi
+.L.return.u36:
+  ret
+.text
+.p2align 4
+.global u37
+u37:
+  movsx rsi, byte ptr [rip+g3368]
+  movsx rdi, word ptr [rip+g3364]
+  add rsi, rdi
+  mov dword ptr [rip+g370], esi
+  mov rsi, qword ptr [rip+g4122]
+  movsx rdi, word ptr [rip+g4900]
+  add rsi, rdi
+  mov qword ptr [rip+g371], rsi
+  movsx rsi, word ptr [rip+g3360]
+  movsxd rdi, dword ptr [rip+g222]
+  add rsi, rdi
+  mov byte ptr [rip+g372], sil
+  movsx rsi, word ptr [rip+g2435]
+  add rsi, qword ptr [rip+g2828]
+  mov byte ptr [rip+g373], sil
+  mov rsi, qword ptr [rip+g3571]
+  movsx rdi, word ptr [rip+g633]
+  add rsi, rdi
+  mov qword ptr [rip+g374], rsi
+  movsx rsi, byte ptr [rip+g3649]
+  movsxd rdi, dword ptr [rip+g3906]
+  add rsi, rdi
+  mov byte ptr [rip+g375], sil
+  mov rsi, qword ptr [rip+g1010]
+  movsx rdi, byte ptr [rip+g2279]
+  add rsi, rdi
+  mov qword ptr [rip+g376], rsi
+  movsxd rsi, dword ptr [rip+g1489]
+  movsx rdi, word ptr [rip+g2479]
+  add rsi, rdi
+  mov qword ptr [rip+g377], rsi
+  movsx rsi, word ptr [rip+g4254]
+  add rsi, qword ptr [rip+g1683]
+  mov qword ptr [rip+g378], rsi
+  movsx rsi, byte ptr [rip+g4746]
+  add rsi, qword ptr [rip+g3590]
+  mov qword ptr [rip+g379], rsi
+  movsxd rsi, dword ptr [rip+g370]
+  mov rax, rsi
+.L.return.u37:
+  ret
+.text
+.p2align 4
+.global u38
+u38:
+  movsxd rsi, dword ptr [rip+g1068]
+  movsx rdi, word ptr [rip+g272]
+  add rsi, rdi
+  mov dword ptr [rip+g380], esi
+  movsx rsi, word ptr [rip+g4000]
+  movsx rdi, word ptr [rip+g1278]
+  add rsi, rdi
+  mov word ptr [rip+g381], si
+  mov rsi, qword ptr [rip+g4494]
+  movsx rdi, byte ptr [rip+g1065]
+  add rsi, rdi
+  mov word ptr [rip+g382], si
+  movsxd rsi, dword ptr [rip+g3994]
+  movsx rdi, word ptr [rip+g252]
+  add rsi, rdi
+  mov qword ptr [rip+g383], rsi
+  movsx rsi, byte ptr [rip+g4968]
+  movsx rdi, byte ptr [rip+g4789]
+  add rsi, rdi
+  mov word ptr [rip+g384], si
+  mov rsi, qword ptr [rip+g1677]
+  movsx rdi, byte ptr [rip+g3537]
+  add rsi, rdi
+  mov word ptr [rip+g385], si
+  movsx rsi, byte ptr [rip+g3296]
+  add rsi, qword ptr [rip+g3023]
+  mov qword ptr [rip+g386], rsi
+  movsx rsi, byte ptr [rip+g827]
+  movsxd rdi, dword ptr [rip+g2227]
+  add rsi, rdi
+  mov dword ptr [rip+g387], esi
+  movsx rsi, word ptr [rip+g3438]
+  movsx rdi, byte ptr [rip+g1469]
+  add rsi, rdi
+  mov word ptr [rip+g388], si
+  movsx rsi, word ptr [rip+g2277]
+  movsx rdi, word ptr [rip+g620]
+  add rsi, rdi
+  mov qword ptr [rip+g389], rsi
+  movsxd rsi, dword ptr [rip+g380]
+  mov rax, rsi
+.L.return.u38:
+  ret
+.text
+.p2align 4
+.global u39
+u39:
+  mov rsi, qword ptr [rip+g3748]
+  movsx rdi, word ptr [rip+g1047]
+  add rsi, rdi
+  mov dword ptr [rip+g390], esi
+  movsx rsi, word ptr [rip+g2890]
+  movsx rdi, word ptr [rip+g3004]
+  add rsi, rdi
+  mov byte ptr [rip+g391], sil
+  movsxd rsi, dword ptr [rip+g4126]
+  movsx rdi, byte ptr [rip+g502]
+  add rsi, rdi
+  mov qword ptr [rip+g392], rsi
+  mov rsi, qword ptr [rip+g1372]
+  movsx rdi, word ptr [rip+g3326]
+  add rsi, rdi
+  mov byte ptr [rip+g393], sil
+  movsx rsi, word ptr [rip+g1271]
+  add rsi, qword ptr [rip+g2630]
+  mov dword ptr [rip+g394], esi
+  mov rsi, qword ptr [rip+g1370]
+  movsxd rdi, dword ptr [rip+g4382]
+  add rsi, rdi
+  mov dword ptr [rip+g395], esi
+  movsx rsi, byte ptr [rip+g1303]
+  movsx rdi, word ptr [rip+g33]
+  add rsi, rdi
+  mov qword ptr [rip+g396], rsi
+  movsxd rsi, dword ptr [rip+g1343]
+  add rsi, qword ptr [rip+g4494]
+  mov word ptr [rip+g397], si
+  movsxd rsi, dword ptr [rip+g4374]
+  movsx rdi, byte ptr [rip+g2244]
+  add rsi, rdi
+  mov word ptr [rip+g398], si
+  movsx rsi, word ptr [rip+g958]
+  movsxd rdi, dword ptr [rip+g3810]
+  add rsi, rdi
+  mov byte ptr [rip+g399], sil
+  movsxd rsi, dword ptr [rip+g390]
+  mov rax, rsi
+.L.return.u39:
+  ret
+.text
+.p2align 4
+.global u40
+u40:
+  movsx rsi, word ptr [rip+g2802]
+  movsx rdi, word ptr [rip+g1996]
+  add rsi, rdi
+  mov byte ptr [rip+g400], sil
+  mov rsi, qword ptr [rip+g4414]
+  movsx rdi, byte ptr [rip+g3377]
+  add rsi, rdi
+  mov byte ptr [rip+g401], sil
+  movsx rsi, byte ptr [rip+g4222]
+  add rsi, qword ptr [rip+g1904]
+  mov byte ptr [rip+g402], sil
+  movsx rsi, byte ptr [rip+g3794]
+  movsx rdi, word ptr [rip+g2148]
+  add rsi, rdi
+  mov byte ptr [rip+g403], sil
+  mov rsi, qword ptr [rip+g4190]
+  movsxd rdi, dword ptr [rip+g4085]
+  add rsi, rdi
+  mov byte ptr [rip+g404], sil
+  mov rsi, qword ptr [rip+g2638]
+  movsxd rdi, dword ptr [rip+g2275]
+  add rsi, rdi
+  mov word ptr [rip+g405], si
+  mov rsi, qword ptr [rip+g630]
+  movsx rdi, word ptr [rip+g1699]
+  add rsi, rdi
+  mov qword ptr [rip+g406], rsi
+  mov rsi, qword ptr [rip+g1114]
+  movsx rdi, byte ptr [rip+g690]
+  add rsi, rdi
+  mov qword ptr [rip+g407], rsi
+  mov rsi, qword ptr [rip+g1538]
+  movsxd rdi, dword ptr [rip+g791]
+  add rsi, rdi
+  mov word ptr [rip+g408], si
+  movsxd rsi, dword ptr [rip+g1420]
+  movsx rdi, word ptr [rip+g2906]
+  add rsi, rdi
+  mov word ptr [rip+g409], si
+  movsx rsi, byte ptr [rip+g400]
+  mov rax, rsi
+.L.return.u40:
+  ret
+.text
+.p2align 4
+.global u41
+u41:
+  movsx rsi, word ptr [rip+g2513]
+  movsx rdi, word ptr [rip+g2884]
+  add rsi, rdi
+  mov qword ptr [rip+g410], rsi
+  mov rsi, qword ptr [rip+g3469]
+  movsxd rdi, dword ptr [rip+g1301]
+  add rsi, rdi
+  mov qword ptr [rip+g411], rsi
+  mov rsi, qword ptr [rip+g2454]
+  movsx rdi, byte ptr [rip+g2779]
+  add rsi, rdi
+  mov qword ptr [rip+g412], rsi
+  movsx rsi, word ptr [rip+g4379]
+  movsx rdi, word ptr [rip+g2925]
+  add rsi, rdi
+  mov word ptr [rip+g413], si
+  mov rsi, qword ptr [rip+g1498]
+  movsx rdi, byte ptr [rip+g3351]
+  add rsi, rdi
+  mov word ptr [rip+g414], si
+  movsx rsi, word ptr [rip+g2436]
+  movsx rdi, byte ptr [rip+g4389]
+  add rsi, rdi
+  mov byte ptr [rip+g415], sil
+  mov rsi, qword ptr [rip+g3442]
+  movsx rdi, word ptr [rip+g3382]
+  add rsi, rdi
+  mov qword ptr [rip+g416], rsi
+  movsx rsi, byte ptr [rip+g3483]
+  movsxd rdi, dword ptr [rip+g884]
+  add rsi, rdi
+  mov byte ptr [rip+g417], sil
+  movsx rsi, word ptr [rip+g3391]
+  movsx rdi, word ptr [rip+g4120]
+  add rsi, rdi
+  mov dword ptr [rip+g418], esi
+  mov rsi, qword ptr [rip+g3436]
+  movsx rdi, byte ptr [rip+g4733]
+  add rsi, rdi
+  mov dword ptr [rip+g419], esi
+  mov rax, qword ptr [rip+g410]
+.L.return.u41:
+  ret
+.text
+.p2align 4
+.global u42
+u42:
+  movsxd rsi, dword ptr [rip+g2535]
+  movsx rdi, byte ptr [rip+g3729]
+  add rsi, rdi
+  mov dword ptr [rip+g420], esi
+  mov rsi, qword ptr [rip+g3552]
+  add rsi, qword ptr [rip+g2702]
+  mov word ptr [rip+g421], si
+  movsx rsi, byte ptr [rip+g4323]
+  movsx rdi, word ptr [rip+g3702]
+  add rsi, rdi
+  mov qword ptr [rip+g422], rsi
+  movsxd rsi, dword ptr [rip+g2122]
+  movsx rdi, byte ptr [rip+g190]
+  add rsi, rdi
+  mov qword ptr [rip+g423], rsi
+  movsx rsi, word ptr [rip+g558]
+  add rsi, qword ptr [rip+g1477]
+  mov byte ptr [rip+g424], sil
+  movsx rsi, word ptr [rip+g610]
+  movsx rdi, byte ptr [rip+g2067]
+  add rsi, rdi
+  mov qword ptr [rip+g425], rsi
+  movsxd rsi, dword ptr [rip+g2068]
+  movsx rdi, byte ptr [rip+g3501]
+  add rsi, rdi
+  mov word ptr [rip+g426], si
+  movsx rsi, word ptr [rip+g269]
+  movsxd rdi, dword ptr [rip+g2867]
+  add rsi, rdi
+  mov qword ptr [rip+g427], rsi
+  mov rsi, qword ptr [rip+g4463]
+  add rsi, qword ptr [rip+g3974]
+  mov dword ptr [rip+g428], esi
+  mov rsi, qword ptr [rip+g1698]
+  movsxd rdi, dword ptr [rip+g4892]
+  add rsi, rdi
+  mov word ptr [rip+g429], si
+  movsxd rsi, dword ptr [rip+g420]
+  mov rax, rsi
+.L.return.u42:
+  ret
+.text
+.p2align 4
+.global u43
+u43:
+  movsx rsi, word ptr [rip+g4164]
+  movsxd rdi, dword ptr [rip+g163]
+  add rsi, rdi
+  mov qword ptr [rip+g430], rsi
+  movsxd rsi, dword ptr [rip+g4805]
+  movsx rdi, word ptr [rip+g3631]
+  add rsi, rdi
+  mov word ptr [rip+g431], si
+  movsx rsi, byte ptr [rip+g977]
+  add rsi, qword ptr [rip+g4288]
+  mov word ptr [rip+g432], si
+  mov rsi, qword ptr [rip+g3469]
+  movsxd rdi, dword ptr [rip+g1995]
+  add rsi, rdi
+  mov word ptr [rip+g433], si
+  movsx rsi, word ptr [rip+g3303]
+  movsxd rdi, dword ptr [rip+g4541]
+  add rsi, rdi
+  mov dword ptr [rip+g434], esi
+  mov rsi, qword ptr [rip+g2046]
+  add rsi, qword ptr [rip+g1354]
+  mov qword ptr [rip+g435], rsi
+  movsxd rsi, dword ptr [rip+g869]
+  add rsi, qword ptr [rip+g3374]
+  mov word ptr [rip+g436], si
+  movsx rsi, byte ptr [rip+g1302]
+  add rsi, qword ptr [rip+g4719]
+  mov word ptr [rip+g437], si
+  movsx rsi, word ptr [rip+g3382]
+  movsx rdi, word ptr [rip+g3010]
+  add rsi, rdi
+  mov byte ptr [rip+g438], sil
+  movsxd rsi, dword ptr [rip+g1886]
+  movsxd rdi, dword ptr [rip+g1949]
+  add rsi, rdi
+  mov byte ptr [rip+g439], sil
+  mov rax, qword ptr [rip+g430]
+.L.return.u43:
+  ret
+.text
+.p2align 4
+.global u44
+u44:
+  mov rsi, qword ptr [rip+g2403]
+  movsxd rdi, dword ptr [rip+g4735]
+  add rsi, rdi
+  mov qword ptr [rip+g440], rsi
+  movsx rsi, byte ptr [rip+g4268]
+  add rsi, qword ptr [rip+g4083]
+  mov word ptr [rip+g441], si
+  mov rsi, qword ptr [rip+g345]
+  movsx rdi, word ptr [rip+g1524]
+  add rsi, rdi
+  mov qword ptr [rip+g442], rsi
+  movsxd rsi, dword ptr [rip+g4918]
+  movsx rdi, byte ptr [rip+g1062]
+  add rsi, rdi
+  mov word ptr [rip+g443], si
+  mov rsi, qword ptr [rip+g3584]
+  movsx rdi, word ptr [rip+g1722]
+  add rsi, rdi
+  mov byte ptr [rip+g444], sil
+  movsxd rsi, dword ptr [rip+g884]
+  add rsi, qword ptr [rip+g856]
+  mov word ptr [rip+g445], si
+  movsxd rsi, dword ptr [rip+g1259]
+  add rsi, qword ptr [rip+g1137]
+  mov word ptr [rip+g446], si
+  movsx rsi, byte ptr [rip+g4034]
+  movsxd rdi, dword ptr [rip+g924]
+  add rsi, rdi
+  mov byte ptr [rip+g447], sil
+  movsx rsi, byte ptr [rip+g4269]
+  add rsi, qword ptr [rip+g3565]
+  mov dword ptr [rip+g448], esi
+  movsx rsi, byte ptr [rip+g4757]
+  movsx rdi, byte ptr [rip+g4867]
+  add rsi, rdi
+  mov qword ptr [rip+g449], rsi
+  mov rax, qword ptr [rip+g440]
+.L.return.u44:
+  ret
+.text
+.p2align 4
+.global u45
+u45:
+  movsx rsi, byte ptr [rip+g1355]
+  movsx rdi, byte ptr [rip+g1115]
+  add rsi, rdi
+  mov word ptr [rip+g450], si
+  movsxd rsi, dword ptr [rip+g1333]
+  add rsi, qword ptr [rip+g4938]
+  mov byte ptr [rip+g451], sil
+  movsx rsi, byte ptr [rip+g4270]
+  movsx rdi, byte ptr [rip+g4389]
+  add rsi, rdi
+  mov dword ptr [rip+g452], esi
+  movsxd rsi, dword ptr [rip+g1705]
+  movsxd rdi, dword ptr [rip+g543]
+  add rsi, rdi
+  mov dword ptr [rip+g453], esi
+  movsxd rsi, dword ptr [rip+g4068]
+  movsx rdi, word ptr [rip+g3953]
+  add rsi, rdi
+  mov byte ptr [rip+g454], sil
+  movsx rsi, byte ptr [rip+g4128]
+  movsxd rdi, dword ptr [rip+g2147]
+  add rsi, rdi
+  mov dword ptr [rip+g455], esi
+  mov rsi, qword ptr [rip+g1242]
+  movsx rdi, word ptr [rip+g4344]
+  add rsi, rdi
+  mov dword ptr [rip+g456], esi
+  mov rsi, qword ptr [rip+g350]
+  add rsi, qword ptr [rip+g4652]
+  mov qword ptr [rip+g457], rsi
+  movsx rsi, word ptr [rip+g2497]
+  add rsi, qword ptr [rip+g3878]
+  mov byte ptr [rip+g458], sil
+  mov rsi, qword ptr [rip+g2458]
+  movsx rdi, word ptr [rip+g2550]
+  add rsi, rdi
+  mov byte ptr [rip+g459], sil
+  movsx rsi, word ptr [rip+g450]
+  mov rax, rsi
+.L.return.u45:
+  ret
+.text
+.p2align 4
+.global u46
+u46:
+  movsxd rsi, dword ptr [rip+g1692]
+  movsx rdi, word ptr [rip+g1363]
+  add rsi, rdi
+  mov dword ptr [rip+g460], esi
+  movsxd rsi, dword ptr [rip+g4587]
+  add rsi, qword ptr [rip+g4504]
+  mov word ptr [rip+g461], si
+  movsx rsi, byte ptr [rip+g2216]
+  add rsi, qword ptr [rip+g2456]
+  mov byte ptr [rip+g462], sil
+  movsxd rsi, dword ptr [rip+g2449]
+  movsx rdi, byte ptr [rip+g1123]
+  add rsi, rdi
+  mov word ptr [rip+g463], si
+  mov rsi, qword ptr [rip+g746]
+  movsx rdi, byte ptr [rip+g2114]
+  add rsi, rdi
+  mov qword ptr [rip+g464], rsi
+  movsxd rsi, dword ptr [rip+g4126]
+  add rsi, qword ptr [rip+g3038]
+  mov word ptr [rip+g465], si
+  movsxd rsi, dword ptr [rip+g791]
+  movsxd rdi, dword ptr [rip+g3958]
+  add rsi, rdi
+  mov qword ptr [rip+g466], rsi
+  movsx rsi, byte ptr [rip+g2779]
+  movsx rdi, byte ptr [rip+g2284]
+  add rsi, rdi
+  mov word ptr [rip+g467], si
+  movsx rsi, byte ptr [rip+g2509]
+  movsxd rdi, dword ptr [rip+g2322]
+  add rsi, rdi
+  mov dword ptr [rip+g468], esi
+  movsx rsi, word ptr [rip+g542]
+  movsx rdi, byte ptr [rip+g1303]
+  add rsi, rdi
+  mov word ptr [rip+g469], si
+  movsxd rsi, dword ptr [rip+g460]
+  mov rax, rsi
+.L.return.u46:
+  ret
+.text
+.p2align 4
+.global u47
+u47:
+  movsx rsi, word ptr [rip+g4234]
+  movsx rdi, byte ptr [rip+g3116]
+  add rsi, rdi
+  mov qword ptr [rip+g470], rsi
+  movsxd rsi, dword ptr [rip+g1493]
+  movsx rdi, byte ptr [rip+g1229]
+  add rsi, rdi
+  mov word ptr [rip+g471], si
+  mov rsi, qword ptr [rip+g1634]
+  add rsi, qword ptr [rip+g1141]
+  mov byte ptr [rip+g472], sil
+  movsxd rsi, dword ptr [rip+g518]
+  movsx rdi, byte ptr [rip+g1452]
+  add rsi, rdi
+  mov byte ptr [rip+g473], sil
+  movsxd rsi, dword ptr [rip+g2771]
+  movsx rdi, byte ptr [rip+g1758]
+  add rsi, rdi
+  mov dword ptr [rip+g474], esi
+  mov rsi, qword ptr [rip+g1972]
+  add rsi, qword ptr [rip+g4395]
+  mov byte ptr [rip+g475], sil
+  movsx rsi, word ptr [rip+g311]
+  movsx rdi, byte ptr [rip+g2355]
+  add rsi, rdi
+  mov qword ptr [rip+g476], rsi
+  movsxd rsi, dword ptr [rip+g4499]
+  movsxd rdi, dword ptr [rip+g1744]
+  add rsi, rdi
+  mov byte ptr [rip+g477], sil
+  movsx rsi, word ptr [rip+g2953]
+  movsx rdi, word ptr [rip+g503]
+  add rsi, rdi
+  mov dword ptr [rip+g478], esi
+  movsxd rsi, dword ptr [rip+g1586]
+  add rsi, qword ptr [rip+g3183]
+  mov dword ptr [rip+g479], esi
+  mov rax, qword ptr [rip+g470]
+.L.return.u47:
+  ret
+.text
+.p2align 4
+.global u48
+u48:
+  movsxd rsi, dword ptr [rip+g4873]
+  movsxd rdi, dword ptr [rip+g3421]
+  add rsi, rdi
+  mov dword ptr [rip+g480], esi
+  movsx rsi, word ptr [rip+g1611]
+  movsx rdi, byte ptr [rip+g837]
+  add rsi, rdi
+  mov byte ptr [rip+g481], sil
+  movsxd rsi, dword ptr [rip+g1096]
+  add rsi, qword ptr [rip+g3112]
+  mov dword ptr [rip+g482], esi
+  movsxd rsi, dword ptr [rip+g4737]
+  add rsi, qword ptr [rip+g2681]
+  mov byte ptr [rip+g483], sil
+  mov rsi, qword ptr [rip+g629]
+  movsx rdi, byte ptr [rip+g1480]
+  add rsi, rdi
+  mov dword ptr [rip+g484], esi
+  mov rsi, qword ptr [rip+g3328]
+  add rsi, qword ptr [rip+g1344]
+  mov word ptr [rip+g485], si
+  movsx rsi, byte ptr [rip+g1873]
+  add rsi, qword ptr [rip+g1677]
+  mov word ptr [rip+g486], si
+  movsx rsi, word ptr [rip+g2251]
+  movsx rdi, byte ptr [rip+g1119]
+  add rsi, rdi
+  mov word ptr [rip+g487], si
+  movsx rsi, byte ptr [rip+g3638]
+  add rsi, qword ptr [rip+g3435]
+  mov word ptr [rip+g488], si
+  movsx rsi, byte ptr [rip+g4555]
+  movsx rdi, word ptr [rip+g1271]
+  add rsi, rdi
+  mov word ptr [rip+g489], si
+  movsxd rsi, dword ptr [rip+g480]
+  mov rax, rsi
+.L.return.u48:
+  ret
+.text
+.p2align 4
+.global u49
+u49:
+  movsx rsi, byte ptr [rip+g3752]
+  movsx rdi, byte ptr [rip+g3240]
+  add rsi, rdi
+  mov qword ptr [rip+g490], rsi
+  mov rsi, qword ptr [rip+g3640]
+  add rsi, qword ptr [rip+g778]
+  mov dword ptr [rip+g491], esi
+  movsx rsi, word ptr [rip+g4930]
+  movsxd rdi, dword ptr [rip+g3016]
+  add rsi, rdi
+  mov word ptr [rip+g492], si
+  mov rsi, qword ptr [rip+g3839]
+  movsxd rdi, dword ptr [rip+g3648]
+  add rsi, rdi
+  mov word ptr [rip+g493], si
+  movsx rsi, byte ptr [rip+g1713]
+  movsxd rdi, dword ptr [rip+g3310]
+  add rsi, rdi
+  mov word ptr [rip+g494], si
+  mov rsi, qword ptr [rip+g2604]
+  movsx rdi, word ptr [rip+g2928]
+  add rsi, rdi
+  mov word ptr [rip+g495], si
+  movsx rsi, byte ptr [rip+g760]
+  movsx rdi, word ptr [rip+g3938]
+  add rsi, rdi
+  mov byte ptr [rip+g496], sil
+  movsxd rsi, dword ptr [rip+g1439]
+  movsx rdi, byte ptr [rip+g3736]
+  add rsi, rdi
+  mov byte ptr [rip+g497], sil
+  movsx rsi, word ptr [rip+g3247]
+  add rsi, qword ptr [rip+g1957]
+  mov qword ptr [rip+g498], rsi
+  movsx rsi, word ptr [rip+g3080]
+  movsx rdi, word ptr [rip+g1519]
+  add rsi, rdi
+  mov word ptr [rip+g499], si
+  mov rax, qword ptr [rip+g490]
+.L.return.u49:
+  ret
+.text
+.p2align 4
+.global u50
+u50:
+  movsx rsi, byte ptr [rip+g1415]
+  add rsi, qword ptr [rip+g3238]
+  mov byte ptr [rip+g500], sil
+  movsx rsi, byte ptr [rip+g3760]
+  add rsi, qword ptr [rip+g4618]
+  mov word ptr [rip+g501], si
+  movsx rsi, byte ptr [rip+g1406]
+  movsx rdi, word ptr [rip+g3774]
+  add rsi, rdi
+  mov byte ptr [rip+g502], sil
+  movsx rsi, word ptr [rip+g100]
+  movsxd rdi, dword ptr [rip+g4134]
+  add rsi, rdi
+  mov word ptr [rip+g503], si
+  movsx rsi, byte ptr [rip+g2278]
+  movsx rdi, word ptr [rip+g4923]
+  add rsi, rdi
+  mov qword ptr [rip+g504], rsi
+  movsxd rsi, dword ptr [rip+g36]
+  movsx rdi, byte ptr [rip+g2538]
+  add rsi, rdi
+  mov word ptr [rip+g505], si
+  movsx rsi, byte ptr [rip+g1223]
+  movsx rdi, word ptr [rip+g4184]
+  add rsi, rdi
+  mov dword ptr [rip+g506], esi
+  mov rsi, qword ptr [rip+g4183]
+  movsx rdi, byte ptr [rip+g331]
+  add rsi, rdi
+  mov qword ptr [rip+g507], rsi
+  movsx rsi, byte ptr [rip+g3437]
+  movsx rdi, byte ptr [rip+g3977]
+  add rsi, rdi
+  mov byte ptr [rip+g508], sil
+  movsx rsi, byte ptr [rip+g1990]
+  add rsi, qword ptr [rip+g3024]
+  mov qword ptr [rip+g509], rsi
+  movsx rsi, byte ptr [rip+g500]
+  mov rax, rsi
+.L.return.u50:
+  ret
+.text
+.p2align 4
+.global u51
+u51:
+  movsxd rsi, dword ptr [rip+g1409]
+  movsx rdi, word ptr [rip+g3360]
+  add rsi, rdi
+  mov word ptr [rip+g510], si
+  movsxd rsi, dword ptr [rip+g2610]
+  movsx rdi, byte ptr [rip+g2653]
+  add rsi, rdi
+  mov dword ptr [rip+g511], esi
+  movsxd rsi, dword ptr [rip+g1145]
+  movsx rdi, byte ptr [rip+g1262]
+  add rsi, rdi
+  mov word ptr [rip+g512], si
+  movsx rsi, word ptr [rip+g2774]
+  add rsi, qword ptr [rip+g1860]
+  mov dword ptr [rip+g513], esi
+  movsx rsi, word ptr [rip+g4025]
+  movsx rdi, byte ptr [rip+g4133]
+  add rsi, rdi
+  mov byte ptr [rip+g514], sil
+  movsx rsi, word ptr [rip+g2045]
+  movsx rdi, word ptr [rip+g822]
+  add rsi, rdi
+  mov qword ptr [rip+g515], rsi
+  movsx rsi, word ptr [rip+g3592]
+  movsxd rdi, dword ptr [rip+g1691]
+  add rsi, rdi
+  mov byte ptr [rip+g516], sil
+  movsx rsi, byte ptr [rip+g3544]
+  add rsi, qword ptr [rip+g3469]
+  mov qword ptr [rip+g517], rsi
+  movsxd rsi, dword ptr [rip+g2842]
+  add rsi, qword ptr [rip+g4052]
+  mov dword ptr [rip+g518], esi
+  movsxd rsi, dword ptr [rip+g1975]
+  add rsi, qword ptr [rip+g3565]
+  mov word ptr [rip+g519], si
+  movsx rsi, word ptr [rip+g510]
+  mov rax, rsi
+.L.return.u51:
+  ret
+.text
+.p2align 4
+.global u52
+u52:
+  movsx rsi, word ptr [rip+g1808]
+  movsxd rdi, dword ptr [rip+g2737]
+  add rsi, rdi
+  mov qword ptr [rip+g520], rsi
+  movsxd rsi, dword ptr [rip+g3933]
+  movsx rdi, byte ptr [rip+g834]
+  add rsi, rdi
+  mov qword ptr [rip+g521], rsi
+  movsx rsi, word ptr [rip+g2636]
+  movsxd rdi, dword ptr [rip+g214]
+  add rsi, rdi
+  mov qword ptr [rip+g522], rsi
+  movsx rsi, byte ptr [rip+g2260]
+  movsxd rdi, dword ptr [rip+g4419]
+  add rsi, rdi
+  mov qword ptr [rip+g523], rsi
+  mov rsi, qword ptr [rip+g2581]
+  movsx rdi, word ptr [rip+g4929]
+  add rsi, rdi
+  mov dword ptr [rip+g524], esi
+  movsx rsi, byte ptr [rip+g1988]
+  movsx rdi, byte ptr [rip+g1395]
+  add rsi, rdi
+  mov dword ptr [rip+g525], esi
+  movsx rsi, byte ptr [rip+g881]
+  add rsi, qword ptr [rip+g4319]
+  mov qword ptr [rip+g526], rsi
+  movsx rsi, word ptr [rip+g1422]
+  add rsi, qword ptr [rip+g3651]
+  mov byte ptr [rip+g527], sil
+  movsx rsi, byte ptr [rip+g747]
+  movsxd rdi, dword ptr [rip+g1029]
+  add rsi, rdi
+  mov qword ptr [rip+g528], rsi
+  mov rsi, qword ptr [rip+g659]
+  add rsi, qword ptr [rip+g1703]
+  mov dword ptr [rip+g529], esi
+  mov rax, qword ptr [rip+g520]
+.L.return.u52:
+  ret
+.text
+.p2align 4
+.global u53
+u53:
+  movsx rsi, word ptr [rip+g3382]
+  movsxd rdi, dword ptr [rip+g648]
+  add rsi, rdi
+  mov byte ptr [rip+g530], sil
+  movsx rsi, byte ptr [rip+g3018]
+  add rsi, qword ptr [rip+g4573]
+  mov word ptr [rip+g531], si
+  movsx rsi, byte ptr [rip+g3564]
+  movsx rdi, byte ptr [rip+g2696]
+  add rsi, rdi
+  mov byte ptr [rip+g532], sil
+  movsxd rsi, dword ptr [rip+g3418]
+  add rsi, qword ptr [rip+g4504]
+  mov qword ptr [rip+g533], rsi
+  movsx rsi, word ptr [rip+g620]
+  movsx rdi, byte ptr [rip+g3448]
+  add rsi, rdi
+  mov byte ptr [rip+g534], sil
+  movsx rsi, word ptr [rip+g943]
+  movsx rdi, byte ptr [rip+g2783]
+  add rsi, rdi
+  mov qword ptr [rip+g535], rsi
+  movsx rsi, byte ptr [rip+g812]
+  movsx rdi, word ptr [rip+g1309]
+  add rsi, rdi
+  mov qword ptr [rip+g536], rsi
+  movsx rsi, word ptr [rip+g2645]
+  add rsi, qword ptr [rip+g3143]
+  mov word ptr [rip+g537], si
+  movsx rsi, word ptr [rip+g2140]
+  add rsi, qword ptr [rip+g4470]
+  mov qword ptr [rip+g538], rsi
+  movsx rsi, word ptr [rip+g397]
+  movsxd rdi, dword ptr [rip+g1044]
+  add rsi, rdi
+  mov qword ptr [rip+g539], rsi
+  movsx rsi, byte ptr [rip+g530]
+  mov rax, rsi
+.L.return.u53:
+  ret
+.text
+.p2align 4
+.global u54
+u54:
+  movsx rsi, byte ptr [rip+g1836]
+  movsx rdi, byte ptr [rip+g4648]
+  add rsi, rdi
+  mov byte ptr [rip+g540], sil
+  movsxd rsi, dword ptr [rip+g110]
+  movsx rdi, word ptr [rip+g161]
+  add rsi, rdi
+  mov dword ptr [rip+g541], esi
+  movsx rsi, word ptr [rip+g3740]
+  add rsi, qword ptr [rip+g374]
+  mov word ptr [rip+g542], si
+  movsx rsi, word ptr [rip+g819]
+  movsx rdi, byte ptr [rip+g424]
+  add rsi, rdi
+  mov dword ptr [rip+g543], esi
+  movsxd rsi, dword ptr [rip+g1666]
+  movsx rdi, word ptr [rip+g2371]
+  add rsi, rdi
+  mov dword ptr [rip+g544], esi
+  movsx rsi, byte ptr [rip+g3007]
+  add rsi, qword ptr [rip+g1376]
+  mov dword ptr [rip+g545], esi
+  movsx rsi, word ptr [rip+g1702]
+  movsx rdi, byte ptr [rip+g2300]
+  add rsi, rdi
+  mov word ptr [rip+g546], si
+  mov rsi, qword ptr [rip+g4528]
+  movsxd rdi, dword ptr [rip+g3530]
+  add rsi, rdi
+  mov word ptr [rip+g547], si
+  movsxd rsi, dword ptr [rip+g4285]
+  movsxd rdi, dword ptr [rip+g2180]
+  add rsi, rdi
+  mov qword ptr [rip+g548], rsi
+  mov rsi, qword ptr [rip+g793]
+  movsxd rdi, dword ptr [rip+g4400]
+  add rsi, rdi
+  mov dword ptr [rip+g549], esi
+  movsx rsi, byte ptr [rip+g540]
+  mov rax, rsi
+.L.return.u54:
+  ret
+.text
+.p2align 4
+.global u55
+u55:
+  movsxd rsi, dword ptr [rip+g2578]
+  add rsi, qword ptr [rip+g2814]
+  mov dword ptr [rip+g550], esi
+  movsxd rsi, dword ptr [rip+g4944]
+  add rsi, qword ptr [rip+g4117]
+  mov qword ptr [rip+g551], rsi
+  movsxd rsi, dword ptr [rip+g3975]
+  movsxd rdi, dword ptr [rip+g1331]
+  add rsi, rdi
+  mov dword ptr [rip+g552], esi
+  movsxd rsi, dword ptr [rip+g2769]
+  add rsi, qword ptr [rip+g4395]
+  mov dword ptr [rip+g553], esi
+  mov rsi, qword ptr [rip+g3435]
+  movsx rdi, word ptr [rip+g4039]
+  add rsi, rdi
+  mov dword ptr [rip+g554], esi
+  movsx rsi, byte ptr [rip+g3089]
+  movsx rdi, byte ptr [rip+g2241]
+  add rsi, rdi
+  mov word ptr [rip+g555], si
+  movsx rsi, word ptr [rip+g4923]
+  movsxd rdi, dword ptr [rip+g3926]
+  add rsi, rdi
+  mov qword ptr [rip+g556], rsi
+  movsx rsi, byte ptr [rip+g2169]
+  movsx rdi, word ptr [rip+g2590]
+  add rsi, rdi
+  mov byte ptr [rip+g557], sil
+  mov rsi, qword ptr [rip+g1146]
+  add rsi, qword ptr [rip+g4528]
+  mov word ptr [rip+g558], si
+  movsxd rsi, dword ptr [rip+g1892]
+  add rsi, qword ptr [rip+g322]
+  mov qword ptr [rip+g559], rsi
+  movsxd rsi, dword ptr [rip+g550]
+  mov rax, rsi
+.L.return.u55:
+  ret
+.text
+.p2align 4
+.global u56
+u56:
+  mov rsi, qword ptr [rip+g579]
+  add rsi, qword ptr [rip+g1151]
+  mov byte ptr [rip+g560], sil
+  mov rsi, qword ptr [rip+g3147]
+  movsxd rdi, dword ptr [rip+g2824]
+  add rsi, rdi
+  mov dword ptr [rip+g561], esi
+  movsx rsi, byte ptr [rip+g3115]
+  add rsi, qword ptr [rip+g3435]
+  mov byte ptr [rip+g562], sil
+  movsx rsi, byte ptr [rip+g2060]
+  movsx rdi, word ptr [rip+g289]
+  add rsi, rdi
+  mov word ptr [rip+g563], si
+  movsx rsi, word ptr [rip+g2561]
+  movsx rdi, word ptr [rip+g964]
+  add rsi, rdi
+  mov byte ptr [rip+g564], sil
+  movsx rsi, word ptr [rip+g1829]
+  add rsi, qword ptr [rip+g4183]
+  mov byte ptr [rip+g565], sil
+  movsxd rsi, dword ptr [rip+g3290]
+  movsx rdi, word ptr [rip+g2168]
+  add rsi, rdi
+  mov qword ptr [rip+g566], rsi
+  mov rsi, qword ptr [rip+g1010]
+  movsxd rdi, dword ptr [rip+g1783]
+  add rsi, rdi
+  mov byte ptr [rip+g567], sil
+  mov rsi, qword ptr [rip+g746]
+  movsx rdi, word ptr [rip+g3938]
+  add rsi, rdi
+  mov byte ptr [rip+g568], sil
+  movsxd rsi, dword ptr [rip+g1058]
+  movsxd rdi, dword ptr [rip+g3308]
+  add rsi, rdi
+  mov qword ptr [rip+g569], rsi
+  movsx rsi, byte ptr [rip+g560]
+  mov rax, rsi
+.L.return.u56:
+  ret
+.text
+.p2align 4
+.global u57
+u57:
+  mov rsi, qword ptr [rip+g3654]
+  movsx rdi, byte ptr [rip+g3111]
+  add rsi, rdi
+  mov qword ptr [rip+g570], rsi
+  mov rsi, qword ptr [rip+g789]
+  movsxd rdi, dword ptr [rip+g1890]
+  add rsi, rdi
+  mov qword ptr [rip+g571], rsi
+  mov rsi, qword ptr [rip+g1973]
+  movsxd rdi, dword ptr [rip+g4219]
+  add rsi, rdi
+  mov dword ptr [rip+g572], esi
+  mov rsi, qword ptr [rip+g1299]
+  movsx rdi, word ptr [rip+g1206]
+  add rsi, rdi
+  mov byte ptr [rip+g573], sil
+  mov rsi, qword ptr [rip+g4633]
+  movsx rdi, byte ptr [rip+g4387]
+  add rsi, rdi
+  mov word ptr [rip+g574], si
+  mov rsi, qword ptr [rip+g3479]
+  movsxd rdi, dword ptr [rip+g2827]
+  add rsi, rdi
+  mov byte ptr [rip+g575], sil
+  movsxd rsi, dword ptr [rip+g2233]
+  movsx rdi, byte ptr [rip+g3002]
+  add rsi, rdi
+  mov byte ptr [rip+g576], sil
+  mov rsi, qword ptr [rip+g3281]
+  add rsi, qword ptr [rip+g3817]
+  mov qword ptr [rip+g577], rsi
+  movsx rsi, word ptr [rip+g3316]
+  movsx rdi, word ptr [rip+g1647]
+  add rsi, rdi
+  mov word ptr [rip+g578], si
+  movsx rsi, byte ptr [rip+g3142]
+  movsx rdi, word ptr [rip+g3223]
+  add rsi, rdi
+  mov qword ptr [rip+g579], rsi
+  mov rax, qword ptr [rip+g570]
+.L.return.u57:
+  ret
+.text
+.p2align 4
+.global u58
+u58:
+  movsxd rsi, dword ptr [rip+g4650]
+  movsx rdi, word ptr [rip+g2156]
+  add rsi, rdi
+  mov dword ptr [rip+g580], esi
+  movsx rsi, byte ptr [rip+g4655]
+  movsx rdi, word ptr [rip+g1727]
+  add rsi, rdi
+  mov qword ptr [rip+g581], rsi
+  movsx rsi, word ptr [rip+g2323]
+  add rsi, qword ptr [rip+g1151]
+  mov byte ptr [rip+g582], sil
+  movsx rsi, byte ptr [rip+g2991]
+  movsxd rdi, dword ptr [rip+g1001]
+  add rsi, rdi
+  mov dword ptr [rip+g583], esi
+  mov rsi, qword ptr [rip+g831]
+  add rsi, qword ptr [rip+g1482]
+  mov word ptr [rip+g584], si
+  mov rsi, qword ptr [rip+g3748]
+  movsxd rdi, dword ptr [rip+g387]
+  add rsi, rdi
+  mov word ptr [rip+g585], si
+  movsx rsi, word ptr [rip+g2908]
+  add rsi, qword ptr [rip+g1634]
+  mov qword ptr [rip+g586], rsi
+  movsx rsi, byte ptr [rip+g3506]
+  add rsi, qword ptr [rip+g4739]
+  mov dword ptr [rip+g587], esi
+  movsxd rsi, dword ptr [rip+g4155]
+  add rsi, qword ptr [rip+g4623]
+  mov byte ptr [rip+g588], sil
+  movsxd rsi, dword ptr [rip+g2875]
+  movsx rdi, byte ptr [rip+g1193]
+  add rsi, rdi
+  mov word ptr [rip+g589], si
+  movsxd rsi, dword ptr [rip+g580]
+  mov rax, rsi
+.L.return.u58:
+  ret
+.text
+.p2align 4
+.global u59
+u59:
+  movsx rsi, word ptr [rip+g3105]
+  movsx rdi, word ptr [rip+g2428]
+  add rsi, rdi
+  mov word ptr [rip+g590], si
+  mov rsi, qword ptr [rip+g476]
+  movsx rdi, byte ptr [rip+g1294]
+  add rsi, rdi
+  mov byte ptr [rip+g591], sil
+  movsx rsi, word ptr [rip+g4849]
+  movsxd rdi, dword ptr [rip+g3]
+  add rsi, rdi
+  mov byte ptr [rip+g592], sil
+  mov rsi, qword ptr [rip+g122]
+  movsx rdi, byte ptr [rip+g4653]
+  add rsi, rdi
+  mov qword ptr [rip+g593], rsi
+  mov rsi, qword ptr [rip+g2165]
+  add rsi, qword ptr [rip+g2798]
+  mov word ptr [rip+g594], si
+  mov rsi, qword ptr [rip+g2294]
+  add rsi, qword ptr [rip+g3946]
+  mov byte ptr [rip+g595], sil
+  movsxd rsi, dword ptr [rip+g1944]
+  movsx rdi, byte ptr [rip+g1223]
+  add rsi, rdi
+  mov dword ptr [rip+g596], esi
+  mov rsi, qword ptr [rip+g416]
+  movsx rdi, byte ptr [rip+g4111]
+  add rsi, rdi
+  mov dword ptr [rip+g597], esi
+  movsxd rsi, dword ptr [rip+g1598]
+  movsx rdi, word ptr [rip+g906]
+  add rsi, rdi
+  mov word ptr [rip+g598], si
+  movsx rsi, byte ptr [rip+g4237]
+  movsxd rdi, dword ptr [rip+g1473]
+  add rsi, rdi
+  mov dword ptr [rip+g599], esi
+  movsx rsi, word ptr [rip+g590]
+  mov rax, rsi
+.L.return.u59:
+  ret
+.text
+.p2align 4
+.global u60
+u60:
+  mov rsi, qword ptr [rip+g3133]
+  movsx rdi, byte ptr [rip+g3083]
+  add rsi, rdi
+  mov dword ptr [rip+g600], esi
+  movsx rsi, word ptr [rip+g3942]
+  add rsi, qword ptr [rip+g3393]
+  mov qword ptr [rip+g601], rsi
+  movsxd rsi, dword ptr [rip+g3696]
+  movsxd rdi, dword ptr [rip+g380]
+  add rsi, rdi
+  mov word ptr [rip+g602], si
+  movsx rsi, word ptr [rip+g4423]
+  movsx rdi, byte ptr [rip+g3423]
+  add rsi, rdi
+  mov byte ptr [rip+g603], sil
+  movsx rsi, byte ptr [rip+g3203]
+  movsxd rdi, dword ptr [rip+g1643]
+  add rsi, rdi
+  mov dword ptr [rip+g604], esi
+  movsxd rsi, dword ptr [rip+g1942]
+  movsxd rdi, dword ptr [rip+g1737]
+  add rsi, rdi
+  mov byte ptr [rip+g605], sil
+  movsx rsi, word ptr [rip+g4095]
+  movsxd rdi, dword ptr [rip+g2442]
+  add rsi, rdi
+  mov qword ptr [rip+g606], rsi
+  movsxd rsi, dword ptr [rip+g326]
+  movsxd rdi, dword ptr [rip+g4]
+  add rsi, rdi
+  mov qword ptr [rip+g607], rsi
+  movsx rsi, word ptr [rip+g1433]
+  movsx rdi, word ptr [rip+g3101]
+  add rsi, rdi
+  mov dword ptr [rip+g608], esi
+  movsx rsi, word ptr [rip+g494]
+  movsx rdi, word ptr [rip+g503]
+  add rsi, rdi
+  mov byte ptr [rip+g609], sil
+  movsxd rsi, dword ptr [rip+g600]
+  mov rax, rsi
+.L.return.u60:
+  ret
+.text
+.p2align 4
+.global u61
+u61:
+  movsx rsi, word ptr [rip+g2149]
+  movsxd rdi, dword ptr [rip+g4825]
+  add rsi, rdi
+  mov word ptr [rip+g610], si
+  movsx rsi, word ptr [rip+g1516]
+  movsx rdi, byte ptr [rip+g1594]
+  add rsi, rdi
+  mov word ptr [rip+g611], si
+  movsxd rsi, dword ptr [rip+g4293]
+  add rsi, qword ptr [rip+g4117]
+  mov qword ptr [rip+g612], rsi
+  movsx rsi, byte ptr [rip+g516]
+  movsx rdi, byte ptr [rip+g4809]
+  add rsi, rdi
+  mov dword ptr [rip+g613], esi
+  mov rsi, qword ptr [rip+g1501]
+  add rsi, qword ptr [rip+g1721]
+  mov word ptr [rip+g614], si
+  movsx rsi, byte ptr [rip+g3007]
+  movsx rdi, word ptr [rip+g4388]
+  add rsi, rdi
+  mov qword ptr [rip+g615], rsi
+  mov rsi, qword ptr [rip+g374]
+  add rsi, qword ptr [rip+g1712]
+  mov dword ptr [rip+g616], esi
+  movsxd rsi, dword ptr [rip+g2756]
+  movsx rdi, word ptr [rip+g637]
+  add rsi, rdi
+  mov qword ptr [rip+g617], rsi
+  movsx rsi, byte ptr [rip+g1048]
+  add rsi, qword ptr [rip+g1457]
+  mov word ptr [rip+g618], si
+  movsx rsi, word ptr [rip+g1888]
+  movsx rdi, word ptr [rip+g3606]
+  add rsi, rdi
+  mov word ptr [rip+g619], si
+  movsx rsi, word ptr [rip+g610]
+  mov rax, rsi
+.L.return.u61:
+  ret
+.text
+.p2align 4
+.global u62
+u62:
+  movsx rsi, byte ptr [rip+g1460]
+  movsx rdi, word ptr [rip+g650]
+  add rsi, rdi
+  mov word ptr [rip+g620], si
+  movsx rsi, word ptr [rip+g2307]
+  movsxd rdi, dword ptr [rip+g4840]
+  add rsi, rdi
+  mov qword ptr [rip+g621], rsi
+  mov rsi, qword ptr [rip+g3708]
+  add rsi, qword ptr [rip+g3195]
+  mov qword ptr [rip+g622], rsi
+  movsxd rsi, dword ptr [rip+g16]
+  add rsi, qword ptr [rip+g643]
+  mov byte ptr [rip+g623], sil
+  movsx rsi, byte ptr [rip+g820]
+  add rsi, qword ptr [rip+g262]
+  mov dword ptr [rip+g624], esi
+  mov rsi, qword ptr [rip+g772]
+  movsx rdi, word ptr [rip+g2545]
+  add rsi, rdi
+  mov dword ptr [rip+g625], esi
+  mov rsi, qword ptr [rip+g4494]
+  movsx rdi, word ptr [rip+g441]
+  add rsi, rdi
+  mov qword ptr [rip+g626], rsi
+  mov rsi, qword ptr [rip+g3540]
+  add rsi, qword ptr [rip+g3901]
+  mov byte ptr [rip+g627], sil
+  movsxd rsi, dword ptr [rip+g3526]
+  movsx rdi, byte ptr [rip+g2707]
+  add rsi, rdi
+  mov byte ptr [rip+g628], sil
+  movsx rsi, word ptr [rip+g3487]
+  movsx rdi, byte ptr [rip+g647]
+  add rsi, rdi
+  mov qword ptr [rip+g629], rsi
+  movsx rsi, word ptr [rip+g620]
+  mov rax, rsi
+.L.return.u62:
+  ret
+.text
+.p2align 4
+.global u63
+u63:
+  movsx rsi, byte ptr [rip+g2778]
+  movsx rdi, word ptr [rip+g1181]
+  add rsi, rdi
+  mov qword ptr [rip+g630], rsi
+  movsx rsi, byte ptr [rip+g2216]
+  movsx rdi, word ptr [rip+g3298]
+  add rsi, rdi
+  mov word ptr [rip+g631], si
+  movsx rsi, word ptr [rip+g3954]
+  movsx rdi, word ptr [rip+g1257]
+  add rsi, rdi
+  mov byte ptr [rip+g632], sil
+  movsx rsi, word ptr [rip+g2690]
+  movsxd rdi, dword ptr [rip+g2414]
+  add rsi, rdi
+  mov word ptr [rip+g633], si
+  movsx rsi, word ptr [rip+g3703]
+  movsx rdi, word ptr [rip+g958]
+  add rsi, rdi
+  mov byte ptr [rip+g634], sil
+  movsx rsi, word ptr [rip+g8]
+  add rsi, qword ptr [rip+g346]
+  mov word ptr [rip+g635], si
+  movsx rsi, word ptr [rip+g131]
+  movsx rdi, byte ptr [rip+g2817]
+  add rsi, rdi
+  mov dword ptr [rip+g636], esi
+  mov rsi, qword ptr [rip+g4432]
+  movsx rdi, word ptr [rip+g2692]
+  add rsi, rdi
+  mov word ptr [rip+g637], si
+  movsx rsi, byte ptr [rip+g1952]
+  movsx rdi, byte ptr [rip+g1423]
+  add rsi, rdi
+  mov dword ptr [rip+g638], esi
+  mov rsi, qword ptr [rip+g3192]
+  movsx rdi, word ptr [rip+g4340]
+  add rsi, rdi
+  mov byte ptr [rip+g639], sil
+  mov rax, qword ptr [rip+g630]
+.L.return.u63:
+  ret
+.text
+.p2align 4
+.global u64
+u64:
+  movsx rsi, word ptr [rip+g4967]
+  movsx rdi, word ptr [rip+g80]
+  add rsi, rdi
+  mov word ptr [rip+g640], si
+  mov rsi, qword ptr [rip+g1122]
+  movsxd rdi, dword ptr [rip+g2237]
+  add rsi, rdi
+  mov word ptr [rip+g641], si
+  movsx rsi, word ptr [rip+g3149]
+  movsx rdi, word ptr [rip+g2999]
+  add rsi, rdi
+  mov qword ptr [rip+g642], rsi
+  movsxd rsi, dword ptr [rip+g3177]
+  movsx rdi, word ptr [rip+g113]
+  add rsi, rdi
+  mov qword ptr [rip+g643], rsi
+  movsx rsi, word ptr [rip+g3624]
+  movsx rdi, byte ptr [rip+g3758]
+  add rsi, rdi
+  mov dword ptr [rip+g644], esi
+  movsx rsi, word ptr [rip+g94]
+  movsxd rdi, dword ptr [rip+g4071]
+  add rsi, rdi
+  mov qword ptr [rip+g645], rsi
+  movsx rsi, word ptr [rip+g830]
+  movsx rdi, byte ptr [rip+g987]
+  add rsi, rdi
+  mov qword ptr [rip+g646], rsi
+  movsxd rsi, dword ptr [rip+g1502]
+  movsxd rdi, dword ptr [rip+g580]
+  add rsi, rdi
+  mov byte ptr [rip+g647], sil
+  mov rsi, qword ptr [rip+g4607]
+  add rsi, qword ptr [rip+g3937]
+  mov dword ptr [rip+g648], esi
+  movsxd rsi, dword ptr [rip+g2600]
+  movsx rdi, word ptr [rip+g2947]
+  add rsi, rdi
+  mov byte ptr [rip+g649], sil
+  movsx rsi, word ptr [rip+g640]
+  mov rax, rsi
+.L.return.u64:
+  ret
+.text
+.p2align 4
+.global u65
+u65:
+  movsx rsi, byte ptr [rip+g4584]
+  movsx rdi, byte ptr [rip+g2980]
+  add rsi, rdi
+  mov word ptr [rip+g650], si
+  movsx rsi, word ptr [rip+g2561]
+  movsx rdi, word ptr [rip+g3693]
+  add rsi, rdi
+  mov byte ptr [rip+g651], sil
+  mov rsi, qword ptr [rip+g959]
+  movsxd rdi, dword ptr [rip+g583]
+  add rsi, rdi
+  mov byte ptr [rip+g652], sil
+  movsx rsi, word ptr [rip+g3383]
+  movsx rdi, word ptr [rip+g4012]
+  add rsi, rdi
+  mov qword ptr [rip+g653], rsi
+  mov rsi, qword ptr [rip+g1211]
+  add rsi, qword ptr [rip+g1082]
+  mov word ptr [rip+g654], si
+  movsxd rsi, dword ptr [rip+g4683]
+  movsxd rdi, dword ptr [rip+g3700]
+  add rsi, rdi
+  mov qword ptr [rip+g655], rsi
+  movsxd rsi, dword ptr [rip+g2868]
+  movsxd rdi, dword ptr [rip+g4433]
+  add rsi, rdi
+  mov byte ptr [rip+g656], sil
+  movsx rsi, byte ptr [rip+g451]
+  movsx rdi, byte ptr [rip+g29]
+  add rsi, rdi
+  mov qword ptr [rip+g657], rsi
+  movsx rsi, byte ptr [rip+g3403]
+  movsx rdi, word ptr [rip+g635]
+  add rsi, rdi
+  mov qword ptr [rip+g658], rsi
+  mov rsi, qword ptr [rip+g579]
+  add rsi, qword ptr [rip+g3677]
+  mov qword ptr [rip+g659], rsi
+  movsx rsi, word ptr [rip+g650]
+  mov rax, rsi
+.L.return.u65:
+  ret
+.text
+.p2align 4
+.global u66
+u66:
+  mov rsi, qword ptr [rip+g3772]
+  add rsi, qword ptr [rip+g3715]
+  mov qword ptr [rip+g660], rsi
+  mov rsi, qword ptr [rip+g2731]
+  movsx rdi, word ptr [rip+g4823]
+  add rsi, rdi
+  mov word ptr [rip+g661], si
+  movsx rsi, word ptr [rip+g4693]
+  add rsi, qword ptr [rip+g4615]
+  mov dword ptr [rip+g662], esi
+  movsx rsi, word ptr [rip+g443]
+  movsx rdi, byte ptr [rip+g1088]
+  add rsi, rdi
+  mov byte ptr [rip+g663], sil
+  mov rsi, qword ptr [rip+g3020]
+  add rsi, qword ptr [rip+g322]
+  mov dword ptr [rip+g664], esi
+  movsx rsi, word ptr [rip+g4362]
+  movsxd rdi, dword ptr [rip+g2830]
+  add rsi, rdi
+  mov byte ptr [rip+g665], sil
+  mov rsi, qword ptr [rip+g107]
+  movsx rdi, word ptr [rip+g2799]
+  add rsi, rdi
+  mov word ptr [rip+g666], si
+  movsx rsi, word ptr [rip+g4366]
+  movsx rdi, byte ptr [rip+g4627]
+  add rsi, rdi
+  mov qword ptr [rip+g667], rsi
+  movsxd rsi, dword ptr [rip+g2602]
+  add rsi, qword ptr [rip+g1477]
+  mov word ptr [rip+g668], si
+  movsx rsi, byte ptr [rip+g1324]
+  movsx rdi, byte ptr [rip+g1027]
+  add rsi, rdi
+  mov dword ptr [rip+g669], esi
+  mov rax, qword ptr [rip+g660]
+.L.return.u66:
+  ret
+.text
+.p2align 4
+.global u67
+u67:
+  mov rsi, qword ptr [rip+g2444]
+  add rsi, qword ptr [rip+g1697]
+  mov word ptr [rip+g670], si
+  mov rsi, qword ptr [rip+g2904]
+  movsx rdi, byte ptr [rip+g4565]
+  add rsi, rdi
+  mov dword ptr [rip+g671], esi
+  movsxd rsi, dword ptr [rip+g3028]
+  add rsi, qword ptr [rip+g457]
+  mov qword ptr [rip+g672], rsi
+  movsxd rsi, dword ptr [rip+g2713]
+  add rsi, qword ptr [rip+g4089]
+  mov qword ptr [rip+g673], rsi
+  movsxd rsi, dword ptr [rip+g936]
+  movsx rdi, word ptr [rip+g710]
+  add rsi, rdi
+  mov word ptr [rip+g674], si
+  movsx rsi, word ptr [rip+g3088]
+  add rsi, qword ptr [rip+g4958]
+  mov qword ptr [rip+g675], rsi
+  movsxd rsi, dword ptr [rip+g1834]
+  movsx rdi, byte ptr [rip+g1593]
+  add rsi, rdi
+  mov qword ptr [rip+g676], rsi
+  movsx rsi, byte ptr [rip+g1694]
+  movsxd rdi, dword ptr [rip+g2895]
+  add rsi, rdi
+  mov word ptr [rip+g677], si
+  movsx rsi, byte ptr [rip+g176]
+  movsxd rdi, dword ptr [rip+g2080]
+  add rsi, rdi
+  mov qword ptr [rip+g678], rsi
+  mov rsi, qword ptr [rip+g1370]
+  movsx rdi, byte ptr [rip+g4360]
+  add rsi, rdi
+  mov byte ptr [rip+g679], sil
+  movsx rsi, word ptr [rip+g670]
+  mov rax, rsi
+.L.return.u67:
+  ret
+.text
+.p2align 4
+.global u68
+u68:
+  movsxd rsi, dword ptr [rip+g990]
+  movsxd rdi, dword ptr [rip+g870]
+  add rsi, rdi
+  mov word ptr [rip+g680], si
+  movsxd rsi, dword ptr [rip+g1752]
+  add rsi, qword ptr [rip+g2354]
+  mov dword ptr [rip+g681], esi
+  movsx rsi, byte ptr [rip+g1505]
+  movsxd rdi, dword ptr [rip+g1551]
+  add rsi, rdi
+  mov word ptr [rip+g682], si
+  movsx rsi, word ptr [rip+g3149]
+  add rsi, qword ptr [rip+g4882]
+  mov byte ptr [rip+g683], sil
+  movsx rsi, byte ptr [rip+g567]
+  add rsi, qword ptr [rip+g1467]
+  mov qword ptr [rip+g684], rsi
+  movsx rsi, byte ptr [rip+g3794]
+  movsxd rdi, dword ptr [rip+g4411]
+  add rsi, rdi
+  mov byte ptr [rip+g685], sil
+  movsx rsi, word ptr [rip+g294]
+  add rsi, qword ptr [rip+g2907]
+  mov qword ptr [rip+g686], rsi
+  movsxd rsi, dword ptr [rip+g3230]
+  movsx rdi, byte ptr [rip+g4867]
+  add rsi, rdi
+  mov word ptr [rip+g687], si
+  movsxd rsi, dword ptr [rip+g1744]
+  movsxd rdi, dword ptr [rip+g1436]
+  add rsi, rdi
+  mov qword ptr [rip+g688], rsi
+  movsx rsi, word ptr [rip+g4228]
+  movsx rdi, byte ptr [rip+g2167]
+  add rsi, rdi
+  mov word ptr [rip+g689], si
+  movsx rsi, word ptr [rip+g680]
+  mov rax, rsi
+.L.return.u68:
+  ret
+.text
+.p2align 4
+.global u69
+u69:
+  mov rsi, qword ptr [rip+g1185]
+  add rsi, qword ptr [rip+g3640]
+  mov byte ptr [rip+g690], sil
+  movsx rsi, byte ptr [rip+g1193]
+  movsx rdi, byte ptr [rip+g2894]
+  add rsi, rdi
+  mov word ptr [rip+g691], si
+  movsx rsi, byte ptr [rip+g3125]
+  movsx rdi, byte ptr [rip+g4759]
+  add rsi, rdi
+  mov byte ptr [rip+g692], sil
+  movsxd rsi, dword ptr [rip+g4903]
+  movsx rdi, word ptr [rip+g1623]
+  add rsi, rdi
+  mov word ptr [rip+g693], si
+  mov rsi, qword ptr [rip+g1455]
+  movsx rdi, byte ptr [rip+g3331]
+  add rsi, rdi
+  mov byte ptr [rip+g694], sil
+  movsx rsi, word ptr [rip+g2323]
+  movsx rdi, word ptr [rip+g1164]
+  add rsi, rdi
+  mov byte ptr [rip+g695], sil
+  movsx rsi, word ptr [rip+g3607]
+  movsx rdi, byte ptr [rip+g2707]
+  add rsi, rdi
+  mov qword ptr [rip+g696], rsi
+  movsx rsi, byte ptr [rip+g1048]
+  movsxd rdi, dword ptr [rip+g3159]
+  add rsi, rdi
+  mov byte ptr [rip+g697], sil
+  movsxd rsi, dword ptr [rip+g4179]
+  movsx rdi, byte ptr [rip+g3546]
+  add rsi, rdi
+  mov qword ptr [rip+g698], rsi
+  movsxd rsi, dword ptr [rip+g4349]
+  movsx rdi, word ptr [rip+g4012]
+  add rsi, rdi
+  mov dword ptr [rip+g699], esi
+  movsx rsi, byte ptr [rip+g690]
+  mov rax, rsi
+.L.return.u69:
+  ret
+.text
+.p2align 4
+.global u70
+u70:
+  movsx rsi, byte ptr [rip+g1237]
+  add rsi, qword ptr [rip+g2165]
+  mov byte ptr [rip+g700], sil
+  movsx rsi, word ptr [rip+g4780]
+  movsx rdi, byte ptr [rip+g88]
+  add rsi, rdi
+  mov qword ptr [rip+g701], rsi
+  mov rsi, qword ptr [rip+g570]
+  movsx rdi, byte ptr [rip+g438]
+  add rsi, rdi
+  mov qword ptr [rip+g702], rsi
+  movsx rsi, word ptr [rip+g788]
+  movsxd rdi, dword ptr [rip+g3627]
+  add rsi, rdi
+  mov word ptr [rip+g703], si
+  movsx rsi, word ptr [rip+g1909]
+  add rsi, qword ptr [rip+g262]
+  mov byte ptr [rip+g704], sil
+  movsxd rsi, dword ptr [rip+g4848]
+  movsxd rdi, dword ptr [rip+g2399]
+  add rsi, rdi
+  mov qword ptr [rip+g705], rsi
+  movsx rsi, byte ptr [rip+g483]
+  movsxd rdi, dword ptr [rip+g597]
+  add rsi, rdi
+  mov word ptr [rip+g706], si
+  movsx rsi, byte ptr [rip+g1222]
+  movsxd rdi, dword ptr [rip+g3993]
+  add rsi, rdi
+  mov qword ptr [rip+g707], rsi
+  movsx rsi, byte ptr [rip+g4638]
+  add rsi, qword ptr [rip+g2002]
+  mov qword ptr [rip+g708], rsi
+  movsxd rsi, dword ptr [rip+g3492]
+  movsx rdi, word ptr [rip+g2690]
+  add rsi, rdi
+  mov qword ptr [rip+g709], rsi
+  movsx rsi, byte ptr [rip+g700]
+  mov rax, rsi
+.L.return.u70:
+  ret
+.text
+.p2align 4
+.global u71
+u71:
+  movsx rsi, byte ptr [rip+g4124]
+  add rsi, qword ptr [rip+g1610]
+  mov word ptr [rip+g710], si
+  movsx rsi, word ptr [rip+g4392]
+  movsx rdi, byte ptr [rip+g1258]
+  add rsi, rdi
+  mov byte ptr [rip+g711], sil
+  movsx rsi, word ptr [rip+g4176]
+  movsxd rdi, dword ptr [rip+g3211]
+  add rsi, rdi
+  mov dword ptr [rip+g712], esi
+  movsxd rsi, dword ptr [rip+g234]
+  movsxd rdi, dword ptr [rip+g4786]
+  add rsi, rdi
+  mov dword ptr [rip+g713], esi
+  movsx rsi, byte ptr [rip+g3760]
+  movsx rdi, byte ptr [rip+g1989]
+  add rsi, rdi
+  mov dword ptr [rip+g714], esi
+  movsx rsi, word ptr [rip+g1520]
+  add rsi, qword ptr [rip+g2587]
+  mov dword ptr [rip+g715], esi
+  movsx rsi, byte ptr [rip+g4324]
+  movsx rdi, byte ptr [rip+g43]
+  add rsi, rdi
+  mov byte ptr [rip+g716], sil
+  movsx rsi, word ptr [rip+g1819]
+  movsx rdi, word ptr [rip+g4386]
+  add rsi, rdi
+  mov qword ptr [rip+g717], rsi
+  mov rsi, qword ptr [rip+g4913]
+  movsxd rdi, dword ptr [rip+g309]
+  add rsi, rdi
+  mov word ptr [rip+g718], si
+  movsxd rsi, dword ptr [rip+g3264]
+  add rsi, qword ptr [rip+g2719]
+  mov dword ptr [rip+g719], esi
+  movsx rsi, word ptr [rip+g710]
+  mov rax, rsi
+.L.return.u71:
+  ret
+.text
+.p2align 4
+.global u72
+u72:
+  movsx rsi, byte ptr [rip+g1022]
+  movsxd rdi, dword ptr [rip+g3200]
+  add rsi, rdi
+  mov word ptr [rip+g720], si
+  movsx rsi, word ptr [rip+g1965]
+  movsx rdi, byte ptr [rip+g784]
+  add rsi, rdi
+  mov qword ptr [rip+g721], rsi
+  movsx rsi, byte ptr [rip+g973]
+  movsx rdi, byte ptr [rip+g2770]
+  add rsi, rdi
+  mov byte ptr [rip+g722], sil
+  mov rsi, qword ptr [rip+g586]
+  movsx rdi, word ptr [rip+g773]
+  add rsi, rdi
+  mov dword ptr [rip+g723], esi
+  mov rsi, qword ptr [rip+g4938]
+  movsxd rdi, dword ptr [rip+g34]
+  add rsi, rdi
+  mov dword ptr [rip+g724], esi
+  movsx rsi, word ptr [rip+g325]
+  add rsi, qword ptr [rip+g3374]
+  mov qword ptr [rip+g725], rsi
+  movsxd rsi, dword ptr [rip+g4450]
+  movsx rdi, byte ptr [rip+g592]
+  add rsi, rdi
+  mov dword ptr [rip+g726], esi
+  mov rsi, qword ptr [rip+g4860]
+  add rsi, qword ptr [rip+g376]
+  mov word ptr [rip+g727], si
+  mov rsi, qword ptr [rip+g2272]
+  movsx rdi, word ptr [rip+g242]
+  add rsi, rdi
+  mov dword ptr [rip+g728], esi
+  movsx rsi, word ptr [rip+g3594]
+  movsxd rdi, dword ptr [rip+g1765]
+  add rsi, rdi
+  mov byte ptr [rip+g729], sil
+  movsx rsi, word ptr [rip+g720]
+  mov rax, rsi
+.L.return.u72:
+  ret
+.text
+.p2align 4
+.global u73
+u73:
+  movsxd rsi, dword ptr [rip+g4411]
+  movsx rdi, word ptr [rip+g492]
+  add rsi, rdi
+  mov word ptr [rip+g730], si
+  movsx rsi, word ptr [rip+g294]
+  movsxd rdi, dword ptr [rip+g954]
+  add rsi, rdi
+  mov word ptr [rip+g731], si
+  movsx rsi, word ptr [rip+g2029]
+  movsx rdi, word ptr [rip+g2457]
+  add rsi, rdi
+  mov dword ptr [rip+g732], esi
+  movsx rsi, word ptr [rip+g4942]
+  movsx rdi, byte ptr [rip+g4838]
+  add rsi, rdi
+  mov qword ptr [rip+g733], rsi
+  movsxd rsi, dword ptr [rip+g206]
+  movsxd rdi, dword ptr [rip+g1950]
+  add rsi, rdi
+  mov dword ptr [rip+g734], esi
+  movsx rsi, byte ptr [rip+g38]
+  movsx rdi, byte ptr [rip+g3372]
+  add rsi, rdi
+  mov byte ptr [rip+g735], sil
+  mov rsi, qword ptr [rip+g2563]
+  movsx rdi, byte ptr [rip+g4730]
+  add rsi, rdi
+  mov qword ptr [rip+g736], rsi
+  movsx rsi, byte ptr [rip+g2476]
+  add rsi, qword ptr [rip+g1413]
+  mov byte ptr [rip+g737], sil
+  movsxd rsi, dword ptr [rip+g511]
+  movsx rdi, byte ptr [rip+g812]
+  add rsi, rdi
+  mov word ptr [rip+g738], si
+  mov rsi, qword ptr [rip+g1282]
+  movsxd rdi, dword ptr [rip+g3530]
+  add rsi, rdi
+  mov dword ptr [rip+g739], esi
+  movsx rsi, word ptr [rip+g730]
+  mov rax, rsi
+.L.return.u73:
+  ret
+.text
+.p2align 4
+.global u74
+u74:
+  movsx rsi, byte ptr [rip+g2728]
+  movsx rdi, word ptr [rip+g4306]
+  add rsi, rdi
+  mov dword ptr [rip+g740], esi
+  mov rsi, qword ptr [rip+g3484]
+  movsx rdi, word ptr [rip+g3031]
+  add rsi, rdi
+  mov byte ptr [rip+g741], sil
+  movsxd rsi, dword ptr [rip+g4903]
+  movsx rdi, word ptr [rip+g926]
+  add rsi, rdi
+  mov byte ptr [rip+g742], sil
+  movsx rsi, byte ptr [rip+g4867]
+  movsxd rdi, dword ptr [rip+g4166]
+  add rsi, rdi
+  mov qword ptr [rip+g743], rsi
+  movsxd rsi, dword ptr [rip+g4896]
+  add rsi, qword ptr [rip+g3053]
+  mov qword ptr [rip+g744], rsi
+  mov rsi, qword ptr [rip+g1936]
+  movsx rdi, byte ptr [rip+g4209]
+  add rsi, rdi
+  mov word ptr [rip+g745], si
+  movsx rsi, byte ptr [rip+g1355]
+  movsxd rdi, dword ptr [rip+g4931]
+  add rsi, rdi
+  mov qword ptr [rip+g746], rsi
+  movsxd rsi, dword ptr [rip+g4469]
+  movsx rdi, word ptr [rip+g4510]
+  add rsi, rdi
+  mov byte ptr [rip+g747], sil
+  movsxd rsi, dword ptr [rip+g2730]
+  add rsi, qword ptr [rip+g314]
+  mov qword ptr [rip+g748], rsi
+  movsx rsi, byte ptr [rip+g4933]
+  movsxd rdi, dword ptr [rip+g3931]
+  add rsi, rdi
+  mov qword ptr [rip+g749], rsi
+  movsxd rsi, dword ptr [rip+g740]
+  mov rax, rsi
+.L.return.u74:
+  ret
+.text
+.p2align 4
+.global u75
+u75:
+  movsx rsi, byte ptr [rip+g4448]
+  add rsi, qword ptr [rip+g2189]
+  mov qword ptr [rip+g750], rsi
+  movsx rsi, word ptr [rip+g4102]
+  movsx rdi, word ptr [rip+g2277]
+  add rsi, rdi
+  mov dword ptr [rip+g751], esi
+  movsx rsi, byte ptr [rip+g3468]
+  movsx rdi, word ptr [rip+g2333]
+  add rsi, rdi
+  mov word ptr [rip+g752], si
+  movsx rsi, byte ptr [rip+g3643]
+  movsx rdi, word ptr [rip+g3356]
+  add rsi, rdi
+  mov qword ptr [rip+g753], rsi
+  movsx rsi, word ptr [rip+g4050]
+  movsxd rdi, dword ptr [rip+g3831]
+  add rsi, rdi
+  mov word ptr [rip+g754], si
+  movsx rsi, byte ptr [rip+g1994]
+  movsxd rdi, dword ptr [rip+g163]
+  add rsi, rdi
+  mov qword ptr [rip+g755], rsi
+  movsxd rsi, dword ptr [rip+g3853]
+  add rsi, qword ptr [rip+g4567]
+  mov byte ptr [rip+g756], sil
+  movsx rsi, byte ptr [rip+g4060]
+  movsx rdi, word ptr [rip+g4340]
+  add rsi, rdi
+  mov byte ptr [rip+g757], sil
+  movsx rsi, byte ptr [rip+g55]
+  movsxd rdi, dword ptr [rip+g1834]
+  add rsi, rdi
+  mov word ptr [rip+g758], si
+  movsx rsi, byte ptr [rip+g192]
+  add rsi, qword ptr [rip+g1139]
+  mov qword ptr [rip+g759], rsi
+  mov rax, qword ptr [rip+g750]
+.L.return.u75:
+  ret
+.text
+.p2align 4
+.global u76
+u76:
+  movsx rsi, word ptr [rip+g3785]
+  movsx rdi, byte ptr [rip+g2195]
+  add rsi, rdi
+  mov byte ptr [rip+g760], sil
+  movsx rsi, byte ptr [rip+g2299]
+  movsxd rdi, dword ptr [rip+g3511]
+  add rsi, rdi
+  mov dword ptr [rip+g761], esi
+  movsxd rsi, dword ptr [rip+g4071]
+  add rsi, qword ptr [rip+g4610]
+  mov qword ptr [rip+g762], rsi
+  movsx rsi, byte ptr [rip+g2905]
+  movsxd rdi, dword ptr [rip+g4587]
+  add rsi, rdi
+  mov dword ptr [rip+g763], esi
+  movsx rsi, byte ptr [rip+g2984]
+  movsx rdi, word ptr [rip+g4205]
+  add rsi, rdi
+  mov byte ptr [rip+g764], sil
+  movsx rsi, byte ptr [rip+g3595]
+  movsx rdi, byte ptr [rip+g4040]
+  add rsi, rdi
+  mov word ptr [rip+g765], si
+  movsx rsi, byte ptr [rip+g4376]
+  movsx rdi, word ptr [rip+g4025]
+  add rsi, rdi
+  mov dword ptr [rip+g766], esi
+  movsx rsi, word ptr [rip+g2744]
+  movsx rdi, byte ptr [rip+g4857]
+  add rsi, rdi
+  mov qword ptr [rip+g767], rsi
+  movsxd rsi, dword ptr [rip+g3993]
+  add rsi, qword ptr [rip+g3407]
+  mov word ptr [rip+g768], si
+  movsx rsi, word ptr [rip+g602]
+  movsx rdi, byte ptr [rip+g887]
+  add rsi, rdi
+  mov byte ptr [rip+g769], sil
+  movsx rsi, byte ptr [rip+g760]
+  mov rax, rsi
+.L.return.u76:
+  ret
+.text
+.p2align 4
+.global u77
+u77:
+  mov rsi, qword ptr [rip+g3653]
+  movsx rdi, byte ptr [rip+g3731]
+  add rsi, rdi
+  mov word ptr [rip+g770], si
+  movsx rsi, byte ptr [rip+g2640]
+  movsx rdi, byte ptr [rip+g4702]
+  add rsi, rdi
+  mov dword ptr [rip+g771], esi
+  movsx rsi, byte ptr [rip+g2546]
+  add rsi, qword ptr [rip+g2316]
+  mov qword ptr [rip+g772], rsi
+  mov rsi, qword ptr [rip+g3805]
+  movsx rdi, word ptr [rip+g782]
+  add rsi, rdi
+  mov word ptr [rip+g773], si
+  movsx rsi, byte ptr [rip+g4487]
+  add rsi, qword ptr [rip+g841]
+  mov qword ptr [rip+g774], rsi
+  movsx rsi, word ptr [rip+g2045]
+  movsxd rdi, dword ptr [rip+g2466]
+  add rsi, rdi
+  mov byte ptr [rip+g775], sil
+  mov rsi, qword ptr [rip+g1073]
+  movsx rdi, byte ptr [rip+g3359]
+  add rsi, rdi
+  mov word ptr [rip+g776], si
+  movsx rsi, word ptr [rip+g3642]
+  movsx rdi, word ptr [rip+g4472]
+  add rsi, rdi
+  mov word ptr [rip+g777], si
+  movsx rsi, word ptr [rip+g893]
+  add rsi, qword ptr [rip+g4097]
+  mov qword ptr [rip+g778], rsi
+  movsx rsi, byte ptr [rip+g1630]
+  movsxd rdi, dword ptr [rip+g4055]
+  add rsi, rdi
+  mov qword ptr [rip+g779], rsi
+  movsx rsi, word ptr [rip+g770]
+  mov rax, rsi
+.L.return.u77:
+  ret
+.text
+.p2align 4
+.global u78
+u78:
+  movsx rsi, byte ptr [rip+g1545]
+  add rsi, qword ptr [rip+g579]
+  mov qword ptr [rip+g780], rsi
+  movsx rsi, byte ptr [rip+g97]
+  movsx rdi, byte ptr [rip+g4282]
+  add rsi, rdi
+  mov byte ptr [rip+g781], sil
+  movsxd rsi, dword ptr [rip+g1603]
+  movsxd rdi, dword ptr [rip+g2772]
+  add rsi, rdi
+  mov word ptr [rip+g782], si
+  movsx rsi, word ptr [rip+g4910]
+  movsxd rdi, dword ptr [rip+g2217]
+  add rsi, rdi
+  mov word ptr [rip+g783], si
+  movsx rsi, word ptr [rip+g289]
+  add rsi, qword ptr [rip+g2881]
+  mov byte ptr [rip+g784], sil
+  movsx rsi, byte ptr [rip+g1452]
+  movsxd rdi, dword ptr [rip+g726]
+  add rsi, rdi
+  mov dword ptr [rip+g785], esi
+  mov rsi, qword ptr [rip+g1521]
+  add rsi, qword ptr [rip+g3946]
+  mov dword ptr [rip+g786], esi
+  mov rsi, qword ptr [rip+g4826]
+  add rsi, qword ptr [rip+g2210]
+  mov dword ptr [rip+g787], esi
+  movsxd rsi, dword ptr [rip+g4415]
+  movsx rdi, byte ptr [rip+g4506]
+  add rsi, rdi
+  mov word ptr [rip+g788], si
+  movsx rsi, byte ptr [rip+g3109]
+  movsxd rdi, dword ptr [rip+g2626]
+  add rsi, rdi
+  mov qword ptr [rip+g789], rsi
+  mov rax, qword ptr [rip+g780]
+.L.return.u78:
+  ret
+.text
+.p2align 4
+.global u79
+u79:
+  mov rsi, qword ptr [rip+g1357]
+  movsx rdi, word ptr [rip+g4604]
+  add rsi, rdi
+  mov qword ptr [rip+g790], rsi
+  mov rsi, qword ptr [rip+g352]
+  movsx rdi, word ptr [rip+g611]
+  add rsi, rdi
+  mov dword ptr [rip+g791], esi
+  movsxd rsi, dword ptr [rip+g453]
+  movsxd rdi, dword ptr [rip+g4466]
+  add rsi, rdi
+  mov word ptr [rip+g792], si
+  movsx rsi, byte ptr [rip+g1115]
+  movsxd rdi, dword ptr [rip+g3104]
+  add rsi, rdi
+  mov qword ptr [rip+g793], rsi
+  movsxd rsi, dword ptr [rip+g1291]
+  movsx rdi, byte ptr [rip+g3516]
+  add rsi, rdi
+  mov qword ptr [rip+g794], rsi
+  movsx rsi, word ptr [rip+g4967]
+  movsx rdi, byte ptr [rip+g3416]
+  add rsi, rdi
+  mov byte ptr [rip+g795], sil
+  movsxd rsi, dword ptr [rip+g544]
+  add rsi, qword ptr [rip+g246]
+  mov byte ptr [rip+g796], sil
+  mov rsi, qword ptr [rip+g4138]
+  movsx rdi, word ptr [rip+g2017]
+  add rsi, rdi
+  mov byte ptr [rip+g797], sil
+  movsxd rsi, dword ptr [rip+g880]
+  add rsi, qword ptr [rip+g3124]
+  mov word ptr [rip+g798], si
+  mov rsi, qword ptr [rip+g3168]
+  add rsi, qword ptr [rip+g2549]
+  mov dword ptr [rip+g799], esi
+  mov rax, qword ptr [rip+g790]
+.L.return.u79:
+  ret
+.text
+.p2align 4
+.global u80
+u80:
+  movsx rsi, word ptr [rip+g4136]
+  movsx rdi, byte ptr [rip+g3816]
+  add rsi, rdi
+  mov word ptr [rip+g800], si
+  movsx rsi, word ptr [rip+g2235]
+  movsxd rdi, dword ptr [rip+g4173]
+  add rsi, rdi
+  mov qword ptr [rip+g801], rsi
+  movsxd rsi, dword ptr [rip+g4063]
+  movsx rdi, word ptr [rip+g4964]
+  add rsi, rdi
+  mov word ptr [rip+g802], si
+  mov rsi, qword ptr [rip+g411]
+  movsx rdi, word ptr [rip+g3616]
+  add rsi, rdi
+  mov dword ptr [rip+g803], esi
+  movsx rsi, byte ptr [rip+g2945]
+  movsx rdi, word ptr [rip+g2973]
+  add rsi, rdi
+  mov qword ptr [rip+g804], rsi
+  movsx rsi, word ptr [rip+g965]
+  movsxd rdi, dword ptr [rip+g960]
+  add rsi, rdi
+  mov dword ptr [rip+g805], esi
+  movsx rsi, word ptr [rip+g4643]
+  movsxd rdi, dword ptr [rip+g1729]
+  add rsi, rdi
+  mov word ptr [rip+g806], si
+  movsx rsi, word ptr [rip+g199]
+  movsxd rdi, dword ptr [rip+g4527]
+  add rsi, rdi
+  mov word ptr [rip+g807], si
+  movsxd rsi, dword ptr [rip+g916]
+  movsx rdi, byte ptr [rip+g4317]
+  add rsi, rdi
+  mov qword ptr [rip+g808], rsi
+  movsx rsi, byte ptr [rip+g2427]
+  movsx rdi, byte ptr [rip+g1484]
+  add rsi, rdi
+  mov dword ptr [rip+g809], esi
+  movsx rsi, word ptr [rip+g800]
+  mov rax, rsi
+.L.return.u80:
+  ret
+.text
+.p2align 4
+.global u81
+u81:
+  movsx rsi, byte ptr [rip+g55]
+  movsx rdi, byte ptr [rip+g1772]
+  add rsi, rdi
+  mov dword ptr [rip+g810], esi
+  movsxd rsi, dword ptr [rip+g2469]
+  add rsi, qword ptr [rip+g2144]
+  mov qword ptr [rip+g811], rsi
+  movsx rsi, word ptr [rip+g930]
+  add rsi, qword ptr [rip+g959]
+  mov byte ptr [rip+g812], sil
+  movsx rsi, byte ptr [rip+g117]
+  movsx rdi, byte ptr [rip+g968]
+  add rsi, rdi
+  mov qword ptr [rip+g813], rsi
+  mov rsi, qword ptr [rip+g3494]
+  add rsi, qword ptr [rip+g1114]
+  mov word ptr [rip+g814], si
+  mov rsi, qword ptr [rip+g2226]
+  movsx rdi, word ptr [rip+g1293]
+  add rsi, rdi
+  mov dword ptr [rip+g815], esi
+  mov rsi, qword ptr [rip+g4042]
+  movsx rdi, word ptr [rip+g465]
+  add rsi, rdi
+  mov word ptr [rip+g816], si
+  movsx rsi, byte ptr [rip+g679]
+  movsx rdi, byte ptr [rip+g4281]
+  add rsi, rdi
+  mov qword ptr [rip+g817], rsi
+  movsx rsi, word ptr [rip+g1813]
+  add rsi, qword ptr [rip+g2468]
+  mov byte ptr [rip+g818], sil
+  movsx rsi, byte ptr [rip+g1019]
+  movsx rdi, word ptr [rip+g100]
+  add rsi, rdi
+  mov word ptr [rip+g819], si
+  movsxd rsi, dword ptr [rip+g810]
+  mov rax, rsi
+.L.return.u81:
+  ret
+.text
+.p2align 4
+.global u82
+u82:
+  movsx rsi, word ptr [rip+g2928]
+  add rsi, qword ptr [rip+g4283]
+  mov byte ptr [rip+g820], sil
+  movsxd rsi, dword ptr [rip+g4840]
+  movsx rdi, word ptr [rip+g3840]
+  add rsi, rdi
+  mov qword ptr [rip+g821], rsi
+  movsx rsi, word ptr [rip+g1023]
+  movsx rdi, byte ptr [rip+g4781]
+  add rsi, rdi
+  mov word ptr [rip+g822], si
+  movsxd rsi, dword ptr [rip+g1373]
+  add rsi, qword ptr [rip+g2617]
+  mov qword ptr [rip+g823], rsi
+  movsx rsi, byte ptr [rip+g2991]
+  movsx rdi, byte ptr [rip+g4031]
+  add rsi, rdi
+  mov dword ptr [rip+g824], esi
+  mov rsi, qword ptr [rip+g4773]
+  movsxd rdi, dword ptr [rip+g136]
+  add rsi, rdi
+  mov dword ptr [rip+g825], esi
+  movsx rsi, word ptr [rip+g4151]
+  movsx rdi, word ptr [rip+g296]
+  add rsi, rdi
+  mov word ptr [rip+g826], si
+  mov rsi, qword ptr [rip+g3613]
+  movsxd rdi, dword ptr [rip+g2228]
+  add rsi, rdi
+  mov byte ptr [rip+g827], sil
+  movsx rsi, word ptr [rip+g3064]
+  add rsi, qword ptr [rip+g3021]
+  mov dword ptr [rip+g828], esi
+  movsx rsi, word ptr [rip+g4142]
+  movsxd rdi, dword ptr [rip+g1092]
+  add rsi, rdi
+  mov word ptr [rip+g829], si
+  movsx rsi, byte ptr [rip+g820]
+  mov rax, rsi
+.L.return.u82:
+  ret
+.text
+.p2align 4
+.global u83
+u83:
+  mov rsi, qword ptr [rip+g1818]
+  add rsi, qword ptr [rip+g3287]
+  mov word ptr [rip+g830], si
+  mov rsi, qword ptr [rip+g2198]
+  movsx rdi, byte ptr [rip+g3468]
+  add rsi, rdi
+  mov qword ptr [rip+g831], rsi
+  mov rsi, qword ptr [rip+g353]
+  movsx rdi, word ptr [rip+g1214]
+  add rsi, rdi
+  mov dword ptr [rip+g832], esi
+  movsx rsi, byte ptr [rip+g4692]
+  movsxd rdi, dword ptr [rip+g2081]
+  add rsi, rdi
+  mov byte ptr [rip+g833], sil
+  mov rsi, qword ptr [rip+g2387]
+  add rsi, qword ptr [rip+g4564]
+  mov byte ptr [rip+g834], sil
+  mov rsi, qword ptr [rip+g1693]
+  add rsi, qword ptr [rip+g3697]
+  mov byte ptr [rip+g835], sil
+  movsx rsi, byte ptr [rip+g2397]
+  movsx rdi, byte ptr [rip+g1415]
+  add rsi, rdi
+  mov byte ptr [rip+g836], sil
+  mov rsi, qword ptr [rip+g846]
+  movsx rdi, word ptr [rip+g3861]
+  add rsi, rdi
+  mov byte ptr [rip+g837], sil
+  movsx rsi, word ptr [rip+g1268]
+  movsx rdi, byte ptr [rip+g4310]
+  add rsi, rdi
+  mov word ptr [rip+g838], si
+  movsx rsi, word ptr [rip+g680]
+  movsxd rdi, dword ptr [rip+g3831]
+  add rsi, rdi
+  mov byte ptr [rip+g839], sil
+  movsx rsi, word ptr [rip+g830]
+  mov rax, rsi
+.L.return.u83:
+  ret
+.text
+.p2align 4
+.global u84
+u84:
+  movsx rsi, byte ptr [rip+g1406]
+  movsx rdi, byte ptr [rip+g1784]
+  add rsi, rdi
+  mov word ptr [rip+g840], si
+  movsx rsi, byte ptr [rip+g1916]
+  add rsi, qword ptr [rip+g368]
+  mov qword ptr [rip+g841], rsi
+  movsxd rsi, dword ptr [rip+g1845]
+  movsx rdi, byte ptr [rip+g3341]
+  add rsi, rdi
+  mov qword ptr [rip+g842], rsi
+  movsx rsi, word ptr [rip+g2774]
+  movsx rdi, word ptr [rip+g79]
+  add rsi, rdi
+  mov word ptr [rip+g843], si
+  movsx rsi, byte ptr [rip+g2476]
+  movsx rdi, word ptr [rip+g145]
+  add rsi, rdi
+  mov word ptr [rip+g844], si
+  movsx rsi, word ptr [rip+g4898]
+  movsxd rdi, dword ptr [rip+g2092]
+  add rsi, rdi
+  mov qword ptr [rip+g845], rsi
+  movsx rsi, byte ptr [rip+g2167]
+  movsxd rdi, dword ptr [rip+g1729]
+  add rsi, rdi
+  mov qword ptr [rip+g846], rsi
+  mov rsi, qword ptr [rip+g4868]
+  movsx rdi, byte ptr [rip+g1937]
+  add rsi, rdi
+  mov word ptr [rip+g847], si
+  mov rsi, qword ptr [rip+g4995]
+  movsx rdi, word ptr [rip+g754]
+  add rsi, rdi
+  mov word ptr [rip+g848], si
+  movsx rsi, word ptr [rip+g1100]
+  movsxd rdi, dword ptr [rip+g937]
+  add rsi, rdi
+  mov qword ptr [rip+g849], rsi
+  movsx rsi, word ptr [rip+g840]
+  mov rax, rsi
+.L.return.u84:
+  ret
+.text
+.p2align 4
+.global u85
+u85:
+  movsx rsi, word ptr [rip+g2029]
+  movsxd rdi, dword ptr [rip+g4852]
+  add rsi, rdi
+  mov dword ptr [rip+g850], esi
+  movsx rsi, word ptr [rip+g3842]
+  movsx rdi, byte ptr [rip+g2355]
+  add rsi, rdi
+  mov word ptr [rip+g851], si
+  movsx rsi, word ptr [rip+g585]
+  movsxd rdi, dword ptr [rip+g1068]
+  add rsi, rdi
+  mov byte ptr [rip+g852], sil
+  movsx rsi, byte ptr [rip+g2337]
+  movsx rdi, byte ptr [rip+g4989]
+  add rsi, rdi
+  mov qword ptr [rip+g853], rsi
+  movsx rsi, byte ptr [rip+g424]
+  movsx rdi, byte ptr [rip+g2128]
+  add rsi, rdi
+  mov word ptr [rip+g854], si
+  movsx rsi, word ptr [rip+g2692]
+  add rsi, qword ptr [rip+g3585]
+  mov dword ptr [rip+g855], esi
+  movsx rsi, word ptr [rip+g1584]
+  movsx rdi, word ptr [rip+g4718]
+  add rsi, rdi
+  mov qword ptr [rip+g856], rsi
+  movsx rsi, byte ptr [rip+g722]
+  add rsi, qword ptr [rip+g3626]
+  mov byte ptr [rip+g857], sil
+  movsxd rsi, dword ptr [rip+g3284]
+  movsx rdi, byte ptr [rip+g2193]
+  add rsi, rdi
+  mov word ptr [rip+g858], si
+  mov rsi, qword ptr [rip+g40]
+  movsx rdi, byte ptr [rip+g2843]
+  add rsi, rdi
+  mov dword ptr [rip+g859], esi
+  movsxd rsi, dword ptr [rip+g850]
+  mov rax, rsi
+.L.return.u85:
+  ret
+.text
+.p2align 4
+.global u86
+u86:
+  movsxd rsi, dword ptr [rip+g4816]
+  movsx rdi, word ptr [rip+g3385]
+  add rsi, rdi
+  mov word ptr [rip+g860], si
+  movsxd rsi, dword ptr [rip+g1456]
+  add rsi, qword ptr [rip+g92]
+  mov qword ptr [rip+g861], rsi
+  movsx rsi, word ptr [rip+g2457]
+  add rsi, qword ptr [rip+g2465]
+  mov byte ptr [rip+g862], sil
+  movsxd rsi, dword ptr [rip+g2535]
+  movsx rdi, word ptr [rip+g670]
+  add rsi, rdi
+  mov qword ptr [rip+g863], rsi
+  mov rsi, qword ptr [rip+g4845]
+  add rsi, qword ptr [rip+g1721]
+  mov byte ptr [rip+g864], sil
+  movsxd rsi, dword ptr [rip+g870]
+  add rsi, qword ptr [rip+g1859]
+  mov dword ptr [rip+g865], esi
+  movsx rsi, byte ptr [rip+g1670]
+  add rsi, qword ptr [rip+g3141]
+  mov dword ptr [rip+g866], esi
+  mov rsi, qword ptr [rip+g229]
+  add rsi, qword ptr [rip+g801]
+  mov byte ptr [rip+g867], sil
+  movsxd rsi, dword ptr [rip+g4578]
+  movsx rdi, word ptr [rip+g2598]
+  add rsi, rdi
+  mov qword ptr [rip+g868], rsi
+  movsx rsi, byte ptr [rip+g1021]
+  movsx rdi, word ptr [rip+g3045]
+  add rsi, rdi
+  mov dword ptr [rip+g869], esi
+  movsx rsi, word ptr [rip+g860]
+  mov rax, rsi
+.L.return.u86:
+  ret
+.text
+.p2align 4
+.global u87
+u87:
+  movsx rsi, byte ptr [rip+g2933]
+  add rsi, qword ptr [rip+g378]
+  mov dword ptr [rip+g870], esi
+  movsx rsi, word ptr [rip+g4885]
+  movsx rdi, byte ptr [rip+g4782]
+  add rsi, rdi
+  mov byte ptr [rip+g871], sil
+  mov rsi, qword ptr [rip+g2638]
+  movsx rdi, word ptr [rip+g4226]
+  add rsi, rdi
+  mov byte ptr [rip+g872], sil
+  movsx rsi, byte ptr [rip+g3978]
+  movsx rdi, word ptr [rip+g2888]
+  add rsi, rdi
+  mov word ptr [rip+g873], si
+  mov rsi, qword ptr [rip+g3805]
+  movsx rdi, byte ptr [rip+g111]
+  add rsi, rdi
+  mov byte ptr [rip+g874], sil
+  movsx rsi, word ptr [rip+g3987]
+  add rsi, qword ptr [rip+g1613]
+  mov byte ptr [rip+g875], sil
+  movsx rsi, byte ptr [rip+g4313]
+  movsxd rdi, dword ptr [rip+g4336]
+  add rsi, rdi
+  mov dword ptr [rip+g876], esi
+  movsxd rsi, dword ptr [rip+g4630]
+  movsx rdi, byte ptr [rip+g694]
+  add rsi, rdi
+  mov dword ptr [rip+g877], esi
+  movsx rsi, byte ptr [rip+g1421]
+  movsx rdi, byte ptr [rip+g4811]
+  add rsi, rdi
+  mov word ptr [rip+g878], si
+  mov rsi, qword ptr [rip+g2558]
+  movsxd rdi, dword ptr [rip+g3362]
+  add rsi, rdi
+  mov word ptr [rip+g879], si
+  movsxd rsi, dword ptr [rip+g870]
+  mov rax, rsi
+.L.return.u87:
+  ret
+.text
+.p2align 4
+.global u88
+u88:
+  movsx rsi, word ptr [rip+g4082]
+  movsxd rdi, dword ptr [rip+g4385]
+  add rsi, rdi
+  mov dword ptr [rip+g880], esi
+  mov rsi, qword ptr [rip+g3963]
+  movsxd rdi, dword ptr [rip+g3522]
+  add rsi, rdi
+  mov byte ptr [rip+g881], sil
+  movsx rsi, byte ptr [rip+g4655]
+  movsx rdi, byte ptr [rip+g769]
+  add rsi, rdi
+  mov word ptr [rip+g882], si
+  movsx rsi, byte ptr [rip+g2351]
+  movsx rdi, word ptr [rip+g85]
+  add rsi, rdi
+  mov word ptr [rip+g883], si
+  movsx rsi, word ptr [rip+g1339]
+  movsxd rdi, dword ptr [rip+g3662]
+  add rsi, rdi
+  mov dword ptr [rip+g884], esi
+  movsxd rsi, dword ptr [rip+g1665]
+  add rsi, qword ptr [rip+g1923]
+  mov word ptr [rip+g885], si
+  movsxd rsi, dword ptr [rip+g728]
+  movsx rdi, byte ptr [rip+g2088]
+  add rsi, rdi
+  mov word ptr [rip+g886], si
+  movsxd rsi, dword ptr [rip+g2107]
+  add rsi, qword ptr [rip+g2496]
+  mov byte ptr [rip+g887], sil
+  movsx rsi, byte ptr [rip+g1161]
+  movsx rdi, byte ptr [rip+g3990]
+  add rsi, rdi
+  mov word ptr [rip+g888], si
+  movsxd rsi, dword ptr [rip+g3728]
+  movsx rdi, word ptr [rip+g2774]
+  add rsi, rdi
+  mov word ptr [rip+g889], si
+  movsxd rsi, dword ptr [rip+g880]
+  mov rax, rsi
+.L.return.u88:
+  ret
+.text
+.p2align 4
+.global u89
+u89:
+  movsxd rsi, dword ptr [rip+g3060]
+  movsx rdi, byte ptr [rip+g1415]
+  add rsi, rdi
+  mov byte ptr [rip+g890], sil
+  mov rsi, qword ptr [rip+g435]
+  movsx rdi, byte ptr [rip+g4861]
+  add rsi, rdi
+  mov word ptr [rip+g891], si
+  movsx rsi, word ptr [rip+g4885]
+  movsx rdi, byte ptr [rip+g2984]
+  add rsi, rdi
+  mov qword ptr [rip+g892], rsi
+  movsxd rsi, dword ptr [rip+g2628]
+  movsx rdi, byte ptr [rip+g2254]
+  add rsi, rdi
+  mov word ptr [rip+g893], si
+  movsxd rsi, dword ptr [rip+g340]
+  add rsi, qword ptr [rip+g4461]
+  mov byte ptr [rip+g894], sil
+  movsx rsi, word ptr [rip+g3942]
+  movsxd rdi, dword ptr [rip+g1107]
+  add rsi, rdi
+  mov dword ptr [rip+g895], esi
+  movsx rsi, byte ptr [rip+g2030]
+  add rsi, qword ptr [rip+g2512]
+  mov dword ptr [rip+g896], esi
+  movsxd rsi, dword ptr [rip+g4002]
+  add rsi, qword ptr [rip+g1504]
+  mov byte ptr [rip+g897], sil
+  movsx rsi, byte ptr [rip+g424]
+  movsx rdi, word ptr [rip+g1909]
+  add rsi, rdi
+  mov dword ptr [rip+g898], esi
+  movsxd rsi, dword ptr [rip+g2603]
+  movsx rdi, byte ptr [rip+g3502]
+  add rsi, rdi
+  mov dword ptr [rip+g899], esi
+  movsx rsi, byte ptr [rip+g890]
+  mov rax, rsi
+.L.return.u89:
+  ret
+.text
+.p2align 4
+.global u90
+u90:
+  mov rsi, qword ptr [rip+g4745]
+  movsx rdi, word ptr [rip+g3234]
+  add rsi, rdi
+  mov qword ptr [rip+g900], rsi
+  movsx rsi, byte ptr [rip+g1614]
+  movsx rdi, byte ptr [rip+g3480]
+  add rsi, rdi
+  mov qword ptr [rip+g901], rsi
+  movsxd rsi, dword ptr [rip+g1802]
+  movsx rdi, word ptr [rip+g76]
+  add rsi, rdi
+  mov byte ptr [rip+g902], sil
+  mov rsi, qword ptr [rip+g1323]
+  movsxd rdi, dword ptr [rip+g2986]
+  add rsi, rdi
+  mov dword ptr [rip+g903], esi
+  mov rsi, qword ptr [rip+g2335]
+  add rsi, qword ptr [rip+g2482]
+  mov qword ptr [rip+g904], rsi
+  movsx rsi, word ptr [rip+g1023]
+  movsxd rdi, dword ptr [rip+g6]
+  add rsi, rdi
+  mov dword ptr [rip+g905], esi
+  movsxd rsi, dword ptr [rip+g126]
+  add rsi, qword ptr [rip+g3347]
+  mov word ptr [rip+g906], si
+  movsx rsi, word ptr [rip+g2893]
+  movsx rdi, byte ptr [rip+g27]
+  add rsi, rdi
+  mov dword ptr [rip+g907], esi
+  mov rsi, qword ptr [rip+g2448]
+  movsx rdi, word ptr [rip+g28]
+  add rsi, rdi
+  mov dword ptr [rip+g908], esi
+  mov rsi, qword ptr [rip+g4860]
+  add rsi, qword ptr [rip+g3748]
+  mov dword ptr [rip+g909], esi
+  mov rax, qword ptr [rip+g900]
+.L.return.u90:
+  ret
+.text
+.p2align 4
+.global u91
+u91:
+  movsx rsi, word ptr [rip+g4792]
+  movsx rdi, word ptr [rip+g3487]
+  add rsi, rdi
+  mov word ptr [rip+g910], si
+  movsx rsi, byte ptr [rip+g3069]
+  movsxd rdi, dword ptr [rip+g4902]
+  add rsi, rdi
+  mov qword ptr [rip+g911], rsi
+  movsx rsi, byte ptr [rip+g4459]
+  add rsi, qword ptr [rip+g3983]
+  mov word ptr [rip+g912], si
+  mov rsi, qword ptr [rip+g517]
+  movsxd rdi, dword ptr [rip+g3903]
+  add rsi, rdi
+  mov word ptr [rip+g913], si
+  movsx rsi, word ptr [rip+g3835]
+  movsxd rdi, dword ptr [rip+g4848]
+  add rsi, rdi
+  mov dword ptr [rip+g914], esi
+  movsx rsi, byte ptr [rip+g500]
+  add rsi, qword ptr [rip+g4999]
+  mov dword ptr [rip+g915], esi
+  movsx rsi, byte ptr [rip+g3555]
+  add rsi, qword ptr [rip+g3061]
+  mov dword ptr [rip+g916], esi
+  movsx rsi, byte ptr [rip+g1428]
+  movsx rdi, word ptr [rip+g3570]
+  add rsi, rdi
+  mov word ptr [rip+g917], si
+  movsx rsi, byte ptr [rip+g4243]
+  movsxd rdi, dword ptr [rip+g2857]
+  add rsi, rdi
+  mov qword ptr [rip+g918], rsi
+  movsx rsi, word ptr [rip+g2166]
+  movsxd rdi, dword ptr [rip+g2014]
+  add rsi, rdi
+  mov word ptr [rip+g919], si
+  movsx rsi, word ptr [rip+g910]
+  mov rax, rsi
+.L.return.u91:
+  ret
+.text
+.p2align 4
+.global u92
+u92:
+  movsx rsi, byte ptr [rip+g781]
+  movsx rdi, word ptr [rip+g4879]
+  add rsi, rdi
+  mov qword ptr [rip+g920], rsi
+  movsx rsi, word ptr [rip+g1584]
+  movsx rdi, word ptr [rip+g2048]
+  add rsi, rdi
+  mov dword ptr [rip+g921], esi
+  movsx rsi, word ptr [rip+g1524]
+  movsx rdi, byte ptr [rip+g3207]
+  add rsi, rdi
+  mov word ptr [rip+g922], si
+  movsx rsi, word ptr [rip+g63]
+  movsx rdi, word ptr [rip+g2834]
+  add rsi, rdi
+  mov word ptr [rip+g923], si
+  movsxd rsi, dword ptr [rip+g1654]
+  movsxd rdi, dword ptr [rip+g2910]
+  add rsi, rdi
+  mov dword ptr [rip+g924], esi
+  movsx rsi, word ptr [rip+g1580]
+  movsx rdi, word ptr [rip+g4196]
+  add rsi, rdi
+  mov qword ptr [rip+g925], rsi
+  mov rsi, qword ptr [rip+g4073]
+  add rsi, qword ptr [rip+g3227]
+  mov word ptr [rip+g926], si
+  movsx rsi, byte ptr [rip+g3062]
+  add rsi, qword ptr [rip+g319]
+  mov dword ptr [rip+g927], esi
+  movsxd rsi, dword ptr [rip+g1506]
+  movsx rdi, word ptr [rip+g315]
+  add rsi, rdi
+  mov dword ptr [rip+g928], esi
+  mov rsi, qword ptr [rip+g1079]
+  add rsi, qword ptr [rip+g2046]
+  mov qword ptr [rip+g929], rsi
+  mov rax, qword ptr [rip+g920]
+.L.return.u92:
+  ret
+.text
+.p2align 4
+.global u93
+u93:
+  movsxd rsi, dword ptr [rip+g4987]
+  movsxd rdi, dword ptr [rip+g4956]
+  add rsi, rdi
+  mov word ptr [rip+g930], si
+  mov rsi, qword ptr [rip+g3020]
+  movsx rdi, byte ptr [rip+g4322]
+  add rsi, rdi
+  mov byte ptr [rip+g931], sil
+  movsx rsi, word ptr [rip+g2652]
+  movsx rdi, byte ptr [rip+g4926]
+  add rsi, rdi
+  mov qword ptr [rip+g932], rsi
+  mov rsi, qword ptr [rip+g4751]
+  add rsi, qword ptr [rip+g64]
+  mov word ptr [rip+g933], si
+  movsx rsi, byte ptr [rip+g1377]
+  movsx rdi, word ptr [rip+g4521]
+  add rsi, rdi
+  mov dword ptr [rip+g934], esi
+  movsx rsi, byte ptr [rip+g4005]
+  add rsi, qword ptr [rip+g4509]
+  mov dword ptr [rip+g935], esi
+  movsxd rsi, dword ptr [rip+g3906]
+  movsx rdi, byte ptr [rip+g1807]
+  add rsi, rdi
+  mov dword ptr [rip+g936], esi
+  movsxd rsi, dword ptr [rip+g543]
+  movsxd rdi, dword ptr [rip+g329]
+  add rsi, rdi
+  mov dword ptr [rip+g937], esi
+  movsx rsi, word ptr [rip+g465]
+  movsxd rdi, dword ptr [rip+g3854]
+  add rsi, rdi
+  mov word ptr [rip+g938], si
+  mov rsi, qword ptr [rip+g258]
+  movsx rdi, byte ptr [rip+g1990]
+  add rsi, rdi
+  mov byte ptr [rip+g939], sil
+  movsx rsi, word ptr [rip+g930]
+  mov rax, rsi
+.L.return.u93:
+  ret
+.text
+.p2align 4
+.global u94
+u94:
+  movsx rsi, word ptr [rip+g3184]
+  movsx rdi, byte ptr [rip+g3402]
+  add rsi, rdi
+  mov word ptr [rip+g940], si
+  mov rsi, qword ptr [rip+g3532]
+  movsx rdi, byte ptr [rip+g4935]
+  add rsi, rdi
+  mov dword ptr [rip+g941], esi
+  movsx rsi, byte ptr [rip+g3924]
+  movsx rdi, byte ptr [rip+g3798]
+  add rsi, rdi
+  mov byte ptr [rip+g942], sil
+  movsxd rsi, dword ptr [rip+g2968]
+  movsxd rdi, dword ptr [rip+g77]
+  add rsi, rdi
+  mov word ptr [rip+g943], si
+  movsx rsi, byte ptr [rip+g290]
+  movsx rdi, byte ptr [rip+g3359]
+  add rsi, rdi
+  mov dword ptr [rip+g944], esi
+  movsx rsi, word ptr [rip+g1570]
+  movsxd rdi, dword ptr [rip+g3662]
+  add rsi, rdi
+  mov qword ptr [rip+g945], rsi
+  mov rsi, qword ptr [rip+g1141]
+  add rsi, qword ptr [rip+g1090]
+  mov qword ptr [rip+g946], rsi
+  movsx rsi, word ptr [rip+g4750]
+  movsx rdi, word ptr [rip+g4514]
+  add rsi, rdi
+  mov qword ptr [rip+g947], rsi
+  mov rsi, qword ptr [rip+g626]
+  movsx rdi, word ptr [rip+g738]
+  add rsi, rdi
+  mov word ptr [rip+g948], si
+  movsx rsi, byte ptr [rip+g1028]
+  movsx rdi, word ptr [rip+g1099]
+  add rsi, rdi
+  mov dword ptr [rip+g949], esi
+  movsx rsi, word ptr [rip+g940]
+  mov rax, rsi
+.L.return.u94:
+  ret
+.text
+.p2align 4
+.global u95
+u95:
+  movsxd rsi, dword ptr [rip+g2620]
+  movsxd rdi, dword ptr [rip+g16]
+  add rsi, rdi
+  mov qword ptr [rip+g950], rsi
+  movsxd rsi, dword ptr [rip+g599]
+  movsx rdi, word ptr [rip+g2076]
+  add rsi, rdi
+  mov qword ptr [rip+g951], rsi
+  movsxd rsi, dword ptr [rip+g2429]
+  movsx rdi, byte ptr [rip+g1872]
+  add rsi, rdi
+  mov dword ptr [rip+g952], esi
+  movsx rsi, word ptr [rip+g802]
+  add rsi, qword ptr [rip+g4287]
+  mov dword ptr [rip+g953], esi
+  mov rsi, qword ptr [rip+g3432]
+  movsx rdi, word ptr [rip+g4069]
+  add rsi, rdi
+  mov dword ptr [rip+g954], esi
+  movsx rsi, byte ptr [rip+g4357]
+  add rsi, qword ptr [rip+g1911]
+  mov word ptr [rip+g955], si
+  movsxd rsi, dword ptr [rip+g3399]
+  add rsi, qword ptr [rip+g2871]
+  mov qword ptr [rip+g956], rsi
+  movsxd rsi, dword ptr [rip+g3973]
+  add rsi, qword ptr [rip+g2739]
+  mov dword ptr [rip+g957], esi
+  movsxd rsi, dword ptr [rip+g2755]
+  movsx rdi, byte ptr [rip+g2243]
+  add rsi, rdi
+  mov word ptr [rip+g958], si
+  movsx rsi, byte ptr [rip+g1896]
+  movsxd rdi, dword ptr [rip+g4591]
+  add rsi, rdi
+  mov qword ptr [rip+g959], rsi
+  mov rax, qword ptr [rip+g950]
+.L.return.u95:
+  ret
+.text
+.p2align 4
+.global u96
+u96:
+  movsx rsi, byte ptr [rip+g2234]
+  movsx rdi, word ptr [rip+g1174]
+  add rsi, rdi
+  mov dword ptr [rip+g960], esi
+  movsxd rsi, dword ptr [rip+g2889]
+  movsxd rdi, dword ptr [rip+g4866]
+  add rsi, rdi
+  mov dword ptr [rip+g961], esi
+  mov rsi, qword ptr [rip+g178]
+  movsx rdi, byte ptr [rip+g4448]
+  add rsi, rdi
+  mov qword ptr [rip+g962], rsi
+  movsxd rsi, dword ptr [rip+g3500]
+  add rsi, qword ptr [rip+g4536]
+  mov qword ptr [rip+g963], rsi
+  movsx rsi, word ptr [rip+g2866]
+  add rsi, qword ptr [rip+g1631]
+  mov word ptr [rip+g964], si
+  movsxd rsi, dword ptr [rip+g1861]
+  add rsi, qword ptr [rip+g1013]
+  mov word ptr [rip+g965], si
+  movsx rsi, byte ptr [rip+g1593]
+  movsx rdi, word ptr [rip+g2844]
+  add rsi, rdi
+  mov dword ptr [rip+g966], esi
+  movsx rsi, byte ptr [rip+g973]
+  movsx rdi, byte ptr [rip+g3146]
+  add rsi, rdi
+  mov byte ptr [rip+g967], sil
+  movsx rsi, word ptr [rip+g1855]
+  movsx rdi, byte ptr [rip+g4649]
+  add rsi, rdi
+  mov byte ptr [rip+g968], sil
+  mov rsi, qword ptr [rip+g4560]
+  movsx rdi, byte ptr [rip+g2747]
+  add rsi, rdi
+  mov dword ptr [rip+g969], esi
+  movsxd rsi, dword ptr [rip+g960]
+  mov rax, rsi
+.L.return.u96:
+  ret
+.text
+.p2align 4
+.global u97
+u97:
+  mov rsi, qword ptr [rip+g208]
+  movsx rdi, word ptr [rip+g2900]
+  add rsi, rdi
+  mov byte ptr [rip+g970], sil
+  movsx rsi, byte ptr [rip+g1393]
+  add rsi, qword ptr [rip+g932]
+  mov qword ptr [rip+g971], rsi
+  movsxd rsi, dword ptr [rip+g4047]
+  movsxd rdi, dword ptr [rip+g1833]
+  add rsi, rdi
+  mov byte ptr [rip+g972], sil
+  mov rsi, qword ptr [rip+g3003]
+  movsx rdi, byte ptr [rip+g3142]
+  add rsi, rdi
+  mov byte ptr [rip+g973], sil
+  movsxd rsi, dword ptr [rip+g1978]
+  movsx rdi, word ptr [rip+g1290]
+  add rsi, rdi
+  mov dword ptr [rip+g974], esi
+  mov rsi, qword ptr [rip+g2618]
+  movsxd rdi, dword ptr [rip+g1665]
+  add rsi, rdi
+  mov word ptr [rip+g975], si
+  movsx rsi, byte ptr [rip+g2411]
+  movsx rdi, byte ptr [rip+g1754]
+  add rsi, rdi
+  mov dword ptr [rip+g976], esi
+  mov rsi, qword ptr [rip+g3158]
+  movsx rdi, word ptr [rip+g680]
+  add rsi, rdi
+  mov byte ptr [rip+g977], sil
+  movsx rsi, byte ptr [rip+g1728]
+  movsxd rdi, dword ptr [rip+g4979]
+  add rsi, rdi
+  mov byte ptr [rip+g978], sil
+  movsx rsi, byte ptr [rip+g3548]
+  add rsi, qword ptr [rip+g577]
+  mov byte ptr [rip+g979], sil
+  movsx rsi, byte ptr [rip+g970]
+  mov rax, rsi
+.L.return.u97:
+  ret
+.text
+.p2align 4
+.global u98
+u98:
+  movsx rsi, byte ptr [rip+g4094]
+  add rsi, qword ptr [rip+g1081]
+  mov qword ptr [rip+g980], rsi
+  mov rsi, qword ptr [rip+g1024]
+  movsx rdi, word ptr [rip+g854]
+  add rsi, rdi
+  mov byte ptr [rip+g981], sil
+  movsx rsi, byte ptr [rip+g4427]
+  movsxd rdi, dword ptr [rip+g4158]
+  add rsi, rdi
+  mov qword ptr [rip+g982], rsi
+  movsx rsi, word ptr [rip+g3327]
+  movsx rdi, word ptr [rip+g1823]
+  add rsi, rdi
+  mov qword ptr [rip+g983], rsi
+  mov rsi, qword ptr [rip+g4351]
+  add rsi, qword ptr [rip+g2512]
+  mov word ptr [rip+g984], si
+  movsx rsi, word ptr [rip+g1727]
+  movsx rdi, word ptr [rip+g2313]
+  add rsi, rdi
+  mov qword ptr [rip+g985], rsi
+  mov rsi, qword ptr [rip+g2864]
+  add rsi, qword ptr [rip+g982]
+  mov byte ptr [rip+g986], sil
+  mov rsi, qword ptr [rip+g645]
+  movsxd rdi, dword ptr [rip+g4384]
+  add rsi, rdi
+  mov byte ptr [rip+g987], sil
+  movsxd rsi, dword ptr [rip+g4541]
+  movsx rdi, word ptr [rip+g670]
+  add rsi, rdi
+  mov qword ptr [rip+g988], rsi
+  movsxd rsi, dword ptr [rip+g418]
+  add rsi, qword ptr [rip+g2798]
+  mov word ptr [rip+g989], si
+  mov rax, qword ptr [rip+g980]
+.L.return.u98:
+  ret
+.text
+.p2align 4
+.global u99
+u99:
+  movsx rsi, byte ptr [rip+g4603]
+  movsxd rdi, dword ptr [rip+g1838]
+  add rsi, rdi
+  mov dword ptr [rip+g990], esi
+  movsxd rsi, dword ptr [rip+g4139]
+  movsxd rdi, dword ptr [rip+g4442]
+  add rsi, rdi
+  mov qword ptr [rip+g991], rsi
+  movsx rsi, byte ptr [rip+g2021]
+  add rsi, qword ptr [rip+g2391]
+  mov byte ptr [rip+g992], sil
+  movsx rsi, word ptr [rip+g4657]
+  movsxd rdi, dword ptr [rip+g4309]
+  add rsi, rdi
+  mov qword ptr [rip+g993], rsi
+  movsx rsi, word ptr [rip+g1402]
+  movsxd rdi, dword ptr [rip+g4450]
+  add rsi, rdi
+  mov byte ptr [rip+g994], sil
+  mov rsi, qword ptr [rip+g3494]
+  movsxd rdi, dword ptr [rip+g1201]
+  add rsi, rdi
+  mov word ptr [rip+g995], si
+  movsx rsi, word ptr [rip+g4103]
+  movsx rdi, word ptr [rip+g2967]
+  add rsi, rdi
+  mov dword ptr [rip+g996], esi
+  movsx rsi, byte ptr [rip+g3017]
+  movsxd rdi, dword ptr [rip+g2632]
+  add rsi, rdi
+  mov qword ptr [rip+g997], rsi
+  movsx rsi, word ptr [rip+g3893]
+  movsxd rdi, dword ptr [rip+g3899]
+  add rsi, rdi
+  mov qword ptr [rip+g998], rsi
+  movsx rsi, word ptr [rip+g1738]
+  movsx rdi, byte ptr [rip+g2573]
+  add rsi, rdi
+  mov qword ptr [rip+g999], rsi
+  movsxd rsi, dword ptr [rip+g990]
+  mov rax, rsi
+.L.return.u99:
+  ret
+.text
+.p2align 4
+.global u100
+u100:
+  movsx rsi, byte ptr [rip+g327]
+  movsxd rdi, dword ptr [rip+g1493]
+  add rsi, rdi
+  mov dword ptr [rip+g1000], esi
+  movsx rsi, byte ptr [rip+g1223]
+  add rsi, qword ptr [rip+g1936]
+  mov dword ptr [rip+g1001], esi
+  movsx rsi, byte ptr [rip+g111]
+  movsx rdi, byte ptr [rip+g3499]
+  add rsi, rdi
+  mov byte ptr [rip+g1002], sil
+  mov rsi, qword ptr [rip+g3772]
+  add rsi, qword ptr [rip+g4221]
+  mov qword ptr [rip+g1003], rsi
+  movsxd rsi, dword ptr [rip+g142]
+  movsxd rdi, dword ptr [rip+g2349]
+  add rsi, rdi
+  mov word ptr [rip+g1004], si
+  movsx rsi, byte ptr [rip+g4600]
+  add rsi, qword ptr [rip+g377]
+  mov qword ptr [rip+g1005], rsi
+  movsx rsi, byte ptr [rip+g2059]
+  movsx rdi, word ptr [rip+g4815]
+  add rsi, rdi
+  mov qword ptr [rip+g1006], rsi
+  mov rsi, qword ptr [rip+g863]
+  add rsi, qword ptr [rip+g2911]
+  mov qword ptr [rip+g1007], rsi
+  movsx rsi, byte ptr [rip+g496]
+  movsx rdi, word ptr [rip+g1793]
+  add rsi, rdi
+  mov qword ptr [rip+g1008], rsi
+  movsx rsi, byte ptr [rip+g3395]
+  movsx rdi, word ptr [rip+g2876]
+  add rsi, rdi
+  mov dword ptr [rip+g1009], esi
+  movsxd rsi, dword ptr [rip+g1000]
+  mov rax, rsi
+.L.return.u100:
+  ret
+.text
+.p2align 4
+.global u101
+u101:
+  movsx rsi, word ptr [rip+g225]
+  add rsi, qword ptr [rip+g82]
+  mov qword ptr [rip+g1010], rsi
+  movsxd rsi, dword ptr [rip+g1512]
+  movsxd rdi, dword ptr [rip+g1017]
+  add rsi, rdi
+  mov word ptr [rip+g1011], si
+  movsxd rsi, dword ptr [rip+g478]
+  add rsi, qword ptr [rip+g2767]
+  mov qword ptr [rip+g1012], rsi
+  movsx rsi, byte ptr [rip+g2490]
+  movsxd rdi, dword ptr [rip+g3717]
+  add rsi, rdi
+  mov qword ptr [rip+g1013], rsi
+  movsxd rsi, dword ptr [rip+g1759]
+  movsxd rdi, dword ptr [rip+g1552]
+  add rsi, rdi
+  mov qword ptr [rip+g1014], rsi
+  movsx rsi, word ptr [rip+g4062]
+  movsx rdi, word ptr [rip+g677]
+  add rsi, rdi
+  mov qword ptr [rip+g1015], rsi
+  movsx rsi, word ptr [rip+g1446]
+  movsx rdi, byte ptr [rip+g1962]
+  add rsi, rdi
+  mov qword ptr [rip+g1016], rsi
+  movsx rsi, byte ptr [rip+g417]
+  movsx rdi, byte ptr [rip+g1021]
+  add rsi, rdi
+  mov dword ptr [rip+g1017], esi
+  movsxd rsi, dword ptr [rip+g1574]
+  movsx rdi, byte ptr [rip+g3409]
+  add rsi, rdi
+  mov dword ptr [rip+g1018], esi
+  movsxd rsi, dword ptr [rip+g363]
+  movsx rdi, word ptr [rip+g2774]
+  add rsi, rdi
+  mov byte ptr [rip+g1019], sil
+  mov rax, qword ptr [rip+g1010]
+.L.return.u101:
+  ret
+.text
+.p2align 4
+.global u102
+u102:
+  mov rsi, qword ptr [rip+g1795]
+  add rsi, qword ptr [rip+g911]
+  mov byte ptr [rip+g1020], sil
+  mov rsi, qword ptr [rip+g386]
+  movsx rdi, word ptr [rip+g489]
+  add rsi, rdi
+  mov byte ptr [rip+g1021], sil
+  movsx rsi, word ptr [rip+g144]
+  add rsi, qword ptr [rip+g2828]
+  mov byte ptr [rip+g1022], sil
+  movsx rsi, byte ptr [rip+g4606]
+  movsx rdi, byte ptr [rip+g3546]
+  add rsi, rdi
+  mov word ptr [rip+g1023], si
+  movsxd rsi, dword ptr [rip+g1931]
+  add rsi, qword ptr [rip+g1417]
+  mov qword ptr [rip+g1024], rsi
+  movsx rsi, byte ptr [rip+g4250]
+  movsxd rdi, dword ptr [rip+g4066]
+  add rsi, rdi
+  mov qword ptr [rip+g1025], rsi
+  movsx rsi, word ptr [rip+g2392]
+  add rsi, qword ptr [rip+g4524]
+  mov qword ptr [rip+g1026], rsi
+  mov rsi, qword ptr [rip+g138]
+  movsxd rdi, dword ptr [rip+g329]
+  add rsi, rdi
+  mov byte ptr [rip+g1027], sil
+  mov rsi, qword ptr [rip+g4719]
+  movsx rdi, byte ptr [rip+g4376]
+  add rsi, rdi
+  mov byte ptr [rip+g1028], sil
+  movsx rsi, byte ptr [rip+g2071]
+  add rsi, qword ptr [rip+g3946]
+  mov dword ptr [rip+g1029], esi
+  movsx rsi, byte ptr [rip+g1020]
+  mov rax, rsi
+.L.return.u102:
+  ret
+.text
+.p2align 4
+.global u103
+u103:
+  movsx rsi, word ptr [rip+g4844]
+  movsxd rdi, dword ptr [rip+g1628]
+  add rsi, rdi
+  mov qword ptr [rip+g1030], rsi
+  movsx rsi, word ptr [rip+g2789]
+  movsx rdi, byte ptr [rip+g3453]
+  add rsi, rdi
+  mov word ptr [rip+g1031], si
+  mov rsi, qword ptr [rip+g521]
+  movsx rdi, word ptr [rip+g1167]
+  add rsi, rdi
+  mov qword ptr [rip+g1032], rsi
+  movsx rsi, word ptr [rip+g2251]
+  add rsi, qword ptr [rip+g1445]
+  mov word ptr [rip+g1033], si
+  movsx rsi, byte ptr [rip+g4181]
+  movsxd rdi, dword ptr [rip+g1291]
+  add rsi, rdi
+  mov word ptr [rip+g1034], si
+  mov rsi, qword ptr [rip+g4097]
+  movsxd rdi, dword ptr [rip+g2485]
+  add rsi, rdi
+  mov dword ptr [rip+g1035], esi
+  movsx rsi, word ptr [rip+g2353]
+  movsxd rdi, dword ptr [rip+g1018]
+  add rsi, rdi
+  mov word ptr [rip+g1036], si
+  movsx rsi, byte ptr [rip+g4209]
+  add rsi, qword ptr [rip+g3697]
+  mov byte ptr [rip+g1037], sil
+  mov rsi, qword ptr [rip+g1444]
+  add rsi, qword ptr [rip+g3802]
+  mov dword ptr [rip+g1038], esi
+  movsx rsi, byte ptr [rip+g4313]
+  add rsi, qword ptr [rip+g4966]
+  mov qword ptr [rip+g1039], rsi
+  mov rax, qword ptr [rip+g1030]
+.L.return.u103:
+  ret
+.text
+.p2align 4
+.global u104
+u104:
+  movsxd rsi, dword ptr [rip+g1861]
+  movsx rdi, word ptr [rip+g4091]
+  add rsi, rdi
+  mov qword ptr [rip+g1040], rsi
+  movsxd rsi, dword ptr [rip+g2163]
+  add rsi, qword ptr [rip+g3980]
+  mov word ptr [rip+g1041], si
+  movsxd rsi, dword ptr [rip+g1752]
+  movsx rdi, byte ptr [rip+g1028]
+  add rsi, rdi
+  mov dword ptr [rip+g1042], esi
+  mov rsi, qword ptr [rip+g4615]
+  movsx rdi, byte ptr [rip+g273]
+  add rsi, rdi
+  mov byte ptr [rip+g1043], sil
+  mov rsi, qword ptr [rip+g2183]
+  movsx rdi, word ptr [rip+g1271]
+  add rsi, rdi
+  mov dword ptr [rip+g1044], esi
+  movsx rsi, byte ptr [rip+g3163]
+  movsxd rdi, dword ptr [rip+g3200]
+  add rsi, rdi
+  mov dword ptr [rip+g1045], esi
+  mov rsi, qword ptr [rip+g626]
+  movsxd rdi, dword ptr [rip+g0]
+  add rsi, rdi
+  mov byte ptr [rip+g1046], sil
+  movsx rsi, word ptr [rip+g1801]
+  movsx rdi, word ptr [rip+g1806]
+  add rsi, rdi
+  mov word ptr [rip+g1047], si
+  movsx rsi, byte ptr [rip+g1136]
+  add rsi, qword ptr [rip+g2516]
+  mov byte ptr [rip+g1048], sil
+  mov rsi, qword ptr [rip+g2723]
+  movsx rdi, word ptr [rip+g3912]
+  add rsi, rdi
+  mov dword ptr [rip+g1049], esi
+  mov rax, qword ptr [rip+g1040]
+.L.return.u104:
+  ret
+.text
+.p2align 4
+.global u105
+u105:
+  movsx rsi, word ptr [rip+g3259]
+  movsxd rdi, dword ptr [rip+g4918]
+  add rsi, rdi
+  mov byte ptr [rip+g1050], sil
+  movsx rsi, word ptr [rip+g3989]
+  movsxd rdi, dword ptr [rip+g2632]
+  add rsi, rdi
+  mov dword ptr [rip+g1051], esi
+  movsx rsi, word ptr [rip+g768]
+  movsx rdi, byte ptr [rip+g3729]
+  add rsi, rdi
+  mov byte ptr [rip+g1052], sil
+  mov rsi, qword ptr [rip+g3273]
+  add rsi, qword ptr [rip+g4745]
+  mov dword ptr [rip+g1053], esi
+  movsx rsi, word ptr [rip+g2356]
+  movsxd rdi, dword ptr [rip+g1276]
+  add rsi, rdi
+  mov dword ptr [rip+g1054], esi
+  movsx rsi, byte ptr [rip+g1406]
+  add rsi, qword ptr [rip+g4299]
+  mov qword ptr [rip+g1055], rsi
+  movsx rsi, word ptr [rip+g313]
+  movsx rdi, word ptr [rip+g248]
+  add rsi, rdi
+  mov dword ptr [rip+g1056], esi
+  movsx rsi, byte ptr [rip+g2817]
+  movsxd rdi, dword ptr [rip+g786]
+  add rsi, rdi
+  mov word ptr [rip+g1057], si
+  movsx rsi, byte ptr [rip+g2909]
+  movsxd rdi, dword ptr [rip+g1834]
+  add rsi, rdi
+  mov dword ptr [rip+g1058], esi
+  movsx rsi, byte ptr [rip+g403]
+  movsxd rdi, dword ptr [rip+g2237]
+  add rsi, rdi
+  mov qword ptr [rip+g1059], rsi
+  movsx rsi, byte ptr [rip+g1050]
+  mov rax, rsi
+.L.return.u105:
+  ret
+.text
+.p2align 4
+.global u106
+u106:
+  mov rsi, qword ptr [rip+g4998]
+  movsx rdi, word ptr [rip+g611]
+  add rsi, rdi
+  mov byte ptr [rip+g1060], sil
+  movsxd rsi, dword ptr [rip+g3899]
+  add rsi, qword ptr [rip+g2077]
+  mov dword ptr [rip+g1061], esi
+  mov rsi, qword ptr [rip+g2495]
+  movsx rdi, byte ptr [rip+g3182]
+  add rsi, rdi
+  mov byte ptr [rip+g1062], sil
+  movsxd rsi, dword ptr [rip+g3362]
+  movsx rdi, word ptr [rip+g2676]
+  add rsi, rdi
+  mov qword ptr [rip+g1063], rsi
+  movsx rsi, word ptr [rip+g3246]
+  add rsi, qword ptr [rip+g3540]
+  mov byte ptr [rip+g1064], sil
+  movsxd rsi, dword ptr [rip+g4049]
+  movsxd rdi, dword ptr [rip+g935]
+  add rsi, rdi
+  mov byte ptr [rip+g1065], sil
+  movsx rsi, word ptr [rip+g3120]
+  movsx rdi, byte ptr [rip+g716]
+  add rsi, rdi
+  mov dword ptr [rip+g1066], esi
+  mov rsi, qword ptr [rip+g2152]
+  movsx rdi, byte ptr [rip+g415]
+  add rsi, rdi
+  mov word ptr [rip+g1067], si
+  movsxd rsi, dword ptr [rip+g1967]
+  movsx rdi, byte ptr [rip+g4387]
+  add rsi, rdi
+  mov dword ptr [rip+g1068], esi
+  mov rsi, qword ptr [rip+g4369]
+  add rsi, qword ptr [rip+g701]
+  mov word ptr [rip+g1069], si
+  movsx rsi, byte ptr [rip+g1060]
+  mov rax, rsi
+.L.return.u106:
+  ret
+.text
+.p2align 4
+.global u107
+u107:
+  movsx rsi, word ptr [rip+g3022]
+  add rsi, qword ptr [rip+g1288]
+  mov dword ptr [rip+g1070], esi
+  movsx rsi, byte ptr [rip+g2519]
+  add rsi, qword ptr [rip+g1693]
+  mov qword ptr [rip+g1071], rsi
+  movsxd rsi, dword ptr [rip+g916]
+  add rsi, qword ptr [rip+g750]
+  mov word ptr [rip+g1072], si
+  movsx rsi, byte ptr [rip+g2564]
+  movsxd rdi, dword ptr [rip+g1462]
+  add rsi, rdi
+  mov qword ptr [rip+g1073], rsi
+  movsx rsi, word ptr [rip+g2358]
+  movsxd rdi, dword ptr [rip+g42]
+  add rsi, rdi
+  mov byte ptr [rip+g1074], sil
+  mov rsi, qword ptr [rip+g3832]
+  movsxd rdi, dword ptr [rip+g4852]
+  add rsi, rdi
+  mov word ptr [rip+g1075], si
+  movsx rsi, word ptr [rip+g2673]
+  movsx rdi, word ptr [rip+g2333]
+  add rsi, rdi
+  mov dword ptr [rip+g1076], esi
+  movsxd rsi, dword ptr [rip+g2606]
+  movsx rdi, byte ptr [rip+g4305]
+  add rsi, rdi
+  mov byte ptr [rip+g1077], sil
+  mov rsi, qword ptr [rip+g1207]
+  movsx rdi, word ptr [rip+g4976]
+  add rsi, rdi
+  mov dword ptr [rip+g1078], esi
+  movsxd rsi, dword ptr [rip+g2878]
+  add rsi, qword ptr [rip+g1299]
+  mov qword ptr [rip+g1079], rsi
+  movsxd rsi, dword ptr [rip+g1070]
+  mov rax, rsi
+.L.return.u107:
+  ret
+.text
+.p2align 4
+.global u108
+u108:
+  movsx rsi, byte ptr [rip+g4621]
+  add rsi, qword ptr [rip+g353]
+  mov byte ptr [rip+g1080], sil
+  movsxd rsi, dword ptr [rip+g4743]
+  movsx rdi, word ptr [rip+g4337]
+  add rsi, rdi
+  mov qword ptr [rip+g1081], rsi
+  movsx rsi, byte ptr [rip+g276]
+  add rsi, qword ptr [rip+g2213]
+  mov qword ptr [rip+g1082], rsi
+  mov rsi, qword ptr [rip+g2644]
+  movsx rdi, byte ptr [rip+g4670]
+  add rsi, rdi
+  mov byte ptr [rip+g1083], sil
+  movsx rsi, word ptr [rip+g2452]
+  movsx rdi, word ptr [rip+g4967]
+  add rsi, rdi
+  mov byte ptr [rip+g1084], sil
+  movsxd rsi, dword ptr [rip+g3823]
+  movsx rdi, byte ptr [rip+g25]
+  add rsi, rdi
+  mov word ptr [rip+g1085], si
+  movsxd rsi, dword ptr [rip+g2602]
+  movsx rdi, word ptr [rip+g4142]
+  add rsi, rdi
+  mov word ptr [rip+g1086], si
+  movsx rsi, word ptr [rip+g910]
+  movsx rdi, byte ptr [rip+g3794]
+  add rsi, rdi
+  mov qword ptr [rip+g1087], rsi
+  movsx rsi, word ptr [rip+g2359]
+  add rsi, qword ptr [rip+g3941]
+  mov byte ptr [rip+g1088], sil
+  movsx rsi, word ptr [rip+g2568]
+  movsx rdi, byte ptr [rip+g1545]
+  add rsi, rdi
+  mov dword ptr [rip+g1089], esi
+  movsx rsi, byte ptr [rip+g1080]
+  mov rax, rsi
+.L.return.u108:
+  ret
+.text
+.p2align 4
+.global u109
+u109:
+  mov rsi, qword ptr [rip+g2403]
+  movsx rdi, word ptr [rip+g4471]
+  add rsi, rdi
+  mov qword ptr [rip+g1090], rsi
+  movsx rsi, byte ptr [rip+g172]
+  movsx rdi, word ptr [rip+g71]
+  add rsi, rdi
+  mov dword ptr [rip+g1091], esi
+  mov rsi, qword ptr [rip+g17]
+  add rsi, qword ptr [rip+g778]
+  mov dword ptr [rip+g1092], esi
+  movsxd rsi, dword ptr [rip+g4585]
+  movsx rdi, byte ptr [rip+g3416]
+  add rsi, rdi
+  mov qword ptr [rip+g1093], rsi
+  movsx rsi, word ptr [rip+g161]
+  movsxd rdi, dword ptr [rip+g3865]
+  add rsi, rdi
+  mov byte ptr [rip+g1094], sil
+  movsxd rsi, dword ptr [rip+g4381]
+  movsx rdi, byte ptr [rip+g4333]
+  add rsi, rdi
+  mov word ptr [rip+g1095], si
+  movsxd rsi, dword ptr [rip+g4165]
+  movsx rdi, byte ptr [rip+g4701]
+  add rsi, rdi
+  mov dword ptr [rip+g1096], esi
+  mov rsi, qword ptr [rip+g1010]
+  movsx rdi, byte ptr [rip+g3448]
+  add rsi, rdi
+  mov byte ptr [rip+g1097], sil
+  mov rsi, qword ptr [rip+g1458]
+  movsxd rdi, dword ptr [rip+g2687]
+  add rsi, rdi
+  mov byte ptr [rip+g1098], sil
+  movsx rsi, byte ptr [rip+g393]
+  movsxd rdi, dword ptr [rip+g460]
+  add rsi, rdi
+  mov word ptr [rip+g1099], si
+  mov rax, qword ptr [rip+g1090]
+.L.return.u109:
+  ret
+.text
+.p2align 4
+.global u110
+u110:
+  mov rsi, qword ptr [rip+g3724]
+  movsx rdi, byte ptr [rip+g2666]
+  add rsi, rdi
+  mov word ptr [rip+g1100], si
+  movsx rsi, word ptr [rip+g3438]
+  movsxd rdi, dword ptr [rip+g974]
+  add rsi, rdi
+  mov dword ptr [rip+g1101], esi
+  mov rsi, qword ptr [rip+g1155]
+  movsx rdi, word ptr [rip+g3632]
+  add rsi, rdi
+  mov word ptr [rip+g1102], si
+  mov rsi, qword ptr [rip+g3376]
+  movsx rdi, word ptr [rip+g249]
+  add rsi, rdi
+  mov byte ptr [rip+g1103], sil
+  movsxd rsi, dword ptr [rip+g1359]
+  movsxd rdi, dword ptr [rip+g1705]
+  add rsi, rdi
+  mov qword ptr [rip+g1104], rsi
+  mov rsi, qword ptr [rip+g4753]
+  movsx rdi, byte ptr [rip+g2101]
+  add rsi, rdi
+  mov dword ptr [rip+g1105], esi
+  movsx rsi, word ptr [rip+g1900]
+  movsx rdi, byte ptr [rip+g1131]
+  add rsi, rdi
+  mov qword ptr [rip+g1106], rsi
+  movsx rsi, byte ptr [rip+g2564]
+  add rsi, qword ptr [rip+g3122]
+  mov dword ptr [rip+g1107], esi
+  movsx rsi, word ptr [rip+g4046]
+  movsx rdi, word ptr [rip+g4473]
+  add rsi, rdi
+  mov word ptr [rip+g1108], si
+  mov rsi, qword ptr [rip+g3716]
+  movsx rdi, byte ptr [rip+g4313]
+  add rsi, rdi
+  mov qword ptr [rip+g1109], rsi
+  movsx rsi, word ptr [rip+g1100]
+  mov rax, rsi
+.L.return.u110:
+  ret
+.text
+.p2align 4
+.global u111
+u111:
+  movsx rsi, byte ptr [rip+g1539]
+  movsx rdi, word ptr [rip+g1499]
+  add rsi, rdi
+  mov word ptr [rip+g1110], si
+  movsxd rsi, dword ptr [rip+g4336]
+  movsxd rdi, dword ptr [rip+g1483]
+  add rsi, rdi
+  mov byte ptr [rip+g1111], sil
+  movsx rsi, byte ptr [rip+g652]
+  add rsi, qword ptr [rip+g4292]
+  mov qword ptr [rip+g1112], rsi
+  movsx rsi, byte ptr [rip+g970]
+  movsx rdi, byte ptr [rip+g3054]
+  add rsi, rdi
+  mov qword ptr [rip+g1113], rsi
+  movsxd rsi, dword ptr [rip+g4383]
+  movsx rdi, byte ptr [rip+g4584]
+  add rsi, rdi
+  mov qword ptr [rip+g1114], rsi
+  movsx rsi, word ptr [rip+g843]
+  movsx rdi, word ptr [rip+g537]
+  add rsi, rdi
+  mov byte ptr [rip+g1115], sil
+  movsx rsi, byte ptr [rip+g3213]
+  movsx rdi, word ptr [rip+g958]
+  add rsi, rdi
+  mov word ptr [rip+g1116], si
+  mov rsi, qword ptr [rip+g593]
+  movsx rdi, word ptr [rip+g510]
+  add rsi, rdi
+  mov word ptr [rip+g1117], si
+  movsxd rsi, dword ptr [rip+g1674]
+  movsx rdi, byte ptr [rip+g4659]
+  add rsi, rdi
+  mov qword ptr [rip+g1118], rsi
+  movsx rsi, byte ptr [rip+g4832]
+  movsx rdi, byte ptr [rip+g288]
+  add rsi, rdi
+  mov byte ptr [rip+g1119], sil
+  movsx rsi, word ptr [rip+g1110]
+  mov rax, rsi
+.L.return.u111:
+  ret
+.text
+.p2align 4
+.global u112
+u112:
+  mov rsi, qword ptr [rip+g1289]
+  add rsi, qword ptr [rip+g2426]
+  mov word ptr [rip+g1120], si
+  movsx rsi, word ptr [rip+g2070]
+  movsx rdi, byte ptr [rip+g2760]
+  add rsi, rdi
+  mov dword ptr [rip+g1121], esi
+  movsx rsi, byte ptr [rip+g2260]
+  movsxd rdi, dword ptr [rip+g1833]
+  add rsi, rdi
+  mov qword ptr [rip+g1122], rsi
+  movsxd rsi, dword ptr [rip+g4045]
+  add rsi, qword ptr [rip+g4089]
+  mov byte ptr [rip+g1123], sil
+  movsx rsi, word ptr [rip+g304]
+  movsx rdi, word ptr [rip+g242]
+  add rsi, rdi
+  mov byte ptr [rip+g1124], sil
+  movsxd rsi, dword ptr [rip+g4318]
+  movsxd rdi, dword ptr [rip+g3311]
+  add rsi, rdi
+  mov qword ptr [rip+g1125], rsi
+  movsxd rsi, dword ptr [rip+g3939]
+  movsx rdi, byte ptr [rip+g4001]
+  add rsi, rdi
+  mov dword ptr [rip+g1126], esi
+  movsx rsi, byte ptr [rip+g4305]
+  movsxd rdi, dword ptr [rip+g1590]
+  add rsi, rdi
+  mov dword ptr [rip+g1127], esi
+  mov rsi, qword ptr [rip+g3347]
+  movsxd rdi, dword ptr [rip+g4678]
+  add rsi, rdi
+  mov byte ptr [rip+g1128], sil
+  mov rsi, qword ptr [rip+g2941]
+  movsx rdi, word ptr [rip+g161]
+  add rsi, rdi
+  mov word ptr [rip+g1129], si
+  movsx rsi, word ptr [rip+g1120]
+  mov rax, rsi
+.L.return.u112:
+  ret
+.text
+.p2align 4
+.global u113
+u113:
+  movsx rsi, word ptr [rip+g2917]
+  add rsi, qword ptr [rip+g2911]
+  mov byte ptr [rip+g1130], sil
+  movsxd rsi, dword ptr [rip+g84]
+  movsx rdi, byte ptr [rip+g1906]
+  add rsi, rdi
+  mov byte ptr [rip+g1131], sil
+  mov rsi, qword ptr [rip+g863]
+  movsxd rdi, dword ptr [rip+g600]
+  add rsi, rdi
+  mov word ptr [rip+g1132], si
+  movsx rsi, byte ptr [rip+g1315]
+  add rsi, qword ptr [rip+g3900]
+  mov qword ptr [rip+g1133], rsi
+  movsx rsi, byte ptr [rip+g2745]
+  movsx rdi, byte ptr [rip+g4666]
+  add rsi, rdi
+  mov word ptr [rip+g1134], si
+  movsx rsi, byte ptr [rip+g2515]
+  add rsi, qword ptr [rip+g4719]
+  mov dword ptr [rip+g1135], esi
+  mov rsi, qword ptr [rip+g1544]
+  add rsi, qword ptr [rip+g1895]
+  mov byte ptr [rip+g1136], sil
+  movsx rsi, word ptr [rip+g1168]
+  movsxd rdi, dword ptr [rip+g2944]
+  add rsi, rdi
+  mov qword ptr [rip+g1137], rsi
+  movsx rsi, word ptr [rip+g1710]
+  movsx rdi, word ptr [rip+g242]
+  add rsi, rdi
+  mov dword ptr [rip+g1138], esi
+  movsxd rsi, dword ptr [rip+g1978]
+  add rsi, qword ptr [rip+g4500]
+  mov qword ptr [rip+g1139], rsi
+  movsx rsi, byte ptr [rip+g1130]
+  mov rax, rsi
+.L.return.u113:
+  ret
+.text
+.p2align 4
+.global u114
+u114:
+  movsx rsi, byte ptr [rip+g2686]
+  movsx rdi, byte ptr [rip+g4094]
+  add rsi, rdi
+  mov qword ptr [rip+g1140], rsi
+  movsxd rsi, dword ptr [rip+g163]
+  movsx rdi, byte ptr [rip+g3546]
+  add rsi, rdi
+  mov qword ptr [rip+g1141], rsi
+  movsx rsi, word ptr [rip+g3940]
+  movsx rdi, word ptr [rip+g2605]
+  add rsi, rdi
+  mov word ptr [rip+g1142], si
+  movsx rsi, byte ptr [rip+g3465]
+  movsxd rdi, dword ptr [rip+g1218]
+  add rsi, rdi
+  mov qword ptr [rip+g1143], rsi
+  movsx rsi, word ptr [rip+g4347]
+  movsx rdi, word ptr [rip+g1085]
+  add rsi, rdi
+  mov byte ptr [rip+g1144], sil
+  movsxd rsi, dword ptr [rip+g175]
+  movsx rdi, word ptr [rip+g3375]
+  add rsi, rdi
+  mov dword ptr [rip+g1145], esi
+  movsx rsi, byte ptr [rip+g3507]
+  movsx rdi, word ptr [rip+g4859]
+  add rsi, rdi
+  mov qword ptr [rip+g1146], rsi
+  movsxd rsi, dword ptr [rip+g4401]
+  add rsi, qword ptr [rip+g1693]
+  mov byte ptr [rip+g1147], sil
+  movsx rsi, word ptr [rip+g619]
+  movsxd rdi, dword ptr [rip+g4134]
+  add rsi, rdi
+  mov byte ptr [rip+g1148], sil
+  movsx rsi, word ptr [rip+g266]
+  movsx rdi, byte ptr [rip+g4109]
+  add rsi, rdi
+  mov word ptr [rip+g1149], si
+  mov rax, qword ptr [rip+g1140]
+.L.return.u114:
+  ret
+.text
+.p2align 4
+.global u115
+u115:
+  mov rsi, qword ptr [rip+g2431]
+  movsx rdi, byte ptr [rip+g2646]
+  add rsi, rdi
+  mov qword ptr [rip+g1150], rsi
+  movsx rsi, word ptr [rip+g3173]
+  movsx rdi, word ptr [rip+g4102]
+  add rsi, rdi
+  mov qword ptr [rip+g1151], rsi
+  mov rsi, qword ptr [rip+g3783]
+  movsx rdi, byte ptr [rip+g3071]
+  add rsi, rdi
+  mov word ptr [rip+g1152], si
+  mov rsi, qword ptr [rip+g4207]
+  add rsi, qword ptr [rip+g3467]
+  mov word ptr [rip+g1153], si
+  movsx rsi, word ptr [rip+g4885]
+  movsx rdi, word ptr [rip+g365]
+  add rsi, rdi
+  mov byte ptr [rip+g1154], sil
+  movsx rsi, byte ptr [rip+g3240]
+  movsx rdi, word ptr [rip+g2232]
+  add rsi, rdi
+  mov qword ptr [rip+g1155], rsi
+  movsx rsi, word ptr [rip+g4025]
+  add rsi, qword ptr [rip+g1915]
+  mov byte ptr [rip+g1156], sil
+  movsx rsi, word ptr [rip+g105]
+  movsx rdi, word ptr [rip+g3954]
+  add rsi, rdi
+  mov byte ptr [rip+g1157], sil
+  movsx rsi, byte ptr [rip+g1157]
+  add rsi, qword ptr [rip+g3350]
+  mov word ptr [rip+g1158], si
+  movsx rsi, word ptr [rip+g2673]
+  add rsi, qword ptr [rip+g3965]
+  mov dword ptr [rip+g1159], esi
+  mov rax, qword ptr [rip+g1150]
+.L.return.u115:
+  ret
+.text
+.p2align 4
+.global u116
+u116:
+  movsx rsi, byte ptr [rip+g2696]
+  movsx rdi, byte ptr [rip+g2831]
+  add rsi, rdi
+  mov dword ptr [rip+g1160], esi
+  movsx rsi, byte ptr [rip+g2083]
+  movsxd rdi, dword ptr [rip+g1514]
+  add rsi, rdi
+  mov byte ptr [rip+g1161], sil
+  movsxd rsi, dword ptr [rip+g2606]
+  add rsi, qword ptr [rip+g2120]
+  mov qword ptr [rip+g1162], rsi
+  movsx rsi, byte ptr [rip+g1606]
+  add rsi, qword ptr [rip+g3183]
+  mov qword ptr [rip+g1163], rsi
+  movsx rsi, word ptr [rip+g2474]
+  movsx rdi, word ptr [rip+g654]
+  add rsi, rdi
+  mov word ptr [rip+g1164], si
+  movsx rsi, byte ptr [rip+g3561]
+  add rsi, qword ptr [rip+g4352]
+  mov word ptr [rip+g1165], si
+  movsx rsi, word ptr [rip+g4164]
+  add rsi, qword ptr [rip+g2718]
+  mov word ptr [rip+g1166], si
+  movsx rsi, byte ptr [rip+g2178]
+  add rsi, qword ptr [rip+g3044]
+  mov word ptr [rip+g1167], si
+  mov rsi, qword ptr [rip+g320]
+  movsx rdi, word ptr [rip+g1134]
+  add rsi, rdi
+  mov word ptr [rip+g1168], si
+  movsx rsi, word ptr [rip+g54]
+  add rsi, qword ptr [rip+g4154]
+  mov qword ptr [rip+g1169], rsi
+  movsxd rsi, dword ptr [rip+g1160]
+  mov rax, rsi
+.L.return.u116:
+  ret
+.text
+.p2align 4
+.global u117
+u117:
+  movsx rsi, byte ptr [rip+g532]
+  movsxd rdi, dword ptr [rip+g2874]
+  add rsi, rdi
+  mov qword ptr [rip+g1170], rsi
+  mov rsi, qword ptr [rip+g4494]
+  movsx rdi, word ptr [rip+g1702]
+  add rsi, rdi
+  mov word ptr [rip+g1171], si
+  movsxd rsi, dword ptr [rip+g2931]
+  movsx rdi, byte ptr [rip+g4427]
+  add rsi, rdi
+  mov qword ptr [rip+g1172], rsi
+  movsx rsi, word ptr [rip+g661]
+  movsx rdi, word ptr [rip+g3149]
+  add rsi, rdi
+  mov qword ptr [rip+g1173], rsi
+  mov rsi, qword ptr [rip+g4940]
+  add rsi, qword ptr [rip+g2084]
+  mov word ptr [rip+g1174], si
+  movsx rsi, byte ptr [rip+g4522]
+  add rsi, qword ptr [rip+g2377]
+  mov byte ptr [rip+g1175], sil
+  movsx rsi, word ptr [rip+g1921]
+  movsxd rdi, dword ptr [rip+g4358]
+  add rsi, rdi
+  mov byte ptr [rip+g1176], sil
+  movsx rsi, word ptr [rip+g3659]
+  movsx rdi, byte ptr [rip+g3146]
+  add rsi, rdi
+  mov word ptr [rip+g1177], si
+  mov rsi, qword ptr [rip+g3361]
+  movsx rdi, byte ptr [rip+g338]
+  add rsi, rdi
+  mov dword ptr [rip+g1178], esi
+  mov rsi, qword ptr [rip+g1151]
+  movsx rdi, word ptr [rip+g2066]
+  add rsi, rdi
+  mov qword ptr [rip+g1179], rsi
+  mov rax, qword ptr [rip+g1170]
+.L.return.u117:
+  ret
+.text
+.p2align 4
+.global u118
+u118:
+  movsx rsi, byte ptr [rip+g3908]
+  movsxd rdi, dword ptr [rip+g261]
+  add rsi, rdi
+  mov byte ptr [rip+g1180], sil
+  movsxd rsi, dword ptr [rip+g4126]
+  movsx rdi, word ptr [rip+g2418]
+  add rsi, rdi
+  mov word ptr [rip+g1181], si
+  movsx rsi, word ptr [rip+g197]
+  add rsi, qword ptr [rip+g962]
+  mov dword ptr [rip+g1182], esi
+  mov rsi, qword ptr [rip+g932]
+  movsx rdi, word ptr [rip+g4337]
+  add rsi, rdi
+  mov byte ptr [rip+g1183], sil
+  movsxd rsi, dword ptr [rip+g4460]
+  movsxd rdi, dword ptr [rip+g2292]
+  add rsi, rdi
+  mov word ptr [rip+g1184], si
+  movsx rsi, word ptr [rip+g242]
+  movsx rdi, word ptr [rip+g2908]
+  add rsi, rdi
+  mov qword ptr [rip+g1185], rsi
+  mov rsi, qword ptr [rip+g277]
+  add rsi, qword ptr [rip+g3141]
+  mov dword ptr [rip+g1186], esi
+  mov rsi, qword ptr [rip+g3697]
+  movsxd rdi, dword ptr [rip+g193]
+  add rsi, rdi
+  mov byte ptr [rip+g1187], sil
+  movsxd rsi, dword ptr [rip+g4148]
+  movsxd rdi, dword ptr [rip+g4578]
+  add rsi, rdi
+  mov byte ptr [rip+g1188], sil
+  movsx rsi, word ptr [rip+g1655]
+  movsx rdi, word ptr [rip+g2323]
+  add rsi, rdi
+  mov word ptr [rip+g1189], si
+  movsx rsi, byte ptr [rip+g1180]
+  mov rax, rsi
+.L.return.u118:
+  ret
+.text
+.p2align 4
+.global u119
+u119:
+  mov rsi, qword ptr [rip+g1915]
+  movsx rdi, word ptr [rip+g2166]
+  add rsi, rdi
+  mov byte ptr [rip+g1190], sil
+  movsxd rsi, dword ptr [rip+g1530]
+  movsx rdi, word ptr [rip+g4397]
+  add rsi, rdi
+  mov byte ptr [rip+g1191], sil
+  movsx rsi, byte ptr [rip+g210]
+  movsx rdi, word ptr [rip+g4697]
+  add rsi, rdi
+  mov byte ptr [rip+g1192], sil
+  mov rsi, qword ptr [rip+g1477]
+  movsxd rdi, dword ptr [rip+g1995]
+  add rsi, rdi
+  mov byte ptr [rip+g1193], sil
+  movsx rsi, byte ptr [rip+g2697]
+  movsxd rdi, dword ptr [rip+g4318]
+  add rsi, rdi
+  mov byte ptr [rip+g1194], sil
+  movsx rsi, byte ptr [rip+g3897]
+  add rsi, qword ptr [rip+g2239]
+  mov byte ptr [rip+g1195], sil
+  movsxd rsi, dword ptr [rip+g596]
+  add rsi, qword ptr [rip+g586]
+  mov qword ptr [rip+g1196], rsi
+  movsxd rsi, dword ptr [rip+g3180]
+  movsx rdi, word ptr [rip+g802]
+  add rsi, rdi
+  mov qword ptr [rip+g1197], rsi
+  movsx rsi, word ptr [rip+g4644]
+  movsx rdi, byte ptr [rip+g2241]
+  add rsi, rdi
+  mov dword ptr [rip+g1198], esi
+  mov rsi, qword ptr [rip+g3552]
+  movsx rdi, byte ptr [rip+g267]
+  add rsi, rdi
+  mov byte ptr [rip+g1199], sil
+  movsx rsi, byte ptr [rip+g1190]
+  mov rax, rsi
+.L.return.u119:
+  ret
+.text
+.p2align 4
+.global u120
+u120:
+  movsx rsi, word ptr [rip+g2625]
+  movsx rdi, word ptr [rip+g2688]
+  add rsi, rdi
+  mov word ptr [rip+g1200], si
+  mov rsi, qword ptr [rip+g3651]
+  movsxd rdi, dword ptr [rip+g3193]
+  add rsi, rdi
+  mov dword ptr [rip+g1201], esi
+  movsx rsi, byte ptr [rip+g1131]
+  movsx rdi, word ptr [rip+g2774]
+  add rsi, rdi
+  mov word ptr [rip+g1202], si
+  movsx rsi, word ptr [rip+g2636]
+  movsx rdi, byte ptr [rip+g4878]
+  add rsi, rdi
+  mov word ptr [rip+g1203], si
+  movsxd rsi, dword ptr [rip+g4916]
+  movsx rdi, byte ptr [rip+g3967]
+  add rsi, rdi
+  mov byte ptr [rip+g1204], sil
+  movsx rsi, byte ptr [rip+g2849]
+  movsxd rdi, dword ptr [rip+g1644]
+  add rsi, rdi
+  mov byte ptr [rip+g1205], sil
+  movsxd rsi, dword ptr [rip+g2409]
+  movsxd rdi, dword ptr [rip+g4301]
+  add rsi, rdi
+  mov word ptr [rip+g1206], si
+  movsx rsi, word ptr [rip+g1738]
+  add rsi, qword ptr [rip+g1476]
+  mov qword ptr [rip+g1207], rsi
+  movsxd rsi, dword ptr [rip+g4588]
+  movsx rdi, word ptr [rip+g4246]
+  add rsi, rdi
+  mov qword ptr [rip+g1208], rsi
+  mov rsi, qword ptr [rip+g3965]
+  movsxd rdi, dword ptr [rip+g1254]
+  add rsi, rdi
+  mov byte ptr [rip+g1209], sil
+  movsx rsi, word ptr [rip+g1200]
+  mov rax, rsi
+.L.return.u120:
+  ret
+.text
+.p2align 4
+.global u121
+u121:
+  mov rsi, qword ptr [rip+g4611]
+  add rsi, qword ptr [rip+g1090]
+  mov word ptr [rip+g1210], si
+  movsx rsi, byte ptr [rip+g4640]
+  movsx rdi, byte ptr [rip+g1733]
+  add rsi, rdi
+  mov qword ptr [rip+g1211], rsi
+  movsx rsi, word ptr [rip+g431]
+  movsxd rdi, dword ptr [rip+g2624]
+  add rsi, rdi
+  mov byte ptr [rip+g1212], sil
+  movsxd rsi, dword ptr [rip+g3513]
+  movsxd rdi, dword ptr [rip+g4881]
+  add rsi, rdi
+  mov qword ptr [rip+g1213], rsi
+  mov rsi, qword ptr [rip+g4731]
+  movsx rdi, word ptr [rip+g421]
+  add rsi, rdi
+  mov word ptr [rip+g1214], si
+  mov rsi, qword ptr [rip+g4443]
+  add rsi, qword ptr [rip+g3518]
+  mov dword ptr [rip+g1215], esi
+  mov rsi, qword ptr [rip+g333]
+  movsx rdi, byte ptr [rip+g1591]
+  add rsi, rdi
+  mov qword ptr [rip+g1216], rsi
+  movsx rsi, byte ptr [rip+g2085]
+  movsx rdi, word ptr [rip+g1224]
+  add rsi, rdi
+  mov byte ptr [rip+g1217], sil
+  movsx rsi, word ptr [rip+g4893]
+  movsx rdi, word ptr [rip+g3815]
+  add rsi, rdi
+  mov dword ptr [rip+g1218], esi
+  movsxd rsi, dword ptr [rip+g3743]
+  movsx rdi, byte ptr [rip+g198]
+  add rsi, rdi
+  mov dword ptr [rip+g1219], esi
+  movsx rsi, word ptr [rip+g1210]
+  mov rax, rsi
+.L.return.u121:
+  ret
+.text
+.p2align 4
+.global u122
+u122:
+  mov rsi, qword ptr [rip+g780]
+  add rsi, qword ptr [rip+g3652]
+  mov word ptr [rip+g1220], si
+  mov rsi, qword ptr [rip+g2617]
+  movsx rdi, word ptr [rip+g2676]
+  add rsi, rdi
+  mov qword ptr [rip+g1221], rsi
+  mov rsi, qword ptr [rip+g1265]
+  movsx rdi, word ptr [rip+g2829]
+  add rsi, rdi
+  mov byte ptr [rip+g1222], sil
+  movsxd rsi, dword ptr [rip+g1270]
+  movsxd rdi, dword ptr [rip+g4314]
+  add rsi, rdi
+  mov byte ptr [rip+g1223], sil
+  movsx rsi, byte ptr [rip+g1223]
+  movsxd rdi, dword ptr [rip+g4419]
+  add rsi, rdi
+  mov word ptr [rip+g1224], si
+  movsxd rsi, dword ptr [rip+g3973]
+  movsx rdi, word ptr [rip+g776]
+  add rsi, rdi
+  mov byte ptr [rip+g1225], sil
+  movsx rsi, word ptr [rip+g4967]
+  add rsi, qword ptr [rip+g2767]
+  mov byte ptr [rip+g1226], sil
+  movsxd rsi, dword ptr [rip+g1940]
+  movsx rdi, word ptr [rip+g1817]
+  add rsi, rdi
+  mov byte ptr [rip+g1227], sil
+  movsx rsi, word ptr [rip+g2550]
+  movsx rdi, byte ptr [rip+g4853]
+  add rsi, rdi
+  mov dword ptr [rip+g1228], esi
+  movsx rsi, byte ptr [rip+g4302]
+  movsx rdi, byte ptr [rip+g4996]
+  add rsi, rdi
+  mov byte ptr [rip+g1229], sil
+  movsx rsi, word ptr [rip+g1220]
+  mov rax, rsi
+.L.return.u122:
+  ret
+.text
+.p2align 4
+.global u123
+u123:
+  movsx rsi, word ptr [rip+g4417]
+  add rsi, qword ptr [rip+g4083]
+  mov byte ptr [rip+g1230], sil
+  movsxd rsi, dword ptr [rip+g4735]
+  movsxd rdi, dword ptr [rip+g2983]
+  add rsi, rdi
+  mov dword ptr [rip+g1231], esi
+  movsxd rsi, dword ptr [rip+g298]
+  add rsi, qword ptr [rip+g2911]
+  mov qword ptr [rip+g1232], rsi
+  movsx rsi, word ptr [rip+g3292]
+  movsxd rdi, dword ptr [rip+g1089]
+  add rsi, rdi
+  mov word ptr [rip+g1233], si
+  movsx rsi, byte ptr [rip+g2244]
+  movsxd rdi, dword ptr [rip+g2621]
+  add rsi, rdi
+  mov qword ptr [rip+g1234], rsi
+  movsx rsi, word ptr [rip+g1888]
+  movsx rdi, word ptr [rip+g940]
+  add rsi, rdi
+  mov dword ptr [rip+g1235], esi
+  movsx rsi, word ptr [rip+g1874]
+  movsxd rdi, dword ptr [rip+g1800]
+  add rsi, rdi
+  mov dword ptr [rip+g1236], esi
+  movsxd rsi, dword ptr [rip+g3961]
+  movsxd rdi, dword ptr [rip+g1705]
+  add rsi, rdi
+  mov byte ptr [rip+g1237], sil
+  movsxd rsi, dword ptr [rip+g3323]
+  add rsi, qword ptr [rip+g1546]
+  mov dword ptr [rip+g1238], esi
+  movsx rsi, word ptr [rip+g4423]
+  add rsi, qword ptr [rip+g40]
+  mov word ptr [rip+g1239], si
+  movsx rsi, byte ptr [rip+g1230]
+  mov rax, rsi
+.L.return.u123:
+  ret
+.text
+.p2align 4
+.global u124
+u124:
+  movsx rsi, byte ptr [rip+g3649]
+  movsx rdi, byte ptr [rip+g3269]
+  add rsi, rdi
+  mov dword ptr [rip+g1240], esi
+  movsxd rsi, dword ptr [rip+g1842]
+  movsxd rdi, dword ptr [rip+g2842]
+  add rsi, rdi
+  mov word ptr [rip+g1241], si
+  movsx rsi, word ptr [rip+g4767]
+  movsx rdi, word ptr [rip+g2802]
+  add rsi, rdi
+  mov qword ptr [rip+g1242], rsi
+  movsx rsi, byte ptr [rip+g3913]
+  movsxd rdi, dword ptr [rip+g2812]
+  add rsi, rdi
+  mov byte ptr [rip+g1243], sil
+  mov rsi, qword ptr [rip+g2752]
+  movsxd rdi, dword ptr [rip+g810]
+  add rsi, rdi
+  mov dword ptr [rip+g1244], esi
+  movsx rsi, word ptr [rip+g3987]
+  movsx rdi, byte ptr [rip+g4449]
+  add rsi, rdi
+  mov qword ptr [rip+g1245], rsi
+  mov rsi, qword ptr [rip+g2591]
+  movsxd rdi, dword ptr [rip+g1851]
+  add rsi, rdi
+  mov byte ptr [rip+g1246], sil
+  movsx rsi, byte ptr [rip+g2728]
+  add rsi, qword ptr [rip+g4319]
+  mov word ptr [rip+g1247], si
+  mov rsi, qword ptr [rip+g1208]
+  movsxd rdi, dword ptr [rip+g3926]
+  add rsi, rdi
+  mov byte ptr [rip+g1248], sil
+  movsxd rsi, dword ptr [rip+g1663]
+  add rsi, qword ptr [rip+g3135]
+  mov qword ptr [rip+g1249], rsi
+  movsxd rsi, dword ptr [rip+g1240]
+  mov rax, rsi
+.L.return.u124:
+  ret
+.text
+.p2align 4
+.global u125
+u125:
+  movsxd rsi, dword ptr [rip+g1636]
+  movsx rdi, byte ptr [rip+g2686]
+  add rsi, rdi
+  mov byte ptr [rip+g1250], sil
+  mov rsi, qword ptr [rip+g3732]
+  movsxd rdi, dword ptr [rip+g2610]
+  add rsi, rdi
+  mov byte ptr [rip+g1251], sil
+  movsx rsi, byte ptr [rip+g26]
+  movsxd rdi, dword ptr [rip+g541]
+  add rsi, rdi
+  mov qword ptr [rip+g1252], rsi
+  mov rsi, qword ptr [rip+g4500]
+  movsxd rdi, dword ptr [rip+g1974]
+  add rsi, rdi
+  mov word ptr [rip+g1253], si
+  movsx rsi, byte ptr [rip+g4670]
+  movsx rdi, word ptr [rip+g3633]
+  add rsi, rdi
+  mov dword ptr [rip+g1254], esi
+  mov rsi, qword ptr [rip+g1928]
+  movsx rdi, byte ptr [rip+g209]
+  add rsi, rdi
+  mov word ptr [rip+g1255], si
+  mov rsi, qword ptr [rip+g779]
+  movsx rdi, byte ptr [rip+g4700]
+  add rsi, rdi
+  mov word ptr [rip+g1256], si
+  movsxd rsi, dword ptr [rip+g2102]
+  movsx rdi, byte ptr [rip+g1607]
+  add rsi, rdi
+  mov word ptr [rip+g1257], si
+  mov rsi, qword ptr [rip+g841]
+  movsxd rdi, dword ptr [rip+g2171]
+  add rsi, rdi
+  mov byte ptr [rip+g1258], sil
+  movsx rsi, byte ptr [rip+g2284]
+  movsxd rdi, dword ptr [rip+g2542]
+  add rsi, rdi
+  mov dword ptr [rip+g1259], esi
+  movsx rsi, byte ptr [rip+g1250]
+  mov rax, rsi
+.L.return.u125:
+  ret
+.text
+.p2align 4
+.global u126
+u126:
+  movsx rsi, word ptr [rip+g1023]
+  add rsi, qword ptr [rip+g3322]
+  mov byte ptr [rip+g1260], sil
+  movsx rsi, byte ptr [rip+g2747]
+  movsx rdi, word ptr [rip+g4150]
+  add rsi, rdi
+  mov dword ptr [rip+g1261], esi
+  movsx rsi, word ptr [rip+g3927]
+  movsx rdi, byte ptr [rip+g1763]
+  add rsi, rdi
+  mov byte ptr [rip+g1262], sil
+  movsxd rsi, dword ptr [rip+g944]
+  movsxd rdi, dword ptr [rip+g4045]
+  add rsi, rdi
+  mov qword ptr [rip+g1263], rsi
+  movsx rsi, byte ptr [rip+g2748]
+  add rsi, qword ptr [rip+g3557]
+  mov dword ptr [rip+g1264], esi
+  movsx rsi, byte ptr [rip+g1497]
+  movsx rdi, byte ptr [rip+g32]
+  add rsi, rdi
+  mov qword ptr [rip+g1265], rsi
+  movsx rsi, byte ptr [rip+g3579]
+  add rsi, qword ptr [rip+g2940]
+  mov byte ptr [rip+g1266], sil
+  movsx rsi, word ptr [rip+g3633]
+  movsx rdi, byte ptr [rip+g3329]
+  add rsi, rdi
+  mov dword ptr [rip+g1267], esi
+  movsx rsi, word ptr [rip+g3650]
+  movsx rdi, word ptr [rip+g2149]
+  add rsi, rdi
+  mov word ptr [rip+g1268], si
+  movsx rsi, byte ptr [rip+g2207]
+  add rsi, qword ptr [rip+g3965]
+  mov qword ptr [rip+g1269], rsi
+  movsx rsi, byte ptr [rip+g1260]
+  mov rax, rsi
+.L.return.u126:
+  ret
+.text
+.p2align 4
+.global u127
+u127:
+  movsx rsi, word ptr [rip+g1954]
+  movsxd rdi, dword ptr [rip+g170]
+  add rsi, rdi
+  mov dword ptr [rip+g1270], esi
+  movsx rsi, byte ptr [rip+g4430]
+  movsxd rdi, dword ptr [rip+g4931]
+  add rsi, rdi
+  mov word ptr [rip+g1271], si
+  movsxd rsi, dword ptr [rip+g3077]
+  movsx rdi, byte ptr [rip+g2728]
+  add rsi, rdi
+  mov dword ptr [rip+g1272], esi
+  mov rsi, qword ptr [rip+g4769]
+  movsx rdi, word ptr [rip+g1519]
+  add rsi, rdi
+  mov word ptr [rip+g1273], si
+  mov rsi, qword ptr [rip+g1905]
+  add rsi, qword ptr [rip+g137]
+  mov byte ptr [rip+g1274], sil
+  mov rsi, qword ptr [rip+g3565]
+  movsx rdi, byte ptr [rip+g3737]
+  add rsi, rdi
+  mov byte ptr [rip+g1275], sil
+  movsx rsi, word ptr [rip+g1047]
+  add rsi, qword ptr [rip+g4745]
+  mov dword ptr [rip+g1276], esi
+  movsx rsi, word ptr [rip+g2936]
+  movsx rdi, byte ptr [rip+g4669]
+  add rsi, rdi
+  mov word ptr [rip+g1277], si
+  movsxd rsi, dword ptr [rip+g3645]
+  movsx rdi, word ptr [rip+g2029]
+  add rsi, rdi
+  mov word ptr [rip+g1278], si
+  mov rsi, qword ptr [rip+g2077]
+  movsx rdi, word ptr [rip+g822]
+  add rsi, rdi
+  mov word ptr [rip+g1279], si
+  movsxd rsi, dword ptr [rip+g1270]
+  mov rax, rsi
+.L.return.u127:
+  ret
+.text
+.p2align 4
+.global u128
+u128:
+  movsx rsi, word ptr [rip+g4695]
+  movsxd rdi, dword ptr [rip+g4662]
+  add rsi, rdi
+  mov byte ptr [rip+g1280], sil
+  movsx rsi, word ptr [rip+g1210]
+  movsx rdi, word ptr [rip+g367]
+  add rsi, rdi
+  mov dword ptr [rip+g1281], esi
+  movsx rsi, byte ptr [rip+g992]
+  movsxd rdi, dword ptr [rip+g206]
+  add rsi, rdi
+  mov qword ptr [rip+g1282], rsi
+  movsxd rsi, dword ptr [rip+g884]
+  add rsi, qword ptr [rip+g707]
+  mov qword ptr [rip+g1283], rsi
+  mov rsi, qword ptr [rip+g17]
+  movsx rdi, word ptr [rip+g1825]
+  add rsi, rdi
+  mov dword ptr [rip+g1284], esi
+  movsx rsi, byte ptr [rip+g3778]
+  movsx rdi, byte ptr [rip+g2284]
+  add rsi, rdi
+  mov dword ptr [rip+g1285], esi
+  movsx rsi, word ptr [rip+g432]
+  movsx rdi, word ptr [rip+g4970]
+  add rsi, rdi
+  mov word ptr [rip+g1286], si
+  mov rsi, qword ptr [rip+g2764]
+  movsxd rdi, dword ptr [rip+g4475]
+  add rsi, rdi
+  mov word ptr [rip+g1287], si
+  movsxd rsi, dword ptr [rip+g460]
+  movsx rdi, word ptr [rip+g2673]
+  add rsi, rdi
+  mov qword ptr [rip+g1288], rsi
+  movsx rsi, word ptr [rip+g3162]
+  movsx rdi, word ptr [rip+g2908]
+  add rsi, rdi
+  mov qword ptr [rip+g1289], rsi
+  movsx rsi, byte ptr [rip+g1280]
+  mov rax, rsi
+.L.return.u128:
+  ret
+.text
+.p2align 4
+.global u129
+u129:
+  mov rsi, qword ptr [rip+g498]
+  movsx rdi, byte ptr [rip+g1713]
+  add rsi, rdi
+  mov word ptr [rip+g1290], si
+  mov rsi, qword ptr [rip+g3741]
+  add rsi, qword ptr [rip+g3652]
+  mov dword ptr [rip+g1291], esi
+  movsx rsi, byte ptr [rip+g711]
+  movsx rdi, word ptr [rip+g463]
+  add rsi, rdi
+  mov dword ptr [rip+g1292], esi
+  movsx rsi, word ptr [rip+g4951]
+  add rsi, qword ptr [rip+g3937]
+  mov word ptr [rip+g1293], si
+  mov rsi, qword ptr [rip+g1401]
+  movsxd rdi, dword ptr [rip+g4588]
+  add rsi, rdi
+  mov byte ptr [rip+g1294], sil
+  mov rsi, qword ptr [rip+g823]
+  movsx rdi, word ptr [rip+g3430]
+  add rsi, rdi
+  mov byte ptr [rip+g1295], sil
+  mov rsi, qword ptr [rip+g3943]
+  movsx rdi, word ptr [rip+g1202]
+  add rsi, rdi
+  mov qword ptr [rip+g1296], rsi
+  mov rsi, qword ptr [rip+g4724]
+  movsx rdi, byte ptr [rip+g4067]
+  add rsi, rdi
+  mov dword ptr [rip+g1297], esi
+  mov rsi, qword ptr [rip+g82]
+  movsx rdi, byte ptr [rip+g2658]
+  add rsi, rdi
+  mov byte ptr [rip+g1298], sil
+  movsx rsi, word ptr [rip+g144]
+  movsxd rdi, dword ptr [rip+g4523]
+  add rsi, rdi
+  mov qword ptr [rip+g1299], rsi
+  movsx rsi, word ptr [rip+g1290]
+  mov rax, rsi
+.L.return.u129:
+  ret
+.text
+.p2align 4
+.global u130
+u130:
+  movsxd rsi, dword ptr [rip+g1654]
+  movsxd rdi, dword ptr [rip+g1017]
+  add rsi, rdi
+  mov qword ptr [rip+g1300], rsi
+  movsx rsi, byte ptr [rip+g3950]
+  movsx rdi, byte ptr [rip+g2211]
+  add rsi, rdi
+  mov dword ptr [rip+g1301], esi
+  mov rsi, qword ptr [rip+g3937]
+  movsx rdi, word ptr [rip+g1031]
+  add rsi, rdi
+  mov byte ptr [rip+g1302], sil
+  mov rsi, qword ptr [rip+g626]
+  movsxd rdi, dword ptr [rip+g110]
+  add rsi, rdi
+  mov byte ptr [rip+g1303], sil
+  movsx rsi, word ptr [rip+g4245]
+  movsx rdi, byte ptr [rip+g3085]
+  add rsi, rdi
+  mov qword ptr [rip+g1304], rsi
+  mov rsi, qword ptr [rip+g3682]
+  movsxd rdi, dword ptr [rip+g2553]
+  add rsi, rdi
+  mov qword ptr [rip+g1305], rsi
+  movsxd rsi, dword ptr [rip+g3530]
+  add rsi, qword ptr [rip+g3680]
+  mov byte ptr [rip+g1306], sil
+  movsx rsi, byte ptr [rip+g4365]
+  movsx rdi, word ptr [rip+g2676]
+  add rsi, rdi
+  mov dword ptr [rip+g1307], esi
+  mov rsi, qword ptr [rip+g1221]
+  movsx rdi, word ptr [rip+g4516]
+  add rsi, rdi
+  mov dword ptr [rip+g1308], esi
+  movsx rsi, word ptr [rip+g1920]
+  movsxd rdi, dword ptr [rip+g714]
+  add rsi, rdi
+  mov word ptr [rip+g1309], si
+  mov rax, qword ptr [rip+g1300]
+.L.return.u130:
+  ret
+.text
+.p2align 4
+.global u131
+u131:
+  movsx rsi, byte ptr [rip+g1262]
+  movsx rdi, byte ptr [rip+g2098]
+  add rsi, rdi
+  mov qword ptr [rip+g1310], rsi
+  movsxd rsi, dword ptr [rip+g2052]
+  movsxd rdi, dword ptr [rip+g2304]
+  add rsi, rdi
+  mov dword ptr [rip+g1311], esi
+  movsx rsi, word ptr [rip+g3791]
+  add rsi, qword ptr [rip+g1179]
+  mov byte ptr [rip+g1312], sil
+  mov rsi, qword ptr [rip+g3412]
+  movsxd rdi, dword ptr [rip+g3033]
+  add rsi, rdi
+  mov byte ptr [rip+g1313], sil
+  mov rsi, qword ptr [rip+g3797]
+  movsx rdi, word ptr [rip+g441]
+  add rsi, rdi
+  mov dword ptr [rip+g1314], esi
+  movsx rsi, byte ptr [rip+g46]
+  movsxd rdi, dword ptr [rip+g4574]
+  add rsi, rdi
+  mov byte ptr [rip+g1315], sil
+  mov rsi, qword ptr [rip+g2703]
+  movsx rdi, byte ptr [rip+g2328]
+  add rsi, rdi
+  mov qword ptr [rip+g1316], rsi
+  movsx rsi, word ptr [rip+g1732]
+  movsx rdi, byte ptr [rip+g2920]
+  add rsi, rdi
+  mov qword ptr [rip+g1317], rsi
+  mov rsi, qword ptr [rip+g3147]
+  movsx rdi, byte ptr [rip+g4808]
+  add rsi, rdi
+  mov word ptr [rip+g1318], si
+  movsx rsi, byte ptr [rip+g3950]
+  movsx rdi, byte ptr [rip+g3922]
+  add rsi, rdi
+  mov dword ptr [rip+g1319], esi
+  mov rax, qword ptr [rip+g1310]
+.L.return.u131:
+  ret
+.text
+.p2align 4
+.global u132
+u132:
+  movsxd rsi, dword ptr [rip+g2806]
+  add rsi, qword ptr [rip+g2487]
+  mov byte ptr [rip+g1320], sil
+  movsx rsi, word ptr [rip+g4407]
+  movsx rdi, byte ptr [rip+g173]
+  add rsi, rdi
+  mov dword ptr [rip+g1321], esi
+  movsx rsi, word ptr [rip+g3917]
+  movsx rdi, byte ptr [rip+g2075]
+  add rsi, rdi
+  mov qword ptr [rip+g1322], rsi
+  movsxd rsi, dword ptr [rip+g2738]
+  movsx rdi, byte ptr [rip+g38]
+  add rsi, rdi
+  mov qword ptr [rip+g1323], rsi
+  movsx rsi, byte ptr [rip+g716]
+  movsxd rdi, dword ptr [rip+g1536]
+  add rsi, rdi
+  mov byte ptr [rip+g1324], sil
+  movsxd rsi, dword ptr [rip+g976]
+  movsx rdi, word ptr [rip+g3566]
+  add rsi, rdi
+  mov word ptr [rip+g1325], si
+  movsxd rsi, dword ptr [rip+g318]
+  movsx rdi, byte ptr [rip+g2088]
+  add rsi, rdi
+  mov byte ptr [rip+g1326], sil
+  movsxd rsi, dword ptr [rip+g147]
+  movsx rdi, word ptr [rip+g578]
+  add rsi, rdi
+  mov word ptr [rip+g1327], si
+  movsxd rsi, dword ptr [rip+g1643]
+  movsx rdi, byte ptr [rip+g3589]
+  add rsi, rdi
+  mov dword ptr [rip+g1328], esi
+  movsx rsi, byte ptr [rip+g836]
+  add rsi, qword ptr [rip+g4072]
+  mov word ptr [rip+g1329], si
+  movsx rsi, byte ptr [rip+g1320]
+  mov rax, rsi
+.L.return.u132:
+  ret
+.text
+.p2align 4
+.global u133
+u133:
+  mov rsi, qword ptr [rip+g3689]
+  movsx rdi, word ptr [rip+g2353]
+  add rsi, rdi
+  mov byte ptr [rip+g1330], sil
+  mov rsi, qword ptr [rip+g321]
+  movsx rdi, word ptr [rip+g765]
+  add rsi, rdi
+  mov dword ptr [rip+g1331], esi
+  movsx rsi, word ptr [rip+g4635]
+  movsx rdi, word ptr [rip+g1793]
+  add rsi, rdi
+  mov qword ptr [rip+g1332], rsi
+  mov rsi, qword ptr [rip+g808]
+  add rsi, qword ptr [rip+g1445]
+  mov dword ptr [rip+g1333], esi
+  mov rsi, qword ptr [rip+g3598]
+  movsx rdi, byte ptr [rip+g3812]
+  add rsi, rdi
+  mov word ptr [rip+g1334], si
+  movsx rsi, byte ptr [rip+g573]
+  movsx rdi, byte ptr [rip+g1805]
+  add rsi, rdi
+  mov qword ptr [rip+g1335], rsi
+  movsx rsi, byte ptr [rip+g4838]
+  movsxd rdi, dword ptr [rip+g2929]
+  add rsi, rdi
+  mov byte ptr [rip+g1336], sil
+  mov rsi, qword ptr [rip+g1676]
+  movsxd rdi, dword ptr [rip+g4066]
+  add rsi, rdi
+  mov byte ptr [rip+g1337], sil
+  mov rsi, qword ptr [rip+g3147]
+  movsx rdi, byte ptr [rip+g3377]
+  add rsi, rdi
+  mov dword ptr [rip+g1338], esi
+  movsx rsi, word ptr [rip+g4000]
+  add rsi, qword ptr [rip+g237]
+  mov word ptr [rip+g1339], si
+  movsx rsi, byte ptr [rip+g1330]
+  mov rax, rsi
+.L.return.u133:
+  ret
+.text
+.p2align 4
+.global u134
+u134:
+  movsxd rsi, dword ptr [rip+g899]
+  add rsi, qword ptr [rip+g247]
+  mov byte ptr [rip+g1340], sil
+  mov rsi, qword ptr [rip+g705]
+  add rsi, qword ptr [rip+g4751]
+  mov word ptr [rip+g1341], si
+  movsx rsi, word ptr [rip+g3688]
+  add rsi, qword ptr [rip+g396]
+  mov qword ptr [rip+g1342], rsi
+  movsxd rsi, dword ptr [rip+g1845]
+  movsx rdi, word ptr [rip+g1819]
+  add rsi, rdi
+  mov dword ptr [rip+g1343], esi
+  movsxd rsi, dword ptr [rip+g4259]
+  movsxd rdi, dword ptr [rip+g2880]
+  add rsi, rdi
+  mov qword ptr [rip+g1344], rsi
+  movsxd rsi, dword ptr [rip+g1672]
+  movsx rdi, byte ptr [rip+g1620]
+  add rsi, rdi
+  mov word ptr [rip+g1345], si
+  movsx rsi, byte ptr [rip+g1425]
+  movsx rdi, byte ptr [rip+g3181]
+  add rsi, rdi
+  mov dword ptr [rip+g1346], esi
+  movsxd rsi, dword ptr [rip+g420]
+  movsx rdi, byte ptr [rip+g2919]
+  add rsi, rdi
+  mov dword ptr [rip+g1347], esi
+  movsx rsi, byte ptr [rip+g1183]
+  movsx rdi, word ptr [rip+g2341]
+  add rsi, rdi
+  mov qword ptr [rip+g1348], rsi
+  movsx rsi, word ptr [rip+g1108]
+  movsx rdi, word ptr [rip+g1980]
+  add rsi, rdi
+  mov dword ptr [rip+g1349], esi
+  movsx rsi, byte ptr [rip+g1340]
+  mov rax, rsi
+.L.return.u134:
+  ret
+.text
+.p2align 4
+.global u135
+u135:
+  movsx rsi, word ptr [rip+g2615]
+  movsx rdi, byte ptr [rip+g4861]
+  add rsi, rdi
+  mov word ptr [rip+g1350], si
+  mov rsi, qword ptr [rip+g1342]
+  movsxd rdi, dword ptr [rip+g154]
+  add rsi, rdi
+  mov word ptr [rip+g1351], si
+  movsx rsi, byte ptr [rip+g4013]
+  movsxd rdi, dword ptr [rip+g2250]
+  add rsi, rdi
+  mov word ptr [rip+g1352], si
+  movsxd rsi, dword ptr [rip+g3831]
+  add rsi, qword ptr [rip+g1015]
+  mov dword ptr [rip+g1353], esi
+  movsx rsi, byte ptr [rip+g2241]
+  movsx rdi, byte ptr [rip+g1963]
+  add rsi, rdi
+  mov qword ptr [rip+g1354], rsi
+  movsx rsi, byte ptr [rip+g1355]
+  movsx rdi, byte ptr [rip+g1199]
+  add rsi, rdi
+  mov byte ptr [rip+g1355], sil
+  movsx rsi, word ptr [rip+g2788]
+  movsxd rdi, dword ptr [rip+g1297]
+  add rsi, rdi
+  mov word ptr [rip+g1356], si
+  movsx rsi, byte ptr [rip+g43]
+  add rsi, qword ptr [rip+g2759]
+  mov qword ptr [rip+g1357], rsi
+  movsxd rsi, dword ptr [rip+g3972]
+  movsx rdi, word ptr [rip+g4980]
+  add rsi, rdi
+  mov dword ptr [rip+g1358], esi
+  movsx rsi, word ptr [rip+g2359]
+  movsx rdi, byte ptr [rip+g3661]
+  add rsi, rdi
+  mov dword ptr [rip+g1359], esi
+  movsx rsi, word ptr [rip+g1350]
+  mov rax, rsi
+.L.return.u135:
+  ret
+.text
+.p2align 4
+.global u136
+u136:
+  movsxd rsi, dword ptr [rip+g3118]
+  add rsi, qword ptr [rip+g2926]
+  mov qword ptr [rip+g1360], rsi
+  movsx rsi, byte ptr [rip+g3564]
+  movsxd rdi, dword ptr [rip+g4419]
+  add rsi, rdi
+  mov byte ptr [rip+g1361], sil
+  mov rsi, qword ptr [rip+g4350]
+  add rsi, qword ptr [rip+g946]
+  mov qword ptr [rip+g1362], rsi
+  movsx rsi, byte ptr [rip+g109]
+  movsxd rdi, dword ptr [rip+g2092]
+  add rsi, rdi
+  mov word ptr [rip+g1363], si
+  mov rsi, qword ptr [rip+g3000]
+  movsx rdi, byte ptr [rip+g2751]
+  add rsi, rdi
+  mov qword ptr [rip+g1364], rsi
+  mov rsi, qword ptr [rip+g755]
+  movsx rdi, word ptr [rip+g661]
+  add rsi, rdi
+  mov word ptr [rip+g1365], si
+  movsx rsi, word ptr [rip+g4131]
+  movsxd rdi, dword ptr [rip+g2414]
+  add rsi, rdi
+  mov qword ptr [rip+g1366], rsi
+  movsx rsi, byte ptr [rip+g223]
+  movsx rdi, byte ptr [rip+g3213]
+  add rsi, rdi
+  mov qword ptr [rip+g1367], rsi
+  movsx rsi, word ptr [rip+g3570]
+  movsxd rdi, dword ptr [rip+g1270]
+  add rsi, rdi
+  mov dword ptr [rip+g1368], esi
+  movsx rsi, word ptr [rip+g1129]
+  movsxd rdi, dword ptr [rip+g3497]
+  add rsi, rdi
+  mov word ptr [rip+g1369], si
+  mov rax, qword ptr [rip+g1360]
+.L.return.u136:
+  ret
+.text
+.p2align 4
+.global u137
+u137:
+  movsx rsi, word ptr [rip+g3190]
+  add rsi, qword ptr [rip+g4999]
+  mov qword ptr [rip+g1370], rsi
+  mov rsi, qword ptr [rip+g3983]
+  movsxd rdi, dword ptr [rip+g1600]
+  add rsi, rdi
+  mov dword ptr [rip+g1371], esi
+  movsx rsi, byte ptr [rip+g3897]
+  movsx rdi, word ptr [rip+g177]
+  add rsi, rdi
+  mov qword ptr [rip+g1372], rsi
+  mov rsi, qword ptr [rip+g3677]
+  movsxd rdi, dword ptr [rip+g3888]
+  add rsi, rdi
+  mov dword ptr [rip+g1373], esi
+  movsxd rsi, dword ptr [rip+g1328]
+  movsxd rdi, dword ptr [rip+g1892]
+  add rsi, rdi
+  mov byte ptr [rip+g1374], sil
+  movsx rsi, word ptr [rip+g2136]
+  add rsi, qword ptr [rip+g1680]
+  mov dword ptr [rip+g1375], esi
+  movsx rsi, byte ptr [rip+g2278]
+  add rsi, qword ptr [rip+g1296]
+  mov qword ptr [rip+g1376], rsi
+  movsx rsi, word ptr [rip+g2048]
+  add rsi, qword ptr [rip+g383]
+  mov byte ptr [rip+g1377], sil
+  mov rsi, qword ptr [rip+g1125]
+  movsx rdi, word ptr [rip+g3721]
+  add rsi, rdi
+  mov word ptr [rip+g1378], si
+  mov rsi, qword ptr [rip+g1082]
+  movsx rdi, word ptr [rip+g3110]
+  add rsi, rdi
+  mov word ptr [rip+g1379], si
+  mov rax, qword ptr [rip+g1370]
+.L.return.u137:
+  ret
+.text
+.p2align 4
+.global u138
+u138:
+  movsx rsi, word ptr [rip+g3792]
+  add rsi, qword ptr [rip+g3887]
+  mov word ptr [rip+g1380], si
+  movsx rsi, word ptr [rip+g578]
+  add rsi, qword ptr [rip+g515]
+  mov dword ptr [rip+g1381], esi
+  movsx rsi, byte ptr [rip+g2348]
+  movsxd rdi, dword ptr [rip+g1035]
+  add rsi, rdi
+  mov word ptr [rip+g1382], si
+  movsx rsi, byte ptr [rip+g1772]
+  movsxd rdi, dword ptr [rip+g298]
+  add rsi, rdi
+  mov byte ptr [rip+g1383], sil
+  mov rsi, qword ptr [rip+g3934]
+  movsxd rdi, dword ptr [rip+g2005]
+  add rsi, rdi
+  mov word ptr [rip+g1384], si
+  movsx rsi, word ptr [rip+g2056]
+  movsx rdi, word ptr [rip+g1378]
+  add rsi, rdi
+  mov qword ptr [rip+g1385], rsi
+  movsx rsi, word ptr [rip+g1174]
+  add rsi, qword ptr [rip+g3021]
+  mov dword ptr [rip+g1386], esi
+  movsx rsi, byte ptr [rip+g4361]
+  movsx rdi, byte ptr [rip+g1605]
+  add rsi, rdi
+  mov byte ptr [rip+g1387], sil
+  movsx rsi, byte ptr [rip+g3477]
+  movsx rdi, byte ptr [rip+g874]
+  add rsi, rdi
+  mov qword ptr [rip+g1388], rsi
+  mov rsi, qword ptr [rip+g3023]
+  movsx rdi, word ptr [rip+g4982]
+  add rsi, rdi
+  mov word ptr [rip+g1389], si
+  movsx rsi, word ptr [rip+g1380]
+  mov rax, rsi
+.L.return.u138:
+  ret
+.text
+.p2align 4
+.global u139
+u139:
+  movsx rsi, word ptr [rip+g1181]
+  add rsi, qword ptr [rip+g1003]
+  mov dword ptr [rip+g1390], esi
+  mov rsi, qword ptr [rip+g422]
+  movsxd rdi, dword ptr [rip+g3319]
+  add rsi, rdi
+  mov qword ptr [rip+g1391], rsi
+  movsxd rsi, dword ptr [rip+g3335]
+  movsx rdi, byte ptr [rip+g875]
+  add rsi, rdi
+  mov dword ptr [rip+g1392], esi
+  movsxd rsi, dword ptr [rip+g2781]
+  movsxd rdi, dword ptr [rip+g2292]
+  add rsi, rdi
+  mov byte ptr [rip+g1393], sil
+  movsx rsi, byte ptr [rip+g2546]
+  movsxd rdi, dword ptr [rip+g1975]
+  add rsi, rdi
+  mov qword ptr [rip+g1394], rsi
+  movsx rsi, byte ptr [rip+g4323]
+  movsx rdi, word ptr [rip+g4342]
+  add rsi, rdi
+  mov byte ptr [rip+g1395], sil
+  movsx rsi, word ptr [rip+g873]
+  movsx rdi, byte ptr [rip+g1894]
+  add rsi, rdi
+  mov word ptr [rip+g1396], si
+  mov rsi, qword ptr [rip+g3217]
+  add rsi, qword ptr [rip+g2294]
+  mov byte ptr [rip+g1397], sil
+  movsx rsi, byte ptr [rip+g251]
+  movsxd rdi, dword ptr [rip+g937]
+  add rsi, rdi
+  mov dword ptr [rip+g1398], esi
+  movsx rsi, byte ptr [rip+g3504]
+  movsxd rdi, dword ptr [rip+g2414]
+  add rsi, rdi
+  mov byte ptr [rip+g1399], sil
+  movsxd rsi, dword ptr [rip+g1390]
+  mov rax, rsi
+.L.return.u139:
+  ret
+.text
+.p2align 4
+.global u140
+u140:
+  mov rsi, qword ptr [rip+g1063]
+  add rsi, qword ptr [rip+g2183]
+  mov qword ptr [rip+g1400], rsi
+  movsxd rsi, dword ptr [rip+g513]
+  movsx rdi, byte ptr [rip+g2110]
+  add rsi, rdi
+  mov qword ptr [rip+g1401], rsi
+  movsxd rsi, dword ptr [rip+g608]
+  movsx rdi, byte ptr [rip+g438]
+  add rsi, rdi
+  mov word ptr [rip+g1402], si
+  movsx rsi, byte ptr [rip+g2044]
+  movsxd rdi, dword ptr [rip+g3712]
+  add rsi, rdi
+  mov dword ptr [rip+g1403], esi
+  movsx rsi, byte ptr [rip+g1766]
+  movsx rdi, byte ptr [rip+g2627]
+  add rsi, rdi
+  mov dword ptr [rip+g1404], esi
+  mov rsi, qword ptr [rip+g4027]
+  movsx rdi, word ptr [rip+g4844]
+  add rsi, rdi
+  mov qword ptr [rip+g1405], rsi
+  movsx rsi, word ptr [rip+g3030]
+  movsx rdi, word ptr [rip+g3255]
+  add rsi, rdi
+  mov byte ptr [rip+g1406], sil
+  mov rsi, qword ptr [rip+g3363]
+  movsx rdi, byte ptr [rip+g67]
+  add rsi, rdi
+  mov dword ptr [rip+g1407], esi
+  movsxd rsi, dword ptr [rip+g2219]
+  movsx rdi, word ptr [rip+g4923]
+  add rsi, rdi
+  mov byte ptr [rip+g1408], sil
+  movsxd rsi, dword ptr [rip+g2597]
+  movsx rdi, word ptr [rip+g2802]
+  add rsi, rdi
+  mov dword ptr [rip+g1409], esi
+  mov rax, qword ptr [rip+g1400]
+.L.return.u140:
+  ret
+.text
+.p2align 4
+.global u141
+u141:
+  movsxd rsi, dword ptr [rip+g1514]
+  movsx rdi, byte ptr [rip+g4203]
+  add rsi, rdi
+  mov byte ptr [rip+g1410], sil
+  movsxd rsi, dword ptr [rip+g3775]
+  add rsi, qword ptr [rip+g4837]
+  mov dword ptr [rip+g1411], esi
+  movsx rsi, word ptr [rip+g2082]
+  add rsi, qword ptr [rip+g440]
+  mov byte ptr [rip+g1412], sil
+  movsx rsi, byte ptr [rip+g603]
+  add rsi, qword ptr [rip+g2023]
+  mov qword ptr [rip+g1413], rsi
+  movsxd rsi, dword ptr [rip+g2557]
+  movsx rdi, byte ptr [rip+g1246]
+  add rsi, rdi
+  mov qword ptr [rip+g1414], rsi
+  mov rsi, qword ptr [rip+g4070]
+  add rsi, qword ptr [rip+g3946]
+  mov byte ptr [rip+g1415], sil
+  mov rsi, qword ptr [rip+g1283]
+  add rsi, qword ptr [rip+g1675]
+  mov qword ptr [rip+g1416], rsi
+  movsx rsi, byte ptr [rip+g2631]
+  movsxd rdi, dword ptr [rip+g1160]
+  add rsi, rdi
+  mov qword ptr [rip+g1417], rsi
+  movsx rsi, byte ptr [rip+g2173]
+  movsxd rdi, dword ptr [rip+g206]
+  add rsi, rdi
+  mov word ptr [rip+g1418], si
+  movsx rsi, word ptr [rip+g1570]
+  movsx rdi, word ptr [rip+g3591]
+  add rsi, rdi
+  mov word ptr [rip+g1419], si
+  movsx rsi, byte ptr [rip+g1410]
+  mov rax, rsi
+.L.return.u141:
+  ret
+.text
+.p2align 4
+.global u142
+u142:
+  movsxd rsi, dword ptr [rip+g4783]
+  movsx rdi, byte ptr [rip+g1918]
+  add rsi, rdi
+  mov dword ptr [rip+g1420], esi
+  mov rsi, qword ptr [rip+g538]
+  add rsi, qword ptr [rip+g314]
+  mov byte ptr [rip+g1421], sil
+  movsxd rsi, dword ptr [rip+g3515]
+  add rsi, qword ptr [rip+g4957]
+  mov word ptr [rip+g1422], si
+  movsx rsi, byte ptr [rip+g3017]
+  movsxd rdi, dword ptr [rip+g142]
+  add rsi, rdi
+  mov byte ptr [rip+g1423], sil
+  movsxd rsi, dword ptr [rip+g604]
+  add rsi, qword ptr [rip+g4263]
+  mov qword ptr [rip+g1424], rsi
+  movsx rsi, byte ptr [rip+g795]
+  movsx rdi, word ptr [rip+g2799]
+  add rsi, rdi
+  mov byte ptr [rip+g1425], sil
+  movsxd rsi, dword ptr [rip+g3681]
+  movsxd rdi, dword ptr [rip+g6]
+  add rsi, rdi
+  mov dword ptr [rip+g1426], esi
+  movsxd rsi, dword ptr [rip+g256]
+  add rsi, qword ptr [rip+g2387]
+  mov qword ptr [rip+g1427], rsi
+  movsxd rsi, dword ptr [rip+g1783]
+  movsx rdi, byte ptr [rip+g1605]
+  add rsi, rdi
+  mov byte ptr [rip+g1428], sil
+  movsx rsi, byte ptr [rip+g1505]
+  add rsi, qword ptr [rip+g523]
+  mov word ptr [rip+g1429], si
+  movsxd rsi, dword ptr [rip+g1420]
+  mov rax, rsi
+.L.return.u142:
+  ret
+.text
+.p2align 4
+.global u143
+u143:
+  movsxd rsi, dword ptr [rip+g3621]
+  movsxd rdi, dword ptr [rip+g2237]
+  add rsi, rdi
+  mov byte ptr [rip+g1430], sil
+  movsx rsi, word ptr [rip+g1589]
+  movsx rdi, word ptr [rip+g3866]
+  add rsi, rdi
+  mov dword ptr [rip+g1431], esi
+  mov rsi, qword ptr [rip+g440]
+  add rsi, qword ptr [rip+g3479]
+  mov qword ptr [rip+g1432], rsi
+  movsxd rsi, dword ptr [rip+g2287]
+  movsx rdi, byte ptr [rip+g3007]
+  add rsi, rdi
+  mov word ptr [rip+g1433], si
+  movsx rsi, word ptr [rip+g151]
+  movsx rdi, byte ptr [rip+g1412]
+  add rsi, rdi
+  mov dword ptr [rip+g1434], esi
+  movsx rsi, byte ptr [rip+g1421]
+  add rsi, qword ptr [rip+g2743]
+  mov dword ptr [rip+g1435], esi
+  movsxd rsi, dword ptr [rip+g2796]
+  movsxd rdi, dword ptr [rip+g83]
+  add rsi, rdi
+  mov dword ptr [rip+g1436], esi
+  movsx rsi, byte ptr [rip+g797]
+  movsxd rdi, dword ptr [rip+g3622]
+  add rsi, rdi
+  mov dword ptr [rip+g1437], esi
+  movsxd rsi, dword ptr [rip+g2956]
+  movsxd rdi, dword ptr [rip+g4593]
+  add rsi, rdi
+  mov word ptr [rip+g1438], si
+  movsxd rsi, dword ptr [rip+g1017]
+  movsxd rdi, dword ptr [rip+g3904]
+  add rsi, rdi
+  mov dword ptr [rip+g1439], esi
+  movsx rsi, byte ptr [rip+g1430]
+  mov rax, rsi
+.L.return.u143:
+  ret
+.text
+.p2align 4
+.global u144
+u144:
+  movsx rsi, word ptr [rip+g3458]
+  movsxd rdi, dword ptr [rip+g1267]
+  add rsi, rdi
+  mov word ptr [rip+g1440], si
+  movsx rsi, word ptr [rip+g3659]
+  movsx rdi, word ptr [rip+g1710]
+  add rsi, rdi
+  mov word ptr [rip+g1441], si
+  movsxd rsi, dword ptr [rip+g4436]
+  add rsi, qword ptr [rip+g3765]
+  mov dword ptr [rip+g1442], esi
+  movsx rsi, word ptr [rip+g1956]
+  add rsi, qword ptr [rip+g3679]
+  mov byte ptr [rip+g1443], sil
+  mov rsi, qword ptr [rip+g348]
+  movsx rdi, word ptr [rip+g44]
+  add rsi, rdi
+  mov qword ptr [rip+g1444], rsi
+  movsx rsi, byte ptr [rip+g4441]
+  movsx rdi, word ptr [rip+g4634]
+  add rsi, rdi
+  mov qword ptr [rip+g1445], rsi
+  movsxd rsi, dword ptr [rip+g4540]
+  add rsi, qword ptr [rip+g3571]
+  mov word ptr [rip+g1446], si
+  mov rsi, qword ptr [rip+g354]
+  add rsi, qword ptr [rip+g3117]
+  mov word ptr [rip+g1447], si
+  mov rsi, qword ptr [rip+g4097]
+  add rsi, qword ptr [rip+g3540]
+  mov qword ptr [rip+g1448], rsi
+  mov rsi, qword ptr [rip+g3347]
+  movsxd rdi, dword ptr [rip+g4338]
+  add rsi, rdi
+  mov qword ptr [rip+g1449], rsi
+  movsx rsi, word ptr [rip+g1440]
+  mov rax, rsi
+.L.return.u144:
+  ret
+.text
+.p2align 4
+.global u145
+u145:
+  movsx rsi, byte ptr [rip+g1591]
+  movsx rdi, word ptr [rip+g1971]
+  add rsi, rdi
+  mov byte ptr [rip+g1450], sil
+  movsxd rsi, dword ptr [rip+g1236]
+  movsxd rdi, dword ptr [rip+g1514]
+  add rsi, rdi
+  mov byte ptr [rip+g1451], sil
+  movsx rsi, word ptr [rip+g100]
+  movsx rdi, word ptr [rip+g1309]
+  add rsi, rdi
+  mov byte ptr [rip+g1452], sil
+  movsx rsi, byte ptr [rip+g2653]
+  movsx rdi, word ptr [rip+g1576]
+  add rsi, rdi
+  mov qword ptr [rip+g1453], rsi
+  movsx rsi, byte ptr [rip+g43]
+  movsxd rdi, dword ptr [rip+g3231]
+  add rsi, rdi
+  mov qword ptr [rip+g1454], rsi
+  movsxd rsi, dword ptr [rip+g1503]
+  movsx rdi, byte ptr [rip+g981]
+  add rsi, rdi
+  mov qword ptr [rip+g1455], rsi
+  movsx rsi, byte ptr [rip+g324]
+  movsx rdi, byte ptr [rip+g4568]
+  add rsi, rdi
+  mov dword ptr [rip+g1456], esi
+  movsx rsi, byte ptr [rip+g1784]
+  add rsi, qword ptr [rip+g3763]
+  mov qword ptr [rip+g1457], rsi
+  mov rsi, qword ptr [rip+g3494]
+  movsx rdi, byte ptr [rip+g251]
+  add rsi, rdi
+  mov qword ptr [rip+g1458], rsi
+  movsxd rsi, dword ptr [rip+g3899]
+  add rsi, qword ptr [rip+g1599]
+  mov dword ptr [rip+g1459], esi
+  movsx rsi, byte ptr [rip+g1450]
+  mov rax, rsi
+.L.return.u145:
+  ret
+.text
+.p2align 4
+.global u146
+u146:
+  movsxd rsi, dword ptr [rip+g1420]
+  movsx rdi, byte ptr [rip+g4974]
+  add rsi, rdi
+  mov byte ptr [rip+g1460], sil
+  movsx rsi, word ptr [rip+g2375]
+  add rsi, qword ptr [rip+g861]
+  mov byte ptr [rip+g1461], sil
+  movsx rsi, byte ptr [rip+g3213]
+  movsxd rdi, dword ptr [rip+g1479]
+  add rsi, rdi
+  mov dword ptr [rip+g1462], esi
+  movsx rsi, word ptr [rip+g4482]
+  movsxd rdi, dword ptr [rip+g203]
+  add rsi, rdi
+  mov byte ptr [rip+g1463], sil
+  movsx rsi, word ptr [rip+g510]
+  movsxd rdi, dword ptr [rip+g3357]
+  add rsi, rdi
+  mov byte ptr [rip+g1464], sil
+  mov rsi, qword ptr [rip+g1972]
+  movsx rdi, byte ptr [rip+g1415]
+  add rsi, rdi
+  mov qword ptr [rip+g1465], rsi
+  movsx rsi, word ptr [rip+g1067]
+  movsx rdi, byte ptr [rip+g2037]
+  add rsi, rdi
+  mov word ptr [rip+g1466], si
+  movsxd rsi, dword ptr [rip+g876]
+  movsxd rdi, dword ptr [rip+g2772]
+  add rsi, rdi
+  mov qword ptr [rip+g1467], rsi
+  mov rsi, qword ptr [rip+g383]
+  movsxd rdi, dword ptr [rip+g1000]
+  add rsi, rdi
+  mov word ptr [rip+g1468], si
+  movsxd rsi, dword ptr [rip+g1820]
+  movsx rdi, word ptr [rip+g1446]
+  add rsi, rdi
+  mov byte ptr [rip+g1469], sil
+  movsx rsi, byte ptr [rip+g1460]
+  mov rax, rsi
+.L.return.u146:
+  ret
+.text
+.p2align 4
+.global u147
+u147:
+  movsxd rsi, dword ptr [rip+g214]
+  movsx rdi, byte ptr [rip+g3176]
+  add rsi, rdi
+  mov byte ptr [rip+g1470], sil
+  movsx rsi, byte ptr [rip+g4206]
+  add rsi, qword ptr [rip+g3664]
+  mov qword ptr [rip+g1471], rsi
+  mov rsi, qword ptr [rip+g1040]
+  movsx rdi, byte ptr [rip+g2823]
+  add rsi, rdi
+  mov byte ptr [rip+g1472], sil
+  movsxd rsi, dword ptr [rip+g4462]
+  movsx rdi, byte ptr [rip+g4281]
+  add rsi, rdi
+  mov dword ptr [rip+g1473], esi
+  movsx rsi, byte ptr [rip+g1896]
+  movsx rdi, byte ptr [rip+g1144]
+  add rsi, rdi
+  mov word ptr [rip+g1474], si
+  movsxd rsi, dword ptr [rip+g2886]
+  movsx rdi, byte ptr [rip+g4529]
+  add rsi, rdi
+  mov dword ptr [rip+g1475], esi
+  mov rsi, qword ptr [rip+g509]
+  add rsi, qword ptr [rip+g3890]
+  mov qword ptr [rip+g1476], rsi
+  mov rsi, qword ptr [rip+g3257]
+  add rsi, qword ptr [rip+g2520]
+  mov qword ptr [rip+g1477], rsi
+  movsx rsi, byte ptr [rip+g4809]
+  add rsi, qword ptr [rip+g4800]
+  mov word ptr [rip+g1478], si
+  movsx rsi, word ptr [rip+g4626]
+  add rsi, qword ptr [rip+g2256]
+  mov dword ptr [rip+g1479], esi
+  movsx rsi, byte ptr [rip+g1470]
+  mov rax, rsi
+.L.return.u147:
+  ret
+.text
+.p2align 4
+.global u148
+u148:
+  movsx rsi, word ptr [rip+g2736]
+  movsx rdi, byte ptr [rip+g3409]
+  add rsi, rdi
+  mov byte ptr [rip+g1480], sil
+  mov rsi, qword ptr [rip+g1619]
+  movsxd rdi, dword ptr [rip+g2285]
+  add rsi, rdi
+  mov word ptr [rip+g1481], si
+  mov rsi, qword ptr [rip+g3467]
+  movsxd rdi, dword ptr [rip+g387]
+  add rsi, rdi
+  mov qword ptr [rip+g1482], rsi
+  movsx rsi, byte ptr [rip+g3985]
+  movsx rdi, word ptr [rip+g2127]
+  add rsi, rdi
+  mov dword ptr [rip+g1483], esi
+  mov rsi, qword ptr [rip+g4723]
+  movsxd rdi, dword ptr [rip+g1127]
+  add rsi, rdi
+  mov byte ptr [rip+g1484], sil
+  movsx rsi, byte ptr [rip+g223]
+  add rsi, qword ptr [rip+g2951]
+  mov word ptr [rip+g1485], si
+  movsx rsi, word ptr [rip+g4379]
+  movsx rdi, word ptr [rip+g3324]
+  add rsi, rdi
+  mov word ptr [rip+g1486], si
+  movsx rsi, byte ptr [rip+g4143]
+  add rsi, qword ptr [rip+g4224]
+  mov qword ptr [rip+g1487], rsi
+  movsxd rsi, dword ptr [rip+g3645]
+  movsx rdi, word ptr [rip+g3360]
+  add rsi, rdi
+  mov dword ptr [rip+g1488], esi
+  movsx rsi, byte ptr [rip+g2345]
+  add rsi, qword ptr [rip+g1781]
+  mov dword ptr [rip+g1489], esi
+  movsx rsi, byte ptr [rip+g1480]
+  mov rax, rsi
+.L.return.u148:
+  ret
+.text
+.p2align 4
+.global u149
+u149:
+  movsx rsi, byte ptr [rip+g4838]
+  movsxd rdi, dword ptr [rip+g275]
+  add rsi, rdi
+  mov word ptr [rip+g1490], si
+  mov rsi, qword ptr [rip+g430]
+  add rsi, qword ptr [rip+g3894]
+  mov byte ptr [rip+g1491], sil
+  movsx rsi, word ptr [rip+g1951]
+  movsx rdi, byte ptr [rip+g784]
+  add rsi, rdi
+  mov byte ptr [rip+g1492], sil
+  movsx rsi, byte ptr [rip+g3012]
+  add rsi, qword ptr [rip+g4233]
+  mov dword ptr [rip+g1493], esi
+  movsx rsi, word ptr [rip+g414]
+  movsx rdi, word ptr [rip+g938]
+  add rsi, rdi
+  mov dword ptr [rip+g1494], esi
+  movsxd rsi, dword ptr [rip+g723]
+  add rsi, qword ptr [rip+g1544]
+  mov byte ptr [rip+g1495], sil
+  movsx rsi, byte ptr [rip+g4237]
+  movsx rdi, word ptr [rip+g450]
+  add rsi, rdi
+  mov byte ptr [rip+g1496], sil
+  movsx rsi, byte ptr [rip+g1630]
+  movsx rdi, word ptr [rip+g1819]
+  add rsi, rdi
+  mov byte ptr [rip+g1497], sil
+  movsx rsi, byte ptr [rip+g4204]
+  movsxd rdi, dword ptr [rip+g4259]
+  add rsi, rdi
+  mov qword ptr [rip+g1498], rsi
+  movsxd rsi, dword ptr [rip+g2730]
+  movsx rdi, byte ptr [rip+g4628]
+  add rsi, rdi
+  mov word ptr [rip+g1499], si
+  movsx rsi, word ptr [rip+g1490]
+  mov rax, rsi
+.L.return.u149:
+  ret
+.text
+.p2align 4
+.global u150
+u150:
+  movsxd rsi, dword ptr [rip+g832]
+  movsx rdi, byte ptr [rip+g3446]
+  add rsi, rdi
+  mov byte ptr [rip+g1500], sil
+  mov rsi, qword ptr [rip+g1476]
+  movsxd rdi, dword ptr [rip+g961]
+  add rsi, rdi
+  mov qword ptr [rip+g1501], rsi
+  mov rsi, qword ptr [rip+g3471]
+  add rsi, qword ptr [rip+g122]
+  mov dword ptr [rip+g1502], esi
+  mov rsi, qword ptr [rip+g4116]
+  movsxd rdi, dword ptr [rip+g1514]
+  add rsi, rdi
+  mov dword ptr [rip+g1503], esi
+  movsx rsi, byte ptr [rip+g1028]
+  add rsi, qword ptr [rip+g1014]
+  mov qword ptr [rip+g1504], rsi
+  movsx rsi, word ptr [rip+g450]
+  movsxd rdi, dword ptr [rip+g3621]
+  add rsi, rdi
+  mov byte ptr [rip+g1505], sil
+  movsx rsi, byte ptr [rip+g1229]
+  movsx rdi, word ptr [rip+g830]
+  add rsi, rdi
+  mov dword ptr [rip+g1506], esi
+  mov rsi, qword ptr [rip+g322]
+  movsx rdi, byte ptr [rip+g2158]
+  add rsi, rdi
+  mov qword ptr [rip+g1507], rsi
+  movsxd rsi, dword ptr [rip+g4948]
+  movsx rdi, byte ptr [rip+g2118]
+  add rsi, rdi
+  mov byte ptr [rip+g1508], sil
+  movsx rsi, word ptr [rip+g3327]
+  movsx rdi, byte ptr [rip+g2211]
+  add rsi, rdi
+  mov byte ptr [rip+g1509], sil
+  movsx rsi, byte ptr [rip+g1500]
+  mov rax, rsi
+.L.return.u150:
+  ret
+.text
+.p2align 4
+.global u151
+u151:
+  movsx rsi, byte ptr [rip+g2945]
+  add rsi, qword ptr [rip+g1196]
+  mov word ptr [rip+g1510], si
+  movsx rsi, byte ptr [rip+g4355]
+  add rsi, qword ptr [rip+g3098]
+  mov word ptr [rip+g1511], si
+  movsx rsi, byte ptr [rip+g685]
+  movsxd rdi, dword ptr [rip+g1585]
+  add rsi, rdi
+  mov dword ptr [rip+g1512], esi
+  movsx rsi, word ptr [rip+g3094]
+  add rsi, qword ptr [rip+g4775]
+  mov qword ptr [rip+g1513], rsi
+  mov rsi, qword ptr [rip+g4686]
+  movsx rdi, word ptr [rip+g71]
+  add rsi, rdi
+  mov dword ptr [rip+g1514], esi
+  movsx rsi, byte ptr [rip+g4013]
+  movsxd rdi, dword ptr [rip+g2720]
+  add rsi, rdi
+  mov dword ptr [rip+g1515], esi
+  movsxd rsi, dword ptr [rip+g3694]
+  movsxd rdi, dword ptr [rip+g4537]
+  add rsi, rdi
+  mov word ptr [rip+g1516], si
+  movsx rsi, byte ptr [rip+g3154]
+  movsxd rdi, dword ptr [rip+g1851]
+  add rsi, rdi
+  mov qword ptr [rip+g1517], rsi
+  movsxd rsi, dword ptr [rip+g1434]
+  movsx rdi, byte ptr [rip+g4771]
+  add rsi, rdi
+  mov qword ptr [rip+g1518], rsi
+  movsxd rsi, dword ptr [rip+g1358]
+  movsxd rdi, dword ptr [rip+g2143]
+  add rsi, rdi
+  mov word ptr [rip+g1519], si
+  movsx rsi, word ptr [rip+g1510]
+  mov rax, rsi
+.L.return.u151:
+  ret
+.text
+.p2align 4
+.global u152
+u152:
+  movsxd rsi, dword ptr [rip+g2154]
+  movsx rdi, word ptr [rip+g4410]
+  add rsi, rdi
+  mov word ptr [rip+g1520], si
+  mov rsi, qword ptr [rip+g2922]
+  movsxd rdi, dword ptr [rip+g4436]
+  add rsi, rdi
+  mov qword ptr [rip+g1521], rsi
+  movsx rsi, byte ptr [rip+g307]
+  movsx rdi, word ptr [rip+g2896]
+  add rsi, rdi
+  mov word ptr [rip+g1522], si
+  movsx rsi, byte ptr [rip+g4476]
+  add rsi, qword ptr [rip+g4751]
+  mov word ptr [rip+g1523], si
+  movsx rsi, byte ptr [rip+g2075]
+  movsx rdi, word ptr [rip+g2202]
+  add rsi, rdi
+  mov word ptr [rip+g1524], si
+  movsx rsi, word ptr [rip+g165]
+  movsxd rdi, dword ptr [rip+g56]
+  add rsi, rdi
+  mov byte ptr [rip+g1525], sil
+  movsx rsi, word ptr [rip+g4344]
+  movsx rdi, word ptr [rip+g3925]
+  add rsi, rdi
+  mov dword ptr [rip+g1526], esi
+  movsx rsi, byte ptr [rip+g3968]
+  movsx rdi, byte ptr [rip+g3266]
+  add rsi, rdi
+  mov byte ptr [rip+g1527], sil
+  movsxd rsi, dword ptr [rip+g935]
+  movsxd rdi, dword ptr [rip+g3429]
+  add rsi, rdi
+  mov qword ptr [rip+g1528], rsi
+  movsxd rsi, dword ptr [rip+g2518]
+  movsx rdi, word ptr [rip+g2838]
+  add rsi, rdi
+  mov word ptr [rip+g1529], si
+  movsx rsi, word ptr [rip+g1520]
+  mov rax, rsi
+.L.return.u152:
+  ret
+.text
+.p2align 4
+.global u153
+u153:
+  movsxd rsi, dword ptr [rip+g2054]
+  movsxd rdi, dword ptr [rip+g1774]
+  add rsi, rdi
+  mov dword ptr [rip+g1530], esi
+  movsx rsi, word ptr [rip+g1069]
+  add rsi, qword ptr [rip+g1322]
+  mov qword ptr [rip+g1531], rsi
+  movsx rsi, byte ptr [rip+g2132]
+  movsxd rdi, dword ptr [rip+g2602]
+  add rsi, rdi
+  mov dword ptr [rip+g1532], esi
+  movsxd rsi, dword ptr [rip+g4887]
+  movsx rdi, byte ptr [rip+g4989]
+  add rsi, rdi
+  mov dword ptr [rip+g1533], esi
+  movsx rsi, word ptr [rip+g3198]
+  movsxd rdi, dword ptr [rip+g952]
+  add rsi, rdi
+  mov word ptr [rip+g1534], si
+  mov rsi, qword ptr [rip+g3682]
+  movsxd rdi, dword ptr [rip+g2724]
+  add rsi, rdi
+  mov qword ptr [rip+g1535], rsi
+  mov rsi, qword ptr [rip+g3959]
+  movsx rdi, word ptr [rip+g1925]
+  add rsi, rdi
+  mov dword ptr [rip+g1536], esi
+  movsxd rsi, dword ptr [rip+g3700]
+  movsx rdi, byte ptr [rip+g2192]
+  add rsi, rdi
+  mov qword ptr [rip+g1537], rsi
+  mov rsi, qword ptr [rip+g3787]
+  add rsi, qword ptr [rip+g980]
+  mov qword ptr [rip+g1538], rsi
+  movsxd rsi, dword ptr [rip+g83]
+  movsx rdi, byte ptr [rip+g12]
+  add rsi, rdi
+  mov byte ptr [rip+g1539], sil
+  movsxd rsi, dword ptr [rip+g1530]
+  mov rax, rsi
+.L.return.u153:
+  ret
+.text
+.p2align 4
+.global u154
+u154:
+  mov rsi, qword ptr [rip+g2784]
+  add rsi, qword ptr [rip+g310]
+  mov word ptr [rip+g1540], si
+  movsxd rsi, dword ptr [rip+g34]
+  movsx rdi, word ptr [rip+g558]
+  add rsi, rdi
+  mov dword ptr [rip+g1541], esi
+  mov rsi, qword ptr [rip+g4992]
+  add rsi, qword ptr [rip+g112]
+  mov word ptr [rip+g1542], si
+  movsxd rsi, dword ptr [rip+g2155]
+  movsxd rdi, dword ptr [rip+g2579]
+  add rsi, rdi
+  mov dword ptr [rip+g1543], esi
+  mov rsi, qword ptr [rip+g2528]
+  movsx rdi, byte ptr [rip+g4204]
+  add rsi, rdi
+  mov qword ptr [rip+g1544], rsi
+  movsx rsi, byte ptr [rip+g2556]
+  movsx rdi, word ptr [rip+g4342]
+  add rsi, rdi
+  mov byte ptr [rip+g1545], sil
+  mov rsi, qword ptr [rip+g1528]
+  add rsi, qword ptr [rip+g2591]
+  mov qword ptr [rip+g1546], rsi
+  movsxd rsi, dword ptr [rip+g1568]
+  movsxd rdi, dword ptr [rip+g2682]
+  add rsi, rdi
+  mov byte ptr [rip+g1547], sil
+  movsx rsi, byte ptr [rip+g2021]
+  movsx rdi, byte ptr [rip+g1027]
+  add rsi, rdi
+  mov byte ptr [rip+g1548], sil
+  mov rsi, qword ptr [rip+g2309]
+  movsxd rdi, dword ptr [rip+g740]
+  add rsi, rdi
+  mov qword ptr [rip+g1549], rsi
+  movsx rsi, word ptr [rip+g1540]
+  mov rax, rsi
+.L.return.u154:
+  ret
+.text
+.p2align 4
+.global u155
+u155:
+  mov rsi, qword ptr [rip+g2377]
+  movsx rdi, byte ptr [rip+g3145]
+  add rsi, rdi
+  mov qword ptr [rip+g1550], rsi
+  movsx rsi, word ptr [rip+g3991]
+  movsxd rdi, dword ptr [rip+g136]
+  add rsi, rdi
+  mov dword ptr [rip+g1551], esi
+  mov rsi, qword ptr [rip+g2522]
+  movsxd rdi, dword ptr [rip+g2415]
+  add rsi, rdi
+  mov dword ptr [rip+g1552], esi
+  movsxd rsi, dword ptr [rip+g4905]
+  add rsi, qword ptr [rip+g1678]
+  mov word ptr [rip+g1553], si
+  movsxd rsi, dword ptr [rip+g4468]
+  movsx rdi, word ptr [rip+g800]
+  add rsi, rdi
+  mov qword ptr [rip+g1554], rsi
+  movsx rsi, word ptr [rip+g2140]
+  movsx rdi, byte ptr [rip+g1412]
+  add rsi, rdi
+  mov byte ptr [rip+g1555], sil
+  movsx rsi, word ptr [rip+g197]
+  add rsi, qword ptr [rip+g2456]
+  mov dword ptr [rip+g1556], esi
+  movsx rsi, byte ptr [rip+g3146]
+  add rsi, qword ptr [rip+g1734]
+  mov dword ptr [rip+g1557], esi
+  mov rsi, qword ptr [rip+g920]
+  movsx rdi, byte ptr [rip+g263]
+  add rsi, rdi
+  mov word ptr [rip+g1558], si
+  movsx rsi, word ptr [rip+g467]
+  movsx rdi, byte ptr [rip+g1962]
+  add rsi, rdi
+  mov byte ptr [rip+g1559], sil
+  mov rax, qword ptr [rip+g1550]
+.L.return.u155:
+  ret
+.text
+.p2align 4
+.global u156
+u156:
+  mov rsi, qword ptr [rip+g3486]
+  movsxd rdi, dword ptr [rip+g4165]
+  add rsi, rdi
+  mov dword ptr [rip+g1560], esi
+  movsx rsi, word ptr [rip+g4658]
+  add rsi, qword ptr [rip+g4054]
+  mov byte ptr [rip+g1561], sil
+  movsx rsi, byte ptr [rip+g3126]
+  add rsi, qword ptr [rip+g3135]
+  mov word ptr [rip+g1562], si
+  movsx rsi, word ptr [rip+g3279]
+  movsx rdi, byte ptr [rip+g3929]
+  add rsi, rdi
+  mov byte ptr [rip+g1563], sil
+  movsx rsi, word ptr [rip+g1290]
+  movsxd rdi, dword ptr [rip+g4006]
+  add rsi, rdi
+  mov dword ptr [rip+g1564], esi
+  movsx rsi, byte ptr [rip+g4986]
+  movsx rdi, word ptr [rip+g2584]
+  add rsi, rdi
+  mov qword ptr [rip+g1565], rsi
+  mov rsi, qword ptr [rip+g4483]
+  movsxd rdi, dword ptr [rip+g2691]
+  add rsi, rdi
+  mov qword ptr [rip+g1566], rsi
+  movsxd rsi, dword ptr [rip+g2600]
+  movsx rdi, word ptr [rip+g730]
+  add rsi, rdi
+  mov qword ptr [rip+g1567], rsi
+  movsxd rsi, dword ptr [rip+g419]
+  add rsi, qword ptr [rip+g4801]
+  mov dword ptr [rip+g1568], esi
+  movsxd rsi, dword ptr [rip+g2769]
+  add rsi, qword ptr [rip+g526]
+  mov byte ptr [rip+g1569], sil
+  movsxd rsi, dword ptr [rip+g1560]
+  mov rax, rsi
+.L.return.u156:
+  ret
+.text
+.p2align 4
+.global u157
+u157:
+  movsx rsi, byte ptr [rip+g3604]
+  movsxd rdi, dword ptr [rip+g3134]
+  add rsi, rdi
+  mov word ptr [rip+g1570], si
+  movsx rsi, byte ptr [rip+g972]
+  movsx rdi, word ptr [rip+g4755]
+  add rsi, rdi
+  mov dword ptr [rip+g1571], esi
+  movsx rsi, byte ptr [rip+g2804]
+  movsxd rdi, dword ptr [rip+g275]
+  add rsi, rdi
+  mov qword ptr [rip+g1572], rsi
+  mov rsi, qword ptr [rip+g4957]
+  movsxd rdi, dword ptr [rip+g3197]
+  add rsi, rdi
+  mov word ptr [rip+g1573], si
+  movsx rsi, byte ptr [rip+g1836]
+  movsxd rdi, dword ptr [rip+g2853]
+  add rsi, rdi
+  mov dword ptr [rip+g1574], esi
+  movsxd rsi, dword ptr [rip+g4931]
+  add rsi, qword ptr [rip+g4504]
+  mov qword ptr [rip+g1575], rsi
+  movsx rsi, byte ptr [rip+g2132]
+  movsx rdi, byte ptr [rip+g1671]
+  add rsi, rdi
+  mov word ptr [rip+g1576], si
+  movsxd rsi, dword ptr [rip+g1343]
+  movsx rdi, byte ptr [rip+g1633]
+  add rsi, rdi
+  mov qword ptr [rip+g1577], rsi
+  movsxd rsi, dword ptr [rip+g1138]
+  movsx rdi, byte ptr [rip+g573]
+  add rsi, rdi
+  mov word ptr [rip+g1578], si
+  movsx rsi, byte ptr [rip+g2978]
+  movsx rdi, word ptr [rip+g1875]
+  add rsi, rdi
+  mov word ptr [rip+g1579], si
+  movsx rsi, word ptr [rip+g1570]
+  mov rax, rsi
+.L.return.u157:
+  ret
+.text
+.p2align 4
+.global u158
+u158:
+  mov rsi, qword ptr [rip+g2937]
+  movsxd rdi, dword ptr [rip+g4664]
+  add rsi, rdi
+  mov word ptr [rip+g1580], si
+  movsxd rsi, dword ptr [rip+g2022]
+  add rsi, qword ptr [rip+g3654]
+  mov dword ptr [rip+g1581], esi
+  movsx rsi, word ptr [rip+g1900]
+  movsx rdi, word ptr [rip+g3198]
+  add rsi, rdi
+  mov word ptr [rip+g1582], si
+  movsxd rsi, dword ptr [rip+g2469]
+  movsxd rdi, dword ptr [rip+g4280]
+  add rsi, rdi
+  mov qword ptr [rip+g1583], rsi
+  movsx rsi, byte ptr [rip+g3736]
+  add rsi, qword ptr [rip+g48]
+  mov word ptr [rip+g1584], si
+  movsx rsi, byte ptr [rip+g3236]
+  movsx rdi, word ptr [rip+g1466]
+  add rsi, rdi
+  mov dword ptr [rip+g1585], esi
+  movsxd rsi, dword ptr [rip+g4077]
+  movsx rdi, byte ptr [rip+g3709]
+  add rsi, rdi
+  mov dword ptr [rip+g1586], esi
+  movsx rsi, word ptr [rip+g768]
+  add rsi, qword ptr [rip+g1544]
+  mov word ptr [rip+g1587], si
+  movsxd rsi, dword ptr [rip+g1744]
+  movsx rdi, word ptr [rip+g24]
+  add rsi, rdi
+  mov dword ptr [rip+g1588], esi
+  movsxd rsi, dword ptr [rip+g2122]
+  movsx rdi, byte ptr [rip+g366]
+  add rsi, rdi
+  mov word ptr [rip+g1589], si
+  movsx rsi, word ptr [rip+g1580]
+  mov rax, rsi
+.L.return.u158:
+  ret
+.text
+.p2align 4
+.global u159
+u159:
+  mov rsi, qword ptr [rip+g793]
+  movsx rdi, byte ptr [rip+g4199]
+  add rsi, rdi
+  mov dword ptr [rip+g1590], esi
+  mov rsi, qword ptr [rip+g1498]
+  movsx rdi, byte ptr [rip+g4804]
+  add rsi, rdi
+  mov byte ptr [rip+g1591], sil
+  movsx rsi, byte ptr [rip+g722]
+  movsx rdi, byte ptr [rip+g2445]
+  add rsi, rdi
+  mov byte ptr [rip+g1592], sil
+  movsx rsi, word ptr [rip+g3303]
+  add rsi, qword ptr [rip+g3462]
+  mov byte ptr [rip+g1593], sil
+  movsx rsi, byte ptr [rip+g1897]
+  movsx rdi, byte ptr [rip+g978]
+  add rsi, rdi
+  mov byte ptr [rip+g1594], sil
+  movsx rsi, byte ptr [rip+g4153]
+  movsx rdi, word ptr [rip+g4824]
+  add rsi, rdi
+  mov byte ptr [rip+g1595], sil
+  movsx rsi, word ptr [rip+g1966]
+  movsx rdi, word ptr [rip+g311]
+  add rsi, rdi
+  mov qword ptr [rip+g1596], rsi
+  mov rsi, qword ptr [rip+g3456]
+  movsx rdi, word ptr [rip+g1]
+  add rsi, rdi
+  mov qword ptr [rip+g1597], rsi
+  movsxd rsi, dword ptr [rip+g1264]
+  add rsi, qword ptr [rip+g1597]
+  mov dword ptr [rip+g1598], esi
+  movsx rsi, byte ptr [rip+g2299]
+  movsxd rdi, dword ptr [rip+g3421]
+  add rsi, rdi
+  mov qword ptr [rip+g1599], rsi
+  movsxd rsi, dword ptr [rip+g1590]
+  mov rax, rsi
+.L.return.u159:
+  ret
+.text
+.p2align 4
+.global u160
+u160:
+  movsx rsi, byte ptr [rip+g3952]
+  add rsi, qword ptr [rip+g1680]
+  mov dword ptr [rip+g1600], esi
+  movsx rsi, word ptr [rip+g1576]
+  movsx rdi, byte ptr [rip+g1916]
+  add rsi, rdi
+  mov word ptr [rip+g1601], si
+  mov rsi, qword ptr [rip+g3275]
+  movsx rdi, word ptr [rip+g1899]
+  add rsi, rdi
+  mov byte ptr [rip+g1602], sil
+  movsx rsi, word ptr [rip+g2988]
+  movsx rdi, byte ptr [rip+g1607]
+  add rsi, rdi
+  mov dword ptr [rip+g1603], esi
+  movsx rsi, word ptr [rip+g3074]
+  add rsi, qword ptr [rip+g3937]
+  mov qword ptr [rip+g1604], rsi
+  mov rsi, qword ptr [rip+g2993]
+  movsxd rdi, dword ptr [rip+g587]
+  add rsi, rdi
+  mov byte ptr [rip+g1605], sil
+  movsx rsi, byte ptr [rip+g3516]
+  movsxd rdi, dword ptr [rip+g204]
+  add rsi, rdi
+  mov byte ptr [rip+g1606], sil
+  movsxd rsi, dword ptr [rip+g234]
+  movsx rdi, byte ptr [rip+g1037]
+  add rsi, rdi
+  mov byte ptr [rip+g1607], sil
+  movsx rsi, byte ptr [rip+g3185]
+  movsx rdi, word ptr [rip+g503]
+  add rsi, rdi
+  mov word ptr [rip+g1608], si
+  movsx rsi, word ptr [rip+g687]
+  movsxd rdi, dword ptr [rip+g4134]
+  add rsi, rdi
+  mov word ptr [rip+g1609], si
+  movsxd rsi, dword ptr [rip+g1600]
+  mov rax, rsi
+.L.return.u160:
+  ret
+.text
+.p2align 4
+.global u161
+u161:
+  movsx rsi, byte ptr [rip+g760]
+  movsx rdi, word ptr [rip+g1350]
+  add rsi, rdi
+  mov qword ptr [rip+g1610], rsi
+  mov rsi, qword ptr [rip+g297]
+  movsx rdi, word ptr [rip+g1278]
+  add rsi, rdi
+  mov word ptr [rip+g1611], si
+  movsx rsi, byte ptr [rip+g1750]
+  add rsi, qword ptr [rip+g3350]
+  mov qword ptr [rip+g1612], rsi
+  movsx rsi, word ptr [rip+g4331]
+  movsxd rdi, dword ptr [rip+g3667]
+  add rsi, rdi
+  mov qword ptr [rip+g1613], rsi
+  movsx rsi, byte ptr [rip+g2293]
+  movsxd rdi, dword ptr [rip+g1939]
+  add rsi, rdi
+  mov byte ptr [rip+g1614], sil
+  mov rsi, qword ptr [rip+g528]
+  movsx rdi, word ptr [rip+g3011]
+  add rsi, rdi
+  mov qword ptr [rip+g1615], rsi
+  movsx rsi, byte ptr [rip+g4993]
+  movsx rdi, word ptr [rip+g4452]
+  add rsi, rdi
+  mov dword ptr [rip+g1616], esi
+  mov rsi, qword ptr [rip+g1537]
+  movsx rdi, word ptr [rip+g1253]
+  add rsi, rdi
+  mov byte ptr [rip+g1617], sil
+  mov rsi, qword ptr [rip+g4138]
+  movsx rdi, byte ptr [rip+g1251]
+  add rsi, rdi
+  mov word ptr [rip+g1618], si
+  mov rsi, qword ptr [rip+g3098]
+  movsxd rdi, dword ptr [rip+g4279]
+  add rsi, rdi
+  mov qword ptr [rip+g1619], rsi
+  mov rax, qword ptr [rip+g1610]
+.L.return.u161:
+  ret
+.text
+.p2align 4
+.global u162
+u162:
+  mov rsi, qword ptr [rip+g3328]
+  movsx rdi, byte ptr [rip+g3181]
+  add rsi, rdi
+  mov byte ptr [rip+g1620], sil
+  movsx rsi, word ptr [rip+g889]
+  movsxd rdi, dword ptr [rip+g4876]
+  add rsi, rdi
+  mov qword ptr [rip+g1621], rsi
+  movsx rsi, byte ptr [rip+g4493]
+  movsx rdi, word ptr [rip+g3767]
+  add rsi, rdi
+  mov word ptr [rip+g1622], si
+  mov rsi, qword ptr [rip+g2018]
+  movsx rdi, byte ptr [rip+g4655]
+  add rsi, rdi
+  mov word ptr [rip+g1623], si
+  movsxd rsi, dword ptr [rip+g2269]
+  movsx rdi, word ptr [rip+g492]
+  add rsi, rdi
+  mov dword ptr [rip+g1624], esi
+  movsx rsi, byte ptr [rip+g3610]
+  add rsi, qword ptr [rip+g3748]
+  mov qword ptr [rip+g1625], rsi
+  movsxd rsi, dword ptr [rip+g1343]
+  movsx rdi, word ptr [rip+g1466]
+  add rsi, rdi
+  mov word ptr [rip+g1626], si
+  mov rsi, qword ptr [rip+g1362]
+  movsxd rdi, dword ptr [rip+g3558]
+  add rsi, rdi
+  mov dword ptr [rip+g1627], esi
+  mov rsi, qword ptr [rip+g4511]
+  movsx rdi, word ptr [rip+g4980]
+  add rsi, rdi
+  mov dword ptr [rip+g1628], esi
+  mov rsi, qword ptr [rip+g4615]
+  movsx rdi, word ptr [rip+g3030]
+  add rsi, rdi
+  mov word ptr [rip+g1629], si
+  movsx rsi, byte ptr [rip+g1620]
+  mov rax, rsi
+.L.return.u162:
+  ret
+.text
+.p2align 4
+.global u163
+u163:
+  movsx rsi, word ptr [rip+g3896]
+  movsx rdi, word ptr [rip+g1153]
+  add rsi, rdi
+  mov byte ptr [rip+g1630], sil
+  movsx rsi, byte ptr [rip+g1559]
+  add rsi, qword ptr [rip+g3941]
+  mov qword ptr [rip+g1631], rsi
+  movsxd rsi, dword ptr [rip+g3526]
+  add rsi, qword ptr [rip+g811]
+  mov dword ptr [rip+g1632], esi
+  movsxd rsi, dword ptr [rip+g2240]
+  movsx rdi, word ptr [rip+g2156]
+  add rsi, rdi
+  mov byte ptr [rip+g1633], sil
+  movsx rsi, word ptr [rip+g486]
+  movsx rdi, byte ptr [rip+g4570]
+  add rsi, rdi
+  mov qword ptr [rip+g1634], rsi
+  mov rsi, qword ptr [rip+g1604]
+  add rsi, qword ptr [rip+g3473]
+  mov byte ptr [rip+g1635], sil
+  movsx rsi, word ptr [rip+g738]
+  add rsi, qword ptr [rip+g4520]
+  mov dword ptr [rip+g1636], esi
+  movsx rsi, word ptr [rip+g4379]
+  add rsi, qword ptr [rip+g4739]
+  mov byte ptr [rip+g1637], sil
+  mov rsi, qword ptr [rip+g3021]
+  movsx rdi, byte ptr [rip+g3252]
+  add rsi, rdi
+  mov word ptr [rip+g1638], si
+  movsx rsi, byte ptr [rip+g227]
+  movsxd rdi, dword ptr [rip+g1842]
+  add rsi, rdi
+  mov word ptr [rip+g1639], si
+  movsx rsi, byte ptr [rip+g1630]
+  mov rax, rsi
+.L.return.u163:
+  ret
+.text
+.p2align 4
+.global u164
+u164:
+  movsx rsi, word ptr [rip+g584]
+  movsxd rdi, dword ptr [rip+g2535]
+  add rsi, rdi
+  mov byte ptr [rip+g1640], sil
+  movsx rsi, word ptr [rip+g1622]
+  add rsi, qword ptr [rip+g2453]
+  mov word ptr [rip+g1641], si
+  movsxd rsi, dword ptr [rip+g4029]
+  movsx rdi, word ptr [rip+g2950]
+  add rsi, rdi
+  mov word ptr [rip+g1642], si
+  movsxd rsi, dword ptr [rip+g3899]
+  add rsi, qword ptr [rip+g1234]
+  mov dword ptr [rip+g1643], esi
+  movsx rsi, word ptr [rip+g4799]
+  add rsi, qword ptr [rip+g3486]
+  mov dword ptr [rip+g1644], esi
+  mov rsi, qword ptr [rip+g1300]
+  movsx rdi, word ptr [rip+g4205]
+  add rsi, rdi
+  mov word ptr [rip+g1645], si
+  movsx rsi, byte ptr [rip+g2438]
+  movsx rdi, byte ptr [rip+g747]
+  add rsi, rdi
+  mov qword ptr [rip+g1646], rsi
+  movsx rsi, byte ptr [rip+g4167]
+  movsxd rdi, dword ptr [rip+g513]
+  add rsi, rdi
+  mov word ptr [rip+g1647], si
+  movsxd rsi, dword ptr [rip+g3040]
+  movsx rdi, word ptr [rip+g2371]
+  add rsi, rdi
+  mov qword ptr [rip+g1648], rsi
+  movsx rsi, word ptr [rip+g2375]
+  movsx rdi, byte ptr [rip+g88]
+  add rsi, rdi
+  mov dword ptr [rip+g1649], esi
+  movsx rsi, byte ptr [rip+g1640]
+  mov rax, rsi
+.L.return.u164:
+  ret
+.text
+.p2align 4
+.global u165
+u165:
+  movsx rsi, byte ptr [rip+g3368]
+  add rsi, qword ptr [rip+g4837]
+  mov word ptr [rip+g1650], si
+  mov rsi, qword ptr [rip+g778]
+  movsx rdi, byte ptr [rip+g4738]
+  add rsi, rdi
+  mov byte ptr [rip+g1651], sil
+  movsx rsi, byte ptr [rip+g3502]
+  movsx rdi, word ptr [rip+g3387]
+  add rsi, rdi
+  mov dword ptr [rip+g1652], esi
+  movsx rsi, byte ptr [rip+g3069]
+  movsxd rdi, dword ptr [rip+g1586]
+  add rsi, rdi
+  mov qword ptr [rip+g1653], rsi
+  movsxd rsi, dword ptr [rip+g3210]
+  movsx rdi, word ptr [rip+g2121]
+  add rsi, rdi
+  mov dword ptr [rip+g1654], esi
+  mov rsi, qword ptr [rip+g1296]
+  movsx rdi, word ptr [rip+g268]
+  add rsi, rdi
+  mov word ptr [rip+g1655], si
+  movsx rsi, byte ptr [rip+g1464]
+  movsx rdi, byte ptr [rip+g3725]
+  add rsi, rdi
+  mov byte ptr [rip+g1656], sil
+  movsx rsi, word ptr [rip+g1553]
+  movsx rdi, byte ptr [rip+g3826]
+  add rsi, rdi
+  mov qword ptr [rip+g1657], rsi
+  mov rsi, qword ptr [rip+g442]
+  movsx rdi, byte ptr [rip+g2476]
+  add rsi, rdi
+  mov dword ptr [rip+g1658], esi
+  mov rsi, qword ptr [rip+g2105]
+  add rsi, qword ptr [rip+g853]
+  mov word ptr [rip+g1659], si
+  movsx rsi, word ptr [rip+g1650]
+  mov rax, rsi
+.L.return.u165:
+  ret
+.text
+.p2align 4
+.global u166
+u166:
+  movsx rsi, word ptr [rip+g4960]
+  add rsi, qword ptr [rip+g4288]
+  mov word ptr [rip+g1660], si
+  movsxd rsi, dword ptr [rip+g3587]
+  movsx rdi, word ptr [rip+g2277]
+  add rsi, rdi
+  mov byte ptr [rip+g1661], sil
+  mov rsi, qword ptr [rip+g4888]
+  movsx rdi, word ptr [rip+g4205]
+  add rsi, rdi
+  mov byte ptr [rip+g1662], sil
+  movsx rsi, word ptr [rip+g3815]
+  movsxd rdi, dword ptr [rip+g3505]
+  add rsi, rdi
+  mov dword ptr [rip+g1663], esi
+  movsx rsi, byte ptr [rip+g2987]
+  movsx rdi, word ptr [rip+g150]
+  add rsi, rdi
+  mov byte ptr [rip+g1664], sil
+  mov rsi, qword ptr [rip+g1263]
+  movsx rdi, word ptr [rip+g4823]
+  add rsi, rdi
+  mov dword ptr [rip+g1665], esi
+  movsxd rsi, dword ptr [rip+g452]
+  movsx rdi, byte ptr [rip+g3380]
+  add rsi, rdi
+  mov dword ptr [rip+g1666], esi
+  movsx rsi, byte ptr [rip+g3744]
+  movsx rdi, word ptr [rip+g1699]
+  add rsi, rdi
+  mov byte ptr [rip+g1667], sil
+  movsxd rsi, dword ptr [rip+g805]
+  movsxd rdi, dword ptr [rip+g4186]
+  add rsi, rdi
+  mov byte ptr [rip+g1668], sil
+  movsx rsi, word ptr [rip+g1334]
+  add rsi, qword ptr [rip+g4457]
+  mov dword ptr [rip+g1669], esi
+  movsx rsi, word ptr [rip+g1660]
+  mov rax, rsi
+.L.return.u166:
+  ret
+.text
+.p2align 4
+.global u167
+u167:
+  mov rsi, qword ptr [rip+g2335]
+  movsxd rdi, dword ptr [rip+g2439]
+  add rsi, rdi
+  mov byte ptr [rip+g1670], sil
+  movsx rsi, word ptr [rip+g4178]
+  movsx rdi, byte ptr [rip+g4832]
+  add rsi, rdi
+  mov byte ptr [rip+g1671], sil
+  movsxd rsi, dword ptr [rip+g3418]
+  movsxd rdi, dword ptr [rip+g2196]
+  add rsi, rdi
+  mov dword ptr [rip+g1672], esi
+  movsx rsi, word ptr [rip+g4039]
+  movsx rdi, word ptr [rip+g4043]
+  add rsi, rdi
+  mov qword ptr [rip+g1673], rsi
+  mov rsi, qword ptr [rip+g1416]
+  movsx rdi, word ptr [rip+g4234]
+  add rsi, rdi
+  mov dword ptr [rip+g1674], esi
+  movsx rsi, word ptr [rip+g1257]
+  movsx rdi, word ptr [rip+g145]
+  add rsi, rdi
+  mov qword ptr [rip+g1675], rsi
+  mov rsi, qword ptr [rip+g3680]
+  movsxd rdi, dword ptr [rip+g3221]
+  add rsi, rdi
+  mov qword ptr [rip+g1676], rsi
+  movsxd rsi, dword ptr [rip+g3618]
+  add rsi, qword ptr [rip+g4190]
+  mov qword ptr [rip+g1677], rsi
+  movsxd rsi, dword ptr [rip+g4907]
+  movsxd rdi, dword ptr [rip+g3336]
+  add rsi, rdi
+  mov qword ptr [rip+g1678], rsi
+  mov rsi, qword ptr [rip+g3338]
+  movsxd rdi, dword ptr [rip+g4185]
+  add rsi, rdi
+  mov dword ptr [rip+g1679], esi
+  movsx rsi, byte ptr [rip+g1670]
+  mov rax, rsi
+.L.return.u167:
+  ret
+.text
+.p2align 4
+.global u168
+u168:
+  movsx rsi, word ptr [rip+g2625]
+  movsx rdi, word ptr [rip+g1730]
+  add rsi, rdi
+  mov qword ptr [rip+g1680], rsi
+  mov rsi, qword ptr [rip+g2718]
+  add rsi, qword ptr [rip+g672]
+  mov word ptr [rip+g1681], si
+  mov rsi, qword ptr [rip+g817]
+  movsxd rdi, dword ptr [rip+g184]
+  add rsi, rdi
+  mov dword ptr [rip+g1682], esi
+  movsxd rsi, dword ptr [rip+g1105]
+  movsx rdi, word ptr [rip+g3186]
+  add rsi, rdi
+  mov qword ptr [rip+g1683], rsi
+  movsx rsi, byte ptr [rip+g992]
+  movsx rdi, byte ptr [rip+g2835]
+  add rsi, rdi
+  mov word ptr [rip+g1684], si
+  movsx rsi, word ptr [rip+g1004]
+  movsx rdi, word ptr [rip+g4765]
+  add rsi, rdi
+  mov dword ptr [rip+g1685], esi
+  movsx rsi, byte ptr [rip+g3620]
+  movsx rdi, byte ptr [rip+g2631]
+  add rsi, rdi
+  mov byte ptr [rip+g1686], sil
+  movsxd rsi, dword ptr [rip+g1831]
+  movsxd rdi, dword ptr [rip+g1284]
+  add rsi, rdi
+  mov qword ptr [rip+g1687], rsi
+  movsxd rsi, dword ptr [rip+g3171]
+  movsx rdi, word ptr [rip+g1490]
+  add rsi, rdi
+  mov dword ptr [rip+g1688], esi
+  mov rsi, qword ptr [rip+g2453]
+  movsx rdi, byte ptr [rip+g1209]
+  add rsi, rdi
+  mov word ptr [rip+g1689], si
+  mov rax, qword ptr [rip+g1680]
+.L.return.u168:
+  ret
+.text
+.p2align 4
+.global u169
+u169:
+  movsx rsi, word ptr [rip+g1829]
+  add rsi, qword ptr [rip+g1984]
+  mov word ptr [rip+g1690], si
+  mov rsi, qword ptr [rip+g3473]
+  movsx rdi, word ptr [rip+g537]
+  add rsi, rdi
+  mov dword ptr [rip+g1691], esi
+  movsx rsi, byte ptr [rip+g2576]
+  add rsi, qword ptr [rip+g4089]
+  mov dword ptr [rip+g1692], esi
+  mov rsi, qword ptr [rip+g3845]
+  add rsi, qword ptr [rip+g228]
+  mov qword ptr [rip+g1693], rsi
+  movsxd rsi, dword ptr [rip+g4253]
+  add rsi, qword ptr [rip+g1364]
+  mov byte ptr [rip+g1694], sil
+  movsx rsi, byte ptr [rip+g685]
+  movsx rdi, byte ptr [rip+g1340]
+  add rsi, rdi
+  mov dword ptr [rip+g1695], esi
+  movsxd rsi, dword ptr [rip+g2624]
+  movsx rdi, word ptr [rip+g2554]
+  add rsi, rdi
+  mov qword ptr [rip+g1696], rsi
+  movsx rsi, byte ptr [rip+g4487]
+  movsx rdi, word ptr [rip+g3509]
+  add rsi, rdi
+  mov qword ptr [rip+g1697], rsi
+  movsx rsi, byte ptr [rip+g1157]
+  movsxd rdi, dword ptr [rip+g9]
+  add rsi, rdi
+  mov qword ptr [rip+g1698], rsi
+  movsx rsi, word ptr [rip+g3646]
+  movsx rdi, byte ptr [rip+g3116]
+  add rsi, rdi
+  mov word ptr [rip+g1699], si
+  movsx rsi, word ptr [rip+g1690]
+  mov rax, rsi
+.L.return.u169:
+  ret
+.text
+.p2align 4
+.global u170
+u170:
+  mov rsi, qword ptr [rip+g709]
+  movsxd rdi, dword ptr [rip+g3332]
+  add rsi, rdi
+  mov dword ptr [rip+g1700], esi
+  movsx rsi, byte ptr [rip+g4247]
+  movsx rdi, byte ptr [rip+g1856]
+  add rsi, rdi
+  mov dword ptr [rip+g1701], esi
+  movsxd rsi, dword ptr [rip+g2360]
+  add rsi, qword ptr [rip+g3540]
+  mov word ptr [rip+g1702], si
+  movsx rsi, word ptr [rip+g3305]
+  movsx rdi, byte ptr [rip+g1156]
+  add rsi, rdi
+  mov qword ptr [rip+g1703], rsi
+  movsx rsi, byte ptr [rip+g1607]
+  movsx rdi, byte ptr [rip+g55]
+  add rsi, rdi
+  mov qword ptr [rip+g1704], rsi
+  mov rsi, qword ptr [rip+g998]
+  movsxd rdi, dword ptr [rip+g1049]
+  add rsi, rdi
+  mov dword ptr [rip+g1705], esi
+  movsx rsi, byte ptr [rip+g3921]
+  movsx rdi, word ptr [rip+g2858]
+  add rsi, rdi
+  mov qword ptr [rip+g1706], rsi
+  movsx rsi, word ptr [rip+g3960]
+  movsx rdi, word ptr [rip+g2774]
+  add rsi, rdi
+  mov byte ptr [rip+g1707], sil
+  movsxd rsi, dword ptr [rip+g3809]
+  add rsi, qword ptr [rip+g2146]
+  mov word ptr [rip+g1708], si
+  movsx rsi, byte ptr [rip+g2194]
+  add rsi, qword ptr [rip+g1721]
+  mov word ptr [rip+g1709], si
+  movsxd rsi, dword ptr [rip+g1700]
+  mov rax, rsi
+.L.return.u170:
+  ret
+.text
+.p2align 4
+.global u171
+u171:
+  movsxd rsi, dword ptr [rip+g4367]
+  movsx rdi, word ptr [rip+g3734]
+  add rsi, rdi
+  mov word ptr [rip+g1710], si
+  mov rsi, qword ptr [rip+g4404]
+  movsx rdi, word ptr [rip+g1808]
+  add rsi, rdi
+  mov byte ptr [rip+g1711], sil
+  movsx rsi, byte ptr [rip+g2975]
+  movsx rdi, byte ptr [rip+g1094]
+  add rsi, rdi
+  mov qword ptr [rip+g1712], rsi
+  mov rsi, qword ptr [rip+g2798]
+  movsxd rdi, dword ptr [rip+g1886]
+  add rsi, rdi
+  mov byte ptr [rip+g1713], sil
+  mov rsi, qword ptr [rip+g3588]
+  add rsi, qword ptr [rip+g2483]
+  mov dword ptr [rip+g1714], esi
+  movsxd rsi, dword ptr [rip+g3394]
+  add rsi, qword ptr [rip+g4212]
+  mov word ptr [rip+g1715], si
+  movsx rsi, word ptr [rip+g4125]
+  movsx rdi, word ptr [rip+g3688]
+  add rsi, rdi
+  mov dword ptr [rip+g1716], esi
+  movsx rsi, word ptr [rip+g4156]
+  add rsi, qword ptr [rip+g1232]
+  mov word ptr [rip+g1717], si
+  mov rsi, qword ptr [rip+g4580]
+  movsx rdi, byte ptr [rip+g3208]
+  add rsi, rdi
+  mov qword ptr [rip+g1718], rsi
+  movsxd rsi, dword ptr [rip+g2399]
+  movsx rdi, word ptr [rip+g3942]
+  add rsi, rdi
+  mov dword ptr [rip+g1719], esi
+  movsx rsi, word ptr [rip+g1710]
+  mov rax, rsi
+.L.return.u171:
+  ret
+.text
+.p2align 4
+.global u172
+u172:
+  movsx rsi, word ptr [rip+g1645]
+  movsx rdi, byte ptr [rip+g3461]
+  add rsi, rdi
+  mov byte ptr [rip+g1720], sil
+  movsxd rsi, dword ptr [rip+g3587]
+  add rsi, qword ptr [rip+g2786]
+  mov qword ptr [rip+g1721], rsi
+  movsx rsi, word ptr [rip+g844]
+  movsxd rdi, dword ptr [rip+g1571]
+  add rsi, rdi
+  mov word ptr [rip+g1722], si
+  movsx rsi, byte ptr [rip+g1136]
+  add rsi, qword ptr [rip+g4954]
+  mov qword ptr [rip+g1723], rsi
+  movsxd rsi, dword ptr [rip+g3776]
+  movsx rdi, byte ptr [rip+g4264]
+  add rsi, rdi
+  mov dword ptr [rip+g1724], esi
+  movsx rsi, word ptr [rip+g3633]
+  add rsi, qword ptr [rip+g1332]
+  mov dword ptr [rip+g1725], esi
+  movsx rsi, byte ptr [rip+g2490]
+  movsx rdi, byte ptr [rip+g2088]
+  add rsi, rdi
+  mov qword ptr [rip+g1726], rsi
+  movsx rsi, word ptr [rip+g1608]
+  movsx rdi, word ptr [rip+g1369]
+  add rsi, rdi
+  mov word ptr [rip+g1727], si
+  movsx rsi, word ptr [rip+g4131]
+  movsx rdi, word ptr [rip+g1200]
+  add rsi, rdi
+  mov byte ptr [rip+g1728], sil
+  movsx rsi, byte ptr [rip+g1048]
+  movsxd rdi, dword ptr [rip+g1600]
+  add rsi, rdi
+  mov dword ptr [rip+g1729], esi
+  movsx rsi, byte ptr [rip+g1720]
+  mov rax, rsi
+.L.return.u172:
+  ret
+.text
+.p2align 4
+.global u173
+u173:
+  movsx rsi, byte ptr [rip+g2538]
+  movsx rdi, word ptr [rip+g926]
+  add rsi, rdi
+  mov word ptr [rip+g1730], si
+  movsxd rsi, dword ptr [rip+g1600]
+  add rsi, qword ptr [rip+g3711]
+  mov dword ptr [rip+g1731], esi
+  movsxd rsi, dword ptr [rip+g3151]
+  movsxd rdi, dword ptr [rip+g1456]
+  add rsi, rdi
+  mov word ptr [rip+g1732], si
+  movsx rsi, word ptr [rip+g4370]
+  add rsi, qword ptr [rip+g1572]
+  mov byte ptr [rip+g1733], sil
+  movsx rsi, word ptr [rip+g2359]
+  movsx rdi, word ptr [rip+g161]
+  add rsi, rdi
+  mov qword ptr [rip+g1734], rsi
+  mov rsi, qword ptr [rip+g3962]
+  movsxd rdi, dword ptr [rip+g2634]
+  add rsi, rdi
+  mov qword ptr [rip+g1735], rsi
+  movsx rsi, byte ptr [rip+g4854]
+  movsx rdi, word ptr [rip+g3698]
+  add rsi, rdi
+  mov dword ptr [rip+g1736], esi
+  movsx rsi, byte ptr [rip+g1766]
+  add rsi, qword ptr [rip+g3435]
+  mov dword ptr [rip+g1737], esi
+  movsx rsi, byte ptr [rip+g2705]
+  movsx rdi, byte ptr [rip+g3604]
+  add rsi, rdi
+  mov word ptr [rip+g1738], si
+  movsx rsi, byte ptr [rip+g1246]
+  movsx rdi, byte ptr [rip+g685]
+  add rsi, rdi
+  mov byte ptr [rip+g1739], sil
+  movsx rsi, word ptr [rip+g1730]
+  mov rax, rsi
+.L.return.u173:
+  ret
+.text
+.p2align 4
+.global u174
+u174:
+  mov rsi, qword ptr [rip+g253]
+  movsx rdi, byte ptr [rip+g679]
+  add rsi, rdi
+  mov dword ptr [rip+g1740], esi
+  movsxd rsi, dword ptr [rip+g3042]
+  movsx rdi, word ptr [rip+g682]
+  add rsi, rdi
+  mov word ptr [rip+g1741], si
+  mov rsi, qword ptr [rip+g684]
+  movsxd rdi, dword ptr [rip+g1842]
+  add rsi, rdi
+  mov byte ptr [rip+g1742], sil
+  movsx rsi, byte ptr [rip+g3384]
+  movsx rdi, byte ptr [rip+g26]
+  add rsi, rdi
+  mov qword ptr [rip+g1743], rsi
+  mov rsi, qword ptr [rip+g1596]
+  movsxd rdi, dword ptr [rip+g1773]
+  add rsi, rdi
+  mov dword ptr [rip+g1744], esi
+  movsx rsi, byte ptr [rip+g4857]
+  movsx rdi, byte ptr [rip+g1614]
+  add rsi, rdi
+  mov qword ptr [rip+g1745], rsi
+  movsx rsi, word ptr [rip+g4388]
+  movsx rdi, byte ptr [rip+g3483]
+  add rsi, rdi
+  mov dword ptr [rip+g1746], esi
+  movsx rsi, byte ptr [rip+g797]
+  movsx rdi, word ptr [rip+g100]
+  add rsi, rdi
+  mov qword ptr [rip+g1747], rsi
+  mov rsi, qword ptr [rip+g2552]
+  movsx rdi, word ptr [rip+g3160]
+  add rsi, rdi
+  mov word ptr [rip+g1748], si
+  movsx rsi, word ptr [rip+g989]
+  add rsi, qword ptr [rip+g1024]
+  mov qword ptr [rip+g1749], rsi
+  movsxd rsi, dword ptr [rip+g1740]
+  mov rax, rsi
+.L.return.u174:
+  ret
+.text
+.p2align 4
+.global u175
+u175:
+  movsx rsi, byte ptr [rip+g1330]
+  movsx rdi, byte ptr [rip+g4264]
+  add rsi, rdi
+  mov byte ptr [rip+g1750], sil
+  movsx rsi, byte ptr [rip+g121]
+  movsx rdi, word ptr [rip+g215]
+  add rsi, rdi
+  mov dword ptr [rip+g1751], esi
+  mov rsi, qword ptr [rip+g1143]
+  movsxd rdi, dword ptr [rip+g4688]
+  add rsi, rdi
+  mov dword ptr [rip+g1752], esi
+  mov rsi, qword ptr [rip+g1269]
+  movsxd rdi, dword ptr [rip+g3853]
+  add rsi, rdi
+  mov byte ptr [rip+g1753], sil
+  movsxd rsi, dword ptr [rip+g1902]
+  movsx rdi, word ptr [rip+g4711]
+  add rsi, rdi
+  mov byte ptr [rip+g1754], sil
+  movsx rsi, word ptr [rip+g2989]
+  movsxd rdi, dword ptr [rip+g3197]
+  add rsi, rdi
+  mov byte ptr [rip+g1755], sil
+  movsxd rsi, dword ptr [rip+g1574]
+  add rsi, qword ptr [rip+g2248]
+  mov byte ptr [rip+g1756], sil
+  movsx rsi, byte ptr [rip+g1841]
+  movsx rdi, byte ptr [rip+g4530]
+  add rsi, rdi
+  mov word ptr [rip+g1757], si
+  movsx rsi, byte ptr [rip+g391]
+  movsx rdi, word ptr [rip+g2486]
+  add rsi, rdi
+  mov byte ptr [rip+g1758], sil
+  movsxd rsi, dword ptr [rip+g550]
+  movsx rdi, byte ptr [rip+g4705]
+  add rsi, rdi
+  mov dword ptr [rip+g1759], esi
+  movsx rsi, byte ptr [rip+g1750]
+  mov rax, rsi
+.L.return.u175:
+  ret
+.text
+.p2align 4
+.global u176
+u176:
+  mov rsi, qword ptr [rip+g2403]
+  add rsi, qword ptr [rip+g4351]
+  mov qword ptr [rip+g1760], rsi
+  movsxd rsi, dword ptr [rip+g2931]
+  movsx rdi, word ptr [rip+g4025]
+  add rsi, rdi
+  mov byte ptr [rip+g1761], sil
+  mov rsi, qword ptr [rip+g3585]
+  movsxd rdi, dword ptr [rip+g1636]
+  add rsi, rdi
+  mov byte ptr [rip+g1762], sil
+  movsx rsi, word ptr [rip+g1641]
+  add rsi, qword ptr [rip+g2465]
+  mov byte ptr [rip+g1763], sil
+  movsxd rsi, dword ptr [rip+g4917]
+  movsx rdi, word ptr [rip+g922]
+  add rsi, rdi
+  mov word ptr [rip+g1764], si
+  movsx rsi, word ptr [rip+g2742]
+  movsxd rdi, dword ptr [rip+g3193]
+  add rsi, rdi
+  mov dword ptr [rip+g1765], esi
+  mov rsi, qword ptr [rip+g4524]
+  movsx rdi, byte ptr [rip+g2193]
+  add rsi, rdi
+  mov byte ptr [rip+g1766], sil
+  mov rsi, qword ptr [rip+g2522]
+  add rsi, qword ptr [rip+g4212]
+  mov qword ptr [rip+g1767], rsi
+  movsx rsi, word ptr [rip+g4423]
+  movsx rdi, word ptr [rip+g2846]
+  add rsi, rdi
+  mov dword ptr [rip+g1768], esi
+  movsxd rsi, dword ptr [rip+g4220]
+  movsx rdi, word ptr [rip+g2547]
+  add rsi, rdi
+  mov word ptr [rip+g1769], si
+  mov rax, qword ptr [rip+g1760]
+.L.return.u176:
+  ret
+.text
+.p2align 4
+.global u177
+u177:
+  movsxd rsi, dword ptr [rip+g3300]
+  add rsi, qword ptr [rip+g971]
+  mov qword ptr [rip+g1770], rsi
+  movsxd rsi, dword ptr [rip+g45]
+  movsxd rdi, dword ptr [rip+g4168]
+  add rsi, rdi
+  mov qword ptr [rip+g1771], rsi
+  mov rsi, qword ptr [rip+g3061]
+  movsx rdi, word ptr [rip+g3010]
+  add rsi, rdi
+  mov byte ptr [rip+g1772], sil
+  movsx rsi, word ptr [rip+g3824]
+  movsxd rdi, dword ptr [rip+g42]
+  add rsi, rdi
+  mov dword ptr [rip+g1773], esi
+  mov rsi, qword ptr [rip+g4288]
+  movsx rdi, word ptr [rip+g2148]
+  add rsi, rdi
+  mov dword ptr [rip+g1774], esi
+  movsx rsi, word ptr [rip+g4834]
+  movsxd rdi, dword ptr [rip+g928]
+  add rsi, rdi
+  mov dword ptr [rip+g1775], esi
+  movsx rsi, word ptr [rip+g555]
+  movsx rdi, byte ptr [rip+g679]
+  add rsi, rdi
+  mov qword ptr [rip+g1776], rsi
+  movsx rsi, word ptr [rip+g1553]
+  movsx rdi, word ptr [rip+g4353]
+  add rsi, rdi
+  mov dword ptr [rip+g1777], esi
+  movsx rsi, byte ptr [rip+g4599]
+  movsx rdi, byte ptr [rip+g1762]
+  add rsi, rdi
+  mov byte ptr [rip+g1778], sil
+  mov rsi, qword ptr [rip+g3225]
+  add rsi, qword ptr [rip+g4003]
+  mov word ptr [rip+g1779], si
+  mov rax, qword ptr [rip+g1770]
+.L.return.u177:
+  ret
+.text
+.p2align 4
+.global u178
+u178:
+  movsx rsi, word ptr [rip+g4914]
+  movsxd rdi, dword ptr [rip+g1381]
+  add rsi, rdi
+  mov word ptr [rip+g1780], si
+  movsx rsi, byte ptr [rip+g3207]
+  movsxd rdi, dword ptr [rip+g4159]
+  add rsi, rdi
+  mov qword ptr [rip+g1781], rsi
+  movsxd rsi, dword ptr [rip+g3052]
+  movsx rdi, byte ptr [rip+g4638]
+  add rsi, rdi
+  mov dword ptr [rip+g1782], esi
+  movsxd rsi, dword ptr [rip+g1371]
+  movsxd rdi, dword ptr [rip+g3001]
+  add rsi, rdi
+  mov dword ptr [rip+g1783], esi
+  movsx rsi, word ptr [rip+g3542]
+  add rsi, qword ptr [rip+g2618]
+  mov byte ptr [rip+g1784], sil
+  movsx rsi, word ptr [rip+g1611]
+  add rsi, qword ptr [rip+g3021]
+  mov dword ptr [rip+g1785], esi
+  movsx rsi, byte ptr [rip+g2538]
+  movsxd rdi, dword ptr [rip+g1845]
+  add rsi, rdi
+  mov qword ptr [rip+g1786], rsi
+  mov rsi, qword ptr [rip+g4492]
+  movsxd rdi, dword ptr [rip+g4008]
+  add rsi, rdi
+  mov byte ptr [rip+g1787], sil
+  movsx rsi, byte ptr [rip+g2484]
+  movsx rdi, word ptr [rip+g1730]
+  add rsi, rdi
+  mov dword ptr [rip+g1788], esi
+  movsxd rsi, dword ptr [rip+g59]
+  add rsi, qword ptr [rip+g237]
+  mov byte ptr [rip+g1789], sil
+  movsx rsi, word ptr [rip+g1780]
+  mov rax, rsi
+.L.return.u178:
+  ret
+.text
+.p2align 4
+.global u179
+u179:
+  mov rsi, qword ptr [rip+g4183]
+  movsxd rdi, dword ptr [rip+g2698]
+  add rsi, rdi
+  mov dword ptr [rip+g1790], esi
+  movsx rsi, word ptr [rip+g2990]
+  movsx rdi, byte ptr [rip+g3729]
+  add rsi, rdi
+  mov word ptr [rip+g1791], si
+  movsx rsi, word ptr [rip+g2685]
+  movsx rdi, byte ptr [rip+g366]
+  add rsi, rdi
+  mov byte ptr [rip+g1792], sil
+  movsx rsi, word ptr [rip+g291]
+  add rsi, qword ptr [rip+g297]
+  mov word ptr [rip+g1793], si
+  movsxd rsi, dword ptr [rip+g870]
+  movsxd rdi, dword ptr [rip+g1042]
+  add rsi, rdi
+  mov word ptr [rip+g1794], si
+  movsx rsi, byte ptr [rip+g335]
+  add rsi, qword ptr [rip+g2618]
+  mov qword ptr [rip+g1795], rsi
+  movsxd rsi, dword ptr [rip+g1381]
+  movsxd rdi, dword ptr [rip+g1056]
+  add rsi, rdi
+  mov word ptr [rip+g1796], si
+  movsx rsi, byte ptr [rip+g864]
+  movsxd rdi, dword ptr [rip+g1907]
+  add rsi, rdi
+  mov word ptr [rip+g1797], si
+  mov rsi, qword ptr [rip+g759]
+  add rsi, qword ptr [rip+g2593]
+  mov qword ptr [rip+g1798], rsi
+  movsxd rsi, dword ptr [rip+g4905]
+  add rsi, qword ptr [rip+g4571]
+  mov byte ptr [rip+g1799], sil
+  movsxd rsi, dword ptr [rip+g1790]
+  mov rax, rsi
+.L.return.u179:
+  ret
+.text
+.p2align 4
+.global u180
+u180:
+  movsx rsi, word ptr [rip+g4697]
+  movsxd rdi, dword ptr [rip+g2529]
+  add rsi, rdi
+  mov dword ptr [rip+g1800], esi
+  movsx rsi, word ptr [rip+g4732]
+  movsxd rdi, dword ptr [rip+g1574]
+  add rsi, rdi
+  mov word ptr [rip+g1801], si
+  movsx rsi, word ptr [rip+g118]
+  movsx rdi, byte ptr [rip+g784]
+  add rsi, rdi
+  mov dword ptr [rip+g1802], esi
+  mov rsi, qword ptr [rip+g4713]
+  add rsi, qword ptr [rip+g5]
+  mov word ptr [rip+g1803], si
+  movsxd rsi, dword ptr [rip+g4020]
+  add rsi, qword ptr [rip+g1781]
+  mov dword ptr [rip+g1804], esi
+  movsx rsi, byte ptr [rip+g2728]
+  add rsi, qword ptr [rip+g1798]
+  mov byte ptr [rip+g1805], sil
+  movsx rsi, word ptr [rip+g4320]
+  add rsi, qword ptr [rip+g4170]
+  mov word ptr [rip+g1806], si
+  movsxd rsi, dword ptr [rip+g2648]
+  movsx rdi, byte ptr [rip+g4891]
+  add rsi, rdi
+  mov byte ptr [rip+g1807], sil
+  movsx rsi, byte ptr [rip+g4013]
+  movsx rdi, byte ptr [rip+g690]
+  add rsi, rdi
+  mov word ptr [rip+g1808], si
+  movsx rsi, byte ptr [rip+g695]
+  movsxd rdi, dword ptr [rip+g126]
+  add rsi, rdi
+  mov qword ptr [rip+g1809], rsi
+  movsxd rsi, dword ptr [rip+g1800]
+  mov rax, rsi
+.L.return.u180:
+  ret
+.text
+.p2align 4
+.global u181
+u181:
+  movsx rsi, word ptr [rip+g4755]
+  movsxd rdi, dword ptr [rip+g2130]
+  add rsi, rdi
+  mov byte ptr [rip+g1810], sil
+  mov rsi, qword ptr [rip+g1059]
+  add rsi, qword ptr [rip+g4443]
+  mov word ptr [rip+g1811], si
+  movsxd rsi, dword ptr [rip+g3750]
+  add rsi, qword ptr [rip+g3419]
+  mov word ptr [rip+g1812], si
+  movsx rsi, word ptr [rip+g3562]
+  add rsi, qword ptr [rip+g2074]
+  mov word ptr [rip+g1813], si
+  movsx rsi, byte ptr [rip+g43]
+  movsxd rdi, dword ptr [rip+g234]
+  add rsi, rdi
+  mov word ptr [rip+g1814], si
+  movsx rsi, word ptr [rip+g3914]
+  add rsi, qword ptr [rip+g423]
+  mov dword ptr [rip+g1815], esi
+  movsx rsi, word ptr [rip+g3987]
+  movsx rdi, word ptr [rip+g4698]
+  add rsi, rdi
+  mov qword ptr [rip+g1816], rsi
+  movsx rsi, word ptr [rip+g1239]
+  add rsi, qword ptr [rip+g354]
+  mov word ptr [rip+g1817], si
+  mov rsi, qword ptr [rip+g4651]
+  add rsi, qword ptr [rip+g3983]
+  mov qword ptr [rip+g1818], rsi
+  movsx rsi, word ptr [rip+g1570]
+  movsxd rdi, dword ptr [rip+g3670]
+  add rsi, rdi
+  mov word ptr [rip+g1819], si
+  movsx rsi, byte ptr [rip+g1810]
+  mov rax, rsi
+.L.return.u181:
+  ret
+.text
+.p2align 4
+.global u182
+u182:
+  movsxd rsi, dword ptr [rip+g3599]
+  movsx rdi, byte ptr [rip+g1496]
+  add rsi, rdi
+  mov dword ptr [rip+g1820], esi
+  movsx rsi, word ptr [rip+g4970]
+  movsxd rdi, dword ptr [rip+g3429]
+  add rsi, rdi
+  mov byte ptr [rip+g1821], sil
+  movsxd rsi, dword ptr [rip+g3656]
+  add rsi, qword ptr [rip+g3098]
+  mov byte ptr [rip+g1822], sil
+  movsx rsi, byte ptr [rip+g267]
+  movsxd rdi, dword ptr [rip+g832]
+  add rsi, rdi
+  mov word ptr [rip+g1823], si
+  movsx rsi, byte ptr [rip+g3455]
+  add rsi, qword ptr [rip+g2811]
+  mov word ptr [rip+g1824], si
+  movsx rsi, word ptr [rip+g2145]
+  add rsi, qword ptr [rip+g4689]
+  mov word ptr [rip+g1825], si
+  mov rsi, qword ptr [rip+g1335]
+  movsxd rdi, dword ptr [rip+g957]
+  add rsi, rdi
+  mov word ptr [rip+g1826], si
+  mov rsi, qword ptr [rip+g1300]
+  movsxd rdi, dword ptr [rip+g2506]
+  add rsi, rdi
+  mov qword ptr [rip+g1827], rsi
+  movsx rsi, word ptr [rip+g4744]
+  movsxd rdi, dword ptr [rip+g4917]
+  add rsi, rdi
+  mov qword ptr [rip+g1828], rsi
+  movsx rsi, byte ptr [rip+g4832]
+  add rsi, qword ptr [rip+g2430]
+  mov word ptr [rip+g1829], si
+  movsxd rsi, dword ptr [rip+g1820]
+  mov rax, rsi
+.L.return.u182:
+  ret
+.text
+.p2align 4
+.global u183
+u183:
+  movsx rsi, word ptr [rip+g4095]
+  movsxd rdi, dword ptr [rip+g3768]
+  add rsi, rdi
+  mov word ptr [rip+g1830], si
+  movsx rsi, byte ptr [rip+g1065]
+  movsx rdi, byte ptr [rip+g4955]
+  add rsi, rdi
+  mov dword ptr [rip+g1831], esi
+  movsxd rsi, dword ptr [rip+g3618]
+  movsx rdi, byte ptr [rip+g2820]
+  add rsi, rdi
+  mov dword ptr [rip+g1832], esi
+  mov rsi, qword ptr [rip+g1933]
+  add rsi, qword ptr [rip+g3822]
+  mov dword ptr [rip+g1833], esi
+  movsx rsi, word ptr [rip+g637]
+  movsx rdi, word ptr [rip+g471]
+  add rsi, rdi
+  mov dword ptr [rip+g1834], esi
+  movsx rsi, byte ptr [rip+g1664]
+  add rsi, qword ptr [rip+g3964]
+  mov qword ptr [rip+g1835], rsi
+  movsx rsi, byte ptr [rip+g3208]
+  movsx rdi, byte ptr [rip+g2770]
+  add rsi, rdi
+  mov byte ptr [rip+g1836], sil
+  movsx rsi, byte ptr [rip+g2293]
+  movsx rdi, word ptr [rip+g1168]
+  add rsi, rdi
+  mov byte ptr [rip+g1837], sil
+  movsx rsi, word ptr [rip+g3932]
+  add rsi, qword ptr [rip+g3263]
+  mov dword ptr [rip+g1838], esi
+  mov rsi, qword ptr [rip+g4492]
+  movsx rdi, byte ptr [rip+g2751]
+  add rsi, rdi
+  mov byte ptr [rip+g1839], sil
+  movsx rsi, word ptr [rip+g1830]
+  mov rax, rsi
+.L.return.u183:
+  ret
+.text
+.p2align 4
+.global u184
+u184:
+  movsx rsi, word ptr [rip+g100]
+  add rsi, qword ptr [rip+g1933]
+  mov dword ptr [rip+g1840], esi
+  movsx rsi, word ptr [rip+g2918]
+  movsx rdi, word ptr [rip+g878]
+  add rsi, rdi
+  mov byte ptr [rip+g1841], sil
+  movsxd rsi, dword ptr [rip+g1574]
+  movsx rdi, byte ptr [rip+g500]
+  add rsi, rdi
+  mov dword ptr [rip+g1842], esi
+  movsx rsi, byte ptr [rip+g3465]
+  add rsi, qword ptr [rip+g993]
+  mov word ptr [rip+g1843], si
+  mov rsi, qword ptr [rip+g281]
+  movsxd rdi, dword ptr [rip+g713]
+  add rsi, rdi
+  mov qword ptr [rip+g1844], rsi
+  movsx rsi, byte ptr [rip+g3216]
+  add rsi, qword ptr [rip+g3014]
+  mov dword ptr [rip+g1845], esi
+  movsxd rsi, dword ptr [rip+g895]
+  movsx rdi, byte ptr [rip+g4621]
+  add rsi, rdi
+  mov word ptr [rip+g1846], si
+  movsx rsi, byte ptr [rip+g3555]
+  movsx rdi, byte ptr [rip+g1103]
+  add rsi, rdi
+  mov word ptr [rip+g1847], si
+  movsx rsi, word ptr [rip+g1732]
+  movsxd rdi, dword ptr [rip+g4944]
+  add rsi, rdi
+  mov dword ptr [rip+g1848], esi
+  movsx rsi, word ptr [rip+g1715]
+  movsxd rdi, dword ptr [rip+g4678]
+  add rsi, rdi
+  mov qword ptr [rip+g1849], rsi
+  movsxd rsi, dword ptr [rip+g1840]
+  mov rax, rsi
+.L.return.u184:
+  ret
+.text
+.p2align 4
+.global u185
+u185:
+  mov rsi, qword ptr [rip+g3891]
+  movsxd rdi, dword ptr [rip+g4907]
+  add rsi, rdi
+  mov byte ptr [rip+g1850], sil
+  movsx rsi, word ptr [rip+g1806]
+  movsx rdi, byte ptr [rip+g278]
+  add rsi, rdi
+  mov dword ptr [rip+g1851], esi
+  movsxd rsi, dword ptr [rip+g4158]
+  add rsi, qword ptr [rip+g3286]
+  mov word ptr [rip+g1852], si
+  movsx rsi, byte ptr [rip+g173]
+  movsx rdi, word ptr [rip+g3129]
+  add rsi, rdi
+  mov byte ptr [rip+g1853], sil
+  mov rsi, qword ptr [rip+g3432]
+  movsxd rdi, dword ptr [rip+g2910]
+  add rsi, rdi
+  mov word ptr [rip+g1854], si
+  movsxd rsi, dword ptr [rip+g120]
+  movsxd rdi, dword ptr [rip+g2349]
+  add rsi, rdi
+  mov word ptr [rip+g1855], si
+  movsx rsi, word ptr [rip+g1486]
+  movsxd rdi, dword ptr [rip+g4332]
+  add rsi, rdi
+  mov byte ptr [rip+g1856], sil
+  mov rsi, qword ptr [rip+g10]
+  movsxd rdi, dword ptr [rip+g907]
+  add rsi, rdi
+  mov qword ptr [rip+g1857], rsi
+  mov rsi, qword ptr [rip+g1030]
+  add rsi, qword ptr [rip+g3796]
+  mov word ptr [rip+g1858], si
+  movsx rsi, word ptr [rip+g635]
+  movsx rdi, byte ptr [rip+g4645]
+  add rsi, rdi
+  mov qword ptr [rip+g1859], rsi
+  movsx rsi, byte ptr [rip+g1850]
+  mov rax, rsi
+.L.return.u185:
+  ret
+.text
+.p2align 4
+.global u186
+u186:
+  movsx rsi, byte ptr [rip+g97]
+  movsx rdi, byte ptr [rip+g1630]
+  add rsi, rdi
+  mov qword ptr [rip+g1860], rsi
+  movsx rsi, word ptr [rip+g2156]
+  movsx rdi, word ptr [rip+g4103]
+  add rsi, rdi
+  mov dword ptr [rip+g1861], esi
+  movsxd rsi, dword ptr [rip+g261]
+  add rsi, qword ptr [rip+g4485]
+  mov word ptr [rip+g1862], si
+  movsx rsi, byte ptr [rip+g424]
+  movsxd rdi, dword ptr [rip+g2691]
+  add rsi, rdi
+  mov word ptr [rip+g1863], si
+  movsx rsi, word ptr [rip+g792]
+  add rsi, qword ptr [rip+g179]
+  mov qword ptr [rip+g1864], rsi
+  movsx rsi, byte ptr [rip+g3885]
+  add rsi, qword ptr [rip+g1016]
+  mov qword ptr [rip+g1865], rsi
+  movsx rsi, word ptr [rip+g4258]
+  movsx rdi, byte ptr [rip+g3501]
+  add rsi, rdi
+  mov byte ptr [rip+g1866], sil
+  mov rsi, qword ptr [rip+g4860]
+  add rsi, qword ptr [rip+g2560]
+  mov word ptr [rip+g1867], si
+  mov rsi, qword ptr [rip+g1140]
+  add rsi, qword ptr [rip+g3905]
+  mov qword ptr [rip+g1868], rsi
+  movsx rsi, byte ptr [rip+g4707]
+  movsxd rdi, dword ptr [rip+g4523]
+  add rsi, rdi
+  mov dword ptr [rip+g1869], esi
+  mov rax, qword ptr [rip+g1860]
+.L.return.u186:
+  ret
+.text
+.p2align 4
+.global u187
+u187:
+  movsxd rsi, dword ptr [rip+g3334]
+  movsxd rdi, dword ptr [rip+g1353]
+  add rsi, rdi
+  mov qword ptr [rip+g1870], rsi
+  movsx rsi, word ptr [rip+g2537]
+  add rsi, qword ptr [rip+g3113]
+  mov word ptr [rip+g1871], si
+  movsx rsi, word ptr [rip+g145]
+  add rsi, qword ptr [rip+g2458]
+  mov byte ptr [rip+g1872], sil
+  movsxd rsi, dword ptr [rip+g1186]
+  add rsi, qword ptr [rip+g2558]
+  mov byte ptr [rip+g1873], sil
+  movsxd rsi, dword ptr [rip+g2164]
+  movsxd rdi, dword ptr [rip+g2836]
+  add rsi, rdi
+  mov word ptr [rip+g1874], si
+  movsx rsi, word ptr [rip+g3100]
+  movsxd rdi, dword ptr [rip+g3705]
+  add rsi, rdi
+  mov word ptr [rip+g1875], si
+  movsxd rsi, dword ptr [rip+g3016]
+  movsx rdi, word ptr [rip+g3356]
+  add rsi, rdi
+  mov word ptr [rip+g1876], si
+  movsx rsi, byte ptr [rip+g4642]
+  movsxd rdi, dword ptr [rip+g1358]
+  add rsi, rdi
+  mov word ptr [rip+g1877], si
+  movsx rsi, word ptr [rip+g1247]
+  movsx rdi, word ptr [rip+g1960]
+  add rsi, rdi
+  mov qword ptr [rip+g1878], rsi
+  movsxd rsi, dword ptr [rip+g2735]
+  movsx rdi, word ptr [rip+g302]
+  add rsi, rdi
+  mov dword ptr [rip+g1879], esi
+  mov rax, qword ptr [rip+g1870]
+.L.return.u187:
+  ret
+.text
+.p2align 4
+.global u188
+u188:
+  mov rsi, qword ptr [rip+g2389]
+  movsx rdi, byte ptr [rip+g3672]
+  add rsi, rdi
+  mov dword ptr [rip+g1880], esi
+  movsxd rsi, dword ptr [rip+g3984]
+  movsx rdi, word ptr [rip+g2474]
+  add rsi, rdi
+  mov dword ptr [rip+g1881], esi
+  movsx rsi, byte ptr [rip+g1119]
+  movsx rdi, byte ptr [rip+g1733]
+  add rsi, rdi
+  mov qword ptr [rip+g1882], rsi
+  movsxd rsi, dword ptr [rip+g1627]
+  movsx rdi, word ptr [rip+g4665]
+  add rsi, rdi
+  mov word ptr [rip+g1883], si
+  movsxd rsi, dword ptr [rip+g3311]
+  movsx rdi, byte ptr [rip+g2894]
+  add rsi, rdi
+  mov byte ptr [rip+g1884], sil
+  movsx rsi, byte ptr [rip+g2601]
+  movsx rdi, word ptr [rip+g1384]
+  add rsi, rdi
+  mov dword ptr [rip+g1885], esi
+  movsx rsi, byte ptr [rip+g2975]
+  add rsi, qword ptr [rip+g2574]
+  mov dword ptr [rip+g1886], esi
+  mov rsi, qword ptr [rip+g581]
+  movsx rdi, byte ptr [rip+g198]
+  add rsi, rdi
+  mov dword ptr [rip+g1887], esi
+  movsx rsi, word ptr [rip+g2896]
+  movsx rdi, word ptr [rip+g3293]
+  add rsi, rdi
+  mov word ptr [rip+g1888], si
+  movsxd rsi, dword ptr [rip+g2376]
+  movsx rdi, byte ptr [rip+g3521]
+  add rsi, rdi
+  mov word ptr [rip+g1889], si
+  movsxd rsi, dword ptr [rip+g1880]
+  mov rax, rsi
+.L.return.u188:
+  ret
+.text
+.p2align 4
+.global u189
+u189:
+  mov rsi, qword ptr [rip+g3894]
+  movsx rdi, word ptr [rip+g177]
+  add rsi, rdi
+  mov dword ptr [rip+g1890], esi
+  movsxd rsi, dword ptr [rip+g4202]
+  add rsi, qword ptr [rip+g2431]
+  mov dword ptr [rip+g1891], esi
+  movsx rsi, byte ptr [rip+g1225]
+  movsx rdi, byte ptr [rip+g4811]
+  add rsi, rdi
+  mov dword ptr [rip+g1892], esi
+  movsx rsi, byte ptr [rip+g4391]
+  movsx rdi, word ptr [rip+g3785]
+  add rsi, rdi
+  mov word ptr [rip+g1893], si
+  movsx rsi, byte ptr [rip+g3131]
+  movsxd rdi, dword ptr [rip+g969]
+  add rsi, rdi
+  mov byte ptr [rip+g1894], sil
+  movsx rsi, word ptr [rip+g2550]
+  movsxd rdi, dword ptr [rip+g170]
+  add rsi, rdi
+  mov qword ptr [rip+g1895], rsi
+  movsx rsi, byte ptr [rip+g530]
+  add rsi, qword ptr [rip+g92]
+  mov byte ptr [rip+g1896], sil
+  movsxd rsi, dword ptr [rip+g1603]
+  movsxd rdi, dword ptr [rip+g4622]
+  add rsi, rdi
+  mov byte ptr [rip+g1897], sil
+  mov rsi, qword ptr [rip+g3911]
+  movsx rdi, byte ptr [rip+g4181]
+  add rsi, rdi
+  mov qword ptr [rip+g1898], rsi
+  mov rsi, qword ptr [rip+g2008]
+  movsx rdi, word ptr [rip+g4402]
+  add rsi, rdi
+  mov word ptr [rip+g1899], si
+  movsxd rsi, dword ptr [rip+g1890]
+  mov rax, rsi
+.L.return.u189:
+  ret
+.text
+.p2align 4
+.global u190
+u190:
+  movsxd rsi, dword ptr [rip+g3573]
+  add rsi, qword ptr [rip+g3557]
+  mov word ptr [rip+g1900], si
+  movsxd rsi, dword ptr [rip+g2518]
+  movsxd rdi, dword ptr [rip+g2107]
+  add rsi, rdi
+  mov byte ptr [rip+g1901], sil
+  movsx rsi, word ptr [rip+g4473]
+  movsx rdi, word ptr [rip+g3487]
+  add rsi, rdi
+  mov dword ptr [rip+g1902], esi
+  movsx rsi, byte ptr [rip+g2157]
+  add rsi, qword ptr [rip+g3586]
+  mov word ptr [rip+g1903], si
+  movsx rsi, byte ptr [rip+g4229]
+  movsx rdi, byte ptr [rip+g2576]
+  add rsi, rdi
+  mov qword ptr [rip+g1904], rsi
+  movsx rsi, word ptr [rip+g431]
+  movsxd rdi, dword ptr [rip+g95]
+  add rsi, rdi
+  mov qword ptr [rip+g1905], rsi
+  movsx rsi, word ptr [rip+g2421]
+  movsx rdi, word ptr [rip+g4552]
+  add rsi, rdi
+  mov byte ptr [rip+g1906], sil
+  movsxd rsi, dword ptr [rip+g3527]
+  movsxd rdi, dword ptr [rip+g927]
+  add rsi, rdi
+  mov dword ptr [rip+g1907], esi
+  movsxd rsi, dword ptr [rip+g1238]
+  movsxd rdi, dword ptr [rip+g3144]
+  add rsi, rdi
+  mov qword ptr [rip+g1908], rsi
+  movsx rsi, word ptr [rip+g1812]
+  movsxd rdi, dword ptr [rip+g1752]
+  add rsi, rdi
+  mov word ptr [rip+g1909], si
+  movsx rsi, word ptr [rip+g1900]
+  mov rax, rsi
+.L.return.u190:
+  ret
+.text
+.p2align 4
+.global u191
+u191:
+  movsx rsi, byte ptr [rip+g4582]
+  add rsi, qword ptr [rip+g904]
+  mov dword ptr [rip+g1910], esi
+  movsx rsi, word ptr [rip+g1609]
+  add rsi, qword ptr [rip+g1304]
+  mov qword ptr [rip+g1911], rsi
+  movsx rsi, word ptr [rip+g4246]
+  movsxd rdi, dword ptr [rip+g4551]
+  add rsi, rdi
+  mov word ptr [rip+g1912], si
+  movsxd rsi, dword ptr [rip+g204]
+  movsx rdi, word ptr [rip+g2336]
+  add rsi, rdi
+  mov word ptr [rip+g1913], si
+  movsxd rsi, dword ptr [rip+g597]
+  add rsi, qword ptr [rip+g1010]
+  mov qword ptr [rip+g1914], rsi
+  mov rsi, qword ptr [rip+g1207]
+  movsx rdi, word ptr [rip+g754]
+  add rsi, rdi
+  mov qword ptr [rip+g1915], rsi
+  movsx rsi, word ptr [rip+g4386]
+  movsxd rdi, dword ptr [rip+g2092]
+  add rsi, rdi
+  mov byte ptr [rip+g1916], sil
+  movsx rsi, byte ptr [rip+g3245]
+  movsx rdi, word ptr [rip+g1826]
+  add rsi, rdi
+  mov byte ptr [rip+g1917], sil
+  movsx rsi, word ptr [rip+g144]
+  movsx rdi, byte ptr [rip+g827]
+  add rsi, rdi
+  mov byte ptr [rip+g1918], sil
+  mov rsi, qword ptr [rip+g4890]
+  movsx rdi, word ptr [rip+g3541]
+  add rsi, rdi
+  mov word ptr [rip+g1919], si
+  movsxd rsi, dword ptr [rip+g1910]
+  mov rax, rsi
+.L.return.u191:
+  ret
+.text
+.p2align 4
+.global u192
+u192:
+  mov rsi, qword ptr [rip+g1977]
+  add rsi, qword ptr [rip+g528]
+  mov word ptr [rip+g1920], si
+  mov rsi, qword ptr [rip+g1849]
+  movsx rdi, byte ptr [rip+g2763]
+  add rsi, rdi
+  mov word ptr [rip+g1921], si
+  movsxd rsi, dword ptr [rip+g56]
+  movsx rdi, byte ptr [rip+g4515]
+  add rsi, rdi
+  mov byte ptr [rip+g1922], sil
+  movsxd rsi, dword ptr [rip+g1585]
+  movsx rdi, word ptr [rip+g3074]
+  add rsi, rdi
+  mov qword ptr [rip+g1923], rsi
+  movsx rsi, word ptr [rip+g3940]
+  movsx rdi, word ptr [rip+g4912]
+  add rsi, rdi
+  mov dword ptr [rip+g1924], esi
+  mov rsi, qword ptr [rip+g3790]
+  movsx rdi, byte ptr [rip+g2338]
+  add rsi, rdi
+  mov word ptr [rip+g1925], si
+  mov rsi, qword ptr [rip+g4224]
+  movsx rdi, word ptr [rip+g1278]
+  add rsi, rdi
+  mov dword ptr [rip+g1926], esi
+  movsx rsi, byte ptr [rip+g764]
+  movsx rdi, byte ptr [rip+g3837]
+  add rsi, rdi
+  mov word ptr [rip+g1927], si
+  movsxd rsi, dword ptr [rip+g1373]
+  movsx rdi, byte ptr [rip+g987]
+  add rsi, rdi
+  mov qword ptr [rip+g1928], rsi
+  movsx rsi, byte ptr [rip+g3551]
+  movsx rdi, word ptr [rip+g4637]
+  add rsi, rdi
+  mov dword ptr [rip+g1929], esi
+  movsx rsi, word ptr [rip+g1920]
+  mov rax, rsi
+.L.return.u192:
+  ret
+.text
+.p2align 4
+.global u193
+u193:
+  movsx rsi, byte ptr [rip+g2773]
+  add rsi, qword ptr [rip+g2993]
+  mov byte ptr [rip+g1930], sil
+  movsx rsi, word ptr [rip+g4410]
+  movsx rdi, byte ptr [rip+g1275]
+  add rsi, rdi
+  mov dword ptr [rip+g1931], esi
+  movsxd rsi, dword ptr [rip+g1198]
+  movsx rdi, word ptr [rip+g2498]
+  add rsi, rdi
+  mov qword ptr [rip+g1932], rsi
+  movsx rsi, word ptr [rip+g2267]
+  movsxd rdi, dword ptr [rip+g1228]
+  add rsi, rdi
+  mov qword ptr [rip+g1933], rsi
+  movsxd rsi, dword ptr [rip+g184]
+  add rsi, qword ptr [rip+g1026]
+  mov byte ptr [rip+g1934], sil
+  mov rsi, qword ptr [rip+g2675]
+  movsx rdi, word ptr [rip+g492]
+  add rsi, rdi
+  mov byte ptr [rip+g1935], sil
+  movsxd rsi, dword ptr [rip+g608]
+  movsx rdi, word ptr [rip+g4103]
+  add rsi, rdi
+  mov qword ptr [rip+g1936], rsi
+  movsx rsi, word ptr [rip+g602]
+  movsx rdi, byte ptr [rip+g4601]
+  add rsi, rdi
+  mov byte ptr [rip+g1937], sil
+  movsxd rsi, dword ptr [rip+g2224]
+  add rsi, qword ptr [rip+g389]
+  mov qword ptr [rip+g1938], rsi
+  mov rsi, qword ptr [rip+g1864]
+  movsx rdi, word ptr [rip+g819]
+  add rsi, rdi
+  mov dword ptr [rip+g1939], esi
+  movsx rsi, byte ptr [rip+g1930]
+  mov rax, rsi
+.L.return.u193:
+  ret
+.text
+.p2align 4
+.global u194
+u194:
+  movsxd rsi, dword ptr [rip+g2134]
+  movsx rdi, word ptr [rip+g3767]
+  add rsi, rdi
+  mov dword ptr [rip+g1940], esi
+  movsx rsi, byte ptr [rip+g472]
+  add rsi, qword ptr [rip+g1567]
+  mov word ptr [rip+g1941], si
+  movsx rsi, byte ptr [rip+g902]
+  movsx rdi, byte ptr [rip+g3128]
+  add rsi, rdi
+  mov dword ptr [rip+g1942], esi
+  mov rsi, qword ptr [rip+g3679]
+  movsx rdi, word ptr [rip+g3592]
+  add rsi, rdi
+  mov qword ptr [rip+g1943], rsi
+  movsxd rsi, dword ptr [rip+g2875]
+  add rsi, qword ptr [rip+g2280]
+  mov dword ptr [rip+g1944], esi
+  movsxd rsi, dword ptr [rip+g3369]
+  movsx rdi, byte ptr [rip+g722]
+  add rsi, rdi
+  mov byte ptr [rip+g1945], sil
+  movsx rsi, byte ptr [rip+g4302]
+  add rsi, qword ptr [rip+g4107]
+  mov byte ptr [rip+g1946], sil
+  mov rsi, qword ptr [rip+g137]
+  movsx rdi, word ptr [rip+g1110]
+  add rsi, rdi
+  mov byte ptr [rip+g1947], sil
+  mov rsi, qword ptr [rip+g2312]
+  add rsi, qword ptr [rip+g3238]
+  mov word ptr [rip+g1948], si
+  movsx rsi, byte ptr [rip+g3496]
+  movsx rdi, word ptr [rip+g2318]
+  add rsi, rdi
+  mov dword ptr [rip+g1949], esi
+  movsxd rsi, dword ptr [rip+g1940]
+  mov rax, rsi
+.L.return.u194:
+  ret
+.text
+.p2align 4
+.global u195
+u195:
+  movsx rsi, word ptr [rip+g2053]
+  movsx rdi, word ptr [rip+g1825]
+  add rsi, rdi
+  mov dword ptr [rip+g1950], esi
+  mov rsi, qword ptr [rip+g607]
+  add rsi, qword ptr [rip+g1723]
+  mov word ptr [rip+g1951], si
+  movsx rsi, byte ptr [rip+g198]
+  movsx rdi, byte ptr [rip+g4489]
+  add rsi, rdi
+  mov byte ptr [rip+g1952], sil
+  movsx rsi, byte ptr [rip+g3065]
+  add rsi, qword ptr [rip+g3829]
+  mov dword ptr [rip+g1953], esi
+  movsx rsi, byte ptr [rip+g532]
+  movsx rdi, byte ptr [rip+g1918]
+  add rsi, rdi
+  mov word ptr [rip+g1954], si
+  movsxd rsi, dword ptr [rip+g2606]
+  movsx rdi, word ptr [rip+g2669]
+  add rsi, rdi
+  mov word ptr [rip+g1955], si
+  movsxd rsi, dword ptr [rip+g1096]
+  movsxd rdi, dword ptr [rip+g4179]
+  add rsi, rdi
+  mov word ptr [rip+g1956], si
+  movsx rsi, word ptr [rip+g3262]
+  add rsi, qword ptr [rip+g4494]
+  mov qword ptr [rip+g1957], rsi
+  movsx rsi, byte ptr [rip+g4629]
+  movsx rdi, byte ptr [rip+g2366]
+  add rsi, rdi
+  mov qword ptr [rip+g1958], rsi
+  movsxd rsi, dword ptr [rip+g3177]
+  movsx rdi, byte ptr [rip+g3463]
+  add rsi, rdi
+  mov word ptr [rip+g1959], si
+  movsxd rsi, dword ptr [rip+g1950]
+  mov rax, rsi
+.L.return.u195:
+  ret
+.text
+.p2align 4
+.global u196
+u196:
+  movsx rsi, byte ptr [rip+g4317]
+  movsxd rdi, dword ptr [rip+g644]
+  add rsi, rdi
+  mov word ptr [rip+g1960], si
+  movsx rsi, word ptr [rip+g304]
+  movsx rdi, word ptr [rip+g408]
+  add rsi, rdi
+  mov qword ptr [rip+g1961], rsi
+  mov rsi, qword ptr [rip+g3715]
+  movsx rdi, word ptr [rip+g4102]
+  add rsi, rdi
+  mov byte ptr [rip+g1962], sil
+  mov rsi, qword ptr [rip+g1173]
+  movsx rdi, byte ptr [rip+g2985]
+  add rsi, rdi
+  mov byte ptr [rip+g1963], sil
+  movsx rsi, word ptr [rip+g2156]
+  movsx rdi, byte ptr [rip+g4841]
+  add rsi, rdi
+  mov qword ptr [rip+g1964], rsi
+  movsx rsi, word ptr [rip+g3039]
+  movsx rdi, byte ptr [rip+g2049]
+  add rsi, rdi
+  mov word ptr [rip+g1965], si
+  movsx rsi, byte ptr [rip+g3524]
+  movsx rdi, byte ptr [rip+g3929]
+  add rsi, rdi
+  mov word ptr [rip+g1966], si
+  movsxd rsi, dword ptr [rip+g3221]
+  add rsi, qword ptr [rip+g3322]
+  mov dword ptr [rip+g1967], esi
+  mov rsi, qword ptr [rip+g2090]
+  movsx rdi, word ptr [rip+g1164]
+  add rsi, rdi
+  mov byte ptr [rip+g1968], sil
+  movsxd rsi, dword ptr [rip+g1105]
+  add rsi, qword ptr [rip+g348]
+  mov byte ptr [rip+g1969], sil
+  movsx rsi, word ptr [rip+g1960]
+  mov rax, rsi
+.L.return.u196:
+  ret
+.text
+.p2align 4
+.global u197
+u197:
+  movsxd rsi, dword ptr [rip+g3290]
+  add rsi, qword ptr [rip+g3802]
+  mov word ptr [rip+g1970], si
+  mov rsi, qword ptr [rip+g2649]
+  movsxd rdi, dword ptr [rip+g3747]
+  add rsi, rdi
+  mov word ptr [rip+g1971], si
+  movsxd rsi, dword ptr [rip+g1070]
+  add rsi, qword ptr [rip+g1501]
+  mov qword ptr [rip+g1972], rsi
+  movsx rsi, byte ptr [rip+g1266]
+  movsxd rdi, dword ptr [rip+g2656]
+  add rsi, rdi
+  mov qword ptr [rip+g1973], rsi
+  movsx rsi, byte ptr [rip+g2044]
+  movsx rdi, byte ptr [rip+g4143]
+  add rsi, rdi
+  mov dword ptr [rip+g1974], esi
+  movsx rsi, byte ptr [rip+g1464]
+  movsx rdi, word ptr [rip+g2012]
+  add rsi, rdi
+  mov dword ptr [rip+g1975], esi
+  movsxd rsi, dword ptr [rip+g2730]
+  movsxd rdi, dword ptr [rip+g2816]
+  add rsi, rdi
+  mov qword ptr [rip+g1976], rsi
+  movsx rsi, word ptr [rip+g3397]
+  movsx rdi, byte ptr [rip+g1019]
+  add rsi, rdi
+  mov qword ptr [rip+g1977], rsi
+  movsx rsi, byte ptr [rip+g1428]
+  movsx rdi, word ptr [rip+g3031]
+  add rsi, rdi
+  mov dword ptr [rip+g1978], esi
+  movsxd rsi, dword ptr [rip+g2419]
+  add rsi, qword ptr [rip+g389]
+  mov dword ptr [rip+g1979], esi
+  movsx rsi, word ptr [rip+g1970]
+  mov rax, rsi
+.L.return.u197:
+  ret
+.text
+.p2align 4
+.global u198
+u198:
+  mov rsi, qword ptr [rip+g811]
+  movsxd rdi, dword ptr [rip+g4911]
+  add rsi, rdi
+  mov word ptr [rip+g1980], si
+  movsx rsi, byte ptr [rip+g1739]
+  movsx rdi, word ptr [rip+g1036]
+  add rsi, rdi
+  mov byte ptr [rip+g1981], sil
+  movsx rsi, word ptr [rip+g4885]
+  add rsi, qword ptr [rip+g2914]
+  mov dword ptr [rip+g1982], esi
+  movsxd rsi, dword ptr [rip+g791]
+  movsxd rdi, dword ptr [rip+g3841]
+  add rsi, rdi
+  mov byte ptr [rip+g1983], sil
+  mov rsi, qword ptr [rip+g64]
+  movsxd rdi, dword ptr [rip+g2058]
+  add rsi, rdi
+  mov qword ptr [rip+g1984], rsi
+  movsxd rsi, dword ptr [rip+g3399]
+  movsx rdi, byte ptr [rip+g4096]
+  add rsi, rdi
+  mov word ptr [rip+g1985], si
+  movsxd rsi, dword ptr [rip+g3104]
+  add rsi, qword ptr [rip+g3565]
+  mov qword ptr [rip+g1986], rsi
+  movsx rsi, byte ptr [rip+g3037]
+  movsx rdi, byte ptr [rip+g3199]
+  add rsi, rdi
+  mov word ptr [rip+g1987], si
+  movsx rsi, word ptr [rip+g1210]
+  movsx rdi, word ptr [rip+g3607]
+  add rsi, rdi
+  mov byte ptr [rip+g1988], sil
+  mov rsi, qword ptr [rip+g615]
+  add rsi, qword ptr [rip+g4193]
+  mov byte ptr [rip+g1989], sil
+  movsx rsi, word ptr [rip+g1980]
+  mov rax, rsi
+.L.return.u198:
+  ret
+.text
+.p2align 4
+.global u199
+u199:
+  movsxd rsi, dword ptr [rip+g3278]
+  movsxd rdi, dword ptr [rip+g478]
+  add rsi, rdi
+  mov byte ptr [rip+g1990], sil
+  movsx rsi, byte ptr [rip+g3219]
+  add rsi, qword ptr [rip+g383]
+  mov dword ptr [rip+g1991], esi
+  movsx rsi, word ptr [rip+g408]
+  movsx rdi, byte ptr [rip+g4088]
+  add rsi, rdi
+  mov dword ptr [rip+g1992], esi
+  movsxd rsi, dword ptr [rip+g2473]
+  movsxd rdi, dword ptr [rip+g541]
+  add rsi, rdi
+  mov byte ptr [rip+g1993], sil
+  movsx rsi, word ptr [rip+g1862]
+  add rsi, qword ptr [rip+g4775]
+  mov byte ptr [rip+g1994], sil
+  movsx rsi, byte ptr [rip+g516]
+  add rsi, qword ptr [rip+g4288]
+  mov dword ptr [rip+g1995], esi
+  movsxd rsi, dword ptr [rip+g895]
+  add rsi, qword ptr [rip+g3742]
+  mov word ptr [rip+g1996], si
+  movsxd rsi, dword ptr [rip+g2634]
+  add rsi, qword ptr [rip+g374]
+  mov word ptr [rip+g1997], si
+  mov rsi, qword ptr [rip+g1114]
+  movsxd rdi, dword ptr [rip+g1009]
+  add rsi, rdi
+  mov byte ptr [rip+g1998], sil
+  movsx rsi, word ptr [rip+g4378]
+  movsxd rdi, dword ptr [rip+g3972]
+  add rsi, rdi
+  mov word ptr [rip+g1999], si
+  movsx rsi, byte ptr [rip+g1990]
+  mov rax, rsi
+.L.return.u199:
+  ret
+.text
+.p2align 4
+.global u200
+u200:
+  movsxd rsi, dword ptr [rip+g4554]
+  movsx rdi, word ptr [rip+g1278]
+  add rsi, rdi
+  mov qword ptr [rip+g2000], rsi
+  movsx rsi, word ptr [rip+g96]
+  movsx rdi, word ptr [rip+g4454]
+  add rsi, rdi
+  mov qword ptr [rip+g2001], rsi
+  movsxd rsi, dword ptr [rip+g3299]
+  add rsi, qword ptr [rip+g1344]
+  mov qword ptr [rip+g2002], rsi
+  movsxd rsi, dword ptr [rip+g1724]
+  movsx rdi, byte ptr [rip+g3757]
+  add rsi, rdi
+  mov word ptr [rip+g2003], si
+  movsx rsi, word ptr [rip+g1117]
+  add rsi, qword ptr [rip+g3114]
+  mov byte ptr [rip+g2004], sil
+  movsxd rsi, dword ptr [rip+g3853]
+  movsx rdi, word ptr [rip+g3825]
+  add rsi, rdi
+  mov dword ptr [rip+g2005], esi
+  movsxd rsi, dword ptr [rip+g4157]
+  movsx rdi, word ptr [rip+g4697]
+  add rsi, rdi
+  mov qword ptr [rip+g2006], rsi
+  movsx rsi, byte ptr [rip+g4625]
+  movsx rdi, byte ptr [rip+g3826]
+  add rsi, rdi
+  mov word ptr [rip+g2007], si
+  mov rsi, qword ptr [rip+g2182]
+  movsx rdi, byte ptr [rip+g3575]
+  add rsi, rdi
+  mov qword ptr [rip+g2008], rsi
+  movsx rsi, byte ptr [rip+g2980]
+  movsx rdi, word ptr [rip+g2659]
+  add rsi, rdi
+  mov dword ptr [rip+g2009], esi
+  mov rax, qword ptr [rip+g2000]
+.L.return.u200:
+  ret
+.text
+.p2align 4
+.global u201
+u201:
+  mov rsi, qword ptr [rip+g2248]
+  movsxd rdi, dword ptr [rip+g3224]
+  add rsi, rdi
+  mov dword ptr [rip+g2010], esi
+  movsx rsi, byte ptr [rip+g3483]
+  movsx rdi, byte ptr [rip+g223]
+  add rsi, rdi
+  mov dword ptr [rip+g2011], esi
+  mov rsi, qword ptr [rip+g348]
+  movsxd rdi, dword ptr [rip+g1291]
+  add rsi, rdi
+  mov word ptr [rip+g2012], si
+  movsxd rsi, dword ptr [rip+g3340]
+  movsxd rdi, dword ptr [rip+g1236]
+  add rsi, rdi
+  mov word ptr [rip+g2013], si
+  mov rsi, qword ptr [rip+g1749]
+  movsxd rdi, dword ptr [rip+g4277]
+  add rsi, rdi
+  mov dword ptr [rip+g2014], esi
+  movsxd rsi, dword ptr [rip+g638]
+  movsx rdi, word ptr [rip+g1378]
+  add rsi, rdi
+  mov dword ptr [rip+g2015], esi
+  movsxd rsi, dword ptr [rip+g2806]
+  movsxd rdi, dword ptr [rip+g1746]
+  add rsi, rdi
+  mov byte ptr [rip+g2016], sil
+  movsxd rsi, dword ptr [rip+g4384]
+  movsx rdi, byte ptr [rip+g1894]
+  add rsi, rdi
+  mov word ptr [rip+g2017], si
+  movsx rsi, word ptr [rip+g1341]
+  movsx rdi, byte ptr [rip+g981]
+  add rsi, rdi
+  mov qword ptr [rip+g2018], rsi
+  movsx rsi, word ptr [rip+g471]
+  movsxd rdi, dword ptr [rip+g3899]
+  add rsi, rdi
+  mov word ptr [rip+g2019], si
+  movsxd rsi, dword ptr [rip+g2010]
+  mov rax, rsi
+.L.return.u201:
+  ret
+.text
+.p2align 4
+.global u202
+u202:
+  movsx rsi, word ptr [rip+g3120]
+  movsx rdi, byte ptr [rip+g3089]
+  add rsi, rdi
+  mov word ptr [rip+g2020], si
+  movsxd rsi, dword ptr [rip+g341]
+  movsx rdi, word ptr [rip+g3370]
+  add rsi, rdi
+  mov byte ptr [rip+g2021], sil
+  movsxd rsi, dword ptr [rip+g1058]
+  movsx rdi, byte ptr [rip+g4746]
+  add rsi, rdi
+  mov dword ptr [rip+g2022], esi
+  movsx rsi, word ptr [rip+g2078]
+  movsx rdi, word ptr [rip+g1927]
+  add rsi, rdi
+  mov qword ptr [rip+g2023], rsi
+  movsx rsi, byte ptr [rip+g2674]
+  movsx rdi, word ptr [rip+g3298]
+  add rsi, rdi
+  mov word ptr [rip+g2024], si
+  movsx rsi, byte ptr [rip+g4241]
+  movsx rdi, word ptr [rip+g325]
+  add rsi, rdi
+  mov byte ptr [rip+g2025], sil
+  mov rsi, qword ptr [rip+g2151]
+  movsx rdi, byte ptr [rip+g564]
+  add rsi, rdi
+  mov qword ptr [rip+g2026], rsi
+  movsxd rsi, dword ptr [rip+g61]
+  movsx rdi, byte ptr [rip+g852]
+  add rsi, rdi
+  mov dword ptr [rip+g2027], esi
+  mov rsi, qword ptr [rip+g2325]
+  movsx rdi, byte ptr [rip+g3727]
+  add rsi, rdi
+  mov dword ptr [rip+g2028], esi
+  movsx rsi, byte ptr [rip+g4096]
+  movsx rdi, word ptr [rip+g431]
+  add rsi, rdi
+  mov word ptr [rip+g2029], si
+  movsx rsi, word ptr [rip+g2020]
+  mov rax, rsi
+.L.return.u202:
+  ret
+.text
+.p2align 4
+.global u203
+u203:
+  movsx rsi, byte ptr [rip+g1983]
+  add rsi, qword ptr [rip+g1467]
+  mov byte ptr [rip+g2030], sil
+  movsx rsi, byte ptr [rip+g338]
+  movsxd rdi, dword ptr [rip+g1001]
+  add rsi, rdi
+  mov byte ptr [rip+g2031], sil
+  movsxd rsi, dword ptr [rip+g2648]
+  movsx rdi, byte ptr [rip+g3055]
+  add rsi, rdi
+  mov qword ptr [rip+g2032], rsi
+  movsx rsi, word ptr [rip+g336]
+  movsx rdi, byte ptr [rip+g1195]
+  add rsi, rdi
+  mov byte ptr [rip+g2033], sil
+  mov rsi, qword ptr [rip+g4406]
+  add rsi, qword ptr [rip+g1544]
+  mov byte ptr [rip+g2034], sil
+  movsxd rsi, dword ptr [rip+g2015]
+  movsxd rdi, dword ptr [rip+g2579]
+  add rsi, rdi
+  mov qword ptr [rip+g2035], rsi
+  mov rsi, qword ptr [rip+g1025]
+  movsx rdi, byte ptr [rip+g623]
+  add rsi, rdi
+  mov dword ptr [rip+g2036], esi
+  mov rsi, qword ptr [rip+g2137]
+  add rsi, qword ptr [rip+g3685]
+  mov byte ptr [rip+g2037], sil
+  mov rsi, qword ptr [rip+g1012]
+  movsx rdi, word ptr [rip+g2121]
+  add rsi, rdi
+  mov qword ptr [rip+g2038], rsi
+  movsxd rsi, dword ptr [rip+g3909]
+  movsx rdi, word ptr [rip+g2343]
+  add rsi, rdi
+  mov byte ptr [rip+g2039], sil
+  movsx rsi, byte ptr [rip+g2030]
+  mov rax, rsi
+.L.return.u203:
+  ret
+.text
+.p2align 4
+.global u204
+u204:
+  mov rsi, qword ptr [rip+g2508]
+  movsxd rdi, dword ptr [rip+g3998]
+  add rsi, rdi
+  mov byte ptr [rip+g2040], sil
+  mov rsi, qword ptr [rip+g3020]
+  movsx rdi, word ptr [rip+g3734]
+  add rsi, rdi
+  mov dword ptr [rip+g2041], esi
+  mov rsi, qword ptr [rip+g3874]
+  movsx rdi, byte ptr [rip+g4129]
+  add rsi, rdi
+  mov byte ptr [rip+g2042], sil
+  movsx rsi, word ptr [rip+g4472]
+  movsx rdi, word ptr [rip+g3722]
+  add rsi, rdi
+  mov word ptr [rip+g2043], si
+  movsx rsi, byte ptr [rip+g4921]
+  movsx rdi, byte ptr [rip+g1946]
+  add rsi, rdi
+  mov byte ptr [rip+g2044], sil
+  movsx rsi, word ptr [rip+g495]
+  add rsi, qword ptr [rip+g4118]
+  mov word ptr [rip+g2045], si
+  movsxd rsi, dword ptr [rip+g22]
+  movsx rdi, word ptr [rip+g2742]
+  add rsi, rdi
+  mov qword ptr [rip+g2046], rsi
+  movsx rsi, byte ptr [rip+g4128]
+  add rsi, qword ptr [rip+g3148]
+  mov word ptr [rip+g2047], si
+  movsx rsi, byte ptr [rip+g4880]
+  movsx rdi, word ptr [rip+g426]
+  add rsi, rdi
+  mov word ptr [rip+g2048], si
+  mov rsi, qword ptr [rip+g107]
+  movsx rdi, word ptr [rip+g594]
+  add rsi, rdi
+  mov byte ptr [rip+g2049], sil
+  movsx rsi, byte ptr [rip+g2040]
+  mov rax, rsi
+.L.return.u204:
+  ret
+.text
+.p2align 4
+.global u205
+u205:
+  movsx rsi, byte ptr [rip+g2157]
+  movsx rdi, word ptr [rip+g3485]
+  add rsi, rdi
+  mov word ptr [rip+g2050], si
+  movsx rsi, byte ptr [rip+g568]
+  add rsi, qword ptr [rip+g243]
+  mov byte ptr [rip+g2051], sil
+  movsxd rsi, dword ptr [rip+g3299]
+  movsxd rdi, dword ptr [rip+g1503]
+  add rsi, rdi
+  mov dword ptr [rip+g2052], esi
+  mov rsi, qword ptr [rip+g4817]
+  movsx rdi, word ptr [rip+g1852]
+  add rsi, rdi
+  mov word ptr [rip+g2053], si
+  movsx rsi, word ptr [rip+g21]
+  movsx rdi, byte ptr [rip+g3507]
+  add rsi, rdi
+  mov dword ptr [rip+g2054], esi
+  movsxd rsi, dword ptr [rip+g3428]
+  movsxd rdi, dword ptr [rip+g921]
+  add rsi, rdi
+  mov byte ptr [rip+g2055], sil
+  movsx rsi, word ptr [rip+g4366]
+  movsx rdi, word ptr [rip+g3057]
+  add rsi, rdi
+  mov word ptr [rip+g2056], si
+  movsx rsi, word ptr [rip+g3932]
+  add rsi, qword ptr [rip+g2863]
+  mov byte ptr [rip+g2057], sil
+  movsx rsi, word ptr [rip+g2208]
+  movsx rdi, word ptr [rip+g4163]
+  add rsi, rdi
+  mov dword ptr [rip+g2058], esi
+  mov rsi, qword ptr [rip+g4696]
+  movsx rdi, byte ptr [rip+g4788]
+  add rsi, rdi
+  mov byte ptr [rip+g2059], sil
+  movsx rsi, word ptr [rip+g2050]
+  mov rax, rsi
+.L.return.u205:
+  ret
+.text
+.p2align 4
+.global u206
+u206:
+  movsx rsi, byte ptr [rip+g1180]
+  movsxd rdi, dword ptr [rip+g2821]
+  add rsi, rdi
+  mov byte ptr [rip+g2060], sil
+  movsx rsi, byte ptr [rip+g3499]
+  movsx rdi, word ptr [rip+g1855]
+  add rsi, rdi
+  mov word ptr [rip+g2061], si
+  mov rsi, qword ptr [rip+g371]
+  movsxd rdi, dword ptr [rip+g2614]
+  add rsi, rdi
+  mov word ptr [rip+g2062], si
+  mov rsi, qword ptr [rip+g4882]
+  movsx rdi, byte ptr [rip+g3085]
+  add rsi, rdi
+  mov dword ptr [rip+g2063], esi
+  movsxd rsi, dword ptr [rip+g491]
+  movsx rdi, byte ptr [rip+g1315]
+  add rsi, rdi
+  mov dword ptr [rip+g2064], esi
+  movsx rsi, word ptr [rip+g3375]
+  add rsi, qword ptr [rip+g2591]
+  mov qword ptr [rip+g2065], rsi
+  movsx rsi, byte ptr [rip+g1668]
+  add rsi, qword ptr [rip+g1012]
+  mov word ptr [rip+g2066], si
+  movsxd rsi, dword ptr [rip+g604]
+  add rsi, qword ptr [rip+g1743]
+  mov byte ptr [rip+g2067], sil
+  movsx rsi, word ptr [rip+g3745]
+  movsxd rdi, dword ptr [rip+g1051]
+  add rsi, rdi
+  mov dword ptr [rip+g2068], esi
+  mov rsi, qword ptr [rip+g1385]
+  movsx rdi, byte ptr [rip+g4323]
+  add rsi, rdi
+  mov byte ptr [rip+g2069], sil
+  movsx rsi, byte ptr [rip+g2060]
+  mov rax, rsi
+.L.return.u206:
+  ret
+.text
+.p2align 4
+.global u207
+u207:
+  movsx rsi, word ptr [rip+g1167]
+  movsx rdi, word ptr [rip+g381]
+  add rsi, rdi
+  mov word ptr [rip+g2070], si
+  mov rsi, qword ptr [rip+g991]
+  add rsi, qword ptr [rip+g2629]
+  mov byte ptr [rip+g2071], sil
+  mov rsi, qword ptr [rip+g2759]
+  movsx rdi, byte ptr [rip+g575]
+  add rsi, rdi
+  mov word ptr [rip+g2072], si
+  movsxd rsi, dword ptr [rip+g1564]
+  movsxd rdi, dword ptr [rip+g2285]
+  add rsi, rdi
+  mov qword ptr [rip+g2073], rsi
+  movsx rsi, word ptr [rip+g1582]
+  add rsi, qword ptr [rip+g3997]
+  mov qword ptr [rip+g2074], rsi
+  movsx rsi, word ptr [rip+g3333]
+  add rsi, qword ptr [rip+g1288]
+  mov byte ptr [rip+g2075], sil
+  mov rsi, qword ptr [rip+g3469]
+  movsx rdi, byte ptr [rip+g497]
+  add rsi, rdi
+  mov word ptr [rip+g2076], si
+  movsx rsi, byte ptr [rip+g3643]
+  add rsi, qword ptr [rip+g386]
+  mov qword ptr [rip+g2077], rsi
+  movsx rsi, byte ptr [rip+g1130]
+  movsx rdi, byte ptr [rip+g3069]
+  add rsi, rdi
+  mov word ptr [rip+g2078], si
+  movsx rsi, word ptr [rip+g1955]
+  movsx rdi, word ptr [rip+g2799]
+  add rsi, rdi
+  mov word ptr [rip+g2079], si
+  movsx rsi, word ptr [rip+g2070]
+  mov rax, rsi
+.L.return.u207:
+  ret
+.text
+.p2align 4
+.global u208
+u208:
+  movsx rsi, byte ptr [rip+g603]
+  movsx rdi, word ptr [rip+g2657]
+  add rsi, rdi
+  mov dword ptr [rip+g2080], esi
+  mov rsi, qword ptr [rip+g3273]
+  movsxd rdi, dword ptr [rip+g4678]
+  add rsi, rdi
+  mov dword ptr [rip+g2081], esi
+  movsxd rsi, dword ptr [rip+g1228]
+  add rsi, qword ptr [rip+g362]
+  mov word ptr [rip+g2082], si
+  mov rsi, qword ptr [rip+g2261]
+  movsx rdi, byte ptr [rip+g2640]
+  add rsi, rdi
+  mov byte ptr [rip+g2083], sil
+  mov rsi, qword ptr [rip+g4938]
+  movsxd rdi, dword ptr [rip+g1126]
+  add rsi, rdi
+  mov qword ptr [rip+g2084], rsi
+  movsx rsi, word ptr [rip+g2970]
+  movsx rdi, byte ptr [rip+g1180]
+  add rsi, rdi
+  mov byte ptr [rip+g2085], sil
+  movsxd rsi, dword ptr [rip+g2825]
+  movsx rdi, word ptr [rip+g1629]
+  add rsi, rdi
+  mov dword ptr [rip+g2086], esi
+  movsx rsi, byte ptr [rip+g3727]
+  movsx rdi, word ptr [rip+g4874]
+  add rsi, rdi
+  mov qword ptr [rip+g2087], rsi
+  movsx rsi, byte ptr [rip+g2193]
+  add rsi, qword ptr [rip+g774]
+  mov byte ptr [rip+g2088], sil
+  movsx rsi, byte ptr [rip+g2404]
+  movsx rdi, word ptr [rip+g2917]
+  add rsi, rdi
+  mov qword ptr [rip+g2089], rsi
+  movsxd rsi, dword ptr [rip+g2080]
+  mov rax, rsi
+.L.return.u208:
+  ret
+.text
+.p2align 4
+.global u209
+u209:
+  movsxd rsi, dword ptr [rip+g3699]
+  movsx rdi, byte ptr [rip+g2397]
+  add rsi, rdi
+  mov qword ptr [rip+g2090], rsi
+  mov rsi, qword ptr [rip+g4107]
+  movsx rdi, byte ptr [rip+g2039]
+  add rsi, rdi
+  mov dword ptr [rip+g2091], esi
+  movsxd rsi, dword ptr [rip+g3898]
+  movsx rdi, word ptr [rip+g4767]
+  add rsi, rdi
+  mov dword ptr [rip+g2092], esi
+  movsx rsi, word ptr [rip+g2306]
+  movsx rdi, byte ptr [rip+g1500]
+  add rsi, rdi
+  mov byte ptr [rip+g2093], sil
+  mov rsi, qword ptr [rip+g3117]
+  movsx rdi, byte ptr [rip+g1605]
+  add rsi, rdi
+  mov qword ptr [rip+g2094], rsi
+  movsxd rsi, dword ptr [rip+g1663]
+  movsxd rdi, dword ptr [rip+g77]
+  add rsi, rdi
+  mov word ptr [rip+g2095], si
+  mov rsi, qword ptr [rip+g1537]
+  add rsi, qword ptr [rip+g4414]
+  mov byte ptr [rip+g2096], sil
+  movsx rsi, byte ptr [rip+g4109]
+  movsxd rdi, dword ptr [rip+g3231]
+  add rsi, rdi
+  mov dword ptr [rip+g2097], esi
+  movsxd rsi, dword ptr [rip+g3939]
+  movsx rdi, word ptr [rip+g4624]
+  add rsi, rdi
+  mov byte ptr [rip+g2098], sil
+  movsx rsi, byte ptr [rip+g1062]
+  add rsi, qword ptr [rip+g3887]
+  mov word ptr [rip+g2099], si
+  mov rax, qword ptr [rip+g2090]
+.L.return.u209:
+  ret
+.text
+.p2align 4
+.global u210
+u210:
+  movsxd rsi, dword ptr [rip+g2737]
+  movsx rdi, byte ptr [rip+g62]
+  add rsi, rdi
+  mov word ptr [rip+g2100], si
+  movsx rsi, byte ptr [rip+g4733]
+  movsx rdi, word ptr [rip+g776]
+  add rsi, rdi
+  mov byte ptr [rip+g2101], sil
+  movsx rsi, byte ptr [rip+g2212]
+  movsx rdi, byte ptr [rip+g2049]
+  add rsi, rdi
+  mov dword ptr [rip+g2102], esi
+  movsx rsi, byte ptr [rip+g4919]
+  movsx rdi, word ptr [rip+g4675]
+  add rsi, rdi
+  mov dword ptr [rip+g2103], esi
+  movsx rsi, word ptr [rip+g2436]
+  movsx rdi, byte ptr [rip+g3672]
+  add rsi, rdi
+  mov dword ptr [rip+g2104], esi
+  movsx rsi, byte ptr [rip+g4627]
+  movsx rdi, byte ptr [rip+g324]
+  add rsi, rdi
+  mov qword ptr [rip+g2105], rsi
+  movsx rsi, byte ptr [rip+g2110]
+  movsx rdi, byte ptr [rip+g2385]
+  add rsi, rdi
+  mov byte ptr [rip+g2106], sil
+  movsxd rsi, dword ptr [rip+g4902]
+  movsx rdi, word ptr [rip+g885]
+  add rsi, rdi
+  mov dword ptr [rip+g2107], esi
+  mov rsi, qword ptr [rip+g3070]
+  movsx rdi, word ptr [rip+g2645]
+  add rsi, rdi
+  mov word ptr [rip+g2108], si
+  mov rsi, qword ptr [rip+g998]
+  add rsi, qword ptr [rip+g1457]
+  mov dword ptr [rip+g2109], esi
+  movsx rsi, word ptr [rip+g2100]
+  mov rax, rsi
+.L.return.u210:
+  ret
+.text
+.p2align 4
+.global u211
+u211:
+  movsx rsi, word ptr [rip+g1965]
+  movsxd rdi, dword ptr [rip+g1386]
+  add rsi, rdi
+  mov byte ptr [rip+g2110], sil
+  movsx rsi, byte ptr [rip+g4601]
+  add rsi, qword ptr [rip+g2124]
+  mov dword ptr [rip+g2111], esi
+  movsx rsi, word ptr [rip+g2847]
+  movsx rdi, byte ptr [rip+g1525]
+  add rsi, rdi
+  mov dword ptr [rip+g2112], esi
+  movsx rsi, word ptr [rip+g3105]
+  movsxd rdi, dword ptr [rip+g3523]
+  add rsi, rdi
+  mov word ptr [rip+g2113], si
+  mov rsi, qword ptr [rip+g2000]
+  movsx rdi, byte ptr [rip+g4701]
+  add rsi, rdi
+  mov byte ptr [rip+g2114], sil
+  movsxd rsi, dword ptr [rip+g2360]
+  movsx rdi, word ptr [rip+g39]
+  add rsi, rdi
+  mov dword ptr [rip+g2115], esi
+  movsxd rsi, dword ptr [rip+g1270]
+  movsxd rdi, dword ptr [rip+g3563]
+  add rsi, rdi
+  mov word ptr [rip+g2116], si
+  movsx rsi, byte ptr [rip+g3881]
+  movsx rdi, byte ptr [rip+g4257]
+  add rsi, rdi
+  mov word ptr [rip+g2117], si
+  movsx rsi, byte ptr [rip+g3463]
+  add rsi, qword ptr [rip+g2787]
+  mov byte ptr [rip+g2118], sil
+  movsx rsi, byte ptr [rip+g1784]
+  movsxd rdi, dword ptr [rip+g2962]
+  add rsi, rdi
+  mov byte ptr [rip+g2119], sil
+  movsx rsi, byte ptr [rip+g2110]
+  mov rax, rsi
+.L.return.u211:
+  ret
+.text
+.p2align 4
+.global u212
+u212:
+  movsx rsi, word ptr [rip+g4142]
+  add rsi, qword ptr [rip+g352]
+  mov qword ptr [rip+g2120], rsi
+  movsxd rsi, dword ptr [rip+g877]
+  add rsi, qword ptr [rip+g2183]
+  mov word ptr [rip+g2121], si
+  mov rsi, qword ptr [rip+g4991]
+  movsxd rdi, dword ptr [rip+g418]
+  add rsi, rdi
+  mov dword ptr [rip+g2122], esi
+  movsx rsi, word ptr [rip+g1202]
+  movsx rdi, word ptr [rip+g3594]
+  add rsi, rdi
+  mov qword ptr [rip+g2123], rsi
+  mov rsi, qword ptr [rip+g653]
+  movsxd rdi, dword ptr [rip+g4436]
+  add rsi, rdi
+  mov qword ptr [rip+g2124], rsi
+  movsx rsi, byte ptr [rip+g3254]
+  movsx rdi, word ptr [rip+g4482]
+  add rsi, rdi
+  mov qword ptr [rip+g2125], rsi
+  movsxd rsi, dword ptr [rip+g2602]
+  movsxd rdi, dword ptr [rip+g1978]
+  add rsi, rdi
+  mov word ptr [rip+g2126], si
+  movsxd rsi, dword ptr [rip+g4059]
+  movsx rdi, byte ptr [rip+g902]
+  add rsi, rdi
+  mov word ptr [rip+g2127], si
+  mov rsi, qword ptr [rip+g369]
+  movsx rdi, word ptr [rip+g2872]
+  add rsi, rdi
+  mov byte ptr [rip+g2128], sil
+  movsx rsi, byte ptr [rip+g3235]
+  add rsi, qword ptr [rip+g2087]
+  mov dword ptr [rip+g2129], esi
+  mov rax, qword ptr [rip+g2120]
+.L.return.u212:
+  ret
+.text
+.p2align 4
+.global u213
+u213:
+  movsx rsi, word ptr [rip+g2265]
+  add rsi, qword ptr [rip+g3393]
+  mov dword ptr [rip+g2130], esi
+  movsx rsi, byte ptr [rip+g3761]
+  movsx rdi, byte ptr [rip+g1074]
+  add rsi, rdi
+  mov word ptr [rip+g2131], si
+  movsx rsi, byte ptr [rip+g2288]
+  movsxd rdi, dword ptr [rip+g4988]
+  add rsi, rdi
+  mov byte ptr [rip+g2132], sil
+  mov rsi, qword ptr [rip+g3425]
+  movsx rdi, byte ptr [rip+g4240]
+  add rsi, rdi
+  mov byte ptr [rip+g2133], sil
+  movsx rsi, word ptr [rip+g1102]
+  movsxd rdi, dword ptr [rip+g3334]
+  add rsi, rdi
+  mov dword ptr [rip+g2134], esi
+  movsx rsi, byte ptr [rip+g3710]
+  movsx rdi, byte ptr [rip+g1217]
+  add rsi, rdi
+  mov word ptr [rip+g2135], si
+  movsx rsi, word ptr [rip+g60]
+  movsx rdi, word ptr [rip+g3592]
+  add rsi, rdi
+  mov word ptr [rip+g2136], si
+  mov rsi, qword ptr [rip+g64]
+  add rsi, qword ptr [rip+g2996]
+  mov qword ptr [rip+g2137], rsi
+  movsx rsi, word ptr [rip+g2802]
+  movsxd rdi, dword ptr [rip+g2812]
+  add rsi, rdi
+  mov byte ptr [rip+g2138], sil
+  movsx rsi, word ptr [rip+g2979]
+  movsx rdi, word ptr [rip+g847]
+  add rsi, rdi
+  mov dword ptr [rip+g2139], esi
+  movsxd rsi, dword ptr [rip+g2130]
+  mov rax, rsi
+.L.return.u213:
+  ret
+.text
+.p2align 4
+.global u214
+u214:
+  mov rsi, qword ptr [rip+g1300]
+  movsx rdi, word ptr [rip+g1329]
+  add rsi, rdi
+  mov word ptr [rip+g2140], si
+  movsx rsi, byte ptr [rip+g119]
+  movsxd rdi, dword ptr [rip+g850]
+  add rsi, rdi
+  mov word ptr [rip+g2141], si
+  mov rsi, qword ptr [rip+g1507]
+  movsxd rdi, dword ptr [rip+g1695]
+  add rsi, rdi
+  mov qword ptr [rip+g2142], rsi
+  mov rsi, qword ptr [rip+g1575]
+  movsx rdi, word ptr [rip+g4015]
+  add rsi, rdi
+  mov dword ptr [rip+g2143], esi
+  movsx rsi, byte ptr [rip+g1064]
+  movsx rdi, byte ptr [rip+g3116]
+  add rsi, rdi
+  mov qword ptr [rip+g2144], rsi
+  movsx rsi, byte ptr [rip+g1525]
+  add rsi, qword ptr [rip+g983]
+  mov word ptr [rip+g2145], si
+  movsxd rsi, dword ptr [rip+g2944]
+  movsxd rdi, dword ptr [rip+g4400]
+  add rsi, rdi
+  mov qword ptr [rip+g2146], rsi
+  movsx rsi, word ptr [rip+g4810]
+  movsx rdi, byte ptr [rip+g1046]
+  add rsi, rdi
+  mov dword ptr [rip+g2147], esi
+  movsx rsi, byte ptr [rip+g3837]
+  movsx rdi, word ptr [rip+g4777]
+  add rsi, rdi
+  mov word ptr [rip+g2148], si
+  movsx rsi, word ptr [rip+g4271]
+  add rsi, qword ptr [rip+g312]
+  mov word ptr [rip+g2149], si
+  movsx rsi, word ptr [rip+g2140]
+  mov rax, rsi
+.L.return.u214:
+  ret
+.text
+.p2align 4
+.global u215
+u215:
+  mov rsi, qword ptr [rip+g1501]
+  movsxd rdi, dword ptr [rip+g1373]
+  add rsi, rdi
+  mov qword ptr [rip+g2150], rsi
+  movsx rsi, byte ptr [rip+g2293]
+  add rsi, qword ptr [rip+g4283]
+  mov qword ptr [rip+g2151], rsi
+  movsx rsi, byte ptr [rip+g3886]
+  add rsi, qword ptr [rip+g3805]
+  mov qword ptr [rip+g2152], rsi
+  movsx rsi, byte ptr [rip+g4754]
+  movsx rdi, word ptr [rip+g4245]
+  add rsi, rdi
+  mov qword ptr [rip+g2153], rsi
+  movsxd rsi, dword ptr [rip+g761]
+  movsx rdi, byte ptr [rip+g864]
+  add rsi, rdi
+  mov dword ptr [rip+g2154], esi
+  movsx rsi, byte ptr [rip+g623]
+  add rsi, qword ptr [rip+g1113]
+  mov dword ptr [rip+g2155], esi
+  mov rsi, qword ptr [rip+g2649]
+  movsx rdi, byte ptr [rip+g2207]
+  add rsi, rdi
+  mov word ptr [rip+g2156], si
+  mov rsi, qword ptr [rip+g863]
+  movsx rdi, word ptr [rip+g3268]
+  add rsi, rdi
+  mov byte ptr [rip+g2157], sil
+  movsx rsi, word ptr [rip+g3883]
+  movsx rdi, byte ptr [rip+g2346]
+  add rsi, rdi
+  mov byte ptr [rip+g2158], sil
+  movsxd rsi, dword ptr [rip+g136]
+  movsxd rdi, dword ptr [rip+g1658]
+  add rsi, rdi
+  mov byte ptr [rip+g2159], sil
+  mov rax, qword ptr [rip+g2150]
+.L.return.u215:
+  ret
+.text
+.p2align 4
+.global u216
+u216:
+  movsx rsi, word ptr [rip+g1167]
+  movsx rdi, byte ptr [rip+g1355]
+  add rsi, rdi
+  mov word ptr [rip+g2160], si
+  movsxd rsi, dword ptr [rip+g506]
+  movsx rdi, byte ptr [rip+g1275]
+  add rsi, rdi
+  mov dword ptr [rip+g2161], esi
+  movsx rsi, byte ptr [rip+g4878]
+  movsxd rdi, dword ptr [rip+g2228]
+  add rsi, rdi
+  mov word ptr [rip+g2162], si
+  movsx rsi, byte ptr [rip+g3072]
+  add rsi, qword ptr [rip+g3147]
+  mov dword ptr [rip+g2163], esi
+  movsx rsi, byte ptr [rip+g4690]
+  movsx rdi, byte ptr [rip+g532]
+  add rsi, rdi
+  mov dword ptr [rip+g2164], esi
+  movsx rsi, byte ptr [rip+g3761]
+  movsx rdi, byte ptr [rip+g3545]
+  add rsi, rdi
+  mov qword ptr [rip+g2165], rsi
+  mov rsi, qword ptr [rip+g3741]
+  movsx rdi, byte ptr [rip+g3811]
+  add rsi, rdi
+  mov word ptr [rip+g2166], si
+  movsx rsi, word ptr [rip+g1985]
+  movsx rdi, byte ptr [rip+g4690]
+  add rsi, rdi
+  mov byte ptr [rip+g2167], sil
+  mov rsi, qword ptr [rip+g707]
+  add rsi, qword ptr [rip+g556]
+  mov word ptr [rip+g2168], si
+  movsx rsi, word ptr [rip+g4828]
+  movsxd rdi, dword ptr [rip+g2410]
+  add rsi, rdi
+  mov byte ptr [rip+g2169], sil
+  movsx rsi, word ptr [rip+g2160]
+  mov rax, rsi
+.L.return.u216:
+  ret
+.text
+.p2align 4
+.global u217
+u217:
+  mov rsi, qword ptr [rip+g4007]
+  movsx rdi, word ptr [rip+g3140]
+  add rsi, rdi
+  mov word ptr [rip+g2170], si
+  movsx rsi, word ptr [rip+g1239]
+  movsx rdi, word ptr [rip+g3861]
+  add rsi, rdi
+  mov dword ptr [rip+g2171], esi
+  movsx rsi, byte ptr [rip+g3892]
+  movsx rdi, word ptr [rip+g3856]
+  add rsi, rdi
+  mov byte ptr [rip+g2172], sil
+  movsx rsi, word ptr [rip+g445]
+  movsx rdi, word ptr [rip+g3006]
+  add rsi, rdi
+  mov byte ptr [rip+g2173], sil
+  mov rsi, qword ptr [rip+g3949]
+  movsx rdi, word ptr [rip+g1702]
+  add rsi, rdi
+  mov byte ptr [rip+g2174], sil
+  mov rsi, qword ptr [rip+g2922]
+  movsx rdi, byte ptr [rip+g2551]
+  add rsi, rdi
+  mov qword ptr [rip+g2175], rsi
+  movsx rsi, word ptr [rip+g1903]
+  movsxd rdi, dword ptr [rip+g3313]
+  add rsi, rdi
+  mov dword ptr [rip+g2176], esi
+  movsxd rsi, dword ptr [rip+g1701]
+  movsx rdi, word ptr [rip+g465]
+  add rsi, rdi
+  mov qword ptr [rip+g2177], rsi
+  movsx rsi, word ptr [rip+g2788]
+  add rsi, qword ptr [rip+g733]
+  mov byte ptr [rip+g2178], sil
+  movsx rsi, byte ptr [rip+g2291]
+  movsxd rdi, dword ptr [rip+g4534]
+  add rsi, rdi
+  mov word ptr [rip+g2179], si
+  movsx rsi, word ptr [rip+g2170]
+  mov rax, rsi
+.L.return.u217:
+  ret
+.text
+.p2align 4
+.global u218
+u218:
+  movsx rsi, word ptr [rip+g3895]
+  movsx rdi, byte ptr [rip+g931]
+  add rsi, rdi
+  mov dword ptr [rip+g2180], esi
+  movsx rsi, word ptr [rip+g1447]
+  movsx rdi, byte ptr [rip+g2173]
+  add rsi, rdi
+  mov dword ptr [rip+g2181], esi
+  mov rsi, qword ptr [rip+g3805]
+  movsxd rdi, dword ptr [rip+g751]
+  add rsi, rdi
+  mov qword ptr [rip+g2182], rsi
+  movsx rsi, word ptr [rip+g4532]
+  add rsi, qword ptr [rip+g4751]
+  mov qword ptr [rip+g2183], rsi
+  movsx rsi, byte ptr [rip+g4838]
+  movsx rdi, byte ptr [rip+g1313]
+  add rsi, rdi
+  mov byte ptr [rip+g2184], sil
+  movsx rsi, word ptr [rip+g3745]
+  add rsi, qword ptr [rip+g4225]
+  mov dword ptr [rip+g2185], esi
+  movsxd rsi, dword ptr [rip+g529]
+  add rsi, qword ptr [rip+g630]
+  mov dword ptr [rip+g2186], esi
+  movsxd rsi, dword ptr [rip+g3365]
+  movsx rdi, word ptr [rip+g4131]
+  add rsi, rdi
+  mov word ptr [rip+g2187], si
+  movsxd rsi, dword ptr [rip+g3323]
+  movsx rdi, word ptr [rip+g1702]
+  add rsi, rdi
+  mov qword ptr [rip+g2188], rsi
+  movsx rsi, byte ptr [rip+g3274]
+  add rsi, qword ptr [rip+g3063]
+  mov qword ptr [rip+g2189], rsi
+  movsxd rsi, dword ptr [rip+g2180]
+  mov rax, rsi
+.L.return.u218:
+  ret
+.text
+.p2align 4
+.global u219
+u219:
+  movsxd rsi, dword ptr [rip+g1409]
+  movsx rdi, word ptr [rip+g2568]
+  add rsi, rdi
+  mov byte ptr [rip+g2190], sil
+  movsxd rsi, dword ptr [rip+g93]
+  movsx rdi, word ptr [rip+g3596]
+  add rsi, rdi
+  mov dword ptr [rip+g2191], esi
+  mov rsi, qword ptr [rip+g4089]
+  movsx rdi, byte ptr [rip+g2607]
+  add rsi, rdi
+  mov byte ptr [rip+g2192], sil
+  movsx rsi, word ptr [rip+g1523]
+  movsxd rdi, dword ptr [rip+g2410]
+  add rsi, rdi
+  mov byte ptr [rip+g2193], sil
+  mov rsi, qword ptr [rip+g4052]
+  movsx rdi, word ptr [rip+g848]
+  add rsi, rdi
+  mov byte ptr [rip+g2194], sil
+  movsx rsi, word ptr [rip+g3261]
+  movsx rdi, word ptr [rip+g4819]
+  add rsi, rdi
+  mov byte ptr [rip+g2195], sil
+  movsxd rsi, dword ptr [rip+g1644]
+  movsxd rdi, dword ptr [rip+g1768]
+  add rsi, rdi
+  mov dword ptr [rip+g2196], esi
+  movsx rsi, word ptr [rip+g4617]
+  movsx rdi, byte ptr [rip+g722]
+  add rsi, rdi
+  mov word ptr [rip+g2197], si
+  mov rsi, qword ptr [rip+g3440]
+  movsxd rdi, dword ptr [rip+g1931]
+  add rsi, rdi
+  mov qword ptr [rip+g2198], rsi
+  mov rsi, qword ptr [rip+g3540]
+  add rsi, qword ptr [rip+g187]
+  mov byte ptr [rip+g2199], sil
+  movsx rsi, byte ptr [rip+g2190]
+  mov rax, rsi
+.L.return.u219:
+  ret
+.text
+.p2align 4
+.global u220
+u220:
+  mov rsi, qword ptr [rip+g1467]
+  add rsi, qword ptr [rip+g4897]
+  mov byte ptr [rip+g2200], sil
+  movsxd rsi, dword ptr [rip+g4280]
+  add rsi, qword ptr [rip+g2125]
+  mov byte ptr [rip+g2201], sil
+  movsx rsi, byte ptr [rip+g4625]
+  movsx rdi, word ptr [rip+g1913]
+  add rsi, rdi
+  mov word ptr [rip+g2202], si
+  movsxd rsi, dword ptr [rip+g3733]
+  movsx rdi, byte ptr [rip+g4324]
+  add rsi, rdi
+  mov dword ptr [rip+g2203], esi
+  movsx rsi, byte ptr [rip+g2975]
+  movsxd rdi, dword ptr [rip+g3179]
+  add rsi, rdi
+  mov qword ptr [rip+g2204], rsi
+  movsx rsi, byte ptr [rip+g4162]
+  movsx rdi, word ptr [rip+g4589]
+  add rsi, rdi
+  mov byte ptr [rip+g2205], sil
+  movsxd rsi, dword ptr [rip+g3297]
+  movsx rdi, byte ptr [rip+g4891]
+  add rsi, rdi
+  mov dword ptr [rip+g2206], esi
+  mov rsi, qword ptr [rip+g733]
+  add rsi, qword ptr [rip+g1155]
+  mov byte ptr [rip+g2207], sil
+  movsx rsi, byte ptr [rip+g1052]
+  movsx rdi, byte ptr [rip+g3320]
+  add rsi, rdi
+  mov word ptr [rip+g2208], si
+  movsx rsi, word ptr [rip+g4812]
+  movsx rdi, byte ptr [rip+g447]
+  add rsi, rdi
+  mov dword ptr [rip+g2209], esi
+  movsx rsi, byte ptr [rip+g2200]
+  mov rax, rsi
+.L.return.u220:
+  ret
+.text
+.p2align 4
+.global u221
+u221:
+  movsxd rsi, dword ptr [rip+g4928]
+  movsxd rdi, dword ptr [rip+g1159]
+  add rsi, rdi
+  mov qword ptr [rip+g2210], rsi
+  mov rsi, qword ptr [rip+g4651]
+  movsx rdi, byte ptr [rip+g1762]
+  add rsi, rdi
+  mov byte ptr [rip+g2211], sil
+  mov rsi, qword ptr [rip+g3000]
+  movsx rdi, word ptr [rip+g1210]
+  add rsi, rdi
+  mov byte ptr [rip+g2212], sil
+  movsx rsi, byte ptr [rip+g4241]
+  movsx rdi, byte ptr [rip+g399]
+  add rsi, rdi
+  mov qword ptr [rip+g2213], rsi
+  movsxd rsi, dword ptr [rip+g1992]
+  movsx rdi, byte ptr [rip+g2364]
+  add rsi, rdi
+  mov byte ptr [rip+g2214], sil
+  movsxd rsi, dword ptr [rip+g3297]
+  movsxd rdi, dword ptr [rip+g4157]
+  add rsi, rdi
+  mov word ptr [rip+g2215], si
+  mov rsi, qword ptr [rip+g606]
+  movsx rdi, byte ptr [rip+g3754]
+  add rsi, rdi
+  mov byte ptr [rip+g2216], sil
+  movsxd rsi, dword ptr [rip+g1270]
+  movsxd rdi, dword ptr [rip+g2771]
+  add rsi, rdi
+  mov dword ptr [rip+g2217], esi
+  movsxd rsi, dword ptr [rip+g2762]
+  movsx rdi, word ptr [rip+g1341]
+  add rsi, rdi
+  mov word ptr [rip+g2218], si
+  mov rsi, qword ptr [rip+g3107]
+  add rsi, qword ptr [rip+g593]
+  mov dword ptr [rip+g2219], esi
+  mov rax, qword ptr [rip+g2210]
+.L.return.u221:
+  ret
+.text
+.p2align 4
+.global u222
+u222:
+  movsx rsi, word ptr [rip+g3751]
+  add rsi, qword ptr [rip+g356]
+  mov qword ptr [rip+g2220], rsi
+  movsx rsi, word ptr [rip+g1854]
+  movsxd rdi, dword ptr [rip+g2913]
+  add rsi, rdi
+  mov qword ptr [rip+g2221], rsi
+  mov rsi, qword ptr [rip+g1984]
+  movsxd rdi, dword ptr [rip+g3996]
+  add rsi, rdi
+  mov word ptr [rip+g2222], si
+  movsxd rsi, dword ptr [rip+g34]
+  movsx rdi, word ptr [rip+g650]
+  add rsi, rdi
+  mov byte ptr [rip+g2223], sil
+  movsx rsi, word ptr [rip+g2605]
+  movsx rdi, word ptr [rip+g4914]
+  add rsi, rdi
+  mov dword ptr [rip+g2224], esi
+  movsxd rsi, dword ptr [rip+g1586]
+  movsx rdi, byte ptr [rip+g4487]
+  add rsi, rdi
+  mov byte ptr [rip+g2225], sil
+  movsx rsi, byte ptr [rip+g3686]
+  add rsi, qword ptr [rip+g2814]
+  mov qword ptr [rip+g2226], rsi
+  movsxd rsi, dword ptr [rip+g1949]
+  movsx rdi, byte ptr [rip+g290]
+  add rsi, rdi
+  mov dword ptr [rip+g2227], esi
+  mov rsi, qword ptr [rip+g4977]
+  movsx rdi, byte ptr [rip+g1037]
+  add rsi, rdi
+  mov dword ptr [rip+g2228], esi
+  movsx rsi, word ptr [rip+g4004]
+  movsxd rdi, dword ptr [rip+g1462]
+  add rsi, rdi
+  mov dword ptr [rip+g2229], esi
+  mov rax, qword ptr [rip+g2220]
+.L.return.u222:
+  ret
+.text
+.p2align 4
+.global u223
+u223:
+  movsx rsi, word ptr [rip+g3370]
+  movsx rdi, word ptr [rip+g2070]
+  add rsi, rdi
+  mov word ptr [rip+g2230], si
+  mov rsi, qword ptr [rip+g2516]
+  movsx rdi, word ptr [rip+g4514]
+  add rsi, rdi
+  mov dword ptr [rip+g2231], esi
+  movsxd rsi, dword ptr [rip+g1349]
+  movsxd rdi, dword ptr [rip+g3836]
+  add rsi, rdi
+  mov word ptr [rip+g2232], si
+  movsx rsi, byte ptr [rip+g972]
+  add rsi, qword ptr [rip+g2308]
+  mov dword ptr [rip+g2233], esi
+  movsx rsi, byte ptr [rip+g2599]
+  add rsi, qword ptr [rip+g4350]
+  mov byte ptr [rip+g2234], sil
+  movsx rsi, byte ptr [rip+g3950]
+  movsxd rdi, dword ptr [rip+g4796]
+  add rsi, rdi
+  mov word ptr [rip+g2235], si
+  movsxd rsi, dword ptr [rip+g3041]
+  add rsi, qword ptr [rip+g3510]
+  mov word ptr [rip+g2236], si
+  movsxd rsi, dword ptr [rip+g869]
+  movsx rdi, word ptr [rip+g3010]
+  add rsi, rdi
+  mov dword ptr [rip+g2237], esi
+  movsx rsi, word ptr [rip+g2179]
+  movsxd rdi, dword ptr [rip+g1514]
+  add rsi, rdi
+  mov byte ptr [rip+g2238], sil
+  movsx rsi, byte ptr [rip+g987]
+  movsxd rdi, dword ptr [rip+g1926]
+  add rsi, rdi
+  mov qword ptr [rip+g2239], rsi
+  movsx rsi, word ptr [rip+g2230]
+  mov rax, rsi
+.L.return.u223:
+  ret
+.text
+.p2align 4
+.global u224
+u224:
+  movsxd rsi, dword ptr [rip+g4641]
+  movsx rdi, word ptr [rip+g4548]
+  add rsi, rdi
+  mov dword ptr [rip+g2240], esi
+  movsxd rsi, dword ptr [rip+g1068]
+  movsx rdi, byte ptr [rip+g986]
+  add rsi, rdi
+  mov byte ptr [rip+g2241], sil
+  movsx rsi, word ptr [rip+g4727]
+  movsx rdi, byte ptr [rip+g2075]
+  add rsi, rdi
+  mov dword ptr [rip+g2242], esi
+  mov rsi, qword ptr [rip+g316]
+  movsx rdi, word ptr [rip+g2726]
+  add rsi, rdi
+  mov byte ptr [rip+g2243], sil
+  movsx rsi, word ptr [rip+g4152]
+  movsx rdi, byte ptr [rip+g3176]
+  add rsi, rdi
+  mov byte ptr [rip+g2244], sil
+  mov rsi, qword ptr [rip+g355]
+  movsxd rdi, dword ptr [rip+g1051]
+  add rsi, rdi
+  mov qword ptr [rip+g2245], rsi
+  movsxd rsi, dword ptr [rip+g3694]
+  movsx rdi, byte ptr [rip+g1762]
+  add rsi, rdi
+  mov dword ptr [rip+g2246], esi
+  movsx rsi, byte ptr [rip+g2238]
+  movsx rdi, byte ptr [rip+g2701]
+  add rsi, rdi
+  mov qword ptr [rip+g2247], rsi
+  movsxd rsi, dword ptr [rip+g2449]
+  movsx rdi, word ptr [rip+g2514]
+  add rsi, rdi
+  mov qword ptr [rip+g2248], rsi
+  mov rsi, qword ptr [rip+g1911]
+  movsxd rdi, dword ptr [rip+g1244]
+  add rsi, rdi
+  mov byte ptr [rip+g2249], sil
+  movsxd rsi, dword ptr [rip+g2240]
+  mov rax, rsi
+.L.return.u224:
+  ret
+.text
+.p2align 4
+.global u225
+u225:
+  movsx rsi, word ptr [rip+g3327]
+  movsxd rdi, dword ptr [rip+g2711]
+  add rsi, rdi
+  mov dword ptr [rip+g2250], esi
+  movsx rsi, word ptr [rip+g4409]
+  movsxd rdi, dword ptr [rip+g104]
+  add rsi, rdi
+  mov word ptr [rip+g2251], si
+  movsx rsi, word ptr [rip+g2474]
+  movsxd rdi, dword ptr [rip+g4036]
+  add rsi, rdi
+  mov word ptr [rip+g2252], si
+  mov rsi, qword ptr [rip+g1305]
+  movsx rdi, byte ptr [rip+g1918]
+  add rsi, rdi
+  mov qword ptr [rip+g2253], rsi
+  mov rsi, qword ptr [rip+g3347]
+  add rsi, qword ptr [rip+g277]
+  mov byte ptr [rip+g2254], sil
+  movsx rsi, word ptr [rip+g4372]
+  movsx rdi, word ptr [rip+g4091]
+  add rsi, rdi
+  mov byte ptr [rip+g2255], sil
+  mov rsi, qword ptr [rip+g3079]
+  movsx rdi, byte ptr [rip+g835]
+  add rsi, rdi
+  mov qword ptr [rip+g2256], rsi
+  movsx rsi, word ptr [rip+g1817]
+  movsx rdi, word ptr [rip+g4561]
+  add rsi, rdi
+  mov word ptr [rip+g2257], si
+  movsx rsi, byte ptr [rip+g4993]
+  movsxd rdi, dword ptr [rip+g2231]
+  add rsi, rdi
+  mov dword ptr [rip+g2258], esi
+  movsx rsi, word ptr [rip+g4906]
+  movsxd rdi, dword ptr [rip+g3855]
+  add rsi, rdi
+  mov byte ptr [rip+g2259], sil
+  movsxd rsi, dword ptr [rip+g2250]
+  mov rax, rsi
+.L.return.u225:
+  ret
+.text
+.p2align 4
+.global u226
+u226:
+  movsx rsi, byte ptr [rip+g3967]
+  movsx rdi, word ptr [rip+g1812]
+  add rsi, rdi
+  mov byte ptr [rip+g2260], sil
+  movsx rsi, word ptr [rip+g4402]
+  movsx rdi, byte ptr [rip+g4237]
+  add rsi, rdi
+  mov qword ptr [rip+g2261], rsi
+  mov rsi, qword ptr [rip+g4724]
+  movsxd rdi, dword ptr [rip+g2250]
+  add rsi, rdi
+  mov byte ptr [rip+g2262], sil
+  movsx rsi, word ptr [rip+g2514]
+  movsx rdi, byte ptr [rip+g1656]
+  add rsi, rdi
+  mov dword ptr [rip+g2263], esi
+  mov rsi, qword ptr [rip+g3860]
+  movsx rdi, word ptr [rip+g798]
+  add rsi, rdi
+  mov word ptr [rip+g2264], si
+  movsx rsi, word ptr [rip+g1389]
+  add rsi, qword ptr [rip+g3479]
+  mov word ptr [rip+g2265], si
+  movsxd rsi, dword ptr [rip+g4786]
+  add rsi, qword ptr [rip+g1427]
+  mov word ptr [rip+g2266], si
+  movsxd rsi, dword ptr [rip+g3771]
+  movsx rdi, byte ptr [rip+g2623]
+  add rsi, rdi
+  mov word ptr [rip+g2267], si
+  movsx rsi, word ptr [rip+g3641]
+  add rsi, qword ptr [rip+g4101]
+  mov dword ptr [rip+g2268], esi
+  mov rsi, qword ptr [rip+g3361]
+  add rsi, qword ptr [rip+g4731]
+  mov dword ptr [rip+g2269], esi
+  movsx rsi, byte ptr [rip+g2260]
+  mov rax, rsi
+.L.return.u226:
+  ret
+.text
+.p2align 4
+.global u227
+u227:
+  mov rsi, qword ptr [rip+g2998]
+  add rsi, qword ptr [rip+g2522]
+  mov byte ptr [rip+g2270], sil
+  mov rsi, qword ptr [rip+g571]
+  movsx rdi, byte ptr [rip+g2412]
+  add rsi, rdi
+  mov word ptr [rip+g2271], si
+  movsxd rsi, dword ptr [rip+g3334]
+  movsx rdi, byte ptr [rip+g2975]
+  add rsi, rdi
+  mov qword ptr [rip+g2272], rsi
+  movsxd rsi, dword ptr [rip+g898]
+  movsxd rdi, dword ptr [rip+g1358]
+  add rsi, rdi
+  mov word ptr [rip+g2273], si
+  mov rsi, qword ptr [rip+g4502]
+  add rsi, qword ptr [rip+g422]
+  mov word ptr [rip+g2274], si
+  movsx rsi, word ptr [rip+g2140]
+  movsx rdi, word ptr [rip+g1257]
+  add rsi, rdi
+  mov dword ptr [rip+g2275], esi
+  movsx rsi, byte ptr [rip+g4060]
+  movsx rdi, byte ptr [rip+g3794]
+  add rsi, rdi
+  mov qword ptr [rip+g2276], rsi
+  mov rsi, qword ptr [rip+g2150]
+  movsx rdi, byte ptr [rip+g4160]
+  add rsi, rdi
+  mov word ptr [rip+g2277], si
+  movsx rsi, word ptr [rip+g1210]
+  add rsi, qword ptr [rip+g4118]
+  mov byte ptr [rip+g2278], sil
+  movsx rsi, word ptr [rip+g3244]
+  movsxd rdi, dword ptr [rip+g4816]
+  add rsi, rdi
+  mov byte ptr [rip+g2279], sil
+  movsx rsi, byte ptr [rip+g2270]
+  mov rax, rsi
+.L.return.u227:
+  ret
+.text
+.p2align 4
+.global u228
+u228:
+  mov rsi, qword ptr [rip+g1895]
+  add rsi, qword ptr [rip+g3805]
+  mov qword ptr [rip+g2280], rsi
+  movsx rsi, word ptr [rip+g4675]
+  movsx rdi, byte ptr [rip+g3495]
+  add rsi, rdi
+  mov word ptr [rip+g2281], si
+  movsx rsi, byte ptr [rip+g3013]
+  movsx rdi, byte ptr [rip+g623]
+  add rsi, rdi
+  mov byte ptr [rip+g2282], sil
+  mov rsi, qword ptr [rip+g2362]
+  movsx rdi, byte ptr [rip+g4547]
+  add rsi, rdi
+  mov qword ptr [rip+g2283], rsi
+  movsx rsi, byte ptr [rip+g2398]
+  movsx rdi, word ptr [rip+g1486]
+  add rsi, rdi
+  mov byte ptr [rip+g2284], sil
+  movsx rsi, word ptr [rip+g1757]
+  movsx rdi, byte ptr [rip+g3978]
+  add rsi, rdi
+  mov dword ptr [rip+g2285], esi
+  movsxd rsi, dword ptr [rip+g1068]
+  add rsi, qword ptr [rip+g371]
+  mov byte ptr [rip+g2286], sil
+  movsx rsi, word ptr [rip+g2126]
+  add rsi, qword ptr [rip+g2552]
+  mov dword ptr [rip+g2287], esi
+  movsx rsi, byte ptr [rip+g1635]
+  movsx rdi, word ptr [rip+g2471]
+  add rsi, rdi
+  mov byte ptr [rip+g2288], sil
+  movsx rsi, word ptr [rip+g1971]
+  movsxd rdi, dword ptr [rip+g2242]
+  add rsi, rdi
+  mov byte ptr [rip+g2289], sil
+  mov rax, qword ptr [rip+g2280]
+.L.return.u228:
+  ret
+.text
+.p2align 4
+.global u229
+u229:
+  movsxd rsi, dword ptr [rip+g2331]
+  movsx rdi, byte ptr [rip+g4789]
+  add rsi, rdi
+  mov word ptr [rip+g2290], si
+  movsx rsi, word ptr [rip+g4062]
+  movsx rdi, byte ptr [rip+g3756]
+  add rsi, rdi
+  mov byte ptr [rip+g2291], sil
+  movsxd rsi, dword ptr [rip+g3608]
+  movsx rdi, byte ptr [rip+g3488]
+  add rsi, rdi
+  mov dword ptr [rip+g2292], esi
+  movsx rsi, word ptr [rip+g2271]
+  movsx rdi, word ptr [rip+g2565]
+  add rsi, rdi
+  mov byte ptr [rip+g2293], sil
+  movsx rsi, word ptr [rip+g1589]
+  movsx rdi, byte ptr [rip+g2530]
+  add rsi, rdi
+  mov qword ptr [rip+g2294], rsi
+  movsxd rsi, dword ptr [rip+g390]
+  movsx rdi, byte ptr [rip+g209]
+  add rsi, rdi
+  mov byte ptr [rip+g2295], sil
+  movsx rsi, word ptr [rip+g168]
+  add rsi, qword ptr [rip+g3851]
+  mov qword ptr [rip+g2296], rsi
+  movsx rsi, byte ptr [rip+g276]
+  movsx rdi, byte ptr [rip+g852]
+  add rsi, rdi
+  mov word ptr [rip+g2297], si
+  movsxd rsi, dword ptr [rip+g4939]
+  movsx rdi, byte ptr [rip+g1374]
+  add rsi, rdi
+  mov dword ptr [rip+g2298], esi
+  mov rsi, qword ptr [rip+g3121]
+  movsx rdi, byte ptr [rip+g1412]
+  add rsi, rdi
+  mov byte ptr [rip+g2299], sil
+  movsx rsi, word ptr [rip+g2290]
+  mov rax, rsi
+.L.return.u229:
+  ret
+.text
+.p2align 4
+.global u230
+u230:
+  movsx rsi, byte ptr [rip+g764]
+  movsx rdi, byte ptr [rip+g2034]
+  add rsi, rdi
+  mov byte ptr [rip+g2300], sil
+  movsxd rsi, dword ptr [rip+g1270]
+  add rsi, qword ptr [rip+g1283]
+  mov dword ptr [rip+g2301], esi
+  movsxd rsi, dword ptr [rip+g1264]
+  movsx rdi, word ptr [rip+g1184]
+  add rsi, rdi
+  mov byte ptr [rip+g2302], sil
+  movsxd rsi, dword ptr [rip+g1358]
+  movsx rdi, byte ptr [rip+g2460]
+  add rsi, rdi
+  mov byte ptr [rip+g2303], sil
+  mov rsi, qword ptr [rip+g2123]
+  movsx rdi, word ptr [rip+g3433]
+  add rsi, rdi
+  mov dword ptr [rip+g2304], esi
+  mov rsi, qword ptr [rip+g2152]
+  movsxd rdi, dword ptr [rip+g966]
+  add rsi, rdi
+  mov byte ptr [rip+g2305], sil
+  mov rsi, qword ptr [rip+g918]
+  movsx rdi, byte ptr [rip+g73]
+  add rsi, rdi
+  mov word ptr [rip+g2306], si
+  movsx rsi, byte ptr [rip+g1452]
+  movsx rdi, byte ptr [rip+g981]
+  add rsi, rdi
+  mov word ptr [rip+g2307], si
+  movsx rsi, word ptr [rip+g266]
+  add rsi, qword ptr [rip+g539]
+  mov qword ptr [rip+g2308], rsi
+  mov rsi, qword ptr [rip+g856]
+  movsxd rdi, dword ptr [rip+g4475]
+  add rsi, rdi
+  mov qword ptr [rip+g2309], rsi
+  movsx rsi, byte ptr [rip+g2300]
+  mov rax, rsi
+.L.return.u230:
+  ret
+.text
+.p2align 4
+.global u231
+u231:
+  mov rsi, qword ptr [rip+g3141]
+  movsx rdi, word ptr [rip+g105]
+  add rsi, rdi
+  mov byte ptr [rip+g2310], sil
+  movsx rsi, word ptr [rip+g4396]
+  movsx rdi, byte ptr [rip+g1019]
+  add rsi, rdi
+  mov byte ptr [rip+g2311], sil
+  mov rsi, qword ptr [rip+g659]
+  movsxd rdi, dword ptr [rip+g1403]
+  add rsi, rdi
+  mov qword ptr [rip+g2312], rsi
+  movsxd rsi, dword ptr [rip+g3337]
+  add rsi, qword ptr [rip+g2210]
+  mov word ptr [rip+g2313], si
+  mov rsi, qword ptr [rip+g659]
+  movsxd rdi, dword ptr [rip+g2161]
+  add rsi, rdi
+  mov byte ptr [rip+g2314], sil
+  movsxd rsi, dword ptr [rip+g4453]
+  movsxd rdi, dword ptr [rip+g2700]
+  add rsi, rdi
+  mov qword ptr [rip+g2315], rsi
+  mov rsi, qword ptr [rip+g464]
+  movsx rdi, byte ptr [rip+g4869]
+  add rsi, rdi
+  mov qword ptr [rip+g2316], rsi
+  mov rsi, qword ptr [rip+g801]
+  movsx rdi, word ptr [rip+g1875]
+  add rsi, rdi
+  mov word ptr [rip+g2317], si
+  movsxd rsi, dword ptr [rip+g2360]
+  movsxd rdi, dword ptr [rip+g880]
+  add rsi, rdi
+  mov word ptr [rip+g2318], si
+  movsx rsi, word ptr [rip+g4900]
+  add rsi, qword ptr [rip+g1572]
+  mov word ptr [rip+g2319], si
+  movsx rsi, byte ptr [rip+g2310]
+  mov rax, rsi
+.L.return.u231:
+  ret
+.text
+.p2align 4
+.global u232
+u232:
+  mov rsi, qword ptr [rip+g3557]
+  movsxd rdi, dword ptr [rip+g419]
+  add rsi, rdi
+  mov word ptr [rip+g2320], si
+  movsx rsi, word ptr [rip+g494]
+  movsxd rdi, dword ptr [rip+g4354]
+  add rsi, rdi
+  mov dword ptr [rip+g2321], esi
+  movsx rsi, word ptr [rip+g3101]
+  movsx rdi, byte ptr [rip+g2067]
+  add rsi, rdi
+  mov dword ptr [rip+g2322], esi
+  movsx rsi, word ptr [rip+g2598]
+  movsxd rdi, dword ptr [rip+g4173]
+  add rsi, rdi
+  mov word ptr [rip+g2323], si
+  mov rsi, qword ptr [rip+g1743]
+  movsx rdi, byte ptr [rip+g2536]
+  add rsi, rdi
+  mov dword ptr [rip+g2324], esi
+  movsxd rsi, dword ptr [rip+g4419]
+  movsx rdi, word ptr [rip+g4795]
+  add rsi, rdi
+  mov qword ptr [rip+g2325], rsi
+  movsx rsi, byte ptr [rip+g4986]
+  movsxd rdi, dword ptr [rip+g1381]
+  add rsi, rdi
+  mov word ptr [rip+g2326], si
+  movsx rsi, byte ptr [rip+g3449]
+  add rsi, qword ptr [rip+g601]
+  mov word ptr [rip+g2327], si
+  movsx rsi, byte ptr [rip+g1850]
+  movsxd rdi, dword ptr [rip+g2915]
+  add rsi, rdi
+  mov byte ptr [rip+g2328], sil
+  mov rsi, qword ptr [rip+g4492]
+  add rsi, qword ptr [rip+g3860]
+  mov qword ptr [rip+g2329], rsi
+  movsx rsi, word ptr [rip+g2320]
+  mov rax, rsi
+.L.return.u232:
+  ret
+.text
+.p2align 4
+.global u233
+u233:
+  movsxd rsi, dword ptr [rip+g4726]
+  movsx rdi, byte ptr [rip+g4355]
+  add rsi, rdi
+  mov byte ptr [rip+g2330], sil
+  movsxd rsi, dword ptr [rip+g3352]
+  add rsi, qword ptr [rip+g4319]
+  mov dword ptr [rip+g2331], esi
+  mov rsi, qword ptr [rip+g3783]
+  movsxd rdi, dword ptr [rip+g186]
+  add rsi, rdi
+  mov word ptr [rip+g2332], si
+  mov rsi, qword ptr [rip+g81]
+  movsx rdi, word ptr [rip+g731]
+  add rsi, rdi
+  mov word ptr [rip+g2333], si
+  movsx rsi, byte ptr [rip+g2686]
+  add rsi, qword ptr [rip+g2871]
+  mov dword ptr [rip+g2334], esi
+  movsx rsi, word ptr [rip+g169]
+  movsxd rdi, dword ptr [rip+g1254]
+  add rsi, rdi
+  mov qword ptr [rip+g2335], rsi
+  movsxd rsi, dword ptr [rip+g3352]
+  movsx rdi, byte ptr [rip+g67]
+  add rsi, rdi
+  mov word ptr [rip+g2336], si
+  movsx rsi, byte ptr [rip+g1187]
+  movsx rdi, byte ptr [rip+g46]
+  add rsi, rdi
+  mov byte ptr [rip+g2337], sil
+  movsxd rsi, dword ptr [rip+g448]
+  movsx rdi, word ptr [rip+g4794]
+  add rsi, rdi
+  mov byte ptr [rip+g2338], sil
+  movsx rsi, word ptr [rip+g487]
+  movsx rdi, word ptr [rip+g2252]
+  add rsi, rdi
+  mov dword ptr [rip+g2339], esi
+  movsx rsi, byte ptr [rip+g2330]
+  mov rax, rsi
+.L.return.u233:
+  ret
+.text
+.p2align 4
+.global u234
+u234:
+  movsxd rsi, dword ptr [rip+g3637]
+  movsx rdi, byte ptr [rip+g2110]
+  add rsi, rdi
+  mov byte ptr [rip+g2340], sil
+  mov rsi, qword ptr [rip+g4564]
+  movsxd rdi, dword ptr [rip+g3627]
+  add rsi, rdi
+  mov word ptr [rip+g2341], si
+  movsxd rsi, dword ptr [rip+g4961]
+  add rsi, qword ptr [rip+g1905]
+  mov dword ptr [rip+g2342], esi
+  movsx rsi, byte ptr [rip+g4788]
+  movsx rdi, word ptr [rip+g1875]
+  add rsi, rdi
+  mov word ptr [rip+g2343], si
+  mov rsi, qword ptr [rip+g3003]
+  movsx rdi, word ptr [rip+g4566]
+  add rsi, rdi
+  mov dword ptr [rip+g2344], esi
+  movsxd rsi, dword ptr [rip+g2240]
+  movsx rdi, word ptr [rip+g3833]
+  add rsi, rdi
+  mov byte ptr [rip+g2345], sil
+  movsx rsi, byte ptr [rip+g3146]
+  movsxd rdi, dword ptr [rip+g2068]
+  add rsi, rdi
+  mov byte ptr [rip+g2346], sil
+  movsx rsi, word ptr [rip+g505]
+  movsx rdi, byte ptr [rip+g2475]
+  add rsi, rdi
+  mov dword ptr [rip+g2347], esi
+  movsx rsi, word ptr [rip+g1441]
+  add rsi, qword ptr [rip+g3999]
+  mov byte ptr [rip+g2348], sil
+  movsx rsi, word ptr [rip+g4030]
+  movsx rdi, word ptr [rip+g3095]
+  add rsi, rdi
+  mov dword ptr [rip+g2349], esi
+  movsx rsi, byte ptr [rip+g2340]
+  mov rax, rsi
+.L.return.u234:
+  ret
+.text
+.p2align 4
+.global u235
+u235:
+  movsx rsi, byte ptr [rip+g1355]
+  movsx rdi, byte ptr [rip+g1839]
+  add rsi, rdi
+  mov dword ptr [rip+g2350], esi
+  movsx rsi, word ptr [rip+g4830]
+  movsxd rdi, dword ptr [rip+g4055]
+  add rsi, rdi
+  mov byte ptr [rip+g2351], sil
+  movsxd rsi, dword ptr [rip+g600]
+  movsxd rdi, dword ptr [rip+g1338]
+  add rsi, rdi
+  mov dword ptr [rip+g2352], esi
+  movsx rsi, word ptr [rip+g469]
+  add rsi, qword ptr [rip+g2718]
+  mov word ptr [rip+g2353], si
+  movsx rsi, word ptr [rip+g3960]
+  movsxd rdi, dword ptr [rip+g4223]
+  add rsi, rdi
+  mov qword ptr [rip+g2354], rsi
+  movsxd rsi, dword ptr [rip+g4468]
+  movsxd rdi, dword ptr [rip+g1297]
+  add rsi, rdi
+  mov byte ptr [rip+g2355], sil
+  movsx rsi, byte ptr [rip+g127]
+  movsxd rdi, dword ptr [rip+g3781]
+  add rsi, rdi
+  mov word ptr [rip+g2356], si
+  movsxd rsi, dword ptr [rip+g2755]
+  movsx rdi, byte ptr [rip+g3837]
+  add rsi, rdi
+  mov word ptr [rip+g2357], si
+  movsx rsi, word ptr [rip+g4982]
+  add rsi, qword ptr [rip+g4856]
+  mov word ptr [rip+g2358], si
+  movsx rsi, word ptr [rip+g79]
+  movsx rdi, word ptr [rip+g1919]
+  add rsi, rdi
+  mov word ptr [rip+g2359], si
+  movsxd rsi, dword ptr [rip+g2350]
+  mov rax, rsi
+.L.return.u235:
+  ret
+.text
+.p2align 4
+.global u236
+u236:
+  movsxd rsi, dword ptr [rip+g4307]
+  movsxd rdi, dword ptr [rip+g3366]
+  add rsi, rdi
+  mov dword ptr [rip+g2360], esi
+  movsx rsi, word ptr [rip+g2179]
+  movsx rdi, byte ptr [rip+g3204]
+  add rsi, rdi
+  mov qword ptr [rip+g2361], rsi
+  movsx rsi, word ptr [rip+g4423]
+  movsx rdi, word ptr [rip+g4344]
+  add rsi, rdi
+  mov qword ptr [rip+g2362], rsi
+  movsx rsi, byte ptr [rip+g2505]
+  movsx rdi, word ptr [rip+g802]
+  add rsi, rdi
+  mov word ptr [rip+g2363], si
+  movsxd rsi, dword ptr [rip+g4469]
+  add rsi, qword ptr [rip+g3980]
+  mov byte ptr [rip+g2364], sil
+  mov rsi, qword ptr [rip+g1125]
+  add rsi, qword ptr [rip+g4619]
+  mov dword ptr [rip+g2365], esi
+  movsx rsi, byte ptr [rip+g1492]
+  movsx rdi, word ptr [rip+g2774]
+  add rsi, rdi
+  mov byte ptr [rip+g2366], sil
+  mov rsi, qword ptr [rip+g1976]
+  add rsi, qword ptr [rip+g3742]
+  mov qword ptr [rip+g2367], rsi
+  mov rsi, qword ptr [rip+g1572]
+  add rsi, qword ptr [rip+g2276]
+  mov word ptr [rip+g2368], si
+  movsxd rsi, dword ptr [rip+g4562]
+  movsx rdi, byte ptr [rip+g4408]
+  add rsi, rdi
+  mov word ptr [rip+g2369], si
+  movsxd rsi, dword ptr [rip+g2360]
+  mov rax, rsi
+.L.return.u236:
+  ret
+.text
+.p2align 4
+.global u237
+u237:
+  mov rsi, qword ptr [rip+g4461]
+  movsxd rdi, dword ptr [rip+g2027]
+  add rsi, rdi
+  mov word ptr [rip+g2370], si
+  movsxd rsi, dword ptr [rip+g2842]
+  add rsi, qword ptr [rip+g4292]
+  mov word ptr [rip+g2371], si
+  movsx rsi, byte ptr [rip+g4891]
+  movsxd rdi, dword ptr [rip+g3810]
+  add rsi, rdi
+  mov byte ptr [rip+g2372], sil
+  movsxd rsi, dword ptr [rip+g1515]
+  movsx rdi, word ptr [rip+g1325]
+  add rsi, rdi
+  mov word ptr [rip+g2373], si
+  movsxd rsi, dword ptr [rip+g2656]
+  movsx rdi, word ptr [rip+g3562]
+  add rsi, rdi
+  mov byte ptr [rip+g2374], sil
+  mov rsi, qword ptr [rip+g849]
+  movsx rdi, byte ptr [rip+g3002]
+  add rsi, rdi
+  mov word ptr [rip+g2375], si
+  mov rsi, qword ptr [rip+g4225]
+  movsx rdi, word ptr [rip+g4982]
+  add rsi, rdi
+  mov dword ptr [rip+g2376], esi
+  mov rsi, qword ptr [rip+g1458]
+  add rsi, qword ptr [rip+g1172]
+  mov qword ptr [rip+g2377], rsi
+  mov rsi, qword ptr [rip+g4418]
+  movsxd rdi, dword ptr [rip+g1692]
+  add rsi, rdi
+  mov word ptr [rip+g2378], si
+  movsxd rsi, dword ptr [rip+g59]
+  movsxd rdi, dword ptr [rip+g3836]
+  add rsi, rdi
+  mov word ptr [rip+g2379], si
+  movsx rsi, word ptr [rip+g2370]
+  mov rax, rsi
+.L.return.u237:
+  ret
+.text
+.p2align 4
+.global u238
+u238:
+  mov rsi, qword ptr [rip+g2708]
+  movsxd rdi, dword ptr [rip+g77]
+  add rsi, rdi
+  mov word ptr [rip+g2380], si
+  movsx rsi, word ptr [rip+g1446]
+  movsx rdi, byte ptr [rip+g1505]
+  add rsi, rdi
+  mov word ptr [rip+g2381], si
+  movsx rsi, byte ptr [rip+g2607]
+  add rsi, qword ptr [rip+g842]
+  mov word ptr [rip+g2382], si
+  movsx rsi, word ptr [rip+g2669]
+  movsx rdi, byte ptr [rip+g4111]
+  add rsi, rdi
+  mov dword ptr [rip+g2383], esi
+  movsx rsi, byte ptr [rip+g2760]
+  add rsi, qword ptr [rip+g4319]
+  mov dword ptr [rip+g2384], esi
+  movsx rsi, byte ptr [rip+g4143]
+  movsx rdi, word ptr [rip+g2435]
+  add rsi, rdi
+  mov byte ptr [rip+g2385], sil
+  movsx rsi, byte ptr [rip+g1119]
+  movsx rdi, word ptr [rip+g1813]
+  add rsi, rdi
+  mov byte ptr [rip+g2386], sil
+  movsx rsi, byte ptr [rip+g1594]
+  movsx rdi, word ptr [rip+g1847]
+  add rsi, rdi
+  mov qword ptr [rip+g2387], rsi
+  mov rsi, qword ptr [rip+g1859]
+  movsx rdi, byte ptr [rip+g141]
+  add rsi, rdi
+  mov qword ptr [rip+g2388], rsi
+  movsx rsi, byte ptr [rip+g2338]
+  movsx rdi, word ptr [rip+g4082]
+  add rsi, rdi
+  mov qword ptr [rip+g2389], rsi
+  movsx rsi, word ptr [rip+g2380]
+  mov rax, rsi
+.L.return.u238:
+  ret
+.text
+.p2align 4
+.global u239
+u239:
+  movsxd rsi, dword ptr [rip+g1375]
+  movsx rdi, word ptr [rip+g239]
+  add rsi, rdi
+  mov word ptr [rip+g2390], si
+  mov rsi, qword ptr [rip+g4934]
+  movsx rdi, byte ptr [rip+g278]
+  add rsi, rdi
+  mov qword ptr [rip+g2391], rsi
+  movsx rsi, byte ptr [rip+g3266]
+  movsxd rdi, dword ptr [rip+g3309]
+  add rsi, rdi
+  mov word ptr [rip+g2392], si
+  mov rsi, qword ptr [rip+g2739]
+  movsx rdi, byte ptr [rip+g4838]
+  add rsi, rdi
+  mov qword ptr [rip+g2393], rsi
+  mov rsi, qword ptr [rip+g2591]
+  movsx rdi, byte ptr [rip+g1595]
+  add rsi, rdi
+  mov word ptr [rip+g2394], si
+  mov rsi, qword ptr [rip+g3273]
+  movsx rdi, word ptr [rip+g3591]
+  add rsi, rdi
+  mov byte ptr [rip+g2395], sil
+  mov rsi, qword ptr [rip+g3941]
+  movsx rdi, byte ptr [rip+g3579]
+  add rsi, rdi
+  mov qword ptr [rip+g2396], rsi
+  movsx rsi, word ptr [rip+g125]
+  add rsi, qword ptr [rip+g4573]
+  mov byte ptr [rip+g2397], sil
+  movsx rsi, word ptr [rip+g1]
+  add rsi, qword ptr [rip+g657]
+  mov byte ptr [rip+g2398], sil
+  movsxd rsi, dword ptr [rip+g3231]
+  movsx rdi, word ptr [rip+g2568]
+  add rsi, rdi
+  mov dword ptr [rip+g2399], esi
+  movsx rsi, word ptr [rip+g2390]
+  mov rax, rsi
+.L.return.u239:
+  ret
+.text
+.p2align 4
+.global u240
+u240:
+  movsx rsi, word ptr [rip+g814]
+  add rsi, qword ptr [rip+g3393]
+  mov qword ptr [rip+g2400], rsi
+  movsx rsi, word ptr [rip+g3721]
+  movsxd rdi, dword ptr [rip+g3529]
+  add rsi, rdi
+  mov dword ptr [rip+g2401], esi
+  movsxd rsi, dword ptr [rip+g4538]
+  movsx rdi, byte ptr [rip+g4901]
+  add rsi, rdi
+  mov qword ptr [rip+g2402], rsi
+  mov rsi, qword ptr [rip+g725]
+  movsx rdi, byte ptr [rip+g4996]
+  add rsi, rdi
+  mov qword ptr [rip+g2403], rsi
+  movsx rsi, word ptr [rip+g3559]
+  add rsi, qword ptr [rip+g3787]
+  mov byte ptr [rip+g2404], sil
+  movsx rsi, word ptr [rip+g3703]
+  add rsi, qword ptr [rip+g1265]
+  mov dword ptr [rip+g2405], esi
+  movsxd rsi, dword ptr [rip+g230]
+  movsx rdi, word ptr [rip+g1852]
+  add rsi, rdi
+  mov dword ptr [rip+g2406], esi
+  movsxd rsi, dword ptr [rip+g231]
+  add rsi, qword ptr [rip+g793]
+  mov qword ptr [rip+g2407], rsi
+  movsxd rsi, dword ptr [rip+g2237]
+  add rsi, qword ptr [rip+g2801]
+  mov qword ptr [rip+g2408], rsi
+  movsx rsi, word ptr [rip+g2047]
+  movsx rdi, byte ptr [rip+g198]
+  add rsi, rdi
+  mov dword ptr [rip+g2409], esi
+  mov rax, qword ptr [rip+g2400]
+.L.return.u240:
+  ret
+.text
+.p2align 4
+.global u241
+u241:
+  mov rsi, qword ptr [rip+g4992]
+  add rsi, qword ptr [rip+g3905]
+  mov dword ptr [rip+g2410], esi
+  movsx rsi, byte ptr [rip+g4048]
+  movsx rdi, byte ptr [rip+g1094]
+  add rsi, rdi
+  mov byte ptr [rip+g2411], sil
+  movsx rsi, byte ptr [rip+g2515]
+  movsx rdi, byte ptr [rip+g508]
+  add rsi, rdi
+  mov byte ptr [rip+g2412], sil
+  mov rsi, qword ptr [rip+g1868]
+  movsx rdi, byte ptr [rip+g4945]
+  add rsi, rdi
+  mov dword ptr [rip+g2413], esi
+  movsx rsi, word ptr [rip+g3242]
+  add rsi, qword ptr [rip+g2560]
+  mov dword ptr [rip+g2414], esi
+  movsxd rsi, dword ptr [rip+g1238]
+  movsx rdi, word ptr [rip+g758]
+  add rsi, rdi
+  mov dword ptr [rip+g2415], esi
+  movsxd rsi, dword ptr [rip+g2639]
+  add rsi, qword ptr [rip+g2124]
+  mov byte ptr [rip+g2416], sil
+  mov rsi, qword ptr [rip+g258]
+  movsx rdi, word ptr [rip+g4102]
+  add rsi, rdi
+  mov qword ptr [rip+g2417], rsi
+  movsxd rsi, dword ptr [rip+g2321]
+  movsxd rdi, dword ptr [rip+g53]
+  add rsi, rdi
+  mov word ptr [rip+g2418], si
+  movsxd rsi, dword ptr [rip+g77]
+  movsx rdi, byte ptr [rip+g1115]
+  add rsi, rdi
+  mov dword ptr [rip+g2419], esi
+  movsxd rsi, dword ptr [rip+g2410]
+  mov rax, rsi
+.L.return.u241:
+  ret
+.text
+.p2align 4
+.global u242
+u242:
+  movsx rsi, word ptr [rip+g882]
+  movsx rdi, byte ptr [rip+g2223]
+  add rsi, rdi
+  mov word ptr [rip+g2420], si
+  movsx rsi, byte ptr [rip+g4590]
+  add rsi, qword ptr [rip+g4769]
+  mov word ptr [rip+g2421], si
+  movsxd rsi, dword ptr [rip+g4764]
+  movsxd rdi, dword ptr [rip+g4191]
+  add rsi, rdi
+  mov byte ptr [rip+g2422], sil
+  movsx rsi, word ptr [rip+g4823]
+  movsx rdi, word ptr [rip+g640]
+  add rsi, rdi
+  mov qword ptr [rip+g2423], rsi
+  movsxd rsi, dword ptr [rip+g1096]
+  add rsi, qword ptr [rip+g702]
+  mov word ptr [rip+g2424], si
+  mov rsi, qword ptr [rip+g2828]
+  movsx rdi, byte ptr [rip+g424]
+  add rsi, rdi
+  mov byte ptr [rip+g2425], sil
+  movsx rsi, byte ptr [rip+g2244]
+  add rsi, qword ptr [rip+g861]
+  mov qword ptr [rip+g2426], rsi
+  movsx rsi, word ptr [rip+g3087]
+  movsx rdi, byte ptr [rip+g3125]
+  add rsi, rdi
+  mov byte ptr [rip+g2427], sil
+  mov rsi, qword ptr [rip+g1401]
+  movsx rdi, byte ptr [rip+g4108]
+  add rsi, rdi
+  mov word ptr [rip+g2428], si
+  movsxd rsi, dword ptr [rip+g2406]
+  add rsi, qword ptr [rip+g386]
+  mov dword ptr [rip+g2429], esi
+  movsx rsi, word ptr [rip+g2420]
+  mov rax, rsi
+.L.return.u242:
+  ret
+.text
+.p2align 4
+.global u243
+u243:
+  movsxd rsi, dword ptr [rip+g907]
+  add rsi, qword ptr [rip+g1786]
+  mov qword ptr [rip+g2430], rsi
+  movsx rsi, word ptr [rip+g1623]
+  movsx rdi, byte ptr [rip+g4371]
+  add rsi, rdi
+  mov qword ptr [rip+g2431], rsi
+  mov rsi, qword ptr [rip+g2940]
+  add rsi, qword ptr [rip+g4321]
+  mov qword ptr [rip+g2432], rsi
+  movsx rsi, byte ptr [rip+g839]
+  movsxd rdi, dword ptr [rip+g1420]
+  add rsi, rdi
+  mov byte ptr [rip+g2433], sil
+  movsx rsi, byte ptr [rip+g3269]
+  movsx rdi, byte ptr [rip+g4206]
+  add rsi, rdi
+  mov qword ptr [rip+g2434], rsi
+  movsx rsi, byte ptr [rip+g4108]
+  add rsi, qword ptr [rip+g2703]
+  mov word ptr [rip+g2435], si
+  mov rsi, qword ptr [rip+g2863]
+  movsx rdi, byte ptr [rip+g516]
+  add rsi, rdi
+  mov word ptr [rip+g2436], si
+  mov rsi, qword ptr [rip+g243]
+  movsx rdi, byte ptr [rip+g372]
+  add rsi, rdi
+  mov dword ptr [rip+g2437], esi
+  movsxd rsi, dword ptr [rip+g4588]
+  movsxd rdi, dword ptr [rip+g4382]
+  add rsi, rdi
+  mov byte ptr [rip+g2438], sil
+  movsx rsi, word ptr [rip+g2545]
+  movsx rdi, byte ptr [rip+g837]
+  add rsi, rdi
+  mov dword ptr [rip+g2439], esi
+  mov rax, qword ptr [rip+g2430]
+.L.return.u243:
+  ret
+.text
+.p2align 4
+.global u244
+u244:
+  mov rsi, qword ptr [rip+g2733]
+  movsx rdi, byte ptr [rip+g4206]
+  add rsi, rdi
+  mov dword ptr [rip+g2440], esi
+  movsxd rsi, dword ptr [rip+g240]
+  movsxd rdi, dword ptr [rip+g4272]
+  add rsi, rdi
+  mov dword ptr [rip+g2441], esi
+  movsx rsi, word ptr [rip+g4577]
+  movsx rdi, byte ptr [rip+g4037]
+  add rsi, rdi
+  mov dword ptr [rip+g2442], esi
+  movsx rsi, byte ptr [rip+g1425]
+  movsx rdi, word ptr [rip+g1601]
+  add rsi, rdi
+  mov dword ptr [rip+g2443], esi
+  movsx rsi, byte ptr [rip+g2976]
+  add rsi, qword ptr [rip+g4042]
+  mov qword ptr [rip+g2444], rsi
+  movsx rsi, word ptr [rip+g2497]
+  movsx rdi, byte ptr [rip+g4642]
+  add rsi, rdi
+  mov byte ptr [rip+g2445], sil
+  movsxd rsi, dword ptr [rip+g474]
+  add rsi, qword ptr [rip+g1550]
+  mov word ptr [rip+g2446], si
+  mov rsi, qword ptr [rip+g983]
+  movsx rdi, word ptr [rip+g4953]
+  add rsi, rdi
+  mov word ptr [rip+g2447], si
+  movsx rsi, byte ptr [rip+g375]
+  movsx rdi, byte ptr [rip+g4993]
+  add rsi, rdi
+  mov qword ptr [rip+g2448], rsi
+  movsx rsi, word ptr [rip+g3164]
+  movsxd rdi, dword ptr [rip+g104]
+  add rsi, rdi
+  mov dword ptr [rip+g2449], esi
+  movsxd rsi, dword ptr [rip+g2440]
+  mov rax, rsi
+.L.return.u244:
+  ret
+.text
+.p2align 4
+.global u245
+u245:
+  movsxd rsi, dword ptr [rip+g482]
+  add rsi, qword ptr [rip+g2670]
+  mov word ptr [rip+g2450], si
+  movsx rsi, word ptr [rip+g1862]
+  movsxd rdi, dword ptr [rip+g4641]
+  add rsi, rdi
+  mov qword ptr [rip+g2451], rsi
+  movsxd rsi, dword ptr [rip+g3618]
+  movsx rdi, word ptr [rip+g2942]
+  add rsi, rdi
+  mov word ptr [rip+g2452], si
+  movsx rsi, byte ptr [rip+g2546]
+  movsx rdi, word ptr [rip+g2392]
+  add rsi, rdi
+  mov qword ptr [rip+g2453], rsi
+  movsx rsi, byte ptr [rip+g4648]
+  movsx rdi, byte ptr [rip+g3109]
+  add rsi, rdi
+  mov qword ptr [rip+g2454], rsi
+  movsxd rsi, dword ptr [rip+g158]
+  add rsi, qword ptr [rip+g1531]
+  mov word ptr [rip+g2455], si
+  movsxd rsi, dword ptr [rip+g2698]
+  movsx rdi, byte ptr [rip+g3254]
+  add rsi, rdi
+  mov qword ptr [rip+g2456], rsi
+  movsxd rsi, dword ptr [rip+g2155]
+  movsx rdi, byte ptr [rip+g2004]
+  add rsi, rdi
+  mov word ptr [rip+g2457], si
+  movsx rsi, word ptr [rip+g4810]
+  movsxd rdi, dword ptr [rip+g719]
+  add rsi, rdi
+  mov qword ptr [rip+g2458], rsi
+  movsxd rsi, dword ptr [rip+g732]
+  add rsi, qword ptr [rip+g4800]
+  mov byte ptr [rip+g2459], sil
+  movsx rsi, word ptr [rip+g2450]
+  mov rax, rsi
+.L.return.u245:
+  ret
+.text
+.p2align 4
+.global u246
+u246:
+  mov rsi, qword ptr [rip+g69]
+  movsx rdi, word ptr [rip+g633]
+  add rsi, rdi
+  mov byte ptr [rip+g2460], sil
+  movsx rsi, byte ptr [rip+g2943]
+  movsxd rdi, dword ptr [rip+g3717]
+  add rsi, rdi
+  mov qword ptr [rip+g2461], rsi
+  movsx rsi, word ptr [rip+g614]
+  movsx rdi, byte ptr [rip+g1303]
+  add rsi, rdi
+  mov dword ptr [rip+g2462], esi
+  movsx rsi, byte ptr [rip+g4793]
+  add rsi, qword ptr [rip+g841]
+  mov qword ptr [rip+g2463], rsi
+  movsx rsi, byte ptr [rip+g3669]
+  movsx rdi, byte ptr [rip+g391]
+  add rsi, rdi
+  mov byte ptr [rip+g2464], sil
+  movsx rsi, word ptr [rip+g2179]
+  movsx rdi, word ptr [rip+g4246]
+  add rsi, rdi
+  mov qword ptr [rip+g2465], rsi
+  movsx rsi, word ptr [rip+g2965]
+  movsx rdi, byte ptr [rip+g1320]
+  add rsi, rdi
+  mov dword ptr [rip+g2466], esi
+  mov rsi, qword ptr [rip+g3851]
+  add rsi, qword ptr [rip+g4087]
+  mov byte ptr [rip+g2467], sil
+  movsxd rsi, dword ptr [rip+g4100]
+  add rsi, qword ptr [rip+g2152]
+  mov qword ptr [rip+g2468], rsi
+  mov rsi, qword ptr [rip+g2451]
+  movsxd rdi, dword ptr [rip+g1869]
+  add rsi, rdi
+  mov dword ptr [rip+g2469], esi
+  movsx rsi, byte ptr [rip+g2460]
+  mov rax, rsi
+.L.return.u246:
+  ret
+.text
+.p2align 4
+.global u247
+u247:
+  movsxd rsi, dword ptr [rip+g2143]
+  movsxd rdi, dword ptr [rip+g2115]
+  add rsi, rdi
+  mov qword ptr [rip+g2470], rsi
+  movsx rsi, word ptr [rip+g3767]
+  movsx rdi, word ptr [rip+g1893]
+  add rsi, rdi
+  mov word ptr [rip+g2471], si
+  movsx rsi, byte ptr [rip+g690]
+  movsxd rdi, dword ptr [rip+g1842]
+  add rsi, rdi
+  mov word ptr [rip+g2472], si
+  mov rsi, qword ptr [rip+g1657]
+  movsx rdi, word ptr [rip+g4397]
+  add rsi, rdi
+  mov dword ptr [rip+g2473], esi
+  movsx rsi, word ptr [rip+g1780]
+  add rsi, qword ptr [rip+g490]
+  mov word ptr [rip+g2474], si
+  mov rsi, qword ptr [rip+g369]
+  add rsi, qword ptr [rip+g4221]
+  mov byte ptr [rip+g2475], sil
+  movsx rsi, byte ptr [rip+g1180]
+  movsx rdi, word ptr [rip+g1153]
+  add rsi, rdi
+  mov byte ptr [rip+g2476], sil
+  movsx rsi, word ptr [rip+g4643]
+  add rsi, qword ptr [rip+g3484]
+  mov byte ptr [rip+g2477], sil
+  mov rsi, qword ptr [rip+g1432]
+  movsx rdi, word ptr [rip+g1309]
+  add rsi, rdi
+  mov byte ptr [rip+g2478], sil
+  mov rsi, qword ptr [rip+g3467]
+  movsx rdi, word ptr [rip+g814]
+  add rsi, rdi
+  mov word ptr [rip+g2479], si
+  mov rax, qword ptr [rip+g2470]
+.L.return.u247:
+  ret
+.text
+.p2align 4
+.global u248
+u248:
+  movsxd rsi, dword ptr [rip+g4507]
+  movsx rdi, byte ptr [rip+g1807]
+  add rsi, rdi
+  mov byte ptr [rip+g2480], sil
+  movsx rsi, word ptr [rip+g1134]
+  movsx rdi, byte ptr [rip+g2658]
+  add rsi, rdi
+  mov qword ptr [rip+g2481], rsi
+  movsxd rsi, dword ptr [rip+g869]
+  add rsi, qword ptr [rip+g1835]
+  mov qword ptr [rip+g2482], rsi
+  mov rsi, qword ptr [rip+g2151]
+  add rsi, qword ptr [rip+g4728]
+  mov qword ptr [rip+g2483], rsi
+  movsx rsi, word ptr [rip+g96]
+  movsxd rdi, dword ptr [rip+g921]
+  add rsi, rdi
+  mov byte ptr [rip+g2484], sil
+  movsxd rsi, dword ptr [rip+g4941]
+  add rsi, qword ptr [rip+g2949]
+  mov dword ptr [rip+g2485], esi
+  movsx rsi, word ptr [rip+g619]
+  movsxd rdi, dword ptr [rip+g763]
+  add rsi, rdi
+  mov word ptr [rip+g2486], si
+  movsx rsi, byte ptr [rip+g603]
+  movsxd rdi, dword ptr [rip+g3008]
+  add rsi, rdi
+  mov qword ptr [rip+g2487], rsi
+  movsx rsi, word ptr [rip+g4665]
+  movsx rdi, word ptr [rip+g4482]
+  add rsi, rdi
+  mov qword ptr [rip+g2488], rsi
+  movsx rsi, byte ptr [rip+g3013]
+  add rsi, qword ptr [rip+g4543]
+  mov qword ptr [rip+g2489], rsi
+  movsx rsi, byte ptr [rip+g2480]
+  mov rax, rsi
+.L.return.u248:
+  ret
+.text
+.p2align 4
+.global u249
+u249:
+  mov rsi, qword ptr [rip+g236]
+  movsx rdi, byte ptr [rip+g3555]
+  add rsi, rdi
+  mov byte ptr [rip+g2490], sil
+  mov rsi, qword ptr [rip+g470]
+  movsx rdi, byte ptr [rip+g2701]
+  add rsi, rdi
+  mov byte ptr [rip+g2491], sil
+  movsx rsi, word ptr [rip+g44]
+  add rsi, qword ptr [rip+g3653]
+  mov byte ptr [rip+g2492], sil
+  movsx rsi, byte ptr [rip+g1187]
+  movsx rdi, byte ptr [rip+g1175]
+  add rsi, rdi
+  mov dword ptr [rip+g2493], esi
+  movsx rsi, byte ptr [rip+g4323]
+  add rsi, qword ptr [rip+g3708]
+  mov qword ptr [rip+g2494], rsi
+  mov rsi, qword ptr [rip+g1531]
+  add rsi, qword ptr [rip+g997]
+  mov qword ptr [rip+g2495], rsi
+  movsx rsi, byte ptr [rip+g1094]
+  movsx rdi, word ptr [rip+g1168]
+  add rsi, rdi
+  mov qword ptr [rip+g2496], rsi
+  movsx rsi, word ptr [rip+g3140]
+  movsx rdi, byte ptr [rip+g1633]
+  add rsi, rdi
+  mov word ptr [rip+g2497], si
+  movsxd rsi, dword ptr [rip+g2891]
+  add rsi, qword ptr [rip+g2826]
+  mov word ptr [rip+g2498], si
+  movsxd rsi, dword ptr [rip+g2915]
+  movsx rdi, byte ptr [rip+g1595]
+  add rsi, rdi
+  mov byte ptr [rip+g2499], sil
+  movsx rsi, byte ptr [rip+g2490]
+  mov rax, rsi
+.L.return.u249:
+  ret
+.text
+.p2align 4
+.global u250
+u250:
+  movsxd rsi, dword ptr [rip+g3418]
+  add rsi, qword ptr [rip+g2481]
+  mov qword ptr [rip+g2500], rsi
+  mov rsi, qword ptr [rip+g3401]
+  movsx rdi, word ptr [rip+g860]
+  add rsi, rdi
+  mov dword ptr [rip+g2501], esi
+  mov rsi, qword ptr [rip+g371]
+  add rsi, qword ptr [rip+g521]
+  mov qword ptr [rip+g2502], rsi
+  movsxd rsi, dword ptr [rip+g553]
+  movsx rdi, byte ptr [rip+g1098]
+  add rsi, rdi
+  mov dword ptr [rip+g2503], esi
+  movsx rsi, byte ptr [rip+g2912]
+  movsxd rdi, dword ptr [rip+g2929]
+  add rsi, rdi
+  mov word ptr [rip+g2504], si
+  movsxd rsi, dword ptr [rip+g1979]
+  add rsi, qword ptr [rip+g4212]
+  mov byte ptr [rip+g2505], sil
+  movsx rsi, word ptr [rip+g4258]
+  add rsi, qword ptr [rip+g4497]
+  mov dword ptr [rip+g2506], esi
+  movsx rsi, word ptr [rip+g4780]
+  add rsi, qword ptr [rip+g3058]
+  mov dword ptr [rip+g2507], esi
+  movsx rsi, byte ptr [rip+g3504]
+  add rsi, qword ptr [rip+g2329]
+  mov qword ptr [rip+g2508], rsi
+  movsx rsi, word ptr [rip+g2277]
+  movsx rdi, word ptr [rip+g620]
+  add rsi, rdi
+  mov byte ptr [rip+g2509], sil
+  mov rax, qword ptr [rip+g2500]
+.L.return.u250:
+  ret
+.text
+.p2align 4
+.global u251
+u251:
+  movsxd rsi, dword ptr [rip+g4132]
+  movsxd rdi, dword ptr [rip+g1586]
+  add rsi, rdi
+  mov word ptr [rip+g2510], si
+  mov rsi, qword ptr [rip+g5]
+  movsxd rdi, dword ptr [rip+g126]
+  add rsi, rdi
+  mov dword ptr [rip+g2511], esi
+  movsx rsi, byte ptr [rip+g2613]
+  movsxd rdi, dword ptr [rip+g949]
+  add rsi, rdi
+  mov qword ptr [rip+g2512], rsi
+  movsx rsi, word ptr [rip+g1134]
+  movsx rdi, byte ptr [rip+g1559]
+  add rsi, rdi
+  mov word ptr [rip+g2513], si
+  mov rsi, qword ptr [rip+g4817]
+  add rsi, qword ptr [rip+g4500]
+  mov word ptr [rip+g2514], si
+  movsxd rsi, dword ptr [rip+g2606]
+  movsx rdi, word ptr [rip+g24]
+  add rsi, rdi
+  mov byte ptr [rip+g2515], sil
+  movsx rsi, byte ptr [rip+g4081]
+  movsx rdi, byte ptr [rip+g1280]
+  add rsi, rdi
+  mov qword ptr [rip+g2516], rsi
+  mov rsi, qword ptr [rip+g3237]
+  add rsi, qword ptr [rip+g3192]
+  mov dword ptr [rip+g2517], esi
+  movsxd rsi, dword ptr [rip+g1891]
+  movsx rdi, byte ptr [rip+g1671]
+  add rsi, rdi
+  mov dword ptr [rip+g2518], esi
+  movsx rsi, byte ptr [rip+g1187]
+  movsxd rdi, dword ptr [rip+g1967]
+  add rsi, rdi
+  mov byte ptr [rip+g2519], sil
+  movsx rsi, word ptr [rip+g2510]
+  mov rax, rsi
+.L.return.u251:
+  ret
+.text
+.p2align 4
+.global u252
+u252:
+  mov rsi, qword ptr [rip+g2675]
+  movsx rdi, byte ptr [rip+g3111]
+  add rsi, rdi
+  mov qword ptr [rip+g2520], rsi
+  movsx rsi, word ptr [rip+g788]
+  movsxd rdi, dword ptr [rip+g1044]
+  add rsi, rdi
+  mov qword ptr [rip+g2521], rsi
+  movsx rsi, word ptr [rip+g1639]
+  add rsi, qword ptr [rip+g286]
+  mov qword ptr [rip+g2522], rsi
+  mov rsi, qword ptr [rip+g4756]
+  movsxd rdi, dword ptr [rip+g4541]
+  add rsi, rdi
+  mov qword ptr [rip+g2523], rsi
+  movsx rsi, byte ptr [rip+g3017]
+  add rsi, qword ptr [rip+g959]
+  mov dword ptr [rip+g2524], esi
+  movsxd rsi, dword ptr [rip+g4186]
+  movsx rdi, byte ptr [rip+g857]
+  add rsi, rdi
+  mov byte ptr [rip+g2525], sil
+  mov rsi, qword ptr [rip+g1288]
+  movsxd rdi, dword ptr [rip+g2738]
+  add rsi, rdi
+  mov byte ptr [rip+g2526], sil
+  movsx rsi, byte ptr [rip+g605]
+  movsxd rdi, dword ptr [rip+g4364]
+  add rsi, rdi
+  mov byte ptr [rip+g2527], sil
+  movsxd rsi, dword ptr [rip+g4301]
+  movsx rdi, byte ptr [rip+g582]
+  add rsi, rdi
+  mov qword ptr [rip+g2528], rsi
+  movsx rsi, byte ptr [rip+g2244]
+  movsxd rdi, dword ptr [rip+g4892]
+  add rsi, rdi
+  mov dword ptr [rip+g2529], esi
+  mov rax, qword ptr [rip+g2520]
+.L.return.u252:
+  ret
+.text
+.p2align 4
+.global u253
+u253:
+  movsxd rsi, dword ptr [rip+g339]
+  movsxd rdi, dword ptr [rip+g2995]
+  add rsi, rdi
+  mov byte ptr [rip+g2530], sil
+  movsx rsi, word ptr [rip+g4823]
+  movsx rdi, byte ptr [rip+g2346]
+  add rsi, rdi
+  mov word ptr [rip+g2531], si
+  mov rsi, qword ptr [rip+g4099]
+  add rsi, qword ptr [rip+g2032]
+  mov word ptr [rip+g2532], si
+  movsxd rsi, dword ptr [rip+g4132]
+  movsxd rdi, dword ptr [rip+g4318]
+  add rsi, rdi
+  mov qword ptr [rip+g2533], rsi
+  mov rsi, qword ptr [rip+g48]
+  movsxd rdi, dword ptr [rip+g4743]
+  add rsi, rdi
+  mov word ptr [rip+g2534], si
+  mov rsi, qword ptr [rip+g1621]
+  movsx rdi, word ptr [rip+g510]
+  add rsi, rdi
+  mov dword ptr [rip+g2535], esi
+  movsxd rsi, dword ptr [rip+g3920]
+  add rsi, qword ptr [rip+g504]
+  mov byte ptr [rip+g2536], sil
+  movsx rsi, word ptr [rip+g2979]
+  movsxd rdi, dword ptr [rip+g2579]
+  add rsi, rdi
+  mov word ptr [rip+g2537], si
+  movsx rsi, word ptr [rip+g2676]
+  movsx rdi, byte ptr [rip+g1807]
+  add rsi, rdi
+  mov byte ptr [rip+g2538], sil
+  movsx rsi, word ptr [rip+g2277]
+  movsxd rdi, dword ptr [rip+g924]
+  add rsi, rdi
+  mov word ptr [rip+g2539], si
+  movsx rsi, byte ptr [rip+g2530]
+  mov rax, rsi
+.L.return.u253:
+  ret
+.text
+.p2align 4
+.global u254
+u254:
+  movsxd rsi, dword ptr [rip+g1731]
+  movsx rdi, byte ptr [rip+g864]
+  add rsi, rdi
+  mov dword ptr [rip+g2540], esi
+  mov rsi, qword ptr [rip+g4212]
+  movsx rdi, word ptr [rip+g1903]
+  add rsi, rdi
+  mov qword ptr [rip+g2541], rsi
+  mov rsi, qword ptr [rip+g253]
+  movsxd rdi, dword ptr [rip+g625]
+  add rsi, rdi
+  mov dword ptr [rip+g2542], esi
+  movsx rsi, word ptr [rip+g2974]
+  movsxd rdi, dword ptr [rip+g1729]
+  add rsi, rdi
+  mov qword ptr [rip+g2543], rsi
+  movsxd rsi, dword ptr [rip+g2164]
+  movsx rdi, byte ptr [rip+g3986]
+  add rsi, rdi
+  mov dword ptr [rip+g2544], esi
+  movsxd rsi, dword ptr [rip+g4469]
+  movsxd rdi, dword ptr [rip+g1489]
+  add rsi, rdi
+  mov word ptr [rip+g2545], si
+  movsx rsi, byte ptr [rip+g2348]
+  add rsi, qword ptr [rip+g3869]
+  mov byte ptr [rip+g2546], sil
+  mov rsi, qword ptr [rip+g4899]
+  movsxd rdi, dword ptr [rip+g254]
+  add rsi, rdi
+  mov word ptr [rip+g2547], si
+  movsxd rsi, dword ptr [rip+g2969]
+  movsx rdi, word ptr [rip+g489]
+  add rsi, rdi
+  mov dword ptr [rip+g2548], esi
+  movsxd rsi, dword ptr [rip+g3042]
+  movsxd rdi, dword ptr [rip+g1456]
+  add rsi, rdi
+  mov qword ptr [rip+g2549], rsi
+  movsxd rsi, dword ptr [rip+g2540]
+  mov rax, rsi
+.L.return.u254:
+  ret
+.text
+.p2align 4
+.global u255
+u255:
+  movsx rsi, word ptr [rip+g3445]
+  add rsi, qword ptr [rip+g2661]
+  mov word ptr [rip+g2550], si
+  mov rsi, qword ptr [rip+g470]
+  movsx rdi, byte ptr [rip+g3758]
+  add rsi, rdi
+  mov byte ptr [rip+g2551], sil
+  movsx rsi, byte ptr [rip+g4653]
+  movsx rdi, word ptr [rip+g215]
+  add rsi, rdi
+  mov qword ptr [rip+g2552], rsi
+  mov rsi, qword ptr [rip+g3469]
+  movsx rdi, byte ptr [rip+g3816]
+  add rsi, rdi
+  mov dword ptr [rip+g2553], esi
+  movsx rsi, word ptr [rip+g4978]
+  movsxd rdi, dword ptr [rip+g3474]
+  add rsi, rdi
+  mov word ptr [rip+g2554], si
+  mov rsi, qword ptr [rip+g1878]
+  movsx rdi, word ptr [rip+g3982]
+  add rsi, rdi
+  mov byte ptr [rip+g2555], sil
+  mov rsi, qword ptr [rip+g1477]
+  movsxd rdi, dword ptr [rip+g202]
+  add rsi, rdi
+  mov byte ptr [rip+g2556], sil
+  movsx rsi, byte ptr [rip+g4891]
+  movsxd rdi, dword ptr [rip+g110]
+  add rsi, rdi
+  mov dword ptr [rip+g2557], esi
+  movsx rsi, byte ptr [rip+g210]
+  movsxd rdi, dword ptr [rip+g4870]
+  add rsi, rdi
+  mov qword ptr [rip+g2558], rsi
+  movsx rsi, word ptr [rip+g3528]
+  movsx rdi, byte ptr [rip+g2110]
+  add rsi, rdi
+  mov byte ptr [rip+g2559], sil
+  movsx rsi, word ptr [rip+g2550]
+  mov rax, rsi
+.L.return.u255:
+  ret
+.text
+.p2align 4
+.global u256
+u256:
+  mov rsi, qword ptr [rip+g615]
+  add rsi, qword ptr [rip+g4212]
+  mov qword ptr [rip+g2560], rsi
+  movsxd rsi, dword ptr [rip+g452]
+  movsx rdi, word ptr [rip+g1184]
+  add rsi, rdi
+  mov word ptr [rip+g2561], si
+  movsx rsi, word ptr [rip+g3247]
+  movsx rdi, word ptr [rip+g4258]
+  add rsi, rdi
+  mov qword ptr [rip+g2562], rsi
+  mov rsi, qword ptr [rip+g4339]
+  movsxd rdi, dword ptr [rip+g3335]
+  add rsi, rdi
+  mov qword ptr [rip+g2563], rsi
+  movsx rsi, word ptr [rip+g1067]
+  movsxd rdi, dword ptr [rip+g1029]
+  add rsi, rdi
+  mov byte ptr [rip+g2564], sil
+  mov rsi, qword ptr [rip+g2959]
+  movsxd rdi, dword ptr [rip+g2780]
+  add rsi, rdi
+  mov word ptr [rip+g2565], si
+  movsx rsi, word ptr [rip+g3358]
+  add rsi, qword ptr [rip+g4647]
+  mov qword ptr [rip+g2566], rsi
+  movsx rsi, byte ptr [rip+g2505]
+  movsxd rdi, dword ptr [rip+g4783]
+  add rsi, rdi
+  mov dword ptr [rip+g2567], esi
+  movsx rsi, word ptr [rip+g1702]
+  movsxd rdi, dword ptr [rip+g3888]
+  add rsi, rdi
+  mov word ptr [rip+g2568], si
+  movsxd rsi, dword ptr [rip+g4180]
+  movsx rdi, byte ptr [rip+g1450]
+  add rsi, rdi
+  mov word ptr [rip+g2569], si
+  mov rax, qword ptr [rip+g2560]
+.L.return.u256:
+  ret
+.text
+.p2align 4
+.global u257
+u257:
+  movsxd rsi, dword ptr [rip+g1782]
+  movsx rdi, word ptr [rip+g3105]
+  add rsi, rdi
+  mov word ptr [rip+g2570], si
+  mov rsi, qword ptr [rip+g646]
+  add rsi, qword ptr [rip+g4756]
+  mov word ptr [rip+g2571], si
+  movsx rsi, word ptr [rip+g1256]
+  movsx rdi, word ptr [rip+g1036]
+  add rsi, rdi
+  mov dword ptr [rip+g2572], esi
+  movsx rsi, word ptr [rip+g1796]
+  add rsi, qword ptr [rip+g900]
+  mov byte ptr [rip+g2573], sil
+  mov rsi, qword ptr [rip+g4412]
+  add rsi, qword ptr [rip+g4276]
+  mov qword ptr [rip+g2574], rsi
+  mov rsi, qword ptr [rip+g3949]
+  movsxd rdi, dword ptr [rip+g1439]
+  add rsi, rdi
+  mov word ptr [rip+g2575], si
+  mov rsi, qword ptr [rip+g4027]
+  movsxd rdi, dword ptr [rip+g370]
+  add rsi, rdi
+  mov byte ptr [rip+g2576], sil
+  movsx rsi, byte ptr [rip+g1406]
+  movsxd rdi, dword ptr [rip+g42]
+  add rsi, rdi
+  mov qword ptr [rip+g2577], rsi
+  movsx rsi, word ptr [rip+g4050]
+  add rsi, qword ptr [rip+g3147]
+  mov dword ptr [rip+g2578], esi
+  movsx rsi, word ptr [rip+g1041]
+  movsxd rdi, dword ptr [rip+g2092]
+  add rsi, rdi
+  mov dword ptr [rip+g2579], esi
+  movsx rsi, word ptr [rip+g2570]
+  mov rax, rsi
+.L.return.u257:
+  ret
+.text
+.p2align 4
+.global u258
+u258:
+  movsx rsi, byte ptr [rip+g4067]
+  movsxd rdi, dword ptr [rip+g699]
+  add rsi, rdi
+  mov qword ptr [rip+g2580], rsi
+  mov rsi, qword ptr [rip+g2618]
+  movsxd rdi, dword ptr [rip+g2579]
+  add rsi, rdi
+  mov qword ptr [rip+g2581], rsi
+  movsxd rsi, dword ptr [rip+g4098]
+  add rsi, qword ptr [rip+g717]
+  mov dword ptr [rip+g2582], esi
+  movsxd rsi, dword ptr [rip+g1359]
+  movsxd rdi, dword ptr [rip+g2753]
+  add rsi, rdi
+  mov word ptr [rip+g2583], si
+  movsx rsi, byte ptr [rip+g1918]
+  movsx rdi, byte ptr [rip+g2302]
+  add rsi, rdi
+  mov word ptr [rip+g2584], si
+  movsxd rsi, dword ptr [rip+g3179]
+  movsxd rdi, dword ptr [rip+g1135]
+  add rsi, rdi
+  mov qword ptr [rip+g2585], rsi
+  movsx rsi, byte ptr [rip+g4206]
+  add rsi, qword ptr [rip+g2463]
+  mov qword ptr [rip+g2586], rsi
+  mov rsi, qword ptr [rip+g4938]
+  movsxd rdi, dword ptr [rip+g3527]
+  add rsi, rdi
+  mov qword ptr [rip+g2587], rsi
+  movsx rsi, word ptr [rip+g252]
+  movsx rdi, byte ptr [rip+g1188]
+  add rsi, rdi
+  mov dword ptr [rip+g2588], esi
+  movsx rsi, byte ptr [rip+g2751]
+  add rsi, qword ptr [rip+g520]
+  mov byte ptr [rip+g2589], sil
+  mov rax, qword ptr [rip+g2580]
+.L.return.u258:
+  ret
+.text
+.p2align 4
+.global u259
+u259:
+  movsx rsi, byte ptr [rip+g3091]
+  movsx rdi, word ptr [rip+g589]
+  add rsi, rdi
+  mov word ptr [rip+g2590], si
+  movsx rsi, byte ptr [rip+g3514]
+  movsx rdi, byte ptr [rip+g1156]
+  add rsi, rdi
+  mov qword ptr [rip+g2591], rsi
+  movsx rsi, byte ptr [rip+g3073]
+  movsxd rdi, dword ptr [rip+g1705]
+  add rsi, rdi
+  mov word ptr [rip+g2592], si
+  mov rsi, qword ptr [rip+g4484]
+  movsx rdi, byte ptr [rip+g3012]
+  add rsi, rdi
+  mov qword ptr [rip+g2593], rsi
+  movsx rsi, byte ptr [rip+g3952]
+  add rsi, qword ptr [rip+g2752]
+  mov word ptr [rip+g2594], si
+  movsx rsi, byte ptr [rip+g2337]
+  movsx rdi, word ptr [rip+g3316]
+  add rsi, rdi
+  mov byte ptr [rip+g2595], sil
+  mov rsi, qword ptr [rip+g17]
+  movsx rdi, word ptr [rip+g510]
+  add rsi, rdi
+  mov byte ptr [rip+g2596], sil
+  movsxd rsi, dword ptr [rip+g1219]
+  movsxd rdi, dword ptr [rip+g140]
+  add rsi, rdi
+  mov dword ptr [rip+g2597], esi
+  mov rsi, qword ptr [rip+g4890]
+  movsx rdi, byte ptr [rip+g3056]
+  add rsi, rdi
+  mov word ptr [rip+g2598], si
+  movsxd rsi, dword ptr [rip+g4551]
+  movsxd rdi, dword ptr [rip+g2709]
+  add rsi, rdi
+  mov byte ptr [rip+g2599], sil
+  movsx rsi, word ptr [rip+g2590]
+  mov rax, rsi
+.L.return.u259:
+  ret
+.text
+.p2align 4
+.global u260
+u260:
+  movsx rsi, byte ptr [rip+g4625]
+  add rsi, qword ptr [rip+g4724]
+  mov dword ptr [rip+g2600], esi
+  movsxd rsi, dword ptr [rip+g4508]
+  movsxd rdi, dword ptr [rip+g468]
+  add rsi, rdi
+  mov byte ptr [rip+g2601], sil
+  movsx rsi, byte ptr [rip+g3493]
+  movsxd rdi, dword ptr [rip+g766]
+  add rsi, rdi
+  mov dword ptr [rip+g2602], esi
+  mov rsi, qword ptr [rip+g4187]
+  movsxd rdi, dword ptr [rip+g4157]
+  add rsi, rdi
+  mov dword ptr [rip+g2603], esi
+  movsx rsi, byte ptr [rip+g2477]
+  movsx rdi, word ptr [rip+g3298]
+  add rsi, rdi
+  mov qword ptr [rip+g2604], rsi
+  movsxd rsi, dword ptr [rip+g1215]
+  movsxd rdi, dword ptr [rip+g3001]
+  add rsi, rdi
+  mov word ptr [rip+g2605], si
+  movsx rsi, byte ptr [rip+g692]
+  movsxd rdi, dword ptr [rip+g4527]
+  add rsi, rdi
+  mov dword ptr [rip+g2606], esi
+  movsxd rsi, dword ptr [rip+g3032]
+  movsx rdi, byte ptr [rip+g1180]
+  add rsi, rdi
+  mov byte ptr [rip+g2607], sil
+  movsx rsi, byte ptr [rip+g3154]
+  add rsi, qword ptr [rip+g1498]
+  mov qword ptr [rip+g2608], rsi
+  movsx rsi, byte ptr [rip+g2505]
+  movsx rdi, byte ptr [rip+g3966]
+  add rsi, rdi
+  mov qword ptr [rip+g2609], rsi
+  movsxd rsi, dword ptr [rip+g2600]
+  mov rax, rsi
+.L.return.u260:
+  ret
+.text
+.p2align 4
+.global u261
+u261:
+  mov rsi, qword ptr [rip+g2618]
+  add rsi, qword ptr [rip+g348]
+  mov dword ptr [rip+g2610], esi
+  movsx rsi, word ptr [rip+g1900]
+  movsx rdi, word ptr [rip+g4156]
+  add rsi, rdi
+  mov qword ptr [rip+g2611], rsi
+  movsx rsi, byte ptr [rip+g3501]
+  movsx rdi, byte ptr [rip+g41]
+  add rsi, rdi
+  mov word ptr [rip+g2612], si
+  movsx rsi, word ptr [rip+g4327]
+  movsx rdi, byte ptr [rip+g1080]
+  add rsi, rdi
+  mov byte ptr [rip+g2613], sil
+  movsxd rsi, dword ptr [rip+g3369]
+  movsx rdi, word ptr [rip+g2079]
+  add rsi, rdi
+  mov dword ptr [rip+g2614], esi
+  mov rsi, qword ptr [rip+g593]
+  movsx rdi, byte ptr [rip+g634]
+  add rsi, rdi
+  mov word ptr [rip+g2615], si
+  movsx rsi, byte ptr [rip+g3868]
+  movsxd rdi, dword ptr [rip+g2107]
+  add rsi, rdi
+  mov word ptr [rip+g2616], si
+  movsx rsi, byte ptr [rip+g4549]
+  add rsi, qword ptr [rip+g3343]
+  mov qword ptr [rip+g2617], rsi
+  movsx rsi, byte ptr [rip+g973]
+  movsx rdi, byte ptr [rip+g52]
+  add rsi, rdi
+  mov qword ptr [rip+g2618], rsi
+  mov rsi, qword ptr [rip+g4509]
+  movsx rdi, byte ptr [rip+g3252]
+  add rsi, rdi
+  mov byte ptr [rip+g2619], sil
+  movsxd rsi, dword ptr [rip+g2610]
+  mov rax, rsi
+.L.return.u261:
+  ret
+.text
+.p2align 4
+.global u262
+u262:
+  movsx rsi, byte ptr [rip+g4558]
+  movsx rdi, byte ptr [rip+g3668]
+  add rsi, rdi
+  mov dword ptr [rip+g2620], esi
+  movsx rsi, byte ptr [rip+g172]
+  movsx rdi, byte ptr [rip+g4201]
+  add rsi, rdi
+  mov dword ptr [rip+g2621], esi
+  mov rsi, qword ptr [rip+g3147]
+  movsx rdi, word ptr [rip+g1847]
+  add rsi, rdi
+  mov word ptr [rip+g2622], si
+  movsxd rsi, dword ptr [rip+g4010]
+  movsxd rdi, dword ptr [rip+g2986]
+  add rsi, rdi
+  mov byte ptr [rip+g2623], sil
+  movsx rsi, word ptr [rip+g2126]
+  movsx rdi, word ptr [rip+g3391]
+  add rsi, rdi
+  mov dword ptr [rip+g2624], esi
+  movsx rsi, byte ptr [rip+g4127]
+  movsx rdi, word ptr [rip+g3746]
+  add rsi, rdi
+  mov word ptr [rip+g2625], si
+  movsx rsi, byte ptr [rip+g1154]
+  movsx rdi, byte ptr [rip+g4640]
+  add rsi, rdi
+  mov dword ptr [rip+g2626], esi
+  movsxd rsi, dword ptr [rip+g4585]
+  movsxd rdi, dword ptr [rip+g3699]
+  add rsi, rdi
+  mov byte ptr [rip+g2627], sil
+  movsxd rsi, dword ptr [rip+g1321]
+  add rsi, qword ptr [rip+g811]
+  mov dword ptr [rip+g2628], esi
+  movsxd rsi, dword ptr [rip+g3332]
+  movsxd rdi, dword ptr [rip+g4453]
+  add rsi, rdi
+  mov qword ptr [rip+g2629], rsi
+  movsxd rsi, dword ptr [rip+g2620]
+  mov rax, rsi
+.L.return.u262:
+  ret
+.text
+.p2align 4
+.global u263
+u263:
+  movsxd rsi, dword ptr [rip+g1588]
+  movsx rdi, byte ptr [rip+g3798]
+  add rsi, rdi
+  mov qword ptr [rip+g2630], rsi
+  movsx rsi, byte ptr [rip+g3738]
+  movsxd rdi, dword ptr [rip+g1135]
+  add rsi, rdi
+  mov byte ptr [rip+g2631], sil
+  movsxd rsi, dword ptr [rip+g149]
+  add rsi, qword ptr [rip+g676]
+  mov dword ptr [rip+g2632], esi
+  movsx rsi, byte ptr [rip+g3207]
+  add rsi, qword ptr [rip+g3763]
+  mov qword ptr [rip+g2633], rsi
+  mov rsi, qword ptr [rip+g2001]
+  movsx rdi, byte ptr [rip+g2725]
+  add rsi, rdi
+  mov dword ptr [rip+g2634], esi
+  movsx rsi, word ptr [rip+g2799]
+  movsx rdi, byte ptr [rip+g1508]
+  add rsi, rdi
+  mov dword ptr [rip+g2635], esi
+  mov rsi, qword ptr [rip+g2754]
+  movsx rdi, byte ptr [rip+g4606]
+  add rsi, rdi
+  mov word ptr [rip+g2636], si
+  movsxd rsi, dword ptr [rip+g455]
+  movsx rdi, byte ptr [rip+g1620]
+  add rsi, rdi
+  mov word ptr [rip+g2637], si
+  mov rsi, qword ptr [rip+g3730]
+  movsxd rdi, dword ptr [rip+g1773]
+  add rsi, rdi
+  mov qword ptr [rip+g2638], rsi
+  movsxd rsi, dword ptr [rip+g1029]
+  movsxd rdi, dword ptr [rip+g1307]
+  add rsi, rdi
+  mov dword ptr [rip+g2639], esi
+  mov rax, qword ptr [rip+g2630]
+.L.return.u263:
+  ret
+.text
+.p2align 4
+.global u264
+u264:
+  movsx rsi, word ptr [rip+g4784]
+  movsxd rdi, dword ptr [rip+g1319]
+  add rsi, rdi
+  mov byte ptr [rip+g2640], sil
+  movsx rsi, byte ptr [rip+g3506]
+  add rsi, qword ptr [rip+g1300]
+  mov byte ptr [rip+g2641], sil
+  movsx rsi, word ptr [rip+g1796]
+  add rsi, qword ptr [rip+g3965]
+  mov dword ptr [rip+g2642], esi
+  movsx rsi, word ptr [rip+g940]
+  movsx rdi, word ptr [rip+g1622]
+  add rsi, rdi
+  mov dword ptr [rip+g2643], esi
+  movsx rsi, word ptr [rip+g768]
+  add rsi, qword ptr [rip+g4504]
+  mov qword ptr [rip+g2644], rsi
+  mov rsi, qword ptr [rip+g4319]
+  add rsi, qword ptr [rip+g1344]
+  mov word ptr [rip+g2645], si
+  mov rsi, qword ptr [rip+g3456]
+  movsx rdi, word ptr [rip+g4397]
+  add rsi, rdi
+  mov byte ptr [rip+g2646], sil
+  movsxd rsi, dword ptr [rip+g669]
+  movsx rdi, word ptr [rip+g1075]
+  add rsi, rdi
+  mov qword ptr [rip+g2647], rsi
+  movsx rsi, word ptr [rip+g4978]
+  add rsi, qword ptr [rip+g352]
+  mov dword ptr [rip+g2648], esi
+  mov rsi, qword ptr [rip+g470]
+  movsx rdi, word ptr [rip+g2970]
+  add rsi, rdi
+  mov qword ptr [rip+g2649], rsi
+  movsx rsi, byte ptr [rip+g2640]
+  mov rax, rsi
+.L.return.u264:
+  ret
+.text
+.p2align 4
+.global u265
+u265:
+  movsxd rsi, dword ptr [rip+g2794]
+  movsx rdi, byte ptr [rip+g3863]
+  add rsi, rdi
+  mov qword ptr [rip+g2650], rsi
+  movsx rsi, byte ptr [rip+g2955]
+  movsx rdi, byte ptr [rip+g2831]
+  add rsi, rdi
+  mov word ptr [rip+g2651], si
+  movsxd rsi, dword ptr [rip+g2349]
+  movsx rdi, byte ptr [rip+g2822]
+  add rsi, rdi
+  mov word ptr [rip+g2652], si
+  movsx rsi, word ptr [rip+g806]
+  movsx rdi, byte ptr [rip+g2044]
+  add rsi, rdi
+  mov byte ptr [rip+g2653], sil
+  movsx rsi, word ptr [rip+g1110]
+  movsxd rdi, dword ptr [rip+g1000]
+  add rsi, rdi
+  mov qword ptr [rip+g2654], rsi
+  movsx rsi, word ptr [rip+g2370]
+  movsx rdi, word ptr [rip+g3991]
+  add rsi, rdi
+  mov byte ptr [rip+g2655], sil
+  movsx rsi, byte ptr [rip+g2699]
+  add rsi, qword ptr [rip+g1300]
+  mov dword ptr [rip+g2656], esi
+  movsxd rsi, dword ptr [rip+g3191]
+  movsx rdi, word ptr [rip+g3914]
+  add rsi, rdi
+  mov word ptr [rip+g2657], si
+  movsx rsi, word ptr [rip+g4362]
+  movsxd rdi, dword ptr [rip+g1581]
+  add rsi, rdi
+  mov byte ptr [rip+g2658], sil
+  movsx rsi, word ptr [rip+g4082]
+  movsx rdi, word ptr [rip+g1329]
+  add rsi, rdi
+  mov word ptr [rip+g2659], si
+  mov rax, qword ptr [rip+g2650]
+.L.return.u265:
+  ret
+.text
+.p2align 4
+.global u266
+u266:
+  movsxd rsi, dword ptr [rip+g898]
+  movsxd rdi, dword ptr [rip+g1752]
+  add rsi, rdi
+  mov byte ptr [rip+g2660], sil
+  movsx rsi, word ptr [rip+g2539]
+  movsxd rdi, dword ptr [rip+g1775]
+  add rsi, rdi
+  mov qword ptr [rip+g2661], rsi
+  movsxd rsi, dword ptr [rip+g1333]
+  movsx rdi, word ptr [rip+g620]
+  add rsi, rdi
+  mov byte ptr [rip+g2662], sil
+  movsx rsi, byte ptr [rip+g2803]
+  movsxd rdi, dword ptr [rip+g3667]
+  add rsi, rdi
+  mov dword ptr [rip+g2663], esi
+  movsx rsi, byte ptr [rip+g472]
+  add rsi, qword ptr [rip+g369]
+  mov qword ptr [rip+g2664], rsi
+  movsxd rsi, dword ptr [rip+g4444]
+  movsx rdi, byte ptr [rip+g27]
+  add rsi, rdi
+  mov byte ptr [rip+g2665], sil
+  movsx rsi, word ptr [rip+g3027]
+  add rsi, qword ptr [rip+g607]
+  mov byte ptr [rip+g2666], sil
+  movsx rsi, byte ptr [rip+g3643]
+  add rsi, qword ptr [rip+g759]
+  mov word ptr [rip+g2667], si
+  movsx rsi, word ptr [rip+g1189]
+  add rsi, qword ptr [rip+g988]
+  mov word ptr [rip+g2668], si
+  movsxd rsi, dword ptr [rip+g4455]
+  add rsi, qword ptr [rip+g4492]
+  mov word ptr [rip+g2669], si
+  movsx rsi, byte ptr [rip+g2660]
+  mov rax, rsi
+.L.return.u266:
+  ret
+.text
+.p2align 4
+.global u267
+u267:
+  movsxd rsi, dword ptr [rip+g2899]
+  add rsi, qword ptr [rip+g2759]
+  mov qword ptr [rip+g2670], rsi
+  mov rsi, qword ptr [rip+g4567]
+  movsxd rdi, dword ptr [rip+g2429]
+  add rsi, rdi
+  mov byte ptr [rip+g2671], sil
+  mov rsi, qword ptr [rip+g3070]
+  movsxd rdi, dword ptr [rip+g786]
+  add rsi, rdi
+  mov qword ptr [rip+g2672], rsi
+  movsx rsi, byte ptr [rip+g4371]
+  add rsi, qword ptr [rip+g4171]
+  mov word ptr [rip+g2673], si
+  movsxd rsi, dword ptr [rip+g866]
+  movsx rdi, byte ptr [rip+g1176]
+  add rsi, rdi
+  mov byte ptr [rip+g2674], sil
+  movsxd rsi, dword ptr [rip+g1949]
+  movsx rdi, byte ptr [rip+g3919]
+  add rsi, rdi
+  mov qword ptr [rip+g2675], rsi
+  movsx rsi, byte ptr [rip+g4730]
+  movsxd rdi, dword ptr [rip+g1049]
+  add rsi, rdi
+  mov word ptr [rip+g2676], si
+  movsx rsi, word ptr [rip+g471]
+  movsx rdi, byte ptr [rip+g4730]
+  add rsi, rdi
+  mov qword ptr [rip+g2677], rsi
+  movsx rsi, word ptr [rip+g4344]
+  movsxd rdi, dword ptr [rip+g1574]
+  add rsi, rdi
+  mov word ptr [rip+g2678], si
+  movsx rsi, byte ptr [rip+g3924]
+  movsxd rdi, dword ptr [rip+g4768]
+  add rsi, rdi
+  mov byte ptr [rip+g2679], sil
+  mov rax, qword ptr [rip+g2670]
+.L.return.u267:
+  ret
+.text
+.p2align 4
+.global u268
+u268:
+  movsx rsi, byte ptr [rip+g1374]
+  movsx rdi, byte ptr [rip+g1667]
+  add rsi, rdi
+  mov byte ptr [rip+g2680], sil
+  movsxd rsi, dword ptr [rip+g2544]
+  movsx rdi, byte ptr [rip+g2311]
+  add rsi, rdi
+  mov qword ptr [rip+g2681], rsi
+  movsx rsi, byte ptr [rip+g4355]
+  add rsi, qword ptr [rip+g658]
+  mov dword ptr [rip+g2682], esi
+  movsx rsi, byte ptr [rip+g2262]
+  movsx rdi, word ptr [rip+g47]
+  add rsi, rdi
+  mov byte ptr [rip+g2683], sil
+  movsx rsi, word ptr [rip+g1553]
+  movsxd rdi, dword ptr [rip+g1777]
+  add rsi, rdi
+  mov word ptr [rip+g2684], si
+  movsxd rsi, dword ptr [rip+g2347]
+  movsxd rdi, dword ptr [rip+g2794]
+  add rsi, rdi
+  mov word ptr [rip+g2685], si
+  movsx rsi, byte ptr [rip+g4640]
+  add rsi, qword ptr [rip+g4187]
+  mov byte ptr [rip+g2686], sil
+  movsx rsi, byte ptr [rip+g4831]
+  movsxd rdi, dword ptr [rip+g3466]
+  add rsi, rdi
+  mov dword ptr [rip+g2687], esi
+  movsxd rsi, dword ptr [rip+g4315]
+  add rsi, qword ptr [rip+g64]
+  mov word ptr [rip+g2688], si
+  movsxd rsi, dword ptr [rip+g4865]
+  add rsi, qword ptr [rip+g1453]
+  mov byte ptr [rip+g2689], sil
+  movsx rsi, byte ptr [rip+g2680]
+  mov rax, rsi
+.L.return.u268:
+  ret
+.text
+.p2align 4
+.global u269
+u269:
+  movsx rsi, byte ptr [rip+g4167]
+  movsx rdi, byte ptr [rip+g994]
+  add rsi, rdi
+  mov word ptr [rip+g2690], si
+  movsx rsi, byte ptr [rip+g1595]
+  movsxd rdi, dword ptr [rip+g2995]
+  add rsi, rdi
+  mov dword ptr [rip+g2691], esi
+  movsx rsi, byte ptr [rip+g575]
+  movsx rdi, byte ptr [rip+g1251]
+  add rsi, rdi
+  mov word ptr [rip+g2692], si
+  movsxd rsi, dword ptr [rip+g949]
+  movsx rdi, byte ptr [rip+g2601]
+  add rsi, rdi
+  mov qword ptr [rip+g2693], rsi
+  movsxd rsi, dword ptr [rip+g3810]
+  movsxd rdi, dword ptr [rip+g553]
+  add rsi, rdi
+  mov byte ptr [rip+g2694], sil
+  movsxd rsi, dword ptr [rip+g1649]
+  movsxd rdi, dword ptr [rip+g3260]
+  add rsi, rdi
+  mov dword ptr [rip+g2695], esi
+  movsx rsi, byte ptr [rip+g1789]
+  add rsi, qword ptr [rip+g3489]
+  mov byte ptr [rip+g2696], sil
+  movsx rsi, byte ptr [rip+g4809]
+  movsx rdi, byte ptr [rip+g2101]
+  add rsi, rdi
+  mov byte ptr [rip+g2697], sil
+  movsx rsi, word ptr [rip+g123]
+  movsxd rdi, dword ptr [rip+g108]
+  add rsi, rdi
+  mov dword ptr [rip+g2698], esi
+  mov rsi, qword ptr [rip+g2533]
+  add rsi, qword ptr [rip+g137]
+  mov byte ptr [rip+g2699], sil
+  movsx rsi, word ptr [rip+g2690]
+  mov rax, rsi
+.L.return.u269:
+  ret
+.text
+.p2align 4
+.global u270
+u270:
+  mov rsi, qword ptr [rip+g1366]
+  movsxd rdi, dword ptr [rip+g4460]
+  add rsi, rdi
+  mov dword ptr [rip+g2700], esi
+  movsx rsi, word ptr [rip+g1900]
+  movsx rdi, byte ptr [rip+g1559]
+  add rsi, rdi
+  mov byte ptr [rip+g2701], sil
+  mov rsi, qword ptr [rip+g1424]
+  add rsi, qword ptr [rip+g3697]
+  mov qword ptr [rip+g2702], rsi
+  movsx rsi, byte ptr [rip+g4807]
+  movsxd rdi, dword ptr [rip+g4825]
+  add rsi, rdi
+  mov qword ptr [rip+g2703], rsi
+  movsx rsi, byte ptr [rip+g235]
+  movsx rdi, byte ptr [rip+g1694]
+  add rsi, rdi
+  mov word ptr [rip+g2704], si
+  mov rsi, qword ptr [rip+g1721]
+  add rsi, qword ptr [rip+g2402]
+  mov byte ptr [rip+g2705], sil
+  movsx rsi, word ptr [rip+g4136]
+  add rsi, qword ptr [rip+g348]
+  mov byte ptr [rip+g2706], sil
+  movsxd rsi, dword ptr [rip+g4475]
+  movsxd rdi, dword ptr [rip+g1483]
+  add rsi, rdi
+  mov byte ptr [rip+g2707], sil
+  movsxd rsi, dword ptr [rip+g866]
+  movsx rdi, byte ptr [rip+g2386]
+  add rsi, rdi
+  mov qword ptr [rip+g2708], rsi
+  movsxd rsi, dword ptr [rip+g1886]
+  movsx rdi, byte ptr [rip+g132]
+  add rsi, rdi
+  mov dword ptr [rip+g2709], esi
+  movsxd rsi, dword ptr [rip+g2700]
+  mov rax, rsi
+.L.return.u270:
+  ret
+.text
+.p2align 4
+.global u271
+u271:
+  mov rsi, qword ptr [rip+g2754]
+  movsxd rdi, dword ptr [rip+g337]
+  add rsi, rdi
+  mov dword ptr [rip+g2710], esi
+  mov rsi, qword ptr [rip+g1140]
+  add rsi, qword ptr [rip+g3959]
+  mov dword ptr [rip+g2711], esi
+  movsx rsi, byte ptr [rip+g3499]
+  add rsi, qword ptr [rip+g3941]
+  mov qword ptr [rip+g2712], rsi
+  mov rsi, qword ptr [rip+g4390]
+  movsxd rdi, dword ptr [rip+g3648]
+  add rsi, rdi
+  mov dword ptr [rip+g2713], esi
+  mov rsi, qword ptr [rip+g2815]
+  add rsi, qword ptr [rip+g2073]
+  mov dword ptr [rip+g2714], esi
+  movsxd rsi, dword ptr [rip+g70]
+  add rsi, qword ptr [rip+g3963]
+  mov qword ptr [rip+g2715], rsi
+  movsxd rsi, dword ptr [rip+g3972]
+  movsx rdi, word ptr [rip+g183]
+  add rsi, rdi
+  mov dword ptr [rip+g2716], esi
+  mov rsi, qword ptr [rip+g297]
+  movsxd rdi, dword ptr [rip+g3823]
+  add rsi, rdi
+  mov byte ptr [rip+g2717], sil
+  movsx rsi, word ptr [rip+g641]
+  add rsi, qword ptr [rip+g40]
+  mov qword ptr [rip+g2718], rsi
+  mov rsi, qword ptr [rip+g320]
+  movsxd rdi, dword ptr [rip+g4413]
+  add rsi, rdi
+  mov qword ptr [rip+g2719], rsi
+  movsxd rsi, dword ptr [rip+g2710]
+  mov rax, rsi
+.L.return.u271:
+  ret
+.text
+.p2align 4
+.global u272
+u272:
+  mov rsi, qword ptr [rip+g4946]
+  movsx rdi, word ptr [rip+g143]
+  add rsi, rdi
+  mov dword ptr [rip+g2720], esi
+  mov rsi, qword ptr [rip+g377]
+  add rsi, qword ptr [rip+g4651]
+  mov byte ptr [rip+g2721], sil
+  movsx rsi, byte ptr [rip+g3097]
+  movsx rdi, word ptr [rip+g1855]
+  add rsi, rdi
+  mov qword ptr [rip+g2722], rsi
+  movsx rsi, word ptr [rip+g2872]
+  movsxd rdi, dword ptr [rip+g1628]
+  add rsi, rdi
+  mov qword ptr [rip+g2723], rsi
+  movsxd rsi, dword ptr [rip+g1950]
+  movsx rdi, word ptr [rip+g1757]
+  add rsi, rdi
+  mov dword ptr [rip+g2724], esi
+  movsxd rsi, dword ptr [rip+g726]
+  movsxd rdi, dword ptr [rip+g1403]
+  add rsi, rdi
+  mov byte ptr [rip+g2725], sil
+  movsx rsi, byte ptr [rip+g198]
+  add rsi, qword ptr [rip+g3943]
+  mov word ptr [rip+g2726], si
+  mov rsi, qword ptr [rip+g283]
+  movsx rdi, byte ptr [rip+g3620]
+  add rsi, rdi
+  mov byte ptr [rip+g2727], sil
+  mov rsi, qword ptr [rip+g4778]
+  movsxd rdi, dword ptr [rip+g4148]
+  add rsi, rdi
+  mov byte ptr [rip+g2728], sil
+  movsx rsi, word ptr [rip+g2381]
+  movsx rdi, word ptr [rip+g3982]
+  add rsi, rdi
+  mov dword ptr [rip+g2729], esi
+  movsxd rsi, dword ptr [rip+g2720]
+  mov rax, rsi
+.L.return.u272:
+  ret
+.text
+.p2align 4
+.global u273
+u273:
+  mov rsi, qword ptr [rip+g4567]
+  add rsi, qword ptr [rip+g2881]
+  mov dword ptr [rip+g2730], esi
+  mov rsi, qword ptr [rip+g2245]
+  movsx rdi, byte ptr [rip+g2843]
+  add rsi, rdi
+  mov qword ptr [rip+g2731], rsi
+  mov rsi, qword ptr [rip+g2210]
+  add rsi, qword ptr [rip+g4842]
+  mov word ptr [rip+g2732], si
+  movsx rsi, byte ptr [rip+g1594]
+  add rsi, qword ptr [rip+g1300]
+  mov qword ptr [rip+g2733], rsi
+  mov rsi, qword ptr [rip+g1721]
+  movsx rdi, byte ptr [rip+g2214]
+  add rsi, rdi
+  mov qword ptr [rip+g2734], rsi
+  movsx rsi, byte ptr [rip+g3302]
+  movsx rdi, byte ptr [rip+g4133]
+  add rsi, rdi
+  mov dword ptr [rip+g2735], esi
+  movsx rsi, word ptr [rip+g269]
+  movsxd rdi, dword ptr [rip+g4132]
+  add rsi, rdi
+  mov word ptr [rip+g2736], si
+  movsx rsi, word ptr [rip+g2479]
+  movsx rdi, byte ptr [rip+g3864]
+  add rsi, rdi
+  mov dword ptr [rip+g2737], esi
+  movsxd rsi, dword ptr [rip+g3627]
+  add rsi, qword ptr [rip+g1612]
+  mov dword ptr [rip+g2738], esi
+  movsx rsi, word ptr [rip+g414]
+  add rsi, qword ptr [rip+g2787]
+  mov qword ptr [rip+g2739], rsi
+  movsxd rsi, dword ptr [rip+g2730]
+  mov rax, rsi
+.L.return.u273:
+  ret
+.text
+.p2align 4
+.global u274
+u274:
+  movsx rsi, byte ptr [rip+g532]
+  movsxd rdi, dword ptr [rip+g544]
+  add rsi, rdi
+  mov dword ptr [rip+g2740], esi
+  movsx rsi, word ptr [rip+g3562]
+  movsx rdi, word ptr [rip+g4863]
+  add rsi, rdi
+  mov dword ptr [rip+g2741], esi
+  movsx rsi, byte ptr [rip+g2212]
+  movsx rdi, byte ptr [rip+g656]
+  add rsi, rdi
+  mov word ptr [rip+g2742], si
+  mov rsi, qword ptr [rip+g675]
+  movsxd rdi, dword ptr [rip+g4419]
+  add rsi, rdi
+  mov qword ptr [rip+g2743], rsi
+  movsx rsi, word ptr [rip+g2215]
+  movsx rdi, byte ptr [rip+g4363]
+  add rsi, rdi
+  mov word ptr [rip+g2744], si
+  movsx rsi, word ptr [rip+g619]
+  add rsi, qword ptr [rip+g630]
+  mov byte ptr [rip+g2745], sil
+  movsx rsi, word ptr [rip+g519]
+  movsx rdi, word ptr [rip+g4812]
+  add rsi, rdi
+  mov qword ptr [rip+g2746], rsi
+  movsx rsi, byte ptr [rip+g132]
+  movsx rdi, byte ptr [rip+g3454]
+  add rsi, rdi
+  mov byte ptr [rip+g2747], sil
+  movsx rsi, byte ptr [rip+g4740]
+  add rsi, qword ptr [rip+g2444]
+  mov byte ptr [rip+g2748], sil
+  mov rsi, qword ptr [rip+g2183]
+  movsx rdi, byte ptr [rip+g1853]
+  add rsi, rdi
+  mov word ptr [rip+g2749], si
+  movsxd rsi, dword ptr [rip+g2740]
+  mov rax, rsi
+.L.return.u274:
+  ret
+.text
+.p2align 4
+.global u275
+u275:
+  mov rsi, qword ptr [rip+g2312]
+  movsx rdi, byte ptr [rip+g3908]
+  add rsi, rdi
+  mov dword ptr [rip+g2750], esi
+  movsx rsi, byte ptr [rip+g527]
+  movsx rdi, word ptr [rip+g1438]
+  add rsi, rdi
+  mov byte ptr [rip+g2751], sil
+  movsx rsi, word ptr [rip+g289]
+  movsx rdi, word ptr [rip+g2565]
+  add rsi, rdi
+  mov qword ptr [rip+g2752], rsi
+  movsxd rsi, dword ptr [rip+g2995]
+  movsx rdi, byte ptr [rip+g2255]
+  add rsi, rdi
+  mov dword ptr [rip+g2753], esi
+  movsx rsi, byte ptr [rip+g51]
+  add rsi, qword ptr [rip+g3473]
+  mov qword ptr [rip+g2754], rsi
+  movsxd rsi, dword ptr [rip+g108]
+  movsx rdi, byte ptr [rip+g444]
+  add rsi, rdi
+  mov dword ptr [rip+g2755], esi
+  movsxd rsi, dword ptr [rip+g810]
+  movsxd rdi, dword ptr [rip+g4413]
+  add rsi, rdi
+  mov dword ptr [rip+g2756], esi
+  movsxd rsi, dword ptr [rip+g3884]
+  add rsi, qword ptr [rip+g645]
+  mov byte ptr [rip+g2757], sil
+  movsx rsi, word ptr [rip+g2834]
+  movsx rdi, word ptr [rip+g752]
+  add rsi, rdi
+  mov qword ptr [rip+g2758], rsi
+  movsx rsi, word ptr [rip+g1732]
+  movsx rdi, word ptr [rip+g1684]
+  add rsi, rdi
+  mov qword ptr [rip+g2759], rsi
+  movsxd rsi, dword ptr [rip+g2750]
+  mov rax, rsi
+.L.return.u275:
+  ret
+.text
+.p2align 4
+.global u276
+u276:
+  movsxd rsi, dword ptr [rip+g2112]
+  movsx rdi, byte ptr [rip+g2717]
+  add rsi, rdi
+  mov byte ptr [rip+g2760], sil
+  movsxd rsi, dword ptr [rip+g2737]
+  movsx rdi, byte ptr [rip+g2071]
+  add rsi, rdi
+  mov qword ptr [rip+g2761], rsi
+  movsxd rsi, dword ptr [rip+g2603]
+  movsxd rdi, dword ptr [rip+g1489]
+  add rsi, rdi
+  mov dword ptr [rip+g2762], esi
+  movsxd rsi, dword ptr [rip+g478]
+  add rsi, qword ptr [rip+g3765]
+  mov byte ptr [rip+g2763], sil
+  mov rsi, qword ptr [rip+g3136]
+  add rsi, qword ptr [rip+g533]
+  mov qword ptr [rip+g2764], rsi
+  mov rsi, qword ptr [rip+g3158]
+  movsx rdi, word ptr [rip+g578]
+  add rsi, rdi
+  mov dword ptr [rip+g2765], esi
+  movsx rsi, byte ptr [rip+g4282]
+  movsx rdi, word ptr [rip+g2141]
+  add rsi, rdi
+  mov dword ptr [rip+g2766], esi
+  movsx rsi, byte ptr [rip+g557]
+  movsx rdi, word ptr [rip+g3090]
+  add rsi, rdi
+  mov qword ptr [rip+g2767], rsi
+  mov rsi, qword ptr [rip+g1844]
+  movsx rdi, byte ptr [rip+g2212]
+  add rsi, rdi
+  mov byte ptr [rip+g2768], sil
+  movsxd rsi, dword ptr [rip+g2635]
+  movsxd rdi, dword ptr [rip+g2716]
+  add rsi, rdi
+  mov dword ptr [rip+g2769], esi
+  movsx rsi, byte ptr [rip+g2760]
+  mov rax, rsi
+.L.return.u276:
+  ret
+.text
+.p2align 4
+.global u277
+u277:
+  movsx rsi, word ptr [rip+g2187]
+  movsx rdi, word ptr [rip+g443]
+  add rsi, rdi
+  mov byte ptr [rip+g2770], sil
+  movsx rsi, byte ptr [rip+g1617]
+  add rsi, qword ptr [rip+g1087]
+  mov dword ptr [rip+g2771], esi
+  movsx rsi, word ptr [rip+g4402]
+  add rsi, qword ptr [rip+g3270]
+  mov dword ptr [rip+g2772], esi
+  mov rsi, qword ptr [rip+g2451]
+  movsxd rdi, dword ptr [rip+g1235]
+  add rsi, rdi
+  mov byte ptr [rip+g2773], sil
+  movsxd rsi, dword ptr [rip+g544]
+  add rsi, qword ptr [rip+g4395]
+  mov word ptr [rip+g2774], si
+  movsx rsi, word ptr [rip+g2973]
+  movsx rdi, byte ptr [rip+g2725]
+  add rsi, rdi
+  mov word ptr [rip+g2775], si
+  movsx rsi, byte ptr [rip+g3307]
+  movsx rdi, byte ptr [rip+g2705]
+  add rsi, rdi
+  mov dword ptr [rip+g2776], esi
+  movsxd rsi, dword ptr [rip+g2795]
+  movsx rdi, word ptr [rip+g4291]
+  add rsi, rdi
+  mov byte ptr [rip+g2777], sil
+  movsx rsi, byte ptr [rip+g1302]
+  add rsi, qword ptr [rip+g243]
+  mov byte ptr [rip+g2778], sil
+  movsx rsi, word ptr [rip+g1965]
+  movsx rdi, word ptr [rip+g3405]
+  add rsi, rdi
+  mov byte ptr [rip+g2779], sil
+  movsx rsi, byte ptr [rip+g2770]
+  mov rax, rsi
+.L.return.u277:
+  ret
+.text
+.p2align 4
+.global u278
+u278:
+  movsx rsi, byte ptr [rip+g3115]
+  movsx rdi, byte ptr [rip+g1602]
+  add rsi, rdi
+  mov dword ptr [rip+g2780], esi
+  movsxd rsi, dword ptr [rip+g2413]
+  movsx rdi, byte ptr [rip+g4568]
+  add rsi, rdi
+  mov dword ptr [rip+g2781], esi
+  movsx rsi, word ptr [rip+g919]
+  movsx rdi, byte ptr [rip+g4240]
+  add rsi, rdi
+  mov dword ptr [rip+g2782], esi
+  mov rsi, qword ptr [rip+g2761]
+  movsx rdi, word ptr [rip+g1]
+  add rsi, rdi
+  mov byte ptr [rip+g2783], sil
+  movsx rsi, byte ptr [rip+g4605]
+  movsx rdi, word ptr [rip+g680]
+  add rsi, rdi
+  mov qword ptr [rip+g2784], rsi
+  movsxd rsi, dword ptr [rip+g2572]
+  add rsi, qword ptr [rip+g1424]
+  mov word ptr [rip+g2785], si
+  movsx rsi, byte ptr [rip+g575]
+  movsxd rdi, dword ptr [rip+g2944]
+  add rsi, rdi
+  mov qword ptr [rip+g2786], rsi
+  movsx rsi, word ptr [rip+g4975]
+  movsx rdi, byte ptr [rip+g1963]
+  add rsi, rdi
+  mov qword ptr [rip+g2787], rsi
+  mov rsi, qword ptr [rip+g3879]
+  movsx rdi, byte ptr [rip+g4441]
+  add rsi, rdi
+  mov word ptr [rip+g2788], si
+  movsxd rsi, dword ptr [rip+g1267]
+  add rsi, qword ptr [rip+g4431]
+  mov word ptr [rip+g2789], si
+  movsxd rsi, dword ptr [rip+g2780]
+  mov rax, rsi
+.L.return.u278:
+  ret
+.text
+.p2align 4
+.global u279
+u279:
+  movsx rsi, word ptr [rip+g4675]
+  movsxd rdi, dword ptr [rip+g387]
+  add rsi, rdi
+  mov word ptr [rip+g2790], si
+  movsx rsi, byte ptr [rip+g3320]
+  movsx rdi, byte ptr [rip+g3736]
+  add rsi, rdi
+  mov word ptr [rip+g2791], si
+  movsx rsi, word ptr [rip+g429]
+  movsxd rdi, dword ptr [rip+g1731]
+  add rsi, rdi
+  mov word ptr [rip+g2792], si
+  movsx rsi, word ptr [rip+g2917]
+  movsx rdi, byte ptr [rip+g3924]
+  add rsi, rdi
+  mov word ptr [rip+g2793], si
+  mov rsi, qword ptr [rip+g3136]
+  movsx rdi, byte ptr [rip+g4584]
+  add rsi, rdi
+  mov dword ptr [rip+g2794], esi
+  movsx rsi, word ptr [rip+g429]
+  movsx rdi, byte ptr [rip+g1043]
+  add rsi, rdi
+  mov dword ptr [rip+g2795], esi
+  mov rsi, qword ptr [rip+g3965]
+  movsx rdi, byte ptr [rip+g3062]
+  add rsi, rdi
+  mov dword ptr [rip+g2796], esi
+  movsx rsi, word ptr [rip+g182]
+  movsx rdi, byte ptr [rip+g327]
+  add rsi, rdi
+  mov byte ptr [rip+g2797], sil
+  mov rsi, qword ptr [rip+g4438]
+  movsx rdi, byte ptr [rip+g3514]
+  add rsi, rdi
+  mov qword ptr [rip+g2798], rsi
+  mov rsi, qword ptr [rip+g520]
+  add rsi, qword ptr [rip+g2549]
+  mov word ptr [rip+g2799], si
+  movsx rsi, word ptr [rip+g2790]
+  mov rax, rsi
+.L.return.u279:
+  ret
+.text
+.p2align 4
+.global u280
+u280:
+  mov rsi, qword ptr [rip+g982]
+  movsx rdi, byte ptr [rip+g366]
+  add rsi, rdi
+  mov qword ptr [rip+g2800], rsi
+  mov rsi, qword ptr [rip+g2786]
+  movsx rdi, byte ptr [rip+g1020]
+  add rsi, rdi
+  mov qword ptr [rip+g2801], rsi
+  movsxd rsi, dword ptr [rip+g3807]
+  movsxd rdi, dword ptr [rip+g3629]
+  add rsi, rdi
+  mov word ptr [rip+g2802], si
+  movsx rsi, word ptr [rip+g4976]
+  movsx rdi, byte ptr [rip+g2293]
+  add rsi, rdi
+  mov byte ptr [rip+g2803], sil
+  movsxd rsi, dword ptr [rip+g1701]
+  movsxd rdi, dword ptr [rip+g714]
+  add rsi, rdi
+  mov byte ptr [rip+g2804], sil
+  movsxd rsi, dword ptr [rip+g4911]
+  movsx rdi, byte ptr [rip+g1320]
+  add rsi, rdi
+  mov qword ptr [rip+g2805], rsi
+  movsx rsi, byte ptr [rip+g4864]
+  movsxd rdi, dword ptr [rip+g2766]
+  add rsi, rdi
+  mov dword ptr [rip+g2806], esi
+  movsxd rsi, dword ptr [rip+g3556]
+  movsxd rdi, dword ptr [rip+g4971]
+  add rsi, rdi
+  mov dword ptr [rip+g2807], esi
+  movsxd rsi, dword ptr [rip+g2524]
+  movsx rdi, word ptr [rip+g4373]
+  add rsi, rdi
+  mov dword ptr [rip+g2808], esi
+  movsx rsi, byte ptr [rip+g1492]
+  add rsi, qword ptr [rip+g1221]
+  mov qword ptr [rip+g2809], rsi
+  mov rax, qword ptr [rip+g2800]
+.L.return.u280:
+  ret
+.text
+.p2align 4
+.global u281
+u281:
+  movsxd rsi, dword ptr [rip+g1838]
+  movsx rdi, word ptr [rip+g2121]
+  add rsi, rdi
+  mov word ptr [rip+g2810], si
+  movsx rsi, word ptr [rip+g4774]
+  movsx rdi, word ptr [rip+g4046]
+  add rsi, rdi
+  mov qword ptr [rip+g2811], rsi
+  movsxd rsi, dword ptr [rip+g1254]
+  movsx rdi, byte ptr [rip+g3595]
+  add rsi, rdi
+  mov dword ptr [rip+g2812], esi
+  movsx rsi, byte ptr [rip+g2051]
+  add rsi, qword ptr [rip+g1025]
+  mov byte ptr [rip+g2813], sil
+  movsx rsi, word ptr [rip+g2297]
+  movsx rdi, byte ptr [rip+g172]
+  add rsi, rdi
+  mov qword ptr [rip+g2814], rsi
+  movsx rsi, word ptr [rip+g3774]
+  movsx rdi, word ptr [rip+g200]
+  add rsi, rdi
+  mov qword ptr [rip+g2815], rsi
+  mov rsi, qword ptr [rip+g3238]
+  add rsi, qword ptr [rip+g1394]
+  mov dword ptr [rip+g2816], esi
+  mov rsi, qword ptr [rip+g1090]
+  add rsi, qword ptr [rip+g657]
+  mov byte ptr [rip+g2817], sil
+  movsx rsi, word ptr [rip+g1181]
+  add rsi, qword ptr [rip+g4197]
+  mov byte ptr [rip+g2818], sil
+  movsxd rsi, dword ptr [rip+g4381]
+  movsx rdi, word ptr [rip+g118]
+  add rsi, rdi
+  mov byte ptr [rip+g2819], sil
+  movsx rsi, word ptr [rip+g2810]
+  mov rax, rsi
+.L.return.u281:
+  ret
+.text
+.p2align 4
+.global u282
+u282:
+  mov rsi, qword ptr [rip+g4359]
+  movsxd rdi, dword ptr [rip+g1804]
+  add rsi, rdi
+  mov byte ptr [rip+g2820], sil
+  movsx rsi, byte ptr [rip+g3372]
+  movsx rdi, word ptr [rip+g2568]
+  add rsi, rdi
+  mov dword ptr [rip+g2821], esi
+  movsx rsi, word ptr [rip+g1165]
+  movsxd rdi, dword ptr [rip+g418]
+  add rsi, rdi
+  mov byte ptr [rip+g2822], sil
+  movsx rsi, word ptr [rip+g1257]
+  add rsi, qword ptr [rip+g1565]
+  mov byte ptr [rip+g2823], sil
+  movsx rsi, word ptr [rip+g4091]
+  movsx rdi, word ptr [rip+g3160]
+  add rsi, rdi
+  mov dword ptr [rip+g2824], esi
+  movsxd rsi, dword ptr [rip+g154]
+  movsxd rdi, dword ptr [rip+g2209]
+  add rsi, rdi
+  mov dword ptr [rip+g2825], esi
+  movsx rsi, byte ptr [rip+g1324]
+  movsx rdi, byte ptr [rip+g4638]
+  add rsi, rdi
+  mov qword ptr [rip+g2826], rsi
+  movsx rsi, byte ptr [rip+g4754]
+  add rsi, qword ptr [rip+g3322]
+  mov dword ptr [rip+g2827], esi
+  mov rsi, qword ptr [rip+g4230]
+  movsxd rdi, dword ptr [rip+g1834]
+  add rsi, rdi
+  mov qword ptr [rip+g2828], rsi
+  mov rsi, qword ptr [rip+g378]
+  movsx rdi, byte ptr [rip+g747]
+  add rsi, rdi
+  mov word ptr [rip+g2829], si
+  movsx rsi, byte ptr [rip+g2820]
+  mov rax, rsi
+.L.return.u282:
+  ret
+.text
+.p2align 4
+.global u283
+u283:
+  mov rsi, qword ptr [rip+g2629]
+  movsxd rdi, dword ptr [rip+g2687]
+  add rsi, rdi
+  mov dword ptr [rip+g2830], esi
+  movsx rsi, word ptr [rip+g3940]
+  movsx rdi, word ptr [rip+g4827]
+  add rsi, rdi
+  mov byte ptr [rip+g2831], sil
+  movsxd rsi, dword ptr [rip+g1752]
+  movsx rdi, word ptr [rip+g47]
+  add rsi, rdi
+  mov qword ptr [rip+g2832], rsi
+  mov rsi, qword ptr [rip+g243]
+  movsxd rdi, dword ptr [rip+g865]
+  add rsi, rdi
+  mov qword ptr [rip+g2833], rsi
+  movsx rsi, word ptr [rip+g1553]
+  movsx rdi, byte ptr [rip+g4793]
+  add rsi, rdi
+  mov word ptr [rip+g2834], si
+  mov rsi, qword ptr [rip+g3739]
+  movsx rdi, word ptr [rip+g1578]
+  add rsi, rdi
+  mov byte ptr [rip+g2835], sil
+  movsx rsi, byte ptr [rip+g4669]
+  movsxd rdi, dword ptr [rip+g2028]
+  add rsi, rdi
+  mov dword ptr [rip+g2836], esi
+  movsx rsi, byte ptr [rip+g4034]
+  movsx rdi, byte ptr [rip+g1686]
+  add rsi, rdi
+  mov word ptr [rip+g2837], si
+  movsxd rsi, dword ptr [rip+g147]
+  add rsi, qword ptr [rip+g139]
+  mov word ptr [rip+g2838], si
+  mov rsi, qword ptr [rip+g2001]
+  movsx rdi, byte ptr [rip+g3764]
+  add rsi, rdi
+  mov qword ptr [rip+g2839], rsi
+  movsxd rsi, dword ptr [rip+g2830]
+  mov rax, rsi
+.L.return.u283:
+  ret
+.text
+.p2align 4
+.global u284
+u284:
+  movsxd rsi, dword ptr [rip+g924]
+  movsx rdi, byte ptr [rip+g1128]
+  add rsi, rdi
+  mov qword ptr [rip+g2840], rsi
+  movsx rsi, byte ptr [rip+g2299]
+  movsxd rdi, dword ptr [rip+g4202]
+  add rsi, rdi
+  mov qword ptr [rip+g2841], rsi
+  movsx rsi, byte ptr [rip+g3757]
+  add rsi, qword ptr [rip+g3822]
+  mov dword ptr [rip+g2842], esi
+  movsxd rsi, dword ptr [rip+g2769]
+  movsx rdi, word ptr [rip+g3129]
+  add rsi, rdi
+  mov byte ptr [rip+g2843], sil
+  movsx rsi, word ptr [rip+g3175]
+  movsx rdi, word ptr [rip+g670]
+  add rsi, rdi
+  mov word ptr [rip+g2844], si
+  movsx rsi, word ptr [rip+g248]
+  movsx rdi, word ptr [rip+g4725]
+  add rsi, rdi
+  mov byte ptr [rip+g2845], sil
+  movsx rsi, byte ptr [rip+g3812]
+  add rsi, qword ptr [rip+g3755]
+  mov word ptr [rip+g2846], si
+  movsxd rsi, dword ptr [rip+g4374]
+  movsx rdi, word ptr [rip+g590]
+  add rsi, rdi
+  mov word ptr [rip+g2847], si
+  mov rsi, qword ptr [rip+g4406]
+  movsxd rdi, dword ptr [rip+g2292]
+  add rsi, rdi
+  mov dword ptr [rip+g2848], esi
+  movsx rsi, word ptr [rip+g445]
+  add rsi, qword ptr [rip+g2481]
+  mov byte ptr [rip+g2849], sil
+  mov rax, qword ptr [rip+g2840]
+.L.return.u284:
+  ret
+.text
+.p2align 4
+.global u285
+u285:
+  movsx rsi, byte ptr [rip+g3537]
+  movsx rdi, word ptr [rip+g730]
+  add rsi, rdi
+  mov byte ptr [rip+g2850], sil
+  movsx rsi, byte ptr [rip+g3889]
+  add rsi, qword ptr [rip+g823]
+  mov byte ptr [rip+g2851], sil
+  movsxd rsi, dword ptr [rip+g3224]
+  add rsi, qword ptr [rip+g3141]
+  mov qword ptr [rip+g2852], rsi
+  movsx rsi, byte ptr [rip+g530]
+  add rsi, qword ptr [rip+g2153]
+  mov dword ptr [rip+g2853], esi
+  movsx rsi, byte ptr [rip+g3826]
+  movsxd rdi, dword ptr [rip+g4358]
+  add rsi, rdi
+  mov dword ptr [rip+g2854], esi
+  movsx rsi, byte ptr [rip+g632]
+  movsx rdi, word ptr [rip+g325]
+  add rsi, rdi
+  mov byte ptr [rip+g2855], sil
+  movsx rsi, word ptr [rip+g4452]
+  movsx rdi, word ptr [rip+g296]
+  add rsi, rdi
+  mov word ptr [rip+g2856], si
+  movsx rsi, word ptr [rip+g906]
+  movsx rdi, word ptr [rip+g4472]
+  add rsi, rdi
+  mov dword ptr [rip+g2857], esi
+  movsx rsi, byte ptr [rip+g172]
+  movsxd rdi, dword ptr [rip+g2713]
+  add rsi, rdi
+  mov word ptr [rip+g2858], si
+  movsx rsi, byte ptr [rip+g2680]
+  movsx rdi, byte ptr [rip+g1428]
+  add rsi, rdi
+  mov word ptr [rip+g2859], si
+  movsx rsi, byte ptr [rip+g2850]
+  mov rax, rsi
+.L.return.u285:
+  ret
+.text
+.p2align 4
+.global u286
+u286:
+  movsx rsi, byte ptr [rip+g2016]
+  movsx rdi, byte ptr [rip+g3561]
+  add rsi, rdi
+  mov dword ptr [rip+g2860], esi
+  movsxd rsi, dword ptr [rip+g110]
+  movsx rdi, byte ptr [rip+g4605]
+  add rsi, rdi
+  mov qword ptr [rip+g2861], rsi
+  movsx rsi, word ptr [rip+g1629]
+  add rsi, qword ptr [rip+g4850]
+  mov dword ptr [rip+g2862], esi
+  movsxd rsi, dword ptr [rip+g2109]
+  movsx rdi, byte ptr [rip+g4459]
+  add rsi, rdi
+  mov qword ptr [rip+g2863], rsi
+  movsx rsi, byte ptr [rip+g4936]
+  movsx rdi, word ptr [rip+g302]
+  add rsi, rdi
+  mov qword ptr [rip+g2864], rsi
+  movsxd rsi, dword ptr [rip+g525]
+  movsx rdi, byte ptr [rip+g1617]
+  add rsi, rdi
+  mov qword ptr [rip+g2865], rsi
+  movsx rsi, word ptr [rip+g1710]
+  movsx rdi, word ptr [rip+g1748]
+  add rsi, rdi
+  mov word ptr [rip+g2866], si
+  movsx rsi, word ptr [rip+g3324]
+  add rsi, qword ptr [rip+g4536]
+  mov dword ptr [rip+g2867], esi
+  movsx rsi, word ptr [rip+g4909]
+  movsxd rdi, dword ptr [rip+g3352]
+  add rsi, rdi
+  mov dword ptr [rip+g2868], esi
+  movsx rsi, word ptr [rip+g1618]
+  movsxd rdi, dword ptr [rip+g3092]
+  add rsi, rdi
+  mov word ptr [rip+g2869], si
+  movsxd rsi, dword ptr [rip+g2860]
+  mov rax, rsi
+.L.return.u286:
+  ret
+.text
+.p2align 4
+.global u287
+u287:
+  mov rsi, qword ptr [rip+g3540]
+  movsx rdi, byte ptr [rip+g3089]
+  add rsi, rdi
+  mov byte ptr [rip+g2870], sil
+  mov rsi, qword ptr [rip+g316]
+  movsx rdi, byte ptr [rip+g1569]
+  add rsi, rdi
+  mov qword ptr [rip+g2871], rsi
+  mov rsi, qword ptr [rip+g2718]
+  movsxd rdi, dword ptr [rip+g1950]
+  add rsi, rdi
+  mov word ptr [rip+g2872], si
+  movsxd rsi, dword ptr [rip+g4294]
+  movsx rdi, byte ptr [rip+g2727]
+  add rsi, rdi
+  mov word ptr [rip+g2873], si
+  movsx rsi, byte ptr [rip+g3035]
+  movsx rdi, byte ptr [rip+g4441]
+  add rsi, rdi
+  mov dword ptr [rip+g2874], esi
+  movsx rsi, byte ptr [rip+g1763]
+  movsx rdi, word ptr [rip+g2954]
+  add rsi, rdi
+  mov dword ptr [rip+g2875], esi
+  movsxd rsi, dword ptr [rip+g1705]
+  movsx rdi, word ptr [rip+g1587]
+  add rsi, rdi
+  mov word ptr [rip+g2876], si
+  movsx rsi, word ptr [rip+g2497]
+  movsxd rdi, dword ptr [rip+g4735]
+  add rsi, rdi
+  mov qword ptr [rip+g2877], rsi
+  mov rsi, qword ptr [rip+g1454]
+  add rsi, qword ptr [rip+g4207]
+  mov dword ptr [rip+g2878], esi
+  movsx rsi, word ptr [rip+g4440]
+  movsx rdi, byte ptr [rip+g2727]
+  add rsi, rdi
+  mov dword ptr [rip+g2879], esi
+  movsx rsi, byte ptr [rip+g2870]
+  mov rax, rsi
+.L.return.u287:
+  ret
+.text
+.p2align 4
+.global u288
+u288:
+  movsxd rsi, dword ptr [rip+g1926]
+  movsx rdi, word ptr [rip+g4344]
+  add rsi, rdi
+  mov dword ptr [rip+g2880], esi
+  movsxd rsi, dword ptr [rip+g4059]
+  movsx rdi, word ptr [rip+g397]
+  add rsi, rdi
+  mov qword ptr [rip+g2881], rsi
+  mov rsi, qword ptr [rip+g1150]
+  movsxd rdi, dword ptr [rip+g3554]
+  add rsi, rdi
+  mov byte ptr [rip+g2882], sil
+  movsx rsi, word ptr [rip+g1004]
+  movsx rdi, byte ptr [rip+g1048]
+  add rsi, rdi
+  mov dword ptr [rip+g2883], esi
+  movsx rsi, word ptr [rip+g360]
+  movsx rdi, word ptr [rip+g3925]
+  add rsi, rdi
+  mov word ptr [rip+g2884], si
+  mov rsi, qword ptr [rip+g1696]
+  add rsi, qword ptr [rip+g98]
+  mov qword ptr [rip+g2885], rsi
+  movsx rsi, byte ptr [rip+g2985]
+  movsx rdi, word ptr [rip+g2837]
+  add rsi, rdi
+  mov dword ptr [rip+g2886], esi
+  movsx rsi, word ptr [rip+g3259]
+  add rsi, qword ptr [rip+g2681]
+  mov word ptr [rip+g2887], si
+  movsxd rsi, dword ptr [rip+g162]
+  movsx rdi, word ptr [rip+g1876]
+  add rsi, rdi
+  mov word ptr [rip+g2888], si
+  mov rsi, qword ptr [rip+g983]
+  movsx rdi, byte ptr [rip+g973]
+  add rsi, rdi
+  mov dword ptr [rip+g2889], esi
+  movsxd rsi, dword ptr [rip+g2880]
+  mov rax, rsi
+.L.return.u288:
+  ret
+.text
+.p2align 4
+.global u289
+u289:
+  movsxd rsi, dword ptr [rip+g3994]
+  movsx rdi, byte ptr [rip+g4323]
+  add rsi, rdi
+  mov word ptr [rip+g2890], si
+  movsx rsi, word ptr [rip+g2884]
+  movsx rdi, word ptr [rip+g519]
+  add rsi, rdi
+  mov dword ptr [rip+g2891], esi
+  movsxd rsi, dword ptr [rip+g936]
+  movsx rdi, byte ptr [rip+g2302]
+  add rsi, rdi
+  mov byte ptr [rip+g2892], sil
+  movsx rsi, word ptr [rip+g100]
+  add rsi, qword ptr [rip+g748]
+  mov word ptr [rip+g2893], si
+  movsxd rsi, dword ptr [rip+g761]
+  add rsi, qword ptr [rip+g3112]
+  mov byte ptr [rip+g2894], sil
+  movsx rsi, byte ptr [rip+g2372]
+  movsx rdi, word ptr [rip+g1920]
+  add rsi, rdi
+  mov dword ptr [rip+g2895], esi
+  movsxd rsi, dword ptr [rip+g1891]
+  movsx rdi, word ptr [rip+g879]
+  add rsi, rdi
+  mov word ptr [rip+g2896], si
+  movsx rsi, word ptr [rip+g3342]
+  movsx rdi, byte ptr [rip+g4229]
+  add rsi, rdi
+  mov byte ptr [rip+g2897], sil
+  movsx rsi, word ptr [rip+g955]
+  movsxd rdi, dword ptr [rip+g230]
+  add rsi, rdi
+  mov byte ptr [rip+g2898], sil
+  movsx rsi, word ptr [rip+g1520]
+  movsx rdi, word ptr [rip+g4214]
+  add rsi, rdi
+  mov dword ptr [rip+g2899], esi
+  movsx rsi, word ptr [rip+g2890]
+  mov rax, rsi
+.L.return.u289:
+  ret
+.text
+.p2align 4
+.global u290
+u290:
+  movsx rsi, word ptr [rip+g4635]
+  add rsi, qword ptr [rip+g4564]
+  mov word ptr [rip+g2900], si
+  movsx rsi, byte ptr [rip+g652]
+  movsx rdi, byte ptr [rip+g3083]
+  add rsi, rdi
+  mov byte ptr [rip+g2901], sil
+  movsxd rsi, dword ptr [rip+g3029]
+  movsx rdi, byte ptr [rip+g2037]
+  add rsi, rdi
+  mov byte ptr [rip+g2902], sil
+  movsx rsi, word ptr [rip+g2900]
+  movsx rdi, byte ptr [rip+g454]
+  add rsi, rdi
+  mov dword ptr [rip+g2903], esi
+  movsx rsi, byte ptr [rip+g459]
+  add rsi, qword ptr [rip+g2272]
+  mov qword ptr [rip+g2904], rsi
+  movsx rsi, word ptr [rip+g3364]
+  movsx rdi, byte ptr [rip+g3537]
+  add rsi, rdi
+  mov byte ptr [rip+g2905], sil
+  mov rsi, qword ptr [rip+g3257]
+  movsx rdi, word ptr [rip+g844]
+  add rsi, rdi
+  mov word ptr [rip+g2906], si
+  mov rsi, qword ptr [rip+g3281]
+  movsxd rdi, dword ptr [rip+g2005]
+  add rsi, rdi
+  mov qword ptr [rip+g2907], rsi
+  movsx rsi, word ptr [rip+g948]
+  movsxd rdi, dword ptr [rip+g3529]
+  add rsi, rdi
+  mov word ptr [rip+g2908], si
+  mov rsi, qword ptr [rip+g4116]
+  movsxd rdi, dword ptr [rip+g953]
+  add rsi, rdi
+  mov byte ptr [rip+g2909], sil
+  movsx rsi, word ptr [rip+g2900]
+  mov rax, rsi
+.L.return.u290:
+  ret
+.text
+.p2align 4
+.global u291
+u291:
+  mov rsi, qword ptr [rip+g559]
+  add rsi, qword ptr [rip+g2151]
+  mov dword ptr [rip+g2910], esi
+  movsx rsi, word ptr [rip+g776]
+  add rsi, qword ptr [rip+g3250]
+  mov qword ptr [rip+g2911], rsi
+  movsx rsi, word ptr [rip+g4345]
+  add rsi, qword ptr [rip+g4351]
+  mov byte ptr [rip+g2912], sil
+  movsx rsi, word ptr [rip+g3100]
+  movsx rdi, word ptr [rip+g4539]
+  add rsi, rdi
+  mov dword ptr [rip+g2913], esi
+  movsxd rsi, dword ptr [rip+g1436]
+  movsx rdi, byte ptr [rip+g3258]
+  add rsi, rdi
+  mov qword ptr [rip+g2914], rsi
+  mov rsi, qword ptr [rip+g1816]
+  movsx rdi, byte ptr [rip+g1561]
+  add rsi, rdi
+  mov dword ptr [rip+g2915], esi
+  mov rsi, qword ptr [rip+g3422]
+  movsxd rdi, dword ptr [rip+g193]
+  add rsi, rdi
+  mov qword ptr [rip+g2916], rsi
+  movsx rsi, word ptr [rip+g1293]
+  movsx rdi, byte ptr [rip+g1884]
+  add rsi, rdi
+  mov word ptr [rip+g2917], si
+  movsx rsi, byte ptr [rip+g4310]
+  add rsi, qword ptr [rip+g4633]
+  mov word ptr [rip+g2918], si
+  movsxd rsi, dword ptr [rip+g553]
+  add rsi, qword ptr [rip+g4087]
+  mov byte ptr [rip+g2919], sil
+  movsxd rsi, dword ptr [rip+g2910]
+  mov rax, rsi
+.L.return.u291:
+  ret
+.text
+.p2align 4
+.global u292
+u292:
+  movsxd rsi, dword ptr [rip+g4024]
+  add rsi, qword ptr [rip+g5]
+  mov byte ptr [rip+g2920], sil
+  mov rsi, qword ptr [rip+g3732]
+  add rsi, qword ptr [rip+g3814]
+  mov dword ptr [rip+g2921], esi
+  movsx rsi, word ptr [rip+g661]
+  movsx rdi, byte ptr [rip+g2939]
+  add rsi, rdi
+  mov qword ptr [rip+g2922], rsi
+  movsxd rsi, dword ptr [rip+g3862]
+  add rsi, qword ptr [rip+g1531]
+  mov byte ptr [rip+g2923], sil
+  mov rsi, qword ptr [rip+g4920]
+  movsxd rdi, dword ptr [rip+g231]
+  add rsi, rdi
+  mov word ptr [rip+g2924], si
+  movsx rsi, byte ptr [rip+g3115]
+  add rsi, qword ptr [rip+g4888]
+  mov word ptr [rip+g2925], si
+  movsxd rsi, dword ptr [rip+g203]
+  movsx rdi, byte ptr [rip+g834]
+  add rsi, rdi
+  mov qword ptr [rip+g2926], rsi
+  movsx rsi, byte ptr [rip+g4841]
+  add rsi, qword ptr [rip+g2453]
+  mov qword ptr [rip+g2927], rsi
+  mov rsi, qword ptr [rip+g4998]
+  add rsi, qword ptr [rip+g2502]
+  mov word ptr [rip+g2928], si
+  movsxd rsi, dword ptr [rip+g3417]
+  movsx rdi, byte ptr [rip+g4451]
+  add rsi, rdi
+  mov dword ptr [rip+g2929], esi
+  movsx rsi, byte ptr [rip+g2920]
+  mov rax, rsi
+.L.return.u292:
+  ret
+.text
+.p2align 4
+.global u293
+u293:
+  mov rsi, qword ptr [rip+g1055]
+  movsx rdi, word ptr [rip+g2160]
+  add rsi, rdi
+  mov byte ptr [rip+g2930], sil
+  mov rsi, qword ptr [rip+g1032]
+  add rsi, qword ptr [rip+g845]
+  mov dword ptr [rip+g2931], esi
+  movsx rsi, word ptr [rip+g4561]
+  add rsi, qword ptr [rip+g804]
+  mov byte ptr [rip+g2932], sil
+  movsx rsi, word ptr [rip+g4095]
+  movsxd rdi, dword ptr [rip+g3157]
+  add rsi, rdi
+  mov byte ptr [rip+g2933], sil
+  movsx rsi, byte ptr [rip+g3071]
+  movsx rdi, byte ptr [rip+g2262]
+  add rsi, rdi
+  mov dword ptr [rip+g2934], esi
+  movsx rsi, word ptr [rip+g1158]
+  add rsi, qword ptr [rip+g1087]
+  mov dword ptr [rip+g2935], esi
+  movsxd rsi, dword ptr [rip+g2806]
+  movsx rdi, byte ptr [rip+g3454]
+  add rsi, rdi
+  mov word ptr [rip+g2936], si
+  movsx rsi, word ptr [rip+g2187]
+  add rsi, qword ptr [rip+g551]
+  mov qword ptr [rip+g2937], rsi
+  movsxd rsi, dword ptr [rip+g1096]
+  add rsi, qword ptr [rip+g2153]
+  mov qword ptr [rip+g2938], rsi
+  movsxd rsi, dword ptr [rip+g340]
+  movsx rdi, word ptr [rip+g730]
+  add rsi, rdi
+  mov byte ptr [rip+g2939], sil
+  movsx rsi, byte ptr [rip+g2930]
+  mov rax, rsi
+.L.return.u293:
+  ret
+.text
+.p2align 4
+.global u294
+u294:
+  movsxd rsi, dword ptr [rip+g3230]
+  movsx rdi, word ptr [rip+g174]
+  add rsi, rdi
+  mov qword ptr [rip+g2940], rsi
+  movsx rsi, byte ptr [rip+g1119]
+  movsx rdi, word ptr [rip+g215]
+  add rsi, rdi
+  mov qword ptr [rip+g2941], rsi
+  mov rsi, qword ptr [rip+g4233]
+  add rsi, qword ptr [rip+g3701]
+  mov word ptr [rip+g2942], si
+  mov rsi, qword ptr [rip+g3322]
+  movsx rdi, byte ptr [rip+g1248]
+  add rsi, rdi
+  mov byte ptr [rip+g2943], sil
+  movsx rsi, word ptr [rip+g885]
+  add rsi, qword ptr [rip+g831]
+  mov dword ptr [rip+g2944], esi
+  mov rsi, qword ptr [rip+g4233]
+  movsx rdi, word ptr [rip+g3303]
+  add rsi, rdi
+  mov byte ptr [rip+g2945], sil
+  movsx rsi, byte ptr [rip+g2905]
+  add rsi, qword ptr [rip+g3590]
+  mov dword ptr [rip+g2946], esi
+  mov rsi, qword ptr [rip+g569]
+  movsx rdi, word ptr [rip+g3047]
+  add rsi, rdi
+  mov word ptr [rip+g2947], si
+  movsx rsi, word ptr [rip+g2583]
+  movsx rdi, word ptr [rip+g4791]
+  add rsi, rdi
+  mov dword ptr [rip+g2948], esi
+  movsx rsi, byte ptr [rip+g4242]
+  movsxd rdi, dword ptr [rip+g22]
+  add rsi, rdi
+  mov qword ptr [rip+g2949], rsi
+  mov rax, qword ptr [rip+g2940]
+.L.return.u294:
+  ret
+.text
+.p2align 4
+.global u295
+u295:
+  movsx rsi, byte ptr [rip+g1756]
+  movsxd rdi, dword ptr [rip+g2634]
+  add rsi, rdi
+  mov word ptr [rip+g2950], si
+  movsx rsi, byte ptr [rip+g2845]
+  movsx rdi, byte ptr [rip+g1412]
+  add rsi, rdi
+  mov qword ptr [rip+g2951], rsi
+  movsx rsi, word ptr [rip+g2007]
+  movsx rdi, word ptr [rip+g3228]
+  add rsi, rdi
+  mov byte ptr [rip+g2952], sil
+  movsx rsi, byte ptr [rip+g373]
+  movsx rdi, byte ptr [rip+g4266]
+  add rsi, rdi
+  mov word ptr [rip+g2953], si
+  movsx rsi, byte ptr [rip+g4684]
+  movsxd rdi, dword ptr [rip+g3118]
+  add rsi, rdi
+  mov word ptr [rip+g2954], si
+  movsxd rsi, dword ptr [rip+g944]
+  movsx rdi, byte ptr [rip+g4891]
+  add rsi, rdi
+  mov byte ptr [rip+g2955], sil
+  mov rsi, qword ptr [rip+g3678]
+  movsxd rdi, dword ptr [rip+g4174]
+  add rsi, rdi
+  mov dword ptr [rip+g2956], esi
+  movsx rsi, byte ptr [rip+g3062]
+  movsxd rdi, dword ptr [rip+g3336]
+  add rsi, rdi
+  mov qword ptr [rip+g2957], rsi
+  movsxd rsi, dword ptr [rip+g1834]
+  add rsi, qword ptr [rip+g901]
+  mov qword ptr [rip+g2958], rsi
+  movsx rsi, byte ptr [rip+g2845]
+  movsx rdi, word ptr [rip+g3633]
+  add rsi, rdi
+  mov qword ptr [rip+g2959], rsi
+  movsx rsi, word ptr [rip+g2950]
+  mov rax, rsi
+.L.return.u295:
+  ret
+.text
+.p2align 4
+.global u296
+u296:
+  movsxd rsi, dword ptr [rip+g1301]
+  movsx rdi, word ptr [rip+g3991]
+  add rsi, rdi
+  mov byte ptr [rip+g2960], sil
+  movsxd rsi, dword ptr [rip+g340]
+  movsx rdi, byte ptr [rip+g741]
+  add rsi, rdi
+  mov word ptr [rip+g2961], si
+  movsx rsi, word ptr [rip+g3242]
+  movsx rdi, byte ptr [rip+g1148]
+  add rsi, rdi
+  mov dword ptr [rip+g2962], esi
+  movsx rsi, word ptr [rip+g1732]
+  movsxd rdi, dword ptr [rip+g2687]
+  add rsi, rdi
+  mov dword ptr [rip+g2963], esi
+  mov rsi, qword ptr [rip+g3124]
+  movsx rdi, word ptr [rip+g1203]
+  add rsi, rdi
+  mov qword ptr [rip+g2964], rsi
+  movsx rsi, byte ptr [rip+g4793]
+  add rsi, qword ptr [rip+g1208]
+  mov word ptr [rip+g2965], si
+  movsx rsi, byte ptr [rip+g4237]
+  movsx rdi, word ptr [rip+g1181]
+  add rsi, rdi
+  mov dword ptr [rip+g2966], esi
+  movsx rsi, word ptr [rip+g3262]
+  movsx rdi, word ptr [rip+g429]
+  add rsi, rdi
+  mov word ptr [rip+g2967], si
+  movsx rsi, byte ptr [rip+g2607]
+  movsx rdi, byte ptr [rip+g2697]
+  add rsi, rdi
+  mov dword ptr [rip+g2968], esi
+  mov rsi, qword ptr [rip+g556]
+  movsxd rdi, dword ptr [rip+g4917]
+  add rsi, rdi
+  mov dword ptr [rip+g2969], esi
+  movsx rsi, byte ptr [rip+g2960]
+  mov rax, rsi
+.L.return.u296:
+  ret
+.text
+.p2align 4
+.global u297
+u297:
+  movsx rsi, word ptr [rip+g3246]
+  movsxd rdi, dword ptr [rip+g3394]
+  add rsi, rdi
+  mov word ptr [rip+g2970], si
+  movsx rsi, word ptr [rip+g2810]
+  movsxd rdi, dword ptr [rip+g1001]
+  add rsi, rdi
+  mov dword ptr [rip+g2971], esi
+  movsx rsi, word ptr [rip+g3381]
+  movsx rdi, word ptr [rip+g661]
+  add rsi, rdi
+  mov byte ptr [rip+g2972], sil
+  mov rsi, qword ptr [rip+g4083]
+  movsxd rdi, dword ptr [rip+g4374]
+  add rsi, rdi
+  mov word ptr [rip+g2973], si
+  movsx rsi, byte ptr [rip+g2216]
+  add rsi, qword ptr [rip+g427]
+  mov word ptr [rip+g2974], si
+  movsx rsi, byte ptr [rip+g1393]
+  movsxd rdi, dword ptr [rip+g2005]
+  add rsi, rdi
+  mov byte ptr [rip+g2975], sil
+  movsx rsi, byte ptr [rip+g3115]
+  movsxd rdi, dword ptr [rip+g1887]
+  add rsi, rdi
+  mov byte ptr [rip+g2976], sil
+  movsx rsi, byte ptr [rip+g3386]
+  add rsi, qword ptr [rip+g74]
+  mov qword ptr [rip+g2977], rsi
+  movsx rsi, byte ptr [rip+g3536]
+  movsxd rdi, dword ptr [rip+g1078]
+  add rsi, rdi
+  mov byte ptr [rip+g2978], sil
+  movsx rsi, byte ptr [rip+g4655]
+  movsxd rdi, dword ptr [rip+g3134]
+  add rsi, rdi
+  mov word ptr [rip+g2979], si
+  movsx rsi, word ptr [rip+g2970]
+  mov rax, rsi
+.L.return.u297:
+  ret
+.text
+.p2align 4
+.global u298
+u298:
+  movsxd rsi, dword ptr [rip+g896]
+  movsxd rdi, dword ptr [rip+g2963]
+  add rsi, rdi
+  mov byte ptr [rip+g2980], sil
+  movsxd rsi, dword ptr [rip+g4527]
+  movsx rdi, word ptr [rip+g691]
+  add rsi, rdi
+  mov qword ptr [rip+g2981], rsi
+  movsx rsi, byte ptr [rip+g2059]
+  movsx rdi, byte ptr [rip+g2212]
+  add rsi, rdi
+  mov word ptr [rip+g2982], si
+  movsx rsi, byte ptr [rip+g4836]
+  add rsi, qword ptr [rip+g1305]
+  mov dword ptr [rip+g2983], esi
+  movsx rsi, byte ptr [rip+g1223]
+  movsx rdi, byte ptr [rip+g4600]
+  add rsi, rdi
+  mov byte ptr [rip+g2984], sil
+  movsx rsi, word ptr [rip+g199]
+  add rsi, qword ptr [rip+g1090]
+  mov byte ptr [rip+g2985], sil
+  movsxd rsi, dword ptr [rip+g4575]
+  movsxd rdi, dword ptr [rip+g271]
+  add rsi, rdi
+  mov dword ptr [rip+g2986], esi
+  movsxd rsi, dword ptr [rip+g4063]
+  movsx rdi, word ptr [rip+g2313]
+  add rsi, rdi
+  mov byte ptr [rip+g2987], sil
+  movsx rsi, word ptr [rip+g4244]
+  movsx rdi, word ptr [rip+g3223]
+  add rsi, rdi
+  mov word ptr [rip+g2988], si
+  mov rsi, qword ptr [rip+g3276]
+  add rsi, qword ptr [rip+g1003]
+  mov word ptr [rip+g2989], si
+  movsx rsi, byte ptr [rip+g2980]
+  mov rax, rsi
+.L.return.u298:
+  ret
+.text
+.p2align 4
+.global u299
+u299:
+  movsx rsi, byte ptr [rip+g3176]
+  movsxd rdi, dword ptr [rip+g580]
+  add rsi, rdi
+  mov word ptr [rip+g2990], si
+  movsxd rsi, dword ptr [rip+g4971]
+  movsxd rdi, dword ptr [rip+g3323]
+  add rsi, rdi
+  mov byte ptr [rip+g2991], sil
+  mov rsi, qword ptr [rip+g2828]
+  movsxd rdi, dword ptr [rip+g1442]
+  add rsi, rdi
+  mov byte ptr [rip+g2992], sil
+  movsx rsi, byte ptr [rip+g4785]
+  movsxd rdi, dword ptr [rip+g513]
+  add rsi, rdi
+  mov qword ptr [rip+g2993], rsi
+  movsx rsi, byte ptr [rip+g4247]
+  movsxd rdi, dword ptr [rip+g4006]
+  add rsi, rdi
+  mov dword ptr [rip+g2994], esi
+  movsx rsi, byte ptr [rip+g121]
+  movsx rdi, byte ptr [rip+g3536]
+  add rsi, rdi
+  mov dword ptr [rip+g2995], esi
+  mov rsi, qword ptr [rip+g4390]
+  movsx rdi, byte ptr [rip+g1187]
+  add rsi, rdi
+  mov qword ptr [rip+g2996], rsi
+  movsxd rsi, dword ptr [rip+g4956]
+  movsx rdi, word ptr [rip+g471]
+  add rsi, rdi
+  mov qword ptr [rip+g2997], rsi
+  movsxd rsi, dword ptr [rip+g4587]
+  movsxd rdi, dword ptr [rip+g3996]
+  add rsi, rdi
+  mov qword ptr [rip+g2998], rsi
+  movsx rsi, word ptr [rip+g4637]
+  add rsi, qword ptr [rip+g4418]
+  mov word ptr [rip+g2999], si
+  movsx rsi, word ptr [rip+g2990]
+  mov rax, rsi
+.L.return.u299:
+  ret
+.text
+.p2align 4
+.global u300
+u300:
+  movsx rsi, word ptr [rip+g3991]
+  movsx rdi, byte ptr [rip+g711]
+  add rsi, rdi
+  mov qword ptr [rip+g3000], rsi
+  movsxd rsi, dword ptr [rip+g4672]
+  movsx rdi, byte ptr [rip+g2348]
+  add rsi, rdi
+  mov dword ptr [rip+g3001], esi
+  movsxd rsi, dword ptr [rip+g1975]
+  add rsi, qword ptr [rip+g1093]
+  mov byte ptr [rip+g3002], sil
+  movsx rsi, byte ptr [rip+g3199]
+  movsxd rdi, dword ptr [rip+g1838]
+  add rsi, rdi
+  mov qword ptr [rip+g3003], rsi
+  mov rsi, qword ptr [rip+g1012]
+  movsx rdi, byte ptr [rip+g1397]
+  add rsi, rdi
+  mov word ptr [rip+g3004], si
+  movsx rsi, byte ptr [rip+g3054]
+  movsx rdi, byte ptr [rip+g3472]
+  add rsi, rdi
+  mov dword ptr [rip+g3005], esi
+  movsxd rsi, dword ptr [rip+g552]
+  movsx rdi, word ptr [rip+g510]
+  add rsi, rdi
+  mov word ptr [rip+g3006], si
+  movsx rsi, byte ptr [rip+g3918]
+  add rsi, qword ptr [rip+g1005]
+  mov byte ptr [rip+g3007], sil
+  movsxd rsi, dword ptr [rip+g2275]
+  movsx rdi, word ptr [rip+g180]
+  add rsi, rdi
+  mov dword ptr [rip+g3008], esi
+  movsx rsi, byte ptr [rip+g1594]
+  add rsi, qword ptr [rip+g2767]
+  mov dword ptr [rip+g3009], esi
+  mov rax, qword ptr [rip+g3000]
+.L.return.u300:
+  ret
+.text
+.p2align 4
+.global u301
+u301:
+  movsx rsi, byte ptr [rip+g540]
+  add rsi, qword ptr [rip+g2881]
+  mov word ptr [rip+g3010], si
+  movsx rsi, byte ptr [rip+g3163]
+  add rsi, qword ptr [rip+g4776]
+  mov word ptr [rip+g3011], si
+  mov rsi, qword ptr [rip+g1208]
+  movsx rdi, byte ptr [rip+g4986]
+  add rsi, rdi
+  mov byte ptr [rip+g3012], sil
+  mov rsi, qword ptr [rip+g4352]
+  add rsi, qword ptr [rip+g601]
+  mov byte ptr [rip+g3013], sil
+  mov rsi, qword ptr [rip+g2248]
+  movsx rdi, byte ptr [rip+g931]
+  add rsi, rdi
+  mov qword ptr [rip+g3014], rsi
+  movsx rsi, byte ptr [rip+g2302]
+  movsx rdi, word ptr [rip+g4514]
+  add rsi, rdi
+  mov dword ptr [rip+g3015], esi
+  movsx rsi, byte ptr [rip+g2411]
+  movsx rdi, byte ptr [rip+g1463]
+  add rsi, rdi
+  mov dword ptr [rip+g3016], esi
+  movsx rsi, byte ptr [rip+g4261]
+  movsx rdi, word ptr [rip+g2990]
+  add rsi, rdi
+  mov byte ptr [rip+g3017], sil
+  movsx rsi, word ptr [rip+g1369]
+  movsx rdi, byte ptr [rip+g1131]
+  add rsi, rdi
+  mov byte ptr [rip+g3018], sil
+  movsx rsi, word ptr [rip+g2108]
+  movsxd rdi, dword ptr [rip+g3622]
+  add rsi, rdi
+  mov word ptr [rip+g3019], si
+  movsx rsi, word ptr [rip+g3010]
+  mov rax, rsi
+.L.return.u301:
+  ret
+.text
+.p2align 4
+.global u302
+u302:
+  movsx rsi, byte ptr [rip+g4782]
+  movsx rdi, byte ptr [rip+g4449]
+  add rsi, rdi
+  mov qword ptr [rip+g3020], rsi
+  mov rsi, qword ptr [rip+g4434]
+  movsxd rdi, dword ptr [rip+g3339]
+  add rsi, rdi
+  mov qword ptr [rip+g3021], rsi
+  mov rsi, qword ptr [rip+g1905]
+  add rsi, qword ptr [rip+g1521]
+  mov word ptr [rip+g3022], si
+  movsxd rsi, dword ptr [rip+g1066]
+  movsxd rdi, dword ptr [rip+g1719]
+  add rsi, rdi
+  mov qword ptr [rip+g3023], rsi
+  movsx rsi, byte ptr [rip+g263]
+  add rsi, qword ptr [rip+g3849]
+  mov qword ptr [rip+g3024], rsi
+  mov rsi, qword ptr [rip+g3195]
+  add rsi, qword ptr [rip+g2377]
+  mov dword ptr [rip+g3025], esi
+  movsx rsi, word ptr [rip+g546]
+  add rsi, qword ptr [rip+g4296]
+  mov dword ptr [rip+g3026], esi
+  mov rsi, qword ptr [rip+g48]
+  movsx rdi, byte ptr [rip+g2666]
+  add rsi, rdi
+  mov word ptr [rip+g3027], si
+  movsx rsi, word ptr [rip+g212]
+  add rsi, qword ptr [rip+g2189]
+  mov dword ptr [rip+g3028], esi
+  mov rsi, qword ptr [rip+g3486]
+  movsx rdi, word ptr [rip+g169]
+  add rsi, rdi
+  mov dword ptr [rip+g3029], esi
+  mov rax, qword ptr [rip+g3020]
+.L.return.u302:
+  ret
+.text
+.p2align 4
+.global u303
+u303:
+  movsx rsi, word ptr [rip+g3641]
+  movsx rdi, byte ptr [rip+g4684]
+  add rsi, rdi
+  mov word ptr [rip+g3030], si
+  movsx rsi, word ptr [rip+g2565]
+  movsx rdi, byte ptr [rip+g25]
+  add rsi, rdi
+  mov word ptr [rip+g3031], si
+  movsx rsi, byte ptr [rip+g4518]
+  add rsi, qword ptr [rip+g3237]
+  mov dword ptr [rip+g3032], esi
+  movsx rsi, byte ptr [rip+g2671]
+  movsx rdi, byte ptr [rip+g679]
+  add rsi, rdi
+  mov dword ptr [rip+g3033], esi
+  movsx rsi, word ptr [rip+g4714]
+  add rsi, qword ptr [rip+g3943]
+  mov qword ptr [rip+g3034], rsi
+  mov rsi, qword ptr [rip+g717]
+  movsx rdi, byte ptr [rip+g462]
+  add rsi, rdi
+  mov byte ptr [rip+g3035], sil
+  movsx rsi, word ptr [rip+g2498]
+  movsx rdi, byte ptr [rip+g3870]
+  add rsi, rdi
+  mov dword ptr [rip+g3036], esi
+  movsx rsi, word ptr [rip+g4178]
+  movsx rdi, word ptr [rip+g906]
+  add rsi, rdi
+  mov byte ptr [rip+g3037], sil
+  movsxd rsi, dword ptr [rip+g3394]
+  movsx rdi, word ptr [rip+g1529]
+  add rsi, rdi
+  mov qword ptr [rip+g3038], rsi
+  movsx rsi, byte ptr [rip+g833]
+  add rsi, qword ptr [rip+g1401]
+  mov word ptr [rip+g3039], si
+  movsx rsi, word ptr [rip+g3030]
+  mov rax, rsi
+.L.return.u303:
+  ret
+.text
+.p2align 4
+.global u304
+u304:
+  movsx rsi, byte ptr [rip+g557]
+  add rsi, qword ptr [rip+g1453]
+  mov dword ptr [rip+g3040], esi
+  mov rsi, qword ptr [rip+g4618]
+  movsx rdi, byte ptr [rip+g3638]
+  add rsi, rdi
+  mov dword ptr [rip+g3041], esi
+  movsx rsi, byte ptr [rip+g4529]
+  movsx rdi, word ptr [rip+g1520]
+  add rsi, rdi
+  mov dword ptr [rip+g3042], esi
+  mov rsi, qword ptr [rip+g748]
+  movsxd rdi, dword ptr [rip+g3180]
+  add rsi, rdi
+  mov word ptr [rip+g3043], si
+  movsx rsi, byte ptr [rip+g1969]
+  movsx rdi, word ptr [rip+g3326]
+  add rsi, rdi
+  mov qword ptr [rip+g3044], rsi
+  mov rsi, qword ptr [rip+g2703]
+  movsx rdi, byte ptr [rip+g747]
+  add rsi, rdi
+  mov word ptr [rip+g3045], si
+  movsx rsi, word ptr [rip+g510]
+  add rsi, qword ptr [rip+g2941]
+  mov word ptr [rip+g3046], si
+  movsx rsi, word ptr [rip+g4819]
+  movsx rdi, word ptr [rip+g4226]
+  add rsi, rdi
+  mov word ptr [rip+g3047], si
+  movsx rsi, word ptr [rip+g1609]
+  movsx rdi, byte ptr [rip+g1302]
+  add rsi, rdi
+  mov byte ptr [rip+g3048], sil
+  movsxd rsi, dword ptr [rip+g3157]
+  movsx rdi, byte ptr [rip+g4853]
+  add rsi, rdi
+  mov dword ptr [rip+g3049], esi
+  movsxd rsi, dword ptr [rip+g3040]
+  mov rax, rsi
+.L.return.u304:
+  ret
+.text
+.p2align 4
+.global u305
+u305:
+  mov rsi, qword ptr [rip+g4494]
+  movsx rdi, byte ptr [rip+g2039]
+  add rsi, rdi
+  mov qword ptr [rip+g3050], rsi
+  movsxd rsi, dword ptr [rip+g1009]
+  movsx rdi, byte ptr [rip+g4209]
+  add rsi, rdi
+  mov dword ptr [rip+g3051], esi
+  movsxd rsi, dword ptr [rip+g460]
+  movsx rdi, word ptr [rip+g3160]
+  add rsi, rdi
+  mov dword ptr [rip+g3052], esi
+  mov rsi, qword ptr [rip+g4528]
+  movsxd rdi, dword ptr [rip+g3981]
+  add rsi, rdi
+  mov qword ptr [rip+g3053], rsi
+  movsx rsi, word ptr [rip+g2116]
+  movsxd rdi, dword ptr [rip+g240]
+  add rsi, rdi
+  mov byte ptr [rip+g3054], sil
+  movsxd rsi, dword ptr [rip+g1851]
+  movsxd rdi, dword ptr [rip+g961]
+  add rsi, rdi
+  mov byte ptr [rip+g3055], sil
+  mov rsi, qword ptr [rip+g817]
+  add rsi, qword ptr [rip+g1501]
+  mov byte ptr [rip+g3056], sil
+  movsxd rsi, dword ptr [rip+g4381]
+  add rsi, qword ptr [rip+g490]
+  mov word ptr [rip+g3057], si
+  movsx rsi, word ptr [rip+g1384]
+  movsx rdi, byte ptr [rip+g4313]
+  add rsi, rdi
+  mov qword ptr [rip+g3058], rsi
+  movsx rsi, byte ptr [rip+g2778]
+  add rsi, qword ptr [rip+g258]
+  mov dword ptr [rip+g3059], esi
+  mov rax, qword ptr [rip+g3050]
+.L.return.u305:
+  ret
+.text
+.p2align 4
+.global u306
+u306:
+  movsx rsi, byte ptr [rip+g2445]
+  add rsi, qword ptr [rip+g2914]
+  mov dword ptr [rip+g3060], esi
+  movsxd rsi, dword ptr [rip+g1674]
+  add rsi, qword ptr [rip+g521]
+  mov qword ptr [rip+g3061], rsi
+  movsx rsi, byte ptr [rip+g3085]
+  movsx rdi, byte ptr [rip+g3146]
+  add rsi, rdi
+  mov byte ptr [rip+g3062], sil
+  movsx rsi, word ptr [rip+g822]
+  movsx rdi, byte ptr [rip+g4128]
+  add rsi, rdi
+  mov qword ptr [rip+g3063], rsi
+  movsx rsi, byte ptr [rip+g2894]
+  movsx rdi, word ptr [rip+g1379]
+  add rsi, rdi
+  mov word ptr [rip+g3064], si
+  movsx rsi, word ptr [rip+g2924]
+  movsxd rdi, dword ptr [rip+g1526]
+  add rsi, rdi
+  mov byte ptr [rip+g3065], sil
+  movsx rsi, byte ptr [rip+g3154]
+  movsx rdi, word ptr [rip+g1278]
+  add rsi, rdi
+  mov qword ptr [rip+g3066], rsi
+  mov rsi, qword ptr [rip+g3584]
+  movsx rdi, word ptr [rip+g4970]
+  add rsi, rdi
+  mov qword ptr [rip+g3067], rsi
+  movsx rsi, word ptr [rip+g3785]
+  movsx rdi, byte ptr [rip+g4692]
+  add rsi, rdi
+  mov word ptr [rip+g3068], si
+  movsx rsi, byte ptr [rip+g3727]
+  add rsi, qword ptr [rip+g3343]
+  mov byte ptr [rip+g3069], sil
+  movsxd rsi, dword ptr [rip+g3060]
+  mov rax, rsi
+.L.return.u306:
+  ret
+.text
+.p2align 4
+.global u307
+u307:
+  mov rsi, qword ptr [rip+g2483]
+  movsx rdi, byte ptr [rip+g109]
+  add rsi, rdi
+  mov qword ptr [rip+g3070], rsi
+  movsx rsi, byte ptr [rip+g1671]
+  movsxd rdi, dword ptr [rip+g234]
+  add rsi, rdi
+  mov byte ptr [rip+g3071], sil
+  mov rsi, qword ptr [rip+g4719]
+  add rsi, qword ptr [rip+g971]
+  mov byte ptr [rip+g3072], sil
+  movsx rsi, byte ptr [rip+g2351]
+  movsx rdi, word ptr [rip+g4708]
+  add rsi, rdi
+  mov byte ptr [rip+g3073], sil
+  mov rsi, qword ptr [rip+g821]
+  movsx rdi, word ptr [rip+g2117]
+  add rsi, rdi
+  mov word ptr [rip+g3074], si
+  movsx rsi, word ptr [rip+g408]
+  movsx rdi, byte ptr [rip+g729]
+  add rsi, rdi
+  mov qword ptr [rip+g3075], rsi
+  mov rsi, qword ptr [rip+g137]
+  movsxd rdi, dword ptr [rip+g193]
+  add rsi, rdi
+  mov byte ptr [rip+g3076], sil
+  mov rsi, qword ptr [rip+g3143]
+  add rsi, qword ptr [rip+g2801]
+  mov dword ptr [rip+g3077], esi
+  movsx rsi, byte ptr [rip+g454]
+  movsx rdi, word ptr [rip+g574]
+  add rsi, rdi
+  mov dword ptr [rip+g3078], esi
+  movsx rsi, word ptr [rip+g4028]
+  movsx rdi, word ptr [rip+g4458]
+  add rsi, rdi
+  mov qword ptr [rip+g3079], rsi
+  mov rax, qword ptr [rip+g3070]
+.L.return.u307:
+  ret
+.text
+.p2align 4
+.global u308
+u308:
+  mov rsi, qword ptr [rip+g1113]
+  movsx rdi, word ptr [rip+g1396]
+  add rsi, rdi
+  mov word ptr [rip+g3080], si
+  movsx rsi, word ptr [rip+g174]
+  movsx rdi, word ptr [rip+g2457]
+  add rsi, rdi
+  mov word ptr [rip+g3081], si
+  movsx rsi, word ptr [rip+g4244]
+  movsxd rdi, dword ptr [rip+g4820]
+  add rsi, rdi
+  mov dword ptr [rip+g3082], esi
+  movsx rsi, word ptr [rip+g2273]
+  movsx rdi, byte ptr [rip+g3661]
+  add rsi, rdi
+  mov byte ptr [rip+g3083], sil
+  movsx rsi, byte ptr [rip+g3579]
+  movsxd rdi, dword ptr [rip+g184]
+  add rsi, rdi
+  mov qword ptr [rip+g3084], rsi
+  movsxd rsi, dword ptr [rip+g203]
+  movsx rdi, word ptr [rip+g2876]
+  add rsi, rdi
+  mov byte ptr [rip+g3085], sil
+  movsxd rsi, dword ptr [rip+g990]
+  movsx rdi, byte ptr [rip+g1020]
+  add rsi, rdi
+  mov byte ptr [rip+g3086], sil
+  movsx rsi, word ptr [rip+g2017]
+  movsx rdi, byte ptr [rip+g3647]
+  add rsi, rdi
+  mov word ptr [rip+g3087], si
+  movsxd rsi, dword ptr [rip+g4892]
+  movsx rdi, byte ptr [rip+g652]
+  add rsi, rdi
+  mov word ptr [rip+g3088], si
+  movsx rsi, word ptr [rip+g641]
+  add rsi, qword ptr [rip+g4560]
+  mov byte ptr [rip+g3089], sil
+  movsx rsi, word ptr [rip+g3080]
+  mov rax, rsi
+.L.return.u308:
+  ret
+.text
+.p2align 4
+.global u309
+u309:
+  mov rsi, qword ptr [rip+g3680]
+  add rsi, qword ptr [rip+g2672]
+  mov word ptr [rip+g3090], si
+  movsx rsi, byte ptr [rip+g4067]
+  movsx rdi, byte ptr [rip+g4838]
+  add rsi, rdi
+  mov byte ptr [rip+g3091], sil
+  movsxd rsi, dword ptr [rip+g1526]
+  movsx rdi, byte ptr [rip+g1866]
+  add rsi, rdi
+  mov dword ptr [rip+g3092], esi
+  movsxd rsi, dword ptr [rip+g4943]
+  movsx rdi, byte ptr [rip+g894]
+  add rsi, rdi
+  mov word ptr [rip+g3093], si
+  mov rsi, qword ptr [rip+g435]
+  movsx rdi, word ptr [rip+g2170]
+  add rsi, rdi
+  mov word ptr [rip+g3094], si
+  mov rsi, qword ptr [rip+g3749]
+  movsxd rdi, dword ptr [rip+g1616]
+  add rsi, rdi
+  mov word ptr [rip+g3095], si
+  mov rsi, qword ptr [rip+g2702]
+  add rsi, qword ptr [rip+g2826]
+  mov byte ptr [rip+g3096], sil
+  movsx rsi, word ptr [rip+g2569]
+  add rsi, qword ptr [rip+g2814]
+  mov byte ptr [rip+g3097], sil
+  movsx rsi, byte ptr [rip+g4880]
+  add rsi, qword ptr [rip+g250]
+  mov qword ptr [rip+g3098], rsi
+  mov rsi, qword ptr [rip+g3974]
+  movsx rdi, byte ptr [rip+g2225]
+  add rsi, rdi
+  mov byte ptr [rip+g3099], sil
+  movsx rsi, word ptr [rip+g3090]
+  mov rax, rsi
+.L.return.u309:
+  ret
+.text
+.p2align 4
+.global u310
+u310:
+  movsx rsi, word ptr [rip+g1352]
+  add rsi, qword ptr [rip+g2312]
+  mov word ptr [rip+g3100], si
+  movsxd rsi, dword ptr [rip+g271]
+  add rsi, qword ptr [rip+g2764]
+  mov word ptr [rip+g3101], si
+  movsxd rsi, dword ptr [rip+g3984]
+  movsx rdi, byte ptr [rip+g1237]
+  add rsi, rdi
+  mov dword ptr [rip+g3102], esi
+  movsxd rsi, dword ptr [rip+g357]
+  movsx rdi, word ptr [rip+g3027]
+  add rsi, rdi
+  mov dword ptr [rip+g3103], esi
+  mov rsi, qword ptr [rip+g2712]
+  movsxd rdi, dword ptr [rip+g908]
+  add rsi, rdi
+  mov dword ptr [rip+g3104], esi
+  movsxd rsi, dword ptr [rip+g4354]
+  movsx rdi, word ptr [rip+g2257]
+  add rsi, rdi
+  mov word ptr [rip+g3105], si
+  movsx rsi, byte ptr [rip+g3240]
+  movsx rdi, byte ptr [rip+g1274]
+  add rsi, rdi
+  mov byte ptr [rip+g3106], sil
+  movsx rsi, byte ptr [rip+g3512]
+  add rsi, qword ptr [rip+g2675]
+  mov qword ptr [rip+g3107], rsi
+  movsxd rsi, dword ptr [rip+g2875]
+  movsx rdi, word ptr [rip+g1277]
+  add rsi, rdi
+  mov word ptr [rip+g3108], si
+  movsx rsi, byte ptr [rip+g3908]
+  movsxd rdi, dword ptr [rip+g4741]
+  add rsi, rdi
+  mov byte ptr [rip+g3109], sil
+  movsx rsi, word ptr [rip+g3100]
+  mov rax, rsi
+.L.return.u310:
+  ret
+.text
+.p2align 4
+.global u311
+u311:
+  movsxd rsi, dword ptr [rip+g1879]
+  movsx rdi, word ptr [rip+g3856]
+  add rsi, rdi
+  mov word ptr [rip+g3110], si
+  movsxd rsi, dword ptr [rip+g2781]
+  movsx rdi, word ptr [rip+g3234]
+  add rsi, rdi
+  mov byte ptr [rip+g3111], sil
+  movsx rsi, word ptr [rip+g1909]
+  movsx rdi, word ptr [rip+g3858]
+  add rsi, rdi
+  mov qword ptr [rip+g3112], rsi
+  movsxd rsi, dword ptr [rip+g3447]
+  movsx rdi, byte ptr [rip+g496]
+  add rsi, rdi
+  mov qword ptr [rip+g3113], rsi
+  movsx rsi, byte ptr [rip+g3330]
+  movsx rdi, byte ptr [rip+g4601]
+  add rsi, rdi
+  mov qword ptr [rip+g3114], rsi
+  movsx rsi, word ptr [rip+g542]
+  movsx rdi, byte ptr [rip+g3254]
+  add rsi, rdi
+  mov byte ptr [rip+g3115], sil
+  mov rsi, qword ptr [rip+g4579]
+  movsxd rdi, dword ptr [rip+g2860]
+  add rsi, rdi
+  mov byte ptr [rip+g3116], sil
+  mov rsi, qword ptr [rip+g2495]
+  add rsi, qword ptr [rip+g3726]
+  mov qword ptr [rip+g3117], rsi
+  movsx rsi, word ptr [rip+g4011]
+  add rsi, qword ptr [rip+g1621]
+  mov dword ptr [rip+g3118], esi
+  mov rsi, qword ptr [rip+g1546]
+  movsx rdi, word ptr [rip+g153]
+  add rsi, rdi
+  mov dword ptr [rip+g3119], esi
+  movsx rsi, word ptr [rip+g3110]
+  mov rax, rsi
+.L.return.u311:
+  ret
+.text
+.p2align 4
+.global u312
+u312:
+  movsxd rsi, dword ptr [rip+g4]
+  movsx rdi, byte ptr [rip+g1983]
+  add rsi, rdi
+  mov word ptr [rip+g3120], si
+  movsxd rsi, dword ptr [rip+g2995]
+  movsx rdi, byte ptr [rip+g729]
+  add rsi, rdi
+  mov qword ptr [rip+g3121], rsi
+  movsx rsi, word ptr [rip+g1067]
+  add rsi, qword ptr [rip+g2483]
+  mov qword ptr [rip+g3122], rsi
+  movsx rsi, byte ptr [rip+g1668]
+  movsxd rdi, dword ptr [rip+g969]
+  add rsi, rdi
+  mov byte ptr [rip+g3123], sil
+  movsx rsi, word ptr [rip+g255]
+  add rsi, qword ptr [rip+g1163]
+  mov qword ptr [rip+g3124], rsi
+  mov rsi, qword ptr [rip+g3802]
+  movsx rdi, word ptr [rip+g4762]
+  add rsi, rdi
+  mov byte ptr [rip+g3125], sil
+  movsx rsi, byte ptr [rip+g2955]
+  movsx rdi, byte ptr [rip+g2803]
+  add rsi, rdi
+  mov byte ptr [rip+g3126], sil
+  movsx rsi, byte ptr [rip+g2920]
+  add rsi, qword ptr [rip+g2811]
+  mov dword ptr [rip+g3127], esi
+  movsxd rsi, dword ptr [rip+g1092]
+  add rsi, qword ptr [rip+g4432]
+  mov byte ptr [rip+g3128], sil
+  movsx rsi, byte ptr [rip+g1664]
+  movsx rdi, byte ptr [rip+g3687]
+  add rsi, rdi
+  mov word ptr [rip+g3129], si
+  movsx rsi, word ptr [rip+g3120]
+  mov rax, rsi
+.L.return.u312:
+  ret
+.text
+.p2align 4
+.global u313
+u313:
+  movsx rsi, word ptr [rip+g816]
+  add rsi, qword ptr [rip+g4492]
+  mov byte ptr [rip+g3130], sil
+  movsxd rsi, dword ptr [rip+g240]
+  movsxd rdi, dword ptr [rip+g4905]
+  add rsi, rdi
+  mov byte ptr [rip+g3131], sil
+  mov rsi, qword ptr [rip+g2647]
+  movsx rdi, byte ptr [rip+g1548]
+  add rsi, rdi
+  mov byte ptr [rip+g3132], sil
+  movsxd rsi, dword ptr [rip+g2501]
+  movsx rdi, word ptr [rip+g3333]
+  add rsi, rdi
+  mov qword ptr [rip+g3133], rsi
+  movsxd rsi, dword ptr [rip+g1627]
+  movsx rdi, word ptr [rip+g3509]
+  add rsi, rdi
+  mov dword ptr [rip+g3134], esi
+  movsx rsi, byte ptr [rip+g4864]
+  movsx rdi, word ptr [rip+g226]
+  add rsi, rdi
+  mov qword ptr [rip+g3135], rsi
+  movsxd rsi, dword ptr [rip+g3366]
+  movsxd rdi, dword ptr [rip+g4439]
+  add rsi, rdi
+  mov qword ptr [rip+g3136], rsi
+  mov rsi, qword ptr [rip+g2074]
+  add rsi, qword ptr [rip+g4610]
+  mov dword ptr [rip+g3137], esi
+  mov rsi, qword ptr [rip+g3749]
+  add rsi, qword ptr [rip+g853]
+  mov word ptr [rip+g3138], si
+  movsxd rsi, dword ptr [rip+g866]
+  movsxd rdi, dword ptr [rip+g4220]
+  add rsi, rdi
+  mov dword ptr [rip+g3139], esi
+  movsx rsi, byte ptr [rip+g3130]
+  mov rax, rsi
+.L.return.u313:
+  ret
+.text
+.p2align 4
+.global u314
+u314:
+  movsxd rsi, dword ptr [rip+g2275]
+  movsx rdi, word ptr [rip+g3226]
+  add rsi, rdi
+  mov word ptr [rip+g3140], si
+  movsx rsi, word ptr [rip+g4923]
+  movsx rdi, byte ptr [rip+g1952]
+  add rsi, rdi
+  mov qword ptr [rip+g3141], rsi
+  mov rsi, qword ptr [rip+g3436]
+  movsx rdi, byte ptr [rip+g3889]
+  add rsi, rdi
+  mov byte ptr [rip+g3142], sil
+  movsxd rsi, dword ptr [rip+g474]
+  add rsi, qword ptr [rip+g2470]
+  mov qword ptr [rip+g3143], rsi
+  movsx rsi, word ptr [rip+g1490]
+  movsx rdi, byte ptr [rip+g4557]
+  add rsi, rdi
+  mov dword ptr [rip+g3144], esi
+  movsx rsi, word ptr [rip+g1830]
+  movsxd rdi, dword ptr [rip+g2342]
+  add rsi, rdi
+  mov byte ptr [rip+g3145], sil
+  movsx rsi, byte ptr [rip+g4530]
+  movsxd rdi, dword ptr [rip+g513]
+  add rsi, rdi
+  mov byte ptr [rip+g3146], sil
+  movsx rsi, byte ptr [rip+g986]
+  add rsi, qword ptr [rip+g3869]
+  mov qword ptr [rip+g3147], rsi
+  mov rsi, qword ptr [rip+g4295]
+  add rsi, qword ptr [rip+g4686]
+  mov qword ptr [rip+g3148], rsi
+  movsx rsi, word ptr [rip+g913]
+  movsx rdi, word ptr [rip+g4372]
+  add rsi, rdi
+  mov word ptr [rip+g3149], si
+  movsx rsi, word ptr [rip+g3140]
+  mov rax, rsi
+.L.return.u314:
+  ret
+.text
+.p2align 4
+.global u315
+u315:
+  mov rsi, qword ptr [rip+g3233]
+  add rsi, qword ptr [rip+g2183]
+  mov word ptr [rip+g3150], si
+  movsxd rsi, dword ptr [rip+g976]
+  movsxd rdi, dword ptr [rip+g3036]
+  add rsi, rdi
+  mov dword ptr [rip+g3151], esi
+  movsx rsi, byte ptr [rip+g818]
+  movsxd rdi, dword ptr [rip+g162]
+  add rsi, rdi
+  mov word ptr [rip+g3152], si
+  movsx rsi, word ptr [rip+g1440]
+  movsx rdi, word ptr [rip+g3175]
+  add rsi, rdi
+  mov dword ptr [rip+g3153], esi
+  movsxd rsi, dword ptr [rip+g1995]
+  add rsi, qword ptr [rip+g3979]
+  mov byte ptr [rip+g3154], sil
+  movsxd rsi, dword ptr [rip+g1101]
+  movsx rdi, word ptr [rip+g2029]
+  add rsi, rdi
+  mov byte ptr [rip+g3155], sil
+  movsx rsi, word ptr [rip+g4435]
+  movsxd rdi, dword ptr [rip+g3179]
+  add rsi, rdi
+  mov word ptr [rip+g3156], si
+  movsx rsi, byte ptr [rip+g2004]
+  movsx rdi, word ptr [rip+g2774]
+  add rsi, rdi
+  mov dword ptr [rip+g3157], esi
+  mov rsi, qword ptr [rip+g4485]
+  movsx rdi, byte ptr [rip+g3203]
+  add rsi, rdi
+  mov qword ptr [rip+g3158], rsi
+  mov rsi, qword ptr [rip+g4778]
+  movsx rdi, word ptr [rip+g1877]
+  add rsi, rdi
+  mov dword ptr [rip+g3159], esi
+  movsx rsi, word ptr [rip+g3150]
+  mov rax, rsi
+.L.return.u315:
+  ret
+.text
+.p2align 4
+.global u316
+u316:
+  mov rsi, qword ptr [rip+g4457]
+  movsxd rdi, dword ptr [rip+g1790]
+  add rsi, rdi
+  mov word ptr [rip+g3160], si
+  movsx rsi, word ptr [rip+g367]
+  movsx rdi, word ptr [rip+g2166]
+  add rsi, rdi
+  mov qword ptr [rip+g3161], rsi
+  movsx rsi, byte ptr [rip+g2505]
+  add rsi, qword ptr [rip+g3222]
+  mov word ptr [rip+g3162], si
+  movsx rsi, byte ptr [rip+g3306]
+  movsxd rdi, dword ptr [rip+g1479]
+  add rsi, rdi
+  mov byte ptr [rip+g3163], sil
+  movsx rsi, word ptr [rip+g1365]
+  add rsi, qword ptr [rip+g997]
+  mov word ptr [rip+g3164], si
+  movsxd rsi, dword ptr [rip+g3780]
+  movsx rdi, byte ptr [rip+g2822]
+  add rsi, rdi
+  mov byte ptr [rip+g3165], sil
+  movsx rsi, byte ptr [rip+g3610]
+  movsxd rdi, dword ptr [rip+g4100]
+  add rsi, rdi
+  mov word ptr [rip+g3166], si
+  movsx rsi, word ptr [rip+g2424]
+  movsx rdi, word ptr [rip+g847]
+  add rsi, rdi
+  mov dword ptr [rip+g3167], esi
+  mov rsi, qword ptr [rip+g3400]
+  add rsi, qword ptr [rip+g3424]
+  mov qword ptr [rip+g3168], rsi
+  movsxd rsi, dword ptr [rip+g4010]
+  movsx rdi, word ptr [rip+g631]
+  add rsi, rdi
+  mov word ptr [rip+g3169], si
+  movsx rsi, word ptr [rip+g3160]
+  mov rax, rsi
+.L.return.u316:
+  ret
+.text
+.p2align 4
+.global u317
+u317:
+  mov rsi, qword ptr [rip+g246]
+  add rsi, qword ptr [rip+g1521]
+  mov word ptr [rip+g3170], si
+  movsx rsi, word ptr [rip+g493]
+  movsx rdi, byte ptr [rip+g196]
+  add rsi, rdi
+  mov dword ptr [rip+g3171], esi
+  movsxd rsi, dword ptr [rip+g1236]
+  movsxd rdi, dword ptr [rip+g726]
+  add rsi, rdi
+  mov byte ptr [rip+g3172], sil
+  movsx rsi, byte ptr [rip+g4880]
+  movsx rdi, word ptr [rip+g1794]
+  add rsi, rdi
+  mov word ptr [rip+g3173], si
+  movsxd rsi, dword ptr [rip+g3599]
+  movsxd rdi, dword ptr [rip+g214]
+  add rsi, rdi
+  mov dword ptr [rip+g3174], esi
+  movsxd rsi, dword ptr [rip+g1974]
+  movsx rdi, word ptr [rip+g3835]
+  add rsi, rdi
+  mov word ptr [rip+g3175], si
+  mov rsi, qword ptr [rip+g2463]
+  movsxd rdi, dword ptr [rip+g4166]
+  add rsi, rdi
+  mov byte ptr [rip+g3176], sil
+  mov rsi, qword ptr [rip+g1596]
+  movsxd rdi, dword ptr [rip+g616]
+  add rsi, rdi
+  mov dword ptr [rip+g3177], esi
+  movsx rsi, word ptr [rip+g493]
+  movsxd rdi, dword ptr [rip+g2052]
+  add rsi, rdi
+  mov word ptr [rip+g3178], si
+  mov rsi, qword ptr [rip+g3704]
+  movsx rdi, word ptr [rip+g4512]
+  add rsi, rdi
+  mov dword ptr [rip+g3179], esi
+  movsx rsi, word ptr [rip+g3170]
+  mov rax, rsi
+.L.return.u317:
+  ret
+.text
+.p2align 4
+.global u318
+u318:
+  mov rsi, qword ptr [rip+g4966]
+  movsxd rdi, dword ptr [rip+g4847]
+  add rsi, rdi
+  mov dword ptr [rip+g3180], esi
+  mov rsi, qword ptr [rip+g901]
+  movsx rdi, word ptr [rip+g2967]
+  add rsi, rdi
+  mov byte ptr [rip+g3181], sil
+  movsx rsi, word ptr [rip+g360]
+  movsx rdi, word ptr [rip+g1165]
+  add rsi, rdi
+  mov byte ptr [rip+g3182], sil
+  mov rsi, qword ptr [rip+g3677]
+  movsx rdi, word ptr [rip+g4452]
+  add rsi, rdi
+  mov qword ptr [rip+g3183], rsi
+  movsx rsi, word ptr [rip+g4784]
+  add rsi, qword ptr [rip+g4681]
+  mov word ptr [rip+g3184], si
+  movsx rsi, byte ptr [rip+g1237]
+  movsx rdi, word ptr [rip+g1601]
+  add rsi, rdi
+  mov byte ptr [rip+g3185], sil
+  movsx rsi, byte ptr [rip+g981]
+  movsx rdi, byte ptr [rip+g2459]
+  add rsi, rdi
+  mov word ptr [rip+g3186], si
+  movsxd rsi, dword ptr [rip+g4428]
+  add rsi, qword ptr [rip+g2210]
+  mov word ptr [rip+g3187], si
+  movsxd rsi, dword ptr [rip+g3593]
+  movsx rdi, byte ptr [rip+g502]
+  add rsi, rdi
+  mov qword ptr [rip+g3188], rsi
+  movsxd rsi, dword ptr [rip+g162]
+  add rsi, qword ptr [rip+g69]
+  mov word ptr [rip+g3189], si
+  movsxd rsi, dword ptr [rip+g3180]
+  mov rax, rsi
+.L.return.u318:
+  ret
+.text
+.p2align 4
+.global u319
+u319:
+  movsx rsi, word ptr [rip+g637]
+  movsxd rdi, dword ptr [rip+g2203]
+  add rsi, rdi
+  mov word ptr [rip+g3190], si
+  movsx rsi, byte ptr [rip+g3013]
+  movsx rdi, byte ptr [rip+g3125]
+  add rsi, rdi
+  mov dword ptr [rip+g3191], esi
+  movsxd rsi, dword ptr [rip+g1426]
+  movsx rdi, byte ptr [rip+g3502]
+  add rsi, rdi
+  mov qword ptr [rip+g3192], rsi
+  movsx rsi, byte ptr [rip+g3496]
+  movsx rdi, byte ptr [rip+g1180]
+  add rsi, rdi
+  mov dword ptr [rip+g3193], esi
+  movsxd rsi, dword ptr [rip+g937]
+  add rsi, qword ptr [rip+g4579]
+  mov dword ptr [rip+g3194], esi
+  mov rsi, qword ptr [rip+g4233]
+  add rsi, qword ptr [rip+g3276]
+  mov qword ptr [rip+g3195], rsi
+  movsx rsi, byte ptr [rip+g2201]
+  movsx rdi, byte ptr [rip+g3868]
+  add rsi, rdi
+  mov word ptr [rip+g3196], si
+  movsx rsi, word ptr [rip+g2078]
+  movsx rdi, byte ptr [rip+g3812]
+  add rsi, rdi
+  mov dword ptr [rip+g3197], esi
+  movsx rsi, byte ptr [rip+g4203]
+  movsx rdi, byte ptr [rip+g2238]
+  add rsi, rdi
+  mov word ptr [rip+g3198], si
+  mov rsi, qword ptr [rip+g2560]
+  add rsi, qword ptr [rip+g1596]
+  mov byte ptr [rip+g3199], sil
+  movsx rsi, word ptr [rip+g3190]
+  mov rax, rsi
+.L.return.u319:
+  ret
+.text
+.p2align 4
+.global u320
+u320:
+  mov rsi, qword ptr [rip+g2426]
+  add rsi, qword ptr [rip+g3765]
+  mov dword ptr [rip+g3200], esi
+  mov rsi, qword ptr [rip+g2151]
+  add rsi, qword ptr [rip+g3772]
+  mov qword ptr [rip+g3201], rsi
+  movsxd rsi, dword ptr [rip+g1600]
+  add rsi, qword ptr [rip+g3462]
+  mov word ptr [rip+g3202], si
+  movsxd rsi, dword ptr [rip+g2507]
+  movsx rdi, word ptr [rip+g467]
+  add rsi, rdi
+  mov byte ptr [rip+g3203], sil
+  mov rsi, qword ptr [rip+g849]
+  movsx rdi, byte ptr [rip+g2033]
+  add rsi, rdi
+  mov byte ptr [rip+g3204], sil
+  movsxd rsi, dword ptr [rip+g771]
+  movsx rdi, word ptr [rip+g943]
+  add rsi, rdi
+  mov word ptr [rip+g3205], si
+  mov rsi, qword ptr [rip+g672]
+  movsx rdi, word ptr [rip+g3718]
+  add rsi, rdi
+  mov byte ptr [rip+g3206], sil
+  mov rsi, qword ptr [rip+g523]
+  add rsi, qword ptr [rip+g3098]
+  mov byte ptr [rip+g3207], sil
+  movsx rsi, word ptr [rip+g4827]
+  movsxd rdi, dword ptr [rip+g2342]
+  add rsi, rdi
+  mov byte ptr [rip+g3208], sil
+  movsx rsi, word ptr [rip+g1825]
+  movsx rdi, byte ptr [rip+g3986]
+  add rsi, rdi
+  mov dword ptr [rip+g3209], esi
+  movsxd rsi, dword ptr [rip+g3200]
+  mov rax, rsi
+.L.return.u320:
+  ret
+.text
+.p2align 4
+.global u321
+u321:
+  mov rsi, qword ptr [rip+g904]
+  movsxd rdi, dword ptr [rip+g4280]
+  add rsi, rdi
+  mov dword ptr [rip+g3210], esi
+  mov rsi, qword ptr [rip+g4545]
+  add rsi, qword ptr [rip+g780]
+  mov dword ptr [rip+g3211], esi
+  movsxd rsi, dword ptr [rip+g298]
+  movsxd rdi, dword ptr [rip+g1560]
+  add rsi, rdi
+  mov dword ptr [rip+g3212], esi
+  movsx rsi, byte ptr [rip+g1098]
+  add rsi, qword ptr [rip+g759]
+  mov byte ptr [rip+g3213], sil
+  movsxd rsi, dword ptr [rip+g2419]
+  add rsi, qword ptr [rip+g1197]
+  mov dword ptr [rip+g3214], esi
+  movsxd rsi, dword ptr [rip+g1880]
+  movsxd rdi, dword ptr [rip+g1552]
+  add rsi, rdi
+  mov qword ptr [rip+g3215], rsi
+  movsx rsi, word ptr [rip+g4583]
+  movsxd rdi, dword ptr [rip+g162]
+  add rsi, rdi
+  mov byte ptr [rip+g3216], sil
+  movsxd rsi, dword ptr [rip+g1488]
+  movsx rdi, byte ptr [rip+g4754]
+  add rsi, rdi
+  mov qword ptr [rip+g3217], rsi
+  movsx rsi, word ptr [rip+g4342]
+  add rsi, qword ptr [rip+g861]
+  mov word ptr [rip+g3218], si
+  movsx rsi, word ptr [rip+g191]
+  movsxd rdi, dword ptr [rip+g732]
+  add rsi, rdi
+  mov byte ptr [rip+g3219], sil
+  movsxd rsi, dword ptr [rip+g3210]
+  mov rax, rsi
+.L.return.u321:
+  ret
+.text
+.p2align 4
+.global u322
+u322:
+  movsx rsi, byte ptr [rip+g1755]
+  movsx rdi, byte ptr [rip+g3115]
+  add rsi, rdi
+  mov dword ptr [rip+g3220], esi
+  movsx rsi, word ptr [rip+g4366]
+  add rsi, qword ptr [rip+g4623]
+  mov dword ptr [rip+g3221], esi
+  movsx rsi, word ptr [rip+g493]
+  add rsi, qword ptr [rip+g20]
+  mov qword ptr [rip+g3222], rsi
+  movsxd rsi, dword ptr [rip+g2233]
+  movsxd rdi, dword ptr [rip+g739]
+  add rsi, rdi
+  mov word ptr [rip+g3223], si
+  movsx rsi, byte ptr [rip+g3254]
+  movsx rdi, word ptr [rip+g3160]
+  add rsi, rdi
+  mov dword ptr [rip+g3224], esi
+  movsx rsi, byte ptr [rip+g97]
+  movsx rdi, byte ptr [rip+g4341]
+  add rsi, rdi
+  mov qword ptr [rip+g3225], rsi
+  mov rsi, qword ptr [rip+g3338]
+  movsx rdi, byte ptr [rip+g1136]
+  add rsi, rdi
+  mov word ptr [rip+g3226], si
+  movsx rsi, word ptr [rip+g4510]
+  add rsi, qword ptr [rip+g1673]
+  mov qword ptr [rip+g3227], rsi
+  movsx rsi, byte ptr [rip+g1593]
+  movsxd rdi, dword ptr [rip+g1940]
+  add rsi, rdi
+  mov word ptr [rip+g3228], si
+  mov rsi, qword ptr [rip+g2938]
+  movsx rdi, byte ptr [rip+g651]
+  add rsi, rdi
+  mov qword ptr [rip+g3229], rsi
+  movsxd rsi, dword ptr [rip+g3220]
+  mov rax, rsi
+.L.return.u322:
+  ret
+.text
+.p2align 4
+.global u323
+u323:
+  movsx rsi, byte ptr [rip+g4568]
+  movsx rdi, byte ptr [rip+g4901]
+  add rsi, rdi
+  mov dword ptr [rip+g3230], esi
+  movsx rsi, word ptr [rip+g965]
+  movsxd rdi, dword ptr [rip+g4870]
+  add rsi, rdi
+  mov dword ptr [rip+g3231], esi
+  movsx rsi, word ptr [rip+g2019]
+  movsxd rdi, dword ptr [rip+g104]
+  add rsi, rdi
+  mov qword ptr [rip+g3232], rsi
+  movsx rsi, word ptr [rip+g2793]
+  movsx rdi, byte ptr [rip+g3756]
+  add rsi, rdi
+  mov qword ptr [rip+g3233], rsi
+  movsxd rsi, dword ptr [rip+g4889]
+  add rsi, qword ptr [rip+g3227]
+  mov word ptr [rip+g3234], si
+  movsx rsi, word ptr [rip+g3295]
+  add rsi, qword ptr [rip+g3677]
+  mov byte ptr [rip+g3235], sil
+  movsx rsi, word ptr [rip+g883]
+  movsxd rdi, dword ptr [rip+g4400]
+  add rsi, rdi
+  mov byte ptr [rip+g3236], sil
+  movsx rsi, word ptr [rip+g2936]
+  movsxd rdi, dword ptr [rip+g1774]
+  add rsi, rdi
+  mov qword ptr [rip+g3237], rsi
+  movsxd rsi, dword ptr [rip+g2899]
+  movsxd rdi, dword ptr [rip+g3103]
+  add rsi, rdi
+  mov qword ptr [rip+g3238], rsi
+  movsxd rsi, dword ptr [rip+g3713]
+  movsx rdi, byte ptr [rip+g1226]
+  add rsi, rdi
+  mov dword ptr [rip+g3239], esi
+  movsxd rsi, dword ptr [rip+g3230]
+  mov rax, rsi
+.L.return.u323:
+  ret
+.text
+.p2align 4
+.global u324
+u324:
+  mov rsi, qword ptr [rip+g1972]
+  movsx rdi, byte ptr [rip+g534]
+  add rsi, rdi
+  mov byte ptr [rip+g3240], sil
+  movsxd rsi, dword ptr [rip+g799]
+  movsx rdi, byte ptr [rip+g4034]
+  add rsi, rdi
+  mov word ptr [rip+g3241], si
+  movsx rsi, byte ptr [rip+g4601]
+  movsxd rdi, dword ptr [rip+g1736]
+  add rsi, rdi
+  mov word ptr [rip+g3242], si
+  movsx rsi, word ptr [rip+g3735]
+  add rsi, qword ptr [rip+g5]
+  mov qword ptr [rip+g3243], rsi
+  mov rsi, qword ptr [rip+g4579]
+  add rsi, qword ptr [rip+g520]
+  mov word ptr [rip+g3244], si
+  movsx rsi, word ptr [rip+g1847]
+  movsx rdi, byte ptr [rip+g3076]
+  add rsi, rdi
+  mov byte ptr [rip+g3245], sil
+  mov rsi, qword ptr [rip+g1196]
+  add rsi, qword ptr [rip+g3229]
+  mov word ptr [rip+g3246], si
+  mov rsi, qword ptr [rip+g4170]
+  movsxd rdi, dword ptr [rip+g1665]
+  add rsi, rdi
+  mov word ptr [rip+g3247], si
+  mov rsi, qword ptr [rip+g321]
+  movsxd rdi, dword ptr [rip+g4047]
+  add rsi, rdi
+  mov qword ptr [rip+g3248], rsi
+  movsxd rsi, dword ptr [rip+g4368]
+  movsx rdi, byte ptr [rip+g649]
+  add rsi, rdi
+  mov dword ptr [rip+g3249], esi
+  movsx rsi, byte ptr [rip+g3240]
+  mov rax, rsi
+.L.return.u324:
+  ret
+.text
+.p2align 4
+.global u325
+u325:
+  mov rsi, qword ptr [rip+g3494]
+  movsx rdi, word ptr [rip+g765]
+  add rsi, rdi
+  mov qword ptr [rip+g3250], rsi
+  mov rsi, qword ptr [rip+g2152]
+  movsxd rdi, dword ptr [rip+g1135]
+  add rsi, rdi
+  mov qword ptr [rip+g3251], rsi
+  movsx rsi, byte ptr [rip+g3455]
+  movsx rdi, word ptr [rip+g1730]
+  add rsi, rdi
+  mov byte ptr [rip+g3252], sil
+  movsx rsi, byte ptr [rip+g3520]
+  add rsi, qword ptr [rip+g686]
+  mov word ptr [rip+g3253], si
+  movsx rsi, byte ptr [rip+g2909]
+  movsx rdi, word ptr [rip+g2273]
+  add rsi, rdi
+  mov byte ptr [rip+g3254], sil
+  movsx rsi, byte ptr [rip+g4335]
+  add rsi, qword ptr [rip+g4571]
+  mov word ptr [rip+g3255], si
+  movsx rsi, byte ptr [rip+g2299]
+  movsxd rdi, dword ptr [rip+g2597]
+  add rsi, rdi
+  mov word ptr [rip+g3256], si
+  movsx rsi, byte ptr [rip+g3520]
+  movsx rdi, byte ptr [rip+g2850]
+  add rsi, rdi
+  mov qword ptr [rip+g3257], rsi
+  movsx rsi, word ptr [rip+g1438]
+  movsxd rdi, dword ptr [rip+g3865]
+  add rsi, rdi
+  mov byte ptr [rip+g3258], sil
+  movsx rsi, word ptr [rip+g2230]
+  movsx rdi, byte ptr [rip+g27]
+  add rsi, rdi
+  mov word ptr [rip+g3259], si
+  mov rax, qword ptr [rip+g3250]
+.L.return.u325:
+  ret
+.text
+.p2align 4
+.global u326
+u326:
+  movsxd rsi, dword ptr [rip+g4020]
+  add rsi, qword ptr [rip+g30]
+  mov dword ptr [rip+g3260], esi
+  movsx rsi, byte ptr [rip+g4706]
+  movsx rdi, word ptr [rip+g3433]
+  add rsi, rdi
+  mov word ptr [rip+g3261], si
+  mov rsi, qword ptr [rip+g3682]
+  movsx rdi, byte ptr [rip+g3048]
+  add rsi, rdi
+  mov word ptr [rip+g3262], si
+  movsx rsi, word ptr [rip+g2799]
+  add rsi, qword ptr [rip+g2483]
+  mov qword ptr [rip+g3263], rsi
+  movsx rsi, byte ptr [rip+g3782]
+  movsx rdi, word ptr [rip+g1589]
+  add rsi, rdi
+  mov dword ptr [rip+g3264], esi
+  movsxd rsi, dword ptr [rip+g1845]
+  add rsi, qword ptr [rip+g4434]
+  mov word ptr [rip+g3265], si
+  movsxd rsi, dword ptr [rip+g1018]
+  movsx rdi, byte ptr [rip+g1761]
+  add rsi, rdi
+  mov byte ptr [rip+g3266], sil
+  movsx rsi, word ptr [rip+g266]
+  movsx rdi, byte ptr [rip+g3076]
+  add rsi, rdi
+  mov byte ptr [rip+g3267], sil
+  movsx rsi, word ptr [rip+g958]
+  movsx rdi, byte ptr [rip+g4426]
+  add rsi, rdi
+  mov word ptr [rip+g3268], si
+  movsx rsi, byte ptr [rip+g400]
+  movsx rdi, byte ptr [rip+g1243]
+  add rsi, rdi
+  mov byte ptr [rip+g3269], sil
+  movsxd rsi, dword ptr [rip+g3260]
+  mov rax, rsi
+.L.return.u326:
+  ret
+.text
+.p2align 4
+.global u327
+u327:
+  movsx rsi, byte ptr [rip+g2595]
+  movsx rdi, byte ptr [rip+g3710]
+  add rsi, rdi
+  mov qword ptr [rip+g3270], rsi
+  movsxd rsi, dword ptr [rip+g4198]
+  movsxd rdi, dword ptr [rip+g3337]
+  add rsi, rdi
+  mov word ptr [rip+g3271], si
+  mov rsi, qword ptr [rip+g3112]
+  movsx rdi, byte ptr [rip+g4181]
+  add rsi, rdi
+  mov byte ptr [rip+g3272], sil
+  movsxd rsi, dword ptr [rip+g3776]
+  movsx rdi, word ptr [rip+g1732]
+  add rsi, rdi
+  mov qword ptr [rip+g3273], rsi
+  movsxd rsi, dword ptr [rip+g4232]
+  movsx rdi, word ptr [rip+g252]
+  add rsi, rdi
+  mov byte ptr [rip+g3274], sil
+  movsx rsi, word ptr [rip+g4791]
+  add rsi, qword ptr [rip+g853]
+  mov qword ptr [rip+g3275], rsi
+  movsx rsi, byte ptr [rip+g4057]
+  movsx rdi, byte ptr [rip+g565]
+  add rsi, rdi
+  mov qword ptr [rip+g3276], rsi
+  mov rsi, qword ptr [rip+g642]
+  movsx rdi, word ptr [rip+g4792]
+  add rsi, rdi
+  mov qword ptr [rip+g3277], rsi
+  mov rsi, qword ptr [rip+g4288]
+  add rsi, qword ptr [rip+g4868]
+  mov dword ptr [rip+g3278], esi
+  movsxd rsi, dword ptr [rip+g580]
+  add rsi, qword ptr [rip+g3787]
+  mov word ptr [rip+g3279], si
+  mov rax, qword ptr [rip+g3270]
+.L.return.u327:
+  ret
+.text
+.p2align 4
+.global u328
+u328:
+  movsx rsi, byte ptr [rip+g1934]
+  add rsi, qword ptr [rip+g1723]
+  mov word ptr [rip+g3280], si
+  mov rsi, qword ptr [rip+g2146]
+  movsx rdi, word ptr [rip+g4777]
+  add rsi, rdi
+  mov qword ptr [rip+g3281], rsi
+  movsx rsi, byte ptr [rip+g2748]
+  add rsi, qword ptr [rip+g4304]
+  mov dword ptr [rip+g3282], esi
+  movsx rsi, byte ptr [rip+g756]
+  movsxd rdi, dword ptr [rip+g2086]
+  add rsi, rdi
+  mov byte ptr [rip+g3283], sil
+  mov rsi, qword ptr [rip+g4200]
+  movsx rdi, byte ptr [rip+g2623]
+  add rsi, rdi
+  mov dword ptr [rip+g3284], esi
+  movsxd rsi, dword ptr [rip+g2578]
+  add rsi, qword ptr [rip+g228]
+  mov qword ptr [rip+g3285], rsi
+  movsx rsi, word ptr [rip+g2498]
+  movsx rdi, word ptr [rip+g221]
+  add rsi, rdi
+  mov qword ptr [rip+g3286], rsi
+  movsx rsi, word ptr [rip+g1356]
+  movsx rdi, byte ptr [rip+g160]
+  add rsi, rdi
+  mov qword ptr [rip+g3287], rsi
+  movsxd rsi, dword ptr [rip+g2750]
+  movsx rdi, byte ptr [rip+g4908]
+  add rsi, rdi
+  mov dword ptr [rip+g3288], esi
+  movsxd rsi, dword ptr [rip+g218]
+  movsx rdi, byte ptr [rip+g3610]
+  add rsi, rdi
+  mov word ptr [rip+g3289], si
+  movsx rsi, word ptr [rip+g3280]
+  mov rax, rsi
+.L.return.u328:
+  ret
+.text
+.p2align 4
+.global u329
+u329:
+  movsx rsi, byte ptr [rip+g403]
+  movsxd rdi, dword ptr [rip+g3134]
+  add rsi, rdi
+  mov dword ptr [rip+g3290], esi
+  mov rsi, qword ptr [rip+g3053]
+  movsxd rdi, dword ptr [rip+g1431]
+  add rsi, rdi
+  mov qword ptr [rip+g3291], rsi
+  movsxd rsi, dword ptr [rip+g1654]
+  movsx rdi, byte ptr [rip+g1410]
+  add rsi, rdi
+  mov word ptr [rip+g3292], si
+  movsx rsi, byte ptr [rip+g4582]
+  add rsi, qword ptr [rip+g569]
+  mov word ptr [rip+g3293], si
+  movsx rsi, byte ptr [rip+g4757]
+  movsxd rdi, dword ptr [rip+g2842]
+  add rsi, rdi
+  mov dword ptr [rip+g3294], esi
+  movsx rsi, word ptr [rip+g4970]
+  movsxd rdi, dword ptr [rip+g3723]
+  add rsi, rdi
+  mov word ptr [rip+g3295], si
+  movsx rsi, word ptr [rip+g1072]
+  add rsi, qword ptr [rip+g2604]
+  mov byte ptr [rip+g3296], sil
+  movsx rsi, byte ptr [rip+g3116]
+  add rsi, qword ptr [rip+g3376]
+  mov dword ptr [rip+g3297], esi
+  movsxd rsi, dword ptr [rip+g1301]
+  movsxd rdi, dword ptr [rip+g898]
+  add rsi, rdi
+  mov word ptr [rip+g3298], si
+  movsx rsi, word ptr [rip+g3364]
+  movsx rdi, word ptr [rip+g4970]
+  add rsi, rdi
+  mov dword ptr [rip+g3299], esi
+  movsxd rsi, dword ptr [rip+g3290]
+  mov rax, rsi
+.L.return.u329:
+  ret
+.text
+.p2align 4
+.global u330
+u330:
+  movsx rsi, word ptr [rip+g2290]
+  movsxd rdi, dword ptr [rip+g895]
+  add rsi, rdi
+  mov dword ptr [rip+g3300], esi
+  mov rsi, qword ptr [rip+g4481]
+  movsxd rdi, dword ptr [rip+g4678]
+  add rsi, rdi
+  mov qword ptr [rip+g3301], rsi
+  movsx rsi, byte ptr [rip+g568]
+  movsxd rdi, dword ptr [rip+g4873]
+  add rsi, rdi
+  mov byte ptr [rip+g3302], sil
+  mov rsi, qword ptr [rip+g4991]
+  movsx rdi, word ptr [rip+g3820]
+  add rsi, rdi
+  mov word ptr [rip+g3303], si
+  movsx rsi, byte ptr [rip+g1563]
+  movsx rdi, byte ptr [rip+g3146]
+  add rsi, rdi
+  mov word ptr [rip+g3304], si
+  movsx rsi, byte ptr [rip+g4518]
+  add rsi, qword ptr [rip+g4350]
+  mov word ptr [rip+g3305], si
+  mov rsi, qword ptr [rip+g4612]
+  movsx rdi, byte ptr [rip+g3089]
+  add rsi, rdi
+  mov byte ptr [rip+g3306], sil
+  movsxd rsi, dword ptr [rip+g2879]
+  movsx rdi, byte ptr [rip+g1754]
+  add rsi, rdi
+  mov byte ptr [rip+g3307], sil
+  movsxd rsi, dword ptr [rip+g3898]
+  movsx rdi, word ptr [rip+g2373]
+  add rsi, rdi
+  mov dword ptr [rip+g3308], esi
+  movsx rsi, word ptr [rip+g2652]
+  movsx rdi, byte ptr [rip+g1260]
+  add rsi, rdi
+  mov dword ptr [rip+g3309], esi
+  movsxd rsi, dword ptr [rip+g3300]
+  mov rax, rsi
+.L.return.u330:
+  ret
+.text
+.p2align 4
+.global u331
+u331:
+  movsxd rsi, dword ptr [rip+g3998]
+  movsx rdi, word ptr [rip+g33]
+  add rsi, rdi
+  mov dword ptr [rip+g3310], esi
+  mov rsi, qword ptr [rip+g2144]
+  movsxd rdi, dword ptr [rip+g3515]
+  add rsi, rdi
+  mov dword ptr [rip+g3311], esi
+  movsx rsi, word ptr [rip+g1438]
+  movsxd rdi, dword ptr [rip+g3806]
+  add rsi, rdi
+  mov dword ptr [rip+g3312], esi
+  movsx rsi, word ptr [rip+g3960]
+  movsxd rdi, dword ptr [rip+g1624]
+  add rsi, rdi
+  mov dword ptr [rip+g3313], esi
+  movsx rsi, word ptr [rip+g445]
+  movsxd rdi, dword ptr [rip+g974]
+  add rsi, rdi
+  mov qword ptr [rip+g3314], rsi
+  mov rsi, qword ptr [rip+g1073]
+  movsxd rdi, dword ptr [rip+g49]
+  add rsi, rdi
+  mov byte ptr [rip+g3315], sil
+  movsx rsi, word ptr [rip+g2539]
+  movsx rdi, word ptr [rip+g2131]
+  add rsi, rdi
+  mov word ptr [rip+g3316], si
+  mov rsi, qword ptr [rip+g1012]
+  add rsi, qword ptr [rip+g1915]
+  mov byte ptr [rip+g3317], sil
+  movsx rsi, byte ptr [rip+g4160]
+  movsxd rdi, dword ptr [rip+g2501]
+  add rsi, rdi
+  mov word ptr [rip+g3318], si
+  mov rsi, qword ptr [rip+g4116]
+  movsxd rdi, dword ptr [rip+g35]
+  add rsi, rdi
+  mov dword ptr [rip+g3319], esi
+  movsxd rsi, dword ptr [rip+g3310]
+  mov rax, rsi
+.L.return.u331:
+  ret
+.text
+.p2align 4
+.global u332
+u332:
+  mov rsi, qword ptr [rip+g1012]
+  movsx rdi, byte ptr [rip+g2490]
+  add rsi, rdi
+  mov byte ptr [rip+g3320], sil
+  movsxd rsi, dword ptr [rip+g31]
+  add rsi, qword ptr [rip+g2283]
+  mov byte ptr [rip+g3321], sil
+  movsxd rsi, dword ptr [rip+g4588]
+  movsx rdi, word ptr [rip+g893]
+  add rsi, rdi
+  mov qword ptr [rip+g3322], rsi
+  mov rsi, qword ptr [rip+g2981]
+  movsx rdi, word ptr [rip+g2928]
+  add rsi, rdi
+  mov dword ptr [rip+g3323], esi
+  movsxd rsi, dword ptr [rip+g4303]
+  movsx rdi, word ptr [rip+g4879]
+  add rsi, rdi
+  mov word ptr [rip+g3324], si
+  movsx rsi, word ptr [rip+g4235]
+  movsx rdi, word ptr [rip+g1290]
+  add rsi, rdi
+  mov dword ptr [rip+g3325], esi
+  movsx rsi, word ptr [rip+g3517]
+  add rsi, qword ptr [rip+g2949]
+  mov word ptr [rip+g3326], si
+  movsxd rsi, dword ptr [rip+g1049]
+  add rsi, qword ptr [rip+g208]
+  mov word ptr [rip+g3327], si
+  movsx rsi, byte ptr [rip+g1397]
+  movsxd rdi, dword ptr [rip+g1201]
+  add rsi, rdi
+  mov qword ptr [rip+g3328], rsi
+  movsx rsi, word ptr [rip+g1748]
+  movsxd rdi, dword ptr [rip+g4620]
+  add rsi, rdi
+  mov byte ptr [rip+g3329], sil
+  movsx rsi, byte ptr [rip+g3320]
+  mov rax, rsi
+.L.return.u332:
+  ret
+.text
+.p2align 4
+.global u333
+u333:
+  movsx rsi, byte ptr [rip+g2212]
+  add rsi, qword ptr [rip+g2335]
+  mov byte ptr [rip+g3330], sil
+  movsx rsi, byte ptr [rip+g4811]
+  movsxd rdi, dword ptr [rip+g2886]
+  add rsi, rdi
+  mov byte ptr [rip+g3331], sil
+  movsx rsi, byte ptr [rip+g1193]
+  add rsi, qword ptr [rip+g2253]
+  mov dword ptr [rip+g3332], esi
+  movsx rsi, byte ptr [rip+g3086]
+  add rsi, qword ptr [rip+g2723]
+  mov word ptr [rip+g3333], si
+  movsxd rsi, dword ptr [rip+g1552]
+  movsx rdi, word ptr [rip+g3751]
+  add rsi, rdi
+  mov dword ptr [rip+g3334], esi
+  movsx rsi, word ptr [rip+g4849]
+  movsx rdi, byte ptr [rip+g1500]
+  add rsi, rdi
+  mov dword ptr [rip+g3335], esi
+  movsx rsi, word ptr [rip+g3156]
+  movsx rdi, word ptr [rip+g2810]
+  add rsi, rdi
+  mov dword ptr [rip+g3336], esi
+  movsx rsi, word ptr [rip+g2371]
+  movsx rdi, word ptr [rip+g2652]
+  add rsi, rdi
+  mov dword ptr [rip+g3337], esi
+  movsx rsi, word ptr [rip+g1642]
+  movsxd rdi, dword ptr [rip+g2968]
+  add rsi, rdi
+  mov qword ptr [rip+g3338], rsi
+  movsx rsi, byte ptr [rip+g3267]
+  movsxd rdi, dword ptr [rip+g4939]
+  add rsi, rdi
+  mov dword ptr [rip+g3339], esi
+  movsx rsi, byte ptr [rip+g3330]
+  mov rax, rsi
+.L.return.u333:
+  ret
+.text
+.p2align 4
+.global u334
+u334:
+  movsx rsi, word ptr [rip+g1824]
+  movsx rdi, word ptr [rip+g2774]
+  add rsi, rdi
+  mov dword ptr [rip+g3340], esi
+  movsx rsi, word ptr [rip+g1797]
+  movsx rdi, word ptr [rip+g3896]
+  add rsi, rdi
+  mov byte ptr [rip+g3341], sil
+  mov rsi, qword ptr [rip+g4559]
+  add rsi, qword ptr [rip+g2361]
+  mov word ptr [rip+g3342], si
+  mov rsi, qword ptr [rip+g2826]
+  movsx rdi, word ptr [rip+g3160]
+  add rsi, rdi
+  mov qword ptr [rip+g3343], rsi
+  movsx rsi, byte ptr [rip+g1497]
+  movsx rdi, word ptr [rip+g161]
+  add rsi, rdi
+  mov word ptr [rip+g3344], si
+  movsx rsi, word ptr [rip+g4521]
+  movsx rdi, byte ptr [rip+g875]
+  add rsi, rdi
+  mov dword ptr [rip+g3345], esi
+  movsx rsi, byte ptr [rip+g4467]
+  movsxd rdi, dword ptr [rip+g3388]
+  add rsi, rdi
+  mov qword ptr [rip+g3346], rsi
+  mov rsi, qword ptr [rip+g1786]
+  movsxd rdi, dword ptr [rip+g77]
+  add rsi, rdi
+  mov qword ptr [rip+g3347], rsi
+  movsxd rsi, dword ptr [rip+g865]
+  movsx rdi, byte ptr [rip+g4199]
+  add rsi, rdi
+  mov byte ptr [rip+g3348], sil
+  movsx rsi, byte ptr [rip+g1195]
+  add rsi, qword ptr [rip+g2245]
+  mov qword ptr [rip+g3349], rsi
+  movsxd rsi, dword ptr [rip+g3340]
+  mov rax, rsi
+.L.return.u334:
+  ret
+.text
+.p2align 4
+.global u335
+u335:
+  movsx rsi, byte ptr [rip+g1822]
+  movsx rdi, word ptr [rip+g4862]
+  add rsi, rdi
+  mov qword ptr [rip+g3350], rsi
+  movsx rsi, byte ptr [rip+g372]
+  movsxd rdi, dword ptr [rip+g580]
+  add rsi, rdi
+  mov byte ptr [rip+g3351], sil
+  movsx rsi, byte ptr [rip+g2411]
+  movsx rdi, word ptr [rip+g157]
+  add rsi, rdi
+  mov dword ptr [rip+g3352], esi
+  movsxd rsi, dword ptr [rip+g2022]
+  movsxd rdi, dword ptr [rip+g261]
+  add rsi, rdi
+  mov byte ptr [rip+g3353], sil
+  movsx rsi, byte ptr [rip+g2075]
+  add rsi, qword ptr [rip+g1760]
+  mov byte ptr [rip+g3354], sil
+  mov rsi, qword ptr [rip+g1376]
+  add rsi, qword ptr [rip+g430]
+  mov word ptr [rip+g3355], si
+  movsx rsi, word ptr [rip+g4249]
+  movsxd rdi, dword ptr [rip+g1276]
+  add rsi, rdi
+  mov word ptr [rip+g3356], si
+  movsx rsi, word ptr [rip+g360]
+  add rsi, qword ptr [rip+g4447]
+  mov dword ptr [rip+g3357], esi
+  movsx rsi, byte ptr [rip+g12]
+  movsxd rdi, dword ptr [rip+g815]
+  add rsi, rdi
+  mov word ptr [rip+g3358], si
+  movsx rsi, word ptr [rip+g614]
+  movsx rdi, byte ptr [rip+g1464]
+  add rsi, rdi
+  mov byte ptr [rip+g3359], sil
+  mov rax, qword ptr [rip+g3350]
+.L.return.u335:
+  ret
+.text
+.p2align 4
+.global u336
+u336:
+  movsx rsi, word ptr [rip+g4353]
+  movsx rdi, word ptr [rip+g2168]
+  add rsi, rdi
+  mov word ptr [rip+g3360], si
+  movsx rsi, byte ptr [rip+g3272]
+  add rsi, qword ptr [rip+g470]
+  mov qword ptr [rip+g3361], rsi
+  movsx rsi, byte ptr [rip+g1500]
+  add rsi, qword ptr [rip+g2815]
+  mov dword ptr [rip+g3362], esi
+  movsx rsi, word ptr [rip+g4021]
+  movsx rdi, word ptr [rip+g933]
+  add rsi, rdi
+  mov qword ptr [rip+g3363], rsi
+  movsx rsi, byte ptr [rip+g2395]
+  movsxd rdi, dword ptr [rip+g1740]
+  add rsi, rdi
+  mov word ptr [rip+g3364], si
+  movsx rsi, word ptr [rip+g4812]
+  movsx rdi, word ptr [rip+g1899]
+  add rsi, rdi
+  mov dword ptr [rip+g3365], esi
+  movsx rsi, word ptr [rip+g3774]
+  movsx rdi, byte ptr [rip+g4833]
+  add rsi, rdi
+  mov dword ptr [rip+g3366], esi
+  movsx rsi, byte ptr [rip+g4878]
+  movsx rdi, byte ptr [rip+g4867]
+  add rsi, rdi
+  mov word ptr [rip+g3367], si
+  movsxd rsi, dword ptr [rip+g2485]
+  movsx rdi, byte ptr [rip+g4891]
+  add rsi, rdi
+  mov byte ptr [rip+g3368], sil
+  movsx rsi, byte ptr [rip+g2205]
+  movsx rdi, byte ptr [rip+g902]
+  add rsi, rdi
+  mov dword ptr [rip+g3369], esi
+  movsx rsi, word ptr [rip+g3360]
+  mov rax, rsi
+.L.return.u336:
+  ret
+.text
+.p2align 4
+.global u337
+u337:
+  movsxd rsi, dword ptr [rip+g2054]
+  movsxd rdi, dword ptr [rip+g3907]
+  add rsi, rdi
+  mov word ptr [rip+g3370], si
+  movsx rsi, byte ptr [rip+g3142]
+  movsx rdi, word ptr [rip+g226]
+  add rsi, rdi
+  mov dword ptr [rip+g3371], esi
+  movsx rsi, word ptr [rip+g1824]
+  movsx rdi, byte ptr [rip+g3258]
+  add rsi, rdi
+  mov byte ptr [rip+g3372], sil
+  mov rsi, qword ptr [rip+g997]
+  add rsi, qword ptr [rip+g2693]
+  mov dword ptr [rip+g3373], esi
+  movsx rsi, byte ptr [rip+g4803]
+  movsx rdi, byte ptr [rip+g2243]
+  add rsi, rdi
+  mov qword ptr [rip+g3374], rsi
+  mov rsi, qword ptr [rip+g2681]
+  movsx rdi, word ptr [rip+g2486]
+  add rsi, rdi
+  mov word ptr [rip+g3375], si
+  mov rsi, qword ptr [rip+g406]
+  add rsi, qword ptr [rip+g1676]
+  mov qword ptr [rip+g3376], rsi
+  movsxd rsi, dword ptr [rip+g3958]
+  movsxd rdi, dword ptr [rip+g825]
+  add rsi, rdi
+  mov byte ptr [rip+g3377], sil
+  mov rsi, qword ptr [rip+g4821]
+  add rsi, qword ptr [rip+g3061]
+  mov byte ptr [rip+g3378], sil
+  movsxd rsi, dword ptr [rip+g3211]
+  add rsi, qword ptr [rip+g3911]
+  mov word ptr [rip+g3379], si
+  movsx rsi, word ptr [rip+g3370]
+  mov rax, rsi
+.L.return.u337:
+  ret
+.text
+.p2align 4
+.global u338
+u338:
+  movsx rsi, byte ptr [rip+g270]
+  movsx rdi, byte ptr [rip+g3154]
+  add rsi, rdi
+  mov byte ptr [rip+g3380], sil
+  movsx rsi, word ptr [rip+g272]
+  movsx rdi, word ptr [rip+g3293]
+  add rsi, rdi
+  mov word ptr [rip+g3381], si
+  mov rsi, qword ptr [rip+g3851]
+  movsx rdi, byte ptr [rip+g3649]
+  add rsi, rdi
+  mov word ptr [rip+g3382], si
+  movsx rsi, byte ptr [rip+g3468]
+  movsxd rdi, dword ptr [rip+g3630]
+  add rsi, rdi
+  mov word ptr [rip+g3383], si
+  mov rsi, qword ptr [rip+g1535]
+  movsxd rdi, dword ptr [rip+g2553]
+  add rsi, rdi
+  mov byte ptr [rip+g3384], sil
+  movsx rsi, byte ptr [rip+g4111]
+  add rsi, qword ptr [rip+g4985]
+  mov word ptr [rip+g3385], si
+  movsxd rsi, dword ptr [rip+g16]
+  movsx rdi, byte ptr [rip+g2505]
+  add rsi, rdi
+  mov byte ptr [rip+g3386], sil
+  movsx rsi, word ptr [rip+g1702]
+  movsx rdi, word ptr [rip+g873]
+  add rsi, rdi
+  mov word ptr [rip+g3387], si
+  movsxd rsi, dword ptr [rip+g2875]
+  add rsi, qword ptr [rip+g3598]
+  mov dword ptr [rip+g3388], esi
+  movsxd rsi, dword ptr [rip+g3060]
+  movsxd rdi, dword ptr [rip+g4743]
+  add rsi, rdi
+  mov qword ptr [rip+g3389], rsi
+  movsx rsi, byte ptr [rip+g3380]
+  mov rax, rsi
+.L.return.u338:
+  ret
+.text
+.p2align 4
+.global u339
+u339:
+  movsx rsi, word ptr [rip+g1863]
+  movsx rdi, byte ptr [rip+g4075]
+  add rsi, rdi
+  mov qword ptr [rip+g3390], rsi
+  movsx rsi, byte ptr [rip+g1993]
+  movsx rdi, word ptr [rip+g4849]
+  add rsi, rdi
+  mov word ptr [rip+g3391], si
+  movsxd rsi, dword ptr [rip+g1783]
+  movsxd rdi, dword ptr [rip+g4036]
+  add rsi, rdi
+  mov word ptr [rip+g3392], si
+  movsxd rsi, dword ptr [rip+g2399]
+  add rsi, qword ptr [rip+g748]
+  mov qword ptr [rip+g3393], rsi
+  movsx rsi, byte ptr [rip+g3460]
+  movsx rdi, word ptr [rip+g1325]
+  add rsi, rdi
+  mov dword ptr [rip+g3394], esi
+  movsx rsi, byte ptr [rip+g27]
+  movsxd rdi, dword ptr [rip+g1939]
+  add rsi, rdi
+  mov byte ptr [rip+g3395], sil
+  movsxd rsi, dword ptr [rip+g2875]
+  movsxd rdi, dword ptr [rip+g1992]
+  add rsi, rdi
+  mov dword ptr [rip+g3396], esi
+  movsxd rsi, dword ptr [rip+g2384]
+  movsxd rdi, dword ptr [rip+g728]
+  add rsi, rdi
+  mov word ptr [rip+g3397], si
+  movsx rsi, byte ptr [rip+g3155]
+  add rsi, qword ptr [rip+g1504]
+  mov qword ptr [rip+g3398], rsi
+  movsx rsi, byte ptr [rip+g1807]
+  add rsi, qword ptr [rip+g3716]
+  mov dword ptr [rip+g3399], esi
+  mov rax, qword ptr [rip+g3390]
+.L.return.u339:
+  ret
+.text
+.p2align 4
+.global u340
+u340:
+  movsx rsi, word ptr [rip+g4069]
+  movsx rdi, word ptr [rip+g3175]
+  add rsi, rdi
+  mov qword ptr [rip+g3400], rsi
+  movsx rsi, byte ptr [rip+g2303]
+  movsxd rdi, dword ptr [rip+g4870]
+  add rsi, rdi
+  mov qword ptr [rip+g3401], rsi
+  mov rsi, qword ptr [rip+g1173]
+  add rsi, qword ptr [rip+g3539]
+  mov byte ptr [rip+g3402], sil
+  movsxd rsi, dword ptr [rip+g3335]
+  movsx rdi, byte ptr [rip+g970]
+  add rsi, rdi
+  mov byte ptr [rip+g3403], sil
+  movsxd rsi, dword ptr [rip+g193]
+  movsxd rdi, dword ptr [rip+g4678]
+  add rsi, rdi
+  mov dword ptr [rip+g3404], esi
+  movsx rsi, word ptr [rip+g384]
+  add rsi, qword ptr [rip+g310]
+  mov word ptr [rip+g3405], si
+  movsxd rsi, dword ptr [rip+g3311]
+  movsx rdi, byte ptr [rip+g1119]
+  add rsi, rdi
+  mov dword ptr [rip+g3406], esi
+  movsx rsi, byte ptr [rip+g4408]
+  add rsi, qword ptr [rip+g4966]
+  mov qword ptr [rip+g3407], rsi
+  mov rsi, qword ptr [rip+g3021]
+  movsx rdi, word ptr [rip+g3605]
+  add rsi, rdi
+  mov byte ptr [rip+g3408], sil
+  mov rsi, qword ptr [rip+g2937]
+  add rsi, qword ptr [rip+g3301]
+  mov byte ptr [rip+g3409], sil
+  mov rax, qword ptr [rip+g3400]
+.L.return.u340:
+  ret
+.text
+.p2align 4
+.global u341
+u341:
+  mov rsi, qword ptr [rip+g4009]
+  movsx rdi, word ptr [rip+g1817]
+  add rsi, rdi
+  mov dword ptr [rip+g3410], esi
+  mov rsi, qword ptr [rip+g1282]
+  movsx rdi, word ptr [rip+g2793]
+  add rsi, rdi
+  mov qword ptr [rip+g3411], rsi
+  mov rsi, qword ptr [rip+g2458]
+  add rsi, qword ptr [rip+g4860]
+  mov qword ptr [rip+g3412], rsi
+  movsx rsi, byte ptr [rip+g2042]
+  add rsi, qword ptr [rip+g3363]
+  mov qword ptr [rip+g3413], rsi
+  movsxd rsi, dword ptr [rip+g4787]
+  movsx rdi, byte ptr [rip+g1884]
+  add rsi, rdi
+  mov qword ptr [rip+g3414], rsi
+  movsx rsi, word ptr [rip+g4885]
+  add rsi, qword ptr [rip+g2152]
+  mov word ptr [rip+g3415], si
+  movsx rsi, byte ptr [rip+g3507]
+  movsxd rdi, dword ptr [rip+g50]
+  add rsi, rdi
+  mov byte ptr [rip+g3416], sil
+  movsxd rsi, dword ptr [rip+g1051]
+  movsx rdi, byte ptr [rip+g1451]
+  add rsi, rdi
+  mov dword ptr [rip+g3417], esi
+  movsxd rsi, dword ptr [rip+g3759]
+  movsx rdi, byte ptr [rip+g402]
+  add rsi, rdi
+  mov dword ptr [rip+g3418], esi
+  movsx rsi, byte ptr [rip+g4989]
+  movsxd rdi, dword ptr [rip+g4956]
+  add rsi, rdi
+  mov qword ptr [rip+g3419], rsi
+  movsxd rsi, dword ptr [rip+g3410]
+  mov rax, rsi
+.L.return.u341:
+  ret
+.text
+.p2align 4
+.global u342
+u342:
+  movsx rsi, word ptr [rip+g2791]
+  movsx rdi, byte ptr [rip+g874]
+  add rsi, rdi
+  mov dword ptr [rip+g3420], esi
+  mov rsi, qword ptr [rip+g1936]
+  movsxd rdi, dword ptr [rip+g4326]
+  add rsi, rdi
+  mov dword ptr [rip+g3421], esi
+  movsx rsi, word ptr [rip+g44]
+  add rsi, qword ptr [rip+g1010]
+  mov qword ptr [rip+g3422], rsi
+  mov rsi, qword ptr [rip+g1786]
+  movsx rdi, word ptr [rip+g4637]
+  add rsi, rdi
+  mov byte ptr [rip+g3423], sil
+  movsxd rsi, dword ptr [rip+g2250]
+  movsx rdi, byte ptr [rip+g4040]
+  add rsi, rdi
+  mov qword ptr [rip+g3424], rsi
+  movsxd rsi, dword ptr [rip+g3036]
+  add rsi, qword ptr [rip+g1528]
+  mov qword ptr [rip+g3425], rsi
+  mov rsi, qword ptr [rip+g701]
+  movsx rdi, byte ptr [rip+g647]
+  add rsi, rdi
+  mov word ptr [rip+g3426], si
+  movsx rsi, byte ptr [rip+g3978]
+  movsx rdi, word ptr [rip+g4176]
+  add rsi, rdi
+  mov word ptr [rip+g3427], si
+  movsx rsi, byte ptr [rip+g285]
+  movsx rdi, word ptr [rip+g2479]
+  add rsi, rdi
+  mov dword ptr [rip+g3428], esi
+  movsx rsi, byte ptr [rip+g1761]
+  movsxd rdi, dword ptr [rip+g4948]
+  add rsi, rdi
+  mov dword ptr [rip+g3429], esi
+  movsxd rsi, dword ptr [rip+g3420]
+  mov rax, rsi
+.L.return.u342:
+  ret
+.text
+.p2align 4
+.global u343
+u343:
+  mov rsi, qword ptr [rip+g4390]
+  add rsi, qword ptr [rip+g4087]
+  mov word ptr [rip+g3430], si
+  mov rsi, qword ptr [rip+g1012]
+  movsx rdi, byte ptr [rip+g567]
+  add rsi, rdi
+  mov qword ptr [rip+g3431], rsi
+  movsx rsi, byte ptr [rip+g4974]
+  movsx rdi, byte ptr [rip+g2075]
+  add rsi, rdi
+  mov qword ptr [rip+g3432], rsi
+  movsx rsi, word ptr [rip+g2742]
+  movsxd rdi, dword ptr [rip+g3813]
+  add rsi, rdi
+  mov word ptr [rip+g3433], si
+  movsx rsi, byte ptr [rip+g695]
+  movsxd rdi, dword ptr [rip+g2493]
+  add rsi, rdi
+  mov word ptr [rip+g3434], si
+  mov rsi, qword ptr [rip+g3697]
+  movsx rdi, word ptr [rip+g155]
+  add rsi, rdi
+  mov qword ptr [rip+g3435], rsi
+  movsx rsi, word ptr [rip+g3295]
+  movsx rdi, word ptr [rip+g547]
+  add rsi, rdi
+  mov qword ptr [rip+g3436], rsi
+  movsx rsi, byte ptr [rip+g1062]
+  movsx rdi, word ptr [rip+g891]
+  add rsi, rdi
+  mov byte ptr [rip+g3437], sil
+  mov rsi, qword ptr [rip+g4710]
+  add rsi, qword ptr [rip+g2253]
+  mov word ptr [rip+g3438], si
+  mov rsi, qword ptr [rip+g586]
+  add rsi, qword ptr [rip+g4969]
+  mov dword ptr [rip+g3439], esi
+  movsx rsi, word ptr [rip+g3430]
+  mov rax, rsi
+.L.return.u343:
+  ret
+.text
+.p2align 4
+.global u344
+u344:
+  movsx rsi, byte ptr [rip+g4549]
+  movsx rdi, byte ptr [rip+g2395]
+  add rsi, rdi
+  mov qword ptr [rip+g3440], rsi
+  movsx rsi, byte ptr [rip+g2460]
+  add rsi, qword ptr [rip+g520]
+  mov word ptr [rip+g3441], si
+  movsx rsi, word ptr [rip+g770]
+  movsx rdi, byte ptr [rip+g1460]
+  add rsi, rdi
+  mov qword ptr [rip+g3442], rsi
+  movsx rsi, byte ptr [rip+g1656]
+  movsx rdi, word ptr [rip+g2900]
+  add rsi, rdi
+  mov byte ptr [rip+g3443], sil
+  movsxd rsi, dword ptr [rip+g1403]
+  add rsi, qword ptr [rip+g2833]
+  mov byte ptr [rip+g3444], sil
+  mov rsi, qword ptr [rip+g2754]
+  movsx rdi, byte ptr [rip+g4692]
+  add rsi, rdi
+  mov word ptr [rip+g3445], si
+  movsx rsi, word ptr [rip+g640]
+  movsx rdi, word ptr [rip+g2170]
+  add rsi, rdi
+  mov byte ptr [rip+g3446], sil
+  movsx rsi, byte ptr [rip+g375]
+  movsxd rdi, dword ptr [rip+g4216]
+  add rsi, rdi
+  mov dword ptr [rip+g3447], esi
+  movsx rsi, byte ptr [rip+g1275]
+  add rsi, qword ptr [rip+g1882]
+  mov byte ptr [rip+g3448], sil
+  mov rsi, qword ptr [rip+g1211]
+  movsx rdi, byte ptr [rip+g4023]
+  add rsi, rdi
+  mov byte ptr [rip+g3449], sil
+  mov rax, qword ptr [rip+g3440]
+.L.return.u344:
+  ret
+.text
+.p2align 4
+.global u345
+u345:
+  movsx rsi, byte ptr [rip+g3483]
+  movsx rdi, word ptr [rip+g1791]
+  add rsi, rdi
+  mov byte ptr [rip+g3450], sil
+  movsxd rsi, dword ptr [rip+g2626]
+  movsx rdi, byte ptr [rip+g2484]
+  add rsi, rdi
+  mov dword ptr [rip+g3451], esi
+  movsxd rsi, dword ptr [rip+g2827]
+  movsx rdi, word ptr [rip+g426]
+  add rsi, rdi
+  mov qword ptr [rip+g3452], rsi
+  movsxd rsi, dword ptr [rip+g419]
+  movsxd rdi, dword ptr [rip+g2011]
+  add rsi, rdi
+  mov byte ptr [rip+g3453], sil
+  movsx rsi, word ptr [rip+g948]
+  movsx rdi, byte ptr [rip+g592]
+  add rsi, rdi
+  mov byte ptr [rip+g3454], sil
+  mov rsi, qword ptr [rip+g4502]
+  movsxd rdi, dword ptr [rip+g1773]
+  add rsi, rdi
+  mov byte ptr [rip+g3455], sil
+  movsx rsi, word ptr [rip+g2925]
+  add rsi, qword ptr [rip+g2708]
+  mov qword ptr [rip+g3456], rsi
+  movsx rsi, word ptr [rip+g1153]
+  movsx rdi, word ptr [rip+g1951]
+  add rsi, rdi
+  mov word ptr [rip+g3457], si
+  movsx rsi, word ptr [rip+g4712]
+  movsx rdi, byte ptr [rip+g894]
+  add rsi, rdi
+  mov word ptr [rip+g3458], si
+  movsxd rsi, dword ptr [rip+g4905]
+  movsx rdi, byte ptr [rip+g852]
+  add rsi, rdi
+  mov dword ptr [rip+g3459], esi
+  movsx rsi, byte ptr [rip+g3450]
+  mov rax, rsi
+.L.return.u345:
+  ret
+.text
+.p2align 4
+.global u346
+u346:
+  movsxd rsi, dword ptr [rip+g2437]
+  movsxd rdi, dword ptr [rip+g4354]
+  add rsi, rdi
+  mov byte ptr [rip+g3460], sil
+  movsxd rsi, dword ptr [rip+g293]
+  movsx rdi, byte ptr [rip+g700]
+  add rsi, rdi
+  mov byte ptr [rip+g3461], sil
+  movsx rsi, byte ptr [rip+g27]
+  movsx rdi, byte ptr [rip+g2697]
+  add rsi, rdi
+  mov qword ptr [rip+g3462], rsi
+  movsx rsi, byte ptr [rip+g2779]
+  movsx rdi, byte ptr [rip+g1620]
+  add rsi, rdi
+  mov byte ptr [rip+g3463], sil
+  movsx rsi, word ptr [rip+g2651]
+  movsx rdi, byte ptr [rip+g3816]
+  add rsi, rdi
+  mov qword ptr [rip+g3464], rsi
+  mov rsi, qword ptr [rip+g1432]
+  movsx rdi, byte ptr [rip+g462]
+  add rsi, rdi
+  mov byte ptr [rip+g3465], sil
+  movsx rsi, word ptr [rip+g3150]
+  movsx rdi, word ptr [rip+g4125]
+  add rsi, rdi
+  mov dword ptr [rip+g3466], esi
+  movsx rsi, byte ptr [rip+g881]
+  movsx rdi, byte ptr [rip+g2619]
+  add rsi, rdi
+  mov qword ptr [rip+g3467], rsi
+  movsx rsi, byte ptr [rip+g867]
+  movsx rdi, byte ptr [rip+g338]
+  add rsi, rdi
+  mov byte ptr [rip+g3468], sil
+  movsxd rsi, dword ptr [rip+g876]
+  movsx rdi, word ptr [rip+g1862]
+  add rsi, rdi
+  mov qword ptr [rip+g3469], rsi
+  movsx rsi, byte ptr [rip+g3460]
+  mov rax, rsi
+.L.return.u346:
+  ret
+.text
+.p2align 4
+.global u347
+u347:
+  movsxd rsi, dword ptr [rip+g3418]
+  movsx rdi, word ptr [rip+g503]
+  add rsi, rdi
+  mov dword ptr [rip+g3470], esi
+  movsx rsi, byte ptr [rip+g4111]
+  add rsi, qword ptr [rip+g804]
+  mov qword ptr [rip+g3471], rsi
+  movsxd rsi, dword ptr [rip+g1107]
+  add rsi, qword ptr [rip+g1362]
+  mov byte ptr [rip+g3472], sil
+  movsx rsi, byte ptr [rip+g3506]
+  movsx rdi, byte ptr [rip+g1212]
+  add rsi, rdi
+  mov qword ptr [rip+g3473], rsi
+  movsx rsi, byte ptr [rip+g3514]
+  movsxd rdi, dword ptr [rip+g1297]
+  add rsi, rdi
+  mov dword ptr [rip+g3474], esi
+  mov rsi, qword ptr [rip+g4571]
+  movsx rdi, word ptr [rip+g463]
+  add rsi, rdi
+  mov byte ptr [rip+g3475], sil
+  movsxd rsi, dword ptr [rip+g3903]
+  movsx rdi, word ptr [rip+g3769]
+  add rsi, rdi
+  mov word ptr [rip+g3476], si
+  movsx rsi, word ptr [rip+g3360]
+  movsxd rdi, dword ptr [rip+g1434]
+  add rsi, rdi
+  mov byte ptr [rip+g3477], sil
+  movsx rsi, byte ptr [rip+g735]
+  movsxd rdi, dword ptr [rip+g4499]
+  add rsi, rdi
+  mov byte ptr [rip+g3478], sil
+  mov rsi, qword ptr [rip+g3822]
+  add rsi, qword ptr [rip+g392]
+  mov qword ptr [rip+g3479], rsi
+  movsxd rsi, dword ptr [rip+g3470]
+  mov rax, rsi
+.L.return.u347:
+  ret
+.text
+.p2align 4
+.global u348
+u348:
+  movsxd rsi, dword ptr [rip+g4098]
+  movsx rdi, byte ptr [rip+g1988]
+  add rsi, rdi
+  mov byte ptr [rip+g3480], sil
+  movsx rsi, word ptr [rip+g4080]
+  movsx rdi, word ptr [rip+g1817]
+  add rsi, rdi
+  mov dword ptr [rip+g3481], esi
+  mov rsi, qword ptr [rip+g4074]
+  movsx rdi, byte ptr [rip+g2310]
+  add rsi, rdi
+  mov qword ptr [rip+g3482], rsi
+  movsx rsi, word ptr [rip+g1779]
+  movsx rdi, byte ptr [rip+g4809]
+  add rsi, rdi
+  mov byte ptr [rip+g3483], sil
+  mov rsi, qword ptr [rip+g4545]
+  movsx rdi, word ptr [rip+g2668]
+  add rsi, rdi
+  mov qword ptr [rip+g3484], rsi
+  movsx rsi, word ptr [rip+g720]
+  add rsi, qword ptr [rip+g1114]
+  mov word ptr [rip+g3485], si
+  movsxd rsi, dword ptr [rip+g2399]
+  movsx rdi, byte ptr [rip+g3409]
+  add rsi, rdi
+  mov qword ptr [rip+g3486], rsi
+  movsx rsi, word ptr [rip+g4410]
+  movsxd rdi, dword ptr [rip+g4464]
+  add rsi, rdi
+  mov word ptr [rip+g3487], si
+  movsx rsi, word ptr [rip+g2266]
+  movsx rdi, byte ptr [rip+g2034]
+  add rsi, rdi
+  mov byte ptr [rip+g3488], sil
+  movsx rsi, byte ptr [rip+g3929]
+  movsx rdi, word ptr [rip+g563]
+  add rsi, rdi
+  mov qword ptr [rip+g3489], rsi
+  movsx rsi, byte ptr [rip+g3480]
+  mov rax, rsi
+.L.return.u348:
+  ret
+.text
+.p2align 4
+.global u349
+u349:
+  mov rsi, qword ptr [rip+g2377]
+  movsx rdi, byte ptr [rip+g1994]
+  add rsi, rdi
+  mov word ptr [rip+g3490], si
+  movsx rsi, word ptr [rip+g3433]
+  movsxd rdi, dword ptr [rip+g1773]
+  add rsi, rdi
+  mov word ptr [rip+g3491], si
+  movsxd rsi, dword ptr [rip+g1543]
+  movsx rdi, byte ptr [rip+g1022]
+  add rsi, rdi
+  mov dword ptr [rip+g3492], esi
+  movsx rsi, word ptr [rip+g2774]
+  movsxd rdi, dword ptr [rip+g3336]
+  add rsi, rdi
+  mov byte ptr [rip+g3493], sil
+  movsx rsi, word ptr [rip+g4708]
+  movsxd rdi, dword ptr [rip+g613]
+  add rsi, rdi
+  mov qword ptr [rip+g3494], rsi
+  movsxd rsi, dword ptr [rip+g1314]
+  add rsi, qword ptr [rip+g2861]
+  mov byte ptr [rip+g3495], sil
+  movsxd rsi, dword ptr [rip+g713]
+  movsx rdi, word ptr [rip+g63]
+  add rsi, rdi
+  mov byte ptr [rip+g3496], sil
+  mov rsi, qword ptr [rip+g4739]
+  movsxd rdi, dword ptr [rip+g3713]
+  add rsi, rdi
+  mov dword ptr [rip+g3497], esi
+  movsx rsi, word ptr [rip+g531]
+  movsxd rdi, dword ptr [rip+g3681]
+  add rsi, rdi
+  mov qword ptr [rip+g3498], rsi
+  mov rsi, qword ptr [rip+g4116]
+  movsx rdi, byte ptr [rip+g2694]
+  add rsi, rdi
+  mov byte ptr [rip+g3499], sil
+  movsx rsi, word ptr [rip+g3490]
+  mov rax, rsi
+.L.return.u349:
+  ret
+.text
+.p2align 4
+.global u350
+u350:
+  movsxd rsi, dword ptr [rip+g799]
+  movsxd rdi, dword ptr [rip+g1076]
+  add rsi, rdi
+  mov dword ptr [rip+g3500], esi
+  movsxd rsi, dword ptr [rip+g4540]
+  movsx rdi, byte ptr [rip+g3929]
+  add rsi, rdi
+  mov byte ptr [rip+g3501], sil
+  mov rsi, qword ptr [rip+g3552]
+  movsxd rdi, dword ptr [rip+g2122]
+  add rsi, rdi
+  mov byte ptr [rip+g3502], sil
+  movsx rsi, byte ptr [rip+g2288]
+  movsxd rdi, dword ptr [rip+g1284]
+  add rsi, rdi
+  mov byte ptr [rip+g3503], sil
+  movsx rsi, word ptr [rip+g414]
+  movsxd rdi, dword ptr [rip+g3406]
+  add rsi, rdi
+  mov byte ptr [rip+g3504], sil
+  movsx rsi, byte ptr [rip+g694]
+  movsx rdi, word ptr [rip+g4226]
+  add rsi, rdi
+  mov dword ptr [rip+g3505], esi
+  movsxd rsi, dword ptr [rip+g468]
+  movsx rdi, byte ptr [rip+g3501]
+  add rsi, rdi
+  mov byte ptr [rip+g3506], sil
+  movsx rsi, byte ptr [rip+g209]
+  movsxd rdi, dword ptr [rip+g1574]
+  add rsi, rdi
+  mov byte ptr [rip+g3507], sil
+  mov rsi, qword ptr [rip+g3689]
+  movsx rdi, byte ptr [rip+g2477]
+  add rsi, rdi
+  mov dword ptr [rip+g3508], esi
+  movsx rsi, word ptr [rip+g296]
+  add rsi, qword ptr [rip+g2959]
+  mov word ptr [rip+g3509], si
+  movsxd rsi, dword ptr [rip+g3500]
+  mov rax, rsi
+.L.return.u350:
+  ret
+.text
+.p2align 4
+.global u351
+u351:
+  movsx rsi, word ptr [rip+g431]
+  movsxd rdi, dword ptr [rip+g1373]
+  add rsi, rdi
+  mov qword ptr [rip+g3510], rsi
+  movsx rsi, byte ptr [rip+g4017]
+  movsxd rdi, dword ptr [rip+g3420]
+  add rsi, rdi
+  mov dword ptr [rip+g3511], esi
+  movsx rsi, byte ptr [rip+g372]
+  movsx rdi, word ptr [rip+g151]
+  add rsi, rdi
+  mov byte ptr [rip+g3512], sil
+  movsx rsi, word ptr [rip+g2950]
+  movsx rdi, byte ptr [rip+g1340]
+  add rsi, rdi
+  mov dword ptr [rip+g3513], esi
+  movsx rsi, word ptr [rip+g3397]
+  movsxd rdi, dword ptr [rip+g4006]
+  add rsi, rdi
+  mov byte ptr [rip+g3514], sil
+  movsx rsi, word ptr [rip+g2135]
+  movsxd rdi, dword ptr [rip+g898]
+  add rsi, rdi
+  mov dword ptr [rip+g3515], esi
+  movsxd rsi, dword ptr [rip+g525]
+  movsxd rdi, dword ptr [rip+g952]
+  add rsi, rdi
+  mov byte ptr [rip+g3516], sil
+  movsxd rsi, dword ptr [rip+g135]
+  movsx rdi, byte ptr [rip+g4986]
+  add rsi, rdi
+  mov word ptr [rip+g3517], si
+  mov rsi, qword ptr [rip+g2577]
+  movsx rdi, word ptr [rip+g1764]
+  add rsi, rdi
+  mov qword ptr [rip+g3518], rsi
+  movsx rsi, word ptr [rip+g3433]
+  movsxd rdi, dword ptr [rip+g3340]
+  add rsi, rdi
+  mov dword ptr [rip+g3519], esi
+  mov rax, qword ptr [rip+g3510]
+.L.return.u351:
+  ret
+.text
+.p2align 4
+.global u352
+u352:
+  movsxd rsi, dword ptr [rip+g713]
+  add rsi, qword ptr [rip+g3553]
+  mov byte ptr [rip+g3520], sil
+  movsx rsi, word ptr [rip+g3241]
+  movsx rdi, word ptr [rip+g1715]
+  add rsi, rdi
+  mov byte ptr [rip+g3521], sil
+  movsx rsi, byte ptr [rip+g796]
+  movsxd rdi, dword ptr [rip+g1244]
+  add rsi, rdi
+  mov dword ptr [rip+g3522], esi
+  movsxd rsi, dword ptr [rip+g479]
+  add rsi, qword ptr [rip+g343]
+  mov dword ptr [rip+g3523], esi
+  movsx rsi, byte ptr [rip+g4237]
+  movsx rdi, word ptr [rip+g131]
+  add rsi, rdi
+  mov byte ptr [rip+g3524], sil
+  movsx rsi, byte ptr [rip+g1656]
+  movsxd rdi, dword ptr [rip+g3260]
+  add rsi, rdi
+  mov dword ptr [rip+g3525], esi
+  movsxd rsi, dword ptr [rip+g1848]
+  add rsi, qword ptr [rip+g205]
+  mov dword ptr [rip+g3526], esi
+  movsx rsi, word ptr [rip+g3692]
+  movsxd rdi, dword ptr [rip+g4537]
+  add rsi, rdi
+  mov dword ptr [rip+g3527], esi
+  mov rsi, qword ptr [rip+g2377]
+  movsx rdi, byte ptr [rip+g2386]
+  add rsi, rdi
+  mov word ptr [rip+g3528], si
+  movsx rsi, word ptr [rip+g4815]
+  add rsi, qword ptr [rip+g3531]
+  mov dword ptr [rip+g3529], esi
+  movsx rsi, byte ptr [rip+g3520]
+  mov rax, rsi
+.L.return.u352:
+  ret
+.text
+.p2align 4
+.global u353
+u353:
+  movsx rsi, word ptr [rip+g3861]
+  movsx rdi, byte ptr [rip+g2823]
+  add rsi, rdi
+  mov dword ptr [rip+g3530], esi
+  movsxd rsi, dword ptr [rip+g4277]
+  movsxd rdi, dword ptr [rip+g1135]
+  add rsi, rdi
+  mov qword ptr [rip+g3531], rsi
+  movsx rsi, word ptr [rip+g1867]
+  add rsi, qword ptr [rip+g3802]
+  mov qword ptr [rip+g3532], rsi
+  movsx rsi, byte ptr [rip+g4803]
+  movsxd rdi, dword ptr [rip+g309]
+  add rsi, rdi
+  mov word ptr [rip+g3533], si
+  movsx rsi, word ptr [rip+g180]
+  movsxd rdi, dword ptr [rip+g1881]
+  add rsi, rdi
+  mov qword ptr [rip+g3534], rsi
+  movsxd rsi, dword ptr [rip+g3515]
+  movsxd rdi, dword ptr [rip+g3907]
+  add rsi, rdi
+  mov byte ptr [rip+g3535], sil
+  mov rsi, qword ptr [rip+g755]
+  movsx rdi, word ptr [rip+g4178]
+  add rsi, rdi
+  mov byte ptr [rip+g3536], sil
+  movsxd rsi, dword ptr [rip+g1035]
+  movsx rdi, byte ptr [rip+g3886]
+  add rsi, rdi
+  mov byte ptr [rip+g3537], sil
+  movsx rsi, byte ptr [rip+g2783]
+  movsx rdi, byte ptr [rip+g3967]
+  add rsi, rdi
+  mov byte ptr [rip+g3538], sil
+  mov rsi, qword ptr [rip+g427]
+  add rsi, qword ptr [rip+g3819]
+  mov qword ptr [rip+g3539], rsi
+  movsxd rsi, dword ptr [rip+g3530]
+  mov rax, rsi
+.L.return.u353:
+  ret
+.text
+.p2align 4
+.global u354
+u354:
+  movsx rsi, word ptr [rip+g1129]
+  movsx rdi, word ptr [rip+g3611]
+  add rsi, rdi
+  mov qword ptr [rip+g3540], rsi
+  movsxd rsi, dword ptr [rip+g1321]
+  add rsi, qword ptr [rip+g1718]
+  mov word ptr [rip+g3541], si
+  movsxd rsi, dword ptr [rip+g2081]
+  movsxd rdi, dword ptr [rip+g419]
+  add rsi, rdi
+  mov word ptr [rip+g3542], si
+  movsx rsi, word ptr [rip+g2704]
+  add rsi, qword ptr [rip+g1698]
+  mov word ptr [rip+g3543], si
+  movsx rsi, byte ptr [rip+g1667]
+  movsx rdi, byte ptr [rip+g1428]
+  add rsi, rdi
+  mov byte ptr [rip+g3544], sil
+  movsxd rsi, dword ptr [rip+g4208]
+  movsxd rdi, dword ptr [rip+g390]
+  add rsi, rdi
+  mov byte ptr [rip+g3545], sil
+  mov rsi, qword ptr [rip+g4612]
+  movsx rdi, byte ptr [rip+g981]
+  add rsi, rdi
+  mov byte ptr [rip+g3546], sil
+  mov rsi, qword ptr [rip+g1010]
+  movsx rdi, word ptr [rip+g2974]
+  add rsi, rdi
+  mov qword ptr [rip+g3547], rsi
+  movsxd rsi, dword ptr [rip+g1953]
+  movsx rdi, word ptr [rip+g4624]
+  add rsi, rdi
+  mov byte ptr [rip+g3548], sil
+  movsx rsi, byte ptr [rip+g2101]
+  movsxd rdi, dword ptr [rip+g2648]
+  add rsi, rdi
+  mov word ptr [rip+g3549], si
+  mov rax, qword ptr [rip+g3540]
+.L.return.u354:
+  ret
+.text
+.p2align 4
+.global u355
+u355:
+  movsxd rsi, dword ptr [rip+g1053]
+  movsx rdi, word ptr [rip+g3702]
+  add rsi, rdi
+  mov byte ptr [rip+g3550], sil
+  movsx rsi, byte ptr [rip+g3444]
+  movsx rdi, byte ptr [rip+g4252]
+  add rsi, rdi
+  mov byte ptr [rip+g3551], sil
+  mov rsi, qword ptr [rip+g3790]
+  movsx rdi, word ptr [rip+g215]
+  add rsi, rdi
+  mov qword ptr [rip+g3552], rsi
+  movsx rsi, byte ptr [rip+g3595]
+  movsx rdi, byte ptr [rip+g697]
+  add rsi, rdi
+  mov qword ptr [rip+g3553], rsi
+  movsxd rsi, dword ptr [rip+g4672]
+  add rsi, qword ptr [rip+g4432]
+  mov dword ptr [rip+g3554], esi
+  mov rsi, qword ptr [rip+g2832]
+  movsx rdi, word ptr [rip+g788]
+  add rsi, rdi
+  mov byte ptr [rip+g3555], sil
+  movsx rsi, byte ptr [rip+g595]
+  add rsi, qword ptr [rip+g1332]
+  mov dword ptr [rip+g3556], esi
+  movsxd rsi, dword ptr [rip+g103]
+  movsxd rdi, dword ptr [rip+g4866]
+  add rsi, rdi
+  mov qword ptr [rip+g3557], rsi
+  mov rsi, qword ptr [rip+g2150]
+  add rsi, qword ptr [rip+g1677]
+  mov dword ptr [rip+g3558], esi
+  mov rsi, qword ptr [rip+g3067]
+  add rsi, qword ptr [rip+g853]
+  mov word ptr [rip+g3559], si
+  movsx rsi, byte ptr [rip+g3550]
+  mov rax, rsi
+.L.return.u355:
+  ret
+.text
+.p2align 4
+.global u356
+u356:
+  movsx rsi, word ptr [rip+g3734]
+  movsx rdi, byte ptr [rip+g119]
+  add rsi, rdi
+  mov byte ptr [rip+g3560], sil
+  movsx rsi, word ptr [rip+g4922]
+  add rsi, qword ptr [rip+g515]
+  mov byte ptr [rip+g3561], sil
+  movsx rsi, byte ptr [rip+g656]
+  movsx rdi, byte ptr [rip+g288]
+  add rsi, rdi
+  mov word ptr [rip+g3562], si
+  mov rsi, qword ptr [rip+g1905]
+  movsx rdi, word ptr [rip+g3542]
+  add rsi, rdi
+  mov dword ptr [rip+g3563], esi
+  movsxd rsi, dword ptr [rip+g4865]
+  movsx rdi, byte ptr [rip+g2607]
+  add rsi, rdi
+  mov byte ptr [rip+g3564], sil
+  movsx rsi, byte ptr [rip+g1670]
+  movsx rdi, byte ptr [rip+g3460]
+  add rsi, rdi
+  mov qword ptr [rip+g3565], rsi
+  movsx rsi, word ptr [rip+g2168]
+  movsx rdi, byte ptr [rip+g1897]
+  add rsi, rdi
+  mov word ptr [rip+g3566], si
+  movsx rsi, word ptr [rip+g1004]
+  movsx rdi, word ptr [rip+g4673]
+  add rsi, rdi
+  mov word ptr [rip+g3567], si
+  movsx rsi, word ptr [rip+g3543]
+  movsxd rdi, dword ptr [rip+g2874]
+  add rsi, rdi
+  mov dword ptr [rip+g3568], esi
+  movsxd rsi, dword ptr [rip+g2816]
+  add rsi, qword ptr [rip+g3232]
+  mov dword ptr [rip+g3569], esi
+  movsx rsi, byte ptr [rip+g3560]
+  mov rax, rsi
+.L.return.u356:
+  ret
+.text
+.p2align 4
+.global u357
+u357:
+  mov rsi, qword ptr [rip+g3347]
+  movsx rdi, byte ptr [rip+g582]
+  add rsi, rdi
+  mov word ptr [rip+g3570], si
+  movsx rsi, byte ptr [rip+g4501]
+  movsx rdi, byte ptr [rip+g3449]
+  add rsi, rdi
+  mov qword ptr [rip+g3571], rsi
+  movsx rsi, byte ptr [rip+g4608]
+  movsxd rdi, dword ptr [rip+g4428]
+  add rsi, rdi
+  mov qword ptr [rip+g3572], rsi
+  mov rsi, qword ptr [rip+g3161]
+  movsxd rdi, dword ptr [rip+g1434]
+  add rsi, rdi
+  mov dword ptr [rip+g3573], esi
+  movsxd rsi, dword ptr [rip+g934]
+  movsxd rdi, dword ptr [rip+g1691]
+  add rsi, rdi
+  mov qword ptr [rip+g3574], rsi
+  mov rsi, qword ptr [rip+g2566]
+  movsxd rdi, dword ptr [rip+g2553]
+  add rsi, rdi
+  mov byte ptr [rip+g3575], sil
+  movsx rsi, byte ptr [rip+g3736]
+  movsxd rdi, dword ptr [rip+g2994]
+  add rsi, rdi
+  mov qword ptr [rip+g3576], rsi
+  movsx rsi, word ptr [rip+g1954]
+  add rsi, qword ptr [rip+g4913]
+  mov dword ptr [rip+g3577], esi
+  movsxd rsi, dword ptr [rip+g1834]
+  movsx rdi, byte ptr [rip+g1020]
+  add rsi, rdi
+  mov dword ptr [rip+g3578], esi
+  movsxd rsi, dword ptr [rip+g4202]
+  movsx rdi, word ptr [rip+g4239]
+  add rsi, rdi
+  mov byte ptr [rip+g3579], sil
+  movsx rsi, word ptr [rip+g3570]
+  mov rax, rsi
+.L.return.u357:
+  ret
+.text
+.p2align 4
+.global u358
+u358:
+  mov rsi, qword ptr [rip+g1760]
+  add rsi, qword ptr [rip+g1786]
+  mov qword ptr [rip+g3580], rsi
+  mov rsi, qword ptr [rip+g2387]
+  movsx rdi, byte ptr [rip+g1787]
+  add rsi, rdi
+  mov byte ptr [rip+g3581], sil
+  movsx rsi, word ptr [rip+g1380]
+  movsx rdi, byte ptr [rip+g3106]
+  add rsi, rdi
+  mov dword ptr [rip+g3582], esi
+  movsx rsi, word ptr [rip+g4980]
+  movsxd rdi, dword ptr [rip+g3602]
+  add rsi, rdi
+  mov qword ptr [rip+g3583], rsi
+  mov rsi, qword ptr [rip+g3273]
+  movsx rdi, word ptr [rip+g4675]
+  add rsi, rdi
+  mov qword ptr [rip+g3584], rsi
+  movsx rsi, word ptr [rip+g4823]
+  movsxd rdi, dword ptr [rip+g4314]
+  add rsi, rdi
+  mov qword ptr [rip+g3585], rsi
+  movsx rsi, byte ptr [rip+g4759]
+  add rsi, qword ptr [rip+g1976]
+  mov qword ptr [rip+g3586], rsi
+  movsx rsi, word ptr [rip+g4366]
+  movsxd rdi, dword ptr [rip+g1532]
+  add rsi, rdi
+  mov dword ptr [rip+g3587], esi
+  movsx rsi, byte ptr [rip+g4584]
+  movsx rdi, byte ptr [rip+g2055]
+  add rsi, rdi
+  mov qword ptr [rip+g3588], rsi
+  movsxd rsi, dword ptr [rip+g2962]
+  movsx rdi, word ptr [rip+g3030]
+  add rsi, rdi
+  mov byte ptr [rip+g3589], sil
+  mov rax, qword ptr [rip+g3580]
+.L.return.u358:
+  ret
+.text
+.p2align 4
+.global u359
+u359:
+  movsx rsi, byte ptr [rip+g62]
+  add rsi, qword ptr [rip+g3322]
+  mov qword ptr [rip+g3590], rsi
+  movsx rsi, word ptr [rip+g3120]
+  movsxd rdi, dword ptr [rip+g1338]
+  add rsi, rdi
+  mov word ptr [rip+g3591], si
+  mov rsi, qword ptr [rip+g4042]
+  movsx rdi, byte ptr [rip+g4565]
+  add rsi, rdi
+  mov word ptr [rip+g3592], si
+  movsx rsi, byte ptr [rip+g3620]
+  movsx rdi, word ptr [rip+g3646]
+  add rsi, rdi
+  mov dword ptr [rip+g3593], esi
+  movsxd rsi, dword ptr [rip+g3645]
+  movsxd rdi, dword ptr [rip+g214]
+  add rsi, rdi
+  mov word ptr [rip+g3594], si
+  movsx rsi, byte ptr [rip+g3454]
+  movsx rdi, word ptr [rip+g4473]
+  add rsi, rdi
+  mov byte ptr [rip+g3595], sil
+  movsx rsi, word ptr [rip+g2455]
+  movsx rdi, word ptr [rip+g4125]
+  add rsi, rdi
+  mov word ptr [rip+g3596], si
+  mov rsi, qword ptr [rip+g586]
+  movsxd rdi, dword ptr [rip+g2969]
+  add rsi, rdi
+  mov word ptr [rip+g3597], si
+  movsx rsi, byte ptr [rip+g3620]
+  movsxd rdi, dword ptr [rip+g4641]
+  add rsi, rdi
+  mov qword ptr [rip+g3598], rsi
+  mov rsi, qword ptr [rip+g4032]
+  movsx rdi, word ptr [rip+g1639]
+  add rsi, rdi
+  mov dword ptr [rip+g3599], esi
+  mov rax, qword ptr [rip+g3590]
+.L.return.u359:
+  ret
+.text
+.p2align 4
+.global u360
+u360:
+  mov rsi, qword ptr [rip+g3784]
+  movsxd rdi, dword ptr [rip+g4541]
+  add rsi, rdi
+  mov qword ptr [rip+g3600], rsi
+  movsx rsi, byte ptr [rip+g4121]
+  movsxd rdi, dword ptr [rip+g2860]
+  add rsi, rdi
+  mov word ptr [rip+g3601], si
+  movsx rsi, word ptr [rip+g2504]
+  movsx rdi, byte ptr [rip+g2051]
+  add rsi, rdi
+  mov dword ptr [rip+g3602], esi
+  mov rsi, qword ptr [rip+g4263]
+  movsx rdi, word ptr [rip+g558]
+  add rsi, rdi
+  mov byte ptr [rip+g3603], sil
+  movsx rsi, word ptr [rip+g437]
+  movsxd rdi, dword ptr [rip+g4546]
+  add rsi, rdi
+  mov byte ptr [rip+g3604], sil
+  mov rsi, qword ptr [rip+g642]
+  movsxd rdi, dword ptr [rip+g4950]
+  add rsi, rdi
+  mov word ptr [rip+g3605], si
+  movsxd rsi, dword ptr [rip+g1931]
+  movsx rdi, byte ptr [rip+g2364]
+  add rsi, rdi
+  mov word ptr [rip+g3606], si
+  movsx rsi, byte ptr [rip+g2212]
+  add rsi, qword ptr [rip+g4197]
+  mov word ptr [rip+g3607], si
+  mov rsi, qword ptr [rip+g1055]
+  movsx rdi, byte ptr [rip+g2551]
+  add rsi, rdi
+  mov dword ptr [rip+g3608], esi
+  movsxd rsi, dword ptr [rip+g1479]
+  movsx rdi, word ptr [rip+g2651]
+  add rsi, rdi
+  mov qword ptr [rip+g3609], rsi
+  mov rax, qword ptr [rip+g3600]
+.L.return.u360:
+  ret
+.text
+.p2align 4
+.global u361
+u361:
+  mov rsi, qword ptr [rip+g2949]
+  movsxd rdi, dword ptr [rip+g4374]
+  add rsi, rdi
+  mov byte ptr [rip+g3610], sil
+  movsx rsi, word ptr [rip+g926]
+  movsxd rdi, dword ptr [rip+g3903]
+  add rsi, rdi
+  mov word ptr [rip+g3611], si
+  mov rsi, qword ptr [rip+g4563]
+  movsx rdi, byte ptr [rip+g3761]
+  add rsi, rdi
+  mov byte ptr [rip+g3612], sil
+  movsx rsi, word ptr [rip+g1334]
+  movsx rdi, byte ptr [rip+g3752]
+  add rsi, rdi
+  mov qword ptr [rip+g3613], rsi
+  movsx rsi, byte ptr [rip+g588]
+  add rsi, qword ptr [rip+g3238]
+  mov dword ptr [rip+g3614], esi
+  movsxd rsi, dword ptr [rip+g1343]
+  add rsi, qword ptr [rip+g2981]
+  mov dword ptr [rip+g3615], esi
+  mov rsi, qword ptr [rip+g490]
+  add rsi, qword ptr [rip+g3882]
+  mov word ptr [rip+g3616], si
+  movsx rsi, word ptr [rip+g344]
+  add rsi, qword ptr [rip+g81]
+  mov dword ptr [rip+g3617], esi
+  movsx rsi, byte ptr [rip+g201]
+  add rsi, qword ptr [rip+g3539]
+  mov dword ptr [rip+g3618], esi
+  mov rsi, qword ptr [rip+g1726]
+  movsx rdi, word ptr [rip+g3605]
+  add rsi, rdi
+  mov byte ptr [rip+g3619], sil
+  movsx rsi, byte ptr [rip+g3610]
+  mov rax, rsi
+.L.return.u361:
+  ret
+.text
+.p2align 4
+.global u362
+u362:
+  movsxd rsi, dword ptr [rip+g3578]
+  movsx rdi, word ptr [rip+g3948]
+  add rsi, rdi
+  mov byte ptr [rip+g3620], sil
+  movsx rsi, word ptr [rip+g2925]
+  add rsi, qword ptr [rip+g1003]
+  mov dword ptr [rip+g3621], esi
+  movsx rsi, byte ptr [rip+g3219]
+  movsxd rdi, dword ptr [rip+g2415]
+  add rsi, rdi
+  mov dword ptr [rip+g3622], esi
+  movsx rsi, word ptr [rip+g4755]
+  movsx rdi, byte ptr [rip+g4692]
+  add rsi, rdi
+  mov dword ptr [rip+g3623], esi
+  movsxd rsi, dword ptr [rip+g7]
+  movsxd rdi, dword ptr [rip+g3026]
+  add rsi, rdi
+  mov word ptr [rip+g3624], si
+  movsx rsi, byte ptr [rip+g1592]
+  movsx rdi, word ptr [rip+g1419]
+  add rsi, rdi
+  mov qword ptr [rip+g3625], rsi
+  mov rsi, qword ptr [rip+g4116]
+  movsx rdi, word ptr [rip+g1129]
+  add rsi, rdi
+  mov qword ptr [rip+g3626], rsi
+  mov rsi, qword ptr [rip+g4485]
+  movsx rdi, byte ptr [rip+g4669]
+  add rsi, rdi
+  mov dword ptr [rip+g3627], esi
+  movsx rsi, word ptr [rip+g1519]
+  add rsi, qword ptr [rip+g333]
+  mov qword ptr [rip+g3628], rsi
+  movsx rsi, byte ptr [rip+g3876]
+  movsx rdi, byte ptr [rip+g502]
+  add rsi, rdi
+  mov dword ptr [rip+g3629], esi
+  movsx rsi, byte ptr [rip+g3620]
+  mov rax, rsi
+.L.return.u362:
+  ret
+.text
+.p2align 4
+.global u363
+u363:
+  movsx rsi, byte ptr [rip+g3163]
+  movsx rdi, word ptr [rip+g1730]
+  add rsi, rdi
+  mov dword ptr [rip+g3630], esi
+  movsx rsi, byte ptr [rip+g2303]
+  add rsi, qword ptr [rip+g790]
+  mov word ptr [rip+g3631], si
+  movsxd rsi, dword ptr [rip+g1929]
+  movsx rdi, word ptr [rip+g1278]
+  add rsi, rdi
+  mov word ptr [rip+g3632], si
+  movsx rsi, word ptr [rip+g4635]
+  movsxd rdi, dword ptr [rip+g4939]
+  add rsi, rdi
+  mov word ptr [rip+g3633], si
+  mov rsi, qword ptr [rip+g3625]
+  movsx rdi, byte ptr [rip+g3463]
+  add rsi, rdi
+  mov qword ptr [rip+g3634], rsi
+  movsx rsi, byte ptr [rip+g3384]
+  movsx rdi, word ptr [rip+g4176]
+  add rsi, rdi
+  mov qword ptr [rip+g3635], rsi
+  mov rsi, qword ptr [rip+g3361]
+  movsx rdi, byte ptr [rip+g4182]
+  add rsi, rdi
+  mov byte ptr [rip+g3636], sil
+  movsxd rsi, dword ptr [rip+g1705]
+  movsx rdi, word ptr [rip+g4446]
+  add rsi, rdi
+  mov dword ptr [rip+g3637], esi
+  mov rsi, qword ptr [rip+g778]
+  movsx rdi, byte ptr [rip+g1183]
+  add rsi, rdi
+  mov byte ptr [rip+g3638], sil
+  movsxd rsi, dword ptr [rip+g2287]
+  movsxd rdi, dword ptr [rip+g3865]
+  add rsi, rdi
+  mov word ptr [rip+g3639], si
+  movsxd rsi, dword ptr [rip+g3630]
+  mov rax, rsi
+.L.return.u363:
+  ret
+.text
+.p2align 4
+.global u364
+u364:
+  movsxd rsi, dword ptr [rip+g3399]
+  movsxd rdi, dword ptr [rip+g1281]
+  add rsi, rdi
+  mov qword ptr [rip+g3640], rsi
+  movsx rsi, word ptr [rip+g2678]
+  movsx rdi, word ptr [rip+g199]
+  add rsi, rdi
+  mov word ptr [rip+g3641], si
+  mov rsi, qword ptr [rip+g2458]
+  movsx rdi, word ptr [rip+g4780]
+  add rsi, rdi
+  mov word ptr [rip+g3642], si
+  movsx rsi, byte ptr [rip+g4625]
+  movsx rdi, word ptr [rip+g878]
+  add rsi, rdi
+  mov byte ptr [rip+g3643], sil
+  movsxd rsi, dword ptr [rip+g4588]
+  add rsi, qword ptr [rip+g2153]
+  mov word ptr [rip+g3644], si
+  movsxd rsi, dword ptr [rip+g1777]
+  add rsi, qword ptr [rip+g982]
+  mov dword ptr [rip+g3645], esi
+  movsx rsi, word ptr [rip+g2936]
+  movsxd rdi, dword ptr [rip+g4063]
+  add rsi, rdi
+  mov word ptr [rip+g3646], si
+  movsx rsi, word ptr [rip+g28]
+  movsx rdi, byte ptr [rip+g2260]
+  add rsi, rdi
+  mov byte ptr [rip+g3647], sil
+  movsx rsi, byte ptr [rip+g4242]
+  add rsi, qword ptr [rip+g4424]
+  mov dword ptr [rip+g3648], esi
+  mov rsi, qword ptr [rip+g1013]
+  add rsi, qword ptr [rip+g821]
+  mov byte ptr [rip+g3649], sil
+  mov rax, qword ptr [rip+g3640]
+.L.return.u364:
+  ret
+.text
+.p2align 4
+.global u365
+u365:
+  movsxd rsi, dword ptr [rip+g2682]
+  add rsi, qword ptr [rip+g982]
+  mov word ptr [rip+g3650], si
+  mov rsi, qword ptr [rip+g3574]
+  add rsi, qword ptr [rip+g3724]
+  mov qword ptr [rip+g3651], rsi
+  movsxd rsi, dword ptr [rip+g2240]
+  movsx rdi, byte ptr [rip+g4209]
+  add rsi, rdi
+  mov qword ptr [rip+g3652], rsi
+  movsx rsi, byte ptr [rip+g2721]
+  movsxd rdi, dword ptr [rip+g1788]
+  add rsi, rdi
+  mov qword ptr [rip+g3653], rsi
+  movsx rsi, word ptr [rip+g330]
+  movsx rdi, word ptr [rip+g2141]
+  add rsi, rdi
+  mov qword ptr [rip+g3654], rsi
+  movsx rsi, word ptr [rip+g4665]
+  add rsi, qword ptr [rip+g2833]
+  mov dword ptr [rip+g3655], esi
+  movsx rsi, byte ptr [rip+g3213]
+  movsx rdi, byte ptr [rip+g1668]
+  add rsi, rdi
+  mov dword ptr [rip+g3656], esi
+  movsx rsi, word ptr [rip+g2837]
+  add rsi, qword ptr [rip+g4009]
+  mov byte ptr [rip+g3657], sil
+  movsx rsi, word ptr [rip+g1954]
+  movsx rdi, byte ptr [rip+g2631]
+  add rsi, rdi
+  mov word ptr [rip+g3658], si
+  movsxd rsi, dword ptr [rip+g4540]
+  movsxd rdi, dword ptr [rip+g2406]
+  add rsi, rdi
+  mov word ptr [rip+g3659], si
+  movsx rsi, word ptr [rip+g3650]
+  mov rax, rsi
+.L.return.u365:
+  ret
+.text
+.p2align 4
+.global u366
+u366:
+  mov rsi, qword ptr [rip+g3510]
+  add rsi, qword ptr [rip+g1575]
+  mov dword ptr [rip+g3660], esi
+  movsxd rsi, dword ptr [rip+g974]
+  movsxd rdi, dword ptr [rip+g2028]
+  add rsi, rdi
+  mov byte ptr [rip+g3661], sil
+  movsx rsi, word ptr [rip+g3960]
+  movsx rdi, word ptr [rip+g2274]
+  add rsi, rdi
+  mov dword ptr [rip+g3662], esi
+  movsxd rsi, dword ptr [rip+g1301]
+  movsx rdi, byte ptr [rip+g3444]
+  add rsi, rdi
+  mov dword ptr [rip+g3663], esi
+  mov rsi, qword ptr [rip+g4871]
+  movsx rdi, byte ptr [rip+g595]
+  add rsi, rdi
+  mov qword ptr [rip+g3664], rsi
+  movsxd rsi, dword ptr [rip+g22]
+  movsx rdi, word ptr [rip+g4370]
+  add rsi, rdi
+  mov byte ptr [rip+g3665], sil
+  mov rsi, qword ptr [rip+g1283]
+  movsx rdi, word ptr [rip+g3948]
+  add rsi, rdi
+  mov dword ptr [rip+g3666], esi
+  mov rsi, qword ptr [rip+g1517]
+  add rsi, qword ptr [rip+g2633]
+  mov dword ptr [rip+g3667], esi
+  movsx rsi, byte ptr [rip+g3794]
+  movsx rdi, byte ptr [rip+g2823]
+  add rsi, rdi
+  mov byte ptr [rip+g3668], sil
+  movsxd rsi, dword ptr [rip+g2122]
+  add rsi, qword ptr [rip+g1677]
+  mov byte ptr [rip+g3669], sil
+  movsxd rsi, dword ptr [rip+g3660]
+  mov rax, rsi
+.L.return.u366:
+  ret
+.text
+.p2align 4
+.global u367
+u367:
+  movsxd rsi, dword ptr [rip+g4238]
+  add rsi, qword ptr [rip+g2084]
+  mov dword ptr [rip+g3670], esi
+  movsx rsi, byte ptr [rip+g1630]
+  movsx rdi, byte ptr [rip+g2491]
+  add rsi, rdi
+  mov byte ptr [rip+g3671], sil
+  mov rsi, qword ptr [rip+g2715]
+  movsx rdi, byte ptr [rip+g3116]
+  add rsi, rdi
+  mov byte ptr [rip+g3672], sil
+  movsx rsi, byte ptr [rip+g2395]
+  movsxd rdi, dword ptr [rip+g2091]
+  add rsi, rdi
+  mov byte ptr [rip+g3673], sil
+  mov rsi, qword ptr [rip+g2840]
+  movsx rdi, byte ptr [rip+g459]
+  add rsi, rdi
+  mov word ptr [rip+g3674], si
+  movsx rsi, byte ptr [rip+g4242]
+  movsx rdi, byte ptr [rip+g4250]
+  add rsi, rdi
+  mov word ptr [rip+g3675], si
+  mov rsi, qword ptr [rip+g4117]
+  movsx rdi, word ptr [rip+g3280]
+  add rsi, rdi
+  mov word ptr [rip+g3676], si
+  movsx rsi, byte ptr [rip+g3083]
+  add rsi, qword ptr [rip+g3867]
+  mov qword ptr [rip+g3677], rsi
+  movsx rsi, byte ptr [rip+g2386]
+  add rsi, qword ptr [rip+g1597]
+  mov qword ptr [rip+g3678], rsi
+  movsxd rsi, dword ptr [rip+g4173]
+  movsxd rdi, dword ptr [rip+g3529]
+  add rsi, rdi
+  mov qword ptr [rip+g3679], rsi
+  movsxd rsi, dword ptr [rip+g3670]
+  mov rax, rsi
+.L.return.u367:
+  ret
+.text
+.p2align 4
+.global u368
+u368:
+  movsx rsi, byte ptr [rip+g4209]
+  movsx rdi, byte ptr [rip+g335]
+  add rsi, rdi
+  mov qword ptr [rip+g3680], rsi
+  movsx rsi, word ptr [rip+g3253]
+  movsx rdi, byte ptr [rip+g3448]
+  add rsi, rdi
+  mov dword ptr [rip+g3681], esi
+  mov rsi, qword ptr [rip+g4447]
+  movsx rdi, word ptr [rip+g96]
+  add rsi, rdi
+  mov qword ptr [rip+g3682], rsi
+  movsx rsi, byte ptr [rip+g3798]
+  movsx rdi, word ptr [rip+g578]
+  add rsi, rdi
+  mov word ptr [rip+g3683], si
+  movsx rsi, word ptr [rip+g2012]
+  add rsi, qword ptr [rip+g1933]
+  mov word ptr [rip+g3684], si
+  movsxd rsi, dword ptr [rip+g3082]
+  movsx rdi, word ptr [rip+g1516]
+  add rsi, rdi
+  mov qword ptr [rip+g3685], rsi
+  mov rsi, qword ptr [rip+g1014]
+  movsx rdi, word ptr [rip+g3594]
+  add rsi, rdi
+  mov byte ptr [rip+g3686], sil
+  movsx rsi, word ptr [rip+g2793]
+  movsx rdi, word ptr [rip+g1727]
+  add rsi, rdi
+  mov byte ptr [rip+g3687], sil
+  movsxd rsi, dword ptr [rip+g2597]
+  add rsi, qword ptr [rip+g2125]
+  mov word ptr [rip+g3688], si
+  movsx rsi, word ptr [rip+g325]
+  movsx rdi, word ptr [rip+g3895]
+  add rsi, rdi
+  mov qword ptr [rip+g3689], rsi
+  mov rax, qword ptr [rip+g3680]
+.L.return.u368:
+  ret
+.text
+.p2align 4
+.global u369
+u369:
+  movsxd rsi, dword ptr [rip+g4737]
+  movsx rdi, byte ptr [rip+g1306]
+  add rsi, rdi
+  mov word ptr [rip+g3690], si
+  movsx rsi, word ptr [rip+g3289]
+  movsx rdi, word ptr [rip+g2532]
+  add rsi, rdi
+  mov byte ptr [rip+g3691], sil
+  mov rsi, qword ptr [rip+g4773]
+  movsxd rdi, dword ptr [rip+g3523]
+  add rsi, rdi
+  mov word ptr [rip+g3692], si
+  movsxd rsi, dword ptr [rip+g1931]
+  movsxd rdi, dword ptr [rip+g1679]
+  add rsi, rdi
+  mov word ptr [rip+g3693], si
+  movsx rsi, word ptr [rip+g4828]
+  movsx rdi, word ptr [rip+g3942]
+  add rsi, rdi
+  mov dword ptr [rip+g3694], esi
+  movsx rsi, byte ptr [rip+g198]
+  movsxd rdi, dword ptr [rip+g713]
+  add rsi, rdi
+  mov word ptr [rip+g3695], si
+  movsxd rsi, dword ptr [rip+g1126]
+  movsxd rdi, dword ptr [rip+g1371]
+  add rsi, rdi
+  mov dword ptr [rip+g3696], esi
+  movsxd rsi, dword ptr [rip+g825]
+  movsx rdi, byte ptr [rip+g1064]
+  add rsi, rdi
+  mov qword ptr [rip+g3697], rsi
+  movsxd rsi, dword ptr [rip+g4763]
+  movsx rdi, byte ptr [rip+g127]
+  add rsi, rdi
+  mov word ptr [rip+g3698], si
+  movsx rsi, byte ptr [rip+g2717]
+  movsxd rdi, dword ptr [rip+g908]
+  add rsi, rdi
+  mov dword ptr [rip+g3699], esi
+  movsx rsi, word ptr [rip+g3690]
+  mov rax, rsi
+.L.return.u369:
+  ret
+.text
+.p2align 4
+.global u370
+u370:
+  mov rsi, qword ptr [rip+g4457]
+  movsx rdi, byte ptr [rip+g4365]
+  add rsi, rdi
+  mov dword ptr [rip+g3700], esi
+  mov rsi, qword ptr [rip+g3532]
+  add rsi, qword ptr [rip+g1269]
+  mov qword ptr [rip+g3701], rsi
+  movsxd rsi, dword ptr [rip+g2269]
+  movsxd rdi, dword ptr [rip+g4285]
+  add rsi, rdi
+  mov word ptr [rip+g3702], si
+  movsxd rsi, dword ptr [rip+g1556]
+  movsx rdi, byte ptr [rip+g4557]
+  add rsi, rdi
+  mov word ptr [rip+g3703], si
+  mov rsi, qword ptr [rip+g2922]
+  movsx rdi, byte ptr [rip+g12]
+  add rsi, rdi
+  mov qword ptr [rip+g3704], rsi
+  mov rsi, qword ptr [rip+g3486]
+  movsxd rdi, dword ptr [rip+g1459]
+  add rsi, rdi
+  mov dword ptr [rip+g3705], esi
+  movsxd rsi, dword ptr [rip+g474]
+  movsx rdi, word ptr [rip+g1440]
+  add rsi, rdi
+  mov byte ptr [rip+g3706], sil
+  movsxd rsi, dword ptr [rip+g3369]
+  add rsi, qword ptr [rip+g2247]
+  mov byte ptr [rip+g3707], sil
+  movsx rsi, byte ptr [rip+g1934]
+  movsx rdi, byte ptr [rip+g2291]
+  add rsi, rdi
+  mov qword ptr [rip+g3708], rsi
+  movsx rsi, byte ptr [rip+g2640]
+  add rsi, qword ptr [rip+g517]
+  mov byte ptr [rip+g3709], sil
+  movsxd rsi, dword ptr [rip+g3700]
+  mov rax, rsi
+.L.return.u370:
+  ret
+.text
+.p2align 4
+.global u371
+u371:
+  movsxd rsi, dword ptr [rip+g3249]
+  movsxd rdi, dword ptr [rip+g4688]
+  add rsi, rdi
+  mov byte ptr [rip+g3710], sil
+  movsx rsi, byte ptr [rip+g1302]
+  movsx rdi, word ptr [rip+g2936]
+  add rsi, rdi
+  mov qword ptr [rip+g3711], rsi
+  movsx rsi, word ptr [rip+g4454]
+  movsxd rdi, dword ptr [rip+g1276]
+  add rsi, rdi
+  mov dword ptr [rip+g3712], esi
+  mov rsi, qword ptr [rip+g3704]
+  movsxd rdi, dword ptr [rip+g961]
+  add rsi, rdi
+  mov dword ptr [rip+g3713], esi
+  movsxd rsi, dword ptr [rip+g4400]
+  movsx rdi, word ptr [rip+g4827]
+  add rsi, rdi
+  mov qword ptr [rip+g3714], rsi
+  movsxd rsi, dword ptr [rip+g275]
+  movsxd rdi, dword ptr [rip+g3648]
+  add rsi, rdi
+  mov qword ptr [rip+g3715], rsi
+  mov rsi, qword ptr [rip+g1454]
+  movsx rdi, word ptr [rip+g1889]
+  add rsi, rdi
+  mov qword ptr [rip+g3716], rsi
+  movsxd rsi, dword ptr [rip+g387]
+  movsx rdi, word ptr [rip+g1960]
+  add rsi, rdi
+  mov dword ptr [rip+g3717], esi
+  movsx rsi, word ptr [rip+g3129]
+  movsxd rdi, dword ptr [rip+g2104]
+  add rsi, rdi
+  mov word ptr [rip+g3718], si
+  movsx rsi, byte ptr [rip+g1188]
+  movsx rdi, word ptr [rip+g153]
+  add rsi, rdi
+  mov word ptr [rip+g3719], si
+  movsx rsi, byte ptr [rip+g3710]
+  mov rax, rsi
+.L.return.u371:
+  ret
+.text
+.p2align 4
+.global u372
+u372:
+  movsx rsi, byte ptr [rip+g1065]
+  movsxd rdi, dword ptr [rip+g1201]
+  add rsi, rdi
+  mov dword ptr [rip+g3720], esi
+  movsxd rsi, dword ptr [rip+g2485]
+  movsxd rdi, dword ptr [rip+g905]
+  add rsi, rdi
+  mov word ptr [rip+g3721], si
+  mov rsi, qword ptr [rip+g2618]
+  movsx rdi, word ptr [rip+g4762]
+  add rsi, rdi
+  mov word ptr [rip+g3722], si
+  mov rsi, qword ptr [rip+g4525]
+  movsxd rdi, dword ptr [rip+g2542]
+  add rsi, rdi
+  mov dword ptr [rip+g3723], esi
+  mov rsi, qword ptr [rip+g1322]
+  add rsi, qword ptr [rip+g1405]
+  mov qword ptr [rip+g3724], rsi
+  movsxd rsi, dword ptr [rip+g3231]
+  movsx rdi, word ptr [rip+g1152]
+  add rsi, rdi
+  mov byte ptr [rip+g3725], sil
+  movsxd rsi, dword ptr [rip+g1907]
+  add rsi, qword ptr [rip+g4351]
+  mov qword ptr [rip+g3726], rsi
+  mov rsi, qword ptr [rip+g2731]
+  movsxd rdi, dword ptr [rip+g2956]
+  add rsi, rdi
+  mov byte ptr [rip+g3727], sil
+  mov rsi, qword ptr [rip+g721]
+  add rsi, qword ptr [rip+g1413]
+  mov dword ptr [rip+g3728], esi
+  movsx rsi, byte ptr [rip+g4044]
+  add rsi, qword ptr [rip+g4972]
+  mov byte ptr [rip+g3729], sil
+  movsxd rsi, dword ptr [rip+g3720]
+  mov rax, rsi
+.L.return.u372:
+  ret
+.text
+.p2align 4
+.global u373
+u373:
+  mov rsi, qword ptr [rip+g425]
+  movsx rdi, word ptr [rip+g2925]
+  add rsi, rdi
+  mov qword ptr [rip+g3730], rsi
+  movsx rsi, byte ptr [rip+g4449]
+  movsxd rdi, dword ptr [rip+g2143]
+  add rsi, rdi
+  mov byte ptr [rip+g3731], sil
+  movsx rsi, byte ptr [rip+g2601]
+  movsx rdi, byte ptr [rip+g1406]
+  add rsi, rdi
+  mov qword ptr [rip+g3732], rsi
+  movsxd rsi, dword ptr [rip+g4251]
+  movsxd rdi, dword ptr [rip+g484]
+  add rsi, rdi
+  mov dword ptr [rip+g3733], esi
+  movsx rsi, byte ptr [rip+g2850]
+  add rsi, qword ptr [rip+g1693]
+  mov word ptr [rip+g3734], si
+  movsx rsi, byte ptr [rip+g4565]
+  movsx rdi, byte ptr [rip+g4993]
+  add rsi, rdi
+  mov word ptr [rip+g3735], si
+  movsx rsi, word ptr [rip+g1909]
+  add rsi, qword ptr [rip+g3963]
+  mov byte ptr [rip+g3736], sil
+  movsx rsi, word ptr [rip+g188]
+  movsxd rdi, dword ptr [rip+g1068]
+  add rsi, rdi
+  mov byte ptr [rip+g3737], sil
+  mov rsi, qword ptr [rip+g755]
+  add rsi, qword ptr [rip+g1706]
+  mov byte ptr [rip+g3738], sil
+  movsx rsi, word ptr [rip+g2343]
+  movsx rdi, byte ptr [rip+g1111]
+  add rsi, rdi
+  mov qword ptr [rip+g3739], rsi
+  mov rax, qword ptr [rip+g3730]
+.L.return.u373:
+  ret
+.text
+.p2align 4
+.global u374
+u374:
+  movsxd rsi, dword ptr [rip+g3855]
+  movsx rdi, word ptr [rip+g2062]
+  add rsi, rdi
+  mov word ptr [rip+g3740], si
+  mov rsi, qword ptr [rip+g4072]
+  add rsi, qword ptr [rip+g2996]
+  mov qword ptr [rip+g3741], rsi
+  movsxd rsi, dword ptr [rip+g2720]
+  movsxd rdi, dword ptr [rip+g1588]
+  add rsi, rdi
+  mov qword ptr [rip+g3742], rsi
+  mov rsi, qword ptr [rip+g2800]
+  add rsi, qword ptr [rip+g1112]
+  mov dword ptr [rip+g3743], esi
+  mov rsi, qword ptr [rip+g1857]
+  add rsi, qword ptr [rip+g3510]
+  mov byte ptr [rip+g3744], sil
+  mov rsi, qword ptr [rip+g526]
+  movsx rdi, byte ptr [rip+g2427]
+  add rsi, rdi
+  mov word ptr [rip+g3745], si
+  mov rsi, qword ptr [rip+g4412]
+  movsx rdi, word ptr [rip+g2990]
+  add rsi, rdi
+  mov word ptr [rip+g3746], si
+  movsx rsi, byte ptr [rip+g588]
+  movsx rdi, word ptr [rip+g4758]
+  add rsi, rdi
+  mov dword ptr [rip+g3747], esi
+  movsx rsi, word ptr [rip+g63]
+  movsx rdi, byte ptr [rip+g4853]
+  add rsi, rdi
+  mov qword ptr [rip+g3748], rsi
+  movsx rsi, word ptr [rip+g2834]
+  movsxd rdi, dword ptr [rip+g4562]
+  add rsi, rdi
+  mov qword ptr [rip+g3749], rsi
+  movsx rsi, word ptr [rip+g3740]
+  mov rax, rsi
+.L.return.u374:
+  ret
+.text
+.p2align 4
+.global u375
+u375:
+  movsx rsi, word ptr [rip+g594]
+  movsx rdi, byte ptr [rip+g2680]
+  add rsi, rdi
+  mov dword ptr [rip+g3750], esi
+  movsx rsi, byte ptr [rip+g4094]
+  movsx rdi, byte ptr [rip+g2777]
+  add rsi, rdi
+  mov word ptr [rip+g3751], si
+  movsxd rsi, dword ptr [rip+g1975]
+  movsx rdi, byte ptr [rip+g1739]
+  add rsi, rdi
+  mov byte ptr [rip+g3752], sil
+  movsxd rsi, dword ptr [rip+g1886]
+  movsxd rdi, dword ptr [rip+g2442]
+  add rsi, rdi
+  mov qword ptr [rip+g3753], rsi
+  movsx rsi, byte ptr [rip+g1563]
+  movsx rdi, word ptr [rip+g1325]
+  add rsi, rdi
+  mov byte ptr [rip+g3754], sil
+  movsx rsi, word ptr [rip+g3605]
+  movsxd rdi, dword ptr [rip+g3082]
+  add rsi, rdi
+  mov qword ptr [rip+g3755], rsi
+  movsxd rsi, dword ptr [rip+g3339]
+  movsx rdi, word ptr [rip+g2053]
+  add rsi, rdi
+  mov byte ptr [rip+g3756], sil
+  movsx rsi, byte ptr [rip+g1223]
+  movsx rdi, byte ptr [rip+g451]
+  add rsi, rdi
+  mov byte ptr [rip+g3757], sil
+  movsx rsi, byte ptr [rip+g2699]
+  movsx rdi, word ptr [rip+g1562]
+  add rsi, rdi
+  mov byte ptr [rip+g3758], sil
+  movsx rsi, word ptr [rip+g1438]
+  movsx rdi, byte ptr [rip+g1313]
+  add rsi, rdi
+  mov dword ptr [rip+g3759], esi
+  movsxd rsi, dword ptr [rip+g3750]
+  mov rax, rsi
+.L.return.u375:
+  ret
+.text
+.p2align 4
+.global u376
+u376:
+  mov rsi, qword ptr [rip+g1795]
+  movsx rdi, byte ptr [rip+g1021]
+  add rsi, rdi
+  mov byte ptr [rip+g3760], sil
+  movsx rsi, word ptr [rip+g1158]
+  movsx rdi, word ptr [rip+g3166]
+  add rsi, rdi
+  mov byte ptr [rip+g3761], sil
+  movsx rsi, word ptr [rip+g1647]
+  add rsi, qword ptr [rip+g3819]
+  mov word ptr [rip+g3762], si
+  movsxd rsi, dword ptr [rip+g740]
+  movsxd rdi, dword ptr [rip+g1178]
+  add rsi, rdi
+  mov qword ptr [rip+g3763], rsi
+  movsx rsi, byte ptr [rip+g4501]
+  movsxd rdi, dword ptr [rip+g3573]
+  add rsi, rdi
+  mov byte ptr [rip+g3764], sil
+  movsx rsi, byte ptr [rip+g3968]
+  movsx rdi, word ptr [rip+g3940]
+  add rsi, rdi
+  mov qword ptr [rip+g3765], rsi
+  mov rsi, qword ptr [rip+g3263]
+  movsx rdi, word ptr [rip+g2251]
+  add rsi, rdi
+  mov word ptr [rip+g3766], si
+  movsxd rsi, dword ptr [rip+g4265]
+  add rsi, qword ptr [rip+g3635]
+  mov word ptr [rip+g3767], si
+  movsx rsi, word ptr [rip+g1396]
+  movsx rdi, byte ptr [rip+g3236]
+  add rsi, rdi
+  mov dword ptr [rip+g3768], esi
+  movsx rsi, byte ptr [rip+g3870]
+  add rsi, qword ptr [rip+g571]
+  mov word ptr [rip+g3769], si
+  movsx rsi, byte ptr [rip+g3760]
+  mov rax, rsi
+.L.return.u376:
+  ret
+.text
+.p2align 4
+.global u377
+u377:
+  movsx rsi, byte ptr [rip+g1894]
+  movsx rdi, byte ptr [rip+g4599]
+  add rsi, rdi
+  mov byte ptr [rip+g3770], sil
+  movsxd rsi, dword ptr [rip+g363]
+  movsx rdi, byte ptr [rip+g2699]
+  add rsi, rdi
+  mov dword ptr [rip+g3771], esi
+  movsx rsi, byte ptr [rip+g562]
+  movsx rdi, word ptr [rip+g2924]
+  add rsi, rdi
+  mov qword ptr [rip+g3772], rsi
+  movsx rsi, byte ptr [rip+g1968]
+  movsxd rdi, dword ptr [rip+g990]
+  add rsi, rdi
+  mov word ptr [rip+g3773], si
+  movsx rsi, byte ptr [rip+g2939]
+  movsx rdi, word ptr [rip+g1120]
+  add rsi, rdi
+  mov word ptr [rip+g3774], si
+  movsxd rsi, dword ptr [rip+g380]
+  movsx rdi, byte ptr [rip+g2976]
+  add rsi, rdi
+  mov dword ptr [rip+g3775], esi
+  movsxd rsi, dword ptr [rip+g1056]
+  movsx rdi, byte ptr [rip+g3710]
+  add rsi, rdi
+  mov dword ptr [rip+g3776], esi
+  movsxd rsi, dword ptr [rip+g1215]
+  add rsi, qword ptr [rip+g1269]
+  mov dword ptr [rip+g3777], esi
+  movsxd rsi, dword ptr [rip+g390]
+  movsx rdi, word ptr [rip+g4862]
+  add rsi, rdi
+  mov byte ptr [rip+g3778], sil
+  movsxd rsi, dword ptr [rip+g9]
+  movsxd rdi, dword ptr [rip+g1616]
+  add rsi, rdi
+  mov dword ptr [rip+g3779], esi
+  movsx rsi, byte ptr [rip+g3770]
+  mov rax, rsi
+.L.return.u377:
+  ret
+.text
+.p2align 4
+.global u378
+u378:
+  movsx rsi, byte ptr [rip+g902]
+  movsxd rdi, dword ptr [rip+g1000]
+  add rsi, rdi
+  mov dword ptr [rip+g3780], esi
+  mov rsi, qword ptr [rip+g466]
+  movsxd rdi, dword ptr [rip+g4134]
+  add rsi, rdi
+  mov dword ptr [rip+g3781], esi
+  movsx rsi, word ptr [rip+g3149]
+  movsx rdi, byte ptr [rip+g2398]
+  add rsi, rdi
+  mov byte ptr [rip+g3782], sil
+  movsx rsi, word ptr [rip+g2486]
+  movsx rdi, word ptr [rip+g4175]
+  add rsi, rdi
+  mov qword ptr [rip+g3783], rsi
+  movsx rsi, byte ptr [rip+g1176]
+  add rsi, qword ptr [rip+g1908]
+  mov qword ptr [rip+g3784], rsi
+  movsx rsi, byte ptr [rip+g700]
+  add rsi, qword ptr [rip+g4734]
+  mov word ptr [rip+g3785], si
+  movsx rsi, byte ptr [rip+g3886]
+  add rsi, qword ptr [rip+g1370]
+  mov qword ptr [rip+g3786], rsi
+  mov rsi, qword ptr [rip+g646]
+  movsx rdi, byte ptr [rip+g4051]
+  add rsi, rdi
+  mov qword ptr [rip+g3787], rsi
+  movsx rsi, word ptr [rip+g2486]
+  movsxd rdi, dword ptr [rip+g2014]
+  add rsi, rdi
+  mov word ptr [rip+g3788], si
+  movsx rsi, word ptr [rip+g8]
+  movsx rdi, word ptr [rip+g4747]
+  add rsi, rdi
+  mov word ptr [rip+g3789], si
+  movsxd rsi, dword ptr [rip+g3780]
+  mov rax, rsi
+.L.return.u378:
+  ret
+.text
+.p2align 4
+.global u379
+u379:
+  movsx rsi, word ptr [rip+g4378]
+  movsx rdi, word ptr [rip+g1764]
+  add rsi, rdi
+  mov qword ptr [rip+g3790], rsi
+  mov rsi, qword ptr [rip+g1013]
+  movsx rdi, word ptr [rip+g4446]
+  add rsi, rdi
+  mov word ptr [rip+g3791], si
+  movsxd rsi, dword ptr [rip+g1526]
+  movsx rdi, byte ptr [rip+g4640]
+  add rsi, rdi
+  mov word ptr [rip+g3792], si
+  movsx rsi, byte ptr [rip+g2849]
+  movsxd rdi, dword ptr [rip+g274]
+  add rsi, rdi
+  mov word ptr [rip+g3793], si
+  movsx rsi, word ptr [rip+g3856]
+  movsxd rdi, dword ptr [rip+g866]
+  add rsi, rdi
+  mov byte ptr [rip+g3794], sil
+  movsxd rsi, dword ptr [rip+g2597]
+  movsx rdi, word ptr [rip+g199]
+  add rsi, rdi
+  mov word ptr [rip+g3795], si
+  movsx rsi, byte ptr [rip+g198]
+  movsxd rdi, dword ptr [rip+g3466]
+  add rsi, rdi
+  mov qword ptr [rip+g3796], rsi
+  movsxd rsi, dword ptr [rip+g2648]
+  movsx rdi, word ptr [rip+g3953]
+  add rsi, rdi
+  mov qword ptr [rip+g3797], rsi
+  movsxd rsi, dword ptr [rip+g3052]
+  movsx rdi, word ptr [rip+g4849]
+  add rsi, rdi
+  mov byte ptr [rip+g3798], sil
+  mov rsi, qword ptr [rip+g2617]
+  movsx rdi, byte ptr [rip+g4843]
+  add rsi, rdi
+  mov byte ptr [rip+g3799], sil
+  mov rax, qword ptr [rip+g3790]
+.L.return.u379:
+  ret
+.text
+.p2align 4
+.global u380
+u380:
+  movsx rsi, byte ptr [rip+g3054]
+  movsxd rdi, dword ptr [rip+g103]
+  add rsi, rdi
+  mov qword ptr [rip+g3800], rsi
+  movsx rsi, word ptr [rip+g2876]
+  movsxd rdi, dword ptr [rip+g1950]
+  add rsi, rdi
+  mov word ptr [rip+g3801], si
+  movsxd rsi, dword ptr [rip+g4683]
+  add rsi, qword ptr [rip+g3024]
+  mov qword ptr [rip+g3802], rsi
+  movsx rsi, byte ptr [rip+g4501]
+  movsx rdi, byte ptr [rip+g1464]
+  add rsi, rdi
+  mov dword ptr [rip+g3803], esi
+  movsx rsi, byte ptr [rip+g1484]
+  add rsi, qword ptr [rip+g2423]
+  mov qword ptr [rip+g3804], rsi
+  mov rsi, qword ptr [rip+g2465]
+  movsx rdi, word ptr [rip+g3433]
+  add rsi, rdi
+  mov qword ptr [rip+g3805], rsi
+  movsx rsi, byte ptr [rip+g1080]
+  movsx rdi, byte ptr [rip+g67]
+  add rsi, rdi
+  mov dword ptr [rip+g3806], esi
+  mov rsi, qword ptr [rip+g3183]
+  movsxd rdi, dword ptr [rip+g2931]
+  add rsi, rdi
+  mov dword ptr [rip+g3807], esi
+  movsx rsi, word ptr [rip+g1210]
+  movsx rdi, byte ptr [rip+g4838]
+  add rsi, rdi
+  mov qword ptr [rip+g3808], rsi
+  movsxd rsi, dword ptr [rip+g2548]
+  movsx rdi, word ptr [rip+g1985]
+  add rsi, rdi
+  mov dword ptr [rip+g3809], esi
+  mov rax, qword ptr [rip+g3800]
+.L.return.u380:
+  ret
+.text
+.p2align 4
+.global u381
+u381:
+  movsxd rsi, dword ptr [rip+g4889]
+  movsx rdi, word ptr [rip+g574]
+  add rsi, rdi
+  mov dword ptr [rip+g3810], esi
+  mov rsi, qword ptr [rip+g3374]
+  movsxd rdi, dword ptr [rip+g256]
+  add rsi, rdi
+  mov byte ptr [rip+g3811], sil
+  mov rsi, qword ptr [rip+g3117]
+  movsxd rdi, dword ptr [rip+g4223]
+  add rsi, rdi
+  mov byte ptr [rip+g3812], sil
+  movsxd rsi, dword ptr [rip+g2842]
+  add rsi, qword ptr [rip+g3849]
+  mov dword ptr [rip+g3813], esi
+  movsx rsi, byte ptr [rip+g2060]
+  movsxd rdi, dword ptr [rip+g1076]
+  add rsi, rdi
+  mov qword ptr [rip+g3814], rsi
+  movsx rsi, word ptr [rip+g4308]
+  movsx rdi, word ptr [rip+g2121]
+  add rsi, rdi
+  mov word ptr [rip+g3815], si
+  movsx rsi, word ptr [rip+g499]
+  movsx rdi, word ptr [rip+g1748]
+  add rsi, rdi
+  mov byte ptr [rip+g3816], sil
+  movsx rsi, byte ptr [rip+g4757]
+  movsx rdi, word ptr [rip+g302]
+  add rsi, rdi
+  mov qword ptr [rip+g3817], rsi
+  movsx rsi, word ptr [rip+g3342]
+  movsxd rdi, dword ptr [rip+g3051]
+  add rsi, rdi
+  mov word ptr [rip+g3818], si
+  movsxd rsi, dword ptr [rip+g3404]
+  movsx rdi, word ptr [rip+g3105]
+  add rsi, rdi
+  mov qword ptr [rip+g3819], rsi
+  movsxd rsi, dword ptr [rip+g3810]
+  mov rax, rsi
+.L.return.u381:
+  ret
+.text
+.p2align 4
+.global u382
+u382:
+  movsxd rsi, dword ptr [rip+g4505]
+  add rsi, qword ptr [rip+g1005]
+  mov word ptr [rip+g3820], si
+  mov rsi, qword ptr [rip+g3464]
+  movsx rdi, word ptr [rip+g1601]
+  add rsi, rdi
+  mov dword ptr [rip+g3821], esi
+  mov rsi, qword ptr [rip+g1008]
+  add rsi, qword ptr [rip+g2308]
+  mov qword ptr [rip+g3822], rsi
+  mov rsi, qword ptr [rip+g4352]
+  movsx rdi, byte ptr [rip+g475]
+  add rsi, rdi
+  mov dword ptr [rip+g3823], esi
+  mov rsi, qword ptr [rip+g3997]
+  movsx rdi, word ptr [rip+g3289]
+  add rsi, rdi
+  mov word ptr [rip+g3824], si
+  mov rsi, qword ptr [rip+g2087]
+  add rsi, qword ptr [rip+g698]
+  mov word ptr [rip+g3825], si
+  movsx rsi, word ptr [rip+g4799]
+  movsx rdi, word ptr [rip+g4552]
+  add rsi, rdi
+  mov byte ptr [rip+g3826], sil
+  movsxd rsi, dword ptr [rip+g1349]
+  movsx rdi, byte ptr [rip+g4425]
+  add rsi, rdi
+  mov word ptr [rip+g3827], si
+  movsx rsi, word ptr [rip+g677]
+  add rsi, qword ptr [rip+g3518]
+  mov dword ptr [rip+g3828], esi
+  movsx rsi, byte ptr [rip+g109]
+  movsx rdi, byte ptr [rip+g4640]
+  add rsi, rdi
+  mov qword ptr [rip+g3829], rsi
+  movsx rsi, word ptr [rip+g3820]
+  mov rax, rsi
+.L.return.u382:
+  ret
+.text
+.p2align 4
+.global u383
+u383:
+  movsx rsi, byte ptr [rip+g1021]
+  movsxd rdi, dword ptr [rip+g4385]
+  add rsi, rdi
+  mov qword ptr [rip+g3830], rsi
+  movsx rsi, word ptr [rip+g4595]
+  movsx rdi, word ptr [rip+g2834]
+  add rsi, rdi
+  mov dword ptr [rip+g3831], esi
+  mov rsi, qword ptr [rip+g411]
+  movsxd rdi, dword ptr [rip+g1804]
+  add rsi, rdi
+  mov qword ptr [rip+g3832], rsi
+  movsx rsi, byte ptr [rip+g55]
+  movsx rdi, byte ptr [rip+g3520]
+  add rsi, rdi
+  mov word ptr [rip+g3833], si
+  movsx rsi, byte ptr [rip+g3977]
+  movsx rdi, byte ptr [rip+g2823]
+  add rsi, rdi
+  mov qword ptr [rip+g3834], rsi
+  movsx rsi, byte ptr [rip+g4391]
+  movsx rdi, byte ptr [rip+g532]
+  add rsi, rdi
+  mov word ptr [rip+g3835], si
+  movsx rsi, word ptr [rip+g2358]
+  movsxd rdi, dword ptr [rip+g3807]
+  add rsi, rdi
+  mov dword ptr [rip+g3836], esi
+  movsxd rsi, dword ptr [rip+g4537]
+  movsx rdi, byte ptr [rip+g477]
+  add rsi, rdi
+  mov byte ptr [rip+g3837], sil
+  movsx rsi, byte ptr [rip+g1262]
+  movsx rdi, word ptr [rip+g1903]
+  add rsi, rdi
+  mov qword ptr [rip+g3838], rsi
+  mov rsi, qword ptr [rip+g1704]
+  movsx rdi, word ptr [rip+g1174]
+  add rsi, rdi
+  mov qword ptr [rip+g3839], rsi
+  mov rax, qword ptr [rip+g3830]
+.L.return.u383:
+  ret
+.text
+.p2align 4
+.global u384
+u384:
+  mov rsi, qword ptr [rip+g2828]
+  movsx rdi, word ptr [rip+g114]
+  add rsi, rdi
+  mov word ptr [rip+g3840], si
+  movsx rsi, byte ptr [rip+g3520]
+  movsx rdi, byte ptr [rip+g401]
+  add rsi, rdi
+  mov dword ptr [rip+g3841], esi
+  movsxd rsi, dword ptr [rip+g3052]
+  movsx rdi, word ptr [rip+g3987]
+  add rsi, rdi
+  mov word ptr [rip+g3842], si
+  movsx rsi, byte ptr [rip+g4705]
+  add rsi, qword ptr [rip+g3401]
+  mov byte ptr [rip+g3843], sil
+  mov rsi, qword ptr [rip+g2152]
+  movsxd rdi, dword ptr [rip+g4216]
+  add rsi, rdi
+  mov word ptr [rip+g3844], si
+  movsx rsi, byte ptr [rip+g1496]
+  add rsi, qword ptr [rip+g2182]
+  mov qword ptr [rip+g3845], rsi
+  movsx rsi, byte ptr [rip+g2200]
+  movsx rdi, byte ptr [rip+g3002]
+  add rsi, rdi
+  mov dword ptr [rip+g3846], esi
+  movsxd rsi, dword ptr [rip+g2503]
+  movsx rdi, word ptr [rip+g3074]
+  add rsi, rdi
+  mov qword ptr [rip+g3847], rsi
+  mov rsi, qword ptr [rip+g4679]
+  movsx rdi, word ptr [rip+g3740]
+  add rsi, rdi
+  mov byte ptr [rip+g3848], sil
+  movsx rsi, byte ptr [rip+g3125]
+  movsxd rdi, dword ptr [rip+g1879]
+  add rsi, rdi
+  mov qword ptr [rip+g3849], rsi
+  movsx rsi, word ptr [rip+g3840]
+  mov rax, rsi
+.L.return.u384:
+  ret
+.text
+.p2align 4
+.global u385
+u385:
+  movsx rsi, byte ptr [rip+g1872]
+  add rsi, qword ptr [rip+g4122]
+  mov qword ptr [rip+g3850], rsi
+  mov rsi, qword ptr [rip+g3817]
+  movsxd rdi, dword ptr [rip+g1038]
+  add rsi, rdi
+  mov qword ptr [rip+g3851], rsi
+  movsx rsi, word ptr [rip+g4736]
+  add rsi, qword ptr [rip+g243]
+  mov byte ptr [rip+g3852], sil
+  movsx rsi, word ptr [rip+g349]
+  movsx rdi, word ptr [rip+g3674]
+  add rsi, rdi
+  mov dword ptr [rip+g3853], esi
+  movsx rsi, word ptr [rip+g3769]
+  movsxd rdi, dword ptr [rip+g4737]
+  add rsi, rdi
+  mov dword ptr [rip+g3854], esi
+  movsx rsi, word ptr [rip+g344]
+  add rsi, qword ptr [rip+g3943]
+  mov dword ptr [rip+g3855], esi
+  movsxd rsi, dword ptr [rip+g2009]
+  movsx rdi, word ptr [rip+g3562]
+  add rsi, rdi
+  mov word ptr [rip+g3856], si
+  mov rsi, qword ptr [rip+g3066]
+  movsx rdi, word ptr [rip+g1812]
+  add rsi, rdi
+  mov qword ptr [rip+g3857], rsi
+  movsxd rsi, dword ptr [rip+g1276]
+  movsx rdi, byte ptr [rip+g656]
+  add rsi, rdi
+  mov word ptr [rip+g3858], si
+  movsx rsi, word ptr [rip+g4583]
+  add rsi, qword ptr [rip+g2175]
+  mov qword ptr [rip+g3859], rsi
+  mov rax, qword ptr [rip+g3850]
+.L.return.u385:
+  ret
+.text
+.p2align 4
+.global u386
+u386:
+  movsx rsi, word ptr [rip+g4156]
+  movsx rdi, word ptr [rip+g284]
+  add rsi, rdi
+  mov qword ptr [rip+g3860], rsi
+  movsxd rsi, dword ptr [rip+g1783]
+  movsx rdi, word ptr [rip+g4420]
+  add rsi, rdi
+  mov word ptr [rip+g3861], si
+  movsx rsi, byte ptr [rip+g3454]
+  movsx rdi, byte ptr [rip+g3321]
+  add rsi, rdi
+  mov dword ptr [rip+g3862], esi
+  mov rsi, qword ptr [rip+g3188]
+  movsx rdi, byte ptr [rip+g3266]
+  add rsi, rdi
+  mov byte ptr [rip+g3863], sil
+  movsx rsi, word ptr [rip+g2281]
+  movsxd rdi, dword ptr [rip+g1291]
+  add rsi, rdi
+  mov byte ptr [rip+g3864], sil
+  movsx rsi, word ptr [rip+g4879]
+  movsxd rdi, dword ptr [rip+g2240]
+  add rsi, rdi
+  mov dword ptr [rip+g3865], esi
+  movsxd rsi, dword ptr [rip+g202]
+  add rsi, qword ptr [rip+g1454]
+  mov word ptr [rip+g3866], si
+  movsx rsi, byte ptr [rip+g894]
+  movsxd rdi, dword ptr [rip+g969]
+  add rsi, rdi
+  mov qword ptr [rip+g3867], rsi
+  movsx rsi, word ptr [rip+g1327]
+  movsx rdi, byte ptr [rip+g216]
+  add rsi, rdi
+  mov byte ptr [rip+g3868], sil
+  movsxd rsi, dword ptr [rip+g2620]
+  movsxd rdi, dword ptr [rip+g4770]
+  add rsi, rdi
+  mov qword ptr [rip+g3869], rsi
+  mov rax, qword ptr [rip+g3860]
+.L.return.u386:
+  ret
+.text
+.p2align 4
+.global u387
+u387:
+  movsxd rsi, dword ptr [rip+g4006]
+  movsx rdi, word ptr [rip+g1278]
+  add rsi, rdi
+  mov byte ptr [rip+g3870], sil
+  movsx rsi, word ptr [rip+g4409]
+  movsxd rdi, dword ptr [rip+g2880]
+  add rsi, rdi
+  mov dword ptr [rip+g3871], esi
+  mov rsi, qword ptr [rip+g1828]
+  movsx rdi, word ptr [rip+g1466]
+  add rsi, rdi
+  mov qword ptr [rip+g3872], rsi
+  movsx rsi, word ptr [rip+g2230]
+  movsx rdi, word ptr [rip+g1965]
+  add rsi, rdi
+  mov qword ptr [rip+g3873], rsi
+  mov rsi, qword ptr [rip+g1835]
+  add rsi, qword ptr [rip+g811]
+  mov qword ptr [rip+g3874], rsi
+  movsx rsi, word ptr [rip+g4004]
+  movsx rdi, byte ptr [rip+g4945]
+  add rsi, rdi
+  mov word ptr [rip+g3875], si
+  movsxd rsi, dword ptr [rip+g2217]
+  movsx rdi, word ptr [rip+g2893]
+  add rsi, rdi
+  mov byte ptr [rip+g3876], sil
+  movsx rsi, byte ptr [rip+g91]
+  add rsi, qword ptr [rip+g2153]
+  mov byte ptr [rip+g3877], sil
+  mov rsi, qword ptr [rip+g4573]
+  movsxd rdi, dword ptr [rip+g37]
+  add rsi, rdi
+  mov qword ptr [rip+g3878], rsi
+  mov rsi, qword ptr [rip+g1721]
+  movsxd rdi, dword ptr [rip+g2582]
+  add rsi, rdi
+  mov qword ptr [rip+g3879], rsi
+  movsx rsi, byte ptr [rip+g3870]
+  mov rax, rsi
+.L.return.u387:
+  ret
+.text
+.p2align 4
+.global u388
+u388:
+  mov rsi, qword ptr [rip+g258]
+  movsx rdi, byte ptr [rip+g2241]
+  add rsi, rdi
+  mov word ptr [rip+g3880], si
+  movsx rsi, byte ptr [rip+g3514]
+  movsx rdi, byte ptr [rip+g451]
+  add rsi, rdi
+  mov byte ptr [rip+g3881], sil
+  movsx rsi, word ptr [rip+g602]
+  movsx rdi, byte ptr [rip+g3106]
+  add rsi, rdi
+  mov qword ptr [rip+g3882], rsi
+  movsx rsi, byte ptr [rip+g4645]
+  add rsi, qword ptr [rip+g1703]
+  mov word ptr [rip+g3883], si
+  movsx rsi, word ptr [rip+g4226]
+  add rsi, qword ptr [rip+g4581]
+  mov dword ptr [rip+g3884], esi
+  movsx rsi, byte ptr [rip+g4935]
+  add rsi, qword ptr [rip+g2833]
+  mov byte ptr [rip+g3885], sil
+  movsx rsi, word ptr [rip+g4975]
+  movsx rdi, byte ptr [rip+g2660]
+  add rsi, rdi
+  mov byte ptr [rip+g3886], sil
+  movsxd rsi, dword ptr [rip+g3157]
+  add rsi, qword ptr [rip+g569]
+  mov qword ptr [rip+g3887], rsi
+  movsxd rsi, dword ptr [rip+g1061]
+  add rsi, qword ptr [rip+g3413]
+  mov dword ptr [rip+g3888], esi
+  movsxd rsi, dword ptr [rip+g4892]
+  add rsi, qword ptr [rip+g3257]
+  mov byte ptr [rip+g3889], sil
+  movsx rsi, word ptr [rip+g3880]
+  mov rax, rsi
+.L.return.u388:
+  ret
+.text
+.p2align 4
+.global u389
+u389:
+  mov rsi, qword ptr [rip+g4573]
+  movsx rdi, byte ptr [rip+g3868]
+  add rsi, rdi
+  mov qword ptr [rip+g3890], rsi
+  movsxd rsi, dword ptr [rip+g1219]
+  add rsi, qword ptr [rip+g4745]
+  mov qword ptr [rip+g3891], rsi
+  mov rsi, qword ptr [rip+g1179]
+  movsxd rdi, dword ptr [rip+g870]
+  add rsi, rdi
+  mov byte ptr [rip+g3892], sil
+  mov rsi, qword ptr [rip+g2743]
+  movsx rdi, byte ptr [rip+g1497]
+  add rsi, rdi
+  mov word ptr [rip+g3893], si
+  mov rsi, qword ptr [rip+g4486]
+  movsx rdi, byte ptr [rip+g4706]
+  add rsi, rdi
+  mov qword ptr [rip+g3894], rsi
+  movsxd rsi, dword ptr [rip+g2080]
+  movsxd rdi, dword ptr [rip+g3713]
+  add rsi, rdi
+  mov word ptr [rip+g3895], si
+  mov rsi, qword ptr [rip+g4639]
+  movsx rdi, byte ptr [rip+g3185]
+  add rsi, rdi
+  mov word ptr [rip+g3896], si
+  movsx rsi, word ptr [rip+g2320]
+  movsxd rdi, dword ptr [rip+g1107]
+  add rsi, rdi
+  mov byte ptr [rip+g3897], sil
+  mov rsi, qword ptr [rip+g2521]
+  movsxd rdi, dword ptr [rip+g1649]
+  add rsi, rdi
+  mov dword ptr [rip+g3898], esi
+  movsx rsi, byte ptr [rip+g4867]
+  movsx rdi, word ptr [rip+g1576]
+  add rsi, rdi
+  mov dword ptr [rip+g3899], esi
+  mov rax, qword ptr [rip+g3890]
+.L.return.u389:
+  ret
+.text
+.p2align 4
+.global u390
+u390:
+  movsxd rsi, dword ptr [rip+g2086]
+  add rsi, qword ptr [rip+g1957]
+  mov qword ptr [rip+g3900], rsi
+  movsx rsi, byte ptr [rip+g3056]
+  movsx rdi, byte ptr [rip+g981]
+  add rsi, rdi
+  mov qword ptr [rip+g3901], rsi
+  movsxd rsi, dword ptr [rip+g83]
+  movsxd rdi, dword ptr [rip+g380]
+  add rsi, rdi
+  mov dword ptr [rip+g3902], esi
+  movsx rsi, word ptr [rip+g3718]
+  movsx rdi, word ptr [rip+g1184]
+  add rsi, rdi
+  mov dword ptr [rip+g3903], esi
+  movsx rsi, word ptr [rip+g745]
+  movsx rdi, word ptr [rip+g3226]
+  add rsi, rdi
+  mov dword ptr [rip+g3904], esi
+  movsx rsi, byte ptr [rip+g4408]
+  movsx rdi, byte ptr [rip+g447]
+  add rsi, rdi
+  mov qword ptr [rip+g3905], rsi
+  mov rsi, qword ptr [rip+g1546]
+  movsx rdi, word ptr [rip+g3156]
+  add rsi, rdi
+  mov dword ptr [rip+g3906], esi
+  movsx rsi, word ptr [rip+g2561]
+  movsx rdi, word ptr [rip+g1181]
+  add rsi, rdi
+  mov dword ptr [rip+g3907], esi
+  mov rsi, qword ptr [rip+g748]
+  movsx rdi, word ptr [rip+g1117]
+  add rsi, rdi
+  mov byte ptr [rip+g3908], sil
+  movsx rsi, byte ptr [rip+g306]
+  movsx rdi, word ptr [rip+g879]
+  add rsi, rdi
+  mov dword ptr [rip+g3909], esi
+  mov rax, qword ptr [rip+g3900]
+.L.return.u390:
+  ret
+.text
+.p2align 4
+.global u391
+u391:
+  movsx rsi, word ptr [rip+g2775]
+  movsx rdi, byte ptr [rip+g1637]
+  add rsi, rdi
+  mov byte ptr [rip+g3910], sil
+  movsxd rsi, dword ptr [rip+g896]
+  movsx rdi, byte ptr [rip+g3307]
+  add rsi, rdi
+  mov qword ptr [rip+g3911], rsi
+  movsx rsi, byte ptr [rip+g3219]
+  movsxd rdi, dword ptr [rip+g394]
+  add rsi, rdi
+  mov word ptr [rip+g3912], si
+  movsx rsi, word ptr [rip+g2371]
+  movsx rdi, word ptr [rip+g304]
+  add rsi, rdi
+  mov byte ptr [rip+g3913], sil
+  movsxd rsi, dword ptr [rip+g916]
+  add rsi, qword ptr [rip+g1696]
+  mov word ptr [rip+g3914], si
+  movsxd rsi, dword ptr [rip+g2695]
+  movsx rdi, word ptr [rip+g1847]
+  add rsi, rdi
+  mov qword ptr [rip+g3915], rsi
+  movsxd rsi, dword ptr [rip+g608]
+  add rsi, qword ptr [rip+g1024]
+  mov qword ptr [rip+g3916], rsi
+  movsx rsi, word ptr [rip+g1764]
+  movsx rdi, byte ptr [rip+g2768]
+  add rsi, rdi
+  mov word ptr [rip+g3917], si
+  movsxd rsi, dword ptr [rip+g4002]
+  add rsi, qword ptr [rip+g4998]
+  mov byte ptr [rip+g3918], sil
+  movsx rsi, word ptr [rip+g4532]
+  movsx rdi, word ptr [rip+g197]
+  add rsi, rdi
+  mov byte ptr [rip+g3919], sil
+  movsx rsi, byte ptr [rip+g3910]
+  mov rax, rsi
+.L.return.u391:
+  ret
+.text
+.p2align 4
+.global u392
+u392:
+  movsx rsi, word ptr [rip+g3785]
+  movsxd rdi, dword ptr [rip+g2995]
+  add rsi, rdi
+  mov dword ptr [rip+g3920], esi
+  movsxd rsi, dword ptr [rip+g274]
+  movsx rdi, word ptr [rip+g3767]
+  add rsi, rdi
+  mov byte ptr [rip+g3921], sil
+  movsxd rsi, dword ptr [rip+g84]
+  movsx rdi, byte ptr [rip+g3881]
+  add rsi, rdi
+  mov byte ptr [rip+g3922], sil
+  mov rsi, qword ptr [rip+g2608]
+  movsx rdi, word ptr [rip+g2394]
+  add rsi, rdi
+  mov byte ptr [rip+g3923], sil
+  movsx rsi, word ptr [rip+g1875]
+  add rsi, qword ptr [rip+g2798]
+  mov byte ptr [rip+g3924], sil
+  movsxd rsi, dword ptr [rip+g4495]
+  movsxd rdi, dword ptr [rip+g4180]
+  add rsi, rdi
+  mov word ptr [rip+g3925], si
+  mov rsi, qword ptr [rip+g755]
+  movsx rdi, byte ptr [rip+g4838]
+  add rsi, rdi
+  mov dword ptr [rip+g3926], esi
+  movsxd rsi, dword ptr [rip+g3451]
+  movsx rdi, word ptr [rip+g3358]
+  add rsi, rdi
+  mov word ptr [rip+g3927], si
+  movsxd rsi, dword ptr [rip+g2122]
+  add rsi, qword ptr [rip+g3878]
+  mov dword ptr [rip+g3928], esi
+  mov rsi, qword ptr [rip+g1923]
+  movsx rdi, word ptr [rip+g2136]
+  add rsi, rdi
+  mov byte ptr [rip+g3929], sil
+  movsxd rsi, dword ptr [rip+g3920]
+  mov rax, rsi
+.L.return.u392:
+  ret
+.text
+.p2align 4
+.global u393
+u393:
+  movsx rsi, byte ptr [rip+g2835]
+  movsx rdi, word ptr [rip+g4814]
+  add rsi, rdi
+  mov dword ptr [rip+g3930], esi
+  mov rsi, qword ptr [rip+g4680]
+  movsx rdi, byte ptr [rip+g4343]
+  add rsi, rdi
+  mov dword ptr [rip+g3931], esi
+  movsx rsi, byte ptr [rip+g4703]
+  add rsi, qword ptr [rip+g40]
+  mov word ptr [rip+g3932], si
+  movsx rsi, word ptr [rip+g4378]
+  movsx rdi, byte ptr [rip+g4247]
+  add rsi, rdi
+  mov dword ptr [rip+g3933], esi
+  movsxd rsi, dword ptr [rip+g1426]
+  movsxd rdi, dword ptr [rip+g4507]
+  add rsi, rdi
+  mov qword ptr [rip+g3934], rsi
+  movsxd rsi, dword ptr [rip+g1744]
+  movsx rdi, byte ptr [rip+g4715]
+  add rsi, rdi
+  mov qword ptr [rip+g3935], rsi
+  movsx rsi, word ptr [rip+g4990]
+  movsx rdi, word ptr [rip+g3095]
+  add rsi, rdi
+  mov qword ptr [rip+g3936], rsi
+  movsxd rsi, dword ptr [rip+g554]
+  add rsi, qword ptr [rip+g3890]
+  mov qword ptr [rip+g3937], rsi
+  movsx rsi, word ptr [rip+g640]
+  movsx rdi, byte ptr [rip+g2952]
+  add rsi, rdi
+  mov word ptr [rip+g3938], si
+  mov rsi, qword ptr [rip+g328]
+  movsx rdi, word ptr [rip+g537]
+  add rsi, rdi
+  mov dword ptr [rip+g3939], esi
+  movsxd rsi, dword ptr [rip+g3930]
+  mov rax, rsi
+.L.return.u393:
+  ret
+.text
+.p2align 4
+.global u394
+u394:
+  movsxd rsi, dword ptr [rip+g713]
+  movsx rdi, byte ptr [rip+g335]
+  add rsi, rdi
+  mov word ptr [rip+g3940], si
+  mov rsi, qword ptr [rip+g3711]
+  movsx rdi, word ptr [rip+g4589]
+  add rsi, rdi
+  mov qword ptr [rip+g3941], rsi
+  movsxd rsi, dword ptr [rip+g3174]
+  add rsi, qword ptr [rip+g2722]
+  mov word ptr [rip+g3942], si
+  movsxd rsi, dword ptr [rip+g4772]
+  add rsi, qword ptr [rip+g643]
+  mov qword ptr [rip+g3943], rsi
+  movsx rsi, word ptr [rip+g4119]
+  movsx rdi, byte ptr [rip+g628]
+  add rsi, rdi
+  mov dword ptr [rip+g3944], esi
+  mov rsi, qword ptr [rip+g4486]
+  movsxd rdi, dword ptr [rip+g4215]
+  add rsi, rdi
+  mov qword ptr [rip+g3945], rsi
+  movsxd rsi, dword ptr [rip+g3809]
+  movsx rdi, byte ptr [rip+g4017]
+  add rsi, rdi
+  mov qword ptr [rip+g3946], rsi
+  mov rsi, qword ptr [rip+g2294]
+  movsx rdi, word ptr [rip+g4000]
+  add rsi, rdi
+  mov byte ptr [rip+g3947], sil
+  movsx rsi, byte ptr [rip+g3402]
+  movsx rdi, word ptr [rip+g1287]
+  add rsi, rdi
+  mov word ptr [rip+g3948], si
+  movsxd rsi, dword ptr [rip+g4911]
+  movsxd rdi, dword ptr [rip+g2028]
+  add rsi, rdi
+  mov qword ptr [rip+g3949], rsi
+  movsx rsi, word ptr [rip+g3940]
+  mov rax, rsi
+.L.return.u394:
+  ret
+.text
+.p2align 4
+.global u395
+u395:
+  movsx rsi, byte ptr [rip+g3501]
+  movsx rdi, word ptr [rip+g4644]
+  add rsi, rdi
+  mov byte ptr [rip+g3950], sil
+  movsx rsi, byte ptr [rip+g26]
+  movsxd rdi, dword ptr [rip+g1347]
+  add rsi, rdi
+  mov qword ptr [rip+g3951], rsi
+  movsx rsi, word ptr [rip+g1645]
+  movsx rdi, word ptr [rip+g171]
+  add rsi, rdi
+  mov byte ptr [rip+g3952], sil
+  movsxd rsi, dword ptr [rip+g2103]
+  movsx rdi, byte ptr [rip+g3550]
+  add rsi, rdi
+  mov word ptr [rip+g3953], si
+  movsx rsi, byte ptr [rip+g2348]
+  add rsi, qword ptr [rip+g4938]
+  mov word ptr [rip+g3954], si
+  movsx rsi, byte ptr [rip+g2098]
+  movsx rdi, byte ptr [rip+g1805]
+  add rsi, rdi
+  mov qword ptr [rip+g3955], rsi
+  movsxd rsi, dword ptr [rip+g3931]
+  add rsi, qword ptr [rip+g753]
+  mov word ptr [rip+g3956], si
+  movsxd rsi, dword ptr [rip+g2753]
+  movsx rdi, byte ptr [rip+g2034]
+  add rsi, rdi
+  mov dword ptr [rip+g3957], esi
+  mov rsi, qword ptr [rip+g3217]
+  movsx rdi, byte ptr [rip+g3146]
+  add rsi, rdi
+  mov dword ptr [rip+g3958], esi
+  movsx rsi, word ptr [rip+g188]
+  movsx rdi, byte ptr [rip+g564]
+  add rsi, rdi
+  mov qword ptr [rip+g3959], rsi
+  movsx rsi, byte ptr [rip+g3950]
+  mov rax, rsi
+.L.return.u395:
+  ret
+.text
+.p2align 4
+.global u396
+u396:
+  mov rsi, qword ptr [rip+g352]
+  movsx rdi, word ptr [rip+g308]
+  add rsi, rdi
+  mov word ptr [rip+g3960], si
+  movsxd rsi, dword ptr [rip+g957]
+  movsxd rdi, dword ptr [rip+g954]
+  add rsi, rdi
+  mov dword ptr [rip+g3961], esi
+  mov rsi, qword ptr [rip+g30]
+  movsxd rdi, dword ptr [rip+g3627]
+  add rsi, rdi
+  mov qword ptr [rip+g3962], rsi
+  movsx rsi, byte ptr [rip+g1387]
+  add rsi, qword ptr [rip+g1196]
+  mov qword ptr [rip+g3963], rsi
+  movsx rsi, word ptr [rip+g4698]
+  movsx rdi, byte ptr [rip+g3109]
+  add rsi, rdi
+  mov qword ptr [rip+g3964], rsi
+  mov rsi, qword ptr [rip+g4938]
+  movsx rdi, byte ptr [rip+g2870]
+  add rsi, rdi
+  mov qword ptr [rip+g3965], rsi
+  movsx rsi, word ptr [rip+g886]
+  movsx rdi, byte ptr [rip+g1947]
+  add rsi, rdi
+  mov byte ptr [rip+g3966], sil
+  movsxd rsi, dword ptr [rip+g2518]
+  add rsi, qword ptr [rip+g116]
+  mov byte ptr [rip+g3967], sil
+  mov rsi, qword ptr [rip+g2815]
+  movsx rdi, byte ptr [rip+g1884]
+  add rsi, rdi
+  mov byte ptr [rip+g3968], sil
+  mov rsi, qword ptr [rip+g2417]
+  add rsi, qword ptr [rip+g2941]
+  mov qword ptr [rip+g3969], rsi
+  movsx rsi, word ptr [rip+g3960]
+  mov rax, rsi
+.L.return.u396:
+  ret
+.text
+.p2align 4
+.global u397
+u397:
+  movsxd rsi, dword ptr [rip+g3699]
+  movsx rdi, word ptr [rip+g2160]
+  add rsi, rdi
+  mov byte ptr [rip+g3970], sil
+  movsx rsi, byte ptr [rip+g1496]
+  movsx rdi, byte ptr [rip+g1119]
+  add rsi, rdi
+  mov dword ptr [rip+g3971], esi
+  mov rsi, qword ptr [rip+g2739]
+  movsx rdi, byte ptr [rip+g1128]
+  add rsi, rdi
+  mov dword ptr [rip+g3972], esi
+  movsx rsi, byte ptr [rip+g176]
+  movsxd rdi, dword ptr [rip+g14]
+  add rsi, rdi
+  mov dword ptr [rip+g3973], esi
+  movsx rsi, word ptr [rip+g1985]
+  movsx rdi, word ptr [rip+g3375]
+  add rsi, rdi
+  mov qword ptr [rip+g3974], rsi
+  movsx rsi, word ptr [rip+g4637]
+  movsx rdi, word ptr [rip+g4231]
+  add rsi, rdi
+  mov dword ptr [rip+g3975], esi
+  movsx rsi, word ptr [rip+g3893]
+  movsx rdi, byte ptr [rip+g939]
+  add rsi, rdi
+  mov qword ptr [rip+g3976], rsi
+  mov rsi, qword ptr [rip+g4170]
+  movsxd rdi, dword ptr [rip+g4318]
+  add rsi, rdi
+  mov byte ptr [rip+g3977], sil
+  movsx rsi, byte ptr [rip+g1098]
+  movsxd rdi, dword ptr [rip+g908]
+  add rsi, rdi
+  mov byte ptr [rip+g3978], sil
+  movsx rsi, byte ptr [rip+g4053]
+  movsx rdi, byte ptr [rip+g1484]
+  add rsi, rdi
+  mov qword ptr [rip+g3979], rsi
+  movsx rsi, byte ptr [rip+g3970]
+  mov rax, rsi
+.L.return.u397:
+  ret
+.text
+.p2align 4
+.global u398
+u398:
+  movsx rsi, byte ptr [rip+g1064]
+  movsx rdi, word ptr [rip+g2368]
+  add rsi, rdi
+  mov qword ptr [rip+g3980], rsi
+  mov rsi, qword ptr [rip+g2941]
+  movsx rdi, byte ptr [rip+g2351]
+  add rsi, rdi
+  mov dword ptr [rip+g3981], esi
+  movsx rsi, byte ptr [rip+g477]
+  add rsi, qword ptr [rip+g2864]
+  mov word ptr [rip+g3982], si
+  movsx rsi, byte ptr [rip+g4129]
+  movsx rdi, word ptr [rip+g2565]
+  add rsi, rdi
+  mov qword ptr [rip+g3983], rsi
+  movsx rsi, word ptr [rip+g499]
+  movsx rdi, word ptr [rip+g2685]
+  add rsi, rdi
+  mov dword ptr [rip+g3984], esi
+  mov rsi, qword ptr [rip+g1081]
+  movsx rdi, byte ptr [rip+g3453]
+  add rsi, rdi
+  mov byte ptr [rip+g3985], sil
+  movsxd rsi, dword ptr [rip+g3747]
+  movsxd rdi, dword ptr [rip+g2782]
+  add rsi, rdi
+  mov byte ptr [rip+g3986], sil
+  movsxd rsi, dword ptr [rip+g7]
+  movsxd rdi, dword ptr [rip+g35]
+  add rsi, rdi
+  mov word ptr [rip+g3987], si
+  movsx rsi, word ptr [rip+g3228]
+  add rsi, qword ptr [rip+g1169]
+  mov word ptr [rip+g3988], si
+  mov rsi, qword ptr [rip+g4297]
+  movsx rdi, word ptr [rip+g1959]
+  add rsi, rdi
+  mov word ptr [rip+g3989], si
+  mov rax, qword ptr [rip+g3980]
+.L.return.u398:
+  ret
+.text
+.p2align 4
+.global u399
+u399:
+  mov rsi, qword ptr [rip+g345]
+  movsx rdi, byte ptr [rip+g1856]
+  add rsi, rdi
+  mov byte ptr [rip+g3990], sil
+  movsx rsi, word ptr [rip+g3827]
+  movsxd rdi, dword ptr [rip+g2765]
+  add rsi, rdi
+  mov word ptr [rip+g3991], si
+  movsxd rsi, dword ptr [rip+g1551]
+  add rsi, qword ptr [rip+g3464]
+  mov dword ptr [rip+g3992], esi
+  movsxd rsi, dword ptr [rip+g3529]
+  movsx rdi, word ptr [rip+g1153]
+  add rsi, rdi
+  mov dword ptr [rip+g3993], esi
+  movsx rsi, word ptr [rip+g3170]
+  movsx rdi, word ptr [rip+g174]
+  add rsi, rdi
+  mov dword ptr [rip+g3994], esi
+  movsx rsi, word ptr [rip+g4714]
+  add rsi, qword ptr [rip+g66]
+  mov qword ptr [rip+g3995], rsi
+  movsxd rsi, dword ptr [rip+g3508]
+  add rsi, qword ptr [rip+g3586]
+  mov dword ptr [rip+g3996], esi
+  movsxd rsi, dword ptr [rip+g4038]
+  movsxd rdi, dword ptr [rip+g484]
+  add rsi, rdi
+  mov qword ptr [rip+g3997], rsi
+  mov rsi, qword ptr [rip+g346]
+  add rsi, qword ptr [rip+g3401]
+  mov dword ptr [rip+g3998], esi
+  movsxd rsi, dword ptr [rip+g638]
+  movsx rdi, word ptr [rip+g2684]
+  add rsi, rdi
+  mov qword ptr [rip+g3999], rsi
+  movsx rsi, byte ptr [rip+g3990]
+  mov rax, rsi
+.L.return.u399:
+  ret
+.text
+.p2align 4
+.global u400
+u400:
+  movsx rsi, word ptr [rip+g995]
+  movsx rdi, word ptr [rip+g195]
+  add rsi, rdi
+  mov word ptr [rip+g4000], si
+  movsxd rsi, dword ptr [rip+g850]
+  movsxd rdi, dword ptr [rip+g2836]
+  add rsi, rdi
+  mov byte ptr [rip+g4001], sil
+  mov rsi, qword ptr [rip+g4288]
+  movsx rdi, word ptr [rip+g933]
+  add rsi, rdi
+  mov dword ptr [rip+g4002], esi
+  mov rsi, qword ptr [rip+g678]
+  movsx rdi, word ptr [rip+g4150]
+  add rsi, rdi
+  mov qword ptr [rip+g4003], rsi
+  movsx rsi, word ptr [rip+g4043]
+  movsx rdi, word ptr [rip+g3316]
+  add rsi, rdi
+  mov word ptr [rip+g4004], si
+  movsx rsi, word ptr [rip+g4760]
+  movsxd rdi, dword ptr [rip+g1431]
+  add rsi, rdi
+  mov byte ptr [rip+g4005], sil
+  movsxd rsi, dword ptr [rip+g1515]
+  movsxd rdi, dword ptr [rip+g1373]
+  add rsi, rdi
+  mov dword ptr [rip+g4006], esi
+  mov rsi, qword ptr [rip+g3436]
+  movsxd rdi, dword ptr [rip+g4460]
+  add rsi, rdi
+  mov qword ptr [rip+g4007], rsi
+  movsx rsi, byte ptr [rip+g632]
+  movsxd rdi, dword ptr [rip+g4218]
+  add rsi, rdi
+  mov dword ptr [rip+g4008], esi
+  movsx rsi, word ptr [rip+g1402]
+  add rsi, qword ptr [rip+g78]
+  mov qword ptr [rip+g4009], rsi
+  movsx rsi, word ptr [rip+g4000]
+  mov rax, rsi
+.L.return.u400:
+  ret
+.text
+.p2align 4
+.global u401
+u401:
+  mov rsi, qword ptr [rip+g3949]
+  add rsi, qword ptr [rip+g1416]
+  mov dword ptr [rip+g4010], esi
+  movsx rsi, byte ptr [rip+g3504]
+  movsxd rdi, dword ptr [rip+g791]
+  add rsi, rdi
+  mov word ptr [rip+g4011], si
+  movsxd rsi, dword ptr [rip+g1688]
+  movsx rdi, byte ptr [rip+g307]
+  add rsi, rdi
+  mov word ptr [rip+g4012], si
+  movsxd rsi, dword ptr [rip+g596]
+  movsxd rdi, dword ptr [rip+g230]
+  add rsi, rdi
+  mov byte ptr [rip+g4013], sil
+  movsx rsi, byte ptr [rip+g4017]
+  movsx rdi, word ptr [rip+g3616]
+  add rsi, rdi
+  mov word ptr [rip+g4014], si
+  mov rsi, qword ptr [rip+g3531]
+  add rsi, qword ptr [rip+g2001]
+  mov word ptr [rip+g4015], si
+  movsxd rsi, dword ptr [rip+g394]
+  movsx rdi, word ptr [rip+g4774]
+  add rsi, rdi
+  mov dword ptr [rip+g4016], esi
+  movsxd rsi, dword ptr [rip+g4916]
+  add rsi, qword ptr [rip+g343]
+  mov byte ptr [rip+g4017], sil
+  movsxd rsi, dword ptr [rip+g3573]
+  movsx rdi, word ptr [rip+g4643]
+  add rsi, rdi
+  mov word ptr [rip+g4018], si
+  movsx rsi, byte ptr [rip+g560]
+  movsx rdi, byte ptr [rip+g1594]
+  add rsi, rdi
+  mov word ptr [rip+g4019], si
+  movsxd rsi, dword ptr [rip+g4010]
+  mov rax, rsi
+.L.return.u401:
+  ret
+.text
+.p2align 4
+.global u402
+u402:
+  mov rsi, qword ptr [rip+g4651]
+  movsx rdi, word ptr [rip+g2066]
+  add rsi, rdi
+  mov dword ptr [rip+g4020], esi
+  movsx rsi, word ptr [rip+g3611]
+  add rsi, qword ptr [rip+g4719]
+  mov word ptr [rip+g4021], si
+  movsx rsi, word ptr [rip+g2561]
+  movsxd rdi, dword ptr [rip+g136]
+  add rsi, rdi
+  mov byte ptr [rip+g4022], sil
+  movsxd rsi, dword ptr [rip+g1751]
+  add rsi, qword ptr [rip+g1743]
+  mov byte ptr [rip+g4023], sil
+  movsxd rsi, dword ptr [rip+g363]
+  movsxd rdi, dword ptr [rip+g2557]
+  add rsi, rdi
+  mov dword ptr [rip+g4024], esi
+  movsxd rsi, dword ptr [rip+g395]
+  movsx rdi, byte ptr [rip+g3002]
+  add rsi, rdi
+  mov word ptr [rip+g4025], si
+  movsx rsi, byte ptr [rip+g2985]
+  movsx rdi, word ptr [rip+g1440]
+  add rsi, rdi
+  mov qword ptr [rip+g4026], rsi
+  movsxd rsi, dword ptr [rip+g193]
+  movsx rdi, byte ptr [rip+g1947]
+  add rsi, rdi
+  mov qword ptr [rip+g4027], rsi
+  movsxd rsi, dword ptr [rip+g50]
+  movsxd rdi, dword ptr [rip+g4585]
+  add rsi, rdi
+  mov word ptr [rip+g4028], si
+  movsxd rsi, dword ptr [rip+g1359]
+  add rsi, qword ptr [rip+g4431]
+  mov dword ptr [rip+g4029], esi
+  movsxd rsi, dword ptr [rip+g4020]
+  mov rax, rsi
+.L.return.u402:
+  ret
+.text
+.p2align 4
+.global u403
+u403:
+  mov rsi, qword ptr [rip+g2245]
+  add rsi, qword ptr [rip+g4775]
+  mov word ptr [rip+g4030], si
+  mov rsi, qword ptr [rip+g2046]
+  add rsi, qword ptr [rip+g1844]
+  mov byte ptr [rip+g4031], sil
+  movsx rsi, word ptr [rip+g4667]
+  movsx rdi, word ptr [rip+g3223]
+  add rsi, rdi
+  mov qword ptr [rip+g4032], rsi
+  mov rsi, qword ptr [rip+g435]
+  add rsi, qword ptr [rip+g4200]
+  mov qword ptr [rip+g4033], rsi
+  movsxd rsi, dword ptr [rip+g3325]
+  movsx rdi, word ptr [rip+g1189]
+  add rsi, rdi
+  mov byte ptr [rip+g4034], sil
+  movsx rsi, word ptr [rip+g4823]
+  movsx rdi, word ptr [rip+g1036]
+  add rsi, rdi
+  mov word ptr [rip+g4035], si
+  movsx rsi, byte ptr [rip+g1635]
+  add rsi, qword ptr [rip+g1743]
+  mov dword ptr [rip+g4036], esi
+  mov rsi, qword ptr [rip+g2881]
+  movsx rdi, word ptr [rip+g3533]
+  add rsi, rdi
+  mov byte ptr [rip+g4037], sil
+  movsxd rsi, dword ptr [rip+g4630]
+  movsxd rdi, dword ptr [rip+g2419]
+  add rsi, rdi
+  mov dword ptr [rip+g4038], esi
+  mov rsi, qword ptr [rip+g701]
+  add rsi, qword ptr [rip+g3689]
+  mov word ptr [rip+g4039], si
+  movsx rsi, word ptr [rip+g4030]
+  mov rax, rsi
+.L.return.u403:
+  ret
+.text
+.p2align 4
+.global u404
+u404:
+  mov rsi, qword ptr [rip+g1550]
+  add rsi, qword ptr [rip+g3021]
+  mov byte ptr [rip+g4040], sil
+  movsxd rsi, dword ptr [rip+g460]
+  movsx rdi, word ptr [rip+g3438]
+  add rsi, rdi
+  mov word ptr [rip+g4041], si
+  movsx rsi, word ptr [rip+g4512]
+  movsx rdi, word ptr [rip+g2024]
+  add rsi, rdi
+  mov qword ptr [rip+g4042], rsi
+  mov rsi, qword ptr [rip+g3482]
+  movsx rdi, byte ptr [rip+g2366]
+  add rsi, rdi
+  mov word ptr [rip+g4043], si
+  movsx rsi, byte ptr [rip+g2042]
+  movsxd rdi, dword ptr [rip+g1035]
+  add rsi, rdi
+  mov byte ptr [rip+g4044], sil
+  movsx rsi, word ptr [rip+g731]
+  movsx rdi, word ptr [rip+g3940]
+  add rsi, rdi
+  mov dword ptr [rip+g4045], esi
+  mov rsi, qword ptr [rip+g959]
+  movsx rdi, word ptr [rip+g3170]
+  add rsi, rdi
+  mov word ptr [rip+g4046], si
+  mov rsi, qword ptr [rip+g3250]
+  movsx rdi, byte ptr [rip+g3731]
+  add rsi, rdi
+  mov dword ptr [rip+g4047], esi
+  movsx rsi, word ptr [rip+g3858]
+  movsx rdi, byte ptr [rip+g564]
+  add rsi, rdi
+  mov byte ptr [rip+g4048], sil
+  mov rsi, qword ptr [rip+g1776]
+  movsx rdi, word ptr [rip+g3792]
+  add rsi, rdi
+  mov dword ptr [rip+g4049], esi
+  movsx rsi, byte ptr [rip+g4040]
+  mov rax, rsi
+.L.return.u404:
+  ret
+.text
+.p2align 4
+.global u405
+u405:
+  mov rsi, qword ptr [rip+g4299]
+  movsx rdi, word ptr [rip+g4795]
+  add rsi, rdi
+  mov word ptr [rip+g4050], si
+  movsx rsi, word ptr [rip+g4849]
+  movsx rdi, word ptr [rip+g1863]
+  add rsi, rdi
+  mov byte ptr [rip+g4051], sil
+  movsxd rsi, dword ptr [rip+g1473]
+  add rsi, qword ptr [rip+g4052]
+  mov qword ptr [rip+g4052], rsi
+  movsxd rsi, dword ptr [rip+g4505]
+  movsx rdi, byte ptr [rip+g1080]
+  add rsi, rdi
+  mov byte ptr [rip+g4053], sil
+  mov rsi, qword ptr [rip+g702]
+  movsx rdi, byte ptr [rip+g605]
+  add rsi, rdi
+  mov qword ptr [rip+g4054], rsi
+  movsxd rsi, dword ptr [rip+g4077]
+  movsx rdi, byte ptr [rip+g3923]
+  add rsi, rdi
+  mov dword ptr [rip+g4055], esi
+  mov rsi, qword ptr [rip+g3121]
+  add rsi, qword ptr [rip+g2852]
+  mov qword ptr [rip+g4056], rsi
+  movsxd rsi, dword ptr [rip+g3345]
+  add rsi, qword ptr [rip+g804]
+  mov byte ptr [rip+g4057], sil
+  movsx rsi, word ptr [rip+g542]
+  movsx rdi, byte ptr [rip+g1787]
+  add rsi, rdi
+  mov dword ptr [rip+g4058], esi
+  movsxd rsi, dword ptr [rip+g4180]
+  movsx rdi, byte ptr [rip+g2701]
+  add rsi, rdi
+  mov dword ptr [rip+g4059], esi
+  movsx rsi, word ptr [rip+g4050]
+  mov rax, rsi
+.L.return.u405:
+  ret
+.text
+.p2align 4
+.global u406
+u406:
+  movsx rsi, byte ptr [rip+g3472]
+  movsx rdi, byte ptr [rip+g3176]
+  add rsi, rdi
+  mov byte ptr [rip+g4060], sil
+  mov rsi, qword ptr [rip+g4429]
+  add rsi, qword ptr [rip+g2798]
+  mov qword ptr [rip+g4061], rsi
+  movsx rsi, byte ptr [rip+g1027]
+  add rsi, qword ptr [rip+g1467]
+  mov word ptr [rip+g4062], si
+  movsx rsi, word ptr [rip+g2474]
+  movsx rdi, byte ptr [rip+g55]
+  add rsi, rdi
+  mov dword ptr [rip+g4063], esi
+  movsx rsi, word ptr [rip+g1811]
+  movsx rdi, word ptr [rip+g1352]
+  add rsi, rdi
+  mov dword ptr [rip+g4064], esi
+  movsxd rsi, dword ptr [rip+g825]
+  add rsi, qword ptr [rip+g901]
+  mov qword ptr [rip+g4065], rsi
+  movsx rsi, byte ptr [rip+g2205]
+  add rsi, qword ptr [rip+g2731]
+  mov dword ptr [rip+g4066], esi
+  movsx rsi, word ptr [rip+g85]
+  add rsi, qword ptr [rip+g4093]
+  mov byte ptr [rip+g4067], sil
+  movsx rsi, byte ptr [rip+g2234]
+  movsx rdi, byte ptr [rip+g2030]
+  add rsi, rdi
+  mov dword ptr [rip+g4068], esi
+  movsx rsi, word ptr [rip+g367]
+  movsx rdi, word ptr [rip+g2965]
+  add rsi, rdi
+  mov word ptr [rip+g4069], si
+  movsx rsi, byte ptr [rip+g4060]
+  mov rax, rsi
+.L.return.u406:
+  ret
+.text
+.p2align 4
+.global u407
+u407:
+  mov rsi, qword ptr [rip+g1417]
+  add rsi, qword ptr [rip+g2362]
+  mov qword ptr [rip+g4070], rsi
+  movsx rsi, word ptr [rip+g1220]
+  movsx rdi, word ptr [rip+g519]
+  add rsi, rdi
+  mov dword ptr [rip+g4071], esi
+  movsxd rsi, dword ptr [rip+g347]
+  movsxd rdi, dword ptr [rip+g347]
+  add rsi, rdi
+  mov qword ptr [rip+g4072], rsi
+  mov rsi, qword ptr [rip+g3715]
+  movsx rdi, byte ptr [rip+g2912]
+  add rsi, rdi
+  mov qword ptr [rip+g4073], rsi
+  movsx rsi, word ptr [rip+g244]
+  movsxd rdi, dword ptr [rip+g4508]
+  add rsi, rdi
+  mov qword ptr [rip+g4074], rsi
+  mov rsi, qword ptr [rip+g4480]
+  movsx rdi, byte ptr [rip+g500]
+  add rsi, rdi
+  mov byte ptr [rip+g4075], sil
+  movsx rsi, word ptr [rip+g292]
+  movsx rdi, byte ptr [rip+g3560]
+  add rsi, rdi
+  mov qword ptr [rip+g4076], rsi
+  movsxd rsi, dword ptr [rip+g855]
+  movsx rdi, word ptr [rip+g2013]
+  add rsi, rdi
+  mov dword ptr [rip+g4077], esi
+  movsx rsi, byte ptr [rip+g1355]
+  add rsi, qword ptr [rip+g4671]
+  mov byte ptr [rip+g4078], sil
+  movsxd rsi, dword ptr [rip+g763]
+  movsx rdi, word ptr [rip+g1253]
+  add rsi, rdi
+  mov word ptr [rip+g4079], si
+  mov rax, qword ptr [rip+g4070]
+.L.return.u407:
+  ret
+.text
+.p2align 4
+.global u408
+u408:
+  mov rsi, qword ptr [rip+g945]
+  movsx rdi, byte ptr [rip+g3163]
+  add rsi, rdi
+  mov word ptr [rip+g4080], si
+  movsxd rsi, dword ptr [rip+g2097]
+  movsx rdi, byte ptr [rip+g475]
+  add rsi, rdi
+  mov byte ptr [rip+g4081], sil
+  movsxd rsi, dword ptr [rip+g3167]
+  movsx rdi, byte ptr [rip+g3142]
+  add rsi, rdi
+  mov word ptr [rip+g4082], si
+  movsx rsi, byte ptr [rip+g1144]
+  movsx rdi, word ptr [rip+g3542]
+  add rsi, rdi
+  mov qword ptr [rip+g4083], rsi
+  mov rsi, qword ptr [rip+g1003]
+  movsxd rdi, dword ptr [rip+g3200]
+  add rsi, rdi
+  mov byte ptr [rip+g4084], sil
+  movsx rsi, byte ptr [rip+g1555]
+  movsx rdi, byte ptr [rip+g3950]
+  add rsi, rdi
+  mov dword ptr [rip+g4085], esi
+  mov rsi, qword ptr [rip+g2074]
+  add rsi, qword ptr [rip+g411]
+  mov word ptr [rip+g4086], si
+  movsxd rsi, dword ptr [rip+g2769]
+  movsxd rdi, dword ptr [rip+g434]
+  add rsi, rdi
+  mov qword ptr [rip+g4087], rsi
+  movsxd rsi, dword ptr [rip+g102]
+  add rsi, qword ptr [rip+g767]
+  mov byte ptr [rip+g4088], sil
+  mov rsi, qword ptr [rip+g3401]
+  movsx rdi, word ptr [rip+g4667]
+  add rsi, rdi
+  mov qword ptr [rip+g4089], rsi
+  movsx rsi, word ptr [rip+g4080]
+  mov rax, rsi
+.L.return.u408:
+  ret
+.text
+.p2align 4
+.global u409
+u409:
+  movsx rsi, word ptr [rip+g1318]
+  movsxd rdi, dword ptr [rip+g3104]
+  add rsi, rdi
+  mov byte ptr [rip+g4090], sil
+  mov rsi, qword ptr [rip+g1619]
+  movsx rdi, word ptr [rip+g2974]
+  add rsi, rdi
+  mov word ptr [rip+g4091], si
+  movsx rsi, word ptr [rip+g2131]
+  movsx rdi, word ptr [rip+g958]
+  add rsi, rdi
+  mov word ptr [rip+g4092], si
+  mov rsi, qword ptr [rip+g2633]
+  movsx rdi, word ptr [rip+g860]
+  add rsi, rdi
+  mov qword ptr [rip+g4093], rsi
+  mov rsi, qword ptr [rip+g2591]
+  movsx rdi, word ptr [rip+g4417]
+  add rsi, rdi
+  mov byte ptr [rip+g4094], sil
+  movsx rsi, word ptr [rip+g3259]
+  add rsi, qword ptr [rip+g2354]
+  mov word ptr [rip+g4095], si
+  movsx rsi, word ptr [rip+g2079]
+  movsx rdi, byte ptr [rip+g1733]
+  add rsi, rdi
+  mov byte ptr [rip+g4096], sil
+  movsxd rsi, dword ptr [rip+g3637]
+  movsx rdi, byte ptr [rip+g338]
+  add rsi, rdi
+  mov qword ptr [rip+g4097], rsi
+  movsx rsi, word ptr [rip+g3631]
+  movsx rdi, word ptr [rip+g157]
+  add rsi, rdi
+  mov dword ptr [rip+g4098], esi
+  movsx rsi, byte ptr [rip+g3306]
+  movsx rdi, word ptr [rip+g1867]
+  add rsi, rdi
+  mov qword ptr [rip+g4099], rsi
+  movsx rsi, byte ptr [rip+g4090]
+  mov rax, rsi
+.L.return.u409:
+  ret
+.text
+.p2align 4
+.global u410
+u410:
+  movsx rsi, byte ptr [rip+g2930]
+  movsx rdi, byte ptr [rip+g887]
+  add rsi, rdi
+  mov dword ptr [rip+g4100], esi
+  movsx rsi, word ptr [rip+g2858]
+  add rsi, qword ptr [rip+g684]
+  mov qword ptr [rip+g4101], rsi
+  movsx rsi, word ptr [rip+g3633]
+  add rsi, qword ptr [rip+g701]
+  mov word ptr [rip+g4102], si
+  movsx rsi, byte ptr [rip+g2526]
+  movsx rdi, byte ptr [rip+g1930]
+  add rsi, rdi
+  mov word ptr [rip+g4103], si
+  movsx rsi, byte ptr [rip+g2098]
+  add rsi, qword ptr [rip+g4719]
+  mov byte ptr [rip+g4104], sil
+  movsxd rsi, dword ptr [rip+g1001]
+  movsx rdi, byte ptr [rip+g2291]
+  add rsi, rdi
+  mov dword ptr [rip+g4105], esi
+  mov rsi, qword ptr [rip+g1786]
+  movsxd rdi, dword ptr [rip+g3712]
+  add rsi, rdi
+  mov dword ptr [rip+g4106], esi
+  movsxd rsi, dword ptr [rip+g341]
+  add rsi, qword ptr [rip+g2761]
+  mov qword ptr [rip+g4107], rsi
+  mov rsi, qword ptr [rip+g2294]
+  movsx rdi, word ptr [rip+g1339]
+  add rsi, rdi
+  mov byte ptr [rip+g4108], sil
+  movsxd rsi, dword ptr [rip+g3554]
+  movsx rdi, byte ptr [rip+g1406]
+  add rsi, rdi
+  mov byte ptr [rip+g4109], sil
+  movsxd rsi, dword ptr [rip+g4100]
+  mov rax, rsi
+.L.return.u410:
+  ret
+.text
+.p2align 4
+.global u411
+u411:
+  movsx rsi, word ptr [rip+g878]
+  add rsi, qword ptr [rip+g676]
+  mov byte ptr [rip+g4110], sil
+  movsx rsi, word ptr [rip+g2684]
+  movsxd rdi, dword ptr [rip+g241]
+  add rsi, rdi
+  mov byte ptr [rip+g4111], sil
+  mov rsi, qword ptr [rip+g2400]
+  movsxd rdi, dword ptr [rip+g4303]
+  add rsi, rdi
+  mov dword ptr [rip+g4112], esi
+  mov rsi, qword ptr [rip+g4752]
+  movsx rdi, word ptr [rip+g463]
+  add rsi, rdi
+  mov qword ptr [rip+g4113], rsi
+  movsxd rsi, dword ptr [rip+g452]
+  movsx rdi, word ptr [rip+g3896]
+  add rsi, rdi
+  mov byte ptr [rip+g4114], sil
+  movsx rsi, word ptr [rip+g76]
+  movsxd rdi, dword ptr [rip+g2511]
+  add rsi, rdi
+  mov word ptr [rip+g4115], si
+  movsx rsi, word ptr [rip+g3080]
+  movsx rdi, byte ptr [rip+g1246]
+  add rsi, rdi
+  mov qword ptr [rip+g4116], rsi
+  movsxd rsi, dword ptr [rip+g2005]
+  movsx rdi, byte ptr [rip+g223]
+  add rsi, rdi
+  mov qword ptr [rip+g4117], rsi
+  movsx rsi, word ptr [rip+g2652]
+  movsx rdi, word ptr [rip+g3735]
+  add rsi, rdi
+  mov qword ptr [rip+g4118], rsi
+  movsx rsi, byte ptr [rip+g220]
+  add rsi, qword ptr [rip+g1528]
+  mov word ptr [rip+g4119], si
+  movsx rsi, byte ptr [rip+g4110]
+  mov rax, rsi
+.L.return.u411:
+  ret
+.text
+.p2align 4
+.global u412
+u412:
+  movsx rsi, byte ptr [rip+g4195]
+  movsx rdi, word ptr [rip+g1847]
+  add rsi, rdi
+  mov word ptr [rip+g4120], si
+  mov rsi, qword ptr [rip+g4745]
+  movsxd rdi, dword ptr [rip+g4961]
+  add rsi, rdi
+  mov byte ptr [rip+g4121], sil
+  movsx rsi, byte ptr [rip+g2680]
+  add rsi, qword ptr [rip+g3413]
+  mov qword ptr [rip+g4122], rsi
+  movsx rsi, byte ptr [rip+g4305]
+  movsxd rdi, dword ptr [rip+g859]
+  add rsi, rdi
+  mov word ptr [rip+g4123], si
+  movsx rsi, word ptr [rip+g183]
+  movsx rdi, byte ptr [rip+g1656]
+  add rsi, rdi
+  mov byte ptr [rip+g4124], sil
+  movsx rsi, byte ptr [rip+g285]
+  movsx rdi, byte ptr [rip+g3182]
+  add rsi, rdi
+  mov word ptr [rip+g4125], si
+  movsx rsi, word ptr [rip+g4120]
+  movsx rdi, byte ptr [rip+g4195]
+  add rsi, rdi
+  mov dword ptr [rip+g4126], esi
+  movsx rsi, word ptr [rip+g547]
+  movsxd rdi, dword ptr [rip+g3294]
+  add rsi, rdi
+  mov byte ptr [rip+g4127], sil
+  movsx rsi, word ptr [rip+g249]
+  movsx rdi, word ptr [rip+g3303]
+  add rsi, rdi
+  mov byte ptr [rip+g4128], sil
+  movsxd rsi, dword ptr [rip+g2469]
+  movsx rdi, word ptr [rip+g413]
+  add rsi, rdi
+  mov byte ptr [rip+g4129], sil
+  movsx rsi, word ptr [rip+g4120]
+  mov rax, rsi
+.L.return.u412:
+  ret
+.text
+.p2align 4
+.global u413
+u413:
+  movsxd rsi, dword ptr [rip+g3554]
+  movsxd rdi, dword ptr [rip+g1403]
+  add rsi, rdi
+  mov dword ptr [rip+g4130], esi
+  mov rsi, qword ptr [rip+g2396]
+  movsxd rdi, dword ptr [rip+g4534]
+  add rsi, rdi
+  mov word ptr [rip+g4131], si
+  movsx rsi, word ptr [rip+g2257]
+  movsx rdi, word ptr [rip+g239]
+  add rsi, rdi
+  mov dword ptr [rip+g4132], esi
+  movsxd rsi, dword ptr [rip+g1785]
+  add rsi, qword ptr [rip+g1687]
+  mov byte ptr [rip+g4133], sil
+  movsxd rsi, dword ptr [rip+g728]
+  add rsi, qword ptr [rip+g1455]
+  mov dword ptr [rip+g4134], esi
+  mov rsi, qword ptr [rip+g2210]
+  movsx rdi, byte ptr [rip+g4517]
+  add rsi, rdi
+  mov qword ptr [rip+g4135], rsi
+  movsx rsi, word ptr [rip+g2313]
+  add rsi, qword ptr [rip+g3287]
+  mov word ptr [rip+g4136], si
+  movsx rsi, byte ptr [rip+g3240]
+  add rsi, qword ptr [rip+g3784]
+  mov byte ptr [rip+g4137], sil
+  mov rsi, qword ptr [rip+g2957]
+  movsx rdi, byte ptr [rip+g3488]
+  add rsi, rdi
+  mov qword ptr [rip+g4138], rsi
+  movsxd rsi, dword ptr [rip+g1235]
+  movsx rdi, word ptr [rip+g292]
+  add rsi, rdi
+  mov dword ptr [rip+g4139], esi
+  movsxd rsi, dword ptr [rip+g4130]
+  mov rax, rsi
+.L.return.u413:
+  ret
+.text
+.p2align 4
+.global u414
+u414:
+  movsx rsi, byte ptr [rip+g1330]
+  movsx rdi, word ptr [rip+g1345]
+  add rsi, rdi
+  mov word ptr [rip+g4140], si
+  movsxd rsi, dword ptr [rip+g1953]
+  add rsi, qword ptr [rip+g2618]
+  mov qword ptr [rip+g4141], rsi
+  movsxd rsi, dword ptr [rip+g1574]
+  add rsi, qword ptr [rip+g551]
+  mov word ptr [rip+g4142], si
+  movsxd rsi, dword ptr [rip+g4433]
+  movsx rdi, byte ptr [rip+g1180]
+  add rsi, rdi
+  mov byte ptr [rip+g4143], sil
+  mov rsi, qword ptr [rip+g2500]
+  add rsi, qword ptr [rip+g4457]
+  mov dword ptr [rip+g4144], esi
+  mov rsi, qword ptr [rip+g4437]
+  movsx rdi, word ptr [rip+g2166]
+  add rsi, rdi
+  mov dword ptr [rip+g4145], esi
+  movsxd rsi, dword ptr [rip+g3821]
+  movsxd rdi, dword ptr [rip+g2682]
+  add rsi, rdi
+  mov byte ptr [rip+g4146], sil
+  movsx rsi, byte ptr [rip+g146]
+  movsx rdi, byte ptr [rip+g1098]
+  add rsi, rdi
+  mov dword ptr [rip+g4147], esi
+  mov rsi, qword ptr [rip+g932]
+  movsxd rdi, dword ptr [rip+g4148]
+  add rsi, rdi
+  mov dword ptr [rip+g4148], esi
+  movsx rsi, word ptr [rip+g1702]
+  movsx rdi, word ptr [rip+g943]
+  add rsi, rdi
+  mov dword ptr [rip+g4149], esi
+  movsx rsi, word ptr [rip+g4140]
+  mov rax, rsi
+.L.return.u414:
+  ret
+.text
+.p2align 4
+.global u415
+u415:
+  movsx rsi, byte ptr [rip+g1754]
+  add rsi, qword ptr [rip+g1118]
+  mov word ptr [rip+g4150], si
+  movsxd rsi, dword ptr [rip+g1264]
+  movsx rdi, byte ptr [rip+g1229]
+  add rsi, rdi
+  mov word ptr [rip+g4151], si
+  mov rsi, qword ptr [rip+g4542]
+  add rsi, qword ptr [rip+g3937]
+  mov word ptr [rip+g4152], si
+  mov rsi, qword ptr [rip+g3704]
+  movsxd rdi, dword ptr [rip+g3776]
+  add rsi, rdi
+  mov byte ptr [rip+g4153], sil
+  movsx rsi, word ptr [rip+g4660]
+  add rsi, qword ptr [rip+g750]
+  mov qword ptr [rip+g4154], rsi
+  movsxd rsi, dword ptr [rip+g2130]
+  add rsi, qword ptr [rip+g4500]
+  mov dword ptr [rip+g4155], esi
+  movsxd rsi, dword ptr [rip+g3904]
+  movsx rdi, word ptr [rip+g4859]
+  add rsi, rdi
+  mov word ptr [rip+g4156], si
+  movsx rsi, word ptr [rip+g3004]
+  movsxd rdi, dword ptr [rip+g1574]
+  add rsi, rdi
+  mov dword ptr [rip+g4157], esi
+  movsxd rsi, dword ptr [rip+g3005]
+  movsx rdi, byte ptr [rip+g2254]
+  add rsi, rdi
+  mov dword ptr [rip+g4158], esi
+  movsxd rsi, dword ptr [rip+g1688]
+  movsx rdi, word ptr [rip+g1659]
+  add rsi, rdi
+  mov dword ptr [rip+g4159], esi
+  movsx rsi, word ptr [rip+g4150]
+  mov rax, rsi
+.L.return.u415:
+  ret
+.text
+.p2align 4
+.global u416
+u416:
+  movsxd rsi, dword ptr [rip+g2068]
+  add rsi, qword ptr [rip+g3739]
+  mov byte ptr [rip+g4160], sil
+  movsx rsi, byte ptr [rip+g2530]
+  add rsi, qword ptr [rip+g2389]
+  mov byte ptr [rip+g4161], sil
+  mov rsi, qword ptr [rip+g1546]
+  movsx rdi, byte ptr [rip+g4317]
+  add rsi, rdi
+  mov byte ptr [rip+g4162], sil
+  movsx rsi, byte ptr [rip+g1157]
+  movsx rdi, byte ptr [rip+g117]
+  add rsi, rdi
+  mov word ptr [rip+g4163], si
+  mov rsi, qword ptr [rip+g504]
+  movsxd rdi, dword ptr [rip+g596]
+  add rsi, rdi
+  mov word ptr [rip+g4164], si
+  movsxd rsi, dword ptr [rip+g751]
+  movsx rdi, byte ptr [rip+g1756]
+  add rsi, rdi
+  mov dword ptr [rip+g4165], esi
+  movsxd rsi, dword ptr [rip+g4575]
+  movsx rdi, word ptr [rip+g2668]
+  add rsi, rdi
+  mov dword ptr [rip+g4166], esi
+  movsx rsi, word ptr [rip+g242]
+  movsx rdi, word ptr [rip+g2810]
+  add rsi, rdi
+  mov byte ptr [rip+g4167], sil
+  movsx rsi, byte ptr [rip+g4625]
+  movsx rdi, byte ptr [rip+g3083]
+  add rsi, rdi
+  mov dword ptr [rip+g4168], esi
+  mov rsi, qword ptr [rip+g2308]
+  movsxd rdi, dword ptr [rip+g3214]
+  add rsi, rdi
+  mov byte ptr [rip+g4169], sil
+  movsx rsi, byte ptr [rip+g4160]
+  mov rax, rsi
+.L.return.u416:
+  ret
+.text
+.p2align 4
+.global u417
+u417:
+  mov rsi, qword ptr [rip+g1507]
+  add rsi, qword ptr [rip+g794]
+  mov qword ptr [rip+g4170], rsi
+  movsx rsi, byte ptr [rip+g4088]
+  add rsi, qword ptr [rip+g1619]
+  mov qword ptr [rip+g4171], rsi
+  movsx rsi, byte ptr [rip+g2345]
+  add rsi, qword ptr [rip+g945]
+  mov qword ptr [rip+g4172], rsi
+  movsx rsi, byte ptr [rip+g119]
+  movsx rdi, word ptr [rip+g2917]
+  add rsi, rdi
+  mov dword ptr [rip+g4173], esi
+  movsx rsi, byte ptr [rip+g2225]
+  movsxd rdi, dword ptr [rip+g2808]
+  add rsi, rdi
+  mov dword ptr [rip+g4174], esi
+  movsx rsi, byte ptr [rip+g2118]
+  movsxd rdi, dword ptr [rip+g2437]
+  add rsi, rdi
+  mov word ptr [rip+g4175], si
+  movsx rsi, byte ptr [rip+g4771]
+  movsxd rdi, dword ptr [rip+g4165]
+  add rsi, rdi
+  mov word ptr [rip+g4176], si
+  movsx rsi, word ptr [rip+g4192]
+  movsx rdi, word ptr [rip+g3430]
+  add rsi, rdi
+  mov qword ptr [rip+g4177], rsi
+  movsx rsi, byte ptr [rip+g3035]
+  movsxd rdi, dword ptr [rip+g1091]
+  add rsi, rdi
+  mov word ptr [rip+g4178], si
+  movsx rsi, byte ptr [rip+g3423]
+  add rsi, qword ptr [rip+g187]
+  mov dword ptr [rip+g4179], esi
+  mov rax, qword ptr [rip+g4170]
+.L.return.u417:
+  ret
+.text
+.p2align 4
+.global u418
+u418:
+  movsxd rsi, dword ptr [rip+g1319]
+  add rsi, qword ptr [rip+g2367]
+  mov dword ptr [rip+g4180], esi
+  mov rsi, qword ptr [rip+g107]
+  movsxd rdi, dword ptr [rip+g2741]
+  add rsi, rdi
+  mov byte ptr [rip+g4181], sil
+  movsxd rsi, dword ptr [rip+g3871]
+  movsx rdi, word ptr [rip+g641]
+  add rsi, rdi
+  mov byte ptr [rip+g4182], sil
+  movsxd rsi, dword ptr [rip+g4971]
+  movsx rdi, word ptr [rip+g2007]
+  add rsi, rdi
+  mov qword ptr [rip+g4183], rsi
+  mov rsi, qword ptr [rip+g1185]
+  movsx rdi, word ptr [rip+g838]
+  add rsi, rdi
+  mov word ptr [rip+g4184], si
+  movsx rsi, word ptr [rip+g3542]
+  movsxd rdi, dword ptr [rip+g4475]
+  add rsi, rdi
+  mov dword ptr [rip+g4185], esi
+  movsx rsi, word ptr [rip+g4291]
+  movsxd rdi, dword ptr [rip+g3720]
+  add rsi, rdi
+  mov dword ptr [rip+g4186], esi
+  movsx rsi, byte ptr [rip+g3671]
+  movsx rdi, byte ptr [rip+g4921]
+  add rsi, rdi
+  mov qword ptr [rip+g4187], rsi
+  movsxd rsi, dword ptr [rip+g3807]
+  movsxd rdi, dword ptr [rip+g154]
+  add rsi, rdi
+  mov byte ptr [rip+g4188], sil
+  movsx rsi, byte ptr [rip+g2279]
+  movsx rdi, byte ptr [rip+g2892]
+  add rsi, rdi
+  mov qword ptr [rip+g4189], rsi
+  movsxd rsi, dword ptr [rip+g4180]
+  mov rax, rsi
+.L.return.u418:
+  ret
+.text
+.p2align 4
+.global u419
+u419:
+  movsx rsi, word ptr [rip+g792]
+  movsx rdi, word ptr [rip+g3279]
+  add rsi, rdi
+  mov qword ptr [rip+g4190], rsi
+  movsx rsi, word ptr [rip+g4386]
+  movsx rdi, word ptr [rip+g1959]
+  add rsi, rdi
+  mov dword ptr [rip+g4191], esi
+  movsx rsi, byte ptr [rip+g4841]
+  movsx rdi, word ptr [rip+g3318]
+  add rsi, rdi
+  mov word ptr [rip+g4192], si
+  mov rsi, qword ptr [rip+g4405]
+  movsxd rdi, dword ptr [rip+g2639]
+  add rsi, rdi
+  mov qword ptr [rip+g4193], rsi
+  movsx rsi, byte ptr [rip+g3207]
+  add rsi, qword ptr [rip+g3547]
+  mov byte ptr [rip+g4194], sil
+  movsxd rsi, dword ptr [rip+g2342]
+  movsx rdi, byte ptr [rip+g4236]
+  add rsi, rdi
+  mov byte ptr [rip+g4195], sil
+  mov rsi, qword ptr [rip+g2253]
+  movsxd rdi, dword ptr [rip+g2191]
+  add rsi, rdi
+  mov word ptr [rip+g4196], si
+  movsx rsi, word ptr [rip+g4490]
+  add rsi, qword ptr [rip+g959]
+  mov qword ptr [rip+g4197], rsi
+  mov rsi, qword ptr [rip+g2035]
+  movsxd rdi, dword ptr [rip+g2324]
+  add rsi, rdi
+  mov dword ptr [rip+g4198], esi
+  movsxd rsi, dword ptr [rip+g4636]
+  movsx rdi, word ptr [rip+g2736]
+  add rsi, rdi
+  mov byte ptr [rip+g4199], sil
+  mov rax, qword ptr [rip+g4190]
+.L.return.u419:
+  ret
+.text
+.p2align 4
+.global u420
+u420:
+  movsxd rsi, dword ptr [rip+g4661]
+  add rsi, qword ptr [rip+g3273]
+  mov qword ptr [rip+g4200], rsi
+  movsx rsi, word ptr [rip+g4658]
+  movsx rdi, word ptr [rip+g2024]
+  add rsi, rdi
+  mov byte ptr [rip+g4201], sil
+  movsx rsi, byte ptr [rip+g1002]
+  add rsi, qword ptr [rip+g1964]
+  mov dword ptr [rip+g4202], esi
+  movsxd rsi, dword ptr [rip+g3823]
+  movsx rdi, word ptr [rip+g2583]
+  add rsi, rdi
+  mov byte ptr [rip+g4203], sil
+  movsxd rsi, dword ptr [rip+g318]
+  movsx rdi, byte ptr [rip+g4584]
+  add rsi, rdi
+  mov byte ptr [rip+g4204], sil
+  mov rsi, qword ptr [rip+g708]
+  movsx rdi, byte ptr [rip+g1901]
+  add rsi, rdi
+  mov word ptr [rip+g4205], si
+  movsxd rsi, dword ptr [rip+g184]
+  movsxd rdi, dword ptr [rip+g4916]
+  add rsi, rdi
+  mov byte ptr [rip+g4206], sil
+  movsx rsi, word ptr [rip+g1867]
+  movsx rdi, word ptr [rip+g1325]
+  add rsi, rdi
+  mov qword ptr [rip+g4207], rsi
+  movsx rsi, byte ptr [rip+g595]
+  movsx rdi, word ptr [rip+g4658]
+  add rsi, rdi
+  mov dword ptr [rip+g4208], esi
+  mov rsi, qword ptr [rip+g2018]
+  add rsi, qword ptr [rip+g466]
+  mov byte ptr [rip+g4209], sil
+  mov rax, qword ptr [rip+g4200]
+.L.return.u420:
+  ret
+.text
+.p2align 4
+.global u421
+u421:
+  mov rsi, qword ptr [rip+g2444]
+  movsxd rdi, dword ptr [rip+g1815]
+  add rsi, rdi
+  mov word ptr [rip+g4210], si
+  movsx rsi, byte ptr [rip+g1836]
+  add rsi, qword ptr [rip+g3640]
+  mov word ptr [rip+g4211], si
+  movsx rsi, byte ptr [rip+g835]
+  movsx rdi, byte ptr [rip+g2894]
+  add rsi, rdi
+  mov qword ptr [rip+g4212], rsi
+  movsx rsi, word ptr [rip+g2062]
+  movsxd rdi, dword ptr [rip+g317]
+  add rsi, rdi
+  mov qword ptr [rip+g4213], rsi
+  movsx rsi, byte ptr [rip+g2314]
+  movsx rdi, word ptr [rip+g1813]
+  add rsi, rdi
+  mov word ptr [rip+g4214], si
+  movsx rsi, byte ptr [rip+g4596]
+  movsx rdi, byte ptr [rip+g3274]
+  add rsi, rdi
+  mov dword ptr [rip+g4215], esi
+  movsx rsi, byte ptr [rip+g2727]
+  add rsi, qword ptr [rip+g841]
+  mov dword ptr [rip+g4216], esi
+  mov rsi, qword ptr [rip+g3915]
+  movsx rdi, word ptr [rip+g2062]
+  add rsi, rdi
+  mov byte ptr [rip+g4217], sil
+  movsxd rsi, dword ptr [rip+g2769]
+  movsx rdi, byte ptr [rip+g3731]
+  add rsi, rdi
+  mov dword ptr [rip+g4218], esi
+  movsx rsi, byte ptr [rip+g1480]
+  movsxd rdi, dword ptr [rip+g4562]
+  add rsi, rdi
+  mov dword ptr [rip+g4219], esi
+  movsx rsi, word ptr [rip+g4210]
+  mov rax, rsi
+.L.return.u421:
+  ret
+.text
+.p2align 4
+.global u422
+u422:
+  movsx rsi, word ptr [rip+g2170]
+  movsxd rdi, dword ptr [rip+g1368]
+  add rsi, rdi
+  mov dword ptr [rip+g4220], esi
+  movsxd rsi, dword ptr [rip+g4020]
+  movsxd rdi, dword ptr [rip+g3696]
+  add rsi, rdi
+  mov qword ptr [rip+g4221], rsi
+  movsx rsi, byte ptr [rip+g2034]
+  add rsi, qword ptr [rip+g4821]
+  mov byte ptr [rip+g4222], sil
+  movsx rsi, byte ptr [rip+g3812]
+  movsx rdi, byte ptr [rip+g2727]
+  add rsi, rdi
+  mov dword ptr [rip+g4223], esi
+  movsx rsi, byte ptr [rip+g473]
+  movsxd rdi, dword ptr [rip+g996]
+  add rsi, rdi
+  mov qword ptr [rip+g4224], rsi
+  movsx rsi, word ptr [rip+g3367]
+  movsx rdi, word ptr [rip+g381]
+  add rsi, rdi
+  mov qword ptr [rip+g4225], rsi
+  movsx rsi, word ptr [rip+g3641]
+  add rsi, qword ptr [rip+g425]
+  mov word ptr [rip+g4226], si
+  movsxd rsi, dword ptr [rip+g3519]
+  add rsi, qword ptr [rip+g4197]
+  mov dword ptr [rip+g4227], esi
+  mov rsi, qword ptr [rip+g3400]
+  movsx rdi, word ptr [rip+g2373]
+  add rsi, rdi
+  mov word ptr [rip+g4228], si
+  movsx rsi, byte ptr [rip+g1750]
+  movsx rdi, word ptr [rip+g4015]
+  add rsi, rdi
+  mov byte ptr [rip+g4229], sil
+  movsxd rsi, dword ptr [rip+g4220]
+  mov rax, rsi
+.L.return.u422:
+  ret
+.text
+.p2align 4
+.global u423
+u423:
+  movsxd rsi, dword ptr [rip+g671]
+  movsx rdi, word ptr [rip+g2394]
+  add rsi, rdi
+  mov qword ptr [rip+g4230], rsi
+  movsxd rsi, dword ptr [rip+g2342]
+  movsx rdi, byte ptr [rip+g2476]
+  add rsi, rdi
+  mov word ptr [rip+g4231], si
+  mov rsi, qword ptr [rip+g4480]
+  movsx rdi, byte ptr [rip+g3453]
+  add rsi, rdi
+  mov dword ptr [rip+g4232], esi
+  mov rsi, qword ptr [rip+g3869]
+  add rsi, qword ptr [rip+g4461]
+  mov qword ptr [rip+g4233], rsi
+  mov rsi, qword ptr [rip+g2562]
+  add rsi, qword ptr [rip+g2142]
+  mov word ptr [rip+g4234], si
+  movsx rsi, byte ptr [rip+g361]
+  movsx rdi, word ptr [rip+g2954]
+  add rsi, rdi
+  mov word ptr [rip+g4235], si
+  mov rsi, qword ptr [rip+g2423]
+  add rsi, qword ptr [rip+g1140]
+  mov byte ptr [rip+g4236], sil
+  movsx rsi, byte ptr [rip+g2243]
+  add rsi, qword ptr [rip+g3974]
+  mov byte ptr [rip+g4237], sil
+  mov rsi, qword ptr [rip+g3195]
+  add rsi, qword ptr [rip+g1143]
+  mov dword ptr [rip+g4238], esi
+  movsx rsi, word ptr [rip+g641]
+  movsxd rdi, dword ptr [rip+g3127]
+  add rsi, rdi
+  mov word ptr [rip+g4239], si
+  mov rax, qword ptr [rip+g4230]
+.L.return.u423:
+  ret
+.text
+.p2align 4
+.global u424
+u424:
+  mov rsi, qword ptr [rip+g1786]
+  movsx rdi, byte ptr [rip+g481]
+  add rsi, rdi
+  mov byte ptr [rip+g4240], sil
+  movsx rsi, word ptr [rip+g829]
+  movsxd rdi, dword ptr [rip+g2994]
+  add rsi, rdi
+  mov byte ptr [rip+g4241], sil
+  movsx rsi, byte ptr [rip+g75]
+  movsx rdi, word ptr [rip+g3047]
+  add rsi, rdi
+  mov byte ptr [rip+g4242], sil
+  mov rsi, qword ptr [rip+g2508]
+  movsxd rdi, dword ptr [rip+g448]
+  add rsi, rdi
+  mov byte ptr [rip+g4243], sil
+  movsx rsi, byte ptr [rip+g2255]
+  movsx rdi, word ptr [rip+g4012]
+  add rsi, rdi
+  mov word ptr [rip+g4244], si
+  movsx rsi, word ptr [rip+g4254]
+  add rsi, qword ptr [rip+g821]
+  mov word ptr [rip+g4245], si
+  movsxd rsi, dword ptr [rip+g914]
+  movsxd rdi, dword ptr [rip+g2695]
+  add rsi, rdi
+  mov word ptr [rip+g4246], si
+  movsxd rsi, dword ptr [rip+g3577]
+  movsxd rdi, dword ptr [rip+g2466]
+  add rsi, rdi
+  mov byte ptr [rip+g4247], sil
+  movsx rsi, word ptr [rip+g3674]
+  movsx rdi, byte ptr [rip+g4570]
+  add rsi, rdi
+  mov qword ptr [rip+g4248], rsi
+  movsx rsi, byte ptr [rip+g3921]
+  movsxd rdi, dword ptr [rip+g2161]
+  add rsi, rdi
+  mov word ptr [rip+g4249], si
+  movsx rsi, byte ptr [rip+g4240]
+  mov rax, rsi
+.L.return.u424:
+  ret
+.text
+.p2align 4
+.global u425
+u425:
+  movsx rsi, byte ptr [rip+g3468]
+  movsxd rdi, dword ptr [rip+g1975]
+  add rsi, rdi
+  mov byte ptr [rip+g4250], sil
+  mov rsi, qword ptr [rip+g4739]
+  movsx rdi, word ptr [rip+g3745]
+  add rsi, rdi
+  mov dword ptr [rip+g4251], esi
+  movsxd rsi, dword ptr [rip+g193]
+  movsx rdi, word ptr [rip+g3095]
+  add rsi, rdi
+  mov byte ptr [rip+g4252], sil
+  movsxd rsi, dword ptr [rip+g1861]
+  movsx rdi, word ptr [rip+g3019]
+  add rsi, rdi
+  mov dword ptr [rip+g4253], esi
+  movsx rsi, byte ptr [rip+g4323]
+  movsx rdi, word ptr [rip+g3375]
+  add rsi, rdi
+  mov word ptr [rip+g4254], si
+  movsx rsi, byte ptr [rip+g1707]
+  movsx rdi, byte ptr [rip+g972]
+  add rsi, rdi
+  mov dword ptr [rip+g4255], esi
+  mov rsi, qword ptr [rip+g407]
+  movsx rdi, byte ptr [rip+g3826]
+  add rsi, rdi
+  mov qword ptr [rip+g4256], rsi
+  mov rsi, qword ptr [rip+g601]
+  movsx rdi, byte ptr [rip+g4986]
+  add rsi, rdi
+  mov byte ptr [rip+g4257], sil
+  movsx rsi, word ptr [rip+g4698]
+  add rsi, qword ptr [rip+g3050]
+  mov word ptr [rip+g4258], si
+  movsx rsi, byte ptr [rip+g2119]
+  movsx rdi, byte ptr [rip+g4666]
+  add rsi, rdi
+  mov dword ptr [rip+g4259], esi
+  movsx rsi, byte ptr [rip+g4250]
+  mov rax, rsi
+.L.return.u425:
+  ret
+.text
+.p2align 4
+.global u426
+u426:
+  movsx rsi, byte ptr [rip+g4237]
+  add rsi, qword ptr [rip+g2693]
+  mov word ptr [rip+g4260], si
+  movsx rsi, word ptr [rip+g933]
+  movsx rdi, word ptr [rip+g2872]
+  add rsi, rdi
+  mov byte ptr [rip+g4261], sil
+  movsx rsi, word ptr [rip+g3692]
+  add rsi, qword ptr [rip+g3890]
+  mov byte ptr [rip+g4262], sil
+  mov rsi, qword ptr [rip+g4187]
+  add rsi, qword ptr [rip+g3964]
+  mov qword ptr [rip+g4263], rsi
+  mov rsi, qword ptr [rip+g3701]
+  movsx rdi, word ptr [rip+g2277]
+  add rsi, rdi
+  mov byte ptr [rip+g4264], sil
+  mov rsi, qword ptr [rip+g4842]
+  movsx rdi, word ptr [rip+g1912]
+  add rsi, rdi
+  mov dword ptr [rip+g4265], esi
+  movsxd rsi, dword ptr [rip+g4334]
+  add rsi, qword ptr [rip+g1424]
+  mov byte ptr [rip+g4266], sil
+  mov rsi, qword ptr [rip+g918]
+  movsx rdi, byte ptr [rip+g1187]
+  add rsi, rdi
+  mov dword ptr [rip+g4267], esi
+  movsx rsi, byte ptr [rip+g4782]
+  movsx rdi, word ptr [rip+g2790]
+  add rsi, rdi
+  mov byte ptr [rip+g4268], sil
+  movsx rsi, byte ptr [rip+g38]
+  movsx rdi, word ptr [rip+g4211]
+  add rsi, rdi
+  mov byte ptr [rip+g4269], sil
+  movsx rsi, word ptr [rip+g4260]
+  mov rax, rsi
+.L.return.u426:
+  ret
+.text
+.p2align 4
+.global u427
+u427:
+  movsx rsi, byte ptr [rip+g4880]
+  movsxd rdi, dword ptr [rip+g1665]
+  add rsi, rdi
+  mov byte ptr [rip+g4270], sil
+  mov rsi, qword ptr [rip+g3951]
+  movsx rdi, word ptr [rip+g2048]
+  add rsi, rdi
+  mov word ptr [rip+g4271], si
+  movsx rsi, byte ptr [rip+g3172]
+  movsxd rdi, dword ptr [rip+g2824]
+  add rsi, rdi
+  mov dword ptr [rip+g4272], esi
+  movsx rsi, word ptr [rip+g3476]
+  movsx rdi, word ptr [rip+g3695]
+  add rsi, rdi
+  mov word ptr [rip+g4273], si
+  movsx rsi, byte ptr [rip+g2706]
+  add rsi, qword ptr [rip+g3586]
+  mov byte ptr [rip+g4274], sil
+  movsxd rsi, dword ptr [rip+g2181]
+  movsxd rdi, dword ptr [rip+g996]
+  add rsi, rdi
+  mov dword ptr [rip+g4275], esi
+  mov rsi, qword ptr [rip+g3822]
+  movsxd rdi, dword ptr [rip+g4380]
+  add rsi, rdi
+  mov qword ptr [rip+g4276], rsi
+  mov rsi, qword ptr [rip+g4276]
+  movsx rdi, byte ptr [rip+g251]
+  add rsi, rdi
+  mov dword ptr [rip+g4277], esi
+  movsx rsi, word ptr [rip+g115]
+  add rsi, qword ptr [rip+g4263]
+  mov qword ptr [rip+g4278], rsi
+  movsxd rsi, dword ptr [rip+g2635]
+  add rsi, qword ptr [rip+g2038]
+  mov dword ptr [rip+g4279], esi
+  movsx rsi, byte ptr [rip+g4270]
+  mov rax, rsi
+.L.return.u427:
+  ret
+.text
+.p2align 4
+.global u428
+u428:
+  movsx rsi, byte ptr [rip+g4044]
+  add rsi, qword ptr [rip+g1986]
+  mov dword ptr [rip+g4280], esi
+  movsx rsi, word ptr [rip+g3064]
+  add rsi, qword ptr [rip+g2226]
+  mov byte ptr [rip+g4281], sil
+  movsxd rsi, dword ptr [rip+g3529]
+  movsx rdi, byte ptr [rip+g2190]
+  add rsi, rdi
+  mov byte ptr [rip+g4282], sil
+  mov rsi, qword ptr [rip+g383]
+  add rsi, qword ptr [rip+g1745]
+  mov qword ptr [rip+g4283], rsi
+  movsx rsi, word ptr [rip+g3824]
+  movsx rdi, byte ptr [rip+g4408]
+  add rsi, rdi
+  mov word ptr [rip+g4284], si
+  movsx rsi, word ptr [rip+g3370]
+  movsx rdi, word ptr [rip+g2590]
+  add rsi, rdi
+  mov dword ptr [rip+g4285], esi
+  mov rsi, qword ptr [rip+g629]
+  movsx rdi, byte ptr [rip+g3686]
+  add rsi, rdi
+  mov byte ptr [rip+g4286], sil
+  movsx rsi, byte ptr [rip+g2464]
+  movsx rdi, byte ptr [rip+g582]
+  add rsi, rdi
+  mov qword ptr [rip+g4287], rsi
+  movsx rsi, word ptr [rip+g2531]
+  add rsi, qword ptr [rip+g1170]
+  mov qword ptr [rip+g4288], rsi
+  mov rsi, qword ptr [rip+g920]
+  movsx rdi, byte ptr [rip+g4257]
+  add rsi, rdi
+  mov qword ptr [rip+g4289], rsi
+  movsxd rsi, dword ptr [rip+g4280]
+  mov rax, rsi
+.L.return.u428:
+  ret
+.text
+.p2align 4
+.global u429
+u429:
+  movsx rsi, byte ptr [rip+g4160]
+  movsx rdi, byte ptr [rip+g4994]
+  add rsi, rdi
+  mov qword ptr [rip+g4290], rsi
+  movsxd rsi, dword ptr [rip+g1506]
+  movsxd rdi, dword ptr [rip+g785]
+  add rsi, rdi
+  mov word ptr [rip+g4291], si
+  mov rsi, qword ptr [rip+g253]
+  add rsi, qword ptr [rip+g2618]
+  mov qword ptr [rip+g4292], rsi
+  mov rsi, qword ptr [rip+g1938]
+  movsx rdi, word ptr [rip+g4922]
+  add rsi, rdi
+  mov dword ptr [rip+g4293], esi
+  movsxd rsi, dword ptr [rip+g1944]
+  movsx rdi, byte ptr [rip+g897]
+  add rsi, rdi
+  mov dword ptr [rip+g4294], esi
+  mov rsi, qword ptr [rip+g2150]
+  add rsi, qword ptr [rip+g3830]
+  mov qword ptr [rip+g4295], rsi
+  movsx rsi, word ptr [rip+g1100]
+  movsxd rdi, dword ptr [rip+g3260]
+  add rsi, rdi
+  mov qword ptr [rip+g4296], rsi
+  movsx rsi, word ptr [rip+g3793]
+  add rsi, qword ptr [rip+g1487]
+  mov qword ptr [rip+g4297], rsi
+  movsx rsi, word ptr [rip+g840]
+  movsx rdi, word ptr [rip+g933]
+  add rsi, rdi
+  mov dword ptr [rip+g4298], esi
+  mov rsi, qword ptr [rip+g566]
+  add rsi, qword ptr [rip+g4424]
+  mov qword ptr [rip+g4299], rsi
+  mov rax, qword ptr [rip+g4290]
+.L.return.u429:
+  ret
+.text
+.p2align 4
+.global u430
+u430:
+  movsxd rsi, dword ptr [rip+g2010]
+  movsx rdi, word ptr [rip+g4178]
+  add rsi, rdi
+  mov qword ptr [rip+g4300], rsi
+  movsx rsi, word ptr [rip+g2537]
+  movsx rdi, word ptr [rip+g2539]
+  add rsi, rdi
+  mov dword ptr [rip+g4301], esi
+  movsxd rsi, dword ptr [rip+g1512]
+  movsx rdi, word ptr [rip+g2792]
+  add rsi, rdi
+  mov byte ptr [rip+g4302], sil
+  movsx rsi, word ptr [rip+g2145]
+  movsxd rdi, dword ptr [rip+g2903]
+  add rsi, rdi
+  mov dword ptr [rip+g4303], esi
+  movsxd rsi, dword ptr [rip+g1886]
+  movsxd rdi, dword ptr [rip+g1982]
+  add rsi, rdi
+  mov qword ptr [rip+g4304], rsi
+  movsxd rsi, dword ptr [rip+g3369]
+  movsx rdi, byte ptr [rip+g2601]
+  add rsi, rdi
+  mov byte ptr [rip+g4305], sil
+  mov rsi, qword ptr [rip+g1063]
+  add rsi, qword ptr [rip+g2001]
+  mov word ptr [rip+g4306], si
+  movsx rsi, byte ptr [rip+g1423]
+  movsx rdi, word ptr [rip+g1715]
+  add rsi, rdi
+  mov dword ptr [rip+g4307], esi
+  movsx rsi, word ptr [rip+g3788]
+  movsx rdi, word ptr [rip+g4657]
+  add rsi, rdi
+  mov word ptr [rip+g4308], si
+  movsx rsi, byte ptr [rip+g424]
+  movsx rdi, byte ptr [rip+g477]
+  add rsi, rdi
+  mov dword ptr [rip+g4309], esi
+  mov rax, qword ptr [rip+g4300]
+.L.return.u430:
+  ret
+.text
+.p2align 4
+.global u431
+u431:
+  movsx rsi, word ptr [rip+g654]
+  add rsi, qword ptr [rip+g1139]
+  mov byte ptr [rip+g4310], sil
+  movsxd rsi, dword ptr [rip+g4077]
+  movsx rdi, byte ptr [rip+g400]
+  add rsi, rdi
+  mov word ptr [rip+g4311], si
+  movsx rsi, word ptr [rip+g2990]
+  movsx rdi, byte ptr [rip+g3181]
+  add rsi, rdi
+  mov byte ptr [rip+g4312], sil
+  movsx rsi, word ptr [rip+g2531]
+  movsx rdi, word ptr [rip+g1177]
+  add rsi, rdi
+  mov byte ptr [rip+g4313], sil
+  movsx rsi, word ptr [rip+g777]
+  movsxd rdi, dword ptr [rip+g2738]
+  add rsi, rdi
+  mov dword ptr [rip+g4314], esi
+  mov rsi, qword ptr [rip+g2431]
+  add rsi, qword ptr [rip+g2026]
+  mov dword ptr [rip+g4315], esi
+  movsx rsi, byte ptr [rip+g2118]
+  movsxd rdi, dword ptr [rip+g1058]
+  add rsi, rdi
+  mov qword ptr [rip+g4316], rsi
+  movsx rsi, word ptr [rip+g1893]
+  movsxd rdi, dword ptr [rip+g4770]
+  add rsi, rdi
+  mov byte ptr [rip+g4317], sil
+  mov rsi, qword ptr [rip+g1283]
+  add rsi, qword ptr [rip+g1323]
+  mov dword ptr [rip+g4318], esi
+  mov rsi, qword ptr [rip+g1908]
+  add rsi, qword ptr [rip+g3148]
+  mov qword ptr [rip+g4319], rsi
+  movsx rsi, byte ptr [rip+g4310]
+  mov rax, rsi
+.L.return.u431:
+  ret
+.text
+.p2align 4
+.global u432
+u432:
+  movsx rsi, word ptr [rip+g244]
+  movsx rdi, byte ptr [rip+g4766]
+  add rsi, rdi
+  mov word ptr [rip+g4320], si
+  movsx rsi, word ptr [rip+g151]
+  add rsi, qword ptr [rip+g133]
+  mov qword ptr [rip+g4321], rsi
+  movsxd rsi, dword ptr [rip+g1775]
+  add rsi, qword ptr [rip+g3576]
+  mov byte ptr [rip+g4322], sil
+  mov rsi, qword ptr [rip+g4773]
+  movsxd rdi, dword ptr [rip+g2687]
+  add rsi, rdi
+  mov byte ptr [rip+g4323], sil
+  mov rsi, qword ptr [rip+g4172]
+  movsxd rdi, dword ptr [rip+g2578]
+  add rsi, rdi
+  mov byte ptr [rip+g4324], sil
+  mov rsi, qword ptr [rip+g1648]
+  add rsi, qword ptr [rip+g1721]
+  mov byte ptr [rip+g4325], sil
+  movsx rsi, byte ptr [rip+g2345]
+  add rsi, qword ptr [rip+g1957]
+  mov dword ptr [rip+g4326], esi
+  mov rsi, qword ptr [rip+g3273]
+  add rsi, qword ptr [rip+g2951]
+  mov word ptr [rip+g4327], si
+  mov rsi, qword ptr [rip+g1535]
+  movsx rdi, byte ptr [rip+g1052]
+  add rsi, rdi
+  mov byte ptr [rip+g4328], sil
+  movsx rsi, word ptr [rip+g4798]
+  movsx rdi, word ptr [rip+g3597]
+  add rsi, rdi
+  mov word ptr [rip+g4329], si
+  movsx rsi, word ptr [rip+g4320]
+  mov rax, rsi
+.L.return.u432:
+  ret
+.text
+.p2align 4
+.global u433
+u433:
+  mov rsi, qword ptr [rip+g982]
+  movsx rdi, word ptr [rip+g4320]
+  add rsi, rdi
+  mov word ptr [rip+g4330], si
+  mov rsi, qword ptr [rip+g3772]
+  movsx rdi, word ptr [rip+g3387]
+  add rsi, rdi
+  mov word ptr [rip+g4331], si
+  mov rsi, qword ptr [rip+g1795]
+  movsx rdi, word ptr [rip+g1960]
+  add rsi, rdi
+  mov dword ptr [rip+g4332], esi
+  movsx rsi, byte ptr [rip+g4302]
+  movsxd rdi, dword ptr [rip+g2339]
+  add rsi, rdi
+  mov byte ptr [rip+g4333], sil
+  movsx rsi, byte ptr [rip+g1421]
+  movsx rdi, word ptr [rip+g2013]
+  add rsi, rdi
+  mov dword ptr [rip+g4334], esi
+  mov rsi, qword ptr [rip+g2811]
+  movsxd rdi, dword ptr [rip+g4895]
+  add rsi, rdi
+  mov byte ptr [rip+g4335], sil
+  movsx rsi, byte ptr [rip+g2293]
+  movsxd rdi, dword ptr [rip+g713]
+  add rsi, rdi
+  mov dword ptr [rip+g4336], esi
+  movsx rsi, word ptr [rip+g1153]
+  movsx rdi, word ptr [rip+g100]
+  add rsi, rdi
+  mov word ptr [rip+g4337], si
+  mov rsi, qword ptr [rip+g1776]
+  add rsi, qword ptr [rip+g686]
+  mov dword ptr [rip+g4338], esi
+  movsxd rsi, dword ptr [rip+g4541]
+  movsx rdi, word ptr [rip+g4271]
+  add rsi, rdi
+  mov qword ptr [rip+g4339], rsi
+  movsx rsi, word ptr [rip+g4330]
+  mov rax, rsi
+.L.return.u433:
+  ret
+.text
+.p2align 4
+.global u434
+u434:
+  mov rsi, qword ptr [rip+g892]
+  movsxd rdi, dword ptr [rip+g2228]
+  add rsi, rdi
+  mov word ptr [rip+g4340], si
+  movsx rsi, word ptr [rip+g2222]
+  add rsi, qword ptr [rip+g3440]
+  mov byte ptr [rip+g4341], sil
+  movsxd rsi, dword ptr [rip+g4354]
+  movsxd rdi, dword ptr [rip+g460]
+  add rsi, rdi
+  mov word ptr [rip+g4342], si
+  movsx rsi, byte ptr [rip+g2576]
+  movsx rdi, word ptr [rip+g1257]
+  add rsi, rdi
+  mov byte ptr [rip+g4343], sil
+  movsxd rsi, dword ptr [rip+g4770]
+  movsx rdi, byte ptr [rip+g3317]
+  add rsi, rdi
+  mov word ptr [rip+g4344], si
+  movsxd rsi, dword ptr [rip+g468]
+  add rsi, qword ptr [rip+g2957]
+  mov word ptr [rip+g4345], si
+  movsx rsi, word ptr [rip+g2382]
+  movsx rdi, byte ptr [rip+g1262]
+  add rsi, rdi
+  mov word ptr [rip+g4346], si
+  movsx rsi, byte ptr [rip+g3687]
+  movsx rdi, word ptr [rip+g3788]
+  add rsi, rdi
+  mov word ptr [rip+g4347], si
+  movsx rsi, byte ptr [rip+g4936]
+  movsx rdi, byte ptr [rip+g871]
+  add rsi, rdi
+  mov dword ptr [rip+g4348], esi
+  movsx rsi, word ptr [rip+g1727]
+  add rsi, qword ptr [rip+g3959]
+  mov dword ptr [rip+g4349], esi
+  movsx rsi, word ptr [rip+g4340]
+  mov rax, rsi
+.L.return.u434:
+  ret
+.text
+.p2align 4
+.global u435
+u435:
+  movsx rsi, byte ptr [rip+g2717]
+  movsx rdi, word ptr [rip+g244]
+  add rsi, rdi
+  mov qword ptr [rip+g4350], rsi
+  movsx rsi, word ptr [rip+g2357]
+  movsx rdi, word ptr [rip+g284]
+  add rsi, rdi
+  mov qword ptr [rip+g4351], rsi
+  movsx rsi, byte ptr [rip+g2748]
+  add rsi, qword ptr [rip+g2798]
+  mov qword ptr [rip+g4352], rsi
+  movsx rsi, word ptr [rip+g4552]
+  add rsi, qword ptr [rip+g2761]
+  mov word ptr [rip+g4353], si
+  movsx rsi, byte ptr [rip+g1223]
+  movsxd rdi, dword ptr [rip+g1834]
+  add rsi, rdi
+  mov dword ptr [rip+g4354], esi
+  mov rsi, qword ptr [rip+g856]
+  movsx rdi, word ptr [rip+g2327]
+  add rsi, rdi
+  mov byte ptr [rip+g4355], sil
+  movsxd rsi, dword ptr [rip+g3663]
+  movsxd rdi, dword ptr [rip+g230]
+  add rsi, rdi
+  mov byte ptr [rip+g4356], sil
+  movsx rsi, word ptr [rip+g1268]
+  movsx rdi, byte ptr [rip+g2395]
+  add rsi, rdi
+  mov byte ptr [rip+g4357], sil
+  movsx rsi, word ptr [rip+g1167]
+  movsx rdi, byte ptr [rip+g3182]
+  add rsi, rdi
+  mov dword ptr [rip+g4358], esi
+  movsx rsi, byte ptr [rip+g2476]
+  movsx rdi, word ptr [rip+g3152]
+  add rsi, rdi
+  mov qword ptr [rip+g4359], rsi
+  mov rax, qword ptr [rip+g4350]
+.L.return.u435:
+  ret
+.text
+.p2align 4
+.global u436
+u436:
+  movsx rsi, byte ptr [rip+g399]
+  movsx rdi, byte ptr [rip+g3870]
+  add rsi, rdi
+  mov byte ptr [rip+g4360], sil
+  movsxd rsi, dword ptr [rip+g3210]
+  movsxd rdi, dword ptr [rip+g3515]
+  add rsi, rdi
+  mov byte ptr [rip+g4361], sil
+  movsx rsi, word ptr [rip+g2455]
+  add rsi, qword ptr [rip+g1781]
+  mov word ptr [rip+g4362], si
+  movsx rsi, word ptr [rip+g4967]
+  movsx rdi, byte ptr [rip+g424]
+  add rsi, rdi
+  mov byte ptr [rip+g4363], sil
+  movsx rsi, byte ptr [rip+g2920]
+  add rsi, qword ptr [rip+g1827]
+  mov dword ptr [rip+g4364], esi
+  mov rsi, qword ptr [rip+g1155]
+  movsxd rdi, dword ptr [rip+g4294]
+  add rsi, rdi
+  mov byte ptr [rip+g4365], sil
+  movsxd rsi, dword ptr [rip+g4822]
+  movsxd rdi, dword ptr [rip+g608]
+  add rsi, rdi
+  mov word ptr [rip+g4366], si
+  movsx rsi, byte ptr [rip+g857]
+  add rsi, qword ptr [rip+g2826]
+  mov dword ptr [rip+g4367], esi
+  movsx rsi, word ptr [rip+g76]
+  movsx rdi, word ptr [rip+g3316]
+  add rsi, rdi
+  mov dword ptr [rip+g4368], esi
+  movsx rsi, byte ptr [rip+g3423]
+  movsxd rdi, dword ptr [rip+g3862]
+  add rsi, rdi
+  mov qword ptr [rip+g4369], rsi
+  movsx rsi, byte ptr [rip+g4360]
+  mov rax, rsi
+.L.return.u436:
+  ret
+.text
+.p2align 4
+.global u437
+u437:
+  movsxd rsi, dword ptr [rip+g1765]
+  add rsi, qword ptr [rip+g3486]
+  mov word ptr [rip+g4370], si
+  movsx rsi, byte ptr [rip+g4476]
+  movsx rdi, byte ptr [rip+g4355]
+  add rsi, rdi
+  mov byte ptr [rip+g4371], sil
+  movsx rsi, word ptr [rip+g578]
+  movsx rdi, word ptr [rip+g3150]
+  add rsi, rdi
+  mov word ptr [rip+g4372], si
+  movsxd rsi, dword ptr [rip+g2711]
+  movsx rdi, byte ptr [rip+g3235]
+  add rsi, rdi
+  mov word ptr [rip+g4373], si
+  mov rsi, qword ptr [rip+g2316]
+  add rsi, qword ptr [rip+g780]
+  mov dword ptr [rip+g4374], esi
+  movsx rsi, word ptr [rip+g1987]
+  movsxd rdi, dword ptr [rip+g2304]
+  add rsi, rdi
+  mov qword ptr [rip+g4375], rsi
+  movsx rsi, word ptr [rip+g1167]
+  movsxd rdi, dword ptr [rip+g4876]
+  add rsi, rdi
+  mov byte ptr [rip+g4376], sil
+  movsx rsi, byte ptr [rip+g3056]
+  movsxd rdi, dword ptr [rip+g1045]
+  add rsi, rdi
+  mov qword ptr [rip+g4377], rsi
+  movsx rsi, byte ptr [rip+g2364]
+  movsxd rdi, dword ptr [rip+g1752]
+  add rsi, rdi
+  mov word ptr [rip+g4378], si
+  movsx rsi, byte ptr [rip+g3126]
+  add rsi, qword ptr [rip+g2035]
+  mov word ptr [rip+g4379], si
+  movsx rsi, word ptr [rip+g4370]
+  mov rax, rsi
+.L.return.u437:
+  ret
+.text
+.p2align 4
+.global u438
+u438:
+  mov rsi, qword ptr [rip+g539]
+  movsx rdi, word ptr [rip+g578]
+  add rsi, rdi
+  mov dword ptr [rip+g4380], esi
+  mov rsi, qword ptr [rip+g476]
+  movsx rdi, byte ptr [rip+g4503]
+  add rsi, rdi
+  mov dword ptr [rip+g4381], esi
+  movsx rsi, word ptr [rip+g358]
+  movsx rdi, byte ptr [rip+g2201]
+  add rsi, rdi
+  mov dword ptr [rip+g4382], esi
+  movsxd rsi, dword ptr [rip+g275]
+  movsxd rdi, dword ptr [rip+g3278]
+  add rsi, rdi
+  mov dword ptr [rip+g4383], esi
+  movsxd rsi, dword ptr [rip+g1666]
+  add rsi, qword ptr [rip+g570]
+  mov dword ptr [rip+g4384], esi
+  movsx rsi, word ptr [rip+g2145]
+  movsx rdi, word ptr [rip+g265]
+  add rsi, rdi
+  mov dword ptr [rip+g4385], esi
+  movsx rsi, word ptr [rip+g2561]
+  movsx rdi, word ptr [rip+g2264]
+  add rsi, rdi
+  mov word ptr [rip+g4386], si
+  mov rsi, qword ptr [rip+g3424]
+  movsxd rdi, dword ptr [rip+g1643]
+  add rsi, rdi
+  mov byte ptr [rip+g4387], sil
+  movsx rsi, byte ptr [rip+g2243]
+  movsx rdi, word ptr [rip+g1363]
+  add rsi, rdi
+  mov word ptr [rip+g4388], si
+  mov rsi, qword ptr [rip+g346]
+  add rsi, qword ptr [rip+g3407]
+  mov byte ptr [rip+g4389], sil
+  movsxd rsi, dword ptr [rip+g4380]
+  mov rax, rsi
+.L.return.u438:
+  ret
+.text
+.p2align 4
+.global u439
+u439:
+  movsxd rsi, dword ptr [rip+g2610]
+  add rsi, qword ptr [rip+g4107]
+  mov qword ptr [rip+g4390], rsi
+  movsx rsi, byte ptr [rip+g2300]
+  add rsi, qword ptr [rip+g601]
+  mov byte ptr [rip+g4391], sil
+  movsx rsi, word ptr [rip+g2156]
+  movsxd rdi, dword ptr [rip+g1940]
+  add rsi, rdi
+  mov word ptr [rip+g4392], si
+  mov rsi, qword ptr [rip+g4316]
+  add rsi, qword ptr [rip+g3891]
+  mov byte ptr [rip+g4393], sil
+  movsx rsi, byte ptr [rip+g1258]
+  movsx rdi, word ptr [rip+g4576]
+  add rsi, rdi
+  mov dword ptr [rip+g4394], esi
+  movsx rsi, word ptr [rip+g4951]
+  movsx rdi, word ptr [rip+g661]
+  add rsi, rdi
+  mov qword ptr [rip+g4395], rsi
+  mov rsi, qword ptr [rip+g368]
+  movsx rdi, byte ptr [rip+g4522]
+  add rsi, rdi
+  mov word ptr [rip+g4396], si
+  movsxd rsi, dword ptr [rip+g3357]
+  movsx rdi, byte ptr [rip+g4242]
+  add rsi, rdi
+  mov word ptr [rip+g4397], si
+  movsx rsi, word ptr [rip+g2924]
+  movsx rdi, word ptr [rip+g3815]
+  add rsi, rdi
+  mov qword ptr [rip+g4398], rsi
+  movsxd rsi, dword ptr [rip+g2139]
+  movsx rdi, byte ptr [rip+g1766]
+  add rsi, rdi
+  mov byte ptr [rip+g4399], sil
+  mov rax, qword ptr [rip+g4390]
+.L.return.u439:
+  ret
+.text
+.p2align 4
+.global u440
+u440:
+  movsxd rsi, dword ptr [rip+g1654]
+  movsx rdi, byte ptr [rip+g4451]
+  add rsi, rdi
+  mov dword ptr [rip+g4400], esi
+  mov rsi, qword ptr [rip+g4696]
+  add rsi, qword ptr [rip+g4651]
+  mov dword ptr [rip+g4401], esi
+  mov rsi, qword ptr [rip+g4752]
+  movsx rdi, byte ptr [rip+g4556]
+  add rsi, rdi
+  mov word ptr [rip+g4402], si
+  movsxd rsi, dword ptr [rip+g1502]
+  add rsi, qword ptr [rip+g4776]
+  mov dword ptr [rip+g4403], esi
+  movsx rsi, word ptr [rip+g3247]
+  movsx rdi, byte ptr [rip+g303]
+  add rsi, rdi
+  mov qword ptr [rip+g4404], rsi
+  movsx rsi, word ptr [rip+g144]
+  movsx rdi, byte ptr [rip+g4699]
+  add rsi, rdi
+  mov qword ptr [rip+g4405], rsi
+  movsxd rsi, dword ptr [rip+g4285]
+  add rsi, qword ptr [rip+g4998]
+  mov qword ptr [rip+g4406], rsi
+  mov rsi, qword ptr [rip+g4724]
+  add rsi, qword ptr [rip+g762]
+  mov word ptr [rip+g4407], si
+  movsxd rsi, dword ptr [rip+g1880]
+  add rsi, qword ptr [rip+g2001]
+  mov byte ptr [rip+g4408], sil
+  movsxd rsi, dword ptr [rip+g954]
+  movsx rdi, byte ptr [rip+g592]
+  add rsi, rdi
+  mov word ptr [rip+g4409], si
+  movsxd rsi, dword ptr [rip+g4400]
+  mov rax, rsi
+.L.return.u440:
+  ret
+.text
+.p2align 4
+.global u441
+u441:
+  movsx rsi, word ptr [rip+g783]
+  movsx rdi, byte ptr [rip+g4757]
+  add rsi, rdi
+  mov word ptr [rip+g4410], si
+  movsx rsi, word ptr [rip+g2790]
+  movsx rdi, byte ptr [rip+g4441]
+  add rsi, rdi
+  mov dword ptr [rip+g4411], esi
+  movsx rsi, word ptr [rip+g4019]
+  movsx rdi, word ptr [rip+g2531]
+  add rsi, rdi
+  mov qword ptr [rip+g4412], rsi
+  mov rsi, qword ptr [rip+g3263]
+  movsx rdi, byte ptr [rip+g1195]
+  add rsi, rdi
+  mov dword ptr [rip+g4413], esi
+  movsx rsi, byte ptr [rip+g458]
+  add rsi, qword ptr [rip+g4395]
+  mov qword ptr [rip+g4414], rsi
+  movsx rsi, word ptr [rip+g1793]
+  movsx rdi, byte ptr [rip+g1397]
+  add rsi, rdi
+  mov dword ptr [rip+g4415], esi
+  mov rsi, qword ptr [rip+g2325]
+  movsxd rdi, dword ptr [rip+g1691]
+  add rsi, rdi
+  mov qword ptr [rip+g4416], rsi
+  movsx rsi, byte ptr [rip+g3488]
+  movsx rdi, byte ptr [rip+g2920]
+  add rsi, rdi
+  mov word ptr [rip+g4417], si
+  movsx rsi, byte ptr [rip+g4568]
+  movsx rdi, byte ptr [rip+g3403]
+  add rsi, rdi
+  mov qword ptr [rip+g4418], rsi
+  mov rsi, qword ptr [rip+g672]
+  movsxd rdi, dword ptr [rip+g1017]
+  add rsi, rdi
+  mov dword ptr [rip+g4419], esi
+  movsx rsi, word ptr [rip+g4410]
+  mov rax, rsi
+.L.return.u441:
+  ret
+.text
+.p2align 4
+.global u442
+u442:
+  movsxd rsi, dword ptr [rip+g14]
+  movsx rdi, word ptr [rip+g2775]
+  add rsi, rdi
+  mov word ptr [rip+g4420], si
+  mov rsi, qword ptr [rip+g66]
+  movsx rdi, byte ptr [rip+g972]
+  add rsi, rdi
+  mov qword ptr [rip+g4421], rsi
+  mov rsi, qword ptr [rip+g3143]
+  movsxd rdi, dword ptr [rip+g3975]
+  add rsi, rdi
+  mov dword ptr [rip+g4422], esi
+  movsx rsi, byte ptr [rip+g3671]
+  add rsi, qword ptr [rip+g1122]
+  mov word ptr [rip+g4423], si
+  mov rsi, qword ptr [rip+g2407]
+  movsx rdi, byte ptr [rip+g4182]
+  add rsi, rdi
+  mov qword ptr [rip+g4424], rsi
+  movsxd rsi, dword ptr [rip+g4253]
+  movsx rdi, word ptr [rip+g1277]
+  add rsi, rdi
+  mov byte ptr [rip+g4425], sil
+  movsx rsi, word ptr [rip+g770]
+  add rsi, qword ptr [rip+g2074]
+  mov byte ptr [rip+g4426], sil
+  movsxd rsi, dword ptr [rip+g3310]
+  add rsi, qword ptr [rip+g2456]
+  mov byte ptr [rip+g4427], sil
+  movsx rsi, word ptr [rip+g1681]
+  movsx rdi, word ptr [rip+g2452]
+  add rsi, rdi
+  mov dword ptr [rip+g4428], esi
+  mov rsi, qword ptr [rip+g3338]
+  movsx rdi, word ptr [rip+g2373]
+  add rsi, rdi
+  mov qword ptr [rip+g4429], rsi
+  movsx rsi, word ptr [rip+g4420]
+  mov rax, rsi
+.L.return.u442:
+  ret
+.text
+.p2align 4
+.global u443
+u443:
+  mov rsi, qword ptr [rip+g3796]
+  movsx rdi, byte ptr [rip+g4746]
+  add rsi, rdi
+  mov byte ptr [rip+g4430], sil
+  movsx rsi, word ptr [rip+g4577]
+  movsx rdi, byte ptr [rip+g2492]
+  add rsi, rdi
+  mov qword ptr [rip+g4431], rsi
+  movsxd rsi, dword ptr [rip+g2511]
+  movsx rdi, word ptr [rip+g3385]
+  add rsi, rdi
+  mov qword ptr [rip+g4432], rsi
+  movsx rsi, byte ptr [rip+g1651]
+  movsx rdi, word ptr [rip+g1522]
+  add rsi, rdi
+  mov dword ptr [rip+g4433], esi
+  movsxd rsi, dword ptr [rip+g1845]
+  movsx rdi, byte ptr [rip+g3966]
+  add rsi, rdi
+  mov qword ptr [rip+g4434], rsi
+  movsxd rsi, dword ptr [rip+g1284]
+  add rsi, qword ptr [rip+g3243]
+  mov word ptr [rip+g4435], si
+  movsxd rsi, dword ptr [rip+g231]
+  add rsi, qword ptr [rip+g316]
+  mov dword ptr [rip+g4436], esi
+  movsx rsi, byte ptr [rip+g51]
+  movsx rdi, word ptr [rip+g3088]
+  add rsi, rdi
+  mov qword ptr [rip+g4437], rsi
+  movsxd rsi, dword ptr [rip+g1719]
+  movsx rdi, word ptr [rip+g1862]
+  add rsi, rdi
+  mov qword ptr [rip+g4438], rsi
+  movsx rsi, word ptr [rip+g854]
+  movsxd rdi, dword ptr [rip+g3139]
+  add rsi, rdi
+  mov dword ptr [rip+g4439], esi
+  movsx rsi, byte ptr [rip+g4430]
+  mov rax, rsi
+.L.return.u443:
+  ret
+.text
+.p2align 4
+.global u444
+u444:
+  movsxd rsi, dword ptr [rip+g2443]
+  movsx rdi, byte ptr [rip+g2725]
+  add rsi, rdi
+  mov word ptr [rip+g4440], si
+  movsx rsi, byte ptr [rip+g2031]
+  movsx rdi, word ptr [rip+g680]
+  add rsi, rdi
+  mov byte ptr [rip+g4441], sil
+  movsxd rsi, dword ptr [rip+g4887]
+  movsx rdi, word ptr [rip+g4452]
+  add rsi, rdi
+  mov dword ptr [rip+g4442], esi
+  movsxd rsi, dword ptr [rip+g140]
+  add rsi, qword ptr [rip+g4615]
+  mov qword ptr [rip+g4443], rsi
+  movsxd rsi, dword ptr [rip+g2710]
+  movsx rdi, word ptr [rip+g2974]
+  add rsi, rdi
+  mov dword ptr [rip+g4444], esi
+  movsx rsi, word ptr [rip+g3789]
+  movsx rdi, byte ptr [rip+g3172]
+  add rsi, rdi
+  mov word ptr [rip+g4445], si
+  mov rsi, qword ptr [rip+g178]
+  movsx rdi, byte ptr [rip+g373]
+  add rsi, rdi
+  mov word ptr [rip+g4446], si
+  mov rsi, qword ptr [rip+g187]
+  movsxd rdi, dword ptr [rip+g2830]
+  add rsi, rdi
+  mov qword ptr [rip+g4447], rsi
+  mov rsi, qword ptr [rip+g2316]
+  movsx rdi, byte ptr [rip+g1605]
+  add rsi, rdi
+  mov byte ptr [rip+g4448], sil
+  movsx rsi, byte ptr [rip+g1593]
+  movsx rdi, word ptr [rip+g1171]
+  add rsi, rdi
+  mov byte ptr [rip+g4449], sil
+  movsx rsi, word ptr [rip+g4440]
+  mov rax, rsi
+.L.return.u444:
+  ret
+.text
+.p2align 4
+.global u445
+u445:
+  mov rsi, qword ptr [rip+g3911]
+  add rsi, qword ptr [rip+g4958]
+  mov dword ptr [rip+g4450], esi
+  movsx rsi, word ptr [rip+g2257]
+  add rsi, qword ptr [rip+g2120]
+  mov byte ptr [rip+g4451], sil
+  movsx rsi, word ptr [rip+g2370]
+  movsx rdi, byte ptr [rip+g3620]
+  add rsi, rdi
+  mov word ptr [rip+g4452], si
+  movsx rsi, word ptr [rip+g1919]
+  movsx rdi, word ptr [rip+g3262]
+  add rsi, rdi
+  mov dword ptr [rip+g4453], esi
+  mov rsi, qword ptr [rip+g2393]
+  movsx rdi, byte ptr [rip+g2499]
+  add rsi, rdi
+  mov word ptr [rip+g4454], si
+  movsxd rsi, dword ptr [rip+g3337]
+  movsx rdi, byte ptr [rip+g4853]
+  add rsi, rdi
+  mov dword ptr [rip+g4455], esi
+  mov rsi, qword ptr [rip+g3456]
+  add rsi, qword ptr [rip+g2523]
+  mov dword ptr [rip+g4456], esi
+  mov rsi, qword ptr [rip+g813]
+  add rsi, qword ptr [rip+g3685]
+  mov qword ptr [rip+g4457], rsi
+  movsxd rsi, dword ptr [rip+g219]
+  movsxd rdi, dword ptr [rip+g3696]
+  add rsi, rdi
+  mov word ptr [rip+g4458], si
+  movsx rsi, byte ptr [rip+g2492]
+  movsx rdi, byte ptr [rip+g2173]
+  add rsi, rdi
+  mov byte ptr [rip+g4459], sil
+  movsxd rsi, dword ptr [rip+g4450]
+  mov rax, rsi
+.L.return.u445:
+  ret
+.text
+.p2align 4
+.global u446
+u446:
+  movsx rsi, word ptr [rip+g4626]
+  movsx rdi, word ptr [rip+g3639]
+  add rsi, rdi
+  mov dword ptr [rip+g4460], esi
+  mov rsi, qword ptr [rip+g3678]
+  movsx rdi, word ptr [rip+g589]
+  add rsi, rdi
+  mov qword ptr [rip+g4461], rsi
+  movsx rsi, byte ptr [rip+g3330]
+  movsx rdi, byte ptr [rip+g2385]
+  add rsi, rdi
+  mov dword ptr [rip+g4462], esi
+  mov rsi, qword ptr [rip+g386]
+  movsx rdi, byte ptr [rip+g3086]
+  add rsi, rdi
+  mov qword ptr [rip+g4463], rsi
+  movsx rsi, byte ptr [rip+g3649]
+  movsxd rdi, dword ptr [rip+g3288]
+  add rsi, rdi
+  mov dword ptr [rip+g4464], esi
+  movsx rsi, byte ptr [rip+g4572]
+  add rsi, qword ptr [rip+g1976]
+  mov word ptr [rip+g4465], si
+  movsx rsi, byte ptr [rip+g679]
+  movsxd rdi, dword ptr [rip+g884]
+  add rsi, rdi
+  mov dword ptr [rip+g4466], esi
+  movsx rsi, word ptr [rip+g4589]
+  movsxd rdi, dword ptr [rip+g1409]
+  add rsi, rdi
+  mov byte ptr [rip+g4467], sil
+  movsx rsi, byte ptr [rip+g1539]
+  movsxd rdi, dword ptr [rip+g3077]
+  add rsi, rdi
+  mov dword ptr [rip+g4468], esi
+  mov rsi, qword ptr [rip+g918]
+  movsx rdi, word ptr [rip+g2168]
+  add rsi, rdi
+  mov dword ptr [rip+g4469], esi
+  movsxd rsi, dword ptr [rip+g4460]
+  mov rax, rsi
+.L.return.u446:
+  ret
+.text
+.p2align 4
+.global u447
+u447:
+  movsx rsi, word ptr [rip+g1085]
+  movsx rdi, word ptr [rip+g226]
+  add rsi, rdi
+  mov qword ptr [rip+g4470], rsi
+  movsx rsi, word ptr [rip+g294]
+  movsxd rdi, dword ptr [rip+g1349]
+  add rsi, rdi
+  mov word ptr [rip+g4471], si
+  mov rsi, qword ptr [rip+g736]
+  movsx rdi, word ptr [rip+g4997]
+  add rsi, rdi
+  mov word ptr [rip+g4472], si
+  mov rsi, qword ptr [rip+g20]
+  add rsi, qword ptr [rip+g2482]
+  mov word ptr [rip+g4473], si
+  mov rsi, qword ptr [rip+g523]
+  movsxd rdi, dword ptr [rip+g2413]
+  add rsi, rdi
+  mov word ptr [rip+g4474], si
+  movsx rsi, word ptr [rip+g1647]
+  movsx rdi, byte ptr [rip+g757]
+  add rsi, rdi
+  mov dword ptr [rip+g4475], esi
+  movsx rsi, word ptr [rip+g2974]
+  add rsi, qword ptr [rip+g1734]
+  mov byte ptr [rip+g4476], sil
+  movsx rsi, word ptr [rip+g1440]
+  movsx rdi, byte ptr [rip+g2909]
+  add rsi, rdi
+  mov word ptr [rip+g4477], si
+  movsx rsi, word ptr [rip+g1874]
+  movsxd rdi, dword ptr [rip+g1218]
+  add rsi, rdi
+  mov word ptr [rip+g4478], si
+  movsx rsi, word ptr [rip+g3762]
+  movsx rdi, word ptr [rip+g488]
+  add rsi, rdi
+  mov qword ptr [rip+g4479], rsi
+  mov rax, qword ptr [rip+g4470]
+.L.return.u447:
+  ret
+.text
+.p2align 4
+.global u448
+u448:
+  movsxd rsi, dword ptr [rip+g1790]
+  movsx rdi, word ptr [rip+g446]
+  add rsi, rdi
+  mov qword ptr [rip+g4480], rsi
+  movsx rsi, word ptr [rip+g3596]
+  movsxd rdi, dword ptr [rip+g163]
+  add rsi, rdi
+  mov qword ptr [rip+g4481], rsi
+  movsx rsi, word ptr [rip+g485]
+  movsx rdi, byte ptr [rip+g3852]
+  add rsi, rdi
+  mov word ptr [rip+g4482], si
+  mov rsi, qword ptr [rip+g1015]
+  movsx rdi, byte ptr [rip+g3754]
+  add rsi, rdi
+  mov qword ptr [rip+g4483], rsi
+  mov rsi, qword ptr [rip+g1908]
+  movsx rdi, byte ptr [rip+g4506]
+  add rsi, rdi
+  mov qword ptr [rip+g4484], rsi
+  mov rsi, qword ptr [rip+g4299]
+  movsx rdi, word ptr [rip+g1334]
+  add rsi, rdi
+  mov qword ptr [rip+g4485], rsi
+  movsx rsi, word ptr [rip+g4784]
+  movsx rdi, byte ptr [rip+g4222]
+  add rsi, rdi
+  mov qword ptr [rip+g4486], rsi
+  mov rsi, qword ptr [rip+g2677]
+  movsx rdi, byte ptr [rip+g439]
+  add rsi, rdi
+  mov byte ptr [rip+g4487], sil
+  movsx rsi, byte ptr [rip+g2509]
+  movsx rdi, word ptr [rip+g4120]
+  add rsi, rdi
+  mov qword ptr [rip+g4488], rsi
+  movsxd rsi, dword ptr [rip+g2966]
+  movsx rdi, word ptr [rip+g4586]
+  add rsi, rdi
+  mov byte ptr [rip+g4489], sil
+  mov rax, qword ptr [rip+g4480]
+.L.return.u448:
+  ret
+.text
+.p2align 4
+.global u449
+u449:
+  mov rsi, qword ptr [rip+g985]
+  movsx rdi, word ptr [rip+g3940]
+  add rsi, rdi
+  mov word ptr [rip+g4490], si
+  movsxd rsi, dword ptr [rip+g1744]
+  movsx rdi, byte ptr [rip+g4110]
+  add rsi, rdi
+  mov word ptr [rip+g4491], si
+  mov rsi, qword ptr [rip+g4991]
+  movsx rdi, word ptr [rip+g4657]
+  add rsi, rdi
+  mov qword ptr [rip+g4492], rsi
+  movsx rsi, byte ptr [rip+g2044]
+  add rsi, qword ptr [rip+g310]
+  mov byte ptr [rip+g4493], sil
+  movsxd rsi, dword ptr [rip+g636]
+  movsxd rdi, dword ptr [rip+g1000]
+  add rsi, rdi
+  mov qword ptr [rip+g4494], rsi
+  mov rsi, qword ptr [rip+g1531]
+  movsx rdi, word ptr [rip+g4366]
+  add rsi, rdi
+  mov dword ptr [rip+g4495], esi
+  movsxd rsi, dword ptr [rip+g359]
+  add rsi, qword ptr [rip+g4729]
+  mov word ptr [rip+g4496], si
+  movsx rsi, word ptr [rip+g1171]
+  movsxd rdi, dword ptr [rip+g4267]
+  add rsi, rdi
+  mov qword ptr [rip+g4497], rsi
+  movsx rsi, word ptr [rip+g2583]
+  movsxd rdi, dword ptr [rip+g309]
+  add rsi, rdi
+  mov qword ptr [rip+g4498], rsi
+  movsx rsi, byte ptr [rip+g864]
+  movsxd rdi, dword ptr [rip+g2621]
+  add rsi, rdi
+  mov dword ptr [rip+g4499], esi
+  movsx rsi, word ptr [rip+g4490]
+  mov rax, rsi
+.L.return.u449:
+  ret
+.text
+.p2align 4
+.global u450
+u450:
+  mov rsi, qword ptr [rip+g4117]
+  add rsi, qword ptr [rip+g4118]
+  mov qword ptr [rip+g4500], rsi
+  movsx rsi, byte ptr [rip+g4789]
+  movsxd rdi, dword ptr [rip+g2129]
+  add rsi, rdi
+  mov byte ptr [rip+g4501], sil
+  movsx rsi, word ptr [rip+g2979]
+  movsxd rdi, dword ptr [rip+g2711]
+  add rsi, rdi
+  mov qword ptr [rip+g4502], rsi
+  mov rsi, qword ptr [rip+g4093]
+  movsx rdi, word ptr [rip+g3735]
+  add rsi, rdi
+  mov byte ptr [rip+g4503], sil
+  movsx rsi, byte ptr [rip+g639]
+  movsx rdi, word ptr [rip+g3880]
+  add rsi, rdi
+  mov qword ptr [rip+g4504], rsi
+  mov rsi, qword ptr [rip+g1704]
+  movsxd rdi, dword ptr [rip+g1319]
+  add rsi, rdi
+  mov dword ptr [rip+g4505], esi
+  movsx rsi, byte ptr [rip+g4974]
+  movsxd rdi, dword ptr [rip+g1586]
+  add rsi, rdi
+  mov byte ptr [rip+g4506], sil
+  mov rsi, qword ptr [rip+g4729]
+  movsx rdi, word ptr [rip+g3304]
+  add rsi, rdi
+  mov dword ptr [rip+g4507], esi
+  movsx rsi, word ptr [rip+g3639]
+  add rsi, qword ptr [rip+g4278]
+  mov dword ptr [rip+g4508], esi
+  movsx rsi, word ptr [rip+g2896]
+  movsx rdi, word ptr [rip+g1309]
+  add rsi, rdi
+  mov qword ptr [rip+g4509], rsi
+  mov rax, qword ptr [rip+g4500]
+.L.return.u450:
+  ret
+.text
+.p2align 4
+.global u451
+u451:
+  movsx rsi, word ptr [rip+g174]
+  movsx rdi, word ptr [rip+g4231]
+  add rsi, rdi
+  mov word ptr [rip+g4510], si
+  movsxd rsi, dword ptr [rip+g990]
+  movsx rdi, word ptr [rip+g1708]
+  add rsi, rdi
+  mov qword ptr [rip+g4511], rsi
+  movsxd rsi, dword ptr [rip+g1160]
+  add rsi, qword ptr [rip+g2508]
+  mov word ptr [rip+g4512], si
+  movsxd rsi, dword ptr [rip+g4455]
+  add rsi, qword ptr [rip+g4511]
+  mov word ptr [rip+g4513], si
+  movsx rsi, byte ptr [rip+g1720]
+  movsxd rdi, dword ptr [rip+g1674]
+  add rsi, rdi
+  mov word ptr [rip+g4514], si
+  movsx rsi, byte ptr [rip+g3454]
+  add rsi, qword ptr [rip+g4594]
+  mov byte ptr [rip+g4515], sil
+  movsx rsi, word ptr [rip+g654]
+  movsx rdi, word ptr [rip+g631]
+  add rsi, rdi
+  mov word ptr [rip+g4516], si
+  movsx rsi, word ptr [rip+g4930]
+  movsx rdi, byte ptr [rip+g2057]
+  add rsi, rdi
+  mov byte ptr [rip+g4517], sil
+  mov rsi, qword ptr [rip+g1282]
+  movsx rdi, byte ptr [rip+g4625]
+  add rsi, rdi
+  mov byte ptr [rip+g4518], sil
+  movsx rsi, byte ptr [rip+g235]
+  movsx rdi, byte ptr [rip+g2039]
+  add rsi, rdi
+  mov word ptr [rip+g4519], si
+  movsx rsi, word ptr [rip+g4510]
+  mov rax, rsi
+.L.return.u451:
+  ret
+.text
+.p2align 4
+.global u452
+u452:
+  movsx rsi, word ptr [rip+g3087]
+  add rsi, qword ptr [rip+g1476]
+  mov qword ptr [rip+g4520], rsi
+  movsx rsi, word ptr [rip+g731]
+  add rsi, qword ptr [rip+g2089]
+  mov word ptr [rip+g4521], si
+  movsxd rsi, dword ptr [rip+g3092]
+  movsxd rdi, dword ptr [rip+g1840]
+  add rsi, rdi
+  mov byte ptr [rip+g4522], sil
+  movsxd rsi, dword ptr [rip+g3406]
+  add rsi, qword ptr [rip+g4612]
+  mov dword ptr [rip+g4523], esi
+  movsx rsi, byte ptr [rip+g2623]
+  movsxd rdi, dword ptr [rip+g189]
+  add rsi, rdi
+  mov qword ptr [rip+g4524], rsi
+  movsxd rsi, dword ptr [rip+g455]
+  movsxd rdi, dword ptr [rip+g974]
+  add rsi, rdi
+  mov qword ptr [rip+g4525], rsi
+  mov rsi, qword ptr [rip+g2084]
+  add rsi, qword ptr [rip+g4481]
+  mov dword ptr [rip+g4526], esi
+  mov rsi, qword ptr [rip+g1575]
+  movsx rdi, byte ptr [rip+g3125]
+  add rsi, rdi
+  mov dword ptr [rip+g4527], esi
+  mov rsi, qword ptr [rip+g1507]
+  add rsi, qword ptr [rip+g2644]
+  mov qword ptr [rip+g4528], rsi
+  movsxd rsi, dword ptr [rip+g880]
+  movsx rdi, byte ptr [rip+g2505]
+  add rsi, rdi
+  mov byte ptr [rip+g4529], sil
+  mov rax, qword ptr [rip+g4520]
+.L.return.u452:
+  ret
+.text
+.p2align 4
+.global u453
+u453:
+  movsx rsi, word ptr [rip+g1356]
+  movsxd rdi, dword ptr [rip+g1442]
+  add rsi, rdi
+  mov byte ptr [rip+g4530], sil
+  mov rsi, qword ptr [rip+g81]
+  add rsi, qword ptr [rip+g831]
+  mov word ptr [rip+g4531], si
+  movsx rsi, byte ptr [rip+g1222]
+  movsx rdi, word ptr [rip+g2436]
+  add rsi, rdi
+  mov word ptr [rip+g4532], si
+  movsxd rsi, dword ptr [rip+g4743]
+  add rsi, qword ptr [rip+g2426]
+  mov qword ptr [rip+g4533], rsi
+  mov rsi, qword ptr [rip+g4187]
+  movsxd rdi, dword ptr [rip+g318]
+  add rsi, rdi
+  mov dword ptr [rip+g4534], esi
+  movsx rsi, byte ptr [rip+g2851]
+  movsx rdi, word ptr [rip+g495]
+  add rsi, rdi
+  mov qword ptr [rip+g4535], rsi
+  movsxd rsi, dword ptr [rip+g3655]
+  movsxd rdi, dword ptr [rip+g3723]
+  add rsi, rdi
+  mov qword ptr [rip+g4536], rsi
+  movsxd rsi, dword ptr [rip+g4632]
+  add rsi, qword ptr [rip+g606]
+  mov dword ptr [rip+g4537], esi
+  movsx rsi, byte ptr [rip+g1756]
+  add rsi, qword ptr [rip+g4581]
+  mov dword ptr [rip+g4538], esi
+  movsx rsi, byte ptr [rip+g2118]
+  movsxd rdi, dword ptr [rip+g2795]
+  add rsi, rdi
+  mov word ptr [rip+g4539], si
+  movsx rsi, byte ptr [rip+g4530]
+  mov rax, rsi
+.L.return.u453:
+  ret
+.text
+.p2align 4
+.global u454
+u454:
+  movsx rsi, byte ptr [rip+g540]
+  movsx rdi, byte ptr [rip+g3889]
+  add rsi, rdi
+  mov dword ptr [rip+g4540], esi
+  mov rsi, qword ptr [rip+g3969]
+  add rsi, qword ptr [rip+g1216]
+  mov dword ptr [rip+g4541], esi
+  movsxd rsi, dword ptr [rip+g944]
+  movsx rdi, byte ptr [rip+g1497]
+  add rsi, rdi
+  mov qword ptr [rip+g4542], rsi
+  mov rsi, qword ptr [rip+g4952]
+  movsx rdi, word ptr [rip+g494]
+  add rsi, rdi
+  mov qword ptr [rip+g4543], rsi
+  mov rsi, qword ptr [rip+g3849]
+  add rsi, qword ptr [rip+g4897]
+  mov word ptr [rip+g4544], si
+  movsx rsi, byte ptr [rip+g1866]
+  movsxd rdi, dword ptr [rip+g1832]
+  add rsi, rdi
+  mov qword ptr [rip+g4545], rsi
+  movsx rsi, word ptr [rip+g4874]
+  add rsi, qword ptr [rip+g709]
+  mov dword ptr [rip+g4546], esi
+  movsx rsi, word ptr [rip+g687]
+  movsx rdi, byte ptr [rip+g4206]
+  add rsi, rdi
+  mov byte ptr [rip+g4547], sil
+  movsx rsi, byte ptr [rip+g2909]
+  movsx rdi, byte ptr [rip+g632]
+  add rsi, rdi
+  mov word ptr [rip+g4548], si
+  movsxd rsi, dword ptr [rip+g1751]
+  movsxd rdi, dword ptr [rip+g4071]
+  add rsi, rdi
+  mov byte ptr [rip+g4549], sil
+  movsxd rsi, dword ptr [rip+g4540]
+  mov rax, rsi
+.L.return.u454:
+  ret
+.text
+.p2align 4
+.global u455
+u455:
+  mov rsi, qword ptr [rip+g794]
+  add rsi, qword ptr [rip+g301]
+  mov word ptr [rip+g4550], si
+  mov rsi, qword ptr [rip+g3147]
+  movsx rdi, word ptr [rip+g2117]
+  add rsi, rdi
+  mov dword ptr [rip+g4551], esi
+  movsx rsi, byte ptr [rip+g1123]
+  movsxd rdi, dword ptr [rip+g3898]
+  add rsi, rdi
+  mov word ptr [rip+g4552], si
+  mov rsi, qword ptr [rip+g2798]
+  add rsi, qword ptr [rip+g4289]
+  mov word ptr [rip+g4553], si
+  mov rsi, qword ptr [rip+g780]
+  add rsi, qword ptr [rip+g1615]
+  mov dword ptr [rip+g4554], esi
+  movsx rsi, word ptr [rip+g2651]
+  add rsi, qword ptr [rip+g3829]
+  mov byte ptr [rip+g4555], sil
+  movsx rsi, byte ptr [rip+g4989]
+  add rsi, qword ptr [rip+g3625]
+  mov byte ptr [rip+g4556], sil
+  mov rsi, qword ptr [rip+g2035]
+  add rsi, qword ptr [rip+g1723]
+  mov byte ptr [rip+g4557], sil
+  movsx rsi, byte ptr [rip+g2427]
+  movsx rdi, byte ptr [rip+g4360]
+  add rsi, rdi
+  mov byte ptr [rip+g4558], sil
+  movsx rsi, word ptr [rip+g2313]
+  movsxd rdi, dword ptr [rip+g4537]
+  add rsi, rdi
+  mov qword ptr [rip+g4559], rsi
+  movsx rsi, word ptr [rip+g4550]
+  mov rax, rsi
+.L.return.u455:
+  ret
+.text
+.p2align 4
+.global u456
+u456:
+  movsx rsi, word ptr [rip+g4942]
+  movsx rdi, word ptr [rip+g4103]
+  add rsi, rdi
+  mov qword ptr [rip+g4560], rsi
+  mov rsi, qword ptr [rip+g2018]
+  add rsi, qword ptr [rip+g4097]
+  mov word ptr [rip+g4561], si
+  mov rsi, qword ptr [rip+g4680]
+  movsxd rdi, dword ptr [rip+g4662]
+  add rsi, rdi
+  mov dword ptr [rip+g4562], esi
+  movsx rsi, word ptr [rip+g413]
+  add rsi, qword ptr [rip+g4416]
+  mov qword ptr [rip+g4563], rsi
+  movsx rsi, byte ptr [rip+g632]
+  movsxd rdi, dword ptr [rip+g2217]
+  add rsi, rdi
+  mov qword ptr [rip+g4564], rsi
+  movsxd rsi, dword ptr [rip+g3608]
+  movsx rdi, word ptr [rip+g4521]
+  add rsi, rdi
+  mov byte ptr [rip+g4565], sil
+  mov rsi, qword ptr [rip+g1849]
+  movsxd rdi, dword ptr [rip+g2806]
+  add rsi, rdi
+  mov word ptr [rip+g4566], si
+  movsx rsi, byte ptr [rip+g2536]
+  add rsi, qword ptr [rip+g351]
+  mov qword ptr [rip+g4567], rsi
+  movsx rsi, byte ptr [rip+g2293]
+  movsxd rdi, dword ptr [rip+g1665]
+  add rsi, rdi
+  mov byte ptr [rip+g4568], sil
+  movsx rsi, word ptr [rip+g2100]
+  movsx rdi, byte ptr [rip+g4266]
+  add rsi, rdi
+  mov qword ptr [rip+g4569], rsi
+  mov rax, qword ptr [rip+g4560]
+.L.return.u456:
+  ret
+.text
+.p2align 4
+.global u457
+u457:
+  movsx rsi, byte ptr [rip+g2778]
+  movsx rdi, word ptr [rip+g249]
+  add rsi, rdi
+  mov byte ptr [rip+g4570], sil
+  movsx rsi, word ptr [rip+g3533]
+  add rsi, qword ptr [rip+g1743]
+  mov qword ptr [rip+g4571], rsi
+  movsx rsi, byte ptr [rip+g3848]
+  movsx rdi, byte ptr [rip+g4703]
+  add rsi, rdi
+  mov byte ptr [rip+g4572], sil
+  movsx rsi, byte ptr [rip+g1020]
+  movsx rdi, word ptr [rip+g1206]
+  add rsi, rdi
+  mov qword ptr [rip+g4573], rsi
+  mov rsi, qword ptr [rip+g2430]
+  movsxd rdi, dword ptr [rip+g2921]
+  add rsi, rdi
+  mov dword ptr [rip+g4574], esi
+  mov rsi, qword ptr [rip+g3435]
+  movsx rdi, byte ptr [rip+g1555]
+  add rsi, rdi
+  mov dword ptr [rip+g4575], esi
+  movsx rsi, byte ptr [rip+g3454]
+  movsxd rdi, dword ptr [rip+g4664]
+  add rsi, rdi
+  mov word ptr [rip+g4576], si
+  movsx rsi, word ptr [rip+g1519]
+  movsx rdi, byte ptr [rip+g4517]
+  add rsi, rdi
+  mov word ptr [rip+g4577], si
+  mov rsi, qword ptr [rip+g1391]
+  movsxd rdi, dword ptr [rip+g4507]
+  add rsi, rdi
+  mov dword ptr [rip+g4578], esi
+  movsx rsi, word ptr [rip+g4909]
+  movsx rdi, word ptr [rip+g4142]
+  add rsi, rdi
+  mov qword ptr [rip+g4579], rsi
+  movsx rsi, byte ptr [rip+g4570]
+  mov rax, rsi
+.L.return.u457:
+  ret
+.text
+.p2align 4
+.global u458
+u458:
+  movsx rsi, word ptr [rip+g2370]
+  movsx rdi, byte ptr [rip+g2476]
+  add rsi, rdi
+  mov qword ptr [rip+g4580], rsi
+  movsx rsi, byte ptr [rip+g632]
+  movsx rdi, word ptr [rip+g806]
+  add rsi, rdi
+  mov qword ptr [rip+g4581], rsi
+  movsxd rsi, dword ptr [rip+g898]
+  movsx rdi, byte ptr [rip+g4503]
+  add rsi, rdi
+  mov byte ptr [rip+g4582], sil
+  mov rsi, qword ptr [rip+g4875]
+  movsx rdi, word ptr [rip+g125]
+  add rsi, rdi
+  mov word ptr [rip+g4583], si
+  mov rsi, qword ptr [rip+g4800]
+  movsx rdi, word ptr [rip+g3342]
+  add rsi, rdi
+  mov byte ptr [rip+g4584], sil
+  mov rsi, qword ptr [rip+g626]
+  movsx rdi, word ptr [rip+g2047]
+  add rsi, rdi
+  mov dword ptr [rip+g4585], esi
+  movsx rsi, word ptr [rip+g531]
+  movsx rdi, word ptr [rip+g4595]
+  add rsi, rdi
+  mov word ptr [rip+g4586], si
+  mov rsi, qword ptr [rip+g3784]
+  movsx rdi, word ptr [rip+g3942]
+  add rsi, rdi
+  mov dword ptr [rip+g4587], esi
+  movsx rsi, byte ptr [rip+g3744]
+  add rsi, qword ptr [rip+g845]
+  mov dword ptr [rip+g4588], esi
+  movsx rsi, word ptr [rip+g4423]
+  movsx rdi, byte ptr [rip+g2939]
+  add rsi, rdi
+  mov word ptr [rip+g4589], si
+  mov rax, qword ptr [rip+g4580]
+.L.return.u458:
+  ret
+.text
+.p2align 4
+.global u459
+u459:
+  mov rsi, qword ptr [rip+g2309]
+  movsxd rdi, dword ptr [rip+g2795]
+  add rsi, rdi
+  mov byte ptr [rip+g4590], sil
+  mov rsi, qword ptr [rip+g4897]
+  movsxd rdi, dword ptr [rip+g3614]
+  add rsi, rdi
+  mov dword ptr [rip+g4591], esi
+  mov rsi, qword ptr [rip+g1354]
+  movsxd rdi, dword ptr [rip+g2442]
+  add rsi, rdi
+  mov dword ptr [rip+g4592], esi
+  movsx rsi, byte ptr [rip+g290]
+  add rsi, qword ptr [rip+g4447]
+  mov dword ptr [rip+g4593], esi
+  movsxd rsi, dword ptr [rip+g1975]
+  movsx rdi, byte ptr [rip+g939]
+  add rsi, rdi
+  mov qword ptr [rip+g4594], rsi
+  mov rsi, qword ptr [rip+g507]
+  add rsi, qword ptr [rip+g3346]
+  mov word ptr [rip+g4595], si
+  movsx rsi, byte ptr [rip+g4936]
+  add rsi, qword ptr [rip+g4858]
+  mov byte ptr [rip+g4596], sil
+  movsx rsi, byte ptr [rip+g4706]
+  movsx rdi, byte ptr [rip+g527]
+  add rsi, rdi
+  mov dword ptr [rip+g4597], esi
+  movsx rsi, byte ptr [rip+g2763]
+  movsxd rdi, dword ptr [rip+g4442]
+  add rsi, rdi
+  mov word ptr [rip+g4598], si
+  movsx rsi, word ptr [rip+g512]
+  movsx rdi, byte ptr [rip+g3725]
+  add rsi, rdi
+  mov byte ptr [rip+g4599], sil
+  movsx rsi, byte ptr [rip+g4590]
+  mov rax, rsi
+.L.return.u459:
+  ret
+.text
+.p2align 4
+.global u460
+u460:
+  movsxd rsi, dword ptr [rip+g1096]
+  movsxd rdi, dword ptr [rip+g541]
+  add rsi, rdi
+  mov byte ptr [rip+g4600], sil
+  movsx rsi, byte ptr [rip+g27]
+  movsx rdi, byte ptr [rip+g391]
+  add rsi, rdi
+  mov byte ptr [rip+g4601], sil
+  movsx rsi, word ptr [rip+g3631]
+  movsx rdi, word ptr [rip+g1516]
+  add rsi, rdi
+  mov dword ptr [rip+g4602], esi
+  movsx rsi, word ptr [rip+g4624]
+  movsx rdi, word ptr [rip+g4531]
+  add rsi, rdi
+  mov byte ptr [rip+g4603], sil
+  movsx rsi, word ptr [rip+g165]
+  add rsi, qword ptr [rip+g66]
+  mov word ptr [rip+g4604], si
+  movsxd rsi, dword ptr [rip+g1669]
+  add rsi, qword ptr [rip+g3819]
+  mov byte ptr [rip+g4605], sil
+  movsx rsi, word ptr [rip+g589]
+  movsxd rdi, dword ptr [rip+g340]
+  add rsi, rdi
+  mov byte ptr [rip+g4606], sil
+  movsxd rsi, dword ptr [rip+g4126]
+  movsxd rdi, dword ptr [rip+g3210]
+  add rsi, rdi
+  mov qword ptr [rip+g4607], rsi
+  mov rsi, qword ptr [rip+g1964]
+  add rsi, qword ptr [rip+g3227]
+  mov byte ptr [rip+g4608], sil
+  movsx rsi, byte ptr [rip+g1668]
+  add rsi, qword ptr [rip+g3471]
+  mov word ptr [rip+g4609], si
+  movsx rsi, byte ptr [rip+g4600]
+  mov rax, rsi
+.L.return.u460:
+  ret
+.text
+.p2align 4
+.global u461
+u461:
+  movsx rsi, byte ptr [rip+g97]
+  add rsi, qword ptr [rip+g646]
+  mov qword ptr [rip+g4610], rsi
+  movsx rsi, word ptr [rip+g1540]
+  movsx rdi, word ptr [rip+g3942]
+  add rsi, rdi
+  mov qword ptr [rip+g4611], rsi
+  movsx rsi, byte ptr [rip+g1217]
+  add rsi, qword ptr [rip+g1109]
+  mov qword ptr [rip+g4612], rsi
+  mov rsi, qword ptr [rip+g593]
+  movsx rdi, word ptr [rip+g1645]
+  add rsi, rdi
+  mov qword ptr [rip+g4613], rsi
+  movsx rsi, byte ptr [rip+g1592]
+  add rsi, qword ptr [rip+g1673]
+  mov qword ptr [rip+g4614], rsi
+  movsx rsi, word ptr [rip+g2056]
+  movsx rdi, word ptr [rip+g2267]
+  add rsi, rdi
+  mov qword ptr [rip+g4615], rsi
+  movsx rsi, byte ptr [rip+g2492]
+  add rsi, qword ptr [rip+g1394]
+  mov dword ptr [rip+g4616], esi
+  mov rsi, qword ptr [rip+g3389]
+  add rsi, qword ptr [rip+g378]
+  mov word ptr [rip+g4617], si
+  mov rsi, qword ptr [rip+g4845]
+  movsx rdi, word ptr [rip+g3164]
+  add rsi, rdi
+  mov qword ptr [rip+g4618], rsi
+  movsx rsi, word ptr [rip+g336]
+  add rsi, qword ptr [rip+g4416]
+  mov qword ptr [rip+g4619], rsi
+  mov rax, qword ptr [rip+g4610]
+.L.return.u461:
+  ret
+.text
+.p2align 4
+.global u462
+u462:
+  movsx rsi, byte ptr [rip+g273]
+  movsx rdi, word ptr [rip+g3045]
+  add rsi, rdi
+  mov dword ptr [rip+g4620], esi
+  movsx rsi, word ptr [rip+g637]
+  movsx rdi, word ptr [rip+g2900]
+  add rsi, rdi
+  mov byte ptr [rip+g4621], sil
+  movsx rsi, byte ptr [rip+g1742]
+  movsxd rdi, dword ptr [rip+g1488]
+  add rsi, rdi
+  mov dword ptr [rip+g4622], esi
+  movsx rsi, byte ptr [rip+g15]
+  movsxd rdi, dword ptr [rip+g3888]
+  add rsi, rdi
+  mov qword ptr [rip+g4623], rsi
+  mov rsi, qword ptr [rip+g1575]
+  add rsi, qword ptr [rip+g138]
+  mov word ptr [rip+g4624], si
+  movsx rsi, word ptr [rip+g1601]
+  movsx rdi, byte ptr [rip+g4323]
+  add rsi, rdi
+  mov byte ptr [rip+g4625], sil
+  movsx rsi, word ptr [rip+g710]
+  movsxd rdi, dword ptr [rip+g1679]
+  add rsi, rdi
+  mov word ptr [rip+g4626], si
+  movsx rsi, word ptr [rip+g94]
+  movsxd rdi, dword ptr [rip+g2874]
+  add rsi, rdi
+  mov byte ptr [rip+g4627], sil
+  movsx rsi, byte ptr [rip+g2778]
+  movsx rdi, word ptr [rip+g94]
+  add rsi, rdi
+  mov byte ptr [rip+g4628], sil
+  movsx rsi, byte ptr [rip+g4322]
+  movsx rdi, byte ptr [rip+g2777]
+  add rsi, rdi
+  mov byte ptr [rip+g4629], sil
+  movsxd rsi, dword ptr [rip+g4620]
+  mov rax, rsi
+.L.return.u462:
+  ret
+.text
+.p2align 4
+.global u463
+u463:
+  movsxd rsi, dword ptr [rip+g4314]
+  movsx rdi, word ptr [rip+g252]
+  add rsi, rdi
+  mov dword ptr [rip+g4630], esi
+  movsx rsi, byte ptr [rip+g4705]
+  movsxd rdi, dword ptr [rip+g2821]
+  add rsi, rdi
+  mov dword ptr [rip+g4631], esi
+  movsx rsi, byte ptr [rip+g1046]
+  add rsi, qword ptr [rip+g1394]
+  mov dword ptr [rip+g4632], esi
+  movsx rsi, word ptr [rip+g1584]
+  movsxd rdi, dword ptr [rip+g3369]
+  add rsi, rdi
+  mov qword ptr [rip+g4633], rsi
+  movsxd rsi, dword ptr [rip+g419]
+  movsx rdi, word ptr [rip+g1466]
+  add rsi, rdi
+  mov word ptr [rip+g4634], si
+  movsxd rsi, dword ptr [rip+g1107]
+  movsx rdi, byte ptr [rip+g4167]
+  add rsi, rdi
+  mov word ptr [rip+g4635], si
+  movsxd rsi, dword ptr [rip+g1790]
+  movsx rdi, word ptr [rip+g519]
+  add rsi, rdi
+  mov dword ptr [rip+g4636], esi
+  movsx rsi, word ptr [rip+g4750]
+  movsx rdi, word ptr [rip+g1912]
+  add rsi, rdi
+  mov word ptr [rip+g4637], si
+  movsxd rsi, dword ptr [rip+g4630]
+  movsxd rdi, dword ptr [rip+g4165]
+  add rsi, rdi
+  mov byte ptr [rip+g4638], sil
+  mov rsi, qword ptr [rip+g2105]
+  movsx rdi, byte ptr [rip+g1062]
+  add rsi, rdi
+  mov qword ptr [rip+g4639], rsi
+  movsxd rsi, dword ptr [rip+g4630]
+  mov rax, rsi
+.L.return.u463:
+  ret
+.text
+.p2align 4
+.global u464
+u464:
+  movsx rsi, byte ptr [rip+g1303]
+  add rsi, qword ptr [rip+g3540]
+  mov byte ptr [rip+g4640], sil
+  mov rsi, qword ptr [rip+g2309]
+  movsx rdi, word ptr [rip+g4718]
+  add rsi, rdi
+  mov dword ptr [rip+g4641], esi
+  movsx rsi, byte ptr [rip+g3687]
+  add rsi, qword ptr [rip+g2638]
+  mov byte ptr [rip+g4642], sil
+  movsx rsi, word ptr [rip+g3445]
+  add rsi, qword ptr [rip+g2958]
+  mov word ptr [rip+g4643], si
+  mov rsi, qword ptr [rip+g4065]
+  movsx rdi, byte ptr [rip+g1983]
+  add rsi, rdi
+  mov word ptr [rip+g4644], si
+  mov rsi, qword ptr [rip+g4154]
+  movsx rdi, word ptr [rip+g212]
+  add rsi, rdi
+  mov byte ptr [rip+g4645], sil
+  movsxd rsi, dword ptr [rip+g2064]
+  movsxd rdi, dword ptr [rip+g4227]
+  add rsi, rdi
+  mov dword ptr [rip+g4646], esi
+  movsx rsi, byte ptr [rip+g1190]
+  movsxd rdi, dword ptr [rip+g231]
+  add rsi, rdi
+  mov qword ptr [rip+g4647], rsi
+  movsx rsi, word ptr [rip+g3605]
+  movsxd rdi, dword ptr [rip+g1842]
+  add rsi, rdi
+  mov byte ptr [rip+g4648], sil
+  movsx rsi, byte ptr [rip+g2674]
+  movsxd rdi, dword ptr [rip+g1944]
+  add rsi, rdi
+  mov byte ptr [rip+g4649], sil
+  movsx rsi, byte ptr [rip+g4640]
+  mov rax, rsi
+.L.return.u464:
+  ret
+.text
+.p2align 4
+.global u465
+u465:
+  movsx rsi, byte ptr [rip+g3967]
+  movsx rdi, word ptr [rip+g631]
+  add rsi, rdi
+  mov dword ptr [rip+g4650], esi
+  movsx rsi, word ptr [rip+g2936]
+  movsx rdi, word ptr [rip+g3045]
+  add rsi, rdi
+  mov qword ptr [rip+g4651], rsi
+  movsx rsi, byte ptr [rip+g1303]
+  movsxd rdi, dword ptr [rip+g136]
+  add rsi, rdi
+  mov qword ptr [rip+g4652], rsi
+  movsx rsi, byte ptr [rip+g2599]
+  movsxd rdi, dword ptr [rip+g3573]
+  add rsi, rdi
+  mov byte ptr [rip+g4653], sil
+  movsxd rsi, dword ptr [rip+g4047]
+  movsx rdi, byte ptr [rip+g4127]
+  add rsi, rdi
+  mov qword ptr [rip+g4654], rsi
+  movsx rsi, byte ptr [rip+g3778]
+  add rsi, qword ptr [rip+g4070]
+  mov byte ptr [rip+g4655], sil
+  movsxd rsi, dword ptr [rip+g3909]
+  movsx rdi, byte ptr [rip+g4715]
+  add rsi, rdi
+  mov byte ptr [rip+g4656], sil
+  movsx rsi, word ptr [rip+g3658]
+  movsxd rdi, dword ptr [rip+g2995]
+  add rsi, rdi
+  mov word ptr [rip+g4657], si
+  movsxd rsi, dword ptr [rip+g3299]
+  movsxd rdi, dword ptr [rip+g2878]
+  add rsi, rdi
+  mov word ptr [rip+g4658], si
+  movsx rsi, byte ptr [rip+g2212]
+  add rsi, qword ptr [rip+g2361]
+  mov byte ptr [rip+g4659], sil
+  movsxd rsi, dword ptr [rip+g4650]
+  mov rax, rsi
+.L.return.u465:
+  ret
+.text
+.p2align 4
+.global u466
+u466:
+  mov rsi, qword ptr [rip+g427]
+  movsx rdi, byte ptr [rip+g3111]
+  add rsi, rdi
+  mov word ptr [rip+g4660], si
+  movsx rsi, byte ptr [rip+g4754]
+  movsx rdi, word ptr [rip+g807]
+  add rsi, rdi
+  mov dword ptr [rip+g4661], esi
+  movsx rsi, byte ptr [rip+g4884]
+  movsx rdi, word ptr [rip+g4760]
+  add rsi, rdi
+  mov dword ptr [rip+g4662], esi
+  movsx rsi, byte ptr [rip+g4044]
+  add rsi, qword ptr [rip+g3697]
+  mov byte ptr [rip+g4663], sil
+  movsxd rsi, dword ptr [rip+g340]
+  add rsi, qword ptr [rip+g1025]
+  mov dword ptr [rip+g4664], esi
+  mov rsi, qword ptr [rip+g1025]
+  add rsi, qword ptr [rip+g4998]
+  mov word ptr [rip+g4665], si
+  movsx rsi, byte ptr [rip+g4936]
+  movsx rdi, word ptr [rip+g1955]
+  add rsi, rdi
+  mov byte ptr [rip+g4666], sil
+  movsx rsi, byte ptr [rip+g3661]
+  movsx rdi, byte ptr [rip+g4989]
+  add rsi, rdi
+  mov word ptr [rip+g4667], si
+  movsxd rsi, dword ptr [rip+g3994]
+  add rsi, qword ptr [rip+g2430]
+  mov word ptr [rip+g4668], si
+  movsxd rsi, dword ptr [rip+g3214]
+  movsx rdi, byte ptr [rip+g871]
+  add rsi, rdi
+  mov byte ptr [rip+g4669], sil
+  movsx rsi, word ptr [rip+g4660]
+  mov rax, rsi
+.L.return.u466:
+  ret
+.text
+.p2align 4
+.global u467
+u467:
+  mov rsi, qword ptr [rip+g2146]
+  movsx rdi, word ptr [rip+g3262]
+  add rsi, rdi
+  mov byte ptr [rip+g4670], sil
+  movsxd rsi, dword ptr [rip+g4848]
+  movsx rdi, byte ptr [rip+g2674]
+  add rsi, rdi
+  mov qword ptr [rip+g4671], rsi
+  movsx rsi, word ptr [rip+g2749]
+  movsx rdi, word ptr [rip+g114]
+  add rsi, rdi
+  mov dword ptr [rip+g4672], esi
+  movsx rsi, byte ptr [rip+g4195]
+  movsxd rdi, dword ptr [rip+g4956]
+  add rsi, rdi
+  mov word ptr [rip+g4673], si
+  mov rsi, qword ptr [rip+g440]
+  movsx rdi, byte ptr [rip+g756]
+  add rsi, rdi
+  mov dword ptr [rip+g4674], esi
+  movsx rsi, byte ptr [rip+g2114]
+  movsxd rdi, dword ptr [rip+g2921]
+  add rsi, rdi
+  mov word ptr [rip+g4675], si
+  movsx rsi, byte ptr [rip+g4262]
+  movsx rdi, byte ptr [rip+g3468]
+  add rsi, rdi
+  mov byte ptr [rip+g4676], sil
+  movsx rsi, byte ptr [rip+g1527]
+  movsx rdi, byte ptr [rip+g4153]
+  add rsi, rdi
+  mov dword ptr [rip+g4677], esi
+  movsx rsi, byte ptr [rip+g4926]
+  movsxd rdi, dword ptr [rip+g529]
+  add rsi, rdi
+  mov dword ptr [rip+g4678], esi
+  movsx rsi, word ptr [rip+g3718]
+  movsx rdi, byte ptr [rip+g1306]
+  add rsi, rdi
+  mov qword ptr [rip+g4679], rsi
+  movsx rsi, byte ptr [rip+g4670]
+  mov rax, rsi
+.L.return.u467:
+  ret
+.text
+.p2align 4
+.global u468
+u468:
+  movsx rsi, byte ptr [rip+g2295]
+  movsx rdi, byte ptr [rip+g2157]
+  add rsi, rdi
+  mov qword ptr [rip+g4680], rsi
+  movsxd rsi, dword ptr [rip+g1264]
+  movsx rdi, byte ptr [rip+g1872]
+  add rsi, rdi
+  mov qword ptr [rip+g4681], rsi
+  mov rsi, qword ptr [rip+g440]
+  movsx rdi, byte ptr [rip+g2595]
+  add rsi, rdi
+  mov qword ptr [rip+g4682], rsi
+  movsxd rsi, dword ptr [rip+g664]
+  movsx rdi, byte ptr [rip+g1772]
+  add rsi, rdi
+  mov dword ptr [rip+g4683], esi
+  movsx rsi, word ptr [rip+g1290]
+  add rsi, qword ptr [rip+g2528]
+  mov byte ptr [rip+g4684], sil
+  movsxd rsi, dword ptr [rip+g4903]
+  movsx rdi, word ptr [rip+g619]
+  add rsi, rdi
+  mov dword ptr [rip+g4685], esi
+  mov rsi, qword ptr [rip+g310]
+  movsx rdi, word ptr [rip+g2970]
+  add rsi, rdi
+  mov qword ptr [rip+g4686], rsi
+  movsx rsi, word ptr [rip+g1638]
+  movsx rdi, word ptr [rip+g1889]
+  add rsi, rdi
+  mov word ptr [rip+g4687], si
+  mov rsi, qword ptr [rip+g1958]
+  add rsi, qword ptr [rip+g2577]
+  mov dword ptr [rip+g4688], esi
+  movsx rsi, byte ptr [rip+g4430]
+  add rsi, qword ptr [rip+g1118]
+  mov qword ptr [rip+g4689], rsi
+  mov rax, qword ptr [rip+g4680]
+.L.return.u468:
+  ret
+.text
+.p2align 4
+.global u469
+u469:
+  movsx rsi, word ptr [rip+g2215]
+  movsxd rdi, dword ptr [rip+g3288]
+  add rsi, rdi
+  mov byte ptr [rip+g4690], sil
+  movsx rsi, word ptr [rip+g445]
+  add rsi, qword ptr [rip+g3158]
+  mov dword ptr [rip+g4691], esi
+  movsxd rsi, dword ptr [rip+g2228]
+  movsx rdi, word ptr [rip+g3140]
+  add rsi, rdi
+  mov byte ptr [rip+g4692], sil
+  movsx rsi, word ptr [rip+g2418]
+  add rsi, qword ptr [rip+g2465]
+  mov word ptr [rip+g4693], si
+  mov rsi, qword ptr [rip+g3680]
+  movsxd rdi, dword ptr [rip+g3420]
+  add rsi, rdi
+  mov byte ptr [rip+g4694], sil
+  movsx rsi, byte ptr [rip+g1548]
+  movsx rdi, word ptr [rip+g3746]
+  add rsi, rdi
+  mov word ptr [rip+g4695], si
+  mov rsi, qword ptr [rip+g1936]
+  movsxd rdi, dword ptr [rip+g4987]
+  add rsi, rdi
+  mov qword ptr [rip+g4696], rsi
+  movsx rsi, byte ptr [rip+g1713]
+  movsxd rdi, dword ptr [rip+g1600]
+  add rsi, rdi
+  mov word ptr [rip+g4697], si
+  movsx rsi, word ptr [rip+g3683]
+  movsxd rdi, dword ptr [rip+g2334]
+  add rsi, rdi
+  mov word ptr [rip+g4698], si
+  movsx rsi, byte ptr [rip+g3864]
+  movsx rdi, word ptr [rip+g239]
+  add rsi, rdi
+  mov byte ptr [rip+g4699], sil
+  movsx rsi, byte ptr [rip+g4690]
+  mov rax, rsi
+.L.return.u469:
+  ret
+.text
+.p2align 4
+.global u470
+u470:
+  movsx rsi, word ptr [rip+g4142]
+  movsx rdi, word ptr [rip+g1380]
+  add rsi, rdi
+  mov byte ptr [rip+g4700], sil
+  mov rsi, qword ptr [rip+g1216]
+  add rsi, qword ptr [rip+g2739]
+  mov byte ptr [rip+g4701], sil
+  movsxd rsi, dword ptr [rip+g2621]
+  add rsi, qword ptr [rip+g250]
+  mov byte ptr [rip+g4702], sil
+  movsx rsi, word ptr [rip+g2257]
+  add rsi, qword ptr [rip+g2396]
+  mov byte ptr [rip+g4703], sil
+  movsx rsi, byte ptr [rip+g872]
+  movsx rdi, byte ptr [rip+g2132]
+  add rsi, rdi
+  mov byte ptr [rip+g4704], sil
+  movsxd rsi, dword ptr [rip+g506]
+  movsxd rdi, dword ptr [rip+g4063]
+  add rsi, rdi
+  mov byte ptr [rip+g4705], sil
+  movsxd rsi, dword ptr [rip+g1375]
+  movsx rdi, byte ptr [rip+g2037]
+  add rsi, rdi
+  mov byte ptr [rip+g4706], sil
+  movsx rsi, byte ptr [rip+g3384]
+  movsx rdi, word ptr [rip+g3004]
+  add rsi, rdi
+  mov byte ptr [rip+g4707], sil
+  movsxd rsi, dword ptr [rip+g1328]
+  add rsi, qword ptr [rip+g3959]
+  mov word ptr [rip+g4708], si
+  mov rsi, qword ptr [rip+g946]
+  add rsi, qword ptr [rip+g2516]
+  mov qword ptr [rip+g4709], rsi
+  movsx rsi, byte ptr [rip+g4700]
+  mov rax, rsi
+.L.return.u470:
+  ret
+.text
+.p2align 4
+.global u471
+u471:
+  mov rsi, qword ptr [rip+g4719]
+  movsx rdi, byte ptr [rip+g109]
+  add rsi, rdi
+  mov qword ptr [rip+g4710], rsi
+  mov rsi, qword ptr [rip+g2587]
+  add rsi, qword ptr [rip+g536]
+  mov word ptr [rip+g4711], si
+  movsx rsi, byte ptr [rip+g1496]
+  add rsi, qword ptr [rip+g2723]
+  mov word ptr [rip+g4712], si
+  mov rsi, qword ptr [rip+g1179]
+  movsx rdi, byte ptr [rip+g2184]
+  add rsi, rdi
+  mov qword ptr [rip+g4713], rsi
+  movsx rsi, byte ptr [rip+g3465]
+  movsx rdi, word ptr [rip+g2306]
+  add rsi, rdi
+  mov word ptr [rip+g4714], si
+  movsx rsi, word ptr [rip+g4644]
+  add rsi, qword ptr [rip+g321]
+  mov byte ptr [rip+g4715], sil
+  movsxd rsi, dword ptr [rip+g49]
+  movsx rdi, word ptr [rip+g1011]
+  add rsi, rdi
+  mov byte ptr [rip+g4716], sil
+  mov rsi, qword ptr [rip+g353]
+  movsxd rdi, dword ptr [rip+g1701]
+  add rsi, rdi
+  mov byte ptr [rip+g4717], sil
+  movsx rsi, byte ptr [rip+g2727]
+  movsx rdi, word ptr [rip+g1681]
+  add rsi, rdi
+  mov word ptr [rip+g4718], si
+  movsx rsi, word ptr [rip+g1814]
+  add rsi, qword ptr [rip+g3891]
+  mov qword ptr [rip+g4719], rsi
+  mov rax, qword ptr [rip+g4710]
+.L.return.u471:
+  ret
+.text
+.p2align 4
+.global u472
+u472:
+  movsx rsi, word ptr [rip+g2024]
+  movsx rdi, byte ptr [rip+g639]
+  add rsi, rdi
+  mov qword ptr [rip+g4720], rsi
+  movsx rsi, word ptr [rip+g4561]
+  movsx rdi, word ptr [rip+g1689]
+  add rsi, rdi
+  mov byte ptr [rip+g4721], sil
+  movsx rsi, word ptr [rip+g4819]
+  movsxd rdi, dword ptr [rip+g3645]
+  add rsi, rdi
+  mov word ptr [rip+g4722], si
+  mov rsi, qword ptr [rip+g1283]
+  movsxd rdi, dword ptr [rip+g599]
+  add rsi, rdi
+  mov qword ptr [rip+g4723], rsi
+  movsx rsi, byte ptr [rip+g1947]
+  movsx rdi, word ptr [rip+g4245]
+  add rsi, rdi
+  mov qword ptr [rip+g4724], rsi
+  movsxd rsi, dword ptr [rip+g732]
+  movsx rdi, byte ptr [rip+g1222]
+  add rsi, rdi
+  mov word ptr [rip+g4725], si
+  movsx rsi, word ptr [rip+g847]
+  movsx rdi, byte ptr [rip+g3086]
+  add rsi, rdi
+  mov dword ptr [rip+g4726], esi
+  movsx rsi, word ptr [rip+g4760]
+  movsx rdi, word ptr [rip+g429]
+  add rsi, rdi
+  mov word ptr [rip+g4727], si
+  mov rsi, qword ptr [rip+g653]
+  add rsi, qword ptr [rip+g4775]
+  mov qword ptr [rip+g4728], rsi
+  mov rsi, qword ptr [rip+g659]
+  movsx rdi, byte ptr [rip+g591]
+  add rsi, rdi
+  mov qword ptr [rip+g4729], rsi
+  mov rax, qword ptr [rip+g4720]
+.L.return.u472:
+  ret
+.text
+.p2align 4
+.global u473
+u473:
+  mov rsi, qword ptr [rip+g2456]
+  add rsi, qword ptr [rip+g1150]
+  mov byte ptr [rip+g4730], sil
+  movsx rsi, byte ptr [rip+g2768]
+  movsxd rdi, dword ptr [rip+g134]
+  add rsi, rdi
+  mov qword ptr [rip+g4731], rsi
+  movsxd rsi, dword ptr [rip+g3663]
+  add rsi, qword ptr [rip+g566]
+  mov word ptr [rip+g4732], si
+  movsxd rsi, dword ptr [rip+g3474]
+  movsx rdi, word ptr [rip+g3022]
+  add rsi, rdi
+  mov byte ptr [rip+g4733], sil
+  movsxd rsi, dword ptr [rip+g1746]
+  add rsi, qword ptr [rip+g3038]
+  mov qword ptr [rip+g4734], rsi
+  movsx rsi, byte ptr [rip+g1605]
+  movsx rdi, word ptr [rip+g2988]
+  add rsi, rdi
+  mov dword ptr [rip+g4735], esi
+  movsx rsi, byte ptr [rip+g2717]
+  movsx rdi, word ptr [rip+g2274]
+  add rsi, rdi
+  mov word ptr [rip+g4736], si
+  movsx rsi, word ptr [rip+g2140]
+  movsx rdi, byte ptr [rip+g3546]
+  add rsi, rdi
+  mov dword ptr [rip+g4737], esi
+  movsxd rsi, dword ptr [rip+g669]
+  add rsi, qword ptr [rip+g1445]
+  mov byte ptr [rip+g4738], sil
+  mov rsi, qword ptr [rip+g1432]
+  add rsi, qword ptr [rip+g1859]
+  mov qword ptr [rip+g4739], rsi
+  movsx rsi, byte ptr [rip+g4730]
+  mov rax, rsi
+.L.return.u473:
+  ret
+.text
+.p2align 4
+.global u474
+u474:
+  mov rsi, qword ptr [rip+g3281]
+  add rsi, qword ptr [rip+g2038]
+  mov byte ptr [rip+g4740], sil
+  movsx rsi, byte ptr [rip+g119]
+  movsx rdi, byte ptr [rip+g685]
+  add rsi, rdi
+  mov dword ptr [rip+g4741], esi
+  mov rsi, qword ptr [rip+g2523]
+  movsx rdi, byte ptr [rip+g1470]
+  add rsi, rdi
+  mov word ptr [rip+g4742], si
+  movsxd rsi, dword ptr [rip+g3898]
+  add rsi, qword ptr [rip+g509]
+  mov dword ptr [rip+g4743], esi
+  movsxd rsi, dword ptr [rip+g4460]
+  movsx rdi, byte ptr [rip+g2476]
+  add rsi, rdi
+  mov word ptr [rip+g4744], si
+  mov rsi, qword ptr [rip+g1859]
+  movsx rdi, byte ptr [rip+g3512]
+  add rsi, rdi
+  mov qword ptr [rip+g4745], rsi
+  movsx rsi, word ptr [rip+g3692]
+  add rsi, qword ptr [rip+g3580]
+  mov byte ptr [rip+g4746], sil
+  movsxd rsi, dword ptr [rip+g865]
+  movsx rdi, word ptr [rip+g888]
+  add rsi, rdi
+  mov word ptr [rip+g4747], si
+  mov rsi, qword ptr [rip+g2387]
+  movsxd rdi, dword ptr [rip+g2879]
+  add rsi, rdi
+  mov byte ptr [rip+g4748], sil
+  movsx rsi, byte ptr [rip+g1250]
+  movsx rdi, byte ptr [rip+g3761]
+  add rsi, rdi
+  mov dword ptr [rip+g4749], esi
+  movsx rsi, byte ptr [rip+g4740]
+  mov rax, rsi
+.L.return.u474:
+  ret
+.text
+.p2align 4
+.global u475
+u475:
+  movsx rsi, word ptr [rip+g4900]
+  movsxd rdi, dword ptr [rip+g936]
+  add rsi, rdi
+  mov word ptr [rip+g4750], si
+  movsx rsi, byte ptr [rip+g2902]
+  movsxd rdi, dword ptr [rip+g1834]
+  add rsi, rdi
+  mov qword ptr [rip+g4751], rsi
+  movsx rsi, word ptr [rip+g3068]
+  movsx rdi, byte ptr [rip+g3967]
+  add rsi, rdi
+  mov qword ptr [rip+g4752], rsi
+  mov rsi, qword ptr [rip+g1735]
+  movsx rdi, word ptr [rip+g405]
+  add rsi, rdi
+  mov qword ptr [rip+g4753], rsi
+  movsxd rsi, dword ptr [rip+g4541]
+  add rsi, qword ptr [rip+g900]
+  mov byte ptr [rip+g4754], sil
+  movsxd rsi, dword ptr [rip+g4403]
+  movsx rdi, word ptr [rip+g3120]
+  add rsi, rdi
+  mov word ptr [rip+g4755], si
+  movsxd rsi, dword ptr [rip+g903]
+  movsx rdi, word ptr [rip+g3751]
+  add rsi, rdi
+  mov qword ptr [rip+g4756], rsi
+  mov rsi, qword ptr [rip+g2489]
+  add rsi, qword ptr [rip+g5]
+  mov byte ptr [rip+g4757], sil
+  movsxd rsi, dword ptr [rip+g1009]
+  add rsi, qword ptr [rip+g476]
+  mov word ptr [rip+g4758], si
+  movsxd rsi, dword ptr [rip+g1439]
+  movsxd rdi, dword ptr [rip+g2713]
+  add rsi, rdi
+  mov byte ptr [rip+g4759], sil
+  movsx rsi, word ptr [rip+g4750]
+  mov rax, rsi
+.L.return.u475:
+  ret
+.text
+.p2align 4
+.global u476
+u476:
+  movsx rsi, word ptr [rip+g152]
+  add rsi, qword ptr [rip+g2516]
+  mov word ptr [rip+g4760], si
+  movsx rsi, byte ptr [rip+g2728]
+  movsx rdi, word ptr [rip+g445]
+  add rsi, rdi
+  mov dword ptr [rip+g4761], esi
+  movsx rsi, word ptr [rip+g471]
+  add rsi, qword ptr [rip+g4283]
+  mov word ptr [rip+g4762], si
+  movsx rsi, word ptr [rip+g2307]
+  movsx rdi, word ptr [rip+g1847]
+  add rsi, rdi
+  mov dword ptr [rip+g4763], esi
+  mov rsi, qword ptr [rip+g64]
+  add rsi, qword ptr [rip+g40]
+  mov dword ptr [rip+g4764], esi
+  mov rsi, qword ptr [rip+g4171]
+  add rsi, qword ptr [rip+g3739]
+  mov word ptr [rip+g4765], si
+  movsx rsi, word ptr [rip+g930]
+  movsx rdi, word ptr [rip+g72]
+  add rsi, rdi
+  mov byte ptr [rip+g4766], sil
+  movsx rsi, byte ptr [rip+g4167]
+  movsx rdi, word ptr [rip+g3244]
+  add rsi, rdi
+  mov word ptr [rip+g4767], si
+  movsxd rsi, dword ptr [rip+g3926]
+  movsx rdi, word ptr [rip+g4784]
+  add rsi, rdi
+  mov dword ptr [rip+g4768], esi
+  movsxd rsi, dword ptr [rip+g3958]
+  movsxd rdi, dword ptr [rip+g3036]
+  add rsi, rdi
+  mov qword ptr [rip+g4769], rsi
+  movsx rsi, word ptr [rip+g4760]
+  mov rax, rsi
+.L.return.u476:
+  ret
+.text
+.p2align 4
+.global u477
+u477:
+  mov rsi, qword ptr [rip+g686]
+  movsxd rdi, dword ptr [rip+g2648]
+  add rsi, rdi
+  mov dword ptr [rip+g4770], esi
+  movsxd rsi, dword ptr [rip+g1931]
+  movsx rdi, byte ptr [rip+g210]
+  add rsi, rdi
+  mov byte ptr [rip+g4771], sil
+  movsx rsi, word ptr [rip+g2999]
+  movsx rdi, word ptr [rip+g4474]
+  add rsi, rdi
+  mov dword ptr [rip+g4772], esi
+  movsx rsi, word ptr [rip+g2531]
+  movsx rdi, byte ptr [rip+g3908]
+  add rsi, rdi
+  mov qword ptr [rip+g4773], rsi
+  movsx rsi, word ptr [rip+g3795]
+  movsx rdi, byte ptr [rip+g1175]
+  add rsi, rdi
+  mov word ptr [rip+g4774], si
+  mov rsi, qword ptr [rip+g746]
+  movsx rdi, byte ptr [rip+g2075]
+  add rsi, rdi
+  mov qword ptr [rip+g4775], rsi
+  movsxd rsi, dword ptr [rip+g1439]
+  add rsi, qword ptr [rip+g526]
+  mov qword ptr [rip+g4776], rsi
+  movsxd rsi, dword ptr [rip+g4415]
+  movsx rdi, word ptr [rip+g4205]
+  add rsi, rdi
+  mov word ptr [rip+g4777], si
+  movsx rsi, word ptr [rip+g3605]
+  movsx rdi, byte ptr [rip+g781]
+  add rsi, rdi
+  mov qword ptr [rip+g4778], rsi
+  movsxd rsi, dword ptr [rip+g1343]
+  movsx rdi, word ptr [rip+g2378]
+  add rsi, rdi
+  mov dword ptr [rip+g4779], esi
+  movsxd rsi, dword ptr [rip+g4770]
+  mov rax, rsi
+.L.return.u477:
+  ret
+.text
+.p2align 4
+.global u478
+u478:
+  movsx rsi, word ptr [rip+g4372]
+  movsx rdi, word ptr [rip+g2866]
+  add rsi, rdi
+  mov word ptr [rip+g4780], si
+  movsx rsi, word ptr [rip+g188]
+  movsx rdi, byte ptr [rip+g871]
+  add rsi, rdi
+  mov byte ptr [rip+g4781], sil
+  movsx rsi, word ptr [rip+g381]
+  add rsi, qword ptr [rip+g179]
+  mov byte ptr [rip+g4782], sil
+  movsx rsi, word ptr [rip+g3268]
+  movsx rdi, byte ptr [rip+g862]
+  add rsi, rdi
+  mov dword ptr [rip+g4783], esi
+  movsx rsi, byte ptr [rip+g4167]
+  movsxd rdi, dword ptr [rip+g3569]
+  add rsi, rdi
+  mov word ptr [rip+g4784], si
+  movsx rsi, byte ptr [rip+g2132]
+  movsx rdi, word ptr [rip+g1511]
+  add rsi, rdi
+  mov byte ptr [rip+g4785], sil
+  movsxd rsi, dword ptr [rip+g240]
+  movsxd rdi, dword ptr [rip+g3394]
+  add rsi, rdi
+  mov dword ptr [rip+g4786], esi
+  movsx rsi, word ptr [rip+g1980]
+  movsxd rdi, dword ptr [rip+g3505]
+  add rsi, rdi
+  mov dword ptr [rip+g4787], esi
+  movsxd rsi, dword ptr [rip+g4453]
+  add rsi, qword ptr [rip+g1657]
+  mov byte ptr [rip+g4788], sil
+  mov rsi, qword ptr [rip+g2566]
+  add rsi, qword ptr [rip+g310]
+  mov byte ptr [rip+g4789], sil
+  movsx rsi, word ptr [rip+g4780]
+  mov rax, rsi
+.L.return.u478:
+  ret
+.text
+.p2align 4
+.global u479
+u479:
+  movsxd rsi, dword ptr [rip+g3332]
+  movsx rdi, word ptr [rip+g1520]
+  add rsi, rdi
+  mov word ptr [rip+g4790], si
+  movsxd rsi, dword ptr [rip+g4215]
+  movsx rdi, byte ptr [rip+g438]
+  add rsi, rdi
+  mov word ptr [rip+g4791], si
+  movsx rsi, byte ptr [rip+g4013]
+  add rsi, qword ptr [rip+g4680]
+  mov word ptr [rip+g4792], si
+  movsx rsi, byte ptr [rip+g46]
+  movsxd rdi, dword ptr [rip+g4761]
+  add rsi, rdi
+  mov byte ptr [rip+g4793], sil
+  mov rsi, qword ptr [rip+g4304]
+  movsx rdi, word ptr [rip+g2866]
+  add rsi, rdi
+  mov word ptr [rip+g4794], si
+  movsx rsi, byte ptr [rip+g4596]
+  movsx rdi, byte ptr [rip+g1303]
+  add rsi, rdi
+  mov word ptr [rip+g4795], si
+  movsx rsi, byte ptr [rip+g704]
+  movsx rdi, byte ptr [rip+g4797]
+  add rsi, rdi
+  mov dword ptr [rip+g4796], esi
+  movsxd rsi, dword ptr [rip+g4066]
+  movsx rdi, byte ptr [rip+g981]
+  add rsi, rdi
+  mov byte ptr [rip+g4797], sil
+  mov rsi, qword ptr [rip+g1531]
+  movsx rdi, byte ptr [rip+g3581]
+  add rsi, rdi
+  mov word ptr [rip+g4798], si
+  mov rsi, qword ptr [rip+g4837]
+  movsx rdi, byte ptr [rip+g1728]
+  add rsi, rdi
+  mov word ptr [rip+g4799], si
+  movsx rsi, word ptr [rip+g4790]
+  mov rax, rsi
+.L.return.u479:
+  ret
+.text
+.p2align 4
+.global u480
+u480:
+  movsx rsi, word ptr [rip+g1647]
+  movsx rdi, byte ptr [rip+g1707]
+  add rsi, rdi
+  mov qword ptr [rip+g4800], rsi
+  movsx rsi, word ptr [rip+g469]
+  add rsi, qword ptr [rip+g1216]
+  mov qword ptr [rip+g4801], rsi
+  movsx rsi, word ptr [rip+g602]
+  movsx rdi, word ptr [rip+g4519]
+  add rsi, rdi
+  mov byte ptr [rip+g4802], sil
+  mov rsi, qword ptr [rip+g1143]
+  movsx rdi, word ptr [rip+g1626]
+  add rsi, rdi
+  mov byte ptr [rip+g4803], sil
+  movsxd rsi, dword ptr [rip+g941]
+  movsx rdi, byte ptr [rip+g3330]
+  add rsi, rdi
+  mov byte ptr [rip+g4804], sil
+  movsx rsi, byte ptr [rip+g3091]
+  add rsi, qword ptr [rip+g3911]
+  mov dword ptr [rip+g4805], esi
+  movsx rsi, byte ptr [rip+g2696]
+  movsx rdi, word ptr [rip+g4634]
+  add rsi, rdi
+  mov byte ptr [rip+g4806], sil
+  movsx rsi, byte ptr [rip+g73]
+  movsxd rdi, dword ptr [rip+g419]
+  add rsi, rdi
+  mov byte ptr [rip+g4807], sil
+  movsx rsi, byte ptr [rip+g285]
+  movsx rdi, byte ptr [rip+g62]
+  add rsi, rdi
+  mov byte ptr [rip+g4808], sil
+  mov rsi, qword ptr [rip+g1535]
+  movsx rdi, word ptr [rip+g3632]
+  add rsi, rdi
+  mov byte ptr [rip+g4809], sil
+  mov rax, qword ptr [rip+g4800]
+.L.return.u480:
+  ret
+.text
+.p2align 4
+.global u481
+u481:
+  movsx rsi, byte ptr [rip+g4721]
+  add rsi, qword ptr [rip+g1360]
+  mov word ptr [rip+g4810], si
+  movsx rsi, word ptr [rip+g3912]
+  movsx rdi, word ptr [rip+g4550]
+  add rsi, rdi
+  mov byte ptr [rip+g4811], sil
+  movsx rsi, word ptr [rip+g2790]
+  add rsi, qword ptr [rip+g4938]
+  mov word ptr [rip+g4812], si
+  mov rsi, qword ptr [rip+g3479]
+  movsxd rdi, dword ptr [rip+g2572]
+  add rsi, rdi
+  mov byte ptr [rip+g4813], sil
+  movsx rsi, byte ptr [rip+g3125]
+  movsxd rdi, dword ptr [rip+g2240]
+  add rsi, rdi
+  mov word ptr [rip+g4814], si
+  movsx rsi, byte ptr [rip+g2425]
+  movsxd rdi, dword ptr [rip+g31]
+  add rsi, rdi
+  mov word ptr [rip+g4815], si
+  mov rsi, qword ptr [rip+g1857]
+  movsx rdi, word ptr [rip+g3559]
+  add rsi, rdi
+  mov dword ptr [rip+g4816], esi
+  mov rsi, qword ptr [rip+g1109]
+  movsx rdi, word ptr [rip+g1641]
+  add rsi, rdi
+  mov qword ptr [rip+g4817], rsi
+  movsxd rsi, dword ptr [rip+g996]
+  movsx rdi, byte ptr [rip+g663]
+  add rsi, rdi
+  mov word ptr [rip+g4818], si
+  mov rsi, qword ptr [rip+g1786]
+  add rsi, qword ptr [rip+g348]
+  mov word ptr [rip+g4819], si
+  movsx rsi, word ptr [rip+g4810]
+  mov rax, rsi
+.L.return.u481:
+  ret
+.text
+.p2align 4
+.global u482
+u482:
+  movsx rsi, word ptr [rip+g2645]
+  movsx rdi, word ptr [rip+g4245]
+  add rsi, rdi
+  mov dword ptr [rip+g4820], esi
+  movsx rsi, byte ptr [rip+g1148]
+  movsx rdi, byte ptr [rip+g2641]
+  add rsi, rdi
+  mov qword ptr [rip+g4821], rsi
+  movsx rsi, byte ptr [rip+g1836]
+  movsxd rdi, dword ptr [rip+g3171]
+  add rsi, rdi
+  mov dword ptr [rip+g4822], esi
+  movsxd rsi, dword ptr [rip+g2036]
+  movsxd rdi, dword ptr [rip+g2080]
+  add rsi, rdi
+  mov word ptr [rip+g4823], si
+  movsx rsi, word ptr [rip+g71]
+  add rsi, qword ptr [rip+g2512]
+  mov word ptr [rip+g4824], si
+  mov rsi, qword ptr [rip+g2488]
+  movsx rdi, byte ptr [rip+g4302]
+  add rsi, rdi
+  mov dword ptr [rip+g4825], esi
+  movsx rsi, byte ptr [rip+g4222]
+  movsxd rdi, dword ptr [rip+g3558]
+  add rsi, rdi
+  mov qword ptr [rip+g4826], rsi
+  movsx rsi, word ptr [rip+g589]
+  movsx rdi, word ptr [rip+g2584]
+  add rsi, rdi
+  mov word ptr [rip+g4827], si
+  movsxd rsi, dword ptr [rip+g2080]
+  add rsi, qword ptr [rip+g3959]
+  mov word ptr [rip+g4828], si
+  mov rsi, qword ptr [rip+g1413]
+  movsxd rdi, dword ptr [rip+g4662]
+  add rsi, rdi
+  mov dword ptr [rip+g4829], esi
+  movsxd rsi, dword ptr [rip+g4820]
+  mov rax, rsi
+.L.return.u482:
+  ret
+.text
+.p2align 4
+.global u483
+u483:
+  movsx rsi, byte ptr [rip+g2049]
+  movsxd rdi, dword ptr [rip+g1479]
+  add rsi, rdi
+  mov word ptr [rip+g4830], si
+  movsxd rsi, dword ptr [rip+g4961]
+  add rsi, qword ptr [rip+g1424]
+  mov byte ptr [rip+g4831], sil
+  mov rsi, qword ptr [rip+g1809]
+  add rsi, qword ptr [rip+g2767]
+  mov byte ptr [rip+g4832], sil
+  movsxd rsi, dword ptr [rip+g4413]
+  movsxd rdi, dword ptr [rip+g4677]
+  add rsi, rdi
+  mov byte ptr [rip+g4833], sil
+  movsx rsi, byte ptr [rip+g3128]
+  movsx rdi, byte ptr [rip+g4017]
+  add rsi, rdi
+  mov word ptr [rip+g4834], si
+  movsx rsi, byte ptr [rip+g3116]
+  movsx rdi, byte ptr [rip+g1497]
+  add rsi, rdi
+  mov word ptr [rip+g4835], si
+  mov rsi, qword ptr [rip+g4375]
+  add rsi, qword ptr [rip+g4187]
+  mov byte ptr [rip+g4836], sil
+  movsxd rsi, dword ptr [rip+g3563]
+  movsx rdi, byte ptr [rip+g647]
+  add rsi, rdi
+  mov qword ptr [rip+g4837], rsi
+  movsxd rsi, dword ptr [rip+g2808]
+  movsxd rdi, dword ptr [rip+g1669]
+  add rsi, rdi
+  mov byte ptr [rip+g4838], sil
+  movsx rsi, byte ptr [rip+g632]
+  movsxd rdi, dword ptr [rip+g2304]
+  add rsi, rdi
+  mov qword ptr [rip+g4839], rsi
+  movsx rsi, word ptr [rip+g4830]
+  mov rax, rsi
+.L.return.u483:
+  ret
+.text
+.p2align 4
+.global u484
+u484:
+  movsxd rsi, dword ptr [rip+g3776]
+  movsx rdi, byte ptr [rip+g3378]
+  add rsi, rdi
+  mov dword ptr [rip+g4840], esi
+  movsx rsi, word ptr [rip+g4331]
+  add rsi, qword ptr [rip+g3079]
+  mov byte ptr [rip+g4841], sil
+  mov rsi, qword ptr [rip+g759]
+  movsxd rdi, dword ptr [rip+g1347]
+  add rsi, rdi
+  mov qword ptr [rip+g4842], rsi
+  movsx rsi, byte ptr [rip+g2395]
+  movsxd rdi, dword ptr [rip+g2642]
+  add rsi, rdi
+  mov byte ptr [rip+g4843], sil
+  mov rsi, qword ptr [rip+g1795]
+  add rsi, qword ptr [rip+g1416]
+  mov word ptr [rip+g4844], si
+  movsxd rsi, dword ptr [rip+g2350]
+  add rsi, qword ptr [rip+g601]
+  mov qword ptr [rip+g4845], rsi
+  movsx rsi, byte ptr [rip+g4872]
+  movsx rdi, word ptr [rip+g2252]
+  add rsi, rdi
+  mov dword ptr [rip+g4846], esi
+  movsxd rsi, dword ptr [rip+g1347]
+  movsx rdi, word ptr [rip+g1801]
+  add rsi, rdi
+  mov dword ptr [rip+g4847], esi
+  movsx rsi, word ptr [rip+g200]
+  movsx rdi, byte ptr [rip+g3368]
+  add rsi, rdi
+  mov dword ptr [rip+g4848], esi
+  mov rsi, qword ptr [rip+g4776]
+  movsx rdi, byte ptr [rip+g3990]
+  add rsi, rdi
+  mov word ptr [rip+g4849], si
+  movsxd rsi, dword ptr [rip+g4840]
+  mov rax, rsi
+.L.return.u484:
+  ret
+.text
+.p2align 4
+.global u485
+u485:
+  movsxd rsi, dword ptr [rip+g1737]
+  movsxd rdi, dword ptr [rip+g954]
+  add rsi, rdi
+  mov qword ptr [rip+g4850], rsi
+  movsx rsi, word ptr [rip+g1210]
+  add rsi, qword ptr [rip+g3829]
+  mov qword ptr [rip+g4851], rsi
+  movsxd rsi, dword ptr [rip+g1666]
+  movsxd rdi, dword ptr [rip+g3009]
+  add rsi, rdi
+  mov dword ptr [rip+g4852], esi
+  movsxd rsi, dword ptr [rip+g1785]
+  movsx rdi, word ptr [rip+g4014]
+  add rsi, rdi
+  mov byte ptr [rip+g4853], sil
+  mov rsi, qword ptr [rip+g353]
+  movsx rdi, byte ptr [rip+g4832]
+  add rsi, rdi
+  mov byte ptr [rip+g4854], sil
+  movsx rsi, word ptr [rip+g2856]
+  movsx rdi, byte ptr [rip+g2660]
+  add rsi, rdi
+  mov byte ptr [rip+g4855], sil
+  movsxd rsi, dword ptr [rip+g4066]
+  movsx rdi, word ptr [rip+g367]
+  add rsi, rdi
+  mov qword ptr [rip+g4856], rsi
+  movsx rsi, byte ptr [rip+g2034]
+  movsx rdi, word ptr [rip+g2900]
+  add rsi, rdi
+  mov byte ptr [rip+g4857], sil
+  mov rsi, qword ptr [rip+g4581]
+  movsx rdi, word ptr [rip+g806]
+  add rsi, rdi
+  mov qword ptr [rip+g4858], rsi
+  mov rsi, qword ptr [rip+g2958]
+  movsx rdi, byte ptr [rip+g2211]
+  add rsi, rdi
+  mov word ptr [rip+g4859], si
+  mov rax, qword ptr [rip+g4850]
+.L.return.u485:
+  ret
+.text
+.p2align 4
+.global u486
+u486:
+  movsx rsi, byte ptr [rip+g4797]
+  add rsi, qword ptr [rip+g2647]
+  mov qword ptr [rip+g4860], rsi
+  mov rsi, qword ptr [rip+g566]
+  movsxd rdi, dword ptr [rip+g4873]
+  add rsi, rdi
+  mov byte ptr [rip+g4861], sil
+  movsx rsi, word ptr [rip+g3140]
+  movsx rdi, word ptr [rip+g2789]
+  add rsi, rdi
+  mov word ptr [rip+g4862], si
+  movsxd rsi, dword ptr [rip+g1219]
+  movsx rdi, byte ptr [rip+g3579]
+  add rsi, rdi
+  mov word ptr [rip+g4863], si
+  movsx rsi, word ptr [rip+g2024]
+  movsx rdi, word ptr [rip+g2615]
+  add rsi, rdi
+  mov byte ptr [rip+g4864], sil
+  movsx rsi, word ptr [rip+g1149]
+  add rsi, qword ptr [rip+g767]
+  mov dword ptr [rip+g4865], esi
+  movsxd rsi, dword ptr [rip+g3001]
+  movsx rdi, word ptr [rip+g4758]
+  add rsi, rdi
+  mov dword ptr [rip+g4866], esi
+  movsx rsi, byte ptr [rip+g1156]
+  movsxd rdi, dword ptr [rip+g420]
+  add rsi, rdi
+  mov byte ptr [rip+g4867], sil
+  mov rsi, qword ptr [rip+g2152]
+  movsx rdi, byte ptr [rip+g1563]
+  add rsi, rdi
+  mov qword ptr [rip+g4868], rsi
+  movsxd rsi, dword ptr [rip+g2597]
+  movsx rdi, word ptr [rip+g2116]
+  add rsi, rdi
+  mov byte ptr [rip+g4869], sil
+  mov rax, qword ptr [rip+g4860]
+.L.return.u486:
+  ret
+.text
+.p2align 4
+.global u487
+u487:
+  mov rsi, qword ptr [rip+g2008]
+  add rsi, qword ptr [rip+g3955]
+  mov dword ptr [rip+g4870], esi
+  movsxd rsi, dword ptr [rip+g3930]
+  movsx rdi, word ptr [rip+g1689]
+  add rsi, rdi
+  mov qword ptr [rip+g4871], rsi
+  mov rsi, qword ptr [rip+g2805]
+  movsx rdi, byte ptr [rip+g2892]
+  add rsi, rdi
+  mov byte ptr [rip+g4872], sil
+  movsx rsi, byte ptr [rip+g1836]
+  movsx rdi, word ptr [rip+g450]
+  add rsi, rdi
+  mov dword ptr [rip+g4873], esi
+  mov rsi, qword ptr [rip+g2937]
+  add rsi, qword ptr [rip+g3411]
+  mov word ptr [rip+g4874], si
+  movsxd rsi, dword ptr [rip+g334]
+  movsxd rdi, dword ptr [rip+g3041]
+  add rsi, rdi
+  mov qword ptr [rip+g4875], rsi
+  mov rsi, qword ptr [rip+g2865]
+  movsx rdi, byte ptr [rip+g4608]
+  add rsi, rdi
+  mov dword ptr [rip+g4876], esi
+  movsx rsi, byte ptr [rip+g403]
+  movsx rdi, byte ptr [rip+g2083]
+  add rsi, rdi
+  mov word ptr [rip+g4877], si
+  movsx rsi, byte ptr [rip+g1430]
+  movsx rdi, word ptr [rip+g3457]
+  add rsi, rdi
+  mov byte ptr [rip+g4878], sil
+  mov rsi, qword ptr [rip+g3742]
+  movsx rdi, byte ptr [rip+g41]
+  add rsi, rdi
+  mov word ptr [rip+g4879], si
+  movsxd rsi, dword ptr [rip+g4870]
+  mov rax, rsi
+.L.return.u487:
+  ret
+.text
+.p2align 4
+.global u488
+u488:
+  movsx rsi, byte ptr [rip+g890]
+  movsx rdi, byte ptr [rip+g4449]
+  add rsi, rdi
+  mov byte ptr [rip+g4880], sil
+  mov rsi, qword ptr [rip+g3058]
+  add rsi, qword ptr [rip+g17]
+  mov dword ptr [rip+g4881], esi
+  movsx rsi, word ptr [rip+g2418]
+  movsx rdi, word ptr [rip+g3295]
+  add rsi, rdi
+  mov qword ptr [rip+g4882], rsi
+  mov rsi, qword ptr [rip+g3634]
+  movsx rdi, byte ptr [rip+g4666]
+  add rsi, rdi
+  mov word ptr [rip+g4883], si
+  mov rsi, qword ptr [rip+g2387]
+  movsx rdi, word ptr [rip+g1629]
+  add rsi, rdi
+  mov byte ptr [rip+g4884], sil
+  movsx rsi, byte ptr [rip+g1399]
+  movsx rdi, byte ptr [rip+g3764]
+  add rsi, rdi
+  mov word ptr [rip+g4885], si
+  movsx rsi, byte ptr [rip+g3499]
+  movsxd rdi, dword ptr [rip+g3082]
+  add rsi, rdi
+  mov qword ptr [rip+g4886], rsi
+  movsxd rsi, dword ptr [rip+g68]
+  movsx rdi, byte ptr [rip+g2207]
+  add rsi, rdi
+  mov dword ptr [rip+g4887], esi
+  movsxd rsi, dword ptr [rip+g2913]
+  add rsi, qword ptr [rip+g2826]
+  mov qword ptr [rip+g4888], rsi
+  movsxd rsi, dword ptr [rip+g3299]
+  movsx rdi, word ptr [rip+g910]
+  add rsi, rdi
+  mov dword ptr [rip+g4889], esi
+  movsx rsi, byte ptr [rip+g4880]
+  mov rax, rsi
+.L.return.u488:
+  ret
+.text
+.p2align 4
+.global u489
+u489:
+  mov rsi, qword ptr [rip+g4594]
+  add rsi, qword ptr [rip+g1976]
+  mov qword ptr [rip+g4890], rsi
+  movsxd rsi, dword ptr [rip+g3920]
+  add rsi, qword ptr [rip+g2814]
+  mov byte ptr [rip+g4891], sil
+  mov rsi, qword ptr [rip+g1416]
+  movsx rdi, byte ptr [rip+g4670]
+  add rsi, rdi
+  mov dword ptr [rip+g4892], esi
+  movsxd rsi, dword ptr [rip+g805]
+  movsx rdi, word ptr [rip+g4490]
+  add rsi, rdi
+  mov word ptr [rip+g4893], si
+  movsx rsi, word ptr [rip+g397]
+  movsx rdi, byte ptr [rip+g2075]
+  add rsi, rdi
+  mov dword ptr [rip+g4894], esi
+  movsx rsi, byte ptr [rip+g1157]
+  movsxd rdi, dword ptr [rip+g3197]
+  add rsi, rdi
+  mov dword ptr [rip+g4895], esi
+  mov rsi, qword ptr [rip+g3851]
+  movsxd rdi, dword ptr [rip+g3700]
+  add rsi, rdi
+  mov dword ptr [rip+g4896], esi
+  movsxd rsi, dword ptr [rip+g3700]
+  movsx rdi, word ptr [rip+g3397]
+  add rsi, rdi
+  mov qword ptr [rip+g4897], rsi
+  movsx rsi, byte ptr [rip+g3968]
+  add rsi, qword ptr [rip+g4296]
+  mov word ptr [rip+g4898], si
+  movsx rsi, byte ptr [rip+g1355]
+  movsx rdi, word ptr [rip+g590]
+  add rsi, rdi
+  mov qword ptr [rip+g4899], rsi
+  mov rax, qword ptr [rip+g4890]
+.L.return.u489:
+  ret
+.text
+.p2align 4
+.global u490
+u490:
+  movsxd rsi, dword ptr [rip+g1700]
+  movsx rdi, word ptr [rip+g614]
+  add rsi, rdi
+  mov word ptr [rip+g4900], si
+  movsxd rsi, dword ptr [rip+g3563]
+  movsx rdi, byte ptr [rip+g2207]
+  add rsi, rdi
+  mov byte ptr [rip+g4901], sil
+  movsxd rsi, dword ptr [rip+g3519]
+  add rsi, qword ptr [rip+g748]
+  mov dword ptr [rip+g4902], esi
+  movsxd rsi, dword ptr [rip+g895]
+  movsxd rdi, dword ptr [rip+g1053]
+  add rsi, rdi
+  mov dword ptr [rip+g4903], esi
+  movsx rsi, word ptr [rip+g989]
+  movsxd rdi, dword ptr [rip+g4631]
+  add rsi, rdi
+  mov word ptr [rip+g4904], si
+  movsx rsi, byte ptr [rip+g605]
+  movsx rdi, word ptr [rip+g4815]
+  add rsi, rdi
+  mov dword ptr [rip+g4905], esi
+  movsx rsi, word ptr [rip+g1200]
+  movsx rdi, byte ptr [rip+g3761]
+  add rsi, rdi
+  mov word ptr [rip+g4906], si
+  movsx rsi, byte ptr [rip+g1614]
+  movsx rdi, byte ptr [rip+g3757]
+  add rsi, rdi
+  mov dword ptr [rip+g4907], esi
+  mov rsi, qword ptr [rip+g4958]
+  movsx rdi, byte ptr [rip+g2748]
+  add rsi, rdi
+  mov byte ptr [rip+g4908], sil
+  movsxd rsi, dword ptr [rip+g2529]
+  movsxd rdi, dword ptr [rip+g3515]
+  add rsi, rdi
+  mov word ptr [rip+g4909], si
+  movsx rsi, word ptr [rip+g4900]
+  mov rax, rsi
+.L.return.u490:
+  ret
+.text
+.p2align 4
+.global u491
+u491:
+  movsxd rsi, dword ptr [rip+g2796]
+  movsxd rdi, dword ptr [rip+g37]
+  add rsi, rdi
+  mov word ptr [rip+g4910], si
+  mov rsi, qword ptr [rip+g69]
+  movsxd rdi, dword ptr [rip+g2825]
+  add rsi, rdi
+  mov dword ptr [rip+g4911], esi
+  movsx rsi, byte ptr [rip+g3483]
+  movsx rdi, word ptr [rip+g3169]
+  add rsi, rdi
+  mov word ptr [rip+g4912], si
+  movsx rsi, word ptr [rip+g44]
+  movsx rdi, word ptr [rip+g4712]
+  add rsi, rdi
+  mov qword ptr [rip+g4913], rsi
+  mov rsi, qword ptr [rip+g1106]
+  movsx rdi, word ptr [rip+g2390]
+  add rsi, rdi
+  mov word ptr [rip+g4914], si
+  movsx rsi, word ptr [rip+g2358]
+  movsxd rdi, dword ptr [rip+g4045]
+  add rsi, rdi
+  mov word ptr [rip+g4915], si
+  movsxd rsi, dword ptr [rip+g2963]
+  movsx rdi, word ptr [rip+g3541]
+  add rsi, rdi
+  mov dword ptr [rip+g4916], esi
+  movsxd rsi, dword ptr [rip+g1502]
+  add rsi, qword ptr [rip+g4686]
+  mov dword ptr [rip+g4917], esi
+  movsx rsi, byte ptr [rip+g4996]
+  movsx rdi, byte ptr [rip+g3672]
+  add rsi, rdi
+  mov dword ptr [rip+g4918], esi
+  movsx rsi, word ptr [rip+g4080]
+  add rsi, qword ptr [rip+g3237]
+  mov byte ptr [rip+g4919], sil
+  movsx rsi, word ptr [rip+g4910]
+  mov rax, rsi
+.L.return.u491:
+  ret
+.text
+.p2align 4
+.global u492
+u492:
+  movsxd rsi, dword ptr [rip+g4917]
+  movsxd rdi, dword ptr [rip+g2642]
+  add rsi, rdi
+  mov qword ptr [rip+g4920], rsi
+  movsxd rsi, dword ptr [rip+g4688]
+  movsx rdi, word ptr [rip+g4874]
+  add rsi, rdi
+  mov byte ptr [rip+g4921], sil
+  mov rsi, qword ptr [rip+g4868]
+  add rsi, qword ptr [rip+g1677]
+  mov word ptr [rip+g4922], si
+  mov rsi, qword ptr [rip+g1712]
+  movsx rdi, word ptr [rip+g558]
+  add rsi, rdi
+  mov word ptr [rip+g4923], si
+  mov rsi, qword ptr [rip+g4710]
+  movsxd rdi, dword ptr [rip+g4979]
+  add rsi, rdi
+  mov dword ptr [rip+g4924], esi
+  movsx rsi, word ptr [rip+g2043]
+  add rsi, qword ptr [rip+g3452]
+  mov dword ptr [rip+g4925], esi
+  mov rsi, qword ptr [rip+g1416]
+  movsx rdi, word ptr [rip+g635]
+  add rsi, rdi
+  mov byte ptr [rip+g4926], sil
+  movsx rsi, word ptr [rip+g3228]
+  movsxd rdi, dword ptr [rip+g4105]
+  add rsi, rdi
+  mov word ptr [rip+g4927], si
+  mov rsi, qword ptr [rip+g606]
+  movsx rdi, byte ptr [rip+g4217]
+  add rsi, rdi
+  mov dword ptr [rip+g4928], esi
+  movsxd rsi, dword ptr [rip+g2376]
+  movsx rdi, byte ptr [rip+g769]
+  add rsi, rdi
+  mov word ptr [rip+g4929], si
+  mov rax, qword ptr [rip+g4920]
+.L.return.u492:
+  ret
+.text
+.p2align 4
+.global u493
+u493:
+  movsx rsi, byte ptr [rip+g1097]
+  movsx rdi, word ptr [rip+g4747]
+  add rsi, rdi
+  mov word ptr [rip+g4930], si
+  mov rsi, qword ptr [rip+g1162]
+  movsx rdi, byte ptr [rip+g1602]
+  add rsi, rdi
+  mov dword ptr [rip+g4931], esi
+  movsx rsi, byte ptr [rip+g3443]
+  add rsi, qword ptr [rip+g3974]
+  mov dword ptr [rip+g4932], esi
+  movsx rsi, byte ptr [rip+g4425]
+  add rsi, qword ptr [rip+g1734]
+  mov byte ptr [rip+g4933], sil
+  movsx rsi, word ptr [rip+g1639]
+  add rsi, qword ptr [rip+g999]
+  mov qword ptr [rip+g4934], rsi
+  mov rsi, qword ptr [rip+g2815]
+  movsx rdi, word ptr [rip+g3169]
+  add rsi, rdi
+  mov byte ptr [rip+g4935], sil
+  mov rsi, qword ptr [rip+g1675]
+  add rsi, qword ptr [rip+g78]
+  mov byte ptr [rip+g4936], sil
+  movsx rsi, byte ptr [rip+g4240]
+  movsx rdi, word ptr [rip+g1384]
+  add rsi, rdi
+  mov byte ptr [rip+g4937], sil
+  mov rsi, qword ptr [rip+g4377]
+  movsxd rdi, dword ptr [rip+g2027]
+  add rsi, rdi
+  mov qword ptr [rip+g4938], rsi
+  movsx rsi, word ptr [rip+g1334]
+  add rsi, qword ptr [rip+g3822]
+  mov dword ptr [rip+g4939], esi
+  movsx rsi, word ptr [rip+g4930]
+  mov rax, rsi
+.L.return.u493:
+  ret
+.text
+.p2align 4
+.global u494
+u494:
+  movsxd rsi, dword ptr [rip+g2517]
+  movsx rdi, byte ptr [rip+g894]
+  add rsi, rdi
+  mov qword ptr [rip+g4940], rsi
+  movsx rsi, word ptr [rip+g1955]
+  add rsi, qword ptr [rip+g3143]
+  mov dword ptr [rip+g4941], esi
+  mov rsi, qword ptr [rip+g3911]
+  movsx rdi, byte ptr [rip+g52]
+  add rsi, rdi
+  mov word ptr [rip+g4942], si
+  movsx rsi, byte ptr [rip+g4194]
+  movsx rdi, word ptr [rip+g1384]
+  add rsi, rdi
+  mov dword ptr [rip+g4943], esi
+  mov rsi, qword ptr [rip+g3122]
+  movsxd rdi, dword ptr [rip+g3836]
+  add rsi, rdi
+  mov dword ptr [rip+g4944], esi
+  mov rsi, qword ptr [rip+g1317]
+  add rsi, qword ptr [rip+g4170]
+  mov byte ptr [rip+g4945], sil
+  mov rsi, qword ptr [rip+g3742]
+  add rsi, qword ptr [rip+g3413]
+  mov qword ptr [rip+g4946], rsi
+  mov rsi, qword ptr [rip+g2065]
+  movsx rdi, word ptr [rip+g1813]
+  add rsi, rdi
+  mov qword ptr [rip+g4947], rsi
+  mov rsi, qword ptr [rip+g1448]
+  movsxd rdi, dword ptr [rip+g2632]
+  add rsi, rdi
+  mov dword ptr [rip+g4948], esi
+  movsxd rsi, dword ptr [rip+g1042]
+  movsxd rdi, dword ptr [rip+g3497]
+  add rsi, rdi
+  mov byte ptr [rip+g4949], sil
+  mov rax, qword ptr [rip+g4940]
+.L.return.u494:
+  ret
+.text
+.p2align 4
+.global u495
+u495:
+  movsxd rsi, dword ptr [rip+g3720]
+  add rsi, qword ptr [rip+g1957]
+  mov dword ptr [rip+g4950], esi
+  movsxd rsi, dword ptr [rip+g3898]
+  movsxd rdi, dword ptr [rip+g1056]
+  add rsi, rdi
+  mov word ptr [rip+g4951], si
+  movsxd rsi, dword ptr [rip+g4632]
+  add rsi, qword ptr [rip+g345]
+  mov qword ptr [rip+g4952], rsi
+  mov rsi, qword ptr [rip+g3112]
+  movsx rdi, word ptr [rip+g798]
+  add rsi, rdi
+  mov word ptr [rip+g4953], si
+  movsx rsi, word ptr [rip+g1732]
+  movsxd rdi, dword ptr [rip+g1228]
+  add rsi, rdi
+  mov qword ptr [rip+g4954], rsi
+  mov rsi, qword ptr [rip+g3682]
+  movsx rdi, word ptr [rip+g495]
+  add rsi, rdi
+  mov byte ptr [rip+g4955], sil
+  movsx rsi, word ptr [rip+g4407]
+  movsxd rdi, dword ptr [rip+g4956]
+  add rsi, rdi
+  mov dword ptr [rip+g4956], esi
+  movsxd rsi, dword ptr [rip+g298]
+  add rsi, qword ptr [rip+g1322]
+  mov qword ptr [rip+g4957], rsi
+  movsxd rsi, dword ptr [rip+g22]
+  movsxd rdi, dword ptr [rip+g282]
+  add rsi, rdi
+  mov qword ptr [rip+g4958], rsi
+  movsx rsi, word ptr [rip+g4205]
+  add rsi, qword ptr [rip+g48]
+  mov word ptr [rip+g4959], si
+  movsxd rsi, dword ptr [rip+g4950]
+  mov rax, rsi
+.L.return.u495:
+  ret
+.text
+.p2align 4
+.global u496
+u496:
+  movsx rsi, word ptr [rip+g1823]
+  movsx rdi, byte ptr [rip+g4869]
+  add rsi, rdi
+  mov word ptr [rip+g4960], si
+  movsx rsi, byte ptr [rip+g2706]
+  movsx rdi, word ptr [rip+g2989]
+  add rsi, rdi
+  mov dword ptr [rip+g4961], esi
+  mov rsi, qword ptr [rip+g2387]
+  movsxd rdi, dword ptr [rip+g4852]
+  add rsi, rdi
+  mov qword ptr [rip+g4962], rsi
+  movsx rsi, word ptr [rip+g706]
+  movsx rdi, word ptr [rip+g822]
+  add rsi, rdi
+  mov word ptr [rip+g4963], si
+  movsx rsi, word ptr [rip+g1690]
+  add rsi, qword ptr [rip+g2767]
+  mov word ptr [rip+g4964], si
+  movsxd rsi, dword ptr [rip+g869]
+  movsx rdi, byte ptr [rip+g1204]
+  add rsi, rdi
+  mov word ptr [rip+g4965], si
+  movsxd rsi, dword ptr [rip+g434]
+  add rsi, qword ptr [rip+g1565]
+  mov qword ptr [rip+g4966], rsi
+  movsx rsi, byte ptr [rip+g55]
+  movsx rdi, byte ptr [rip+g2055]
+  add rsi, rdi
+  mov word ptr [rip+g4967], si
+  mov rsi, qword ptr [rip+g4720]
+  add rsi, qword ptr [rip+g3849]
+  mov byte ptr [rip+g4968], sil
+  movsxd rsi, dword ptr [rip+g1719]
+  movsx rdi, word ptr [rip+g3162]
+  add rsi, rdi
+  mov qword ptr [rip+g4969], rsi
+  movsx rsi, word ptr [rip+g4960]
+  mov rax, rsi
+.L.return.u496:
+  ret
+.text
+.p2align 4
+.global u497
+u497:
+  mov rsi, qword ptr [rip+g4753]
+  add rsi, qword ptr [rip+g4117]
+  mov word ptr [rip+g4970], si
+  movsx rsi, word ptr [rip+g207]
+  add rsi, qword ptr [rip+g2090]
+  mov dword ptr [rip+g4971], esi
+  movsx rsi, word ptr [rip+g3458]
+  movsx rdi, word ptr [rip+g1900]
+  add rsi, rdi
+  mov qword ptr [rip+g4972], rsi
+  movsxd rsi, dword ptr [rip+g136]
+  movsx rdi, word ptr [rip+g4231]
+  add rsi, rdi
+  mov byte ptr [rip+g4973], sil
+  mov rsi, qword ptr [rip+g3598]
+  movsx rdi, byte ptr [rip+g1246]
+  add rsi, rdi
+  mov byte ptr [rip+g4974], sil
+  movsx rsi, byte ptr [rip+g2118]
+  movsx rdi, byte ptr [rip+g2259]
+  add rsi, rdi
+  mov word ptr [rip+g4975], si
+  movsxd rsi, dword ptr [rip+g771]
+  movsxd rdi, dword ptr [rip+g934]
+  add rsi, rdi
+  mov word ptr [rip+g4976], si
+  movsxd rsi, dword ptr [rip+g1308]
+  movsxd rdi, dword ptr [rip+g3103]
+  add rsi, rdi
+  mov qword ptr [rip+g4977], rsi
+  movsx rsi, byte ptr [rip+g3709]
+  movsx rdi, word ptr [rip+g965]
+  add rsi, rdi
+  mov word ptr [rip+g4978], si
+  movsx rsi, byte ptr [rip+g4181]
+  add rsi, qword ptr [rip+g4369]
+  mov dword ptr [rip+g4979], esi
+  movsx rsi, word ptr [rip+g4970]
+  mov rax, rsi
+.L.return.u497:
+  ret
+.text
+.p2align 4
+.global u498
+u498:
+  mov rsi, qword ptr [rip+g3565]
+  movsx rdi, word ptr [rip+g4799]
+  add rsi, rdi
+  mov word ptr [rip+g4980], si
+  movsx rsi, byte ptr [rip+g2243]
+  movsx rdi, byte ptr [rip+g3560]
+  add rsi, rdi
+  mov dword ptr [rip+g4981], esi
+  mov rsi, qword ptr [rip+g749]
+  movsx rdi, word ptr [rip+g436]
+  add rsi, rdi
+  mov word ptr [rip+g4982], si
+  movsx rsi, word ptr [rip+g4521]
+  movsxd rdi, dword ptr [rip+g2886]
+  add rsi, rdi
+  mov qword ptr [rip+g4983], rsi
+  mov rsi, qword ptr [rip+g277]
+  add rsi, qword ptr [rip+g856]
+  mov word ptr [rip+g4984], si
+  movsxd rsi, dword ptr [rip+g3530]
+  movsx rdi, word ptr [rip+g2856]
+  add rsi, rdi
+  mov qword ptr [rip+g4985], rsi
+  movsxd rsi, dword ptr [rip+g3365]
+  movsx rdi, byte ptr [rip+g4121]
+  add rsi, rdi
+  mov byte ptr [rip+g4986], sil
+  movsxd rsi, dword ptr [rip+g42]
+  add rsi, qword ptr [rip+g81]
+  mov dword ptr [rip+g4987], esi
+  movsxd rsi, dword ptr [rip+g4887]
+  movsx rdi, byte ptr [rip+g2665]
+  add rsi, rdi
+  mov dword ptr [rip+g4988], esi
+  movsx rsi, byte ptr [rip+g46]
+  add rsi, qword ptr [rip+g4295]
+  mov byte ptr [rip+g4989], sil
+  movsx rsi, word ptr [rip+g4980]
+  mov rax, rsi
+.L.return.u498:
+  ret
+.text
+.p2align 4
+.global u499
+u499:
+  movsx rsi, byte ptr [rip+g4656]
+  add rsi, qword ptr [rip+g245]
+  mov word ptr [rip+g4990], si
+  movsx rsi, byte ptr [rip+g2701]
+  movsx rdi, byte ptr [rip+g201]
+  add rsi, rdi
+  mov qword ptr [rip+g4991], rsi
+  movsx rsi, byte ptr [rip+g1569]
+  movsx rdi, byte ptr [rip+g2751]
+  add rsi, rdi
+  mov qword ptr [rip+g4992], rsi
+  movsx rsi, byte ptr [rip+g3475]
+  movsx rdi, byte ptr [rip+g2499]
+  add rsi, rdi
+  mov byte ptr [rip+g4993], sil
+  movsxd rsi, dword ptr [rip+g214]
+  movsxd rdi, dword ptr [rip+g4526]
+  add rsi, rdi
+  mov byte ptr [rip+g4994], sil
+  movsx rsi, byte ptr [rip+g3048]
+  movsx rdi, word ptr [rip+g344]
+  add rsi, rdi
+  mov qword ptr [rip+g4995], rsi
+  movsxd rsi, dword ptr [rip+g1832]
+  movsx rdi, word ptr [rip+g4874]
+  add rsi, rdi
+  mov byte ptr [rip+g4996], sil
+  mov rsi, qword ptr [rip+g2400]
+  movsxd rdi, dword ptr [rip+g3239]
+  add rsi, rdi
+  mov word ptr [rip+g4997], si
+  movsxd rsi, dword ptr [rip+g484]
+  movsxd rdi, dword ptr [rip+g791]
+  add rsi, rdi
+  mov qword ptr [rip+g4998], rsi
+  movsx rsi, byte ptr [rip+g2564]
+  add rsi, qword ptr [rip+g2926]
+  mov qword ptr [rip+g4999], rsi
+  movsx rsi, word ptr [rip+g4990]
+  mov rax, rsi
+.L.return.u499:
+  ret
+.bss
+.data
+.align 1
+.L.data.main.0:
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 10
+  .byte 0
+.text
+.p2align 4
+.global main
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov qword ptr [rbp-8], rbx
+  lea rbx, [rip+.L.data.main.0]
+  mov rax, 0
+  call u0
+  mov rsi, rax
+  mov rdi, rbx
+  mov rax, 0
+  call printf
+  mov rax, 0
+.L.return.main:
+  mov rbx, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,13 @@
+// -*- c -*-
+// make test compiles this twice into the same -fcodegen-cache directory,
+// changing the declarations below in between. The functions that use them
+// must not be served from the cache the second time.
+
+enum { ANSWER = 43 };
+long table[5];
+
+int answer(void) { return ANSWER; }
+
+long table_size(void) { return sizeof(table) / sizeof(table[0]); }
+
+long table_last(void) { return table[table_size() - 1]; }
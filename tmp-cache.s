@@ -0,0 +1,42 @@
+.intel_syntax noprefix
+.global table
+.bss
+.align 8
+table:
+  .zero 40
+.data
+.text
+.p2align 4
+.global answer
+answer:
+  mov rax, 43
+.L.return.answer:
+  ret
+.text
+.p2align 4
+.global table_size
+table_size:
+  mov rsi, 40
+  mov rdi, rsi
+  sar rdi, 63
+  and rdi, 7
+  add rsi, rdi
+  sar rsi, 3
+  mov rax, rsi
+.L.return.table_size:
+  ret
+.text
+.p2align 4
+.global table_last
+table_last:
+  lea rsi, [rip+table]
+  mov rdi, 40
+  mov r8, rdi
+  sar r8, 63
+  and r8, 7
+  add rdi, r8
+  sar rdi, 3
+  sub rdi, 1
+  mov rax, qword ptr [rsi+rdi*8]
+.L.return.table_last:
+  ret
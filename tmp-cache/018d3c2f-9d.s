@@ -0,0 +1,18 @@
+157
+ccc-codegen-19 0 1
+ int switch_int ( int x ) { switch ( x ) { case 3000000000 : return 1 ; } return 0 ; }
+switch_int: var 0 (10 1 1 0 0(4 4 4 0 0))
+x: local
+.text
+.p2align 4
+.global switch_int
+switch_int:
+  movsxd rdi, edi
+  cmp rdi, -1294967296
+  jne .L.break.switch_int.2
+  mov rax, 1
+  jmp .L.return.switch_int
+.L.break.switch_int.2:
+  mov rax, 0
+.L.return.switch_int:
+  ret
@@ -0,0 +1,11 @@
+95
+ccc-codegen-19 0 1
+ int ret3 ( ) { return 3 ; return 5 ; }
+ret3: var 0 (10 1 1 0 0(4 4 4 0 0))
+.text
+.p2align 4
+.global ret3
+ret3:
+  mov rax, 3
+.L.return.ret3:
+  ret
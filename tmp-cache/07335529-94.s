@@ -0,0 +1,30 @@
+148
+ccc-codegen-19 0 1
+ int counter ( ) { static int i ; static int j = 1 + 1 ; return i ++ + j ++ ; }
+counter: var 0 (10 1 1 0 0(4 4 4 0 0))
+i: ?
+j: ?
+.bss
+.align 4
+.L.data.counter.0:
+  .zero 4
+.data
+.align 4
+.L.data.counter.1:
+  .4byte 2
+.text
+.p2align 4
+.global counter
+counter:
+  movsxd rsi, dword ptr [rip+.L.data.counter.0]
+  add rsi, 1
+  mov dword ptr [rip+.L.data.counter.0], esi
+  sub rsi, 1
+  movsxd rdi, dword ptr [rip+.L.data.counter.1]
+  add rdi, 1
+  mov dword ptr [rip+.L.data.counter.1], edi
+  sub rdi, 1
+  add rsi, rdi
+  mov rax, rsi
+.L.return.counter:
+  ret
@@ -0,0 +1,18 @@
+170
+ccc-codegen-19 0 1
+ long table_size ( void ) { return sizeof ( table ) / sizeof ( table [ 0 ] ) ; }
+table_size: var 0 (10 1 1 0 0(5 8 8 0 0))
+table: var 0 (8 40 8 5 0#1)
+.text
+.p2align 4
+.global table_size
+table_size:
+  mov rsi, 40
+  mov rdi, rsi
+  sar rdi, 63
+  and rdi, 7
+  add rsi, rdi
+  sar rsi, 3
+  mov rax, rsi
+.L.return.table_size:
+  ret
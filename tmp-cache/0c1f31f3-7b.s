@@ -0,0 +1,15 @@
+123
+ccc-codegen-19 0 1
+ int param_decay ( int x [ ] ) { return x [ 0 ] ; }
+param_decay: var 0 (10 1 1 0 0(4 4 4 0 0))
+x: local
+.text
+.p2align 4
+.global param_decay
+param_decay:
+  mov rsi, rdi
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov rax, rsi
+.L.return.param_decay:
+  ret
@@ -0,0 +1,21 @@
+158
+ccc-codegen-19 0 1
+ int skip_to ( int x ) { if ( x > 5 ) goto big ; return x ; big : return x * 10 ; }
+skip_to: var 0 (10 1 1 0 0(4 4 4 0 0))
+x: local
+big: ?
+.text
+.p2align 4
+.global skip_to
+skip_to:
+  movsxd rdi, edi
+  cmp rdi, 5
+  jg .L.label.skip_to.big
+  mov rax, rdi
+  jmp .L.return.skip_to
+.L.label.skip_to.big:
+  lea rsi, [rdi+rdi*4]
+  shl rsi, 1
+  mov rax, rsi
+.L.return.skip_to:
+  ret
@@ -0,0 +1,36 @@
+248
+ccc-codegen-19 0 1
+ int count_stored ( int n ) { loop_g = 0 ; int sum = 0 ; for ( int i = 0 ; i < n ; i ++ ) { sum += loop_g ; loop_g = loop_g + 2 ; } return sum ; }
+count_stored: var 0 (10 1 1 0 0(4 4 4 0 0))
+n: local
+loop_g: var 0 #1
+sum: ?
+i: ?
+.text
+.p2align 4
+.global count_stored
+count_stored:
+  movsxd rdi, edi
+  mov dword ptr [rip+loop_g], 0
+  mov r8, 0
+  mov rsi, 0
+  cmp rsi, rdi
+  jge .L.break.count_stored.3
+  .p2align 4,,10
+.L.begin.count_stored.4:
+  movsxd r9, dword ptr [rip+loop_g]
+  mov r10, r8
+  add r10, r9
+  movsxd r10, r10d
+  mov r8, r10
+  add dword ptr [rip+loop_g], 2
+  mov r9, rsi
+  add r9, 1
+  movsxd r9, r9d
+  mov rsi, r9
+  cmp rsi, rdi
+  jl .L.begin.count_stored.4
+.L.break.count_stored.3:
+  mov rax, r8
+.L.return.count_stored:
+  ret
@@ -0,0 +1,25 @@
+158
+ccc-codegen-19 0 1
+ int classify ( int x ) { if ( x < 0 ) return - 1 ; if ( x == 0 ) return 0 ; return 1 ; }
+classify: var 0 (10 1 1 0 0(4 4 4 0 0))
+x: local
+.text
+.p2align 4
+.global classify
+classify:
+  movsxd rdi, edi
+  cmp rdi, 0
+  jge .L.end.classify.2
+  mov rsi, 0
+  sub rsi, 1
+  mov rax, rsi
+  jmp .L.return.classify
+.L.end.classify.2:
+  cmp rdi, 0
+  jne .L.end.classify.3
+  mov rax, 0
+  jmp .L.return.classify
+.L.end.classify.3:
+  mov rax, 1
+.L.return.classify:
+  ret
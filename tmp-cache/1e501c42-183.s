@@ -0,0 +1,97 @@
+387
+ccc-codegen-19 0 1
+ int assert ( long expected , long actual , char * code ) { if ( expected == actual ) { printf ( "%s => %ld\n" , code , actual ) ; } else { printf ( "%s => %ld expected but got %ld\n" , code , expected , actual ) ; exit ( 1 ) ; } }
+assert: var 0 (10 1 1 0 0(4 4 4 0 0))
+expected: local
+actual: local
+code: local
+printf: var 0 (10 1 1 0 0#1)
+exit: var 0 (10 1 1 0 0#1)
+.bss
+.data
+.align 1
+.L.data.assert.1:
+  .byte 37
+  .byte 115
+  .byte 32
+  .byte 61
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 32
+  .byte 101
+  .byte 120
+  .byte 112
+  .byte 101
+  .byte 99
+  .byte 116
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 98
+  .byte 117
+  .byte 116
+  .byte 32
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 10
+  .byte 0
+.align 1
+.L.data.assert.0:
+  .byte 37
+  .byte 115
+  .byte 32
+  .byte 61
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 10
+  .byte 0
+.text
+.p2align 4
+.global assert
+assert:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-8], rbx
+  mov qword ptr [rbp-16], r12
+  mov qword ptr [rbp-24], r13
+  mov r13, rdi
+  mov r12, rsi
+  mov rbx, rdx
+  cmp r13, r12
+  jne .L.else.assert.2
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, rbx
+  mov rdx, r12
+  mov rax, 0
+  call printf
+  jmp .L.end.assert.3
+.L.else.assert.2:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, rbx
+  mov rdx, r13
+  mov rcx, r12
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.assert.3:
+.L.return.assert:
+  mov rbx, qword ptr [rbp-8]
+  mov r12, qword ptr [rbp-16]
+  mov r13, qword ptr [rbp-24]
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,34 @@
+202
+ccc-codegen-19 0 1
+ int sum_deref ( int * p , int n ) { int sum = 0 ; for ( int i = 0 ; i < n ; i ++ ) sum += * p ; return sum ; }
+sum_deref: var 0 (10 1 1 0 0(4 4 4 0 0))
+p: local
+n: local
+sum: ?
+i: ?
+.text
+.p2align 4
+.global sum_deref
+sum_deref:
+  movsxd rsi, esi
+  mov r9, 0
+  mov r8, 0
+  cmp r8, rsi
+  jge .L.break.sum_deref.3
+  .p2align 4,,10
+.L.begin.sum_deref.4:
+  movsxd r10, dword ptr [rdi]
+  mov r11, r9
+  add r11, r10
+  movsxd r11, r11d
+  mov r9, r11
+  mov r10, r8
+  add r10, 1
+  movsxd r10, r10d
+  mov r8, r10
+  cmp r8, rsi
+  jl .L.begin.sum_deref.4
+.L.break.sum_deref.3:
+  mov rax, r9
+.L.return.sum_deref:
+  ret
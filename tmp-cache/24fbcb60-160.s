@@ -0,0 +1,69 @@
+352
+ccc-codegen-19 0 1
+ int rotate6 ( int a , int b , int c , int d , int e , int f ) { for ( int i = 0 ; i < 3 ; i ++ ) { int t = a ; a = b ; b = c ; c = d ; d = e ; e = f ; f = t ; } return a * 100000 + b * 10000 + c * 1000 + d * 100 + e * 10 + f ; }
+rotate6: var 0 (10 1 1 0 0(4 4 4 0 0))
+a: local
+b: local
+c: local
+d: local
+e: local
+f: local
+i: ?
+t: ?
+.text
+.p2align 4
+.global rotate6
+rotate6:
+  push rbp
+  mov rbp, rsp
+  mov dword ptr [rbp-12], edi
+  mov dword ptr [rbp-8], esi
+  mov r11, rdx
+  movsxd r11, r11d
+  movsxd rcx, ecx
+  movsxd r8, r8d
+  movsxd r9, r9d
+  mov r10, 0
+  cmp r10, 3
+  jge .L.break.rotate6.3
+  .p2align 4,,10
+.L.begin.rotate6.4:
+  movsxd rsi, dword ptr [rbp-12]
+  mov dword ptr [rbp-4], esi
+  movsxd rsi, dword ptr [rbp-8]
+  mov dword ptr [rbp-12], esi
+  mov dword ptr [rbp-8], r11d
+  movsxd rsi, ecx
+  mov r11, rsi
+  movsxd rsi, r8d
+  mov rcx, rsi
+  movsxd rsi, r9d
+  mov r8, rsi
+  movsxd rsi, dword ptr [rbp-4]
+  movsxd rsi, esi
+  mov r9, rsi
+  mov rsi, r10
+  add rsi, 1
+  movsxd rsi, esi
+  mov r10, rsi
+  cmp r10, 3
+  jl .L.begin.rotate6.4
+.L.break.rotate6.3:
+  movsxd rsi, dword ptr [rbp-12]
+  imul rsi, 100000
+  movsxd rdi, dword ptr [rbp-8]
+  imul rdi, 10000
+  add rsi, rdi
+  mov rdi, r11
+  imul rdi, 1000
+  add rsi, rdi
+  mov rdi, rcx
+  imul rdi, 100
+  add rsi, rdi
+  lea rdi, [r8+r8*4]
+  lea rsi, [rsi+rdi*2]
+  add rsi, r9
+  mov rax, rsi
+.L.return.rotate6:
+  pop rbp
+  ret
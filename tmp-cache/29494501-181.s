@@ -0,0 +1,48 @@
+385
+ccc-codegen-19 0 1
+ char * fmt ( char * buf , char * fmt , ... ) { va_list ap ; __builtin_va_start ( ap ) ; vsprintf ( buf , fmt , ap ) ; return buf ; }
+fmt: local
+buf: local
+va_list: typedef (8 24 8 1 0(9 24 8 0 0 gp_offset@0(4 4 4 0 0) fp_offset@4#2 overflow_arg_area@8(7 8 8 0 0(0 1 1 0 0)) reg_save_area@16(7 8 8 0 0#4)))
+ap: ?
+__builtin_va_start: ?
+vsprintf: var 0 (10 1 1 0 0#2)
+.text
+.p2align 4
+.global fmt
+fmt:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov qword ptr [rbp-88], rbx
+  mov qword ptr [rbp-96], r12
+  mov dword ptr [rbp-8], 16
+  mov qword ptr [rbp-16], r9
+  mov qword ptr [rbp-24], r8
+  mov qword ptr [rbp-32], rcx
+  mov qword ptr [rbp-40], rdx
+  mov qword ptr [rbp-48], rsi
+  mov qword ptr [rbp-56], rdi
+  mov r12, rdi
+  mov rbx, rsi
+  lea rsi, [rbp-80]
+  mov edi, dword ptr [rbp-8]
+  mov dword ptr [rsi], edi
+  mov dword ptr [rsi+4], 48
+  lea rdi, [rbp+16]
+  mov qword ptr [rsi+8], rdi
+  lea rdi, [rbp-56]
+  mov qword ptr [rsi+16], rdi
+  lea r8, [rbp-80]
+  mov rdi, r12
+  mov rsi, rbx
+  mov rdx, r8
+  mov rax, 0
+  call vsprintf
+  mov rax, r12
+.L.return.fmt:
+  mov rbx, qword ptr [rbp-88]
+  mov r12, qword ptr [rbp-96]
+  mov rsp, rbp
+  pop rbp
+  ret
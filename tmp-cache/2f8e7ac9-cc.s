@@ -0,0 +1,33 @@
+204
+ccc-codegen-19 0 1
+ int add6 ( int a , int b , int c , int d , int e , int f ) { return a + b + c + d + e + f ; }
+add6: var 0 (10 1 1 0 0(4 4 4 0 0))
+a: local
+b: local
+c: local
+d: local
+e: local
+f: local
+.text
+.p2align 4
+.global add6
+add6:
+  push rbp
+  mov rbp, rsp
+  mov dword ptr [rbp-4], edi
+  movsxd rsi, esi
+  mov r10, rdx
+  movsxd r10, r10d
+  movsxd rcx, ecx
+  movsxd r8, r8d
+  movsxd r9, r9d
+  movsxd rdi, dword ptr [rbp-4]
+  add rdi, rsi
+  add rdi, r10
+  add rdi, rcx
+  add rdi, r8
+  add rdi, r9
+  mov rax, rdi
+.L.return.add6:
+  pop rbp
+  ret
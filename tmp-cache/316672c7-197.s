@@ -0,0 +1,98 @@
+407
+ccc-codegen-19 0 1
+ long sum_grid ( int n , int m ) { for ( int i = 0 ; i < n ; i ++ ) for ( int j = 0 ; j < m ; j ++ ) grid [ i ] [ j ] = i * 10 + j ; long sum = 0 ; for ( int i = 0 ; i < n ; i ++ ) for ( int j = 0 ; j < m ; j ++ ) sum += grid [ i ] [ j ] * g6 ; return sum ; }
+sum_grid: var 0 (10 1 1 0 0(5 8 8 0 0))
+n: local
+m: local
+i: ?
+j: ?
+grid: var 0 (8 160 8 4 0(8 40 8 5 0#1))
+sum: ?
+g6: var 0 #1
+.text
+.p2align 4
+.global sum_grid
+sum_grid:
+  push rbp
+  mov rbp, rsp
+  mov qword ptr [rbp-24], rbx
+  mov qword ptr [rbp-32], r12
+  mov dword ptr [rbp-12], edi
+  movsxd rsi, esi
+  mov r11, 0
+  mov rdi, r11
+  movsxd rcx, dword ptr [rbp-12]
+  cmp rdi, rcx
+  jge .L.break.sum_grid.3
+  movsxd rdi, dword ptr [rbp-12]
+  .p2align 4,,10
+.L.begin.sum_grid.4:
+  mov r10, 0
+  cmp r10, rsi
+  jge .L.break.sum_grid.6
+  lea rcx, [r11+r11*4]
+  .p2align 4,,10
+.L.begin.sum_grid.7:
+  lea rbx, [rip+grid]
+  lea rbx, [rbx+rcx*8]
+  lea rbx, [rbx+r10*8]
+  lea r12, [r11+r11*4]
+  shl r12, 1
+  add r12, r10
+  mov qword ptr [rbx], r12
+  mov rbx, r10
+  add rbx, 1
+  movsxd rbx, ebx
+  mov r10, rbx
+  cmp r10, rsi
+  jl .L.begin.sum_grid.7
+.L.break.sum_grid.6:
+  mov rcx, r11
+  add rcx, 1
+  movsxd rcx, ecx
+  mov r11, rcx
+  mov rcx, r11
+  cmp rcx, rdi
+  jl .L.begin.sum_grid.4
+.L.break.sum_grid.3:
+  mov qword ptr [rbp-8], 0
+  mov r9, 0
+  mov rdi, r9
+  movsxd rcx, dword ptr [rbp-12]
+  cmp rdi, rcx
+  jge .L.break.sum_grid.9
+  movsxd rdi, dword ptr [rbp-12]
+  .p2align 4,,10
+.L.begin.sum_grid.10:
+  mov r8, 0
+  cmp r8, rsi
+  jge .L.break.sum_grid.12
+  lea rcx, [rip+grid]
+  lea rbx, [r9+r9*4]
+  lea rcx, [rcx+rbx*8]
+  .p2align 4,,10
+.L.begin.sum_grid.13:
+  mov rbx, qword ptr [rcx+r8*8]
+  imul rbx, qword ptr [rip+g6]
+  add qword ptr [rbp-8], rbx
+  mov rbx, r8
+  add rbx, 1
+  movsxd rbx, ebx
+  mov r8, rbx
+  cmp r8, rsi
+  jl .L.begin.sum_grid.13
+.L.break.sum_grid.12:
+  mov rcx, r9
+  add rcx, 1
+  movsxd rcx, ecx
+  mov r9, rcx
+  mov rcx, r9
+  cmp rcx, rdi
+  jl .L.begin.sum_grid.10
+.L.break.sum_grid.9:
+  mov rax, qword ptr [rbp-8]
+.L.return.sum_grid:
+  mov rbx, qword ptr [rbp-24]
+  mov r12, qword ptr [rbp-32]
+  pop rbp
+  ret
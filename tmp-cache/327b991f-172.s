@@ -0,0 +1,25 @@
+370
+ccc-codegen-19 0 1
+ long table_last ( void ) { return table [ table_size ( ) - 1 ] ; }
+table_last: var 0 (10 1 1 0 0(5 8 8 0 0))
+table: var 0 (8 32 8 4 0#1)
+table_size: var 0 (10 1 1 0 0#1) inline {ccc-codegen-19 0 1
+ long table_size ( void ) { return sizeof ( table ) / sizeof ( table [ 0 ] ) ; }
+table_size: var 0 (10 1 1 0 0(5 8 8 0 0))
+table: var 0 (8 32 8 4 0#1)
+}
+.text
+.p2align 4
+.global table_last
+table_last:
+  lea rsi, [rip+table]
+  mov rdi, 32
+  mov r8, rdi
+  sar r8, 63
+  and r8, 7
+  add rdi, r8
+  sar rdi, 3
+  sub rdi, 1
+  mov rax, qword ptr [rsi+rdi*8]
+.L.return.table_last:
+  ret
@@ -0,0 +1,10 @@
+83
+ccc-codegen-19 0 1
+ void voidfn ( void ) { }
+voidfn: var 0 (10 1 1 0 0(0 1 1 0 0))
+.text
+.p2align 4
+.global voidfn
+voidfn:
+.L.return.voidfn:
+  ret
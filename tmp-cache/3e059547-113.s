@@ -0,0 +1,51 @@
+275
+ccc-codegen-19 0 1
+ long mix_params ( long a , long b , long c , long d , long e , long f ) { long q = a / b ; long r = c << d ; return q * 1000 + r + e - f + c / d ; }
+mix_params: var 0 (10 1 1 0 0(5 8 8 0 0))
+a: local
+b: local
+c: local
+d: local
+e: local
+f: local
+q: ?
+r: ?
+.text
+.p2align 4
+.global mix_params
+mix_params:
+  push rbp
+  mov rbp, rsp
+  mov qword ptr [rbp-32], rbx
+  mov qword ptr [rbp-40], r12
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r12, rdx
+  mov rbx, rcx
+  mov qword ptr [rbp-8], r8
+  mov rsi, qword ptr [rbp-24]
+  mov rdi, qword ptr [rbp-16]
+  mov rax, rsi
+  cqo
+  idiv rdi
+  mov r11, rax
+  mov rsi, r12
+  mov rcx, rbx
+  shl rsi, cl
+  mov r10, rsi
+  mov rsi, r11
+  imul rsi, 1000
+  add rsi, r10
+  add rsi, qword ptr [rbp-8]
+  sub rsi, r9
+  mov rdi, r12
+  mov rax, rdi
+  cqo
+  idiv rbx
+  add rsi, rax
+  mov rax, rsi
+.L.return.mix_params:
+  mov rbx, qword ptr [rbp-32]
+  mov r12, qword ptr [rbp-40]
+  pop rbp
+  ret
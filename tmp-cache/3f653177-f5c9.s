@@ -0,0 +1,41029 @@
+62921
+ccc-codegen-19 0 1
+ int main ( ) { assert ( 8 , ( { int a = 3 ; int z = 5 ; a + z ; } ) , "int a=3; int z=5; a+z;" ) ; assert ( 0 , 0 , "0" ) ; assert ( 42 , 42 , "42" ) ; assert ( 5 , 5 , "0" ) ; assert ( 41 , 12 + 34 - 5 , " 12 + 34 - 5 " ) ; assert ( 5 , 5 , "0" ) ; assert ( 15 , 5 * ( 9 - 6 ) , "5*(9-6)" ) ; assert ( 4 , ( 3 + 5 ) / 2 , "(3+5)/2" ) ; assert ( - 10 , - 10 , "0" ) ; assert ( 10 , - - 10 , "- -10" ) ; assert ( 10 , - - + 10 , "- - +10" ) ; assert ( 0 , 0 == 1 , "0==1" ) ; assert ( 1 , 42 == 42 , "42==42" ) ; assert ( 1 , 0 != 1 , "0!=1" ) ; assert ( 0 , 42 != 42 , "42!=42" ) ; assert ( 1 , 0 < 1 , "0<1" ) ; assert ( 0 , 1 < 1 , "1<1" ) ; assert ( 0 , 2 < 1 , "2<1" ) ; assert ( 1 , 0 <= 1 , "0<=1" ) ; assert ( 1 , 1 <= 1 , "1<=1" ) ; assert ( 0 , 2 <= 1 , "2<=1" ) ; assert ( 1 , 1 > 0 , "1>0" ) ; assert ( 0 , 1 > 1 , "1>1" ) ; assert ( 0 , 1 > 2 , "1>2" ) ; assert ( 1 , 1 >= 0 , "1>=0" ) ; assert ( 1 , 1 >= 1 , "1>=1" ) ; assert ( 0 , 1 >= 2 , "1>=2" ) ; assert ( 3 , ( { int a ; a = 3 ; a ; } ) , "int a; a=3; a;" ) ; assert ( 8 , ( { int a ; int z ; a = 3 ; z = 5 ; a + z ; } ) , "int a; int z; a=3; z=5; a+z;" ) ; assert ( 3 , ( { int a = 3 ; a ; } ) , "int a=3; a;" ) ; assert ( 8 , ( { int a = 3 ; int z = 5 ; a + z ; } ) , "int a=3; int z=5; a+z;" ) ; assert ( 3 , ( { int foo = 3 ; foo ; } ) , "int foo=3; foo;" ) ; assert ( 8 , ( { int foo123 = 3 ; int bar = 5 ; foo123 + bar ; } ) , "int foo123=3; int bar=5; foo123+bar;" ) ; assert ( 3 , ret3 ( ) , "ret3();" ) ; assert ( 3 , ( { int x = 0 ; if ( 0 ) x = 2 ; else x = 3 ; x ; } ) , "int x=0; if (0) x=2; else x=3; x;" ) ; assert ( 3 , ( { int x = 0 ; if ( 1 - 1 ) x = 2 ; else x = 3 ; x ; } ) , "int x=0; if (1-1) x=2; else x=3; x;" ) ; assert ( 2 , ( { int x = 0 ; if ( 1 ) x = 2 ; else x = 3 ; x ; } ) , "int x=0; if (1) x=2; else x=3; x;" ) ; assert ( 2 , ( { int x = 0 ; if ( 2 - 1 ) x = 2 ; else x = 3 ; x ; } ) , "int x=0; if (2-1) x=2; else x=3; x;" ) ; assert ( 3 , ( { 1 ; { 2 ; } 3 ; } ) , "1; {2;} 3;" ) ; assert ( 10 , ( { int i = 0 ; i = 0 ; while ( i < 10 ) i = i + 1 ; i ; } ) , "int i=0; i=0; while(i<10) i=i+1; i;" ) ; assert ( 55 , ( { int i = 0 ; int j = 0 ; while ( i <= 10 ) { j = i + j ; i = i + 1 ; } j ; } ) , "int i=0; int j=0; while(i<=10) {j=i+j; i=i+1;} j;" ) ; assert ( 55 , ( { int i = 0 ; int j = 0 ; for ( i = 0 ; i <= 10 ; i = i + 1 ) j = i + j ; j ; } ) , "int i=0; int j=0; for (i=0; i<=10; i=i+1) j=i+j; j;" ) ; assert ( 8 , add2 ( 3 , 5 ) , "add(3, 5)" ) ; assert ( 2 , sub2 ( 5 , 3 ) , "sub(5, 3)" ) ; assert ( 21 , add6 ( 1 , 2 , 3 , 4 , 5 , 6 ) , "add6(1,2,3,4,5,6)" ) ; assert ( 136 , 1 + ( 2 + ( 3 + ( 4 + ( 5 + ( 6 + ( 7 + ( 8 + ( 9 + ( 10 + ( 11 + ( 12 + ( 13 + ( 14 + ( 15 + 16 ) ) ) ) ) ) ) ) ) ) ) ) ) ) , "1+(2+(3+(4+(5+(6+(7+(8+(9+(10+(11+(12+(13+(14+(15+16))))))))))))))" ) ; assert ( 291054 , add2 ( 1 , add2 ( 2 , 3 ) ) * ( 4 + ( 5 * ( 6 + ( 7 * ( 8 + ( 9 * ( 10 + ( 11 * ( 12 + add6 ( 1 , 2 , 3 , 4 , 5 , 6 ) / ( add2 ( 14 , 15 ) - 13 ) ) ) ) ) ) ) ) ) ) , "add2(1,add2(2,3))*(4+(5*(6+(7*(8+(9*(10+(11*(12+add6(1,2,3,4,5,6)/(add2(14,15)-13))))))))))" ) ; assert ( 55 , fib ( 9 ) , "fib(9)" ) ; assert ( 143 , sum_fib ( 10 ) , "sum_fib(10)" ) ; assert ( 456123 , rotate6 ( 1 , 2 , 3 , 4 , 5 , 6 ) , "rotate6(1,2,3,4,5,6)" ) ; assert ( 3 , swap_args ( 2 , 5 ) , "swap_args(2, 5)" ) ; assert ( - 128 , inc_char ( 127 ) , "inc_char(127)" ) ; assert ( 240 , sum_small_array ( 2 ) , "sum_small_array(2)" ) ; assert ( 6048 , sum_large_array ( 3 ) , "sum_large_array(3)" ) ; assert ( 6288 , sum_small_array ( 2 ) + sum_large_array ( 3 ) , "sum_small_array(2) + sum_large_array(3)" ) ; assert ( 7053 , mix_params ( 100 , 14 , 3 , 2 , 50 , 10 ) , "mix_params(100, 14, 3, 2, 50, 10)" ) ; assert ( 26 , scale_call ( 1 , 2 , 3 , 4 , 5 ) , "scale_call(1, 2, 3, 4, 5)" ) ; assert ( 1 , bool_add ( 0 ) , "bool_add(0)" ) ; assert ( 411 , bool_inc_loop ( "\0" ) , "bool_inc_loop(\"\\0\")" ) ; assert ( 1 , switch_wide ( 3000000000 ) , "switch_wide(3000000000)" ) ; assert ( 2 , switch_wide ( - 3000000000 ) , "switch_wide(-3000000000)" ) ; assert ( 3 , switch_wide ( 5 ) , "switch_wide(5)" ) ; assert ( 0 , switch_wide ( - 1294967296 ) , "switch_wide(-1294967296)" ) ; assert ( 1 , switch_wide_split ( - 3000000000 ) , "switch_wide_split(-3000000000)" ) ; assert ( 4 , switch_wide_split ( 3000000000 ) , "switch_wide_split(3000000000)" ) ; assert ( 5 , switch_wide_split ( 7000000000 ) , "switch_wide_split(7000000000)" ) ; assert ( 0 , switch_wide_split ( 6 ) , "switch_wide_split(6)" ) ; assert ( 1 , switch_wide_table ( 3000000000 ) , "switch_wide_table(3000000000)" ) ; assert ( 4 , switch_wide_table ( 3000000004 ) , "switch_wide_table(3000000004)" ) ; assert ( 0 , switch_wide_table ( 3000000003 ) , "switch_wide_table(3000000003)" ) ; assert ( 0 , switch_wide_table ( 4 ) , "switch_wide_table(4)" ) ; assert ( 1 , switch_int ( - 1294967296 ) , "switch_int(-1294967296)" ) ; assert ( 7864346 , ( { spill_g [ 1 ] = 3 ; spill_addr ( 1 , 1 , 2 , 3 , 4 , 5 ) ; } ) , "spill_g[1]=3; spill_addr(1, 1, 2, 3, 4, 5);" ) ; assert ( - 1 , classify ( - 5 ) , "classify(-5)" ) ; assert ( 0 , classify ( 0 ) , "classify(0)" ) ; assert ( 1 , classify ( 7 ) , "classify(7)" ) ; assert ( 1 , classify ( 3 ) + classify ( - 2 ) + classify ( 9 ) , "classify(3)+classify(-2)+classify(9)" ) ; assert ( 2 , day_kind ( 0 ) , "day_kind(0)" ) ; assert ( 2 , day_kind ( 6 ) , "day_kind(6)" ) ; assert ( 1 , day_kind ( 3 ) , "day_kind(3)" ) ; assert ( 0 , day_kind ( 4 ) , "day_kind(4)" ) ; assert ( 3 , skip_to ( 3 ) , "skip_to(3)" ) ; assert ( 70 , skip_to ( 7 ) , "skip_to(7)" ) ; assert ( 83 , skip_to ( 3 ) + skip_to ( 8 ) , "skip_to(3)+skip_to(8)" ) ; assert ( 2040 , sum_grid ( 4 , 5 ) , "sum_grid(4, 5)" ) ; assert ( 0 , sum_grid ( 0 , 5 ) , "sum_grid(0, 5)" ) ; assert ( 20 , count_stored ( 5 ) , "count_stored(5)" ) ; assert ( 10 , ( { loop_g = 1 ; sum_through ( & loop_g , 4 ) ; } ) , "loop_g=1; sum_through(&loop_g, 4);" ) ; assert ( 8 , ( { int x = 0 ; loop_g = 2 ; sum_through ( & x , 4 ) ; } ) , "int x=0; loop_g=2; sum_through(&x, 4);" ) ; assert ( 10 , sum_local_through ( 4 ) , "sum_local_through(4)" ) ; assert ( 0 , sum_deref ( 0 , 0 ) , "sum_deref(0, 0)" ) ; assert ( 21 , ( { int x = 7 ; sum_deref ( & x , 3 ) ; } ) , "int x=7; sum_deref(&x, 3);" ) ; assert ( 2 , ( { int i = 0 ; bump ( & i ) ; bump ( & i ) ; i ; } ) , "({ int i=0; bump(&i); bump(&i); i; })" ) ; assert ( 64 , ( { int i = 3 ; int j = twice ( i ++ ) ; j * 10 + i ; } ) , "({ int i=3; int j=twice(i++); j*10+i; })" ) ; assert ( 24 , twice ( twice ( twice ( 3 ) ) ) , "twice(twice(twice(3)))" ) ; assert ( 3 , ( { int x = 3 ; * & x ; } ) , "int x=3; *&x;" ) ; assert ( 3 , ( { int x = 3 ; int * y = & x ; int * * z = & y ; * * z ; } ) , "int x=3; int *y=&x; int **z=&y; **z;" ) ; assert ( 5 , ( { int x = 3 ; int y = 5 ; * ( & x + 1 ) ; } ) , "int x=3; int y=5; *(&x+1);" ) ; assert ( 5 , ( { int x = 3 ; int y = 5 ; * ( 1 + & x ) ; } ) , "int x=3; int y=5; *(1+&x);" ) ; assert ( 3 , ( { int x = 3 ; int y = 5 ; * ( & y - 1 ) ; } ) , "int x=3; int y=5; *(&y-1);" ) ; assert ( 2 , ( { int x = 3 ; ( & x + 2 ) - & x ; } ) , "int x=3; (&x+2)-&x;" ) ; assert ( 5 , ( { int x = 3 ; int y = 5 ; int * z = & x ; * ( z + 1 ) ; } ) , "int x=3; int y=5; int *z=&x; *(z+1);" ) ; assert ( 3 , ( { int x = 3 ; int y = 5 ; int * z = & y ; * ( z - 1 ) ; } ) , "int x=3; int y=5; int *z=&y; *(z-1);" ) ; assert ( 5 , ( { int x = 3 ; int * y = & x ; * y = 5 ; x ; } ) , "int x=3; int *y=&x; *y=5; x;" ) ; assert ( 7 , ( { int x = 3 ; int y = 5 ; * ( & x + 1 ) = 7 ; y ; } ) , "int x=3; int y=5; *(&x+1)=7; y;" ) ; assert ( 7 , ( { int x = 3 ; int y = 5 ; * ( & y - 1 ) = 7 ; x ; } ) , "int x=3; int y=5; *(&y-1)=7; x;" ) ; assert ( 8 , ( { int x = 3 ; int y = 5 ; addx ( & x , y ) ; } ) , "int x=3; int y=5; addx(&x, y);" ) ; assert ( 3 , ( { int x [ 2 ] ; int * y = & x ; * y = 3 ; * x ; } ) , "int x[2]; int *y=&x; *y=3; *x;" ) ; assert ( 3 , ( { int x [ 3 ] ; * x = 3 ; * ( x + 1 ) = 4 ; * ( x + 2 ) = 5 ; * x ; } ) , "int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *x;" ) ; assert ( 4 , ( { int x [ 3 ] ; * x = 3 ; * ( x + 1 ) = 4 ; * ( x + 2 ) = 5 ; * ( x + 1 ) ; } ) , "int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *(x+1);" ) ; assert ( 5 , ( { int x [ 3 ] ; * x = 3 ; * ( x + 1 ) = 4 ; * ( x + 2 ) = 5 ; * ( x + 2 ) ; } ) , "int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *(x+2);" ) ; assert ( 0 , ( { int x [ 2 ] [ 3 ] ; int * y = x ; * y = 0 ; * * x ; } ) , "int x[2][3]; int *y=x; *y=0; **x;" ) ; assert ( 1 , ( { int x [ 2 ] [ 3 ] ; int * y = x ; * ( y + 1 ) = 1 ; * ( * x + 1 ) ; } ) , "int x[2][3]; int *y=x; *(y+1)=1; *(*x+1);" ) ; assert ( 2 , ( { int x [ 2 ] [ 3 ] ; int * y = x ; * ( y + 2 ) = 2 ; * ( * x + 2 ) ; } ) , "int x[2][3]; int *y=x; *(y+2)=2; *(*x+2);" ) ; assert ( 3 , ( { int x [ 2 ] [ 3 ] ; int * y = x ; * ( y + 3 ) = 3 ; * * ( x + 1 ) ; } ) , "int x[2][3]; int *y=x; *(y+3)=3; **(x+1);" ) ; assert ( 4 , ( { int x [ 2 ] [ 3 ] ; int * y = x ; * ( y + 4 ) = 4 ; * ( * ( x + 1 ) + 1 ) ; } ) , "int x[2][3]; int *y=x; *(y+4)=4; *(*(x+1)+1);" ) ; assert ( 5 , ( { int x [ 2 ] [ 3 ] ; int * y = x ; * ( y + 5 ) = 5 ; * ( * ( x + 1 ) + 2 ) ; } ) , "int x[2][3]; int *y=x; *(y+5)=5; *(*(x+1)+2);" ) ; assert ( 6 , ( { int x [ 2 ] [ 3 ] ; int * y = x ; * ( y + 6 ) = 6 ; * * ( x + 2 ) ; } ) , "int x[2][3]; int *y=x; *(y+6)=6; **(x+2);" ) ; assert ( 3 , ( { int x [ 3 ] ; * x = 3 ; x [ 1 ] = 4 ; x [ 2 ] = 5 ; * x ; } ) , "int x[3]; *x=3; x[1]=4; x[2]=5; *x;" ) ; assert ( 4 , ( { int x [ 3 ] ; * x = 3 ; x [ 1 ] = 4 ; x [ 2 ] = 5 ; * ( x + 1 ) ; } ) , "int x[3]; *x=3; x[1]=4; x[2]=5; *(x+1);" ) ; assert ( 5 , ( { int x [ 3 ] ; * x = 3 ; x [ 1 ] = 4 ; x [ 2 ] = 5 ; * ( x + 2 ) ; } ) , "int x[3]; *x=3; x[1]=4; x[2]=5; *(x+2);" ) ; assert ( 5 , ( { int x [ 3 ] ; * x = 3 ; x [ 1 ] = 4 ; x [ 2 ] = 5 ; * ( x + 2 ) ; } ) , "int x[3]; *x=3; x[1]=4; x[2]=5; *(x+2);" ) ; assert ( 5 , ( { int x [ 3 ] ; * x = 3 ; x [ 1 ] = 4 ; 2 [ x ] = 5 ; * ( x + 2 ) ; } ) , "int x[3]; *x=3; x[1]=4; 2[x]=5; *(x+2);" ) ; assert ( 0 , ( { int x [ 2 ] [ 3 ] ; int * y = x ; y [ 0 ] = 0 ; x [ 0 ] [ 0 ] ; } ) , "int x[2][3]; int *y=x; y[0]=0; x[0][0];" ) ; assert ( 1 , ( { int x [ 2 ] [ 3 ] ; int * y = x ; y [ 1 ] = 1 ; x [ 0 ] [ 1 ] ; } ) , "int x[2][3]; int *y=x; y[1]=1; x[0][1];" ) ; assert ( 2 , ( { int x [ 2 ] [ 3 ] ; int * y = x ; y [ 2 ] = 2 ; x [ 0 ] [ 2 ] ; } ) , "int x[2][3]; int *y=x; y[2]=2; x[0][2];" ) ; assert ( 3 , ( { int x [ 2 ] [ 3 ] ; int * y = x ; y [ 3 ] = 3 ; x [ 1 ] [ 0 ] ; } ) , "int x[2][3]; int *y=x; y[3]=3; x[1][0];" ) ; assert ( 4 , ( { int x [ 2 ] [ 3 ] ; int * y = x ; y [ 4 ] = 4 ; x [ 1 ] [ 1 ] ; } ) , "int x[2][3]; int *y=x; y[4]=4; x[1][1];" ) ; assert ( 5 , ( { int x [ 2 ] [ 3 ] ; int * y = x ; y [ 5 ] = 5 ; x [ 1 ] [ 2 ] ; } ) , "int x[2][3]; int *y=x; y[5]=5; x[1][2];" ) ; assert ( 6 , ( { int x [ 2 ] [ 3 ] ; int * y = x ; y [ 6 ] = 6 ; x [ 2 ] [ 0 ] ; } ) , "int x[2][3]; int *y=x; y[6]=6; x[2][0];" ) ; assert ( 4 , ( { int x ; sizeof ( x ) ; } ) , "int x; sizeof(x);" ) ; assert ( 4 , ( { int x ; sizeof x ; } ) , "int x; sizeof x;" ) ; assert ( 8 , ( { int * x ; sizeof ( x ) ; } ) , "int *x; sizeof(x);" ) ; assert ( 16 , ( { int x [ 4 ] ; sizeof ( x ) ; } ) , "int x[4]; sizeof(x);" ) ; assert ( 48 , ( { int x [ 3 ] [ 4 ] ; sizeof ( x ) ; } ) , "int x[3][4]; sizeof(x);" ) ; assert ( 16 , ( { int x [ 3 ] [ 4 ] ; sizeof ( * x ) ; } ) , "int x[3][4]; sizeof(*x);" ) ; assert ( 4 , ( { int x [ 3 ] [ 4 ] ; sizeof ( * * x ) ; } ) , "int x[3][4]; sizeof(**x);" ) ; assert ( 5 , ( { int x [ 3 ] [ 4 ] ; sizeof ( * * x ) + 1 ; } ) , "int x[3][4]; sizeof(**x) + 1;" ) ; assert ( 5 , ( { int x [ 3 ] [ 4 ] ; sizeof * * x + 1 ; } ) , "int x[3][4]; sizeof **x + 1;" ) ; assert ( 8 , ( { int x [ 3 ] [ 4 ] ; sizeof ( * * x + 1 ) ; } ) , "int x[3][4]; sizeof(**x + 1);" ) ; assert ( 0 , g1 , "g1" ) ; g1 = 3 ; assert ( 3 , g1 , "g1" ) ; g2 [ 0 ] = 0 ; g2 [ 1 ] = 1 ; g2 [ 2 ] = 2 ; g2 [ 3 ] = 3 ; assert ( 0 , g2 [ 0 ] , "g2[0]" ) ; assert ( 1 , g2 [ 1 ] , "g2[1]" ) ; assert ( 2 , g2 [ 2 ] , "g2[2]" ) ; assert ( 3 , g2 [ 3 ] , "g2[3]" ) ; assert ( 4 , sizeof ( g1 ) , "sizeof(g1)" ) ; assert ( 16 , sizeof ( g2 ) , "sizeof(g2)" ) ; assert ( 1 , ( { char x = 1 ; x ; } ) , "char x=1; x;" ) ; assert ( 1 , ( { char x = 1 ; char y = 2 ; x ; } ) , "char x=1; char y=2; x;" ) ; assert ( 2 , ( { char x = 1 ; char y = 2 ; y ; } ) , "char x=1; char y=2; y;" ) ; assert ( 1 , ( { char x ; sizeof ( x ) ; } ) , "char x; sizeof(x);" ) ; assert ( 10 , ( { char x [ 10 ] ; sizeof ( x ) ; } ) , "char x[10]; sizeof(x);" ) ; assert ( 1 , sub_char ( 7 , 3 , 3 ) , "sub_char(7, 3, 3)" ) ; assert ( 97 , "abc" [ 0 ] , "\"abc\"[0]" ) ; assert ( 98 , "abc" [ 1 ] , "\"abc\"[1]" ) ; assert ( 99 , "abc" [ 2 ] , "\"abc\"[2]" ) ; assert ( 0 , "abc" [ 3 ] , "\"abc\"[3]" ) ; assert ( 4 , sizeof ( "abc" ) , "sizeof(\"abc\")" ) ; assert ( 7 , "\a" [ 0 ] , "\"\\a\"[0]" ) ; assert ( 8 , "\b" [ 0 ] , "\"\\b\"[0]" ) ; assert ( 9 , "\t" [ 0 ] , "\"\\t\"[0]" ) ; assert ( 10 , "\n" [ 0 ] , "\"\\n\"[0]" ) ; assert ( 11 , "\v" [ 0 ] , "\"\\v\"[0]" ) ; assert ( 12 , "\f" [ 0 ] , "\"\\f\"[0]" ) ; assert ( 13 , "\r" [ 0 ] , "\"\\r\"[0]" ) ; assert ( 27 , "\e" [ 0 ] , "\"\\e\"[0]" ) ; assert ( 0 , "\0" [ 0 ] , "\"\\0\"[0]" ) ; assert ( 106 , "\j" [ 0 ] , "\"\\j\"[0]" ) ; assert ( 107 , "\k" [ 0 ] , "\"\\k\"[0]" ) ; assert ( 108 , "\l" [ 0 ] , "\"\\l\"[0]" ) ; assert ( 2 , ( { int x = 2 ; { int x = 3 ; } x ; } ) , "int x=2; { int x=3; } x;" ) ; assert ( 2 , ( { int x = 2 ; { int x = 3 ; } int y = 4 ; x ; } ) , "int x=2; { int x=3; } int y=4; x;" ) ; assert ( 3 , ( { int x = 2 ; { x = 3 ; } x ; } ) , "int x=2; { x=3; } x;" ) ; assert ( 2 , ( { int x [ 5 ] ; int * y = x + 2 ; y - x ; } ) , "int x[5]; int *y=x+2; y-x;" ) ; assert ( 1 , ( { struct { int a ; int b ; } x ; x . a = 1 ; x . b = 2 ; x . a ; } ) , "struct {int a; int b;} x; x.a=1; x.b=2; x.a;" ) ; assert ( 2 , ( { struct { int a ; int b ; } x ; x . a = 1 ; x . b = 2 ; x . b ; } ) , "struct {int a; int b;} x; x.a=1; x.b=2; x.b;" ) ; assert ( 1 , ( { struct { char a ; int b ; char c ; } x ; x . a = 1 ; x . b = 2 ; x . c = 3 ; x . a ; } ) , "struct {char a; int b; char c;} x; x.a=1; x.b=2; x.c=3; x.a;" ) ; assert ( 2 , ( { struct { char a ; int b ; char c ; } x ; x . b = 1 ; x . b = 2 ; x . c = 3 ; x . b ; } ) , "struct {char a; int b; char c;} a; x.b=x; x.a=2; x.b=3; x.b;" ) ; assert ( 3 , ( { struct { char a ; int b ; char c ; } x ; x . a = 1 ; x . b = 2 ; x . c = 3 ; x . c ; } ) , "struct {char a; int b; char c;} x; x.a=1; x.b=2; x.c=3; x.c;" ) ; assert ( 0 , ( { struct { int a ; int b ; } x [ 3 ] ; int * p = x ; p [ 0 ] = 0 ; x [ 0 ] . a ; } ) , "struct {int a; int b;} x[3]; int *p=x; p[0]=0; x[0].a;" ) ; assert ( 1 , ( { struct { int a ; int b ; } x [ 3 ] ; int * p = x ; p [ 1 ] = 1 ; x [ 0 ] . b ; } ) , "struct {int a; int b;} x[3]; int *p=x; p[1]=1; x[0].b;" ) ; assert ( 2 , ( { struct { int a ; int b ; } x [ 3 ] ; int * p = x ; p [ 2 ] = 2 ; x [ 1 ] . a ; } ) , "struct {int a; int b;} x[3]; int *p=x; p[2]=2; x[1].a;" ) ; assert ( 3 , ( { struct { int a ; int b ; } x [ 3 ] ; int * p = x ; p [ 3 ] = 3 ; x [ 1 ] . b ; } ) , "struct {int a; int b;} x[3]; int *p=x; p[3]=3; x[1].b;" ) ; assert ( 6 , ( { struct { int a [ 3 ] ; int b [ 5 ] ; } x ; int * p = & x ; x . a [ 0 ] = 6 ; p [ 0 ] ; } ) , "struct {int a[3]; int b[5];} x; int *p=&x; x.a[0]=6; p[0];" ) ; assert ( 7 , ( { struct { int a [ 3 ] ; int b [ 5 ] ; } x ; int * p = & x ; x . b [ 0 ] = 7 ; p [ 3 ] ; } ) , "struct {int a[3]; int b[5];} x; int *p=&x; x.b[0]=7; p[3];" ) ; assert ( 6 , ( { struct { struct { int b ; } a ; } x ; x . a . b = 6 ; x . a . b ; } ) , "struct { struct { int b; } a; } x; x.a.b=6; x.a.b;" ) ; assert ( 4 , ( { struct { int a ; } x ; sizeof ( x ) ; } ) , "struct {int a;} x; sizeof(x);" ) ; assert ( 8 , ( { struct { int a ; int b ; } x ; sizeof ( x ) ; } ) , "struct {int a; int b;} x; sizeof(x);" ) ; assert ( 12 , ( { struct { int a [ 3 ] ; } x ; sizeof ( x ) ; } ) , "struct {int a[3];} x; sizeof(x);" ) ; assert ( 16 , ( { struct { int a ; } x [ 4 ] ; sizeof ( x ) ; } ) , "struct {int a;} x[4]; sizeof(x);" ) ; assert ( 24 , ( { struct { int a [ 3 ] ; } x [ 2 ] ; sizeof ( x ) ; } ) , "struct {int a[3];} x[2]; sizeof(x)};" ) ; assert ( 2 , ( { struct { char a ; char b ; } x ; sizeof ( x ) ; } ) , "struct {char a; char b;} x; sizeof(x);" ) ; assert ( 8 , ( { struct { char a ; int b ; } x ; sizeof ( x ) ; } ) , "struct {char a; int b;} x; sizeof(x);" ) ; assert ( 8 , ( { struct { int a ; char b ; } x ; sizeof ( x ) ; } ) , "struct {int a; char b;} x; sizeof(x);" ) ; assert ( 7 , ( { int x ; char y ; int a = & x ; int b = & y ; b - a ; } ) , "int x; char y; int a=&x; int b=&y; b-a;" ) ; assert ( 1 , ( { char x ; int y ; int a = & x ; int b = & y ; b - a ; } ) , "char x; int y; int a=&x; int b=&y; b-a;" ) ; assert ( 2 , ( { struct t { char a [ 2 ] ; } ; { struct t { char a [ 4 ] ; } ; } struct t y ; sizeof ( y ) ; } ) , "struct t {char a[2];}; { struct t {char a[4];}; } struct t y; sizeof(y);" ) ; assert ( 3 , ( { struct t { int x ; } ; int t = 1 ; struct t y ; y . x = 2 ; t + y . x ; } ) , "struct t {int x;}; int t=1; struct t y; y.x=2; t+y.x;" ) ; assert ( 3 , ( { struct t { char a ; } x ; struct t * y = & x ; x . a = 3 ; y -> a ; } ) , "struct t {char a;} x; struct t *y = &x; x.a=3; y->a;" ) ; assert ( 3 , ( { struct t { char a ; } x ; struct t * y = & x ; y -> a = 3 ; x . a ; } ) , "struct t {char a;} x; struct t *y = &x; y->a=3; x.a;" ) ; assert ( 1 , ( { typedef int t ; t x = 1 ; x ; } ) , "typedef int t; t x=1; x;" ) ; assert ( 1 , ( { typedef struct { int a ; } t ; t x ; x . a = 1 ; x . a ; } ) , "typedef struct {int a;} t; t x; x.a=1; x.a;" ) ; assert ( 1 , ( { typedef int t ; t t = 1 ; t ; } ) , "typedef int t; t t=1; t;" ) ; assert ( 2 , ( { typedef struct { int a ; } t ; { typedef int t ; } t x ; x . a = 2 ; x . a ; } ) , "typedef struct {int a;} t; { typedef int t; } t x; x.a=2; x.a;" ) ; assert ( 8 , ( { struct t { int a ; int b ; } x ; struct t y ; sizeof ( y ) ; } ) , "struct t {int a; int b;} x; struct t y; sizeof(y);" ) ; assert ( 8 , ( { struct t { int a ; int b ; } ; struct t y ; sizeof ( y ) ; } ) , "struct t {int a; int b;}; struct t y; sizeof(y);" ) ; assert ( 2 , ( { short x ; sizeof ( x ) ; } ) , "short x; sizeof(x);" ) ; assert ( 4 , ( { struct { char a ; short b ; } x ; sizeof ( x ) ; } ) , "struct {char a; short b;} x; sizeof(x);" ) ; assert ( 8 , ( { long x ; sizeof ( x ) ; } ) , "long x; sizeof(x);" ) ; assert ( 16 , ( { struct { char a ; long b ; } x ; sizeof ( x ) ; } ) , "struct {char a; long b} x; sizeof(x);" ) ; assert ( 1 , sub_short ( 7 , 3 , 3 ) , "sub_short(7, 3, 3)" ) ; assert ( 1 , sub_long ( 7 , 3 , 3 ) , "sub_long(7, 3, 3)" ) ; assert ( 24 , ( { int * x [ 3 ] ; sizeof ( x ) ; } ) , "int *x[3]; sizeof(x);" ) ; assert ( 8 , ( { int ( * x ) [ 3 ] ; sizeof ( x ) ; } ) , "int (*x)[3]; sizeof(x);" ) ; assert ( 3 , ( { int * x [ 3 ] ; int y ; x [ 0 ] = & y ; y = 3 ; x [ 0 ] [ 0 ] ; } ) , "int *x[3]; int y; x[0]=&y; y=3; x[0][0];" ) ; assert ( 4 , ( { int x [ 3 ] ; int ( * y ) [ 3 ] = x ; y [ 0 ] [ 0 ] = 4 ; y [ 0 ] [ 0 ] ; } ) , "int x[3]; int (*y)[3]=x; y[0][0]=4; y[0][0];" ) ; assert ( 3 , * g1_ptr ( ) , "*g1_ptr()" ) ; { void * x ; } assert ( 0 , ( { _Bool x = 0 ; x ; } ) , "_Bool x=0; x;" ) ; assert ( 1 , ( { _Bool x = 1 ; x ; } ) , "_Bool x=1; x;" ) ; assert ( 1 , ( { _Bool x = 2 ; x ; } ) , "_Bool x=2; x;" ) ; assert ( 1 , ( { _Bool b = 0 ; b += 5 ; } ) , "_Bool b=0; b+=5;" ) ; assert ( 1 , ( { _Bool b = 0 ; long x = ( b = 7 ) ; x ; } ) , "_Bool b=0; long x=(b=7); x;" ) ; assert ( 1 , ( { _Bool b = 1 ; ++ b ; } ) , "_Bool b=1; ++b;" ) ; assert ( 39 , ( { int i = 0 ; int acc = 0 ; _Bool v = 1 ; while ( i < 4 ) { i ++ ; acc += ++ v ; acc *= 2 ; } acc + i * 0 + 9 ; } ) , "int i=0; int acc=0; _Bool v=1; while (i<4) { i++; acc+=++v; acc*=2; } acc+i*0+9;" ) ; assert ( 1 , ( { _Bool b = 1 ; b ++ ; } ) , "_Bool b=1; b++;" ) ; assert ( 1 , ( { _Bool b = 1 ; b ++ ; b ; } ) , "_Bool b=1; b++; b;" ) ; assert ( 0 , ( { _Bool b = 0 ; b -- ; } ) , "_Bool b=0; b--;" ) ; assert ( 1 , ( { _Bool b = 0 ; b -- ; b ; } ) , "_Bool b=0; b--; b;" ) ; assert ( 1 , ( { _Bool b = 1 ; _Bool * p = & b ; b ++ ; } ) , "_Bool b=1; _Bool *p=&b; b++;" ) ; assert ( 1 , ( { char x ; sizeof ( x ) ; } ) , "char x; sizeof(x);" ) ; assert ( 2 , ( { short int x ; sizeof ( x ) ; } ) , "short int x; sizeof(x);" ) ; assert ( 2 , ( { int short x ; sizeof ( x ) ; } ) , "int short x; sizeof(x);" ) ; assert ( 4 , ( { int x ; sizeof ( x ) ; } ) , "int x; sizeof(x);" ) ; assert ( 4 , ( { typedef t ; t x ; sizeof ( x ) ; } ) , "typedef t; t x; sizeof(x);" ) ; assert ( 4 , ( { typedef typedef t ; t x ; sizeof ( x ) ; } ) , "typedef typedef t; t x; sizeof(x);" ) ; assert ( 8 , ( { long int x ; sizeof ( x ) ; } ) , "long int x; sizeof(x);" ) ; assert ( 8 , ( { int long x ; sizeof ( x ) ; } ) , "int long x; sizeof(x);" ) ; assert ( 8 , ( { long long x ; sizeof ( x ) ; } ) , "long long x; sizeof(x);" ) ; assert ( 8 , ( { long int long x ; sizeof ( x ) ; } ) , "long int long x; sizeof(x);" ) ; assert ( 3 , ( { MyInt x = 3 ; x ; } ) , "MyInt x=3; x;" ) ; assert ( 1 , sizeof ( char ) , "sizeof(char)" ) ; assert ( 2 , sizeof ( short ) , "sizeof(short)" ) ; assert ( 2 , sizeof ( short int ) , "sizeof(short int)" ) ; assert ( 2 , sizeof ( int short ) , "sizeof(int short)" ) ; assert ( 4 , sizeof ( int ) , "sizeof(int)" ) ; assert ( 8 , sizeof ( long ) , "sizeof(long)" ) ; assert ( 8 , sizeof ( long int ) , "sizeof(long int)" ) ; assert ( 8 , sizeof ( long int ) , "sizeof(long int)" ) ; assert ( 8 , sizeof ( char * ) , "sizeof(char *)" ) ; assert ( 8 , sizeof ( int * ) , "sizeof(int *)" ) ; assert ( 8 , sizeof ( long * ) , "sizeof(long *)" ) ; assert ( 8 , sizeof ( int * * ) , "sizeof(int **)" ) ; assert ( 8 , sizeof ( int ( * ) [ 4 ] ) , "sizeof(int(*)[4])" ) ; assert ( 32 , sizeof ( int * [ 4 ] ) , "sizeof(int(*)[4])" ) ; assert ( 16 , sizeof ( int [ 4 ] ) , "sizeof(int[4])" ) ; assert ( 48 , sizeof ( int [ 3 ] [ 4 ] ) , "sizeof(int[3][4])" ) ; assert ( 8 , sizeof ( struct { int a ; int b ; } ) , "sizeof(struct {int a; int b;})" ) ; assert ( 131585 , ( int ) 8590066177 , "(int)8590066177" ) ; assert ( 513 , ( short ) 8590066177 , "(short)8590066177" ) ; assert ( 1 , ( char ) 8590066177 , "(char)8590066177" ) ; assert ( 1 , ( _Bool ) 1 , "(_Bool)1" ) ; assert ( 1 , ( _Bool ) 2 , "(_Bool)2" ) ; assert ( 0 , ( _Bool ) ( char ) 256 , "(_Bool)(char)256" ) ; assert ( 1 , ( long ) 1 , "(long)1" ) ; assert ( 0 , ( long ) & * ( int * ) 0 , "(long)&*(int *)0" ) ; assert ( 5 , ( { int x = 5 ; long y = ( long ) & x ; * ( int * ) y ; } ) , "int x=5; long y=(long)&x; *(int*)y" ) ; assert ( 97 , 'a' , "'a'" ) ; assert ( 10 , '\n' , "\'\\n\'" ) ; assert ( 98 , 'a' + 1 , "'a' + 1" ) ; assert ( 4 , sizeof ( 'a' ) , "sizeof('a')" ) ; assert ( 0 , ( { enum { zero , one , two } ; zero ; } ) , "enum { zero, one, two }; zero;" ) ; assert ( 1 , ( { enum { zero , one , two } ; one ; } ) , "enum { zero, one, two }; one;" ) ; assert ( 2 , ( { enum { zero , one , two } ; two ; } ) , "enum { zero, one, two }; two;" ) ; assert ( 5 , ( { enum { five = 5 , six , seven } ; five ; } ) , "enum { five=5, six, seven }; five;" ) ; assert ( 6 , ( { enum { five = 5 , six , seven } ; six ; } ) , "enum { five=5, six, seven }; six;" ) ; assert ( 0 , ( { enum { zero , five = 5 , three = 3 , four } ; zero ; } ) , "enum { zero, five=5, three=3, four }; zero;" ) ; assert ( 5 , ( { enum { zero , five = 5 , three = 3 , four } ; five ; } ) , "enum { zero, five=5, three=3, four }; five;" ) ; assert ( 3 , ( { enum { zero , five = 5 , three = 3 , four } ; three ; } ) , "enum { zero, five=5, three=3, four }; three;" ) ; assert ( 4 , ( { enum { zero , five = 5 , three = 3 , four } ; four ; } ) , "enum { zero, five=5, three=3, four }; four;" ) ; assert ( 4 , ( { enum { zero , one , two } x ; sizeof ( x ) ; } ) , "enum { zero, one, two } x; sizeof(x);" ) ; assert ( 4 , ( { enum t { zero , one , two } ; enum t y ; sizeof ( y ) ; } ) , "enum t { zero, one, two }; enum t y; sizeof(y);" ) ; assert ( 3 , static_fn ( ) , "static_fn()" ) ; assert ( 55 , ( { int j = 0 ; for ( int i = 0 ; i <= 10 ; i = i + 1 ) j = j + i ; j ; } ) , "int j=0; for (int i=0; i<=10; i=i+1) j=j+i; j;" ) ; assert ( 3 , ( { int i = 3 ; int j = 0 ; for ( int i = 0 ; i <= 10 ; i = i + 1 ) j = j + i ; i ; } ) , "int i=3; int j=0; for (int i=0; i<=10; i=i+1) j=j+i; i;" ) ; assert ( 3 , ( 1 , 2 , 3 ) , "(1,2,3)" ) ; assert ( 3 , ( { int i = 2 ; ++ i ; } ) , "int i=2; ++i;" ) ; assert ( 1 , ( { int i = 2 ; -- i ; } ) , "int i=2; --i;" ) ; assert ( 2 , ( { int i = 2 ; i ++ ; } ) , "int i=2; i++;" ) ; assert ( 2 , ( { int i = 2 ; i -- ; } ) , "int i=2; i--;" ) ; assert ( 3 , ( { int i = 2 ; i ++ ; i ; } ) , "int i=2; i++; i;" ) ; assert ( 1 , ( { int i = 2 ; i -- ; i ; } ) , "int i=2; i--; i;" ) ; assert ( 1 , ( { int a [ 3 ] ; a [ 0 ] = 0 ; a [ 1 ] = 1 ; a [ 2 ] = 2 ; int * p = a + 1 ; * p ++ ; } ) , "int a[3]; a[0]=0; a[1]=1; a[2]=2; int *p=a+1; *p++;" ) ; assert ( 2 , ( { int a [ 3 ] ; a [ 0 ] = 0 ; a [ 1 ] = 1 ; a [ 2 ] = 2 ; int * p = a + 1 ; ++ * p ; } ) , "int a[3]; a[0]=0; a[1]=1; a[2]=2; int *p=a+1; ++*p;" ) ; assert ( 1 , ( { int a [ 3 ] ; a [ 0 ] = 0 ; a [ 1 ] = 1 ; a [ 2 ] = 2 ; int * p = a + 1 ; * p -- ; } ) , "int a[3]; a[0]=0; a[1]=1; a[2]=2; int *p=a+1; *p--;" ) ; assert ( 0 , ( { int a [ 3 ] ; a [ 0 ] = 0 ; a [ 1 ] = 1 ; a [ 2 ] = 2 ; int * p = a + 1 ; -- * p ; } ) , "int a[3]; a[0]=0; a[1]=1; a[2]=2; int *p=a+1; --*p;" ) ; assert ( 0 , ( { int a [ 3 ] ; a [ 0 ] = 0 ; a [ 1 ] = 1 ; a [ 2 ] = 2 ; int * p = a + 1 ; ( * p ++ ) -- ; a [ 0 ] ; } ) , "int a[3]; a[0]=0; a[1]=1; a[2]=2; int *p=a+1; (*p++); a[0];" ) ; assert ( 0 , ( { int a [ 3 ] ; a [ 0 ] = 0 ; a [ 1 ] = 1 ; a [ 2 ] = 2 ; int * p = a + 1 ; ( * p ++ ) -- ; a [ 1 ] ; } ) , "int a[3]; a[0]=0; a[1]=1; a[2]=2; int *p=a+1; (*p++); a[0];" ) ; assert ( 2 , ( { int a [ 3 ] ; a [ 0 ] = 0 ; a [ 1 ] = 1 ; a [ 2 ] = 2 ; int * p = a + 1 ; ( * p ++ ) -- ; a [ 2 ] ; } ) , "int a[3]; a[0]=0; a[1]=1; a[2]=2; int *p=a+1; (*p++); a[0];" ) ; assert ( 2 , ( { int a [ 3 ] ; a [ 0 ] = 0 ; a [ 1 ] = 1 ; a [ 2 ] = 2 ; int * p = a + 1 ; ( * p ++ ) -- ; * p ; } ) , "int a[3]; a[0]=0; a[1]=1; a[2]=2; int *p=a+1; (*p++); a[0];" ) ; assert ( 7 , ( { int i = 2 ; i += 5 ; i ; } ) , "int i=2; i+=5; i;" ) ; assert ( 7 , ( { int i = 2 ; i += 5 ; } ) , "int i=2; i+=5;" ) ; assert ( 3 , ( { int i = 5 ; i -= 2 ; i ; } ) , "int i=5; i-=2; i;" ) ; assert ( 3 , ( { int i = 5 ; i -= 2 ; } ) , "int i=5; i-=2;" ) ; assert ( 6 , ( { int i = 3 ; i *= 2 ; i ; } ) , "int i=3; i*=2; i;" ) ; assert ( 6 , ( { int i = 3 ; i *= 2 ; } ) , "int i=3; i*=2;" ) ; assert ( 3 , ( { int i = 6 ; i /= 2 ; i ; } ) , "int i=6; i/=2; i;" ) ; assert ( 3 , ( { int i = 6 ; i /= 2 ; } ) , "int i=6; i/=2;" ) ; assert ( 511 , 0777 , "0777" ) ; assert ( 0 , 0x0 , "0x0" ) ; assert ( 10 , 0xa , "0xa" ) ; assert ( 10 , 0XA , "0XA" ) ; assert ( 48879 , 0xbeef , "0xbeef" ) ; assert ( 48879 , 0xBEEF , "0xBEEF" ) ; assert ( 48879 , 0XBEEF , "0XBEEF" ) ; assert ( 0 , 0b0 , "0b0" ) ; assert ( 1 , 0b1 , "0b1" ) ; assert ( 47 , 0b101111 , "0b101111" ) ; assert ( 47 , 0B101111 , "0B101111" ) ; assert ( 0 , ! 1 , "!1" ) ; assert ( 0 , ! 2 , "!2" ) ; assert ( 1 , ! 0 , "!0" ) ; assert ( - 1 , ~ 0 , "~0" ) ; assert ( 0 , ~ - 1 , "~-1" ) ; assert ( 0 , 0 & 1 , "0&1" ) ; assert ( 1 , 3 & 1 , "3&1" ) ; assert ( 3 , 7 & 3 , "7&3" ) ; assert ( 10 , - 1 & 10 , " -1&10" ) ; assert ( 1 , 0 | 1 , "0|1" ) ; assert ( 0b10011 , 0b10000 | 0b00011 , "01000|0b0011" ) ; assert ( 0 , 0 ^ 0 , "0^0" ) ; assert ( 0 , 0b1111 ^ 0b1111 , "0b1111^0b1111" ) ; assert ( 0b110100 , 0b111000 ^ 0b001100 , "0b111000^0b001100" ) ; assert ( 1 , 0 || 1 , "0||1" ) ; assert ( 1 , 0 || ( 2 - 2 ) || 5 , "0||(2-2)||5" ) ; assert ( 0 , 0 || 0 , "0||0" ) ; assert ( 0 , 0 || ( 2 - 2 ) , "0||(2-2)" ) ; assert ( 0 , 0 && 1 , "0&&1" ) ; assert ( 0 , ( 2 - 2 ) && 5 , "(2-2)&&5" ) ; assert ( 1 , 1 && 5 , "1&&5" ) ; assert ( 3 , ( { int x [ 2 ] ; x [ 0 ] = 3 ; param_decay ( x ) ; } ) , "int x[2]; x[0]=3; param_decay(x);" ) ; assert ( - 56 , ( { char x [ 2 ] ; x [ 0 ] = 200 ; x [ 0 ] ; } ) , "char x[2]; x[0]=200; x[0];" ) ; assert ( 4464 , ( { short x [ 2 ] ; x [ 1 ] = 70000 ; x [ 1 ] ; } ) , "short x[2]; x[1]=70000; x[1];" ) ; assert ( - 1 , ( { int x [ 2 ] ; x [ 0 ] = 4294967295 ; x [ 0 ] ; } ) , "int x[2]; x[0]=4294967295; x[0];" ) ; assert ( - 55 , ( { struct { char a ; int b ; } x ; x . a = 1 ; x . b = 2 ; x . a += 200 ; x . a ; } ) , "struct {char a; int b;} x; x.a=1; x.b=2; x.a+=200; x.a;" ) ; assert ( - 10 , ( { short x [ 2 ] ; x [ 1 ] = 10 ; x [ 1 ] -= 20 ; x [ 1 ] ; } ) , "short x[2]; x[1]=10; x[1]-=20; x[1];" ) ; assert ( 40 , ( { g1 = 5 ; g1 <<= 3 ; g1 ; } ) , "g1=5; g1<<=3; g1;" ) ; assert ( 7 , ( { long x [ 2 ] ; x [ 0 ] = 2 ; x [ 1 ] = 5 ; x [ 0 ] += x [ 1 ] ; x [ 0 ] ; } ) , "long x[2]; x[0]=2; x[1]=5; x[0]+=x[1]; x[0];" ) ; assert ( 1 , ( { int x = - 5 ; ( x >> 70 ) == - 1 ; } ) , "int x=-5; (x>>70)==-1;" ) ; assert ( 4096 , ( { long x = 1 ; x << 12 ; } ) , "long x=1; x<<12;" ) ; assert ( 255 , ( { long x = - 1 ; x & 255 ; } ) , "long x=-1; x&255;" ) ; assert ( - 2 , ( { long x = 7 ; x ^ - 7 ; } ) , "long x=7; x^-7;" ) ; assert ( 4294967296 , ( { long x = 1 ; x * 4294967296 ; } ) , "long x=1; x*4294967296;" ) ; assert ( 3 , ( { long x = 7 ; x / 2 ; } ) , "long x=7; x/2;" ) ; assert ( 44 , ( { char x = 100 ; x *= 3 ; x ; } ) , "char x=100; x*=3; x;" ) ; assert ( 1 , ( { int x [ 4 ] ; int * p = x ; ( p + 3 ) - x == 3 ; } ) , "int x[4]; int *p=x; (p+3)-x==3;" ) ; assert ( 12 , ( { int x [ 4 ] ; int * p = x ; p += 3 ; ( char * ) p - ( char * ) x ; } ) , "int x[4]; int *p=x; p+=3; (char*)p-(char*)x;" ) ; assert ( 1 , ( { long x = 2147483648 ; x > 2147483647 ; } ) , "long x=2147483648; x>2147483647;" ) ; assert ( 3 , ( { int x = 0 ; for ( int i = 0 ; i < 10 ; i ++ ) if ( i > 6 && ! ( i == 8 ) || i == 0 ) x ++ ; x ; } ) , "int x=0; for (int i=0; i<10; i++) if (i>6 && !(i==8) || i==0) x++; x;" ) ; assert ( 4 , ( { int x = 0 ; for ( int i = 0 ; i < 10 ; i ++ ) if ( ! ( i < 2 || 5 <= i && i != 9 ) ) x ++ ; x ; } ) , "int x=0; for (int i=0; i<10; i++) if (!(i<2 || 5<=i && i!=9)) x++; x;" ) ; assert ( 2 , ( { int x = 0 ; if ( 0 ) x = 1 ; else x = 2 ; x ; } ) , "int x=0; if (0) x=1; else x=2; x;" ) ; assert ( 1 , ( { int x = 0 ; if ( ! 0 ) x = 1 ; x ; } ) , "int x=0; if (!0) x=1; x;" ) ; assert ( 5 , ( { int i = 0 ; while ( i < 100 && ! ( i >= 5 ) ) i ++ ; i ; } ) , "int i=0; while (i<100 && !(i>=5)) i++; i;" ) ; assert ( 10 , ( { int i = 0 ; do i ++ ; while ( ! ( i == 10 ) ) ; i ; } ) , "int i=0; do i++; while (!(i==10)); i;" ) ; assert ( 7 , ( { int i = 3 ; 2 < i ? 7 : 8 ; } ) , "int i=3; 2<i ? 7 : 8;" ) ; assert ( 8 , ( { int i = 2 ; 2 < i ? 7 : 8 ; } ) , "int i=2; 2<i ? 7 : 8;" ) ; assert ( 1 , ( { long x = - 3000000000 ; x < - 2999999999 ; } ) , "long x=-3000000000; x<-2999999999;" ) ; assert ( 42 , ( { long x = 14 ; x * 3 ; } ) , "long x=14; x*3;" ) ; assert ( - 35 , ( { long x = - 7 ; x * 5 ; } ) , "long x=-7; x*5;" ) ; assert ( 81 , ( { long x = 9 ; x * 9 ; } ) , "long x=9; x*9;" ) ; assert ( 120 , ( { long x = 10 ; x * 12 ; } ) , "long x=10; x*12;" ) ; assert ( - 280 , ( { long x = - 7 ; x * 40 ; } ) , "long x=-7; x*40;" ) ; assert ( - 21 , ( { long x = 7 ; x * - 3 ; } ) , "long x=7; x*-3;" ) ; assert ( 49 , ( { long x = 7 ; x *= 7 ; x ; } ) , "long x=7; x*=7; x;" ) ; assert ( 5 , ( { long a [ 10 ] ; & a [ 7 ] - & a [ 2 ] ; } ) , "long a[10]; &a[7]-&a[2];" ) ; assert ( 3 , ( { struct { char a [ 3 ] ; } x [ 5 ] ; & x [ 4 ] - & x [ 1 ] ; } ) , "struct {char a[3];} x[5]; &x[4]-&x[1];" ) ; assert ( 174 , ( { int a [ 3 ] [ 10 ] ; for ( int i = 0 ; i < 3 ; i ++ ) for ( int j = 0 ; j < 10 ; j ++ ) a [ i ] [ j ] = i * j ; int s = 0 ; for ( int i = 0 ; i < 3 ; i ++ ) for ( int j = 0 ; j < 10 ; j ++ ) s += a [ i ] [ j ] + a [ 2 - i ] [ j ] / 3 ; s ; } ) , "int a[3][10]; for (int i=0; i<3; i++) for (int j=0; j<10; j++) a[i][j]=i*j; int s=0; for (int i=0; i<3; i++) for (int j=0; j<10; j++) s+=a[i][j]+a[2-i][j]/3; s;" ) ; assert ( 7 , ( { long a [ 5 ] ; long * p = a ; int i = 3 ; p [ i ] = 7 ; a [ 3 ] ; } ) , "long a[5]; long *p=a; int i=3; p[i]=7; a[3];" ) ; assert ( - 3 , ( { long x = - 7 ; x / 2 ; } ) , "long x=-7; x/2;" ) ; assert ( 0 , ( { long x = - 7 ; x / 8 ; } ) , "long x=-7; x/8;" ) ; assert ( - 2 , ( { long x = - 7 ; x / 3 ; } ) , "long x=-7; x/3;" ) ; assert ( 10 , ( { long x = 100 ; x / 10 ; } ) , "long x=100; x/10;" ) ; assert ( - 14 , ( { int x = - 100 ; x / 7 ; } ) , "int x=-100; x/7;" ) ; assert ( 123456789012 , ( { long x = 123456789012345 ; x / 1000 ; } ) , "long x=123456789012345; x/1000;" ) ; assert ( - 192600294871 , ( { long x = - 123456789012345 ; x / 641 ; } ) , "long x=-123456789012345; x/641;" ) ; assert ( 1 , ( { int x = 2147483647 ; x / 2147483647 ; } ) , "int x=2147483647; x/2147483647;" ) ; assert ( 1234 , ( { int x = 12345 ; x /= 10 ; x ; } ) , "int x=12345; x/=10; x;" ) ; assert ( - 7 , ( { long x = - 7 ; x / 1 ; } ) , "long x=-7; x/1;" ) ; assert ( 7 , ( { struct { int a [ 3 ] ; } x [ 9 ] ; & x [ 8 ] - & x [ 1 ] ; } ) , "struct {int a[3];} x[9]; &x[8]-&x[1];" ) ; assert ( 8 , ( { struct * foo ; sizeof ( foo ) ; } ) , "struct *foo; sizeof(foo);" ) ; assert ( 4 , ( { struct T * foo ; struct T { int x ; } ; sizeof ( struct T ) ; } ) , "struct T *foo; struct T {int x;}; sizeof(struct T);" ) ; assert ( 1 , ( { struct T { struct T * next ; int x ; } a ; struct T b ; b . x = 1 ; a . next = & b ; a . next -> x ; } ) , "struct T { struct T *next; int x; } a; struct T b; b.x=1; a.next=&b; a.next->x;" ) ; assert ( 3 , ( { int i = 0 ; for ( ; i < 10 ; i ++ ) { if ( i == 3 ) break ; } i ; } ) , "int i=0; for(;i<10;i++) { if (i == 3) break; } i;" ) ; assert ( 4 , ( { int i = 0 ; while ( 1 ) { if ( i ++ == 3 ) break ; } i ; } ) , "int i=0; while { if (i == 3) break; } i;" ) ; assert ( 3 , ( { int i = 0 ; for ( ; i < 10 ; i ++ ) { for ( ; ; ) break ; if ( i == 3 ) break ; } i ; } ) , "int i=0; for(;i<10;i++) { if (i == 3) break; } i;" ) ; assert ( 4 , ( { int i = 0 ; while ( 1 ) { while ( 1 ) break ; if ( i ++ == 3 ) break ; } i ; } ) , "int i=0; while { if (i == 3) break; } i;" ) ; assert ( 10 , ( { int i = 0 ; int j = 0 ; for ( ; i < 10 ; i ++ ) { if ( i > 5 ) continue ; j ++ ; } i ; } ) , "int i=0; int j=0; for (;i<10;i++) { if (i>5) continue; j++; } i;" ) ; assert ( 6 , ( { int i = 0 ; int j = 0 ; for ( ; i < 10 ; i ++ ) { if ( i > 5 ) continue ; j ++ ; } j ; } ) , "int i=0; int j=0; for (;i<10;i++) { if (i>5) continue; j++; } j;" ) ; assert ( 10 , ( { int i = 0 ; int j = 0 ; for ( ; ! i ; ) { for ( ; j != 10 ; j ++ ) continue ; break ; } j ; } ) , "int i=0; int j=0; for(;!i;) { for (;j!=10;j++) continue; break; } j;" ) ; assert ( 11 , ( { int i = 0 ; int j = 0 ; while ( i ++ < 10 ) { if ( i > 5 ) continue ; j ++ ; } i ; } ) , "int i=0; int j=0; while (i++<10) { if (i>5) continue; j++; } i;" ) ; assert ( 5 , ( { int i = 0 ; int j = 0 ; while ( i ++ < 10 ) { if ( i > 5 ) continue ; j ++ ; } j ; } ) , "int i=0; int j=0; while (i++<10) { if (i>5) continue; j++; } j;" ) ; assert ( 11 , ( { int i = 0 ; int j = 0 ; while ( ! i ) { while ( j ++ != 10 ) continue ; break ; } j ; } ) , "int i=0; int j=0; while(!i) { while (j++!=10) continue; break; } j;" ) ; assert ( 0 , ( { int i = 0 ; while ( i > 0 ) i ++ ; i ; } ) , "int i=0; while (i>0) i++; i;" ) ; assert ( 4 , ( { int n = 0 ; int i = 0 ; while ( n ++ , i < 3 ) i ++ ; n ; } ) , "int n=0; int i=0; while (n++, i<3) i++; n;" ) ; assert ( 6 , ( { int n = 0 ; for ( int i = 0 ; n ++ , i < 5 ; i ++ ) if ( i == 2 ) continue ; n ; } ) , "int n=0; for (int i=0; n++, i<5; i++) if (i==2) continue; n;" ) ; assert ( 3 , ( { int i = 0 ; while ( ( { goto k ; k : ; i < 3 ; } ) ) i ++ ; i ; } ) , "int i=0; while (({ goto k; k: ; i<3; })) i++; i;" ) ; assert ( 6 , ( { int j = 0 ; for ( int i = 0 ; ( { goto l ; l : ; i < 10 ; } ) ; i ++ ) { if ( i > 5 ) continue ; j ++ ; } j ; } ) , "int j=0; for (int i=0; ({ goto l; l: ; i<10; }); i++) { if (i>5) continue; j++; } j;" ) ; assert ( 0 , ( { int j = 0 ; for ( int i = 0 ; ( { goto m ; m : ; i < 0 ; } ) ; i ++ ) j ++ ; j ; } ) , "int j=0; for (int i=0; ({ goto m; m: ; i<0; }); i++) j++; j;" ) ; assert ( 11 , ( { int i = 0 ; while ( i < 20 && i != 11 && i != 12 && i != 13 && i != 14 && i != 15 && i != 16 && i != 17 ) i ++ ; i ; } ) , "int i=0; while (i<20 && i!=11 && i!=12 && i!=13 && i!=14 && i!=15 && i!=16 && i!=17) i++; i;" ) ; assert ( 3 , ( { int i = 0 ; goto a ; a : i ++ ; b : i ++ ; c : i ++ ; i ; } ) , "int i=0; goto a; a: i++; b: i++; c: i++; i;" ) ; assert ( 2 , ( { int i = 0 ; goto e ; d : i ++ ; e : i ++ ; f : i ++ ; i ; } ) , "int i=0; goto d; d: i++; e: i++; f: i++; i;" ) ; assert ( 1 , ( { int i = 0 ; goto i ; g : i ++ ; h : i ++ ; i : i ++ ; i ; } ) , "int i=0; goto g; h: i++; i: i++; j: i++; i;" ) ; assert ( 5 , ( { int i = 0 ; switch ( 0 ) { case 0 : i = 5 ; break ; case 1 : i = 6 ; break ; case 2 : i = 7 ; break ; } i ; } ) , "int i=0; switch(0) { case 0:i=5;break; case 1:i=6;break; case 2:i=7;break; } i;" ) ; assert ( 6 , ( { int i = 0 ; switch ( 1 ) { case 0 : i = 5 ; break ; case 1 : i = 6 ; break ; case 2 : i = 7 ; break ; } i ; } ) , "int i=0; switch(1) { case 0:i=5;break; case 1:i=6;break; case 2:i=7;break; } i;" ) ; assert ( 7 , ( { int i = 0 ; switch ( 2 ) { case 0 : i = 5 ; break ; case 1 : i = 6 ; break ; case 2 : i = 7 ; break ; } i ; } ) , "int i=0; switch(2) { case 0:i=5;break; case 1:i=6;break; case 2:i=7;break; } i;" ) ; assert ( 0 , ( { int i = 0 ; switch ( 3 ) { case 0 : i = 5 ; break ; case 1 : i = 6 ; break ; case 2 : i = 7 ; break ; } i ; } ) , "int i=0; switch(3) { case 0:i=5;break; case 1:i=6;break; case 2:i=7;break; } i;" ) ; assert ( 5 , ( { int i = 0 ; switch ( 0 ) { case 0 : i = 5 ; break ; default : i = 7 ; } i ; } ) , "int i=0; switch(0) { case 0:i=5;break; default:i=7; } i;" ) ; assert ( 7 , ( { int i = 0 ; switch ( 1 ) { case 0 : i = 5 ; break ; default : i = 7 ; } i ; } ) , "int i=0; switch(1) { case 0:i=5;break; default:i=7; } i;" ) ; assert ( 2 , ( { int i = 0 ; switch ( 1 ) { case 0 : 0 ; case 1 : 0 ; case 2 : 0 ; i = 2 ; } i ; } ) , "int i=0; switch(1) { case 0: 0; case 1: 0; case 2: 0; i=2; } i;" ) ; assert ( 0 , ( { int i = 0 ; switch ( 3 ) { case 0 : 0 ; case 1 : 0 ; case 2 : 0 ; i = 2 ; } i ; } ) , "int i=0; switch(3) { case 0: 0; case 1: 0; case 2: 0; i=2; } i;" ) ; voidfn ( ) ; assert ( 1 , 1 << 0 , "1<<0" ) ; assert ( 8 , 1 << 3 , "1<<3" ) ; assert ( 10 , 5 << 1 , "5<<1" ) ; assert ( 2 , 5 >> 1 , "5>>1" ) ; assert ( - 1 , - 1 >> 1 , "-1>>1" ) ; assert ( 1 , ( { int i = 1 ; i <<= 0 ; i ; } ) , "int i=1; i<<0;" ) ; assert ( 8 , ( { int i = 1 ; i <<= 3 ; i ; } ) , "int i=1; i<<3;" ) ; assert ( 10 , ( { int i = 5 ; i <<= 1 ; i ; } ) , "int i=5; i<<1;" ) ; assert ( 2 , ( { int i = 5 ; i >>= 1 ; i ; } ) , "int i=5; i>>1;" ) ; assert ( - 1 , - 1 , "-1" ) ; assert ( - 1 , ( { int i = - 1 ; i ; } ) , "int i=-1; i;" ) ; assert ( - 1 , ( { int i = - 1 ; i >>= 1 ; i ; } ) , "int i=1; i>>1;" ) ; assert ( 2 , 0 ? 1 : 2 , "0?1:2" ) ; assert ( 1 , 1 ? 1 : 2 , "0?1:2" ) ; assert ( 10 , ( { enum { ten = 1 + 2 + 3 + 4 , } ; ten ; } ) , "enum { ten=1+2+3+4, }; ten;" ) ; assert ( 1 , ( { int i = 0 ; switch ( 3 ) { case 5 - 2 + 0 * 3 : i ++ ; } i ; } ) , "int i=0; switch(3) { case 5-2+0*3: i++; ); i;" ) ; assert ( 12063 , ( { int s = 0 ; for ( int i = - 3 ; i < 15 ; i ++ ) switch ( i ) { case 0 : s += 1 ; break ; case 1 : s += 2 ; break ; case 2 : s += 4 ; break ; case 4 : s += 8 ; break ; case 5 : s += 16 ; break ; case 7 : s += 32 ; break ; default : s += 1000 ; } s ; } ) , "int s=0; for (int i=-3; i<15; i++) switch (i) { case 0: s+=1; break; case 1: s+=2; break; case 2: s+=4; break; case 4: s+=8; break; case 5: s+=16; break; case 7: s+=32; break; default: s+=1000; } s;" ) ; assert ( 25 , ( { int s = 0 ; for ( int i = - 3 ; i < 12 ; i ++ ) switch ( i - 5 ) { case - 5 : s += 1 ; case - 4 : s += 2 ; break ; case - 2 : s += 4 ; case - 1 : s += 8 ; break ; } s ; } ) , "int s=0; for (int i=-3; i<12; i++) switch (i-5) { case -5: s+=1; case -4: s+=2; break; case -2: s+=4; case -1: s+=8; break; } s;" ) ; assert ( 127 , ( { int s = 0 ; for ( int i = 0 ; i < 1100 ; i ++ ) switch ( i ) { case 1 : s += 1 ; break ; case 10 : s += 2 ; break ; case 100 : s += 4 ; break ; case 1000 : s += 8 ; break ; case 20 : s += 16 ; break ; case 300 : s += 32 ; break ; case 5 : s += 64 ; break ; default : s += 0 ; } s ; } ) , "int s=0; for (int i=0; i<1100; i++) switch (i) { case 1: s+=1; break; case 10: s+=2; break; case 100: s+=4; break; case 1000: s+=8; break; case 20: s+=16; break; case 300: s+=32; break; case 5: s+=64; break; default: s+=0; } s;" ) ; assert ( 144 , ( { int s = 0 ; for ( int i = 0 ; i < 50 ; i ++ ) switch ( i ) { case 1 : case 2 : case 3 : case 4 : s += 1 ; break ; case 40 : case 41 : case 42 : case 43 : s += 10 ; break ; case 20 : s += 100 ; } s ; } ) , "int s=0; for (int i=0; i<50; i++) switch (i) { case 1: case 2: case 3: case 4: s+=1; break; case 40: case 41: case 42: case 43: s+=10; break; case 20: s+=100; } s;" ) ; assert ( 5 , ( { long x = 4294967298 ; int s = 0 ; switch ( x ) { case 2 : s = 1 ; break ; case 3 : s = 2 ; break ; case 4 : s = 3 ; break ; case 5 : s = 4 ; break ; default : s = 5 ; } s ; } ) , "long x=4294967298; int s=0; switch (x) { case 2: s=1; break; case 3: s=2; break; case 4: s=3; break; case 5: s=4; break; default: s=5; } s;" ) ; assert ( 8 , ( { int x [ 1 + 1 ] ; sizeof ( x ) ; } ) , "int x[1+1]; sizeof(x);" ) ; assert ( 2 , ( { char x [ 1 ? 2 : 3 ] ; sizeof ( x ) ; } ) , "char x[0?2:3]; sizeof(x);" ) ; assert ( 3 , ( { char x [ 0 ? 2 : 3 ] ; sizeof ( x ) ; } ) , "char x[1?2:3]; sizeof(x);" ) ; assert ( 1 , ( { int x [ 3 ] = { 1 , 2 , 3 } ; x [ 0 ] ; } ) , "int x[3]={1,2,3}; x[0];" ) ; assert ( 2 , ( { int x [ 3 ] = { 1 , 2 , 3 } ; x [ 1 ] ; } ) , "int x[3]={1,2,3}; x[0];" ) ; assert ( 3 , ( { int x [ 3 ] = { 1 , 2 , 3 } ; x [ 2 ] ; } ) , "int x[3]={1,2,3}; x[0];" ) ; assert ( 3 , ( { int x [ 3 ] = { 1 , 2 , 3 , } ; x [ 2 ] ; } ) , "int x[3]={1,2,3}; x[0];" ) ; assert ( 0 , ( { int x [ 3 ] = { } ; x [ 0 ] ; } ) , "int x[3]={}; x[0];" ) ; assert ( 0 , ( { int x [ 3 ] = { } ; x [ 1 ] ; } ) , "int x[3]={}; x[1];" ) ; assert ( 0 , ( { int x [ 3 ] = { } ; x [ 2 ] ; } ) , "int x[3]={}; x[2];" ) ; assert ( 2 , ( { int x [ 2 ] [ 3 ] = { { 1 , 2 , 3 } , { 4 , 5 , 6 } } ; x [ 0 ] [ 1 ] ; } ) , "int x[2][3]={{1,2,3},{4,5,6}}; x[0][1];" ) ; assert ( 4 , ( { int x [ 2 ] [ 3 ] = { { 1 , 2 , 3 } , { 4 , 5 , 6 } } ; x [ 1 ] [ 0 ] ; } ) , "int x[2][3]={{1,2,3},{4,5,6}}; x[1][0];" ) ; assert ( 6 , ( { int x [ 2 ] [ 3 ] = { { 1 , 2 , 3 } , { 4 , 5 , 6 } } ; x [ 1 ] [ 2 ] ; } ) , "int x[2][3]={{1,2,3},{4,5,6}}; x[1][2];" ) ; assert ( 2 , ( { int x [ 2 ] [ 3 ] = { { 1 , 2 } } ; x [ 0 ] [ 1 ] ; } ) , "int x[2][3]={{1,2}}; x[0][1];" ) ; assert ( 0 , ( { int x [ 2 ] [ 3 ] = { { 1 , 2 } } ; x [ 1 ] [ 0 ] ; } ) , "int x[2][3]={{1,2}}; x[1][0];" ) ; assert ( 0 , ( { int x [ 2 ] [ 3 ] = { { 1 , 2 } } ; x [ 1 ] [ 2 ] ; } ) , "int x[2][3]={{1,2}}; x[1][2];" ) ; assert ( 'a' , ( { char x [ 4 ] = "abc" ; x [ 0 ] ; } ) , "char x[4]=\"abc\"; x[0]; }" ) ; assert ( 'c' , ( { char x [ 4 ] = "abc" ; x [ 2 ] ; } ) , "char x[4]=\"abc\"; x[2]; }" ) ; assert ( 0 , ( { char x [ 4 ] = "abc" ; x [ 3 ] ; } ) , "char x[4]=\"abc\"; x[3]; }" ) ; assert ( 'a' , ( { char x [ 2 ] [ 4 ] = { "abc" , "def" } ; x [ 0 ] [ 0 ] ; } ) , "char x[2][4]=\"abc\",\"def\"}; x[0][0]; }" ) ; assert ( 0 , ( { char x [ 2 ] [ 4 ] = { "abc" , "def" } ; x [ 0 ] [ 3 ] ; } ) , "char x[2][4]=\"abc\",\"def\"}; x[0][3]; }" ) ; assert ( 'd' , ( { char x [ 2 ] [ 4 ] = { "abc" , "def" } ; x [ 1 ] [ 0 ] ; } ) , "char x[2][4]=\"abc\",\"def\"}; x[1][0]; }" ) ; assert ( 'f' , ( { char x [ 2 ] [ 4 ] = { "abc" , "def" } ; x [ 1 ] [ 2 ] ; } ) , "char x[2][4]=\"abc\",\"def\"}; x[1][2]; }" ) ; assert ( 4 , ( { int x [ ] = { 1 , 2 , 3 , 4 } ; x [ 3 ] ; } ) , "int x[]={1,2,3,4}; x[3];" ) ; assert ( 16 , ( { int x [ ] = { 1 , 2 , 3 , 4 } ; sizeof ( x ) ; } ) , "int x[]={1,2,3,4}; sizeof(x);" ) ; assert ( 4 , ( { char x [ ] = "foo" ; sizeof ( x ) ; } ) , "char x[]=\"foo\"; sizeof(x); }" ) ; assert ( 1 , ( { struct { int a ; int b ; int c ; } x = { 1 , 2 , 3 } ; x . a ; } ) , "struct {int a; int b; int c;} x={1,2,3}; x.a;" ) ; assert ( 2 , ( { struct { int a ; int b ; int c ; } x = { 1 , 2 , 3 } ; x . b ; } ) , "struct {int a; int b; int c;} x={1,2,3}; x.b;" ) ; assert ( 3 , ( { struct { int a ; int b ; int c ; } x = { 1 , 2 , 3 } ; x . c ; } ) , "struct {int a; int b; int c;} x={1,2,3}; x.c;" ) ; assert ( 1 , ( { struct { int a ; int b ; int c ; } x = { 1 } ; x . a ; } ) , "struct {int a; int b; int c;} x={1}; x.a;" ) ; assert ( 0 , ( { struct { int a ; int b ; int c ; } x = { 1 } ; x . b ; } ) , "struct {int a; int b; int c;} x={1}; x.b;" ) ; assert ( 0 , ( { struct { int a ; int b ; int c ; } x = { 1 } ; x . c ; } ) , "struct {int a; int b; int c;} x={1}; x.c;" ) ; assert ( 1 , ( { struct { int a ; int b ; } x [ 2 ] = { { 1 , 2 } , { 3 , 4 } } ; x [ 0 ] . a ; } ) , "struct {int a; int b;} x[2]={{1,2},{3,4}}; x[0].a;" ) ; assert ( 2 , ( { struct { int a ; int b ; } x [ 2 ] = { { 1 , 2 } , { 3 , 4 } } ; x [ 0 ] . b ; } ) , "struct {int a; int b;} x[2]={{1,2},{3,4}}; x[0].b;" ) ; assert ( 3 , ( { struct { int a ; int b ; } x [ 2 ] = { { 1 , 2 } , { 3 , 4 } } ; x [ 1 ] . a ; } ) , "struct {int a; int b;} x[2]={{1,2},{3,4}}; x[1].a;" ) ; assert ( 4 , ( { struct { int a ; int b ; } x [ 2 ] = { { 1 , 2 } , { 3 , 4 } } ; x [ 1 ] . b ; } ) , "struct {int a; int b;} x[2]={{1,2},{3,4}}; x[1].b;" ) ; assert ( 0 , ( { struct { int a ; int b ; } x [ 2 ] = { { 1 , 2 } } ; x [ 1 ] . b ; } ) , "struct {int a; int b;} x[2]={{1,2}}; x[1].b;" ) ; assert ( 0 , ( { struct { int a ; int b ; } x = { } ; x . a ; } ) , "struct {int a; int b;} x={}; x.a;" ) ; assert ( 0 , ( { struct { int a ; int b ; } x = { } ; x . b ; } ) , "struct {int a; int b;} x={}; x.b;" ) ; assert ( 3 , g3 , "g3" ) ; assert ( 4 , g4 , "g4" ) ; assert ( 5 , g5 , "g5" ) ; assert ( 6 , g6 , "g6" ) ; assert ( 5 , * g7 , "*g7" ) ; assert ( 0 , strcmp ( g8 , "abc" ) , "strcmp(g8, \"abc\")" ) ; assert ( 0 , g9 [ 0 ] , "g9[0]" ) ; assert ( 1 , g9 [ 1 ] , "g9[1]" ) ; assert ( 2 , g9 [ 2 ] , "g9[2]" ) ; assert ( 0 , strcmp ( g10 [ 0 ] , "foo" ) , "strcmp(g10[0], \"foo\")" ) ; assert ( 0 , strcmp ( g10 [ 1 ] , "bar" ) , "strcmp(g10[1], \"bar\")" ) ; assert ( 0 , g10 [ 1 ] [ 3 ] , "g10[1][3]" ) ; assert ( 2 , sizeof ( g10 ) / sizeof ( * g10 ) , "sizeof(g10) / sizeof(*g10)" ) ; assert ( 1 , g11 [ 0 ] . a , "g11[0].a" ) ; assert ( 2 , g11 [ 0 ] . b , "g11[0].b" ) ; assert ( 3 , g11 [ 1 ] . a , "g11[1].a" ) ; assert ( 4 , g11 [ 1 ] . b , "g11[1].b" ) ; assert ( 1 , g12 [ 0 ] . a [ 0 ] , "g12[0].a[0]" ) ; assert ( 2 , g12 [ 0 ] . a [ 1 ] , "g12[0].a[1]" ) ; assert ( 0 , g12 [ 1 ] . a [ 0 ] , "g12[1].a[0]" ) ; assert ( 0 , g12 [ 1 ] . a [ 1 ] , "g12[1].a[1]" ) ; assert ( 1 , g13 [ 0 ] . a [ 0 ] , "g13[0].a[0]" ) ; assert ( 2 , g13 [ 0 ] . a [ 1 ] , "g13[0].a[1]" ) ; assert ( 3 , g13 [ 1 ] . a [ 0 ] , "g13[1].a[0]" ) ; assert ( 4 , g13 [ 1 ] . a [ 1 ] , "g13[1].a[1]" ) ; assert ( 1 , g14 [ 0 ] . a [ 0 ] , "g14[0].a[0]" ) ; assert ( 2 , g14 [ 0 ] . a [ 1 ] , "g14[0].a[1]" ) ; assert ( 3 , g14 [ 1 ] . a [ 0 ] , "g14[1].a[0]" ) ; assert ( 4 , g14 [ 1 ] . a [ 1 ] , "g14[1].a[1]" ) ; assert ( 0 , ( { int x [ 2 ] [ 3 ] = { 0 , 1 , 2 , 3 , 4 , 5 , } ; x [ 0 ] [ 0 ] ; } ) , "int x[2][3]={0,1,2,3,4,5,}; x[0][0];" ) ; assert ( 3 , ( { int x [ 2 ] [ 3 ] = { 0 , 1 , 2 , 3 , 4 , 5 , } ; x [ 1 ] [ 0 ] ; } ) , "int x[2][3]={0,1,2,3,4,5,}; x[1][0];" ) ; assert ( 0 , ( { struct { int a ; int b ; } x [ 2 ] = { 0 , 1 , 2 , 3 } ; x [ 0 ] . a ; } ) , "struct {int a; int b;} x[2]={0,1,2,3}; x[0].a;" ) ; assert ( 2 , ( { struct { int a ; int b ; } x [ 2 ] = { 0 , 1 , 2 , 3 } ; x [ 1 ] . a ; } ) , "struct {int a; int b;} x[2]={0,1,2,3}; x[1].a;" ) ; assert ( 0 , strcmp ( g15 , "foo" ) , "strcmp(g15, \"foo\")" ) ; assert ( 0 , strcmp ( g16 [ 0 ] , "foo" ) , "strcmp(g16[0], \"foo\")" ) ; assert ( 0 , strcmp ( g16 [ 1 ] , "bar" ) , "strcmp(g16[1], \"bar\")" ) ; assert ( 7 , sizeof ( g17 ) , "sizeof(g17)" ) ; assert ( 10 , sizeof ( g18 ) , "sizeof(g18)" ) ; assert ( 3 , sizeof ( g19 ) , "sizeof(g19)" ) ; assert ( 0 , memcmp ( g17 , "foobar" , 7 ) , "memcmp(g17, \"foobar\", 7)" ) ; assert ( 0 , memcmp ( g18 , "foobar\0\0\0" , 10 ) , "memcmp(g18, \"foobar\\0\\0\\0\", 10)" ) ; assert ( 0 , memcmp ( g19 , "foo" , 3 ) , "memcmp(g19, \"foo\", 3)" ) ; assert ( 0 , strcmp ( g20 , "foobar" ) , "strcmp(g20, \"foobar\")" ) ; assert ( 0 , strcmp ( g21 , "bar" ) , "strcmp(g21, \"bar\")" ) ; assert ( 0 , strcmp ( g22 + 3 , "foobar" ) , "strcmp(g22+3, \"foobar\")" ) ; assert ( 0 , strcmp ( g23 [ 0 ] , "foobar" ) , "strcmp(g23[0], \"foobar\")" ) ; assert ( 0 , strcmp ( g23 [ 1 ] , "bar" ) , "strcmp(g23[1], \"bar\")" ) ; assert ( 0 , strcmp ( g23 [ 2 ] + 3 , "foobar" ) , "strcmp(g23[2]+3, \"foobar\")" ) ; assert ( 3 , g24 , "g24" ) ; assert ( 3 , * g25 , "*g25" ) ; assert ( 2 , * g27 , "*g27" ) ; ext1 = 5 ; assert ( 5 , ext1 , "ext1" ) ; ext2 = & ext1 ; assert ( 5 , * ext2 , "*ext2" ) ; ; assert ( 1 , _Alignof ( char ) , "_Alignof(char)" ) ; assert ( 2 , _Alignof ( short ) , "_Alignof(short)" ) ; assert ( 4 , _Alignof ( int ) , "_Alignof(int)" ) ; assert ( 8 , _Alignof ( long ) , "_Alignof(long)" ) ; assert ( 8 , _Alignof ( long long ) , "_Alignof(long long)" ) ; assert ( 1 , _Alignof ( char [ 3 ] ) , "_Alignof(char[3])" ) ; assert ( 4 , _Alignof ( int [ 3 ] ) , "_Alignof(int[3])" ) ; assert ( 1 , _Alignof ( struct { char a ; char b ; } [ 2 ] ) , "_Alignof(struct {char a; char b;}[2])" ) ; assert ( 8 , _Alignof ( struct { char a ; long b ; } [ 2 ] ) , "_Alignof(struct {char a; long b;}[2])" ) ; assert ( 2 , counter ( ) , "counter()" ) ; assert ( 4 , counter ( ) , "counter()" ) ; assert ( 6 , counter ( ) , "counter()" ) ; assert ( 1 , ( int ) { 1 } , "(int){1}" ) ; assert ( 2 , ( ( int [ ] ) { 0 , 1 , 2 } ) [ 2 ] , "(int[]){0,1,2}[2]" ) ; assert ( 'a' , ( ( struct { char a ; int b ; } ) { 'a' , 3 } ) . a , "((struct {char a; int b;}){'a', 3}).a" ) ; assert ( 3 , ( { int x = 3 ; ( int ) { x } ; } ) , "int x=3; (int){x};" ) ; assert ( 1 , tree -> val , "tree->val" ) ; assert ( 2 , tree -> lhs -> val , "tree->lhs->val" ) ; assert ( 3 , tree -> lhs -> lhs -> val , "tree->lhs->lhs->val" ) ; assert ( 4 , tree -> lhs -> rhs -> val , "tree->lhs->rhs->val" ) ; ret_none ( ) ; assert ( 3 , ext3 , "ext3" ) ; assert ( 2 , ( { int i = 6 ; i &= 3 ; i ; } ) , "int i=6; i&=3; i;" ) ; assert ( 7 , ( { int i = 6 ; i |= 3 ; i ; } ) , "int i=6; i|=3; i;" ) ; assert ( 10 , ( { int i = 15 ; i ^= 5 ; i ; } ) , "int 15; i^=5; i;" ) ; assert ( 7 , ( { int i = 0 ; int j = 0 ; do { j ++ ; } while ( i ++ < 6 ) ; j ; } ) , "int i=0; int j=0; do { j++; } while (i++ < 6); j;" ) ; assert ( 4 , ( { int i = 0 ; int j = 0 ; int k = 0 ; do { if ( ++ j > 3 ) break ; continue ; k ++ ; } while ( 1 ) ; j ; } ) , "int i=0; int j=0; int k=0; do { if (j++ > 3) break; continue; k++; } while (1); j;" ) ; assert ( 1 , true_fn ( ) , "true_fn()" ) ; assert ( 0 , false_fn ( ) , "false_fn()" ) ; assert ( 6 , add_all1 ( 1 , 2 , 3 , 0 ) , "add_all1(1,2,3,0)" ) ; assert ( 5 , add_all1 ( 1 , 2 , 3 , - 1 , 0 ) , "add_all1(1,2,3,-1,0)" ) ; assert ( 0 , stack_misalignment ( ) , "stack_misalignment()" ) ; assert ( 0 , ( { char x [ 5 ] ; x [ 0 ] = 0 ; stack_misalignment ( ) ; } ) , "char x[5]; x[0]=0; stack_misalignment();" ) ; assert ( 0 , add_all1 ( stack_misalignment ( ) , add_all1 ( stack_misalignment ( ) , 0 ) , 0 ) , "add_all1(stack_misalignment(), add_all1(stack_misalignment(), 0), 0)" ) ; assert ( 6 , add_all3 ( 1 , 2 , 3 , 0 ) , "add_all3(1,2,3,0)" ) ; assert ( 5 , add_all3 ( 1 , 2 , 3 , - 1 , 0 ) , "add_all3(1,2,3,-1,0)" ) ; assert ( 0 , ( { char buf [ 100 ] ; fmt ( buf , "%d %d %s" , 1 , 2 , "foo" ) ; strcmp ( "1 2 foo" , buf ) ; } ) , "char buf[100]; fmt(buf, \"%d %d %s\", 1, 2, \"foo\"); strcmp(\"1 2 foo\", buf);" ) ; assert ( 0 , ( { char buf [ 100 ] ; fmt ( buf , "%d %d %d %d" , 1 , 2 , 3 , 4 ) ; strcmp ( "1 2 3 4" , buf ) ; } ) , "char buf[100]; fmt(buf, \"%d %d %d %d\", 1, 2, 3, 4); strcmp(\"1 2 3 4\", buf);" ) ; assert ( 1 , sizeof ( char ) , "sizeof(char)" ) ; assert ( 1 , sizeof ( signed char ) , "sizeof(signed char)" ) ; assert ( 1 , sizeof ( signed char signed ) , "sizeof(signed char signed)" ) ; assert ( 2 , sizeof ( short ) , "sizeof(short)" ) ; assert ( 2 , sizeof ( int short ) , "sizeof(int short)" ) ; assert ( 2 , sizeof ( short int ) , "sizeof(short int)" ) ; assert ( 2 , sizeof ( signed short ) , "sizeof(signed short)" ) ; assert ( 2 , sizeof ( int short signed ) , "sizeof(int short signed)" ) ; assert ( 4 , sizeof ( int ) , "sizeof(int)" ) ; assert ( 4 , sizeof ( signed int ) , "sizeof(signed int)" ) ; assert ( 4 , sizeof ( signed ) , "sizeof(signed)" ) ; assert ( 4 , sizeof ( signed signed ) , "sizeof(signed signed)" ) ; assert ( 8 , sizeof ( long ) , "sizeof(long)" ) ; assert ( 8 , sizeof ( signed long ) , "sizeof(signed long)" ) ; assert ( 8 , sizeof ( signed long int ) , "sizeof(signed long int)" ) ; assert ( 8 , sizeof ( long long ) , "sizeof(long long)" ) ; assert ( 8 , sizeof ( signed long long ) , "sizeof(signed long long)" ) ; assert ( 8 , sizeof ( signed long long int ) , "sizeof(signed long long int)" ) ; assert ( 4 , sizeof ( 0 ) , "sizeof(0)" ) ; assert ( 8 , sizeof ( 0L ) , "sizeof(0L)" ) ; assert ( 8 , sizeof ( 0LL ) , "sizeof(0LL)" ) ; assert ( 8 , sizeof ( 0l ) , "sizeof(0l)" ) ; assert ( 8 , sizeof ( 0ll ) , "sizeof(0ll)" ) ; assert ( 8 , sizeof ( 0x0L ) , "sizeof(0x0L)" ) ; assert ( 8 , sizeof ( 0b0L ) , "sizeof(0b0L)" ) ; assert ( 4 , sizeof ( 2147483647 ) , "sizeof(2147483647)" ) ; assert ( 8 , sizeof ( 2147483648 ) , "sizeof(2147483648)" ) ; assert ( 2147483648 , 2147483648 , "2147483648" ) ; assert ( 4294967296 , 1L << 32 , "1L << 32" ) ; printf ( "OK\n" ) ; return 0 ; }
+main: var 0 (10 1 1 0 0(4 4 4 0 0))
+assert: var 0 (10 1 1 0 0#1) inline {ccc-codegen-19 0 1
+ int assert ( long expected , long actual , char * code ) { if ( expected == actual ) { printf ( "%s => %ld\n" , code , actual ) ; } else { printf ( "%s => %ld expected but got %ld\n" , code , expected , actual ) ; exit ( 1 ) ; } }
+assert: var 0 (10 1 1 0 0(4 4 4 0 0))
+expected: local
+actual: local
+code: local
+printf: var 0 (10 1 1 0 0#1)
+exit: var 0 (10 1 1 0 0#1)
+}
+a: ?
+z: ?
+foo: ?
+foo123: ?
+bar: ?
+ret3: var 0 (10 1 1 0 0#1) inline {ccc-codegen-19 0 1
+ int ret3 ( ) { return 3 ; return 5 ; }
+ret3: var 0 (10 1 1 0 0(4 4 4 0 0))
+}
+x: ?
+i: ?
+j: ?
+add2: var 0 (10 1 1 0 0#1) inline {ccc-codegen-19 0 1
+ int add2 ( int x , int y ) { return x + y ; }
+add2: var 0 (10 1 1 0 0(4 4 4 0 0))
+x: local
+y: local
+}
+sub2: var 0 (10 1 1 0 0#1) inline {ccc-codegen-19 0 1
+ int sub2 ( int x , int y ) { return x - y ; }
+sub2: var 0 (10 1 1 0 0(4 4 4 0 0))
+x: local
+y: local
+}
+add6: var 0 (10 1 1 0 0#1) inline {ccc-codegen-19 0 1
+ int add6 ( int a , int b , int c , int d , int e , int f ) { return a + b + c + d + e + f ; }
+add6: var 0 (10 1 1 0 0(4 4 4 0 0))
+a: local
+b: local
+c: local
+d: local
+e: local
+f: local
+}
+fib: var 0 (10 1 1 0 0#1)
+sum_fib: var 0 (10 1 1 0 0#1) inline {ccc-codegen-19 0 1
+ int sum_fib ( int n ) { int sum = 0 ; for ( int i = 0 ; i < n ; i ++ ) sum = sum + fib ( i ) ; return sum ; }
+sum_fib: var 0 (10 1 1 0 0(4 4 4 0 0))
+n: local
+sum: ?
+i: ?
+fib: var 0 (10 1 1 0 0#1)
+}
+rotate6: var 0 (10 1 1 0 0#1)
+swap_args: var 0 (10 1 1 0 0#1) inline {ccc-codegen-19 0 1
+ int swap_args ( int x , int y ) { return sub2 ( y , x ) ; }
+swap_args: var 0 (10 1 1 0 0(4 4 4 0 0))
+x: local
+y: local
+sub2: var 0 (10 1 1 0 0#1) inline {ccc-codegen-19 0 1
+ int sub2 ( int x , int y ) { return x - y ; }
+sub2: var 0 (10 1 1 0 0(4 4 4 0 0))
+x: local
+y: local
+}
+}
+inc_char: var 0 (10 1 1 0 0(2 1 1 0 0)) inline {ccc-codegen-19 0 1
+ char inc_char ( char c ) { c ++ ; return c ; }
+inc_char: var 0 (10 1 1 0 0(2 1 1 0 0))
+c: local
+}
+sum_small_array: var 0 (10 1 1 0 0#1)
+sum_large_array: var 0 (10 1 1 0 0#1)
+mix_params: var 0 (10 1 1 0 0(5 8 8 0 0)) inline {ccc-codegen-19 0 1
+ long mix_params ( long a , long b , long c , long d , long e , long f ) { long q = a / b ; long r = c << d ; return q * 1000 + r + e - f + c / d ; }
+mix_params: var 0 (10 1 1 0 0(5 8 8 0 0))
+a: local
+b: local
+c: local
+d: local
+e: local
+f: local
+q: ?
+r: ?
+}
+scale_call: var 0 (10 1 1 0 0#16) inline {ccc-codegen-19 0 1
+ long scale_call ( long a , long b , long c , long d , long e ) { return a + b + c + d + e + ( a * 3 + one ( ) * 8 ) ; }
+scale_call: var 0 (10 1 1 0 0(5 8 8 0 0))
+a: local
+b: local
+c: local
+d: local
+e: local
+one: var 0 (10 1 1 0 0#1)
+}
+bool_add: var 0 (10 1 1 0 0#16) inline {ccc-codegen-19 0 1
+ long bool_add ( long a ) { _Bool d = a ; long x = ( d += 5 ) ; return x ; }
+bool_add: var 0 (10 1 1 0 0(5 8 8 0 0))
+a: local
+d: ?
+x: ?
+}
+bool_inc_loop: var 0 (10 1 1 0 0#1)
+switch_wide: var 0 (10 1 1 0 0#1) inline {ccc-codegen-19 0 1
+ int switch_wide ( long x ) { switch ( x ) { case 3000000000 : return 1 ; case - 3000000000 : return 2 ; case 5 : return 3 ; } return 0 ; }
+switch_wide: var 0 (10 1 1 0 0(4 4 4 0 0))
+x: local
+}
+switch_wide_split: var 0 (10 1 1 0 0#1) inline {ccc-codegen-19 0 1
+ int switch_wide_split ( long x ) { switch ( x ) { case - 3000000000 : return 1 ; case 5 : return 2 ; case 100 : return 3 ; case 3000000000 : return 4 ; case 7000000000 : return 5 ; } return 0 ; }
+switch_wide_split: var 0 (10 1 1 0 0(4 4 4 0 0))
+x: local
+}
+switch_wide_table: var 0 (10 1 1 0 0#1) inline {ccc-codegen-19 0 1
+ int switch_wide_table ( long x ) { switch ( x ) { case 3000000000 : return 1 ; case 3000000001 : return 2 ; case 3000000002 : return 3 ; case 3000000004 : return 4 ; } return 0 ; }
+switch_wide_table: var 0 (10 1 1 0 0(4 4 4 0 0))
+x: local
+}
+switch_int: var 0 (10 1 1 0 0#1) inline {ccc-codegen-19 0 1
+ int switch_int ( int x ) { switch ( x ) { case 3000000000 : return 1 ; } return 0 ; }
+switch_int: var 0 (10 1 1 0 0(4 4 4 0 0))
+x: local
+}
+spill_g: var 0 (8 128 8 16 0#16)
+spill_addr: var 0 (10 1 1 0 0#16)
+classify: var 0 (10 1 1 0 0#1) inline {ccc-codegen-19 0 1
+ int classify ( int x ) { if ( x < 0 ) return - 1 ; if ( x == 0 ) return 0 ; return 1 ; }
+classify: var 0 (10 1 1 0 0(4 4 4 0 0))
+x: local
+}
+day_kind: var 0 (10 1 1 0 0#1) inline {ccc-codegen-19 0 1
+ int day_kind ( int d ) { switch ( d ) { case 0 : case 6 : return 2 ; case 3 : return 1 ; } return 0 ; }
+day_kind: var 0 (10 1 1 0 0(4 4 4 0 0))
+d: local
+}
+skip_to: var 0 (10 1 1 0 0#1) inline {ccc-codegen-19 0 1
+ int skip_to ( int x ) { if ( x > 5 ) goto big ; return x ; big : return x * 10 ; }
+skip_to: var 0 (10 1 1 0 0(4 4 4 0 0))
+x: local
+big: ?
+}
+sum_grid: var 0 (10 1 1 0 0#16)
+count_stored: var 0 (10 1 1 0 0#1) inline {ccc-codegen-19 0 1
+ int count_stored ( int n ) { loop_g = 0 ; int sum = 0 ; for ( int i = 0 ; i < n ; i ++ ) { sum += loop_g ; loop_g = loop_g + 2 ; } return sum ; }
+count_stored: var 0 (10 1 1 0 0(4 4 4 0 0))
+n: local
+loop_g: var 0 #1
+sum: ?
+i: ?
+}
+loop_g: var 0 #1
+sum_through: var 0 (10 1 1 0 0#1) inline {ccc-codegen-19 0 1
+ int sum_through ( int * p , int n ) { int sum = 0 ; for ( int i = 0 ; i < n ; i ++ ) { sum += loop_g ; * p += 1 ; } return sum ; }
+sum_through: var 0 (10 1 1 0 0(4 4 4 0 0))
+p: local
+n: local
+sum: ?
+i: ?
+loop_g: var 0 #1
+}
+sum_local_through: var 0 (10 1 1 0 0#1)
+sum_deref: var 0 (10 1 1 0 0#1) inline {ccc-codegen-19 0 1
+ int sum_deref ( int * p , int n ) { int sum = 0 ; for ( int i = 0 ; i < n ; i ++ ) sum += * p ; return sum ; }
+sum_deref: var 0 (10 1 1 0 0(4 4 4 0 0))
+p: local
+n: local
+sum: ?
+i: ?
+}
+bump: var 0 (10 1 1 0 0(0 1 1 0 0)) inline {ccc-codegen-19 0 1
+ void bump ( int * p ) { * p += 1 ; }
+bump: var 0 (10 1 1 0 0(0 1 1 0 0))
+p: local
+}
+twice: var 0 (10 1 1 0 0#1) inline {ccc-codegen-19 0 1
+ int twice ( int x ) { return x + x ; }
+twice: var 0 (10 1 1 0 0(4 4 4 0 0))
+x: local
+}
+y: ?
+addx: var 0 (10 1 1 0 0#1) inline {ccc-codegen-19 0 1
+ int addx ( int * x , int y ) { return * x + y ; }
+addx: var 0 (10 1 1 0 0(4 4 4 0 0))
+x: local
+y: local
+}
+g1: var 0 #1
+g2: var 0 (8 16 4 4 0#1)
+sub_char: var 0 (10 1 1 0 0#1) inline {ccc-codegen-19 0 1
+ int sub_char ( char a , char b , char c ) { return a - b - c ; }
+sub_char: var 0 (10 1 1 0 0(4 4 4 0 0))
+a: local
+b: local
+c: local
+}
+b: ?
+c: ?
+p: ?
+t: ?
+sub_short: var 0 (10 1 1 0 0#1) inline {ccc-codegen-19 0 1
+ int sub_short ( short a , short b , short c ) { return a - b - c ; }
+sub_short: var 0 (10 1 1 0 0(4 4 4 0 0))
+a: local
+b: local
+c: local
+}
+sub_long: var 0 (10 1 1 0 0#1) inline {ccc-codegen-19 0 1
+ int sub_long ( long a , long b , long c ) { return a - b - c ; }
+sub_long: var 0 (10 1 1 0 0(4 4 4 0 0))
+a: local
+b: local
+c: local
+}
+g1_ptr: var 0 (10 1 1 0 0(7 8 8 0 0#1)) inline {ccc-codegen-19 0 1
+ int * g1_ptr ( ) { return & g1 ; }
+g1_ptr: var 0 (10 1 1 0 0(7 8 8 0 0(4 4 4 0 0)))
+g1: var 0 #2
+}
+acc: ?
+v: ?
+MyInt: typedef #1
+zero: ?
+one: var 0 (10 1 1 0 0#16) inline {ccc-codegen-19 0 1
+ long one ( void ) { return 1 ; }
+one: var 0 (10 1 1 0 0(5 8 8 0 0))
+}
+two: ?
+five: ?
+six: ?
+seven: ?
+three: ?
+four: ?
+static_fn: var 0 (10 1 1 0 0#1) inline {ccc-codegen-19 0 1
+ static int static_fn ( ) { return 3 ; }
+static_fn: var 0 (10 1 1 0 0(4 4 4 0 0))
+}
+param_decay: var 0 (10 1 1 0 0#1) inline {ccc-codegen-19 0 1
+ int param_decay ( int x [ ] ) { return x [ 0 ] ; }
+param_decay: var 0 (10 1 1 0 0(4 4 4 0 0))
+x: local
+}
+s: ?
+T: ?
+next: ?
+n: ?
+k: ?
+l: ?
+m: ?
+e: ?
+d: ?
+f: ?
+g: ?
+h: ?
+voidfn: var 0 (10 1 1 0 0#35) inline {ccc-codegen-19 0 1
+ void voidfn ( void ) { }
+voidfn: var 0 (10 1 1 0 0(0 1 1 0 0))
+}
+ten: ?
+g3: var 0 #12
+g4: var 0 (3 2 2 0 0)
+g5: var 0 #1
+g6: var 0 #16
+g7: var 0 (7 8 8 0 0#1)
+strcmp: var 0 (10 1 1 0 0#1)
+g8: var 0 (7 8 8 0 0#12)
+g9: var 0 (8 12 4 3 0#1)
+g10: var 0 (8 16 8 2 0(7 8 8 0 0#12))
+g11: var 0 (8 16 4 2 0(9 8 4 0 0 a@0#12 b@4#1))
+g12: var 0 (8 16 4 2 0(9 8 4 0 0 a@0(8 8 4 2 0#1)))
+g13: var 0 (8 16 4 2 0(9 8 4 0 0 a@0(8 8 4 2 0#1)))
+g14: var 0 (8 16 4 2 0(9 8 4 0 0 a@0(8 8 4 2 0#1)))
+g15: var 0 (7 8 8 0 0#12)
+g16: var 0 (8 8 1 2 0(8 4 1 4 0#12))
+g17: var 0 (8 7 1 7 0#12)
+g18: var 0 (8 10 1 10 0#12)
+g19: var 0 (8 3 1 3 0#12)
+memcmp: var 0 (10 1 1 0 0#1)
+g20: var 0 (7 8 8 0 0#12)
+g21: var 0 (7 8 8 0 0#12)
+g22: var 0 (7 8 8 0 0#12)
+g23: var 0 (8 24 8 3 0(7 8 8 0 0#12))
+g24: var 0 #1
+g25: var 0 (7 8 8 0 0#1)
+g27: var 0 (7 8 8 0 0#1)
+ext1: var 0 #1
+ext2: var 0 (7 8 8 0 0#1)
+counter: var 0 (10 1 1 0 0#1) inline {ccc-codegen-19 0 1
+ int counter ( ) { static int i ; static int j = 1 + 1 ; return i ++ + j ++ ; }
+counter: var 0 (10 1 1 0 0(4 4 4 0 0))
+i: ?
+j: ?
+}
+tree: var 0 (7 8 8 0 0(9 24 8 0 0 val@0#1 lhs@8(7 8 8 0 0#83) rhs@16(7 8 8 0 0#83)))
+val: ?
+lhs: ?
+rhs: ?
+ret_none: var 0 (10 1 1 0 0#35) inline {ccc-codegen-19 0 1
+ void ret_none ( ) { return ; }
+ret_none: var 0 (10 1 1 0 0(0 1 1 0 0))
+}
+ext3: var 1 #1
+true_fn: var 0 (10 1 1 0 0(1 1 1 0 0))
+false_fn: var 0 (10 1 1 0 0#88)
+add_all1: var 0 (10 1 1 0 0#1)
+stack_misalignment: var 0 (10 1 1 0 0#16)
+add_all3: var 0 (10 1 1 0 0#1)
+buf: ?
+fmt: var 0 (10 1 1 0 0(7 8 8 0 0#12))
+printf: var 0 (10 1 1 0 0#1)
+.bss
+.data
+.align 1
+.L.data.main.641:
+  .byte 79
+  .byte 75
+  .byte 10
+  .byte 0
+.align 1
+.L.data.main.640:
+  .byte 49
+  .byte 76
+  .byte 32
+  .byte 60
+  .byte 60
+  .byte 32
+  .byte 51
+  .byte 50
+  .byte 0
+.align 1
+.L.data.main.639:
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 56
+  .byte 0
+.align 1
+.L.data.main.638:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 56
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.637:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 55
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.636:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 98
+  .byte 48
+  .byte 76
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.635:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 120
+  .byte 48
+  .byte 76
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.634:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 108
+  .byte 108
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.633:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 108
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.632:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 76
+  .byte 76
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.631:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 76
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.630:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.629:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.628:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.627:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.626:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.625:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.624:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.623:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.622:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.621:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.620:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.619:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.618:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.617:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.616:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.615:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.614:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.613:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.612:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.611:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 117
+  .byte 102
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 109
+  .byte 116
+  .byte 40
+  .byte 98
+  .byte 117
+  .byte 102
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 34
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 52
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 34
+  .byte 49
+  .byte 32
+  .byte 50
+  .byte 32
+  .byte 51
+  .byte 32
+  .byte 52
+  .byte 34
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 117
+  .byte 102
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.610:
+  .byte 49
+  .byte 32
+  .byte 50
+  .byte 32
+  .byte 51
+  .byte 32
+  .byte 52
+  .byte 0
+.align 1
+.L.data.main.609:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 0
+.align 1
+.L.data.main.608:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 117
+  .byte 102
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 109
+  .byte 116
+  .byte 40
+  .byte 98
+  .byte 117
+  .byte 102
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 34
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 34
+  .byte 49
+  .byte 32
+  .byte 50
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 117
+  .byte 102
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.607:
+  .byte 49
+  .byte 32
+  .byte 50
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 0
+.align 1
+.L.data.main.606:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 0
+.align 1
+.L.data.main.605:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 0
+.align 1
+.L.data.main.604:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 95
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 51
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 45
+  .byte 49
+  .byte 44
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.603:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 95
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 51
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.602:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 95
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 49
+  .byte 40
+  .byte 115
+  .byte 116
+  .byte 97
+  .byte 99
+  .byte 107
+  .byte 95
+  .byte 109
+  .byte 105
+  .byte 115
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 109
+  .byte 101
+  .byte 110
+  .byte 116
+  .byte 40
+  .byte 41
+  .byte 44
+  .byte 32
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 95
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 49
+  .byte 40
+  .byte 115
+  .byte 116
+  .byte 97
+  .byte 99
+  .byte 107
+  .byte 95
+  .byte 109
+  .byte 105
+  .byte 115
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 109
+  .byte 101
+  .byte 110
+  .byte 116
+  .byte 40
+  .byte 41
+  .byte 44
+  .byte 32
+  .byte 48
+  .byte 41
+  .byte 44
+  .byte 32
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.601:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 97
+  .byte 99
+  .byte 107
+  .byte 95
+  .byte 109
+  .byte 105
+  .byte 115
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 109
+  .byte 101
+  .byte 110
+  .byte 116
+  .byte 40
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.600:
+  .byte 115
+  .byte 116
+  .byte 97
+  .byte 99
+  .byte 107
+  .byte 95
+  .byte 109
+  .byte 105
+  .byte 115
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 109
+  .byte 101
+  .byte 110
+  .byte 116
+  .byte 40
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.599:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 95
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 49
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 45
+  .byte 49
+  .byte 44
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.598:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 95
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 49
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.597:
+  .byte 102
+  .byte 97
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 95
+  .byte 102
+  .byte 110
+  .byte 40
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.596:
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 101
+  .byte 95
+  .byte 102
+  .byte 110
+  .byte 40
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.595:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 107
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 111
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 32
+  .byte 62
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 107
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.594:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 111
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 32
+  .byte 60
+  .byte 32
+  .byte 54
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.593:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 49
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 94
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.592:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 124
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.591:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 38
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.590:
+  .byte 101
+  .byte 120
+  .byte 116
+  .byte 51
+  .byte 0
+.align 1
+.L.data.main.589:
+  .byte 116
+  .byte 114
+  .byte 101
+  .byte 101
+  .byte 45
+  .byte 62
+  .byte 108
+  .byte 104
+  .byte 115
+  .byte 45
+  .byte 62
+  .byte 114
+  .byte 104
+  .byte 115
+  .byte 45
+  .byte 62
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 0
+.align 1
+.L.data.main.588:
+  .byte 116
+  .byte 114
+  .byte 101
+  .byte 101
+  .byte 45
+  .byte 62
+  .byte 108
+  .byte 104
+  .byte 115
+  .byte 45
+  .byte 62
+  .byte 108
+  .byte 104
+  .byte 115
+  .byte 45
+  .byte 62
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 0
+.align 1
+.L.data.main.587:
+  .byte 116
+  .byte 114
+  .byte 101
+  .byte 101
+  .byte 45
+  .byte 62
+  .byte 108
+  .byte 104
+  .byte 115
+  .byte 45
+  .byte 62
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 0
+.align 1
+.L.data.main.586:
+  .byte 116
+  .byte 114
+  .byte 101
+  .byte 101
+  .byte 45
+  .byte 62
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 0
+.align 1
+.L.data.main.585:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 123
+  .byte 120
+  .byte 125
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.583:
+  .byte 40
+  .byte 40
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 41
+  .byte 123
+  .byte 39
+  .byte 97
+  .byte 39
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 125
+  .byte 41
+  .byte 46
+  .byte 97
+  .byte 0
+.align 1
+.L.data.main.581:
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 91
+  .byte 93
+  .byte 41
+  .byte 123
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.579:
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 123
+  .byte 49
+  .byte 125
+  .byte 0
+.align 1
+.L.data.main.577:
+  .byte 99
+  .byte 111
+  .byte 117
+  .byte 110
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 40
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.576:
+  .byte 99
+  .byte 111
+  .byte 117
+  .byte 110
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 40
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.575:
+  .byte 99
+  .byte 111
+  .byte 117
+  .byte 110
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 40
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.574:
+  .byte 95
+  .byte 65
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.573:
+  .byte 95
+  .byte 65
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.572:
+  .byte 95
+  .byte 65
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.571:
+  .byte 95
+  .byte 65
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.570:
+  .byte 95
+  .byte 65
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.569:
+  .byte 95
+  .byte 65
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.568:
+  .byte 95
+  .byte 65
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.567:
+  .byte 95
+  .byte 65
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.566:
+  .byte 95
+  .byte 65
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.565:
+  .byte 42
+  .byte 101
+  .byte 120
+  .byte 116
+  .byte 50
+  .byte 0
+.align 1
+.L.data.main.564:
+  .byte 101
+  .byte 120
+  .byte 116
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.563:
+  .byte 42
+  .byte 103
+  .byte 50
+  .byte 55
+  .byte 0
+.align 1
+.L.data.main.562:
+  .byte 42
+  .byte 103
+  .byte 50
+  .byte 53
+  .byte 0
+.align 1
+.L.data.main.561:
+  .byte 103
+  .byte 50
+  .byte 52
+  .byte 0
+.align 1
+.L.data.main.560:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 50
+  .byte 51
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 43
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.559:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.align 1
+.L.data.main.558:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 50
+  .byte 51
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.557:
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.align 1
+.L.data.main.556:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 50
+  .byte 51
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.555:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.align 1
+.L.data.main.554:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 50
+  .byte 50
+  .byte 43
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.553:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.align 1
+.L.data.main.552:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 50
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.551:
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.align 1
+.L.data.main.550:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 50
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.549:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.align 1
+.L.data.main.548:
+  .byte 109
+  .byte 101
+  .byte 109
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 57
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.547:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 0
+.align 1
+.L.data.main.546:
+  .byte 109
+  .byte 101
+  .byte 109
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 56
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 92
+  .byte 48
+  .byte 92
+  .byte 48
+  .byte 92
+  .byte 48
+  .byte 34
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.545:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+.align 1
+.L.data.main.544:
+  .byte 109
+  .byte 101
+  .byte 109
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 55
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 44
+  .byte 32
+  .byte 55
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.543:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.align 1
+.L.data.main.542:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 57
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.541:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 56
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.540:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 55
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.539:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 54
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.538:
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.align 1
+.L.data.main.537:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 54
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.536:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 0
+.align 1
+.L.data.main.535:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.534:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 0
+.align 1
+.L.data.main.533:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.532:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.531:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.530:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.529:
+  .byte 103
+  .byte 49
+  .byte 52
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.528:
+  .byte 103
+  .byte 49
+  .byte 52
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.527:
+  .byte 103
+  .byte 49
+  .byte 52
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.526:
+  .byte 103
+  .byte 49
+  .byte 52
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.525:
+  .byte 103
+  .byte 49
+  .byte 51
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.524:
+  .byte 103
+  .byte 49
+  .byte 51
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.523:
+  .byte 103
+  .byte 49
+  .byte 51
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.522:
+  .byte 103
+  .byte 49
+  .byte 51
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.521:
+  .byte 103
+  .byte 49
+  .byte 50
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.520:
+  .byte 103
+  .byte 49
+  .byte 50
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.519:
+  .byte 103
+  .byte 49
+  .byte 50
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.518:
+  .byte 103
+  .byte 49
+  .byte 50
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.517:
+  .byte 103
+  .byte 49
+  .byte 49
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 0
+.align 1
+.L.data.main.516:
+  .byte 103
+  .byte 49
+  .byte 49
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 0
+.align 1
+.L.data.main.515:
+  .byte 103
+  .byte 49
+  .byte 49
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 0
+.align 1
+.L.data.main.514:
+  .byte 103
+  .byte 49
+  .byte 49
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 0
+.align 1
+.L.data.main.513:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 47
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 42
+  .byte 103
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.512:
+  .byte 103
+  .byte 49
+  .byte 48
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.511:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 48
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.510:
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.align 1
+.L.data.main.509:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 48
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.508:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 0
+.align 1
+.L.data.main.507:
+  .byte 103
+  .byte 57
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.506:
+  .byte 103
+  .byte 57
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.505:
+  .byte 103
+  .byte 57
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.504:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 56
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.503:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+.align 1
+.L.data.main.502:
+  .byte 42
+  .byte 103
+  .byte 55
+  .byte 0
+.align 1
+.L.data.main.501:
+  .byte 103
+  .byte 54
+  .byte 0
+.align 1
+.L.data.main.500:
+  .byte 103
+  .byte 53
+  .byte 0
+.align 1
+.L.data.main.499:
+  .byte 103
+  .byte 52
+  .byte 0
+.align 1
+.L.data.main.498:
+  .byte 103
+  .byte 51
+  .byte 0
+.align 1
+.L.data.main.497:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.496:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.495:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.494:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.493:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.492:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.491:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.490:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 99
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.489:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.488:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.487:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 99
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.486:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.485:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.484:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 0
+.align 1
+.L.data.main.483:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.482:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.481:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 44
+  .byte 34
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 34
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 0
+.align 1
+.L.data.main.480:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 44
+  .byte 34
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 34
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 0
+.align 1
+.L.data.main.479:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 44
+  .byte 34
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 34
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 0
+.align 1
+.L.data.main.478:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 44
+  .byte 34
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 34
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 0
+.align 1
+.L.data.main.477:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 0
+.align 1
+.L.data.main.476:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 0
+.align 1
+.L.data.main.475:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 0
+.align 1
+.L.data.main.474:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.473:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.472:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.471:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.470:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.469:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.468:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.467:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.466:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.465:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.464:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.463:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.462:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.461:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 63
+  .byte 50
+  .byte 58
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.460:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 63
+  .byte 50
+  .byte 58
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.459:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 43
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.458:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 52
+  .byte 50
+  .byte 57
+  .byte 52
+  .byte 57
+  .byte 54
+  .byte 55
+  .byte 50
+  .byte 57
+  .byte 56
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 32
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 51
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 52
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 53
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 97
+  .byte 117
+  .byte 108
+  .byte 116
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 115
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.457:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 53
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 51
+  .byte 58
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 52
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 52
+  .byte 48
+  .byte 58
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 52
+  .byte 49
+  .byte 58
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 52
+  .byte 50
+  .byte 58
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 52
+  .byte 51
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 48
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 115
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.456:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 48
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 56
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 48
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 49
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 51
+  .byte 48
+  .byte 48
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 51
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 53
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 54
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 97
+  .byte 117
+  .byte 108
+  .byte 116
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 115
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.455:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 45
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 45
+  .byte 53
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 45
+  .byte 53
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 45
+  .byte 52
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 45
+  .byte 50
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 45
+  .byte 49
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 56
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 115
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.454:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 45
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 52
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 56
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 53
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 49
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 55
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 51
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 97
+  .byte 117
+  .byte 108
+  .byte 116
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 115
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.453:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 53
+  .byte 45
+  .byte 50
+  .byte 43
+  .byte 48
+  .byte 42
+  .byte 51
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.452:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 116
+  .byte 101
+  .byte 110
+  .byte 61
+  .byte 49
+  .byte 43
+  .byte 50
+  .byte 43
+  .byte 51
+  .byte 43
+  .byte 52
+  .byte 44
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 101
+  .byte 110
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.451:
+  .byte 48
+  .byte 63
+  .byte 49
+  .byte 58
+  .byte 50
+  .byte 0
+.align 1
+.L.data.main.450:
+  .byte 48
+  .byte 63
+  .byte 49
+  .byte 58
+  .byte 50
+  .byte 0
+.align 1
+.L.data.main.449:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 62
+  .byte 62
+  .byte 49
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.448:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 45
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.447:
+  .byte 45
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.446:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 62
+  .byte 62
+  .byte 49
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.445:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 60
+  .byte 49
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.444:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 60
+  .byte 51
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.443:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 60
+  .byte 48
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.442:
+  .byte 45
+  .byte 49
+  .byte 62
+  .byte 62
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.441:
+  .byte 53
+  .byte 62
+  .byte 62
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.440:
+  .byte 53
+  .byte 60
+  .byte 60
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.439:
+  .byte 49
+  .byte 60
+  .byte 60
+  .byte 51
+  .byte 0
+.align 1
+.L.data.main.438:
+  .byte 49
+  .byte 60
+  .byte 60
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.437:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.436:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.435:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 97
+  .byte 117
+  .byte 108
+  .byte 116
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.434:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 97
+  .byte 117
+  .byte 108
+  .byte 116
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.433:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.432:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 50
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.431:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.430:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.429:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 111
+  .byte 32
+  .byte 103
+  .byte 59
+  .byte 32
+  .byte 104
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.428:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 111
+  .byte 32
+  .byte 100
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.427:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 111
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.426:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 60
+  .byte 50
+  .byte 48
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 105
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 49
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 105
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 50
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 105
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 51
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 105
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 52
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 105
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 53
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 105
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 54
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 105
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 55
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.425:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 111
+  .byte 32
+  .byte 109
+  .byte 59
+  .byte 32
+  .byte 109
+  .byte 58
+  .byte 32
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.424:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 111
+  .byte 32
+  .byte 108
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 58
+  .byte 32
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 62
+  .byte 53
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.423:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 111
+  .byte 32
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 107
+  .byte 58
+  .byte 32
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.422:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 110
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 110
+  .byte 43
+  .byte 43
+  .byte 44
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 61
+  .byte 61
+  .byte 50
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 110
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.421:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 110
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 110
+  .byte 43
+  .byte 43
+  .byte 44
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 110
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.420:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 62
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.419:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 40
+  .byte 33
+  .byte 105
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.418:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 62
+  .byte 53
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.417:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 62
+  .byte 53
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.416:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 40
+  .byte 59
+  .byte 33
+  .byte 105
+  .byte 59
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 59
+  .byte 106
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.415:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 59
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 62
+  .byte 53
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.414:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 59
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 62
+  .byte 53
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.413:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 32
+  .byte 61
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.412:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 40
+  .byte 59
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 32
+  .byte 61
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.411:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 32
+  .byte 61
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.410:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 40
+  .byte 59
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 32
+  .byte 61
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.409:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 42
+  .byte 110
+  .byte 101
+  .byte 120
+  .byte 116
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 46
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 46
+  .byte 110
+  .byte 101
+  .byte 120
+  .byte 116
+  .byte 61
+  .byte 38
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 46
+  .byte 110
+  .byte 101
+  .byte 120
+  .byte 116
+  .byte 45
+  .byte 62
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.408:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 42
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.407:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.406:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 57
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 38
+  .byte 120
+  .byte 91
+  .byte 56
+  .byte 93
+  .byte 45
+  .byte 38
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.405:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 49
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.404:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.403:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 55
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.402:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 54
+  .byte 52
+  .byte 49
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.401:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.400:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 55
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.399:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.398:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 51
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.397:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 56
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.396:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 50
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.395:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.394:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 91
+  .byte 106
+  .byte 93
+  .byte 61
+  .byte 105
+  .byte 42
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 97
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 91
+  .byte 106
+  .byte 93
+  .byte 43
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 45
+  .byte 105
+  .byte 93
+  .byte 91
+  .byte 106
+  .byte 93
+  .byte 47
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.393:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 38
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 45
+  .byte 38
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.392:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 38
+  .byte 97
+  .byte 91
+  .byte 55
+  .byte 93
+  .byte 45
+  .byte 38
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.391:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.390:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 45
+  .byte 51
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.389:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 52
+  .byte 48
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.388:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 49
+  .byte 50
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.387:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 57
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 57
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.386:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 53
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.385:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 51
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.384:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 51
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 60
+  .byte 45
+  .byte 50
+  .byte 57
+  .byte 57
+  .byte 57
+  .byte 57
+  .byte 57
+  .byte 57
+  .byte 57
+  .byte 57
+  .byte 57
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.383:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 50
+  .byte 60
+  .byte 105
+  .byte 32
+  .byte 63
+  .byte 32
+  .byte 55
+  .byte 32
+  .byte 58
+  .byte 32
+  .byte 56
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.382:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 50
+  .byte 60
+  .byte 105
+  .byte 32
+  .byte 63
+  .byte 32
+  .byte 55
+  .byte 32
+  .byte 58
+  .byte 32
+  .byte 56
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.381:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 111
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 33
+  .byte 40
+  .byte 105
+  .byte 61
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.380:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 33
+  .byte 40
+  .byte 105
+  .byte 62
+  .byte 61
+  .byte 53
+  .byte 41
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.379:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 33
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.378:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.377:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 33
+  .byte 40
+  .byte 105
+  .byte 60
+  .byte 50
+  .byte 32
+  .byte 124
+  .byte 124
+  .byte 32
+  .byte 53
+  .byte 60
+  .byte 61
+  .byte 105
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 105
+  .byte 33
+  .byte 61
+  .byte 57
+  .byte 41
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.376:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 62
+  .byte 54
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 33
+  .byte 40
+  .byte 105
+  .byte 61
+  .byte 61
+  .byte 56
+  .byte 41
+  .byte 32
+  .byte 124
+  .byte 124
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 61
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.375:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 56
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 62
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 55
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.374:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 43
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 42
+  .byte 41
+  .byte 112
+  .byte 45
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 42
+  .byte 41
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.373:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 112
+  .byte 43
+  .byte 51
+  .byte 41
+  .byte 45
+  .byte 120
+  .byte 61
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.372:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.371:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 50
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.370:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 52
+  .byte 50
+  .byte 57
+  .byte 52
+  .byte 57
+  .byte 54
+  .byte 55
+  .byte 50
+  .byte 57
+  .byte 54
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.369:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 94
+  .byte 45
+  .byte 55
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.368:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 38
+  .byte 50
+  .byte 53
+  .byte 53
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.367:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 60
+  .byte 60
+  .byte 49
+  .byte 50
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.366:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 120
+  .byte 62
+  .byte 62
+  .byte 55
+  .byte 48
+  .byte 41
+  .byte 61
+  .byte 61
+  .byte 45
+  .byte 49
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.365:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 43
+  .byte 61
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.364:
+  .byte 103
+  .byte 49
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 49
+  .byte 60
+  .byte 60
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 49
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.363:
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 45
+  .byte 61
+  .byte 50
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.362:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 43
+  .byte 61
+  .byte 50
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.361:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 50
+  .byte 57
+  .byte 52
+  .byte 57
+  .byte 54
+  .byte 55
+  .byte 50
+  .byte 57
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.360:
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 55
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.359:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.358:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 97
+  .byte 114
+  .byte 97
+  .byte 109
+  .byte 95
+  .byte 100
+  .byte 101
+  .byte 99
+  .byte 97
+  .byte 121
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.357:
+  .byte 49
+  .byte 38
+  .byte 38
+  .byte 53
+  .byte 0
+.align 1
+.L.data.main.356:
+  .byte 40
+  .byte 50
+  .byte 45
+  .byte 50
+  .byte 41
+  .byte 38
+  .byte 38
+  .byte 53
+  .byte 0
+.align 1
+.L.data.main.355:
+  .byte 48
+  .byte 38
+  .byte 38
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.354:
+  .byte 48
+  .byte 124
+  .byte 124
+  .byte 40
+  .byte 50
+  .byte 45
+  .byte 50
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.353:
+  .byte 48
+  .byte 124
+  .byte 124
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.352:
+  .byte 48
+  .byte 124
+  .byte 124
+  .byte 40
+  .byte 50
+  .byte 45
+  .byte 50
+  .byte 41
+  .byte 124
+  .byte 124
+  .byte 53
+  .byte 0
+.align 1
+.L.data.main.351:
+  .byte 48
+  .byte 124
+  .byte 124
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.350:
+  .byte 48
+  .byte 98
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 94
+  .byte 48
+  .byte 98
+  .byte 48
+  .byte 48
+  .byte 49
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.349:
+  .byte 48
+  .byte 98
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 94
+  .byte 48
+  .byte 98
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.348:
+  .byte 48
+  .byte 94
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.347:
+  .byte 48
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 124
+  .byte 48
+  .byte 98
+  .byte 48
+  .byte 48
+  .byte 49
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.346:
+  .byte 48
+  .byte 124
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.345:
+  .byte 32
+  .byte 45
+  .byte 49
+  .byte 38
+  .byte 49
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.344:
+  .byte 55
+  .byte 38
+  .byte 51
+  .byte 0
+.align 1
+.L.data.main.343:
+  .byte 51
+  .byte 38
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.342:
+  .byte 48
+  .byte 38
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.341:
+  .byte 126
+  .byte 45
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.340:
+  .byte 126
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.339:
+  .byte 33
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.338:
+  .byte 33
+  .byte 50
+  .byte 0
+.align 1
+.L.data.main.337:
+  .byte 33
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.336:
+  .byte 48
+  .byte 66
+  .byte 49
+  .byte 48
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.335:
+  .byte 48
+  .byte 98
+  .byte 49
+  .byte 48
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.334:
+  .byte 48
+  .byte 98
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.333:
+  .byte 48
+  .byte 98
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.332:
+  .byte 48
+  .byte 88
+  .byte 66
+  .byte 69
+  .byte 69
+  .byte 70
+  .byte 0
+.align 1
+.L.data.main.331:
+  .byte 48
+  .byte 120
+  .byte 66
+  .byte 69
+  .byte 69
+  .byte 70
+  .byte 0
+.align 1
+.L.data.main.330:
+  .byte 48
+  .byte 120
+  .byte 98
+  .byte 101
+  .byte 101
+  .byte 102
+  .byte 0
+.align 1
+.L.data.main.329:
+  .byte 48
+  .byte 88
+  .byte 65
+  .byte 0
+.align 1
+.L.data.main.328:
+  .byte 48
+  .byte 120
+  .byte 97
+  .byte 0
+.align 1
+.L.data.main.327:
+  .byte 48
+  .byte 120
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.326:
+  .byte 48
+  .byte 55
+  .byte 55
+  .byte 55
+  .byte 0
+.align 1
+.L.data.main.325:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 47
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.324:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 47
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.323:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 42
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.322:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 42
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.321:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 45
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.320:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 45
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.319:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.318:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.317:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.316:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.315:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.314:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.313:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 45
+  .byte 45
+  .byte 42
+  .byte 112
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.312:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.311:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 43
+  .byte 43
+  .byte 42
+  .byte 112
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.310:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.309:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.308:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.307:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.306:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.305:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 45
+  .byte 45
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.304:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 43
+  .byte 43
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.303:
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.302:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 106
+  .byte 43
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.301:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 106
+  .byte 43
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.300:
+  .byte 115
+  .byte 116
+  .byte 97
+  .byte 116
+  .byte 105
+  .byte 99
+  .byte 95
+  .byte 102
+  .byte 110
+  .byte 40
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.299:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 111
+  .byte 110
+  .byte 101
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 119
+  .byte 111
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 121
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.298:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 111
+  .byte 110
+  .byte 101
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 119
+  .byte 111
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.297:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 102
+  .byte 105
+  .byte 118
+  .byte 101
+  .byte 61
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 104
+  .byte 114
+  .byte 101
+  .byte 101
+  .byte 61
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 117
+  .byte 114
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 117
+  .byte 114
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.296:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 102
+  .byte 105
+  .byte 118
+  .byte 101
+  .byte 61
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 104
+  .byte 114
+  .byte 101
+  .byte 101
+  .byte 61
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 117
+  .byte 114
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 104
+  .byte 114
+  .byte 101
+  .byte 101
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.295:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 102
+  .byte 105
+  .byte 118
+  .byte 101
+  .byte 61
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 104
+  .byte 114
+  .byte 101
+  .byte 101
+  .byte 61
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 117
+  .byte 114
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 105
+  .byte 118
+  .byte 101
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.294:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 102
+  .byte 105
+  .byte 118
+  .byte 101
+  .byte 61
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 104
+  .byte 114
+  .byte 101
+  .byte 101
+  .byte 61
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 117
+  .byte 114
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.293:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 102
+  .byte 105
+  .byte 118
+  .byte 101
+  .byte 61
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 115
+  .byte 101
+  .byte 118
+  .byte 101
+  .byte 110
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.292:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 102
+  .byte 105
+  .byte 118
+  .byte 101
+  .byte 61
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 115
+  .byte 101
+  .byte 118
+  .byte 101
+  .byte 110
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 105
+  .byte 118
+  .byte 101
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.291:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 111
+  .byte 110
+  .byte 101
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 119
+  .byte 111
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 119
+  .byte 111
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.290:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 111
+  .byte 110
+  .byte 101
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 119
+  .byte 111
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 111
+  .byte 110
+  .byte 101
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.289:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 111
+  .byte 110
+  .byte 101
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 119
+  .byte 111
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.288:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 39
+  .byte 97
+  .byte 39
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.287:
+  .byte 39
+  .byte 97
+  .byte 39
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.286:
+  .byte 39
+  .byte 92
+  .byte 110
+  .byte 39
+  .byte 0
+.align 1
+.L.data.main.285:
+  .byte 39
+  .byte 97
+  .byte 39
+  .byte 0
+.align 1
+.L.data.main.284:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 42
+  .byte 41
+  .byte 121
+  .byte 0
+.align 1
+.L.data.main.283:
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 38
+  .byte 42
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 41
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.282:
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.281:
+  .byte 40
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 41
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 50
+  .byte 53
+  .byte 54
+  .byte 0
+.align 1
+.L.data.main.280:
+  .byte 40
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 41
+  .byte 50
+  .byte 0
+.align 1
+.L.data.main.279:
+  .byte 40
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 41
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.278:
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 56
+  .byte 53
+  .byte 57
+  .byte 48
+  .byte 48
+  .byte 54
+  .byte 54
+  .byte 49
+  .byte 55
+  .byte 55
+  .byte 0
+.align 1
+.L.data.main.277:
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 56
+  .byte 53
+  .byte 57
+  .byte 48
+  .byte 48
+  .byte 54
+  .byte 54
+  .byte 49
+  .byte 55
+  .byte 55
+  .byte 0
+.align 1
+.L.data.main.276:
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 56
+  .byte 53
+  .byte 57
+  .byte 48
+  .byte 48
+  .byte 54
+  .byte 54
+  .byte 49
+  .byte 55
+  .byte 55
+  .byte 0
+.align 1
+.L.data.main.275:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.274:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.273:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.272:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 40
+  .byte 42
+  .byte 41
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.271:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 40
+  .byte 42
+  .byte 41
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.270:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.269:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 42
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.268:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.267:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.266:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.265:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.264:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.263:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.262:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.261:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.260:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.259:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.258:
+  .byte 77
+  .byte 121
+  .byte 73
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.257:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.256:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.255:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.254:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.253:
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 116
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.252:
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 116
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.251:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.250:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.249:
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.248:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.247:
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 38
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.246:
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.245:
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.244:
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.243:
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.242:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 99
+  .byte 99
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 118
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 60
+  .byte 52
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 99
+  .byte 99
+  .byte 43
+  .byte 61
+  .byte 43
+  .byte 43
+  .byte 118
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 99
+  .byte 99
+  .byte 42
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 97
+  .byte 99
+  .byte 99
+  .byte 43
+  .byte 105
+  .byte 42
+  .byte 48
+  .byte 43
+  .byte 57
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.241:
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 43
+  .byte 43
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.240:
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 40
+  .byte 98
+  .byte 61
+  .byte 55
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.239:
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 43
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.238:
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.237:
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.236:
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.235:
+  .byte 42
+  .byte 103
+  .byte 49
+  .byte 95
+  .byte 112
+  .byte 116
+  .byte 114
+  .byte 40
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.234:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 121
+  .byte 41
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.233:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.232:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 120
+  .byte 41
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.231:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.230:
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 95
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 40
+  .byte 55
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.229:
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 95
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 40
+  .byte 55
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.228:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 98
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.227:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.226:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.225:
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.224:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 121
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.223:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 121
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.222:
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 116
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.221:
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.220:
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 116
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.219:
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.218:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 45
+  .byte 62
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.217:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 45
+  .byte 62
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.216:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 46
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 43
+  .byte 121
+  .byte 46
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.215:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 121
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.214:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 45
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.213:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 45
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.212:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.211:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.210:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.209:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 125
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.208:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.207:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.206:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.205:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.204:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.203:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.202:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.201:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.200:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.199:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.198:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.197:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 99
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 99
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.196:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.195:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 99
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.194:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.193:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.192:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 45
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.191:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.190:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.189:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.188:
+  .byte 34
+  .byte 92
+  .byte 108
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.187:
+  .byte 108
+  .byte 0
+.align 1
+.L.data.main.186:
+  .byte 34
+  .byte 92
+  .byte 107
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.185:
+  .byte 107
+  .byte 0
+.align 1
+.L.data.main.184:
+  .byte 34
+  .byte 92
+  .byte 106
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.183:
+  .byte 106
+  .byte 0
+.align 1
+.L.data.main.182:
+  .byte 34
+  .byte 92
+  .byte 48
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.181:
+  .byte 0
+  .byte 0
+.align 1
+.L.data.main.180:
+  .byte 34
+  .byte 92
+  .byte 101
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.179:
+  .byte 27
+  .byte 0
+.align 1
+.L.data.main.178:
+  .byte 34
+  .byte 92
+  .byte 114
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.177:
+  .byte 13
+  .byte 0
+.align 1
+.L.data.main.176:
+  .byte 34
+  .byte 92
+  .byte 102
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.175:
+  .byte 12
+  .byte 0
+.align 1
+.L.data.main.174:
+  .byte 34
+  .byte 92
+  .byte 118
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.173:
+  .byte 11
+  .byte 0
+.align 1
+.L.data.main.172:
+  .byte 34
+  .byte 92
+  .byte 110
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.171:
+  .byte 10
+  .byte 0
+.align 1
+.L.data.main.170:
+  .byte 34
+  .byte 92
+  .byte 116
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.169:
+  .byte 9
+  .byte 0
+.align 1
+.L.data.main.168:
+  .byte 34
+  .byte 92
+  .byte 98
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.167:
+  .byte 8
+  .byte 0
+.align 1
+.L.data.main.166:
+  .byte 34
+  .byte 92
+  .byte 97
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.165:
+  .byte 7
+  .byte 0
+.align 1
+.L.data.main.164:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.163:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+.align 1
+.L.data.main.162:
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.161:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+.align 1
+.L.data.main.160:
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.159:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+.align 1
+.L.data.main.158:
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.157:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+.align 1
+.L.data.main.156:
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.155:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+.align 1
+.L.data.main.154:
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 95
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 40
+  .byte 55
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.153:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.152:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.151:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.150:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.149:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.148:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 103
+  .byte 50
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.147:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.146:
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.145:
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.144:
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.143:
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.142:
+  .byte 103
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.141:
+  .byte 103
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.140:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 42
+  .byte 42
+  .byte 120
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.139:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 120
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.138:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 42
+  .byte 42
+  .byte 120
+  .byte 41
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.137:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 42
+  .byte 42
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.136:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 42
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.135:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.134:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.133:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.132:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.131:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.130:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 54
+  .byte 93
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.129:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.128:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.127:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.126:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.125:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.124:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.123:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 50
+  .byte 91
+  .byte 120
+  .byte 93
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.122:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.121:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.120:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.119:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.118:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 43
+  .byte 54
+  .byte 41
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.117:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 43
+  .byte 53
+  .byte 41
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.116:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 43
+  .byte 52
+  .byte 41
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.115:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 43
+  .byte 51
+  .byte 41
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.114:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 42
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.113:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 42
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.112:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.111:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.110:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.109:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.108:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.107:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 120
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 121
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.106:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 38
+  .byte 121
+  .byte 45
+  .byte 49
+  .byte 41
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.105:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.104:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.103:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 122
+  .byte 61
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 122
+  .byte 45
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.102:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 122
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 122
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.101:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 45
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.100:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 38
+  .byte 121
+  .byte 45
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.99:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 49
+  .byte 43
+  .byte 38
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.98:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.97:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 122
+  .byte 61
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 122
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.96:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.95:
+  .byte 116
+  .byte 119
+  .byte 105
+  .byte 99
+  .byte 101
+  .byte 40
+  .byte 116
+  .byte 119
+  .byte 105
+  .byte 99
+  .byte 101
+  .byte 40
+  .byte 116
+  .byte 119
+  .byte 105
+  .byte 99
+  .byte 101
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.94:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 116
+  .byte 119
+  .byte 105
+  .byte 99
+  .byte 101
+  .byte 40
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 42
+  .byte 49
+  .byte 48
+  .byte 43
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.93:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 117
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 38
+  .byte 105
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 117
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 38
+  .byte 105
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.92:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 100
+  .byte 101
+  .byte 114
+  .byte 101
+  .byte 102
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.91:
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 100
+  .byte 101
+  .byte 114
+  .byte 101
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.90:
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 108
+  .byte 111
+  .byte 99
+  .byte 97
+  .byte 108
+  .byte 95
+  .byte 116
+  .byte 104
+  .byte 114
+  .byte 111
+  .byte 117
+  .byte 103
+  .byte 104
+  .byte 40
+  .byte 52
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.89:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 111
+  .byte 112
+  .byte 95
+  .byte 103
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 116
+  .byte 104
+  .byte 114
+  .byte 111
+  .byte 117
+  .byte 103
+  .byte 104
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 52
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.88:
+  .byte 108
+  .byte 111
+  .byte 111
+  .byte 112
+  .byte 95
+  .byte 103
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 116
+  .byte 104
+  .byte 114
+  .byte 111
+  .byte 117
+  .byte 103
+  .byte 104
+  .byte 40
+  .byte 38
+  .byte 108
+  .byte 111
+  .byte 111
+  .byte 112
+  .byte 95
+  .byte 103
+  .byte 44
+  .byte 32
+  .byte 52
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.87:
+  .byte 99
+  .byte 111
+  .byte 117
+  .byte 110
+  .byte 116
+  .byte 95
+  .byte 115
+  .byte 116
+  .byte 111
+  .byte 114
+  .byte 101
+  .byte 100
+  .byte 40
+  .byte 53
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.86:
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 103
+  .byte 114
+  .byte 105
+  .byte 100
+  .byte 40
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.85:
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 103
+  .byte 114
+  .byte 105
+  .byte 100
+  .byte 40
+  .byte 52
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.84:
+  .byte 115
+  .byte 107
+  .byte 105
+  .byte 112
+  .byte 95
+  .byte 116
+  .byte 111
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 43
+  .byte 115
+  .byte 107
+  .byte 105
+  .byte 112
+  .byte 95
+  .byte 116
+  .byte 111
+  .byte 40
+  .byte 56
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.83:
+  .byte 115
+  .byte 107
+  .byte 105
+  .byte 112
+  .byte 95
+  .byte 116
+  .byte 111
+  .byte 40
+  .byte 55
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.82:
+  .byte 115
+  .byte 107
+  .byte 105
+  .byte 112
+  .byte 95
+  .byte 116
+  .byte 111
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.81:
+  .byte 100
+  .byte 97
+  .byte 121
+  .byte 95
+  .byte 107
+  .byte 105
+  .byte 110
+  .byte 100
+  .byte 40
+  .byte 52
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.80:
+  .byte 100
+  .byte 97
+  .byte 121
+  .byte 95
+  .byte 107
+  .byte 105
+  .byte 110
+  .byte 100
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.79:
+  .byte 100
+  .byte 97
+  .byte 121
+  .byte 95
+  .byte 107
+  .byte 105
+  .byte 110
+  .byte 100
+  .byte 40
+  .byte 54
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.78:
+  .byte 100
+  .byte 97
+  .byte 121
+  .byte 95
+  .byte 107
+  .byte 105
+  .byte 110
+  .byte 100
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.77:
+  .byte 99
+  .byte 108
+  .byte 97
+  .byte 115
+  .byte 115
+  .byte 105
+  .byte 102
+  .byte 121
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 43
+  .byte 99
+  .byte 108
+  .byte 97
+  .byte 115
+  .byte 115
+  .byte 105
+  .byte 102
+  .byte 121
+  .byte 40
+  .byte 45
+  .byte 50
+  .byte 41
+  .byte 43
+  .byte 99
+  .byte 108
+  .byte 97
+  .byte 115
+  .byte 115
+  .byte 105
+  .byte 102
+  .byte 121
+  .byte 40
+  .byte 57
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.76:
+  .byte 99
+  .byte 108
+  .byte 97
+  .byte 115
+  .byte 115
+  .byte 105
+  .byte 102
+  .byte 121
+  .byte 40
+  .byte 55
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.75:
+  .byte 99
+  .byte 108
+  .byte 97
+  .byte 115
+  .byte 115
+  .byte 105
+  .byte 102
+  .byte 121
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.74:
+  .byte 99
+  .byte 108
+  .byte 97
+  .byte 115
+  .byte 115
+  .byte 105
+  .byte 102
+  .byte 121
+  .byte 40
+  .byte 45
+  .byte 53
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.73:
+  .byte 115
+  .byte 112
+  .byte 105
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 103
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 112
+  .byte 105
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 114
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 52
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.72:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 40
+  .byte 45
+  .byte 49
+  .byte 50
+  .byte 57
+  .byte 52
+  .byte 57
+  .byte 54
+  .byte 55
+  .byte 50
+  .byte 57
+  .byte 54
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.71:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 119
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 95
+  .byte 116
+  .byte 97
+  .byte 98
+  .byte 108
+  .byte 101
+  .byte 40
+  .byte 52
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.70:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 119
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 95
+  .byte 116
+  .byte 97
+  .byte 98
+  .byte 108
+  .byte 101
+  .byte 40
+  .byte 51
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 51
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.69:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 119
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 95
+  .byte 116
+  .byte 97
+  .byte 98
+  .byte 108
+  .byte 101
+  .byte 40
+  .byte 51
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 52
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.68:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 119
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 95
+  .byte 116
+  .byte 97
+  .byte 98
+  .byte 108
+  .byte 101
+  .byte 40
+  .byte 51
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.67:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 119
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 95
+  .byte 115
+  .byte 112
+  .byte 108
+  .byte 105
+  .byte 116
+  .byte 40
+  .byte 54
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.66:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 119
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 95
+  .byte 115
+  .byte 112
+  .byte 108
+  .byte 105
+  .byte 116
+  .byte 40
+  .byte 55
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.65:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 119
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 95
+  .byte 115
+  .byte 112
+  .byte 108
+  .byte 105
+  .byte 116
+  .byte 40
+  .byte 51
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.64:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 119
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 95
+  .byte 115
+  .byte 112
+  .byte 108
+  .byte 105
+  .byte 116
+  .byte 40
+  .byte 45
+  .byte 51
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.63:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 119
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 40
+  .byte 45
+  .byte 49
+  .byte 50
+  .byte 57
+  .byte 52
+  .byte 57
+  .byte 54
+  .byte 55
+  .byte 50
+  .byte 57
+  .byte 54
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.62:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 119
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 40
+  .byte 53
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.61:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 119
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 40
+  .byte 45
+  .byte 51
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.60:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 119
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 40
+  .byte 51
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.59:
+  .byte 98
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 95
+  .byte 105
+  .byte 110
+  .byte 99
+  .byte 95
+  .byte 108
+  .byte 111
+  .byte 111
+  .byte 112
+  .byte 40
+  .byte 34
+  .byte 92
+  .byte 48
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.58:
+  .byte 0
+  .byte 0
+.align 1
+.L.data.main.57:
+  .byte 98
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 95
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.56:
+  .byte 115
+  .byte 99
+  .byte 97
+  .byte 108
+  .byte 101
+  .byte 95
+  .byte 99
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 52
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.55:
+  .byte 109
+  .byte 105
+  .byte 120
+  .byte 95
+  .byte 112
+  .byte 97
+  .byte 114
+  .byte 97
+  .byte 109
+  .byte 115
+  .byte 40
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 52
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.54:
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 115
+  .byte 109
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 97
+  .byte 121
+  .byte 40
+  .byte 50
+  .byte 41
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 108
+  .byte 97
+  .byte 114
+  .byte 103
+  .byte 101
+  .byte 95
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 97
+  .byte 121
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.53:
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 108
+  .byte 97
+  .byte 114
+  .byte 103
+  .byte 101
+  .byte 95
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 97
+  .byte 121
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.52:
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 115
+  .byte 109
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 97
+  .byte 121
+  .byte 40
+  .byte 50
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.51:
+  .byte 105
+  .byte 110
+  .byte 99
+  .byte 95
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 40
+  .byte 49
+  .byte 50
+  .byte 55
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.50:
+  .byte 115
+  .byte 119
+  .byte 97
+  .byte 112
+  .byte 95
+  .byte 97
+  .byte 114
+  .byte 103
+  .byte 115
+  .byte 40
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.49:
+  .byte 114
+  .byte 111
+  .byte 116
+  .byte 97
+  .byte 116
+  .byte 101
+  .byte 54
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.48:
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 102
+  .byte 105
+  .byte 98
+  .byte 40
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.47:
+  .byte 102
+  .byte 105
+  .byte 98
+  .byte 40
+  .byte 57
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.46:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 41
+  .byte 41
+  .byte 42
+  .byte 40
+  .byte 52
+  .byte 43
+  .byte 40
+  .byte 53
+  .byte 42
+  .byte 40
+  .byte 54
+  .byte 43
+  .byte 40
+  .byte 55
+  .byte 42
+  .byte 40
+  .byte 56
+  .byte 43
+  .byte 40
+  .byte 57
+  .byte 42
+  .byte 40
+  .byte 49
+  .byte 48
+  .byte 43
+  .byte 40
+  .byte 49
+  .byte 49
+  .byte 42
+  .byte 40
+  .byte 49
+  .byte 50
+  .byte 43
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 54
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 41
+  .byte 47
+  .byte 40
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 49
+  .byte 52
+  .byte 44
+  .byte 49
+  .byte 53
+  .byte 41
+  .byte 45
+  .byte 49
+  .byte 51
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.45:
+  .byte 49
+  .byte 43
+  .byte 40
+  .byte 50
+  .byte 43
+  .byte 40
+  .byte 51
+  .byte 43
+  .byte 40
+  .byte 52
+  .byte 43
+  .byte 40
+  .byte 53
+  .byte 43
+  .byte 40
+  .byte 54
+  .byte 43
+  .byte 40
+  .byte 55
+  .byte 43
+  .byte 40
+  .byte 56
+  .byte 43
+  .byte 40
+  .byte 57
+  .byte 43
+  .byte 40
+  .byte 49
+  .byte 48
+  .byte 43
+  .byte 40
+  .byte 49
+  .byte 49
+  .byte 43
+  .byte 40
+  .byte 49
+  .byte 50
+  .byte 43
+  .byte 40
+  .byte 49
+  .byte 51
+  .byte 43
+  .byte 40
+  .byte 49
+  .byte 52
+  .byte 43
+  .byte 40
+  .byte 49
+  .byte 53
+  .byte 43
+  .byte 49
+  .byte 54
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.44:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 54
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.43:
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 40
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.42:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 40
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.41:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.40:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 40
+  .byte 105
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 106
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.39:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 40
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.38:
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 50
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.37:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 50
+  .byte 45
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.36:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.35:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 49
+  .byte 45
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.34:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.33:
+  .byte 114
+  .byte 101
+  .byte 116
+  .byte 51
+  .byte 40
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.32:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 43
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.31:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.30:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 122
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 43
+  .byte 122
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.29:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.28:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 122
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 122
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 43
+  .byte 122
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.27:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.26:
+  .byte 49
+  .byte 62
+  .byte 61
+  .byte 50
+  .byte 0
+.align 1
+.L.data.main.25:
+  .byte 49
+  .byte 62
+  .byte 61
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.24:
+  .byte 49
+  .byte 62
+  .byte 61
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.23:
+  .byte 49
+  .byte 62
+  .byte 50
+  .byte 0
+.align 1
+.L.data.main.22:
+  .byte 49
+  .byte 62
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.21:
+  .byte 49
+  .byte 62
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.20:
+  .byte 50
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.19:
+  .byte 49
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.18:
+  .byte 48
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.17:
+  .byte 50
+  .byte 60
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.16:
+  .byte 49
+  .byte 60
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.15:
+  .byte 48
+  .byte 60
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.14:
+  .byte 52
+  .byte 50
+  .byte 33
+  .byte 61
+  .byte 52
+  .byte 50
+  .byte 0
+.align 1
+.L.data.main.13:
+  .byte 48
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.12:
+  .byte 52
+  .byte 50
+  .byte 61
+  .byte 61
+  .byte 52
+  .byte 50
+  .byte 0
+.align 1
+.L.data.main.11:
+  .byte 48
+  .byte 61
+  .byte 61
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.10:
+  .byte 45
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 43
+  .byte 49
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.9:
+  .byte 45
+  .byte 32
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.8:
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.7:
+  .byte 40
+  .byte 51
+  .byte 43
+  .byte 53
+  .byte 41
+  .byte 47
+  .byte 50
+  .byte 0
+.align 1
+.L.data.main.6:
+  .byte 53
+  .byte 42
+  .byte 40
+  .byte 57
+  .byte 45
+  .byte 54
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.5:
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.4:
+  .byte 32
+  .byte 49
+  .byte 50
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 51
+  .byte 52
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 53
+  .byte 32
+  .byte 0
+.align 1
+.L.data.main.3:
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.2:
+  .byte 52
+  .byte 50
+  .byte 0
+.align 1
+.L.data.main.1:
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.0:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 122
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 43
+  .byte 122
+  .byte 59
+  .byte 0
+.text
+.p2align 4
+.global main
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 19408
+  mov qword ptr [rbp-19368], rbx
+  mov qword ptr [rbp-19376], r12
+  mov qword ptr [rbp-19384], r13
+  mov qword ptr [rbp-19392], r14
+  mov qword ptr [rbp-19400], r15
+  mov qword ptr [rbp-15152], 8
+  mov dword ptr [rbp-19180], 3
+  mov dword ptr [rbp-19176], 5
+  movsxd rsi, dword ptr [rbp-19180]
+  movsxd rdi, dword ptr [rbp-19176]
+  add rsi, rdi
+  mov qword ptr [rbp-15160], rsi
+  lea rsi, [rip+.L.data.main.0]
+  mov qword ptr [rbp-15168], rsi
+  mov rsi, qword ptr [rbp-15152]
+  cmp rsi, qword ptr [rbp-15160]
+  jne .L.else.main.2
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-15168]
+  mov r9, qword ptr [rbp-15160]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.3
+.L.else.main.2:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-15168]
+  mov r9, qword ptr [rbp-15152]
+  mov r10, qword ptr [rbp-15160]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.3:
+  mov qword ptr [rbp-15128], 0
+  mov qword ptr [rbp-15136], 0
+  lea rsi, [rip+.L.data.main.1]
+  mov qword ptr [rbp-15144], rsi
+  mov rsi, qword ptr [rbp-15128]
+  cmp rsi, qword ptr [rbp-15136]
+  jne .L.else.main.4
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-15144]
+  mov r9, qword ptr [rbp-15136]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.5
+.L.else.main.4:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-15144]
+  mov r9, qword ptr [rbp-15128]
+  mov r10, qword ptr [rbp-15136]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.5:
+  mov qword ptr [rbp-15104], 42
+  mov qword ptr [rbp-15112], 42
+  lea rsi, [rip+.L.data.main.2]
+  mov qword ptr [rbp-15120], rsi
+  mov rsi, qword ptr [rbp-15104]
+  cmp rsi, qword ptr [rbp-15112]
+  jne .L.else.main.6
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-15120]
+  mov r9, qword ptr [rbp-15112]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.7
+.L.else.main.6:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-15120]
+  mov r9, qword ptr [rbp-15104]
+  mov r10, qword ptr [rbp-15112]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.7:
+  mov qword ptr [rbp-15080], 5
+  mov qword ptr [rbp-15088], 5
+  lea rsi, [rip+.L.data.main.3]
+  mov qword ptr [rbp-15096], rsi
+  mov rsi, qword ptr [rbp-15080]
+  cmp rsi, qword ptr [rbp-15088]
+  jne .L.else.main.8
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-15096]
+  mov r9, qword ptr [rbp-15088]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.9
+.L.else.main.8:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-15096]
+  mov r9, qword ptr [rbp-15080]
+  mov r10, qword ptr [rbp-15088]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.9:
+  mov qword ptr [rbp-15056], 41
+  mov rsi, 12
+  add rsi, 34
+  sub rsi, 5
+  mov qword ptr [rbp-15064], rsi
+  lea rsi, [rip+.L.data.main.4]
+  mov qword ptr [rbp-15072], rsi
+  mov rsi, qword ptr [rbp-15056]
+  cmp rsi, qword ptr [rbp-15064]
+  jne .L.else.main.10
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-15072]
+  mov r9, qword ptr [rbp-15064]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.11
+.L.else.main.10:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-15072]
+  mov r9, qword ptr [rbp-15056]
+  mov r10, qword ptr [rbp-15064]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.11:
+  mov qword ptr [rbp-15032], 5
+  mov qword ptr [rbp-15040], 5
+  lea rsi, [rip+.L.data.main.5]
+  mov qword ptr [rbp-15048], rsi
+  mov rsi, qword ptr [rbp-15032]
+  cmp rsi, qword ptr [rbp-15040]
+  jne .L.else.main.12
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-15048]
+  mov r9, qword ptr [rbp-15040]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.13
+.L.else.main.12:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-15048]
+  mov r9, qword ptr [rbp-15032]
+  mov r10, qword ptr [rbp-15040]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.13:
+  mov qword ptr [rbp-15008], 15
+  mov rsi, 5
+  mov rdi, 9
+  sub rdi, 6
+  imul rsi, rdi
+  mov qword ptr [rbp-15016], rsi
+  lea rsi, [rip+.L.data.main.6]
+  mov qword ptr [rbp-15024], rsi
+  mov rsi, qword ptr [rbp-15008]
+  cmp rsi, qword ptr [rbp-15016]
+  jne .L.else.main.14
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-15024]
+  mov r9, qword ptr [rbp-15016]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.15
+.L.else.main.14:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-15024]
+  mov r9, qword ptr [rbp-15008]
+  mov r10, qword ptr [rbp-15016]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.15:
+  mov qword ptr [rbp-14984], 4
+  mov rsi, 3
+  add rsi, 5
+  mov rdi, rsi
+  sar rdi, 63
+  and rdi, 1
+  add rsi, rdi
+  sar rsi, 1
+  mov qword ptr [rbp-14992], rsi
+  lea rsi, [rip+.L.data.main.7]
+  mov qword ptr [rbp-15000], rsi
+  mov rsi, qword ptr [rbp-14984]
+  cmp rsi, qword ptr [rbp-14992]
+  jne .L.else.main.16
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-15000]
+  mov r9, qword ptr [rbp-14992]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.17
+.L.else.main.16:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-15000]
+  mov r9, qword ptr [rbp-14984]
+  mov r10, qword ptr [rbp-14992]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.17:
+  mov rsi, 0
+  sub rsi, 10
+  mov qword ptr [rbp-14960], rsi
+  mov rsi, 0
+  sub rsi, 10
+  mov qword ptr [rbp-14968], rsi
+  lea rsi, [rip+.L.data.main.8]
+  mov qword ptr [rbp-14976], rsi
+  mov rsi, qword ptr [rbp-14960]
+  cmp rsi, qword ptr [rbp-14968]
+  jne .L.else.main.18
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14976]
+  mov r9, qword ptr [rbp-14968]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.19
+.L.else.main.18:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14976]
+  mov r9, qword ptr [rbp-14960]
+  mov r10, qword ptr [rbp-14968]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.19:
+  mov qword ptr [rbp-14936], 10
+  mov rsi, 0
+  mov rdi, 0
+  sub rdi, 10
+  sub rsi, rdi
+  mov qword ptr [rbp-14944], rsi
+  lea rsi, [rip+.L.data.main.9]
+  mov qword ptr [rbp-14952], rsi
+  mov rsi, qword ptr [rbp-14936]
+  cmp rsi, qword ptr [rbp-14944]
+  jne .L.else.main.20
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14952]
+  mov r9, qword ptr [rbp-14944]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.21
+.L.else.main.20:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14952]
+  mov r9, qword ptr [rbp-14936]
+  mov r10, qword ptr [rbp-14944]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.21:
+  mov qword ptr [rbp-14912], 10
+  mov rsi, 0
+  mov rdi, 0
+  sub rdi, 10
+  sub rsi, rdi
+  mov qword ptr [rbp-14920], rsi
+  lea rsi, [rip+.L.data.main.10]
+  mov qword ptr [rbp-14928], rsi
+  mov rsi, qword ptr [rbp-14912]
+  cmp rsi, qword ptr [rbp-14920]
+  jne .L.else.main.22
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14928]
+  mov r9, qword ptr [rbp-14920]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.23
+.L.else.main.22:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14928]
+  mov r9, qword ptr [rbp-14912]
+  mov r10, qword ptr [rbp-14920]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.23:
+  mov qword ptr [rbp-14888], 0
+  mov rsi, 0
+  cmp rsi, 1
+  sete sil
+  movzx rsi, sil
+  mov qword ptr [rbp-14896], rsi
+  lea rsi, [rip+.L.data.main.11]
+  mov qword ptr [rbp-14904], rsi
+  mov rsi, qword ptr [rbp-14888]
+  cmp rsi, qword ptr [rbp-14896]
+  jne .L.else.main.24
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14904]
+  mov r9, qword ptr [rbp-14896]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.25
+.L.else.main.24:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14904]
+  mov r9, qword ptr [rbp-14888]
+  mov r10, qword ptr [rbp-14896]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.25:
+  mov qword ptr [rbp-14864], 1
+  mov rsi, 42
+  cmp rsi, 42
+  sete sil
+  movzx rsi, sil
+  mov qword ptr [rbp-14872], rsi
+  lea rsi, [rip+.L.data.main.12]
+  mov qword ptr [rbp-14880], rsi
+  mov rsi, qword ptr [rbp-14864]
+  cmp rsi, qword ptr [rbp-14872]
+  jne .L.else.main.26
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14880]
+  mov r9, qword ptr [rbp-14872]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.27
+.L.else.main.26:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14880]
+  mov r9, qword ptr [rbp-14864]
+  mov r10, qword ptr [rbp-14872]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.27:
+  mov qword ptr [rbp-14840], 1
+  mov rsi, 0
+  cmp rsi, 1
+  setne sil
+  movzx rsi, sil
+  mov qword ptr [rbp-14848], rsi
+  lea rsi, [rip+.L.data.main.13]
+  mov qword ptr [rbp-14856], rsi
+  mov rsi, qword ptr [rbp-14840]
+  cmp rsi, qword ptr [rbp-14848]
+  jne .L.else.main.28
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14856]
+  mov r9, qword ptr [rbp-14848]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.29
+.L.else.main.28:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14856]
+  mov r9, qword ptr [rbp-14840]
+  mov r10, qword ptr [rbp-14848]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.29:
+  mov qword ptr [rbp-14816], 0
+  mov rsi, 42
+  cmp rsi, 42
+  setne sil
+  movzx rsi, sil
+  mov qword ptr [rbp-14824], rsi
+  lea rsi, [rip+.L.data.main.14]
+  mov qword ptr [rbp-14832], rsi
+  mov rsi, qword ptr [rbp-14816]
+  cmp rsi, qword ptr [rbp-14824]
+  jne .L.else.main.30
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14832]
+  mov r9, qword ptr [rbp-14824]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.31
+.L.else.main.30:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14832]
+  mov r9, qword ptr [rbp-14816]
+  mov r10, qword ptr [rbp-14824]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.31:
+  mov qword ptr [rbp-14792], 1
+  mov rsi, 0
+  cmp rsi, 1
+  setl sil
+  movzx rsi, sil
+  mov qword ptr [rbp-14800], rsi
+  lea rsi, [rip+.L.data.main.15]
+  mov qword ptr [rbp-14808], rsi
+  mov rsi, qword ptr [rbp-14792]
+  cmp rsi, qword ptr [rbp-14800]
+  jne .L.else.main.32
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14808]
+  mov r9, qword ptr [rbp-14800]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.33
+.L.else.main.32:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14808]
+  mov r9, qword ptr [rbp-14792]
+  mov r10, qword ptr [rbp-14800]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.33:
+  mov qword ptr [rbp-14768], 0
+  mov rsi, 1
+  cmp rsi, 1
+  setl sil
+  movzx rsi, sil
+  mov qword ptr [rbp-14776], rsi
+  lea rsi, [rip+.L.data.main.16]
+  mov qword ptr [rbp-14784], rsi
+  mov rsi, qword ptr [rbp-14768]
+  cmp rsi, qword ptr [rbp-14776]
+  jne .L.else.main.34
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14784]
+  mov r9, qword ptr [rbp-14776]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.35
+.L.else.main.34:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14784]
+  mov r9, qword ptr [rbp-14768]
+  mov r10, qword ptr [rbp-14776]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.35:
+  mov qword ptr [rbp-14744], 0
+  mov rsi, 2
+  cmp rsi, 1
+  setl sil
+  movzx rsi, sil
+  mov qword ptr [rbp-14752], rsi
+  lea rsi, [rip+.L.data.main.17]
+  mov qword ptr [rbp-14760], rsi
+  mov rsi, qword ptr [rbp-14744]
+  cmp rsi, qword ptr [rbp-14752]
+  jne .L.else.main.36
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14760]
+  mov r9, qword ptr [rbp-14752]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.37
+.L.else.main.36:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14760]
+  mov r9, qword ptr [rbp-14744]
+  mov r10, qword ptr [rbp-14752]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.37:
+  mov qword ptr [rbp-14720], 1
+  mov rsi, 0
+  cmp rsi, 1
+  setle sil
+  movzx rsi, sil
+  mov qword ptr [rbp-14728], rsi
+  lea rsi, [rip+.L.data.main.18]
+  mov qword ptr [rbp-14736], rsi
+  mov rsi, qword ptr [rbp-14720]
+  cmp rsi, qword ptr [rbp-14728]
+  jne .L.else.main.38
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14736]
+  mov r9, qword ptr [rbp-14728]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.39
+.L.else.main.38:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14736]
+  mov r9, qword ptr [rbp-14720]
+  mov r10, qword ptr [rbp-14728]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.39:
+  mov qword ptr [rbp-14696], 1
+  mov rsi, 1
+  cmp rsi, 1
+  setle sil
+  movzx rsi, sil
+  mov qword ptr [rbp-14704], rsi
+  lea rsi, [rip+.L.data.main.19]
+  mov qword ptr [rbp-14712], rsi
+  mov rsi, qword ptr [rbp-14696]
+  cmp rsi, qword ptr [rbp-14704]
+  jne .L.else.main.40
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14712]
+  mov r9, qword ptr [rbp-14704]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.41
+.L.else.main.40:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14712]
+  mov r9, qword ptr [rbp-14696]
+  mov r10, qword ptr [rbp-14704]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.41:
+  mov qword ptr [rbp-14672], 0
+  mov rsi, 2
+  cmp rsi, 1
+  setle sil
+  movzx rsi, sil
+  mov qword ptr [rbp-14680], rsi
+  lea rsi, [rip+.L.data.main.20]
+  mov qword ptr [rbp-14688], rsi
+  mov rsi, qword ptr [rbp-14672]
+  cmp rsi, qword ptr [rbp-14680]
+  jne .L.else.main.42
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14688]
+  mov r9, qword ptr [rbp-14680]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.43
+.L.else.main.42:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14688]
+  mov r9, qword ptr [rbp-14672]
+  mov r10, qword ptr [rbp-14680]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.43:
+  mov qword ptr [rbp-14648], 1
+  mov rsi, 0
+  cmp rsi, 1
+  setl sil
+  movzx rsi, sil
+  mov qword ptr [rbp-14656], rsi
+  lea rsi, [rip+.L.data.main.21]
+  mov qword ptr [rbp-14664], rsi
+  mov rsi, qword ptr [rbp-14648]
+  cmp rsi, qword ptr [rbp-14656]
+  jne .L.else.main.44
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14664]
+  mov r9, qword ptr [rbp-14656]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.45
+.L.else.main.44:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14664]
+  mov r9, qword ptr [rbp-14648]
+  mov r10, qword ptr [rbp-14656]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.45:
+  mov qword ptr [rbp-14624], 0
+  mov rsi, 1
+  cmp rsi, 1
+  setl sil
+  movzx rsi, sil
+  mov qword ptr [rbp-14632], rsi
+  lea rsi, [rip+.L.data.main.22]
+  mov qword ptr [rbp-14640], rsi
+  mov rsi, qword ptr [rbp-14624]
+  cmp rsi, qword ptr [rbp-14632]
+  jne .L.else.main.46
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14640]
+  mov r9, qword ptr [rbp-14632]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.47
+.L.else.main.46:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14640]
+  mov r9, qword ptr [rbp-14624]
+  mov r10, qword ptr [rbp-14632]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.47:
+  mov qword ptr [rbp-14600], 0
+  mov rsi, 2
+  cmp rsi, 1
+  setl sil
+  movzx rsi, sil
+  mov qword ptr [rbp-14608], rsi
+  lea rsi, [rip+.L.data.main.23]
+  mov qword ptr [rbp-14616], rsi
+  mov rsi, qword ptr [rbp-14600]
+  cmp rsi, qword ptr [rbp-14608]
+  jne .L.else.main.48
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14616]
+  mov r9, qword ptr [rbp-14608]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.49
+.L.else.main.48:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14616]
+  mov r9, qword ptr [rbp-14600]
+  mov r10, qword ptr [rbp-14608]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.49:
+  mov qword ptr [rbp-14576], 1
+  mov rsi, 0
+  cmp rsi, 1
+  setle sil
+  movzx rsi, sil
+  mov qword ptr [rbp-14584], rsi
+  lea rsi, [rip+.L.data.main.24]
+  mov qword ptr [rbp-14592], rsi
+  mov rsi, qword ptr [rbp-14576]
+  cmp rsi, qword ptr [rbp-14584]
+  jne .L.else.main.50
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14592]
+  mov r9, qword ptr [rbp-14584]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.51
+.L.else.main.50:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14592]
+  mov r9, qword ptr [rbp-14576]
+  mov r10, qword ptr [rbp-14584]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.51:
+  mov qword ptr [rbp-14552], 1
+  mov rsi, 1
+  cmp rsi, 1
+  setle sil
+  movzx rsi, sil
+  mov qword ptr [rbp-14560], rsi
+  lea rsi, [rip+.L.data.main.25]
+  mov qword ptr [rbp-14568], rsi
+  mov rsi, qword ptr [rbp-14552]
+  cmp rsi, qword ptr [rbp-14560]
+  jne .L.else.main.52
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14568]
+  mov r9, qword ptr [rbp-14560]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.53
+.L.else.main.52:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14568]
+  mov r9, qword ptr [rbp-14552]
+  mov r10, qword ptr [rbp-14560]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.53:
+  mov qword ptr [rbp-14528], 0
+  mov rsi, 2
+  cmp rsi, 1
+  setle sil
+  movzx rsi, sil
+  mov qword ptr [rbp-14536], rsi
+  lea rsi, [rip+.L.data.main.26]
+  mov qword ptr [rbp-14544], rsi
+  mov rsi, qword ptr [rbp-14528]
+  cmp rsi, qword ptr [rbp-14536]
+  jne .L.else.main.54
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14544]
+  mov r9, qword ptr [rbp-14536]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.55
+.L.else.main.54:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14544]
+  mov r9, qword ptr [rbp-14528]
+  mov r10, qword ptr [rbp-14536]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.55:
+  mov qword ptr [rbp-14504], 3
+  mov dword ptr [rbp-19172], 3
+  movsxd rsi, dword ptr [rbp-19172]
+  mov qword ptr [rbp-14512], rsi
+  lea rsi, [rip+.L.data.main.27]
+  mov qword ptr [rbp-14520], rsi
+  mov rsi, qword ptr [rbp-14504]
+  cmp rsi, qword ptr [rbp-14512]
+  jne .L.else.main.56
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14520]
+  mov r9, qword ptr [rbp-14512]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.57
+.L.else.main.56:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14520]
+  mov r9, qword ptr [rbp-14504]
+  mov r10, qword ptr [rbp-14512]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.57:
+  mov qword ptr [rbp-14480], 8
+  mov dword ptr [rbp-19168], 3
+  mov dword ptr [rbp-19164], 5
+  movsxd rsi, dword ptr [rbp-19168]
+  movsxd rdi, dword ptr [rbp-19164]
+  add rsi, rdi
+  mov qword ptr [rbp-14488], rsi
+  lea rsi, [rip+.L.data.main.28]
+  mov qword ptr [rbp-14496], rsi
+  mov rsi, qword ptr [rbp-14480]
+  cmp rsi, qword ptr [rbp-14488]
+  jne .L.else.main.58
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14496]
+  mov r9, qword ptr [rbp-14488]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.59
+.L.else.main.58:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14496]
+  mov r9, qword ptr [rbp-14480]
+  mov r10, qword ptr [rbp-14488]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.59:
+  mov qword ptr [rbp-14456], 3
+  mov dword ptr [rbp-19160], 3
+  movsxd rsi, dword ptr [rbp-19160]
+  mov qword ptr [rbp-14464], rsi
+  lea rsi, [rip+.L.data.main.29]
+  mov qword ptr [rbp-14472], rsi
+  mov rsi, qword ptr [rbp-14456]
+  cmp rsi, qword ptr [rbp-14464]
+  jne .L.else.main.60
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14472]
+  mov r9, qword ptr [rbp-14464]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.61
+.L.else.main.60:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14472]
+  mov r9, qword ptr [rbp-14456]
+  mov r10, qword ptr [rbp-14464]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.61:
+  mov qword ptr [rbp-14432], 8
+  mov dword ptr [rbp-19156], 3
+  mov dword ptr [rbp-19152], 5
+  movsxd rsi, dword ptr [rbp-19156]
+  movsxd rdi, dword ptr [rbp-19152]
+  add rsi, rdi
+  mov qword ptr [rbp-14440], rsi
+  lea rsi, [rip+.L.data.main.30]
+  mov qword ptr [rbp-14448], rsi
+  mov rsi, qword ptr [rbp-14432]
+  cmp rsi, qword ptr [rbp-14440]
+  jne .L.else.main.62
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14448]
+  mov r9, qword ptr [rbp-14440]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.63
+.L.else.main.62:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14448]
+  mov r9, qword ptr [rbp-14432]
+  mov r10, qword ptr [rbp-14440]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.63:
+  mov qword ptr [rbp-14408], 3
+  mov dword ptr [rbp-19148], 3
+  movsxd rsi, dword ptr [rbp-19148]
+  mov qword ptr [rbp-14416], rsi
+  lea rsi, [rip+.L.data.main.31]
+  mov qword ptr [rbp-14424], rsi
+  mov rsi, qword ptr [rbp-14408]
+  cmp rsi, qword ptr [rbp-14416]
+  jne .L.else.main.64
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14424]
+  mov r9, qword ptr [rbp-14416]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.65
+.L.else.main.64:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14424]
+  mov r9, qword ptr [rbp-14408]
+  mov r10, qword ptr [rbp-14416]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.65:
+  mov qword ptr [rbp-14384], 8
+  mov dword ptr [rbp-19144], 3
+  mov dword ptr [rbp-19140], 5
+  movsxd rsi, dword ptr [rbp-19144]
+  movsxd rdi, dword ptr [rbp-19140]
+  add rsi, rdi
+  mov qword ptr [rbp-14392], rsi
+  lea rsi, [rip+.L.data.main.32]
+  mov qword ptr [rbp-14400], rsi
+  mov rsi, qword ptr [rbp-14384]
+  cmp rsi, qword ptr [rbp-14392]
+  jne .L.else.main.66
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14400]
+  mov r9, qword ptr [rbp-14392]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.67
+.L.else.main.66:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14400]
+  mov r9, qword ptr [rbp-14384]
+  mov r10, qword ptr [rbp-14392]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.67:
+  mov qword ptr [rbp-14352], 3
+  mov dword ptr [rbp-14372], 3
+  movsxd rsi, dword ptr [rbp-14372]
+  mov qword ptr [rbp-14360], rsi
+  lea rsi, [rip+.L.data.main.33]
+  mov qword ptr [rbp-14368], rsi
+  mov rsi, qword ptr [rbp-14352]
+  cmp rsi, qword ptr [rbp-14360]
+  jne .L.else.main.69
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14368]
+  mov r9, qword ptr [rbp-14360]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.70
+.L.else.main.69:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14368]
+  mov r9, qword ptr [rbp-14352]
+  mov r10, qword ptr [rbp-14360]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.70:
+  mov qword ptr [rbp-14328], 3
+  mov dword ptr [rbp-19136], 0
+  mov dword ptr [rbp-19136], 3
+  movsxd rsi, dword ptr [rbp-19136]
+  mov qword ptr [rbp-14336], rsi
+  lea rsi, [rip+.L.data.main.34]
+  mov qword ptr [rbp-14344], rsi
+  mov rsi, qword ptr [rbp-14328]
+  cmp rsi, qword ptr [rbp-14336]
+  jne .L.else.main.73
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14344]
+  mov r9, qword ptr [rbp-14336]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.74
+.L.else.main.73:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14344]
+  mov r9, qword ptr [rbp-14328]
+  mov r10, qword ptr [rbp-14336]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.74:
+  mov qword ptr [rbp-14304], 3
+  mov dword ptr [rbp-19132], 0
+  mov rsi, 1
+  sub rsi, 1
+  cmp rsi, 0
+  je .L.else.main.75
+  mov dword ptr [rbp-19132], 2
+  jmp .L.end.main.76
+.L.else.main.75:
+  mov dword ptr [rbp-19132], 3
+.L.end.main.76:
+  movsxd rsi, dword ptr [rbp-19132]
+  mov qword ptr [rbp-14312], rsi
+  lea rsi, [rip+.L.data.main.35]
+  mov qword ptr [rbp-14320], rsi
+  mov rsi, qword ptr [rbp-14304]
+  cmp rsi, qword ptr [rbp-14312]
+  jne .L.else.main.77
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14320]
+  mov r9, qword ptr [rbp-14312]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.78
+.L.else.main.77:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14320]
+  mov r9, qword ptr [rbp-14304]
+  mov r10, qword ptr [rbp-14312]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.78:
+  mov qword ptr [rbp-14280], 2
+  mov dword ptr [rbp-19128], 0
+  mov dword ptr [rbp-19128], 2
+  movsxd rsi, dword ptr [rbp-19128]
+  mov qword ptr [rbp-14288], rsi
+  lea rsi, [rip+.L.data.main.36]
+  mov qword ptr [rbp-14296], rsi
+  mov rsi, qword ptr [rbp-14280]
+  cmp rsi, qword ptr [rbp-14288]
+  jne .L.else.main.81
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14296]
+  mov r9, qword ptr [rbp-14288]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.82
+.L.else.main.81:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14296]
+  mov r9, qword ptr [rbp-14280]
+  mov r10, qword ptr [rbp-14288]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.82:
+  mov qword ptr [rbp-14256], 2
+  mov dword ptr [rbp-19124], 0
+  mov rsi, 2
+  sub rsi, 1
+  cmp rsi, 0
+  je .L.else.main.83
+  mov dword ptr [rbp-19124], 2
+  jmp .L.end.main.84
+.L.else.main.83:
+  mov dword ptr [rbp-19124], 3
+.L.end.main.84:
+  movsxd rsi, dword ptr [rbp-19124]
+  mov qword ptr [rbp-14264], rsi
+  lea rsi, [rip+.L.data.main.37]
+  mov qword ptr [rbp-14272], rsi
+  mov rsi, qword ptr [rbp-14256]
+  cmp rsi, qword ptr [rbp-14264]
+  jne .L.else.main.85
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14272]
+  mov r9, qword ptr [rbp-14264]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.86
+.L.else.main.85:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14272]
+  mov r9, qword ptr [rbp-14256]
+  mov r10, qword ptr [rbp-14264]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.86:
+  mov qword ptr [rbp-14232], 3
+  mov qword ptr [rbp-14240], 3
+  lea rsi, [rip+.L.data.main.38]
+  mov qword ptr [rbp-14248], rsi
+  mov rsi, qword ptr [rbp-14232]
+  cmp rsi, qword ptr [rbp-14240]
+  jne .L.else.main.87
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14248]
+  mov r9, qword ptr [rbp-14240]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.88
+.L.else.main.87:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14248]
+  mov r9, qword ptr [rbp-14232]
+  mov r10, qword ptr [rbp-14240]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.88:
+  mov qword ptr [rbp-14208], 10
+  mov dword ptr [rbp-19120], 0
+  mov dword ptr [rbp-19120], 0
+  movsxd rsi, dword ptr [rbp-19120]
+  cmp rsi, 10
+  jge .L.break.main.90
+  .p2align 4,,10
+.L.begin.main.91:
+  add dword ptr [rbp-19120], 1
+  movsxd rsi, dword ptr [rbp-19120]
+  cmp rsi, 10
+  jl .L.begin.main.91
+.L.break.main.90:
+  movsxd rsi, dword ptr [rbp-19120]
+  mov qword ptr [rbp-14216], rsi
+  lea rsi, [rip+.L.data.main.39]
+  mov qword ptr [rbp-14224], rsi
+  mov rsi, qword ptr [rbp-14208]
+  cmp rsi, qword ptr [rbp-14216]
+  jne .L.else.main.92
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14224]
+  mov r9, qword ptr [rbp-14216]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.93
+.L.else.main.92:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14224]
+  mov r9, qword ptr [rbp-14208]
+  mov r10, qword ptr [rbp-14216]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.93:
+  mov qword ptr [rbp-14184], 55
+  mov dword ptr [rbp-19116], 0
+  mov dword ptr [rbp-19112], 0
+  movsxd rsi, dword ptr [rbp-19116]
+  cmp rsi, 10
+  jg .L.break.main.95
+  .p2align 4,,10
+.L.begin.main.96:
+  movsxd rsi, dword ptr [rbp-19116]
+  movsxd rdi, dword ptr [rbp-19112]
+  add rsi, rdi
+  mov dword ptr [rbp-19112], esi
+  add dword ptr [rbp-19116], 1
+  movsxd rsi, dword ptr [rbp-19116]
+  cmp rsi, 10
+  jle .L.begin.main.96
+.L.break.main.95:
+  movsxd rsi, dword ptr [rbp-19112]
+  mov qword ptr [rbp-14192], rsi
+  lea rsi, [rip+.L.data.main.40]
+  mov qword ptr [rbp-14200], rsi
+  mov rsi, qword ptr [rbp-14184]
+  cmp rsi, qword ptr [rbp-14192]
+  jne .L.else.main.97
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14200]
+  mov r9, qword ptr [rbp-14192]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.98
+.L.else.main.97:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14200]
+  mov r9, qword ptr [rbp-14184]
+  mov r10, qword ptr [rbp-14192]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.98:
+  mov qword ptr [rbp-14160], 55
+  mov dword ptr [rbp-19108], 0
+  mov dword ptr [rbp-19104], 0
+  mov dword ptr [rbp-19108], 0
+  movsxd rsi, dword ptr [rbp-19108]
+  cmp rsi, 10
+  jg .L.break.main.100
+  .p2align 4,,10
+.L.begin.main.101:
+  movsxd rsi, dword ptr [rbp-19108]
+  movsxd rdi, dword ptr [rbp-19104]
+  add rsi, rdi
+  mov dword ptr [rbp-19104], esi
+  add dword ptr [rbp-19108], 1
+  movsxd rsi, dword ptr [rbp-19108]
+  cmp rsi, 10
+  jle .L.begin.main.101
+.L.break.main.100:
+  movsxd rsi, dword ptr [rbp-19104]
+  mov qword ptr [rbp-14168], rsi
+  lea rsi, [rip+.L.data.main.41]
+  mov qword ptr [rbp-14176], rsi
+  mov rsi, qword ptr [rbp-14160]
+  cmp rsi, qword ptr [rbp-14168]
+  jne .L.else.main.102
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14176]
+  mov r9, qword ptr [rbp-14168]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.103
+.L.else.main.102:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14176]
+  mov r9, qword ptr [rbp-14160]
+  mov r10, qword ptr [rbp-14168]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.103:
+  mov qword ptr [rbp-14128], 8
+  mov dword ptr [rbp-14148], 3
+  mov dword ptr [rbp-14152], 5
+  movsxd rsi, dword ptr [rbp-14148]
+  movsxd rdi, dword ptr [rbp-14152]
+  add rsi, rdi
+  movsxd rsi, esi
+  mov qword ptr [rbp-14136], rsi
+  lea rsi, [rip+.L.data.main.42]
+  mov qword ptr [rbp-14144], rsi
+  mov rsi, qword ptr [rbp-14128]
+  cmp rsi, qword ptr [rbp-14136]
+  jne .L.else.main.104
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14144]
+  mov r9, qword ptr [rbp-14136]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.105
+.L.else.main.104:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14144]
+  mov r9, qword ptr [rbp-14128]
+  mov r10, qword ptr [rbp-14136]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.105:
+  mov qword ptr [rbp-14096], 2
+  mov dword ptr [rbp-14116], 5
+  mov dword ptr [rbp-14120], 3
+  movsxd rsi, dword ptr [rbp-14116]
+  movsxd rdi, dword ptr [rbp-14120]
+  sub rsi, rdi
+  movsxd rsi, esi
+  mov qword ptr [rbp-14104], rsi
+  lea rsi, [rip+.L.data.main.43]
+  mov qword ptr [rbp-14112], rsi
+  mov rsi, qword ptr [rbp-14096]
+  cmp rsi, qword ptr [rbp-14104]
+  jne .L.else.main.106
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14112]
+  mov r9, qword ptr [rbp-14104]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.107
+.L.else.main.106:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14112]
+  mov r9, qword ptr [rbp-14096]
+  mov r10, qword ptr [rbp-14104]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.107:
+  mov qword ptr [rbp-14048], 21
+  mov dword ptr [rbp-14068], 1
+  mov dword ptr [rbp-14072], 2
+  mov dword ptr [rbp-14076], 3
+  mov dword ptr [rbp-14080], 4
+  mov dword ptr [rbp-14084], 5
+  mov dword ptr [rbp-14088], 6
+  movsxd rsi, dword ptr [rbp-14068]
+  movsxd rdi, dword ptr [rbp-14072]
+  add rsi, rdi
+  movsxd rdi, dword ptr [rbp-14076]
+  add rsi, rdi
+  movsxd rdi, dword ptr [rbp-14080]
+  add rsi, rdi
+  movsxd rdi, dword ptr [rbp-14084]
+  add rsi, rdi
+  movsxd rdi, dword ptr [rbp-14088]
+  add rsi, rdi
+  movsxd rsi, esi
+  mov qword ptr [rbp-14056], rsi
+  lea rsi, [rip+.L.data.main.44]
+  mov qword ptr [rbp-14064], rsi
+  mov rsi, qword ptr [rbp-14048]
+  cmp rsi, qword ptr [rbp-14056]
+  jne .L.else.main.108
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14064]
+  mov r9, qword ptr [rbp-14056]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.109
+.L.else.main.108:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14064]
+  mov r9, qword ptr [rbp-14048]
+  mov r10, qword ptr [rbp-14056]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.109:
+  mov qword ptr [rbp-14024], 136
+  mov qword ptr [rbp-19192], 1
+  mov qword ptr [rbp-19200], 2
+  mov qword ptr [rbp-19208], 3
+  mov qword ptr [rbp-19216], 4
+  mov qword ptr [rbp-19224], 5
+  mov qword ptr [rbp-19232], 6
+  mov qword ptr [rbp-19240], 7
+  mov qword ptr [rbp-19248], 8
+  mov rdi, 9
+  mov r8, 10
+  mov r9, 11
+  mov r10, 12
+  mov r11, 13
+  mov rcx, 14
+  mov rsi, 15
+  add rsi, 16
+  add rcx, rsi
+  add r11, rcx
+  add r10, r11
+  add r9, r10
+  add r8, r9
+  add rdi, r8
+  add qword ptr [rbp-19248], rdi
+  mov rax, qword ptr [rbp-19248]
+  add qword ptr [rbp-19240], rax
+  mov rax, qword ptr [rbp-19240]
+  add qword ptr [rbp-19232], rax
+  mov rax, qword ptr [rbp-19232]
+  add qword ptr [rbp-19224], rax
+  mov rax, qword ptr [rbp-19224]
+  add qword ptr [rbp-19216], rax
+  mov rax, qword ptr [rbp-19216]
+  add qword ptr [rbp-19208], rax
+  mov rax, qword ptr [rbp-19208]
+  add qword ptr [rbp-19200], rax
+  mov rax, qword ptr [rbp-19200]
+  add qword ptr [rbp-19192], rax
+  mov rax, qword ptr [rbp-19192]
+  mov qword ptr [rbp-14032], rax
+  lea rsi, [rip+.L.data.main.45]
+  mov qword ptr [rbp-14040], rsi
+  mov rsi, qword ptr [rbp-14024]
+  cmp rsi, qword ptr [rbp-14032]
+  jne .L.else.main.110
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-14040]
+  mov r9, qword ptr [rbp-14032]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.111
+.L.else.main.110:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-14040]
+  mov r9, qword ptr [rbp-14024]
+  mov r10, qword ptr [rbp-14032]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.111:
+  mov qword ptr [rbp-13952], 291054
+  mov dword ptr [rbp-14004], 1
+  mov dword ptr [rbp-14012], 2
+  mov dword ptr [rbp-14016], 3
+  movsxd rsi, dword ptr [rbp-14012]
+  movsxd rdi, dword ptr [rbp-14016]
+  add rsi, rdi
+  movsxd rsi, esi
+  mov dword ptr [rbp-14008], esi
+  movsxd rax, dword ptr [rbp-14004]
+  mov qword ptr [rbp-19256], rax
+  movsxd rdi, dword ptr [rbp-14008]
+  add qword ptr [rbp-19256], rdi
+  movsxd rax, dword ptr [rbp-19256]
+  mov qword ptr [rbp-19256], rax
+  mov qword ptr [rbp-19264], 4
+  mov qword ptr [rbp-19272], 5
+  mov qword ptr [rbp-19280], 6
+  mov qword ptr [rbp-19288], 7
+  mov qword ptr [rbp-19296], 8
+  mov rcx, 9
+  mov rsi, 10
+  mov rdi, 11
+  mov r8, 12
+  mov dword ptr [rbp-13980], 1
+  mov dword ptr [rbp-13984], 2
+  mov dword ptr [rbp-13988], 3
+  mov dword ptr [rbp-13992], 4
+  mov dword ptr [rbp-13996], 5
+  mov dword ptr [rbp-14000], 6
+  movsxd r9, dword ptr [rbp-13980]
+  movsxd r10, dword ptr [rbp-13984]
+  add r9, r10
+  movsxd r10, dword ptr [rbp-13988]
+  add r9, r10
+  movsxd r10, dword ptr [rbp-13992]
+  add r9, r10
+  movsxd r10, dword ptr [rbp-13996]
+  add r9, r10
+  movsxd r10, dword ptr [rbp-14000]
+  add r9, r10
+  movsxd r9, r9d
+  mov dword ptr [rbp-13972], 14
+  mov dword ptr [rbp-13976], 15
+  movsxd r10, dword ptr [rbp-13972]
+  movsxd r11, dword ptr [rbp-13976]
+  add r10, r11
+  movsxd r10, r10d
+  sub r10, 13
+  mov rax, r9
+  cqo
+  idiv r10
+  add r8, rax
+  imul rdi, r8
+  add rsi, rdi
+  imul rcx, rsi
+  add qword ptr [rbp-19296], rcx
+  mov rax, qword ptr [rbp-19288]
+  imul rax, qword ptr [rbp-19296]
+  mov qword ptr [rbp-19288], rax
+  mov rax, qword ptr [rbp-19288]
+  add qword ptr [rbp-19280], rax
+  mov rax, qword ptr [rbp-19272]
+  imul rax, qword ptr [rbp-19280]
+  mov qword ptr [rbp-19272], rax
+  mov rax, qword ptr [rbp-19272]
+  add qword ptr [rbp-19264], rax
+  mov rax, qword ptr [rbp-19256]
+  imul rax, qword ptr [rbp-19264]
+  mov qword ptr [rbp-19256], rax
+  mov rax, qword ptr [rbp-19256]
+  mov qword ptr [rbp-13960], rax
+  lea rsi, [rip+.L.data.main.46]
+  mov qword ptr [rbp-13968], rsi
+  mov rsi, qword ptr [rbp-13952]
+  cmp rsi, qword ptr [rbp-13960]
+  jne .L.else.main.112
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-13968]
+  mov r9, qword ptr [rbp-13960]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.113
+.L.else.main.112:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-13968]
+  mov r9, qword ptr [rbp-13952]
+  mov r10, qword ptr [rbp-13960]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.113:
+  mov qword ptr [rbp-13928], 55
+  mov rdi, 9
+  mov rax, 0
+  call fib
+  mov qword ptr [rbp-13936], rax
+  lea rsi, [rip+.L.data.main.47]
+  mov qword ptr [rbp-13944], rsi
+  mov rsi, qword ptr [rbp-13928]
+  cmp rsi, qword ptr [rbp-13936]
+  jne .L.else.main.114
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-13944]
+  mov r9, qword ptr [rbp-13936]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.115
+.L.else.main.114:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-13944]
+  mov r9, qword ptr [rbp-13928]
+  mov r10, qword ptr [rbp-13936]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.115:
+  mov qword ptr [rbp-13888], 143
+  mov dword ptr [rbp-13908], 10
+  mov dword ptr [rbp-13912], 0
+  mov dword ptr [rbp-13916], 0
+  movsxd rsi, dword ptr [rbp-13916]
+  movsxd rdi, dword ptr [rbp-13908]
+  cmp rsi, rdi
+  jge .L.break.main.117
+  .p2align 4,,10
+.L.begin.main.118:
+  movsxd rax, dword ptr [rbp-13912]
+  mov qword ptr [rbp-19304], rax
+  movsxd rsi, dword ptr [rbp-13916]
+  mov rdi, rsi
+  mov rax, 0
+  call fib
+  add qword ptr [rbp-19304], rax
+  mov eax, dword ptr [rbp-19304]
+  mov dword ptr [rbp-13912], eax
+  add dword ptr [rbp-13916], 1
+  movsxd rsi, dword ptr [rbp-13916]
+  movsxd rdi, dword ptr [rbp-13908]
+  cmp rsi, rdi
+  jl .L.begin.main.118
+.L.break.main.117:
+  movsxd rsi, dword ptr [rbp-13912]
+  movsxd rsi, esi
+  mov qword ptr [rbp-13896], rsi
+  lea rsi, [rip+.L.data.main.48]
+  mov qword ptr [rbp-13904], rsi
+  mov rsi, qword ptr [rbp-13888]
+  cmp rsi, qword ptr [rbp-13896]
+  jne .L.else.main.119
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-13904]
+  mov r9, qword ptr [rbp-13896]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.120
+.L.else.main.119:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-13904]
+  mov r9, qword ptr [rbp-13888]
+  mov r10, qword ptr [rbp-13896]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.120:
+  mov qword ptr [rbp-13864], 456123
+  mov rsi, 1
+  mov r8, 2
+  mov r9, 3
+  mov r10, 4
+  mov r11, 5
+  mov qword ptr [rbp-19312], 6
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov r8, r11
+  mov r9, qword ptr [rbp-19312]
+  mov rax, 0
+  call rotate6
+  mov qword ptr [rbp-13872], rax
+  lea rsi, [rip+.L.data.main.49]
+  mov qword ptr [rbp-13880], rsi
+  mov rsi, qword ptr [rbp-13864]
+  cmp rsi, qword ptr [rbp-13872]
+  jne .L.else.main.121
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-13880]
+  mov r9, qword ptr [rbp-13872]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.122
+.L.else.main.121:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-13880]
+  mov r9, qword ptr [rbp-13864]
+  mov r10, qword ptr [rbp-13872]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.122:
+  mov qword ptr [rbp-13824], 3
+  mov dword ptr [rbp-13844], 2
+  mov dword ptr [rbp-13848], 5
+  movsxd rsi, dword ptr [rbp-13848]
+  mov dword ptr [rbp-13856], esi
+  movsxd rsi, dword ptr [rbp-13844]
+  mov dword ptr [rbp-13852], esi
+  movsxd rsi, dword ptr [rbp-13856]
+  movsxd rdi, dword ptr [rbp-13852]
+  sub rsi, rdi
+  movsxd rsi, esi
+  movsxd rsi, esi
+  mov qword ptr [rbp-13832], rsi
+  lea rsi, [rip+.L.data.main.50]
+  mov qword ptr [rbp-13840], rsi
+  mov rsi, qword ptr [rbp-13824]
+  cmp rsi, qword ptr [rbp-13832]
+  jne .L.else.main.123
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-13840]
+  mov r9, qword ptr [rbp-13832]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.124
+.L.else.main.123:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-13840]
+  mov r9, qword ptr [rbp-13824]
+  mov r10, qword ptr [rbp-13832]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.124:
+  mov rsi, 0
+  sub rsi, 128
+  mov qword ptr [rbp-13792], rsi
+  mov byte ptr [rbp-13809], 127
+  add byte ptr [rbp-13809], 1
+  movsx rsi, byte ptr [rbp-13809]
+  movsx rsi, sil
+  mov qword ptr [rbp-13800], rsi
+  lea rsi, [rip+.L.data.main.51]
+  mov qword ptr [rbp-13808], rsi
+  mov rsi, qword ptr [rbp-13792]
+  cmp rsi, qword ptr [rbp-13800]
+  jne .L.else.main.125
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-13808]
+  mov r9, qword ptr [rbp-13800]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.126
+.L.else.main.125:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-13808]
+  mov r9, qword ptr [rbp-13792]
+  mov r10, qword ptr [rbp-13800]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.126:
+  mov qword ptr [rbp-13768], 240
+  mov rdi, 2
+  mov rax, 0
+  call sum_small_array
+  mov qword ptr [rbp-13776], rax
+  lea rsi, [rip+.L.data.main.52]
+  mov qword ptr [rbp-13784], rsi
+  mov rsi, qword ptr [rbp-13768]
+  cmp rsi, qword ptr [rbp-13776]
+  jne .L.else.main.127
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-13784]
+  mov r9, qword ptr [rbp-13776]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.128
+.L.else.main.127:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-13784]
+  mov r9, qword ptr [rbp-13768]
+  mov r10, qword ptr [rbp-13776]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.128:
+  mov qword ptr [rbp-13744], 6048
+  mov rdi, 3
+  mov rax, 0
+  call sum_large_array
+  mov qword ptr [rbp-13752], rax
+  lea rsi, [rip+.L.data.main.53]
+  mov qword ptr [rbp-13760], rsi
+  mov rsi, qword ptr [rbp-13744]
+  cmp rsi, qword ptr [rbp-13752]
+  jne .L.else.main.129
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-13760]
+  mov r9, qword ptr [rbp-13752]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.130
+.L.else.main.129:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-13760]
+  mov r9, qword ptr [rbp-13744]
+  mov r10, qword ptr [rbp-13752]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.130:
+  mov qword ptr [rbp-13720], 6288
+  mov rdi, 2
+  mov rax, 0
+  call sum_small_array
+  mov qword ptr [rbp-19320], rax
+  mov rdi, 3
+  mov rax, 0
+  call sum_large_array
+  add qword ptr [rbp-19320], rax
+  mov rax, qword ptr [rbp-19320]
+  mov qword ptr [rbp-13728], rax
+  lea rsi, [rip+.L.data.main.54]
+  mov qword ptr [rbp-13736], rsi
+  mov rsi, qword ptr [rbp-13720]
+  cmp rsi, qword ptr [rbp-13728]
+  jne .L.else.main.131
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-13736]
+  mov r9, qword ptr [rbp-13728]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.132
+.L.else.main.131:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-13736]
+  mov r9, qword ptr [rbp-13720]
+  mov r10, qword ptr [rbp-13728]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.132:
+  mov qword ptr [rbp-13632], 7053
+  mov qword ptr [rbp-13656], 100
+  mov qword ptr [rbp-13664], 14
+  mov qword ptr [rbp-13672], 3
+  mov qword ptr [rbp-13680], 2
+  mov qword ptr [rbp-13688], 50
+  mov qword ptr [rbp-13696], 10
+  mov rsi, qword ptr [rbp-13656]
+  mov rdi, qword ptr [rbp-13664]
+  mov rax, rsi
+  cqo
+  idiv rdi
+  mov qword ptr [rbp-13704], rax
+  mov rsi, qword ptr [rbp-13672]
+  mov rcx, qword ptr [rbp-13680]
+  shl rsi, cl
+  mov qword ptr [rbp-13712], rsi
+  mov rsi, qword ptr [rbp-13704]
+  imul rsi, 1000
+  add rsi, qword ptr [rbp-13712]
+  add rsi, qword ptr [rbp-13688]
+  sub rsi, qword ptr [rbp-13696]
+  mov rdi, qword ptr [rbp-13672]
+  mov r8, qword ptr [rbp-13680]
+  mov rax, rdi
+  cqo
+  idiv r8
+  add rsi, rax
+  mov qword ptr [rbp-13640], rsi
+  lea rsi, [rip+.L.data.main.55]
+  mov qword ptr [rbp-13648], rsi
+  mov rsi, qword ptr [rbp-13632]
+  cmp rsi, qword ptr [rbp-13640]
+  jne .L.else.main.133
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-13648]
+  mov r9, qword ptr [rbp-13640]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.134
+.L.else.main.133:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-13648]
+  mov r9, qword ptr [rbp-13632]
+  mov r10, qword ptr [rbp-13640]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.134:
+  mov qword ptr [rbp-13568], 26
+  mov qword ptr [rbp-13592], 1
+  mov qword ptr [rbp-13600], 2
+  mov qword ptr [rbp-13608], 3
+  mov qword ptr [rbp-13616], 4
+  mov qword ptr [rbp-13624], 5
+  mov rax, qword ptr [rbp-13592]
+  mov qword ptr [rbp-19328], rax
+  mov rax, qword ptr [rbp-13600]
+  add qword ptr [rbp-19328], rax
+  mov rax, qword ptr [rbp-13608]
+  add qword ptr [rbp-19328], rax
+  mov rax, qword ptr [rbp-13616]
+  add qword ptr [rbp-19328], rax
+  mov rax, qword ptr [rbp-13624]
+  add qword ptr [rbp-19328], rax
+  mov rax, qword ptr [rbp-13592]
+  mov qword ptr [rbp-19336], rax
+  mov rax, qword ptr [rbp-19336]
+  shl rax, 1
+  add rax, qword ptr [rbp-19336]
+  lea rdx, [rax]
+  mov qword ptr [rbp-19336], rdx
+  mov rax, 0
+  call one
+  mov rdx, qword ptr [rbp-19336]
+  lea rdx, [rdx+rax*8]
+  mov qword ptr [rbp-19336], rdx
+  mov rax, qword ptr [rbp-19336]
+  add qword ptr [rbp-19328], rax
+  mov rax, qword ptr [rbp-19328]
+  mov qword ptr [rbp-13576], rax
+  lea rsi, [rip+.L.data.main.56]
+  mov qword ptr [rbp-13584], rsi
+  mov rsi, qword ptr [rbp-13568]
+  cmp rsi, qword ptr [rbp-13576]
+  jne .L.else.main.135
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-13584]
+  mov r9, qword ptr [rbp-13576]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.136
+.L.else.main.135:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-13584]
+  mov r9, qword ptr [rbp-13568]
+  mov r10, qword ptr [rbp-13576]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.136:
+  mov qword ptr [rbp-13520], 1
+  mov qword ptr [rbp-13544], 0
+  mov rsi, qword ptr [rbp-13544]
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rbp-13545], sil
+  movsx rsi, byte ptr [rbp-13545]
+  add rsi, 5
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rbp-13545], sil
+  mov qword ptr [rbp-13560], rsi
+  mov rsi, qword ptr [rbp-13560]
+  mov qword ptr [rbp-13528], rsi
+  lea rsi, [rip+.L.data.main.57]
+  mov qword ptr [rbp-13536], rsi
+  mov rsi, qword ptr [rbp-13520]
+  cmp rsi, qword ptr [rbp-13528]
+  jne .L.else.main.137
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-13536]
+  mov r9, qword ptr [rbp-13528]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.138
+.L.else.main.137:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-13536]
+  mov r9, qword ptr [rbp-13520]
+  mov r10, qword ptr [rbp-13528]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.138:
+  mov qword ptr [rbp-13496], 411
+  lea rdi, [rip+.L.data.main.58]
+  mov rax, 0
+  call bool_inc_loop
+  mov qword ptr [rbp-13504], rax
+  lea rsi, [rip+.L.data.main.59]
+  mov qword ptr [rbp-13512], rsi
+  mov rsi, qword ptr [rbp-13496]
+  cmp rsi, qword ptr [rbp-13504]
+  jne .L.else.main.139
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-13512]
+  mov r9, qword ptr [rbp-13504]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.140
+.L.else.main.139:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-13512]
+  mov r9, qword ptr [rbp-13496]
+  mov r10, qword ptr [rbp-13504]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.140:
+  mov qword ptr [rbp-13456], 1
+  movabs rsi, 3000000000
+  mov qword ptr [rbp-13488], rsi
+  mov rsi, qword ptr [rbp-13488]
+  movabs rdi, -3000000000
+  cmp rsi, rdi
+  je .L.case.main.143
+  cmp rsi, 5
+  je .L.case.main.142
+  movabs rdi, 3000000000
+  cmp rsi, rdi
+  jne .L.break.main.141
+  mov dword ptr [rbp-13476], 1
+  jmp .L.label.main.74
+.L.case.main.143:
+  mov dword ptr [rbp-13476], 2
+  jmp .L.label.main.74
+.L.case.main.142:
+  mov dword ptr [rbp-13476], 3
+  jmp .L.label.main.74
+.L.break.main.141:
+  mov dword ptr [rbp-13476], 0
+.L.label.main.74:
+  movsxd rsi, dword ptr [rbp-13476]
+  mov qword ptr [rbp-13464], rsi
+  lea rsi, [rip+.L.data.main.60]
+  mov qword ptr [rbp-13472], rsi
+  mov rsi, qword ptr [rbp-13456]
+  cmp rsi, qword ptr [rbp-13464]
+  jne .L.else.main.146
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-13472]
+  mov r9, qword ptr [rbp-13464]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.147
+.L.else.main.146:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-13472]
+  mov r9, qword ptr [rbp-13456]
+  mov r10, qword ptr [rbp-13464]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.147:
+  mov qword ptr [rbp-13416], 2
+  mov rsi, 0
+  movabs rdi, 3000000000
+  sub rsi, rdi
+  mov qword ptr [rbp-13448], rsi
+  mov rsi, qword ptr [rbp-13448]
+  movabs rdi, -3000000000
+  cmp rsi, rdi
+  je .L.case.main.150
+  cmp rsi, 5
+  je .L.case.main.149
+  movabs rdi, 3000000000
+  cmp rsi, rdi
+  jne .L.break.main.148
+  mov dword ptr [rbp-13436], 1
+  jmp .L.label.main.76
+.L.case.main.150:
+  mov dword ptr [rbp-13436], 2
+  jmp .L.label.main.76
+.L.case.main.149:
+  mov dword ptr [rbp-13436], 3
+  jmp .L.label.main.76
+.L.break.main.148:
+  mov dword ptr [rbp-13436], 0
+.L.label.main.76:
+  movsxd rsi, dword ptr [rbp-13436]
+  mov qword ptr [rbp-13424], rsi
+  lea rsi, [rip+.L.data.main.61]
+  mov qword ptr [rbp-13432], rsi
+  mov rsi, qword ptr [rbp-13416]
+  cmp rsi, qword ptr [rbp-13424]
+  jne .L.else.main.153
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-13432]
+  mov r9, qword ptr [rbp-13424]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.154
+.L.else.main.153:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-13432]
+  mov r9, qword ptr [rbp-13416]
+  mov r10, qword ptr [rbp-13424]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.154:
+  mov qword ptr [rbp-13376], 3
+  mov qword ptr [rbp-13408], 5
+  mov rsi, qword ptr [rbp-13408]
+  movabs rdi, -3000000000
+  cmp rsi, rdi
+  je .L.case.main.157
+  cmp rsi, 5
+  je .L.case.main.156
+  movabs rdi, 3000000000
+  cmp rsi, rdi
+  jne .L.break.main.155
+  mov dword ptr [rbp-13396], 1
+  jmp .L.label.main.78
+.L.case.main.157:
+  mov dword ptr [rbp-13396], 2
+  jmp .L.label.main.78
+.L.case.main.156:
+  mov dword ptr [rbp-13396], 3
+  jmp .L.label.main.78
+.L.break.main.155:
+  mov dword ptr [rbp-13396], 0
+.L.label.main.78:
+  movsxd rsi, dword ptr [rbp-13396]
+  mov qword ptr [rbp-13384], rsi
+  lea rsi, [rip+.L.data.main.62]
+  mov qword ptr [rbp-13392], rsi
+  mov rsi, qword ptr [rbp-13376]
+  cmp rsi, qword ptr [rbp-13384]
+  jne .L.else.main.160
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-13392]
+  mov r9, qword ptr [rbp-13384]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.161
+.L.else.main.160:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-13392]
+  mov r9, qword ptr [rbp-13376]
+  mov r10, qword ptr [rbp-13384]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.161:
+  mov qword ptr [rbp-13336], 0
+  mov rsi, 0
+  sub rsi, 1294967296
+  mov qword ptr [rbp-13368], rsi
+  mov rsi, qword ptr [rbp-13368]
+  movabs rdi, -3000000000
+  cmp rsi, rdi
+  je .L.case.main.164
+  cmp rsi, 5
+  je .L.case.main.163
+  movabs rdi, 3000000000
+  cmp rsi, rdi
+  jne .L.break.main.162
+  mov dword ptr [rbp-13356], 1
+  jmp .L.label.main.80
+.L.case.main.164:
+  mov dword ptr [rbp-13356], 2
+  jmp .L.label.main.80
+.L.case.main.163:
+  mov dword ptr [rbp-13356], 3
+  jmp .L.label.main.80
+.L.break.main.162:
+  mov dword ptr [rbp-13356], 0
+.L.label.main.80:
+  movsxd rsi, dword ptr [rbp-13356]
+  mov qword ptr [rbp-13344], rsi
+  lea rsi, [rip+.L.data.main.63]
+  mov qword ptr [rbp-13352], rsi
+  mov rsi, qword ptr [rbp-13336]
+  cmp rsi, qword ptr [rbp-13344]
+  jne .L.else.main.167
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-13352]
+  mov r9, qword ptr [rbp-13344]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.168
+.L.else.main.167:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-13352]
+  mov r9, qword ptr [rbp-13336]
+  mov r10, qword ptr [rbp-13344]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.168:
+  mov qword ptr [rbp-13296], 1
+  mov rsi, 0
+  movabs rdi, 3000000000
+  sub rsi, rdi
+  mov qword ptr [rbp-13328], rsi
+  mov rsi, qword ptr [rbp-13328]
+  cmp rsi, 100
+  je .L.case.main.172
+  jg .L.upper.main.175
+  movabs rdi, -3000000000
+  cmp rsi, rdi
+  je .L.case.main.174
+  cmp rsi, 5
+  je .L.case.main.173
+  jmp .L.break.main.169
+.L.upper.main.175:
+  movabs rdi, 3000000000
+  cmp rsi, rdi
+  je .L.case.main.171
+  movabs rdi, 7000000000
+  cmp rsi, rdi
+  je .L.case.main.170
+  jmp .L.break.main.169
+.L.case.main.174:
+  mov dword ptr [rbp-13316], 1
+  jmp .L.label.main.82
+.L.case.main.173:
+  mov dword ptr [rbp-13316], 2
+  jmp .L.label.main.82
+.L.case.main.172:
+  mov dword ptr [rbp-13316], 3
+  jmp .L.label.main.82
+.L.case.main.171:
+  mov dword ptr [rbp-13316], 4
+  jmp .L.label.main.82
+.L.case.main.170:
+  mov dword ptr [rbp-13316], 5
+  jmp .L.label.main.82
+.L.break.main.169:
+  mov dword ptr [rbp-13316], 0
+.L.label.main.82:
+  movsxd rsi, dword ptr [rbp-13316]
+  mov qword ptr [rbp-13304], rsi
+  lea rsi, [rip+.L.data.main.64]
+  mov qword ptr [rbp-13312], rsi
+  mov rsi, qword ptr [rbp-13296]
+  cmp rsi, qword ptr [rbp-13304]
+  jne .L.else.main.177
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-13312]
+  mov r9, qword ptr [rbp-13304]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.178
+.L.else.main.177:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-13312]
+  mov r9, qword ptr [rbp-13296]
+  mov r10, qword ptr [rbp-13304]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.178:
+  mov qword ptr [rbp-13256], 4
+  movabs rsi, 3000000000
+  mov qword ptr [rbp-13288], rsi
+  mov rsi, qword ptr [rbp-13288]
+  cmp rsi, 100
+  je .L.case.main.182
+  jg .L.upper.main.185
+  movabs rdi, -3000000000
+  cmp rsi, rdi
+  je .L.case.main.184
+  cmp rsi, 5
+  je .L.case.main.183
+  jmp .L.break.main.179
+.L.upper.main.185:
+  movabs rdi, 3000000000
+  cmp rsi, rdi
+  je .L.case.main.181
+  movabs rdi, 7000000000
+  cmp rsi, rdi
+  je .L.case.main.180
+  jmp .L.break.main.179
+.L.case.main.184:
+  mov dword ptr [rbp-13276], 1
+  jmp .L.label.main.84
+.L.case.main.183:
+  mov dword ptr [rbp-13276], 2
+  jmp .L.label.main.84
+.L.case.main.182:
+  mov dword ptr [rbp-13276], 3
+  jmp .L.label.main.84
+.L.case.main.181:
+  mov dword ptr [rbp-13276], 4
+  jmp .L.label.main.84
+.L.case.main.180:
+  mov dword ptr [rbp-13276], 5
+  jmp .L.label.main.84
+.L.break.main.179:
+  mov dword ptr [rbp-13276], 0
+.L.label.main.84:
+  movsxd rsi, dword ptr [rbp-13276]
+  mov qword ptr [rbp-13264], rsi
+  lea rsi, [rip+.L.data.main.65]
+  mov qword ptr [rbp-13272], rsi
+  mov rsi, qword ptr [rbp-13256]
+  cmp rsi, qword ptr [rbp-13264]
+  jne .L.else.main.187
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-13272]
+  mov r9, qword ptr [rbp-13264]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.188
+.L.else.main.187:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-13272]
+  mov r9, qword ptr [rbp-13256]
+  mov r10, qword ptr [rbp-13264]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.188:
+  mov qword ptr [rbp-13216], 5
+  movabs rsi, 7000000000
+  mov qword ptr [rbp-13248], rsi
+  mov rsi, qword ptr [rbp-13248]
+  cmp rsi, 100
+  je .L.case.main.192
+  jg .L.upper.main.195
+  movabs rdi, -3000000000
+  cmp rsi, rdi
+  je .L.case.main.194
+  cmp rsi, 5
+  je .L.case.main.193
+  jmp .L.break.main.189
+.L.upper.main.195:
+  movabs rdi, 3000000000
+  cmp rsi, rdi
+  je .L.case.main.191
+  movabs rdi, 7000000000
+  cmp rsi, rdi
+  je .L.case.main.190
+  jmp .L.break.main.189
+.L.case.main.194:
+  mov dword ptr [rbp-13236], 1
+  jmp .L.label.main.86
+.L.case.main.193:
+  mov dword ptr [rbp-13236], 2
+  jmp .L.label.main.86
+.L.case.main.192:
+  mov dword ptr [rbp-13236], 3
+  jmp .L.label.main.86
+.L.case.main.191:
+  mov dword ptr [rbp-13236], 4
+  jmp .L.label.main.86
+.L.case.main.190:
+  mov dword ptr [rbp-13236], 5
+  jmp .L.label.main.86
+.L.break.main.189:
+  mov dword ptr [rbp-13236], 0
+.L.label.main.86:
+  movsxd rsi, dword ptr [rbp-13236]
+  mov qword ptr [rbp-13224], rsi
+  lea rsi, [rip+.L.data.main.66]
+  mov qword ptr [rbp-13232], rsi
+  mov rsi, qword ptr [rbp-13216]
+  cmp rsi, qword ptr [rbp-13224]
+  jne .L.else.main.197
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-13232]
+  mov r9, qword ptr [rbp-13224]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.198
+.L.else.main.197:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-13232]
+  mov r9, qword ptr [rbp-13216]
+  mov r10, qword ptr [rbp-13224]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.198:
+  mov qword ptr [rbp-13176], 0
+  mov qword ptr [rbp-13208], 6
+  mov rsi, qword ptr [rbp-13208]
+  cmp rsi, 100
+  je .L.case.main.202
+  jg .L.upper.main.205
+  movabs rdi, -3000000000
+  cmp rsi, rdi
+  je .L.case.main.204
+  cmp rsi, 5
+  je .L.case.main.203
+  jmp .L.break.main.199
+.L.upper.main.205:
+  movabs rdi, 3000000000
+  cmp rsi, rdi
+  je .L.case.main.201
+  movabs rdi, 7000000000
+  cmp rsi, rdi
+  je .L.case.main.200
+  jmp .L.break.main.199
+.L.case.main.204:
+  mov dword ptr [rbp-13196], 1
+  jmp .L.label.main.88
+.L.case.main.203:
+  mov dword ptr [rbp-13196], 2
+  jmp .L.label.main.88
+.L.case.main.202:
+  mov dword ptr [rbp-13196], 3
+  jmp .L.label.main.88
+.L.case.main.201:
+  mov dword ptr [rbp-13196], 4
+  jmp .L.label.main.88
+.L.case.main.200:
+  mov dword ptr [rbp-13196], 5
+  jmp .L.label.main.88
+.L.break.main.199:
+  mov dword ptr [rbp-13196], 0
+.L.label.main.88:
+  movsxd rsi, dword ptr [rbp-13196]
+  mov qword ptr [rbp-13184], rsi
+  lea rsi, [rip+.L.data.main.67]
+  mov qword ptr [rbp-13192], rsi
+  mov rsi, qword ptr [rbp-13176]
+  cmp rsi, qword ptr [rbp-13184]
+  jne .L.else.main.207
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-13192]
+  mov r9, qword ptr [rbp-13184]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.208
+.L.else.main.207:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-13192]
+  mov r9, qword ptr [rbp-13176]
+  mov r10, qword ptr [rbp-13184]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.208:
+  mov qword ptr [rbp-13136], 1
+  movabs rsi, 3000000000
+  mov qword ptr [rbp-13168], rsi
+  mov rsi, qword ptr [rbp-13168]
+  movabs rdi, 3000000000
+  sub rsi, rdi
+  cmp rsi, 4
+  ja .L.break.main.209
+  lea rdi, [rip+.L.table.main.214]
+  shl rsi, 2
+  add rsi, rdi
+  movsxd rsi, dword ptr [rsi]
+  add rsi, rdi
+  jmp rsi
+.L.table.main.214:
+  .long .L.case.main.213-.L.table.main.214
+  .long .L.case.main.212-.L.table.main.214
+  .long .L.case.main.211-.L.table.main.214
+  .long .L.break.main.209-.L.table.main.214
+  .long .L.case.main.210-.L.table.main.214
+.L.case.main.213:
+  mov dword ptr [rbp-13156], 1
+  jmp .L.label.main.90
+.L.case.main.212:
+  mov dword ptr [rbp-13156], 2
+  jmp .L.label.main.90
+.L.case.main.211:
+  mov dword ptr [rbp-13156], 3
+  jmp .L.label.main.90
+.L.case.main.210:
+  mov dword ptr [rbp-13156], 4
+  jmp .L.label.main.90
+.L.break.main.209:
+  mov dword ptr [rbp-13156], 0
+.L.label.main.90:
+  movsxd rsi, dword ptr [rbp-13156]
+  mov qword ptr [rbp-13144], rsi
+  lea rsi, [rip+.L.data.main.68]
+  mov qword ptr [rbp-13152], rsi
+  mov rsi, qword ptr [rbp-13136]
+  cmp rsi, qword ptr [rbp-13144]
+  jne .L.else.main.216
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-13152]
+  mov r9, qword ptr [rbp-13144]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.217
+.L.else.main.216:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-13152]
+  mov r9, qword ptr [rbp-13136]
+  mov r10, qword ptr [rbp-13144]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.217:
+  mov qword ptr [rbp-13096], 4
+  movabs rsi, 3000000004
+  mov qword ptr [rbp-13128], rsi
+  mov rsi, qword ptr [rbp-13128]
+  movabs rdi, 3000000000
+  sub rsi, rdi
+  cmp rsi, 4
+  ja .L.break.main.218
+  lea rdi, [rip+.L.table.main.223]
+  shl rsi, 2
+  add rsi, rdi
+  movsxd rsi, dword ptr [rsi]
+  add rsi, rdi
+  jmp rsi
+.L.table.main.223:
+  .long .L.case.main.222-.L.table.main.223
+  .long .L.case.main.221-.L.table.main.223
+  .long .L.case.main.220-.L.table.main.223
+  .long .L.break.main.218-.L.table.main.223
+  .long .L.case.main.219-.L.table.main.223
+.L.case.main.222:
+  mov dword ptr [rbp-13116], 1
+  jmp .L.label.main.92
+.L.case.main.221:
+  mov dword ptr [rbp-13116], 2
+  jmp .L.label.main.92
+.L.case.main.220:
+  mov dword ptr [rbp-13116], 3
+  jmp .L.label.main.92
+.L.case.main.219:
+  mov dword ptr [rbp-13116], 4
+  jmp .L.label.main.92
+.L.break.main.218:
+  mov dword ptr [rbp-13116], 0
+.L.label.main.92:
+  movsxd rsi, dword ptr [rbp-13116]
+  mov qword ptr [rbp-13104], rsi
+  lea rsi, [rip+.L.data.main.69]
+  mov qword ptr [rbp-13112], rsi
+  mov rsi, qword ptr [rbp-13096]
+  cmp rsi, qword ptr [rbp-13104]
+  jne .L.else.main.225
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-13112]
+  mov r9, qword ptr [rbp-13104]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.226
+.L.else.main.225:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-13112]
+  mov r9, qword ptr [rbp-13096]
+  mov r10, qword ptr [rbp-13104]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.226:
+  mov qword ptr [rbp-13056], 0
+  movabs rsi, 3000000003
+  mov qword ptr [rbp-13088], rsi
+  mov rsi, qword ptr [rbp-13088]
+  movabs rdi, 3000000000
+  sub rsi, rdi
+  cmp rsi, 4
+  ja .L.break.main.227
+  lea rdi, [rip+.L.table.main.232]
+  shl rsi, 2
+  add rsi, rdi
+  movsxd rsi, dword ptr [rsi]
+  add rsi, rdi
+  jmp rsi
+.L.table.main.232:
+  .long .L.case.main.231-.L.table.main.232
+  .long .L.case.main.230-.L.table.main.232
+  .long .L.case.main.229-.L.table.main.232
+  .long .L.break.main.227-.L.table.main.232
+  .long .L.case.main.228-.L.table.main.232
+.L.case.main.231:
+  mov dword ptr [rbp-13076], 1
+  jmp .L.label.main.94
+.L.case.main.230:
+  mov dword ptr [rbp-13076], 2
+  jmp .L.label.main.94
+.L.case.main.229:
+  mov dword ptr [rbp-13076], 3
+  jmp .L.label.main.94
+.L.case.main.228:
+  mov dword ptr [rbp-13076], 4
+  jmp .L.label.main.94
+.L.break.main.227:
+  mov dword ptr [rbp-13076], 0
+.L.label.main.94:
+  movsxd rsi, dword ptr [rbp-13076]
+  mov qword ptr [rbp-13064], rsi
+  lea rsi, [rip+.L.data.main.70]
+  mov qword ptr [rbp-13072], rsi
+  mov rsi, qword ptr [rbp-13056]
+  cmp rsi, qword ptr [rbp-13064]
+  jne .L.else.main.234
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-13072]
+  mov r9, qword ptr [rbp-13064]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.235
+.L.else.main.234:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-13072]
+  mov r9, qword ptr [rbp-13056]
+  mov r10, qword ptr [rbp-13064]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.235:
+  mov qword ptr [rbp-13016], 0
+  mov qword ptr [rbp-13048], 4
+  mov rsi, qword ptr [rbp-13048]
+  movabs rdi, 3000000000
+  sub rsi, rdi
+  cmp rsi, 4
+  ja .L.break.main.236
+  lea rdi, [rip+.L.table.main.241]
+  shl rsi, 2
+  add rsi, rdi
+  movsxd rsi, dword ptr [rsi]
+  add rsi, rdi
+  jmp rsi
+.L.table.main.241:
+  .long .L.case.main.240-.L.table.main.241
+  .long .L.case.main.239-.L.table.main.241
+  .long .L.case.main.238-.L.table.main.241
+  .long .L.break.main.236-.L.table.main.241
+  .long .L.case.main.237-.L.table.main.241
+.L.case.main.240:
+  mov dword ptr [rbp-13036], 1
+  jmp .L.label.main.96
+.L.case.main.239:
+  mov dword ptr [rbp-13036], 2
+  jmp .L.label.main.96
+.L.case.main.238:
+  mov dword ptr [rbp-13036], 3
+  jmp .L.label.main.96
+.L.case.main.237:
+  mov dword ptr [rbp-13036], 4
+  jmp .L.label.main.96
+.L.break.main.236:
+  mov dword ptr [rbp-13036], 0
+.L.label.main.96:
+  movsxd rsi, dword ptr [rbp-13036]
+  mov qword ptr [rbp-13024], rsi
+  lea rsi, [rip+.L.data.main.71]
+  mov qword ptr [rbp-13032], rsi
+  mov rsi, qword ptr [rbp-13016]
+  cmp rsi, qword ptr [rbp-13024]
+  jne .L.else.main.243
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-13032]
+  mov r9, qword ptr [rbp-13024]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.244
+.L.else.main.243:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-13032]
+  mov r9, qword ptr [rbp-13016]
+  mov r10, qword ptr [rbp-13024]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.244:
+  mov qword ptr [rbp-12984], 1
+  mov rsi, 0
+  sub rsi, 1294967296
+  mov dword ptr [rbp-13008], esi
+  movsxd rsi, dword ptr [rbp-13008]
+  cmp rsi, -1294967296
+  jne .L.break.main.245
+  mov dword ptr [rbp-13004], 1
+  jmp .L.label.main.98
+.L.break.main.245:
+  mov dword ptr [rbp-13004], 0
+.L.label.main.98:
+  movsxd rsi, dword ptr [rbp-13004]
+  mov qword ptr [rbp-12992], rsi
+  lea rsi, [rip+.L.data.main.72]
+  mov qword ptr [rbp-13000], rsi
+  mov rsi, qword ptr [rbp-12984]
+  cmp rsi, qword ptr [rbp-12992]
+  jne .L.else.main.248
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-13000]
+  mov r9, qword ptr [rbp-12992]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.249
+.L.else.main.248:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-13000]
+  mov r9, qword ptr [rbp-12984]
+  mov r10, qword ptr [rbp-12992]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.249:
+  mov qword ptr [rbp-12960], 7864346
+  lea rsi, [rip+spill_g]
+  add rsi, 8
+  mov qword ptr [rsi], 3
+  mov rsi, 1
+  mov r8, 1
+  mov r9, 2
+  mov r10, 3
+  mov r11, 4
+  mov qword ptr [rbp-19344], 5
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov r8, r11
+  mov r9, qword ptr [rbp-19344]
+  mov rax, 0
+  call spill_addr
+  mov qword ptr [rbp-12968], rax
+  lea rsi, [rip+.L.data.main.73]
+  mov qword ptr [rbp-12976], rsi
+  mov rsi, qword ptr [rbp-12960]
+  cmp rsi, qword ptr [rbp-12968]
+  jne .L.else.main.250
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-12976]
+  mov r9, qword ptr [rbp-12968]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.251
+.L.else.main.250:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-12976]
+  mov r9, qword ptr [rbp-12960]
+  mov r10, qword ptr [rbp-12968]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.251:
+  mov rsi, 0
+  sub rsi, 1
+  mov qword ptr [rbp-12928], rsi
+  mov rsi, 0
+  sub rsi, 5
+  mov dword ptr [rbp-12952], esi
+  movsxd rsi, dword ptr [rbp-12952]
+  cmp rsi, 0
+  jge .L.end.main.252
+  mov rsi, 0
+  sub rsi, 1
+  mov dword ptr [rbp-12948], esi
+  jmp .L.label.main.101
+.L.end.main.252:
+  movsxd rsi, dword ptr [rbp-12952]
+  cmp rsi, 0
+  jne .L.end.main.254
+  mov dword ptr [rbp-12948], 0
+  jmp .L.label.main.101
+.L.end.main.254:
+  mov dword ptr [rbp-12948], 1
+.L.label.main.101:
+  movsxd rsi, dword ptr [rbp-12948]
+  mov qword ptr [rbp-12936], rsi
+  lea rsi, [rip+.L.data.main.74]
+  mov qword ptr [rbp-12944], rsi
+  mov rsi, qword ptr [rbp-12928]
+  cmp rsi, qword ptr [rbp-12936]
+  jne .L.else.main.255
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-12944]
+  mov r9, qword ptr [rbp-12936]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.256
+.L.else.main.255:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-12944]
+  mov r9, qword ptr [rbp-12928]
+  mov r10, qword ptr [rbp-12936]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.256:
+  mov qword ptr [rbp-12896], 0
+  mov dword ptr [rbp-12920], 0
+  movsxd rsi, dword ptr [rbp-12920]
+  cmp rsi, 0
+  jge .L.end.main.257
+  mov rsi, 0
+  sub rsi, 1
+  mov dword ptr [rbp-12916], esi
+  jmp .L.label.main.103
+.L.end.main.257:
+  movsxd rsi, dword ptr [rbp-12920]
+  cmp rsi, 0
+  jne .L.end.main.259
+  mov dword ptr [rbp-12916], 0
+  jmp .L.label.main.103
+.L.end.main.259:
+  mov dword ptr [rbp-12916], 1
+.L.label.main.103:
+  movsxd rsi, dword ptr [rbp-12916]
+  mov qword ptr [rbp-12904], rsi
+  lea rsi, [rip+.L.data.main.75]
+  mov qword ptr [rbp-12912], rsi
+  mov rsi, qword ptr [rbp-12896]
+  cmp rsi, qword ptr [rbp-12904]
+  jne .L.else.main.260
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-12912]
+  mov r9, qword ptr [rbp-12904]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.261
+.L.else.main.260:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-12912]
+  mov r9, qword ptr [rbp-12896]
+  mov r10, qword ptr [rbp-12904]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.261:
+  mov qword ptr [rbp-12864], 1
+  mov dword ptr [rbp-12888], 7
+  movsxd rsi, dword ptr [rbp-12888]
+  cmp rsi, 0
+  jge .L.end.main.262
+  mov rsi, 0
+  sub rsi, 1
+  mov dword ptr [rbp-12884], esi
+  jmp .L.label.main.105
+.L.end.main.262:
+  movsxd rsi, dword ptr [rbp-12888]
+  cmp rsi, 0
+  jne .L.end.main.264
+  mov dword ptr [rbp-12884], 0
+  jmp .L.label.main.105
+.L.end.main.264:
+  mov dword ptr [rbp-12884], 1
+.L.label.main.105:
+  movsxd rsi, dword ptr [rbp-12884]
+  mov qword ptr [rbp-12872], rsi
+  lea rsi, [rip+.L.data.main.76]
+  mov qword ptr [rbp-12880], rsi
+  mov rsi, qword ptr [rbp-12864]
+  cmp rsi, qword ptr [rbp-12872]
+  jne .L.else.main.265
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-12880]
+  mov r9, qword ptr [rbp-12872]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.266
+.L.else.main.265:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-12880]
+  mov r9, qword ptr [rbp-12864]
+  mov r10, qword ptr [rbp-12872]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.266:
+  mov qword ptr [rbp-12816], 1
+  mov dword ptr [rbp-12856], 3
+  movsxd rsi, dword ptr [rbp-12856]
+  cmp rsi, 0
+  jge .L.end.main.267
+  mov rsi, 0
+  sub rsi, 1
+  mov dword ptr [rbp-12852], esi
+  jmp .L.label.main.107
+.L.end.main.267:
+  movsxd rsi, dword ptr [rbp-12856]
+  cmp rsi, 0
+  jne .L.end.main.269
+  mov dword ptr [rbp-12852], 0
+  jmp .L.label.main.107
+.L.end.main.269:
+  mov dword ptr [rbp-12852], 1
+.L.label.main.107:
+  movsxd rsi, dword ptr [rbp-12852]
+  mov rdi, 0
+  sub rdi, 2
+  mov dword ptr [rbp-12848], edi
+  movsxd rdi, dword ptr [rbp-12848]
+  cmp rdi, 0
+  jge .L.end.main.270
+  mov rdi, 0
+  sub rdi, 1
+  mov dword ptr [rbp-12844], edi
+  jmp .L.label.main.108
+.L.end.main.270:
+  movsxd rdi, dword ptr [rbp-12848]
+  cmp rdi, 0
+  jne .L.end.main.272
+  mov dword ptr [rbp-12844], 0
+  jmp .L.label.main.108
+.L.end.main.272:
+  mov dword ptr [rbp-12844], 1
+.L.label.main.108:
+  movsxd rdi, dword ptr [rbp-12844]
+  add rsi, rdi
+  mov dword ptr [rbp-12840], 9
+  movsxd rdi, dword ptr [rbp-12840]
+  cmp rdi, 0
+  jge .L.end.main.273
+  mov rdi, 0
+  sub rdi, 1
+  mov dword ptr [rbp-12836], edi
+  jmp .L.label.main.109
+.L.end.main.273:
+  movsxd rdi, dword ptr [rbp-12840]
+  cmp rdi, 0
+  jne .L.end.main.275
+  mov dword ptr [rbp-12836], 0
+  jmp .L.label.main.109
+.L.end.main.275:
+  mov dword ptr [rbp-12836], 1
+.L.label.main.109:
+  movsxd rdi, dword ptr [rbp-12836]
+  add rsi, rdi
+  mov qword ptr [rbp-12824], rsi
+  lea rsi, [rip+.L.data.main.77]
+  mov qword ptr [rbp-12832], rsi
+  mov rsi, qword ptr [rbp-12816]
+  cmp rsi, qword ptr [rbp-12824]
+  jne .L.else.main.276
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-12832]
+  mov r9, qword ptr [rbp-12824]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.277
+.L.else.main.276:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-12832]
+  mov r9, qword ptr [rbp-12816]
+  mov r10, qword ptr [rbp-12824]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.277:
+  mov qword ptr [rbp-12784], 2
+  mov dword ptr [rbp-12808], 0
+  movsxd rsi, dword ptr [rbp-12808]
+  cmp rsi, 0
+  je .L.case.main.280
+  cmp rsi, 3
+  je .L.case.main.279
+  cmp rsi, 6
+  jne .L.break.main.278
+.L.case.main.280:
+  mov dword ptr [rbp-12804], 2
+  jmp .L.label.main.111
+.L.case.main.279:
+  mov dword ptr [rbp-12804], 1
+  jmp .L.label.main.111
+.L.break.main.278:
+  mov dword ptr [rbp-12804], 0
+.L.label.main.111:
+  movsxd rsi, dword ptr [rbp-12804]
+  mov qword ptr [rbp-12792], rsi
+  lea rsi, [rip+.L.data.main.78]
+  mov qword ptr [rbp-12800], rsi
+  mov rsi, qword ptr [rbp-12784]
+  cmp rsi, qword ptr [rbp-12792]
+  jne .L.else.main.283
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-12800]
+  mov r9, qword ptr [rbp-12792]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.284
+.L.else.main.283:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-12800]
+  mov r9, qword ptr [rbp-12784]
+  mov r10, qword ptr [rbp-12792]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.284:
+  mov qword ptr [rbp-12752], 2
+  mov dword ptr [rbp-12776], 6
+  movsxd rsi, dword ptr [rbp-12776]
+  cmp rsi, 0
+  je .L.case.main.287
+  cmp rsi, 3
+  je .L.case.main.286
+  cmp rsi, 6
+  jne .L.break.main.285
+.L.case.main.287:
+  mov dword ptr [rbp-12772], 2
+  jmp .L.label.main.113
+.L.case.main.286:
+  mov dword ptr [rbp-12772], 1
+  jmp .L.label.main.113
+.L.break.main.285:
+  mov dword ptr [rbp-12772], 0
+.L.label.main.113:
+  movsxd rsi, dword ptr [rbp-12772]
+  mov qword ptr [rbp-12760], rsi
+  lea rsi, [rip+.L.data.main.79]
+  mov qword ptr [rbp-12768], rsi
+  mov rsi, qword ptr [rbp-12752]
+  cmp rsi, qword ptr [rbp-12760]
+  jne .L.else.main.290
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-12768]
+  mov r9, qword ptr [rbp-12760]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.291
+.L.else.main.290:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-12768]
+  mov r9, qword ptr [rbp-12752]
+  mov r10, qword ptr [rbp-12760]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.291:
+  mov qword ptr [rbp-12720], 1
+  mov dword ptr [rbp-12744], 3
+  movsxd rsi, dword ptr [rbp-12744]
+  cmp rsi, 0
+  je .L.case.main.294
+  cmp rsi, 3
+  je .L.case.main.293
+  cmp rsi, 6
+  jne .L.break.main.292
+.L.case.main.294:
+  mov dword ptr [rbp-12740], 2
+  jmp .L.label.main.115
+.L.case.main.293:
+  mov dword ptr [rbp-12740], 1
+  jmp .L.label.main.115
+.L.break.main.292:
+  mov dword ptr [rbp-12740], 0
+.L.label.main.115:
+  movsxd rsi, dword ptr [rbp-12740]
+  mov qword ptr [rbp-12728], rsi
+  lea rsi, [rip+.L.data.main.80]
+  mov qword ptr [rbp-12736], rsi
+  mov rsi, qword ptr [rbp-12720]
+  cmp rsi, qword ptr [rbp-12728]
+  jne .L.else.main.297
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-12736]
+  mov r9, qword ptr [rbp-12728]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.298
+.L.else.main.297:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-12736]
+  mov r9, qword ptr [rbp-12720]
+  mov r10, qword ptr [rbp-12728]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.298:
+  mov qword ptr [rbp-12688], 0
+  mov dword ptr [rbp-12712], 4
+  movsxd rsi, dword ptr [rbp-12712]
+  cmp rsi, 0
+  je .L.case.main.301
+  cmp rsi, 3
+  je .L.case.main.300
+  cmp rsi, 6
+  jne .L.break.main.299
+.L.case.main.301:
+  mov dword ptr [rbp-12708], 2
+  jmp .L.label.main.117
+.L.case.main.300:
+  mov dword ptr [rbp-12708], 1
+  jmp .L.label.main.117
+.L.break.main.299:
+  mov dword ptr [rbp-12708], 0
+.L.label.main.117:
+  movsxd rsi, dword ptr [rbp-12708]
+  mov qword ptr [rbp-12696], rsi
+  lea rsi, [rip+.L.data.main.81]
+  mov qword ptr [rbp-12704], rsi
+  mov rsi, qword ptr [rbp-12688]
+  cmp rsi, qword ptr [rbp-12696]
+  jne .L.else.main.304
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-12704]
+  mov r9, qword ptr [rbp-12696]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.305
+.L.else.main.304:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-12704]
+  mov r9, qword ptr [rbp-12688]
+  mov r10, qword ptr [rbp-12696]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.305:
+  mov qword ptr [rbp-12656], 3
+  mov dword ptr [rbp-12680], 3
+  movsxd rsi, dword ptr [rbp-12680]
+  cmp rsi, 5
+  jg .L.label.main.big.119
+  movsxd rsi, dword ptr [rbp-12680]
+  mov dword ptr [rbp-12676], esi
+  jmp .L.label.main.119
+.L.label.main.big.119:
+  movsxd rsi, dword ptr [rbp-12680]
+  lea rsi, [rsi+rsi*4]
+  shl rsi, 1
+  mov dword ptr [rbp-12676], esi
+.L.label.main.119:
+  movsxd rsi, dword ptr [rbp-12676]
+  mov qword ptr [rbp-12664], rsi
+  lea rsi, [rip+.L.data.main.82]
+  mov qword ptr [rbp-12672], rsi
+  mov rsi, qword ptr [rbp-12656]
+  cmp rsi, qword ptr [rbp-12664]
+  jne .L.else.main.309
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-12672]
+  mov r9, qword ptr [rbp-12664]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.310
+.L.else.main.309:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-12672]
+  mov r9, qword ptr [rbp-12656]
+  mov r10, qword ptr [rbp-12664]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.310:
+  mov qword ptr [rbp-12624], 70
+  mov dword ptr [rbp-12648], 7
+  movsxd rsi, dword ptr [rbp-12648]
+  cmp rsi, 5
+  jg .L.label.main.big.121
+  movsxd rsi, dword ptr [rbp-12648]
+  mov dword ptr [rbp-12644], esi
+  jmp .L.label.main.121
+.L.label.main.big.121:
+  movsxd rsi, dword ptr [rbp-12648]
+  lea rsi, [rsi+rsi*4]
+  shl rsi, 1
+  mov dword ptr [rbp-12644], esi
+.L.label.main.121:
+  movsxd rsi, dword ptr [rbp-12644]
+  mov qword ptr [rbp-12632], rsi
+  lea rsi, [rip+.L.data.main.83]
+  mov qword ptr [rbp-12640], rsi
+  mov rsi, qword ptr [rbp-12624]
+  cmp rsi, qword ptr [rbp-12632]
+  jne .L.else.main.314
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-12640]
+  mov r9, qword ptr [rbp-12632]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.315
+.L.else.main.314:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-12640]
+  mov r9, qword ptr [rbp-12624]
+  mov r10, qword ptr [rbp-12632]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.315:
+  mov qword ptr [rbp-12584], 83
+  mov dword ptr [rbp-12616], 3
+  movsxd rsi, dword ptr [rbp-12616]
+  cmp rsi, 5
+  jg .L.label.main.big.123
+  movsxd rsi, dword ptr [rbp-12616]
+  mov dword ptr [rbp-12612], esi
+  jmp .L.label.main.123
+.L.label.main.big.123:
+  movsxd rsi, dword ptr [rbp-12616]
+  lea rsi, [rsi+rsi*4]
+  shl rsi, 1
+  mov dword ptr [rbp-12612], esi
+.L.label.main.123:
+  movsxd rsi, dword ptr [rbp-12612]
+  mov dword ptr [rbp-12608], 8
+  movsxd rdi, dword ptr [rbp-12608]
+  cmp rdi, 5
+  jg .L.label.main.big.124
+  movsxd rdi, dword ptr [rbp-12608]
+  mov dword ptr [rbp-12604], edi
+  jmp .L.label.main.124
+.L.label.main.big.124:
+  movsxd rdi, dword ptr [rbp-12608]
+  lea rdi, [rdi+rdi*4]
+  shl rdi, 1
+  mov dword ptr [rbp-12604], edi
+.L.label.main.124:
+  movsxd rdi, dword ptr [rbp-12604]
+  add rsi, rdi
+  mov qword ptr [rbp-12592], rsi
+  lea rsi, [rip+.L.data.main.84]
+  mov qword ptr [rbp-12600], rsi
+  mov rsi, qword ptr [rbp-12584]
+  cmp rsi, qword ptr [rbp-12592]
+  jne .L.else.main.322
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-12600]
+  mov r9, qword ptr [rbp-12592]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.323
+.L.else.main.322:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-12600]
+  mov r9, qword ptr [rbp-12584]
+  mov r10, qword ptr [rbp-12592]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.323:
+  mov qword ptr [rbp-12560], 2040
+  mov rsi, 4
+  mov r8, 5
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call sum_grid
+  mov qword ptr [rbp-12568], rax
+  lea rsi, [rip+.L.data.main.85]
+  mov qword ptr [rbp-12576], rsi
+  mov rsi, qword ptr [rbp-12560]
+  cmp rsi, qword ptr [rbp-12568]
+  jne .L.else.main.324
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-12576]
+  mov r9, qword ptr [rbp-12568]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.325
+.L.else.main.324:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-12576]
+  mov r9, qword ptr [rbp-12560]
+  mov r10, qword ptr [rbp-12568]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.325:
+  mov qword ptr [rbp-12536], 0
+  mov rsi, 0
+  mov r8, 5
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call sum_grid
+  mov qword ptr [rbp-12544], rax
+  lea rsi, [rip+.L.data.main.86]
+  mov qword ptr [rbp-12552], rsi
+  mov rsi, qword ptr [rbp-12536]
+  cmp rsi, qword ptr [rbp-12544]
+  jne .L.else.main.326
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-12552]
+  mov r9, qword ptr [rbp-12544]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.327
+.L.else.main.326:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-12552]
+  mov r9, qword ptr [rbp-12536]
+  mov r10, qword ptr [rbp-12544]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.327:
+  mov qword ptr [rbp-12496], 20
+  mov dword ptr [rbp-12516], 5
+  mov dword ptr [rip+loop_g], 0
+  mov dword ptr [rbp-12520], 0
+  mov dword ptr [rbp-12524], 0
+  movsxd rsi, dword ptr [rbp-12524]
+  movsxd rdi, dword ptr [rbp-12516]
+  cmp rsi, rdi
+  jge .L.break.main.329
+  movsxd rsi, dword ptr [rbp-12516]
+  .p2align 4,,10
+.L.begin.main.330:
+  movsxd rdi, dword ptr [rip+loop_g]
+  add dword ptr [rbp-12520], edi
+  add dword ptr [rip+loop_g], 2
+  add dword ptr [rbp-12524], 1
+  movsxd rdi, dword ptr [rbp-12524]
+  cmp rdi, rsi
+  jl .L.begin.main.330
+.L.break.main.329:
+  movsxd rsi, dword ptr [rbp-12520]
+  movsxd rsi, esi
+  mov qword ptr [rbp-12504], rsi
+  lea rsi, [rip+.L.data.main.87]
+  mov qword ptr [rbp-12512], rsi
+  mov rsi, qword ptr [rbp-12496]
+  cmp rsi, qword ptr [rbp-12504]
+  jne .L.else.main.331
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-12512]
+  mov r9, qword ptr [rbp-12504]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.332
+.L.else.main.331:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-12512]
+  mov r9, qword ptr [rbp-12496]
+  mov r10, qword ptr [rbp-12504]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.332:
+  mov qword ptr [rbp-12448], 10
+  mov dword ptr [rip+loop_g], 1
+  lea rsi, [rip+loop_g]
+  mov qword ptr [rbp-12472], rsi
+  mov dword ptr [rbp-12476], 4
+  mov dword ptr [rbp-12480], 0
+  mov dword ptr [rbp-12484], 0
+  movsxd rsi, dword ptr [rbp-12484]
+  movsxd rdi, dword ptr [rbp-12476]
+  cmp rsi, rdi
+  jge .L.break.main.334
+  .p2align 4,,10
+.L.begin.main.335:
+  movsxd rsi, dword ptr [rip+loop_g]
+  add dword ptr [rbp-12480], esi
+  mov rsi, qword ptr [rbp-12472]
+  add dword ptr [rsi], 1
+  add dword ptr [rbp-12484], 1
+  movsxd rsi, dword ptr [rbp-12484]
+  movsxd rdi, dword ptr [rbp-12476]
+  cmp rsi, rdi
+  jl .L.begin.main.335
+.L.break.main.334:
+  movsxd rsi, dword ptr [rbp-12480]
+  movsxd rsi, esi
+  mov qword ptr [rbp-12456], rsi
+  lea rsi, [rip+.L.data.main.88]
+  mov qword ptr [rbp-12464], rsi
+  mov rsi, qword ptr [rbp-12448]
+  cmp rsi, qword ptr [rbp-12456]
+  jne .L.else.main.336
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-12464]
+  mov r9, qword ptr [rbp-12456]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.337
+.L.else.main.336:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-12464]
+  mov r9, qword ptr [rbp-12448]
+  mov r10, qword ptr [rbp-12456]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.337:
+  mov qword ptr [rbp-12400], 8
+  mov dword ptr [rbp-19100], 0
+  mov dword ptr [rip+loop_g], 2
+  lea rsi, [rbp-19100]
+  mov qword ptr [rbp-12424], rsi
+  mov dword ptr [rbp-12428], 4
+  mov dword ptr [rbp-12432], 0
+  mov dword ptr [rbp-12436], 0
+  movsxd rsi, dword ptr [rbp-12436]
+  movsxd rdi, dword ptr [rbp-12428]
+  cmp rsi, rdi
+  jge .L.break.main.339
+  .p2align 4,,10
+.L.begin.main.340:
+  movsxd rsi, dword ptr [rip+loop_g]
+  add dword ptr [rbp-12432], esi
+  mov rsi, qword ptr [rbp-12424]
+  add dword ptr [rsi], 1
+  add dword ptr [rbp-12436], 1
+  movsxd rsi, dword ptr [rbp-12436]
+  movsxd rdi, dword ptr [rbp-12428]
+  cmp rsi, rdi
+  jl .L.begin.main.340
+.L.break.main.339:
+  movsxd rsi, dword ptr [rbp-12432]
+  movsxd rsi, esi
+  mov qword ptr [rbp-12408], rsi
+  lea rsi, [rip+.L.data.main.89]
+  mov qword ptr [rbp-12416], rsi
+  mov rsi, qword ptr [rbp-12400]
+  cmp rsi, qword ptr [rbp-12408]
+  jne .L.else.main.341
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-12416]
+  mov r9, qword ptr [rbp-12408]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.342
+.L.else.main.341:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-12416]
+  mov r9, qword ptr [rbp-12400]
+  mov r10, qword ptr [rbp-12408]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.342:
+  mov qword ptr [rbp-12376], 10
+  mov rdi, 4
+  mov rax, 0
+  call sum_local_through
+  mov qword ptr [rbp-12384], rax
+  lea rsi, [rip+.L.data.main.90]
+  mov qword ptr [rbp-12392], rsi
+  mov rsi, qword ptr [rbp-12376]
+  cmp rsi, qword ptr [rbp-12384]
+  jne .L.else.main.343
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-12392]
+  mov r9, qword ptr [rbp-12384]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.344
+.L.else.main.343:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-12392]
+  mov r9, qword ptr [rbp-12376]
+  mov r10, qword ptr [rbp-12384]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.344:
+  mov qword ptr [rbp-12328], 0
+  mov qword ptr [rbp-12352], 0
+  mov dword ptr [rbp-12356], 0
+  mov dword ptr [rbp-12360], 0
+  mov dword ptr [rbp-12364], 0
+  movsxd rsi, dword ptr [rbp-12364]
+  movsxd rdi, dword ptr [rbp-12356]
+  cmp rsi, rdi
+  jge .L.break.main.346
+  mov rsi, qword ptr [rbp-12352]
+  movsxd rdi, dword ptr [rbp-12356]
+  .p2align 4,,10
+.L.begin.main.347:
+  movsxd r8, dword ptr [rsi]
+  add dword ptr [rbp-12360], r8d
+  add dword ptr [rbp-12364], 1
+  movsxd r8, dword ptr [rbp-12364]
+  cmp r8, rdi
+  jl .L.begin.main.347
+.L.break.main.346:
+  movsxd rsi, dword ptr [rbp-12360]
+  movsxd rsi, esi
+  mov qword ptr [rbp-12336], rsi
+  lea rsi, [rip+.L.data.main.91]
+  mov qword ptr [rbp-12344], rsi
+  mov rsi, qword ptr [rbp-12328]
+  cmp rsi, qword ptr [rbp-12336]
+  jne .L.else.main.348
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-12344]
+  mov r9, qword ptr [rbp-12336]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.349
+.L.else.main.348:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-12344]
+  mov r9, qword ptr [rbp-12328]
+  mov r10, qword ptr [rbp-12336]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.349:
+  mov qword ptr [rbp-12280], 21
+  mov dword ptr [rbp-19096], 7
+  lea rsi, [rbp-19096]
+  mov qword ptr [rbp-12304], rsi
+  mov dword ptr [rbp-12308], 3
+  mov dword ptr [rbp-12312], 0
+  mov dword ptr [rbp-12316], 0
+  movsxd rsi, dword ptr [rbp-12316]
+  movsxd rdi, dword ptr [rbp-12308]
+  cmp rsi, rdi
+  jge .L.break.main.351
+  mov rsi, qword ptr [rbp-12304]
+  movsxd rdi, dword ptr [rbp-12308]
+  .p2align 4,,10
+.L.begin.main.352:
+  movsxd r8, dword ptr [rsi]
+  add dword ptr [rbp-12312], r8d
+  add dword ptr [rbp-12316], 1
+  movsxd r8, dword ptr [rbp-12316]
+  cmp r8, rdi
+  jl .L.begin.main.352
+.L.break.main.351:
+  movsxd rsi, dword ptr [rbp-12312]
+  movsxd rsi, esi
+  mov qword ptr [rbp-12288], rsi
+  lea rsi, [rip+.L.data.main.92]
+  mov qword ptr [rbp-12296], rsi
+  mov rsi, qword ptr [rbp-12280]
+  cmp rsi, qword ptr [rbp-12288]
+  jne .L.else.main.353
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-12296]
+  mov r9, qword ptr [rbp-12288]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.354
+.L.else.main.353:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-12296]
+  mov r9, qword ptr [rbp-12280]
+  mov r10, qword ptr [rbp-12288]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.354:
+  mov qword ptr [rbp-12240], 2
+  mov dword ptr [rbp-19092], 0
+  lea rsi, [rbp-19092]
+  mov qword ptr [rbp-12272], rsi
+  mov rsi, qword ptr [rbp-12272]
+  add dword ptr [rsi], 1
+  lea rsi, [rbp-19092]
+  mov qword ptr [rbp-12264], rsi
+  mov rsi, qword ptr [rbp-12264]
+  add dword ptr [rsi], 1
+  movsxd rsi, dword ptr [rbp-19092]
+  mov qword ptr [rbp-12248], rsi
+  lea rsi, [rip+.L.data.main.93]
+  mov qword ptr [rbp-12256], rsi
+  mov rsi, qword ptr [rbp-12240]
+  cmp rsi, qword ptr [rbp-12248]
+  jne .L.else.main.355
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-12256]
+  mov r9, qword ptr [rbp-12248]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.356
+.L.else.main.355:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-12256]
+  mov r9, qword ptr [rbp-12240]
+  mov r10, qword ptr [rbp-12248]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.356:
+  mov qword ptr [rbp-12208], 64
+  mov dword ptr [rbp-19088], 3
+  movsxd rsi, dword ptr [rbp-19088]
+  add rsi, 1
+  mov dword ptr [rbp-19088], esi
+  sub rsi, 1
+  mov dword ptr [rbp-12228], esi
+  movsxd rsi, dword ptr [rbp-12228]
+  movsxd rdi, dword ptr [rbp-12228]
+  add rsi, rdi
+  movsxd rsi, esi
+  mov dword ptr [rbp-19084], esi
+  movsxd rsi, dword ptr [rbp-19084]
+  lea rsi, [rsi+rsi*4]
+  shl rsi, 1
+  movsxd rdi, dword ptr [rbp-19088]
+  add rsi, rdi
+  mov qword ptr [rbp-12216], rsi
+  lea rsi, [rip+.L.data.main.94]
+  mov qword ptr [rbp-12224], rsi
+  mov rsi, qword ptr [rbp-12208]
+  cmp rsi, qword ptr [rbp-12216]
+  jne .L.else.main.357
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-12224]
+  mov r9, qword ptr [rbp-12216]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.358
+.L.else.main.357:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-12224]
+  mov r9, qword ptr [rbp-12208]
+  mov r10, qword ptr [rbp-12216]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.358:
+  mov qword ptr [rbp-12168], 24
+  mov dword ptr [rbp-12196], 3
+  movsxd rsi, dword ptr [rbp-12196]
+  movsxd rdi, dword ptr [rbp-12196]
+  add rsi, rdi
+  movsxd rsi, esi
+  mov dword ptr [rbp-12192], esi
+  movsxd rsi, dword ptr [rbp-12192]
+  movsxd rdi, dword ptr [rbp-12192]
+  add rsi, rdi
+  movsxd rsi, esi
+  mov dword ptr [rbp-12188], esi
+  movsxd rsi, dword ptr [rbp-12188]
+  movsxd rdi, dword ptr [rbp-12188]
+  add rsi, rdi
+  movsxd rsi, esi
+  mov qword ptr [rbp-12176], rsi
+  lea rsi, [rip+.L.data.main.95]
+  mov qword ptr [rbp-12184], rsi
+  mov rsi, qword ptr [rbp-12168]
+  cmp rsi, qword ptr [rbp-12176]
+  jne .L.else.main.359
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-12184]
+  mov r9, qword ptr [rbp-12176]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.360
+.L.else.main.359:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-12184]
+  mov r9, qword ptr [rbp-12168]
+  mov r10, qword ptr [rbp-12176]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.360:
+  mov qword ptr [rbp-12144], 3
+  mov dword ptr [rbp-19080], 3
+  movsxd rsi, dword ptr [rbp-19080]
+  mov qword ptr [rbp-12152], rsi
+  lea rsi, [rip+.L.data.main.96]
+  mov qword ptr [rbp-12160], rsi
+  mov rsi, qword ptr [rbp-12144]
+  cmp rsi, qword ptr [rbp-12152]
+  jne .L.else.main.361
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-12160]
+  mov r9, qword ptr [rbp-12152]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.362
+.L.else.main.361:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-12160]
+  mov r9, qword ptr [rbp-12144]
+  mov r10, qword ptr [rbp-12152]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.362:
+  mov qword ptr [rbp-12120], 3
+  mov dword ptr [rbp-19076], 3
+  lea rsi, [rbp-19076]
+  mov qword ptr [rbp-19072], rsi
+  lea rsi, [rbp-19072]
+  mov qword ptr [rbp-19064], rsi
+  mov rsi, qword ptr [rbp-19064]
+  mov rsi, qword ptr [rsi]
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-12128], rsi
+  lea rsi, [rip+.L.data.main.97]
+  mov qword ptr [rbp-12136], rsi
+  mov rsi, qword ptr [rbp-12120]
+  cmp rsi, qword ptr [rbp-12128]
+  jne .L.else.main.363
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-12136]
+  mov r9, qword ptr [rbp-12128]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.364
+.L.else.main.363:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-12136]
+  mov r9, qword ptr [rbp-12120]
+  mov r10, qword ptr [rbp-12128]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.364:
+  mov qword ptr [rbp-12096], 5
+  mov dword ptr [rbp-19052], 3
+  mov dword ptr [rbp-19048], 5
+  lea rsi, [rbp-19052]
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-12104], rsi
+  lea rsi, [rip+.L.data.main.98]
+  mov qword ptr [rbp-12112], rsi
+  mov rsi, qword ptr [rbp-12096]
+  cmp rsi, qword ptr [rbp-12104]
+  jne .L.else.main.365
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-12112]
+  mov r9, qword ptr [rbp-12104]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.366
+.L.else.main.365:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-12112]
+  mov r9, qword ptr [rbp-12096]
+  mov r10, qword ptr [rbp-12104]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.366:
+  mov qword ptr [rbp-12072], 5
+  mov dword ptr [rbp-19044], 3
+  mov dword ptr [rbp-19040], 5
+  lea rsi, [rbp-19044]
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-12080], rsi
+  lea rsi, [rip+.L.data.main.99]
+  mov qword ptr [rbp-12088], rsi
+  mov rsi, qword ptr [rbp-12072]
+  cmp rsi, qword ptr [rbp-12080]
+  jne .L.else.main.367
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-12088]
+  mov r9, qword ptr [rbp-12080]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.368
+.L.else.main.367:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-12088]
+  mov r9, qword ptr [rbp-12072]
+  mov r10, qword ptr [rbp-12080]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.368:
+  mov qword ptr [rbp-12048], 3
+  mov dword ptr [rbp-19036], 3
+  mov dword ptr [rbp-19032], 5
+  lea rsi, [rbp-19032]
+  sub rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-12056], rsi
+  lea rsi, [rip+.L.data.main.100]
+  mov qword ptr [rbp-12064], rsi
+  mov rsi, qword ptr [rbp-12048]
+  cmp rsi, qword ptr [rbp-12056]
+  jne .L.else.main.369
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-12064]
+  mov r9, qword ptr [rbp-12056]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.370
+.L.else.main.369:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-12064]
+  mov r9, qword ptr [rbp-12048]
+  mov r10, qword ptr [rbp-12056]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.370:
+  mov qword ptr [rbp-12024], 2
+  mov dword ptr [rbp-19028], 3
+  lea rsi, [rbp-19028]
+  add rsi, 8
+  lea rdi, [rbp-19028]
+  sub rsi, rdi
+  sar rsi, 2
+  mov qword ptr [rbp-12032], rsi
+  lea rsi, [rip+.L.data.main.101]
+  mov qword ptr [rbp-12040], rsi
+  mov rsi, qword ptr [rbp-12024]
+  cmp rsi, qword ptr [rbp-12032]
+  jne .L.else.main.371
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-12040]
+  mov r9, qword ptr [rbp-12032]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.372
+.L.else.main.371:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-12040]
+  mov r9, qword ptr [rbp-12024]
+  mov r10, qword ptr [rbp-12032]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.372:
+  mov qword ptr [rbp-12000], 5
+  mov dword ptr [rbp-19024], 3
+  mov dword ptr [rbp-19020], 5
+  lea rsi, [rbp-19024]
+  mov qword ptr [rbp-19016], rsi
+  mov rsi, qword ptr [rbp-19016]
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-12008], rsi
+  lea rsi, [rip+.L.data.main.102]
+  mov qword ptr [rbp-12016], rsi
+  mov rsi, qword ptr [rbp-12000]
+  cmp rsi, qword ptr [rbp-12008]
+  jne .L.else.main.373
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-12016]
+  mov r9, qword ptr [rbp-12008]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.374
+.L.else.main.373:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-12016]
+  mov r9, qword ptr [rbp-12000]
+  mov r10, qword ptr [rbp-12008]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.374:
+  mov qword ptr [rbp-11976], 3
+  mov dword ptr [rbp-19008], 3
+  mov dword ptr [rbp-19004], 5
+  lea rsi, [rbp-19004]
+  mov qword ptr [rbp-19000], rsi
+  mov rsi, qword ptr [rbp-19000]
+  sub rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-11984], rsi
+  lea rsi, [rip+.L.data.main.103]
+  mov qword ptr [rbp-11992], rsi
+  mov rsi, qword ptr [rbp-11976]
+  cmp rsi, qword ptr [rbp-11984]
+  jne .L.else.main.375
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11992]
+  mov r9, qword ptr [rbp-11984]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.376
+.L.else.main.375:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11992]
+  mov r9, qword ptr [rbp-11976]
+  mov r10, qword ptr [rbp-11984]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.376:
+  mov qword ptr [rbp-11952], 5
+  mov dword ptr [rbp-18988], 3
+  lea rsi, [rbp-18988]
+  mov qword ptr [rbp-18984], rsi
+  mov rsi, qword ptr [rbp-18984]
+  mov dword ptr [rsi], 5
+  movsxd rsi, dword ptr [rbp-18988]
+  mov qword ptr [rbp-11960], rsi
+  lea rsi, [rip+.L.data.main.104]
+  mov qword ptr [rbp-11968], rsi
+  mov rsi, qword ptr [rbp-11952]
+  cmp rsi, qword ptr [rbp-11960]
+  jne .L.else.main.377
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11968]
+  mov r9, qword ptr [rbp-11960]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.378
+.L.else.main.377:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11968]
+  mov r9, qword ptr [rbp-11952]
+  mov r10, qword ptr [rbp-11960]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.378:
+  mov qword ptr [rbp-11928], 7
+  mov dword ptr [rbp-18976], 3
+  mov dword ptr [rbp-18972], 5
+  lea rsi, [rbp-18976]
+  add rsi, 4
+  mov dword ptr [rsi], 7
+  movsxd rsi, dword ptr [rbp-18972]
+  mov qword ptr [rbp-11936], rsi
+  lea rsi, [rip+.L.data.main.105]
+  mov qword ptr [rbp-11944], rsi
+  mov rsi, qword ptr [rbp-11928]
+  cmp rsi, qword ptr [rbp-11936]
+  jne .L.else.main.379
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11944]
+  mov r9, qword ptr [rbp-11936]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.380
+.L.else.main.379:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11944]
+  mov r9, qword ptr [rbp-11928]
+  mov r10, qword ptr [rbp-11936]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.380:
+  mov qword ptr [rbp-11904], 7
+  mov dword ptr [rbp-18968], 3
+  mov dword ptr [rbp-18964], 5
+  lea rsi, [rbp-18964]
+  sub rsi, 4
+  mov dword ptr [rsi], 7
+  movsxd rsi, dword ptr [rbp-18968]
+  mov qword ptr [rbp-11912], rsi
+  lea rsi, [rip+.L.data.main.106]
+  mov qword ptr [rbp-11920], rsi
+  mov rsi, qword ptr [rbp-11904]
+  cmp rsi, qword ptr [rbp-11912]
+  jne .L.else.main.381
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11920]
+  mov r9, qword ptr [rbp-11912]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.382
+.L.else.main.381:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11920]
+  mov r9, qword ptr [rbp-11904]
+  mov r10, qword ptr [rbp-11912]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.382:
+  mov qword ptr [rbp-11864], 8
+  mov dword ptr [rbp-18960], 3
+  mov dword ptr [rbp-18956], 5
+  lea rsi, [rbp-18960]
+  mov qword ptr [rbp-11888], rsi
+  movsxd rsi, dword ptr [rbp-18956]
+  mov dword ptr [rbp-11892], esi
+  mov rsi, qword ptr [rbp-11888]
+  movsxd rsi, dword ptr [rsi]
+  movsxd rdi, dword ptr [rbp-11892]
+  add rsi, rdi
+  movsxd rsi, esi
+  mov qword ptr [rbp-11872], rsi
+  lea rsi, [rip+.L.data.main.107]
+  mov qword ptr [rbp-11880], rsi
+  mov rsi, qword ptr [rbp-11864]
+  cmp rsi, qword ptr [rbp-11872]
+  jne .L.else.main.383
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11880]
+  mov r9, qword ptr [rbp-11872]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.384
+.L.else.main.383:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11880]
+  mov r9, qword ptr [rbp-11864]
+  mov r10, qword ptr [rbp-11872]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.384:
+  mov qword ptr [rbp-11840], 3
+  lea rsi, [rbp-18952]
+  mov qword ptr [rbp-18944], rsi
+  mov rsi, qword ptr [rbp-18944]
+  mov dword ptr [rsi], 3
+  movsxd rsi, dword ptr [rbp-18952]
+  mov qword ptr [rbp-11848], rsi
+  lea rsi, [rip+.L.data.main.108]
+  mov qword ptr [rbp-11856], rsi
+  mov rsi, qword ptr [rbp-11840]
+  cmp rsi, qword ptr [rbp-11848]
+  jne .L.else.main.385
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11856]
+  mov r9, qword ptr [rbp-11848]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.386
+.L.else.main.385:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11856]
+  mov r9, qword ptr [rbp-11840]
+  mov r10, qword ptr [rbp-11848]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.386:
+  mov qword ptr [rbp-11816], 3
+  mov dword ptr [rbp-18932], 3
+  lea rsi, [rbp-18932]
+  add rsi, 4
+  mov dword ptr [rsi], 4
+  lea rsi, [rbp-18932]
+  add rsi, 8
+  mov dword ptr [rsi], 5
+  movsxd rsi, dword ptr [rbp-18932]
+  mov qword ptr [rbp-11824], rsi
+  lea rsi, [rip+.L.data.main.109]
+  mov qword ptr [rbp-11832], rsi
+  mov rsi, qword ptr [rbp-11816]
+  cmp rsi, qword ptr [rbp-11824]
+  jne .L.else.main.387
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11832]
+  mov r9, qword ptr [rbp-11824]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.388
+.L.else.main.387:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11832]
+  mov r9, qword ptr [rbp-11816]
+  mov r10, qword ptr [rbp-11824]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.388:
+  mov qword ptr [rbp-11792], 4
+  mov dword ptr [rbp-18920], 3
+  lea rsi, [rbp-18920]
+  add rsi, 4
+  mov dword ptr [rsi], 4
+  lea rsi, [rbp-18920]
+  add rsi, 8
+  mov dword ptr [rsi], 5
+  lea rsi, [rbp-18920]
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-11800], rsi
+  lea rsi, [rip+.L.data.main.110]
+  mov qword ptr [rbp-11808], rsi
+  mov rsi, qword ptr [rbp-11792]
+  cmp rsi, qword ptr [rbp-11800]
+  jne .L.else.main.389
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11808]
+  mov r9, qword ptr [rbp-11800]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.390
+.L.else.main.389:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11808]
+  mov r9, qword ptr [rbp-11792]
+  mov r10, qword ptr [rbp-11800]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.390:
+  mov qword ptr [rbp-11768], 5
+  mov dword ptr [rbp-18908], 3
+  lea rsi, [rbp-18908]
+  add rsi, 4
+  mov dword ptr [rsi], 4
+  lea rsi, [rbp-18908]
+  add rsi, 8
+  mov dword ptr [rsi], 5
+  lea rsi, [rbp-18908]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-11776], rsi
+  lea rsi, [rip+.L.data.main.111]
+  mov qword ptr [rbp-11784], rsi
+  mov rsi, qword ptr [rbp-11768]
+  cmp rsi, qword ptr [rbp-11776]
+  jne .L.else.main.391
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11784]
+  mov r9, qword ptr [rbp-11776]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.392
+.L.else.main.391:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11784]
+  mov r9, qword ptr [rbp-11768]
+  mov r10, qword ptr [rbp-11776]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.392:
+  mov qword ptr [rbp-11744], 0
+  lea rsi, [rbp-18896]
+  mov qword ptr [rbp-18872], rsi
+  mov rsi, qword ptr [rbp-18872]
+  mov dword ptr [rsi], 0
+  movsxd rsi, dword ptr [rbp-18896]
+  mov qword ptr [rbp-11752], rsi
+  lea rsi, [rip+.L.data.main.112]
+  mov qword ptr [rbp-11760], rsi
+  mov rsi, qword ptr [rbp-11744]
+  cmp rsi, qword ptr [rbp-11752]
+  jne .L.else.main.393
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11760]
+  mov r9, qword ptr [rbp-11752]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.394
+.L.else.main.393:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11760]
+  mov r9, qword ptr [rbp-11744]
+  mov r10, qword ptr [rbp-11752]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.394:
+  mov qword ptr [rbp-11720], 1
+  lea rsi, [rbp-18864]
+  mov qword ptr [rbp-18840], rsi
+  mov rsi, qword ptr [rbp-18840]
+  add rsi, 4
+  mov dword ptr [rsi], 1
+  lea rsi, [rbp-18864]
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-11728], rsi
+  lea rsi, [rip+.L.data.main.113]
+  mov qword ptr [rbp-11736], rsi
+  mov rsi, qword ptr [rbp-11720]
+  cmp rsi, qword ptr [rbp-11728]
+  jne .L.else.main.395
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11736]
+  mov r9, qword ptr [rbp-11728]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.396
+.L.else.main.395:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11736]
+  mov r9, qword ptr [rbp-11720]
+  mov r10, qword ptr [rbp-11728]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.396:
+  mov qword ptr [rbp-11696], 2
+  lea rsi, [rbp-18832]
+  mov qword ptr [rbp-18808], rsi
+  mov rsi, qword ptr [rbp-18808]
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  lea rsi, [rbp-18832]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-11704], rsi
+  lea rsi, [rip+.L.data.main.114]
+  mov qword ptr [rbp-11712], rsi
+  mov rsi, qword ptr [rbp-11696]
+  cmp rsi, qword ptr [rbp-11704]
+  jne .L.else.main.397
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11712]
+  mov r9, qword ptr [rbp-11704]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.398
+.L.else.main.397:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11712]
+  mov r9, qword ptr [rbp-11696]
+  mov r10, qword ptr [rbp-11704]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.398:
+  mov qword ptr [rbp-11672], 3
+  lea rsi, [rbp-18800]
+  mov qword ptr [rbp-18776], rsi
+  mov rsi, qword ptr [rbp-18776]
+  add rsi, 12
+  mov dword ptr [rsi], 3
+  lea rsi, [rbp-18800]
+  add rsi, 12
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-11680], rsi
+  lea rsi, [rip+.L.data.main.115]
+  mov qword ptr [rbp-11688], rsi
+  mov rsi, qword ptr [rbp-11672]
+  cmp rsi, qword ptr [rbp-11680]
+  jne .L.else.main.399
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11688]
+  mov r9, qword ptr [rbp-11680]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.400
+.L.else.main.399:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11688]
+  mov r9, qword ptr [rbp-11672]
+  mov r10, qword ptr [rbp-11680]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.400:
+  mov qword ptr [rbp-11648], 4
+  lea rsi, [rbp-18768]
+  mov qword ptr [rbp-18744], rsi
+  mov rsi, qword ptr [rbp-18744]
+  add rsi, 16
+  mov dword ptr [rsi], 4
+  lea rsi, [rbp-18768]
+  add rsi, 12
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-11656], rsi
+  lea rsi, [rip+.L.data.main.116]
+  mov qword ptr [rbp-11664], rsi
+  mov rsi, qword ptr [rbp-11648]
+  cmp rsi, qword ptr [rbp-11656]
+  jne .L.else.main.401
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11664]
+  mov r9, qword ptr [rbp-11656]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.402
+.L.else.main.401:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11664]
+  mov r9, qword ptr [rbp-11648]
+  mov r10, qword ptr [rbp-11656]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.402:
+  mov qword ptr [rbp-11624], 5
+  lea rsi, [rbp-18736]
+  mov qword ptr [rbp-18712], rsi
+  mov rsi, qword ptr [rbp-18712]
+  add rsi, 20
+  mov dword ptr [rsi], 5
+  lea rsi, [rbp-18736]
+  add rsi, 12
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-11632], rsi
+  lea rsi, [rip+.L.data.main.117]
+  mov qword ptr [rbp-11640], rsi
+  mov rsi, qword ptr [rbp-11624]
+  cmp rsi, qword ptr [rbp-11632]
+  jne .L.else.main.403
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11640]
+  mov r9, qword ptr [rbp-11632]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.404
+.L.else.main.403:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11640]
+  mov r9, qword ptr [rbp-11624]
+  mov r10, qword ptr [rbp-11632]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.404:
+  mov qword ptr [rbp-11600], 6
+  lea rsi, [rbp-18704]
+  mov qword ptr [rbp-18680], rsi
+  mov rsi, qword ptr [rbp-18680]
+  add rsi, 24
+  mov dword ptr [rsi], 6
+  lea rsi, [rbp-18704]
+  add rsi, 24
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-11608], rsi
+  lea rsi, [rip+.L.data.main.118]
+  mov qword ptr [rbp-11616], rsi
+  mov rsi, qword ptr [rbp-11600]
+  cmp rsi, qword ptr [rbp-11608]
+  jne .L.else.main.405
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11616]
+  mov r9, qword ptr [rbp-11608]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.406
+.L.else.main.405:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11616]
+  mov r9, qword ptr [rbp-11600]
+  mov r10, qword ptr [rbp-11608]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.406:
+  mov qword ptr [rbp-11576], 3
+  mov dword ptr [rbp-18668], 3
+  lea rsi, [rbp-18668]
+  add rsi, 4
+  mov dword ptr [rsi], 4
+  lea rsi, [rbp-18668]
+  add rsi, 8
+  mov dword ptr [rsi], 5
+  movsxd rsi, dword ptr [rbp-18668]
+  mov qword ptr [rbp-11584], rsi
+  lea rsi, [rip+.L.data.main.119]
+  mov qword ptr [rbp-11592], rsi
+  mov rsi, qword ptr [rbp-11576]
+  cmp rsi, qword ptr [rbp-11584]
+  jne .L.else.main.407
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11592]
+  mov r9, qword ptr [rbp-11584]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.408
+.L.else.main.407:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11592]
+  mov r9, qword ptr [rbp-11576]
+  mov r10, qword ptr [rbp-11584]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.408:
+  mov qword ptr [rbp-11552], 4
+  mov dword ptr [rbp-18656], 3
+  lea rsi, [rbp-18656]
+  add rsi, 4
+  mov dword ptr [rsi], 4
+  lea rsi, [rbp-18656]
+  add rsi, 8
+  mov dword ptr [rsi], 5
+  lea rsi, [rbp-18656]
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-11560], rsi
+  lea rsi, [rip+.L.data.main.120]
+  mov qword ptr [rbp-11568], rsi
+  mov rsi, qword ptr [rbp-11552]
+  cmp rsi, qword ptr [rbp-11560]
+  jne .L.else.main.409
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11568]
+  mov r9, qword ptr [rbp-11560]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.410
+.L.else.main.409:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11568]
+  mov r9, qword ptr [rbp-11552]
+  mov r10, qword ptr [rbp-11560]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.410:
+  mov qword ptr [rbp-11528], 5
+  mov dword ptr [rbp-18644], 3
+  lea rsi, [rbp-18644]
+  add rsi, 4
+  mov dword ptr [rsi], 4
+  lea rsi, [rbp-18644]
+  add rsi, 8
+  mov dword ptr [rsi], 5
+  lea rsi, [rbp-18644]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-11536], rsi
+  lea rsi, [rip+.L.data.main.121]
+  mov qword ptr [rbp-11544], rsi
+  mov rsi, qword ptr [rbp-11528]
+  cmp rsi, qword ptr [rbp-11536]
+  jne .L.else.main.411
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11544]
+  mov r9, qword ptr [rbp-11536]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.412
+.L.else.main.411:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11544]
+  mov r9, qword ptr [rbp-11528]
+  mov r10, qword ptr [rbp-11536]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.412:
+  mov qword ptr [rbp-11504], 5
+  mov dword ptr [rbp-18632], 3
+  lea rsi, [rbp-18632]
+  add rsi, 4
+  mov dword ptr [rsi], 4
+  lea rsi, [rbp-18632]
+  add rsi, 8
+  mov dword ptr [rsi], 5
+  lea rsi, [rbp-18632]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-11512], rsi
+  lea rsi, [rip+.L.data.main.122]
+  mov qword ptr [rbp-11520], rsi
+  mov rsi, qword ptr [rbp-11504]
+  cmp rsi, qword ptr [rbp-11512]
+  jne .L.else.main.413
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11520]
+  mov r9, qword ptr [rbp-11512]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.414
+.L.else.main.413:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11520]
+  mov r9, qword ptr [rbp-11504]
+  mov r10, qword ptr [rbp-11512]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.414:
+  mov qword ptr [rbp-11480], 5
+  mov dword ptr [rbp-18620], 3
+  lea rsi, [rbp-18620]
+  add rsi, 4
+  mov dword ptr [rsi], 4
+  lea rsi, [rbp-18620]
+  add rsi, 8
+  mov dword ptr [rsi], 5
+  lea rsi, [rbp-18620]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-11488], rsi
+  lea rsi, [rip+.L.data.main.123]
+  mov qword ptr [rbp-11496], rsi
+  mov rsi, qword ptr [rbp-11480]
+  cmp rsi, qword ptr [rbp-11488]
+  jne .L.else.main.415
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11496]
+  mov r9, qword ptr [rbp-11488]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.416
+.L.else.main.415:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11496]
+  mov r9, qword ptr [rbp-11480]
+  mov r10, qword ptr [rbp-11488]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.416:
+  mov qword ptr [rbp-11456], 0
+  lea rsi, [rbp-18608]
+  mov qword ptr [rbp-18584], rsi
+  mov rsi, qword ptr [rbp-18584]
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rbp-18608]
+  add rsi, 0
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-11464], rsi
+  lea rsi, [rip+.L.data.main.124]
+  mov qword ptr [rbp-11472], rsi
+  mov rsi, qword ptr [rbp-11456]
+  cmp rsi, qword ptr [rbp-11464]
+  jne .L.else.main.417
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11472]
+  mov r9, qword ptr [rbp-11464]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.418
+.L.else.main.417:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11472]
+  mov r9, qword ptr [rbp-11456]
+  mov r10, qword ptr [rbp-11464]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.418:
+  mov qword ptr [rbp-11432], 1
+  lea rsi, [rbp-18576]
+  mov qword ptr [rbp-18552], rsi
+  mov rsi, qword ptr [rbp-18552]
+  add rsi, 4
+  mov dword ptr [rsi], 1
+  lea rsi, [rbp-18576]
+  add rsi, 0
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-11440], rsi
+  lea rsi, [rip+.L.data.main.125]
+  mov qword ptr [rbp-11448], rsi
+  mov rsi, qword ptr [rbp-11432]
+  cmp rsi, qword ptr [rbp-11440]
+  jne .L.else.main.419
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11448]
+  mov r9, qword ptr [rbp-11440]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.420
+.L.else.main.419:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11448]
+  mov r9, qword ptr [rbp-11432]
+  mov r10, qword ptr [rbp-11440]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.420:
+  mov qword ptr [rbp-11408], 2
+  lea rsi, [rbp-18544]
+  mov qword ptr [rbp-18520], rsi
+  mov rsi, qword ptr [rbp-18520]
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  lea rsi, [rbp-18544]
+  add rsi, 0
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-11416], rsi
+  lea rsi, [rip+.L.data.main.126]
+  mov qword ptr [rbp-11424], rsi
+  mov rsi, qword ptr [rbp-11408]
+  cmp rsi, qword ptr [rbp-11416]
+  jne .L.else.main.421
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11424]
+  mov r9, qword ptr [rbp-11416]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.422
+.L.else.main.421:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11424]
+  mov r9, qword ptr [rbp-11408]
+  mov r10, qword ptr [rbp-11416]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.422:
+  mov qword ptr [rbp-11384], 3
+  lea rsi, [rbp-18512]
+  mov qword ptr [rbp-18488], rsi
+  mov rsi, qword ptr [rbp-18488]
+  add rsi, 12
+  mov dword ptr [rsi], 3
+  lea rsi, [rbp-18512]
+  add rsi, 12
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-11392], rsi
+  lea rsi, [rip+.L.data.main.127]
+  mov qword ptr [rbp-11400], rsi
+  mov rsi, qword ptr [rbp-11384]
+  cmp rsi, qword ptr [rbp-11392]
+  jne .L.else.main.423
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11400]
+  mov r9, qword ptr [rbp-11392]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.424
+.L.else.main.423:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11400]
+  mov r9, qword ptr [rbp-11384]
+  mov r10, qword ptr [rbp-11392]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.424:
+  mov qword ptr [rbp-11360], 4
+  lea rsi, [rbp-18480]
+  mov qword ptr [rbp-18456], rsi
+  mov rsi, qword ptr [rbp-18456]
+  add rsi, 16
+  mov dword ptr [rsi], 4
+  lea rsi, [rbp-18480]
+  add rsi, 12
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-11368], rsi
+  lea rsi, [rip+.L.data.main.128]
+  mov qword ptr [rbp-11376], rsi
+  mov rsi, qword ptr [rbp-11360]
+  cmp rsi, qword ptr [rbp-11368]
+  jne .L.else.main.425
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11376]
+  mov r9, qword ptr [rbp-11368]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.426
+.L.else.main.425:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11376]
+  mov r9, qword ptr [rbp-11360]
+  mov r10, qword ptr [rbp-11368]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.426:
+  mov qword ptr [rbp-11336], 5
+  lea rsi, [rbp-18448]
+  mov qword ptr [rbp-18424], rsi
+  mov rsi, qword ptr [rbp-18424]
+  add rsi, 20
+  mov dword ptr [rsi], 5
+  lea rsi, [rbp-18448]
+  add rsi, 12
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-11344], rsi
+  lea rsi, [rip+.L.data.main.129]
+  mov qword ptr [rbp-11352], rsi
+  mov rsi, qword ptr [rbp-11336]
+  cmp rsi, qword ptr [rbp-11344]
+  jne .L.else.main.427
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11352]
+  mov r9, qword ptr [rbp-11344]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.428
+.L.else.main.427:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11352]
+  mov r9, qword ptr [rbp-11336]
+  mov r10, qword ptr [rbp-11344]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.428:
+  mov qword ptr [rbp-11312], 6
+  lea rsi, [rbp-18416]
+  mov qword ptr [rbp-18392], rsi
+  mov rsi, qword ptr [rbp-18392]
+  add rsi, 24
+  mov dword ptr [rsi], 6
+  lea rsi, [rbp-18416]
+  add rsi, 24
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-11320], rsi
+  lea rsi, [rip+.L.data.main.130]
+  mov qword ptr [rbp-11328], rsi
+  mov rsi, qword ptr [rbp-11312]
+  cmp rsi, qword ptr [rbp-11320]
+  jne .L.else.main.429
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11328]
+  mov r9, qword ptr [rbp-11320]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.430
+.L.else.main.429:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11328]
+  mov r9, qword ptr [rbp-11312]
+  mov r10, qword ptr [rbp-11320]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.430:
+  mov qword ptr [rbp-11288], 4
+  mov qword ptr [rbp-11296], 4
+  lea rsi, [rip+.L.data.main.131]
+  mov qword ptr [rbp-11304], rsi
+  mov rsi, qword ptr [rbp-11288]
+  cmp rsi, qword ptr [rbp-11296]
+  jne .L.else.main.431
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11304]
+  mov r9, qword ptr [rbp-11296]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.432
+.L.else.main.431:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11304]
+  mov r9, qword ptr [rbp-11288]
+  mov r10, qword ptr [rbp-11296]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.432:
+  mov qword ptr [rbp-11264], 4
+  mov qword ptr [rbp-11272], 4
+  lea rsi, [rip+.L.data.main.132]
+  mov qword ptr [rbp-11280], rsi
+  mov rsi, qword ptr [rbp-11264]
+  cmp rsi, qword ptr [rbp-11272]
+  jne .L.else.main.433
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11280]
+  mov r9, qword ptr [rbp-11272]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.434
+.L.else.main.433:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11280]
+  mov r9, qword ptr [rbp-11264]
+  mov r10, qword ptr [rbp-11272]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.434:
+  mov qword ptr [rbp-11240], 8
+  mov qword ptr [rbp-11248], 8
+  lea rsi, [rip+.L.data.main.133]
+  mov qword ptr [rbp-11256], rsi
+  mov rsi, qword ptr [rbp-11240]
+  cmp rsi, qword ptr [rbp-11248]
+  jne .L.else.main.435
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11256]
+  mov r9, qword ptr [rbp-11248]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.436
+.L.else.main.435:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11256]
+  mov r9, qword ptr [rbp-11240]
+  mov r10, qword ptr [rbp-11248]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.436:
+  mov qword ptr [rbp-11216], 16
+  mov qword ptr [rbp-11224], 16
+  lea rsi, [rip+.L.data.main.134]
+  mov qword ptr [rbp-11232], rsi
+  mov rsi, qword ptr [rbp-11216]
+  cmp rsi, qword ptr [rbp-11224]
+  jne .L.else.main.437
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11232]
+  mov r9, qword ptr [rbp-11224]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.438
+.L.else.main.437:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11232]
+  mov r9, qword ptr [rbp-11216]
+  mov r10, qword ptr [rbp-11224]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.438:
+  mov qword ptr [rbp-11192], 48
+  mov qword ptr [rbp-11200], 48
+  lea rsi, [rip+.L.data.main.135]
+  mov qword ptr [rbp-11208], rsi
+  mov rsi, qword ptr [rbp-11192]
+  cmp rsi, qword ptr [rbp-11200]
+  jne .L.else.main.439
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11208]
+  mov r9, qword ptr [rbp-11200]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.440
+.L.else.main.439:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11208]
+  mov r9, qword ptr [rbp-11192]
+  mov r10, qword ptr [rbp-11200]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.440:
+  mov qword ptr [rbp-11168], 16
+  mov qword ptr [rbp-11176], 16
+  lea rsi, [rip+.L.data.main.136]
+  mov qword ptr [rbp-11184], rsi
+  mov rsi, qword ptr [rbp-11168]
+  cmp rsi, qword ptr [rbp-11176]
+  jne .L.else.main.441
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11184]
+  mov r9, qword ptr [rbp-11176]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.442
+.L.else.main.441:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11184]
+  mov r9, qword ptr [rbp-11168]
+  mov r10, qword ptr [rbp-11176]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.442:
+  mov qword ptr [rbp-11144], 4
+  mov qword ptr [rbp-11152], 4
+  lea rsi, [rip+.L.data.main.137]
+  mov qword ptr [rbp-11160], rsi
+  mov rsi, qword ptr [rbp-11144]
+  cmp rsi, qword ptr [rbp-11152]
+  jne .L.else.main.443
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11160]
+  mov r9, qword ptr [rbp-11152]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.444
+.L.else.main.443:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11160]
+  mov r9, qword ptr [rbp-11144]
+  mov r10, qword ptr [rbp-11152]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.444:
+  mov qword ptr [rbp-11120], 5
+  mov rsi, 4
+  add rsi, 1
+  mov qword ptr [rbp-11128], rsi
+  lea rsi, [rip+.L.data.main.138]
+  mov qword ptr [rbp-11136], rsi
+  mov rsi, qword ptr [rbp-11120]
+  cmp rsi, qword ptr [rbp-11128]
+  jne .L.else.main.445
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11136]
+  mov r9, qword ptr [rbp-11128]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.446
+.L.else.main.445:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11136]
+  mov r9, qword ptr [rbp-11120]
+  mov r10, qword ptr [rbp-11128]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.446:
+  mov qword ptr [rbp-11096], 5
+  mov rsi, 4
+  add rsi, 1
+  mov qword ptr [rbp-11104], rsi
+  lea rsi, [rip+.L.data.main.139]
+  mov qword ptr [rbp-11112], rsi
+  mov rsi, qword ptr [rbp-11096]
+  cmp rsi, qword ptr [rbp-11104]
+  jne .L.else.main.447
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11112]
+  mov r9, qword ptr [rbp-11104]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.448
+.L.else.main.447:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11112]
+  mov r9, qword ptr [rbp-11096]
+  mov r10, qword ptr [rbp-11104]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.448:
+  mov qword ptr [rbp-11072], 8
+  mov qword ptr [rbp-11080], 8
+  lea rsi, [rip+.L.data.main.140]
+  mov qword ptr [rbp-11088], rsi
+  mov rsi, qword ptr [rbp-11072]
+  cmp rsi, qword ptr [rbp-11080]
+  jne .L.else.main.449
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11088]
+  mov r9, qword ptr [rbp-11080]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.450
+.L.else.main.449:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11088]
+  mov r9, qword ptr [rbp-11072]
+  mov r10, qword ptr [rbp-11080]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.450:
+  mov qword ptr [rbp-11048], 0
+  movsxd rsi, dword ptr [rip+g1]
+  mov qword ptr [rbp-11056], rsi
+  lea rsi, [rip+.L.data.main.141]
+  mov qword ptr [rbp-11064], rsi
+  mov rsi, qword ptr [rbp-11048]
+  cmp rsi, qword ptr [rbp-11056]
+  jne .L.else.main.451
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11064]
+  mov r9, qword ptr [rbp-11056]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.452
+.L.else.main.451:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11064]
+  mov r9, qword ptr [rbp-11048]
+  mov r10, qword ptr [rbp-11056]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.452:
+  mov dword ptr [rip+g1], 3
+  mov qword ptr [rbp-11024], 3
+  movsxd rsi, dword ptr [rip+g1]
+  mov qword ptr [rbp-11032], rsi
+  lea rsi, [rip+.L.data.main.142]
+  mov qword ptr [rbp-11040], rsi
+  mov rsi, qword ptr [rbp-11024]
+  cmp rsi, qword ptr [rbp-11032]
+  jne .L.else.main.453
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11040]
+  mov r9, qword ptr [rbp-11032]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.454
+.L.else.main.453:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11040]
+  mov r9, qword ptr [rbp-11024]
+  mov r10, qword ptr [rbp-11032]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.454:
+  lea rsi, [rip+g2]
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rip+g2]
+  add rsi, 4
+  mov dword ptr [rsi], 1
+  lea rsi, [rip+g2]
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  lea rsi, [rip+g2]
+  add rsi, 12
+  mov dword ptr [rsi], 3
+  mov qword ptr [rbp-11000], 0
+  lea rsi, [rip+g2]
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-11008], rsi
+  lea rsi, [rip+.L.data.main.143]
+  mov qword ptr [rbp-11016], rsi
+  mov rsi, qword ptr [rbp-11000]
+  cmp rsi, qword ptr [rbp-11008]
+  jne .L.else.main.455
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-11016]
+  mov r9, qword ptr [rbp-11008]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.456
+.L.else.main.455:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-11016]
+  mov r9, qword ptr [rbp-11000]
+  mov r10, qword ptr [rbp-11008]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.456:
+  mov qword ptr [rbp-10976], 1
+  lea rsi, [rip+g2]
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-10984], rsi
+  lea rsi, [rip+.L.data.main.144]
+  mov qword ptr [rbp-10992], rsi
+  mov rsi, qword ptr [rbp-10976]
+  cmp rsi, qword ptr [rbp-10984]
+  jne .L.else.main.457
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10992]
+  mov r9, qword ptr [rbp-10984]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.458
+.L.else.main.457:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10992]
+  mov r9, qword ptr [rbp-10976]
+  mov r10, qword ptr [rbp-10984]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.458:
+  mov qword ptr [rbp-10952], 2
+  lea rsi, [rip+g2]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-10960], rsi
+  lea rsi, [rip+.L.data.main.145]
+  mov qword ptr [rbp-10968], rsi
+  mov rsi, qword ptr [rbp-10952]
+  cmp rsi, qword ptr [rbp-10960]
+  jne .L.else.main.459
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10968]
+  mov r9, qword ptr [rbp-10960]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.460
+.L.else.main.459:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10968]
+  mov r9, qword ptr [rbp-10952]
+  mov r10, qword ptr [rbp-10960]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.460:
+  mov qword ptr [rbp-10928], 3
+  lea rsi, [rip+g2]
+  add rsi, 12
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-10936], rsi
+  lea rsi, [rip+.L.data.main.146]
+  mov qword ptr [rbp-10944], rsi
+  mov rsi, qword ptr [rbp-10928]
+  cmp rsi, qword ptr [rbp-10936]
+  jne .L.else.main.461
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10944]
+  mov r9, qword ptr [rbp-10936]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.462
+.L.else.main.461:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10944]
+  mov r9, qword ptr [rbp-10928]
+  mov r10, qword ptr [rbp-10936]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.462:
+  mov qword ptr [rbp-10904], 4
+  mov qword ptr [rbp-10912], 4
+  lea rsi, [rip+.L.data.main.147]
+  mov qword ptr [rbp-10920], rsi
+  mov rsi, qword ptr [rbp-10904]
+  cmp rsi, qword ptr [rbp-10912]
+  jne .L.else.main.463
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10920]
+  mov r9, qword ptr [rbp-10912]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.464
+.L.else.main.463:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10920]
+  mov r9, qword ptr [rbp-10904]
+  mov r10, qword ptr [rbp-10912]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.464:
+  mov qword ptr [rbp-10880], 16
+  mov qword ptr [rbp-10888], 16
+  lea rsi, [rip+.L.data.main.148]
+  mov qword ptr [rbp-10896], rsi
+  mov rsi, qword ptr [rbp-10880]
+  cmp rsi, qword ptr [rbp-10888]
+  jne .L.else.main.465
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10896]
+  mov r9, qword ptr [rbp-10888]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.466
+.L.else.main.465:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10896]
+  mov r9, qword ptr [rbp-10880]
+  mov r10, qword ptr [rbp-10888]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.466:
+  mov qword ptr [rbp-10856], 1
+  mov byte ptr [rbp-18060], 1
+  movsx rsi, byte ptr [rbp-18060]
+  mov qword ptr [rbp-10864], rsi
+  lea rsi, [rip+.L.data.main.149]
+  mov qword ptr [rbp-10872], rsi
+  mov rsi, qword ptr [rbp-10856]
+  cmp rsi, qword ptr [rbp-10864]
+  jne .L.else.main.467
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10872]
+  mov r9, qword ptr [rbp-10864]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.468
+.L.else.main.467:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10872]
+  mov r9, qword ptr [rbp-10856]
+  mov r10, qword ptr [rbp-10864]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.468:
+  mov qword ptr [rbp-10832], 1
+  mov byte ptr [rbp-18059], 1
+  mov byte ptr [rbp-18058], 2
+  movsx rsi, byte ptr [rbp-18059]
+  mov qword ptr [rbp-10840], rsi
+  lea rsi, [rip+.L.data.main.150]
+  mov qword ptr [rbp-10848], rsi
+  mov rsi, qword ptr [rbp-10832]
+  cmp rsi, qword ptr [rbp-10840]
+  jne .L.else.main.469
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10848]
+  mov r9, qword ptr [rbp-10840]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.470
+.L.else.main.469:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10848]
+  mov r9, qword ptr [rbp-10832]
+  mov r10, qword ptr [rbp-10840]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.470:
+  mov qword ptr [rbp-10808], 2
+  mov byte ptr [rbp-18057], 1
+  mov byte ptr [rbp-18056], 2
+  movsx rsi, byte ptr [rbp-18056]
+  mov qword ptr [rbp-10816], rsi
+  lea rsi, [rip+.L.data.main.151]
+  mov qword ptr [rbp-10824], rsi
+  mov rsi, qword ptr [rbp-10808]
+  cmp rsi, qword ptr [rbp-10816]
+  jne .L.else.main.471
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10824]
+  mov r9, qword ptr [rbp-10816]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.472
+.L.else.main.471:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10824]
+  mov r9, qword ptr [rbp-10808]
+  mov r10, qword ptr [rbp-10816]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.472:
+  mov qword ptr [rbp-10784], 1
+  mov qword ptr [rbp-10792], 1
+  lea rsi, [rip+.L.data.main.152]
+  mov qword ptr [rbp-10800], rsi
+  mov rsi, qword ptr [rbp-10784]
+  cmp rsi, qword ptr [rbp-10792]
+  jne .L.else.main.473
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10800]
+  mov r9, qword ptr [rbp-10792]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.474
+.L.else.main.473:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10800]
+  mov r9, qword ptr [rbp-10784]
+  mov r10, qword ptr [rbp-10792]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.474:
+  mov qword ptr [rbp-10760], 10
+  mov qword ptr [rbp-10768], 10
+  lea rsi, [rip+.L.data.main.153]
+  mov qword ptr [rbp-10776], rsi
+  mov rsi, qword ptr [rbp-10760]
+  cmp rsi, qword ptr [rbp-10768]
+  jne .L.else.main.475
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10776]
+  mov r9, qword ptr [rbp-10768]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.476
+.L.else.main.475:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10776]
+  mov r9, qword ptr [rbp-10760]
+  mov r10, qword ptr [rbp-10768]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.476:
+  mov qword ptr [rbp-10728], 1
+  mov byte ptr [rbp-10745], 7
+  mov byte ptr [rbp-10746], 3
+  mov byte ptr [rbp-10747], 3
+  movsx rsi, byte ptr [rbp-10745]
+  movsx rdi, byte ptr [rbp-10746]
+  sub rsi, rdi
+  movsx rdi, byte ptr [rbp-10747]
+  sub rsi, rdi
+  movsxd rsi, esi
+  mov qword ptr [rbp-10736], rsi
+  lea rsi, [rip+.L.data.main.154]
+  mov qword ptr [rbp-10744], rsi
+  mov rsi, qword ptr [rbp-10728]
+  cmp rsi, qword ptr [rbp-10736]
+  jne .L.else.main.477
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10744]
+  mov r9, qword ptr [rbp-10736]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.478
+.L.else.main.477:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10744]
+  mov r9, qword ptr [rbp-10728]
+  mov r10, qword ptr [rbp-10736]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.478:
+  mov qword ptr [rbp-10704], 97
+  lea rsi, [rip+.L.data.main.155]
+  add rsi, 0
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rbp-10712], rsi
+  lea rsi, [rip+.L.data.main.156]
+  mov qword ptr [rbp-10720], rsi
+  mov rsi, qword ptr [rbp-10704]
+  cmp rsi, qword ptr [rbp-10712]
+  jne .L.else.main.479
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10720]
+  mov r9, qword ptr [rbp-10712]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.480
+.L.else.main.479:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10720]
+  mov r9, qword ptr [rbp-10704]
+  mov r10, qword ptr [rbp-10712]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.480:
+  mov qword ptr [rbp-10680], 98
+  lea rsi, [rip+.L.data.main.157]
+  add rsi, 1
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rbp-10688], rsi
+  lea rsi, [rip+.L.data.main.158]
+  mov qword ptr [rbp-10696], rsi
+  mov rsi, qword ptr [rbp-10680]
+  cmp rsi, qword ptr [rbp-10688]
+  jne .L.else.main.481
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10696]
+  mov r9, qword ptr [rbp-10688]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.482
+.L.else.main.481:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10696]
+  mov r9, qword ptr [rbp-10680]
+  mov r10, qword ptr [rbp-10688]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.482:
+  mov qword ptr [rbp-10656], 99
+  lea rsi, [rip+.L.data.main.159]
+  add rsi, 2
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rbp-10664], rsi
+  lea rsi, [rip+.L.data.main.160]
+  mov qword ptr [rbp-10672], rsi
+  mov rsi, qword ptr [rbp-10656]
+  cmp rsi, qword ptr [rbp-10664]
+  jne .L.else.main.483
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10672]
+  mov r9, qword ptr [rbp-10664]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.484
+.L.else.main.483:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10672]
+  mov r9, qword ptr [rbp-10656]
+  mov r10, qword ptr [rbp-10664]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.484:
+  mov qword ptr [rbp-10632], 0
+  lea rsi, [rip+.L.data.main.161]
+  add rsi, 3
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rbp-10640], rsi
+  lea rsi, [rip+.L.data.main.162]
+  mov qword ptr [rbp-10648], rsi
+  mov rsi, qword ptr [rbp-10632]
+  cmp rsi, qword ptr [rbp-10640]
+  jne .L.else.main.485
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10648]
+  mov r9, qword ptr [rbp-10640]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.486
+.L.else.main.485:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10648]
+  mov r9, qword ptr [rbp-10632]
+  mov r10, qword ptr [rbp-10640]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.486:
+  mov qword ptr [rbp-10608], 4
+  mov qword ptr [rbp-10616], 4
+  lea rsi, [rip+.L.data.main.164]
+  mov qword ptr [rbp-10624], rsi
+  mov rsi, qword ptr [rbp-10608]
+  cmp rsi, qword ptr [rbp-10616]
+  jne .L.else.main.487
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10624]
+  mov r9, qword ptr [rbp-10616]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.488
+.L.else.main.487:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10624]
+  mov r9, qword ptr [rbp-10608]
+  mov r10, qword ptr [rbp-10616]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.488:
+  mov qword ptr [rbp-10584], 7
+  lea rsi, [rip+.L.data.main.165]
+  add rsi, 0
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rbp-10592], rsi
+  lea rsi, [rip+.L.data.main.166]
+  mov qword ptr [rbp-10600], rsi
+  mov rsi, qword ptr [rbp-10584]
+  cmp rsi, qword ptr [rbp-10592]
+  jne .L.else.main.489
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10600]
+  mov r9, qword ptr [rbp-10592]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.490
+.L.else.main.489:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10600]
+  mov r9, qword ptr [rbp-10584]
+  mov r10, qword ptr [rbp-10592]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.490:
+  mov qword ptr [rbp-10560], 8
+  lea rsi, [rip+.L.data.main.167]
+  add rsi, 0
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rbp-10568], rsi
+  lea rsi, [rip+.L.data.main.168]
+  mov qword ptr [rbp-10576], rsi
+  mov rsi, qword ptr [rbp-10560]
+  cmp rsi, qword ptr [rbp-10568]
+  jne .L.else.main.491
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10576]
+  mov r9, qword ptr [rbp-10568]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.492
+.L.else.main.491:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10576]
+  mov r9, qword ptr [rbp-10560]
+  mov r10, qword ptr [rbp-10568]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.492:
+  mov qword ptr [rbp-10536], 9
+  lea rsi, [rip+.L.data.main.169]
+  add rsi, 0
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rbp-10544], rsi
+  lea rsi, [rip+.L.data.main.170]
+  mov qword ptr [rbp-10552], rsi
+  mov rsi, qword ptr [rbp-10536]
+  cmp rsi, qword ptr [rbp-10544]
+  jne .L.else.main.493
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10552]
+  mov r9, qword ptr [rbp-10544]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.494
+.L.else.main.493:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10552]
+  mov r9, qword ptr [rbp-10536]
+  mov r10, qword ptr [rbp-10544]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.494:
+  mov qword ptr [rbp-10512], 10
+  lea rsi, [rip+.L.data.main.171]
+  add rsi, 0
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rbp-10520], rsi
+  lea rsi, [rip+.L.data.main.172]
+  mov qword ptr [rbp-10528], rsi
+  mov rsi, qword ptr [rbp-10512]
+  cmp rsi, qword ptr [rbp-10520]
+  jne .L.else.main.495
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10528]
+  mov r9, qword ptr [rbp-10520]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.496
+.L.else.main.495:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10528]
+  mov r9, qword ptr [rbp-10512]
+  mov r10, qword ptr [rbp-10520]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.496:
+  mov qword ptr [rbp-10488], 11
+  lea rsi, [rip+.L.data.main.173]
+  add rsi, 0
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rbp-10496], rsi
+  lea rsi, [rip+.L.data.main.174]
+  mov qword ptr [rbp-10504], rsi
+  mov rsi, qword ptr [rbp-10488]
+  cmp rsi, qword ptr [rbp-10496]
+  jne .L.else.main.497
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10504]
+  mov r9, qword ptr [rbp-10496]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.498
+.L.else.main.497:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10504]
+  mov r9, qword ptr [rbp-10488]
+  mov r10, qword ptr [rbp-10496]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.498:
+  mov qword ptr [rbp-10464], 12
+  lea rsi, [rip+.L.data.main.175]
+  add rsi, 0
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rbp-10472], rsi
+  lea rsi, [rip+.L.data.main.176]
+  mov qword ptr [rbp-10480], rsi
+  mov rsi, qword ptr [rbp-10464]
+  cmp rsi, qword ptr [rbp-10472]
+  jne .L.else.main.499
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10480]
+  mov r9, qword ptr [rbp-10472]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.500
+.L.else.main.499:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10480]
+  mov r9, qword ptr [rbp-10464]
+  mov r10, qword ptr [rbp-10472]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.500:
+  mov qword ptr [rbp-10440], 13
+  lea rsi, [rip+.L.data.main.177]
+  add rsi, 0
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rbp-10448], rsi
+  lea rsi, [rip+.L.data.main.178]
+  mov qword ptr [rbp-10456], rsi
+  mov rsi, qword ptr [rbp-10440]
+  cmp rsi, qword ptr [rbp-10448]
+  jne .L.else.main.501
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10456]
+  mov r9, qword ptr [rbp-10448]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.502
+.L.else.main.501:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10456]
+  mov r9, qword ptr [rbp-10440]
+  mov r10, qword ptr [rbp-10448]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.502:
+  mov qword ptr [rbp-10416], 27
+  lea rsi, [rip+.L.data.main.179]
+  add rsi, 0
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rbp-10424], rsi
+  lea rsi, [rip+.L.data.main.180]
+  mov qword ptr [rbp-10432], rsi
+  mov rsi, qword ptr [rbp-10416]
+  cmp rsi, qword ptr [rbp-10424]
+  jne .L.else.main.503
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10432]
+  mov r9, qword ptr [rbp-10424]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.504
+.L.else.main.503:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10432]
+  mov r9, qword ptr [rbp-10416]
+  mov r10, qword ptr [rbp-10424]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.504:
+  mov qword ptr [rbp-10392], 0
+  lea rsi, [rip+.L.data.main.181]
+  add rsi, 0
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rbp-10400], rsi
+  lea rsi, [rip+.L.data.main.182]
+  mov qword ptr [rbp-10408], rsi
+  mov rsi, qword ptr [rbp-10392]
+  cmp rsi, qword ptr [rbp-10400]
+  jne .L.else.main.505
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10408]
+  mov r9, qword ptr [rbp-10400]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.506
+.L.else.main.505:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10408]
+  mov r9, qword ptr [rbp-10392]
+  mov r10, qword ptr [rbp-10400]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.506:
+  mov qword ptr [rbp-10368], 106
+  lea rsi, [rip+.L.data.main.183]
+  add rsi, 0
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rbp-10376], rsi
+  lea rsi, [rip+.L.data.main.184]
+  mov qword ptr [rbp-10384], rsi
+  mov rsi, qword ptr [rbp-10368]
+  cmp rsi, qword ptr [rbp-10376]
+  jne .L.else.main.507
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10384]
+  mov r9, qword ptr [rbp-10376]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.508
+.L.else.main.507:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10384]
+  mov r9, qword ptr [rbp-10368]
+  mov r10, qword ptr [rbp-10376]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.508:
+  mov qword ptr [rbp-10344], 107
+  lea rsi, [rip+.L.data.main.185]
+  add rsi, 0
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rbp-10352], rsi
+  lea rsi, [rip+.L.data.main.186]
+  mov qword ptr [rbp-10360], rsi
+  mov rsi, qword ptr [rbp-10344]
+  cmp rsi, qword ptr [rbp-10352]
+  jne .L.else.main.509
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10360]
+  mov r9, qword ptr [rbp-10352]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.510
+.L.else.main.509:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10360]
+  mov r9, qword ptr [rbp-10344]
+  mov r10, qword ptr [rbp-10352]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.510:
+  mov qword ptr [rbp-10320], 108
+  lea rsi, [rip+.L.data.main.187]
+  add rsi, 0
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rbp-10328], rsi
+  lea rsi, [rip+.L.data.main.188]
+  mov qword ptr [rbp-10336], rsi
+  mov rsi, qword ptr [rbp-10320]
+  cmp rsi, qword ptr [rbp-10328]
+  jne .L.else.main.511
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10336]
+  mov r9, qword ptr [rbp-10328]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.512
+.L.else.main.511:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10336]
+  mov r9, qword ptr [rbp-10320]
+  mov r10, qword ptr [rbp-10328]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.512:
+  mov qword ptr [rbp-10296], 2
+  mov dword ptr [rbp-18044], 2
+  mov dword ptr [rbp-18040], 3
+  movsxd rsi, dword ptr [rbp-18044]
+  mov qword ptr [rbp-10304], rsi
+  lea rsi, [rip+.L.data.main.189]
+  mov qword ptr [rbp-10312], rsi
+  mov rsi, qword ptr [rbp-10296]
+  cmp rsi, qword ptr [rbp-10304]
+  jne .L.else.main.513
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10312]
+  mov r9, qword ptr [rbp-10304]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.514
+.L.else.main.513:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10312]
+  mov r9, qword ptr [rbp-10296]
+  mov r10, qword ptr [rbp-10304]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.514:
+  mov qword ptr [rbp-10272], 2
+  mov dword ptr [rbp-18036], 2
+  mov dword ptr [rbp-18032], 3
+  mov dword ptr [rbp-18028], 4
+  movsxd rsi, dword ptr [rbp-18036]
+  mov qword ptr [rbp-10280], rsi
+  lea rsi, [rip+.L.data.main.190]
+  mov qword ptr [rbp-10288], rsi
+  mov rsi, qword ptr [rbp-10272]
+  cmp rsi, qword ptr [rbp-10280]
+  jne .L.else.main.515
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10288]
+  mov r9, qword ptr [rbp-10280]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.516
+.L.else.main.515:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10288]
+  mov r9, qword ptr [rbp-10272]
+  mov r10, qword ptr [rbp-10280]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.516:
+  mov qword ptr [rbp-10248], 3
+  mov dword ptr [rbp-18024], 2
+  mov dword ptr [rbp-18024], 3
+  movsxd rsi, dword ptr [rbp-18024]
+  mov qword ptr [rbp-10256], rsi
+  lea rsi, [rip+.L.data.main.191]
+  mov qword ptr [rbp-10264], rsi
+  mov rsi, qword ptr [rbp-10248]
+  cmp rsi, qword ptr [rbp-10256]
+  jne .L.else.main.517
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10264]
+  mov r9, qword ptr [rbp-10256]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.518
+.L.else.main.517:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10264]
+  mov r9, qword ptr [rbp-10248]
+  mov r10, qword ptr [rbp-10256]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.518:
+  mov qword ptr [rbp-10224], 2
+  lea rsi, [rbp-18020]
+  add rsi, 8
+  mov qword ptr [rbp-18000], rsi
+  mov rsi, qword ptr [rbp-18000]
+  lea rdi, [rbp-18020]
+  sub rsi, rdi
+  sar rsi, 2
+  mov qword ptr [rbp-10232], rsi
+  lea rsi, [rip+.L.data.main.192]
+  mov qword ptr [rbp-10240], rsi
+  mov rsi, qword ptr [rbp-10224]
+  cmp rsi, qword ptr [rbp-10232]
+  jne .L.else.main.519
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10240]
+  mov r9, qword ptr [rbp-10232]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.520
+.L.else.main.519:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10240]
+  mov r9, qword ptr [rbp-10224]
+  mov r10, qword ptr [rbp-10232]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.520:
+  mov qword ptr [rbp-10200], 1
+  mov dword ptr [rbp-17988], 1
+  mov dword ptr [rbp-17984], 2
+  movsxd rsi, dword ptr [rbp-17988]
+  mov qword ptr [rbp-10208], rsi
+  lea rsi, [rip+.L.data.main.193]
+  mov qword ptr [rbp-10216], rsi
+  mov rsi, qword ptr [rbp-10200]
+  cmp rsi, qword ptr [rbp-10208]
+  jne .L.else.main.521
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10216]
+  mov r9, qword ptr [rbp-10208]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.522
+.L.else.main.521:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10216]
+  mov r9, qword ptr [rbp-10200]
+  mov r10, qword ptr [rbp-10208]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.522:
+  mov qword ptr [rbp-10176], 2
+  mov dword ptr [rbp-17980], 1
+  mov dword ptr [rbp-17976], 2
+  movsxd rsi, dword ptr [rbp-17976]
+  mov qword ptr [rbp-10184], rsi
+  lea rsi, [rip+.L.data.main.194]
+  mov qword ptr [rbp-10192], rsi
+  mov rsi, qword ptr [rbp-10176]
+  cmp rsi, qword ptr [rbp-10184]
+  jne .L.else.main.523
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10192]
+  mov r9, qword ptr [rbp-10184]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.524
+.L.else.main.523:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10192]
+  mov r9, qword ptr [rbp-10176]
+  mov r10, qword ptr [rbp-10184]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.524:
+  mov qword ptr [rbp-10152], 1
+  mov byte ptr [rbp-17972], 1
+  mov dword ptr [rbp-17968], 2
+  mov byte ptr [rbp-17964], 3
+  movsx rsi, byte ptr [rbp-17972]
+  mov qword ptr [rbp-10160], rsi
+  lea rsi, [rip+.L.data.main.195]
+  mov qword ptr [rbp-10168], rsi
+  mov rsi, qword ptr [rbp-10152]
+  cmp rsi, qword ptr [rbp-10160]
+  jne .L.else.main.525
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10168]
+  mov r9, qword ptr [rbp-10160]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.526
+.L.else.main.525:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10168]
+  mov r9, qword ptr [rbp-10152]
+  mov r10, qword ptr [rbp-10160]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.526:
+  mov qword ptr [rbp-10128], 2
+  mov dword ptr [rbp-17956], 1
+  mov dword ptr [rbp-17956], 2
+  mov byte ptr [rbp-17952], 3
+  movsxd rsi, dword ptr [rbp-17956]
+  mov qword ptr [rbp-10136], rsi
+  lea rsi, [rip+.L.data.main.196]
+  mov qword ptr [rbp-10144], rsi
+  mov rsi, qword ptr [rbp-10128]
+  cmp rsi, qword ptr [rbp-10136]
+  jne .L.else.main.527
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10144]
+  mov r9, qword ptr [rbp-10136]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.528
+.L.else.main.527:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10144]
+  mov r9, qword ptr [rbp-10128]
+  mov r10, qword ptr [rbp-10136]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.528:
+  mov qword ptr [rbp-10104], 3
+  mov byte ptr [rbp-17948], 1
+  mov dword ptr [rbp-17944], 2
+  mov byte ptr [rbp-17940], 3
+  movsx rsi, byte ptr [rbp-17940]
+  mov qword ptr [rbp-10112], rsi
+  lea rsi, [rip+.L.data.main.197]
+  mov qword ptr [rbp-10120], rsi
+  mov rsi, qword ptr [rbp-10104]
+  cmp rsi, qword ptr [rbp-10112]
+  jne .L.else.main.529
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10120]
+  mov r9, qword ptr [rbp-10112]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.530
+.L.else.main.529:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10120]
+  mov r9, qword ptr [rbp-10104]
+  mov r10, qword ptr [rbp-10112]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.530:
+  mov qword ptr [rbp-10080], 0
+  lea rsi, [rbp-17936]
+  mov qword ptr [rbp-17912], rsi
+  mov rsi, qword ptr [rbp-17912]
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rbp-17936]
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-10088], rsi
+  lea rsi, [rip+.L.data.main.198]
+  mov qword ptr [rbp-10096], rsi
+  mov rsi, qword ptr [rbp-10080]
+  cmp rsi, qword ptr [rbp-10088]
+  jne .L.else.main.531
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10096]
+  mov r9, qword ptr [rbp-10088]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.532
+.L.else.main.531:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10096]
+  mov r9, qword ptr [rbp-10080]
+  mov r10, qword ptr [rbp-10088]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.532:
+  mov qword ptr [rbp-10056], 1
+  lea rsi, [rbp-17904]
+  mov qword ptr [rbp-17880], rsi
+  mov rsi, qword ptr [rbp-17880]
+  add rsi, 4
+  mov dword ptr [rsi], 1
+  lea rsi, [rbp-17904]
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi+4]
+  mov qword ptr [rbp-10064], rsi
+  lea rsi, [rip+.L.data.main.199]
+  mov qword ptr [rbp-10072], rsi
+  mov rsi, qword ptr [rbp-10056]
+  cmp rsi, qword ptr [rbp-10064]
+  jne .L.else.main.533
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10072]
+  mov r9, qword ptr [rbp-10064]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.534
+.L.else.main.533:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10072]
+  mov r9, qword ptr [rbp-10056]
+  mov r10, qword ptr [rbp-10064]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.534:
+  mov qword ptr [rbp-10032], 2
+  lea rsi, [rbp-17872]
+  mov qword ptr [rbp-17848], rsi
+  mov rsi, qword ptr [rbp-17848]
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  lea rsi, [rbp-17872]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-10040], rsi
+  lea rsi, [rip+.L.data.main.200]
+  mov qword ptr [rbp-10048], rsi
+  mov rsi, qword ptr [rbp-10032]
+  cmp rsi, qword ptr [rbp-10040]
+  jne .L.else.main.535
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10048]
+  mov r9, qword ptr [rbp-10040]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.536
+.L.else.main.535:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10048]
+  mov r9, qword ptr [rbp-10032]
+  mov r10, qword ptr [rbp-10040]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.536:
+  mov qword ptr [rbp-10008], 3
+  lea rsi, [rbp-17840]
+  mov qword ptr [rbp-17816], rsi
+  mov rsi, qword ptr [rbp-17816]
+  add rsi, 12
+  mov dword ptr [rsi], 3
+  lea rsi, [rbp-17840]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi+4]
+  mov qword ptr [rbp-10016], rsi
+  lea rsi, [rip+.L.data.main.201]
+  mov qword ptr [rbp-10024], rsi
+  mov rsi, qword ptr [rbp-10008]
+  cmp rsi, qword ptr [rbp-10016]
+  jne .L.else.main.537
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10024]
+  mov r9, qword ptr [rbp-10016]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.538
+.L.else.main.537:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10024]
+  mov r9, qword ptr [rbp-10008]
+  mov r10, qword ptr [rbp-10016]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.538:
+  mov qword ptr [rbp-9984], 6
+  lea rsi, [rbp-17808]
+  mov qword ptr [rbp-17776], rsi
+  lea rsi, [rbp-17808]
+  add rsi, 0
+  mov dword ptr [rsi], 6
+  mov rsi, qword ptr [rbp-17776]
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-9992], rsi
+  lea rsi, [rip+.L.data.main.202]
+  mov qword ptr [rbp-10000], rsi
+  mov rsi, qword ptr [rbp-9984]
+  cmp rsi, qword ptr [rbp-9992]
+  jne .L.else.main.539
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-10000]
+  mov r9, qword ptr [rbp-9992]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.540
+.L.else.main.539:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-10000]
+  mov r9, qword ptr [rbp-9984]
+  mov r10, qword ptr [rbp-9992]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.540:
+  mov qword ptr [rbp-9960], 7
+  lea rsi, [rbp-17768]
+  mov qword ptr [rbp-17736], rsi
+  lea rsi, [rbp-17756]
+  add rsi, 0
+  mov dword ptr [rsi], 7
+  mov rsi, qword ptr [rbp-17736]
+  add rsi, 12
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-9968], rsi
+  lea rsi, [rip+.L.data.main.203]
+  mov qword ptr [rbp-9976], rsi
+  mov rsi, qword ptr [rbp-9960]
+  cmp rsi, qword ptr [rbp-9968]
+  jne .L.else.main.541
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9976]
+  mov r9, qword ptr [rbp-9968]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.542
+.L.else.main.541:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9976]
+  mov r9, qword ptr [rbp-9960]
+  mov r10, qword ptr [rbp-9968]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.542:
+  mov qword ptr [rbp-9936], 6
+  mov dword ptr [rbp-17728], 6
+  movsxd rsi, dword ptr [rbp-17728]
+  mov qword ptr [rbp-9944], rsi
+  lea rsi, [rip+.L.data.main.204]
+  mov qword ptr [rbp-9952], rsi
+  mov rsi, qword ptr [rbp-9936]
+  cmp rsi, qword ptr [rbp-9944]
+  jne .L.else.main.543
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9952]
+  mov r9, qword ptr [rbp-9944]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.544
+.L.else.main.543:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9952]
+  mov r9, qword ptr [rbp-9936]
+  mov r10, qword ptr [rbp-9944]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.544:
+  mov qword ptr [rbp-9912], 4
+  mov qword ptr [rbp-9920], 4
+  lea rsi, [rip+.L.data.main.205]
+  mov qword ptr [rbp-9928], rsi
+  mov rsi, qword ptr [rbp-9912]
+  cmp rsi, qword ptr [rbp-9920]
+  jne .L.else.main.545
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9928]
+  mov r9, qword ptr [rbp-9920]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.546
+.L.else.main.545:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9928]
+  mov r9, qword ptr [rbp-9912]
+  mov r10, qword ptr [rbp-9920]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.546:
+  mov qword ptr [rbp-9888], 8
+  mov qword ptr [rbp-9896], 8
+  lea rsi, [rip+.L.data.main.206]
+  mov qword ptr [rbp-9904], rsi
+  mov rsi, qword ptr [rbp-9888]
+  cmp rsi, qword ptr [rbp-9896]
+  jne .L.else.main.547
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9904]
+  mov r9, qword ptr [rbp-9896]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.548
+.L.else.main.547:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9904]
+  mov r9, qword ptr [rbp-9888]
+  mov r10, qword ptr [rbp-9896]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.548:
+  mov qword ptr [rbp-9864], 12
+  mov qword ptr [rbp-9872], 12
+  lea rsi, [rip+.L.data.main.207]
+  mov qword ptr [rbp-9880], rsi
+  mov rsi, qword ptr [rbp-9864]
+  cmp rsi, qword ptr [rbp-9872]
+  jne .L.else.main.549
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9880]
+  mov r9, qword ptr [rbp-9872]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.550
+.L.else.main.549:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9880]
+  mov r9, qword ptr [rbp-9864]
+  mov r10, qword ptr [rbp-9872]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.550:
+  mov qword ptr [rbp-9840], 16
+  mov qword ptr [rbp-9848], 16
+  lea rsi, [rip+.L.data.main.208]
+  mov qword ptr [rbp-9856], rsi
+  mov rsi, qword ptr [rbp-9840]
+  cmp rsi, qword ptr [rbp-9848]
+  jne .L.else.main.551
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9856]
+  mov r9, qword ptr [rbp-9848]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.552
+.L.else.main.551:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9856]
+  mov r9, qword ptr [rbp-9840]
+  mov r10, qword ptr [rbp-9848]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.552:
+  mov qword ptr [rbp-9816], 24
+  mov qword ptr [rbp-9824], 24
+  lea rsi, [rip+.L.data.main.209]
+  mov qword ptr [rbp-9832], rsi
+  mov rsi, qword ptr [rbp-9816]
+  cmp rsi, qword ptr [rbp-9824]
+  jne .L.else.main.553
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9832]
+  mov r9, qword ptr [rbp-9824]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.554
+.L.else.main.553:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9832]
+  mov r9, qword ptr [rbp-9816]
+  mov r10, qword ptr [rbp-9824]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.554:
+  mov qword ptr [rbp-9792], 2
+  mov qword ptr [rbp-9800], 2
+  lea rsi, [rip+.L.data.main.210]
+  mov qword ptr [rbp-9808], rsi
+  mov rsi, qword ptr [rbp-9792]
+  cmp rsi, qword ptr [rbp-9800]
+  jne .L.else.main.555
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9808]
+  mov r9, qword ptr [rbp-9800]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.556
+.L.else.main.555:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9808]
+  mov r9, qword ptr [rbp-9792]
+  mov r10, qword ptr [rbp-9800]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.556:
+  mov qword ptr [rbp-9768], 8
+  mov qword ptr [rbp-9776], 8
+  lea rsi, [rip+.L.data.main.211]
+  mov qword ptr [rbp-9784], rsi
+  mov rsi, qword ptr [rbp-9768]
+  cmp rsi, qword ptr [rbp-9776]
+  jne .L.else.main.557
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9784]
+  mov r9, qword ptr [rbp-9776]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.558
+.L.else.main.557:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9784]
+  mov r9, qword ptr [rbp-9768]
+  mov r10, qword ptr [rbp-9776]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.558:
+  mov qword ptr [rbp-9744], 8
+  mov qword ptr [rbp-9752], 8
+  lea rsi, [rip+.L.data.main.212]
+  mov qword ptr [rbp-9760], rsi
+  mov rsi, qword ptr [rbp-9744]
+  cmp rsi, qword ptr [rbp-9752]
+  jne .L.else.main.559
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9760]
+  mov r9, qword ptr [rbp-9752]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.560
+.L.else.main.559:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9760]
+  mov r9, qword ptr [rbp-9744]
+  mov r10, qword ptr [rbp-9752]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.560:
+  mov qword ptr [rbp-9720], 7
+  lea rsi, [rbp-17640]
+  mov dword ptr [rbp-17632], esi
+  lea rsi, [rbp-17633]
+  mov dword ptr [rbp-17628], esi
+  movsxd rsi, dword ptr [rbp-17628]
+  movsxd rdi, dword ptr [rbp-17632]
+  sub rsi, rdi
+  mov qword ptr [rbp-9728], rsi
+  lea rsi, [rip+.L.data.main.213]
+  mov qword ptr [rbp-9736], rsi
+  mov rsi, qword ptr [rbp-9720]
+  cmp rsi, qword ptr [rbp-9728]
+  jne .L.else.main.561
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9736]
+  mov r9, qword ptr [rbp-9728]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.562
+.L.else.main.561:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9736]
+  mov r9, qword ptr [rbp-9720]
+  mov r10, qword ptr [rbp-9728]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.562:
+  mov qword ptr [rbp-9696], 1
+  lea rsi, [rbp-17621]
+  mov dword ptr [rbp-17616], esi
+  lea rsi, [rbp-17620]
+  mov dword ptr [rbp-17612], esi
+  movsxd rsi, dword ptr [rbp-17612]
+  movsxd rdi, dword ptr [rbp-17616]
+  sub rsi, rdi
+  mov qword ptr [rbp-9704], rsi
+  lea rsi, [rip+.L.data.main.214]
+  mov qword ptr [rbp-9712], rsi
+  mov rsi, qword ptr [rbp-9696]
+  cmp rsi, qword ptr [rbp-9704]
+  jne .L.else.main.563
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9712]
+  mov r9, qword ptr [rbp-9704]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.564
+.L.else.main.563:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9712]
+  mov r9, qword ptr [rbp-9696]
+  mov r10, qword ptr [rbp-9704]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.564:
+  mov qword ptr [rbp-9672], 2
+  mov qword ptr [rbp-9680], 2
+  lea rsi, [rip+.L.data.main.215]
+  mov qword ptr [rbp-9688], rsi
+  mov rsi, qword ptr [rbp-9672]
+  cmp rsi, qword ptr [rbp-9680]
+  jne .L.else.main.565
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9688]
+  mov r9, qword ptr [rbp-9680]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.566
+.L.else.main.565:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9688]
+  mov r9, qword ptr [rbp-9672]
+  mov r10, qword ptr [rbp-9680]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.566:
+  mov qword ptr [rbp-9648], 3
+  mov dword ptr [rbp-17604], 1
+  mov dword ptr [rbp-17600], 2
+  movsxd rsi, dword ptr [rbp-17604]
+  movsxd rdi, dword ptr [rbp-17600]
+  add rsi, rdi
+  mov qword ptr [rbp-9656], rsi
+  lea rsi, [rip+.L.data.main.216]
+  mov qword ptr [rbp-9664], rsi
+  mov rsi, qword ptr [rbp-9648]
+  cmp rsi, qword ptr [rbp-9656]
+  jne .L.else.main.567
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9664]
+  mov r9, qword ptr [rbp-9656]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.568
+.L.else.main.567:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9664]
+  mov r9, qword ptr [rbp-9648]
+  mov r10, qword ptr [rbp-9656]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.568:
+  mov qword ptr [rbp-9624], 3
+  lea rsi, [rbp-17593]
+  mov qword ptr [rbp-17592], rsi
+  mov byte ptr [rbp-17593], 3
+  mov rsi, qword ptr [rbp-17592]
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rbp-9632], rsi
+  lea rsi, [rip+.L.data.main.217]
+  mov qword ptr [rbp-9640], rsi
+  mov rsi, qword ptr [rbp-9624]
+  cmp rsi, qword ptr [rbp-9632]
+  jne .L.else.main.569
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9640]
+  mov r9, qword ptr [rbp-9632]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.570
+.L.else.main.569:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9640]
+  mov r9, qword ptr [rbp-9624]
+  mov r10, qword ptr [rbp-9632]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.570:
+  mov qword ptr [rbp-9600], 3
+  lea rsi, [rbp-17577]
+  mov qword ptr [rbp-17576], rsi
+  mov rsi, qword ptr [rbp-17576]
+  mov byte ptr [rsi], 3
+  movsx rsi, byte ptr [rbp-17577]
+  mov qword ptr [rbp-9608], rsi
+  lea rsi, [rip+.L.data.main.218]
+  mov qword ptr [rbp-9616], rsi
+  mov rsi, qword ptr [rbp-9600]
+  cmp rsi, qword ptr [rbp-9608]
+  jne .L.else.main.571
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9616]
+  mov r9, qword ptr [rbp-9608]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.572
+.L.else.main.571:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9616]
+  mov r9, qword ptr [rbp-9600]
+  mov r10, qword ptr [rbp-9608]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.572:
+  mov qword ptr [rbp-9576], 1
+  mov dword ptr [rbp-17568], 1
+  movsxd rsi, dword ptr [rbp-17568]
+  mov qword ptr [rbp-9584], rsi
+  lea rsi, [rip+.L.data.main.219]
+  mov qword ptr [rbp-9592], rsi
+  mov rsi, qword ptr [rbp-9576]
+  cmp rsi, qword ptr [rbp-9584]
+  jne .L.else.main.573
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9592]
+  mov r9, qword ptr [rbp-9584]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.574
+.L.else.main.573:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9592]
+  mov r9, qword ptr [rbp-9576]
+  mov r10, qword ptr [rbp-9584]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.574:
+  mov qword ptr [rbp-9552], 1
+  mov dword ptr [rbp-17564], 1
+  movsxd rsi, dword ptr [rbp-17564]
+  mov qword ptr [rbp-9560], rsi
+  lea rsi, [rip+.L.data.main.220]
+  mov qword ptr [rbp-9568], rsi
+  mov rsi, qword ptr [rbp-9552]
+  cmp rsi, qword ptr [rbp-9560]
+  jne .L.else.main.575
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9568]
+  mov r9, qword ptr [rbp-9560]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.576
+.L.else.main.575:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9568]
+  mov r9, qword ptr [rbp-9552]
+  mov r10, qword ptr [rbp-9560]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.576:
+  mov qword ptr [rbp-9528], 1
+  mov dword ptr [rbp-17560], 1
+  movsxd rsi, dword ptr [rbp-17560]
+  mov qword ptr [rbp-9536], rsi
+  lea rsi, [rip+.L.data.main.221]
+  mov qword ptr [rbp-9544], rsi
+  mov rsi, qword ptr [rbp-9528]
+  cmp rsi, qword ptr [rbp-9536]
+  jne .L.else.main.577
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9544]
+  mov r9, qword ptr [rbp-9536]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.578
+.L.else.main.577:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9544]
+  mov r9, qword ptr [rbp-9528]
+  mov r10, qword ptr [rbp-9536]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.578:
+  mov qword ptr [rbp-9504], 2
+  mov dword ptr [rbp-17556], 2
+  movsxd rsi, dword ptr [rbp-17556]
+  mov qword ptr [rbp-9512], rsi
+  lea rsi, [rip+.L.data.main.222]
+  mov qword ptr [rbp-9520], rsi
+  mov rsi, qword ptr [rbp-9504]
+  cmp rsi, qword ptr [rbp-9512]
+  jne .L.else.main.579
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9520]
+  mov r9, qword ptr [rbp-9512]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.580
+.L.else.main.579:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9520]
+  mov r9, qword ptr [rbp-9504]
+  mov r10, qword ptr [rbp-9512]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.580:
+  mov qword ptr [rbp-9480], 8
+  mov qword ptr [rbp-9488], 8
+  lea rsi, [rip+.L.data.main.223]
+  mov qword ptr [rbp-9496], rsi
+  mov rsi, qword ptr [rbp-9480]
+  cmp rsi, qword ptr [rbp-9488]
+  jne .L.else.main.581
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9496]
+  mov r9, qword ptr [rbp-9488]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.582
+.L.else.main.581:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9496]
+  mov r9, qword ptr [rbp-9480]
+  mov r10, qword ptr [rbp-9488]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.582:
+  mov qword ptr [rbp-9456], 8
+  mov qword ptr [rbp-9464], 8
+  lea rsi, [rip+.L.data.main.224]
+  mov qword ptr [rbp-9472], rsi
+  mov rsi, qword ptr [rbp-9456]
+  cmp rsi, qword ptr [rbp-9464]
+  jne .L.else.main.583
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9472]
+  mov r9, qword ptr [rbp-9464]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.584
+.L.else.main.583:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9472]
+  mov r9, qword ptr [rbp-9456]
+  mov r10, qword ptr [rbp-9464]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.584:
+  mov qword ptr [rbp-9432], 2
+  mov qword ptr [rbp-9440], 2
+  lea rsi, [rip+.L.data.main.225]
+  mov qword ptr [rbp-9448], rsi
+  mov rsi, qword ptr [rbp-9432]
+  cmp rsi, qword ptr [rbp-9440]
+  jne .L.else.main.585
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9448]
+  mov r9, qword ptr [rbp-9440]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.586
+.L.else.main.585:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9448]
+  mov r9, qword ptr [rbp-9432]
+  mov r10, qword ptr [rbp-9440]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.586:
+  mov qword ptr [rbp-9408], 4
+  mov qword ptr [rbp-9416], 4
+  lea rsi, [rip+.L.data.main.226]
+  mov qword ptr [rbp-9424], rsi
+  mov rsi, qword ptr [rbp-9408]
+  cmp rsi, qword ptr [rbp-9416]
+  jne .L.else.main.587
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9424]
+  mov r9, qword ptr [rbp-9416]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.588
+.L.else.main.587:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9424]
+  mov r9, qword ptr [rbp-9408]
+  mov r10, qword ptr [rbp-9416]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.588:
+  mov qword ptr [rbp-9384], 8
+  mov qword ptr [rbp-9392], 8
+  lea rsi, [rip+.L.data.main.227]
+  mov qword ptr [rbp-9400], rsi
+  mov rsi, qword ptr [rbp-9384]
+  cmp rsi, qword ptr [rbp-9392]
+  jne .L.else.main.589
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9400]
+  mov r9, qword ptr [rbp-9392]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.590
+.L.else.main.589:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9400]
+  mov r9, qword ptr [rbp-9384]
+  mov r10, qword ptr [rbp-9392]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.590:
+  mov qword ptr [rbp-9360], 16
+  mov qword ptr [rbp-9368], 16
+  lea rsi, [rip+.L.data.main.228]
+  mov qword ptr [rbp-9376], rsi
+  mov rsi, qword ptr [rbp-9360]
+  cmp rsi, qword ptr [rbp-9368]
+  jne .L.else.main.591
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9376]
+  mov r9, qword ptr [rbp-9368]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.592
+.L.else.main.591:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9376]
+  mov r9, qword ptr [rbp-9360]
+  mov r10, qword ptr [rbp-9368]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.592:
+  mov qword ptr [rbp-9328], 1
+  mov word ptr [rbp-9346], 7
+  mov word ptr [rbp-9348], 3
+  mov word ptr [rbp-9350], 3
+  movsx rsi, word ptr [rbp-9346]
+  movsx rdi, word ptr [rbp-9348]
+  sub rsi, rdi
+  movsx rdi, word ptr [rbp-9350]
+  sub rsi, rdi
+  movsxd rsi, esi
+  mov qword ptr [rbp-9336], rsi
+  lea rsi, [rip+.L.data.main.229]
+  mov qword ptr [rbp-9344], rsi
+  mov rsi, qword ptr [rbp-9328]
+  cmp rsi, qword ptr [rbp-9336]
+  jne .L.else.main.593
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9344]
+  mov r9, qword ptr [rbp-9336]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.594
+.L.else.main.593:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9344]
+  mov r9, qword ptr [rbp-9328]
+  mov r10, qword ptr [rbp-9336]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.594:
+  mov qword ptr [rbp-9280], 1
+  mov qword ptr [rbp-9304], 7
+  mov qword ptr [rbp-9312], 3
+  mov qword ptr [rbp-9320], 3
+  mov rsi, qword ptr [rbp-9304]
+  sub rsi, qword ptr [rbp-9312]
+  sub rsi, qword ptr [rbp-9320]
+  movsxd rsi, esi
+  mov qword ptr [rbp-9288], rsi
+  lea rsi, [rip+.L.data.main.230]
+  mov qword ptr [rbp-9296], rsi
+  mov rsi, qword ptr [rbp-9280]
+  cmp rsi, qword ptr [rbp-9288]
+  jne .L.else.main.595
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9296]
+  mov r9, qword ptr [rbp-9288]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.596
+.L.else.main.595:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9296]
+  mov r9, qword ptr [rbp-9280]
+  mov r10, qword ptr [rbp-9288]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.596:
+  mov qword ptr [rbp-9256], 24
+  mov qword ptr [rbp-9264], 24
+  lea rsi, [rip+.L.data.main.231]
+  mov qword ptr [rbp-9272], rsi
+  mov rsi, qword ptr [rbp-9256]
+  cmp rsi, qword ptr [rbp-9264]
+  jne .L.else.main.597
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9272]
+  mov r9, qword ptr [rbp-9264]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.598
+.L.else.main.597:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9272]
+  mov r9, qword ptr [rbp-9256]
+  mov r10, qword ptr [rbp-9264]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.598:
+  mov qword ptr [rbp-9232], 8
+  mov qword ptr [rbp-9240], 8
+  lea rsi, [rip+.L.data.main.232]
+  mov qword ptr [rbp-9248], rsi
+  mov rsi, qword ptr [rbp-9232]
+  cmp rsi, qword ptr [rbp-9240]
+  jne .L.else.main.599
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9248]
+  mov r9, qword ptr [rbp-9240]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.600
+.L.else.main.599:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9248]
+  mov r9, qword ptr [rbp-9232]
+  mov r10, qword ptr [rbp-9240]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.600:
+  mov qword ptr [rbp-9208], 3
+  lea rsi, [rbp-17464]
+  add rsi, 0
+  lea rdi, [rbp-17440]
+  mov qword ptr [rsi], rdi
+  mov dword ptr [rbp-17440], 3
+  lea rsi, [rbp-17464]
+  add rsi, 0
+  mov rsi, qword ptr [rsi]
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-9216], rsi
+  lea rsi, [rip+.L.data.main.233]
+  mov qword ptr [rbp-9224], rsi
+  mov rsi, qword ptr [rbp-9208]
+  cmp rsi, qword ptr [rbp-9216]
+  jne .L.else.main.601
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9224]
+  mov r9, qword ptr [rbp-9216]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.602
+.L.else.main.601:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9224]
+  mov r9, qword ptr [rbp-9208]
+  mov r10, qword ptr [rbp-9216]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.602:
+  mov qword ptr [rbp-9184], 4
+  lea rsi, [rbp-17436]
+  mov qword ptr [rbp-17424], rsi
+  mov rsi, qword ptr [rbp-17424]
+  add rsi, 0
+  add rsi, 0
+  mov dword ptr [rsi], 4
+  mov rsi, qword ptr [rbp-17424]
+  add rsi, 0
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-9192], rsi
+  lea rsi, [rip+.L.data.main.234]
+  mov qword ptr [rbp-9200], rsi
+  mov rsi, qword ptr [rbp-9184]
+  cmp rsi, qword ptr [rbp-9192]
+  jne .L.else.main.603
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9200]
+  mov r9, qword ptr [rbp-9192]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.604
+.L.else.main.603:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9200]
+  mov r9, qword ptr [rbp-9184]
+  mov r10, qword ptr [rbp-9192]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.604:
+  mov qword ptr [rbp-9160], 3
+  movsxd rsi, dword ptr [rip+g1]
+  mov qword ptr [rbp-9168], rsi
+  lea rsi, [rip+.L.data.main.235]
+  mov qword ptr [rbp-9176], rsi
+  mov rsi, qword ptr [rbp-9160]
+  cmp rsi, qword ptr [rbp-9168]
+  jne .L.else.main.605
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9176]
+  mov r9, qword ptr [rbp-9168]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.606
+.L.else.main.605:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9176]
+  mov r9, qword ptr [rbp-9160]
+  mov r10, qword ptr [rbp-9168]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.606:
+  mov qword ptr [rbp-9136], 0
+  mov rsi, 0
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rbp-17405], sil
+  movsx rsi, byte ptr [rbp-17405]
+  mov qword ptr [rbp-9144], rsi
+  lea rsi, [rip+.L.data.main.236]
+  mov qword ptr [rbp-9152], rsi
+  mov rsi, qword ptr [rbp-9136]
+  cmp rsi, qword ptr [rbp-9144]
+  jne .L.else.main.607
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9152]
+  mov r9, qword ptr [rbp-9144]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.608
+.L.else.main.607:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9152]
+  mov r9, qword ptr [rbp-9136]
+  mov r10, qword ptr [rbp-9144]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.608:
+  mov qword ptr [rbp-9112], 1
+  mov rsi, 1
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rbp-17404], sil
+  movsx rsi, byte ptr [rbp-17404]
+  mov qword ptr [rbp-9120], rsi
+  lea rsi, [rip+.L.data.main.237]
+  mov qword ptr [rbp-9128], rsi
+  mov rsi, qword ptr [rbp-9112]
+  cmp rsi, qword ptr [rbp-9120]
+  jne .L.else.main.609
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9128]
+  mov r9, qword ptr [rbp-9120]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.610
+.L.else.main.609:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9128]
+  mov r9, qword ptr [rbp-9112]
+  mov r10, qword ptr [rbp-9120]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.610:
+  mov qword ptr [rbp-9088], 1
+  mov rsi, 2
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rbp-17403], sil
+  movsx rsi, byte ptr [rbp-17403]
+  mov qword ptr [rbp-9096], rsi
+  lea rsi, [rip+.L.data.main.238]
+  mov qword ptr [rbp-9104], rsi
+  mov rsi, qword ptr [rbp-9088]
+  cmp rsi, qword ptr [rbp-9096]
+  jne .L.else.main.611
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9104]
+  mov r9, qword ptr [rbp-9096]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.612
+.L.else.main.611:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9104]
+  mov r9, qword ptr [rbp-9088]
+  mov r10, qword ptr [rbp-9096]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.612:
+  mov qword ptr [rbp-9064], 1
+  mov rsi, 0
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rbp-17402], sil
+  movsx rsi, byte ptr [rbp-17402]
+  add rsi, 5
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rbp-17402], sil
+  mov qword ptr [rbp-9072], rsi
+  lea rsi, [rip+.L.data.main.239]
+  mov qword ptr [rbp-9080], rsi
+  mov rsi, qword ptr [rbp-9064]
+  cmp rsi, qword ptr [rbp-9072]
+  jne .L.else.main.613
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9080]
+  mov r9, qword ptr [rbp-9072]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.614
+.L.else.main.613:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9080]
+  mov r9, qword ptr [rbp-9064]
+  mov r10, qword ptr [rbp-9072]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.614:
+  mov qword ptr [rbp-9040], 1
+  mov rsi, 0
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rbp-17401], sil
+  mov rsi, 7
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rbp-17401], sil
+  mov qword ptr [rbp-17400], rsi
+  mov rsi, qword ptr [rbp-17400]
+  mov qword ptr [rbp-9048], rsi
+  lea rsi, [rip+.L.data.main.240]
+  mov qword ptr [rbp-9056], rsi
+  mov rsi, qword ptr [rbp-9040]
+  cmp rsi, qword ptr [rbp-9048]
+  jne .L.else.main.615
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9056]
+  mov r9, qword ptr [rbp-9048]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.616
+.L.else.main.615:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9056]
+  mov r9, qword ptr [rbp-9040]
+  mov r10, qword ptr [rbp-9048]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.616:
+  mov qword ptr [rbp-9016], 1
+  mov rsi, 1
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rbp-17385], sil
+  movsx rsi, byte ptr [rbp-17385]
+  add rsi, 1
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rbp-17385], sil
+  mov qword ptr [rbp-9024], rsi
+  lea rsi, [rip+.L.data.main.241]
+  mov qword ptr [rbp-9032], rsi
+  mov rsi, qword ptr [rbp-9016]
+  cmp rsi, qword ptr [rbp-9024]
+  jne .L.else.main.617
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9032]
+  mov r9, qword ptr [rbp-9024]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.618
+.L.else.main.617:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9032]
+  mov r9, qword ptr [rbp-9016]
+  mov r10, qword ptr [rbp-9024]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.618:
+  mov qword ptr [rbp-8992], 39
+  mov dword ptr [rbp-17384], 0
+  mov dword ptr [rbp-17380], 0
+  mov rsi, 1
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rbp-17374], sil
+  movsxd rsi, dword ptr [rbp-17384]
+  cmp rsi, 4
+  jge .L.break.main.620
+  .p2align 4,,10
+.L.begin.main.621:
+  add dword ptr [rbp-17384], 1
+  movsx rsi, byte ptr [rbp-17374]
+  add rsi, 1
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rbp-17374], sil
+  add dword ptr [rbp-17380], esi
+  shl dword ptr [rbp-17380], 1
+  movsxd rsi, dword ptr [rbp-17384]
+  cmp rsi, 4
+  jl .L.begin.main.621
+.L.break.main.620:
+  movsxd rsi, dword ptr [rbp-17380]
+  movsxd rdi, dword ptr [rbp-17384]
+  imul rdi, 0
+  add rsi, rdi
+  add rsi, 9
+  mov qword ptr [rbp-9000], rsi
+  lea rsi, [rip+.L.data.main.242]
+  mov qword ptr [rbp-9008], rsi
+  mov rsi, qword ptr [rbp-8992]
+  cmp rsi, qword ptr [rbp-9000]
+  jne .L.else.main.622
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-9008]
+  mov r9, qword ptr [rbp-9000]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.623
+.L.else.main.622:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-9008]
+  mov r9, qword ptr [rbp-8992]
+  mov r10, qword ptr [rbp-9000]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.623:
+  mov qword ptr [rbp-8968], 1
+  mov rsi, 1
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rbp-17373], sil
+  movsx rsi, byte ptr [rbp-17373]
+  mov rdi, rsi
+  add rsi, 1
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rbp-17373], sil
+  mov qword ptr [rbp-8976], rdi
+  lea rsi, [rip+.L.data.main.243]
+  mov qword ptr [rbp-8984], rsi
+  mov rsi, qword ptr [rbp-8968]
+  cmp rsi, qword ptr [rbp-8976]
+  jne .L.else.main.624
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8984]
+  mov r9, qword ptr [rbp-8976]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.625
+.L.else.main.624:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8984]
+  mov r9, qword ptr [rbp-8968]
+  mov r10, qword ptr [rbp-8976]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.625:
+  mov qword ptr [rbp-8944], 1
+  mov rsi, 1
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rbp-17372], sil
+  movsx rsi, byte ptr [rbp-17372]
+  add rsi, 1
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rbp-17372], sil
+  movsx rsi, byte ptr [rbp-17372]
+  mov qword ptr [rbp-8952], rsi
+  lea rsi, [rip+.L.data.main.244]
+  mov qword ptr [rbp-8960], rsi
+  mov rsi, qword ptr [rbp-8944]
+  cmp rsi, qword ptr [rbp-8952]
+  jne .L.else.main.626
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8960]
+  mov r9, qword ptr [rbp-8952]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.627
+.L.else.main.626:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8960]
+  mov r9, qword ptr [rbp-8944]
+  mov r10, qword ptr [rbp-8952]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.627:
+  mov qword ptr [rbp-8920], 0
+  mov rsi, 0
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rbp-17371], sil
+  movsx rsi, byte ptr [rbp-17371]
+  mov rdi, rsi
+  sub rsi, 1
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rbp-17371], sil
+  mov qword ptr [rbp-8928], rdi
+  lea rsi, [rip+.L.data.main.245]
+  mov qword ptr [rbp-8936], rsi
+  mov rsi, qword ptr [rbp-8920]
+  cmp rsi, qword ptr [rbp-8928]
+  jne .L.else.main.628
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8936]
+  mov r9, qword ptr [rbp-8928]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.629
+.L.else.main.628:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8936]
+  mov r9, qword ptr [rbp-8920]
+  mov r10, qword ptr [rbp-8928]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.629:
+  mov qword ptr [rbp-8896], 1
+  mov rsi, 0
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rbp-17370], sil
+  movsx rsi, byte ptr [rbp-17370]
+  sub rsi, 1
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rbp-17370], sil
+  movsx rsi, byte ptr [rbp-17370]
+  mov qword ptr [rbp-8904], rsi
+  lea rsi, [rip+.L.data.main.246]
+  mov qword ptr [rbp-8912], rsi
+  mov rsi, qword ptr [rbp-8896]
+  cmp rsi, qword ptr [rbp-8904]
+  jne .L.else.main.630
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8912]
+  mov r9, qword ptr [rbp-8904]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.631
+.L.else.main.630:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8912]
+  mov r9, qword ptr [rbp-8896]
+  mov r10, qword ptr [rbp-8904]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.631:
+  mov qword ptr [rbp-8872], 1
+  mov rsi, 1
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rbp-17369], sil
+  lea rsi, [rbp-17369]
+  mov qword ptr [rbp-17368], rsi
+  movsx rsi, byte ptr [rbp-17369]
+  mov rdi, rsi
+  add rsi, 1
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rbp-17369], sil
+  mov qword ptr [rbp-8880], rdi
+  lea rsi, [rip+.L.data.main.247]
+  mov qword ptr [rbp-8888], rsi
+  mov rsi, qword ptr [rbp-8872]
+  cmp rsi, qword ptr [rbp-8880]
+  jne .L.else.main.632
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8888]
+  mov r9, qword ptr [rbp-8880]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.633
+.L.else.main.632:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8888]
+  mov r9, qword ptr [rbp-8872]
+  mov r10, qword ptr [rbp-8880]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.633:
+  mov qword ptr [rbp-8848], 1
+  mov qword ptr [rbp-8856], 1
+  lea rsi, [rip+.L.data.main.248]
+  mov qword ptr [rbp-8864], rsi
+  mov rsi, qword ptr [rbp-8848]
+  cmp rsi, qword ptr [rbp-8856]
+  jne .L.else.main.634
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8864]
+  mov r9, qword ptr [rbp-8856]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.635
+.L.else.main.634:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8864]
+  mov r9, qword ptr [rbp-8848]
+  mov r10, qword ptr [rbp-8856]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.635:
+  mov qword ptr [rbp-8824], 2
+  mov qword ptr [rbp-8832], 2
+  lea rsi, [rip+.L.data.main.249]
+  mov qword ptr [rbp-8840], rsi
+  mov rsi, qword ptr [rbp-8824]
+  cmp rsi, qword ptr [rbp-8832]
+  jne .L.else.main.636
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8840]
+  mov r9, qword ptr [rbp-8832]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.637
+.L.else.main.636:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8840]
+  mov r9, qword ptr [rbp-8824]
+  mov r10, qword ptr [rbp-8832]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.637:
+  mov qword ptr [rbp-8800], 2
+  mov qword ptr [rbp-8808], 2
+  lea rsi, [rip+.L.data.main.250]
+  mov qword ptr [rbp-8816], rsi
+  mov rsi, qword ptr [rbp-8800]
+  cmp rsi, qword ptr [rbp-8808]
+  jne .L.else.main.638
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8816]
+  mov r9, qword ptr [rbp-8808]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.639
+.L.else.main.638:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8816]
+  mov r9, qword ptr [rbp-8800]
+  mov r10, qword ptr [rbp-8808]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.639:
+  mov qword ptr [rbp-8776], 4
+  mov qword ptr [rbp-8784], 4
+  lea rsi, [rip+.L.data.main.251]
+  mov qword ptr [rbp-8792], rsi
+  mov rsi, qword ptr [rbp-8776]
+  cmp rsi, qword ptr [rbp-8784]
+  jne .L.else.main.640
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8792]
+  mov r9, qword ptr [rbp-8784]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.641
+.L.else.main.640:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8792]
+  mov r9, qword ptr [rbp-8776]
+  mov r10, qword ptr [rbp-8784]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.641:
+  mov qword ptr [rbp-8752], 4
+  mov qword ptr [rbp-8760], 4
+  lea rsi, [rip+.L.data.main.252]
+  mov qword ptr [rbp-8768], rsi
+  mov rsi, qword ptr [rbp-8752]
+  cmp rsi, qword ptr [rbp-8760]
+  jne .L.else.main.642
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8768]
+  mov r9, qword ptr [rbp-8760]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.643
+.L.else.main.642:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8768]
+  mov r9, qword ptr [rbp-8752]
+  mov r10, qword ptr [rbp-8760]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.643:
+  mov qword ptr [rbp-8728], 4
+  mov qword ptr [rbp-8736], 4
+  lea rsi, [rip+.L.data.main.253]
+  mov qword ptr [rbp-8744], rsi
+  mov rsi, qword ptr [rbp-8728]
+  cmp rsi, qword ptr [rbp-8736]
+  jne .L.else.main.644
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8744]
+  mov r9, qword ptr [rbp-8736]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.645
+.L.else.main.644:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8744]
+  mov r9, qword ptr [rbp-8728]
+  mov r10, qword ptr [rbp-8736]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.645:
+  mov qword ptr [rbp-8704], 8
+  mov qword ptr [rbp-8712], 8
+  lea rsi, [rip+.L.data.main.254]
+  mov qword ptr [rbp-8720], rsi
+  mov rsi, qword ptr [rbp-8704]
+  cmp rsi, qword ptr [rbp-8712]
+  jne .L.else.main.646
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8720]
+  mov r9, qword ptr [rbp-8712]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.647
+.L.else.main.646:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8720]
+  mov r9, qword ptr [rbp-8704]
+  mov r10, qword ptr [rbp-8712]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.647:
+  mov qword ptr [rbp-8680], 8
+  mov qword ptr [rbp-8688], 8
+  lea rsi, [rip+.L.data.main.255]
+  mov qword ptr [rbp-8696], rsi
+  mov rsi, qword ptr [rbp-8680]
+  cmp rsi, qword ptr [rbp-8688]
+  jne .L.else.main.648
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8696]
+  mov r9, qword ptr [rbp-8688]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.649
+.L.else.main.648:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8696]
+  mov r9, qword ptr [rbp-8680]
+  mov r10, qword ptr [rbp-8688]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.649:
+  mov qword ptr [rbp-8656], 8
+  mov qword ptr [rbp-8664], 8
+  lea rsi, [rip+.L.data.main.256]
+  mov qword ptr [rbp-8672], rsi
+  mov rsi, qword ptr [rbp-8656]
+  cmp rsi, qword ptr [rbp-8664]
+  jne .L.else.main.650
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8672]
+  mov r9, qword ptr [rbp-8664]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.651
+.L.else.main.650:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8672]
+  mov r9, qword ptr [rbp-8656]
+  mov r10, qword ptr [rbp-8664]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.651:
+  mov qword ptr [rbp-8632], 8
+  mov qword ptr [rbp-8640], 8
+  lea rsi, [rip+.L.data.main.257]
+  mov qword ptr [rbp-8648], rsi
+  mov rsi, qword ptr [rbp-8632]
+  cmp rsi, qword ptr [rbp-8640]
+  jne .L.else.main.652
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8648]
+  mov r9, qword ptr [rbp-8640]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.653
+.L.else.main.652:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8648]
+  mov r9, qword ptr [rbp-8632]
+  mov r10, qword ptr [rbp-8640]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.653:
+  mov qword ptr [rbp-8608], 3
+  mov dword ptr [rbp-17304], 3
+  movsxd rsi, dword ptr [rbp-17304]
+  mov qword ptr [rbp-8616], rsi
+  lea rsi, [rip+.L.data.main.258]
+  mov qword ptr [rbp-8624], rsi
+  mov rsi, qword ptr [rbp-8608]
+  cmp rsi, qword ptr [rbp-8616]
+  jne .L.else.main.654
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8624]
+  mov r9, qword ptr [rbp-8616]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.655
+.L.else.main.654:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8624]
+  mov r9, qword ptr [rbp-8608]
+  mov r10, qword ptr [rbp-8616]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.655:
+  mov qword ptr [rbp-8584], 1
+  mov qword ptr [rbp-8592], 1
+  lea rsi, [rip+.L.data.main.259]
+  mov qword ptr [rbp-8600], rsi
+  mov rsi, qword ptr [rbp-8584]
+  cmp rsi, qword ptr [rbp-8592]
+  jne .L.else.main.656
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8600]
+  mov r9, qword ptr [rbp-8592]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.657
+.L.else.main.656:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8600]
+  mov r9, qword ptr [rbp-8584]
+  mov r10, qword ptr [rbp-8592]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.657:
+  mov qword ptr [rbp-8560], 2
+  mov qword ptr [rbp-8568], 2
+  lea rsi, [rip+.L.data.main.260]
+  mov qword ptr [rbp-8576], rsi
+  mov rsi, qword ptr [rbp-8560]
+  cmp rsi, qword ptr [rbp-8568]
+  jne .L.else.main.658
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8576]
+  mov r9, qword ptr [rbp-8568]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.659
+.L.else.main.658:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8576]
+  mov r9, qword ptr [rbp-8560]
+  mov r10, qword ptr [rbp-8568]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.659:
+  mov qword ptr [rbp-8536], 2
+  mov qword ptr [rbp-8544], 2
+  lea rsi, [rip+.L.data.main.261]
+  mov qword ptr [rbp-8552], rsi
+  mov rsi, qword ptr [rbp-8536]
+  cmp rsi, qword ptr [rbp-8544]
+  jne .L.else.main.660
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8552]
+  mov r9, qword ptr [rbp-8544]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.661
+.L.else.main.660:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8552]
+  mov r9, qword ptr [rbp-8536]
+  mov r10, qword ptr [rbp-8544]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.661:
+  mov qword ptr [rbp-8512], 2
+  mov qword ptr [rbp-8520], 2
+  lea rsi, [rip+.L.data.main.262]
+  mov qword ptr [rbp-8528], rsi
+  mov rsi, qword ptr [rbp-8512]
+  cmp rsi, qword ptr [rbp-8520]
+  jne .L.else.main.662
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8528]
+  mov r9, qword ptr [rbp-8520]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.663
+.L.else.main.662:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8528]
+  mov r9, qword ptr [rbp-8512]
+  mov r10, qword ptr [rbp-8520]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.663:
+  mov qword ptr [rbp-8488], 4
+  mov qword ptr [rbp-8496], 4
+  lea rsi, [rip+.L.data.main.263]
+  mov qword ptr [rbp-8504], rsi
+  mov rsi, qword ptr [rbp-8488]
+  cmp rsi, qword ptr [rbp-8496]
+  jne .L.else.main.664
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8504]
+  mov r9, qword ptr [rbp-8496]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.665
+.L.else.main.664:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8504]
+  mov r9, qword ptr [rbp-8488]
+  mov r10, qword ptr [rbp-8496]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.665:
+  mov qword ptr [rbp-8464], 8
+  mov qword ptr [rbp-8472], 8
+  lea rsi, [rip+.L.data.main.264]
+  mov qword ptr [rbp-8480], rsi
+  mov rsi, qword ptr [rbp-8464]
+  cmp rsi, qword ptr [rbp-8472]
+  jne .L.else.main.666
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8480]
+  mov r9, qword ptr [rbp-8472]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.667
+.L.else.main.666:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8480]
+  mov r9, qword ptr [rbp-8464]
+  mov r10, qword ptr [rbp-8472]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.667:
+  mov qword ptr [rbp-8440], 8
+  mov qword ptr [rbp-8448], 8
+  lea rsi, [rip+.L.data.main.265]
+  mov qword ptr [rbp-8456], rsi
+  mov rsi, qword ptr [rbp-8440]
+  cmp rsi, qword ptr [rbp-8448]
+  jne .L.else.main.668
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8456]
+  mov r9, qword ptr [rbp-8448]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.669
+.L.else.main.668:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8456]
+  mov r9, qword ptr [rbp-8440]
+  mov r10, qword ptr [rbp-8448]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.669:
+  mov qword ptr [rbp-8416], 8
+  mov qword ptr [rbp-8424], 8
+  lea rsi, [rip+.L.data.main.266]
+  mov qword ptr [rbp-8432], rsi
+  mov rsi, qword ptr [rbp-8416]
+  cmp rsi, qword ptr [rbp-8424]
+  jne .L.else.main.670
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8432]
+  mov r9, qword ptr [rbp-8424]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.671
+.L.else.main.670:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8432]
+  mov r9, qword ptr [rbp-8416]
+  mov r10, qword ptr [rbp-8424]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.671:
+  mov qword ptr [rbp-8392], 8
+  mov qword ptr [rbp-8400], 8
+  lea rsi, [rip+.L.data.main.267]
+  mov qword ptr [rbp-8408], rsi
+  mov rsi, qword ptr [rbp-8392]
+  cmp rsi, qword ptr [rbp-8400]
+  jne .L.else.main.672
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8408]
+  mov r9, qword ptr [rbp-8400]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.673
+.L.else.main.672:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8408]
+  mov r9, qword ptr [rbp-8392]
+  mov r10, qword ptr [rbp-8400]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.673:
+  mov qword ptr [rbp-8368], 8
+  mov qword ptr [rbp-8376], 8
+  lea rsi, [rip+.L.data.main.268]
+  mov qword ptr [rbp-8384], rsi
+  mov rsi, qword ptr [rbp-8368]
+  cmp rsi, qword ptr [rbp-8376]
+  jne .L.else.main.674
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8384]
+  mov r9, qword ptr [rbp-8376]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.675
+.L.else.main.674:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8384]
+  mov r9, qword ptr [rbp-8368]
+  mov r10, qword ptr [rbp-8376]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.675:
+  mov qword ptr [rbp-8344], 8
+  mov qword ptr [rbp-8352], 8
+  lea rsi, [rip+.L.data.main.269]
+  mov qword ptr [rbp-8360], rsi
+  mov rsi, qword ptr [rbp-8344]
+  cmp rsi, qword ptr [rbp-8352]
+  jne .L.else.main.676
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8360]
+  mov r9, qword ptr [rbp-8352]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.677
+.L.else.main.676:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8360]
+  mov r9, qword ptr [rbp-8344]
+  mov r10, qword ptr [rbp-8352]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.677:
+  mov qword ptr [rbp-8320], 8
+  mov qword ptr [rbp-8328], 8
+  lea rsi, [rip+.L.data.main.270]
+  mov qword ptr [rbp-8336], rsi
+  mov rsi, qword ptr [rbp-8320]
+  cmp rsi, qword ptr [rbp-8328]
+  jne .L.else.main.678
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8336]
+  mov r9, qword ptr [rbp-8328]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.679
+.L.else.main.678:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8336]
+  mov r9, qword ptr [rbp-8320]
+  mov r10, qword ptr [rbp-8328]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.679:
+  mov qword ptr [rbp-8296], 8
+  mov qword ptr [rbp-8304], 8
+  lea rsi, [rip+.L.data.main.271]
+  mov qword ptr [rbp-8312], rsi
+  mov rsi, qword ptr [rbp-8296]
+  cmp rsi, qword ptr [rbp-8304]
+  jne .L.else.main.680
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8312]
+  mov r9, qword ptr [rbp-8304]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.681
+.L.else.main.680:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8312]
+  mov r9, qword ptr [rbp-8296]
+  mov r10, qword ptr [rbp-8304]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.681:
+  mov qword ptr [rbp-8272], 32
+  mov qword ptr [rbp-8280], 32
+  lea rsi, [rip+.L.data.main.272]
+  mov qword ptr [rbp-8288], rsi
+  mov rsi, qword ptr [rbp-8272]
+  cmp rsi, qword ptr [rbp-8280]
+  jne .L.else.main.682
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8288]
+  mov r9, qword ptr [rbp-8280]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.683
+.L.else.main.682:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8288]
+  mov r9, qword ptr [rbp-8272]
+  mov r10, qword ptr [rbp-8280]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.683:
+  mov qword ptr [rbp-8248], 16
+  mov qword ptr [rbp-8256], 16
+  lea rsi, [rip+.L.data.main.273]
+  mov qword ptr [rbp-8264], rsi
+  mov rsi, qword ptr [rbp-8248]
+  cmp rsi, qword ptr [rbp-8256]
+  jne .L.else.main.684
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8264]
+  mov r9, qword ptr [rbp-8256]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.685
+.L.else.main.684:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8264]
+  mov r9, qword ptr [rbp-8248]
+  mov r10, qword ptr [rbp-8256]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.685:
+  mov qword ptr [rbp-8224], 48
+  mov qword ptr [rbp-8232], 48
+  lea rsi, [rip+.L.data.main.274]
+  mov qword ptr [rbp-8240], rsi
+  mov rsi, qword ptr [rbp-8224]
+  cmp rsi, qword ptr [rbp-8232]
+  jne .L.else.main.686
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8240]
+  mov r9, qword ptr [rbp-8232]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.687
+.L.else.main.686:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8240]
+  mov r9, qword ptr [rbp-8224]
+  mov r10, qword ptr [rbp-8232]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.687:
+  mov qword ptr [rbp-8200], 8
+  mov qword ptr [rbp-8208], 8
+  lea rsi, [rip+.L.data.main.275]
+  mov qword ptr [rbp-8216], rsi
+  mov rsi, qword ptr [rbp-8200]
+  cmp rsi, qword ptr [rbp-8208]
+  jne .L.else.main.688
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8216]
+  mov r9, qword ptr [rbp-8208]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.689
+.L.else.main.688:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8216]
+  mov r9, qword ptr [rbp-8200]
+  mov r10, qword ptr [rbp-8208]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.689:
+  mov qword ptr [rbp-8176], 131585
+  mov qword ptr [rbp-8184], 131585
+  lea rsi, [rip+.L.data.main.276]
+  mov qword ptr [rbp-8192], rsi
+  mov rsi, qword ptr [rbp-8176]
+  cmp rsi, qword ptr [rbp-8184]
+  jne .L.else.main.690
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8192]
+  mov r9, qword ptr [rbp-8184]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.691
+.L.else.main.690:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8192]
+  mov r9, qword ptr [rbp-8176]
+  mov r10, qword ptr [rbp-8184]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.691:
+  mov qword ptr [rbp-8152], 513
+  mov qword ptr [rbp-8160], 513
+  lea rsi, [rip+.L.data.main.277]
+  mov qword ptr [rbp-8168], rsi
+  mov rsi, qword ptr [rbp-8152]
+  cmp rsi, qword ptr [rbp-8160]
+  jne .L.else.main.692
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8168]
+  mov r9, qword ptr [rbp-8160]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.693
+.L.else.main.692:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8168]
+  mov r9, qword ptr [rbp-8152]
+  mov r10, qword ptr [rbp-8160]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.693:
+  mov qword ptr [rbp-8128], 1
+  mov qword ptr [rbp-8136], 1
+  lea rsi, [rip+.L.data.main.278]
+  mov qword ptr [rbp-8144], rsi
+  mov rsi, qword ptr [rbp-8128]
+  cmp rsi, qword ptr [rbp-8136]
+  jne .L.else.main.694
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8144]
+  mov r9, qword ptr [rbp-8136]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.695
+.L.else.main.694:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8144]
+  mov r9, qword ptr [rbp-8128]
+  mov r10, qword ptr [rbp-8136]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.695:
+  mov qword ptr [rbp-8104], 1
+  mov rsi, 1
+  cmp rsi, 0
+  setne sil
+  movsx rsi, sil
+  mov qword ptr [rbp-8112], rsi
+  lea rsi, [rip+.L.data.main.279]
+  mov qword ptr [rbp-8120], rsi
+  mov rsi, qword ptr [rbp-8104]
+  cmp rsi, qword ptr [rbp-8112]
+  jne .L.else.main.696
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8120]
+  mov r9, qword ptr [rbp-8112]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.697
+.L.else.main.696:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8120]
+  mov r9, qword ptr [rbp-8104]
+  mov r10, qword ptr [rbp-8112]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.697:
+  mov qword ptr [rbp-8080], 1
+  mov rsi, 2
+  cmp rsi, 0
+  setne sil
+  movsx rsi, sil
+  mov qword ptr [rbp-8088], rsi
+  lea rsi, [rip+.L.data.main.280]
+  mov qword ptr [rbp-8096], rsi
+  mov rsi, qword ptr [rbp-8080]
+  cmp rsi, qword ptr [rbp-8088]
+  jne .L.else.main.698
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8096]
+  mov r9, qword ptr [rbp-8088]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.699
+.L.else.main.698:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8096]
+  mov r9, qword ptr [rbp-8080]
+  mov r10, qword ptr [rbp-8088]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.699:
+  mov qword ptr [rbp-8056], 0
+  mov rsi, 0
+  cmp rsi, 0
+  setne sil
+  movsx rsi, sil
+  mov qword ptr [rbp-8064], rsi
+  lea rsi, [rip+.L.data.main.281]
+  mov qword ptr [rbp-8072], rsi
+  mov rsi, qword ptr [rbp-8056]
+  cmp rsi, qword ptr [rbp-8064]
+  jne .L.else.main.700
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8072]
+  mov r9, qword ptr [rbp-8064]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.701
+.L.else.main.700:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8072]
+  mov r9, qword ptr [rbp-8056]
+  mov r10, qword ptr [rbp-8064]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.701:
+  mov qword ptr [rbp-8032], 1
+  mov qword ptr [rbp-8040], 1
+  lea rsi, [rip+.L.data.main.282]
+  mov qword ptr [rbp-8048], rsi
+  mov rsi, qword ptr [rbp-8032]
+  cmp rsi, qword ptr [rbp-8040]
+  jne .L.else.main.702
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8048]
+  mov r9, qword ptr [rbp-8040]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.703
+.L.else.main.702:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8048]
+  mov r9, qword ptr [rbp-8032]
+  mov r10, qword ptr [rbp-8040]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.703:
+  mov qword ptr [rbp-8008], 0
+  mov qword ptr [rbp-8016], 0
+  lea rsi, [rip+.L.data.main.283]
+  mov qword ptr [rbp-8024], rsi
+  mov rsi, qword ptr [rbp-8008]
+  cmp rsi, qword ptr [rbp-8016]
+  jne .L.else.main.704
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8024]
+  mov r9, qword ptr [rbp-8016]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.705
+.L.else.main.704:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8024]
+  mov r9, qword ptr [rbp-8008]
+  mov r10, qword ptr [rbp-8016]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.705:
+  mov qword ptr [rbp-7984], 5
+  mov dword ptr [rbp-17300], 5
+  lea rsi, [rbp-17300]
+  mov qword ptr [rbp-17296], rsi
+  mov rsi, qword ptr [rbp-17296]
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-7992], rsi
+  lea rsi, [rip+.L.data.main.284]
+  mov qword ptr [rbp-8000], rsi
+  mov rsi, qword ptr [rbp-7984]
+  cmp rsi, qword ptr [rbp-7992]
+  jne .L.else.main.706
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-8000]
+  mov r9, qword ptr [rbp-7992]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.707
+.L.else.main.706:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-8000]
+  mov r9, qword ptr [rbp-7984]
+  mov r10, qword ptr [rbp-7992]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.707:
+  mov qword ptr [rbp-7960], 97
+  mov qword ptr [rbp-7968], 97
+  lea rsi, [rip+.L.data.main.285]
+  mov qword ptr [rbp-7976], rsi
+  mov rsi, qword ptr [rbp-7960]
+  cmp rsi, qword ptr [rbp-7968]
+  jne .L.else.main.708
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7976]
+  mov r9, qword ptr [rbp-7968]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.709
+.L.else.main.708:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7976]
+  mov r9, qword ptr [rbp-7960]
+  mov r10, qword ptr [rbp-7968]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.709:
+  mov qword ptr [rbp-7936], 10
+  mov qword ptr [rbp-7944], 10
+  lea rsi, [rip+.L.data.main.286]
+  mov qword ptr [rbp-7952], rsi
+  mov rsi, qword ptr [rbp-7936]
+  cmp rsi, qword ptr [rbp-7944]
+  jne .L.else.main.710
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7952]
+  mov r9, qword ptr [rbp-7944]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.711
+.L.else.main.710:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7952]
+  mov r9, qword ptr [rbp-7936]
+  mov r10, qword ptr [rbp-7944]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.711:
+  mov qword ptr [rbp-7912], 98
+  mov rsi, 97
+  add rsi, 1
+  mov qword ptr [rbp-7920], rsi
+  lea rsi, [rip+.L.data.main.287]
+  mov qword ptr [rbp-7928], rsi
+  mov rsi, qword ptr [rbp-7912]
+  cmp rsi, qword ptr [rbp-7920]
+  jne .L.else.main.712
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7928]
+  mov r9, qword ptr [rbp-7920]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.713
+.L.else.main.712:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7928]
+  mov r9, qword ptr [rbp-7912]
+  mov r10, qword ptr [rbp-7920]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.713:
+  mov qword ptr [rbp-7888], 4
+  mov qword ptr [rbp-7896], 4
+  lea rsi, [rip+.L.data.main.288]
+  mov qword ptr [rbp-7904], rsi
+  mov rsi, qword ptr [rbp-7888]
+  cmp rsi, qword ptr [rbp-7896]
+  jne .L.else.main.714
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7904]
+  mov r9, qword ptr [rbp-7896]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.715
+.L.else.main.714:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7904]
+  mov r9, qword ptr [rbp-7888]
+  mov r10, qword ptr [rbp-7896]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.715:
+  mov qword ptr [rbp-7864], 0
+  mov qword ptr [rbp-7872], 0
+  lea rsi, [rip+.L.data.main.289]
+  mov qword ptr [rbp-7880], rsi
+  mov rsi, qword ptr [rbp-7864]
+  cmp rsi, qword ptr [rbp-7872]
+  jne .L.else.main.716
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7880]
+  mov r9, qword ptr [rbp-7872]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.717
+.L.else.main.716:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7880]
+  mov r9, qword ptr [rbp-7864]
+  mov r10, qword ptr [rbp-7872]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.717:
+  mov qword ptr [rbp-7840], 1
+  mov qword ptr [rbp-7848], 1
+  lea rsi, [rip+.L.data.main.290]
+  mov qword ptr [rbp-7856], rsi
+  mov rsi, qword ptr [rbp-7840]
+  cmp rsi, qword ptr [rbp-7848]
+  jne .L.else.main.718
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7856]
+  mov r9, qword ptr [rbp-7848]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.719
+.L.else.main.718:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7856]
+  mov r9, qword ptr [rbp-7840]
+  mov r10, qword ptr [rbp-7848]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.719:
+  mov qword ptr [rbp-7816], 2
+  mov qword ptr [rbp-7824], 2
+  lea rsi, [rip+.L.data.main.291]
+  mov qword ptr [rbp-7832], rsi
+  mov rsi, qword ptr [rbp-7816]
+  cmp rsi, qword ptr [rbp-7824]
+  jne .L.else.main.720
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7832]
+  mov r9, qword ptr [rbp-7824]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.721
+.L.else.main.720:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7832]
+  mov r9, qword ptr [rbp-7816]
+  mov r10, qword ptr [rbp-7824]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.721:
+  mov qword ptr [rbp-7792], 5
+  mov qword ptr [rbp-7800], 5
+  lea rsi, [rip+.L.data.main.292]
+  mov qword ptr [rbp-7808], rsi
+  mov rsi, qword ptr [rbp-7792]
+  cmp rsi, qword ptr [rbp-7800]
+  jne .L.else.main.722
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7808]
+  mov r9, qword ptr [rbp-7800]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.723
+.L.else.main.722:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7808]
+  mov r9, qword ptr [rbp-7792]
+  mov r10, qword ptr [rbp-7800]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.723:
+  mov qword ptr [rbp-7768], 6
+  mov qword ptr [rbp-7776], 6
+  lea rsi, [rip+.L.data.main.293]
+  mov qword ptr [rbp-7784], rsi
+  mov rsi, qword ptr [rbp-7768]
+  cmp rsi, qword ptr [rbp-7776]
+  jne .L.else.main.724
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7784]
+  mov r9, qword ptr [rbp-7776]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.725
+.L.else.main.724:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7784]
+  mov r9, qword ptr [rbp-7768]
+  mov r10, qword ptr [rbp-7776]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.725:
+  mov qword ptr [rbp-7744], 0
+  mov qword ptr [rbp-7752], 0
+  lea rsi, [rip+.L.data.main.294]
+  mov qword ptr [rbp-7760], rsi
+  mov rsi, qword ptr [rbp-7744]
+  cmp rsi, qword ptr [rbp-7752]
+  jne .L.else.main.726
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7760]
+  mov r9, qword ptr [rbp-7752]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.727
+.L.else.main.726:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7760]
+  mov r9, qword ptr [rbp-7744]
+  mov r10, qword ptr [rbp-7752]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.727:
+  mov qword ptr [rbp-7720], 5
+  mov qword ptr [rbp-7728], 5
+  lea rsi, [rip+.L.data.main.295]
+  mov qword ptr [rbp-7736], rsi
+  mov rsi, qword ptr [rbp-7720]
+  cmp rsi, qword ptr [rbp-7728]
+  jne .L.else.main.728
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7736]
+  mov r9, qword ptr [rbp-7728]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.729
+.L.else.main.728:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7736]
+  mov r9, qword ptr [rbp-7720]
+  mov r10, qword ptr [rbp-7728]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.729:
+  mov qword ptr [rbp-7696], 3
+  mov qword ptr [rbp-7704], 3
+  lea rsi, [rip+.L.data.main.296]
+  mov qword ptr [rbp-7712], rsi
+  mov rsi, qword ptr [rbp-7696]
+  cmp rsi, qword ptr [rbp-7704]
+  jne .L.else.main.730
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7712]
+  mov r9, qword ptr [rbp-7704]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.731
+.L.else.main.730:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7712]
+  mov r9, qword ptr [rbp-7696]
+  mov r10, qword ptr [rbp-7704]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.731:
+  mov qword ptr [rbp-7672], 4
+  mov qword ptr [rbp-7680], 4
+  lea rsi, [rip+.L.data.main.297]
+  mov qword ptr [rbp-7688], rsi
+  mov rsi, qword ptr [rbp-7672]
+  cmp rsi, qword ptr [rbp-7680]
+  jne .L.else.main.732
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7688]
+  mov r9, qword ptr [rbp-7680]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.733
+.L.else.main.732:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7688]
+  mov r9, qword ptr [rbp-7672]
+  mov r10, qword ptr [rbp-7680]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.733:
+  mov qword ptr [rbp-7648], 4
+  mov qword ptr [rbp-7656], 4
+  lea rsi, [rip+.L.data.main.298]
+  mov qword ptr [rbp-7664], rsi
+  mov rsi, qword ptr [rbp-7648]
+  cmp rsi, qword ptr [rbp-7656]
+  jne .L.else.main.734
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7664]
+  mov r9, qword ptr [rbp-7656]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.735
+.L.else.main.734:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7664]
+  mov r9, qword ptr [rbp-7648]
+  mov r10, qword ptr [rbp-7656]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.735:
+  mov qword ptr [rbp-7624], 4
+  mov qword ptr [rbp-7632], 4
+  lea rsi, [rip+.L.data.main.299]
+  mov qword ptr [rbp-7640], rsi
+  mov rsi, qword ptr [rbp-7624]
+  cmp rsi, qword ptr [rbp-7632]
+  jne .L.else.main.736
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7640]
+  mov r9, qword ptr [rbp-7632]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.737
+.L.else.main.736:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7640]
+  mov r9, qword ptr [rbp-7624]
+  mov r10, qword ptr [rbp-7632]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.737:
+  mov qword ptr [rbp-7600], 3
+  mov qword ptr [rbp-7608], 3
+  lea rsi, [rip+.L.data.main.300]
+  mov qword ptr [rbp-7616], rsi
+  mov rsi, qword ptr [rbp-7600]
+  cmp rsi, qword ptr [rbp-7608]
+  jne .L.else.main.738
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7616]
+  mov r9, qword ptr [rbp-7608]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.739
+.L.else.main.738:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7616]
+  mov r9, qword ptr [rbp-7600]
+  mov r10, qword ptr [rbp-7608]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.739:
+  mov qword ptr [rbp-7576], 55
+  mov dword ptr [rbp-17280], 0
+  mov dword ptr [rbp-17276], 0
+  movsxd rsi, dword ptr [rbp-17276]
+  cmp rsi, 10
+  jg .L.break.main.741
+  .p2align 4,,10
+.L.begin.main.742:
+  movsxd rsi, dword ptr [rbp-17280]
+  movsxd rdi, dword ptr [rbp-17276]
+  add rsi, rdi
+  mov dword ptr [rbp-17280], esi
+  add dword ptr [rbp-17276], 1
+  movsxd rsi, dword ptr [rbp-17276]
+  cmp rsi, 10
+  jle .L.begin.main.742
+.L.break.main.741:
+  movsxd rsi, dword ptr [rbp-17280]
+  mov qword ptr [rbp-7584], rsi
+  lea rsi, [rip+.L.data.main.301]
+  mov qword ptr [rbp-7592], rsi
+  mov rsi, qword ptr [rbp-7576]
+  cmp rsi, qword ptr [rbp-7584]
+  jne .L.else.main.743
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7592]
+  mov r9, qword ptr [rbp-7584]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.744
+.L.else.main.743:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7592]
+  mov r9, qword ptr [rbp-7576]
+  mov r10, qword ptr [rbp-7584]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.744:
+  mov qword ptr [rbp-7552], 3
+  mov dword ptr [rbp-17272], 3
+  mov dword ptr [rbp-17268], 0
+  mov dword ptr [rbp-17264], 0
+  movsxd rsi, dword ptr [rbp-17264]
+  cmp rsi, 10
+  jg .L.break.main.746
+  .p2align 4,,10
+.L.begin.main.747:
+  movsxd rsi, dword ptr [rbp-17268]
+  movsxd rdi, dword ptr [rbp-17264]
+  add rsi, rdi
+  mov dword ptr [rbp-17268], esi
+  add dword ptr [rbp-17264], 1
+  movsxd rsi, dword ptr [rbp-17264]
+  cmp rsi, 10
+  jle .L.begin.main.747
+.L.break.main.746:
+  movsxd rsi, dword ptr [rbp-17272]
+  mov qword ptr [rbp-7560], rsi
+  lea rsi, [rip+.L.data.main.302]
+  mov qword ptr [rbp-7568], rsi
+  mov rsi, qword ptr [rbp-7552]
+  cmp rsi, qword ptr [rbp-7560]
+  jne .L.else.main.748
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7568]
+  mov r9, qword ptr [rbp-7560]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.749
+.L.else.main.748:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7568]
+  mov r9, qword ptr [rbp-7552]
+  mov r10, qword ptr [rbp-7560]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.749:
+  mov qword ptr [rbp-7528], 3
+  mov qword ptr [rbp-7536], 3
+  lea rsi, [rip+.L.data.main.303]
+  mov qword ptr [rbp-7544], rsi
+  mov rsi, qword ptr [rbp-7528]
+  cmp rsi, qword ptr [rbp-7536]
+  jne .L.else.main.750
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7544]
+  mov r9, qword ptr [rbp-7536]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.751
+.L.else.main.750:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7544]
+  mov r9, qword ptr [rbp-7528]
+  mov r10, qword ptr [rbp-7536]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.751:
+  mov qword ptr [rbp-7504], 3
+  mov dword ptr [rbp-17260], 2
+  movsxd rsi, dword ptr [rbp-17260]
+  add rsi, 1
+  mov dword ptr [rbp-17260], esi
+  mov qword ptr [rbp-7512], rsi
+  lea rsi, [rip+.L.data.main.304]
+  mov qword ptr [rbp-7520], rsi
+  mov rsi, qword ptr [rbp-7504]
+  cmp rsi, qword ptr [rbp-7512]
+  jne .L.else.main.752
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7520]
+  mov r9, qword ptr [rbp-7512]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.753
+.L.else.main.752:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7520]
+  mov r9, qword ptr [rbp-7504]
+  mov r10, qword ptr [rbp-7512]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.753:
+  mov qword ptr [rbp-7480], 1
+  mov dword ptr [rbp-17256], 2
+  movsxd rsi, dword ptr [rbp-17256]
+  sub rsi, 1
+  mov dword ptr [rbp-17256], esi
+  mov qword ptr [rbp-7488], rsi
+  lea rsi, [rip+.L.data.main.305]
+  mov qword ptr [rbp-7496], rsi
+  mov rsi, qword ptr [rbp-7480]
+  cmp rsi, qword ptr [rbp-7488]
+  jne .L.else.main.754
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7496]
+  mov r9, qword ptr [rbp-7488]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.755
+.L.else.main.754:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7496]
+  mov r9, qword ptr [rbp-7480]
+  mov r10, qword ptr [rbp-7488]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.755:
+  mov qword ptr [rbp-7456], 2
+  mov dword ptr [rbp-17252], 2
+  movsxd rsi, dword ptr [rbp-17252]
+  add rsi, 1
+  mov dword ptr [rbp-17252], esi
+  sub rsi, 1
+  mov qword ptr [rbp-7464], rsi
+  lea rsi, [rip+.L.data.main.306]
+  mov qword ptr [rbp-7472], rsi
+  mov rsi, qword ptr [rbp-7456]
+  cmp rsi, qword ptr [rbp-7464]
+  jne .L.else.main.756
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7472]
+  mov r9, qword ptr [rbp-7464]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.757
+.L.else.main.756:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7472]
+  mov r9, qword ptr [rbp-7456]
+  mov r10, qword ptr [rbp-7464]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.757:
+  mov qword ptr [rbp-7432], 2
+  mov dword ptr [rbp-17248], 2
+  movsxd rsi, dword ptr [rbp-17248]
+  sub rsi, 1
+  mov dword ptr [rbp-17248], esi
+  add rsi, 1
+  mov qword ptr [rbp-7440], rsi
+  lea rsi, [rip+.L.data.main.307]
+  mov qword ptr [rbp-7448], rsi
+  mov rsi, qword ptr [rbp-7432]
+  cmp rsi, qword ptr [rbp-7440]
+  jne .L.else.main.758
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7448]
+  mov r9, qword ptr [rbp-7440]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.759
+.L.else.main.758:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7448]
+  mov r9, qword ptr [rbp-7432]
+  mov r10, qword ptr [rbp-7440]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.759:
+  mov qword ptr [rbp-7408], 3
+  mov dword ptr [rbp-17244], 2
+  add dword ptr [rbp-17244], 1
+  movsxd rsi, dword ptr [rbp-17244]
+  mov qword ptr [rbp-7416], rsi
+  lea rsi, [rip+.L.data.main.308]
+  mov qword ptr [rbp-7424], rsi
+  mov rsi, qword ptr [rbp-7408]
+  cmp rsi, qword ptr [rbp-7416]
+  jne .L.else.main.760
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7424]
+  mov r9, qword ptr [rbp-7416]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.761
+.L.else.main.760:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7424]
+  mov r9, qword ptr [rbp-7408]
+  mov r10, qword ptr [rbp-7416]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.761:
+  mov qword ptr [rbp-7384], 1
+  mov dword ptr [rbp-17240], 2
+  sub dword ptr [rbp-17240], 1
+  movsxd rsi, dword ptr [rbp-17240]
+  mov qword ptr [rbp-7392], rsi
+  lea rsi, [rip+.L.data.main.309]
+  mov qword ptr [rbp-7400], rsi
+  mov rsi, qword ptr [rbp-7384]
+  cmp rsi, qword ptr [rbp-7392]
+  jne .L.else.main.762
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7400]
+  mov r9, qword ptr [rbp-7392]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.763
+.L.else.main.762:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7400]
+  mov r9, qword ptr [rbp-7384]
+  mov r10, qword ptr [rbp-7392]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.763:
+  mov qword ptr [rbp-7360], 1
+  lea rsi, [rbp-17236]
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rbp-17236]
+  add rsi, 4
+  mov dword ptr [rsi], 1
+  lea rsi, [rbp-17236]
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  lea rsi, [rbp-17236]
+  add rsi, 4
+  mov qword ptr [rbp-17224], rsi
+  mov rsi, qword ptr [rbp-17224]
+  add rsi, 4
+  mov qword ptr [rbp-17224], rsi
+  sub rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-7368], rsi
+  lea rsi, [rip+.L.data.main.310]
+  mov qword ptr [rbp-7376], rsi
+  mov rsi, qword ptr [rbp-7360]
+  cmp rsi, qword ptr [rbp-7368]
+  jne .L.else.main.764
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7376]
+  mov r9, qword ptr [rbp-7368]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.765
+.L.else.main.764:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7376]
+  mov r9, qword ptr [rbp-7360]
+  mov r10, qword ptr [rbp-7368]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.765:
+  mov qword ptr [rbp-7336], 2
+  lea rsi, [rbp-17212]
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rbp-17212]
+  add rsi, 4
+  mov dword ptr [rsi], 1
+  lea rsi, [rbp-17212]
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  lea rsi, [rbp-17212]
+  add rsi, 4
+  mov qword ptr [rbp-17200], rsi
+  mov rsi, qword ptr [rbp-17200]
+  movsxd rdi, dword ptr [rsi]
+  add rdi, 1
+  mov dword ptr [rsi], edi
+  mov qword ptr [rbp-7344], rdi
+  lea rsi, [rip+.L.data.main.311]
+  mov qword ptr [rbp-7352], rsi
+  mov rsi, qword ptr [rbp-7336]
+  cmp rsi, qword ptr [rbp-7344]
+  jne .L.else.main.766
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7352]
+  mov r9, qword ptr [rbp-7344]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.767
+.L.else.main.766:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7352]
+  mov r9, qword ptr [rbp-7336]
+  mov r10, qword ptr [rbp-7344]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.767:
+  mov qword ptr [rbp-7312], 1
+  lea rsi, [rbp-17188]
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rbp-17188]
+  add rsi, 4
+  mov dword ptr [rsi], 1
+  lea rsi, [rbp-17188]
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  lea rsi, [rbp-17188]
+  add rsi, 4
+  mov qword ptr [rbp-17176], rsi
+  mov rsi, qword ptr [rbp-17176]
+  sub rsi, 4
+  mov qword ptr [rbp-17176], rsi
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-7320], rsi
+  lea rsi, [rip+.L.data.main.312]
+  mov qword ptr [rbp-7328], rsi
+  mov rsi, qword ptr [rbp-7312]
+  cmp rsi, qword ptr [rbp-7320]
+  jne .L.else.main.768
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7328]
+  mov r9, qword ptr [rbp-7320]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.769
+.L.else.main.768:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7328]
+  mov r9, qword ptr [rbp-7312]
+  mov r10, qword ptr [rbp-7320]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.769:
+  mov qword ptr [rbp-7288], 0
+  lea rsi, [rbp-17164]
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rbp-17164]
+  add rsi, 4
+  mov dword ptr [rsi], 1
+  lea rsi, [rbp-17164]
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  lea rsi, [rbp-17164]
+  add rsi, 4
+  mov qword ptr [rbp-17152], rsi
+  mov rsi, qword ptr [rbp-17152]
+  movsxd rdi, dword ptr [rsi]
+  sub rdi, 1
+  mov dword ptr [rsi], edi
+  mov qword ptr [rbp-7296], rdi
+  lea rsi, [rip+.L.data.main.313]
+  mov qword ptr [rbp-7304], rsi
+  mov rsi, qword ptr [rbp-7288]
+  cmp rsi, qword ptr [rbp-7296]
+  jne .L.else.main.770
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7304]
+  mov r9, qword ptr [rbp-7296]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.771
+.L.else.main.770:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7304]
+  mov r9, qword ptr [rbp-7288]
+  mov r10, qword ptr [rbp-7296]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.771:
+  mov qword ptr [rbp-7264], 0
+  lea rsi, [rbp-17140]
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rbp-17140]
+  add rsi, 4
+  mov dword ptr [rsi], 1
+  lea rsi, [rbp-17140]
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  lea rsi, [rbp-17140]
+  add rsi, 4
+  mov qword ptr [rbp-17128], rsi
+  mov rsi, qword ptr [rbp-17128]
+  add rsi, 4
+  mov qword ptr [rbp-17128], rsi
+  sub rsi, 4
+  sub dword ptr [rsi], 1
+  lea rsi, [rbp-17140]
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-7272], rsi
+  lea rsi, [rip+.L.data.main.314]
+  mov qword ptr [rbp-7280], rsi
+  mov rsi, qword ptr [rbp-7264]
+  cmp rsi, qword ptr [rbp-7272]
+  jne .L.else.main.772
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7280]
+  mov r9, qword ptr [rbp-7272]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.773
+.L.else.main.772:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7280]
+  mov r9, qword ptr [rbp-7264]
+  mov r10, qword ptr [rbp-7272]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.773:
+  mov qword ptr [rbp-7240], 0
+  lea rsi, [rbp-17116]
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rbp-17116]
+  add rsi, 4
+  mov dword ptr [rsi], 1
+  lea rsi, [rbp-17116]
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  lea rsi, [rbp-17116]
+  add rsi, 4
+  mov qword ptr [rbp-17104], rsi
+  mov rsi, qword ptr [rbp-17104]
+  add rsi, 4
+  mov qword ptr [rbp-17104], rsi
+  sub rsi, 4
+  sub dword ptr [rsi], 1
+  lea rsi, [rbp-17116]
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-7248], rsi
+  lea rsi, [rip+.L.data.main.315]
+  mov qword ptr [rbp-7256], rsi
+  mov rsi, qword ptr [rbp-7240]
+  cmp rsi, qword ptr [rbp-7248]
+  jne .L.else.main.774
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7256]
+  mov r9, qword ptr [rbp-7248]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.775
+.L.else.main.774:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7256]
+  mov r9, qword ptr [rbp-7240]
+  mov r10, qword ptr [rbp-7248]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.775:
+  mov qword ptr [rbp-7216], 2
+  lea rsi, [rbp-17092]
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rbp-17092]
+  add rsi, 4
+  mov dword ptr [rsi], 1
+  lea rsi, [rbp-17092]
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  lea rsi, [rbp-17092]
+  add rsi, 4
+  mov qword ptr [rbp-17080], rsi
+  mov rsi, qword ptr [rbp-17080]
+  add rsi, 4
+  mov qword ptr [rbp-17080], rsi
+  sub rsi, 4
+  sub dword ptr [rsi], 1
+  lea rsi, [rbp-17092]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-7224], rsi
+  lea rsi, [rip+.L.data.main.316]
+  mov qword ptr [rbp-7232], rsi
+  mov rsi, qword ptr [rbp-7216]
+  cmp rsi, qword ptr [rbp-7224]
+  jne .L.else.main.776
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7232]
+  mov r9, qword ptr [rbp-7224]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.777
+.L.else.main.776:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7232]
+  mov r9, qword ptr [rbp-7216]
+  mov r10, qword ptr [rbp-7224]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.777:
+  mov qword ptr [rbp-7192], 2
+  lea rsi, [rbp-17068]
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rbp-17068]
+  add rsi, 4
+  mov dword ptr [rsi], 1
+  lea rsi, [rbp-17068]
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  lea rsi, [rbp-17068]
+  add rsi, 4
+  mov qword ptr [rbp-17056], rsi
+  mov rsi, qword ptr [rbp-17056]
+  add rsi, 4
+  mov qword ptr [rbp-17056], rsi
+  sub rsi, 4
+  sub dword ptr [rsi], 1
+  mov rsi, qword ptr [rbp-17056]
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-7200], rsi
+  lea rsi, [rip+.L.data.main.317]
+  mov qword ptr [rbp-7208], rsi
+  mov rsi, qword ptr [rbp-7192]
+  cmp rsi, qword ptr [rbp-7200]
+  jne .L.else.main.778
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7208]
+  mov r9, qword ptr [rbp-7200]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.779
+.L.else.main.778:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7208]
+  mov r9, qword ptr [rbp-7192]
+  mov r10, qword ptr [rbp-7200]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.779:
+  mov qword ptr [rbp-7168], 7
+  mov dword ptr [rbp-17044], 2
+  add dword ptr [rbp-17044], 5
+  movsxd rsi, dword ptr [rbp-17044]
+  mov qword ptr [rbp-7176], rsi
+  lea rsi, [rip+.L.data.main.318]
+  mov qword ptr [rbp-7184], rsi
+  mov rsi, qword ptr [rbp-7168]
+  cmp rsi, qword ptr [rbp-7176]
+  jne .L.else.main.780
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7184]
+  mov r9, qword ptr [rbp-7176]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.781
+.L.else.main.780:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7184]
+  mov r9, qword ptr [rbp-7168]
+  mov r10, qword ptr [rbp-7176]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.781:
+  mov qword ptr [rbp-7144], 7
+  mov dword ptr [rbp-17040], 2
+  movsxd rsi, dword ptr [rbp-17040]
+  add rsi, 5
+  mov dword ptr [rbp-17040], esi
+  mov qword ptr [rbp-7152], rsi
+  lea rsi, [rip+.L.data.main.319]
+  mov qword ptr [rbp-7160], rsi
+  mov rsi, qword ptr [rbp-7144]
+  cmp rsi, qword ptr [rbp-7152]
+  jne .L.else.main.782
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7160]
+  mov r9, qword ptr [rbp-7152]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.783
+.L.else.main.782:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7160]
+  mov r9, qword ptr [rbp-7144]
+  mov r10, qword ptr [rbp-7152]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.783:
+  mov qword ptr [rbp-7120], 3
+  mov dword ptr [rbp-17036], 5
+  sub dword ptr [rbp-17036], 2
+  movsxd rsi, dword ptr [rbp-17036]
+  mov qword ptr [rbp-7128], rsi
+  lea rsi, [rip+.L.data.main.320]
+  mov qword ptr [rbp-7136], rsi
+  mov rsi, qword ptr [rbp-7120]
+  cmp rsi, qword ptr [rbp-7128]
+  jne .L.else.main.784
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7136]
+  mov r9, qword ptr [rbp-7128]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.785
+.L.else.main.784:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7136]
+  mov r9, qword ptr [rbp-7120]
+  mov r10, qword ptr [rbp-7128]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.785:
+  mov qword ptr [rbp-7096], 3
+  mov dword ptr [rbp-17032], 5
+  movsxd rsi, dword ptr [rbp-17032]
+  sub rsi, 2
+  mov dword ptr [rbp-17032], esi
+  mov qword ptr [rbp-7104], rsi
+  lea rsi, [rip+.L.data.main.321]
+  mov qword ptr [rbp-7112], rsi
+  mov rsi, qword ptr [rbp-7096]
+  cmp rsi, qword ptr [rbp-7104]
+  jne .L.else.main.786
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7112]
+  mov r9, qword ptr [rbp-7104]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.787
+.L.else.main.786:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7112]
+  mov r9, qword ptr [rbp-7096]
+  mov r10, qword ptr [rbp-7104]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.787:
+  mov qword ptr [rbp-7072], 6
+  mov dword ptr [rbp-17028], 3
+  shl dword ptr [rbp-17028], 1
+  movsxd rsi, dword ptr [rbp-17028]
+  mov qword ptr [rbp-7080], rsi
+  lea rsi, [rip+.L.data.main.322]
+  mov qword ptr [rbp-7088], rsi
+  mov rsi, qword ptr [rbp-7072]
+  cmp rsi, qword ptr [rbp-7080]
+  jne .L.else.main.788
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7088]
+  mov r9, qword ptr [rbp-7080]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.789
+.L.else.main.788:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7088]
+  mov r9, qword ptr [rbp-7072]
+  mov r10, qword ptr [rbp-7080]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.789:
+  mov qword ptr [rbp-7048], 6
+  mov dword ptr [rbp-17024], 3
+  movsxd rsi, dword ptr [rbp-17024]
+  shl rsi, 1
+  mov dword ptr [rbp-17024], esi
+  mov qword ptr [rbp-7056], rsi
+  lea rsi, [rip+.L.data.main.323]
+  mov qword ptr [rbp-7064], rsi
+  mov rsi, qword ptr [rbp-7048]
+  cmp rsi, qword ptr [rbp-7056]
+  jne .L.else.main.790
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7064]
+  mov r9, qword ptr [rbp-7056]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.791
+.L.else.main.790:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7064]
+  mov r9, qword ptr [rbp-7048]
+  mov r10, qword ptr [rbp-7056]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.791:
+  mov qword ptr [rbp-7024], 3
+  mov dword ptr [rbp-17020], 6
+  movsxd rsi, dword ptr [rbp-17020]
+  mov rdi, rsi
+  sar rdi, 63
+  and rdi, 1
+  add rsi, rdi
+  sar rsi, 1
+  mov dword ptr [rbp-17020], esi
+  movsxd rsi, dword ptr [rbp-17020]
+  mov qword ptr [rbp-7032], rsi
+  lea rsi, [rip+.L.data.main.324]
+  mov qword ptr [rbp-7040], rsi
+  mov rsi, qword ptr [rbp-7024]
+  cmp rsi, qword ptr [rbp-7032]
+  jne .L.else.main.792
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7040]
+  mov r9, qword ptr [rbp-7032]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.793
+.L.else.main.792:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7040]
+  mov r9, qword ptr [rbp-7024]
+  mov r10, qword ptr [rbp-7032]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.793:
+  mov qword ptr [rbp-7000], 3
+  mov dword ptr [rbp-17016], 6
+  movsxd rsi, dword ptr [rbp-17016]
+  mov rdi, rsi
+  sar rdi, 63
+  and rdi, 1
+  add rsi, rdi
+  sar rsi, 1
+  mov dword ptr [rbp-17016], esi
+  mov qword ptr [rbp-7008], rsi
+  lea rsi, [rip+.L.data.main.325]
+  mov qword ptr [rbp-7016], rsi
+  mov rsi, qword ptr [rbp-7000]
+  cmp rsi, qword ptr [rbp-7008]
+  jne .L.else.main.794
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-7016]
+  mov r9, qword ptr [rbp-7008]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.795
+.L.else.main.794:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-7016]
+  mov r9, qword ptr [rbp-7000]
+  mov r10, qword ptr [rbp-7008]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.795:
+  mov qword ptr [rbp-6976], 511
+  mov qword ptr [rbp-6984], 511
+  lea rsi, [rip+.L.data.main.326]
+  mov qword ptr [rbp-6992], rsi
+  mov rsi, qword ptr [rbp-6976]
+  cmp rsi, qword ptr [rbp-6984]
+  jne .L.else.main.796
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6992]
+  mov r9, qword ptr [rbp-6984]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.797
+.L.else.main.796:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6992]
+  mov r9, qword ptr [rbp-6976]
+  mov r10, qword ptr [rbp-6984]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.797:
+  mov qword ptr [rbp-6952], 0
+  mov qword ptr [rbp-6960], 0
+  lea rsi, [rip+.L.data.main.327]
+  mov qword ptr [rbp-6968], rsi
+  mov rsi, qword ptr [rbp-6952]
+  cmp rsi, qword ptr [rbp-6960]
+  jne .L.else.main.798
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6968]
+  mov r9, qword ptr [rbp-6960]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.799
+.L.else.main.798:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6968]
+  mov r9, qword ptr [rbp-6952]
+  mov r10, qword ptr [rbp-6960]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.799:
+  mov qword ptr [rbp-6928], 10
+  mov qword ptr [rbp-6936], 10
+  lea rsi, [rip+.L.data.main.328]
+  mov qword ptr [rbp-6944], rsi
+  mov rsi, qword ptr [rbp-6928]
+  cmp rsi, qword ptr [rbp-6936]
+  jne .L.else.main.800
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6944]
+  mov r9, qword ptr [rbp-6936]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.801
+.L.else.main.800:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6944]
+  mov r9, qword ptr [rbp-6928]
+  mov r10, qword ptr [rbp-6936]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.801:
+  mov qword ptr [rbp-6904], 10
+  mov qword ptr [rbp-6912], 10
+  lea rsi, [rip+.L.data.main.329]
+  mov qword ptr [rbp-6920], rsi
+  mov rsi, qword ptr [rbp-6904]
+  cmp rsi, qword ptr [rbp-6912]
+  jne .L.else.main.802
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6920]
+  mov r9, qword ptr [rbp-6912]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.803
+.L.else.main.802:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6920]
+  mov r9, qword ptr [rbp-6904]
+  mov r10, qword ptr [rbp-6912]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.803:
+  mov qword ptr [rbp-6880], 48879
+  mov qword ptr [rbp-6888], 48879
+  lea rsi, [rip+.L.data.main.330]
+  mov qword ptr [rbp-6896], rsi
+  mov rsi, qword ptr [rbp-6880]
+  cmp rsi, qword ptr [rbp-6888]
+  jne .L.else.main.804
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6896]
+  mov r9, qword ptr [rbp-6888]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.805
+.L.else.main.804:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6896]
+  mov r9, qword ptr [rbp-6880]
+  mov r10, qword ptr [rbp-6888]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.805:
+  mov qword ptr [rbp-6856], 48879
+  mov qword ptr [rbp-6864], 48879
+  lea rsi, [rip+.L.data.main.331]
+  mov qword ptr [rbp-6872], rsi
+  mov rsi, qword ptr [rbp-6856]
+  cmp rsi, qword ptr [rbp-6864]
+  jne .L.else.main.806
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6872]
+  mov r9, qword ptr [rbp-6864]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.807
+.L.else.main.806:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6872]
+  mov r9, qword ptr [rbp-6856]
+  mov r10, qword ptr [rbp-6864]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.807:
+  mov qword ptr [rbp-6832], 48879
+  mov qword ptr [rbp-6840], 48879
+  lea rsi, [rip+.L.data.main.332]
+  mov qword ptr [rbp-6848], rsi
+  mov rsi, qword ptr [rbp-6832]
+  cmp rsi, qword ptr [rbp-6840]
+  jne .L.else.main.808
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6848]
+  mov r9, qword ptr [rbp-6840]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.809
+.L.else.main.808:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6848]
+  mov r9, qword ptr [rbp-6832]
+  mov r10, qword ptr [rbp-6840]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.809:
+  mov qword ptr [rbp-6808], 0
+  mov qword ptr [rbp-6816], 0
+  lea rsi, [rip+.L.data.main.333]
+  mov qword ptr [rbp-6824], rsi
+  mov rsi, qword ptr [rbp-6808]
+  cmp rsi, qword ptr [rbp-6816]
+  jne .L.else.main.810
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6824]
+  mov r9, qword ptr [rbp-6816]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.811
+.L.else.main.810:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6824]
+  mov r9, qword ptr [rbp-6808]
+  mov r10, qword ptr [rbp-6816]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.811:
+  mov qword ptr [rbp-6784], 1
+  mov qword ptr [rbp-6792], 1
+  lea rsi, [rip+.L.data.main.334]
+  mov qword ptr [rbp-6800], rsi
+  mov rsi, qword ptr [rbp-6784]
+  cmp rsi, qword ptr [rbp-6792]
+  jne .L.else.main.812
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6800]
+  mov r9, qword ptr [rbp-6792]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.813
+.L.else.main.812:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6800]
+  mov r9, qword ptr [rbp-6784]
+  mov r10, qword ptr [rbp-6792]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.813:
+  mov qword ptr [rbp-6760], 47
+  mov qword ptr [rbp-6768], 47
+  lea rsi, [rip+.L.data.main.335]
+  mov qword ptr [rbp-6776], rsi
+  mov rsi, qword ptr [rbp-6760]
+  cmp rsi, qword ptr [rbp-6768]
+  jne .L.else.main.814
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6776]
+  mov r9, qword ptr [rbp-6768]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.815
+.L.else.main.814:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6776]
+  mov r9, qword ptr [rbp-6760]
+  mov r10, qword ptr [rbp-6768]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.815:
+  mov qword ptr [rbp-6736], 47
+  mov qword ptr [rbp-6744], 47
+  lea rsi, [rip+.L.data.main.336]
+  mov qword ptr [rbp-6752], rsi
+  mov rsi, qword ptr [rbp-6736]
+  cmp rsi, qword ptr [rbp-6744]
+  jne .L.else.main.816
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6752]
+  mov r9, qword ptr [rbp-6744]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.817
+.L.else.main.816:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6752]
+  mov r9, qword ptr [rbp-6736]
+  mov r10, qword ptr [rbp-6744]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.817:
+  mov qword ptr [rbp-6712], 0
+  mov rsi, 1
+  cmp rsi, 0
+  sete sil
+  movzx rsi, sil
+  mov qword ptr [rbp-6720], rsi
+  lea rsi, [rip+.L.data.main.337]
+  mov qword ptr [rbp-6728], rsi
+  mov rsi, qword ptr [rbp-6712]
+  cmp rsi, qword ptr [rbp-6720]
+  jne .L.else.main.818
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6728]
+  mov r9, qword ptr [rbp-6720]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.819
+.L.else.main.818:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6728]
+  mov r9, qword ptr [rbp-6712]
+  mov r10, qword ptr [rbp-6720]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.819:
+  mov qword ptr [rbp-6688], 0
+  mov rsi, 2
+  cmp rsi, 0
+  sete sil
+  movzx rsi, sil
+  mov qword ptr [rbp-6696], rsi
+  lea rsi, [rip+.L.data.main.338]
+  mov qword ptr [rbp-6704], rsi
+  mov rsi, qword ptr [rbp-6688]
+  cmp rsi, qword ptr [rbp-6696]
+  jne .L.else.main.820
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6704]
+  mov r9, qword ptr [rbp-6696]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.821
+.L.else.main.820:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6704]
+  mov r9, qword ptr [rbp-6688]
+  mov r10, qword ptr [rbp-6696]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.821:
+  mov qword ptr [rbp-6664], 1
+  mov rsi, 0
+  cmp rsi, 0
+  sete sil
+  movzx rsi, sil
+  mov qword ptr [rbp-6672], rsi
+  lea rsi, [rip+.L.data.main.339]
+  mov qword ptr [rbp-6680], rsi
+  mov rsi, qword ptr [rbp-6664]
+  cmp rsi, qword ptr [rbp-6672]
+  jne .L.else.main.822
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6680]
+  mov r9, qword ptr [rbp-6672]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.823
+.L.else.main.822:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6680]
+  mov r9, qword ptr [rbp-6664]
+  mov r10, qword ptr [rbp-6672]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.823:
+  mov rsi, 0
+  sub rsi, 1
+  mov qword ptr [rbp-6640], rsi
+  mov rsi, 0
+  not rsi
+  mov qword ptr [rbp-6648], rsi
+  lea rsi, [rip+.L.data.main.340]
+  mov qword ptr [rbp-6656], rsi
+  mov rsi, qword ptr [rbp-6640]
+  cmp rsi, qword ptr [rbp-6648]
+  jne .L.else.main.824
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6656]
+  mov r9, qword ptr [rbp-6648]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.825
+.L.else.main.824:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6656]
+  mov r9, qword ptr [rbp-6640]
+  mov r10, qword ptr [rbp-6648]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.825:
+  mov qword ptr [rbp-6616], 0
+  mov rsi, 0
+  sub rsi, 1
+  not rsi
+  mov qword ptr [rbp-6624], rsi
+  lea rsi, [rip+.L.data.main.341]
+  mov qword ptr [rbp-6632], rsi
+  mov rsi, qword ptr [rbp-6616]
+  cmp rsi, qword ptr [rbp-6624]
+  jne .L.else.main.826
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6632]
+  mov r9, qword ptr [rbp-6624]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.827
+.L.else.main.826:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6632]
+  mov r9, qword ptr [rbp-6616]
+  mov r10, qword ptr [rbp-6624]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.827:
+  mov qword ptr [rbp-6592], 0
+  mov rsi, 0
+  and rsi, 1
+  mov qword ptr [rbp-6600], rsi
+  lea rsi, [rip+.L.data.main.342]
+  mov qword ptr [rbp-6608], rsi
+  mov rsi, qword ptr [rbp-6592]
+  cmp rsi, qword ptr [rbp-6600]
+  jne .L.else.main.828
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6608]
+  mov r9, qword ptr [rbp-6600]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.829
+.L.else.main.828:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6608]
+  mov r9, qword ptr [rbp-6592]
+  mov r10, qword ptr [rbp-6600]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.829:
+  mov qword ptr [rbp-6568], 1
+  mov rsi, 3
+  and rsi, 1
+  mov qword ptr [rbp-6576], rsi
+  lea rsi, [rip+.L.data.main.343]
+  mov qword ptr [rbp-6584], rsi
+  mov rsi, qword ptr [rbp-6568]
+  cmp rsi, qword ptr [rbp-6576]
+  jne .L.else.main.830
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6584]
+  mov r9, qword ptr [rbp-6576]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.831
+.L.else.main.830:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6584]
+  mov r9, qword ptr [rbp-6568]
+  mov r10, qword ptr [rbp-6576]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.831:
+  mov qword ptr [rbp-6544], 3
+  mov rsi, 7
+  and rsi, 3
+  mov qword ptr [rbp-6552], rsi
+  lea rsi, [rip+.L.data.main.344]
+  mov qword ptr [rbp-6560], rsi
+  mov rsi, qword ptr [rbp-6544]
+  cmp rsi, qword ptr [rbp-6552]
+  jne .L.else.main.832
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6560]
+  mov r9, qword ptr [rbp-6552]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.833
+.L.else.main.832:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6560]
+  mov r9, qword ptr [rbp-6544]
+  mov r10, qword ptr [rbp-6552]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.833:
+  mov qword ptr [rbp-6520], 10
+  mov rsi, 0
+  sub rsi, 1
+  and rsi, 10
+  mov qword ptr [rbp-6528], rsi
+  lea rsi, [rip+.L.data.main.345]
+  mov qword ptr [rbp-6536], rsi
+  mov rsi, qword ptr [rbp-6520]
+  cmp rsi, qword ptr [rbp-6528]
+  jne .L.else.main.834
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6536]
+  mov r9, qword ptr [rbp-6528]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.835
+.L.else.main.834:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6536]
+  mov r9, qword ptr [rbp-6520]
+  mov r10, qword ptr [rbp-6528]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.835:
+  mov qword ptr [rbp-6496], 1
+  mov rsi, 0
+  or rsi, 1
+  mov qword ptr [rbp-6504], rsi
+  lea rsi, [rip+.L.data.main.346]
+  mov qword ptr [rbp-6512], rsi
+  mov rsi, qword ptr [rbp-6496]
+  cmp rsi, qword ptr [rbp-6504]
+  jne .L.else.main.836
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6512]
+  mov r9, qword ptr [rbp-6504]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.837
+.L.else.main.836:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6512]
+  mov r9, qword ptr [rbp-6496]
+  mov r10, qword ptr [rbp-6504]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.837:
+  mov qword ptr [rbp-6472], 19
+  mov rsi, 16
+  or rsi, 3
+  mov qword ptr [rbp-6480], rsi
+  lea rsi, [rip+.L.data.main.347]
+  mov qword ptr [rbp-6488], rsi
+  mov rsi, qword ptr [rbp-6472]
+  cmp rsi, qword ptr [rbp-6480]
+  jne .L.else.main.838
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6488]
+  mov r9, qword ptr [rbp-6480]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.839
+.L.else.main.838:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6488]
+  mov r9, qword ptr [rbp-6472]
+  mov r10, qword ptr [rbp-6480]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.839:
+  mov qword ptr [rbp-6448], 0
+  mov rsi, 0
+  xor rsi, 0
+  mov qword ptr [rbp-6456], rsi
+  lea rsi, [rip+.L.data.main.348]
+  mov qword ptr [rbp-6464], rsi
+  mov rsi, qword ptr [rbp-6448]
+  cmp rsi, qword ptr [rbp-6456]
+  jne .L.else.main.840
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6464]
+  mov r9, qword ptr [rbp-6456]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.841
+.L.else.main.840:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6464]
+  mov r9, qword ptr [rbp-6448]
+  mov r10, qword ptr [rbp-6456]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.841:
+  mov qword ptr [rbp-6424], 0
+  mov rsi, 15
+  xor rsi, 15
+  mov qword ptr [rbp-6432], rsi
+  lea rsi, [rip+.L.data.main.349]
+  mov qword ptr [rbp-6440], rsi
+  mov rsi, qword ptr [rbp-6424]
+  cmp rsi, qword ptr [rbp-6432]
+  jne .L.else.main.842
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6440]
+  mov r9, qword ptr [rbp-6432]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.843
+.L.else.main.842:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6440]
+  mov r9, qword ptr [rbp-6424]
+  mov r10, qword ptr [rbp-6432]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.843:
+  mov qword ptr [rbp-6400], 52
+  mov rsi, 56
+  xor rsi, 12
+  mov qword ptr [rbp-6408], rsi
+  lea rsi, [rip+.L.data.main.350]
+  mov qword ptr [rbp-6416], rsi
+  mov rsi, qword ptr [rbp-6400]
+  cmp rsi, qword ptr [rbp-6408]
+  jne .L.else.main.844
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6416]
+  mov r9, qword ptr [rbp-6408]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.845
+.L.else.main.844:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6416]
+  mov r9, qword ptr [rbp-6400]
+  mov r10, qword ptr [rbp-6408]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.845:
+  mov qword ptr [rbp-6376], 1
+  mov qword ptr [rbp-6384], 1
+  lea rsi, [rip+.L.data.main.351]
+  mov qword ptr [rbp-6392], rsi
+  mov rsi, qword ptr [rbp-6376]
+  cmp rsi, qword ptr [rbp-6384]
+  jne .L.else.main.848
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6392]
+  mov r9, qword ptr [rbp-6384]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.849
+.L.else.main.848:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6392]
+  mov r9, qword ptr [rbp-6376]
+  mov r10, qword ptr [rbp-6384]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.849:
+  mov qword ptr [rbp-6352], 1
+  mov qword ptr [rbp-6360], 1
+  lea rsi, [rip+.L.data.main.352]
+  mov qword ptr [rbp-6368], rsi
+  mov rsi, qword ptr [rbp-6352]
+  cmp rsi, qword ptr [rbp-6360]
+  jne .L.else.main.852
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6368]
+  mov r9, qword ptr [rbp-6360]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.853
+.L.else.main.852:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6368]
+  mov r9, qword ptr [rbp-6352]
+  mov r10, qword ptr [rbp-6360]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.853:
+  mov qword ptr [rbp-6328], 0
+  mov qword ptr [rbp-6336], 0
+  lea rsi, [rip+.L.data.main.353]
+  mov qword ptr [rbp-6344], rsi
+  mov rsi, qword ptr [rbp-6328]
+  cmp rsi, qword ptr [rbp-6336]
+  jne .L.else.main.856
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6344]
+  mov r9, qword ptr [rbp-6336]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.857
+.L.else.main.856:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6344]
+  mov r9, qword ptr [rbp-6328]
+  mov r10, qword ptr [rbp-6336]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.857:
+  mov qword ptr [rbp-6304], 0
+  mov rsi, 2
+  sub rsi, 2
+  cmp rsi, 0
+  jne .L.1.main.858
+  mov rsi, 0
+  jmp .L.end.main.859
+.L.1.main.858:
+  mov rsi, 1
+.L.end.main.859:
+  mov qword ptr [rbp-6312], rsi
+  lea rsi, [rip+.L.data.main.354]
+  mov qword ptr [rbp-6320], rsi
+  mov rsi, qword ptr [rbp-6304]
+  cmp rsi, qword ptr [rbp-6312]
+  jne .L.else.main.860
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6320]
+  mov r9, qword ptr [rbp-6312]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.861
+.L.else.main.860:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6320]
+  mov r9, qword ptr [rbp-6304]
+  mov r10, qword ptr [rbp-6312]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.861:
+  mov qword ptr [rbp-6280], 0
+  mov qword ptr [rbp-6288], 0
+  lea rsi, [rip+.L.data.main.355]
+  mov qword ptr [rbp-6296], rsi
+  mov rsi, qword ptr [rbp-6280]
+  cmp rsi, qword ptr [rbp-6288]
+  jne .L.else.main.864
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6296]
+  mov r9, qword ptr [rbp-6288]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.865
+.L.else.main.864:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6296]
+  mov r9, qword ptr [rbp-6280]
+  mov r10, qword ptr [rbp-6288]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.865:
+  mov qword ptr [rbp-6256], 0
+  mov rsi, 2
+  sub rsi, 2
+  cmp rsi, 0
+  je .L.0.main.866
+  mov rsi, 1
+  jmp .L.end.main.867
+.L.0.main.866:
+  mov rsi, 0
+.L.end.main.867:
+  mov qword ptr [rbp-6264], rsi
+  lea rsi, [rip+.L.data.main.356]
+  mov qword ptr [rbp-6272], rsi
+  mov rsi, qword ptr [rbp-6256]
+  cmp rsi, qword ptr [rbp-6264]
+  jne .L.else.main.868
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6272]
+  mov r9, qword ptr [rbp-6264]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.869
+.L.else.main.868:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6272]
+  mov r9, qword ptr [rbp-6256]
+  mov r10, qword ptr [rbp-6264]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.869:
+  mov qword ptr [rbp-6232], 1
+  mov qword ptr [rbp-6240], 1
+  lea rsi, [rip+.L.data.main.357]
+  mov qword ptr [rbp-6248], rsi
+  mov rsi, qword ptr [rbp-6232]
+  cmp rsi, qword ptr [rbp-6240]
+  jne .L.else.main.872
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6248]
+  mov r9, qword ptr [rbp-6240]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.873
+.L.else.main.872:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6248]
+  mov r9, qword ptr [rbp-6232]
+  mov r10, qword ptr [rbp-6240]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.873:
+  mov qword ptr [rbp-6200], 3
+  lea rsi, [rbp-17012]
+  add rsi, 0
+  mov dword ptr [rsi], 3
+  lea rsi, [rbp-17012]
+  mov qword ptr [rbp-6224], rsi
+  mov rsi, qword ptr [rbp-6224]
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  movsxd rsi, esi
+  mov qword ptr [rbp-6208], rsi
+  lea rsi, [rip+.L.data.main.358]
+  mov qword ptr [rbp-6216], rsi
+  mov rsi, qword ptr [rbp-6200]
+  cmp rsi, qword ptr [rbp-6208]
+  jne .L.else.main.874
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6216]
+  mov r9, qword ptr [rbp-6208]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.875
+.L.else.main.874:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6216]
+  mov r9, qword ptr [rbp-6200]
+  mov r10, qword ptr [rbp-6208]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.875:
+  mov rsi, 0
+  sub rsi, 56
+  mov qword ptr [rbp-6176], rsi
+  lea rsi, [rbp-17002]
+  add rsi, 0
+  mov rdi, 200
+  mov byte ptr [rsi], dil
+  lea rsi, [rbp-17002]
+  add rsi, 0
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rbp-6184], rsi
+  lea rsi, [rip+.L.data.main.359]
+  mov qword ptr [rbp-6192], rsi
+  mov rsi, qword ptr [rbp-6176]
+  cmp rsi, qword ptr [rbp-6184]
+  jne .L.else.main.876
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6192]
+  mov r9, qword ptr [rbp-6184]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.877
+.L.else.main.876:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6192]
+  mov r9, qword ptr [rbp-6176]
+  mov r10, qword ptr [rbp-6184]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.877:
+  mov qword ptr [rbp-6152], 4464
+  lea rsi, [rbp-17000]
+  add rsi, 2
+  mov rdi, 70000
+  mov word ptr [rsi], di
+  lea rsi, [rbp-17000]
+  add rsi, 2
+  movsx rsi, word ptr [rsi]
+  mov qword ptr [rbp-6160], rsi
+  lea rsi, [rip+.L.data.main.360]
+  mov qword ptr [rbp-6168], rsi
+  mov rsi, qword ptr [rbp-6152]
+  cmp rsi, qword ptr [rbp-6160]
+  jne .L.else.main.878
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6168]
+  mov r9, qword ptr [rbp-6160]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.879
+.L.else.main.878:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6168]
+  mov r9, qword ptr [rbp-6152]
+  mov r10, qword ptr [rbp-6160]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.879:
+  mov rsi, 0
+  sub rsi, 1
+  mov qword ptr [rbp-6128], rsi
+  lea rsi, [rbp-16996]
+  add rsi, 0
+  movabs rdi, 4294967295
+  mov dword ptr [rsi], edi
+  lea rsi, [rbp-16996]
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-6136], rsi
+  lea rsi, [rip+.L.data.main.361]
+  mov qword ptr [rbp-6144], rsi
+  mov rsi, qword ptr [rbp-6128]
+  cmp rsi, qword ptr [rbp-6136]
+  jne .L.else.main.880
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6144]
+  mov r9, qword ptr [rbp-6136]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.881
+.L.else.main.880:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6144]
+  mov r9, qword ptr [rbp-6128]
+  mov r10, qword ptr [rbp-6136]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.881:
+  mov rsi, 0
+  sub rsi, 55
+  mov qword ptr [rbp-6104], rsi
+  mov byte ptr [rbp-16988], 1
+  mov dword ptr [rbp-16984], 2
+  movsx rsi, byte ptr [rbp-16988]
+  add rsi, 200
+  mov byte ptr [rbp-16988], sil
+  movsx rsi, byte ptr [rbp-16988]
+  mov qword ptr [rbp-6112], rsi
+  lea rsi, [rip+.L.data.main.362]
+  mov qword ptr [rbp-6120], rsi
+  mov rsi, qword ptr [rbp-6104]
+  cmp rsi, qword ptr [rbp-6112]
+  jne .L.else.main.882
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6120]
+  mov r9, qword ptr [rbp-6112]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.883
+.L.else.main.882:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6120]
+  mov r9, qword ptr [rbp-6104]
+  mov r10, qword ptr [rbp-6112]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.883:
+  mov rsi, 0
+  sub rsi, 10
+  mov qword ptr [rbp-6080], rsi
+  lea rsi, [rbp-16980]
+  add rsi, 2
+  mov word ptr [rsi], 10
+  lea rsi, [rbp-16980]
+  add rsi, 2
+  sub word ptr [rsi], 20
+  lea rsi, [rbp-16980]
+  add rsi, 2
+  movsx rsi, word ptr [rsi]
+  mov qword ptr [rbp-6088], rsi
+  lea rsi, [rip+.L.data.main.363]
+  mov qword ptr [rbp-6096], rsi
+  mov rsi, qword ptr [rbp-6080]
+  cmp rsi, qword ptr [rbp-6088]
+  jne .L.else.main.884
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6096]
+  mov r9, qword ptr [rbp-6088]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.885
+.L.else.main.884:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6096]
+  mov r9, qword ptr [rbp-6080]
+  mov r10, qword ptr [rbp-6088]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.885:
+  mov qword ptr [rbp-6056], 40
+  mov dword ptr [rip+g1], 5
+  shl dword ptr [rip+g1], 3
+  movsxd rsi, dword ptr [rip+g1]
+  mov qword ptr [rbp-6064], rsi
+  lea rsi, [rip+.L.data.main.364]
+  mov qword ptr [rbp-6072], rsi
+  mov rsi, qword ptr [rbp-6056]
+  cmp rsi, qword ptr [rbp-6064]
+  jne .L.else.main.886
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6072]
+  mov r9, qword ptr [rbp-6064]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.887
+.L.else.main.886:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6072]
+  mov r9, qword ptr [rbp-6056]
+  mov r10, qword ptr [rbp-6064]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.887:
+  mov qword ptr [rbp-6032], 7
+  lea rsi, [rbp-16976]
+  add rsi, 0
+  mov qword ptr [rsi], 2
+  lea rsi, [rbp-16976]
+  add rsi, 8
+  mov qword ptr [rsi], 5
+  lea rsi, [rbp-16976]
+  add rsi, 0
+  lea rdi, [rbp-16976]
+  add rdi, 8
+  mov rdi, qword ptr [rdi]
+  add qword ptr [rsi], rdi
+  lea rsi, [rbp-16976]
+  add rsi, 0
+  mov rsi, qword ptr [rsi]
+  mov qword ptr [rbp-6040], rsi
+  lea rsi, [rip+.L.data.main.365]
+  mov qword ptr [rbp-6048], rsi
+  mov rsi, qword ptr [rbp-6032]
+  cmp rsi, qword ptr [rbp-6040]
+  jne .L.else.main.888
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6048]
+  mov r9, qword ptr [rbp-6040]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.889
+.L.else.main.888:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6048]
+  mov r9, qword ptr [rbp-6032]
+  mov r10, qword ptr [rbp-6040]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.889:
+  mov qword ptr [rbp-6008], 1
+  mov rsi, 0
+  sub rsi, 5
+  mov dword ptr [rbp-16956], esi
+  movsxd rsi, dword ptr [rbp-16956]
+  sar rsi, 6
+  mov rdi, 0
+  sub rdi, 1
+  cmp rsi, rdi
+  sete sil
+  movzx rsi, sil
+  mov qword ptr [rbp-6016], rsi
+  lea rsi, [rip+.L.data.main.366]
+  mov qword ptr [rbp-6024], rsi
+  mov rsi, qword ptr [rbp-6008]
+  cmp rsi, qword ptr [rbp-6016]
+  jne .L.else.main.890
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6024]
+  mov r9, qword ptr [rbp-6016]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.891
+.L.else.main.890:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6024]
+  mov r9, qword ptr [rbp-6008]
+  mov r10, qword ptr [rbp-6016]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.891:
+  mov qword ptr [rbp-5984], 4096
+  mov qword ptr [rbp-16952], 1
+  mov rsi, qword ptr [rbp-16952]
+  shl rsi, 12
+  mov qword ptr [rbp-5992], rsi
+  lea rsi, [rip+.L.data.main.367]
+  mov qword ptr [rbp-6000], rsi
+  mov rsi, qword ptr [rbp-5984]
+  cmp rsi, qword ptr [rbp-5992]
+  jne .L.else.main.892
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-6000]
+  mov r9, qword ptr [rbp-5992]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.893
+.L.else.main.892:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-6000]
+  mov r9, qword ptr [rbp-5984]
+  mov r10, qword ptr [rbp-5992]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.893:
+  mov qword ptr [rbp-5960], 255
+  mov rsi, 0
+  sub rsi, 1
+  mov qword ptr [rbp-16944], rsi
+  mov rsi, qword ptr [rbp-16944]
+  and rsi, 255
+  mov qword ptr [rbp-5968], rsi
+  lea rsi, [rip+.L.data.main.368]
+  mov qword ptr [rbp-5976], rsi
+  mov rsi, qword ptr [rbp-5960]
+  cmp rsi, qword ptr [rbp-5968]
+  jne .L.else.main.894
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5976]
+  mov r9, qword ptr [rbp-5968]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.895
+.L.else.main.894:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5976]
+  mov r9, qword ptr [rbp-5960]
+  mov r10, qword ptr [rbp-5968]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.895:
+  mov rsi, 0
+  sub rsi, 2
+  mov qword ptr [rbp-5936], rsi
+  mov qword ptr [rbp-16936], 7
+  mov rsi, qword ptr [rbp-16936]
+  mov rdi, 0
+  sub rdi, 7
+  xor rsi, rdi
+  mov qword ptr [rbp-5944], rsi
+  lea rsi, [rip+.L.data.main.369]
+  mov qword ptr [rbp-5952], rsi
+  mov rsi, qword ptr [rbp-5936]
+  cmp rsi, qword ptr [rbp-5944]
+  jne .L.else.main.896
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5952]
+  mov r9, qword ptr [rbp-5944]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.897
+.L.else.main.896:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5952]
+  mov r9, qword ptr [rbp-5936]
+  mov r10, qword ptr [rbp-5944]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.897:
+  movabs rsi, 4294967296
+  mov qword ptr [rbp-5912], rsi
+  mov qword ptr [rbp-16928], 1
+  mov rsi, qword ptr [rbp-16928]
+  movabs rdi, 4294967296
+  imul rsi, rdi
+  mov qword ptr [rbp-5920], rsi
+  lea rsi, [rip+.L.data.main.370]
+  mov qword ptr [rbp-5928], rsi
+  mov rsi, qword ptr [rbp-5912]
+  cmp rsi, qword ptr [rbp-5920]
+  jne .L.else.main.898
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5928]
+  mov r9, qword ptr [rbp-5920]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.899
+.L.else.main.898:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5928]
+  mov r9, qword ptr [rbp-5912]
+  mov r10, qword ptr [rbp-5920]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.899:
+  mov qword ptr [rbp-5888], 3
+  mov qword ptr [rbp-16920], 7
+  mov rsi, qword ptr [rbp-16920]
+  mov rdi, rsi
+  sar rdi, 63
+  and rdi, 1
+  add rsi, rdi
+  sar rsi, 1
+  mov qword ptr [rbp-5896], rsi
+  lea rsi, [rip+.L.data.main.371]
+  mov qword ptr [rbp-5904], rsi
+  mov rsi, qword ptr [rbp-5888]
+  cmp rsi, qword ptr [rbp-5896]
+  jne .L.else.main.900
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5904]
+  mov r9, qword ptr [rbp-5896]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.901
+.L.else.main.900:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5904]
+  mov r9, qword ptr [rbp-5888]
+  mov r10, qword ptr [rbp-5896]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.901:
+  mov qword ptr [rbp-5864], 44
+  mov byte ptr [rbp-16905], 100
+  movsx rsi, byte ptr [rbp-16905]
+  lea rsi, [rsi+rsi*2]
+  mov byte ptr [rbp-16905], sil
+  movsx rsi, byte ptr [rbp-16905]
+  mov qword ptr [rbp-5872], rsi
+  lea rsi, [rip+.L.data.main.372]
+  mov qword ptr [rbp-5880], rsi
+  mov rsi, qword ptr [rbp-5864]
+  cmp rsi, qword ptr [rbp-5872]
+  jne .L.else.main.902
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5880]
+  mov r9, qword ptr [rbp-5872]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.903
+.L.else.main.902:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5880]
+  mov r9, qword ptr [rbp-5864]
+  mov r10, qword ptr [rbp-5872]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.903:
+  mov qword ptr [rbp-5840], 1
+  lea rsi, [rbp-16904]
+  mov qword ptr [rbp-16888], rsi
+  mov rsi, qword ptr [rbp-16888]
+  add rsi, 12
+  lea rdi, [rbp-16904]
+  sub rsi, rdi
+  sar rsi, 2
+  cmp rsi, 3
+  sete sil
+  movzx rsi, sil
+  mov qword ptr [rbp-5848], rsi
+  lea rsi, [rip+.L.data.main.373]
+  mov qword ptr [rbp-5856], rsi
+  mov rsi, qword ptr [rbp-5840]
+  cmp rsi, qword ptr [rbp-5848]
+  jne .L.else.main.904
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5856]
+  mov r9, qword ptr [rbp-5848]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.905
+.L.else.main.904:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5856]
+  mov r9, qword ptr [rbp-5840]
+  mov r10, qword ptr [rbp-5848]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.905:
+  mov qword ptr [rbp-5816], 12
+  lea rsi, [rbp-16880]
+  mov qword ptr [rbp-16864], rsi
+  add qword ptr [rbp-16864], 12
+  mov rsi, qword ptr [rbp-16864]
+  lea rdi, [rbp-16880]
+  sub rsi, rdi
+  mov qword ptr [rbp-5824], rsi
+  lea rsi, [rip+.L.data.main.374]
+  mov qword ptr [rbp-5832], rsi
+  mov rsi, qword ptr [rbp-5816]
+  cmp rsi, qword ptr [rbp-5824]
+  jne .L.else.main.906
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5832]
+  mov r9, qword ptr [rbp-5824]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.907
+.L.else.main.906:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5832]
+  mov r9, qword ptr [rbp-5816]
+  mov r10, qword ptr [rbp-5824]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.907:
+  mov qword ptr [rbp-5792], 1
+  movabs rsi, 2147483648
+  mov qword ptr [rbp-16856], rsi
+  mov rsi, 2147483647
+  cmp rsi, qword ptr [rbp-16856]
+  setl sil
+  movzx rsi, sil
+  mov qword ptr [rbp-5800], rsi
+  lea rsi, [rip+.L.data.main.375]
+  mov qword ptr [rbp-5808], rsi
+  mov rsi, qword ptr [rbp-5792]
+  cmp rsi, qword ptr [rbp-5800]
+  jne .L.else.main.908
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5808]
+  mov r9, qword ptr [rbp-5800]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.909
+.L.else.main.908:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5808]
+  mov r9, qword ptr [rbp-5792]
+  mov r10, qword ptr [rbp-5800]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.909:
+  mov qword ptr [rbp-5768], 3
+  mov dword ptr [rbp-16848], 0
+  mov dword ptr [rbp-16844], 0
+  movsxd rsi, dword ptr [rbp-16844]
+  cmp rsi, 10
+  jge .L.break.main.911
+  .p2align 4,,10
+.L.begin.main.912:
+  movsxd rsi, dword ptr [rbp-16844]
+  cmp rsi, 6
+  jle .L.skip.main.915
+  movsxd rsi, dword ptr [rbp-16844]
+  cmp rsi, 8
+  jne .L.skip.main.914
+.L.skip.main.915:
+  movsxd rsi, dword ptr [rbp-16844]
+  cmp rsi, 0
+  jne .L.end.main.913
+.L.skip.main.914:
+  add dword ptr [rbp-16848], 1
+.L.end.main.913:
+  add dword ptr [rbp-16844], 1
+  movsxd rsi, dword ptr [rbp-16844]
+  cmp rsi, 10
+  jl .L.begin.main.912
+.L.break.main.911:
+  movsxd rsi, dword ptr [rbp-16848]
+  mov qword ptr [rbp-5776], rsi
+  lea rsi, [rip+.L.data.main.376]
+  mov qword ptr [rbp-5784], rsi
+  mov rsi, qword ptr [rbp-5768]
+  cmp rsi, qword ptr [rbp-5776]
+  jne .L.else.main.916
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5784]
+  mov r9, qword ptr [rbp-5776]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.917
+.L.else.main.916:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5784]
+  mov r9, qword ptr [rbp-5768]
+  mov r10, qword ptr [rbp-5776]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.917:
+  mov qword ptr [rbp-5744], 4
+  mov dword ptr [rbp-16840], 0
+  mov dword ptr [rbp-16836], 0
+  movsxd rsi, dword ptr [rbp-16836]
+  cmp rsi, 10
+  jge .L.break.main.919
+  .p2align 4,,10
+.L.begin.main.920:
+  movsxd rsi, dword ptr [rbp-16836]
+  cmp rsi, 2
+  jl .L.end.main.921
+  movsxd rsi, dword ptr [rbp-16836]
+  cmp rsi, 5
+  jl .L.skip.main.922
+  movsxd rsi, dword ptr [rbp-16836]
+  cmp rsi, 9
+  jne .L.end.main.921
+.L.skip.main.922:
+  add dword ptr [rbp-16840], 1
+.L.end.main.921:
+  add dword ptr [rbp-16836], 1
+  movsxd rsi, dword ptr [rbp-16836]
+  cmp rsi, 10
+  jl .L.begin.main.920
+.L.break.main.919:
+  movsxd rsi, dword ptr [rbp-16840]
+  mov qword ptr [rbp-5752], rsi
+  lea rsi, [rip+.L.data.main.377]
+  mov qword ptr [rbp-5760], rsi
+  mov rsi, qword ptr [rbp-5744]
+  cmp rsi, qword ptr [rbp-5752]
+  jne .L.else.main.923
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5760]
+  mov r9, qword ptr [rbp-5752]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.924
+.L.else.main.923:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5760]
+  mov r9, qword ptr [rbp-5744]
+  mov r10, qword ptr [rbp-5752]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.924:
+  mov qword ptr [rbp-5720], 2
+  mov dword ptr [rbp-16832], 0
+  mov dword ptr [rbp-16832], 2
+  movsxd rsi, dword ptr [rbp-16832]
+  mov qword ptr [rbp-5728], rsi
+  lea rsi, [rip+.L.data.main.378]
+  mov qword ptr [rbp-5736], rsi
+  mov rsi, qword ptr [rbp-5720]
+  cmp rsi, qword ptr [rbp-5728]
+  jne .L.else.main.927
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5736]
+  mov r9, qword ptr [rbp-5728]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.928
+.L.else.main.927:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5736]
+  mov r9, qword ptr [rbp-5720]
+  mov r10, qword ptr [rbp-5728]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.928:
+  mov qword ptr [rbp-5696], 1
+  mov dword ptr [rbp-16828], 0
+  mov dword ptr [rbp-16828], 1
+  movsxd rsi, dword ptr [rbp-16828]
+  mov qword ptr [rbp-5704], rsi
+  lea rsi, [rip+.L.data.main.379]
+  mov qword ptr [rbp-5712], rsi
+  mov rsi, qword ptr [rbp-5696]
+  cmp rsi, qword ptr [rbp-5704]
+  jne .L.else.main.930
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5712]
+  mov r9, qword ptr [rbp-5704]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.931
+.L.else.main.930:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5712]
+  mov r9, qword ptr [rbp-5696]
+  mov r10, qword ptr [rbp-5704]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.931:
+  mov qword ptr [rbp-5672], 5
+  mov dword ptr [rbp-16824], 0
+  movsxd rsi, dword ptr [rbp-16824]
+  cmp rsi, 100
+  jge .L.break.main.933
+  movsxd rsi, dword ptr [rbp-16824]
+  cmp rsi, 5
+  jge .L.break.main.933
+  .p2align 4,,10
+.L.begin.main.934:
+  add dword ptr [rbp-16824], 1
+  movsxd rsi, dword ptr [rbp-16824]
+  cmp rsi, 100
+  jge .L.skip.main.935
+  movsxd rsi, dword ptr [rbp-16824]
+  cmp rsi, 5
+  jl .L.begin.main.934
+.L.skip.main.935:
+.L.break.main.933:
+  movsxd rsi, dword ptr [rbp-16824]
+  mov qword ptr [rbp-5680], rsi
+  lea rsi, [rip+.L.data.main.380]
+  mov qword ptr [rbp-5688], rsi
+  mov rsi, qword ptr [rbp-5672]
+  cmp rsi, qword ptr [rbp-5680]
+  jne .L.else.main.936
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5688]
+  mov r9, qword ptr [rbp-5680]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.937
+.L.else.main.936:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5688]
+  mov r9, qword ptr [rbp-5672]
+  mov r10, qword ptr [rbp-5680]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.937:
+  mov qword ptr [rbp-5648], 10
+  mov dword ptr [rbp-16820], 0
+  .p2align 4,,10
+.L.begin.main.938:
+  add dword ptr [rbp-16820], 1
+  movsxd rsi, dword ptr [rbp-16820]
+  cmp rsi, 10
+  jne .L.begin.main.938
+  movsxd rsi, dword ptr [rbp-16820]
+  mov qword ptr [rbp-5656], rsi
+  lea rsi, [rip+.L.data.main.381]
+  mov qword ptr [rbp-5664], rsi
+  mov rsi, qword ptr [rbp-5648]
+  cmp rsi, qword ptr [rbp-5656]
+  jne .L.else.main.941
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5664]
+  mov r9, qword ptr [rbp-5656]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.942
+.L.else.main.941:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5664]
+  mov r9, qword ptr [rbp-5648]
+  mov r10, qword ptr [rbp-5656]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.942:
+  mov qword ptr [rbp-5624], 7
+  mov dword ptr [rbp-16816], 3
+  movsxd rsi, dword ptr [rbp-16816]
+  cmp rsi, 2
+  jle .L.else.main.943
+  mov rsi, 7
+  jmp .L.end.main.944
+.L.else.main.943:
+  mov rsi, 8
+.L.end.main.944:
+  mov qword ptr [rbp-5632], rsi
+  lea rsi, [rip+.L.data.main.382]
+  mov qword ptr [rbp-5640], rsi
+  mov rsi, qword ptr [rbp-5624]
+  cmp rsi, qword ptr [rbp-5632]
+  jne .L.else.main.945
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5640]
+  mov r9, qword ptr [rbp-5632]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.946
+.L.else.main.945:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5640]
+  mov r9, qword ptr [rbp-5624]
+  mov r10, qword ptr [rbp-5632]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.946:
+  mov qword ptr [rbp-5600], 8
+  mov dword ptr [rbp-16812], 2
+  movsxd rsi, dword ptr [rbp-16812]
+  cmp rsi, 2
+  jle .L.else.main.947
+  mov rsi, 7
+  jmp .L.end.main.948
+.L.else.main.947:
+  mov rsi, 8
+.L.end.main.948:
+  mov qword ptr [rbp-5608], rsi
+  lea rsi, [rip+.L.data.main.383]
+  mov qword ptr [rbp-5616], rsi
+  mov rsi, qword ptr [rbp-5600]
+  cmp rsi, qword ptr [rbp-5608]
+  jne .L.else.main.949
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5616]
+  mov r9, qword ptr [rbp-5608]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.950
+.L.else.main.949:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5616]
+  mov r9, qword ptr [rbp-5600]
+  mov r10, qword ptr [rbp-5608]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.950:
+  mov qword ptr [rbp-5576], 1
+  mov rsi, 0
+  movabs rdi, 3000000000
+  sub rsi, rdi
+  mov qword ptr [rbp-16808], rsi
+  mov rsi, qword ptr [rbp-16808]
+  mov rdi, 0
+  movabs r8, 2999999999
+  sub rdi, r8
+  cmp rsi, rdi
+  setl sil
+  movzx rsi, sil
+  mov qword ptr [rbp-5584], rsi
+  lea rsi, [rip+.L.data.main.384]
+  mov qword ptr [rbp-5592], rsi
+  mov rsi, qword ptr [rbp-5576]
+  cmp rsi, qword ptr [rbp-5584]
+  jne .L.else.main.951
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5592]
+  mov r9, qword ptr [rbp-5584]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.952
+.L.else.main.951:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5592]
+  mov r9, qword ptr [rbp-5576]
+  mov r10, qword ptr [rbp-5584]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.952:
+  mov qword ptr [rbp-5552], 42
+  mov qword ptr [rbp-16800], 14
+  mov rsi, qword ptr [rbp-16800]
+  lea rsi, [rsi+rsi*2]
+  mov qword ptr [rbp-5560], rsi
+  lea rsi, [rip+.L.data.main.385]
+  mov qword ptr [rbp-5568], rsi
+  mov rsi, qword ptr [rbp-5552]
+  cmp rsi, qword ptr [rbp-5560]
+  jne .L.else.main.953
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5568]
+  mov r9, qword ptr [rbp-5560]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.954
+.L.else.main.953:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5568]
+  mov r9, qword ptr [rbp-5552]
+  mov r10, qword ptr [rbp-5560]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.954:
+  mov rsi, 0
+  sub rsi, 35
+  mov qword ptr [rbp-5528], rsi
+  mov rsi, 0
+  sub rsi, 7
+  mov qword ptr [rbp-16792], rsi
+  mov rsi, qword ptr [rbp-16792]
+  lea rsi, [rsi+rsi*4]
+  mov qword ptr [rbp-5536], rsi
+  lea rsi, [rip+.L.data.main.386]
+  mov qword ptr [rbp-5544], rsi
+  mov rsi, qword ptr [rbp-5528]
+  cmp rsi, qword ptr [rbp-5536]
+  jne .L.else.main.955
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5544]
+  mov r9, qword ptr [rbp-5536]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.956
+.L.else.main.955:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5544]
+  mov r9, qword ptr [rbp-5528]
+  mov r10, qword ptr [rbp-5536]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.956:
+  mov qword ptr [rbp-5504], 81
+  mov qword ptr [rbp-16784], 9
+  mov rsi, qword ptr [rbp-16784]
+  lea rsi, [rsi+rsi*8]
+  mov qword ptr [rbp-5512], rsi
+  lea rsi, [rip+.L.data.main.387]
+  mov qword ptr [rbp-5520], rsi
+  mov rsi, qword ptr [rbp-5504]
+  cmp rsi, qword ptr [rbp-5512]
+  jne .L.else.main.957
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5520]
+  mov r9, qword ptr [rbp-5512]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.958
+.L.else.main.957:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5520]
+  mov r9, qword ptr [rbp-5504]
+  mov r10, qword ptr [rbp-5512]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.958:
+  mov qword ptr [rbp-5480], 120
+  mov qword ptr [rbp-16776], 10
+  mov rsi, qword ptr [rbp-16776]
+  lea rsi, [rsi+rsi*2]
+  shl rsi, 2
+  mov qword ptr [rbp-5488], rsi
+  lea rsi, [rip+.L.data.main.388]
+  mov qword ptr [rbp-5496], rsi
+  mov rsi, qword ptr [rbp-5480]
+  cmp rsi, qword ptr [rbp-5488]
+  jne .L.else.main.959
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5496]
+  mov r9, qword ptr [rbp-5488]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.960
+.L.else.main.959:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5496]
+  mov r9, qword ptr [rbp-5480]
+  mov r10, qword ptr [rbp-5488]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.960:
+  mov rsi, 0
+  sub rsi, 280
+  mov qword ptr [rbp-5456], rsi
+  mov rsi, 0
+  sub rsi, 7
+  mov qword ptr [rbp-16768], rsi
+  mov rsi, qword ptr [rbp-16768]
+  lea rsi, [rsi+rsi*4]
+  shl rsi, 3
+  mov qword ptr [rbp-5464], rsi
+  lea rsi, [rip+.L.data.main.389]
+  mov qword ptr [rbp-5472], rsi
+  mov rsi, qword ptr [rbp-5456]
+  cmp rsi, qword ptr [rbp-5464]
+  jne .L.else.main.961
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5472]
+  mov r9, qword ptr [rbp-5464]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.962
+.L.else.main.961:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5472]
+  mov r9, qword ptr [rbp-5456]
+  mov r10, qword ptr [rbp-5464]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.962:
+  mov rsi, 0
+  sub rsi, 21
+  mov qword ptr [rbp-5432], rsi
+  mov qword ptr [rbp-16760], 7
+  mov rsi, qword ptr [rbp-16760]
+  mov rdi, 0
+  sub rdi, 3
+  imul rsi, rdi
+  mov qword ptr [rbp-5440], rsi
+  lea rsi, [rip+.L.data.main.390]
+  mov qword ptr [rbp-5448], rsi
+  mov rsi, qword ptr [rbp-5432]
+  cmp rsi, qword ptr [rbp-5440]
+  jne .L.else.main.963
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5448]
+  mov r9, qword ptr [rbp-5440]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.964
+.L.else.main.963:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5448]
+  mov r9, qword ptr [rbp-5432]
+  mov r10, qword ptr [rbp-5440]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.964:
+  mov qword ptr [rbp-5408], 49
+  mov qword ptr [rbp-16752], 7
+  mov rsi, qword ptr [rbp-16752]
+  imul rsi, 7
+  mov qword ptr [rbp-16752], rsi
+  mov rsi, qword ptr [rbp-16752]
+  mov qword ptr [rbp-5416], rsi
+  lea rsi, [rip+.L.data.main.391]
+  mov qword ptr [rbp-5424], rsi
+  mov rsi, qword ptr [rbp-5408]
+  cmp rsi, qword ptr [rbp-5416]
+  jne .L.else.main.965
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5424]
+  mov r9, qword ptr [rbp-5416]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.966
+.L.else.main.965:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5424]
+  mov r9, qword ptr [rbp-5408]
+  mov r10, qword ptr [rbp-5416]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.966:
+  mov qword ptr [rbp-5384], 5
+  lea rsi, [rbp-16744]
+  add rsi, 56
+  lea rdi, [rbp-16744]
+  add rdi, 16
+  sub rsi, rdi
+  sar rsi, 3
+  mov qword ptr [rbp-5392], rsi
+  lea rsi, [rip+.L.data.main.392]
+  mov qword ptr [rbp-5400], rsi
+  mov rsi, qword ptr [rbp-5384]
+  cmp rsi, qword ptr [rbp-5392]
+  jne .L.else.main.967
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5400]
+  mov r9, qword ptr [rbp-5392]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.968
+.L.else.main.967:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5400]
+  mov r9, qword ptr [rbp-5384]
+  mov r10, qword ptr [rbp-5392]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.968:
+  mov qword ptr [rbp-5360], 3
+  lea rsi, [rbp-16659]
+  add rsi, 12
+  lea rdi, [rbp-16659]
+  add rdi, 3
+  sub rsi, rdi
+  movabs rax, -6148914691236517205
+  imul rsi
+  add rdx, rsi
+  sar rdx, 1
+  sar rsi, 63
+  sub rdx, rsi
+  mov qword ptr [rbp-5368], rdx
+  lea rsi, [rip+.L.data.main.393]
+  mov qword ptr [rbp-5376], rsi
+  mov rsi, qword ptr [rbp-5360]
+  cmp rsi, qword ptr [rbp-5368]
+  jne .L.else.main.969
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5376]
+  mov r9, qword ptr [rbp-5368]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.970
+.L.else.main.969:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5376]
+  mov r9, qword ptr [rbp-5360]
+  mov r10, qword ptr [rbp-5368]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.970:
+  mov qword ptr [rbp-5336], 174
+  mov r15, 0
+  cmp r15, 3
+  jge .L.break.main.972
+  .p2align 4,,10
+.L.begin.main.973:
+  mov r14, 0
+  cmp r14, 10
+  jge .L.break.main.975
+  lea rsi, [r15+r15*4]
+  .p2align 4,,10
+.L.begin.main.976:
+  lea rdi, [rbp-16644]
+  lea rdi, [rdi+rsi*8]
+  lea rdi, [rdi+r14*4]
+  mov r8, r15
+  imul r8, r14
+  mov dword ptr [rdi], r8d
+  mov rdi, r14
+  add rdi, 1
+  movsxd rdi, edi
+  mov r14, rdi
+  cmp r14, 10
+  jl .L.begin.main.976
+.L.break.main.975:
+  mov rsi, r15
+  add rsi, 1
+  movsxd rsi, esi
+  mov r15, rsi
+  cmp r15, 3
+  jl .L.begin.main.973
+.L.break.main.972:
+  mov dword ptr [rbp-16524], 0
+  mov r13, 0
+  cmp r13, 3
+  jge .L.break.main.978
+  .p2align 4,,10
+.L.begin.main.979:
+  mov r12, 0
+  cmp r12, 10
+  jge .L.break.main.981
+  lea rsi, [rbp-16644]
+  lea rdi, [r13+r13*4]
+  lea rsi, [rsi+rdi*8]
+  lea rdi, [rbp-16644]
+  mov r8, 2
+  sub r8, r13
+  lea r8, [r8+r8*4]
+  lea rdi, [rdi+r8*8]
+  .p2align 4,,10
+.L.begin.main.982:
+  movsxd r8, dword ptr [rsi+r12*4]
+  movsxd r9, dword ptr [rdi+r12*4]
+  movabs rax, -6148914691236517205
+  imul r9
+  add rdx, r9
+  sar rdx, 1
+  sar r9, 63
+  sub rdx, r9
+  add r8, rdx
+  add dword ptr [rbp-16524], r8d
+  mov r8, r12
+  add r8, 1
+  movsxd r8, r8d
+  mov r12, r8
+  cmp r12, 10
+  jl .L.begin.main.982
+.L.break.main.981:
+  mov rsi, r13
+  add rsi, 1
+  movsxd rsi, esi
+  mov r13, rsi
+  cmp r13, 3
+  jl .L.begin.main.979
+.L.break.main.978:
+  movsxd rsi, dword ptr [rbp-16524]
+  mov qword ptr [rbp-5344], rsi
+  lea rsi, [rip+.L.data.main.394]
+  mov qword ptr [rbp-5352], rsi
+  mov rsi, qword ptr [rbp-5336]
+  cmp rsi, qword ptr [rbp-5344]
+  jne .L.else.main.983
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5352]
+  mov r9, qword ptr [rbp-5344]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.984
+.L.else.main.983:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5352]
+  mov r9, qword ptr [rbp-5336]
+  mov r10, qword ptr [rbp-5344]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.984:
+  mov qword ptr [rbp-5312], 7
+  lea rsi, [rbp-16520]
+  mov qword ptr [rbp-16480], rsi
+  mov dword ptr [rbp-16468], 3
+  mov rsi, qword ptr [rbp-16480]
+  movsxd rdi, dword ptr [rbp-16468]
+  mov qword ptr [rsi+rdi*8], 7
+  lea rsi, [rbp-16520]
+  add rsi, 24
+  mov rsi, qword ptr [rsi]
+  mov qword ptr [rbp-5320], rsi
+  lea rsi, [rip+.L.data.main.395]
+  mov qword ptr [rbp-5328], rsi
+  mov rsi, qword ptr [rbp-5312]
+  cmp rsi, qword ptr [rbp-5320]
+  jne .L.else.main.985
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5328]
+  mov r9, qword ptr [rbp-5320]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.986
+.L.else.main.985:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5328]
+  mov r9, qword ptr [rbp-5312]
+  mov r10, qword ptr [rbp-5320]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.986:
+  mov rsi, 0
+  sub rsi, 3
+  mov qword ptr [rbp-5288], rsi
+  mov rsi, 0
+  sub rsi, 7
+  mov qword ptr [rbp-16464], rsi
+  mov rsi, qword ptr [rbp-16464]
+  mov rdi, rsi
+  sar rdi, 63
+  and rdi, 1
+  add rsi, rdi
+  sar rsi, 1
+  mov qword ptr [rbp-5296], rsi
+  lea rsi, [rip+.L.data.main.396]
+  mov qword ptr [rbp-5304], rsi
+  mov rsi, qword ptr [rbp-5288]
+  cmp rsi, qword ptr [rbp-5296]
+  jne .L.else.main.987
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5304]
+  mov r9, qword ptr [rbp-5296]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.988
+.L.else.main.987:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5304]
+  mov r9, qword ptr [rbp-5288]
+  mov r10, qword ptr [rbp-5296]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.988:
+  mov qword ptr [rbp-5264], 0
+  mov rsi, 0
+  sub rsi, 7
+  mov qword ptr [rbp-16456], rsi
+  mov rsi, qword ptr [rbp-16456]
+  mov rdi, rsi
+  sar rdi, 63
+  and rdi, 7
+  add rsi, rdi
+  sar rsi, 3
+  mov qword ptr [rbp-5272], rsi
+  lea rsi, [rip+.L.data.main.397]
+  mov qword ptr [rbp-5280], rsi
+  mov rsi, qword ptr [rbp-5264]
+  cmp rsi, qword ptr [rbp-5272]
+  jne .L.else.main.989
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5280]
+  mov r9, qword ptr [rbp-5272]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.990
+.L.else.main.989:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5280]
+  mov r9, qword ptr [rbp-5264]
+  mov r10, qword ptr [rbp-5272]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.990:
+  mov rsi, 0
+  sub rsi, 2
+  mov qword ptr [rbp-5240], rsi
+  mov rsi, 0
+  sub rsi, 7
+  mov qword ptr [rbp-16448], rsi
+  mov rsi, qword ptr [rbp-16448]
+  movabs rax, -6148914691236517205
+  imul rsi
+  add rdx, rsi
+  sar rdx, 1
+  sar rsi, 63
+  sub rdx, rsi
+  mov qword ptr [rbp-5248], rdx
+  lea rsi, [rip+.L.data.main.398]
+  mov qword ptr [rbp-5256], rsi
+  mov rsi, qword ptr [rbp-5240]
+  cmp rsi, qword ptr [rbp-5248]
+  jne .L.else.main.991
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5256]
+  mov r9, qword ptr [rbp-5248]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.992
+.L.else.main.991:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5256]
+  mov r9, qword ptr [rbp-5240]
+  mov r10, qword ptr [rbp-5248]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.992:
+  mov qword ptr [rbp-5216], 10
+  mov qword ptr [rbp-16440], 100
+  mov rsi, qword ptr [rbp-16440]
+  movabs rax, -3689348814741910323
+  imul rsi
+  add rdx, rsi
+  sar rdx, 3
+  sar rsi, 63
+  sub rdx, rsi
+  mov qword ptr [rbp-5224], rdx
+  lea rsi, [rip+.L.data.main.399]
+  mov qword ptr [rbp-5232], rsi
+  mov rsi, qword ptr [rbp-5216]
+  cmp rsi, qword ptr [rbp-5224]
+  jne .L.else.main.993
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5232]
+  mov r9, qword ptr [rbp-5224]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.994
+.L.else.main.993:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5232]
+  mov r9, qword ptr [rbp-5216]
+  mov r10, qword ptr [rbp-5224]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.994:
+  mov rsi, 0
+  sub rsi, 14
+  mov qword ptr [rbp-5192], rsi
+  mov rsi, 0
+  sub rsi, 100
+  mov dword ptr [rbp-16428], esi
+  movsxd rsi, dword ptr [rbp-16428]
+  movabs rax, -7905747460161236406
+  imul rsi
+  add rdx, rsi
+  sar rdx, 2
+  sar rsi, 63
+  sub rdx, rsi
+  mov qword ptr [rbp-5200], rdx
+  lea rsi, [rip+.L.data.main.400]
+  mov qword ptr [rbp-5208], rsi
+  mov rsi, qword ptr [rbp-5192]
+  cmp rsi, qword ptr [rbp-5200]
+  jne .L.else.main.995
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5208]
+  mov r9, qword ptr [rbp-5200]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.996
+.L.else.main.995:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5208]
+  mov r9, qword ptr [rbp-5192]
+  mov r10, qword ptr [rbp-5200]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.996:
+  movabs rsi, 123456789012
+  mov qword ptr [rbp-5168], rsi
+  movabs rsi, 123456789012345
+  mov qword ptr [rbp-16424], rsi
+  mov rsi, qword ptr [rbp-16424]
+  movabs rax, -9002011107970261188
+  imul rsi
+  add rdx, rsi
+  sar rdx, 9
+  sar rsi, 63
+  sub rdx, rsi
+  mov qword ptr [rbp-5176], rdx
+  lea rsi, [rip+.L.data.main.401]
+  mov qword ptr [rbp-5184], rsi
+  mov rsi, qword ptr [rbp-5168]
+  cmp rsi, qword ptr [rbp-5176]
+  jne .L.else.main.997
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5184]
+  mov r9, qword ptr [rbp-5176]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.998
+.L.else.main.997:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5184]
+  mov r9, qword ptr [rbp-5168]
+  mov r10, qword ptr [rbp-5176]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.998:
+  mov rsi, 0
+  movabs rdi, 192600294871
+  sub rsi, rdi
+  mov qword ptr [rbp-5144], rsi
+  mov rsi, 0
+  movabs rdi, 123456789012345
+  sub rsi, rdi
+  mov qword ptr [rbp-16416], rsi
+  mov rsi, qword ptr [rbp-16416]
+  movabs rax, -3712371272244199935
+  imul rsi
+  add rdx, rsi
+  sar rdx, 9
+  sar rsi, 63
+  sub rdx, rsi
+  mov qword ptr [rbp-5152], rdx
+  lea rsi, [rip+.L.data.main.402]
+  mov qword ptr [rbp-5160], rsi
+  mov rsi, qword ptr [rbp-5144]
+  cmp rsi, qword ptr [rbp-5152]
+  jne .L.else.main.999
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5160]
+  mov r9, qword ptr [rbp-5152]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1000
+.L.else.main.999:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5160]
+  mov r9, qword ptr [rbp-5144]
+  mov r10, qword ptr [rbp-5152]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1000:
+  mov qword ptr [rbp-5120], 1
+  mov dword ptr [rbp-16408], 2147483647
+  movsxd rsi, dword ptr [rbp-16408]
+  movabs rax, -9223372032559808509
+  imul rsi
+  add rdx, rsi
+  sar rdx, 30
+  sar rsi, 63
+  sub rdx, rsi
+  mov qword ptr [rbp-5128], rdx
+  lea rsi, [rip+.L.data.main.403]
+  mov qword ptr [rbp-5136], rsi
+  mov rsi, qword ptr [rbp-5120]
+  cmp rsi, qword ptr [rbp-5128]
+  jne .L.else.main.1001
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5136]
+  mov r9, qword ptr [rbp-5128]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1002
+.L.else.main.1001:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5136]
+  mov r9, qword ptr [rbp-5120]
+  mov r10, qword ptr [rbp-5128]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1002:
+  mov qword ptr [rbp-5096], 1234
+  mov dword ptr [rbp-16404], 12345
+  movsxd rsi, dword ptr [rbp-16404]
+  movabs rax, -3689348814741910323
+  imul rsi
+  add rdx, rsi
+  sar rdx, 3
+  sar rsi, 63
+  sub rdx, rsi
+  mov dword ptr [rbp-16404], edx
+  movsxd rsi, dword ptr [rbp-16404]
+  mov qword ptr [rbp-5104], rsi
+  lea rsi, [rip+.L.data.main.404]
+  mov qword ptr [rbp-5112], rsi
+  mov rsi, qword ptr [rbp-5096]
+  cmp rsi, qword ptr [rbp-5104]
+  jne .L.else.main.1003
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5112]
+  mov r9, qword ptr [rbp-5104]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1004
+.L.else.main.1003:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5112]
+  mov r9, qword ptr [rbp-5096]
+  mov r10, qword ptr [rbp-5104]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1004:
+  mov rsi, 0
+  sub rsi, 7
+  mov qword ptr [rbp-5072], rsi
+  mov rsi, 0
+  sub rsi, 7
+  mov qword ptr [rbp-16400], rsi
+  mov rsi, qword ptr [rbp-16400]
+  mov qword ptr [rbp-5080], rsi
+  lea rsi, [rip+.L.data.main.405]
+  mov qword ptr [rbp-5088], rsi
+  mov rsi, qword ptr [rbp-5072]
+  cmp rsi, qword ptr [rbp-5080]
+  jne .L.else.main.1005
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5088]
+  mov r9, qword ptr [rbp-5080]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1006
+.L.else.main.1005:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5088]
+  mov r9, qword ptr [rbp-5072]
+  mov r10, qword ptr [rbp-5080]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1006:
+  mov qword ptr [rbp-5048], 7
+  lea rsi, [rbp-16388]
+  add rsi, 96
+  lea rdi, [rbp-16388]
+  add rdi, 12
+  sub rsi, rdi
+  movabs rax, -6148914691236517205
+  imul rsi
+  add rdx, rsi
+  sar rdx, 3
+  sar rsi, 63
+  sub rdx, rsi
+  mov qword ptr [rbp-5056], rdx
+  lea rsi, [rip+.L.data.main.406]
+  mov qword ptr [rbp-5064], rsi
+  mov rsi, qword ptr [rbp-5048]
+  cmp rsi, qword ptr [rbp-5056]
+  jne .L.else.main.1007
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5064]
+  mov r9, qword ptr [rbp-5056]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1008
+.L.else.main.1007:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5064]
+  mov r9, qword ptr [rbp-5048]
+  mov r10, qword ptr [rbp-5056]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1008:
+  mov qword ptr [rbp-5024], 8
+  mov qword ptr [rbp-5032], 8
+  lea rsi, [rip+.L.data.main.407]
+  mov qword ptr [rbp-5040], rsi
+  mov rsi, qword ptr [rbp-5024]
+  cmp rsi, qword ptr [rbp-5032]
+  jne .L.else.main.1009
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5040]
+  mov r9, qword ptr [rbp-5032]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1010
+.L.else.main.1009:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5040]
+  mov r9, qword ptr [rbp-5024]
+  mov r10, qword ptr [rbp-5032]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1010:
+  mov qword ptr [rbp-5000], 4
+  mov qword ptr [rbp-5008], 4
+  lea rsi, [rip+.L.data.main.408]
+  mov qword ptr [rbp-5016], rsi
+  mov rsi, qword ptr [rbp-5000]
+  cmp rsi, qword ptr [rbp-5008]
+  jne .L.else.main.1011
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-5016]
+  mov r9, qword ptr [rbp-5008]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1012
+.L.else.main.1011:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-5016]
+  mov r9, qword ptr [rbp-5000]
+  mov r10, qword ptr [rbp-5008]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1012:
+  mov qword ptr [rbp-4976], 1
+  mov dword ptr [rbp-16240], 1
+  lea rsi, [rbp-16248]
+  mov qword ptr [rbp-16264], rsi
+  mov rsi, qword ptr [rbp-16264]
+  movsxd rsi, dword ptr [rsi+8]
+  mov qword ptr [rbp-4984], rsi
+  lea rsi, [rip+.L.data.main.409]
+  mov qword ptr [rbp-4992], rsi
+  mov rsi, qword ptr [rbp-4976]
+  cmp rsi, qword ptr [rbp-4984]
+  jne .L.else.main.1013
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4992]
+  mov r9, qword ptr [rbp-4984]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1014
+.L.else.main.1013:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4992]
+  mov r9, qword ptr [rbp-4976]
+  mov r10, qword ptr [rbp-4984]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1014:
+  mov qword ptr [rbp-4952], 3
+  mov dword ptr [rbp-16232], 0
+  movsxd rsi, dword ptr [rbp-16232]
+  cmp rsi, 10
+  jge .L.break.main.1016
+  .p2align 4,,10
+.L.begin.main.1017:
+  movsxd rsi, dword ptr [rbp-16232]
+  cmp rsi, 3
+  je .L.break.main.1016
+  add dword ptr [rbp-16232], 1
+  movsxd rsi, dword ptr [rbp-16232]
+  cmp rsi, 10
+  jl .L.begin.main.1017
+.L.break.main.1016:
+  movsxd rsi, dword ptr [rbp-16232]
+  mov qword ptr [rbp-4960], rsi
+  lea rsi, [rip+.L.data.main.410]
+  mov qword ptr [rbp-4968], rsi
+  mov rsi, qword ptr [rbp-4952]
+  cmp rsi, qword ptr [rbp-4960]
+  jne .L.else.main.1019
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4968]
+  mov r9, qword ptr [rbp-4960]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1020
+.L.else.main.1019:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4968]
+  mov r9, qword ptr [rbp-4952]
+  mov r10, qword ptr [rbp-4960]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1020:
+  mov qword ptr [rbp-4928], 4
+  mov dword ptr [rbp-16228], 0
+  .p2align 4,,10
+.L.begin.main.1023:
+  movsxd rsi, dword ptr [rbp-16228]
+  add rsi, 1
+  mov dword ptr [rbp-16228], esi
+  sub rsi, 1
+  cmp rsi, 3
+  jne .L.begin.main.1023
+  movsxd rsi, dword ptr [rbp-16228]
+  mov qword ptr [rbp-4936], rsi
+  lea rsi, [rip+.L.data.main.411]
+  mov qword ptr [rbp-4944], rsi
+  mov rsi, qword ptr [rbp-4928]
+  cmp rsi, qword ptr [rbp-4936]
+  jne .L.else.main.1025
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4944]
+  mov r9, qword ptr [rbp-4936]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1026
+.L.else.main.1025:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4944]
+  mov r9, qword ptr [rbp-4928]
+  mov r10, qword ptr [rbp-4936]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1026:
+  mov qword ptr [rbp-4904], 3
+  mov dword ptr [rbp-16224], 0
+  movsxd rsi, dword ptr [rbp-16224]
+  cmp rsi, 10
+  jge .L.break.main.1028
+  .p2align 4,,10
+.L.break.main.1031:
+  movsxd rsi, dword ptr [rbp-16224]
+  cmp rsi, 3
+  je .L.break.main.1028
+  add dword ptr [rbp-16224], 1
+  movsxd rsi, dword ptr [rbp-16224]
+  cmp rsi, 10
+  jl .L.break.main.1031
+.L.break.main.1028:
+  movsxd rsi, dword ptr [rbp-16224]
+  mov qword ptr [rbp-4912], rsi
+  lea rsi, [rip+.L.data.main.412]
+  mov qword ptr [rbp-4920], rsi
+  mov rsi, qword ptr [rbp-4904]
+  cmp rsi, qword ptr [rbp-4912]
+  jne .L.else.main.1034
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4920]
+  mov r9, qword ptr [rbp-4912]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1035
+.L.else.main.1034:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4920]
+  mov r9, qword ptr [rbp-4904]
+  mov r10, qword ptr [rbp-4912]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1035:
+  mov qword ptr [rbp-4880], 4
+  mov dword ptr [rbp-16220], 0
+  .p2align 4,,10
+.L.break.main.1040:
+  movsxd rsi, dword ptr [rbp-16220]
+  add rsi, 1
+  mov dword ptr [rbp-16220], esi
+  sub rsi, 1
+  cmp rsi, 3
+  jne .L.break.main.1040
+  movsxd rsi, dword ptr [rbp-16220]
+  mov qword ptr [rbp-4888], rsi
+  lea rsi, [rip+.L.data.main.413]
+  mov qword ptr [rbp-4896], rsi
+  mov rsi, qword ptr [rbp-4880]
+  cmp rsi, qword ptr [rbp-4888]
+  jne .L.else.main.1043
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4896]
+  mov r9, qword ptr [rbp-4888]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1044
+.L.else.main.1043:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4896]
+  mov r9, qword ptr [rbp-4880]
+  mov r10, qword ptr [rbp-4888]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1044:
+  mov qword ptr [rbp-4856], 10
+  mov dword ptr [rbp-16216], 0
+  mov dword ptr [rbp-16212], 0
+  movsxd rsi, dword ptr [rbp-16216]
+  cmp rsi, 10
+  jge .L.break.main.1046
+  .p2align 4,,10
+.L.begin.main.1047:
+  movsxd rsi, dword ptr [rbp-16216]
+  cmp rsi, 5
+  jg .L.continue.main.1045
+  add dword ptr [rbp-16212], 1
+.L.continue.main.1045:
+  add dword ptr [rbp-16216], 1
+  movsxd rsi, dword ptr [rbp-16216]
+  cmp rsi, 10
+  jl .L.begin.main.1047
+.L.break.main.1046:
+  movsxd rsi, dword ptr [rbp-16216]
+  mov qword ptr [rbp-4864], rsi
+  lea rsi, [rip+.L.data.main.414]
+  mov qword ptr [rbp-4872], rsi
+  mov rsi, qword ptr [rbp-4856]
+  cmp rsi, qword ptr [rbp-4864]
+  jne .L.else.main.1049
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4872]
+  mov r9, qword ptr [rbp-4864]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1050
+.L.else.main.1049:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4872]
+  mov r9, qword ptr [rbp-4856]
+  mov r10, qword ptr [rbp-4864]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1050:
+  mov qword ptr [rbp-4832], 6
+  mov dword ptr [rbp-16208], 0
+  mov dword ptr [rbp-16204], 0
+  movsxd rsi, dword ptr [rbp-16208]
+  cmp rsi, 10
+  jge .L.break.main.1052
+  .p2align 4,,10
+.L.begin.main.1053:
+  movsxd rsi, dword ptr [rbp-16208]
+  cmp rsi, 5
+  jg .L.continue.main.1051
+  add dword ptr [rbp-16204], 1
+.L.continue.main.1051:
+  add dword ptr [rbp-16208], 1
+  movsxd rsi, dword ptr [rbp-16208]
+  cmp rsi, 10
+  jl .L.begin.main.1053
+.L.break.main.1052:
+  movsxd rsi, dword ptr [rbp-16204]
+  mov qword ptr [rbp-4840], rsi
+  lea rsi, [rip+.L.data.main.415]
+  mov qword ptr [rbp-4848], rsi
+  mov rsi, qword ptr [rbp-4832]
+  cmp rsi, qword ptr [rbp-4840]
+  jne .L.else.main.1055
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4848]
+  mov r9, qword ptr [rbp-4840]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1056
+.L.else.main.1055:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4848]
+  mov r9, qword ptr [rbp-4832]
+  mov r10, qword ptr [rbp-4840]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1056:
+  mov qword ptr [rbp-4808], 10
+  mov dword ptr [rbp-16200], 0
+  mov rbx, 0
+  movsxd rsi, dword ptr [rbp-16200]
+  cmp rsi, 0
+  jne .L.break.main.1058
+  cmp rbx, 10
+  je .L.break.main.1058
+  .p2align 4,,10
+.L.continue.main.1060:
+  mov rsi, rbx
+  add rsi, 1
+  movsxd rsi, esi
+  mov rbx, rsi
+  cmp rbx, 10
+  jne .L.continue.main.1060
+.L.break.main.1058:
+  mov qword ptr [rbp-4816], rbx
+  lea rsi, [rip+.L.data.main.416]
+  mov qword ptr [rbp-4824], rsi
+  mov rsi, qword ptr [rbp-4808]
+  cmp rsi, qword ptr [rbp-4816]
+  jne .L.else.main.1063
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4824]
+  mov r9, qword ptr [rbp-4816]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1064
+.L.else.main.1063:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4824]
+  mov r9, qword ptr [rbp-4808]
+  mov r10, qword ptr [rbp-4816]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1064:
+  mov qword ptr [rbp-4784], 11
+  mov dword ptr [rbp-16196], 0
+  mov dword ptr [rbp-16192], 0
+  movsxd rsi, dword ptr [rbp-16196]
+  add rsi, 1
+  mov dword ptr [rbp-16196], esi
+  sub rsi, 1
+  cmp rsi, 10
+  jge .L.break.main.1066
+  .p2align 4,,10
+.L.begin.main.1067:
+  movsxd rsi, dword ptr [rbp-16196]
+  cmp rsi, 5
+  jg .L.continue.main.1065
+  add dword ptr [rbp-16192], 1
+.L.continue.main.1065:
+  movsxd rsi, dword ptr [rbp-16196]
+  add rsi, 1
+  mov dword ptr [rbp-16196], esi
+  sub rsi, 1
+  cmp rsi, 10
+  jl .L.begin.main.1067
+.L.break.main.1066:
+  movsxd rsi, dword ptr [rbp-16196]
+  mov qword ptr [rbp-4792], rsi
+  lea rsi, [rip+.L.data.main.417]
+  mov qword ptr [rbp-4800], rsi
+  mov rsi, qword ptr [rbp-4784]
+  cmp rsi, qword ptr [rbp-4792]
+  jne .L.else.main.1069
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4800]
+  mov r9, qword ptr [rbp-4792]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1070
+.L.else.main.1069:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4800]
+  mov r9, qword ptr [rbp-4784]
+  mov r10, qword ptr [rbp-4792]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1070:
+  mov qword ptr [rbp-4760], 5
+  mov dword ptr [rbp-16188], 0
+  mov dword ptr [rbp-16184], 0
+  movsxd rsi, dword ptr [rbp-16188]
+  add rsi, 1
+  mov dword ptr [rbp-16188], esi
+  sub rsi, 1
+  cmp rsi, 10
+  jge .L.break.main.1072
+  .p2align 4,,10
+.L.begin.main.1073:
+  movsxd rsi, dword ptr [rbp-16188]
+  cmp rsi, 5
+  jg .L.continue.main.1071
+  add dword ptr [rbp-16184], 1
+.L.continue.main.1071:
+  movsxd rsi, dword ptr [rbp-16188]
+  add rsi, 1
+  mov dword ptr [rbp-16188], esi
+  sub rsi, 1
+  cmp rsi, 10
+  jl .L.begin.main.1073
+.L.break.main.1072:
+  movsxd rsi, dword ptr [rbp-16184]
+  mov qword ptr [rbp-4768], rsi
+  lea rsi, [rip+.L.data.main.418]
+  mov qword ptr [rbp-4776], rsi
+  mov rsi, qword ptr [rbp-4760]
+  cmp rsi, qword ptr [rbp-4768]
+  jne .L.else.main.1075
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4776]
+  mov r9, qword ptr [rbp-4768]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1076
+.L.else.main.1075:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4776]
+  mov r9, qword ptr [rbp-4760]
+  mov r10, qword ptr [rbp-4768]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1076:
+  mov qword ptr [rbp-4736], 11
+  mov dword ptr [rbp-16180], 0
+  mov dword ptr [rbp-16176], 0
+  movsxd rsi, dword ptr [rbp-16180]
+  cmp rsi, 0
+  jne .L.break.main.1078
+  movsxd rsi, dword ptr [rbp-16176]
+  add rsi, 1
+  mov dword ptr [rbp-16176], esi
+  sub rsi, 1
+  cmp rsi, 10
+  je .L.break.main.1078
+  .p2align 4,,10
+.L.continue.main.1080:
+  movsxd rsi, dword ptr [rbp-16176]
+  add rsi, 1
+  mov dword ptr [rbp-16176], esi
+  sub rsi, 1
+  cmp rsi, 10
+  jne .L.continue.main.1080
+.L.break.main.1078:
+  movsxd rsi, dword ptr [rbp-16176]
+  mov qword ptr [rbp-4744], rsi
+  lea rsi, [rip+.L.data.main.419]
+  mov qword ptr [rbp-4752], rsi
+  mov rsi, qword ptr [rbp-4736]
+  cmp rsi, qword ptr [rbp-4744]
+  jne .L.else.main.1083
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4752]
+  mov r9, qword ptr [rbp-4744]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1084
+.L.else.main.1083:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4752]
+  mov r9, qword ptr [rbp-4736]
+  mov r10, qword ptr [rbp-4744]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1084:
+  mov qword ptr [rbp-4712], 0
+  mov dword ptr [rbp-16172], 0
+  movsxd rsi, dword ptr [rbp-16172]
+  cmp rsi, 0
+  jle .L.break.main.1086
+  .p2align 4,,10
+.L.begin.main.1087:
+  add dword ptr [rbp-16172], 1
+  movsxd rsi, dword ptr [rbp-16172]
+  cmp rsi, 0
+  jg .L.begin.main.1087
+.L.break.main.1086:
+  movsxd rsi, dword ptr [rbp-16172]
+  mov qword ptr [rbp-4720], rsi
+  lea rsi, [rip+.L.data.main.420]
+  mov qword ptr [rbp-4728], rsi
+  mov rsi, qword ptr [rbp-4712]
+  cmp rsi, qword ptr [rbp-4720]
+  jne .L.else.main.1088
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4728]
+  mov r9, qword ptr [rbp-4720]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1089
+.L.else.main.1088:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4728]
+  mov r9, qword ptr [rbp-4712]
+  mov r10, qword ptr [rbp-4720]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1089:
+  mov qword ptr [rbp-4688], 4
+  mov dword ptr [rbp-16168], 0
+  mov dword ptr [rbp-16164], 0
+  add dword ptr [rbp-16168], 1
+  movsxd rsi, dword ptr [rbp-16164]
+  cmp rsi, 3
+  setl sil
+  movzx rsi, sil
+  cmp rsi, 0
+  je .L.break.main.1091
+  .p2align 4,,10
+.L.begin.main.1092:
+  add dword ptr [rbp-16164], 1
+  add dword ptr [rbp-16168], 1
+  movsxd rsi, dword ptr [rbp-16164]
+  cmp rsi, 3
+  setl sil
+  movzx rsi, sil
+  cmp rsi, 0
+  jne .L.begin.main.1092
+.L.break.main.1091:
+  movsxd rsi, dword ptr [rbp-16168]
+  mov qword ptr [rbp-4696], rsi
+  lea rsi, [rip+.L.data.main.421]
+  mov qword ptr [rbp-4704], rsi
+  mov rsi, qword ptr [rbp-4688]
+  cmp rsi, qword ptr [rbp-4696]
+  jne .L.else.main.1093
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4704]
+  mov r9, qword ptr [rbp-4696]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1094
+.L.else.main.1093:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4704]
+  mov r9, qword ptr [rbp-4688]
+  mov r10, qword ptr [rbp-4696]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1094:
+  mov qword ptr [rbp-4664], 6
+  mov dword ptr [rbp-16160], 0
+  mov dword ptr [rbp-16156], 0
+  add dword ptr [rbp-16160], 1
+  movsxd rsi, dword ptr [rbp-16156]
+  cmp rsi, 5
+  setl sil
+  movzx rsi, sil
+  cmp rsi, 0
+  je .L.break.main.1096
+  .p2align 4,,10
+.L.begin.main.1097:
+  add dword ptr [rbp-16156], 1
+  add dword ptr [rbp-16160], 1
+  movsxd rsi, dword ptr [rbp-16156]
+  cmp rsi, 5
+  setl sil
+  movzx rsi, sil
+  cmp rsi, 0
+  jne .L.begin.main.1097
+.L.break.main.1096:
+  movsxd rsi, dword ptr [rbp-16160]
+  mov qword ptr [rbp-4672], rsi
+  lea rsi, [rip+.L.data.main.422]
+  mov qword ptr [rbp-4680], rsi
+  mov rsi, qword ptr [rbp-4664]
+  cmp rsi, qword ptr [rbp-4672]
+  jne .L.else.main.1099
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4680]
+  mov r9, qword ptr [rbp-4672]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1100
+.L.else.main.1099:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4680]
+  mov r9, qword ptr [rbp-4664]
+  mov r10, qword ptr [rbp-4672]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1100:
+  mov qword ptr [rbp-4640], 3
+  mov dword ptr [rbp-16152], 0
+  jmp .L.label.main.k
+  .p2align 4,,10
+.L.begin.main.1103:
+  add dword ptr [rbp-16152], 1
+.L.label.main.k:
+  movsxd rsi, dword ptr [rbp-16152]
+  cmp rsi, 3
+  setl sil
+  movzx rsi, sil
+  cmp rsi, 0
+  jne .L.begin.main.1103
+  movsxd rsi, dword ptr [rbp-16152]
+  mov qword ptr [rbp-4648], rsi
+  lea rsi, [rip+.L.data.main.423]
+  mov qword ptr [rbp-4656], rsi
+  mov rsi, qword ptr [rbp-4640]
+  cmp rsi, qword ptr [rbp-4648]
+  jne .L.else.main.1106
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4656]
+  mov r9, qword ptr [rbp-4648]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1107
+.L.else.main.1106:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4656]
+  mov r9, qword ptr [rbp-4640]
+  mov r10, qword ptr [rbp-4648]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1107:
+  mov qword ptr [rbp-4616], 6
+  mov dword ptr [rbp-16148], 0
+  mov dword ptr [rbp-16144], 0
+  jmp .L.label.main.l
+  .p2align 4,,10
+.L.begin.main.1110:
+  movsxd rsi, dword ptr [rbp-16144]
+  cmp rsi, 5
+  jg .L.continue.main.1108
+  add dword ptr [rbp-16148], 1
+.L.continue.main.1108:
+  add dword ptr [rbp-16144], 1
+.L.label.main.l:
+  movsxd rsi, dword ptr [rbp-16144]
+  cmp rsi, 10
+  setl sil
+  movzx rsi, sil
+  cmp rsi, 0
+  jne .L.begin.main.1110
+  movsxd rsi, dword ptr [rbp-16148]
+  mov qword ptr [rbp-4624], rsi
+  lea rsi, [rip+.L.data.main.424]
+  mov qword ptr [rbp-4632], rsi
+  mov rsi, qword ptr [rbp-4616]
+  cmp rsi, qword ptr [rbp-4624]
+  jne .L.else.main.1114
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4632]
+  mov r9, qword ptr [rbp-4624]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1115
+.L.else.main.1114:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4632]
+  mov r9, qword ptr [rbp-4616]
+  mov r10, qword ptr [rbp-4624]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1115:
+  mov qword ptr [rbp-4592], 0
+  mov dword ptr [rbp-16140], 0
+  mov dword ptr [rbp-16136], 0
+  jmp .L.label.main.m
+  .p2align 4,,10
+.L.begin.main.1118:
+  add dword ptr [rbp-16140], 1
+  add dword ptr [rbp-16136], 1
+.L.label.main.m:
+  movsxd rsi, dword ptr [rbp-16136]
+  cmp rsi, 0
+  setl sil
+  movzx rsi, sil
+  cmp rsi, 0
+  jne .L.begin.main.1118
+  movsxd rsi, dword ptr [rbp-16140]
+  mov qword ptr [rbp-4600], rsi
+  lea rsi, [rip+.L.data.main.425]
+  mov qword ptr [rbp-4608], rsi
+  mov rsi, qword ptr [rbp-4592]
+  cmp rsi, qword ptr [rbp-4600]
+  jne .L.else.main.1121
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4608]
+  mov r9, qword ptr [rbp-4600]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1122
+.L.else.main.1121:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4608]
+  mov r9, qword ptr [rbp-4592]
+  mov r10, qword ptr [rbp-4600]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1122:
+  mov qword ptr [rbp-4568], 11
+  mov dword ptr [rbp-16132], 0
+  jmp .L.test.main.1126
+  .p2align 4,,10
+.L.begin.main.1125:
+  add dword ptr [rbp-16132], 1
+.L.test.main.1126:
+  movsxd rsi, dword ptr [rbp-16132]
+  cmp rsi, 20
+  jge .L.skip.main.1127
+  movsxd rsi, dword ptr [rbp-16132]
+  cmp rsi, 11
+  je .L.skip.main.1127
+  movsxd rsi, dword ptr [rbp-16132]
+  cmp rsi, 12
+  je .L.skip.main.1127
+  movsxd rsi, dword ptr [rbp-16132]
+  cmp rsi, 13
+  je .L.skip.main.1127
+  movsxd rsi, dword ptr [rbp-16132]
+  cmp rsi, 14
+  je .L.skip.main.1127
+  movsxd rsi, dword ptr [rbp-16132]
+  cmp rsi, 15
+  je .L.skip.main.1127
+  movsxd rsi, dword ptr [rbp-16132]
+  cmp rsi, 16
+  je .L.skip.main.1127
+  movsxd rsi, dword ptr [rbp-16132]
+  cmp rsi, 17
+  jne .L.begin.main.1125
+.L.skip.main.1127:
+  movsxd rsi, dword ptr [rbp-16132]
+  mov qword ptr [rbp-4576], rsi
+  lea rsi, [rip+.L.data.main.426]
+  mov qword ptr [rbp-4584], rsi
+  mov rsi, qword ptr [rbp-4568]
+  cmp rsi, qword ptr [rbp-4576]
+  jne .L.else.main.1128
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4584]
+  mov r9, qword ptr [rbp-4576]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1129
+.L.else.main.1128:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4584]
+  mov r9, qword ptr [rbp-4568]
+  mov r10, qword ptr [rbp-4576]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1129:
+  mov qword ptr [rbp-4544], 3
+  mov dword ptr [rbp-16128], 0
+  add dword ptr [rbp-16128], 1
+  add dword ptr [rbp-16128], 1
+  add dword ptr [rbp-16128], 1
+  movsxd rsi, dword ptr [rbp-16128]
+  mov qword ptr [rbp-4552], rsi
+  lea rsi, [rip+.L.data.main.427]
+  mov qword ptr [rbp-4560], rsi
+  mov rsi, qword ptr [rbp-4544]
+  cmp rsi, qword ptr [rbp-4552]
+  jne .L.else.main.1133
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4560]
+  mov r9, qword ptr [rbp-4552]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1134
+.L.else.main.1133:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4560]
+  mov r9, qword ptr [rbp-4544]
+  mov r10, qword ptr [rbp-4552]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1134:
+  mov qword ptr [rbp-4520], 2
+  mov dword ptr [rbp-16124], 0
+  add dword ptr [rbp-16124], 1
+  add dword ptr [rbp-16124], 1
+  movsxd rsi, dword ptr [rbp-16124]
+  mov qword ptr [rbp-4528], rsi
+  lea rsi, [rip+.L.data.main.428]
+  mov qword ptr [rbp-4536], rsi
+  mov rsi, qword ptr [rbp-4520]
+  cmp rsi, qword ptr [rbp-4528]
+  jne .L.else.main.1138
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4536]
+  mov r9, qword ptr [rbp-4528]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1139
+.L.else.main.1138:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4536]
+  mov r9, qword ptr [rbp-4520]
+  mov r10, qword ptr [rbp-4528]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1139:
+  mov qword ptr [rbp-4496], 1
+  mov dword ptr [rbp-16120], 0
+  add dword ptr [rbp-16120], 1
+  movsxd rsi, dword ptr [rbp-16120]
+  mov qword ptr [rbp-4504], rsi
+  lea rsi, [rip+.L.data.main.429]
+  mov qword ptr [rbp-4512], rsi
+  mov rsi, qword ptr [rbp-4496]
+  cmp rsi, qword ptr [rbp-4504]
+  jne .L.else.main.1143
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4512]
+  mov r9, qword ptr [rbp-4504]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1144
+.L.else.main.1143:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4512]
+  mov r9, qword ptr [rbp-4496]
+  mov r10, qword ptr [rbp-4504]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1144:
+  mov qword ptr [rbp-4472], 5
+  mov dword ptr [rbp-16116], 0
+  mov rsi, 0
+  cmp rsi, 0
+  je .L.case.main.1148
+  cmp rsi, 1
+  je .L.case.main.1147
+  cmp rsi, 2
+  je .L.case.main.1146
+  jmp .L.break.main.1145
+.L.case.main.1148:
+  mov dword ptr [rbp-16116], 5
+  jmp .L.break.main.1145
+.L.case.main.1147:
+  mov dword ptr [rbp-16116], 6
+  jmp .L.break.main.1145
+.L.case.main.1146:
+  mov dword ptr [rbp-16116], 7
+.L.break.main.1145:
+  movsxd rsi, dword ptr [rbp-16116]
+  mov qword ptr [rbp-4480], rsi
+  lea rsi, [rip+.L.data.main.430]
+  mov qword ptr [rbp-4488], rsi
+  mov rsi, qword ptr [rbp-4472]
+  cmp rsi, qword ptr [rbp-4480]
+  jne .L.else.main.1149
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4488]
+  mov r9, qword ptr [rbp-4480]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1150
+.L.else.main.1149:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4488]
+  mov r9, qword ptr [rbp-4472]
+  mov r10, qword ptr [rbp-4480]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1150:
+  mov qword ptr [rbp-4448], 6
+  mov dword ptr [rbp-16112], 0
+  mov rsi, 1
+  cmp rsi, 0
+  je .L.case.main.1154
+  cmp rsi, 1
+  je .L.case.main.1153
+  cmp rsi, 2
+  je .L.case.main.1152
+  jmp .L.break.main.1151
+.L.case.main.1154:
+  mov dword ptr [rbp-16112], 5
+  jmp .L.break.main.1151
+.L.case.main.1153:
+  mov dword ptr [rbp-16112], 6
+  jmp .L.break.main.1151
+.L.case.main.1152:
+  mov dword ptr [rbp-16112], 7
+.L.break.main.1151:
+  movsxd rsi, dword ptr [rbp-16112]
+  mov qword ptr [rbp-4456], rsi
+  lea rsi, [rip+.L.data.main.431]
+  mov qword ptr [rbp-4464], rsi
+  mov rsi, qword ptr [rbp-4448]
+  cmp rsi, qword ptr [rbp-4456]
+  jne .L.else.main.1155
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4464]
+  mov r9, qword ptr [rbp-4456]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1156
+.L.else.main.1155:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4464]
+  mov r9, qword ptr [rbp-4448]
+  mov r10, qword ptr [rbp-4456]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1156:
+  mov qword ptr [rbp-4424], 7
+  mov dword ptr [rbp-16108], 0
+  mov rsi, 2
+  cmp rsi, 0
+  je .L.case.main.1160
+  cmp rsi, 1
+  je .L.case.main.1159
+  cmp rsi, 2
+  je .L.case.main.1158
+  jmp .L.break.main.1157
+.L.case.main.1160:
+  mov dword ptr [rbp-16108], 5
+  jmp .L.break.main.1157
+.L.case.main.1159:
+  mov dword ptr [rbp-16108], 6
+  jmp .L.break.main.1157
+.L.case.main.1158:
+  mov dword ptr [rbp-16108], 7
+.L.break.main.1157:
+  movsxd rsi, dword ptr [rbp-16108]
+  mov qword ptr [rbp-4432], rsi
+  lea rsi, [rip+.L.data.main.432]
+  mov qword ptr [rbp-4440], rsi
+  mov rsi, qword ptr [rbp-4424]
+  cmp rsi, qword ptr [rbp-4432]
+  jne .L.else.main.1161
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4440]
+  mov r9, qword ptr [rbp-4432]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1162
+.L.else.main.1161:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4440]
+  mov r9, qword ptr [rbp-4424]
+  mov r10, qword ptr [rbp-4432]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1162:
+  mov qword ptr [rbp-4400], 0
+  mov dword ptr [rbp-16104], 0
+  mov rsi, 3
+  cmp rsi, 0
+  je .L.case.main.1166
+  cmp rsi, 1
+  je .L.case.main.1165
+  cmp rsi, 2
+  je .L.case.main.1164
+  jmp .L.break.main.1163
+.L.case.main.1166:
+  mov dword ptr [rbp-16104], 5
+  jmp .L.break.main.1163
+.L.case.main.1165:
+  mov dword ptr [rbp-16104], 6
+  jmp .L.break.main.1163
+.L.case.main.1164:
+  mov dword ptr [rbp-16104], 7
+.L.break.main.1163:
+  movsxd rsi, dword ptr [rbp-16104]
+  mov qword ptr [rbp-4408], rsi
+  lea rsi, [rip+.L.data.main.433]
+  mov qword ptr [rbp-4416], rsi
+  mov rsi, qword ptr [rbp-4400]
+  cmp rsi, qword ptr [rbp-4408]
+  jne .L.else.main.1167
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4416]
+  mov r9, qword ptr [rbp-4408]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1168
+.L.else.main.1167:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4416]
+  mov r9, qword ptr [rbp-4400]
+  mov r10, qword ptr [rbp-4408]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1168:
+  mov qword ptr [rbp-4376], 5
+  mov dword ptr [rbp-16100], 0
+  mov rsi, 0
+  cmp rsi, 0
+  jne .L.case.main.1171
+  mov dword ptr [rbp-16100], 5
+  jmp .L.break.main.1169
+.L.case.main.1171:
+  mov dword ptr [rbp-16100], 7
+.L.break.main.1169:
+  movsxd rsi, dword ptr [rbp-16100]
+  mov qword ptr [rbp-4384], rsi
+  lea rsi, [rip+.L.data.main.434]
+  mov qword ptr [rbp-4392], rsi
+  mov rsi, qword ptr [rbp-4376]
+  cmp rsi, qword ptr [rbp-4384]
+  jne .L.else.main.1172
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4392]
+  mov r9, qword ptr [rbp-4384]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1173
+.L.else.main.1172:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4392]
+  mov r9, qword ptr [rbp-4376]
+  mov r10, qword ptr [rbp-4384]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1173:
+  mov qword ptr [rbp-4352], 7
+  mov dword ptr [rbp-16096], 0
+  mov rsi, 1
+  cmp rsi, 0
+  jne .L.case.main.1176
+  mov dword ptr [rbp-16096], 5
+  jmp .L.break.main.1174
+.L.case.main.1176:
+  mov dword ptr [rbp-16096], 7
+.L.break.main.1174:
+  movsxd rsi, dword ptr [rbp-16096]
+  mov qword ptr [rbp-4360], rsi
+  lea rsi, [rip+.L.data.main.435]
+  mov qword ptr [rbp-4368], rsi
+  mov rsi, qword ptr [rbp-4352]
+  cmp rsi, qword ptr [rbp-4360]
+  jne .L.else.main.1177
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4368]
+  mov r9, qword ptr [rbp-4360]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1178
+.L.else.main.1177:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4368]
+  mov r9, qword ptr [rbp-4352]
+  mov r10, qword ptr [rbp-4360]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1178:
+  mov qword ptr [rbp-4328], 2
+  mov dword ptr [rbp-16092], 0
+  mov rsi, 1
+  cmp rsi, 0
+  je .L.case.main.1182
+  cmp rsi, 1
+  je .L.case.main.1181
+  cmp rsi, 2
+  je .L.case.main.1180
+  jmp .L.break.main.1179
+.L.case.main.1182:
+.L.case.main.1181:
+.L.case.main.1180:
+  mov dword ptr [rbp-16092], 2
+.L.break.main.1179:
+  movsxd rsi, dword ptr [rbp-16092]
+  mov qword ptr [rbp-4336], rsi
+  lea rsi, [rip+.L.data.main.436]
+  mov qword ptr [rbp-4344], rsi
+  mov rsi, qword ptr [rbp-4328]
+  cmp rsi, qword ptr [rbp-4336]
+  jne .L.else.main.1183
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4344]
+  mov r9, qword ptr [rbp-4336]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1184
+.L.else.main.1183:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4344]
+  mov r9, qword ptr [rbp-4328]
+  mov r10, qword ptr [rbp-4336]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1184:
+  mov qword ptr [rbp-4304], 0
+  mov dword ptr [rbp-16088], 0
+  mov rsi, 3
+  cmp rsi, 0
+  je .L.case.main.1188
+  cmp rsi, 1
+  je .L.case.main.1187
+  cmp rsi, 2
+  je .L.case.main.1186
+  jmp .L.break.main.1185
+.L.case.main.1188:
+.L.case.main.1187:
+.L.case.main.1186:
+  mov dword ptr [rbp-16088], 2
+.L.break.main.1185:
+  movsxd rsi, dword ptr [rbp-16088]
+  mov qword ptr [rbp-4312], rsi
+  lea rsi, [rip+.L.data.main.437]
+  mov qword ptr [rbp-4320], rsi
+  mov rsi, qword ptr [rbp-4304]
+  cmp rsi, qword ptr [rbp-4312]
+  jne .L.else.main.1189
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4320]
+  mov r9, qword ptr [rbp-4312]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1190
+.L.else.main.1189:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4320]
+  mov r9, qword ptr [rbp-4304]
+  mov r10, qword ptr [rbp-4312]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1190:
+  mov qword ptr [rbp-4280], 1
+  mov rsi, 1
+  shl rsi, 0
+  mov qword ptr [rbp-4288], rsi
+  lea rsi, [rip+.L.data.main.438]
+  mov qword ptr [rbp-4296], rsi
+  mov rsi, qword ptr [rbp-4280]
+  cmp rsi, qword ptr [rbp-4288]
+  jne .L.else.main.1191
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4296]
+  mov r9, qword ptr [rbp-4288]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1192
+.L.else.main.1191:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4296]
+  mov r9, qword ptr [rbp-4280]
+  mov r10, qword ptr [rbp-4288]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1192:
+  mov qword ptr [rbp-4256], 8
+  mov rsi, 1
+  shl rsi, 3
+  mov qword ptr [rbp-4264], rsi
+  lea rsi, [rip+.L.data.main.439]
+  mov qword ptr [rbp-4272], rsi
+  mov rsi, qword ptr [rbp-4256]
+  cmp rsi, qword ptr [rbp-4264]
+  jne .L.else.main.1193
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4272]
+  mov r9, qword ptr [rbp-4264]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1194
+.L.else.main.1193:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4272]
+  mov r9, qword ptr [rbp-4256]
+  mov r10, qword ptr [rbp-4264]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1194:
+  mov qword ptr [rbp-4232], 10
+  mov rsi, 5
+  shl rsi, 1
+  mov qword ptr [rbp-4240], rsi
+  lea rsi, [rip+.L.data.main.440]
+  mov qword ptr [rbp-4248], rsi
+  mov rsi, qword ptr [rbp-4232]
+  cmp rsi, qword ptr [rbp-4240]
+  jne .L.else.main.1195
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4248]
+  mov r9, qword ptr [rbp-4240]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1196
+.L.else.main.1195:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4248]
+  mov r9, qword ptr [rbp-4232]
+  mov r10, qword ptr [rbp-4240]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1196:
+  mov qword ptr [rbp-4208], 2
+  mov rsi, 5
+  sar rsi, 1
+  mov qword ptr [rbp-4216], rsi
+  lea rsi, [rip+.L.data.main.441]
+  mov qword ptr [rbp-4224], rsi
+  mov rsi, qword ptr [rbp-4208]
+  cmp rsi, qword ptr [rbp-4216]
+  jne .L.else.main.1197
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4224]
+  mov r9, qword ptr [rbp-4216]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1198
+.L.else.main.1197:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4224]
+  mov r9, qword ptr [rbp-4208]
+  mov r10, qword ptr [rbp-4216]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1198:
+  mov rsi, 0
+  sub rsi, 1
+  mov qword ptr [rbp-4184], rsi
+  mov rsi, 0
+  sub rsi, 1
+  sar rsi, 1
+  mov qword ptr [rbp-4192], rsi
+  lea rsi, [rip+.L.data.main.442]
+  mov qword ptr [rbp-4200], rsi
+  mov rsi, qword ptr [rbp-4184]
+  cmp rsi, qword ptr [rbp-4192]
+  jne .L.else.main.1199
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4200]
+  mov r9, qword ptr [rbp-4192]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1200
+.L.else.main.1199:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4200]
+  mov r9, qword ptr [rbp-4184]
+  mov r10, qword ptr [rbp-4192]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1200:
+  mov qword ptr [rbp-4160], 1
+  mov dword ptr [rbp-16084], 1
+  shl dword ptr [rbp-16084], 0
+  movsxd rsi, dword ptr [rbp-16084]
+  mov qword ptr [rbp-4168], rsi
+  lea rsi, [rip+.L.data.main.443]
+  mov qword ptr [rbp-4176], rsi
+  mov rsi, qword ptr [rbp-4160]
+  cmp rsi, qword ptr [rbp-4168]
+  jne .L.else.main.1201
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4176]
+  mov r9, qword ptr [rbp-4168]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1202
+.L.else.main.1201:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4176]
+  mov r9, qword ptr [rbp-4160]
+  mov r10, qword ptr [rbp-4168]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1202:
+  mov qword ptr [rbp-4136], 8
+  mov dword ptr [rbp-16080], 1
+  shl dword ptr [rbp-16080], 3
+  movsxd rsi, dword ptr [rbp-16080]
+  mov qword ptr [rbp-4144], rsi
+  lea rsi, [rip+.L.data.main.444]
+  mov qword ptr [rbp-4152], rsi
+  mov rsi, qword ptr [rbp-4136]
+  cmp rsi, qword ptr [rbp-4144]
+  jne .L.else.main.1203
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4152]
+  mov r9, qword ptr [rbp-4144]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1204
+.L.else.main.1203:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4152]
+  mov r9, qword ptr [rbp-4136]
+  mov r10, qword ptr [rbp-4144]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1204:
+  mov qword ptr [rbp-4112], 10
+  mov dword ptr [rbp-16076], 5
+  shl dword ptr [rbp-16076], 1
+  movsxd rsi, dword ptr [rbp-16076]
+  mov qword ptr [rbp-4120], rsi
+  lea rsi, [rip+.L.data.main.445]
+  mov qword ptr [rbp-4128], rsi
+  mov rsi, qword ptr [rbp-4112]
+  cmp rsi, qword ptr [rbp-4120]
+  jne .L.else.main.1205
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4128]
+  mov r9, qword ptr [rbp-4120]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1206
+.L.else.main.1205:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4128]
+  mov r9, qword ptr [rbp-4112]
+  mov r10, qword ptr [rbp-4120]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1206:
+  mov qword ptr [rbp-4088], 2
+  mov dword ptr [rbp-16072], 5
+  sar dword ptr [rbp-16072], 1
+  movsxd rsi, dword ptr [rbp-16072]
+  mov qword ptr [rbp-4096], rsi
+  lea rsi, [rip+.L.data.main.446]
+  mov qword ptr [rbp-4104], rsi
+  mov rsi, qword ptr [rbp-4088]
+  cmp rsi, qword ptr [rbp-4096]
+  jne .L.else.main.1207
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4104]
+  mov r9, qword ptr [rbp-4096]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1208
+.L.else.main.1207:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4104]
+  mov r9, qword ptr [rbp-4088]
+  mov r10, qword ptr [rbp-4096]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1208:
+  mov rsi, 0
+  sub rsi, 1
+  mov qword ptr [rbp-4064], rsi
+  mov rsi, 0
+  sub rsi, 1
+  mov qword ptr [rbp-4072], rsi
+  lea rsi, [rip+.L.data.main.447]
+  mov qword ptr [rbp-4080], rsi
+  mov rsi, qword ptr [rbp-4064]
+  cmp rsi, qword ptr [rbp-4072]
+  jne .L.else.main.1209
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4080]
+  mov r9, qword ptr [rbp-4072]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1210
+.L.else.main.1209:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4080]
+  mov r9, qword ptr [rbp-4064]
+  mov r10, qword ptr [rbp-4072]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1210:
+  mov rsi, 0
+  sub rsi, 1
+  mov qword ptr [rbp-4040], rsi
+  mov rsi, 0
+  sub rsi, 1
+  mov dword ptr [rbp-16068], esi
+  movsxd rsi, dword ptr [rbp-16068]
+  mov qword ptr [rbp-4048], rsi
+  lea rsi, [rip+.L.data.main.448]
+  mov qword ptr [rbp-4056], rsi
+  mov rsi, qword ptr [rbp-4040]
+  cmp rsi, qword ptr [rbp-4048]
+  jne .L.else.main.1211
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4056]
+  mov r9, qword ptr [rbp-4048]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1212
+.L.else.main.1211:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4056]
+  mov r9, qword ptr [rbp-4040]
+  mov r10, qword ptr [rbp-4048]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1212:
+  mov rsi, 0
+  sub rsi, 1
+  mov qword ptr [rbp-4016], rsi
+  mov rsi, 0
+  sub rsi, 1
+  mov dword ptr [rbp-16064], esi
+  sar dword ptr [rbp-16064], 1
+  movsxd rsi, dword ptr [rbp-16064]
+  mov qword ptr [rbp-4024], rsi
+  lea rsi, [rip+.L.data.main.449]
+  mov qword ptr [rbp-4032], rsi
+  mov rsi, qword ptr [rbp-4016]
+  cmp rsi, qword ptr [rbp-4024]
+  jne .L.else.main.1213
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4032]
+  mov r9, qword ptr [rbp-4024]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1214
+.L.else.main.1213:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4032]
+  mov r9, qword ptr [rbp-4016]
+  mov r10, qword ptr [rbp-4024]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1214:
+  mov qword ptr [rbp-3992], 2
+  mov qword ptr [rbp-4000], 2
+  lea rsi, [rip+.L.data.main.450]
+  mov qword ptr [rbp-4008], rsi
+  mov rsi, qword ptr [rbp-3992]
+  cmp rsi, qword ptr [rbp-4000]
+  jne .L.else.main.1217
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-4008]
+  mov r9, qword ptr [rbp-4000]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1218
+.L.else.main.1217:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-4008]
+  mov r9, qword ptr [rbp-3992]
+  mov r10, qword ptr [rbp-4000]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1218:
+  mov qword ptr [rbp-3968], 1
+  mov qword ptr [rbp-3976], 1
+  lea rsi, [rip+.L.data.main.451]
+  mov qword ptr [rbp-3984], rsi
+  mov rsi, qword ptr [rbp-3968]
+  cmp rsi, qword ptr [rbp-3976]
+  jne .L.else.main.1221
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3984]
+  mov r9, qword ptr [rbp-3976]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1222
+.L.else.main.1221:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3984]
+  mov r9, qword ptr [rbp-3968]
+  mov r10, qword ptr [rbp-3976]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1222:
+  mov qword ptr [rbp-3944], 10
+  mov qword ptr [rbp-3952], 10
+  lea rsi, [rip+.L.data.main.452]
+  mov qword ptr [rbp-3960], rsi
+  mov rsi, qword ptr [rbp-3944]
+  cmp rsi, qword ptr [rbp-3952]
+  jne .L.else.main.1223
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3960]
+  mov r9, qword ptr [rbp-3952]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1224
+.L.else.main.1223:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3960]
+  mov r9, qword ptr [rbp-3944]
+  mov r10, qword ptr [rbp-3952]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1224:
+  mov qword ptr [rbp-3920], 1
+  mov dword ptr [rbp-16060], 0
+  mov rsi, 3
+  cmp rsi, 3
+  jne .L.break.main.1225
+  add dword ptr [rbp-16060], 1
+.L.break.main.1225:
+  movsxd rsi, dword ptr [rbp-16060]
+  mov qword ptr [rbp-3928], rsi
+  lea rsi, [rip+.L.data.main.453]
+  mov qword ptr [rbp-3936], rsi
+  mov rsi, qword ptr [rbp-3920]
+  cmp rsi, qword ptr [rbp-3928]
+  jne .L.else.main.1227
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3936]
+  mov r9, qword ptr [rbp-3928]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1228
+.L.else.main.1227:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3936]
+  mov r9, qword ptr [rbp-3920]
+  mov r10, qword ptr [rbp-3928]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1228:
+  mov qword ptr [rbp-3896], 12063
+  mov dword ptr [rbp-16056], 0
+  mov rsi, 0
+  sub rsi, 3
+  mov dword ptr [rbp-16052], esi
+  movsxd rsi, dword ptr [rbp-16052]
+  cmp rsi, 15
+  jge .L.break.main.1230
+  lea rsi, [rip+.L.table.main.1240]
+  .p2align 4,,10
+.L.begin.main.1231:
+  movsxd rdi, dword ptr [rbp-16052]
+  cmp rdi, 7
+  ja .L.case.main.1239
+  shl rdi, 2
+  add rdi, rsi
+  movsxd rdi, dword ptr [rdi]
+  add rdi, rsi
+  jmp rdi
+.L.table.main.1240:
+  .long .L.case.main.1238-.L.table.main.1240
+  .long .L.case.main.1237-.L.table.main.1240
+  .long .L.case.main.1236-.L.table.main.1240
+  .long .L.case.main.1239-.L.table.main.1240
+  .long .L.case.main.1235-.L.table.main.1240
+  .long .L.case.main.1234-.L.table.main.1240
+  .long .L.case.main.1239-.L.table.main.1240
+  .long .L.case.main.1233-.L.table.main.1240
+.L.case.main.1238:
+  add dword ptr [rbp-16056], 1
+  jmp .L.break.main.1232
+.L.case.main.1237:
+  add dword ptr [rbp-16056], 2
+  jmp .L.break.main.1232
+.L.case.main.1236:
+  add dword ptr [rbp-16056], 4
+  jmp .L.break.main.1232
+.L.case.main.1235:
+  add dword ptr [rbp-16056], 8
+  jmp .L.break.main.1232
+.L.case.main.1234:
+  add dword ptr [rbp-16056], 16
+  jmp .L.break.main.1232
+.L.case.main.1233:
+  add dword ptr [rbp-16056], 32
+  jmp .L.break.main.1232
+.L.case.main.1239:
+  add dword ptr [rbp-16056], 1000
+.L.break.main.1232:
+  add dword ptr [rbp-16052], 1
+  movsxd rdi, dword ptr [rbp-16052]
+  cmp rdi, 15
+  jl .L.begin.main.1231
+.L.break.main.1230:
+  movsxd rsi, dword ptr [rbp-16056]
+  mov qword ptr [rbp-3904], rsi
+  lea rsi, [rip+.L.data.main.454]
+  mov qword ptr [rbp-3912], rsi
+  mov rsi, qword ptr [rbp-3896]
+  cmp rsi, qword ptr [rbp-3904]
+  jne .L.else.main.1241
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3912]
+  mov r9, qword ptr [rbp-3904]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1242
+.L.else.main.1241:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3912]
+  mov r9, qword ptr [rbp-3896]
+  mov r10, qword ptr [rbp-3904]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1242:
+  mov qword ptr [rbp-3872], 25
+  mov dword ptr [rbp-16048], 0
+  mov rsi, 0
+  sub rsi, 3
+  mov dword ptr [rbp-16044], esi
+  movsxd rsi, dword ptr [rbp-16044]
+  cmp rsi, 12
+  jge .L.break.main.1244
+  lea rsi, [rip+.L.table.main.1251]
+  .p2align 4,,10
+.L.begin.main.1245:
+  movsxd rdi, dword ptr [rbp-16044]
+  sub rdi, 5
+  sub rdi, -5
+  cmp rdi, 4
+  ja .L.break.main.1246
+  shl rdi, 2
+  add rdi, rsi
+  movsxd rdi, dword ptr [rdi]
+  add rdi, rsi
+  jmp rdi
+.L.table.main.1251:
+  .long .L.case.main.1250-.L.table.main.1251
+  .long .L.case.main.1249-.L.table.main.1251
+  .long .L.break.main.1246-.L.table.main.1251
+  .long .L.case.main.1248-.L.table.main.1251
+  .long .L.case.main.1247-.L.table.main.1251
+.L.case.main.1250:
+  add dword ptr [rbp-16048], 1
+.L.case.main.1249:
+  add dword ptr [rbp-16048], 2
+  jmp .L.break.main.1246
+.L.case.main.1248:
+  add dword ptr [rbp-16048], 4
+.L.case.main.1247:
+  add dword ptr [rbp-16048], 8
+.L.break.main.1246:
+  add dword ptr [rbp-16044], 1
+  movsxd rdi, dword ptr [rbp-16044]
+  cmp rdi, 12
+  jl .L.begin.main.1245
+.L.break.main.1244:
+  movsxd rsi, dword ptr [rbp-16048]
+  mov qword ptr [rbp-3880], rsi
+  lea rsi, [rip+.L.data.main.455]
+  mov qword ptr [rbp-3888], rsi
+  mov rsi, qword ptr [rbp-3872]
+  cmp rsi, qword ptr [rbp-3880]
+  jne .L.else.main.1252
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3888]
+  mov r9, qword ptr [rbp-3880]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1253
+.L.else.main.1252:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3888]
+  mov r9, qword ptr [rbp-3872]
+  mov r10, qword ptr [rbp-3880]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1253:
+  mov qword ptr [rbp-3848], 127
+  mov dword ptr [rbp-16040], 0
+  mov dword ptr [rbp-16036], 0
+  movsxd rsi, dword ptr [rbp-16036]
+  cmp rsi, 1100
+  jge .L.break.main.1255
+  .p2align 4,,10
+.L.begin.main.1256:
+  movsxd rsi, dword ptr [rbp-16036]
+  cmp rsi, 20
+  je .L.case.main.1260
+  jg .L.upper.main.1266
+  cmp rsi, 1
+  je .L.case.main.1264
+  cmp rsi, 5
+  je .L.case.main.1258
+  cmp rsi, 10
+  je .L.case.main.1263
+  jmp .L.case.main.1265
+.L.upper.main.1266:
+  cmp rsi, 100
+  je .L.case.main.1262
+  cmp rsi, 300
+  je .L.case.main.1259
+  cmp rsi, 1000
+  je .L.case.main.1261
+  jmp .L.case.main.1265
+.L.case.main.1264:
+  add dword ptr [rbp-16040], 1
+  jmp .L.break.main.1257
+.L.case.main.1263:
+  add dword ptr [rbp-16040], 2
+  jmp .L.break.main.1257
+.L.case.main.1262:
+  add dword ptr [rbp-16040], 4
+  jmp .L.break.main.1257
+.L.case.main.1261:
+  add dword ptr [rbp-16040], 8
+  jmp .L.break.main.1257
+.L.case.main.1260:
+  add dword ptr [rbp-16040], 16
+  jmp .L.break.main.1257
+.L.case.main.1259:
+  add dword ptr [rbp-16040], 32
+  jmp .L.break.main.1257
+.L.case.main.1258:
+  add dword ptr [rbp-16040], 64
+  jmp .L.break.main.1257
+.L.case.main.1265:
+  add dword ptr [rbp-16040], 0
+.L.break.main.1257:
+  add dword ptr [rbp-16036], 1
+  movsxd rsi, dword ptr [rbp-16036]
+  cmp rsi, 1100
+  jl .L.begin.main.1256
+.L.break.main.1255:
+  movsxd rsi, dword ptr [rbp-16040]
+  mov qword ptr [rbp-3856], rsi
+  lea rsi, [rip+.L.data.main.456]
+  mov qword ptr [rbp-3864], rsi
+  mov rsi, qword ptr [rbp-3848]
+  cmp rsi, qword ptr [rbp-3856]
+  jne .L.else.main.1267
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3864]
+  mov r9, qword ptr [rbp-3856]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1268
+.L.else.main.1267:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3864]
+  mov r9, qword ptr [rbp-3848]
+  mov r10, qword ptr [rbp-3856]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1268:
+  mov qword ptr [rbp-3824], 144
+  mov dword ptr [rbp-16032], 0
+  mov dword ptr [rbp-16028], 0
+  movsxd rsi, dword ptr [rbp-16028]
+  cmp rsi, 50
+  jge .L.break.main.1270
+  lea rsi, [rip+.L.table.main.1283]
+  lea rdi, [rip+.L.table.main.1284]
+  .p2align 4,,10
+.L.begin.main.1271:
+  movsxd r8, dword ptr [rbp-16028]
+  cmp r8, 20
+  je .L.case.main.1273
+  jg .L.upper.main.1282
+  mov r9, r8
+  sub r9, 1
+  cmp r9, 3
+  ja .L.break.main.1272
+  shl r9, 2
+  add r9, rsi
+  movsxd r9, dword ptr [r9]
+  add r9, rsi
+  jmp r9
+.L.table.main.1283:
+  .long .L.case.main.1278-.L.table.main.1283
+  .long .L.case.main.1279-.L.table.main.1283
+  .long .L.case.main.1280-.L.table.main.1283
+  .long .L.case.main.1281-.L.table.main.1283
+.L.upper.main.1282:
+  sub r8, 40
+  cmp r8, 3
+  ja .L.break.main.1272
+  shl r8, 2
+  add r8, rdi
+  movsxd r8, dword ptr [r8]
+  add r8, rdi
+  jmp r8
+.L.table.main.1284:
+  .long .L.case.main.1274-.L.table.main.1284
+  .long .L.case.main.1275-.L.table.main.1284
+  .long .L.case.main.1276-.L.table.main.1284
+  .long .L.case.main.1277-.L.table.main.1284
+.L.case.main.1278:
+.L.case.main.1279:
+.L.case.main.1280:
+.L.case.main.1281:
+  add dword ptr [rbp-16032], 1
+  jmp .L.break.main.1272
+.L.case.main.1274:
+.L.case.main.1275:
+.L.case.main.1276:
+.L.case.main.1277:
+  add dword ptr [rbp-16032], 10
+  jmp .L.break.main.1272
+.L.case.main.1273:
+  add dword ptr [rbp-16032], 100
+.L.break.main.1272:
+  add dword ptr [rbp-16028], 1
+  movsxd r8, dword ptr [rbp-16028]
+  cmp r8, 50
+  jl .L.begin.main.1271
+.L.break.main.1270:
+  movsxd rsi, dword ptr [rbp-16032]
+  mov qword ptr [rbp-3832], rsi
+  lea rsi, [rip+.L.data.main.457]
+  mov qword ptr [rbp-3840], rsi
+  mov rsi, qword ptr [rbp-3824]
+  cmp rsi, qword ptr [rbp-3832]
+  jne .L.else.main.1285
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3840]
+  mov r9, qword ptr [rbp-3832]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1286
+.L.else.main.1285:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3840]
+  mov r9, qword ptr [rbp-3824]
+  mov r10, qword ptr [rbp-3832]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1286:
+  mov qword ptr [rbp-3800], 5
+  movabs rsi, 4294967298
+  mov qword ptr [rbp-16024], rsi
+  mov dword ptr [rbp-16016], 0
+  mov rsi, qword ptr [rbp-16024]
+  sub rsi, 2
+  cmp rsi, 3
+  ja .L.case.main.1292
+  lea rdi, [rip+.L.table.main.1293]
+  shl rsi, 2
+  add rsi, rdi
+  movsxd rsi, dword ptr [rsi]
+  add rsi, rdi
+  jmp rsi
+.L.table.main.1293:
+  .long .L.case.main.1291-.L.table.main.1293
+  .long .L.case.main.1290-.L.table.main.1293
+  .long .L.case.main.1289-.L.table.main.1293
+  .long .L.case.main.1288-.L.table.main.1293
+.L.case.main.1291:
+  mov dword ptr [rbp-16016], 1
+  jmp .L.break.main.1287
+.L.case.main.1290:
+  mov dword ptr [rbp-16016], 2
+  jmp .L.break.main.1287
+.L.case.main.1289:
+  mov dword ptr [rbp-16016], 3
+  jmp .L.break.main.1287
+.L.case.main.1288:
+  mov dword ptr [rbp-16016], 4
+  jmp .L.break.main.1287
+.L.case.main.1292:
+  mov dword ptr [rbp-16016], 5
+.L.break.main.1287:
+  movsxd rsi, dword ptr [rbp-16016]
+  mov qword ptr [rbp-3808], rsi
+  lea rsi, [rip+.L.data.main.458]
+  mov qword ptr [rbp-3816], rsi
+  mov rsi, qword ptr [rbp-3800]
+  cmp rsi, qword ptr [rbp-3808]
+  jne .L.else.main.1294
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3816]
+  mov r9, qword ptr [rbp-3808]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1295
+.L.else.main.1294:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3816]
+  mov r9, qword ptr [rbp-3800]
+  mov r10, qword ptr [rbp-3808]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1295:
+  mov qword ptr [rbp-3776], 8
+  mov qword ptr [rbp-3784], 8
+  lea rsi, [rip+.L.data.main.459]
+  mov qword ptr [rbp-3792], rsi
+  mov rsi, qword ptr [rbp-3776]
+  cmp rsi, qword ptr [rbp-3784]
+  jne .L.else.main.1296
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3792]
+  mov r9, qword ptr [rbp-3784]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1297
+.L.else.main.1296:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3792]
+  mov r9, qword ptr [rbp-3776]
+  mov r10, qword ptr [rbp-3784]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1297:
+  mov qword ptr [rbp-3752], 2
+  mov qword ptr [rbp-3760], 2
+  lea rsi, [rip+.L.data.main.460]
+  mov qword ptr [rbp-3768], rsi
+  mov rsi, qword ptr [rbp-3752]
+  cmp rsi, qword ptr [rbp-3760]
+  jne .L.else.main.1298
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3768]
+  mov r9, qword ptr [rbp-3760]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1299
+.L.else.main.1298:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3768]
+  mov r9, qword ptr [rbp-3752]
+  mov r10, qword ptr [rbp-3760]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1299:
+  mov qword ptr [rbp-3728], 3
+  mov qword ptr [rbp-3736], 3
+  lea rsi, [rip+.L.data.main.461]
+  mov qword ptr [rbp-3744], rsi
+  mov rsi, qword ptr [rbp-3728]
+  cmp rsi, qword ptr [rbp-3736]
+  jne .L.else.main.1300
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3744]
+  mov r9, qword ptr [rbp-3736]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1301
+.L.else.main.1300:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3744]
+  mov r9, qword ptr [rbp-3728]
+  mov r10, qword ptr [rbp-3736]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1301:
+  mov qword ptr [rbp-3704], 1
+  lea rsi, [rbp-15996]
+  add rsi, 0
+  mov dword ptr [rsi], 1
+  lea rsi, [rbp-15996]
+  add rsi, 4
+  mov dword ptr [rsi], 2
+  lea rsi, [rbp-15996]
+  add rsi, 8
+  mov dword ptr [rsi], 3
+  lea rsi, [rbp-15996]
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-3712], rsi
+  lea rsi, [rip+.L.data.main.462]
+  mov qword ptr [rbp-3720], rsi
+  mov rsi, qword ptr [rbp-3704]
+  cmp rsi, qword ptr [rbp-3712]
+  jne .L.else.main.1302
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3720]
+  mov r9, qword ptr [rbp-3712]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1303
+.L.else.main.1302:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3720]
+  mov r9, qword ptr [rbp-3704]
+  mov r10, qword ptr [rbp-3712]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1303:
+  mov qword ptr [rbp-3680], 2
+  lea rsi, [rbp-15984]
+  add rsi, 0
+  mov dword ptr [rsi], 1
+  lea rsi, [rbp-15984]
+  add rsi, 4
+  mov dword ptr [rsi], 2
+  lea rsi, [rbp-15984]
+  add rsi, 8
+  mov dword ptr [rsi], 3
+  lea rsi, [rbp-15984]
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-3688], rsi
+  lea rsi, [rip+.L.data.main.463]
+  mov qword ptr [rbp-3696], rsi
+  mov rsi, qword ptr [rbp-3680]
+  cmp rsi, qword ptr [rbp-3688]
+  jne .L.else.main.1304
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3696]
+  mov r9, qword ptr [rbp-3688]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1305
+.L.else.main.1304:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3696]
+  mov r9, qword ptr [rbp-3680]
+  mov r10, qword ptr [rbp-3688]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1305:
+  mov qword ptr [rbp-3656], 3
+  lea rsi, [rbp-15972]
+  add rsi, 0
+  mov dword ptr [rsi], 1
+  lea rsi, [rbp-15972]
+  add rsi, 4
+  mov dword ptr [rsi], 2
+  lea rsi, [rbp-15972]
+  add rsi, 8
+  mov dword ptr [rsi], 3
+  lea rsi, [rbp-15972]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-3664], rsi
+  lea rsi, [rip+.L.data.main.464]
+  mov qword ptr [rbp-3672], rsi
+  mov rsi, qword ptr [rbp-3656]
+  cmp rsi, qword ptr [rbp-3664]
+  jne .L.else.main.1306
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3672]
+  mov r9, qword ptr [rbp-3664]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1307
+.L.else.main.1306:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3672]
+  mov r9, qword ptr [rbp-3656]
+  mov r10, qword ptr [rbp-3664]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1307:
+  mov qword ptr [rbp-3632], 3
+  lea rsi, [rbp-15960]
+  add rsi, 0
+  mov dword ptr [rsi], 1
+  lea rsi, [rbp-15960]
+  add rsi, 4
+  mov dword ptr [rsi], 2
+  lea rsi, [rbp-15960]
+  add rsi, 8
+  mov dword ptr [rsi], 3
+  lea rsi, [rbp-15960]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-3640], rsi
+  lea rsi, [rip+.L.data.main.465]
+  mov qword ptr [rbp-3648], rsi
+  mov rsi, qword ptr [rbp-3632]
+  cmp rsi, qword ptr [rbp-3640]
+  jne .L.else.main.1308
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3648]
+  mov r9, qword ptr [rbp-3640]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1309
+.L.else.main.1308:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3648]
+  mov r9, qword ptr [rbp-3632]
+  mov r10, qword ptr [rbp-3640]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1309:
+  mov qword ptr [rbp-3608], 0
+  lea rsi, [rbp-15948]
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rbp-15948]
+  add rsi, 4
+  mov dword ptr [rsi], 0
+  lea rsi, [rbp-15948]
+  add rsi, 8
+  mov dword ptr [rsi], 0
+  lea rsi, [rbp-15948]
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-3616], rsi
+  lea rsi, [rip+.L.data.main.466]
+  mov qword ptr [rbp-3624], rsi
+  mov rsi, qword ptr [rbp-3608]
+  cmp rsi, qword ptr [rbp-3616]
+  jne .L.else.main.1310
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3624]
+  mov r9, qword ptr [rbp-3616]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1311
+.L.else.main.1310:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3624]
+  mov r9, qword ptr [rbp-3608]
+  mov r10, qword ptr [rbp-3616]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1311:
+  mov qword ptr [rbp-3584], 0
+  lea rsi, [rbp-15936]
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rbp-15936]
+  add rsi, 4
+  mov dword ptr [rsi], 0
+  lea rsi, [rbp-15936]
+  add rsi, 8
+  mov dword ptr [rsi], 0
+  lea rsi, [rbp-15936]
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-3592], rsi
+  lea rsi, [rip+.L.data.main.467]
+  mov qword ptr [rbp-3600], rsi
+  mov rsi, qword ptr [rbp-3584]
+  cmp rsi, qword ptr [rbp-3592]
+  jne .L.else.main.1312
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3600]
+  mov r9, qword ptr [rbp-3592]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1313
+.L.else.main.1312:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3600]
+  mov r9, qword ptr [rbp-3584]
+  mov r10, qword ptr [rbp-3592]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1313:
+  mov qword ptr [rbp-3560], 0
+  lea rsi, [rbp-15924]
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rbp-15924]
+  add rsi, 4
+  mov dword ptr [rsi], 0
+  lea rsi, [rbp-15924]
+  add rsi, 8
+  mov dword ptr [rsi], 0
+  lea rsi, [rbp-15924]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-3568], rsi
+  lea rsi, [rip+.L.data.main.468]
+  mov qword ptr [rbp-3576], rsi
+  mov rsi, qword ptr [rbp-3560]
+  cmp rsi, qword ptr [rbp-3568]
+  jne .L.else.main.1314
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3576]
+  mov r9, qword ptr [rbp-3568]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1315
+.L.else.main.1314:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3576]
+  mov r9, qword ptr [rbp-3560]
+  mov r10, qword ptr [rbp-3568]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1315:
+  mov qword ptr [rbp-3536], 2
+  lea rsi, [rbp-15912]
+  add rsi, 0
+  add rsi, 0
+  mov dword ptr [rsi], 1
+  lea rsi, [rbp-15912]
+  add rsi, 0
+  add rsi, 4
+  mov dword ptr [rsi], 2
+  lea rsi, [rbp-15912]
+  add rsi, 0
+  add rsi, 8
+  mov dword ptr [rsi], 3
+  lea rsi, [rbp-15912]
+  add rsi, 12
+  add rsi, 0
+  mov dword ptr [rsi], 4
+  lea rsi, [rbp-15912]
+  add rsi, 12
+  add rsi, 4
+  mov dword ptr [rsi], 5
+  lea rsi, [rbp-15912]
+  add rsi, 12
+  add rsi, 8
+  mov dword ptr [rsi], 6
+  lea rsi, [rbp-15912]
+  add rsi, 0
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-3544], rsi
+  lea rsi, [rip+.L.data.main.469]
+  mov qword ptr [rbp-3552], rsi
+  mov rsi, qword ptr [rbp-3536]
+  cmp rsi, qword ptr [rbp-3544]
+  jne .L.else.main.1316
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3552]
+  mov r9, qword ptr [rbp-3544]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1317
+.L.else.main.1316:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3552]
+  mov r9, qword ptr [rbp-3536]
+  mov r10, qword ptr [rbp-3544]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1317:
+  mov qword ptr [rbp-3512], 4
+  lea rsi, [rbp-15888]
+  add rsi, 0
+  add rsi, 0
+  mov dword ptr [rsi], 1
+  lea rsi, [rbp-15888]
+  add rsi, 0
+  add rsi, 4
+  mov dword ptr [rsi], 2
+  lea rsi, [rbp-15888]
+  add rsi, 0
+  add rsi, 8
+  mov dword ptr [rsi], 3
+  lea rsi, [rbp-15888]
+  add rsi, 12
+  add rsi, 0
+  mov dword ptr [rsi], 4
+  lea rsi, [rbp-15888]
+  add rsi, 12
+  add rsi, 4
+  mov dword ptr [rsi], 5
+  lea rsi, [rbp-15888]
+  add rsi, 12
+  add rsi, 8
+  mov dword ptr [rsi], 6
+  lea rsi, [rbp-15888]
+  add rsi, 12
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-3520], rsi
+  lea rsi, [rip+.L.data.main.470]
+  mov qword ptr [rbp-3528], rsi
+  mov rsi, qword ptr [rbp-3512]
+  cmp rsi, qword ptr [rbp-3520]
+  jne .L.else.main.1318
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3528]
+  mov r9, qword ptr [rbp-3520]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1319
+.L.else.main.1318:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3528]
+  mov r9, qword ptr [rbp-3512]
+  mov r10, qword ptr [rbp-3520]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1319:
+  mov qword ptr [rbp-3488], 6
+  lea rsi, [rbp-15864]
+  add rsi, 0
+  add rsi, 0
+  mov dword ptr [rsi], 1
+  lea rsi, [rbp-15864]
+  add rsi, 0
+  add rsi, 4
+  mov dword ptr [rsi], 2
+  lea rsi, [rbp-15864]
+  add rsi, 0
+  add rsi, 8
+  mov dword ptr [rsi], 3
+  lea rsi, [rbp-15864]
+  add rsi, 12
+  add rsi, 0
+  mov dword ptr [rsi], 4
+  lea rsi, [rbp-15864]
+  add rsi, 12
+  add rsi, 4
+  mov dword ptr [rsi], 5
+  lea rsi, [rbp-15864]
+  add rsi, 12
+  add rsi, 8
+  mov dword ptr [rsi], 6
+  lea rsi, [rbp-15864]
+  add rsi, 12
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-3496], rsi
+  lea rsi, [rip+.L.data.main.471]
+  mov qword ptr [rbp-3504], rsi
+  mov rsi, qword ptr [rbp-3488]
+  cmp rsi, qword ptr [rbp-3496]
+  jne .L.else.main.1320
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3504]
+  mov r9, qword ptr [rbp-3496]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1321
+.L.else.main.1320:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3504]
+  mov r9, qword ptr [rbp-3488]
+  mov r10, qword ptr [rbp-3496]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1321:
+  mov qword ptr [rbp-3464], 2
+  lea rsi, [rbp-15840]
+  add rsi, 0
+  add rsi, 0
+  mov dword ptr [rsi], 1
+  lea rsi, [rbp-15840]
+  add rsi, 0
+  add rsi, 4
+  mov dword ptr [rsi], 2
+  lea rsi, [rbp-15840]
+  add rsi, 0
+  add rsi, 8
+  mov dword ptr [rsi], 0
+  lea rsi, [rbp-15840]
+  add rsi, 12
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rbp-15840]
+  add rsi, 12
+  add rsi, 8
+  mov dword ptr [rsi], 0
+  lea rsi, [rbp-15840]
+  add rsi, 0
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-3472], rsi
+  lea rsi, [rip+.L.data.main.472]
+  mov qword ptr [rbp-3480], rsi
+  mov rsi, qword ptr [rbp-3464]
+  cmp rsi, qword ptr [rbp-3472]
+  jne .L.else.main.1322
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3480]
+  mov r9, qword ptr [rbp-3472]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1323
+.L.else.main.1322:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3480]
+  mov r9, qword ptr [rbp-3464]
+  mov r10, qword ptr [rbp-3472]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1323:
+  mov qword ptr [rbp-3440], 0
+  lea rsi, [rbp-15816]
+  add rsi, 0
+  add rsi, 0
+  mov dword ptr [rsi], 1
+  lea rsi, [rbp-15816]
+  add rsi, 0
+  add rsi, 4
+  mov dword ptr [rsi], 2
+  lea rsi, [rbp-15816]
+  add rsi, 0
+  add rsi, 8
+  mov dword ptr [rsi], 0
+  lea rsi, [rbp-15816]
+  add rsi, 12
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rbp-15816]
+  add rsi, 12
+  add rsi, 8
+  mov dword ptr [rsi], 0
+  lea rsi, [rbp-15816]
+  add rsi, 12
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-3448], rsi
+  lea rsi, [rip+.L.data.main.473]
+  mov qword ptr [rbp-3456], rsi
+  mov rsi, qword ptr [rbp-3440]
+  cmp rsi, qword ptr [rbp-3448]
+  jne .L.else.main.1324
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3456]
+  mov r9, qword ptr [rbp-3448]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1325
+.L.else.main.1324:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3456]
+  mov r9, qword ptr [rbp-3440]
+  mov r10, qword ptr [rbp-3448]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1325:
+  mov qword ptr [rbp-3416], 0
+  lea rsi, [rbp-15792]
+  add rsi, 0
+  add rsi, 0
+  mov dword ptr [rsi], 1
+  lea rsi, [rbp-15792]
+  add rsi, 0
+  add rsi, 4
+  mov dword ptr [rsi], 2
+  lea rsi, [rbp-15792]
+  add rsi, 0
+  add rsi, 8
+  mov dword ptr [rsi], 0
+  lea rsi, [rbp-15792]
+  add rsi, 12
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rbp-15792]
+  add rsi, 12
+  add rsi, 8
+  mov dword ptr [rsi], 0
+  lea rsi, [rbp-15792]
+  add rsi, 12
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-3424], rsi
+  lea rsi, [rip+.L.data.main.474]
+  mov qword ptr [rbp-3432], rsi
+  mov rsi, qword ptr [rbp-3416]
+  cmp rsi, qword ptr [rbp-3424]
+  jne .L.else.main.1326
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3432]
+  mov r9, qword ptr [rbp-3424]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1327
+.L.else.main.1326:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3432]
+  mov r9, qword ptr [rbp-3416]
+  mov r10, qword ptr [rbp-3424]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1327:
+  mov qword ptr [rbp-3392], 97
+  lea rsi, [rbp-15768]
+  add rsi, 0
+  mov byte ptr [rsi], 97
+  lea rsi, [rbp-15768]
+  add rsi, 1
+  mov byte ptr [rsi], 98
+  lea rsi, [rbp-15768]
+  add rsi, 2
+  mov byte ptr [rsi], 99
+  lea rsi, [rbp-15768]
+  add rsi, 3
+  mov byte ptr [rsi], 0
+  lea rsi, [rbp-15768]
+  add rsi, 0
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rbp-3400], rsi
+  lea rsi, [rip+.L.data.main.475]
+  mov qword ptr [rbp-3408], rsi
+  mov rsi, qword ptr [rbp-3392]
+  cmp rsi, qword ptr [rbp-3400]
+  jne .L.else.main.1328
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3408]
+  mov r9, qword ptr [rbp-3400]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1329
+.L.else.main.1328:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3408]
+  mov r9, qword ptr [rbp-3392]
+  mov r10, qword ptr [rbp-3400]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1329:
+  mov qword ptr [rbp-3368], 99
+  lea rsi, [rbp-15764]
+  add rsi, 0
+  mov byte ptr [rsi], 97
+  lea rsi, [rbp-15764]
+  add rsi, 1
+  mov byte ptr [rsi], 98
+  lea rsi, [rbp-15764]
+  add rsi, 2
+  mov byte ptr [rsi], 99
+  lea rsi, [rbp-15764]
+  add rsi, 3
+  mov byte ptr [rsi], 0
+  lea rsi, [rbp-15764]
+  add rsi, 2
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rbp-3376], rsi
+  lea rsi, [rip+.L.data.main.476]
+  mov qword ptr [rbp-3384], rsi
+  mov rsi, qword ptr [rbp-3368]
+  cmp rsi, qword ptr [rbp-3376]
+  jne .L.else.main.1330
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3384]
+  mov r9, qword ptr [rbp-3376]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1331
+.L.else.main.1330:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3384]
+  mov r9, qword ptr [rbp-3368]
+  mov r10, qword ptr [rbp-3376]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1331:
+  mov qword ptr [rbp-3344], 0
+  lea rsi, [rbp-15760]
+  add rsi, 0
+  mov byte ptr [rsi], 97
+  lea rsi, [rbp-15760]
+  add rsi, 1
+  mov byte ptr [rsi], 98
+  lea rsi, [rbp-15760]
+  add rsi, 2
+  mov byte ptr [rsi], 99
+  lea rsi, [rbp-15760]
+  add rsi, 3
+  mov byte ptr [rsi], 0
+  lea rsi, [rbp-15760]
+  add rsi, 3
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rbp-3352], rsi
+  lea rsi, [rip+.L.data.main.477]
+  mov qword ptr [rbp-3360], rsi
+  mov rsi, qword ptr [rbp-3344]
+  cmp rsi, qword ptr [rbp-3352]
+  jne .L.else.main.1332
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3360]
+  mov r9, qword ptr [rbp-3352]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1333
+.L.else.main.1332:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3360]
+  mov r9, qword ptr [rbp-3344]
+  mov r10, qword ptr [rbp-3352]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1333:
+  mov qword ptr [rbp-3320], 97
+  lea rsi, [rbp-15756]
+  add rsi, 0
+  add rsi, 0
+  mov byte ptr [rsi], 97
+  lea rsi, [rbp-15756]
+  add rsi, 0
+  add rsi, 1
+  mov byte ptr [rsi], 98
+  lea rsi, [rbp-15756]
+  add rsi, 0
+  add rsi, 2
+  mov byte ptr [rsi], 99
+  lea rsi, [rbp-15756]
+  add rsi, 0
+  add rsi, 3
+  mov byte ptr [rsi], 0
+  lea rsi, [rbp-15756]
+  add rsi, 4
+  add rsi, 0
+  mov byte ptr [rsi], 100
+  lea rsi, [rbp-15756]
+  add rsi, 4
+  add rsi, 1
+  mov byte ptr [rsi], 101
+  lea rsi, [rbp-15756]
+  add rsi, 4
+  add rsi, 2
+  mov byte ptr [rsi], 102
+  lea rsi, [rbp-15756]
+  add rsi, 4
+  add rsi, 3
+  mov byte ptr [rsi], 0
+  lea rsi, [rbp-15756]
+  add rsi, 0
+  add rsi, 0
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rbp-3328], rsi
+  lea rsi, [rip+.L.data.main.478]
+  mov qword ptr [rbp-3336], rsi
+  mov rsi, qword ptr [rbp-3320]
+  cmp rsi, qword ptr [rbp-3328]
+  jne .L.else.main.1334
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3336]
+  mov r9, qword ptr [rbp-3328]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1335
+.L.else.main.1334:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3336]
+  mov r9, qword ptr [rbp-3320]
+  mov r10, qword ptr [rbp-3328]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1335:
+  mov qword ptr [rbp-3296], 0
+  lea rsi, [rbp-15748]
+  add rsi, 0
+  add rsi, 0
+  mov byte ptr [rsi], 97
+  lea rsi, [rbp-15748]
+  add rsi, 0
+  add rsi, 1
+  mov byte ptr [rsi], 98
+  lea rsi, [rbp-15748]
+  add rsi, 0
+  add rsi, 2
+  mov byte ptr [rsi], 99
+  lea rsi, [rbp-15748]
+  add rsi, 0
+  add rsi, 3
+  mov byte ptr [rsi], 0
+  lea rsi, [rbp-15748]
+  add rsi, 4
+  add rsi, 0
+  mov byte ptr [rsi], 100
+  lea rsi, [rbp-15748]
+  add rsi, 4
+  add rsi, 1
+  mov byte ptr [rsi], 101
+  lea rsi, [rbp-15748]
+  add rsi, 4
+  add rsi, 2
+  mov byte ptr [rsi], 102
+  lea rsi, [rbp-15748]
+  add rsi, 4
+  add rsi, 3
+  mov byte ptr [rsi], 0
+  lea rsi, [rbp-15748]
+  add rsi, 0
+  add rsi, 3
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rbp-3304], rsi
+  lea rsi, [rip+.L.data.main.479]
+  mov qword ptr [rbp-3312], rsi
+  mov rsi, qword ptr [rbp-3296]
+  cmp rsi, qword ptr [rbp-3304]
+  jne .L.else.main.1336
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3312]
+  mov r9, qword ptr [rbp-3304]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1337
+.L.else.main.1336:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3312]
+  mov r9, qword ptr [rbp-3296]
+  mov r10, qword ptr [rbp-3304]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1337:
+  mov qword ptr [rbp-3272], 100
+  lea rsi, [rbp-15740]
+  add rsi, 0
+  add rsi, 0
+  mov byte ptr [rsi], 97
+  lea rsi, [rbp-15740]
+  add rsi, 0
+  add rsi, 1
+  mov byte ptr [rsi], 98
+  lea rsi, [rbp-15740]
+  add rsi, 0
+  add rsi, 2
+  mov byte ptr [rsi], 99
+  lea rsi, [rbp-15740]
+  add rsi, 0
+  add rsi, 3
+  mov byte ptr [rsi], 0
+  lea rsi, [rbp-15740]
+  add rsi, 4
+  add rsi, 0
+  mov byte ptr [rsi], 100
+  lea rsi, [rbp-15740]
+  add rsi, 4
+  add rsi, 1
+  mov byte ptr [rsi], 101
+  lea rsi, [rbp-15740]
+  add rsi, 4
+  add rsi, 2
+  mov byte ptr [rsi], 102
+  lea rsi, [rbp-15740]
+  add rsi, 4
+  add rsi, 3
+  mov byte ptr [rsi], 0
+  lea rsi, [rbp-15740]
+  add rsi, 4
+  add rsi, 0
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rbp-3280], rsi
+  lea rsi, [rip+.L.data.main.480]
+  mov qword ptr [rbp-3288], rsi
+  mov rsi, qword ptr [rbp-3272]
+  cmp rsi, qword ptr [rbp-3280]
+  jne .L.else.main.1338
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3288]
+  mov r9, qword ptr [rbp-3280]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1339
+.L.else.main.1338:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3288]
+  mov r9, qword ptr [rbp-3272]
+  mov r10, qword ptr [rbp-3280]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1339:
+  mov qword ptr [rbp-3248], 102
+  lea rsi, [rbp-15732]
+  add rsi, 0
+  add rsi, 0
+  mov byte ptr [rsi], 97
+  lea rsi, [rbp-15732]
+  add rsi, 0
+  add rsi, 1
+  mov byte ptr [rsi], 98
+  lea rsi, [rbp-15732]
+  add rsi, 0
+  add rsi, 2
+  mov byte ptr [rsi], 99
+  lea rsi, [rbp-15732]
+  add rsi, 0
+  add rsi, 3
+  mov byte ptr [rsi], 0
+  lea rsi, [rbp-15732]
+  add rsi, 4
+  add rsi, 0
+  mov byte ptr [rsi], 100
+  lea rsi, [rbp-15732]
+  add rsi, 4
+  add rsi, 1
+  mov byte ptr [rsi], 101
+  lea rsi, [rbp-15732]
+  add rsi, 4
+  add rsi, 2
+  mov byte ptr [rsi], 102
+  lea rsi, [rbp-15732]
+  add rsi, 4
+  add rsi, 3
+  mov byte ptr [rsi], 0
+  lea rsi, [rbp-15732]
+  add rsi, 4
+  add rsi, 2
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rbp-3256], rsi
+  lea rsi, [rip+.L.data.main.481]
+  mov qword ptr [rbp-3264], rsi
+  mov rsi, qword ptr [rbp-3248]
+  cmp rsi, qword ptr [rbp-3256]
+  jne .L.else.main.1340
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3264]
+  mov r9, qword ptr [rbp-3256]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1341
+.L.else.main.1340:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3264]
+  mov r9, qword ptr [rbp-3248]
+  mov r10, qword ptr [rbp-3256]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1341:
+  mov qword ptr [rbp-3224], 4
+  lea rsi, [rbp-15724]
+  add rsi, 0
+  mov dword ptr [rsi], 1
+  lea rsi, [rbp-15724]
+  add rsi, 4
+  mov dword ptr [rsi], 2
+  lea rsi, [rbp-15724]
+  add rsi, 8
+  mov dword ptr [rsi], 3
+  lea rsi, [rbp-15724]
+  add rsi, 12
+  mov dword ptr [rsi], 4
+  lea rsi, [rbp-15724]
+  add rsi, 12
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-3232], rsi
+  lea rsi, [rip+.L.data.main.482]
+  mov qword ptr [rbp-3240], rsi
+  mov rsi, qword ptr [rbp-3224]
+  cmp rsi, qword ptr [rbp-3232]
+  jne .L.else.main.1342
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3240]
+  mov r9, qword ptr [rbp-3232]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1343
+.L.else.main.1342:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3240]
+  mov r9, qword ptr [rbp-3224]
+  mov r10, qword ptr [rbp-3232]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1343:
+  mov qword ptr [rbp-3200], 16
+  lea rsi, [rbp-15708]
+  add rsi, 0
+  mov dword ptr [rsi], 1
+  lea rsi, [rbp-15708]
+  add rsi, 4
+  mov dword ptr [rsi], 2
+  lea rsi, [rbp-15708]
+  add rsi, 8
+  mov dword ptr [rsi], 3
+  lea rsi, [rbp-15708]
+  add rsi, 12
+  mov dword ptr [rsi], 4
+  mov qword ptr [rbp-3208], 16
+  lea rsi, [rip+.L.data.main.483]
+  mov qword ptr [rbp-3216], rsi
+  mov rsi, qword ptr [rbp-3200]
+  cmp rsi, qword ptr [rbp-3208]
+  jne .L.else.main.1344
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3216]
+  mov r9, qword ptr [rbp-3208]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1345
+.L.else.main.1344:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3216]
+  mov r9, qword ptr [rbp-3200]
+  mov r10, qword ptr [rbp-3208]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1345:
+  mov qword ptr [rbp-3176], 4
+  lea rsi, [rbp-15692]
+  add rsi, 0
+  mov byte ptr [rsi], 102
+  lea rsi, [rbp-15692]
+  add rsi, 1
+  mov byte ptr [rsi], 111
+  lea rsi, [rbp-15692]
+  add rsi, 2
+  mov byte ptr [rsi], 111
+  lea rsi, [rbp-15692]
+  add rsi, 3
+  mov byte ptr [rsi], 0
+  mov qword ptr [rbp-3184], 4
+  lea rsi, [rip+.L.data.main.484]
+  mov qword ptr [rbp-3192], rsi
+  mov rsi, qword ptr [rbp-3176]
+  cmp rsi, qword ptr [rbp-3184]
+  jne .L.else.main.1346
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3192]
+  mov r9, qword ptr [rbp-3184]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1347
+.L.else.main.1346:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3192]
+  mov r9, qword ptr [rbp-3176]
+  mov r10, qword ptr [rbp-3184]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1347:
+  mov qword ptr [rbp-3152], 1
+  mov dword ptr [rbp-15688], 1
+  mov dword ptr [rbp-15684], 2
+  mov dword ptr [rbp-15680], 3
+  movsxd rsi, dword ptr [rbp-15688]
+  mov qword ptr [rbp-3160], rsi
+  lea rsi, [rip+.L.data.main.485]
+  mov qword ptr [rbp-3168], rsi
+  mov rsi, qword ptr [rbp-3152]
+  cmp rsi, qword ptr [rbp-3160]
+  jne .L.else.main.1348
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3168]
+  mov r9, qword ptr [rbp-3160]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1349
+.L.else.main.1348:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3168]
+  mov r9, qword ptr [rbp-3152]
+  mov r10, qword ptr [rbp-3160]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1349:
+  mov qword ptr [rbp-3128], 2
+  mov dword ptr [rbp-15676], 1
+  mov dword ptr [rbp-15672], 2
+  mov dword ptr [rbp-15668], 3
+  movsxd rsi, dword ptr [rbp-15672]
+  mov qword ptr [rbp-3136], rsi
+  lea rsi, [rip+.L.data.main.486]
+  mov qword ptr [rbp-3144], rsi
+  mov rsi, qword ptr [rbp-3128]
+  cmp rsi, qword ptr [rbp-3136]
+  jne .L.else.main.1350
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3144]
+  mov r9, qword ptr [rbp-3136]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1351
+.L.else.main.1350:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3144]
+  mov r9, qword ptr [rbp-3128]
+  mov r10, qword ptr [rbp-3136]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1351:
+  mov qword ptr [rbp-3104], 3
+  mov dword ptr [rbp-15664], 1
+  mov dword ptr [rbp-15660], 2
+  mov dword ptr [rbp-15656], 3
+  movsxd rsi, dword ptr [rbp-15656]
+  mov qword ptr [rbp-3112], rsi
+  lea rsi, [rip+.L.data.main.487]
+  mov qword ptr [rbp-3120], rsi
+  mov rsi, qword ptr [rbp-3104]
+  cmp rsi, qword ptr [rbp-3112]
+  jne .L.else.main.1352
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3120]
+  mov r9, qword ptr [rbp-3112]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1353
+.L.else.main.1352:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3120]
+  mov r9, qword ptr [rbp-3104]
+  mov r10, qword ptr [rbp-3112]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1353:
+  mov qword ptr [rbp-3080], 1
+  mov dword ptr [rbp-15652], 1
+  mov dword ptr [rbp-15648], 0
+  mov dword ptr [rbp-15644], 0
+  movsxd rsi, dword ptr [rbp-15652]
+  mov qword ptr [rbp-3088], rsi
+  lea rsi, [rip+.L.data.main.488]
+  mov qword ptr [rbp-3096], rsi
+  mov rsi, qword ptr [rbp-3080]
+  cmp rsi, qword ptr [rbp-3088]
+  jne .L.else.main.1354
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3096]
+  mov r9, qword ptr [rbp-3088]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1355
+.L.else.main.1354:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3096]
+  mov r9, qword ptr [rbp-3080]
+  mov r10, qword ptr [rbp-3088]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1355:
+  mov qword ptr [rbp-3056], 0
+  mov dword ptr [rbp-15640], 1
+  mov dword ptr [rbp-15636], 0
+  mov dword ptr [rbp-15632], 0
+  movsxd rsi, dword ptr [rbp-15636]
+  mov qword ptr [rbp-3064], rsi
+  lea rsi, [rip+.L.data.main.489]
+  mov qword ptr [rbp-3072], rsi
+  mov rsi, qword ptr [rbp-3056]
+  cmp rsi, qword ptr [rbp-3064]
+  jne .L.else.main.1356
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3072]
+  mov r9, qword ptr [rbp-3064]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1357
+.L.else.main.1356:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3072]
+  mov r9, qword ptr [rbp-3056]
+  mov r10, qword ptr [rbp-3064]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1357:
+  mov qword ptr [rbp-3032], 0
+  mov dword ptr [rbp-15628], 1
+  mov dword ptr [rbp-15624], 0
+  mov dword ptr [rbp-15620], 0
+  movsxd rsi, dword ptr [rbp-15620]
+  mov qword ptr [rbp-3040], rsi
+  lea rsi, [rip+.L.data.main.490]
+  mov qword ptr [rbp-3048], rsi
+  mov rsi, qword ptr [rbp-3032]
+  cmp rsi, qword ptr [rbp-3040]
+  jne .L.else.main.1358
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3048]
+  mov r9, qword ptr [rbp-3040]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1359
+.L.else.main.1358:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3048]
+  mov r9, qword ptr [rbp-3032]
+  mov r10, qword ptr [rbp-3040]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1359:
+  mov qword ptr [rbp-3008], 1
+  lea rsi, [rbp-15616]
+  add rsi, 0
+  mov dword ptr [rsi], 1
+  lea rsi, [rbp-15616]
+  add rsi, 0
+  mov dword ptr [rsi+4], 2
+  lea rsi, [rbp-15616]
+  add rsi, 8
+  mov dword ptr [rsi], 3
+  lea rsi, [rbp-15616]
+  add rsi, 8
+  mov dword ptr [rsi+4], 4
+  lea rsi, [rbp-15616]
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-3016], rsi
+  lea rsi, [rip+.L.data.main.491]
+  mov qword ptr [rbp-3024], rsi
+  mov rsi, qword ptr [rbp-3008]
+  cmp rsi, qword ptr [rbp-3016]
+  jne .L.else.main.1360
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3024]
+  mov r9, qword ptr [rbp-3016]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1361
+.L.else.main.1360:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3024]
+  mov r9, qword ptr [rbp-3008]
+  mov r10, qword ptr [rbp-3016]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1361:
+  mov qword ptr [rbp-2984], 2
+  lea rsi, [rbp-15600]
+  add rsi, 0
+  mov dword ptr [rsi], 1
+  lea rsi, [rbp-15600]
+  add rsi, 0
+  mov dword ptr [rsi+4], 2
+  lea rsi, [rbp-15600]
+  add rsi, 8
+  mov dword ptr [rsi], 3
+  lea rsi, [rbp-15600]
+  add rsi, 8
+  mov dword ptr [rsi+4], 4
+  lea rsi, [rbp-15600]
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi+4]
+  mov qword ptr [rbp-2992], rsi
+  lea rsi, [rip+.L.data.main.492]
+  mov qword ptr [rbp-3000], rsi
+  mov rsi, qword ptr [rbp-2984]
+  cmp rsi, qword ptr [rbp-2992]
+  jne .L.else.main.1362
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-3000]
+  mov r9, qword ptr [rbp-2992]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1363
+.L.else.main.1362:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-3000]
+  mov r9, qword ptr [rbp-2984]
+  mov r10, qword ptr [rbp-2992]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1363:
+  mov qword ptr [rbp-2960], 3
+  lea rsi, [rbp-15584]
+  add rsi, 0
+  mov dword ptr [rsi], 1
+  lea rsi, [rbp-15584]
+  add rsi, 0
+  mov dword ptr [rsi+4], 2
+  lea rsi, [rbp-15584]
+  add rsi, 8
+  mov dword ptr [rsi], 3
+  lea rsi, [rbp-15584]
+  add rsi, 8
+  mov dword ptr [rsi+4], 4
+  lea rsi, [rbp-15584]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-2968], rsi
+  lea rsi, [rip+.L.data.main.493]
+  mov qword ptr [rbp-2976], rsi
+  mov rsi, qword ptr [rbp-2960]
+  cmp rsi, qword ptr [rbp-2968]
+  jne .L.else.main.1364
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2976]
+  mov r9, qword ptr [rbp-2968]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1365
+.L.else.main.1364:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2976]
+  mov r9, qword ptr [rbp-2960]
+  mov r10, qword ptr [rbp-2968]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1365:
+  mov qword ptr [rbp-2936], 4
+  lea rsi, [rbp-15568]
+  add rsi, 0
+  mov dword ptr [rsi], 1
+  lea rsi, [rbp-15568]
+  add rsi, 0
+  mov dword ptr [rsi+4], 2
+  lea rsi, [rbp-15568]
+  add rsi, 8
+  mov dword ptr [rsi], 3
+  lea rsi, [rbp-15568]
+  add rsi, 8
+  mov dword ptr [rsi+4], 4
+  lea rsi, [rbp-15568]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi+4]
+  mov qword ptr [rbp-2944], rsi
+  lea rsi, [rip+.L.data.main.494]
+  mov qword ptr [rbp-2952], rsi
+  mov rsi, qword ptr [rbp-2936]
+  cmp rsi, qword ptr [rbp-2944]
+  jne .L.else.main.1366
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2952]
+  mov r9, qword ptr [rbp-2944]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1367
+.L.else.main.1366:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2952]
+  mov r9, qword ptr [rbp-2936]
+  mov r10, qword ptr [rbp-2944]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1367:
+  mov qword ptr [rbp-2912], 0
+  lea rsi, [rbp-15552]
+  add rsi, 0
+  mov dword ptr [rsi], 1
+  lea rsi, [rbp-15552]
+  add rsi, 0
+  mov dword ptr [rsi+4], 2
+  lea rsi, [rbp-15552]
+  add rsi, 8
+  mov qword ptr [rsi], 0
+  lea rsi, [rbp-15552]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi+4]
+  mov qword ptr [rbp-2920], rsi
+  lea rsi, [rip+.L.data.main.495]
+  mov qword ptr [rbp-2928], rsi
+  mov rsi, qword ptr [rbp-2912]
+  cmp rsi, qword ptr [rbp-2920]
+  jne .L.else.main.1368
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2928]
+  mov r9, qword ptr [rbp-2920]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1369
+.L.else.main.1368:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2928]
+  mov r9, qword ptr [rbp-2912]
+  mov r10, qword ptr [rbp-2920]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1369:
+  mov qword ptr [rbp-2888], 0
+  mov dword ptr [rbp-15536], 0
+  mov dword ptr [rbp-15532], 0
+  movsxd rsi, dword ptr [rbp-15536]
+  mov qword ptr [rbp-2896], rsi
+  lea rsi, [rip+.L.data.main.496]
+  mov qword ptr [rbp-2904], rsi
+  mov rsi, qword ptr [rbp-2888]
+  cmp rsi, qword ptr [rbp-2896]
+  jne .L.else.main.1370
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2904]
+  mov r9, qword ptr [rbp-2896]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1371
+.L.else.main.1370:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2904]
+  mov r9, qword ptr [rbp-2888]
+  mov r10, qword ptr [rbp-2896]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1371:
+  mov qword ptr [rbp-2864], 0
+  mov dword ptr [rbp-15528], 0
+  mov dword ptr [rbp-15524], 0
+  movsxd rsi, dword ptr [rbp-15524]
+  mov qword ptr [rbp-2872], rsi
+  lea rsi, [rip+.L.data.main.497]
+  mov qword ptr [rbp-2880], rsi
+  mov rsi, qword ptr [rbp-2864]
+  cmp rsi, qword ptr [rbp-2872]
+  jne .L.else.main.1372
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2880]
+  mov r9, qword ptr [rbp-2872]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1373
+.L.else.main.1372:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2880]
+  mov r9, qword ptr [rbp-2864]
+  mov r10, qword ptr [rbp-2872]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1373:
+  mov qword ptr [rbp-2840], 3
+  movsx rsi, byte ptr [rip+g3]
+  mov qword ptr [rbp-2848], rsi
+  lea rsi, [rip+.L.data.main.498]
+  mov qword ptr [rbp-2856], rsi
+  mov rsi, qword ptr [rbp-2840]
+  cmp rsi, qword ptr [rbp-2848]
+  jne .L.else.main.1374
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2856]
+  mov r9, qword ptr [rbp-2848]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1375
+.L.else.main.1374:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2856]
+  mov r9, qword ptr [rbp-2840]
+  mov r10, qword ptr [rbp-2848]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1375:
+  mov qword ptr [rbp-2816], 4
+  movsx rsi, word ptr [rip+g4]
+  mov qword ptr [rbp-2824], rsi
+  lea rsi, [rip+.L.data.main.499]
+  mov qword ptr [rbp-2832], rsi
+  mov rsi, qword ptr [rbp-2816]
+  cmp rsi, qword ptr [rbp-2824]
+  jne .L.else.main.1376
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2832]
+  mov r9, qword ptr [rbp-2824]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1377
+.L.else.main.1376:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2832]
+  mov r9, qword ptr [rbp-2816]
+  mov r10, qword ptr [rbp-2824]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1377:
+  mov qword ptr [rbp-2792], 5
+  movsxd rsi, dword ptr [rip+g5]
+  mov qword ptr [rbp-2800], rsi
+  lea rsi, [rip+.L.data.main.500]
+  mov qword ptr [rbp-2808], rsi
+  mov rsi, qword ptr [rbp-2792]
+  cmp rsi, qword ptr [rbp-2800]
+  jne .L.else.main.1378
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2808]
+  mov r9, qword ptr [rbp-2800]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1379
+.L.else.main.1378:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2808]
+  mov r9, qword ptr [rbp-2792]
+  mov r10, qword ptr [rbp-2800]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1379:
+  mov qword ptr [rbp-2768], 6
+  mov rsi, qword ptr [rip+g6]
+  mov qword ptr [rbp-2776], rsi
+  lea rsi, [rip+.L.data.main.501]
+  mov qword ptr [rbp-2784], rsi
+  mov rsi, qword ptr [rbp-2768]
+  cmp rsi, qword ptr [rbp-2776]
+  jne .L.else.main.1380
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2784]
+  mov r9, qword ptr [rbp-2776]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1381
+.L.else.main.1380:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2784]
+  mov r9, qword ptr [rbp-2768]
+  mov r10, qword ptr [rbp-2776]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1381:
+  mov qword ptr [rbp-2744], 5
+  mov rsi, qword ptr [rip+g7]
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-2752], rsi
+  lea rsi, [rip+.L.data.main.502]
+  mov qword ptr [rbp-2760], rsi
+  mov rsi, qword ptr [rbp-2744]
+  cmp rsi, qword ptr [rbp-2752]
+  jne .L.else.main.1382
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2760]
+  mov r9, qword ptr [rbp-2752]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1383
+.L.else.main.1382:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2760]
+  mov r9, qword ptr [rbp-2744]
+  mov r10, qword ptr [rbp-2752]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1383:
+  mov qword ptr [rbp-2720], 0
+  mov rsi, qword ptr [rip+g8]
+  lea r8, [rip+.L.data.main.503]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov qword ptr [rbp-2728], rax
+  lea rsi, [rip+.L.data.main.504]
+  mov qword ptr [rbp-2736], rsi
+  mov rsi, qword ptr [rbp-2720]
+  cmp rsi, qword ptr [rbp-2728]
+  jne .L.else.main.1384
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2736]
+  mov r9, qword ptr [rbp-2728]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1385
+.L.else.main.1384:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2736]
+  mov r9, qword ptr [rbp-2720]
+  mov r10, qword ptr [rbp-2728]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1385:
+  mov qword ptr [rbp-2696], 0
+  lea rsi, [rip+g9]
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-2704], rsi
+  lea rsi, [rip+.L.data.main.505]
+  mov qword ptr [rbp-2712], rsi
+  mov rsi, qword ptr [rbp-2696]
+  cmp rsi, qword ptr [rbp-2704]
+  jne .L.else.main.1386
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2712]
+  mov r9, qword ptr [rbp-2704]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1387
+.L.else.main.1386:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2712]
+  mov r9, qword ptr [rbp-2696]
+  mov r10, qword ptr [rbp-2704]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1387:
+  mov qword ptr [rbp-2672], 1
+  lea rsi, [rip+g9]
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-2680], rsi
+  lea rsi, [rip+.L.data.main.506]
+  mov qword ptr [rbp-2688], rsi
+  mov rsi, qword ptr [rbp-2672]
+  cmp rsi, qword ptr [rbp-2680]
+  jne .L.else.main.1388
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2688]
+  mov r9, qword ptr [rbp-2680]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1389
+.L.else.main.1388:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2688]
+  mov r9, qword ptr [rbp-2672]
+  mov r10, qword ptr [rbp-2680]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1389:
+  mov qword ptr [rbp-2648], 2
+  lea rsi, [rip+g9]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-2656], rsi
+  lea rsi, [rip+.L.data.main.507]
+  mov qword ptr [rbp-2664], rsi
+  mov rsi, qword ptr [rbp-2648]
+  cmp rsi, qword ptr [rbp-2656]
+  jne .L.else.main.1390
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2664]
+  mov r9, qword ptr [rbp-2656]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1391
+.L.else.main.1390:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2664]
+  mov r9, qword ptr [rbp-2648]
+  mov r10, qword ptr [rbp-2656]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1391:
+  mov qword ptr [rbp-2624], 0
+  lea rsi, [rip+g10]
+  add rsi, 0
+  mov rsi, qword ptr [rsi]
+  lea r8, [rip+.L.data.main.508]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov qword ptr [rbp-2632], rax
+  lea rsi, [rip+.L.data.main.509]
+  mov qword ptr [rbp-2640], rsi
+  mov rsi, qword ptr [rbp-2624]
+  cmp rsi, qword ptr [rbp-2632]
+  jne .L.else.main.1392
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2640]
+  mov r9, qword ptr [rbp-2632]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1393
+.L.else.main.1392:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2640]
+  mov r9, qword ptr [rbp-2624]
+  mov r10, qword ptr [rbp-2632]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1393:
+  mov qword ptr [rbp-2600], 0
+  lea rsi, [rip+g10]
+  add rsi, 8
+  mov rsi, qword ptr [rsi]
+  lea r8, [rip+.L.data.main.510]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov qword ptr [rbp-2608], rax
+  lea rsi, [rip+.L.data.main.511]
+  mov qword ptr [rbp-2616], rsi
+  mov rsi, qword ptr [rbp-2600]
+  cmp rsi, qword ptr [rbp-2608]
+  jne .L.else.main.1394
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2616]
+  mov r9, qword ptr [rbp-2608]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1395
+.L.else.main.1394:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2616]
+  mov r9, qword ptr [rbp-2600]
+  mov r10, qword ptr [rbp-2608]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1395:
+  mov qword ptr [rbp-2576], 0
+  lea rsi, [rip+g10]
+  add rsi, 8
+  mov rsi, qword ptr [rsi]
+  add rsi, 3
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rbp-2584], rsi
+  lea rsi, [rip+.L.data.main.512]
+  mov qword ptr [rbp-2592], rsi
+  mov rsi, qword ptr [rbp-2576]
+  cmp rsi, qword ptr [rbp-2584]
+  jne .L.else.main.1396
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2592]
+  mov r9, qword ptr [rbp-2584]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1397
+.L.else.main.1396:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2592]
+  mov r9, qword ptr [rbp-2576]
+  mov r10, qword ptr [rbp-2584]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1397:
+  mov qword ptr [rbp-2552], 2
+  mov rsi, 16
+  mov rdi, rsi
+  sar rdi, 63
+  and rdi, 7
+  add rsi, rdi
+  sar rsi, 3
+  mov qword ptr [rbp-2560], rsi
+  lea rsi, [rip+.L.data.main.513]
+  mov qword ptr [rbp-2568], rsi
+  mov rsi, qword ptr [rbp-2552]
+  cmp rsi, qword ptr [rbp-2560]
+  jne .L.else.main.1398
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2568]
+  mov r9, qword ptr [rbp-2560]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1399
+.L.else.main.1398:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2568]
+  mov r9, qword ptr [rbp-2552]
+  mov r10, qword ptr [rbp-2560]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1399:
+  mov qword ptr [rbp-2528], 1
+  lea rsi, [rip+g11]
+  add rsi, 0
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rbp-2536], rsi
+  lea rsi, [rip+.L.data.main.514]
+  mov qword ptr [rbp-2544], rsi
+  mov rsi, qword ptr [rbp-2528]
+  cmp rsi, qword ptr [rbp-2536]
+  jne .L.else.main.1400
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2544]
+  mov r9, qword ptr [rbp-2536]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1401
+.L.else.main.1400:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2544]
+  mov r9, qword ptr [rbp-2528]
+  mov r10, qword ptr [rbp-2536]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1401:
+  mov qword ptr [rbp-2504], 2
+  lea rsi, [rip+g11]
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi+4]
+  mov qword ptr [rbp-2512], rsi
+  lea rsi, [rip+.L.data.main.515]
+  mov qword ptr [rbp-2520], rsi
+  mov rsi, qword ptr [rbp-2504]
+  cmp rsi, qword ptr [rbp-2512]
+  jne .L.else.main.1402
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2520]
+  mov r9, qword ptr [rbp-2512]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1403
+.L.else.main.1402:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2520]
+  mov r9, qword ptr [rbp-2504]
+  mov r10, qword ptr [rbp-2512]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1403:
+  mov qword ptr [rbp-2480], 3
+  lea rsi, [rip+g11]
+  add rsi, 8
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rbp-2488], rsi
+  lea rsi, [rip+.L.data.main.516]
+  mov qword ptr [rbp-2496], rsi
+  mov rsi, qword ptr [rbp-2480]
+  cmp rsi, qword ptr [rbp-2488]
+  jne .L.else.main.1404
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2496]
+  mov r9, qword ptr [rbp-2488]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1405
+.L.else.main.1404:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2496]
+  mov r9, qword ptr [rbp-2480]
+  mov r10, qword ptr [rbp-2488]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1405:
+  mov qword ptr [rbp-2456], 4
+  lea rsi, [rip+g11]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi+4]
+  mov qword ptr [rbp-2464], rsi
+  lea rsi, [rip+.L.data.main.517]
+  mov qword ptr [rbp-2472], rsi
+  mov rsi, qword ptr [rbp-2456]
+  cmp rsi, qword ptr [rbp-2464]
+  jne .L.else.main.1406
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2472]
+  mov r9, qword ptr [rbp-2464]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1407
+.L.else.main.1406:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2472]
+  mov r9, qword ptr [rbp-2456]
+  mov r10, qword ptr [rbp-2464]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1407:
+  mov qword ptr [rbp-2432], 1
+  lea rsi, [rip+g12]
+  add rsi, 0
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-2440], rsi
+  lea rsi, [rip+.L.data.main.518]
+  mov qword ptr [rbp-2448], rsi
+  mov rsi, qword ptr [rbp-2432]
+  cmp rsi, qword ptr [rbp-2440]
+  jne .L.else.main.1408
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2448]
+  mov r9, qword ptr [rbp-2440]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1409
+.L.else.main.1408:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2448]
+  mov r9, qword ptr [rbp-2432]
+  mov r10, qword ptr [rbp-2440]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1409:
+  mov qword ptr [rbp-2408], 2
+  lea rsi, [rip+g12]
+  add rsi, 0
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-2416], rsi
+  lea rsi, [rip+.L.data.main.519]
+  mov qword ptr [rbp-2424], rsi
+  mov rsi, qword ptr [rbp-2408]
+  cmp rsi, qword ptr [rbp-2416]
+  jne .L.else.main.1410
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2424]
+  mov r9, qword ptr [rbp-2416]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1411
+.L.else.main.1410:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2424]
+  mov r9, qword ptr [rbp-2408]
+  mov r10, qword ptr [rbp-2416]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1411:
+  mov qword ptr [rbp-2384], 0
+  lea rsi, [rip+g12]
+  add rsi, 8
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-2392], rsi
+  lea rsi, [rip+.L.data.main.520]
+  mov qword ptr [rbp-2400], rsi
+  mov rsi, qword ptr [rbp-2384]
+  cmp rsi, qword ptr [rbp-2392]
+  jne .L.else.main.1412
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2400]
+  mov r9, qword ptr [rbp-2392]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1413
+.L.else.main.1412:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2400]
+  mov r9, qword ptr [rbp-2384]
+  mov r10, qword ptr [rbp-2392]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1413:
+  mov qword ptr [rbp-2360], 0
+  lea rsi, [rip+g12]
+  add rsi, 8
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-2368], rsi
+  lea rsi, [rip+.L.data.main.521]
+  mov qword ptr [rbp-2376], rsi
+  mov rsi, qword ptr [rbp-2360]
+  cmp rsi, qword ptr [rbp-2368]
+  jne .L.else.main.1414
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2376]
+  mov r9, qword ptr [rbp-2368]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1415
+.L.else.main.1414:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2376]
+  mov r9, qword ptr [rbp-2360]
+  mov r10, qword ptr [rbp-2368]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1415:
+  mov qword ptr [rbp-2336], 1
+  lea rsi, [rip+g13]
+  add rsi, 0
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-2344], rsi
+  lea rsi, [rip+.L.data.main.522]
+  mov qword ptr [rbp-2352], rsi
+  mov rsi, qword ptr [rbp-2336]
+  cmp rsi, qword ptr [rbp-2344]
+  jne .L.else.main.1416
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2352]
+  mov r9, qword ptr [rbp-2344]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1417
+.L.else.main.1416:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2352]
+  mov r9, qword ptr [rbp-2336]
+  mov r10, qword ptr [rbp-2344]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1417:
+  mov qword ptr [rbp-2312], 2
+  lea rsi, [rip+g13]
+  add rsi, 0
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-2320], rsi
+  lea rsi, [rip+.L.data.main.523]
+  mov qword ptr [rbp-2328], rsi
+  mov rsi, qword ptr [rbp-2312]
+  cmp rsi, qword ptr [rbp-2320]
+  jne .L.else.main.1418
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2328]
+  mov r9, qword ptr [rbp-2320]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1419
+.L.else.main.1418:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2328]
+  mov r9, qword ptr [rbp-2312]
+  mov r10, qword ptr [rbp-2320]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1419:
+  mov qword ptr [rbp-2288], 3
+  lea rsi, [rip+g13]
+  add rsi, 8
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-2296], rsi
+  lea rsi, [rip+.L.data.main.524]
+  mov qword ptr [rbp-2304], rsi
+  mov rsi, qword ptr [rbp-2288]
+  cmp rsi, qword ptr [rbp-2296]
+  jne .L.else.main.1420
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2304]
+  mov r9, qword ptr [rbp-2296]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1421
+.L.else.main.1420:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2304]
+  mov r9, qword ptr [rbp-2288]
+  mov r10, qword ptr [rbp-2296]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1421:
+  mov qword ptr [rbp-2264], 4
+  lea rsi, [rip+g13]
+  add rsi, 8
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-2272], rsi
+  lea rsi, [rip+.L.data.main.525]
+  mov qword ptr [rbp-2280], rsi
+  mov rsi, qword ptr [rbp-2264]
+  cmp rsi, qword ptr [rbp-2272]
+  jne .L.else.main.1422
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2280]
+  mov r9, qword ptr [rbp-2272]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1423
+.L.else.main.1422:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2280]
+  mov r9, qword ptr [rbp-2264]
+  mov r10, qword ptr [rbp-2272]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1423:
+  mov qword ptr [rbp-2240], 1
+  lea rsi, [rip+g14]
+  add rsi, 0
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-2248], rsi
+  lea rsi, [rip+.L.data.main.526]
+  mov qword ptr [rbp-2256], rsi
+  mov rsi, qword ptr [rbp-2240]
+  cmp rsi, qword ptr [rbp-2248]
+  jne .L.else.main.1424
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2256]
+  mov r9, qword ptr [rbp-2248]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1425
+.L.else.main.1424:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2256]
+  mov r9, qword ptr [rbp-2240]
+  mov r10, qword ptr [rbp-2248]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1425:
+  mov qword ptr [rbp-2216], 2
+  lea rsi, [rip+g14]
+  add rsi, 0
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-2224], rsi
+  lea rsi, [rip+.L.data.main.527]
+  mov qword ptr [rbp-2232], rsi
+  mov rsi, qword ptr [rbp-2216]
+  cmp rsi, qword ptr [rbp-2224]
+  jne .L.else.main.1426
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2232]
+  mov r9, qword ptr [rbp-2224]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1427
+.L.else.main.1426:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2232]
+  mov r9, qword ptr [rbp-2216]
+  mov r10, qword ptr [rbp-2224]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1427:
+  mov qword ptr [rbp-2192], 3
+  lea rsi, [rip+g14]
+  add rsi, 8
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-2200], rsi
+  lea rsi, [rip+.L.data.main.528]
+  mov qword ptr [rbp-2208], rsi
+  mov rsi, qword ptr [rbp-2192]
+  cmp rsi, qword ptr [rbp-2200]
+  jne .L.else.main.1428
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2208]
+  mov r9, qword ptr [rbp-2200]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1429
+.L.else.main.1428:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2208]
+  mov r9, qword ptr [rbp-2192]
+  mov r10, qword ptr [rbp-2200]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1429:
+  mov qword ptr [rbp-2168], 4
+  lea rsi, [rip+g14]
+  add rsi, 8
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-2176], rsi
+  lea rsi, [rip+.L.data.main.529]
+  mov qword ptr [rbp-2184], rsi
+  mov rsi, qword ptr [rbp-2168]
+  cmp rsi, qword ptr [rbp-2176]
+  jne .L.else.main.1430
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2184]
+  mov r9, qword ptr [rbp-2176]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1431
+.L.else.main.1430:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2184]
+  mov r9, qword ptr [rbp-2168]
+  mov r10, qword ptr [rbp-2176]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1431:
+  mov qword ptr [rbp-2144], 0
+  lea rsi, [rbp-15520]
+  add rsi, 0
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rbp-15520]
+  add rsi, 0
+  add rsi, 4
+  mov dword ptr [rsi], 1
+  lea rsi, [rbp-15520]
+  add rsi, 0
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  lea rsi, [rbp-15520]
+  add rsi, 12
+  add rsi, 0
+  mov dword ptr [rsi], 3
+  lea rsi, [rbp-15520]
+  add rsi, 12
+  add rsi, 4
+  mov dword ptr [rsi], 4
+  lea rsi, [rbp-15520]
+  add rsi, 12
+  add rsi, 8
+  mov dword ptr [rsi], 5
+  lea rsi, [rbp-15520]
+  add rsi, 0
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-2152], rsi
+  lea rsi, [rip+.L.data.main.530]
+  mov qword ptr [rbp-2160], rsi
+  mov rsi, qword ptr [rbp-2144]
+  cmp rsi, qword ptr [rbp-2152]
+  jne .L.else.main.1432
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2160]
+  mov r9, qword ptr [rbp-2152]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1433
+.L.else.main.1432:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2160]
+  mov r9, qword ptr [rbp-2144]
+  mov r10, qword ptr [rbp-2152]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1433:
+  mov qword ptr [rbp-2120], 3
+  lea rsi, [rbp-15496]
+  add rsi, 0
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rbp-15496]
+  add rsi, 0
+  add rsi, 4
+  mov dword ptr [rsi], 1
+  lea rsi, [rbp-15496]
+  add rsi, 0
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  lea rsi, [rbp-15496]
+  add rsi, 12
+  add rsi, 0
+  mov dword ptr [rsi], 3
+  lea rsi, [rbp-15496]
+  add rsi, 12
+  add rsi, 4
+  mov dword ptr [rsi], 4
+  lea rsi, [rbp-15496]
+  add rsi, 12
+  add rsi, 8
+  mov dword ptr [rsi], 5
+  lea rsi, [rbp-15496]
+  add rsi, 12
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-2128], rsi
+  lea rsi, [rip+.L.data.main.531]
+  mov qword ptr [rbp-2136], rsi
+  mov rsi, qword ptr [rbp-2120]
+  cmp rsi, qword ptr [rbp-2128]
+  jne .L.else.main.1434
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2136]
+  mov r9, qword ptr [rbp-2128]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1435
+.L.else.main.1434:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2136]
+  mov r9, qword ptr [rbp-2120]
+  mov r10, qword ptr [rbp-2128]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1435:
+  mov qword ptr [rbp-2096], 0
+  lea rsi, [rbp-15472]
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rbp-15472]
+  add rsi, 0
+  mov dword ptr [rsi+4], 1
+  lea rsi, [rbp-15472]
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  lea rsi, [rbp-15472]
+  add rsi, 8
+  mov dword ptr [rsi+4], 3
+  lea rsi, [rbp-15472]
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-2104], rsi
+  lea rsi, [rip+.L.data.main.532]
+  mov qword ptr [rbp-2112], rsi
+  mov rsi, qword ptr [rbp-2096]
+  cmp rsi, qword ptr [rbp-2104]
+  jne .L.else.main.1436
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2112]
+  mov r9, qword ptr [rbp-2104]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1437
+.L.else.main.1436:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2112]
+  mov r9, qword ptr [rbp-2096]
+  mov r10, qword ptr [rbp-2104]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1437:
+  mov qword ptr [rbp-2072], 2
+  lea rsi, [rbp-15456]
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rbp-15456]
+  add rsi, 0
+  mov dword ptr [rsi+4], 1
+  lea rsi, [rbp-15456]
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  lea rsi, [rbp-15456]
+  add rsi, 8
+  mov dword ptr [rsi+4], 3
+  lea rsi, [rbp-15456]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-2080], rsi
+  lea rsi, [rip+.L.data.main.533]
+  mov qword ptr [rbp-2088], rsi
+  mov rsi, qword ptr [rbp-2072]
+  cmp rsi, qword ptr [rbp-2080]
+  jne .L.else.main.1438
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2088]
+  mov r9, qword ptr [rbp-2080]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1439
+.L.else.main.1438:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2088]
+  mov r9, qword ptr [rbp-2072]
+  mov r10, qword ptr [rbp-2080]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1439:
+  mov qword ptr [rbp-2048], 0
+  mov rsi, qword ptr [rip+g15]
+  lea r8, [rip+.L.data.main.534]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov qword ptr [rbp-2056], rax
+  lea rsi, [rip+.L.data.main.535]
+  mov qword ptr [rbp-2064], rsi
+  mov rsi, qword ptr [rbp-2048]
+  cmp rsi, qword ptr [rbp-2056]
+  jne .L.else.main.1440
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2064]
+  mov r9, qword ptr [rbp-2056]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1441
+.L.else.main.1440:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2064]
+  mov r9, qword ptr [rbp-2048]
+  mov r10, qword ptr [rbp-2056]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1441:
+  mov qword ptr [rbp-2024], 0
+  lea rsi, [rip+g16]
+  add rsi, 0
+  lea r8, [rip+.L.data.main.536]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov qword ptr [rbp-2032], rax
+  lea rsi, [rip+.L.data.main.537]
+  mov qword ptr [rbp-2040], rsi
+  mov rsi, qword ptr [rbp-2024]
+  cmp rsi, qword ptr [rbp-2032]
+  jne .L.else.main.1442
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2040]
+  mov r9, qword ptr [rbp-2032]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1443
+.L.else.main.1442:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2040]
+  mov r9, qword ptr [rbp-2024]
+  mov r10, qword ptr [rbp-2032]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1443:
+  mov qword ptr [rbp-2000], 0
+  lea rsi, [rip+g16]
+  add rsi, 4
+  lea r8, [rip+.L.data.main.538]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov qword ptr [rbp-2008], rax
+  lea rsi, [rip+.L.data.main.539]
+  mov qword ptr [rbp-2016], rsi
+  mov rsi, qword ptr [rbp-2000]
+  cmp rsi, qword ptr [rbp-2008]
+  jne .L.else.main.1444
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-2016]
+  mov r9, qword ptr [rbp-2008]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1445
+.L.else.main.1444:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-2016]
+  mov r9, qword ptr [rbp-2000]
+  mov r10, qword ptr [rbp-2008]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1445:
+  mov qword ptr [rbp-1976], 7
+  mov qword ptr [rbp-1984], 7
+  lea rsi, [rip+.L.data.main.540]
+  mov qword ptr [rbp-1992], rsi
+  mov rsi, qword ptr [rbp-1976]
+  cmp rsi, qword ptr [rbp-1984]
+  jne .L.else.main.1446
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1992]
+  mov r9, qword ptr [rbp-1984]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1447
+.L.else.main.1446:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1992]
+  mov r9, qword ptr [rbp-1976]
+  mov r10, qword ptr [rbp-1984]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1447:
+  mov qword ptr [rbp-1952], 10
+  mov qword ptr [rbp-1960], 10
+  lea rsi, [rip+.L.data.main.541]
+  mov qword ptr [rbp-1968], rsi
+  mov rsi, qword ptr [rbp-1952]
+  cmp rsi, qword ptr [rbp-1960]
+  jne .L.else.main.1448
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1968]
+  mov r9, qword ptr [rbp-1960]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1449
+.L.else.main.1448:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1968]
+  mov r9, qword ptr [rbp-1952]
+  mov r10, qword ptr [rbp-1960]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1449:
+  mov qword ptr [rbp-1928], 3
+  mov qword ptr [rbp-1936], 3
+  lea rsi, [rip+.L.data.main.542]
+  mov qword ptr [rbp-1944], rsi
+  mov rsi, qword ptr [rbp-1928]
+  cmp rsi, qword ptr [rbp-1936]
+  jne .L.else.main.1450
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1944]
+  mov r9, qword ptr [rbp-1936]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1451
+.L.else.main.1450:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1944]
+  mov r9, qword ptr [rbp-1928]
+  mov r10, qword ptr [rbp-1936]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1451:
+  mov qword ptr [rbp-1904], 0
+  lea rsi, [rip+g17]
+  lea r8, [rip+.L.data.main.543]
+  mov r9, 7
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call memcmp
+  mov qword ptr [rbp-1912], rax
+  lea rsi, [rip+.L.data.main.544]
+  mov qword ptr [rbp-1920], rsi
+  mov rsi, qword ptr [rbp-1904]
+  cmp rsi, qword ptr [rbp-1912]
+  jne .L.else.main.1452
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1920]
+  mov r9, qword ptr [rbp-1912]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1453
+.L.else.main.1452:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1920]
+  mov r9, qword ptr [rbp-1904]
+  mov r10, qword ptr [rbp-1912]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1453:
+  mov qword ptr [rbp-1880], 0
+  lea rsi, [rip+g18]
+  lea r8, [rip+.L.data.main.545]
+  mov r9, 10
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call memcmp
+  mov qword ptr [rbp-1888], rax
+  lea rsi, [rip+.L.data.main.546]
+  mov qword ptr [rbp-1896], rsi
+  mov rsi, qword ptr [rbp-1880]
+  cmp rsi, qword ptr [rbp-1888]
+  jne .L.else.main.1454
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1896]
+  mov r9, qword ptr [rbp-1888]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1455
+.L.else.main.1454:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1896]
+  mov r9, qword ptr [rbp-1880]
+  mov r10, qword ptr [rbp-1888]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1455:
+  mov qword ptr [rbp-1856], 0
+  lea rsi, [rip+g19]
+  lea r8, [rip+.L.data.main.547]
+  mov r9, 3
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call memcmp
+  mov qword ptr [rbp-1864], rax
+  lea rsi, [rip+.L.data.main.548]
+  mov qword ptr [rbp-1872], rsi
+  mov rsi, qword ptr [rbp-1856]
+  cmp rsi, qword ptr [rbp-1864]
+  jne .L.else.main.1456
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1872]
+  mov r9, qword ptr [rbp-1864]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1457
+.L.else.main.1456:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1872]
+  mov r9, qword ptr [rbp-1856]
+  mov r10, qword ptr [rbp-1864]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1457:
+  mov qword ptr [rbp-1832], 0
+  mov rsi, qword ptr [rip+g20]
+  lea r8, [rip+.L.data.main.549]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov qword ptr [rbp-1840], rax
+  lea rsi, [rip+.L.data.main.550]
+  mov qword ptr [rbp-1848], rsi
+  mov rsi, qword ptr [rbp-1832]
+  cmp rsi, qword ptr [rbp-1840]
+  jne .L.else.main.1458
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1848]
+  mov r9, qword ptr [rbp-1840]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1459
+.L.else.main.1458:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1848]
+  mov r9, qword ptr [rbp-1832]
+  mov r10, qword ptr [rbp-1840]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1459:
+  mov qword ptr [rbp-1808], 0
+  mov rsi, qword ptr [rip+g21]
+  lea r8, [rip+.L.data.main.551]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov qword ptr [rbp-1816], rax
+  lea rsi, [rip+.L.data.main.552]
+  mov qword ptr [rbp-1824], rsi
+  mov rsi, qword ptr [rbp-1808]
+  cmp rsi, qword ptr [rbp-1816]
+  jne .L.else.main.1460
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1824]
+  mov r9, qword ptr [rbp-1816]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1461
+.L.else.main.1460:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1824]
+  mov r9, qword ptr [rbp-1808]
+  mov r10, qword ptr [rbp-1816]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1461:
+  mov qword ptr [rbp-1784], 0
+  mov rsi, qword ptr [rip+g22]
+  add rsi, 3
+  lea r8, [rip+.L.data.main.553]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov qword ptr [rbp-1792], rax
+  lea rsi, [rip+.L.data.main.554]
+  mov qword ptr [rbp-1800], rsi
+  mov rsi, qword ptr [rbp-1784]
+  cmp rsi, qword ptr [rbp-1792]
+  jne .L.else.main.1462
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1800]
+  mov r9, qword ptr [rbp-1792]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1463
+.L.else.main.1462:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1800]
+  mov r9, qword ptr [rbp-1784]
+  mov r10, qword ptr [rbp-1792]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1463:
+  mov qword ptr [rbp-1760], 0
+  lea rsi, [rip+g23]
+  add rsi, 0
+  mov rsi, qword ptr [rsi]
+  lea r8, [rip+.L.data.main.555]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov qword ptr [rbp-1768], rax
+  lea rsi, [rip+.L.data.main.556]
+  mov qword ptr [rbp-1776], rsi
+  mov rsi, qword ptr [rbp-1760]
+  cmp rsi, qword ptr [rbp-1768]
+  jne .L.else.main.1464
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1776]
+  mov r9, qword ptr [rbp-1768]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1465
+.L.else.main.1464:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1776]
+  mov r9, qword ptr [rbp-1760]
+  mov r10, qword ptr [rbp-1768]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1465:
+  mov qword ptr [rbp-1736], 0
+  lea rsi, [rip+g23]
+  add rsi, 8
+  mov rsi, qword ptr [rsi]
+  lea r8, [rip+.L.data.main.557]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov qword ptr [rbp-1744], rax
+  lea rsi, [rip+.L.data.main.558]
+  mov qword ptr [rbp-1752], rsi
+  mov rsi, qword ptr [rbp-1736]
+  cmp rsi, qword ptr [rbp-1744]
+  jne .L.else.main.1466
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1752]
+  mov r9, qword ptr [rbp-1744]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1467
+.L.else.main.1466:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1752]
+  mov r9, qword ptr [rbp-1736]
+  mov r10, qword ptr [rbp-1744]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1467:
+  mov qword ptr [rbp-1712], 0
+  lea rsi, [rip+g23]
+  add rsi, 16
+  mov rsi, qword ptr [rsi]
+  add rsi, 3
+  lea r8, [rip+.L.data.main.559]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov qword ptr [rbp-1720], rax
+  lea rsi, [rip+.L.data.main.560]
+  mov qword ptr [rbp-1728], rsi
+  mov rsi, qword ptr [rbp-1712]
+  cmp rsi, qword ptr [rbp-1720]
+  jne .L.else.main.1468
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1728]
+  mov r9, qword ptr [rbp-1720]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1469
+.L.else.main.1468:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1728]
+  mov r9, qword ptr [rbp-1712]
+  mov r10, qword ptr [rbp-1720]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1469:
+  mov qword ptr [rbp-1688], 3
+  movsxd rsi, dword ptr [rip+g24]
+  mov qword ptr [rbp-1696], rsi
+  lea rsi, [rip+.L.data.main.561]
+  mov qword ptr [rbp-1704], rsi
+  mov rsi, qword ptr [rbp-1688]
+  cmp rsi, qword ptr [rbp-1696]
+  jne .L.else.main.1470
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1704]
+  mov r9, qword ptr [rbp-1696]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1471
+.L.else.main.1470:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1704]
+  mov r9, qword ptr [rbp-1688]
+  mov r10, qword ptr [rbp-1696]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1471:
+  mov qword ptr [rbp-1664], 3
+  mov rsi, qword ptr [rip+g25]
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-1672], rsi
+  lea rsi, [rip+.L.data.main.562]
+  mov qword ptr [rbp-1680], rsi
+  mov rsi, qword ptr [rbp-1664]
+  cmp rsi, qword ptr [rbp-1672]
+  jne .L.else.main.1472
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1680]
+  mov r9, qword ptr [rbp-1672]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1473
+.L.else.main.1472:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1680]
+  mov r9, qword ptr [rbp-1664]
+  mov r10, qword ptr [rbp-1672]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1473:
+  mov qword ptr [rbp-1640], 2
+  mov rsi, qword ptr [rip+g27]
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-1648], rsi
+  lea rsi, [rip+.L.data.main.563]
+  mov qword ptr [rbp-1656], rsi
+  mov rsi, qword ptr [rbp-1640]
+  cmp rsi, qword ptr [rbp-1648]
+  jne .L.else.main.1474
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1656]
+  mov r9, qword ptr [rbp-1648]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1475
+.L.else.main.1474:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1656]
+  mov r9, qword ptr [rbp-1640]
+  mov r10, qword ptr [rbp-1648]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1475:
+  mov dword ptr [rip+ext1], 5
+  mov qword ptr [rbp-1616], 5
+  movsxd rsi, dword ptr [rip+ext1]
+  mov qword ptr [rbp-1624], rsi
+  lea rsi, [rip+.L.data.main.564]
+  mov qword ptr [rbp-1632], rsi
+  mov rsi, qword ptr [rbp-1616]
+  cmp rsi, qword ptr [rbp-1624]
+  jne .L.else.main.1476
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1632]
+  mov r9, qword ptr [rbp-1624]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1477
+.L.else.main.1476:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1632]
+  mov r9, qword ptr [rbp-1616]
+  mov r10, qword ptr [rbp-1624]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1477:
+  lea rsi, [rip+ext1]
+  mov qword ptr [rip+ext2], rsi
+  mov qword ptr [rbp-1592], 5
+  mov rsi, qword ptr [rip+ext2]
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-1600], rsi
+  lea rsi, [rip+.L.data.main.565]
+  mov qword ptr [rbp-1608], rsi
+  mov rsi, qword ptr [rbp-1592]
+  cmp rsi, qword ptr [rbp-1600]
+  jne .L.else.main.1478
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1608]
+  mov r9, qword ptr [rbp-1600]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1479
+.L.else.main.1478:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1608]
+  mov r9, qword ptr [rbp-1592]
+  mov r10, qword ptr [rbp-1600]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1479:
+  mov qword ptr [rbp-1568], 1
+  mov qword ptr [rbp-1576], 1
+  lea rsi, [rip+.L.data.main.566]
+  mov qword ptr [rbp-1584], rsi
+  mov rsi, qword ptr [rbp-1568]
+  cmp rsi, qword ptr [rbp-1576]
+  jne .L.else.main.1480
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1584]
+  mov r9, qword ptr [rbp-1576]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1481
+.L.else.main.1480:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1584]
+  mov r9, qword ptr [rbp-1568]
+  mov r10, qword ptr [rbp-1576]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1481:
+  mov qword ptr [rbp-1544], 2
+  mov qword ptr [rbp-1552], 2
+  lea rsi, [rip+.L.data.main.567]
+  mov qword ptr [rbp-1560], rsi
+  mov rsi, qword ptr [rbp-1544]
+  cmp rsi, qword ptr [rbp-1552]
+  jne .L.else.main.1482
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1560]
+  mov r9, qword ptr [rbp-1552]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1483
+.L.else.main.1482:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1560]
+  mov r9, qword ptr [rbp-1544]
+  mov r10, qword ptr [rbp-1552]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1483:
+  mov qword ptr [rbp-1520], 4
+  mov qword ptr [rbp-1528], 4
+  lea rsi, [rip+.L.data.main.568]
+  mov qword ptr [rbp-1536], rsi
+  mov rsi, qword ptr [rbp-1520]
+  cmp rsi, qword ptr [rbp-1528]
+  jne .L.else.main.1484
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1536]
+  mov r9, qword ptr [rbp-1528]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1485
+.L.else.main.1484:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1536]
+  mov r9, qword ptr [rbp-1520]
+  mov r10, qword ptr [rbp-1528]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1485:
+  mov qword ptr [rbp-1496], 8
+  mov qword ptr [rbp-1504], 8
+  lea rsi, [rip+.L.data.main.569]
+  mov qword ptr [rbp-1512], rsi
+  mov rsi, qword ptr [rbp-1496]
+  cmp rsi, qword ptr [rbp-1504]
+  jne .L.else.main.1486
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1512]
+  mov r9, qword ptr [rbp-1504]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1487
+.L.else.main.1486:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1512]
+  mov r9, qword ptr [rbp-1496]
+  mov r10, qword ptr [rbp-1504]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1487:
+  mov qword ptr [rbp-1472], 8
+  mov qword ptr [rbp-1480], 8
+  lea rsi, [rip+.L.data.main.570]
+  mov qword ptr [rbp-1488], rsi
+  mov rsi, qword ptr [rbp-1472]
+  cmp rsi, qword ptr [rbp-1480]
+  jne .L.else.main.1488
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1488]
+  mov r9, qword ptr [rbp-1480]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1489
+.L.else.main.1488:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1488]
+  mov r9, qword ptr [rbp-1472]
+  mov r10, qword ptr [rbp-1480]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1489:
+  mov qword ptr [rbp-1448], 1
+  mov qword ptr [rbp-1456], 1
+  lea rsi, [rip+.L.data.main.571]
+  mov qword ptr [rbp-1464], rsi
+  mov rsi, qword ptr [rbp-1448]
+  cmp rsi, qword ptr [rbp-1456]
+  jne .L.else.main.1490
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1464]
+  mov r9, qword ptr [rbp-1456]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1491
+.L.else.main.1490:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1464]
+  mov r9, qword ptr [rbp-1448]
+  mov r10, qword ptr [rbp-1456]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1491:
+  mov qword ptr [rbp-1424], 4
+  mov qword ptr [rbp-1432], 4
+  lea rsi, [rip+.L.data.main.572]
+  mov qword ptr [rbp-1440], rsi
+  mov rsi, qword ptr [rbp-1424]
+  cmp rsi, qword ptr [rbp-1432]
+  jne .L.else.main.1492
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1440]
+  mov r9, qword ptr [rbp-1432]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1493
+.L.else.main.1492:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1440]
+  mov r9, qword ptr [rbp-1424]
+  mov r10, qword ptr [rbp-1432]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1493:
+  mov qword ptr [rbp-1400], 1
+  mov qword ptr [rbp-1408], 1
+  lea rsi, [rip+.L.data.main.573]
+  mov qword ptr [rbp-1416], rsi
+  mov rsi, qword ptr [rbp-1400]
+  cmp rsi, qword ptr [rbp-1408]
+  jne .L.else.main.1494
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1416]
+  mov r9, qword ptr [rbp-1408]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1495
+.L.else.main.1494:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1416]
+  mov r9, qword ptr [rbp-1400]
+  mov r10, qword ptr [rbp-1408]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1495:
+  mov qword ptr [rbp-1376], 8
+  mov qword ptr [rbp-1384], 8
+  lea rsi, [rip+.L.data.main.574]
+  mov qword ptr [rbp-1392], rsi
+  mov rsi, qword ptr [rbp-1376]
+  cmp rsi, qword ptr [rbp-1384]
+  jne .L.else.main.1496
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1392]
+  mov r9, qword ptr [rbp-1384]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1497
+.L.else.main.1496:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1392]
+  mov r9, qword ptr [rbp-1376]
+  mov r10, qword ptr [rbp-1384]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1497:
+  mov qword ptr [rbp-1352], 2
+  movsxd rsi, dword ptr [rip+.L.data.counter.0]
+  add rsi, 1
+  mov dword ptr [rip+.L.data.counter.0], esi
+  sub rsi, 1
+  movsxd rdi, dword ptr [rip+.L.data.counter.1]
+  add rdi, 1
+  mov dword ptr [rip+.L.data.counter.1], edi
+  sub rdi, 1
+  add rsi, rdi
+  movsxd rsi, esi
+  mov qword ptr [rbp-1360], rsi
+  lea rsi, [rip+.L.data.main.575]
+  mov qword ptr [rbp-1368], rsi
+  mov rsi, qword ptr [rbp-1352]
+  cmp rsi, qword ptr [rbp-1360]
+  jne .L.else.main.1498
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1368]
+  mov r9, qword ptr [rbp-1360]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1499
+.L.else.main.1498:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1368]
+  mov r9, qword ptr [rbp-1352]
+  mov r10, qword ptr [rbp-1360]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1499:
+  mov qword ptr [rbp-1328], 4
+  movsxd rsi, dword ptr [rip+.L.data.counter.0]
+  add rsi, 1
+  mov dword ptr [rip+.L.data.counter.0], esi
+  sub rsi, 1
+  movsxd rdi, dword ptr [rip+.L.data.counter.1]
+  add rdi, 1
+  mov dword ptr [rip+.L.data.counter.1], edi
+  sub rdi, 1
+  add rsi, rdi
+  movsxd rsi, esi
+  mov qword ptr [rbp-1336], rsi
+  lea rsi, [rip+.L.data.main.576]
+  mov qword ptr [rbp-1344], rsi
+  mov rsi, qword ptr [rbp-1328]
+  cmp rsi, qword ptr [rbp-1336]
+  jne .L.else.main.1500
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1344]
+  mov r9, qword ptr [rbp-1336]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1501
+.L.else.main.1500:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1344]
+  mov r9, qword ptr [rbp-1328]
+  mov r10, qword ptr [rbp-1336]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1501:
+  mov qword ptr [rbp-1304], 6
+  movsxd rsi, dword ptr [rip+.L.data.counter.0]
+  add rsi, 1
+  mov dword ptr [rip+.L.data.counter.0], esi
+  sub rsi, 1
+  movsxd rdi, dword ptr [rip+.L.data.counter.1]
+  add rdi, 1
+  mov dword ptr [rip+.L.data.counter.1], edi
+  sub rdi, 1
+  add rsi, rdi
+  movsxd rsi, esi
+  mov qword ptr [rbp-1312], rsi
+  lea rsi, [rip+.L.data.main.577]
+  mov qword ptr [rbp-1320], rsi
+  mov rsi, qword ptr [rbp-1304]
+  cmp rsi, qword ptr [rbp-1312]
+  jne .L.else.main.1502
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1320]
+  mov r9, qword ptr [rbp-1312]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1503
+.L.else.main.1502:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1320]
+  mov r9, qword ptr [rbp-1304]
+  mov r10, qword ptr [rbp-1312]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1503:
+  mov qword ptr [rbp-1280], 1
+  mov dword ptr [rbp-15440], 1
+  movsxd rsi, dword ptr [rbp-15440]
+  mov qword ptr [rbp-1288], rsi
+  lea rsi, [rip+.L.data.main.579]
+  mov qword ptr [rbp-1296], rsi
+  mov rsi, qword ptr [rbp-1280]
+  cmp rsi, qword ptr [rbp-1288]
+  jne .L.else.main.1504
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1296]
+  mov r9, qword ptr [rbp-1288]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1505
+.L.else.main.1504:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1296]
+  mov r9, qword ptr [rbp-1280]
+  mov r10, qword ptr [rbp-1288]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1505:
+  mov qword ptr [rbp-1256], 2
+  lea rsi, [rbp-15436]
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rbp-15436]
+  add rsi, 4
+  mov dword ptr [rsi], 1
+  lea rsi, [rbp-15436]
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  lea rsi, [rbp-15436]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-1264], rsi
+  lea rsi, [rip+.L.data.main.581]
+  mov qword ptr [rbp-1272], rsi
+  mov rsi, qword ptr [rbp-1256]
+  cmp rsi, qword ptr [rbp-1264]
+  jne .L.else.main.1506
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1272]
+  mov r9, qword ptr [rbp-1264]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1507
+.L.else.main.1506:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1272]
+  mov r9, qword ptr [rbp-1256]
+  mov r10, qword ptr [rbp-1264]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1507:
+  mov qword ptr [rbp-1232], 97
+  mov byte ptr [rbp-15424], 97
+  mov dword ptr [rbp-15420], 3
+  movsx rsi, byte ptr [rbp-15424]
+  mov qword ptr [rbp-1240], rsi
+  lea rsi, [rip+.L.data.main.583]
+  mov qword ptr [rbp-1248], rsi
+  mov rsi, qword ptr [rbp-1232]
+  cmp rsi, qword ptr [rbp-1240]
+  jne .L.else.main.1508
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1248]
+  mov r9, qword ptr [rbp-1240]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1509
+.L.else.main.1508:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1248]
+  mov r9, qword ptr [rbp-1232]
+  mov r10, qword ptr [rbp-1240]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1509:
+  mov qword ptr [rbp-1208], 3
+  mov dword ptr [rbp-15416], 3
+  movsxd rsi, dword ptr [rbp-15416]
+  mov dword ptr [rbp-15412], esi
+  movsxd rsi, dword ptr [rbp-15412]
+  mov qword ptr [rbp-1216], rsi
+  lea rsi, [rip+.L.data.main.585]
+  mov qword ptr [rbp-1224], rsi
+  mov rsi, qword ptr [rbp-1208]
+  cmp rsi, qword ptr [rbp-1216]
+  jne .L.else.main.1510
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1224]
+  mov r9, qword ptr [rbp-1216]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1511
+.L.else.main.1510:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1224]
+  mov r9, qword ptr [rbp-1208]
+  mov r10, qword ptr [rbp-1216]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1511:
+  mov qword ptr [rbp-1184], 1
+  mov rsi, qword ptr [rip+tree]
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-1192], rsi
+  lea rsi, [rip+.L.data.main.586]
+  mov qword ptr [rbp-1200], rsi
+  mov rsi, qword ptr [rbp-1184]
+  cmp rsi, qword ptr [rbp-1192]
+  jne .L.else.main.1512
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1200]
+  mov r9, qword ptr [rbp-1192]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1513
+.L.else.main.1512:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1200]
+  mov r9, qword ptr [rbp-1184]
+  mov r10, qword ptr [rbp-1192]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1513:
+  mov qword ptr [rbp-1160], 2
+  mov rsi, qword ptr [rip+tree]
+  mov rsi, qword ptr [rsi+8]
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-1168], rsi
+  lea rsi, [rip+.L.data.main.587]
+  mov qword ptr [rbp-1176], rsi
+  mov rsi, qword ptr [rbp-1160]
+  cmp rsi, qword ptr [rbp-1168]
+  jne .L.else.main.1514
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1176]
+  mov r9, qword ptr [rbp-1168]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1515
+.L.else.main.1514:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1176]
+  mov r9, qword ptr [rbp-1160]
+  mov r10, qword ptr [rbp-1168]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1515:
+  mov qword ptr [rbp-1136], 3
+  mov rsi, qword ptr [rip+tree]
+  mov rsi, qword ptr [rsi+8]
+  mov rsi, qword ptr [rsi+8]
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-1144], rsi
+  lea rsi, [rip+.L.data.main.588]
+  mov qword ptr [rbp-1152], rsi
+  mov rsi, qword ptr [rbp-1136]
+  cmp rsi, qword ptr [rbp-1144]
+  jne .L.else.main.1516
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1152]
+  mov r9, qword ptr [rbp-1144]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1517
+.L.else.main.1516:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1152]
+  mov r9, qword ptr [rbp-1136]
+  mov r10, qword ptr [rbp-1144]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1517:
+  mov qword ptr [rbp-1112], 4
+  mov rsi, qword ptr [rip+tree]
+  mov rsi, qword ptr [rsi+8]
+  mov rsi, qword ptr [rsi+16]
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rbp-1120], rsi
+  lea rsi, [rip+.L.data.main.589]
+  mov qword ptr [rbp-1128], rsi
+  mov rsi, qword ptr [rbp-1112]
+  cmp rsi, qword ptr [rbp-1120]
+  jne .L.else.main.1518
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1128]
+  mov r9, qword ptr [rbp-1120]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1519
+.L.else.main.1518:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1128]
+  mov r9, qword ptr [rbp-1112]
+  mov r10, qword ptr [rbp-1120]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1519:
+  mov qword ptr [rbp-1088], 3
+  movsxd rsi, dword ptr [rip+ext3]
+  mov qword ptr [rbp-1096], rsi
+  lea rsi, [rip+.L.data.main.590]
+  mov qword ptr [rbp-1104], rsi
+  mov rsi, qword ptr [rbp-1088]
+  cmp rsi, qword ptr [rbp-1096]
+  jne .L.else.main.1520
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1104]
+  mov r9, qword ptr [rbp-1096]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1521
+.L.else.main.1520:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1104]
+  mov r9, qword ptr [rbp-1088]
+  mov r10, qword ptr [rbp-1096]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1521:
+  mov qword ptr [rbp-1064], 2
+  mov dword ptr [rbp-15408], 6
+  and dword ptr [rbp-15408], 3
+  movsxd rsi, dword ptr [rbp-15408]
+  mov qword ptr [rbp-1072], rsi
+  lea rsi, [rip+.L.data.main.591]
+  mov qword ptr [rbp-1080], rsi
+  mov rsi, qword ptr [rbp-1064]
+  cmp rsi, qword ptr [rbp-1072]
+  jne .L.else.main.1522
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1080]
+  mov r9, qword ptr [rbp-1072]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1523
+.L.else.main.1522:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1080]
+  mov r9, qword ptr [rbp-1064]
+  mov r10, qword ptr [rbp-1072]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1523:
+  mov qword ptr [rbp-1040], 7
+  mov dword ptr [rbp-15404], 6
+  or dword ptr [rbp-15404], 3
+  movsxd rsi, dword ptr [rbp-15404]
+  mov qword ptr [rbp-1048], rsi
+  lea rsi, [rip+.L.data.main.592]
+  mov qword ptr [rbp-1056], rsi
+  mov rsi, qword ptr [rbp-1040]
+  cmp rsi, qword ptr [rbp-1048]
+  jne .L.else.main.1524
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1056]
+  mov r9, qword ptr [rbp-1048]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1525
+.L.else.main.1524:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1056]
+  mov r9, qword ptr [rbp-1040]
+  mov r10, qword ptr [rbp-1048]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1525:
+  mov qword ptr [rbp-1016], 10
+  mov dword ptr [rbp-15400], 15
+  xor dword ptr [rbp-15400], 5
+  movsxd rsi, dword ptr [rbp-15400]
+  mov qword ptr [rbp-1024], rsi
+  lea rsi, [rip+.L.data.main.593]
+  mov qword ptr [rbp-1032], rsi
+  mov rsi, qword ptr [rbp-1016]
+  cmp rsi, qword ptr [rbp-1024]
+  jne .L.else.main.1526
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1032]
+  mov r9, qword ptr [rbp-1024]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1527
+.L.else.main.1526:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1032]
+  mov r9, qword ptr [rbp-1016]
+  mov r10, qword ptr [rbp-1024]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1527:
+  mov qword ptr [rbp-992], 7
+  mov dword ptr [rbp-15396], 0
+  mov dword ptr [rbp-15392], 0
+  .p2align 4,,10
+.L.begin.main.1528:
+  add dword ptr [rbp-15392], 1
+  movsxd rsi, dword ptr [rbp-15396]
+  add rsi, 1
+  mov dword ptr [rbp-15396], esi
+  sub rsi, 1
+  cmp rsi, 6
+  jl .L.begin.main.1528
+  movsxd rsi, dword ptr [rbp-15392]
+  mov qword ptr [rbp-1000], rsi
+  lea rsi, [rip+.L.data.main.594]
+  mov qword ptr [rbp-1008], rsi
+  mov rsi, qword ptr [rbp-992]
+  cmp rsi, qword ptr [rbp-1000]
+  jne .L.else.main.1531
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-1008]
+  mov r9, qword ptr [rbp-1000]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1532
+.L.else.main.1531:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-1008]
+  mov r9, qword ptr [rbp-992]
+  mov r10, qword ptr [rbp-1000]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1532:
+  mov qword ptr [rbp-968], 4
+  mov dword ptr [rbp-15388], 0
+  mov dword ptr [rbp-15384], 0
+  mov dword ptr [rbp-15380], 0
+  .p2align 4,,10
+.L.begin.main.1533:
+  movsxd rsi, dword ptr [rbp-15384]
+  add rsi, 1
+  mov dword ptr [rbp-15384], esi
+  cmp rsi, 3
+  jle .L.begin.main.1533
+  movsxd rsi, dword ptr [rbp-15384]
+  mov qword ptr [rbp-976], rsi
+  lea rsi, [rip+.L.data.main.595]
+  mov qword ptr [rbp-984], rsi
+  mov rsi, qword ptr [rbp-968]
+  cmp rsi, qword ptr [rbp-976]
+  jne .L.else.main.1537
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-984]
+  mov r9, qword ptr [rbp-976]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1538
+.L.else.main.1537:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-984]
+  mov r9, qword ptr [rbp-968]
+  mov r10, qword ptr [rbp-976]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1538:
+  mov qword ptr [rbp-944], 1
+  mov rax, 0
+  call true_fn
+  movzx rsi, al
+  mov qword ptr [rbp-952], rsi
+  lea rsi, [rip+.L.data.main.596]
+  mov qword ptr [rbp-960], rsi
+  mov rsi, qword ptr [rbp-944]
+  cmp rsi, qword ptr [rbp-952]
+  jne .L.else.main.1539
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-960]
+  mov r9, qword ptr [rbp-952]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1540
+.L.else.main.1539:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-960]
+  mov r9, qword ptr [rbp-944]
+  mov r10, qword ptr [rbp-952]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1540:
+  mov qword ptr [rbp-920], 0
+  mov rax, 0
+  call false_fn
+  movzx rsi, al
+  mov qword ptr [rbp-928], rsi
+  lea rsi, [rip+.L.data.main.597]
+  mov qword ptr [rbp-936], rsi
+  mov rsi, qword ptr [rbp-920]
+  cmp rsi, qword ptr [rbp-928]
+  jne .L.else.main.1541
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-936]
+  mov r9, qword ptr [rbp-928]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1542
+.L.else.main.1541:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-936]
+  mov r9, qword ptr [rbp-920]
+  mov r10, qword ptr [rbp-928]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1542:
+  mov qword ptr [rbp-896], 6
+  mov rsi, 1
+  mov r8, 2
+  mov r9, 3
+  mov r10, 0
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call add_all1
+  mov qword ptr [rbp-904], rax
+  lea rsi, [rip+.L.data.main.598]
+  mov qword ptr [rbp-912], rsi
+  mov rsi, qword ptr [rbp-896]
+  cmp rsi, qword ptr [rbp-904]
+  jne .L.else.main.1543
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-912]
+  mov r9, qword ptr [rbp-904]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1544
+.L.else.main.1543:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-912]
+  mov r9, qword ptr [rbp-896]
+  mov r10, qword ptr [rbp-904]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1544:
+  mov qword ptr [rbp-872], 5
+  mov rsi, 1
+  mov r8, 2
+  mov r9, 3
+  mov r10, 0
+  sub r10, 1
+  mov r11, 0
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov r8, r11
+  mov rax, 0
+  call add_all1
+  mov qword ptr [rbp-880], rax
+  lea rsi, [rip+.L.data.main.599]
+  mov qword ptr [rbp-888], rsi
+  mov rsi, qword ptr [rbp-872]
+  cmp rsi, qword ptr [rbp-880]
+  jne .L.else.main.1545
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-888]
+  mov r9, qword ptr [rbp-880]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1546
+.L.else.main.1545:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-888]
+  mov r9, qword ptr [rbp-872]
+  mov r10, qword ptr [rbp-880]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1546:
+  mov qword ptr [rbp-848], 0
+  mov rax, 0
+  call stack_misalignment
+  mov qword ptr [rbp-856], rax
+  lea rsi, [rip+.L.data.main.600]
+  mov qword ptr [rbp-864], rsi
+  mov rsi, qword ptr [rbp-848]
+  cmp rsi, qword ptr [rbp-856]
+  jne .L.else.main.1547
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-864]
+  mov r9, qword ptr [rbp-856]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1548
+.L.else.main.1547:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-864]
+  mov r9, qword ptr [rbp-848]
+  mov r10, qword ptr [rbp-856]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1548:
+  mov qword ptr [rbp-824], 0
+  lea rsi, [rbp-15373]
+  add rsi, 0
+  mov byte ptr [rsi], 0
+  mov rax, 0
+  call stack_misalignment
+  mov qword ptr [rbp-832], rax
+  lea rsi, [rip+.L.data.main.601]
+  mov qword ptr [rbp-840], rsi
+  mov rsi, qword ptr [rbp-824]
+  cmp rsi, qword ptr [rbp-832]
+  jne .L.else.main.1549
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-840]
+  mov r9, qword ptr [rbp-832]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1550
+.L.else.main.1549:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-840]
+  mov r9, qword ptr [rbp-824]
+  mov r10, qword ptr [rbp-832]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1550:
+  mov qword ptr [rbp-800], 0
+  mov rax, 0
+  call stack_misalignment
+  mov qword ptr [rbp-19352], rax
+  mov rax, 0
+  call stack_misalignment
+  mov rsi, rax
+  mov r8, 0
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call add_all1
+  mov rsi, rax
+  mov r8, 0
+  mov rdi, qword ptr [rbp-19352]
+  mov rdx, r8
+  mov rax, 0
+  call add_all1
+  mov qword ptr [rbp-808], rax
+  lea rsi, [rip+.L.data.main.602]
+  mov qword ptr [rbp-816], rsi
+  mov rsi, qword ptr [rbp-800]
+  cmp rsi, qword ptr [rbp-808]
+  jne .L.else.main.1551
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-816]
+  mov r9, qword ptr [rbp-808]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1552
+.L.else.main.1551:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-816]
+  mov r9, qword ptr [rbp-800]
+  mov r10, qword ptr [rbp-808]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1552:
+  mov qword ptr [rbp-776], 6
+  mov rsi, 1
+  mov r8, 2
+  mov r9, 3
+  mov r10, 0
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call add_all3
+  mov qword ptr [rbp-784], rax
+  lea rsi, [rip+.L.data.main.603]
+  mov qword ptr [rbp-792], rsi
+  mov rsi, qword ptr [rbp-776]
+  cmp rsi, qword ptr [rbp-784]
+  jne .L.else.main.1553
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-792]
+  mov r9, qword ptr [rbp-784]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1554
+.L.else.main.1553:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-792]
+  mov r9, qword ptr [rbp-776]
+  mov r10, qword ptr [rbp-784]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1554:
+  mov qword ptr [rbp-752], 5
+  mov rsi, 1
+  mov r8, 2
+  mov r9, 3
+  mov r10, 0
+  sub r10, 1
+  mov r11, 0
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov r8, r11
+  mov rax, 0
+  call add_all3
+  mov qword ptr [rbp-760], rax
+  lea rsi, [rip+.L.data.main.604]
+  mov qword ptr [rbp-768], rsi
+  mov rsi, qword ptr [rbp-752]
+  cmp rsi, qword ptr [rbp-760]
+  jne .L.else.main.1555
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-768]
+  mov r9, qword ptr [rbp-760]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1556
+.L.else.main.1555:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-768]
+  mov r9, qword ptr [rbp-752]
+  mov r10, qword ptr [rbp-760]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1556:
+  mov qword ptr [rbp-728], 0
+  lea rsi, [rbp-15368]
+  lea r8, [rip+.L.data.main.605]
+  mov r9, 1
+  mov r10, 2
+  lea r11, [rip+.L.data.main.606]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov r8, r11
+  mov rax, 0
+  call fmt
+  lea rsi, [rip+.L.data.main.607]
+  lea r8, [rbp-15368]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov qword ptr [rbp-736], rax
+  lea rsi, [rip+.L.data.main.608]
+  mov qword ptr [rbp-744], rsi
+  mov rsi, qword ptr [rbp-728]
+  cmp rsi, qword ptr [rbp-736]
+  jne .L.else.main.1557
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-744]
+  mov r9, qword ptr [rbp-736]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1558
+.L.else.main.1557:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-744]
+  mov r9, qword ptr [rbp-728]
+  mov r10, qword ptr [rbp-736]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1558:
+  mov qword ptr [rbp-704], 0
+  lea rsi, [rbp-15268]
+  lea r8, [rip+.L.data.main.609]
+  mov r9, 1
+  mov r10, 2
+  mov r11, 3
+  mov qword ptr [rbp-19360], 4
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov r8, r11
+  mov r9, qword ptr [rbp-19360]
+  mov rax, 0
+  call fmt
+  lea rsi, [rip+.L.data.main.610]
+  lea r8, [rbp-15268]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov qword ptr [rbp-712], rax
+  lea rsi, [rip+.L.data.main.611]
+  mov qword ptr [rbp-720], rsi
+  mov rsi, qword ptr [rbp-704]
+  cmp rsi, qword ptr [rbp-712]
+  jne .L.else.main.1559
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-720]
+  mov r9, qword ptr [rbp-712]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1560
+.L.else.main.1559:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-720]
+  mov r9, qword ptr [rbp-704]
+  mov r10, qword ptr [rbp-712]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1560:
+  mov qword ptr [rbp-680], 1
+  mov qword ptr [rbp-688], 1
+  lea rsi, [rip+.L.data.main.612]
+  mov qword ptr [rbp-696], rsi
+  mov rsi, qword ptr [rbp-680]
+  cmp rsi, qword ptr [rbp-688]
+  jne .L.else.main.1561
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-696]
+  mov r9, qword ptr [rbp-688]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1562
+.L.else.main.1561:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-696]
+  mov r9, qword ptr [rbp-680]
+  mov r10, qword ptr [rbp-688]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1562:
+  mov qword ptr [rbp-656], 1
+  mov qword ptr [rbp-664], 1
+  lea rsi, [rip+.L.data.main.613]
+  mov qword ptr [rbp-672], rsi
+  mov rsi, qword ptr [rbp-656]
+  cmp rsi, qword ptr [rbp-664]
+  jne .L.else.main.1563
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-672]
+  mov r9, qword ptr [rbp-664]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1564
+.L.else.main.1563:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-672]
+  mov r9, qword ptr [rbp-656]
+  mov r10, qword ptr [rbp-664]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1564:
+  mov qword ptr [rbp-632], 1
+  mov qword ptr [rbp-640], 1
+  lea rsi, [rip+.L.data.main.614]
+  mov qword ptr [rbp-648], rsi
+  mov rsi, qword ptr [rbp-632]
+  cmp rsi, qword ptr [rbp-640]
+  jne .L.else.main.1565
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-648]
+  mov r9, qword ptr [rbp-640]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1566
+.L.else.main.1565:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-648]
+  mov r9, qword ptr [rbp-632]
+  mov r10, qword ptr [rbp-640]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1566:
+  mov qword ptr [rbp-608], 2
+  mov qword ptr [rbp-616], 2
+  lea rsi, [rip+.L.data.main.615]
+  mov qword ptr [rbp-624], rsi
+  mov rsi, qword ptr [rbp-608]
+  cmp rsi, qword ptr [rbp-616]
+  jne .L.else.main.1567
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-624]
+  mov r9, qword ptr [rbp-616]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1568
+.L.else.main.1567:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-624]
+  mov r9, qword ptr [rbp-608]
+  mov r10, qword ptr [rbp-616]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1568:
+  mov qword ptr [rbp-584], 2
+  mov qword ptr [rbp-592], 2
+  lea rsi, [rip+.L.data.main.616]
+  mov qword ptr [rbp-600], rsi
+  mov rsi, qword ptr [rbp-584]
+  cmp rsi, qword ptr [rbp-592]
+  jne .L.else.main.1569
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-600]
+  mov r9, qword ptr [rbp-592]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1570
+.L.else.main.1569:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-600]
+  mov r9, qword ptr [rbp-584]
+  mov r10, qword ptr [rbp-592]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1570:
+  mov qword ptr [rbp-560], 2
+  mov qword ptr [rbp-568], 2
+  lea rsi, [rip+.L.data.main.617]
+  mov qword ptr [rbp-576], rsi
+  mov rsi, qword ptr [rbp-560]
+  cmp rsi, qword ptr [rbp-568]
+  jne .L.else.main.1571
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-576]
+  mov r9, qword ptr [rbp-568]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1572
+.L.else.main.1571:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-576]
+  mov r9, qword ptr [rbp-560]
+  mov r10, qword ptr [rbp-568]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1572:
+  mov qword ptr [rbp-536], 2
+  mov qword ptr [rbp-544], 2
+  lea rsi, [rip+.L.data.main.618]
+  mov qword ptr [rbp-552], rsi
+  mov rsi, qword ptr [rbp-536]
+  cmp rsi, qword ptr [rbp-544]
+  jne .L.else.main.1573
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-552]
+  mov r9, qword ptr [rbp-544]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1574
+.L.else.main.1573:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-552]
+  mov r9, qword ptr [rbp-536]
+  mov r10, qword ptr [rbp-544]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1574:
+  mov qword ptr [rbp-512], 2
+  mov qword ptr [rbp-520], 2
+  lea rsi, [rip+.L.data.main.619]
+  mov qword ptr [rbp-528], rsi
+  mov rsi, qword ptr [rbp-512]
+  cmp rsi, qword ptr [rbp-520]
+  jne .L.else.main.1575
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-528]
+  mov r9, qword ptr [rbp-520]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1576
+.L.else.main.1575:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-528]
+  mov r9, qword ptr [rbp-512]
+  mov r10, qword ptr [rbp-520]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1576:
+  mov qword ptr [rbp-488], 4
+  mov qword ptr [rbp-496], 4
+  lea rsi, [rip+.L.data.main.620]
+  mov qword ptr [rbp-504], rsi
+  mov rsi, qword ptr [rbp-488]
+  cmp rsi, qword ptr [rbp-496]
+  jne .L.else.main.1577
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-504]
+  mov r9, qword ptr [rbp-496]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1578
+.L.else.main.1577:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-504]
+  mov r9, qword ptr [rbp-488]
+  mov r10, qword ptr [rbp-496]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1578:
+  mov qword ptr [rbp-464], 4
+  mov qword ptr [rbp-472], 4
+  lea rsi, [rip+.L.data.main.621]
+  mov qword ptr [rbp-480], rsi
+  mov rsi, qword ptr [rbp-464]
+  cmp rsi, qword ptr [rbp-472]
+  jne .L.else.main.1579
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-480]
+  mov r9, qword ptr [rbp-472]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1580
+.L.else.main.1579:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-480]
+  mov r9, qword ptr [rbp-464]
+  mov r10, qword ptr [rbp-472]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1580:
+  mov qword ptr [rbp-440], 4
+  mov qword ptr [rbp-448], 4
+  lea rsi, [rip+.L.data.main.622]
+  mov qword ptr [rbp-456], rsi
+  mov rsi, qword ptr [rbp-440]
+  cmp rsi, qword ptr [rbp-448]
+  jne .L.else.main.1581
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-456]
+  mov r9, qword ptr [rbp-448]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1582
+.L.else.main.1581:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-456]
+  mov r9, qword ptr [rbp-440]
+  mov r10, qword ptr [rbp-448]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1582:
+  mov qword ptr [rbp-416], 4
+  mov qword ptr [rbp-424], 4
+  lea rsi, [rip+.L.data.main.623]
+  mov qword ptr [rbp-432], rsi
+  mov rsi, qword ptr [rbp-416]
+  cmp rsi, qword ptr [rbp-424]
+  jne .L.else.main.1583
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-432]
+  mov r9, qword ptr [rbp-424]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1584
+.L.else.main.1583:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-432]
+  mov r9, qword ptr [rbp-416]
+  mov r10, qword ptr [rbp-424]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1584:
+  mov qword ptr [rbp-392], 8
+  mov qword ptr [rbp-400], 8
+  lea rsi, [rip+.L.data.main.624]
+  mov qword ptr [rbp-408], rsi
+  mov rsi, qword ptr [rbp-392]
+  cmp rsi, qword ptr [rbp-400]
+  jne .L.else.main.1585
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-408]
+  mov r9, qword ptr [rbp-400]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1586
+.L.else.main.1585:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-408]
+  mov r9, qword ptr [rbp-392]
+  mov r10, qword ptr [rbp-400]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1586:
+  mov qword ptr [rbp-368], 8
+  mov qword ptr [rbp-376], 8
+  lea rsi, [rip+.L.data.main.625]
+  mov qword ptr [rbp-384], rsi
+  mov rsi, qword ptr [rbp-368]
+  cmp rsi, qword ptr [rbp-376]
+  jne .L.else.main.1587
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-384]
+  mov r9, qword ptr [rbp-376]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1588
+.L.else.main.1587:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-384]
+  mov r9, qword ptr [rbp-368]
+  mov r10, qword ptr [rbp-376]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1588:
+  mov qword ptr [rbp-344], 8
+  mov qword ptr [rbp-352], 8
+  lea rsi, [rip+.L.data.main.626]
+  mov qword ptr [rbp-360], rsi
+  mov rsi, qword ptr [rbp-344]
+  cmp rsi, qword ptr [rbp-352]
+  jne .L.else.main.1589
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-360]
+  mov r9, qword ptr [rbp-352]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1590
+.L.else.main.1589:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-360]
+  mov r9, qword ptr [rbp-344]
+  mov r10, qword ptr [rbp-352]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1590:
+  mov qword ptr [rbp-320], 8
+  mov qword ptr [rbp-328], 8
+  lea rsi, [rip+.L.data.main.627]
+  mov qword ptr [rbp-336], rsi
+  mov rsi, qword ptr [rbp-320]
+  cmp rsi, qword ptr [rbp-328]
+  jne .L.else.main.1591
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-336]
+  mov r9, qword ptr [rbp-328]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1592
+.L.else.main.1591:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-336]
+  mov r9, qword ptr [rbp-320]
+  mov r10, qword ptr [rbp-328]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1592:
+  mov qword ptr [rbp-296], 8
+  mov qword ptr [rbp-304], 8
+  lea rsi, [rip+.L.data.main.628]
+  mov qword ptr [rbp-312], rsi
+  mov rsi, qword ptr [rbp-296]
+  cmp rsi, qword ptr [rbp-304]
+  jne .L.else.main.1593
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-312]
+  mov r9, qword ptr [rbp-304]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1594
+.L.else.main.1593:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-312]
+  mov r9, qword ptr [rbp-296]
+  mov r10, qword ptr [rbp-304]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1594:
+  mov qword ptr [rbp-272], 8
+  mov qword ptr [rbp-280], 8
+  lea rsi, [rip+.L.data.main.629]
+  mov qword ptr [rbp-288], rsi
+  mov rsi, qword ptr [rbp-272]
+  cmp rsi, qword ptr [rbp-280]
+  jne .L.else.main.1595
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-288]
+  mov r9, qword ptr [rbp-280]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1596
+.L.else.main.1595:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-288]
+  mov r9, qword ptr [rbp-272]
+  mov r10, qword ptr [rbp-280]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1596:
+  mov qword ptr [rbp-248], 4
+  mov qword ptr [rbp-256], 4
+  lea rsi, [rip+.L.data.main.630]
+  mov qword ptr [rbp-264], rsi
+  mov rsi, qword ptr [rbp-248]
+  cmp rsi, qword ptr [rbp-256]
+  jne .L.else.main.1597
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-264]
+  mov r9, qword ptr [rbp-256]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1598
+.L.else.main.1597:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-264]
+  mov r9, qword ptr [rbp-248]
+  mov r10, qword ptr [rbp-256]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1598:
+  mov qword ptr [rbp-224], 8
+  mov qword ptr [rbp-232], 8
+  lea rsi, [rip+.L.data.main.631]
+  mov qword ptr [rbp-240], rsi
+  mov rsi, qword ptr [rbp-224]
+  cmp rsi, qword ptr [rbp-232]
+  jne .L.else.main.1599
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-240]
+  mov r9, qword ptr [rbp-232]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1600
+.L.else.main.1599:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-240]
+  mov r9, qword ptr [rbp-224]
+  mov r10, qword ptr [rbp-232]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1600:
+  mov qword ptr [rbp-200], 8
+  mov qword ptr [rbp-208], 8
+  lea rsi, [rip+.L.data.main.632]
+  mov qword ptr [rbp-216], rsi
+  mov rsi, qword ptr [rbp-200]
+  cmp rsi, qword ptr [rbp-208]
+  jne .L.else.main.1601
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-216]
+  mov r9, qword ptr [rbp-208]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1602
+.L.else.main.1601:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-216]
+  mov r9, qword ptr [rbp-200]
+  mov r10, qword ptr [rbp-208]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1602:
+  mov qword ptr [rbp-176], 8
+  mov qword ptr [rbp-184], 8
+  lea rsi, [rip+.L.data.main.633]
+  mov qword ptr [rbp-192], rsi
+  mov rsi, qword ptr [rbp-176]
+  cmp rsi, qword ptr [rbp-184]
+  jne .L.else.main.1603
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-192]
+  mov r9, qword ptr [rbp-184]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1604
+.L.else.main.1603:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-192]
+  mov r9, qword ptr [rbp-176]
+  mov r10, qword ptr [rbp-184]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1604:
+  mov qword ptr [rbp-152], 8
+  mov qword ptr [rbp-160], 8
+  lea rsi, [rip+.L.data.main.634]
+  mov qword ptr [rbp-168], rsi
+  mov rsi, qword ptr [rbp-152]
+  cmp rsi, qword ptr [rbp-160]
+  jne .L.else.main.1605
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-168]
+  mov r9, qword ptr [rbp-160]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1606
+.L.else.main.1605:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-168]
+  mov r9, qword ptr [rbp-152]
+  mov r10, qword ptr [rbp-160]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1606:
+  mov qword ptr [rbp-128], 8
+  mov qword ptr [rbp-136], 8
+  lea rsi, [rip+.L.data.main.635]
+  mov qword ptr [rbp-144], rsi
+  mov rsi, qword ptr [rbp-128]
+  cmp rsi, qword ptr [rbp-136]
+  jne .L.else.main.1607
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-144]
+  mov r9, qword ptr [rbp-136]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1608
+.L.else.main.1607:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-144]
+  mov r9, qword ptr [rbp-128]
+  mov r10, qword ptr [rbp-136]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1608:
+  mov qword ptr [rbp-104], 8
+  mov qword ptr [rbp-112], 8
+  lea rsi, [rip+.L.data.main.636]
+  mov qword ptr [rbp-120], rsi
+  mov rsi, qword ptr [rbp-104]
+  cmp rsi, qword ptr [rbp-112]
+  jne .L.else.main.1609
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-120]
+  mov r9, qword ptr [rbp-112]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1610
+.L.else.main.1609:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-120]
+  mov r9, qword ptr [rbp-104]
+  mov r10, qword ptr [rbp-112]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1610:
+  mov qword ptr [rbp-80], 4
+  mov qword ptr [rbp-88], 4
+  lea rsi, [rip+.L.data.main.637]
+  mov qword ptr [rbp-96], rsi
+  mov rsi, qword ptr [rbp-80]
+  cmp rsi, qword ptr [rbp-88]
+  jne .L.else.main.1611
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-96]
+  mov r9, qword ptr [rbp-88]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1612
+.L.else.main.1611:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-96]
+  mov r9, qword ptr [rbp-80]
+  mov r10, qword ptr [rbp-88]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1612:
+  mov qword ptr [rbp-56], 8
+  mov qword ptr [rbp-64], 8
+  lea rsi, [rip+.L.data.main.638]
+  mov qword ptr [rbp-72], rsi
+  mov rsi, qword ptr [rbp-56]
+  cmp rsi, qword ptr [rbp-64]
+  jne .L.else.main.1613
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-72]
+  mov r9, qword ptr [rbp-64]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1614
+.L.else.main.1613:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-72]
+  mov r9, qword ptr [rbp-56]
+  mov r10, qword ptr [rbp-64]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1614:
+  movabs rsi, 2147483648
+  mov qword ptr [rbp-32], rsi
+  movabs rsi, 2147483648
+  mov qword ptr [rbp-40], rsi
+  lea rsi, [rip+.L.data.main.639]
+  mov qword ptr [rbp-48], rsi
+  mov rsi, qword ptr [rbp-32]
+  cmp rsi, qword ptr [rbp-40]
+  jne .L.else.main.1615
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-48]
+  mov r9, qword ptr [rbp-40]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1616
+.L.else.main.1615:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-48]
+  mov r9, qword ptr [rbp-32]
+  mov r10, qword ptr [rbp-40]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1616:
+  movabs rsi, 4294967296
+  mov qword ptr [rbp-8], rsi
+  mov rsi, 1
+  shl rsi, 32
+  mov qword ptr [rbp-16], rsi
+  lea rsi, [rip+.L.data.main.640]
+  mov qword ptr [rbp-24], rsi
+  mov rsi, qword ptr [rbp-8]
+  cmp rsi, qword ptr [rbp-16]
+  jne .L.else.main.1617
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rbp-24]
+  mov r9, qword ptr [rbp-16]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1618
+.L.else.main.1617:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rbp-24]
+  mov r9, qword ptr [rbp-8]
+  mov r10, qword ptr [rbp-16]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1618:
+  lea rdi, [rip+.L.data.main.641]
+  mov rax, 0
+  call printf
+  mov rax, 0
+.L.return.main:
+  mov rbx, qword ptr [rbp-19368]
+  mov r12, qword ptr [rbp-19376]
+  mov r13, qword ptr [rbp-19384]
+  mov r14, qword ptr [rbp-19392]
+  mov r15, qword ptr [rbp-19400]
+  mov rsp, rbp
+  pop rbp
+  ret
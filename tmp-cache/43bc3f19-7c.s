@@ -0,0 +1,16 @@
+124
+ccc-codegen-19 0 1
+ int addx ( int * x , int y ) { return * x + y ; }
+addx: var 0 (10 1 1 0 0(4 4 4 0 0))
+x: local
+y: local
+.text
+.p2align 4
+.global addx
+addx:
+  movsxd rsi, esi
+  movsxd r8, dword ptr [rdi]
+  add r8, rsi
+  mov rax, r8
+.L.return.addx:
+  ret
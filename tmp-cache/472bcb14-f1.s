@@ -0,0 +1,36 @@
+241
+ccc-codegen-19 0 1
+ int sum_through ( int * p , int n ) { int sum = 0 ; for ( int i = 0 ; i < n ; i ++ ) { sum += loop_g ; * p += 1 ; } return sum ; }
+sum_through: var 0 (10 1 1 0 0(4 4 4 0 0))
+p: local
+n: local
+sum: ?
+i: ?
+loop_g: var 0 #1
+.text
+.p2align 4
+.global sum_through
+sum_through:
+  movsxd rsi, esi
+  mov r9, 0
+  mov r8, 0
+  cmp r8, rsi
+  jge .L.break.sum_through.3
+  .p2align 4,,10
+.L.begin.sum_through.4:
+  movsxd r10, dword ptr [rip+loop_g]
+  mov r11, r9
+  add r11, r10
+  movsxd r11, r11d
+  mov r9, r11
+  add dword ptr [rdi], 1
+  mov r10, r8
+  add r10, 1
+  movsxd r10, r10d
+  mov r8, r10
+  cmp r8, rsi
+  jl .L.begin.sum_through.4
+.L.break.sum_through.3:
+  mov rax, r9
+.L.return.sum_through:
+  ret
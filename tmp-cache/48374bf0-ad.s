@@ -0,0 +1,26 @@
+173
+ccc-codegen-19 0 1
+ int day_kind ( int d ) { switch ( d ) { case 0 : case 6 : return 2 ; case 3 : return 1 ; } return 0 ; }
+day_kind: var 0 (10 1 1 0 0(4 4 4 0 0))
+d: local
+.text
+.p2align 4
+.global day_kind
+day_kind:
+  movsxd rdi, edi
+  cmp rdi, 0
+  je .L.case.day_kind.4
+  cmp rdi, 3
+  je .L.case.day_kind.3
+  cmp rdi, 6
+  jne .L.break.day_kind.2
+.L.case.day_kind.4:
+  mov rax, 2
+  jmp .L.return.day_kind
+.L.case.day_kind.3:
+  mov rax, 1
+  jmp .L.return.day_kind
+.L.break.day_kind.2:
+  mov rax, 0
+.L.return.day_kind:
+  ret
@@ -0,0 +1,42 @@
+259
+ccc-codegen-19 0 1
+ int switch_wide_table ( long x ) { switch ( x ) { case 3000000000 : return 1 ; case 3000000001 : return 2 ; case 3000000002 : return 3 ; case 3000000004 : return 4 ; } return 0 ; }
+switch_wide_table: var 0 (10 1 1 0 0(4 4 4 0 0))
+x: local
+.text
+.p2align 4
+.global switch_wide_table
+switch_wide_table:
+  mov rsi, rdi
+  movabs r8, 3000000000
+  sub rsi, r8
+  cmp rsi, 4
+  ja .L.break.switch_wide_table.2
+  lea r8, [rip+.L.table.switch_wide_table.7]
+  shl rsi, 2
+  add rsi, r8
+  movsxd rsi, dword ptr [rsi]
+  add rsi, r8
+  jmp rsi
+.L.table.switch_wide_table.7:
+  .long .L.case.switch_wide_table.6-.L.table.switch_wide_table.7
+  .long .L.case.switch_wide_table.5-.L.table.switch_wide_table.7
+  .long .L.case.switch_wide_table.4-.L.table.switch_wide_table.7
+  .long .L.break.switch_wide_table.2-.L.table.switch_wide_table.7
+  .long .L.case.switch_wide_table.3-.L.table.switch_wide_table.7
+.L.case.switch_wide_table.6:
+  mov rax, 1
+  jmp .L.return.switch_wide_table
+.L.case.switch_wide_table.5:
+  mov rax, 2
+  jmp .L.return.switch_wide_table
+.L.case.switch_wide_table.4:
+  mov rax, 3
+  jmp .L.return.switch_wide_table
+.L.case.switch_wide_table.3:
+  mov rax, 4
+  jmp .L.return.switch_wide_table
+.L.break.switch_wide_table.2:
+  mov rax, 0
+.L.return.switch_wide_table:
+  ret
@@ -0,0 +1,56 @@
+272
+ccc-codegen-19 0 1
+ int sum_large_array ( int n ) { int x [ 64 ] ; for ( int i = 0 ; i < 64 ; i ++ ) x [ i ] = i * n ; int sum = 0 ; for ( int i = 0 ; i < 64 ; i ++ ) sum += x [ i ] ; return sum ; }
+sum_large_array: var 0 (10 1 1 0 0(4 4 4 0 0))
+n: local
+x: ?
+i: ?
+sum: ?
+.text
+.p2align 4
+.global sum_large_array
+sum_large_array:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 256
+  movsxd rdi, edi
+  mov r9, 0
+  cmp r9, 64
+  jge .L.break.sum_large_array.3
+  .p2align 4,,10
+.L.begin.sum_large_array.4:
+  lea r10, [rbp-256]
+  lea r10, [r10+r9*4]
+  mov r11, r9
+  imul r11, rdi
+  mov dword ptr [r10], r11d
+  mov r10, r9
+  add r10, 1
+  movsxd r10, r10d
+  mov r9, r10
+  cmp r9, 64
+  jl .L.begin.sum_large_array.4
+.L.break.sum_large_array.3:
+  mov r8, 0
+  mov rsi, 0
+  cmp rsi, 64
+  jge .L.break.sum_large_array.6
+  .p2align 4,,10
+.L.begin.sum_large_array.7:
+  movsxd r10, dword ptr [rbp+rsi*4-256]
+  mov r11, r8
+  add r11, r10
+  movsxd r11, r11d
+  mov r8, r11
+  mov r10, rsi
+  add r10, 1
+  movsxd r10, r10d
+  mov rsi, r10
+  cmp rsi, 64
+  jl .L.begin.sum_large_array.7
+.L.break.sum_large_array.6:
+  mov rax, r8
+.L.return.sum_large_array:
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,17 @@
+116
+ccc-codegen-19 0 1
+ char inc_char ( char c ) { c ++ ; return c ; }
+inc_char: var 0 (10 1 1 0 0(2 1 1 0 0))
+c: local
+.text
+.p2align 4
+.global inc_char
+inc_char:
+  movsx rdi, dil
+  mov rsi, rdi
+  add rsi, 1
+  movsx rsi, sil
+  mov rdi, rsi
+  mov rax, rdi
+.L.return.inc_char:
+  ret
@@ -0,0 +1,15 @@
+105
+ccc-codegen-19 0 1
+ int twice ( int x ) { return x + x ; }
+twice: var 0 (10 1 1 0 0(4 4 4 0 0))
+x: local
+.text
+.p2align 4
+.global twice
+twice:
+  movsxd rdi, edi
+  mov rsi, rdi
+  add rsi, rdi
+  mov rax, rsi
+.L.return.twice:
+  ret
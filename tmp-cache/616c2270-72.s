@@ -0,0 +1,12 @@
+114
+ccc-codegen-19 0 1
+ int answer ( void ) { return ANSWER ; }
+answer: var 0 (10 1 1 0 0(4 4 4 0 0))
+ANSWER: enum 42
+.text
+.p2align 4
+.global answer
+answer:
+  mov rax, 42
+.L.return.answer:
+  ret
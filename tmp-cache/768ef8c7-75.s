@@ -0,0 +1,12 @@
+117
+ccc-codegen-19 0 1
+ int * g1_ptr ( ) { return & g1 ; }
+g1_ptr: var 0 (10 1 1 0 0(7 8 8 0 0(4 4 4 0 0)))
+g1: var 0 #2
+.text
+.p2align 4
+.global g1_ptr
+g1_ptr:
+  lea rax, [rip+g1]
+.L.return.g1_ptr:
+  ret
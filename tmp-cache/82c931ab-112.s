@@ -0,0 +1,45 @@
+274
+ccc-codegen-19 0 1
+ int switch_wide_split ( long x ) { switch ( x ) { case - 3000000000 : return 1 ; case 5 : return 2 ; case 100 : return 3 ; case 3000000000 : return 4 ; case 7000000000 : return 5 ; } return 0 ; }
+switch_wide_split: var 0 (10 1 1 0 0(4 4 4 0 0))
+x: local
+.text
+.p2align 4
+.global switch_wide_split
+switch_wide_split:
+  cmp rdi, 100
+  je .L.case.switch_wide_split.5
+  jg .L.upper.switch_wide_split.8
+  movabs rsi, -3000000000
+  cmp rdi, rsi
+  je .L.case.switch_wide_split.7
+  cmp rdi, 5
+  je .L.case.switch_wide_split.6
+  jmp .L.break.switch_wide_split.2
+.L.upper.switch_wide_split.8:
+  movabs rsi, 3000000000
+  cmp rdi, rsi
+  je .L.case.switch_wide_split.4
+  movabs rsi, 7000000000
+  cmp rdi, rsi
+  je .L.case.switch_wide_split.3
+  jmp .L.break.switch_wide_split.2
+.L.case.switch_wide_split.7:
+  mov rax, 1
+  jmp .L.return.switch_wide_split
+.L.case.switch_wide_split.6:
+  mov rax, 2
+  jmp .L.return.switch_wide_split
+.L.case.switch_wide_split.5:
+  mov rax, 3
+  jmp .L.return.switch_wide_split
+.L.case.switch_wide_split.4:
+  mov rax, 4
+  jmp .L.return.switch_wide_split
+.L.case.switch_wide_split.3:
+  mov rax, 5
+  jmp .L.return.switch_wide_split
+.L.break.switch_wide_split.2:
+  mov rax, 0
+.L.return.switch_wide_split:
+  ret
@@ -0,0 +1,12 @@
+102
+ccc-codegen-19 0 1
+ void bump ( int * p ) { * p += 1 ; }
+bump: var 0 (10 1 1 0 0(0 1 1 0 0))
+p: local
+.text
+.p2align 4
+.global bump
+bump:
+  add dword ptr [rdi], 1
+.L.return.bump:
+  ret
@@ -0,0 +1,15 @@
+131
+ccc-codegen-19 0 1
+ long spill_f1 ( long x , long y ) { return x + y ; }
+spill_f1: var 0 (10 1 1 0 0(5 8 8 0 0))
+x: local
+y: local
+.text
+.p2align 4
+.global spill_f1
+spill_f1:
+  mov r8, rdi
+  add r8, rsi
+  mov rax, r8
+.L.return.spill_f1:
+  ret
@@ -0,0 +1,21 @@
+152
+ccc-codegen-19 0 1
+ int sub_char ( char a , char b , char c ) { return a - b - c ; }
+sub_char: var 0 (10 1 1 0 0(4 4 4 0 0))
+a: local
+b: local
+c: local
+.text
+.p2align 4
+.global sub_char
+sub_char:
+  movsx rdi, dil
+  movsx rsi, sil
+  mov r8, rdx
+  movsx r8, r8b
+  mov r9, rdi
+  sub r9, rsi
+  sub r9, r8
+  mov rax, r9
+.L.return.sub_char:
+  ret
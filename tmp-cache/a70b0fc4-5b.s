@@ -0,0 +1,10 @@
+91
+ccc-codegen-19 0 1
+ void ret_none ( ) { return ; }
+ret_none: var 0 (10 1 1 0 0(0 1 1 0 0))
+.text
+.p2align 4
+.global ret_none
+ret_none:
+.L.return.ret_none:
+  ret
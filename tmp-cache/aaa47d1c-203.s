@@ -0,0 +1,95 @@
+515
+ccc-codegen-19 0 1
+ long spill_addr ( long a0 , long a1 , long a2 , long a3 , long a4 , long a5 ) { long acc = 26 ; if ( ( ( a5 * a3 ) - ( a3 == a2 ) * a1 ) / ( ( ( long ) ( ( spill_g [ a0 & 3 ] / ( - 3 ) ) < ( a5 < 12345 ) ) & 255 ) + 1 ) ) { } return acc + ( ( acc / ( ( spill_f1 ( spill_g [ a1 & 3 ] , a3 ) & 255 ) + 1 ) ) << 18 ) * 10 ; }
+spill_addr: var 0 (10 1 1 0 0(5 8 8 0 0))
+a0: local
+a1: local
+a2: local
+a3: local
+a4: local
+a5: local
+acc: ?
+spill_g: var 0 (8 128 8 16 0#1)
+spill_f1: var 0 (10 1 1 0 0#1)
+.text
+.p2align 4
+.global spill_addr
+spill_addr:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov qword ptr [rbp-40], rbx
+  mov qword ptr [rbp-48], r12
+  mov qword ptr [rbp-56], r13
+  mov qword ptr [rbp-64], r14
+  mov qword ptr [rbp-72], r15
+  mov qword ptr [rbp-16], rdi
+  mov r15, rsi
+  mov r14, rdx
+  mov r13, rcx
+  mov qword ptr [rbp-8], r8
+  mov r12, r9
+  mov rbx, 26
+  mov rsi, r12
+  imul rsi, r13
+  cmp r13, r14
+  sete dil
+  movzx rdi, dil
+  imul rdi, r15
+  sub rsi, rdi
+  lea rdi, [rip+spill_g]
+  mov r8, qword ptr [rbp-16]
+  and r8, 3
+  mov rdi, qword ptr [rdi+r8*8]
+  mov r8, 0
+  sub r8, 3
+  mov rax, rdi
+  cqo
+  idiv r8
+  mov rdi, rax
+  cmp r12, 12345
+  setl r8b
+  movzx r8, r8b
+  cmp rdi, r8
+  setl dil
+  movzx rdi, dil
+  and rdi, 255
+  add rdi, 1
+  mov rax, rsi
+  cqo
+  idiv rdi
+  mov qword ptr [rbp-24], rbx
+  mov qword ptr [rbp-32], rbx
+  lea rsi, [rip+spill_g]
+  mov rdi, r15
+  and rdi, 3
+  mov rdi, qword ptr [rsi+rdi*8]
+  mov rsi, r13
+  mov rax, 0
+  call spill_f1
+  mov rsi, rax
+  and rsi, 255
+  add rsi, 1
+  mov rax, qword ptr [rbp-32]
+  cqo
+  idiv rsi
+  mov qword ptr [rbp-32], rax
+  shl qword ptr [rbp-32], 18
+  mov rax, qword ptr [rbp-32]
+  shl rax, 2
+  add rax, qword ptr [rbp-32]
+  lea rdx, [rax]
+  mov qword ptr [rbp-32], rdx
+  mov rdx, qword ptr [rbp-32]
+  shl rdx, 1
+  add rdx, qword ptr [rbp-24]
+  lea rax, [rdx]
+.L.return.spill_addr:
+  mov rbx, qword ptr [rbp-40]
+  mov r12, qword ptr [rbp-48]
+  mov r13, qword ptr [rbp-56]
+  mov r14, qword ptr [rbp-64]
+  mov r15, qword ptr [rbp-72]
+  mov rsp, rbp
+  pop rbp
+  ret
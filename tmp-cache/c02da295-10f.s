@@ -0,0 +1,60 @@
+271
+ccc-codegen-19 0 1
+ int bool_inc_loop ( char * p ) { int i = 0 ; int acc = 0 ; _Bool v = p [ 0 ] ; while ( i < 4 ) { i ++ ; acc += ++ v ; } int old = v ++ ; return acc * 100 + old * 10 + v ; }
+bool_inc_loop: var 0 (10 1 1 0 0(4 4 4 0 0))
+p: local
+i: ?
+acc: ?
+v: ?
+old: ?
+.text
+.p2align 4
+.global bool_inc_loop
+bool_inc_loop:
+  mov r10, 0
+  mov r9, 0
+  mov r11, rdi
+  add r11, 0
+  movsx r11, byte ptr [r11]
+  cmp r11, 0
+  setne r11b
+  movsx r11, r11b
+  mov r8, r11
+  cmp r10, 4
+  jge .L.break.bool_inc_loop.3
+  .p2align 4,,10
+.L.begin.bool_inc_loop.4:
+  mov r11, r10
+  add r11, 1
+  movsxd r11, r11d
+  mov r10, r11
+  mov r11, r8
+  add r11, 1
+  cmp r11, 0
+  setne r11b
+  movsx r11, r11b
+  mov r8, r11
+  mov rcx, r9
+  add rcx, r11
+  movsxd rcx, ecx
+  mov r9, rcx
+  cmp r10, 4
+  jl .L.begin.bool_inc_loop.4
+.L.break.bool_inc_loop.3:
+  mov r11, r8
+  mov rcx, r11
+  add r11, 1
+  cmp r11, 0
+  setne r11b
+  movsx r11, r11b
+  mov r8, r11
+  movsxd rcx, ecx
+  mov rsi, rcx
+  mov r11, r9
+  imul r11, 100
+  lea rcx, [rsi+rsi*4]
+  lea r11, [r11+rcx*2]
+  add r11, r8
+  mov rax, r11
+.L.return.bool_inc_loop:
+  ret
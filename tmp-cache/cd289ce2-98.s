@@ -0,0 +1,18 @@
+152
+ccc-codegen-19 0 1
+ int sub_long ( long a , long b , long c ) { return a - b - c ; }
+sub_long: var 0 (10 1 1 0 0(4 4 4 0 0))
+a: local
+b: local
+c: local
+.text
+.p2align 4
+.global sub_long
+sub_long:
+  mov r8, rdx
+  mov r9, rdi
+  sub r9, rsi
+  sub r9, r8
+  mov rax, r9
+.L.return.sub_long:
+  ret
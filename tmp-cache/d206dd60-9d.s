@@ -0,0 +1,21 @@
+157
+ccc-codegen-19 0 1
+ int sub_short ( short a , short b , short c ) { return a - b - c ; }
+sub_short: var 0 (10 1 1 0 0(4 4 4 0 0))
+a: local
+b: local
+c: local
+.text
+.p2align 4
+.global sub_short
+sub_short:
+  movsx rdi, di
+  movsx rsi, si
+  mov r8, rdx
+  movsx r8, r8w
+  mov r9, rdi
+  sub r9, rsi
+  sub r9, r8
+  mov rax, r9
+.L.return.sub_short:
+  ret
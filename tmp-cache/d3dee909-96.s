@@ -0,0 +1,40 @@
+150
+ccc-codegen-19 0 1
+ int fib ( int x ) { if ( x <= 1 ) return 1 ; return fib ( x - 1 ) + fib ( x - 2 ) ; }
+fib: var 0 (10 1 1 0 0(4 4 4 0 0))
+x: local
+.text
+.p2align 4
+.global fib
+fib:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov qword ptr [rbp-8], rbx
+  mov qword ptr [rbp-16], r12
+  mov rbx, rdi
+  movsxd rbx, ebx
+  cmp rbx, 1
+  jg .L.end.fib.2
+  mov rax, 1
+  jmp .L.return.fib
+.L.end.fib.2:
+  mov rsi, rbx
+  sub rsi, 1
+  mov rdi, rsi
+  mov rax, 0
+  call fib
+  mov r12, rax
+  mov rsi, rbx
+  sub rsi, 2
+  mov rdi, rsi
+  mov rax, 0
+  call fib
+  add r12, rax
+  mov rax, r12
+.L.return.fib:
+  mov rbx, qword ptr [rbp-8]
+  mov r12, qword ptr [rbp-16]
+  mov rsp, rbp
+  pop rbp
+  ret
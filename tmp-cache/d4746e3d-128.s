@@ -0,0 +1,28 @@
+296
+ccc-codegen-19 0 1
+ int swap_args ( int x , int y ) { return sub2 ( y , x ) ; }
+swap_args: var 0 (10 1 1 0 0(4 4 4 0 0))
+x: local
+y: local
+sub2: var 0 (10 1 1 0 0#1) inline {ccc-codegen-19 0 1
+ int sub2 ( int x , int y ) { return x - y ; }
+sub2: var 0 (10 1 1 0 0(4 4 4 0 0))
+x: local
+y: local
+}
+.text
+.p2align 4
+.global swap_args
+swap_args:
+  movsxd rdi, edi
+  movsxd rsi, esi
+  movsxd r10, esi
+  mov r8, r10
+  movsxd r10, edi
+  mov r9, r10
+  mov r10, r8
+  sub r10, r9
+  movsxd r10, r10d
+  mov rax, r10
+.L.return.swap_args:
+  ret
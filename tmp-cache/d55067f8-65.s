@@ -0,0 +1,10 @@
+101
+ccc-codegen-19 0 1
+ static int static_fn ( ) { return 3 ; }
+static_fn: var 0 (10 1 1 0 0(4 4 4 0 0))
+.text
+.p2align 4
+static_fn:
+  mov rax, 3
+.L.return.static_fn:
+  ret
@@ -0,0 +1,29 @@
+211
+ccc-codegen-19 0 1
+ int switch_wide ( long x ) { switch ( x ) { case 3000000000 : return 1 ; case - 3000000000 : return 2 ; case 5 : return 3 ; } return 0 ; }
+switch_wide: var 0 (10 1 1 0 0(4 4 4 0 0))
+x: local
+.text
+.p2align 4
+.global switch_wide
+switch_wide:
+  movabs rsi, -3000000000
+  cmp rdi, rsi
+  je .L.case.switch_wide.4
+  cmp rdi, 5
+  je .L.case.switch_wide.3
+  movabs rsi, 3000000000
+  cmp rdi, rsi
+  jne .L.break.switch_wide.2
+  mov rax, 1
+  jmp .L.return.switch_wide
+.L.case.switch_wide.4:
+  mov rax, 2
+  jmp .L.return.switch_wide
+.L.case.switch_wide.3:
+  mov rax, 3
+  jmp .L.return.switch_wide
+.L.break.switch_wide.2:
+  mov rax, 0
+.L.return.switch_wide:
+  ret
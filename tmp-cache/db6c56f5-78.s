@@ -0,0 +1,17 @@
+120
+ccc-codegen-19 0 1
+ int add2 ( int x , int y ) { return x + y ; }
+add2: var 0 (10 1 1 0 0(4 4 4 0 0))
+x: local
+y: local
+.text
+.p2align 4
+.global add2
+add2:
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov r8, rdi
+  add r8, rsi
+  mov rax, r8
+.L.return.add2:
+  ret
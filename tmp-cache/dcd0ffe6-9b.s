@@ -0,0 +1,26 @@
+155
+ccc-codegen-19 0 1
+ long bool_add ( long a ) { _Bool d = a ; long x = ( d += 5 ) ; return x ; }
+bool_add: var 0 (10 1 1 0 0(5 8 8 0 0))
+a: local
+d: ?
+x: ?
+.text
+.p2align 4
+.global bool_add
+bool_add:
+  mov r9, rdi
+  cmp r9, 0
+  setne r9b
+  movsx r9, r9b
+  mov r8, r9
+  mov r9, r8
+  add r9, 5
+  cmp r9, 0
+  setne r9b
+  movsx r9, r9b
+  mov r8, r9
+  mov rsi, r9
+  mov rax, rsi
+.L.return.bool_add:
+  ret
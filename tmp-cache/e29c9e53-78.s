@@ -0,0 +1,17 @@
+120
+ccc-codegen-19 0 1
+ int sub2 ( int x , int y ) { return x - y ; }
+sub2: var 0 (10 1 1 0 0(4 4 4 0 0))
+x: local
+y: local
+.text
+.p2align 4
+.global sub2
+sub2:
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov r8, rdi
+  sub r8, rsi
+  mov rax, r8
+.L.return.sub2:
+  ret
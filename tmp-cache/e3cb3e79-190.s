@@ -0,0 +1,47 @@
+400
+ccc-codegen-19 0 1
+ int sum_local_through ( int n ) { int x = 1 ; int * p = & x ; int sum = 0 ; for ( int i = 0 ; i < n ; i ++ ) { sum += x ; bump ( p ) ; } return sum ; }
+sum_local_through: var 0 (10 1 1 0 0(4 4 4 0 0))
+n: local
+x: ?
+p: ?
+sum: ?
+i: ?
+bump: var 0 (10 1 1 0 0(0 1 1 0 0)) inline {ccc-codegen-19 0 1
+ void bump ( int * p ) { * p += 1 ; }
+bump: var 0 (10 1 1 0 0(0 1 1 0 0))
+p: local
+}
+.text
+.p2align 4
+.global sum_local_through
+sum_local_through:
+  push rbp
+  mov rbp, rsp
+  movsxd rdi, edi
+  mov dword ptr [rbp-4], 1
+  lea r10, [rbp-4]
+  mov r9, 0
+  mov r8, 0
+  cmp r8, rdi
+  jge .L.break.sum_local_through.3
+  .p2align 4,,10
+.L.begin.sum_local_through.4:
+  movsxd r11, dword ptr [rbp-4]
+  mov rcx, r9
+  add rcx, r11
+  movsxd rcx, ecx
+  mov r9, rcx
+  mov rsi, r10
+  add dword ptr [rsi], 1
+  mov r11, r8
+  add r11, 1
+  movsxd r11, r11d
+  mov r8, r11
+  cmp r8, rdi
+  jl .L.begin.sum_local_through.4
+.L.break.sum_local_through.3:
+  mov rax, r9
+.L.return.sum_local_through:
+  pop rbp
+  ret
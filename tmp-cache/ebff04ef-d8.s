@@ -0,0 +1,50 @@
+216
+ccc-codegen-19 0 1
+ int sum_fib ( int n ) { int sum = 0 ; for ( int i = 0 ; i < n ; i ++ ) sum = sum + fib ( i ) ; return sum ; }
+sum_fib: var 0 (10 1 1 0 0(4 4 4 0 0))
+n: local
+sum: ?
+i: ?
+fib: var 0 (10 1 1 0 0#1)
+.text
+.p2align 4
+.global sum_fib
+sum_fib:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-8], rbx
+  mov qword ptr [rbp-16], r12
+  mov qword ptr [rbp-24], r13
+  mov qword ptr [rbp-32], r14
+  mov r13, rdi
+  movsxd r13, r13d
+  mov r12, 0
+  mov rbx, 0
+  cmp rbx, r13
+  jge .L.break.sum_fib.3
+  .p2align 4,,10
+.L.begin.sum_fib.4:
+  mov r14, r12
+  mov rdi, rbx
+  mov rax, 0
+  call fib
+  add r14, rax
+  movsxd r14, r14d
+  mov r12, r14
+  mov rsi, rbx
+  add rsi, 1
+  movsxd rsi, esi
+  mov rbx, rsi
+  cmp rbx, r13
+  jl .L.begin.sum_fib.4
+.L.break.sum_fib.3:
+  mov rax, r12
+.L.return.sum_fib:
+  mov rbx, qword ptr [rbp-8]
+  mov r12, qword ptr [rbp-16]
+  mov r13, qword ptr [rbp-24]
+  mov r14, qword ptr [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,51 @@
+253
+ccc-codegen-19 0 1
+ long scale_call ( long a , long b , long c , long d , long e ) { return a + b + c + d + e + ( a * 3 + one ( ) * 8 ) ; }
+scale_call: var 0 (10 1 1 0 0(5 8 8 0 0))
+a: local
+b: local
+c: local
+d: local
+e: local
+one: var 0 (10 1 1 0 0#1)
+.text
+.p2align 4
+.global scale_call
+scale_call:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov qword ptr [rbp-24], rbx
+  mov qword ptr [rbp-32], r12
+  mov qword ptr [rbp-40], r13
+  mov qword ptr [rbp-48], r14
+  mov qword ptr [rbp-56], r15
+  mov r15, rdi
+  mov r14, rsi
+  mov r13, rdx
+  mov r12, rcx
+  mov rbx, r8
+  mov qword ptr [rbp-8], r15
+  add qword ptr [rbp-8], r14
+  add qword ptr [rbp-8], r13
+  add qword ptr [rbp-8], r12
+  add qword ptr [rbp-8], rbx
+  lea rax, [r15+r15*2]
+  mov qword ptr [rbp-16], rax
+  mov rax, 0
+  call one
+  mov rdx, qword ptr [rbp-16]
+  lea rdx, [rdx+rax*8]
+  mov qword ptr [rbp-16], rdx
+  mov rax, qword ptr [rbp-16]
+  add qword ptr [rbp-8], rax
+  mov rax, qword ptr [rbp-8]
+.L.return.scale_call:
+  mov rbx, qword ptr [rbp-24]
+  mov r12, qword ptr [rbp-32]
+  mov r13, qword ptr [rbp-40]
+  mov r14, qword ptr [rbp-48]
+  mov r15, qword ptr [rbp-56]
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,11 @@
+88
+ccc-codegen-19 0 1
+ long one ( void ) { return 1 ; }
+one: var 0 (10 1 1 0 0(5 8 8 0 0))
+.text
+.p2align 4
+.global one
+one:
+  mov rax, 1
+.L.return.one:
+  ret
@@ -0,0 +1,42102 @@
+.intel_syntax noprefix
+.global loop_g
+.global grid
+.global spill_g
+.global tree
+.global g27
+.global g26
+.global g25
+.global g24
+.global g23
+.global g22
+.global g21
+.global g20
+.global g19
+.global g18
+.global g17
+.global g16
+.global g15
+.global g14
+.global g13
+.global g12
+.global g11
+.global g10
+.global g9
+.global g8
+.global g7
+.global g6
+.global g5
+.global g4
+.global g3
+.global g2
+.global g1
+.bss
+.align 4
+loop_g:
+  .zero 4
+.align 8
+grid:
+  .zero 160
+.align 8
+spill_g:
+  .zero 128
+.align 4
+g2:
+  .zero 16
+.align 4
+g1:
+  .zero 4
+.data
+.align 4
+ext3:
+  .4byte 3
+.align 8
+.L.data.7:
+  .4byte 4
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .8byte 0
+  .8byte 0
+.align 8
+.L.data.6:
+  .4byte 3
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .8byte 0
+  .8byte 0
+.align 8
+.L.data.5:
+  .4byte 2
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .quad .L.data.6+0
+  .quad .L.data.7+0
+.align 8
+.L.data.4:
+  .4byte 1
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .quad .L.data.5+0
+  .8byte 0
+.align 8
+tree:
+  .quad .L.data.4+0
+.align 8
+g27:
+  .quad g26+4
+.align 4
+g26:
+  .4byte 1
+  .4byte 2
+  .4byte 3
+.align 8
+g25:
+  .quad g24+0
+.align 4
+g24:
+  .4byte 3
+.align 8
+g23:
+  .quad g17+0
+  .quad g17+3
+  .quad g17-3
+.align 8
+g22:
+  .quad g17-3
+.align 8
+g21:
+  .quad g17+3
+.align 8
+g20:
+  .quad g17+0
+.align 1
+g19:
+  .byte 102
+  .byte 111
+  .byte 111
+.align 1
+g18:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+.align 1
+g17:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.align 1
+g16:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 0
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.align 1
+.L.data.3:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 0
+.align 8
+g15:
+  .quad .L.data.3+0
+.align 4
+g14:
+  .4byte 1
+  .4byte 2
+  .4byte 3
+  .4byte 4
+.align 4
+g13:
+  .4byte 1
+  .4byte 2
+  .4byte 3
+  .4byte 4
+.align 4
+g12:
+  .4byte 1
+  .4byte 2
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+.align 4
+g11:
+  .byte 1
+  .byte 0
+  .byte 0
+  .byte 0
+  .4byte 2
+  .byte 3
+  .byte 0
+  .byte 0
+  .byte 0
+  .4byte 4
+.align 1
+.L.data.2:
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.align 1
+.L.data.1:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 0
+.align 8
+g10:
+  .quad .L.data.1+0
+  .quad .L.data.2+0
+.align 4
+g9:
+  .4byte 0
+  .4byte 1
+  .4byte 2
+.align 1
+.L.data.0:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+.align 8
+g8:
+  .quad .L.data.0+0
+.align 8
+g7:
+  .quad g5+0
+.align 8
+g6:
+  .8byte 6
+.align 4
+g5:
+  .4byte 5
+.align 2
+g4:
+  .2byte 4
+.align 1
+g3:
+  .byte 3
+.bss
+.data
+.align 1
+.L.data.assert.1:
+  .byte 37
+  .byte 115
+  .byte 32
+  .byte 61
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 32
+  .byte 101
+  .byte 120
+  .byte 112
+  .byte 101
+  .byte 99
+  .byte 116
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 98
+  .byte 117
+  .byte 116
+  .byte 32
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 10
+  .byte 0
+.align 1
+.L.data.assert.0:
+  .byte 37
+  .byte 115
+  .byte 32
+  .byte 61
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 10
+  .byte 0
+.text
+.p2align 4
+.global assert
+assert:
+  sub rsp, 24
+  mov qword ptr [rsp+16], rbx
+  mov qword ptr [rsp+8], r12
+  mov qword ptr [rsp], r13
+  mov r13, rdi
+  mov r12, rsi
+  mov rbx, rdx
+  cmp r13, r12
+  jne .L.else.assert.2
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, rbx
+  mov rdx, r12
+  mov rax, 0
+  call printf
+  jmp .L.end.assert.3
+.L.else.assert.2:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, rbx
+  mov rdx, r13
+  mov rcx, r12
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.assert.3:
+.L.return.assert:
+  mov rbx, qword ptr [rsp+16]
+  mov r12, qword ptr [rsp+8]
+  mov r13, qword ptr [rsp]
+  add rsp, 24
+  ret
+.text
+.p2align 4
+.global ret3
+ret3:
+  mov rax, 3
+.L.return.ret3:
+  ret
+.text
+.p2align 4
+.global add2
+add2:
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov r8, rdi
+  add r8, rsi
+  mov rax, r8
+.L.return.add2:
+  ret
+.text
+.p2align 4
+.global sub2
+sub2:
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov r8, rdi
+  sub r8, rsi
+  mov rax, r8
+.L.return.sub2:
+  ret
+.text
+.p2align 4
+.global add6
+add6:
+  mov dword ptr [rsp-4], edi
+  movsxd rsi, esi
+  mov r10, rdx
+  movsxd r10, r10d
+  movsxd rcx, ecx
+  movsxd r8, r8d
+  movsxd r9, r9d
+  movsxd rdi, dword ptr [rsp-4]
+  add rdi, rsi
+  add rdi, r10
+  add rdi, rcx
+  add rdi, r8
+  add rdi, r9
+  mov rax, rdi
+.L.return.add6:
+  ret
+.text
+.p2align 4
+.global addx
+addx:
+  movsxd rsi, esi
+  movsxd r8, dword ptr [rdi]
+  add r8, rsi
+  mov rax, r8
+.L.return.addx:
+  ret
+.text
+.p2align 4
+.global sub_char
+sub_char:
+  movsx rdi, dil
+  movsx rsi, sil
+  mov r8, rdx
+  movsx r8, r8b
+  mov r9, rdi
+  sub r9, rsi
+  sub r9, r8
+  mov rax, r9
+.L.return.sub_char:
+  ret
+.text
+.p2align 4
+.global sub_short
+sub_short:
+  movsx rdi, di
+  movsx rsi, si
+  mov r8, rdx
+  movsx r8, r8w
+  mov r9, rdi
+  sub r9, rsi
+  sub r9, r8
+  mov rax, r9
+.L.return.sub_short:
+  ret
+.text
+.p2align 4
+.global sub_long
+sub_long:
+  mov r8, rdx
+  mov r9, rdi
+  sub r9, rsi
+  sub r9, r8
+  mov rax, r9
+.L.return.sub_long:
+  ret
+.text
+.p2align 4
+.global g1_ptr
+g1_ptr:
+  lea rax, [rip+g1]
+.L.return.g1_ptr:
+  ret
+.text
+.p2align 4
+.global fib
+fib:
+  sub rsp, 24
+  mov qword ptr [rsp+16], rbx
+  mov qword ptr [rsp+8], r12
+  mov rbx, rdi
+  movsxd rbx, ebx
+  cmp rbx, 1
+  jg .L.end.fib.2
+  mov rax, 1
+  jmp .L.return.fib
+.L.end.fib.2:
+  mov rsi, rbx
+  sub rsi, 1
+  mov rdi, rsi
+  mov rax, 0
+  call fib
+  mov r12, rax
+  mov rsi, rbx
+  sub rsi, 2
+  mov rdi, rsi
+  mov rax, 0
+  call fib
+  add r12, rax
+  mov rax, r12
+.L.return.fib:
+  mov rbx, qword ptr [rsp+16]
+  mov r12, qword ptr [rsp+8]
+  add rsp, 24
+  ret
+.text
+.p2align 4
+.global sum_fib
+sum_fib:
+  sub rsp, 40
+  mov qword ptr [rsp+32], rbx
+  mov qword ptr [rsp+24], r12
+  mov qword ptr [rsp+16], r13
+  mov qword ptr [rsp+8], r14
+  mov r13, rdi
+  movsxd r13, r13d
+  mov r12, 0
+  mov rbx, 0
+  cmp rbx, r13
+  jge .L.break.sum_fib.3
+  .p2align 4,,10
+.L.begin.sum_fib.4:
+  mov r14, r12
+  mov rdi, rbx
+  mov rax, 0
+  call fib
+  add r14, rax
+  movsxd r14, r14d
+  mov r12, r14
+  mov rsi, rbx
+  add rsi, 1
+  movsxd rsi, esi
+  mov rbx, rsi
+  cmp rbx, r13
+  jl .L.begin.sum_fib.4
+.L.break.sum_fib.3:
+  mov rax, r12
+.L.return.sum_fib:
+  mov rbx, qword ptr [rsp+32]
+  mov r12, qword ptr [rsp+24]
+  mov r13, qword ptr [rsp+16]
+  mov r14, qword ptr [rsp+8]
+  add rsp, 40
+  ret
+.text
+.p2align 4
+.global rotate6
+rotate6:
+  mov dword ptr [rsp-12], edi
+  mov dword ptr [rsp-8], esi
+  mov r11, rdx
+  movsxd r11, r11d
+  movsxd rcx, ecx
+  movsxd r8, r8d
+  movsxd r9, r9d
+  mov r10, 0
+  cmp r10, 3
+  jge .L.break.rotate6.3
+  .p2align 4,,10
+.L.begin.rotate6.4:
+  movsxd rsi, dword ptr [rsp-12]
+  mov dword ptr [rsp-4], esi
+  movsxd rsi, dword ptr [rsp-8]
+  mov dword ptr [rsp-12], esi
+  mov dword ptr [rsp-8], r11d
+  movsxd rsi, ecx
+  mov r11, rsi
+  movsxd rsi, r8d
+  mov rcx, rsi
+  movsxd rsi, r9d
+  mov r8, rsi
+  movsxd rsi, dword ptr [rsp-4]
+  movsxd rsi, esi
+  mov r9, rsi
+  mov rsi, r10
+  add rsi, 1
+  movsxd rsi, esi
+  mov r10, rsi
+  cmp r10, 3
+  jl .L.begin.rotate6.4
+.L.break.rotate6.3:
+  movsxd rsi, dword ptr [rsp-12]
+  imul rsi, 100000
+  movsxd rdi, dword ptr [rsp-8]
+  imul rdi, 10000
+  add rsi, rdi
+  mov rdi, r11
+  imul rdi, 1000
+  add rsi, rdi
+  mov rdi, rcx
+  imul rdi, 100
+  add rsi, rdi
+  lea rdi, [r8+r8*4]
+  lea rsi, [rsi+rdi*2]
+  add rsi, r9
+  mov rax, rsi
+.L.return.rotate6:
+  ret
+.text
+.p2align 4
+.global swap_args
+swap_args:
+  movsxd rdi, edi
+  movsxd rsi, esi
+  movsxd r10, esi
+  mov r8, r10
+  movsxd r10, edi
+  mov r9, r10
+  mov r10, r8
+  sub r10, r9
+  movsxd r10, r10d
+  mov rax, r10
+.L.return.swap_args:
+  ret
+.text
+.p2align 4
+.global inc_char
+inc_char:
+  movsx rdi, dil
+  mov rsi, rdi
+  add rsi, 1
+  movsx rsi, sil
+  mov rdi, rsi
+  mov rax, rdi
+.L.return.inc_char:
+  ret
+.text
+.p2align 4
+.global sum_small_array
+sum_small_array:
+  movsxd rdi, edi
+  mov r9, 0
+  cmp r9, 16
+  jge .L.break.sum_small_array.3
+  .p2align 4,,10
+.L.begin.sum_small_array.4:
+  lea r10, [rsp-64]
+  lea r10, [r10+r9*4]
+  mov r11, r9
+  imul r11, rdi
+  mov dword ptr [r10], r11d
+  mov r10, r9
+  add r10, 1
+  movsxd r10, r10d
+  mov r9, r10
+  cmp r9, 16
+  jl .L.begin.sum_small_array.4
+.L.break.sum_small_array.3:
+  mov r8, 0
+  mov rsi, 0
+  cmp rsi, 16
+  jge .L.break.sum_small_array.6
+  .p2align 4,,10
+.L.begin.sum_small_array.7:
+  movsxd r10, dword ptr [rsp+rsi*4-64]
+  mov r11, r8
+  add r11, r10
+  movsxd r11, r11d
+  mov r8, r11
+  mov r10, rsi
+  add r10, 1
+  movsxd r10, r10d
+  mov rsi, r10
+  cmp rsi, 16
+  jl .L.begin.sum_small_array.7
+.L.break.sum_small_array.6:
+  mov rax, r8
+.L.return.sum_small_array:
+  ret
+.text
+.p2align 4
+.global sum_large_array
+sum_large_array:
+  sub rsp, 264
+  movsxd rdi, edi
+  mov r9, 0
+  cmp r9, 64
+  jge .L.break.sum_large_array.3
+  .p2align 4,,10
+.L.begin.sum_large_array.4:
+  lea r10, [rsp+8]
+  lea r10, [r10+r9*4]
+  mov r11, r9
+  imul r11, rdi
+  mov dword ptr [r10], r11d
+  mov r10, r9
+  add r10, 1
+  movsxd r10, r10d
+  mov r9, r10
+  cmp r9, 64
+  jl .L.begin.sum_large_array.4
+.L.break.sum_large_array.3:
+  mov r8, 0
+  mov rsi, 0
+  cmp rsi, 64
+  jge .L.break.sum_large_array.6
+  .p2align 4,,10
+.L.begin.sum_large_array.7:
+  movsxd r10, dword ptr [rsp+rsi*4+8]
+  mov r11, r8
+  add r11, r10
+  movsxd r11, r11d
+  mov r8, r11
+  mov r10, rsi
+  add r10, 1
+  movsxd r10, r10d
+  mov rsi, r10
+  cmp rsi, 64
+  jl .L.begin.sum_large_array.7
+.L.break.sum_large_array.6:
+  mov rax, r8
+.L.return.sum_large_array:
+  add rsp, 264
+  ret
+.text
+.p2align 4
+.global mix_params
+mix_params:
+  mov qword ptr [rsp-32], rbx
+  mov qword ptr [rsp-40], r12
+  mov qword ptr [rsp-24], rdi
+  mov qword ptr [rsp-16], rsi
+  mov r12, rdx
+  mov rbx, rcx
+  mov qword ptr [rsp-8], r8
+  mov rsi, qword ptr [rsp-24]
+  mov rdi, qword ptr [rsp-16]
+  mov rax, rsi
+  cqo
+  idiv rdi
+  mov r11, rax
+  mov rsi, r12
+  mov rcx, rbx
+  shl rsi, cl
+  mov r10, rsi
+  mov rsi, r11
+  imul rsi, 1000
+  add rsi, r10
+  add rsi, qword ptr [rsp-8]
+  sub rsi, r9
+  mov rdi, r12
+  mov rax, rdi
+  cqo
+  idiv rbx
+  add rsi, rax
+  mov rax, rsi
+.L.return.mix_params:
+  mov rbx, qword ptr [rsp-32]
+  mov r12, qword ptr [rsp-40]
+  ret
+.text
+.p2align 4
+.global scale_call
+scale_call:
+  sub rsp, 56
+  mov qword ptr [rsp+32], rbx
+  mov qword ptr [rsp+24], r12
+  mov qword ptr [rsp+16], r13
+  mov qword ptr [rsp+8], r14
+  mov qword ptr [rsp], r15
+  mov r15, rdi
+  mov r14, rsi
+  mov r13, rdx
+  mov r12, rcx
+  mov rbx, r8
+  mov qword ptr [rsp+48], r15
+  add qword ptr [rsp+48], r14
+  add qword ptr [rsp+48], r13
+  add qword ptr [rsp+48], r12
+  add qword ptr [rsp+48], rbx
+  lea rax, [r15+r15*2]
+  mov qword ptr [rsp+40], rax
+  mov rax, 0
+  call one
+  mov rdx, qword ptr [rsp+40]
+  lea rdx, [rdx+rax*8]
+  mov qword ptr [rsp+40], rdx
+  mov rax, qword ptr [rsp+40]
+  add qword ptr [rsp+48], rax
+  mov rax, qword ptr [rsp+48]
+.L.return.scale_call:
+  mov rbx, qword ptr [rsp+32]
+  mov r12, qword ptr [rsp+24]
+  mov r13, qword ptr [rsp+16]
+  mov r14, qword ptr [rsp+8]
+  mov r15, qword ptr [rsp]
+  add rsp, 56
+  ret
+.text
+.p2align 4
+.global one
+one:
+  mov rax, 1
+.L.return.one:
+  ret
+.text
+.p2align 4
+.global bool_add
+bool_add:
+  mov r9, rdi
+  cmp r9, 0
+  setne r9b
+  movsx r9, r9b
+  mov r8, r9
+  mov r9, r8
+  add r9, 5
+  cmp r9, 0
+  setne r9b
+  movsx r9, r9b
+  mov r8, r9
+  mov rsi, r9
+  mov rax, rsi
+.L.return.bool_add:
+  ret
+.text
+.p2align 4
+.global bool_inc_loop
+bool_inc_loop:
+  mov r10, 0
+  mov r9, 0
+  mov r11, rdi
+  add r11, 0
+  movsx r11, byte ptr [r11]
+  cmp r11, 0
+  setne r11b
+  movsx r11, r11b
+  mov r8, r11
+  cmp r10, 4
+  jge .L.break.bool_inc_loop.3
+  .p2align 4,,10
+.L.begin.bool_inc_loop.4:
+  mov r11, r10
+  add r11, 1
+  movsxd r11, r11d
+  mov r10, r11
+  mov r11, r8
+  add r11, 1
+  cmp r11, 0
+  setne r11b
+  movsx r11, r11b
+  mov r8, r11
+  mov rcx, r9
+  add rcx, r11
+  movsxd rcx, ecx
+  mov r9, rcx
+  cmp r10, 4
+  jl .L.begin.bool_inc_loop.4
+.L.break.bool_inc_loop.3:
+  mov r11, r8
+  mov rcx, r11
+  add r11, 1
+  cmp r11, 0
+  setne r11b
+  movsx r11, r11b
+  mov r8, r11
+  movsxd rcx, ecx
+  mov rsi, rcx
+  mov r11, r9
+  imul r11, 100
+  lea rcx, [rsi+rsi*4]
+  lea r11, [r11+rcx*2]
+  add r11, r8
+  mov rax, r11
+.L.return.bool_inc_loop:
+  ret
+.text
+.p2align 4
+.global spill_addr
+spill_addr:
+  sub rsp, 72
+  mov qword ptr [rsp+32], rbx
+  mov qword ptr [rsp+24], r12
+  mov qword ptr [rsp+16], r13
+  mov qword ptr [rsp+8], r14
+  mov qword ptr [rsp], r15
+  mov qword ptr [rsp+56], rdi
+  mov r15, rsi
+  mov r14, rdx
+  mov r13, rcx
+  mov qword ptr [rsp+64], r8
+  mov r12, r9
+  mov rbx, 26
+  mov rsi, r12
+  imul rsi, r13
+  cmp r13, r14
+  sete dil
+  movzx rdi, dil
+  imul rdi, r15
+  sub rsi, rdi
+  lea rdi, [rip+spill_g]
+  mov r8, qword ptr [rsp+56]
+  and r8, 3
+  mov rdi, qword ptr [rdi+r8*8]
+  mov r8, 0
+  sub r8, 3
+  mov rax, rdi
+  cqo
+  idiv r8
+  mov rdi, rax
+  cmp r12, 12345
+  setl r8b
+  movzx r8, r8b
+  cmp rdi, r8
+  setl dil
+  movzx rdi, dil
+  and rdi, 255
+  add rdi, 1
+  mov rax, rsi
+  cqo
+  idiv rdi
+  mov qword ptr [rsp+48], rbx
+  mov qword ptr [rsp+40], rbx
+  lea rsi, [rip+spill_g]
+  mov rdi, r15
+  and rdi, 3
+  mov rdi, qword ptr [rsi+rdi*8]
+  mov rsi, r13
+  mov rax, 0
+  call spill_f1
+  mov rsi, rax
+  and rsi, 255
+  add rsi, 1
+  mov rax, qword ptr [rsp+40]
+  cqo
+  idiv rsi
+  mov qword ptr [rsp+40], rax
+  shl qword ptr [rsp+40], 18
+  mov rax, qword ptr [rsp+40]
+  shl rax, 2
+  add rax, qword ptr [rsp+40]
+  lea rdx, [rax]
+  mov qword ptr [rsp+40], rdx
+  mov rdx, qword ptr [rsp+40]
+  shl rdx, 1
+  add rdx, qword ptr [rsp+48]
+  lea rax, [rdx]
+.L.return.spill_addr:
+  mov rbx, qword ptr [rsp+32]
+  mov r12, qword ptr [rsp+24]
+  mov r13, qword ptr [rsp+16]
+  mov r14, qword ptr [rsp+8]
+  mov r15, qword ptr [rsp]
+  add rsp, 72
+  ret
+.text
+.p2align 4
+.global spill_f1
+spill_f1:
+  mov r8, rdi
+  add r8, rsi
+  mov rax, r8
+.L.return.spill_f1:
+  ret
+.text
+.p2align 4
+.global switch_wide
+switch_wide:
+  movabs rsi, -3000000000
+  cmp rdi, rsi
+  je .L.case.switch_wide.4
+  cmp rdi, 5
+  je .L.case.switch_wide.3
+  movabs rsi, 3000000000
+  cmp rdi, rsi
+  jne .L.break.switch_wide.2
+  mov rax, 1
+  jmp .L.return.switch_wide
+.L.case.switch_wide.4:
+  mov rax, 2
+  jmp .L.return.switch_wide
+.L.case.switch_wide.3:
+  mov rax, 3
+  jmp .L.return.switch_wide
+.L.break.switch_wide.2:
+  mov rax, 0
+.L.return.switch_wide:
+  ret
+.text
+.p2align 4
+.global switch_wide_split
+switch_wide_split:
+  cmp rdi, 100
+  je .L.case.switch_wide_split.5
+  jg .L.upper.switch_wide_split.8
+  movabs rsi, -3000000000
+  cmp rdi, rsi
+  je .L.case.switch_wide_split.7
+  cmp rdi, 5
+  je .L.case.switch_wide_split.6
+  jmp .L.break.switch_wide_split.2
+.L.upper.switch_wide_split.8:
+  movabs rsi, 3000000000
+  cmp rdi, rsi
+  je .L.case.switch_wide_split.4
+  movabs rsi, 7000000000
+  cmp rdi, rsi
+  je .L.case.switch_wide_split.3
+  jmp .L.break.switch_wide_split.2
+.L.case.switch_wide_split.7:
+  mov rax, 1
+  jmp .L.return.switch_wide_split
+.L.case.switch_wide_split.6:
+  mov rax, 2
+  jmp .L.return.switch_wide_split
+.L.case.switch_wide_split.5:
+  mov rax, 3
+  jmp .L.return.switch_wide_split
+.L.case.switch_wide_split.4:
+  mov rax, 4
+  jmp .L.return.switch_wide_split
+.L.case.switch_wide_split.3:
+  mov rax, 5
+  jmp .L.return.switch_wide_split
+.L.break.switch_wide_split.2:
+  mov rax, 0
+.L.return.switch_wide_split:
+  ret
+.text
+.p2align 4
+.global switch_wide_table
+switch_wide_table:
+  mov rsi, rdi
+  movabs r8, 3000000000
+  sub rsi, r8
+  cmp rsi, 4
+  ja .L.break.switch_wide_table.2
+  lea r8, [rip+.L.table.switch_wide_table.7]
+  shl rsi, 2
+  add rsi, r8
+  movsxd rsi, dword ptr [rsi]
+  add rsi, r8
+  jmp rsi
+.L.table.switch_wide_table.7:
+  .long .L.case.switch_wide_table.6-.L.table.switch_wide_table.7
+  .long .L.case.switch_wide_table.5-.L.table.switch_wide_table.7
+  .long .L.case.switch_wide_table.4-.L.table.switch_wide_table.7
+  .long .L.break.switch_wide_table.2-.L.table.switch_wide_table.7
+  .long .L.case.switch_wide_table.3-.L.table.switch_wide_table.7
+.L.case.switch_wide_table.6:
+  mov rax, 1
+  jmp .L.return.switch_wide_table
+.L.case.switch_wide_table.5:
+  mov rax, 2
+  jmp .L.return.switch_wide_table
+.L.case.switch_wide_table.4:
+  mov rax, 3
+  jmp .L.return.switch_wide_table
+.L.case.switch_wide_table.3:
+  mov rax, 4
+  jmp .L.return.switch_wide_table
+.L.break.switch_wide_table.2:
+  mov rax, 0
+.L.return.switch_wide_table:
+  ret
+.text
+.p2align 4
+.global switch_int
+switch_int:
+  movsxd rdi, edi
+  cmp rdi, -1294967296
+  jne .L.break.switch_int.2
+  mov rax, 1
+  jmp .L.return.switch_int
+.L.break.switch_int.2:
+  mov rax, 0
+.L.return.switch_int:
+  ret
+.text
+.p2align 4
+.global classify
+classify:
+  movsxd rdi, edi
+  cmp rdi, 0
+  jge .L.end.classify.2
+  mov rsi, 0
+  sub rsi, 1
+  mov rax, rsi
+  jmp .L.return.classify
+.L.end.classify.2:
+  cmp rdi, 0
+  jne .L.end.classify.3
+  mov rax, 0
+  jmp .L.return.classify
+.L.end.classify.3:
+  mov rax, 1
+.L.return.classify:
+  ret
+.text
+.p2align 4
+.global day_kind
+day_kind:
+  movsxd rdi, edi
+  cmp rdi, 0
+  je .L.case.day_kind.4
+  cmp rdi, 3
+  je .L.case.day_kind.3
+  cmp rdi, 6
+  jne .L.break.day_kind.2
+.L.case.day_kind.4:
+  mov rax, 2
+  jmp .L.return.day_kind
+.L.case.day_kind.3:
+  mov rax, 1
+  jmp .L.return.day_kind
+.L.break.day_kind.2:
+  mov rax, 0
+.L.return.day_kind:
+  ret
+.text
+.p2align 4
+.global skip_to
+skip_to:
+  movsxd rdi, edi
+  cmp rdi, 5
+  jg .L.label.skip_to.big
+  mov rax, rdi
+  jmp .L.return.skip_to
+.L.label.skip_to.big:
+  lea rsi, [rdi+rdi*4]
+  shl rsi, 1
+  mov rax, rsi
+.L.return.skip_to:
+  ret
+.text
+.p2align 4
+.global bump
+bump:
+  add dword ptr [rdi], 1
+.L.return.bump:
+  ret
+.text
+.p2align 4
+.global sum_grid
+sum_grid:
+  mov qword ptr [rsp-24], rbx
+  mov qword ptr [rsp-32], r12
+  mov dword ptr [rsp-12], edi
+  movsxd rsi, esi
+  mov r11, 0
+  mov rdi, r11
+  movsxd rcx, dword ptr [rsp-12]
+  cmp rdi, rcx
+  jge .L.break.sum_grid.3
+  movsxd rdi, dword ptr [rsp-12]
+  .p2align 4,,10
+.L.begin.sum_grid.4:
+  mov r10, 0
+  cmp r10, rsi
+  jge .L.break.sum_grid.6
+  lea rcx, [r11+r11*4]
+  .p2align 4,,10
+.L.begin.sum_grid.7:
+  lea rbx, [rip+grid]
+  lea rbx, [rbx+rcx*8]
+  lea rbx, [rbx+r10*8]
+  lea r12, [r11+r11*4]
+  shl r12, 1
+  add r12, r10
+  mov qword ptr [rbx], r12
+  mov rbx, r10
+  add rbx, 1
+  movsxd rbx, ebx
+  mov r10, rbx
+  cmp r10, rsi
+  jl .L.begin.sum_grid.7
+.L.break.sum_grid.6:
+  mov rcx, r11
+  add rcx, 1
+  movsxd rcx, ecx
+  mov r11, rcx
+  mov rcx, r11
+  cmp rcx, rdi
+  jl .L.begin.sum_grid.4
+.L.break.sum_grid.3:
+  mov qword ptr [rsp-8], 0
+  mov r9, 0
+  mov rdi, r9
+  movsxd rcx, dword ptr [rsp-12]
+  cmp rdi, rcx
+  jge .L.break.sum_grid.9
+  movsxd rdi, dword ptr [rsp-12]
+  .p2align 4,,10
+.L.begin.sum_grid.10:
+  mov r8, 0
+  cmp r8, rsi
+  jge .L.break.sum_grid.12
+  lea rcx, [rip+grid]
+  lea rbx, [r9+r9*4]
+  lea rcx, [rcx+rbx*8]
+  .p2align 4,,10
+.L.begin.sum_grid.13:
+  mov rbx, qword ptr [rcx+r8*8]
+  imul rbx, qword ptr [rip+g6]
+  add qword ptr [rsp-8], rbx
+  mov rbx, r8
+  add rbx, 1
+  movsxd rbx, ebx
+  mov r8, rbx
+  cmp r8, rsi
+  jl .L.begin.sum_grid.13
+.L.break.sum_grid.12:
+  mov rcx, r9
+  add rcx, 1
+  movsxd rcx, ecx
+  mov r9, rcx
+  mov rcx, r9
+  cmp rcx, rdi
+  jl .L.begin.sum_grid.10
+.L.break.sum_grid.9:
+  mov rax, qword ptr [rsp-8]
+.L.return.sum_grid:
+  mov rbx, qword ptr [rsp-24]
+  mov r12, qword ptr [rsp-32]
+  ret
+.text
+.p2align 4
+.global count_stored
+count_stored:
+  movsxd rdi, edi
+  mov dword ptr [rip+loop_g], 0
+  mov r8, 0
+  mov rsi, 0
+  cmp rsi, rdi
+  jge .L.break.count_stored.3
+  .p2align 4,,10
+.L.begin.count_stored.4:
+  movsxd r9, dword ptr [rip+loop_g]
+  mov r10, r8
+  add r10, r9
+  movsxd r10, r10d
+  mov r8, r10
+  add dword ptr [rip+loop_g], 2
+  mov r9, rsi
+  add r9, 1
+  movsxd r9, r9d
+  mov rsi, r9
+  cmp rsi, rdi
+  jl .L.begin.count_stored.4
+.L.break.count_stored.3:
+  mov rax, r8
+.L.return.count_stored:
+  ret
+.text
+.p2align 4
+.global sum_through
+sum_through:
+  movsxd rsi, esi
+  mov r9, 0
+  mov r8, 0
+  cmp r8, rsi
+  jge .L.break.sum_through.3
+  .p2align 4,,10
+.L.begin.sum_through.4:
+  movsxd r10, dword ptr [rip+loop_g]
+  mov r11, r9
+  add r11, r10
+  movsxd r11, r11d
+  mov r9, r11
+  add dword ptr [rdi], 1
+  mov r10, r8
+  add r10, 1
+  movsxd r10, r10d
+  mov r8, r10
+  cmp r8, rsi
+  jl .L.begin.sum_through.4
+.L.break.sum_through.3:
+  mov rax, r9
+.L.return.sum_through:
+  ret
+.text
+.p2align 4
+.global sum_local_through
+sum_local_through:
+  movsxd rdi, edi
+  mov dword ptr [rsp-4], 1
+  lea r10, [rsp-4]
+  mov r9, 0
+  mov r8, 0
+  cmp r8, rdi
+  jge .L.break.sum_local_through.3
+  .p2align 4,,10
+.L.begin.sum_local_through.4:
+  movsxd r11, dword ptr [rsp-4]
+  mov rcx, r9
+  add rcx, r11
+  movsxd rcx, ecx
+  mov r9, rcx
+  mov rsi, r10
+  add dword ptr [rsi], 1
+  mov r11, r8
+  add r11, 1
+  movsxd r11, r11d
+  mov r8, r11
+  cmp r8, rdi
+  jl .L.begin.sum_local_through.4
+.L.break.sum_local_through.3:
+  mov rax, r9
+.L.return.sum_local_through:
+  ret
+.text
+.p2align 4
+.global sum_deref
+sum_deref:
+  movsxd rsi, esi
+  mov r9, 0
+  mov r8, 0
+  cmp r8, rsi
+  jge .L.break.sum_deref.3
+  .p2align 4,,10
+.L.begin.sum_deref.4:
+  movsxd r10, dword ptr [rdi]
+  mov r11, r9
+  add r11, r10
+  movsxd r11, r11d
+  mov r9, r11
+  mov r10, r8
+  add r10, 1
+  movsxd r10, r10d
+  mov r8, r10
+  cmp r8, rsi
+  jl .L.begin.sum_deref.4
+.L.break.sum_deref.3:
+  mov rax, r9
+.L.return.sum_deref:
+  ret
+.text
+.p2align 4
+.global twice
+twice:
+  movsxd rdi, edi
+  mov rsi, rdi
+  add rsi, rdi
+  mov rax, rsi
+.L.return.twice:
+  ret
+.text
+.p2align 4
+.global ret_none
+ret_none:
+.L.return.ret_none:
+  ret
+.text
+.p2align 4
+static_fn:
+  mov rax, 3
+.L.return.static_fn:
+  ret
+.text
+.p2align 4
+.global param_decay
+param_decay:
+  mov rsi, rdi
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov rax, rsi
+.L.return.param_decay:
+  ret
+.text
+.p2align 4
+.global voidfn
+voidfn:
+.L.return.voidfn:
+  ret
+.bss
+.align 4
+.L.data.counter.0:
+  .zero 4
+.data
+.align 4
+.L.data.counter.1:
+  .4byte 2
+.text
+.p2align 4
+.global counter
+counter:
+  movsxd rsi, dword ptr [rip+.L.data.counter.0]
+  add rsi, 1
+  mov dword ptr [rip+.L.data.counter.0], esi
+  sub rsi, 1
+  movsxd rdi, dword ptr [rip+.L.data.counter.1]
+  add rdi, 1
+  mov dword ptr [rip+.L.data.counter.1], edi
+  sub rdi, 1
+  add rsi, rdi
+  mov rax, rsi
+.L.return.counter:
+  ret
+.text
+.p2align 4
+.global fmt
+fmt:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov qword ptr [rbp-88], rbx
+  mov qword ptr [rbp-96], r12
+  mov dword ptr [rbp-8], 16
+  mov qword ptr [rbp-16], r9
+  mov qword ptr [rbp-24], r8
+  mov qword ptr [rbp-32], rcx
+  mov qword ptr [rbp-40], rdx
+  mov qword ptr [rbp-48], rsi
+  mov qword ptr [rbp-56], rdi
+  mov r12, rdi
+  mov rbx, rsi
+  lea rsi, [rbp-80]
+  mov edi, dword ptr [rbp-8]
+  mov dword ptr [rsi], edi
+  mov dword ptr [rsi+4], 48
+  lea rdi, [rbp+16]
+  mov qword ptr [rsi+8], rdi
+  lea rdi, [rbp-56]
+  mov qword ptr [rsi+16], rdi
+  lea r8, [rbp-80]
+  mov rdi, r12
+  mov rsi, rbx
+  mov rdx, r8
+  mov rax, 0
+  call vsprintf
+  mov rax, r12
+.L.return.fmt:
+  mov rbx, qword ptr [rbp-88]
+  mov r12, qword ptr [rbp-96]
+  mov rsp, rbp
+  pop rbp
+  ret
+.bss
+.data
+.align 1
+.L.data.main.641:
+  .byte 79
+  .byte 75
+  .byte 10
+  .byte 0
+.align 1
+.L.data.main.640:
+  .byte 49
+  .byte 76
+  .byte 32
+  .byte 60
+  .byte 60
+  .byte 32
+  .byte 51
+  .byte 50
+  .byte 0
+.align 1
+.L.data.main.639:
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 56
+  .byte 0
+.align 1
+.L.data.main.638:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 56
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.637:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 55
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.636:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 98
+  .byte 48
+  .byte 76
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.635:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 120
+  .byte 48
+  .byte 76
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.634:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 108
+  .byte 108
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.633:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 108
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.632:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 76
+  .byte 76
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.631:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 76
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.630:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.629:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.628:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.627:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.626:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.625:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.624:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.623:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.622:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.621:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.620:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.619:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.618:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.617:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.616:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.615:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.614:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.613:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.612:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.611:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 117
+  .byte 102
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 109
+  .byte 116
+  .byte 40
+  .byte 98
+  .byte 117
+  .byte 102
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 34
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 52
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 34
+  .byte 49
+  .byte 32
+  .byte 50
+  .byte 32
+  .byte 51
+  .byte 32
+  .byte 52
+  .byte 34
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 117
+  .byte 102
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.610:
+  .byte 49
+  .byte 32
+  .byte 50
+  .byte 32
+  .byte 51
+  .byte 32
+  .byte 52
+  .byte 0
+.align 1
+.L.data.main.609:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 0
+.align 1
+.L.data.main.608:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 117
+  .byte 102
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 109
+  .byte 116
+  .byte 40
+  .byte 98
+  .byte 117
+  .byte 102
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 34
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 34
+  .byte 49
+  .byte 32
+  .byte 50
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 117
+  .byte 102
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.607:
+  .byte 49
+  .byte 32
+  .byte 50
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 0
+.align 1
+.L.data.main.606:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 0
+.align 1
+.L.data.main.605:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 0
+.align 1
+.L.data.main.604:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 95
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 51
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 45
+  .byte 49
+  .byte 44
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.603:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 95
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 51
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.602:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 95
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 49
+  .byte 40
+  .byte 115
+  .byte 116
+  .byte 97
+  .byte 99
+  .byte 107
+  .byte 95
+  .byte 109
+  .byte 105
+  .byte 115
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 109
+  .byte 101
+  .byte 110
+  .byte 116
+  .byte 40
+  .byte 41
+  .byte 44
+  .byte 32
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 95
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 49
+  .byte 40
+  .byte 115
+  .byte 116
+  .byte 97
+  .byte 99
+  .byte 107
+  .byte 95
+  .byte 109
+  .byte 105
+  .byte 115
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 109
+  .byte 101
+  .byte 110
+  .byte 116
+  .byte 40
+  .byte 41
+  .byte 44
+  .byte 32
+  .byte 48
+  .byte 41
+  .byte 44
+  .byte 32
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.601:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 97
+  .byte 99
+  .byte 107
+  .byte 95
+  .byte 109
+  .byte 105
+  .byte 115
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 109
+  .byte 101
+  .byte 110
+  .byte 116
+  .byte 40
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.600:
+  .byte 115
+  .byte 116
+  .byte 97
+  .byte 99
+  .byte 107
+  .byte 95
+  .byte 109
+  .byte 105
+  .byte 115
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 109
+  .byte 101
+  .byte 110
+  .byte 116
+  .byte 40
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.599:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 95
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 49
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 45
+  .byte 49
+  .byte 44
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.598:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 95
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 49
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.597:
+  .byte 102
+  .byte 97
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 95
+  .byte 102
+  .byte 110
+  .byte 40
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.596:
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 101
+  .byte 95
+  .byte 102
+  .byte 110
+  .byte 40
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.595:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 107
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 111
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 32
+  .byte 62
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 107
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.594:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 111
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 32
+  .byte 60
+  .byte 32
+  .byte 54
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.593:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 49
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 94
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.592:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 124
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.591:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 38
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.590:
+  .byte 101
+  .byte 120
+  .byte 116
+  .byte 51
+  .byte 0
+.align 1
+.L.data.main.589:
+  .byte 116
+  .byte 114
+  .byte 101
+  .byte 101
+  .byte 45
+  .byte 62
+  .byte 108
+  .byte 104
+  .byte 115
+  .byte 45
+  .byte 62
+  .byte 114
+  .byte 104
+  .byte 115
+  .byte 45
+  .byte 62
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 0
+.align 1
+.L.data.main.588:
+  .byte 116
+  .byte 114
+  .byte 101
+  .byte 101
+  .byte 45
+  .byte 62
+  .byte 108
+  .byte 104
+  .byte 115
+  .byte 45
+  .byte 62
+  .byte 108
+  .byte 104
+  .byte 115
+  .byte 45
+  .byte 62
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 0
+.align 1
+.L.data.main.587:
+  .byte 116
+  .byte 114
+  .byte 101
+  .byte 101
+  .byte 45
+  .byte 62
+  .byte 108
+  .byte 104
+  .byte 115
+  .byte 45
+  .byte 62
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 0
+.align 1
+.L.data.main.586:
+  .byte 116
+  .byte 114
+  .byte 101
+  .byte 101
+  .byte 45
+  .byte 62
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 0
+.align 1
+.L.data.main.585:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 123
+  .byte 120
+  .byte 125
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.583:
+  .byte 40
+  .byte 40
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 41
+  .byte 123
+  .byte 39
+  .byte 97
+  .byte 39
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 125
+  .byte 41
+  .byte 46
+  .byte 97
+  .byte 0
+.align 1
+.L.data.main.581:
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 91
+  .byte 93
+  .byte 41
+  .byte 123
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.579:
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 123
+  .byte 49
+  .byte 125
+  .byte 0
+.align 1
+.L.data.main.577:
+  .byte 99
+  .byte 111
+  .byte 117
+  .byte 110
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 40
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.576:
+  .byte 99
+  .byte 111
+  .byte 117
+  .byte 110
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 40
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.575:
+  .byte 99
+  .byte 111
+  .byte 117
+  .byte 110
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 40
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.574:
+  .byte 95
+  .byte 65
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.573:
+  .byte 95
+  .byte 65
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.572:
+  .byte 95
+  .byte 65
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.571:
+  .byte 95
+  .byte 65
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.570:
+  .byte 95
+  .byte 65
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.569:
+  .byte 95
+  .byte 65
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.568:
+  .byte 95
+  .byte 65
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.567:
+  .byte 95
+  .byte 65
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.566:
+  .byte 95
+  .byte 65
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.565:
+  .byte 42
+  .byte 101
+  .byte 120
+  .byte 116
+  .byte 50
+  .byte 0
+.align 1
+.L.data.main.564:
+  .byte 101
+  .byte 120
+  .byte 116
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.563:
+  .byte 42
+  .byte 103
+  .byte 50
+  .byte 55
+  .byte 0
+.align 1
+.L.data.main.562:
+  .byte 42
+  .byte 103
+  .byte 50
+  .byte 53
+  .byte 0
+.align 1
+.L.data.main.561:
+  .byte 103
+  .byte 50
+  .byte 52
+  .byte 0
+.align 1
+.L.data.main.560:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 50
+  .byte 51
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 43
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.559:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.align 1
+.L.data.main.558:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 50
+  .byte 51
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.557:
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.align 1
+.L.data.main.556:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 50
+  .byte 51
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.555:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.align 1
+.L.data.main.554:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 50
+  .byte 50
+  .byte 43
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.553:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.align 1
+.L.data.main.552:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 50
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.551:
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.align 1
+.L.data.main.550:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 50
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.549:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.align 1
+.L.data.main.548:
+  .byte 109
+  .byte 101
+  .byte 109
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 57
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.547:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 0
+.align 1
+.L.data.main.546:
+  .byte 109
+  .byte 101
+  .byte 109
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 56
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 92
+  .byte 48
+  .byte 92
+  .byte 48
+  .byte 92
+  .byte 48
+  .byte 34
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.545:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+.align 1
+.L.data.main.544:
+  .byte 109
+  .byte 101
+  .byte 109
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 55
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 44
+  .byte 32
+  .byte 55
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.543:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.align 1
+.L.data.main.542:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 57
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.541:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 56
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.540:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 55
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.539:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 54
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.538:
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.align 1
+.L.data.main.537:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 54
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.536:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 0
+.align 1
+.L.data.main.535:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.534:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 0
+.align 1
+.L.data.main.533:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.532:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.531:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.530:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.529:
+  .byte 103
+  .byte 49
+  .byte 52
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.528:
+  .byte 103
+  .byte 49
+  .byte 52
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.527:
+  .byte 103
+  .byte 49
+  .byte 52
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.526:
+  .byte 103
+  .byte 49
+  .byte 52
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.525:
+  .byte 103
+  .byte 49
+  .byte 51
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.524:
+  .byte 103
+  .byte 49
+  .byte 51
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.523:
+  .byte 103
+  .byte 49
+  .byte 51
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.522:
+  .byte 103
+  .byte 49
+  .byte 51
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.521:
+  .byte 103
+  .byte 49
+  .byte 50
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.520:
+  .byte 103
+  .byte 49
+  .byte 50
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.519:
+  .byte 103
+  .byte 49
+  .byte 50
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.518:
+  .byte 103
+  .byte 49
+  .byte 50
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.517:
+  .byte 103
+  .byte 49
+  .byte 49
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 0
+.align 1
+.L.data.main.516:
+  .byte 103
+  .byte 49
+  .byte 49
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 0
+.align 1
+.L.data.main.515:
+  .byte 103
+  .byte 49
+  .byte 49
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 0
+.align 1
+.L.data.main.514:
+  .byte 103
+  .byte 49
+  .byte 49
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 0
+.align 1
+.L.data.main.513:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 47
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 42
+  .byte 103
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.512:
+  .byte 103
+  .byte 49
+  .byte 48
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.511:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 48
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.510:
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.align 1
+.L.data.main.509:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 48
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.508:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 0
+.align 1
+.L.data.main.507:
+  .byte 103
+  .byte 57
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.506:
+  .byte 103
+  .byte 57
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.505:
+  .byte 103
+  .byte 57
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.504:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 56
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.503:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+.align 1
+.L.data.main.502:
+  .byte 42
+  .byte 103
+  .byte 55
+  .byte 0
+.align 1
+.L.data.main.501:
+  .byte 103
+  .byte 54
+  .byte 0
+.align 1
+.L.data.main.500:
+  .byte 103
+  .byte 53
+  .byte 0
+.align 1
+.L.data.main.499:
+  .byte 103
+  .byte 52
+  .byte 0
+.align 1
+.L.data.main.498:
+  .byte 103
+  .byte 51
+  .byte 0
+.align 1
+.L.data.main.497:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.496:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.495:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.494:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.493:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.492:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.491:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.490:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 99
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.489:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.488:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.487:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 99
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.486:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.485:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.484:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 0
+.align 1
+.L.data.main.483:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.482:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.481:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 44
+  .byte 34
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 34
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 0
+.align 1
+.L.data.main.480:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 44
+  .byte 34
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 34
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 0
+.align 1
+.L.data.main.479:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 44
+  .byte 34
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 34
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 0
+.align 1
+.L.data.main.478:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 44
+  .byte 34
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 34
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 0
+.align 1
+.L.data.main.477:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 0
+.align 1
+.L.data.main.476:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 0
+.align 1
+.L.data.main.475:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 0
+.align 1
+.L.data.main.474:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.473:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.472:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.471:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.470:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.469:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.468:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.467:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.466:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.465:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.464:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.463:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.462:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.461:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 63
+  .byte 50
+  .byte 58
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.460:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 63
+  .byte 50
+  .byte 58
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.459:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 43
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.458:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 52
+  .byte 50
+  .byte 57
+  .byte 52
+  .byte 57
+  .byte 54
+  .byte 55
+  .byte 50
+  .byte 57
+  .byte 56
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 32
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 51
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 52
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 53
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 97
+  .byte 117
+  .byte 108
+  .byte 116
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 115
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.457:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 53
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 51
+  .byte 58
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 52
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 52
+  .byte 48
+  .byte 58
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 52
+  .byte 49
+  .byte 58
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 52
+  .byte 50
+  .byte 58
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 52
+  .byte 51
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 48
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 115
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.456:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 48
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 56
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 48
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 49
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 51
+  .byte 48
+  .byte 48
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 51
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 53
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 54
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 97
+  .byte 117
+  .byte 108
+  .byte 116
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 115
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.455:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 45
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 45
+  .byte 53
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 45
+  .byte 53
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 45
+  .byte 52
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 45
+  .byte 50
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 45
+  .byte 49
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 56
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 115
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.454:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 45
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 52
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 56
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 53
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 49
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 55
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 51
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 97
+  .byte 117
+  .byte 108
+  .byte 116
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 115
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.453:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 53
+  .byte 45
+  .byte 50
+  .byte 43
+  .byte 48
+  .byte 42
+  .byte 51
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.452:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 116
+  .byte 101
+  .byte 110
+  .byte 61
+  .byte 49
+  .byte 43
+  .byte 50
+  .byte 43
+  .byte 51
+  .byte 43
+  .byte 52
+  .byte 44
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 101
+  .byte 110
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.451:
+  .byte 48
+  .byte 63
+  .byte 49
+  .byte 58
+  .byte 50
+  .byte 0
+.align 1
+.L.data.main.450:
+  .byte 48
+  .byte 63
+  .byte 49
+  .byte 58
+  .byte 50
+  .byte 0
+.align 1
+.L.data.main.449:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 62
+  .byte 62
+  .byte 49
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.448:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 45
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.447:
+  .byte 45
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.446:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 62
+  .byte 62
+  .byte 49
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.445:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 60
+  .byte 49
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.444:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 60
+  .byte 51
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.443:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 60
+  .byte 48
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.442:
+  .byte 45
+  .byte 49
+  .byte 62
+  .byte 62
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.441:
+  .byte 53
+  .byte 62
+  .byte 62
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.440:
+  .byte 53
+  .byte 60
+  .byte 60
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.439:
+  .byte 49
+  .byte 60
+  .byte 60
+  .byte 51
+  .byte 0
+.align 1
+.L.data.main.438:
+  .byte 49
+  .byte 60
+  .byte 60
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.437:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.436:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.435:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 97
+  .byte 117
+  .byte 108
+  .byte 116
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.434:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 97
+  .byte 117
+  .byte 108
+  .byte 116
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.433:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.432:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 50
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.431:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.430:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.429:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 111
+  .byte 32
+  .byte 103
+  .byte 59
+  .byte 32
+  .byte 104
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.428:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 111
+  .byte 32
+  .byte 100
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.427:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 111
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.426:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 60
+  .byte 50
+  .byte 48
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 105
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 49
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 105
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 50
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 105
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 51
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 105
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 52
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 105
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 53
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 105
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 54
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 105
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 55
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.425:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 111
+  .byte 32
+  .byte 109
+  .byte 59
+  .byte 32
+  .byte 109
+  .byte 58
+  .byte 32
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.424:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 111
+  .byte 32
+  .byte 108
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 58
+  .byte 32
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 62
+  .byte 53
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.423:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 111
+  .byte 32
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 107
+  .byte 58
+  .byte 32
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.422:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 110
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 110
+  .byte 43
+  .byte 43
+  .byte 44
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 61
+  .byte 61
+  .byte 50
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 110
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.421:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 110
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 110
+  .byte 43
+  .byte 43
+  .byte 44
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 110
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.420:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 62
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.419:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 40
+  .byte 33
+  .byte 105
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.418:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 62
+  .byte 53
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.417:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 62
+  .byte 53
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.416:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 40
+  .byte 59
+  .byte 33
+  .byte 105
+  .byte 59
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 59
+  .byte 106
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.415:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 59
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 62
+  .byte 53
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.414:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 59
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 62
+  .byte 53
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.413:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 32
+  .byte 61
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.412:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 40
+  .byte 59
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 32
+  .byte 61
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.411:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 32
+  .byte 61
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.410:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 40
+  .byte 59
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 32
+  .byte 61
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.409:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 42
+  .byte 110
+  .byte 101
+  .byte 120
+  .byte 116
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 46
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 46
+  .byte 110
+  .byte 101
+  .byte 120
+  .byte 116
+  .byte 61
+  .byte 38
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 46
+  .byte 110
+  .byte 101
+  .byte 120
+  .byte 116
+  .byte 45
+  .byte 62
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.408:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 42
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.407:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.406:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 57
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 38
+  .byte 120
+  .byte 91
+  .byte 56
+  .byte 93
+  .byte 45
+  .byte 38
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.405:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 49
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.404:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.403:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 55
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.402:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 54
+  .byte 52
+  .byte 49
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.401:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.400:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 55
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.399:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.398:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 51
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.397:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 56
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.396:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 50
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.395:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.394:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 91
+  .byte 106
+  .byte 93
+  .byte 61
+  .byte 105
+  .byte 42
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 97
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 91
+  .byte 106
+  .byte 93
+  .byte 43
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 45
+  .byte 105
+  .byte 93
+  .byte 91
+  .byte 106
+  .byte 93
+  .byte 47
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.393:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 38
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 45
+  .byte 38
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.392:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 38
+  .byte 97
+  .byte 91
+  .byte 55
+  .byte 93
+  .byte 45
+  .byte 38
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.391:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.390:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 45
+  .byte 51
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.389:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 52
+  .byte 48
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.388:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 49
+  .byte 50
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.387:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 57
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 57
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.386:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 53
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.385:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 51
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.384:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 51
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 60
+  .byte 45
+  .byte 50
+  .byte 57
+  .byte 57
+  .byte 57
+  .byte 57
+  .byte 57
+  .byte 57
+  .byte 57
+  .byte 57
+  .byte 57
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.383:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 50
+  .byte 60
+  .byte 105
+  .byte 32
+  .byte 63
+  .byte 32
+  .byte 55
+  .byte 32
+  .byte 58
+  .byte 32
+  .byte 56
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.382:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 50
+  .byte 60
+  .byte 105
+  .byte 32
+  .byte 63
+  .byte 32
+  .byte 55
+  .byte 32
+  .byte 58
+  .byte 32
+  .byte 56
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.381:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 111
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 33
+  .byte 40
+  .byte 105
+  .byte 61
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.380:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 33
+  .byte 40
+  .byte 105
+  .byte 62
+  .byte 61
+  .byte 53
+  .byte 41
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.379:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 33
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.378:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.377:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 33
+  .byte 40
+  .byte 105
+  .byte 60
+  .byte 50
+  .byte 32
+  .byte 124
+  .byte 124
+  .byte 32
+  .byte 53
+  .byte 60
+  .byte 61
+  .byte 105
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 105
+  .byte 33
+  .byte 61
+  .byte 57
+  .byte 41
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.376:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 62
+  .byte 54
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 33
+  .byte 40
+  .byte 105
+  .byte 61
+  .byte 61
+  .byte 56
+  .byte 41
+  .byte 32
+  .byte 124
+  .byte 124
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 61
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.375:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 56
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 62
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 55
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.374:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 43
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 42
+  .byte 41
+  .byte 112
+  .byte 45
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 42
+  .byte 41
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.373:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 112
+  .byte 43
+  .byte 51
+  .byte 41
+  .byte 45
+  .byte 120
+  .byte 61
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.372:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.371:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 50
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.370:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 52
+  .byte 50
+  .byte 57
+  .byte 52
+  .byte 57
+  .byte 54
+  .byte 55
+  .byte 50
+  .byte 57
+  .byte 54
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.369:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 94
+  .byte 45
+  .byte 55
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.368:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 38
+  .byte 50
+  .byte 53
+  .byte 53
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.367:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 60
+  .byte 60
+  .byte 49
+  .byte 50
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.366:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 120
+  .byte 62
+  .byte 62
+  .byte 55
+  .byte 48
+  .byte 41
+  .byte 61
+  .byte 61
+  .byte 45
+  .byte 49
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.365:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 43
+  .byte 61
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.364:
+  .byte 103
+  .byte 49
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 49
+  .byte 60
+  .byte 60
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 49
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.363:
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 45
+  .byte 61
+  .byte 50
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.362:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 43
+  .byte 61
+  .byte 50
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.361:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 50
+  .byte 57
+  .byte 52
+  .byte 57
+  .byte 54
+  .byte 55
+  .byte 50
+  .byte 57
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.360:
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 55
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.359:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.358:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 97
+  .byte 114
+  .byte 97
+  .byte 109
+  .byte 95
+  .byte 100
+  .byte 101
+  .byte 99
+  .byte 97
+  .byte 121
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.357:
+  .byte 49
+  .byte 38
+  .byte 38
+  .byte 53
+  .byte 0
+.align 1
+.L.data.main.356:
+  .byte 40
+  .byte 50
+  .byte 45
+  .byte 50
+  .byte 41
+  .byte 38
+  .byte 38
+  .byte 53
+  .byte 0
+.align 1
+.L.data.main.355:
+  .byte 48
+  .byte 38
+  .byte 38
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.354:
+  .byte 48
+  .byte 124
+  .byte 124
+  .byte 40
+  .byte 50
+  .byte 45
+  .byte 50
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.353:
+  .byte 48
+  .byte 124
+  .byte 124
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.352:
+  .byte 48
+  .byte 124
+  .byte 124
+  .byte 40
+  .byte 50
+  .byte 45
+  .byte 50
+  .byte 41
+  .byte 124
+  .byte 124
+  .byte 53
+  .byte 0
+.align 1
+.L.data.main.351:
+  .byte 48
+  .byte 124
+  .byte 124
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.350:
+  .byte 48
+  .byte 98
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 94
+  .byte 48
+  .byte 98
+  .byte 48
+  .byte 48
+  .byte 49
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.349:
+  .byte 48
+  .byte 98
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 94
+  .byte 48
+  .byte 98
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.348:
+  .byte 48
+  .byte 94
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.347:
+  .byte 48
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 124
+  .byte 48
+  .byte 98
+  .byte 48
+  .byte 48
+  .byte 49
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.346:
+  .byte 48
+  .byte 124
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.345:
+  .byte 32
+  .byte 45
+  .byte 49
+  .byte 38
+  .byte 49
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.344:
+  .byte 55
+  .byte 38
+  .byte 51
+  .byte 0
+.align 1
+.L.data.main.343:
+  .byte 51
+  .byte 38
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.342:
+  .byte 48
+  .byte 38
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.341:
+  .byte 126
+  .byte 45
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.340:
+  .byte 126
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.339:
+  .byte 33
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.338:
+  .byte 33
+  .byte 50
+  .byte 0
+.align 1
+.L.data.main.337:
+  .byte 33
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.336:
+  .byte 48
+  .byte 66
+  .byte 49
+  .byte 48
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.335:
+  .byte 48
+  .byte 98
+  .byte 49
+  .byte 48
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.334:
+  .byte 48
+  .byte 98
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.333:
+  .byte 48
+  .byte 98
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.332:
+  .byte 48
+  .byte 88
+  .byte 66
+  .byte 69
+  .byte 69
+  .byte 70
+  .byte 0
+.align 1
+.L.data.main.331:
+  .byte 48
+  .byte 120
+  .byte 66
+  .byte 69
+  .byte 69
+  .byte 70
+  .byte 0
+.align 1
+.L.data.main.330:
+  .byte 48
+  .byte 120
+  .byte 98
+  .byte 101
+  .byte 101
+  .byte 102
+  .byte 0
+.align 1
+.L.data.main.329:
+  .byte 48
+  .byte 88
+  .byte 65
+  .byte 0
+.align 1
+.L.data.main.328:
+  .byte 48
+  .byte 120
+  .byte 97
+  .byte 0
+.align 1
+.L.data.main.327:
+  .byte 48
+  .byte 120
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.326:
+  .byte 48
+  .byte 55
+  .byte 55
+  .byte 55
+  .byte 0
+.align 1
+.L.data.main.325:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 47
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.324:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 47
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.323:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 42
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.322:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 42
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.321:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 45
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.320:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 45
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.319:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.318:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.317:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.316:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.315:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.314:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.313:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 45
+  .byte 45
+  .byte 42
+  .byte 112
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.312:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.311:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 43
+  .byte 43
+  .byte 42
+  .byte 112
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.310:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.309:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.308:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.307:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.306:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.305:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 45
+  .byte 45
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.304:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 43
+  .byte 43
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.303:
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.302:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 106
+  .byte 43
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.301:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 106
+  .byte 43
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.300:
+  .byte 115
+  .byte 116
+  .byte 97
+  .byte 116
+  .byte 105
+  .byte 99
+  .byte 95
+  .byte 102
+  .byte 110
+  .byte 40
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.299:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 111
+  .byte 110
+  .byte 101
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 119
+  .byte 111
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 121
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.298:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 111
+  .byte 110
+  .byte 101
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 119
+  .byte 111
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.297:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 102
+  .byte 105
+  .byte 118
+  .byte 101
+  .byte 61
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 104
+  .byte 114
+  .byte 101
+  .byte 101
+  .byte 61
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 117
+  .byte 114
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 117
+  .byte 114
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.296:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 102
+  .byte 105
+  .byte 118
+  .byte 101
+  .byte 61
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 104
+  .byte 114
+  .byte 101
+  .byte 101
+  .byte 61
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 117
+  .byte 114
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 104
+  .byte 114
+  .byte 101
+  .byte 101
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.295:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 102
+  .byte 105
+  .byte 118
+  .byte 101
+  .byte 61
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 104
+  .byte 114
+  .byte 101
+  .byte 101
+  .byte 61
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 117
+  .byte 114
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 105
+  .byte 118
+  .byte 101
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.294:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 102
+  .byte 105
+  .byte 118
+  .byte 101
+  .byte 61
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 104
+  .byte 114
+  .byte 101
+  .byte 101
+  .byte 61
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 117
+  .byte 114
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.293:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 102
+  .byte 105
+  .byte 118
+  .byte 101
+  .byte 61
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 115
+  .byte 101
+  .byte 118
+  .byte 101
+  .byte 110
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.292:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 102
+  .byte 105
+  .byte 118
+  .byte 101
+  .byte 61
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 115
+  .byte 101
+  .byte 118
+  .byte 101
+  .byte 110
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 105
+  .byte 118
+  .byte 101
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.291:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 111
+  .byte 110
+  .byte 101
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 119
+  .byte 111
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 119
+  .byte 111
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.290:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 111
+  .byte 110
+  .byte 101
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 119
+  .byte 111
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 111
+  .byte 110
+  .byte 101
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.289:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 111
+  .byte 110
+  .byte 101
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 119
+  .byte 111
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.288:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 39
+  .byte 97
+  .byte 39
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.287:
+  .byte 39
+  .byte 97
+  .byte 39
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.286:
+  .byte 39
+  .byte 92
+  .byte 110
+  .byte 39
+  .byte 0
+.align 1
+.L.data.main.285:
+  .byte 39
+  .byte 97
+  .byte 39
+  .byte 0
+.align 1
+.L.data.main.284:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 42
+  .byte 41
+  .byte 121
+  .byte 0
+.align 1
+.L.data.main.283:
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 38
+  .byte 42
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 41
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.282:
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.281:
+  .byte 40
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 41
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 50
+  .byte 53
+  .byte 54
+  .byte 0
+.align 1
+.L.data.main.280:
+  .byte 40
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 41
+  .byte 50
+  .byte 0
+.align 1
+.L.data.main.279:
+  .byte 40
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 41
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.278:
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 56
+  .byte 53
+  .byte 57
+  .byte 48
+  .byte 48
+  .byte 54
+  .byte 54
+  .byte 49
+  .byte 55
+  .byte 55
+  .byte 0
+.align 1
+.L.data.main.277:
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 56
+  .byte 53
+  .byte 57
+  .byte 48
+  .byte 48
+  .byte 54
+  .byte 54
+  .byte 49
+  .byte 55
+  .byte 55
+  .byte 0
+.align 1
+.L.data.main.276:
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 56
+  .byte 53
+  .byte 57
+  .byte 48
+  .byte 48
+  .byte 54
+  .byte 54
+  .byte 49
+  .byte 55
+  .byte 55
+  .byte 0
+.align 1
+.L.data.main.275:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.274:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.273:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.272:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 40
+  .byte 42
+  .byte 41
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.271:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 40
+  .byte 42
+  .byte 41
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.270:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.269:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 42
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.268:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.267:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.266:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.265:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.264:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.263:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.262:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.261:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.260:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.259:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.258:
+  .byte 77
+  .byte 121
+  .byte 73
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.257:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.256:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.255:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.254:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.253:
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 116
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.252:
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 116
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.251:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.250:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.249:
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.248:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.247:
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 38
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.246:
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.245:
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.244:
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.243:
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.242:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 99
+  .byte 99
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 118
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 60
+  .byte 52
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 99
+  .byte 99
+  .byte 43
+  .byte 61
+  .byte 43
+  .byte 43
+  .byte 118
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 99
+  .byte 99
+  .byte 42
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 97
+  .byte 99
+  .byte 99
+  .byte 43
+  .byte 105
+  .byte 42
+  .byte 48
+  .byte 43
+  .byte 57
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.241:
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 43
+  .byte 43
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.240:
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 40
+  .byte 98
+  .byte 61
+  .byte 55
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.239:
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 43
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.238:
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.237:
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.236:
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.235:
+  .byte 42
+  .byte 103
+  .byte 49
+  .byte 95
+  .byte 112
+  .byte 116
+  .byte 114
+  .byte 40
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.234:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 121
+  .byte 41
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.233:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.232:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 120
+  .byte 41
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.231:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.230:
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 95
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 40
+  .byte 55
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.229:
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 95
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 40
+  .byte 55
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.228:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 98
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.227:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.226:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.225:
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.224:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 121
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.223:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 121
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.222:
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 116
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.221:
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.220:
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 116
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.219:
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.218:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 45
+  .byte 62
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.217:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 45
+  .byte 62
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.216:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 46
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 43
+  .byte 121
+  .byte 46
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.215:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 121
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.214:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 45
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.213:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 45
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.212:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.211:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.210:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.209:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 125
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.208:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.207:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.206:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.205:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.204:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.203:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.202:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.201:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.200:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.199:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.198:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.197:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 99
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 99
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.196:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.195:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 99
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.194:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.193:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.192:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 45
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.191:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.190:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.189:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.188:
+  .byte 34
+  .byte 92
+  .byte 108
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.187:
+  .byte 108
+  .byte 0
+.align 1
+.L.data.main.186:
+  .byte 34
+  .byte 92
+  .byte 107
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.185:
+  .byte 107
+  .byte 0
+.align 1
+.L.data.main.184:
+  .byte 34
+  .byte 92
+  .byte 106
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.183:
+  .byte 106
+  .byte 0
+.align 1
+.L.data.main.182:
+  .byte 34
+  .byte 92
+  .byte 48
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.181:
+  .byte 0
+  .byte 0
+.align 1
+.L.data.main.180:
+  .byte 34
+  .byte 92
+  .byte 101
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.179:
+  .byte 27
+  .byte 0
+.align 1
+.L.data.main.178:
+  .byte 34
+  .byte 92
+  .byte 114
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.177:
+  .byte 13
+  .byte 0
+.align 1
+.L.data.main.176:
+  .byte 34
+  .byte 92
+  .byte 102
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.175:
+  .byte 12
+  .byte 0
+.align 1
+.L.data.main.174:
+  .byte 34
+  .byte 92
+  .byte 118
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.173:
+  .byte 11
+  .byte 0
+.align 1
+.L.data.main.172:
+  .byte 34
+  .byte 92
+  .byte 110
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.171:
+  .byte 10
+  .byte 0
+.align 1
+.L.data.main.170:
+  .byte 34
+  .byte 92
+  .byte 116
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.169:
+  .byte 9
+  .byte 0
+.align 1
+.L.data.main.168:
+  .byte 34
+  .byte 92
+  .byte 98
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.167:
+  .byte 8
+  .byte 0
+.align 1
+.L.data.main.166:
+  .byte 34
+  .byte 92
+  .byte 97
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.165:
+  .byte 7
+  .byte 0
+.align 1
+.L.data.main.164:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.163:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+.align 1
+.L.data.main.162:
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.161:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+.align 1
+.L.data.main.160:
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.159:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+.align 1
+.L.data.main.158:
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.157:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+.align 1
+.L.data.main.156:
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.155:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+.align 1
+.L.data.main.154:
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 95
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 40
+  .byte 55
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.153:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.152:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.151:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.150:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.149:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.148:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 103
+  .byte 50
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.147:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.146:
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.145:
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.144:
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.143:
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.142:
+  .byte 103
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.141:
+  .byte 103
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.140:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 42
+  .byte 42
+  .byte 120
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.139:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 120
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.138:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 42
+  .byte 42
+  .byte 120
+  .byte 41
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.137:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 42
+  .byte 42
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.136:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 42
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.135:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.134:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.133:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.132:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.131:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.130:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 54
+  .byte 93
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.129:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.128:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.127:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.126:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.125:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.124:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.123:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 50
+  .byte 91
+  .byte 120
+  .byte 93
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.122:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.121:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.120:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.119:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.118:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 43
+  .byte 54
+  .byte 41
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.117:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 43
+  .byte 53
+  .byte 41
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.116:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 43
+  .byte 52
+  .byte 41
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.115:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 43
+  .byte 51
+  .byte 41
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.114:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 42
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.113:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 42
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.112:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.111:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.110:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.109:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.108:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.107:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 120
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 121
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.106:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 38
+  .byte 121
+  .byte 45
+  .byte 49
+  .byte 41
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.105:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.104:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.103:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 122
+  .byte 61
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 122
+  .byte 45
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.102:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 122
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 122
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.101:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 45
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.100:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 38
+  .byte 121
+  .byte 45
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.99:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 49
+  .byte 43
+  .byte 38
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.98:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.97:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 122
+  .byte 61
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 122
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.96:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.95:
+  .byte 116
+  .byte 119
+  .byte 105
+  .byte 99
+  .byte 101
+  .byte 40
+  .byte 116
+  .byte 119
+  .byte 105
+  .byte 99
+  .byte 101
+  .byte 40
+  .byte 116
+  .byte 119
+  .byte 105
+  .byte 99
+  .byte 101
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.94:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 116
+  .byte 119
+  .byte 105
+  .byte 99
+  .byte 101
+  .byte 40
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 42
+  .byte 49
+  .byte 48
+  .byte 43
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.93:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 117
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 38
+  .byte 105
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 117
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 38
+  .byte 105
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.92:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 100
+  .byte 101
+  .byte 114
+  .byte 101
+  .byte 102
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.91:
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 100
+  .byte 101
+  .byte 114
+  .byte 101
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.90:
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 108
+  .byte 111
+  .byte 99
+  .byte 97
+  .byte 108
+  .byte 95
+  .byte 116
+  .byte 104
+  .byte 114
+  .byte 111
+  .byte 117
+  .byte 103
+  .byte 104
+  .byte 40
+  .byte 52
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.89:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 111
+  .byte 112
+  .byte 95
+  .byte 103
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 116
+  .byte 104
+  .byte 114
+  .byte 111
+  .byte 117
+  .byte 103
+  .byte 104
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 52
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.88:
+  .byte 108
+  .byte 111
+  .byte 111
+  .byte 112
+  .byte 95
+  .byte 103
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 116
+  .byte 104
+  .byte 114
+  .byte 111
+  .byte 117
+  .byte 103
+  .byte 104
+  .byte 40
+  .byte 38
+  .byte 108
+  .byte 111
+  .byte 111
+  .byte 112
+  .byte 95
+  .byte 103
+  .byte 44
+  .byte 32
+  .byte 52
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.87:
+  .byte 99
+  .byte 111
+  .byte 117
+  .byte 110
+  .byte 116
+  .byte 95
+  .byte 115
+  .byte 116
+  .byte 111
+  .byte 114
+  .byte 101
+  .byte 100
+  .byte 40
+  .byte 53
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.86:
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 103
+  .byte 114
+  .byte 105
+  .byte 100
+  .byte 40
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.85:
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 103
+  .byte 114
+  .byte 105
+  .byte 100
+  .byte 40
+  .byte 52
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.84:
+  .byte 115
+  .byte 107
+  .byte 105
+  .byte 112
+  .byte 95
+  .byte 116
+  .byte 111
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 43
+  .byte 115
+  .byte 107
+  .byte 105
+  .byte 112
+  .byte 95
+  .byte 116
+  .byte 111
+  .byte 40
+  .byte 56
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.83:
+  .byte 115
+  .byte 107
+  .byte 105
+  .byte 112
+  .byte 95
+  .byte 116
+  .byte 111
+  .byte 40
+  .byte 55
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.82:
+  .byte 115
+  .byte 107
+  .byte 105
+  .byte 112
+  .byte 95
+  .byte 116
+  .byte 111
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.81:
+  .byte 100
+  .byte 97
+  .byte 121
+  .byte 95
+  .byte 107
+  .byte 105
+  .byte 110
+  .byte 100
+  .byte 40
+  .byte 52
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.80:
+  .byte 100
+  .byte 97
+  .byte 121
+  .byte 95
+  .byte 107
+  .byte 105
+  .byte 110
+  .byte 100
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.79:
+  .byte 100
+  .byte 97
+  .byte 121
+  .byte 95
+  .byte 107
+  .byte 105
+  .byte 110
+  .byte 100
+  .byte 40
+  .byte 54
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.78:
+  .byte 100
+  .byte 97
+  .byte 121
+  .byte 95
+  .byte 107
+  .byte 105
+  .byte 110
+  .byte 100
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.77:
+  .byte 99
+  .byte 108
+  .byte 97
+  .byte 115
+  .byte 115
+  .byte 105
+  .byte 102
+  .byte 121
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 43
+  .byte 99
+  .byte 108
+  .byte 97
+  .byte 115
+  .byte 115
+  .byte 105
+  .byte 102
+  .byte 121
+  .byte 40
+  .byte 45
+  .byte 50
+  .byte 41
+  .byte 43
+  .byte 99
+  .byte 108
+  .byte 97
+  .byte 115
+  .byte 115
+  .byte 105
+  .byte 102
+  .byte 121
+  .byte 40
+  .byte 57
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.76:
+  .byte 99
+  .byte 108
+  .byte 97
+  .byte 115
+  .byte 115
+  .byte 105
+  .byte 102
+  .byte 121
+  .byte 40
+  .byte 55
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.75:
+  .byte 99
+  .byte 108
+  .byte 97
+  .byte 115
+  .byte 115
+  .byte 105
+  .byte 102
+  .byte 121
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.74:
+  .byte 99
+  .byte 108
+  .byte 97
+  .byte 115
+  .byte 115
+  .byte 105
+  .byte 102
+  .byte 121
+  .byte 40
+  .byte 45
+  .byte 53
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.73:
+  .byte 115
+  .byte 112
+  .byte 105
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 103
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 112
+  .byte 105
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 114
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 52
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.72:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 40
+  .byte 45
+  .byte 49
+  .byte 50
+  .byte 57
+  .byte 52
+  .byte 57
+  .byte 54
+  .byte 55
+  .byte 50
+  .byte 57
+  .byte 54
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.71:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 119
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 95
+  .byte 116
+  .byte 97
+  .byte 98
+  .byte 108
+  .byte 101
+  .byte 40
+  .byte 52
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.70:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 119
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 95
+  .byte 116
+  .byte 97
+  .byte 98
+  .byte 108
+  .byte 101
+  .byte 40
+  .byte 51
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 51
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.69:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 119
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 95
+  .byte 116
+  .byte 97
+  .byte 98
+  .byte 108
+  .byte 101
+  .byte 40
+  .byte 51
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 52
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.68:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 119
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 95
+  .byte 116
+  .byte 97
+  .byte 98
+  .byte 108
+  .byte 101
+  .byte 40
+  .byte 51
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.67:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 119
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 95
+  .byte 115
+  .byte 112
+  .byte 108
+  .byte 105
+  .byte 116
+  .byte 40
+  .byte 54
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.66:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 119
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 95
+  .byte 115
+  .byte 112
+  .byte 108
+  .byte 105
+  .byte 116
+  .byte 40
+  .byte 55
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.65:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 119
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 95
+  .byte 115
+  .byte 112
+  .byte 108
+  .byte 105
+  .byte 116
+  .byte 40
+  .byte 51
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.64:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 119
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 95
+  .byte 115
+  .byte 112
+  .byte 108
+  .byte 105
+  .byte 116
+  .byte 40
+  .byte 45
+  .byte 51
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.63:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 119
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 40
+  .byte 45
+  .byte 49
+  .byte 50
+  .byte 57
+  .byte 52
+  .byte 57
+  .byte 54
+  .byte 55
+  .byte 50
+  .byte 57
+  .byte 54
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.62:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 119
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 40
+  .byte 53
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.61:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 119
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 40
+  .byte 45
+  .byte 51
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.60:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 119
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 40
+  .byte 51
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.59:
+  .byte 98
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 95
+  .byte 105
+  .byte 110
+  .byte 99
+  .byte 95
+  .byte 108
+  .byte 111
+  .byte 111
+  .byte 112
+  .byte 40
+  .byte 34
+  .byte 92
+  .byte 48
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.58:
+  .byte 0
+  .byte 0
+.align 1
+.L.data.main.57:
+  .byte 98
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 95
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.56:
+  .byte 115
+  .byte 99
+  .byte 97
+  .byte 108
+  .byte 101
+  .byte 95
+  .byte 99
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 52
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.55:
+  .byte 109
+  .byte 105
+  .byte 120
+  .byte 95
+  .byte 112
+  .byte 97
+  .byte 114
+  .byte 97
+  .byte 109
+  .byte 115
+  .byte 40
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 52
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.54:
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 115
+  .byte 109
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 97
+  .byte 121
+  .byte 40
+  .byte 50
+  .byte 41
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 108
+  .byte 97
+  .byte 114
+  .byte 103
+  .byte 101
+  .byte 95
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 97
+  .byte 121
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.53:
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 108
+  .byte 97
+  .byte 114
+  .byte 103
+  .byte 101
+  .byte 95
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 97
+  .byte 121
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.52:
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 115
+  .byte 109
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 97
+  .byte 121
+  .byte 40
+  .byte 50
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.51:
+  .byte 105
+  .byte 110
+  .byte 99
+  .byte 95
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 40
+  .byte 49
+  .byte 50
+  .byte 55
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.50:
+  .byte 115
+  .byte 119
+  .byte 97
+  .byte 112
+  .byte 95
+  .byte 97
+  .byte 114
+  .byte 103
+  .byte 115
+  .byte 40
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.49:
+  .byte 114
+  .byte 111
+  .byte 116
+  .byte 97
+  .byte 116
+  .byte 101
+  .byte 54
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.48:
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 102
+  .byte 105
+  .byte 98
+  .byte 40
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.47:
+  .byte 102
+  .byte 105
+  .byte 98
+  .byte 40
+  .byte 57
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.46:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 41
+  .byte 41
+  .byte 42
+  .byte 40
+  .byte 52
+  .byte 43
+  .byte 40
+  .byte 53
+  .byte 42
+  .byte 40
+  .byte 54
+  .byte 43
+  .byte 40
+  .byte 55
+  .byte 42
+  .byte 40
+  .byte 56
+  .byte 43
+  .byte 40
+  .byte 57
+  .byte 42
+  .byte 40
+  .byte 49
+  .byte 48
+  .byte 43
+  .byte 40
+  .byte 49
+  .byte 49
+  .byte 42
+  .byte 40
+  .byte 49
+  .byte 50
+  .byte 43
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 54
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 41
+  .byte 47
+  .byte 40
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 49
+  .byte 52
+  .byte 44
+  .byte 49
+  .byte 53
+  .byte 41
+  .byte 45
+  .byte 49
+  .byte 51
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.45:
+  .byte 49
+  .byte 43
+  .byte 40
+  .byte 50
+  .byte 43
+  .byte 40
+  .byte 51
+  .byte 43
+  .byte 40
+  .byte 52
+  .byte 43
+  .byte 40
+  .byte 53
+  .byte 43
+  .byte 40
+  .byte 54
+  .byte 43
+  .byte 40
+  .byte 55
+  .byte 43
+  .byte 40
+  .byte 56
+  .byte 43
+  .byte 40
+  .byte 57
+  .byte 43
+  .byte 40
+  .byte 49
+  .byte 48
+  .byte 43
+  .byte 40
+  .byte 49
+  .byte 49
+  .byte 43
+  .byte 40
+  .byte 49
+  .byte 50
+  .byte 43
+  .byte 40
+  .byte 49
+  .byte 51
+  .byte 43
+  .byte 40
+  .byte 49
+  .byte 52
+  .byte 43
+  .byte 40
+  .byte 49
+  .byte 53
+  .byte 43
+  .byte 49
+  .byte 54
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.44:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 54
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.43:
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 40
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.42:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 40
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.41:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.40:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 40
+  .byte 105
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 106
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.39:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 40
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.38:
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 50
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.37:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 50
+  .byte 45
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.36:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.35:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 49
+  .byte 45
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.34:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.33:
+  .byte 114
+  .byte 101
+  .byte 116
+  .byte 51
+  .byte 40
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.32:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 43
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.31:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.30:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 122
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 43
+  .byte 122
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.29:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.28:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 122
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 122
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 43
+  .byte 122
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.27:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.26:
+  .byte 49
+  .byte 62
+  .byte 61
+  .byte 50
+  .byte 0
+.align 1
+.L.data.main.25:
+  .byte 49
+  .byte 62
+  .byte 61
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.24:
+  .byte 49
+  .byte 62
+  .byte 61
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.23:
+  .byte 49
+  .byte 62
+  .byte 50
+  .byte 0
+.align 1
+.L.data.main.22:
+  .byte 49
+  .byte 62
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.21:
+  .byte 49
+  .byte 62
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.20:
+  .byte 50
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.19:
+  .byte 49
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.18:
+  .byte 48
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.17:
+  .byte 50
+  .byte 60
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.16:
+  .byte 49
+  .byte 60
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.15:
+  .byte 48
+  .byte 60
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.14:
+  .byte 52
+  .byte 50
+  .byte 33
+  .byte 61
+  .byte 52
+  .byte 50
+  .byte 0
+.align 1
+.L.data.main.13:
+  .byte 48
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.12:
+  .byte 52
+  .byte 50
+  .byte 61
+  .byte 61
+  .byte 52
+  .byte 50
+  .byte 0
+.align 1
+.L.data.main.11:
+  .byte 48
+  .byte 61
+  .byte 61
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.10:
+  .byte 45
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 43
+  .byte 49
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.9:
+  .byte 45
+  .byte 32
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.8:
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.7:
+  .byte 40
+  .byte 51
+  .byte 43
+  .byte 53
+  .byte 41
+  .byte 47
+  .byte 50
+  .byte 0
+.align 1
+.L.data.main.6:
+  .byte 53
+  .byte 42
+  .byte 40
+  .byte 57
+  .byte 45
+  .byte 54
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.5:
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.4:
+  .byte 32
+  .byte 49
+  .byte 50
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 51
+  .byte 52
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 53
+  .byte 32
+  .byte 0
+.align 1
+.L.data.main.3:
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.2:
+  .byte 52
+  .byte 50
+  .byte 0
+.align 1
+.L.data.main.1:
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.0:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 122
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 43
+  .byte 122
+  .byte 59
+  .byte 0
+.text
+.p2align 4
+.global main
+main:
+  sub rsp, 19400
+  mov qword ptr [rsp+32], rbx
+  mov qword ptr [rsp+24], r12
+  mov qword ptr [rsp+16], r13
+  mov qword ptr [rsp+8], r14
+  mov qword ptr [rsp], r15
+  mov qword ptr [rsp+4248], 8
+  mov dword ptr [rsp+220], 3
+  mov dword ptr [rsp+224], 5
+  movsxd rsi, dword ptr [rsp+220]
+  movsxd rdi, dword ptr [rsp+224]
+  add rsi, rdi
+  mov qword ptr [rsp+4240], rsi
+  lea rsi, [rip+.L.data.main.0]
+  mov qword ptr [rsp+4232], rsi
+  mov rsi, qword ptr [rsp+4248]
+  cmp rsi, qword ptr [rsp+4240]
+  jne .L.else.main.2
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+4232]
+  mov r9, qword ptr [rsp+4240]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.3
+.L.else.main.2:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+4232]
+  mov r9, qword ptr [rsp+4248]
+  mov r10, qword ptr [rsp+4240]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.3:
+  mov qword ptr [rsp+4272], 0
+  mov qword ptr [rsp+4264], 0
+  lea rsi, [rip+.L.data.main.1]
+  mov qword ptr [rsp+4256], rsi
+  mov rsi, qword ptr [rsp+4272]
+  cmp rsi, qword ptr [rsp+4264]
+  jne .L.else.main.4
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+4256]
+  mov r9, qword ptr [rsp+4264]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.5
+.L.else.main.4:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+4256]
+  mov r9, qword ptr [rsp+4272]
+  mov r10, qword ptr [rsp+4264]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.5:
+  mov qword ptr [rsp+4296], 42
+  mov qword ptr [rsp+4288], 42
+  lea rsi, [rip+.L.data.main.2]
+  mov qword ptr [rsp+4280], rsi
+  mov rsi, qword ptr [rsp+4296]
+  cmp rsi, qword ptr [rsp+4288]
+  jne .L.else.main.6
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+4280]
+  mov r9, qword ptr [rsp+4288]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.7
+.L.else.main.6:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+4280]
+  mov r9, qword ptr [rsp+4296]
+  mov r10, qword ptr [rsp+4288]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.7:
+  mov qword ptr [rsp+4320], 5
+  mov qword ptr [rsp+4312], 5
+  lea rsi, [rip+.L.data.main.3]
+  mov qword ptr [rsp+4304], rsi
+  mov rsi, qword ptr [rsp+4320]
+  cmp rsi, qword ptr [rsp+4312]
+  jne .L.else.main.8
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+4304]
+  mov r9, qword ptr [rsp+4312]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.9
+.L.else.main.8:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+4304]
+  mov r9, qword ptr [rsp+4320]
+  mov r10, qword ptr [rsp+4312]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.9:
+  mov qword ptr [rsp+4344], 41
+  mov rsi, 12
+  add rsi, 34
+  sub rsi, 5
+  mov qword ptr [rsp+4336], rsi
+  lea rsi, [rip+.L.data.main.4]
+  mov qword ptr [rsp+4328], rsi
+  mov rsi, qword ptr [rsp+4344]
+  cmp rsi, qword ptr [rsp+4336]
+  jne .L.else.main.10
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+4328]
+  mov r9, qword ptr [rsp+4336]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.11
+.L.else.main.10:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+4328]
+  mov r9, qword ptr [rsp+4344]
+  mov r10, qword ptr [rsp+4336]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.11:
+  mov qword ptr [rsp+4368], 5
+  mov qword ptr [rsp+4360], 5
+  lea rsi, [rip+.L.data.main.5]
+  mov qword ptr [rsp+4352], rsi
+  mov rsi, qword ptr [rsp+4368]
+  cmp rsi, qword ptr [rsp+4360]
+  jne .L.else.main.12
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+4352]
+  mov r9, qword ptr [rsp+4360]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.13
+.L.else.main.12:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+4352]
+  mov r9, qword ptr [rsp+4368]
+  mov r10, qword ptr [rsp+4360]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.13:
+  mov qword ptr [rsp+4392], 15
+  mov rsi, 5
+  mov rdi, 9
+  sub rdi, 6
+  imul rsi, rdi
+  mov qword ptr [rsp+4384], rsi
+  lea rsi, [rip+.L.data.main.6]
+  mov qword ptr [rsp+4376], rsi
+  mov rsi, qword ptr [rsp+4392]
+  cmp rsi, qword ptr [rsp+4384]
+  jne .L.else.main.14
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+4376]
+  mov r9, qword ptr [rsp+4384]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.15
+.L.else.main.14:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+4376]
+  mov r9, qword ptr [rsp+4392]
+  mov r10, qword ptr [rsp+4384]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.15:
+  mov qword ptr [rsp+4416], 4
+  mov rsi, 3
+  add rsi, 5
+  mov rdi, rsi
+  sar rdi, 63
+  and rdi, 1
+  add rsi, rdi
+  sar rsi, 1
+  mov qword ptr [rsp+4408], rsi
+  lea rsi, [rip+.L.data.main.7]
+  mov qword ptr [rsp+4400], rsi
+  mov rsi, qword ptr [rsp+4416]
+  cmp rsi, qword ptr [rsp+4408]
+  jne .L.else.main.16
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+4400]
+  mov r9, qword ptr [rsp+4408]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.17
+.L.else.main.16:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+4400]
+  mov r9, qword ptr [rsp+4416]
+  mov r10, qword ptr [rsp+4408]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.17:
+  mov rsi, 0
+  sub rsi, 10
+  mov qword ptr [rsp+4440], rsi
+  mov rsi, 0
+  sub rsi, 10
+  mov qword ptr [rsp+4432], rsi
+  lea rsi, [rip+.L.data.main.8]
+  mov qword ptr [rsp+4424], rsi
+  mov rsi, qword ptr [rsp+4440]
+  cmp rsi, qword ptr [rsp+4432]
+  jne .L.else.main.18
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+4424]
+  mov r9, qword ptr [rsp+4432]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.19
+.L.else.main.18:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+4424]
+  mov r9, qword ptr [rsp+4440]
+  mov r10, qword ptr [rsp+4432]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.19:
+  mov qword ptr [rsp+4464], 10
+  mov rsi, 0
+  mov rdi, 0
+  sub rdi, 10
+  sub rsi, rdi
+  mov qword ptr [rsp+4456], rsi
+  lea rsi, [rip+.L.data.main.9]
+  mov qword ptr [rsp+4448], rsi
+  mov rsi, qword ptr [rsp+4464]
+  cmp rsi, qword ptr [rsp+4456]
+  jne .L.else.main.20
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+4448]
+  mov r9, qword ptr [rsp+4456]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.21
+.L.else.main.20:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+4448]
+  mov r9, qword ptr [rsp+4464]
+  mov r10, qword ptr [rsp+4456]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.21:
+  mov qword ptr [rsp+4488], 10
+  mov rsi, 0
+  mov rdi, 0
+  sub rdi, 10
+  sub rsi, rdi
+  mov qword ptr [rsp+4480], rsi
+  lea rsi, [rip+.L.data.main.10]
+  mov qword ptr [rsp+4472], rsi
+  mov rsi, qword ptr [rsp+4488]
+  cmp rsi, qword ptr [rsp+4480]
+  jne .L.else.main.22
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+4472]
+  mov r9, qword ptr [rsp+4480]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.23
+.L.else.main.22:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+4472]
+  mov r9, qword ptr [rsp+4488]
+  mov r10, qword ptr [rsp+4480]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.23:
+  mov qword ptr [rsp+4512], 0
+  mov rsi, 0
+  cmp rsi, 1
+  sete sil
+  movzx rsi, sil
+  mov qword ptr [rsp+4504], rsi
+  lea rsi, [rip+.L.data.main.11]
+  mov qword ptr [rsp+4496], rsi
+  mov rsi, qword ptr [rsp+4512]
+  cmp rsi, qword ptr [rsp+4504]
+  jne .L.else.main.24
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+4496]
+  mov r9, qword ptr [rsp+4504]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.25
+.L.else.main.24:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+4496]
+  mov r9, qword ptr [rsp+4512]
+  mov r10, qword ptr [rsp+4504]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.25:
+  mov qword ptr [rsp+4536], 1
+  mov rsi, 42
+  cmp rsi, 42
+  sete sil
+  movzx rsi, sil
+  mov qword ptr [rsp+4528], rsi
+  lea rsi, [rip+.L.data.main.12]
+  mov qword ptr [rsp+4520], rsi
+  mov rsi, qword ptr [rsp+4536]
+  cmp rsi, qword ptr [rsp+4528]
+  jne .L.else.main.26
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+4520]
+  mov r9, qword ptr [rsp+4528]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.27
+.L.else.main.26:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+4520]
+  mov r9, qword ptr [rsp+4536]
+  mov r10, qword ptr [rsp+4528]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.27:
+  mov qword ptr [rsp+4560], 1
+  mov rsi, 0
+  cmp rsi, 1
+  setne sil
+  movzx rsi, sil
+  mov qword ptr [rsp+4552], rsi
+  lea rsi, [rip+.L.data.main.13]
+  mov qword ptr [rsp+4544], rsi
+  mov rsi, qword ptr [rsp+4560]
+  cmp rsi, qword ptr [rsp+4552]
+  jne .L.else.main.28
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+4544]
+  mov r9, qword ptr [rsp+4552]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.29
+.L.else.main.28:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+4544]
+  mov r9, qword ptr [rsp+4560]
+  mov r10, qword ptr [rsp+4552]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.29:
+  mov qword ptr [rsp+4584], 0
+  mov rsi, 42
+  cmp rsi, 42
+  setne sil
+  movzx rsi, sil
+  mov qword ptr [rsp+4576], rsi
+  lea rsi, [rip+.L.data.main.14]
+  mov qword ptr [rsp+4568], rsi
+  mov rsi, qword ptr [rsp+4584]
+  cmp rsi, qword ptr [rsp+4576]
+  jne .L.else.main.30
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+4568]
+  mov r9, qword ptr [rsp+4576]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.31
+.L.else.main.30:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+4568]
+  mov r9, qword ptr [rsp+4584]
+  mov r10, qword ptr [rsp+4576]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.31:
+  mov qword ptr [rsp+4608], 1
+  mov rsi, 0
+  cmp rsi, 1
+  setl sil
+  movzx rsi, sil
+  mov qword ptr [rsp+4600], rsi
+  lea rsi, [rip+.L.data.main.15]
+  mov qword ptr [rsp+4592], rsi
+  mov rsi, qword ptr [rsp+4608]
+  cmp rsi, qword ptr [rsp+4600]
+  jne .L.else.main.32
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+4592]
+  mov r9, qword ptr [rsp+4600]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.33
+.L.else.main.32:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+4592]
+  mov r9, qword ptr [rsp+4608]
+  mov r10, qword ptr [rsp+4600]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.33:
+  mov qword ptr [rsp+4632], 0
+  mov rsi, 1
+  cmp rsi, 1
+  setl sil
+  movzx rsi, sil
+  mov qword ptr [rsp+4624], rsi
+  lea rsi, [rip+.L.data.main.16]
+  mov qword ptr [rsp+4616], rsi
+  mov rsi, qword ptr [rsp+4632]
+  cmp rsi, qword ptr [rsp+4624]
+  jne .L.else.main.34
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+4616]
+  mov r9, qword ptr [rsp+4624]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.35
+.L.else.main.34:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+4616]
+  mov r9, qword ptr [rsp+4632]
+  mov r10, qword ptr [rsp+4624]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.35:
+  mov qword ptr [rsp+4656], 0
+  mov rsi, 2
+  cmp rsi, 1
+  setl sil
+  movzx rsi, sil
+  mov qword ptr [rsp+4648], rsi
+  lea rsi, [rip+.L.data.main.17]
+  mov qword ptr [rsp+4640], rsi
+  mov rsi, qword ptr [rsp+4656]
+  cmp rsi, qword ptr [rsp+4648]
+  jne .L.else.main.36
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+4640]
+  mov r9, qword ptr [rsp+4648]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.37
+.L.else.main.36:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+4640]
+  mov r9, qword ptr [rsp+4656]
+  mov r10, qword ptr [rsp+4648]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.37:
+  mov qword ptr [rsp+4680], 1
+  mov rsi, 0
+  cmp rsi, 1
+  setle sil
+  movzx rsi, sil
+  mov qword ptr [rsp+4672], rsi
+  lea rsi, [rip+.L.data.main.18]
+  mov qword ptr [rsp+4664], rsi
+  mov rsi, qword ptr [rsp+4680]
+  cmp rsi, qword ptr [rsp+4672]
+  jne .L.else.main.38
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+4664]
+  mov r9, qword ptr [rsp+4672]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.39
+.L.else.main.38:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+4664]
+  mov r9, qword ptr [rsp+4680]
+  mov r10, qword ptr [rsp+4672]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.39:
+  mov qword ptr [rsp+4704], 1
+  mov rsi, 1
+  cmp rsi, 1
+  setle sil
+  movzx rsi, sil
+  mov qword ptr [rsp+4696], rsi
+  lea rsi, [rip+.L.data.main.19]
+  mov qword ptr [rsp+4688], rsi
+  mov rsi, qword ptr [rsp+4704]
+  cmp rsi, qword ptr [rsp+4696]
+  jne .L.else.main.40
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+4688]
+  mov r9, qword ptr [rsp+4696]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.41
+.L.else.main.40:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+4688]
+  mov r9, qword ptr [rsp+4704]
+  mov r10, qword ptr [rsp+4696]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.41:
+  mov qword ptr [rsp+4728], 0
+  mov rsi, 2
+  cmp rsi, 1
+  setle sil
+  movzx rsi, sil
+  mov qword ptr [rsp+4720], rsi
+  lea rsi, [rip+.L.data.main.20]
+  mov qword ptr [rsp+4712], rsi
+  mov rsi, qword ptr [rsp+4728]
+  cmp rsi, qword ptr [rsp+4720]
+  jne .L.else.main.42
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+4712]
+  mov r9, qword ptr [rsp+4720]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.43
+.L.else.main.42:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+4712]
+  mov r9, qword ptr [rsp+4728]
+  mov r10, qword ptr [rsp+4720]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.43:
+  mov qword ptr [rsp+4752], 1
+  mov rsi, 0
+  cmp rsi, 1
+  setl sil
+  movzx rsi, sil
+  mov qword ptr [rsp+4744], rsi
+  lea rsi, [rip+.L.data.main.21]
+  mov qword ptr [rsp+4736], rsi
+  mov rsi, qword ptr [rsp+4752]
+  cmp rsi, qword ptr [rsp+4744]
+  jne .L.else.main.44
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+4736]
+  mov r9, qword ptr [rsp+4744]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.45
+.L.else.main.44:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+4736]
+  mov r9, qword ptr [rsp+4752]
+  mov r10, qword ptr [rsp+4744]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.45:
+  mov qword ptr [rsp+4776], 0
+  mov rsi, 1
+  cmp rsi, 1
+  setl sil
+  movzx rsi, sil
+  mov qword ptr [rsp+4768], rsi
+  lea rsi, [rip+.L.data.main.22]
+  mov qword ptr [rsp+4760], rsi
+  mov rsi, qword ptr [rsp+4776]
+  cmp rsi, qword ptr [rsp+4768]
+  jne .L.else.main.46
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+4760]
+  mov r9, qword ptr [rsp+4768]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.47
+.L.else.main.46:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+4760]
+  mov r9, qword ptr [rsp+4776]
+  mov r10, qword ptr [rsp+4768]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.47:
+  mov qword ptr [rsp+4800], 0
+  mov rsi, 2
+  cmp rsi, 1
+  setl sil
+  movzx rsi, sil
+  mov qword ptr [rsp+4792], rsi
+  lea rsi, [rip+.L.data.main.23]
+  mov qword ptr [rsp+4784], rsi
+  mov rsi, qword ptr [rsp+4800]
+  cmp rsi, qword ptr [rsp+4792]
+  jne .L.else.main.48
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+4784]
+  mov r9, qword ptr [rsp+4792]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.49
+.L.else.main.48:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+4784]
+  mov r9, qword ptr [rsp+4800]
+  mov r10, qword ptr [rsp+4792]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.49:
+  mov qword ptr [rsp+4824], 1
+  mov rsi, 0
+  cmp rsi, 1
+  setle sil
+  movzx rsi, sil
+  mov qword ptr [rsp+4816], rsi
+  lea rsi, [rip+.L.data.main.24]
+  mov qword ptr [rsp+4808], rsi
+  mov rsi, qword ptr [rsp+4824]
+  cmp rsi, qword ptr [rsp+4816]
+  jne .L.else.main.50
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+4808]
+  mov r9, qword ptr [rsp+4816]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.51
+.L.else.main.50:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+4808]
+  mov r9, qword ptr [rsp+4824]
+  mov r10, qword ptr [rsp+4816]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.51:
+  mov qword ptr [rsp+4848], 1
+  mov rsi, 1
+  cmp rsi, 1
+  setle sil
+  movzx rsi, sil
+  mov qword ptr [rsp+4840], rsi
+  lea rsi, [rip+.L.data.main.25]
+  mov qword ptr [rsp+4832], rsi
+  mov rsi, qword ptr [rsp+4848]
+  cmp rsi, qword ptr [rsp+4840]
+  jne .L.else.main.52
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+4832]
+  mov r9, qword ptr [rsp+4840]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.53
+.L.else.main.52:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+4832]
+  mov r9, qword ptr [rsp+4848]
+  mov r10, qword ptr [rsp+4840]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.53:
+  mov qword ptr [rsp+4872], 0
+  mov rsi, 2
+  cmp rsi, 1
+  setle sil
+  movzx rsi, sil
+  mov qword ptr [rsp+4864], rsi
+  lea rsi, [rip+.L.data.main.26]
+  mov qword ptr [rsp+4856], rsi
+  mov rsi, qword ptr [rsp+4872]
+  cmp rsi, qword ptr [rsp+4864]
+  jne .L.else.main.54
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+4856]
+  mov r9, qword ptr [rsp+4864]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.55
+.L.else.main.54:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+4856]
+  mov r9, qword ptr [rsp+4872]
+  mov r10, qword ptr [rsp+4864]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.55:
+  mov qword ptr [rsp+4896], 3
+  mov dword ptr [rsp+228], 3
+  movsxd rsi, dword ptr [rsp+228]
+  mov qword ptr [rsp+4888], rsi
+  lea rsi, [rip+.L.data.main.27]
+  mov qword ptr [rsp+4880], rsi
+  mov rsi, qword ptr [rsp+4896]
+  cmp rsi, qword ptr [rsp+4888]
+  jne .L.else.main.56
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+4880]
+  mov r9, qword ptr [rsp+4888]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.57
+.L.else.main.56:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+4880]
+  mov r9, qword ptr [rsp+4896]
+  mov r10, qword ptr [rsp+4888]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.57:
+  mov qword ptr [rsp+4920], 8
+  mov dword ptr [rsp+232], 3
+  mov dword ptr [rsp+236], 5
+  movsxd rsi, dword ptr [rsp+232]
+  movsxd rdi, dword ptr [rsp+236]
+  add rsi, rdi
+  mov qword ptr [rsp+4912], rsi
+  lea rsi, [rip+.L.data.main.28]
+  mov qword ptr [rsp+4904], rsi
+  mov rsi, qword ptr [rsp+4920]
+  cmp rsi, qword ptr [rsp+4912]
+  jne .L.else.main.58
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+4904]
+  mov r9, qword ptr [rsp+4912]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.59
+.L.else.main.58:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+4904]
+  mov r9, qword ptr [rsp+4920]
+  mov r10, qword ptr [rsp+4912]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.59:
+  mov qword ptr [rsp+4944], 3
+  mov dword ptr [rsp+240], 3
+  movsxd rsi, dword ptr [rsp+240]
+  mov qword ptr [rsp+4936], rsi
+  lea rsi, [rip+.L.data.main.29]
+  mov qword ptr [rsp+4928], rsi
+  mov rsi, qword ptr [rsp+4944]
+  cmp rsi, qword ptr [rsp+4936]
+  jne .L.else.main.60
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+4928]
+  mov r9, qword ptr [rsp+4936]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.61
+.L.else.main.60:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+4928]
+  mov r9, qword ptr [rsp+4944]
+  mov r10, qword ptr [rsp+4936]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.61:
+  mov qword ptr [rsp+4968], 8
+  mov dword ptr [rsp+244], 3
+  mov dword ptr [rsp+248], 5
+  movsxd rsi, dword ptr [rsp+244]
+  movsxd rdi, dword ptr [rsp+248]
+  add rsi, rdi
+  mov qword ptr [rsp+4960], rsi
+  lea rsi, [rip+.L.data.main.30]
+  mov qword ptr [rsp+4952], rsi
+  mov rsi, qword ptr [rsp+4968]
+  cmp rsi, qword ptr [rsp+4960]
+  jne .L.else.main.62
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+4952]
+  mov r9, qword ptr [rsp+4960]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.63
+.L.else.main.62:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+4952]
+  mov r9, qword ptr [rsp+4968]
+  mov r10, qword ptr [rsp+4960]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.63:
+  mov qword ptr [rsp+4992], 3
+  mov dword ptr [rsp+252], 3
+  movsxd rsi, dword ptr [rsp+252]
+  mov qword ptr [rsp+4984], rsi
+  lea rsi, [rip+.L.data.main.31]
+  mov qword ptr [rsp+4976], rsi
+  mov rsi, qword ptr [rsp+4992]
+  cmp rsi, qword ptr [rsp+4984]
+  jne .L.else.main.64
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+4976]
+  mov r9, qword ptr [rsp+4984]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.65
+.L.else.main.64:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+4976]
+  mov r9, qword ptr [rsp+4992]
+  mov r10, qword ptr [rsp+4984]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.65:
+  mov qword ptr [rsp+5016], 8
+  mov dword ptr [rsp+256], 3
+  mov dword ptr [rsp+260], 5
+  movsxd rsi, dword ptr [rsp+256]
+  movsxd rdi, dword ptr [rsp+260]
+  add rsi, rdi
+  mov qword ptr [rsp+5008], rsi
+  lea rsi, [rip+.L.data.main.32]
+  mov qword ptr [rsp+5000], rsi
+  mov rsi, qword ptr [rsp+5016]
+  cmp rsi, qword ptr [rsp+5008]
+  jne .L.else.main.66
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+5000]
+  mov r9, qword ptr [rsp+5008]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.67
+.L.else.main.66:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+5000]
+  mov r9, qword ptr [rsp+5016]
+  mov r10, qword ptr [rsp+5008]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.67:
+  mov qword ptr [rsp+5048], 3
+  mov dword ptr [rsp+5028], 3
+  movsxd rsi, dword ptr [rsp+5028]
+  mov qword ptr [rsp+5040], rsi
+  lea rsi, [rip+.L.data.main.33]
+  mov qword ptr [rsp+5032], rsi
+  mov rsi, qword ptr [rsp+5048]
+  cmp rsi, qword ptr [rsp+5040]
+  jne .L.else.main.69
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+5032]
+  mov r9, qword ptr [rsp+5040]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.70
+.L.else.main.69:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+5032]
+  mov r9, qword ptr [rsp+5048]
+  mov r10, qword ptr [rsp+5040]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.70:
+  mov qword ptr [rsp+5072], 3
+  mov dword ptr [rsp+264], 0
+  mov dword ptr [rsp+264], 3
+  movsxd rsi, dword ptr [rsp+264]
+  mov qword ptr [rsp+5064], rsi
+  lea rsi, [rip+.L.data.main.34]
+  mov qword ptr [rsp+5056], rsi
+  mov rsi, qword ptr [rsp+5072]
+  cmp rsi, qword ptr [rsp+5064]
+  jne .L.else.main.73
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+5056]
+  mov r9, qword ptr [rsp+5064]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.74
+.L.else.main.73:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+5056]
+  mov r9, qword ptr [rsp+5072]
+  mov r10, qword ptr [rsp+5064]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.74:
+  mov qword ptr [rsp+5096], 3
+  mov dword ptr [rsp+268], 0
+  mov rsi, 1
+  sub rsi, 1
+  cmp rsi, 0
+  je .L.else.main.75
+  mov dword ptr [rsp+268], 2
+  jmp .L.end.main.76
+.L.else.main.75:
+  mov dword ptr [rsp+268], 3
+.L.end.main.76:
+  movsxd rsi, dword ptr [rsp+268]
+  mov qword ptr [rsp+5088], rsi
+  lea rsi, [rip+.L.data.main.35]
+  mov qword ptr [rsp+5080], rsi
+  mov rsi, qword ptr [rsp+5096]
+  cmp rsi, qword ptr [rsp+5088]
+  jne .L.else.main.77
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+5080]
+  mov r9, qword ptr [rsp+5088]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.78
+.L.else.main.77:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+5080]
+  mov r9, qword ptr [rsp+5096]
+  mov r10, qword ptr [rsp+5088]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.78:
+  mov qword ptr [rsp+5120], 2
+  mov dword ptr [rsp+272], 0
+  mov dword ptr [rsp+272], 2
+  movsxd rsi, dword ptr [rsp+272]
+  mov qword ptr [rsp+5112], rsi
+  lea rsi, [rip+.L.data.main.36]
+  mov qword ptr [rsp+5104], rsi
+  mov rsi, qword ptr [rsp+5120]
+  cmp rsi, qword ptr [rsp+5112]
+  jne .L.else.main.81
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+5104]
+  mov r9, qword ptr [rsp+5112]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.82
+.L.else.main.81:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+5104]
+  mov r9, qword ptr [rsp+5120]
+  mov r10, qword ptr [rsp+5112]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.82:
+  mov qword ptr [rsp+5144], 2
+  mov dword ptr [rsp+276], 0
+  mov rsi, 2
+  sub rsi, 1
+  cmp rsi, 0
+  je .L.else.main.83
+  mov dword ptr [rsp+276], 2
+  jmp .L.end.main.84
+.L.else.main.83:
+  mov dword ptr [rsp+276], 3
+.L.end.main.84:
+  movsxd rsi, dword ptr [rsp+276]
+  mov qword ptr [rsp+5136], rsi
+  lea rsi, [rip+.L.data.main.37]
+  mov qword ptr [rsp+5128], rsi
+  mov rsi, qword ptr [rsp+5144]
+  cmp rsi, qword ptr [rsp+5136]
+  jne .L.else.main.85
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+5128]
+  mov r9, qword ptr [rsp+5136]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.86
+.L.else.main.85:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+5128]
+  mov r9, qword ptr [rsp+5144]
+  mov r10, qword ptr [rsp+5136]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.86:
+  mov qword ptr [rsp+5168], 3
+  mov qword ptr [rsp+5160], 3
+  lea rsi, [rip+.L.data.main.38]
+  mov qword ptr [rsp+5152], rsi
+  mov rsi, qword ptr [rsp+5168]
+  cmp rsi, qword ptr [rsp+5160]
+  jne .L.else.main.87
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+5152]
+  mov r9, qword ptr [rsp+5160]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.88
+.L.else.main.87:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+5152]
+  mov r9, qword ptr [rsp+5168]
+  mov r10, qword ptr [rsp+5160]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.88:
+  mov qword ptr [rsp+5192], 10
+  mov dword ptr [rsp+280], 0
+  mov dword ptr [rsp+280], 0
+  movsxd rsi, dword ptr [rsp+280]
+  cmp rsi, 10
+  jge .L.break.main.90
+  .p2align 4,,10
+.L.begin.main.91:
+  add dword ptr [rsp+280], 1
+  movsxd rsi, dword ptr [rsp+280]
+  cmp rsi, 10
+  jl .L.begin.main.91
+.L.break.main.90:
+  movsxd rsi, dword ptr [rsp+280]
+  mov qword ptr [rsp+5184], rsi
+  lea rsi, [rip+.L.data.main.39]
+  mov qword ptr [rsp+5176], rsi
+  mov rsi, qword ptr [rsp+5192]
+  cmp rsi, qword ptr [rsp+5184]
+  jne .L.else.main.92
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+5176]
+  mov r9, qword ptr [rsp+5184]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.93
+.L.else.main.92:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+5176]
+  mov r9, qword ptr [rsp+5192]
+  mov r10, qword ptr [rsp+5184]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.93:
+  mov qword ptr [rsp+5216], 55
+  mov dword ptr [rsp+284], 0
+  mov dword ptr [rsp+288], 0
+  movsxd rsi, dword ptr [rsp+284]
+  cmp rsi, 10
+  jg .L.break.main.95
+  .p2align 4,,10
+.L.begin.main.96:
+  movsxd rsi, dword ptr [rsp+284]
+  movsxd rdi, dword ptr [rsp+288]
+  add rsi, rdi
+  mov dword ptr [rsp+288], esi
+  add dword ptr [rsp+284], 1
+  movsxd rsi, dword ptr [rsp+284]
+  cmp rsi, 10
+  jle .L.begin.main.96
+.L.break.main.95:
+  movsxd rsi, dword ptr [rsp+288]
+  mov qword ptr [rsp+5208], rsi
+  lea rsi, [rip+.L.data.main.40]
+  mov qword ptr [rsp+5200], rsi
+  mov rsi, qword ptr [rsp+5216]
+  cmp rsi, qword ptr [rsp+5208]
+  jne .L.else.main.97
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+5200]
+  mov r9, qword ptr [rsp+5208]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.98
+.L.else.main.97:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+5200]
+  mov r9, qword ptr [rsp+5216]
+  mov r10, qword ptr [rsp+5208]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.98:
+  mov qword ptr [rsp+5240], 55
+  mov dword ptr [rsp+292], 0
+  mov dword ptr [rsp+296], 0
+  mov dword ptr [rsp+292], 0
+  movsxd rsi, dword ptr [rsp+292]
+  cmp rsi, 10
+  jg .L.break.main.100
+  .p2align 4,,10
+.L.begin.main.101:
+  movsxd rsi, dword ptr [rsp+292]
+  movsxd rdi, dword ptr [rsp+296]
+  add rsi, rdi
+  mov dword ptr [rsp+296], esi
+  add dword ptr [rsp+292], 1
+  movsxd rsi, dword ptr [rsp+292]
+  cmp rsi, 10
+  jle .L.begin.main.101
+.L.break.main.100:
+  movsxd rsi, dword ptr [rsp+296]
+  mov qword ptr [rsp+5232], rsi
+  lea rsi, [rip+.L.data.main.41]
+  mov qword ptr [rsp+5224], rsi
+  mov rsi, qword ptr [rsp+5240]
+  cmp rsi, qword ptr [rsp+5232]
+  jne .L.else.main.102
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+5224]
+  mov r9, qword ptr [rsp+5232]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.103
+.L.else.main.102:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+5224]
+  mov r9, qword ptr [rsp+5240]
+  mov r10, qword ptr [rsp+5232]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.103:
+  mov qword ptr [rsp+5272], 8
+  mov dword ptr [rsp+5252], 3
+  mov dword ptr [rsp+5248], 5
+  movsxd rsi, dword ptr [rsp+5252]
+  movsxd rdi, dword ptr [rsp+5248]
+  add rsi, rdi
+  movsxd rsi, esi
+  mov qword ptr [rsp+5264], rsi
+  lea rsi, [rip+.L.data.main.42]
+  mov qword ptr [rsp+5256], rsi
+  mov rsi, qword ptr [rsp+5272]
+  cmp rsi, qword ptr [rsp+5264]
+  jne .L.else.main.104
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+5256]
+  mov r9, qword ptr [rsp+5264]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.105
+.L.else.main.104:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+5256]
+  mov r9, qword ptr [rsp+5272]
+  mov r10, qword ptr [rsp+5264]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.105:
+  mov qword ptr [rsp+5304], 2
+  mov dword ptr [rsp+5284], 5
+  mov dword ptr [rsp+5280], 3
+  movsxd rsi, dword ptr [rsp+5284]
+  movsxd rdi, dword ptr [rsp+5280]
+  sub rsi, rdi
+  movsxd rsi, esi
+  mov qword ptr [rsp+5296], rsi
+  lea rsi, [rip+.L.data.main.43]
+  mov qword ptr [rsp+5288], rsi
+  mov rsi, qword ptr [rsp+5304]
+  cmp rsi, qword ptr [rsp+5296]
+  jne .L.else.main.106
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+5288]
+  mov r9, qword ptr [rsp+5296]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.107
+.L.else.main.106:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+5288]
+  mov r9, qword ptr [rsp+5304]
+  mov r10, qword ptr [rsp+5296]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.107:
+  mov qword ptr [rsp+5352], 21
+  mov dword ptr [rsp+5332], 1
+  mov dword ptr [rsp+5328], 2
+  mov dword ptr [rsp+5324], 3
+  mov dword ptr [rsp+5320], 4
+  mov dword ptr [rsp+5316], 5
+  mov dword ptr [rsp+5312], 6
+  movsxd rsi, dword ptr [rsp+5332]
+  movsxd rdi, dword ptr [rsp+5328]
+  add rsi, rdi
+  movsxd rdi, dword ptr [rsp+5324]
+  add rsi, rdi
+  movsxd rdi, dword ptr [rsp+5320]
+  add rsi, rdi
+  movsxd rdi, dword ptr [rsp+5316]
+  add rsi, rdi
+  movsxd rdi, dword ptr [rsp+5312]
+  add rsi, rdi
+  movsxd rsi, esi
+  mov qword ptr [rsp+5344], rsi
+  lea rsi, [rip+.L.data.main.44]
+  mov qword ptr [rsp+5336], rsi
+  mov rsi, qword ptr [rsp+5352]
+  cmp rsi, qword ptr [rsp+5344]
+  jne .L.else.main.108
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+5336]
+  mov r9, qword ptr [rsp+5344]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.109
+.L.else.main.108:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+5336]
+  mov r9, qword ptr [rsp+5352]
+  mov r10, qword ptr [rsp+5344]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.109:
+  mov qword ptr [rsp+5376], 136
+  mov qword ptr [rsp+208], 1
+  mov qword ptr [rsp+200], 2
+  mov qword ptr [rsp+192], 3
+  mov qword ptr [rsp+184], 4
+  mov qword ptr [rsp+176], 5
+  mov qword ptr [rsp+168], 6
+  mov qword ptr [rsp+160], 7
+  mov qword ptr [rsp+152], 8
+  mov rdi, 9
+  mov r8, 10
+  mov r9, 11
+  mov r10, 12
+  mov r11, 13
+  mov rcx, 14
+  mov rsi, 15
+  add rsi, 16
+  add rcx, rsi
+  add r11, rcx
+  add r10, r11
+  add r9, r10
+  add r8, r9
+  add rdi, r8
+  add qword ptr [rsp+152], rdi
+  mov rax, qword ptr [rsp+152]
+  add qword ptr [rsp+160], rax
+  mov rax, qword ptr [rsp+160]
+  add qword ptr [rsp+168], rax
+  mov rax, qword ptr [rsp+168]
+  add qword ptr [rsp+176], rax
+  mov rax, qword ptr [rsp+176]
+  add qword ptr [rsp+184], rax
+  mov rax, qword ptr [rsp+184]
+  add qword ptr [rsp+192], rax
+  mov rax, qword ptr [rsp+192]
+  add qword ptr [rsp+200], rax
+  mov rax, qword ptr [rsp+200]
+  add qword ptr [rsp+208], rax
+  mov rax, qword ptr [rsp+208]
+  mov qword ptr [rsp+5368], rax
+  lea rsi, [rip+.L.data.main.45]
+  mov qword ptr [rsp+5360], rsi
+  mov rsi, qword ptr [rsp+5376]
+  cmp rsi, qword ptr [rsp+5368]
+  jne .L.else.main.110
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+5360]
+  mov r9, qword ptr [rsp+5368]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.111
+.L.else.main.110:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+5360]
+  mov r9, qword ptr [rsp+5376]
+  mov r10, qword ptr [rsp+5368]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.111:
+  mov qword ptr [rsp+5448], 291054
+  mov dword ptr [rsp+5396], 1
+  mov dword ptr [rsp+5388], 2
+  mov dword ptr [rsp+5384], 3
+  movsxd rsi, dword ptr [rsp+5388]
+  movsxd rdi, dword ptr [rsp+5384]
+  add rsi, rdi
+  movsxd rsi, esi
+  mov dword ptr [rsp+5392], esi
+  movsxd rax, dword ptr [rsp+5396]
+  mov qword ptr [rsp+144], rax
+  movsxd rdi, dword ptr [rsp+5392]
+  add qword ptr [rsp+144], rdi
+  movsxd rax, dword ptr [rsp+144]
+  mov qword ptr [rsp+144], rax
+  mov qword ptr [rsp+136], 4
+  mov qword ptr [rsp+128], 5
+  mov qword ptr [rsp+120], 6
+  mov qword ptr [rsp+112], 7
+  mov qword ptr [rsp+104], 8
+  mov rcx, 9
+  mov rsi, 10
+  mov rdi, 11
+  mov r8, 12
+  mov dword ptr [rsp+5420], 1
+  mov dword ptr [rsp+5416], 2
+  mov dword ptr [rsp+5412], 3
+  mov dword ptr [rsp+5408], 4
+  mov dword ptr [rsp+5404], 5
+  mov dword ptr [rsp+5400], 6
+  movsxd r9, dword ptr [rsp+5420]
+  movsxd r10, dword ptr [rsp+5416]
+  add r9, r10
+  movsxd r10, dword ptr [rsp+5412]
+  add r9, r10
+  movsxd r10, dword ptr [rsp+5408]
+  add r9, r10
+  movsxd r10, dword ptr [rsp+5404]
+  add r9, r10
+  movsxd r10, dword ptr [rsp+5400]
+  add r9, r10
+  movsxd r9, r9d
+  mov dword ptr [rsp+5428], 14
+  mov dword ptr [rsp+5424], 15
+  movsxd r10, dword ptr [rsp+5428]
+  movsxd r11, dword ptr [rsp+5424]
+  add r10, r11
+  movsxd r10, r10d
+  sub r10, 13
+  mov rax, r9
+  cqo
+  idiv r10
+  add r8, rax
+  imul rdi, r8
+  add rsi, rdi
+  imul rcx, rsi
+  add qword ptr [rsp+104], rcx
+  mov rax, qword ptr [rsp+112]
+  imul rax, qword ptr [rsp+104]
+  mov qword ptr [rsp+112], rax
+  mov rax, qword ptr [rsp+112]
+  add qword ptr [rsp+120], rax
+  mov rax, qword ptr [rsp+128]
+  imul rax, qword ptr [rsp+120]
+  mov qword ptr [rsp+128], rax
+  mov rax, qword ptr [rsp+128]
+  add qword ptr [rsp+136], rax
+  mov rax, qword ptr [rsp+144]
+  imul rax, qword ptr [rsp+136]
+  mov qword ptr [rsp+144], rax
+  mov rax, qword ptr [rsp+144]
+  mov qword ptr [rsp+5440], rax
+  lea rsi, [rip+.L.data.main.46]
+  mov qword ptr [rsp+5432], rsi
+  mov rsi, qword ptr [rsp+5448]
+  cmp rsi, qword ptr [rsp+5440]
+  jne .L.else.main.112
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+5432]
+  mov r9, qword ptr [rsp+5440]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.113
+.L.else.main.112:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+5432]
+  mov r9, qword ptr [rsp+5448]
+  mov r10, qword ptr [rsp+5440]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.113:
+  mov qword ptr [rsp+5472], 55
+  mov rdi, 9
+  mov rax, 0
+  call fib
+  mov qword ptr [rsp+5464], rax
+  lea rsi, [rip+.L.data.main.47]
+  mov qword ptr [rsp+5456], rsi
+  mov rsi, qword ptr [rsp+5472]
+  cmp rsi, qword ptr [rsp+5464]
+  jne .L.else.main.114
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+5456]
+  mov r9, qword ptr [rsp+5464]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.115
+.L.else.main.114:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+5456]
+  mov r9, qword ptr [rsp+5472]
+  mov r10, qword ptr [rsp+5464]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.115:
+  mov qword ptr [rsp+5512], 143
+  mov dword ptr [rsp+5492], 10
+  mov dword ptr [rsp+5488], 0
+  mov dword ptr [rsp+5484], 0
+  movsxd rsi, dword ptr [rsp+5484]
+  movsxd rdi, dword ptr [rsp+5492]
+  cmp rsi, rdi
+  jge .L.break.main.117
+  .p2align 4,,10
+.L.begin.main.118:
+  movsxd rax, dword ptr [rsp+5488]
+  mov qword ptr [rsp+96], rax
+  movsxd rsi, dword ptr [rsp+5484]
+  mov rdi, rsi
+  mov rax, 0
+  call fib
+  add qword ptr [rsp+96], rax
+  mov eax, dword ptr [rsp+96]
+  mov dword ptr [rsp+5488], eax
+  add dword ptr [rsp+5484], 1
+  movsxd rsi, dword ptr [rsp+5484]
+  movsxd rdi, dword ptr [rsp+5492]
+  cmp rsi, rdi
+  jl .L.begin.main.118
+.L.break.main.117:
+  movsxd rsi, dword ptr [rsp+5488]
+  movsxd rsi, esi
+  mov qword ptr [rsp+5504], rsi
+  lea rsi, [rip+.L.data.main.48]
+  mov qword ptr [rsp+5496], rsi
+  mov rsi, qword ptr [rsp+5512]
+  cmp rsi, qword ptr [rsp+5504]
+  jne .L.else.main.119
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+5496]
+  mov r9, qword ptr [rsp+5504]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.120
+.L.else.main.119:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+5496]
+  mov r9, qword ptr [rsp+5512]
+  mov r10, qword ptr [rsp+5504]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.120:
+  mov qword ptr [rsp+5536], 456123
+  mov rsi, 1
+  mov r8, 2
+  mov r9, 3
+  mov r10, 4
+  mov r11, 5
+  mov qword ptr [rsp+88], 6
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov r8, r11
+  mov r9, qword ptr [rsp+88]
+  mov rax, 0
+  call rotate6
+  mov qword ptr [rsp+5528], rax
+  lea rsi, [rip+.L.data.main.49]
+  mov qword ptr [rsp+5520], rsi
+  mov rsi, qword ptr [rsp+5536]
+  cmp rsi, qword ptr [rsp+5528]
+  jne .L.else.main.121
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+5520]
+  mov r9, qword ptr [rsp+5528]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.122
+.L.else.main.121:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+5520]
+  mov r9, qword ptr [rsp+5536]
+  mov r10, qword ptr [rsp+5528]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.122:
+  mov qword ptr [rsp+5576], 3
+  mov dword ptr [rsp+5556], 2
+  mov dword ptr [rsp+5552], 5
+  movsxd rsi, dword ptr [rsp+5552]
+  mov dword ptr [rsp+5544], esi
+  movsxd rsi, dword ptr [rsp+5556]
+  mov dword ptr [rsp+5548], esi
+  movsxd rsi, dword ptr [rsp+5544]
+  movsxd rdi, dword ptr [rsp+5548]
+  sub rsi, rdi
+  movsxd rsi, esi
+  movsxd rsi, esi
+  mov qword ptr [rsp+5568], rsi
+  lea rsi, [rip+.L.data.main.50]
+  mov qword ptr [rsp+5560], rsi
+  mov rsi, qword ptr [rsp+5576]
+  cmp rsi, qword ptr [rsp+5568]
+  jne .L.else.main.123
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+5560]
+  mov r9, qword ptr [rsp+5568]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.124
+.L.else.main.123:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+5560]
+  mov r9, qword ptr [rsp+5576]
+  mov r10, qword ptr [rsp+5568]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.124:
+  mov rsi, 0
+  sub rsi, 128
+  mov qword ptr [rsp+5608], rsi
+  mov byte ptr [rsp+5591], 127
+  add byte ptr [rsp+5591], 1
+  movsx rsi, byte ptr [rsp+5591]
+  movsx rsi, sil
+  mov qword ptr [rsp+5600], rsi
+  lea rsi, [rip+.L.data.main.51]
+  mov qword ptr [rsp+5592], rsi
+  mov rsi, qword ptr [rsp+5608]
+  cmp rsi, qword ptr [rsp+5600]
+  jne .L.else.main.125
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+5592]
+  mov r9, qword ptr [rsp+5600]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.126
+.L.else.main.125:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+5592]
+  mov r9, qword ptr [rsp+5608]
+  mov r10, qword ptr [rsp+5600]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.126:
+  mov qword ptr [rsp+5632], 240
+  mov rdi, 2
+  mov rax, 0
+  call sum_small_array
+  mov qword ptr [rsp+5624], rax
+  lea rsi, [rip+.L.data.main.52]
+  mov qword ptr [rsp+5616], rsi
+  mov rsi, qword ptr [rsp+5632]
+  cmp rsi, qword ptr [rsp+5624]
+  jne .L.else.main.127
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+5616]
+  mov r9, qword ptr [rsp+5624]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.128
+.L.else.main.127:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+5616]
+  mov r9, qword ptr [rsp+5632]
+  mov r10, qword ptr [rsp+5624]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.128:
+  mov qword ptr [rsp+5656], 6048
+  mov rdi, 3
+  mov rax, 0
+  call sum_large_array
+  mov qword ptr [rsp+5648], rax
+  lea rsi, [rip+.L.data.main.53]
+  mov qword ptr [rsp+5640], rsi
+  mov rsi, qword ptr [rsp+5656]
+  cmp rsi, qword ptr [rsp+5648]
+  jne .L.else.main.129
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+5640]
+  mov r9, qword ptr [rsp+5648]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.130
+.L.else.main.129:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+5640]
+  mov r9, qword ptr [rsp+5656]
+  mov r10, qword ptr [rsp+5648]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.130:
+  mov qword ptr [rsp+5680], 6288
+  mov rdi, 2
+  mov rax, 0
+  call sum_small_array
+  mov qword ptr [rsp+80], rax
+  mov rdi, 3
+  mov rax, 0
+  call sum_large_array
+  add qword ptr [rsp+80], rax
+  mov rax, qword ptr [rsp+80]
+  mov qword ptr [rsp+5672], rax
+  lea rsi, [rip+.L.data.main.54]
+  mov qword ptr [rsp+5664], rsi
+  mov rsi, qword ptr [rsp+5680]
+  cmp rsi, qword ptr [rsp+5672]
+  jne .L.else.main.131
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+5664]
+  mov r9, qword ptr [rsp+5672]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.132
+.L.else.main.131:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+5664]
+  mov r9, qword ptr [rsp+5680]
+  mov r10, qword ptr [rsp+5672]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.132:
+  mov qword ptr [rsp+5768], 7053
+  mov qword ptr [rsp+5744], 100
+  mov qword ptr [rsp+5736], 14
+  mov qword ptr [rsp+5728], 3
+  mov qword ptr [rsp+5720], 2
+  mov qword ptr [rsp+5712], 50
+  mov qword ptr [rsp+5704], 10
+  mov rsi, qword ptr [rsp+5744]
+  mov rdi, qword ptr [rsp+5736]
+  mov rax, rsi
+  cqo
+  idiv rdi
+  mov qword ptr [rsp+5696], rax
+  mov rsi, qword ptr [rsp+5728]
+  mov rcx, qword ptr [rsp+5720]
+  shl rsi, cl
+  mov qword ptr [rsp+5688], rsi
+  mov rsi, qword ptr [rsp+5696]
+  imul rsi, 1000
+  add rsi, qword ptr [rsp+5688]
+  add rsi, qword ptr [rsp+5712]
+  sub rsi, qword ptr [rsp+5704]
+  mov rdi, qword ptr [rsp+5728]
+  mov r8, qword ptr [rsp+5720]
+  mov rax, rdi
+  cqo
+  idiv r8
+  add rsi, rax
+  mov qword ptr [rsp+5760], rsi
+  lea rsi, [rip+.L.data.main.55]
+  mov qword ptr [rsp+5752], rsi
+  mov rsi, qword ptr [rsp+5768]
+  cmp rsi, qword ptr [rsp+5760]
+  jne .L.else.main.133
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+5752]
+  mov r9, qword ptr [rsp+5760]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.134
+.L.else.main.133:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+5752]
+  mov r9, qword ptr [rsp+5768]
+  mov r10, qword ptr [rsp+5760]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.134:
+  mov qword ptr [rsp+5832], 26
+  mov qword ptr [rsp+5808], 1
+  mov qword ptr [rsp+5800], 2
+  mov qword ptr [rsp+5792], 3
+  mov qword ptr [rsp+5784], 4
+  mov qword ptr [rsp+5776], 5
+  mov rax, qword ptr [rsp+5808]
+  mov qword ptr [rsp+72], rax
+  mov rax, qword ptr [rsp+5800]
+  add qword ptr [rsp+72], rax
+  mov rax, qword ptr [rsp+5792]
+  add qword ptr [rsp+72], rax
+  mov rax, qword ptr [rsp+5784]
+  add qword ptr [rsp+72], rax
+  mov rax, qword ptr [rsp+5776]
+  add qword ptr [rsp+72], rax
+  mov rax, qword ptr [rsp+5808]
+  mov qword ptr [rsp+64], rax
+  mov rax, qword ptr [rsp+64]
+  shl rax, 1
+  add rax, qword ptr [rsp+64]
+  lea rdx, [rax]
+  mov qword ptr [rsp+64], rdx
+  mov rax, 0
+  call one
+  mov rdx, qword ptr [rsp+64]
+  lea rdx, [rdx+rax*8]
+  mov qword ptr [rsp+64], rdx
+  mov rax, qword ptr [rsp+64]
+  add qword ptr [rsp+72], rax
+  mov rax, qword ptr [rsp+72]
+  mov qword ptr [rsp+5824], rax
+  lea rsi, [rip+.L.data.main.56]
+  mov qword ptr [rsp+5816], rsi
+  mov rsi, qword ptr [rsp+5832]
+  cmp rsi, qword ptr [rsp+5824]
+  jne .L.else.main.135
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+5816]
+  mov r9, qword ptr [rsp+5824]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.136
+.L.else.main.135:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+5816]
+  mov r9, qword ptr [rsp+5832]
+  mov r10, qword ptr [rsp+5824]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.136:
+  mov qword ptr [rsp+5880], 1
+  mov qword ptr [rsp+5856], 0
+  mov rsi, qword ptr [rsp+5856]
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rsp+5855], sil
+  movsx rsi, byte ptr [rsp+5855]
+  add rsi, 5
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rsp+5855], sil
+  mov qword ptr [rsp+5840], rsi
+  mov rsi, qword ptr [rsp+5840]
+  mov qword ptr [rsp+5872], rsi
+  lea rsi, [rip+.L.data.main.57]
+  mov qword ptr [rsp+5864], rsi
+  mov rsi, qword ptr [rsp+5880]
+  cmp rsi, qword ptr [rsp+5872]
+  jne .L.else.main.137
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+5864]
+  mov r9, qword ptr [rsp+5872]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.138
+.L.else.main.137:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+5864]
+  mov r9, qword ptr [rsp+5880]
+  mov r10, qword ptr [rsp+5872]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.138:
+  mov qword ptr [rsp+5904], 411
+  lea rdi, [rip+.L.data.main.58]
+  mov rax, 0
+  call bool_inc_loop
+  mov qword ptr [rsp+5896], rax
+  lea rsi, [rip+.L.data.main.59]
+  mov qword ptr [rsp+5888], rsi
+  mov rsi, qword ptr [rsp+5904]
+  cmp rsi, qword ptr [rsp+5896]
+  jne .L.else.main.139
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+5888]
+  mov r9, qword ptr [rsp+5896]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.140
+.L.else.main.139:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+5888]
+  mov r9, qword ptr [rsp+5904]
+  mov r10, qword ptr [rsp+5896]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.140:
+  mov qword ptr [rsp+5944], 1
+  movabs rsi, 3000000000
+  mov qword ptr [rsp+5912], rsi
+  mov rsi, qword ptr [rsp+5912]
+  movabs rdi, -3000000000
+  cmp rsi, rdi
+  je .L.case.main.143
+  cmp rsi, 5
+  je .L.case.main.142
+  movabs rdi, 3000000000
+  cmp rsi, rdi
+  jne .L.break.main.141
+  mov dword ptr [rsp+5924], 1
+  jmp .L.label.main.74
+.L.case.main.143:
+  mov dword ptr [rsp+5924], 2
+  jmp .L.label.main.74
+.L.case.main.142:
+  mov dword ptr [rsp+5924], 3
+  jmp .L.label.main.74
+.L.break.main.141:
+  mov dword ptr [rsp+5924], 0
+.L.label.main.74:
+  movsxd rsi, dword ptr [rsp+5924]
+  mov qword ptr [rsp+5936], rsi
+  lea rsi, [rip+.L.data.main.60]
+  mov qword ptr [rsp+5928], rsi
+  mov rsi, qword ptr [rsp+5944]
+  cmp rsi, qword ptr [rsp+5936]
+  jne .L.else.main.146
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+5928]
+  mov r9, qword ptr [rsp+5936]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.147
+.L.else.main.146:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+5928]
+  mov r9, qword ptr [rsp+5944]
+  mov r10, qword ptr [rsp+5936]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.147:
+  mov qword ptr [rsp+5984], 2
+  mov rsi, 0
+  movabs rdi, 3000000000
+  sub rsi, rdi
+  mov qword ptr [rsp+5952], rsi
+  mov rsi, qword ptr [rsp+5952]
+  movabs rdi, -3000000000
+  cmp rsi, rdi
+  je .L.case.main.150
+  cmp rsi, 5
+  je .L.case.main.149
+  movabs rdi, 3000000000
+  cmp rsi, rdi
+  jne .L.break.main.148
+  mov dword ptr [rsp+5964], 1
+  jmp .L.label.main.76
+.L.case.main.150:
+  mov dword ptr [rsp+5964], 2
+  jmp .L.label.main.76
+.L.case.main.149:
+  mov dword ptr [rsp+5964], 3
+  jmp .L.label.main.76
+.L.break.main.148:
+  mov dword ptr [rsp+5964], 0
+.L.label.main.76:
+  movsxd rsi, dword ptr [rsp+5964]
+  mov qword ptr [rsp+5976], rsi
+  lea rsi, [rip+.L.data.main.61]
+  mov qword ptr [rsp+5968], rsi
+  mov rsi, qword ptr [rsp+5984]
+  cmp rsi, qword ptr [rsp+5976]
+  jne .L.else.main.153
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+5968]
+  mov r9, qword ptr [rsp+5976]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.154
+.L.else.main.153:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+5968]
+  mov r9, qword ptr [rsp+5984]
+  mov r10, qword ptr [rsp+5976]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.154:
+  mov qword ptr [rsp+6024], 3
+  mov qword ptr [rsp+5992], 5
+  mov rsi, qword ptr [rsp+5992]
+  movabs rdi, -3000000000
+  cmp rsi, rdi
+  je .L.case.main.157
+  cmp rsi, 5
+  je .L.case.main.156
+  movabs rdi, 3000000000
+  cmp rsi, rdi
+  jne .L.break.main.155
+  mov dword ptr [rsp+6004], 1
+  jmp .L.label.main.78
+.L.case.main.157:
+  mov dword ptr [rsp+6004], 2
+  jmp .L.label.main.78
+.L.case.main.156:
+  mov dword ptr [rsp+6004], 3
+  jmp .L.label.main.78
+.L.break.main.155:
+  mov dword ptr [rsp+6004], 0
+.L.label.main.78:
+  movsxd rsi, dword ptr [rsp+6004]
+  mov qword ptr [rsp+6016], rsi
+  lea rsi, [rip+.L.data.main.62]
+  mov qword ptr [rsp+6008], rsi
+  mov rsi, qword ptr [rsp+6024]
+  cmp rsi, qword ptr [rsp+6016]
+  jne .L.else.main.160
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+6008]
+  mov r9, qword ptr [rsp+6016]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.161
+.L.else.main.160:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+6008]
+  mov r9, qword ptr [rsp+6024]
+  mov r10, qword ptr [rsp+6016]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.161:
+  mov qword ptr [rsp+6064], 0
+  mov rsi, 0
+  sub rsi, 1294967296
+  mov qword ptr [rsp+6032], rsi
+  mov rsi, qword ptr [rsp+6032]
+  movabs rdi, -3000000000
+  cmp rsi, rdi
+  je .L.case.main.164
+  cmp rsi, 5
+  je .L.case.main.163
+  movabs rdi, 3000000000
+  cmp rsi, rdi
+  jne .L.break.main.162
+  mov dword ptr [rsp+6044], 1
+  jmp .L.label.main.80
+.L.case.main.164:
+  mov dword ptr [rsp+6044], 2
+  jmp .L.label.main.80
+.L.case.main.163:
+  mov dword ptr [rsp+6044], 3
+  jmp .L.label.main.80
+.L.break.main.162:
+  mov dword ptr [rsp+6044], 0
+.L.label.main.80:
+  movsxd rsi, dword ptr [rsp+6044]
+  mov qword ptr [rsp+6056], rsi
+  lea rsi, [rip+.L.data.main.63]
+  mov qword ptr [rsp+6048], rsi
+  mov rsi, qword ptr [rsp+6064]
+  cmp rsi, qword ptr [rsp+6056]
+  jne .L.else.main.167
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+6048]
+  mov r9, qword ptr [rsp+6056]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.168
+.L.else.main.167:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+6048]
+  mov r9, qword ptr [rsp+6064]
+  mov r10, qword ptr [rsp+6056]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.168:
+  mov qword ptr [rsp+6104], 1
+  mov rsi, 0
+  movabs rdi, 3000000000
+  sub rsi, rdi
+  mov qword ptr [rsp+6072], rsi
+  mov rsi, qword ptr [rsp+6072]
+  cmp rsi, 100
+  je .L.case.main.172
+  jg .L.upper.main.175
+  movabs rdi, -3000000000
+  cmp rsi, rdi
+  je .L.case.main.174
+  cmp rsi, 5
+  je .L.case.main.173
+  jmp .L.break.main.169
+.L.upper.main.175:
+  movabs rdi, 3000000000
+  cmp rsi, rdi
+  je .L.case.main.171
+  movabs rdi, 7000000000
+  cmp rsi, rdi
+  je .L.case.main.170
+  jmp .L.break.main.169
+.L.case.main.174:
+  mov dword ptr [rsp+6084], 1
+  jmp .L.label.main.82
+.L.case.main.173:
+  mov dword ptr [rsp+6084], 2
+  jmp .L.label.main.82
+.L.case.main.172:
+  mov dword ptr [rsp+6084], 3
+  jmp .L.label.main.82
+.L.case.main.171:
+  mov dword ptr [rsp+6084], 4
+  jmp .L.label.main.82
+.L.case.main.170:
+  mov dword ptr [rsp+6084], 5
+  jmp .L.label.main.82
+.L.break.main.169:
+  mov dword ptr [rsp+6084], 0
+.L.label.main.82:
+  movsxd rsi, dword ptr [rsp+6084]
+  mov qword ptr [rsp+6096], rsi
+  lea rsi, [rip+.L.data.main.64]
+  mov qword ptr [rsp+6088], rsi
+  mov rsi, qword ptr [rsp+6104]
+  cmp rsi, qword ptr [rsp+6096]
+  jne .L.else.main.177
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+6088]
+  mov r9, qword ptr [rsp+6096]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.178
+.L.else.main.177:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+6088]
+  mov r9, qword ptr [rsp+6104]
+  mov r10, qword ptr [rsp+6096]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.178:
+  mov qword ptr [rsp+6144], 4
+  movabs rsi, 3000000000
+  mov qword ptr [rsp+6112], rsi
+  mov rsi, qword ptr [rsp+6112]
+  cmp rsi, 100
+  je .L.case.main.182
+  jg .L.upper.main.185
+  movabs rdi, -3000000000
+  cmp rsi, rdi
+  je .L.case.main.184
+  cmp rsi, 5
+  je .L.case.main.183
+  jmp .L.break.main.179
+.L.upper.main.185:
+  movabs rdi, 3000000000
+  cmp rsi, rdi
+  je .L.case.main.181
+  movabs rdi, 7000000000
+  cmp rsi, rdi
+  je .L.case.main.180
+  jmp .L.break.main.179
+.L.case.main.184:
+  mov dword ptr [rsp+6124], 1
+  jmp .L.label.main.84
+.L.case.main.183:
+  mov dword ptr [rsp+6124], 2
+  jmp .L.label.main.84
+.L.case.main.182:
+  mov dword ptr [rsp+6124], 3
+  jmp .L.label.main.84
+.L.case.main.181:
+  mov dword ptr [rsp+6124], 4
+  jmp .L.label.main.84
+.L.case.main.180:
+  mov dword ptr [rsp+6124], 5
+  jmp .L.label.main.84
+.L.break.main.179:
+  mov dword ptr [rsp+6124], 0
+.L.label.main.84:
+  movsxd rsi, dword ptr [rsp+6124]
+  mov qword ptr [rsp+6136], rsi
+  lea rsi, [rip+.L.data.main.65]
+  mov qword ptr [rsp+6128], rsi
+  mov rsi, qword ptr [rsp+6144]
+  cmp rsi, qword ptr [rsp+6136]
+  jne .L.else.main.187
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+6128]
+  mov r9, qword ptr [rsp+6136]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.188
+.L.else.main.187:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+6128]
+  mov r9, qword ptr [rsp+6144]
+  mov r10, qword ptr [rsp+6136]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.188:
+  mov qword ptr [rsp+6184], 5
+  movabs rsi, 7000000000
+  mov qword ptr [rsp+6152], rsi
+  mov rsi, qword ptr [rsp+6152]
+  cmp rsi, 100
+  je .L.case.main.192
+  jg .L.upper.main.195
+  movabs rdi, -3000000000
+  cmp rsi, rdi
+  je .L.case.main.194
+  cmp rsi, 5
+  je .L.case.main.193
+  jmp .L.break.main.189
+.L.upper.main.195:
+  movabs rdi, 3000000000
+  cmp rsi, rdi
+  je .L.case.main.191
+  movabs rdi, 7000000000
+  cmp rsi, rdi
+  je .L.case.main.190
+  jmp .L.break.main.189
+.L.case.main.194:
+  mov dword ptr [rsp+6164], 1
+  jmp .L.label.main.86
+.L.case.main.193:
+  mov dword ptr [rsp+6164], 2
+  jmp .L.label.main.86
+.L.case.main.192:
+  mov dword ptr [rsp+6164], 3
+  jmp .L.label.main.86
+.L.case.main.191:
+  mov dword ptr [rsp+6164], 4
+  jmp .L.label.main.86
+.L.case.main.190:
+  mov dword ptr [rsp+6164], 5
+  jmp .L.label.main.86
+.L.break.main.189:
+  mov dword ptr [rsp+6164], 0
+.L.label.main.86:
+  movsxd rsi, dword ptr [rsp+6164]
+  mov qword ptr [rsp+6176], rsi
+  lea rsi, [rip+.L.data.main.66]
+  mov qword ptr [rsp+6168], rsi
+  mov rsi, qword ptr [rsp+6184]
+  cmp rsi, qword ptr [rsp+6176]
+  jne .L.else.main.197
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+6168]
+  mov r9, qword ptr [rsp+6176]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.198
+.L.else.main.197:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+6168]
+  mov r9, qword ptr [rsp+6184]
+  mov r10, qword ptr [rsp+6176]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.198:
+  mov qword ptr [rsp+6224], 0
+  mov qword ptr [rsp+6192], 6
+  mov rsi, qword ptr [rsp+6192]
+  cmp rsi, 100
+  je .L.case.main.202
+  jg .L.upper.main.205
+  movabs rdi, -3000000000
+  cmp rsi, rdi
+  je .L.case.main.204
+  cmp rsi, 5
+  je .L.case.main.203
+  jmp .L.break.main.199
+.L.upper.main.205:
+  movabs rdi, 3000000000
+  cmp rsi, rdi
+  je .L.case.main.201
+  movabs rdi, 7000000000
+  cmp rsi, rdi
+  je .L.case.main.200
+  jmp .L.break.main.199
+.L.case.main.204:
+  mov dword ptr [rsp+6204], 1
+  jmp .L.label.main.88
+.L.case.main.203:
+  mov dword ptr [rsp+6204], 2
+  jmp .L.label.main.88
+.L.case.main.202:
+  mov dword ptr [rsp+6204], 3
+  jmp .L.label.main.88
+.L.case.main.201:
+  mov dword ptr [rsp+6204], 4
+  jmp .L.label.main.88
+.L.case.main.200:
+  mov dword ptr [rsp+6204], 5
+  jmp .L.label.main.88
+.L.break.main.199:
+  mov dword ptr [rsp+6204], 0
+.L.label.main.88:
+  movsxd rsi, dword ptr [rsp+6204]
+  mov qword ptr [rsp+6216], rsi
+  lea rsi, [rip+.L.data.main.67]
+  mov qword ptr [rsp+6208], rsi
+  mov rsi, qword ptr [rsp+6224]
+  cmp rsi, qword ptr [rsp+6216]
+  jne .L.else.main.207
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+6208]
+  mov r9, qword ptr [rsp+6216]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.208
+.L.else.main.207:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+6208]
+  mov r9, qword ptr [rsp+6224]
+  mov r10, qword ptr [rsp+6216]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.208:
+  mov qword ptr [rsp+6264], 1
+  movabs rsi, 3000000000
+  mov qword ptr [rsp+6232], rsi
+  mov rsi, qword ptr [rsp+6232]
+  movabs rdi, 3000000000
+  sub rsi, rdi
+  cmp rsi, 4
+  ja .L.break.main.209
+  lea rdi, [rip+.L.table.main.214]
+  shl rsi, 2
+  add rsi, rdi
+  movsxd rsi, dword ptr [rsi]
+  add rsi, rdi
+  jmp rsi
+.L.table.main.214:
+  .long .L.case.main.213-.L.table.main.214
+  .long .L.case.main.212-.L.table.main.214
+  .long .L.case.main.211-.L.table.main.214
+  .long .L.break.main.209-.L.table.main.214
+  .long .L.case.main.210-.L.table.main.214
+.L.case.main.213:
+  mov dword ptr [rsp+6244], 1
+  jmp .L.label.main.90
+.L.case.main.212:
+  mov dword ptr [rsp+6244], 2
+  jmp .L.label.main.90
+.L.case.main.211:
+  mov dword ptr [rsp+6244], 3
+  jmp .L.label.main.90
+.L.case.main.210:
+  mov dword ptr [rsp+6244], 4
+  jmp .L.label.main.90
+.L.break.main.209:
+  mov dword ptr [rsp+6244], 0
+.L.label.main.90:
+  movsxd rsi, dword ptr [rsp+6244]
+  mov qword ptr [rsp+6256], rsi
+  lea rsi, [rip+.L.data.main.68]
+  mov qword ptr [rsp+6248], rsi
+  mov rsi, qword ptr [rsp+6264]
+  cmp rsi, qword ptr [rsp+6256]
+  jne .L.else.main.216
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+6248]
+  mov r9, qword ptr [rsp+6256]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.217
+.L.else.main.216:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+6248]
+  mov r9, qword ptr [rsp+6264]
+  mov r10, qword ptr [rsp+6256]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.217:
+  mov qword ptr [rsp+6304], 4
+  movabs rsi, 3000000004
+  mov qword ptr [rsp+6272], rsi
+  mov rsi, qword ptr [rsp+6272]
+  movabs rdi, 3000000000
+  sub rsi, rdi
+  cmp rsi, 4
+  ja .L.break.main.218
+  lea rdi, [rip+.L.table.main.223]
+  shl rsi, 2
+  add rsi, rdi
+  movsxd rsi, dword ptr [rsi]
+  add rsi, rdi
+  jmp rsi
+.L.table.main.223:
+  .long .L.case.main.222-.L.table.main.223
+  .long .L.case.main.221-.L.table.main.223
+  .long .L.case.main.220-.L.table.main.223
+  .long .L.break.main.218-.L.table.main.223
+  .long .L.case.main.219-.L.table.main.223
+.L.case.main.222:
+  mov dword ptr [rsp+6284], 1
+  jmp .L.label.main.92
+.L.case.main.221:
+  mov dword ptr [rsp+6284], 2
+  jmp .L.label.main.92
+.L.case.main.220:
+  mov dword ptr [rsp+6284], 3
+  jmp .L.label.main.92
+.L.case.main.219:
+  mov dword ptr [rsp+6284], 4
+  jmp .L.label.main.92
+.L.break.main.218:
+  mov dword ptr [rsp+6284], 0
+.L.label.main.92:
+  movsxd rsi, dword ptr [rsp+6284]
+  mov qword ptr [rsp+6296], rsi
+  lea rsi, [rip+.L.data.main.69]
+  mov qword ptr [rsp+6288], rsi
+  mov rsi, qword ptr [rsp+6304]
+  cmp rsi, qword ptr [rsp+6296]
+  jne .L.else.main.225
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+6288]
+  mov r9, qword ptr [rsp+6296]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.226
+.L.else.main.225:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+6288]
+  mov r9, qword ptr [rsp+6304]
+  mov r10, qword ptr [rsp+6296]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.226:
+  mov qword ptr [rsp+6344], 0
+  movabs rsi, 3000000003
+  mov qword ptr [rsp+6312], rsi
+  mov rsi, qword ptr [rsp+6312]
+  movabs rdi, 3000000000
+  sub rsi, rdi
+  cmp rsi, 4
+  ja .L.break.main.227
+  lea rdi, [rip+.L.table.main.232]
+  shl rsi, 2
+  add rsi, rdi
+  movsxd rsi, dword ptr [rsi]
+  add rsi, rdi
+  jmp rsi
+.L.table.main.232:
+  .long .L.case.main.231-.L.table.main.232
+  .long .L.case.main.230-.L.table.main.232
+  .long .L.case.main.229-.L.table.main.232
+  .long .L.break.main.227-.L.table.main.232
+  .long .L.case.main.228-.L.table.main.232
+.L.case.main.231:
+  mov dword ptr [rsp+6324], 1
+  jmp .L.label.main.94
+.L.case.main.230:
+  mov dword ptr [rsp+6324], 2
+  jmp .L.label.main.94
+.L.case.main.229:
+  mov dword ptr [rsp+6324], 3
+  jmp .L.label.main.94
+.L.case.main.228:
+  mov dword ptr [rsp+6324], 4
+  jmp .L.label.main.94
+.L.break.main.227:
+  mov dword ptr [rsp+6324], 0
+.L.label.main.94:
+  movsxd rsi, dword ptr [rsp+6324]
+  mov qword ptr [rsp+6336], rsi
+  lea rsi, [rip+.L.data.main.70]
+  mov qword ptr [rsp+6328], rsi
+  mov rsi, qword ptr [rsp+6344]
+  cmp rsi, qword ptr [rsp+6336]
+  jne .L.else.main.234
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+6328]
+  mov r9, qword ptr [rsp+6336]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.235
+.L.else.main.234:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+6328]
+  mov r9, qword ptr [rsp+6344]
+  mov r10, qword ptr [rsp+6336]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.235:
+  mov qword ptr [rsp+6384], 0
+  mov qword ptr [rsp+6352], 4
+  mov rsi, qword ptr [rsp+6352]
+  movabs rdi, 3000000000
+  sub rsi, rdi
+  cmp rsi, 4
+  ja .L.break.main.236
+  lea rdi, [rip+.L.table.main.241]
+  shl rsi, 2
+  add rsi, rdi
+  movsxd rsi, dword ptr [rsi]
+  add rsi, rdi
+  jmp rsi
+.L.table.main.241:
+  .long .L.case.main.240-.L.table.main.241
+  .long .L.case.main.239-.L.table.main.241
+  .long .L.case.main.238-.L.table.main.241
+  .long .L.break.main.236-.L.table.main.241
+  .long .L.case.main.237-.L.table.main.241
+.L.case.main.240:
+  mov dword ptr [rsp+6364], 1
+  jmp .L.label.main.96
+.L.case.main.239:
+  mov dword ptr [rsp+6364], 2
+  jmp .L.label.main.96
+.L.case.main.238:
+  mov dword ptr [rsp+6364], 3
+  jmp .L.label.main.96
+.L.case.main.237:
+  mov dword ptr [rsp+6364], 4
+  jmp .L.label.main.96
+.L.break.main.236:
+  mov dword ptr [rsp+6364], 0
+.L.label.main.96:
+  movsxd rsi, dword ptr [rsp+6364]
+  mov qword ptr [rsp+6376], rsi
+  lea rsi, [rip+.L.data.main.71]
+  mov qword ptr [rsp+6368], rsi
+  mov rsi, qword ptr [rsp+6384]
+  cmp rsi, qword ptr [rsp+6376]
+  jne .L.else.main.243
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+6368]
+  mov r9, qword ptr [rsp+6376]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.244
+.L.else.main.243:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+6368]
+  mov r9, qword ptr [rsp+6384]
+  mov r10, qword ptr [rsp+6376]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.244:
+  mov qword ptr [rsp+6416], 1
+  mov rsi, 0
+  sub rsi, 1294967296
+  mov dword ptr [rsp+6392], esi
+  movsxd rsi, dword ptr [rsp+6392]
+  cmp rsi, -1294967296
+  jne .L.break.main.245
+  mov dword ptr [rsp+6396], 1
+  jmp .L.label.main.98
+.L.break.main.245:
+  mov dword ptr [rsp+6396], 0
+.L.label.main.98:
+  movsxd rsi, dword ptr [rsp+6396]
+  mov qword ptr [rsp+6408], rsi
+  lea rsi, [rip+.L.data.main.72]
+  mov qword ptr [rsp+6400], rsi
+  mov rsi, qword ptr [rsp+6416]
+  cmp rsi, qword ptr [rsp+6408]
+  jne .L.else.main.248
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+6400]
+  mov r9, qword ptr [rsp+6408]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.249
+.L.else.main.248:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+6400]
+  mov r9, qword ptr [rsp+6416]
+  mov r10, qword ptr [rsp+6408]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.249:
+  mov qword ptr [rsp+6440], 7864346
+  lea rsi, [rip+spill_g]
+  add rsi, 8
+  mov qword ptr [rsi], 3
+  mov rsi, 1
+  mov r8, 1
+  mov r9, 2
+  mov r10, 3
+  mov r11, 4
+  mov qword ptr [rsp+56], 5
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov r8, r11
+  mov r9, qword ptr [rsp+56]
+  mov rax, 0
+  call spill_addr
+  mov qword ptr [rsp+6432], rax
+  lea rsi, [rip+.L.data.main.73]
+  mov qword ptr [rsp+6424], rsi
+  mov rsi, qword ptr [rsp+6440]
+  cmp rsi, qword ptr [rsp+6432]
+  jne .L.else.main.250
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+6424]
+  mov r9, qword ptr [rsp+6432]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.251
+.L.else.main.250:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+6424]
+  mov r9, qword ptr [rsp+6440]
+  mov r10, qword ptr [rsp+6432]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.251:
+  mov rsi, 0
+  sub rsi, 1
+  mov qword ptr [rsp+6472], rsi
+  mov rsi, 0
+  sub rsi, 5
+  mov dword ptr [rsp+6448], esi
+  movsxd rsi, dword ptr [rsp+6448]
+  cmp rsi, 0
+  jge .L.end.main.252
+  mov rsi, 0
+  sub rsi, 1
+  mov dword ptr [rsp+6452], esi
+  jmp .L.label.main.101
+.L.end.main.252:
+  movsxd rsi, dword ptr [rsp+6448]
+  cmp rsi, 0
+  jne .L.end.main.254
+  mov dword ptr [rsp+6452], 0
+  jmp .L.label.main.101
+.L.end.main.254:
+  mov dword ptr [rsp+6452], 1
+.L.label.main.101:
+  movsxd rsi, dword ptr [rsp+6452]
+  mov qword ptr [rsp+6464], rsi
+  lea rsi, [rip+.L.data.main.74]
+  mov qword ptr [rsp+6456], rsi
+  mov rsi, qword ptr [rsp+6472]
+  cmp rsi, qword ptr [rsp+6464]
+  jne .L.else.main.255
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+6456]
+  mov r9, qword ptr [rsp+6464]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.256
+.L.else.main.255:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+6456]
+  mov r9, qword ptr [rsp+6472]
+  mov r10, qword ptr [rsp+6464]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.256:
+  mov qword ptr [rsp+6504], 0
+  mov dword ptr [rsp+6480], 0
+  movsxd rsi, dword ptr [rsp+6480]
+  cmp rsi, 0
+  jge .L.end.main.257
+  mov rsi, 0
+  sub rsi, 1
+  mov dword ptr [rsp+6484], esi
+  jmp .L.label.main.103
+.L.end.main.257:
+  movsxd rsi, dword ptr [rsp+6480]
+  cmp rsi, 0
+  jne .L.end.main.259
+  mov dword ptr [rsp+6484], 0
+  jmp .L.label.main.103
+.L.end.main.259:
+  mov dword ptr [rsp+6484], 1
+.L.label.main.103:
+  movsxd rsi, dword ptr [rsp+6484]
+  mov qword ptr [rsp+6496], rsi
+  lea rsi, [rip+.L.data.main.75]
+  mov qword ptr [rsp+6488], rsi
+  mov rsi, qword ptr [rsp+6504]
+  cmp rsi, qword ptr [rsp+6496]
+  jne .L.else.main.260
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+6488]
+  mov r9, qword ptr [rsp+6496]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.261
+.L.else.main.260:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+6488]
+  mov r9, qword ptr [rsp+6504]
+  mov r10, qword ptr [rsp+6496]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.261:
+  mov qword ptr [rsp+6536], 1
+  mov dword ptr [rsp+6512], 7
+  movsxd rsi, dword ptr [rsp+6512]
+  cmp rsi, 0
+  jge .L.end.main.262
+  mov rsi, 0
+  sub rsi, 1
+  mov dword ptr [rsp+6516], esi
+  jmp .L.label.main.105
+.L.end.main.262:
+  movsxd rsi, dword ptr [rsp+6512]
+  cmp rsi, 0
+  jne .L.end.main.264
+  mov dword ptr [rsp+6516], 0
+  jmp .L.label.main.105
+.L.end.main.264:
+  mov dword ptr [rsp+6516], 1
+.L.label.main.105:
+  movsxd rsi, dword ptr [rsp+6516]
+  mov qword ptr [rsp+6528], rsi
+  lea rsi, [rip+.L.data.main.76]
+  mov qword ptr [rsp+6520], rsi
+  mov rsi, qword ptr [rsp+6536]
+  cmp rsi, qword ptr [rsp+6528]
+  jne .L.else.main.265
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+6520]
+  mov r9, qword ptr [rsp+6528]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.266
+.L.else.main.265:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+6520]
+  mov r9, qword ptr [rsp+6536]
+  mov r10, qword ptr [rsp+6528]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.266:
+  mov qword ptr [rsp+6584], 1
+  mov dword ptr [rsp+6544], 3
+  movsxd rsi, dword ptr [rsp+6544]
+  cmp rsi, 0
+  jge .L.end.main.267
+  mov rsi, 0
+  sub rsi, 1
+  mov dword ptr [rsp+6548], esi
+  jmp .L.label.main.107
+.L.end.main.267:
+  movsxd rsi, dword ptr [rsp+6544]
+  cmp rsi, 0
+  jne .L.end.main.269
+  mov dword ptr [rsp+6548], 0
+  jmp .L.label.main.107
+.L.end.main.269:
+  mov dword ptr [rsp+6548], 1
+.L.label.main.107:
+  movsxd rsi, dword ptr [rsp+6548]
+  mov rdi, 0
+  sub rdi, 2
+  mov dword ptr [rsp+6552], edi
+  movsxd rdi, dword ptr [rsp+6552]
+  cmp rdi, 0
+  jge .L.end.main.270
+  mov rdi, 0
+  sub rdi, 1
+  mov dword ptr [rsp+6556], edi
+  jmp .L.label.main.108
+.L.end.main.270:
+  movsxd rdi, dword ptr [rsp+6552]
+  cmp rdi, 0
+  jne .L.end.main.272
+  mov dword ptr [rsp+6556], 0
+  jmp .L.label.main.108
+.L.end.main.272:
+  mov dword ptr [rsp+6556], 1
+.L.label.main.108:
+  movsxd rdi, dword ptr [rsp+6556]
+  add rsi, rdi
+  mov dword ptr [rsp+6560], 9
+  movsxd rdi, dword ptr [rsp+6560]
+  cmp rdi, 0
+  jge .L.end.main.273
+  mov rdi, 0
+  sub rdi, 1
+  mov dword ptr [rsp+6564], edi
+  jmp .L.label.main.109
+.L.end.main.273:
+  movsxd rdi, dword ptr [rsp+6560]
+  cmp rdi, 0
+  jne .L.end.main.275
+  mov dword ptr [rsp+6564], 0
+  jmp .L.label.main.109
+.L.end.main.275:
+  mov dword ptr [rsp+6564], 1
+.L.label.main.109:
+  movsxd rdi, dword ptr [rsp+6564]
+  add rsi, rdi
+  mov qword ptr [rsp+6576], rsi
+  lea rsi, [rip+.L.data.main.77]
+  mov qword ptr [rsp+6568], rsi
+  mov rsi, qword ptr [rsp+6584]
+  cmp rsi, qword ptr [rsp+6576]
+  jne .L.else.main.276
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+6568]
+  mov r9, qword ptr [rsp+6576]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.277
+.L.else.main.276:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+6568]
+  mov r9, qword ptr [rsp+6584]
+  mov r10, qword ptr [rsp+6576]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.277:
+  mov qword ptr [rsp+6616], 2
+  mov dword ptr [rsp+6592], 0
+  movsxd rsi, dword ptr [rsp+6592]
+  cmp rsi, 0
+  je .L.case.main.280
+  cmp rsi, 3
+  je .L.case.main.279
+  cmp rsi, 6
+  jne .L.break.main.278
+.L.case.main.280:
+  mov dword ptr [rsp+6596], 2
+  jmp .L.label.main.111
+.L.case.main.279:
+  mov dword ptr [rsp+6596], 1
+  jmp .L.label.main.111
+.L.break.main.278:
+  mov dword ptr [rsp+6596], 0
+.L.label.main.111:
+  movsxd rsi, dword ptr [rsp+6596]
+  mov qword ptr [rsp+6608], rsi
+  lea rsi, [rip+.L.data.main.78]
+  mov qword ptr [rsp+6600], rsi
+  mov rsi, qword ptr [rsp+6616]
+  cmp rsi, qword ptr [rsp+6608]
+  jne .L.else.main.283
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+6600]
+  mov r9, qword ptr [rsp+6608]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.284
+.L.else.main.283:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+6600]
+  mov r9, qword ptr [rsp+6616]
+  mov r10, qword ptr [rsp+6608]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.284:
+  mov qword ptr [rsp+6648], 2
+  mov dword ptr [rsp+6624], 6
+  movsxd rsi, dword ptr [rsp+6624]
+  cmp rsi, 0
+  je .L.case.main.287
+  cmp rsi, 3
+  je .L.case.main.286
+  cmp rsi, 6
+  jne .L.break.main.285
+.L.case.main.287:
+  mov dword ptr [rsp+6628], 2
+  jmp .L.label.main.113
+.L.case.main.286:
+  mov dword ptr [rsp+6628], 1
+  jmp .L.label.main.113
+.L.break.main.285:
+  mov dword ptr [rsp+6628], 0
+.L.label.main.113:
+  movsxd rsi, dword ptr [rsp+6628]
+  mov qword ptr [rsp+6640], rsi
+  lea rsi, [rip+.L.data.main.79]
+  mov qword ptr [rsp+6632], rsi
+  mov rsi, qword ptr [rsp+6648]
+  cmp rsi, qword ptr [rsp+6640]
+  jne .L.else.main.290
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+6632]
+  mov r9, qword ptr [rsp+6640]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.291
+.L.else.main.290:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+6632]
+  mov r9, qword ptr [rsp+6648]
+  mov r10, qword ptr [rsp+6640]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.291:
+  mov qword ptr [rsp+6680], 1
+  mov dword ptr [rsp+6656], 3
+  movsxd rsi, dword ptr [rsp+6656]
+  cmp rsi, 0
+  je .L.case.main.294
+  cmp rsi, 3
+  je .L.case.main.293
+  cmp rsi, 6
+  jne .L.break.main.292
+.L.case.main.294:
+  mov dword ptr [rsp+6660], 2
+  jmp .L.label.main.115
+.L.case.main.293:
+  mov dword ptr [rsp+6660], 1
+  jmp .L.label.main.115
+.L.break.main.292:
+  mov dword ptr [rsp+6660], 0
+.L.label.main.115:
+  movsxd rsi, dword ptr [rsp+6660]
+  mov qword ptr [rsp+6672], rsi
+  lea rsi, [rip+.L.data.main.80]
+  mov qword ptr [rsp+6664], rsi
+  mov rsi, qword ptr [rsp+6680]
+  cmp rsi, qword ptr [rsp+6672]
+  jne .L.else.main.297
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+6664]
+  mov r9, qword ptr [rsp+6672]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.298
+.L.else.main.297:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+6664]
+  mov r9, qword ptr [rsp+6680]
+  mov r10, qword ptr [rsp+6672]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.298:
+  mov qword ptr [rsp+6712], 0
+  mov dword ptr [rsp+6688], 4
+  movsxd rsi, dword ptr [rsp+6688]
+  cmp rsi, 0
+  je .L.case.main.301
+  cmp rsi, 3
+  je .L.case.main.300
+  cmp rsi, 6
+  jne .L.break.main.299
+.L.case.main.301:
+  mov dword ptr [rsp+6692], 2
+  jmp .L.label.main.117
+.L.case.main.300:
+  mov dword ptr [rsp+6692], 1
+  jmp .L.label.main.117
+.L.break.main.299:
+  mov dword ptr [rsp+6692], 0
+.L.label.main.117:
+  movsxd rsi, dword ptr [rsp+6692]
+  mov qword ptr [rsp+6704], rsi
+  lea rsi, [rip+.L.data.main.81]
+  mov qword ptr [rsp+6696], rsi
+  mov rsi, qword ptr [rsp+6712]
+  cmp rsi, qword ptr [rsp+6704]
+  jne .L.else.main.304
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+6696]
+  mov r9, qword ptr [rsp+6704]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.305
+.L.else.main.304:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+6696]
+  mov r9, qword ptr [rsp+6712]
+  mov r10, qword ptr [rsp+6704]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.305:
+  mov qword ptr [rsp+6744], 3
+  mov dword ptr [rsp+6720], 3
+  movsxd rsi, dword ptr [rsp+6720]
+  cmp rsi, 5
+  jg .L.label.main.big.119
+  movsxd rsi, dword ptr [rsp+6720]
+  mov dword ptr [rsp+6724], esi
+  jmp .L.label.main.119
+.L.label.main.big.119:
+  movsxd rsi, dword ptr [rsp+6720]
+  lea rsi, [rsi+rsi*4]
+  shl rsi, 1
+  mov dword ptr [rsp+6724], esi
+.L.label.main.119:
+  movsxd rsi, dword ptr [rsp+6724]
+  mov qword ptr [rsp+6736], rsi
+  lea rsi, [rip+.L.data.main.82]
+  mov qword ptr [rsp+6728], rsi
+  mov rsi, qword ptr [rsp+6744]
+  cmp rsi, qword ptr [rsp+6736]
+  jne .L.else.main.309
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+6728]
+  mov r9, qword ptr [rsp+6736]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.310
+.L.else.main.309:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+6728]
+  mov r9, qword ptr [rsp+6744]
+  mov r10, qword ptr [rsp+6736]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.310:
+  mov qword ptr [rsp+6776], 70
+  mov dword ptr [rsp+6752], 7
+  movsxd rsi, dword ptr [rsp+6752]
+  cmp rsi, 5
+  jg .L.label.main.big.121
+  movsxd rsi, dword ptr [rsp+6752]
+  mov dword ptr [rsp+6756], esi
+  jmp .L.label.main.121
+.L.label.main.big.121:
+  movsxd rsi, dword ptr [rsp+6752]
+  lea rsi, [rsi+rsi*4]
+  shl rsi, 1
+  mov dword ptr [rsp+6756], esi
+.L.label.main.121:
+  movsxd rsi, dword ptr [rsp+6756]
+  mov qword ptr [rsp+6768], rsi
+  lea rsi, [rip+.L.data.main.83]
+  mov qword ptr [rsp+6760], rsi
+  mov rsi, qword ptr [rsp+6776]
+  cmp rsi, qword ptr [rsp+6768]
+  jne .L.else.main.314
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+6760]
+  mov r9, qword ptr [rsp+6768]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.315
+.L.else.main.314:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+6760]
+  mov r9, qword ptr [rsp+6776]
+  mov r10, qword ptr [rsp+6768]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.315:
+  mov qword ptr [rsp+6816], 83
+  mov dword ptr [rsp+6784], 3
+  movsxd rsi, dword ptr [rsp+6784]
+  cmp rsi, 5
+  jg .L.label.main.big.123
+  movsxd rsi, dword ptr [rsp+6784]
+  mov dword ptr [rsp+6788], esi
+  jmp .L.label.main.123
+.L.label.main.big.123:
+  movsxd rsi, dword ptr [rsp+6784]
+  lea rsi, [rsi+rsi*4]
+  shl rsi, 1
+  mov dword ptr [rsp+6788], esi
+.L.label.main.123:
+  movsxd rsi, dword ptr [rsp+6788]
+  mov dword ptr [rsp+6792], 8
+  movsxd rdi, dword ptr [rsp+6792]
+  cmp rdi, 5
+  jg .L.label.main.big.124
+  movsxd rdi, dword ptr [rsp+6792]
+  mov dword ptr [rsp+6796], edi
+  jmp .L.label.main.124
+.L.label.main.big.124:
+  movsxd rdi, dword ptr [rsp+6792]
+  lea rdi, [rdi+rdi*4]
+  shl rdi, 1
+  mov dword ptr [rsp+6796], edi
+.L.label.main.124:
+  movsxd rdi, dword ptr [rsp+6796]
+  add rsi, rdi
+  mov qword ptr [rsp+6808], rsi
+  lea rsi, [rip+.L.data.main.84]
+  mov qword ptr [rsp+6800], rsi
+  mov rsi, qword ptr [rsp+6816]
+  cmp rsi, qword ptr [rsp+6808]
+  jne .L.else.main.322
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+6800]
+  mov r9, qword ptr [rsp+6808]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.323
+.L.else.main.322:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+6800]
+  mov r9, qword ptr [rsp+6816]
+  mov r10, qword ptr [rsp+6808]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.323:
+  mov qword ptr [rsp+6840], 2040
+  mov rsi, 4
+  mov r8, 5
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call sum_grid
+  mov qword ptr [rsp+6832], rax
+  lea rsi, [rip+.L.data.main.85]
+  mov qword ptr [rsp+6824], rsi
+  mov rsi, qword ptr [rsp+6840]
+  cmp rsi, qword ptr [rsp+6832]
+  jne .L.else.main.324
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+6824]
+  mov r9, qword ptr [rsp+6832]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.325
+.L.else.main.324:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+6824]
+  mov r9, qword ptr [rsp+6840]
+  mov r10, qword ptr [rsp+6832]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.325:
+  mov qword ptr [rsp+6864], 0
+  mov rsi, 0
+  mov r8, 5
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call sum_grid
+  mov qword ptr [rsp+6856], rax
+  lea rsi, [rip+.L.data.main.86]
+  mov qword ptr [rsp+6848], rsi
+  mov rsi, qword ptr [rsp+6864]
+  cmp rsi, qword ptr [rsp+6856]
+  jne .L.else.main.326
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+6848]
+  mov r9, qword ptr [rsp+6856]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.327
+.L.else.main.326:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+6848]
+  mov r9, qword ptr [rsp+6864]
+  mov r10, qword ptr [rsp+6856]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.327:
+  mov qword ptr [rsp+6904], 20
+  mov dword ptr [rsp+6884], 5
+  mov dword ptr [rip+loop_g], 0
+  mov dword ptr [rsp+6880], 0
+  mov dword ptr [rsp+6876], 0
+  movsxd rsi, dword ptr [rsp+6876]
+  movsxd rdi, dword ptr [rsp+6884]
+  cmp rsi, rdi
+  jge .L.break.main.329
+  movsxd rsi, dword ptr [rsp+6884]
+  .p2align 4,,10
+.L.begin.main.330:
+  movsxd rdi, dword ptr [rip+loop_g]
+  add dword ptr [rsp+6880], edi
+  add dword ptr [rip+loop_g], 2
+  add dword ptr [rsp+6876], 1
+  movsxd rdi, dword ptr [rsp+6876]
+  cmp rdi, rsi
+  jl .L.begin.main.330
+.L.break.main.329:
+  movsxd rsi, dword ptr [rsp+6880]
+  movsxd rsi, esi
+  mov qword ptr [rsp+6896], rsi
+  lea rsi, [rip+.L.data.main.87]
+  mov qword ptr [rsp+6888], rsi
+  mov rsi, qword ptr [rsp+6904]
+  cmp rsi, qword ptr [rsp+6896]
+  jne .L.else.main.331
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+6888]
+  mov r9, qword ptr [rsp+6896]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.332
+.L.else.main.331:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+6888]
+  mov r9, qword ptr [rsp+6904]
+  mov r10, qword ptr [rsp+6896]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.332:
+  mov qword ptr [rsp+6952], 10
+  mov dword ptr [rip+loop_g], 1
+  lea rsi, [rip+loop_g]
+  mov qword ptr [rsp+6928], rsi
+  mov dword ptr [rsp+6924], 4
+  mov dword ptr [rsp+6920], 0
+  mov dword ptr [rsp+6916], 0
+  movsxd rsi, dword ptr [rsp+6916]
+  movsxd rdi, dword ptr [rsp+6924]
+  cmp rsi, rdi
+  jge .L.break.main.334
+  .p2align 4,,10
+.L.begin.main.335:
+  movsxd rsi, dword ptr [rip+loop_g]
+  add dword ptr [rsp+6920], esi
+  mov rsi, qword ptr [rsp+6928]
+  add dword ptr [rsi], 1
+  add dword ptr [rsp+6916], 1
+  movsxd rsi, dword ptr [rsp+6916]
+  movsxd rdi, dword ptr [rsp+6924]
+  cmp rsi, rdi
+  jl .L.begin.main.335
+.L.break.main.334:
+  movsxd rsi, dword ptr [rsp+6920]
+  movsxd rsi, esi
+  mov qword ptr [rsp+6944], rsi
+  lea rsi, [rip+.L.data.main.88]
+  mov qword ptr [rsp+6936], rsi
+  mov rsi, qword ptr [rsp+6952]
+  cmp rsi, qword ptr [rsp+6944]
+  jne .L.else.main.336
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+6936]
+  mov r9, qword ptr [rsp+6944]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.337
+.L.else.main.336:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+6936]
+  mov r9, qword ptr [rsp+6952]
+  mov r10, qword ptr [rsp+6944]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.337:
+  mov qword ptr [rsp+7000], 8
+  mov dword ptr [rsp+300], 0
+  mov dword ptr [rip+loop_g], 2
+  lea rsi, [rsp+300]
+  mov qword ptr [rsp+6976], rsi
+  mov dword ptr [rsp+6972], 4
+  mov dword ptr [rsp+6968], 0
+  mov dword ptr [rsp+6964], 0
+  movsxd rsi, dword ptr [rsp+6964]
+  movsxd rdi, dword ptr [rsp+6972]
+  cmp rsi, rdi
+  jge .L.break.main.339
+  .p2align 4,,10
+.L.begin.main.340:
+  movsxd rsi, dword ptr [rip+loop_g]
+  add dword ptr [rsp+6968], esi
+  mov rsi, qword ptr [rsp+6976]
+  add dword ptr [rsi], 1
+  add dword ptr [rsp+6964], 1
+  movsxd rsi, dword ptr [rsp+6964]
+  movsxd rdi, dword ptr [rsp+6972]
+  cmp rsi, rdi
+  jl .L.begin.main.340
+.L.break.main.339:
+  movsxd rsi, dword ptr [rsp+6968]
+  movsxd rsi, esi
+  mov qword ptr [rsp+6992], rsi
+  lea rsi, [rip+.L.data.main.89]
+  mov qword ptr [rsp+6984], rsi
+  mov rsi, qword ptr [rsp+7000]
+  cmp rsi, qword ptr [rsp+6992]
+  jne .L.else.main.341
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+6984]
+  mov r9, qword ptr [rsp+6992]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.342
+.L.else.main.341:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+6984]
+  mov r9, qword ptr [rsp+7000]
+  mov r10, qword ptr [rsp+6992]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.342:
+  mov qword ptr [rsp+7024], 10
+  mov rdi, 4
+  mov rax, 0
+  call sum_local_through
+  mov qword ptr [rsp+7016], rax
+  lea rsi, [rip+.L.data.main.90]
+  mov qword ptr [rsp+7008], rsi
+  mov rsi, qword ptr [rsp+7024]
+  cmp rsi, qword ptr [rsp+7016]
+  jne .L.else.main.343
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7008]
+  mov r9, qword ptr [rsp+7016]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.344
+.L.else.main.343:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7008]
+  mov r9, qword ptr [rsp+7024]
+  mov r10, qword ptr [rsp+7016]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.344:
+  mov qword ptr [rsp+7072], 0
+  mov qword ptr [rsp+7048], 0
+  mov dword ptr [rsp+7044], 0
+  mov dword ptr [rsp+7040], 0
+  mov dword ptr [rsp+7036], 0
+  movsxd rsi, dword ptr [rsp+7036]
+  movsxd rdi, dword ptr [rsp+7044]
+  cmp rsi, rdi
+  jge .L.break.main.346
+  mov rsi, qword ptr [rsp+7048]
+  movsxd rdi, dword ptr [rsp+7044]
+  .p2align 4,,10
+.L.begin.main.347:
+  movsxd r8, dword ptr [rsi]
+  add dword ptr [rsp+7040], r8d
+  add dword ptr [rsp+7036], 1
+  movsxd r8, dword ptr [rsp+7036]
+  cmp r8, rdi
+  jl .L.begin.main.347
+.L.break.main.346:
+  movsxd rsi, dword ptr [rsp+7040]
+  movsxd rsi, esi
+  mov qword ptr [rsp+7064], rsi
+  lea rsi, [rip+.L.data.main.91]
+  mov qword ptr [rsp+7056], rsi
+  mov rsi, qword ptr [rsp+7072]
+  cmp rsi, qword ptr [rsp+7064]
+  jne .L.else.main.348
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7056]
+  mov r9, qword ptr [rsp+7064]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.349
+.L.else.main.348:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7056]
+  mov r9, qword ptr [rsp+7072]
+  mov r10, qword ptr [rsp+7064]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.349:
+  mov qword ptr [rsp+7120], 21
+  mov dword ptr [rsp+304], 7
+  lea rsi, [rsp+304]
+  mov qword ptr [rsp+7096], rsi
+  mov dword ptr [rsp+7092], 3
+  mov dword ptr [rsp+7088], 0
+  mov dword ptr [rsp+7084], 0
+  movsxd rsi, dword ptr [rsp+7084]
+  movsxd rdi, dword ptr [rsp+7092]
+  cmp rsi, rdi
+  jge .L.break.main.351
+  mov rsi, qword ptr [rsp+7096]
+  movsxd rdi, dword ptr [rsp+7092]
+  .p2align 4,,10
+.L.begin.main.352:
+  movsxd r8, dword ptr [rsi]
+  add dword ptr [rsp+7088], r8d
+  add dword ptr [rsp+7084], 1
+  movsxd r8, dword ptr [rsp+7084]
+  cmp r8, rdi
+  jl .L.begin.main.352
+.L.break.main.351:
+  movsxd rsi, dword ptr [rsp+7088]
+  movsxd rsi, esi
+  mov qword ptr [rsp+7112], rsi
+  lea rsi, [rip+.L.data.main.92]
+  mov qword ptr [rsp+7104], rsi
+  mov rsi, qword ptr [rsp+7120]
+  cmp rsi, qword ptr [rsp+7112]
+  jne .L.else.main.353
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7104]
+  mov r9, qword ptr [rsp+7112]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.354
+.L.else.main.353:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7104]
+  mov r9, qword ptr [rsp+7120]
+  mov r10, qword ptr [rsp+7112]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.354:
+  mov qword ptr [rsp+7160], 2
+  mov dword ptr [rsp+308], 0
+  lea rsi, [rsp+308]
+  mov qword ptr [rsp+7128], rsi
+  mov rsi, qword ptr [rsp+7128]
+  add dword ptr [rsi], 1
+  lea rsi, [rsp+308]
+  mov qword ptr [rsp+7136], rsi
+  mov rsi, qword ptr [rsp+7136]
+  add dword ptr [rsi], 1
+  movsxd rsi, dword ptr [rsp+308]
+  mov qword ptr [rsp+7152], rsi
+  lea rsi, [rip+.L.data.main.93]
+  mov qword ptr [rsp+7144], rsi
+  mov rsi, qword ptr [rsp+7160]
+  cmp rsi, qword ptr [rsp+7152]
+  jne .L.else.main.355
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7144]
+  mov r9, qword ptr [rsp+7152]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.356
+.L.else.main.355:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7144]
+  mov r9, qword ptr [rsp+7160]
+  mov r10, qword ptr [rsp+7152]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.356:
+  mov qword ptr [rsp+7192], 64
+  mov dword ptr [rsp+312], 3
+  movsxd rsi, dword ptr [rsp+312]
+  add rsi, 1
+  mov dword ptr [rsp+312], esi
+  sub rsi, 1
+  mov dword ptr [rsp+7172], esi
+  movsxd rsi, dword ptr [rsp+7172]
+  movsxd rdi, dword ptr [rsp+7172]
+  add rsi, rdi
+  movsxd rsi, esi
+  mov dword ptr [rsp+316], esi
+  movsxd rsi, dword ptr [rsp+316]
+  lea rsi, [rsi+rsi*4]
+  shl rsi, 1
+  movsxd rdi, dword ptr [rsp+312]
+  add rsi, rdi
+  mov qword ptr [rsp+7184], rsi
+  lea rsi, [rip+.L.data.main.94]
+  mov qword ptr [rsp+7176], rsi
+  mov rsi, qword ptr [rsp+7192]
+  cmp rsi, qword ptr [rsp+7184]
+  jne .L.else.main.357
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7176]
+  mov r9, qword ptr [rsp+7184]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.358
+.L.else.main.357:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7176]
+  mov r9, qword ptr [rsp+7192]
+  mov r10, qword ptr [rsp+7184]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.358:
+  mov qword ptr [rsp+7232], 24
+  mov dword ptr [rsp+7204], 3
+  movsxd rsi, dword ptr [rsp+7204]
+  movsxd rdi, dword ptr [rsp+7204]
+  add rsi, rdi
+  movsxd rsi, esi
+  mov dword ptr [rsp+7208], esi
+  movsxd rsi, dword ptr [rsp+7208]
+  movsxd rdi, dword ptr [rsp+7208]
+  add rsi, rdi
+  movsxd rsi, esi
+  mov dword ptr [rsp+7212], esi
+  movsxd rsi, dword ptr [rsp+7212]
+  movsxd rdi, dword ptr [rsp+7212]
+  add rsi, rdi
+  movsxd rsi, esi
+  mov qword ptr [rsp+7224], rsi
+  lea rsi, [rip+.L.data.main.95]
+  mov qword ptr [rsp+7216], rsi
+  mov rsi, qword ptr [rsp+7232]
+  cmp rsi, qword ptr [rsp+7224]
+  jne .L.else.main.359
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7216]
+  mov r9, qword ptr [rsp+7224]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.360
+.L.else.main.359:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7216]
+  mov r9, qword ptr [rsp+7232]
+  mov r10, qword ptr [rsp+7224]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.360:
+  mov qword ptr [rsp+7256], 3
+  mov dword ptr [rsp+320], 3
+  movsxd rsi, dword ptr [rsp+320]
+  mov qword ptr [rsp+7248], rsi
+  lea rsi, [rip+.L.data.main.96]
+  mov qword ptr [rsp+7240], rsi
+  mov rsi, qword ptr [rsp+7256]
+  cmp rsi, qword ptr [rsp+7248]
+  jne .L.else.main.361
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7240]
+  mov r9, qword ptr [rsp+7248]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.362
+.L.else.main.361:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7240]
+  mov r9, qword ptr [rsp+7256]
+  mov r10, qword ptr [rsp+7248]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.362:
+  mov qword ptr [rsp+7280], 3
+  mov dword ptr [rsp+324], 3
+  lea rsi, [rsp+324]
+  mov qword ptr [rsp+328], rsi
+  lea rsi, [rsp+328]
+  mov qword ptr [rsp+336], rsi
+  mov rsi, qword ptr [rsp+336]
+  mov rsi, qword ptr [rsi]
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+7272], rsi
+  lea rsi, [rip+.L.data.main.97]
+  mov qword ptr [rsp+7264], rsi
+  mov rsi, qword ptr [rsp+7280]
+  cmp rsi, qword ptr [rsp+7272]
+  jne .L.else.main.363
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7264]
+  mov r9, qword ptr [rsp+7272]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.364
+.L.else.main.363:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7264]
+  mov r9, qword ptr [rsp+7280]
+  mov r10, qword ptr [rsp+7272]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.364:
+  mov qword ptr [rsp+7304], 5
+  mov dword ptr [rsp+348], 3
+  mov dword ptr [rsp+352], 5
+  lea rsi, [rsp+348]
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+7296], rsi
+  lea rsi, [rip+.L.data.main.98]
+  mov qword ptr [rsp+7288], rsi
+  mov rsi, qword ptr [rsp+7304]
+  cmp rsi, qword ptr [rsp+7296]
+  jne .L.else.main.365
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7288]
+  mov r9, qword ptr [rsp+7296]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.366
+.L.else.main.365:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7288]
+  mov r9, qword ptr [rsp+7304]
+  mov r10, qword ptr [rsp+7296]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.366:
+  mov qword ptr [rsp+7328], 5
+  mov dword ptr [rsp+356], 3
+  mov dword ptr [rsp+360], 5
+  lea rsi, [rsp+356]
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+7320], rsi
+  lea rsi, [rip+.L.data.main.99]
+  mov qword ptr [rsp+7312], rsi
+  mov rsi, qword ptr [rsp+7328]
+  cmp rsi, qword ptr [rsp+7320]
+  jne .L.else.main.367
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7312]
+  mov r9, qword ptr [rsp+7320]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.368
+.L.else.main.367:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7312]
+  mov r9, qword ptr [rsp+7328]
+  mov r10, qword ptr [rsp+7320]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.368:
+  mov qword ptr [rsp+7352], 3
+  mov dword ptr [rsp+364], 3
+  mov dword ptr [rsp+368], 5
+  lea rsi, [rsp+368]
+  sub rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+7344], rsi
+  lea rsi, [rip+.L.data.main.100]
+  mov qword ptr [rsp+7336], rsi
+  mov rsi, qword ptr [rsp+7352]
+  cmp rsi, qword ptr [rsp+7344]
+  jne .L.else.main.369
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7336]
+  mov r9, qword ptr [rsp+7344]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.370
+.L.else.main.369:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7336]
+  mov r9, qword ptr [rsp+7352]
+  mov r10, qword ptr [rsp+7344]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.370:
+  mov qword ptr [rsp+7376], 2
+  mov dword ptr [rsp+372], 3
+  lea rsi, [rsp+372]
+  add rsi, 8
+  lea rdi, [rsp+372]
+  sub rsi, rdi
+  sar rsi, 2
+  mov qword ptr [rsp+7368], rsi
+  lea rsi, [rip+.L.data.main.101]
+  mov qword ptr [rsp+7360], rsi
+  mov rsi, qword ptr [rsp+7376]
+  cmp rsi, qword ptr [rsp+7368]
+  jne .L.else.main.371
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7360]
+  mov r9, qword ptr [rsp+7368]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.372
+.L.else.main.371:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7360]
+  mov r9, qword ptr [rsp+7376]
+  mov r10, qword ptr [rsp+7368]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.372:
+  mov qword ptr [rsp+7400], 5
+  mov dword ptr [rsp+376], 3
+  mov dword ptr [rsp+380], 5
+  lea rsi, [rsp+376]
+  mov qword ptr [rsp+384], rsi
+  mov rsi, qword ptr [rsp+384]
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+7392], rsi
+  lea rsi, [rip+.L.data.main.102]
+  mov qword ptr [rsp+7384], rsi
+  mov rsi, qword ptr [rsp+7400]
+  cmp rsi, qword ptr [rsp+7392]
+  jne .L.else.main.373
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7384]
+  mov r9, qword ptr [rsp+7392]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.374
+.L.else.main.373:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7384]
+  mov r9, qword ptr [rsp+7400]
+  mov r10, qword ptr [rsp+7392]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.374:
+  mov qword ptr [rsp+7424], 3
+  mov dword ptr [rsp+392], 3
+  mov dword ptr [rsp+396], 5
+  lea rsi, [rsp+396]
+  mov qword ptr [rsp+400], rsi
+  mov rsi, qword ptr [rsp+400]
+  sub rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+7416], rsi
+  lea rsi, [rip+.L.data.main.103]
+  mov qword ptr [rsp+7408], rsi
+  mov rsi, qword ptr [rsp+7424]
+  cmp rsi, qword ptr [rsp+7416]
+  jne .L.else.main.375
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7408]
+  mov r9, qword ptr [rsp+7416]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.376
+.L.else.main.375:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7408]
+  mov r9, qword ptr [rsp+7424]
+  mov r10, qword ptr [rsp+7416]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.376:
+  mov qword ptr [rsp+7448], 5
+  mov dword ptr [rsp+412], 3
+  lea rsi, [rsp+412]
+  mov qword ptr [rsp+416], rsi
+  mov rsi, qword ptr [rsp+416]
+  mov dword ptr [rsi], 5
+  movsxd rsi, dword ptr [rsp+412]
+  mov qword ptr [rsp+7440], rsi
+  lea rsi, [rip+.L.data.main.104]
+  mov qword ptr [rsp+7432], rsi
+  mov rsi, qword ptr [rsp+7448]
+  cmp rsi, qword ptr [rsp+7440]
+  jne .L.else.main.377
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7432]
+  mov r9, qword ptr [rsp+7440]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.378
+.L.else.main.377:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7432]
+  mov r9, qword ptr [rsp+7448]
+  mov r10, qword ptr [rsp+7440]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.378:
+  mov qword ptr [rsp+7472], 7
+  mov dword ptr [rsp+424], 3
+  mov dword ptr [rsp+428], 5
+  lea rsi, [rsp+424]
+  add rsi, 4
+  mov dword ptr [rsi], 7
+  movsxd rsi, dword ptr [rsp+428]
+  mov qword ptr [rsp+7464], rsi
+  lea rsi, [rip+.L.data.main.105]
+  mov qword ptr [rsp+7456], rsi
+  mov rsi, qword ptr [rsp+7472]
+  cmp rsi, qword ptr [rsp+7464]
+  jne .L.else.main.379
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7456]
+  mov r9, qword ptr [rsp+7464]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.380
+.L.else.main.379:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7456]
+  mov r9, qword ptr [rsp+7472]
+  mov r10, qword ptr [rsp+7464]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.380:
+  mov qword ptr [rsp+7496], 7
+  mov dword ptr [rsp+432], 3
+  mov dword ptr [rsp+436], 5
+  lea rsi, [rsp+436]
+  sub rsi, 4
+  mov dword ptr [rsi], 7
+  movsxd rsi, dword ptr [rsp+432]
+  mov qword ptr [rsp+7488], rsi
+  lea rsi, [rip+.L.data.main.106]
+  mov qword ptr [rsp+7480], rsi
+  mov rsi, qword ptr [rsp+7496]
+  cmp rsi, qword ptr [rsp+7488]
+  jne .L.else.main.381
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7480]
+  mov r9, qword ptr [rsp+7488]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.382
+.L.else.main.381:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7480]
+  mov r9, qword ptr [rsp+7496]
+  mov r10, qword ptr [rsp+7488]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.382:
+  mov qword ptr [rsp+7536], 8
+  mov dword ptr [rsp+440], 3
+  mov dword ptr [rsp+444], 5
+  lea rsi, [rsp+440]
+  mov qword ptr [rsp+7512], rsi
+  movsxd rsi, dword ptr [rsp+444]
+  mov dword ptr [rsp+7508], esi
+  mov rsi, qword ptr [rsp+7512]
+  movsxd rsi, dword ptr [rsi]
+  movsxd rdi, dword ptr [rsp+7508]
+  add rsi, rdi
+  movsxd rsi, esi
+  mov qword ptr [rsp+7528], rsi
+  lea rsi, [rip+.L.data.main.107]
+  mov qword ptr [rsp+7520], rsi
+  mov rsi, qword ptr [rsp+7536]
+  cmp rsi, qword ptr [rsp+7528]
+  jne .L.else.main.383
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7520]
+  mov r9, qword ptr [rsp+7528]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.384
+.L.else.main.383:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7520]
+  mov r9, qword ptr [rsp+7536]
+  mov r10, qword ptr [rsp+7528]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.384:
+  mov qword ptr [rsp+7560], 3
+  lea rsi, [rsp+448]
+  mov qword ptr [rsp+456], rsi
+  mov rsi, qword ptr [rsp+456]
+  mov dword ptr [rsi], 3
+  movsxd rsi, dword ptr [rsp+448]
+  mov qword ptr [rsp+7552], rsi
+  lea rsi, [rip+.L.data.main.108]
+  mov qword ptr [rsp+7544], rsi
+  mov rsi, qword ptr [rsp+7560]
+  cmp rsi, qword ptr [rsp+7552]
+  jne .L.else.main.385
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7544]
+  mov r9, qword ptr [rsp+7552]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.386
+.L.else.main.385:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7544]
+  mov r9, qword ptr [rsp+7560]
+  mov r10, qword ptr [rsp+7552]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.386:
+  mov qword ptr [rsp+7584], 3
+  mov dword ptr [rsp+468], 3
+  lea rsi, [rsp+468]
+  add rsi, 4
+  mov dword ptr [rsi], 4
+  lea rsi, [rsp+468]
+  add rsi, 8
+  mov dword ptr [rsi], 5
+  movsxd rsi, dword ptr [rsp+468]
+  mov qword ptr [rsp+7576], rsi
+  lea rsi, [rip+.L.data.main.109]
+  mov qword ptr [rsp+7568], rsi
+  mov rsi, qword ptr [rsp+7584]
+  cmp rsi, qword ptr [rsp+7576]
+  jne .L.else.main.387
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7568]
+  mov r9, qword ptr [rsp+7576]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.388
+.L.else.main.387:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7568]
+  mov r9, qword ptr [rsp+7584]
+  mov r10, qword ptr [rsp+7576]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.388:
+  mov qword ptr [rsp+7608], 4
+  mov dword ptr [rsp+480], 3
+  lea rsi, [rsp+480]
+  add rsi, 4
+  mov dword ptr [rsi], 4
+  lea rsi, [rsp+480]
+  add rsi, 8
+  mov dword ptr [rsi], 5
+  lea rsi, [rsp+480]
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+7600], rsi
+  lea rsi, [rip+.L.data.main.110]
+  mov qword ptr [rsp+7592], rsi
+  mov rsi, qword ptr [rsp+7608]
+  cmp rsi, qword ptr [rsp+7600]
+  jne .L.else.main.389
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7592]
+  mov r9, qword ptr [rsp+7600]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.390
+.L.else.main.389:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7592]
+  mov r9, qword ptr [rsp+7608]
+  mov r10, qword ptr [rsp+7600]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.390:
+  mov qword ptr [rsp+7632], 5
+  mov dword ptr [rsp+492], 3
+  lea rsi, [rsp+492]
+  add rsi, 4
+  mov dword ptr [rsi], 4
+  lea rsi, [rsp+492]
+  add rsi, 8
+  mov dword ptr [rsi], 5
+  lea rsi, [rsp+492]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+7624], rsi
+  lea rsi, [rip+.L.data.main.111]
+  mov qword ptr [rsp+7616], rsi
+  mov rsi, qword ptr [rsp+7632]
+  cmp rsi, qword ptr [rsp+7624]
+  jne .L.else.main.391
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7616]
+  mov r9, qword ptr [rsp+7624]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.392
+.L.else.main.391:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7616]
+  mov r9, qword ptr [rsp+7632]
+  mov r10, qword ptr [rsp+7624]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.392:
+  mov qword ptr [rsp+7656], 0
+  lea rsi, [rsp+504]
+  mov qword ptr [rsp+528], rsi
+  mov rsi, qword ptr [rsp+528]
+  mov dword ptr [rsi], 0
+  movsxd rsi, dword ptr [rsp+504]
+  mov qword ptr [rsp+7648], rsi
+  lea rsi, [rip+.L.data.main.112]
+  mov qword ptr [rsp+7640], rsi
+  mov rsi, qword ptr [rsp+7656]
+  cmp rsi, qword ptr [rsp+7648]
+  jne .L.else.main.393
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7640]
+  mov r9, qword ptr [rsp+7648]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.394
+.L.else.main.393:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7640]
+  mov r9, qword ptr [rsp+7656]
+  mov r10, qword ptr [rsp+7648]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.394:
+  mov qword ptr [rsp+7680], 1
+  lea rsi, [rsp+536]
+  mov qword ptr [rsp+560], rsi
+  mov rsi, qword ptr [rsp+560]
+  add rsi, 4
+  mov dword ptr [rsi], 1
+  lea rsi, [rsp+536]
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+7672], rsi
+  lea rsi, [rip+.L.data.main.113]
+  mov qword ptr [rsp+7664], rsi
+  mov rsi, qword ptr [rsp+7680]
+  cmp rsi, qword ptr [rsp+7672]
+  jne .L.else.main.395
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7664]
+  mov r9, qword ptr [rsp+7672]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.396
+.L.else.main.395:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7664]
+  mov r9, qword ptr [rsp+7680]
+  mov r10, qword ptr [rsp+7672]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.396:
+  mov qword ptr [rsp+7704], 2
+  lea rsi, [rsp+568]
+  mov qword ptr [rsp+592], rsi
+  mov rsi, qword ptr [rsp+592]
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  lea rsi, [rsp+568]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+7696], rsi
+  lea rsi, [rip+.L.data.main.114]
+  mov qword ptr [rsp+7688], rsi
+  mov rsi, qword ptr [rsp+7704]
+  cmp rsi, qword ptr [rsp+7696]
+  jne .L.else.main.397
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7688]
+  mov r9, qword ptr [rsp+7696]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.398
+.L.else.main.397:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7688]
+  mov r9, qword ptr [rsp+7704]
+  mov r10, qword ptr [rsp+7696]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.398:
+  mov qword ptr [rsp+7728], 3
+  lea rsi, [rsp+600]
+  mov qword ptr [rsp+624], rsi
+  mov rsi, qword ptr [rsp+624]
+  add rsi, 12
+  mov dword ptr [rsi], 3
+  lea rsi, [rsp+600]
+  add rsi, 12
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+7720], rsi
+  lea rsi, [rip+.L.data.main.115]
+  mov qword ptr [rsp+7712], rsi
+  mov rsi, qword ptr [rsp+7728]
+  cmp rsi, qword ptr [rsp+7720]
+  jne .L.else.main.399
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7712]
+  mov r9, qword ptr [rsp+7720]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.400
+.L.else.main.399:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7712]
+  mov r9, qword ptr [rsp+7728]
+  mov r10, qword ptr [rsp+7720]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.400:
+  mov qword ptr [rsp+7752], 4
+  lea rsi, [rsp+632]
+  mov qword ptr [rsp+656], rsi
+  mov rsi, qword ptr [rsp+656]
+  add rsi, 16
+  mov dword ptr [rsi], 4
+  lea rsi, [rsp+632]
+  add rsi, 12
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+7744], rsi
+  lea rsi, [rip+.L.data.main.116]
+  mov qword ptr [rsp+7736], rsi
+  mov rsi, qword ptr [rsp+7752]
+  cmp rsi, qword ptr [rsp+7744]
+  jne .L.else.main.401
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7736]
+  mov r9, qword ptr [rsp+7744]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.402
+.L.else.main.401:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7736]
+  mov r9, qword ptr [rsp+7752]
+  mov r10, qword ptr [rsp+7744]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.402:
+  mov qword ptr [rsp+7776], 5
+  lea rsi, [rsp+664]
+  mov qword ptr [rsp+688], rsi
+  mov rsi, qword ptr [rsp+688]
+  add rsi, 20
+  mov dword ptr [rsi], 5
+  lea rsi, [rsp+664]
+  add rsi, 12
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+7768], rsi
+  lea rsi, [rip+.L.data.main.117]
+  mov qword ptr [rsp+7760], rsi
+  mov rsi, qword ptr [rsp+7776]
+  cmp rsi, qword ptr [rsp+7768]
+  jne .L.else.main.403
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7760]
+  mov r9, qword ptr [rsp+7768]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.404
+.L.else.main.403:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7760]
+  mov r9, qword ptr [rsp+7776]
+  mov r10, qword ptr [rsp+7768]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.404:
+  mov qword ptr [rsp+7800], 6
+  lea rsi, [rsp+696]
+  mov qword ptr [rsp+720], rsi
+  mov rsi, qword ptr [rsp+720]
+  add rsi, 24
+  mov dword ptr [rsi], 6
+  lea rsi, [rsp+696]
+  add rsi, 24
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+7792], rsi
+  lea rsi, [rip+.L.data.main.118]
+  mov qword ptr [rsp+7784], rsi
+  mov rsi, qword ptr [rsp+7800]
+  cmp rsi, qword ptr [rsp+7792]
+  jne .L.else.main.405
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7784]
+  mov r9, qword ptr [rsp+7792]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.406
+.L.else.main.405:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7784]
+  mov r9, qword ptr [rsp+7800]
+  mov r10, qword ptr [rsp+7792]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.406:
+  mov qword ptr [rsp+7824], 3
+  mov dword ptr [rsp+732], 3
+  lea rsi, [rsp+732]
+  add rsi, 4
+  mov dword ptr [rsi], 4
+  lea rsi, [rsp+732]
+  add rsi, 8
+  mov dword ptr [rsi], 5
+  movsxd rsi, dword ptr [rsp+732]
+  mov qword ptr [rsp+7816], rsi
+  lea rsi, [rip+.L.data.main.119]
+  mov qword ptr [rsp+7808], rsi
+  mov rsi, qword ptr [rsp+7824]
+  cmp rsi, qword ptr [rsp+7816]
+  jne .L.else.main.407
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7808]
+  mov r9, qword ptr [rsp+7816]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.408
+.L.else.main.407:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7808]
+  mov r9, qword ptr [rsp+7824]
+  mov r10, qword ptr [rsp+7816]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.408:
+  mov qword ptr [rsp+7848], 4
+  mov dword ptr [rsp+744], 3
+  lea rsi, [rsp+744]
+  add rsi, 4
+  mov dword ptr [rsi], 4
+  lea rsi, [rsp+744]
+  add rsi, 8
+  mov dword ptr [rsi], 5
+  lea rsi, [rsp+744]
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+7840], rsi
+  lea rsi, [rip+.L.data.main.120]
+  mov qword ptr [rsp+7832], rsi
+  mov rsi, qword ptr [rsp+7848]
+  cmp rsi, qword ptr [rsp+7840]
+  jne .L.else.main.409
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7832]
+  mov r9, qword ptr [rsp+7840]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.410
+.L.else.main.409:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7832]
+  mov r9, qword ptr [rsp+7848]
+  mov r10, qword ptr [rsp+7840]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.410:
+  mov qword ptr [rsp+7872], 5
+  mov dword ptr [rsp+756], 3
+  lea rsi, [rsp+756]
+  add rsi, 4
+  mov dword ptr [rsi], 4
+  lea rsi, [rsp+756]
+  add rsi, 8
+  mov dword ptr [rsi], 5
+  lea rsi, [rsp+756]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+7864], rsi
+  lea rsi, [rip+.L.data.main.121]
+  mov qword ptr [rsp+7856], rsi
+  mov rsi, qword ptr [rsp+7872]
+  cmp rsi, qword ptr [rsp+7864]
+  jne .L.else.main.411
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7856]
+  mov r9, qword ptr [rsp+7864]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.412
+.L.else.main.411:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7856]
+  mov r9, qword ptr [rsp+7872]
+  mov r10, qword ptr [rsp+7864]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.412:
+  mov qword ptr [rsp+7896], 5
+  mov dword ptr [rsp+768], 3
+  lea rsi, [rsp+768]
+  add rsi, 4
+  mov dword ptr [rsi], 4
+  lea rsi, [rsp+768]
+  add rsi, 8
+  mov dword ptr [rsi], 5
+  lea rsi, [rsp+768]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+7888], rsi
+  lea rsi, [rip+.L.data.main.122]
+  mov qword ptr [rsp+7880], rsi
+  mov rsi, qword ptr [rsp+7896]
+  cmp rsi, qword ptr [rsp+7888]
+  jne .L.else.main.413
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7880]
+  mov r9, qword ptr [rsp+7888]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.414
+.L.else.main.413:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7880]
+  mov r9, qword ptr [rsp+7896]
+  mov r10, qword ptr [rsp+7888]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.414:
+  mov qword ptr [rsp+7920], 5
+  mov dword ptr [rsp+780], 3
+  lea rsi, [rsp+780]
+  add rsi, 4
+  mov dword ptr [rsi], 4
+  lea rsi, [rsp+780]
+  add rsi, 8
+  mov dword ptr [rsi], 5
+  lea rsi, [rsp+780]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+7912], rsi
+  lea rsi, [rip+.L.data.main.123]
+  mov qword ptr [rsp+7904], rsi
+  mov rsi, qword ptr [rsp+7920]
+  cmp rsi, qword ptr [rsp+7912]
+  jne .L.else.main.415
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7904]
+  mov r9, qword ptr [rsp+7912]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.416
+.L.else.main.415:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7904]
+  mov r9, qword ptr [rsp+7920]
+  mov r10, qword ptr [rsp+7912]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.416:
+  mov qword ptr [rsp+7944], 0
+  lea rsi, [rsp+792]
+  mov qword ptr [rsp+816], rsi
+  mov rsi, qword ptr [rsp+816]
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rsp+792]
+  add rsi, 0
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+7936], rsi
+  lea rsi, [rip+.L.data.main.124]
+  mov qword ptr [rsp+7928], rsi
+  mov rsi, qword ptr [rsp+7944]
+  cmp rsi, qword ptr [rsp+7936]
+  jne .L.else.main.417
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7928]
+  mov r9, qword ptr [rsp+7936]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.418
+.L.else.main.417:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7928]
+  mov r9, qword ptr [rsp+7944]
+  mov r10, qword ptr [rsp+7936]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.418:
+  mov qword ptr [rsp+7968], 1
+  lea rsi, [rsp+824]
+  mov qword ptr [rsp+848], rsi
+  mov rsi, qword ptr [rsp+848]
+  add rsi, 4
+  mov dword ptr [rsi], 1
+  lea rsi, [rsp+824]
+  add rsi, 0
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+7960], rsi
+  lea rsi, [rip+.L.data.main.125]
+  mov qword ptr [rsp+7952], rsi
+  mov rsi, qword ptr [rsp+7968]
+  cmp rsi, qword ptr [rsp+7960]
+  jne .L.else.main.419
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7952]
+  mov r9, qword ptr [rsp+7960]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.420
+.L.else.main.419:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7952]
+  mov r9, qword ptr [rsp+7968]
+  mov r10, qword ptr [rsp+7960]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.420:
+  mov qword ptr [rsp+7992], 2
+  lea rsi, [rsp+856]
+  mov qword ptr [rsp+880], rsi
+  mov rsi, qword ptr [rsp+880]
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  lea rsi, [rsp+856]
+  add rsi, 0
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+7984], rsi
+  lea rsi, [rip+.L.data.main.126]
+  mov qword ptr [rsp+7976], rsi
+  mov rsi, qword ptr [rsp+7992]
+  cmp rsi, qword ptr [rsp+7984]
+  jne .L.else.main.421
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+7976]
+  mov r9, qword ptr [rsp+7984]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.422
+.L.else.main.421:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+7976]
+  mov r9, qword ptr [rsp+7992]
+  mov r10, qword ptr [rsp+7984]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.422:
+  mov qword ptr [rsp+8016], 3
+  lea rsi, [rsp+888]
+  mov qword ptr [rsp+912], rsi
+  mov rsi, qword ptr [rsp+912]
+  add rsi, 12
+  mov dword ptr [rsi], 3
+  lea rsi, [rsp+888]
+  add rsi, 12
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+8008], rsi
+  lea rsi, [rip+.L.data.main.127]
+  mov qword ptr [rsp+8000], rsi
+  mov rsi, qword ptr [rsp+8016]
+  cmp rsi, qword ptr [rsp+8008]
+  jne .L.else.main.423
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8000]
+  mov r9, qword ptr [rsp+8008]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.424
+.L.else.main.423:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8000]
+  mov r9, qword ptr [rsp+8016]
+  mov r10, qword ptr [rsp+8008]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.424:
+  mov qword ptr [rsp+8040], 4
+  lea rsi, [rsp+920]
+  mov qword ptr [rsp+944], rsi
+  mov rsi, qword ptr [rsp+944]
+  add rsi, 16
+  mov dword ptr [rsi], 4
+  lea rsi, [rsp+920]
+  add rsi, 12
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+8032], rsi
+  lea rsi, [rip+.L.data.main.128]
+  mov qword ptr [rsp+8024], rsi
+  mov rsi, qword ptr [rsp+8040]
+  cmp rsi, qword ptr [rsp+8032]
+  jne .L.else.main.425
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8024]
+  mov r9, qword ptr [rsp+8032]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.426
+.L.else.main.425:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8024]
+  mov r9, qword ptr [rsp+8040]
+  mov r10, qword ptr [rsp+8032]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.426:
+  mov qword ptr [rsp+8064], 5
+  lea rsi, [rsp+952]
+  mov qword ptr [rsp+976], rsi
+  mov rsi, qword ptr [rsp+976]
+  add rsi, 20
+  mov dword ptr [rsi], 5
+  lea rsi, [rsp+952]
+  add rsi, 12
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+8056], rsi
+  lea rsi, [rip+.L.data.main.129]
+  mov qword ptr [rsp+8048], rsi
+  mov rsi, qword ptr [rsp+8064]
+  cmp rsi, qword ptr [rsp+8056]
+  jne .L.else.main.427
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8048]
+  mov r9, qword ptr [rsp+8056]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.428
+.L.else.main.427:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8048]
+  mov r9, qword ptr [rsp+8064]
+  mov r10, qword ptr [rsp+8056]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.428:
+  mov qword ptr [rsp+8088], 6
+  lea rsi, [rsp+984]
+  mov qword ptr [rsp+1008], rsi
+  mov rsi, qword ptr [rsp+1008]
+  add rsi, 24
+  mov dword ptr [rsi], 6
+  lea rsi, [rsp+984]
+  add rsi, 24
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+8080], rsi
+  lea rsi, [rip+.L.data.main.130]
+  mov qword ptr [rsp+8072], rsi
+  mov rsi, qword ptr [rsp+8088]
+  cmp rsi, qword ptr [rsp+8080]
+  jne .L.else.main.429
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8072]
+  mov r9, qword ptr [rsp+8080]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.430
+.L.else.main.429:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8072]
+  mov r9, qword ptr [rsp+8088]
+  mov r10, qword ptr [rsp+8080]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.430:
+  mov qword ptr [rsp+8112], 4
+  mov qword ptr [rsp+8104], 4
+  lea rsi, [rip+.L.data.main.131]
+  mov qword ptr [rsp+8096], rsi
+  mov rsi, qword ptr [rsp+8112]
+  cmp rsi, qword ptr [rsp+8104]
+  jne .L.else.main.431
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8096]
+  mov r9, qword ptr [rsp+8104]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.432
+.L.else.main.431:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8096]
+  mov r9, qword ptr [rsp+8112]
+  mov r10, qword ptr [rsp+8104]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.432:
+  mov qword ptr [rsp+8136], 4
+  mov qword ptr [rsp+8128], 4
+  lea rsi, [rip+.L.data.main.132]
+  mov qword ptr [rsp+8120], rsi
+  mov rsi, qword ptr [rsp+8136]
+  cmp rsi, qword ptr [rsp+8128]
+  jne .L.else.main.433
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8120]
+  mov r9, qword ptr [rsp+8128]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.434
+.L.else.main.433:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8120]
+  mov r9, qword ptr [rsp+8136]
+  mov r10, qword ptr [rsp+8128]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.434:
+  mov qword ptr [rsp+8160], 8
+  mov qword ptr [rsp+8152], 8
+  lea rsi, [rip+.L.data.main.133]
+  mov qword ptr [rsp+8144], rsi
+  mov rsi, qword ptr [rsp+8160]
+  cmp rsi, qword ptr [rsp+8152]
+  jne .L.else.main.435
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8144]
+  mov r9, qword ptr [rsp+8152]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.436
+.L.else.main.435:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8144]
+  mov r9, qword ptr [rsp+8160]
+  mov r10, qword ptr [rsp+8152]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.436:
+  mov qword ptr [rsp+8184], 16
+  mov qword ptr [rsp+8176], 16
+  lea rsi, [rip+.L.data.main.134]
+  mov qword ptr [rsp+8168], rsi
+  mov rsi, qword ptr [rsp+8184]
+  cmp rsi, qword ptr [rsp+8176]
+  jne .L.else.main.437
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8168]
+  mov r9, qword ptr [rsp+8176]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.438
+.L.else.main.437:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8168]
+  mov r9, qword ptr [rsp+8184]
+  mov r10, qword ptr [rsp+8176]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.438:
+  mov qword ptr [rsp+8208], 48
+  mov qword ptr [rsp+8200], 48
+  lea rsi, [rip+.L.data.main.135]
+  mov qword ptr [rsp+8192], rsi
+  mov rsi, qword ptr [rsp+8208]
+  cmp rsi, qword ptr [rsp+8200]
+  jne .L.else.main.439
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8192]
+  mov r9, qword ptr [rsp+8200]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.440
+.L.else.main.439:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8192]
+  mov r9, qword ptr [rsp+8208]
+  mov r10, qword ptr [rsp+8200]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.440:
+  mov qword ptr [rsp+8232], 16
+  mov qword ptr [rsp+8224], 16
+  lea rsi, [rip+.L.data.main.136]
+  mov qword ptr [rsp+8216], rsi
+  mov rsi, qword ptr [rsp+8232]
+  cmp rsi, qword ptr [rsp+8224]
+  jne .L.else.main.441
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8216]
+  mov r9, qword ptr [rsp+8224]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.442
+.L.else.main.441:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8216]
+  mov r9, qword ptr [rsp+8232]
+  mov r10, qword ptr [rsp+8224]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.442:
+  mov qword ptr [rsp+8256], 4
+  mov qword ptr [rsp+8248], 4
+  lea rsi, [rip+.L.data.main.137]
+  mov qword ptr [rsp+8240], rsi
+  mov rsi, qword ptr [rsp+8256]
+  cmp rsi, qword ptr [rsp+8248]
+  jne .L.else.main.443
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8240]
+  mov r9, qword ptr [rsp+8248]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.444
+.L.else.main.443:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8240]
+  mov r9, qword ptr [rsp+8256]
+  mov r10, qword ptr [rsp+8248]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.444:
+  mov qword ptr [rsp+8280], 5
+  mov rsi, 4
+  add rsi, 1
+  mov qword ptr [rsp+8272], rsi
+  lea rsi, [rip+.L.data.main.138]
+  mov qword ptr [rsp+8264], rsi
+  mov rsi, qword ptr [rsp+8280]
+  cmp rsi, qword ptr [rsp+8272]
+  jne .L.else.main.445
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8264]
+  mov r9, qword ptr [rsp+8272]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.446
+.L.else.main.445:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8264]
+  mov r9, qword ptr [rsp+8280]
+  mov r10, qword ptr [rsp+8272]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.446:
+  mov qword ptr [rsp+8304], 5
+  mov rsi, 4
+  add rsi, 1
+  mov qword ptr [rsp+8296], rsi
+  lea rsi, [rip+.L.data.main.139]
+  mov qword ptr [rsp+8288], rsi
+  mov rsi, qword ptr [rsp+8304]
+  cmp rsi, qword ptr [rsp+8296]
+  jne .L.else.main.447
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8288]
+  mov r9, qword ptr [rsp+8296]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.448
+.L.else.main.447:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8288]
+  mov r9, qword ptr [rsp+8304]
+  mov r10, qword ptr [rsp+8296]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.448:
+  mov qword ptr [rsp+8328], 8
+  mov qword ptr [rsp+8320], 8
+  lea rsi, [rip+.L.data.main.140]
+  mov qword ptr [rsp+8312], rsi
+  mov rsi, qword ptr [rsp+8328]
+  cmp rsi, qword ptr [rsp+8320]
+  jne .L.else.main.449
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8312]
+  mov r9, qword ptr [rsp+8320]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.450
+.L.else.main.449:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8312]
+  mov r9, qword ptr [rsp+8328]
+  mov r10, qword ptr [rsp+8320]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.450:
+  mov qword ptr [rsp+8352], 0
+  movsxd rsi, dword ptr [rip+g1]
+  mov qword ptr [rsp+8344], rsi
+  lea rsi, [rip+.L.data.main.141]
+  mov qword ptr [rsp+8336], rsi
+  mov rsi, qword ptr [rsp+8352]
+  cmp rsi, qword ptr [rsp+8344]
+  jne .L.else.main.451
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8336]
+  mov r9, qword ptr [rsp+8344]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.452
+.L.else.main.451:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8336]
+  mov r9, qword ptr [rsp+8352]
+  mov r10, qword ptr [rsp+8344]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.452:
+  mov dword ptr [rip+g1], 3
+  mov qword ptr [rsp+8376], 3
+  movsxd rsi, dword ptr [rip+g1]
+  mov qword ptr [rsp+8368], rsi
+  lea rsi, [rip+.L.data.main.142]
+  mov qword ptr [rsp+8360], rsi
+  mov rsi, qword ptr [rsp+8376]
+  cmp rsi, qword ptr [rsp+8368]
+  jne .L.else.main.453
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8360]
+  mov r9, qword ptr [rsp+8368]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.454
+.L.else.main.453:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8360]
+  mov r9, qword ptr [rsp+8376]
+  mov r10, qword ptr [rsp+8368]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.454:
+  lea rsi, [rip+g2]
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rip+g2]
+  add rsi, 4
+  mov dword ptr [rsi], 1
+  lea rsi, [rip+g2]
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  lea rsi, [rip+g2]
+  add rsi, 12
+  mov dword ptr [rsi], 3
+  mov qword ptr [rsp+8400], 0
+  lea rsi, [rip+g2]
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+8392], rsi
+  lea rsi, [rip+.L.data.main.143]
+  mov qword ptr [rsp+8384], rsi
+  mov rsi, qword ptr [rsp+8400]
+  cmp rsi, qword ptr [rsp+8392]
+  jne .L.else.main.455
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8384]
+  mov r9, qword ptr [rsp+8392]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.456
+.L.else.main.455:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8384]
+  mov r9, qword ptr [rsp+8400]
+  mov r10, qword ptr [rsp+8392]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.456:
+  mov qword ptr [rsp+8424], 1
+  lea rsi, [rip+g2]
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+8416], rsi
+  lea rsi, [rip+.L.data.main.144]
+  mov qword ptr [rsp+8408], rsi
+  mov rsi, qword ptr [rsp+8424]
+  cmp rsi, qword ptr [rsp+8416]
+  jne .L.else.main.457
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8408]
+  mov r9, qword ptr [rsp+8416]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.458
+.L.else.main.457:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8408]
+  mov r9, qword ptr [rsp+8424]
+  mov r10, qword ptr [rsp+8416]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.458:
+  mov qword ptr [rsp+8448], 2
+  lea rsi, [rip+g2]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+8440], rsi
+  lea rsi, [rip+.L.data.main.145]
+  mov qword ptr [rsp+8432], rsi
+  mov rsi, qword ptr [rsp+8448]
+  cmp rsi, qword ptr [rsp+8440]
+  jne .L.else.main.459
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8432]
+  mov r9, qword ptr [rsp+8440]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.460
+.L.else.main.459:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8432]
+  mov r9, qword ptr [rsp+8448]
+  mov r10, qword ptr [rsp+8440]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.460:
+  mov qword ptr [rsp+8472], 3
+  lea rsi, [rip+g2]
+  add rsi, 12
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+8464], rsi
+  lea rsi, [rip+.L.data.main.146]
+  mov qword ptr [rsp+8456], rsi
+  mov rsi, qword ptr [rsp+8472]
+  cmp rsi, qword ptr [rsp+8464]
+  jne .L.else.main.461
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8456]
+  mov r9, qword ptr [rsp+8464]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.462
+.L.else.main.461:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8456]
+  mov r9, qword ptr [rsp+8472]
+  mov r10, qword ptr [rsp+8464]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.462:
+  mov qword ptr [rsp+8496], 4
+  mov qword ptr [rsp+8488], 4
+  lea rsi, [rip+.L.data.main.147]
+  mov qword ptr [rsp+8480], rsi
+  mov rsi, qword ptr [rsp+8496]
+  cmp rsi, qword ptr [rsp+8488]
+  jne .L.else.main.463
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8480]
+  mov r9, qword ptr [rsp+8488]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.464
+.L.else.main.463:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8480]
+  mov r9, qword ptr [rsp+8496]
+  mov r10, qword ptr [rsp+8488]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.464:
+  mov qword ptr [rsp+8520], 16
+  mov qword ptr [rsp+8512], 16
+  lea rsi, [rip+.L.data.main.148]
+  mov qword ptr [rsp+8504], rsi
+  mov rsi, qword ptr [rsp+8520]
+  cmp rsi, qword ptr [rsp+8512]
+  jne .L.else.main.465
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8504]
+  mov r9, qword ptr [rsp+8512]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.466
+.L.else.main.465:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8504]
+  mov r9, qword ptr [rsp+8520]
+  mov r10, qword ptr [rsp+8512]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.466:
+  mov qword ptr [rsp+8544], 1
+  mov byte ptr [rsp+1340], 1
+  movsx rsi, byte ptr [rsp+1340]
+  mov qword ptr [rsp+8536], rsi
+  lea rsi, [rip+.L.data.main.149]
+  mov qword ptr [rsp+8528], rsi
+  mov rsi, qword ptr [rsp+8544]
+  cmp rsi, qword ptr [rsp+8536]
+  jne .L.else.main.467
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8528]
+  mov r9, qword ptr [rsp+8536]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.468
+.L.else.main.467:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8528]
+  mov r9, qword ptr [rsp+8544]
+  mov r10, qword ptr [rsp+8536]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.468:
+  mov qword ptr [rsp+8568], 1
+  mov byte ptr [rsp+1341], 1
+  mov byte ptr [rsp+1342], 2
+  movsx rsi, byte ptr [rsp+1341]
+  mov qword ptr [rsp+8560], rsi
+  lea rsi, [rip+.L.data.main.150]
+  mov qword ptr [rsp+8552], rsi
+  mov rsi, qword ptr [rsp+8568]
+  cmp rsi, qword ptr [rsp+8560]
+  jne .L.else.main.469
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8552]
+  mov r9, qword ptr [rsp+8560]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.470
+.L.else.main.469:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8552]
+  mov r9, qword ptr [rsp+8568]
+  mov r10, qword ptr [rsp+8560]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.470:
+  mov qword ptr [rsp+8592], 2
+  mov byte ptr [rsp+1343], 1
+  mov byte ptr [rsp+1344], 2
+  movsx rsi, byte ptr [rsp+1344]
+  mov qword ptr [rsp+8584], rsi
+  lea rsi, [rip+.L.data.main.151]
+  mov qword ptr [rsp+8576], rsi
+  mov rsi, qword ptr [rsp+8592]
+  cmp rsi, qword ptr [rsp+8584]
+  jne .L.else.main.471
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8576]
+  mov r9, qword ptr [rsp+8584]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.472
+.L.else.main.471:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8576]
+  mov r9, qword ptr [rsp+8592]
+  mov r10, qword ptr [rsp+8584]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.472:
+  mov qword ptr [rsp+8616], 1
+  mov qword ptr [rsp+8608], 1
+  lea rsi, [rip+.L.data.main.152]
+  mov qword ptr [rsp+8600], rsi
+  mov rsi, qword ptr [rsp+8616]
+  cmp rsi, qword ptr [rsp+8608]
+  jne .L.else.main.473
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8600]
+  mov r9, qword ptr [rsp+8608]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.474
+.L.else.main.473:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8600]
+  mov r9, qword ptr [rsp+8616]
+  mov r10, qword ptr [rsp+8608]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.474:
+  mov qword ptr [rsp+8640], 10
+  mov qword ptr [rsp+8632], 10
+  lea rsi, [rip+.L.data.main.153]
+  mov qword ptr [rsp+8624], rsi
+  mov rsi, qword ptr [rsp+8640]
+  cmp rsi, qword ptr [rsp+8632]
+  jne .L.else.main.475
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8624]
+  mov r9, qword ptr [rsp+8632]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.476
+.L.else.main.475:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8624]
+  mov r9, qword ptr [rsp+8640]
+  mov r10, qword ptr [rsp+8632]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.476:
+  mov qword ptr [rsp+8672], 1
+  mov byte ptr [rsp+8655], 7
+  mov byte ptr [rsp+8654], 3
+  mov byte ptr [rsp+8653], 3
+  movsx rsi, byte ptr [rsp+8655]
+  movsx rdi, byte ptr [rsp+8654]
+  sub rsi, rdi
+  movsx rdi, byte ptr [rsp+8653]
+  sub rsi, rdi
+  movsxd rsi, esi
+  mov qword ptr [rsp+8664], rsi
+  lea rsi, [rip+.L.data.main.154]
+  mov qword ptr [rsp+8656], rsi
+  mov rsi, qword ptr [rsp+8672]
+  cmp rsi, qword ptr [rsp+8664]
+  jne .L.else.main.477
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8656]
+  mov r9, qword ptr [rsp+8664]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.478
+.L.else.main.477:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8656]
+  mov r9, qword ptr [rsp+8672]
+  mov r10, qword ptr [rsp+8664]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.478:
+  mov qword ptr [rsp+8696], 97
+  lea rsi, [rip+.L.data.main.155]
+  add rsi, 0
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rsp+8688], rsi
+  lea rsi, [rip+.L.data.main.156]
+  mov qword ptr [rsp+8680], rsi
+  mov rsi, qword ptr [rsp+8696]
+  cmp rsi, qword ptr [rsp+8688]
+  jne .L.else.main.479
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8680]
+  mov r9, qword ptr [rsp+8688]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.480
+.L.else.main.479:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8680]
+  mov r9, qword ptr [rsp+8696]
+  mov r10, qword ptr [rsp+8688]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.480:
+  mov qword ptr [rsp+8720], 98
+  lea rsi, [rip+.L.data.main.157]
+  add rsi, 1
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rsp+8712], rsi
+  lea rsi, [rip+.L.data.main.158]
+  mov qword ptr [rsp+8704], rsi
+  mov rsi, qword ptr [rsp+8720]
+  cmp rsi, qword ptr [rsp+8712]
+  jne .L.else.main.481
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8704]
+  mov r9, qword ptr [rsp+8712]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.482
+.L.else.main.481:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8704]
+  mov r9, qword ptr [rsp+8720]
+  mov r10, qword ptr [rsp+8712]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.482:
+  mov qword ptr [rsp+8744], 99
+  lea rsi, [rip+.L.data.main.159]
+  add rsi, 2
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rsp+8736], rsi
+  lea rsi, [rip+.L.data.main.160]
+  mov qword ptr [rsp+8728], rsi
+  mov rsi, qword ptr [rsp+8744]
+  cmp rsi, qword ptr [rsp+8736]
+  jne .L.else.main.483
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8728]
+  mov r9, qword ptr [rsp+8736]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.484
+.L.else.main.483:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8728]
+  mov r9, qword ptr [rsp+8744]
+  mov r10, qword ptr [rsp+8736]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.484:
+  mov qword ptr [rsp+8768], 0
+  lea rsi, [rip+.L.data.main.161]
+  add rsi, 3
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rsp+8760], rsi
+  lea rsi, [rip+.L.data.main.162]
+  mov qword ptr [rsp+8752], rsi
+  mov rsi, qword ptr [rsp+8768]
+  cmp rsi, qword ptr [rsp+8760]
+  jne .L.else.main.485
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8752]
+  mov r9, qword ptr [rsp+8760]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.486
+.L.else.main.485:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8752]
+  mov r9, qword ptr [rsp+8768]
+  mov r10, qword ptr [rsp+8760]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.486:
+  mov qword ptr [rsp+8792], 4
+  mov qword ptr [rsp+8784], 4
+  lea rsi, [rip+.L.data.main.164]
+  mov qword ptr [rsp+8776], rsi
+  mov rsi, qword ptr [rsp+8792]
+  cmp rsi, qword ptr [rsp+8784]
+  jne .L.else.main.487
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8776]
+  mov r9, qword ptr [rsp+8784]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.488
+.L.else.main.487:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8776]
+  mov r9, qword ptr [rsp+8792]
+  mov r10, qword ptr [rsp+8784]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.488:
+  mov qword ptr [rsp+8816], 7
+  lea rsi, [rip+.L.data.main.165]
+  add rsi, 0
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rsp+8808], rsi
+  lea rsi, [rip+.L.data.main.166]
+  mov qword ptr [rsp+8800], rsi
+  mov rsi, qword ptr [rsp+8816]
+  cmp rsi, qword ptr [rsp+8808]
+  jne .L.else.main.489
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8800]
+  mov r9, qword ptr [rsp+8808]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.490
+.L.else.main.489:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8800]
+  mov r9, qword ptr [rsp+8816]
+  mov r10, qword ptr [rsp+8808]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.490:
+  mov qword ptr [rsp+8840], 8
+  lea rsi, [rip+.L.data.main.167]
+  add rsi, 0
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rsp+8832], rsi
+  lea rsi, [rip+.L.data.main.168]
+  mov qword ptr [rsp+8824], rsi
+  mov rsi, qword ptr [rsp+8840]
+  cmp rsi, qword ptr [rsp+8832]
+  jne .L.else.main.491
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8824]
+  mov r9, qword ptr [rsp+8832]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.492
+.L.else.main.491:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8824]
+  mov r9, qword ptr [rsp+8840]
+  mov r10, qword ptr [rsp+8832]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.492:
+  mov qword ptr [rsp+8864], 9
+  lea rsi, [rip+.L.data.main.169]
+  add rsi, 0
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rsp+8856], rsi
+  lea rsi, [rip+.L.data.main.170]
+  mov qword ptr [rsp+8848], rsi
+  mov rsi, qword ptr [rsp+8864]
+  cmp rsi, qword ptr [rsp+8856]
+  jne .L.else.main.493
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8848]
+  mov r9, qword ptr [rsp+8856]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.494
+.L.else.main.493:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8848]
+  mov r9, qword ptr [rsp+8864]
+  mov r10, qword ptr [rsp+8856]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.494:
+  mov qword ptr [rsp+8888], 10
+  lea rsi, [rip+.L.data.main.171]
+  add rsi, 0
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rsp+8880], rsi
+  lea rsi, [rip+.L.data.main.172]
+  mov qword ptr [rsp+8872], rsi
+  mov rsi, qword ptr [rsp+8888]
+  cmp rsi, qword ptr [rsp+8880]
+  jne .L.else.main.495
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8872]
+  mov r9, qword ptr [rsp+8880]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.496
+.L.else.main.495:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8872]
+  mov r9, qword ptr [rsp+8888]
+  mov r10, qword ptr [rsp+8880]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.496:
+  mov qword ptr [rsp+8912], 11
+  lea rsi, [rip+.L.data.main.173]
+  add rsi, 0
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rsp+8904], rsi
+  lea rsi, [rip+.L.data.main.174]
+  mov qword ptr [rsp+8896], rsi
+  mov rsi, qword ptr [rsp+8912]
+  cmp rsi, qword ptr [rsp+8904]
+  jne .L.else.main.497
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8896]
+  mov r9, qword ptr [rsp+8904]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.498
+.L.else.main.497:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8896]
+  mov r9, qword ptr [rsp+8912]
+  mov r10, qword ptr [rsp+8904]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.498:
+  mov qword ptr [rsp+8936], 12
+  lea rsi, [rip+.L.data.main.175]
+  add rsi, 0
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rsp+8928], rsi
+  lea rsi, [rip+.L.data.main.176]
+  mov qword ptr [rsp+8920], rsi
+  mov rsi, qword ptr [rsp+8936]
+  cmp rsi, qword ptr [rsp+8928]
+  jne .L.else.main.499
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8920]
+  mov r9, qword ptr [rsp+8928]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.500
+.L.else.main.499:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8920]
+  mov r9, qword ptr [rsp+8936]
+  mov r10, qword ptr [rsp+8928]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.500:
+  mov qword ptr [rsp+8960], 13
+  lea rsi, [rip+.L.data.main.177]
+  add rsi, 0
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rsp+8952], rsi
+  lea rsi, [rip+.L.data.main.178]
+  mov qword ptr [rsp+8944], rsi
+  mov rsi, qword ptr [rsp+8960]
+  cmp rsi, qword ptr [rsp+8952]
+  jne .L.else.main.501
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8944]
+  mov r9, qword ptr [rsp+8952]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.502
+.L.else.main.501:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8944]
+  mov r9, qword ptr [rsp+8960]
+  mov r10, qword ptr [rsp+8952]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.502:
+  mov qword ptr [rsp+8984], 27
+  lea rsi, [rip+.L.data.main.179]
+  add rsi, 0
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rsp+8976], rsi
+  lea rsi, [rip+.L.data.main.180]
+  mov qword ptr [rsp+8968], rsi
+  mov rsi, qword ptr [rsp+8984]
+  cmp rsi, qword ptr [rsp+8976]
+  jne .L.else.main.503
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8968]
+  mov r9, qword ptr [rsp+8976]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.504
+.L.else.main.503:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8968]
+  mov r9, qword ptr [rsp+8984]
+  mov r10, qword ptr [rsp+8976]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.504:
+  mov qword ptr [rsp+9008], 0
+  lea rsi, [rip+.L.data.main.181]
+  add rsi, 0
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rsp+9000], rsi
+  lea rsi, [rip+.L.data.main.182]
+  mov qword ptr [rsp+8992], rsi
+  mov rsi, qword ptr [rsp+9008]
+  cmp rsi, qword ptr [rsp+9000]
+  jne .L.else.main.505
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+8992]
+  mov r9, qword ptr [rsp+9000]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.506
+.L.else.main.505:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+8992]
+  mov r9, qword ptr [rsp+9008]
+  mov r10, qword ptr [rsp+9000]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.506:
+  mov qword ptr [rsp+9032], 106
+  lea rsi, [rip+.L.data.main.183]
+  add rsi, 0
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rsp+9024], rsi
+  lea rsi, [rip+.L.data.main.184]
+  mov qword ptr [rsp+9016], rsi
+  mov rsi, qword ptr [rsp+9032]
+  cmp rsi, qword ptr [rsp+9024]
+  jne .L.else.main.507
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9016]
+  mov r9, qword ptr [rsp+9024]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.508
+.L.else.main.507:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9016]
+  mov r9, qword ptr [rsp+9032]
+  mov r10, qword ptr [rsp+9024]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.508:
+  mov qword ptr [rsp+9056], 107
+  lea rsi, [rip+.L.data.main.185]
+  add rsi, 0
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rsp+9048], rsi
+  lea rsi, [rip+.L.data.main.186]
+  mov qword ptr [rsp+9040], rsi
+  mov rsi, qword ptr [rsp+9056]
+  cmp rsi, qword ptr [rsp+9048]
+  jne .L.else.main.509
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9040]
+  mov r9, qword ptr [rsp+9048]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.510
+.L.else.main.509:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9040]
+  mov r9, qword ptr [rsp+9056]
+  mov r10, qword ptr [rsp+9048]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.510:
+  mov qword ptr [rsp+9080], 108
+  lea rsi, [rip+.L.data.main.187]
+  add rsi, 0
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rsp+9072], rsi
+  lea rsi, [rip+.L.data.main.188]
+  mov qword ptr [rsp+9064], rsi
+  mov rsi, qword ptr [rsp+9080]
+  cmp rsi, qword ptr [rsp+9072]
+  jne .L.else.main.511
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9064]
+  mov r9, qword ptr [rsp+9072]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.512
+.L.else.main.511:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9064]
+  mov r9, qword ptr [rsp+9080]
+  mov r10, qword ptr [rsp+9072]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.512:
+  mov qword ptr [rsp+9104], 2
+  mov dword ptr [rsp+1356], 2
+  mov dword ptr [rsp+1360], 3
+  movsxd rsi, dword ptr [rsp+1356]
+  mov qword ptr [rsp+9096], rsi
+  lea rsi, [rip+.L.data.main.189]
+  mov qword ptr [rsp+9088], rsi
+  mov rsi, qword ptr [rsp+9104]
+  cmp rsi, qword ptr [rsp+9096]
+  jne .L.else.main.513
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9088]
+  mov r9, qword ptr [rsp+9096]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.514
+.L.else.main.513:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9088]
+  mov r9, qword ptr [rsp+9104]
+  mov r10, qword ptr [rsp+9096]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.514:
+  mov qword ptr [rsp+9128], 2
+  mov dword ptr [rsp+1364], 2
+  mov dword ptr [rsp+1368], 3
+  mov dword ptr [rsp+1372], 4
+  movsxd rsi, dword ptr [rsp+1364]
+  mov qword ptr [rsp+9120], rsi
+  lea rsi, [rip+.L.data.main.190]
+  mov qword ptr [rsp+9112], rsi
+  mov rsi, qword ptr [rsp+9128]
+  cmp rsi, qword ptr [rsp+9120]
+  jne .L.else.main.515
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9112]
+  mov r9, qword ptr [rsp+9120]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.516
+.L.else.main.515:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9112]
+  mov r9, qword ptr [rsp+9128]
+  mov r10, qword ptr [rsp+9120]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.516:
+  mov qword ptr [rsp+9152], 3
+  mov dword ptr [rsp+1376], 2
+  mov dword ptr [rsp+1376], 3
+  movsxd rsi, dword ptr [rsp+1376]
+  mov qword ptr [rsp+9144], rsi
+  lea rsi, [rip+.L.data.main.191]
+  mov qword ptr [rsp+9136], rsi
+  mov rsi, qword ptr [rsp+9152]
+  cmp rsi, qword ptr [rsp+9144]
+  jne .L.else.main.517
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9136]
+  mov r9, qword ptr [rsp+9144]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.518
+.L.else.main.517:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9136]
+  mov r9, qword ptr [rsp+9152]
+  mov r10, qword ptr [rsp+9144]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.518:
+  mov qword ptr [rsp+9176], 2
+  lea rsi, [rsp+1380]
+  add rsi, 8
+  mov qword ptr [rsp+1400], rsi
+  mov rsi, qword ptr [rsp+1400]
+  lea rdi, [rsp+1380]
+  sub rsi, rdi
+  sar rsi, 2
+  mov qword ptr [rsp+9168], rsi
+  lea rsi, [rip+.L.data.main.192]
+  mov qword ptr [rsp+9160], rsi
+  mov rsi, qword ptr [rsp+9176]
+  cmp rsi, qword ptr [rsp+9168]
+  jne .L.else.main.519
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9160]
+  mov r9, qword ptr [rsp+9168]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.520
+.L.else.main.519:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9160]
+  mov r9, qword ptr [rsp+9176]
+  mov r10, qword ptr [rsp+9168]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.520:
+  mov qword ptr [rsp+9200], 1
+  mov dword ptr [rsp+1412], 1
+  mov dword ptr [rsp+1416], 2
+  movsxd rsi, dword ptr [rsp+1412]
+  mov qword ptr [rsp+9192], rsi
+  lea rsi, [rip+.L.data.main.193]
+  mov qword ptr [rsp+9184], rsi
+  mov rsi, qword ptr [rsp+9200]
+  cmp rsi, qword ptr [rsp+9192]
+  jne .L.else.main.521
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9184]
+  mov r9, qword ptr [rsp+9192]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.522
+.L.else.main.521:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9184]
+  mov r9, qword ptr [rsp+9200]
+  mov r10, qword ptr [rsp+9192]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.522:
+  mov qword ptr [rsp+9224], 2
+  mov dword ptr [rsp+1420], 1
+  mov dword ptr [rsp+1424], 2
+  movsxd rsi, dword ptr [rsp+1424]
+  mov qword ptr [rsp+9216], rsi
+  lea rsi, [rip+.L.data.main.194]
+  mov qword ptr [rsp+9208], rsi
+  mov rsi, qword ptr [rsp+9224]
+  cmp rsi, qword ptr [rsp+9216]
+  jne .L.else.main.523
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9208]
+  mov r9, qword ptr [rsp+9216]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.524
+.L.else.main.523:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9208]
+  mov r9, qword ptr [rsp+9224]
+  mov r10, qword ptr [rsp+9216]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.524:
+  mov qword ptr [rsp+9248], 1
+  mov byte ptr [rsp+1428], 1
+  mov dword ptr [rsp+1432], 2
+  mov byte ptr [rsp+1436], 3
+  movsx rsi, byte ptr [rsp+1428]
+  mov qword ptr [rsp+9240], rsi
+  lea rsi, [rip+.L.data.main.195]
+  mov qword ptr [rsp+9232], rsi
+  mov rsi, qword ptr [rsp+9248]
+  cmp rsi, qword ptr [rsp+9240]
+  jne .L.else.main.525
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9232]
+  mov r9, qword ptr [rsp+9240]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.526
+.L.else.main.525:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9232]
+  mov r9, qword ptr [rsp+9248]
+  mov r10, qword ptr [rsp+9240]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.526:
+  mov qword ptr [rsp+9272], 2
+  mov dword ptr [rsp+1444], 1
+  mov dword ptr [rsp+1444], 2
+  mov byte ptr [rsp+1448], 3
+  movsxd rsi, dword ptr [rsp+1444]
+  mov qword ptr [rsp+9264], rsi
+  lea rsi, [rip+.L.data.main.196]
+  mov qword ptr [rsp+9256], rsi
+  mov rsi, qword ptr [rsp+9272]
+  cmp rsi, qword ptr [rsp+9264]
+  jne .L.else.main.527
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9256]
+  mov r9, qword ptr [rsp+9264]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.528
+.L.else.main.527:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9256]
+  mov r9, qword ptr [rsp+9272]
+  mov r10, qword ptr [rsp+9264]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.528:
+  mov qword ptr [rsp+9296], 3
+  mov byte ptr [rsp+1452], 1
+  mov dword ptr [rsp+1456], 2
+  mov byte ptr [rsp+1460], 3
+  movsx rsi, byte ptr [rsp+1460]
+  mov qword ptr [rsp+9288], rsi
+  lea rsi, [rip+.L.data.main.197]
+  mov qword ptr [rsp+9280], rsi
+  mov rsi, qword ptr [rsp+9296]
+  cmp rsi, qword ptr [rsp+9288]
+  jne .L.else.main.529
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9280]
+  mov r9, qword ptr [rsp+9288]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.530
+.L.else.main.529:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9280]
+  mov r9, qword ptr [rsp+9296]
+  mov r10, qword ptr [rsp+9288]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.530:
+  mov qword ptr [rsp+9320], 0
+  lea rsi, [rsp+1464]
+  mov qword ptr [rsp+1488], rsi
+  mov rsi, qword ptr [rsp+1488]
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rsp+1464]
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+9312], rsi
+  lea rsi, [rip+.L.data.main.198]
+  mov qword ptr [rsp+9304], rsi
+  mov rsi, qword ptr [rsp+9320]
+  cmp rsi, qword ptr [rsp+9312]
+  jne .L.else.main.531
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9304]
+  mov r9, qword ptr [rsp+9312]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.532
+.L.else.main.531:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9304]
+  mov r9, qword ptr [rsp+9320]
+  mov r10, qword ptr [rsp+9312]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.532:
+  mov qword ptr [rsp+9344], 1
+  lea rsi, [rsp+1496]
+  mov qword ptr [rsp+1520], rsi
+  mov rsi, qword ptr [rsp+1520]
+  add rsi, 4
+  mov dword ptr [rsi], 1
+  lea rsi, [rsp+1496]
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi+4]
+  mov qword ptr [rsp+9336], rsi
+  lea rsi, [rip+.L.data.main.199]
+  mov qword ptr [rsp+9328], rsi
+  mov rsi, qword ptr [rsp+9344]
+  cmp rsi, qword ptr [rsp+9336]
+  jne .L.else.main.533
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9328]
+  mov r9, qword ptr [rsp+9336]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.534
+.L.else.main.533:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9328]
+  mov r9, qword ptr [rsp+9344]
+  mov r10, qword ptr [rsp+9336]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.534:
+  mov qword ptr [rsp+9368], 2
+  lea rsi, [rsp+1528]
+  mov qword ptr [rsp+1552], rsi
+  mov rsi, qword ptr [rsp+1552]
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  lea rsi, [rsp+1528]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+9360], rsi
+  lea rsi, [rip+.L.data.main.200]
+  mov qword ptr [rsp+9352], rsi
+  mov rsi, qword ptr [rsp+9368]
+  cmp rsi, qword ptr [rsp+9360]
+  jne .L.else.main.535
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9352]
+  mov r9, qword ptr [rsp+9360]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.536
+.L.else.main.535:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9352]
+  mov r9, qword ptr [rsp+9368]
+  mov r10, qword ptr [rsp+9360]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.536:
+  mov qword ptr [rsp+9392], 3
+  lea rsi, [rsp+1560]
+  mov qword ptr [rsp+1584], rsi
+  mov rsi, qword ptr [rsp+1584]
+  add rsi, 12
+  mov dword ptr [rsi], 3
+  lea rsi, [rsp+1560]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi+4]
+  mov qword ptr [rsp+9384], rsi
+  lea rsi, [rip+.L.data.main.201]
+  mov qword ptr [rsp+9376], rsi
+  mov rsi, qword ptr [rsp+9392]
+  cmp rsi, qword ptr [rsp+9384]
+  jne .L.else.main.537
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9376]
+  mov r9, qword ptr [rsp+9384]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.538
+.L.else.main.537:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9376]
+  mov r9, qword ptr [rsp+9392]
+  mov r10, qword ptr [rsp+9384]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.538:
+  mov qword ptr [rsp+9416], 6
+  lea rsi, [rsp+1592]
+  mov qword ptr [rsp+1624], rsi
+  lea rsi, [rsp+1592]
+  add rsi, 0
+  mov dword ptr [rsi], 6
+  mov rsi, qword ptr [rsp+1624]
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+9408], rsi
+  lea rsi, [rip+.L.data.main.202]
+  mov qword ptr [rsp+9400], rsi
+  mov rsi, qword ptr [rsp+9416]
+  cmp rsi, qword ptr [rsp+9408]
+  jne .L.else.main.539
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9400]
+  mov r9, qword ptr [rsp+9408]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.540
+.L.else.main.539:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9400]
+  mov r9, qword ptr [rsp+9416]
+  mov r10, qword ptr [rsp+9408]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.540:
+  mov qword ptr [rsp+9440], 7
+  lea rsi, [rsp+1632]
+  mov qword ptr [rsp+1664], rsi
+  lea rsi, [rsp+1644]
+  add rsi, 0
+  mov dword ptr [rsi], 7
+  mov rsi, qword ptr [rsp+1664]
+  add rsi, 12
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+9432], rsi
+  lea rsi, [rip+.L.data.main.203]
+  mov qword ptr [rsp+9424], rsi
+  mov rsi, qword ptr [rsp+9440]
+  cmp rsi, qword ptr [rsp+9432]
+  jne .L.else.main.541
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9424]
+  mov r9, qword ptr [rsp+9432]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.542
+.L.else.main.541:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9424]
+  mov r9, qword ptr [rsp+9440]
+  mov r10, qword ptr [rsp+9432]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.542:
+  mov qword ptr [rsp+9464], 6
+  mov dword ptr [rsp+1672], 6
+  movsxd rsi, dword ptr [rsp+1672]
+  mov qword ptr [rsp+9456], rsi
+  lea rsi, [rip+.L.data.main.204]
+  mov qword ptr [rsp+9448], rsi
+  mov rsi, qword ptr [rsp+9464]
+  cmp rsi, qword ptr [rsp+9456]
+  jne .L.else.main.543
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9448]
+  mov r9, qword ptr [rsp+9456]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.544
+.L.else.main.543:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9448]
+  mov r9, qword ptr [rsp+9464]
+  mov r10, qword ptr [rsp+9456]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.544:
+  mov qword ptr [rsp+9488], 4
+  mov qword ptr [rsp+9480], 4
+  lea rsi, [rip+.L.data.main.205]
+  mov qword ptr [rsp+9472], rsi
+  mov rsi, qword ptr [rsp+9488]
+  cmp rsi, qword ptr [rsp+9480]
+  jne .L.else.main.545
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9472]
+  mov r9, qword ptr [rsp+9480]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.546
+.L.else.main.545:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9472]
+  mov r9, qword ptr [rsp+9488]
+  mov r10, qword ptr [rsp+9480]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.546:
+  mov qword ptr [rsp+9512], 8
+  mov qword ptr [rsp+9504], 8
+  lea rsi, [rip+.L.data.main.206]
+  mov qword ptr [rsp+9496], rsi
+  mov rsi, qword ptr [rsp+9512]
+  cmp rsi, qword ptr [rsp+9504]
+  jne .L.else.main.547
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9496]
+  mov r9, qword ptr [rsp+9504]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.548
+.L.else.main.547:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9496]
+  mov r9, qword ptr [rsp+9512]
+  mov r10, qword ptr [rsp+9504]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.548:
+  mov qword ptr [rsp+9536], 12
+  mov qword ptr [rsp+9528], 12
+  lea rsi, [rip+.L.data.main.207]
+  mov qword ptr [rsp+9520], rsi
+  mov rsi, qword ptr [rsp+9536]
+  cmp rsi, qword ptr [rsp+9528]
+  jne .L.else.main.549
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9520]
+  mov r9, qword ptr [rsp+9528]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.550
+.L.else.main.549:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9520]
+  mov r9, qword ptr [rsp+9536]
+  mov r10, qword ptr [rsp+9528]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.550:
+  mov qword ptr [rsp+9560], 16
+  mov qword ptr [rsp+9552], 16
+  lea rsi, [rip+.L.data.main.208]
+  mov qword ptr [rsp+9544], rsi
+  mov rsi, qword ptr [rsp+9560]
+  cmp rsi, qword ptr [rsp+9552]
+  jne .L.else.main.551
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9544]
+  mov r9, qword ptr [rsp+9552]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.552
+.L.else.main.551:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9544]
+  mov r9, qword ptr [rsp+9560]
+  mov r10, qword ptr [rsp+9552]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.552:
+  mov qword ptr [rsp+9584], 24
+  mov qword ptr [rsp+9576], 24
+  lea rsi, [rip+.L.data.main.209]
+  mov qword ptr [rsp+9568], rsi
+  mov rsi, qword ptr [rsp+9584]
+  cmp rsi, qword ptr [rsp+9576]
+  jne .L.else.main.553
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9568]
+  mov r9, qword ptr [rsp+9576]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.554
+.L.else.main.553:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9568]
+  mov r9, qword ptr [rsp+9584]
+  mov r10, qword ptr [rsp+9576]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.554:
+  mov qword ptr [rsp+9608], 2
+  mov qword ptr [rsp+9600], 2
+  lea rsi, [rip+.L.data.main.210]
+  mov qword ptr [rsp+9592], rsi
+  mov rsi, qword ptr [rsp+9608]
+  cmp rsi, qword ptr [rsp+9600]
+  jne .L.else.main.555
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9592]
+  mov r9, qword ptr [rsp+9600]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.556
+.L.else.main.555:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9592]
+  mov r9, qword ptr [rsp+9608]
+  mov r10, qword ptr [rsp+9600]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.556:
+  mov qword ptr [rsp+9632], 8
+  mov qword ptr [rsp+9624], 8
+  lea rsi, [rip+.L.data.main.211]
+  mov qword ptr [rsp+9616], rsi
+  mov rsi, qword ptr [rsp+9632]
+  cmp rsi, qword ptr [rsp+9624]
+  jne .L.else.main.557
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9616]
+  mov r9, qword ptr [rsp+9624]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.558
+.L.else.main.557:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9616]
+  mov r9, qword ptr [rsp+9632]
+  mov r10, qword ptr [rsp+9624]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.558:
+  mov qword ptr [rsp+9656], 8
+  mov qword ptr [rsp+9648], 8
+  lea rsi, [rip+.L.data.main.212]
+  mov qword ptr [rsp+9640], rsi
+  mov rsi, qword ptr [rsp+9656]
+  cmp rsi, qword ptr [rsp+9648]
+  jne .L.else.main.559
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9640]
+  mov r9, qword ptr [rsp+9648]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.560
+.L.else.main.559:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9640]
+  mov r9, qword ptr [rsp+9656]
+  mov r10, qword ptr [rsp+9648]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.560:
+  mov qword ptr [rsp+9680], 7
+  lea rsi, [rsp+1760]
+  mov dword ptr [rsp+1768], esi
+  lea rsi, [rsp+1767]
+  mov dword ptr [rsp+1772], esi
+  movsxd rsi, dword ptr [rsp+1772]
+  movsxd rdi, dword ptr [rsp+1768]
+  sub rsi, rdi
+  mov qword ptr [rsp+9672], rsi
+  lea rsi, [rip+.L.data.main.213]
+  mov qword ptr [rsp+9664], rsi
+  mov rsi, qword ptr [rsp+9680]
+  cmp rsi, qword ptr [rsp+9672]
+  jne .L.else.main.561
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9664]
+  mov r9, qword ptr [rsp+9672]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.562
+.L.else.main.561:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9664]
+  mov r9, qword ptr [rsp+9680]
+  mov r10, qword ptr [rsp+9672]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.562:
+  mov qword ptr [rsp+9704], 1
+  lea rsi, [rsp+1779]
+  mov dword ptr [rsp+1784], esi
+  lea rsi, [rsp+1780]
+  mov dword ptr [rsp+1788], esi
+  movsxd rsi, dword ptr [rsp+1788]
+  movsxd rdi, dword ptr [rsp+1784]
+  sub rsi, rdi
+  mov qword ptr [rsp+9696], rsi
+  lea rsi, [rip+.L.data.main.214]
+  mov qword ptr [rsp+9688], rsi
+  mov rsi, qword ptr [rsp+9704]
+  cmp rsi, qword ptr [rsp+9696]
+  jne .L.else.main.563
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9688]
+  mov r9, qword ptr [rsp+9696]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.564
+.L.else.main.563:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9688]
+  mov r9, qword ptr [rsp+9704]
+  mov r10, qword ptr [rsp+9696]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.564:
+  mov qword ptr [rsp+9728], 2
+  mov qword ptr [rsp+9720], 2
+  lea rsi, [rip+.L.data.main.215]
+  mov qword ptr [rsp+9712], rsi
+  mov rsi, qword ptr [rsp+9728]
+  cmp rsi, qword ptr [rsp+9720]
+  jne .L.else.main.565
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9712]
+  mov r9, qword ptr [rsp+9720]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.566
+.L.else.main.565:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9712]
+  mov r9, qword ptr [rsp+9728]
+  mov r10, qword ptr [rsp+9720]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.566:
+  mov qword ptr [rsp+9752], 3
+  mov dword ptr [rsp+1796], 1
+  mov dword ptr [rsp+1800], 2
+  movsxd rsi, dword ptr [rsp+1796]
+  movsxd rdi, dword ptr [rsp+1800]
+  add rsi, rdi
+  mov qword ptr [rsp+9744], rsi
+  lea rsi, [rip+.L.data.main.216]
+  mov qword ptr [rsp+9736], rsi
+  mov rsi, qword ptr [rsp+9752]
+  cmp rsi, qword ptr [rsp+9744]
+  jne .L.else.main.567
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9736]
+  mov r9, qword ptr [rsp+9744]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.568
+.L.else.main.567:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9736]
+  mov r9, qword ptr [rsp+9752]
+  mov r10, qword ptr [rsp+9744]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.568:
+  mov qword ptr [rsp+9776], 3
+  lea rsi, [rsp+1807]
+  mov qword ptr [rsp+1808], rsi
+  mov byte ptr [rsp+1807], 3
+  mov rsi, qword ptr [rsp+1808]
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rsp+9768], rsi
+  lea rsi, [rip+.L.data.main.217]
+  mov qword ptr [rsp+9760], rsi
+  mov rsi, qword ptr [rsp+9776]
+  cmp rsi, qword ptr [rsp+9768]
+  jne .L.else.main.569
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9760]
+  mov r9, qword ptr [rsp+9768]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.570
+.L.else.main.569:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9760]
+  mov r9, qword ptr [rsp+9776]
+  mov r10, qword ptr [rsp+9768]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.570:
+  mov qword ptr [rsp+9800], 3
+  lea rsi, [rsp+1823]
+  mov qword ptr [rsp+1824], rsi
+  mov rsi, qword ptr [rsp+1824]
+  mov byte ptr [rsi], 3
+  movsx rsi, byte ptr [rsp+1823]
+  mov qword ptr [rsp+9792], rsi
+  lea rsi, [rip+.L.data.main.218]
+  mov qword ptr [rsp+9784], rsi
+  mov rsi, qword ptr [rsp+9800]
+  cmp rsi, qword ptr [rsp+9792]
+  jne .L.else.main.571
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9784]
+  mov r9, qword ptr [rsp+9792]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.572
+.L.else.main.571:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9784]
+  mov r9, qword ptr [rsp+9800]
+  mov r10, qword ptr [rsp+9792]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.572:
+  mov qword ptr [rsp+9824], 1
+  mov dword ptr [rsp+1832], 1
+  movsxd rsi, dword ptr [rsp+1832]
+  mov qword ptr [rsp+9816], rsi
+  lea rsi, [rip+.L.data.main.219]
+  mov qword ptr [rsp+9808], rsi
+  mov rsi, qword ptr [rsp+9824]
+  cmp rsi, qword ptr [rsp+9816]
+  jne .L.else.main.573
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9808]
+  mov r9, qword ptr [rsp+9816]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.574
+.L.else.main.573:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9808]
+  mov r9, qword ptr [rsp+9824]
+  mov r10, qword ptr [rsp+9816]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.574:
+  mov qword ptr [rsp+9848], 1
+  mov dword ptr [rsp+1836], 1
+  movsxd rsi, dword ptr [rsp+1836]
+  mov qword ptr [rsp+9840], rsi
+  lea rsi, [rip+.L.data.main.220]
+  mov qword ptr [rsp+9832], rsi
+  mov rsi, qword ptr [rsp+9848]
+  cmp rsi, qword ptr [rsp+9840]
+  jne .L.else.main.575
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9832]
+  mov r9, qword ptr [rsp+9840]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.576
+.L.else.main.575:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9832]
+  mov r9, qword ptr [rsp+9848]
+  mov r10, qword ptr [rsp+9840]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.576:
+  mov qword ptr [rsp+9872], 1
+  mov dword ptr [rsp+1840], 1
+  movsxd rsi, dword ptr [rsp+1840]
+  mov qword ptr [rsp+9864], rsi
+  lea rsi, [rip+.L.data.main.221]
+  mov qword ptr [rsp+9856], rsi
+  mov rsi, qword ptr [rsp+9872]
+  cmp rsi, qword ptr [rsp+9864]
+  jne .L.else.main.577
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9856]
+  mov r9, qword ptr [rsp+9864]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.578
+.L.else.main.577:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9856]
+  mov r9, qword ptr [rsp+9872]
+  mov r10, qword ptr [rsp+9864]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.578:
+  mov qword ptr [rsp+9896], 2
+  mov dword ptr [rsp+1844], 2
+  movsxd rsi, dword ptr [rsp+1844]
+  mov qword ptr [rsp+9888], rsi
+  lea rsi, [rip+.L.data.main.222]
+  mov qword ptr [rsp+9880], rsi
+  mov rsi, qword ptr [rsp+9896]
+  cmp rsi, qword ptr [rsp+9888]
+  jne .L.else.main.579
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9880]
+  mov r9, qword ptr [rsp+9888]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.580
+.L.else.main.579:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9880]
+  mov r9, qword ptr [rsp+9896]
+  mov r10, qword ptr [rsp+9888]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.580:
+  mov qword ptr [rsp+9920], 8
+  mov qword ptr [rsp+9912], 8
+  lea rsi, [rip+.L.data.main.223]
+  mov qword ptr [rsp+9904], rsi
+  mov rsi, qword ptr [rsp+9920]
+  cmp rsi, qword ptr [rsp+9912]
+  jne .L.else.main.581
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9904]
+  mov r9, qword ptr [rsp+9912]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.582
+.L.else.main.581:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9904]
+  mov r9, qword ptr [rsp+9920]
+  mov r10, qword ptr [rsp+9912]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.582:
+  mov qword ptr [rsp+9944], 8
+  mov qword ptr [rsp+9936], 8
+  lea rsi, [rip+.L.data.main.224]
+  mov qword ptr [rsp+9928], rsi
+  mov rsi, qword ptr [rsp+9944]
+  cmp rsi, qword ptr [rsp+9936]
+  jne .L.else.main.583
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9928]
+  mov r9, qword ptr [rsp+9936]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.584
+.L.else.main.583:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9928]
+  mov r9, qword ptr [rsp+9944]
+  mov r10, qword ptr [rsp+9936]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.584:
+  mov qword ptr [rsp+9968], 2
+  mov qword ptr [rsp+9960], 2
+  lea rsi, [rip+.L.data.main.225]
+  mov qword ptr [rsp+9952], rsi
+  mov rsi, qword ptr [rsp+9968]
+  cmp rsi, qword ptr [rsp+9960]
+  jne .L.else.main.585
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9952]
+  mov r9, qword ptr [rsp+9960]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.586
+.L.else.main.585:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9952]
+  mov r9, qword ptr [rsp+9968]
+  mov r10, qword ptr [rsp+9960]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.586:
+  mov qword ptr [rsp+9992], 4
+  mov qword ptr [rsp+9984], 4
+  lea rsi, [rip+.L.data.main.226]
+  mov qword ptr [rsp+9976], rsi
+  mov rsi, qword ptr [rsp+9992]
+  cmp rsi, qword ptr [rsp+9984]
+  jne .L.else.main.587
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+9976]
+  mov r9, qword ptr [rsp+9984]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.588
+.L.else.main.587:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+9976]
+  mov r9, qword ptr [rsp+9992]
+  mov r10, qword ptr [rsp+9984]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.588:
+  mov qword ptr [rsp+10016], 8
+  mov qword ptr [rsp+10008], 8
+  lea rsi, [rip+.L.data.main.227]
+  mov qword ptr [rsp+10000], rsi
+  mov rsi, qword ptr [rsp+10016]
+  cmp rsi, qword ptr [rsp+10008]
+  jne .L.else.main.589
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10000]
+  mov r9, qword ptr [rsp+10008]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.590
+.L.else.main.589:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10000]
+  mov r9, qword ptr [rsp+10016]
+  mov r10, qword ptr [rsp+10008]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.590:
+  mov qword ptr [rsp+10040], 16
+  mov qword ptr [rsp+10032], 16
+  lea rsi, [rip+.L.data.main.228]
+  mov qword ptr [rsp+10024], rsi
+  mov rsi, qword ptr [rsp+10040]
+  cmp rsi, qword ptr [rsp+10032]
+  jne .L.else.main.591
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10024]
+  mov r9, qword ptr [rsp+10032]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.592
+.L.else.main.591:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10024]
+  mov r9, qword ptr [rsp+10040]
+  mov r10, qword ptr [rsp+10032]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.592:
+  mov qword ptr [rsp+10072], 1
+  mov word ptr [rsp+10054], 7
+  mov word ptr [rsp+10052], 3
+  mov word ptr [rsp+10050], 3
+  movsx rsi, word ptr [rsp+10054]
+  movsx rdi, word ptr [rsp+10052]
+  sub rsi, rdi
+  movsx rdi, word ptr [rsp+10050]
+  sub rsi, rdi
+  movsxd rsi, esi
+  mov qword ptr [rsp+10064], rsi
+  lea rsi, [rip+.L.data.main.229]
+  mov qword ptr [rsp+10056], rsi
+  mov rsi, qword ptr [rsp+10072]
+  cmp rsi, qword ptr [rsp+10064]
+  jne .L.else.main.593
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10056]
+  mov r9, qword ptr [rsp+10064]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.594
+.L.else.main.593:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10056]
+  mov r9, qword ptr [rsp+10072]
+  mov r10, qword ptr [rsp+10064]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.594:
+  mov qword ptr [rsp+10120], 1
+  mov qword ptr [rsp+10096], 7
+  mov qword ptr [rsp+10088], 3
+  mov qword ptr [rsp+10080], 3
+  mov rsi, qword ptr [rsp+10096]
+  sub rsi, qword ptr [rsp+10088]
+  sub rsi, qword ptr [rsp+10080]
+  movsxd rsi, esi
+  mov qword ptr [rsp+10112], rsi
+  lea rsi, [rip+.L.data.main.230]
+  mov qword ptr [rsp+10104], rsi
+  mov rsi, qword ptr [rsp+10120]
+  cmp rsi, qword ptr [rsp+10112]
+  jne .L.else.main.595
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10104]
+  mov r9, qword ptr [rsp+10112]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.596
+.L.else.main.595:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10104]
+  mov r9, qword ptr [rsp+10120]
+  mov r10, qword ptr [rsp+10112]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.596:
+  mov qword ptr [rsp+10144], 24
+  mov qword ptr [rsp+10136], 24
+  lea rsi, [rip+.L.data.main.231]
+  mov qword ptr [rsp+10128], rsi
+  mov rsi, qword ptr [rsp+10144]
+  cmp rsi, qword ptr [rsp+10136]
+  jne .L.else.main.597
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10128]
+  mov r9, qword ptr [rsp+10136]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.598
+.L.else.main.597:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10128]
+  mov r9, qword ptr [rsp+10144]
+  mov r10, qword ptr [rsp+10136]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.598:
+  mov qword ptr [rsp+10168], 8
+  mov qword ptr [rsp+10160], 8
+  lea rsi, [rip+.L.data.main.232]
+  mov qword ptr [rsp+10152], rsi
+  mov rsi, qword ptr [rsp+10168]
+  cmp rsi, qword ptr [rsp+10160]
+  jne .L.else.main.599
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10152]
+  mov r9, qword ptr [rsp+10160]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.600
+.L.else.main.599:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10152]
+  mov r9, qword ptr [rsp+10168]
+  mov r10, qword ptr [rsp+10160]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.600:
+  mov qword ptr [rsp+10192], 3
+  lea rsi, [rsp+1936]
+  add rsi, 0
+  lea rdi, [rsp+1960]
+  mov qword ptr [rsi], rdi
+  mov dword ptr [rsp+1960], 3
+  lea rsi, [rsp+1936]
+  add rsi, 0
+  mov rsi, qword ptr [rsi]
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+10184], rsi
+  lea rsi, [rip+.L.data.main.233]
+  mov qword ptr [rsp+10176], rsi
+  mov rsi, qword ptr [rsp+10192]
+  cmp rsi, qword ptr [rsp+10184]
+  jne .L.else.main.601
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10176]
+  mov r9, qword ptr [rsp+10184]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.602
+.L.else.main.601:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10176]
+  mov r9, qword ptr [rsp+10192]
+  mov r10, qword ptr [rsp+10184]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.602:
+  mov qword ptr [rsp+10216], 4
+  lea rsi, [rsp+1964]
+  mov qword ptr [rsp+1976], rsi
+  mov rsi, qword ptr [rsp+1976]
+  add rsi, 0
+  add rsi, 0
+  mov dword ptr [rsi], 4
+  mov rsi, qword ptr [rsp+1976]
+  add rsi, 0
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+10208], rsi
+  lea rsi, [rip+.L.data.main.234]
+  mov qword ptr [rsp+10200], rsi
+  mov rsi, qword ptr [rsp+10216]
+  cmp rsi, qword ptr [rsp+10208]
+  jne .L.else.main.603
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10200]
+  mov r9, qword ptr [rsp+10208]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.604
+.L.else.main.603:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10200]
+  mov r9, qword ptr [rsp+10216]
+  mov r10, qword ptr [rsp+10208]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.604:
+  mov qword ptr [rsp+10240], 3
+  movsxd rsi, dword ptr [rip+g1]
+  mov qword ptr [rsp+10232], rsi
+  lea rsi, [rip+.L.data.main.235]
+  mov qword ptr [rsp+10224], rsi
+  mov rsi, qword ptr [rsp+10240]
+  cmp rsi, qword ptr [rsp+10232]
+  jne .L.else.main.605
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10224]
+  mov r9, qword ptr [rsp+10232]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.606
+.L.else.main.605:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10224]
+  mov r9, qword ptr [rsp+10240]
+  mov r10, qword ptr [rsp+10232]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.606:
+  mov qword ptr [rsp+10264], 0
+  mov rsi, 0
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rsp+1995], sil
+  movsx rsi, byte ptr [rsp+1995]
+  mov qword ptr [rsp+10256], rsi
+  lea rsi, [rip+.L.data.main.236]
+  mov qword ptr [rsp+10248], rsi
+  mov rsi, qword ptr [rsp+10264]
+  cmp rsi, qword ptr [rsp+10256]
+  jne .L.else.main.607
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10248]
+  mov r9, qword ptr [rsp+10256]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.608
+.L.else.main.607:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10248]
+  mov r9, qword ptr [rsp+10264]
+  mov r10, qword ptr [rsp+10256]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.608:
+  mov qword ptr [rsp+10288], 1
+  mov rsi, 1
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rsp+1996], sil
+  movsx rsi, byte ptr [rsp+1996]
+  mov qword ptr [rsp+10280], rsi
+  lea rsi, [rip+.L.data.main.237]
+  mov qword ptr [rsp+10272], rsi
+  mov rsi, qword ptr [rsp+10288]
+  cmp rsi, qword ptr [rsp+10280]
+  jne .L.else.main.609
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10272]
+  mov r9, qword ptr [rsp+10280]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.610
+.L.else.main.609:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10272]
+  mov r9, qword ptr [rsp+10288]
+  mov r10, qword ptr [rsp+10280]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.610:
+  mov qword ptr [rsp+10312], 1
+  mov rsi, 2
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rsp+1997], sil
+  movsx rsi, byte ptr [rsp+1997]
+  mov qword ptr [rsp+10304], rsi
+  lea rsi, [rip+.L.data.main.238]
+  mov qword ptr [rsp+10296], rsi
+  mov rsi, qword ptr [rsp+10312]
+  cmp rsi, qword ptr [rsp+10304]
+  jne .L.else.main.611
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10296]
+  mov r9, qword ptr [rsp+10304]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.612
+.L.else.main.611:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10296]
+  mov r9, qword ptr [rsp+10312]
+  mov r10, qword ptr [rsp+10304]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.612:
+  mov qword ptr [rsp+10336], 1
+  mov rsi, 0
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rsp+1998], sil
+  movsx rsi, byte ptr [rsp+1998]
+  add rsi, 5
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rsp+1998], sil
+  mov qword ptr [rsp+10328], rsi
+  lea rsi, [rip+.L.data.main.239]
+  mov qword ptr [rsp+10320], rsi
+  mov rsi, qword ptr [rsp+10336]
+  cmp rsi, qword ptr [rsp+10328]
+  jne .L.else.main.613
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10320]
+  mov r9, qword ptr [rsp+10328]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.614
+.L.else.main.613:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10320]
+  mov r9, qword ptr [rsp+10336]
+  mov r10, qword ptr [rsp+10328]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.614:
+  mov qword ptr [rsp+10360], 1
+  mov rsi, 0
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rsp+1999], sil
+  mov rsi, 7
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rsp+1999], sil
+  mov qword ptr [rsp+2000], rsi
+  mov rsi, qword ptr [rsp+2000]
+  mov qword ptr [rsp+10352], rsi
+  lea rsi, [rip+.L.data.main.240]
+  mov qword ptr [rsp+10344], rsi
+  mov rsi, qword ptr [rsp+10360]
+  cmp rsi, qword ptr [rsp+10352]
+  jne .L.else.main.615
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10344]
+  mov r9, qword ptr [rsp+10352]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.616
+.L.else.main.615:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10344]
+  mov r9, qword ptr [rsp+10360]
+  mov r10, qword ptr [rsp+10352]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.616:
+  mov qword ptr [rsp+10384], 1
+  mov rsi, 1
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rsp+2015], sil
+  movsx rsi, byte ptr [rsp+2015]
+  add rsi, 1
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rsp+2015], sil
+  mov qword ptr [rsp+10376], rsi
+  lea rsi, [rip+.L.data.main.241]
+  mov qword ptr [rsp+10368], rsi
+  mov rsi, qword ptr [rsp+10384]
+  cmp rsi, qword ptr [rsp+10376]
+  jne .L.else.main.617
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10368]
+  mov r9, qword ptr [rsp+10376]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.618
+.L.else.main.617:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10368]
+  mov r9, qword ptr [rsp+10384]
+  mov r10, qword ptr [rsp+10376]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.618:
+  mov qword ptr [rsp+10408], 39
+  mov dword ptr [rsp+2016], 0
+  mov dword ptr [rsp+2020], 0
+  mov rsi, 1
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rsp+2026], sil
+  movsxd rsi, dword ptr [rsp+2016]
+  cmp rsi, 4
+  jge .L.break.main.620
+  .p2align 4,,10
+.L.begin.main.621:
+  add dword ptr [rsp+2016], 1
+  movsx rsi, byte ptr [rsp+2026]
+  add rsi, 1
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rsp+2026], sil
+  add dword ptr [rsp+2020], esi
+  shl dword ptr [rsp+2020], 1
+  movsxd rsi, dword ptr [rsp+2016]
+  cmp rsi, 4
+  jl .L.begin.main.621
+.L.break.main.620:
+  movsxd rsi, dword ptr [rsp+2020]
+  movsxd rdi, dword ptr [rsp+2016]
+  imul rdi, 0
+  add rsi, rdi
+  add rsi, 9
+  mov qword ptr [rsp+10400], rsi
+  lea rsi, [rip+.L.data.main.242]
+  mov qword ptr [rsp+10392], rsi
+  mov rsi, qword ptr [rsp+10408]
+  cmp rsi, qword ptr [rsp+10400]
+  jne .L.else.main.622
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10392]
+  mov r9, qword ptr [rsp+10400]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.623
+.L.else.main.622:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10392]
+  mov r9, qword ptr [rsp+10408]
+  mov r10, qword ptr [rsp+10400]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.623:
+  mov qword ptr [rsp+10432], 1
+  mov rsi, 1
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rsp+2027], sil
+  movsx rsi, byte ptr [rsp+2027]
+  mov rdi, rsi
+  add rsi, 1
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rsp+2027], sil
+  mov qword ptr [rsp+10424], rdi
+  lea rsi, [rip+.L.data.main.243]
+  mov qword ptr [rsp+10416], rsi
+  mov rsi, qword ptr [rsp+10432]
+  cmp rsi, qword ptr [rsp+10424]
+  jne .L.else.main.624
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10416]
+  mov r9, qword ptr [rsp+10424]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.625
+.L.else.main.624:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10416]
+  mov r9, qword ptr [rsp+10432]
+  mov r10, qword ptr [rsp+10424]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.625:
+  mov qword ptr [rsp+10456], 1
+  mov rsi, 1
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rsp+2028], sil
+  movsx rsi, byte ptr [rsp+2028]
+  add rsi, 1
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rsp+2028], sil
+  movsx rsi, byte ptr [rsp+2028]
+  mov qword ptr [rsp+10448], rsi
+  lea rsi, [rip+.L.data.main.244]
+  mov qword ptr [rsp+10440], rsi
+  mov rsi, qword ptr [rsp+10456]
+  cmp rsi, qword ptr [rsp+10448]
+  jne .L.else.main.626
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10440]
+  mov r9, qword ptr [rsp+10448]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.627
+.L.else.main.626:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10440]
+  mov r9, qword ptr [rsp+10456]
+  mov r10, qword ptr [rsp+10448]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.627:
+  mov qword ptr [rsp+10480], 0
+  mov rsi, 0
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rsp+2029], sil
+  movsx rsi, byte ptr [rsp+2029]
+  mov rdi, rsi
+  sub rsi, 1
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rsp+2029], sil
+  mov qword ptr [rsp+10472], rdi
+  lea rsi, [rip+.L.data.main.245]
+  mov qword ptr [rsp+10464], rsi
+  mov rsi, qword ptr [rsp+10480]
+  cmp rsi, qword ptr [rsp+10472]
+  jne .L.else.main.628
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10464]
+  mov r9, qword ptr [rsp+10472]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.629
+.L.else.main.628:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10464]
+  mov r9, qword ptr [rsp+10480]
+  mov r10, qword ptr [rsp+10472]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.629:
+  mov qword ptr [rsp+10504], 1
+  mov rsi, 0
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rsp+2030], sil
+  movsx rsi, byte ptr [rsp+2030]
+  sub rsi, 1
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rsp+2030], sil
+  movsx rsi, byte ptr [rsp+2030]
+  mov qword ptr [rsp+10496], rsi
+  lea rsi, [rip+.L.data.main.246]
+  mov qword ptr [rsp+10488], rsi
+  mov rsi, qword ptr [rsp+10504]
+  cmp rsi, qword ptr [rsp+10496]
+  jne .L.else.main.630
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10488]
+  mov r9, qword ptr [rsp+10496]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.631
+.L.else.main.630:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10488]
+  mov r9, qword ptr [rsp+10504]
+  mov r10, qword ptr [rsp+10496]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.631:
+  mov qword ptr [rsp+10528], 1
+  mov rsi, 1
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rsp+2031], sil
+  lea rsi, [rsp+2031]
+  mov qword ptr [rsp+2032], rsi
+  movsx rsi, byte ptr [rsp+2031]
+  mov rdi, rsi
+  add rsi, 1
+  cmp rsi, 0
+  setne sil
+  movzx rsi, sil
+  mov byte ptr [rsp+2031], sil
+  mov qword ptr [rsp+10520], rdi
+  lea rsi, [rip+.L.data.main.247]
+  mov qword ptr [rsp+10512], rsi
+  mov rsi, qword ptr [rsp+10528]
+  cmp rsi, qword ptr [rsp+10520]
+  jne .L.else.main.632
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10512]
+  mov r9, qword ptr [rsp+10520]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.633
+.L.else.main.632:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10512]
+  mov r9, qword ptr [rsp+10528]
+  mov r10, qword ptr [rsp+10520]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.633:
+  mov qword ptr [rsp+10552], 1
+  mov qword ptr [rsp+10544], 1
+  lea rsi, [rip+.L.data.main.248]
+  mov qword ptr [rsp+10536], rsi
+  mov rsi, qword ptr [rsp+10552]
+  cmp rsi, qword ptr [rsp+10544]
+  jne .L.else.main.634
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10536]
+  mov r9, qword ptr [rsp+10544]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.635
+.L.else.main.634:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10536]
+  mov r9, qword ptr [rsp+10552]
+  mov r10, qword ptr [rsp+10544]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.635:
+  mov qword ptr [rsp+10576], 2
+  mov qword ptr [rsp+10568], 2
+  lea rsi, [rip+.L.data.main.249]
+  mov qword ptr [rsp+10560], rsi
+  mov rsi, qword ptr [rsp+10576]
+  cmp rsi, qword ptr [rsp+10568]
+  jne .L.else.main.636
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10560]
+  mov r9, qword ptr [rsp+10568]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.637
+.L.else.main.636:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10560]
+  mov r9, qword ptr [rsp+10576]
+  mov r10, qword ptr [rsp+10568]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.637:
+  mov qword ptr [rsp+10600], 2
+  mov qword ptr [rsp+10592], 2
+  lea rsi, [rip+.L.data.main.250]
+  mov qword ptr [rsp+10584], rsi
+  mov rsi, qword ptr [rsp+10600]
+  cmp rsi, qword ptr [rsp+10592]
+  jne .L.else.main.638
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10584]
+  mov r9, qword ptr [rsp+10592]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.639
+.L.else.main.638:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10584]
+  mov r9, qword ptr [rsp+10600]
+  mov r10, qword ptr [rsp+10592]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.639:
+  mov qword ptr [rsp+10624], 4
+  mov qword ptr [rsp+10616], 4
+  lea rsi, [rip+.L.data.main.251]
+  mov qword ptr [rsp+10608], rsi
+  mov rsi, qword ptr [rsp+10624]
+  cmp rsi, qword ptr [rsp+10616]
+  jne .L.else.main.640
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10608]
+  mov r9, qword ptr [rsp+10616]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.641
+.L.else.main.640:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10608]
+  mov r9, qword ptr [rsp+10624]
+  mov r10, qword ptr [rsp+10616]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.641:
+  mov qword ptr [rsp+10648], 4
+  mov qword ptr [rsp+10640], 4
+  lea rsi, [rip+.L.data.main.252]
+  mov qword ptr [rsp+10632], rsi
+  mov rsi, qword ptr [rsp+10648]
+  cmp rsi, qword ptr [rsp+10640]
+  jne .L.else.main.642
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10632]
+  mov r9, qword ptr [rsp+10640]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.643
+.L.else.main.642:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10632]
+  mov r9, qword ptr [rsp+10648]
+  mov r10, qword ptr [rsp+10640]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.643:
+  mov qword ptr [rsp+10672], 4
+  mov qword ptr [rsp+10664], 4
+  lea rsi, [rip+.L.data.main.253]
+  mov qword ptr [rsp+10656], rsi
+  mov rsi, qword ptr [rsp+10672]
+  cmp rsi, qword ptr [rsp+10664]
+  jne .L.else.main.644
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10656]
+  mov r9, qword ptr [rsp+10664]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.645
+.L.else.main.644:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10656]
+  mov r9, qword ptr [rsp+10672]
+  mov r10, qword ptr [rsp+10664]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.645:
+  mov qword ptr [rsp+10696], 8
+  mov qword ptr [rsp+10688], 8
+  lea rsi, [rip+.L.data.main.254]
+  mov qword ptr [rsp+10680], rsi
+  mov rsi, qword ptr [rsp+10696]
+  cmp rsi, qword ptr [rsp+10688]
+  jne .L.else.main.646
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10680]
+  mov r9, qword ptr [rsp+10688]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.647
+.L.else.main.646:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10680]
+  mov r9, qword ptr [rsp+10696]
+  mov r10, qword ptr [rsp+10688]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.647:
+  mov qword ptr [rsp+10720], 8
+  mov qword ptr [rsp+10712], 8
+  lea rsi, [rip+.L.data.main.255]
+  mov qword ptr [rsp+10704], rsi
+  mov rsi, qword ptr [rsp+10720]
+  cmp rsi, qword ptr [rsp+10712]
+  jne .L.else.main.648
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10704]
+  mov r9, qword ptr [rsp+10712]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.649
+.L.else.main.648:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10704]
+  mov r9, qword ptr [rsp+10720]
+  mov r10, qword ptr [rsp+10712]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.649:
+  mov qword ptr [rsp+10744], 8
+  mov qword ptr [rsp+10736], 8
+  lea rsi, [rip+.L.data.main.256]
+  mov qword ptr [rsp+10728], rsi
+  mov rsi, qword ptr [rsp+10744]
+  cmp rsi, qword ptr [rsp+10736]
+  jne .L.else.main.650
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10728]
+  mov r9, qword ptr [rsp+10736]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.651
+.L.else.main.650:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10728]
+  mov r9, qword ptr [rsp+10744]
+  mov r10, qword ptr [rsp+10736]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.651:
+  mov qword ptr [rsp+10768], 8
+  mov qword ptr [rsp+10760], 8
+  lea rsi, [rip+.L.data.main.257]
+  mov qword ptr [rsp+10752], rsi
+  mov rsi, qword ptr [rsp+10768]
+  cmp rsi, qword ptr [rsp+10760]
+  jne .L.else.main.652
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10752]
+  mov r9, qword ptr [rsp+10760]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.653
+.L.else.main.652:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10752]
+  mov r9, qword ptr [rsp+10768]
+  mov r10, qword ptr [rsp+10760]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.653:
+  mov qword ptr [rsp+10792], 3
+  mov dword ptr [rsp+2096], 3
+  movsxd rsi, dword ptr [rsp+2096]
+  mov qword ptr [rsp+10784], rsi
+  lea rsi, [rip+.L.data.main.258]
+  mov qword ptr [rsp+10776], rsi
+  mov rsi, qword ptr [rsp+10792]
+  cmp rsi, qword ptr [rsp+10784]
+  jne .L.else.main.654
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10776]
+  mov r9, qword ptr [rsp+10784]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.655
+.L.else.main.654:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10776]
+  mov r9, qword ptr [rsp+10792]
+  mov r10, qword ptr [rsp+10784]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.655:
+  mov qword ptr [rsp+10816], 1
+  mov qword ptr [rsp+10808], 1
+  lea rsi, [rip+.L.data.main.259]
+  mov qword ptr [rsp+10800], rsi
+  mov rsi, qword ptr [rsp+10816]
+  cmp rsi, qword ptr [rsp+10808]
+  jne .L.else.main.656
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10800]
+  mov r9, qword ptr [rsp+10808]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.657
+.L.else.main.656:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10800]
+  mov r9, qword ptr [rsp+10816]
+  mov r10, qword ptr [rsp+10808]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.657:
+  mov qword ptr [rsp+10840], 2
+  mov qword ptr [rsp+10832], 2
+  lea rsi, [rip+.L.data.main.260]
+  mov qword ptr [rsp+10824], rsi
+  mov rsi, qword ptr [rsp+10840]
+  cmp rsi, qword ptr [rsp+10832]
+  jne .L.else.main.658
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10824]
+  mov r9, qword ptr [rsp+10832]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.659
+.L.else.main.658:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10824]
+  mov r9, qword ptr [rsp+10840]
+  mov r10, qword ptr [rsp+10832]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.659:
+  mov qword ptr [rsp+10864], 2
+  mov qword ptr [rsp+10856], 2
+  lea rsi, [rip+.L.data.main.261]
+  mov qword ptr [rsp+10848], rsi
+  mov rsi, qword ptr [rsp+10864]
+  cmp rsi, qword ptr [rsp+10856]
+  jne .L.else.main.660
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10848]
+  mov r9, qword ptr [rsp+10856]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.661
+.L.else.main.660:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10848]
+  mov r9, qword ptr [rsp+10864]
+  mov r10, qword ptr [rsp+10856]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.661:
+  mov qword ptr [rsp+10888], 2
+  mov qword ptr [rsp+10880], 2
+  lea rsi, [rip+.L.data.main.262]
+  mov qword ptr [rsp+10872], rsi
+  mov rsi, qword ptr [rsp+10888]
+  cmp rsi, qword ptr [rsp+10880]
+  jne .L.else.main.662
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10872]
+  mov r9, qword ptr [rsp+10880]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.663
+.L.else.main.662:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10872]
+  mov r9, qword ptr [rsp+10888]
+  mov r10, qword ptr [rsp+10880]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.663:
+  mov qword ptr [rsp+10912], 4
+  mov qword ptr [rsp+10904], 4
+  lea rsi, [rip+.L.data.main.263]
+  mov qword ptr [rsp+10896], rsi
+  mov rsi, qword ptr [rsp+10912]
+  cmp rsi, qword ptr [rsp+10904]
+  jne .L.else.main.664
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10896]
+  mov r9, qword ptr [rsp+10904]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.665
+.L.else.main.664:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10896]
+  mov r9, qword ptr [rsp+10912]
+  mov r10, qword ptr [rsp+10904]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.665:
+  mov qword ptr [rsp+10936], 8
+  mov qword ptr [rsp+10928], 8
+  lea rsi, [rip+.L.data.main.264]
+  mov qword ptr [rsp+10920], rsi
+  mov rsi, qword ptr [rsp+10936]
+  cmp rsi, qword ptr [rsp+10928]
+  jne .L.else.main.666
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10920]
+  mov r9, qword ptr [rsp+10928]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.667
+.L.else.main.666:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10920]
+  mov r9, qword ptr [rsp+10936]
+  mov r10, qword ptr [rsp+10928]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.667:
+  mov qword ptr [rsp+10960], 8
+  mov qword ptr [rsp+10952], 8
+  lea rsi, [rip+.L.data.main.265]
+  mov qword ptr [rsp+10944], rsi
+  mov rsi, qword ptr [rsp+10960]
+  cmp rsi, qword ptr [rsp+10952]
+  jne .L.else.main.668
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10944]
+  mov r9, qword ptr [rsp+10952]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.669
+.L.else.main.668:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10944]
+  mov r9, qword ptr [rsp+10960]
+  mov r10, qword ptr [rsp+10952]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.669:
+  mov qword ptr [rsp+10984], 8
+  mov qword ptr [rsp+10976], 8
+  lea rsi, [rip+.L.data.main.266]
+  mov qword ptr [rsp+10968], rsi
+  mov rsi, qword ptr [rsp+10984]
+  cmp rsi, qword ptr [rsp+10976]
+  jne .L.else.main.670
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10968]
+  mov r9, qword ptr [rsp+10976]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.671
+.L.else.main.670:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10968]
+  mov r9, qword ptr [rsp+10984]
+  mov r10, qword ptr [rsp+10976]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.671:
+  mov qword ptr [rsp+11008], 8
+  mov qword ptr [rsp+11000], 8
+  lea rsi, [rip+.L.data.main.267]
+  mov qword ptr [rsp+10992], rsi
+  mov rsi, qword ptr [rsp+11008]
+  cmp rsi, qword ptr [rsp+11000]
+  jne .L.else.main.672
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+10992]
+  mov r9, qword ptr [rsp+11000]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.673
+.L.else.main.672:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+10992]
+  mov r9, qword ptr [rsp+11008]
+  mov r10, qword ptr [rsp+11000]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.673:
+  mov qword ptr [rsp+11032], 8
+  mov qword ptr [rsp+11024], 8
+  lea rsi, [rip+.L.data.main.268]
+  mov qword ptr [rsp+11016], rsi
+  mov rsi, qword ptr [rsp+11032]
+  cmp rsi, qword ptr [rsp+11024]
+  jne .L.else.main.674
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11016]
+  mov r9, qword ptr [rsp+11024]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.675
+.L.else.main.674:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11016]
+  mov r9, qword ptr [rsp+11032]
+  mov r10, qword ptr [rsp+11024]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.675:
+  mov qword ptr [rsp+11056], 8
+  mov qword ptr [rsp+11048], 8
+  lea rsi, [rip+.L.data.main.269]
+  mov qword ptr [rsp+11040], rsi
+  mov rsi, qword ptr [rsp+11056]
+  cmp rsi, qword ptr [rsp+11048]
+  jne .L.else.main.676
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11040]
+  mov r9, qword ptr [rsp+11048]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.677
+.L.else.main.676:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11040]
+  mov r9, qword ptr [rsp+11056]
+  mov r10, qword ptr [rsp+11048]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.677:
+  mov qword ptr [rsp+11080], 8
+  mov qword ptr [rsp+11072], 8
+  lea rsi, [rip+.L.data.main.270]
+  mov qword ptr [rsp+11064], rsi
+  mov rsi, qword ptr [rsp+11080]
+  cmp rsi, qword ptr [rsp+11072]
+  jne .L.else.main.678
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11064]
+  mov r9, qword ptr [rsp+11072]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.679
+.L.else.main.678:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11064]
+  mov r9, qword ptr [rsp+11080]
+  mov r10, qword ptr [rsp+11072]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.679:
+  mov qword ptr [rsp+11104], 8
+  mov qword ptr [rsp+11096], 8
+  lea rsi, [rip+.L.data.main.271]
+  mov qword ptr [rsp+11088], rsi
+  mov rsi, qword ptr [rsp+11104]
+  cmp rsi, qword ptr [rsp+11096]
+  jne .L.else.main.680
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11088]
+  mov r9, qword ptr [rsp+11096]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.681
+.L.else.main.680:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11088]
+  mov r9, qword ptr [rsp+11104]
+  mov r10, qword ptr [rsp+11096]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.681:
+  mov qword ptr [rsp+11128], 32
+  mov qword ptr [rsp+11120], 32
+  lea rsi, [rip+.L.data.main.272]
+  mov qword ptr [rsp+11112], rsi
+  mov rsi, qword ptr [rsp+11128]
+  cmp rsi, qword ptr [rsp+11120]
+  jne .L.else.main.682
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11112]
+  mov r9, qword ptr [rsp+11120]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.683
+.L.else.main.682:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11112]
+  mov r9, qword ptr [rsp+11128]
+  mov r10, qword ptr [rsp+11120]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.683:
+  mov qword ptr [rsp+11152], 16
+  mov qword ptr [rsp+11144], 16
+  lea rsi, [rip+.L.data.main.273]
+  mov qword ptr [rsp+11136], rsi
+  mov rsi, qword ptr [rsp+11152]
+  cmp rsi, qword ptr [rsp+11144]
+  jne .L.else.main.684
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11136]
+  mov r9, qword ptr [rsp+11144]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.685
+.L.else.main.684:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11136]
+  mov r9, qword ptr [rsp+11152]
+  mov r10, qword ptr [rsp+11144]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.685:
+  mov qword ptr [rsp+11176], 48
+  mov qword ptr [rsp+11168], 48
+  lea rsi, [rip+.L.data.main.274]
+  mov qword ptr [rsp+11160], rsi
+  mov rsi, qword ptr [rsp+11176]
+  cmp rsi, qword ptr [rsp+11168]
+  jne .L.else.main.686
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11160]
+  mov r9, qword ptr [rsp+11168]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.687
+.L.else.main.686:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11160]
+  mov r9, qword ptr [rsp+11176]
+  mov r10, qword ptr [rsp+11168]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.687:
+  mov qword ptr [rsp+11200], 8
+  mov qword ptr [rsp+11192], 8
+  lea rsi, [rip+.L.data.main.275]
+  mov qword ptr [rsp+11184], rsi
+  mov rsi, qword ptr [rsp+11200]
+  cmp rsi, qword ptr [rsp+11192]
+  jne .L.else.main.688
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11184]
+  mov r9, qword ptr [rsp+11192]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.689
+.L.else.main.688:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11184]
+  mov r9, qword ptr [rsp+11200]
+  mov r10, qword ptr [rsp+11192]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.689:
+  mov qword ptr [rsp+11224], 131585
+  mov qword ptr [rsp+11216], 131585
+  lea rsi, [rip+.L.data.main.276]
+  mov qword ptr [rsp+11208], rsi
+  mov rsi, qword ptr [rsp+11224]
+  cmp rsi, qword ptr [rsp+11216]
+  jne .L.else.main.690
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11208]
+  mov r9, qword ptr [rsp+11216]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.691
+.L.else.main.690:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11208]
+  mov r9, qword ptr [rsp+11224]
+  mov r10, qword ptr [rsp+11216]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.691:
+  mov qword ptr [rsp+11248], 513
+  mov qword ptr [rsp+11240], 513
+  lea rsi, [rip+.L.data.main.277]
+  mov qword ptr [rsp+11232], rsi
+  mov rsi, qword ptr [rsp+11248]
+  cmp rsi, qword ptr [rsp+11240]
+  jne .L.else.main.692
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11232]
+  mov r9, qword ptr [rsp+11240]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.693
+.L.else.main.692:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11232]
+  mov r9, qword ptr [rsp+11248]
+  mov r10, qword ptr [rsp+11240]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.693:
+  mov qword ptr [rsp+11272], 1
+  mov qword ptr [rsp+11264], 1
+  lea rsi, [rip+.L.data.main.278]
+  mov qword ptr [rsp+11256], rsi
+  mov rsi, qword ptr [rsp+11272]
+  cmp rsi, qword ptr [rsp+11264]
+  jne .L.else.main.694
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11256]
+  mov r9, qword ptr [rsp+11264]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.695
+.L.else.main.694:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11256]
+  mov r9, qword ptr [rsp+11272]
+  mov r10, qword ptr [rsp+11264]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.695:
+  mov qword ptr [rsp+11296], 1
+  mov rsi, 1
+  cmp rsi, 0
+  setne sil
+  movsx rsi, sil
+  mov qword ptr [rsp+11288], rsi
+  lea rsi, [rip+.L.data.main.279]
+  mov qword ptr [rsp+11280], rsi
+  mov rsi, qword ptr [rsp+11296]
+  cmp rsi, qword ptr [rsp+11288]
+  jne .L.else.main.696
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11280]
+  mov r9, qword ptr [rsp+11288]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.697
+.L.else.main.696:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11280]
+  mov r9, qword ptr [rsp+11296]
+  mov r10, qword ptr [rsp+11288]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.697:
+  mov qword ptr [rsp+11320], 1
+  mov rsi, 2
+  cmp rsi, 0
+  setne sil
+  movsx rsi, sil
+  mov qword ptr [rsp+11312], rsi
+  lea rsi, [rip+.L.data.main.280]
+  mov qword ptr [rsp+11304], rsi
+  mov rsi, qword ptr [rsp+11320]
+  cmp rsi, qword ptr [rsp+11312]
+  jne .L.else.main.698
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11304]
+  mov r9, qword ptr [rsp+11312]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.699
+.L.else.main.698:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11304]
+  mov r9, qword ptr [rsp+11320]
+  mov r10, qword ptr [rsp+11312]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.699:
+  mov qword ptr [rsp+11344], 0
+  mov rsi, 0
+  cmp rsi, 0
+  setne sil
+  movsx rsi, sil
+  mov qword ptr [rsp+11336], rsi
+  lea rsi, [rip+.L.data.main.281]
+  mov qword ptr [rsp+11328], rsi
+  mov rsi, qword ptr [rsp+11344]
+  cmp rsi, qword ptr [rsp+11336]
+  jne .L.else.main.700
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11328]
+  mov r9, qword ptr [rsp+11336]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.701
+.L.else.main.700:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11328]
+  mov r9, qword ptr [rsp+11344]
+  mov r10, qword ptr [rsp+11336]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.701:
+  mov qword ptr [rsp+11368], 1
+  mov qword ptr [rsp+11360], 1
+  lea rsi, [rip+.L.data.main.282]
+  mov qword ptr [rsp+11352], rsi
+  mov rsi, qword ptr [rsp+11368]
+  cmp rsi, qword ptr [rsp+11360]
+  jne .L.else.main.702
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11352]
+  mov r9, qword ptr [rsp+11360]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.703
+.L.else.main.702:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11352]
+  mov r9, qword ptr [rsp+11368]
+  mov r10, qword ptr [rsp+11360]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.703:
+  mov qword ptr [rsp+11392], 0
+  mov qword ptr [rsp+11384], 0
+  lea rsi, [rip+.L.data.main.283]
+  mov qword ptr [rsp+11376], rsi
+  mov rsi, qword ptr [rsp+11392]
+  cmp rsi, qword ptr [rsp+11384]
+  jne .L.else.main.704
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11376]
+  mov r9, qword ptr [rsp+11384]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.705
+.L.else.main.704:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11376]
+  mov r9, qword ptr [rsp+11392]
+  mov r10, qword ptr [rsp+11384]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.705:
+  mov qword ptr [rsp+11416], 5
+  mov dword ptr [rsp+2100], 5
+  lea rsi, [rsp+2100]
+  mov qword ptr [rsp+2104], rsi
+  mov rsi, qword ptr [rsp+2104]
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+11408], rsi
+  lea rsi, [rip+.L.data.main.284]
+  mov qword ptr [rsp+11400], rsi
+  mov rsi, qword ptr [rsp+11416]
+  cmp rsi, qword ptr [rsp+11408]
+  jne .L.else.main.706
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11400]
+  mov r9, qword ptr [rsp+11408]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.707
+.L.else.main.706:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11400]
+  mov r9, qword ptr [rsp+11416]
+  mov r10, qword ptr [rsp+11408]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.707:
+  mov qword ptr [rsp+11440], 97
+  mov qword ptr [rsp+11432], 97
+  lea rsi, [rip+.L.data.main.285]
+  mov qword ptr [rsp+11424], rsi
+  mov rsi, qword ptr [rsp+11440]
+  cmp rsi, qword ptr [rsp+11432]
+  jne .L.else.main.708
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11424]
+  mov r9, qword ptr [rsp+11432]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.709
+.L.else.main.708:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11424]
+  mov r9, qword ptr [rsp+11440]
+  mov r10, qword ptr [rsp+11432]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.709:
+  mov qword ptr [rsp+11464], 10
+  mov qword ptr [rsp+11456], 10
+  lea rsi, [rip+.L.data.main.286]
+  mov qword ptr [rsp+11448], rsi
+  mov rsi, qword ptr [rsp+11464]
+  cmp rsi, qword ptr [rsp+11456]
+  jne .L.else.main.710
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11448]
+  mov r9, qword ptr [rsp+11456]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.711
+.L.else.main.710:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11448]
+  mov r9, qword ptr [rsp+11464]
+  mov r10, qword ptr [rsp+11456]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.711:
+  mov qword ptr [rsp+11488], 98
+  mov rsi, 97
+  add rsi, 1
+  mov qword ptr [rsp+11480], rsi
+  lea rsi, [rip+.L.data.main.287]
+  mov qword ptr [rsp+11472], rsi
+  mov rsi, qword ptr [rsp+11488]
+  cmp rsi, qword ptr [rsp+11480]
+  jne .L.else.main.712
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11472]
+  mov r9, qword ptr [rsp+11480]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.713
+.L.else.main.712:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11472]
+  mov r9, qword ptr [rsp+11488]
+  mov r10, qword ptr [rsp+11480]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.713:
+  mov qword ptr [rsp+11512], 4
+  mov qword ptr [rsp+11504], 4
+  lea rsi, [rip+.L.data.main.288]
+  mov qword ptr [rsp+11496], rsi
+  mov rsi, qword ptr [rsp+11512]
+  cmp rsi, qword ptr [rsp+11504]
+  jne .L.else.main.714
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11496]
+  mov r9, qword ptr [rsp+11504]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.715
+.L.else.main.714:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11496]
+  mov r9, qword ptr [rsp+11512]
+  mov r10, qword ptr [rsp+11504]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.715:
+  mov qword ptr [rsp+11536], 0
+  mov qword ptr [rsp+11528], 0
+  lea rsi, [rip+.L.data.main.289]
+  mov qword ptr [rsp+11520], rsi
+  mov rsi, qword ptr [rsp+11536]
+  cmp rsi, qword ptr [rsp+11528]
+  jne .L.else.main.716
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11520]
+  mov r9, qword ptr [rsp+11528]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.717
+.L.else.main.716:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11520]
+  mov r9, qword ptr [rsp+11536]
+  mov r10, qword ptr [rsp+11528]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.717:
+  mov qword ptr [rsp+11560], 1
+  mov qword ptr [rsp+11552], 1
+  lea rsi, [rip+.L.data.main.290]
+  mov qword ptr [rsp+11544], rsi
+  mov rsi, qword ptr [rsp+11560]
+  cmp rsi, qword ptr [rsp+11552]
+  jne .L.else.main.718
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11544]
+  mov r9, qword ptr [rsp+11552]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.719
+.L.else.main.718:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11544]
+  mov r9, qword ptr [rsp+11560]
+  mov r10, qword ptr [rsp+11552]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.719:
+  mov qword ptr [rsp+11584], 2
+  mov qword ptr [rsp+11576], 2
+  lea rsi, [rip+.L.data.main.291]
+  mov qword ptr [rsp+11568], rsi
+  mov rsi, qword ptr [rsp+11584]
+  cmp rsi, qword ptr [rsp+11576]
+  jne .L.else.main.720
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11568]
+  mov r9, qword ptr [rsp+11576]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.721
+.L.else.main.720:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11568]
+  mov r9, qword ptr [rsp+11584]
+  mov r10, qword ptr [rsp+11576]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.721:
+  mov qword ptr [rsp+11608], 5
+  mov qword ptr [rsp+11600], 5
+  lea rsi, [rip+.L.data.main.292]
+  mov qword ptr [rsp+11592], rsi
+  mov rsi, qword ptr [rsp+11608]
+  cmp rsi, qword ptr [rsp+11600]
+  jne .L.else.main.722
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11592]
+  mov r9, qword ptr [rsp+11600]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.723
+.L.else.main.722:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11592]
+  mov r9, qword ptr [rsp+11608]
+  mov r10, qword ptr [rsp+11600]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.723:
+  mov qword ptr [rsp+11632], 6
+  mov qword ptr [rsp+11624], 6
+  lea rsi, [rip+.L.data.main.293]
+  mov qword ptr [rsp+11616], rsi
+  mov rsi, qword ptr [rsp+11632]
+  cmp rsi, qword ptr [rsp+11624]
+  jne .L.else.main.724
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11616]
+  mov r9, qword ptr [rsp+11624]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.725
+.L.else.main.724:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11616]
+  mov r9, qword ptr [rsp+11632]
+  mov r10, qword ptr [rsp+11624]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.725:
+  mov qword ptr [rsp+11656], 0
+  mov qword ptr [rsp+11648], 0
+  lea rsi, [rip+.L.data.main.294]
+  mov qword ptr [rsp+11640], rsi
+  mov rsi, qword ptr [rsp+11656]
+  cmp rsi, qword ptr [rsp+11648]
+  jne .L.else.main.726
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11640]
+  mov r9, qword ptr [rsp+11648]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.727
+.L.else.main.726:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11640]
+  mov r9, qword ptr [rsp+11656]
+  mov r10, qword ptr [rsp+11648]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.727:
+  mov qword ptr [rsp+11680], 5
+  mov qword ptr [rsp+11672], 5
+  lea rsi, [rip+.L.data.main.295]
+  mov qword ptr [rsp+11664], rsi
+  mov rsi, qword ptr [rsp+11680]
+  cmp rsi, qword ptr [rsp+11672]
+  jne .L.else.main.728
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11664]
+  mov r9, qword ptr [rsp+11672]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.729
+.L.else.main.728:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11664]
+  mov r9, qword ptr [rsp+11680]
+  mov r10, qword ptr [rsp+11672]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.729:
+  mov qword ptr [rsp+11704], 3
+  mov qword ptr [rsp+11696], 3
+  lea rsi, [rip+.L.data.main.296]
+  mov qword ptr [rsp+11688], rsi
+  mov rsi, qword ptr [rsp+11704]
+  cmp rsi, qword ptr [rsp+11696]
+  jne .L.else.main.730
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11688]
+  mov r9, qword ptr [rsp+11696]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.731
+.L.else.main.730:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11688]
+  mov r9, qword ptr [rsp+11704]
+  mov r10, qword ptr [rsp+11696]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.731:
+  mov qword ptr [rsp+11728], 4
+  mov qword ptr [rsp+11720], 4
+  lea rsi, [rip+.L.data.main.297]
+  mov qword ptr [rsp+11712], rsi
+  mov rsi, qword ptr [rsp+11728]
+  cmp rsi, qword ptr [rsp+11720]
+  jne .L.else.main.732
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11712]
+  mov r9, qword ptr [rsp+11720]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.733
+.L.else.main.732:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11712]
+  mov r9, qword ptr [rsp+11728]
+  mov r10, qword ptr [rsp+11720]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.733:
+  mov qword ptr [rsp+11752], 4
+  mov qword ptr [rsp+11744], 4
+  lea rsi, [rip+.L.data.main.298]
+  mov qword ptr [rsp+11736], rsi
+  mov rsi, qword ptr [rsp+11752]
+  cmp rsi, qword ptr [rsp+11744]
+  jne .L.else.main.734
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11736]
+  mov r9, qword ptr [rsp+11744]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.735
+.L.else.main.734:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11736]
+  mov r9, qword ptr [rsp+11752]
+  mov r10, qword ptr [rsp+11744]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.735:
+  mov qword ptr [rsp+11776], 4
+  mov qword ptr [rsp+11768], 4
+  lea rsi, [rip+.L.data.main.299]
+  mov qword ptr [rsp+11760], rsi
+  mov rsi, qword ptr [rsp+11776]
+  cmp rsi, qword ptr [rsp+11768]
+  jne .L.else.main.736
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11760]
+  mov r9, qword ptr [rsp+11768]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.737
+.L.else.main.736:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11760]
+  mov r9, qword ptr [rsp+11776]
+  mov r10, qword ptr [rsp+11768]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.737:
+  mov qword ptr [rsp+11800], 3
+  mov qword ptr [rsp+11792], 3
+  lea rsi, [rip+.L.data.main.300]
+  mov qword ptr [rsp+11784], rsi
+  mov rsi, qword ptr [rsp+11800]
+  cmp rsi, qword ptr [rsp+11792]
+  jne .L.else.main.738
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11784]
+  mov r9, qword ptr [rsp+11792]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.739
+.L.else.main.738:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11784]
+  mov r9, qword ptr [rsp+11800]
+  mov r10, qword ptr [rsp+11792]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.739:
+  mov qword ptr [rsp+11824], 55
+  mov dword ptr [rsp+2120], 0
+  mov dword ptr [rsp+2124], 0
+  movsxd rsi, dword ptr [rsp+2124]
+  cmp rsi, 10
+  jg .L.break.main.741
+  .p2align 4,,10
+.L.begin.main.742:
+  movsxd rsi, dword ptr [rsp+2120]
+  movsxd rdi, dword ptr [rsp+2124]
+  add rsi, rdi
+  mov dword ptr [rsp+2120], esi
+  add dword ptr [rsp+2124], 1
+  movsxd rsi, dword ptr [rsp+2124]
+  cmp rsi, 10
+  jle .L.begin.main.742
+.L.break.main.741:
+  movsxd rsi, dword ptr [rsp+2120]
+  mov qword ptr [rsp+11816], rsi
+  lea rsi, [rip+.L.data.main.301]
+  mov qword ptr [rsp+11808], rsi
+  mov rsi, qword ptr [rsp+11824]
+  cmp rsi, qword ptr [rsp+11816]
+  jne .L.else.main.743
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11808]
+  mov r9, qword ptr [rsp+11816]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.744
+.L.else.main.743:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11808]
+  mov r9, qword ptr [rsp+11824]
+  mov r10, qword ptr [rsp+11816]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.744:
+  mov qword ptr [rsp+11848], 3
+  mov dword ptr [rsp+2128], 3
+  mov dword ptr [rsp+2132], 0
+  mov dword ptr [rsp+2136], 0
+  movsxd rsi, dword ptr [rsp+2136]
+  cmp rsi, 10
+  jg .L.break.main.746
+  .p2align 4,,10
+.L.begin.main.747:
+  movsxd rsi, dword ptr [rsp+2132]
+  movsxd rdi, dword ptr [rsp+2136]
+  add rsi, rdi
+  mov dword ptr [rsp+2132], esi
+  add dword ptr [rsp+2136], 1
+  movsxd rsi, dword ptr [rsp+2136]
+  cmp rsi, 10
+  jle .L.begin.main.747
+.L.break.main.746:
+  movsxd rsi, dword ptr [rsp+2128]
+  mov qword ptr [rsp+11840], rsi
+  lea rsi, [rip+.L.data.main.302]
+  mov qword ptr [rsp+11832], rsi
+  mov rsi, qword ptr [rsp+11848]
+  cmp rsi, qword ptr [rsp+11840]
+  jne .L.else.main.748
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11832]
+  mov r9, qword ptr [rsp+11840]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.749
+.L.else.main.748:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11832]
+  mov r9, qword ptr [rsp+11848]
+  mov r10, qword ptr [rsp+11840]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.749:
+  mov qword ptr [rsp+11872], 3
+  mov qword ptr [rsp+11864], 3
+  lea rsi, [rip+.L.data.main.303]
+  mov qword ptr [rsp+11856], rsi
+  mov rsi, qword ptr [rsp+11872]
+  cmp rsi, qword ptr [rsp+11864]
+  jne .L.else.main.750
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11856]
+  mov r9, qword ptr [rsp+11864]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.751
+.L.else.main.750:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11856]
+  mov r9, qword ptr [rsp+11872]
+  mov r10, qword ptr [rsp+11864]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.751:
+  mov qword ptr [rsp+11896], 3
+  mov dword ptr [rsp+2140], 2
+  movsxd rsi, dword ptr [rsp+2140]
+  add rsi, 1
+  mov dword ptr [rsp+2140], esi
+  mov qword ptr [rsp+11888], rsi
+  lea rsi, [rip+.L.data.main.304]
+  mov qword ptr [rsp+11880], rsi
+  mov rsi, qword ptr [rsp+11896]
+  cmp rsi, qword ptr [rsp+11888]
+  jne .L.else.main.752
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11880]
+  mov r9, qword ptr [rsp+11888]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.753
+.L.else.main.752:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11880]
+  mov r9, qword ptr [rsp+11896]
+  mov r10, qword ptr [rsp+11888]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.753:
+  mov qword ptr [rsp+11920], 1
+  mov dword ptr [rsp+2144], 2
+  movsxd rsi, dword ptr [rsp+2144]
+  sub rsi, 1
+  mov dword ptr [rsp+2144], esi
+  mov qword ptr [rsp+11912], rsi
+  lea rsi, [rip+.L.data.main.305]
+  mov qword ptr [rsp+11904], rsi
+  mov rsi, qword ptr [rsp+11920]
+  cmp rsi, qword ptr [rsp+11912]
+  jne .L.else.main.754
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11904]
+  mov r9, qword ptr [rsp+11912]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.755
+.L.else.main.754:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11904]
+  mov r9, qword ptr [rsp+11920]
+  mov r10, qword ptr [rsp+11912]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.755:
+  mov qword ptr [rsp+11944], 2
+  mov dword ptr [rsp+2148], 2
+  movsxd rsi, dword ptr [rsp+2148]
+  add rsi, 1
+  mov dword ptr [rsp+2148], esi
+  sub rsi, 1
+  mov qword ptr [rsp+11936], rsi
+  lea rsi, [rip+.L.data.main.306]
+  mov qword ptr [rsp+11928], rsi
+  mov rsi, qword ptr [rsp+11944]
+  cmp rsi, qword ptr [rsp+11936]
+  jne .L.else.main.756
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11928]
+  mov r9, qword ptr [rsp+11936]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.757
+.L.else.main.756:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11928]
+  mov r9, qword ptr [rsp+11944]
+  mov r10, qword ptr [rsp+11936]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.757:
+  mov qword ptr [rsp+11968], 2
+  mov dword ptr [rsp+2152], 2
+  movsxd rsi, dword ptr [rsp+2152]
+  sub rsi, 1
+  mov dword ptr [rsp+2152], esi
+  add rsi, 1
+  mov qword ptr [rsp+11960], rsi
+  lea rsi, [rip+.L.data.main.307]
+  mov qword ptr [rsp+11952], rsi
+  mov rsi, qword ptr [rsp+11968]
+  cmp rsi, qword ptr [rsp+11960]
+  jne .L.else.main.758
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11952]
+  mov r9, qword ptr [rsp+11960]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.759
+.L.else.main.758:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11952]
+  mov r9, qword ptr [rsp+11968]
+  mov r10, qword ptr [rsp+11960]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.759:
+  mov qword ptr [rsp+11992], 3
+  mov dword ptr [rsp+2156], 2
+  add dword ptr [rsp+2156], 1
+  movsxd rsi, dword ptr [rsp+2156]
+  mov qword ptr [rsp+11984], rsi
+  lea rsi, [rip+.L.data.main.308]
+  mov qword ptr [rsp+11976], rsi
+  mov rsi, qword ptr [rsp+11992]
+  cmp rsi, qword ptr [rsp+11984]
+  jne .L.else.main.760
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+11976]
+  mov r9, qword ptr [rsp+11984]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.761
+.L.else.main.760:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+11976]
+  mov r9, qword ptr [rsp+11992]
+  mov r10, qword ptr [rsp+11984]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.761:
+  mov qword ptr [rsp+12016], 1
+  mov dword ptr [rsp+2160], 2
+  sub dword ptr [rsp+2160], 1
+  movsxd rsi, dword ptr [rsp+2160]
+  mov qword ptr [rsp+12008], rsi
+  lea rsi, [rip+.L.data.main.309]
+  mov qword ptr [rsp+12000], rsi
+  mov rsi, qword ptr [rsp+12016]
+  cmp rsi, qword ptr [rsp+12008]
+  jne .L.else.main.762
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12000]
+  mov r9, qword ptr [rsp+12008]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.763
+.L.else.main.762:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12000]
+  mov r9, qword ptr [rsp+12016]
+  mov r10, qword ptr [rsp+12008]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.763:
+  mov qword ptr [rsp+12040], 1
+  lea rsi, [rsp+2164]
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rsp+2164]
+  add rsi, 4
+  mov dword ptr [rsi], 1
+  lea rsi, [rsp+2164]
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  lea rsi, [rsp+2164]
+  add rsi, 4
+  mov qword ptr [rsp+2176], rsi
+  mov rsi, qword ptr [rsp+2176]
+  add rsi, 4
+  mov qword ptr [rsp+2176], rsi
+  sub rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+12032], rsi
+  lea rsi, [rip+.L.data.main.310]
+  mov qword ptr [rsp+12024], rsi
+  mov rsi, qword ptr [rsp+12040]
+  cmp rsi, qword ptr [rsp+12032]
+  jne .L.else.main.764
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12024]
+  mov r9, qword ptr [rsp+12032]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.765
+.L.else.main.764:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12024]
+  mov r9, qword ptr [rsp+12040]
+  mov r10, qword ptr [rsp+12032]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.765:
+  mov qword ptr [rsp+12064], 2
+  lea rsi, [rsp+2188]
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rsp+2188]
+  add rsi, 4
+  mov dword ptr [rsi], 1
+  lea rsi, [rsp+2188]
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  lea rsi, [rsp+2188]
+  add rsi, 4
+  mov qword ptr [rsp+2200], rsi
+  mov rsi, qword ptr [rsp+2200]
+  movsxd rdi, dword ptr [rsi]
+  add rdi, 1
+  mov dword ptr [rsi], edi
+  mov qword ptr [rsp+12056], rdi
+  lea rsi, [rip+.L.data.main.311]
+  mov qword ptr [rsp+12048], rsi
+  mov rsi, qword ptr [rsp+12064]
+  cmp rsi, qword ptr [rsp+12056]
+  jne .L.else.main.766
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12048]
+  mov r9, qword ptr [rsp+12056]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.767
+.L.else.main.766:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12048]
+  mov r9, qword ptr [rsp+12064]
+  mov r10, qword ptr [rsp+12056]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.767:
+  mov qword ptr [rsp+12088], 1
+  lea rsi, [rsp+2212]
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rsp+2212]
+  add rsi, 4
+  mov dword ptr [rsi], 1
+  lea rsi, [rsp+2212]
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  lea rsi, [rsp+2212]
+  add rsi, 4
+  mov qword ptr [rsp+2224], rsi
+  mov rsi, qword ptr [rsp+2224]
+  sub rsi, 4
+  mov qword ptr [rsp+2224], rsi
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+12080], rsi
+  lea rsi, [rip+.L.data.main.312]
+  mov qword ptr [rsp+12072], rsi
+  mov rsi, qword ptr [rsp+12088]
+  cmp rsi, qword ptr [rsp+12080]
+  jne .L.else.main.768
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12072]
+  mov r9, qword ptr [rsp+12080]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.769
+.L.else.main.768:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12072]
+  mov r9, qword ptr [rsp+12088]
+  mov r10, qword ptr [rsp+12080]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.769:
+  mov qword ptr [rsp+12112], 0
+  lea rsi, [rsp+2236]
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rsp+2236]
+  add rsi, 4
+  mov dword ptr [rsi], 1
+  lea rsi, [rsp+2236]
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  lea rsi, [rsp+2236]
+  add rsi, 4
+  mov qword ptr [rsp+2248], rsi
+  mov rsi, qword ptr [rsp+2248]
+  movsxd rdi, dword ptr [rsi]
+  sub rdi, 1
+  mov dword ptr [rsi], edi
+  mov qword ptr [rsp+12104], rdi
+  lea rsi, [rip+.L.data.main.313]
+  mov qword ptr [rsp+12096], rsi
+  mov rsi, qword ptr [rsp+12112]
+  cmp rsi, qword ptr [rsp+12104]
+  jne .L.else.main.770
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12096]
+  mov r9, qword ptr [rsp+12104]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.771
+.L.else.main.770:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12096]
+  mov r9, qword ptr [rsp+12112]
+  mov r10, qword ptr [rsp+12104]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.771:
+  mov qword ptr [rsp+12136], 0
+  lea rsi, [rsp+2260]
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rsp+2260]
+  add rsi, 4
+  mov dword ptr [rsi], 1
+  lea rsi, [rsp+2260]
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  lea rsi, [rsp+2260]
+  add rsi, 4
+  mov qword ptr [rsp+2272], rsi
+  mov rsi, qword ptr [rsp+2272]
+  add rsi, 4
+  mov qword ptr [rsp+2272], rsi
+  sub rsi, 4
+  sub dword ptr [rsi], 1
+  lea rsi, [rsp+2260]
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+12128], rsi
+  lea rsi, [rip+.L.data.main.314]
+  mov qword ptr [rsp+12120], rsi
+  mov rsi, qword ptr [rsp+12136]
+  cmp rsi, qword ptr [rsp+12128]
+  jne .L.else.main.772
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12120]
+  mov r9, qword ptr [rsp+12128]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.773
+.L.else.main.772:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12120]
+  mov r9, qword ptr [rsp+12136]
+  mov r10, qword ptr [rsp+12128]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.773:
+  mov qword ptr [rsp+12160], 0
+  lea rsi, [rsp+2284]
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rsp+2284]
+  add rsi, 4
+  mov dword ptr [rsi], 1
+  lea rsi, [rsp+2284]
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  lea rsi, [rsp+2284]
+  add rsi, 4
+  mov qword ptr [rsp+2296], rsi
+  mov rsi, qword ptr [rsp+2296]
+  add rsi, 4
+  mov qword ptr [rsp+2296], rsi
+  sub rsi, 4
+  sub dword ptr [rsi], 1
+  lea rsi, [rsp+2284]
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+12152], rsi
+  lea rsi, [rip+.L.data.main.315]
+  mov qword ptr [rsp+12144], rsi
+  mov rsi, qword ptr [rsp+12160]
+  cmp rsi, qword ptr [rsp+12152]
+  jne .L.else.main.774
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12144]
+  mov r9, qword ptr [rsp+12152]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.775
+.L.else.main.774:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12144]
+  mov r9, qword ptr [rsp+12160]
+  mov r10, qword ptr [rsp+12152]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.775:
+  mov qword ptr [rsp+12184], 2
+  lea rsi, [rsp+2308]
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rsp+2308]
+  add rsi, 4
+  mov dword ptr [rsi], 1
+  lea rsi, [rsp+2308]
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  lea rsi, [rsp+2308]
+  add rsi, 4
+  mov qword ptr [rsp+2320], rsi
+  mov rsi, qword ptr [rsp+2320]
+  add rsi, 4
+  mov qword ptr [rsp+2320], rsi
+  sub rsi, 4
+  sub dword ptr [rsi], 1
+  lea rsi, [rsp+2308]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+12176], rsi
+  lea rsi, [rip+.L.data.main.316]
+  mov qword ptr [rsp+12168], rsi
+  mov rsi, qword ptr [rsp+12184]
+  cmp rsi, qword ptr [rsp+12176]
+  jne .L.else.main.776
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12168]
+  mov r9, qword ptr [rsp+12176]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.777
+.L.else.main.776:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12168]
+  mov r9, qword ptr [rsp+12184]
+  mov r10, qword ptr [rsp+12176]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.777:
+  mov qword ptr [rsp+12208], 2
+  lea rsi, [rsp+2332]
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rsp+2332]
+  add rsi, 4
+  mov dword ptr [rsi], 1
+  lea rsi, [rsp+2332]
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  lea rsi, [rsp+2332]
+  add rsi, 4
+  mov qword ptr [rsp+2344], rsi
+  mov rsi, qword ptr [rsp+2344]
+  add rsi, 4
+  mov qword ptr [rsp+2344], rsi
+  sub rsi, 4
+  sub dword ptr [rsi], 1
+  mov rsi, qword ptr [rsp+2344]
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+12200], rsi
+  lea rsi, [rip+.L.data.main.317]
+  mov qword ptr [rsp+12192], rsi
+  mov rsi, qword ptr [rsp+12208]
+  cmp rsi, qword ptr [rsp+12200]
+  jne .L.else.main.778
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12192]
+  mov r9, qword ptr [rsp+12200]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.779
+.L.else.main.778:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12192]
+  mov r9, qword ptr [rsp+12208]
+  mov r10, qword ptr [rsp+12200]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.779:
+  mov qword ptr [rsp+12232], 7
+  mov dword ptr [rsp+2356], 2
+  add dword ptr [rsp+2356], 5
+  movsxd rsi, dword ptr [rsp+2356]
+  mov qword ptr [rsp+12224], rsi
+  lea rsi, [rip+.L.data.main.318]
+  mov qword ptr [rsp+12216], rsi
+  mov rsi, qword ptr [rsp+12232]
+  cmp rsi, qword ptr [rsp+12224]
+  jne .L.else.main.780
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12216]
+  mov r9, qword ptr [rsp+12224]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.781
+.L.else.main.780:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12216]
+  mov r9, qword ptr [rsp+12232]
+  mov r10, qword ptr [rsp+12224]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.781:
+  mov qword ptr [rsp+12256], 7
+  mov dword ptr [rsp+2360], 2
+  movsxd rsi, dword ptr [rsp+2360]
+  add rsi, 5
+  mov dword ptr [rsp+2360], esi
+  mov qword ptr [rsp+12248], rsi
+  lea rsi, [rip+.L.data.main.319]
+  mov qword ptr [rsp+12240], rsi
+  mov rsi, qword ptr [rsp+12256]
+  cmp rsi, qword ptr [rsp+12248]
+  jne .L.else.main.782
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12240]
+  mov r9, qword ptr [rsp+12248]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.783
+.L.else.main.782:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12240]
+  mov r9, qword ptr [rsp+12256]
+  mov r10, qword ptr [rsp+12248]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.783:
+  mov qword ptr [rsp+12280], 3
+  mov dword ptr [rsp+2364], 5
+  sub dword ptr [rsp+2364], 2
+  movsxd rsi, dword ptr [rsp+2364]
+  mov qword ptr [rsp+12272], rsi
+  lea rsi, [rip+.L.data.main.320]
+  mov qword ptr [rsp+12264], rsi
+  mov rsi, qword ptr [rsp+12280]
+  cmp rsi, qword ptr [rsp+12272]
+  jne .L.else.main.784
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12264]
+  mov r9, qword ptr [rsp+12272]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.785
+.L.else.main.784:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12264]
+  mov r9, qword ptr [rsp+12280]
+  mov r10, qword ptr [rsp+12272]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.785:
+  mov qword ptr [rsp+12304], 3
+  mov dword ptr [rsp+2368], 5
+  movsxd rsi, dword ptr [rsp+2368]
+  sub rsi, 2
+  mov dword ptr [rsp+2368], esi
+  mov qword ptr [rsp+12296], rsi
+  lea rsi, [rip+.L.data.main.321]
+  mov qword ptr [rsp+12288], rsi
+  mov rsi, qword ptr [rsp+12304]
+  cmp rsi, qword ptr [rsp+12296]
+  jne .L.else.main.786
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12288]
+  mov r9, qword ptr [rsp+12296]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.787
+.L.else.main.786:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12288]
+  mov r9, qword ptr [rsp+12304]
+  mov r10, qword ptr [rsp+12296]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.787:
+  mov qword ptr [rsp+12328], 6
+  mov dword ptr [rsp+2372], 3
+  shl dword ptr [rsp+2372], 1
+  movsxd rsi, dword ptr [rsp+2372]
+  mov qword ptr [rsp+12320], rsi
+  lea rsi, [rip+.L.data.main.322]
+  mov qword ptr [rsp+12312], rsi
+  mov rsi, qword ptr [rsp+12328]
+  cmp rsi, qword ptr [rsp+12320]
+  jne .L.else.main.788
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12312]
+  mov r9, qword ptr [rsp+12320]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.789
+.L.else.main.788:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12312]
+  mov r9, qword ptr [rsp+12328]
+  mov r10, qword ptr [rsp+12320]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.789:
+  mov qword ptr [rsp+12352], 6
+  mov dword ptr [rsp+2376], 3
+  movsxd rsi, dword ptr [rsp+2376]
+  shl rsi, 1
+  mov dword ptr [rsp+2376], esi
+  mov qword ptr [rsp+12344], rsi
+  lea rsi, [rip+.L.data.main.323]
+  mov qword ptr [rsp+12336], rsi
+  mov rsi, qword ptr [rsp+12352]
+  cmp rsi, qword ptr [rsp+12344]
+  jne .L.else.main.790
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12336]
+  mov r9, qword ptr [rsp+12344]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.791
+.L.else.main.790:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12336]
+  mov r9, qword ptr [rsp+12352]
+  mov r10, qword ptr [rsp+12344]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.791:
+  mov qword ptr [rsp+12376], 3
+  mov dword ptr [rsp+2380], 6
+  movsxd rsi, dword ptr [rsp+2380]
+  mov rdi, rsi
+  sar rdi, 63
+  and rdi, 1
+  add rsi, rdi
+  sar rsi, 1
+  mov dword ptr [rsp+2380], esi
+  movsxd rsi, dword ptr [rsp+2380]
+  mov qword ptr [rsp+12368], rsi
+  lea rsi, [rip+.L.data.main.324]
+  mov qword ptr [rsp+12360], rsi
+  mov rsi, qword ptr [rsp+12376]
+  cmp rsi, qword ptr [rsp+12368]
+  jne .L.else.main.792
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12360]
+  mov r9, qword ptr [rsp+12368]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.793
+.L.else.main.792:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12360]
+  mov r9, qword ptr [rsp+12376]
+  mov r10, qword ptr [rsp+12368]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.793:
+  mov qword ptr [rsp+12400], 3
+  mov dword ptr [rsp+2384], 6
+  movsxd rsi, dword ptr [rsp+2384]
+  mov rdi, rsi
+  sar rdi, 63
+  and rdi, 1
+  add rsi, rdi
+  sar rsi, 1
+  mov dword ptr [rsp+2384], esi
+  mov qword ptr [rsp+12392], rsi
+  lea rsi, [rip+.L.data.main.325]
+  mov qword ptr [rsp+12384], rsi
+  mov rsi, qword ptr [rsp+12400]
+  cmp rsi, qword ptr [rsp+12392]
+  jne .L.else.main.794
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12384]
+  mov r9, qword ptr [rsp+12392]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.795
+.L.else.main.794:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12384]
+  mov r9, qword ptr [rsp+12400]
+  mov r10, qword ptr [rsp+12392]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.795:
+  mov qword ptr [rsp+12424], 511
+  mov qword ptr [rsp+12416], 511
+  lea rsi, [rip+.L.data.main.326]
+  mov qword ptr [rsp+12408], rsi
+  mov rsi, qword ptr [rsp+12424]
+  cmp rsi, qword ptr [rsp+12416]
+  jne .L.else.main.796
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12408]
+  mov r9, qword ptr [rsp+12416]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.797
+.L.else.main.796:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12408]
+  mov r9, qword ptr [rsp+12424]
+  mov r10, qword ptr [rsp+12416]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.797:
+  mov qword ptr [rsp+12448], 0
+  mov qword ptr [rsp+12440], 0
+  lea rsi, [rip+.L.data.main.327]
+  mov qword ptr [rsp+12432], rsi
+  mov rsi, qword ptr [rsp+12448]
+  cmp rsi, qword ptr [rsp+12440]
+  jne .L.else.main.798
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12432]
+  mov r9, qword ptr [rsp+12440]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.799
+.L.else.main.798:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12432]
+  mov r9, qword ptr [rsp+12448]
+  mov r10, qword ptr [rsp+12440]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.799:
+  mov qword ptr [rsp+12472], 10
+  mov qword ptr [rsp+12464], 10
+  lea rsi, [rip+.L.data.main.328]
+  mov qword ptr [rsp+12456], rsi
+  mov rsi, qword ptr [rsp+12472]
+  cmp rsi, qword ptr [rsp+12464]
+  jne .L.else.main.800
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12456]
+  mov r9, qword ptr [rsp+12464]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.801
+.L.else.main.800:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12456]
+  mov r9, qword ptr [rsp+12472]
+  mov r10, qword ptr [rsp+12464]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.801:
+  mov qword ptr [rsp+12496], 10
+  mov qword ptr [rsp+12488], 10
+  lea rsi, [rip+.L.data.main.329]
+  mov qword ptr [rsp+12480], rsi
+  mov rsi, qword ptr [rsp+12496]
+  cmp rsi, qword ptr [rsp+12488]
+  jne .L.else.main.802
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12480]
+  mov r9, qword ptr [rsp+12488]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.803
+.L.else.main.802:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12480]
+  mov r9, qword ptr [rsp+12496]
+  mov r10, qword ptr [rsp+12488]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.803:
+  mov qword ptr [rsp+12520], 48879
+  mov qword ptr [rsp+12512], 48879
+  lea rsi, [rip+.L.data.main.330]
+  mov qword ptr [rsp+12504], rsi
+  mov rsi, qword ptr [rsp+12520]
+  cmp rsi, qword ptr [rsp+12512]
+  jne .L.else.main.804
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12504]
+  mov r9, qword ptr [rsp+12512]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.805
+.L.else.main.804:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12504]
+  mov r9, qword ptr [rsp+12520]
+  mov r10, qword ptr [rsp+12512]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.805:
+  mov qword ptr [rsp+12544], 48879
+  mov qword ptr [rsp+12536], 48879
+  lea rsi, [rip+.L.data.main.331]
+  mov qword ptr [rsp+12528], rsi
+  mov rsi, qword ptr [rsp+12544]
+  cmp rsi, qword ptr [rsp+12536]
+  jne .L.else.main.806
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12528]
+  mov r9, qword ptr [rsp+12536]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.807
+.L.else.main.806:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12528]
+  mov r9, qword ptr [rsp+12544]
+  mov r10, qword ptr [rsp+12536]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.807:
+  mov qword ptr [rsp+12568], 48879
+  mov qword ptr [rsp+12560], 48879
+  lea rsi, [rip+.L.data.main.332]
+  mov qword ptr [rsp+12552], rsi
+  mov rsi, qword ptr [rsp+12568]
+  cmp rsi, qword ptr [rsp+12560]
+  jne .L.else.main.808
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12552]
+  mov r9, qword ptr [rsp+12560]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.809
+.L.else.main.808:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12552]
+  mov r9, qword ptr [rsp+12568]
+  mov r10, qword ptr [rsp+12560]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.809:
+  mov qword ptr [rsp+12592], 0
+  mov qword ptr [rsp+12584], 0
+  lea rsi, [rip+.L.data.main.333]
+  mov qword ptr [rsp+12576], rsi
+  mov rsi, qword ptr [rsp+12592]
+  cmp rsi, qword ptr [rsp+12584]
+  jne .L.else.main.810
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12576]
+  mov r9, qword ptr [rsp+12584]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.811
+.L.else.main.810:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12576]
+  mov r9, qword ptr [rsp+12592]
+  mov r10, qword ptr [rsp+12584]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.811:
+  mov qword ptr [rsp+12616], 1
+  mov qword ptr [rsp+12608], 1
+  lea rsi, [rip+.L.data.main.334]
+  mov qword ptr [rsp+12600], rsi
+  mov rsi, qword ptr [rsp+12616]
+  cmp rsi, qword ptr [rsp+12608]
+  jne .L.else.main.812
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12600]
+  mov r9, qword ptr [rsp+12608]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.813
+.L.else.main.812:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12600]
+  mov r9, qword ptr [rsp+12616]
+  mov r10, qword ptr [rsp+12608]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.813:
+  mov qword ptr [rsp+12640], 47
+  mov qword ptr [rsp+12632], 47
+  lea rsi, [rip+.L.data.main.335]
+  mov qword ptr [rsp+12624], rsi
+  mov rsi, qword ptr [rsp+12640]
+  cmp rsi, qword ptr [rsp+12632]
+  jne .L.else.main.814
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12624]
+  mov r9, qword ptr [rsp+12632]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.815
+.L.else.main.814:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12624]
+  mov r9, qword ptr [rsp+12640]
+  mov r10, qword ptr [rsp+12632]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.815:
+  mov qword ptr [rsp+12664], 47
+  mov qword ptr [rsp+12656], 47
+  lea rsi, [rip+.L.data.main.336]
+  mov qword ptr [rsp+12648], rsi
+  mov rsi, qword ptr [rsp+12664]
+  cmp rsi, qword ptr [rsp+12656]
+  jne .L.else.main.816
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12648]
+  mov r9, qword ptr [rsp+12656]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.817
+.L.else.main.816:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12648]
+  mov r9, qword ptr [rsp+12664]
+  mov r10, qword ptr [rsp+12656]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.817:
+  mov qword ptr [rsp+12688], 0
+  mov rsi, 1
+  cmp rsi, 0
+  sete sil
+  movzx rsi, sil
+  mov qword ptr [rsp+12680], rsi
+  lea rsi, [rip+.L.data.main.337]
+  mov qword ptr [rsp+12672], rsi
+  mov rsi, qword ptr [rsp+12688]
+  cmp rsi, qword ptr [rsp+12680]
+  jne .L.else.main.818
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12672]
+  mov r9, qword ptr [rsp+12680]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.819
+.L.else.main.818:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12672]
+  mov r9, qword ptr [rsp+12688]
+  mov r10, qword ptr [rsp+12680]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.819:
+  mov qword ptr [rsp+12712], 0
+  mov rsi, 2
+  cmp rsi, 0
+  sete sil
+  movzx rsi, sil
+  mov qword ptr [rsp+12704], rsi
+  lea rsi, [rip+.L.data.main.338]
+  mov qword ptr [rsp+12696], rsi
+  mov rsi, qword ptr [rsp+12712]
+  cmp rsi, qword ptr [rsp+12704]
+  jne .L.else.main.820
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12696]
+  mov r9, qword ptr [rsp+12704]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.821
+.L.else.main.820:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12696]
+  mov r9, qword ptr [rsp+12712]
+  mov r10, qword ptr [rsp+12704]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.821:
+  mov qword ptr [rsp+12736], 1
+  mov rsi, 0
+  cmp rsi, 0
+  sete sil
+  movzx rsi, sil
+  mov qword ptr [rsp+12728], rsi
+  lea rsi, [rip+.L.data.main.339]
+  mov qword ptr [rsp+12720], rsi
+  mov rsi, qword ptr [rsp+12736]
+  cmp rsi, qword ptr [rsp+12728]
+  jne .L.else.main.822
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12720]
+  mov r9, qword ptr [rsp+12728]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.823
+.L.else.main.822:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12720]
+  mov r9, qword ptr [rsp+12736]
+  mov r10, qword ptr [rsp+12728]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.823:
+  mov rsi, 0
+  sub rsi, 1
+  mov qword ptr [rsp+12760], rsi
+  mov rsi, 0
+  not rsi
+  mov qword ptr [rsp+12752], rsi
+  lea rsi, [rip+.L.data.main.340]
+  mov qword ptr [rsp+12744], rsi
+  mov rsi, qword ptr [rsp+12760]
+  cmp rsi, qword ptr [rsp+12752]
+  jne .L.else.main.824
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12744]
+  mov r9, qword ptr [rsp+12752]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.825
+.L.else.main.824:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12744]
+  mov r9, qword ptr [rsp+12760]
+  mov r10, qword ptr [rsp+12752]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.825:
+  mov qword ptr [rsp+12784], 0
+  mov rsi, 0
+  sub rsi, 1
+  not rsi
+  mov qword ptr [rsp+12776], rsi
+  lea rsi, [rip+.L.data.main.341]
+  mov qword ptr [rsp+12768], rsi
+  mov rsi, qword ptr [rsp+12784]
+  cmp rsi, qword ptr [rsp+12776]
+  jne .L.else.main.826
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12768]
+  mov r9, qword ptr [rsp+12776]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.827
+.L.else.main.826:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12768]
+  mov r9, qword ptr [rsp+12784]
+  mov r10, qword ptr [rsp+12776]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.827:
+  mov qword ptr [rsp+12808], 0
+  mov rsi, 0
+  and rsi, 1
+  mov qword ptr [rsp+12800], rsi
+  lea rsi, [rip+.L.data.main.342]
+  mov qword ptr [rsp+12792], rsi
+  mov rsi, qword ptr [rsp+12808]
+  cmp rsi, qword ptr [rsp+12800]
+  jne .L.else.main.828
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12792]
+  mov r9, qword ptr [rsp+12800]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.829
+.L.else.main.828:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12792]
+  mov r9, qword ptr [rsp+12808]
+  mov r10, qword ptr [rsp+12800]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.829:
+  mov qword ptr [rsp+12832], 1
+  mov rsi, 3
+  and rsi, 1
+  mov qword ptr [rsp+12824], rsi
+  lea rsi, [rip+.L.data.main.343]
+  mov qword ptr [rsp+12816], rsi
+  mov rsi, qword ptr [rsp+12832]
+  cmp rsi, qword ptr [rsp+12824]
+  jne .L.else.main.830
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12816]
+  mov r9, qword ptr [rsp+12824]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.831
+.L.else.main.830:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12816]
+  mov r9, qword ptr [rsp+12832]
+  mov r10, qword ptr [rsp+12824]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.831:
+  mov qword ptr [rsp+12856], 3
+  mov rsi, 7
+  and rsi, 3
+  mov qword ptr [rsp+12848], rsi
+  lea rsi, [rip+.L.data.main.344]
+  mov qword ptr [rsp+12840], rsi
+  mov rsi, qword ptr [rsp+12856]
+  cmp rsi, qword ptr [rsp+12848]
+  jne .L.else.main.832
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12840]
+  mov r9, qword ptr [rsp+12848]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.833
+.L.else.main.832:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12840]
+  mov r9, qword ptr [rsp+12856]
+  mov r10, qword ptr [rsp+12848]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.833:
+  mov qword ptr [rsp+12880], 10
+  mov rsi, 0
+  sub rsi, 1
+  and rsi, 10
+  mov qword ptr [rsp+12872], rsi
+  lea rsi, [rip+.L.data.main.345]
+  mov qword ptr [rsp+12864], rsi
+  mov rsi, qword ptr [rsp+12880]
+  cmp rsi, qword ptr [rsp+12872]
+  jne .L.else.main.834
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12864]
+  mov r9, qword ptr [rsp+12872]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.835
+.L.else.main.834:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12864]
+  mov r9, qword ptr [rsp+12880]
+  mov r10, qword ptr [rsp+12872]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.835:
+  mov qword ptr [rsp+12904], 1
+  mov rsi, 0
+  or rsi, 1
+  mov qword ptr [rsp+12896], rsi
+  lea rsi, [rip+.L.data.main.346]
+  mov qword ptr [rsp+12888], rsi
+  mov rsi, qword ptr [rsp+12904]
+  cmp rsi, qword ptr [rsp+12896]
+  jne .L.else.main.836
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12888]
+  mov r9, qword ptr [rsp+12896]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.837
+.L.else.main.836:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12888]
+  mov r9, qword ptr [rsp+12904]
+  mov r10, qword ptr [rsp+12896]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.837:
+  mov qword ptr [rsp+12928], 19
+  mov rsi, 16
+  or rsi, 3
+  mov qword ptr [rsp+12920], rsi
+  lea rsi, [rip+.L.data.main.347]
+  mov qword ptr [rsp+12912], rsi
+  mov rsi, qword ptr [rsp+12928]
+  cmp rsi, qword ptr [rsp+12920]
+  jne .L.else.main.838
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12912]
+  mov r9, qword ptr [rsp+12920]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.839
+.L.else.main.838:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12912]
+  mov r9, qword ptr [rsp+12928]
+  mov r10, qword ptr [rsp+12920]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.839:
+  mov qword ptr [rsp+12952], 0
+  mov rsi, 0
+  xor rsi, 0
+  mov qword ptr [rsp+12944], rsi
+  lea rsi, [rip+.L.data.main.348]
+  mov qword ptr [rsp+12936], rsi
+  mov rsi, qword ptr [rsp+12952]
+  cmp rsi, qword ptr [rsp+12944]
+  jne .L.else.main.840
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12936]
+  mov r9, qword ptr [rsp+12944]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.841
+.L.else.main.840:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12936]
+  mov r9, qword ptr [rsp+12952]
+  mov r10, qword ptr [rsp+12944]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.841:
+  mov qword ptr [rsp+12976], 0
+  mov rsi, 15
+  xor rsi, 15
+  mov qword ptr [rsp+12968], rsi
+  lea rsi, [rip+.L.data.main.349]
+  mov qword ptr [rsp+12960], rsi
+  mov rsi, qword ptr [rsp+12976]
+  cmp rsi, qword ptr [rsp+12968]
+  jne .L.else.main.842
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12960]
+  mov r9, qword ptr [rsp+12968]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.843
+.L.else.main.842:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12960]
+  mov r9, qword ptr [rsp+12976]
+  mov r10, qword ptr [rsp+12968]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.843:
+  mov qword ptr [rsp+13000], 52
+  mov rsi, 56
+  xor rsi, 12
+  mov qword ptr [rsp+12992], rsi
+  lea rsi, [rip+.L.data.main.350]
+  mov qword ptr [rsp+12984], rsi
+  mov rsi, qword ptr [rsp+13000]
+  cmp rsi, qword ptr [rsp+12992]
+  jne .L.else.main.844
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+12984]
+  mov r9, qword ptr [rsp+12992]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.845
+.L.else.main.844:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+12984]
+  mov r9, qword ptr [rsp+13000]
+  mov r10, qword ptr [rsp+12992]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.845:
+  mov qword ptr [rsp+13024], 1
+  mov qword ptr [rsp+13016], 1
+  lea rsi, [rip+.L.data.main.351]
+  mov qword ptr [rsp+13008], rsi
+  mov rsi, qword ptr [rsp+13024]
+  cmp rsi, qword ptr [rsp+13016]
+  jne .L.else.main.848
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13008]
+  mov r9, qword ptr [rsp+13016]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.849
+.L.else.main.848:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13008]
+  mov r9, qword ptr [rsp+13024]
+  mov r10, qword ptr [rsp+13016]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.849:
+  mov qword ptr [rsp+13048], 1
+  mov qword ptr [rsp+13040], 1
+  lea rsi, [rip+.L.data.main.352]
+  mov qword ptr [rsp+13032], rsi
+  mov rsi, qword ptr [rsp+13048]
+  cmp rsi, qword ptr [rsp+13040]
+  jne .L.else.main.852
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13032]
+  mov r9, qword ptr [rsp+13040]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.853
+.L.else.main.852:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13032]
+  mov r9, qword ptr [rsp+13048]
+  mov r10, qword ptr [rsp+13040]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.853:
+  mov qword ptr [rsp+13072], 0
+  mov qword ptr [rsp+13064], 0
+  lea rsi, [rip+.L.data.main.353]
+  mov qword ptr [rsp+13056], rsi
+  mov rsi, qword ptr [rsp+13072]
+  cmp rsi, qword ptr [rsp+13064]
+  jne .L.else.main.856
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13056]
+  mov r9, qword ptr [rsp+13064]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.857
+.L.else.main.856:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13056]
+  mov r9, qword ptr [rsp+13072]
+  mov r10, qword ptr [rsp+13064]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.857:
+  mov qword ptr [rsp+13096], 0
+  mov rsi, 2
+  sub rsi, 2
+  cmp rsi, 0
+  jne .L.1.main.858
+  mov rsi, 0
+  jmp .L.end.main.859
+.L.1.main.858:
+  mov rsi, 1
+.L.end.main.859:
+  mov qword ptr [rsp+13088], rsi
+  lea rsi, [rip+.L.data.main.354]
+  mov qword ptr [rsp+13080], rsi
+  mov rsi, qword ptr [rsp+13096]
+  cmp rsi, qword ptr [rsp+13088]
+  jne .L.else.main.860
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13080]
+  mov r9, qword ptr [rsp+13088]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.861
+.L.else.main.860:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13080]
+  mov r9, qword ptr [rsp+13096]
+  mov r10, qword ptr [rsp+13088]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.861:
+  mov qword ptr [rsp+13120], 0
+  mov qword ptr [rsp+13112], 0
+  lea rsi, [rip+.L.data.main.355]
+  mov qword ptr [rsp+13104], rsi
+  mov rsi, qword ptr [rsp+13120]
+  cmp rsi, qword ptr [rsp+13112]
+  jne .L.else.main.864
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13104]
+  mov r9, qword ptr [rsp+13112]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.865
+.L.else.main.864:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13104]
+  mov r9, qword ptr [rsp+13120]
+  mov r10, qword ptr [rsp+13112]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.865:
+  mov qword ptr [rsp+13144], 0
+  mov rsi, 2
+  sub rsi, 2
+  cmp rsi, 0
+  je .L.0.main.866
+  mov rsi, 1
+  jmp .L.end.main.867
+.L.0.main.866:
+  mov rsi, 0
+.L.end.main.867:
+  mov qword ptr [rsp+13136], rsi
+  lea rsi, [rip+.L.data.main.356]
+  mov qword ptr [rsp+13128], rsi
+  mov rsi, qword ptr [rsp+13144]
+  cmp rsi, qword ptr [rsp+13136]
+  jne .L.else.main.868
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13128]
+  mov r9, qword ptr [rsp+13136]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.869
+.L.else.main.868:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13128]
+  mov r9, qword ptr [rsp+13144]
+  mov r10, qword ptr [rsp+13136]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.869:
+  mov qword ptr [rsp+13168], 1
+  mov qword ptr [rsp+13160], 1
+  lea rsi, [rip+.L.data.main.357]
+  mov qword ptr [rsp+13152], rsi
+  mov rsi, qword ptr [rsp+13168]
+  cmp rsi, qword ptr [rsp+13160]
+  jne .L.else.main.872
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13152]
+  mov r9, qword ptr [rsp+13160]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.873
+.L.else.main.872:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13152]
+  mov r9, qword ptr [rsp+13168]
+  mov r10, qword ptr [rsp+13160]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.873:
+  mov qword ptr [rsp+13200], 3
+  lea rsi, [rsp+2388]
+  add rsi, 0
+  mov dword ptr [rsi], 3
+  lea rsi, [rsp+2388]
+  mov qword ptr [rsp+13176], rsi
+  mov rsi, qword ptr [rsp+13176]
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  movsxd rsi, esi
+  mov qword ptr [rsp+13192], rsi
+  lea rsi, [rip+.L.data.main.358]
+  mov qword ptr [rsp+13184], rsi
+  mov rsi, qword ptr [rsp+13200]
+  cmp rsi, qword ptr [rsp+13192]
+  jne .L.else.main.874
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13184]
+  mov r9, qword ptr [rsp+13192]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.875
+.L.else.main.874:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13184]
+  mov r9, qword ptr [rsp+13200]
+  mov r10, qword ptr [rsp+13192]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.875:
+  mov rsi, 0
+  sub rsi, 56
+  mov qword ptr [rsp+13224], rsi
+  lea rsi, [rsp+2398]
+  add rsi, 0
+  mov rdi, 200
+  mov byte ptr [rsi], dil
+  lea rsi, [rsp+2398]
+  add rsi, 0
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rsp+13216], rsi
+  lea rsi, [rip+.L.data.main.359]
+  mov qword ptr [rsp+13208], rsi
+  mov rsi, qword ptr [rsp+13224]
+  cmp rsi, qword ptr [rsp+13216]
+  jne .L.else.main.876
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13208]
+  mov r9, qword ptr [rsp+13216]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.877
+.L.else.main.876:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13208]
+  mov r9, qword ptr [rsp+13224]
+  mov r10, qword ptr [rsp+13216]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.877:
+  mov qword ptr [rsp+13248], 4464
+  lea rsi, [rsp+2400]
+  add rsi, 2
+  mov rdi, 70000
+  mov word ptr [rsi], di
+  lea rsi, [rsp+2400]
+  add rsi, 2
+  movsx rsi, word ptr [rsi]
+  mov qword ptr [rsp+13240], rsi
+  lea rsi, [rip+.L.data.main.360]
+  mov qword ptr [rsp+13232], rsi
+  mov rsi, qword ptr [rsp+13248]
+  cmp rsi, qword ptr [rsp+13240]
+  jne .L.else.main.878
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13232]
+  mov r9, qword ptr [rsp+13240]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.879
+.L.else.main.878:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13232]
+  mov r9, qword ptr [rsp+13248]
+  mov r10, qword ptr [rsp+13240]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.879:
+  mov rsi, 0
+  sub rsi, 1
+  mov qword ptr [rsp+13272], rsi
+  lea rsi, [rsp+2404]
+  add rsi, 0
+  movabs rdi, 4294967295
+  mov dword ptr [rsi], edi
+  lea rsi, [rsp+2404]
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+13264], rsi
+  lea rsi, [rip+.L.data.main.361]
+  mov qword ptr [rsp+13256], rsi
+  mov rsi, qword ptr [rsp+13272]
+  cmp rsi, qword ptr [rsp+13264]
+  jne .L.else.main.880
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13256]
+  mov r9, qword ptr [rsp+13264]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.881
+.L.else.main.880:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13256]
+  mov r9, qword ptr [rsp+13272]
+  mov r10, qword ptr [rsp+13264]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.881:
+  mov rsi, 0
+  sub rsi, 55
+  mov qword ptr [rsp+13296], rsi
+  mov byte ptr [rsp+2412], 1
+  mov dword ptr [rsp+2416], 2
+  movsx rsi, byte ptr [rsp+2412]
+  add rsi, 200
+  mov byte ptr [rsp+2412], sil
+  movsx rsi, byte ptr [rsp+2412]
+  mov qword ptr [rsp+13288], rsi
+  lea rsi, [rip+.L.data.main.362]
+  mov qword ptr [rsp+13280], rsi
+  mov rsi, qword ptr [rsp+13296]
+  cmp rsi, qword ptr [rsp+13288]
+  jne .L.else.main.882
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13280]
+  mov r9, qword ptr [rsp+13288]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.883
+.L.else.main.882:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13280]
+  mov r9, qword ptr [rsp+13296]
+  mov r10, qword ptr [rsp+13288]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.883:
+  mov rsi, 0
+  sub rsi, 10
+  mov qword ptr [rsp+13320], rsi
+  lea rsi, [rsp+2420]
+  add rsi, 2
+  mov word ptr [rsi], 10
+  lea rsi, [rsp+2420]
+  add rsi, 2
+  sub word ptr [rsi], 20
+  lea rsi, [rsp+2420]
+  add rsi, 2
+  movsx rsi, word ptr [rsi]
+  mov qword ptr [rsp+13312], rsi
+  lea rsi, [rip+.L.data.main.363]
+  mov qword ptr [rsp+13304], rsi
+  mov rsi, qword ptr [rsp+13320]
+  cmp rsi, qword ptr [rsp+13312]
+  jne .L.else.main.884
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13304]
+  mov r9, qword ptr [rsp+13312]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.885
+.L.else.main.884:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13304]
+  mov r9, qword ptr [rsp+13320]
+  mov r10, qword ptr [rsp+13312]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.885:
+  mov qword ptr [rsp+13344], 40
+  mov dword ptr [rip+g1], 5
+  shl dword ptr [rip+g1], 3
+  movsxd rsi, dword ptr [rip+g1]
+  mov qword ptr [rsp+13336], rsi
+  lea rsi, [rip+.L.data.main.364]
+  mov qword ptr [rsp+13328], rsi
+  mov rsi, qword ptr [rsp+13344]
+  cmp rsi, qword ptr [rsp+13336]
+  jne .L.else.main.886
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13328]
+  mov r9, qword ptr [rsp+13336]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.887
+.L.else.main.886:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13328]
+  mov r9, qword ptr [rsp+13344]
+  mov r10, qword ptr [rsp+13336]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.887:
+  mov qword ptr [rsp+13368], 7
+  lea rsi, [rsp+2424]
+  add rsi, 0
+  mov qword ptr [rsi], 2
+  lea rsi, [rsp+2424]
+  add rsi, 8
+  mov qword ptr [rsi], 5
+  lea rsi, [rsp+2424]
+  add rsi, 0
+  lea rdi, [rsp+2424]
+  add rdi, 8
+  mov rdi, qword ptr [rdi]
+  add qword ptr [rsi], rdi
+  lea rsi, [rsp+2424]
+  add rsi, 0
+  mov rsi, qword ptr [rsi]
+  mov qword ptr [rsp+13360], rsi
+  lea rsi, [rip+.L.data.main.365]
+  mov qword ptr [rsp+13352], rsi
+  mov rsi, qword ptr [rsp+13368]
+  cmp rsi, qword ptr [rsp+13360]
+  jne .L.else.main.888
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13352]
+  mov r9, qword ptr [rsp+13360]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.889
+.L.else.main.888:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13352]
+  mov r9, qword ptr [rsp+13368]
+  mov r10, qword ptr [rsp+13360]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.889:
+  mov qword ptr [rsp+13392], 1
+  mov rsi, 0
+  sub rsi, 5
+  mov dword ptr [rsp+2444], esi
+  movsxd rsi, dword ptr [rsp+2444]
+  sar rsi, 6
+  mov rdi, 0
+  sub rdi, 1
+  cmp rsi, rdi
+  sete sil
+  movzx rsi, sil
+  mov qword ptr [rsp+13384], rsi
+  lea rsi, [rip+.L.data.main.366]
+  mov qword ptr [rsp+13376], rsi
+  mov rsi, qword ptr [rsp+13392]
+  cmp rsi, qword ptr [rsp+13384]
+  jne .L.else.main.890
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13376]
+  mov r9, qword ptr [rsp+13384]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.891
+.L.else.main.890:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13376]
+  mov r9, qword ptr [rsp+13392]
+  mov r10, qword ptr [rsp+13384]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.891:
+  mov qword ptr [rsp+13416], 4096
+  mov qword ptr [rsp+2448], 1
+  mov rsi, qword ptr [rsp+2448]
+  shl rsi, 12
+  mov qword ptr [rsp+13408], rsi
+  lea rsi, [rip+.L.data.main.367]
+  mov qword ptr [rsp+13400], rsi
+  mov rsi, qword ptr [rsp+13416]
+  cmp rsi, qword ptr [rsp+13408]
+  jne .L.else.main.892
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13400]
+  mov r9, qword ptr [rsp+13408]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.893
+.L.else.main.892:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13400]
+  mov r9, qword ptr [rsp+13416]
+  mov r10, qword ptr [rsp+13408]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.893:
+  mov qword ptr [rsp+13440], 255
+  mov rsi, 0
+  sub rsi, 1
+  mov qword ptr [rsp+2456], rsi
+  mov rsi, qword ptr [rsp+2456]
+  and rsi, 255
+  mov qword ptr [rsp+13432], rsi
+  lea rsi, [rip+.L.data.main.368]
+  mov qword ptr [rsp+13424], rsi
+  mov rsi, qword ptr [rsp+13440]
+  cmp rsi, qword ptr [rsp+13432]
+  jne .L.else.main.894
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13424]
+  mov r9, qword ptr [rsp+13432]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.895
+.L.else.main.894:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13424]
+  mov r9, qword ptr [rsp+13440]
+  mov r10, qword ptr [rsp+13432]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.895:
+  mov rsi, 0
+  sub rsi, 2
+  mov qword ptr [rsp+13464], rsi
+  mov qword ptr [rsp+2464], 7
+  mov rsi, qword ptr [rsp+2464]
+  mov rdi, 0
+  sub rdi, 7
+  xor rsi, rdi
+  mov qword ptr [rsp+13456], rsi
+  lea rsi, [rip+.L.data.main.369]
+  mov qword ptr [rsp+13448], rsi
+  mov rsi, qword ptr [rsp+13464]
+  cmp rsi, qword ptr [rsp+13456]
+  jne .L.else.main.896
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13448]
+  mov r9, qword ptr [rsp+13456]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.897
+.L.else.main.896:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13448]
+  mov r9, qword ptr [rsp+13464]
+  mov r10, qword ptr [rsp+13456]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.897:
+  movabs rsi, 4294967296
+  mov qword ptr [rsp+13488], rsi
+  mov qword ptr [rsp+2472], 1
+  mov rsi, qword ptr [rsp+2472]
+  movabs rdi, 4294967296
+  imul rsi, rdi
+  mov qword ptr [rsp+13480], rsi
+  lea rsi, [rip+.L.data.main.370]
+  mov qword ptr [rsp+13472], rsi
+  mov rsi, qword ptr [rsp+13488]
+  cmp rsi, qword ptr [rsp+13480]
+  jne .L.else.main.898
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13472]
+  mov r9, qword ptr [rsp+13480]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.899
+.L.else.main.898:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13472]
+  mov r9, qword ptr [rsp+13488]
+  mov r10, qword ptr [rsp+13480]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.899:
+  mov qword ptr [rsp+13512], 3
+  mov qword ptr [rsp+2480], 7
+  mov rsi, qword ptr [rsp+2480]
+  mov rdi, rsi
+  sar rdi, 63
+  and rdi, 1
+  add rsi, rdi
+  sar rsi, 1
+  mov qword ptr [rsp+13504], rsi
+  lea rsi, [rip+.L.data.main.371]
+  mov qword ptr [rsp+13496], rsi
+  mov rsi, qword ptr [rsp+13512]
+  cmp rsi, qword ptr [rsp+13504]
+  jne .L.else.main.900
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13496]
+  mov r9, qword ptr [rsp+13504]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.901
+.L.else.main.900:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13496]
+  mov r9, qword ptr [rsp+13512]
+  mov r10, qword ptr [rsp+13504]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.901:
+  mov qword ptr [rsp+13536], 44
+  mov byte ptr [rsp+2495], 100
+  movsx rsi, byte ptr [rsp+2495]
+  lea rsi, [rsi+rsi*2]
+  mov byte ptr [rsp+2495], sil
+  movsx rsi, byte ptr [rsp+2495]
+  mov qword ptr [rsp+13528], rsi
+  lea rsi, [rip+.L.data.main.372]
+  mov qword ptr [rsp+13520], rsi
+  mov rsi, qword ptr [rsp+13536]
+  cmp rsi, qword ptr [rsp+13528]
+  jne .L.else.main.902
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13520]
+  mov r9, qword ptr [rsp+13528]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.903
+.L.else.main.902:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13520]
+  mov r9, qword ptr [rsp+13536]
+  mov r10, qword ptr [rsp+13528]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.903:
+  mov qword ptr [rsp+13560], 1
+  lea rsi, [rsp+2496]
+  mov qword ptr [rsp+2512], rsi
+  mov rsi, qword ptr [rsp+2512]
+  add rsi, 12
+  lea rdi, [rsp+2496]
+  sub rsi, rdi
+  sar rsi, 2
+  cmp rsi, 3
+  sete sil
+  movzx rsi, sil
+  mov qword ptr [rsp+13552], rsi
+  lea rsi, [rip+.L.data.main.373]
+  mov qword ptr [rsp+13544], rsi
+  mov rsi, qword ptr [rsp+13560]
+  cmp rsi, qword ptr [rsp+13552]
+  jne .L.else.main.904
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13544]
+  mov r9, qword ptr [rsp+13552]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.905
+.L.else.main.904:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13544]
+  mov r9, qword ptr [rsp+13560]
+  mov r10, qword ptr [rsp+13552]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.905:
+  mov qword ptr [rsp+13584], 12
+  lea rsi, [rsp+2520]
+  mov qword ptr [rsp+2536], rsi
+  add qword ptr [rsp+2536], 12
+  mov rsi, qword ptr [rsp+2536]
+  lea rdi, [rsp+2520]
+  sub rsi, rdi
+  mov qword ptr [rsp+13576], rsi
+  lea rsi, [rip+.L.data.main.374]
+  mov qword ptr [rsp+13568], rsi
+  mov rsi, qword ptr [rsp+13584]
+  cmp rsi, qword ptr [rsp+13576]
+  jne .L.else.main.906
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13568]
+  mov r9, qword ptr [rsp+13576]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.907
+.L.else.main.906:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13568]
+  mov r9, qword ptr [rsp+13584]
+  mov r10, qword ptr [rsp+13576]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.907:
+  mov qword ptr [rsp+13608], 1
+  movabs rsi, 2147483648
+  mov qword ptr [rsp+2544], rsi
+  mov rsi, 2147483647
+  cmp rsi, qword ptr [rsp+2544]
+  setl sil
+  movzx rsi, sil
+  mov qword ptr [rsp+13600], rsi
+  lea rsi, [rip+.L.data.main.375]
+  mov qword ptr [rsp+13592], rsi
+  mov rsi, qword ptr [rsp+13608]
+  cmp rsi, qword ptr [rsp+13600]
+  jne .L.else.main.908
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13592]
+  mov r9, qword ptr [rsp+13600]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.909
+.L.else.main.908:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13592]
+  mov r9, qword ptr [rsp+13608]
+  mov r10, qword ptr [rsp+13600]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.909:
+  mov qword ptr [rsp+13632], 3
+  mov dword ptr [rsp+2552], 0
+  mov dword ptr [rsp+2556], 0
+  movsxd rsi, dword ptr [rsp+2556]
+  cmp rsi, 10
+  jge .L.break.main.911
+  .p2align 4,,10
+.L.begin.main.912:
+  movsxd rsi, dword ptr [rsp+2556]
+  cmp rsi, 6
+  jle .L.skip.main.915
+  movsxd rsi, dword ptr [rsp+2556]
+  cmp rsi, 8
+  jne .L.skip.main.914
+.L.skip.main.915:
+  movsxd rsi, dword ptr [rsp+2556]
+  cmp rsi, 0
+  jne .L.end.main.913
+.L.skip.main.914:
+  add dword ptr [rsp+2552], 1
+.L.end.main.913:
+  add dword ptr [rsp+2556], 1
+  movsxd rsi, dword ptr [rsp+2556]
+  cmp rsi, 10
+  jl .L.begin.main.912
+.L.break.main.911:
+  movsxd rsi, dword ptr [rsp+2552]
+  mov qword ptr [rsp+13624], rsi
+  lea rsi, [rip+.L.data.main.376]
+  mov qword ptr [rsp+13616], rsi
+  mov rsi, qword ptr [rsp+13632]
+  cmp rsi, qword ptr [rsp+13624]
+  jne .L.else.main.916
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13616]
+  mov r9, qword ptr [rsp+13624]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.917
+.L.else.main.916:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13616]
+  mov r9, qword ptr [rsp+13632]
+  mov r10, qword ptr [rsp+13624]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.917:
+  mov qword ptr [rsp+13656], 4
+  mov dword ptr [rsp+2560], 0
+  mov dword ptr [rsp+2564], 0
+  movsxd rsi, dword ptr [rsp+2564]
+  cmp rsi, 10
+  jge .L.break.main.919
+  .p2align 4,,10
+.L.begin.main.920:
+  movsxd rsi, dword ptr [rsp+2564]
+  cmp rsi, 2
+  jl .L.end.main.921
+  movsxd rsi, dword ptr [rsp+2564]
+  cmp rsi, 5
+  jl .L.skip.main.922
+  movsxd rsi, dword ptr [rsp+2564]
+  cmp rsi, 9
+  jne .L.end.main.921
+.L.skip.main.922:
+  add dword ptr [rsp+2560], 1
+.L.end.main.921:
+  add dword ptr [rsp+2564], 1
+  movsxd rsi, dword ptr [rsp+2564]
+  cmp rsi, 10
+  jl .L.begin.main.920
+.L.break.main.919:
+  movsxd rsi, dword ptr [rsp+2560]
+  mov qword ptr [rsp+13648], rsi
+  lea rsi, [rip+.L.data.main.377]
+  mov qword ptr [rsp+13640], rsi
+  mov rsi, qword ptr [rsp+13656]
+  cmp rsi, qword ptr [rsp+13648]
+  jne .L.else.main.923
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13640]
+  mov r9, qword ptr [rsp+13648]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.924
+.L.else.main.923:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13640]
+  mov r9, qword ptr [rsp+13656]
+  mov r10, qword ptr [rsp+13648]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.924:
+  mov qword ptr [rsp+13680], 2
+  mov dword ptr [rsp+2568], 0
+  mov dword ptr [rsp+2568], 2
+  movsxd rsi, dword ptr [rsp+2568]
+  mov qword ptr [rsp+13672], rsi
+  lea rsi, [rip+.L.data.main.378]
+  mov qword ptr [rsp+13664], rsi
+  mov rsi, qword ptr [rsp+13680]
+  cmp rsi, qword ptr [rsp+13672]
+  jne .L.else.main.927
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13664]
+  mov r9, qword ptr [rsp+13672]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.928
+.L.else.main.927:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13664]
+  mov r9, qword ptr [rsp+13680]
+  mov r10, qword ptr [rsp+13672]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.928:
+  mov qword ptr [rsp+13704], 1
+  mov dword ptr [rsp+2572], 0
+  mov dword ptr [rsp+2572], 1
+  movsxd rsi, dword ptr [rsp+2572]
+  mov qword ptr [rsp+13696], rsi
+  lea rsi, [rip+.L.data.main.379]
+  mov qword ptr [rsp+13688], rsi
+  mov rsi, qword ptr [rsp+13704]
+  cmp rsi, qword ptr [rsp+13696]
+  jne .L.else.main.930
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13688]
+  mov r9, qword ptr [rsp+13696]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.931
+.L.else.main.930:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13688]
+  mov r9, qword ptr [rsp+13704]
+  mov r10, qword ptr [rsp+13696]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.931:
+  mov qword ptr [rsp+13728], 5
+  mov dword ptr [rsp+2576], 0
+  movsxd rsi, dword ptr [rsp+2576]
+  cmp rsi, 100
+  jge .L.break.main.933
+  movsxd rsi, dword ptr [rsp+2576]
+  cmp rsi, 5
+  jge .L.break.main.933
+  .p2align 4,,10
+.L.begin.main.934:
+  add dword ptr [rsp+2576], 1
+  movsxd rsi, dword ptr [rsp+2576]
+  cmp rsi, 100
+  jge .L.skip.main.935
+  movsxd rsi, dword ptr [rsp+2576]
+  cmp rsi, 5
+  jl .L.begin.main.934
+.L.skip.main.935:
+.L.break.main.933:
+  movsxd rsi, dword ptr [rsp+2576]
+  mov qword ptr [rsp+13720], rsi
+  lea rsi, [rip+.L.data.main.380]
+  mov qword ptr [rsp+13712], rsi
+  mov rsi, qword ptr [rsp+13728]
+  cmp rsi, qword ptr [rsp+13720]
+  jne .L.else.main.936
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13712]
+  mov r9, qword ptr [rsp+13720]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.937
+.L.else.main.936:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13712]
+  mov r9, qword ptr [rsp+13728]
+  mov r10, qword ptr [rsp+13720]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.937:
+  mov qword ptr [rsp+13752], 10
+  mov dword ptr [rsp+2580], 0
+  .p2align 4,,10
+.L.begin.main.938:
+  add dword ptr [rsp+2580], 1
+  movsxd rsi, dword ptr [rsp+2580]
+  cmp rsi, 10
+  jne .L.begin.main.938
+  movsxd rsi, dword ptr [rsp+2580]
+  mov qword ptr [rsp+13744], rsi
+  lea rsi, [rip+.L.data.main.381]
+  mov qword ptr [rsp+13736], rsi
+  mov rsi, qword ptr [rsp+13752]
+  cmp rsi, qword ptr [rsp+13744]
+  jne .L.else.main.941
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13736]
+  mov r9, qword ptr [rsp+13744]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.942
+.L.else.main.941:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13736]
+  mov r9, qword ptr [rsp+13752]
+  mov r10, qword ptr [rsp+13744]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.942:
+  mov qword ptr [rsp+13776], 7
+  mov dword ptr [rsp+2584], 3
+  movsxd rsi, dword ptr [rsp+2584]
+  cmp rsi, 2
+  jle .L.else.main.943
+  mov rsi, 7
+  jmp .L.end.main.944
+.L.else.main.943:
+  mov rsi, 8
+.L.end.main.944:
+  mov qword ptr [rsp+13768], rsi
+  lea rsi, [rip+.L.data.main.382]
+  mov qword ptr [rsp+13760], rsi
+  mov rsi, qword ptr [rsp+13776]
+  cmp rsi, qword ptr [rsp+13768]
+  jne .L.else.main.945
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13760]
+  mov r9, qword ptr [rsp+13768]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.946
+.L.else.main.945:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13760]
+  mov r9, qword ptr [rsp+13776]
+  mov r10, qword ptr [rsp+13768]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.946:
+  mov qword ptr [rsp+13800], 8
+  mov dword ptr [rsp+2588], 2
+  movsxd rsi, dword ptr [rsp+2588]
+  cmp rsi, 2
+  jle .L.else.main.947
+  mov rsi, 7
+  jmp .L.end.main.948
+.L.else.main.947:
+  mov rsi, 8
+.L.end.main.948:
+  mov qword ptr [rsp+13792], rsi
+  lea rsi, [rip+.L.data.main.383]
+  mov qword ptr [rsp+13784], rsi
+  mov rsi, qword ptr [rsp+13800]
+  cmp rsi, qword ptr [rsp+13792]
+  jne .L.else.main.949
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13784]
+  mov r9, qword ptr [rsp+13792]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.950
+.L.else.main.949:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13784]
+  mov r9, qword ptr [rsp+13800]
+  mov r10, qword ptr [rsp+13792]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.950:
+  mov qword ptr [rsp+13824], 1
+  mov rsi, 0
+  movabs rdi, 3000000000
+  sub rsi, rdi
+  mov qword ptr [rsp+2592], rsi
+  mov rsi, qword ptr [rsp+2592]
+  mov rdi, 0
+  movabs r8, 2999999999
+  sub rdi, r8
+  cmp rsi, rdi
+  setl sil
+  movzx rsi, sil
+  mov qword ptr [rsp+13816], rsi
+  lea rsi, [rip+.L.data.main.384]
+  mov qword ptr [rsp+13808], rsi
+  mov rsi, qword ptr [rsp+13824]
+  cmp rsi, qword ptr [rsp+13816]
+  jne .L.else.main.951
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13808]
+  mov r9, qword ptr [rsp+13816]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.952
+.L.else.main.951:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13808]
+  mov r9, qword ptr [rsp+13824]
+  mov r10, qword ptr [rsp+13816]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.952:
+  mov qword ptr [rsp+13848], 42
+  mov qword ptr [rsp+2600], 14
+  mov rsi, qword ptr [rsp+2600]
+  lea rsi, [rsi+rsi*2]
+  mov qword ptr [rsp+13840], rsi
+  lea rsi, [rip+.L.data.main.385]
+  mov qword ptr [rsp+13832], rsi
+  mov rsi, qword ptr [rsp+13848]
+  cmp rsi, qword ptr [rsp+13840]
+  jne .L.else.main.953
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13832]
+  mov r9, qword ptr [rsp+13840]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.954
+.L.else.main.953:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13832]
+  mov r9, qword ptr [rsp+13848]
+  mov r10, qword ptr [rsp+13840]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.954:
+  mov rsi, 0
+  sub rsi, 35
+  mov qword ptr [rsp+13872], rsi
+  mov rsi, 0
+  sub rsi, 7
+  mov qword ptr [rsp+2608], rsi
+  mov rsi, qword ptr [rsp+2608]
+  lea rsi, [rsi+rsi*4]
+  mov qword ptr [rsp+13864], rsi
+  lea rsi, [rip+.L.data.main.386]
+  mov qword ptr [rsp+13856], rsi
+  mov rsi, qword ptr [rsp+13872]
+  cmp rsi, qword ptr [rsp+13864]
+  jne .L.else.main.955
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13856]
+  mov r9, qword ptr [rsp+13864]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.956
+.L.else.main.955:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13856]
+  mov r9, qword ptr [rsp+13872]
+  mov r10, qword ptr [rsp+13864]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.956:
+  mov qword ptr [rsp+13896], 81
+  mov qword ptr [rsp+2616], 9
+  mov rsi, qword ptr [rsp+2616]
+  lea rsi, [rsi+rsi*8]
+  mov qword ptr [rsp+13888], rsi
+  lea rsi, [rip+.L.data.main.387]
+  mov qword ptr [rsp+13880], rsi
+  mov rsi, qword ptr [rsp+13896]
+  cmp rsi, qword ptr [rsp+13888]
+  jne .L.else.main.957
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13880]
+  mov r9, qword ptr [rsp+13888]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.958
+.L.else.main.957:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13880]
+  mov r9, qword ptr [rsp+13896]
+  mov r10, qword ptr [rsp+13888]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.958:
+  mov qword ptr [rsp+13920], 120
+  mov qword ptr [rsp+2624], 10
+  mov rsi, qword ptr [rsp+2624]
+  lea rsi, [rsi+rsi*2]
+  shl rsi, 2
+  mov qword ptr [rsp+13912], rsi
+  lea rsi, [rip+.L.data.main.388]
+  mov qword ptr [rsp+13904], rsi
+  mov rsi, qword ptr [rsp+13920]
+  cmp rsi, qword ptr [rsp+13912]
+  jne .L.else.main.959
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13904]
+  mov r9, qword ptr [rsp+13912]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.960
+.L.else.main.959:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13904]
+  mov r9, qword ptr [rsp+13920]
+  mov r10, qword ptr [rsp+13912]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.960:
+  mov rsi, 0
+  sub rsi, 280
+  mov qword ptr [rsp+13944], rsi
+  mov rsi, 0
+  sub rsi, 7
+  mov qword ptr [rsp+2632], rsi
+  mov rsi, qword ptr [rsp+2632]
+  lea rsi, [rsi+rsi*4]
+  shl rsi, 3
+  mov qword ptr [rsp+13936], rsi
+  lea rsi, [rip+.L.data.main.389]
+  mov qword ptr [rsp+13928], rsi
+  mov rsi, qword ptr [rsp+13944]
+  cmp rsi, qword ptr [rsp+13936]
+  jne .L.else.main.961
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13928]
+  mov r9, qword ptr [rsp+13936]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.962
+.L.else.main.961:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13928]
+  mov r9, qword ptr [rsp+13944]
+  mov r10, qword ptr [rsp+13936]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.962:
+  mov rsi, 0
+  sub rsi, 21
+  mov qword ptr [rsp+13968], rsi
+  mov qword ptr [rsp+2640], 7
+  mov rsi, qword ptr [rsp+2640]
+  mov rdi, 0
+  sub rdi, 3
+  imul rsi, rdi
+  mov qword ptr [rsp+13960], rsi
+  lea rsi, [rip+.L.data.main.390]
+  mov qword ptr [rsp+13952], rsi
+  mov rsi, qword ptr [rsp+13968]
+  cmp rsi, qword ptr [rsp+13960]
+  jne .L.else.main.963
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13952]
+  mov r9, qword ptr [rsp+13960]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.964
+.L.else.main.963:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13952]
+  mov r9, qword ptr [rsp+13968]
+  mov r10, qword ptr [rsp+13960]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.964:
+  mov qword ptr [rsp+13992], 49
+  mov qword ptr [rsp+2648], 7
+  mov rsi, qword ptr [rsp+2648]
+  imul rsi, 7
+  mov qword ptr [rsp+2648], rsi
+  mov rsi, qword ptr [rsp+2648]
+  mov qword ptr [rsp+13984], rsi
+  lea rsi, [rip+.L.data.main.391]
+  mov qword ptr [rsp+13976], rsi
+  mov rsi, qword ptr [rsp+13992]
+  cmp rsi, qword ptr [rsp+13984]
+  jne .L.else.main.965
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+13976]
+  mov r9, qword ptr [rsp+13984]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.966
+.L.else.main.965:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+13976]
+  mov r9, qword ptr [rsp+13992]
+  mov r10, qword ptr [rsp+13984]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.966:
+  mov qword ptr [rsp+14016], 5
+  lea rsi, [rsp+2656]
+  add rsi, 56
+  lea rdi, [rsp+2656]
+  add rdi, 16
+  sub rsi, rdi
+  sar rsi, 3
+  mov qword ptr [rsp+14008], rsi
+  lea rsi, [rip+.L.data.main.392]
+  mov qword ptr [rsp+14000], rsi
+  mov rsi, qword ptr [rsp+14016]
+  cmp rsi, qword ptr [rsp+14008]
+  jne .L.else.main.967
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14000]
+  mov r9, qword ptr [rsp+14008]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.968
+.L.else.main.967:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14000]
+  mov r9, qword ptr [rsp+14016]
+  mov r10, qword ptr [rsp+14008]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.968:
+  mov qword ptr [rsp+14040], 3
+  lea rsi, [rsp+2741]
+  add rsi, 12
+  lea rdi, [rsp+2741]
+  add rdi, 3
+  sub rsi, rdi
+  movabs rax, -6148914691236517205
+  imul rsi
+  add rdx, rsi
+  sar rdx, 1
+  sar rsi, 63
+  sub rdx, rsi
+  mov qword ptr [rsp+14032], rdx
+  lea rsi, [rip+.L.data.main.393]
+  mov qword ptr [rsp+14024], rsi
+  mov rsi, qword ptr [rsp+14040]
+  cmp rsi, qword ptr [rsp+14032]
+  jne .L.else.main.969
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14024]
+  mov r9, qword ptr [rsp+14032]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.970
+.L.else.main.969:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14024]
+  mov r9, qword ptr [rsp+14040]
+  mov r10, qword ptr [rsp+14032]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.970:
+  mov qword ptr [rsp+14064], 174
+  mov r15, 0
+  cmp r15, 3
+  jge .L.break.main.972
+  .p2align 4,,10
+.L.begin.main.973:
+  mov r14, 0
+  cmp r14, 10
+  jge .L.break.main.975
+  lea rsi, [r15+r15*4]
+  .p2align 4,,10
+.L.begin.main.976:
+  lea rdi, [rsp+2756]
+  lea rdi, [rdi+rsi*8]
+  lea rdi, [rdi+r14*4]
+  mov r8, r15
+  imul r8, r14
+  mov dword ptr [rdi], r8d
+  mov rdi, r14
+  add rdi, 1
+  movsxd rdi, edi
+  mov r14, rdi
+  cmp r14, 10
+  jl .L.begin.main.976
+.L.break.main.975:
+  mov rsi, r15
+  add rsi, 1
+  movsxd rsi, esi
+  mov r15, rsi
+  cmp r15, 3
+  jl .L.begin.main.973
+.L.break.main.972:
+  mov dword ptr [rsp+2876], 0
+  mov r13, 0
+  cmp r13, 3
+  jge .L.break.main.978
+  .p2align 4,,10
+.L.begin.main.979:
+  mov r12, 0
+  cmp r12, 10
+  jge .L.break.main.981
+  lea rsi, [rsp+2756]
+  lea rdi, [r13+r13*4]
+  lea rsi, [rsi+rdi*8]
+  lea rdi, [rsp+2756]
+  mov r8, 2
+  sub r8, r13
+  lea r8, [r8+r8*4]
+  lea rdi, [rdi+r8*8]
+  .p2align 4,,10
+.L.begin.main.982:
+  movsxd r8, dword ptr [rsi+r12*4]
+  movsxd r9, dword ptr [rdi+r12*4]
+  movabs rax, -6148914691236517205
+  imul r9
+  add rdx, r9
+  sar rdx, 1
+  sar r9, 63
+  sub rdx, r9
+  add r8, rdx
+  add dword ptr [rsp+2876], r8d
+  mov r8, r12
+  add r8, 1
+  movsxd r8, r8d
+  mov r12, r8
+  cmp r12, 10
+  jl .L.begin.main.982
+.L.break.main.981:
+  mov rsi, r13
+  add rsi, 1
+  movsxd rsi, esi
+  mov r13, rsi
+  cmp r13, 3
+  jl .L.begin.main.979
+.L.break.main.978:
+  movsxd rsi, dword ptr [rsp+2876]
+  mov qword ptr [rsp+14056], rsi
+  lea rsi, [rip+.L.data.main.394]
+  mov qword ptr [rsp+14048], rsi
+  mov rsi, qword ptr [rsp+14064]
+  cmp rsi, qword ptr [rsp+14056]
+  jne .L.else.main.983
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14048]
+  mov r9, qword ptr [rsp+14056]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.984
+.L.else.main.983:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14048]
+  mov r9, qword ptr [rsp+14064]
+  mov r10, qword ptr [rsp+14056]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.984:
+  mov qword ptr [rsp+14088], 7
+  lea rsi, [rsp+2880]
+  mov qword ptr [rsp+2920], rsi
+  mov dword ptr [rsp+2932], 3
+  mov rsi, qword ptr [rsp+2920]
+  movsxd rdi, dword ptr [rsp+2932]
+  mov qword ptr [rsi+rdi*8], 7
+  lea rsi, [rsp+2880]
+  add rsi, 24
+  mov rsi, qword ptr [rsi]
+  mov qword ptr [rsp+14080], rsi
+  lea rsi, [rip+.L.data.main.395]
+  mov qword ptr [rsp+14072], rsi
+  mov rsi, qword ptr [rsp+14088]
+  cmp rsi, qword ptr [rsp+14080]
+  jne .L.else.main.985
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14072]
+  mov r9, qword ptr [rsp+14080]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.986
+.L.else.main.985:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14072]
+  mov r9, qword ptr [rsp+14088]
+  mov r10, qword ptr [rsp+14080]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.986:
+  mov rsi, 0
+  sub rsi, 3
+  mov qword ptr [rsp+14112], rsi
+  mov rsi, 0
+  sub rsi, 7
+  mov qword ptr [rsp+2936], rsi
+  mov rsi, qword ptr [rsp+2936]
+  mov rdi, rsi
+  sar rdi, 63
+  and rdi, 1
+  add rsi, rdi
+  sar rsi, 1
+  mov qword ptr [rsp+14104], rsi
+  lea rsi, [rip+.L.data.main.396]
+  mov qword ptr [rsp+14096], rsi
+  mov rsi, qword ptr [rsp+14112]
+  cmp rsi, qword ptr [rsp+14104]
+  jne .L.else.main.987
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14096]
+  mov r9, qword ptr [rsp+14104]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.988
+.L.else.main.987:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14096]
+  mov r9, qword ptr [rsp+14112]
+  mov r10, qword ptr [rsp+14104]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.988:
+  mov qword ptr [rsp+14136], 0
+  mov rsi, 0
+  sub rsi, 7
+  mov qword ptr [rsp+2944], rsi
+  mov rsi, qword ptr [rsp+2944]
+  mov rdi, rsi
+  sar rdi, 63
+  and rdi, 7
+  add rsi, rdi
+  sar rsi, 3
+  mov qword ptr [rsp+14128], rsi
+  lea rsi, [rip+.L.data.main.397]
+  mov qword ptr [rsp+14120], rsi
+  mov rsi, qword ptr [rsp+14136]
+  cmp rsi, qword ptr [rsp+14128]
+  jne .L.else.main.989
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14120]
+  mov r9, qword ptr [rsp+14128]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.990
+.L.else.main.989:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14120]
+  mov r9, qword ptr [rsp+14136]
+  mov r10, qword ptr [rsp+14128]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.990:
+  mov rsi, 0
+  sub rsi, 2
+  mov qword ptr [rsp+14160], rsi
+  mov rsi, 0
+  sub rsi, 7
+  mov qword ptr [rsp+2952], rsi
+  mov rsi, qword ptr [rsp+2952]
+  movabs rax, -6148914691236517205
+  imul rsi
+  add rdx, rsi
+  sar rdx, 1
+  sar rsi, 63
+  sub rdx, rsi
+  mov qword ptr [rsp+14152], rdx
+  lea rsi, [rip+.L.data.main.398]
+  mov qword ptr [rsp+14144], rsi
+  mov rsi, qword ptr [rsp+14160]
+  cmp rsi, qword ptr [rsp+14152]
+  jne .L.else.main.991
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14144]
+  mov r9, qword ptr [rsp+14152]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.992
+.L.else.main.991:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14144]
+  mov r9, qword ptr [rsp+14160]
+  mov r10, qword ptr [rsp+14152]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.992:
+  mov qword ptr [rsp+14184], 10
+  mov qword ptr [rsp+2960], 100
+  mov rsi, qword ptr [rsp+2960]
+  movabs rax, -3689348814741910323
+  imul rsi
+  add rdx, rsi
+  sar rdx, 3
+  sar rsi, 63
+  sub rdx, rsi
+  mov qword ptr [rsp+14176], rdx
+  lea rsi, [rip+.L.data.main.399]
+  mov qword ptr [rsp+14168], rsi
+  mov rsi, qword ptr [rsp+14184]
+  cmp rsi, qword ptr [rsp+14176]
+  jne .L.else.main.993
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14168]
+  mov r9, qword ptr [rsp+14176]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.994
+.L.else.main.993:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14168]
+  mov r9, qword ptr [rsp+14184]
+  mov r10, qword ptr [rsp+14176]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.994:
+  mov rsi, 0
+  sub rsi, 14
+  mov qword ptr [rsp+14208], rsi
+  mov rsi, 0
+  sub rsi, 100
+  mov dword ptr [rsp+2972], esi
+  movsxd rsi, dword ptr [rsp+2972]
+  movabs rax, -7905747460161236406
+  imul rsi
+  add rdx, rsi
+  sar rdx, 2
+  sar rsi, 63
+  sub rdx, rsi
+  mov qword ptr [rsp+14200], rdx
+  lea rsi, [rip+.L.data.main.400]
+  mov qword ptr [rsp+14192], rsi
+  mov rsi, qword ptr [rsp+14208]
+  cmp rsi, qword ptr [rsp+14200]
+  jne .L.else.main.995
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14192]
+  mov r9, qword ptr [rsp+14200]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.996
+.L.else.main.995:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14192]
+  mov r9, qword ptr [rsp+14208]
+  mov r10, qword ptr [rsp+14200]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.996:
+  movabs rsi, 123456789012
+  mov qword ptr [rsp+14232], rsi
+  movabs rsi, 123456789012345
+  mov qword ptr [rsp+2976], rsi
+  mov rsi, qword ptr [rsp+2976]
+  movabs rax, -9002011107970261188
+  imul rsi
+  add rdx, rsi
+  sar rdx, 9
+  sar rsi, 63
+  sub rdx, rsi
+  mov qword ptr [rsp+14224], rdx
+  lea rsi, [rip+.L.data.main.401]
+  mov qword ptr [rsp+14216], rsi
+  mov rsi, qword ptr [rsp+14232]
+  cmp rsi, qword ptr [rsp+14224]
+  jne .L.else.main.997
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14216]
+  mov r9, qword ptr [rsp+14224]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.998
+.L.else.main.997:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14216]
+  mov r9, qword ptr [rsp+14232]
+  mov r10, qword ptr [rsp+14224]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.998:
+  mov rsi, 0
+  movabs rdi, 192600294871
+  sub rsi, rdi
+  mov qword ptr [rsp+14256], rsi
+  mov rsi, 0
+  movabs rdi, 123456789012345
+  sub rsi, rdi
+  mov qword ptr [rsp+2984], rsi
+  mov rsi, qword ptr [rsp+2984]
+  movabs rax, -3712371272244199935
+  imul rsi
+  add rdx, rsi
+  sar rdx, 9
+  sar rsi, 63
+  sub rdx, rsi
+  mov qword ptr [rsp+14248], rdx
+  lea rsi, [rip+.L.data.main.402]
+  mov qword ptr [rsp+14240], rsi
+  mov rsi, qword ptr [rsp+14256]
+  cmp rsi, qword ptr [rsp+14248]
+  jne .L.else.main.999
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14240]
+  mov r9, qword ptr [rsp+14248]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1000
+.L.else.main.999:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14240]
+  mov r9, qword ptr [rsp+14256]
+  mov r10, qword ptr [rsp+14248]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1000:
+  mov qword ptr [rsp+14280], 1
+  mov dword ptr [rsp+2992], 2147483647
+  movsxd rsi, dword ptr [rsp+2992]
+  movabs rax, -9223372032559808509
+  imul rsi
+  add rdx, rsi
+  sar rdx, 30
+  sar rsi, 63
+  sub rdx, rsi
+  mov qword ptr [rsp+14272], rdx
+  lea rsi, [rip+.L.data.main.403]
+  mov qword ptr [rsp+14264], rsi
+  mov rsi, qword ptr [rsp+14280]
+  cmp rsi, qword ptr [rsp+14272]
+  jne .L.else.main.1001
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14264]
+  mov r9, qword ptr [rsp+14272]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1002
+.L.else.main.1001:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14264]
+  mov r9, qword ptr [rsp+14280]
+  mov r10, qword ptr [rsp+14272]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1002:
+  mov qword ptr [rsp+14304], 1234
+  mov dword ptr [rsp+2996], 12345
+  movsxd rsi, dword ptr [rsp+2996]
+  movabs rax, -3689348814741910323
+  imul rsi
+  add rdx, rsi
+  sar rdx, 3
+  sar rsi, 63
+  sub rdx, rsi
+  mov dword ptr [rsp+2996], edx
+  movsxd rsi, dword ptr [rsp+2996]
+  mov qword ptr [rsp+14296], rsi
+  lea rsi, [rip+.L.data.main.404]
+  mov qword ptr [rsp+14288], rsi
+  mov rsi, qword ptr [rsp+14304]
+  cmp rsi, qword ptr [rsp+14296]
+  jne .L.else.main.1003
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14288]
+  mov r9, qword ptr [rsp+14296]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1004
+.L.else.main.1003:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14288]
+  mov r9, qword ptr [rsp+14304]
+  mov r10, qword ptr [rsp+14296]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1004:
+  mov rsi, 0
+  sub rsi, 7
+  mov qword ptr [rsp+14328], rsi
+  mov rsi, 0
+  sub rsi, 7
+  mov qword ptr [rsp+3000], rsi
+  mov rsi, qword ptr [rsp+3000]
+  mov qword ptr [rsp+14320], rsi
+  lea rsi, [rip+.L.data.main.405]
+  mov qword ptr [rsp+14312], rsi
+  mov rsi, qword ptr [rsp+14328]
+  cmp rsi, qword ptr [rsp+14320]
+  jne .L.else.main.1005
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14312]
+  mov r9, qword ptr [rsp+14320]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1006
+.L.else.main.1005:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14312]
+  mov r9, qword ptr [rsp+14328]
+  mov r10, qword ptr [rsp+14320]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1006:
+  mov qword ptr [rsp+14352], 7
+  lea rsi, [rsp+3012]
+  add rsi, 96
+  lea rdi, [rsp+3012]
+  add rdi, 12
+  sub rsi, rdi
+  movabs rax, -6148914691236517205
+  imul rsi
+  add rdx, rsi
+  sar rdx, 3
+  sar rsi, 63
+  sub rdx, rsi
+  mov qword ptr [rsp+14344], rdx
+  lea rsi, [rip+.L.data.main.406]
+  mov qword ptr [rsp+14336], rsi
+  mov rsi, qword ptr [rsp+14352]
+  cmp rsi, qword ptr [rsp+14344]
+  jne .L.else.main.1007
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14336]
+  mov r9, qword ptr [rsp+14344]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1008
+.L.else.main.1007:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14336]
+  mov r9, qword ptr [rsp+14352]
+  mov r10, qword ptr [rsp+14344]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1008:
+  mov qword ptr [rsp+14376], 8
+  mov qword ptr [rsp+14368], 8
+  lea rsi, [rip+.L.data.main.407]
+  mov qword ptr [rsp+14360], rsi
+  mov rsi, qword ptr [rsp+14376]
+  cmp rsi, qword ptr [rsp+14368]
+  jne .L.else.main.1009
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14360]
+  mov r9, qword ptr [rsp+14368]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1010
+.L.else.main.1009:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14360]
+  mov r9, qword ptr [rsp+14376]
+  mov r10, qword ptr [rsp+14368]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1010:
+  mov qword ptr [rsp+14400], 4
+  mov qword ptr [rsp+14392], 4
+  lea rsi, [rip+.L.data.main.408]
+  mov qword ptr [rsp+14384], rsi
+  mov rsi, qword ptr [rsp+14400]
+  cmp rsi, qword ptr [rsp+14392]
+  jne .L.else.main.1011
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14384]
+  mov r9, qword ptr [rsp+14392]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1012
+.L.else.main.1011:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14384]
+  mov r9, qword ptr [rsp+14400]
+  mov r10, qword ptr [rsp+14392]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1012:
+  mov qword ptr [rsp+14424], 1
+  mov dword ptr [rsp+3160], 1
+  lea rsi, [rsp+3152]
+  mov qword ptr [rsp+3136], rsi
+  mov rsi, qword ptr [rsp+3136]
+  movsxd rsi, dword ptr [rsi+8]
+  mov qword ptr [rsp+14416], rsi
+  lea rsi, [rip+.L.data.main.409]
+  mov qword ptr [rsp+14408], rsi
+  mov rsi, qword ptr [rsp+14424]
+  cmp rsi, qword ptr [rsp+14416]
+  jne .L.else.main.1013
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14408]
+  mov r9, qword ptr [rsp+14416]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1014
+.L.else.main.1013:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14408]
+  mov r9, qword ptr [rsp+14424]
+  mov r10, qword ptr [rsp+14416]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1014:
+  mov qword ptr [rsp+14448], 3
+  mov dword ptr [rsp+3168], 0
+  movsxd rsi, dword ptr [rsp+3168]
+  cmp rsi, 10
+  jge .L.break.main.1016
+  .p2align 4,,10
+.L.begin.main.1017:
+  movsxd rsi, dword ptr [rsp+3168]
+  cmp rsi, 3
+  je .L.break.main.1016
+  add dword ptr [rsp+3168], 1
+  movsxd rsi, dword ptr [rsp+3168]
+  cmp rsi, 10
+  jl .L.begin.main.1017
+.L.break.main.1016:
+  movsxd rsi, dword ptr [rsp+3168]
+  mov qword ptr [rsp+14440], rsi
+  lea rsi, [rip+.L.data.main.410]
+  mov qword ptr [rsp+14432], rsi
+  mov rsi, qword ptr [rsp+14448]
+  cmp rsi, qword ptr [rsp+14440]
+  jne .L.else.main.1019
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14432]
+  mov r9, qword ptr [rsp+14440]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1020
+.L.else.main.1019:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14432]
+  mov r9, qword ptr [rsp+14448]
+  mov r10, qword ptr [rsp+14440]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1020:
+  mov qword ptr [rsp+14472], 4
+  mov dword ptr [rsp+3172], 0
+  .p2align 4,,10
+.L.begin.main.1023:
+  movsxd rsi, dword ptr [rsp+3172]
+  add rsi, 1
+  mov dword ptr [rsp+3172], esi
+  sub rsi, 1
+  cmp rsi, 3
+  jne .L.begin.main.1023
+  movsxd rsi, dword ptr [rsp+3172]
+  mov qword ptr [rsp+14464], rsi
+  lea rsi, [rip+.L.data.main.411]
+  mov qword ptr [rsp+14456], rsi
+  mov rsi, qword ptr [rsp+14472]
+  cmp rsi, qword ptr [rsp+14464]
+  jne .L.else.main.1025
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14456]
+  mov r9, qword ptr [rsp+14464]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1026
+.L.else.main.1025:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14456]
+  mov r9, qword ptr [rsp+14472]
+  mov r10, qword ptr [rsp+14464]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1026:
+  mov qword ptr [rsp+14496], 3
+  mov dword ptr [rsp+3176], 0
+  movsxd rsi, dword ptr [rsp+3176]
+  cmp rsi, 10
+  jge .L.break.main.1028
+  .p2align 4,,10
+.L.break.main.1031:
+  movsxd rsi, dword ptr [rsp+3176]
+  cmp rsi, 3
+  je .L.break.main.1028
+  add dword ptr [rsp+3176], 1
+  movsxd rsi, dword ptr [rsp+3176]
+  cmp rsi, 10
+  jl .L.break.main.1031
+.L.break.main.1028:
+  movsxd rsi, dword ptr [rsp+3176]
+  mov qword ptr [rsp+14488], rsi
+  lea rsi, [rip+.L.data.main.412]
+  mov qword ptr [rsp+14480], rsi
+  mov rsi, qword ptr [rsp+14496]
+  cmp rsi, qword ptr [rsp+14488]
+  jne .L.else.main.1034
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14480]
+  mov r9, qword ptr [rsp+14488]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1035
+.L.else.main.1034:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14480]
+  mov r9, qword ptr [rsp+14496]
+  mov r10, qword ptr [rsp+14488]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1035:
+  mov qword ptr [rsp+14520], 4
+  mov dword ptr [rsp+3180], 0
+  .p2align 4,,10
+.L.break.main.1040:
+  movsxd rsi, dword ptr [rsp+3180]
+  add rsi, 1
+  mov dword ptr [rsp+3180], esi
+  sub rsi, 1
+  cmp rsi, 3
+  jne .L.break.main.1040
+  movsxd rsi, dword ptr [rsp+3180]
+  mov qword ptr [rsp+14512], rsi
+  lea rsi, [rip+.L.data.main.413]
+  mov qword ptr [rsp+14504], rsi
+  mov rsi, qword ptr [rsp+14520]
+  cmp rsi, qword ptr [rsp+14512]
+  jne .L.else.main.1043
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14504]
+  mov r9, qword ptr [rsp+14512]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1044
+.L.else.main.1043:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14504]
+  mov r9, qword ptr [rsp+14520]
+  mov r10, qword ptr [rsp+14512]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1044:
+  mov qword ptr [rsp+14544], 10
+  mov dword ptr [rsp+3184], 0
+  mov dword ptr [rsp+3188], 0
+  movsxd rsi, dword ptr [rsp+3184]
+  cmp rsi, 10
+  jge .L.break.main.1046
+  .p2align 4,,10
+.L.begin.main.1047:
+  movsxd rsi, dword ptr [rsp+3184]
+  cmp rsi, 5
+  jg .L.continue.main.1045
+  add dword ptr [rsp+3188], 1
+.L.continue.main.1045:
+  add dword ptr [rsp+3184], 1
+  movsxd rsi, dword ptr [rsp+3184]
+  cmp rsi, 10
+  jl .L.begin.main.1047
+.L.break.main.1046:
+  movsxd rsi, dword ptr [rsp+3184]
+  mov qword ptr [rsp+14536], rsi
+  lea rsi, [rip+.L.data.main.414]
+  mov qword ptr [rsp+14528], rsi
+  mov rsi, qword ptr [rsp+14544]
+  cmp rsi, qword ptr [rsp+14536]
+  jne .L.else.main.1049
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14528]
+  mov r9, qword ptr [rsp+14536]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1050
+.L.else.main.1049:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14528]
+  mov r9, qword ptr [rsp+14544]
+  mov r10, qword ptr [rsp+14536]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1050:
+  mov qword ptr [rsp+14568], 6
+  mov dword ptr [rsp+3192], 0
+  mov dword ptr [rsp+3196], 0
+  movsxd rsi, dword ptr [rsp+3192]
+  cmp rsi, 10
+  jge .L.break.main.1052
+  .p2align 4,,10
+.L.begin.main.1053:
+  movsxd rsi, dword ptr [rsp+3192]
+  cmp rsi, 5
+  jg .L.continue.main.1051
+  add dword ptr [rsp+3196], 1
+.L.continue.main.1051:
+  add dword ptr [rsp+3192], 1
+  movsxd rsi, dword ptr [rsp+3192]
+  cmp rsi, 10
+  jl .L.begin.main.1053
+.L.break.main.1052:
+  movsxd rsi, dword ptr [rsp+3196]
+  mov qword ptr [rsp+14560], rsi
+  lea rsi, [rip+.L.data.main.415]
+  mov qword ptr [rsp+14552], rsi
+  mov rsi, qword ptr [rsp+14568]
+  cmp rsi, qword ptr [rsp+14560]
+  jne .L.else.main.1055
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14552]
+  mov r9, qword ptr [rsp+14560]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1056
+.L.else.main.1055:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14552]
+  mov r9, qword ptr [rsp+14568]
+  mov r10, qword ptr [rsp+14560]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1056:
+  mov qword ptr [rsp+14592], 10
+  mov dword ptr [rsp+3200], 0
+  mov rbx, 0
+  movsxd rsi, dword ptr [rsp+3200]
+  cmp rsi, 0
+  jne .L.break.main.1058
+  cmp rbx, 10
+  je .L.break.main.1058
+  .p2align 4,,10
+.L.continue.main.1060:
+  mov rsi, rbx
+  add rsi, 1
+  movsxd rsi, esi
+  mov rbx, rsi
+  cmp rbx, 10
+  jne .L.continue.main.1060
+.L.break.main.1058:
+  mov qword ptr [rsp+14584], rbx
+  lea rsi, [rip+.L.data.main.416]
+  mov qword ptr [rsp+14576], rsi
+  mov rsi, qword ptr [rsp+14592]
+  cmp rsi, qword ptr [rsp+14584]
+  jne .L.else.main.1063
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14576]
+  mov r9, qword ptr [rsp+14584]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1064
+.L.else.main.1063:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14576]
+  mov r9, qword ptr [rsp+14592]
+  mov r10, qword ptr [rsp+14584]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1064:
+  mov qword ptr [rsp+14616], 11
+  mov dword ptr [rsp+3204], 0
+  mov dword ptr [rsp+3208], 0
+  movsxd rsi, dword ptr [rsp+3204]
+  add rsi, 1
+  mov dword ptr [rsp+3204], esi
+  sub rsi, 1
+  cmp rsi, 10
+  jge .L.break.main.1066
+  .p2align 4,,10
+.L.begin.main.1067:
+  movsxd rsi, dword ptr [rsp+3204]
+  cmp rsi, 5
+  jg .L.continue.main.1065
+  add dword ptr [rsp+3208], 1
+.L.continue.main.1065:
+  movsxd rsi, dword ptr [rsp+3204]
+  add rsi, 1
+  mov dword ptr [rsp+3204], esi
+  sub rsi, 1
+  cmp rsi, 10
+  jl .L.begin.main.1067
+.L.break.main.1066:
+  movsxd rsi, dword ptr [rsp+3204]
+  mov qword ptr [rsp+14608], rsi
+  lea rsi, [rip+.L.data.main.417]
+  mov qword ptr [rsp+14600], rsi
+  mov rsi, qword ptr [rsp+14616]
+  cmp rsi, qword ptr [rsp+14608]
+  jne .L.else.main.1069
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14600]
+  mov r9, qword ptr [rsp+14608]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1070
+.L.else.main.1069:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14600]
+  mov r9, qword ptr [rsp+14616]
+  mov r10, qword ptr [rsp+14608]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1070:
+  mov qword ptr [rsp+14640], 5
+  mov dword ptr [rsp+3212], 0
+  mov dword ptr [rsp+3216], 0
+  movsxd rsi, dword ptr [rsp+3212]
+  add rsi, 1
+  mov dword ptr [rsp+3212], esi
+  sub rsi, 1
+  cmp rsi, 10
+  jge .L.break.main.1072
+  .p2align 4,,10
+.L.begin.main.1073:
+  movsxd rsi, dword ptr [rsp+3212]
+  cmp rsi, 5
+  jg .L.continue.main.1071
+  add dword ptr [rsp+3216], 1
+.L.continue.main.1071:
+  movsxd rsi, dword ptr [rsp+3212]
+  add rsi, 1
+  mov dword ptr [rsp+3212], esi
+  sub rsi, 1
+  cmp rsi, 10
+  jl .L.begin.main.1073
+.L.break.main.1072:
+  movsxd rsi, dword ptr [rsp+3216]
+  mov qword ptr [rsp+14632], rsi
+  lea rsi, [rip+.L.data.main.418]
+  mov qword ptr [rsp+14624], rsi
+  mov rsi, qword ptr [rsp+14640]
+  cmp rsi, qword ptr [rsp+14632]
+  jne .L.else.main.1075
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14624]
+  mov r9, qword ptr [rsp+14632]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1076
+.L.else.main.1075:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14624]
+  mov r9, qword ptr [rsp+14640]
+  mov r10, qword ptr [rsp+14632]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1076:
+  mov qword ptr [rsp+14664], 11
+  mov dword ptr [rsp+3220], 0
+  mov dword ptr [rsp+3224], 0
+  movsxd rsi, dword ptr [rsp+3220]
+  cmp rsi, 0
+  jne .L.break.main.1078
+  movsxd rsi, dword ptr [rsp+3224]
+  add rsi, 1
+  mov dword ptr [rsp+3224], esi
+  sub rsi, 1
+  cmp rsi, 10
+  je .L.break.main.1078
+  .p2align 4,,10
+.L.continue.main.1080:
+  movsxd rsi, dword ptr [rsp+3224]
+  add rsi, 1
+  mov dword ptr [rsp+3224], esi
+  sub rsi, 1
+  cmp rsi, 10
+  jne .L.continue.main.1080
+.L.break.main.1078:
+  movsxd rsi, dword ptr [rsp+3224]
+  mov qword ptr [rsp+14656], rsi
+  lea rsi, [rip+.L.data.main.419]
+  mov qword ptr [rsp+14648], rsi
+  mov rsi, qword ptr [rsp+14664]
+  cmp rsi, qword ptr [rsp+14656]
+  jne .L.else.main.1083
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14648]
+  mov r9, qword ptr [rsp+14656]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1084
+.L.else.main.1083:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14648]
+  mov r9, qword ptr [rsp+14664]
+  mov r10, qword ptr [rsp+14656]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1084:
+  mov qword ptr [rsp+14688], 0
+  mov dword ptr [rsp+3228], 0
+  movsxd rsi, dword ptr [rsp+3228]
+  cmp rsi, 0
+  jle .L.break.main.1086
+  .p2align 4,,10
+.L.begin.main.1087:
+  add dword ptr [rsp+3228], 1
+  movsxd rsi, dword ptr [rsp+3228]
+  cmp rsi, 0
+  jg .L.begin.main.1087
+.L.break.main.1086:
+  movsxd rsi, dword ptr [rsp+3228]
+  mov qword ptr [rsp+14680], rsi
+  lea rsi, [rip+.L.data.main.420]
+  mov qword ptr [rsp+14672], rsi
+  mov rsi, qword ptr [rsp+14688]
+  cmp rsi, qword ptr [rsp+14680]
+  jne .L.else.main.1088
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14672]
+  mov r9, qword ptr [rsp+14680]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1089
+.L.else.main.1088:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14672]
+  mov r9, qword ptr [rsp+14688]
+  mov r10, qword ptr [rsp+14680]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1089:
+  mov qword ptr [rsp+14712], 4
+  mov dword ptr [rsp+3232], 0
+  mov dword ptr [rsp+3236], 0
+  add dword ptr [rsp+3232], 1
+  movsxd rsi, dword ptr [rsp+3236]
+  cmp rsi, 3
+  setl sil
+  movzx rsi, sil
+  cmp rsi, 0
+  je .L.break.main.1091
+  .p2align 4,,10
+.L.begin.main.1092:
+  add dword ptr [rsp+3236], 1
+  add dword ptr [rsp+3232], 1
+  movsxd rsi, dword ptr [rsp+3236]
+  cmp rsi, 3
+  setl sil
+  movzx rsi, sil
+  cmp rsi, 0
+  jne .L.begin.main.1092
+.L.break.main.1091:
+  movsxd rsi, dword ptr [rsp+3232]
+  mov qword ptr [rsp+14704], rsi
+  lea rsi, [rip+.L.data.main.421]
+  mov qword ptr [rsp+14696], rsi
+  mov rsi, qword ptr [rsp+14712]
+  cmp rsi, qword ptr [rsp+14704]
+  jne .L.else.main.1093
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14696]
+  mov r9, qword ptr [rsp+14704]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1094
+.L.else.main.1093:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14696]
+  mov r9, qword ptr [rsp+14712]
+  mov r10, qword ptr [rsp+14704]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1094:
+  mov qword ptr [rsp+14736], 6
+  mov dword ptr [rsp+3240], 0
+  mov dword ptr [rsp+3244], 0
+  add dword ptr [rsp+3240], 1
+  movsxd rsi, dword ptr [rsp+3244]
+  cmp rsi, 5
+  setl sil
+  movzx rsi, sil
+  cmp rsi, 0
+  je .L.break.main.1096
+  .p2align 4,,10
+.L.begin.main.1097:
+  add dword ptr [rsp+3244], 1
+  add dword ptr [rsp+3240], 1
+  movsxd rsi, dword ptr [rsp+3244]
+  cmp rsi, 5
+  setl sil
+  movzx rsi, sil
+  cmp rsi, 0
+  jne .L.begin.main.1097
+.L.break.main.1096:
+  movsxd rsi, dword ptr [rsp+3240]
+  mov qword ptr [rsp+14728], rsi
+  lea rsi, [rip+.L.data.main.422]
+  mov qword ptr [rsp+14720], rsi
+  mov rsi, qword ptr [rsp+14736]
+  cmp rsi, qword ptr [rsp+14728]
+  jne .L.else.main.1099
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14720]
+  mov r9, qword ptr [rsp+14728]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1100
+.L.else.main.1099:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14720]
+  mov r9, qword ptr [rsp+14736]
+  mov r10, qword ptr [rsp+14728]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1100:
+  mov qword ptr [rsp+14760], 3
+  mov dword ptr [rsp+3248], 0
+  jmp .L.label.main.k
+  .p2align 4,,10
+.L.begin.main.1103:
+  add dword ptr [rsp+3248], 1
+.L.label.main.k:
+  movsxd rsi, dword ptr [rsp+3248]
+  cmp rsi, 3
+  setl sil
+  movzx rsi, sil
+  cmp rsi, 0
+  jne .L.begin.main.1103
+  movsxd rsi, dword ptr [rsp+3248]
+  mov qword ptr [rsp+14752], rsi
+  lea rsi, [rip+.L.data.main.423]
+  mov qword ptr [rsp+14744], rsi
+  mov rsi, qword ptr [rsp+14760]
+  cmp rsi, qword ptr [rsp+14752]
+  jne .L.else.main.1106
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14744]
+  mov r9, qword ptr [rsp+14752]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1107
+.L.else.main.1106:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14744]
+  mov r9, qword ptr [rsp+14760]
+  mov r10, qword ptr [rsp+14752]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1107:
+  mov qword ptr [rsp+14784], 6
+  mov dword ptr [rsp+3252], 0
+  mov dword ptr [rsp+3256], 0
+  jmp .L.label.main.l
+  .p2align 4,,10
+.L.begin.main.1110:
+  movsxd rsi, dword ptr [rsp+3256]
+  cmp rsi, 5
+  jg .L.continue.main.1108
+  add dword ptr [rsp+3252], 1
+.L.continue.main.1108:
+  add dword ptr [rsp+3256], 1
+.L.label.main.l:
+  movsxd rsi, dword ptr [rsp+3256]
+  cmp rsi, 10
+  setl sil
+  movzx rsi, sil
+  cmp rsi, 0
+  jne .L.begin.main.1110
+  movsxd rsi, dword ptr [rsp+3252]
+  mov qword ptr [rsp+14776], rsi
+  lea rsi, [rip+.L.data.main.424]
+  mov qword ptr [rsp+14768], rsi
+  mov rsi, qword ptr [rsp+14784]
+  cmp rsi, qword ptr [rsp+14776]
+  jne .L.else.main.1114
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14768]
+  mov r9, qword ptr [rsp+14776]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1115
+.L.else.main.1114:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14768]
+  mov r9, qword ptr [rsp+14784]
+  mov r10, qword ptr [rsp+14776]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1115:
+  mov qword ptr [rsp+14808], 0
+  mov dword ptr [rsp+3260], 0
+  mov dword ptr [rsp+3264], 0
+  jmp .L.label.main.m
+  .p2align 4,,10
+.L.begin.main.1118:
+  add dword ptr [rsp+3260], 1
+  add dword ptr [rsp+3264], 1
+.L.label.main.m:
+  movsxd rsi, dword ptr [rsp+3264]
+  cmp rsi, 0
+  setl sil
+  movzx rsi, sil
+  cmp rsi, 0
+  jne .L.begin.main.1118
+  movsxd rsi, dword ptr [rsp+3260]
+  mov qword ptr [rsp+14800], rsi
+  lea rsi, [rip+.L.data.main.425]
+  mov qword ptr [rsp+14792], rsi
+  mov rsi, qword ptr [rsp+14808]
+  cmp rsi, qword ptr [rsp+14800]
+  jne .L.else.main.1121
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14792]
+  mov r9, qword ptr [rsp+14800]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1122
+.L.else.main.1121:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14792]
+  mov r9, qword ptr [rsp+14808]
+  mov r10, qword ptr [rsp+14800]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1122:
+  mov qword ptr [rsp+14832], 11
+  mov dword ptr [rsp+3268], 0
+  jmp .L.test.main.1126
+  .p2align 4,,10
+.L.begin.main.1125:
+  add dword ptr [rsp+3268], 1
+.L.test.main.1126:
+  movsxd rsi, dword ptr [rsp+3268]
+  cmp rsi, 20
+  jge .L.skip.main.1127
+  movsxd rsi, dword ptr [rsp+3268]
+  cmp rsi, 11
+  je .L.skip.main.1127
+  movsxd rsi, dword ptr [rsp+3268]
+  cmp rsi, 12
+  je .L.skip.main.1127
+  movsxd rsi, dword ptr [rsp+3268]
+  cmp rsi, 13
+  je .L.skip.main.1127
+  movsxd rsi, dword ptr [rsp+3268]
+  cmp rsi, 14
+  je .L.skip.main.1127
+  movsxd rsi, dword ptr [rsp+3268]
+  cmp rsi, 15
+  je .L.skip.main.1127
+  movsxd rsi, dword ptr [rsp+3268]
+  cmp rsi, 16
+  je .L.skip.main.1127
+  movsxd rsi, dword ptr [rsp+3268]
+  cmp rsi, 17
+  jne .L.begin.main.1125
+.L.skip.main.1127:
+  movsxd rsi, dword ptr [rsp+3268]
+  mov qword ptr [rsp+14824], rsi
+  lea rsi, [rip+.L.data.main.426]
+  mov qword ptr [rsp+14816], rsi
+  mov rsi, qword ptr [rsp+14832]
+  cmp rsi, qword ptr [rsp+14824]
+  jne .L.else.main.1128
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14816]
+  mov r9, qword ptr [rsp+14824]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1129
+.L.else.main.1128:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14816]
+  mov r9, qword ptr [rsp+14832]
+  mov r10, qword ptr [rsp+14824]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1129:
+  mov qword ptr [rsp+14856], 3
+  mov dword ptr [rsp+3272], 0
+  add dword ptr [rsp+3272], 1
+  add dword ptr [rsp+3272], 1
+  add dword ptr [rsp+3272], 1
+  movsxd rsi, dword ptr [rsp+3272]
+  mov qword ptr [rsp+14848], rsi
+  lea rsi, [rip+.L.data.main.427]
+  mov qword ptr [rsp+14840], rsi
+  mov rsi, qword ptr [rsp+14856]
+  cmp rsi, qword ptr [rsp+14848]
+  jne .L.else.main.1133
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14840]
+  mov r9, qword ptr [rsp+14848]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1134
+.L.else.main.1133:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14840]
+  mov r9, qword ptr [rsp+14856]
+  mov r10, qword ptr [rsp+14848]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1134:
+  mov qword ptr [rsp+14880], 2
+  mov dword ptr [rsp+3276], 0
+  add dword ptr [rsp+3276], 1
+  add dword ptr [rsp+3276], 1
+  movsxd rsi, dword ptr [rsp+3276]
+  mov qword ptr [rsp+14872], rsi
+  lea rsi, [rip+.L.data.main.428]
+  mov qword ptr [rsp+14864], rsi
+  mov rsi, qword ptr [rsp+14880]
+  cmp rsi, qword ptr [rsp+14872]
+  jne .L.else.main.1138
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14864]
+  mov r9, qword ptr [rsp+14872]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1139
+.L.else.main.1138:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14864]
+  mov r9, qword ptr [rsp+14880]
+  mov r10, qword ptr [rsp+14872]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1139:
+  mov qword ptr [rsp+14904], 1
+  mov dword ptr [rsp+3280], 0
+  add dword ptr [rsp+3280], 1
+  movsxd rsi, dword ptr [rsp+3280]
+  mov qword ptr [rsp+14896], rsi
+  lea rsi, [rip+.L.data.main.429]
+  mov qword ptr [rsp+14888], rsi
+  mov rsi, qword ptr [rsp+14904]
+  cmp rsi, qword ptr [rsp+14896]
+  jne .L.else.main.1143
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14888]
+  mov r9, qword ptr [rsp+14896]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1144
+.L.else.main.1143:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14888]
+  mov r9, qword ptr [rsp+14904]
+  mov r10, qword ptr [rsp+14896]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1144:
+  mov qword ptr [rsp+14928], 5
+  mov dword ptr [rsp+3284], 0
+  mov rsi, 0
+  cmp rsi, 0
+  je .L.case.main.1148
+  cmp rsi, 1
+  je .L.case.main.1147
+  cmp rsi, 2
+  je .L.case.main.1146
+  jmp .L.break.main.1145
+.L.case.main.1148:
+  mov dword ptr [rsp+3284], 5
+  jmp .L.break.main.1145
+.L.case.main.1147:
+  mov dword ptr [rsp+3284], 6
+  jmp .L.break.main.1145
+.L.case.main.1146:
+  mov dword ptr [rsp+3284], 7
+.L.break.main.1145:
+  movsxd rsi, dword ptr [rsp+3284]
+  mov qword ptr [rsp+14920], rsi
+  lea rsi, [rip+.L.data.main.430]
+  mov qword ptr [rsp+14912], rsi
+  mov rsi, qword ptr [rsp+14928]
+  cmp rsi, qword ptr [rsp+14920]
+  jne .L.else.main.1149
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14912]
+  mov r9, qword ptr [rsp+14920]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1150
+.L.else.main.1149:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14912]
+  mov r9, qword ptr [rsp+14928]
+  mov r10, qword ptr [rsp+14920]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1150:
+  mov qword ptr [rsp+14952], 6
+  mov dword ptr [rsp+3288], 0
+  mov rsi, 1
+  cmp rsi, 0
+  je .L.case.main.1154
+  cmp rsi, 1
+  je .L.case.main.1153
+  cmp rsi, 2
+  je .L.case.main.1152
+  jmp .L.break.main.1151
+.L.case.main.1154:
+  mov dword ptr [rsp+3288], 5
+  jmp .L.break.main.1151
+.L.case.main.1153:
+  mov dword ptr [rsp+3288], 6
+  jmp .L.break.main.1151
+.L.case.main.1152:
+  mov dword ptr [rsp+3288], 7
+.L.break.main.1151:
+  movsxd rsi, dword ptr [rsp+3288]
+  mov qword ptr [rsp+14944], rsi
+  lea rsi, [rip+.L.data.main.431]
+  mov qword ptr [rsp+14936], rsi
+  mov rsi, qword ptr [rsp+14952]
+  cmp rsi, qword ptr [rsp+14944]
+  jne .L.else.main.1155
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14936]
+  mov r9, qword ptr [rsp+14944]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1156
+.L.else.main.1155:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14936]
+  mov r9, qword ptr [rsp+14952]
+  mov r10, qword ptr [rsp+14944]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1156:
+  mov qword ptr [rsp+14976], 7
+  mov dword ptr [rsp+3292], 0
+  mov rsi, 2
+  cmp rsi, 0
+  je .L.case.main.1160
+  cmp rsi, 1
+  je .L.case.main.1159
+  cmp rsi, 2
+  je .L.case.main.1158
+  jmp .L.break.main.1157
+.L.case.main.1160:
+  mov dword ptr [rsp+3292], 5
+  jmp .L.break.main.1157
+.L.case.main.1159:
+  mov dword ptr [rsp+3292], 6
+  jmp .L.break.main.1157
+.L.case.main.1158:
+  mov dword ptr [rsp+3292], 7
+.L.break.main.1157:
+  movsxd rsi, dword ptr [rsp+3292]
+  mov qword ptr [rsp+14968], rsi
+  lea rsi, [rip+.L.data.main.432]
+  mov qword ptr [rsp+14960], rsi
+  mov rsi, qword ptr [rsp+14976]
+  cmp rsi, qword ptr [rsp+14968]
+  jne .L.else.main.1161
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14960]
+  mov r9, qword ptr [rsp+14968]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1162
+.L.else.main.1161:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14960]
+  mov r9, qword ptr [rsp+14976]
+  mov r10, qword ptr [rsp+14968]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1162:
+  mov qword ptr [rsp+15000], 0
+  mov dword ptr [rsp+3296], 0
+  mov rsi, 3
+  cmp rsi, 0
+  je .L.case.main.1166
+  cmp rsi, 1
+  je .L.case.main.1165
+  cmp rsi, 2
+  je .L.case.main.1164
+  jmp .L.break.main.1163
+.L.case.main.1166:
+  mov dword ptr [rsp+3296], 5
+  jmp .L.break.main.1163
+.L.case.main.1165:
+  mov dword ptr [rsp+3296], 6
+  jmp .L.break.main.1163
+.L.case.main.1164:
+  mov dword ptr [rsp+3296], 7
+.L.break.main.1163:
+  movsxd rsi, dword ptr [rsp+3296]
+  mov qword ptr [rsp+14992], rsi
+  lea rsi, [rip+.L.data.main.433]
+  mov qword ptr [rsp+14984], rsi
+  mov rsi, qword ptr [rsp+15000]
+  cmp rsi, qword ptr [rsp+14992]
+  jne .L.else.main.1167
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+14984]
+  mov r9, qword ptr [rsp+14992]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1168
+.L.else.main.1167:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+14984]
+  mov r9, qword ptr [rsp+15000]
+  mov r10, qword ptr [rsp+14992]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1168:
+  mov qword ptr [rsp+15024], 5
+  mov dword ptr [rsp+3300], 0
+  mov rsi, 0
+  cmp rsi, 0
+  jne .L.case.main.1171
+  mov dword ptr [rsp+3300], 5
+  jmp .L.break.main.1169
+.L.case.main.1171:
+  mov dword ptr [rsp+3300], 7
+.L.break.main.1169:
+  movsxd rsi, dword ptr [rsp+3300]
+  mov qword ptr [rsp+15016], rsi
+  lea rsi, [rip+.L.data.main.434]
+  mov qword ptr [rsp+15008], rsi
+  mov rsi, qword ptr [rsp+15024]
+  cmp rsi, qword ptr [rsp+15016]
+  jne .L.else.main.1172
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15008]
+  mov r9, qword ptr [rsp+15016]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1173
+.L.else.main.1172:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15008]
+  mov r9, qword ptr [rsp+15024]
+  mov r10, qword ptr [rsp+15016]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1173:
+  mov qword ptr [rsp+15048], 7
+  mov dword ptr [rsp+3304], 0
+  mov rsi, 1
+  cmp rsi, 0
+  jne .L.case.main.1176
+  mov dword ptr [rsp+3304], 5
+  jmp .L.break.main.1174
+.L.case.main.1176:
+  mov dword ptr [rsp+3304], 7
+.L.break.main.1174:
+  movsxd rsi, dword ptr [rsp+3304]
+  mov qword ptr [rsp+15040], rsi
+  lea rsi, [rip+.L.data.main.435]
+  mov qword ptr [rsp+15032], rsi
+  mov rsi, qword ptr [rsp+15048]
+  cmp rsi, qword ptr [rsp+15040]
+  jne .L.else.main.1177
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15032]
+  mov r9, qword ptr [rsp+15040]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1178
+.L.else.main.1177:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15032]
+  mov r9, qword ptr [rsp+15048]
+  mov r10, qword ptr [rsp+15040]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1178:
+  mov qword ptr [rsp+15072], 2
+  mov dword ptr [rsp+3308], 0
+  mov rsi, 1
+  cmp rsi, 0
+  je .L.case.main.1182
+  cmp rsi, 1
+  je .L.case.main.1181
+  cmp rsi, 2
+  je .L.case.main.1180
+  jmp .L.break.main.1179
+.L.case.main.1182:
+.L.case.main.1181:
+.L.case.main.1180:
+  mov dword ptr [rsp+3308], 2
+.L.break.main.1179:
+  movsxd rsi, dword ptr [rsp+3308]
+  mov qword ptr [rsp+15064], rsi
+  lea rsi, [rip+.L.data.main.436]
+  mov qword ptr [rsp+15056], rsi
+  mov rsi, qword ptr [rsp+15072]
+  cmp rsi, qword ptr [rsp+15064]
+  jne .L.else.main.1183
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15056]
+  mov r9, qword ptr [rsp+15064]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1184
+.L.else.main.1183:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15056]
+  mov r9, qword ptr [rsp+15072]
+  mov r10, qword ptr [rsp+15064]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1184:
+  mov qword ptr [rsp+15096], 0
+  mov dword ptr [rsp+3312], 0
+  mov rsi, 3
+  cmp rsi, 0
+  je .L.case.main.1188
+  cmp rsi, 1
+  je .L.case.main.1187
+  cmp rsi, 2
+  je .L.case.main.1186
+  jmp .L.break.main.1185
+.L.case.main.1188:
+.L.case.main.1187:
+.L.case.main.1186:
+  mov dword ptr [rsp+3312], 2
+.L.break.main.1185:
+  movsxd rsi, dword ptr [rsp+3312]
+  mov qword ptr [rsp+15088], rsi
+  lea rsi, [rip+.L.data.main.437]
+  mov qword ptr [rsp+15080], rsi
+  mov rsi, qword ptr [rsp+15096]
+  cmp rsi, qword ptr [rsp+15088]
+  jne .L.else.main.1189
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15080]
+  mov r9, qword ptr [rsp+15088]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1190
+.L.else.main.1189:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15080]
+  mov r9, qword ptr [rsp+15096]
+  mov r10, qword ptr [rsp+15088]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1190:
+  mov qword ptr [rsp+15120], 1
+  mov rsi, 1
+  shl rsi, 0
+  mov qword ptr [rsp+15112], rsi
+  lea rsi, [rip+.L.data.main.438]
+  mov qword ptr [rsp+15104], rsi
+  mov rsi, qword ptr [rsp+15120]
+  cmp rsi, qword ptr [rsp+15112]
+  jne .L.else.main.1191
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15104]
+  mov r9, qword ptr [rsp+15112]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1192
+.L.else.main.1191:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15104]
+  mov r9, qword ptr [rsp+15120]
+  mov r10, qword ptr [rsp+15112]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1192:
+  mov qword ptr [rsp+15144], 8
+  mov rsi, 1
+  shl rsi, 3
+  mov qword ptr [rsp+15136], rsi
+  lea rsi, [rip+.L.data.main.439]
+  mov qword ptr [rsp+15128], rsi
+  mov rsi, qword ptr [rsp+15144]
+  cmp rsi, qword ptr [rsp+15136]
+  jne .L.else.main.1193
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15128]
+  mov r9, qword ptr [rsp+15136]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1194
+.L.else.main.1193:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15128]
+  mov r9, qword ptr [rsp+15144]
+  mov r10, qword ptr [rsp+15136]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1194:
+  mov qword ptr [rsp+15168], 10
+  mov rsi, 5
+  shl rsi, 1
+  mov qword ptr [rsp+15160], rsi
+  lea rsi, [rip+.L.data.main.440]
+  mov qword ptr [rsp+15152], rsi
+  mov rsi, qword ptr [rsp+15168]
+  cmp rsi, qword ptr [rsp+15160]
+  jne .L.else.main.1195
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15152]
+  mov r9, qword ptr [rsp+15160]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1196
+.L.else.main.1195:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15152]
+  mov r9, qword ptr [rsp+15168]
+  mov r10, qword ptr [rsp+15160]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1196:
+  mov qword ptr [rsp+15192], 2
+  mov rsi, 5
+  sar rsi, 1
+  mov qword ptr [rsp+15184], rsi
+  lea rsi, [rip+.L.data.main.441]
+  mov qword ptr [rsp+15176], rsi
+  mov rsi, qword ptr [rsp+15192]
+  cmp rsi, qword ptr [rsp+15184]
+  jne .L.else.main.1197
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15176]
+  mov r9, qword ptr [rsp+15184]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1198
+.L.else.main.1197:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15176]
+  mov r9, qword ptr [rsp+15192]
+  mov r10, qword ptr [rsp+15184]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1198:
+  mov rsi, 0
+  sub rsi, 1
+  mov qword ptr [rsp+15216], rsi
+  mov rsi, 0
+  sub rsi, 1
+  sar rsi, 1
+  mov qword ptr [rsp+15208], rsi
+  lea rsi, [rip+.L.data.main.442]
+  mov qword ptr [rsp+15200], rsi
+  mov rsi, qword ptr [rsp+15216]
+  cmp rsi, qword ptr [rsp+15208]
+  jne .L.else.main.1199
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15200]
+  mov r9, qword ptr [rsp+15208]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1200
+.L.else.main.1199:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15200]
+  mov r9, qword ptr [rsp+15216]
+  mov r10, qword ptr [rsp+15208]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1200:
+  mov qword ptr [rsp+15240], 1
+  mov dword ptr [rsp+3316], 1
+  shl dword ptr [rsp+3316], 0
+  movsxd rsi, dword ptr [rsp+3316]
+  mov qword ptr [rsp+15232], rsi
+  lea rsi, [rip+.L.data.main.443]
+  mov qword ptr [rsp+15224], rsi
+  mov rsi, qword ptr [rsp+15240]
+  cmp rsi, qword ptr [rsp+15232]
+  jne .L.else.main.1201
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15224]
+  mov r9, qword ptr [rsp+15232]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1202
+.L.else.main.1201:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15224]
+  mov r9, qword ptr [rsp+15240]
+  mov r10, qword ptr [rsp+15232]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1202:
+  mov qword ptr [rsp+15264], 8
+  mov dword ptr [rsp+3320], 1
+  shl dword ptr [rsp+3320], 3
+  movsxd rsi, dword ptr [rsp+3320]
+  mov qword ptr [rsp+15256], rsi
+  lea rsi, [rip+.L.data.main.444]
+  mov qword ptr [rsp+15248], rsi
+  mov rsi, qword ptr [rsp+15264]
+  cmp rsi, qword ptr [rsp+15256]
+  jne .L.else.main.1203
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15248]
+  mov r9, qword ptr [rsp+15256]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1204
+.L.else.main.1203:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15248]
+  mov r9, qword ptr [rsp+15264]
+  mov r10, qword ptr [rsp+15256]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1204:
+  mov qword ptr [rsp+15288], 10
+  mov dword ptr [rsp+3324], 5
+  shl dword ptr [rsp+3324], 1
+  movsxd rsi, dword ptr [rsp+3324]
+  mov qword ptr [rsp+15280], rsi
+  lea rsi, [rip+.L.data.main.445]
+  mov qword ptr [rsp+15272], rsi
+  mov rsi, qword ptr [rsp+15288]
+  cmp rsi, qword ptr [rsp+15280]
+  jne .L.else.main.1205
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15272]
+  mov r9, qword ptr [rsp+15280]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1206
+.L.else.main.1205:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15272]
+  mov r9, qword ptr [rsp+15288]
+  mov r10, qword ptr [rsp+15280]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1206:
+  mov qword ptr [rsp+15312], 2
+  mov dword ptr [rsp+3328], 5
+  sar dword ptr [rsp+3328], 1
+  movsxd rsi, dword ptr [rsp+3328]
+  mov qword ptr [rsp+15304], rsi
+  lea rsi, [rip+.L.data.main.446]
+  mov qword ptr [rsp+15296], rsi
+  mov rsi, qword ptr [rsp+15312]
+  cmp rsi, qword ptr [rsp+15304]
+  jne .L.else.main.1207
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15296]
+  mov r9, qword ptr [rsp+15304]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1208
+.L.else.main.1207:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15296]
+  mov r9, qword ptr [rsp+15312]
+  mov r10, qword ptr [rsp+15304]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1208:
+  mov rsi, 0
+  sub rsi, 1
+  mov qword ptr [rsp+15336], rsi
+  mov rsi, 0
+  sub rsi, 1
+  mov qword ptr [rsp+15328], rsi
+  lea rsi, [rip+.L.data.main.447]
+  mov qword ptr [rsp+15320], rsi
+  mov rsi, qword ptr [rsp+15336]
+  cmp rsi, qword ptr [rsp+15328]
+  jne .L.else.main.1209
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15320]
+  mov r9, qword ptr [rsp+15328]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1210
+.L.else.main.1209:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15320]
+  mov r9, qword ptr [rsp+15336]
+  mov r10, qword ptr [rsp+15328]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1210:
+  mov rsi, 0
+  sub rsi, 1
+  mov qword ptr [rsp+15360], rsi
+  mov rsi, 0
+  sub rsi, 1
+  mov dword ptr [rsp+3332], esi
+  movsxd rsi, dword ptr [rsp+3332]
+  mov qword ptr [rsp+15352], rsi
+  lea rsi, [rip+.L.data.main.448]
+  mov qword ptr [rsp+15344], rsi
+  mov rsi, qword ptr [rsp+15360]
+  cmp rsi, qword ptr [rsp+15352]
+  jne .L.else.main.1211
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15344]
+  mov r9, qword ptr [rsp+15352]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1212
+.L.else.main.1211:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15344]
+  mov r9, qword ptr [rsp+15360]
+  mov r10, qword ptr [rsp+15352]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1212:
+  mov rsi, 0
+  sub rsi, 1
+  mov qword ptr [rsp+15384], rsi
+  mov rsi, 0
+  sub rsi, 1
+  mov dword ptr [rsp+3336], esi
+  sar dword ptr [rsp+3336], 1
+  movsxd rsi, dword ptr [rsp+3336]
+  mov qword ptr [rsp+15376], rsi
+  lea rsi, [rip+.L.data.main.449]
+  mov qword ptr [rsp+15368], rsi
+  mov rsi, qword ptr [rsp+15384]
+  cmp rsi, qword ptr [rsp+15376]
+  jne .L.else.main.1213
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15368]
+  mov r9, qword ptr [rsp+15376]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1214
+.L.else.main.1213:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15368]
+  mov r9, qword ptr [rsp+15384]
+  mov r10, qword ptr [rsp+15376]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1214:
+  mov qword ptr [rsp+15408], 2
+  mov qword ptr [rsp+15400], 2
+  lea rsi, [rip+.L.data.main.450]
+  mov qword ptr [rsp+15392], rsi
+  mov rsi, qword ptr [rsp+15408]
+  cmp rsi, qword ptr [rsp+15400]
+  jne .L.else.main.1217
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15392]
+  mov r9, qword ptr [rsp+15400]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1218
+.L.else.main.1217:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15392]
+  mov r9, qword ptr [rsp+15408]
+  mov r10, qword ptr [rsp+15400]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1218:
+  mov qword ptr [rsp+15432], 1
+  mov qword ptr [rsp+15424], 1
+  lea rsi, [rip+.L.data.main.451]
+  mov qword ptr [rsp+15416], rsi
+  mov rsi, qword ptr [rsp+15432]
+  cmp rsi, qword ptr [rsp+15424]
+  jne .L.else.main.1221
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15416]
+  mov r9, qword ptr [rsp+15424]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1222
+.L.else.main.1221:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15416]
+  mov r9, qword ptr [rsp+15432]
+  mov r10, qword ptr [rsp+15424]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1222:
+  mov qword ptr [rsp+15456], 10
+  mov qword ptr [rsp+15448], 10
+  lea rsi, [rip+.L.data.main.452]
+  mov qword ptr [rsp+15440], rsi
+  mov rsi, qword ptr [rsp+15456]
+  cmp rsi, qword ptr [rsp+15448]
+  jne .L.else.main.1223
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15440]
+  mov r9, qword ptr [rsp+15448]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1224
+.L.else.main.1223:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15440]
+  mov r9, qword ptr [rsp+15456]
+  mov r10, qword ptr [rsp+15448]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1224:
+  mov qword ptr [rsp+15480], 1
+  mov dword ptr [rsp+3340], 0
+  mov rsi, 3
+  cmp rsi, 3
+  jne .L.break.main.1225
+  add dword ptr [rsp+3340], 1
+.L.break.main.1225:
+  movsxd rsi, dword ptr [rsp+3340]
+  mov qword ptr [rsp+15472], rsi
+  lea rsi, [rip+.L.data.main.453]
+  mov qword ptr [rsp+15464], rsi
+  mov rsi, qword ptr [rsp+15480]
+  cmp rsi, qword ptr [rsp+15472]
+  jne .L.else.main.1227
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15464]
+  mov r9, qword ptr [rsp+15472]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1228
+.L.else.main.1227:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15464]
+  mov r9, qword ptr [rsp+15480]
+  mov r10, qword ptr [rsp+15472]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1228:
+  mov qword ptr [rsp+15504], 12063
+  mov dword ptr [rsp+3344], 0
+  mov rsi, 0
+  sub rsi, 3
+  mov dword ptr [rsp+3348], esi
+  movsxd rsi, dword ptr [rsp+3348]
+  cmp rsi, 15
+  jge .L.break.main.1230
+  lea rsi, [rip+.L.table.main.1240]
+  .p2align 4,,10
+.L.begin.main.1231:
+  movsxd rdi, dword ptr [rsp+3348]
+  cmp rdi, 7
+  ja .L.case.main.1239
+  shl rdi, 2
+  add rdi, rsi
+  movsxd rdi, dword ptr [rdi]
+  add rdi, rsi
+  jmp rdi
+.L.table.main.1240:
+  .long .L.case.main.1238-.L.table.main.1240
+  .long .L.case.main.1237-.L.table.main.1240
+  .long .L.case.main.1236-.L.table.main.1240
+  .long .L.case.main.1239-.L.table.main.1240
+  .long .L.case.main.1235-.L.table.main.1240
+  .long .L.case.main.1234-.L.table.main.1240
+  .long .L.case.main.1239-.L.table.main.1240
+  .long .L.case.main.1233-.L.table.main.1240
+.L.case.main.1238:
+  add dword ptr [rsp+3344], 1
+  jmp .L.break.main.1232
+.L.case.main.1237:
+  add dword ptr [rsp+3344], 2
+  jmp .L.break.main.1232
+.L.case.main.1236:
+  add dword ptr [rsp+3344], 4
+  jmp .L.break.main.1232
+.L.case.main.1235:
+  add dword ptr [rsp+3344], 8
+  jmp .L.break.main.1232
+.L.case.main.1234:
+  add dword ptr [rsp+3344], 16
+  jmp .L.break.main.1232
+.L.case.main.1233:
+  add dword ptr [rsp+3344], 32
+  jmp .L.break.main.1232
+.L.case.main.1239:
+  add dword ptr [rsp+3344], 1000
+.L.break.main.1232:
+  add dword ptr [rsp+3348], 1
+  movsxd rdi, dword ptr [rsp+3348]
+  cmp rdi, 15
+  jl .L.begin.main.1231
+.L.break.main.1230:
+  movsxd rsi, dword ptr [rsp+3344]
+  mov qword ptr [rsp+15496], rsi
+  lea rsi, [rip+.L.data.main.454]
+  mov qword ptr [rsp+15488], rsi
+  mov rsi, qword ptr [rsp+15504]
+  cmp rsi, qword ptr [rsp+15496]
+  jne .L.else.main.1241
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15488]
+  mov r9, qword ptr [rsp+15496]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1242
+.L.else.main.1241:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15488]
+  mov r9, qword ptr [rsp+15504]
+  mov r10, qword ptr [rsp+15496]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1242:
+  mov qword ptr [rsp+15528], 25
+  mov dword ptr [rsp+3352], 0
+  mov rsi, 0
+  sub rsi, 3
+  mov dword ptr [rsp+3356], esi
+  movsxd rsi, dword ptr [rsp+3356]
+  cmp rsi, 12
+  jge .L.break.main.1244
+  lea rsi, [rip+.L.table.main.1251]
+  .p2align 4,,10
+.L.begin.main.1245:
+  movsxd rdi, dword ptr [rsp+3356]
+  sub rdi, 5
+  sub rdi, -5
+  cmp rdi, 4
+  ja .L.break.main.1246
+  shl rdi, 2
+  add rdi, rsi
+  movsxd rdi, dword ptr [rdi]
+  add rdi, rsi
+  jmp rdi
+.L.table.main.1251:
+  .long .L.case.main.1250-.L.table.main.1251
+  .long .L.case.main.1249-.L.table.main.1251
+  .long .L.break.main.1246-.L.table.main.1251
+  .long .L.case.main.1248-.L.table.main.1251
+  .long .L.case.main.1247-.L.table.main.1251
+.L.case.main.1250:
+  add dword ptr [rsp+3352], 1
+.L.case.main.1249:
+  add dword ptr [rsp+3352], 2
+  jmp .L.break.main.1246
+.L.case.main.1248:
+  add dword ptr [rsp+3352], 4
+.L.case.main.1247:
+  add dword ptr [rsp+3352], 8
+.L.break.main.1246:
+  add dword ptr [rsp+3356], 1
+  movsxd rdi, dword ptr [rsp+3356]
+  cmp rdi, 12
+  jl .L.begin.main.1245
+.L.break.main.1244:
+  movsxd rsi, dword ptr [rsp+3352]
+  mov qword ptr [rsp+15520], rsi
+  lea rsi, [rip+.L.data.main.455]
+  mov qword ptr [rsp+15512], rsi
+  mov rsi, qword ptr [rsp+15528]
+  cmp rsi, qword ptr [rsp+15520]
+  jne .L.else.main.1252
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15512]
+  mov r9, qword ptr [rsp+15520]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1253
+.L.else.main.1252:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15512]
+  mov r9, qword ptr [rsp+15528]
+  mov r10, qword ptr [rsp+15520]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1253:
+  mov qword ptr [rsp+15552], 127
+  mov dword ptr [rsp+3360], 0
+  mov dword ptr [rsp+3364], 0
+  movsxd rsi, dword ptr [rsp+3364]
+  cmp rsi, 1100
+  jge .L.break.main.1255
+  .p2align 4,,10
+.L.begin.main.1256:
+  movsxd rsi, dword ptr [rsp+3364]
+  cmp rsi, 20
+  je .L.case.main.1260
+  jg .L.upper.main.1266
+  cmp rsi, 1
+  je .L.case.main.1264
+  cmp rsi, 5
+  je .L.case.main.1258
+  cmp rsi, 10
+  je .L.case.main.1263
+  jmp .L.case.main.1265
+.L.upper.main.1266:
+  cmp rsi, 100
+  je .L.case.main.1262
+  cmp rsi, 300
+  je .L.case.main.1259
+  cmp rsi, 1000
+  je .L.case.main.1261
+  jmp .L.case.main.1265
+.L.case.main.1264:
+  add dword ptr [rsp+3360], 1
+  jmp .L.break.main.1257
+.L.case.main.1263:
+  add dword ptr [rsp+3360], 2
+  jmp .L.break.main.1257
+.L.case.main.1262:
+  add dword ptr [rsp+3360], 4
+  jmp .L.break.main.1257
+.L.case.main.1261:
+  add dword ptr [rsp+3360], 8
+  jmp .L.break.main.1257
+.L.case.main.1260:
+  add dword ptr [rsp+3360], 16
+  jmp .L.break.main.1257
+.L.case.main.1259:
+  add dword ptr [rsp+3360], 32
+  jmp .L.break.main.1257
+.L.case.main.1258:
+  add dword ptr [rsp+3360], 64
+  jmp .L.break.main.1257
+.L.case.main.1265:
+  add dword ptr [rsp+3360], 0
+.L.break.main.1257:
+  add dword ptr [rsp+3364], 1
+  movsxd rsi, dword ptr [rsp+3364]
+  cmp rsi, 1100
+  jl .L.begin.main.1256
+.L.break.main.1255:
+  movsxd rsi, dword ptr [rsp+3360]
+  mov qword ptr [rsp+15544], rsi
+  lea rsi, [rip+.L.data.main.456]
+  mov qword ptr [rsp+15536], rsi
+  mov rsi, qword ptr [rsp+15552]
+  cmp rsi, qword ptr [rsp+15544]
+  jne .L.else.main.1267
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15536]
+  mov r9, qword ptr [rsp+15544]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1268
+.L.else.main.1267:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15536]
+  mov r9, qword ptr [rsp+15552]
+  mov r10, qword ptr [rsp+15544]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1268:
+  mov qword ptr [rsp+15576], 144
+  mov dword ptr [rsp+3368], 0
+  mov dword ptr [rsp+3372], 0
+  movsxd rsi, dword ptr [rsp+3372]
+  cmp rsi, 50
+  jge .L.break.main.1270
+  lea rsi, [rip+.L.table.main.1283]
+  lea rdi, [rip+.L.table.main.1284]
+  .p2align 4,,10
+.L.begin.main.1271:
+  movsxd r8, dword ptr [rsp+3372]
+  cmp r8, 20
+  je .L.case.main.1273
+  jg .L.upper.main.1282
+  mov r9, r8
+  sub r9, 1
+  cmp r9, 3
+  ja .L.break.main.1272
+  shl r9, 2
+  add r9, rsi
+  movsxd r9, dword ptr [r9]
+  add r9, rsi
+  jmp r9
+.L.table.main.1283:
+  .long .L.case.main.1278-.L.table.main.1283
+  .long .L.case.main.1279-.L.table.main.1283
+  .long .L.case.main.1280-.L.table.main.1283
+  .long .L.case.main.1281-.L.table.main.1283
+.L.upper.main.1282:
+  sub r8, 40
+  cmp r8, 3
+  ja .L.break.main.1272
+  shl r8, 2
+  add r8, rdi
+  movsxd r8, dword ptr [r8]
+  add r8, rdi
+  jmp r8
+.L.table.main.1284:
+  .long .L.case.main.1274-.L.table.main.1284
+  .long .L.case.main.1275-.L.table.main.1284
+  .long .L.case.main.1276-.L.table.main.1284
+  .long .L.case.main.1277-.L.table.main.1284
+.L.case.main.1278:
+.L.case.main.1279:
+.L.case.main.1280:
+.L.case.main.1281:
+  add dword ptr [rsp+3368], 1
+  jmp .L.break.main.1272
+.L.case.main.1274:
+.L.case.main.1275:
+.L.case.main.1276:
+.L.case.main.1277:
+  add dword ptr [rsp+3368], 10
+  jmp .L.break.main.1272
+.L.case.main.1273:
+  add dword ptr [rsp+3368], 100
+.L.break.main.1272:
+  add dword ptr [rsp+3372], 1
+  movsxd r8, dword ptr [rsp+3372]
+  cmp r8, 50
+  jl .L.begin.main.1271
+.L.break.main.1270:
+  movsxd rsi, dword ptr [rsp+3368]
+  mov qword ptr [rsp+15568], rsi
+  lea rsi, [rip+.L.data.main.457]
+  mov qword ptr [rsp+15560], rsi
+  mov rsi, qword ptr [rsp+15576]
+  cmp rsi, qword ptr [rsp+15568]
+  jne .L.else.main.1285
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15560]
+  mov r9, qword ptr [rsp+15568]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1286
+.L.else.main.1285:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15560]
+  mov r9, qword ptr [rsp+15576]
+  mov r10, qword ptr [rsp+15568]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1286:
+  mov qword ptr [rsp+15600], 5
+  movabs rsi, 4294967298
+  mov qword ptr [rsp+3376], rsi
+  mov dword ptr [rsp+3384], 0
+  mov rsi, qword ptr [rsp+3376]
+  sub rsi, 2
+  cmp rsi, 3
+  ja .L.case.main.1292
+  lea rdi, [rip+.L.table.main.1293]
+  shl rsi, 2
+  add rsi, rdi
+  movsxd rsi, dword ptr [rsi]
+  add rsi, rdi
+  jmp rsi
+.L.table.main.1293:
+  .long .L.case.main.1291-.L.table.main.1293
+  .long .L.case.main.1290-.L.table.main.1293
+  .long .L.case.main.1289-.L.table.main.1293
+  .long .L.case.main.1288-.L.table.main.1293
+.L.case.main.1291:
+  mov dword ptr [rsp+3384], 1
+  jmp .L.break.main.1287
+.L.case.main.1290:
+  mov dword ptr [rsp+3384], 2
+  jmp .L.break.main.1287
+.L.case.main.1289:
+  mov dword ptr [rsp+3384], 3
+  jmp .L.break.main.1287
+.L.case.main.1288:
+  mov dword ptr [rsp+3384], 4
+  jmp .L.break.main.1287
+.L.case.main.1292:
+  mov dword ptr [rsp+3384], 5
+.L.break.main.1287:
+  movsxd rsi, dword ptr [rsp+3384]
+  mov qword ptr [rsp+15592], rsi
+  lea rsi, [rip+.L.data.main.458]
+  mov qword ptr [rsp+15584], rsi
+  mov rsi, qword ptr [rsp+15600]
+  cmp rsi, qword ptr [rsp+15592]
+  jne .L.else.main.1294
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15584]
+  mov r9, qword ptr [rsp+15592]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1295
+.L.else.main.1294:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15584]
+  mov r9, qword ptr [rsp+15600]
+  mov r10, qword ptr [rsp+15592]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1295:
+  mov qword ptr [rsp+15624], 8
+  mov qword ptr [rsp+15616], 8
+  lea rsi, [rip+.L.data.main.459]
+  mov qword ptr [rsp+15608], rsi
+  mov rsi, qword ptr [rsp+15624]
+  cmp rsi, qword ptr [rsp+15616]
+  jne .L.else.main.1296
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15608]
+  mov r9, qword ptr [rsp+15616]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1297
+.L.else.main.1296:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15608]
+  mov r9, qword ptr [rsp+15624]
+  mov r10, qword ptr [rsp+15616]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1297:
+  mov qword ptr [rsp+15648], 2
+  mov qword ptr [rsp+15640], 2
+  lea rsi, [rip+.L.data.main.460]
+  mov qword ptr [rsp+15632], rsi
+  mov rsi, qword ptr [rsp+15648]
+  cmp rsi, qword ptr [rsp+15640]
+  jne .L.else.main.1298
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15632]
+  mov r9, qword ptr [rsp+15640]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1299
+.L.else.main.1298:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15632]
+  mov r9, qword ptr [rsp+15648]
+  mov r10, qword ptr [rsp+15640]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1299:
+  mov qword ptr [rsp+15672], 3
+  mov qword ptr [rsp+15664], 3
+  lea rsi, [rip+.L.data.main.461]
+  mov qword ptr [rsp+15656], rsi
+  mov rsi, qword ptr [rsp+15672]
+  cmp rsi, qword ptr [rsp+15664]
+  jne .L.else.main.1300
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15656]
+  mov r9, qword ptr [rsp+15664]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1301
+.L.else.main.1300:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15656]
+  mov r9, qword ptr [rsp+15672]
+  mov r10, qword ptr [rsp+15664]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1301:
+  mov qword ptr [rsp+15696], 1
+  lea rsi, [rsp+3404]
+  add rsi, 0
+  mov dword ptr [rsi], 1
+  lea rsi, [rsp+3404]
+  add rsi, 4
+  mov dword ptr [rsi], 2
+  lea rsi, [rsp+3404]
+  add rsi, 8
+  mov dword ptr [rsi], 3
+  lea rsi, [rsp+3404]
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+15688], rsi
+  lea rsi, [rip+.L.data.main.462]
+  mov qword ptr [rsp+15680], rsi
+  mov rsi, qword ptr [rsp+15696]
+  cmp rsi, qword ptr [rsp+15688]
+  jne .L.else.main.1302
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15680]
+  mov r9, qword ptr [rsp+15688]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1303
+.L.else.main.1302:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15680]
+  mov r9, qword ptr [rsp+15696]
+  mov r10, qword ptr [rsp+15688]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1303:
+  mov qword ptr [rsp+15720], 2
+  lea rsi, [rsp+3416]
+  add rsi, 0
+  mov dword ptr [rsi], 1
+  lea rsi, [rsp+3416]
+  add rsi, 4
+  mov dword ptr [rsi], 2
+  lea rsi, [rsp+3416]
+  add rsi, 8
+  mov dword ptr [rsi], 3
+  lea rsi, [rsp+3416]
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+15712], rsi
+  lea rsi, [rip+.L.data.main.463]
+  mov qword ptr [rsp+15704], rsi
+  mov rsi, qword ptr [rsp+15720]
+  cmp rsi, qword ptr [rsp+15712]
+  jne .L.else.main.1304
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15704]
+  mov r9, qword ptr [rsp+15712]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1305
+.L.else.main.1304:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15704]
+  mov r9, qword ptr [rsp+15720]
+  mov r10, qword ptr [rsp+15712]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1305:
+  mov qword ptr [rsp+15744], 3
+  lea rsi, [rsp+3428]
+  add rsi, 0
+  mov dword ptr [rsi], 1
+  lea rsi, [rsp+3428]
+  add rsi, 4
+  mov dword ptr [rsi], 2
+  lea rsi, [rsp+3428]
+  add rsi, 8
+  mov dword ptr [rsi], 3
+  lea rsi, [rsp+3428]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+15736], rsi
+  lea rsi, [rip+.L.data.main.464]
+  mov qword ptr [rsp+15728], rsi
+  mov rsi, qword ptr [rsp+15744]
+  cmp rsi, qword ptr [rsp+15736]
+  jne .L.else.main.1306
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15728]
+  mov r9, qword ptr [rsp+15736]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1307
+.L.else.main.1306:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15728]
+  mov r9, qword ptr [rsp+15744]
+  mov r10, qword ptr [rsp+15736]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1307:
+  mov qword ptr [rsp+15768], 3
+  lea rsi, [rsp+3440]
+  add rsi, 0
+  mov dword ptr [rsi], 1
+  lea rsi, [rsp+3440]
+  add rsi, 4
+  mov dword ptr [rsi], 2
+  lea rsi, [rsp+3440]
+  add rsi, 8
+  mov dword ptr [rsi], 3
+  lea rsi, [rsp+3440]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+15760], rsi
+  lea rsi, [rip+.L.data.main.465]
+  mov qword ptr [rsp+15752], rsi
+  mov rsi, qword ptr [rsp+15768]
+  cmp rsi, qword ptr [rsp+15760]
+  jne .L.else.main.1308
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15752]
+  mov r9, qword ptr [rsp+15760]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1309
+.L.else.main.1308:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15752]
+  mov r9, qword ptr [rsp+15768]
+  mov r10, qword ptr [rsp+15760]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1309:
+  mov qword ptr [rsp+15792], 0
+  lea rsi, [rsp+3452]
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rsp+3452]
+  add rsi, 4
+  mov dword ptr [rsi], 0
+  lea rsi, [rsp+3452]
+  add rsi, 8
+  mov dword ptr [rsi], 0
+  lea rsi, [rsp+3452]
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+15784], rsi
+  lea rsi, [rip+.L.data.main.466]
+  mov qword ptr [rsp+15776], rsi
+  mov rsi, qword ptr [rsp+15792]
+  cmp rsi, qword ptr [rsp+15784]
+  jne .L.else.main.1310
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15776]
+  mov r9, qword ptr [rsp+15784]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1311
+.L.else.main.1310:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15776]
+  mov r9, qword ptr [rsp+15792]
+  mov r10, qword ptr [rsp+15784]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1311:
+  mov qword ptr [rsp+15816], 0
+  lea rsi, [rsp+3464]
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rsp+3464]
+  add rsi, 4
+  mov dword ptr [rsi], 0
+  lea rsi, [rsp+3464]
+  add rsi, 8
+  mov dword ptr [rsi], 0
+  lea rsi, [rsp+3464]
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+15808], rsi
+  lea rsi, [rip+.L.data.main.467]
+  mov qword ptr [rsp+15800], rsi
+  mov rsi, qword ptr [rsp+15816]
+  cmp rsi, qword ptr [rsp+15808]
+  jne .L.else.main.1312
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15800]
+  mov r9, qword ptr [rsp+15808]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1313
+.L.else.main.1312:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15800]
+  mov r9, qword ptr [rsp+15816]
+  mov r10, qword ptr [rsp+15808]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1313:
+  mov qword ptr [rsp+15840], 0
+  lea rsi, [rsp+3476]
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rsp+3476]
+  add rsi, 4
+  mov dword ptr [rsi], 0
+  lea rsi, [rsp+3476]
+  add rsi, 8
+  mov dword ptr [rsi], 0
+  lea rsi, [rsp+3476]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+15832], rsi
+  lea rsi, [rip+.L.data.main.468]
+  mov qword ptr [rsp+15824], rsi
+  mov rsi, qword ptr [rsp+15840]
+  cmp rsi, qword ptr [rsp+15832]
+  jne .L.else.main.1314
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15824]
+  mov r9, qword ptr [rsp+15832]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1315
+.L.else.main.1314:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15824]
+  mov r9, qword ptr [rsp+15840]
+  mov r10, qword ptr [rsp+15832]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1315:
+  mov qword ptr [rsp+15864], 2
+  lea rsi, [rsp+3488]
+  add rsi, 0
+  add rsi, 0
+  mov dword ptr [rsi], 1
+  lea rsi, [rsp+3488]
+  add rsi, 0
+  add rsi, 4
+  mov dword ptr [rsi], 2
+  lea rsi, [rsp+3488]
+  add rsi, 0
+  add rsi, 8
+  mov dword ptr [rsi], 3
+  lea rsi, [rsp+3488]
+  add rsi, 12
+  add rsi, 0
+  mov dword ptr [rsi], 4
+  lea rsi, [rsp+3488]
+  add rsi, 12
+  add rsi, 4
+  mov dword ptr [rsi], 5
+  lea rsi, [rsp+3488]
+  add rsi, 12
+  add rsi, 8
+  mov dword ptr [rsi], 6
+  lea rsi, [rsp+3488]
+  add rsi, 0
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+15856], rsi
+  lea rsi, [rip+.L.data.main.469]
+  mov qword ptr [rsp+15848], rsi
+  mov rsi, qword ptr [rsp+15864]
+  cmp rsi, qword ptr [rsp+15856]
+  jne .L.else.main.1316
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15848]
+  mov r9, qword ptr [rsp+15856]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1317
+.L.else.main.1316:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15848]
+  mov r9, qword ptr [rsp+15864]
+  mov r10, qword ptr [rsp+15856]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1317:
+  mov qword ptr [rsp+15888], 4
+  lea rsi, [rsp+3512]
+  add rsi, 0
+  add rsi, 0
+  mov dword ptr [rsi], 1
+  lea rsi, [rsp+3512]
+  add rsi, 0
+  add rsi, 4
+  mov dword ptr [rsi], 2
+  lea rsi, [rsp+3512]
+  add rsi, 0
+  add rsi, 8
+  mov dword ptr [rsi], 3
+  lea rsi, [rsp+3512]
+  add rsi, 12
+  add rsi, 0
+  mov dword ptr [rsi], 4
+  lea rsi, [rsp+3512]
+  add rsi, 12
+  add rsi, 4
+  mov dword ptr [rsi], 5
+  lea rsi, [rsp+3512]
+  add rsi, 12
+  add rsi, 8
+  mov dword ptr [rsi], 6
+  lea rsi, [rsp+3512]
+  add rsi, 12
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+15880], rsi
+  lea rsi, [rip+.L.data.main.470]
+  mov qword ptr [rsp+15872], rsi
+  mov rsi, qword ptr [rsp+15888]
+  cmp rsi, qword ptr [rsp+15880]
+  jne .L.else.main.1318
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15872]
+  mov r9, qword ptr [rsp+15880]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1319
+.L.else.main.1318:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15872]
+  mov r9, qword ptr [rsp+15888]
+  mov r10, qword ptr [rsp+15880]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1319:
+  mov qword ptr [rsp+15912], 6
+  lea rsi, [rsp+3536]
+  add rsi, 0
+  add rsi, 0
+  mov dword ptr [rsi], 1
+  lea rsi, [rsp+3536]
+  add rsi, 0
+  add rsi, 4
+  mov dword ptr [rsi], 2
+  lea rsi, [rsp+3536]
+  add rsi, 0
+  add rsi, 8
+  mov dword ptr [rsi], 3
+  lea rsi, [rsp+3536]
+  add rsi, 12
+  add rsi, 0
+  mov dword ptr [rsi], 4
+  lea rsi, [rsp+3536]
+  add rsi, 12
+  add rsi, 4
+  mov dword ptr [rsi], 5
+  lea rsi, [rsp+3536]
+  add rsi, 12
+  add rsi, 8
+  mov dword ptr [rsi], 6
+  lea rsi, [rsp+3536]
+  add rsi, 12
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+15904], rsi
+  lea rsi, [rip+.L.data.main.471]
+  mov qword ptr [rsp+15896], rsi
+  mov rsi, qword ptr [rsp+15912]
+  cmp rsi, qword ptr [rsp+15904]
+  jne .L.else.main.1320
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15896]
+  mov r9, qword ptr [rsp+15904]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1321
+.L.else.main.1320:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15896]
+  mov r9, qword ptr [rsp+15912]
+  mov r10, qword ptr [rsp+15904]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1321:
+  mov qword ptr [rsp+15936], 2
+  lea rsi, [rsp+3560]
+  add rsi, 0
+  add rsi, 0
+  mov dword ptr [rsi], 1
+  lea rsi, [rsp+3560]
+  add rsi, 0
+  add rsi, 4
+  mov dword ptr [rsi], 2
+  lea rsi, [rsp+3560]
+  add rsi, 0
+  add rsi, 8
+  mov dword ptr [rsi], 0
+  lea rsi, [rsp+3560]
+  add rsi, 12
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rsp+3560]
+  add rsi, 12
+  add rsi, 8
+  mov dword ptr [rsi], 0
+  lea rsi, [rsp+3560]
+  add rsi, 0
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+15928], rsi
+  lea rsi, [rip+.L.data.main.472]
+  mov qword ptr [rsp+15920], rsi
+  mov rsi, qword ptr [rsp+15936]
+  cmp rsi, qword ptr [rsp+15928]
+  jne .L.else.main.1322
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15920]
+  mov r9, qword ptr [rsp+15928]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1323
+.L.else.main.1322:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15920]
+  mov r9, qword ptr [rsp+15936]
+  mov r10, qword ptr [rsp+15928]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1323:
+  mov qword ptr [rsp+15960], 0
+  lea rsi, [rsp+3584]
+  add rsi, 0
+  add rsi, 0
+  mov dword ptr [rsi], 1
+  lea rsi, [rsp+3584]
+  add rsi, 0
+  add rsi, 4
+  mov dword ptr [rsi], 2
+  lea rsi, [rsp+3584]
+  add rsi, 0
+  add rsi, 8
+  mov dword ptr [rsi], 0
+  lea rsi, [rsp+3584]
+  add rsi, 12
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rsp+3584]
+  add rsi, 12
+  add rsi, 8
+  mov dword ptr [rsi], 0
+  lea rsi, [rsp+3584]
+  add rsi, 12
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+15952], rsi
+  lea rsi, [rip+.L.data.main.473]
+  mov qword ptr [rsp+15944], rsi
+  mov rsi, qword ptr [rsp+15960]
+  cmp rsi, qword ptr [rsp+15952]
+  jne .L.else.main.1324
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15944]
+  mov r9, qword ptr [rsp+15952]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1325
+.L.else.main.1324:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15944]
+  mov r9, qword ptr [rsp+15960]
+  mov r10, qword ptr [rsp+15952]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1325:
+  mov qword ptr [rsp+15984], 0
+  lea rsi, [rsp+3608]
+  add rsi, 0
+  add rsi, 0
+  mov dword ptr [rsi], 1
+  lea rsi, [rsp+3608]
+  add rsi, 0
+  add rsi, 4
+  mov dword ptr [rsi], 2
+  lea rsi, [rsp+3608]
+  add rsi, 0
+  add rsi, 8
+  mov dword ptr [rsi], 0
+  lea rsi, [rsp+3608]
+  add rsi, 12
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rsp+3608]
+  add rsi, 12
+  add rsi, 8
+  mov dword ptr [rsi], 0
+  lea rsi, [rsp+3608]
+  add rsi, 12
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+15976], rsi
+  lea rsi, [rip+.L.data.main.474]
+  mov qword ptr [rsp+15968], rsi
+  mov rsi, qword ptr [rsp+15984]
+  cmp rsi, qword ptr [rsp+15976]
+  jne .L.else.main.1326
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15968]
+  mov r9, qword ptr [rsp+15976]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1327
+.L.else.main.1326:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15968]
+  mov r9, qword ptr [rsp+15984]
+  mov r10, qword ptr [rsp+15976]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1327:
+  mov qword ptr [rsp+16008], 97
+  lea rsi, [rsp+3632]
+  add rsi, 0
+  mov byte ptr [rsi], 97
+  lea rsi, [rsp+3632]
+  add rsi, 1
+  mov byte ptr [rsi], 98
+  lea rsi, [rsp+3632]
+  add rsi, 2
+  mov byte ptr [rsi], 99
+  lea rsi, [rsp+3632]
+  add rsi, 3
+  mov byte ptr [rsi], 0
+  lea rsi, [rsp+3632]
+  add rsi, 0
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rsp+16000], rsi
+  lea rsi, [rip+.L.data.main.475]
+  mov qword ptr [rsp+15992], rsi
+  mov rsi, qword ptr [rsp+16008]
+  cmp rsi, qword ptr [rsp+16000]
+  jne .L.else.main.1328
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+15992]
+  mov r9, qword ptr [rsp+16000]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1329
+.L.else.main.1328:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+15992]
+  mov r9, qword ptr [rsp+16008]
+  mov r10, qword ptr [rsp+16000]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1329:
+  mov qword ptr [rsp+16032], 99
+  lea rsi, [rsp+3636]
+  add rsi, 0
+  mov byte ptr [rsi], 97
+  lea rsi, [rsp+3636]
+  add rsi, 1
+  mov byte ptr [rsi], 98
+  lea rsi, [rsp+3636]
+  add rsi, 2
+  mov byte ptr [rsi], 99
+  lea rsi, [rsp+3636]
+  add rsi, 3
+  mov byte ptr [rsi], 0
+  lea rsi, [rsp+3636]
+  add rsi, 2
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rsp+16024], rsi
+  lea rsi, [rip+.L.data.main.476]
+  mov qword ptr [rsp+16016], rsi
+  mov rsi, qword ptr [rsp+16032]
+  cmp rsi, qword ptr [rsp+16024]
+  jne .L.else.main.1330
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16016]
+  mov r9, qword ptr [rsp+16024]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1331
+.L.else.main.1330:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16016]
+  mov r9, qword ptr [rsp+16032]
+  mov r10, qword ptr [rsp+16024]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1331:
+  mov qword ptr [rsp+16056], 0
+  lea rsi, [rsp+3640]
+  add rsi, 0
+  mov byte ptr [rsi], 97
+  lea rsi, [rsp+3640]
+  add rsi, 1
+  mov byte ptr [rsi], 98
+  lea rsi, [rsp+3640]
+  add rsi, 2
+  mov byte ptr [rsi], 99
+  lea rsi, [rsp+3640]
+  add rsi, 3
+  mov byte ptr [rsi], 0
+  lea rsi, [rsp+3640]
+  add rsi, 3
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rsp+16048], rsi
+  lea rsi, [rip+.L.data.main.477]
+  mov qword ptr [rsp+16040], rsi
+  mov rsi, qword ptr [rsp+16056]
+  cmp rsi, qword ptr [rsp+16048]
+  jne .L.else.main.1332
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16040]
+  mov r9, qword ptr [rsp+16048]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1333
+.L.else.main.1332:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16040]
+  mov r9, qword ptr [rsp+16056]
+  mov r10, qword ptr [rsp+16048]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1333:
+  mov qword ptr [rsp+16080], 97
+  lea rsi, [rsp+3644]
+  add rsi, 0
+  add rsi, 0
+  mov byte ptr [rsi], 97
+  lea rsi, [rsp+3644]
+  add rsi, 0
+  add rsi, 1
+  mov byte ptr [rsi], 98
+  lea rsi, [rsp+3644]
+  add rsi, 0
+  add rsi, 2
+  mov byte ptr [rsi], 99
+  lea rsi, [rsp+3644]
+  add rsi, 0
+  add rsi, 3
+  mov byte ptr [rsi], 0
+  lea rsi, [rsp+3644]
+  add rsi, 4
+  add rsi, 0
+  mov byte ptr [rsi], 100
+  lea rsi, [rsp+3644]
+  add rsi, 4
+  add rsi, 1
+  mov byte ptr [rsi], 101
+  lea rsi, [rsp+3644]
+  add rsi, 4
+  add rsi, 2
+  mov byte ptr [rsi], 102
+  lea rsi, [rsp+3644]
+  add rsi, 4
+  add rsi, 3
+  mov byte ptr [rsi], 0
+  lea rsi, [rsp+3644]
+  add rsi, 0
+  add rsi, 0
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rsp+16072], rsi
+  lea rsi, [rip+.L.data.main.478]
+  mov qword ptr [rsp+16064], rsi
+  mov rsi, qword ptr [rsp+16080]
+  cmp rsi, qword ptr [rsp+16072]
+  jne .L.else.main.1334
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16064]
+  mov r9, qword ptr [rsp+16072]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1335
+.L.else.main.1334:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16064]
+  mov r9, qword ptr [rsp+16080]
+  mov r10, qword ptr [rsp+16072]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1335:
+  mov qword ptr [rsp+16104], 0
+  lea rsi, [rsp+3652]
+  add rsi, 0
+  add rsi, 0
+  mov byte ptr [rsi], 97
+  lea rsi, [rsp+3652]
+  add rsi, 0
+  add rsi, 1
+  mov byte ptr [rsi], 98
+  lea rsi, [rsp+3652]
+  add rsi, 0
+  add rsi, 2
+  mov byte ptr [rsi], 99
+  lea rsi, [rsp+3652]
+  add rsi, 0
+  add rsi, 3
+  mov byte ptr [rsi], 0
+  lea rsi, [rsp+3652]
+  add rsi, 4
+  add rsi, 0
+  mov byte ptr [rsi], 100
+  lea rsi, [rsp+3652]
+  add rsi, 4
+  add rsi, 1
+  mov byte ptr [rsi], 101
+  lea rsi, [rsp+3652]
+  add rsi, 4
+  add rsi, 2
+  mov byte ptr [rsi], 102
+  lea rsi, [rsp+3652]
+  add rsi, 4
+  add rsi, 3
+  mov byte ptr [rsi], 0
+  lea rsi, [rsp+3652]
+  add rsi, 0
+  add rsi, 3
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rsp+16096], rsi
+  lea rsi, [rip+.L.data.main.479]
+  mov qword ptr [rsp+16088], rsi
+  mov rsi, qword ptr [rsp+16104]
+  cmp rsi, qword ptr [rsp+16096]
+  jne .L.else.main.1336
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16088]
+  mov r9, qword ptr [rsp+16096]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1337
+.L.else.main.1336:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16088]
+  mov r9, qword ptr [rsp+16104]
+  mov r10, qword ptr [rsp+16096]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1337:
+  mov qword ptr [rsp+16128], 100
+  lea rsi, [rsp+3660]
+  add rsi, 0
+  add rsi, 0
+  mov byte ptr [rsi], 97
+  lea rsi, [rsp+3660]
+  add rsi, 0
+  add rsi, 1
+  mov byte ptr [rsi], 98
+  lea rsi, [rsp+3660]
+  add rsi, 0
+  add rsi, 2
+  mov byte ptr [rsi], 99
+  lea rsi, [rsp+3660]
+  add rsi, 0
+  add rsi, 3
+  mov byte ptr [rsi], 0
+  lea rsi, [rsp+3660]
+  add rsi, 4
+  add rsi, 0
+  mov byte ptr [rsi], 100
+  lea rsi, [rsp+3660]
+  add rsi, 4
+  add rsi, 1
+  mov byte ptr [rsi], 101
+  lea rsi, [rsp+3660]
+  add rsi, 4
+  add rsi, 2
+  mov byte ptr [rsi], 102
+  lea rsi, [rsp+3660]
+  add rsi, 4
+  add rsi, 3
+  mov byte ptr [rsi], 0
+  lea rsi, [rsp+3660]
+  add rsi, 4
+  add rsi, 0
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rsp+16120], rsi
+  lea rsi, [rip+.L.data.main.480]
+  mov qword ptr [rsp+16112], rsi
+  mov rsi, qword ptr [rsp+16128]
+  cmp rsi, qword ptr [rsp+16120]
+  jne .L.else.main.1338
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16112]
+  mov r9, qword ptr [rsp+16120]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1339
+.L.else.main.1338:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16112]
+  mov r9, qword ptr [rsp+16128]
+  mov r10, qword ptr [rsp+16120]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1339:
+  mov qword ptr [rsp+16152], 102
+  lea rsi, [rsp+3668]
+  add rsi, 0
+  add rsi, 0
+  mov byte ptr [rsi], 97
+  lea rsi, [rsp+3668]
+  add rsi, 0
+  add rsi, 1
+  mov byte ptr [rsi], 98
+  lea rsi, [rsp+3668]
+  add rsi, 0
+  add rsi, 2
+  mov byte ptr [rsi], 99
+  lea rsi, [rsp+3668]
+  add rsi, 0
+  add rsi, 3
+  mov byte ptr [rsi], 0
+  lea rsi, [rsp+3668]
+  add rsi, 4
+  add rsi, 0
+  mov byte ptr [rsi], 100
+  lea rsi, [rsp+3668]
+  add rsi, 4
+  add rsi, 1
+  mov byte ptr [rsi], 101
+  lea rsi, [rsp+3668]
+  add rsi, 4
+  add rsi, 2
+  mov byte ptr [rsi], 102
+  lea rsi, [rsp+3668]
+  add rsi, 4
+  add rsi, 3
+  mov byte ptr [rsi], 0
+  lea rsi, [rsp+3668]
+  add rsi, 4
+  add rsi, 2
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rsp+16144], rsi
+  lea rsi, [rip+.L.data.main.481]
+  mov qword ptr [rsp+16136], rsi
+  mov rsi, qword ptr [rsp+16152]
+  cmp rsi, qword ptr [rsp+16144]
+  jne .L.else.main.1340
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16136]
+  mov r9, qword ptr [rsp+16144]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1341
+.L.else.main.1340:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16136]
+  mov r9, qword ptr [rsp+16152]
+  mov r10, qword ptr [rsp+16144]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1341:
+  mov qword ptr [rsp+16176], 4
+  lea rsi, [rsp+3676]
+  add rsi, 0
+  mov dword ptr [rsi], 1
+  lea rsi, [rsp+3676]
+  add rsi, 4
+  mov dword ptr [rsi], 2
+  lea rsi, [rsp+3676]
+  add rsi, 8
+  mov dword ptr [rsi], 3
+  lea rsi, [rsp+3676]
+  add rsi, 12
+  mov dword ptr [rsi], 4
+  lea rsi, [rsp+3676]
+  add rsi, 12
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+16168], rsi
+  lea rsi, [rip+.L.data.main.482]
+  mov qword ptr [rsp+16160], rsi
+  mov rsi, qword ptr [rsp+16176]
+  cmp rsi, qword ptr [rsp+16168]
+  jne .L.else.main.1342
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16160]
+  mov r9, qword ptr [rsp+16168]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1343
+.L.else.main.1342:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16160]
+  mov r9, qword ptr [rsp+16176]
+  mov r10, qword ptr [rsp+16168]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1343:
+  mov qword ptr [rsp+16200], 16
+  lea rsi, [rsp+3692]
+  add rsi, 0
+  mov dword ptr [rsi], 1
+  lea rsi, [rsp+3692]
+  add rsi, 4
+  mov dword ptr [rsi], 2
+  lea rsi, [rsp+3692]
+  add rsi, 8
+  mov dword ptr [rsi], 3
+  lea rsi, [rsp+3692]
+  add rsi, 12
+  mov dword ptr [rsi], 4
+  mov qword ptr [rsp+16192], 16
+  lea rsi, [rip+.L.data.main.483]
+  mov qword ptr [rsp+16184], rsi
+  mov rsi, qword ptr [rsp+16200]
+  cmp rsi, qword ptr [rsp+16192]
+  jne .L.else.main.1344
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16184]
+  mov r9, qword ptr [rsp+16192]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1345
+.L.else.main.1344:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16184]
+  mov r9, qword ptr [rsp+16200]
+  mov r10, qword ptr [rsp+16192]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1345:
+  mov qword ptr [rsp+16224], 4
+  lea rsi, [rsp+3708]
+  add rsi, 0
+  mov byte ptr [rsi], 102
+  lea rsi, [rsp+3708]
+  add rsi, 1
+  mov byte ptr [rsi], 111
+  lea rsi, [rsp+3708]
+  add rsi, 2
+  mov byte ptr [rsi], 111
+  lea rsi, [rsp+3708]
+  add rsi, 3
+  mov byte ptr [rsi], 0
+  mov qword ptr [rsp+16216], 4
+  lea rsi, [rip+.L.data.main.484]
+  mov qword ptr [rsp+16208], rsi
+  mov rsi, qword ptr [rsp+16224]
+  cmp rsi, qword ptr [rsp+16216]
+  jne .L.else.main.1346
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16208]
+  mov r9, qword ptr [rsp+16216]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1347
+.L.else.main.1346:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16208]
+  mov r9, qword ptr [rsp+16224]
+  mov r10, qword ptr [rsp+16216]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1347:
+  mov qword ptr [rsp+16248], 1
+  mov dword ptr [rsp+3712], 1
+  mov dword ptr [rsp+3716], 2
+  mov dword ptr [rsp+3720], 3
+  movsxd rsi, dword ptr [rsp+3712]
+  mov qword ptr [rsp+16240], rsi
+  lea rsi, [rip+.L.data.main.485]
+  mov qword ptr [rsp+16232], rsi
+  mov rsi, qword ptr [rsp+16248]
+  cmp rsi, qword ptr [rsp+16240]
+  jne .L.else.main.1348
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16232]
+  mov r9, qword ptr [rsp+16240]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1349
+.L.else.main.1348:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16232]
+  mov r9, qword ptr [rsp+16248]
+  mov r10, qword ptr [rsp+16240]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1349:
+  mov qword ptr [rsp+16272], 2
+  mov dword ptr [rsp+3724], 1
+  mov dword ptr [rsp+3728], 2
+  mov dword ptr [rsp+3732], 3
+  movsxd rsi, dword ptr [rsp+3728]
+  mov qword ptr [rsp+16264], rsi
+  lea rsi, [rip+.L.data.main.486]
+  mov qword ptr [rsp+16256], rsi
+  mov rsi, qword ptr [rsp+16272]
+  cmp rsi, qword ptr [rsp+16264]
+  jne .L.else.main.1350
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16256]
+  mov r9, qword ptr [rsp+16264]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1351
+.L.else.main.1350:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16256]
+  mov r9, qword ptr [rsp+16272]
+  mov r10, qword ptr [rsp+16264]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1351:
+  mov qword ptr [rsp+16296], 3
+  mov dword ptr [rsp+3736], 1
+  mov dword ptr [rsp+3740], 2
+  mov dword ptr [rsp+3744], 3
+  movsxd rsi, dword ptr [rsp+3744]
+  mov qword ptr [rsp+16288], rsi
+  lea rsi, [rip+.L.data.main.487]
+  mov qword ptr [rsp+16280], rsi
+  mov rsi, qword ptr [rsp+16296]
+  cmp rsi, qword ptr [rsp+16288]
+  jne .L.else.main.1352
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16280]
+  mov r9, qword ptr [rsp+16288]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1353
+.L.else.main.1352:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16280]
+  mov r9, qword ptr [rsp+16296]
+  mov r10, qword ptr [rsp+16288]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1353:
+  mov qword ptr [rsp+16320], 1
+  mov dword ptr [rsp+3748], 1
+  mov dword ptr [rsp+3752], 0
+  mov dword ptr [rsp+3756], 0
+  movsxd rsi, dword ptr [rsp+3748]
+  mov qword ptr [rsp+16312], rsi
+  lea rsi, [rip+.L.data.main.488]
+  mov qword ptr [rsp+16304], rsi
+  mov rsi, qword ptr [rsp+16320]
+  cmp rsi, qword ptr [rsp+16312]
+  jne .L.else.main.1354
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16304]
+  mov r9, qword ptr [rsp+16312]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1355
+.L.else.main.1354:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16304]
+  mov r9, qword ptr [rsp+16320]
+  mov r10, qword ptr [rsp+16312]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1355:
+  mov qword ptr [rsp+16344], 0
+  mov dword ptr [rsp+3760], 1
+  mov dword ptr [rsp+3764], 0
+  mov dword ptr [rsp+3768], 0
+  movsxd rsi, dword ptr [rsp+3764]
+  mov qword ptr [rsp+16336], rsi
+  lea rsi, [rip+.L.data.main.489]
+  mov qword ptr [rsp+16328], rsi
+  mov rsi, qword ptr [rsp+16344]
+  cmp rsi, qword ptr [rsp+16336]
+  jne .L.else.main.1356
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16328]
+  mov r9, qword ptr [rsp+16336]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1357
+.L.else.main.1356:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16328]
+  mov r9, qword ptr [rsp+16344]
+  mov r10, qword ptr [rsp+16336]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1357:
+  mov qword ptr [rsp+16368], 0
+  mov dword ptr [rsp+3772], 1
+  mov dword ptr [rsp+3776], 0
+  mov dword ptr [rsp+3780], 0
+  movsxd rsi, dword ptr [rsp+3780]
+  mov qword ptr [rsp+16360], rsi
+  lea rsi, [rip+.L.data.main.490]
+  mov qword ptr [rsp+16352], rsi
+  mov rsi, qword ptr [rsp+16368]
+  cmp rsi, qword ptr [rsp+16360]
+  jne .L.else.main.1358
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16352]
+  mov r9, qword ptr [rsp+16360]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1359
+.L.else.main.1358:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16352]
+  mov r9, qword ptr [rsp+16368]
+  mov r10, qword ptr [rsp+16360]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1359:
+  mov qword ptr [rsp+16392], 1
+  lea rsi, [rsp+3784]
+  add rsi, 0
+  mov dword ptr [rsi], 1
+  lea rsi, [rsp+3784]
+  add rsi, 0
+  mov dword ptr [rsi+4], 2
+  lea rsi, [rsp+3784]
+  add rsi, 8
+  mov dword ptr [rsi], 3
+  lea rsi, [rsp+3784]
+  add rsi, 8
+  mov dword ptr [rsi+4], 4
+  lea rsi, [rsp+3784]
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+16384], rsi
+  lea rsi, [rip+.L.data.main.491]
+  mov qword ptr [rsp+16376], rsi
+  mov rsi, qword ptr [rsp+16392]
+  cmp rsi, qword ptr [rsp+16384]
+  jne .L.else.main.1360
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16376]
+  mov r9, qword ptr [rsp+16384]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1361
+.L.else.main.1360:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16376]
+  mov r9, qword ptr [rsp+16392]
+  mov r10, qword ptr [rsp+16384]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1361:
+  mov qword ptr [rsp+16416], 2
+  lea rsi, [rsp+3800]
+  add rsi, 0
+  mov dword ptr [rsi], 1
+  lea rsi, [rsp+3800]
+  add rsi, 0
+  mov dword ptr [rsi+4], 2
+  lea rsi, [rsp+3800]
+  add rsi, 8
+  mov dword ptr [rsi], 3
+  lea rsi, [rsp+3800]
+  add rsi, 8
+  mov dword ptr [rsi+4], 4
+  lea rsi, [rsp+3800]
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi+4]
+  mov qword ptr [rsp+16408], rsi
+  lea rsi, [rip+.L.data.main.492]
+  mov qword ptr [rsp+16400], rsi
+  mov rsi, qword ptr [rsp+16416]
+  cmp rsi, qword ptr [rsp+16408]
+  jne .L.else.main.1362
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16400]
+  mov r9, qword ptr [rsp+16408]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1363
+.L.else.main.1362:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16400]
+  mov r9, qword ptr [rsp+16416]
+  mov r10, qword ptr [rsp+16408]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1363:
+  mov qword ptr [rsp+16440], 3
+  lea rsi, [rsp+3816]
+  add rsi, 0
+  mov dword ptr [rsi], 1
+  lea rsi, [rsp+3816]
+  add rsi, 0
+  mov dword ptr [rsi+4], 2
+  lea rsi, [rsp+3816]
+  add rsi, 8
+  mov dword ptr [rsi], 3
+  lea rsi, [rsp+3816]
+  add rsi, 8
+  mov dword ptr [rsi+4], 4
+  lea rsi, [rsp+3816]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+16432], rsi
+  lea rsi, [rip+.L.data.main.493]
+  mov qword ptr [rsp+16424], rsi
+  mov rsi, qword ptr [rsp+16440]
+  cmp rsi, qword ptr [rsp+16432]
+  jne .L.else.main.1364
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16424]
+  mov r9, qword ptr [rsp+16432]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1365
+.L.else.main.1364:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16424]
+  mov r9, qword ptr [rsp+16440]
+  mov r10, qword ptr [rsp+16432]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1365:
+  mov qword ptr [rsp+16464], 4
+  lea rsi, [rsp+3832]
+  add rsi, 0
+  mov dword ptr [rsi], 1
+  lea rsi, [rsp+3832]
+  add rsi, 0
+  mov dword ptr [rsi+4], 2
+  lea rsi, [rsp+3832]
+  add rsi, 8
+  mov dword ptr [rsi], 3
+  lea rsi, [rsp+3832]
+  add rsi, 8
+  mov dword ptr [rsi+4], 4
+  lea rsi, [rsp+3832]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi+4]
+  mov qword ptr [rsp+16456], rsi
+  lea rsi, [rip+.L.data.main.494]
+  mov qword ptr [rsp+16448], rsi
+  mov rsi, qword ptr [rsp+16464]
+  cmp rsi, qword ptr [rsp+16456]
+  jne .L.else.main.1366
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16448]
+  mov r9, qword ptr [rsp+16456]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1367
+.L.else.main.1366:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16448]
+  mov r9, qword ptr [rsp+16464]
+  mov r10, qword ptr [rsp+16456]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1367:
+  mov qword ptr [rsp+16488], 0
+  lea rsi, [rsp+3848]
+  add rsi, 0
+  mov dword ptr [rsi], 1
+  lea rsi, [rsp+3848]
+  add rsi, 0
+  mov dword ptr [rsi+4], 2
+  lea rsi, [rsp+3848]
+  add rsi, 8
+  mov qword ptr [rsi], 0
+  lea rsi, [rsp+3848]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi+4]
+  mov qword ptr [rsp+16480], rsi
+  lea rsi, [rip+.L.data.main.495]
+  mov qword ptr [rsp+16472], rsi
+  mov rsi, qword ptr [rsp+16488]
+  cmp rsi, qword ptr [rsp+16480]
+  jne .L.else.main.1368
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16472]
+  mov r9, qword ptr [rsp+16480]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1369
+.L.else.main.1368:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16472]
+  mov r9, qword ptr [rsp+16488]
+  mov r10, qword ptr [rsp+16480]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1369:
+  mov qword ptr [rsp+16512], 0
+  mov dword ptr [rsp+3864], 0
+  mov dword ptr [rsp+3868], 0
+  movsxd rsi, dword ptr [rsp+3864]
+  mov qword ptr [rsp+16504], rsi
+  lea rsi, [rip+.L.data.main.496]
+  mov qword ptr [rsp+16496], rsi
+  mov rsi, qword ptr [rsp+16512]
+  cmp rsi, qword ptr [rsp+16504]
+  jne .L.else.main.1370
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16496]
+  mov r9, qword ptr [rsp+16504]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1371
+.L.else.main.1370:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16496]
+  mov r9, qword ptr [rsp+16512]
+  mov r10, qword ptr [rsp+16504]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1371:
+  mov qword ptr [rsp+16536], 0
+  mov dword ptr [rsp+3872], 0
+  mov dword ptr [rsp+3876], 0
+  movsxd rsi, dword ptr [rsp+3876]
+  mov qword ptr [rsp+16528], rsi
+  lea rsi, [rip+.L.data.main.497]
+  mov qword ptr [rsp+16520], rsi
+  mov rsi, qword ptr [rsp+16536]
+  cmp rsi, qword ptr [rsp+16528]
+  jne .L.else.main.1372
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16520]
+  mov r9, qword ptr [rsp+16528]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1373
+.L.else.main.1372:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16520]
+  mov r9, qword ptr [rsp+16536]
+  mov r10, qword ptr [rsp+16528]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1373:
+  mov qword ptr [rsp+16560], 3
+  movsx rsi, byte ptr [rip+g3]
+  mov qword ptr [rsp+16552], rsi
+  lea rsi, [rip+.L.data.main.498]
+  mov qword ptr [rsp+16544], rsi
+  mov rsi, qword ptr [rsp+16560]
+  cmp rsi, qword ptr [rsp+16552]
+  jne .L.else.main.1374
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16544]
+  mov r9, qword ptr [rsp+16552]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1375
+.L.else.main.1374:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16544]
+  mov r9, qword ptr [rsp+16560]
+  mov r10, qword ptr [rsp+16552]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1375:
+  mov qword ptr [rsp+16584], 4
+  movsx rsi, word ptr [rip+g4]
+  mov qword ptr [rsp+16576], rsi
+  lea rsi, [rip+.L.data.main.499]
+  mov qword ptr [rsp+16568], rsi
+  mov rsi, qword ptr [rsp+16584]
+  cmp rsi, qword ptr [rsp+16576]
+  jne .L.else.main.1376
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16568]
+  mov r9, qword ptr [rsp+16576]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1377
+.L.else.main.1376:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16568]
+  mov r9, qword ptr [rsp+16584]
+  mov r10, qword ptr [rsp+16576]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1377:
+  mov qword ptr [rsp+16608], 5
+  movsxd rsi, dword ptr [rip+g5]
+  mov qword ptr [rsp+16600], rsi
+  lea rsi, [rip+.L.data.main.500]
+  mov qword ptr [rsp+16592], rsi
+  mov rsi, qword ptr [rsp+16608]
+  cmp rsi, qword ptr [rsp+16600]
+  jne .L.else.main.1378
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16592]
+  mov r9, qword ptr [rsp+16600]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1379
+.L.else.main.1378:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16592]
+  mov r9, qword ptr [rsp+16608]
+  mov r10, qword ptr [rsp+16600]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1379:
+  mov qword ptr [rsp+16632], 6
+  mov rsi, qword ptr [rip+g6]
+  mov qword ptr [rsp+16624], rsi
+  lea rsi, [rip+.L.data.main.501]
+  mov qword ptr [rsp+16616], rsi
+  mov rsi, qword ptr [rsp+16632]
+  cmp rsi, qword ptr [rsp+16624]
+  jne .L.else.main.1380
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16616]
+  mov r9, qword ptr [rsp+16624]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1381
+.L.else.main.1380:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16616]
+  mov r9, qword ptr [rsp+16632]
+  mov r10, qword ptr [rsp+16624]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1381:
+  mov qword ptr [rsp+16656], 5
+  mov rsi, qword ptr [rip+g7]
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+16648], rsi
+  lea rsi, [rip+.L.data.main.502]
+  mov qword ptr [rsp+16640], rsi
+  mov rsi, qword ptr [rsp+16656]
+  cmp rsi, qword ptr [rsp+16648]
+  jne .L.else.main.1382
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16640]
+  mov r9, qword ptr [rsp+16648]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1383
+.L.else.main.1382:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16640]
+  mov r9, qword ptr [rsp+16656]
+  mov r10, qword ptr [rsp+16648]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1383:
+  mov qword ptr [rsp+16680], 0
+  mov rsi, qword ptr [rip+g8]
+  lea r8, [rip+.L.data.main.503]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov qword ptr [rsp+16672], rax
+  lea rsi, [rip+.L.data.main.504]
+  mov qword ptr [rsp+16664], rsi
+  mov rsi, qword ptr [rsp+16680]
+  cmp rsi, qword ptr [rsp+16672]
+  jne .L.else.main.1384
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16664]
+  mov r9, qword ptr [rsp+16672]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1385
+.L.else.main.1384:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16664]
+  mov r9, qword ptr [rsp+16680]
+  mov r10, qword ptr [rsp+16672]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1385:
+  mov qword ptr [rsp+16704], 0
+  lea rsi, [rip+g9]
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+16696], rsi
+  lea rsi, [rip+.L.data.main.505]
+  mov qword ptr [rsp+16688], rsi
+  mov rsi, qword ptr [rsp+16704]
+  cmp rsi, qword ptr [rsp+16696]
+  jne .L.else.main.1386
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16688]
+  mov r9, qword ptr [rsp+16696]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1387
+.L.else.main.1386:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16688]
+  mov r9, qword ptr [rsp+16704]
+  mov r10, qword ptr [rsp+16696]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1387:
+  mov qword ptr [rsp+16728], 1
+  lea rsi, [rip+g9]
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+16720], rsi
+  lea rsi, [rip+.L.data.main.506]
+  mov qword ptr [rsp+16712], rsi
+  mov rsi, qword ptr [rsp+16728]
+  cmp rsi, qword ptr [rsp+16720]
+  jne .L.else.main.1388
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16712]
+  mov r9, qword ptr [rsp+16720]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1389
+.L.else.main.1388:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16712]
+  mov r9, qword ptr [rsp+16728]
+  mov r10, qword ptr [rsp+16720]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1389:
+  mov qword ptr [rsp+16752], 2
+  lea rsi, [rip+g9]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+16744], rsi
+  lea rsi, [rip+.L.data.main.507]
+  mov qword ptr [rsp+16736], rsi
+  mov rsi, qword ptr [rsp+16752]
+  cmp rsi, qword ptr [rsp+16744]
+  jne .L.else.main.1390
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16736]
+  mov r9, qword ptr [rsp+16744]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1391
+.L.else.main.1390:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16736]
+  mov r9, qword ptr [rsp+16752]
+  mov r10, qword ptr [rsp+16744]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1391:
+  mov qword ptr [rsp+16776], 0
+  lea rsi, [rip+g10]
+  add rsi, 0
+  mov rsi, qword ptr [rsi]
+  lea r8, [rip+.L.data.main.508]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov qword ptr [rsp+16768], rax
+  lea rsi, [rip+.L.data.main.509]
+  mov qword ptr [rsp+16760], rsi
+  mov rsi, qword ptr [rsp+16776]
+  cmp rsi, qword ptr [rsp+16768]
+  jne .L.else.main.1392
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16760]
+  mov r9, qword ptr [rsp+16768]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1393
+.L.else.main.1392:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16760]
+  mov r9, qword ptr [rsp+16776]
+  mov r10, qword ptr [rsp+16768]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1393:
+  mov qword ptr [rsp+16800], 0
+  lea rsi, [rip+g10]
+  add rsi, 8
+  mov rsi, qword ptr [rsi]
+  lea r8, [rip+.L.data.main.510]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov qword ptr [rsp+16792], rax
+  lea rsi, [rip+.L.data.main.511]
+  mov qword ptr [rsp+16784], rsi
+  mov rsi, qword ptr [rsp+16800]
+  cmp rsi, qword ptr [rsp+16792]
+  jne .L.else.main.1394
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16784]
+  mov r9, qword ptr [rsp+16792]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1395
+.L.else.main.1394:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16784]
+  mov r9, qword ptr [rsp+16800]
+  mov r10, qword ptr [rsp+16792]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1395:
+  mov qword ptr [rsp+16824], 0
+  lea rsi, [rip+g10]
+  add rsi, 8
+  mov rsi, qword ptr [rsi]
+  add rsi, 3
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rsp+16816], rsi
+  lea rsi, [rip+.L.data.main.512]
+  mov qword ptr [rsp+16808], rsi
+  mov rsi, qword ptr [rsp+16824]
+  cmp rsi, qword ptr [rsp+16816]
+  jne .L.else.main.1396
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16808]
+  mov r9, qword ptr [rsp+16816]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1397
+.L.else.main.1396:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16808]
+  mov r9, qword ptr [rsp+16824]
+  mov r10, qword ptr [rsp+16816]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1397:
+  mov qword ptr [rsp+16848], 2
+  mov rsi, 16
+  mov rdi, rsi
+  sar rdi, 63
+  and rdi, 7
+  add rsi, rdi
+  sar rsi, 3
+  mov qword ptr [rsp+16840], rsi
+  lea rsi, [rip+.L.data.main.513]
+  mov qword ptr [rsp+16832], rsi
+  mov rsi, qword ptr [rsp+16848]
+  cmp rsi, qword ptr [rsp+16840]
+  jne .L.else.main.1398
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16832]
+  mov r9, qword ptr [rsp+16840]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1399
+.L.else.main.1398:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16832]
+  mov r9, qword ptr [rsp+16848]
+  mov r10, qword ptr [rsp+16840]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1399:
+  mov qword ptr [rsp+16872], 1
+  lea rsi, [rip+g11]
+  add rsi, 0
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rsp+16864], rsi
+  lea rsi, [rip+.L.data.main.514]
+  mov qword ptr [rsp+16856], rsi
+  mov rsi, qword ptr [rsp+16872]
+  cmp rsi, qword ptr [rsp+16864]
+  jne .L.else.main.1400
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16856]
+  mov r9, qword ptr [rsp+16864]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1401
+.L.else.main.1400:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16856]
+  mov r9, qword ptr [rsp+16872]
+  mov r10, qword ptr [rsp+16864]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1401:
+  mov qword ptr [rsp+16896], 2
+  lea rsi, [rip+g11]
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi+4]
+  mov qword ptr [rsp+16888], rsi
+  lea rsi, [rip+.L.data.main.515]
+  mov qword ptr [rsp+16880], rsi
+  mov rsi, qword ptr [rsp+16896]
+  cmp rsi, qword ptr [rsp+16888]
+  jne .L.else.main.1402
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16880]
+  mov r9, qword ptr [rsp+16888]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1403
+.L.else.main.1402:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16880]
+  mov r9, qword ptr [rsp+16896]
+  mov r10, qword ptr [rsp+16888]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1403:
+  mov qword ptr [rsp+16920], 3
+  lea rsi, [rip+g11]
+  add rsi, 8
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rsp+16912], rsi
+  lea rsi, [rip+.L.data.main.516]
+  mov qword ptr [rsp+16904], rsi
+  mov rsi, qword ptr [rsp+16920]
+  cmp rsi, qword ptr [rsp+16912]
+  jne .L.else.main.1404
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16904]
+  mov r9, qword ptr [rsp+16912]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1405
+.L.else.main.1404:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16904]
+  mov r9, qword ptr [rsp+16920]
+  mov r10, qword ptr [rsp+16912]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1405:
+  mov qword ptr [rsp+16944], 4
+  lea rsi, [rip+g11]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi+4]
+  mov qword ptr [rsp+16936], rsi
+  lea rsi, [rip+.L.data.main.517]
+  mov qword ptr [rsp+16928], rsi
+  mov rsi, qword ptr [rsp+16944]
+  cmp rsi, qword ptr [rsp+16936]
+  jne .L.else.main.1406
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16928]
+  mov r9, qword ptr [rsp+16936]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1407
+.L.else.main.1406:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16928]
+  mov r9, qword ptr [rsp+16944]
+  mov r10, qword ptr [rsp+16936]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1407:
+  mov qword ptr [rsp+16968], 1
+  lea rsi, [rip+g12]
+  add rsi, 0
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+16960], rsi
+  lea rsi, [rip+.L.data.main.518]
+  mov qword ptr [rsp+16952], rsi
+  mov rsi, qword ptr [rsp+16968]
+  cmp rsi, qword ptr [rsp+16960]
+  jne .L.else.main.1408
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16952]
+  mov r9, qword ptr [rsp+16960]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1409
+.L.else.main.1408:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16952]
+  mov r9, qword ptr [rsp+16968]
+  mov r10, qword ptr [rsp+16960]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1409:
+  mov qword ptr [rsp+16992], 2
+  lea rsi, [rip+g12]
+  add rsi, 0
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+16984], rsi
+  lea rsi, [rip+.L.data.main.519]
+  mov qword ptr [rsp+16976], rsi
+  mov rsi, qword ptr [rsp+16992]
+  cmp rsi, qword ptr [rsp+16984]
+  jne .L.else.main.1410
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+16976]
+  mov r9, qword ptr [rsp+16984]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1411
+.L.else.main.1410:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+16976]
+  mov r9, qword ptr [rsp+16992]
+  mov r10, qword ptr [rsp+16984]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1411:
+  mov qword ptr [rsp+17016], 0
+  lea rsi, [rip+g12]
+  add rsi, 8
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+17008], rsi
+  lea rsi, [rip+.L.data.main.520]
+  mov qword ptr [rsp+17000], rsi
+  mov rsi, qword ptr [rsp+17016]
+  cmp rsi, qword ptr [rsp+17008]
+  jne .L.else.main.1412
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17000]
+  mov r9, qword ptr [rsp+17008]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1413
+.L.else.main.1412:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17000]
+  mov r9, qword ptr [rsp+17016]
+  mov r10, qword ptr [rsp+17008]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1413:
+  mov qword ptr [rsp+17040], 0
+  lea rsi, [rip+g12]
+  add rsi, 8
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+17032], rsi
+  lea rsi, [rip+.L.data.main.521]
+  mov qword ptr [rsp+17024], rsi
+  mov rsi, qword ptr [rsp+17040]
+  cmp rsi, qword ptr [rsp+17032]
+  jne .L.else.main.1414
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17024]
+  mov r9, qword ptr [rsp+17032]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1415
+.L.else.main.1414:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17024]
+  mov r9, qword ptr [rsp+17040]
+  mov r10, qword ptr [rsp+17032]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1415:
+  mov qword ptr [rsp+17064], 1
+  lea rsi, [rip+g13]
+  add rsi, 0
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+17056], rsi
+  lea rsi, [rip+.L.data.main.522]
+  mov qword ptr [rsp+17048], rsi
+  mov rsi, qword ptr [rsp+17064]
+  cmp rsi, qword ptr [rsp+17056]
+  jne .L.else.main.1416
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17048]
+  mov r9, qword ptr [rsp+17056]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1417
+.L.else.main.1416:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17048]
+  mov r9, qword ptr [rsp+17064]
+  mov r10, qword ptr [rsp+17056]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1417:
+  mov qword ptr [rsp+17088], 2
+  lea rsi, [rip+g13]
+  add rsi, 0
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+17080], rsi
+  lea rsi, [rip+.L.data.main.523]
+  mov qword ptr [rsp+17072], rsi
+  mov rsi, qword ptr [rsp+17088]
+  cmp rsi, qword ptr [rsp+17080]
+  jne .L.else.main.1418
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17072]
+  mov r9, qword ptr [rsp+17080]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1419
+.L.else.main.1418:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17072]
+  mov r9, qword ptr [rsp+17088]
+  mov r10, qword ptr [rsp+17080]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1419:
+  mov qword ptr [rsp+17112], 3
+  lea rsi, [rip+g13]
+  add rsi, 8
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+17104], rsi
+  lea rsi, [rip+.L.data.main.524]
+  mov qword ptr [rsp+17096], rsi
+  mov rsi, qword ptr [rsp+17112]
+  cmp rsi, qword ptr [rsp+17104]
+  jne .L.else.main.1420
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17096]
+  mov r9, qword ptr [rsp+17104]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1421
+.L.else.main.1420:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17096]
+  mov r9, qword ptr [rsp+17112]
+  mov r10, qword ptr [rsp+17104]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1421:
+  mov qword ptr [rsp+17136], 4
+  lea rsi, [rip+g13]
+  add rsi, 8
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+17128], rsi
+  lea rsi, [rip+.L.data.main.525]
+  mov qword ptr [rsp+17120], rsi
+  mov rsi, qword ptr [rsp+17136]
+  cmp rsi, qword ptr [rsp+17128]
+  jne .L.else.main.1422
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17120]
+  mov r9, qword ptr [rsp+17128]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1423
+.L.else.main.1422:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17120]
+  mov r9, qword ptr [rsp+17136]
+  mov r10, qword ptr [rsp+17128]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1423:
+  mov qword ptr [rsp+17160], 1
+  lea rsi, [rip+g14]
+  add rsi, 0
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+17152], rsi
+  lea rsi, [rip+.L.data.main.526]
+  mov qword ptr [rsp+17144], rsi
+  mov rsi, qword ptr [rsp+17160]
+  cmp rsi, qword ptr [rsp+17152]
+  jne .L.else.main.1424
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17144]
+  mov r9, qword ptr [rsp+17152]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1425
+.L.else.main.1424:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17144]
+  mov r9, qword ptr [rsp+17160]
+  mov r10, qword ptr [rsp+17152]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1425:
+  mov qword ptr [rsp+17184], 2
+  lea rsi, [rip+g14]
+  add rsi, 0
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+17176], rsi
+  lea rsi, [rip+.L.data.main.527]
+  mov qword ptr [rsp+17168], rsi
+  mov rsi, qword ptr [rsp+17184]
+  cmp rsi, qword ptr [rsp+17176]
+  jne .L.else.main.1426
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17168]
+  mov r9, qword ptr [rsp+17176]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1427
+.L.else.main.1426:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17168]
+  mov r9, qword ptr [rsp+17184]
+  mov r10, qword ptr [rsp+17176]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1427:
+  mov qword ptr [rsp+17208], 3
+  lea rsi, [rip+g14]
+  add rsi, 8
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+17200], rsi
+  lea rsi, [rip+.L.data.main.528]
+  mov qword ptr [rsp+17192], rsi
+  mov rsi, qword ptr [rsp+17208]
+  cmp rsi, qword ptr [rsp+17200]
+  jne .L.else.main.1428
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17192]
+  mov r9, qword ptr [rsp+17200]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1429
+.L.else.main.1428:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17192]
+  mov r9, qword ptr [rsp+17208]
+  mov r10, qword ptr [rsp+17200]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1429:
+  mov qword ptr [rsp+17232], 4
+  lea rsi, [rip+g14]
+  add rsi, 8
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+17224], rsi
+  lea rsi, [rip+.L.data.main.529]
+  mov qword ptr [rsp+17216], rsi
+  mov rsi, qword ptr [rsp+17232]
+  cmp rsi, qword ptr [rsp+17224]
+  jne .L.else.main.1430
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17216]
+  mov r9, qword ptr [rsp+17224]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1431
+.L.else.main.1430:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17216]
+  mov r9, qword ptr [rsp+17232]
+  mov r10, qword ptr [rsp+17224]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1431:
+  mov qword ptr [rsp+17256], 0
+  lea rsi, [rsp+3880]
+  add rsi, 0
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rsp+3880]
+  add rsi, 0
+  add rsi, 4
+  mov dword ptr [rsi], 1
+  lea rsi, [rsp+3880]
+  add rsi, 0
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  lea rsi, [rsp+3880]
+  add rsi, 12
+  add rsi, 0
+  mov dword ptr [rsi], 3
+  lea rsi, [rsp+3880]
+  add rsi, 12
+  add rsi, 4
+  mov dword ptr [rsi], 4
+  lea rsi, [rsp+3880]
+  add rsi, 12
+  add rsi, 8
+  mov dword ptr [rsi], 5
+  lea rsi, [rsp+3880]
+  add rsi, 0
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+17248], rsi
+  lea rsi, [rip+.L.data.main.530]
+  mov qword ptr [rsp+17240], rsi
+  mov rsi, qword ptr [rsp+17256]
+  cmp rsi, qword ptr [rsp+17248]
+  jne .L.else.main.1432
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17240]
+  mov r9, qword ptr [rsp+17248]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1433
+.L.else.main.1432:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17240]
+  mov r9, qword ptr [rsp+17256]
+  mov r10, qword ptr [rsp+17248]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1433:
+  mov qword ptr [rsp+17280], 3
+  lea rsi, [rsp+3904]
+  add rsi, 0
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rsp+3904]
+  add rsi, 0
+  add rsi, 4
+  mov dword ptr [rsi], 1
+  lea rsi, [rsp+3904]
+  add rsi, 0
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  lea rsi, [rsp+3904]
+  add rsi, 12
+  add rsi, 0
+  mov dword ptr [rsi], 3
+  lea rsi, [rsp+3904]
+  add rsi, 12
+  add rsi, 4
+  mov dword ptr [rsi], 4
+  lea rsi, [rsp+3904]
+  add rsi, 12
+  add rsi, 8
+  mov dword ptr [rsi], 5
+  lea rsi, [rsp+3904]
+  add rsi, 12
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+17272], rsi
+  lea rsi, [rip+.L.data.main.531]
+  mov qword ptr [rsp+17264], rsi
+  mov rsi, qword ptr [rsp+17280]
+  cmp rsi, qword ptr [rsp+17272]
+  jne .L.else.main.1434
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17264]
+  mov r9, qword ptr [rsp+17272]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1435
+.L.else.main.1434:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17264]
+  mov r9, qword ptr [rsp+17280]
+  mov r10, qword ptr [rsp+17272]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1435:
+  mov qword ptr [rsp+17304], 0
+  lea rsi, [rsp+3928]
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rsp+3928]
+  add rsi, 0
+  mov dword ptr [rsi+4], 1
+  lea rsi, [rsp+3928]
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  lea rsi, [rsp+3928]
+  add rsi, 8
+  mov dword ptr [rsi+4], 3
+  lea rsi, [rsp+3928]
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+17296], rsi
+  lea rsi, [rip+.L.data.main.532]
+  mov qword ptr [rsp+17288], rsi
+  mov rsi, qword ptr [rsp+17304]
+  cmp rsi, qword ptr [rsp+17296]
+  jne .L.else.main.1436
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17288]
+  mov r9, qword ptr [rsp+17296]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1437
+.L.else.main.1436:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17288]
+  mov r9, qword ptr [rsp+17304]
+  mov r10, qword ptr [rsp+17296]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1437:
+  mov qword ptr [rsp+17328], 2
+  lea rsi, [rsp+3944]
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rsp+3944]
+  add rsi, 0
+  mov dword ptr [rsi+4], 1
+  lea rsi, [rsp+3944]
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  lea rsi, [rsp+3944]
+  add rsi, 8
+  mov dword ptr [rsi+4], 3
+  lea rsi, [rsp+3944]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+17320], rsi
+  lea rsi, [rip+.L.data.main.533]
+  mov qword ptr [rsp+17312], rsi
+  mov rsi, qword ptr [rsp+17328]
+  cmp rsi, qword ptr [rsp+17320]
+  jne .L.else.main.1438
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17312]
+  mov r9, qword ptr [rsp+17320]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1439
+.L.else.main.1438:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17312]
+  mov r9, qword ptr [rsp+17328]
+  mov r10, qword ptr [rsp+17320]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1439:
+  mov qword ptr [rsp+17352], 0
+  mov rsi, qword ptr [rip+g15]
+  lea r8, [rip+.L.data.main.534]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov qword ptr [rsp+17344], rax
+  lea rsi, [rip+.L.data.main.535]
+  mov qword ptr [rsp+17336], rsi
+  mov rsi, qword ptr [rsp+17352]
+  cmp rsi, qword ptr [rsp+17344]
+  jne .L.else.main.1440
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17336]
+  mov r9, qword ptr [rsp+17344]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1441
+.L.else.main.1440:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17336]
+  mov r9, qword ptr [rsp+17352]
+  mov r10, qword ptr [rsp+17344]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1441:
+  mov qword ptr [rsp+17376], 0
+  lea rsi, [rip+g16]
+  add rsi, 0
+  lea r8, [rip+.L.data.main.536]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov qword ptr [rsp+17368], rax
+  lea rsi, [rip+.L.data.main.537]
+  mov qword ptr [rsp+17360], rsi
+  mov rsi, qword ptr [rsp+17376]
+  cmp rsi, qword ptr [rsp+17368]
+  jne .L.else.main.1442
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17360]
+  mov r9, qword ptr [rsp+17368]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1443
+.L.else.main.1442:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17360]
+  mov r9, qword ptr [rsp+17376]
+  mov r10, qword ptr [rsp+17368]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1443:
+  mov qword ptr [rsp+17400], 0
+  lea rsi, [rip+g16]
+  add rsi, 4
+  lea r8, [rip+.L.data.main.538]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov qword ptr [rsp+17392], rax
+  lea rsi, [rip+.L.data.main.539]
+  mov qword ptr [rsp+17384], rsi
+  mov rsi, qword ptr [rsp+17400]
+  cmp rsi, qword ptr [rsp+17392]
+  jne .L.else.main.1444
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17384]
+  mov r9, qword ptr [rsp+17392]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1445
+.L.else.main.1444:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17384]
+  mov r9, qword ptr [rsp+17400]
+  mov r10, qword ptr [rsp+17392]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1445:
+  mov qword ptr [rsp+17424], 7
+  mov qword ptr [rsp+17416], 7
+  lea rsi, [rip+.L.data.main.540]
+  mov qword ptr [rsp+17408], rsi
+  mov rsi, qword ptr [rsp+17424]
+  cmp rsi, qword ptr [rsp+17416]
+  jne .L.else.main.1446
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17408]
+  mov r9, qword ptr [rsp+17416]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1447
+.L.else.main.1446:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17408]
+  mov r9, qword ptr [rsp+17424]
+  mov r10, qword ptr [rsp+17416]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1447:
+  mov qword ptr [rsp+17448], 10
+  mov qword ptr [rsp+17440], 10
+  lea rsi, [rip+.L.data.main.541]
+  mov qword ptr [rsp+17432], rsi
+  mov rsi, qword ptr [rsp+17448]
+  cmp rsi, qword ptr [rsp+17440]
+  jne .L.else.main.1448
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17432]
+  mov r9, qword ptr [rsp+17440]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1449
+.L.else.main.1448:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17432]
+  mov r9, qword ptr [rsp+17448]
+  mov r10, qword ptr [rsp+17440]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1449:
+  mov qword ptr [rsp+17472], 3
+  mov qword ptr [rsp+17464], 3
+  lea rsi, [rip+.L.data.main.542]
+  mov qword ptr [rsp+17456], rsi
+  mov rsi, qword ptr [rsp+17472]
+  cmp rsi, qword ptr [rsp+17464]
+  jne .L.else.main.1450
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17456]
+  mov r9, qword ptr [rsp+17464]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1451
+.L.else.main.1450:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17456]
+  mov r9, qword ptr [rsp+17472]
+  mov r10, qword ptr [rsp+17464]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1451:
+  mov qword ptr [rsp+17496], 0
+  lea rsi, [rip+g17]
+  lea r8, [rip+.L.data.main.543]
+  mov r9, 7
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call memcmp
+  mov qword ptr [rsp+17488], rax
+  lea rsi, [rip+.L.data.main.544]
+  mov qword ptr [rsp+17480], rsi
+  mov rsi, qword ptr [rsp+17496]
+  cmp rsi, qword ptr [rsp+17488]
+  jne .L.else.main.1452
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17480]
+  mov r9, qword ptr [rsp+17488]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1453
+.L.else.main.1452:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17480]
+  mov r9, qword ptr [rsp+17496]
+  mov r10, qword ptr [rsp+17488]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1453:
+  mov qword ptr [rsp+17520], 0
+  lea rsi, [rip+g18]
+  lea r8, [rip+.L.data.main.545]
+  mov r9, 10
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call memcmp
+  mov qword ptr [rsp+17512], rax
+  lea rsi, [rip+.L.data.main.546]
+  mov qword ptr [rsp+17504], rsi
+  mov rsi, qword ptr [rsp+17520]
+  cmp rsi, qword ptr [rsp+17512]
+  jne .L.else.main.1454
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17504]
+  mov r9, qword ptr [rsp+17512]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1455
+.L.else.main.1454:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17504]
+  mov r9, qword ptr [rsp+17520]
+  mov r10, qword ptr [rsp+17512]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1455:
+  mov qword ptr [rsp+17544], 0
+  lea rsi, [rip+g19]
+  lea r8, [rip+.L.data.main.547]
+  mov r9, 3
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call memcmp
+  mov qword ptr [rsp+17536], rax
+  lea rsi, [rip+.L.data.main.548]
+  mov qword ptr [rsp+17528], rsi
+  mov rsi, qword ptr [rsp+17544]
+  cmp rsi, qword ptr [rsp+17536]
+  jne .L.else.main.1456
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17528]
+  mov r9, qword ptr [rsp+17536]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1457
+.L.else.main.1456:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17528]
+  mov r9, qword ptr [rsp+17544]
+  mov r10, qword ptr [rsp+17536]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1457:
+  mov qword ptr [rsp+17568], 0
+  mov rsi, qword ptr [rip+g20]
+  lea r8, [rip+.L.data.main.549]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov qword ptr [rsp+17560], rax
+  lea rsi, [rip+.L.data.main.550]
+  mov qword ptr [rsp+17552], rsi
+  mov rsi, qword ptr [rsp+17568]
+  cmp rsi, qword ptr [rsp+17560]
+  jne .L.else.main.1458
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17552]
+  mov r9, qword ptr [rsp+17560]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1459
+.L.else.main.1458:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17552]
+  mov r9, qword ptr [rsp+17568]
+  mov r10, qword ptr [rsp+17560]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1459:
+  mov qword ptr [rsp+17592], 0
+  mov rsi, qword ptr [rip+g21]
+  lea r8, [rip+.L.data.main.551]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov qword ptr [rsp+17584], rax
+  lea rsi, [rip+.L.data.main.552]
+  mov qword ptr [rsp+17576], rsi
+  mov rsi, qword ptr [rsp+17592]
+  cmp rsi, qword ptr [rsp+17584]
+  jne .L.else.main.1460
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17576]
+  mov r9, qword ptr [rsp+17584]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1461
+.L.else.main.1460:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17576]
+  mov r9, qword ptr [rsp+17592]
+  mov r10, qword ptr [rsp+17584]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1461:
+  mov qword ptr [rsp+17616], 0
+  mov rsi, qword ptr [rip+g22]
+  add rsi, 3
+  lea r8, [rip+.L.data.main.553]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov qword ptr [rsp+17608], rax
+  lea rsi, [rip+.L.data.main.554]
+  mov qword ptr [rsp+17600], rsi
+  mov rsi, qword ptr [rsp+17616]
+  cmp rsi, qword ptr [rsp+17608]
+  jne .L.else.main.1462
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17600]
+  mov r9, qword ptr [rsp+17608]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1463
+.L.else.main.1462:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17600]
+  mov r9, qword ptr [rsp+17616]
+  mov r10, qword ptr [rsp+17608]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1463:
+  mov qword ptr [rsp+17640], 0
+  lea rsi, [rip+g23]
+  add rsi, 0
+  mov rsi, qword ptr [rsi]
+  lea r8, [rip+.L.data.main.555]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov qword ptr [rsp+17632], rax
+  lea rsi, [rip+.L.data.main.556]
+  mov qword ptr [rsp+17624], rsi
+  mov rsi, qword ptr [rsp+17640]
+  cmp rsi, qword ptr [rsp+17632]
+  jne .L.else.main.1464
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17624]
+  mov r9, qword ptr [rsp+17632]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1465
+.L.else.main.1464:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17624]
+  mov r9, qword ptr [rsp+17640]
+  mov r10, qword ptr [rsp+17632]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1465:
+  mov qword ptr [rsp+17664], 0
+  lea rsi, [rip+g23]
+  add rsi, 8
+  mov rsi, qword ptr [rsi]
+  lea r8, [rip+.L.data.main.557]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov qword ptr [rsp+17656], rax
+  lea rsi, [rip+.L.data.main.558]
+  mov qword ptr [rsp+17648], rsi
+  mov rsi, qword ptr [rsp+17664]
+  cmp rsi, qword ptr [rsp+17656]
+  jne .L.else.main.1466
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17648]
+  mov r9, qword ptr [rsp+17656]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1467
+.L.else.main.1466:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17648]
+  mov r9, qword ptr [rsp+17664]
+  mov r10, qword ptr [rsp+17656]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1467:
+  mov qword ptr [rsp+17688], 0
+  lea rsi, [rip+g23]
+  add rsi, 16
+  mov rsi, qword ptr [rsi]
+  add rsi, 3
+  lea r8, [rip+.L.data.main.559]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov qword ptr [rsp+17680], rax
+  lea rsi, [rip+.L.data.main.560]
+  mov qword ptr [rsp+17672], rsi
+  mov rsi, qword ptr [rsp+17688]
+  cmp rsi, qword ptr [rsp+17680]
+  jne .L.else.main.1468
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17672]
+  mov r9, qword ptr [rsp+17680]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1469
+.L.else.main.1468:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17672]
+  mov r9, qword ptr [rsp+17688]
+  mov r10, qword ptr [rsp+17680]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1469:
+  mov qword ptr [rsp+17712], 3
+  movsxd rsi, dword ptr [rip+g24]
+  mov qword ptr [rsp+17704], rsi
+  lea rsi, [rip+.L.data.main.561]
+  mov qword ptr [rsp+17696], rsi
+  mov rsi, qword ptr [rsp+17712]
+  cmp rsi, qword ptr [rsp+17704]
+  jne .L.else.main.1470
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17696]
+  mov r9, qword ptr [rsp+17704]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1471
+.L.else.main.1470:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17696]
+  mov r9, qword ptr [rsp+17712]
+  mov r10, qword ptr [rsp+17704]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1471:
+  mov qword ptr [rsp+17736], 3
+  mov rsi, qword ptr [rip+g25]
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+17728], rsi
+  lea rsi, [rip+.L.data.main.562]
+  mov qword ptr [rsp+17720], rsi
+  mov rsi, qword ptr [rsp+17736]
+  cmp rsi, qword ptr [rsp+17728]
+  jne .L.else.main.1472
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17720]
+  mov r9, qword ptr [rsp+17728]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1473
+.L.else.main.1472:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17720]
+  mov r9, qword ptr [rsp+17736]
+  mov r10, qword ptr [rsp+17728]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1473:
+  mov qword ptr [rsp+17760], 2
+  mov rsi, qword ptr [rip+g27]
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+17752], rsi
+  lea rsi, [rip+.L.data.main.563]
+  mov qword ptr [rsp+17744], rsi
+  mov rsi, qword ptr [rsp+17760]
+  cmp rsi, qword ptr [rsp+17752]
+  jne .L.else.main.1474
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17744]
+  mov r9, qword ptr [rsp+17752]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1475
+.L.else.main.1474:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17744]
+  mov r9, qword ptr [rsp+17760]
+  mov r10, qword ptr [rsp+17752]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1475:
+  mov dword ptr [rip+ext1], 5
+  mov qword ptr [rsp+17784], 5
+  movsxd rsi, dword ptr [rip+ext1]
+  mov qword ptr [rsp+17776], rsi
+  lea rsi, [rip+.L.data.main.564]
+  mov qword ptr [rsp+17768], rsi
+  mov rsi, qword ptr [rsp+17784]
+  cmp rsi, qword ptr [rsp+17776]
+  jne .L.else.main.1476
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17768]
+  mov r9, qword ptr [rsp+17776]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1477
+.L.else.main.1476:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17768]
+  mov r9, qword ptr [rsp+17784]
+  mov r10, qword ptr [rsp+17776]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1477:
+  lea rsi, [rip+ext1]
+  mov qword ptr [rip+ext2], rsi
+  mov qword ptr [rsp+17808], 5
+  mov rsi, qword ptr [rip+ext2]
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+17800], rsi
+  lea rsi, [rip+.L.data.main.565]
+  mov qword ptr [rsp+17792], rsi
+  mov rsi, qword ptr [rsp+17808]
+  cmp rsi, qword ptr [rsp+17800]
+  jne .L.else.main.1478
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17792]
+  mov r9, qword ptr [rsp+17800]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1479
+.L.else.main.1478:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17792]
+  mov r9, qword ptr [rsp+17808]
+  mov r10, qword ptr [rsp+17800]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1479:
+  mov qword ptr [rsp+17832], 1
+  mov qword ptr [rsp+17824], 1
+  lea rsi, [rip+.L.data.main.566]
+  mov qword ptr [rsp+17816], rsi
+  mov rsi, qword ptr [rsp+17832]
+  cmp rsi, qword ptr [rsp+17824]
+  jne .L.else.main.1480
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17816]
+  mov r9, qword ptr [rsp+17824]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1481
+.L.else.main.1480:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17816]
+  mov r9, qword ptr [rsp+17832]
+  mov r10, qword ptr [rsp+17824]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1481:
+  mov qword ptr [rsp+17856], 2
+  mov qword ptr [rsp+17848], 2
+  lea rsi, [rip+.L.data.main.567]
+  mov qword ptr [rsp+17840], rsi
+  mov rsi, qword ptr [rsp+17856]
+  cmp rsi, qword ptr [rsp+17848]
+  jne .L.else.main.1482
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17840]
+  mov r9, qword ptr [rsp+17848]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1483
+.L.else.main.1482:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17840]
+  mov r9, qword ptr [rsp+17856]
+  mov r10, qword ptr [rsp+17848]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1483:
+  mov qword ptr [rsp+17880], 4
+  mov qword ptr [rsp+17872], 4
+  lea rsi, [rip+.L.data.main.568]
+  mov qword ptr [rsp+17864], rsi
+  mov rsi, qword ptr [rsp+17880]
+  cmp rsi, qword ptr [rsp+17872]
+  jne .L.else.main.1484
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17864]
+  mov r9, qword ptr [rsp+17872]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1485
+.L.else.main.1484:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17864]
+  mov r9, qword ptr [rsp+17880]
+  mov r10, qword ptr [rsp+17872]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1485:
+  mov qword ptr [rsp+17904], 8
+  mov qword ptr [rsp+17896], 8
+  lea rsi, [rip+.L.data.main.569]
+  mov qword ptr [rsp+17888], rsi
+  mov rsi, qword ptr [rsp+17904]
+  cmp rsi, qword ptr [rsp+17896]
+  jne .L.else.main.1486
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17888]
+  mov r9, qword ptr [rsp+17896]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1487
+.L.else.main.1486:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17888]
+  mov r9, qword ptr [rsp+17904]
+  mov r10, qword ptr [rsp+17896]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1487:
+  mov qword ptr [rsp+17928], 8
+  mov qword ptr [rsp+17920], 8
+  lea rsi, [rip+.L.data.main.570]
+  mov qword ptr [rsp+17912], rsi
+  mov rsi, qword ptr [rsp+17928]
+  cmp rsi, qword ptr [rsp+17920]
+  jne .L.else.main.1488
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17912]
+  mov r9, qword ptr [rsp+17920]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1489
+.L.else.main.1488:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17912]
+  mov r9, qword ptr [rsp+17928]
+  mov r10, qword ptr [rsp+17920]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1489:
+  mov qword ptr [rsp+17952], 1
+  mov qword ptr [rsp+17944], 1
+  lea rsi, [rip+.L.data.main.571]
+  mov qword ptr [rsp+17936], rsi
+  mov rsi, qword ptr [rsp+17952]
+  cmp rsi, qword ptr [rsp+17944]
+  jne .L.else.main.1490
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17936]
+  mov r9, qword ptr [rsp+17944]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1491
+.L.else.main.1490:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17936]
+  mov r9, qword ptr [rsp+17952]
+  mov r10, qword ptr [rsp+17944]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1491:
+  mov qword ptr [rsp+17976], 4
+  mov qword ptr [rsp+17968], 4
+  lea rsi, [rip+.L.data.main.572]
+  mov qword ptr [rsp+17960], rsi
+  mov rsi, qword ptr [rsp+17976]
+  cmp rsi, qword ptr [rsp+17968]
+  jne .L.else.main.1492
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17960]
+  mov r9, qword ptr [rsp+17968]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1493
+.L.else.main.1492:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17960]
+  mov r9, qword ptr [rsp+17976]
+  mov r10, qword ptr [rsp+17968]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1493:
+  mov qword ptr [rsp+18000], 1
+  mov qword ptr [rsp+17992], 1
+  lea rsi, [rip+.L.data.main.573]
+  mov qword ptr [rsp+17984], rsi
+  mov rsi, qword ptr [rsp+18000]
+  cmp rsi, qword ptr [rsp+17992]
+  jne .L.else.main.1494
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+17984]
+  mov r9, qword ptr [rsp+17992]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1495
+.L.else.main.1494:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+17984]
+  mov r9, qword ptr [rsp+18000]
+  mov r10, qword ptr [rsp+17992]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1495:
+  mov qword ptr [rsp+18024], 8
+  mov qword ptr [rsp+18016], 8
+  lea rsi, [rip+.L.data.main.574]
+  mov qword ptr [rsp+18008], rsi
+  mov rsi, qword ptr [rsp+18024]
+  cmp rsi, qword ptr [rsp+18016]
+  jne .L.else.main.1496
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18008]
+  mov r9, qword ptr [rsp+18016]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1497
+.L.else.main.1496:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18008]
+  mov r9, qword ptr [rsp+18024]
+  mov r10, qword ptr [rsp+18016]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1497:
+  mov qword ptr [rsp+18048], 2
+  movsxd rsi, dword ptr [rip+.L.data.counter.0]
+  add rsi, 1
+  mov dword ptr [rip+.L.data.counter.0], esi
+  sub rsi, 1
+  movsxd rdi, dword ptr [rip+.L.data.counter.1]
+  add rdi, 1
+  mov dword ptr [rip+.L.data.counter.1], edi
+  sub rdi, 1
+  add rsi, rdi
+  movsxd rsi, esi
+  mov qword ptr [rsp+18040], rsi
+  lea rsi, [rip+.L.data.main.575]
+  mov qword ptr [rsp+18032], rsi
+  mov rsi, qword ptr [rsp+18048]
+  cmp rsi, qword ptr [rsp+18040]
+  jne .L.else.main.1498
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18032]
+  mov r9, qword ptr [rsp+18040]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1499
+.L.else.main.1498:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18032]
+  mov r9, qword ptr [rsp+18048]
+  mov r10, qword ptr [rsp+18040]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1499:
+  mov qword ptr [rsp+18072], 4
+  movsxd rsi, dword ptr [rip+.L.data.counter.0]
+  add rsi, 1
+  mov dword ptr [rip+.L.data.counter.0], esi
+  sub rsi, 1
+  movsxd rdi, dword ptr [rip+.L.data.counter.1]
+  add rdi, 1
+  mov dword ptr [rip+.L.data.counter.1], edi
+  sub rdi, 1
+  add rsi, rdi
+  movsxd rsi, esi
+  mov qword ptr [rsp+18064], rsi
+  lea rsi, [rip+.L.data.main.576]
+  mov qword ptr [rsp+18056], rsi
+  mov rsi, qword ptr [rsp+18072]
+  cmp rsi, qword ptr [rsp+18064]
+  jne .L.else.main.1500
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18056]
+  mov r9, qword ptr [rsp+18064]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1501
+.L.else.main.1500:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18056]
+  mov r9, qword ptr [rsp+18072]
+  mov r10, qword ptr [rsp+18064]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1501:
+  mov qword ptr [rsp+18096], 6
+  movsxd rsi, dword ptr [rip+.L.data.counter.0]
+  add rsi, 1
+  mov dword ptr [rip+.L.data.counter.0], esi
+  sub rsi, 1
+  movsxd rdi, dword ptr [rip+.L.data.counter.1]
+  add rdi, 1
+  mov dword ptr [rip+.L.data.counter.1], edi
+  sub rdi, 1
+  add rsi, rdi
+  movsxd rsi, esi
+  mov qword ptr [rsp+18088], rsi
+  lea rsi, [rip+.L.data.main.577]
+  mov qword ptr [rsp+18080], rsi
+  mov rsi, qword ptr [rsp+18096]
+  cmp rsi, qword ptr [rsp+18088]
+  jne .L.else.main.1502
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18080]
+  mov r9, qword ptr [rsp+18088]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1503
+.L.else.main.1502:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18080]
+  mov r9, qword ptr [rsp+18096]
+  mov r10, qword ptr [rsp+18088]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1503:
+  mov qword ptr [rsp+18120], 1
+  mov dword ptr [rsp+3960], 1
+  movsxd rsi, dword ptr [rsp+3960]
+  mov qword ptr [rsp+18112], rsi
+  lea rsi, [rip+.L.data.main.579]
+  mov qword ptr [rsp+18104], rsi
+  mov rsi, qword ptr [rsp+18120]
+  cmp rsi, qword ptr [rsp+18112]
+  jne .L.else.main.1504
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18104]
+  mov r9, qword ptr [rsp+18112]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1505
+.L.else.main.1504:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18104]
+  mov r9, qword ptr [rsp+18120]
+  mov r10, qword ptr [rsp+18112]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1505:
+  mov qword ptr [rsp+18144], 2
+  lea rsi, [rsp+3964]
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rsp+3964]
+  add rsi, 4
+  mov dword ptr [rsi], 1
+  lea rsi, [rsp+3964]
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  lea rsi, [rsp+3964]
+  add rsi, 8
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+18136], rsi
+  lea rsi, [rip+.L.data.main.581]
+  mov qword ptr [rsp+18128], rsi
+  mov rsi, qword ptr [rsp+18144]
+  cmp rsi, qword ptr [rsp+18136]
+  jne .L.else.main.1506
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18128]
+  mov r9, qword ptr [rsp+18136]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1507
+.L.else.main.1506:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18128]
+  mov r9, qword ptr [rsp+18144]
+  mov r10, qword ptr [rsp+18136]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1507:
+  mov qword ptr [rsp+18168], 97
+  mov byte ptr [rsp+3976], 97
+  mov dword ptr [rsp+3980], 3
+  movsx rsi, byte ptr [rsp+3976]
+  mov qword ptr [rsp+18160], rsi
+  lea rsi, [rip+.L.data.main.583]
+  mov qword ptr [rsp+18152], rsi
+  mov rsi, qword ptr [rsp+18168]
+  cmp rsi, qword ptr [rsp+18160]
+  jne .L.else.main.1508
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18152]
+  mov r9, qword ptr [rsp+18160]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1509
+.L.else.main.1508:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18152]
+  mov r9, qword ptr [rsp+18168]
+  mov r10, qword ptr [rsp+18160]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1509:
+  mov qword ptr [rsp+18192], 3
+  mov dword ptr [rsp+3984], 3
+  movsxd rsi, dword ptr [rsp+3984]
+  mov dword ptr [rsp+3988], esi
+  movsxd rsi, dword ptr [rsp+3988]
+  mov qword ptr [rsp+18184], rsi
+  lea rsi, [rip+.L.data.main.585]
+  mov qword ptr [rsp+18176], rsi
+  mov rsi, qword ptr [rsp+18192]
+  cmp rsi, qword ptr [rsp+18184]
+  jne .L.else.main.1510
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18176]
+  mov r9, qword ptr [rsp+18184]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1511
+.L.else.main.1510:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18176]
+  mov r9, qword ptr [rsp+18192]
+  mov r10, qword ptr [rsp+18184]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1511:
+  mov qword ptr [rsp+18216], 1
+  mov rsi, qword ptr [rip+tree]
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+18208], rsi
+  lea rsi, [rip+.L.data.main.586]
+  mov qword ptr [rsp+18200], rsi
+  mov rsi, qword ptr [rsp+18216]
+  cmp rsi, qword ptr [rsp+18208]
+  jne .L.else.main.1512
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18200]
+  mov r9, qword ptr [rsp+18208]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1513
+.L.else.main.1512:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18200]
+  mov r9, qword ptr [rsp+18216]
+  mov r10, qword ptr [rsp+18208]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1513:
+  mov qword ptr [rsp+18240], 2
+  mov rsi, qword ptr [rip+tree]
+  mov rsi, qword ptr [rsi+8]
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+18232], rsi
+  lea rsi, [rip+.L.data.main.587]
+  mov qword ptr [rsp+18224], rsi
+  mov rsi, qword ptr [rsp+18240]
+  cmp rsi, qword ptr [rsp+18232]
+  jne .L.else.main.1514
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18224]
+  mov r9, qword ptr [rsp+18232]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1515
+.L.else.main.1514:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18224]
+  mov r9, qword ptr [rsp+18240]
+  mov r10, qword ptr [rsp+18232]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1515:
+  mov qword ptr [rsp+18264], 3
+  mov rsi, qword ptr [rip+tree]
+  mov rsi, qword ptr [rsi+8]
+  mov rsi, qword ptr [rsi+8]
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+18256], rsi
+  lea rsi, [rip+.L.data.main.588]
+  mov qword ptr [rsp+18248], rsi
+  mov rsi, qword ptr [rsp+18264]
+  cmp rsi, qword ptr [rsp+18256]
+  jne .L.else.main.1516
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18248]
+  mov r9, qword ptr [rsp+18256]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1517
+.L.else.main.1516:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18248]
+  mov r9, qword ptr [rsp+18264]
+  mov r10, qword ptr [rsp+18256]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1517:
+  mov qword ptr [rsp+18288], 4
+  mov rsi, qword ptr [rip+tree]
+  mov rsi, qword ptr [rsi+8]
+  mov rsi, qword ptr [rsi+16]
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rsp+18280], rsi
+  lea rsi, [rip+.L.data.main.589]
+  mov qword ptr [rsp+18272], rsi
+  mov rsi, qword ptr [rsp+18288]
+  cmp rsi, qword ptr [rsp+18280]
+  jne .L.else.main.1518
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18272]
+  mov r9, qword ptr [rsp+18280]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1519
+.L.else.main.1518:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18272]
+  mov r9, qword ptr [rsp+18288]
+  mov r10, qword ptr [rsp+18280]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1519:
+  mov qword ptr [rsp+18312], 3
+  movsxd rsi, dword ptr [rip+ext3]
+  mov qword ptr [rsp+18304], rsi
+  lea rsi, [rip+.L.data.main.590]
+  mov qword ptr [rsp+18296], rsi
+  mov rsi, qword ptr [rsp+18312]
+  cmp rsi, qword ptr [rsp+18304]
+  jne .L.else.main.1520
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18296]
+  mov r9, qword ptr [rsp+18304]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1521
+.L.else.main.1520:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18296]
+  mov r9, qword ptr [rsp+18312]
+  mov r10, qword ptr [rsp+18304]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1521:
+  mov qword ptr [rsp+18336], 2
+  mov dword ptr [rsp+3992], 6
+  and dword ptr [rsp+3992], 3
+  movsxd rsi, dword ptr [rsp+3992]
+  mov qword ptr [rsp+18328], rsi
+  lea rsi, [rip+.L.data.main.591]
+  mov qword ptr [rsp+18320], rsi
+  mov rsi, qword ptr [rsp+18336]
+  cmp rsi, qword ptr [rsp+18328]
+  jne .L.else.main.1522
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18320]
+  mov r9, qword ptr [rsp+18328]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1523
+.L.else.main.1522:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18320]
+  mov r9, qword ptr [rsp+18336]
+  mov r10, qword ptr [rsp+18328]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1523:
+  mov qword ptr [rsp+18360], 7
+  mov dword ptr [rsp+3996], 6
+  or dword ptr [rsp+3996], 3
+  movsxd rsi, dword ptr [rsp+3996]
+  mov qword ptr [rsp+18352], rsi
+  lea rsi, [rip+.L.data.main.592]
+  mov qword ptr [rsp+18344], rsi
+  mov rsi, qword ptr [rsp+18360]
+  cmp rsi, qword ptr [rsp+18352]
+  jne .L.else.main.1524
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18344]
+  mov r9, qword ptr [rsp+18352]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1525
+.L.else.main.1524:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18344]
+  mov r9, qword ptr [rsp+18360]
+  mov r10, qword ptr [rsp+18352]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1525:
+  mov qword ptr [rsp+18384], 10
+  mov dword ptr [rsp+4000], 15
+  xor dword ptr [rsp+4000], 5
+  movsxd rsi, dword ptr [rsp+4000]
+  mov qword ptr [rsp+18376], rsi
+  lea rsi, [rip+.L.data.main.593]
+  mov qword ptr [rsp+18368], rsi
+  mov rsi, qword ptr [rsp+18384]
+  cmp rsi, qword ptr [rsp+18376]
+  jne .L.else.main.1526
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18368]
+  mov r9, qword ptr [rsp+18376]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1527
+.L.else.main.1526:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18368]
+  mov r9, qword ptr [rsp+18384]
+  mov r10, qword ptr [rsp+18376]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1527:
+  mov qword ptr [rsp+18408], 7
+  mov dword ptr [rsp+4004], 0
+  mov dword ptr [rsp+4008], 0
+  .p2align 4,,10
+.L.begin.main.1528:
+  add dword ptr [rsp+4008], 1
+  movsxd rsi, dword ptr [rsp+4004]
+  add rsi, 1
+  mov dword ptr [rsp+4004], esi
+  sub rsi, 1
+  cmp rsi, 6
+  jl .L.begin.main.1528
+  movsxd rsi, dword ptr [rsp+4008]
+  mov qword ptr [rsp+18400], rsi
+  lea rsi, [rip+.L.data.main.594]
+  mov qword ptr [rsp+18392], rsi
+  mov rsi, qword ptr [rsp+18408]
+  cmp rsi, qword ptr [rsp+18400]
+  jne .L.else.main.1531
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18392]
+  mov r9, qword ptr [rsp+18400]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1532
+.L.else.main.1531:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18392]
+  mov r9, qword ptr [rsp+18408]
+  mov r10, qword ptr [rsp+18400]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1532:
+  mov qword ptr [rsp+18432], 4
+  mov dword ptr [rsp+4012], 0
+  mov dword ptr [rsp+4016], 0
+  mov dword ptr [rsp+4020], 0
+  .p2align 4,,10
+.L.begin.main.1533:
+  movsxd rsi, dword ptr [rsp+4016]
+  add rsi, 1
+  mov dword ptr [rsp+4016], esi
+  cmp rsi, 3
+  jle .L.begin.main.1533
+  movsxd rsi, dword ptr [rsp+4016]
+  mov qword ptr [rsp+18424], rsi
+  lea rsi, [rip+.L.data.main.595]
+  mov qword ptr [rsp+18416], rsi
+  mov rsi, qword ptr [rsp+18432]
+  cmp rsi, qword ptr [rsp+18424]
+  jne .L.else.main.1537
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18416]
+  mov r9, qword ptr [rsp+18424]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1538
+.L.else.main.1537:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18416]
+  mov r9, qword ptr [rsp+18432]
+  mov r10, qword ptr [rsp+18424]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1538:
+  mov qword ptr [rsp+18456], 1
+  mov rax, 0
+  call true_fn
+  movzx rsi, al
+  mov qword ptr [rsp+18448], rsi
+  lea rsi, [rip+.L.data.main.596]
+  mov qword ptr [rsp+18440], rsi
+  mov rsi, qword ptr [rsp+18456]
+  cmp rsi, qword ptr [rsp+18448]
+  jne .L.else.main.1539
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18440]
+  mov r9, qword ptr [rsp+18448]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1540
+.L.else.main.1539:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18440]
+  mov r9, qword ptr [rsp+18456]
+  mov r10, qword ptr [rsp+18448]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1540:
+  mov qword ptr [rsp+18480], 0
+  mov rax, 0
+  call false_fn
+  movzx rsi, al
+  mov qword ptr [rsp+18472], rsi
+  lea rsi, [rip+.L.data.main.597]
+  mov qword ptr [rsp+18464], rsi
+  mov rsi, qword ptr [rsp+18480]
+  cmp rsi, qword ptr [rsp+18472]
+  jne .L.else.main.1541
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18464]
+  mov r9, qword ptr [rsp+18472]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1542
+.L.else.main.1541:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18464]
+  mov r9, qword ptr [rsp+18480]
+  mov r10, qword ptr [rsp+18472]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1542:
+  mov qword ptr [rsp+18504], 6
+  mov rsi, 1
+  mov r8, 2
+  mov r9, 3
+  mov r10, 0
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call add_all1
+  mov qword ptr [rsp+18496], rax
+  lea rsi, [rip+.L.data.main.598]
+  mov qword ptr [rsp+18488], rsi
+  mov rsi, qword ptr [rsp+18504]
+  cmp rsi, qword ptr [rsp+18496]
+  jne .L.else.main.1543
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18488]
+  mov r9, qword ptr [rsp+18496]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1544
+.L.else.main.1543:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18488]
+  mov r9, qword ptr [rsp+18504]
+  mov r10, qword ptr [rsp+18496]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1544:
+  mov qword ptr [rsp+18528], 5
+  mov rsi, 1
+  mov r8, 2
+  mov r9, 3
+  mov r10, 0
+  sub r10, 1
+  mov r11, 0
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov r8, r11
+  mov rax, 0
+  call add_all1
+  mov qword ptr [rsp+18520], rax
+  lea rsi, [rip+.L.data.main.599]
+  mov qword ptr [rsp+18512], rsi
+  mov rsi, qword ptr [rsp+18528]
+  cmp rsi, qword ptr [rsp+18520]
+  jne .L.else.main.1545
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18512]
+  mov r9, qword ptr [rsp+18520]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1546
+.L.else.main.1545:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18512]
+  mov r9, qword ptr [rsp+18528]
+  mov r10, qword ptr [rsp+18520]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1546:
+  mov qword ptr [rsp+18552], 0
+  mov rax, 0
+  call stack_misalignment
+  mov qword ptr [rsp+18544], rax
+  lea rsi, [rip+.L.data.main.600]
+  mov qword ptr [rsp+18536], rsi
+  mov rsi, qword ptr [rsp+18552]
+  cmp rsi, qword ptr [rsp+18544]
+  jne .L.else.main.1547
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18536]
+  mov r9, qword ptr [rsp+18544]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1548
+.L.else.main.1547:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18536]
+  mov r9, qword ptr [rsp+18552]
+  mov r10, qword ptr [rsp+18544]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1548:
+  mov qword ptr [rsp+18576], 0
+  lea rsi, [rsp+4027]
+  add rsi, 0
+  mov byte ptr [rsi], 0
+  mov rax, 0
+  call stack_misalignment
+  mov qword ptr [rsp+18568], rax
+  lea rsi, [rip+.L.data.main.601]
+  mov qword ptr [rsp+18560], rsi
+  mov rsi, qword ptr [rsp+18576]
+  cmp rsi, qword ptr [rsp+18568]
+  jne .L.else.main.1549
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18560]
+  mov r9, qword ptr [rsp+18568]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1550
+.L.else.main.1549:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18560]
+  mov r9, qword ptr [rsp+18576]
+  mov r10, qword ptr [rsp+18568]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1550:
+  mov qword ptr [rsp+18600], 0
+  mov rax, 0
+  call stack_misalignment
+  mov qword ptr [rsp+48], rax
+  mov rax, 0
+  call stack_misalignment
+  mov rsi, rax
+  mov r8, 0
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call add_all1
+  mov rsi, rax
+  mov r8, 0
+  mov rdi, qword ptr [rsp+48]
+  mov rdx, r8
+  mov rax, 0
+  call add_all1
+  mov qword ptr [rsp+18592], rax
+  lea rsi, [rip+.L.data.main.602]
+  mov qword ptr [rsp+18584], rsi
+  mov rsi, qword ptr [rsp+18600]
+  cmp rsi, qword ptr [rsp+18592]
+  jne .L.else.main.1551
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18584]
+  mov r9, qword ptr [rsp+18592]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1552
+.L.else.main.1551:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18584]
+  mov r9, qword ptr [rsp+18600]
+  mov r10, qword ptr [rsp+18592]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1552:
+  mov qword ptr [rsp+18624], 6
+  mov rsi, 1
+  mov r8, 2
+  mov r9, 3
+  mov r10, 0
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call add_all3
+  mov qword ptr [rsp+18616], rax
+  lea rsi, [rip+.L.data.main.603]
+  mov qword ptr [rsp+18608], rsi
+  mov rsi, qword ptr [rsp+18624]
+  cmp rsi, qword ptr [rsp+18616]
+  jne .L.else.main.1553
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18608]
+  mov r9, qword ptr [rsp+18616]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1554
+.L.else.main.1553:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18608]
+  mov r9, qword ptr [rsp+18624]
+  mov r10, qword ptr [rsp+18616]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1554:
+  mov qword ptr [rsp+18648], 5
+  mov rsi, 1
+  mov r8, 2
+  mov r9, 3
+  mov r10, 0
+  sub r10, 1
+  mov r11, 0
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov r8, r11
+  mov rax, 0
+  call add_all3
+  mov qword ptr [rsp+18640], rax
+  lea rsi, [rip+.L.data.main.604]
+  mov qword ptr [rsp+18632], rsi
+  mov rsi, qword ptr [rsp+18648]
+  cmp rsi, qword ptr [rsp+18640]
+  jne .L.else.main.1555
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18632]
+  mov r9, qword ptr [rsp+18640]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1556
+.L.else.main.1555:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18632]
+  mov r9, qword ptr [rsp+18648]
+  mov r10, qword ptr [rsp+18640]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1556:
+  mov qword ptr [rsp+18672], 0
+  lea rsi, [rsp+4032]
+  lea r8, [rip+.L.data.main.605]
+  mov r9, 1
+  mov r10, 2
+  lea r11, [rip+.L.data.main.606]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov r8, r11
+  mov rax, 0
+  call fmt
+  lea rsi, [rip+.L.data.main.607]
+  lea r8, [rsp+4032]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov qword ptr [rsp+18664], rax
+  lea rsi, [rip+.L.data.main.608]
+  mov qword ptr [rsp+18656], rsi
+  mov rsi, qword ptr [rsp+18672]
+  cmp rsi, qword ptr [rsp+18664]
+  jne .L.else.main.1557
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18656]
+  mov r9, qword ptr [rsp+18664]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1558
+.L.else.main.1557:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18656]
+  mov r9, qword ptr [rsp+18672]
+  mov r10, qword ptr [rsp+18664]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1558:
+  mov qword ptr [rsp+18696], 0
+  lea rsi, [rsp+4132]
+  lea r8, [rip+.L.data.main.609]
+  mov r9, 1
+  mov r10, 2
+  mov r11, 3
+  mov qword ptr [rsp+40], 4
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov r8, r11
+  mov r9, qword ptr [rsp+40]
+  mov rax, 0
+  call fmt
+  lea rsi, [rip+.L.data.main.610]
+  lea r8, [rsp+4132]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov qword ptr [rsp+18688], rax
+  lea rsi, [rip+.L.data.main.611]
+  mov qword ptr [rsp+18680], rsi
+  mov rsi, qword ptr [rsp+18696]
+  cmp rsi, qword ptr [rsp+18688]
+  jne .L.else.main.1559
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18680]
+  mov r9, qword ptr [rsp+18688]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1560
+.L.else.main.1559:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18680]
+  mov r9, qword ptr [rsp+18696]
+  mov r10, qword ptr [rsp+18688]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1560:
+  mov qword ptr [rsp+18720], 1
+  mov qword ptr [rsp+18712], 1
+  lea rsi, [rip+.L.data.main.612]
+  mov qword ptr [rsp+18704], rsi
+  mov rsi, qword ptr [rsp+18720]
+  cmp rsi, qword ptr [rsp+18712]
+  jne .L.else.main.1561
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18704]
+  mov r9, qword ptr [rsp+18712]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1562
+.L.else.main.1561:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18704]
+  mov r9, qword ptr [rsp+18720]
+  mov r10, qword ptr [rsp+18712]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1562:
+  mov qword ptr [rsp+18744], 1
+  mov qword ptr [rsp+18736], 1
+  lea rsi, [rip+.L.data.main.613]
+  mov qword ptr [rsp+18728], rsi
+  mov rsi, qword ptr [rsp+18744]
+  cmp rsi, qword ptr [rsp+18736]
+  jne .L.else.main.1563
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18728]
+  mov r9, qword ptr [rsp+18736]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1564
+.L.else.main.1563:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18728]
+  mov r9, qword ptr [rsp+18744]
+  mov r10, qword ptr [rsp+18736]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1564:
+  mov qword ptr [rsp+18768], 1
+  mov qword ptr [rsp+18760], 1
+  lea rsi, [rip+.L.data.main.614]
+  mov qword ptr [rsp+18752], rsi
+  mov rsi, qword ptr [rsp+18768]
+  cmp rsi, qword ptr [rsp+18760]
+  jne .L.else.main.1565
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18752]
+  mov r9, qword ptr [rsp+18760]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1566
+.L.else.main.1565:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18752]
+  mov r9, qword ptr [rsp+18768]
+  mov r10, qword ptr [rsp+18760]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1566:
+  mov qword ptr [rsp+18792], 2
+  mov qword ptr [rsp+18784], 2
+  lea rsi, [rip+.L.data.main.615]
+  mov qword ptr [rsp+18776], rsi
+  mov rsi, qword ptr [rsp+18792]
+  cmp rsi, qword ptr [rsp+18784]
+  jne .L.else.main.1567
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18776]
+  mov r9, qword ptr [rsp+18784]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1568
+.L.else.main.1567:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18776]
+  mov r9, qword ptr [rsp+18792]
+  mov r10, qword ptr [rsp+18784]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1568:
+  mov qword ptr [rsp+18816], 2
+  mov qword ptr [rsp+18808], 2
+  lea rsi, [rip+.L.data.main.616]
+  mov qword ptr [rsp+18800], rsi
+  mov rsi, qword ptr [rsp+18816]
+  cmp rsi, qword ptr [rsp+18808]
+  jne .L.else.main.1569
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18800]
+  mov r9, qword ptr [rsp+18808]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1570
+.L.else.main.1569:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18800]
+  mov r9, qword ptr [rsp+18816]
+  mov r10, qword ptr [rsp+18808]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1570:
+  mov qword ptr [rsp+18840], 2
+  mov qword ptr [rsp+18832], 2
+  lea rsi, [rip+.L.data.main.617]
+  mov qword ptr [rsp+18824], rsi
+  mov rsi, qword ptr [rsp+18840]
+  cmp rsi, qword ptr [rsp+18832]
+  jne .L.else.main.1571
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18824]
+  mov r9, qword ptr [rsp+18832]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1572
+.L.else.main.1571:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18824]
+  mov r9, qword ptr [rsp+18840]
+  mov r10, qword ptr [rsp+18832]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1572:
+  mov qword ptr [rsp+18864], 2
+  mov qword ptr [rsp+18856], 2
+  lea rsi, [rip+.L.data.main.618]
+  mov qword ptr [rsp+18848], rsi
+  mov rsi, qword ptr [rsp+18864]
+  cmp rsi, qword ptr [rsp+18856]
+  jne .L.else.main.1573
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18848]
+  mov r9, qword ptr [rsp+18856]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1574
+.L.else.main.1573:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18848]
+  mov r9, qword ptr [rsp+18864]
+  mov r10, qword ptr [rsp+18856]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1574:
+  mov qword ptr [rsp+18888], 2
+  mov qword ptr [rsp+18880], 2
+  lea rsi, [rip+.L.data.main.619]
+  mov qword ptr [rsp+18872], rsi
+  mov rsi, qword ptr [rsp+18888]
+  cmp rsi, qword ptr [rsp+18880]
+  jne .L.else.main.1575
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18872]
+  mov r9, qword ptr [rsp+18880]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1576
+.L.else.main.1575:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18872]
+  mov r9, qword ptr [rsp+18888]
+  mov r10, qword ptr [rsp+18880]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1576:
+  mov qword ptr [rsp+18912], 4
+  mov qword ptr [rsp+18904], 4
+  lea rsi, [rip+.L.data.main.620]
+  mov qword ptr [rsp+18896], rsi
+  mov rsi, qword ptr [rsp+18912]
+  cmp rsi, qword ptr [rsp+18904]
+  jne .L.else.main.1577
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18896]
+  mov r9, qword ptr [rsp+18904]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1578
+.L.else.main.1577:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18896]
+  mov r9, qword ptr [rsp+18912]
+  mov r10, qword ptr [rsp+18904]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1578:
+  mov qword ptr [rsp+18936], 4
+  mov qword ptr [rsp+18928], 4
+  lea rsi, [rip+.L.data.main.621]
+  mov qword ptr [rsp+18920], rsi
+  mov rsi, qword ptr [rsp+18936]
+  cmp rsi, qword ptr [rsp+18928]
+  jne .L.else.main.1579
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18920]
+  mov r9, qword ptr [rsp+18928]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1580
+.L.else.main.1579:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18920]
+  mov r9, qword ptr [rsp+18936]
+  mov r10, qword ptr [rsp+18928]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1580:
+  mov qword ptr [rsp+18960], 4
+  mov qword ptr [rsp+18952], 4
+  lea rsi, [rip+.L.data.main.622]
+  mov qword ptr [rsp+18944], rsi
+  mov rsi, qword ptr [rsp+18960]
+  cmp rsi, qword ptr [rsp+18952]
+  jne .L.else.main.1581
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18944]
+  mov r9, qword ptr [rsp+18952]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1582
+.L.else.main.1581:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18944]
+  mov r9, qword ptr [rsp+18960]
+  mov r10, qword ptr [rsp+18952]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1582:
+  mov qword ptr [rsp+18984], 4
+  mov qword ptr [rsp+18976], 4
+  lea rsi, [rip+.L.data.main.623]
+  mov qword ptr [rsp+18968], rsi
+  mov rsi, qword ptr [rsp+18984]
+  cmp rsi, qword ptr [rsp+18976]
+  jne .L.else.main.1583
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18968]
+  mov r9, qword ptr [rsp+18976]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1584
+.L.else.main.1583:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18968]
+  mov r9, qword ptr [rsp+18984]
+  mov r10, qword ptr [rsp+18976]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1584:
+  mov qword ptr [rsp+19008], 8
+  mov qword ptr [rsp+19000], 8
+  lea rsi, [rip+.L.data.main.624]
+  mov qword ptr [rsp+18992], rsi
+  mov rsi, qword ptr [rsp+19008]
+  cmp rsi, qword ptr [rsp+19000]
+  jne .L.else.main.1585
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+18992]
+  mov r9, qword ptr [rsp+19000]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1586
+.L.else.main.1585:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+18992]
+  mov r9, qword ptr [rsp+19008]
+  mov r10, qword ptr [rsp+19000]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1586:
+  mov qword ptr [rsp+19032], 8
+  mov qword ptr [rsp+19024], 8
+  lea rsi, [rip+.L.data.main.625]
+  mov qword ptr [rsp+19016], rsi
+  mov rsi, qword ptr [rsp+19032]
+  cmp rsi, qword ptr [rsp+19024]
+  jne .L.else.main.1587
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+19016]
+  mov r9, qword ptr [rsp+19024]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1588
+.L.else.main.1587:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+19016]
+  mov r9, qword ptr [rsp+19032]
+  mov r10, qword ptr [rsp+19024]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1588:
+  mov qword ptr [rsp+19056], 8
+  mov qword ptr [rsp+19048], 8
+  lea rsi, [rip+.L.data.main.626]
+  mov qword ptr [rsp+19040], rsi
+  mov rsi, qword ptr [rsp+19056]
+  cmp rsi, qword ptr [rsp+19048]
+  jne .L.else.main.1589
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+19040]
+  mov r9, qword ptr [rsp+19048]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1590
+.L.else.main.1589:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+19040]
+  mov r9, qword ptr [rsp+19056]
+  mov r10, qword ptr [rsp+19048]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1590:
+  mov qword ptr [rsp+19080], 8
+  mov qword ptr [rsp+19072], 8
+  lea rsi, [rip+.L.data.main.627]
+  mov qword ptr [rsp+19064], rsi
+  mov rsi, qword ptr [rsp+19080]
+  cmp rsi, qword ptr [rsp+19072]
+  jne .L.else.main.1591
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+19064]
+  mov r9, qword ptr [rsp+19072]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1592
+.L.else.main.1591:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+19064]
+  mov r9, qword ptr [rsp+19080]
+  mov r10, qword ptr [rsp+19072]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1592:
+  mov qword ptr [rsp+19104], 8
+  mov qword ptr [rsp+19096], 8
+  lea rsi, [rip+.L.data.main.628]
+  mov qword ptr [rsp+19088], rsi
+  mov rsi, qword ptr [rsp+19104]
+  cmp rsi, qword ptr [rsp+19096]
+  jne .L.else.main.1593
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+19088]
+  mov r9, qword ptr [rsp+19096]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1594
+.L.else.main.1593:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+19088]
+  mov r9, qword ptr [rsp+19104]
+  mov r10, qword ptr [rsp+19096]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1594:
+  mov qword ptr [rsp+19128], 8
+  mov qword ptr [rsp+19120], 8
+  lea rsi, [rip+.L.data.main.629]
+  mov qword ptr [rsp+19112], rsi
+  mov rsi, qword ptr [rsp+19128]
+  cmp rsi, qword ptr [rsp+19120]
+  jne .L.else.main.1595
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+19112]
+  mov r9, qword ptr [rsp+19120]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1596
+.L.else.main.1595:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+19112]
+  mov r9, qword ptr [rsp+19128]
+  mov r10, qword ptr [rsp+19120]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1596:
+  mov qword ptr [rsp+19152], 4
+  mov qword ptr [rsp+19144], 4
+  lea rsi, [rip+.L.data.main.630]
+  mov qword ptr [rsp+19136], rsi
+  mov rsi, qword ptr [rsp+19152]
+  cmp rsi, qword ptr [rsp+19144]
+  jne .L.else.main.1597
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+19136]
+  mov r9, qword ptr [rsp+19144]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1598
+.L.else.main.1597:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+19136]
+  mov r9, qword ptr [rsp+19152]
+  mov r10, qword ptr [rsp+19144]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1598:
+  mov qword ptr [rsp+19176], 8
+  mov qword ptr [rsp+19168], 8
+  lea rsi, [rip+.L.data.main.631]
+  mov qword ptr [rsp+19160], rsi
+  mov rsi, qword ptr [rsp+19176]
+  cmp rsi, qword ptr [rsp+19168]
+  jne .L.else.main.1599
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+19160]
+  mov r9, qword ptr [rsp+19168]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1600
+.L.else.main.1599:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+19160]
+  mov r9, qword ptr [rsp+19176]
+  mov r10, qword ptr [rsp+19168]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1600:
+  mov qword ptr [rsp+19200], 8
+  mov qword ptr [rsp+19192], 8
+  lea rsi, [rip+.L.data.main.632]
+  mov qword ptr [rsp+19184], rsi
+  mov rsi, qword ptr [rsp+19200]
+  cmp rsi, qword ptr [rsp+19192]
+  jne .L.else.main.1601
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+19184]
+  mov r9, qword ptr [rsp+19192]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1602
+.L.else.main.1601:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+19184]
+  mov r9, qword ptr [rsp+19200]
+  mov r10, qword ptr [rsp+19192]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1602:
+  mov qword ptr [rsp+19224], 8
+  mov qword ptr [rsp+19216], 8
+  lea rsi, [rip+.L.data.main.633]
+  mov qword ptr [rsp+19208], rsi
+  mov rsi, qword ptr [rsp+19224]
+  cmp rsi, qword ptr [rsp+19216]
+  jne .L.else.main.1603
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+19208]
+  mov r9, qword ptr [rsp+19216]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1604
+.L.else.main.1603:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+19208]
+  mov r9, qword ptr [rsp+19224]
+  mov r10, qword ptr [rsp+19216]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1604:
+  mov qword ptr [rsp+19248], 8
+  mov qword ptr [rsp+19240], 8
+  lea rsi, [rip+.L.data.main.634]
+  mov qword ptr [rsp+19232], rsi
+  mov rsi, qword ptr [rsp+19248]
+  cmp rsi, qword ptr [rsp+19240]
+  jne .L.else.main.1605
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+19232]
+  mov r9, qword ptr [rsp+19240]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1606
+.L.else.main.1605:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+19232]
+  mov r9, qword ptr [rsp+19248]
+  mov r10, qword ptr [rsp+19240]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1606:
+  mov qword ptr [rsp+19272], 8
+  mov qword ptr [rsp+19264], 8
+  lea rsi, [rip+.L.data.main.635]
+  mov qword ptr [rsp+19256], rsi
+  mov rsi, qword ptr [rsp+19272]
+  cmp rsi, qword ptr [rsp+19264]
+  jne .L.else.main.1607
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+19256]
+  mov r9, qword ptr [rsp+19264]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1608
+.L.else.main.1607:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+19256]
+  mov r9, qword ptr [rsp+19272]
+  mov r10, qword ptr [rsp+19264]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1608:
+  mov qword ptr [rsp+19296], 8
+  mov qword ptr [rsp+19288], 8
+  lea rsi, [rip+.L.data.main.636]
+  mov qword ptr [rsp+19280], rsi
+  mov rsi, qword ptr [rsp+19296]
+  cmp rsi, qword ptr [rsp+19288]
+  jne .L.else.main.1609
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+19280]
+  mov r9, qword ptr [rsp+19288]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1610
+.L.else.main.1609:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+19280]
+  mov r9, qword ptr [rsp+19296]
+  mov r10, qword ptr [rsp+19288]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1610:
+  mov qword ptr [rsp+19320], 4
+  mov qword ptr [rsp+19312], 4
+  lea rsi, [rip+.L.data.main.637]
+  mov qword ptr [rsp+19304], rsi
+  mov rsi, qword ptr [rsp+19320]
+  cmp rsi, qword ptr [rsp+19312]
+  jne .L.else.main.1611
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+19304]
+  mov r9, qword ptr [rsp+19312]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1612
+.L.else.main.1611:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+19304]
+  mov r9, qword ptr [rsp+19320]
+  mov r10, qword ptr [rsp+19312]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1612:
+  mov qword ptr [rsp+19344], 8
+  mov qword ptr [rsp+19336], 8
+  lea rsi, [rip+.L.data.main.638]
+  mov qword ptr [rsp+19328], rsi
+  mov rsi, qword ptr [rsp+19344]
+  cmp rsi, qword ptr [rsp+19336]
+  jne .L.else.main.1613
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+19328]
+  mov r9, qword ptr [rsp+19336]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1614
+.L.else.main.1613:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+19328]
+  mov r9, qword ptr [rsp+19344]
+  mov r10, qword ptr [rsp+19336]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1614:
+  movabs rsi, 2147483648
+  mov qword ptr [rsp+19368], rsi
+  movabs rsi, 2147483648
+  mov qword ptr [rsp+19360], rsi
+  lea rsi, [rip+.L.data.main.639]
+  mov qword ptr [rsp+19352], rsi
+  mov rsi, qword ptr [rsp+19368]
+  cmp rsi, qword ptr [rsp+19360]
+  jne .L.else.main.1615
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+19352]
+  mov r9, qword ptr [rsp+19360]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1616
+.L.else.main.1615:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+19352]
+  mov r9, qword ptr [rsp+19368]
+  mov r10, qword ptr [rsp+19360]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1616:
+  movabs rsi, 4294967296
+  mov qword ptr [rsp+19392], rsi
+  mov rsi, 1
+  shl rsi, 32
+  mov qword ptr [rsp+19384], rsi
+  lea rsi, [rip+.L.data.main.640]
+  mov qword ptr [rsp+19376], rsi
+  mov rsi, qword ptr [rsp+19392]
+  cmp rsi, qword ptr [rsp+19384]
+  jne .L.else.main.1617
+  lea rsi, [rip+.L.data.assert.0]
+  mov r8, qword ptr [rsp+19376]
+  mov r9, qword ptr [rsp+19384]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call printf
+  jmp .L.end.main.1618
+.L.else.main.1617:
+  lea rsi, [rip+.L.data.assert.1]
+  mov r8, qword ptr [rsp+19376]
+  mov r9, qword ptr [rsp+19392]
+  mov r10, qword ptr [rsp+19384]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.main.1618:
+  lea rdi, [rip+.L.data.main.641]
+  mov rax, 0
+  call printf
+  mov rax, 0
+.L.return.main:
+  mov rbx, qword ptr [rsp+32]
+  mov r12, qword ptr [rsp+24]
+  mov r13, qword ptr [rsp+16]
+  mov r14, qword ptr [rsp+8]
+  mov r15, qword ptr [rsp]
+  add rsp, 19400
+  ret
@@ -0,0 +1,27176 @@
+.intel_syntax noprefix
+.global loop_g
+.global grid
+.global spill_g
+.global tree
+.global g27
+.global g26
+.global g25
+.global g24
+.global g23
+.global g22
+.global g21
+.global g20
+.global g19
+.global g18
+.global g17
+.global g16
+.global g15
+.global g14
+.global g13
+.global g12
+.global g11
+.global g10
+.global g9
+.global g8
+.global g7
+.global g6
+.global g5
+.global g4
+.global g3
+.global g2
+.global g1
+.bss
+.align 4
+loop_g:
+  .zero 4
+.align 8
+grid:
+  .zero 160
+.align 8
+spill_g:
+  .zero 128
+.align 4
+g2:
+  .zero 16
+.align 4
+g1:
+  .zero 4
+.data
+.align 4
+ext3:
+  .4byte 3
+.align 8
+.L.data.7:
+  .4byte 4
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .8byte 0
+  .8byte 0
+.align 8
+.L.data.6:
+  .4byte 3
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .8byte 0
+  .8byte 0
+.align 8
+.L.data.5:
+  .4byte 2
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .quad .L.data.6+0
+  .quad .L.data.7+0
+.align 8
+.L.data.4:
+  .4byte 1
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .quad .L.data.5+0
+  .8byte 0
+.align 8
+tree:
+  .quad .L.data.4+0
+.align 8
+g27:
+  .quad g26+4
+.align 4
+g26:
+  .4byte 1
+  .4byte 2
+  .4byte 3
+.align 8
+g25:
+  .quad g24+0
+.align 4
+g24:
+  .4byte 3
+.align 8
+g23:
+  .quad g17+0
+  .quad g17+3
+  .quad g17-3
+.align 8
+g22:
+  .quad g17-3
+.align 8
+g21:
+  .quad g17+3
+.align 8
+g20:
+  .quad g17+0
+.align 1
+g19:
+  .byte 102
+  .byte 111
+  .byte 111
+.align 1
+g18:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+.align 1
+g17:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.align 1
+g16:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 0
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.align 1
+.L.data.3:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 0
+.align 8
+g15:
+  .quad .L.data.3+0
+.align 4
+g14:
+  .4byte 1
+  .4byte 2
+  .4byte 3
+  .4byte 4
+.align 4
+g13:
+  .4byte 1
+  .4byte 2
+  .4byte 3
+  .4byte 4
+.align 4
+g12:
+  .4byte 1
+  .4byte 2
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+.align 4
+g11:
+  .byte 1
+  .byte 0
+  .byte 0
+  .byte 0
+  .4byte 2
+  .byte 3
+  .byte 0
+  .byte 0
+  .byte 0
+  .4byte 4
+.align 1
+.L.data.2:
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.align 1
+.L.data.1:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 0
+.align 8
+g10:
+  .quad .L.data.1+0
+  .quad .L.data.2+0
+.align 4
+g9:
+  .4byte 0
+  .4byte 1
+  .4byte 2
+.align 1
+.L.data.0:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+.align 8
+g8:
+  .quad .L.data.0+0
+.align 8
+g7:
+  .quad g5+0
+.align 8
+g6:
+  .8byte 6
+.align 4
+g5:
+  .4byte 5
+.align 2
+g4:
+  .2byte 4
+.align 1
+g3:
+  .byte 3
+.bss
+.data
+.align 1
+.L.data.assert.1:
+  .byte 37
+  .byte 115
+  .byte 32
+  .byte 61
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 32
+  .byte 101
+  .byte 120
+  .byte 112
+  .byte 101
+  .byte 99
+  .byte 116
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 98
+  .byte 117
+  .byte 116
+  .byte 32
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 10
+  .byte 0
+.align 1
+.L.data.assert.0:
+  .byte 37
+  .byte 115
+  .byte 32
+  .byte 61
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 108
+  .byte 100
+  .byte 10
+  .byte 0
+.text
+.p2align 4
+.global assert
+assert:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-8], rbx
+  mov qword ptr [rbp-16], r12
+  mov qword ptr [rbp-24], r13
+  mov r13, rdi
+  mov r12, rsi
+  mov rbx, rdx
+  cmp r13, r12
+  jne .L.else.assert.2
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, rbx
+  mov rdx, r12
+  mov rax, 0
+  call printf
+  jmp .L.end.assert.3
+.L.else.assert.2:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, rbx
+  mov rdx, r13
+  mov rcx, r12
+  mov rax, 0
+  call printf
+  mov rdi, 1
+  mov rax, 0
+  call exit
+.L.end.assert.3:
+.L.return.assert:
+  mov rbx, qword ptr [rbp-8]
+  mov r12, qword ptr [rbp-16]
+  mov r13, qword ptr [rbp-24]
+  mov rsp, rbp
+  pop rbp
+  ret
+.text
+.p2align 4
+.global ret3
+ret3:
+  mov rax, 3
+.L.return.ret3:
+  ret
+.text
+.p2align 4
+.global add2
+add2:
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov r8, rdi
+  add r8, rsi
+  mov rax, r8
+.L.return.add2:
+  ret
+.text
+.p2align 4
+.global sub2
+sub2:
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov r8, rdi
+  sub r8, rsi
+  mov rax, r8
+.L.return.sub2:
+  ret
+.text
+.p2align 4
+.global add6
+add6:
+  push rbp
+  mov rbp, rsp
+  mov dword ptr [rbp-4], edi
+  movsxd rsi, esi
+  mov r10, rdx
+  movsxd r10, r10d
+  movsxd rcx, ecx
+  movsxd r8, r8d
+  movsxd r9, r9d
+  movsxd rdi, dword ptr [rbp-4]
+  add rdi, rsi
+  add rdi, r10
+  add rdi, rcx
+  add rdi, r8
+  add rdi, r9
+  mov rax, rdi
+.L.return.add6:
+  pop rbp
+  ret
+.text
+.p2align 4
+.global addx
+addx:
+  movsxd rsi, esi
+  movsxd r8, dword ptr [rdi]
+  add r8, rsi
+  mov rax, r8
+.L.return.addx:
+  ret
+.text
+.p2align 4
+.global sub_char
+sub_char:
+  movsx rdi, dil
+  movsx rsi, sil
+  mov r8, rdx
+  movsx r8, r8b
+  mov r9, rdi
+  sub r9, rsi
+  sub r9, r8
+  mov rax, r9
+.L.return.sub_char:
+  ret
+.text
+.p2align 4
+.global sub_short
+sub_short:
+  movsx rdi, di
+  movsx rsi, si
+  mov r8, rdx
+  movsx r8, r8w
+  mov r9, rdi
+  sub r9, rsi
+  sub r9, r8
+  mov rax, r9
+.L.return.sub_short:
+  ret
+.text
+.p2align 4
+.global sub_long
+sub_long:
+  mov r8, rdx
+  mov r9, rdi
+  sub r9, rsi
+  sub r9, r8
+  mov rax, r9
+.L.return.sub_long:
+  ret
+.text
+.p2align 4
+.global g1_ptr
+g1_ptr:
+  lea rax, [rip+g1]
+.L.return.g1_ptr:
+  ret
+.text
+.p2align 4
+.global fib
+fib:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov qword ptr [rbp-8], rbx
+  mov qword ptr [rbp-16], r12
+  mov rbx, rdi
+  movsxd rbx, ebx
+  cmp rbx, 1
+  jg .L.end.fib.2
+  mov rax, 1
+  jmp .L.return.fib
+.L.end.fib.2:
+  mov rsi, rbx
+  sub rsi, 1
+  mov rdi, rsi
+  mov rax, 0
+  call fib
+  mov r12, rax
+  mov rsi, rbx
+  sub rsi, 2
+  mov rdi, rsi
+  mov rax, 0
+  call fib
+  add r12, rax
+  mov rax, r12
+.L.return.fib:
+  mov rbx, qword ptr [rbp-8]
+  mov r12, qword ptr [rbp-16]
+  mov rsp, rbp
+  pop rbp
+  ret
+.text
+.p2align 4
+.global sum_fib
+sum_fib:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-8], rbx
+  mov qword ptr [rbp-16], r12
+  mov qword ptr [rbp-24], r13
+  mov qword ptr [rbp-32], r14
+  mov r13, rdi
+  movsxd r13, r13d
+  mov r12, 0
+  mov rbx, 0
+  cmp rbx, r13
+  jge .L.break.sum_fib.3
+  .p2align 4,,10
+.L.begin.sum_fib.4:
+  mov r14, r12
+  mov rdi, rbx
+  mov rax, 0
+  call fib
+  add r14, rax
+  movsxd r14, r14d
+  mov r12, r14
+  mov rsi, rbx
+  add rsi, 1
+  movsxd rsi, esi
+  mov rbx, rsi
+  cmp rbx, r13
+  jl .L.begin.sum_fib.4
+.L.break.sum_fib.3:
+  mov rax, r12
+.L.return.sum_fib:
+  mov rbx, qword ptr [rbp-8]
+  mov r12, qword ptr [rbp-16]
+  mov r13, qword ptr [rbp-24]
+  mov r14, qword ptr [rbp-32]
+  mov rsp, rbp
+  pop rbp
+  ret
+.text
+.p2align 4
+.global rotate6
+rotate6:
+  push rbp
+  mov rbp, rsp
+  mov dword ptr [rbp-12], edi
+  mov dword ptr [rbp-8], esi
+  mov r11, rdx
+  movsxd r11, r11d
+  movsxd rcx, ecx
+  movsxd r8, r8d
+  movsxd r9, r9d
+  mov r10, 0
+  cmp r10, 3
+  jge .L.break.rotate6.3
+  .p2align 4,,10
+.L.begin.rotate6.4:
+  movsxd rsi, dword ptr [rbp-12]
+  mov dword ptr [rbp-4], esi
+  movsxd rsi, dword ptr [rbp-8]
+  mov dword ptr [rbp-12], esi
+  mov dword ptr [rbp-8], r11d
+  movsxd rsi, ecx
+  mov r11, rsi
+  movsxd rsi, r8d
+  mov rcx, rsi
+  movsxd rsi, r9d
+  mov r8, rsi
+  movsxd rsi, dword ptr [rbp-4]
+  movsxd rsi, esi
+  mov r9, rsi
+  mov rsi, r10
+  add rsi, 1
+  movsxd rsi, esi
+  mov r10, rsi
+  cmp r10, 3
+  jl .L.begin.rotate6.4
+.L.break.rotate6.3:
+  movsxd rsi, dword ptr [rbp-12]
+  imul rsi, 100000
+  movsxd rdi, dword ptr [rbp-8]
+  imul rdi, 10000
+  add rsi, rdi
+  mov rdi, r11
+  imul rdi, 1000
+  add rsi, rdi
+  mov rdi, rcx
+  imul rdi, 100
+  add rsi, rdi
+  lea rdi, [r8+r8*4]
+  lea rsi, [rsi+rdi*2]
+  add rsi, r9
+  mov rax, rsi
+.L.return.rotate6:
+  pop rbp
+  ret
+.text
+.p2align 4
+.global swap_args
+swap_args:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov qword ptr [rbp-8], rbx
+  mov qword ptr [rbp-16], r12
+  mov r12, rdi
+  movsxd r12, r12d
+  mov rbx, rsi
+  movsxd rbx, ebx
+  mov rdi, rbx
+  mov rsi, r12
+  mov rax, 0
+  call sub2
+.L.return.swap_args:
+  mov rbx, qword ptr [rbp-8]
+  mov r12, qword ptr [rbp-16]
+  mov rsp, rbp
+  pop rbp
+  ret
+.text
+.p2align 4
+.global inc_char
+inc_char:
+  movsx rdi, dil
+  mov rsi, rdi
+  add rsi, 1
+  movsx rsi, sil
+  mov rdi, rsi
+  mov rax, rdi
+.L.return.inc_char:
+  ret
+.text
+.p2align 4
+.global sum_small_array
+sum_small_array:
+  push rbp
+  mov rbp, rsp
+  movsxd rdi, edi
+  mov r9, 0
+  cmp r9, 16
+  jge .L.break.sum_small_array.3
+  .p2align 4,,10
+.L.begin.sum_small_array.4:
+  lea r10, [rbp-64]
+  lea r10, [r10+r9*4]
+  mov r11, r9
+  imul r11, rdi
+  mov dword ptr [r10], r11d
+  mov r10, r9
+  add r10, 1
+  movsxd r10, r10d
+  mov r9, r10
+  cmp r9, 16
+  jl .L.begin.sum_small_array.4
+.L.break.sum_small_array.3:
+  mov r8, 0
+  mov rsi, 0
+  cmp rsi, 16
+  jge .L.break.sum_small_array.6
+  .p2align 4,,10
+.L.begin.sum_small_array.7:
+  movsxd r10, dword ptr [rbp+rsi*4-64]
+  mov r11, r8
+  add r11, r10
+  movsxd r11, r11d
+  mov r8, r11
+  mov r10, rsi
+  add r10, 1
+  movsxd r10, r10d
+  mov rsi, r10
+  cmp rsi, 16
+  jl .L.begin.sum_small_array.7
+.L.break.sum_small_array.6:
+  mov rax, r8
+.L.return.sum_small_array:
+  pop rbp
+  ret
+.text
+.p2align 4
+.global sum_large_array
+sum_large_array:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 256
+  movsxd rdi, edi
+  mov r9, 0
+  cmp r9, 64
+  jge .L.break.sum_large_array.3
+  .p2align 4,,10
+.L.begin.sum_large_array.4:
+  lea r10, [rbp-256]
+  lea r10, [r10+r9*4]
+  mov r11, r9
+  imul r11, rdi
+  mov dword ptr [r10], r11d
+  mov r10, r9
+  add r10, 1
+  movsxd r10, r10d
+  mov r9, r10
+  cmp r9, 64
+  jl .L.begin.sum_large_array.4
+.L.break.sum_large_array.3:
+  mov r8, 0
+  mov rsi, 0
+  cmp rsi, 64
+  jge .L.break.sum_large_array.6
+  .p2align 4,,10
+.L.begin.sum_large_array.7:
+  movsxd r10, dword ptr [rbp+rsi*4-256]
+  mov r11, r8
+  add r11, r10
+  movsxd r11, r11d
+  mov r8, r11
+  mov r10, rsi
+  add r10, 1
+  movsxd r10, r10d
+  mov rsi, r10
+  cmp rsi, 64
+  jl .L.begin.sum_large_array.7
+.L.break.sum_large_array.6:
+  mov rax, r8
+.L.return.sum_large_array:
+  mov rsp, rbp
+  pop rbp
+  ret
+.text
+.p2align 4
+.global mix_params
+mix_params:
+  push rbp
+  mov rbp, rsp
+  mov qword ptr [rbp-32], rbx
+  mov qword ptr [rbp-40], r12
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r12, rdx
+  mov rbx, rcx
+  mov qword ptr [rbp-8], r8
+  mov rsi, qword ptr [rbp-24]
+  mov rdi, qword ptr [rbp-16]
+  mov rax, rsi
+  cqo
+  idiv rdi
+  mov r11, rax
+  mov rsi, r12
+  mov rcx, rbx
+  shl rsi, cl
+  mov r10, rsi
+  mov rsi, r11
+  imul rsi, 1000
+  add rsi, r10
+  add rsi, qword ptr [rbp-8]
+  sub rsi, r9
+  mov rdi, r12
+  mov rax, rdi
+  cqo
+  idiv rbx
+  add rsi, rax
+  mov rax, rsi
+.L.return.mix_params:
+  mov rbx, qword ptr [rbp-32]
+  mov r12, qword ptr [rbp-40]
+  pop rbp
+  ret
+.text
+.p2align 4
+.global scale_call
+scale_call:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov qword ptr [rbp-24], rbx
+  mov qword ptr [rbp-32], r12
+  mov qword ptr [rbp-40], r13
+  mov qword ptr [rbp-48], r14
+  mov qword ptr [rbp-56], r15
+  mov r15, rdi
+  mov r14, rsi
+  mov r13, rdx
+  mov r12, rcx
+  mov rbx, r8
+  mov qword ptr [rbp-8], r15
+  add qword ptr [rbp-8], r14
+  add qword ptr [rbp-8], r13
+  add qword ptr [rbp-8], r12
+  add qword ptr [rbp-8], rbx
+  lea rax, [r15+r15*2]
+  mov qword ptr [rbp-16], rax
+  mov rax, 0
+  call one
+  mov rdx, qword ptr [rbp-16]
+  lea rdx, [rdx+rax*8]
+  mov qword ptr [rbp-16], rdx
+  mov rax, qword ptr [rbp-16]
+  add qword ptr [rbp-8], rax
+  mov rax, qword ptr [rbp-8]
+.L.return.scale_call:
+  mov rbx, qword ptr [rbp-24]
+  mov r12, qword ptr [rbp-32]
+  mov r13, qword ptr [rbp-40]
+  mov r14, qword ptr [rbp-48]
+  mov r15, qword ptr [rbp-56]
+  mov rsp, rbp
+  pop rbp
+  ret
+.text
+.p2align 4
+.global one
+one:
+  mov rax, 1
+.L.return.one:
+  ret
+.text
+.p2align 4
+.global bool_add
+bool_add:
+  mov r9, rdi
+  cmp r9, 0
+  setne r9b
+  movsx r9, r9b
+  mov r8, r9
+  mov r9, r8
+  add r9, 5
+  cmp r9, 0
+  setne r9b
+  movsx r9, r9b
+  mov r8, r9
+  mov rsi, r9
+  mov rax, rsi
+.L.return.bool_add:
+  ret
+.text
+.p2align 4
+.global bool_inc_loop
+bool_inc_loop:
+  mov r10, 0
+  mov r9, 0
+  mov r11, rdi
+  add r11, 0
+  movsx r11, byte ptr [r11]
+  cmp r11, 0
+  setne r11b
+  movsx r11, r11b
+  mov r8, r11
+  cmp r10, 4
+  jge .L.break.bool_inc_loop.3
+  .p2align 4,,10
+.L.begin.bool_inc_loop.4:
+  mov r11, r10
+  add r11, 1
+  movsxd r11, r11d
+  mov r10, r11
+  mov r11, r8
+  add r11, 1
+  cmp r11, 0
+  setne r11b
+  movsx r11, r11b
+  mov r8, r11
+  mov rcx, r9
+  add rcx, r11
+  movsxd rcx, ecx
+  mov r9, rcx
+  cmp r10, 4
+  jl .L.begin.bool_inc_loop.4
+.L.break.bool_inc_loop.3:
+  mov r11, r8
+  mov rcx, r11
+  add r11, 1
+  cmp r11, 0
+  setne r11b
+  movsx r11, r11b
+  mov r8, r11
+  movsxd rcx, ecx
+  mov rsi, rcx
+  mov r11, r9
+  imul r11, 100
+  lea rcx, [rsi+rsi*4]
+  lea r11, [r11+rcx*2]
+  add r11, r8
+  mov rax, r11
+.L.return.bool_inc_loop:
+  ret
+.text
+.p2align 4
+.global spill_addr
+spill_addr:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov qword ptr [rbp-40], rbx
+  mov qword ptr [rbp-48], r12
+  mov qword ptr [rbp-56], r13
+  mov qword ptr [rbp-64], r14
+  mov qword ptr [rbp-72], r15
+  mov qword ptr [rbp-16], rdi
+  mov r15, rsi
+  mov r14, rdx
+  mov r13, rcx
+  mov qword ptr [rbp-8], r8
+  mov r12, r9
+  mov rbx, 26
+  mov rsi, r12
+  imul rsi, r13
+  cmp r13, r14
+  sete dil
+  movzx rdi, dil
+  imul rdi, r15
+  sub rsi, rdi
+  lea rdi, [rip+spill_g]
+  mov r8, qword ptr [rbp-16]
+  and r8, 3
+  mov rdi, qword ptr [rdi+r8*8]
+  mov r8, 0
+  sub r8, 3
+  mov rax, rdi
+  cqo
+  idiv r8
+  mov rdi, rax
+  cmp r12, 12345
+  setl r8b
+  movzx r8, r8b
+  cmp rdi, r8
+  setl dil
+  movzx rdi, dil
+  and rdi, 255
+  add rdi, 1
+  mov rax, rsi
+  cqo
+  idiv rdi
+  mov qword ptr [rbp-24], rbx
+  mov qword ptr [rbp-32], rbx
+  lea rsi, [rip+spill_g]
+  mov rdi, r15
+  and rdi, 3
+  mov rdi, qword ptr [rsi+rdi*8]
+  mov rsi, r13
+  mov rax, 0
+  call spill_f1
+  mov rsi, rax
+  and rsi, 255
+  add rsi, 1
+  mov rax, qword ptr [rbp-32]
+  cqo
+  idiv rsi
+  mov qword ptr [rbp-32], rax
+  shl qword ptr [rbp-32], 18
+  mov rax, qword ptr [rbp-32]
+  shl rax, 2
+  add rax, qword ptr [rbp-32]
+  lea rdx, [rax]
+  mov qword ptr [rbp-32], rdx
+  mov rdx, qword ptr [rbp-32]
+  shl rdx, 1
+  add rdx, qword ptr [rbp-24]
+  lea rax, [rdx]
+.L.return.spill_addr:
+  mov rbx, qword ptr [rbp-40]
+  mov r12, qword ptr [rbp-48]
+  mov r13, qword ptr [rbp-56]
+  mov r14, qword ptr [rbp-64]
+  mov r15, qword ptr [rbp-72]
+  mov rsp, rbp
+  pop rbp
+  ret
+.text
+.p2align 4
+.global spill_f1
+spill_f1:
+  mov r8, rdi
+  add r8, rsi
+  mov rax, r8
+.L.return.spill_f1:
+  ret
+.text
+.p2align 4
+.global switch_wide
+switch_wide:
+  movabs rsi, -3000000000
+  cmp rdi, rsi
+  je .L.case.switch_wide.4
+  cmp rdi, 5
+  je .L.case.switch_wide.3
+  movabs rsi, 3000000000
+  cmp rdi, rsi
+  jne .L.break.switch_wide.2
+  mov rax, 1
+  jmp .L.return.switch_wide
+.L.case.switch_wide.4:
+  mov rax, 2
+  jmp .L.return.switch_wide
+.L.case.switch_wide.3:
+  mov rax, 3
+  jmp .L.return.switch_wide
+.L.break.switch_wide.2:
+  mov rax, 0
+.L.return.switch_wide:
+  ret
+.text
+.p2align 4
+.global switch_wide_split
+switch_wide_split:
+  cmp rdi, 100
+  je .L.case.switch_wide_split.5
+  jg .L.upper.switch_wide_split.8
+  movabs rsi, -3000000000
+  cmp rdi, rsi
+  je .L.case.switch_wide_split.7
+  cmp rdi, 5
+  je .L.case.switch_wide_split.6
+  jmp .L.break.switch_wide_split.2
+.L.upper.switch_wide_split.8:
+  movabs rsi, 3000000000
+  cmp rdi, rsi
+  je .L.case.switch_wide_split.4
+  movabs rsi, 7000000000
+  cmp rdi, rsi
+  je .L.case.switch_wide_split.3
+  jmp .L.break.switch_wide_split.2
+.L.case.switch_wide_split.7:
+  mov rax, 1
+  jmp .L.return.switch_wide_split
+.L.case.switch_wide_split.6:
+  mov rax, 2
+  jmp .L.return.switch_wide_split
+.L.case.switch_wide_split.5:
+  mov rax, 3
+  jmp .L.return.switch_wide_split
+.L.case.switch_wide_split.4:
+  mov rax, 4
+  jmp .L.return.switch_wide_split
+.L.case.switch_wide_split.3:
+  mov rax, 5
+  jmp .L.return.switch_wide_split
+.L.break.switch_wide_split.2:
+  mov rax, 0
+.L.return.switch_wide_split:
+  ret
+.text
+.p2align 4
+.global switch_wide_table
+switch_wide_table:
+  mov rsi, rdi
+  movabs r8, 3000000000
+  sub rsi, r8
+  cmp rsi, 4
+  ja .L.break.switch_wide_table.2
+  lea r8, [rip+.L.table.switch_wide_table.7]
+  shl rsi, 2
+  add rsi, r8
+  movsxd rsi, dword ptr [rsi]
+  add rsi, r8
+  jmp rsi
+.L.table.switch_wide_table.7:
+  .long .L.case.switch_wide_table.6-.L.table.switch_wide_table.7
+  .long .L.case.switch_wide_table.5-.L.table.switch_wide_table.7
+  .long .L.case.switch_wide_table.4-.L.table.switch_wide_table.7
+  .long .L.break.switch_wide_table.2-.L.table.switch_wide_table.7
+  .long .L.case.switch_wide_table.3-.L.table.switch_wide_table.7
+.L.case.switch_wide_table.6:
+  mov rax, 1
+  jmp .L.return.switch_wide_table
+.L.case.switch_wide_table.5:
+  mov rax, 2
+  jmp .L.return.switch_wide_table
+.L.case.switch_wide_table.4:
+  mov rax, 3
+  jmp .L.return.switch_wide_table
+.L.case.switch_wide_table.3:
+  mov rax, 4
+  jmp .L.return.switch_wide_table
+.L.break.switch_wide_table.2:
+  mov rax, 0
+.L.return.switch_wide_table:
+  ret
+.text
+.p2align 4
+.global switch_int
+switch_int:
+  movsxd rdi, edi
+  cmp rdi, -1294967296
+  jne .L.break.switch_int.2
+  mov rax, 1
+  jmp .L.return.switch_int
+.L.break.switch_int.2:
+  mov rax, 0
+.L.return.switch_int:
+  ret
+.text
+.p2align 4
+.global classify
+classify:
+  movsxd rdi, edi
+  cmp rdi, 0
+  jge .L.end.classify.2
+  mov rsi, 0
+  sub rsi, 1
+  mov rax, rsi
+  jmp .L.return.classify
+.L.end.classify.2:
+  cmp rdi, 0
+  jne .L.end.classify.3
+  mov rax, 0
+  jmp .L.return.classify
+.L.end.classify.3:
+  mov rax, 1
+.L.return.classify:
+  ret
+.text
+.p2align 4
+.global day_kind
+day_kind:
+  movsxd rdi, edi
+  cmp rdi, 0
+  je .L.case.day_kind.4
+  cmp rdi, 3
+  je .L.case.day_kind.3
+  cmp rdi, 6
+  jne .L.break.day_kind.2
+.L.case.day_kind.4:
+  mov rax, 2
+  jmp .L.return.day_kind
+.L.case.day_kind.3:
+  mov rax, 1
+  jmp .L.return.day_kind
+.L.break.day_kind.2:
+  mov rax, 0
+.L.return.day_kind:
+  ret
+.text
+.p2align 4
+.global skip_to
+skip_to:
+  movsxd rdi, edi
+  cmp rdi, 5
+  jg .L.label.skip_to.big
+  mov rax, rdi
+  jmp .L.return.skip_to
+.L.label.skip_to.big:
+  lea rsi, [rdi+rdi*4]
+  shl rsi, 1
+  mov rax, rsi
+.L.return.skip_to:
+  ret
+.text
+.p2align 4
+.global bump
+bump:
+  add dword ptr [rdi], 1
+.L.return.bump:
+  ret
+.text
+.p2align 4
+.global sum_grid
+sum_grid:
+  push rbp
+  mov rbp, rsp
+  mov qword ptr [rbp-24], rbx
+  mov qword ptr [rbp-32], r12
+  mov dword ptr [rbp-12], edi
+  movsxd rsi, esi
+  mov r11, 0
+  mov rdi, r11
+  movsxd rcx, dword ptr [rbp-12]
+  cmp rdi, rcx
+  jge .L.break.sum_grid.3
+  movsxd rdi, dword ptr [rbp-12]
+  .p2align 4,,10
+.L.begin.sum_grid.4:
+  mov r10, 0
+  cmp r10, rsi
+  jge .L.break.sum_grid.6
+  lea rcx, [r11+r11*4]
+  .p2align 4,,10
+.L.begin.sum_grid.7:
+  lea rbx, [rip+grid]
+  lea rbx, [rbx+rcx*8]
+  lea rbx, [rbx+r10*8]
+  lea r12, [r11+r11*4]
+  shl r12, 1
+  add r12, r10
+  mov qword ptr [rbx], r12
+  mov rbx, r10
+  add rbx, 1
+  movsxd rbx, ebx
+  mov r10, rbx
+  cmp r10, rsi
+  jl .L.begin.sum_grid.7
+.L.break.sum_grid.6:
+  mov rcx, r11
+  add rcx, 1
+  movsxd rcx, ecx
+  mov r11, rcx
+  mov rcx, r11
+  cmp rcx, rdi
+  jl .L.begin.sum_grid.4
+.L.break.sum_grid.3:
+  mov qword ptr [rbp-8], 0
+  mov r9, 0
+  mov rdi, r9
+  movsxd rcx, dword ptr [rbp-12]
+  cmp rdi, rcx
+  jge .L.break.sum_grid.9
+  movsxd rdi, dword ptr [rbp-12]
+  .p2align 4,,10
+.L.begin.sum_grid.10:
+  mov r8, 0
+  cmp r8, rsi
+  jge .L.break.sum_grid.12
+  lea rcx, [rip+grid]
+  lea rbx, [r9+r9*4]
+  lea rcx, [rcx+rbx*8]
+  .p2align 4,,10
+.L.begin.sum_grid.13:
+  mov rbx, qword ptr [rcx+r8*8]
+  imul rbx, qword ptr [rip+g6]
+  add qword ptr [rbp-8], rbx
+  mov rbx, r8
+  add rbx, 1
+  movsxd rbx, ebx
+  mov r8, rbx
+  cmp r8, rsi
+  jl .L.begin.sum_grid.13
+.L.break.sum_grid.12:
+  mov rcx, r9
+  add rcx, 1
+  movsxd rcx, ecx
+  mov r9, rcx
+  mov rcx, r9
+  cmp rcx, rdi
+  jl .L.begin.sum_grid.10
+.L.break.sum_grid.9:
+  mov rax, qword ptr [rbp-8]
+.L.return.sum_grid:
+  mov rbx, qword ptr [rbp-24]
+  mov r12, qword ptr [rbp-32]
+  pop rbp
+  ret
+.text
+.p2align 4
+.global count_stored
+count_stored:
+  movsxd rdi, edi
+  mov dword ptr [rip+loop_g], 0
+  mov r8, 0
+  mov rsi, 0
+  cmp rsi, rdi
+  jge .L.break.count_stored.3
+  .p2align 4,,10
+.L.begin.count_stored.4:
+  movsxd r9, dword ptr [rip+loop_g]
+  mov r10, r8
+  add r10, r9
+  movsxd r10, r10d
+  mov r8, r10
+  add dword ptr [rip+loop_g], 2
+  mov r9, rsi
+  add r9, 1
+  movsxd r9, r9d
+  mov rsi, r9
+  cmp rsi, rdi
+  jl .L.begin.count_stored.4
+.L.break.count_stored.3:
+  mov rax, r8
+.L.return.count_stored:
+  ret
+.text
+.p2align 4
+.global sum_through
+sum_through:
+  movsxd rsi, esi
+  mov r9, 0
+  mov r8, 0
+  cmp r8, rsi
+  jge .L.break.sum_through.3
+  .p2align 4,,10
+.L.begin.sum_through.4:
+  movsxd r10, dword ptr [rip+loop_g]
+  mov r11, r9
+  add r11, r10
+  movsxd r11, r11d
+  mov r9, r11
+  add dword ptr [rdi], 1
+  mov r10, r8
+  add r10, 1
+  movsxd r10, r10d
+  mov r8, r10
+  cmp r8, rsi
+  jl .L.begin.sum_through.4
+.L.break.sum_through.3:
+  mov rax, r9
+.L.return.sum_through:
+  ret
+.text
+.p2align 4
+.global sum_local_through
+sum_local_through:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov qword ptr [rbp-16], rbx
+  mov qword ptr [rbp-24], r12
+  mov qword ptr [rbp-32], r13
+  mov qword ptr [rbp-40], r14
+  mov r14, rdi
+  movsxd r14, r14d
+  mov dword ptr [rbp-4], 1
+  lea r13, [rbp-4]
+  mov r12, 0
+  mov rbx, 0
+  cmp rbx, r14
+  jge .L.break.sum_local_through.3
+  .p2align 4,,10
+.L.begin.sum_local_through.4:
+  movsxd rsi, dword ptr [rbp-4]
+  mov rdi, r12
+  add rdi, rsi
+  movsxd rdi, edi
+  mov r12, rdi
+  mov rdi, r13
+  mov rax, 0
+  call bump
+  mov rsi, rbx
+  add rsi, 1
+  movsxd rsi, esi
+  mov rbx, rsi
+  cmp rbx, r14
+  jl .L.begin.sum_local_through.4
+.L.break.sum_local_through.3:
+  mov rax, r12
+.L.return.sum_local_through:
+  mov rbx, qword ptr [rbp-16]
+  mov r12, qword ptr [rbp-24]
+  mov r13, qword ptr [rbp-32]
+  mov r14, qword ptr [rbp-40]
+  mov rsp, rbp
+  pop rbp
+  ret
+.text
+.p2align 4
+.global sum_deref
+sum_deref:
+  movsxd rsi, esi
+  mov r9, 0
+  mov r8, 0
+  cmp r8, rsi
+  jge .L.break.sum_deref.3
+  .p2align 4,,10
+.L.begin.sum_deref.4:
+  movsxd r10, dword ptr [rdi]
+  mov r11, r9
+  add r11, r10
+  movsxd r11, r11d
+  mov r9, r11
+  mov r10, r8
+  add r10, 1
+  movsxd r10, r10d
+  mov r8, r10
+  cmp r8, rsi
+  jl .L.begin.sum_deref.4
+.L.break.sum_deref.3:
+  mov rax, r9
+.L.return.sum_deref:
+  ret
+.text
+.p2align 4
+.global twice
+twice:
+  movsxd rdi, edi
+  mov rsi, rdi
+  add rsi, rdi
+  mov rax, rsi
+.L.return.twice:
+  ret
+.text
+.p2align 4
+.global ret_none
+ret_none:
+.L.return.ret_none:
+  ret
+.text
+.p2align 4
+static_fn:
+  mov rax, 3
+.L.return.static_fn:
+  ret
+.text
+.p2align 4
+.global param_decay
+param_decay:
+  mov rsi, rdi
+  add rsi, 0
+  movsxd rsi, dword ptr [rsi]
+  mov rax, rsi
+.L.return.param_decay:
+  ret
+.text
+.p2align 4
+.global voidfn
+voidfn:
+.L.return.voidfn:
+  ret
+.bss
+.align 4
+.L.data.counter.0:
+  .zero 4
+.data
+.align 4
+.L.data.counter.1:
+  .4byte 2
+.text
+.p2align 4
+.global counter
+counter:
+  movsxd rsi, dword ptr [rip+.L.data.counter.0]
+  add rsi, 1
+  mov dword ptr [rip+.L.data.counter.0], esi
+  sub rsi, 1
+  movsxd rdi, dword ptr [rip+.L.data.counter.1]
+  add rdi, 1
+  mov dword ptr [rip+.L.data.counter.1], edi
+  sub rdi, 1
+  add rsi, rdi
+  mov rax, rsi
+.L.return.counter:
+  ret
+.text
+.p2align 4
+.global fmt
+fmt:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov qword ptr [rbp-88], rbx
+  mov qword ptr [rbp-96], r12
+  mov dword ptr [rbp-8], 16
+  mov qword ptr [rbp-16], r9
+  mov qword ptr [rbp-24], r8
+  mov qword ptr [rbp-32], rcx
+  mov qword ptr [rbp-40], rdx
+  mov qword ptr [rbp-48], rsi
+  mov qword ptr [rbp-56], rdi
+  mov r12, rdi
+  mov rbx, rsi
+  lea rsi, [rbp-80]
+  mov edi, dword ptr [rbp-8]
+  mov dword ptr [rsi], edi
+  mov dword ptr [rsi+4], 48
+  lea rdi, [rbp+16]
+  mov qword ptr [rsi+8], rdi
+  lea rdi, [rbp-56]
+  mov qword ptr [rsi+16], rdi
+  lea r8, [rbp-80]
+  mov rdi, r12
+  mov rsi, rbx
+  mov rdx, r8
+  mov rax, 0
+  call vsprintf
+  mov rax, r12
+.L.return.fmt:
+  mov rbx, qword ptr [rbp-88]
+  mov r12, qword ptr [rbp-96]
+  mov rsp, rbp
+  pop rbp
+  ret
+.bss
+.data
+.align 1
+.L.data.main.641:
+  .byte 79
+  .byte 75
+  .byte 10
+  .byte 0
+.align 1
+.L.data.main.640:
+  .byte 49
+  .byte 76
+  .byte 32
+  .byte 60
+  .byte 60
+  .byte 32
+  .byte 51
+  .byte 50
+  .byte 0
+.align 1
+.L.data.main.639:
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 56
+  .byte 0
+.align 1
+.L.data.main.638:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 56
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.637:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 55
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.636:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 98
+  .byte 48
+  .byte 76
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.635:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 120
+  .byte 48
+  .byte 76
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.634:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 108
+  .byte 108
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.633:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 108
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.632:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 76
+  .byte 76
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.631:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 76
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.630:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.629:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.628:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.627:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.626:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.625:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.624:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.623:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.622:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.621:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.620:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.619:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.618:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.617:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.616:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.615:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.614:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.613:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.612:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.611:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 117
+  .byte 102
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 109
+  .byte 116
+  .byte 40
+  .byte 98
+  .byte 117
+  .byte 102
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 34
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 52
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 34
+  .byte 49
+  .byte 32
+  .byte 50
+  .byte 32
+  .byte 51
+  .byte 32
+  .byte 52
+  .byte 34
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 117
+  .byte 102
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.610:
+  .byte 49
+  .byte 32
+  .byte 50
+  .byte 32
+  .byte 51
+  .byte 32
+  .byte 52
+  .byte 0
+.align 1
+.L.data.main.609:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 0
+.align 1
+.L.data.main.608:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 117
+  .byte 102
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 109
+  .byte 116
+  .byte 40
+  .byte 98
+  .byte 117
+  .byte 102
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 34
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 34
+  .byte 49
+  .byte 32
+  .byte 50
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 117
+  .byte 102
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.607:
+  .byte 49
+  .byte 32
+  .byte 50
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 0
+.align 1
+.L.data.main.606:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 0
+.align 1
+.L.data.main.605:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 0
+.align 1
+.L.data.main.604:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 95
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 51
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 45
+  .byte 49
+  .byte 44
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.603:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 95
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 51
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.602:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 95
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 49
+  .byte 40
+  .byte 115
+  .byte 116
+  .byte 97
+  .byte 99
+  .byte 107
+  .byte 95
+  .byte 109
+  .byte 105
+  .byte 115
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 109
+  .byte 101
+  .byte 110
+  .byte 116
+  .byte 40
+  .byte 41
+  .byte 44
+  .byte 32
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 95
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 49
+  .byte 40
+  .byte 115
+  .byte 116
+  .byte 97
+  .byte 99
+  .byte 107
+  .byte 95
+  .byte 109
+  .byte 105
+  .byte 115
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 109
+  .byte 101
+  .byte 110
+  .byte 116
+  .byte 40
+  .byte 41
+  .byte 44
+  .byte 32
+  .byte 48
+  .byte 41
+  .byte 44
+  .byte 32
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.601:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 97
+  .byte 99
+  .byte 107
+  .byte 95
+  .byte 109
+  .byte 105
+  .byte 115
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 109
+  .byte 101
+  .byte 110
+  .byte 116
+  .byte 40
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.600:
+  .byte 115
+  .byte 116
+  .byte 97
+  .byte 99
+  .byte 107
+  .byte 95
+  .byte 109
+  .byte 105
+  .byte 115
+  .byte 97
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 109
+  .byte 101
+  .byte 110
+  .byte 116
+  .byte 40
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.599:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 95
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 49
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 45
+  .byte 49
+  .byte 44
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.598:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 95
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 49
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.597:
+  .byte 102
+  .byte 97
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 95
+  .byte 102
+  .byte 110
+  .byte 40
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.596:
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 101
+  .byte 95
+  .byte 102
+  .byte 110
+  .byte 40
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.595:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 107
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 111
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 32
+  .byte 62
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 107
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.594:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 111
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 32
+  .byte 60
+  .byte 32
+  .byte 54
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.593:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 49
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 94
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.592:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 124
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.591:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 38
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.590:
+  .byte 101
+  .byte 120
+  .byte 116
+  .byte 51
+  .byte 0
+.align 1
+.L.data.main.589:
+  .byte 116
+  .byte 114
+  .byte 101
+  .byte 101
+  .byte 45
+  .byte 62
+  .byte 108
+  .byte 104
+  .byte 115
+  .byte 45
+  .byte 62
+  .byte 114
+  .byte 104
+  .byte 115
+  .byte 45
+  .byte 62
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 0
+.align 1
+.L.data.main.588:
+  .byte 116
+  .byte 114
+  .byte 101
+  .byte 101
+  .byte 45
+  .byte 62
+  .byte 108
+  .byte 104
+  .byte 115
+  .byte 45
+  .byte 62
+  .byte 108
+  .byte 104
+  .byte 115
+  .byte 45
+  .byte 62
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 0
+.align 1
+.L.data.main.587:
+  .byte 116
+  .byte 114
+  .byte 101
+  .byte 101
+  .byte 45
+  .byte 62
+  .byte 108
+  .byte 104
+  .byte 115
+  .byte 45
+  .byte 62
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 0
+.align 1
+.L.data.main.586:
+  .byte 116
+  .byte 114
+  .byte 101
+  .byte 101
+  .byte 45
+  .byte 62
+  .byte 118
+  .byte 97
+  .byte 108
+  .byte 0
+.align 1
+.L.data.main.585:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 123
+  .byte 120
+  .byte 125
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.583:
+  .byte 40
+  .byte 40
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 41
+  .byte 123
+  .byte 39
+  .byte 97
+  .byte 39
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 125
+  .byte 41
+  .byte 46
+  .byte 97
+  .byte 0
+.align 1
+.L.data.main.581:
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 91
+  .byte 93
+  .byte 41
+  .byte 123
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.579:
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 123
+  .byte 49
+  .byte 125
+  .byte 0
+.align 1
+.L.data.main.577:
+  .byte 99
+  .byte 111
+  .byte 117
+  .byte 110
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 40
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.576:
+  .byte 99
+  .byte 111
+  .byte 117
+  .byte 110
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 40
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.575:
+  .byte 99
+  .byte 111
+  .byte 117
+  .byte 110
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 40
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.574:
+  .byte 95
+  .byte 65
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.573:
+  .byte 95
+  .byte 65
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.572:
+  .byte 95
+  .byte 65
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.571:
+  .byte 95
+  .byte 65
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.570:
+  .byte 95
+  .byte 65
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.569:
+  .byte 95
+  .byte 65
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.568:
+  .byte 95
+  .byte 65
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.567:
+  .byte 95
+  .byte 65
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.566:
+  .byte 95
+  .byte 65
+  .byte 108
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.565:
+  .byte 42
+  .byte 101
+  .byte 120
+  .byte 116
+  .byte 50
+  .byte 0
+.align 1
+.L.data.main.564:
+  .byte 101
+  .byte 120
+  .byte 116
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.563:
+  .byte 42
+  .byte 103
+  .byte 50
+  .byte 55
+  .byte 0
+.align 1
+.L.data.main.562:
+  .byte 42
+  .byte 103
+  .byte 50
+  .byte 53
+  .byte 0
+.align 1
+.L.data.main.561:
+  .byte 103
+  .byte 50
+  .byte 52
+  .byte 0
+.align 1
+.L.data.main.560:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 50
+  .byte 51
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 43
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.559:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.align 1
+.L.data.main.558:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 50
+  .byte 51
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.557:
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.align 1
+.L.data.main.556:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 50
+  .byte 51
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.555:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.align 1
+.L.data.main.554:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 50
+  .byte 50
+  .byte 43
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.553:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.align 1
+.L.data.main.552:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 50
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.551:
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.align 1
+.L.data.main.550:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 50
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.549:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.align 1
+.L.data.main.548:
+  .byte 109
+  .byte 101
+  .byte 109
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 57
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.547:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 0
+.align 1
+.L.data.main.546:
+  .byte 109
+  .byte 101
+  .byte 109
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 56
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 92
+  .byte 48
+  .byte 92
+  .byte 48
+  .byte 92
+  .byte 48
+  .byte 34
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.545:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+.align 1
+.L.data.main.544:
+  .byte 109
+  .byte 101
+  .byte 109
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 55
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 44
+  .byte 32
+  .byte 55
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.543:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.align 1
+.L.data.main.542:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 57
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.541:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 56
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.540:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 55
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.539:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 54
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.538:
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.align 1
+.L.data.main.537:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 54
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.536:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 0
+.align 1
+.L.data.main.535:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.534:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 0
+.align 1
+.L.data.main.533:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.532:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.531:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.530:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.529:
+  .byte 103
+  .byte 49
+  .byte 52
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.528:
+  .byte 103
+  .byte 49
+  .byte 52
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.527:
+  .byte 103
+  .byte 49
+  .byte 52
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.526:
+  .byte 103
+  .byte 49
+  .byte 52
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.525:
+  .byte 103
+  .byte 49
+  .byte 51
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.524:
+  .byte 103
+  .byte 49
+  .byte 51
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.523:
+  .byte 103
+  .byte 49
+  .byte 51
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.522:
+  .byte 103
+  .byte 49
+  .byte 51
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.521:
+  .byte 103
+  .byte 49
+  .byte 50
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.520:
+  .byte 103
+  .byte 49
+  .byte 50
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.519:
+  .byte 103
+  .byte 49
+  .byte 50
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.518:
+  .byte 103
+  .byte 49
+  .byte 50
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.517:
+  .byte 103
+  .byte 49
+  .byte 49
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 0
+.align 1
+.L.data.main.516:
+  .byte 103
+  .byte 49
+  .byte 49
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 0
+.align 1
+.L.data.main.515:
+  .byte 103
+  .byte 49
+  .byte 49
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 0
+.align 1
+.L.data.main.514:
+  .byte 103
+  .byte 49
+  .byte 49
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 0
+.align 1
+.L.data.main.513:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 47
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 42
+  .byte 103
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.512:
+  .byte 103
+  .byte 49
+  .byte 48
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.511:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 48
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.510:
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.align 1
+.L.data.main.509:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 48
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.508:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 0
+.align 1
+.L.data.main.507:
+  .byte 103
+  .byte 57
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.506:
+  .byte 103
+  .byte 57
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.505:
+  .byte 103
+  .byte 57
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.504:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 56
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.503:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+.align 1
+.L.data.main.502:
+  .byte 42
+  .byte 103
+  .byte 55
+  .byte 0
+.align 1
+.L.data.main.501:
+  .byte 103
+  .byte 54
+  .byte 0
+.align 1
+.L.data.main.500:
+  .byte 103
+  .byte 53
+  .byte 0
+.align 1
+.L.data.main.499:
+  .byte 103
+  .byte 52
+  .byte 0
+.align 1
+.L.data.main.498:
+  .byte 103
+  .byte 51
+  .byte 0
+.align 1
+.L.data.main.497:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.496:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.495:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.494:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.493:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.492:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.491:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.490:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 99
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.489:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.488:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.487:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 99
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.486:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.485:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.484:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 0
+.align 1
+.L.data.main.483:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.482:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.481:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 44
+  .byte 34
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 34
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 0
+.align 1
+.L.data.main.480:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 44
+  .byte 34
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 34
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 0
+.align 1
+.L.data.main.479:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 44
+  .byte 34
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 34
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 0
+.align 1
+.L.data.main.478:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 44
+  .byte 34
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 34
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 0
+.align 1
+.L.data.main.477:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 0
+.align 1
+.L.data.main.476:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 0
+.align 1
+.L.data.main.475:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 0
+.align 1
+.L.data.main.474:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.473:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.472:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.471:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.470:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.469:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.468:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.467:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.466:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.465:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.464:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.463:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.462:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.461:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 63
+  .byte 50
+  .byte 58
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.460:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 63
+  .byte 50
+  .byte 58
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.459:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 43
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.458:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 52
+  .byte 50
+  .byte 57
+  .byte 52
+  .byte 57
+  .byte 54
+  .byte 55
+  .byte 50
+  .byte 57
+  .byte 56
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 32
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 51
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 52
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 53
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 97
+  .byte 117
+  .byte 108
+  .byte 116
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 115
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.457:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 53
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 51
+  .byte 58
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 52
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 52
+  .byte 48
+  .byte 58
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 52
+  .byte 49
+  .byte 58
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 52
+  .byte 50
+  .byte 58
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 52
+  .byte 51
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 48
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 115
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.456:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 48
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 56
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 48
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 49
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 51
+  .byte 48
+  .byte 48
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 51
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 53
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 54
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 97
+  .byte 117
+  .byte 108
+  .byte 116
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 115
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.455:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 45
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 45
+  .byte 53
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 45
+  .byte 53
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 45
+  .byte 52
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 45
+  .byte 50
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 45
+  .byte 49
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 56
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 115
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.454:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 45
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 52
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 56
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 53
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 49
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 55
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 51
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 97
+  .byte 117
+  .byte 108
+  .byte 116
+  .byte 58
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 115
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.453:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 53
+  .byte 45
+  .byte 50
+  .byte 43
+  .byte 48
+  .byte 42
+  .byte 51
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.452:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 116
+  .byte 101
+  .byte 110
+  .byte 61
+  .byte 49
+  .byte 43
+  .byte 50
+  .byte 43
+  .byte 51
+  .byte 43
+  .byte 52
+  .byte 44
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 101
+  .byte 110
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.451:
+  .byte 48
+  .byte 63
+  .byte 49
+  .byte 58
+  .byte 50
+  .byte 0
+.align 1
+.L.data.main.450:
+  .byte 48
+  .byte 63
+  .byte 49
+  .byte 58
+  .byte 50
+  .byte 0
+.align 1
+.L.data.main.449:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 62
+  .byte 62
+  .byte 49
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.448:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 45
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.447:
+  .byte 45
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.446:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 62
+  .byte 62
+  .byte 49
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.445:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 60
+  .byte 49
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.444:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 60
+  .byte 51
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.443:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 60
+  .byte 48
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.442:
+  .byte 45
+  .byte 49
+  .byte 62
+  .byte 62
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.441:
+  .byte 53
+  .byte 62
+  .byte 62
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.440:
+  .byte 53
+  .byte 60
+  .byte 60
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.439:
+  .byte 49
+  .byte 60
+  .byte 60
+  .byte 51
+  .byte 0
+.align 1
+.L.data.main.438:
+  .byte 49
+  .byte 60
+  .byte 60
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.437:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.436:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.435:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 97
+  .byte 117
+  .byte 108
+  .byte 116
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.434:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 97
+  .byte 117
+  .byte 108
+  .byte 116
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.433:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.432:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 50
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.431:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.430:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.429:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 111
+  .byte 32
+  .byte 103
+  .byte 59
+  .byte 32
+  .byte 104
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.428:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 111
+  .byte 32
+  .byte 100
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.427:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 111
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.426:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 60
+  .byte 50
+  .byte 48
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 105
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 49
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 105
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 50
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 105
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 51
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 105
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 52
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 105
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 53
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 105
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 54
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 105
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 55
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.425:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 111
+  .byte 32
+  .byte 109
+  .byte 59
+  .byte 32
+  .byte 109
+  .byte 58
+  .byte 32
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.424:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 111
+  .byte 32
+  .byte 108
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 58
+  .byte 32
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 62
+  .byte 53
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.423:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 111
+  .byte 32
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 107
+  .byte 58
+  .byte 32
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.422:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 110
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 110
+  .byte 43
+  .byte 43
+  .byte 44
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 61
+  .byte 61
+  .byte 50
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 110
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.421:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 110
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 110
+  .byte 43
+  .byte 43
+  .byte 44
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 110
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.420:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 62
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.419:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 40
+  .byte 33
+  .byte 105
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.418:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 62
+  .byte 53
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.417:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 62
+  .byte 53
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.416:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 40
+  .byte 59
+  .byte 33
+  .byte 105
+  .byte 59
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 59
+  .byte 106
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.415:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 59
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 62
+  .byte 53
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.414:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 59
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 62
+  .byte 53
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.413:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 32
+  .byte 61
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.412:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 40
+  .byte 59
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 32
+  .byte 61
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.411:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 32
+  .byte 61
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.410:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 40
+  .byte 59
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 32
+  .byte 61
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.409:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 42
+  .byte 110
+  .byte 101
+  .byte 120
+  .byte 116
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 46
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 46
+  .byte 110
+  .byte 101
+  .byte 120
+  .byte 116
+  .byte 61
+  .byte 38
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 46
+  .byte 110
+  .byte 101
+  .byte 120
+  .byte 116
+  .byte 45
+  .byte 62
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.408:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 42
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.407:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.406:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 57
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 38
+  .byte 120
+  .byte 91
+  .byte 56
+  .byte 93
+  .byte 45
+  .byte 38
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.405:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 49
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.404:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.403:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 55
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.402:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 54
+  .byte 52
+  .byte 49
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.401:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 55
+  .byte 56
+  .byte 57
+  .byte 48
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.400:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 55
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.399:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.398:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 51
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.397:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 56
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.396:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 50
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.395:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.394:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 91
+  .byte 106
+  .byte 93
+  .byte 61
+  .byte 105
+  .byte 42
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 97
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 91
+  .byte 106
+  .byte 93
+  .byte 43
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 45
+  .byte 105
+  .byte 93
+  .byte 91
+  .byte 106
+  .byte 93
+  .byte 47
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.393:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 38
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 45
+  .byte 38
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.392:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 38
+  .byte 97
+  .byte 91
+  .byte 55
+  .byte 93
+  .byte 45
+  .byte 38
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.391:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.390:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 45
+  .byte 51
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.389:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 52
+  .byte 48
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.388:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 49
+  .byte 50
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.387:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 57
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 57
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.386:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 53
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.385:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 51
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.384:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 51
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 60
+  .byte 45
+  .byte 50
+  .byte 57
+  .byte 57
+  .byte 57
+  .byte 57
+  .byte 57
+  .byte 57
+  .byte 57
+  .byte 57
+  .byte 57
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.383:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 50
+  .byte 60
+  .byte 105
+  .byte 32
+  .byte 63
+  .byte 32
+  .byte 55
+  .byte 32
+  .byte 58
+  .byte 32
+  .byte 56
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.382:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 50
+  .byte 60
+  .byte 105
+  .byte 32
+  .byte 63
+  .byte 32
+  .byte 55
+  .byte 32
+  .byte 58
+  .byte 32
+  .byte 56
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.381:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 111
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 33
+  .byte 40
+  .byte 105
+  .byte 61
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.380:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 33
+  .byte 40
+  .byte 105
+  .byte 62
+  .byte 61
+  .byte 53
+  .byte 41
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.379:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 33
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.378:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.377:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 33
+  .byte 40
+  .byte 105
+  .byte 60
+  .byte 50
+  .byte 32
+  .byte 124
+  .byte 124
+  .byte 32
+  .byte 53
+  .byte 60
+  .byte 61
+  .byte 105
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 105
+  .byte 33
+  .byte 61
+  .byte 57
+  .byte 41
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.376:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 62
+  .byte 54
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 33
+  .byte 40
+  .byte 105
+  .byte 61
+  .byte 61
+  .byte 56
+  .byte 41
+  .byte 32
+  .byte 124
+  .byte 124
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 61
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.375:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 56
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 62
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 55
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.374:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 43
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 42
+  .byte 41
+  .byte 112
+  .byte 45
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 42
+  .byte 41
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.373:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 112
+  .byte 43
+  .byte 51
+  .byte 41
+  .byte 45
+  .byte 120
+  .byte 61
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.372:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.371:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 50
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.370:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 52
+  .byte 50
+  .byte 57
+  .byte 52
+  .byte 57
+  .byte 54
+  .byte 55
+  .byte 50
+  .byte 57
+  .byte 54
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.369:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 94
+  .byte 45
+  .byte 55
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.368:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 38
+  .byte 50
+  .byte 53
+  .byte 53
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.367:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 60
+  .byte 60
+  .byte 49
+  .byte 50
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.366:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 120
+  .byte 62
+  .byte 62
+  .byte 55
+  .byte 48
+  .byte 41
+  .byte 61
+  .byte 61
+  .byte 45
+  .byte 49
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.365:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 43
+  .byte 61
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.364:
+  .byte 103
+  .byte 49
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 49
+  .byte 60
+  .byte 60
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 49
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.363:
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 45
+  .byte 61
+  .byte 50
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.362:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 43
+  .byte 61
+  .byte 50
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.361:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 50
+  .byte 57
+  .byte 52
+  .byte 57
+  .byte 54
+  .byte 55
+  .byte 50
+  .byte 57
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.360:
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 55
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.359:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.358:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 97
+  .byte 114
+  .byte 97
+  .byte 109
+  .byte 95
+  .byte 100
+  .byte 101
+  .byte 99
+  .byte 97
+  .byte 121
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.357:
+  .byte 49
+  .byte 38
+  .byte 38
+  .byte 53
+  .byte 0
+.align 1
+.L.data.main.356:
+  .byte 40
+  .byte 50
+  .byte 45
+  .byte 50
+  .byte 41
+  .byte 38
+  .byte 38
+  .byte 53
+  .byte 0
+.align 1
+.L.data.main.355:
+  .byte 48
+  .byte 38
+  .byte 38
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.354:
+  .byte 48
+  .byte 124
+  .byte 124
+  .byte 40
+  .byte 50
+  .byte 45
+  .byte 50
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.353:
+  .byte 48
+  .byte 124
+  .byte 124
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.352:
+  .byte 48
+  .byte 124
+  .byte 124
+  .byte 40
+  .byte 50
+  .byte 45
+  .byte 50
+  .byte 41
+  .byte 124
+  .byte 124
+  .byte 53
+  .byte 0
+.align 1
+.L.data.main.351:
+  .byte 48
+  .byte 124
+  .byte 124
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.350:
+  .byte 48
+  .byte 98
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 94
+  .byte 48
+  .byte 98
+  .byte 48
+  .byte 48
+  .byte 49
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.349:
+  .byte 48
+  .byte 98
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 94
+  .byte 48
+  .byte 98
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.348:
+  .byte 48
+  .byte 94
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.347:
+  .byte 48
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 124
+  .byte 48
+  .byte 98
+  .byte 48
+  .byte 48
+  .byte 49
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.346:
+  .byte 48
+  .byte 124
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.345:
+  .byte 32
+  .byte 45
+  .byte 49
+  .byte 38
+  .byte 49
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.344:
+  .byte 55
+  .byte 38
+  .byte 51
+  .byte 0
+.align 1
+.L.data.main.343:
+  .byte 51
+  .byte 38
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.342:
+  .byte 48
+  .byte 38
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.341:
+  .byte 126
+  .byte 45
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.340:
+  .byte 126
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.339:
+  .byte 33
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.338:
+  .byte 33
+  .byte 50
+  .byte 0
+.align 1
+.L.data.main.337:
+  .byte 33
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.336:
+  .byte 48
+  .byte 66
+  .byte 49
+  .byte 48
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.335:
+  .byte 48
+  .byte 98
+  .byte 49
+  .byte 48
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.334:
+  .byte 48
+  .byte 98
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.333:
+  .byte 48
+  .byte 98
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.332:
+  .byte 48
+  .byte 88
+  .byte 66
+  .byte 69
+  .byte 69
+  .byte 70
+  .byte 0
+.align 1
+.L.data.main.331:
+  .byte 48
+  .byte 120
+  .byte 66
+  .byte 69
+  .byte 69
+  .byte 70
+  .byte 0
+.align 1
+.L.data.main.330:
+  .byte 48
+  .byte 120
+  .byte 98
+  .byte 101
+  .byte 101
+  .byte 102
+  .byte 0
+.align 1
+.L.data.main.329:
+  .byte 48
+  .byte 88
+  .byte 65
+  .byte 0
+.align 1
+.L.data.main.328:
+  .byte 48
+  .byte 120
+  .byte 97
+  .byte 0
+.align 1
+.L.data.main.327:
+  .byte 48
+  .byte 120
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.326:
+  .byte 48
+  .byte 55
+  .byte 55
+  .byte 55
+  .byte 0
+.align 1
+.L.data.main.325:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 47
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.324:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 47
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.323:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 42
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.322:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 42
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.321:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 45
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.320:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 45
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.319:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.318:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.317:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.316:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.315:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.314:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.313:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 45
+  .byte 45
+  .byte 42
+  .byte 112
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.312:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.311:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 43
+  .byte 43
+  .byte 42
+  .byte 112
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.310:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.309:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.308:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.307:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.306:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.305:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 45
+  .byte 45
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.304:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 43
+  .byte 43
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.303:
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.302:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 106
+  .byte 43
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.301:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 106
+  .byte 43
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.300:
+  .byte 115
+  .byte 116
+  .byte 97
+  .byte 116
+  .byte 105
+  .byte 99
+  .byte 95
+  .byte 102
+  .byte 110
+  .byte 40
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.299:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 111
+  .byte 110
+  .byte 101
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 119
+  .byte 111
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 121
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.298:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 111
+  .byte 110
+  .byte 101
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 119
+  .byte 111
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.297:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 102
+  .byte 105
+  .byte 118
+  .byte 101
+  .byte 61
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 104
+  .byte 114
+  .byte 101
+  .byte 101
+  .byte 61
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 117
+  .byte 114
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 117
+  .byte 114
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.296:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 102
+  .byte 105
+  .byte 118
+  .byte 101
+  .byte 61
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 104
+  .byte 114
+  .byte 101
+  .byte 101
+  .byte 61
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 117
+  .byte 114
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 104
+  .byte 114
+  .byte 101
+  .byte 101
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.295:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 102
+  .byte 105
+  .byte 118
+  .byte 101
+  .byte 61
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 104
+  .byte 114
+  .byte 101
+  .byte 101
+  .byte 61
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 117
+  .byte 114
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 105
+  .byte 118
+  .byte 101
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.294:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 102
+  .byte 105
+  .byte 118
+  .byte 101
+  .byte 61
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 104
+  .byte 114
+  .byte 101
+  .byte 101
+  .byte 61
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 117
+  .byte 114
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.293:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 102
+  .byte 105
+  .byte 118
+  .byte 101
+  .byte 61
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 115
+  .byte 101
+  .byte 118
+  .byte 101
+  .byte 110
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.292:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 102
+  .byte 105
+  .byte 118
+  .byte 101
+  .byte 61
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 115
+  .byte 101
+  .byte 118
+  .byte 101
+  .byte 110
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 105
+  .byte 118
+  .byte 101
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.291:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 111
+  .byte 110
+  .byte 101
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 119
+  .byte 111
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 119
+  .byte 111
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.290:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 111
+  .byte 110
+  .byte 101
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 119
+  .byte 111
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 111
+  .byte 110
+  .byte 101
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.289:
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 111
+  .byte 110
+  .byte 101
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 119
+  .byte 111
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 122
+  .byte 101
+  .byte 114
+  .byte 111
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.288:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 39
+  .byte 97
+  .byte 39
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.287:
+  .byte 39
+  .byte 97
+  .byte 39
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.286:
+  .byte 39
+  .byte 92
+  .byte 110
+  .byte 39
+  .byte 0
+.align 1
+.L.data.main.285:
+  .byte 39
+  .byte 97
+  .byte 39
+  .byte 0
+.align 1
+.L.data.main.284:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 42
+  .byte 41
+  .byte 121
+  .byte 0
+.align 1
+.L.data.main.283:
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 38
+  .byte 42
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 41
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.282:
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.281:
+  .byte 40
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 41
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 50
+  .byte 53
+  .byte 54
+  .byte 0
+.align 1
+.L.data.main.280:
+  .byte 40
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 41
+  .byte 50
+  .byte 0
+.align 1
+.L.data.main.279:
+  .byte 40
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 41
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.278:
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 56
+  .byte 53
+  .byte 57
+  .byte 48
+  .byte 48
+  .byte 54
+  .byte 54
+  .byte 49
+  .byte 55
+  .byte 55
+  .byte 0
+.align 1
+.L.data.main.277:
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 56
+  .byte 53
+  .byte 57
+  .byte 48
+  .byte 48
+  .byte 54
+  .byte 54
+  .byte 49
+  .byte 55
+  .byte 55
+  .byte 0
+.align 1
+.L.data.main.276:
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 56
+  .byte 53
+  .byte 57
+  .byte 48
+  .byte 48
+  .byte 54
+  .byte 54
+  .byte 49
+  .byte 55
+  .byte 55
+  .byte 0
+.align 1
+.L.data.main.275:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.274:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.273:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.272:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 40
+  .byte 42
+  .byte 41
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.271:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 40
+  .byte 42
+  .byte 41
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.270:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.269:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 42
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.268:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.267:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.266:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.265:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.264:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.263:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.262:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.261:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.260:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.259:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.258:
+  .byte 77
+  .byte 121
+  .byte 73
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.257:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.256:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.255:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.254:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.253:
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 116
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.252:
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 116
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.251:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.250:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.249:
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.248:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.247:
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 38
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.246:
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.245:
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.244:
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.243:
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.242:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 99
+  .byte 99
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 118
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 60
+  .byte 52
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 99
+  .byte 99
+  .byte 43
+  .byte 61
+  .byte 43
+  .byte 43
+  .byte 118
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 99
+  .byte 99
+  .byte 42
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 97
+  .byte 99
+  .byte 99
+  .byte 43
+  .byte 105
+  .byte 42
+  .byte 48
+  .byte 43
+  .byte 57
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.241:
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 43
+  .byte 43
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.240:
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 40
+  .byte 98
+  .byte 61
+  .byte 55
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.239:
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 43
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.238:
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.237:
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.236:
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.235:
+  .byte 42
+  .byte 103
+  .byte 49
+  .byte 95
+  .byte 112
+  .byte 116
+  .byte 114
+  .byte 40
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.234:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 121
+  .byte 41
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.233:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.232:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 120
+  .byte 41
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.231:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.230:
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 95
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 40
+  .byte 55
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.229:
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 95
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 40
+  .byte 55
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.228:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 98
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.227:
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.226:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.225:
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.224:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 121
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.223:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 121
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.222:
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 116
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.221:
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.220:
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 116
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.219:
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.218:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 45
+  .byte 62
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.217:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 45
+  .byte 62
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.216:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 46
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 43
+  .byte 121
+  .byte 46
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.215:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 121
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.214:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 45
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.213:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 45
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.212:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.211:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.210:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.209:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 125
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.208:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.207:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.206:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.205:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.204:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.203:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.202:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.201:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.200:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.199:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.198:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.197:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 99
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 99
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.196:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.195:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 99
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.194:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.193:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.192:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 45
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.191:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.190:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.189:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.188:
+  .byte 34
+  .byte 92
+  .byte 108
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.187:
+  .byte 108
+  .byte 0
+.align 1
+.L.data.main.186:
+  .byte 34
+  .byte 92
+  .byte 107
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.185:
+  .byte 107
+  .byte 0
+.align 1
+.L.data.main.184:
+  .byte 34
+  .byte 92
+  .byte 106
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.183:
+  .byte 106
+  .byte 0
+.align 1
+.L.data.main.182:
+  .byte 34
+  .byte 92
+  .byte 48
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.181:
+  .byte 0
+  .byte 0
+.align 1
+.L.data.main.180:
+  .byte 34
+  .byte 92
+  .byte 101
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.179:
+  .byte 27
+  .byte 0
+.align 1
+.L.data.main.178:
+  .byte 34
+  .byte 92
+  .byte 114
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.177:
+  .byte 13
+  .byte 0
+.align 1
+.L.data.main.176:
+  .byte 34
+  .byte 92
+  .byte 102
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.175:
+  .byte 12
+  .byte 0
+.align 1
+.L.data.main.174:
+  .byte 34
+  .byte 92
+  .byte 118
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.173:
+  .byte 11
+  .byte 0
+.align 1
+.L.data.main.172:
+  .byte 34
+  .byte 92
+  .byte 110
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.171:
+  .byte 10
+  .byte 0
+.align 1
+.L.data.main.170:
+  .byte 34
+  .byte 92
+  .byte 116
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.169:
+  .byte 9
+  .byte 0
+.align 1
+.L.data.main.168:
+  .byte 34
+  .byte 92
+  .byte 98
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.167:
+  .byte 8
+  .byte 0
+.align 1
+.L.data.main.166:
+  .byte 34
+  .byte 92
+  .byte 97
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.165:
+  .byte 7
+  .byte 0
+.align 1
+.L.data.main.164:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.163:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+.align 1
+.L.data.main.162:
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.161:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+.align 1
+.L.data.main.160:
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.159:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+.align 1
+.L.data.main.158:
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.157:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+.align 1
+.L.data.main.156:
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.155:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+.align 1
+.L.data.main.154:
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 95
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 40
+  .byte 55
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.153:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.152:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.151:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.150:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.149:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.148:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 103
+  .byte 50
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.147:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.146:
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.145:
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.144:
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.143:
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+.align 1
+.L.data.main.142:
+  .byte 103
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.141:
+  .byte 103
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.140:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 42
+  .byte 42
+  .byte 120
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.139:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 120
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.138:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 42
+  .byte 42
+  .byte 120
+  .byte 41
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.137:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 42
+  .byte 42
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.136:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 42
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.135:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.134:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.133:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.132:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.131:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.130:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 54
+  .byte 93
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.129:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.128:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.127:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.126:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.125:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.124:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.123:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 50
+  .byte 91
+  .byte 120
+  .byte 93
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.122:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.121:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.120:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.119:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.118:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 43
+  .byte 54
+  .byte 41
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.117:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 43
+  .byte 53
+  .byte 41
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.116:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 43
+  .byte 52
+  .byte 41
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.115:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 43
+  .byte 51
+  .byte 41
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.114:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 42
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.113:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 42
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.112:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.111:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.110:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.109:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.108:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.107:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 120
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 121
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.106:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 38
+  .byte 121
+  .byte 45
+  .byte 49
+  .byte 41
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.105:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.104:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.103:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 122
+  .byte 61
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 122
+  .byte 45
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.102:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 122
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 122
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.101:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 45
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.100:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 38
+  .byte 121
+  .byte 45
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.99:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 49
+  .byte 43
+  .byte 38
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.98:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.97:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 122
+  .byte 61
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 122
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.96:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.95:
+  .byte 116
+  .byte 119
+  .byte 105
+  .byte 99
+  .byte 101
+  .byte 40
+  .byte 116
+  .byte 119
+  .byte 105
+  .byte 99
+  .byte 101
+  .byte 40
+  .byte 116
+  .byte 119
+  .byte 105
+  .byte 99
+  .byte 101
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.94:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 116
+  .byte 119
+  .byte 105
+  .byte 99
+  .byte 101
+  .byte 40
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 42
+  .byte 49
+  .byte 48
+  .byte 43
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.93:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 117
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 38
+  .byte 105
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 117
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 38
+  .byte 105
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.92:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 100
+  .byte 101
+  .byte 114
+  .byte 101
+  .byte 102
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.91:
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 100
+  .byte 101
+  .byte 114
+  .byte 101
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.90:
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 108
+  .byte 111
+  .byte 99
+  .byte 97
+  .byte 108
+  .byte 95
+  .byte 116
+  .byte 104
+  .byte 114
+  .byte 111
+  .byte 117
+  .byte 103
+  .byte 104
+  .byte 40
+  .byte 52
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.89:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 111
+  .byte 112
+  .byte 95
+  .byte 103
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 116
+  .byte 104
+  .byte 114
+  .byte 111
+  .byte 117
+  .byte 103
+  .byte 104
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 52
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.88:
+  .byte 108
+  .byte 111
+  .byte 111
+  .byte 112
+  .byte 95
+  .byte 103
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 116
+  .byte 104
+  .byte 114
+  .byte 111
+  .byte 117
+  .byte 103
+  .byte 104
+  .byte 40
+  .byte 38
+  .byte 108
+  .byte 111
+  .byte 111
+  .byte 112
+  .byte 95
+  .byte 103
+  .byte 44
+  .byte 32
+  .byte 52
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.87:
+  .byte 99
+  .byte 111
+  .byte 117
+  .byte 110
+  .byte 116
+  .byte 95
+  .byte 115
+  .byte 116
+  .byte 111
+  .byte 114
+  .byte 101
+  .byte 100
+  .byte 40
+  .byte 53
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.86:
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 103
+  .byte 114
+  .byte 105
+  .byte 100
+  .byte 40
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.85:
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 103
+  .byte 114
+  .byte 105
+  .byte 100
+  .byte 40
+  .byte 52
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.84:
+  .byte 115
+  .byte 107
+  .byte 105
+  .byte 112
+  .byte 95
+  .byte 116
+  .byte 111
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 43
+  .byte 115
+  .byte 107
+  .byte 105
+  .byte 112
+  .byte 95
+  .byte 116
+  .byte 111
+  .byte 40
+  .byte 56
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.83:
+  .byte 115
+  .byte 107
+  .byte 105
+  .byte 112
+  .byte 95
+  .byte 116
+  .byte 111
+  .byte 40
+  .byte 55
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.82:
+  .byte 115
+  .byte 107
+  .byte 105
+  .byte 112
+  .byte 95
+  .byte 116
+  .byte 111
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.81:
+  .byte 100
+  .byte 97
+  .byte 121
+  .byte 95
+  .byte 107
+  .byte 105
+  .byte 110
+  .byte 100
+  .byte 40
+  .byte 52
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.80:
+  .byte 100
+  .byte 97
+  .byte 121
+  .byte 95
+  .byte 107
+  .byte 105
+  .byte 110
+  .byte 100
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.79:
+  .byte 100
+  .byte 97
+  .byte 121
+  .byte 95
+  .byte 107
+  .byte 105
+  .byte 110
+  .byte 100
+  .byte 40
+  .byte 54
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.78:
+  .byte 100
+  .byte 97
+  .byte 121
+  .byte 95
+  .byte 107
+  .byte 105
+  .byte 110
+  .byte 100
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.77:
+  .byte 99
+  .byte 108
+  .byte 97
+  .byte 115
+  .byte 115
+  .byte 105
+  .byte 102
+  .byte 121
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 43
+  .byte 99
+  .byte 108
+  .byte 97
+  .byte 115
+  .byte 115
+  .byte 105
+  .byte 102
+  .byte 121
+  .byte 40
+  .byte 45
+  .byte 50
+  .byte 41
+  .byte 43
+  .byte 99
+  .byte 108
+  .byte 97
+  .byte 115
+  .byte 115
+  .byte 105
+  .byte 102
+  .byte 121
+  .byte 40
+  .byte 57
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.76:
+  .byte 99
+  .byte 108
+  .byte 97
+  .byte 115
+  .byte 115
+  .byte 105
+  .byte 102
+  .byte 121
+  .byte 40
+  .byte 55
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.75:
+  .byte 99
+  .byte 108
+  .byte 97
+  .byte 115
+  .byte 115
+  .byte 105
+  .byte 102
+  .byte 121
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.74:
+  .byte 99
+  .byte 108
+  .byte 97
+  .byte 115
+  .byte 115
+  .byte 105
+  .byte 102
+  .byte 121
+  .byte 40
+  .byte 45
+  .byte 53
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.73:
+  .byte 115
+  .byte 112
+  .byte 105
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 103
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 112
+  .byte 105
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 114
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 52
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.72:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 40
+  .byte 45
+  .byte 49
+  .byte 50
+  .byte 57
+  .byte 52
+  .byte 57
+  .byte 54
+  .byte 55
+  .byte 50
+  .byte 57
+  .byte 54
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.71:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 119
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 95
+  .byte 116
+  .byte 97
+  .byte 98
+  .byte 108
+  .byte 101
+  .byte 40
+  .byte 52
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.70:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 119
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 95
+  .byte 116
+  .byte 97
+  .byte 98
+  .byte 108
+  .byte 101
+  .byte 40
+  .byte 51
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 51
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.69:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 119
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 95
+  .byte 116
+  .byte 97
+  .byte 98
+  .byte 108
+  .byte 101
+  .byte 40
+  .byte 51
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 52
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.68:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 119
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 95
+  .byte 116
+  .byte 97
+  .byte 98
+  .byte 108
+  .byte 101
+  .byte 40
+  .byte 51
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.67:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 119
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 95
+  .byte 115
+  .byte 112
+  .byte 108
+  .byte 105
+  .byte 116
+  .byte 40
+  .byte 54
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.66:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 119
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 95
+  .byte 115
+  .byte 112
+  .byte 108
+  .byte 105
+  .byte 116
+  .byte 40
+  .byte 55
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.65:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 119
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 95
+  .byte 115
+  .byte 112
+  .byte 108
+  .byte 105
+  .byte 116
+  .byte 40
+  .byte 51
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.64:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 119
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 95
+  .byte 115
+  .byte 112
+  .byte 108
+  .byte 105
+  .byte 116
+  .byte 40
+  .byte 45
+  .byte 51
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.63:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 119
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 40
+  .byte 45
+  .byte 49
+  .byte 50
+  .byte 57
+  .byte 52
+  .byte 57
+  .byte 54
+  .byte 55
+  .byte 50
+  .byte 57
+  .byte 54
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.62:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 119
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 40
+  .byte 53
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.61:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 119
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 40
+  .byte 45
+  .byte 51
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.60:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 119
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 40
+  .byte 51
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.59:
+  .byte 98
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 95
+  .byte 105
+  .byte 110
+  .byte 99
+  .byte 95
+  .byte 108
+  .byte 111
+  .byte 111
+  .byte 112
+  .byte 40
+  .byte 34
+  .byte 92
+  .byte 48
+  .byte 34
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.58:
+  .byte 0
+  .byte 0
+.align 1
+.L.data.main.57:
+  .byte 98
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 95
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.56:
+  .byte 115
+  .byte 99
+  .byte 97
+  .byte 108
+  .byte 101
+  .byte 95
+  .byte 99
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 52
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.55:
+  .byte 109
+  .byte 105
+  .byte 120
+  .byte 95
+  .byte 112
+  .byte 97
+  .byte 114
+  .byte 97
+  .byte 109
+  .byte 115
+  .byte 40
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 52
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.54:
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 115
+  .byte 109
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 97
+  .byte 121
+  .byte 40
+  .byte 50
+  .byte 41
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 108
+  .byte 97
+  .byte 114
+  .byte 103
+  .byte 101
+  .byte 95
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 97
+  .byte 121
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.53:
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 108
+  .byte 97
+  .byte 114
+  .byte 103
+  .byte 101
+  .byte 95
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 97
+  .byte 121
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.52:
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 115
+  .byte 109
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 97
+  .byte 121
+  .byte 40
+  .byte 50
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.51:
+  .byte 105
+  .byte 110
+  .byte 99
+  .byte 95
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 40
+  .byte 49
+  .byte 50
+  .byte 55
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.50:
+  .byte 115
+  .byte 119
+  .byte 97
+  .byte 112
+  .byte 95
+  .byte 97
+  .byte 114
+  .byte 103
+  .byte 115
+  .byte 40
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.49:
+  .byte 114
+  .byte 111
+  .byte 116
+  .byte 97
+  .byte 116
+  .byte 101
+  .byte 54
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.48:
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 102
+  .byte 105
+  .byte 98
+  .byte 40
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.47:
+  .byte 102
+  .byte 105
+  .byte 98
+  .byte 40
+  .byte 57
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.46:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 41
+  .byte 41
+  .byte 42
+  .byte 40
+  .byte 52
+  .byte 43
+  .byte 40
+  .byte 53
+  .byte 42
+  .byte 40
+  .byte 54
+  .byte 43
+  .byte 40
+  .byte 55
+  .byte 42
+  .byte 40
+  .byte 56
+  .byte 43
+  .byte 40
+  .byte 57
+  .byte 42
+  .byte 40
+  .byte 49
+  .byte 48
+  .byte 43
+  .byte 40
+  .byte 49
+  .byte 49
+  .byte 42
+  .byte 40
+  .byte 49
+  .byte 50
+  .byte 43
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 54
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 41
+  .byte 47
+  .byte 40
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 49
+  .byte 52
+  .byte 44
+  .byte 49
+  .byte 53
+  .byte 41
+  .byte 45
+  .byte 49
+  .byte 51
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.45:
+  .byte 49
+  .byte 43
+  .byte 40
+  .byte 50
+  .byte 43
+  .byte 40
+  .byte 51
+  .byte 43
+  .byte 40
+  .byte 52
+  .byte 43
+  .byte 40
+  .byte 53
+  .byte 43
+  .byte 40
+  .byte 54
+  .byte 43
+  .byte 40
+  .byte 55
+  .byte 43
+  .byte 40
+  .byte 56
+  .byte 43
+  .byte 40
+  .byte 57
+  .byte 43
+  .byte 40
+  .byte 49
+  .byte 48
+  .byte 43
+  .byte 40
+  .byte 49
+  .byte 49
+  .byte 43
+  .byte 40
+  .byte 49
+  .byte 50
+  .byte 43
+  .byte 40
+  .byte 49
+  .byte 51
+  .byte 43
+  .byte 40
+  .byte 49
+  .byte 52
+  .byte 43
+  .byte 40
+  .byte 49
+  .byte 53
+  .byte 43
+  .byte 49
+  .byte 54
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.44:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 54
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.43:
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 40
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.42:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 40
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.41:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.40:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 40
+  .byte 105
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 106
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.39:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 40
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.38:
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 50
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.37:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 50
+  .byte 45
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.36:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.35:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 49
+  .byte 45
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.34:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.33:
+  .byte 114
+  .byte 101
+  .byte 116
+  .byte 51
+  .byte 40
+  .byte 41
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.32:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 43
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.31:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.30:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 122
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 43
+  .byte 122
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.29:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.28:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 122
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 122
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 43
+  .byte 122
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.27:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 0
+.align 1
+.L.data.main.26:
+  .byte 49
+  .byte 62
+  .byte 61
+  .byte 50
+  .byte 0
+.align 1
+.L.data.main.25:
+  .byte 49
+  .byte 62
+  .byte 61
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.24:
+  .byte 49
+  .byte 62
+  .byte 61
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.23:
+  .byte 49
+  .byte 62
+  .byte 50
+  .byte 0
+.align 1
+.L.data.main.22:
+  .byte 49
+  .byte 62
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.21:
+  .byte 49
+  .byte 62
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.20:
+  .byte 50
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.19:
+  .byte 49
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.18:
+  .byte 48
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.17:
+  .byte 50
+  .byte 60
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.16:
+  .byte 49
+  .byte 60
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.15:
+  .byte 48
+  .byte 60
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.14:
+  .byte 52
+  .byte 50
+  .byte 33
+  .byte 61
+  .byte 52
+  .byte 50
+  .byte 0
+.align 1
+.L.data.main.13:
+  .byte 48
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.12:
+  .byte 52
+  .byte 50
+  .byte 61
+  .byte 61
+  .byte 52
+  .byte 50
+  .byte 0
+.align 1
+.L.data.main.11:
+  .byte 48
+  .byte 61
+  .byte 61
+  .byte 49
+  .byte 0
+.align 1
+.L.data.main.10:
+  .byte 45
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 43
+  .byte 49
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.9:
+  .byte 45
+  .byte 32
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.8:
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.7:
+  .byte 40
+  .byte 51
+  .byte 43
+  .byte 53
+  .byte 41
+  .byte 47
+  .byte 50
+  .byte 0
+.align 1
+.L.data.main.6:
+  .byte 53
+  .byte 42
+  .byte 40
+  .byte 57
+  .byte 45
+  .byte 54
+  .byte 41
+  .byte 0
+.align 1
+.L.data.main.5:
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.4:
+  .byte 32
+  .byte 49
+  .byte 50
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 51
+  .byte 52
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 53
+  .byte 32
+  .byte 0
+.align 1
+.L.data.main.3:
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.2:
+  .byte 52
+  .byte 50
+  .byte 0
+.align 1
+.L.data.main.1:
+  .byte 48
+  .byte 0
+.align 1
+.L.data.main.0:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 122
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 43
+  .byte 122
+  .byte 59
+  .byte 0
+.text
+.p2align 4
+.global main
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 5024
+  mov qword ptr [rbp-4984], rbx
+  mov qword ptr [rbp-4992], r12
+  mov qword ptr [rbp-5000], r13
+  mov qword ptr [rbp-5008], r14
+  mov qword ptr [rbp-5016], r15
+  mov rsi, 8
+  mov dword ptr [rbp-4012], 3
+  mov dword ptr [rbp-4008], 5
+  movsxd r8, dword ptr [rbp-4012]
+  movsxd rdi, dword ptr [rbp-4008]
+  add r8, rdi
+  lea r9, [rip+.L.data.main.0]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  mov r8, 0
+  lea r9, [rip+.L.data.main.1]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 42
+  mov r8, 42
+  lea r9, [rip+.L.data.main.2]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 5
+  mov r8, 5
+  lea r9, [rip+.L.data.main.3]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 41
+  mov r8, 12
+  add r8, 34
+  sub r8, 5
+  lea r9, [rip+.L.data.main.4]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 5
+  mov r8, 5
+  lea r9, [rip+.L.data.main.5]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 15
+  mov r8, 5
+  mov rdi, 9
+  sub rdi, 6
+  imul r8, rdi
+  lea r9, [rip+.L.data.main.6]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  mov r8, 3
+  add r8, 5
+  mov rdi, r8
+  sar rdi, 63
+  and rdi, 1
+  add r8, rdi
+  sar r8, 1
+  lea r9, [rip+.L.data.main.7]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  sub rsi, 10
+  mov r8, 0
+  sub r8, 10
+  lea r9, [rip+.L.data.main.8]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 10
+  mov r8, 0
+  mov rdi, 0
+  sub rdi, 10
+  sub r8, rdi
+  lea r9, [rip+.L.data.main.9]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 10
+  mov r8, 0
+  mov rdi, 0
+  sub rdi, 10
+  sub r8, rdi
+  lea r9, [rip+.L.data.main.10]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  mov rdi, 0
+  cmp rdi, 1
+  sete r8b
+  movzx r8, r8b
+  lea r9, [rip+.L.data.main.11]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov rdi, 42
+  cmp rdi, 42
+  sete r8b
+  movzx r8, r8b
+  lea r9, [rip+.L.data.main.12]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov rdi, 0
+  cmp rdi, 1
+  setne r8b
+  movzx r8, r8b
+  lea r9, [rip+.L.data.main.13]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  mov rdi, 42
+  cmp rdi, 42
+  setne r8b
+  movzx r8, r8b
+  lea r9, [rip+.L.data.main.14]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov rdi, 0
+  cmp rdi, 1
+  setl r8b
+  movzx r8, r8b
+  lea r9, [rip+.L.data.main.15]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  mov rdi, 1
+  cmp rdi, 1
+  setl r8b
+  movzx r8, r8b
+  lea r9, [rip+.L.data.main.16]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  mov rdi, 2
+  cmp rdi, 1
+  setl r8b
+  movzx r8, r8b
+  lea r9, [rip+.L.data.main.17]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov rdi, 0
+  cmp rdi, 1
+  setle r8b
+  movzx r8, r8b
+  lea r9, [rip+.L.data.main.18]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov rdi, 1
+  cmp rdi, 1
+  setle r8b
+  movzx r8, r8b
+  lea r9, [rip+.L.data.main.19]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  mov rdi, 2
+  cmp rdi, 1
+  setle r8b
+  movzx r8, r8b
+  lea r9, [rip+.L.data.main.20]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov rdi, 0
+  cmp rdi, 1
+  setl r8b
+  movzx r8, r8b
+  lea r9, [rip+.L.data.main.21]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  mov rdi, 1
+  cmp rdi, 1
+  setl r8b
+  movzx r8, r8b
+  lea r9, [rip+.L.data.main.22]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  mov rdi, 2
+  cmp rdi, 1
+  setl r8b
+  movzx r8, r8b
+  lea r9, [rip+.L.data.main.23]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov rdi, 0
+  cmp rdi, 1
+  setle r8b
+  movzx r8, r8b
+  lea r9, [rip+.L.data.main.24]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov rdi, 1
+  cmp rdi, 1
+  setle r8b
+  movzx r8, r8b
+  lea r9, [rip+.L.data.main.25]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  mov rdi, 2
+  cmp rdi, 1
+  setle r8b
+  movzx r8, r8b
+  lea r9, [rip+.L.data.main.26]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov dword ptr [rbp-4004], 3
+  movsxd r8, dword ptr [rbp-4004]
+  lea r9, [rip+.L.data.main.27]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov dword ptr [rbp-4000], 3
+  mov dword ptr [rbp-3996], 5
+  movsxd r8, dword ptr [rbp-4000]
+  movsxd rdi, dword ptr [rbp-3996]
+  add r8, rdi
+  lea r9, [rip+.L.data.main.28]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov dword ptr [rbp-3992], 3
+  movsxd r8, dword ptr [rbp-3992]
+  lea r9, [rip+.L.data.main.29]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov dword ptr [rbp-3988], 3
+  mov dword ptr [rbp-3984], 5
+  movsxd r8, dword ptr [rbp-3988]
+  movsxd rdi, dword ptr [rbp-3984]
+  add r8, rdi
+  lea r9, [rip+.L.data.main.30]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov dword ptr [rbp-3980], 3
+  movsxd r8, dword ptr [rbp-3980]
+  lea r9, [rip+.L.data.main.31]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov dword ptr [rbp-3976], 3
+  mov dword ptr [rbp-3972], 5
+  movsxd r8, dword ptr [rbp-3976]
+  movsxd rdi, dword ptr [rbp-3972]
+  add r8, rdi
+  lea r9, [rip+.L.data.main.32]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4024], 3
+  mov rax, 0
+  call ret3
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.33]
+  mov rdi, qword ptr [rbp-4024]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov dword ptr [rbp-3968], 0
+  mov dword ptr [rbp-3968], 3
+  movsxd r8, dword ptr [rbp-3968]
+  lea r9, [rip+.L.data.main.34]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov dword ptr [rbp-3964], 0
+  mov rdi, 1
+  sub rdi, 1
+  cmp rdi, 0
+  je .L.else.main.4
+  mov dword ptr [rbp-3964], 2
+  jmp .L.end.main.5
+.L.else.main.4:
+  mov dword ptr [rbp-3964], 3
+.L.end.main.5:
+  movsxd r8, dword ptr [rbp-3964]
+  lea r9, [rip+.L.data.main.35]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov dword ptr [rbp-3960], 0
+  mov dword ptr [rbp-3960], 2
+  movsxd r8, dword ptr [rbp-3960]
+  lea r9, [rip+.L.data.main.36]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov dword ptr [rbp-3956], 0
+  mov rdi, 2
+  sub rdi, 1
+  cmp rdi, 0
+  je .L.else.main.8
+  mov dword ptr [rbp-3956], 2
+  jmp .L.end.main.9
+.L.else.main.8:
+  mov dword ptr [rbp-3956], 3
+.L.end.main.9:
+  movsxd r8, dword ptr [rbp-3956]
+  lea r9, [rip+.L.data.main.37]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov r8, 3
+  lea r9, [rip+.L.data.main.38]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 10
+  mov dword ptr [rbp-3952], 0
+  mov dword ptr [rbp-3952], 0
+  movsxd rdi, dword ptr [rbp-3952]
+  cmp rdi, 10
+  jge .L.break.main.11
+  .p2align 4,,10
+.L.begin.main.12:
+  add dword ptr [rbp-3952], 1
+  movsxd rdi, dword ptr [rbp-3952]
+  cmp rdi, 10
+  jl .L.begin.main.12
+.L.break.main.11:
+  movsxd r8, dword ptr [rbp-3952]
+  lea r9, [rip+.L.data.main.39]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 55
+  mov dword ptr [rbp-3948], 0
+  mov dword ptr [rbp-3944], 0
+  movsxd rdi, dword ptr [rbp-3948]
+  cmp rdi, 10
+  jg .L.break.main.14
+  .p2align 4,,10
+.L.begin.main.15:
+  movsxd rdi, dword ptr [rbp-3948]
+  movsxd r8, dword ptr [rbp-3944]
+  add rdi, r8
+  mov dword ptr [rbp-3944], edi
+  add dword ptr [rbp-3948], 1
+  movsxd rdi, dword ptr [rbp-3948]
+  cmp rdi, 10
+  jle .L.begin.main.15
+.L.break.main.14:
+  movsxd r8, dword ptr [rbp-3944]
+  lea r9, [rip+.L.data.main.40]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 55
+  mov dword ptr [rbp-3940], 0
+  mov dword ptr [rbp-3936], 0
+  mov dword ptr [rbp-3940], 0
+  movsxd rdi, dword ptr [rbp-3940]
+  cmp rdi, 10
+  jg .L.break.main.17
+  .p2align 4,,10
+.L.begin.main.18:
+  movsxd rdi, dword ptr [rbp-3940]
+  movsxd r8, dword ptr [rbp-3936]
+  add rdi, r8
+  mov dword ptr [rbp-3936], edi
+  add dword ptr [rbp-3940], 1
+  movsxd rdi, dword ptr [rbp-3940]
+  cmp rdi, 10
+  jle .L.begin.main.18
+.L.break.main.17:
+  movsxd r8, dword ptr [rbp-3936]
+  lea r9, [rip+.L.data.main.41]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4032], 8
+  mov rsi, 3
+  mov r8, 5
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call add2
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.42]
+  mov rdi, qword ptr [rbp-4032]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4040], 2
+  mov rsi, 5
+  mov r8, 3
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call sub2
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.43]
+  mov rdi, qword ptr [rbp-4040]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4048], 21
+  mov rsi, 1
+  mov r8, 2
+  mov r9, 3
+  mov r10, 4
+  mov r11, 5
+  mov qword ptr [rbp-4056], 6
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov r8, r11
+  mov r9, qword ptr [rbp-4056]
+  mov rax, 0
+  call add6
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.44]
+  mov rdi, qword ptr [rbp-4048]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4072], 136
+  mov qword ptr [rbp-4064], 1
+  mov qword ptr [rbp-4080], 2
+  mov qword ptr [rbp-4088], 3
+  mov qword ptr [rbp-4096], 4
+  mov qword ptr [rbp-4104], 5
+  mov qword ptr [rbp-4112], 6
+  mov qword ptr [rbp-4120], 7
+  mov qword ptr [rbp-4128], 8
+  mov rdi, 9
+  mov r9, 10
+  mov r10, 11
+  mov r11, 12
+  mov rcx, 13
+  mov r8, 14
+  mov rsi, 15
+  add rsi, 16
+  add r8, rsi
+  add rcx, r8
+  add r11, rcx
+  add r10, r11
+  add r9, r10
+  add rdi, r9
+  add qword ptr [rbp-4128], rdi
+  mov rax, qword ptr [rbp-4128]
+  add qword ptr [rbp-4120], rax
+  mov rax, qword ptr [rbp-4120]
+  add qword ptr [rbp-4112], rax
+  mov rax, qword ptr [rbp-4112]
+  add qword ptr [rbp-4104], rax
+  mov rax, qword ptr [rbp-4104]
+  add qword ptr [rbp-4096], rax
+  mov rax, qword ptr [rbp-4096]
+  add qword ptr [rbp-4088], rax
+  mov rax, qword ptr [rbp-4088]
+  add qword ptr [rbp-4080], rax
+  mov rax, qword ptr [rbp-4080]
+  add qword ptr [rbp-4064], rax
+  lea r8, [rip+.L.data.main.45]
+  mov rdi, qword ptr [rbp-4072]
+  mov rsi, qword ptr [rbp-4064]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4136], 291054
+  mov qword ptr [rbp-4144], 1
+  mov rsi, 2
+  mov r8, 3
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call add2
+  mov rsi, rax
+  mov rdi, qword ptr [rbp-4144]
+  mov rax, 0
+  call add2
+  mov qword ptr [rbp-4152], rax
+  mov qword ptr [rbp-4160], 4
+  mov qword ptr [rbp-4168], 5
+  mov qword ptr [rbp-4176], 6
+  mov qword ptr [rbp-4184], 7
+  mov qword ptr [rbp-4192], 8
+  mov qword ptr [rbp-4200], 9
+  mov qword ptr [rbp-4208], 10
+  mov qword ptr [rbp-4216], 11
+  mov qword ptr [rbp-4224], 12
+  mov rsi, 1
+  mov r8, 2
+  mov r9, 3
+  mov r10, 4
+  mov r11, 5
+  mov qword ptr [rbp-4232], 6
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov r8, r11
+  mov r9, qword ptr [rbp-4232]
+  mov rax, 0
+  call add6
+  mov qword ptr [rbp-4240], rax
+  mov rsi, 14
+  mov r8, 15
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call add2
+  mov rsi, rax
+  sub rsi, 13
+  mov rax, qword ptr [rbp-4240]
+  cqo
+  idiv rsi
+  add qword ptr [rbp-4224], rax
+  mov rax, qword ptr [rbp-4216]
+  imul rax, qword ptr [rbp-4224]
+  mov qword ptr [rbp-4216], rax
+  mov rax, qword ptr [rbp-4216]
+  add qword ptr [rbp-4208], rax
+  mov rax, qword ptr [rbp-4200]
+  imul rax, qword ptr [rbp-4208]
+  mov qword ptr [rbp-4200], rax
+  mov rax, qword ptr [rbp-4200]
+  add qword ptr [rbp-4192], rax
+  mov rax, qword ptr [rbp-4184]
+  imul rax, qword ptr [rbp-4192]
+  mov qword ptr [rbp-4184], rax
+  mov rax, qword ptr [rbp-4184]
+  add qword ptr [rbp-4176], rax
+  mov rax, qword ptr [rbp-4168]
+  imul rax, qword ptr [rbp-4176]
+  mov qword ptr [rbp-4168], rax
+  mov rax, qword ptr [rbp-4168]
+  add qword ptr [rbp-4160], rax
+  mov rax, qword ptr [rbp-4152]
+  imul rax, qword ptr [rbp-4160]
+  mov qword ptr [rbp-4152], rax
+  lea r8, [rip+.L.data.main.46]
+  mov rdi, qword ptr [rbp-4136]
+  mov rsi, qword ptr [rbp-4152]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4248], 55
+  mov rdi, 9
+  mov rax, 0
+  call fib
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.47]
+  mov rdi, qword ptr [rbp-4248]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4256], 143
+  mov rdi, 10
+  mov rax, 0
+  call sum_fib
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.48]
+  mov rdi, qword ptr [rbp-4256]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4264], 456123
+  mov rsi, 1
+  mov r8, 2
+  mov r9, 3
+  mov r10, 4
+  mov r11, 5
+  mov qword ptr [rbp-4272], 6
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov r8, r11
+  mov r9, qword ptr [rbp-4272]
+  mov rax, 0
+  call rotate6
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.49]
+  mov rdi, qword ptr [rbp-4264]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4280], 3
+  mov rsi, 2
+  mov r8, 5
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call swap_args
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.50]
+  mov rdi, qword ptr [rbp-4280]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4288], 0
+  sub qword ptr [rbp-4288], 128
+  mov rdi, 127
+  mov rax, 0
+  call inc_char
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.51]
+  mov rdi, qword ptr [rbp-4288]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4296], 240
+  mov rdi, 2
+  mov rax, 0
+  call sum_small_array
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.52]
+  mov rdi, qword ptr [rbp-4296]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4304], 6048
+  mov rdi, 3
+  mov rax, 0
+  call sum_large_array
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.53]
+  mov rdi, qword ptr [rbp-4304]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4312], 6288
+  mov rdi, 2
+  mov rax, 0
+  call sum_small_array
+  mov qword ptr [rbp-4320], rax
+  mov rdi, 3
+  mov rax, 0
+  call sum_large_array
+  add qword ptr [rbp-4320], rax
+  lea r8, [rip+.L.data.main.54]
+  mov rdi, qword ptr [rbp-4312]
+  mov rsi, qword ptr [rbp-4320]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4328], 7053
+  mov rsi, 100
+  mov r8, 14
+  mov r9, 3
+  mov r10, 2
+  mov r11, 50
+  mov qword ptr [rbp-4336], 10
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov r8, r11
+  mov r9, qword ptr [rbp-4336]
+  mov rax, 0
+  call mix_params
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.55]
+  mov rdi, qword ptr [rbp-4328]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4344], 26
+  mov rsi, 1
+  mov r8, 2
+  mov r9, 3
+  mov r10, 4
+  mov r11, 5
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov r8, r11
+  mov rax, 0
+  call scale_call
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.56]
+  mov rdi, qword ptr [rbp-4344]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4352], 1
+  mov rdi, 0
+  mov rax, 0
+  call bool_add
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.57]
+  mov rdi, qword ptr [rbp-4352]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4360], 411
+  lea rdi, [rip+.L.data.main.58]
+  mov rax, 0
+  call bool_inc_loop
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.59]
+  mov rdi, qword ptr [rbp-4360]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4368], 1
+  movabs rdi, 3000000000
+  mov rax, 0
+  call switch_wide
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.60]
+  mov rdi, qword ptr [rbp-4368]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4376], 2
+  mov rsi, 0
+  movabs rdi, 3000000000
+  sub rsi, rdi
+  mov rdi, rsi
+  mov rax, 0
+  call switch_wide
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.61]
+  mov rdi, qword ptr [rbp-4376]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4384], 3
+  mov rdi, 5
+  mov rax, 0
+  call switch_wide
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.62]
+  mov rdi, qword ptr [rbp-4384]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4392], 0
+  mov rsi, 0
+  sub rsi, 1294967296
+  mov rdi, rsi
+  mov rax, 0
+  call switch_wide
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.63]
+  mov rdi, qword ptr [rbp-4392]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4400], 1
+  mov rsi, 0
+  movabs rdi, 3000000000
+  sub rsi, rdi
+  mov rdi, rsi
+  mov rax, 0
+  call switch_wide_split
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.64]
+  mov rdi, qword ptr [rbp-4400]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4408], 4
+  movabs rdi, 3000000000
+  mov rax, 0
+  call switch_wide_split
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.65]
+  mov rdi, qword ptr [rbp-4408]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4416], 5
+  movabs rdi, 7000000000
+  mov rax, 0
+  call switch_wide_split
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.66]
+  mov rdi, qword ptr [rbp-4416]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4424], 0
+  mov rdi, 6
+  mov rax, 0
+  call switch_wide_split
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.67]
+  mov rdi, qword ptr [rbp-4424]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4432], 1
+  movabs rdi, 3000000000
+  mov rax, 0
+  call switch_wide_table
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.68]
+  mov rdi, qword ptr [rbp-4432]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4440], 4
+  movabs rdi, 3000000004
+  mov rax, 0
+  call switch_wide_table
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.69]
+  mov rdi, qword ptr [rbp-4440]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4448], 0
+  movabs rdi, 3000000003
+  mov rax, 0
+  call switch_wide_table
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.70]
+  mov rdi, qword ptr [rbp-4448]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4456], 0
+  mov rdi, 4
+  mov rax, 0
+  call switch_wide_table
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.71]
+  mov rdi, qword ptr [rbp-4456]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4464], 1
+  mov rsi, 0
+  sub rsi, 1294967296
+  mov rdi, rsi
+  mov rax, 0
+  call switch_int
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.72]
+  mov rdi, qword ptr [rbp-4464]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4472], 7864346
+  lea rsi, [rip+spill_g]
+  add rsi, 8
+  mov qword ptr [rsi], 3
+  mov rsi, 1
+  mov r8, 1
+  mov r9, 2
+  mov r10, 3
+  mov r11, 4
+  mov qword ptr [rbp-4480], 5
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov r8, r11
+  mov r9, qword ptr [rbp-4480]
+  mov rax, 0
+  call spill_addr
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.73]
+  mov rdi, qword ptr [rbp-4472]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4488], 0
+  sub qword ptr [rbp-4488], 1
+  mov rsi, 0
+  sub rsi, 5
+  mov rdi, rsi
+  mov rax, 0
+  call classify
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.74]
+  mov rdi, qword ptr [rbp-4488]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4496], 0
+  mov rdi, 0
+  mov rax, 0
+  call classify
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.75]
+  mov rdi, qword ptr [rbp-4496]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4504], 1
+  mov rdi, 7
+  mov rax, 0
+  call classify
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.76]
+  mov rdi, qword ptr [rbp-4504]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4512], 1
+  mov rdi, 3
+  mov rax, 0
+  call classify
+  mov qword ptr [rbp-4520], rax
+  mov rsi, 0
+  sub rsi, 2
+  mov rdi, rsi
+  mov rax, 0
+  call classify
+  add qword ptr [rbp-4520], rax
+  mov rdi, 9
+  mov rax, 0
+  call classify
+  add qword ptr [rbp-4520], rax
+  lea r8, [rip+.L.data.main.77]
+  mov rdi, qword ptr [rbp-4512]
+  mov rsi, qword ptr [rbp-4520]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4528], 2
+  mov rdi, 0
+  mov rax, 0
+  call day_kind
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.78]
+  mov rdi, qword ptr [rbp-4528]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4536], 2
+  mov rdi, 6
+  mov rax, 0
+  call day_kind
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.79]
+  mov rdi, qword ptr [rbp-4536]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4544], 1
+  mov rdi, 3
+  mov rax, 0
+  call day_kind
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.80]
+  mov rdi, qword ptr [rbp-4544]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4552], 0
+  mov rdi, 4
+  mov rax, 0
+  call day_kind
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.81]
+  mov rdi, qword ptr [rbp-4552]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4560], 3
+  mov rdi, 3
+  mov rax, 0
+  call skip_to
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.82]
+  mov rdi, qword ptr [rbp-4560]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4568], 70
+  mov rdi, 7
+  mov rax, 0
+  call skip_to
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.83]
+  mov rdi, qword ptr [rbp-4568]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4576], 83
+  mov rdi, 3
+  mov rax, 0
+  call skip_to
+  mov qword ptr [rbp-4584], rax
+  mov rdi, 8
+  mov rax, 0
+  call skip_to
+  add qword ptr [rbp-4584], rax
+  lea r8, [rip+.L.data.main.84]
+  mov rdi, qword ptr [rbp-4576]
+  mov rsi, qword ptr [rbp-4584]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4592], 2040
+  mov rsi, 4
+  mov r8, 5
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call sum_grid
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.85]
+  mov rdi, qword ptr [rbp-4592]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4600], 0
+  mov rsi, 0
+  mov r8, 5
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call sum_grid
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.86]
+  mov rdi, qword ptr [rbp-4600]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4608], 20
+  mov rdi, 5
+  mov rax, 0
+  call count_stored
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.87]
+  mov rdi, qword ptr [rbp-4608]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4616], 10
+  mov dword ptr [rip+loop_g], 1
+  lea rsi, [rip+loop_g]
+  mov r8, 4
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call sum_through
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.88]
+  mov rdi, qword ptr [rbp-4616]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4624], 8
+  mov dword ptr [rbp-3932], 0
+  mov dword ptr [rip+loop_g], 2
+  lea rsi, [rbp-3932]
+  mov r8, 4
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call sum_through
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.89]
+  mov rdi, qword ptr [rbp-4624]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4632], 10
+  mov rdi, 4
+  mov rax, 0
+  call sum_local_through
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.90]
+  mov rdi, qword ptr [rbp-4632]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4640], 0
+  mov rsi, 0
+  mov r8, 0
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call sum_deref
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.91]
+  mov rdi, qword ptr [rbp-4640]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4648], 21
+  mov dword ptr [rbp-3928], 7
+  lea rsi, [rbp-3928]
+  mov r8, 3
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call sum_deref
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.92]
+  mov rdi, qword ptr [rbp-4648]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4656], 2
+  mov dword ptr [rbp-3924], 0
+  lea rdi, [rbp-3924]
+  mov rax, 0
+  call bump
+  lea rdi, [rbp-3924]
+  mov rax, 0
+  call bump
+  movsxd rsi, dword ptr [rbp-3924]
+  lea r8, [rip+.L.data.main.93]
+  mov rdi, qword ptr [rbp-4656]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4664], 64
+  mov dword ptr [rbp-3920], 3
+  movsxd rsi, dword ptr [rbp-3920]
+  add rsi, 1
+  mov dword ptr [rbp-3920], esi
+  sub rsi, 1
+  mov rdi, rsi
+  mov rax, 0
+  call twice
+  mov dword ptr [rbp-3916], eax
+  movsxd rsi, dword ptr [rbp-3916]
+  lea rsi, [rsi+rsi*4]
+  shl rsi, 1
+  movsxd rdi, dword ptr [rbp-3920]
+  add rsi, rdi
+  lea r8, [rip+.L.data.main.94]
+  mov rdi, qword ptr [rbp-4664]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4672], 24
+  mov rdi, 3
+  mov rax, 0
+  call twice
+  mov rdi, rax
+  mov rax, 0
+  call twice
+  mov rdi, rax
+  mov rax, 0
+  call twice
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.95]
+  mov rdi, qword ptr [rbp-4672]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov dword ptr [rbp-3912], 3
+  movsxd r8, dword ptr [rbp-3912]
+  lea r9, [rip+.L.data.main.96]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov dword ptr [rbp-3908], 3
+  lea rdi, [rbp-3908]
+  mov qword ptr [rbp-3904], rdi
+  lea rdi, [rbp-3904]
+  mov qword ptr [rbp-3896], rdi
+  mov rdi, qword ptr [rbp-3896]
+  mov rdi, qword ptr [rdi]
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.97]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 5
+  mov dword ptr [rbp-3884], 3
+  mov dword ptr [rbp-3880], 5
+  lea rdi, [rbp-3884]
+  add rdi, 4
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.98]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 5
+  mov dword ptr [rbp-3876], 3
+  mov dword ptr [rbp-3872], 5
+  lea rdi, [rbp-3876]
+  add rdi, 4
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.99]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov dword ptr [rbp-3868], 3
+  mov dword ptr [rbp-3864], 5
+  lea rdi, [rbp-3864]
+  sub rdi, 4
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.100]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov dword ptr [rbp-3860], 3
+  lea r8, [rbp-3860]
+  add r8, 8
+  lea rdi, [rbp-3860]
+  sub r8, rdi
+  sar r8, 2
+  lea r9, [rip+.L.data.main.101]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 5
+  mov dword ptr [rbp-3856], 3
+  mov dword ptr [rbp-3852], 5
+  lea rdi, [rbp-3856]
+  mov qword ptr [rbp-3848], rdi
+  mov rdi, qword ptr [rbp-3848]
+  add rdi, 4
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.102]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov dword ptr [rbp-3840], 3
+  mov dword ptr [rbp-3836], 5
+  lea rdi, [rbp-3836]
+  mov qword ptr [rbp-3832], rdi
+  mov rdi, qword ptr [rbp-3832]
+  sub rdi, 4
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.103]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 5
+  mov dword ptr [rbp-3820], 3
+  lea rdi, [rbp-3820]
+  mov qword ptr [rbp-3816], rdi
+  mov rdi, qword ptr [rbp-3816]
+  mov dword ptr [rdi], 5
+  movsxd r8, dword ptr [rbp-3820]
+  lea r9, [rip+.L.data.main.104]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 7
+  mov dword ptr [rbp-3808], 3
+  mov dword ptr [rbp-3804], 5
+  lea rdi, [rbp-3808]
+  add rdi, 4
+  mov dword ptr [rdi], 7
+  movsxd r8, dword ptr [rbp-3804]
+  lea r9, [rip+.L.data.main.105]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 7
+  mov dword ptr [rbp-3800], 3
+  mov dword ptr [rbp-3796], 5
+  lea rdi, [rbp-3796]
+  sub rdi, 4
+  mov dword ptr [rdi], 7
+  movsxd r8, dword ptr [rbp-3800]
+  lea r9, [rip+.L.data.main.106]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4680], 8
+  mov dword ptr [rbp-3792], 3
+  mov dword ptr [rbp-3788], 5
+  lea rsi, [rbp-3792]
+  movsxd r8, dword ptr [rbp-3788]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call addx
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.107]
+  mov rdi, qword ptr [rbp-4680]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  lea rdi, [rbp-3784]
+  mov qword ptr [rbp-3776], rdi
+  mov rdi, qword ptr [rbp-3776]
+  mov dword ptr [rdi], 3
+  movsxd r8, dword ptr [rbp-3784]
+  lea r9, [rip+.L.data.main.108]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov dword ptr [rbp-3764], 3
+  lea rdi, [rbp-3764]
+  add rdi, 4
+  mov dword ptr [rdi], 4
+  lea rdi, [rbp-3764]
+  add rdi, 8
+  mov dword ptr [rdi], 5
+  movsxd r8, dword ptr [rbp-3764]
+  lea r9, [rip+.L.data.main.109]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  mov dword ptr [rbp-3752], 3
+  lea rdi, [rbp-3752]
+  add rdi, 4
+  mov dword ptr [rdi], 4
+  lea rdi, [rbp-3752]
+  add rdi, 8
+  mov dword ptr [rdi], 5
+  lea rdi, [rbp-3752]
+  add rdi, 4
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.110]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 5
+  mov dword ptr [rbp-3740], 3
+  lea rdi, [rbp-3740]
+  add rdi, 4
+  mov dword ptr [rdi], 4
+  lea rdi, [rbp-3740]
+  add rdi, 8
+  mov dword ptr [rdi], 5
+  lea rdi, [rbp-3740]
+  add rdi, 8
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.111]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  lea rdi, [rbp-3728]
+  mov qword ptr [rbp-3704], rdi
+  mov rdi, qword ptr [rbp-3704]
+  mov dword ptr [rdi], 0
+  movsxd r8, dword ptr [rbp-3728]
+  lea r9, [rip+.L.data.main.112]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  lea rdi, [rbp-3696]
+  mov qword ptr [rbp-3672], rdi
+  mov rdi, qword ptr [rbp-3672]
+  add rdi, 4
+  mov dword ptr [rdi], 1
+  lea rdi, [rbp-3696]
+  add rdi, 4
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.113]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  lea rdi, [rbp-3664]
+  mov qword ptr [rbp-3640], rdi
+  mov rdi, qword ptr [rbp-3640]
+  add rdi, 8
+  mov dword ptr [rdi], 2
+  lea rdi, [rbp-3664]
+  add rdi, 8
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.114]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  lea rdi, [rbp-3632]
+  mov qword ptr [rbp-3608], rdi
+  mov rdi, qword ptr [rbp-3608]
+  add rdi, 12
+  mov dword ptr [rdi], 3
+  lea rdi, [rbp-3632]
+  add rdi, 12
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.115]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  lea rdi, [rbp-3600]
+  mov qword ptr [rbp-3576], rdi
+  mov rdi, qword ptr [rbp-3576]
+  add rdi, 16
+  mov dword ptr [rdi], 4
+  lea rdi, [rbp-3600]
+  add rdi, 12
+  add rdi, 4
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.116]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 5
+  lea rdi, [rbp-3568]
+  mov qword ptr [rbp-3544], rdi
+  mov rdi, qword ptr [rbp-3544]
+  add rdi, 20
+  mov dword ptr [rdi], 5
+  lea rdi, [rbp-3568]
+  add rdi, 12
+  add rdi, 8
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.117]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 6
+  lea rdi, [rbp-3536]
+  mov qword ptr [rbp-3512], rdi
+  mov rdi, qword ptr [rbp-3512]
+  add rdi, 24
+  mov dword ptr [rdi], 6
+  lea rdi, [rbp-3536]
+  add rdi, 24
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.118]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov dword ptr [rbp-3500], 3
+  lea rdi, [rbp-3500]
+  add rdi, 4
+  mov dword ptr [rdi], 4
+  lea rdi, [rbp-3500]
+  add rdi, 8
+  mov dword ptr [rdi], 5
+  movsxd r8, dword ptr [rbp-3500]
+  lea r9, [rip+.L.data.main.119]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  mov dword ptr [rbp-3488], 3
+  lea rdi, [rbp-3488]
+  add rdi, 4
+  mov dword ptr [rdi], 4
+  lea rdi, [rbp-3488]
+  add rdi, 8
+  mov dword ptr [rdi], 5
+  lea rdi, [rbp-3488]
+  add rdi, 4
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.120]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 5
+  mov dword ptr [rbp-3476], 3
+  lea rdi, [rbp-3476]
+  add rdi, 4
+  mov dword ptr [rdi], 4
+  lea rdi, [rbp-3476]
+  add rdi, 8
+  mov dword ptr [rdi], 5
+  lea rdi, [rbp-3476]
+  add rdi, 8
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.121]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 5
+  mov dword ptr [rbp-3464], 3
+  lea rdi, [rbp-3464]
+  add rdi, 4
+  mov dword ptr [rdi], 4
+  lea rdi, [rbp-3464]
+  add rdi, 8
+  mov dword ptr [rdi], 5
+  lea rdi, [rbp-3464]
+  add rdi, 8
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.122]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 5
+  mov dword ptr [rbp-3452], 3
+  lea rdi, [rbp-3452]
+  add rdi, 4
+  mov dword ptr [rdi], 4
+  lea rdi, [rbp-3452]
+  add rdi, 8
+  mov dword ptr [rdi], 5
+  lea rdi, [rbp-3452]
+  add rdi, 8
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.123]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  lea rdi, [rbp-3440]
+  mov qword ptr [rbp-3416], rdi
+  mov rdi, qword ptr [rbp-3416]
+  add rdi, 0
+  mov dword ptr [rdi], 0
+  lea rdi, [rbp-3440]
+  add rdi, 0
+  add rdi, 0
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.124]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  lea rdi, [rbp-3408]
+  mov qword ptr [rbp-3384], rdi
+  mov rdi, qword ptr [rbp-3384]
+  add rdi, 4
+  mov dword ptr [rdi], 1
+  lea rdi, [rbp-3408]
+  add rdi, 0
+  add rdi, 4
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.125]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  lea rdi, [rbp-3376]
+  mov qword ptr [rbp-3352], rdi
+  mov rdi, qword ptr [rbp-3352]
+  add rdi, 8
+  mov dword ptr [rdi], 2
+  lea rdi, [rbp-3376]
+  add rdi, 0
+  add rdi, 8
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.126]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  lea rdi, [rbp-3344]
+  mov qword ptr [rbp-3320], rdi
+  mov rdi, qword ptr [rbp-3320]
+  add rdi, 12
+  mov dword ptr [rdi], 3
+  lea rdi, [rbp-3344]
+  add rdi, 12
+  add rdi, 0
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.127]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  lea rdi, [rbp-3312]
+  mov qword ptr [rbp-3288], rdi
+  mov rdi, qword ptr [rbp-3288]
+  add rdi, 16
+  mov dword ptr [rdi], 4
+  lea rdi, [rbp-3312]
+  add rdi, 12
+  add rdi, 4
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.128]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 5
+  lea rdi, [rbp-3280]
+  mov qword ptr [rbp-3256], rdi
+  mov rdi, qword ptr [rbp-3256]
+  add rdi, 20
+  mov dword ptr [rdi], 5
+  lea rdi, [rbp-3280]
+  add rdi, 12
+  add rdi, 8
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.129]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 6
+  lea rdi, [rbp-3248]
+  mov qword ptr [rbp-3224], rdi
+  mov rdi, qword ptr [rbp-3224]
+  add rdi, 24
+  mov dword ptr [rdi], 6
+  lea rdi, [rbp-3248]
+  add rdi, 24
+  add rdi, 0
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.130]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  mov r8, 4
+  lea r9, [rip+.L.data.main.131]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  mov r8, 4
+  lea r9, [rip+.L.data.main.132]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.133]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 16
+  mov r8, 16
+  lea r9, [rip+.L.data.main.134]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 48
+  mov r8, 48
+  lea r9, [rip+.L.data.main.135]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 16
+  mov r8, 16
+  lea r9, [rip+.L.data.main.136]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  mov r8, 4
+  lea r9, [rip+.L.data.main.137]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 5
+  mov r8, 4
+  add r8, 1
+  lea r9, [rip+.L.data.main.138]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 5
+  mov r8, 4
+  add r8, 1
+  lea r9, [rip+.L.data.main.139]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.140]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  movsxd r8, dword ptr [rip+g1]
+  lea r9, [rip+.L.data.main.141]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov dword ptr [rip+g1], 3
+  mov rsi, 3
+  movsxd r8, dword ptr [rip+g1]
+  lea r9, [rip+.L.data.main.142]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  lea rsi, [rip+g2]
+  add rsi, 0
+  mov dword ptr [rsi], 0
+  lea rsi, [rip+g2]
+  add rsi, 4
+  mov dword ptr [rsi], 1
+  lea rsi, [rip+g2]
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  lea rsi, [rip+g2]
+  add rsi, 12
+  mov dword ptr [rsi], 3
+  mov rsi, 0
+  lea rdi, [rip+g2]
+  add rdi, 0
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.143]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  lea rdi, [rip+g2]
+  add rdi, 4
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.144]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  lea rdi, [rip+g2]
+  add rdi, 8
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.145]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  lea rdi, [rip+g2]
+  add rdi, 12
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.146]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  mov r8, 4
+  lea r9, [rip+.L.data.main.147]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 16
+  mov r8, 16
+  lea r9, [rip+.L.data.main.148]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov byte ptr [rbp-2892], 1
+  movsx r8, byte ptr [rbp-2892]
+  lea r9, [rip+.L.data.main.149]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov byte ptr [rbp-2891], 1
+  mov byte ptr [rbp-2890], 2
+  movsx r8, byte ptr [rbp-2891]
+  lea r9, [rip+.L.data.main.150]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov byte ptr [rbp-2889], 1
+  mov byte ptr [rbp-2888], 2
+  movsx r8, byte ptr [rbp-2888]
+  lea r9, [rip+.L.data.main.151]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov r8, 1
+  lea r9, [rip+.L.data.main.152]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 10
+  mov r8, 10
+  lea r9, [rip+.L.data.main.153]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4688], 1
+  mov rsi, 7
+  mov r8, 3
+  mov r9, 3
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call sub_char
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.154]
+  mov rdi, qword ptr [rbp-4688]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov rsi, 97
+  lea rdi, [rip+.L.data.main.155]
+  add rdi, 0
+  movsx r8, byte ptr [rdi]
+  lea r9, [rip+.L.data.main.156]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 98
+  lea rdi, [rip+.L.data.main.157]
+  add rdi, 1
+  movsx r8, byte ptr [rdi]
+  lea r9, [rip+.L.data.main.158]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 99
+  lea rdi, [rip+.L.data.main.159]
+  add rdi, 2
+  movsx r8, byte ptr [rdi]
+  lea r9, [rip+.L.data.main.160]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  lea rdi, [rip+.L.data.main.161]
+  add rdi, 3
+  movsx r8, byte ptr [rdi]
+  lea r9, [rip+.L.data.main.162]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  mov r8, 4
+  lea r9, [rip+.L.data.main.164]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 7
+  lea rdi, [rip+.L.data.main.165]
+  add rdi, 0
+  movsx r8, byte ptr [rdi]
+  lea r9, [rip+.L.data.main.166]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  lea rdi, [rip+.L.data.main.167]
+  add rdi, 0
+  movsx r8, byte ptr [rdi]
+  lea r9, [rip+.L.data.main.168]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 9
+  lea rdi, [rip+.L.data.main.169]
+  add rdi, 0
+  movsx r8, byte ptr [rdi]
+  lea r9, [rip+.L.data.main.170]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 10
+  lea rdi, [rip+.L.data.main.171]
+  add rdi, 0
+  movsx r8, byte ptr [rdi]
+  lea r9, [rip+.L.data.main.172]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 11
+  lea rdi, [rip+.L.data.main.173]
+  add rdi, 0
+  movsx r8, byte ptr [rdi]
+  lea r9, [rip+.L.data.main.174]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 12
+  lea rdi, [rip+.L.data.main.175]
+  add rdi, 0
+  movsx r8, byte ptr [rdi]
+  lea r9, [rip+.L.data.main.176]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 13
+  lea rdi, [rip+.L.data.main.177]
+  add rdi, 0
+  movsx r8, byte ptr [rdi]
+  lea r9, [rip+.L.data.main.178]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 27
+  lea rdi, [rip+.L.data.main.179]
+  add rdi, 0
+  movsx r8, byte ptr [rdi]
+  lea r9, [rip+.L.data.main.180]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  lea rdi, [rip+.L.data.main.181]
+  add rdi, 0
+  movsx r8, byte ptr [rdi]
+  lea r9, [rip+.L.data.main.182]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 106
+  lea rdi, [rip+.L.data.main.183]
+  add rdi, 0
+  movsx r8, byte ptr [rdi]
+  lea r9, [rip+.L.data.main.184]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 107
+  lea rdi, [rip+.L.data.main.185]
+  add rdi, 0
+  movsx r8, byte ptr [rdi]
+  lea r9, [rip+.L.data.main.186]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 108
+  lea rdi, [rip+.L.data.main.187]
+  add rdi, 0
+  movsx r8, byte ptr [rdi]
+  lea r9, [rip+.L.data.main.188]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov dword ptr [rbp-2876], 2
+  mov dword ptr [rbp-2872], 3
+  movsxd r8, dword ptr [rbp-2876]
+  lea r9, [rip+.L.data.main.189]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov dword ptr [rbp-2868], 2
+  mov dword ptr [rbp-2864], 3
+  mov dword ptr [rbp-2860], 4
+  movsxd r8, dword ptr [rbp-2868]
+  lea r9, [rip+.L.data.main.190]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov dword ptr [rbp-2856], 2
+  mov dword ptr [rbp-2856], 3
+  movsxd r8, dword ptr [rbp-2856]
+  lea r9, [rip+.L.data.main.191]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  lea rdi, [rbp-2852]
+  add rdi, 8
+  mov qword ptr [rbp-2832], rdi
+  mov r8, qword ptr [rbp-2832]
+  lea rdi, [rbp-2852]
+  sub r8, rdi
+  sar r8, 2
+  lea r9, [rip+.L.data.main.192]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov dword ptr [rbp-2820], 1
+  mov dword ptr [rbp-2816], 2
+  movsxd r8, dword ptr [rbp-2820]
+  lea r9, [rip+.L.data.main.193]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov dword ptr [rbp-2812], 1
+  mov dword ptr [rbp-2808], 2
+  movsxd r8, dword ptr [rbp-2808]
+  lea r9, [rip+.L.data.main.194]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov byte ptr [rbp-2804], 1
+  mov dword ptr [rbp-2800], 2
+  mov byte ptr [rbp-2796], 3
+  movsx r8, byte ptr [rbp-2804]
+  lea r9, [rip+.L.data.main.195]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov dword ptr [rbp-2788], 1
+  mov dword ptr [rbp-2788], 2
+  mov byte ptr [rbp-2784], 3
+  movsxd r8, dword ptr [rbp-2788]
+  lea r9, [rip+.L.data.main.196]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov byte ptr [rbp-2780], 1
+  mov dword ptr [rbp-2776], 2
+  mov byte ptr [rbp-2772], 3
+  movsx r8, byte ptr [rbp-2772]
+  lea r9, [rip+.L.data.main.197]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  lea rdi, [rbp-2768]
+  mov qword ptr [rbp-2744], rdi
+  mov rdi, qword ptr [rbp-2744]
+  add rdi, 0
+  mov dword ptr [rdi], 0
+  lea rdi, [rbp-2768]
+  add rdi, 0
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.198]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  lea rdi, [rbp-2736]
+  mov qword ptr [rbp-2712], rdi
+  mov rdi, qword ptr [rbp-2712]
+  add rdi, 4
+  mov dword ptr [rdi], 1
+  lea rdi, [rbp-2736]
+  add rdi, 0
+  movsxd r8, dword ptr [rdi+4]
+  lea r9, [rip+.L.data.main.199]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  lea rdi, [rbp-2704]
+  mov qword ptr [rbp-2680], rdi
+  mov rdi, qword ptr [rbp-2680]
+  add rdi, 8
+  mov dword ptr [rdi], 2
+  lea rdi, [rbp-2704]
+  add rdi, 8
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.200]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  lea rdi, [rbp-2672]
+  mov qword ptr [rbp-2648], rdi
+  mov rdi, qword ptr [rbp-2648]
+  add rdi, 12
+  mov dword ptr [rdi], 3
+  lea rdi, [rbp-2672]
+  add rdi, 8
+  movsxd r8, dword ptr [rdi+4]
+  lea r9, [rip+.L.data.main.201]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 6
+  lea rdi, [rbp-2640]
+  mov qword ptr [rbp-2608], rdi
+  lea rdi, [rbp-2640]
+  add rdi, 0
+  mov dword ptr [rdi], 6
+  mov rdi, qword ptr [rbp-2608]
+  add rdi, 0
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.202]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 7
+  lea rdi, [rbp-2600]
+  mov qword ptr [rbp-2568], rdi
+  lea rdi, [rbp-2588]
+  add rdi, 0
+  mov dword ptr [rdi], 7
+  mov rdi, qword ptr [rbp-2568]
+  add rdi, 12
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.203]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 6
+  mov dword ptr [rbp-2560], 6
+  movsxd r8, dword ptr [rbp-2560]
+  lea r9, [rip+.L.data.main.204]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  mov r8, 4
+  lea r9, [rip+.L.data.main.205]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.206]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 12
+  mov r8, 12
+  lea r9, [rip+.L.data.main.207]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 16
+  mov r8, 16
+  lea r9, [rip+.L.data.main.208]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 24
+  mov r8, 24
+  lea r9, [rip+.L.data.main.209]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov r8, 2
+  lea r9, [rip+.L.data.main.210]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.211]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.212]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 7
+  lea rdi, [rbp-2472]
+  mov dword ptr [rbp-2464], edi
+  lea rdi, [rbp-2465]
+  mov dword ptr [rbp-2460], edi
+  movsxd r8, dword ptr [rbp-2460]
+  movsxd rdi, dword ptr [rbp-2464]
+  sub r8, rdi
+  lea r9, [rip+.L.data.main.213]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  lea rdi, [rbp-2453]
+  mov dword ptr [rbp-2448], edi
+  lea rdi, [rbp-2452]
+  mov dword ptr [rbp-2444], edi
+  movsxd r8, dword ptr [rbp-2444]
+  movsxd rdi, dword ptr [rbp-2448]
+  sub r8, rdi
+  lea r9, [rip+.L.data.main.214]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov r8, 2
+  lea r9, [rip+.L.data.main.215]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov dword ptr [rbp-2436], 1
+  mov dword ptr [rbp-2432], 2
+  movsxd r8, dword ptr [rbp-2436]
+  movsxd rdi, dword ptr [rbp-2432]
+  add r8, rdi
+  lea r9, [rip+.L.data.main.216]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  lea rdi, [rbp-2425]
+  mov qword ptr [rbp-2424], rdi
+  mov byte ptr [rbp-2425], 3
+  mov rdi, qword ptr [rbp-2424]
+  movsx r8, byte ptr [rdi]
+  lea r9, [rip+.L.data.main.217]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  lea rdi, [rbp-2409]
+  mov qword ptr [rbp-2408], rdi
+  mov rdi, qword ptr [rbp-2408]
+  mov byte ptr [rdi], 3
+  movsx r8, byte ptr [rbp-2409]
+  lea r9, [rip+.L.data.main.218]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov dword ptr [rbp-2400], 1
+  movsxd r8, dword ptr [rbp-2400]
+  lea r9, [rip+.L.data.main.219]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov dword ptr [rbp-2396], 1
+  movsxd r8, dword ptr [rbp-2396]
+  lea r9, [rip+.L.data.main.220]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov dword ptr [rbp-2392], 1
+  movsxd r8, dword ptr [rbp-2392]
+  lea r9, [rip+.L.data.main.221]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov dword ptr [rbp-2388], 2
+  movsxd r8, dword ptr [rbp-2388]
+  lea r9, [rip+.L.data.main.222]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.223]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.224]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov r8, 2
+  lea r9, [rip+.L.data.main.225]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  mov r8, 4
+  lea r9, [rip+.L.data.main.226]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.227]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 16
+  mov r8, 16
+  lea r9, [rip+.L.data.main.228]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4696], 1
+  mov rsi, 7
+  mov r8, 3
+  mov r9, 3
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call sub_short
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.229]
+  mov rdi, qword ptr [rbp-4696]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4704], 1
+  mov rsi, 7
+  mov r8, 3
+  mov r9, 3
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call sub_long
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.230]
+  mov rdi, qword ptr [rbp-4704]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov rsi, 24
+  mov r8, 24
+  lea r9, [rip+.L.data.main.231]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.232]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  lea rdi, [rbp-2296]
+  add rdi, 0
+  lea r8, [rbp-2272]
+  mov qword ptr [rdi], r8
+  mov dword ptr [rbp-2272], 3
+  lea rdi, [rbp-2296]
+  add rdi, 0
+  mov rdi, qword ptr [rdi]
+  add rdi, 0
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.233]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  lea rdi, [rbp-2268]
+  mov qword ptr [rbp-2256], rdi
+  mov rdi, qword ptr [rbp-2256]
+  add rdi, 0
+  add rdi, 0
+  mov dword ptr [rdi], 4
+  mov rdi, qword ptr [rbp-2256]
+  add rdi, 0
+  add rdi, 0
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.234]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4712], 3
+  mov rax, 0
+  call g1_ptr
+  movsxd rsi, dword ptr [rax]
+  lea r8, [rip+.L.data.main.235]
+  mov rdi, qword ptr [rbp-4712]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  mov rdi, 0
+  cmp rdi, 0
+  setne dil
+  movzx rdi, dil
+  mov byte ptr [rbp-2237], dil
+  movsx r8, byte ptr [rbp-2237]
+  lea r9, [rip+.L.data.main.236]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov rdi, 1
+  cmp rdi, 0
+  setne dil
+  movzx rdi, dil
+  mov byte ptr [rbp-2236], dil
+  movsx r8, byte ptr [rbp-2236]
+  lea r9, [rip+.L.data.main.237]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov rdi, 2
+  cmp rdi, 0
+  setne dil
+  movzx rdi, dil
+  mov byte ptr [rbp-2235], dil
+  movsx r8, byte ptr [rbp-2235]
+  lea r9, [rip+.L.data.main.238]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov rdi, 0
+  cmp rdi, 0
+  setne dil
+  movzx rdi, dil
+  mov byte ptr [rbp-2234], dil
+  movsx r8, byte ptr [rbp-2234]
+  add r8, 5
+  cmp r8, 0
+  setne r8b
+  movzx r8, r8b
+  mov byte ptr [rbp-2234], r8b
+  lea r9, [rip+.L.data.main.239]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov rdi, 0
+  cmp rdi, 0
+  setne dil
+  movzx rdi, dil
+  mov byte ptr [rbp-2233], dil
+  mov rdi, 7
+  cmp rdi, 0
+  setne dil
+  movzx rdi, dil
+  mov byte ptr [rbp-2233], dil
+  mov qword ptr [rbp-2232], rdi
+  mov r8, qword ptr [rbp-2232]
+  lea r9, [rip+.L.data.main.240]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov rdi, 1
+  cmp rdi, 0
+  setne dil
+  movzx rdi, dil
+  mov byte ptr [rbp-2217], dil
+  movsx r8, byte ptr [rbp-2217]
+  add r8, 1
+  cmp r8, 0
+  setne r8b
+  movzx r8, r8b
+  mov byte ptr [rbp-2217], r8b
+  lea r9, [rip+.L.data.main.241]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 39
+  mov dword ptr [rbp-2216], 0
+  mov dword ptr [rbp-2212], 0
+  mov rdi, 1
+  cmp rdi, 0
+  setne dil
+  movzx rdi, dil
+  mov byte ptr [rbp-2206], dil
+  movsxd rdi, dword ptr [rbp-2216]
+  cmp rdi, 4
+  jge .L.break.main.20
+  .p2align 4,,10
+.L.begin.main.21:
+  add dword ptr [rbp-2216], 1
+  movsx rdi, byte ptr [rbp-2206]
+  add rdi, 1
+  cmp rdi, 0
+  setne dil
+  movzx rdi, dil
+  mov byte ptr [rbp-2206], dil
+  add dword ptr [rbp-2212], edi
+  shl dword ptr [rbp-2212], 1
+  movsxd rdi, dword ptr [rbp-2216]
+  cmp rdi, 4
+  jl .L.begin.main.21
+.L.break.main.20:
+  movsxd r8, dword ptr [rbp-2212]
+  movsxd rdi, dword ptr [rbp-2216]
+  imul rdi, 0
+  add r8, rdi
+  add r8, 9
+  lea r9, [rip+.L.data.main.242]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov rdi, 1
+  cmp rdi, 0
+  setne dil
+  movzx rdi, dil
+  mov byte ptr [rbp-2205], dil
+  movsx rdi, byte ptr [rbp-2205]
+  mov r8, rdi
+  add rdi, 1
+  cmp rdi, 0
+  setne dil
+  movzx rdi, dil
+  mov byte ptr [rbp-2205], dil
+  lea r9, [rip+.L.data.main.243]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov rdi, 1
+  cmp rdi, 0
+  setne dil
+  movzx rdi, dil
+  mov byte ptr [rbp-2204], dil
+  movsx rdi, byte ptr [rbp-2204]
+  add rdi, 1
+  cmp rdi, 0
+  setne dil
+  movzx rdi, dil
+  mov byte ptr [rbp-2204], dil
+  movsx r8, byte ptr [rbp-2204]
+  lea r9, [rip+.L.data.main.244]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  mov rdi, 0
+  cmp rdi, 0
+  setne dil
+  movzx rdi, dil
+  mov byte ptr [rbp-2203], dil
+  movsx rdi, byte ptr [rbp-2203]
+  mov r8, rdi
+  sub rdi, 1
+  cmp rdi, 0
+  setne dil
+  movzx rdi, dil
+  mov byte ptr [rbp-2203], dil
+  lea r9, [rip+.L.data.main.245]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov rdi, 0
+  cmp rdi, 0
+  setne dil
+  movzx rdi, dil
+  mov byte ptr [rbp-2202], dil
+  movsx rdi, byte ptr [rbp-2202]
+  sub rdi, 1
+  cmp rdi, 0
+  setne dil
+  movzx rdi, dil
+  mov byte ptr [rbp-2202], dil
+  movsx r8, byte ptr [rbp-2202]
+  lea r9, [rip+.L.data.main.246]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov rdi, 1
+  cmp rdi, 0
+  setne dil
+  movzx rdi, dil
+  mov byte ptr [rbp-2201], dil
+  lea rdi, [rbp-2201]
+  mov qword ptr [rbp-2200], rdi
+  movsx rdi, byte ptr [rbp-2201]
+  mov r8, rdi
+  add rdi, 1
+  cmp rdi, 0
+  setne dil
+  movzx rdi, dil
+  mov byte ptr [rbp-2201], dil
+  lea r9, [rip+.L.data.main.247]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov r8, 1
+  lea r9, [rip+.L.data.main.248]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov r8, 2
+  lea r9, [rip+.L.data.main.249]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov r8, 2
+  lea r9, [rip+.L.data.main.250]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  mov r8, 4
+  lea r9, [rip+.L.data.main.251]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  mov r8, 4
+  lea r9, [rip+.L.data.main.252]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  mov r8, 4
+  lea r9, [rip+.L.data.main.253]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.254]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.255]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.256]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.257]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov dword ptr [rbp-2136], 3
+  movsxd r8, dword ptr [rbp-2136]
+  lea r9, [rip+.L.data.main.258]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov r8, 1
+  lea r9, [rip+.L.data.main.259]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov r8, 2
+  lea r9, [rip+.L.data.main.260]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov r8, 2
+  lea r9, [rip+.L.data.main.261]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov r8, 2
+  lea r9, [rip+.L.data.main.262]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  mov r8, 4
+  lea r9, [rip+.L.data.main.263]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.264]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.265]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.266]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.267]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.268]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.269]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.270]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.271]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 32
+  mov r8, 32
+  lea r9, [rip+.L.data.main.272]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 16
+  mov r8, 16
+  lea r9, [rip+.L.data.main.273]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 48
+  mov r8, 48
+  lea r9, [rip+.L.data.main.274]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.275]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 131585
+  mov r8, 131585
+  lea r9, [rip+.L.data.main.276]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 513
+  mov r8, 513
+  lea r9, [rip+.L.data.main.277]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov r8, 1
+  lea r9, [rip+.L.data.main.278]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov r8, 1
+  cmp r8, 0
+  setne r8b
+  movsx r8, r8b
+  lea r9, [rip+.L.data.main.279]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov r8, 2
+  cmp r8, 0
+  setne r8b
+  movsx r8, r8b
+  lea r9, [rip+.L.data.main.280]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  mov r8, 0
+  cmp r8, 0
+  setne r8b
+  movsx r8, r8b
+  lea r9, [rip+.L.data.main.281]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov r8, 1
+  lea r9, [rip+.L.data.main.282]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  mov r8, 0
+  lea r9, [rip+.L.data.main.283]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 5
+  mov dword ptr [rbp-2132], 5
+  lea rdi, [rbp-2132]
+  mov qword ptr [rbp-2128], rdi
+  mov rdi, qword ptr [rbp-2128]
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.284]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 97
+  mov r8, 97
+  lea r9, [rip+.L.data.main.285]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 10
+  mov r8, 10
+  lea r9, [rip+.L.data.main.286]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 98
+  mov r8, 97
+  add r8, 1
+  lea r9, [rip+.L.data.main.287]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  mov r8, 4
+  lea r9, [rip+.L.data.main.288]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  mov r8, 0
+  lea r9, [rip+.L.data.main.289]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov r8, 1
+  lea r9, [rip+.L.data.main.290]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov r8, 2
+  lea r9, [rip+.L.data.main.291]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 5
+  mov r8, 5
+  lea r9, [rip+.L.data.main.292]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 6
+  mov r8, 6
+  lea r9, [rip+.L.data.main.293]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  mov r8, 0
+  lea r9, [rip+.L.data.main.294]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 5
+  mov r8, 5
+  lea r9, [rip+.L.data.main.295]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov r8, 3
+  lea r9, [rip+.L.data.main.296]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  mov r8, 4
+  lea r9, [rip+.L.data.main.297]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  mov r8, 4
+  lea r9, [rip+.L.data.main.298]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  mov r8, 4
+  lea r9, [rip+.L.data.main.299]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4720], 3
+  mov rax, 0
+  call static_fn
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.300]
+  mov rdi, qword ptr [rbp-4720]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov rsi, 55
+  mov dword ptr [rbp-2112], 0
+  mov dword ptr [rbp-2108], 0
+  movsxd rdi, dword ptr [rbp-2108]
+  cmp rdi, 10
+  jg .L.break.main.23
+  .p2align 4,,10
+.L.begin.main.24:
+  movsxd rdi, dword ptr [rbp-2112]
+  movsxd r8, dword ptr [rbp-2108]
+  add rdi, r8
+  mov dword ptr [rbp-2112], edi
+  add dword ptr [rbp-2108], 1
+  movsxd rdi, dword ptr [rbp-2108]
+  cmp rdi, 10
+  jle .L.begin.main.24
+.L.break.main.23:
+  movsxd r8, dword ptr [rbp-2112]
+  lea r9, [rip+.L.data.main.301]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov dword ptr [rbp-2104], 3
+  mov dword ptr [rbp-2100], 0
+  mov dword ptr [rbp-2096], 0
+  movsxd rdi, dword ptr [rbp-2096]
+  cmp rdi, 10
+  jg .L.break.main.26
+  .p2align 4,,10
+.L.begin.main.27:
+  movsxd rdi, dword ptr [rbp-2100]
+  movsxd r8, dword ptr [rbp-2096]
+  add rdi, r8
+  mov dword ptr [rbp-2100], edi
+  add dword ptr [rbp-2096], 1
+  movsxd rdi, dword ptr [rbp-2096]
+  cmp rdi, 10
+  jle .L.begin.main.27
+.L.break.main.26:
+  movsxd r8, dword ptr [rbp-2104]
+  lea r9, [rip+.L.data.main.302]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov r8, 3
+  lea r9, [rip+.L.data.main.303]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov dword ptr [rbp-2092], 2
+  movsxd r8, dword ptr [rbp-2092]
+  add r8, 1
+  mov dword ptr [rbp-2092], r8d
+  lea r9, [rip+.L.data.main.304]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov dword ptr [rbp-2088], 2
+  movsxd r8, dword ptr [rbp-2088]
+  sub r8, 1
+  mov dword ptr [rbp-2088], r8d
+  lea r9, [rip+.L.data.main.305]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov dword ptr [rbp-2084], 2
+  movsxd r8, dword ptr [rbp-2084]
+  add r8, 1
+  mov dword ptr [rbp-2084], r8d
+  sub r8, 1
+  lea r9, [rip+.L.data.main.306]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov dword ptr [rbp-2080], 2
+  movsxd r8, dword ptr [rbp-2080]
+  sub r8, 1
+  mov dword ptr [rbp-2080], r8d
+  add r8, 1
+  lea r9, [rip+.L.data.main.307]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov dword ptr [rbp-2076], 2
+  add dword ptr [rbp-2076], 1
+  movsxd r8, dword ptr [rbp-2076]
+  lea r9, [rip+.L.data.main.308]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov dword ptr [rbp-2072], 2
+  sub dword ptr [rbp-2072], 1
+  movsxd r8, dword ptr [rbp-2072]
+  lea r9, [rip+.L.data.main.309]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  lea rdi, [rbp-2068]
+  add rdi, 0
+  mov dword ptr [rdi], 0
+  lea rdi, [rbp-2068]
+  add rdi, 4
+  mov dword ptr [rdi], 1
+  lea rdi, [rbp-2068]
+  add rdi, 8
+  mov dword ptr [rdi], 2
+  lea rdi, [rbp-2068]
+  add rdi, 4
+  mov qword ptr [rbp-2056], rdi
+  mov rdi, qword ptr [rbp-2056]
+  add rdi, 4
+  mov qword ptr [rbp-2056], rdi
+  sub rdi, 4
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.310]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  lea rdi, [rbp-2044]
+  add rdi, 0
+  mov dword ptr [rdi], 0
+  lea rdi, [rbp-2044]
+  add rdi, 4
+  mov dword ptr [rdi], 1
+  lea rdi, [rbp-2044]
+  add rdi, 8
+  mov dword ptr [rdi], 2
+  lea rdi, [rbp-2044]
+  add rdi, 4
+  mov qword ptr [rbp-2032], rdi
+  mov rdi, qword ptr [rbp-2032]
+  movsxd r8, dword ptr [rdi]
+  add r8, 1
+  mov dword ptr [rdi], r8d
+  lea r9, [rip+.L.data.main.311]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  lea rdi, [rbp-2020]
+  add rdi, 0
+  mov dword ptr [rdi], 0
+  lea rdi, [rbp-2020]
+  add rdi, 4
+  mov dword ptr [rdi], 1
+  lea rdi, [rbp-2020]
+  add rdi, 8
+  mov dword ptr [rdi], 2
+  lea rdi, [rbp-2020]
+  add rdi, 4
+  mov qword ptr [rbp-2008], rdi
+  mov rdi, qword ptr [rbp-2008]
+  sub rdi, 4
+  mov qword ptr [rbp-2008], rdi
+  add rdi, 4
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.312]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  lea rdi, [rbp-1996]
+  add rdi, 0
+  mov dword ptr [rdi], 0
+  lea rdi, [rbp-1996]
+  add rdi, 4
+  mov dword ptr [rdi], 1
+  lea rdi, [rbp-1996]
+  add rdi, 8
+  mov dword ptr [rdi], 2
+  lea rdi, [rbp-1996]
+  add rdi, 4
+  mov qword ptr [rbp-1984], rdi
+  mov rdi, qword ptr [rbp-1984]
+  movsxd r8, dword ptr [rdi]
+  sub r8, 1
+  mov dword ptr [rdi], r8d
+  lea r9, [rip+.L.data.main.313]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  lea rdi, [rbp-1972]
+  add rdi, 0
+  mov dword ptr [rdi], 0
+  lea rdi, [rbp-1972]
+  add rdi, 4
+  mov dword ptr [rdi], 1
+  lea rdi, [rbp-1972]
+  add rdi, 8
+  mov dword ptr [rdi], 2
+  lea rdi, [rbp-1972]
+  add rdi, 4
+  mov qword ptr [rbp-1960], rdi
+  mov rdi, qword ptr [rbp-1960]
+  add rdi, 4
+  mov qword ptr [rbp-1960], rdi
+  sub rdi, 4
+  sub dword ptr [rdi], 1
+  lea rdi, [rbp-1972]
+  add rdi, 0
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.314]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  lea rdi, [rbp-1948]
+  add rdi, 0
+  mov dword ptr [rdi], 0
+  lea rdi, [rbp-1948]
+  add rdi, 4
+  mov dword ptr [rdi], 1
+  lea rdi, [rbp-1948]
+  add rdi, 8
+  mov dword ptr [rdi], 2
+  lea rdi, [rbp-1948]
+  add rdi, 4
+  mov qword ptr [rbp-1936], rdi
+  mov rdi, qword ptr [rbp-1936]
+  add rdi, 4
+  mov qword ptr [rbp-1936], rdi
+  sub rdi, 4
+  sub dword ptr [rdi], 1
+  lea rdi, [rbp-1948]
+  add rdi, 4
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.315]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  lea rdi, [rbp-1924]
+  add rdi, 0
+  mov dword ptr [rdi], 0
+  lea rdi, [rbp-1924]
+  add rdi, 4
+  mov dword ptr [rdi], 1
+  lea rdi, [rbp-1924]
+  add rdi, 8
+  mov dword ptr [rdi], 2
+  lea rdi, [rbp-1924]
+  add rdi, 4
+  mov qword ptr [rbp-1912], rdi
+  mov rdi, qword ptr [rbp-1912]
+  add rdi, 4
+  mov qword ptr [rbp-1912], rdi
+  sub rdi, 4
+  sub dword ptr [rdi], 1
+  lea rdi, [rbp-1924]
+  add rdi, 8
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.316]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  lea rdi, [rbp-1900]
+  add rdi, 0
+  mov dword ptr [rdi], 0
+  lea rdi, [rbp-1900]
+  add rdi, 4
+  mov dword ptr [rdi], 1
+  lea rdi, [rbp-1900]
+  add rdi, 8
+  mov dword ptr [rdi], 2
+  lea rdi, [rbp-1900]
+  add rdi, 4
+  mov qword ptr [rbp-1888], rdi
+  mov rdi, qword ptr [rbp-1888]
+  add rdi, 4
+  mov qword ptr [rbp-1888], rdi
+  sub rdi, 4
+  sub dword ptr [rdi], 1
+  mov rdi, qword ptr [rbp-1888]
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.317]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 7
+  mov dword ptr [rbp-1876], 2
+  add dword ptr [rbp-1876], 5
+  movsxd r8, dword ptr [rbp-1876]
+  lea r9, [rip+.L.data.main.318]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 7
+  mov dword ptr [rbp-1872], 2
+  movsxd r8, dword ptr [rbp-1872]
+  add r8, 5
+  mov dword ptr [rbp-1872], r8d
+  lea r9, [rip+.L.data.main.319]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov dword ptr [rbp-1868], 5
+  sub dword ptr [rbp-1868], 2
+  movsxd r8, dword ptr [rbp-1868]
+  lea r9, [rip+.L.data.main.320]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov dword ptr [rbp-1864], 5
+  movsxd r8, dword ptr [rbp-1864]
+  sub r8, 2
+  mov dword ptr [rbp-1864], r8d
+  lea r9, [rip+.L.data.main.321]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 6
+  mov dword ptr [rbp-1860], 3
+  shl dword ptr [rbp-1860], 1
+  movsxd r8, dword ptr [rbp-1860]
+  lea r9, [rip+.L.data.main.322]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 6
+  mov dword ptr [rbp-1856], 3
+  movsxd r8, dword ptr [rbp-1856]
+  shl r8, 1
+  mov dword ptr [rbp-1856], r8d
+  lea r9, [rip+.L.data.main.323]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov dword ptr [rbp-1852], 6
+  movsxd rdi, dword ptr [rbp-1852]
+  mov r8, rdi
+  sar r8, 63
+  and r8, 1
+  add rdi, r8
+  sar rdi, 1
+  mov dword ptr [rbp-1852], edi
+  movsxd r8, dword ptr [rbp-1852]
+  lea r9, [rip+.L.data.main.324]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov dword ptr [rbp-1848], 6
+  movsxd r8, dword ptr [rbp-1848]
+  mov rdi, r8
+  sar rdi, 63
+  and rdi, 1
+  add r8, rdi
+  sar r8, 1
+  mov dword ptr [rbp-1848], r8d
+  lea r9, [rip+.L.data.main.325]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 511
+  mov r8, 511
+  lea r9, [rip+.L.data.main.326]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  mov r8, 0
+  lea r9, [rip+.L.data.main.327]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 10
+  mov r8, 10
+  lea r9, [rip+.L.data.main.328]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 10
+  mov r8, 10
+  lea r9, [rip+.L.data.main.329]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 48879
+  mov r8, 48879
+  lea r9, [rip+.L.data.main.330]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 48879
+  mov r8, 48879
+  lea r9, [rip+.L.data.main.331]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 48879
+  mov r8, 48879
+  lea r9, [rip+.L.data.main.332]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  mov r8, 0
+  lea r9, [rip+.L.data.main.333]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov r8, 1
+  lea r9, [rip+.L.data.main.334]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 47
+  mov r8, 47
+  lea r9, [rip+.L.data.main.335]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 47
+  mov r8, 47
+  lea r9, [rip+.L.data.main.336]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  mov r8, 1
+  cmp r8, 0
+  sete r8b
+  movzx r8, r8b
+  lea r9, [rip+.L.data.main.337]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  mov r8, 2
+  cmp r8, 0
+  sete r8b
+  movzx r8, r8b
+  lea r9, [rip+.L.data.main.338]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov r8, 0
+  cmp r8, 0
+  sete r8b
+  movzx r8, r8b
+  lea r9, [rip+.L.data.main.339]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  sub rsi, 1
+  mov r8, 0
+  not r8
+  lea r9, [rip+.L.data.main.340]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  mov r8, 0
+  sub r8, 1
+  not r8
+  lea r9, [rip+.L.data.main.341]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  mov r8, 0
+  and r8, 1
+  lea r9, [rip+.L.data.main.342]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov r8, 3
+  and r8, 1
+  lea r9, [rip+.L.data.main.343]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov r8, 7
+  and r8, 3
+  lea r9, [rip+.L.data.main.344]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 10
+  mov r8, 0
+  sub r8, 1
+  and r8, 10
+  lea r9, [rip+.L.data.main.345]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov r8, 0
+  or r8, 1
+  lea r9, [rip+.L.data.main.346]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 19
+  mov r8, 16
+  or r8, 3
+  lea r9, [rip+.L.data.main.347]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  mov r8, 0
+  xor r8, 0
+  lea r9, [rip+.L.data.main.348]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  mov r8, 15
+  xor r8, 15
+  lea r9, [rip+.L.data.main.349]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 52
+  mov r8, 56
+  xor r8, 12
+  lea r9, [rip+.L.data.main.350]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov r8, 1
+  lea r9, [rip+.L.data.main.351]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov r8, 1
+  lea r9, [rip+.L.data.main.352]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  mov r8, 0
+  lea r9, [rip+.L.data.main.353]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  mov rdi, 2
+  sub rdi, 2
+  cmp rdi, 0
+  jne .L.1.main.34
+  mov r8, 0
+  jmp .L.end.main.35
+.L.1.main.34:
+  mov r8, 1
+.L.end.main.35:
+  lea r9, [rip+.L.data.main.354]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  mov r8, 0
+  lea r9, [rip+.L.data.main.355]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  mov rdi, 2
+  sub rdi, 2
+  cmp rdi, 0
+  je .L.0.main.38
+  mov r8, 1
+  jmp .L.end.main.39
+.L.0.main.38:
+  mov r8, 0
+.L.end.main.39:
+  lea r9, [rip+.L.data.main.356]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov r8, 1
+  lea r9, [rip+.L.data.main.357]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4728], 3
+  lea rsi, [rbp-1844]
+  add rsi, 0
+  mov dword ptr [rsi], 3
+  lea rdi, [rbp-1844]
+  mov rax, 0
+  call param_decay
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.358]
+  mov rdi, qword ptr [rbp-4728]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  sub rsi, 56
+  lea rdi, [rbp-1834]
+  add rdi, 0
+  mov r8, 200
+  mov byte ptr [rdi], r8b
+  lea rdi, [rbp-1834]
+  add rdi, 0
+  movsx r8, byte ptr [rdi]
+  lea r9, [rip+.L.data.main.359]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4464
+  lea rdi, [rbp-1832]
+  add rdi, 2
+  mov r8, 70000
+  mov word ptr [rdi], r8w
+  lea rdi, [rbp-1832]
+  add rdi, 2
+  movsx r8, word ptr [rdi]
+  lea r9, [rip+.L.data.main.360]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  sub rsi, 1
+  lea rdi, [rbp-1828]
+  add rdi, 0
+  movabs r8, 4294967295
+  mov dword ptr [rdi], r8d
+  lea rdi, [rbp-1828]
+  add rdi, 0
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.361]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  sub rsi, 55
+  mov byte ptr [rbp-1820], 1
+  mov dword ptr [rbp-1816], 2
+  movsx rdi, byte ptr [rbp-1820]
+  add rdi, 200
+  mov byte ptr [rbp-1820], dil
+  movsx r8, byte ptr [rbp-1820]
+  lea r9, [rip+.L.data.main.362]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  sub rsi, 10
+  lea rdi, [rbp-1812]
+  add rdi, 2
+  mov word ptr [rdi], 10
+  lea rdi, [rbp-1812]
+  add rdi, 2
+  sub word ptr [rdi], 20
+  lea rdi, [rbp-1812]
+  add rdi, 2
+  movsx r8, word ptr [rdi]
+  lea r9, [rip+.L.data.main.363]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 40
+  mov dword ptr [rip+g1], 5
+  shl dword ptr [rip+g1], 3
+  movsxd r8, dword ptr [rip+g1]
+  lea r9, [rip+.L.data.main.364]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 7
+  lea rdi, [rbp-1808]
+  add rdi, 0
+  mov qword ptr [rdi], 2
+  lea rdi, [rbp-1808]
+  add rdi, 8
+  mov qword ptr [rdi], 5
+  lea rdi, [rbp-1808]
+  add rdi, 0
+  lea r8, [rbp-1808]
+  add r8, 8
+  mov r8, qword ptr [r8]
+  add qword ptr [rdi], r8
+  lea rdi, [rbp-1808]
+  add rdi, 0
+  mov r8, qword ptr [rdi]
+  lea r9, [rip+.L.data.main.365]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov rdi, 0
+  sub rdi, 5
+  mov dword ptr [rbp-1788], edi
+  movsxd rdi, dword ptr [rbp-1788]
+  sar rdi, 6
+  mov r8, 0
+  sub r8, 1
+  cmp rdi, r8
+  sete r8b
+  movzx r8, r8b
+  lea r9, [rip+.L.data.main.366]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4096
+  mov qword ptr [rbp-1784], 1
+  mov r8, qword ptr [rbp-1784]
+  shl r8, 12
+  lea r9, [rip+.L.data.main.367]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 255
+  mov rdi, 0
+  sub rdi, 1
+  mov qword ptr [rbp-1776], rdi
+  mov r8, qword ptr [rbp-1776]
+  and r8, 255
+  lea r9, [rip+.L.data.main.368]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  sub rsi, 2
+  mov qword ptr [rbp-1768], 7
+  mov r8, qword ptr [rbp-1768]
+  mov rdi, 0
+  sub rdi, 7
+  xor r8, rdi
+  lea r9, [rip+.L.data.main.369]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  movabs rsi, 4294967296
+  mov qword ptr [rbp-1760], 1
+  mov r8, qword ptr [rbp-1760]
+  movabs rdi, 4294967296
+  imul r8, rdi
+  lea r9, [rip+.L.data.main.370]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov qword ptr [rbp-1752], 7
+  mov r8, qword ptr [rbp-1752]
+  mov rdi, r8
+  sar rdi, 63
+  and rdi, 1
+  add r8, rdi
+  sar r8, 1
+  lea r9, [rip+.L.data.main.371]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 44
+  mov byte ptr [rbp-1737], 100
+  movsx rdi, byte ptr [rbp-1737]
+  lea rdi, [rdi+rdi*2]
+  mov byte ptr [rbp-1737], dil
+  movsx r8, byte ptr [rbp-1737]
+  lea r9, [rip+.L.data.main.372]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  lea rdi, [rbp-1736]
+  mov qword ptr [rbp-1720], rdi
+  mov rdi, qword ptr [rbp-1720]
+  add rdi, 12
+  lea r8, [rbp-1736]
+  sub rdi, r8
+  sar rdi, 2
+  cmp rdi, 3
+  sete r8b
+  movzx r8, r8b
+  lea r9, [rip+.L.data.main.373]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 12
+  lea rdi, [rbp-1712]
+  mov qword ptr [rbp-1696], rdi
+  add qword ptr [rbp-1696], 12
+  mov r8, qword ptr [rbp-1696]
+  lea rdi, [rbp-1712]
+  sub r8, rdi
+  lea r9, [rip+.L.data.main.374]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  movabs rdi, 2147483648
+  mov qword ptr [rbp-1688], rdi
+  mov rdi, 2147483647
+  cmp rdi, qword ptr [rbp-1688]
+  setl r8b
+  movzx r8, r8b
+  lea r9, [rip+.L.data.main.375]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov dword ptr [rbp-1680], 0
+  mov dword ptr [rbp-1676], 0
+  movsxd rdi, dword ptr [rbp-1676]
+  cmp rdi, 10
+  jge .L.break.main.43
+  .p2align 4,,10
+.L.begin.main.44:
+  movsxd rdi, dword ptr [rbp-1676]
+  cmp rdi, 6
+  jle .L.skip.main.47
+  movsxd rdi, dword ptr [rbp-1676]
+  cmp rdi, 8
+  jne .L.skip.main.46
+.L.skip.main.47:
+  movsxd rdi, dword ptr [rbp-1676]
+  cmp rdi, 0
+  jne .L.end.main.45
+.L.skip.main.46:
+  add dword ptr [rbp-1680], 1
+.L.end.main.45:
+  add dword ptr [rbp-1676], 1
+  movsxd rdi, dword ptr [rbp-1676]
+  cmp rdi, 10
+  jl .L.begin.main.44
+.L.break.main.43:
+  movsxd r8, dword ptr [rbp-1680]
+  lea r9, [rip+.L.data.main.376]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  mov dword ptr [rbp-1672], 0
+  mov dword ptr [rbp-1668], 0
+  movsxd rdi, dword ptr [rbp-1668]
+  cmp rdi, 10
+  jge .L.break.main.49
+  .p2align 4,,10
+.L.begin.main.50:
+  movsxd rdi, dword ptr [rbp-1668]
+  cmp rdi, 2
+  jl .L.end.main.51
+  movsxd rdi, dword ptr [rbp-1668]
+  cmp rdi, 5
+  jl .L.skip.main.52
+  movsxd rdi, dword ptr [rbp-1668]
+  cmp rdi, 9
+  jne .L.end.main.51
+.L.skip.main.52:
+  add dword ptr [rbp-1672], 1
+.L.end.main.51:
+  add dword ptr [rbp-1668], 1
+  movsxd rdi, dword ptr [rbp-1668]
+  cmp rdi, 10
+  jl .L.begin.main.50
+.L.break.main.49:
+  movsxd r8, dword ptr [rbp-1672]
+  lea r9, [rip+.L.data.main.377]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov dword ptr [rbp-1664], 0
+  mov dword ptr [rbp-1664], 2
+  movsxd r8, dword ptr [rbp-1664]
+  lea r9, [rip+.L.data.main.378]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov dword ptr [rbp-1660], 0
+  mov dword ptr [rbp-1660], 1
+  movsxd r8, dword ptr [rbp-1660]
+  lea r9, [rip+.L.data.main.379]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 5
+  mov dword ptr [rbp-1656], 0
+  movsxd rdi, dword ptr [rbp-1656]
+  cmp rdi, 100
+  jge .L.break.main.57
+  movsxd rdi, dword ptr [rbp-1656]
+  cmp rdi, 5
+  jge .L.break.main.57
+  .p2align 4,,10
+.L.begin.main.58:
+  add dword ptr [rbp-1656], 1
+  movsxd rdi, dword ptr [rbp-1656]
+  cmp rdi, 100
+  jge .L.skip.main.59
+  movsxd rdi, dword ptr [rbp-1656]
+  cmp rdi, 5
+  jl .L.begin.main.58
+.L.skip.main.59:
+.L.break.main.57:
+  movsxd r8, dword ptr [rbp-1656]
+  lea r9, [rip+.L.data.main.380]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 10
+  mov dword ptr [rbp-1652], 0
+  .p2align 4,,10
+.L.begin.main.60:
+  add dword ptr [rbp-1652], 1
+  movsxd rdi, dword ptr [rbp-1652]
+  cmp rdi, 10
+  jne .L.begin.main.60
+  movsxd r8, dword ptr [rbp-1652]
+  lea r9, [rip+.L.data.main.381]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 7
+  mov dword ptr [rbp-1648], 3
+  movsxd rdi, dword ptr [rbp-1648]
+  cmp rdi, 2
+  jle .L.else.main.63
+  mov r8, 7
+  jmp .L.end.main.64
+.L.else.main.63:
+  mov r8, 8
+.L.end.main.64:
+  lea r9, [rip+.L.data.main.382]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov dword ptr [rbp-1644], 2
+  movsxd rdi, dword ptr [rbp-1644]
+  cmp rdi, 2
+  jle .L.else.main.65
+  mov r8, 7
+  jmp .L.end.main.66
+.L.else.main.65:
+  mov r8, 8
+.L.end.main.66:
+  lea r9, [rip+.L.data.main.383]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov rdi, 0
+  movabs r8, 3000000000
+  sub rdi, r8
+  mov qword ptr [rbp-1640], rdi
+  mov rdi, qword ptr [rbp-1640]
+  mov r8, 0
+  movabs r9, 2999999999
+  sub r8, r9
+  cmp rdi, r8
+  setl r8b
+  movzx r8, r8b
+  lea r9, [rip+.L.data.main.384]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 42
+  mov qword ptr [rbp-1632], 14
+  mov r8, qword ptr [rbp-1632]
+  lea r8, [r8+r8*2]
+  lea r9, [rip+.L.data.main.385]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  sub rsi, 35
+  mov rdi, 0
+  sub rdi, 7
+  mov qword ptr [rbp-1624], rdi
+  mov r8, qword ptr [rbp-1624]
+  lea r8, [r8+r8*4]
+  lea r9, [rip+.L.data.main.386]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 81
+  mov qword ptr [rbp-1616], 9
+  mov r8, qword ptr [rbp-1616]
+  lea r8, [r8+r8*8]
+  lea r9, [rip+.L.data.main.387]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 120
+  mov qword ptr [rbp-1608], 10
+  mov r8, qword ptr [rbp-1608]
+  lea r8, [r8+r8*2]
+  shl r8, 2
+  lea r9, [rip+.L.data.main.388]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  sub rsi, 280
+  mov rdi, 0
+  sub rdi, 7
+  mov qword ptr [rbp-1600], rdi
+  mov r8, qword ptr [rbp-1600]
+  lea r8, [r8+r8*4]
+  shl r8, 3
+  lea r9, [rip+.L.data.main.389]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  sub rsi, 21
+  mov qword ptr [rbp-1592], 7
+  mov r8, qword ptr [rbp-1592]
+  mov rdi, 0
+  sub rdi, 3
+  imul r8, rdi
+  lea r9, [rip+.L.data.main.390]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 49
+  mov qword ptr [rbp-1584], 7
+  mov rdi, qword ptr [rbp-1584]
+  imul rdi, 7
+  mov qword ptr [rbp-1584], rdi
+  mov r8, qword ptr [rbp-1584]
+  lea r9, [rip+.L.data.main.391]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 5
+  lea rdi, [rbp-1576]
+  add rdi, 56
+  mov r8, rdi
+  lea rdi, [rbp-1576]
+  add rdi, 16
+  sub r8, rdi
+  sar r8, 3
+  lea r9, [rip+.L.data.main.392]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  lea rdi, [rbp-1491]
+  add rdi, 12
+  mov r8, rdi
+  lea rdi, [rbp-1491]
+  add rdi, 3
+  sub r8, rdi
+  movabs rax, -6148914691236517205
+  imul r8
+  add rdx, r8
+  sar rdx, 1
+  sar r8, 63
+  sub rdx, r8
+  mov r8, rdx
+  lea r9, [rip+.L.data.main.393]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 174
+  mov r15, 0
+  cmp r15, 3
+  jge .L.break.main.68
+  .p2align 4,,10
+.L.begin.main.69:
+  mov r14, 0
+  cmp r14, 10
+  jge .L.break.main.71
+  lea rdi, [r15+r15*4]
+  .p2align 4,,10
+.L.begin.main.72:
+  lea r8, [rbp-1476]
+  lea r8, [r8+rdi*8]
+  lea r8, [r8+r14*4]
+  mov r9, r15
+  imul r9, r14
+  mov dword ptr [r8], r9d
+  mov r8, r14
+  add r8, 1
+  movsxd r8, r8d
+  mov r14, r8
+  cmp r14, 10
+  jl .L.begin.main.72
+.L.break.main.71:
+  mov rdi, r15
+  add rdi, 1
+  movsxd rdi, edi
+  mov r15, rdi
+  cmp r15, 3
+  jl .L.begin.main.69
+.L.break.main.68:
+  mov dword ptr [rbp-1356], 0
+  mov r13, 0
+  cmp r13, 3
+  jge .L.break.main.74
+  .p2align 4,,10
+.L.begin.main.75:
+  mov r12, 0
+  cmp r12, 10
+  jge .L.break.main.77
+  lea rdi, [rbp-1476]
+  lea r8, [r13+r13*4]
+  lea rdi, [rdi+r8*8]
+  lea r8, [rbp-1476]
+  mov r9, 2
+  sub r9, r13
+  lea r9, [r9+r9*4]
+  lea r8, [r8+r9*8]
+  .p2align 4,,10
+.L.begin.main.78:
+  movsxd r9, dword ptr [rdi+r12*4]
+  movsxd r10, dword ptr [r8+r12*4]
+  movabs rax, -6148914691236517205
+  imul r10
+  add rdx, r10
+  sar rdx, 1
+  sar r10, 63
+  sub rdx, r10
+  add r9, rdx
+  add dword ptr [rbp-1356], r9d
+  mov r9, r12
+  add r9, 1
+  movsxd r9, r9d
+  mov r12, r9
+  cmp r12, 10
+  jl .L.begin.main.78
+.L.break.main.77:
+  mov rdi, r13
+  add rdi, 1
+  movsxd rdi, edi
+  mov r13, rdi
+  cmp r13, 3
+  jl .L.begin.main.75
+.L.break.main.74:
+  movsxd r8, dword ptr [rbp-1356]
+  lea r9, [rip+.L.data.main.394]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 7
+  lea rdi, [rbp-1352]
+  mov qword ptr [rbp-1312], rdi
+  mov dword ptr [rbp-1300], 3
+  mov rdi, qword ptr [rbp-1312]
+  movsxd r8, dword ptr [rbp-1300]
+  mov qword ptr [rdi+r8*8], 7
+  lea rdi, [rbp-1352]
+  add rdi, 24
+  mov r8, qword ptr [rdi]
+  lea r9, [rip+.L.data.main.395]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  sub rsi, 3
+  mov rdi, 0
+  sub rdi, 7
+  mov qword ptr [rbp-1296], rdi
+  mov r8, qword ptr [rbp-1296]
+  mov rdi, r8
+  sar rdi, 63
+  and rdi, 1
+  add r8, rdi
+  sar r8, 1
+  lea r9, [rip+.L.data.main.396]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  mov rdi, 0
+  sub rdi, 7
+  mov qword ptr [rbp-1288], rdi
+  mov r8, qword ptr [rbp-1288]
+  mov rdi, r8
+  sar rdi, 63
+  and rdi, 7
+  add r8, rdi
+  sar r8, 3
+  lea r9, [rip+.L.data.main.397]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  sub rsi, 2
+  mov rdi, 0
+  sub rdi, 7
+  mov qword ptr [rbp-1280], rdi
+  mov r8, qword ptr [rbp-1280]
+  movabs rax, -6148914691236517205
+  imul r8
+  add rdx, r8
+  sar rdx, 1
+  sar r8, 63
+  sub rdx, r8
+  mov r8, rdx
+  lea r9, [rip+.L.data.main.398]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 10
+  mov qword ptr [rbp-1272], 100
+  mov r8, qword ptr [rbp-1272]
+  movabs rax, -3689348814741910323
+  imul r8
+  add rdx, r8
+  sar rdx, 3
+  sar r8, 63
+  sub rdx, r8
+  mov r8, rdx
+  lea r9, [rip+.L.data.main.399]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  sub rsi, 14
+  mov rdi, 0
+  sub rdi, 100
+  mov dword ptr [rbp-1260], edi
+  movsxd r8, dword ptr [rbp-1260]
+  movabs rax, -7905747460161236406
+  imul r8
+  add rdx, r8
+  sar rdx, 2
+  sar r8, 63
+  sub rdx, r8
+  mov r8, rdx
+  lea r9, [rip+.L.data.main.400]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  movabs rsi, 123456789012
+  movabs rdi, 123456789012345
+  mov qword ptr [rbp-1256], rdi
+  mov r8, qword ptr [rbp-1256]
+  movabs rax, -9002011107970261188
+  imul r8
+  add rdx, r8
+  sar rdx, 9
+  sar r8, 63
+  sub rdx, r8
+  mov r8, rdx
+  lea r9, [rip+.L.data.main.401]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  movabs rdi, 192600294871
+  sub rsi, rdi
+  mov rdi, 0
+  movabs r8, 123456789012345
+  sub rdi, r8
+  mov qword ptr [rbp-1248], rdi
+  mov r8, qword ptr [rbp-1248]
+  movabs rax, -3712371272244199935
+  imul r8
+  add rdx, r8
+  sar rdx, 9
+  sar r8, 63
+  sub rdx, r8
+  mov r8, rdx
+  lea r9, [rip+.L.data.main.402]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov dword ptr [rbp-1240], 2147483647
+  movsxd r8, dword ptr [rbp-1240]
+  movabs rax, -9223372032559808509
+  imul r8
+  add rdx, r8
+  sar rdx, 30
+  sar r8, 63
+  sub rdx, r8
+  mov r8, rdx
+  lea r9, [rip+.L.data.main.403]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1234
+  mov dword ptr [rbp-1236], 12345
+  movsxd rdi, dword ptr [rbp-1236]
+  movabs rax, -3689348814741910323
+  imul rdi
+  add rdx, rdi
+  sar rdx, 3
+  sar rdi, 63
+  sub rdx, rdi
+  mov dword ptr [rbp-1236], edx
+  movsxd r8, dword ptr [rbp-1236]
+  lea r9, [rip+.L.data.main.404]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  sub rsi, 7
+  mov rdi, 0
+  sub rdi, 7
+  mov qword ptr [rbp-1232], rdi
+  mov r8, qword ptr [rbp-1232]
+  lea r9, [rip+.L.data.main.405]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 7
+  lea rdi, [rbp-1220]
+  add rdi, 96
+  mov r8, rdi
+  lea rdi, [rbp-1220]
+  add rdi, 12
+  sub r8, rdi
+  movabs rax, -6148914691236517205
+  imul r8
+  add rdx, r8
+  sar rdx, 3
+  sar r8, 63
+  sub rdx, r8
+  mov r8, rdx
+  lea r9, [rip+.L.data.main.406]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.407]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  mov r8, 4
+  lea r9, [rip+.L.data.main.408]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov dword ptr [rbp-1072], 1
+  lea rdi, [rbp-1080]
+  mov qword ptr [rbp-1096], rdi
+  mov rdi, qword ptr [rbp-1096]
+  movsxd r8, dword ptr [rdi+8]
+  lea r9, [rip+.L.data.main.409]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov dword ptr [rbp-1064], 0
+  movsxd rdi, dword ptr [rbp-1064]
+  cmp rdi, 10
+  jge .L.break.main.80
+  .p2align 4,,10
+.L.begin.main.81:
+  movsxd rdi, dword ptr [rbp-1064]
+  cmp rdi, 3
+  je .L.break.main.80
+  add dword ptr [rbp-1064], 1
+  movsxd rdi, dword ptr [rbp-1064]
+  cmp rdi, 10
+  jl .L.begin.main.81
+.L.break.main.80:
+  movsxd r8, dword ptr [rbp-1064]
+  lea r9, [rip+.L.data.main.410]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  mov dword ptr [rbp-1060], 0
+  .p2align 4,,10
+.L.begin.main.85:
+  movsxd rdi, dword ptr [rbp-1060]
+  add rdi, 1
+  mov dword ptr [rbp-1060], edi
+  sub rdi, 1
+  cmp rdi, 3
+  jne .L.begin.main.85
+  movsxd r8, dword ptr [rbp-1060]
+  lea r9, [rip+.L.data.main.411]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov dword ptr [rbp-1056], 0
+  movsxd rdi, dword ptr [rbp-1056]
+  cmp rdi, 10
+  jge .L.break.main.88
+  .p2align 4,,10
+.L.break.main.91:
+  movsxd rdi, dword ptr [rbp-1056]
+  cmp rdi, 3
+  je .L.break.main.88
+  add dword ptr [rbp-1056], 1
+  movsxd rdi, dword ptr [rbp-1056]
+  cmp rdi, 10
+  jl .L.break.main.91
+.L.break.main.88:
+  movsxd r8, dword ptr [rbp-1056]
+  lea r9, [rip+.L.data.main.412]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  mov dword ptr [rbp-1052], 0
+  .p2align 4,,10
+.L.break.main.98:
+  movsxd rdi, dword ptr [rbp-1052]
+  add rdi, 1
+  mov dword ptr [rbp-1052], edi
+  sub rdi, 1
+  cmp rdi, 3
+  jne .L.break.main.98
+  movsxd r8, dword ptr [rbp-1052]
+  lea r9, [rip+.L.data.main.413]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 10
+  mov dword ptr [rbp-1048], 0
+  mov dword ptr [rbp-1044], 0
+  movsxd rdi, dword ptr [rbp-1048]
+  cmp rdi, 10
+  jge .L.break.main.102
+  .p2align 4,,10
+.L.begin.main.103:
+  movsxd rdi, dword ptr [rbp-1048]
+  cmp rdi, 5
+  jg .L.continue.main.101
+  add dword ptr [rbp-1044], 1
+.L.continue.main.101:
+  add dword ptr [rbp-1048], 1
+  movsxd rdi, dword ptr [rbp-1048]
+  cmp rdi, 10
+  jl .L.begin.main.103
+.L.break.main.102:
+  movsxd r8, dword ptr [rbp-1048]
+  lea r9, [rip+.L.data.main.414]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 6
+  mov dword ptr [rbp-1040], 0
+  mov dword ptr [rbp-1036], 0
+  movsxd rdi, dword ptr [rbp-1040]
+  cmp rdi, 10
+  jge .L.break.main.106
+  .p2align 4,,10
+.L.begin.main.107:
+  movsxd rdi, dword ptr [rbp-1040]
+  cmp rdi, 5
+  jg .L.continue.main.105
+  add dword ptr [rbp-1036], 1
+.L.continue.main.105:
+  add dword ptr [rbp-1040], 1
+  movsxd rdi, dword ptr [rbp-1040]
+  cmp rdi, 10
+  jl .L.begin.main.107
+.L.break.main.106:
+  movsxd r8, dword ptr [rbp-1036]
+  lea r9, [rip+.L.data.main.415]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 10
+  mov dword ptr [rbp-1032], 0
+  mov rbx, 0
+  movsxd rdi, dword ptr [rbp-1032]
+  cmp rdi, 0
+  jne .L.break.main.110
+  cmp rbx, 10
+  je .L.break.main.110
+  .p2align 4,,10
+.L.continue.main.112:
+  mov rdi, rbx
+  add rdi, 1
+  movsxd rdi, edi
+  mov rbx, rdi
+  cmp rbx, 10
+  jne .L.continue.main.112
+.L.break.main.110:
+  mov r8, rbx
+  lea r9, [rip+.L.data.main.416]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 11
+  mov dword ptr [rbp-1028], 0
+  mov dword ptr [rbp-1024], 0
+  movsxd rdi, dword ptr [rbp-1028]
+  add rdi, 1
+  mov dword ptr [rbp-1028], edi
+  sub rdi, 1
+  cmp rdi, 10
+  jge .L.break.main.116
+  .p2align 4,,10
+.L.begin.main.117:
+  movsxd rdi, dword ptr [rbp-1028]
+  cmp rdi, 5
+  jg .L.continue.main.115
+  add dword ptr [rbp-1024], 1
+.L.continue.main.115:
+  movsxd rdi, dword ptr [rbp-1028]
+  add rdi, 1
+  mov dword ptr [rbp-1028], edi
+  sub rdi, 1
+  cmp rdi, 10
+  jl .L.begin.main.117
+.L.break.main.116:
+  movsxd r8, dword ptr [rbp-1028]
+  lea r9, [rip+.L.data.main.417]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 5
+  mov dword ptr [rbp-1020], 0
+  mov dword ptr [rbp-1016], 0
+  movsxd rdi, dword ptr [rbp-1020]
+  add rdi, 1
+  mov dword ptr [rbp-1020], edi
+  sub rdi, 1
+  cmp rdi, 10
+  jge .L.break.main.120
+  .p2align 4,,10
+.L.begin.main.121:
+  movsxd rdi, dword ptr [rbp-1020]
+  cmp rdi, 5
+  jg .L.continue.main.119
+  add dword ptr [rbp-1016], 1
+.L.continue.main.119:
+  movsxd rdi, dword ptr [rbp-1020]
+  add rdi, 1
+  mov dword ptr [rbp-1020], edi
+  sub rdi, 1
+  cmp rdi, 10
+  jl .L.begin.main.121
+.L.break.main.120:
+  movsxd r8, dword ptr [rbp-1016]
+  lea r9, [rip+.L.data.main.418]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 11
+  mov dword ptr [rbp-1012], 0
+  mov dword ptr [rbp-1008], 0
+  movsxd rdi, dword ptr [rbp-1012]
+  cmp rdi, 0
+  jne .L.break.main.124
+  movsxd rdi, dword ptr [rbp-1008]
+  add rdi, 1
+  mov dword ptr [rbp-1008], edi
+  sub rdi, 1
+  cmp rdi, 10
+  je .L.break.main.124
+  .p2align 4,,10
+.L.continue.main.126:
+  movsxd rdi, dword ptr [rbp-1008]
+  add rdi, 1
+  mov dword ptr [rbp-1008], edi
+  sub rdi, 1
+  cmp rdi, 10
+  jne .L.continue.main.126
+.L.break.main.124:
+  movsxd r8, dword ptr [rbp-1008]
+  lea r9, [rip+.L.data.main.419]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  mov dword ptr [rbp-1004], 0
+  movsxd rdi, dword ptr [rbp-1004]
+  cmp rdi, 0
+  jle .L.break.main.130
+  .p2align 4,,10
+.L.begin.main.131:
+  add dword ptr [rbp-1004], 1
+  movsxd rdi, dword ptr [rbp-1004]
+  cmp rdi, 0
+  jg .L.begin.main.131
+.L.break.main.130:
+  movsxd r8, dword ptr [rbp-1004]
+  lea r9, [rip+.L.data.main.420]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  mov dword ptr [rbp-1000], 0
+  mov dword ptr [rbp-996], 0
+  add dword ptr [rbp-1000], 1
+  movsxd rdi, dword ptr [rbp-996]
+  cmp rdi, 3
+  setl dil
+  movzx rdi, dil
+  cmp rdi, 0
+  je .L.break.main.133
+  .p2align 4,,10
+.L.begin.main.134:
+  add dword ptr [rbp-996], 1
+  add dword ptr [rbp-1000], 1
+  movsxd rdi, dword ptr [rbp-996]
+  cmp rdi, 3
+  setl dil
+  movzx rdi, dil
+  cmp rdi, 0
+  jne .L.begin.main.134
+.L.break.main.133:
+  movsxd r8, dword ptr [rbp-1000]
+  lea r9, [rip+.L.data.main.421]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 6
+  mov dword ptr [rbp-992], 0
+  mov dword ptr [rbp-988], 0
+  add dword ptr [rbp-992], 1
+  movsxd rdi, dword ptr [rbp-988]
+  cmp rdi, 5
+  setl dil
+  movzx rdi, dil
+  cmp rdi, 0
+  je .L.break.main.136
+  .p2align 4,,10
+.L.begin.main.137:
+  add dword ptr [rbp-988], 1
+  add dword ptr [rbp-992], 1
+  movsxd rdi, dword ptr [rbp-988]
+  cmp rdi, 5
+  setl dil
+  movzx rdi, dil
+  cmp rdi, 0
+  jne .L.begin.main.137
+.L.break.main.136:
+  movsxd r8, dword ptr [rbp-992]
+  lea r9, [rip+.L.data.main.422]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov dword ptr [rbp-984], 0
+  jmp .L.label.main.k
+  .p2align 4,,10
+.L.begin.main.141:
+  add dword ptr [rbp-984], 1
+.L.label.main.k:
+  movsxd rdi, dword ptr [rbp-984]
+  cmp rdi, 3
+  setl dil
+  movzx rdi, dil
+  cmp rdi, 0
+  jne .L.begin.main.141
+  movsxd r8, dword ptr [rbp-984]
+  lea r9, [rip+.L.data.main.423]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 6
+  mov dword ptr [rbp-980], 0
+  mov dword ptr [rbp-976], 0
+  jmp .L.label.main.l
+  .p2align 4,,10
+.L.begin.main.146:
+  movsxd rdi, dword ptr [rbp-976]
+  cmp rdi, 5
+  jg .L.continue.main.144
+  add dword ptr [rbp-980], 1
+.L.continue.main.144:
+  add dword ptr [rbp-976], 1
+.L.label.main.l:
+  movsxd rdi, dword ptr [rbp-976]
+  cmp rdi, 10
+  setl dil
+  movzx rdi, dil
+  cmp rdi, 0
+  jne .L.begin.main.146
+  movsxd r8, dword ptr [rbp-980]
+  lea r9, [rip+.L.data.main.424]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  mov dword ptr [rbp-972], 0
+  mov dword ptr [rbp-968], 0
+  jmp .L.label.main.m
+  .p2align 4,,10
+.L.begin.main.152:
+  add dword ptr [rbp-972], 1
+  add dword ptr [rbp-968], 1
+.L.label.main.m:
+  movsxd rdi, dword ptr [rbp-968]
+  cmp rdi, 0
+  setl dil
+  movzx rdi, dil
+  cmp rdi, 0
+  jne .L.begin.main.152
+  movsxd r8, dword ptr [rbp-972]
+  lea r9, [rip+.L.data.main.425]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 11
+  mov dword ptr [rbp-964], 0
+  jmp .L.test.main.158
+  .p2align 4,,10
+.L.begin.main.157:
+  add dword ptr [rbp-964], 1
+.L.test.main.158:
+  movsxd rdi, dword ptr [rbp-964]
+  cmp rdi, 20
+  jge .L.skip.main.159
+  movsxd rdi, dword ptr [rbp-964]
+  cmp rdi, 11
+  je .L.skip.main.159
+  movsxd rdi, dword ptr [rbp-964]
+  cmp rdi, 12
+  je .L.skip.main.159
+  movsxd rdi, dword ptr [rbp-964]
+  cmp rdi, 13
+  je .L.skip.main.159
+  movsxd rdi, dword ptr [rbp-964]
+  cmp rdi, 14
+  je .L.skip.main.159
+  movsxd rdi, dword ptr [rbp-964]
+  cmp rdi, 15
+  je .L.skip.main.159
+  movsxd rdi, dword ptr [rbp-964]
+  cmp rdi, 16
+  je .L.skip.main.159
+  movsxd rdi, dword ptr [rbp-964]
+  cmp rdi, 17
+  jne .L.begin.main.157
+.L.skip.main.159:
+  movsxd r8, dword ptr [rbp-964]
+  lea r9, [rip+.L.data.main.426]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov dword ptr [rbp-960], 0
+  add dword ptr [rbp-960], 1
+  add dword ptr [rbp-960], 1
+  add dword ptr [rbp-960], 1
+  movsxd r8, dword ptr [rbp-960]
+  lea r9, [rip+.L.data.main.427]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov dword ptr [rbp-956], 0
+  add dword ptr [rbp-956], 1
+  add dword ptr [rbp-956], 1
+  movsxd r8, dword ptr [rbp-956]
+  lea r9, [rip+.L.data.main.428]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov dword ptr [rbp-952], 0
+  add dword ptr [rbp-952], 1
+  movsxd r8, dword ptr [rbp-952]
+  lea r9, [rip+.L.data.main.429]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 5
+  mov dword ptr [rbp-948], 0
+  mov rdi, 0
+  cmp rdi, 0
+  je .L.case.main.172
+  cmp rdi, 1
+  je .L.case.main.171
+  cmp rdi, 2
+  je .L.case.main.170
+  jmp .L.break.main.169
+.L.case.main.172:
+  mov dword ptr [rbp-948], 5
+  jmp .L.break.main.169
+.L.case.main.171:
+  mov dword ptr [rbp-948], 6
+  jmp .L.break.main.169
+.L.case.main.170:
+  mov dword ptr [rbp-948], 7
+.L.break.main.169:
+  movsxd r8, dword ptr [rbp-948]
+  lea r9, [rip+.L.data.main.430]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 6
+  mov dword ptr [rbp-944], 0
+  mov rdi, 1
+  cmp rdi, 0
+  je .L.case.main.176
+  cmp rdi, 1
+  je .L.case.main.175
+  cmp rdi, 2
+  je .L.case.main.174
+  jmp .L.break.main.173
+.L.case.main.176:
+  mov dword ptr [rbp-944], 5
+  jmp .L.break.main.173
+.L.case.main.175:
+  mov dword ptr [rbp-944], 6
+  jmp .L.break.main.173
+.L.case.main.174:
+  mov dword ptr [rbp-944], 7
+.L.break.main.173:
+  movsxd r8, dword ptr [rbp-944]
+  lea r9, [rip+.L.data.main.431]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 7
+  mov dword ptr [rbp-940], 0
+  mov rdi, 2
+  cmp rdi, 0
+  je .L.case.main.180
+  cmp rdi, 1
+  je .L.case.main.179
+  cmp rdi, 2
+  je .L.case.main.178
+  jmp .L.break.main.177
+.L.case.main.180:
+  mov dword ptr [rbp-940], 5
+  jmp .L.break.main.177
+.L.case.main.179:
+  mov dword ptr [rbp-940], 6
+  jmp .L.break.main.177
+.L.case.main.178:
+  mov dword ptr [rbp-940], 7
+.L.break.main.177:
+  movsxd r8, dword ptr [rbp-940]
+  lea r9, [rip+.L.data.main.432]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  mov dword ptr [rbp-936], 0
+  mov rdi, 3
+  cmp rdi, 0
+  je .L.case.main.184
+  cmp rdi, 1
+  je .L.case.main.183
+  cmp rdi, 2
+  je .L.case.main.182
+  jmp .L.break.main.181
+.L.case.main.184:
+  mov dword ptr [rbp-936], 5
+  jmp .L.break.main.181
+.L.case.main.183:
+  mov dword ptr [rbp-936], 6
+  jmp .L.break.main.181
+.L.case.main.182:
+  mov dword ptr [rbp-936], 7
+.L.break.main.181:
+  movsxd r8, dword ptr [rbp-936]
+  lea r9, [rip+.L.data.main.433]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 5
+  mov dword ptr [rbp-932], 0
+  mov rdi, 0
+  cmp rdi, 0
+  jne .L.case.main.187
+  mov dword ptr [rbp-932], 5
+  jmp .L.break.main.185
+.L.case.main.187:
+  mov dword ptr [rbp-932], 7
+.L.break.main.185:
+  movsxd r8, dword ptr [rbp-932]
+  lea r9, [rip+.L.data.main.434]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 7
+  mov dword ptr [rbp-928], 0
+  mov rdi, 1
+  cmp rdi, 0
+  jne .L.case.main.190
+  mov dword ptr [rbp-928], 5
+  jmp .L.break.main.188
+.L.case.main.190:
+  mov dword ptr [rbp-928], 7
+.L.break.main.188:
+  movsxd r8, dword ptr [rbp-928]
+  lea r9, [rip+.L.data.main.435]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov dword ptr [rbp-924], 0
+  mov rdi, 1
+  cmp rdi, 0
+  je .L.case.main.194
+  cmp rdi, 1
+  je .L.case.main.193
+  cmp rdi, 2
+  je .L.case.main.192
+  jmp .L.break.main.191
+.L.case.main.194:
+.L.case.main.193:
+.L.case.main.192:
+  mov dword ptr [rbp-924], 2
+.L.break.main.191:
+  movsxd r8, dword ptr [rbp-924]
+  lea r9, [rip+.L.data.main.436]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  mov dword ptr [rbp-920], 0
+  mov rdi, 3
+  cmp rdi, 0
+  je .L.case.main.198
+  cmp rdi, 1
+  je .L.case.main.197
+  cmp rdi, 2
+  je .L.case.main.196
+  jmp .L.break.main.195
+.L.case.main.198:
+.L.case.main.197:
+.L.case.main.196:
+  mov dword ptr [rbp-920], 2
+.L.break.main.195:
+  movsxd r8, dword ptr [rbp-920]
+  lea r9, [rip+.L.data.main.437]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rax, 0
+  call voidfn
+  mov rsi, 1
+  mov r8, 1
+  shl r8, 0
+  lea r9, [rip+.L.data.main.438]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 1
+  shl r8, 3
+  lea r9, [rip+.L.data.main.439]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 10
+  mov r8, 5
+  shl r8, 1
+  lea r9, [rip+.L.data.main.440]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov r8, 5
+  sar r8, 1
+  lea r9, [rip+.L.data.main.441]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  sub rsi, 1
+  mov r8, 0
+  sub r8, 1
+  sar r8, 1
+  lea r9, [rip+.L.data.main.442]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov dword ptr [rbp-916], 1
+  shl dword ptr [rbp-916], 0
+  movsxd r8, dword ptr [rbp-916]
+  lea r9, [rip+.L.data.main.443]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov dword ptr [rbp-912], 1
+  shl dword ptr [rbp-912], 3
+  movsxd r8, dword ptr [rbp-912]
+  lea r9, [rip+.L.data.main.444]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 10
+  mov dword ptr [rbp-908], 5
+  shl dword ptr [rbp-908], 1
+  movsxd r8, dword ptr [rbp-908]
+  lea r9, [rip+.L.data.main.445]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov dword ptr [rbp-904], 5
+  sar dword ptr [rbp-904], 1
+  movsxd r8, dword ptr [rbp-904]
+  lea r9, [rip+.L.data.main.446]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  sub rsi, 1
+  mov r8, 0
+  sub r8, 1
+  lea r9, [rip+.L.data.main.447]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  sub rsi, 1
+  mov rdi, 0
+  sub rdi, 1
+  mov dword ptr [rbp-900], edi
+  movsxd r8, dword ptr [rbp-900]
+  lea r9, [rip+.L.data.main.448]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  sub rsi, 1
+  mov rdi, 0
+  sub rdi, 1
+  mov dword ptr [rbp-896], edi
+  sar dword ptr [rbp-896], 1
+  movsxd r8, dword ptr [rbp-896]
+  lea r9, [rip+.L.data.main.449]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov r8, 2
+  lea r9, [rip+.L.data.main.450]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov r8, 1
+  lea r9, [rip+.L.data.main.451]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 10
+  mov r8, 10
+  lea r9, [rip+.L.data.main.452]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov dword ptr [rbp-892], 0
+  mov rdi, 3
+  cmp rdi, 3
+  jne .L.break.main.203
+  add dword ptr [rbp-892], 1
+.L.break.main.203:
+  movsxd r8, dword ptr [rbp-892]
+  lea r9, [rip+.L.data.main.453]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 12063
+  mov dword ptr [rbp-888], 0
+  mov rdi, 0
+  sub rdi, 3
+  mov dword ptr [rbp-884], edi
+  movsxd rdi, dword ptr [rbp-884]
+  cmp rdi, 15
+  jge .L.break.main.206
+  lea rdi, [rip+.L.table.main.216]
+  .p2align 4,,10
+.L.begin.main.207:
+  movsxd r8, dword ptr [rbp-884]
+  cmp r8, 7
+  ja .L.case.main.215
+  shl r8, 2
+  add r8, rdi
+  movsxd r8, dword ptr [r8]
+  add r8, rdi
+  jmp r8
+.L.table.main.216:
+  .long .L.case.main.214-.L.table.main.216
+  .long .L.case.main.213-.L.table.main.216
+  .long .L.case.main.212-.L.table.main.216
+  .long .L.case.main.215-.L.table.main.216
+  .long .L.case.main.211-.L.table.main.216
+  .long .L.case.main.210-.L.table.main.216
+  .long .L.case.main.215-.L.table.main.216
+  .long .L.case.main.209-.L.table.main.216
+.L.case.main.214:
+  add dword ptr [rbp-888], 1
+  jmp .L.break.main.208
+.L.case.main.213:
+  add dword ptr [rbp-888], 2
+  jmp .L.break.main.208
+.L.case.main.212:
+  add dword ptr [rbp-888], 4
+  jmp .L.break.main.208
+.L.case.main.211:
+  add dword ptr [rbp-888], 8
+  jmp .L.break.main.208
+.L.case.main.210:
+  add dword ptr [rbp-888], 16
+  jmp .L.break.main.208
+.L.case.main.209:
+  add dword ptr [rbp-888], 32
+  jmp .L.break.main.208
+.L.case.main.215:
+  add dword ptr [rbp-888], 1000
+.L.break.main.208:
+  add dword ptr [rbp-884], 1
+  movsxd r8, dword ptr [rbp-884]
+  cmp r8, 15
+  jl .L.begin.main.207
+.L.break.main.206:
+  movsxd r8, dword ptr [rbp-888]
+  lea r9, [rip+.L.data.main.454]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 25
+  mov dword ptr [rbp-880], 0
+  mov rdi, 0
+  sub rdi, 3
+  mov dword ptr [rbp-876], edi
+  movsxd rdi, dword ptr [rbp-876]
+  cmp rdi, 12
+  jge .L.break.main.218
+  lea rdi, [rip+.L.table.main.225]
+  .p2align 4,,10
+.L.begin.main.219:
+  movsxd r8, dword ptr [rbp-876]
+  sub r8, 5
+  sub r8, -5
+  cmp r8, 4
+  ja .L.break.main.220
+  shl r8, 2
+  add r8, rdi
+  movsxd r8, dword ptr [r8]
+  add r8, rdi
+  jmp r8
+.L.table.main.225:
+  .long .L.case.main.224-.L.table.main.225
+  .long .L.case.main.223-.L.table.main.225
+  .long .L.break.main.220-.L.table.main.225
+  .long .L.case.main.222-.L.table.main.225
+  .long .L.case.main.221-.L.table.main.225
+.L.case.main.224:
+  add dword ptr [rbp-880], 1
+.L.case.main.223:
+  add dword ptr [rbp-880], 2
+  jmp .L.break.main.220
+.L.case.main.222:
+  add dword ptr [rbp-880], 4
+.L.case.main.221:
+  add dword ptr [rbp-880], 8
+.L.break.main.220:
+  add dword ptr [rbp-876], 1
+  movsxd r8, dword ptr [rbp-876]
+  cmp r8, 12
+  jl .L.begin.main.219
+.L.break.main.218:
+  movsxd r8, dword ptr [rbp-880]
+  lea r9, [rip+.L.data.main.455]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 127
+  mov dword ptr [rbp-872], 0
+  mov dword ptr [rbp-868], 0
+  movsxd rdi, dword ptr [rbp-868]
+  cmp rdi, 1100
+  jge .L.break.main.227
+  .p2align 4,,10
+.L.begin.main.228:
+  movsxd rdi, dword ptr [rbp-868]
+  cmp rdi, 20
+  je .L.case.main.232
+  jg .L.upper.main.238
+  cmp rdi, 1
+  je .L.case.main.236
+  cmp rdi, 5
+  je .L.case.main.230
+  cmp rdi, 10
+  je .L.case.main.235
+  jmp .L.case.main.237
+.L.upper.main.238:
+  cmp rdi, 100
+  je .L.case.main.234
+  cmp rdi, 300
+  je .L.case.main.231
+  cmp rdi, 1000
+  je .L.case.main.233
+  jmp .L.case.main.237
+.L.case.main.236:
+  add dword ptr [rbp-872], 1
+  jmp .L.break.main.229
+.L.case.main.235:
+  add dword ptr [rbp-872], 2
+  jmp .L.break.main.229
+.L.case.main.234:
+  add dword ptr [rbp-872], 4
+  jmp .L.break.main.229
+.L.case.main.233:
+  add dword ptr [rbp-872], 8
+  jmp .L.break.main.229
+.L.case.main.232:
+  add dword ptr [rbp-872], 16
+  jmp .L.break.main.229
+.L.case.main.231:
+  add dword ptr [rbp-872], 32
+  jmp .L.break.main.229
+.L.case.main.230:
+  add dword ptr [rbp-872], 64
+  jmp .L.break.main.229
+.L.case.main.237:
+  add dword ptr [rbp-872], 0
+.L.break.main.229:
+  add dword ptr [rbp-868], 1
+  movsxd rdi, dword ptr [rbp-868]
+  cmp rdi, 1100
+  jl .L.begin.main.228
+.L.break.main.227:
+  movsxd r8, dword ptr [rbp-872]
+  lea r9, [rip+.L.data.main.456]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 144
+  mov dword ptr [rbp-864], 0
+  mov dword ptr [rbp-860], 0
+  movsxd rdi, dword ptr [rbp-860]
+  cmp rdi, 50
+  jge .L.break.main.240
+  lea rdi, [rip+.L.table.main.253]
+  lea r8, [rip+.L.table.main.254]
+  .p2align 4,,10
+.L.begin.main.241:
+  movsxd r9, dword ptr [rbp-860]
+  cmp r9, 20
+  je .L.case.main.243
+  jg .L.upper.main.252
+  mov r10, r9
+  sub r10, 1
+  cmp r10, 3
+  ja .L.break.main.242
+  shl r10, 2
+  add r10, rdi
+  movsxd r10, dword ptr [r10]
+  add r10, rdi
+  jmp r10
+.L.table.main.253:
+  .long .L.case.main.248-.L.table.main.253
+  .long .L.case.main.249-.L.table.main.253
+  .long .L.case.main.250-.L.table.main.253
+  .long .L.case.main.251-.L.table.main.253
+.L.upper.main.252:
+  sub r9, 40
+  cmp r9, 3
+  ja .L.break.main.242
+  shl r9, 2
+  add r9, r8
+  movsxd r9, dword ptr [r9]
+  add r9, r8
+  jmp r9
+.L.table.main.254:
+  .long .L.case.main.244-.L.table.main.254
+  .long .L.case.main.245-.L.table.main.254
+  .long .L.case.main.246-.L.table.main.254
+  .long .L.case.main.247-.L.table.main.254
+.L.case.main.248:
+.L.case.main.249:
+.L.case.main.250:
+.L.case.main.251:
+  add dword ptr [rbp-864], 1
+  jmp .L.break.main.242
+.L.case.main.244:
+.L.case.main.245:
+.L.case.main.246:
+.L.case.main.247:
+  add dword ptr [rbp-864], 10
+  jmp .L.break.main.242
+.L.case.main.243:
+  add dword ptr [rbp-864], 100
+.L.break.main.242:
+  add dword ptr [rbp-860], 1
+  movsxd r9, dword ptr [rbp-860]
+  cmp r9, 50
+  jl .L.begin.main.241
+.L.break.main.240:
+  movsxd r8, dword ptr [rbp-864]
+  lea r9, [rip+.L.data.main.457]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 5
+  movabs rdi, 4294967298
+  mov qword ptr [rbp-856], rdi
+  mov dword ptr [rbp-848], 0
+  mov rdi, qword ptr [rbp-856]
+  sub rdi, 2
+  cmp rdi, 3
+  ja .L.case.main.260
+  lea r8, [rip+.L.table.main.261]
+  shl rdi, 2
+  add rdi, r8
+  movsxd rdi, dword ptr [rdi]
+  add rdi, r8
+  jmp rdi
+.L.table.main.261:
+  .long .L.case.main.259-.L.table.main.261
+  .long .L.case.main.258-.L.table.main.261
+  .long .L.case.main.257-.L.table.main.261
+  .long .L.case.main.256-.L.table.main.261
+.L.case.main.259:
+  mov dword ptr [rbp-848], 1
+  jmp .L.break.main.255
+.L.case.main.258:
+  mov dword ptr [rbp-848], 2
+  jmp .L.break.main.255
+.L.case.main.257:
+  mov dword ptr [rbp-848], 3
+  jmp .L.break.main.255
+.L.case.main.256:
+  mov dword ptr [rbp-848], 4
+  jmp .L.break.main.255
+.L.case.main.260:
+  mov dword ptr [rbp-848], 5
+.L.break.main.255:
+  movsxd r8, dword ptr [rbp-848]
+  lea r9, [rip+.L.data.main.458]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.459]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov r8, 2
+  lea r9, [rip+.L.data.main.460]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov r8, 3
+  lea r9, [rip+.L.data.main.461]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  lea rdi, [rbp-828]
+  add rdi, 0
+  mov dword ptr [rdi], 1
+  lea rdi, [rbp-828]
+  add rdi, 4
+  mov dword ptr [rdi], 2
+  lea rdi, [rbp-828]
+  add rdi, 8
+  mov dword ptr [rdi], 3
+  lea rdi, [rbp-828]
+  add rdi, 0
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.462]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  lea rdi, [rbp-816]
+  add rdi, 0
+  mov dword ptr [rdi], 1
+  lea rdi, [rbp-816]
+  add rdi, 4
+  mov dword ptr [rdi], 2
+  lea rdi, [rbp-816]
+  add rdi, 8
+  mov dword ptr [rdi], 3
+  lea rdi, [rbp-816]
+  add rdi, 4
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.463]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  lea rdi, [rbp-804]
+  add rdi, 0
+  mov dword ptr [rdi], 1
+  lea rdi, [rbp-804]
+  add rdi, 4
+  mov dword ptr [rdi], 2
+  lea rdi, [rbp-804]
+  add rdi, 8
+  mov dword ptr [rdi], 3
+  lea rdi, [rbp-804]
+  add rdi, 8
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.464]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  lea rdi, [rbp-792]
+  add rdi, 0
+  mov dword ptr [rdi], 1
+  lea rdi, [rbp-792]
+  add rdi, 4
+  mov dword ptr [rdi], 2
+  lea rdi, [rbp-792]
+  add rdi, 8
+  mov dword ptr [rdi], 3
+  lea rdi, [rbp-792]
+  add rdi, 8
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.465]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  lea rdi, [rbp-780]
+  add rdi, 0
+  mov dword ptr [rdi], 0
+  lea rdi, [rbp-780]
+  add rdi, 4
+  mov dword ptr [rdi], 0
+  lea rdi, [rbp-780]
+  add rdi, 8
+  mov dword ptr [rdi], 0
+  lea rdi, [rbp-780]
+  add rdi, 0
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.466]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  lea rdi, [rbp-768]
+  add rdi, 0
+  mov dword ptr [rdi], 0
+  lea rdi, [rbp-768]
+  add rdi, 4
+  mov dword ptr [rdi], 0
+  lea rdi, [rbp-768]
+  add rdi, 8
+  mov dword ptr [rdi], 0
+  lea rdi, [rbp-768]
+  add rdi, 4
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.467]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  lea rdi, [rbp-756]
+  add rdi, 0
+  mov dword ptr [rdi], 0
+  lea rdi, [rbp-756]
+  add rdi, 4
+  mov dword ptr [rdi], 0
+  lea rdi, [rbp-756]
+  add rdi, 8
+  mov dword ptr [rdi], 0
+  lea rdi, [rbp-756]
+  add rdi, 8
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.468]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  lea rdi, [rbp-744]
+  add rdi, 0
+  add rdi, 0
+  mov dword ptr [rdi], 1
+  lea rdi, [rbp-744]
+  add rdi, 0
+  add rdi, 4
+  mov dword ptr [rdi], 2
+  lea rdi, [rbp-744]
+  add rdi, 0
+  add rdi, 8
+  mov dword ptr [rdi], 3
+  lea rdi, [rbp-744]
+  add rdi, 12
+  add rdi, 0
+  mov dword ptr [rdi], 4
+  lea rdi, [rbp-744]
+  add rdi, 12
+  add rdi, 4
+  mov dword ptr [rdi], 5
+  lea rdi, [rbp-744]
+  add rdi, 12
+  add rdi, 8
+  mov dword ptr [rdi], 6
+  lea rdi, [rbp-744]
+  add rdi, 0
+  add rdi, 4
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.469]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  lea rdi, [rbp-720]
+  add rdi, 0
+  add rdi, 0
+  mov dword ptr [rdi], 1
+  lea rdi, [rbp-720]
+  add rdi, 0
+  add rdi, 4
+  mov dword ptr [rdi], 2
+  lea rdi, [rbp-720]
+  add rdi, 0
+  add rdi, 8
+  mov dword ptr [rdi], 3
+  lea rdi, [rbp-720]
+  add rdi, 12
+  add rdi, 0
+  mov dword ptr [rdi], 4
+  lea rdi, [rbp-720]
+  add rdi, 12
+  add rdi, 4
+  mov dword ptr [rdi], 5
+  lea rdi, [rbp-720]
+  add rdi, 12
+  add rdi, 8
+  mov dword ptr [rdi], 6
+  lea rdi, [rbp-720]
+  add rdi, 12
+  add rdi, 0
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.470]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 6
+  lea rdi, [rbp-696]
+  add rdi, 0
+  add rdi, 0
+  mov dword ptr [rdi], 1
+  lea rdi, [rbp-696]
+  add rdi, 0
+  add rdi, 4
+  mov dword ptr [rdi], 2
+  lea rdi, [rbp-696]
+  add rdi, 0
+  add rdi, 8
+  mov dword ptr [rdi], 3
+  lea rdi, [rbp-696]
+  add rdi, 12
+  add rdi, 0
+  mov dword ptr [rdi], 4
+  lea rdi, [rbp-696]
+  add rdi, 12
+  add rdi, 4
+  mov dword ptr [rdi], 5
+  lea rdi, [rbp-696]
+  add rdi, 12
+  add rdi, 8
+  mov dword ptr [rdi], 6
+  lea rdi, [rbp-696]
+  add rdi, 12
+  add rdi, 8
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.471]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  lea rdi, [rbp-672]
+  add rdi, 0
+  add rdi, 0
+  mov dword ptr [rdi], 1
+  lea rdi, [rbp-672]
+  add rdi, 0
+  add rdi, 4
+  mov dword ptr [rdi], 2
+  lea rdi, [rbp-672]
+  add rdi, 0
+  add rdi, 8
+  mov dword ptr [rdi], 0
+  lea rdi, [rbp-672]
+  add rdi, 12
+  add rdi, 0
+  mov dword ptr [rdi], 0
+  lea rdi, [rbp-672]
+  add rdi, 12
+  add rdi, 8
+  mov dword ptr [rdi], 0
+  lea rdi, [rbp-672]
+  add rdi, 0
+  add rdi, 4
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.472]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  lea rdi, [rbp-648]
+  add rdi, 0
+  add rdi, 0
+  mov dword ptr [rdi], 1
+  lea rdi, [rbp-648]
+  add rdi, 0
+  add rdi, 4
+  mov dword ptr [rdi], 2
+  lea rdi, [rbp-648]
+  add rdi, 0
+  add rdi, 8
+  mov dword ptr [rdi], 0
+  lea rdi, [rbp-648]
+  add rdi, 12
+  add rdi, 0
+  mov dword ptr [rdi], 0
+  lea rdi, [rbp-648]
+  add rdi, 12
+  add rdi, 8
+  mov dword ptr [rdi], 0
+  lea rdi, [rbp-648]
+  add rdi, 12
+  add rdi, 0
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.473]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  lea rdi, [rbp-624]
+  add rdi, 0
+  add rdi, 0
+  mov dword ptr [rdi], 1
+  lea rdi, [rbp-624]
+  add rdi, 0
+  add rdi, 4
+  mov dword ptr [rdi], 2
+  lea rdi, [rbp-624]
+  add rdi, 0
+  add rdi, 8
+  mov dword ptr [rdi], 0
+  lea rdi, [rbp-624]
+  add rdi, 12
+  add rdi, 0
+  mov dword ptr [rdi], 0
+  lea rdi, [rbp-624]
+  add rdi, 12
+  add rdi, 8
+  mov dword ptr [rdi], 0
+  lea rdi, [rbp-624]
+  add rdi, 12
+  add rdi, 8
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.474]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 97
+  lea rdi, [rbp-600]
+  add rdi, 0
+  mov byte ptr [rdi], 97
+  lea rdi, [rbp-600]
+  add rdi, 1
+  mov byte ptr [rdi], 98
+  lea rdi, [rbp-600]
+  add rdi, 2
+  mov byte ptr [rdi], 99
+  lea rdi, [rbp-600]
+  add rdi, 3
+  mov byte ptr [rdi], 0
+  lea rdi, [rbp-600]
+  add rdi, 0
+  movsx r8, byte ptr [rdi]
+  lea r9, [rip+.L.data.main.475]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 99
+  lea rdi, [rbp-596]
+  add rdi, 0
+  mov byte ptr [rdi], 97
+  lea rdi, [rbp-596]
+  add rdi, 1
+  mov byte ptr [rdi], 98
+  lea rdi, [rbp-596]
+  add rdi, 2
+  mov byte ptr [rdi], 99
+  lea rdi, [rbp-596]
+  add rdi, 3
+  mov byte ptr [rdi], 0
+  lea rdi, [rbp-596]
+  add rdi, 2
+  movsx r8, byte ptr [rdi]
+  lea r9, [rip+.L.data.main.476]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  lea rdi, [rbp-592]
+  add rdi, 0
+  mov byte ptr [rdi], 97
+  lea rdi, [rbp-592]
+  add rdi, 1
+  mov byte ptr [rdi], 98
+  lea rdi, [rbp-592]
+  add rdi, 2
+  mov byte ptr [rdi], 99
+  lea rdi, [rbp-592]
+  add rdi, 3
+  mov byte ptr [rdi], 0
+  lea rdi, [rbp-592]
+  add rdi, 3
+  movsx r8, byte ptr [rdi]
+  lea r9, [rip+.L.data.main.477]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 97
+  lea rdi, [rbp-588]
+  add rdi, 0
+  add rdi, 0
+  mov byte ptr [rdi], 97
+  lea rdi, [rbp-588]
+  add rdi, 0
+  add rdi, 1
+  mov byte ptr [rdi], 98
+  lea rdi, [rbp-588]
+  add rdi, 0
+  add rdi, 2
+  mov byte ptr [rdi], 99
+  lea rdi, [rbp-588]
+  add rdi, 0
+  add rdi, 3
+  mov byte ptr [rdi], 0
+  lea rdi, [rbp-588]
+  add rdi, 4
+  add rdi, 0
+  mov byte ptr [rdi], 100
+  lea rdi, [rbp-588]
+  add rdi, 4
+  add rdi, 1
+  mov byte ptr [rdi], 101
+  lea rdi, [rbp-588]
+  add rdi, 4
+  add rdi, 2
+  mov byte ptr [rdi], 102
+  lea rdi, [rbp-588]
+  add rdi, 4
+  add rdi, 3
+  mov byte ptr [rdi], 0
+  lea rdi, [rbp-588]
+  add rdi, 0
+  add rdi, 0
+  movsx r8, byte ptr [rdi]
+  lea r9, [rip+.L.data.main.478]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  lea rdi, [rbp-580]
+  add rdi, 0
+  add rdi, 0
+  mov byte ptr [rdi], 97
+  lea rdi, [rbp-580]
+  add rdi, 0
+  add rdi, 1
+  mov byte ptr [rdi], 98
+  lea rdi, [rbp-580]
+  add rdi, 0
+  add rdi, 2
+  mov byte ptr [rdi], 99
+  lea rdi, [rbp-580]
+  add rdi, 0
+  add rdi, 3
+  mov byte ptr [rdi], 0
+  lea rdi, [rbp-580]
+  add rdi, 4
+  add rdi, 0
+  mov byte ptr [rdi], 100
+  lea rdi, [rbp-580]
+  add rdi, 4
+  add rdi, 1
+  mov byte ptr [rdi], 101
+  lea rdi, [rbp-580]
+  add rdi, 4
+  add rdi, 2
+  mov byte ptr [rdi], 102
+  lea rdi, [rbp-580]
+  add rdi, 4
+  add rdi, 3
+  mov byte ptr [rdi], 0
+  lea rdi, [rbp-580]
+  add rdi, 0
+  add rdi, 3
+  movsx r8, byte ptr [rdi]
+  lea r9, [rip+.L.data.main.479]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 100
+  lea rdi, [rbp-572]
+  add rdi, 0
+  add rdi, 0
+  mov byte ptr [rdi], 97
+  lea rdi, [rbp-572]
+  add rdi, 0
+  add rdi, 1
+  mov byte ptr [rdi], 98
+  lea rdi, [rbp-572]
+  add rdi, 0
+  add rdi, 2
+  mov byte ptr [rdi], 99
+  lea rdi, [rbp-572]
+  add rdi, 0
+  add rdi, 3
+  mov byte ptr [rdi], 0
+  lea rdi, [rbp-572]
+  add rdi, 4
+  add rdi, 0
+  mov byte ptr [rdi], 100
+  lea rdi, [rbp-572]
+  add rdi, 4
+  add rdi, 1
+  mov byte ptr [rdi], 101
+  lea rdi, [rbp-572]
+  add rdi, 4
+  add rdi, 2
+  mov byte ptr [rdi], 102
+  lea rdi, [rbp-572]
+  add rdi, 4
+  add rdi, 3
+  mov byte ptr [rdi], 0
+  lea rdi, [rbp-572]
+  add rdi, 4
+  add rdi, 0
+  movsx r8, byte ptr [rdi]
+  lea r9, [rip+.L.data.main.480]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 102
+  lea rdi, [rbp-564]
+  add rdi, 0
+  add rdi, 0
+  mov byte ptr [rdi], 97
+  lea rdi, [rbp-564]
+  add rdi, 0
+  add rdi, 1
+  mov byte ptr [rdi], 98
+  lea rdi, [rbp-564]
+  add rdi, 0
+  add rdi, 2
+  mov byte ptr [rdi], 99
+  lea rdi, [rbp-564]
+  add rdi, 0
+  add rdi, 3
+  mov byte ptr [rdi], 0
+  lea rdi, [rbp-564]
+  add rdi, 4
+  add rdi, 0
+  mov byte ptr [rdi], 100
+  lea rdi, [rbp-564]
+  add rdi, 4
+  add rdi, 1
+  mov byte ptr [rdi], 101
+  lea rdi, [rbp-564]
+  add rdi, 4
+  add rdi, 2
+  mov byte ptr [rdi], 102
+  lea rdi, [rbp-564]
+  add rdi, 4
+  add rdi, 3
+  mov byte ptr [rdi], 0
+  lea rdi, [rbp-564]
+  add rdi, 4
+  add rdi, 2
+  movsx r8, byte ptr [rdi]
+  lea r9, [rip+.L.data.main.481]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  lea rdi, [rbp-556]
+  add rdi, 0
+  mov dword ptr [rdi], 1
+  lea rdi, [rbp-556]
+  add rdi, 4
+  mov dword ptr [rdi], 2
+  lea rdi, [rbp-556]
+  add rdi, 8
+  mov dword ptr [rdi], 3
+  lea rdi, [rbp-556]
+  add rdi, 12
+  mov dword ptr [rdi], 4
+  lea rdi, [rbp-556]
+  add rdi, 12
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.482]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 16
+  lea rdi, [rbp-540]
+  add rdi, 0
+  mov dword ptr [rdi], 1
+  lea rdi, [rbp-540]
+  add rdi, 4
+  mov dword ptr [rdi], 2
+  lea rdi, [rbp-540]
+  add rdi, 8
+  mov dword ptr [rdi], 3
+  lea rdi, [rbp-540]
+  add rdi, 12
+  mov dword ptr [rdi], 4
+  mov r8, 16
+  lea r9, [rip+.L.data.main.483]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  lea rdi, [rbp-524]
+  add rdi, 0
+  mov byte ptr [rdi], 102
+  lea rdi, [rbp-524]
+  add rdi, 1
+  mov byte ptr [rdi], 111
+  lea rdi, [rbp-524]
+  add rdi, 2
+  mov byte ptr [rdi], 111
+  lea rdi, [rbp-524]
+  add rdi, 3
+  mov byte ptr [rdi], 0
+  mov r8, 4
+  lea r9, [rip+.L.data.main.484]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov dword ptr [rbp-520], 1
+  mov dword ptr [rbp-516], 2
+  mov dword ptr [rbp-512], 3
+  movsxd r8, dword ptr [rbp-520]
+  lea r9, [rip+.L.data.main.485]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov dword ptr [rbp-508], 1
+  mov dword ptr [rbp-504], 2
+  mov dword ptr [rbp-500], 3
+  movsxd r8, dword ptr [rbp-504]
+  lea r9, [rip+.L.data.main.486]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov dword ptr [rbp-496], 1
+  mov dword ptr [rbp-492], 2
+  mov dword ptr [rbp-488], 3
+  movsxd r8, dword ptr [rbp-488]
+  lea r9, [rip+.L.data.main.487]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov dword ptr [rbp-484], 1
+  mov dword ptr [rbp-480], 0
+  mov dword ptr [rbp-476], 0
+  movsxd r8, dword ptr [rbp-484]
+  lea r9, [rip+.L.data.main.488]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  mov dword ptr [rbp-472], 1
+  mov dword ptr [rbp-468], 0
+  mov dword ptr [rbp-464], 0
+  movsxd r8, dword ptr [rbp-468]
+  lea r9, [rip+.L.data.main.489]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  mov dword ptr [rbp-460], 1
+  mov dword ptr [rbp-456], 0
+  mov dword ptr [rbp-452], 0
+  movsxd r8, dword ptr [rbp-452]
+  lea r9, [rip+.L.data.main.490]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  lea rdi, [rbp-448]
+  add rdi, 0
+  mov dword ptr [rdi], 1
+  lea rdi, [rbp-448]
+  add rdi, 0
+  mov dword ptr [rdi+4], 2
+  lea rdi, [rbp-448]
+  add rdi, 8
+  mov dword ptr [rdi], 3
+  lea rdi, [rbp-448]
+  add rdi, 8
+  mov dword ptr [rdi+4], 4
+  lea rdi, [rbp-448]
+  add rdi, 0
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.491]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  lea rdi, [rbp-432]
+  add rdi, 0
+  mov dword ptr [rdi], 1
+  lea rdi, [rbp-432]
+  add rdi, 0
+  mov dword ptr [rdi+4], 2
+  lea rdi, [rbp-432]
+  add rdi, 8
+  mov dword ptr [rdi], 3
+  lea rdi, [rbp-432]
+  add rdi, 8
+  mov dword ptr [rdi+4], 4
+  lea rdi, [rbp-432]
+  add rdi, 0
+  movsxd r8, dword ptr [rdi+4]
+  lea r9, [rip+.L.data.main.492]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  lea rdi, [rbp-416]
+  add rdi, 0
+  mov dword ptr [rdi], 1
+  lea rdi, [rbp-416]
+  add rdi, 0
+  mov dword ptr [rdi+4], 2
+  lea rdi, [rbp-416]
+  add rdi, 8
+  mov dword ptr [rdi], 3
+  lea rdi, [rbp-416]
+  add rdi, 8
+  mov dword ptr [rdi+4], 4
+  lea rdi, [rbp-416]
+  add rdi, 8
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.493]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  lea rdi, [rbp-400]
+  add rdi, 0
+  mov dword ptr [rdi], 1
+  lea rdi, [rbp-400]
+  add rdi, 0
+  mov dword ptr [rdi+4], 2
+  lea rdi, [rbp-400]
+  add rdi, 8
+  mov dword ptr [rdi], 3
+  lea rdi, [rbp-400]
+  add rdi, 8
+  mov dword ptr [rdi+4], 4
+  lea rdi, [rbp-400]
+  add rdi, 8
+  movsxd r8, dword ptr [rdi+4]
+  lea r9, [rip+.L.data.main.494]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  lea rdi, [rbp-384]
+  add rdi, 0
+  mov dword ptr [rdi], 1
+  lea rdi, [rbp-384]
+  add rdi, 0
+  mov dword ptr [rdi+4], 2
+  lea rdi, [rbp-384]
+  add rdi, 8
+  mov qword ptr [rdi], 0
+  lea rdi, [rbp-384]
+  add rdi, 8
+  movsxd r8, dword ptr [rdi+4]
+  lea r9, [rip+.L.data.main.495]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  mov dword ptr [rbp-368], 0
+  mov dword ptr [rbp-364], 0
+  movsxd r8, dword ptr [rbp-368]
+  lea r9, [rip+.L.data.main.496]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  mov dword ptr [rbp-360], 0
+  mov dword ptr [rbp-356], 0
+  movsxd r8, dword ptr [rbp-356]
+  lea r9, [rip+.L.data.main.497]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  movsx r8, byte ptr [rip+g3]
+  lea r9, [rip+.L.data.main.498]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  movsx r8, word ptr [rip+g4]
+  lea r9, [rip+.L.data.main.499]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 5
+  movsxd r8, dword ptr [rip+g5]
+  lea r9, [rip+.L.data.main.500]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 6
+  mov r8, qword ptr [rip+g6]
+  lea r9, [rip+.L.data.main.501]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 5
+  mov rdi, qword ptr [rip+g7]
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.502]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4736], 0
+  mov rsi, qword ptr [rip+g8]
+  lea r8, [rip+.L.data.main.503]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.504]
+  mov rdi, qword ptr [rbp-4736]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  lea rdi, [rip+g9]
+  add rdi, 0
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.505]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  lea rdi, [rip+g9]
+  add rdi, 4
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.506]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  lea rdi, [rip+g9]
+  add rdi, 8
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.507]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4744], 0
+  lea rsi, [rip+g10]
+  add rsi, 0
+  mov rsi, qword ptr [rsi]
+  lea r8, [rip+.L.data.main.508]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.509]
+  mov rdi, qword ptr [rbp-4744]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4752], 0
+  lea rsi, [rip+g10]
+  add rsi, 8
+  mov rsi, qword ptr [rsi]
+  lea r8, [rip+.L.data.main.510]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.511]
+  mov rdi, qword ptr [rbp-4752]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  lea rdi, [rip+g10]
+  add rdi, 8
+  mov rdi, qword ptr [rdi]
+  add rdi, 3
+  movsx r8, byte ptr [rdi]
+  lea r9, [rip+.L.data.main.512]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov r8, 16
+  mov rdi, r8
+  sar rdi, 63
+  and rdi, 7
+  add r8, rdi
+  sar r8, 3
+  lea r9, [rip+.L.data.main.513]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  lea rdi, [rip+g11]
+  add rdi, 0
+  movsx r8, byte ptr [rdi]
+  lea r9, [rip+.L.data.main.514]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  lea rdi, [rip+g11]
+  add rdi, 0
+  movsxd r8, dword ptr [rdi+4]
+  lea r9, [rip+.L.data.main.515]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  lea rdi, [rip+g11]
+  add rdi, 8
+  movsx r8, byte ptr [rdi]
+  lea r9, [rip+.L.data.main.516]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  lea rdi, [rip+g11]
+  add rdi, 8
+  movsxd r8, dword ptr [rdi+4]
+  lea r9, [rip+.L.data.main.517]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  lea rdi, [rip+g12]
+  add rdi, 0
+  add rdi, 0
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.518]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  lea rdi, [rip+g12]
+  add rdi, 0
+  add rdi, 4
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.519]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  lea rdi, [rip+g12]
+  add rdi, 8
+  add rdi, 0
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.520]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  lea rdi, [rip+g12]
+  add rdi, 8
+  add rdi, 4
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.521]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  lea rdi, [rip+g13]
+  add rdi, 0
+  add rdi, 0
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.522]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  lea rdi, [rip+g13]
+  add rdi, 0
+  add rdi, 4
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.523]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  lea rdi, [rip+g13]
+  add rdi, 8
+  add rdi, 0
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.524]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  lea rdi, [rip+g13]
+  add rdi, 8
+  add rdi, 4
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.525]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  lea rdi, [rip+g14]
+  add rdi, 0
+  add rdi, 0
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.526]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  lea rdi, [rip+g14]
+  add rdi, 0
+  add rdi, 4
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.527]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  lea rdi, [rip+g14]
+  add rdi, 8
+  add rdi, 0
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.528]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  lea rdi, [rip+g14]
+  add rdi, 8
+  add rdi, 4
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.529]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  lea rdi, [rbp-352]
+  add rdi, 0
+  add rdi, 0
+  mov dword ptr [rdi], 0
+  lea rdi, [rbp-352]
+  add rdi, 0
+  add rdi, 4
+  mov dword ptr [rdi], 1
+  lea rdi, [rbp-352]
+  add rdi, 0
+  add rdi, 8
+  mov dword ptr [rdi], 2
+  lea rdi, [rbp-352]
+  add rdi, 12
+  add rdi, 0
+  mov dword ptr [rdi], 3
+  lea rdi, [rbp-352]
+  add rdi, 12
+  add rdi, 4
+  mov dword ptr [rdi], 4
+  lea rdi, [rbp-352]
+  add rdi, 12
+  add rdi, 8
+  mov dword ptr [rdi], 5
+  lea rdi, [rbp-352]
+  add rdi, 0
+  add rdi, 0
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.530]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  lea rdi, [rbp-328]
+  add rdi, 0
+  add rdi, 0
+  mov dword ptr [rdi], 0
+  lea rdi, [rbp-328]
+  add rdi, 0
+  add rdi, 4
+  mov dword ptr [rdi], 1
+  lea rdi, [rbp-328]
+  add rdi, 0
+  add rdi, 8
+  mov dword ptr [rdi], 2
+  lea rdi, [rbp-328]
+  add rdi, 12
+  add rdi, 0
+  mov dword ptr [rdi], 3
+  lea rdi, [rbp-328]
+  add rdi, 12
+  add rdi, 4
+  mov dword ptr [rdi], 4
+  lea rdi, [rbp-328]
+  add rdi, 12
+  add rdi, 8
+  mov dword ptr [rdi], 5
+  lea rdi, [rbp-328]
+  add rdi, 12
+  add rdi, 0
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.531]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 0
+  lea rdi, [rbp-304]
+  add rdi, 0
+  mov dword ptr [rdi], 0
+  lea rdi, [rbp-304]
+  add rdi, 0
+  mov dword ptr [rdi+4], 1
+  lea rdi, [rbp-304]
+  add rdi, 8
+  mov dword ptr [rdi], 2
+  lea rdi, [rbp-304]
+  add rdi, 8
+  mov dword ptr [rdi+4], 3
+  lea rdi, [rbp-304]
+  add rdi, 0
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.532]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  lea rdi, [rbp-288]
+  add rdi, 0
+  mov dword ptr [rdi], 0
+  lea rdi, [rbp-288]
+  add rdi, 0
+  mov dword ptr [rdi+4], 1
+  lea rdi, [rbp-288]
+  add rdi, 8
+  mov dword ptr [rdi], 2
+  lea rdi, [rbp-288]
+  add rdi, 8
+  mov dword ptr [rdi+4], 3
+  lea rdi, [rbp-288]
+  add rdi, 8
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.533]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4760], 0
+  mov rsi, qword ptr [rip+g15]
+  lea r8, [rip+.L.data.main.534]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.535]
+  mov rdi, qword ptr [rbp-4760]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4768], 0
+  lea rsi, [rip+g16]
+  add rsi, 0
+  lea r8, [rip+.L.data.main.536]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.537]
+  mov rdi, qword ptr [rbp-4768]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4776], 0
+  lea rsi, [rip+g16]
+  add rsi, 4
+  lea r8, [rip+.L.data.main.538]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.539]
+  mov rdi, qword ptr [rbp-4776]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov rsi, 7
+  mov r8, 7
+  lea r9, [rip+.L.data.main.540]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 10
+  mov r8, 10
+  lea r9, [rip+.L.data.main.541]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov r8, 3
+  lea r9, [rip+.L.data.main.542]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4784], 0
+  lea rsi, [rip+g17]
+  lea r8, [rip+.L.data.main.543]
+  mov r9, 7
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call memcmp
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.544]
+  mov rdi, qword ptr [rbp-4784]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4792], 0
+  lea rsi, [rip+g18]
+  lea r8, [rip+.L.data.main.545]
+  mov r9, 10
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call memcmp
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.546]
+  mov rdi, qword ptr [rbp-4792]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4800], 0
+  lea rsi, [rip+g19]
+  lea r8, [rip+.L.data.main.547]
+  mov r9, 3
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call memcmp
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.548]
+  mov rdi, qword ptr [rbp-4800]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4808], 0
+  mov rsi, qword ptr [rip+g20]
+  lea r8, [rip+.L.data.main.549]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.550]
+  mov rdi, qword ptr [rbp-4808]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4816], 0
+  mov rsi, qword ptr [rip+g21]
+  lea r8, [rip+.L.data.main.551]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.552]
+  mov rdi, qword ptr [rbp-4816]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4824], 0
+  mov rsi, qword ptr [rip+g22]
+  add rsi, 3
+  lea r8, [rip+.L.data.main.553]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.554]
+  mov rdi, qword ptr [rbp-4824]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4832], 0
+  lea rsi, [rip+g23]
+  add rsi, 0
+  mov rsi, qword ptr [rsi]
+  lea r8, [rip+.L.data.main.555]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.556]
+  mov rdi, qword ptr [rbp-4832]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4840], 0
+  lea rsi, [rip+g23]
+  add rsi, 8
+  mov rsi, qword ptr [rsi]
+  lea r8, [rip+.L.data.main.557]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.558]
+  mov rdi, qword ptr [rbp-4840]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4848], 0
+  lea rsi, [rip+g23]
+  add rsi, 16
+  mov rsi, qword ptr [rsi]
+  add rsi, 3
+  lea r8, [rip+.L.data.main.559]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.560]
+  mov rdi, qword ptr [rbp-4848]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  movsxd r8, dword ptr [rip+g24]
+  lea r9, [rip+.L.data.main.561]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov rdi, qword ptr [rip+g25]
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.562]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov rdi, qword ptr [rip+g27]
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.563]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov dword ptr [rip+ext1], 5
+  mov rsi, 5
+  movsxd r8, dword ptr [rip+ext1]
+  lea r9, [rip+.L.data.main.564]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  lea rsi, [rip+ext1]
+  mov qword ptr [rip+ext2], rsi
+  mov rsi, 5
+  mov rdi, qword ptr [rip+ext2]
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.565]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov r8, 1
+  lea r9, [rip+.L.data.main.566]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov r8, 2
+  lea r9, [rip+.L.data.main.567]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  mov r8, 4
+  lea r9, [rip+.L.data.main.568]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.569]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.570]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov r8, 1
+  lea r9, [rip+.L.data.main.571]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  mov r8, 4
+  lea r9, [rip+.L.data.main.572]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov r8, 1
+  lea r9, [rip+.L.data.main.573]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.574]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4856], 2
+  mov rax, 0
+  call counter
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.575]
+  mov rdi, qword ptr [rbp-4856]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4864], 4
+  mov rax, 0
+  call counter
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.576]
+  mov rdi, qword ptr [rbp-4864]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4872], 6
+  mov rax, 0
+  call counter
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.577]
+  mov rdi, qword ptr [rbp-4872]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov dword ptr [rbp-272], 1
+  movsxd r8, dword ptr [rbp-272]
+  lea r9, [rip+.L.data.main.579]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  lea rdi, [rbp-268]
+  add rdi, 0
+  mov dword ptr [rdi], 0
+  lea rdi, [rbp-268]
+  add rdi, 4
+  mov dword ptr [rdi], 1
+  lea rdi, [rbp-268]
+  add rdi, 8
+  mov dword ptr [rdi], 2
+  lea rdi, [rbp-268]
+  add rdi, 8
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.581]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 97
+  mov byte ptr [rbp-256], 97
+  mov dword ptr [rbp-252], 3
+  movsx r8, byte ptr [rbp-256]
+  lea r9, [rip+.L.data.main.583]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov dword ptr [rbp-248], 3
+  movsxd rdi, dword ptr [rbp-248]
+  mov dword ptr [rbp-244], edi
+  movsxd r8, dword ptr [rbp-244]
+  lea r9, [rip+.L.data.main.585]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov rdi, qword ptr [rip+tree]
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.586]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov rdi, qword ptr [rip+tree]
+  mov rdi, qword ptr [rdi+8]
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.587]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 3
+  mov rdi, qword ptr [rip+tree]
+  mov rdi, qword ptr [rdi+8]
+  mov rdi, qword ptr [rdi+8]
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.588]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  mov rdi, qword ptr [rip+tree]
+  mov rdi, qword ptr [rdi+8]
+  mov rdi, qword ptr [rdi+16]
+  movsxd r8, dword ptr [rdi]
+  lea r9, [rip+.L.data.main.589]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rax, 0
+  call ret_none
+  mov rsi, 3
+  movsxd r8, dword ptr [rip+ext3]
+  lea r9, [rip+.L.data.main.590]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov dword ptr [rbp-240], 6
+  and dword ptr [rbp-240], 3
+  movsxd r8, dword ptr [rbp-240]
+  lea r9, [rip+.L.data.main.591]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 7
+  mov dword ptr [rbp-236], 6
+  or dword ptr [rbp-236], 3
+  movsxd r8, dword ptr [rbp-236]
+  lea r9, [rip+.L.data.main.592]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 10
+  mov dword ptr [rbp-232], 15
+  xor dword ptr [rbp-232], 5
+  movsxd r8, dword ptr [rbp-232]
+  lea r9, [rip+.L.data.main.593]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 7
+  mov dword ptr [rbp-228], 0
+  mov dword ptr [rbp-224], 0
+  .p2align 4,,10
+.L.begin.main.262:
+  add dword ptr [rbp-224], 1
+  movsxd rdi, dword ptr [rbp-228]
+  add rdi, 1
+  mov dword ptr [rbp-228], edi
+  sub rdi, 1
+  cmp rdi, 6
+  jl .L.begin.main.262
+  movsxd r8, dword ptr [rbp-224]
+  lea r9, [rip+.L.data.main.594]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  mov dword ptr [rbp-220], 0
+  mov dword ptr [rbp-216], 0
+  mov dword ptr [rbp-212], 0
+  .p2align 4,,10
+.L.begin.main.265:
+  movsxd rdi, dword ptr [rbp-216]
+  add rdi, 1
+  mov dword ptr [rbp-216], edi
+  cmp rdi, 3
+  jle .L.begin.main.265
+  movsxd r8, dword ptr [rbp-216]
+  lea r9, [rip+.L.data.main.595]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4880], 1
+  mov rax, 0
+  call true_fn
+  movzx rsi, al
+  lea r8, [rip+.L.data.main.596]
+  mov rdi, qword ptr [rbp-4880]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4888], 0
+  mov rax, 0
+  call false_fn
+  movzx rsi, al
+  lea r8, [rip+.L.data.main.597]
+  mov rdi, qword ptr [rbp-4888]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4896], 6
+  mov rsi, 1
+  mov r8, 2
+  mov r9, 3
+  mov r10, 0
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call add_all1
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.598]
+  mov rdi, qword ptr [rbp-4896]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4904], 5
+  mov rsi, 1
+  mov r8, 2
+  mov r9, 3
+  mov r10, 0
+  sub r10, 1
+  mov r11, 0
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov r8, r11
+  mov rax, 0
+  call add_all1
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.599]
+  mov rdi, qword ptr [rbp-4904]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4912], 0
+  mov rax, 0
+  call stack_misalignment
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.600]
+  mov rdi, qword ptr [rbp-4912]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4920], 0
+  lea rsi, [rbp-205]
+  add rsi, 0
+  mov byte ptr [rsi], 0
+  mov rax, 0
+  call stack_misalignment
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.601]
+  mov rdi, qword ptr [rbp-4920]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4928], 0
+  mov rax, 0
+  call stack_misalignment
+  mov qword ptr [rbp-4936], rax
+  mov rax, 0
+  call stack_misalignment
+  mov rsi, rax
+  mov r8, 0
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call add_all1
+  mov rsi, rax
+  mov r8, 0
+  mov rdi, qword ptr [rbp-4936]
+  mov rdx, r8
+  mov rax, 0
+  call add_all1
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.602]
+  mov rdi, qword ptr [rbp-4928]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4944], 6
+  mov rsi, 1
+  mov r8, 2
+  mov r9, 3
+  mov r10, 0
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov rax, 0
+  call add_all3
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.603]
+  mov rdi, qword ptr [rbp-4944]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4952], 5
+  mov rsi, 1
+  mov r8, 2
+  mov r9, 3
+  mov r10, 0
+  sub r10, 1
+  mov r11, 0
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov r8, r11
+  mov rax, 0
+  call add_all3
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.604]
+  mov rdi, qword ptr [rbp-4952]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4960], 0
+  lea rsi, [rbp-200]
+  lea r8, [rip+.L.data.main.605]
+  mov r9, 1
+  mov r10, 2
+  lea r11, [rip+.L.data.main.606]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov r8, r11
+  mov rax, 0
+  call fmt
+  lea rsi, [rip+.L.data.main.607]
+  lea r8, [rbp-200]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.608]
+  mov rdi, qword ptr [rbp-4960]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov qword ptr [rbp-4968], 0
+  lea rsi, [rbp-100]
+  lea r8, [rip+.L.data.main.609]
+  mov r9, 1
+  mov r10, 2
+  mov r11, 3
+  mov qword ptr [rbp-4976], 4
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rcx, r10
+  mov r8, r11
+  mov r9, qword ptr [rbp-4976]
+  mov rax, 0
+  call fmt
+  lea rsi, [rip+.L.data.main.610]
+  lea r8, [rbp-100]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rax, 0
+  call strcmp
+  mov rsi, rax
+  lea r8, [rip+.L.data.main.611]
+  mov rdi, qword ptr [rbp-4968]
+  mov rdx, r8
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov r8, 1
+  lea r9, [rip+.L.data.main.612]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov r8, 1
+  lea r9, [rip+.L.data.main.613]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 1
+  mov r8, 1
+  lea r9, [rip+.L.data.main.614]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov r8, 2
+  lea r9, [rip+.L.data.main.615]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov r8, 2
+  lea r9, [rip+.L.data.main.616]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov r8, 2
+  lea r9, [rip+.L.data.main.617]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov r8, 2
+  lea r9, [rip+.L.data.main.618]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 2
+  mov r8, 2
+  lea r9, [rip+.L.data.main.619]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  mov r8, 4
+  lea r9, [rip+.L.data.main.620]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  mov r8, 4
+  lea r9, [rip+.L.data.main.621]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  mov r8, 4
+  lea r9, [rip+.L.data.main.622]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  mov r8, 4
+  lea r9, [rip+.L.data.main.623]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.624]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.625]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.626]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.627]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.628]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.629]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  mov r8, 4
+  lea r9, [rip+.L.data.main.630]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.631]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.632]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.633]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.634]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.635]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.636]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 4
+  mov r8, 4
+  lea r9, [rip+.L.data.main.637]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  mov rsi, 8
+  mov r8, 8
+  lea r9, [rip+.L.data.main.638]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  movabs rsi, 2147483648
+  movabs r8, 2147483648
+  lea r9, [rip+.L.data.main.639]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  movabs rsi, 4294967296
+  mov r8, 1
+  shl r8, 32
+  lea r9, [rip+.L.data.main.640]
+  mov rdi, rsi
+  mov rsi, r8
+  mov rdx, r9
+  mov rax, 0
+  call assert
+  lea rdi, [rip+.L.data.main.641]
+  mov rax, 0
+  call printf
+  mov rax, 0
+.L.return.main:
+  mov rbx, qword ptr [rbp-4984]
+  mov r12, qword ptr [rbp-4992]
+  mov r13, qword ptr [rbp-5000]
+  mov r14, qword ptr [rbp-5008]
+  mov r15, qword ptr [rbp-5016]
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,2306 @@
+typedef struct FILE FILE;
+typedef long size_t;
+struct timespec {
+  long tv_sec;
+  long tv_nsec;
+};
+struct rusage {
+  long ru_utime[2];
+  long ru_stime[2];
+  long ru_maxrss;
+  long ru_rest[13];
+};
+extern FILE *stdout;
+extern FILE *stderr;
+
+void *malloc(long size);
+void *calloc(long nmemb, long size);
+int *__errno_location();
+char *strerror(int errnum);
+FILE *fopen(char *pathname, char *mode);
+long fread(void *ptr, long size, long nmemb, FILE *stream);
+int feof(FILE *stream);
+static void assert() {}
+int strcmp(char *s1, char *s2);
+int printf(char *fmt, ...);
+int sprintf(char *buf, char *fmt, ...);
+long strlen(char *p);
+int strncmp(char *p, char *q);
+void *memcpy(char *dst, char *src, long n);
+char *strndup(char *p, long n);
+int isspace(int c);
+char *strstr(char *haystack, char *needle);
+long strtol(char *nptr, char **endptr, int base);
+int memcmp(char *s1, char *s2, long n);
+int fprintf(FILE *fp, char *fmt, ...);
+int fputs(char *s, FILE *fp);
+long fwrite(void *ptr, long size, long nmemb, FILE *stream);
+int fclose(FILE *fp);
+int fseek(FILE *fp, long offset, int whence);
+long ftell(FILE *fp);
+FILE *open_memstream(char **ptr, size_t *sizeloc);
+int rename(char *oldpath, char *newpath);
+int mkdir(char *pathname, int mode);
+int getpid(void);
+int clock_gettime(int clockid, struct timespec *tp);
+int getrusage(int who, struct rusage *usage);
+void *realloc(void *ptr, long size);
+void free(void *ptr);
+void *memset(void *s, int c, long n);
+int open(char *pathname, int flags, ...);
+int close(int fd);
+long write(int fd, void *buf, long count);
+int ftruncate(int fd, long length);
+void *mmap(void *addr, long length, int prot, int flags, int fd, long offset);
+int munmap(void *addr, long length);
+void *mremap(void *old_address, long old_size, long new_size, int flags);
+int mprotect(void *addr, long len, int prot);
+void *dlopen(char *filename, int flags);
+void *dlsym(void *handle, char *symbol);
+char *dlerror(void);
+char *strchr(char *s, int c);
+void *bsearch(void *key, void *base, long nmemb, long size, void *compar);
+extern char **environ;
+int pipe(int *pipefd);
+int fork(void);
+int waitpid(int pid, int *wstatus, int options);
+long read(int fd, void *buf, long count);
+void _exit(int status);
+void exit(int status);
+void *memmove(void *dest, void *src, long n);
+
+typedef struct {
+  int gp_offset;
+  int fp_offset;
+  void *overflow_arg_area;
+  void *reg_save_area;
+} __va_elem;
+
+typedef __va_elem va_list[1];
+
+static void va_end(__va_elem *ap) {}
+
+typedef struct Type Type;
+typedef struct Member Member;
+typedef struct Initializer Initializer;
+typedef struct Program Program;
+
+// main.c
+
+typedef enum {
+  PHASE_READ,
+  PHASE_TOKENIZE,
+  PHASE_PARSE,
+  PHASE_LAYOUT,
+  PHASE_EMIT_DATA,
+  PHASE_EMIT_TEXT,
+  PHASE_DONE,
+} Phase;
+
+extern char *phase_names[];
+extern Phase current_phase;
+extern _Bool time_report;
+
+long now_ns(void);
+void enter_phase(Phase phase);
+
+// alloc.c
+
+typedef enum {
+  ALLOC_TOKEN,
+  ALLOC_NODE,
+  ALLOC_TYPE,
+  ALLOC_MEMBER,
+  ALLOC_VAR,
+  ALLOC_SCOPE,
+  ALLOC_INITIALIZER,
+  ALLOC_FUNCTION,
+  ALLOC_CODE, // Instructions and the arrays of the back end
+  ALLOC_OTHER,
+  ALLOC_NKINDS,
+} AllocKind;
+
+extern _Bool mem_report;
+
+void *allocate(AllocKind kind, long size);
+void *reallocate(AllocKind kind, void *p, long size);
+void print_mem_report(Program *prog);
+
+// tokenize.c
+
+typedef enum {
+  TK_RESERVED,
+  TK_IDENT,
+  TK_STR,
+  TK_NUM,
+  TK_EOF,
+} TokenKind;
+
+typedef struct Token Token;
+struct Token {
+  TokenKind kind;
+  Token *next;
+  long val;
+  Type *ty;
+  char *str;
+  int len;
+
+  char *contents;
+  int cont_len;
+};
+
+void error(char *fmt, ...);
+void error_at(char *loc, char *fmt, ...);
+void error_tok(Token *tok, char *fmt, ...);
+void warn_tok(Token *tok, char *fmt, ...);
+Token *peek(char *s);
+Token *consume(char *op);
+Token *consume_ident(void);
+void expect(char *op);
+char *expect_ident(void);
+_Bool at_eof(void);
+Token *tokenize(void);
+
+extern char *filename;
+extern char *user_input;
+extern Token *token;
+
+// parse.c
+
+typedef struct Var Var;
+struct Var {
+  char *name;
+  Type *ty;
+  _Bool is_local;
+
+  int offset;
+
+  _Bool is_static;
+  Initializer *initializer;
+
+  // Set by promote_vars(). A local variable in a register has no stack
+  // slot and is held by virtual register reg instead.
+  int uses;
+  _Bool addr_taken;
+  _Bool in_reg;
+  int reg;
+};
+
+typedef struct VarList VarList;
+struct VarList {
+  VarList *next;
+  Var *var;
+};
+
+typedef enum {
+  ND_ADD,
+  ND_PTR_ADD,
+  ND_SUB,
+  ND_PTR_SUB,
+  ND_PTR_DIFF,
+  ND_MUL,
+  ND_DIV,
+  ND_BITAND,
+  ND_BITOR,
+  ND_BITXOR,
+  ND_SHL,
+  ND_SHR,
+  ND_EQ,
+  ND_NE,
+  ND_LT,
+  ND_LE,
+  ND_ASSIGN,
+  ND_TERNARY,
+  ND_PRE_INC,
+  ND_PRE_DEC,
+  ND_POST_INC,
+  ND_POST_DEC,
+  ND_ADD_EQ,
+  ND_PTR_ADD_EQ,
+  ND_SUB_EQ,
+  ND_PTR_SUB_EQ,
+  ND_MUL_EQ,
+  ND_DIV_EQ,
+  ND_SHL_EQ,
+  ND_SHR_EQ,
+  ND_BITAND_EQ,
+  ND_BITOR_EQ,
+  ND_BITXOR_EQ,
+  ND_COMMA,
+  ND_MEMBER,
+  ND_ADDR,
+  ND_DEREF,
+  ND_NOT,
+  ND_BITNOT,
+  ND_LOGAND,
+  ND_LOGOR,
+  ND_RETURN,
+  ND_IF,
+  ND_WHILE,
+  ND_FOR,
+  ND_DO,
+  ND_SWITCH,
+  ND_CASE,
+  ND_BLOCK,
+  ND_BREAK,
+  ND_CONTINUE,
+  ND_GOTO,
+  ND_LABEL,
+  ND_FUNCALL,
+  ND_EXPR_STMT,
+  ND_STMT_EXPR,
+  ND_VAR,
+  ND_NUM,
+  ND_CAST,
+  ND_NULL,
+} NodeKind;
+
+typedef struct Node Node;
+struct Node {
+  NodeKind kind;
+  Node *next;
+  Type *ty;
+  Token *tok;
+
+  Node *lhs;
+  Node *rhs;
+
+  Node *cond;
+  Node *then;
+  Node *els;
+  Node *init;
+  Node *inc;
+
+  Node *body;
+
+  Member *member;
+
+  char *funcname;
+  Node *args;
+
+  char *label_name;
+
+  Node *case_next;
+  Node *default_case;
+  int case_label;
+  int case_end_label;
+
+  Var *var;
+
+  long val;
+};
+
+struct Initializer {
+  Initializer *next;
+
+  int sz;
+  long val;
+
+  char *label;
+  long addend;
+};
+
+typedef struct Function Function;
+struct Function {
+  Function *next;
+  char *name;
+  VarList *params;
+  _Bool is_static;
+  _Bool has_varargs;
+
+  Node *node;
+  VarList *locals;
+  VarList *globals;
+  int stack_size;
+  int nlabels;
+
+  char *cache_key;
+  char *cached_asm;
+
+  // -ftime-report
+  long parse_ns;
+  long gen_ns;
+  long num_nodes;
+  long num_insns;
+};
+
+struct Program {
+  VarList *globals;
+  Function *fns;
+};
+
+extern long num_nodes;
+
+Program *program(void);
+
+// typing.c
+
+typedef enum {
+  TY_VOID,
+  TY_BOOL,
+  TY_CHAR,
+  TY_SHORT,
+  TY_INT,
+  TY_LONG,
+  TY_ENUM,
+  TY_PTR,
+  TY_ARRAY,
+  TY_STRUCT,
+  TY_FUNC,
+} TypeKind;
+
+struct Type {
+  TypeKind kind;
+  int size;
+  int align;
+  _Bool is_incomplete;
+
+  Type *base;
+  int array_len;
+  Member *members;
+  Type *return_ty;
+};
+
+struct  Member {
+  Member *next;
+  Type *ty;
+  Token *tok;
+  char *name;
+  int offset;
+};
+
+extern Type *void_type;
+extern Type *bool_type;
+extern Type *char_type;
+extern Type *short_type;
+extern Type *int_type;
+extern Type *long_type;
+
+_Bool is_integer(Type *ty);
+int align_to(int n, int align);
+Type *pointer_to(Type *base);
+Type *array_of(Type *base, int size);
+Type *func_type(Type *return_ty);
+Type *enum_type(void);
+Type *struct_type(void);
+void add_type(Node *node);
+
+// sink.c
+
+// An output sink collects bytes in a large buffer. It hands them to a file
+// descriptor whenever the buffer fills up, keeps them all in memory if it
+// has no file descriptor, or writes them into an mmap'd file.
+typedef struct {
+  char *buf;
+  long len;
+  long cap;
+  int fd;
+  _Bool mapped;
+} Sink;
+
+Sink *new_fd_sink(int fd);
+Sink *new_mem_sink(void);
+Sink *new_file_sink(char *path);
+void sink_reserve(Sink *s, long n);
+void sink_write(Sink *s, char *p, long len);
+void sink_str(Sink *s, char *str);
+void sink_char(Sink *s, int c);
+void sink_int(Sink *s, long val);
+char *write_int(char *p, long val);
+void sink_le(Sink *s, long val, int size);
+void sink_align(Sink *s, int align);
+void sink_close(Sink *s);
+
+// asm.c
+
+// Registers are numbered as in the instruction encoding.
+typedef enum {
+  RAX,
+  RCX,
+  RDX,
+  RBX,
+  RSP,
+  RBP,
+  RSI,
+  RDI,
+  R8,
+  R9,
+  R10,
+  R11,
+  R12,
+  R13,
+  R14,
+  R15,
+
+  // Registers from here on are virtual. Code generation uses as many as
+  // it likes and the register allocator maps them to the ones above.
+  VREG,
+} Reg;
+
+// Condition codes are numbered as in the encoding of jcc and setcc.
+typedef enum {
+  CC_E = 4,
+  CC_NE = 5,
+  CC_A = 7,
+  CC_L = 12,
+  CC_GE = 13,
+  CC_LE = 14,
+  CC_G = 15,
+} CondCode;
+
+typedef enum {
+  OP_NONE,
+  OP_REG,   // reg
+  OP_IMM,   // val
+  OP_MEM,   // [reg+index*scale+val], or [rip+sym+val] if sym is set.
+            // There is no index if scale is 0.
+  OP_LABEL, // Local label number val, or [rip+label] for lea
+  OP_SYM,   // Symbol sym
+} OperandKind;
+
+typedef struct {
+  OperandKind kind;
+  int size;
+  int reg;
+  int index;
+  int scale;
+  long val;
+  char *sym;
+} Operand;
+
+typedef enum {
+  I_LABEL,
+  I_MOV,
+  I_MOVSX,
+  I_MOVZX,
+  I_LEA,
+  I_PUSH,
+  I_POP,
+  I_ADD,
+  I_SUB,
+  I_IMUL,
+  I_CQO,
+  I_IDIV,
+  I_IMULH, // rdx:rax = rax * dst
+  I_AND,
+  I_OR,
+  I_XOR,
+  I_SHL,
+  I_SAR,
+  I_NOT,
+  I_CMP,
+  I_SETCC,
+  I_JMP,
+  I_JCC,
+  I_CALL,
+  I_RET,
+  I_ENTRY, // Jump table entry: the offset of label dst from label src
+  I_ALIGN, // Padding to the next 16 bytes, unless that is more than 10
+} InstKind;
+
+typedef struct {
+  InstKind kind;
+  CondCode cc;
+  Operand dst;
+  Operand src;
+} Inst;
+
+// The instructions of one function. Local labels are referred to by
+// number and named only when printed.
+typedef struct {
+  Inst *insts;
+  int len;
+  int cap;
+  char **labels;
+  int nlabels;
+  int labels_cap;
+  int nregs;
+  int nvars; // Virtual registers from VREG on that hold variables
+  int args;  // Bitmap of the registers holding arguments on entry
+} Code;
+
+void print_insts(Sink *out, Code *code, int start, int end);
+void print_code(Sink *out, Code *code);
+
+// cfg.c
+
+// A basic block is the run of instructions from start to end.
+typedef struct {
+  int start;
+  int end;
+  int *succs;
+  int nsuccs;
+  int *preds;
+  int npreds;
+} Block;
+
+typedef struct {
+  Block *blocks;
+  int nblocks;
+  int *label_block; // The block each label starts, or -1
+} CFG;
+
+CFG *build_cfg(Code *code);
+void free_cfg(CFG *cfg);
+_Bool is_table(CFG *cfg, Code *code, int b);
+
+// opt.c
+
+extern int opt_level;
+extern _Bool dump_code;
+
+void run_passes(Code *code, char *funcname);
+
+// jump.c
+
+void optimize_jumps(Code *code);
+
+// peephole.c
+
+void peephole(Code *code);
+
+// licm.c
+
+void hoist_invariants(Code *code);
+
+// regalloc.c
+
+int alloc_regs(Code *code, int frame_size, _Bool *used);
+
+// elf.c
+
+typedef enum {
+  SEC_UNDEF,
+  SEC_TEXT,
+  SEC_DATA,
+  SEC_BSS,
+} SectionKind;
+
+typedef enum {
+  R_X86_64_64 = 1,
+  R_X86_64_PC32 = 2,
+  R_X86_64_PLT32 = 4,
+} RelocType;
+
+typedef struct {
+  char *name;
+  SectionKind sec;
+  long offset;
+  long size;
+  _Bool is_global;
+  int index;
+} Symbol;
+
+typedef struct {
+  SectionKind sec;
+  long offset;
+  RelocType type;
+  char *sym;
+  long addend;
+} Reloc;
+
+// Machine code and data of a translation unit, with symbols and
+// relocations referring to symbols by name.
+typedef struct {
+  Sink *text;
+  Sink *data;
+  long bss_size;
+  int data_align;
+  int bss_align;
+
+  Symbol **syms;
+  int nsyms;
+  int syms_cap;
+  Symbol **map;
+  int map_cap;
+
+  Reloc *relocs;
+  int nrelocs;
+  int relocs_cap;
+} Object;
+
+Object *new_object(void);
+Symbol *find_symbol(Object *obj, char *name);
+Symbol *obj_symbol(Object *obj, char *name, SectionKind sec, _Bool is_global);
+void obj_reloc(Object *obj, SectionKind sec, long offset, RelocType type,
+               char *sym, long addend);
+void obj_add_globals(Object *obj, VarList *globals);
+void write_object(Object *obj, Sink *out);
+
+// promote.c
+
+void promote_vars(Function *fn);
+
+// inline.c
+
+extern _Bool no_inline;
+
+_Bool may_inline(Token *begin, Token *end);
+Function *find_inline(char *name);
+void inline_function(Function *fn, Token *begin, Token *end);
+
+// encode.c
+
+void encode_code(Object *obj, Code *code);
+void align_text(Object *obj);
+
+// jit.c
+
+void jit_add_library(char *name);
+void run_object(Object *obj, int argc, char **argv);
+
+// worker.c
+
+int start_worker(int *fd);
+void finish_worker(Sink *s, int fd);
+char *wait_worker(int pid, int fd, long *len);
+
+// codegen.c
+
+extern long num_insns;
+extern int codegen_jobs;
+extern _Bool omit_frame_pointer;
+
+void codegen(Program *prog, Sink *out);
+Object *codegen_object(Program *prog);
+
+// cache.c
+
+extern char *cache_dir;
+
+char *cache_load(char *key);
+void cache_store(char *key, char *buf, long len);
+
+static int argreg[] = {RDI, RSI, RDX, RCX, R8, R9};
+
+// Output goes to out as assembly, or to obj as machine code.
+static Sink *out;
+static Object *obj;
+long num_insns;
+static Code *code;
+static int brk_label;
+static int cont_label;
+static char *funcname;
+
+static int gen_expr(Node *node);
+static int gen_value(Node *node);
+static void gen_stmt(Node *node);
+
+static int add_label(char *name) {
+  if (code->nlabels == code->labels_cap) {
+    code->labels_cap *= 2;
+    code->labels = reallocate(ALLOC_CODE, code->labels,
+                              sizeof(char *) * code->labels_cap);
+  }
+  code->labels[code->nlabels] = name;
+  return code->nlabels++;
+}
+
+static int new_label(char *kind) {
+  char *name = malloc(strlen(kind) + strlen(funcname) + 20);
+  sprintf(name, ".L.%s.%s.%d", kind, funcname, code->nlabels);
+  return add_label(name);
+}
+
+// Labels of goto statements are created on first use, which may come
+// before the label itself.
+static int goto_label(char *label_name) {
+  char *name = malloc(strlen(label_name) + strlen(funcname) + 20);
+  sprintf(name, ".L.label.%s.%s", funcname, label_name);
+  for (int i = 1; i < code->nlabels; i++)
+    if (!strcmp(code->labels[i], name))
+      return i;
+  return add_label(name);
+}
+
+static Inst *new_inst(InstKind kind) {
+  if (code->len == code->cap) {
+    code->cap *= 2;
+    code->insts = reallocate(ALLOC_CODE, code->insts, sizeof(Inst) * code->cap);
+  }
+  Inst *inst = &code->insts[code->len++];
+  inst->kind = kind;
+  inst->dst.kind = OP_NONE;
+  inst->dst.sym = 0;
+  inst->src.kind = OP_NONE;
+  inst->src.sym = 0;
+  return inst;
+}
+
+static void set_reg(Operand *op, int reg, int size) {
+  op->kind = OP_REG;
+  op->reg = reg;
+  op->size = size;
+  op->sym = 0;
+}
+
+static void set_imm(Operand *op, long val) {
+  op->kind = OP_IMM;
+  op->val = val;
+  op->size = 8;
+  op->sym = 0;
+}
+
+static void set_mem(Operand *op, int base, long disp, int size) {
+  op->kind = OP_MEM;
+  op->reg = base;
+  op->scale = 0;
+  op->val = disp;
+  op->size = size;
+  op->sym = 0;
+}
+
+// cqo, ret
+static void emit(InstKind kind) { new_inst(kind); }
+
+// push rax, not rax, idiv rdi
+static void emit_r(InstKind kind, int reg) {
+  set_reg(&new_inst(kind)->dst, reg, 8);
+}
+
+// push 1
+static void emit_i(InstKind kind, long imm) {
+  set_imm(&new_inst(kind)->dst, imm);
+}
+
+// push [rsp]
+static void emit_m(InstKind kind, int base, long disp) {
+  set_mem(&new_inst(kind)->dst, base, disp, 8);
+}
+
+// add rax, rdi
+static void emit_rr(InstKind kind, int dst, int src, int size) {
+  Inst *inst = new_inst(kind);
+  set_reg(&inst->dst, dst, size);
+  set_reg(&inst->src, src, size);
+}
+
+// add rax, 8
+static void emit_ri(InstKind kind, int dst, long imm) {
+  Inst *inst = new_inst(kind);
+  set_reg(&inst->dst, dst, 8);
+  set_imm(&inst->src, imm);
+}
+
+// movsx rax, dword ptr [rax]
+static void emit_rm(InstKind kind, int dst, int dsize, int base, long disp,
+                    int msize) {
+  Inst *inst = new_inst(kind);
+  set_reg(&inst->dst, dst, dsize);
+  set_mem(&inst->src, base, disp, msize);
+}
+
+// mov [rax], edi
+static void emit_mr(InstKind kind, int base, long disp, int src, int size) {
+  Inst *inst = new_inst(kind);
+  set_mem(&inst->dst, base, disp, size);
+  set_reg(&inst->src, src, size);
+}
+
+// mov dword ptr [rax], 0
+static void emit_mi(InstKind kind, int base, long disp, long imm, int size) {
+  Inst *inst = new_inst(kind);
+  set_mem(&inst->dst, base, disp, size);
+  set_imm(&inst->src, imm);
+}
+
+// movsx rax, al
+static void emit_ext(InstKind kind, int dst, int src, int src_size) {
+  Inst *inst = new_inst(kind);
+  set_reg(&inst->dst, dst, 8);
+  set_reg(&inst->src, src, src_size);
+}
+
+static void emit_setcc(CondCode cc, int reg) {
+  Inst *inst = new_inst(I_SETCC);
+  inst->cc = cc;
+  set_reg(&inst->dst, reg, 1);
+}
+
+static void emit_jmp(int label) {
+  Inst *inst = new_inst(I_JMP);
+  inst->dst.kind = OP_LABEL;
+  inst->dst.val = label;
+}
+
+static void emit_jcc(CondCode cc, int label) {
+  Inst *inst = new_inst(I_JCC);
+  inst->cc = cc;
+  inst->dst.kind = OP_LABEL;
+  inst->dst.val = label;
+}
+
+static void emit_call(char *sym) {
+  Inst *inst = new_inst(I_CALL);
+  inst->dst.kind = OP_SYM;
+  inst->dst.sym = sym;
+}
+
+static void emit_label(int label) {
+  Inst *inst = new_inst(I_LABEL);
+  inst->dst.kind = OP_LABEL;
+  inst->dst.val = label;
+}
+
+static int new_reg(void) { return code->nregs++; }
+
+// Compares a value with zero and leaves the result in the flags.
+static void test_zero(int reg) { emit_ri(I_CMP, reg, 0); }
+
+static _Bool is_reg_var(Node *node) {
+  return node->kind == ND_VAR && node->var->in_reg;
+}
+
+// Makes a memory operand that refers to an lvalue. Variables and their
+// members are addressed relative to rbp or rip, and everything else
+// relative to a register holding a pointer.
+static void gen_mem(Node *node, Operand *mem) {
+  switch (node->kind) {
+  case ND_VAR: {
+    if (node->init)
+      gen_stmt(node->init);
+
+    Var *var = node->var;
+    if (var->in_reg)
+      error_tok(node->tok, "variable in a register has no address");
+    if (var->is_local) {
+      set_mem(mem, RBP, -var->offset, 8);
+      return;
+    }
+    set_mem(mem, 0, 0, 8);
+    mem->sym = var->name;
+    return;
+  }
+  case ND_DEREF:
+    set_mem(mem, gen_value(node->lhs), 0, 8);
+    return;
+  case ND_MEMBER:
+    gen_mem(node->lhs, mem);
+    mem->val += node->member->offset;
+    return;
+  }
+
+  error_tok(node->tok, "not an lvalue");
+}
+
+static int copy(int reg) {
+  int tmp = new_reg();
+  emit_rr(I_MOV, tmp, reg, 8);
+  return tmp;
+}
+
+// Returns a register holding the address of an lvalue.
+static int gen_addr(Node *node) {
+  Operand mem;
+  gen_mem(node, &mem);
+  if (!mem.sym && !mem.val)
+    return copy(mem.reg);
+
+  Inst *inst = new_inst(I_LEA);
+  set_reg(&inst->dst, new_reg(), 8);
+  memcpy(&inst->src, &mem, sizeof(Operand));
+  return inst->dst.reg;
+}
+
+// An lvalue is a memory operand, or a register operand for a variable in
+// a register.
+static void gen_lval(Node *node, Operand *lval) {
+  if (node->ty->kind == TY_ARRAY)
+    error_tok(node->tok, "not an lvalue");
+  if (!is_reg_var(node)) {
+    gen_mem(node, lval);
+    return;
+  }
+  if (node->init)
+    gen_stmt(node->init);
+  set_reg(lval, node->var->reg, 8);
+}
+
+static int load(Type *ty, Operand *mem) {
+  Inst *inst = new_inst(ty->size == 8 ? I_MOV : I_MOVSX);
+  set_reg(&inst->dst, new_reg(), 8);
+  memcpy(&inst->src, mem, sizeof(Operand));
+  inst->src.size = ty->size;
+  return inst->dst.reg;
+}
+
+static void to_bool(int reg) {
+  test_zero(reg);
+  emit_setcc(CC_NE, reg);
+  emit_ext(I_MOVZX, reg, reg, 1);
+}
+
+static int store(Type *ty, Operand *mem, int reg) {
+  if (ty->kind == TY_BOOL)
+    to_bool(reg);
+
+  assert(ty->size == 1 || ty->size == 2 || ty->size == 4 || ty->size == 8);
+  Inst *inst = new_inst(I_MOV);
+  memcpy(&inst->dst, mem, sizeof(Operand));
+  inst->dst.size = ty->size;
+  set_reg(&inst->src, reg, ty->size);
+  return reg;
+}
+
+static int truncate(Type *ty, int reg) {
+  if (ty->kind == TY_BOOL) {
+    test_zero(reg);
+    emit_setcc(CC_NE, reg);
+  }
+
+  if (ty->size < 8)
+    emit_ext(I_MOVSX, reg, reg, ty->size);
+  return reg;
+}
+
+// A variable in a register holds its value sign-extended to 64 bits, as
+// it would be after loading it from memory.
+static int load_lval(Node *node, Operand *lval) {
+  if (lval->kind == OP_REG)
+    return copy(lval->reg);
+  return load(node->ty, lval);
+}
+
+static int store_lval(Node *node, Operand *lval, int reg) {
+  if (lval->kind == OP_REG) {
+    truncate(node->ty, reg);
+    emit_rr(I_MOV, lval->reg, reg, 8);
+    return reg;
+  }
+  return store(node->ty, lval, reg);
+}
+
+static void inc(Type *ty, int reg) {
+  emit_ri(I_ADD, reg, ty->base ? ty->base->size : 1);
+}
+
+static void dec(Type *ty, int reg) {
+  emit_ri(I_SUB, reg, ty->base ? ty->base->size : 1);
+}
+
+// op lhs, rhs
+static void emit_op(InstKind kind, int lhs, Operand *rhs) {
+  Inst *inst = new_inst(kind);
+  set_reg(&inst->dst, lhs, 8);
+  memcpy(&inst->src, rhs, sizeof(Operand));
+}
+
+// The result goes to a new register so that the operands need not live
+// past the comparison.
+static int gen_compare(CondCode cc, int lhs, Operand *rhs) {
+  int reg = new_reg();
+  emit_op(I_CMP, lhs, rhs);
+  emit_setcc(cc, reg);
+  emit_ext(I_MOVZX, reg, reg, 1);
+  return reg;
+}
+
+// shl lhs, cl
+static void gen_shift(InstKind kind, int lhs, Operand *rhs) {
+  Inst *inst;
+  if (rhs->kind == OP_IMM) {
+    inst = new_inst(kind);
+    set_imm(&inst->src, rhs->val & 63);
+  } else {
+    emit_rr(I_MOV, RCX, rhs->reg, 8);
+    inst = new_inst(kind);
+    set_reg(&inst->src, RCX, 1);
+  }
+  set_reg(&inst->dst, lhs, 8);
+}
+
+// idiv leaves the quotient in rax.
+static void gen_div(int lhs, int rhs) {
+  emit_rr(I_MOV, RAX, lhs, 8);
+  emit(I_CQO);
+  emit_r(I_IDIV, rhs);
+  emit_rr(I_MOV, lhs, RAX, 8);
+}
+
+// Returns k if val is 2^k, or -1.
+static int log2_of(long val) {
+  for (int k = 0; k < 63; k++)
+    if (val == 1L << k)
+      return k;
+  return -1;
+}
+
+// Returns m - 2^64 for the 64-bit multiplier m = 2^(63+l) / d + 1, where
+// 2^(l-1) < d < 2^l, and sets *shift to l - 1. The high half of n * m
+// shifted right by l - 1 is then n / d for any n >= 0, and one more for
+// n < 0 [Granlund and Montgomery, 1994].
+static long div_magic(long d, int *shift) {
+  int l = 0;
+  while (1L << l < d)
+    l++;
+  *shift = l - 1;
+
+  // 2^(63+l) / d is at least 2^63 and less than 2^64, so the long
+  // division only keeps the low 63 bits of the quotient.
+  long q = 0;
+  long r = 1;
+  for (int i = 0; i < 63 + l; i++) {
+    r *= 2;
+    q = (q & ((1L << 62) - 1)) * 2;
+    if (r >= d) {
+      q++;
+      r -= d;
+    }
+  }
+  return q + 1 - (1L << 62) - (1L << 62);
+}
+
+// Divides a register by a nonzero constant, rounding toward zero as idiv
+// does, but without idiv.
+static void gen_div_imm(int reg, long d) {
+  long ad = d < 0 ? -d : d;
+  int k = log2_of(ad);
+
+  if (k > 0) {
+    // A negative dividend is biased by d - 1 so that the shift rounds it
+    // toward zero.
+    int bias = new_reg();
+    emit_rr(I_MOV, bias, reg, 8);
+    emit_ri(I_SAR, bias, 63);
+    emit_ri(I_AND, bias, ad - 1);
+    emit_rr(I_ADD, reg, bias, 8);
+    emit_ri(I_SAR, reg, k);
+  } else if (k < 0) {
+    int shift;
+    emit_ri(I_MOV, RAX, div_magic(ad, &shift));
+    emit_r(I_IMULH, reg);
+    emit_rr(I_ADD, RDX, reg, 8);
+    if (shift)
+      emit_ri(I_SAR, RDX, shift);
+    emit_ri(I_SAR, reg, 63);
+    emit_rr(I_SUB, RDX, reg, 8);
+    emit_rr(I_MOV, reg, RDX, 8);
+  }
+
+  if (d < 0)
+    emit_ri(I_IMUL, reg, -1);
+}
+
+static int to_reg(Operand *op) {
+  if (op->kind == OP_REG)
+    return op->reg;
+  int reg = new_reg();
+  emit_ri(I_MOV, reg, op->val);
+  return reg;
+}
+
+static _Bool is_ptr_arith(Node *node) {
+  switch (node->kind) {
+  case ND_PTR_ADD:
+  case ND_PTR_ADD_EQ:
+  case ND_PTR_SUB:
+  case ND_PTR_SUB_EQ:
+    return 1;
+  }
+  return 0;
+}
+
+// Multiplies a register by a constant. Factors of 3, 5 and 9 are taken
+// with lea and powers of two with shl, which are quicker than imul.
+static void gen_mul_imm(int reg, long val) {
+  int shift = 0;
+  while (val > 0 && !(val & (1L << shift)))
+    shift++;
+  long m = val > 0 ? val >> shift : 0;
+  if (m != 1 && m != 3 && m != 5 && m != 9) {
+    emit_ri(I_IMUL, reg, val);
+    return;
+  }
+
+  if (m > 1) {
+    Inst *inst = new_inst(I_LEA);
+    set_reg(&inst->dst, reg, 8);
+    set_mem(&inst->src, reg, 0, 8);
+    inst->src.index = reg;
+    inst->src.scale = m - 1;
+  }
+  if (shift)
+    emit_ri(I_SHL, reg, shift);
+}
+
+// Evaluates the right-hand side of a binary operator, scaled by the size
+// of the pointee for pointer arithmetic. A constant that fits in 32 bits
+// becomes an immediate, which every instruction but idiv can take.
+static void gen_rhs(Node *node, Operand *op) {
+  long scale = is_ptr_arith(node) ? node->ty->base->size : 1;
+  Node *rhs = node->rhs;
+  if (rhs->kind == ND_NUM && rhs->val * scale == (int)(rhs->val * scale)) {
+    set_imm(op, rhs->val * scale);
+    return;
+  }
+
+  int reg = gen_value(rhs);
+  if (scale != 1) {
+    reg = copy(reg);
+    gen_mul_imm(reg, scale);
+  }
+  set_reg(op, reg, 8);
+}
+
+// Every value is used once, so the result goes to the register of the
+// left-hand side unless it is a comparison. The right-hand side is only
+// read.
+static int gen_binary(Node *node, int lhs, Operand *rhs) {
+  switch (node->kind) {
+  case ND_ADD:
+  case ND_ADD_EQ:
+  case ND_PTR_ADD:
+  case ND_PTR_ADD_EQ:
+    emit_op(I_ADD, lhs, rhs);
+    break;
+  case ND_SUB:
+  case ND_SUB_EQ:
+  case ND_PTR_SUB:
+  case ND_PTR_SUB_EQ:
+    emit_op(I_SUB, lhs, rhs);
+    break;
+  case ND_PTR_DIFF: {
+    // The difference is a multiple of the size, so a shift divides it
+    // exactly if the size is a power of two.
+    emit_op(I_SUB, lhs, rhs);
+    int size = node->lhs->ty->base->size;
+    int shift = log2_of(size);
+    if (shift > 0) {
+      emit_ri(I_SAR, lhs, shift);
+    } else if (shift < 0) {
+      gen_div_imm(lhs, size);
+    }
+    break;
+  }
+  case ND_MUL:
+  case ND_MUL_EQ:
+    if (rhs->kind == OP_IMM)
+      gen_mul_imm(lhs, rhs->val);
+    else
+      emit_op(I_IMUL, lhs, rhs);
+    break;
+  case ND_DIV:
+  case ND_DIV_EQ:
+    if (rhs->kind == OP_IMM && rhs->val)
+      gen_div_imm(lhs, rhs->val);
+    else
+      gen_div(lhs, to_reg(rhs));
+    break;
+  case ND_BITAND:
+  case ND_BITAND_EQ:
+    emit_op(I_AND, lhs, rhs);
+    break;
+  case ND_BITOR:
+  case ND_BITOR_EQ:
+    emit_op(I_OR, lhs, rhs);
+    break;
+  case ND_BITXOR:
+  case ND_BITXOR_EQ:
+    emit_op(I_XOR, lhs, rhs);
+    break;
+  case ND_SHL:
+  case ND_SHL_EQ:
+    gen_shift(I_SHL, lhs, rhs);
+    break;
+  case ND_SHR:
+  case ND_SHR_EQ:
+    gen_shift(I_SAR, lhs, rhs);
+    break;
+  case ND_EQ:
+    return gen_compare(CC_E, lhs, rhs);
+  case ND_NE:
+    return gen_compare(CC_NE, lhs, rhs);
+  case ND_LT:
+    return gen_compare(CC_L, lhs, rhs);
+  case ND_LE:
+    return gen_compare(CC_LE, lhs, rhs);
+  }
+  return lhs;
+}
+
+// ++x or --x
+static int gen_pre_inc(Node *node, _Bool is_inc) {
+  Operand lval;
+  gen_lval(node->lhs, &lval);
+  int reg = load_lval(node->lhs, &lval);
+  if (is_inc)
+    inc(node->ty, reg);
+  else
+    dec(node->ty, reg);
+  return store_lval(node->lhs, &lval, reg);
+}
+
+// x++ or x--. The old value is got back by undoing the change on the
+// stored one, except for a _Bool, whose stored value is 0 or 1 whatever
+// the old one was.
+static int gen_post_inc(Node *node, _Bool is_inc) {
+  Operand lval;
+  gen_lval(node->lhs, &lval);
+  int reg = load_lval(node->lhs, &lval);
+  int old = node->ty->kind == TY_BOOL ? copy(reg) : -1;
+  if (is_inc)
+    inc(node->ty, reg);
+  else
+    dec(node->ty, reg);
+  store_lval(node->lhs, &lval, reg);
+  if (old >= 0)
+    return old;
+  if (is_inc)
+    dec(node->ty, reg);
+  else
+    inc(node->ty, reg);
+  return reg;
+}
+
+// The condition code of a comparison operator, or -1.
+static int compare_cc(NodeKind kind) {
+  switch (kind) {
+  case ND_EQ:
+    return CC_E;
+  case ND_NE:
+    return CC_NE;
+  case ND_LT:
+    return CC_L;
+  case ND_LE:
+    return CC_LE;
+  }
+  return -1;
+}
+
+// Evaluates an expression and jumps to label if it compares to zero as cc
+// says, that is, if it is 0 for CC_E and 1 for CC_NE. Comparisons
+// set the flags for the jump themselves instead of producing 0 or 1 first,
+// and the logical operators only jump.
+static void gen_branch(Node *node, CondCode cc, int label) {
+  switch (node->kind) {
+  case ND_NUM:
+    if ((node->val != 0) == (cc == CC_NE))
+      emit_jmp(label);
+    return;
+  case ND_NOT:
+    gen_branch(node->lhs, cc == CC_E ? CC_NE : CC_E, label);
+    return;
+  case ND_LOGAND:
+  case ND_LOGOR: {
+    // Jumps on a && b if it is 0 or on a || b if it is 1 only need
+    // the operands to jump to the same place.
+    CondCode short_cc = node->kind == ND_LOGAND ? CC_E : CC_NE;
+    if (cc == short_cc) {
+      gen_branch(node->lhs, cc, label);
+      gen_branch(node->rhs, cc, label);
+      return;
+    }
+    int skip = new_label("skip");
+    gen_branch(node->lhs, short_cc, skip);
+    gen_branch(node->rhs, cc, label);
+    emit_label(skip);
+    return;
+  }
+  }
+
+  int cmp = compare_cc(node->kind);
+  if (cmp < 0) {
+    test_zero(gen_value(node));
+    emit_jcc(cc, label);
+    return;
+  }
+
+  // The parser turns a > b into b < a, which often puts a constant on the
+  // left. The operands are swapped back so that it becomes an immediate.
+  int lhs;
+  Operand rhs;
+  Node *num = node->lhs;
+  if (num->kind == ND_NUM && num->val == (int)num->val) {
+    lhs = gen_expr(node->rhs);
+    set_imm(&rhs, num->val);
+    if (cmp == CC_L)
+      cmp = CC_G;
+    else if (cmp == CC_LE)
+      cmp = CC_GE;
+  } else {
+    lhs = gen_expr(node->lhs);
+    gen_rhs(node, &rhs);
+  }
+  emit_op(I_CMP, lhs, &rhs);
+
+  // Flipping the lowest bit negates a condition code.
+  emit_jcc(cc == CC_NE ? cmp : cmp ^ 1, label);
+}
+
+// Returns the cases of a switch statement in order of their values. They
+// are linked in reverse order of appearance, which is usually descending.
+static Node **sort_cases(Node *list, int n) {
+  Node **cases = malloc(sizeof(Node *) * n);
+  int i = n;
+  for (Node *c = list; c; c = c->case_next)
+    cases[--i] = c;
+
+  for (i = 1; i < n; i++) {
+    Node *c = cases[i];
+    int j = i;
+    for (; j > 0 && cases[j - 1]->val > c->val; j--)
+      cases[j] = cases[j - 1];
+    cases[j] = c;
+  }
+  return cases;
+}
+
+// A switch dispatches through a jump table if the case values are dense
+// enough, that is, if there are at least min_table_cases of them and the
+// table has no more than max_table_ratio entries per case.
+static int min_table_cases = 4;
+static int max_table_ratio = 3;
+
+// Cases are compared one by one if there are no more than this many.
+static int max_linear_cases = 3;
+
+// Like emit_ri, but an immediate that does not fit in 32 bits is loaded
+// into a register first, since only mov can take a 64-bit one.
+static void emit_ri_wide(InstKind kind, int dst, long imm) {
+  if (imm == (int)imm) {
+    emit_ri(kind, dst, imm);
+    return;
+  }
+  int tmp = new_reg();
+  emit_ri(I_MOV, tmp, imm);
+  emit_rr(kind, dst, tmp, 8);
+}
+
+// The table follows the indirect jump and holds the offsets of the case
+// labels from the table itself, so it needs no relocations.
+static void gen_jump_table(int reg, Node **cases, int n, int dflt) {
+  long lo = cases[0]->val;
+  long range = cases[n - 1]->val - lo + 1;
+  int table = new_label("table");
+
+  // Values below the lowest case wrap around to large unsigned numbers,
+  // so a single comparison checks both bounds.
+  int idx = copy(reg);
+  if (lo)
+    emit_ri_wide(I_SUB, idx, lo);
+  emit_ri(I_CMP, idx, range - 1);
+  emit_jcc(CC_A, dflt);
+
+  int base = new_reg();
+  Inst *inst = new_inst(I_LEA);
+  set_reg(&inst->dst, base, 8);
+  inst->src.kind = OP_LABEL;
+  inst->src.val = table;
+  emit_ri(I_SHL, idx, 2);
+  emit_rr(I_ADD, idx, base, 8);
+  emit_rm(I_MOVSX, idx, 8, idx, 0, 4);
+  emit_rr(I_ADD, idx, base, 8);
+  emit_r(I_JMP, idx);
+
+  emit_label(table);
+  int i = 0;
+  for (long val = lo; val < lo + range; val++) {
+    inst = new_inst(I_ENTRY);
+    inst->dst.kind = OP_LABEL;
+    inst->dst.val = dflt;
+    inst->src.kind = OP_LABEL;
+    inst->src.val = table;
+    if (cases[i]->val == val)
+      inst->dst.val = cases[i++]->case_label;
+  }
+}
+
+// Jumps to the case whose value is in reg, or to dflt if there is none.
+// The cases are sorted. Dense runs of them go through jump tables, and
+// others are split in half by a comparison with the middle one.
+static void gen_dispatch(int reg, Node **cases, int n, int dflt) {
+  if (n >= min_table_cases &&
+      cases[n - 1]->val - cases[0]->val < (long)n * max_table_ratio) {
+    gen_jump_table(reg, cases, n, dflt);
+    return;
+  }
+
+  if (n <= max_linear_cases) {
+    for (int i = 0; i < n; i++) {
+      emit_ri_wide(I_CMP, reg, cases[i]->val);
+      emit_jcc(CC_E, cases[i]->case_label);
+    }
+    emit_jmp(dflt);
+    return;
+  }
+
+  int mid = n / 2;
+  int upper = new_label("upper");
+  emit_ri_wide(I_CMP, reg, cases[mid]->val);
+  emit_jcc(CC_E, cases[mid]->case_label);
+  emit_jcc(CC_G, upper);
+  gen_dispatch(reg, cases, mid, dflt);
+  emit_label(upper);
+  gen_dispatch(reg, cases + mid + 1, n - mid - 1, dflt);
+}
+
+static int gen_funcall(Node *node) {
+  if (!strcmp(node->funcname, "__builtin_va_start")) {
+    int ap = gen_expr(node->args);
+    int tmp = new_reg();
+    emit_rm(I_MOV, tmp, 4, RBP, -8, 4);
+    emit_mr(I_MOV, ap, 0, tmp, 4);
+    emit_mi(I_MOV, ap, 4, 48, 4);
+    emit_rm(I_LEA, tmp, 8, RBP, 16, 8);
+    emit_mr(I_MOV, ap, 8, tmp, 8);
+    emit_rm(I_LEA, tmp, 8, RBP, -56, 8);
+    emit_mr(I_MOV, ap, 16, tmp, 8);
+    return ap;
+  }
+
+  int args[6];
+  int nargs = 0;
+  for (Node *arg = node->args; arg; arg = arg->next)
+    args[nargs++] = gen_value(arg);
+
+  for (int i = 0; i < nargs; i++)
+    emit_rr(I_MOV, argreg[i], args[i], 8);
+
+  // Values live in registers or in the frame, so nothing is ever pushed
+  // and rsp stays where the prologue put it. The frame size is a multiple
+  // of 16, so rsp is aligned as the ABI requires at every call. al holds
+  // the number of vector registers used by variadic arguments.
+  emit_ri(I_MOV, RAX, 0);
+  emit_call(node->funcname);
+
+  int reg = new_reg();
+  if (node->ty->kind == TY_BOOL)
+    emit_ext(I_MOVZX, reg, RAX, 1);
+  else
+    emit_rr(I_MOV, reg, RAX, 8);
+  return reg;
+}
+
+// Returns the register that holds the value of an expression.
+static int gen_expr(Node *node) {
+  switch (node->kind) {
+  case ND_NUM: {
+    int reg = new_reg();
+    emit_ri(I_MOV, reg, node->val);
+    return reg;
+  }
+  case ND_VAR:
+  case ND_MEMBER:
+  case ND_DEREF: {
+    if (node->kind == ND_DEREF && node->ty->kind == TY_ARRAY)
+      return gen_expr(node->lhs);
+    if (node->ty->kind == TY_ARRAY)
+      return gen_addr(node);
+    Operand lval;
+    gen_lval(node, &lval);
+    return load_lval(node, &lval);
+  }
+  case ND_ASSIGN: {
+    Operand lval;
+    gen_lval(node->lhs, &lval);
+    return store_lval(node->lhs, &lval, gen_expr(node->rhs));
+  }
+  case ND_TERNARY: {
+    int els = new_label("else");
+    int end = new_label("end");
+    int reg = new_reg();
+    gen_branch(node->cond, CC_E, els);
+    emit_rr(I_MOV, reg, gen_value(node->then), 8);
+    emit_jmp(end);
+    emit_label(els);
+    emit_rr(I_MOV, reg, gen_value(node->els), 8);
+    emit_label(end);
+    return reg;
+  }
+  case ND_PRE_INC:
+    return gen_pre_inc(node, 1);
+  case ND_PRE_DEC:
+    return gen_pre_inc(node, 0);
+  case ND_POST_INC:
+    return gen_post_inc(node, 1);
+  case ND_POST_DEC:
+    return gen_post_inc(node, 0);
+  case ND_ADD_EQ:
+  case ND_PTR_ADD_EQ:
+  case ND_SUB_EQ:
+  case ND_PTR_SUB_EQ:
+  case ND_MUL_EQ:
+  case ND_DIV_EQ:
+  case ND_SHL_EQ:
+  case ND_SHR_EQ:
+  case ND_BITAND_EQ:
+  case ND_BITOR_EQ:
+  case ND_BITXOR_EQ: {
+    // The variable is read right before it is written, so that the
+    // peephole pass can turn the three into a single instruction.
+    Operand lval;
+    Operand rhs;
+    gen_lval(node->lhs, &lval);
+    gen_rhs(node, &rhs);
+    int reg = load_lval(node->lhs, &lval);
+    reg = gen_binary(node, reg, &rhs);
+    return store_lval(node->lhs, &lval, reg);
+  }
+  case ND_COMMA:
+    gen_stmt(node->lhs);
+    return gen_expr(node->rhs);
+  case ND_ADDR:
+    return gen_addr(node->lhs);
+  case ND_NOT: {
+    int reg = gen_expr(node->lhs);
+    test_zero(reg);
+    emit_setcc(CC_E, reg);
+    emit_ext(I_MOVZX, reg, reg, 1);
+    return reg;
+  }
+  case ND_BITNOT: {
+    int reg = gen_expr(node->lhs);
+    emit_r(I_NOT, reg);
+    return reg;
+  }
+  case ND_LOGAND: {
+    int f = new_label("0");
+    int end = new_label("end");
+    int reg = new_reg();
+    gen_branch(node->lhs, CC_E, f);
+    gen_branch(node->rhs, CC_E, f);
+    emit_ri(I_MOV, reg, 1);
+    emit_jmp(end);
+    emit_label(f);
+    emit_ri(I_MOV, reg, 0);
+    emit_label(end);
+    return reg;
+  }
+  case ND_LOGOR: {
+    int t = new_label("1");
+    int end = new_label("end");
+    int reg = new_reg();
+    gen_branch(node->lhs, CC_NE, t);
+    gen_branch(node->rhs, CC_NE, t);
+    emit_ri(I_MOV, reg, 0);
+    emit_jmp(end);
+    emit_label(t);
+    emit_ri(I_MOV, reg, 1);
+    emit_label(end);
+    return reg;
+  }
+  case ND_STMT_EXPR: {
+    Node *n = node->body;
+    for (; n->next; n = n->next)
+      gen_stmt(n);
+    return gen_expr(n);
+  }
+  case ND_FUNCALL:
+    return gen_funcall(node);
+  case ND_CAST:
+    return truncate(node->ty, gen_expr(node->lhs));
+  }
+
+  int lhs = gen_expr(node->lhs);
+  Operand rhs;
+  gen_rhs(node, &rhs);
+  return gen_binary(node, lhs, &rhs);
+}
+
+// Returns a register holding the value of an expression like gen_expr(),
+// except that the caller must not modify it. This saves copying variables
+// that live in registers.
+static int gen_value(Node *node) {
+  if (is_reg_var(node) && !node->init)
+    return node->var->reg;
+  return gen_expr(node);
+}
+
+// A condition is copied if it has at most this many nodes and defines no
+// labels.
+static int max_copy_nodes = 24;
+
+static _Bool can_copy(Node *node, int *budget) {
+  for (; node; node = node->next) {
+    if (--*budget < 0 || node->kind == ND_LABEL || node->kind == ND_SWITCH ||
+        node->kind == ND_CASE)
+      return 0;
+    if (!can_copy(node->lhs, budget) || !can_copy(node->rhs, budget) ||
+        !can_copy(node->cond, budget) || !can_copy(node->then, budget) ||
+        !can_copy(node->els, budget) || !can_copy(node->init, budget) ||
+        !can_copy(node->inc, budget) || !can_copy(node->body, budget) ||
+        !can_copy(node->args, budget))
+      return 0;
+  }
+  return 1;
+}
+
+// Loops are rotated so that the only jump an iteration takes is the one
+// back to its beginning, with the condition tested at the end:
+//
+//   if (!cond) goto break;        goto test;
+//   begin: body;                  begin: body;
+//   continue: inc;          or    continue: inc;
+//   if (cond) goto begin;         test: if (cond) goto begin;
+//   break:                        break:
+//
+// The condition is copied to the top if it can be. Otherwise the loop is
+// entered at the test. A loop without a condition ends with a jump.
+static void gen_loop(Node *cond, Node *then, Node *inc) {
+  int begin = new_label("begin");
+  int test = 0;
+  int budget = max_copy_nodes;
+  if (cond && can_copy(cond, &budget)) {
+    gen_branch(cond, CC_E, brk_label);
+  } else if (cond) {
+    test = new_label("test");
+    emit_jmp(test);
+  }
+
+  emit_label(begin);
+  gen_stmt(then);
+  emit_label(cont_label);
+  if (inc)
+    gen_stmt(inc);
+  if (test)
+    emit_label(test);
+  if (cond)
+    gen_branch(cond, CC_NE, begin);
+  else
+    emit_jmp(begin);
+  emit_label(brk_label);
+}
+
+static void gen_stmt(Node *node) {
+  switch (node->kind) {
+  case ND_NULL:
+    return;
+  case ND_EXPR_STMT:
+    // Nothing needs the old value of x++ here.
+    if (node->lhs->kind == ND_POST_INC)
+      gen_pre_inc(node->lhs, 1);
+    else if (node->lhs->kind == ND_POST_DEC)
+      gen_pre_inc(node->lhs, 0);
+    else
+      gen_value(node->lhs);
+    return;
+  case ND_IF: {
+    if (node->els) {
+      int els = new_label("else");
+      int end = new_label("end");
+      gen_branch(node->cond, CC_E, els);
+      gen_stmt(node->then);
+      emit_jmp(end);
+      emit_label(els);
+      gen_stmt(node->els);
+      emit_label(end);
+    } else {
+      int end = new_label("end");
+      gen_branch(node->cond, CC_E, end);
+      gen_stmt(node->then);
+      emit_label(end);
+    }
+    return;
+  }
+  case ND_WHILE: {
+    int brk = brk_label;
+    int cont = cont_label;
+    cont_label = new_label("continue");
+    brk_label = new_label("break");
+    gen_loop(node->cond, node->then, 0);
+    brk_label = brk;
+    cont_label = cont;
+    return;
+  }
+  case ND_FOR: {
+    int brk = brk_label;
+    int cont = cont_label;
+    cont_label = new_label("continue");
+    brk_label = new_label("break");
+    if (node->init)
+      gen_stmt(node->init);
+    gen_loop(node->cond, node->then, node->inc);
+    brk_label = brk;
+    cont_label = cont;
+    return;
+  }
+  case ND_DO: {
+    int brk = brk_label;
+    int cont = cont_label;
+    int begin = new_label("begin");
+    cont_label = new_label("continue");
+    brk_label = new_label("break");
+
+    emit_label(begin);
+    gen_stmt(node->then);
+    emit_label(cont_label);
+    gen_branch(node->cond, CC_NE, begin);
+    emit_label(brk_label);
+
+    brk_label = brk;
+    cont_label = cont;
+    return;
+  }
+  case ND_SWITCH: {
+    int brk = brk_label;
+    brk_label = new_label("break");
+    node->case_label = brk_label;
+
+    int reg = gen_value(node->cond);
+
+    int ncases = 0;
+    for (Node *n = node->case_next; n; n = n->case_next) {
+      n->case_label = new_label("case");
+      n->case_end_label = brk_label;
+      ncases++;
+    }
+
+    int dflt = brk_label;
+    if (node->default_case) {
+      node->default_case->case_end_label = brk_label;
+      node->default_case->case_label = new_label("case");
+      dflt = node->default_case->case_label;
+    }
+
+    Node **cases = sort_cases(node->case_next, ncases);
+    gen_dispatch(reg, cases, ncases, dflt);
+    free(cases);
+    gen_stmt(node->then);
+    emit_label(brk_label);
+
+    brk_label = brk;
+    return;
+  }
+  case ND_CASE:
+    emit_label(node->case_label);
+    gen_stmt(node->lhs);
+    return;
+  case ND_BLOCK:
+    for (Node *n = node->body; n; n = n->next)
+      gen_stmt(n);
+    return;
+  case ND_BREAK:
+    if (brk_label == 0)
+      error_tok(node->tok, "stray break");
+    emit_jmp(brk_label);
+    return;
+  case ND_CONTINUE:
+    if (cont_label == 0)
+      error_tok(node->tok, "stray continue");
+    emit_jmp(cont_label);
+    return;
+  case ND_GOTO:
+    emit_jmp(goto_label(node->label_name));
+    return;
+  case ND_LABEL:
+    emit_label(goto_label(node->label_name));
+    gen_stmt(node->lhs);
+    return;
+  case ND_RETURN:
+    if (node->lhs)
+      emit_rr(I_MOV, RAX, gen_value(node->lhs), 8);
+    emit_jmp(1);
+    return;
+  }
+
+  gen_expr(node);
+}
+
+static void emit_line(char *s1, char *s2) {
+  sink_str(out, s1);
+  sink_str(out, s2);
+  sink_char(out, '\n');
+}
+
+static void emit_directive(char *name, long val) {
+  sink_str(out, name);
+  sink_int(out, val);
+  sink_char(out, '\n');
+}
+
+static void emit_data(VarList *globals) {
+  if (obj) {
+    obj_add_globals(obj, globals);
+    return;
+  }
+
+  for (VarList *vl = globals; vl; vl = vl->next)
+    if (!vl->var->is_static)
+      emit_line(".global ", vl->var->name);
+
+  sink_str(out, ".bss\n");
+
+  for (VarList *vl = globals; vl; vl = vl->next) {
+    Var *var = vl->var;
+    if (var->initializer)
+      continue;
+
+    emit_directive(".align ", var->ty->align);
+    emit_line(var->name, ":");
+    emit_directive("  .zero ", var->ty->size);
+  }
+
+  sink_str(out, ".data\n");
+
+  for (VarList *vl = globals; vl; vl = vl->next) {
+    Var *var = vl->var;
+    if (!var->initializer)
+      continue;
+
+    emit_directive(".align ", var->ty->align);
+    emit_line(var->name, ":");
+
+    for (Initializer *init = var->initializer; init; init = init->next) {
+      if (init->label) {
+        sink_str(out, "  .quad ");
+        sink_str(out, init->label);
+        if (init->addend >= 0)
+          sink_char(out, '+');
+        emit_directive("", init->addend);
+      } else if (init->sz == 1) {
+        emit_directive("  .byte ", init->val);
+      } else {
+        sink_str(out, "  .");
+        sink_int(out, init->sz);
+        emit_directive("byte ", init->val);
+      }
+    }
+  }
+}
+
+static void new_code(void) {
+  code = allocate(ALLOC_CODE, sizeof(Code));
+  code->cap = 1024;
+  code->insts = reallocate(ALLOC_CODE, 0, sizeof(Inst) * code->cap);
+  code->labels_cap = 64;
+  code->labels =
+      reallocate(ALLOC_CODE, 0, sizeof(char *) * code->labels_cap);
+}
+
+static int callee_saved[] = {RBX, R12, R13, R14, R15};
+
+// The System V ABI leaves this many bytes below rsp alone, even for signal
+// handlers, so a function that makes no calls can keep its frame there
+// without moving rsp.
+static int red_zone = 128;
+
+_Bool omit_frame_pointer;
+
+static _Bool is_leaf(Code *code) {
+  for (int i = 0; i < code->len; i++)
+    if (code->insts[i].kind == I_CALL)
+      return 0;
+  return 1;
+}
+
+// Makes frame slots relative to rsp, which is below rbp by delta, for a
+// function without a frame pointer.
+static void rebase_frame(int delta) {
+  for (int i = 0; i < code->len; i++) {
+    Operand *ops[2];
+    ops[0] = &code->insts[i].dst;
+    ops[1] = &code->insts[i].src;
+    for (int j = 0; j < 2; j++) {
+      if (ops[j]->kind == OP_MEM && !ops[j]->sym && ops[j]->reg == RBP) {
+        ops[j]->reg = RSP;
+        ops[j]->val += delta;
+      }
+    }
+  }
+}
+
+// Emits the prologue in front of the instructions generated so far. It
+// saves the callee-saved registers regs to their frame slots and lowers
+// rsp by size.
+static void emit_prologue(_Bool use_fp, int size, int *regs, int *slots,
+                          int n) {
+  int len = code->len;
+  if (use_fp) {
+    emit_r(I_PUSH, RBP);
+    emit_rr(I_MOV, RBP, RSP, 8);
+  }
+  if (size)
+    emit_ri(I_SUB, RSP, size);
+  for (int i = 0; i < n; i++) {
+    if (use_fp)
+      emit_mr(I_MOV, RBP, -slots[i], regs[i], 8);
+    else
+      emit_mr(I_MOV, RSP, size - slots[i], regs[i], 8);
+  }
+
+  int k = code->len - len;
+  Inst *tmp = reallocate(ALLOC_CODE, 0, sizeof(Inst) * k);
+  memcpy(tmp, code->insts + len, sizeof(Inst) * k);
+  memmove(code->insts + k, code->insts, sizeof(Inst) * len);
+  memcpy(code->insts, tmp, sizeof(Inst) * k);
+  free(tmp);
+}
+
+// Puts I_ALIGN in front of the labels that jumps further down go back
+// to, which are where loops begin, so that an iteration starts at the
+// beginning of a 16-byte block of the instruction fetch.
+static void align_loops(void) {
+  _Bool *seen = allocate(ALLOC_CODE, sizeof(_Bool) * code->nlabels);
+  _Bool *align = allocate(ALLOC_CODE, sizeof(_Bool) * code->nlabels);
+  int n = 0;
+  for (int i = 0; i < code->len; i++) {
+    Inst *inst = &code->insts[i];
+    if (inst->kind == I_LABEL) {
+      seen[inst->dst.val] = 1;
+    } else if ((inst->kind == I_JMP || inst->kind == I_JCC) &&
+               inst->dst.kind == OP_LABEL && seen[inst->dst.val] &&
+               !align[inst->dst.val]) {
+      align[inst->dst.val] = 1;
+      n++;
+    }
+  }
+
+  if (n) {
+    while (code->cap < code->len + n)
+      code->cap *= 2;
+    code->insts = reallocate(ALLOC_CODE, code->insts, sizeof(Inst) * code->cap);
+
+    // Instructions move up by the number of labels aligned before them.
+    int j = code->len + n;
+    for (int i = code->len - 1; j > i + 1; i--) {
+      Inst *inst = &code->insts[i];
+      memcpy(&code->insts[--j], inst, sizeof(Inst));
+      if (inst->kind != I_LABEL || !align[inst->dst.val])
+        continue;
+      j--;
+      code->insts[j].kind = I_ALIGN;
+      code->insts[j].dst.kind = OP_NONE;
+      code->insts[j].src.kind = OP_NONE;
+    }
+    code->len += n;
+  }
+  free(seen);
+  free(align);
+}
+
+static void gen_function(Function *fn) {
+  funcname = fn->name;
+
+  // Instructions are buffered per function, reusing the same arrays.
+  // Label 0 means "none", and label 1 is where return statements jump to.
+  code->len = 0;
+  code->nlabels = 1;
+  code->nregs = VREG;
+  code->args = 0;
+  for (VarList *vl = fn->locals; vl; vl = vl->next)
+    if (vl->var->in_reg)
+      vl->var->reg = new_reg();
+  code->nvars = code->nregs - VREG;
+  char *ret = malloc(strlen(funcname) + 20);
+  sprintf(ret, ".L.return.%s", funcname);
+  add_label(ret);
+
+  if (fn->has_varargs) {
+    int n = 0;
+    for (VarList *vl = fn->params; vl; vl = vl->next)
+      n++;
+
+    emit_mi(I_MOV, RBP, -8, n * 8, 4);
+    emit_mr(I_MOV, RBP, -16, R9, 8);
+    emit_mr(I_MOV, RBP, -24, R8, 8);
+    emit_mr(I_MOV, RBP, -32, RCX, 8);
+    emit_mr(I_MOV, RBP, -40, RDX, 8);
+    emit_mr(I_MOV, RBP, -48, RSI, 8);
+    emit_mr(I_MOV, RBP, -56, RDI, 8);
+  }
+
+  int i = 0;
+  for (VarList *vl = fn->params; vl; vl = vl->next) {
+    Var *var = vl->var;
+    int reg = argreg[i++];
+    code->args |= 1 << reg;
+    if (!var->in_reg) {
+      emit_mr(I_MOV, RBP, -var->offset, reg, var->ty->size);
+      continue;
+    }
+    emit_rr(I_MOV, var->reg, reg, 8);
+    if (var->ty->size < 8)
+      emit_ext(I_MOVSX, var->reg, var->reg, var->ty->size);
+  }
+
+  for (Node *node = fn->node; node; node = node->next)
+    gen_stmt(node);
+
+  // The frame holds the local variables, then spilled values, then the
+  // callee-saved registers that the function uses.
+  _Bool used[VREG];
+  memset(used, 0, sizeof(used));
+  run_passes(code, fn->name);
+  int frame_size = alloc_regs(code, fn->stack_size, used);
+
+  int regs[5];
+  int slots[5];
+  int n = 0;
+  for (int i = 0; i < 5; i++) {
+    if (used[callee_saved[i]]) {
+      frame_size += 8;
+      regs[n] = callee_saved[i];
+      slots[n++] = frame_size;
+    }
+  }
+
+  emit_label(1);
+  for (int i = 0; i < n; i++)
+    emit_rm(I_MOV, regs[i], 8, RBP, -slots[i], 8);
+
+  // A leaf function keeps a small frame in the red zone, and one without
+  // a frame needs no prologue at all. Otherwise rsp is lowered so that it
+  // is 16-byte aligned at calls. Variadic functions find their arguments
+  // through rbp, so they always have a frame pointer.
+  _Bool leaf = is_leaf(code);
+  _Bool use_fp = !omit_frame_pointer || fn->has_varargs;
+  if (leaf && frame_size == 0 && !fn->has_varargs)
+    use_fp = 0;
+
+  int size = 0;
+  if (!leaf || frame_size > red_zone) {
+    if (use_fp)
+      size = align_to(frame_size, 16);
+    else
+      size = align_to(frame_size + 8, 16) - 8;
+  }
+
+  if (!use_fp) {
+    rebase_frame(size);
+    if (size)
+      emit_ri(I_ADD, RSP, size);
+  } else {
+    if (size)
+      emit_rr(I_MOV, RSP, RBP, 8);
+    emit_r(I_POP, RBP);
+  }
+  emit(I_RET);
+  emit_prologue(use_fp, size, regs, slots, n);
+  align_loops();
+
+  for (int i = 0; i < code->len; i++)
+    if (code->insts[i].kind != I_LABEL && code->insts[i].kind != I_ALIGN)
+      num_insns++;
+}
+
+static void emit_function(Function *fn) {
+  if (fn->globals)
+    emit_data(fn->globals);
+  gen_function(fn);
+
+  if (obj) {
+    align_text(obj);
+    Symbol *sym = obj_symbol(obj, fn->name, SEC_TEXT, !fn->is_static);
+    encode_code(obj, code);
+    sym->size = obj->text->len - sym->offset;
+    return;
+  }
+
+  sink_str(out, ".text\n.p2align 4\n");
+  if (!fn->is_static)
+    emit_line(".global ", fn->name);
+  emit_line(fn->name, ":");
+  print_code(out, code);
+}
+
+
+// Each function is emitted as a self-contained chunk of assembly together
+// with its own data, so that chunks can be cached and spliced in by later
+// compilations.
+static void emit_text_fn(Function *fn) {
+  if (fn->cached_asm) {
+    sink_str(out, fn->cached_asm);
+    return;
+  }
+
+  if (!fn->cache_key) {
+    long start = time_report ? now_ns() : 0;
+    long insns = num_insns;
+    emit_function(fn);
+    if (time_report) {
+      fn->gen_ns = now_ns() - start;
+      fn->num_insns = num_insns - insns;
+    }
+    return;
+  }
+
+  Sink *file = out;
+  out = new_mem_sink();
+  emit_function(fn);
+  sink_write(file, out->buf, out->len);
+  cache_store(fn->cache_key, out->buf, out->len);
+  free(out->buf);
+  free(out);
+  out = file;
+}
+
+// With more than one job, functions are generated by worker processes.
+// They are handed out in chunks of chunk_size functions in turn, and each
+// worker sends back one record per function:
+//
+//   gen_ns, num_insns, len, len bytes of assembly or machine code
+//   nrelocs, and per relocation: offset, type, addend, NUL-terminated symbol
+//
+// where relocations are only present for machine code. Labels are already
+// unique per function, so the parent can splice the records together in
+// source order and the output is the same as from a single job.
+int codegen_jobs = 1;
+static int chunk_size = 16;
+
+// A worker inherits the output buffered so far and must leave it alone.
+static void run_worker(Function **fns, int nfns, int worker, int fd) {
+  Sink *msg = new_mem_sink();
+  if (obj)
+    obj = new_object();
+
+  for (int i = worker * chunk_size; i < nfns;
+       i += codegen_jobs * chunk_size) {
+    for (int j = i; j < nfns && j < i + chunk_size; j++) {
+      Function *fn = fns[j];
+      if (fn->cached_asm)
+        continue;
+
+      long start = time_report ? now_ns() : 0;
+      long insns = num_insns;
+
+      Sink *text = obj ? obj->text : new_mem_sink();
+      long text_start = text->len;
+      long reloc_start = obj ? obj->nrelocs : 0;
+
+      if (obj) {
+        gen_function(fn);
+        encode_code(obj, code);
+      } else {
+        out = text;
+        emit_function(fn);
+        if (fn->cache_key)
+          cache_store(fn->cache_key, text->buf, text->len);
+      }
+
+      sink_le(msg, time_report ? now_ns() - start : 0, 8);
+      sink_le(msg, num_insns - insns, 8);
+      sink_le(msg, text->len - text_start, 8);
+      sink_write(msg, text->buf + text_start, text->len - text_start);
+      if (!obj)
+        continue;
+
+      sink_le(msg, obj->nrelocs - reloc_start, 8);
+      for (int k = reloc_start; k < obj->nrelocs; k++) {
+        Reloc *rel = &obj->relocs[k];
+        sink_le(msg, rel->offset - text_start, 8);
+        sink_le(msg, rel->type, 8);
+        sink_le(msg, rel->addend, 8);
+        sink_write(msg, rel->sym, strlen(rel->sym) + 1);
+      }
+    }
+  }
+  finish_worker(msg, fd);
+}
+
+typedef struct {
+  int pid;
+  int fd;
+  char *buf;
+  long pos;
+} Worker;
+
+static long take_long(Worker *w) {
+  long val = *(long *)(w->buf + w->pos);
+  w->pos += 8;
+  return val;
+}
+
+static void splice_function(Function *fn, Worker *w) {
+  if (!w->buf) {
+    long len;
+    w->buf = wait_worker(w->pid, w->fd, &len);
+  }
+
+  long gen_ns = take_long(w);
+  long insns = take_long(w);
+  long len = take_long(w);
+  char *buf = w->buf + w->pos;
+  w->pos += len;
+
+  num_insns += insns;
+  if (time_report) {
+    fn->gen_ns = gen_ns;
+    fn->num_insns = insns;
+  }
+
+  if (!obj) {
+    sink_write(out, buf, len);
+    return;
+  }
+
+  if (fn->globals)
+    emit_data(fn->globals);
+  align_text(obj);
+  Symbol *sym = obj_symbol(obj, fn->name, SEC_TEXT, !fn->is_static);
+  sink_write(obj->text, buf, len);
+  sym->size = len;
+
+  long nrelocs = take_long(w);
+  for (int i = 0; i < nrelocs; i++) {
+    long offset = take_long(w);
+    long type = take_long(w);
+    long addend = take_long(w);
+    char *name = w->buf + w->pos;
+    w->pos += strlen(name) + 1;
+    obj_reloc(obj, SEC_TEXT, sym->offset + offset, type, name, addend);
+  }
+}
+
+static void emit_text(Program *prog) {
+  int nfns = 0;
+  for (Function *fn = prog->fns; fn; fn = fn->next)
+    nfns++;
+
+  if (codegen_jobs <= 1 || nfns <= chunk_size) {
+    for (Function *fn = prog->fns; fn; fn = fn->next)
+      emit_text_fn(fn);
+    return;
+  }
+
+  Function **fns = malloc(sizeof(Function *) * nfns);
+  int i = 0;
+  for (Function *fn = prog->fns; fn; fn = fn->next)
+    fns[i++] = fn;
+
+  int nchunks = (nfns + chunk_size - 1) / chunk_size;
+  if (codegen_jobs > nchunks)
+    codegen_jobs = nchunks;
+
+  Worker *workers = calloc(codegen_jobs, sizeof(Worker));
+  for (int i = 0; i < codegen_jobs; i++) {
+    Worker *w = &workers[i];
+    w->pid = start_worker(&w->fd);
+    if (w->pid == 0)
+      run_worker(fns, nfns, i, w->fd);
+  }
+
+  for (int i = 0; i < nfns; i++) {
+    int chunk = i / chunk_size;
+    Worker *w = &workers[chunk - chunk / codegen_jobs * codegen_jobs];
+    if (fns[i]->cached_asm)
+      sink_str(out, fns[i]->cached_asm);
+    else
+      splice_function(fns[i], w);
+  }
+}
+
+void codegen(Program *prog, Sink *sink) {
+  out = sink;
+  new_code();
+  sink_str(out, ".intel_syntax noprefix\n");
+
+  enter_phase(PHASE_EMIT_DATA);
+  emit_data(prog->globals);
+
+  enter_phase(PHASE_EMIT_TEXT);
+  emit_text(prog);
+}
+
+// Encodes the program into machine code. The codegen cache holds assembly,
+// so it must not be enabled.
+Object *codegen_object(Program *prog) {
+  obj = new_object();
+  new_code();
+
+  enter_phase(PHASE_EMIT_DATA);
+  emit_data(prog->globals);
+
+  enter_phase(PHASE_EMIT_TEXT);
+  emit_text(prog);
+  return obj;
+}
@@ -0,0 +1,991 @@
+typedef struct FILE FILE;
+typedef long size_t;
+struct timespec {
+  long tv_sec;
+  long tv_nsec;
+};
+struct rusage {
+  long ru_utime[2];
+  long ru_stime[2];
+  long ru_maxrss;
+  long ru_rest[13];
+};
+extern FILE *stdout;
+extern FILE *stderr;
+
+void *malloc(long size);
+void *calloc(long nmemb, long size);
+int *__errno_location();
+char *strerror(int errnum);
+FILE *fopen(char *pathname, char *mode);
+long fread(void *ptr, long size, long nmemb, FILE *stream);
+int feof(FILE *stream);
+static void assert() {}
+int strcmp(char *s1, char *s2);
+int printf(char *fmt, ...);
+int sprintf(char *buf, char *fmt, ...);
+long strlen(char *p);
+int strncmp(char *p, char *q);
+void *memcpy(char *dst, char *src, long n);
+char *strndup(char *p, long n);
+int isspace(int c);
+char *strstr(char *haystack, char *needle);
+long strtol(char *nptr, char **endptr, int base);
+int memcmp(char *s1, char *s2, long n);
+int fprintf(FILE *fp, char *fmt, ...);
+int fputs(char *s, FILE *fp);
+long fwrite(void *ptr, long size, long nmemb, FILE *stream);
+int fclose(FILE *fp);
+int fseek(FILE *fp, long offset, int whence);
+long ftell(FILE *fp);
+FILE *open_memstream(char **ptr, size_t *sizeloc);
+int rename(char *oldpath, char *newpath);
+int mkdir(char *pathname, int mode);
+int getpid(void);
+int clock_gettime(int clockid, struct timespec *tp);
+int getrusage(int who, struct rusage *usage);
+void *realloc(void *ptr, long size);
+void free(void *ptr);
+void *memset(void *s, int c, long n);
+int open(char *pathname, int flags, ...);
+int close(int fd);
+long write(int fd, void *buf, long count);
+int ftruncate(int fd, long length);
+void *mmap(void *addr, long length, int prot, int flags, int fd, long offset);
+int munmap(void *addr, long length);
+void *mremap(void *old_address, long old_size, long new_size, int flags);
+int mprotect(void *addr, long len, int prot);
+void *dlopen(char *filename, int flags);
+void *dlsym(void *handle, char *symbol);
+char *dlerror(void);
+char *strchr(char *s, int c);
+void *bsearch(void *key, void *base, long nmemb, long size, void *compar);
+extern char **environ;
+int pipe(int *pipefd);
+int fork(void);
+int waitpid(int pid, int *wstatus, int options);
+long read(int fd, void *buf, long count);
+void _exit(int status);
+void exit(int status);
+void *memmove(void *dest, void *src, long n);
+
+typedef struct {
+  int gp_offset;
+  int fp_offset;
+  void *overflow_arg_area;
+  void *reg_save_area;
+} __va_elem;
+
+typedef __va_elem va_list[1];
+
+static void va_end(__va_elem *ap) {}
+
+typedef struct Type Type;
+typedef struct Member Member;
+typedef struct Initializer Initializer;
+typedef struct Program Program;
+
+// main.c
+
+typedef enum {
+  PHASE_READ,
+  PHASE_TOKENIZE,
+  PHASE_PARSE,
+  PHASE_LAYOUT,
+  PHASE_EMIT_DATA,
+  PHASE_EMIT_TEXT,
+  PHASE_DONE,
+} Phase;
+
+extern char *phase_names[];
+extern Phase current_phase;
+extern _Bool time_report;
+
+long now_ns(void);
+void enter_phase(Phase phase);
+
+// alloc.c
+
+typedef enum {
+  ALLOC_TOKEN,
+  ALLOC_NODE,
+  ALLOC_TYPE,
+  ALLOC_MEMBER,
+  ALLOC_VAR,
+  ALLOC_SCOPE,
+  ALLOC_INITIALIZER,
+  ALLOC_FUNCTION,
+  ALLOC_CODE, // Instructions and the arrays of the back end
+  ALLOC_OTHER,
+  ALLOC_NKINDS,
+} AllocKind;
+
+extern _Bool mem_report;
+
+void *allocate(AllocKind kind, long size);
+void *reallocate(AllocKind kind, void *p, long size);
+void print_mem_report(Program *prog);
+
+// tokenize.c
+
+typedef enum {
+  TK_RESERVED,
+  TK_IDENT,
+  TK_STR,
+  TK_NUM,
+  TK_EOF,
+} TokenKind;
+
+typedef struct Token Token;
+struct Token {
+  TokenKind kind;
+  Token *next;
+  long val;
+  Type *ty;
+  char *str;
+  int len;
+
+  char *contents;
+  int cont_len;
+};
+
+void error(char *fmt, ...);
+void error_at(char *loc, char *fmt, ...);
+void error_tok(Token *tok, char *fmt, ...);
+void warn_tok(Token *tok, char *fmt, ...);
+Token *peek(char *s);
+Token *consume(char *op);
+Token *consume_ident(void);
+void expect(char *op);
+char *expect_ident(void);
+_Bool at_eof(void);
+Token *tokenize(void);
+
+extern char *filename;
+extern char *user_input;
+extern Token *token;
+
+// parse.c
+
+typedef struct Var Var;
+struct Var {
+  char *name;
+  Type *ty;
+  _Bool is_local;
+
+  int offset;
+
+  _Bool is_static;
+  Initializer *initializer;
+
+  // Set by promote_vars(). A local variable in a register has no stack
+  // slot and is held by virtual register reg instead.
+  int uses;
+  _Bool addr_taken;
+  _Bool in_reg;
+  int reg;
+};
+
+typedef struct VarList VarList;
+struct VarList {
+  VarList *next;
+  Var *var;
+};
+
+typedef enum {
+  ND_ADD,
+  ND_PTR_ADD,
+  ND_SUB,
+  ND_PTR_SUB,
+  ND_PTR_DIFF,
+  ND_MUL,
+  ND_DIV,
+  ND_BITAND,
+  ND_BITOR,
+  ND_BITXOR,
+  ND_SHL,
+  ND_SHR,
+  ND_EQ,
+  ND_NE,
+  ND_LT,
+  ND_LE,
+  ND_ASSIGN,
+  ND_TERNARY,
+  ND_PRE_INC,
+  ND_PRE_DEC,
+  ND_POST_INC,
+  ND_POST_DEC,
+  ND_ADD_EQ,
+  ND_PTR_ADD_EQ,
+  ND_SUB_EQ,
+  ND_PTR_SUB_EQ,
+  ND_MUL_EQ,
+  ND_DIV_EQ,
+  ND_SHL_EQ,
+  ND_SHR_EQ,
+  ND_BITAND_EQ,
+  ND_BITOR_EQ,
+  ND_BITXOR_EQ,
+  ND_COMMA,
+  ND_MEMBER,
+  ND_ADDR,
+  ND_DEREF,
+  ND_NOT,
+  ND_BITNOT,
+  ND_LOGAND,
+  ND_LOGOR,
+  ND_RETURN,
+  ND_IF,
+  ND_WHILE,
+  ND_FOR,
+  ND_DO,
+  ND_SWITCH,
+  ND_CASE,
+  ND_BLOCK,
+  ND_BREAK,
+  ND_CONTINUE,
+  ND_GOTO,
+  ND_LABEL,
+  ND_FUNCALL,
+  ND_EXPR_STMT,
+  ND_STMT_EXPR,
+  ND_VAR,
+  ND_NUM,
+  ND_CAST,
+  ND_NULL,
+} NodeKind;
+
+typedef struct Node Node;
+struct Node {
+  NodeKind kind;
+  Node *next;
+  Type *ty;
+  Token *tok;
+
+  Node *lhs;
+  Node *rhs;
+
+  Node *cond;
+  Node *then;
+  Node *els;
+  Node *init;
+  Node *inc;
+
+  Node *body;
+
+  Member *member;
+
+  char *funcname;
+  Node *args;
+
+  char *label_name;
+
+  Node *case_next;
+  Node *default_case;
+  int case_label;
+  int case_end_label;
+
+  Var *var;
+
+  long val;
+};
+
+struct Initializer {
+  Initializer *next;
+
+  int sz;
+  long val;
+
+  char *label;
+  long addend;
+};
+
+typedef struct Function Function;
+struct Function {
+  Function *next;
+  char *name;
+  VarList *params;
+  _Bool is_static;
+  _Bool has_varargs;
+
+  Node *node;
+  VarList *locals;
+  VarList *globals;
+  int stack_size;
+  int nlabels;
+
+  char *cache_key;
+  char *cached_asm;
+
+  // -ftime-report
+  long parse_ns;
+  long gen_ns;
+  long num_nodes;
+  long num_insns;
+};
+
+struct Program {
+  VarList *globals;
+  Function *fns;
+};
+
+extern long num_nodes;
+
+Program *program(void);
+
+// typing.c
+
+typedef enum {
+  TY_VOID,
+  TY_BOOL,
+  TY_CHAR,
+  TY_SHORT,
+  TY_INT,
+  TY_LONG,
+  TY_ENUM,
+  TY_PTR,
+  TY_ARRAY,
+  TY_STRUCT,
+  TY_FUNC,
+} TypeKind;
+
+struct Type {
+  TypeKind kind;
+  int size;
+  int align;
+  _Bool is_incomplete;
+
+  Type *base;
+  int array_len;
+  Member *members;
+  Type *return_ty;
+};
+
+struct  Member {
+  Member *next;
+  Type *ty;
+  Token *tok;
+  char *name;
+  int offset;
+};
+
+extern Type *void_type;
+extern Type *bool_type;
+extern Type *char_type;
+extern Type *short_type;
+extern Type *int_type;
+extern Type *long_type;
+
+_Bool is_integer(Type *ty);
+int align_to(int n, int align);
+Type *pointer_to(Type *base);
+Type *array_of(Type *base, int size);
+Type *func_type(Type *return_ty);
+Type *enum_type(void);
+Type *struct_type(void);
+void add_type(Node *node);
+
+// sink.c
+
+// An output sink collects bytes in a large buffer. It hands them to a file
+// descriptor whenever the buffer fills up, keeps them all in memory if it
+// has no file descriptor, or writes them into an mmap'd file.
+typedef struct {
+  char *buf;
+  long len;
+  long cap;
+  int fd;
+  _Bool mapped;
+} Sink;
+
+Sink *new_fd_sink(int fd);
+Sink *new_mem_sink(void);
+Sink *new_file_sink(char *path);
+void sink_reserve(Sink *s, long n);
+void sink_write(Sink *s, char *p, long len);
+void sink_str(Sink *s, char *str);
+void sink_char(Sink *s, int c);
+void sink_int(Sink *s, long val);
+char *write_int(char *p, long val);
+void sink_le(Sink *s, long val, int size);
+void sink_align(Sink *s, int align);
+void sink_close(Sink *s);
+
+// asm.c
+
+// Registers are numbered as in the instruction encoding.
+typedef enum {
+  RAX,
+  RCX,
+  RDX,
+  RBX,
+  RSP,
+  RBP,
+  RSI,
+  RDI,
+  R8,
+  R9,
+  R10,
+  R11,
+  R12,
+  R13,
+  R14,
+  R15,
+
+  // Registers from here on are virtual. Code generation uses as many as
+  // it likes and the register allocator maps them to the ones above.
+  VREG,
+} Reg;
+
+// Condition codes are numbered as in the encoding of jcc and setcc.
+typedef enum {
+  CC_E = 4,
+  CC_NE = 5,
+  CC_A = 7,
+  CC_L = 12,
+  CC_GE = 13,
+  CC_LE = 14,
+  CC_G = 15,
+} CondCode;
+
+typedef enum {
+  OP_NONE,
+  OP_REG,   // reg
+  OP_IMM,   // val
+  OP_MEM,   // [reg+index*scale+val], or [rip+sym+val] if sym is set.
+            // There is no index if scale is 0.
+  OP_LABEL, // Local label number val, or [rip+label] for lea
+  OP_SYM,   // Symbol sym
+} OperandKind;
+
+typedef struct {
+  OperandKind kind;
+  int size;
+  int reg;
+  int index;
+  int scale;
+  long val;
+  char *sym;
+} Operand;
+
+typedef enum {
+  I_LABEL,
+  I_MOV,
+  I_MOVSX,
+  I_MOVZX,
+  I_LEA,
+  I_PUSH,
+  I_POP,
+  I_ADD,
+  I_SUB,
+  I_IMUL,
+  I_CQO,
+  I_IDIV,
+  I_IMULH, // rdx:rax = rax * dst
+  I_AND,
+  I_OR,
+  I_XOR,
+  I_SHL,
+  I_SAR,
+  I_NOT,
+  I_CMP,
+  I_SETCC,
+  I_JMP,
+  I_JCC,
+  I_CALL,
+  I_RET,
+  I_ENTRY, // Jump table entry: the offset of label dst from label src
+  I_ALIGN, // Padding to the next 16 bytes, unless that is more than 10
+} InstKind;
+
+typedef struct {
+  InstKind kind;
+  CondCode cc;
+  Operand dst;
+  Operand src;
+} Inst;
+
+// The instructions of one function. Local labels are referred to by
+// number and named only when printed.
+typedef struct {
+  Inst *insts;
+  int len;
+  int cap;
+  char **labels;
+  int nlabels;
+  int labels_cap;
+  int nregs;
+  int nvars; // Virtual registers from VREG on that hold variables
+  int args;  // Bitmap of the registers holding arguments on entry
+} Code;
+
+void print_insts(Sink *out, Code *code, int start, int end);
+void print_code(Sink *out, Code *code);
+
+// cfg.c
+
+// A basic block is the run of instructions from start to end.
+typedef struct {
+  int start;
+  int end;
+  int *succs;
+  int nsuccs;
+  int *preds;
+  int npreds;
+} Block;
+
+typedef struct {
+  Block *blocks;
+  int nblocks;
+  int *label_block; // The block each label starts, or -1
+} CFG;
+
+CFG *build_cfg(Code *code);
+void free_cfg(CFG *cfg);
+_Bool is_table(CFG *cfg, Code *code, int b);
+
+// opt.c
+
+extern int opt_level;
+extern _Bool dump_code;
+
+void run_passes(Code *code, char *funcname);
+
+// jump.c
+
+void optimize_jumps(Code *code);
+
+// peephole.c
+
+void peephole(Code *code);
+
+// licm.c
+
+void hoist_invariants(Code *code);
+
+// regalloc.c
+
+int alloc_regs(Code *code, int frame_size, _Bool *used);
+
+// elf.c
+
+typedef enum {
+  SEC_UNDEF,
+  SEC_TEXT,
+  SEC_DATA,
+  SEC_BSS,
+} SectionKind;
+
+typedef enum {
+  R_X86_64_64 = 1,
+  R_X86_64_PC32 = 2,
+  R_X86_64_PLT32 = 4,
+} RelocType;
+
+typedef struct {
+  char *name;
+  SectionKind sec;
+  long offset;
+  long size;
+  _Bool is_global;
+  int index;
+} Symbol;
+
+typedef struct {
+  SectionKind sec;
+  long offset;
+  RelocType type;
+  char *sym;
+  long addend;
+} Reloc;
+
+// Machine code and data of a translation unit, with symbols and
+// relocations referring to symbols by name.
+typedef struct {
+  Sink *text;
+  Sink *data;
+  long bss_size;
+  int data_align;
+  int bss_align;
+
+  Symbol **syms;
+  int nsyms;
+  int syms_cap;
+  Symbol **map;
+  int map_cap;
+
+  Reloc *relocs;
+  int nrelocs;
+  int relocs_cap;
+} Object;
+
+Object *new_object(void);
+Symbol *find_symbol(Object *obj, char *name);
+Symbol *obj_symbol(Object *obj, char *name, SectionKind sec, _Bool is_global);
+void obj_reloc(Object *obj, SectionKind sec, long offset, RelocType type,
+               char *sym, long addend);
+void obj_add_globals(Object *obj, VarList *globals);
+void write_object(Object *obj, Sink *out);
+
+// promote.c
+
+void promote_vars(Function *fn);
+
+// inline.c
+
+extern _Bool no_inline;
+
+_Bool may_inline(Token *begin, Token *end);
+Function *find_inline(char *name);
+void inline_function(Function *fn, Token *begin, Token *end);
+
+// encode.c
+
+void encode_code(Object *obj, Code *code);
+void align_text(Object *obj);
+
+// jit.c
+
+void jit_add_library(char *name);
+void run_object(Object *obj, int argc, char **argv);
+
+// worker.c
+
+int start_worker(int *fd);
+void finish_worker(Sink *s, int fd);
+char *wait_worker(int pid, int fd, long *len);
+
+// codegen.c
+
+extern long num_insns;
+extern int codegen_jobs;
+extern _Bool omit_frame_pointer;
+
+void codegen(Program *prog, Sink *out);
+Object *codegen_object(Program *prog);
+
+// cache.c
+
+extern char *cache_dir;
+
+char *cache_load(char *key);
+void cache_store(char *key, char *buf, long len);
+
+// Section header indices of the object file.
+typedef enum {
+  SHN_TEXT = 1,
+  SHN_DATA,
+  SHN_BSS,
+  SHN_RELA_TEXT,
+  SHN_RELA_DATA,
+  SHN_SYMTAB,
+  SHN_STRTAB,
+  SHN_NOTE,
+  SHN_SHSTRTAB,
+  SHN_NUM,
+} SectionIndex;
+
+static char *section_names[] = {
+    "",           ".text",   ".data",           ".bss",     ".rela.text",
+    ".rela.data", ".symtab", ".strtab", ".note.GNU-stack", ".shstrtab",
+};
+
+Object *new_object(void) {
+  Object *obj = calloc(1, sizeof(Object));
+  obj->text = new_mem_sink();
+  obj->data = new_mem_sink();
+  obj->data_align = 1;
+  obj->bss_align = 1;
+  obj->map_cap = 1024;
+  obj->map = calloc(obj->map_cap, sizeof(Symbol *));
+  return obj;
+}
+
+static long hash_name(char *name) {
+  long hash = 2166136261;
+  for (char *p = name; *p; p++)
+    hash = ((hash ^ (*p & 255)) * 16777619) & 0xffffffff;
+  return hash;
+}
+
+// Returns the slot of the symbol table's hash map in which name is stored
+// or would be stored.
+static long find_slot(Object *obj, char *name) {
+  long i = hash_name(name) & (obj->map_cap - 1);
+  while (obj->map[i] && strcmp(obj->map[i]->name, name))
+    i = (i + 1) & (obj->map_cap - 1);
+  return i;
+}
+
+Symbol *find_symbol(Object *obj, char *name) {
+  return obj->map[find_slot(obj, name)];
+}
+
+static Symbol *add_symbol(Object *obj, char *name) {
+  if (obj->nsyms * 2 >= obj->map_cap) {
+    obj->map_cap *= 2;
+    obj->map = calloc(obj->map_cap, sizeof(Symbol *));
+    for (int i = 0; i < obj->nsyms; i++)
+      obj->map[find_slot(obj, obj->syms[i]->name)] = obj->syms[i];
+  }
+
+  if (obj->nsyms == obj->syms_cap) {
+    obj->syms_cap = obj->syms_cap ? obj->syms_cap * 2 : 256;
+    obj->syms = realloc(obj->syms, sizeof(Symbol *) * obj->syms_cap);
+  }
+
+  Symbol *sym = calloc(1, sizeof(Symbol));
+  sym->name = name;
+  obj->syms[obj->nsyms++] = sym;
+  obj->map[find_slot(obj, name)] = sym;
+  return sym;
+}
+
+static long section_size(Object *obj, SectionKind sec) {
+  if (sec == SEC_TEXT)
+    return obj->text->len;
+  if (sec == SEC_DATA)
+    return obj->data->len;
+  return obj->bss_size;
+}
+
+// Defines a symbol at the current end of a section.
+Symbol *obj_symbol(Object *obj, char *name, SectionKind sec, _Bool is_global) {
+  Symbol *sym = find_symbol(obj, name);
+  if (!sym)
+    sym = add_symbol(obj, name);
+  else if (sym->sec != SEC_UNDEF)
+    error("%s: symbol defined twice", name);
+
+  sym->sec = sec;
+  sym->offset = section_size(obj, sec);
+  sym->is_global = is_global;
+  return sym;
+}
+
+void obj_reloc(Object *obj, SectionKind sec, long offset, RelocType type,
+               char *sym, long addend) {
+  if (obj->nrelocs == obj->relocs_cap) {
+    obj->relocs_cap = obj->relocs_cap ? obj->relocs_cap * 2 : 256;
+    obj->relocs = realloc(obj->relocs, sizeof(Reloc) * obj->relocs_cap);
+  }
+  Reloc *rel = &obj->relocs[obj->nrelocs++];
+  rel->sec = sec;
+  rel->offset = offset;
+  rel->type = type;
+  rel->sym = sym;
+  rel->addend = addend;
+}
+
+void obj_add_globals(Object *obj, VarList *globals) {
+  for (VarList *vl = globals; vl; vl = vl->next) {
+    Var *var = vl->var;
+    int align = var->ty->align;
+
+    if (!var->initializer) {
+      if (obj->bss_align < align)
+        obj->bss_align = align;
+      obj->bss_size = align_to(obj->bss_size, align);
+      Symbol *sym = obj_symbol(obj, var->name, SEC_BSS, !var->is_static);
+      sym->size = var->ty->size;
+      obj->bss_size += var->ty->size;
+      continue;
+    }
+
+    if (obj->data_align < align)
+      obj->data_align = align;
+    sink_align(obj->data, align);
+    Symbol *sym = obj_symbol(obj, var->name, SEC_DATA, !var->is_static);
+    sym->size = var->ty->size;
+
+    for (Initializer *init = var->initializer; init; init = init->next) {
+      if (init->label) {
+        obj_reloc(obj, SEC_DATA, obj->data->len, R_X86_64_64, init->label,
+                  init->addend);
+        sink_le(obj->data, 0, 8);
+      } else {
+        sink_le(obj->data, init->val, init->sz);
+      }
+    }
+  }
+}
+
+// Symbols that are referred to but not defined are undefined globals.
+static void add_undefined_symbols(Object *obj) {
+  for (int i = 0; i < obj->nrelocs; i++) {
+    char *name = obj->relocs[i].sym;
+    if (!find_symbol(obj, name))
+      add_symbol(obj, name)->is_global = 1;
+  }
+}
+
+static int section_index(SectionKind sec) {
+  if (sec == SEC_TEXT)
+    return SHN_TEXT;
+  if (sec == SEC_DATA)
+    return SHN_DATA;
+  if (sec == SEC_BSS)
+    return SHN_BSS;
+  return 0;
+}
+
+// Writes an Elf64_Sym. Local symbols must precede global ones.
+static void write_symbols(Object *obj, Sink *symtab, Sink *strtab,
+                          _Bool global) {
+  for (int i = 0; i < obj->nsyms; i++) {
+    Symbol *sym = obj->syms[i];
+    if (sym->is_global != global)
+      continue;
+
+    int type = 0;
+    if (sym->sec == SEC_TEXT)
+      type = 2;
+    else if (sym->sec != SEC_UNDEF)
+      type = 1;
+
+    sym->index = symtab->len / 24;
+    sink_le(symtab, strtab->len, 4);
+    sink_le(symtab, (global ? 1 : 0) << 4 | type, 1);
+    sink_le(symtab, 0, 1);
+    sink_le(symtab, section_index(sym->sec), 2);
+    sink_le(symtab, sym->offset, 8);
+    sink_le(symtab, sym->size, 8);
+    sink_write(strtab, sym->name, strlen(sym->name) + 1);
+  }
+}
+
+// Writes the Elf64_Rela entries of a section.
+static void write_relocs(Object *obj, Sink *rela, SectionKind sec) {
+  for (int i = 0; i < obj->nrelocs; i++) {
+    Reloc *rel = &obj->relocs[i];
+    if (rel->sec != sec)
+      continue;
+    sink_le(rela, rel->offset, 8);
+    sink_le(rela, rel->type, 4);
+    sink_le(rela, find_symbol(obj, rel->sym)->index, 4);
+    sink_le(rela, rel->addend, 8);
+  }
+}
+
+static void write_section_header(Sink *out, int name, int type, int flags,
+                                 long offset, long size) {
+  sink_le(out, name, 4);
+  sink_le(out, type, 4);
+  sink_le(out, flags, 8);
+  sink_le(out, 0, 8);
+  sink_le(out, offset, 8);
+  sink_le(out, size, 8);
+}
+
+static void write_section_tail(Sink *out, int link, int info, int align,
+                               int entsize) {
+  sink_le(out, link, 4);
+  sink_le(out, info, 4);
+  sink_le(out, align, 8);
+  sink_le(out, entsize, 8);
+}
+
+// Writes a relocatable ELF64 object file. Its contents come first, each
+// aligned to 8 bytes, and the section headers last.
+void write_object(Object *obj, Sink *out) {
+  add_undefined_symbols(obj);
+
+  Sink *symtab = new_mem_sink();
+  Sink *strtab = new_mem_sink();
+  sink_le(symtab, 0, 24);
+  sink_char(strtab, 0);
+  write_symbols(obj, symtab, strtab, 0);
+  int first_global = symtab->len / 24;
+  write_symbols(obj, symtab, strtab, 1);
+
+  Sink *rela_text = new_mem_sink();
+  Sink *rela_data = new_mem_sink();
+  write_relocs(obj, rela_text, SEC_TEXT);
+  write_relocs(obj, rela_data, SEC_DATA);
+
+  Sink *shstrtab = new_mem_sink();
+  int name[SHN_NUM];
+  for (int i = 0; i < SHN_NUM; i++) {
+    name[i] = shstrtab->len;
+    sink_write(shstrtab, section_names[i], strlen(section_names[i]) + 1);
+  }
+
+  Sink *contents[SHN_NUM];
+  contents[0] = 0;
+  contents[SHN_TEXT] = obj->text;
+  contents[SHN_DATA] = obj->data;
+  contents[SHN_BSS] = 0;
+  contents[SHN_RELA_TEXT] = rela_text;
+  contents[SHN_RELA_DATA] = rela_data;
+  contents[SHN_SYMTAB] = symtab;
+  contents[SHN_STRTAB] = strtab;
+  contents[SHN_NOTE] = 0;
+  contents[SHN_SHSTRTAB] = shstrtab;
+
+  long offset[SHN_NUM];
+  long off = 64;
+  for (int i = 0; i < SHN_NUM; i++) {
+    off = align_to(off, 8);
+    offset[i] = off;
+    if (contents[i])
+      off += contents[i]->len;
+  }
+  long shoff = align_to(off, 8);
+
+  // ELF header
+  sink_char(out, 0x7f);
+  sink_write(out, "ELF", 3);
+  sink_char(out, 2); // ELFCLASS64
+  sink_char(out, 1); // ELFDATA2LSB
+  sink_char(out, 1); // EV_CURRENT
+  sink_le(out, 0, 9);
+  sink_le(out, 1, 2);  // ET_REL
+  sink_le(out, 62, 2); // EM_X86_64
+  sink_le(out, 1, 4);
+  sink_le(out, 0, 8);
+  sink_le(out, 0, 8);
+  sink_le(out, shoff, 8);
+  sink_le(out, 0, 4);
+  sink_le(out, 64, 2);
+  sink_le(out, 0, 2);
+  sink_le(out, 0, 2);
+  sink_le(out, 64, 2);
+  sink_le(out, SHN_NUM, 2);
+  sink_le(out, SHN_SHSTRTAB, 2);
+
+  for (int i = 0; i < SHN_NUM; i++) {
+    sink_align(out, 8);
+    if (contents[i])
+      sink_write(out, contents[i]->buf, contents[i]->len);
+  }
+  sink_align(out, 8);
+
+  // Section headers
+  sink_le(out, 0, 64);
+  write_section_header(out, name[SHN_TEXT], 1, 6, offset[SHN_TEXT],
+                       obj->text->len);
+  write_section_tail(out, 0, 0, 16, 0);
+  write_section_header(out, name[SHN_DATA], 1, 3, offset[SHN_DATA],
+                       obj->data->len);
+  write_section_tail(out, 0, 0, obj->data_align, 0);
+  write_section_header(out, name[SHN_BSS], 8, 3, offset[SHN_BSS],
+                       obj->bss_size);
+  write_section_tail(out, 0, 0, obj->bss_align, 0);
+  write_section_header(out, name[SHN_RELA_TEXT], 4, 0x40,
+                       offset[SHN_RELA_TEXT], rela_text->len);
+  write_section_tail(out, SHN_SYMTAB, SHN_TEXT, 8, 24);
+  write_section_header(out, name[SHN_RELA_DATA], 4, 0x40,
+                       offset[SHN_RELA_DATA], rela_data->len);
+  write_section_tail(out, SHN_SYMTAB, SHN_DATA, 8, 24);
+  write_section_header(out, name[SHN_SYMTAB], 2, 0, offset[SHN_SYMTAB],
+                       symtab->len);
+  write_section_tail(out, SHN_STRTAB, first_global, 8, 24);
+  write_section_header(out, name[SHN_STRTAB], 3, 0, offset[SHN_STRTAB],
+                       strtab->len);
+  write_section_tail(out, 0, 0, 1, 0);
+  write_section_header(out, name[SHN_NOTE], 1, 0, offset[SHN_NOTE], 0);
+  write_section_tail(out, 0, 0, 1, 0);
+  write_section_header(out, name[SHN_SHSTRTAB], 3, 0, offset[SHN_SHSTRTAB],
+                       shstrtab->len);
+  write_section_tail(out, 0, 0, 1, 0);
+}
@@ -0,0 +1,1160 @@
+typedef struct FILE FILE;
+typedef long size_t;
+struct timespec {
+  long tv_sec;
+  long tv_nsec;
+};
+struct rusage {
+  long ru_utime[2];
+  long ru_stime[2];
+  long ru_maxrss;
+  long ru_rest[13];
+};
+extern FILE *stdout;
+extern FILE *stderr;
+
+void *malloc(long size);
+void *calloc(long nmemb, long size);
+int *__errno_location();
+char *strerror(int errnum);
+FILE *fopen(char *pathname, char *mode);
+long fread(void *ptr, long size, long nmemb, FILE *stream);
+int feof(FILE *stream);
+static void assert() {}
+int strcmp(char *s1, char *s2);
+int printf(char *fmt, ...);
+int sprintf(char *buf, char *fmt, ...);
+long strlen(char *p);
+int strncmp(char *p, char *q);
+void *memcpy(char *dst, char *src, long n);
+char *strndup(char *p, long n);
+int isspace(int c);
+char *strstr(char *haystack, char *needle);
+long strtol(char *nptr, char **endptr, int base);
+int memcmp(char *s1, char *s2, long n);
+int fprintf(FILE *fp, char *fmt, ...);
+int fputs(char *s, FILE *fp);
+long fwrite(void *ptr, long size, long nmemb, FILE *stream);
+int fclose(FILE *fp);
+int fseek(FILE *fp, long offset, int whence);
+long ftell(FILE *fp);
+FILE *open_memstream(char **ptr, size_t *sizeloc);
+int rename(char *oldpath, char *newpath);
+int mkdir(char *pathname, int mode);
+int getpid(void);
+int clock_gettime(int clockid, struct timespec *tp);
+int getrusage(int who, struct rusage *usage);
+void *realloc(void *ptr, long size);
+void free(void *ptr);
+void *memset(void *s, int c, long n);
+int open(char *pathname, int flags, ...);
+int close(int fd);
+long write(int fd, void *buf, long count);
+int ftruncate(int fd, long length);
+void *mmap(void *addr, long length, int prot, int flags, int fd, long offset);
+int munmap(void *addr, long length);
+void *mremap(void *old_address, long old_size, long new_size, int flags);
+int mprotect(void *addr, long len, int prot);
+void *dlopen(char *filename, int flags);
+void *dlsym(void *handle, char *symbol);
+char *dlerror(void);
+char *strchr(char *s, int c);
+void *bsearch(void *key, void *base, long nmemb, long size, void *compar);
+extern char **environ;
+int pipe(int *pipefd);
+int fork(void);
+int waitpid(int pid, int *wstatus, int options);
+long read(int fd, void *buf, long count);
+void _exit(int status);
+void exit(int status);
+void *memmove(void *dest, void *src, long n);
+
+typedef struct {
+  int gp_offset;
+  int fp_offset;
+  void *overflow_arg_area;
+  void *reg_save_area;
+} __va_elem;
+
+typedef __va_elem va_list[1];
+
+static void va_end(__va_elem *ap) {}
+
+typedef struct Type Type;
+typedef struct Member Member;
+typedef struct Initializer Initializer;
+typedef struct Program Program;
+
+// main.c
+
+typedef enum {
+  PHASE_READ,
+  PHASE_TOKENIZE,
+  PHASE_PARSE,
+  PHASE_LAYOUT,
+  PHASE_EMIT_DATA,
+  PHASE_EMIT_TEXT,
+  PHASE_DONE,
+} Phase;
+
+extern char *phase_names[];
+extern Phase current_phase;
+extern _Bool time_report;
+
+long now_ns(void);
+void enter_phase(Phase phase);
+
+// alloc.c
+
+typedef enum {
+  ALLOC_TOKEN,
+  ALLOC_NODE,
+  ALLOC_TYPE,
+  ALLOC_MEMBER,
+  ALLOC_VAR,
+  ALLOC_SCOPE,
+  ALLOC_INITIALIZER,
+  ALLOC_FUNCTION,
+  ALLOC_CODE, // Instructions and the arrays of the back end
+  ALLOC_OTHER,
+  ALLOC_NKINDS,
+} AllocKind;
+
+extern _Bool mem_report;
+
+void *allocate(AllocKind kind, long size);
+void *reallocate(AllocKind kind, void *p, long size);
+void print_mem_report(Program *prog);
+
+// tokenize.c
+
+typedef enum {
+  TK_RESERVED,
+  TK_IDENT,
+  TK_STR,
+  TK_NUM,
+  TK_EOF,
+} TokenKind;
+
+typedef struct Token Token;
+struct Token {
+  TokenKind kind;
+  Token *next;
+  long val;
+  Type *ty;
+  char *str;
+  int len;
+
+  char *contents;
+  int cont_len;
+};
+
+void error(char *fmt, ...);
+void error_at(char *loc, char *fmt, ...);
+void error_tok(Token *tok, char *fmt, ...);
+void warn_tok(Token *tok, char *fmt, ...);
+Token *peek(char *s);
+Token *consume(char *op);
+Token *consume_ident(void);
+void expect(char *op);
+char *expect_ident(void);
+_Bool at_eof(void);
+Token *tokenize(void);
+
+extern char *filename;
+extern char *user_input;
+extern Token *token;
+
+// parse.c
+
+typedef struct Var Var;
+struct Var {
+  char *name;
+  Type *ty;
+  _Bool is_local;
+
+  int offset;
+
+  _Bool is_static;
+  Initializer *initializer;
+
+  // Set by promote_vars(). A local variable in a register has no stack
+  // slot and is held by virtual register reg instead.
+  int uses;
+  _Bool addr_taken;
+  _Bool in_reg;
+  int reg;
+};
+
+typedef struct VarList VarList;
+struct VarList {
+  VarList *next;
+  Var *var;
+};
+
+typedef enum {
+  ND_ADD,
+  ND_PTR_ADD,
+  ND_SUB,
+  ND_PTR_SUB,
+  ND_PTR_DIFF,
+  ND_MUL,
+  ND_DIV,
+  ND_BITAND,
+  ND_BITOR,
+  ND_BITXOR,
+  ND_SHL,
+  ND_SHR,
+  ND_EQ,
+  ND_NE,
+  ND_LT,
+  ND_LE,
+  ND_ASSIGN,
+  ND_TERNARY,
+  ND_PRE_INC,
+  ND_PRE_DEC,
+  ND_POST_INC,
+  ND_POST_DEC,
+  ND_ADD_EQ,
+  ND_PTR_ADD_EQ,
+  ND_SUB_EQ,
+  ND_PTR_SUB_EQ,
+  ND_MUL_EQ,
+  ND_DIV_EQ,
+  ND_SHL_EQ,
+  ND_SHR_EQ,
+  ND_BITAND_EQ,
+  ND_BITOR_EQ,
+  ND_BITXOR_EQ,
+  ND_COMMA,
+  ND_MEMBER,
+  ND_ADDR,
+  ND_DEREF,
+  ND_NOT,
+  ND_BITNOT,
+  ND_LOGAND,
+  ND_LOGOR,
+  ND_RETURN,
+  ND_IF,
+  ND_WHILE,
+  ND_FOR,
+  ND_DO,
+  ND_SWITCH,
+  ND_CASE,
+  ND_BLOCK,
+  ND_BREAK,
+  ND_CONTINUE,
+  ND_GOTO,
+  ND_LABEL,
+  ND_FUNCALL,
+  ND_EXPR_STMT,
+  ND_STMT_EXPR,
+  ND_VAR,
+  ND_NUM,
+  ND_CAST,
+  ND_NULL,
+} NodeKind;
+
+typedef struct Node Node;
+struct Node {
+  NodeKind kind;
+  Node *next;
+  Type *ty;
+  Token *tok;
+
+  Node *lhs;
+  Node *rhs;
+
+  Node *cond;
+  Node *then;
+  Node *els;
+  Node *init;
+  Node *inc;
+
+  Node *body;
+
+  Member *member;
+
+  char *funcname;
+  Node *args;
+
+  char *label_name;
+
+  Node *case_next;
+  Node *default_case;
+  int case_label;
+  int case_end_label;
+
+  Var *var;
+
+  long val;
+};
+
+struct Initializer {
+  Initializer *next;
+
+  int sz;
+  long val;
+
+  char *label;
+  long addend;
+};
+
+typedef struct Function Function;
+struct Function {
+  Function *next;
+  char *name;
+  VarList *params;
+  _Bool is_static;
+  _Bool has_varargs;
+
+  Node *node;
+  VarList *locals;
+  VarList *globals;
+  int stack_size;
+  int nlabels;
+
+  char *cache_key;
+  char *cached_asm;
+
+  // -ftime-report
+  long parse_ns;
+  long gen_ns;
+  long num_nodes;
+  long num_insns;
+};
+
+struct Program {
+  VarList *globals;
+  Function *fns;
+};
+
+extern long num_nodes;
+
+Program *program(void);
+
+// typing.c
+
+typedef enum {
+  TY_VOID,
+  TY_BOOL,
+  TY_CHAR,
+  TY_SHORT,
+  TY_INT,
+  TY_LONG,
+  TY_ENUM,
+  TY_PTR,
+  TY_ARRAY,
+  TY_STRUCT,
+  TY_FUNC,
+} TypeKind;
+
+struct Type {
+  TypeKind kind;
+  int size;
+  int align;
+  _Bool is_incomplete;
+
+  Type *base;
+  int array_len;
+  Member *members;
+  Type *return_ty;
+};
+
+struct  Member {
+  Member *next;
+  Type *ty;
+  Token *tok;
+  char *name;
+  int offset;
+};
+
+extern Type *void_type;
+extern Type *bool_type;
+extern Type *char_type;
+extern Type *short_type;
+extern Type *int_type;
+extern Type *long_type;
+
+_Bool is_integer(Type *ty);
+int align_to(int n, int align);
+Type *pointer_to(Type *base);
+Type *array_of(Type *base, int size);
+Type *func_type(Type *return_ty);
+Type *enum_type(void);
+Type *struct_type(void);
+void add_type(Node *node);
+
+// sink.c
+
+// An output sink collects bytes in a large buffer. It hands them to a file
+// descriptor whenever the buffer fills up, keeps them all in memory if it
+// has no file descriptor, or writes them into an mmap'd file.
+typedef struct {
+  char *buf;
+  long len;
+  long cap;
+  int fd;
+  _Bool mapped;
+} Sink;
+
+Sink *new_fd_sink(int fd);
+Sink *new_mem_sink(void);
+Sink *new_file_sink(char *path);
+void sink_reserve(Sink *s, long n);
+void sink_write(Sink *s, char *p, long len);
+void sink_str(Sink *s, char *str);
+void sink_char(Sink *s, int c);
+void sink_int(Sink *s, long val);
+char *write_int(char *p, long val);
+void sink_le(Sink *s, long val, int size);
+void sink_align(Sink *s, int align);
+void sink_close(Sink *s);
+
+// asm.c
+
+// Registers are numbered as in the instruction encoding.
+typedef enum {
+  RAX,
+  RCX,
+  RDX,
+  RBX,
+  RSP,
+  RBP,
+  RSI,
+  RDI,
+  R8,
+  R9,
+  R10,
+  R11,
+  R12,
+  R13,
+  R14,
+  R15,
+
+  // Registers from here on are virtual. Code generation uses as many as
+  // it likes and the register allocator maps them to the ones above.
+  VREG,
+} Reg;
+
+// Condition codes are numbered as in the encoding of jcc and setcc.
+typedef enum {
+  CC_E = 4,
+  CC_NE = 5,
+  CC_A = 7,
+  CC_L = 12,
+  CC_GE = 13,
+  CC_LE = 14,
+  CC_G = 15,
+} CondCode;
+
+typedef enum {
+  OP_NONE,
+  OP_REG,   // reg
+  OP_IMM,   // val
+  OP_MEM,   // [reg+index*scale+val], or [rip+sym+val] if sym is set.
+            // There is no index if scale is 0.
+  OP_LABEL, // Local label number val, or [rip+label] for lea
+  OP_SYM,   // Symbol sym
+} OperandKind;
+
+typedef struct {
+  OperandKind kind;
+  int size;
+  int reg;
+  int index;
+  int scale;
+  long val;
+  char *sym;
+} Operand;
+
+typedef enum {
+  I_LABEL,
+  I_MOV,
+  I_MOVSX,
+  I_MOVZX,
+  I_LEA,
+  I_PUSH,
+  I_POP,
+  I_ADD,
+  I_SUB,
+  I_IMUL,
+  I_CQO,
+  I_IDIV,
+  I_IMULH, // rdx:rax = rax * dst
+  I_AND,
+  I_OR,
+  I_XOR,
+  I_SHL,
+  I_SAR,
+  I_NOT,
+  I_CMP,
+  I_SETCC,
+  I_JMP,
+  I_JCC,
+  I_CALL,
+  I_RET,
+  I_ENTRY, // Jump table entry: the offset of label dst from label src
+  I_ALIGN, // Padding to the next 16 bytes, unless that is more than 10
+} InstKind;
+
+typedef struct {
+  InstKind kind;
+  CondCode cc;
+  Operand dst;
+  Operand src;
+} Inst;
+
+// The instructions of one function. Local labels are referred to by
+// number and named only when printed.
+typedef struct {
+  Inst *insts;
+  int len;
+  int cap;
+  char **labels;
+  int nlabels;
+  int labels_cap;
+  int nregs;
+  int nvars; // Virtual registers from VREG on that hold variables
+  int args;  // Bitmap of the registers holding arguments on entry
+} Code;
+
+void print_insts(Sink *out, Code *code, int start, int end);
+void print_code(Sink *out, Code *code);
+
+// cfg.c
+
+// A basic block is the run of instructions from start to end.
+typedef struct {
+  int start;
+  int end;
+  int *succs;
+  int nsuccs;
+  int *preds;
+  int npreds;
+} Block;
+
+typedef struct {
+  Block *blocks;
+  int nblocks;
+  int *label_block; // The block each label starts, or -1
+} CFG;
+
+CFG *build_cfg(Code *code);
+void free_cfg(CFG *cfg);
+_Bool is_table(CFG *cfg, Code *code, int b);
+
+// opt.c
+
+extern int opt_level;
+extern _Bool dump_code;
+
+void run_passes(Code *code, char *funcname);
+
+// jump.c
+
+void optimize_jumps(Code *code);
+
+// peephole.c
+
+void peephole(Code *code);
+
+// licm.c
+
+void hoist_invariants(Code *code);
+
+// regalloc.c
+
+int alloc_regs(Code *code, int frame_size, _Bool *used);
+
+// elf.c
+
+typedef enum {
+  SEC_UNDEF,
+  SEC_TEXT,
+  SEC_DATA,
+  SEC_BSS,
+} SectionKind;
+
+typedef enum {
+  R_X86_64_64 = 1,
+  R_X86_64_PC32 = 2,
+  R_X86_64_PLT32 = 4,
+} RelocType;
+
+typedef struct {
+  char *name;
+  SectionKind sec;
+  long offset;
+  long size;
+  _Bool is_global;
+  int index;
+} Symbol;
+
+typedef struct {
+  SectionKind sec;
+  long offset;
+  RelocType type;
+  char *sym;
+  long addend;
+} Reloc;
+
+// Machine code and data of a translation unit, with symbols and
+// relocations referring to symbols by name.
+typedef struct {
+  Sink *text;
+  Sink *data;
+  long bss_size;
+  int data_align;
+  int bss_align;
+
+  Symbol **syms;
+  int nsyms;
+  int syms_cap;
+  Symbol **map;
+  int map_cap;
+
+  Reloc *relocs;
+  int nrelocs;
+  int relocs_cap;
+} Object;
+
+Object *new_object(void);
+Symbol *find_symbol(Object *obj, char *name);
+Symbol *obj_symbol(Object *obj, char *name, SectionKind sec, _Bool is_global);
+void obj_reloc(Object *obj, SectionKind sec, long offset, RelocType type,
+               char *sym, long addend);
+void obj_add_globals(Object *obj, VarList *globals);
+void write_object(Object *obj, Sink *out);
+
+// promote.c
+
+void promote_vars(Function *fn);
+
+// inline.c
+
+extern _Bool no_inline;
+
+_Bool may_inline(Token *begin, Token *end);
+Function *find_inline(char *name);
+void inline_function(Function *fn, Token *begin, Token *end);
+
+// encode.c
+
+void encode_code(Object *obj, Code *code);
+void align_text(Object *obj);
+
+// jit.c
+
+void jit_add_library(char *name);
+void run_object(Object *obj, int argc, char **argv);
+
+// worker.c
+
+int start_worker(int *fd);
+void finish_worker(Sink *s, int fd);
+char *wait_worker(int pid, int fd, long *len);
+
+// codegen.c
+
+extern long num_insns;
+extern int codegen_jobs;
+extern _Bool omit_frame_pointer;
+
+void codegen(Program *prog, Sink *out);
+Object *codegen_object(Program *prog);
+
+// cache.c
+
+extern char *cache_dir;
+
+char *cache_load(char *key);
+void cache_store(char *key, char *buf, long len);
+
+// A relocation within the bytes of one instruction, recorded before the
+// final position of the instruction is known.
+typedef struct {
+  int inst;
+  long offset;
+  RelocType type;
+  char *sym;
+  long addend;
+} Fixup;
+
+// Instructions other than jumps are encoded once into buf. start[i] is
+// where instruction i begins there.
+static Sink *buf;
+static long *start;
+static int cur;
+
+static Fixup *fixups;
+static int nfixups;
+static int fixups_cap;
+
+static void put(int c) { sink_char(buf, c); }
+
+static void put_imm(long val, int size) { sink_le(buf, val, size); }
+
+static _Bool is_int8(long val) { return val == (char)val; }
+
+static _Bool is_int32(long val) { return val == (int)val; }
+
+static void add_fixup(RelocType type, char *sym, long addend) {
+  if (nfixups == fixups_cap) {
+    fixups_cap = fixups_cap ? fixups_cap * 2 : 64;
+    fixups = reallocate(ALLOC_CODE, fixups, sizeof(Fixup) * fixups_cap);
+  }
+  Fixup *f = &fixups[nfixups++];
+  f->inst = cur;
+  f->offset = buf->len;
+  f->type = type;
+  f->sym = sym;
+  f->addend = addend;
+}
+
+static void prefix(int size) {
+  if (size == 2)
+    put(0x66);
+}
+
+static int rex_w(int size) { return size == 8 ? 0x48 : 0; }
+
+// spl, bpl, sil and dil can only be encoded with a REX prefix, without
+// which the same numbers mean ah, ch, dh and bh.
+static int byte_rex(Operand *op) {
+  if (op->kind == OP_REG && op->size == 1 && op->reg >= 4 && op->reg < 8)
+    return 0x40;
+  return 0;
+}
+
+// Encodes the REX prefix, opcode, ModRM byte, SIB byte and displacement
+// of an instruction. reg is the register or opcode extension in the reg
+// field and rm is a register or memory operand. imm_len is the number of
+// immediate bytes that follow, which a RIP-relative displacement has to
+// account for.
+static void encode_rm(int rex, int opcode, int reg, Operand *rm,
+                      int imm_len) {
+  if (reg & 8)
+    rex |= 0x44;
+  if ((rm->kind == OP_REG || (rm->kind == OP_MEM && !rm->sym)) &&
+      (rm->reg & 8))
+    rex |= 0x41;
+  if (rm->kind == OP_MEM && rm->scale && (rm->index & 8))
+    rex |= 0x42;
+  if (rex)
+    put(rex);
+
+  if (opcode > 0xff)
+    put(opcode >> 8);
+  put(opcode & 0xff);
+
+  if (rm->kind == OP_REG) {
+    put(0xc0 | (reg & 7) << 3 | (rm->reg & 7));
+    return;
+  }
+
+  // A local label is not known yet, and its displacement is filled in
+  // along with those of jumps.
+  if (rm->sym || rm->kind == OP_LABEL) {
+    put(0x05 | (reg & 7) << 3);
+    if (rm->sym)
+      add_fixup(R_X86_64_PC32, rm->sym, rm->val - 4 - imm_len);
+    put_imm(0, 4);
+    return;
+  }
+
+  int base = rm->reg & 7;
+  long disp = rm->val;
+  int mod = 2;
+  if (disp == 0 && base != 5)
+    mod = 0;
+  else if (is_int8(disp))
+    mod = 1;
+
+  // A SIB byte follows for an index, or for a base of rsp or r12, whose
+  // number in the ModRM byte means that there is one.
+  if (rm->scale) {
+    int ss = rm->scale == 1 ? 0 : rm->scale == 2 ? 1 : rm->scale == 4 ? 2 : 3;
+    put(mod << 6 | (reg & 7) << 3 | 4);
+    put(ss << 6 | (rm->index & 7) << 3 | base);
+  } else {
+    put(mod << 6 | (reg & 7) << 3 | base);
+    if (base == 4)
+      put(0x24);
+  }
+  if (mod == 1)
+    put_imm(disp, 1);
+  else if (mod == 2)
+    put_imm(disp, 4);
+}
+
+// add, or, and, sub, xor and cmp share their encodings and differ only in
+// an opcode extension.
+static void encode_alu(int ext, Operand *dst, Operand *src) {
+  int size = dst->size;
+  prefix(size);
+
+  if (src->kind == OP_IMM) {
+    int imm_len = size < 4 ? size : 4;
+    int opcode = size == 1 ? 0x80 : 0x81;
+    if (size > 1 && is_int8(src->val)) {
+      imm_len = 1;
+      opcode = 0x83;
+    }
+    encode_rm(rex_w(size) | byte_rex(dst), opcode, ext, dst, imm_len);
+    put_imm(src->val, imm_len);
+    return;
+  }
+
+  int byte = size == 1 ? 0 : 1;
+  if (src->kind == OP_REG)
+    encode_rm(rex_w(size) | byte_rex(dst) | byte_rex(src), ext * 8 + byte,
+              src->reg, dst, 0);
+  else
+    encode_rm(rex_w(size) | byte_rex(dst), ext * 8 + 2 + byte, dst->reg, src,
+              0);
+}
+
+static void encode_mov(Operand *dst, Operand *src) {
+  int size = dst->size;
+
+  if (src->kind == OP_IMM && dst->kind == OP_REG) {
+    long val = src->val;
+    int r = dst->reg;
+
+    // Writing a 32-bit register clears the upper half, so this is the
+    // shortest form for all values that fit in 32 bits unsigned.
+    if (size == 8 && !(val >= 0 && val <= 0xffffffff)) {
+      if (is_int32(val)) {
+        encode_rm(0x48, 0xc7, 0, dst, 4);
+        put_imm(val, 4);
+      } else {
+        put(0x48 | (r >= 8 ? 1 : 0));
+        put(0xb8 + (r & 7));
+        put_imm(val, 8);
+      }
+      return;
+    }
+
+    prefix(size);
+    if (r >= 8 || byte_rex(dst))
+      put(0x40 | (r >= 8 ? 1 : 0));
+    put((size == 1 ? 0xb0 : 0xb8) + (r & 7));
+    put_imm(val, size < 4 ? size : 4);
+    return;
+  }
+
+  prefix(size);
+  if (src->kind == OP_IMM) {
+    int imm_len = size < 4 ? size : 4;
+    encode_rm(rex_w(size), size == 1 ? 0xc6 : 0xc7, 0, dst, imm_len);
+    put_imm(src->val, imm_len);
+    return;
+  }
+
+  int byte = size == 1 ? 0 : 1;
+  if (src->kind == OP_REG)
+    encode_rm(rex_w(size) | byte_rex(dst) | byte_rex(src), 0x88 + byte,
+              src->reg, dst, 0);
+  else
+    encode_rm(rex_w(size) | byte_rex(dst), 0x8a + byte, dst->reg, src, 0);
+}
+
+static void encode_shift(int ext, Operand *dst, Operand *src) {
+  int size = dst->size;
+  prefix(size);
+
+  int byte = size == 1 ? 0 : 1;
+  if (src->kind == OP_REG) {
+    encode_rm(rex_w(size) | byte_rex(dst), 0xd2 + byte, ext, dst, 0);
+    return;
+  }
+  encode_rm(rex_w(size) | byte_rex(dst), 0xc0 + byte, ext, dst, 1);
+  put_imm(src->val, 1);
+}
+
+// Unary instructions of the 0xf6/0xf7 group: not, neg, mul, imul, div and
+// idiv.
+static void encode_unary(int ext, Operand *op) {
+  int size = op->size;
+  prefix(size);
+  encode_rm(rex_w(size) | byte_rex(op), size == 1 ? 0xf6 : 0xf7, ext, op, 0);
+}
+
+static void encode_inst(Inst *inst) {
+  Operand *dst = &inst->dst;
+  Operand *src = &inst->src;
+
+  switch (inst->kind) {
+  case I_LABEL:
+  case I_JCC:
+  case I_ALIGN:
+    return;
+  case I_JMP:
+    if (dst->kind != OP_LABEL)
+      encode_rm(0, 0xff, 4, dst, 0);
+    return;
+  case I_MOV:
+    encode_mov(dst, src);
+    return;
+  case I_MOVSX:
+  case I_MOVZX: {
+    int opcode = inst->kind == I_MOVSX ? 0x0fbe : 0x0fb6;
+    if (src->size == 2)
+      opcode++;
+    if (inst->kind == I_MOVSX && src->size == 4)
+      opcode = 0x63;
+    encode_rm(rex_w(dst->size) | byte_rex(src), opcode, dst->reg, src, 0);
+    return;
+  }
+  case I_LEA:
+    encode_rm(rex_w(dst->size), 0x8d, dst->reg, src, 0);
+    return;
+  case I_PUSH:
+    if (dst->kind == OP_REG) {
+      if (dst->reg >= 8)
+        put(0x41);
+      put(0x50 + (dst->reg & 7));
+    } else if (dst->kind == OP_IMM) {
+      if (is_int8(dst->val)) {
+        put(0x6a);
+        put_imm(dst->val, 1);
+      } else {
+        put(0x68);
+        put_imm(dst->val, 4);
+      }
+    } else {
+      encode_rm(0, 0xff, 6, dst, 0);
+    }
+    return;
+  case I_POP:
+    if (dst->kind == OP_REG) {
+      if (dst->reg >= 8)
+        put(0x41);
+      put(0x58 + (dst->reg & 7));
+    } else {
+      encode_rm(0, 0x8f, 0, dst, 0);
+    }
+    return;
+  case I_ADD:
+    encode_alu(0, dst, src);
+    return;
+  case I_OR:
+    encode_alu(1, dst, src);
+    return;
+  case I_AND:
+    encode_alu(4, dst, src);
+    return;
+  case I_SUB:
+    encode_alu(5, dst, src);
+    return;
+  case I_XOR:
+    encode_alu(6, dst, src);
+    return;
+  case I_CMP:
+    encode_alu(7, dst, src);
+    return;
+  case I_IMUL:
+    if (src->kind == OP_IMM) {
+      _Bool short_imm = is_int8(src->val);
+      encode_rm(rex_w(dst->size), short_imm ? 0x6b : 0x69, dst->reg, dst,
+                short_imm ? 1 : 4);
+      put_imm(src->val, short_imm ? 1 : 4);
+      return;
+    }
+    encode_rm(rex_w(dst->size), 0x0faf, dst->reg, src, 0);
+    return;
+  case I_CQO:
+    put(0x48);
+    put(0x99);
+    return;
+  case I_IDIV:
+    encode_unary(7, dst);
+    return;
+  case I_IMULH:
+    encode_unary(5, dst);
+    return;
+  case I_NOT:
+    encode_unary(2, dst);
+    return;
+  case I_SHL:
+    encode_shift(4, dst, src);
+    return;
+  case I_SAR:
+    encode_shift(7, dst, src);
+    return;
+  case I_SETCC:
+    encode_rm(byte_rex(dst), 0x0f90 + inst->cc, 0, dst, 0);
+    return;
+  case I_CALL:
+    put(0xe8);
+    add_fixup(R_X86_64_PLT32, dst->sym, -4);
+    put_imm(0, 4);
+    return;
+  case I_RET:
+    put(0xc3);
+    return;
+  case I_ENTRY:
+    put_imm(0, 4);
+    return;
+  }
+  error("cannot encode instruction %d", inst->kind);
+}
+
+static _Bool is_jump(Inst *inst) {
+  return (inst->kind == I_JMP || inst->kind == I_JCC) &&
+         inst->dst.kind == OP_LABEL;
+}
+
+// Instructions that end with a 32-bit offset between labels, or between a
+// label and the next instruction.
+static _Bool refers_label(Inst *inst) {
+  return inst->kind == I_ENTRY ||
+         (inst->kind == I_LEA && inst->src.kind == OP_LABEL);
+}
+
+static int jump_size(Inst *inst, _Bool near) {
+  if (!near)
+    return 2;
+  return inst->kind == I_JMP ? 5 : 6;
+}
+
+// The bytes that I_ALIGN adds at pc, relative to the start of the
+// function, which is itself aligned.
+static int padding(long pc) {
+  int n = align_to(pc, 16) - pc;
+  return n > 10 ? 0 : n;
+}
+
+// The recommended nops of 1 to 8 bytes. Longer ones have more 0x66
+// prefixes.
+static long nops[] = {
+    0,
+    0x90,
+    0x9066,
+    0x001f0f,
+    0x00401f0f,
+    0x0000441f0f,
+    0x0000441f0f66,
+    0x000000801f0f,
+    0x00000000841f0f,
+};
+
+static void put_nops(Sink *s, int n) {
+  for (; n > 8; n--)
+    sink_char(s, 0x66);
+  sink_le(s, nops[n], n);
+}
+
+// Pads the text section so that the next function starts on 16 bytes.
+void align_text(Object *obj) {
+  int n = align_to(obj->text->len, 16) - obj->text->len;
+  while (n > 10) {
+    put_nops(obj->text, 8);
+    n -= 8;
+  }
+  put_nops(obj->text, n);
+}
+
+// Appends the machine code of a function to the text section.
+//
+// Jumps are first assumed to reach their targets with an 8-bit
+// displacement. Those that turn out not to are widened to 32 bits, which
+// moves later code and may push other jumps out of range, so this is
+// repeated until nothing changes. Since jumps only ever grow, it ends,
+// even though the padding before loops may shrink as code moves.
+void encode_code(Object *obj, Code *code) {
+  int n = code->len;
+  if (!buf)
+    buf = new_mem_sink();
+  buf->len = 0;
+  nfixups = 0;
+  start = reallocate(ALLOC_CODE, start, sizeof(long) * (n + 1));
+
+  for (cur = 0; cur < n; cur++) {
+    start[cur] = buf->len;
+    encode_inst(&code->insts[cur]);
+  }
+  start[n] = buf->len;
+
+  long *pos = allocate(ALLOC_CODE, sizeof(long) * (n + 1));
+  long *label_pos = allocate(ALLOC_CODE, sizeof(long) * code->nlabels);
+  _Bool *near = allocate(ALLOC_CODE, sizeof(_Bool) * n);
+
+  for (;;) {
+    long pc = 0;
+    for (int i = 0; i < n; i++) {
+      Inst *inst = &code->insts[i];
+      pos[i] = pc;
+      if (inst->kind == I_LABEL)
+        label_pos[inst->dst.val] = pc;
+      if (is_jump(inst))
+        pc += jump_size(inst, near[i]);
+      else if (inst->kind == I_ALIGN)
+        pc += padding(pc);
+      else
+        pc += start[i + 1] - start[i];
+    }
+    pos[n] = pc;
+
+    _Bool changed = 0;
+    for (int i = 0; i < n; i++) {
+      Inst *inst = &code->insts[i];
+      if (!is_jump(inst) || near[i])
+        continue;
+      if (!is_int8(label_pos[inst->dst.val] - pos[i] - 2)) {
+        near[i] = 1;
+        changed = 1;
+      }
+    }
+    if (!changed)
+      break;
+  }
+
+  Sink *text = obj->text;
+  long base = text->len;
+  for (int i = 0; i < n; i++) {
+    Inst *inst = &code->insts[i];
+    if (inst->kind == I_ALIGN) {
+      put_nops(text, pos[i + 1] - pos[i]);
+      continue;
+    }
+    if (refers_label(inst)) {
+      long val;
+      if (inst->kind == I_ENTRY)
+        val = label_pos[inst->dst.val] - label_pos[inst->src.val];
+      else
+        val = label_pos[inst->src.val] - pos[i + 1];
+      sink_write(text, buf->buf + start[i], start[i + 1] - start[i] - 4);
+      sink_le(text, val, 4);
+      continue;
+    }
+    if (!is_jump(inst)) {
+      sink_write(text, buf->buf + start[i], start[i + 1] - start[i]);
+      continue;
+    }
+
+    long disp = label_pos[inst->dst.val] - pos[i] - jump_size(inst, near[i]);
+    if (!near[i]) {
+      sink_char(text, inst->kind == I_JMP ? 0xeb : 0x70 + inst->cc);
+      sink_le(text, disp, 1);
+    } else if (inst->kind == I_JMP) {
+      sink_char(text, 0xe9);
+      sink_le(text, disp, 4);
+    } else {
+      sink_char(text, 0x0f);
+      sink_char(text, 0x80 + inst->cc);
+      sink_le(text, disp, 4);
+    }
+  }
+
+  for (int i = 0; i < nfixups; i++) {
+    Fixup *f = &fixups[i];
+    long offset = base + pos[f->inst] + f->offset - start[f->inst];
+    obj_reloc(obj, SEC_TEXT, offset, f->type, f->sym, f->addend);
+  }
+
+  free(pos);
+  free(label_pos);
+  free(near);
+}
@@ -0,0 +1,1055 @@
+typedef struct FILE FILE;
+typedef long size_t;
+struct timespec {
+  long tv_sec;
+  long tv_nsec;
+};
+struct rusage {
+  long ru_utime[2];
+  long ru_stime[2];
+  long ru_maxrss;
+  long ru_rest[13];
+};
+extern FILE *stdout;
+extern FILE *stderr;
+
+void *malloc(long size);
+void *calloc(long nmemb, long size);
+int *__errno_location();
+char *strerror(int errnum);
+FILE *fopen(char *pathname, char *mode);
+long fread(void *ptr, long size, long nmemb, FILE *stream);
+int feof(FILE *stream);
+static void assert() {}
+int strcmp(char *s1, char *s2);
+int printf(char *fmt, ...);
+int sprintf(char *buf, char *fmt, ...);
+long strlen(char *p);
+int strncmp(char *p, char *q);
+void *memcpy(char *dst, char *src, long n);
+char *strndup(char *p, long n);
+int isspace(int c);
+char *strstr(char *haystack, char *needle);
+long strtol(char *nptr, char **endptr, int base);
+int memcmp(char *s1, char *s2, long n);
+int fprintf(FILE *fp, char *fmt, ...);
+int fputs(char *s, FILE *fp);
+long fwrite(void *ptr, long size, long nmemb, FILE *stream);
+int fclose(FILE *fp);
+int fseek(FILE *fp, long offset, int whence);
+long ftell(FILE *fp);
+FILE *open_memstream(char **ptr, size_t *sizeloc);
+int rename(char *oldpath, char *newpath);
+int mkdir(char *pathname, int mode);
+int getpid(void);
+int clock_gettime(int clockid, struct timespec *tp);
+int getrusage(int who, struct rusage *usage);
+void *realloc(void *ptr, long size);
+void free(void *ptr);
+void *memset(void *s, int c, long n);
+int open(char *pathname, int flags, ...);
+int close(int fd);
+long write(int fd, void *buf, long count);
+int ftruncate(int fd, long length);
+void *mmap(void *addr, long length, int prot, int flags, int fd, long offset);
+int munmap(void *addr, long length);
+void *mremap(void *old_address, long old_size, long new_size, int flags);
+int mprotect(void *addr, long len, int prot);
+void *dlopen(char *filename, int flags);
+void *dlsym(void *handle, char *symbol);
+char *dlerror(void);
+char *strchr(char *s, int c);
+void *bsearch(void *key, void *base, long nmemb, long size, void *compar);
+extern char **environ;
+int pipe(int *pipefd);
+int fork(void);
+int waitpid(int pid, int *wstatus, int options);
+long read(int fd, void *buf, long count);
+void _exit(int status);
+void exit(int status);
+void *memmove(void *dest, void *src, long n);
+
+typedef struct {
+  int gp_offset;
+  int fp_offset;
+  void *overflow_arg_area;
+  void *reg_save_area;
+} __va_elem;
+
+typedef __va_elem va_list[1];
+
+static void va_end(__va_elem *ap) {}
+
+typedef struct Type Type;
+typedef struct Member Member;
+typedef struct Initializer Initializer;
+typedef struct Program Program;
+
+// main.c
+
+typedef enum {
+  PHASE_READ,
+  PHASE_TOKENIZE,
+  PHASE_PARSE,
+  PHASE_LAYOUT,
+  PHASE_EMIT_DATA,
+  PHASE_EMIT_TEXT,
+  PHASE_DONE,
+} Phase;
+
+extern char *phase_names[];
+extern Phase current_phase;
+extern _Bool time_report;
+
+long now_ns(void);
+void enter_phase(Phase phase);
+
+// alloc.c
+
+typedef enum {
+  ALLOC_TOKEN,
+  ALLOC_NODE,
+  ALLOC_TYPE,
+  ALLOC_MEMBER,
+  ALLOC_VAR,
+  ALLOC_SCOPE,
+  ALLOC_INITIALIZER,
+  ALLOC_FUNCTION,
+  ALLOC_CODE, // Instructions and the arrays of the back end
+  ALLOC_OTHER,
+  ALLOC_NKINDS,
+} AllocKind;
+
+extern _Bool mem_report;
+
+void *allocate(AllocKind kind, long size);
+void *reallocate(AllocKind kind, void *p, long size);
+void print_mem_report(Program *prog);
+
+// tokenize.c
+
+typedef enum {
+  TK_RESERVED,
+  TK_IDENT,
+  TK_STR,
+  TK_NUM,
+  TK_EOF,
+} TokenKind;
+
+typedef struct Token Token;
+struct Token {
+  TokenKind kind;
+  Token *next;
+  long val;
+  Type *ty;
+  char *str;
+  int len;
+
+  char *contents;
+  int cont_len;
+};
+
+void error(char *fmt, ...);
+void error_at(char *loc, char *fmt, ...);
+void error_tok(Token *tok, char *fmt, ...);
+void warn_tok(Token *tok, char *fmt, ...);
+Token *peek(char *s);
+Token *consume(char *op);
+Token *consume_ident(void);
+void expect(char *op);
+char *expect_ident(void);
+_Bool at_eof(void);
+Token *tokenize(void);
+
+extern char *filename;
+extern char *user_input;
+extern Token *token;
+
+// parse.c
+
+typedef struct Var Var;
+struct Var {
+  char *name;
+  Type *ty;
+  _Bool is_local;
+
+  int offset;
+
+  _Bool is_static;
+  Initializer *initializer;
+
+  // Set by promote_vars(). A local variable in a register has no stack
+  // slot and is held by virtual register reg instead.
+  int uses;
+  _Bool addr_taken;
+  _Bool in_reg;
+  int reg;
+};
+
+typedef struct VarList VarList;
+struct VarList {
+  VarList *next;
+  Var *var;
+};
+
+typedef enum {
+  ND_ADD,
+  ND_PTR_ADD,
+  ND_SUB,
+  ND_PTR_SUB,
+  ND_PTR_DIFF,
+  ND_MUL,
+  ND_DIV,
+  ND_BITAND,
+  ND_BITOR,
+  ND_BITXOR,
+  ND_SHL,
+  ND_SHR,
+  ND_EQ,
+  ND_NE,
+  ND_LT,
+  ND_LE,
+  ND_ASSIGN,
+  ND_TERNARY,
+  ND_PRE_INC,
+  ND_PRE_DEC,
+  ND_POST_INC,
+  ND_POST_DEC,
+  ND_ADD_EQ,
+  ND_PTR_ADD_EQ,
+  ND_SUB_EQ,
+  ND_PTR_SUB_EQ,
+  ND_MUL_EQ,
+  ND_DIV_EQ,
+  ND_SHL_EQ,
+  ND_SHR_EQ,
+  ND_BITAND_EQ,
+  ND_BITOR_EQ,
+  ND_BITXOR_EQ,
+  ND_COMMA,
+  ND_MEMBER,
+  ND_ADDR,
+  ND_DEREF,
+  ND_NOT,
+  ND_BITNOT,
+  ND_LOGAND,
+  ND_LOGOR,
+  ND_RETURN,
+  ND_IF,
+  ND_WHILE,
+  ND_FOR,
+  ND_DO,
+  ND_SWITCH,
+  ND_CASE,
+  ND_BLOCK,
+  ND_BREAK,
+  ND_CONTINUE,
+  ND_GOTO,
+  ND_LABEL,
+  ND_FUNCALL,
+  ND_EXPR_STMT,
+  ND_STMT_EXPR,
+  ND_VAR,
+  ND_NUM,
+  ND_CAST,
+  ND_NULL,
+} NodeKind;
+
+typedef struct Node Node;
+struct Node {
+  NodeKind kind;
+  Node *next;
+  Type *ty;
+  Token *tok;
+
+  Node *lhs;
+  Node *rhs;
+
+  Node *cond;
+  Node *then;
+  Node *els;
+  Node *init;
+  Node *inc;
+
+  Node *body;
+
+  Member *member;
+
+  char *funcname;
+  Node *args;
+
+  char *label_name;
+
+  Node *case_next;
+  Node *default_case;
+  int case_label;
+  int case_end_label;
+
+  Var *var;
+
+  long val;
+};
+
+struct Initializer {
+  Initializer *next;
+
+  int sz;
+  long val;
+
+  char *label;
+  long addend;
+};
+
+typedef struct Function Function;
+struct Function {
+  Function *next;
+  char *name;
+  VarList *params;
+  _Bool is_static;
+  _Bool has_varargs;
+
+  Node *node;
+  VarList *locals;
+  VarList *globals;
+  int stack_size;
+  int nlabels;
+
+  char *cache_key;
+  char *cached_asm;
+
+  // -ftime-report
+  long parse_ns;
+  long gen_ns;
+  long num_nodes;
+  long num_insns;
+};
+
+struct Program {
+  VarList *globals;
+  Function *fns;
+};
+
+extern long num_nodes;
+
+Program *program(void);
+
+// typing.c
+
+typedef enum {
+  TY_VOID,
+  TY_BOOL,
+  TY_CHAR,
+  TY_SHORT,
+  TY_INT,
+  TY_LONG,
+  TY_ENUM,
+  TY_PTR,
+  TY_ARRAY,
+  TY_STRUCT,
+  TY_FUNC,
+} TypeKind;
+
+struct Type {
+  TypeKind kind;
+  int size;
+  int align;
+  _Bool is_incomplete;
+
+  Type *base;
+  int array_len;
+  Member *members;
+  Type *return_ty;
+};
+
+struct  Member {
+  Member *next;
+  Type *ty;
+  Token *tok;
+  char *name;
+  int offset;
+};
+
+extern Type *void_type;
+extern Type *bool_type;
+extern Type *char_type;
+extern Type *short_type;
+extern Type *int_type;
+extern Type *long_type;
+
+_Bool is_integer(Type *ty);
+int align_to(int n, int align);
+Type *pointer_to(Type *base);
+Type *array_of(Type *base, int size);
+Type *func_type(Type *return_ty);
+Type *enum_type(void);
+Type *struct_type(void);
+void add_type(Node *node);
+
+// sink.c
+
+// An output sink collects bytes in a large buffer. It hands them to a file
+// descriptor whenever the buffer fills up, keeps them all in memory if it
+// has no file descriptor, or writes them into an mmap'd file.
+typedef struct {
+  char *buf;
+  long len;
+  long cap;
+  int fd;
+  _Bool mapped;
+} Sink;
+
+Sink *new_fd_sink(int fd);
+Sink *new_mem_sink(void);
+Sink *new_file_sink(char *path);
+void sink_reserve(Sink *s, long n);
+void sink_write(Sink *s, char *p, long len);
+void sink_str(Sink *s, char *str);
+void sink_char(Sink *s, int c);
+void sink_int(Sink *s, long val);
+char *write_int(char *p, long val);
+void sink_le(Sink *s, long val, int size);
+void sink_align(Sink *s, int align);
+void sink_close(Sink *s);
+
+// asm.c
+
+// Registers are numbered as in the instruction encoding.
+typedef enum {
+  RAX,
+  RCX,
+  RDX,
+  RBX,
+  RSP,
+  RBP,
+  RSI,
+  RDI,
+  R8,
+  R9,
+  R10,
+  R11,
+  R12,
+  R13,
+  R14,
+  R15,
+
+  // Registers from here on are virtual. Code generation uses as many as
+  // it likes and the register allocator maps them to the ones above.
+  VREG,
+} Reg;
+
+// Condition codes are numbered as in the encoding of jcc and setcc.
+typedef enum {
+  CC_E = 4,
+  CC_NE = 5,
+  CC_A = 7,
+  CC_L = 12,
+  CC_GE = 13,
+  CC_LE = 14,
+  CC_G = 15,
+} CondCode;
+
+typedef enum {
+  OP_NONE,
+  OP_REG,   // reg
+  OP_IMM,   // val
+  OP_MEM,   // [reg+index*scale+val], or [rip+sym+val] if sym is set.
+            // There is no index if scale is 0.
+  OP_LABEL, // Local label number val, or [rip+label] for lea
+  OP_SYM,   // Symbol sym
+} OperandKind;
+
+typedef struct {
+  OperandKind kind;
+  int size;
+  int reg;
+  int index;
+  int scale;
+  long val;
+  char *sym;
+} Operand;
+
+typedef enum {
+  I_LABEL,
+  I_MOV,
+  I_MOVSX,
+  I_MOVZX,
+  I_LEA,
+  I_PUSH,
+  I_POP,
+  I_ADD,
+  I_SUB,
+  I_IMUL,
+  I_CQO,
+  I_IDIV,
+  I_IMULH, // rdx:rax = rax * dst
+  I_AND,
+  I_OR,
+  I_XOR,
+  I_SHL,
+  I_SAR,
+  I_NOT,
+  I_CMP,
+  I_SETCC,
+  I_JMP,
+  I_JCC,
+  I_CALL,
+  I_RET,
+  I_ENTRY, // Jump table entry: the offset of label dst from label src
+  I_ALIGN, // Padding to the next 16 bytes, unless that is more than 10
+} InstKind;
+
+typedef struct {
+  InstKind kind;
+  CondCode cc;
+  Operand dst;
+  Operand src;
+} Inst;
+
+// The instructions of one function. Local labels are referred to by
+// number and named only when printed.
+typedef struct {
+  Inst *insts;
+  int len;
+  int cap;
+  char **labels;
+  int nlabels;
+  int labels_cap;
+  int nregs;
+  int nvars; // Virtual registers from VREG on that hold variables
+  int args;  // Bitmap of the registers holding arguments on entry
+} Code;
+
+void print_insts(Sink *out, Code *code, int start, int end);
+void print_code(Sink *out, Code *code);
+
+// cfg.c
+
+// A basic block is the run of instructions from start to end.
+typedef struct {
+  int start;
+  int end;
+  int *succs;
+  int nsuccs;
+  int *preds;
+  int npreds;
+} Block;
+
+typedef struct {
+  Block *blocks;
+  int nblocks;
+  int *label_block; // The block each label starts, or -1
+} CFG;
+
+CFG *build_cfg(Code *code);
+void free_cfg(CFG *cfg);
+_Bool is_table(CFG *cfg, Code *code, int b);
+
+// opt.c
+
+extern int opt_level;
+extern _Bool dump_code;
+
+void run_passes(Code *code, char *funcname);
+
+// jump.c
+
+void optimize_jumps(Code *code);
+
+// peephole.c
+
+void peephole(Code *code);
+
+// licm.c
+
+void hoist_invariants(Code *code);
+
+// regalloc.c
+
+int alloc_regs(Code *code, int frame_size, _Bool *used);
+
+// elf.c
+
+typedef enum {
+  SEC_UNDEF,
+  SEC_TEXT,
+  SEC_DATA,
+  SEC_BSS,
+} SectionKind;
+
+typedef enum {
+  R_X86_64_64 = 1,
+  R_X86_64_PC32 = 2,
+  R_X86_64_PLT32 = 4,
+} RelocType;
+
+typedef struct {
+  char *name;
+  SectionKind sec;
+  long offset;
+  long size;
+  _Bool is_global;
+  int index;
+} Symbol;
+
+typedef struct {
+  SectionKind sec;
+  long offset;
+  RelocType type;
+  char *sym;
+  long addend;
+} Reloc;
+
+// Machine code and data of a translation unit, with symbols and
+// relocations referring to symbols by name.
+typedef struct {
+  Sink *text;
+  Sink *data;
+  long bss_size;
+  int data_align;
+  int bss_align;
+
+  Symbol **syms;
+  int nsyms;
+  int syms_cap;
+  Symbol **map;
+  int map_cap;
+
+  Reloc *relocs;
+  int nrelocs;
+  int relocs_cap;
+} Object;
+
+Object *new_object(void);
+Symbol *find_symbol(Object *obj, char *name);
+Symbol *obj_symbol(Object *obj, char *name, SectionKind sec, _Bool is_global);
+void obj_reloc(Object *obj, SectionKind sec, long offset, RelocType type,
+               char *sym, long addend);
+void obj_add_globals(Object *obj, VarList *globals);
+void write_object(Object *obj, Sink *out);
+
+// promote.c
+
+void promote_vars(Function *fn);
+
+// inline.c
+
+extern _Bool no_inline;
+
+_Bool may_inline(Token *begin, Token *end);
+Function *find_inline(char *name);
+void inline_function(Function *fn, Token *begin, Token *end);
+
+// encode.c
+
+void encode_code(Object *obj, Code *code);
+void align_text(Object *obj);
+
+// jit.c
+
+void jit_add_library(char *name);
+void run_object(Object *obj, int argc, char **argv);
+
+// worker.c
+
+int start_worker(int *fd);
+void finish_worker(Sink *s, int fd);
+char *wait_worker(int pid, int fd, long *len);
+
+// codegen.c
+
+extern long num_insns;
+extern int codegen_jobs;
+extern _Bool omit_frame_pointer;
+
+void codegen(Program *prog, Sink *out);
+Object *codegen_object(Program *prog);
+
+// cache.c
+
+extern char *cache_dir;
+
+char *cache_load(char *key);
+void cache_store(char *key, char *buf, long len);
+
+// Inlining of small functions.
+//
+// A call to a small function defined earlier in the file is replaced by a
+// copy of the function's body, which saves the call and the moves around
+// it and lets the rest of the compiler see both sides at once. The copy
+// has its own local variables in the caller's frame. The arguments are
+// assigned to the copies of the parameters, and return statements store
+// the returned value and jump to the end of the copy:
+//
+//   f(a, b)  =>  ({ x = a; y = b; ...; ret = ...; goto 1; ...; 1: ; ret; })
+//
+// Functions are processed in the order they are defined, so the body of a
+// callee has already had its own calls inlined when it is copied, and a
+// function is never copied into itself.
+
+_Bool no_inline;
+
+// A function is inlined if its definition is at most max_tokens tokens
+// long and its body is at most max_nodes nodes after calls in it have been
+// inlined. The first limit is checked before the body is parsed, so that
+// the body of a function whose code comes from the cache is only parsed
+// when the function may be inlined.
+static int max_tokens = 80;
+static int max_nodes = 40;
+
+static Function **candidates;
+static int ncandidates;
+
+// Local variables of the callee and their copies in the caller.
+static Var **old_vars;
+static Var **new_vars;
+static int nvars;
+
+// The function that calls are inlined into.
+static Function *caller;
+
+// The type of the call being inlined, the variable that holds its value
+// once one is needed, and the label that returns jump to.
+static Type *ret_ty;
+static Var *ret_var;
+static char *join_label;
+static _Bool jumps_to_join;
+static int nsites;
+
+// The switch statement whose cases are being copied and its copy.
+static Node *old_switch;
+static Node *new_switch;
+
+_Bool may_inline(Token *begin, Token *end) {
+  if (no_inline)
+    return 0;
+  int n = 0;
+  for (Token *t = begin; t != end; t = t->next)
+    if (++n > max_tokens)
+      return 0;
+  return 1;
+}
+
+Function *find_inline(char *name) {
+  for (int i = 0; i < ncandidates; i++)
+    if (!strcmp(candidates[i]->name, name))
+      return candidates[i];
+  return 0;
+}
+
+static Node *new_node(NodeKind kind, Token *tok) {
+  num_nodes++;
+  Node *node = allocate(ALLOC_NODE, sizeof(Node));
+  node->kind = kind;
+  node->tok = tok;
+  return node;
+}
+
+static Node *new_var_node(Var *var, Token *tok) {
+  Node *node = new_node(ND_VAR, tok);
+  node->var = var;
+  node->ty = var->ty;
+  return node;
+}
+
+static Node *new_expr_stmt(Node *expr) {
+  Node *node = new_node(ND_EXPR_STMT, expr->tok);
+  node->lhs = expr;
+  return node;
+}
+
+static Node *new_assign(Var *var, Node *rhs) {
+  Node *node = new_node(ND_ASSIGN, rhs->tok);
+  node->lhs = new_var_node(var, rhs->tok);
+  node->rhs = rhs;
+  node->ty = var->ty;
+  return new_expr_stmt(node);
+}
+
+static Var *new_local(char *name, Type *ty) {
+  Var *var = allocate(ALLOC_VAR, sizeof(Var));
+  var->name = name;
+  var->ty = ty;
+  var->is_local = 1;
+
+  VarList *vl = allocate(ALLOC_VAR, sizeof(VarList));
+  vl->var = var;
+  vl->next = caller->locals;
+  caller->locals = vl;
+  return var;
+}
+
+static Var *return_var(void) {
+  if (!ret_var)
+    ret_var = new_local("ret", ret_ty);
+  return ret_var;
+}
+
+static Var *copy_var(Var *var) {
+  for (int i = 0; i < nvars; i++)
+    if (old_vars[i] == var)
+      return new_vars[i];
+  return var;
+}
+
+// Labels are named after the call site they were copied to, which keeps
+// them apart from the caller's labels, which are identifiers, and from
+// those of other copies.
+static char *copy_label(char *name) {
+  char *buf = malloc(strlen(name) + 20);
+  sprintf(buf, "%s.%d", name, nsites);
+  return buf;
+}
+
+static Node *copy_node(Node *node);
+
+static Node *copy_list(Node *node) {
+  Node head = {};
+  Node *cur = &head;
+  for (Node *n = node; n; n = n->next) {
+    cur->next = copy_node(n);
+    cur = cur->next;
+  }
+  return head.next;
+}
+
+static Node *copy_return(Node *node, _Bool is_last) {
+  Node *val = 0;
+  if (node->lhs && ret_ty->kind != TY_VOID)
+    val = new_assign(return_var(), copy_node(node->lhs));
+  else if (node->lhs)
+    val = new_expr_stmt(copy_node(node->lhs));
+
+  if (is_last)
+    return val ? val : new_node(ND_NULL, node->tok);
+
+  Node *jump = new_node(ND_GOTO, node->tok);
+  jump->label_name = join_label;
+  jumps_to_join = 1;
+  if (!val)
+    return jump;
+
+  Node *block = new_node(ND_BLOCK, node->tok);
+  block->body = val;
+  val->next = jump;
+  return block;
+}
+
+static Node *copy_node(Node *node) {
+  if (!node)
+    return 0;
+  if (node->kind == ND_RETURN)
+    return copy_return(node, 0);
+
+  Node *copy = new_node(node->kind, node->tok);
+  memcpy(copy, node, sizeof(Node));
+  copy->next = 0;
+  if (node->var && node->var->is_local)
+    copy->var = copy_var(node->var);
+  if (node->label_name)
+    copy->label_name = copy_label(node->label_name);
+
+  Node *sw = old_switch;
+  Node *sw_copy = new_switch;
+  if (node->kind == ND_SWITCH) {
+    old_switch = node;
+    new_switch = copy;
+    copy->case_next = 0;
+    copy->default_case = 0;
+  }
+
+  copy->lhs = copy_node(node->lhs);
+  copy->rhs = copy_node(node->rhs);
+  copy->cond = copy_node(node->cond);
+  copy->then = copy_node(node->then);
+  copy->els = copy_node(node->els);
+  copy->init = copy_node(node->init);
+  copy->inc = copy_node(node->inc);
+  copy->body = copy_list(node->body);
+  copy->args = copy_list(node->args);
+
+  old_switch = sw;
+  new_switch = sw_copy;
+
+  // Cases are linked to their switch in the same order as by the parser.
+  if (node->kind == ND_CASE) {
+    if (node == old_switch->default_case) {
+      new_switch->default_case = copy;
+    } else {
+      copy->case_next = new_switch->case_next;
+      new_switch->case_next = copy;
+    }
+  }
+  return copy;
+}
+
+static Node *new_cast(Node *expr, Type *ty) {
+  Node *node = new_node(ND_CAST, expr->tok);
+  node->lhs = expr;
+  node->ty = ty;
+  return node;
+}
+
+static Node *inline_call(Node *call, Function *callee) {
+  nsites++;
+  nvars = 0;
+  for (VarList *vl = callee->locals; vl; vl = vl->next)
+    nvars++;
+  old_vars = calloc(nvars, sizeof(Var *));
+  new_vars = calloc(nvars, sizeof(Var *));
+
+  int i = 0;
+  for (VarList *vl = callee->locals; vl; vl = vl->next) {
+    old_vars[i] = vl->var;
+    new_vars[i++] = new_local(vl->var->name, vl->var->ty);
+  }
+
+  ret_ty = call->ty;
+  ret_var = 0;
+  join_label = malloc(20);
+  sprintf(join_label, "%d", nsites);
+  jumps_to_join = 0;
+
+  Node head = {};
+  Node *cur = &head;
+  VarList *param = callee->params;
+  Node *arg = call->args;
+  while (arg) {
+    Node *next = arg->next;
+    arg->next = 0;
+    cur->next = new_assign(copy_var(param->var), arg);
+    cur = cur->next;
+    param = param->next;
+    arg = next;
+  }
+
+  // A value returned at the very end, with no other returns, is the value
+  // of the copy itself.
+  Node *val = 0;
+  for (Node *n = callee->node; n; n = n->next) {
+    if (n->next || n->kind != ND_RETURN) {
+      cur->next = copy_node(n);
+      cur = cur->next;
+    } else if (n->lhs && ret_ty->kind != TY_VOID && !jumps_to_join) {
+      val = new_cast(copy_node(n->lhs), ret_ty);
+    } else {
+      cur->next = copy_return(n, 1);
+      cur = cur->next;
+    }
+  }
+
+  if (jumps_to_join) {
+    Node *label = new_node(ND_LABEL, call->tok);
+    label->label_name = join_label;
+    label->lhs = new_node(ND_NULL, call->tok);
+    cur->next = label;
+    cur = cur->next;
+  }
+
+  if (!val && ret_var) {
+    val = new_var_node(ret_var, call->tok);
+  } else if (!val) {
+    val = new_node(ND_NUM, call->tok);
+    val->ty = ret_ty;
+  }
+  cur->next = val;
+
+  Node *node = new_node(ND_STMT_EXPR, call->tok);
+  node->body = head.next;
+  node->ty = ret_ty;
+
+  free(old_vars);
+  free(new_vars);
+  return node;
+}
+
+static _Bool can_inline(Node *call, Function *callee) {
+  if (call->ty->kind == TY_STRUCT)
+    return 0;
+
+  VarList *param = callee->params;
+  for (Node *arg = call->args; arg; arg = arg->next) {
+    if (!param)
+      return 0;
+    param = param->next;
+  }
+  return !param;
+}
+
+static void inline_calls(Node *node) {
+  for (; node; node = node->next) {
+    inline_calls(node->lhs);
+    inline_calls(node->rhs);
+    inline_calls(node->cond);
+    inline_calls(node->then);
+    inline_calls(node->els);
+    inline_calls(node->init);
+    inline_calls(node->inc);
+    inline_calls(node->body);
+    inline_calls(node->args);
+
+    if (node->kind != ND_FUNCALL)
+      continue;
+    Function *callee = find_inline(node->funcname);
+    if (!callee || !can_inline(node, callee))
+      continue;
+
+    Node *next = node->next;
+    memcpy(node, inline_call(node, callee), sizeof(Node));
+    node->next = next;
+  }
+}
+
+static int count_nodes(Node *node) {
+  int n = 0;
+  for (; node; node = node->next) {
+    n += 1 + count_nodes(node->lhs) + count_nodes(node->rhs) +
+         count_nodes(node->cond) + count_nodes(node->then) +
+         count_nodes(node->els) + count_nodes(node->init) +
+         count_nodes(node->inc) + count_nodes(node->body) +
+         count_nodes(node->args);
+    if (n > max_nodes)
+      return n;
+  }
+  return n;
+}
+
+static _Bool calls(Node *node, char *name) {
+  for (; node; node = node->next) {
+    if (node->kind == ND_FUNCALL && !strcmp(node->funcname, name))
+      return 1;
+    if (calls(node->lhs, name) || calls(node->rhs, name) ||
+        calls(node->cond, name) || calls(node->then, name) ||
+        calls(node->els, name) || calls(node->init, name) ||
+        calls(node->inc, name) || calls(node->body, name) ||
+        calls(node->args, name))
+      return 1;
+  }
+  return 0;
+}
+
+static _Bool is_candidate(Function *fn) {
+  if (fn->has_varargs || count_nodes(fn->node) > max_nodes ||
+      calls(fn->node, fn->name))
+    return 0;
+  for (VarList *vl = fn->params; vl; vl = vl->next)
+    if (vl->var->ty->kind == TY_STRUCT)
+      return 0;
+  return 1;
+}
+
+// Inlines the calls in a function definition spanning tokens from begin to
+// end, and then makes the function itself available for inlining if it
+// qualifies.
+void inline_function(Function *fn, Token *begin, Token *end) {
+  if (no_inline)
+    return;
+
+  caller = fn;
+  nsites = 0;
+  inline_calls(fn->node);
+
+  if (!may_inline(begin, end) || !is_candidate(fn))
+    return;
+  candidates = realloc(candidates, sizeof(Function *) * (ncandidates + 1));
+  candidates[ncandidates++] = fn;
+}
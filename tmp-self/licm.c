@@ -0,0 +1,1444 @@
+typedef struct FILE FILE;
+typedef long size_t;
+struct timespec {
+  long tv_sec;
+  long tv_nsec;
+};
+struct rusage {
+  long ru_utime[2];
+  long ru_stime[2];
+  long ru_maxrss;
+  long ru_rest[13];
+};
+extern FILE *stdout;
+extern FILE *stderr;
+
+void *malloc(long size);
+void *calloc(long nmemb, long size);
+int *__errno_location();
+char *strerror(int errnum);
+FILE *fopen(char *pathname, char *mode);
+long fread(void *ptr, long size, long nmemb, FILE *stream);
+int feof(FILE *stream);
+static void assert() {}
+int strcmp(char *s1, char *s2);
+int printf(char *fmt, ...);
+int sprintf(char *buf, char *fmt, ...);
+long strlen(char *p);
+int strncmp(char *p, char *q);
+void *memcpy(char *dst, char *src, long n);
+char *strndup(char *p, long n);
+int isspace(int c);
+char *strstr(char *haystack, char *needle);
+long strtol(char *nptr, char **endptr, int base);
+int memcmp(char *s1, char *s2, long n);
+int fprintf(FILE *fp, char *fmt, ...);
+int fputs(char *s, FILE *fp);
+long fwrite(void *ptr, long size, long nmemb, FILE *stream);
+int fclose(FILE *fp);
+int fseek(FILE *fp, long offset, int whence);
+long ftell(FILE *fp);
+FILE *open_memstream(char **ptr, size_t *sizeloc);
+int rename(char *oldpath, char *newpath);
+int mkdir(char *pathname, int mode);
+int getpid(void);
+int clock_gettime(int clockid, struct timespec *tp);
+int getrusage(int who, struct rusage *usage);
+void *realloc(void *ptr, long size);
+void free(void *ptr);
+void *memset(void *s, int c, long n);
+int open(char *pathname, int flags, ...);
+int close(int fd);
+long write(int fd, void *buf, long count);
+int ftruncate(int fd, long length);
+void *mmap(void *addr, long length, int prot, int flags, int fd, long offset);
+int munmap(void *addr, long length);
+void *mremap(void *old_address, long old_size, long new_size, int flags);
+int mprotect(void *addr, long len, int prot);
+void *dlopen(char *filename, int flags);
+void *dlsym(void *handle, char *symbol);
+char *dlerror(void);
+char *strchr(char *s, int c);
+void *bsearch(void *key, void *base, long nmemb, long size, void *compar);
+extern char **environ;
+int pipe(int *pipefd);
+int fork(void);
+int waitpid(int pid, int *wstatus, int options);
+long read(int fd, void *buf, long count);
+void _exit(int status);
+void exit(int status);
+void *memmove(void *dest, void *src, long n);
+
+typedef struct {
+  int gp_offset;
+  int fp_offset;
+  void *overflow_arg_area;
+  void *reg_save_area;
+} __va_elem;
+
+typedef __va_elem va_list[1];
+
+static void va_end(__va_elem *ap) {}
+
+typedef struct Type Type;
+typedef struct Member Member;
+typedef struct Initializer Initializer;
+typedef struct Program Program;
+
+// main.c
+
+typedef enum {
+  PHASE_READ,
+  PHASE_TOKENIZE,
+  PHASE_PARSE,
+  PHASE_LAYOUT,
+  PHASE_EMIT_DATA,
+  PHASE_EMIT_TEXT,
+  PHASE_DONE,
+} Phase;
+
+extern char *phase_names[];
+extern Phase current_phase;
+extern _Bool time_report;
+
+long now_ns(void);
+void enter_phase(Phase phase);
+
+// alloc.c
+
+typedef enum {
+  ALLOC_TOKEN,
+  ALLOC_NODE,
+  ALLOC_TYPE,
+  ALLOC_MEMBER,
+  ALLOC_VAR,
+  ALLOC_SCOPE,
+  ALLOC_INITIALIZER,
+  ALLOC_FUNCTION,
+  ALLOC_CODE, // Instructions and the arrays of the back end
+  ALLOC_OTHER,
+  ALLOC_NKINDS,
+} AllocKind;
+
+extern _Bool mem_report;
+
+void *allocate(AllocKind kind, long size);
+void *reallocate(AllocKind kind, void *p, long size);
+void print_mem_report(Program *prog);
+
+// tokenize.c
+
+typedef enum {
+  TK_RESERVED,
+  TK_IDENT,
+  TK_STR,
+  TK_NUM,
+  TK_EOF,
+} TokenKind;
+
+typedef struct Token Token;
+struct Token {
+  TokenKind kind;
+  Token *next;
+  long val;
+  Type *ty;
+  char *str;
+  int len;
+
+  char *contents;
+  int cont_len;
+};
+
+void error(char *fmt, ...);
+void error_at(char *loc, char *fmt, ...);
+void error_tok(Token *tok, char *fmt, ...);
+void warn_tok(Token *tok, char *fmt, ...);
+Token *peek(char *s);
+Token *consume(char *op);
+Token *consume_ident(void);
+void expect(char *op);
+char *expect_ident(void);
+_Bool at_eof(void);
+Token *tokenize(void);
+
+extern char *filename;
+extern char *user_input;
+extern Token *token;
+
+// parse.c
+
+typedef struct Var Var;
+struct Var {
+  char *name;
+  Type *ty;
+  _Bool is_local;
+
+  int offset;
+
+  _Bool is_static;
+  Initializer *initializer;
+
+  // Set by promote_vars(). A local variable in a register has no stack
+  // slot and is held by virtual register reg instead.
+  int uses;
+  _Bool addr_taken;
+  _Bool in_reg;
+  int reg;
+};
+
+typedef struct VarList VarList;
+struct VarList {
+  VarList *next;
+  Var *var;
+};
+
+typedef enum {
+  ND_ADD,
+  ND_PTR_ADD,
+  ND_SUB,
+  ND_PTR_SUB,
+  ND_PTR_DIFF,
+  ND_MUL,
+  ND_DIV,
+  ND_BITAND,
+  ND_BITOR,
+  ND_BITXOR,
+  ND_SHL,
+  ND_SHR,
+  ND_EQ,
+  ND_NE,
+  ND_LT,
+  ND_LE,
+  ND_ASSIGN,
+  ND_TERNARY,
+  ND_PRE_INC,
+  ND_PRE_DEC,
+  ND_POST_INC,
+  ND_POST_DEC,
+  ND_ADD_EQ,
+  ND_PTR_ADD_EQ,
+  ND_SUB_EQ,
+  ND_PTR_SUB_EQ,
+  ND_MUL_EQ,
+  ND_DIV_EQ,
+  ND_SHL_EQ,
+  ND_SHR_EQ,
+  ND_BITAND_EQ,
+  ND_BITOR_EQ,
+  ND_BITXOR_EQ,
+  ND_COMMA,
+  ND_MEMBER,
+  ND_ADDR,
+  ND_DEREF,
+  ND_NOT,
+  ND_BITNOT,
+  ND_LOGAND,
+  ND_LOGOR,
+  ND_RETURN,
+  ND_IF,
+  ND_WHILE,
+  ND_FOR,
+  ND_DO,
+  ND_SWITCH,
+  ND_CASE,
+  ND_BLOCK,
+  ND_BREAK,
+  ND_CONTINUE,
+  ND_GOTO,
+  ND_LABEL,
+  ND_FUNCALL,
+  ND_EXPR_STMT,
+  ND_STMT_EXPR,
+  ND_VAR,
+  ND_NUM,
+  ND_CAST,
+  ND_NULL,
+} NodeKind;
+
+typedef struct Node Node;
+struct Node {
+  NodeKind kind;
+  Node *next;
+  Type *ty;
+  Token *tok;
+
+  Node *lhs;
+  Node *rhs;
+
+  Node *cond;
+  Node *then;
+  Node *els;
+  Node *init;
+  Node *inc;
+
+  Node *body;
+
+  Member *member;
+
+  char *funcname;
+  Node *args;
+
+  char *label_name;
+
+  Node *case_next;
+  Node *default_case;
+  int case_label;
+  int case_end_label;
+
+  Var *var;
+
+  long val;
+};
+
+struct Initializer {
+  Initializer *next;
+
+  int sz;
+  long val;
+
+  char *label;
+  long addend;
+};
+
+typedef struct Function Function;
+struct Function {
+  Function *next;
+  char *name;
+  VarList *params;
+  _Bool is_static;
+  _Bool has_varargs;
+
+  Node *node;
+  VarList *locals;
+  VarList *globals;
+  int stack_size;
+  int nlabels;
+
+  char *cache_key;
+  char *cached_asm;
+
+  // -ftime-report
+  long parse_ns;
+  long gen_ns;
+  long num_nodes;
+  long num_insns;
+};
+
+struct Program {
+  VarList *globals;
+  Function *fns;
+};
+
+extern long num_nodes;
+
+Program *program(void);
+
+// typing.c
+
+typedef enum {
+  TY_VOID,
+  TY_BOOL,
+  TY_CHAR,
+  TY_SHORT,
+  TY_INT,
+  TY_LONG,
+  TY_ENUM,
+  TY_PTR,
+  TY_ARRAY,
+  TY_STRUCT,
+  TY_FUNC,
+} TypeKind;
+
+struct Type {
+  TypeKind kind;
+  int size;
+  int align;
+  _Bool is_incomplete;
+
+  Type *base;
+  int array_len;
+  Member *members;
+  Type *return_ty;
+};
+
+struct  Member {
+  Member *next;
+  Type *ty;
+  Token *tok;
+  char *name;
+  int offset;
+};
+
+extern Type *void_type;
+extern Type *bool_type;
+extern Type *char_type;
+extern Type *short_type;
+extern Type *int_type;
+extern Type *long_type;
+
+_Bool is_integer(Type *ty);
+int align_to(int n, int align);
+Type *pointer_to(Type *base);
+Type *array_of(Type *base, int size);
+Type *func_type(Type *return_ty);
+Type *enum_type(void);
+Type *struct_type(void);
+void add_type(Node *node);
+
+// sink.c
+
+// An output sink collects bytes in a large buffer. It hands them to a file
+// descriptor whenever the buffer fills up, keeps them all in memory if it
+// has no file descriptor, or writes them into an mmap'd file.
+typedef struct {
+  char *buf;
+  long len;
+  long cap;
+  int fd;
+  _Bool mapped;
+} Sink;
+
+Sink *new_fd_sink(int fd);
+Sink *new_mem_sink(void);
+Sink *new_file_sink(char *path);
+void sink_reserve(Sink *s, long n);
+void sink_write(Sink *s, char *p, long len);
+void sink_str(Sink *s, char *str);
+void sink_char(Sink *s, int c);
+void sink_int(Sink *s, long val);
+char *write_int(char *p, long val);
+void sink_le(Sink *s, long val, int size);
+void sink_align(Sink *s, int align);
+void sink_close(Sink *s);
+
+// asm.c
+
+// Registers are numbered as in the instruction encoding.
+typedef enum {
+  RAX,
+  RCX,
+  RDX,
+  RBX,
+  RSP,
+  RBP,
+  RSI,
+  RDI,
+  R8,
+  R9,
+  R10,
+  R11,
+  R12,
+  R13,
+  R14,
+  R15,
+
+  // Registers from here on are virtual. Code generation uses as many as
+  // it likes and the register allocator maps them to the ones above.
+  VREG,
+} Reg;
+
+// Condition codes are numbered as in the encoding of jcc and setcc.
+typedef enum {
+  CC_E = 4,
+  CC_NE = 5,
+  CC_A = 7,
+  CC_L = 12,
+  CC_GE = 13,
+  CC_LE = 14,
+  CC_G = 15,
+} CondCode;
+
+typedef enum {
+  OP_NONE,
+  OP_REG,   // reg
+  OP_IMM,   // val
+  OP_MEM,   // [reg+index*scale+val], or [rip+sym+val] if sym is set.
+            // There is no index if scale is 0.
+  OP_LABEL, // Local label number val, or [rip+label] for lea
+  OP_SYM,   // Symbol sym
+} OperandKind;
+
+typedef struct {
+  OperandKind kind;
+  int size;
+  int reg;
+  int index;
+  int scale;
+  long val;
+  char *sym;
+} Operand;
+
+typedef enum {
+  I_LABEL,
+  I_MOV,
+  I_MOVSX,
+  I_MOVZX,
+  I_LEA,
+  I_PUSH,
+  I_POP,
+  I_ADD,
+  I_SUB,
+  I_IMUL,
+  I_CQO,
+  I_IDIV,
+  I_IMULH, // rdx:rax = rax * dst
+  I_AND,
+  I_OR,
+  I_XOR,
+  I_SHL,
+  I_SAR,
+  I_NOT,
+  I_CMP,
+  I_SETCC,
+  I_JMP,
+  I_JCC,
+  I_CALL,
+  I_RET,
+  I_ENTRY, // Jump table entry: the offset of label dst from label src
+  I_ALIGN, // Padding to the next 16 bytes, unless that is more than 10
+} InstKind;
+
+typedef struct {
+  InstKind kind;
+  CondCode cc;
+  Operand dst;
+  Operand src;
+} Inst;
+
+// The instructions of one function. Local labels are referred to by
+// number and named only when printed.
+typedef struct {
+  Inst *insts;
+  int len;
+  int cap;
+  char **labels;
+  int nlabels;
+  int labels_cap;
+  int nregs;
+  int nvars; // Virtual registers from VREG on that hold variables
+  int args;  // Bitmap of the registers holding arguments on entry
+} Code;
+
+void print_insts(Sink *out, Code *code, int start, int end);
+void print_code(Sink *out, Code *code);
+
+// cfg.c
+
+// A basic block is the run of instructions from start to end.
+typedef struct {
+  int start;
+  int end;
+  int *succs;
+  int nsuccs;
+  int *preds;
+  int npreds;
+} Block;
+
+typedef struct {
+  Block *blocks;
+  int nblocks;
+  int *label_block; // The block each label starts, or -1
+} CFG;
+
+CFG *build_cfg(Code *code);
+void free_cfg(CFG *cfg);
+_Bool is_table(CFG *cfg, Code *code, int b);
+
+// opt.c
+
+extern int opt_level;
+extern _Bool dump_code;
+
+void run_passes(Code *code, char *funcname);
+
+// jump.c
+
+void optimize_jumps(Code *code);
+
+// peephole.c
+
+void peephole(Code *code);
+
+// licm.c
+
+void hoist_invariants(Code *code);
+
+// regalloc.c
+
+int alloc_regs(Code *code, int frame_size, _Bool *used);
+
+// elf.c
+
+typedef enum {
+  SEC_UNDEF,
+  SEC_TEXT,
+  SEC_DATA,
+  SEC_BSS,
+} SectionKind;
+
+typedef enum {
+  R_X86_64_64 = 1,
+  R_X86_64_PC32 = 2,
+  R_X86_64_PLT32 = 4,
+} RelocType;
+
+typedef struct {
+  char *name;
+  SectionKind sec;
+  long offset;
+  long size;
+  _Bool is_global;
+  int index;
+} Symbol;
+
+typedef struct {
+  SectionKind sec;
+  long offset;
+  RelocType type;
+  char *sym;
+  long addend;
+} Reloc;
+
+// Machine code and data of a translation unit, with symbols and
+// relocations referring to symbols by name.
+typedef struct {
+  Sink *text;
+  Sink *data;
+  long bss_size;
+  int data_align;
+  int bss_align;
+
+  Symbol **syms;
+  int nsyms;
+  int syms_cap;
+  Symbol **map;
+  int map_cap;
+
+  Reloc *relocs;
+  int nrelocs;
+  int relocs_cap;
+} Object;
+
+Object *new_object(void);
+Symbol *find_symbol(Object *obj, char *name);
+Symbol *obj_symbol(Object *obj, char *name, SectionKind sec, _Bool is_global);
+void obj_reloc(Object *obj, SectionKind sec, long offset, RelocType type,
+               char *sym, long addend);
+void obj_add_globals(Object *obj, VarList *globals);
+void write_object(Object *obj, Sink *out);
+
+// promote.c
+
+void promote_vars(Function *fn);
+
+// inline.c
+
+extern _Bool no_inline;
+
+_Bool may_inline(Token *begin, Token *end);
+Function *find_inline(char *name);
+void inline_function(Function *fn, Token *begin, Token *end);
+
+// encode.c
+
+void encode_code(Object *obj, Code *code);
+void align_text(Object *obj);
+
+// jit.c
+
+void jit_add_library(char *name);
+void run_object(Object *obj, int argc, char **argv);
+
+// worker.c
+
+int start_worker(int *fd);
+void finish_worker(Sink *s, int fd);
+char *wait_worker(int pid, int fd, long *len);
+
+// codegen.c
+
+extern long num_insns;
+extern int codegen_jobs;
+extern _Bool omit_frame_pointer;
+
+void codegen(Program *prog, Sink *out);
+Object *codegen_object(Program *prog);
+
+// cache.c
+
+extern char *cache_dir;
+
+char *cache_load(char *key);
+void cache_store(char *key, char *buf, long len);
+
+// Loop-invariant code motion.
+//
+// A loop often computes the same value on every iteration, such as the
+// address of the row of an array that an outer loop selects, or a global
+// that nothing in the loop stores to. This pass computes such values once,
+// before the loop is entered.
+//
+// A jump to a block that dominates it closes a loop. The loop's header is
+// the block jumped to, and its body is every block that reaches the jump
+// without passing through the header. Values are moved to the end of the
+// preheader, the single block outside the loop that leads to the header
+// and nowhere else. A block that ends with the conditional jump guarding
+// a rotated loop and falls through to the header will do too, in which
+// case values go after the jump. Loops without either are left alone.
+//
+// Only temporaries are moved, along with all the instructions that write
+// them. Those must all be in one block of the loop and must not read
+// anything that changes in it:
+//
+//   - immediates and addresses of symbols and labels,
+//   - registers that nothing in the loop writes, or temporaries that are
+//     moved out of it,
+//   - globals and stack slots that nothing in the loop may store to.
+//
+// Loads through pointers are never moved, since the pointer may only be
+// valid when the loop runs or when a condition in it holds. Loads of
+// globals and stack slots cannot fault.
+//
+// A moved value takes a register throughout the loop, and the register
+// allocator keeps it alive around the loop's jumps back. Values only move
+// while the loop leaves registers free, the most expensive first. A value
+// moved out of a loop that is nested in another may move again out of the
+// outer one, so the pass repeats as long as values move into loops.
+
+static Code *code;
+static CFG *cfg;
+
+// The block of each instruction.
+static int *inst_block;
+
+// Immediate dominator of each block, -1 for blocks that cannot be reached,
+// and the postorder numbers that the dominator computation works with.
+static int *idom;
+static int *postorder;
+
+// Is the address of any stack slot taken? If not, nothing but the
+// function's own instructions can store to its stack slots.
+static _Bool frame_escapes;
+
+// The loop being processed, the instructions from its header to its last
+// block, and what it may store to.
+static _Bool *in_loop;
+static int loop_start;
+static int loop_end;
+static _Bool has_call;
+static _Bool stores_anywhere;
+static char **stored_syms;
+static int nstored_syms;
+static long *stored_slots; // Pairs of start and end offsets from rbp
+static int nstored_slots;
+
+// The first and last instruction that mentions each virtual register. A
+// temporary that is mentioned outside the loop stays where it is.
+static int *first_use;
+static int *last_use;
+
+// The block each virtual register is written in inside the loop, -1 if
+// none, or -2 if more than one or if that block does not lead back to the
+// header, and the last instruction writing it. The registers written are
+// listed in written.
+static int *written_in;
+static int *last_write;
+static int *written;
+static int nwritten;
+
+// For each temporary written in the loop, whether it is invariant, the
+// number of instructions it saves if it moves, whether instructions that
+// stay in the loop read it, and whether it moves.
+static _Bool *invariant;
+static int *cost;
+static _Bool *used_in_loop;
+static _Bool *hoisted;
+
+// The loop each temporary was last counted in by free_regs().
+static int *seen_in;
+static int nloops;
+
+// The temporary whose instructions are being checked.
+static int cur_temp;
+
+// The preheader each instruction moves to, or -1 if it stays.
+static int *moves_to;
+
+// The moved instructions are built here and swapped with the code's own
+// array, which is then reused.
+static Inst *insts;
+static int insts_cap;
+
+static int intersect(int a, int b) {
+  while (a != b) {
+    while (postorder[a] < postorder[b])
+      a = idom[a];
+    while (postorder[b] < postorder[a])
+      b = idom[b];
+  }
+  return a;
+}
+
+// Computes immediate dominators by iterating in reverse postorder until
+// nothing changes, as described by Cooper, Harvey and Kennedy.
+static void find_dominators(void) {
+  int n = cfg->nblocks;
+  idom = reallocate(ALLOC_CODE, 0, sizeof(int) * n);
+  postorder = reallocate(ALLOC_CODE, 0, sizeof(int) * n);
+  int *order = reallocate(ALLOC_CODE, 0, sizeof(int) * n);
+  int *stack = reallocate(ALLOC_CODE, 0, sizeof(int) * n);
+  int *next = allocate(ALLOC_CODE, sizeof(int) * n);
+  _Bool *seen = allocate(ALLOC_CODE, sizeof(_Bool) * n);
+  for (int b = 0; b < n; b++) {
+    idom[b] = -1;
+    postorder[b] = -1;
+  }
+
+  int norder = 0;
+  int sp = 0;
+  stack[sp++] = 0;
+  seen[0] = 1;
+  while (sp > 0) {
+    Block *bb = &cfg->blocks[stack[sp - 1]];
+    int i = next[stack[sp - 1]]++;
+    if (i == bb->nsuccs) {
+      postorder[stack[sp - 1]] = norder;
+      order[norder++] = stack[--sp];
+      continue;
+    }
+    int s = bb->succs[i];
+    if (!seen[s]) {
+      seen[s] = 1;
+      stack[sp++] = s;
+    }
+  }
+
+  idom[0] = 0;
+  _Bool changed = 1;
+  while (changed) {
+    changed = 0;
+    for (int i = norder - 2; i >= 0; i--) {
+      int b = order[i];
+      Block *bb = &cfg->blocks[b];
+      int d = -1;
+      for (int j = 0; j < bb->npreds; j++) {
+        int p = bb->preds[j];
+        if (idom[p] < 0)
+          continue;
+        d = d < 0 ? p : intersect(p, d);
+      }
+      if (idom[b] != d) {
+        idom[b] = d;
+        changed = 1;
+      }
+    }
+  }
+
+  free(order);
+  free(stack);
+  free(next);
+  free(seen);
+}
+
+// A block's dominators are its ancestors in the depth-first search, so
+// they come later in postorder.
+static _Bool dominates(int a, int b) {
+  if (idom[b] < 0)
+    return 0;
+  while (postorder[b] < postorder[a])
+    b = idom[b];
+  return a == b;
+}
+
+// Instructions that only read their first operand.
+static _Bool reads_dst(InstKind kind) {
+  return kind == I_CMP || kind == I_IDIV || kind == I_IMULH ||
+         kind == I_PUSH || kind == I_JMP;
+}
+
+// Instructions that do nothing but compute their first operand from their
+// operands. setcc also reads the flags, so it is not one of them.
+static _Bool is_pure(InstKind kind) {
+  switch (kind) {
+  case I_MOV:
+  case I_MOVSX:
+  case I_MOVZX:
+  case I_LEA:
+  case I_ADD:
+  case I_SUB:
+  case I_IMUL:
+  case I_AND:
+  case I_OR:
+  case I_XOR:
+  case I_SHL:
+  case I_SAR:
+  case I_NOT:
+    return 1;
+  }
+  return 0;
+}
+
+static _Bool is_overwrite(InstKind kind) {
+  return kind == I_MOV || kind == I_MOVSX || kind == I_MOVZX || kind == I_LEA;
+}
+
+static _Bool is_temp(int reg) { return reg >= VREG + code->nvars; }
+
+static int written_reg(Inst *inst) {
+  if (inst->dst.kind == OP_REG && inst->dst.reg >= VREG &&
+      !reads_dst(inst->kind))
+    return inst->dst.reg;
+  return -1;
+}
+
+// Appends the virtual registers an operand mentions to regs.
+static void add_reg(int *regs, int *n, Operand *op) {
+  if ((op->kind == OP_REG || (op->kind == OP_MEM && !op->sym)) &&
+      op->reg >= VREG)
+    regs[(*n)++] = op->reg;
+  if (op->kind == OP_MEM && op->scale && op->index >= VREG)
+    regs[(*n)++] = op->index;
+}
+
+static void add_use(Operand *op, int i) {
+  int regs[2];
+  int n = 0;
+  add_reg(regs, &n, op);
+  for (int j = 0; j < n; j++) {
+    if (first_use[regs[j]] < 0)
+      first_use[regs[j]] = i;
+    last_use[regs[j]] = i;
+  }
+}
+
+static void add_store(Operand *op) {
+  if (op->sym && !op->scale) {
+    stored_syms = reallocate(ALLOC_CODE, stored_syms,
+                             sizeof(char *) * (nstored_syms + 1));
+    stored_syms[nstored_syms++] = op->sym;
+    return;
+  }
+  if (op->reg == RBP && !op->scale) {
+    stored_slots = reallocate(ALLOC_CODE, stored_slots,
+                              sizeof(long) * (nstored_slots + 1) * 2);
+    stored_slots[nstored_slots * 2] = op->val;
+    stored_slots[nstored_slots * 2 + 1] = op->val + op->size;
+    nstored_slots++;
+    return;
+  }
+  stores_anywhere = 1;
+}
+
+// Finds what the loop writes. Blocks between the header and the last
+// block that are not part of the loop, such as those that return from
+// inside it, are taken to be part of it here.
+static void scan_loop(void) {
+  has_call = 0;
+  stores_anywhere = 0;
+  nstored_syms = 0;
+  nstored_slots = 0;
+  nwritten = 0;
+
+  for (int i = loop_start; i < loop_end; i++) {
+    Inst *inst = &code->insts[i];
+    if (inst->kind == I_CALL) {
+      has_call = 1;
+      stores_anywhere = 1;
+    }
+    if (inst->dst.kind == OP_MEM && !reads_dst(inst->kind))
+      add_store(&inst->dst);
+
+    int r = written_reg(inst);
+    if (r < 0)
+      continue;
+    int b = in_loop[inst_block[i]] ? inst_block[i] : -2;
+    if (written_in[r] == -1) {
+      written_in[r] = b;
+      written[nwritten++] = r;
+    } else if (written_in[r] != b) {
+      written_in[r] = -2;
+    }
+    last_write[r] = i;
+  }
+}
+
+// May the loop store to the memory that a load reads?
+static _Bool may_be_stored(Operand *mem) {
+  if (mem->sym) {
+    if (stores_anywhere)
+      return 1;
+    for (int i = 0; i < nstored_syms; i++)
+      if (!strcmp(stored_syms[i], mem->sym))
+        return 1;
+    return 0;
+  }
+
+  if (stores_anywhere && frame_escapes)
+    return 1;
+  for (int i = 0; i < nstored_slots; i++)
+    if (stored_slots[i * 2] < mem->val + mem->size &&
+        mem->val < stored_slots[i * 2 + 1])
+      return 1;
+  return 0;
+}
+
+// Does a register read by instruction i keep its value throughout the
+// loop? A temporary moved out of the loop must be computed before i.
+static _Bool invariant_reg(int reg, int i) {
+  if (reg == cur_temp)
+    return 1;
+  if (reg < VREG)
+    return reg == RBP;
+  if (written_in[reg] == -1)
+    return 1;
+  return invariant[reg] && last_write[reg] < i;
+}
+
+static _Bool invariant_operand(Inst *inst, Operand *op, int i) {
+  switch (op->kind) {
+  case OP_IMM:
+  case OP_LABEL:
+  case OP_SYM:
+    return 1;
+  case OP_REG:
+    return invariant_reg(op->reg, i);
+  case OP_MEM:
+    if (op->scale && !invariant_reg(op->index, i))
+      return 0;
+    if (inst->kind == I_LEA)
+      return op->sym || invariant_reg(op->reg, i);
+    if (op->scale || (!op->sym && op->reg != RBP))
+      return 0;
+    return !may_be_stored(op);
+  }
+  return 0;
+}
+
+// Can the instructions writing temporary t in block b be moved out of the
+// loop? The first of them must not read t, and nothing else may read t
+// before the last of them.
+static _Bool is_invariant(int t, int b) {
+  Block *bb = &cfg->blocks[b];
+  _Bool seen = 0;
+  cur_temp = t;
+  for (int i = bb->start; i <= last_write[t]; i++) {
+    Inst *inst = &code->insts[i];
+    int regs[4];
+    int n = 0;
+    add_reg(regs, &n, &inst->dst);
+    add_reg(regs, &n, &inst->src);
+
+    if (written_reg(inst) != t) {
+      for (int j = 0; j < n; j++)
+        if (regs[j] == t)
+          return 0;
+      continue;
+    }
+
+    if (!is_pure(inst->kind) || moves_to[i] >= 0)
+      return 0;
+    if (inst->src.kind != OP_NONE && !invariant_operand(inst, &inst->src, i))
+      return 0;
+    if (!seen) {
+      if (!is_overwrite(inst->kind))
+        return 0;
+      for (int j = 1; j < n; j++)
+        if (regs[j] == t)
+          return 0;
+    }
+    seen = 1;
+  }
+  return seen;
+}
+
+// Returns the number of registers that are free throughout the loop, out
+// of the 12 that the register allocator hands out, or the 5 callee-saved
+// ones among them if the loop makes calls. Each variable takes one for the
+// whole function, and temporaries take one from their first to their last
+// mention, or throughout the loop if they are computed before it.
+static int free_regs(void) {
+  int len = loop_end - loop_start;
+  int *live = allocate(ALLOC_CODE, sizeof(int) * (len + 1));
+  nloops++;
+  for (int i = loop_start; i < loop_end; i++) {
+    int regs[4];
+    int n = 0;
+    add_reg(regs, &n, &code->insts[i].dst);
+    add_reg(regs, &n, &code->insts[i].src);
+    for (int j = 0; j < n; j++) {
+      int r = regs[j];
+      if (!is_temp(r) || seen_in[r] == nloops)
+        continue;
+      seen_in[r] = nloops;
+      if (first_use[r] < loop_start) {
+        live[0]++;
+      } else {
+        live[i - loop_start]++;
+        if (last_use[r] < loop_end)
+          live[last_use[r] - loop_start]--;
+      }
+    }
+  }
+
+  int max = 0;
+  int n = 0;
+  for (int i = 0; i < len; i++) {
+    n += live[i];
+    if (n > max)
+      max = n;
+  }
+  free(live);
+  return (has_call ? 5 : 12) - code->nvars - max;
+}
+
+// Picks the values read in the loop that move out of it. A value that is
+// moved takes a register throughout the loop, so the ones that are the
+// most expensive to compute move first, as long as registers are free.
+// Loads and wide immediates count as two instructions and moves of other
+// immediates as none, since those fit in the instructions that use them.
+// What a value is computed from moves along with it.
+static void select_values(void) {
+  for (int i = loop_start; i < loop_end; i++) {
+    Inst *inst = &code->insts[i];
+    int t = written_reg(inst);
+    int regs[4];
+    int n = 0;
+    add_reg(regs, &n, &inst->dst);
+    add_reg(regs, &n, &inst->src);
+
+    if (t < 0 || !invariant[t]) {
+      for (int j = 0; j < n; j++)
+        if (invariant[regs[j]])
+          used_in_loop[regs[j]] = 1;
+      continue;
+    }
+
+    if (inst->src.kind == OP_MEM && inst->kind != I_LEA)
+      cost[t] += 2;
+    else if (inst->kind != I_MOV || inst->src.kind != OP_IMM)
+      cost[t]++;
+    else if (inst->src.val != (int)inst->src.val)
+      cost[t] += 2;
+    for (int j = 0; j < n; j++)
+      if (regs[j] != t && invariant[regs[j]])
+        cost[t] += cost[regs[j]];
+  }
+
+  int budget = free_regs();
+  while (budget > 0) {
+    int best = -1;
+    for (int i = 0; i < nwritten; i++) {
+      int t = written[i];
+      if (invariant[t] && used_in_loop[t] && !hoisted[t] && cost[t] > 0 &&
+          (best < 0 || cost[t] > cost[best]))
+        best = t;
+    }
+    if (best < 0)
+      break;
+    hoisted[best] = 1;
+    budget--;
+  }
+}
+
+// Returns the block that values computed before the loop with the given
+// header go to, or -1 if there is none.
+static int find_preheader(int header) {
+  Block *hb = &cfg->blocks[header];
+  int pre = -1;
+  for (int i = 0; i < hb->npreds; i++) {
+    int p = hb->preds[i];
+    if (in_loop[p])
+      continue;
+    if (pre >= 0)
+      return -1;
+    pre = p;
+  }
+  if (pre < 0)
+    return -1;
+  Inst *last = &code->insts[cfg->blocks[pre].end - 1];
+  if (cfg->blocks[pre].nsuccs == 2 && last->kind == I_JCC && pre + 1 == header)
+    return pre;
+  if (cfg->blocks[pre].nsuccs != 1)
+    return -1;
+  if (last->kind == I_JMP && last->dst.kind != OP_LABEL)
+    return -1;
+  return pre;
+}
+
+// Marks the instructions that move out of the loop with the given header.
+// Returns 1 if there are any.
+static _Bool process_loop(int header) {
+  int pre = find_preheader(header);
+  if (pre < 0)
+    return 0;
+  scan_loop();
+
+  _Bool changed = 1;
+  while (changed) {
+    changed = 0;
+    for (int i = 0; i < nwritten; i++) {
+      int t = written[i];
+      if (!is_temp(t) || invariant[t] || written_in[t] < 0 ||
+          first_use[t] < loop_start || last_use[t] >= loop_end ||
+          !is_invariant(t, written_in[t]))
+        continue;
+      invariant[t] = 1;
+      changed = 1;
+    }
+  }
+
+  select_values();
+
+  _Bool found = 0;
+  for (int i = loop_end - 1; i >= loop_start; i--) {
+    Inst *inst = &code->insts[i];
+    int t = written_reg(inst);
+    if (t < 0 || !hoisted[t])
+      continue;
+    moves_to[i] = pre;
+    found = 1;
+
+    int regs[2];
+    int n = 0;
+    add_reg(regs, &n, &inst->src);
+    for (int j = 0; j < n; j++)
+      if (invariant[regs[j]])
+        hoisted[regs[j]] = 1;
+  }
+
+  for (int i = 0; i < nwritten; i++) {
+    int r = written[i];
+    written_in[r] = -1;
+    invariant[r] = 0;
+    cost[r] = 0;
+    used_in_loop[r] = 0;
+    hoisted[r] = 0;
+  }
+  return found;
+}
+
+// Collects the blocks of the loop closed by jumps from latches to header.
+// Returns the number of blocks, or 0 if the loop is not laid out between
+// its header and its last latch, which the register allocator relies on.
+static int find_loop(int header, int *stack) {
+  int n = cfg->nblocks;
+  for (int b = 0; b < n; b++)
+    in_loop[b] = 0;
+  in_loop[header] = 1;
+
+  int sp = 0;
+  int last = -1;
+  Block *hb = &cfg->blocks[header];
+  for (int i = 0; i < hb->npreds; i++) {
+    int p = hb->preds[i];
+    if (!dominates(header, p))
+      continue;
+    if (p > last)
+      last = p;
+    if (!in_loop[p]) {
+      in_loop[p] = 1;
+      stack[sp++] = p;
+    }
+  }
+  if (last < 0)
+    return 0;
+
+  while (sp > 0) {
+    Block *bb = &cfg->blocks[stack[--sp]];
+    for (int i = 0; i < bb->npreds; i++) {
+      int p = bb->preds[i];
+      if (in_loop[p] || idom[p] < 0)
+        continue;
+      in_loop[p] = 1;
+      stack[sp++] = p;
+    }
+  }
+
+  int size = 0;
+  for (int b = 0; b < n; b++) {
+    if (!in_loop[b])
+      continue;
+    if (b < header || b > last)
+      return 0;
+    size++;
+  }
+  loop_start = hb->start;
+  loop_end = cfg->blocks[last].end;
+  return size;
+}
+
+static _Bool is_header(int b) {
+  Block *bb = &cfg->blocks[b];
+  for (int i = 0; i < bb->npreds; i++)
+    if (idom[bb->preds[i]] >= 0 && dominates(b, bb->preds[i]))
+      return 1;
+  return 0;
+}
+
+// Moves the marked instructions to the end of their preheaders, before
+// the unconditional jump that ends a preheader if there is one.
+static void move_insts(void) {
+  // The instructions moving to each block are chained in order.
+  int *first = reallocate(ALLOC_CODE, 0, sizeof(int) * cfg->nblocks);
+  int *last = reallocate(ALLOC_CODE, 0, sizeof(int) * cfg->nblocks);
+  int *next = reallocate(ALLOC_CODE, 0, sizeof(int) * code->len);
+  for (int b = 0; b < cfg->nblocks; b++)
+    first[b] = -1;
+  for (int i = 0; i < code->len; i++) {
+    int b = moves_to[i];
+    if (b < 0)
+      continue;
+    next[i] = -1;
+    if (first[b] < 0)
+      first[b] = i;
+    else
+      next[last[b]] = i;
+    last[b] = i;
+  }
+
+  if (insts_cap < code->len) {
+    insts_cap = code->cap;
+    insts = reallocate(ALLOC_CODE, insts, sizeof(Inst) * insts_cap);
+  }
+  int len = 0;
+  for (int b = 0; b < cfg->nblocks; b++) {
+    Block *bb = &cfg->blocks[b];
+    int end = bb->end;
+    if (first[b] >= 0 && code->insts[end - 1].kind == I_JMP)
+      end--;
+    for (int i = bb->start; i < end; i++)
+      if (moves_to[i] < 0)
+        memcpy(&insts[len++], &code->insts[i], sizeof(Inst));
+    for (int i = first[b]; i >= 0; i = next[i])
+      memcpy(&insts[len++], &code->insts[i], sizeof(Inst));
+    if (end < bb->end)
+      memcpy(&insts[len++], &code->insts[end], sizeof(Inst));
+  }
+
+  Inst *tmp = code->insts;
+  int tmp_cap = code->cap;
+  code->insts = insts;
+  code->cap = insts_cap;
+  insts = tmp;
+  insts_cap = tmp_cap;
+  free(first);
+  free(last);
+  free(next);
+}
+
+// Moves values out of the loops found in the current code. Inner loops
+// are processed first, and an instruction only moves out of one loop at
+// a time. Returns 1 if anything moved to a block that is itself in a
+// loop.
+static _Bool hoist(void) {
+  cfg = build_cfg(code);
+  find_dominators();
+
+  int n = cfg->nblocks;
+  inst_block = reallocate(ALLOC_CODE, 0, sizeof(int) * code->len);
+  for (int b = 0; b < n; b++)
+    for (int i = cfg->blocks[b].start; i < cfg->blocks[b].end; i++)
+      inst_block[i] = b;
+  moves_to = reallocate(ALLOC_CODE, 0, sizeof(int) * code->len);
+  for (int i = 0; i < code->len; i++)
+    moves_to[i] = -1;
+  for (int r = 0; r < code->nregs; r++)
+    first_use[r] = -1;
+  for (int i = 0; i < code->len; i++) {
+    add_use(&code->insts[i].dst, i);
+    add_use(&code->insts[i].src, i);
+  }
+
+  in_loop = reallocate(ALLOC_CODE, 0, sizeof(_Bool) * n);
+  _Bool *in_any_loop = allocate(ALLOC_CODE, sizeof(_Bool) * n);
+  int *stack = reallocate(ALLOC_CODE, 0, sizeof(int) * n);
+  int *headers = reallocate(ALLOC_CODE, 0, sizeof(int) * n);
+  int *sizes = reallocate(ALLOC_CODE, 0, sizeof(int) * n);
+  int nheaders = 0;
+  for (int b = 0; b < n; b++) {
+    if (idom[b] < 0 || !is_header(b))
+      continue;
+    int size = find_loop(b, stack);
+    if (size == 0)
+      continue;
+    for (int i = 0; i < n; i++)
+      if (in_loop[i])
+        in_any_loop[i] = 1;
+
+    int i = nheaders++;
+    for (; i > 0 && sizes[i - 1] > size; i--) {
+      headers[i] = headers[i - 1];
+      sizes[i] = sizes[i - 1];
+    }
+    headers[i] = b;
+    sizes[i] = size;
+  }
+
+  _Bool found = 0;
+  for (int i = 0; i < nheaders; i++) {
+    find_loop(headers[i], stack);
+    found = process_loop(headers[i]) || found;
+  }
+
+  // Values moved to a block in another loop may move again.
+  _Bool again = 0;
+  for (int i = 0; i < code->len; i++)
+    if (moves_to[i] >= 0 && in_any_loop[moves_to[i]])
+      again = 1;
+  if (found)
+    move_insts();
+
+  free(in_loop);
+  free(in_any_loop);
+  free(stack);
+  free(headers);
+  free(sizes);
+  free(inst_block);
+  free(moves_to);
+  free(idom);
+  free(postorder);
+  free_cfg(cfg);
+  return again;
+}
+
+void hoist_invariants(Code *c) {
+  code = c;
+  if (code->len == 0)
+    return;
+
+  frame_escapes = 0;
+  for (int i = 0; i < code->len; i++) {
+    Inst *inst = &code->insts[i];
+    if (inst->kind == I_LEA && inst->src.kind == OP_MEM && !inst->src.sym &&
+        inst->src.reg == RBP)
+      frame_escapes = 1;
+  }
+
+  int n = code->nregs;
+  first_use = reallocate(ALLOC_CODE, 0, sizeof(int) * n);
+  last_use = reallocate(ALLOC_CODE, 0, sizeof(int) * n);
+  written_in = reallocate(ALLOC_CODE, 0, sizeof(int) * n);
+  last_write = reallocate(ALLOC_CODE, 0, sizeof(int) * n);
+  invariant = allocate(ALLOC_CODE, sizeof(_Bool) * n);
+  cost = allocate(ALLOC_CODE, sizeof(int) * n);
+  used_in_loop = allocate(ALLOC_CODE, sizeof(_Bool) * n);
+  hoisted = allocate(ALLOC_CODE, sizeof(_Bool) * n);
+  written = reallocate(ALLOC_CODE, 0, sizeof(int) * n);
+  seen_in = allocate(ALLOC_CODE, sizeof(int) * n);
+  for (int r = 0; r < n; r++)
+    written_in[r] = -1;
+
+  while (hoist())
+    ;
+
+  free(first_use);
+  free(last_use);
+  free(written_in);
+  free(last_write);
+  free(invariant);
+  free(cost);
+  free(used_in_loop);
+  free(hoisted);
+  free(written);
+  free(seen_in);
+}
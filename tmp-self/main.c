@@ -0,0 +1,991 @@
+typedef struct FILE FILE;
+typedef long size_t;
+struct timespec {
+  long tv_sec;
+  long tv_nsec;
+};
+struct rusage {
+  long ru_utime[2];
+  long ru_stime[2];
+  long ru_maxrss;
+  long ru_rest[13];
+};
+extern FILE *stdout;
+extern FILE *stderr;
+
+void *malloc(long size);
+void *calloc(long nmemb, long size);
+int *__errno_location();
+char *strerror(int errnum);
+FILE *fopen(char *pathname, char *mode);
+long fread(void *ptr, long size, long nmemb, FILE *stream);
+int feof(FILE *stream);
+static void assert() {}
+int strcmp(char *s1, char *s2);
+int printf(char *fmt, ...);
+int sprintf(char *buf, char *fmt, ...);
+long strlen(char *p);
+int strncmp(char *p, char *q);
+void *memcpy(char *dst, char *src, long n);
+char *strndup(char *p, long n);
+int isspace(int c);
+char *strstr(char *haystack, char *needle);
+long strtol(char *nptr, char **endptr, int base);
+int memcmp(char *s1, char *s2, long n);
+int fprintf(FILE *fp, char *fmt, ...);
+int fputs(char *s, FILE *fp);
+long fwrite(void *ptr, long size, long nmemb, FILE *stream);
+int fclose(FILE *fp);
+int fseek(FILE *fp, long offset, int whence);
+long ftell(FILE *fp);
+FILE *open_memstream(char **ptr, size_t *sizeloc);
+int rename(char *oldpath, char *newpath);
+int mkdir(char *pathname, int mode);
+int getpid(void);
+int clock_gettime(int clockid, struct timespec *tp);
+int getrusage(int who, struct rusage *usage);
+void *realloc(void *ptr, long size);
+void free(void *ptr);
+void *memset(void *s, int c, long n);
+int open(char *pathname, int flags, ...);
+int close(int fd);
+long write(int fd, void *buf, long count);
+int ftruncate(int fd, long length);
+void *mmap(void *addr, long length, int prot, int flags, int fd, long offset);
+int munmap(void *addr, long length);
+void *mremap(void *old_address, long old_size, long new_size, int flags);
+int mprotect(void *addr, long len, int prot);
+void *dlopen(char *filename, int flags);
+void *dlsym(void *handle, char *symbol);
+char *dlerror(void);
+char *strchr(char *s, int c);
+void *bsearch(void *key, void *base, long nmemb, long size, void *compar);
+extern char **environ;
+int pipe(int *pipefd);
+int fork(void);
+int waitpid(int pid, int *wstatus, int options);
+long read(int fd, void *buf, long count);
+void _exit(int status);
+void exit(int status);
+void *memmove(void *dest, void *src, long n);
+
+typedef struct {
+  int gp_offset;
+  int fp_offset;
+  void *overflow_arg_area;
+  void *reg_save_area;
+} __va_elem;
+
+typedef __va_elem va_list[1];
+
+static void va_end(__va_elem *ap) {}
+
+typedef struct Type Type;
+typedef struct Member Member;
+typedef struct Initializer Initializer;
+typedef struct Program Program;
+
+// main.c
+
+typedef enum {
+  PHASE_READ,
+  PHASE_TOKENIZE,
+  PHASE_PARSE,
+  PHASE_LAYOUT,
+  PHASE_EMIT_DATA,
+  PHASE_EMIT_TEXT,
+  PHASE_DONE,
+} Phase;
+
+extern char *phase_names[];
+extern Phase current_phase;
+extern _Bool time_report;
+
+long now_ns(void);
+void enter_phase(Phase phase);
+
+// alloc.c
+
+typedef enum {
+  ALLOC_TOKEN,
+  ALLOC_NODE,
+  ALLOC_TYPE,
+  ALLOC_MEMBER,
+  ALLOC_VAR,
+  ALLOC_SCOPE,
+  ALLOC_INITIALIZER,
+  ALLOC_FUNCTION,
+  ALLOC_CODE, // Instructions and the arrays of the back end
+  ALLOC_OTHER,
+  ALLOC_NKINDS,
+} AllocKind;
+
+extern _Bool mem_report;
+
+void *allocate(AllocKind kind, long size);
+void *reallocate(AllocKind kind, void *p, long size);
+void print_mem_report(Program *prog);
+
+// tokenize.c
+
+typedef enum {
+  TK_RESERVED,
+  TK_IDENT,
+  TK_STR,
+  TK_NUM,
+  TK_EOF,
+} TokenKind;
+
+typedef struct Token Token;
+struct Token {
+  TokenKind kind;
+  Token *next;
+  long val;
+  Type *ty;
+  char *str;
+  int len;
+
+  char *contents;
+  int cont_len;
+};
+
+void error(char *fmt, ...);
+void error_at(char *loc, char *fmt, ...);
+void error_tok(Token *tok, char *fmt, ...);
+void warn_tok(Token *tok, char *fmt, ...);
+Token *peek(char *s);
+Token *consume(char *op);
+Token *consume_ident(void);
+void expect(char *op);
+char *expect_ident(void);
+_Bool at_eof(void);
+Token *tokenize(void);
+
+extern char *filename;
+extern char *user_input;
+extern Token *token;
+
+// parse.c
+
+typedef struct Var Var;
+struct Var {
+  char *name;
+  Type *ty;
+  _Bool is_local;
+
+  int offset;
+
+  _Bool is_static;
+  Initializer *initializer;
+
+  // Set by promote_vars(). A local variable in a register has no stack
+  // slot and is held by virtual register reg instead.
+  int uses;
+  _Bool addr_taken;
+  _Bool in_reg;
+  int reg;
+};
+
+typedef struct VarList VarList;
+struct VarList {
+  VarList *next;
+  Var *var;
+};
+
+typedef enum {
+  ND_ADD,
+  ND_PTR_ADD,
+  ND_SUB,
+  ND_PTR_SUB,
+  ND_PTR_DIFF,
+  ND_MUL,
+  ND_DIV,
+  ND_BITAND,
+  ND_BITOR,
+  ND_BITXOR,
+  ND_SHL,
+  ND_SHR,
+  ND_EQ,
+  ND_NE,
+  ND_LT,
+  ND_LE,
+  ND_ASSIGN,
+  ND_TERNARY,
+  ND_PRE_INC,
+  ND_PRE_DEC,
+  ND_POST_INC,
+  ND_POST_DEC,
+  ND_ADD_EQ,
+  ND_PTR_ADD_EQ,
+  ND_SUB_EQ,
+  ND_PTR_SUB_EQ,
+  ND_MUL_EQ,
+  ND_DIV_EQ,
+  ND_SHL_EQ,
+  ND_SHR_EQ,
+  ND_BITAND_EQ,
+  ND_BITOR_EQ,
+  ND_BITXOR_EQ,
+  ND_COMMA,
+  ND_MEMBER,
+  ND_ADDR,
+  ND_DEREF,
+  ND_NOT,
+  ND_BITNOT,
+  ND_LOGAND,
+  ND_LOGOR,
+  ND_RETURN,
+  ND_IF,
+  ND_WHILE,
+  ND_FOR,
+  ND_DO,
+  ND_SWITCH,
+  ND_CASE,
+  ND_BLOCK,
+  ND_BREAK,
+  ND_CONTINUE,
+  ND_GOTO,
+  ND_LABEL,
+  ND_FUNCALL,
+  ND_EXPR_STMT,
+  ND_STMT_EXPR,
+  ND_VAR,
+  ND_NUM,
+  ND_CAST,
+  ND_NULL,
+} NodeKind;
+
+typedef struct Node Node;
+struct Node {
+  NodeKind kind;
+  Node *next;
+  Type *ty;
+  Token *tok;
+
+  Node *lhs;
+  Node *rhs;
+
+  Node *cond;
+  Node *then;
+  Node *els;
+  Node *init;
+  Node *inc;
+
+  Node *body;
+
+  Member *member;
+
+  char *funcname;
+  Node *args;
+
+  char *label_name;
+
+  Node *case_next;
+  Node *default_case;
+  int case_label;
+  int case_end_label;
+
+  Var *var;
+
+  long val;
+};
+
+struct Initializer {
+  Initializer *next;
+
+  int sz;
+  long val;
+
+  char *label;
+  long addend;
+};
+
+typedef struct Function Function;
+struct Function {
+  Function *next;
+  char *name;
+  VarList *params;
+  _Bool is_static;
+  _Bool has_varargs;
+
+  Node *node;
+  VarList *locals;
+  VarList *globals;
+  int stack_size;
+  int nlabels;
+
+  char *cache_key;
+  char *cached_asm;
+
+  // -ftime-report
+  long parse_ns;
+  long gen_ns;
+  long num_nodes;
+  long num_insns;
+};
+
+struct Program {
+  VarList *globals;
+  Function *fns;
+};
+
+extern long num_nodes;
+
+Program *program(void);
+
+// typing.c
+
+typedef enum {
+  TY_VOID,
+  TY_BOOL,
+  TY_CHAR,
+  TY_SHORT,
+  TY_INT,
+  TY_LONG,
+  TY_ENUM,
+  TY_PTR,
+  TY_ARRAY,
+  TY_STRUCT,
+  TY_FUNC,
+} TypeKind;
+
+struct Type {
+  TypeKind kind;
+  int size;
+  int align;
+  _Bool is_incomplete;
+
+  Type *base;
+  int array_len;
+  Member *members;
+  Type *return_ty;
+};
+
+struct  Member {
+  Member *next;
+  Type *ty;
+  Token *tok;
+  char *name;
+  int offset;
+};
+
+extern Type *void_type;
+extern Type *bool_type;
+extern Type *char_type;
+extern Type *short_type;
+extern Type *int_type;
+extern Type *long_type;
+
+_Bool is_integer(Type *ty);
+int align_to(int n, int align);
+Type *pointer_to(Type *base);
+Type *array_of(Type *base, int size);
+Type *func_type(Type *return_ty);
+Type *enum_type(void);
+Type *struct_type(void);
+void add_type(Node *node);
+
+// sink.c
+
+// An output sink collects bytes in a large buffer. It hands them to a file
+// descriptor whenever the buffer fills up, keeps them all in memory if it
+// has no file descriptor, or writes them into an mmap'd file.
+typedef struct {
+  char *buf;
+  long len;
+  long cap;
+  int fd;
+  _Bool mapped;
+} Sink;
+
+Sink *new_fd_sink(int fd);
+Sink *new_mem_sink(void);
+Sink *new_file_sink(char *path);
+void sink_reserve(Sink *s, long n);
+void sink_write(Sink *s, char *p, long len);
+void sink_str(Sink *s, char *str);
+void sink_char(Sink *s, int c);
+void sink_int(Sink *s, long val);
+char *write_int(char *p, long val);
+void sink_le(Sink *s, long val, int size);
+void sink_align(Sink *s, int align);
+void sink_close(Sink *s);
+
+// asm.c
+
+// Registers are numbered as in the instruction encoding.
+typedef enum {
+  RAX,
+  RCX,
+  RDX,
+  RBX,
+  RSP,
+  RBP,
+  RSI,
+  RDI,
+  R8,
+  R9,
+  R10,
+  R11,
+  R12,
+  R13,
+  R14,
+  R15,
+
+  // Registers from here on are virtual. Code generation uses as many as
+  // it likes and the register allocator maps them to the ones above.
+  VREG,
+} Reg;
+
+// Condition codes are numbered as in the encoding of jcc and setcc.
+typedef enum {
+  CC_E = 4,
+  CC_NE = 5,
+  CC_A = 7,
+  CC_L = 12,
+  CC_GE = 13,
+  CC_LE = 14,
+  CC_G = 15,
+} CondCode;
+
+typedef enum {
+  OP_NONE,
+  OP_REG,   // reg
+  OP_IMM,   // val
+  OP_MEM,   // [reg+index*scale+val], or [rip+sym+val] if sym is set.
+            // There is no index if scale is 0.
+  OP_LABEL, // Local label number val, or [rip+label] for lea
+  OP_SYM,   // Symbol sym
+} OperandKind;
+
+typedef struct {
+  OperandKind kind;
+  int size;
+  int reg;
+  int index;
+  int scale;
+  long val;
+  char *sym;
+} Operand;
+
+typedef enum {
+  I_LABEL,
+  I_MOV,
+  I_MOVSX,
+  I_MOVZX,
+  I_LEA,
+  I_PUSH,
+  I_POP,
+  I_ADD,
+  I_SUB,
+  I_IMUL,
+  I_CQO,
+  I_IDIV,
+  I_IMULH, // rdx:rax = rax * dst
+  I_AND,
+  I_OR,
+  I_XOR,
+  I_SHL,
+  I_SAR,
+  I_NOT,
+  I_CMP,
+  I_SETCC,
+  I_JMP,
+  I_JCC,
+  I_CALL,
+  I_RET,
+  I_ENTRY, // Jump table entry: the offset of label dst from label src
+  I_ALIGN, // Padding to the next 16 bytes, unless that is more than 10
+} InstKind;
+
+typedef struct {
+  InstKind kind;
+  CondCode cc;
+  Operand dst;
+  Operand src;
+} Inst;
+
+// The instructions of one function. Local labels are referred to by
+// number and named only when printed.
+typedef struct {
+  Inst *insts;
+  int len;
+  int cap;
+  char **labels;
+  int nlabels;
+  int labels_cap;
+  int nregs;
+  int nvars; // Virtual registers from VREG on that hold variables
+  int args;  // Bitmap of the registers holding arguments on entry
+} Code;
+
+void print_insts(Sink *out, Code *code, int start, int end);
+void print_code(Sink *out, Code *code);
+
+// cfg.c
+
+// A basic block is the run of instructions from start to end.
+typedef struct {
+  int start;
+  int end;
+  int *succs;
+  int nsuccs;
+  int *preds;
+  int npreds;
+} Block;
+
+typedef struct {
+  Block *blocks;
+  int nblocks;
+  int *label_block; // The block each label starts, or -1
+} CFG;
+
+CFG *build_cfg(Code *code);
+void free_cfg(CFG *cfg);
+_Bool is_table(CFG *cfg, Code *code, int b);
+
+// opt.c
+
+extern int opt_level;
+extern _Bool dump_code;
+
+void run_passes(Code *code, char *funcname);
+
+// jump.c
+
+void optimize_jumps(Code *code);
+
+// peephole.c
+
+void peephole(Code *code);
+
+// licm.c
+
+void hoist_invariants(Code *code);
+
+// regalloc.c
+
+int alloc_regs(Code *code, int frame_size, _Bool *used);
+
+// elf.c
+
+typedef enum {
+  SEC_UNDEF,
+  SEC_TEXT,
+  SEC_DATA,
+  SEC_BSS,
+} SectionKind;
+
+typedef enum {
+  R_X86_64_64 = 1,
+  R_X86_64_PC32 = 2,
+  R_X86_64_PLT32 = 4,
+} RelocType;
+
+typedef struct {
+  char *name;
+  SectionKind sec;
+  long offset;
+  long size;
+  _Bool is_global;
+  int index;
+} Symbol;
+
+typedef struct {
+  SectionKind sec;
+  long offset;
+  RelocType type;
+  char *sym;
+  long addend;
+} Reloc;
+
+// Machine code and data of a translation unit, with symbols and
+// relocations referring to symbols by name.
+typedef struct {
+  Sink *text;
+  Sink *data;
+  long bss_size;
+  int data_align;
+  int bss_align;
+
+  Symbol **syms;
+  int nsyms;
+  int syms_cap;
+  Symbol **map;
+  int map_cap;
+
+  Reloc *relocs;
+  int nrelocs;
+  int relocs_cap;
+} Object;
+
+Object *new_object(void);
+Symbol *find_symbol(Object *obj, char *name);
+Symbol *obj_symbol(Object *obj, char *name, SectionKind sec, _Bool is_global);
+void obj_reloc(Object *obj, SectionKind sec, long offset, RelocType type,
+               char *sym, long addend);
+void obj_add_globals(Object *obj, VarList *globals);
+void write_object(Object *obj, Sink *out);
+
+// promote.c
+
+void promote_vars(Function *fn);
+
+// inline.c
+
+extern _Bool no_inline;
+
+_Bool may_inline(Token *begin, Token *end);
+Function *find_inline(char *name);
+void inline_function(Function *fn, Token *begin, Token *end);
+
+// encode.c
+
+void encode_code(Object *obj, Code *code);
+void align_text(Object *obj);
+
+// jit.c
+
+void jit_add_library(char *name);
+void run_object(Object *obj, int argc, char **argv);
+
+// worker.c
+
+int start_worker(int *fd);
+void finish_worker(Sink *s, int fd);
+char *wait_worker(int pid, int fd, long *len);
+
+// codegen.c
+
+extern long num_insns;
+extern int codegen_jobs;
+extern _Bool omit_frame_pointer;
+
+void codegen(Program *prog, Sink *out);
+Object *codegen_object(Program *prog);
+
+// cache.c
+
+extern char *cache_dir;
+
+char *cache_load(char *key);
+void cache_store(char *key, char *buf, long len);
+
+_Bool time_report;
+static int time_report_fns;
+static char *output_path;
+static _Bool opt_c;
+static _Bool opt_run;
+static int run_argc;
+static char **run_argv;
+
+char *phase_names[] = {"read_file",    "tokenize",  "parse",
+                       "stack layout", "emit_data", "emit_text"};
+
+static long phase_wall[PHASE_DONE];
+static long phase_cpu[PHASE_DONE];
+Phase current_phase = PHASE_DONE;
+static long phase_wall_start;
+static long phase_cpu_start;
+
+static long clock_ns(int clock) {
+  struct timespec ts;
+  clock_gettime(clock, &ts);
+  return ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+long now_ns(void) { return clock_ns(1); }
+
+// Charges the time spent since the last call to the phase that was running
+// and starts timing the given one.
+void enter_phase(Phase phase) {
+  long wall = now_ns();
+  long cpu = clock_ns(2);
+
+  if (current_phase != PHASE_DONE) {
+    phase_wall[current_phase] += wall - phase_wall_start;
+    phase_cpu[current_phase] += cpu - phase_cpu_start;
+  }
+
+  current_phase = phase;
+  phase_wall_start = wall;
+  phase_cpu_start = cpu;
+}
+
+static char *read_file(char *path) {
+  FILE *fp = fopen(path, "r");
+  if (!fp)
+    error("cannot open %s: %s", path, strerror(*__errno_location()));
+
+  int filemax = 10 * 1024 * 1024;
+  char *buf = malloc(filemax);
+  int size = fread(buf, 1, filemax - 2, fp);
+  if (!feof(fp))
+    error("%s: file too large");
+
+  if (size == 0 || buf[size - 1] != '\n')
+    buf[size++] = '\n';
+  buf[size] = '\0';
+  return buf;
+}
+
+static char *format_secs(long ns) {
+  char *buf = malloc(30);
+  long us = ns / 1000;
+  sprintf(buf, "%ld.%06ld", us / 1000000, us - us / 1000000 * 1000000);
+  return buf;
+}
+
+static void print_count(char *name, long count, long ns) {
+  if (ns == 0)
+    ns = 1;
+  fprintf(stderr, " %-14s %10ld %12ld/s\n", name, count,
+          count * 1000000000 / ns);
+}
+
+static void print_slowest_functions(Program *prog) {
+  int nfns = 0;
+  for (Function *fn = prog->fns; fn; fn = fn->next)
+    nfns++;
+
+  // Insertion sort by total time, slowest first.
+  Function **fns = calloc(nfns, sizeof(Function *));
+  int n = 0;
+  for (Function *fn = prog->fns; fn; fn = fn->next) {
+    long t = fn->parse_ns + fn->gen_ns;
+    int i = n++;
+    for (; i > 0 && fns[i - 1]->parse_ns + fns[i - 1]->gen_ns < t; i--)
+      fns[i] = fns[i - 1];
+    fns[i] = fn;
+  }
+
+  fprintf(stderr, "\nSlowest functions (seconds)\n");
+  fprintf(stderr, " %-24s %11s %11s", "function", "parse", "codegen");
+  fprintf(stderr, " %8s %8s\n", "nodes", "insns");
+
+  for (int i = 0; i < n && i < time_report_fns; i++) {
+    Function *fn = fns[i];
+    fprintf(stderr, " %-24s %11s %11s", fn->name, format_secs(fn->parse_ns),
+            format_secs(fn->gen_ns));
+    fprintf(stderr, " %8ld %8ld\n", fn->num_nodes, fn->num_insns);
+  }
+}
+
+static void print_time_report(Program *prog, long num_tokens) {
+  fprintf(stderr, "Execution times (seconds)\n");
+  fprintf(stderr, " %-14s %11s %11s\n", "phase", "wall", "cpu");
+
+  long wall = 0;
+  long cpu = 0;
+  for (int i = 0; i < PHASE_DONE; i++) {
+    fprintf(stderr, " %-14s %11s %11s\n", phase_names[i],
+            format_secs(phase_wall[i]), format_secs(phase_cpu[i]));
+    wall += phase_wall[i];
+    cpu += phase_cpu[i];
+  }
+  fprintf(stderr, " %-14s %11s %11s\n", "TOTAL", format_secs(wall),
+          format_secs(cpu));
+
+  int nfns = 0;
+  for (Function *fn = prog->fns; fn; fn = fn->next)
+    nfns++;
+
+  fprintf(stderr, "\n %-14s %10s %14s\n", "count", "total", "rate");
+  print_count("tokens", num_tokens, phase_wall[PHASE_TOKENIZE]);
+  print_count("nodes", num_nodes, phase_wall[PHASE_PARSE]);
+  print_count("functions", nfns, phase_wall[PHASE_PARSE]);
+  print_count("instructions", num_insns, phase_wall[PHASE_EMIT_TEXT]);
+
+  if (time_report_fns > 0)
+    print_slowest_functions(prog);
+}
+
+static void parse_args(int argc, char **argv) {
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-ftime-report")) {
+      time_report = 1;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fmem-report")) {
+      mem_report = 1;
+      continue;
+    }
+
+    if (!strncmp(argv[i], "-ftime-report=", 14)) {
+      time_report = 1;
+      time_report_fns = strtol(argv[i] + 14, 0, 10);
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-c")) {
+      opt_c = 1;
+      continue;
+    }
+
+    // Arguments after the file name are passed to the program.
+    if (!strcmp(argv[i], "-run")) {
+      if (++i == argc)
+        error("-run: missing file name");
+      opt_run = 1;
+      filename = argv[i];
+      run_argc = argc - i;
+      run_argv = argv + i;
+      break;
+    }
+
+    if (!strncmp(argv[i], "-l", 2)) {
+      jit_add_library(argv[i] + 2);
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-o")) {
+      if (++i == argc)
+        error("-o: missing output file name");
+      output_path = argv[i];
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fomit-frame-pointer")) {
+      omit_frame_pointer = 1;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fno-inline")) {
+      no_inline = 1;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-O")) {
+      opt_level = 1;
+      continue;
+    }
+
+    if (!strncmp(argv[i], "-O", 2)) {
+      char *end;
+      opt_level = strtol(argv[i] + 2, &end, 10);
+      if (*end || opt_level < 0)
+        error("invalid optimization level: %s", argv[i]);
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fdump-code")) {
+      dump_code = 1;
+      continue;
+    }
+
+    if (!strncmp(argv[i], "-fcodegen-jobs=", 15)) {
+      codegen_jobs = strtol(argv[i] + 15, 0, 10);
+      continue;
+    }
+
+    if (!strncmp(argv[i], "-fcodegen-cache=", 16)) {
+      cache_dir = argv[i] + 16;
+      continue;
+    }
+
+    if (argv[i][0] == '-' && argv[i][1] != '\0')
+      error("unknown argument: %s", argv[i]);
+
+    if (filename)
+      error("%s: invalid number of arguments", argv[0]);
+    filename = argv[i];
+  }
+
+  if (!filename)
+    error("%s: invalid number of arguments", argv[0]);
+
+  // The codegen cache stores assembly, which object files cannot use.
+  if (opt_c || opt_run)
+    cache_dir = 0;
+
+  // Dumps come from the functions that are compiled, one at a time.
+  if (dump_code) {
+    cache_dir = 0;
+    codegen_jobs = 1;
+  }
+
+  // Memory that worker processes allocate would not be counted.
+  if (mem_report)
+    codegen_jobs = 1;
+
+  if (opt_level == 0)
+    no_inline = 1;
+}
+
+// Returns the name of the object file for a source file, which is the
+// source file name with its directory stripped and .c replaced with .o.
+static char *object_path(char *path) {
+  char *base = strrchr(path, '/');
+  base = base ? base + 1 : path;
+
+  int len = strlen(base);
+  if (len > 2 && !strcmp(base + len - 2, ".c"))
+    len -= 2;
+
+  char *buf = malloc(len + 3);
+  sprintf(buf, "%.*s.o", len, base);
+  return buf;
+}
+
+int main(int argc, char **argv) {
+  parse_args(argc, argv);
+
+  enter_phase(PHASE_READ);
+  user_input = read_file(filename);
+
+  enter_phase(PHASE_TOKENIZE);
+  token = tokenize();
+
+  long num_tokens = 0;
+  if (time_report)
+    for (Token *tok = token; tok; tok = tok->next)
+      num_tokens++;
+
+  enter_phase(PHASE_PARSE);
+  Program *prog = program();
+
+  enter_phase(PHASE_LAYOUT);
+  for (Function *fn = prog->fns; fn; fn = fn->next) {
+    promote_vars(fn);
+
+    int offset = fn->has_varargs ? 56 : 0;
+    for (VarList *vl = fn->locals; vl; vl = vl->next) {
+      Var *var = vl->var;
+      if (var->in_reg)
+        continue;
+      offset = align_to(offset, var->ty->align);
+      offset += var->ty->size;
+      var->offset = offset;
+    }
+    fn->stack_size = align_to(offset, 8);
+  }
+
+  if (opt_run) {
+    Object *obj = codegen_object(prog);
+    enter_phase(PHASE_DONE);
+    if (time_report)
+      print_time_report(prog, num_tokens);
+    if (mem_report)
+      print_mem_report(prog);
+    run_object(obj, run_argc, run_argv);
+  }
+
+  if (opt_c) {
+    Object *obj = codegen_object(prog);
+    Sink *out = new_file_sink(output_path ? output_path : object_path(filename));
+    write_object(obj, out);
+    sink_close(out);
+  } else {
+    Sink *out = output_path ? new_file_sink(output_path) : new_fd_sink(1);
+    codegen(prog, out);
+    sink_close(out);
+  }
+  enter_phase(PHASE_DONE);
+
+  if (time_report)
+    print_time_report(prog, num_tokens);
+  if (mem_report)
+    print_mem_report(prog);
+  return 0;
+}
@@ -0,0 +1,2557 @@
+typedef struct FILE FILE;
+typedef long size_t;
+struct timespec {
+  long tv_sec;
+  long tv_nsec;
+};
+struct rusage {
+  long ru_utime[2];
+  long ru_stime[2];
+  long ru_maxrss;
+  long ru_rest[13];
+};
+extern FILE *stdout;
+extern FILE *stderr;
+
+void *malloc(long size);
+void *calloc(long nmemb, long size);
+int *__errno_location();
+char *strerror(int errnum);
+FILE *fopen(char *pathname, char *mode);
+long fread(void *ptr, long size, long nmemb, FILE *stream);
+int feof(FILE *stream);
+static void assert() {}
+int strcmp(char *s1, char *s2);
+int printf(char *fmt, ...);
+int sprintf(char *buf, char *fmt, ...);
+long strlen(char *p);
+int strncmp(char *p, char *q);
+void *memcpy(char *dst, char *src, long n);
+char *strndup(char *p, long n);
+int isspace(int c);
+char *strstr(char *haystack, char *needle);
+long strtol(char *nptr, char **endptr, int base);
+int memcmp(char *s1, char *s2, long n);
+int fprintf(FILE *fp, char *fmt, ...);
+int fputs(char *s, FILE *fp);
+long fwrite(void *ptr, long size, long nmemb, FILE *stream);
+int fclose(FILE *fp);
+int fseek(FILE *fp, long offset, int whence);
+long ftell(FILE *fp);
+FILE *open_memstream(char **ptr, size_t *sizeloc);
+int rename(char *oldpath, char *newpath);
+int mkdir(char *pathname, int mode);
+int getpid(void);
+int clock_gettime(int clockid, struct timespec *tp);
+int getrusage(int who, struct rusage *usage);
+void *realloc(void *ptr, long size);
+void free(void *ptr);
+void *memset(void *s, int c, long n);
+int open(char *pathname, int flags, ...);
+int close(int fd);
+long write(int fd, void *buf, long count);
+int ftruncate(int fd, long length);
+void *mmap(void *addr, long length, int prot, int flags, int fd, long offset);
+int munmap(void *addr, long length);
+void *mremap(void *old_address, long old_size, long new_size, int flags);
+int mprotect(void *addr, long len, int prot);
+void *dlopen(char *filename, int flags);
+void *dlsym(void *handle, char *symbol);
+char *dlerror(void);
+char *strchr(char *s, int c);
+void *bsearch(void *key, void *base, long nmemb, long size, void *compar);
+extern char **environ;
+int pipe(int *pipefd);
+int fork(void);
+int waitpid(int pid, int *wstatus, int options);
+long read(int fd, void *buf, long count);
+void _exit(int status);
+void exit(int status);
+void *memmove(void *dest, void *src, long n);
+
+typedef struct {
+  int gp_offset;
+  int fp_offset;
+  void *overflow_arg_area;
+  void *reg_save_area;
+} __va_elem;
+
+typedef __va_elem va_list[1];
+
+static void va_end(__va_elem *ap) {}
+
+typedef struct Type Type;
+typedef struct Member Member;
+typedef struct Initializer Initializer;
+typedef struct Program Program;
+
+// main.c
+
+typedef enum {
+  PHASE_READ,
+  PHASE_TOKENIZE,
+  PHASE_PARSE,
+  PHASE_LAYOUT,
+  PHASE_EMIT_DATA,
+  PHASE_EMIT_TEXT,
+  PHASE_DONE,
+} Phase;
+
+extern char *phase_names[];
+extern Phase current_phase;
+extern _Bool time_report;
+
+long now_ns(void);
+void enter_phase(Phase phase);
+
+// alloc.c
+
+typedef enum {
+  ALLOC_TOKEN,
+  ALLOC_NODE,
+  ALLOC_TYPE,
+  ALLOC_MEMBER,
+  ALLOC_VAR,
+  ALLOC_SCOPE,
+  ALLOC_INITIALIZER,
+  ALLOC_FUNCTION,
+  ALLOC_CODE, // Instructions and the arrays of the back end
+  ALLOC_OTHER,
+  ALLOC_NKINDS,
+} AllocKind;
+
+extern _Bool mem_report;
+
+void *allocate(AllocKind kind, long size);
+void *reallocate(AllocKind kind, void *p, long size);
+void print_mem_report(Program *prog);
+
+// tokenize.c
+
+typedef enum {
+  TK_RESERVED,
+  TK_IDENT,
+  TK_STR,
+  TK_NUM,
+  TK_EOF,
+} TokenKind;
+
+typedef struct Token Token;
+struct Token {
+  TokenKind kind;
+  Token *next;
+  long val;
+  Type *ty;
+  char *str;
+  int len;
+
+  char *contents;
+  int cont_len;
+};
+
+void error(char *fmt, ...);
+void error_at(char *loc, char *fmt, ...);
+void error_tok(Token *tok, char *fmt, ...);
+void warn_tok(Token *tok, char *fmt, ...);
+Token *peek(char *s);
+Token *consume(char *op);
+Token *consume_ident(void);
+void expect(char *op);
+char *expect_ident(void);
+_Bool at_eof(void);
+Token *tokenize(void);
+
+extern char *filename;
+extern char *user_input;
+extern Token *token;
+
+// parse.c
+
+typedef struct Var Var;
+struct Var {
+  char *name;
+  Type *ty;
+  _Bool is_local;
+
+  int offset;
+
+  _Bool is_static;
+  Initializer *initializer;
+
+  // Set by promote_vars(). A local variable in a register has no stack
+  // slot and is held by virtual register reg instead.
+  int uses;
+  _Bool addr_taken;
+  _Bool in_reg;
+  int reg;
+};
+
+typedef struct VarList VarList;
+struct VarList {
+  VarList *next;
+  Var *var;
+};
+
+typedef enum {
+  ND_ADD,
+  ND_PTR_ADD,
+  ND_SUB,
+  ND_PTR_SUB,
+  ND_PTR_DIFF,
+  ND_MUL,
+  ND_DIV,
+  ND_BITAND,
+  ND_BITOR,
+  ND_BITXOR,
+  ND_SHL,
+  ND_SHR,
+  ND_EQ,
+  ND_NE,
+  ND_LT,
+  ND_LE,
+  ND_ASSIGN,
+  ND_TERNARY,
+  ND_PRE_INC,
+  ND_PRE_DEC,
+  ND_POST_INC,
+  ND_POST_DEC,
+  ND_ADD_EQ,
+  ND_PTR_ADD_EQ,
+  ND_SUB_EQ,
+  ND_PTR_SUB_EQ,
+  ND_MUL_EQ,
+  ND_DIV_EQ,
+  ND_SHL_EQ,
+  ND_SHR_EQ,
+  ND_BITAND_EQ,
+  ND_BITOR_EQ,
+  ND_BITXOR_EQ,
+  ND_COMMA,
+  ND_MEMBER,
+  ND_ADDR,
+  ND_DEREF,
+  ND_NOT,
+  ND_BITNOT,
+  ND_LOGAND,
+  ND_LOGOR,
+  ND_RETURN,
+  ND_IF,
+  ND_WHILE,
+  ND_FOR,
+  ND_DO,
+  ND_SWITCH,
+  ND_CASE,
+  ND_BLOCK,
+  ND_BREAK,
+  ND_CONTINUE,
+  ND_GOTO,
+  ND_LABEL,
+  ND_FUNCALL,
+  ND_EXPR_STMT,
+  ND_STMT_EXPR,
+  ND_VAR,
+  ND_NUM,
+  ND_CAST,
+  ND_NULL,
+} NodeKind;
+
+typedef struct Node Node;
+struct Node {
+  NodeKind kind;
+  Node *next;
+  Type *ty;
+  Token *tok;
+
+  Node *lhs;
+  Node *rhs;
+
+  Node *cond;
+  Node *then;
+  Node *els;
+  Node *init;
+  Node *inc;
+
+  Node *body;
+
+  Member *member;
+
+  char *funcname;
+  Node *args;
+
+  char *label_name;
+
+  Node *case_next;
+  Node *default_case;
+  int case_label;
+  int case_end_label;
+
+  Var *var;
+
+  long val;
+};
+
+struct Initializer {
+  Initializer *next;
+
+  int sz;
+  long val;
+
+  char *label;
+  long addend;
+};
+
+typedef struct Function Function;
+struct Function {
+  Function *next;
+  char *name;
+  VarList *params;
+  _Bool is_static;
+  _Bool has_varargs;
+
+  Node *node;
+  VarList *locals;
+  VarList *globals;
+  int stack_size;
+  int nlabels;
+
+  char *cache_key;
+  char *cached_asm;
+
+  // -ftime-report
+  long parse_ns;
+  long gen_ns;
+  long num_nodes;
+  long num_insns;
+};
+
+struct Program {
+  VarList *globals;
+  Function *fns;
+};
+
+extern long num_nodes;
+
+Program *program(void);
+
+// typing.c
+
+typedef enum {
+  TY_VOID,
+  TY_BOOL,
+  TY_CHAR,
+  TY_SHORT,
+  TY_INT,
+  TY_LONG,
+  TY_ENUM,
+  TY_PTR,
+  TY_ARRAY,
+  TY_STRUCT,
+  TY_FUNC,
+} TypeKind;
+
+struct Type {
+  TypeKind kind;
+  int size;
+  int align;
+  _Bool is_incomplete;
+
+  Type *base;
+  int array_len;
+  Member *members;
+  Type *return_ty;
+};
+
+struct  Member {
+  Member *next;
+  Type *ty;
+  Token *tok;
+  char *name;
+  int offset;
+};
+
+extern Type *void_type;
+extern Type *bool_type;
+extern Type *char_type;
+extern Type *short_type;
+extern Type *int_type;
+extern Type *long_type;
+
+_Bool is_integer(Type *ty);
+int align_to(int n, int align);
+Type *pointer_to(Type *base);
+Type *array_of(Type *base, int size);
+Type *func_type(Type *return_ty);
+Type *enum_type(void);
+Type *struct_type(void);
+void add_type(Node *node);
+
+// sink.c
+
+// An output sink collects bytes in a large buffer. It hands them to a file
+// descriptor whenever the buffer fills up, keeps them all in memory if it
+// has no file descriptor, or writes them into an mmap'd file.
+typedef struct {
+  char *buf;
+  long len;
+  long cap;
+  int fd;
+  _Bool mapped;
+} Sink;
+
+Sink *new_fd_sink(int fd);
+Sink *new_mem_sink(void);
+Sink *new_file_sink(char *path);
+void sink_reserve(Sink *s, long n);
+void sink_write(Sink *s, char *p, long len);
+void sink_str(Sink *s, char *str);
+void sink_char(Sink *s, int c);
+void sink_int(Sink *s, long val);
+char *write_int(char *p, long val);
+void sink_le(Sink *s, long val, int size);
+void sink_align(Sink *s, int align);
+void sink_close(Sink *s);
+
+// asm.c
+
+// Registers are numbered as in the instruction encoding.
+typedef enum {
+  RAX,
+  RCX,
+  RDX,
+  RBX,
+  RSP,
+  RBP,
+  RSI,
+  RDI,
+  R8,
+  R9,
+  R10,
+  R11,
+  R12,
+  R13,
+  R14,
+  R15,
+
+  // Registers from here on are virtual. Code generation uses as many as
+  // it likes and the register allocator maps them to the ones above.
+  VREG,
+} Reg;
+
+// Condition codes are numbered as in the encoding of jcc and setcc.
+typedef enum {
+  CC_E = 4,
+  CC_NE = 5,
+  CC_A = 7,
+  CC_L = 12,
+  CC_GE = 13,
+  CC_LE = 14,
+  CC_G = 15,
+} CondCode;
+
+typedef enum {
+  OP_NONE,
+  OP_REG,   // reg
+  OP_IMM,   // val
+  OP_MEM,   // [reg+index*scale+val], or [rip+sym+val] if sym is set.
+            // There is no index if scale is 0.
+  OP_LABEL, // Local label number val, or [rip+label] for lea
+  OP_SYM,   // Symbol sym
+} OperandKind;
+
+typedef struct {
+  OperandKind kind;
+  int size;
+  int reg;
+  int index;
+  int scale;
+  long val;
+  char *sym;
+} Operand;
+
+typedef enum {
+  I_LABEL,
+  I_MOV,
+  I_MOVSX,
+  I_MOVZX,
+  I_LEA,
+  I_PUSH,
+  I_POP,
+  I_ADD,
+  I_SUB,
+  I_IMUL,
+  I_CQO,
+  I_IDIV,
+  I_IMULH, // rdx:rax = rax * dst
+  I_AND,
+  I_OR,
+  I_XOR,
+  I_SHL,
+  I_SAR,
+  I_NOT,
+  I_CMP,
+  I_SETCC,
+  I_JMP,
+  I_JCC,
+  I_CALL,
+  I_RET,
+  I_ENTRY, // Jump table entry: the offset of label dst from label src
+  I_ALIGN, // Padding to the next 16 bytes, unless that is more than 10
+} InstKind;
+
+typedef struct {
+  InstKind kind;
+  CondCode cc;
+  Operand dst;
+  Operand src;
+} Inst;
+
+// The instructions of one function. Local labels are referred to by
+// number and named only when printed.
+typedef struct {
+  Inst *insts;
+  int len;
+  int cap;
+  char **labels;
+  int nlabels;
+  int labels_cap;
+  int nregs;
+  int nvars; // Virtual registers from VREG on that hold variables
+  int args;  // Bitmap of the registers holding arguments on entry
+} Code;
+
+void print_insts(Sink *out, Code *code, int start, int end);
+void print_code(Sink *out, Code *code);
+
+// cfg.c
+
+// A basic block is the run of instructions from start to end.
+typedef struct {
+  int start;
+  int end;
+  int *succs;
+  int nsuccs;
+  int *preds;
+  int npreds;
+} Block;
+
+typedef struct {
+  Block *blocks;
+  int nblocks;
+  int *label_block; // The block each label starts, or -1
+} CFG;
+
+CFG *build_cfg(Code *code);
+void free_cfg(CFG *cfg);
+_Bool is_table(CFG *cfg, Code *code, int b);
+
+// opt.c
+
+extern int opt_level;
+extern _Bool dump_code;
+
+void run_passes(Code *code, char *funcname);
+
+// jump.c
+
+void optimize_jumps(Code *code);
+
+// peephole.c
+
+void peephole(Code *code);
+
+// licm.c
+
+void hoist_invariants(Code *code);
+
+// regalloc.c
+
+int alloc_regs(Code *code, int frame_size, _Bool *used);
+
+// elf.c
+
+typedef enum {
+  SEC_UNDEF,
+  SEC_TEXT,
+  SEC_DATA,
+  SEC_BSS,
+} SectionKind;
+
+typedef enum {
+  R_X86_64_64 = 1,
+  R_X86_64_PC32 = 2,
+  R_X86_64_PLT32 = 4,
+} RelocType;
+
+typedef struct {
+  char *name;
+  SectionKind sec;
+  long offset;
+  long size;
+  _Bool is_global;
+  int index;
+} Symbol;
+
+typedef struct {
+  SectionKind sec;
+  long offset;
+  RelocType type;
+  char *sym;
+  long addend;
+} Reloc;
+
+// Machine code and data of a translation unit, with symbols and
+// relocations referring to symbols by name.
+typedef struct {
+  Sink *text;
+  Sink *data;
+  long bss_size;
+  int data_align;
+  int bss_align;
+
+  Symbol **syms;
+  int nsyms;
+  int syms_cap;
+  Symbol **map;
+  int map_cap;
+
+  Reloc *relocs;
+  int nrelocs;
+  int relocs_cap;
+} Object;
+
+Object *new_object(void);
+Symbol *find_symbol(Object *obj, char *name);
+Symbol *obj_symbol(Object *obj, char *name, SectionKind sec, _Bool is_global);
+void obj_reloc(Object *obj, SectionKind sec, long offset, RelocType type,
+               char *sym, long addend);
+void obj_add_globals(Object *obj, VarList *globals);
+void write_object(Object *obj, Sink *out);
+
+// promote.c
+
+void promote_vars(Function *fn);
+
+// inline.c
+
+extern _Bool no_inline;
+
+_Bool may_inline(Token *begin, Token *end);
+Function *find_inline(char *name);
+void inline_function(Function *fn, Token *begin, Token *end);
+
+// encode.c
+
+void encode_code(Object *obj, Code *code);
+void align_text(Object *obj);
+
+// jit.c
+
+void jit_add_library(char *name);
+void run_object(Object *obj, int argc, char **argv);
+
+// worker.c
+
+int start_worker(int *fd);
+void finish_worker(Sink *s, int fd);
+char *wait_worker(int pid, int fd, long *len);
+
+// codegen.c
+
+extern long num_insns;
+extern int codegen_jobs;
+extern _Bool omit_frame_pointer;
+
+void codegen(Program *prog, Sink *out);
+Object *codegen_object(Program *prog);
+
+// cache.c
+
+extern char *cache_dir;
+
+char *cache_load(char *key);
+void cache_store(char *key, char *buf, long len);
+
+typedef struct VarScope VarScope;
+struct VarScope {
+  VarScope *next;
+  char *name;
+  int depth;
+
+  Var *var;
+  Type *type_def;
+  Type *enum_ty;
+  int enum_val;
+};
+
+typedef struct TagScope TagScope;
+struct TagScope {
+  TagScope *next;
+  char *name;
+  int depth;
+  Type *ty;
+};
+
+typedef struct {
+  VarScope *var_scope;
+  TagScope *tag_scope;
+} Scope;
+
+long num_nodes;
+
+static VarList *locals;
+
+static VarList *globals;
+
+static VarScope *var_scope;
+static TagScope *tag_scope;
+static int scope_depth;
+
+static Node *current_switch;
+
+static Function *current_fn;
+
+static Scope *enter_scope(void) {
+  Scope *sc = allocate(ALLOC_SCOPE, sizeof(Scope));
+  sc->var_scope = var_scope;
+  sc->tag_scope = tag_scope;
+  scope_depth++;
+  return sc;
+}
+
+static void leave_scope(Scope *sc) {
+  var_scope = sc->var_scope;
+  tag_scope = sc->tag_scope;
+  scope_depth--;
+}
+
+static VarScope *find_var(Token *tok) {
+  for (VarScope *sc = var_scope; sc; sc = sc->next)
+    if (strlen(sc->name) == tok->len && !strncmp(tok->str, sc->name, tok->len))
+      return sc;
+  return 0;
+}
+
+static TagScope *find_tag(Token *tok) {
+  for (TagScope *sc = tag_scope; sc; sc = sc->next)
+    if (strlen(sc->name) == tok->len && !strncmp(tok->str, sc->name, tok->len))
+      return sc;
+  return 0;
+}
+
+static Node *new_node(NodeKind kind, Token *tok) {
+  num_nodes++;
+  Node *node = allocate(ALLOC_NODE, sizeof(Node));
+  node->kind = kind;
+  node->tok = tok;
+  return node;
+}
+
+static Node *new_binary(NodeKind kind, Node *lhs, Node *rhs, Token *tok) {
+  Node *node = new_node(kind, tok);
+  node->lhs = lhs;
+  node->rhs = rhs;
+  return node;
+}
+
+static Node *new_unary(NodeKind kind, Node *expr, Token *tok) {
+  Node *node = new_node(kind, tok);
+  node->lhs = expr;
+  return node;
+}
+
+static Node *new_num(long val, Token *tok) {
+  Node *node = new_node(ND_NUM, tok);
+  node->val = val;
+  node->ty = int_type;
+  return node;
+}
+
+static Node *new_var_node(Var *var, Token *tok) {
+  Node *node = new_node(ND_VAR, tok);
+  node->var = var;
+  return node;
+}
+
+static VarScope *push_scope(char *name) {
+  VarScope *sc = allocate(ALLOC_SCOPE, sizeof(VarScope));
+  sc->name = name;
+  sc->next = var_scope;
+  sc->depth = scope_depth;
+  var_scope = sc;
+  return sc;
+}
+
+static Var *new_var(char *name, Type *ty, _Bool is_local) {
+  Var *var = allocate(ALLOC_VAR, sizeof(Var));
+  var->name = name;
+  var->ty = ty;
+  var->is_local = is_local;
+  return var;
+}
+
+static Var *new_lvar(char *name, Type *ty) {
+  Var *var = new_var(name, ty, 1);
+  push_scope(name)->var = var;
+
+  VarList *vl = allocate(ALLOC_VAR, sizeof(VarList));
+  vl->var = var;
+  vl->next = locals;
+  locals = vl;
+  return var;
+}
+
+static Var *new_gvar(char *name, Type *ty, _Bool is_static, _Bool emit) {
+  Var *var = new_var(name, ty, 0);
+  var->is_static = is_static;
+  push_scope(name)->var = var;
+
+  if (emit) {
+    VarList *vl = allocate(ALLOC_VAR, sizeof(VarList));
+    vl->var = var;
+    vl->next = globals;
+    globals = vl;
+  }
+  return var;
+}
+
+static Type *find_typedef(Token *tok) {
+  if (tok->kind == TK_IDENT) {
+    VarScope *sc = find_var(tok);
+    if (sc)
+      return sc->type_def;
+  }
+  return 0;
+}
+
+// Labels of data defined inside a function are numbered per function so
+// that the code generated for one function does not depend on the others.
+static char *new_label(void) {
+  static int cnt = 0;
+  char *buf = malloc(40 + (current_fn ? strlen(current_fn->name) : 0));
+  if (current_fn)
+    sprintf(buf, ".L.data.%s.%d", current_fn->name, current_fn->nlabels++);
+  else
+    sprintf(buf, ".L.data.%d", cnt++);
+  return buf;
+}
+
+typedef enum {
+  TYPEDEF = 1 << 0,
+  STATIC = 1 << 1,
+  EXTERN = 1 << 2,
+} StorageClass;
+
+static Function *function(void);
+static Type *basetype(StorageClass *sclass);
+static Type *declarator(Type *ty, char **name);
+static Type *abstract_declarator(Type *ty);
+static Type *type_suffix(Type *ty);
+static Type *type_name(void);
+static Type *struct_decl(void);
+static Type *enum_specifier(void);
+static Member *struct_member(void);
+static void global_var(void);
+static Node *declaration(void);
+static _Bool is_typename(void);
+static Node *stmt(void);
+static Node *stmt2(void);
+static Node *expr(void);
+static long eval(Node *node);
+static long eval2(Node *node, Var **var);
+static long const_expr(void);
+static Node *assign(void);
+static Node *conditional(void);
+static Node *logor(void);
+static Node *logand(void);
+static Node *bitand(void);
+static Node * bitor (void);
+static Node *bitxor(void);
+static Node *equality(void);
+static Node *relational(void);
+static Node *shift(void);
+static Node *new_add(Node *lhs, Node *rhs, Token *tok);
+static Node *add(void);
+static Node *mul(void);
+static Node *cast(void);
+static Node *unary(void);
+static Node *postfix(void);
+static Node *compound_literal(void);
+static Node *primary(void);
+
+static _Bool is_function(void) {
+  Token *tok = token;
+  _Bool isfunc = 0;
+
+  StorageClass sclass;
+  Type *ty = basetype(&sclass);
+
+  if (!consume(";")) {
+    char *name = 0;
+    declarator(ty, &name);
+    isfunc = name && consume("(");
+  }
+
+  token = tok;
+  return isfunc;
+}
+
+Program *program(void) {
+  Function head = {};
+  Function *cur = &head;
+  globals = 0;
+
+  while (!at_eof()) {
+    if (is_function()) {
+      Function *fn = function();
+      if (!fn)
+        continue;
+      cur->next = fn;
+      cur = cur->next;
+      continue;
+    }
+    global_var();
+  }
+
+  Program *prog = allocate(ALLOC_OTHER, sizeof(Program));
+  prog->globals = globals;
+  prog->fns = head.next;
+  return prog;
+}
+
+static Type *basetype(StorageClass *sclass) {
+  if (!is_typename())
+    error_tok(token, "typename expected");
+
+  enum {
+    VOID = 1 << 0,
+    BOOL = 1 << 2,
+    CHAR = 1 << 4,
+    SHORT = 1 << 6,
+    INT = 1 << 8,
+    LONG = 1 << 10,
+    OTHER = 1 << 12,
+    SIGNED = 1 << 13,
+  };
+
+  Type *ty = int_type;
+  int counter = 0;
+
+  if (sclass)
+    *sclass = 0;
+
+  while (is_typename()) {
+    Token *tok = token;
+
+    if (peek("typedef") || peek("static") || peek("extern")) {
+      if (!sclass)
+        error_tok(tok, "storage class specifier is not allowed");
+
+      if (consume("typedef"))
+        *sclass |= TYPEDEF;
+      else if (consume("static"))
+        *sclass |= STATIC;
+      else if (consume("extern"))
+        *sclass |= EXTERN;
+
+      if (*sclass & (*sclass - 1))
+        error_tok(tok, "typedef, static and extern may not be used together");
+      continue;
+    }
+
+    if (!peek("void") && !peek("_Bool") && !peek("char") && !peek("short") &&
+        !peek("int") && !peek("long") && !peek("signed")) {
+      if (counter)
+        break;
+
+      if (peek("struct")) {
+        ty = struct_decl();
+      } else if (peek("enum")) {
+        ty = enum_specifier();
+      } else {
+        ty = find_typedef(token);
+        assert(ty);
+        token = token->next;
+      }
+
+      counter |= OTHER;
+      continue;
+    }
+
+    if (consume("void"))
+      counter += VOID;
+    else if (consume("_Bool"))
+      counter += BOOL;
+    else if (consume("char"))
+      counter += CHAR;
+    else if (consume("short"))
+      counter += SHORT;
+    else if (consume("int"))
+      counter += INT;
+    else if (consume("long"))
+      counter += LONG;
+    else if (consume("signed"))
+      counter |= SIGNED;
+
+    switch (counter) {
+    case VOID:
+      ty = void_type;
+      break;
+    case BOOL:
+      ty = bool_type;
+      break;
+    case CHAR:
+    case SIGNED + CHAR:
+      ty = char_type;
+      break;
+    case SHORT:
+    case SHORT + INT:
+    case SIGNED + SHORT:
+    case SIGNED + SHORT + INT:
+      ty = short_type;
+      break;
+    case INT:
+    case SIGNED:
+    case SIGNED + INT:
+      ty = int_type;
+      break;
+    case LONG:
+    case LONG + INT:
+    case LONG + LONG:
+    case LONG + LONG + INT:
+    case SIGNED + LONG:
+    case SIGNED + LONG + INT:
+    case SIGNED + LONG + LONG:
+    case SIGNED + LONG + LONG + INT:
+      ty = long_type;
+      break;
+    default:
+      error_tok(tok, "invalid type");
+    }
+  }
+
+  return ty;
+}
+
+static Type *declarator(Type *ty, char **name) {
+  while (consume("*"))
+    ty = pointer_to(ty);
+
+  if (consume("(")) {
+    Type *placeholder = allocate(ALLOC_TYPE, sizeof(Type));
+    Type *new_ty = declarator(placeholder, name);
+    expect(")");
+    memcpy(placeholder, type_suffix(ty), sizeof(Type));
+    return new_ty;
+  }
+
+  *name = expect_ident();
+  return type_suffix(ty);
+}
+
+static Type *abstract_declarator(Type *ty) {
+  while (consume("*"))
+    ty = pointer_to(ty);
+
+  if (consume("(")) {
+    Type *placeholder = allocate(ALLOC_TYPE, sizeof(Type));
+    Type *new_ty = abstract_declarator(placeholder);
+    expect(")");
+    memcpy(placeholder, type_suffix(ty), sizeof(Type));
+    return new_ty;
+  }
+  return type_suffix(ty);
+}
+
+static Type *type_suffix(Type *ty) {
+  if (!consume("["))
+    return ty;
+
+  int sz = 0;
+  _Bool is_incomplete = 1;
+  if (!consume("]")) {
+    sz = const_expr();
+    is_incomplete = 0;
+    expect("]");
+  }
+
+  Token *tok = token;
+  ty = type_suffix(ty);
+  if (ty->is_incomplete)
+    error_tok(tok, "incomplete element type");
+
+  ty = array_of(ty, sz);
+  ty->is_incomplete = is_incomplete;
+  return ty;
+}
+
+static Type *type_name(void) {
+  Type *ty = basetype(0);
+  ty = abstract_declarator(ty);
+  return type_suffix(ty);
+}
+
+static void push_tag_scope(Token *tok, Type *ty) {
+  TagScope *sc = allocate(ALLOC_SCOPE, sizeof(TagScope));
+  sc->next = tag_scope;
+  sc->name = strndup(tok->str, tok->len);
+  sc->depth = scope_depth;
+  sc->ty = ty;
+  tag_scope = sc;
+}
+
+static Type *struct_decl(void) {
+  expect("struct");
+  Token *tag = consume_ident();
+  if (tag && !peek("{")) {
+    TagScope *sc = find_tag(tag);
+
+    if (!sc) {
+      Type *ty = struct_type();
+      push_tag_scope(tag, ty);
+      return ty;
+    }
+
+    if (sc->ty->kind != TY_STRUCT)
+      error_tok(tag, "not a struct tag");
+    return sc->ty;
+  }
+
+  if (!consume("{"))
+    return struct_type();
+
+  Type *ty;
+
+  TagScope *sc = 0;
+  if (tag)
+    sc = find_tag(tag);
+
+  if (sc && sc->depth == scope_depth) {
+    if (sc->ty->kind != TY_STRUCT)
+      error_tok(tag, "not a struct tag");
+    ty = sc->ty;
+  } else {
+    ty = struct_type();
+    if (tag)
+      push_tag_scope(tag, ty);
+  }
+
+  Member head = {};
+  Member *cur = &head;
+
+  while (!consume("}")) {
+    cur->next = struct_member();
+    cur = cur->next;
+  }
+
+  ty->members = head.next;
+
+  int offset = 0;
+  for (Member *mem = ty->members; mem; mem = mem->next) {
+    if (mem->ty->is_incomplete)
+      error_tok(mem->tok, "incomplete struct member");
+
+    offset = align_to(offset, mem->ty->align);
+    mem->offset = offset;
+    offset += mem->ty->size;
+
+    if (ty->align < mem->ty->align)
+      ty->align = mem->ty->align;
+  }
+  ty->size = align_to(offset, ty->align);
+
+  ty->is_incomplete = 0;
+  return ty;
+}
+
+static _Bool consume_end(void) {
+  Token *tok = token;
+  if (consume("}") || (consume(",") && consume("}")))
+    return 1;
+  token = tok;
+  return 0;
+}
+
+static _Bool peek_end(void) {
+  Token *tok = token;
+  _Bool ret = consume("}") || (consume(",") && consume("}"));
+  token = tok;
+  return ret;
+}
+
+static void expect_end(void) {
+  if (!consume_end())
+    expect("}");
+}
+
+static Type *enum_specifier(void) {
+  expect("enum");
+  Type *ty = enum_type();
+
+  Token *tag = consume_ident();
+  if (tag && !peek("{")) {
+    TagScope *sc = find_tag(tag);
+    if (!sc)
+      error_tok(tag, "unknown enum type");
+    if (sc->ty->kind != TY_ENUM)
+      error_tok(tag, "not an enum tag");
+    return sc->ty;
+  }
+
+  expect("{");
+
+  int cnt = 0;
+  for (;;) {
+    char *name = expect_ident();
+    if (consume("="))
+      cnt = const_expr();
+
+    VarScope *sc = push_scope(name);
+    sc->enum_ty = ty;
+    sc->enum_val = cnt++;
+
+    if (consume_end())
+      break;
+    expect(",");
+  }
+
+  if (tag)
+    push_tag_scope(tag, ty);
+  return ty;
+}
+
+static Member *struct_member(void) {
+  Type *ty = basetype(0);
+  Token *tok = token;
+  char *name = 0;
+  ty = declarator(ty, &name);
+  ty = type_suffix(ty);
+  expect(";");
+
+  Member *mem = allocate(ALLOC_MEMBER, sizeof(Member));
+  mem->name = name;
+  mem->ty = ty;
+  mem->tok = tok;
+  return mem;
+}
+
+static VarList *read_func_param(void) {
+  Type *ty = basetype(0);
+  char *name = 0;
+  ty = declarator(ty, &name);
+  ty = type_suffix(ty);
+
+  if (ty->kind == TY_ARRAY)
+    ty = pointer_to(ty->base);
+
+  VarList *vl = allocate(ALLOC_VAR, sizeof(VarList));
+  vl->var = new_lvar(name, ty);
+  return vl;
+}
+
+static void read_func_params(Function *fn) {
+  if (consume(")"))
+    return;
+
+  Token *tok = token;
+  if (consume("void") && consume(")"))
+    return;
+  token = tok;
+
+  fn->params = read_func_param();
+  VarList *cur = fn->params;
+
+  while (!consume(")")) {
+    expect(",");
+
+    if (consume("...")) {
+      fn->has_varargs = 1;
+      expect(")");
+      return;
+    }
+
+    cur->next = read_func_param();
+    cur = cur->next;
+  }
+}
+
+typedef struct Layout Layout;
+struct Layout {
+  Layout *next;
+  Type *ty;
+  int id;
+};
+
+// Prints everything about a type that code generation depends on. Each
+// type is spelled out once; later references to it, including recursive
+// ones, print its number.
+static void print_layout(FILE *fp, Type *ty, Layout **seen) {
+  for (Layout *l = *seen; l; l = l->next) {
+    if (l->ty == ty) {
+      fprintf(fp, "#%d", l->id);
+      return;
+    }
+  }
+
+  Layout *l = allocate(ALLOC_OTHER, sizeof(Layout));
+  l->ty = ty;
+  l->id = *seen ? (*seen)->id + 1 : 0;
+  l->next = *seen;
+  *seen = l;
+
+  fprintf(fp, "(%d %d %d", ty->kind, ty->size, ty->align);
+  fprintf(fp, " %d %d", ty->array_len, ty->is_incomplete);
+  if (ty->base)
+    print_layout(fp, ty->base, seen);
+  if (ty->return_ty)
+    print_layout(fp, ty->return_ty, seen);
+  for (Member *mem = ty->members; mem; mem = mem->next) {
+    fprintf(fp, " %s@%d", mem->name, mem->offset);
+    print_layout(fp, mem->ty, seen);
+  }
+  fprintf(fp, ")");
+}
+
+typedef struct Ident Ident;
+struct Ident {
+  Ident *next;
+  Token *tok;
+};
+
+static _Bool seen_ident(Ident **seen, Token *tok) {
+  for (Ident *id = *seen; id; id = id->next)
+    if (id->tok->len == tok->len && !strncmp(id->tok->str, tok->str, tok->len))
+      return 1;
+
+  Ident *id = allocate(ALLOC_OTHER, sizeof(Ident));
+  id->tok = tok;
+  id->next = *seen;
+  *seen = id;
+  return 0;
+}
+
+// Returns the cache key of a function definition spanning tokens from begin
+// to end. The key consists of the tokens themselves followed by what each
+// identifier in them refers to in the enclosing scope, so a change to a
+// global, a typedef or a struct used by the function invalidates its entry.
+static char *fingerprint(Token *begin, Token *end) {
+  char *buf;
+  size_t buflen;
+  FILE *fp = open_memstream(&buf, &buflen);
+  Layout *seen = 0;
+  Ident *idents = 0;
+
+  // Bump the version whenever codegen changes the assembly it emits.
+  fprintf(fp, "ccc-codegen-19 %d %d\n", omit_frame_pointer, opt_level);
+  for (Token *t = begin; t != end->next; t = t->next)
+    fprintf(fp, " %.*s", t->len, t->str);
+  fprintf(fp, "\n");
+
+  for (Token *t = begin; t != end->next; t = t->next) {
+    if (t->kind != TK_IDENT || seen_ident(&idents, t))
+      continue;
+
+    fprintf(fp, "%.*s:", t->len, t->str);
+
+    VarScope *sc = find_var(t);
+    if (!sc) {
+      fprintf(fp, " ?");
+    } else if (sc->var && sc->var->is_local) {
+      fprintf(fp, " local");
+    } else if (sc->var) {
+      fprintf(fp, " var %d ", sc->var->is_static);
+      print_layout(fp, sc->var->ty, &seen);
+
+      // The code of an inlined function becomes part of the caller's.
+      Function *callee = 0;
+      if (sc->var->ty->kind == TY_FUNC)
+        callee = find_inline(strndup(t->str, t->len));
+      if (callee)
+        fprintf(fp, " inline {%s}", callee->cache_key);
+    } else if (sc->type_def) {
+      fprintf(fp, " typedef ");
+      print_layout(fp, sc->type_def, &seen);
+    } else if (sc->enum_ty) {
+      fprintf(fp, " enum %d", sc->enum_val);
+    }
+
+    TagScope *tag = find_tag(t);
+    if (tag) {
+      fprintf(fp, " tag ");
+      print_layout(fp, tag->ty, &seen);
+    }
+    fprintf(fp, "\n");
+  }
+
+  fclose(fp);
+  return buf;
+}
+
+// Returns the closing brace of the function body starting at the current
+// token.
+static Token *body_end(void) {
+  int depth = 0;
+  for (Token *t = token; t->kind != TK_EOF; t = t->next) {
+    if (t->kind != TK_RESERVED || t->len != 1)
+      continue;
+    if (*t->str == '{')
+      depth++;
+    else if (*t->str == '}' && --depth == 0)
+      return t;
+  }
+  error_tok(token, "unclosed function body");
+}
+
+static Function *function(void) {
+  locals = 0;
+
+  Token *begin = token;
+  StorageClass sclass;
+  Type *ty = basetype(&sclass);
+  char *name = 0;
+  ty = declarator(ty, &name);
+
+  new_gvar(name, func_type(ty), 0, 0);
+
+  Function *fn = allocate(ALLOC_FUNCTION, sizeof(Function));
+  fn->name = name;
+  fn->is_static = (sclass == STATIC);
+  expect("(");
+
+  Scope *sc = enter_scope();
+  read_func_params(fn);
+
+  if (consume(";")) {
+    leave_scope(sc);
+    return 0;
+  }
+
+  if (cache_dir) {
+    Token *end = body_end();
+    fn->cache_key = fingerprint(begin, end);
+    fn->cached_asm = cache_load(fn->cache_key);
+
+    // Callers need the body of a function that may be inlined, so it is
+    // parsed even if its code is cached.
+    if (fn->cached_asm && !may_inline(begin, end->next)) {
+      token = end->next;
+      leave_scope(sc);
+      return fn;
+    }
+  }
+
+  VarList *outer_globals = globals;
+  current_fn = fn;
+  long start = time_report ? now_ns() : 0;
+  long nodes = num_nodes;
+
+  Node head = {};
+  Node *cur = &head;
+  expect("{");
+  while (!consume("}")) {
+    cur->next = stmt();
+    cur = cur->next;
+  }
+  leave_scope(sc);
+  current_fn = 0;
+
+  fn->node = head.next;
+  fn->locals = locals;
+  inline_function(fn, begin, token);
+  if (time_report) {
+    fn->parse_ns = now_ns() - start;
+    fn->num_nodes = num_nodes - nodes;
+  }
+
+  // Static local variables and string literals are emitted along with the
+  // function that defines them.
+  if (globals != outer_globals) {
+    fn->globals = globals;
+    VarList *vl = globals;
+    while (vl->next != outer_globals)
+      vl = vl->next;
+    vl->next = 0;
+    globals = outer_globals;
+  }
+  return fn;
+}
+
+static Initializer *new_init_val(Initializer *cur, int sz, int val) {
+  Initializer *init = allocate(ALLOC_INITIALIZER, sizeof(Initializer));
+  init->sz = sz;
+  init->val = val;
+  cur->next = init;
+  return init;
+}
+
+static Initializer *new_init_label(Initializer *cur, char *label, long addend) {
+  Initializer *init = allocate(ALLOC_INITIALIZER, sizeof(Initializer));
+  init->label = label;
+  init->addend = addend;
+  cur->next = init;
+  return init;
+}
+
+static Initializer *new_init_zero(Initializer *cur, int nbytes) {
+  for (int i = 0; i < nbytes; i++)
+    cur = new_init_val(cur, 1, 0);
+  return cur;
+}
+
+static Initializer *gvar_init_string(char *p, int len) {
+  Initializer head = {};
+  Initializer *cur = &head;
+  for (int i = 0; i < len; i++)
+    cur = new_init_val(cur, 1, p[i]);
+  return head.next;
+}
+
+static Initializer *emit_struct_padding(Initializer *cur, Type *parent,
+                                        Member *mem) {
+  int start = mem->offset + mem->ty->size;
+  int end = mem->next ? mem->next->offset : parent->size;
+  return new_init_zero(cur, end - start);
+}
+
+static void skip_excess_elements2(void) {
+  for (;;) {
+    if (consume("{"))
+      skip_excess_elements2();
+    else
+      assign();
+
+    if (consume_end())
+      return;
+    expect(",");
+  }
+}
+
+static void skip_excess_elements(void) {
+  expect(",");
+  warn_tok(token, "excess elements in initializer");
+  skip_excess_elements2();
+}
+
+static Initializer *gvar_initializer2(Initializer *cur, Type *ty) {
+  Token *tok = token;
+
+  if (ty->kind == TY_ARRAY && ty->base->kind == TY_CHAR &&
+      token->kind == TK_STR) {
+    token = token->next;
+
+    if (ty->is_incomplete) {
+      ty->size = tok->cont_len;
+      ty->array_len = tok->cont_len;
+      ty->is_incomplete = 0;
+    }
+
+    int len = (ty->array_len < tok->cont_len) ? ty->array_len : tok->cont_len;
+
+    for (int i = 0; i < len; i++)
+      cur = new_init_val(cur, 1, tok->contents[i]);
+    return new_init_zero(cur, ty->array_len - len);
+  }
+
+  if (ty->kind == TY_ARRAY) {
+    _Bool open = consume("{");
+    int i = 0;
+    int limit = ty->is_incomplete ? 2147483647 : ty->array_len;
+
+    if (!peek("}")) {
+      do {
+        cur = gvar_initializer2(cur, ty->base);
+        i++;
+      } while (i < limit && !peek_end() && consume(","));
+    }
+
+    if (open && !consume_end())
+      skip_excess_elements();
+
+    cur = new_init_zero(cur, ty->base->size * (ty->array_len - i));
+
+    if (ty->is_incomplete) {
+      ty->size = ty->base->size * i;
+      ty->array_len = i;
+      ty->is_incomplete = 0;
+    }
+    return cur;
+  }
+
+  if (ty->kind == TY_STRUCT) {
+    _Bool open = consume("{");
+    Member *mem = ty->members;
+
+    if (!peek("}")) {
+      do {
+        cur = gvar_initializer2(cur, mem->ty);
+        cur = emit_struct_padding(cur, ty, mem);
+        mem = mem->next;
+      } while (mem && !peek_end() && consume(","));
+    }
+
+    if (open && !consume_end())
+      skip_excess_elements();
+
+    if (mem)
+      cur = new_init_zero(cur, ty->size - mem->offset);
+    return cur;
+  }
+
+  _Bool open = consume("{");
+  Node *expr = conditional();
+  if (open)
+    expect_end();
+
+  Var *var = 0;
+  long addend = eval2(expr, &var);
+
+  if (var) {
+    int scale =
+        (var->ty->kind == TY_ARRAY) ? var->ty->base->size : var->ty->size;
+    return new_init_label(cur, var->name, addend * scale);
+  }
+
+  return new_init_val(cur, ty->size, addend);
+}
+
+static Initializer *gvar_initializer(Type *ty) {
+  Initializer head = {};
+  gvar_initializer2(&head, ty);
+  return head.next;
+}
+
+static void global_var(void) {
+  StorageClass sclass;
+  Type *ty = basetype(&sclass);
+  if (consume(";"))
+    return;
+
+  char *name = 0;
+  Token *tok = token;
+  ty = declarator(ty, &name);
+  ty = type_suffix(ty);
+
+  if (sclass == TYPEDEF) {
+    expect(";");
+    push_scope(name)->type_def = ty;
+    return;
+  }
+
+  Var *var = new_gvar(name, ty, sclass == STATIC, sclass != EXTERN);
+
+  if (sclass == EXTERN) {
+    expect(";");
+    return;
+  }
+
+  if (consume("=")) {
+    var->initializer = gvar_initializer(ty);
+    expect(";");
+    return;
+  }
+
+  if (ty->is_incomplete)
+    error_tok(tok, "incomplete type");
+  expect(";");
+}
+
+typedef struct Designator Designator;
+struct Designator {
+  Designator *next;
+  int idx;
+  Member *mem;
+};
+
+static Node *new_desg_node2(Var *var, Designator *desg, Token *tok) {
+  if (!desg)
+    return new_var_node(var, tok);
+
+  Node *node = new_desg_node2(var, desg->next, tok);
+
+  if (desg->mem) {
+    node = new_unary(ND_MEMBER, node, desg->mem->tok);
+    node->member = desg->mem;
+    return node;
+  }
+
+  node = new_add(node, new_num(desg->idx, tok), tok);
+  return new_unary(ND_DEREF, node, tok);
+}
+
+static Node *new_desg_node(Var *var, Designator *desg, Node *rhs) {
+  Node *lhs = new_desg_node2(var, desg, rhs->tok);
+  Node *node = new_binary(ND_ASSIGN, lhs, rhs, rhs->tok);
+  return new_unary(ND_EXPR_STMT, node, rhs->tok);
+}
+
+static Node *lvar_init_zero(Node *cur, Var *var, Type *ty, Designator *desg) {
+  if (ty->kind == TY_ARRAY) {
+    for (int i = 0; i < ty->array_len; i++) {
+      Designator desg2 = {desg, i++};
+      cur = lvar_init_zero(cur, var, ty->base, &desg2);
+    }
+    return cur;
+  }
+
+  cur->next = new_desg_node(var, desg, new_num(0, token));
+  return cur->next;
+}
+
+static Node *lvar_initializer2(Node *cur, Var *var, Type *ty,
+                               Designator *desg) {
+  if (ty->kind == TY_ARRAY && ty->base->kind == TY_CHAR &&
+      token->kind == TK_STR) {
+    Token *tok = token;
+    token = token->next;
+
+    if (ty->is_incomplete) {
+      ty->size = tok->cont_len;
+      ty->array_len = tok->cont_len;
+      ty->is_incomplete = 0;
+    }
+
+    int len = (ty->array_len < tok->cont_len) ? ty->array_len : tok->cont_len;
+
+    for (int i = 0; i < len; i++) {
+      Designator desg2 = {desg, i};
+      Node *rhs = new_num(tok->contents[i], tok);
+      cur->next = new_desg_node(var, &desg2, rhs);
+      cur = cur->next;
+    }
+
+    for (int i = len; i < ty->array_len; i++) {
+      Designator desg2 = {desg, i};
+      cur = lvar_init_zero(cur, var, ty->base, &desg2);
+    }
+    return cur;
+  }
+
+  if (ty->kind == TY_ARRAY) {
+    _Bool open = consume("{");
+    int i = 0;
+    int limit = ty->is_incomplete ? 2147483647 : ty->array_len;
+
+    if (!peek("}")) {
+      do {
+        Designator desg2 = {desg, i++};
+        cur = lvar_initializer2(cur, var, ty->base, &desg2);
+      } while (i < limit && !peek_end() && consume(","));
+    }
+
+    if (open && !consume_end())
+      skip_excess_elements();
+
+    while (i < ty->array_len) {
+      Designator desg2 = {desg, i++};
+      cur = lvar_init_zero(cur, var, ty->base, &desg2);
+    }
+
+    if (ty->is_incomplete) {
+      ty->size = ty->base->size * i;
+      ty->array_len = i;
+      ty->is_incomplete = 0;
+    }
+    return cur;
+  }
+
+  if (ty->kind == TY_STRUCT) {
+    _Bool open = consume("{");
+    Member *mem = ty->members;
+
+    if (!peek("}")) {
+      do {
+        Designator desg2 = {desg, 0, mem};
+        cur = lvar_initializer2(cur, var, mem->ty, &desg2);
+        mem = mem->next;
+      } while (mem && !peek_end() && consume(","));
+    }
+
+    if (open && !consume_end())
+      skip_excess_elements();
+
+    for (; mem; mem = mem->next) {
+      Designator desg2 = {desg, 0, mem};
+      cur = lvar_init_zero(cur, var, mem->ty, &desg2);
+    }
+    return cur;
+  }
+
+  _Bool open = consume("{");
+  cur->next = new_desg_node(var, desg, assign());
+  if (open)
+    expect_end();
+  return cur->next;
+}
+
+static Node *lvar_initializer(Var *var, Token *tok) {
+  Node head = {};
+  lvar_initializer2(&head, var, var->ty, 0);
+
+  Node *node = new_node(ND_BLOCK, tok);
+  node->body = head.next;
+  return node;
+}
+
+static Node *declaration(void) {
+  Token *tok = token;
+  StorageClass sclass;
+  Type *ty = basetype(&sclass);
+  if (tok = consume(";"))
+    return new_node(ND_NULL, tok);
+
+  tok = token;
+  char *name = 0;
+  ty = declarator(ty, &name);
+  ty = type_suffix(ty);
+
+  if (sclass == TYPEDEF) {
+    expect(";");
+    push_scope(name)->type_def = ty;
+    return new_node(ND_NULL, tok);
+  }
+
+  if (ty->kind == TY_VOID)
+    error_tok(tok, "variable declared void");
+
+  if (sclass == STATIC) {
+    Var *var = new_gvar(new_label(), ty, 1, 1);
+    push_scope(name)->var = var;
+
+    if (consume("="))
+      var->initializer = gvar_initializer(ty);
+    else if (ty->is_incomplete)
+      error_tok(tok, "incomplete type");
+    consume(";");
+    return new_node(ND_NULL, tok);
+  }
+
+  Var *var = new_lvar(name, ty);
+
+  if (consume(";")) {
+    if (ty->is_incomplete)
+      error_tok(tok, "incomplete type");
+    return new_node(ND_NULL, tok);
+  }
+
+  expect("=");
+
+  Node *node = lvar_initializer(var, tok);
+  expect(";");
+  return node;
+}
+
+static Node *read_expr_stmt(void) {
+  Token *tok = token;
+  return new_unary(ND_EXPR_STMT, expr(), tok);
+}
+
+static _Bool is_typename(void) {
+  return peek("void") || peek("_Bool") || peek("char") || peek("short") ||
+         peek("int") || peek("long") || peek("enum") || peek("struct") ||
+         peek("typedef") || peek("static") || peek("extern") ||
+         peek("signed") || find_typedef(token);
+}
+
+static Node *stmt(void) {
+  Node *node = stmt2();
+  add_type(node);
+  return node;
+}
+
+static Node *stmt2(void) {
+  Token *tok;
+  if (tok = consume("return")) {
+    if (consume(";"))
+      return new_node(ND_RETURN, tok);
+
+    Node *node = new_unary(ND_RETURN, expr(), tok);
+    expect(";");
+    return node;
+  }
+
+  if (tok = consume("if")) {
+    Node *node = new_node(ND_IF, tok);
+    expect("(");
+    node->cond = expr();
+    expect(")");
+    node->then = stmt();
+    if (consume("else"))
+      node->els = stmt();
+    return node;
+  }
+
+  if (tok = consume("switch")) {
+    Node *node = new_node(ND_SWITCH, tok);
+    expect("(");
+    node->cond = expr();
+    add_type(node->cond);
+    expect(")");
+
+    Node *sw = current_switch;
+    current_switch = node;
+    node->then = stmt();
+    current_switch = sw;
+    return node;
+  }
+
+  if (tok = consume("case")) {
+    if (!current_switch)
+      error_tok(tok, "stray case");
+    // Case values are converted to the type of the controlling expression,
+    // which is at least int after the usual promotions.
+    long val = const_expr();
+    if (current_switch->cond->ty->size < 8)
+      val = (int)val;
+    expect(":");
+
+    Node *node = new_unary(ND_CASE, stmt(), tok);
+    for (Node *n = current_switch->case_next; n; n = n->case_next)
+      if (n->val == val)
+        error_tok(tok, "duplicate case value");
+    node->val = val;
+    node->case_next = current_switch->case_next;
+    current_switch->case_next = node;
+    return node;
+  }
+
+  if (tok = consume("default")) {
+    if (!current_switch)
+      error_tok(tok, "stray default");
+    expect(":");
+
+    Node *node = new_unary(ND_CASE, stmt(), tok);
+    current_switch->default_case = node;
+    return node;
+  }
+
+  if (tok = consume("while")) {
+    Node *node = new_node(ND_WHILE, tok);
+    expect("(");
+    node->cond = expr();
+    expect(")");
+    node->then = stmt();
+    return node;
+  }
+
+  if (tok = consume("for")) {
+    Node *node = new_node(ND_FOR, tok);
+    expect("(");
+    Scope *sc = enter_scope();
+
+    if (!consume(";")) {
+      if (is_typename()) {
+        node->init = declaration();
+      } else {
+        node->init = read_expr_stmt();
+        expect(";");
+      }
+    }
+    if (!consume(";")) {
+      node->cond = expr();
+      expect(";");
+    }
+    if (!consume(")")) {
+      node->inc = read_expr_stmt();
+      expect(")");
+    }
+    node->then = stmt();
+
+    leave_scope(sc);
+    return node;
+  }
+
+  if (tok = consume("do")) {
+    Node *node = new_node(ND_DO, tok);
+    node->then = stmt();
+    expect("while");
+    expect("(");
+    node->cond = expr();
+    expect(")");
+    expect(";");
+    return node;
+  }
+
+  if (tok = consume("{")) {
+    Node head = {};
+    Node *cur = &head;
+
+    Scope *sc = enter_scope();
+    while (!consume("}")) {
+      cur->next = stmt();
+      cur = cur->next;
+    }
+    leave_scope(sc);
+
+    Node *node = new_node(ND_BLOCK, tok);
+    node->body = head.next;
+    return node;
+  }
+
+  if (tok = consume("break")) {
+    expect(";");
+    return new_node(ND_BREAK, tok);
+  }
+
+  if (tok = consume("continue")) {
+    expect(";");
+    return new_node(ND_CONTINUE, tok);
+  }
+
+  if (tok = consume("goto")) {
+    Node *node = new_node(ND_GOTO, tok);
+    node->label_name = expect_ident();
+    expect(";");
+    return node;
+  }
+
+  if (tok = consume(";"))
+    return new_node(ND_NULL, tok);
+
+  if (tok = consume_ident()) {
+    if (consume(":")) {
+      Node *node = new_unary(ND_LABEL, stmt(), tok);
+      node->label_name = strndup(tok->str, tok->len);
+      return node;
+    }
+    token = tok;
+  }
+
+  if (is_typename())
+    return declaration();
+
+  Node *node = read_expr_stmt();
+  expect(";");
+  return node;
+}
+
+static Node *expr(void) {
+  Node *node = assign();
+  Token *tok;
+  while (tok = consume(",")) {
+    node = new_unary(ND_EXPR_STMT, node, node->tok);
+    node = new_binary(ND_COMMA, node, assign(), tok);
+  }
+  return node;
+}
+
+static long eval(Node *node) { return eval2(node, 0); }
+
+static long eval2(Node *node, Var **var) {
+  switch (node->kind) {
+  case ND_ADD:
+    return eval(node->lhs) + eval(node->rhs);
+  case ND_PTR_ADD:
+    return eval2(node->lhs, var) + eval(node->rhs);
+  case ND_SUB:
+    return eval(node->lhs) - eval(node->rhs);
+  case ND_PTR_SUB:
+    return eval2(node->lhs, var) - eval(node->rhs);
+  case ND_PTR_DIFF:
+    return eval2(node->lhs, var) - eval2(node->rhs, var);
+  case ND_MUL:
+    return eval(node->lhs) * eval(node->rhs);
+  case ND_DIV:
+    return eval(node->lhs) / eval(node->rhs);
+  case ND_BITAND:
+    return eval(node->lhs) & eval(node->rhs);
+  case ND_BITOR:
+    return eval(node->lhs) | eval(node->rhs);
+  case ND_BITXOR:
+    return eval(node->lhs) | eval(node->rhs);
+  case ND_SHL:
+    return eval(node->lhs) << eval(node->rhs);
+  case ND_SHR:
+    return eval(node->lhs) >> eval(node->rhs);
+  case ND_EQ:
+    return eval(node->lhs) == eval(node->rhs);
+  case ND_NE:
+    return eval(node->lhs) != eval(node->rhs);
+  case ND_LT:
+    return eval(node->lhs) < eval(node->rhs);
+  case ND_LE:
+    return eval(node->lhs) <= eval(node->rhs);
+  case ND_TERNARY:
+    return eval(node->cond) ? eval(node->then) : eval(node->els);
+  case ND_COMMA:
+    return eval(node->rhs);
+  case ND_NOT:
+    return !eval(node->lhs);
+  case ND_BITNOT:
+    return ~eval(node->lhs);
+  case ND_LOGAND:
+    return eval(node->lhs) && eval(node->rhs);
+  case ND_LOGOR:
+    return eval(node->lhs) || eval(node->rhs);
+  case ND_NUM:
+    return node->val;
+  case ND_ADDR:
+    if (!var || *var || node->lhs->kind != ND_VAR || node->lhs->var->is_local)
+      error_tok(node->tok, "invalid initializer");
+    *var = node->lhs->var;
+    return 0;
+  case ND_VAR:
+    if (!var || *var || node->var->ty->kind != TY_ARRAY)
+      error_tok(node->tok, "invalid initializer");
+    *var = node->var;
+    return 0;
+  }
+
+  error_tok(node->tok, "not a constant expression");
+}
+
+static long const_expr(void) { return eval(conditional()); }
+
+static Node *assign(void) {
+  Node *node = conditional();
+  Token *tok;
+  if (tok = consume("="))
+    return new_binary(ND_ASSIGN, node, assign(), tok);
+
+  if (tok = consume("*="))
+    return new_binary(ND_MUL_EQ, node, assign(), tok);
+
+  if (tok = consume("/="))
+    return new_binary(ND_DIV_EQ, node, assign(), tok);
+
+  if (tok = consume("<<="))
+    return new_binary(ND_SHL_EQ, node, assign(), tok);
+
+  if (tok = consume(">>="))
+    return new_binary(ND_SHR_EQ, node, assign(), tok);
+
+  if (tok = consume("&="))
+    return new_binary(ND_BITAND_EQ, node, assign(), tok);
+
+  if (tok = consume("|="))
+    return new_binary(ND_BITOR_EQ, node, assign(), tok);
+
+  if (tok = consume("^="))
+    return new_binary(ND_BITXOR_EQ, node, assign(), tok);
+
+  if (tok = consume("+=")) {
+    add_type(node);
+    if (node->ty->base)
+      return new_binary(ND_PTR_ADD_EQ, node, assign(), tok);
+    else
+      return new_binary(ND_ADD_EQ, node, assign(), tok);
+  }
+
+  if (tok = consume("-=")) {
+    add_type(node);
+    if (node->ty->base)
+      return new_binary(ND_PTR_SUB_EQ, node, assign(), tok);
+    else
+      return new_binary(ND_SUB_EQ, node, assign(), tok);
+  }
+
+  return node;
+}
+
+static Node *conditional(void) {
+  Node *node = logor();
+  Token *tok = consume("?");
+  if (!tok)
+    return node;
+
+  Node *ternary = new_node(ND_TERNARY, tok);
+  ternary->cond = node;
+  ternary->then = expr();
+  expect(":");
+  ternary->els = conditional();
+  return ternary;
+}
+
+static Node *logor(void) {
+  Node *node = logand();
+  Token *tok;
+  while (tok = consume("||"))
+    node = new_binary(ND_LOGOR, node, logand(), tok);
+  return node;
+}
+
+static Node *logand(void) {
+  Node *node = bitor ();
+  Token *tok;
+  while (tok = consume("&&"))
+    node = new_binary(ND_LOGAND, node, bitor (), tok);
+  return node;
+}
+
+static Node * bitor (void) {
+  Node *node = bitxor();
+  Token *tok;
+  while (tok = consume("|"))
+    node = new_binary(ND_BITOR, node, bitxor(), tok);
+  return node;
+}
+
+static Node *bitxor(void) {
+  Node *node = bitand();
+  Token *tok;
+  while (tok = consume("^"))
+    node = new_binary(ND_BITXOR, node, bitxor(), tok);
+  return node;
+}
+
+static Node *bitand(void) {
+  Node *node = equality();
+  Token *tok;
+  while (tok = consume("&"))
+    node = new_binary(ND_BITAND, node, equality(), tok);
+  return node;
+}
+
+static Node *equality(void) {
+  Node *node = relational();
+  Token *tok;
+
+  for (;;) {
+    if (tok = consume("=="))
+      node = new_binary(ND_EQ, node, relational(), tok);
+    else if (tok = consume("!="))
+      node = new_binary(ND_NE, node, relational(), tok);
+    else
+      return node;
+  }
+}
+
+static Node *relational(void) {
+  Node *node = shift();
+  Token *tok;
+
+  for (;;) {
+    if (tok = consume("<"))
+      node = new_binary(ND_LT, node, shift(), tok);
+    else if (tok = consume("<="))
+      node = new_binary(ND_LE, node, shift(), tok);
+    else if (tok = consume(">"))
+      node = new_binary(ND_LT, shift(), node, tok);
+    else if (tok = consume(">="))
+      node = new_binary(ND_LE, shift(), node, tok);
+    else
+      return node;
+  }
+}
+
+static Node *shift(void) {
+  Node *node = add();
+  Token *tok;
+
+  for (;;) {
+    if (tok = consume("<<"))
+      node = new_binary(ND_SHL, node, add(), tok);
+    else if (tok = consume(">>"))
+      node = new_binary(ND_SHR, node, add(), tok);
+    else
+      return node;
+  }
+}
+
+static Node *new_add(Node *lhs, Node *rhs, Token *tok) {
+  add_type(lhs);
+  add_type(rhs);
+
+  if (is_integer(lhs->ty) && is_integer(rhs->ty))
+    return new_binary(ND_ADD, lhs, rhs, tok);
+  if (lhs->ty->base && is_integer(rhs->ty))
+    return new_binary(ND_PTR_ADD, lhs, rhs, tok);
+  if (is_integer(lhs->ty) && rhs->ty->base)
+    return new_binary(ND_PTR_ADD, rhs, lhs, tok);
+  error_tok(tok, "invalid operands");
+}
+
+static Node *new_sub(Node *lhs, Node *rhs, Token *tok) {
+  add_type(lhs);
+  add_type(rhs);
+
+  if (is_integer(lhs->ty) && is_integer(rhs->ty))
+    return new_binary(ND_SUB, lhs, rhs, tok);
+  if (lhs->ty->base && is_integer(rhs->ty))
+    return new_binary(ND_PTR_SUB, lhs, rhs, tok);
+  if (lhs->ty->base && rhs->ty->base)
+    return new_binary(ND_PTR_DIFF, lhs, rhs, tok);
+  error_tok(tok, "invalid operands");
+}
+
+static Node *add(void) {
+  Node *node = mul();
+  Token *tok;
+
+  for (;;) {
+    if (tok = consume("+"))
+      node = new_add(node, mul(), tok);
+    else if (tok = consume("-"))
+      node = new_sub(node, mul(), tok);
+    else
+      return node;
+  }
+}
+
+static Node *mul(void) {
+  Node *node = cast();
+  Token *tok;
+
+  for (;;) {
+    if (tok = consume("*"))
+      node = new_binary(ND_MUL, node, cast(), tok);
+    else if (tok = consume("/"))
+      node = new_binary(ND_DIV, node, cast(), tok);
+    else
+      return node;
+  }
+}
+
+static Node *cast(void) {
+  Token *tok = token;
+
+  if (consume("(")) {
+    if (is_typename()) {
+      Type *ty = type_name();
+      expect(")");
+      if (!consume("{")) {
+        Node *node = new_unary(ND_CAST, cast(), tok);
+        add_type(node->lhs);
+        node->ty = ty;
+        return node;
+      }
+    }
+    token = tok;
+  }
+
+  return unary();
+}
+
+static Node *unary(void) {
+  Token *tok;
+
+  if (consume("+"))
+    return cast();
+  if (tok = consume("-"))
+    return new_binary(ND_SUB, new_num(0, tok), cast(), tok);
+  if (tok = consume("&"))
+    return new_unary(ND_ADDR, cast(), tok);
+  if (tok = consume("*"))
+    return new_unary(ND_DEREF, cast(), tok);
+  if (tok = consume("!"))
+    return new_unary(ND_NOT, cast(), tok);
+  if (tok = consume("~"))
+    return new_unary(ND_BITNOT, cast(), tok);
+  if (tok = consume("++"))
+    return new_unary(ND_PRE_INC, unary(), tok);
+  if (tok = consume("--"))
+    return new_unary(ND_PRE_DEC, unary(), tok);
+  return postfix();
+}
+
+static Member *find_member(Type *ty, char *name) {
+  for (Member *mem = ty->members; mem; mem = mem->next)
+    if (!strcmp(mem->name, name))
+      return mem;
+  return 0;
+}
+
+static Node *struct_ref(Node *lhs) {
+  add_type(lhs);
+  if (lhs->ty->kind != TY_STRUCT)
+    error_tok(lhs->tok, "not a struct");
+
+  Token *tok = token;
+  Member *mem = find_member(lhs->ty, expect_ident());
+  if (!mem)
+    error_tok(tok, "no such member");
+
+  Node *node = new_unary(ND_MEMBER, lhs, tok);
+  node->member = mem;
+  return node;
+}
+
+static Node *postfix(void) {
+  Token *tok;
+
+  Node *node = compound_literal();
+  if (node)
+    return node;
+
+  node = primary();
+
+  for (;;) {
+    if (tok = consume("[")) {
+      Node *exp = new_add(node, expr(), tok);
+      expect("]");
+      node = new_unary(ND_DEREF, exp, tok);
+      continue;
+    }
+
+    if (tok = consume(".")) {
+      node = struct_ref(node);
+      continue;
+    }
+
+    if (tok = consume("->")) {
+      node = new_unary(ND_DEREF, node, tok);
+      node = struct_ref(node);
+      continue;
+    }
+
+    if (tok = consume("++")) {
+      node = new_unary(ND_POST_INC, node, tok);
+      continue;
+    }
+
+    if (tok = consume("--")) {
+      node = new_unary(ND_POST_DEC, node, tok);
+      continue;
+    }
+
+    return node;
+  }
+}
+
+static Node *compound_literal(void) {
+  Token *tok = token;
+  if (!consume("(") || !is_typename()) {
+    token = tok;
+    return 0;
+  }
+
+  Type *ty = type_name();
+  expect(")");
+
+  if (!peek("{")) {
+    token = tok;
+    return 0;
+  }
+
+  if (scope_depth == 0) {
+    Var *var = new_gvar(new_label(), ty, 1, 1);
+    var->initializer = gvar_initializer(ty);
+    return new_var_node(var, tok);
+  }
+
+  Var *var = new_lvar(new_label(), ty);
+  Node *node = new_var_node(var, tok);
+  node->init = lvar_initializer(var, tok);
+  return node;
+}
+
+static Node *stmt_expr(Token *tok) {
+  Scope *sc = enter_scope();
+
+  Node *node = new_node(ND_STMT_EXPR, tok);
+  node->body = stmt();
+  Node *cur = node->body;
+
+  while (!consume("}")) {
+    cur->next = stmt();
+    cur = cur->next;
+  }
+  expect(")");
+
+  leave_scope(sc);
+
+  if (cur->kind != ND_EXPR_STMT)
+    error_tok(cur->tok, "stmt expr returning void is not supported");
+  memcpy(cur, cur->lhs, sizeof(Node));
+  return node;
+}
+
+static Node *func_args(void) {
+  if (consume(")"))
+    return 0;
+
+  Node *head = assign();
+  Node *cur = head;
+  while (consume(",")) {
+    cur->next = assign();
+    cur = cur->next;
+  }
+  expect(")");
+  return head;
+}
+
+static Node *primary(void) {
+  Token *tok;
+
+  if (tok = consume("(")) {
+    if (consume("{"))
+      return stmt_expr(tok);
+
+    Node *node = expr();
+    expect(")");
+    return node;
+  }
+
+  if (tok = consume("sizeof")) {
+    if (consume("(")) {
+      if (is_typename()) {
+        Type *ty = type_name();
+        if (ty->is_incomplete)
+          error_tok(tok, "incomplete type");
+        expect(")");
+        return new_num(ty->size, tok);
+      }
+      token = tok->next;
+    }
+
+    Node *node = unary();
+    add_type(node);
+    if (node->ty->is_incomplete)
+      error_tok(node->tok, "incomplete type");
+    return new_num(node->ty->size, tok);
+  }
+
+  if (tok = consume("_Alignof")) {
+    expect("(");
+    Type *ty = type_name();
+    expect(")");
+    return new_num(ty->align, tok);
+  }
+
+  if (tok = consume_ident()) {
+    if (consume("(")) {
+      Node *node = new_node(ND_FUNCALL, tok);
+      node->funcname = strndup(tok->str, tok->len);
+      node->args = func_args();
+      add_type(node);
+
+      VarScope *sc = find_var(tok);
+      if (sc) {
+        if (!sc->var || sc->var->ty->kind != TY_FUNC)
+          error_tok(tok, "not a function");
+        node->ty = sc->var->ty->return_ty;
+      } else if (!strcmp(node->funcname, "__builtin_va_start")) {
+        node->ty = void_type;
+      } else {
+        warn_tok(node->tok, "implicit declaration of a function");
+        node->ty = int_type;
+      }
+      return node;
+    }
+
+    VarScope *sc = find_var(tok);
+    if (sc) {
+      if (sc->var)
+        return new_var_node(sc->var, tok);
+      if (sc->enum_ty)
+        return new_num(sc->enum_val, tok);
+    }
+    error_tok(tok, "undefined variable");
+  }
+
+  tok = token;
+  if (tok->kind == TK_STR) {
+    token = token->next;
+
+    Type *ty = array_of(char_type, tok->cont_len);
+    Var *var = new_gvar(new_label(), ty, 1, 1);
+    var->initializer = gvar_init_string(tok->contents, tok->cont_len);
+    return new_var_node(var, tok);
+  }
+
+  if (tok->kind != TK_NUM)
+    error_tok(tok, "expected expression");
+  token = tok->next;
+
+  Node *node = new_num(tok->val, tok);
+  node->ty = tok->ty;
+  return node;
+}
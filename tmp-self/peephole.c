@@ -0,0 +1,1116 @@
+typedef struct FILE FILE;
+typedef long size_t;
+struct timespec {
+  long tv_sec;
+  long tv_nsec;
+};
+struct rusage {
+  long ru_utime[2];
+  long ru_stime[2];
+  long ru_maxrss;
+  long ru_rest[13];
+};
+extern FILE *stdout;
+extern FILE *stderr;
+
+void *malloc(long size);
+void *calloc(long nmemb, long size);
+int *__errno_location();
+char *strerror(int errnum);
+FILE *fopen(char *pathname, char *mode);
+long fread(void *ptr, long size, long nmemb, FILE *stream);
+int feof(FILE *stream);
+static void assert() {}
+int strcmp(char *s1, char *s2);
+int printf(char *fmt, ...);
+int sprintf(char *buf, char *fmt, ...);
+long strlen(char *p);
+int strncmp(char *p, char *q);
+void *memcpy(char *dst, char *src, long n);
+char *strndup(char *p, long n);
+int isspace(int c);
+char *strstr(char *haystack, char *needle);
+long strtol(char *nptr, char **endptr, int base);
+int memcmp(char *s1, char *s2, long n);
+int fprintf(FILE *fp, char *fmt, ...);
+int fputs(char *s, FILE *fp);
+long fwrite(void *ptr, long size, long nmemb, FILE *stream);
+int fclose(FILE *fp);
+int fseek(FILE *fp, long offset, int whence);
+long ftell(FILE *fp);
+FILE *open_memstream(char **ptr, size_t *sizeloc);
+int rename(char *oldpath, char *newpath);
+int mkdir(char *pathname, int mode);
+int getpid(void);
+int clock_gettime(int clockid, struct timespec *tp);
+int getrusage(int who, struct rusage *usage);
+void *realloc(void *ptr, long size);
+void free(void *ptr);
+void *memset(void *s, int c, long n);
+int open(char *pathname, int flags, ...);
+int close(int fd);
+long write(int fd, void *buf, long count);
+int ftruncate(int fd, long length);
+void *mmap(void *addr, long length, int prot, int flags, int fd, long offset);
+int munmap(void *addr, long length);
+void *mremap(void *old_address, long old_size, long new_size, int flags);
+int mprotect(void *addr, long len, int prot);
+void *dlopen(char *filename, int flags);
+void *dlsym(void *handle, char *symbol);
+char *dlerror(void);
+char *strchr(char *s, int c);
+void *bsearch(void *key, void *base, long nmemb, long size, void *compar);
+extern char **environ;
+int pipe(int *pipefd);
+int fork(void);
+int waitpid(int pid, int *wstatus, int options);
+long read(int fd, void *buf, long count);
+void _exit(int status);
+void exit(int status);
+void *memmove(void *dest, void *src, long n);
+
+typedef struct {
+  int gp_offset;
+  int fp_offset;
+  void *overflow_arg_area;
+  void *reg_save_area;
+} __va_elem;
+
+typedef __va_elem va_list[1];
+
+static void va_end(__va_elem *ap) {}
+
+typedef struct Type Type;
+typedef struct Member Member;
+typedef struct Initializer Initializer;
+typedef struct Program Program;
+
+// main.c
+
+typedef enum {
+  PHASE_READ,
+  PHASE_TOKENIZE,
+  PHASE_PARSE,
+  PHASE_LAYOUT,
+  PHASE_EMIT_DATA,
+  PHASE_EMIT_TEXT,
+  PHASE_DONE,
+} Phase;
+
+extern char *phase_names[];
+extern Phase current_phase;
+extern _Bool time_report;
+
+long now_ns(void);
+void enter_phase(Phase phase);
+
+// alloc.c
+
+typedef enum {
+  ALLOC_TOKEN,
+  ALLOC_NODE,
+  ALLOC_TYPE,
+  ALLOC_MEMBER,
+  ALLOC_VAR,
+  ALLOC_SCOPE,
+  ALLOC_INITIALIZER,
+  ALLOC_FUNCTION,
+  ALLOC_CODE, // Instructions and the arrays of the back end
+  ALLOC_OTHER,
+  ALLOC_NKINDS,
+} AllocKind;
+
+extern _Bool mem_report;
+
+void *allocate(AllocKind kind, long size);
+void *reallocate(AllocKind kind, void *p, long size);
+void print_mem_report(Program *prog);
+
+// tokenize.c
+
+typedef enum {
+  TK_RESERVED,
+  TK_IDENT,
+  TK_STR,
+  TK_NUM,
+  TK_EOF,
+} TokenKind;
+
+typedef struct Token Token;
+struct Token {
+  TokenKind kind;
+  Token *next;
+  long val;
+  Type *ty;
+  char *str;
+  int len;
+
+  char *contents;
+  int cont_len;
+};
+
+void error(char *fmt, ...);
+void error_at(char *loc, char *fmt, ...);
+void error_tok(Token *tok, char *fmt, ...);
+void warn_tok(Token *tok, char *fmt, ...);
+Token *peek(char *s);
+Token *consume(char *op);
+Token *consume_ident(void);
+void expect(char *op);
+char *expect_ident(void);
+_Bool at_eof(void);
+Token *tokenize(void);
+
+extern char *filename;
+extern char *user_input;
+extern Token *token;
+
+// parse.c
+
+typedef struct Var Var;
+struct Var {
+  char *name;
+  Type *ty;
+  _Bool is_local;
+
+  int offset;
+
+  _Bool is_static;
+  Initializer *initializer;
+
+  // Set by promote_vars(). A local variable in a register has no stack
+  // slot and is held by virtual register reg instead.
+  int uses;
+  _Bool addr_taken;
+  _Bool in_reg;
+  int reg;
+};
+
+typedef struct VarList VarList;
+struct VarList {
+  VarList *next;
+  Var *var;
+};
+
+typedef enum {
+  ND_ADD,
+  ND_PTR_ADD,
+  ND_SUB,
+  ND_PTR_SUB,
+  ND_PTR_DIFF,
+  ND_MUL,
+  ND_DIV,
+  ND_BITAND,
+  ND_BITOR,
+  ND_BITXOR,
+  ND_SHL,
+  ND_SHR,
+  ND_EQ,
+  ND_NE,
+  ND_LT,
+  ND_LE,
+  ND_ASSIGN,
+  ND_TERNARY,
+  ND_PRE_INC,
+  ND_PRE_DEC,
+  ND_POST_INC,
+  ND_POST_DEC,
+  ND_ADD_EQ,
+  ND_PTR_ADD_EQ,
+  ND_SUB_EQ,
+  ND_PTR_SUB_EQ,
+  ND_MUL_EQ,
+  ND_DIV_EQ,
+  ND_SHL_EQ,
+  ND_SHR_EQ,
+  ND_BITAND_EQ,
+  ND_BITOR_EQ,
+  ND_BITXOR_EQ,
+  ND_COMMA,
+  ND_MEMBER,
+  ND_ADDR,
+  ND_DEREF,
+  ND_NOT,
+  ND_BITNOT,
+  ND_LOGAND,
+  ND_LOGOR,
+  ND_RETURN,
+  ND_IF,
+  ND_WHILE,
+  ND_FOR,
+  ND_DO,
+  ND_SWITCH,
+  ND_CASE,
+  ND_BLOCK,
+  ND_BREAK,
+  ND_CONTINUE,
+  ND_GOTO,
+  ND_LABEL,
+  ND_FUNCALL,
+  ND_EXPR_STMT,
+  ND_STMT_EXPR,
+  ND_VAR,
+  ND_NUM,
+  ND_CAST,
+  ND_NULL,
+} NodeKind;
+
+typedef struct Node Node;
+struct Node {
+  NodeKind kind;
+  Node *next;
+  Type *ty;
+  Token *tok;
+
+  Node *lhs;
+  Node *rhs;
+
+  Node *cond;
+  Node *then;
+  Node *els;
+  Node *init;
+  Node *inc;
+
+  Node *body;
+
+  Member *member;
+
+  char *funcname;
+  Node *args;
+
+  char *label_name;
+
+  Node *case_next;
+  Node *default_case;
+  int case_label;
+  int case_end_label;
+
+  Var *var;
+
+  long val;
+};
+
+struct Initializer {
+  Initializer *next;
+
+  int sz;
+  long val;
+
+  char *label;
+  long addend;
+};
+
+typedef struct Function Function;
+struct Function {
+  Function *next;
+  char *name;
+  VarList *params;
+  _Bool is_static;
+  _Bool has_varargs;
+
+  Node *node;
+  VarList *locals;
+  VarList *globals;
+  int stack_size;
+  int nlabels;
+
+  char *cache_key;
+  char *cached_asm;
+
+  // -ftime-report
+  long parse_ns;
+  long gen_ns;
+  long num_nodes;
+  long num_insns;
+};
+
+struct Program {
+  VarList *globals;
+  Function *fns;
+};
+
+extern long num_nodes;
+
+Program *program(void);
+
+// typing.c
+
+typedef enum {
+  TY_VOID,
+  TY_BOOL,
+  TY_CHAR,
+  TY_SHORT,
+  TY_INT,
+  TY_LONG,
+  TY_ENUM,
+  TY_PTR,
+  TY_ARRAY,
+  TY_STRUCT,
+  TY_FUNC,
+} TypeKind;
+
+struct Type {
+  TypeKind kind;
+  int size;
+  int align;
+  _Bool is_incomplete;
+
+  Type *base;
+  int array_len;
+  Member *members;
+  Type *return_ty;
+};
+
+struct  Member {
+  Member *next;
+  Type *ty;
+  Token *tok;
+  char *name;
+  int offset;
+};
+
+extern Type *void_type;
+extern Type *bool_type;
+extern Type *char_type;
+extern Type *short_type;
+extern Type *int_type;
+extern Type *long_type;
+
+_Bool is_integer(Type *ty);
+int align_to(int n, int align);
+Type *pointer_to(Type *base);
+Type *array_of(Type *base, int size);
+Type *func_type(Type *return_ty);
+Type *enum_type(void);
+Type *struct_type(void);
+void add_type(Node *node);
+
+// sink.c
+
+// An output sink collects bytes in a large buffer. It hands them to a file
+// descriptor whenever the buffer fills up, keeps them all in memory if it
+// has no file descriptor, or writes them into an mmap'd file.
+typedef struct {
+  char *buf;
+  long len;
+  long cap;
+  int fd;
+  _Bool mapped;
+} Sink;
+
+Sink *new_fd_sink(int fd);
+Sink *new_mem_sink(void);
+Sink *new_file_sink(char *path);
+void sink_reserve(Sink *s, long n);
+void sink_write(Sink *s, char *p, long len);
+void sink_str(Sink *s, char *str);
+void sink_char(Sink *s, int c);
+void sink_int(Sink *s, long val);
+char *write_int(char *p, long val);
+void sink_le(Sink *s, long val, int size);
+void sink_align(Sink *s, int align);
+void sink_close(Sink *s);
+
+// asm.c
+
+// Registers are numbered as in the instruction encoding.
+typedef enum {
+  RAX,
+  RCX,
+  RDX,
+  RBX,
+  RSP,
+  RBP,
+  RSI,
+  RDI,
+  R8,
+  R9,
+  R10,
+  R11,
+  R12,
+  R13,
+  R14,
+  R15,
+
+  // Registers from here on are virtual. Code generation uses as many as
+  // it likes and the register allocator maps them to the ones above.
+  VREG,
+} Reg;
+
+// Condition codes are numbered as in the encoding of jcc and setcc.
+typedef enum {
+  CC_E = 4,
+  CC_NE = 5,
+  CC_A = 7,
+  CC_L = 12,
+  CC_GE = 13,
+  CC_LE = 14,
+  CC_G = 15,
+} CondCode;
+
+typedef enum {
+  OP_NONE,
+  OP_REG,   // reg
+  OP_IMM,   // val
+  OP_MEM,   // [reg+index*scale+val], or [rip+sym+val] if sym is set.
+            // There is no index if scale is 0.
+  OP_LABEL, // Local label number val, or [rip+label] for lea
+  OP_SYM,   // Symbol sym
+} OperandKind;
+
+typedef struct {
+  OperandKind kind;
+  int size;
+  int reg;
+  int index;
+  int scale;
+  long val;
+  char *sym;
+} Operand;
+
+typedef enum {
+  I_LABEL,
+  I_MOV,
+  I_MOVSX,
+  I_MOVZX,
+  I_LEA,
+  I_PUSH,
+  I_POP,
+  I_ADD,
+  I_SUB,
+  I_IMUL,
+  I_CQO,
+  I_IDIV,
+  I_IMULH, // rdx:rax = rax * dst
+  I_AND,
+  I_OR,
+  I_XOR,
+  I_SHL,
+  I_SAR,
+  I_NOT,
+  I_CMP,
+  I_SETCC,
+  I_JMP,
+  I_JCC,
+  I_CALL,
+  I_RET,
+  I_ENTRY, // Jump table entry: the offset of label dst from label src
+  I_ALIGN, // Padding to the next 16 bytes, unless that is more than 10
+} InstKind;
+
+typedef struct {
+  InstKind kind;
+  CondCode cc;
+  Operand dst;
+  Operand src;
+} Inst;
+
+// The instructions of one function. Local labels are referred to by
+// number and named only when printed.
+typedef struct {
+  Inst *insts;
+  int len;
+  int cap;
+  char **labels;
+  int nlabels;
+  int labels_cap;
+  int nregs;
+  int nvars; // Virtual registers from VREG on that hold variables
+  int args;  // Bitmap of the registers holding arguments on entry
+} Code;
+
+void print_insts(Sink *out, Code *code, int start, int end);
+void print_code(Sink *out, Code *code);
+
+// cfg.c
+
+// A basic block is the run of instructions from start to end.
+typedef struct {
+  int start;
+  int end;
+  int *succs;
+  int nsuccs;
+  int *preds;
+  int npreds;
+} Block;
+
+typedef struct {
+  Block *blocks;
+  int nblocks;
+  int *label_block; // The block each label starts, or -1
+} CFG;
+
+CFG *build_cfg(Code *code);
+void free_cfg(CFG *cfg);
+_Bool is_table(CFG *cfg, Code *code, int b);
+
+// opt.c
+
+extern int opt_level;
+extern _Bool dump_code;
+
+void run_passes(Code *code, char *funcname);
+
+// jump.c
+
+void optimize_jumps(Code *code);
+
+// peephole.c
+
+void peephole(Code *code);
+
+// licm.c
+
+void hoist_invariants(Code *code);
+
+// regalloc.c
+
+int alloc_regs(Code *code, int frame_size, _Bool *used);
+
+// elf.c
+
+typedef enum {
+  SEC_UNDEF,
+  SEC_TEXT,
+  SEC_DATA,
+  SEC_BSS,
+} SectionKind;
+
+typedef enum {
+  R_X86_64_64 = 1,
+  R_X86_64_PC32 = 2,
+  R_X86_64_PLT32 = 4,
+} RelocType;
+
+typedef struct {
+  char *name;
+  SectionKind sec;
+  long offset;
+  long size;
+  _Bool is_global;
+  int index;
+} Symbol;
+
+typedef struct {
+  SectionKind sec;
+  long offset;
+  RelocType type;
+  char *sym;
+  long addend;
+} Reloc;
+
+// Machine code and data of a translation unit, with symbols and
+// relocations referring to symbols by name.
+typedef struct {
+  Sink *text;
+  Sink *data;
+  long bss_size;
+  int data_align;
+  int bss_align;
+
+  Symbol **syms;
+  int nsyms;
+  int syms_cap;
+  Symbol **map;
+  int map_cap;
+
+  Reloc *relocs;
+  int nrelocs;
+  int relocs_cap;
+} Object;
+
+Object *new_object(void);
+Symbol *find_symbol(Object *obj, char *name);
+Symbol *obj_symbol(Object *obj, char *name, SectionKind sec, _Bool is_global);
+void obj_reloc(Object *obj, SectionKind sec, long offset, RelocType type,
+               char *sym, long addend);
+void obj_add_globals(Object *obj, VarList *globals);
+void write_object(Object *obj, Sink *out);
+
+// promote.c
+
+void promote_vars(Function *fn);
+
+// inline.c
+
+extern _Bool no_inline;
+
+_Bool may_inline(Token *begin, Token *end);
+Function *find_inline(char *name);
+void inline_function(Function *fn, Token *begin, Token *end);
+
+// encode.c
+
+void encode_code(Object *obj, Code *code);
+void align_text(Object *obj);
+
+// jit.c
+
+void jit_add_library(char *name);
+void run_object(Object *obj, int argc, char **argv);
+
+// worker.c
+
+int start_worker(int *fd);
+void finish_worker(Sink *s, int fd);
+char *wait_worker(int pid, int fd, long *len);
+
+// codegen.c
+
+extern long num_insns;
+extern int codegen_jobs;
+extern _Bool omit_frame_pointer;
+
+void codegen(Program *prog, Sink *out);
+Object *codegen_object(Program *prog);
+
+// cache.c
+
+extern char *cache_dir;
+
+char *cache_load(char *key);
+void cache_store(char *key, char *buf, long len);
+
+// Peephole optimization.
+//
+// Code generation evaluates every subexpression into a register of its
+// own, so values are often moved to another register only to be used
+// once, or computed into a copy that is then moved back. Before register
+// allocation, this pass looks at a small window at the end of the
+// instructions kept so far each time it takes another one, and rewrites
+// the window as long as one of the rules below applies to it.
+
+typedef enum {
+  RULE_SELF_MOV, // mov r, r               =>
+  RULE_DEAD,     // add t, 1               =>  (t is not used again)
+  RULE_FORWARD,  // mov t, r; cmp t, s     =>  cmp r, s
+                 // lea t, [r+8]; mov s, [t]  =>  mov s, [r+8]
+  RULE_EXT_IMM,  // mov r, 5; movsx r, r   =>  mov r, 5
+  RULE_FOLD,     // mov t, r; add t, s; mov r, t  =>  add r, s
+                 // movsx t, [m]; add t, s; mov [m], t  =>  add [m], s
+  RULE_SCALE,    // shl t, 2; add r, t     =>  lea r, [r+t*4]
+} RuleKind;
+
+// A rule is tried if the kinds of the last len instructions are as listed,
+// where -1 matches any kind.
+typedef struct {
+  RuleKind kind;
+  int len;
+  int insts[3];
+} Rule;
+
+static Rule rules[] = {
+    {RULE_SELF_MOV, 1, {I_MOV}},
+    {RULE_DEAD, 1, {-1}},
+    {RULE_FORWARD, 2, {I_MOV, -1}},
+    {RULE_FORWARD, 2, {I_LEA, -1}},
+    {RULE_EXT_IMM, 2, {I_MOV, I_MOVSX}},
+    {RULE_EXT_IMM, 2, {I_MOV, I_MOVZX}},
+    {RULE_FOLD, 3, {I_MOV, -1, I_MOV}},
+    {RULE_FOLD, 3, {I_MOVSX, -1, I_MOV}},
+    {RULE_SCALE, 2, {I_SHL, I_ADD}},
+};
+
+static Code *code;
+
+// The instructions kept so far are code->insts[0..len), and cur is the
+// index of the one taken last. last[r] is the index of the last
+// instruction that mentions virtual register r.
+static int len;
+static int cur;
+static int *last;
+
+// Returns 1 if a register holds no value that is needed after the
+// instruction taken last. Variables may be needed on the next iteration of
+// a loop, so only temporaries ever die.
+static _Bool dies(int reg) {
+  return reg >= VREG + code->nvars && last[reg] <= cur;
+}
+
+static _Bool mentions(Operand *op, int reg) {
+  if (op->kind == OP_REG)
+    return op->reg == reg;
+  if (op->kind != OP_MEM)
+    return 0;
+  return (!op->sym && op->reg == reg) || (op->scale && op->index == reg);
+}
+
+// Instructions that only read their first operand.
+static _Bool reads_dst(InstKind kind) {
+  return kind == I_CMP || kind == I_IDIV || kind == I_IMULH ||
+         kind == I_PUSH || kind == I_JMP;
+}
+
+static _Bool writes(Inst *inst, int reg) {
+  return inst->dst.kind == OP_REG && inst->dst.reg == reg &&
+         !reads_dst(inst->kind);
+}
+
+static _Bool reads(Inst *inst, int reg) {
+  if (mentions(&inst->src, reg))
+    return 1;
+  if (inst->dst.kind == OP_MEM)
+    return mentions(&inst->dst, reg);
+  return mentions(&inst->dst, reg) && reads_dst(inst->kind);
+}
+
+static void rename_operand(Operand *op, int from, int to) {
+  if (op->kind == OP_MEM && op->scale && op->index == from)
+    op->index = to;
+  if ((op->kind == OP_REG || (op->kind == OP_MEM && !op->sym)) &&
+      op->reg == from)
+    op->reg = to;
+}
+
+static void rename_reg(Inst *inst, int from, int to) {
+  rename_operand(&inst->dst, from, to);
+  rename_operand(&inst->src, from, to);
+}
+
+// Instructions that do nothing but write their first operand.
+static _Bool is_pure(InstKind kind) {
+  switch (kind) {
+  case I_MOV:
+  case I_MOVSX:
+  case I_MOVZX:
+  case I_LEA:
+  case I_ADD:
+  case I_SUB:
+  case I_IMUL:
+  case I_AND:
+  case I_OR:
+  case I_XOR:
+  case I_SHL:
+  case I_SAR:
+  case I_NOT:
+  case I_SETCC:
+    return 1;
+  }
+  return 0;
+}
+
+// Instructions that write their first operand without reading it.
+static _Bool is_overwrite(InstKind kind) {
+  return kind == I_MOV || kind == I_MOVSX || kind == I_MOVZX || kind == I_LEA;
+}
+
+// Instructions that compute a new value from their first operand and
+// write it back.
+static _Bool is_update(InstKind kind) {
+  return is_pure(kind) && kind != I_MOV && kind != I_LEA &&
+         kind != I_SETCC;
+}
+
+// Instructions that can read their second operand from memory.
+static _Bool takes_mem_src(InstKind kind) {
+  return kind == I_MOV || kind == I_ADD || kind == I_SUB || kind == I_AND ||
+         kind == I_OR || kind == I_XOR || kind == I_CMP || kind == I_IMUL;
+}
+
+// Instructions that can update their first operand in memory.
+static _Bool takes_mem_dst(InstKind kind) {
+  return kind == I_ADD || kind == I_SUB || kind == I_AND || kind == I_OR ||
+         kind == I_XOR || kind == I_NOT || kind == I_SHL || kind == I_SAR;
+}
+
+static _Bool same_operand(Operand *a, Operand *b) {
+  if (a->kind != b->kind || a->reg != b->reg)
+    return 0;
+  if (a->kind == OP_REG)
+    return 1;
+  if (a->val != b->val || a->sym != b->sym || a->scale != b->scale)
+    return 0;
+  return !a->scale || a->index == b->index;
+}
+
+static void extend_reg(int reg) {
+  if (reg >= VREG && last[reg] < cur)
+    last[reg] = cur;
+}
+
+// Makes the registers an operand mentions live until the instruction
+// taken last, to which the operand has been moved.
+static void extend_use(Operand *op) {
+  if (mentions(op, op->reg))
+    extend_reg(op->reg);
+  if (op->kind == OP_MEM && op->scale)
+    extend_reg(op->index);
+}
+
+// [base+index*scale]
+static void set_mem_index(Operand *op, int base, int index, int scale) {
+  op->kind = OP_MEM;
+  op->size = 8;
+  op->reg = base;
+  op->index = index;
+  op->scale = scale;
+  op->val = 0;
+  op->sym = 0;
+}
+
+static _Bool fits_size(long val, int size) {
+  if (size == 1)
+    return val == (char)val;
+  if (size == 2)
+    return val == (short)val;
+  return val == (int)val;
+}
+
+static long extend(InstKind kind, long val, int size) {
+  if (kind == I_MOVZX)
+    return size == 1 ? val & 255 : val & 65535;
+  if (size == 1)
+    return (char)val;
+  if (size == 2)
+    return (short)val;
+  return (int)val;
+}
+
+// Is the instruction mov t, x for a temporary t? An address such as that
+// of lea t, [t+8] may mention t itself, which keeps its old value once
+// the lea is gone.
+static _Bool is_temp_mov(Inst *inst) {
+  if (inst->dst.kind != OP_REG || inst->dst.size != 8 ||
+      inst->dst.reg < VREG + code->nvars || inst->src.kind == OP_NONE)
+    return 0;
+  return inst->kind == I_LEA || !mentions(&inst->src, inst->dst.reg);
+}
+
+// Replaces the register t that an instruction reads with a memory operand.
+static _Bool forward_mem(Operand *mem, Inst *inst, int t) {
+  if (!takes_mem_src(inst->kind))
+    return 0;
+
+  Operand *op = 0;
+  if (inst->src.kind == OP_REG && inst->src.reg == t &&
+      inst->src.size == 8 && inst->dst.kind == OP_REG &&
+      inst->dst.reg != t)
+    op = &inst->src;
+  else if (inst->kind == I_CMP && inst->dst.kind == OP_REG &&
+           inst->dst.reg == t && inst->src.kind != OP_MEM &&
+           !mentions(&inst->src, t))
+    op = &inst->dst;
+  if (!op)
+    return 0;
+
+  memcpy(op, mem, sizeof(Operand));
+  extend_use(op);
+  return 1;
+}
+
+// Replaces the base register t of a memory operand with the address that
+// lea t, addr computed, or turns mov r, t into lea r, addr.
+static _Bool forward_addr(Operand *addr, Inst *inst, int t) {
+  if (addr->kind != OP_MEM)
+    return 0;
+
+  if (inst->kind == I_MOV && inst->dst.kind == OP_REG &&
+      inst->dst.reg != t && inst->src.kind == OP_REG &&
+      inst->src.reg == t && inst->src.size == 8) {
+    inst->kind = I_LEA;
+    memcpy(&inst->src, addr, sizeof(Operand));
+    extend_use(&inst->src);
+    return 1;
+  }
+
+  Operand *op = &inst->src;
+  Operand *other = &inst->dst;
+  if (inst->dst.kind == OP_MEM) {
+    op = &inst->dst;
+    other = &inst->src;
+  }
+  if (op->kind != OP_MEM || op->sym || op->reg != t || mentions(other, t))
+    return 0;
+  if (op->scale && (addr->scale || addr->sym || op->index == t))
+    return 0;
+  long disp = addr->val + op->val;
+  if (disp != (int)disp)
+    return 0;
+
+  int size = op->size;
+  if (op->scale) {
+    int index = op->index;
+    int scale = op->scale;
+    memcpy(op, addr, sizeof(Operand));
+    op->index = index;
+    op->scale = scale;
+  } else {
+    memcpy(op, addr, sizeof(Operand));
+  }
+  op->val = disp;
+  op->size = size;
+  extend_use(op);
+  return 1;
+}
+
+static _Bool forward(Inst *mov, Inst *inst) {
+  int t = mov->dst.reg;
+  if (!reads(inst, t))
+    return 0;
+
+  // An instruction that writes t without reading it ends the old value
+  // of t as well.
+  if (writes(inst, t)) {
+    if (!is_overwrite(inst->kind) || mov->kind != I_MOV ||
+        mov->src.kind != OP_REG)
+      return 0;
+    rename_operand(&inst->src, t, mov->src.reg);
+    extend_reg(mov->src.reg);
+    return 1;
+  }
+  if (!dies(t))
+    return 0;
+
+  if (mov->kind == I_LEA)
+    return forward_addr(&mov->src, inst, t);
+
+  if (mov->src.kind == OP_MEM)
+    return forward_mem(&mov->src, inst, t);
+
+  if (mov->src.kind == OP_IMM) {
+    // An immediate can only be moved, and only if it fits.
+    long val = mov->src.val;
+    if (inst->kind != I_MOV || inst->src.kind != OP_REG ||
+        mentions(&inst->dst, t))
+      return 0;
+    if (!(inst->dst.kind == OP_REG && inst->dst.size == 8) &&
+        !fits_size(val, inst->dst.size))
+      return 0;
+    inst->src.kind = OP_IMM;
+    inst->src.val = val;
+    return 1;
+  }
+
+  int r = mov->src.reg;
+  rename_reg(inst, t, r);
+  extend_reg(r);
+  return 1;
+}
+
+static _Bool fold(Inst *load, Inst *op, Inst *back) {
+  int t = load->dst.reg;
+  if (!is_update(op->kind) || op->dst.kind != OP_REG || op->dst.reg != t ||
+      !same_operand(&back->dst, &load->src) || back->src.kind != OP_REG ||
+      back->src.reg != t || !dies(t))
+    return 0;
+
+  if (load->src.kind == OP_REG) {
+    if (load->kind != I_MOV || back->dst.size != 8)
+      return 0;
+    rename_reg(op, t, load->src.reg);
+    return 1;
+  }
+
+  // The low bytes of the result only depend on the low bytes of the
+  // operands, so the update can be done in memory at the variable's own
+  // size.
+  int size = back->dst.size;
+  if (load->src.kind != OP_MEM || load->src.size != size ||
+      !takes_mem_dst(op->kind) || op->src.kind == OP_MEM ||
+      mentions(&op->src, t))
+    return 0;
+  if (op->src.kind == OP_IMM && !fits_size(op->src.val, size))
+    return 0;
+
+  memcpy(&op->dst, &back->dst, sizeof(Operand));
+  if (op->src.kind == OP_REG && op->kind != I_SHL && op->kind != I_SAR)
+    op->src.size = size;
+  return 1;
+}
+
+static _Bool apply(RuleKind kind, Inst *w) {
+  switch (kind) {
+  case RULE_SELF_MOV:
+    if (w->dst.kind != OP_REG || w->src.kind != OP_REG ||
+        w->dst.reg != w->src.reg || w->dst.size != 8)
+      return 0;
+    len--;
+    return 1;
+  case RULE_DEAD:
+    if (w->dst.kind != OP_REG || !dies(w->dst.reg) || !is_pure(w->kind))
+      return 0;
+    len--;
+    return 1;
+  case RULE_FORWARD:
+    if (!is_temp_mov(&w[0]) || !forward(&w[0], &w[1]))
+      return 0;
+    memcpy(&w[0], &w[1], sizeof(Inst));
+    len--;
+    return 1;
+  case RULE_EXT_IMM:
+    if (w[0].dst.kind != OP_REG || w[0].src.kind != OP_IMM ||
+        w[1].dst.kind != OP_REG || w[1].dst.size != 8 ||
+        w[1].src.kind != OP_REG || w[1].dst.reg != w[0].dst.reg ||
+        w[1].src.reg != w[0].dst.reg)
+      return 0;
+    w[0].src.val = extend(w[1].kind, w[0].src.val, w[1].src.size);
+    len--;
+    return 1;
+  case RULE_FOLD:
+    if (!is_temp_mov(&w[0]) || !fold(&w[0], &w[1], &w[2]))
+      return 0;
+    memcpy(&w[0], &w[1], sizeof(Inst));
+    len -= 2;
+    return 1;
+  case RULE_SCALE: {
+    int t = w[0].dst.reg;
+    int r = w[1].dst.reg;
+    if (w[0].dst.kind != OP_REG || w[0].dst.size != 8 ||
+        w[0].src.kind != OP_IMM || w[0].src.val < 1 || w[0].src.val > 3 ||
+        w[1].dst.kind != OP_REG || w[1].dst.size != 8 || r == t ||
+        w[1].src.kind != OP_REG || w[1].src.reg != t || !dies(t))
+      return 0;
+    int scale = 1 << w[0].src.val;
+    w[0].kind = I_LEA;
+    set_mem_index(&w[0].src, r, t, scale);
+    w[0].dst.reg = r;
+    len--;
+    return 1;
+  }
+  }
+  return 0;
+}
+
+static _Bool apply_rules(void) {
+  int nrules = sizeof(rules) / sizeof(*rules);
+  for (int i = 0; i < nrules; i++) {
+    Rule *rule = &rules[i];
+    if (rule->len > len)
+      continue;
+
+    Inst *w = code->insts + len - rule->len;
+    int j = 0;
+    while (j < rule->len && (rule->insts[j] < 0 || w[j].kind == rule->insts[j]))
+      j++;
+    if (j == rule->len && apply(rule->kind, w))
+      return 1;
+  }
+  return 0;
+}
+
+static void add_use(Operand *op, int i) {
+  if (mentions(op, op->reg) && op->reg >= VREG)
+    last[op->reg] = i;
+  if (op->kind == OP_MEM && op->scale && op->index >= VREG)
+    last[op->index] = i;
+}
+
+void peephole(Code *c) {
+  code = c;
+  last = allocate(ALLOC_CODE, sizeof(int) * code->nregs);
+  for (int i = 0; i < code->len; i++) {
+    add_use(&code->insts[i].dst, i);
+    add_use(&code->insts[i].src, i);
+  }
+
+  len = 0;
+  for (cur = 0; cur < code->len; cur++) {
+    if (len < cur)
+      memcpy(&code->insts[len], &code->insts[cur], sizeof(Inst));
+    len++;
+    while (apply_rules())
+      ;
+  }
+  code->len = len;
+  free(last);
+}
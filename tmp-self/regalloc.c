@@ -0,0 +1,1206 @@
+typedef struct FILE FILE;
+typedef long size_t;
+struct timespec {
+  long tv_sec;
+  long tv_nsec;
+};
+struct rusage {
+  long ru_utime[2];
+  long ru_stime[2];
+  long ru_maxrss;
+  long ru_rest[13];
+};
+extern FILE *stdout;
+extern FILE *stderr;
+
+void *malloc(long size);
+void *calloc(long nmemb, long size);
+int *__errno_location();
+char *strerror(int errnum);
+FILE *fopen(char *pathname, char *mode);
+long fread(void *ptr, long size, long nmemb, FILE *stream);
+int feof(FILE *stream);
+static void assert() {}
+int strcmp(char *s1, char *s2);
+int printf(char *fmt, ...);
+int sprintf(char *buf, char *fmt, ...);
+long strlen(char *p);
+int strncmp(char *p, char *q);
+void *memcpy(char *dst, char *src, long n);
+char *strndup(char *p, long n);
+int isspace(int c);
+char *strstr(char *haystack, char *needle);
+long strtol(char *nptr, char **endptr, int base);
+int memcmp(char *s1, char *s2, long n);
+int fprintf(FILE *fp, char *fmt, ...);
+int fputs(char *s, FILE *fp);
+long fwrite(void *ptr, long size, long nmemb, FILE *stream);
+int fclose(FILE *fp);
+int fseek(FILE *fp, long offset, int whence);
+long ftell(FILE *fp);
+FILE *open_memstream(char **ptr, size_t *sizeloc);
+int rename(char *oldpath, char *newpath);
+int mkdir(char *pathname, int mode);
+int getpid(void);
+int clock_gettime(int clockid, struct timespec *tp);
+int getrusage(int who, struct rusage *usage);
+void *realloc(void *ptr, long size);
+void free(void *ptr);
+void *memset(void *s, int c, long n);
+int open(char *pathname, int flags, ...);
+int close(int fd);
+long write(int fd, void *buf, long count);
+int ftruncate(int fd, long length);
+void *mmap(void *addr, long length, int prot, int flags, int fd, long offset);
+int munmap(void *addr, long length);
+void *mremap(void *old_address, long old_size, long new_size, int flags);
+int mprotect(void *addr, long len, int prot);
+void *dlopen(char *filename, int flags);
+void *dlsym(void *handle, char *symbol);
+char *dlerror(void);
+char *strchr(char *s, int c);
+void *bsearch(void *key, void *base, long nmemb, long size, void *compar);
+extern char **environ;
+int pipe(int *pipefd);
+int fork(void);
+int waitpid(int pid, int *wstatus, int options);
+long read(int fd, void *buf, long count);
+void _exit(int status);
+void exit(int status);
+void *memmove(void *dest, void *src, long n);
+
+typedef struct {
+  int gp_offset;
+  int fp_offset;
+  void *overflow_arg_area;
+  void *reg_save_area;
+} __va_elem;
+
+typedef __va_elem va_list[1];
+
+static void va_end(__va_elem *ap) {}
+
+typedef struct Type Type;
+typedef struct Member Member;
+typedef struct Initializer Initializer;
+typedef struct Program Program;
+
+// main.c
+
+typedef enum {
+  PHASE_READ,
+  PHASE_TOKENIZE,
+  PHASE_PARSE,
+  PHASE_LAYOUT,
+  PHASE_EMIT_DATA,
+  PHASE_EMIT_TEXT,
+  PHASE_DONE,
+} Phase;
+
+extern char *phase_names[];
+extern Phase current_phase;
+extern _Bool time_report;
+
+long now_ns(void);
+void enter_phase(Phase phase);
+
+// alloc.c
+
+typedef enum {
+  ALLOC_TOKEN,
+  ALLOC_NODE,
+  ALLOC_TYPE,
+  ALLOC_MEMBER,
+  ALLOC_VAR,
+  ALLOC_SCOPE,
+  ALLOC_INITIALIZER,
+  ALLOC_FUNCTION,
+  ALLOC_CODE, // Instructions and the arrays of the back end
+  ALLOC_OTHER,
+  ALLOC_NKINDS,
+} AllocKind;
+
+extern _Bool mem_report;
+
+void *allocate(AllocKind kind, long size);
+void *reallocate(AllocKind kind, void *p, long size);
+void print_mem_report(Program *prog);
+
+// tokenize.c
+
+typedef enum {
+  TK_RESERVED,
+  TK_IDENT,
+  TK_STR,
+  TK_NUM,
+  TK_EOF,
+} TokenKind;
+
+typedef struct Token Token;
+struct Token {
+  TokenKind kind;
+  Token *next;
+  long val;
+  Type *ty;
+  char *str;
+  int len;
+
+  char *contents;
+  int cont_len;
+};
+
+void error(char *fmt, ...);
+void error_at(char *loc, char *fmt, ...);
+void error_tok(Token *tok, char *fmt, ...);
+void warn_tok(Token *tok, char *fmt, ...);
+Token *peek(char *s);
+Token *consume(char *op);
+Token *consume_ident(void);
+void expect(char *op);
+char *expect_ident(void);
+_Bool at_eof(void);
+Token *tokenize(void);
+
+extern char *filename;
+extern char *user_input;
+extern Token *token;
+
+// parse.c
+
+typedef struct Var Var;
+struct Var {
+  char *name;
+  Type *ty;
+  _Bool is_local;
+
+  int offset;
+
+  _Bool is_static;
+  Initializer *initializer;
+
+  // Set by promote_vars(). A local variable in a register has no stack
+  // slot and is held by virtual register reg instead.
+  int uses;
+  _Bool addr_taken;
+  _Bool in_reg;
+  int reg;
+};
+
+typedef struct VarList VarList;
+struct VarList {
+  VarList *next;
+  Var *var;
+};
+
+typedef enum {
+  ND_ADD,
+  ND_PTR_ADD,
+  ND_SUB,
+  ND_PTR_SUB,
+  ND_PTR_DIFF,
+  ND_MUL,
+  ND_DIV,
+  ND_BITAND,
+  ND_BITOR,
+  ND_BITXOR,
+  ND_SHL,
+  ND_SHR,
+  ND_EQ,
+  ND_NE,
+  ND_LT,
+  ND_LE,
+  ND_ASSIGN,
+  ND_TERNARY,
+  ND_PRE_INC,
+  ND_PRE_DEC,
+  ND_POST_INC,
+  ND_POST_DEC,
+  ND_ADD_EQ,
+  ND_PTR_ADD_EQ,
+  ND_SUB_EQ,
+  ND_PTR_SUB_EQ,
+  ND_MUL_EQ,
+  ND_DIV_EQ,
+  ND_SHL_EQ,
+  ND_SHR_EQ,
+  ND_BITAND_EQ,
+  ND_BITOR_EQ,
+  ND_BITXOR_EQ,
+  ND_COMMA,
+  ND_MEMBER,
+  ND_ADDR,
+  ND_DEREF,
+  ND_NOT,
+  ND_BITNOT,
+  ND_LOGAND,
+  ND_LOGOR,
+  ND_RETURN,
+  ND_IF,
+  ND_WHILE,
+  ND_FOR,
+  ND_DO,
+  ND_SWITCH,
+  ND_CASE,
+  ND_BLOCK,
+  ND_BREAK,
+  ND_CONTINUE,
+  ND_GOTO,
+  ND_LABEL,
+  ND_FUNCALL,
+  ND_EXPR_STMT,
+  ND_STMT_EXPR,
+  ND_VAR,
+  ND_NUM,
+  ND_CAST,
+  ND_NULL,
+} NodeKind;
+
+typedef struct Node Node;
+struct Node {
+  NodeKind kind;
+  Node *next;
+  Type *ty;
+  Token *tok;
+
+  Node *lhs;
+  Node *rhs;
+
+  Node *cond;
+  Node *then;
+  Node *els;
+  Node *init;
+  Node *inc;
+
+  Node *body;
+
+  Member *member;
+
+  char *funcname;
+  Node *args;
+
+  char *label_name;
+
+  Node *case_next;
+  Node *default_case;
+  int case_label;
+  int case_end_label;
+
+  Var *var;
+
+  long val;
+};
+
+struct Initializer {
+  Initializer *next;
+
+  int sz;
+  long val;
+
+  char *label;
+  long addend;
+};
+
+typedef struct Function Function;
+struct Function {
+  Function *next;
+  char *name;
+  VarList *params;
+  _Bool is_static;
+  _Bool has_varargs;
+
+  Node *node;
+  VarList *locals;
+  VarList *globals;
+  int stack_size;
+  int nlabels;
+
+  char *cache_key;
+  char *cached_asm;
+
+  // -ftime-report
+  long parse_ns;
+  long gen_ns;
+  long num_nodes;
+  long num_insns;
+};
+
+struct Program {
+  VarList *globals;
+  Function *fns;
+};
+
+extern long num_nodes;
+
+Program *program(void);
+
+// typing.c
+
+typedef enum {
+  TY_VOID,
+  TY_BOOL,
+  TY_CHAR,
+  TY_SHORT,
+  TY_INT,
+  TY_LONG,
+  TY_ENUM,
+  TY_PTR,
+  TY_ARRAY,
+  TY_STRUCT,
+  TY_FUNC,
+} TypeKind;
+
+struct Type {
+  TypeKind kind;
+  int size;
+  int align;
+  _Bool is_incomplete;
+
+  Type *base;
+  int array_len;
+  Member *members;
+  Type *return_ty;
+};
+
+struct  Member {
+  Member *next;
+  Type *ty;
+  Token *tok;
+  char *name;
+  int offset;
+};
+
+extern Type *void_type;
+extern Type *bool_type;
+extern Type *char_type;
+extern Type *short_type;
+extern Type *int_type;
+extern Type *long_type;
+
+_Bool is_integer(Type *ty);
+int align_to(int n, int align);
+Type *pointer_to(Type *base);
+Type *array_of(Type *base, int size);
+Type *func_type(Type *return_ty);
+Type *enum_type(void);
+Type *struct_type(void);
+void add_type(Node *node);
+
+// sink.c
+
+// An output sink collects bytes in a large buffer. It hands them to a file
+// descriptor whenever the buffer fills up, keeps them all in memory if it
+// has no file descriptor, or writes them into an mmap'd file.
+typedef struct {
+  char *buf;
+  long len;
+  long cap;
+  int fd;
+  _Bool mapped;
+} Sink;
+
+Sink *new_fd_sink(int fd);
+Sink *new_mem_sink(void);
+Sink *new_file_sink(char *path);
+void sink_reserve(Sink *s, long n);
+void sink_write(Sink *s, char *p, long len);
+void sink_str(Sink *s, char *str);
+void sink_char(Sink *s, int c);
+void sink_int(Sink *s, long val);
+char *write_int(char *p, long val);
+void sink_le(Sink *s, long val, int size);
+void sink_align(Sink *s, int align);
+void sink_close(Sink *s);
+
+// asm.c
+
+// Registers are numbered as in the instruction encoding.
+typedef enum {
+  RAX,
+  RCX,
+  RDX,
+  RBX,
+  RSP,
+  RBP,
+  RSI,
+  RDI,
+  R8,
+  R9,
+  R10,
+  R11,
+  R12,
+  R13,
+  R14,
+  R15,
+
+  // Registers from here on are virtual. Code generation uses as many as
+  // it likes and the register allocator maps them to the ones above.
+  VREG,
+} Reg;
+
+// Condition codes are numbered as in the encoding of jcc and setcc.
+typedef enum {
+  CC_E = 4,
+  CC_NE = 5,
+  CC_A = 7,
+  CC_L = 12,
+  CC_GE = 13,
+  CC_LE = 14,
+  CC_G = 15,
+} CondCode;
+
+typedef enum {
+  OP_NONE,
+  OP_REG,   // reg
+  OP_IMM,   // val
+  OP_MEM,   // [reg+index*scale+val], or [rip+sym+val] if sym is set.
+            // There is no index if scale is 0.
+  OP_LABEL, // Local label number val, or [rip+label] for lea
+  OP_SYM,   // Symbol sym
+} OperandKind;
+
+typedef struct {
+  OperandKind kind;
+  int size;
+  int reg;
+  int index;
+  int scale;
+  long val;
+  char *sym;
+} Operand;
+
+typedef enum {
+  I_LABEL,
+  I_MOV,
+  I_MOVSX,
+  I_MOVZX,
+  I_LEA,
+  I_PUSH,
+  I_POP,
+  I_ADD,
+  I_SUB,
+  I_IMUL,
+  I_CQO,
+  I_IDIV,
+  I_IMULH, // rdx:rax = rax * dst
+  I_AND,
+  I_OR,
+  I_XOR,
+  I_SHL,
+  I_SAR,
+  I_NOT,
+  I_CMP,
+  I_SETCC,
+  I_JMP,
+  I_JCC,
+  I_CALL,
+  I_RET,
+  I_ENTRY, // Jump table entry: the offset of label dst from label src
+  I_ALIGN, // Padding to the next 16 bytes, unless that is more than 10
+} InstKind;
+
+typedef struct {
+  InstKind kind;
+  CondCode cc;
+  Operand dst;
+  Operand src;
+} Inst;
+
+// The instructions of one function. Local labels are referred to by
+// number and named only when printed.
+typedef struct {
+  Inst *insts;
+  int len;
+  int cap;
+  char **labels;
+  int nlabels;
+  int labels_cap;
+  int nregs;
+  int nvars; // Virtual registers from VREG on that hold variables
+  int args;  // Bitmap of the registers holding arguments on entry
+} Code;
+
+void print_insts(Sink *out, Code *code, int start, int end);
+void print_code(Sink *out, Code *code);
+
+// cfg.c
+
+// A basic block is the run of instructions from start to end.
+typedef struct {
+  int start;
+  int end;
+  int *succs;
+  int nsuccs;
+  int *preds;
+  int npreds;
+} Block;
+
+typedef struct {
+  Block *blocks;
+  int nblocks;
+  int *label_block; // The block each label starts, or -1
+} CFG;
+
+CFG *build_cfg(Code *code);
+void free_cfg(CFG *cfg);
+_Bool is_table(CFG *cfg, Code *code, int b);
+
+// opt.c
+
+extern int opt_level;
+extern _Bool dump_code;
+
+void run_passes(Code *code, char *funcname);
+
+// jump.c
+
+void optimize_jumps(Code *code);
+
+// peephole.c
+
+void peephole(Code *code);
+
+// licm.c
+
+void hoist_invariants(Code *code);
+
+// regalloc.c
+
+int alloc_regs(Code *code, int frame_size, _Bool *used);
+
+// elf.c
+
+typedef enum {
+  SEC_UNDEF,
+  SEC_TEXT,
+  SEC_DATA,
+  SEC_BSS,
+} SectionKind;
+
+typedef enum {
+  R_X86_64_64 = 1,
+  R_X86_64_PC32 = 2,
+  R_X86_64_PLT32 = 4,
+} RelocType;
+
+typedef struct {
+  char *name;
+  SectionKind sec;
+  long offset;
+  long size;
+  _Bool is_global;
+  int index;
+} Symbol;
+
+typedef struct {
+  SectionKind sec;
+  long offset;
+  RelocType type;
+  char *sym;
+  long addend;
+} Reloc;
+
+// Machine code and data of a translation unit, with symbols and
+// relocations referring to symbols by name.
+typedef struct {
+  Sink *text;
+  Sink *data;
+  long bss_size;
+  int data_align;
+  int bss_align;
+
+  Symbol **syms;
+  int nsyms;
+  int syms_cap;
+  Symbol **map;
+  int map_cap;
+
+  Reloc *relocs;
+  int nrelocs;
+  int relocs_cap;
+} Object;
+
+Object *new_object(void);
+Symbol *find_symbol(Object *obj, char *name);
+Symbol *obj_symbol(Object *obj, char *name, SectionKind sec, _Bool is_global);
+void obj_reloc(Object *obj, SectionKind sec, long offset, RelocType type,
+               char *sym, long addend);
+void obj_add_globals(Object *obj, VarList *globals);
+void write_object(Object *obj, Sink *out);
+
+// promote.c
+
+void promote_vars(Function *fn);
+
+// inline.c
+
+extern _Bool no_inline;
+
+_Bool may_inline(Token *begin, Token *end);
+Function *find_inline(char *name);
+void inline_function(Function *fn, Token *begin, Token *end);
+
+// encode.c
+
+void encode_code(Object *obj, Code *code);
+void align_text(Object *obj);
+
+// jit.c
+
+void jit_add_library(char *name);
+void run_object(Object *obj, int argc, char **argv);
+
+// worker.c
+
+int start_worker(int *fd);
+void finish_worker(Sink *s, int fd);
+char *wait_worker(int pid, int fd, long *len);
+
+// codegen.c
+
+extern long num_insns;
+extern int codegen_jobs;
+extern _Bool omit_frame_pointer;
+
+void codegen(Program *prog, Sink *out);
+Object *codegen_object(Program *prog);
+
+// cache.c
+
+extern char *cache_dir;
+
+char *cache_load(char *key);
+void cache_store(char *key, char *buf, long len);
+
+// Linear-scan register allocation.
+//
+// Code generation hands out a fresh virtual register for every value it
+// computes. The live range of a virtual register is taken to be the
+// interval from the first to the last instruction that mentions it, which
+// is exact for the temporaries of expression trees. Variables may be live
+// across loops, so theirs cover the whole function instead. Intervals are
+// visited in order of their starts and given any free register that
+// nothing overwrites in between, or else a stack slot.
+
+// Registers handed out, in order of preference. The callee-saved ones come
+// last because the function has to save them, but they are the only ones
+// that survive calls. rax and rdx are not handed out. They are needed for
+// division and return values anyway, and they are used to move spilled
+// values in and out of their stack slots.
+static int pool[] = {RSI, RDI, R8, R9, R10, R11, RCX, RBX, R12, R13, R14, R15};
+
+typedef struct {
+  int start;
+  int end;
+  int clobbered; // Registers overwritten between start and end
+  int reg;       // Physical register, or -1 if spilled
+  int slot;      // Offset of the stack slot below rbp if spilled
+} Interval;
+
+static Interval *intervals;
+
+// The registers each instruction overwrites, and the number of
+// instructions before each one that overwrite any.
+static int *clobbers;
+static int *nclobbers;
+static int clobbers_cap;
+
+// The rewritten instructions are built here and swapped with the code's
+// own array, which is then reused for the next function.
+static Inst *insts;
+static int insts_cap;
+static int len;
+
+// The caller-saved registers.
+static int clobbered_regs_call(void) {
+  return 1 << RAX | 1 << RCX | 1 << RDX | 1 << RSI | 1 << RDI | 1 << R8 |
+         1 << R9 | 1 << R10 | 1 << R11;
+}
+
+// Returns a bitmap of the physical registers an instruction overwrites.
+static int clobbered_regs(Inst *inst) {
+  switch (inst->kind) {
+  case I_CQO:
+    return 1 << RDX;
+  case I_IDIV:
+  case I_IMULH:
+    return 1 << RAX | 1 << RDX;
+  case I_CALL:
+    return clobbered_regs_call();
+  case I_CMP:
+  case I_PUSH:
+    return 0;
+  }
+  if (inst->dst.kind == OP_REG && inst->dst.reg < VREG)
+    return 1 << inst->dst.reg;
+  return 0;
+}
+
+static _Bool is_virtual(Operand *op) {
+  if (op->kind == OP_REG)
+    return op->reg >= VREG;
+  return op->kind == OP_MEM && !op->sym && op->reg >= VREG;
+}
+
+static _Bool has_virtual_index(Operand *op) {
+  return op->kind == OP_MEM && op->scale && op->index >= VREG;
+}
+
+static void add_use(int reg, int i, int *order, int *norder) {
+  Interval *it = &intervals[reg];
+  if (it->start < 0) {
+    it->start = i;
+    order[(*norder)++] = reg;
+  }
+  if (it->end < i)
+    it->end = i;
+}
+
+static void add_uses(Operand *op, int i, int *order, int *norder) {
+  if (is_virtual(op))
+    add_use(op->reg, i, order, norder);
+  if (has_virtual_index(op))
+    add_use(op->index, i, order, norder);
+}
+
+// A temporary that is computed before a loop and used in it, as when the
+// computation was moved out of the loop, is needed on every iteration. Its
+// interval is extended to the jump back to the start of the loop, which
+// may in turn extend it over an outer loop.
+static void extend_over_loops(Code *code) {
+  int *label_pos = reallocate(ALLOC_CODE, 0, sizeof(int) * code->nlabels);
+  for (int i = 0; i < code->nlabels; i++)
+    label_pos[i] = -1;
+  for (int i = 0; i < code->len; i++)
+    if (code->insts[i].kind == I_LABEL)
+      label_pos[code->insts[i].dst.val] = i;
+
+  _Bool changed = 1;
+  while (changed) {
+    changed = 0;
+    for (int j = 0; j < code->len; j++) {
+      Inst *inst = &code->insts[j];
+      if ((inst->kind != I_JMP && inst->kind != I_JCC &&
+           inst->kind != I_ENTRY) ||
+          inst->dst.kind != OP_LABEL)
+        continue;
+      int i = label_pos[inst->dst.val];
+      if (i < 0 || i > j)
+        continue;
+      for (int r = VREG + code->nvars; r < code->nregs; r++) {
+        Interval *it = &intervals[r];
+        if (it->start >= 0 && it->start < i && i <= it->end &&
+            it->end < j) {
+          it->end = j;
+          changed = 1;
+        }
+      }
+    }
+  }
+  free(label_pos);
+}
+
+// Finds the registers that lose their value between the start of an
+// interval and its end. An instruction reads its operands before it
+// writes, so whatever happens at either end does not matter.
+static void find_clobbers(Interval *it) {
+  it->clobbered = 0;
+  if (it->end <= it->start + 1 ||
+      nclobbers[it->end] == nclobbers[it->start + 1])
+    return;
+
+  int call = clobbered_regs_call();
+  for (int i = it->start + 1; i < it->end; i++) {
+    it->clobbered |= clobbers[i];
+    if ((it->clobbered & call) == call)
+      return;
+  }
+}
+
+static _Bool fits(int r, Interval *it) { return !((it->clobbered >> r) & 1); }
+
+static _Bool in_pool(int reg) {
+  int npool = sizeof(pool) / sizeof(*pool);
+  for (int i = 0; i < npool; i++)
+    if (pool[i] == reg)
+      return 1;
+  return 0;
+}
+
+// A variable that is a parameter is copied from its argument register at
+// the start of the function. It prefers to stay in that register, which
+// makes the copy go away, unless the register is one of those that are not
+// handed out.
+static int *find_hints(Code *code) {
+  int *hints = reallocate(ALLOC_CODE, 0, sizeof(int) * (code->nvars + 1));
+  for (int i = 0; i < code->nvars; i++)
+    hints[i] = -1;
+
+  for (int i = 0; i < code->len; i++) {
+    Inst *inst = &code->insts[i];
+    if (inst->kind != I_MOV && inst->kind != I_MOVSX)
+      break;
+    int v = inst->dst.reg - VREG;
+    if (inst->dst.kind == OP_REG && v >= 0 && v < code->nvars &&
+        inst->src.kind == OP_REG && inst->src.reg < VREG &&
+        ((code->args >> inst->src.reg) & 1) && in_pool(inst->src.reg))
+      hints[v] = inst->src.reg;
+  }
+  return hints;
+}
+
+static int spill(Interval *it, int frame_size) {
+  it->reg = -1;
+  it->slot = frame_size + 8;
+  return it->slot;
+}
+
+static int linear_scan(Code *code, int frame_size, _Bool *used) {
+  int npool = sizeof(pool) / sizeof(*pool);
+  int nregs = code->nregs;
+
+  intervals = allocate(ALLOC_CODE, sizeof(Interval) * nregs);
+  for (int i = VREG; i < nregs; i++)
+    intervals[i].start = -1;
+
+  // Variables come first, and they must not take the registers that still
+  // hold the arguments until those are moved to their own registers.
+  int *order = reallocate(ALLOC_CODE, 0, sizeof(int) * nregs);
+  int norder = 0;
+  for (int i = VREG; i < VREG + code->nvars; i++) {
+    intervals[i].start = 0;
+    intervals[i].end = code->len;
+    order[norder++] = i;
+  }
+  for (int i = 0; i < code->len; i++) {
+    add_uses(&code->insts[i].dst, i, order, &norder);
+    add_uses(&code->insts[i].src, i, order, &norder);
+  }
+  extend_over_loops(code);
+
+  if (clobbers_cap < code->len + 1) {
+    clobbers_cap = code->len + 1;
+    clobbers = reallocate(ALLOC_CODE, clobbers, sizeof(int) * clobbers_cap);
+    nclobbers = reallocate(ALLOC_CODE, nclobbers, sizeof(int) * clobbers_cap);
+  }
+  nclobbers[0] = 0;
+  for (int i = 0; i < code->len; i++) {
+    clobbers[i] = clobbered_regs(&code->insts[i]);
+    nclobbers[i + 1] = nclobbers[i] + (clobbers[i] != 0);
+  }
+
+  _Bool busy[VREG];
+  memset(busy, 0, sizeof(busy));
+  int *active = reallocate(ALLOC_CODE, 0, sizeof(int) * npool);
+  int nactive = 0;
+  int *hints = find_hints(code);
+
+  for (int i = 0; i < norder; i++) {
+    int v = order[i];
+    Interval *it = &intervals[v];
+
+    // Intervals that end where this one starts may share its register.
+    int n = 0;
+    for (int j = 0; j < nactive; j++) {
+      if (intervals[active[j]].end <= it->start)
+        busy[intervals[active[j]].reg] = 0;
+      else
+        active[n++] = active[j];
+    }
+    nactive = n;
+
+    find_clobbers(it);
+    int hint = -1;
+    if (v < VREG + code->nvars) {
+      hint = hints[v - VREG];
+      if (hint >= 0)
+        it->clobbered |= code->args & ~(1 << hint);
+      else
+        it->clobbered |= code->args;
+    }
+
+    it->reg = -1;
+    if (hint >= 0 && !busy[hint] && fits(hint, it))
+      it->reg = hint;
+    for (int p = 0; p < npool && it->reg < 0; p++) {
+      if (!busy[pool[p]] && fits(pool[p], it)) {
+        it->reg = pool[p];
+        break;
+      }
+    }
+
+    if (it->reg >= 0) {
+      busy[it->reg] = 1;
+      used[it->reg] = 1;
+      active[nactive++] = v;
+      continue;
+    }
+
+    // Out of registers. The interval that ends last goes to memory, which
+    // frees a register for the longest time. Variables are kept, since
+    // they are used throughout the function.
+    int victim = -1;
+    for (int j = 0; j < nactive; j++) {
+      Interval *a = &intervals[active[j]];
+      if (active[j] >= VREG + code->nvars && a->end > it->end &&
+          fits(a->reg, it) &&
+          (victim < 0 || a->end > intervals[active[victim]].end))
+        victim = j;
+    }
+
+    if (victim < 0) {
+      frame_size = spill(it, frame_size);
+      continue;
+    }
+    Interval *a = &intervals[active[victim]];
+    it->reg = a->reg;
+    frame_size = spill(a, frame_size);
+    active[victim] = v;
+  }
+
+  free(order);
+  free(active);
+  free(hints);
+  return frame_size;
+}
+
+static Inst *add_inst(Inst *inst) {
+  if (len == insts_cap) {
+    insts_cap *= 2;
+    insts = reallocate(ALLOC_CODE, insts, sizeof(Inst) * insts_cap);
+  }
+  Inst *dst = &insts[len++];
+  memcpy(dst, inst, sizeof(Inst));
+  return dst;
+}
+
+static void add_mov(Operand *dst, Operand *src) {
+  Inst inst;
+  inst.kind = I_MOV;
+  memcpy(&inst.dst, dst, sizeof(Operand));
+  memcpy(&inst.src, src, sizeof(Operand));
+  add_inst(&inst);
+}
+
+static void set_reg(Operand *op, int reg, int size) {
+  op->kind = OP_REG;
+  op->reg = reg;
+  op->size = size;
+  op->sym = 0;
+}
+
+static void set_slot(Operand *op, int slot, int size) {
+  op->kind = OP_MEM;
+  op->reg = RBP;
+  op->scale = 0;
+  op->val = -slot;
+  op->size = size;
+  op->sym = 0;
+}
+
+static _Bool operand_uses(Operand *op, int reg) {
+  if (op->kind == OP_MEM && op->scale && op->index == reg)
+    return 1;
+  return (op->kind == OP_REG || op->kind == OP_MEM) && !op->sym &&
+         op->reg == reg;
+}
+
+static _Bool uses_reg(Inst *inst, int reg) {
+  return operand_uses(&inst->dst, reg) || operand_uses(&inst->src, reg);
+}
+
+// Returns rax or rdx, whichever the instruction does not use yet.
+static int scratch(Inst *inst) {
+  if (!uses_reg(inst, RAX))
+    return RAX;
+  assert(!uses_reg(inst, RDX));
+  return RDX;
+}
+
+// Replaces virtual registers by physical ones or by stack slots.
+static void map_base(Inst *inst, Operand *op) {
+  if (!is_virtual(op))
+    return;
+
+  Interval *it = &intervals[op->reg];
+  if (it->reg >= 0) {
+    op->reg = it->reg;
+    return;
+  }
+
+  if (op->kind == OP_REG) {
+    set_slot(op, it->slot, op->size);
+    return;
+  }
+
+  // A spilled address is loaded before the instruction uses it.
+  Operand reg;
+  Operand slot;
+  set_reg(&reg, scratch(inst), 8);
+  set_slot(&slot, it->slot, 8);
+  add_mov(&reg, &slot);
+  op->reg = reg.reg;
+}
+
+// A spilled index is loaded and added to the base, so that the address
+// only takes one scratch register.
+static void map_index(Inst *inst, Operand *op) {
+  Interval *it = &intervals[op->index];
+  if (it->reg >= 0) {
+    op->index = it->reg;
+    return;
+  }
+
+  Inst lea;
+  lea.kind = I_LEA;
+  set_reg(&lea.dst, scratch(inst), 8);
+  set_slot(&lea.src, it->slot, 8);
+  add_mov(&lea.dst, &lea.src);
+  memcpy(&lea.src, op, sizeof(Operand));
+  lea.src.index = lea.dst.reg;
+  lea.src.val = 0;
+  add_inst(&lea);
+  op->reg = lea.dst.reg;
+  op->scale = 0;
+}
+
+// An address whose base and index are both spilled is computed in one
+// scratch register, since the instruction may already use the other one.
+// This changes the flags, which is fine because the instructions that
+// read them, jcc and setcc, directly follow the ones that set them and
+// have no such addresses.
+static void map_both(Inst *inst, Operand *op) {
+  Inst calc;
+  set_reg(&calc.dst, scratch(inst), 8);
+  set_slot(&calc.src, intervals[op->index].slot, 8);
+  add_mov(&calc.dst, &calc.src);
+
+  if (op->scale > 1) {
+    calc.kind = I_SHL;
+    calc.src.kind = OP_IMM;
+    calc.src.val = op->scale == 2 ? 1 : op->scale == 4 ? 2 : 3;
+    add_inst(&calc);
+  }
+
+  calc.kind = I_ADD;
+  set_slot(&calc.src, intervals[op->reg].slot, 8);
+  add_inst(&calc);
+  op->reg = calc.dst.reg;
+  op->scale = 0;
+}
+
+static void map_operand(Inst *inst, Operand *op) {
+  if (is_virtual(op) && intervals[op->reg].reg < 0 &&
+      has_virtual_index(op) && intervals[op->index].reg < 0) {
+    map_both(inst, op);
+    return;
+  }
+  map_base(inst, op);
+  if (has_virtual_index(op))
+    map_index(inst, op);
+}
+
+// These instructions need a register as their destination.
+static _Bool needs_reg_dst(InstKind kind) {
+  return kind == I_LEA || kind == I_MOVSX || kind == I_MOVZX ||
+         kind == I_IMUL;
+}
+
+static _Bool is_spilled(Operand *op) {
+  if (has_virtual_index(op) && intervals[op->index].reg < 0)
+    return 1;
+  return is_virtual(op) && intervals[op->reg].reg < 0;
+}
+
+static void rewrite(Inst *orig) {
+  // Most instructions only need their registers renamed.
+  if (!is_spilled(&orig->dst) && !is_spilled(&orig->src)) {
+    Inst *inst = add_inst(orig);
+    if (is_virtual(&inst->dst))
+      inst->dst.reg = intervals[inst->dst.reg].reg;
+    if (is_virtual(&inst->src))
+      inst->src.reg = intervals[inst->src.reg].reg;
+    if (has_virtual_index(&inst->dst))
+      inst->dst.index = intervals[inst->dst.index].reg;
+    if (has_virtual_index(&inst->src))
+      inst->src.index = intervals[inst->src.index].reg;
+
+    if (inst->kind == I_MOV && inst->dst.kind == OP_REG &&
+        inst->src.kind == OP_REG && inst->dst.reg == inst->src.reg &&
+        inst->dst.size == 8)
+      len--;
+    return;
+  }
+
+  Inst inst;
+  memcpy(&inst, orig, sizeof(Inst));
+  if (inst.dst.kind == OP_MEM)
+    map_operand(&inst, &inst.dst);
+  if (inst.src.kind == OP_MEM)
+    map_operand(&inst, &inst.src);
+  if (inst.dst.kind == OP_REG)
+    map_operand(&inst, &inst.dst);
+  if (inst.src.kind == OP_REG)
+    map_operand(&inst, &inst.src);
+
+  Operand *dst = &inst.dst;
+  Operand *src = &inst.src;
+
+  if (needs_reg_dst(inst.kind) && dst->kind == OP_MEM) {
+    // The source is read before the destination is written, so unless the
+    // destination is read too, it can take the scratch register that a
+    // spilled address was loaded into when both are taken.
+    int reg;
+    if (inst.kind != I_IMUL && uses_reg(&inst, RAX) && uses_reg(&inst, RDX))
+      reg = uses_reg(orig, RAX) ? RDX : RAX;
+    else
+      reg = scratch(&inst);
+
+    Operand mem;
+    memcpy(&mem, dst, sizeof(Operand));
+    set_reg(dst, reg, mem.size);
+    if (inst.kind == I_IMUL)
+      add_mov(dst, &mem);
+    add_inst(&inst);
+    add_mov(&mem, dst);
+    return;
+  }
+
+  // There are no instructions with two memory operands, and immediates
+  // wider than 32 bits can only be moved into registers.
+  if ((dst->kind == OP_MEM && src->kind == OP_MEM) ||
+      (dst->kind == OP_MEM && src->kind == OP_IMM &&
+       src->val != (int)src->val)) {
+    Operand reg;
+    set_reg(&reg, scratch(&inst), src->kind == OP_IMM ? 8 : src->size);
+    add_mov(&reg, src);
+    memcpy(src, &reg, sizeof(Operand));
+  }
+  add_inst(&inst);
+}
+
+// Assigns physical registers to the virtual registers of a function, whose
+// frame is frame_size bytes so far. Returns the frame size including the
+// slots of spilled values. The registers that were assigned are marked in
+// used.
+int alloc_regs(Code *code, int frame_size, _Bool *used) {
+  frame_size = linear_scan(code, frame_size, used);
+
+  if (!insts) {
+    insts_cap = 1024;
+    insts = reallocate(ALLOC_CODE, 0, sizeof(Inst) * insts_cap);
+  }
+  len = 0;
+  for (int i = 0; i < code->len; i++)
+    rewrite(&code->insts[i]);
+
+  Inst *tmp = code->insts;
+  int tmp_cap = code->cap;
+  code->insts = insts;
+  code->cap = insts_cap;
+  code->len = len;
+  insts = tmp;
+  insts_cap = tmp_cap;
+
+  free(intervals);
+  return frame_size;
+}
@@ -97,7 +97,7 @@ char *expect_ident(void) {
 bool at_eof(void) { return token->kind == TK_EOF; }
 
 static Token *new_token(TokenKind kind, Token *cur, char *str, int len) {
-  Token *tok = calloc(1, sizeof(Token));
+  Token *tok = allocate(ALLOC_TOKEN, sizeof(Token));
   tok->kind = kind;
   tok->str = str;
   tok->len = len;
@@ -212,6 +212,7 @@ static Token *read_char_literal(Token *cur, char *start) {
 
   Token *tok = new_token(TK_NUM, cur, start, p - start);
   tok->val = c;
+  tok->ty = int_type;
   return tok;
 }
 
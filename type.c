@@ -16,7 +16,7 @@ bool is_integer(Type *ty) {
 int align_to(int n, int align) { return (n + align - 1) & ~(align - 1); }
 
 static Type *new_type(TypeKind kind, int size, int align) {
-  Type *ty = calloc(1, sizeof(Type));
+  Type *ty = allocate(ALLOC_TYPE, sizeof(Type));
   ty->kind = kind;
   ty->size = size;
   ty->align = align;
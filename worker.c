@@ -0,0 +1,60 @@
+#include "chibi.h"
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Forks a worker process connected to its parent by a pipe. Returns 0 in
+// the worker, which sends its results to *fd, and the worker's pid in the
+// parent, which receives them from *fd.
+int start_worker(int *fd) {
+  int fds[2];
+  if (pipe(fds))
+    error("pipe failed: %s", strerror(errno));
+
+  int pid = fork();
+  if (pid < 0)
+    error("fork failed: %s", strerror(errno));
+
+  if (pid == 0) {
+    close(fds[0]);
+    *fd = fds[1];
+    return 0;
+  }
+  close(fds[1]);
+  *fd = fds[0];
+  return pid;
+}
+
+// Sends what the worker has produced and exits. The results are buffered
+// until the end, so a worker never waits for the parent while it works.
+void finish_worker(Sink *s, int fd) {
+  s->fd = fd;
+  sink_close(s);
+  _exit(0);
+}
+
+// Receives everything a worker sends and waits for it to exit.
+char *wait_worker(int pid, int fd, long *len) {
+  long cap = 4096;
+  char *buf = malloc(cap);
+  *len = 0;
+
+  for (;;) {
+    if (*len == cap) {
+      cap *= 2;
+      buf = realloc(buf, cap);
+    }
+    long n = read(fd, buf + *len, cap - *len);
+    if (n < 0)
+      error("read failed: %s", strerror(errno));
+    if (n == 0)
+      break;
+    *len += n;
+  }
+  close(fd);
+
+  // A worker that fails has already reported why.
+  int status;
+  if (waitpid(pid, &status, 0) < 0 || status)
+    exit(1);
+  return buf;
+}